@@ -0,0 +1,455 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+/* Benchmark driver.
+ *
+ * The benchmarks are generated from the headers by generate.py; for
+ * each SIMDe function it emits a small kernel which calls the
+ * function in a loop over inputs which were filled in before the
+ * clock started, so the only thing being timed is the function
+ * itself (plus a load and a store per call).  Two numbers are
+ * reported, both in nanoseconds per call:
+ *
+ *  * throughput_ns: SIMDE_BENCHMARK_WIDTH independent calls per
+ *    iteration, so the CPU is free to overlap them, and
+ *  * latency_ns: a dependency chain where the result of each call is
+ *    fed back in as an argument of the next one.  This is only
+ *    possible when one of the arguments has the same type as the
+ *    result; for other functions the latency is left empty.
+ *
+ * If the family has a test case it is compiled into the benchmark
+ * too, and each function's test is run (outside of the timed region)
+ * before benchmarking it.  Functions which fail their test aren't
+ * timed, and functions without a test are reported as "untested".
+ *
+ * Each row also records the extensions SIMDe was able to use natively
+ * (the "isa" column), since a "native" build without the right flags
+ * (e.g., -march=native) is mostly the same code as the "emul" one.
+ *
+ * Output is CSV by default; pass --format=json to get JSON instead. */
+
+#if !defined(SIMDE_BENCHMARK_BENCHMARK_H)
+#define SIMDE_BENCHMARK_BENCHMARK_H
+
+#if !defined(SIMDE_TEST_BARE)
+  #error Benchmarks must be built with SIMDE_TEST_BARE defined.
+#endif
+
+#include "../simde/simde-common.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(SIMDE_ARCH_X86_SSE)
+  #include <xmmintrin.h>
+#endif
+
+/* Minimum amount of time, in nanoseconds, to spend measuring the
+ * throughput and the latency of each function. */
+#if !defined(SIMDE_BENCHMARK_MIN_TIME)
+  #define SIMDE_BENCHMARK_MIN_TIME UINT64_C(20000000)
+#endif
+
+/* Number of samples taken for each measurement; the median is
+ * reported. */
+#if !defined(SIMDE_BENCHMARK_SAMPLES)
+  #define SIMDE_BENCHMARK_SAMPLES 31
+#endif
+
+/* Number of independent calls per iteration when measuring
+ * throughput. */
+#if !defined(SIMDE_BENCHMARK_WIDTH)
+  #define SIMDE_BENCHMARK_WIDTH 8
+#endif
+
+/* Loads and stores get a pointer into simde_benchmark_buffer_, with
+ * each of the independent calls using its own slice. */
+#define SIMDE_BENCHMARK_BUFFER_STRIDE 256
+
+#if defined(SIMDE_NO_NATIVE)
+  #define SIMDE_BENCHMARK_VARIANT "emul"
+#else
+  #define SIMDE_BENCHMARK_VARIANT "native"
+#endif
+
+/* Extensions SIMDe is using natively, recorded in every row.  The
+ * "native" numbers only mean something if the benchmarks were built
+ * for the target (e.g., with CFLAGS="-march=native"); otherwise most
+ * families run exactly the same code as "emul". */
+#if defined(SIMDE_X86_MMX_NATIVE)
+  #define SIMDE_BENCHMARK_ISA_MMX_ " mmx"
+#else
+  #define SIMDE_BENCHMARK_ISA_MMX_ ""
+#endif
+#if defined(SIMDE_X86_SSE2_NATIVE)
+  #define SIMDE_BENCHMARK_ISA_SSE_ " sse sse2"
+#elif defined(SIMDE_X86_SSE_NATIVE)
+  #define SIMDE_BENCHMARK_ISA_SSE_ " sse"
+#else
+  #define SIMDE_BENCHMARK_ISA_SSE_ ""
+#endif
+#if defined(SIMDE_X86_SSE4_2_NATIVE)
+  #define SIMDE_BENCHMARK_ISA_SSE4_ " sse3 ssse3 sse4.1 sse4.2"
+#elif defined(SIMDE_X86_SSE4_1_NATIVE)
+  #define SIMDE_BENCHMARK_ISA_SSE4_ " sse3 ssse3 sse4.1"
+#elif defined(SIMDE_X86_SSSE3_NATIVE)
+  #define SIMDE_BENCHMARK_ISA_SSE4_ " sse3 ssse3"
+#elif defined(SIMDE_X86_SSE3_NATIVE)
+  #define SIMDE_BENCHMARK_ISA_SSE4_ " sse3"
+#else
+  #define SIMDE_BENCHMARK_ISA_SSE4_ ""
+#endif
+#if defined(SIMDE_X86_AVX2_NATIVE)
+  #define SIMDE_BENCHMARK_ISA_AVX_ " avx avx2"
+#elif defined(SIMDE_X86_AVX_NATIVE)
+  #define SIMDE_BENCHMARK_ISA_AVX_ " avx"
+#else
+  #define SIMDE_BENCHMARK_ISA_AVX_ ""
+#endif
+#if defined(SIMDE_X86_FMA_NATIVE)
+  #define SIMDE_BENCHMARK_ISA_FMA_ " fma"
+#else
+  #define SIMDE_BENCHMARK_ISA_FMA_ ""
+#endif
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define SIMDE_BENCHMARK_ISA_AVX512_ " avx512f"
+#else
+  #define SIMDE_BENCHMARK_ISA_AVX512_ ""
+#endif
+#if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+  #define SIMDE_BENCHMARK_ISA_NEON_ " neon-a64v8"
+#elif defined(SIMDE_ARM_NEON_A32V8_NATIVE)
+  #define SIMDE_BENCHMARK_ISA_NEON_ " neon-a32v8"
+#elif defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+  #define SIMDE_BENCHMARK_ISA_NEON_ " neon-a32v7"
+#else
+  #define SIMDE_BENCHMARK_ISA_NEON_ ""
+#endif
+#if defined(SIMDE_POWER_ALTIVEC_P5_NATIVE)
+  #define SIMDE_BENCHMARK_ISA_ALTIVEC_ " altivec"
+#else
+  #define SIMDE_BENCHMARK_ISA_ALTIVEC_ ""
+#endif
+#if defined(SIMDE_WASM_SIMD128_NATIVE)
+  #define SIMDE_BENCHMARK_ISA_WASM_ " wasm-simd128"
+#else
+  #define SIMDE_BENCHMARK_ISA_WASM_ ""
+#endif
+
+static const char simde_benchmark_isa_list_[] =
+  SIMDE_BENCHMARK_ISA_MMX_ SIMDE_BENCHMARK_ISA_SSE_ SIMDE_BENCHMARK_ISA_SSE4_
+  SIMDE_BENCHMARK_ISA_AVX_ SIMDE_BENCHMARK_ISA_FMA_ SIMDE_BENCHMARK_ISA_AVX512_
+  SIMDE_BENCHMARK_ISA_NEON_ SIMDE_BENCHMARK_ISA_ALTIVEC_ SIMDE_BENCHMARK_ISA_WASM_;
+#define SIMDE_BENCHMARK_ISA ((simde_benchmark_isa_list_[0] == '\0') ? "none" : (simde_benchmark_isa_list_ + 1))
+
+/* A "native" build which can't use anything beyond what every CPU of
+ * the architecture has (SSE2 on x86-64, for example). */
+#if \
+    !defined(SIMDE_NO_NATIVE) && \
+    !defined(SIMDE_X86_SSE3_NATIVE) && \
+    !defined(SIMDE_ARM_NEON_A32V7_NATIVE) && \
+    !defined(SIMDE_POWER_ALTIVEC_P5_NATIVE) && \
+    !defined(SIMDE_WASM_SIMD128_NATIVE)
+  #define SIMDE_BENCHMARK_BASELINE_ONLY
+#endif
+
+#if defined(__cplusplus)
+  #define SIMDE_BENCHMARK_LANG "cpp"
+#else
+  #define SIMDE_BENCHMARK_LANG "c"
+#endif
+
+/* SIMDE_BENCHMARK_CLOBBER() forces the compiler to assume any memory
+ * which has escaped (see SIMDE_BENCHMARK_ESCAPE) was read and
+ * modified, so it can't hoist the calls out of the loop or drop the
+ * results. */
+#if defined(HEDLEY_GCC_VERSION) || defined(__clang__) || HEDLEY_INTEL_VERSION_CHECK(13,0,0)
+  #define SIMDE_BENCHMARK_CLOBBER() __asm__ __volatile__("" : : : "memory")
+  #define SIMDE_BENCHMARK_ESCAPE(ptr) __asm__ __volatile__("" : : "g"(ptr) : "memory")
+#else
+  static void simde_benchmark_clobber_nop_(void) { }
+  static void (* volatile simde_benchmark_clobber_)(void) = simde_benchmark_clobber_nop_;
+  static const void* volatile simde_benchmark_escaped_;
+  #define SIMDE_BENCHMARK_CLOBBER() simde_benchmark_clobber_()
+  #define SIMDE_BENCHMARK_ESCAPE(ptr) (simde_benchmark_escaped_ = HEDLEY_STATIC_CAST(const void*, ptr))
+#endif
+
+typedef enum SimdeBenchmarkFormat {
+  SIMDE_BENCHMARK_FORMAT_CSV,
+  SIMDE_BENCHMARK_FORMAT_JSON
+} SimdeBenchmarkFormat;
+
+typedef enum SimdeBenchmarkMode {
+  SIMDE_BENCHMARK_MODE_INIT,
+  SIMDE_BENCHMARK_MODE_THROUGHPUT,
+  SIMDE_BENCHMARK_MODE_LATENCY
+} SimdeBenchmarkMode;
+
+typedef enum SimdeBenchmarkKind {
+  SIMDE_BENCHMARK_KIND_INT,
+  SIMDE_BENCHMARK_KIND_F32,
+  SIMDE_BENCHMARK_KIND_F64
+} SimdeBenchmarkKind;
+
+/* The generated kernels.  With SIMDE_BENCHMARK_MODE_INIT the kernel
+ * fills in its inputs; otherwise it runs the requested number of
+ * iterations.  Returns 0 if the mode isn't supported (i.e., latency
+ * for functions which can't be chained). */
+typedef struct SimdeBenchmark {
+  const char* name;
+  int (* func)(SimdeBenchmarkMode mode, uint64_t iterations);
+} SimdeBenchmark;
+
+static SimdeBenchmarkFormat simde_benchmark_format_ = SIMDE_BENCHMARK_FORMAT_CSV;
+static size_t simde_benchmark_count_ = 0;
+SIMDE_ALIGN_TO_64 static uint8_t simde_benchmark_buffer_[SIMDE_BENCHMARK_WIDTH * SIMDE_BENCHMARK_BUFFER_STRIDE];
+
+static uint64_t
+simde_benchmark_now_(void) {
+  #if defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (HEDLEY_STATIC_CAST(uint64_t, ts.tv_sec) * UINT64_C(1000000000)) + HEDLEY_STATIC_CAST(uint64_t, ts.tv_nsec);
+  #else
+    return HEDLEY_STATIC_CAST(uint64_t, clock()) * (UINT64_C(1000000000) / CLOCKS_PER_SEC);
+  #endif
+}
+
+static void
+simde_benchmark_sort_(size_t count, uint64_t values[HEDLEY_ARRAY_PARAM(count)]) {
+  for (size_t i = 1 ; i < count ; i++) {
+    uint64_t v = values[i];
+    size_t j = i;
+    while (j > 0 && values[j - 1] > v) {
+      values[j] = values[j - 1];
+      j--;
+    }
+    values[j] = v;
+  }
+}
+
+/* Fill the inputs with values which won't hit any slow paths: small
+ * positive integers (so there are no divisions by zero, and shift
+ * counts and indices stay reasonable) and floating-point values in
+ * [1, 2), so there are no denormals. */
+static void
+simde_benchmark_fill_(void* dest, size_t size, SimdeBenchmarkKind kind) {
+  uint8_t* d = HEDLEY_STATIC_CAST(uint8_t*, dest);
+
+  switch (kind) {
+    case SIMDE_BENCHMARK_KIND_F32:
+      for (size_t i = 0 ; i < (size / sizeof(simde_float32)) ; i++) {
+        simde_float32 v = SIMDE_FLOAT32_C(1.0) + (HEDLEY_STATIC_CAST(simde_float32, i % 16) * SIMDE_FLOAT32_C(0.0625));
+        simde_memcpy(d + (i * sizeof(v)), &v, sizeof(v));
+      }
+      break;
+    case SIMDE_BENCHMARK_KIND_F64:
+      for (size_t i = 0 ; i < (size / sizeof(simde_float64)) ; i++) {
+        simde_float64 v = SIMDE_FLOAT64_C(1.0) + (HEDLEY_STATIC_CAST(simde_float64, i % 16) * SIMDE_FLOAT64_C(0.0625));
+        simde_memcpy(d + (i * sizeof(v)), &v, sizeof(v));
+      }
+      break;
+    case SIMDE_BENCHMARK_KIND_INT:
+      for (size_t i = 0 ; i < size ; i++)
+        d[i] = HEDLEY_STATIC_CAST(uint8_t, 1 + ((i * 37) % 127));
+      break;
+  }
+
+  SIMDE_BENCHMARK_ESCAPE(dest);
+}
+
+/* Latency chains tend to drift towards zero and, once there, get
+ * stuck on denormals, which can be a hundred times slower than normal
+ * values.  Flush them to zero while timing; the tests are run with
+ * the default floating-point environment. */
+static uint64_t
+simde_benchmark_fpenv_begin_(void) {
+  #if defined(SIMDE_ARCH_X86_SSE)
+    unsigned int csr = _mm_getcsr();
+    _mm_setcsr(csr | 0x8040); /* FTZ | DAZ */
+    return HEDLEY_STATIC_CAST(uint64_t, csr);
+  #elif defined(SIMDE_ARCH_AARCH64) && (defined(HEDLEY_GCC_VERSION) || defined(__clang__))
+    uint64_t fpcr;
+    __asm__ __volatile__("mrs %0, fpcr" : "=r"(fpcr));
+    __asm__ __volatile__("msr fpcr, %0" : : "r"(fpcr | (UINT64_C(1) << 24))); /* FZ */
+    return fpcr;
+  #else
+    return 0;
+  #endif
+}
+
+static void
+simde_benchmark_fpenv_end_(uint64_t env) {
+  #if defined(SIMDE_ARCH_X86_SSE)
+    _mm_setcsr(HEDLEY_STATIC_CAST(unsigned int, env));
+  #elif defined(SIMDE_ARCH_AARCH64) && (defined(HEDLEY_GCC_VERSION) || defined(__clang__))
+    __asm__ __volatile__("msr fpcr, %0" : : "r"(env));
+  #else
+    (void) env;
+  #endif
+}
+
+static void
+simde_benchmark_begin(int argc, char* argv[]) {
+  for (int i = 1 ; i < argc ; i++) {
+    if (strcmp(argv[i], "--format=json") == 0) {
+      simde_benchmark_format_ = SIMDE_BENCHMARK_FORMAT_JSON;
+    } else if (strcmp(argv[i], "--format=csv") == 0) {
+      simde_benchmark_format_ = SIMDE_BENCHMARK_FORMAT_CSV;
+    } else {
+      fprintf(stderr, "Unrecognized argument: %s\n", argv[i]);
+    }
+  }
+
+  #if defined(SIMDE_BENCHMARK_BASELINE_ONLY)
+    fprintf(stderr,
+      "Warning: this \"native\" benchmark was built without any extensions beyond the\n"
+      "baseline for the architecture (%s), so most functions will use the same\n"
+      "code as the \"emul\" build.  Rebuild with CFLAGS=\"-march=native\" (or similar).\n",
+      SIMDE_BENCHMARK_ISA);
+  #endif
+
+  simde_benchmark_fill_(simde_benchmark_buffer_, sizeof(simde_benchmark_buffer_), SIMDE_BENCHMARK_KIND_INT);
+
+  if (simde_benchmark_format_ == SIMDE_BENCHMARK_FORMAT_JSON) {
+    fputs("[\n", stdout);
+  } else {
+    fputs("family,function,variant,lang,isa,iterations,throughput_ns,latency_ns,status\n", stdout);
+  }
+}
+
+/* Returns the median time per call, in nanoseconds, or a negative
+ * value if the kernel doesn't support the mode.  The number of calls
+ * timed is stored in calls. */
+static double
+simde_benchmark_measure_(const SimdeBenchmark* benchmark, SimdeBenchmarkMode mode, uint64_t calls_per_iteration, uint64_t* calls) {
+  uint64_t samples[SIMDE_BENCHMARK_SAMPLES];
+  uint64_t start, elapsed;
+  uint64_t iterations = 1;
+
+  /* Figure out how many iterations we need for each sample to be long
+   * enough to be measured accurately; this also warms up the caches
+   * and the branch predictor. */
+  for (;;) {
+    start = simde_benchmark_now_();
+    if (!benchmark->func(mode, iterations))
+      return -1.0;
+    elapsed = simde_benchmark_now_() - start;
+
+    if (elapsed >= (SIMDE_BENCHMARK_MIN_TIME / SIMDE_BENCHMARK_SAMPLES) || iterations >= (UINT64_C(1) << 40))
+      break;
+    iterations *= 2;
+  }
+
+  for (size_t s = 0 ; s < SIMDE_BENCHMARK_SAMPLES ; s++) {
+    start = simde_benchmark_now_();
+    benchmark->func(mode, iterations);
+    samples[s] = simde_benchmark_now_() - start;
+  }
+  simde_benchmark_sort_(SIMDE_BENCHMARK_SAMPLES, samples);
+
+  *calls = iterations * calls_per_iteration * SIMDE_BENCHMARK_SAMPLES;
+  return HEDLEY_STATIC_CAST(double, samples[SIMDE_BENCHMARK_SAMPLES / 2]) / HEDLEY_STATIC_CAST(double, iterations * calls_per_iteration);
+}
+
+static void
+simde_benchmark_run(const char* family, const SimdeBenchmark* benchmark, const char* status) {
+  uint64_t calls = 0, latency_calls = 0;
+  double throughput = -1.0, latency = -1.0;
+  char latency_str[32] = "";
+
+  /* Don't bother timing failing functions; the numbers wouldn't mean
+   * anything. */
+  if (strcmp(status, "fail") != 0) {
+    uint64_t env = simde_benchmark_fpenv_begin_();
+    benchmark->func(SIMDE_BENCHMARK_MODE_INIT, 0);
+    throughput = simde_benchmark_measure_(benchmark, SIMDE_BENCHMARK_MODE_THROUGHPUT, SIMDE_BENCHMARK_WIDTH, &calls);
+    latency = simde_benchmark_measure_(benchmark, SIMDE_BENCHMARK_MODE_LATENCY, 1, &latency_calls);
+    simde_benchmark_fpenv_end_(env);
+  }
+
+  if (simde_benchmark_format_ == SIMDE_BENCHMARK_FORMAT_JSON) {
+    if (latency >= 0.0)
+      snprintf(latency_str, sizeof(latency_str), "%.3f", latency);
+    else
+      strcpy(latency_str, "null");
+
+    fprintf(stdout,
+      "%s  { \"family\": \"%s\", \"function\": \"%s\", \"variant\": \"%s\", \"lang\": \"%s\", \"isa\": \"%s\", "
+      "\"iterations\": %" PRIu64 ", \"throughput_ns\": %.3f, \"latency_ns\": %s, \"status\": \"%s\" }",
+      (simde_benchmark_count_ == 0) ? "" : ",\n",
+      family, benchmark->name, SIMDE_BENCHMARK_VARIANT, SIMDE_BENCHMARK_LANG, SIMDE_BENCHMARK_ISA,
+      calls, (throughput >= 0.0) ? throughput : 0.0, latency_str, status);
+  } else {
+    if (latency >= 0.0)
+      snprintf(latency_str, sizeof(latency_str), "%.3f", latency);
+
+    fprintf(stdout, "%s,%s,%s,%s,%s,%" PRIu64 ",%.3f,%s,%s\n",
+      family, benchmark->name, SIMDE_BENCHMARK_VARIANT, SIMDE_BENCHMARK_LANG, SIMDE_BENCHMARK_ISA,
+      calls, (throughput >= 0.0) ? throughput : 0.0, latency_str, status);
+  }
+  fflush(stdout);
+
+  simde_benchmark_count_++;
+}
+
+static int
+simde_benchmark_end(void) {
+  if (simde_benchmark_format_ == SIMDE_BENCHMARK_FORMAT_JSON)
+    fputs("\n]\n", stdout);
+
+  return EXIT_SUCCESS;
+}
+
+/* The status comes from running the test with the same name as the
+ * function, if there is one. */
+#define SIMDE_BENCHMARK_MAIN(family, benchmarks, tests) \
+  int main(int argc, char* argv[]) { \
+    simde_benchmark_begin(argc, argv); \
+    for (size_t i = 0 ; benchmarks[i].name != NULL ; i++) { \
+      const char* status = "untested"; \
+      for (size_t j = 0 ; j < (sizeof(tests) / sizeof(tests[0])) ; j++) { \
+        if (strcmp(tests[j].name, benchmarks[i].name) == 0) { \
+          status = (tests[j].func() == 0) ? "ok" : "fail"; \
+          break; \
+        } \
+      } \
+      simde_benchmark_run(family, &(benchmarks[i]), status); \
+    } \
+    return simde_benchmark_end(); \
+  }
+
+#define SIMDE_BENCHMARK_MAIN_UNTESTED(family, benchmarks) \
+  int main(int argc, char* argv[]) { \
+    simde_benchmark_begin(argc, argv); \
+    for (size_t i = 0 ; benchmarks[i].name != NULL ; i++) \
+      simde_benchmark_run(family, &(benchmarks[i]), "untested"); \
+    return simde_benchmark_end(); \
+  }
+
+#endif /* !defined(SIMDE_BENCHMARK_BENCHMARK_H) */
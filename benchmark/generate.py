@@ -0,0 +1,238 @@
+#!/usr/bin/python3
+
+# generate.py
+#
+# To the extent possible under law, the author(s) have dedicated all
+# copyright and related and neighboring rights to this software to
+# the public domain worldwide. This software is distributed without
+# any warranty.
+#
+# For details, see <http://creativecommons.org/publicdomain/zero/1.0/>.
+# SPDX-License-Identifier: CC0-1.0
+
+# Generate the benchmark for one family of functions.
+#
+# Usage: generate.py FAMILY HEADER OUTPUT [TEST]
+#
+# HEADER is parsed for the functions it defines, and a small kernel is
+# generated for each one which calls it in a loop over preloaded
+# inputs; see benchmark.h for the details.  If there is a TEST it is
+# included too, and the test cases are used (outside of the timed
+# region) to make sure each function actually works before timing it.
+#
+# Functions which are only defined conditionally, which take pointers
+# to arbitrary memory (gathers and scatters) or which modify global
+# state are skipped.
+
+import sys, re, os
+
+function_re = re.compile(
+  r'^SIMDE_(?:HUGE_)?FUNCTION_ATTRIBUTES\s*\n'
+  r'(?P<ret>[A-Za-z_][A-Za-z0-9_ \t\*]*?)\s*\n'
+  r'(?P<name>simde_[A-Za-z0-9_]+)\s*\((?P<params>[^{;]*?)\)\s*'
+  r'(?P<attrs>(?:SIMDE_REQUIRE_[A-Z_]+\s*\([^)]*\)\s*)*)\{',
+  re.MULTILINE)
+range_re = re.compile(r'SIMDE_REQUIRE_CONSTANT_RANGE\s*\(\s*(\w+)\s*,\s*(-?\w+)\s*,')
+constant_re = re.compile(r'SIMDE_REQUIRE_(?:CONSTANT(?:_RANGE)?|RANGE)\s*\(\s*(\w+)')
+param_re = re.compile(r'^(?P<type>.*?)\s*\b(?P<name>[A-Za-z_][A-Za-z0-9_]*)\s*(?P<array>\[[^\]]*\])?$')
+
+skip_re = re.compile(r'^simde_x_|^simde__|_private|_$|gather|scatter|setcsr|malloc|free')
+immediate_types = ['int', 'const int', 'int const']
+
+def split_params(params):
+  depth = 0
+  current = ''
+  result = []
+  for c in params:
+    if c == ',' and depth == 0:
+      result.append(current.strip())
+      current = ''
+      continue
+    if c == '(':
+      depth += 1
+    elif c == ')':
+      depth -= 1
+    current += c
+  if current.strip():
+    result.append(current.strip())
+  if result == ['void']:
+    return []
+  return result
+
+def type_kind(t):
+  t = re.sub(r'\bconst\b', '', t).strip()
+  if re.search(r'm(?:128|256|512)d\b|float64|\bdouble\b', t):
+    return 'SIMDE_BENCHMARK_KIND_F64'
+  if re.search(r'simde__m(?:128|256|512)\b|float32|\bfloat\b', t):
+    return 'SIMDE_BENCHMARK_KIND_F32'
+  return 'SIMDE_BENCHMARK_KIND_INT'
+
+# Conditionals which wrap (nearly) a whole header to work around a
+# compiler bug; the functions inside are still always defined.
+transparent_re = re.compile(r'#\s*if\s+!\s*defined\s*\(\s*SIMDE_BUG_INTEL_857088\s*\)')
+
+def top_level_offsets(source):
+  # Offsets of lines which aren't inside of any preprocessor
+  # conditional other than the include guard.
+  stack = []
+  offset = 0
+  top = set()
+  for line in source.splitlines(True):
+    directive = line.strip()
+    if re.match(r'#\s*if', directive):
+      stack.append(transparent_re.match(directive) is None)
+    elif re.match(r'#\s*endif', directive):
+      stack.pop()
+    elif stack.count(True) == 1:
+      top.add(offset)
+    offset += len(line)
+  return top
+
+def parse(header):
+  with open(header) as f:
+    source = f.read()
+  top = top_level_offsets(source)
+
+  functions = []
+  seen = set()
+  for m in function_re.finditer(source):
+    name = m.group('name')
+    ret = ' '.join(m.group('ret').split())
+    if m.start() not in top or name in seen or skip_re.search(name) or '*' in ret:
+      continue
+
+    ranges = dict((p, lo) for p, lo in range_re.findall(m.group('attrs')))
+    constants = set(constant_re.findall(m.group('attrs')))
+
+    params = []
+    for p in split_params(' '.join(m.group('params').split())):
+      pm = param_re.match(p)
+      if pm is None:
+        params = None
+        break
+      ptype = pm.group('type')
+      pname = pm.group('name')
+      if pm.group('array') or '*' in ptype:
+        if pm.group('array'):
+          ptype += '*'
+        params.append(('pointer', ptype, pname, None))
+      elif pname in constants or ptype in immediate_types:
+        params.append(('immediate', ptype, pname, ranges.get(pname, '0')))
+      else:
+        params.append(('value', ptype, pname, type_kind(ptype)))
+    if params is None:
+      continue
+
+    seen.add(name)
+    functions.append((name, ret, params))
+  return functions
+
+def arguments(params, index):
+  args = []
+  for kind, ptype, pname, extra in params:
+    if kind == 'pointer':
+      args.append('(%s) (void*) (simde_benchmark_buffer_ + (%s * SIMDE_BENCHMARK_BUFFER_STRIDE))' % (ptype, index))
+    elif kind == 'immediate':
+      args.append(extra)
+    else:
+      args.append('in_%s[%s]' % (pname, index))
+  return args
+
+def chain_param(ret, params):
+  # The argument the result is fed back into when measuring latency.
+  # Prefer `a' so the chain goes through the data rather than, say,
+  # the source of a masked operation.
+  candidates = [p for p in params if p[0] == 'value' and p[1].replace('const ', '').strip() == ret]
+  for p in candidates:
+    if p[2] == 'a':
+      return p
+  return candidates[0] if candidates else None
+
+def generate(out, name, ret, params):
+  short = name[len('simde_'):]
+  values = [p for p in params if p[0] == 'value']
+  chain = None if ret == 'void' else chain_param(ret, params)
+
+  out.write('static int\n')
+  out.write('simde_benchmark_%s (SimdeBenchmarkMode mode, uint64_t iterations) {\n' % (short,))
+  for _, ptype, pname, _ in values:
+    out.write('  static %s in_%s[SIMDE_BENCHMARK_WIDTH];\n' % (ptype.replace('const ', '').strip(), pname))
+  if ret != 'void':
+    out.write('  static %s out[SIMDE_BENCHMARK_WIDTH];\n' % (ret,))
+  out.write('\n')
+
+  out.write('  switch (mode) {\n')
+  out.write('    case SIMDE_BENCHMARK_MODE_INIT:\n')
+  for _, _, pname, kind in values:
+    out.write('      simde_benchmark_fill_(in_%s, sizeof(in_%s), %s);\n' % (pname, pname, kind))
+  if ret != 'void':
+    out.write('      SIMDE_BENCHMARK_ESCAPE(out);\n')
+  out.write('      break;\n')
+
+  out.write('    case SIMDE_BENCHMARK_MODE_THROUGHPUT:\n')
+  out.write('      for (uint64_t i = 0 ; i < iterations ; i++) {\n')
+  out.write('        for (size_t j = 0 ; j < SIMDE_BENCHMARK_WIDTH ; j++) {\n')
+  call = '%s(%s)' % (name, ', '.join(arguments(params, 'j')))
+  if ret == 'void':
+    out.write('          %s;\n' % (call,))
+  else:
+    out.write('          out[j] = %s;\n' % (call,))
+  out.write('        }\n')
+  out.write('        SIMDE_BENCHMARK_CLOBBER();\n')
+  out.write('      }\n')
+  out.write('      break;\n')
+
+  out.write('    case SIMDE_BENCHMARK_MODE_LATENCY:\n')
+  if chain is None:
+    out.write('      return 0;\n')
+  else:
+    args = arguments(params, '0')
+    args[params.index(chain)] = 'chain'
+    out.write('      {\n')
+    out.write('        %s chain = in_%s[0];\n' % (ret, chain[2]))
+    out.write('        for (uint64_t i = 0 ; i < iterations ; i++) {\n')
+    out.write('          chain = %s(%s);\n' % (name, ', '.join(args)))
+    out.write('        }\n')
+    out.write('        out[0] = chain;\n')
+    out.write('        SIMDE_BENCHMARK_CLOBBER();\n')
+    out.write('      }\n')
+    out.write('      break;\n')
+  out.write('  }\n\n')
+  out.write('  return 1;\n')
+  out.write('}\n\n')
+
+def main(argv):
+  if len(argv) not in (4, 5):
+    sys.stderr.write('Usage: %s FAMILY HEADER OUTPUT [TEST]\n' % (argv[0],))
+    return 1
+  family, header, output = argv[1:4]
+  test = argv[4] if len(argv) == 5 else None
+  functions = parse(header)
+  have_tests = test is not None
+
+  with open(output, 'w') as out:
+    out.write('/* Generated by benchmark/generate.py from %s; do not edit. */\n\n' % (os.path.basename(header),))
+    if have_tests:
+      out.write('#include "%s"\n' % (os.path.abspath(test),))
+    else:
+      out.write('#include "%s"\n' % (os.path.abspath(header),))
+    out.write('#include <benchmark/benchmark.h>\n\n')
+
+    for name, ret, params in functions:
+      generate(out, name, ret, params)
+
+    out.write('static const SimdeBenchmark simde_benchmarks[] = {\n')
+    for name, _, _ in functions:
+      short = name[len('simde_'):]
+      out.write('  { "%s", simde_benchmark_%s },\n' % (short, short))
+    out.write('  { NULL, NULL }\n')
+    out.write('};\n\n')
+
+    if have_tests:
+      out.write('SIMDE_BENCHMARK_MAIN("%s", simde_benchmarks, test_suite_tests)\n' % (family,))
+    else:
+      out.write('SIMDE_BENCHMARK_MAIN_UNTESTED("%s", simde_benchmarks)\n' % (family,))
+  return 0
+
+if __name__ == '__main__':
+  sys.exit(main(sys.argv))
@@ -40,6 +40,7 @@
 #include "neon/addv.h"
 #include "neon/addw.h"
 #include "neon/addw_high.h"
+#include "neon/aes.h"
 #include "neon/and.h"
 #include "neon/bic.h"
 #include "neon/bsl.h"
@@ -66,12 +67,19 @@
 #include "neon/dup_n.h"
 #include "neon/eor.h"
 #include "neon/ext.h"
+#include "neon/fma.h"
+#include "neon/fma_lane.h"
+#include "neon/fma_n.h"
+#include "neon/fms.h"
+#include "neon/fms_lane.h"
+#include "neon/fms_n.h"
 #include "neon/get_high.h"
 #include "neon/get_lane.h"
 #include "neon/get_low.h"
 #include "neon/hadd.h"
 #include "neon/hsub.h"
 #include "neon/ld1.h"
+#include "neon/ld2.h"
 #include "neon/ld3.h"
 #include "neon/ld4.h"
 #include "neon/max.h"
@@ -123,6 +131,8 @@
 #include "neon/qtbl.h"
 #include "neon/qtbx.h"
 #include "neon/rbit.h"
+#include "neon/recpe.h"
+#include "neon/recps.h"
 #include "neon/reinterpret.h"
 #include "neon/rev16.h"
 #include "neon/rev32.h"
@@ -131,14 +141,19 @@
 #include "neon/rnd.h"
 #include "neon/rshl.h"
 #include "neon/rshr_n.h"
+#include "neon/rsqrte.h"
+#include "neon/rsqrts.h"
 #include "neon/rsra_n.h"
 #include "neon/set_lane.h"
+#include "neon/sha1.h"
+#include "neon/sha256.h"
 #include "neon/shl.h"
 #include "neon/shl_n.h"
 #include "neon/shr_n.h"
 #include "neon/sra_n.h"
 #include "neon/st1.h"
 #include "neon/st1_lane.h"
+#include "neon/st2.h"
 #include "neon/st3.h"
 #include "neon/st4.h"
 #include "neon/sub.h"
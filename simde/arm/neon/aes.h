@@ -0,0 +1,140 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+/* Without the ARMv8 crypto extension these are implemented with the
+ * functions from simde/x86/aes.h, which use AES-NI when it is
+ * available, a vector permutation implementation when there is a
+ * native byte shuffle, and a bitsliced one otherwise; none of them
+ * index memory with secret data.  AESE/AESD add the round key first while AESENCLAST and
+ * AESDECLAST add it last, so the key is XORed in before calling them
+ * with a zero key. */
+
+#if !defined(SIMDE_ARM_NEON_AES_H)
+#define SIMDE_ARM_NEON_AES_H
+
+#include "types.h"
+#include "../../x86/aes.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_vaes_to_m128i_(simde_uint8x16_t a) {
+  simde__m128i r;
+  simde_memcpy(&r, &a, sizeof(r));
+  return r;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint8x16_t
+simde_x_vaes_from_m128i_(simde__m128i a) {
+  simde_uint8x16_t r;
+  simde_memcpy(&r, &a, sizeof(r));
+  return r;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint8x16_t
+simde_vaeseq_u8(simde_uint8x16_t data, simde_uint8x16_t key) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_AES)
+    return vaeseq_u8(data, key);
+  #else
+    return
+      simde_x_vaes_from_m128i_(
+        simde_mm_aesenclast_si128(
+          simde_mm_xor_si128(simde_x_vaes_to_m128i_(data), simde_x_vaes_to_m128i_(key)),
+          simde_mm_setzero_si128()
+        )
+      );
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_AES))
+  #undef vaeseq_u8
+  #define vaeseq_u8(data, key) simde_vaeseq_u8((data), (key))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint8x16_t
+simde_vaesdq_u8(simde_uint8x16_t data, simde_uint8x16_t key) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_AES)
+    return vaesdq_u8(data, key);
+  #else
+    return
+      simde_x_vaes_from_m128i_(
+        simde_mm_aesdeclast_si128(
+          simde_mm_xor_si128(simde_x_vaes_to_m128i_(data), simde_x_vaes_to_m128i_(key)),
+          simde_mm_setzero_si128()
+        )
+      );
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_AES))
+  #undef vaesdq_u8
+  #define vaesdq_u8(data, key) simde_vaesdq_u8((data), (key))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint8x16_t
+simde_vaesmcq_u8(simde_uint8x16_t data) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_AES)
+    return vaesmcq_u8(data);
+  #elif defined(SIMDE_X86_AES_NATIVE)
+    /* SubBytes and ShiftRows commute, so AESENC undoes everything
+     * AESDECLAST did and only MixColumns is left. */
+    const simde__m128i zero = simde_mm_setzero_si128();
+    return simde_x_vaes_from_m128i_(simde_mm_aesenc_si128(simde_mm_aesdeclast_si128(simde_x_vaes_to_m128i_(data), zero), zero));
+  #else
+    const simde__m128i a = simde_x_vaes_to_m128i_(data);
+    const simde__m128i a2 = simde_x_aes_xtime_(a);
+
+    return simde_x_vaes_from_m128i_(simde_x_aes_mix_columns_(a2, simde_mm_xor_si128(a2, a), a, a));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_AES))
+  #undef vaesmcq_u8
+  #define vaesmcq_u8(data) simde_vaesmcq_u8((data))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint8x16_t
+simde_vaesimcq_u8(simde_uint8x16_t data) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_AES)
+    return vaesimcq_u8(data);
+  #else
+    return simde_x_vaes_from_m128i_(simde_mm_aesimc_si128(simde_x_vaes_to_m128i_(data)));
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_AES))
+  #undef vaesimcq_u8
+  #define vaesimcq_u8(data) simde_vaesimcq_u8((data))
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_ARM_NEON_AES_H) */
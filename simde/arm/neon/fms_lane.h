@@ -0,0 +1,153 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#if !defined(SIMDE_ARM_NEON_FMS_LANE_H)
+#define SIMDE_ARM_NEON_FMS_LANE_H
+
+#include "types.h"
+#include "dup_n.h"
+#include "fms.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x2_t
+simde_vfms_lane_f32(simde_float32x2_t a, simde_float32x2_t b, simde_float32x2_t c, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 1) {
+  return simde_vfms_f32(a, b, simde_vdup_n_f32(simde_float32x2_to_private(c).values[lane]));
+}
+#if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+  #define simde_vfms_lane_f32(a, b, c, lane) vfms_lane_f32((a), (b), (c), (lane))
+#endif
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vfms_lane_f32
+  #define vfms_lane_f32(a, b, c, lane) simde_vfms_lane_f32((a), (b), (c), (lane))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64x1_t
+simde_vfms_lane_f64(simde_float64x1_t a, simde_float64x1_t b, simde_float64x1_t c, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 0) {
+  return simde_vfms_f64(a, b, simde_vdup_n_f64(simde_float64x1_to_private(c).values[lane]));
+}
+#if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+  #define simde_vfms_lane_f64(a, b, c, lane) vfms_lane_f64((a), (b), (c), (lane))
+#endif
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vfms_lane_f64
+  #define vfms_lane_f64(a, b, c, lane) simde_vfms_lane_f64((a), (b), (c), (lane))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x2_t
+simde_vfms_laneq_f32(simde_float32x2_t a, simde_float32x2_t b, simde_float32x4_t c, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 3) {
+  return simde_vfms_f32(a, b, simde_vdup_n_f32(simde_float32x4_to_private(c).values[lane]));
+}
+#if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+  #define simde_vfms_laneq_f32(a, b, c, lane) vfms_laneq_f32((a), (b), (c), (lane))
+#endif
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vfms_laneq_f32
+  #define vfms_laneq_f32(a, b, c, lane) simde_vfms_laneq_f32((a), (b), (c), (lane))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64x1_t
+simde_vfms_laneq_f64(simde_float64x1_t a, simde_float64x1_t b, simde_float64x2_t c, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 1) {
+  return simde_vfms_f64(a, b, simde_vdup_n_f64(simde_float64x2_to_private(c).values[lane]));
+}
+#if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+  #define simde_vfms_laneq_f64(a, b, c, lane) vfms_laneq_f64((a), (b), (c), (lane))
+#endif
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vfms_laneq_f64
+  #define vfms_laneq_f64(a, b, c, lane) simde_vfms_laneq_f64((a), (b), (c), (lane))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x4_t
+simde_vfmsq_lane_f32(simde_float32x4_t a, simde_float32x4_t b, simde_float32x2_t c, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 1) {
+  return simde_vfmsq_f32(a, b, simde_vdupq_n_f32(simde_float32x2_to_private(c).values[lane]));
+}
+#if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+  #define simde_vfmsq_lane_f32(a, b, c, lane) vfmsq_lane_f32((a), (b), (c), (lane))
+#endif
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vfmsq_lane_f32
+  #define vfmsq_lane_f32(a, b, c, lane) simde_vfmsq_lane_f32((a), (b), (c), (lane))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64x2_t
+simde_vfmsq_lane_f64(simde_float64x2_t a, simde_float64x2_t b, simde_float64x1_t c, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 0) {
+  return simde_vfmsq_f64(a, b, simde_vdupq_n_f64(simde_float64x1_to_private(c).values[lane]));
+}
+#if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+  #define simde_vfmsq_lane_f64(a, b, c, lane) vfmsq_lane_f64((a), (b), (c), (lane))
+#endif
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vfmsq_lane_f64
+  #define vfmsq_lane_f64(a, b, c, lane) simde_vfmsq_lane_f64((a), (b), (c), (lane))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x4_t
+simde_vfmsq_laneq_f32(simde_float32x4_t a, simde_float32x4_t b, simde_float32x4_t c, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 3) {
+  return simde_vfmsq_f32(a, b, simde_vdupq_n_f32(simde_float32x4_to_private(c).values[lane]));
+}
+#if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+  #define simde_vfmsq_laneq_f32(a, b, c, lane) vfmsq_laneq_f32((a), (b), (c), (lane))
+#endif
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vfmsq_laneq_f32
+  #define vfmsq_laneq_f32(a, b, c, lane) simde_vfmsq_laneq_f32((a), (b), (c), (lane))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64x2_t
+simde_vfmsq_laneq_f64(simde_float64x2_t a, simde_float64x2_t b, simde_float64x2_t c, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 1) {
+  return simde_vfmsq_f64(a, b, simde_vdupq_n_f64(simde_float64x2_to_private(c).values[lane]));
+}
+#if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+  #define simde_vfmsq_laneq_f64(a, b, c, lane) vfmsq_laneq_f64((a), (b), (c), (lane))
+#endif
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vfmsq_laneq_f64
+  #define vfmsq_laneq_f64(a, b, c, lane) simde_vfmsq_laneq_f64((a), (b), (c), (lane))
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_ARM_NEON_FMS_LANE_H) */
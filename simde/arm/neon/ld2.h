@@ -0,0 +1,1503 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#if !defined(SIMDE_ARM_NEON_LD2_H)
+#define SIMDE_ARM_NEON_LD2_H
+
+#include "types.h"
+#include "dup_n.h"
+#include "ld1.h"
+#include "uzp1.h"
+#include "uzp2.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+#if defined(HEDLEY_GCC_VERSION)
+  SIMDE_DIAGNOSTIC_DISABLE_MAYBE_UNINITIAZILED_
+#endif
+SIMDE_BEGIN_DECLS_
+
+#if !defined(SIMDE_BUG_INTEL_857088)
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x2x2_t
+simde_vld2_f32(simde_float32 const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vld2_f32(ptr);
+  #else
+    const simde_float32x2_t
+      a = simde_vld1_f32(ptr),
+      b = simde_vld1_f32(ptr + 2);
+
+    simde_float32x2x2_t r = { {
+      simde_vuzp1_f32(a, b),
+      simde_vuzp2_f32(a, b)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2_f32
+  #define vld2_f32(a) simde_vld2_f32((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64x1x2_t
+simde_vld2_f64(simde_float64 const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vld2_f64(ptr);
+  #else
+    simde_float64x1x2_t r = { {
+      simde_vld1_f64(ptr),
+      simde_vld1_f64(ptr + 1)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vld2_f64
+  #define vld2_f64(a) simde_vld2_f64((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int8x8x2_t
+simde_vld2_s8(int8_t const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vld2_s8(ptr);
+  #else
+    const simde_int8x8_t
+      a = simde_vld1_s8(ptr),
+      b = simde_vld1_s8(ptr + 8);
+
+    simde_int8x8x2_t r = { {
+      simde_vuzp1_s8(a, b),
+      simde_vuzp2_s8(a, b)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2_s8
+  #define vld2_s8(a) simde_vld2_s8((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int16x4x2_t
+simde_vld2_s16(int16_t const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vld2_s16(ptr);
+  #else
+    const simde_int16x4_t
+      a = simde_vld1_s16(ptr),
+      b = simde_vld1_s16(ptr + 4);
+
+    simde_int16x4x2_t r = { {
+      simde_vuzp1_s16(a, b),
+      simde_vuzp2_s16(a, b)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2_s16
+  #define vld2_s16(a) simde_vld2_s16((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int32x2x2_t
+simde_vld2_s32(int32_t const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vld2_s32(ptr);
+  #else
+    const simde_int32x2_t
+      a = simde_vld1_s32(ptr),
+      b = simde_vld1_s32(ptr + 2);
+
+    simde_int32x2x2_t r = { {
+      simde_vuzp1_s32(a, b),
+      simde_vuzp2_s32(a, b)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2_s32
+  #define vld2_s32(a) simde_vld2_s32((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int64x1x2_t
+simde_vld2_s64(int64_t const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vld2_s64(ptr);
+  #else
+    simde_int64x1x2_t r = { {
+      simde_vld1_s64(ptr),
+      simde_vld1_s64(ptr + 1)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2_s64
+  #define vld2_s64(a) simde_vld2_s64((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint8x8x2_t
+simde_vld2_u8(uint8_t const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vld2_u8(ptr);
+  #else
+    const simde_uint8x8_t
+      a = simde_vld1_u8(ptr),
+      b = simde_vld1_u8(ptr + 8);
+
+    simde_uint8x8x2_t r = { {
+      simde_vuzp1_u8(a, b),
+      simde_vuzp2_u8(a, b)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2_u8
+  #define vld2_u8(a) simde_vld2_u8((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint16x4x2_t
+simde_vld2_u16(uint16_t const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vld2_u16(ptr);
+  #else
+    const simde_uint16x4_t
+      a = simde_vld1_u16(ptr),
+      b = simde_vld1_u16(ptr + 4);
+
+    simde_uint16x4x2_t r = { {
+      simde_vuzp1_u16(a, b),
+      simde_vuzp2_u16(a, b)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2_u16
+  #define vld2_u16(a) simde_vld2_u16((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x2x2_t
+simde_vld2_u32(uint32_t const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vld2_u32(ptr);
+  #else
+    const simde_uint32x2_t
+      a = simde_vld1_u32(ptr),
+      b = simde_vld1_u32(ptr + 2);
+
+    simde_uint32x2x2_t r = { {
+      simde_vuzp1_u32(a, b),
+      simde_vuzp2_u32(a, b)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2_u32
+  #define vld2_u32(a) simde_vld2_u32((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint64x1x2_t
+simde_vld2_u64(uint64_t const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vld2_u64(ptr);
+  #else
+    simde_uint64x1x2_t r = { {
+      simde_vld1_u64(ptr),
+      simde_vld1_u64(ptr + 1)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2_u64
+  #define vld2_u64(a) simde_vld2_u64((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x4x2_t
+simde_vld2q_f32(simde_float32 const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vld2q_f32(ptr);
+  #else
+    const simde_float32x4_t
+      a = simde_vld1q_f32(ptr),
+      b = simde_vld1q_f32(ptr + 4);
+
+    simde_float32x4x2_t r = { {
+      simde_vuzp1q_f32(a, b),
+      simde_vuzp2q_f32(a, b)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2q_f32
+  #define vld2q_f32(a) simde_vld2q_f32((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64x2x2_t
+simde_vld2q_f64(simde_float64 const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vld2q_f64(ptr);
+  #else
+    const simde_float64x2_t
+      a = simde_vld1q_f64(ptr),
+      b = simde_vld1q_f64(ptr + 2);
+
+    simde_float64x2x2_t r = { {
+      simde_vuzp1q_f64(a, b),
+      simde_vuzp2q_f64(a, b)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vld2q_f64
+  #define vld2q_f64(a) simde_vld2q_f64((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int8x16x2_t
+simde_vld2q_s8(int8_t const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vld2q_s8(ptr);
+  #else
+    const simde_int8x16_t
+      a = simde_vld1q_s8(ptr),
+      b = simde_vld1q_s8(ptr + 16);
+
+    #if defined(SIMDE_X86_SSSE3_NATIVE)
+      const __m128i idx = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+      const __m128i as = _mm_shuffle_epi8(a, idx), bs = _mm_shuffle_epi8(b, idx);
+      simde_int8x16x2_t r = { { _mm_unpacklo_epi64(as, bs), _mm_unpackhi_epi64(as, bs) } };
+    #elif defined(SIMDE_X86_SSE2_NATIVE)
+      const __m128i lo = _mm_set1_epi16(0x00ff);
+      simde_int8x16x2_t r = { {
+        _mm_packus_epi16(_mm_and_si128(a, lo), _mm_and_si128(b, lo)),
+        _mm_packus_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8))
+      } };
+    #else
+      simde_int8x16x2_t r = { {
+        simde_vuzp1q_s8(a, b),
+        simde_vuzp2q_s8(a, b)
+      } };
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2q_s8
+  #define vld2q_s8(a) simde_vld2q_s8((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int16x8x2_t
+simde_vld2q_s16(int16_t const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vld2q_s16(ptr);
+  #else
+    const simde_int16x8_t
+      a = simde_vld1q_s16(ptr),
+      b = simde_vld1q_s16(ptr + 8);
+
+    #if defined(SIMDE_X86_SSSE3_NATIVE)
+      const __m128i idx = _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15);
+      const __m128i as = _mm_shuffle_epi8(a, idx), bs = _mm_shuffle_epi8(b, idx);
+      simde_int16x8x2_t r = { { _mm_unpacklo_epi64(as, bs), _mm_unpackhi_epi64(as, bs) } };
+    #elif defined(SIMDE_X86_SSE2_NATIVE)
+      /* Sign-extend each half so packs never saturates. */
+      simde_int16x8x2_t r = { {
+        _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16), _mm_srai_epi32(_mm_slli_epi32(b, 16), 16)),
+        _mm_packs_epi32(_mm_srai_epi32(a, 16), _mm_srai_epi32(b, 16))
+      } };
+    #else
+      simde_int16x8x2_t r = { {
+        simde_vuzp1q_s16(a, b),
+        simde_vuzp2q_s16(a, b)
+      } };
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2q_s16
+  #define vld2q_s16(a) simde_vld2q_s16((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int32x4x2_t
+simde_vld2q_s32(int32_t const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vld2q_s32(ptr);
+  #else
+    const simde_int32x4_t
+      a = simde_vld1q_s32(ptr),
+      b = simde_vld1q_s32(ptr + 4);
+
+    simde_int32x4x2_t r = { {
+      simde_vuzp1q_s32(a, b),
+      simde_vuzp2q_s32(a, b)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2q_s32
+  #define vld2q_s32(a) simde_vld2q_s32((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int64x2x2_t
+simde_vld2q_s64(int64_t const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vld2q_s64(ptr);
+  #else
+    const simde_int64x2_t
+      a = simde_vld1q_s64(ptr),
+      b = simde_vld1q_s64(ptr + 2);
+
+    simde_int64x2x2_t r = { {
+      simde_vuzp1q_s64(a, b),
+      simde_vuzp2q_s64(a, b)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vld2q_s64
+  #define vld2q_s64(a) simde_vld2q_s64((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint8x16x2_t
+simde_vld2q_u8(uint8_t const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vld2q_u8(ptr);
+  #else
+    const simde_uint8x16_t
+      a = simde_vld1q_u8(ptr),
+      b = simde_vld1q_u8(ptr + 16);
+
+    #if defined(SIMDE_X86_SSSE3_NATIVE)
+      const __m128i idx = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+      const __m128i as = _mm_shuffle_epi8(a, idx), bs = _mm_shuffle_epi8(b, idx);
+      simde_uint8x16x2_t r = { { _mm_unpacklo_epi64(as, bs), _mm_unpackhi_epi64(as, bs) } };
+    #elif defined(SIMDE_X86_SSE2_NATIVE)
+      const __m128i lo = _mm_set1_epi16(0x00ff);
+      simde_uint8x16x2_t r = { {
+        _mm_packus_epi16(_mm_and_si128(a, lo), _mm_and_si128(b, lo)),
+        _mm_packus_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8))
+      } };
+    #else
+      simde_uint8x16x2_t r = { {
+        simde_vuzp1q_u8(a, b),
+        simde_vuzp2q_u8(a, b)
+      } };
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2q_u8
+  #define vld2q_u8(a) simde_vld2q_u8((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint16x8x2_t
+simde_vld2q_u16(uint16_t const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vld2q_u16(ptr);
+  #else
+    const simde_uint16x8_t
+      a = simde_vld1q_u16(ptr),
+      b = simde_vld1q_u16(ptr + 8);
+
+    #if defined(SIMDE_X86_SSSE3_NATIVE)
+      const __m128i idx = _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15);
+      const __m128i as = _mm_shuffle_epi8(a, idx), bs = _mm_shuffle_epi8(b, idx);
+      simde_uint16x8x2_t r = { { _mm_unpacklo_epi64(as, bs), _mm_unpackhi_epi64(as, bs) } };
+    #elif defined(SIMDE_X86_SSE2_NATIVE)
+      /* Sign-extend each half so packs never saturates. */
+      simde_uint16x8x2_t r = { {
+        _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16), _mm_srai_epi32(_mm_slli_epi32(b, 16), 16)),
+        _mm_packs_epi32(_mm_srai_epi32(a, 16), _mm_srai_epi32(b, 16))
+      } };
+    #else
+      simde_uint16x8x2_t r = { {
+        simde_vuzp1q_u16(a, b),
+        simde_vuzp2q_u16(a, b)
+      } };
+    #endif
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2q_u16
+  #define vld2q_u16(a) simde_vld2q_u16((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4x2_t
+simde_vld2q_u32(uint32_t const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vld2q_u32(ptr);
+  #else
+    const simde_uint32x4_t
+      a = simde_vld1q_u32(ptr),
+      b = simde_vld1q_u32(ptr + 4);
+
+    simde_uint32x4x2_t r = { {
+      simde_vuzp1q_u32(a, b),
+      simde_vuzp2q_u32(a, b)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2q_u32
+  #define vld2q_u32(a) simde_vld2q_u32((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint64x2x2_t
+simde_vld2q_u64(uint64_t const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vld2q_u64(ptr);
+  #else
+    const simde_uint64x2_t
+      a = simde_vld1q_u64(ptr),
+      b = simde_vld1q_u64(ptr + 2);
+
+    simde_uint64x2x2_t r = { {
+      simde_vuzp1q_u64(a, b),
+      simde_vuzp2q_u64(a, b)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vld2q_u64
+  #define vld2q_u64(a) simde_vld2q_u64((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x2x2_t
+simde_vld2_dup_f32(simde_float32 const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vld2_dup_f32(ptr);
+  #else
+    simde_float32x2x2_t r = { {
+      simde_vdup_n_f32(ptr[0]),
+      simde_vdup_n_f32(ptr[1])
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2_dup_f32
+  #define vld2_dup_f32(a) simde_vld2_dup_f32((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64x1x2_t
+simde_vld2_dup_f64(simde_float64 const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vld2_dup_f64(ptr);
+  #else
+    simde_float64x1x2_t r = { {
+      simde_vdup_n_f64(ptr[0]),
+      simde_vdup_n_f64(ptr[1])
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vld2_dup_f64
+  #define vld2_dup_f64(a) simde_vld2_dup_f64((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int8x8x2_t
+simde_vld2_dup_s8(int8_t const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vld2_dup_s8(ptr);
+  #else
+    simde_int8x8x2_t r = { {
+      simde_vdup_n_s8(ptr[0]),
+      simde_vdup_n_s8(ptr[1])
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2_dup_s8
+  #define vld2_dup_s8(a) simde_vld2_dup_s8((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int16x4x2_t
+simde_vld2_dup_s16(int16_t const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vld2_dup_s16(ptr);
+  #else
+    simde_int16x4x2_t r = { {
+      simde_vdup_n_s16(ptr[0]),
+      simde_vdup_n_s16(ptr[1])
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2_dup_s16
+  #define vld2_dup_s16(a) simde_vld2_dup_s16((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int32x2x2_t
+simde_vld2_dup_s32(int32_t const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vld2_dup_s32(ptr);
+  #else
+    simde_int32x2x2_t r = { {
+      simde_vdup_n_s32(ptr[0]),
+      simde_vdup_n_s32(ptr[1])
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2_dup_s32
+  #define vld2_dup_s32(a) simde_vld2_dup_s32((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int64x1x2_t
+simde_vld2_dup_s64(int64_t const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vld2_dup_s64(ptr);
+  #else
+    simde_int64x1x2_t r = { {
+      simde_vdup_n_s64(ptr[0]),
+      simde_vdup_n_s64(ptr[1])
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2_dup_s64
+  #define vld2_dup_s64(a) simde_vld2_dup_s64((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint8x8x2_t
+simde_vld2_dup_u8(uint8_t const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vld2_dup_u8(ptr);
+  #else
+    simde_uint8x8x2_t r = { {
+      simde_vdup_n_u8(ptr[0]),
+      simde_vdup_n_u8(ptr[1])
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2_dup_u8
+  #define vld2_dup_u8(a) simde_vld2_dup_u8((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint16x4x2_t
+simde_vld2_dup_u16(uint16_t const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vld2_dup_u16(ptr);
+  #else
+    simde_uint16x4x2_t r = { {
+      simde_vdup_n_u16(ptr[0]),
+      simde_vdup_n_u16(ptr[1])
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2_dup_u16
+  #define vld2_dup_u16(a) simde_vld2_dup_u16((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x2x2_t
+simde_vld2_dup_u32(uint32_t const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vld2_dup_u32(ptr);
+  #else
+    simde_uint32x2x2_t r = { {
+      simde_vdup_n_u32(ptr[0]),
+      simde_vdup_n_u32(ptr[1])
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2_dup_u32
+  #define vld2_dup_u32(a) simde_vld2_dup_u32((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint64x1x2_t
+simde_vld2_dup_u64(uint64_t const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vld2_dup_u64(ptr);
+  #else
+    simde_uint64x1x2_t r = { {
+      simde_vdup_n_u64(ptr[0]),
+      simde_vdup_n_u64(ptr[1])
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2_dup_u64
+  #define vld2_dup_u64(a) simde_vld2_dup_u64((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x4x2_t
+simde_vld2q_dup_f32(simde_float32 const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vld2q_dup_f32(ptr);
+  #else
+    simde_float32x4x2_t r = { {
+      simde_vdupq_n_f32(ptr[0]),
+      simde_vdupq_n_f32(ptr[1])
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vld2q_dup_f32
+  #define vld2q_dup_f32(a) simde_vld2q_dup_f32((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64x2x2_t
+simde_vld2q_dup_f64(simde_float64 const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vld2q_dup_f64(ptr);
+  #else
+    simde_float64x2x2_t r = { {
+      simde_vdupq_n_f64(ptr[0]),
+      simde_vdupq_n_f64(ptr[1])
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vld2q_dup_f64
+  #define vld2q_dup_f64(a) simde_vld2q_dup_f64((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int8x16x2_t
+simde_vld2q_dup_s8(int8_t const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vld2q_dup_s8(ptr);
+  #else
+    simde_int8x16x2_t r = { {
+      simde_vdupq_n_s8(ptr[0]),
+      simde_vdupq_n_s8(ptr[1])
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vld2q_dup_s8
+  #define vld2q_dup_s8(a) simde_vld2q_dup_s8((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int16x8x2_t
+simde_vld2q_dup_s16(int16_t const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vld2q_dup_s16(ptr);
+  #else
+    simde_int16x8x2_t r = { {
+      simde_vdupq_n_s16(ptr[0]),
+      simde_vdupq_n_s16(ptr[1])
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vld2q_dup_s16
+  #define vld2q_dup_s16(a) simde_vld2q_dup_s16((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int32x4x2_t
+simde_vld2q_dup_s32(int32_t const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vld2q_dup_s32(ptr);
+  #else
+    simde_int32x4x2_t r = { {
+      simde_vdupq_n_s32(ptr[0]),
+      simde_vdupq_n_s32(ptr[1])
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vld2q_dup_s32
+  #define vld2q_dup_s32(a) simde_vld2q_dup_s32((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int64x2x2_t
+simde_vld2q_dup_s64(int64_t const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vld2q_dup_s64(ptr);
+  #else
+    simde_int64x2x2_t r = { {
+      simde_vdupq_n_s64(ptr[0]),
+      simde_vdupq_n_s64(ptr[1])
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vld2q_dup_s64
+  #define vld2q_dup_s64(a) simde_vld2q_dup_s64((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint8x16x2_t
+simde_vld2q_dup_u8(uint8_t const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vld2q_dup_u8(ptr);
+  #else
+    simde_uint8x16x2_t r = { {
+      simde_vdupq_n_u8(ptr[0]),
+      simde_vdupq_n_u8(ptr[1])
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vld2q_dup_u8
+  #define vld2q_dup_u8(a) simde_vld2q_dup_u8((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint16x8x2_t
+simde_vld2q_dup_u16(uint16_t const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vld2q_dup_u16(ptr);
+  #else
+    simde_uint16x8x2_t r = { {
+      simde_vdupq_n_u16(ptr[0]),
+      simde_vdupq_n_u16(ptr[1])
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vld2q_dup_u16
+  #define vld2q_dup_u16(a) simde_vld2q_dup_u16((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4x2_t
+simde_vld2q_dup_u32(uint32_t const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vld2q_dup_u32(ptr);
+  #else
+    simde_uint32x4x2_t r = { {
+      simde_vdupq_n_u32(ptr[0]),
+      simde_vdupq_n_u32(ptr[1])
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vld2q_dup_u32
+  #define vld2q_dup_u32(a) simde_vld2q_dup_u32((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint64x2x2_t
+simde_vld2q_dup_u64(uint64_t const *ptr) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vld2q_dup_u64(ptr);
+  #else
+    simde_uint64x2x2_t r = { {
+      simde_vdupq_n_u64(ptr[0]),
+      simde_vdupq_n_u64(ptr[1])
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vld2q_dup_u64
+  #define vld2q_dup_u64(a) simde_vld2q_dup_u64((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x2x2_t
+simde_vld2_lane_f32(simde_float32 const *ptr, simde_float32x2x2_t src, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 1) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    simde_float32x2x2_t r;
+    SIMDE_CONSTIFY_2_(vld2_lane_f32, r, (HEDLEY_UNREACHABLE(), r), lane, ptr, src);
+    return r;
+  #else
+    simde_float32x2_private
+      r0_ = simde_float32x2_to_private(src.val[0]),
+      r1_ = simde_float32x2_to_private(src.val[1]);
+
+    r0_.values[lane] = ptr[0];
+    r1_.values[lane] = ptr[1];
+
+    simde_float32x2x2_t r = { {
+      simde_float32x2_from_private(r0_),
+      simde_float32x2_from_private(r1_)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2_lane_f32
+  #define vld2_lane_f32(a, b, c) simde_vld2_lane_f32((a), (b), (c))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64x1x2_t
+simde_vld2_lane_f64(simde_float64 const *ptr, simde_float64x1x2_t src, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 0) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    (void) lane;
+    return vld2_lane_f64(ptr, src, 0);
+  #else
+    simde_float64x1_private
+      r0_ = simde_float64x1_to_private(src.val[0]),
+      r1_ = simde_float64x1_to_private(src.val[1]);
+
+    r0_.values[lane] = ptr[0];
+    r1_.values[lane] = ptr[1];
+
+    simde_float64x1x2_t r = { {
+      simde_float64x1_from_private(r0_),
+      simde_float64x1_from_private(r1_)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vld2_lane_f64
+  #define vld2_lane_f64(a, b, c) simde_vld2_lane_f64((a), (b), (c))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int8x8x2_t
+simde_vld2_lane_s8(int8_t const *ptr, simde_int8x8x2_t src, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 7) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    simde_int8x8x2_t r;
+    SIMDE_CONSTIFY_8_(vld2_lane_s8, r, (HEDLEY_UNREACHABLE(), r), lane, ptr, src);
+    return r;
+  #else
+    simde_int8x8_private
+      r0_ = simde_int8x8_to_private(src.val[0]),
+      r1_ = simde_int8x8_to_private(src.val[1]);
+
+    r0_.values[lane] = ptr[0];
+    r1_.values[lane] = ptr[1];
+
+    simde_int8x8x2_t r = { {
+      simde_int8x8_from_private(r0_),
+      simde_int8x8_from_private(r1_)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2_lane_s8
+  #define vld2_lane_s8(a, b, c) simde_vld2_lane_s8((a), (b), (c))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int16x4x2_t
+simde_vld2_lane_s16(int16_t const *ptr, simde_int16x4x2_t src, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 3) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    simde_int16x4x2_t r;
+    SIMDE_CONSTIFY_4_(vld2_lane_s16, r, (HEDLEY_UNREACHABLE(), r), lane, ptr, src);
+    return r;
+  #else
+    simde_int16x4_private
+      r0_ = simde_int16x4_to_private(src.val[0]),
+      r1_ = simde_int16x4_to_private(src.val[1]);
+
+    r0_.values[lane] = ptr[0];
+    r1_.values[lane] = ptr[1];
+
+    simde_int16x4x2_t r = { {
+      simde_int16x4_from_private(r0_),
+      simde_int16x4_from_private(r1_)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2_lane_s16
+  #define vld2_lane_s16(a, b, c) simde_vld2_lane_s16((a), (b), (c))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int32x2x2_t
+simde_vld2_lane_s32(int32_t const *ptr, simde_int32x2x2_t src, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 1) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    simde_int32x2x2_t r;
+    SIMDE_CONSTIFY_2_(vld2_lane_s32, r, (HEDLEY_UNREACHABLE(), r), lane, ptr, src);
+    return r;
+  #else
+    simde_int32x2_private
+      r0_ = simde_int32x2_to_private(src.val[0]),
+      r1_ = simde_int32x2_to_private(src.val[1]);
+
+    r0_.values[lane] = ptr[0];
+    r1_.values[lane] = ptr[1];
+
+    simde_int32x2x2_t r = { {
+      simde_int32x2_from_private(r0_),
+      simde_int32x2_from_private(r1_)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2_lane_s32
+  #define vld2_lane_s32(a, b, c) simde_vld2_lane_s32((a), (b), (c))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int64x1x2_t
+simde_vld2_lane_s64(int64_t const *ptr, simde_int64x1x2_t src, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 0) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    (void) lane;
+    return vld2_lane_s64(ptr, src, 0);
+  #else
+    simde_int64x1_private
+      r0_ = simde_int64x1_to_private(src.val[0]),
+      r1_ = simde_int64x1_to_private(src.val[1]);
+
+    r0_.values[lane] = ptr[0];
+    r1_.values[lane] = ptr[1];
+
+    simde_int64x1x2_t r = { {
+      simde_int64x1_from_private(r0_),
+      simde_int64x1_from_private(r1_)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vld2_lane_s64
+  #define vld2_lane_s64(a, b, c) simde_vld2_lane_s64((a), (b), (c))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint8x8x2_t
+simde_vld2_lane_u8(uint8_t const *ptr, simde_uint8x8x2_t src, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 7) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    simde_uint8x8x2_t r;
+    SIMDE_CONSTIFY_8_(vld2_lane_u8, r, (HEDLEY_UNREACHABLE(), r), lane, ptr, src);
+    return r;
+  #else
+    simde_uint8x8_private
+      r0_ = simde_uint8x8_to_private(src.val[0]),
+      r1_ = simde_uint8x8_to_private(src.val[1]);
+
+    r0_.values[lane] = ptr[0];
+    r1_.values[lane] = ptr[1];
+
+    simde_uint8x8x2_t r = { {
+      simde_uint8x8_from_private(r0_),
+      simde_uint8x8_from_private(r1_)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2_lane_u8
+  #define vld2_lane_u8(a, b, c) simde_vld2_lane_u8((a), (b), (c))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint16x4x2_t
+simde_vld2_lane_u16(uint16_t const *ptr, simde_uint16x4x2_t src, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 3) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    simde_uint16x4x2_t r;
+    SIMDE_CONSTIFY_4_(vld2_lane_u16, r, (HEDLEY_UNREACHABLE(), r), lane, ptr, src);
+    return r;
+  #else
+    simde_uint16x4_private
+      r0_ = simde_uint16x4_to_private(src.val[0]),
+      r1_ = simde_uint16x4_to_private(src.val[1]);
+
+    r0_.values[lane] = ptr[0];
+    r1_.values[lane] = ptr[1];
+
+    simde_uint16x4x2_t r = { {
+      simde_uint16x4_from_private(r0_),
+      simde_uint16x4_from_private(r1_)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2_lane_u16
+  #define vld2_lane_u16(a, b, c) simde_vld2_lane_u16((a), (b), (c))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x2x2_t
+simde_vld2_lane_u32(uint32_t const *ptr, simde_uint32x2x2_t src, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 1) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    simde_uint32x2x2_t r;
+    SIMDE_CONSTIFY_2_(vld2_lane_u32, r, (HEDLEY_UNREACHABLE(), r), lane, ptr, src);
+    return r;
+  #else
+    simde_uint32x2_private
+      r0_ = simde_uint32x2_to_private(src.val[0]),
+      r1_ = simde_uint32x2_to_private(src.val[1]);
+
+    r0_.values[lane] = ptr[0];
+    r1_.values[lane] = ptr[1];
+
+    simde_uint32x2x2_t r = { {
+      simde_uint32x2_from_private(r0_),
+      simde_uint32x2_from_private(r1_)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2_lane_u32
+  #define vld2_lane_u32(a, b, c) simde_vld2_lane_u32((a), (b), (c))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint64x1x2_t
+simde_vld2_lane_u64(uint64_t const *ptr, simde_uint64x1x2_t src, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 0) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    (void) lane;
+    return vld2_lane_u64(ptr, src, 0);
+  #else
+    simde_uint64x1_private
+      r0_ = simde_uint64x1_to_private(src.val[0]),
+      r1_ = simde_uint64x1_to_private(src.val[1]);
+
+    r0_.values[lane] = ptr[0];
+    r1_.values[lane] = ptr[1];
+
+    simde_uint64x1x2_t r = { {
+      simde_uint64x1_from_private(r0_),
+      simde_uint64x1_from_private(r1_)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vld2_lane_u64
+  #define vld2_lane_u64(a, b, c) simde_vld2_lane_u64((a), (b), (c))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x4x2_t
+simde_vld2q_lane_f32(simde_float32 const *ptr, simde_float32x4x2_t src, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 3) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    simde_float32x4x2_t r;
+    SIMDE_CONSTIFY_4_(vld2q_lane_f32, r, (HEDLEY_UNREACHABLE(), r), lane, ptr, src);
+    return r;
+  #else
+    simde_float32x4_private
+      r0_ = simde_float32x4_to_private(src.val[0]),
+      r1_ = simde_float32x4_to_private(src.val[1]);
+
+    r0_.values[lane] = ptr[0];
+    r1_.values[lane] = ptr[1];
+
+    simde_float32x4x2_t r = { {
+      simde_float32x4_from_private(r0_),
+      simde_float32x4_from_private(r1_)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2q_lane_f32
+  #define vld2q_lane_f32(a, b, c) simde_vld2q_lane_f32((a), (b), (c))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64x2x2_t
+simde_vld2q_lane_f64(simde_float64 const *ptr, simde_float64x2x2_t src, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 1) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde_float64x2x2_t r;
+    SIMDE_CONSTIFY_2_(vld2q_lane_f64, r, (HEDLEY_UNREACHABLE(), r), lane, ptr, src);
+    return r;
+  #else
+    simde_float64x2_private
+      r0_ = simde_float64x2_to_private(src.val[0]),
+      r1_ = simde_float64x2_to_private(src.val[1]);
+
+    r0_.values[lane] = ptr[0];
+    r1_.values[lane] = ptr[1];
+
+    simde_float64x2x2_t r = { {
+      simde_float64x2_from_private(r0_),
+      simde_float64x2_from_private(r1_)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vld2q_lane_f64
+  #define vld2q_lane_f64(a, b, c) simde_vld2q_lane_f64((a), (b), (c))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int8x16x2_t
+simde_vld2q_lane_s8(int8_t const *ptr, simde_int8x16x2_t src, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 15) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde_int8x16x2_t r;
+    SIMDE_CONSTIFY_16_(vld2q_lane_s8, r, (HEDLEY_UNREACHABLE(), r), lane, ptr, src);
+    return r;
+  #else
+    simde_int8x16_private
+      r0_ = simde_int8x16_to_private(src.val[0]),
+      r1_ = simde_int8x16_to_private(src.val[1]);
+
+    r0_.values[lane] = ptr[0];
+    r1_.values[lane] = ptr[1];
+
+    simde_int8x16x2_t r = { {
+      simde_int8x16_from_private(r0_),
+      simde_int8x16_from_private(r1_)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vld2q_lane_s8
+  #define vld2q_lane_s8(a, b, c) simde_vld2q_lane_s8((a), (b), (c))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int16x8x2_t
+simde_vld2q_lane_s16(int16_t const *ptr, simde_int16x8x2_t src, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 7) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    simde_int16x8x2_t r;
+    SIMDE_CONSTIFY_8_(vld2q_lane_s16, r, (HEDLEY_UNREACHABLE(), r), lane, ptr, src);
+    return r;
+  #else
+    simde_int16x8_private
+      r0_ = simde_int16x8_to_private(src.val[0]),
+      r1_ = simde_int16x8_to_private(src.val[1]);
+
+    r0_.values[lane] = ptr[0];
+    r1_.values[lane] = ptr[1];
+
+    simde_int16x8x2_t r = { {
+      simde_int16x8_from_private(r0_),
+      simde_int16x8_from_private(r1_)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2q_lane_s16
+  #define vld2q_lane_s16(a, b, c) simde_vld2q_lane_s16((a), (b), (c))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int32x4x2_t
+simde_vld2q_lane_s32(int32_t const *ptr, simde_int32x4x2_t src, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 3) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    simde_int32x4x2_t r;
+    SIMDE_CONSTIFY_4_(vld2q_lane_s32, r, (HEDLEY_UNREACHABLE(), r), lane, ptr, src);
+    return r;
+  #else
+    simde_int32x4_private
+      r0_ = simde_int32x4_to_private(src.val[0]),
+      r1_ = simde_int32x4_to_private(src.val[1]);
+
+    r0_.values[lane] = ptr[0];
+    r1_.values[lane] = ptr[1];
+
+    simde_int32x4x2_t r = { {
+      simde_int32x4_from_private(r0_),
+      simde_int32x4_from_private(r1_)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2q_lane_s32
+  #define vld2q_lane_s32(a, b, c) simde_vld2q_lane_s32((a), (b), (c))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_int64x2x2_t
+simde_vld2q_lane_s64(int64_t const *ptr, simde_int64x2x2_t src, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 1) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde_int64x2x2_t r;
+    SIMDE_CONSTIFY_2_(vld2q_lane_s64, r, (HEDLEY_UNREACHABLE(), r), lane, ptr, src);
+    return r;
+  #else
+    simde_int64x2_private
+      r0_ = simde_int64x2_to_private(src.val[0]),
+      r1_ = simde_int64x2_to_private(src.val[1]);
+
+    r0_.values[lane] = ptr[0];
+    r1_.values[lane] = ptr[1];
+
+    simde_int64x2x2_t r = { {
+      simde_int64x2_from_private(r0_),
+      simde_int64x2_from_private(r1_)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vld2q_lane_s64
+  #define vld2q_lane_s64(a, b, c) simde_vld2q_lane_s64((a), (b), (c))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint8x16x2_t
+simde_vld2q_lane_u8(uint8_t const *ptr, simde_uint8x16x2_t src, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 15) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde_uint8x16x2_t r;
+    SIMDE_CONSTIFY_16_(vld2q_lane_u8, r, (HEDLEY_UNREACHABLE(), r), lane, ptr, src);
+    return r;
+  #else
+    simde_uint8x16_private
+      r0_ = simde_uint8x16_to_private(src.val[0]),
+      r1_ = simde_uint8x16_to_private(src.val[1]);
+
+    r0_.values[lane] = ptr[0];
+    r1_.values[lane] = ptr[1];
+
+    simde_uint8x16x2_t r = { {
+      simde_uint8x16_from_private(r0_),
+      simde_uint8x16_from_private(r1_)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vld2q_lane_u8
+  #define vld2q_lane_u8(a, b, c) simde_vld2q_lane_u8((a), (b), (c))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint16x8x2_t
+simde_vld2q_lane_u16(uint16_t const *ptr, simde_uint16x8x2_t src, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 7) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    simde_uint16x8x2_t r;
+    SIMDE_CONSTIFY_8_(vld2q_lane_u16, r, (HEDLEY_UNREACHABLE(), r), lane, ptr, src);
+    return r;
+  #else
+    simde_uint16x8_private
+      r0_ = simde_uint16x8_to_private(src.val[0]),
+      r1_ = simde_uint16x8_to_private(src.val[1]);
+
+    r0_.values[lane] = ptr[0];
+    r1_.values[lane] = ptr[1];
+
+    simde_uint16x8x2_t r = { {
+      simde_uint16x8_from_private(r0_),
+      simde_uint16x8_from_private(r1_)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2q_lane_u16
+  #define vld2q_lane_u16(a, b, c) simde_vld2q_lane_u16((a), (b), (c))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4x2_t
+simde_vld2q_lane_u32(uint32_t const *ptr, simde_uint32x4x2_t src, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 3) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    simde_uint32x4x2_t r;
+    SIMDE_CONSTIFY_4_(vld2q_lane_u32, r, (HEDLEY_UNREACHABLE(), r), lane, ptr, src);
+    return r;
+  #else
+    simde_uint32x4_private
+      r0_ = simde_uint32x4_to_private(src.val[0]),
+      r1_ = simde_uint32x4_to_private(src.val[1]);
+
+    r0_.values[lane] = ptr[0];
+    r1_.values[lane] = ptr[1];
+
+    simde_uint32x4x2_t r = { {
+      simde_uint32x4_from_private(r0_),
+      simde_uint32x4_from_private(r1_)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vld2q_lane_u32
+  #define vld2q_lane_u32(a, b, c) simde_vld2q_lane_u32((a), (b), (c))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint64x2x2_t
+simde_vld2q_lane_u64(uint64_t const *ptr, simde_uint64x2x2_t src, const int lane)
+    SIMDE_REQUIRE_CONSTANT_RANGE(lane, 0, 1) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    simde_uint64x2x2_t r;
+    SIMDE_CONSTIFY_2_(vld2q_lane_u64, r, (HEDLEY_UNREACHABLE(), r), lane, ptr, src);
+    return r;
+  #else
+    simde_uint64x2_private
+      r0_ = simde_uint64x2_to_private(src.val[0]),
+      r1_ = simde_uint64x2_to_private(src.val[1]);
+
+    r0_.values[lane] = ptr[0];
+    r1_.values[lane] = ptr[1];
+
+    simde_uint64x2x2_t r = { {
+      simde_uint64x2_from_private(r0_),
+      simde_uint64x2_from_private(r1_)
+    } };
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vld2q_lane_u64
+  #define vld2q_lane_u64(a, b, c) simde_vld2q_lane_u64((a), (b), (c))
+#endif
+
+#endif /* !defined(SIMDE_BUG_INTEL_857088) */
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_ARM_NEON_LD2_H) */
@@ -325,14 +325,54 @@ simde_float32x4x3_t
 simde_vld3q_f32(simde_float32 const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3q_f32(ptr);
+  #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+    v128_t
+      a0 = wasm_v128_load(ptr),
+      a1 = wasm_v128_load(ptr + 4),
+      a2 = wasm_v128_load(ptr + 8);
+    simde_float32x4x3_t r = { {
+      wasm_v32x4_shuffle(wasm_v32x4_shuffle(a0, a1, 0, 3, 6, 0), a2, 0, 1, 2, 5),
+      wasm_v32x4_shuffle(wasm_v32x4_shuffle(a0, a1, 1, 4, 7, 0), a2, 0, 1, 2, 6),
+      wasm_v32x4_shuffle(wasm_v32x4_shuffle(a0, a1, 2, 5, 0, 0), a2, 0, 1, 4, 7)
+    } };
+    return r;
+  #elif defined(SIMDE_X86_SSE_NATIVE)
+    const __m128
+      a0 = _mm_loadu_ps(ptr),
+      a1 = _mm_loadu_ps(ptr + 4),
+      a2 = _mm_loadu_ps(ptr + 8),
+      t0 = _mm_shuffle_ps(a1, a2, _MM_SHUFFLE(1, 1, 2, 2)),
+      t1 = _mm_shuffle_ps(a0, a1, _MM_SHUFFLE(0, 0, 1, 1)),
+      t2 = _mm_shuffle_ps(a1, a2, _MM_SHUFFLE(2, 2, 3, 3)),
+      t3 = _mm_shuffle_ps(a0, a1, _MM_SHUFFLE(1, 1, 2, 2));
+    simde_float32x4x3_t r = { {
+      _mm_shuffle_ps(a0, t0, _MM_SHUFFLE(2, 0, 3, 0)),
+      _mm_shuffle_ps(t1, t2, _MM_SHUFFLE(2, 0, 2, 0)),
+      _mm_shuffle_ps(t3, a2, _MM_SHUFFLE(3, 0, 2, 0))
+    } };
+    return r;
   #else
     simde_float32x4_private r_[3];
 
-    for (size_t i = 0; i < (sizeof(r_) / sizeof(r_[0])); i++) {
-      for (size_t j = 0 ; j < (sizeof(r_[0].values) / sizeof(r_[0].values[0])) ; j++) {
-        r_[i].values[j] = ptr[i + (j * (sizeof(r_) / sizeof(r_[0])))];
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_float32x4_private
+        a0_ = simde_float32x4_to_private(simde_vld1q_f32(ptr)),
+        a1_ = simde_float32x4_to_private(simde_vld1q_f32(ptr + 4)),
+        a2_ = simde_float32x4_to_private(simde_vld1q_f32(ptr + 8));
+
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(32, 16, a0_.values, a1_.values, 0, 3, 6, 0);
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(32, 16, r_[0].values, a2_.values, 0, 1, 2, 5);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(32, 16, a0_.values, a1_.values, 1, 4, 7, 0);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(32, 16, r_[1].values, a2_.values, 0, 1, 2, 6);
+      r_[2].values = SIMDE_SHUFFLE_VECTOR_(32, 16, a0_.values, a1_.values, 2, 5, 0, 0);
+      r_[2].values = SIMDE_SHUFFLE_VECTOR_(32, 16, r_[2].values, a2_.values, 0, 1, 4, 7);
+    #else
+      for (size_t i = 0; i < (sizeof(r_) / sizeof(r_[0])); i++) {
+        for (size_t j = 0 ; j < (sizeof(r_[0].values) / sizeof(r_[0].values[0])) ; j++) {
+          r_[i].values[j] = ptr[i + (j * (sizeof(r_) / sizeof(r_[0])))];
+        }
       }
-    }
+    #endif
 
     simde_float32x4x3_t r = { {
       simde_float32x4_from_private(r_[0]),
@@ -353,14 +393,47 @@ simde_float64x2x3_t
 simde_vld3q_f64(simde_float64 const *ptr) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vld3q_f64(ptr);
+  #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+    v128_t
+      a0 = wasm_v128_load(ptr),
+      a1 = wasm_v128_load(ptr + 2),
+      a2 = wasm_v128_load(ptr + 4);
+    simde_float64x2x3_t r = { {
+      wasm_v64x2_shuffle(a0, a1, 0, 3),
+      wasm_v64x2_shuffle(a0, a2, 1, 2),
+      wasm_v64x2_shuffle(a1, a2, 0, 3)
+    } };
+    return r;
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    const __m128d
+      a0 = _mm_loadu_pd(ptr),
+      a1 = _mm_loadu_pd(ptr + 2),
+      a2 = _mm_loadu_pd(ptr + 4);
+    simde_float64x2x3_t r = { {
+      _mm_shuffle_pd(a0, a1, 2),
+      _mm_shuffle_pd(a0, a2, 1),
+      _mm_shuffle_pd(a1, a2, 2)
+    } };
+    return r;
   #else
     simde_float64x2_private r_[3];
 
-    for (size_t i = 0; i < (sizeof(r_) / sizeof(r_[0])); i++) {
-      for (size_t j = 0 ; j < (sizeof(r_[0].values) / sizeof(r_[0].values[0])) ; j++) {
-        r_[i].values[j] = ptr[i + (j * (sizeof(r_) / sizeof(r_[0])))];
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_float64x2_private
+        a0_ = simde_float64x2_to_private(simde_vld1q_f64(ptr)),
+        a1_ = simde_float64x2_to_private(simde_vld1q_f64(ptr + 2)),
+        a2_ = simde_float64x2_to_private(simde_vld1q_f64(ptr + 4));
+
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(64, 16, a0_.values, a1_.values, 0, 3);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(64, 16, a0_.values, a2_.values, 1, 2);
+      r_[2].values = SIMDE_SHUFFLE_VECTOR_(64, 16, a1_.values, a2_.values, 0, 3);
+    #else
+      for (size_t i = 0; i < (sizeof(r_) / sizeof(r_[0])); i++) {
+        for (size_t j = 0 ; j < (sizeof(r_[0].values) / sizeof(r_[0].values[0])) ; j++) {
+          r_[i].values[j] = ptr[i + (j * (sizeof(r_) / sizeof(r_[0])))];
+        }
       }
-    }
+    #endif
 
     simde_float64x2x3_t r = { {
       simde_float64x2_from_private(r_[0]),
@@ -381,14 +454,64 @@ simde_int8x16x3_t
 simde_vld3q_s8(int8_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3q_s8(ptr);
+  #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+    v128_t
+      a0 = wasm_v128_load(ptr),
+      a1 = wasm_v128_load(ptr + 16),
+      a2 = wasm_v128_load(ptr + 32);
+    simde_int8x16x3_t r = { {
+      wasm_v8x16_shuffle(wasm_v8x16_shuffle(a0, a1, 0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 0, 0, 0, 0, 0), a2, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 17, 20, 23, 26, 29),
+      wasm_v8x16_shuffle(wasm_v8x16_shuffle(a0, a1, 1, 4, 7, 10, 13, 16, 19, 22, 25, 28, 31, 0, 0, 0, 0, 0), a2, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 18, 21, 24, 27, 30),
+      wasm_v8x16_shuffle(wasm_v8x16_shuffle(a0, a1, 2, 5, 8, 11, 14, 17, 20, 23, 26, 29, 0, 0, 0, 0, 0, 0), a2, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 16, 19, 22, 25, 28, 31)
+    } };
+    return r;
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    /* pshufb zeroes the lanes each input does not contribute, so the
+     * three partial results can simply be ORed together. */
+    const __m128i
+      a0 = _mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr)),
+      a1 = _mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr + 16)),
+      a2 = _mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr + 32));
+    simde_int8x16x3_t r = { {
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(a0, _mm_setr_epi8(0, 3, 6, 9, 12, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+          _mm_shuffle_epi8(a1, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, 2, 5, 8, 11, 14, -1, -1, -1, -1, -1))),
+        _mm_shuffle_epi8(a2, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, 4, 7, 10, 13))),
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(a0, _mm_setr_epi8(1, 4, 7, 10, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+          _mm_shuffle_epi8(a1, _mm_setr_epi8(-1, -1, -1, -1, -1, 0, 3, 6, 9, 12, 15, -1, -1, -1, -1, -1))),
+        _mm_shuffle_epi8(a2, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, 5, 8, 11, 14))),
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(a0, _mm_setr_epi8(2, 5, 8, 11, 14, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+          _mm_shuffle_epi8(a1, _mm_setr_epi8(-1, -1, -1, -1, -1, 1, 4, 7, 10, 13, -1, -1, -1, -1, -1, -1))),
+        _mm_shuffle_epi8(a2, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 3, 6, 9, 12, 15)))
+    } };
+    return r;
   #else
     simde_int8x16_private r_[3];
 
-    for (size_t i = 0; i < (sizeof(r_) / sizeof(r_[0])); i++) {
-      for (size_t j = 0 ; j < (sizeof(r_[0].values) / sizeof(r_[0].values[0])) ; j++) {
-        r_[i].values[j] = ptr[i + (j * (sizeof(r_) / sizeof(r_[0])))];
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_int8x16_private
+        a0_ = simde_int8x16_to_private(simde_vld1q_s8(ptr)),
+        a1_ = simde_int8x16_to_private(simde_vld1q_s8(ptr + 16)),
+        a2_ = simde_int8x16_to_private(simde_vld1q_s8(ptr + 32));
+
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(8, 16, a0_.values, a1_.values, 0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 0, 0, 0, 0, 0);
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(8, 16, r_[0].values, a2_.values, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 17, 20, 23, 26, 29);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(8, 16, a0_.values, a1_.values, 1, 4, 7, 10, 13, 16, 19, 22, 25, 28, 31, 0, 0, 0, 0, 0);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(8, 16, r_[1].values, a2_.values, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 18, 21, 24, 27, 30);
+      r_[2].values = SIMDE_SHUFFLE_VECTOR_(8, 16, a0_.values, a1_.values, 2, 5, 8, 11, 14, 17, 20, 23, 26, 29, 0, 0, 0, 0, 0, 0);
+      r_[2].values = SIMDE_SHUFFLE_VECTOR_(8, 16, r_[2].values, a2_.values, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 16, 19, 22, 25, 28, 31);
+    #else
+      for (size_t i = 0; i < (sizeof(r_) / sizeof(r_[0])); i++) {
+        for (size_t j = 0 ; j < (sizeof(r_[0].values) / sizeof(r_[0].values[0])) ; j++) {
+          r_[i].values[j] = ptr[i + (j * (sizeof(r_) / sizeof(r_[0])))];
+        }
       }
-    }
+    #endif
 
     simde_int8x16x3_t r = { {
       simde_int8x16_from_private(r_[0]),
@@ -409,14 +532,62 @@ simde_int16x8x3_t
 simde_vld3q_s16(int16_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3q_s16(ptr);
+  #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+    v128_t
+      a0 = wasm_v128_load(ptr),
+      a1 = wasm_v128_load(ptr + 8),
+      a2 = wasm_v128_load(ptr + 16);
+    simde_int16x8x3_t r = { {
+      wasm_v16x8_shuffle(wasm_v16x8_shuffle(a0, a1, 0, 3, 6, 9, 12, 15, 0, 0), a2, 0, 1, 2, 3, 4, 5, 10, 13),
+      wasm_v16x8_shuffle(wasm_v16x8_shuffle(a0, a1, 1, 4, 7, 10, 13, 0, 0, 0), a2, 0, 1, 2, 3, 4, 8, 11, 14),
+      wasm_v16x8_shuffle(wasm_v16x8_shuffle(a0, a1, 2, 5, 8, 11, 14, 0, 0, 0), a2, 0, 1, 2, 3, 4, 9, 12, 15)
+    } };
+    return r;
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    const __m128i
+      a0 = _mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr)),
+      a1 = _mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr + 8)),
+      a2 = _mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr + 16));
+    simde_int16x8x3_t r = { {
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(a0, _mm_setr_epi8(0, 1, 6, 7, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+          _mm_shuffle_epi8(a1, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, 2, 3, 8, 9, 14, 15, -1, -1, -1, -1))),
+        _mm_shuffle_epi8(a2, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4, 5, 10, 11))),
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(a0, _mm_setr_epi8(2, 3, 8, 9, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+          _mm_shuffle_epi8(a1, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, 4, 5, 10, 11, -1, -1, -1, -1, -1, -1))),
+        _mm_shuffle_epi8(a2, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 1, 6, 7, 12, 13))),
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(a0, _mm_setr_epi8(4, 5, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+          _mm_shuffle_epi8(a1, _mm_setr_epi8(-1, -1, -1, -1, 0, 1, 6, 7, 12, 13, -1, -1, -1, -1, -1, -1))),
+        _mm_shuffle_epi8(a2, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, 3, 8, 9, 14, 15)))
+    } };
+    return r;
   #else
     simde_int16x8_private r_[3];
 
-    for (size_t i = 0; i < (sizeof(r_) / sizeof(r_[0])); i++) {
-      for (size_t j = 0 ; j < (sizeof(r_[0].values) / sizeof(r_[0].values[0])) ; j++) {
-        r_[i].values[j] = ptr[i + (j * (sizeof(r_) / sizeof(r_[0])))];
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_int16x8_private
+        a0_ = simde_int16x8_to_private(simde_vld1q_s16(ptr)),
+        a1_ = simde_int16x8_to_private(simde_vld1q_s16(ptr + 8)),
+        a2_ = simde_int16x8_to_private(simde_vld1q_s16(ptr + 16));
+
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(16, 16, a0_.values, a1_.values, 0, 3, 6, 9, 12, 15, 0, 0);
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(16, 16, r_[0].values, a2_.values, 0, 1, 2, 3, 4, 5, 10, 13);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(16, 16, a0_.values, a1_.values, 1, 4, 7, 10, 13, 0, 0, 0);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(16, 16, r_[1].values, a2_.values, 0, 1, 2, 3, 4, 8, 11, 14);
+      r_[2].values = SIMDE_SHUFFLE_VECTOR_(16, 16, a0_.values, a1_.values, 2, 5, 8, 11, 14, 0, 0, 0);
+      r_[2].values = SIMDE_SHUFFLE_VECTOR_(16, 16, r_[2].values, a2_.values, 0, 1, 2, 3, 4, 9, 12, 15);
+    #else
+      for (size_t i = 0; i < (sizeof(r_) / sizeof(r_[0])); i++) {
+        for (size_t j = 0 ; j < (sizeof(r_[0].values) / sizeof(r_[0].values[0])) ; j++) {
+          r_[i].values[j] = ptr[i + (j * (sizeof(r_) / sizeof(r_[0])))];
+        }
       }
-    }
+    #endif
 
     simde_int16x8x3_t r = { {
       simde_int16x8_from_private(r_[0]),
@@ -437,14 +608,54 @@ simde_int32x4x3_t
 simde_vld3q_s32(int32_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3q_s32(ptr);
+  #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+    v128_t
+      a0 = wasm_v128_load(ptr),
+      a1 = wasm_v128_load(ptr + 4),
+      a2 = wasm_v128_load(ptr + 8);
+    simde_int32x4x3_t r = { {
+      wasm_v32x4_shuffle(wasm_v32x4_shuffle(a0, a1, 0, 3, 6, 0), a2, 0, 1, 2, 5),
+      wasm_v32x4_shuffle(wasm_v32x4_shuffle(a0, a1, 1, 4, 7, 0), a2, 0, 1, 2, 6),
+      wasm_v32x4_shuffle(wasm_v32x4_shuffle(a0, a1, 2, 5, 0, 0), a2, 0, 1, 4, 7)
+    } };
+    return r;
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    const __m128
+      a0 = _mm_loadu_ps(HEDLEY_REINTERPRET_CAST(const float*, ptr)),
+      a1 = _mm_loadu_ps(HEDLEY_REINTERPRET_CAST(const float*, ptr + 4)),
+      a2 = _mm_loadu_ps(HEDLEY_REINTERPRET_CAST(const float*, ptr + 8)),
+      t0 = _mm_shuffle_ps(a1, a2, _MM_SHUFFLE(1, 1, 2, 2)),
+      t1 = _mm_shuffle_ps(a0, a1, _MM_SHUFFLE(0, 0, 1, 1)),
+      t2 = _mm_shuffle_ps(a1, a2, _MM_SHUFFLE(2, 2, 3, 3)),
+      t3 = _mm_shuffle_ps(a0, a1, _MM_SHUFFLE(1, 1, 2, 2));
+    simde_int32x4x3_t r = { {
+      _mm_castps_si128(_mm_shuffle_ps(a0, t0, _MM_SHUFFLE(2, 0, 3, 0))),
+      _mm_castps_si128(_mm_shuffle_ps(t1, t2, _MM_SHUFFLE(2, 0, 2, 0))),
+      _mm_castps_si128(_mm_shuffle_ps(t3, a2, _MM_SHUFFLE(3, 0, 2, 0)))
+    } };
+    return r;
   #else
     simde_int32x4_private r_[3];
 
-    for (size_t i = 0; i < (sizeof(r_) / sizeof(r_[0])); i++) {
-      for (size_t j = 0 ; j < (sizeof(r_[0].values) / sizeof(r_[0].values[0])) ; j++) {
-        r_[i].values[j] = ptr[i + (j * (sizeof(r_) / sizeof(r_[0])))];
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_int32x4_private
+        a0_ = simde_int32x4_to_private(simde_vld1q_s32(ptr)),
+        a1_ = simde_int32x4_to_private(simde_vld1q_s32(ptr + 4)),
+        a2_ = simde_int32x4_to_private(simde_vld1q_s32(ptr + 8));
+
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(32, 16, a0_.values, a1_.values, 0, 3, 6, 0);
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(32, 16, r_[0].values, a2_.values, 0, 1, 2, 5);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(32, 16, a0_.values, a1_.values, 1, 4, 7, 0);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(32, 16, r_[1].values, a2_.values, 0, 1, 2, 6);
+      r_[2].values = SIMDE_SHUFFLE_VECTOR_(32, 16, a0_.values, a1_.values, 2, 5, 0, 0);
+      r_[2].values = SIMDE_SHUFFLE_VECTOR_(32, 16, r_[2].values, a2_.values, 0, 1, 4, 7);
+    #else
+      for (size_t i = 0; i < (sizeof(r_) / sizeof(r_[0])); i++) {
+        for (size_t j = 0 ; j < (sizeof(r_[0].values) / sizeof(r_[0].values[0])) ; j++) {
+          r_[i].values[j] = ptr[i + (j * (sizeof(r_) / sizeof(r_[0])))];
+        }
       }
-    }
+    #endif
 
     simde_int32x4x3_t r = { {
       simde_int32x4_from_private(r_[0]),
@@ -465,14 +676,47 @@ simde_int64x2x3_t
 simde_vld3q_s64(int64_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vld3q_s64(ptr);
+  #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+    v128_t
+      a0 = wasm_v128_load(ptr),
+      a1 = wasm_v128_load(ptr + 2),
+      a2 = wasm_v128_load(ptr + 4);
+    simde_int64x2x3_t r = { {
+      wasm_v64x2_shuffle(a0, a1, 0, 3),
+      wasm_v64x2_shuffle(a0, a2, 1, 2),
+      wasm_v64x2_shuffle(a1, a2, 0, 3)
+    } };
+    return r;
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    const __m128d
+      a0 = _mm_loadu_pd(HEDLEY_REINTERPRET_CAST(const double*, ptr)),
+      a1 = _mm_loadu_pd(HEDLEY_REINTERPRET_CAST(const double*, ptr + 2)),
+      a2 = _mm_loadu_pd(HEDLEY_REINTERPRET_CAST(const double*, ptr + 4));
+    simde_int64x2x3_t r = { {
+      _mm_castpd_si128(_mm_shuffle_pd(a0, a1, 2)),
+      _mm_castpd_si128(_mm_shuffle_pd(a0, a2, 1)),
+      _mm_castpd_si128(_mm_shuffle_pd(a1, a2, 2))
+    } };
+    return r;
   #else
     simde_int64x2_private r_[3];
 
-    for (size_t i = 0; i < (sizeof(r_) / sizeof(r_[0])); i++) {
-      for (size_t j = 0 ; j < (sizeof(r_[0].values) / sizeof(r_[0].values[0])) ; j++) {
-        r_[i].values[j] = ptr[i + (j * (sizeof(r_) / sizeof(r_[0])))];
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_int64x2_private
+        a0_ = simde_int64x2_to_private(simde_vld1q_s64(ptr)),
+        a1_ = simde_int64x2_to_private(simde_vld1q_s64(ptr + 2)),
+        a2_ = simde_int64x2_to_private(simde_vld1q_s64(ptr + 4));
+
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(64, 16, a0_.values, a1_.values, 0, 3);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(64, 16, a0_.values, a2_.values, 1, 2);
+      r_[2].values = SIMDE_SHUFFLE_VECTOR_(64, 16, a1_.values, a2_.values, 0, 3);
+    #else
+      for (size_t i = 0; i < (sizeof(r_) / sizeof(r_[0])); i++) {
+        for (size_t j = 0 ; j < (sizeof(r_[0].values) / sizeof(r_[0].values[0])) ; j++) {
+          r_[i].values[j] = ptr[i + (j * (sizeof(r_) / sizeof(r_[0])))];
+        }
       }
-    }
+    #endif
 
     simde_int64x2x3_t r = { {
       simde_int64x2_from_private(r_[0]),
@@ -494,14 +738,62 @@ simde_uint8x16x3_t
 simde_vld3q_u8(uint8_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3q_u8(ptr);
+  #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+    v128_t
+      a0 = wasm_v128_load(ptr),
+      a1 = wasm_v128_load(ptr + 16),
+      a2 = wasm_v128_load(ptr + 32);
+    simde_uint8x16x3_t r = { {
+      wasm_v8x16_shuffle(wasm_v8x16_shuffle(a0, a1, 0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 0, 0, 0, 0, 0), a2, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 17, 20, 23, 26, 29),
+      wasm_v8x16_shuffle(wasm_v8x16_shuffle(a0, a1, 1, 4, 7, 10, 13, 16, 19, 22, 25, 28, 31, 0, 0, 0, 0, 0), a2, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 18, 21, 24, 27, 30),
+      wasm_v8x16_shuffle(wasm_v8x16_shuffle(a0, a1, 2, 5, 8, 11, 14, 17, 20, 23, 26, 29, 0, 0, 0, 0, 0, 0), a2, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 16, 19, 22, 25, 28, 31)
+    } };
+    return r;
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    const __m128i
+      a0 = _mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr)),
+      a1 = _mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr + 16)),
+      a2 = _mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr + 32));
+    simde_uint8x16x3_t r = { {
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(a0, _mm_setr_epi8(0, 3, 6, 9, 12, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+          _mm_shuffle_epi8(a1, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, 2, 5, 8, 11, 14, -1, -1, -1, -1, -1))),
+        _mm_shuffle_epi8(a2, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, 4, 7, 10, 13))),
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(a0, _mm_setr_epi8(1, 4, 7, 10, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+          _mm_shuffle_epi8(a1, _mm_setr_epi8(-1, -1, -1, -1, -1, 0, 3, 6, 9, 12, 15, -1, -1, -1, -1, -1))),
+        _mm_shuffle_epi8(a2, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, 5, 8, 11, 14))),
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(a0, _mm_setr_epi8(2, 5, 8, 11, 14, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+          _mm_shuffle_epi8(a1, _mm_setr_epi8(-1, -1, -1, -1, -1, 1, 4, 7, 10, 13, -1, -1, -1, -1, -1, -1))),
+        _mm_shuffle_epi8(a2, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 3, 6, 9, 12, 15)))
+    } };
+    return r;
   #else
     simde_uint8x16_private r_[3];
 
-    for (size_t i = 0; i < (sizeof(r_) / sizeof(r_[0])); i++) {
-      for (size_t j = 0 ; j < (sizeof(r_[0].values) / sizeof(r_[0].values[0])) ; j++) {
-        r_[i].values[j] = ptr[i + (j * (sizeof(r_) / sizeof(r_[0])))];
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_uint8x16_private
+        a0_ = simde_uint8x16_to_private(simde_vld1q_u8(ptr)),
+        a1_ = simde_uint8x16_to_private(simde_vld1q_u8(ptr + 16)),
+        a2_ = simde_uint8x16_to_private(simde_vld1q_u8(ptr + 32));
+
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(8, 16, a0_.values, a1_.values, 0, 3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 0, 0, 0, 0, 0);
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(8, 16, r_[0].values, a2_.values, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 17, 20, 23, 26, 29);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(8, 16, a0_.values, a1_.values, 1, 4, 7, 10, 13, 16, 19, 22, 25, 28, 31, 0, 0, 0, 0, 0);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(8, 16, r_[1].values, a2_.values, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 18, 21, 24, 27, 30);
+      r_[2].values = SIMDE_SHUFFLE_VECTOR_(8, 16, a0_.values, a1_.values, 2, 5, 8, 11, 14, 17, 20, 23, 26, 29, 0, 0, 0, 0, 0, 0);
+      r_[2].values = SIMDE_SHUFFLE_VECTOR_(8, 16, r_[2].values, a2_.values, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 16, 19, 22, 25, 28, 31);
+    #else
+      for (size_t i = 0; i < (sizeof(r_) / sizeof(r_[0])); i++) {
+        for (size_t j = 0 ; j < (sizeof(r_[0].values) / sizeof(r_[0].values[0])) ; j++) {
+          r_[i].values[j] = ptr[i + (j * (sizeof(r_) / sizeof(r_[0])))];
+        }
       }
-    }
+    #endif
 
     simde_uint8x16x3_t r = { {
       simde_uint8x16_from_private(r_[0]),
@@ -522,14 +814,62 @@ simde_uint16x8x3_t
 simde_vld3q_u16(uint16_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3q_u16(ptr);
+  #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+    v128_t
+      a0 = wasm_v128_load(ptr),
+      a1 = wasm_v128_load(ptr + 8),
+      a2 = wasm_v128_load(ptr + 16);
+    simde_uint16x8x3_t r = { {
+      wasm_v16x8_shuffle(wasm_v16x8_shuffle(a0, a1, 0, 3, 6, 9, 12, 15, 0, 0), a2, 0, 1, 2, 3, 4, 5, 10, 13),
+      wasm_v16x8_shuffle(wasm_v16x8_shuffle(a0, a1, 1, 4, 7, 10, 13, 0, 0, 0), a2, 0, 1, 2, 3, 4, 8, 11, 14),
+      wasm_v16x8_shuffle(wasm_v16x8_shuffle(a0, a1, 2, 5, 8, 11, 14, 0, 0, 0), a2, 0, 1, 2, 3, 4, 9, 12, 15)
+    } };
+    return r;
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    const __m128i
+      a0 = _mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr)),
+      a1 = _mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr + 8)),
+      a2 = _mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr + 16));
+    simde_uint16x8x3_t r = { {
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(a0, _mm_setr_epi8(0, 1, 6, 7, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+          _mm_shuffle_epi8(a1, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, 2, 3, 8, 9, 14, 15, -1, -1, -1, -1))),
+        _mm_shuffle_epi8(a2, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4, 5, 10, 11))),
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(a0, _mm_setr_epi8(2, 3, 8, 9, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+          _mm_shuffle_epi8(a1, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, 4, 5, 10, 11, -1, -1, -1, -1, -1, -1))),
+        _mm_shuffle_epi8(a2, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 1, 6, 7, 12, 13))),
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(a0, _mm_setr_epi8(4, 5, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+          _mm_shuffle_epi8(a1, _mm_setr_epi8(-1, -1, -1, -1, 0, 1, 6, 7, 12, 13, -1, -1, -1, -1, -1, -1))),
+        _mm_shuffle_epi8(a2, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, 3, 8, 9, 14, 15)))
+    } };
+    return r;
   #else
     simde_uint16x8_private r_[3];
 
-    for (size_t i = 0; i < (sizeof(r_) / sizeof(r_[0])); i++) {
-      for (size_t j = 0 ; j < (sizeof(r_[0].values) / sizeof(r_[0].values[0])) ; j++) {
-        r_[i].values[j] = ptr[i + (j * (sizeof(r_) / sizeof(r_[0])))];
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_uint16x8_private
+        a0_ = simde_uint16x8_to_private(simde_vld1q_u16(ptr)),
+        a1_ = simde_uint16x8_to_private(simde_vld1q_u16(ptr + 8)),
+        a2_ = simde_uint16x8_to_private(simde_vld1q_u16(ptr + 16));
+
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(16, 16, a0_.values, a1_.values, 0, 3, 6, 9, 12, 15, 0, 0);
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(16, 16, r_[0].values, a2_.values, 0, 1, 2, 3, 4, 5, 10, 13);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(16, 16, a0_.values, a1_.values, 1, 4, 7, 10, 13, 0, 0, 0);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(16, 16, r_[1].values, a2_.values, 0, 1, 2, 3, 4, 8, 11, 14);
+      r_[2].values = SIMDE_SHUFFLE_VECTOR_(16, 16, a0_.values, a1_.values, 2, 5, 8, 11, 14, 0, 0, 0);
+      r_[2].values = SIMDE_SHUFFLE_VECTOR_(16, 16, r_[2].values, a2_.values, 0, 1, 2, 3, 4, 9, 12, 15);
+    #else
+      for (size_t i = 0; i < (sizeof(r_) / sizeof(r_[0])); i++) {
+        for (size_t j = 0 ; j < (sizeof(r_[0].values) / sizeof(r_[0].values[0])) ; j++) {
+          r_[i].values[j] = ptr[i + (j * (sizeof(r_) / sizeof(r_[0])))];
+        }
       }
-    }
+    #endif
 
     simde_uint16x8x3_t r = { {
       simde_uint16x8_from_private(r_[0]),
@@ -550,14 +890,54 @@ simde_uint32x4x3_t
 simde_vld3q_u32(uint32_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld3q_u32(ptr);
+  #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+    v128_t
+      a0 = wasm_v128_load(ptr),
+      a1 = wasm_v128_load(ptr + 4),
+      a2 = wasm_v128_load(ptr + 8);
+    simde_uint32x4x3_t r = { {
+      wasm_v32x4_shuffle(wasm_v32x4_shuffle(a0, a1, 0, 3, 6, 0), a2, 0, 1, 2, 5),
+      wasm_v32x4_shuffle(wasm_v32x4_shuffle(a0, a1, 1, 4, 7, 0), a2, 0, 1, 2, 6),
+      wasm_v32x4_shuffle(wasm_v32x4_shuffle(a0, a1, 2, 5, 0, 0), a2, 0, 1, 4, 7)
+    } };
+    return r;
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    const __m128
+      a0 = _mm_loadu_ps(HEDLEY_REINTERPRET_CAST(const float*, ptr)),
+      a1 = _mm_loadu_ps(HEDLEY_REINTERPRET_CAST(const float*, ptr + 4)),
+      a2 = _mm_loadu_ps(HEDLEY_REINTERPRET_CAST(const float*, ptr + 8)),
+      t0 = _mm_shuffle_ps(a1, a2, _MM_SHUFFLE(1, 1, 2, 2)),
+      t1 = _mm_shuffle_ps(a0, a1, _MM_SHUFFLE(0, 0, 1, 1)),
+      t2 = _mm_shuffle_ps(a1, a2, _MM_SHUFFLE(2, 2, 3, 3)),
+      t3 = _mm_shuffle_ps(a0, a1, _MM_SHUFFLE(1, 1, 2, 2));
+    simde_uint32x4x3_t r = { {
+      _mm_castps_si128(_mm_shuffle_ps(a0, t0, _MM_SHUFFLE(2, 0, 3, 0))),
+      _mm_castps_si128(_mm_shuffle_ps(t1, t2, _MM_SHUFFLE(2, 0, 2, 0))),
+      _mm_castps_si128(_mm_shuffle_ps(t3, a2, _MM_SHUFFLE(3, 0, 2, 0)))
+    } };
+    return r;
   #else
     simde_uint32x4_private r_[3];
 
-    for (size_t i = 0; i < (sizeof(r_) / sizeof(r_[0])); i++) {
-      for (size_t j = 0 ; j < (sizeof(r_[0].values) / sizeof(r_[0].values[0])) ; j++) {
-        r_[i].values[j] = ptr[i + (j * (sizeof(r_) / sizeof(r_[0])))];
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_uint32x4_private
+        a0_ = simde_uint32x4_to_private(simde_vld1q_u32(ptr)),
+        a1_ = simde_uint32x4_to_private(simde_vld1q_u32(ptr + 4)),
+        a2_ = simde_uint32x4_to_private(simde_vld1q_u32(ptr + 8));
+
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(32, 16, a0_.values, a1_.values, 0, 3, 6, 0);
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(32, 16, r_[0].values, a2_.values, 0, 1, 2, 5);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(32, 16, a0_.values, a1_.values, 1, 4, 7, 0);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(32, 16, r_[1].values, a2_.values, 0, 1, 2, 6);
+      r_[2].values = SIMDE_SHUFFLE_VECTOR_(32, 16, a0_.values, a1_.values, 2, 5, 0, 0);
+      r_[2].values = SIMDE_SHUFFLE_VECTOR_(32, 16, r_[2].values, a2_.values, 0, 1, 4, 7);
+    #else
+      for (size_t i = 0; i < (sizeof(r_) / sizeof(r_[0])); i++) {
+        for (size_t j = 0 ; j < (sizeof(r_[0].values) / sizeof(r_[0].values[0])) ; j++) {
+          r_[i].values[j] = ptr[i + (j * (sizeof(r_) / sizeof(r_[0])))];
+        }
       }
-    }
+    #endif
 
     simde_uint32x4x3_t r = { {
       simde_uint32x4_from_private(r_[0]),
@@ -578,14 +958,47 @@ simde_uint64x2x3_t
 simde_vld3q_u64(uint64_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vld3q_u64(ptr);
+  #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+    v128_t
+      a0 = wasm_v128_load(ptr),
+      a1 = wasm_v128_load(ptr + 2),
+      a2 = wasm_v128_load(ptr + 4);
+    simde_uint64x2x3_t r = { {
+      wasm_v64x2_shuffle(a0, a1, 0, 3),
+      wasm_v64x2_shuffle(a0, a2, 1, 2),
+      wasm_v64x2_shuffle(a1, a2, 0, 3)
+    } };
+    return r;
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    const __m128d
+      a0 = _mm_loadu_pd(HEDLEY_REINTERPRET_CAST(const double*, ptr)),
+      a1 = _mm_loadu_pd(HEDLEY_REINTERPRET_CAST(const double*, ptr + 2)),
+      a2 = _mm_loadu_pd(HEDLEY_REINTERPRET_CAST(const double*, ptr + 4));
+    simde_uint64x2x3_t r = { {
+      _mm_castpd_si128(_mm_shuffle_pd(a0, a1, 2)),
+      _mm_castpd_si128(_mm_shuffle_pd(a0, a2, 1)),
+      _mm_castpd_si128(_mm_shuffle_pd(a1, a2, 2))
+    } };
+    return r;
   #else
     simde_uint64x2_private r_[3];
 
-    for (size_t i = 0; i < (sizeof(r_) / sizeof(r_[0])); i++) {
-      for (size_t j = 0 ; j < (sizeof(r_[0].values) / sizeof(r_[0].values[0])) ; j++) {
-        r_[i].values[j] = ptr[i + (j * (sizeof(r_) / sizeof(r_[0])))];
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_uint64x2_private
+        a0_ = simde_uint64x2_to_private(simde_vld1q_u64(ptr)),
+        a1_ = simde_uint64x2_to_private(simde_vld1q_u64(ptr + 2)),
+        a2_ = simde_uint64x2_to_private(simde_vld1q_u64(ptr + 4));
+
+      r_[0].values = SIMDE_SHUFFLE_VECTOR_(64, 16, a0_.values, a1_.values, 0, 3);
+      r_[1].values = SIMDE_SHUFFLE_VECTOR_(64, 16, a0_.values, a2_.values, 1, 2);
+      r_[2].values = SIMDE_SHUFFLE_VECTOR_(64, 16, a1_.values, a2_.values, 0, 3);
+    #else
+      for (size_t i = 0; i < (sizeof(r_) / sizeof(r_[0])); i++) {
+        for (size_t j = 0 ; j < (sizeof(r_[0].values) / sizeof(r_[0].values[0])) ; j++) {
+          r_[i].values[j] = ptr[i + (j * (sizeof(r_) / sizeof(r_[0])))];
+        }
       }
-    }
+    #endif
 
     simde_uint64x2x3_t r = { {
       simde_uint64x2_from_private(r_[0]),
@@ -29,6 +29,9 @@
 #define SIMDE_ARM_NEON_LD4_H
 
 #include "types.h"
+#include "ld1.h"
+#include "uzp1.h"
+#include "uzp2.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
@@ -245,13 +248,20 @@ simde_vld4q_f32(simde_float32 const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4q_f32(ptr);
   #else
-    simde_float32x4_private a_[4];
-    for (size_t i = 0; i < (sizeof(simde_float32x4_t) / sizeof(*ptr)) * 4 ; i++) {
-      a_[i % 4].values[i / 4] = ptr[i];
-    }
-    simde_float32x4x4_t s_ = { { simde_float32x4_from_private(a_[0]), simde_float32x4_from_private(a_[1]),
-                                 simde_float32x4_from_private(a_[2]), simde_float32x4_from_private(a_[3]) } };
-    return s_;
+    simde_float32x4_t
+      a0 = simde_vld1q_f32(ptr),
+      a1 = simde_vld1q_f32(ptr + 4),
+      a2 = simde_vld1q_f32(ptr + 8),
+      a3 = simde_vld1q_f32(ptr + 12),
+      b0 = simde_vuzp1q_f32(a0, a1),
+      b1 = simde_vuzp2q_f32(a0, a1),
+      b2 = simde_vuzp1q_f32(a2, a3),
+      b3 = simde_vuzp2q_f32(a2, a3);
+    simde_float32x4x4_t r = { {
+      simde_vuzp1q_f32(b0, b2), simde_vuzp1q_f32(b1, b3),
+      simde_vuzp2q_f32(b0, b2), simde_vuzp2q_f32(b1, b3)
+    } };
+    return r;
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
@@ -265,13 +275,20 @@ simde_vld4q_f64(simde_float64 const *ptr) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vld4q_f64(ptr);
   #else
-    simde_float64x2_private a_[4];
-    for (size_t i = 0; i < (sizeof(simde_float64x2_t) / sizeof(*ptr)) * 4 ; i++) {
-      a_[i % 4].values[i / 4] = ptr[i];
-    }
-    simde_float64x2x4_t s_ = { { simde_float64x2_from_private(a_[0]), simde_float64x2_from_private(a_[1]),
-                                 simde_float64x2_from_private(a_[2]), simde_float64x2_from_private(a_[3]) } };
-    return s_;
+    simde_float64x2_t
+      a0 = simde_vld1q_f64(ptr),
+      a1 = simde_vld1q_f64(ptr + 2),
+      a2 = simde_vld1q_f64(ptr + 4),
+      a3 = simde_vld1q_f64(ptr + 6),
+      b0 = simde_vuzp1q_f64(a0, a1),
+      b1 = simde_vuzp2q_f64(a0, a1),
+      b2 = simde_vuzp1q_f64(a2, a3),
+      b3 = simde_vuzp2q_f64(a2, a3);
+    simde_float64x2x4_t r = { {
+      simde_vuzp1q_f64(b0, b2), simde_vuzp1q_f64(b1, b3),
+      simde_vuzp2q_f64(b0, b2), simde_vuzp2q_f64(b1, b3)
+    } };
+    return r;
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
@@ -284,14 +301,38 @@ simde_int8x16x4_t
 simde_vld4q_s8(int8_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4q_s8(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    /* Gather each field into its own 32-bit lane, then transpose. */
+    const __m128i idx = _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+    const __m128i
+      a0 = _mm_shuffle_epi8(_mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr)), idx),
+      a1 = _mm_shuffle_epi8(_mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr + 16)), idx),
+      a2 = _mm_shuffle_epi8(_mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr + 32)), idx),
+      a3 = _mm_shuffle_epi8(_mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr + 48)), idx),
+      t0 = _mm_unpacklo_epi32(a0, a1),
+      t1 = _mm_unpacklo_epi32(a2, a3),
+      t2 = _mm_unpackhi_epi32(a0, a1),
+      t3 = _mm_unpackhi_epi32(a2, a3);
+    simde_int8x16x4_t r = { {
+      _mm_unpacklo_epi64(t0, t1), _mm_unpackhi_epi64(t0, t1),
+      _mm_unpacklo_epi64(t2, t3), _mm_unpackhi_epi64(t2, t3)
+    } };
+    return r;
   #else
-    simde_int8x16_private a_[4];
-    for (size_t i = 0; i < (sizeof(simde_int8x16_t) / sizeof(*ptr)) * 4 ; i++) {
-      a_[i % 4].values[i / 4] = ptr[i];
-    }
-    simde_int8x16x4_t s_ = { { simde_int8x16_from_private(a_[0]), simde_int8x16_from_private(a_[1]),
-                               simde_int8x16_from_private(a_[2]), simde_int8x16_from_private(a_[3]) } };
-    return s_;
+    simde_int8x16_t
+      a0 = simde_vld1q_s8(ptr),
+      a1 = simde_vld1q_s8(ptr + 16),
+      a2 = simde_vld1q_s8(ptr + 32),
+      a3 = simde_vld1q_s8(ptr + 48),
+      b0 = simde_vuzp1q_s8(a0, a1),
+      b1 = simde_vuzp2q_s8(a0, a1),
+      b2 = simde_vuzp1q_s8(a2, a3),
+      b3 = simde_vuzp2q_s8(a2, a3);
+    simde_int8x16x4_t r = { {
+      simde_vuzp1q_s8(b0, b2), simde_vuzp1q_s8(b1, b3),
+      simde_vuzp2q_s8(b0, b2), simde_vuzp2q_s8(b1, b3)
+    } };
+    return r;
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
@@ -304,14 +345,37 @@ simde_int16x8x4_t
 simde_vld4q_s16(int16_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4q_s16(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    const __m128i idx = _mm_setr_epi8(0, 1, 8, 9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15);
+    const __m128i
+      a0 = _mm_shuffle_epi8(_mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr)), idx),
+      a1 = _mm_shuffle_epi8(_mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr + 8)), idx),
+      a2 = _mm_shuffle_epi8(_mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr + 16)), idx),
+      a3 = _mm_shuffle_epi8(_mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr + 24)), idx),
+      t0 = _mm_unpacklo_epi32(a0, a1),
+      t1 = _mm_unpacklo_epi32(a2, a3),
+      t2 = _mm_unpackhi_epi32(a0, a1),
+      t3 = _mm_unpackhi_epi32(a2, a3);
+    simde_int16x8x4_t r = { {
+      _mm_unpacklo_epi64(t0, t1), _mm_unpackhi_epi64(t0, t1),
+      _mm_unpacklo_epi64(t2, t3), _mm_unpackhi_epi64(t2, t3)
+    } };
+    return r;
   #else
-    simde_int16x8_private a_[4];
-    for (size_t i = 0; i < (sizeof(simde_int16x8_t) / sizeof(*ptr)) * 4 ; i++) {
-      a_[i % 4].values[i / 4] = ptr[i];
-    }
-    simde_int16x8x4_t s_ = { { simde_int16x8_from_private(a_[0]), simde_int16x8_from_private(a_[1]),
-                               simde_int16x8_from_private(a_[2]), simde_int16x8_from_private(a_[3]) } };
-    return s_;
+    simde_int16x8_t
+      a0 = simde_vld1q_s16(ptr),
+      a1 = simde_vld1q_s16(ptr + 8),
+      a2 = simde_vld1q_s16(ptr + 16),
+      a3 = simde_vld1q_s16(ptr + 24),
+      b0 = simde_vuzp1q_s16(a0, a1),
+      b1 = simde_vuzp2q_s16(a0, a1),
+      b2 = simde_vuzp1q_s16(a2, a3),
+      b3 = simde_vuzp2q_s16(a2, a3);
+    simde_int16x8x4_t r = { {
+      simde_vuzp1q_s16(b0, b2), simde_vuzp1q_s16(b1, b3),
+      simde_vuzp2q_s16(b0, b2), simde_vuzp2q_s16(b1, b3)
+    } };
+    return r;
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
@@ -325,13 +389,20 @@ simde_vld4q_s32(int32_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4q_s32(ptr);
   #else
-    simde_int32x4_private a_[4];
-    for (size_t i = 0; i < (sizeof(simde_int32x4_t) / sizeof(*ptr)) * 4 ; i++) {
-      a_[i % 4].values[i / 4] = ptr[i];
-    }
-    simde_int32x4x4_t s_ = { { simde_int32x4_from_private(a_[0]), simde_int32x4_from_private(a_[1]),
-                               simde_int32x4_from_private(a_[2]), simde_int32x4_from_private(a_[3]) } };
-    return s_;
+    simde_int32x4_t
+      a0 = simde_vld1q_s32(ptr),
+      a1 = simde_vld1q_s32(ptr + 4),
+      a2 = simde_vld1q_s32(ptr + 8),
+      a3 = simde_vld1q_s32(ptr + 12),
+      b0 = simde_vuzp1q_s32(a0, a1),
+      b1 = simde_vuzp2q_s32(a0, a1),
+      b2 = simde_vuzp1q_s32(a2, a3),
+      b3 = simde_vuzp2q_s32(a2, a3);
+    simde_int32x4x4_t r = { {
+      simde_vuzp1q_s32(b0, b2), simde_vuzp1q_s32(b1, b3),
+      simde_vuzp2q_s32(b0, b2), simde_vuzp2q_s32(b1, b3)
+    } };
+    return r;
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
@@ -345,13 +416,20 @@ simde_vld4q_s64(int64_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vld4q_s64(ptr);
   #else
-    simde_int64x2_private a_[4];
-    for (size_t i = 0; i < (sizeof(simde_int64x2_t) / sizeof(*ptr)) * 4 ; i++) {
-      a_[i % 4].values[i / 4] = ptr[i];
-    }
-    simde_int64x2x4_t s_ = { { simde_int64x2_from_private(a_[0]), simde_int64x2_from_private(a_[1]),
-                               simde_int64x2_from_private(a_[2]), simde_int64x2_from_private(a_[3]) } };
-    return s_;
+    simde_int64x2_t
+      a0 = simde_vld1q_s64(ptr),
+      a1 = simde_vld1q_s64(ptr + 2),
+      a2 = simde_vld1q_s64(ptr + 4),
+      a3 = simde_vld1q_s64(ptr + 6),
+      b0 = simde_vuzp1q_s64(a0, a1),
+      b1 = simde_vuzp2q_s64(a0, a1),
+      b2 = simde_vuzp1q_s64(a2, a3),
+      b3 = simde_vuzp2q_s64(a2, a3);
+    simde_int64x2x4_t r = { {
+      simde_vuzp1q_s64(b0, b2), simde_vuzp1q_s64(b1, b3),
+      simde_vuzp2q_s64(b0, b2), simde_vuzp2q_s64(b1, b3)
+    } };
+    return r;
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
@@ -365,14 +443,37 @@ simde_uint8x16x4_t
 simde_vld4q_u8(uint8_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4q_u8(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    const __m128i idx = _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+    const __m128i
+      a0 = _mm_shuffle_epi8(_mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr)), idx),
+      a1 = _mm_shuffle_epi8(_mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr + 16)), idx),
+      a2 = _mm_shuffle_epi8(_mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr + 32)), idx),
+      a3 = _mm_shuffle_epi8(_mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr + 48)), idx),
+      t0 = _mm_unpacklo_epi32(a0, a1),
+      t1 = _mm_unpacklo_epi32(a2, a3),
+      t2 = _mm_unpackhi_epi32(a0, a1),
+      t3 = _mm_unpackhi_epi32(a2, a3);
+    simde_uint8x16x4_t r = { {
+      _mm_unpacklo_epi64(t0, t1), _mm_unpackhi_epi64(t0, t1),
+      _mm_unpacklo_epi64(t2, t3), _mm_unpackhi_epi64(t2, t3)
+    } };
+    return r;
   #else
-    simde_uint8x16_private a_[4];
-    for (size_t i = 0; i < (sizeof(simde_uint8x16_t) / sizeof(*ptr)) * 4 ; i++) {
-      a_[i % 4].values[i / 4] = ptr[i];
-    }
-    simde_uint8x16x4_t s_ = { { simde_uint8x16_from_private(a_[0]), simde_uint8x16_from_private(a_[1]),
-                                simde_uint8x16_from_private(a_[2]), simde_uint8x16_from_private(a_[3]) } };
-    return s_;
+    simde_uint8x16_t
+      a0 = simde_vld1q_u8(ptr),
+      a1 = simde_vld1q_u8(ptr + 16),
+      a2 = simde_vld1q_u8(ptr + 32),
+      a3 = simde_vld1q_u8(ptr + 48),
+      b0 = simde_vuzp1q_u8(a0, a1),
+      b1 = simde_vuzp2q_u8(a0, a1),
+      b2 = simde_vuzp1q_u8(a2, a3),
+      b3 = simde_vuzp2q_u8(a2, a3);
+    simde_uint8x16x4_t r = { {
+      simde_vuzp1q_u8(b0, b2), simde_vuzp1q_u8(b1, b3),
+      simde_vuzp2q_u8(b0, b2), simde_vuzp2q_u8(b1, b3)
+    } };
+    return r;
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
@@ -385,14 +486,37 @@ simde_uint16x8x4_t
 simde_vld4q_u16(uint16_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4q_u16(ptr);
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    const __m128i idx = _mm_setr_epi8(0, 1, 8, 9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15);
+    const __m128i
+      a0 = _mm_shuffle_epi8(_mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr)), idx),
+      a1 = _mm_shuffle_epi8(_mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr + 8)), idx),
+      a2 = _mm_shuffle_epi8(_mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr + 16)), idx),
+      a3 = _mm_shuffle_epi8(_mm_loadu_si128(SIMDE_ALIGN_CAST(const __m128i*, ptr + 24)), idx),
+      t0 = _mm_unpacklo_epi32(a0, a1),
+      t1 = _mm_unpacklo_epi32(a2, a3),
+      t2 = _mm_unpackhi_epi32(a0, a1),
+      t3 = _mm_unpackhi_epi32(a2, a3);
+    simde_uint16x8x4_t r = { {
+      _mm_unpacklo_epi64(t0, t1), _mm_unpackhi_epi64(t0, t1),
+      _mm_unpacklo_epi64(t2, t3), _mm_unpackhi_epi64(t2, t3)
+    } };
+    return r;
   #else
-    simde_uint16x8_private a_[4];
-    for (size_t i = 0; i < (sizeof(simde_uint16x8_t) / sizeof(*ptr)) * 4 ; i++) {
-      a_[i % 4].values[i / 4] = ptr[i];
-    }
-    simde_uint16x8x4_t s_ = { { simde_uint16x8_from_private(a_[0]), simde_uint16x8_from_private(a_[1]),
-                                simde_uint16x8_from_private(a_[2]), simde_uint16x8_from_private(a_[3]) } };
-    return s_;
+    simde_uint16x8_t
+      a0 = simde_vld1q_u16(ptr),
+      a1 = simde_vld1q_u16(ptr + 8),
+      a2 = simde_vld1q_u16(ptr + 16),
+      a3 = simde_vld1q_u16(ptr + 24),
+      b0 = simde_vuzp1q_u16(a0, a1),
+      b1 = simde_vuzp2q_u16(a0, a1),
+      b2 = simde_vuzp1q_u16(a2, a3),
+      b3 = simde_vuzp2q_u16(a2, a3);
+    simde_uint16x8x4_t r = { {
+      simde_vuzp1q_u16(b0, b2), simde_vuzp1q_u16(b1, b3),
+      simde_vuzp2q_u16(b0, b2), simde_vuzp2q_u16(b1, b3)
+    } };
+    return r;
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
@@ -406,13 +530,20 @@ simde_vld4q_u32(uint32_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     return vld4q_u32(ptr);
   #else
-    simde_uint32x4_private a_[4];
-    for (size_t i = 0; i < (sizeof(simde_uint32x4_t) / sizeof(*ptr)) * 4 ; i++) {
-      a_[i % 4].values[i / 4] = ptr[i];
-    }
-    simde_uint32x4x4_t s_ = { { simde_uint32x4_from_private(a_[0]), simde_uint32x4_from_private(a_[1]),
-                                simde_uint32x4_from_private(a_[2]), simde_uint32x4_from_private(a_[3]) } };
-    return s_;
+    simde_uint32x4_t
+      a0 = simde_vld1q_u32(ptr),
+      a1 = simde_vld1q_u32(ptr + 4),
+      a2 = simde_vld1q_u32(ptr + 8),
+      a3 = simde_vld1q_u32(ptr + 12),
+      b0 = simde_vuzp1q_u32(a0, a1),
+      b1 = simde_vuzp2q_u32(a0, a1),
+      b2 = simde_vuzp1q_u32(a2, a3),
+      b3 = simde_vuzp2q_u32(a2, a3);
+    simde_uint32x4x4_t r = { {
+      simde_vuzp1q_u32(b0, b2), simde_vuzp1q_u32(b1, b3),
+      simde_vuzp2q_u32(b0, b2), simde_vuzp2q_u32(b1, b3)
+    } };
+    return r;
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
@@ -426,13 +557,20 @@ simde_vld4q_u64(uint64_t const *ptr) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     return vld4q_u64(ptr);
   #else
-    simde_uint64x2_private a_[4];
-    for (size_t i = 0; i < (sizeof(simde_uint64x2_t) / sizeof(*ptr)) * 4 ; i++) {
-      a_[i % 4].values[i / 4] = ptr[i];
-    }
-    simde_uint64x2x4_t s_ = { { simde_uint64x2_from_private(a_[0]), simde_uint64x2_from_private(a_[1]),
-                                simde_uint64x2_from_private(a_[2]), simde_uint64x2_from_private(a_[3]) } };
-    return s_;
+    simde_uint64x2_t
+      a0 = simde_vld1q_u64(ptr),
+      a1 = simde_vld1q_u64(ptr + 2),
+      a2 = simde_vld1q_u64(ptr + 4),
+      a3 = simde_vld1q_u64(ptr + 6),
+      b0 = simde_vuzp1q_u64(a0, a1),
+      b1 = simde_vuzp2q_u64(a0, a1),
+      b2 = simde_vuzp1q_u64(a2, a3),
+      b3 = simde_vuzp2q_u64(a2, a3);
+    simde_uint64x2x4_t r = { {
+      simde_vuzp1q_u64(b0, b2), simde_vuzp1q_u64(b1, b3),
+      simde_vuzp2q_u64(b0, b2), simde_vuzp2q_u64(b1, b3)
+    } };
+    return r;
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
@@ -0,0 +1,334 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#if !defined(SIMDE_ARM_NEON_RECPE_H)
+#define SIMDE_ARM_NEON_RECPE_H
+
+#include "types.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* RecipEstimate() from the ARM pseudocode; a is 256..511, representing
+ * [0.5, 1.0), and the result is 256..511, representing [1.0, 2.0). */
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_x_arm_neon_recip_estimate(uint32_t a) {
+  a = (a * 2) + 1;
+  return (((UINT32_C(1) << 19) / a) + 1) >> 1;
+}
+
+/* The portable implementations follow FPRecipEstimate() with the
+ * AArch64 defaults (no flush-to-zero, round to nearest) so results
+ * match the hardware bit for bit.  The x86 estimate instructions are
+ * more precise, so they are only used with SIMDE_FAST_MATH. */
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32_t
+simde_vrecpes_f32(simde_float32_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vrecpes_f32(a);
+  #else
+    uint32_t v, r;
+    simde_float32_t rv;
+
+    simde_memcpy(&v, &a, sizeof(v));
+    const uint32_t sign = v & UINT32_C(0x80000000);
+    const uint32_t mag = v & UINT32_C(0x7fffffff);
+
+    if (mag > UINT32_C(0x7f800000)) {
+      r = v | UINT32_C(0x00400000);
+    } else if (mag == UINT32_C(0x7f800000)) {
+      r = sign;
+    } else if (mag < UINT32_C(0x00200000)) {
+      /* |a| < 2^-128 (including zero), so the result overflows */
+      r = sign | UINT32_C(0x7f800000);
+    } else {
+      int32_t e = HEDLEY_STATIC_CAST(int32_t, mag >> 23);
+      uint32_t f = mag & UINT32_C(0x007fffff);
+
+      if (e == 0) {
+        if (f & UINT32_C(0x00400000)) {
+          f = (f << 1) & UINT32_C(0x007fffff);
+        } else {
+          f = (f << 2) & UINT32_C(0x007fffff);
+          e = -1;
+        }
+      }
+
+      int32_t re = 253 - e;
+      f = (simde_x_arm_neon_recip_estimate(UINT32_C(256) | (f >> 15)) & UINT32_C(0xff)) << 15;
+      if (re == 0) {
+        f = UINT32_C(0x00400000) | (f >> 1);
+      } else if (re == -1) {
+        f = UINT32_C(0x00200000) | (f >> 2);
+        re = 0;
+      }
+
+      r = sign | (HEDLEY_STATIC_CAST(uint32_t, re) << 23) | f;
+    }
+
+    simde_memcpy(&rv, &r, sizeof(rv));
+    return rv;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vrecpes_f32
+  #define vrecpes_f32(a) simde_vrecpes_f32((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64_t
+simde_vrecped_f64(simde_float64_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vrecped_f64(a);
+  #else
+    uint64_t v, r;
+    simde_float64_t rv;
+
+    simde_memcpy(&v, &a, sizeof(v));
+    const uint64_t sign = v & UINT64_C(0x8000000000000000);
+    const uint64_t mag = v & UINT64_C(0x7fffffffffffffff);
+
+    if (mag > UINT64_C(0x7ff0000000000000)) {
+      r = v | UINT64_C(0x0008000000000000);
+    } else if (mag == UINT64_C(0x7ff0000000000000)) {
+      r = sign;
+    } else if (mag < UINT64_C(0x0004000000000000)) {
+      /* |a| < 2^-1024 (including zero), so the result overflows */
+      r = sign | UINT64_C(0x7ff0000000000000);
+    } else {
+      int32_t e = HEDLEY_STATIC_CAST(int32_t, mag >> 52);
+      uint64_t f = mag & UINT64_C(0x000fffffffffffff);
+
+      if (e == 0) {
+        if (f & UINT64_C(0x0008000000000000)) {
+          f = (f << 1) & UINT64_C(0x000fffffffffffff);
+        } else {
+          f = (f << 2) & UINT64_C(0x000fffffffffffff);
+          e = -1;
+        }
+      }
+
+      int32_t re = 2045 - e;
+      f = HEDLEY_STATIC_CAST(uint64_t, simde_x_arm_neon_recip_estimate(HEDLEY_STATIC_CAST(uint32_t, UINT64_C(256) | (f >> 44))) & UINT32_C(0xff)) << 44;
+      if (re == 0) {
+        f = UINT64_C(0x0008000000000000) | (f >> 1);
+      } else if (re == -1) {
+        f = UINT64_C(0x0004000000000000) | (f >> 2);
+        re = 0;
+      }
+
+      r = sign | (HEDLEY_STATIC_CAST(uint64_t, re) << 52) | f;
+    }
+
+    simde_memcpy(&rv, &r, sizeof(rv));
+    return rv;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vrecped_f64
+  #define vrecped_f64(a) simde_vrecped_f64((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x2_t
+simde_vrecpe_f32(simde_float32x2_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vrecpe_f32(a);
+  #else
+    simde_float32x2_private
+      r_,
+      a_ = simde_float32x2_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vrecpes_f32(a_.values[i]);
+    }
+
+    return simde_float32x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vrecpe_f32
+  #define vrecpe_f32(a) simde_vrecpe_f32((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64x1_t
+simde_vrecpe_f64(simde_float64x1_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vrecpe_f64(a);
+  #else
+    simde_float64x1_private
+      r_,
+      a_ = simde_float64x1_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vrecped_f64(a_.values[i]);
+    }
+
+    return simde_float64x1_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vrecpe_f64
+  #define vrecpe_f64(a) simde_vrecpe_f64((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x2_t
+simde_vrecpe_u32(simde_uint32x2_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vrecpe_u32(a);
+  #else
+    simde_uint32x2_private
+      r_,
+      a_ = simde_uint32x2_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = (a_.values[i] & UINT32_C(0x80000000)) ? (simde_x_arm_neon_recip_estimate(a_.values[i] >> 23) << 23) : UINT32_MAX;
+    }
+
+    return simde_uint32x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vrecpe_u32
+  #define vrecpe_u32(a) simde_vrecpe_u32((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x4_t
+simde_vrecpeq_f32(simde_float32x4_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vrecpeq_f32(a);
+  #elif defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_FAST_MATH)
+    return _mm_rcp14_ps(a);
+  #elif defined(SIMDE_X86_SSE_NATIVE) && defined(SIMDE_FAST_MATH)
+    return _mm_rcp_ps(a);
+  #else
+    #if defined(SIMDE_X86_SSE2_NATIVE)
+      /* When both the input and the result are normal, the estimate is
+       * the reciprocal of the midpoint of the input's 8-bit bucket,
+       * rounded to 8 fraction bits.  The exact quotient is never close
+       * enough to a rounding boundary for the division to disturb that. */
+      const __m128 mag = _mm_andnot_ps(_mm_set1_ps(-SIMDE_FLOAT32_C(0.0)), a);
+      const __m128 normal =
+        _mm_and_ps(
+          _mm_cmpge_ps(mag, _mm_castsi128_ps(_mm_set1_epi32(INT32_C(0x00800000)))),
+          _mm_cmplt_ps(mag, _mm_castsi128_ps(_mm_set1_epi32(INT32_C(0x7e800000)))));
+      if (HEDLEY_LIKELY(_mm_movemask_ps(normal) == 0xf)) {
+        const __m128i mid = _mm_or_si128(_mm_and_si128(_mm_castps_si128(a), _mm_set1_epi32(~INT32_C(0x7fff))), _mm_set1_epi32(INT32_C(0x4000)));
+        const __m128i q = _mm_castps_si128(_mm_div_ps(_mm_set1_ps(SIMDE_FLOAT32_C(1.0)), _mm_castsi128_ps(mid)));
+        return _mm_castsi128_ps(_mm_and_si128(_mm_add_epi32(q, _mm_set1_epi32(INT32_C(0x4000))), _mm_set1_epi32(~INT32_C(0x7fff))));
+      }
+    #endif
+
+    simde_float32x4_private
+      r_,
+      a_ = simde_float32x4_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vrecpes_f32(a_.values[i]);
+    }
+
+    return simde_float32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vrecpeq_f32
+  #define vrecpeq_f32(a) simde_vrecpeq_f32((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64x2_t
+simde_vrecpeq_f64(simde_float64x2_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vrecpeq_f64(a);
+  #elif defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_FAST_MATH)
+    return _mm_rcp14_pd(a);
+  #else
+    #if defined(SIMDE_X86_SSE2_NATIVE)
+      const __m128d mag = _mm_andnot_pd(_mm_set1_pd(-SIMDE_FLOAT64_C(0.0)), a);
+      const __m128d normal =
+        _mm_and_pd(
+          _mm_cmpge_pd(mag, _mm_castsi128_pd(_mm_set1_epi64x(INT64_C(0x0010000000000000)))),
+          _mm_cmplt_pd(mag, _mm_castsi128_pd(_mm_set1_epi64x(INT64_C(0x7fd0000000000000)))));
+      if (HEDLEY_LIKELY(_mm_movemask_pd(normal) == 0x3)) {
+        const __m128i mid = _mm_or_si128(_mm_and_si128(_mm_castpd_si128(a), _mm_set1_epi64x(~INT64_C(0x00000fffffffffff))), _mm_set1_epi64x(INT64_C(0x0000080000000000)));
+        const __m128i q = _mm_castpd_si128(_mm_div_pd(_mm_set1_pd(SIMDE_FLOAT64_C(1.0)), _mm_castsi128_pd(mid)));
+        return _mm_castsi128_pd(_mm_and_si128(_mm_add_epi64(q, _mm_set1_epi64x(INT64_C(0x0000080000000000))), _mm_set1_epi64x(~INT64_C(0x00000fffffffffff))));
+      }
+    #endif
+
+    simde_float64x2_private
+      r_,
+      a_ = simde_float64x2_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vrecped_f64(a_.values[i]);
+    }
+
+    return simde_float64x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vrecpeq_f64
+  #define vrecpeq_f64(a) simde_vrecpeq_f64((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_vrecpeq_u32(simde_uint32x4_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vrecpeq_u32(a);
+  #else
+    simde_uint32x4_private
+      r_,
+      a_ = simde_uint32x4_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = (a_.values[i] & UINT32_C(0x80000000)) ? (simde_x_arm_neon_recip_estimate(a_.values[i] >> 23) << 23) : UINT32_MAX;
+    }
+
+    return simde_uint32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vrecpeq_u32
+  #define vrecpeq_u32(a) simde_vrecpeq_u32((a))
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_ARM_NEON_RECPE_H) */
@@ -0,0 +1,305 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#if !defined(SIMDE_ARM_NEON_RSQRTE_H)
+#define SIMDE_ARM_NEON_RSQRTE_H
+
+#include "types.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* RecipSqrtEstimate() from the ARM pseudocode; a is 128..511,
+ * representing [0.25, 1.0), and the result is 256..511, representing
+ * [1.0, 2.0).  The reference loop searches upwards from 513 for the
+ * smallest c with a * c * c >= 2^28; a binary search finds the same c. */
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_x_arm_neon_rsqrt_estimate(uint32_t a) {
+  if (a < 256) {
+    a = (a * 2) + 1;
+  } else {
+    a = ((a & ~UINT32_C(1)) + 1) * 2;
+  }
+
+  uint32_t lo = 513, hi = 1024;
+  while (lo < hi) {
+    const uint32_t mid = (lo + hi) >> 1;
+    if ((a * mid * mid) >= (UINT32_C(1) << 28)) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+
+  return lo >> 1;
+}
+
+/* As with vrecpe, the portable implementations reproduce the AArch64
+ * results exactly and the x86 estimates need SIMDE_FAST_MATH. */
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32_t
+simde_vrsqrtes_f32(simde_float32_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vrsqrtes_f32(a);
+  #else
+    uint32_t v, r;
+    simde_float32_t rv;
+
+    simde_memcpy(&v, &a, sizeof(v));
+    const uint32_t mag = v & UINT32_C(0x7fffffff);
+
+    if (mag > UINT32_C(0x7f800000)) {
+      r = v | UINT32_C(0x00400000);
+    } else if (mag == 0) {
+      r = v | UINT32_C(0x7f800000);
+    } else if (v & UINT32_C(0x80000000)) {
+      r = UINT32_C(0x7fc00000);
+    } else if (mag == UINT32_C(0x7f800000)) {
+      r = 0;
+    } else {
+      int32_t e = HEDLEY_STATIC_CAST(int32_t, mag >> 23);
+      uint32_t f = mag & UINT32_C(0x007fffff);
+
+      if (e == 0) {
+        while (!(f & UINT32_C(0x00400000))) {
+          f <<= 1;
+          e--;
+        }
+        f = (f << 1) & UINT32_C(0x007fffff);
+      }
+
+      const uint32_t scaled = (HEDLEY_STATIC_CAST(uint32_t, e) & 1) ? (UINT32_C(128) | (f >> 16)) : (UINT32_C(256) | (f >> 15));
+      r =
+        (HEDLEY_STATIC_CAST(uint32_t, (380 - e) / 2) << 23) |
+        ((simde_x_arm_neon_rsqrt_estimate(scaled) & UINT32_C(0xff)) << 15);
+    }
+
+    simde_memcpy(&rv, &r, sizeof(rv));
+    return rv;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vrsqrtes_f32
+  #define vrsqrtes_f32(a) simde_vrsqrtes_f32((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64_t
+simde_vrsqrted_f64(simde_float64_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vrsqrted_f64(a);
+  #else
+    uint64_t v, r;
+    simde_float64_t rv;
+
+    simde_memcpy(&v, &a, sizeof(v));
+    const uint64_t mag = v & UINT64_C(0x7fffffffffffffff);
+
+    if (mag > UINT64_C(0x7ff0000000000000)) {
+      r = v | UINT64_C(0x0008000000000000);
+    } else if (mag == 0) {
+      r = v | UINT64_C(0x7ff0000000000000);
+    } else if (v & UINT64_C(0x8000000000000000)) {
+      r = UINT64_C(0x7ff8000000000000);
+    } else if (mag == UINT64_C(0x7ff0000000000000)) {
+      r = 0;
+    } else {
+      int32_t e = HEDLEY_STATIC_CAST(int32_t, mag >> 52);
+      uint64_t f = mag & UINT64_C(0x000fffffffffffff);
+
+      if (e == 0) {
+        while (!(f & UINT64_C(0x0008000000000000))) {
+          f <<= 1;
+          e--;
+        }
+        f = (f << 1) & UINT64_C(0x000fffffffffffff);
+      }
+
+      const uint32_t scaled = HEDLEY_STATIC_CAST(uint32_t, (HEDLEY_STATIC_CAST(uint32_t, e) & 1) ? (UINT64_C(128) | (f >> 45)) : (UINT64_C(256) | (f >> 44)));
+      r =
+        (HEDLEY_STATIC_CAST(uint64_t, (3068 - e) / 2) << 52) |
+        (HEDLEY_STATIC_CAST(uint64_t, simde_x_arm_neon_rsqrt_estimate(scaled) & UINT32_C(0xff)) << 44);
+    }
+
+    simde_memcpy(&rv, &r, sizeof(rv));
+    return rv;
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vrsqrted_f64
+  #define vrsqrted_f64(a) simde_vrsqrted_f64((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x2_t
+simde_vrsqrte_f32(simde_float32x2_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vrsqrte_f32(a);
+  #else
+    simde_float32x2_private
+      r_,
+      a_ = simde_float32x2_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vrsqrtes_f32(a_.values[i]);
+    }
+
+    return simde_float32x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vrsqrte_f32
+  #define vrsqrte_f32(a) simde_vrsqrte_f32((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64x1_t
+simde_vrsqrte_f64(simde_float64x1_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vrsqrte_f64(a);
+  #else
+    simde_float64x1_private
+      r_,
+      a_ = simde_float64x1_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vrsqrted_f64(a_.values[i]);
+    }
+
+    return simde_float64x1_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vrsqrte_f64
+  #define vrsqrte_f64(a) simde_vrsqrte_f64((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x2_t
+simde_vrsqrte_u32(simde_uint32x2_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vrsqrte_u32(a);
+  #else
+    simde_uint32x2_private
+      r_,
+      a_ = simde_uint32x2_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = (a_.values[i] >> 30) ? (simde_x_arm_neon_rsqrt_estimate(a_.values[i] >> 23) << 23) : UINT32_MAX;
+    }
+
+    return simde_uint32x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vrsqrte_u32
+  #define vrsqrte_u32(a) simde_vrsqrte_u32((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x4_t
+simde_vrsqrteq_f32(simde_float32x4_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vrsqrteq_f32(a);
+  #elif defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_FAST_MATH)
+    return _mm_rsqrt14_ps(a);
+  #elif defined(SIMDE_X86_SSE_NATIVE) && defined(SIMDE_FAST_MATH)
+    return _mm_rsqrt_ps(a);
+  #else
+    simde_float32x4_private
+      r_,
+      a_ = simde_float32x4_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vrsqrtes_f32(a_.values[i]);
+    }
+
+    return simde_float32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vrsqrteq_f32
+  #define vrsqrteq_f32(a) simde_vrsqrteq_f32((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64x2_t
+simde_vrsqrteq_f64(simde_float64x2_t a) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vrsqrteq_f64(a);
+  #elif defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_FAST_MATH)
+    return _mm_rsqrt14_pd(a);
+  #else
+    simde_float64x2_private
+      r_,
+      a_ = simde_float64x2_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vrsqrted_f64(a_.values[i]);
+    }
+
+    return simde_float64x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vrsqrteq_f64
+  #define vrsqrteq_f64(a) simde_vrsqrteq_f64((a))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_vrsqrteq_u32(simde_uint32x4_t a) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vrsqrteq_u32(a);
+  #else
+    simde_uint32x4_private
+      r_,
+      a_ = simde_uint32x4_to_private(a);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = (a_.values[i] >> 30) ? (simde_x_arm_neon_rsqrt_estimate(a_.values[i] >> 23) << 23) : UINT32_MAX;
+    }
+
+    return simde_uint32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vrsqrteq_u32
+  #define vrsqrteq_u32(a) simde_vrsqrteq_u32((a))
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_ARM_NEON_RSQRTE_H) */
@@ -0,0 +1,200 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#if !defined(SIMDE_ARM_NEON_RSQRTS_H)
+#define SIMDE_ARM_NEON_RSQRTS_H
+
+#include "types.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* Like vrecps this is fused, and infinity times zero produces 1.5. */
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32_t
+simde_vrsqrtss_f32(simde_float32_t a, simde_float32_t b) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vrsqrtss_f32(a, b);
+  #else
+    if ((simde_math_isinff(a) && (b == SIMDE_FLOAT32_C(0.0))) || ((a == SIMDE_FLOAT32_C(0.0)) && simde_math_isinff(b))) {
+      return SIMDE_FLOAT32_C(1.5);
+    }
+
+    #if defined(simde_math_fmaf)
+      return simde_math_fmaf(-a, b, SIMDE_FLOAT32_C(3.0)) * SIMDE_FLOAT32_C(0.5);
+    #else
+      return (SIMDE_FLOAT32_C(3.0) - (a * b)) * SIMDE_FLOAT32_C(0.5);
+    #endif
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vrsqrtss_f32
+  #define vrsqrtss_f32(a, b) simde_vrsqrtss_f32((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64_t
+simde_vrsqrtsd_f64(simde_float64_t a, simde_float64_t b) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vrsqrtsd_f64(a, b);
+  #else
+    if ((simde_math_isinf(a) && (b == SIMDE_FLOAT64_C(0.0))) || ((a == SIMDE_FLOAT64_C(0.0)) && simde_math_isinf(b))) {
+      return SIMDE_FLOAT64_C(1.5);
+    }
+
+    #if defined(simde_math_fma)
+      return simde_math_fma(-a, b, SIMDE_FLOAT64_C(3.0)) * SIMDE_FLOAT64_C(0.5);
+    #else
+      return (SIMDE_FLOAT64_C(3.0) - (a * b)) * SIMDE_FLOAT64_C(0.5);
+    #endif
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vrsqrtsd_f64
+  #define vrsqrtsd_f64(a, b) simde_vrsqrtsd_f64((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x2_t
+simde_vrsqrts_f32(simde_float32x2_t a, simde_float32x2_t b) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vrsqrts_f32(a, b);
+  #else
+    simde_float32x2_private
+      r_,
+      a_ = simde_float32x2_to_private(a),
+      b_ = simde_float32x2_to_private(b);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vrsqrtss_f32(a_.values[i], b_.values[i]);
+    }
+
+    return simde_float32x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vrsqrts_f32
+  #define vrsqrts_f32(a, b) simde_vrsqrts_f32((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64x1_t
+simde_vrsqrts_f64(simde_float64x1_t a, simde_float64x1_t b) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vrsqrts_f64(a, b);
+  #else
+    simde_float64x1_private
+      r_,
+      a_ = simde_float64x1_to_private(a),
+      b_ = simde_float64x1_to_private(b);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vrsqrtsd_f64(a_.values[i], b_.values[i]);
+    }
+
+    return simde_float64x1_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vrsqrts_f64
+  #define vrsqrts_f64(a, b) simde_vrsqrts_f64((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32x4_t
+simde_vrsqrtsq_f32(simde_float32x4_t a, simde_float32x4_t b) {
+  #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    return vrsqrtsq_f32(a, b);
+  #elif defined(SIMDE_X86_FMA_NATIVE)
+    __m128 r = _mm_mul_ps(_mm_fnmadd_ps(a, b, _mm_set1_ps(SIMDE_FLOAT32_C(3.0))), _mm_set1_ps(SIMDE_FLOAT32_C(0.5)));
+    #if !defined(SIMDE_FAST_NANS)
+      const __m128 three_halves = _mm_set1_ps(SIMDE_FLOAT32_C(1.5));
+      const __m128 inf_times_zero = _mm_andnot_ps(_mm_cmpunord_ps(a, b), _mm_cmpunord_ps(r, r));
+      r = _mm_or_ps(_mm_andnot_ps(inf_times_zero, r), _mm_and_ps(inf_times_zero, three_halves));
+    #endif
+    return r;
+  #elif defined(SIMDE_X86_SSE_NATIVE) && defined(SIMDE_FAST_MATH)
+    return _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(SIMDE_FLOAT32_C(3.0)), _mm_mul_ps(a, b)), _mm_set1_ps(SIMDE_FLOAT32_C(0.5)));
+  #else
+    simde_float32x4_private
+      r_,
+      a_ = simde_float32x4_to_private(a),
+      b_ = simde_float32x4_to_private(b);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vrsqrtss_f32(a_.values[i], b_.values[i]);
+    }
+
+    return simde_float32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
+  #undef vrsqrtsq_f32
+  #define vrsqrtsq_f32(a, b) simde_vrsqrtsq_f32((a), (b))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64x2_t
+simde_vrsqrtsq_f64(simde_float64x2_t a, simde_float64x2_t b) {
+  #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+    return vrsqrtsq_f64(a, b);
+  #elif defined(SIMDE_X86_FMA_NATIVE)
+    __m128d r = _mm_mul_pd(_mm_fnmadd_pd(a, b, _mm_set1_pd(SIMDE_FLOAT64_C(3.0))), _mm_set1_pd(SIMDE_FLOAT64_C(0.5)));
+    #if !defined(SIMDE_FAST_NANS)
+      const __m128d three_halves = _mm_set1_pd(SIMDE_FLOAT64_C(1.5));
+      const __m128d inf_times_zero = _mm_andnot_pd(_mm_cmpunord_pd(a, b), _mm_cmpunord_pd(r, r));
+      r = _mm_or_pd(_mm_andnot_pd(inf_times_zero, r), _mm_and_pd(inf_times_zero, three_halves));
+    #endif
+    return r;
+  #elif defined(SIMDE_X86_SSE2_NATIVE) && defined(SIMDE_FAST_MATH)
+    return _mm_mul_pd(_mm_sub_pd(_mm_set1_pd(SIMDE_FLOAT64_C(3.0)), _mm_mul_pd(a, b)), _mm_set1_pd(SIMDE_FLOAT64_C(0.5)));
+  #else
+    simde_float64x2_private
+      r_,
+      a_ = simde_float64x2_to_private(a),
+      b_ = simde_float64x2_to_private(b);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      r_.values[i] = simde_vrsqrtsd_f64(a_.values[i], b_.values[i]);
+    }
+
+    return simde_float64x2_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
+  #undef vrsqrtsq_f64
+  #define vrsqrtsq_f64(a, b) simde_vrsqrtsq_f64((a), (b))
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_ARM_NEON_RSQRTS_H) */
@@ -0,0 +1,255 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+/* The x86 SHA extensions keep A in the most significant element
+ * while ARMv8 keeps it in the least significant one, so the x86 paths
+ * reverse the elements on the way in and out.  SHA1RNDS4 also adds the
+ * round constant itself instead of expecting it in wk. */
+
+#if !defined(SIMDE_ARM_NEON_SHA1_H)
+#define SIMDE_ARM_NEON_SHA1_H
+
+#include "types.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_x_vsha1_rol_(uint32_t a, const int imm8) {
+  return HEDLEY_STATIC_CAST(uint32_t, (a << imm8) | (a >> (32 - imm8)));
+}
+
+#if defined(SIMDE_X86_SHA_NATIVE)
+SIMDE_FUNCTION_ATTRIBUTES
+__m128i
+simde_x_vsha1_rnds4_x86_(__m128i hash_abcd, uint32_t hash_e, __m128i wk, const int func, const uint32_t k) {
+  wk = _mm_sub_epi32(_mm_shuffle_epi32(wk, _MM_SHUFFLE(0, 1, 2, 3)), _mm_set1_epi32(HEDLEY_STATIC_CAST(int32_t, k)));
+  wk = _mm_add_epi32(wk, _mm_set_epi32(HEDLEY_STATIC_CAST(int32_t, hash_e), 0, 0, 0));
+  hash_abcd = _mm_shuffle_epi32(hash_abcd, _MM_SHUFFLE(0, 1, 2, 3));
+
+  switch (func) {
+    case 0: hash_abcd = _mm_sha1rnds4_epu32(hash_abcd, wk, 0); break;
+    case 1: hash_abcd = _mm_sha1rnds4_epu32(hash_abcd, wk, 1); break;
+    default: hash_abcd = _mm_sha1rnds4_epu32(hash_abcd, wk, 2); break;
+  }
+
+  return _mm_shuffle_epi32(hash_abcd, _MM_SHUFFLE(0, 1, 2, 3));
+}
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_vsha1h_u32(uint32_t hash_e) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
+    return vsha1h_u32(hash_e);
+  #else
+    return simde_x_vsha1_rol_(hash_e, 30);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_SHA2))
+  #undef vsha1h_u32
+  #define vsha1h_u32(hash_e) simde_vsha1h_u32((hash_e))
+#endif
+
+/* The round functions are written without branches or lookups so that
+ * the portable versions run in constant time. */
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_vsha1cq_u32(simde_uint32x4_t hash_abcd, uint32_t hash_e, simde_uint32x4_t wk) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
+    return vsha1cq_u32(hash_abcd, hash_e, wk);
+  #elif defined(SIMDE_X86_SHA_NATIVE)
+    return simde_x_vsha1_rnds4_x86_(hash_abcd, hash_e, wk, 0, UINT32_C(0x5a827999));
+  #else
+    simde_uint32x4_private
+      r_,
+      wk_ = simde_uint32x4_to_private(wk);
+    uint32_t e = hash_e;
+
+    r_ = simde_uint32x4_to_private(hash_abcd);
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      const uint32_t
+        a = r_.values[0],
+        b = r_.values[1],
+        c = r_.values[2],
+        d = r_.values[3];
+
+      e += (d ^ (b & (c ^ d))) + simde_x_vsha1_rol_(a, 5) + wk_.values[i];
+      r_.values[3] = c;
+      r_.values[2] = simde_x_vsha1_rol_(b, 30);
+      r_.values[1] = a;
+      r_.values[0] = e;
+      e = d;
+    }
+
+    return simde_uint32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_SHA2))
+  #undef vsha1cq_u32
+  #define vsha1cq_u32(hash_abcd, hash_e, wk) simde_vsha1cq_u32((hash_abcd), (hash_e), (wk))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_vsha1pq_u32(simde_uint32x4_t hash_abcd, uint32_t hash_e, simde_uint32x4_t wk) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
+    return vsha1pq_u32(hash_abcd, hash_e, wk);
+  #elif defined(SIMDE_X86_SHA_NATIVE)
+    return simde_x_vsha1_rnds4_x86_(hash_abcd, hash_e, wk, 1, UINT32_C(0x6ed9eba1));
+  #else
+    simde_uint32x4_private
+      r_,
+      wk_ = simde_uint32x4_to_private(wk);
+    uint32_t e = hash_e;
+
+    r_ = simde_uint32x4_to_private(hash_abcd);
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      const uint32_t
+        a = r_.values[0],
+        b = r_.values[1],
+        c = r_.values[2],
+        d = r_.values[3];
+
+      e += (b ^ c ^ d) + simde_x_vsha1_rol_(a, 5) + wk_.values[i];
+      r_.values[3] = c;
+      r_.values[2] = simde_x_vsha1_rol_(b, 30);
+      r_.values[1] = a;
+      r_.values[0] = e;
+      e = d;
+    }
+
+    return simde_uint32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_SHA2))
+  #undef vsha1pq_u32
+  #define vsha1pq_u32(hash_abcd, hash_e, wk) simde_vsha1pq_u32((hash_abcd), (hash_e), (wk))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_vsha1mq_u32(simde_uint32x4_t hash_abcd, uint32_t hash_e, simde_uint32x4_t wk) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
+    return vsha1mq_u32(hash_abcd, hash_e, wk);
+  #elif defined(SIMDE_X86_SHA_NATIVE)
+    return simde_x_vsha1_rnds4_x86_(hash_abcd, hash_e, wk, 2, UINT32_C(0x8f1bbcdc));
+  #else
+    simde_uint32x4_private
+      r_,
+      wk_ = simde_uint32x4_to_private(wk);
+    uint32_t e = hash_e;
+
+    r_ = simde_uint32x4_to_private(hash_abcd);
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      const uint32_t
+        a = r_.values[0],
+        b = r_.values[1],
+        c = r_.values[2],
+        d = r_.values[3];
+
+      e += ((b & c) | (d & (b | c))) + simde_x_vsha1_rol_(a, 5) + wk_.values[i];
+      r_.values[3] = c;
+      r_.values[2] = simde_x_vsha1_rol_(b, 30);
+      r_.values[1] = a;
+      r_.values[0] = e;
+      e = d;
+    }
+
+    return simde_uint32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_SHA2))
+  #undef vsha1mq_u32
+  #define vsha1mq_u32(hash_abcd, hash_e, wk) simde_vsha1mq_u32((hash_abcd), (hash_e), (wk))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_vsha1su0q_u32(simde_uint32x4_t w0_3, simde_uint32x4_t w4_7, simde_uint32x4_t w8_11) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
+    return vsha1su0q_u32(w0_3, w4_7, w8_11);
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    return _mm_xor_si128(_mm_xor_si128(w0_3, w8_11), _mm_castpd_si128(_mm_shuffle_pd(_mm_castsi128_pd(w0_3), _mm_castsi128_pd(w4_7), 1)));
+  #else
+    simde_uint32x4_private
+      r_,
+      w0_3_ = simde_uint32x4_to_private(w0_3),
+      w4_7_ = simde_uint32x4_to_private(w4_7),
+      w8_11_ = simde_uint32x4_to_private(w8_11);
+
+    r_.values[0] = w0_3_.values[0] ^ w0_3_.values[2] ^ w8_11_.values[0];
+    r_.values[1] = w0_3_.values[1] ^ w0_3_.values[3] ^ w8_11_.values[1];
+    r_.values[2] = w0_3_.values[2] ^ w4_7_.values[0] ^ w8_11_.values[2];
+    r_.values[3] = w0_3_.values[3] ^ w4_7_.values[1] ^ w8_11_.values[3];
+
+    return simde_uint32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_SHA2))
+  #undef vsha1su0q_u32
+  #define vsha1su0q_u32(w0_3, w4_7, w8_11) simde_vsha1su0q_u32((w0_3), (w4_7), (w8_11))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_vsha1su1q_u32(simde_uint32x4_t tw0_3, simde_uint32x4_t w12_15) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
+    return vsha1su1q_u32(tw0_3, w12_15);
+  #elif defined(SIMDE_X86_SHA_NATIVE)
+    return
+      _mm_shuffle_epi32(
+        _mm_sha1msg2_epu32(
+          _mm_shuffle_epi32(tw0_3, _MM_SHUFFLE(0, 1, 2, 3)),
+          _mm_shuffle_epi32(w12_15, _MM_SHUFFLE(0, 1, 2, 3))
+        ),
+        _MM_SHUFFLE(0, 1, 2, 3)
+      );
+  #else
+    simde_uint32x4_private
+      r_,
+      tw0_3_ = simde_uint32x4_to_private(tw0_3),
+      w12_15_ = simde_uint32x4_to_private(w12_15);
+
+    r_.values[0] = simde_x_vsha1_rol_(tw0_3_.values[0] ^ w12_15_.values[1], 1);
+    r_.values[1] = simde_x_vsha1_rol_(tw0_3_.values[1] ^ w12_15_.values[2], 1);
+    r_.values[2] = simde_x_vsha1_rol_(tw0_3_.values[2] ^ w12_15_.values[3], 1);
+    r_.values[3] = simde_x_vsha1_rol_(tw0_3_.values[3] ^ r_.values[0], 1);
+
+    return simde_uint32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_SHA2))
+  #undef vsha1su1q_u32
+  #define vsha1su1q_u32(tw0_3, w12_15) simde_vsha1su1q_u32((tw0_3), (w12_15))
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_ARM_NEON_SHA1_H) */
@@ -0,0 +1,201 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+/* SHA256RNDS2 works on the state split into ABEF and CDGH (with A in
+ * the most significant element) and only does two rounds, so the x86
+ * versions of vsha256hq/vsha256h2q shuffle the state, run it twice,
+ * and shuffle it back.  Like the ARM code they replace, both compute
+ * the same four rounds and each returns half of the new state. */
+
+#if !defined(SIMDE_ARM_NEON_SHA256_H)
+#define SIMDE_ARM_NEON_SHA256_H
+
+#include "types.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_x_vsha256_ror_(uint32_t a, const int imm8) {
+  return HEDLEY_STATIC_CAST(uint32_t, (a >> imm8) | (a << (32 - imm8)));
+}
+
+/* Four rounds of SHA-256, updating abcd and efgh in place. */
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_vsha256_rounds_(simde_uint32x4_private* abcd, simde_uint32x4_private* efgh, const simde_uint32x4_private* wk) {
+  uint32_t
+    a = abcd->values[0], b = abcd->values[1], c = abcd->values[2], d = abcd->values[3],
+    e = efgh->values[0], f = efgh->values[1], g = efgh->values[2], h = efgh->values[3];
+
+  for (size_t i = 0 ; i < (sizeof(wk->values) / sizeof(wk->values[0])) ; i++) {
+    const uint32_t t1 =
+      h + wk->values[i] + (g ^ (e & (f ^ g))) +
+      (simde_x_vsha256_ror_(e, 6) ^ simde_x_vsha256_ror_(e, 11) ^ simde_x_vsha256_ror_(e, 25));
+    const uint32_t t2 =
+      ((a & b) | (c & (a | b))) +
+      (simde_x_vsha256_ror_(a, 2) ^ simde_x_vsha256_ror_(a, 13) ^ simde_x_vsha256_ror_(a, 22));
+
+    h = g;
+    g = f;
+    f = e;
+    e = d + t1;
+    d = c;
+    c = b;
+    b = a;
+    a = t1 + t2;
+  }
+
+  abcd->values[0] = a; abcd->values[1] = b; abcd->values[2] = c; abcd->values[3] = d;
+  efgh->values[0] = e; efgh->values[1] = f; efgh->values[2] = g; efgh->values[3] = h;
+}
+
+#if defined(SIMDE_X86_SHA_NATIVE)
+/* Returns the new ABEF after four rounds; *abef_mid receives the ABEF
+ * from after the first two rounds, which holds the new C, D, G and H. */
+SIMDE_FUNCTION_ATTRIBUTES
+__m128i
+simde_x_vsha256_rnds4_x86_(__m128i hash_abcd, __m128i hash_efgh, __m128i wk, __m128i* abef_mid) {
+  const __m128i abef = _mm_shuffle_epi32(_mm_unpacklo_epi64(hash_efgh, hash_abcd), _MM_SHUFFLE(2, 3, 0, 1));
+  const __m128i cdgh = _mm_shuffle_epi32(_mm_unpackhi_epi64(hash_efgh, hash_abcd), _MM_SHUFFLE(2, 3, 0, 1));
+
+  *abef_mid = _mm_sha256rnds2_epu32(cdgh, abef, wk);
+  return _mm_sha256rnds2_epu32(abef, *abef_mid, _mm_unpackhi_epi64(wk, wk));
+}
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_vsha256hq_u32(simde_uint32x4_t hash_abcd, simde_uint32x4_t hash_efgh, simde_uint32x4_t wk) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
+    return vsha256hq_u32(hash_abcd, hash_efgh, wk);
+  #elif defined(SIMDE_X86_SHA_NATIVE)
+    __m128i abef_mid;
+    const __m128i abef = simde_x_vsha256_rnds4_x86_(hash_abcd, hash_efgh, wk, &abef_mid);
+    return _mm_shuffle_epi32(_mm_unpackhi_epi64(abef, abef_mid), _MM_SHUFFLE(2, 3, 0, 1));
+  #else
+    simde_uint32x4_private
+      abcd_ = simde_uint32x4_to_private(hash_abcd),
+      efgh_ = simde_uint32x4_to_private(hash_efgh),
+      wk_ = simde_uint32x4_to_private(wk);
+
+    simde_x_vsha256_rounds_(&abcd_, &efgh_, &wk_);
+
+    return simde_uint32x4_from_private(abcd_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_SHA2))
+  #undef vsha256hq_u32
+  #define vsha256hq_u32(hash_abcd, hash_efgh, wk) simde_vsha256hq_u32((hash_abcd), (hash_efgh), (wk))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_vsha256h2q_u32(simde_uint32x4_t hash_efgh, simde_uint32x4_t hash_abcd, simde_uint32x4_t wk) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
+    return vsha256h2q_u32(hash_efgh, hash_abcd, wk);
+  #elif defined(SIMDE_X86_SHA_NATIVE)
+    __m128i abef_mid;
+    const __m128i abef = simde_x_vsha256_rnds4_x86_(hash_abcd, hash_efgh, wk, &abef_mid);
+    return _mm_shuffle_epi32(_mm_unpacklo_epi64(abef, abef_mid), _MM_SHUFFLE(2, 3, 0, 1));
+  #else
+    simde_uint32x4_private
+      abcd_ = simde_uint32x4_to_private(hash_abcd),
+      efgh_ = simde_uint32x4_to_private(hash_efgh),
+      wk_ = simde_uint32x4_to_private(wk);
+
+    simde_x_vsha256_rounds_(&abcd_, &efgh_, &wk_);
+
+    return simde_uint32x4_from_private(efgh_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_SHA2))
+  #undef vsha256h2q_u32
+  #define vsha256h2q_u32(hash_efgh, hash_abcd, wk) simde_vsha256h2q_u32((hash_efgh), (hash_abcd), (wk))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_vsha256su0q_u32(simde_uint32x4_t w0_3, simde_uint32x4_t w4_7) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
+    return vsha256su0q_u32(w0_3, w4_7);
+  #elif defined(SIMDE_X86_SHA_NATIVE)
+    return _mm_sha256msg1_epu32(w0_3, w4_7);
+  #else
+    simde_uint32x4_private
+      r_,
+      w0_3_ = simde_uint32x4_to_private(w0_3),
+      w4_7_ = simde_uint32x4_to_private(w4_7);
+
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      const uint32_t x = (i < 3) ? w0_3_.values[i + 1] : w4_7_.values[0];
+      r_.values[i] = w0_3_.values[i] + (simde_x_vsha256_ror_(x, 7) ^ simde_x_vsha256_ror_(x, 18) ^ (x >> 3));
+    }
+
+    return simde_uint32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_SHA2))
+  #undef vsha256su0q_u32
+  #define vsha256su0q_u32(w0_3, w4_7) simde_vsha256su0q_u32((w0_3), (w4_7))
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_uint32x4_t
+simde_vsha256su1q_u32(simde_uint32x4_t tw0_3, simde_uint32x4_t w8_11, simde_uint32x4_t w12_15) {
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
+    return vsha256su1q_u32(tw0_3, w8_11, w12_15);
+  #elif defined(SIMDE_X86_SHA_NATIVE)
+    const __m128i w9_12 = _mm_or_si128(_mm_srli_si128(w8_11, 4), _mm_slli_si128(w12_15, 12));
+    return _mm_sha256msg2_epu32(_mm_add_epi32(tw0_3, w9_12), w12_15);
+  #else
+    simde_uint32x4_private
+      r_,
+      tw0_3_ = simde_uint32x4_to_private(tw0_3),
+      w8_11_ = simde_uint32x4_to_private(w8_11),
+      w12_15_ = simde_uint32x4_to_private(w12_15);
+
+    /* The last two elements depend on the first two results. */
+    for (size_t i = 0 ; i < (sizeof(r_.values) / sizeof(r_.values[0])) ; i++) {
+      const uint32_t x = (i < 2) ? w12_15_.values[i + 2] : r_.values[i - 2];
+      const uint32_t w = (i < 3) ? w8_11_.values[i + 1] : w12_15_.values[0];
+      r_.values[i] = tw0_3_.values[i] + w + (simde_x_vsha256_ror_(x, 17) ^ simde_x_vsha256_ror_(x, 19) ^ (x >> 10));
+    }
+
+    return simde_uint32x4_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_ARM_NEON_A32V8_ENABLE_NATIVE_ALIASES) || (defined(SIMDE_ENABLE_NATIVE_ALIASES) && !defined(__ARM_FEATURE_SHA2))
+  #undef vsha256su1q_u32
+  #define vsha256su1q_u32(tw0_3, w8_11, w12_15) simde_vsha256su1q_u32((tw0_3), (w8_11), (w12_15))
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_ARM_NEON_SHA256_H) */
@@ -232,13 +232,41 @@ void
 simde_vst3q_f32(simde_float32_t *ptr, simde_float32x4x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3q_f32(ptr, val);
+  #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+    wasm_v128_store(ptr, wasm_v32x4_shuffle(wasm_v32x4_shuffle(val.val[0], val.val[1], 0, 4, 0, 1), val.val[2], 0, 1, 4, 3));
+    wasm_v128_store(ptr + 4, wasm_v32x4_shuffle(wasm_v32x4_shuffle(val.val[0], val.val[1], 5, 0, 2, 6), val.val[2], 0, 5, 2, 3));
+    wasm_v128_store(ptr + 8, wasm_v32x4_shuffle(wasm_v32x4_shuffle(val.val[0], val.val[1], 0, 3, 7, 0), val.val[2], 6, 1, 2, 7));
+  #elif defined(SIMDE_X86_SSE_NATIVE)
+    const __m128
+      v0 = val.val[0],
+      v1 = val.val[1],
+      v2 = val.val[2],
+      lo = _mm_unpacklo_ps(v0, v1),
+      hi = _mm_unpackhi_ps(v0, v1);
+    _mm_storeu_ps(ptr, _mm_shuffle_ps(lo, _mm_shuffle_ps(v2, v0, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0)));
+    _mm_storeu_ps(ptr + 4, _mm_shuffle_ps(_mm_shuffle_ps(v1, v2, _MM_SHUFFLE(1, 1, 1, 1)), hi, _MM_SHUFFLE(1, 0, 2, 0)));
+    _mm_storeu_ps(ptr + 8, _mm_shuffle_ps(_mm_shuffle_ps(v2, hi, _MM_SHUFFLE(2, 2, 2, 2)), _mm_shuffle_ps(hi, v2, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
   #else
-    simde_float32_t buf[12];
     simde_float32x4_private a_[3] = { simde_float32x4_to_private(val.val[0]), simde_float32x4_to_private(val.val[1]), simde_float32x4_to_private(val.val[2]) };
-    for (size_t i = 0; i < (sizeof(val.val[0]) / sizeof(*ptr)) * 3 ; i++) {
-      buf[i] = a_[i % 3].values[i / 3];
-    }
-    simde_memcpy(ptr, buf, sizeof(buf));
+
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_float32x4_private r_;
+      r_.values = SIMDE_SHUFFLE_VECTOR_(32, 16, a_[0].values, a_[1].values, 0, 4, 0, 1);
+      r_.values = SIMDE_SHUFFLE_VECTOR_(32, 16, r_.values, a_[2].values, 0, 1, 4, 3);
+      simde_vst1q_f32(ptr, simde_float32x4_from_private(r_));
+      r_.values = SIMDE_SHUFFLE_VECTOR_(32, 16, a_[0].values, a_[1].values, 5, 0, 2, 6);
+      r_.values = SIMDE_SHUFFLE_VECTOR_(32, 16, r_.values, a_[2].values, 0, 5, 2, 3);
+      simde_vst1q_f32(ptr + 4, simde_float32x4_from_private(r_));
+      r_.values = SIMDE_SHUFFLE_VECTOR_(32, 16, a_[0].values, a_[1].values, 0, 3, 7, 0);
+      r_.values = SIMDE_SHUFFLE_VECTOR_(32, 16, r_.values, a_[2].values, 6, 1, 2, 7);
+      simde_vst1q_f32(ptr + 8, simde_float32x4_from_private(r_));
+    #else
+      simde_float32_t buf[12];
+      for (size_t i = 0; i < (sizeof(val.val[0]) / sizeof(*ptr)) * 3 ; i++) {
+        buf[i] = a_[i % 3].values[i / 3];
+      }
+      simde_memcpy(ptr, buf, sizeof(buf));
+    #endif
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
@@ -251,13 +279,36 @@ void
 simde_vst3q_f64(simde_float64_t *ptr, simde_float64x2x3_t val) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     vst3q_f64(ptr, val);
+  #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+    wasm_v128_store(ptr, wasm_v64x2_shuffle(val.val[0], val.val[1], 0, 2));
+    wasm_v128_store(ptr + 2, wasm_v64x2_shuffle(val.val[0], val.val[2], 2, 1));
+    wasm_v128_store(ptr + 4, wasm_v64x2_shuffle(val.val[1], val.val[2], 1, 3));
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    const __m128d
+      v0 = val.val[0],
+      v1 = val.val[1],
+      v2 = val.val[2];
+    _mm_storeu_pd(ptr, _mm_shuffle_pd(v0, v1, 0));
+    _mm_storeu_pd(ptr + 2, _mm_shuffle_pd(v2, v0, 2));
+    _mm_storeu_pd(ptr + 4, _mm_shuffle_pd(v1, v2, 3));
   #else
-    simde_float64_t buf[6];
     simde_float64x2_private a_[3] = { simde_float64x2_to_private(val.val[0]), simde_float64x2_to_private(val.val[1]), simde_float64x2_to_private(val.val[2]) };
-    for (size_t i = 0; i < (sizeof(val.val[0]) / sizeof(*ptr)) * 3 ; i++) {
-      buf[i] = a_[i % 3].values[i / 3];
-    }
-    simde_memcpy(ptr, buf, sizeof(buf));
+
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_float64x2_private r_;
+      r_.values = SIMDE_SHUFFLE_VECTOR_(64, 16, a_[0].values, a_[1].values, 0, 2);
+      simde_vst1q_f64(ptr, simde_float64x2_from_private(r_));
+      r_.values = SIMDE_SHUFFLE_VECTOR_(64, 16, a_[0].values, a_[2].values, 2, 1);
+      simde_vst1q_f64(ptr + 2, simde_float64x2_from_private(r_));
+      r_.values = SIMDE_SHUFFLE_VECTOR_(64, 16, a_[1].values, a_[2].values, 1, 3);
+      simde_vst1q_f64(ptr + 4, simde_float64x2_from_private(r_));
+    #else
+      simde_float64_t buf[6];
+      for (size_t i = 0; i < (sizeof(val.val[0]) / sizeof(*ptr)) * 3 ; i++) {
+        buf[i] = a_[i % 3].values[i / 3];
+      }
+      simde_memcpy(ptr, buf, sizeof(buf));
+    #endif
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
@@ -270,13 +321,52 @@ void
 simde_vst3q_s8(int8_t *ptr, simde_int8x16x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3q_s8(ptr, val);
+  #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+    wasm_v128_store(ptr, wasm_v8x16_shuffle(wasm_v8x16_shuffle(val.val[0], val.val[1], 0, 16, 0, 1, 17, 0, 2, 18, 0, 3, 19, 0, 4, 20, 0, 5), val.val[2], 0, 1, 16, 3, 4, 17, 6, 7, 18, 9, 10, 19, 12, 13, 20, 15));
+    wasm_v128_store(ptr + 16, wasm_v8x16_shuffle(wasm_v8x16_shuffle(val.val[0], val.val[1], 21, 0, 6, 22, 0, 7, 23, 0, 8, 24, 0, 9, 25, 0, 10, 26), val.val[2], 0, 21, 2, 3, 22, 5, 6, 23, 8, 9, 24, 11, 12, 25, 14, 15));
+    wasm_v128_store(ptr + 32, wasm_v8x16_shuffle(wasm_v8x16_shuffle(val.val[0], val.val[1], 0, 11, 27, 0, 12, 28, 0, 13, 29, 0, 14, 30, 0, 15, 31, 0), val.val[2], 26, 1, 2, 27, 4, 5, 28, 7, 8, 29, 10, 11, 30, 13, 14, 31));
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    /* Each output block takes lanes from all three inputs; pshufb
+     * zeroes the lanes an input does not supply before ORing. */
+    _mm_storeu_si128(SIMDE_ALIGN_CAST(__m128i*, ptr),
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(val.val[0], _mm_setr_epi8(0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1, 5)),
+          _mm_shuffle_epi8(val.val[1], _mm_setr_epi8(-1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1))),
+        _mm_shuffle_epi8(val.val[2], _mm_setr_epi8(-1, -1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1))));
+    _mm_storeu_si128(SIMDE_ALIGN_CAST(__m128i*, ptr + 16),
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(val.val[0], _mm_setr_epi8(-1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10, -1)),
+          _mm_shuffle_epi8(val.val[1], _mm_setr_epi8(5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10))),
+        _mm_shuffle_epi8(val.val[2], _mm_setr_epi8(-1, 5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1))));
+    _mm_storeu_si128(SIMDE_ALIGN_CAST(__m128i*, ptr + 32),
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(val.val[0], _mm_setr_epi8(-1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1, -1)),
+          _mm_shuffle_epi8(val.val[1], _mm_setr_epi8(-1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1))),
+        _mm_shuffle_epi8(val.val[2], _mm_setr_epi8(10, -1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15))));
   #else
-    int8_t buf[48];
     simde_int8x16_private a_[3] = { simde_int8x16_to_private(val.val[0]), simde_int8x16_to_private(val.val[1]), simde_int8x16_to_private(val.val[2]) };
-    for (size_t i = 0; i < (sizeof(val.val[0]) / sizeof(*ptr)) * 3 ; i++) {
-      buf[i] = a_[i % 3].values[i / 3];
-    }
-    simde_memcpy(ptr, buf, sizeof(buf));
+
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_int8x16_private r_;
+      r_.values = SIMDE_SHUFFLE_VECTOR_(8, 16, a_[0].values, a_[1].values, 0, 16, 0, 1, 17, 0, 2, 18, 0, 3, 19, 0, 4, 20, 0, 5);
+      r_.values = SIMDE_SHUFFLE_VECTOR_(8, 16, r_.values, a_[2].values, 0, 1, 16, 3, 4, 17, 6, 7, 18, 9, 10, 19, 12, 13, 20, 15);
+      simde_vst1q_s8(ptr, simde_int8x16_from_private(r_));
+      r_.values = SIMDE_SHUFFLE_VECTOR_(8, 16, a_[0].values, a_[1].values, 21, 0, 6, 22, 0, 7, 23, 0, 8, 24, 0, 9, 25, 0, 10, 26);
+      r_.values = SIMDE_SHUFFLE_VECTOR_(8, 16, r_.values, a_[2].values, 0, 21, 2, 3, 22, 5, 6, 23, 8, 9, 24, 11, 12, 25, 14, 15);
+      simde_vst1q_s8(ptr + 16, simde_int8x16_from_private(r_));
+      r_.values = SIMDE_SHUFFLE_VECTOR_(8, 16, a_[0].values, a_[1].values, 0, 11, 27, 0, 12, 28, 0, 13, 29, 0, 14, 30, 0, 15, 31, 0);
+      r_.values = SIMDE_SHUFFLE_VECTOR_(8, 16, r_.values, a_[2].values, 26, 1, 2, 27, 4, 5, 28, 7, 8, 29, 10, 11, 30, 13, 14, 31);
+      simde_vst1q_s8(ptr + 32, simde_int8x16_from_private(r_));
+    #else
+      int8_t buf[48];
+      for (size_t i = 0; i < (sizeof(val.val[0]) / sizeof(*ptr)) * 3 ; i++) {
+        buf[i] = a_[i % 3].values[i / 3];
+      }
+      simde_memcpy(ptr, buf, sizeof(buf));
+    #endif
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
@@ -289,13 +379,50 @@ void
 simde_vst3q_s16(int16_t *ptr, simde_int16x8x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3q_s16(ptr, val);
+  #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+    wasm_v128_store(ptr, wasm_v16x8_shuffle(wasm_v16x8_shuffle(val.val[0], val.val[1], 0, 8, 0, 1, 9, 0, 2, 10), val.val[2], 0, 1, 8, 3, 4, 9, 6, 7));
+    wasm_v128_store(ptr + 8, wasm_v16x8_shuffle(wasm_v16x8_shuffle(val.val[0], val.val[1], 0, 3, 11, 0, 4, 12, 0, 5), val.val[2], 10, 1, 2, 11, 4, 5, 12, 7));
+    wasm_v128_store(ptr + 16, wasm_v16x8_shuffle(wasm_v16x8_shuffle(val.val[0], val.val[1], 13, 0, 6, 14, 0, 7, 15, 0), val.val[2], 0, 13, 2, 3, 14, 5, 6, 15));
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    _mm_storeu_si128(SIMDE_ALIGN_CAST(__m128i*, ptr),
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(val.val[0], _mm_setr_epi8(0, 1, -1, -1, -1, -1, 2, 3, -1, -1, -1, -1, 4, 5, -1, -1)),
+          _mm_shuffle_epi8(val.val[1], _mm_setr_epi8(-1, -1, 0, 1, -1, -1, -1, -1, 2, 3, -1, -1, -1, -1, 4, 5))),
+        _mm_shuffle_epi8(val.val[2], _mm_setr_epi8(-1, -1, -1, -1, 0, 1, -1, -1, -1, -1, 2, 3, -1, -1, -1, -1))));
+    _mm_storeu_si128(SIMDE_ALIGN_CAST(__m128i*, ptr + 8),
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(val.val[0], _mm_setr_epi8(-1, -1, 6, 7, -1, -1, -1, -1, 8, 9, -1, -1, -1, -1, 10, 11)),
+          _mm_shuffle_epi8(val.val[1], _mm_setr_epi8(-1, -1, -1, -1, 6, 7, -1, -1, -1, -1, 8, 9, -1, -1, -1, -1))),
+        _mm_shuffle_epi8(val.val[2], _mm_setr_epi8(4, 5, -1, -1, -1, -1, 6, 7, -1, -1, -1, -1, 8, 9, -1, -1))));
+    _mm_storeu_si128(SIMDE_ALIGN_CAST(__m128i*, ptr + 16),
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(val.val[0], _mm_setr_epi8(-1, -1, -1, -1, 12, 13, -1, -1, -1, -1, 14, 15, -1, -1, -1, -1)),
+          _mm_shuffle_epi8(val.val[1], _mm_setr_epi8(10, 11, -1, -1, -1, -1, 12, 13, -1, -1, -1, -1, 14, 15, -1, -1))),
+        _mm_shuffle_epi8(val.val[2], _mm_setr_epi8(-1, -1, 10, 11, -1, -1, -1, -1, 12, 13, -1, -1, -1, -1, 14, 15))));
   #else
-    int16_t buf[24];
     simde_int16x8_private a_[3] = { simde_int16x8_to_private(val.val[0]), simde_int16x8_to_private(val.val[1]), simde_int16x8_to_private(val.val[2]) };
-    for (size_t i = 0; i < (sizeof(val.val[0]) / sizeof(*ptr)) * 3 ; i++) {
-      buf[i] = a_[i % 3].values[i / 3];
-    }
-    simde_memcpy(ptr, buf, sizeof(buf));
+
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_int16x8_private r_;
+      r_.values = SIMDE_SHUFFLE_VECTOR_(16, 16, a_[0].values, a_[1].values, 0, 8, 0, 1, 9, 0, 2, 10);
+      r_.values = SIMDE_SHUFFLE_VECTOR_(16, 16, r_.values, a_[2].values, 0, 1, 8, 3, 4, 9, 6, 7);
+      simde_vst1q_s16(ptr, simde_int16x8_from_private(r_));
+      r_.values = SIMDE_SHUFFLE_VECTOR_(16, 16, a_[0].values, a_[1].values, 0, 3, 11, 0, 4, 12, 0, 5);
+      r_.values = SIMDE_SHUFFLE_VECTOR_(16, 16, r_.values, a_[2].values, 10, 1, 2, 11, 4, 5, 12, 7);
+      simde_vst1q_s16(ptr + 8, simde_int16x8_from_private(r_));
+      r_.values = SIMDE_SHUFFLE_VECTOR_(16, 16, a_[0].values, a_[1].values, 13, 0, 6, 14, 0, 7, 15, 0);
+      r_.values = SIMDE_SHUFFLE_VECTOR_(16, 16, r_.values, a_[2].values, 0, 13, 2, 3, 14, 5, 6, 15);
+      simde_vst1q_s16(ptr + 16, simde_int16x8_from_private(r_));
+    #else
+      int16_t buf[24];
+      for (size_t i = 0; i < (sizeof(val.val[0]) / sizeof(*ptr)) * 3 ; i++) {
+        buf[i] = a_[i % 3].values[i / 3];
+      }
+      simde_memcpy(ptr, buf, sizeof(buf));
+    #endif
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
@@ -308,13 +435,41 @@ void
 simde_vst3q_s32(int32_t *ptr, simde_int32x4x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3q_s32(ptr, val);
+  #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+    wasm_v128_store(ptr, wasm_v32x4_shuffle(wasm_v32x4_shuffle(val.val[0], val.val[1], 0, 4, 0, 1), val.val[2], 0, 1, 4, 3));
+    wasm_v128_store(ptr + 4, wasm_v32x4_shuffle(wasm_v32x4_shuffle(val.val[0], val.val[1], 5, 0, 2, 6), val.val[2], 0, 5, 2, 3));
+    wasm_v128_store(ptr + 8, wasm_v32x4_shuffle(wasm_v32x4_shuffle(val.val[0], val.val[1], 0, 3, 7, 0), val.val[2], 6, 1, 2, 7));
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    const __m128
+      v0 = _mm_castsi128_ps(val.val[0]),
+      v1 = _mm_castsi128_ps(val.val[1]),
+      v2 = _mm_castsi128_ps(val.val[2]),
+      lo = _mm_unpacklo_ps(v0, v1),
+      hi = _mm_unpackhi_ps(v0, v1);
+    _mm_storeu_ps(HEDLEY_REINTERPRET_CAST(float*, ptr), _mm_shuffle_ps(lo, _mm_shuffle_ps(v2, v0, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0)));
+    _mm_storeu_ps(HEDLEY_REINTERPRET_CAST(float*, ptr + 4), _mm_shuffle_ps(_mm_shuffle_ps(v1, v2, _MM_SHUFFLE(1, 1, 1, 1)), hi, _MM_SHUFFLE(1, 0, 2, 0)));
+    _mm_storeu_ps(HEDLEY_REINTERPRET_CAST(float*, ptr + 8), _mm_shuffle_ps(_mm_shuffle_ps(v2, hi, _MM_SHUFFLE(2, 2, 2, 2)), _mm_shuffle_ps(hi, v2, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
   #else
-    int32_t buf[12];
     simde_int32x4_private a_[3] = { simde_int32x4_to_private(val.val[0]), simde_int32x4_to_private(val.val[1]), simde_int32x4_to_private(val.val[2]) };
-    for (size_t i = 0; i < (sizeof(val.val[0]) / sizeof(*ptr)) * 3 ; i++) {
-      buf[i] = a_[i % 3].values[i / 3];
-    }
-    simde_memcpy(ptr, buf, sizeof(buf));
+
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_int32x4_private r_;
+      r_.values = SIMDE_SHUFFLE_VECTOR_(32, 16, a_[0].values, a_[1].values, 0, 4, 0, 1);
+      r_.values = SIMDE_SHUFFLE_VECTOR_(32, 16, r_.values, a_[2].values, 0, 1, 4, 3);
+      simde_vst1q_s32(ptr, simde_int32x4_from_private(r_));
+      r_.values = SIMDE_SHUFFLE_VECTOR_(32, 16, a_[0].values, a_[1].values, 5, 0, 2, 6);
+      r_.values = SIMDE_SHUFFLE_VECTOR_(32, 16, r_.values, a_[2].values, 0, 5, 2, 3);
+      simde_vst1q_s32(ptr + 4, simde_int32x4_from_private(r_));
+      r_.values = SIMDE_SHUFFLE_VECTOR_(32, 16, a_[0].values, a_[1].values, 0, 3, 7, 0);
+      r_.values = SIMDE_SHUFFLE_VECTOR_(32, 16, r_.values, a_[2].values, 6, 1, 2, 7);
+      simde_vst1q_s32(ptr + 8, simde_int32x4_from_private(r_));
+    #else
+      int32_t buf[12];
+      for (size_t i = 0; i < (sizeof(val.val[0]) / sizeof(*ptr)) * 3 ; i++) {
+        buf[i] = a_[i % 3].values[i / 3];
+      }
+      simde_memcpy(ptr, buf, sizeof(buf));
+    #endif
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
@@ -327,13 +482,36 @@ void
 simde_vst3q_s64(int64_t *ptr, simde_int64x2x3_t val) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     vst3q_s64(ptr, val);
+  #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+    wasm_v128_store(ptr, wasm_v64x2_shuffle(val.val[0], val.val[1], 0, 2));
+    wasm_v128_store(ptr + 2, wasm_v64x2_shuffle(val.val[0], val.val[2], 2, 1));
+    wasm_v128_store(ptr + 4, wasm_v64x2_shuffle(val.val[1], val.val[2], 1, 3));
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    const __m128d
+      v0 = _mm_castsi128_pd(val.val[0]),
+      v1 = _mm_castsi128_pd(val.val[1]),
+      v2 = _mm_castsi128_pd(val.val[2]);
+    _mm_storeu_pd(HEDLEY_REINTERPRET_CAST(double*, ptr), _mm_shuffle_pd(v0, v1, 0));
+    _mm_storeu_pd(HEDLEY_REINTERPRET_CAST(double*, ptr + 2), _mm_shuffle_pd(v2, v0, 2));
+    _mm_storeu_pd(HEDLEY_REINTERPRET_CAST(double*, ptr + 4), _mm_shuffle_pd(v1, v2, 3));
   #else
-    int64_t buf[6];
     simde_int64x2_private a_[3] = { simde_int64x2_to_private(val.val[0]), simde_int64x2_to_private(val.val[1]), simde_int64x2_to_private(val.val[2]) };
-    for (size_t i = 0; i < (sizeof(val.val[0]) / sizeof(*ptr)) * 3 ; i++) {
-      buf[i] = a_[i % 3].values[i / 3];
-    }
-    simde_memcpy(ptr, buf, sizeof(buf));
+
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_int64x2_private r_;
+      r_.values = SIMDE_SHUFFLE_VECTOR_(64, 16, a_[0].values, a_[1].values, 0, 2);
+      simde_vst1q_s64(ptr, simde_int64x2_from_private(r_));
+      r_.values = SIMDE_SHUFFLE_VECTOR_(64, 16, a_[0].values, a_[2].values, 2, 1);
+      simde_vst1q_s64(ptr + 2, simde_int64x2_from_private(r_));
+      r_.values = SIMDE_SHUFFLE_VECTOR_(64, 16, a_[1].values, a_[2].values, 1, 3);
+      simde_vst1q_s64(ptr + 4, simde_int64x2_from_private(r_));
+    #else
+      int64_t buf[6];
+      for (size_t i = 0; i < (sizeof(val.val[0]) / sizeof(*ptr)) * 3 ; i++) {
+        buf[i] = a_[i % 3].values[i / 3];
+      }
+      simde_memcpy(ptr, buf, sizeof(buf));
+    #endif
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
@@ -347,13 +525,50 @@ void
 simde_vst3q_u8(uint8_t *ptr, simde_uint8x16x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3q_u8(ptr, val);
+  #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+    wasm_v128_store(ptr, wasm_v8x16_shuffle(wasm_v8x16_shuffle(val.val[0], val.val[1], 0, 16, 0, 1, 17, 0, 2, 18, 0, 3, 19, 0, 4, 20, 0, 5), val.val[2], 0, 1, 16, 3, 4, 17, 6, 7, 18, 9, 10, 19, 12, 13, 20, 15));
+    wasm_v128_store(ptr + 16, wasm_v8x16_shuffle(wasm_v8x16_shuffle(val.val[0], val.val[1], 21, 0, 6, 22, 0, 7, 23, 0, 8, 24, 0, 9, 25, 0, 10, 26), val.val[2], 0, 21, 2, 3, 22, 5, 6, 23, 8, 9, 24, 11, 12, 25, 14, 15));
+    wasm_v128_store(ptr + 32, wasm_v8x16_shuffle(wasm_v8x16_shuffle(val.val[0], val.val[1], 0, 11, 27, 0, 12, 28, 0, 13, 29, 0, 14, 30, 0, 15, 31, 0), val.val[2], 26, 1, 2, 27, 4, 5, 28, 7, 8, 29, 10, 11, 30, 13, 14, 31));
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    _mm_storeu_si128(SIMDE_ALIGN_CAST(__m128i*, ptr),
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(val.val[0], _mm_setr_epi8(0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1, 5)),
+          _mm_shuffle_epi8(val.val[1], _mm_setr_epi8(-1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1))),
+        _mm_shuffle_epi8(val.val[2], _mm_setr_epi8(-1, -1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1))));
+    _mm_storeu_si128(SIMDE_ALIGN_CAST(__m128i*, ptr + 16),
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(val.val[0], _mm_setr_epi8(-1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10, -1)),
+          _mm_shuffle_epi8(val.val[1], _mm_setr_epi8(5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10))),
+        _mm_shuffle_epi8(val.val[2], _mm_setr_epi8(-1, 5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1))));
+    _mm_storeu_si128(SIMDE_ALIGN_CAST(__m128i*, ptr + 32),
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(val.val[0], _mm_setr_epi8(-1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1, -1)),
+          _mm_shuffle_epi8(val.val[1], _mm_setr_epi8(-1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1))),
+        _mm_shuffle_epi8(val.val[2], _mm_setr_epi8(10, -1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15))));
   #else
-    uint8_t buf[48];
     simde_uint8x16_private a_[3] = { simde_uint8x16_to_private(val.val[0]), simde_uint8x16_to_private(val.val[1]), simde_uint8x16_to_private(val.val[2]) };
-    for (size_t i = 0; i < (sizeof(val.val[0]) / sizeof(*ptr)) * 3 ; i++) {
-      buf[i] = a_[i % 3].values[i / 3];
-    }
-    simde_memcpy(ptr, buf, sizeof(buf));
+
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_uint8x16_private r_;
+      r_.values = SIMDE_SHUFFLE_VECTOR_(8, 16, a_[0].values, a_[1].values, 0, 16, 0, 1, 17, 0, 2, 18, 0, 3, 19, 0, 4, 20, 0, 5);
+      r_.values = SIMDE_SHUFFLE_VECTOR_(8, 16, r_.values, a_[2].values, 0, 1, 16, 3, 4, 17, 6, 7, 18, 9, 10, 19, 12, 13, 20, 15);
+      simde_vst1q_u8(ptr, simde_uint8x16_from_private(r_));
+      r_.values = SIMDE_SHUFFLE_VECTOR_(8, 16, a_[0].values, a_[1].values, 21, 0, 6, 22, 0, 7, 23, 0, 8, 24, 0, 9, 25, 0, 10, 26);
+      r_.values = SIMDE_SHUFFLE_VECTOR_(8, 16, r_.values, a_[2].values, 0, 21, 2, 3, 22, 5, 6, 23, 8, 9, 24, 11, 12, 25, 14, 15);
+      simde_vst1q_u8(ptr + 16, simde_uint8x16_from_private(r_));
+      r_.values = SIMDE_SHUFFLE_VECTOR_(8, 16, a_[0].values, a_[1].values, 0, 11, 27, 0, 12, 28, 0, 13, 29, 0, 14, 30, 0, 15, 31, 0);
+      r_.values = SIMDE_SHUFFLE_VECTOR_(8, 16, r_.values, a_[2].values, 26, 1, 2, 27, 4, 5, 28, 7, 8, 29, 10, 11, 30, 13, 14, 31);
+      simde_vst1q_u8(ptr + 32, simde_uint8x16_from_private(r_));
+    #else
+      uint8_t buf[48];
+      for (size_t i = 0; i < (sizeof(val.val[0]) / sizeof(*ptr)) * 3 ; i++) {
+        buf[i] = a_[i % 3].values[i / 3];
+      }
+      simde_memcpy(ptr, buf, sizeof(buf));
+    #endif
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
@@ -366,13 +581,50 @@ void
 simde_vst3q_u16(uint16_t *ptr, simde_uint16x8x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3q_u16(ptr, val);
+  #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+    wasm_v128_store(ptr, wasm_v16x8_shuffle(wasm_v16x8_shuffle(val.val[0], val.val[1], 0, 8, 0, 1, 9, 0, 2, 10), val.val[2], 0, 1, 8, 3, 4, 9, 6, 7));
+    wasm_v128_store(ptr + 8, wasm_v16x8_shuffle(wasm_v16x8_shuffle(val.val[0], val.val[1], 0, 3, 11, 0, 4, 12, 0, 5), val.val[2], 10, 1, 2, 11, 4, 5, 12, 7));
+    wasm_v128_store(ptr + 16, wasm_v16x8_shuffle(wasm_v16x8_shuffle(val.val[0], val.val[1], 13, 0, 6, 14, 0, 7, 15, 0), val.val[2], 0, 13, 2, 3, 14, 5, 6, 15));
+  #elif defined(SIMDE_X86_SSSE3_NATIVE)
+    _mm_storeu_si128(SIMDE_ALIGN_CAST(__m128i*, ptr),
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(val.val[0], _mm_setr_epi8(0, 1, -1, -1, -1, -1, 2, 3, -1, -1, -1, -1, 4, 5, -1, -1)),
+          _mm_shuffle_epi8(val.val[1], _mm_setr_epi8(-1, -1, 0, 1, -1, -1, -1, -1, 2, 3, -1, -1, -1, -1, 4, 5))),
+        _mm_shuffle_epi8(val.val[2], _mm_setr_epi8(-1, -1, -1, -1, 0, 1, -1, -1, -1, -1, 2, 3, -1, -1, -1, -1))));
+    _mm_storeu_si128(SIMDE_ALIGN_CAST(__m128i*, ptr + 8),
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(val.val[0], _mm_setr_epi8(-1, -1, 6, 7, -1, -1, -1, -1, 8, 9, -1, -1, -1, -1, 10, 11)),
+          _mm_shuffle_epi8(val.val[1], _mm_setr_epi8(-1, -1, -1, -1, 6, 7, -1, -1, -1, -1, 8, 9, -1, -1, -1, -1))),
+        _mm_shuffle_epi8(val.val[2], _mm_setr_epi8(4, 5, -1, -1, -1, -1, 6, 7, -1, -1, -1, -1, 8, 9, -1, -1))));
+    _mm_storeu_si128(SIMDE_ALIGN_CAST(__m128i*, ptr + 16),
+      _mm_or_si128(
+        _mm_or_si128(
+          _mm_shuffle_epi8(val.val[0], _mm_setr_epi8(-1, -1, -1, -1, 12, 13, -1, -1, -1, -1, 14, 15, -1, -1, -1, -1)),
+          _mm_shuffle_epi8(val.val[1], _mm_setr_epi8(10, 11, -1, -1, -1, -1, 12, 13, -1, -1, -1, -1, 14, 15, -1, -1))),
+        _mm_shuffle_epi8(val.val[2], _mm_setr_epi8(-1, -1, 10, 11, -1, -1, -1, -1, 12, 13, -1, -1, -1, -1, 14, 15))));
   #else
-    uint16_t buf[24];
     simde_uint16x8_private a_[3] = { simde_uint16x8_to_private(val.val[0]), simde_uint16x8_to_private(val.val[1]), simde_uint16x8_to_private(val.val[2]) };
-    for (size_t i = 0; i < (sizeof(val.val[0]) / sizeof(*ptr)) * 3 ; i++) {
-      buf[i] = a_[i % 3].values[i / 3];
-    }
-    simde_memcpy(ptr, buf, sizeof(buf));
+
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_uint16x8_private r_;
+      r_.values = SIMDE_SHUFFLE_VECTOR_(16, 16, a_[0].values, a_[1].values, 0, 8, 0, 1, 9, 0, 2, 10);
+      r_.values = SIMDE_SHUFFLE_VECTOR_(16, 16, r_.values, a_[2].values, 0, 1, 8, 3, 4, 9, 6, 7);
+      simde_vst1q_u16(ptr, simde_uint16x8_from_private(r_));
+      r_.values = SIMDE_SHUFFLE_VECTOR_(16, 16, a_[0].values, a_[1].values, 0, 3, 11, 0, 4, 12, 0, 5);
+      r_.values = SIMDE_SHUFFLE_VECTOR_(16, 16, r_.values, a_[2].values, 10, 1, 2, 11, 4, 5, 12, 7);
+      simde_vst1q_u16(ptr + 8, simde_uint16x8_from_private(r_));
+      r_.values = SIMDE_SHUFFLE_VECTOR_(16, 16, a_[0].values, a_[1].values, 13, 0, 6, 14, 0, 7, 15, 0);
+      r_.values = SIMDE_SHUFFLE_VECTOR_(16, 16, r_.values, a_[2].values, 0, 13, 2, 3, 14, 5, 6, 15);
+      simde_vst1q_u16(ptr + 16, simde_uint16x8_from_private(r_));
+    #else
+      uint16_t buf[24];
+      for (size_t i = 0; i < (sizeof(val.val[0]) / sizeof(*ptr)) * 3 ; i++) {
+        buf[i] = a_[i % 3].values[i / 3];
+      }
+      simde_memcpy(ptr, buf, sizeof(buf));
+    #endif
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
@@ -385,13 +637,41 @@ void
 simde_vst3q_u32(uint32_t *ptr, simde_uint32x4x3_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst3q_u32(ptr, val);
+  #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+    wasm_v128_store(ptr, wasm_v32x4_shuffle(wasm_v32x4_shuffle(val.val[0], val.val[1], 0, 4, 0, 1), val.val[2], 0, 1, 4, 3));
+    wasm_v128_store(ptr + 4, wasm_v32x4_shuffle(wasm_v32x4_shuffle(val.val[0], val.val[1], 5, 0, 2, 6), val.val[2], 0, 5, 2, 3));
+    wasm_v128_store(ptr + 8, wasm_v32x4_shuffle(wasm_v32x4_shuffle(val.val[0], val.val[1], 0, 3, 7, 0), val.val[2], 6, 1, 2, 7));
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    const __m128
+      v0 = _mm_castsi128_ps(val.val[0]),
+      v1 = _mm_castsi128_ps(val.val[1]),
+      v2 = _mm_castsi128_ps(val.val[2]),
+      lo = _mm_unpacklo_ps(v0, v1),
+      hi = _mm_unpackhi_ps(v0, v1);
+    _mm_storeu_ps(HEDLEY_REINTERPRET_CAST(float*, ptr), _mm_shuffle_ps(lo, _mm_shuffle_ps(v2, v0, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0)));
+    _mm_storeu_ps(HEDLEY_REINTERPRET_CAST(float*, ptr + 4), _mm_shuffle_ps(_mm_shuffle_ps(v1, v2, _MM_SHUFFLE(1, 1, 1, 1)), hi, _MM_SHUFFLE(1, 0, 2, 0)));
+    _mm_storeu_ps(HEDLEY_REINTERPRET_CAST(float*, ptr + 8), _mm_shuffle_ps(_mm_shuffle_ps(v2, hi, _MM_SHUFFLE(2, 2, 2, 2)), _mm_shuffle_ps(hi, v2, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
   #else
-    uint32_t buf[12];
     simde_uint32x4_private a_[3] = { simde_uint32x4_to_private(val.val[0]), simde_uint32x4_to_private(val.val[1]), simde_uint32x4_to_private(val.val[2]) };
-    for (size_t i = 0; i < (sizeof(val.val[0]) / sizeof(*ptr)) * 3 ; i++) {
-      buf[i] = a_[i % 3].values[i / 3];
-    }
-    simde_memcpy(ptr, buf, sizeof(buf));
+
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_uint32x4_private r_;
+      r_.values = SIMDE_SHUFFLE_VECTOR_(32, 16, a_[0].values, a_[1].values, 0, 4, 0, 1);
+      r_.values = SIMDE_SHUFFLE_VECTOR_(32, 16, r_.values, a_[2].values, 0, 1, 4, 3);
+      simde_vst1q_u32(ptr, simde_uint32x4_from_private(r_));
+      r_.values = SIMDE_SHUFFLE_VECTOR_(32, 16, a_[0].values, a_[1].values, 5, 0, 2, 6);
+      r_.values = SIMDE_SHUFFLE_VECTOR_(32, 16, r_.values, a_[2].values, 0, 5, 2, 3);
+      simde_vst1q_u32(ptr + 4, simde_uint32x4_from_private(r_));
+      r_.values = SIMDE_SHUFFLE_VECTOR_(32, 16, a_[0].values, a_[1].values, 0, 3, 7, 0);
+      r_.values = SIMDE_SHUFFLE_VECTOR_(32, 16, r_.values, a_[2].values, 6, 1, 2, 7);
+      simde_vst1q_u32(ptr + 8, simde_uint32x4_from_private(r_));
+    #else
+      uint32_t buf[12];
+      for (size_t i = 0; i < (sizeof(val.val[0]) / sizeof(*ptr)) * 3 ; i++) {
+        buf[i] = a_[i % 3].values[i / 3];
+      }
+      simde_memcpy(ptr, buf, sizeof(buf));
+    #endif
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
@@ -404,13 +684,36 @@ void
 simde_vst3q_u64(uint64_t *ptr, simde_uint64x2x3_t val) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     vst3q_u64(ptr, val);
+  #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+    wasm_v128_store(ptr, wasm_v64x2_shuffle(val.val[0], val.val[1], 0, 2));
+    wasm_v128_store(ptr + 2, wasm_v64x2_shuffle(val.val[0], val.val[2], 2, 1));
+    wasm_v128_store(ptr + 4, wasm_v64x2_shuffle(val.val[1], val.val[2], 1, 3));
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    const __m128d
+      v0 = _mm_castsi128_pd(val.val[0]),
+      v1 = _mm_castsi128_pd(val.val[1]),
+      v2 = _mm_castsi128_pd(val.val[2]);
+    _mm_storeu_pd(HEDLEY_REINTERPRET_CAST(double*, ptr), _mm_shuffle_pd(v0, v1, 0));
+    _mm_storeu_pd(HEDLEY_REINTERPRET_CAST(double*, ptr + 2), _mm_shuffle_pd(v2, v0, 2));
+    _mm_storeu_pd(HEDLEY_REINTERPRET_CAST(double*, ptr + 4), _mm_shuffle_pd(v1, v2, 3));
   #else
-    uint64_t buf[6];
     simde_uint64x2_private a_[3] = { simde_uint64x2_to_private(val.val[0]), simde_uint64x2_to_private(val.val[1]), simde_uint64x2_to_private(val.val[2]) };
-    for (size_t i = 0; i < (sizeof(val.val[0]) / sizeof(*ptr)) * 3 ; i++) {
-      buf[i] = a_[i % 3].values[i / 3];
-    }
-    simde_memcpy(ptr, buf, sizeof(buf));
+
+    #if defined(SIMDE_SHUFFLE_VECTOR_)
+      simde_uint64x2_private r_;
+      r_.values = SIMDE_SHUFFLE_VECTOR_(64, 16, a_[0].values, a_[1].values, 0, 2);
+      simde_vst1q_u64(ptr, simde_uint64x2_from_private(r_));
+      r_.values = SIMDE_SHUFFLE_VECTOR_(64, 16, a_[0].values, a_[2].values, 2, 1);
+      simde_vst1q_u64(ptr + 2, simde_uint64x2_from_private(r_));
+      r_.values = SIMDE_SHUFFLE_VECTOR_(64, 16, a_[1].values, a_[2].values, 1, 3);
+      simde_vst1q_u64(ptr + 4, simde_uint64x2_from_private(r_));
+    #else
+      uint64_t buf[6];
+      for (size_t i = 0; i < (sizeof(val.val[0]) / sizeof(*ptr)) * 3 ; i++) {
+        buf[i] = a_[i % 3].values[i / 3];
+      }
+      simde_memcpy(ptr, buf, sizeof(buf));
+    #endif
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
@@ -29,6 +29,9 @@
 #define SIMDE_ARM_NEON_ST4_H
 
 #include "types.h"
+#include "st1.h"
+#include "zip1.h"
+#include "zip2.h"
 
 HEDLEY_DIAGNOSTIC_PUSH
 SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
@@ -242,13 +245,15 @@ simde_vst4q_f32(simde_float32_t *ptr, simde_float32x4x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4q_f32(ptr, val);
   #else
-    simde_float32_t buf[16];
-    simde_float32x4_private a_[4] = { simde_float32x4_to_private(val.val[0]), simde_float32x4_to_private(val.val[1]),
-                                      simde_float32x4_to_private(val.val[2]), simde_float32x4_to_private(val.val[3]) };
-    for (size_t i = 0; i < (sizeof(val.val[0]) / sizeof(*ptr)) * 4 ; i++) {
-      buf[i] = a_[i % 4].values[i / 4];
-    }
-    simde_memcpy(ptr, buf, sizeof(buf));
+    simde_float32x4_t
+      a0 = simde_vzip1q_f32(val.val[0], val.val[2]),
+      a1 = simde_vzip2q_f32(val.val[0], val.val[2]),
+      a2 = simde_vzip1q_f32(val.val[1], val.val[3]),
+      a3 = simde_vzip2q_f32(val.val[1], val.val[3]);
+    simde_vst1q_f32(ptr, simde_vzip1q_f32(a0, a2));
+    simde_vst1q_f32(ptr + 4, simde_vzip2q_f32(a0, a2));
+    simde_vst1q_f32(ptr + 8, simde_vzip1q_f32(a1, a3));
+    simde_vst1q_f32(ptr + 12, simde_vzip2q_f32(a1, a3));
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
@@ -262,13 +267,15 @@ simde_vst4q_f64(simde_float64_t *ptr, simde_float64x2x4_t val) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     vst4q_f64(ptr, val);
   #else
-    simde_float64_t buf[8];
-    simde_float64x2_private a_[4] = { simde_float64x2_to_private(val.val[0]), simde_float64x2_to_private(val.val[1]),
-                                      simde_float64x2_to_private(val.val[2]), simde_float64x2_to_private(val.val[3]) };
-    for (size_t i = 0; i < (sizeof(val.val[0]) / sizeof(*ptr)) * 4 ; i++) {
-      buf[i] = a_[i % 4].values[i / 4];
-    }
-    simde_memcpy(ptr, buf, sizeof(buf));
+    simde_float64x2_t
+      a0 = simde_vzip1q_f64(val.val[0], val.val[2]),
+      a1 = simde_vzip2q_f64(val.val[0], val.val[2]),
+      a2 = simde_vzip1q_f64(val.val[1], val.val[3]),
+      a3 = simde_vzip2q_f64(val.val[1], val.val[3]);
+    simde_vst1q_f64(ptr, simde_vzip1q_f64(a0, a2));
+    simde_vst1q_f64(ptr + 2, simde_vzip2q_f64(a0, a2));
+    simde_vst1q_f64(ptr + 4, simde_vzip1q_f64(a1, a3));
+    simde_vst1q_f64(ptr + 6, simde_vzip2q_f64(a1, a3));
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
@@ -282,13 +289,15 @@ simde_vst4q_s8(int8_t *ptr, simde_int8x16x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4q_s8(ptr, val);
   #else
-    int8_t buf[64];
-    simde_int8x16_private a_[4] = { simde_int8x16_to_private(val.val[0]), simde_int8x16_to_private(val.val[1]),
-                                    simde_int8x16_to_private(val.val[2]), simde_int8x16_to_private(val.val[3]) };
-    for (size_t i = 0; i < (sizeof(val.val[0]) / sizeof(*ptr)) * 4 ; i++) {
-      buf[i] = a_[i % 4].values[i / 4];
-    }
-    simde_memcpy(ptr, buf, sizeof(buf));
+    simde_int8x16_t
+      a0 = simde_vzip1q_s8(val.val[0], val.val[2]),
+      a1 = simde_vzip2q_s8(val.val[0], val.val[2]),
+      a2 = simde_vzip1q_s8(val.val[1], val.val[3]),
+      a3 = simde_vzip2q_s8(val.val[1], val.val[3]);
+    simde_vst1q_s8(ptr, simde_vzip1q_s8(a0, a2));
+    simde_vst1q_s8(ptr + 16, simde_vzip2q_s8(a0, a2));
+    simde_vst1q_s8(ptr + 32, simde_vzip1q_s8(a1, a3));
+    simde_vst1q_s8(ptr + 48, simde_vzip2q_s8(a1, a3));
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
@@ -302,13 +311,15 @@ simde_vst4q_s16(int16_t *ptr, simde_int16x8x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4q_s16(ptr, val);
   #else
-    int16_t buf[32];
-    simde_int16x8_private a_[4] = { simde_int16x8_to_private(val.val[0]), simde_int16x8_to_private(val.val[1]),
-                                    simde_int16x8_to_private(val.val[2]), simde_int16x8_to_private(val.val[3]) };
-    for (size_t i = 0; i < (sizeof(val.val[0]) / sizeof(*ptr)) * 4 ; i++) {
-      buf[i] = a_[i % 4].values[i / 4];
-    }
-    simde_memcpy(ptr, buf, sizeof(buf));
+    simde_int16x8_t
+      a0 = simde_vzip1q_s16(val.val[0], val.val[2]),
+      a1 = simde_vzip2q_s16(val.val[0], val.val[2]),
+      a2 = simde_vzip1q_s16(val.val[1], val.val[3]),
+      a3 = simde_vzip2q_s16(val.val[1], val.val[3]);
+    simde_vst1q_s16(ptr, simde_vzip1q_s16(a0, a2));
+    simde_vst1q_s16(ptr + 8, simde_vzip2q_s16(a0, a2));
+    simde_vst1q_s16(ptr + 16, simde_vzip1q_s16(a1, a3));
+    simde_vst1q_s16(ptr + 24, simde_vzip2q_s16(a1, a3));
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
@@ -322,13 +333,15 @@ simde_vst4q_s32(int32_t *ptr, simde_int32x4x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4q_s32(ptr, val);
   #else
-    int32_t buf[16];
-    simde_int32x4_private a_[4] = { simde_int32x4_to_private(val.val[0]), simde_int32x4_to_private(val.val[1]),
-                                    simde_int32x4_to_private(val.val[2]), simde_int32x4_to_private(val.val[3]) };
-    for (size_t i = 0; i < (sizeof(val.val[0]) / sizeof(*ptr)) * 4 ; i++) {
-      buf[i] = a_[i % 4].values[i / 4];
-    }
-    simde_memcpy(ptr, buf, sizeof(buf));
+    simde_int32x4_t
+      a0 = simde_vzip1q_s32(val.val[0], val.val[2]),
+      a1 = simde_vzip2q_s32(val.val[0], val.val[2]),
+      a2 = simde_vzip1q_s32(val.val[1], val.val[3]),
+      a3 = simde_vzip2q_s32(val.val[1], val.val[3]);
+    simde_vst1q_s32(ptr, simde_vzip1q_s32(a0, a2));
+    simde_vst1q_s32(ptr + 4, simde_vzip2q_s32(a0, a2));
+    simde_vst1q_s32(ptr + 8, simde_vzip1q_s32(a1, a3));
+    simde_vst1q_s32(ptr + 12, simde_vzip2q_s32(a1, a3));
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
@@ -342,13 +355,15 @@ simde_vst4q_s64(int64_t *ptr, simde_int64x2x4_t val) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     vst4q_s64(ptr, val);
   #else
-    int64_t buf[8];
-    simde_int64x2_private a_[4] = { simde_int64x2_to_private(val.val[0]), simde_int64x2_to_private(val.val[1]),
-                                    simde_int64x2_to_private(val.val[2]), simde_int64x2_to_private(val.val[3]) };
-    for (size_t i = 0; i < (sizeof(val.val[0]) / sizeof(*ptr)) * 4 ; i++) {
-      buf[i] = a_[i % 4].values[i / 4];
-    }
-    simde_memcpy(ptr, buf, sizeof(buf));
+    simde_int64x2_t
+      a0 = simde_vzip1q_s64(val.val[0], val.val[2]),
+      a1 = simde_vzip2q_s64(val.val[0], val.val[2]),
+      a2 = simde_vzip1q_s64(val.val[1], val.val[3]),
+      a3 = simde_vzip2q_s64(val.val[1], val.val[3]);
+    simde_vst1q_s64(ptr, simde_vzip1q_s64(a0, a2));
+    simde_vst1q_s64(ptr + 2, simde_vzip2q_s64(a0, a2));
+    simde_vst1q_s64(ptr + 4, simde_vzip1q_s64(a1, a3));
+    simde_vst1q_s64(ptr + 6, simde_vzip2q_s64(a1, a3));
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
@@ -363,13 +378,15 @@ simde_vst4q_u8(uint8_t *ptr, simde_uint8x16x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4q_u8(ptr, val);
   #else
-    uint8_t buf[64];
-    simde_uint8x16_private a_[4] = { simde_uint8x16_to_private(val.val[0]), simde_uint8x16_to_private(val.val[1]),
-                                     simde_uint8x16_to_private(val.val[2]), simde_uint8x16_to_private(val.val[3]) };
-    for (size_t i = 0; i < (sizeof(val.val[0]) / sizeof(*ptr)) * 4 ; i++) {
-      buf[i] = a_[i % 4].values[i / 4];
-    }
-    simde_memcpy(ptr, buf, sizeof(buf));
+    simde_uint8x16_t
+      a0 = simde_vzip1q_u8(val.val[0], val.val[2]),
+      a1 = simde_vzip2q_u8(val.val[0], val.val[2]),
+      a2 = simde_vzip1q_u8(val.val[1], val.val[3]),
+      a3 = simde_vzip2q_u8(val.val[1], val.val[3]);
+    simde_vst1q_u8(ptr, simde_vzip1q_u8(a0, a2));
+    simde_vst1q_u8(ptr + 16, simde_vzip2q_u8(a0, a2));
+    simde_vst1q_u8(ptr + 32, simde_vzip1q_u8(a1, a3));
+    simde_vst1q_u8(ptr + 48, simde_vzip2q_u8(a1, a3));
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
@@ -383,13 +400,15 @@ simde_vst4q_u16(uint16_t *ptr, simde_uint16x8x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4q_u16(ptr, val);
   #else
-    uint16_t buf[32];
-    simde_uint16x8_private a_[4] = { simde_uint16x8_to_private(val.val[0]), simde_uint16x8_to_private(val.val[1]),
-                                     simde_uint16x8_to_private(val.val[2]), simde_uint16x8_to_private(val.val[3]) };
-    for (size_t i = 0; i < (sizeof(val.val[0]) / sizeof(*ptr)) * 4 ; i++) {
-      buf[i] = a_[i % 4].values[i / 4];
-    }
-    simde_memcpy(ptr, buf, sizeof(buf));
+    simde_uint16x8_t
+      a0 = simde_vzip1q_u16(val.val[0], val.val[2]),
+      a1 = simde_vzip2q_u16(val.val[0], val.val[2]),
+      a2 = simde_vzip1q_u16(val.val[1], val.val[3]),
+      a3 = simde_vzip2q_u16(val.val[1], val.val[3]);
+    simde_vst1q_u16(ptr, simde_vzip1q_u16(a0, a2));
+    simde_vst1q_u16(ptr + 8, simde_vzip2q_u16(a0, a2));
+    simde_vst1q_u16(ptr + 16, simde_vzip1q_u16(a1, a3));
+    simde_vst1q_u16(ptr + 24, simde_vzip2q_u16(a1, a3));
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
@@ -403,13 +422,15 @@ simde_vst4q_u32(uint32_t *ptr, simde_uint32x4x4_t val) {
   #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
     vst4q_u32(ptr, val);
   #else
-    uint32_t buf[16];
-    simde_uint32x4_private a_[4] = { simde_uint32x4_to_private(val.val[0]), simde_uint32x4_to_private(val.val[1]),
-                                     simde_uint32x4_to_private(val.val[2]), simde_uint32x4_to_private(val.val[3]) };
-    for (size_t i = 0; i < (sizeof(val.val[0]) / sizeof(*ptr)) * 4 ; i++) {
-      buf[i] = a_[i % 4].values[i / 4];
-    }
-    simde_memcpy(ptr, buf, sizeof(buf));
+    simde_uint32x4_t
+      a0 = simde_vzip1q_u32(val.val[0], val.val[2]),
+      a1 = simde_vzip2q_u32(val.val[0], val.val[2]),
+      a2 = simde_vzip1q_u32(val.val[1], val.val[3]),
+      a3 = simde_vzip2q_u32(val.val[1], val.val[3]);
+    simde_vst1q_u32(ptr, simde_vzip1q_u32(a0, a2));
+    simde_vst1q_u32(ptr + 4, simde_vzip2q_u32(a0, a2));
+    simde_vst1q_u32(ptr + 8, simde_vzip1q_u32(a1, a3));
+    simde_vst1q_u32(ptr + 12, simde_vzip2q_u32(a1, a3));
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A32V7_ENABLE_NATIVE_ALIASES)
@@ -423,13 +444,15 @@ simde_vst4q_u64(uint64_t *ptr, simde_uint64x2x4_t val) {
   #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
     vst4q_u64(ptr, val);
   #else
-    uint64_t buf[8];
-    simde_uint64x2_private a_[4] = { simde_uint64x2_to_private(val.val[0]), simde_uint64x2_to_private(val.val[1]),
-                                     simde_uint64x2_to_private(val.val[2]), simde_uint64x2_to_private(val.val[3]) };
-    for (size_t i = 0; i < (sizeof(val.val[0]) / sizeof(*ptr)) * 4 ; i++) {
-      buf[i] = a_[i % 4].values[i / 4];
-    }
-    simde_memcpy(ptr, buf, sizeof(buf));
+    simde_uint64x2_t
+      a0 = simde_vzip1q_u64(val.val[0], val.val[2]),
+      a1 = simde_vzip2q_u64(val.val[0], val.val[2]),
+      a2 = simde_vzip1q_u64(val.val[1], val.val[3]),
+      a3 = simde_vzip2q_u64(val.val[1], val.val[3]);
+    simde_vst1q_u64(ptr, simde_vzip1q_u64(a0, a2));
+    simde_vst1q_u64(ptr + 2, simde_vzip2q_u64(a0, a2));
+    simde_vst1q_u64(ptr + 4, simde_vzip1q_u64(a1, a3));
+    simde_vst1q_u64(ptr + 6, simde_vzip2q_u64(a1, a3));
   #endif
 }
 #if defined(SIMDE_ARM_NEON_A64V8_ENABLE_NATIVE_ALIASES)
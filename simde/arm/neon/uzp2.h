@@ -429,7 +429,7 @@ simde_vuzp2q_s32(simde_int32x4_t a, simde_int32x4_t b) {
     return t.val[1];
   #elif defined(SIMDE_WASM_SIMD128_NATIVE)
     return wasm_v32x4_shuffle(a, b, 1, 3, 5, 7);
-  #elif defined(SIMDE_X86_SSE_NATIVE)
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
     return _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b), 0xdd));
   #else
     simde_int32x4_private
@@ -576,7 +576,7 @@ simde_vuzp2q_u32(simde_uint32x4_t a, simde_uint32x4_t b) {
     return t.val[1];
   #elif defined(SIMDE_WASM_SIMD128_NATIVE)
     return wasm_v32x4_shuffle(a, b, 1, 3, 5, 7);
-  #elif defined(SIMDE_X86_SSE_NATIVE)
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
     return _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b), 0xdd));
   #else
     simde_uint32x4_private
@@ -126,6 +126,9 @@
 #if defined(__ARM_FEATURE_SVE)
 #  define SIMDE_ARCH_ARM_SVE
 #endif
+#if defined(__ARM_FEATURE_FMA)
+#  define SIMDE_ARCH_ARM_FMA
+#endif
 
 /* Blackfin
    <https://en.wikipedia.org/wiki/Blackfin> */
@@ -281,6 +284,21 @@
 #  if defined(__AVX512VBMI__)
 #    define SIMDE_ARCH_X86_AVX512VBMI 1
 #  endif
+#  if defined(__AVX512VBMI2__)
+#    define SIMDE_ARCH_X86_AVX512VBMI2 1
+#  endif
+#  if defined(__AVX512BITALG__)
+#    define SIMDE_ARCH_X86_AVX512BITALG 1
+#  endif
+#  if defined(__AVX512VPOPCNTDQ__)
+#    define SIMDE_ARCH_X86_AVX512VPOPCNTDQ 1
+#  endif
+#  if defined(__AVX512VNNI__)
+#    define SIMDE_ARCH_X86_AVX512VNNI 1
+#  endif
+#  if defined(__AVXVNNI__)
+#    define SIMDE_ARCH_X86_AVXVNNI 1
+#  endif
 #  if defined(__AVX512BW__)
 #    define SIMDE_ARCH_X86_AVX512BW 1
 #  endif
@@ -290,6 +308,9 @@
 #  if defined(__AVX512DQ__)
 #    define SIMDE_ARCH_X86_AVX512DQ 1
 #  endif
+#  if defined(__AVX512ER__)
+#    define SIMDE_ARCH_X86_AVX512ER 1
+#  endif
 #  if defined(__AVX512F__)
 #    define SIMDE_ARCH_X86_AVX512F 1
 #  endif
@@ -299,6 +320,27 @@
 #  if defined(__GFNI__)
 #    define SIMDE_ARCH_X86_GFNI 1
 #  endif
+#  if defined(__AES__)
+#    define SIMDE_ARCH_X86_AES 1
+#  endif
+#  if defined(__SHA__)
+#    define SIMDE_ARCH_X86_SHA 1
+#  endif
+#  if defined(__BMI__)
+#    define SIMDE_ARCH_X86_BMI1 1
+#  endif
+#  if defined(__BMI2__)
+#    define SIMDE_ARCH_X86_BMI2 1
+#  endif
+#  if defined(__LZCNT__)
+#    define SIMDE_ARCH_X86_LZCNT 1
+#  endif
+#  if defined(__POPCNT__)
+#    define SIMDE_ARCH_X86_POPCNT 1
+#  endif
+#  if defined(__F16C__)
+#    define SIMDE_ARCH_X86_F16C 1
+#  endif
 #  if defined(__PCLMUL__)
 #    define SIMDE_ARCH_X86_PCLMUL 1
 #  endif
@@ -629,6 +629,20 @@ typedef SIMDE_FLOAT64_TYPE simde_float64;
   #endif
 #endif
 
+/* Hint that the memory at addr is about to be read (rw == 0) or
+ * written (rw == 1).  Prefetches don't fault, so addr doesn't have to
+ * be valid. */
+#if !defined(simde_prefetch)
+  #if \
+      HEDLEY_HAS_BUILTIN(__builtin_prefetch) || \
+      HEDLEY_GCC_VERSION_CHECK(3,1,0) || \
+      HEDLEY_INTEL_VERSION_CHECK(13,0,0)
+    #define simde_prefetch(addr, rw) __builtin_prefetch((addr), (rw))
+  #else
+    #define simde_prefetch(addr, rw) ((void) (addr))
+  #endif
+#endif
+
 #if defined(FE_ALL_EXCEPT)
   #define SIMDE_HAVE_FENV_H
 #elif defined(__has_include)
@@ -0,0 +1,926 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+/* The portable implementations don't use the usual 256-byte S-box,
+ * since indexing a table with secret data leaks the key through the
+ * cache.
+ *
+ * Where there is a native byte shuffle (SSSE3 PSHUFB, NEON VTBL,
+ * AltiVec vec_perm or WASM swizzle), we follow Mike Hamburg's "vector
+ * permutation" AES and only use 16-entry tables indexed by
+ * simde_mm_shuffle_epi8.  The multiplicative inverse at the heart of
+ * SubBytes is computed in GF((2^4)^2) instead of GF(2^8): after a
+ * change of basis, every element is h*y + l with h and l in GF(2^4),
+ * and
+ *
+ *   1 / (h*y + l) = (h*y + (h + l)) / (8*h^2 + h*l + l^2)
+ *
+ * Products in GF(2^4) are computed with log/exp tables.  The change of
+ * basis (and its inverse) is linear, so it is done with one lookup per
+ * nibble, and the affine part of the S-box, as well as the constant
+ * multiplications of (Inv)MixColumns, are folded into the output
+ * tables.
+ *
+ * Without a native shuffle, simde_mm_shuffle_epi8 is a loop which
+ * indexes memory with the shuffle control, so it is only used with
+ * constant controls (ShiftRows and the column rotations).  SubBytes is
+ * instead bitsliced: the state is transposed into eight 16-bit planes,
+ * one per bit, and run through Boyar and Peralta's 113-gate circuit
+ * for the S-box, which only uses AND, XOR and NOT. */
+
+#if !defined(SIMDE_X86_AES_H)
+#define SIMDE_X86_AES_H
+
+#include "ssse3.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+#if \
+    defined(SIMDE_X86_SSSE3_NATIVE) || \
+    defined(SIMDE_ARM_NEON_A32V7_NATIVE) || \
+    defined(SIMDE_POWER_ALTIVEC_P6_NATIVE) || \
+    defined(SIMDE_WASM_SIMD128_NATIVE)
+  #define SIMDE_X_AES_VPERM_
+#endif
+
+/* Indices into simde_x_aes_tables_.  Tables used with
+ * simde_x_aes_lookup_ occupy two slots: the low nibble table and
+ * the high nibble table. */
+#define SIMDE_X_AES_TABLE_PHI_             0
+#define SIMDE_X_AES_TABLE_IPHI_            2
+#define SIMDE_X_AES_TABLE_LOG_             4
+#define SIMDE_X_AES_TABLE_LOGINV_          5
+#define SIMDE_X_AES_TABLE_EXP_             6
+#define SIMDE_X_AES_TABLE_SQ_              7
+#define SIMDE_X_AES_TABLE_SQL_             8
+#define SIMDE_X_AES_TABLE_S_               9
+#define SIMDE_X_AES_TABLE_S2_             11
+#define SIMDE_X_AES_TABLE_I1_             13
+#define SIMDE_X_AES_TABLE_I9_             15
+#define SIMDE_X_AES_TABLE_I11_            17
+#define SIMDE_X_AES_TABLE_I13_            19
+#define SIMDE_X_AES_TABLE_I14_            21
+#define SIMDE_X_AES_TABLE_M9_             23
+#define SIMDE_X_AES_TABLE_M11_            25
+#define SIMDE_X_AES_TABLE_M13_            27
+#define SIMDE_X_AES_TABLE_M14_            29
+#define SIMDE_X_AES_TABLE_SHIFT_ROWS_     31
+#define SIMDE_X_AES_TABLE_INV_SHIFT_ROWS_ 32
+#define SIMDE_X_AES_TABLE_ROT1_           33
+#define SIMDE_X_AES_TABLE_ROT2_           34
+#define SIMDE_X_AES_TABLE_ROT3_           35
+#define SIMDE_X_AES_TABLE_KEYGEN_         36
+#define SIMDE_X_AES_TABLE_KEYGEN_SHIFTED_ 37
+
+static const union {
+  uint8_t      u8[38 * 16];
+  simde__m128i m128i[38];
+} simde_x_aes_tables_ = {
+  {
+    /* PHI */
+    UINT8_C(0x00), UINT8_C(0x01), UINT8_C(0x20), UINT8_C(0x21), UINT8_C(0x46), UINT8_C(0x47), UINT8_C(0x66), UINT8_C(0x67),
+    UINT8_C(0x4c), UINT8_C(0x4d), UINT8_C(0x6c), UINT8_C(0x6d), UINT8_C(0x0a), UINT8_C(0x0b), UINT8_C(0x2a), UINT8_C(0x2b),
+    /* PHI_HI */
+    UINT8_C(0x00), UINT8_C(0x3c), UINT8_C(0xd5), UINT8_C(0xe9), UINT8_C(0x34), UINT8_C(0x08), UINT8_C(0xe1), UINT8_C(0xdd),
+    UINT8_C(0xe5), UINT8_C(0xd9), UINT8_C(0x30), UINT8_C(0x0c), UINT8_C(0xd1), UINT8_C(0xed), UINT8_C(0x04), UINT8_C(0x38),
+    /* IPHI */
+    UINT8_C(0x47), UINT8_C(0x1f), UINT8_C(0xd8), UINT8_C(0x80), UINT8_C(0xdf), UINT8_C(0x87), UINT8_C(0x40), UINT8_C(0x18),
+    UINT8_C(0x6f), UINT8_C(0x37), UINT8_C(0xf0), UINT8_C(0xa8), UINT8_C(0xf7), UINT8_C(0xaf), UINT8_C(0x68), UINT8_C(0x30),
+    /* IPHI_HI */
+    UINT8_C(0x00), UINT8_C(0x76), UINT8_C(0x79), UINT8_C(0x0f), UINT8_C(0xf9), UINT8_C(0x8f), UINT8_C(0x80), UINT8_C(0xf6),
+    UINT8_C(0x92), UINT8_C(0xe4), UINT8_C(0xeb), UINT8_C(0x9d), UINT8_C(0x6b), UINT8_C(0x1d), UINT8_C(0x12), UINT8_C(0x64),
+    /* LOG */
+    UINT8_C(0xf0), UINT8_C(0x00), UINT8_C(0x01), UINT8_C(0x04), UINT8_C(0x02), UINT8_C(0x08), UINT8_C(0x05), UINT8_C(0x0a),
+    UINT8_C(0x03), UINT8_C(0x0e), UINT8_C(0x09), UINT8_C(0x07), UINT8_C(0x06), UINT8_C(0x0d), UINT8_C(0x0b), UINT8_C(0x0c),
+    /* LOGINV */
+    UINT8_C(0xf0), UINT8_C(0x00), UINT8_C(0x0e), UINT8_C(0x0b), UINT8_C(0x0d), UINT8_C(0x07), UINT8_C(0x0a), UINT8_C(0x05),
+    UINT8_C(0x0c), UINT8_C(0x01), UINT8_C(0x06), UINT8_C(0x08), UINT8_C(0x09), UINT8_C(0x02), UINT8_C(0x04), UINT8_C(0x03),
+    /* EXP */
+    UINT8_C(0x01), UINT8_C(0x02), UINT8_C(0x04), UINT8_C(0x08), UINT8_C(0x03), UINT8_C(0x06), UINT8_C(0x0c), UINT8_C(0x0b),
+    UINT8_C(0x05), UINT8_C(0x0a), UINT8_C(0x07), UINT8_C(0x0e), UINT8_C(0x0f), UINT8_C(0x0d), UINT8_C(0x09), UINT8_C(0x01),
+    /* SQ */
+    UINT8_C(0x00), UINT8_C(0x01), UINT8_C(0x04), UINT8_C(0x05), UINT8_C(0x03), UINT8_C(0x02), UINT8_C(0x07), UINT8_C(0x06),
+    UINT8_C(0x0c), UINT8_C(0x0d), UINT8_C(0x08), UINT8_C(0x09), UINT8_C(0x0f), UINT8_C(0x0e), UINT8_C(0x0b), UINT8_C(0x0a),
+    /* SQL */
+    UINT8_C(0x00), UINT8_C(0x08), UINT8_C(0x06), UINT8_C(0x0e), UINT8_C(0x0b), UINT8_C(0x03), UINT8_C(0x0d), UINT8_C(0x05),
+    UINT8_C(0x0a), UINT8_C(0x02), UINT8_C(0x0c), UINT8_C(0x04), UINT8_C(0x01), UINT8_C(0x09), UINT8_C(0x07), UINT8_C(0x0f),
+    /* S */
+    UINT8_C(0x63), UINT8_C(0x7c), UINT8_C(0xd1), UINT8_C(0xce), UINT8_C(0xc8), UINT8_C(0xd7), UINT8_C(0x7a), UINT8_C(0x65),
+    UINT8_C(0x55), UINT8_C(0x4a), UINT8_C(0xe7), UINT8_C(0xf8), UINT8_C(0xfe), UINT8_C(0xe1), UINT8_C(0x4c), UINT8_C(0x53),
+    /* S_HI */
+    UINT8_C(0x00), UINT8_C(0x52), UINT8_C(0x3e), UINT8_C(0x6c), UINT8_C(0x65), UINT8_C(0x37), UINT8_C(0x5b), UINT8_C(0x09),
+    UINT8_C(0x60), UINT8_C(0x32), UINT8_C(0x5e), UINT8_C(0x0c), UINT8_C(0x05), UINT8_C(0x57), UINT8_C(0x3b), UINT8_C(0x69),
+    /* S2 */
+    UINT8_C(0xc6), UINT8_C(0xf8), UINT8_C(0xb9), UINT8_C(0x87), UINT8_C(0x8b), UINT8_C(0xb5), UINT8_C(0xf4), UINT8_C(0xca),
+    UINT8_C(0xaa), UINT8_C(0x94), UINT8_C(0xd5), UINT8_C(0xeb), UINT8_C(0xe7), UINT8_C(0xd9), UINT8_C(0x98), UINT8_C(0xa6),
+    /* S2_HI */
+    UINT8_C(0x00), UINT8_C(0xa4), UINT8_C(0x7c), UINT8_C(0xd8), UINT8_C(0xca), UINT8_C(0x6e), UINT8_C(0xb6), UINT8_C(0x12),
+    UINT8_C(0xc0), UINT8_C(0x64), UINT8_C(0xbc), UINT8_C(0x18), UINT8_C(0x0a), UINT8_C(0xae), UINT8_C(0x76), UINT8_C(0xd2),
+    /* I1 */
+    UINT8_C(0x00), UINT8_C(0x01), UINT8_C(0x5c), UINT8_C(0x5d), UINT8_C(0xe0), UINT8_C(0xe1), UINT8_C(0xbc), UINT8_C(0xbd),
+    UINT8_C(0x50), UINT8_C(0x51), UINT8_C(0x0c), UINT8_C(0x0d), UINT8_C(0xb0), UINT8_C(0xb1), UINT8_C(0xec), UINT8_C(0xed),
+    /* I1_HI */
+    UINT8_C(0x00), UINT8_C(0xa2), UINT8_C(0x02), UINT8_C(0xa0), UINT8_C(0xb8), UINT8_C(0x1a), UINT8_C(0xba), UINT8_C(0x18),
+    UINT8_C(0xdb), UINT8_C(0x79), UINT8_C(0xd9), UINT8_C(0x7b), UINT8_C(0x63), UINT8_C(0xc1), UINT8_C(0x61), UINT8_C(0xc3),
+    /* I9 */
+    UINT8_C(0x00), UINT8_C(0x09), UINT8_C(0x8a), UINT8_C(0x83), UINT8_C(0xa1), UINT8_C(0xa8), UINT8_C(0x2b), UINT8_C(0x22),
+    UINT8_C(0xe6), UINT8_C(0xef), UINT8_C(0x6c), UINT8_C(0x65), UINT8_C(0x47), UINT8_C(0x4e), UINT8_C(0xcd), UINT8_C(0xc4),
+    /* I9_HI */
+    UINT8_C(0x00), UINT8_C(0xc5), UINT8_C(0x12), UINT8_C(0xd7), UINT8_C(0x0f), UINT8_C(0xca), UINT8_C(0x1d), UINT8_C(0xd8),
+    UINT8_C(0x59), UINT8_C(0x9c), UINT8_C(0x4b), UINT8_C(0x8e), UINT8_C(0x56), UINT8_C(0x93), UINT8_C(0x44), UINT8_C(0x81),
+    /* I11 */
+    UINT8_C(0x00), UINT8_C(0x0b), UINT8_C(0x32), UINT8_C(0x39), UINT8_C(0x7a), UINT8_C(0x71), UINT8_C(0x48), UINT8_C(0x43),
+    UINT8_C(0x46), UINT8_C(0x4d), UINT8_C(0x74), UINT8_C(0x7f), UINT8_C(0x3c), UINT8_C(0x37), UINT8_C(0x0e), UINT8_C(0x05),
+    /* I11_HI */
+    UINT8_C(0x00), UINT8_C(0x9a), UINT8_C(0x16), UINT8_C(0x8c), UINT8_C(0x64), UINT8_C(0xfe), UINT8_C(0x72), UINT8_C(0xe8),
+    UINT8_C(0xf4), UINT8_C(0x6e), UINT8_C(0xe2), UINT8_C(0x78), UINT8_C(0x90), UINT8_C(0x0a), UINT8_C(0x86), UINT8_C(0x1c),
+    /* I13 */
+    UINT8_C(0x00), UINT8_C(0x0d), UINT8_C(0xe1), UINT8_C(0xec), UINT8_C(0x0c), UINT8_C(0x01), UINT8_C(0xed), UINT8_C(0xe0),
+    UINT8_C(0xbd), UINT8_C(0xb0), UINT8_C(0x5c), UINT8_C(0x51), UINT8_C(0xb1), UINT8_C(0xbc), UINT8_C(0x50), UINT8_C(0x5d),
+    /* I13_HI */
+    UINT8_C(0x00), UINT8_C(0x7b), UINT8_C(0x1a), UINT8_C(0x61), UINT8_C(0xd9), UINT8_C(0xa2), UINT8_C(0xc3), UINT8_C(0xb8),
+    UINT8_C(0x18), UINT8_C(0x63), UINT8_C(0x02), UINT8_C(0x79), UINT8_C(0xc1), UINT8_C(0xba), UINT8_C(0xdb), UINT8_C(0xa0),
+    /* I14 */
+    UINT8_C(0x00), UINT8_C(0x0e), UINT8_C(0x05), UINT8_C(0x0b), UINT8_C(0x37), UINT8_C(0x39), UINT8_C(0x32), UINT8_C(0x3c),
+    UINT8_C(0x4d), UINT8_C(0x43), UINT8_C(0x48), UINT8_C(0x46), UINT8_C(0x7a), UINT8_C(0x74), UINT8_C(0x7f), UINT8_C(0x71),
+    /* I14_HI */
+    UINT8_C(0x00), UINT8_C(0x86), UINT8_C(0x1c), UINT8_C(0x9a), UINT8_C(0x0a), UINT8_C(0x8c), UINT8_C(0x16), UINT8_C(0x90),
+    UINT8_C(0x6e), UINT8_C(0xe8), UINT8_C(0x72), UINT8_C(0xf4), UINT8_C(0x64), UINT8_C(0xe2), UINT8_C(0x78), UINT8_C(0xfe),
+    /* M9 */
+    UINT8_C(0x00), UINT8_C(0x09), UINT8_C(0x12), UINT8_C(0x1b), UINT8_C(0x24), UINT8_C(0x2d), UINT8_C(0x36), UINT8_C(0x3f),
+    UINT8_C(0x48), UINT8_C(0x41), UINT8_C(0x5a), UINT8_C(0x53), UINT8_C(0x6c), UINT8_C(0x65), UINT8_C(0x7e), UINT8_C(0x77),
+    /* M9_HI */
+    UINT8_C(0x00), UINT8_C(0x90), UINT8_C(0x3b), UINT8_C(0xab), UINT8_C(0x76), UINT8_C(0xe6), UINT8_C(0x4d), UINT8_C(0xdd),
+    UINT8_C(0xec), UINT8_C(0x7c), UINT8_C(0xd7), UINT8_C(0x47), UINT8_C(0x9a), UINT8_C(0x0a), UINT8_C(0xa1), UINT8_C(0x31),
+    /* M11 */
+    UINT8_C(0x00), UINT8_C(0x0b), UINT8_C(0x16), UINT8_C(0x1d), UINT8_C(0x2c), UINT8_C(0x27), UINT8_C(0x3a), UINT8_C(0x31),
+    UINT8_C(0x58), UINT8_C(0x53), UINT8_C(0x4e), UINT8_C(0x45), UINT8_C(0x74), UINT8_C(0x7f), UINT8_C(0x62), UINT8_C(0x69),
+    /* M11_HI */
+    UINT8_C(0x00), UINT8_C(0xb0), UINT8_C(0x7b), UINT8_C(0xcb), UINT8_C(0xf6), UINT8_C(0x46), UINT8_C(0x8d), UINT8_C(0x3d),
+    UINT8_C(0xf7), UINT8_C(0x47), UINT8_C(0x8c), UINT8_C(0x3c), UINT8_C(0x01), UINT8_C(0xb1), UINT8_C(0x7a), UINT8_C(0xca),
+    /* M13 */
+    UINT8_C(0x00), UINT8_C(0x0d), UINT8_C(0x1a), UINT8_C(0x17), UINT8_C(0x34), UINT8_C(0x39), UINT8_C(0x2e), UINT8_C(0x23),
+    UINT8_C(0x68), UINT8_C(0x65), UINT8_C(0x72), UINT8_C(0x7f), UINT8_C(0x5c), UINT8_C(0x51), UINT8_C(0x46), UINT8_C(0x4b),
+    /* M13_HI */
+    UINT8_C(0x00), UINT8_C(0xd0), UINT8_C(0xbb), UINT8_C(0x6b), UINT8_C(0x6d), UINT8_C(0xbd), UINT8_C(0xd6), UINT8_C(0x06),
+    UINT8_C(0xda), UINT8_C(0x0a), UINT8_C(0x61), UINT8_C(0xb1), UINT8_C(0xb7), UINT8_C(0x67), UINT8_C(0x0c), UINT8_C(0xdc),
+    /* M14 */
+    UINT8_C(0x00), UINT8_C(0x0e), UINT8_C(0x1c), UINT8_C(0x12), UINT8_C(0x38), UINT8_C(0x36), UINT8_C(0x24), UINT8_C(0x2a),
+    UINT8_C(0x70), UINT8_C(0x7e), UINT8_C(0x6c), UINT8_C(0x62), UINT8_C(0x48), UINT8_C(0x46), UINT8_C(0x54), UINT8_C(0x5a),
+    /* M14_HI */
+    UINT8_C(0x00), UINT8_C(0xe0), UINT8_C(0xdb), UINT8_C(0x3b), UINT8_C(0xad), UINT8_C(0x4d), UINT8_C(0x76), UINT8_C(0x96),
+    UINT8_C(0x41), UINT8_C(0xa1), UINT8_C(0x9a), UINT8_C(0x7a), UINT8_C(0xec), UINT8_C(0x0c), UINT8_C(0x37), UINT8_C(0xd7),
+    /* SHIFT_ROWS */
+    UINT8_C(0x00), UINT8_C(0x05), UINT8_C(0x0a), UINT8_C(0x0f), UINT8_C(0x04), UINT8_C(0x09), UINT8_C(0x0e), UINT8_C(0x03),
+    UINT8_C(0x08), UINT8_C(0x0d), UINT8_C(0x02), UINT8_C(0x07), UINT8_C(0x0c), UINT8_C(0x01), UINT8_C(0x06), UINT8_C(0x0b),
+    /* INV_SHIFT_ROWS */
+    UINT8_C(0x00), UINT8_C(0x0d), UINT8_C(0x0a), UINT8_C(0x07), UINT8_C(0x04), UINT8_C(0x01), UINT8_C(0x0e), UINT8_C(0x0b),
+    UINT8_C(0x08), UINT8_C(0x05), UINT8_C(0x02), UINT8_C(0x0f), UINT8_C(0x0c), UINT8_C(0x09), UINT8_C(0x06), UINT8_C(0x03),
+    /* ROT1 */
+    UINT8_C(0x01), UINT8_C(0x02), UINT8_C(0x03), UINT8_C(0x00), UINT8_C(0x05), UINT8_C(0x06), UINT8_C(0x07), UINT8_C(0x04),
+    UINT8_C(0x09), UINT8_C(0x0a), UINT8_C(0x0b), UINT8_C(0x08), UINT8_C(0x0d), UINT8_C(0x0e), UINT8_C(0x0f), UINT8_C(0x0c),
+    /* ROT2 */
+    UINT8_C(0x02), UINT8_C(0x03), UINT8_C(0x00), UINT8_C(0x01), UINT8_C(0x06), UINT8_C(0x07), UINT8_C(0x04), UINT8_C(0x05),
+    UINT8_C(0x0a), UINT8_C(0x0b), UINT8_C(0x08), UINT8_C(0x09), UINT8_C(0x0e), UINT8_C(0x0f), UINT8_C(0x0c), UINT8_C(0x0d),
+    /* ROT3 */
+    UINT8_C(0x03), UINT8_C(0x00), UINT8_C(0x01), UINT8_C(0x02), UINT8_C(0x07), UINT8_C(0x04), UINT8_C(0x05), UINT8_C(0x06),
+    UINT8_C(0x0b), UINT8_C(0x08), UINT8_C(0x09), UINT8_C(0x0a), UINT8_C(0x0f), UINT8_C(0x0c), UINT8_C(0x0d), UINT8_C(0x0e),
+    /* KEYGEN */
+    UINT8_C(0x04), UINT8_C(0x05), UINT8_C(0x06), UINT8_C(0x07), UINT8_C(0x05), UINT8_C(0x06), UINT8_C(0x07), UINT8_C(0x04),
+    UINT8_C(0x0c), UINT8_C(0x0d), UINT8_C(0x0e), UINT8_C(0x0f), UINT8_C(0x0d), UINT8_C(0x0e), UINT8_C(0x0f), UINT8_C(0x0c),
+    /* KEYGEN_SHIFTED */
+    UINT8_C(0x04), UINT8_C(0x01), UINT8_C(0x0e), UINT8_C(0x0b), UINT8_C(0x01), UINT8_C(0x0e), UINT8_C(0x0b), UINT8_C(0x04),
+    UINT8_C(0x0c), UINT8_C(0x09), UINT8_C(0x06), UINT8_C(0x03), UINT8_C(0x09), UINT8_C(0x06), UINT8_C(0x03), UINT8_C(0x0c)
+  }
+};
+
+/* Applies one of the fixed byte permutations in simde_x_aes_tables_.
+ * Without a native byte shuffle, simde_mm_shuffle_epi8 is a loop over
+ * the control, which is several times slower than letting the
+ * compiler see the permutation.  Plain SSE2 can't permute bytes
+ * either, but ShiftRows just rotates row r (the same byte of every
+ * column) by r columns, and the other rotations stay within a column,
+ * so they are whole-column shuffles and 32-bit rotates. */
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_aes_permute_ (simde__m128i a, const int table) {
+  #if defined(SIMDE_X_AES_VPERM_)
+    /* The generic shuffle below is a single instruction. */
+  #elif defined(SIMDE_X86_SSE2_NATIVE)
+    const simde__m128i
+      row0 = simde_mm_set1_epi32(0x000000ff),
+      row1 = simde_mm_set1_epi32(0x0000ff00),
+      row2 = simde_mm_set1_epi32(0x00ff0000),
+      row3 = simde_mm_set1_epi32(HEDLEY_STATIC_CAST(int32_t, UINT32_C(0xff000000)));
+
+    switch (table) {
+      case SIMDE_X_AES_TABLE_SHIFT_ROWS_:
+        return
+          simde_mm_or_si128(
+            simde_mm_or_si128(
+              simde_mm_and_si128(row0, a),
+              simde_mm_and_si128(row1, simde_mm_shuffle_epi32(a, 0x39))
+            ),
+            simde_mm_or_si128(
+              simde_mm_and_si128(row2, simde_mm_shuffle_epi32(a, 0x4e)),
+              simde_mm_and_si128(row3, simde_mm_shuffle_epi32(a, 0x93))
+            )
+          );
+      case SIMDE_X_AES_TABLE_INV_SHIFT_ROWS_:
+        return
+          simde_mm_or_si128(
+            simde_mm_or_si128(
+              simde_mm_and_si128(row0, a),
+              simde_mm_and_si128(row1, simde_mm_shuffle_epi32(a, 0x93))
+            ),
+            simde_mm_or_si128(
+              simde_mm_and_si128(row2, simde_mm_shuffle_epi32(a, 0x4e)),
+              simde_mm_and_si128(row3, simde_mm_shuffle_epi32(a, 0x39))
+            )
+          );
+      case SIMDE_X_AES_TABLE_ROT1_:
+        return simde_mm_or_si128(simde_mm_srli_epi32(a,  8), simde_mm_slli_epi32(a, 24));
+      case SIMDE_X_AES_TABLE_ROT2_:
+        return simde_mm_or_si128(simde_mm_srli_epi32(a, 16), simde_mm_slli_epi32(a, 16));
+      case SIMDE_X_AES_TABLE_ROT3_:
+        return simde_mm_or_si128(simde_mm_srli_epi32(a, 24), simde_mm_slli_epi32(a,  8));
+      default:
+        break;
+    }
+  #elif defined(SIMDE_SHUFFLE_VECTOR_)
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a);
+
+    switch (table) {
+      case SIMDE_X_AES_TABLE_SHIFT_ROWS_:
+        r_.i8 = SIMDE_SHUFFLE_VECTOR_(8, 16, a_.i8, a_.i8, 0, 5, 10, 15, 4, 9, 14, 3, 8, 13, 2, 7, 12, 1, 6, 11);
+        return simde__m128i_from_private(r_);
+      case SIMDE_X_AES_TABLE_INV_SHIFT_ROWS_:
+        r_.i8 = SIMDE_SHUFFLE_VECTOR_(8, 16, a_.i8, a_.i8, 0, 13, 10, 7, 4, 1, 14, 11, 8, 5, 2, 15, 12, 9, 6, 3);
+        return simde__m128i_from_private(r_);
+      case SIMDE_X_AES_TABLE_ROT1_:
+        r_.i8 = SIMDE_SHUFFLE_VECTOR_(8, 16, a_.i8, a_.i8, 1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12);
+        return simde__m128i_from_private(r_);
+      case SIMDE_X_AES_TABLE_ROT2_:
+        r_.i8 = SIMDE_SHUFFLE_VECTOR_(8, 16, a_.i8, a_.i8, 2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+        return simde__m128i_from_private(r_);
+      case SIMDE_X_AES_TABLE_ROT3_:
+        r_.i8 = SIMDE_SHUFFLE_VECTOR_(8, 16, a_.i8, a_.i8, 3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14);
+        return simde__m128i_from_private(r_);
+      case SIMDE_X_AES_TABLE_KEYGEN_:
+        r_.i8 = SIMDE_SHUFFLE_VECTOR_(8, 16, a_.i8, a_.i8, 4, 5, 6, 7, 5, 6, 7, 4, 12, 13, 14, 15, 13, 14, 15, 12);
+        return simde__m128i_from_private(r_);
+      case SIMDE_X_AES_TABLE_KEYGEN_SHIFTED_:
+        r_.i8 = SIMDE_SHUFFLE_VECTOR_(8, 16, a_.i8, a_.i8, 4, 1, 14, 11, 1, 14, 11, 4, 12, 9, 6, 3, 9, 6, 3, 12);
+        return simde__m128i_from_private(r_);
+      default:
+        break;
+    }
+  #endif
+
+  return simde_mm_shuffle_epi8(a, simde_x_aes_tables_.m128i[table]);
+}
+
+#if defined(SIMDE_X_AES_VPERM_)
+/* Maps each byte of x through a linear (or affine) function whose
+ * values for the low and high nibbles are stored in table and
+ * table + 1. */
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_aes_lookup_ (simde__m128i x, const int table) {
+  const simde__m128i mask = simde_mm_set1_epi8(0x0f);
+
+  return
+    simde_mm_xor_si128(
+      simde_mm_shuffle_epi8(simde_x_aes_tables_.m128i[table    ], simde_mm_and_si128(x, mask)),
+      simde_mm_shuffle_epi8(simde_x_aes_tables_.m128i[table + 1], simde_mm_and_si128(simde_mm_srli_epi16(x, 4), mask))
+    );
+}
+
+/* Product of two GF(2^4) elements given their logarithms.  The log of
+ * zero is 0xf0, so the (saturated) sum keeps the high bit set and the
+ * final shuffle returns 0. */
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_aes_gf16_mul_ (simde__m128i log_a, simde__m128i log_b) {
+  simde__m128i s = simde_mm_adds_epu8(log_a, log_b);
+  s = simde_mm_min_epu8(s, simde_mm_sub_epi8(s, simde_mm_set1_epi8(15)));
+  return simde_mm_shuffle_epi8(simde_x_aes_tables_.m128i[SIMDE_X_AES_TABLE_EXP_], s);
+}
+
+/* Multiplicative inverse of each byte, in the GF((2^4)^2) basis. */
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_aes_inverse_ (simde__m128i x) {
+  const simde__m128i mask = simde_mm_set1_epi8(0x0f);
+  const simde__m128i l = simde_mm_and_si128(x, mask);
+  const simde__m128i h = simde_mm_and_si128(simde_mm_srli_epi16(x, 4), mask);
+  const simde__m128i log_h = simde_mm_shuffle_epi8(simde_x_aes_tables_.m128i[SIMDE_X_AES_TABLE_LOG_], h);
+  const simde__m128i log_l = simde_mm_shuffle_epi8(simde_x_aes_tables_.m128i[SIMDE_X_AES_TABLE_LOG_], l);
+  const simde__m128i log_hl = simde_mm_shuffle_epi8(simde_x_aes_tables_.m128i[SIMDE_X_AES_TABLE_LOG_], simde_mm_xor_si128(h, l));
+
+  simde__m128i d =
+    simde_mm_xor_si128(
+      simde_mm_xor_si128(
+        simde_mm_shuffle_epi8(simde_x_aes_tables_.m128i[SIMDE_X_AES_TABLE_SQL_], h),
+        simde_mm_shuffle_epi8(simde_x_aes_tables_.m128i[SIMDE_X_AES_TABLE_SQ_], l)
+      ),
+      simde_x_aes_gf16_mul_(log_h, log_l)
+    );
+  d = simde_mm_shuffle_epi8(simde_x_aes_tables_.m128i[SIMDE_X_AES_TABLE_LOGINV_], d);
+
+  return
+    simde_mm_or_si128(
+      simde_mm_slli_epi16(simde_x_aes_gf16_mul_(log_h, d), 4),
+      simde_x_aes_gf16_mul_(log_hl, d)
+    );
+}
+#else
+/* Transposes the 8x8 bit matrix in x, where byte i is row i. */
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_x_aes_transpose8_ (uint64_t x) {
+  uint64_t t;
+
+  t = (x ^ (x >>  7)) & UINT64_C(0x00aa00aa00aa00aa);
+  x ^= t ^ (t <<  7);
+  t = (x ^ (x >> 14)) & UINT64_C(0x0000cccc0000cccc);
+  x ^= t ^ (t << 14);
+  t = (x ^ (x >> 28)) & UINT64_C(0x00000000f0f0f0f0);
+  x ^= t ^ (t << 28);
+
+  return x;
+}
+
+#if defined(SIMDE_X86_SSE2_NATIVE)
+/* simde_x_aes_transpose8_ on both halves of x at once. */
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_aes_transpose8_x2_ (simde__m128i x) {
+  simde__m128i t;
+
+  t = simde_mm_and_si128(simde_mm_xor_si128(x, simde_mm_srli_epi64(x,  7)), simde_mm_set1_epi64x(INT64_C(0x00aa00aa00aa00aa)));
+  x = simde_mm_xor_si128(x, simde_mm_xor_si128(t, simde_mm_slli_epi64(t,  7)));
+  t = simde_mm_and_si128(simde_mm_xor_si128(x, simde_mm_srli_epi64(x, 14)), simde_mm_set1_epi64x(INT64_C(0x0000cccc0000cccc)));
+  x = simde_mm_xor_si128(x, simde_mm_xor_si128(t, simde_mm_slli_epi64(t, 14)));
+  t = simde_mm_and_si128(simde_mm_xor_si128(x, simde_mm_srli_epi64(x, 28)), simde_mm_set1_epi64x(INT64_C(0x00000000f0f0f0f0)));
+  x = simde_mm_xor_si128(x, simde_mm_xor_si128(t, simde_mm_slli_epi64(t, 28)));
+
+  return x;
+}
+#endif
+
+/* Splits the state into bit planes: bit j of q[i] is bit i of byte j. */
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_aes_bitslice_ (uint32_t q[8], simde__m128i a) {
+  #if defined(SIMDE_X86_SSE2_NATIVE)
+    /* After transposing each half, interleaving the halves leaves
+     * plane i in 16-bit element i. */
+    uint16_t p[8];
+
+    a = simde_x_aes_transpose8_x2_(a);
+    simde_mm_storeu_si128(HEDLEY_REINTERPRET_CAST(simde__m128i*, p), simde_mm_unpacklo_epi8(a, simde_mm_unpackhi_epi64(a, a)));
+
+    for (size_t i = 0 ; i < 8 ; i++) {
+      q[i] = p[i];
+    }
+  #else
+    uint64_t w[2];
+
+    /* The byte order within w doesn't matter as long as
+     * simde_x_aes_unbitslice_ undoes it. */
+    simde_memcpy(w, &a, sizeof(w));
+    w[0] = simde_x_aes_transpose8_(w[0]);
+    w[1] = simde_x_aes_transpose8_(w[1]);
+
+    for (size_t i = 0 ; i < 8 ; i++) {
+      q[i] = HEDLEY_STATIC_CAST(uint32_t, ((w[0] >> (i * 8)) & 0xff) | (((w[1] >> (i * 8)) & 0xff) << 8));
+    }
+  #endif
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_aes_unbitslice_ (const uint32_t q[8]) {
+  #if defined(SIMDE_X86_SSE2_NATIVE)
+    uint16_t p[8];
+
+    for (size_t i = 0 ; i < 8 ; i++) {
+      p[i] = HEDLEY_STATIC_CAST(uint16_t, q[i]);
+    }
+
+    const simde__m128i x = simde_mm_loadu_si128(HEDLEY_REINTERPRET_CAST(const simde__m128i*, p));
+    return simde_x_aes_transpose8_x2_(simde_mm_packus_epi16(simde_mm_and_si128(x, simde_mm_set1_epi16(0xff)), simde_mm_srli_epi16(x, 8)));
+  #else
+    simde__m128i r;
+    uint64_t w[2] = { 0, 0 };
+
+    for (size_t i = 0 ; i < 8 ; i++) {
+      w[0] |= HEDLEY_STATIC_CAST(uint64_t, q[i] & 0xff) << (i * 8);
+      w[1] |= HEDLEY_STATIC_CAST(uint64_t, (q[i] >> 8) & 0xff) << (i * 8);
+    }
+
+    w[0] = simde_x_aes_transpose8_(w[0]);
+    w[1] = simde_x_aes_transpose8_(w[1]);
+
+    simde_memcpy(&r, w, sizeof(r));
+
+    return r;
+  #endif
+}
+
+/* The S-box circuit from Joan Boyar and René Peralta, "A depth-16
+ * circuit for the AES S-box" (2011), on bit planes. */
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_aes_sbox_ (uint32_t q[8]) {
+  uint32_t
+    x0 = q[7], x1 = q[6], x2 = q[5], x3 = q[4],
+    x4 = q[3], x5 = q[2], x6 = q[1], x7 = q[0];
+  uint32_t y1, y2, y3, y4, y5, y6, y7, y8, y9, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19, y20, y21;
+  uint32_t z0, z1, z2, z3, z4, z5, z6, z7, z8, z9, z10, z11, z12, z13, z14, z15, z16, z17;
+  uint32_t
+    t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11, t12, t13, t14, t15, t16,
+    t17, t18, t19, t20, t21, t22, t23, t24, t25, t26, t27, t28, t29, t30, t31, t32,
+    t33, t34, t35, t36, t37, t38, t39, t40, t41, t42, t43, t44, t45, t46, t47, t48,
+    t49, t50, t51, t52, t53, t54, t55, t56, t57, t58, t59, t60, t61, t62, t63, t64,
+    t65, t66, t67;
+
+  /* Top linear transformation. */
+  y14 = x3 ^ x5;
+  y13 = x0 ^ x6;
+  y9 = x0 ^ x3;
+  y8 = x0 ^ x5;
+  t0 = x1 ^ x2;
+  y1 = t0 ^ x7;
+  y4 = y1 ^ x3;
+  y12 = y13 ^ y14;
+  y2 = y1 ^ x0;
+  y5 = y1 ^ x6;
+  y3 = y5 ^ y8;
+  t1 = x4 ^ y12;
+  y15 = t1 ^ x5;
+  y20 = t1 ^ x1;
+  y6 = y15 ^ x7;
+  y10 = y15 ^ t0;
+  y11 = y20 ^ y9;
+  y7 = x7 ^ y11;
+  y17 = y10 ^ y11;
+  y19 = y10 ^ y8;
+  y16 = t0 ^ y11;
+  y21 = y13 ^ y16;
+  y18 = x0 ^ y16;
+
+  /* Non-linear section. */
+  t2 = y12 & y15;
+  t3 = y3 & y6;
+  t4 = t3 ^ t2;
+  t5 = y4 & x7;
+  t6 = t5 ^ t2;
+  t7 = y13 & y16;
+  t8 = y5 & y1;
+  t9 = t8 ^ t7;
+  t10 = y2 & y7;
+  t11 = t10 ^ t7;
+  t12 = y9 & y11;
+  t13 = y14 & y17;
+  t14 = t13 ^ t12;
+  t15 = y8 & y10;
+  t16 = t15 ^ t12;
+  t17 = t4 ^ t14;
+  t18 = t6 ^ t16;
+  t19 = t9 ^ t14;
+  t20 = t11 ^ t16;
+  t21 = t17 ^ y20;
+  t22 = t18 ^ y19;
+  t23 = t19 ^ y21;
+  t24 = t20 ^ y18;
+
+  t25 = t21 ^ t22;
+  t26 = t21 & t23;
+  t27 = t24 ^ t26;
+  t28 = t25 & t27;
+  t29 = t28 ^ t22;
+  t30 = t23 ^ t24;
+  t31 = t22 ^ t26;
+  t32 = t31 & t30;
+  t33 = t32 ^ t24;
+  t34 = t23 ^ t33;
+  t35 = t27 ^ t33;
+  t36 = t24 & t35;
+  t37 = t36 ^ t34;
+  t38 = t27 ^ t36;
+  t39 = t29 & t38;
+  t40 = t25 ^ t39;
+
+  t41 = t40 ^ t37;
+  t42 = t29 ^ t33;
+  t43 = t29 ^ t40;
+  t44 = t33 ^ t37;
+  t45 = t42 ^ t41;
+  z0 = t44 & y15;
+  z1 = t37 & y6;
+  z2 = t33 & x7;
+  z3 = t43 & y16;
+  z4 = t40 & y1;
+  z5 = t29 & y7;
+  z6 = t42 & y11;
+  z7 = t45 & y17;
+  z8 = t41 & y10;
+  z9 = t44 & y12;
+  z10 = t37 & y3;
+  z11 = t33 & y4;
+  z12 = t43 & y13;
+  z13 = t40 & y5;
+  z14 = t29 & y2;
+  z15 = t42 & y9;
+  z16 = t45 & y14;
+  z17 = t41 & y8;
+
+  /* Bottom linear transformation. */
+  t46 = z15 ^ z16;
+  t47 = z10 ^ z11;
+  t48 = z5 ^ z13;
+  t49 = z9 ^ z10;
+  t50 = z2 ^ z12;
+  t51 = z2 ^ z5;
+  t52 = z7 ^ z8;
+  t53 = z0 ^ z3;
+  t54 = z6 ^ z7;
+  t55 = z16 ^ z17;
+  t56 = z12 ^ t48;
+  t57 = t50 ^ t53;
+  t58 = z4 ^ t46;
+  t59 = z3 ^ t54;
+  t60 = t46 ^ t57;
+  t61 = z14 ^ t57;
+  t62 = t52 ^ t58;
+  t63 = t49 ^ t58;
+  t64 = z4 ^ t59;
+  t65 = t61 ^ t62;
+  t66 = z1 ^ t63;
+  t67 = t64 ^ t65;
+
+  q[7] = t59 ^ t63;
+  q[1] = t56 ^ ~t62;
+  q[0] = t48 ^ ~t60;
+  q[4] = t53 ^ t66;
+  q[3] = t51 ^ t66;
+  q[2] = t47 ^ t65;
+  q[6] = t64 ^ ~q[4];
+  q[5] = t55 ^ ~t67;
+}
+
+/* The inverse of the affine transformation in the S-box (x ^ 0x63,
+ * then the inverse of the linear part).  Since the S-box is
+ * A(1 / x), the inverse S-box is B(S(B(x))). */
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_x_aes_inv_affine_ (uint32_t q[8]) {
+  const uint32_t
+    q0 = ~q[0], q1 = ~q[1], q2 = q[2], q3 = q[3],
+    q4 = q[4], q5 = ~q[5], q6 = ~q[6], q7 = q[7];
+
+  q[7] = q1 ^ q4 ^ q6;
+  q[6] = q0 ^ q3 ^ q5;
+  q[5] = q7 ^ q2 ^ q4;
+  q[4] = q6 ^ q1 ^ q3;
+  q[3] = q5 ^ q0 ^ q2;
+  q[2] = q4 ^ q7 ^ q1;
+  q[1] = q3 ^ q6 ^ q0;
+  q[0] = q2 ^ q5 ^ q7;
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_aes_sub_bytes_ (simde__m128i a) {
+  uint32_t q[8];
+
+  simde_x_aes_bitslice_(q, a);
+  simde_x_aes_sbox_(q);
+  return simde_x_aes_unbitslice_(q);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_aes_inv_sub_bytes_ (simde__m128i a) {
+  uint32_t q[8];
+
+  simde_x_aes_bitslice_(q, a);
+  simde_x_aes_inv_affine_(q);
+  simde_x_aes_sbox_(q);
+  simde_x_aes_inv_affine_(q);
+  return simde_x_aes_unbitslice_(q);
+}
+#endif
+
+/* Rotates the bytes within each column (32-bit element) and XORs the
+ * four results together; this is the last step of (Inv)MixColumns. */
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_aes_mix_columns_ (simde__m128i r0, simde__m128i r1, simde__m128i r2, simde__m128i r3) {
+  return
+    simde_mm_xor_si128(
+      simde_mm_xor_si128(r0, simde_x_aes_permute_(r1, SIMDE_X_AES_TABLE_ROT1_)),
+      simde_mm_xor_si128(
+        simde_x_aes_permute_(r2, SIMDE_X_AES_TABLE_ROT2_),
+        simde_x_aes_permute_(r3, SIMDE_X_AES_TABLE_ROT3_)
+      )
+    );
+}
+
+/* Multiplies each byte by x in GF(2^8). */
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_aes_xtime_ (simde__m128i a) {
+  return
+    simde_mm_xor_si128(
+      simde_mm_add_epi8(a, a),
+      simde_mm_and_si128(simde_mm_cmplt_epi8(a, simde_mm_setzero_si128()), simde_mm_set1_epi8(0x1b))
+    );
+}
+
+#if !defined(SIMDE_X_AES_VPERM_)
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_aes_inv_mix_columns_ (simde__m128i a) {
+  const simde__m128i a2 = simde_x_aes_xtime_(a);
+  const simde__m128i a4 = simde_x_aes_xtime_(a2);
+  const simde__m128i a8 = simde_x_aes_xtime_(a4);
+  const simde__m128i a9 = simde_mm_xor_si128(a8, a);
+
+  return
+    simde_x_aes_mix_columns_(
+      simde_mm_xor_si128(simde_mm_xor_si128(a8, a4), a2),
+      simde_mm_xor_si128(a9, a2),
+      simde_mm_xor_si128(a9, a4),
+      a9
+    );
+}
+#endif
+
+#if defined(SIMDE_POWER_ALTIVEC_P8_NATIVE) && defined(__CRYPTO__)
+/* The POWER8 crypto instructions always use big-endian byte order. */
+SIMDE_FUNCTION_ATTRIBUTES
+SIMDE_POWER_ALTIVEC_VECTOR(unsigned char)
+simde_x_aes_altivec_be_ (SIMDE_POWER_ALTIVEC_VECTOR(unsigned char) v) {
+  #if SIMDE_ENDIAN_ORDER == SIMDE_ENDIAN_LITTLE
+    return vec_reve(v);
+  #else
+    return v;
+  #endif
+}
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_aesenc_si128 (simde__m128i a, simde__m128i round_key) {
+  #if defined(SIMDE_X86_AES_NATIVE)
+    return _mm_aesenc_si128(a, round_key);
+  #elif \
+      (defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_AES)) || \
+      (defined(SIMDE_POWER_ALTIVEC_P8_NATIVE) && defined(__CRYPTO__))
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      round_key_ = simde__m128i_to_private(round_key);
+
+    #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_AES)
+      r_.neon_u8 = veorq_u8(vaesmcq_u8(vaeseq_u8(a_.neon_u8, vdupq_n_u8(0))), round_key_.neon_u8);
+    #else
+      r_.altivec_u8 = simde_x_aes_altivec_be_(vec_cipher_be(simde_x_aes_altivec_be_(a_.altivec_u8), simde_x_aes_altivec_be_(round_key_.altivec_u8)));
+    #endif
+
+    return simde__m128i_from_private(r_);
+  #elif defined(SIMDE_X_AES_VPERM_)
+    simde__m128i y = simde_x_aes_permute_(a, SIMDE_X_AES_TABLE_SHIFT_ROWS_);
+    y = simde_x_aes_inverse_(simde_x_aes_lookup_(y, SIMDE_X_AES_TABLE_PHI_));
+
+    const simde__m128i s1 = simde_x_aes_lookup_(y, SIMDE_X_AES_TABLE_S_);
+    const simde__m128i s2 = simde_x_aes_lookup_(y, SIMDE_X_AES_TABLE_S2_);
+    return simde_mm_xor_si128(simde_x_aes_mix_columns_(s2, simde_mm_xor_si128(s1, s2), s1, s1), round_key);
+  #else
+    const simde__m128i s1 = simde_x_aes_sub_bytes_(simde_x_aes_permute_(a, SIMDE_X_AES_TABLE_SHIFT_ROWS_));
+    const simde__m128i s2 = simde_x_aes_xtime_(s1);
+    return simde_mm_xor_si128(simde_x_aes_mix_columns_(s2, simde_mm_xor_si128(s1, s2), s1, s1), round_key);
+  #endif
+}
+#if defined(SIMDE_X86_AES_ENABLE_NATIVE_ALIASES)
+  #define _mm_aesenc_si128(a, round_key) simde_mm_aesenc_si128(a, round_key)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_aesenclast_si128 (simde__m128i a, simde__m128i round_key) {
+  #if defined(SIMDE_X86_AES_NATIVE)
+    return _mm_aesenclast_si128(a, round_key);
+  #elif \
+      (defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_AES)) || \
+      (defined(SIMDE_POWER_ALTIVEC_P8_NATIVE) && defined(__CRYPTO__))
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      round_key_ = simde__m128i_to_private(round_key);
+
+    #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_AES)
+      r_.neon_u8 = veorq_u8(vaeseq_u8(a_.neon_u8, vdupq_n_u8(0)), round_key_.neon_u8);
+    #else
+      r_.altivec_u8 = simde_x_aes_altivec_be_(vec_cipherlast_be(simde_x_aes_altivec_be_(a_.altivec_u8), simde_x_aes_altivec_be_(round_key_.altivec_u8)));
+    #endif
+
+    return simde__m128i_from_private(r_);
+  #elif defined(SIMDE_X_AES_VPERM_)
+    simde__m128i y = simde_x_aes_permute_(a, SIMDE_X_AES_TABLE_SHIFT_ROWS_);
+    y = simde_x_aes_inverse_(simde_x_aes_lookup_(y, SIMDE_X_AES_TABLE_PHI_));
+    return simde_mm_xor_si128(simde_x_aes_lookup_(y, SIMDE_X_AES_TABLE_S_), round_key);
+  #else
+    return simde_mm_xor_si128(simde_x_aes_sub_bytes_(simde_x_aes_permute_(a, SIMDE_X_AES_TABLE_SHIFT_ROWS_)), round_key);
+  #endif
+}
+#if defined(SIMDE_X86_AES_ENABLE_NATIVE_ALIASES)
+  #define _mm_aesenclast_si128(a, round_key) simde_mm_aesenclast_si128(a, round_key)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_aesdec_si128 (simde__m128i a, simde__m128i round_key) {
+  #if defined(SIMDE_X86_AES_NATIVE)
+    return _mm_aesdec_si128(a, round_key);
+  #elif \
+      (defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_AES)) || \
+      (defined(SIMDE_POWER_ALTIVEC_P8_NATIVE) && defined(__CRYPTO__))
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      round_key_ = simde__m128i_to_private(round_key);
+
+    #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_AES)
+      r_.neon_u8 = veorq_u8(vaesimcq_u8(vaesdq_u8(a_.neon_u8, vdupq_n_u8(0))), round_key_.neon_u8);
+    #else
+      /* vncipher adds the round key before InvMixColumns, so use a zero
+       * key and add the real one afterwards. */
+      r_.altivec_u8 = simde_x_aes_altivec_be_(vec_ncipher_be(simde_x_aes_altivec_be_(a_.altivec_u8), vec_splats(HEDLEY_STATIC_CAST(unsigned char, 0))));
+      r_.altivec_u8 = vec_xor(r_.altivec_u8, round_key_.altivec_u8);
+    #endif
+
+    return simde__m128i_from_private(r_);
+  #elif defined(SIMDE_X_AES_VPERM_)
+    simde__m128i y = simde_x_aes_permute_(a, SIMDE_X_AES_TABLE_INV_SHIFT_ROWS_);
+    y = simde_x_aes_inverse_(simde_x_aes_lookup_(y, SIMDE_X_AES_TABLE_IPHI_));
+
+    return
+      simde_mm_xor_si128(
+        simde_x_aes_mix_columns_(
+          simde_x_aes_lookup_(y, SIMDE_X_AES_TABLE_I14_),
+          simde_x_aes_lookup_(y, SIMDE_X_AES_TABLE_I11_),
+          simde_x_aes_lookup_(y, SIMDE_X_AES_TABLE_I13_),
+          simde_x_aes_lookup_(y, SIMDE_X_AES_TABLE_I9_)
+        ),
+        round_key
+      );
+  #else
+    const simde__m128i y = simde_x_aes_inv_sub_bytes_(simde_x_aes_permute_(a, SIMDE_X_AES_TABLE_INV_SHIFT_ROWS_));
+    return simde_mm_xor_si128(simde_x_aes_inv_mix_columns_(y), round_key);
+  #endif
+}
+#if defined(SIMDE_X86_AES_ENABLE_NATIVE_ALIASES)
+  #define _mm_aesdec_si128(a, round_key) simde_mm_aesdec_si128(a, round_key)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_aesdeclast_si128 (simde__m128i a, simde__m128i round_key) {
+  #if defined(SIMDE_X86_AES_NATIVE)
+    return _mm_aesdeclast_si128(a, round_key);
+  #elif \
+      (defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_AES)) || \
+      (defined(SIMDE_POWER_ALTIVEC_P8_NATIVE) && defined(__CRYPTO__))
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      round_key_ = simde__m128i_to_private(round_key);
+
+    #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_AES)
+      r_.neon_u8 = veorq_u8(vaesdq_u8(a_.neon_u8, vdupq_n_u8(0)), round_key_.neon_u8);
+    #else
+      r_.altivec_u8 = simde_x_aes_altivec_be_(vec_ncipherlast_be(simde_x_aes_altivec_be_(a_.altivec_u8), simde_x_aes_altivec_be_(round_key_.altivec_u8)));
+    #endif
+
+    return simde__m128i_from_private(r_);
+  #elif defined(SIMDE_X_AES_VPERM_)
+    simde__m128i y = simde_x_aes_permute_(a, SIMDE_X_AES_TABLE_INV_SHIFT_ROWS_);
+    y = simde_x_aes_inverse_(simde_x_aes_lookup_(y, SIMDE_X_AES_TABLE_IPHI_));
+    return simde_mm_xor_si128(simde_x_aes_lookup_(y, SIMDE_X_AES_TABLE_I1_), round_key);
+  #else
+    return simde_mm_xor_si128(simde_x_aes_inv_sub_bytes_(simde_x_aes_permute_(a, SIMDE_X_AES_TABLE_INV_SHIFT_ROWS_)), round_key);
+  #endif
+}
+#if defined(SIMDE_X86_AES_ENABLE_NATIVE_ALIASES)
+  #define _mm_aesdeclast_si128(a, round_key) simde_mm_aesdeclast_si128(a, round_key)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_aesimc_si128 (simde__m128i a) {
+  #if defined(SIMDE_X86_AES_NATIVE)
+    return _mm_aesimc_si128(a);
+  #elif \
+      (defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_AES)) || \
+      (defined(SIMDE_POWER_ALTIVEC_P8_NATIVE) && defined(__CRYPTO__))
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a);
+
+    #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_AES)
+      r_.neon_u8 = vaesimcq_u8(a_.neon_u8);
+    #else
+      /* SubBytes and ShiftRows commute, so vncipher undoes everything
+       * vcipherlast did except for the InvMixColumns step. */
+      const SIMDE_POWER_ALTIVEC_VECTOR(unsigned char) zero = vec_splats(HEDLEY_STATIC_CAST(unsigned char, 0));
+      r_.altivec_u8 = simde_x_aes_altivec_be_(vec_ncipher_be(vec_cipherlast_be(simde_x_aes_altivec_be_(a_.altivec_u8), zero), zero));
+    #endif
+
+    return simde__m128i_from_private(r_);
+  #elif defined(SIMDE_X_AES_VPERM_)
+    return
+      simde_x_aes_mix_columns_(
+        simde_x_aes_lookup_(a, SIMDE_X_AES_TABLE_M14_),
+        simde_x_aes_lookup_(a, SIMDE_X_AES_TABLE_M11_),
+        simde_x_aes_lookup_(a, SIMDE_X_AES_TABLE_M13_),
+        simde_x_aes_lookup_(a, SIMDE_X_AES_TABLE_M9_)
+      );
+  #else
+    return simde_x_aes_inv_mix_columns_(a);
+  #endif
+}
+#if defined(SIMDE_X86_AES_ENABLE_NATIVE_ALIASES)
+  #define _mm_aesimc_si128(a) simde_mm_aesimc_si128(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_aeskeygenassist_si128 (simde__m128i a, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  const simde__m128i rcon = simde_mm_set_epi32(imm8, 0, imm8, 0);
+  simde__m128i s;
+
+  #if \
+      (defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_AES)) || \
+      (defined(SIMDE_POWER_ALTIVEC_P8_NATIVE) && defined(__CRYPTO__))
+    /* AESE / vcipherlast do ShiftRows as well as SubBytes, which the
+     * shuffle has to undo. */
+    simde__m128i_private s_ = simde__m128i_to_private(a);
+    #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_AES)
+      s_.neon_u8 = vaeseq_u8(s_.neon_u8, vdupq_n_u8(0));
+    #else
+      s_.altivec_u8 = simde_x_aes_altivec_be_(vec_cipherlast_be(simde_x_aes_altivec_be_(s_.altivec_u8), vec_splats(HEDLEY_STATIC_CAST(unsigned char, 0))));
+    #endif
+    s = simde_x_aes_permute_(simde__m128i_from_private(s_), SIMDE_X_AES_TABLE_KEYGEN_SHIFTED_);
+  #elif defined(SIMDE_X_AES_VPERM_)
+    s = simde_x_aes_lookup_(simde_x_aes_inverse_(simde_x_aes_lookup_(a, SIMDE_X_AES_TABLE_PHI_)), SIMDE_X_AES_TABLE_S_);
+    s = simde_x_aes_permute_(s, SIMDE_X_AES_TABLE_KEYGEN_);
+  #else
+    s = simde_x_aes_permute_(simde_x_aes_sub_bytes_(a), SIMDE_X_AES_TABLE_KEYGEN_);
+  #endif
+
+  return simde_mm_xor_si128(s, rcon);
+}
+#if defined(SIMDE_X86_AES_NATIVE)
+  #define simde_mm_aeskeygenassist_si128(a, imm8) _mm_aeskeygenassist_si128(a, imm8)
+#endif
+#if defined(SIMDE_X86_AES_ENABLE_NATIVE_ALIASES)
+  #define _mm_aeskeygenassist_si128(a, imm8) simde_mm_aeskeygenassist_si128(a, imm8)
+#endif
+
+SIMDE_END_DECLS_
+
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AES_H) */
@@ -33,9 +33,11 @@
 #include "avx512/abs.h"
 #include "avx512/add.h"
 #include "avx512/adds.h"
+#include "avx512/alignr.h"
 #include "avx512/and.h"
 #include "avx512/andnot.h"
 #include "avx512/avg.h"
+#include "avx512/bitshuffle.h"
 #include "avx512/blend.h"
 #include "avx512/broadcast.h"
 #include "avx512/cast.h"
@@ -45,17 +47,40 @@
 #include "avx512/cmpgt.h"
 #include "avx512/cmple.h"
 #include "avx512/cmplt.h"
+#include "avx512/compress.h"
+#include "avx512/conflict.h"
 #include "avx512/copysign.h"
 #include "avx512/cvt.h"
 #include "avx512/cvts.h"
+#include "avx512/dbsad.h"
 #include "avx512/div.h"
+#include "avx512/dpbusd.h"
+#include "avx512/dpbusds.h"
+#include "avx512/dpwssd.h"
+#include "avx512/dpwssds.h"
+#include "avx512/expand.h"
 #include "avx512/extract.h"
+#include "avx512/fixupimm.h"
 #include "avx512/fmadd.h"
 #include "avx512/fmsub.h"
 #include "avx512/fnmadd.h"
 #include "avx512/fnmsub.h"
+#include "avx512/gather.h"
+#include "avx512/getexp.h"
+#include "avx512/getmant.h"
 #include "avx512/insert.h"
+#include "avx512/kadd.h"
+#include "avx512/kand.h"
+#include "avx512/kandn.h"
+#include "avx512/kmov.h"
+#include "avx512/knot.h"
+#include "avx512/kor.h"
+#include "avx512/kortest.h"
 #include "avx512/kshift.h"
+#include "avx512/ktest.h"
+#include "avx512/kunpack.h"
+#include "avx512/kxnor.h"
+#include "avx512/kxor.h"
 #include "avx512/load.h"
 #include "avx512/loadu.h"
 #include "avx512/lzcnt.h"
@@ -70,13 +95,22 @@
 #include "avx512/mulhi.h"
 #include "avx512/mulhrs.h"
 #include "avx512/mullo.h"
+#include "avx512/multishift.h"
 #include "avx512/negate.h"
 #include "avx512/or.h"
 #include "avx512/packs.h"
 #include "avx512/packus.h"
 #include "avx512/permutexvar.h"
 #include "avx512/permutex2var.h"
+#include "avx512/popcnt.h"
+#include "avx512/range.h"
+#include "avx512/rcp.h"
+#include "avx512/reduce.h"
+#include "avx512/roundscale.h"
+#include "avx512/rsqrt.h"
 #include "avx512/sad.h"
+#include "avx512/scalef.h"
+#include "avx512/scatter.h"
 #include "avx512/set.h"
 #include "avx512/set1.h"
 #include "avx512/set4.h"
@@ -84,6 +118,10 @@
 #include "avx512/setr4.h"
 #include "avx512/setzero.h"
 #include "avx512/setone.h"
+#include "avx512/shldi.h"
+#include "avx512/shldv.h"
+#include "avx512/shrdi.h"
+#include "avx512/shrdv.h"
 #include "avx512/shuffle.h"
 #include "avx512/sll.h"
 #include "avx512/slli.h"
@@ -99,6 +137,7 @@
 #include "avx512/storeu.h"
 #include "avx512/sub.h"
 #include "avx512/subs.h"
+#include "avx512/ternarylogic.h"
 #include "avx512/test.h"
 #include "avx512/unpacklo.h"
 #include "avx512/unpackhi.h"
@@ -0,0 +1,528 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#if !defined(SIMDE_X86_AVX512_ALIGNR_H)
+#define SIMDE_X86_AVX512_ALIGNR_H
+
+#include "types.h"
+#include "mov.h"
+#include "extract.h"
+#include "set.h"
+#include "setzero.h"
+#include "../avx2.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_alignr_epi8 (simde__m512i a, simde__m512i b, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+
+  if (HEDLEY_UNLIKELY(imm8 > 31))
+    return simde_mm512_setzero_si512();
+
+  for (size_t h = 0 ; h < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; h++) {
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.m128i_private[h].i8) / sizeof(r_.m128i_private[h].i8[0])) ; i++) {
+      const int srcpos = imm8 + HEDLEY_STATIC_CAST(int, i);
+      if (srcpos > 31) {
+        r_.m128i_private[h].i8[i] = 0;
+      } else if (srcpos > 15) {
+        r_.m128i_private[h].i8[i] = a_.m128i_private[h].i8[(srcpos) & 15];
+      } else {
+        r_.m128i_private[h].i8[i] = b_.m128i_private[h].i8[srcpos];
+      }
+    }
+  }
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512BW_NATIVE)
+  #define simde_mm512_alignr_epi8(a, b, imm8) _mm512_alignr_epi8(a, b, imm8)
+#elif SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+  #define simde_mm512_alignr_epi8(a, b, imm8) \
+    simde_x_mm512_set_m256i( \
+      simde_mm256_alignr_epi8(simde_mm512_extracti64x4_epi64(a, 1), simde_mm512_extracti64x4_epi64(b, 1), (imm8)), \
+      simde_mm256_alignr_epi8(simde_mm512_extracti64x4_epi64(a, 0), simde_mm512_extracti64x4_epi64(b, 0), (imm8)))
+#endif
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_alignr_epi8
+  #define _mm512_alignr_epi8(a, b, imm8) simde_mm512_alignr_epi8(a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_alignr_epi8(src, k, a, b, imm8) _mm_mask_alignr_epi8(src, k, a, b, imm8)
+#else
+  #define simde_mm_mask_alignr_epi8(src, k, a, b, imm8) simde_mm_mask_mov_epi8(src, k, simde_mm_alignr_epi8(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_alignr_epi8
+  #define _mm_mask_alignr_epi8(src, k, a, b, imm8) simde_mm_mask_alignr_epi8(src, k, a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_maskz_alignr_epi8(k, a, b, imm8) _mm_maskz_alignr_epi8(k, a, b, imm8)
+#else
+  #define simde_mm_maskz_alignr_epi8(k, a, b, imm8) simde_mm_maskz_mov_epi8(k, simde_mm_alignr_epi8(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_alignr_epi8
+  #define _mm_maskz_alignr_epi8(k, a, b, imm8) simde_mm_maskz_alignr_epi8(k, a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_alignr_epi8(src, k, a, b, imm8) _mm256_mask_alignr_epi8(src, k, a, b, imm8)
+#else
+  #define simde_mm256_mask_alignr_epi8(src, k, a, b, imm8) simde_mm256_mask_mov_epi8(src, k, simde_mm256_alignr_epi8(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_alignr_epi8
+  #define _mm256_mask_alignr_epi8(src, k, a, b, imm8) simde_mm256_mask_alignr_epi8(src, k, a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512BW_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_maskz_alignr_epi8(k, a, b, imm8) _mm256_maskz_alignr_epi8(k, a, b, imm8)
+#else
+  #define simde_mm256_maskz_alignr_epi8(k, a, b, imm8) simde_mm256_maskz_mov_epi8(k, simde_mm256_alignr_epi8(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_alignr_epi8
+  #define _mm256_maskz_alignr_epi8(k, a, b, imm8) simde_mm256_maskz_alignr_epi8(k, a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512BW_NATIVE)
+  #define simde_mm512_mask_alignr_epi8(src, k, a, b, imm8) _mm512_mask_alignr_epi8(src, k, a, b, imm8)
+#else
+  #define simde_mm512_mask_alignr_epi8(src, k, a, b, imm8) simde_mm512_mask_mov_epi8(src, k, simde_mm512_alignr_epi8(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_alignr_epi8
+  #define _mm512_mask_alignr_epi8(src, k, a, b, imm8) simde_mm512_mask_alignr_epi8(src, k, a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512BW_NATIVE)
+  #define simde_mm512_maskz_alignr_epi8(k, a, b, imm8) _mm512_maskz_alignr_epi8(k, a, b, imm8)
+#else
+  #define simde_mm512_maskz_alignr_epi8(k, a, b, imm8) simde_mm512_maskz_mov_epi8(k, simde_mm512_alignr_epi8(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_alignr_epi8
+  #define _mm512_maskz_alignr_epi8(k, a, b, imm8) simde_mm512_maskz_alignr_epi8(k, a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_alignr_epi32 (simde__m128i a, simde__m128i b, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  #if defined(SIMDE_X86_SSSE3_NATIVE) || defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    switch (imm8 & 3) {
+      case 0:
+        return b;
+      case 1:
+        return simde_mm_alignr_epi8(a, b, 4);
+      case 2:
+        return simde_mm_alignr_epi8(a, b, 8);
+      default:
+        return simde_mm_alignr_epi8(a, b, 12);
+    }
+  #else
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      b_ = simde__m128i_to_private(b);
+
+    const size_t n = HEDLEY_STATIC_CAST(size_t, imm8 & 3);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+      const size_t j = i + n;
+      r_.i32[i] = (j < 4) ? b_.i32[j] : a_.i32[j - 4];
+    }
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_alignr_epi32(a, b, imm8) _mm_alignr_epi32(a, b, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_alignr_epi32
+  #define _mm_alignr_epi32(a, b, imm8) simde_mm_alignr_epi32(a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_alignr_epi32(src, k, a, b, imm8) _mm_mask_alignr_epi32(src, k, a, b, imm8)
+#else
+  #define simde_mm_mask_alignr_epi32(src, k, a, b, imm8) simde_mm_mask_mov_epi32(src, k, simde_mm_alignr_epi32(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_alignr_epi32
+  #define _mm_mask_alignr_epi32(src, k, a, b, imm8) simde_mm_mask_alignr_epi32(src, k, a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_maskz_alignr_epi32(k, a, b, imm8) _mm_maskz_alignr_epi32(k, a, b, imm8)
+#else
+  #define simde_mm_maskz_alignr_epi32(k, a, b, imm8) simde_mm_maskz_mov_epi32(k, simde_mm_alignr_epi32(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_alignr_epi32
+  #define _mm_maskz_alignr_epi32(k, a, b, imm8) simde_mm_maskz_alignr_epi32(k, a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_alignr_epi32 (simde__m256i a, simde__m256i b, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b);
+
+  #if defined(SIMDE_X86_SSSE3_NATIVE) || defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    const simde__m128i c[4] = { b_.m128i[0], b_.m128i[1], a_.m128i[0], a_.m128i[1] };
+    const size_t q = HEDLEY_STATIC_CAST(size_t, (imm8 & 7) / 4);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+      switch (imm8 & 3) {
+        case 0:
+          r_.m128i[i] = c[q + i];
+          break;
+        case 1:
+          r_.m128i[i] = simde_mm_alignr_epi8(c[q + i + 1], c[q + i], 4);
+          break;
+        case 2:
+          r_.m128i[i] = simde_mm_alignr_epi8(c[q + i + 1], c[q + i], 8);
+          break;
+        default:
+          r_.m128i[i] = simde_mm_alignr_epi8(c[q + i + 1], c[q + i], 12);
+          break;
+      }
+    }
+  #else
+    const size_t n = HEDLEY_STATIC_CAST(size_t, imm8 & 7);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+      const size_t j = i + n;
+      r_.i32[i] = (j < 8) ? b_.i32[j] : a_.i32[j - 8];
+    }
+  #endif
+
+  return simde__m256i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_alignr_epi32(a, b, imm8) _mm256_alignr_epi32(a, b, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_alignr_epi32
+  #define _mm256_alignr_epi32(a, b, imm8) simde_mm256_alignr_epi32(a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_alignr_epi32(src, k, a, b, imm8) _mm256_mask_alignr_epi32(src, k, a, b, imm8)
+#else
+  #define simde_mm256_mask_alignr_epi32(src, k, a, b, imm8) simde_mm256_mask_mov_epi32(src, k, simde_mm256_alignr_epi32(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_alignr_epi32
+  #define _mm256_mask_alignr_epi32(src, k, a, b, imm8) simde_mm256_mask_alignr_epi32(src, k, a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_maskz_alignr_epi32(k, a, b, imm8) _mm256_maskz_alignr_epi32(k, a, b, imm8)
+#else
+  #define simde_mm256_maskz_alignr_epi32(k, a, b, imm8) simde_mm256_maskz_mov_epi32(k, simde_mm256_alignr_epi32(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_alignr_epi32
+  #define _mm256_maskz_alignr_epi32(k, a, b, imm8) simde_mm256_maskz_alignr_epi32(k, a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_alignr_epi32 (simde__m512i a, simde__m512i b, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+
+  #if defined(SIMDE_X86_SSSE3_NATIVE) || defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    /* Treat b:a as a run of 128-bit chunks; each chunk of the result is
+     * a byte alignr (palignr, or vext on NEON) of two neighbouring
+     * chunks, so no lane ever has to be moved on its own. */
+    const simde__m128i c[8] = { b_.m128i[0], b_.m128i[1], b_.m128i[2], b_.m128i[3], a_.m128i[0], a_.m128i[1], a_.m128i[2], a_.m128i[3] };
+    const size_t q = HEDLEY_STATIC_CAST(size_t, (imm8 & 15) / 4);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+      switch (imm8 & 3) {
+        case 0:
+          r_.m128i[i] = c[q + i];
+          break;
+        case 1:
+          r_.m128i[i] = simde_mm_alignr_epi8(c[q + i + 1], c[q + i], 4);
+          break;
+        case 2:
+          r_.m128i[i] = simde_mm_alignr_epi8(c[q + i + 1], c[q + i], 8);
+          break;
+        default:
+          r_.m128i[i] = simde_mm_alignr_epi8(c[q + i + 1], c[q + i], 12);
+          break;
+      }
+    }
+  #else
+    const size_t n = HEDLEY_STATIC_CAST(size_t, imm8 & 15);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+      const size_t j = i + n;
+      r_.i32[i] = (j < 16) ? b_.i32[j] : a_.i32[j - 16];
+    }
+  #endif
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_alignr_epi32(a, b, imm8) _mm512_alignr_epi32(a, b, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_alignr_epi32
+  #define _mm512_alignr_epi32(a, b, imm8) simde_mm512_alignr_epi32(a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_alignr_epi32(src, k, a, b, imm8) _mm512_mask_alignr_epi32(src, k, a, b, imm8)
+#else
+  #define simde_mm512_mask_alignr_epi32(src, k, a, b, imm8) simde_mm512_mask_mov_epi32(src, k, simde_mm512_alignr_epi32(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_alignr_epi32
+  #define _mm512_mask_alignr_epi32(src, k, a, b, imm8) simde_mm512_mask_alignr_epi32(src, k, a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_maskz_alignr_epi32(k, a, b, imm8) _mm512_maskz_alignr_epi32(k, a, b, imm8)
+#else
+  #define simde_mm512_maskz_alignr_epi32(k, a, b, imm8) simde_mm512_maskz_mov_epi32(k, simde_mm512_alignr_epi32(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_alignr_epi32
+  #define _mm512_maskz_alignr_epi32(k, a, b, imm8) simde_mm512_maskz_alignr_epi32(k, a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_alignr_epi64 (simde__m128i a, simde__m128i b, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  #if defined(SIMDE_X86_SSSE3_NATIVE) || defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    switch (imm8 & 1) {
+      case 0:
+        return b;
+      default:
+        return simde_mm_alignr_epi8(a, b, 8);
+    }
+  #else
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      b_ = simde__m128i_to_private(b);
+
+    const size_t n = HEDLEY_STATIC_CAST(size_t, imm8 & 1);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+      const size_t j = i + n;
+      r_.i64[i] = (j < 2) ? b_.i64[j] : a_.i64[j - 2];
+    }
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_alignr_epi64(a, b, imm8) _mm_alignr_epi64(a, b, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_alignr_epi64
+  #define _mm_alignr_epi64(a, b, imm8) simde_mm_alignr_epi64(a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_alignr_epi64(src, k, a, b, imm8) _mm_mask_alignr_epi64(src, k, a, b, imm8)
+#else
+  #define simde_mm_mask_alignr_epi64(src, k, a, b, imm8) simde_mm_mask_mov_epi64(src, k, simde_mm_alignr_epi64(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_alignr_epi64
+  #define _mm_mask_alignr_epi64(src, k, a, b, imm8) simde_mm_mask_alignr_epi64(src, k, a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_maskz_alignr_epi64(k, a, b, imm8) _mm_maskz_alignr_epi64(k, a, b, imm8)
+#else
+  #define simde_mm_maskz_alignr_epi64(k, a, b, imm8) simde_mm_maskz_mov_epi64(k, simde_mm_alignr_epi64(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_alignr_epi64
+  #define _mm_maskz_alignr_epi64(k, a, b, imm8) simde_mm_maskz_alignr_epi64(k, a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_alignr_epi64 (simde__m256i a, simde__m256i b, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b);
+
+  #if defined(SIMDE_X86_SSSE3_NATIVE) || defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    const simde__m128i c[4] = { b_.m128i[0], b_.m128i[1], a_.m128i[0], a_.m128i[1] };
+    const size_t q = HEDLEY_STATIC_CAST(size_t, (imm8 & 3) / 2);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+      switch (imm8 & 1) {
+        case 0:
+          r_.m128i[i] = c[q + i];
+          break;
+        default:
+          r_.m128i[i] = simde_mm_alignr_epi8(c[q + i + 1], c[q + i], 8);
+          break;
+      }
+    }
+  #else
+    const size_t n = HEDLEY_STATIC_CAST(size_t, imm8 & 3);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+      const size_t j = i + n;
+      r_.i64[i] = (j < 4) ? b_.i64[j] : a_.i64[j - 4];
+    }
+  #endif
+
+  return simde__m256i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_alignr_epi64(a, b, imm8) _mm256_alignr_epi64(a, b, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_alignr_epi64
+  #define _mm256_alignr_epi64(a, b, imm8) simde_mm256_alignr_epi64(a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_alignr_epi64(src, k, a, b, imm8) _mm256_mask_alignr_epi64(src, k, a, b, imm8)
+#else
+  #define simde_mm256_mask_alignr_epi64(src, k, a, b, imm8) simde_mm256_mask_mov_epi64(src, k, simde_mm256_alignr_epi64(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_alignr_epi64
+  #define _mm256_mask_alignr_epi64(src, k, a, b, imm8) simde_mm256_mask_alignr_epi64(src, k, a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_maskz_alignr_epi64(k, a, b, imm8) _mm256_maskz_alignr_epi64(k, a, b, imm8)
+#else
+  #define simde_mm256_maskz_alignr_epi64(k, a, b, imm8) simde_mm256_maskz_mov_epi64(k, simde_mm256_alignr_epi64(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_alignr_epi64
+  #define _mm256_maskz_alignr_epi64(k, a, b, imm8) simde_mm256_maskz_alignr_epi64(k, a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_alignr_epi64 (simde__m512i a, simde__m512i b, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b);
+
+  #if defined(SIMDE_X86_SSSE3_NATIVE) || defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+    const simde__m128i c[8] = { b_.m128i[0], b_.m128i[1], b_.m128i[2], b_.m128i[3], a_.m128i[0], a_.m128i[1], a_.m128i[2], a_.m128i[3] };
+    const size_t q = HEDLEY_STATIC_CAST(size_t, (imm8 & 7) / 2);
+
+    for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+      switch (imm8 & 1) {
+        case 0:
+          r_.m128i[i] = c[q + i];
+          break;
+        default:
+          r_.m128i[i] = simde_mm_alignr_epi8(c[q + i + 1], c[q + i], 8);
+          break;
+      }
+    }
+  #else
+    const size_t n = HEDLEY_STATIC_CAST(size_t, imm8 & 7);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+      const size_t j = i + n;
+      r_.i64[i] = (j < 8) ? b_.i64[j] : a_.i64[j - 8];
+    }
+  #endif
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_alignr_epi64(a, b, imm8) _mm512_alignr_epi64(a, b, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_alignr_epi64
+  #define _mm512_alignr_epi64(a, b, imm8) simde_mm512_alignr_epi64(a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_alignr_epi64(src, k, a, b, imm8) _mm512_mask_alignr_epi64(src, k, a, b, imm8)
+#else
+  #define simde_mm512_mask_alignr_epi64(src, k, a, b, imm8) simde_mm512_mask_mov_epi64(src, k, simde_mm512_alignr_epi64(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_alignr_epi64
+  #define _mm512_mask_alignr_epi64(src, k, a, b, imm8) simde_mm512_mask_alignr_epi64(src, k, a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_maskz_alignr_epi64(k, a, b, imm8) _mm512_maskz_alignr_epi64(k, a, b, imm8)
+#else
+  #define simde_mm512_maskz_alignr_epi64(k, a, b, imm8) simde_mm512_maskz_mov_epi64(k, simde_mm512_alignr_epi64(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_alignr_epi64
+  #define _mm512_maskz_alignr_epi64(k, a, b, imm8) simde_mm512_maskz_alignr_epi64(k, a, b, imm8)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_ALIGNR_H) */
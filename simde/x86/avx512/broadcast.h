@@ -891,6 +891,90 @@ simde_mm512_broadcastw_epi16 (simde__m128i a) {
   #define _mm512_broadcastw_epi16(a) simde_mm512_broadcastw_epi16(a)
 #endif
 
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_broadcastmw_epi32 (simde__mmask16 k) {
+  #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512CD_NATIVE)
+    return _mm_broadcastmw_epi32(k);
+  #else
+    return simde_mm_set1_epi32(HEDLEY_STATIC_CAST(int32_t, k));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512CD_ENABLE_NATIVE_ALIASES)
+  #undef _mm_broadcastmw_epi32
+  #define _mm_broadcastmw_epi32(k) simde_mm_broadcastmw_epi32(k)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_broadcastmb_epi64 (simde__mmask8 k) {
+  #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512CD_NATIVE)
+    return _mm_broadcastmb_epi64(k);
+  #else
+    return simde_mm_set1_epi64x(HEDLEY_STATIC_CAST(int64_t, k));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512CD_ENABLE_NATIVE_ALIASES)
+  #undef _mm_broadcastmb_epi64
+  #define _mm_broadcastmb_epi64(k) simde_mm_broadcastmb_epi64(k)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_broadcastmw_epi32 (simde__mmask16 k) {
+  #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512CD_NATIVE)
+    return _mm256_broadcastmw_epi32(k);
+  #else
+    return simde_mm256_set1_epi32(HEDLEY_STATIC_CAST(int32_t, k));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512CD_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_broadcastmw_epi32
+  #define _mm256_broadcastmw_epi32(k) simde_mm256_broadcastmw_epi32(k)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_broadcastmb_epi64 (simde__mmask8 k) {
+  #if defined(SIMDE_X86_AVX512VL_NATIVE) && defined(SIMDE_X86_AVX512CD_NATIVE)
+    return _mm256_broadcastmb_epi64(k);
+  #else
+    return simde_mm256_set1_epi64x(HEDLEY_STATIC_CAST(int64_t, k));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512CD_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_broadcastmb_epi64
+  #define _mm256_broadcastmb_epi64(k) simde_mm256_broadcastmb_epi64(k)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_broadcastmw_epi32 (simde__mmask16 k) {
+  #if defined(SIMDE_X86_AVX512CD_NATIVE)
+    return _mm512_broadcastmw_epi32(k);
+  #else
+    return simde_mm512_set1_epi32(HEDLEY_STATIC_CAST(int32_t, k));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512CD_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_broadcastmw_epi32
+  #define _mm512_broadcastmw_epi32(k) simde_mm512_broadcastmw_epi32(k)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_broadcastmb_epi64 (simde__mmask8 k) {
+  #if defined(SIMDE_X86_AVX512CD_NATIVE)
+    return _mm512_broadcastmb_epi64(k);
+  #else
+    return simde_mm512_set1_epi64(HEDLEY_STATIC_CAST(int64_t, k));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512CD_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_broadcastmb_epi64
+  #define _mm512_broadcastmb_epi64(k) simde_mm512_broadcastmb_epi64(k)
+#endif
+
 SIMDE_END_DECLS_
 HEDLEY_DIAGNOSTIC_POP
 
@@ -0,0 +1,291 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#if !defined(SIMDE_X86_AVX512_DPBUSDS_H)
+#define SIMDE_X86_AVX512_DPBUSDS_H
+
+#include "types.h"
+#include "mov.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_dpbusds_epi32 (simde__m128i src, simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_X86_AVX512VNNI_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_dpbusds_epi32(src, a, b);
+  #elif defined(SIMDE_X86_AVXVNNI_NATIVE)
+    return _mm_dpbusds_avx_epi32(src, a, b);
+  #else
+    simde__m128i_private
+      src_ = simde__m128i_to_private(src),
+      a_ = simde__m128i_to_private(a),
+      b_ = simde__m128i_to_private(b),
+      r_;
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(__ARM_FEATURE_MATMUL_INT8)
+      r_.neon_i32 = vqaddq_s32(src_.neon_i32, vusdotq_s32(vdupq_n_s32(0), a_.neon_u8, b_.neon_i8));
+    #elif defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_DOTPROD)
+      int32x4_t sum = vdotq_s32(vdupq_n_s32(0), vreinterpretq_s8_u8(veorq_u8(a_.neon_u8, vdupq_n_u8(0x80))), b_.neon_i8);
+      sum = vaddq_s32(sum, vshlq_n_s32(vdotq_s32(vdupq_n_s32(0), vdupq_n_s8(1), b_.neon_i8), 7));
+      r_.neon_i32 = vqaddq_s32(src_.neon_i32, sum);
+    #elif defined(SIMDE_X86_SSE2_NATIVE)
+      const __m128i lo = _mm_set1_epi16(0x00ff);
+      const __m128i sum =
+        _mm_add_epi32(
+          _mm_madd_epi16(_mm_and_si128(a_.n, lo), _mm_srai_epi16(_mm_slli_epi16(b_.n, 8), 8)),
+          _mm_madd_epi16(_mm_srli_epi16(a_.n, 8), _mm_srai_epi16(b_.n, 8)));
+      r_.n = _mm_add_epi32(src_.n, sum);
+      const __m128i overflow = _mm_srai_epi32(_mm_and_si128(_mm_xor_si128(src_.n, r_.n), _mm_xor_si128(sum, r_.n)), 31);
+      r_.n = _mm_or_si128(_mm_andnot_si128(overflow, r_.n), _mm_and_si128(overflow, _mm_xor_si128(_mm_srai_epi32(src_.n, 31), _mm_set1_epi32(INT32_MAX))));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+        int64_t sum = HEDLEY_STATIC_CAST(int64_t, src_.i32[i]);
+        for (size_t j = 0 ; j < 4 ; j++) {
+          sum += HEDLEY_STATIC_CAST(int64_t, a_.u8[(4 * i) + j]) * HEDLEY_STATIC_CAST(int64_t, b_.i8[(4 * i) + j]);
+        }
+        r_.i32[i] = (sum > INT32_MAX) ? INT32_MAX : ((sum < INT32_MIN) ? INT32_MIN : HEDLEY_STATIC_CAST(int32_t, sum));
+      }
+    #endif
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VNNI_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_dpbusds_epi32
+  #define _mm_dpbusds_epi32(src, a, b) simde_mm_dpbusds_epi32(src, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_dpbusds_avx_epi32 (simde__m128i src, simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_X86_AVXVNNI_NATIVE)
+    return _mm_dpbusds_avx_epi32(src, a, b);
+  #else
+    return simde_mm_dpbusds_epi32(src, a, b);
+  #endif
+}
+#if defined(SIMDE_X86_AVXVNNI_ENABLE_NATIVE_ALIASES)
+  #undef _mm_dpbusds_avx_epi32
+  #define _mm_dpbusds_avx_epi32(src, a, b) simde_mm_dpbusds_avx_epi32(src, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_dpbusds_epi32 (simde__m128i src, simde__mmask8 k, simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_X86_AVX512VNNI_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_dpbusds_epi32(src, k, a, b);
+  #else
+    return simde_mm_mask_mov_epi32(src, k, simde_mm_dpbusds_epi32(src, a, b));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VNNI_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_dpbusds_epi32
+  #define _mm_mask_dpbusds_epi32(src, k, a, b) simde_mm_mask_dpbusds_epi32(src, k, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_dpbusds_epi32 (simde__mmask8 k, simde__m128i src, simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_X86_AVX512VNNI_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_dpbusds_epi32(k, src, a, b);
+  #else
+    return simde_mm_maskz_mov_epi32(k, simde_mm_dpbusds_epi32(src, a, b));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VNNI_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_dpbusds_epi32
+  #define _mm_maskz_dpbusds_epi32(k, src, a, b) simde_mm_maskz_dpbusds_epi32(k, src, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_dpbusds_epi32 (simde__m256i src, simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_X86_AVX512VNNI_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_dpbusds_epi32(src, a, b);
+  #elif defined(SIMDE_X86_AVXVNNI_NATIVE)
+    return _mm256_dpbusds_avx_epi32(src, a, b);
+  #else
+    simde__m256i_private
+      src_ = simde__m256i_to_private(src),
+      a_ = simde__m256i_to_private(a),
+      b_ = simde__m256i_to_private(b),
+      r_;
+
+    #if defined(SIMDE_X86_AVX2_NATIVE)
+      const __m256i lo = _mm256_set1_epi16(0x00ff);
+      const __m256i sum =
+        _mm256_add_epi32(
+          _mm256_madd_epi16(_mm256_and_si256(a_.n, lo), _mm256_srai_epi16(_mm256_slli_epi16(b_.n, 8), 8)),
+          _mm256_madd_epi16(_mm256_srli_epi16(a_.n, 8), _mm256_srai_epi16(b_.n, 8)));
+      r_.n = _mm256_add_epi32(src_.n, sum);
+      const __m256i overflow = _mm256_srai_epi32(_mm256_and_si256(_mm256_xor_si256(src_.n, r_.n), _mm256_xor_si256(sum, r_.n)), 31);
+      r_.n = _mm256_or_si256(_mm256_andnot_si256(overflow, r_.n), _mm256_and_si256(overflow, _mm256_xor_si256(_mm256_srai_epi32(src_.n, 31), _mm256_set1_epi32(INT32_MAX))));
+    #elif SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+      for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+        r_.m128i[i] = simde_mm_dpbusds_epi32(src_.m128i[i], a_.m128i[i], b_.m128i[i]);
+      }
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+        int64_t sum = HEDLEY_STATIC_CAST(int64_t, src_.i32[i]);
+        for (size_t j = 0 ; j < 4 ; j++) {
+          sum += HEDLEY_STATIC_CAST(int64_t, a_.u8[(4 * i) + j]) * HEDLEY_STATIC_CAST(int64_t, b_.i8[(4 * i) + j]);
+        }
+        r_.i32[i] = (sum > INT32_MAX) ? INT32_MAX : ((sum < INT32_MIN) ? INT32_MIN : HEDLEY_STATIC_CAST(int32_t, sum));
+      }
+    #endif
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VNNI_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_dpbusds_epi32
+  #define _mm256_dpbusds_epi32(src, a, b) simde_mm256_dpbusds_epi32(src, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_dpbusds_avx_epi32 (simde__m256i src, simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_X86_AVXVNNI_NATIVE)
+    return _mm256_dpbusds_avx_epi32(src, a, b);
+  #else
+    return simde_mm256_dpbusds_epi32(src, a, b);
+  #endif
+}
+#if defined(SIMDE_X86_AVXVNNI_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_dpbusds_avx_epi32
+  #define _mm256_dpbusds_avx_epi32(src, a, b) simde_mm256_dpbusds_avx_epi32(src, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_dpbusds_epi32 (simde__m256i src, simde__mmask8 k, simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_X86_AVX512VNNI_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_dpbusds_epi32(src, k, a, b);
+  #else
+    return simde_mm256_mask_mov_epi32(src, k, simde_mm256_dpbusds_epi32(src, a, b));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VNNI_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_dpbusds_epi32
+  #define _mm256_mask_dpbusds_epi32(src, k, a, b) simde_mm256_mask_dpbusds_epi32(src, k, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_dpbusds_epi32 (simde__mmask8 k, simde__m256i src, simde__m256i a, simde__m256i b) {
+  #if defined(SIMDE_X86_AVX512VNNI_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_dpbusds_epi32(k, src, a, b);
+  #else
+    return simde_mm256_maskz_mov_epi32(k, simde_mm256_dpbusds_epi32(src, a, b));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VNNI_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_dpbusds_epi32
+  #define _mm256_maskz_dpbusds_epi32(k, src, a, b) simde_mm256_maskz_dpbusds_epi32(k, src, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_dpbusds_epi32 (simde__m512i src, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_X86_AVX512VNNI_NATIVE)
+    return _mm512_dpbusds_epi32(src, a, b);
+  #else
+    simde__m512i_private
+      src_ = simde__m512i_to_private(src),
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b),
+      r_;
+
+    #if defined(SIMDE_X86_AVX512BW_NATIVE)
+      const __m512i lo = _mm512_set1_epi16(0x00ff);
+      const __m512i sum =
+        _mm512_add_epi32(
+          _mm512_madd_epi16(_mm512_and_si512(a_.n, lo), _mm512_srai_epi16(_mm512_slli_epi16(b_.n, 8), 8)),
+          _mm512_madd_epi16(_mm512_srli_epi16(a_.n, 8), _mm512_srai_epi16(b_.n, 8)));
+      r_.n = _mm512_add_epi32(src_.n, sum);
+      r_.n = _mm512_mask_mov_epi32(r_.n,
+        _mm512_cmplt_epi32_mask(_mm512_and_si512(_mm512_xor_si512(src_.n, r_.n), _mm512_xor_si512(sum, r_.n)), _mm512_setzero_si512()),
+        _mm512_xor_si512(_mm512_srai_epi32(src_.n, 31), _mm512_set1_epi32(INT32_MAX)));
+    #elif SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_dpbusds_epi32(src_.m256i[i], a_.m256i[i], b_.m256i[i]);
+      }
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+        int64_t sum = HEDLEY_STATIC_CAST(int64_t, src_.i32[i]);
+        for (size_t j = 0 ; j < 4 ; j++) {
+          sum += HEDLEY_STATIC_CAST(int64_t, a_.u8[(4 * i) + j]) * HEDLEY_STATIC_CAST(int64_t, b_.i8[(4 * i) + j]);
+        }
+        r_.i32[i] = (sum > INT32_MAX) ? INT32_MAX : ((sum < INT32_MIN) ? INT32_MIN : HEDLEY_STATIC_CAST(int32_t, sum));
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VNNI_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_dpbusds_epi32
+  #define _mm512_dpbusds_epi32(src, a, b) simde_mm512_dpbusds_epi32(src, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_dpbusds_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_X86_AVX512VNNI_NATIVE)
+    return _mm512_mask_dpbusds_epi32(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_epi32(src, k, simde_mm512_dpbusds_epi32(src, a, b));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VNNI_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_dpbusds_epi32
+  #define _mm512_mask_dpbusds_epi32(src, k, a, b) simde_mm512_mask_dpbusds_epi32(src, k, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_dpbusds_epi32 (simde__mmask16 k, simde__m512i src, simde__m512i a, simde__m512i b) {
+  #if defined(SIMDE_X86_AVX512VNNI_NATIVE)
+    return _mm512_maskz_dpbusds_epi32(k, src, a, b);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_dpbusds_epi32(src, a, b));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VNNI_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_dpbusds_epi32
+  #define _mm512_maskz_dpbusds_epi32(k, src, a, b) simde_mm512_maskz_dpbusds_epi32(k, src, a, b)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_DPBUSDS_H) */
@@ -0,0 +1,198 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#if !defined(SIMDE_X86_AVX512_FIXUPIMM_H)
+#define SIMDE_X86_AVX512_FIXUPIMM_H
+
+#include "types.h"
+#include "mov.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_fixupimm_ps (simde__m512 a, simde__m512 b, simde__m512i c, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  simde__m512_private
+    r_,
+    a_ = simde__m512_to_private(a),
+    b_ = simde__m512_to_private(b);
+  simde__m512i_private c_ = simde__m512i_to_private(c);
+  (void) imm8;
+
+  for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+    const uint32_t bx = b_.u32[i], bu = bx & UINT32_C(0x7fffffff);
+    int token;
+
+    /* Classify b; the matching nibble of c selects the response.  imm8
+     * only controls which exceptions are reported. */
+    if (bu > UINT32_C(0x7f800000))
+      token = (bx & UINT32_C(0x00400000)) ? 0 : 1;
+    else if (bu == 0)
+      token = 2;
+    else if (bx == UINT32_C(0x3f800000))
+      token = 3;
+    else if (bx == (UINT32_C(0x80000000) | UINT32_C(0x7f800000)))
+      token = 4;
+    else if (bx == UINT32_C(0x7f800000))
+      token = 5;
+    else
+      token = (bx & UINT32_C(0x80000000)) ? 6 : 7;
+
+    switch ((c_.u32[i] >> (token * 4)) & 15) {
+      case  0: r_.u32[i] = a_.u32[i]; break;
+      case  1: r_.u32[i] = bx; break;
+      case  2: r_.u32[i] = bx | UINT32_C(0x7fc00000); break;
+      case  3: r_.u32[i] = UINT32_C(0xffc00000); break;
+      case  4: r_.u32[i] = UINT32_C(0x80000000) | UINT32_C(0x7f800000); break;
+      case  5: r_.u32[i] = UINT32_C(0x7f800000); break;
+      case  6: r_.u32[i] = (bx & UINT32_C(0x80000000)) | UINT32_C(0x7f800000); break;
+      case  7: r_.u32[i] = UINT32_C(0x80000000); break;
+      case  8: r_.u32[i] = 0; break;
+      case  9: r_.u32[i] = UINT32_C(0x80000000) | UINT32_C(0x3f800000); break;
+      case 10: r_.u32[i] = UINT32_C(0x3f800000); break;
+      case 11: r_.u32[i] = UINT32_C(0x3f000000); break;
+      case 12: r_.u32[i] = UINT32_C(0x42b40000); break;
+      case 13: r_.u32[i] = UINT32_C(0x3fc90fdb); break;
+      case 14: r_.u32[i] = UINT32_C(0x7f7fffff); break;
+      default: r_.u32[i] = UINT32_C(0x80000000) | UINT32_C(0x7f7fffff); break;
+    }
+  }
+
+  return simde__m512_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_fixupimm_ps(a, b, c, imm8) _mm512_fixupimm_ps(a, b, c, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_fixupimm_ps
+  #define _mm512_fixupimm_ps(a, b, c, imm8) simde_mm512_fixupimm_ps(a, b, c, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_fixupimm_ps(a, k, b, c, imm8) _mm512_mask_fixupimm_ps(a, k, b, c, imm8)
+#else
+  #define simde_mm512_mask_fixupimm_ps(a, k, b, c, imm8) simde_mm512_mask_mov_ps(a, k, simde_mm512_fixupimm_ps(a, b, c, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_fixupimm_ps
+  #define _mm512_mask_fixupimm_ps(a, k, b, c, imm8) simde_mm512_mask_fixupimm_ps(a, k, b, c, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_maskz_fixupimm_ps(k, a, b, c, imm8) _mm512_maskz_fixupimm_ps(k, a, b, c, imm8)
+#else
+  #define simde_mm512_maskz_fixupimm_ps(k, a, b, c, imm8) simde_mm512_maskz_mov_ps(k, simde_mm512_fixupimm_ps(a, b, c, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_fixupimm_ps
+  #define _mm512_maskz_fixupimm_ps(k, a, b, c, imm8) simde_mm512_maskz_fixupimm_ps(k, a, b, c, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_fixupimm_pd (simde__m512d a, simde__m512d b, simde__m512i c, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  simde__m512d_private
+    r_,
+    a_ = simde__m512d_to_private(a),
+    b_ = simde__m512d_to_private(b);
+  simde__m512i_private c_ = simde__m512i_to_private(c);
+  (void) imm8;
+
+  for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+    const uint64_t bx = b_.u64[i], bu = bx & UINT64_C(0x7fffffffffffffff);
+    int token;
+
+    if (bu > UINT64_C(0x7ff0000000000000))
+      token = (bx & UINT64_C(0x0008000000000000)) ? 0 : 1;
+    else if (bu == 0)
+      token = 2;
+    else if (bx == UINT64_C(0x3ff0000000000000))
+      token = 3;
+    else if (bx == (UINT64_C(0x8000000000000000) | UINT64_C(0x7ff0000000000000)))
+      token = 4;
+    else if (bx == UINT64_C(0x7ff0000000000000))
+      token = 5;
+    else
+      token = (bx & UINT64_C(0x8000000000000000)) ? 6 : 7;
+
+    switch ((c_.u64[i] >> (token * 4)) & 15) {
+      case  0: r_.u64[i] = a_.u64[i]; break;
+      case  1: r_.u64[i] = bx; break;
+      case  2: r_.u64[i] = bx | UINT64_C(0x7ff8000000000000); break;
+      case  3: r_.u64[i] = UINT64_C(0xfff8000000000000); break;
+      case  4: r_.u64[i] = UINT64_C(0x8000000000000000) | UINT64_C(0x7ff0000000000000); break;
+      case  5: r_.u64[i] = UINT64_C(0x7ff0000000000000); break;
+      case  6: r_.u64[i] = (bx & UINT64_C(0x8000000000000000)) | UINT64_C(0x7ff0000000000000); break;
+      case  7: r_.u64[i] = UINT64_C(0x8000000000000000); break;
+      case  8: r_.u64[i] = 0; break;
+      case  9: r_.u64[i] = UINT64_C(0x8000000000000000) | UINT64_C(0x3ff0000000000000); break;
+      case 10: r_.u64[i] = UINT64_C(0x3ff0000000000000); break;
+      case 11: r_.u64[i] = UINT64_C(0x3fe0000000000000); break;
+      case 12: r_.u64[i] = UINT64_C(0x4056800000000000); break;
+      case 13: r_.u64[i] = UINT64_C(0x3ff921fb54442d18); break;
+      case 14: r_.u64[i] = UINT64_C(0x7fefffffffffffff); break;
+      default: r_.u64[i] = UINT64_C(0x8000000000000000) | UINT64_C(0x7fefffffffffffff); break;
+    }
+  }
+
+  return simde__m512d_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_fixupimm_pd(a, b, c, imm8) _mm512_fixupimm_pd(a, b, c, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_fixupimm_pd
+  #define _mm512_fixupimm_pd(a, b, c, imm8) simde_mm512_fixupimm_pd(a, b, c, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_fixupimm_pd(a, k, b, c, imm8) _mm512_mask_fixupimm_pd(a, k, b, c, imm8)
+#else
+  #define simde_mm512_mask_fixupimm_pd(a, k, b, c, imm8) simde_mm512_mask_mov_pd(a, k, simde_mm512_fixupimm_pd(a, b, c, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_fixupimm_pd
+  #define _mm512_mask_fixupimm_pd(a, k, b, c, imm8) simde_mm512_mask_fixupimm_pd(a, k, b, c, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_maskz_fixupimm_pd(k, a, b, c, imm8) _mm512_maskz_fixupimm_pd(k, a, b, c, imm8)
+#else
+  #define simde_mm512_maskz_fixupimm_pd(k, a, b, c, imm8) simde_mm512_maskz_mov_pd(k, simde_mm512_fixupimm_pd(a, b, c, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_fixupimm_pd
+  #define _mm512_maskz_fixupimm_pd(k, a, b, c, imm8) simde_mm512_maskz_fixupimm_pd(k, a, b, c, imm8)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_FIXUPIMM_H) */
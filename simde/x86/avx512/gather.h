@@ -0,0 +1,1064 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#if !defined(SIMDE_X86_AVX512_GATHER_H)
+#define SIMDE_X86_AVX512_GATHER_H
+
+#include "types.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* The masked gathers select between the gathered address and the
+ * lane of src for every element instead of branching on the mask, so
+ * an unpredictable mask doesn't turn into a string of mispredicts.
+ *
+ * Every address is computed and prefetched before the first element
+ * is loaded, so when the table doesn't fit in cache (a hash join
+ * probe, for example) the misses are in flight together instead of
+ * waiting on each other. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mmask_i32gather_epi32 (simde__m128i src, simde__mmask8 k, simde__m128i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128i_private
+    src_ = simde__m128i_to_private(src),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src1[sizeof(r_.i32) / sizeof(r_.i32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+    src1[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(const uint8_t*, &(src_.i32[i]));
+    simde_prefetch(src1[i], 0);
+  }
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+    simde_memcpy(&(r_.i32[i]), src1[i], sizeof(r_.i32[i]));
+  }
+
+  return simde__m128i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mmask_i32gather_epi32(src, k, vindex, base_addr, scale) _mm_mmask_i32gather_epi32(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mmask_i32gather_epi32
+  #define _mm_mmask_i32gather_epi32(src, k, vindex, base_addr, scale) simde_mm_mmask_i32gather_epi32(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mmask_i32gather_epi64 (simde__m128i src, simde__mmask8 k, simde__m128i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128i_private
+    src_ = simde__m128i_to_private(src),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src1[sizeof(r_.i64) / sizeof(r_.i64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+    src1[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(const uint8_t*, &(src_.i64[i]));
+    simde_prefetch(src1[i], 0);
+  }
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+    simde_memcpy(&(r_.i64[i]), src1[i], sizeof(r_.i64[i]));
+  }
+
+  return simde__m128i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mmask_i32gather_epi64(src, k, vindex, base_addr, scale) _mm_mmask_i32gather_epi64(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mmask_i32gather_epi64
+  #define _mm_mmask_i32gather_epi64(src, k, vindex, base_addr, scale) simde_mm_mmask_i32gather_epi64(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_mmask_i32gather_pd (simde__m128d src, simde__mmask8 k, simde__m128i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128d_private
+    src_ = simde__m128d_to_private(src),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src1[sizeof(r_.f64) / sizeof(r_.f64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+    src1[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(const uint8_t*, &(src_.f64[i]));
+    simde_prefetch(src1[i], 0);
+  }
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+    simde_memcpy(&(r_.f64[i]), src1[i], sizeof(r_.f64[i]));
+  }
+
+  return simde__m128d_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mmask_i32gather_pd(src, k, vindex, base_addr, scale) _mm_mmask_i32gather_pd(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mmask_i32gather_pd
+  #define _mm_mmask_i32gather_pd(src, k, vindex, base_addr, scale) simde_mm_mmask_i32gather_pd(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_mmask_i32gather_ps (simde__m128 src, simde__mmask8 k, simde__m128i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128_private
+    src_ = simde__m128_to_private(src),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src1[sizeof(r_.f32) / sizeof(r_.f32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+    src1[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(const uint8_t*, &(src_.f32[i]));
+    simde_prefetch(src1[i], 0);
+  }
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+    simde_memcpy(&(r_.f32[i]), src1[i], sizeof(r_.f32[i]));
+  }
+
+  return simde__m128_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mmask_i32gather_ps(src, k, vindex, base_addr, scale) _mm_mmask_i32gather_ps(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mmask_i32gather_ps
+  #define _mm_mmask_i32gather_ps(src, k, vindex, base_addr, scale) simde_mm_mmask_i32gather_ps(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mmask_i64gather_epi32 (simde__m128i src, simde__mmask8 k, simde__m128i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128i_private
+    src_ = simde__m128i_to_private(src),
+    r_ = simde__m128i_to_private(simde_mm_setzero_si128());
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src1[sizeof(vindex_.i64) / sizeof(vindex_.i64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(vindex_.i64) / sizeof(vindex_.i64[0])) ; i++) {
+    src1[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(const uint8_t*, &(src_.i32[i]));
+    simde_prefetch(src1[i], 0);
+  }
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(vindex_.i64) / sizeof(vindex_.i64[0])) ; i++) {
+    simde_memcpy(&(r_.i32[i]), src1[i], sizeof(r_.i32[i]));
+  }
+
+  return simde__m128i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mmask_i64gather_epi32(src, k, vindex, base_addr, scale) _mm_mmask_i64gather_epi32(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mmask_i64gather_epi32
+  #define _mm_mmask_i64gather_epi32(src, k, vindex, base_addr, scale) simde_mm_mmask_i64gather_epi32(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mmask_i64gather_epi64 (simde__m128i src, simde__mmask8 k, simde__m128i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128i_private
+    src_ = simde__m128i_to_private(src),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src1[sizeof(r_.i64) / sizeof(r_.i64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+    src1[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(const uint8_t*, &(src_.i64[i]));
+    simde_prefetch(src1[i], 0);
+  }
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+    simde_memcpy(&(r_.i64[i]), src1[i], sizeof(r_.i64[i]));
+  }
+
+  return simde__m128i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mmask_i64gather_epi64(src, k, vindex, base_addr, scale) _mm_mmask_i64gather_epi64(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mmask_i64gather_epi64
+  #define _mm_mmask_i64gather_epi64(src, k, vindex, base_addr, scale) simde_mm_mmask_i64gather_epi64(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_mmask_i64gather_pd (simde__m128d src, simde__mmask8 k, simde__m128i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128d_private
+    src_ = simde__m128d_to_private(src),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src1[sizeof(r_.f64) / sizeof(r_.f64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+    src1[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(const uint8_t*, &(src_.f64[i]));
+    simde_prefetch(src1[i], 0);
+  }
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+    simde_memcpy(&(r_.f64[i]), src1[i], sizeof(r_.f64[i]));
+  }
+
+  return simde__m128d_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mmask_i64gather_pd(src, k, vindex, base_addr, scale) _mm_mmask_i64gather_pd(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mmask_i64gather_pd
+  #define _mm_mmask_i64gather_pd(src, k, vindex, base_addr, scale) simde_mm_mmask_i64gather_pd(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_mmask_i64gather_ps (simde__m128 src, simde__mmask8 k, simde__m128i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128_private
+    src_ = simde__m128_to_private(src),
+    r_ = simde__m128_to_private(simde_mm_setzero_ps());
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src1[sizeof(vindex_.i64) / sizeof(vindex_.i64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(vindex_.i64) / sizeof(vindex_.i64[0])) ; i++) {
+    src1[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(const uint8_t*, &(src_.f32[i]));
+    simde_prefetch(src1[i], 0);
+  }
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(vindex_.i64) / sizeof(vindex_.i64[0])) ; i++) {
+    simde_memcpy(&(r_.f32[i]), src1[i], sizeof(r_.f32[i]));
+  }
+
+  return simde__m128_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mmask_i64gather_ps(src, k, vindex, base_addr, scale) _mm_mmask_i64gather_ps(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mmask_i64gather_ps
+  #define _mm_mmask_i64gather_ps(src, k, vindex, base_addr, scale) simde_mm_mmask_i64gather_ps(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mmask_i32gather_epi32 (simde__m256i src, simde__mmask8 k, simde__m256i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m256i_private
+    src_ = simde__m256i_to_private(src),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src1[sizeof(r_.i32) / sizeof(r_.i32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+    src1[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(const uint8_t*, &(src_.i32[i]));
+    simde_prefetch(src1[i], 0);
+  }
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+    simde_memcpy(&(r_.i32[i]), src1[i], sizeof(r_.i32[i]));
+  }
+
+  return simde__m256i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mmask_i32gather_epi32(src, k, vindex, base_addr, scale) _mm256_mmask_i32gather_epi32(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mmask_i32gather_epi32
+  #define _mm256_mmask_i32gather_epi32(src, k, vindex, base_addr, scale) simde_mm256_mmask_i32gather_epi32(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mmask_i32gather_epi64 (simde__m256i src, simde__mmask8 k, simde__m128i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m256i_private
+    src_ = simde__m256i_to_private(src),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src1[sizeof(r_.i64) / sizeof(r_.i64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+    src1[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(const uint8_t*, &(src_.i64[i]));
+    simde_prefetch(src1[i], 0);
+  }
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+    simde_memcpy(&(r_.i64[i]), src1[i], sizeof(r_.i64[i]));
+  }
+
+  return simde__m256i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mmask_i32gather_epi64(src, k, vindex, base_addr, scale) _mm256_mmask_i32gather_epi64(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mmask_i32gather_epi64
+  #define _mm256_mmask_i32gather_epi64(src, k, vindex, base_addr, scale) simde_mm256_mmask_i32gather_epi64(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_mmask_i32gather_pd (simde__m256d src, simde__mmask8 k, simde__m128i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m256d_private
+    src_ = simde__m256d_to_private(src),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src1[sizeof(r_.f64) / sizeof(r_.f64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+    src1[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(const uint8_t*, &(src_.f64[i]));
+    simde_prefetch(src1[i], 0);
+  }
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+    simde_memcpy(&(r_.f64[i]), src1[i], sizeof(r_.f64[i]));
+  }
+
+  return simde__m256d_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mmask_i32gather_pd(src, k, vindex, base_addr, scale) _mm256_mmask_i32gather_pd(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mmask_i32gather_pd
+  #define _mm256_mmask_i32gather_pd(src, k, vindex, base_addr, scale) simde_mm256_mmask_i32gather_pd(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_mmask_i32gather_ps (simde__m256 src, simde__mmask8 k, simde__m256i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m256_private
+    src_ = simde__m256_to_private(src),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src1[sizeof(r_.f32) / sizeof(r_.f32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+    src1[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(const uint8_t*, &(src_.f32[i]));
+    simde_prefetch(src1[i], 0);
+  }
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+    simde_memcpy(&(r_.f32[i]), src1[i], sizeof(r_.f32[i]));
+  }
+
+  return simde__m256_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mmask_i32gather_ps(src, k, vindex, base_addr, scale) _mm256_mmask_i32gather_ps(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mmask_i32gather_ps
+  #define _mm256_mmask_i32gather_ps(src, k, vindex, base_addr, scale) simde_mm256_mmask_i32gather_ps(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm256_mmask_i64gather_epi32 (simde__m128i src, simde__mmask8 k, simde__m256i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m128i_private
+    src_ = simde__m128i_to_private(src),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src1[sizeof(r_.i32) / sizeof(r_.i32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+    src1[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(const uint8_t*, &(src_.i32[i]));
+    simde_prefetch(src1[i], 0);
+  }
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+    simde_memcpy(&(r_.i32[i]), src1[i], sizeof(r_.i32[i]));
+  }
+
+  return simde__m128i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mmask_i64gather_epi32(src, k, vindex, base_addr, scale) _mm256_mmask_i64gather_epi32(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mmask_i64gather_epi32
+  #define _mm256_mmask_i64gather_epi32(src, k, vindex, base_addr, scale) simde_mm256_mmask_i64gather_epi32(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mmask_i64gather_epi64 (simde__m256i src, simde__mmask8 k, simde__m256i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m256i_private
+    src_ = simde__m256i_to_private(src),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src1[sizeof(r_.i64) / sizeof(r_.i64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+    src1[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(const uint8_t*, &(src_.i64[i]));
+    simde_prefetch(src1[i], 0);
+  }
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+    simde_memcpy(&(r_.i64[i]), src1[i], sizeof(r_.i64[i]));
+  }
+
+  return simde__m256i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mmask_i64gather_epi64(src, k, vindex, base_addr, scale) _mm256_mmask_i64gather_epi64(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mmask_i64gather_epi64
+  #define _mm256_mmask_i64gather_epi64(src, k, vindex, base_addr, scale) simde_mm256_mmask_i64gather_epi64(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_mmask_i64gather_pd (simde__m256d src, simde__mmask8 k, simde__m256i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m256d_private
+    src_ = simde__m256d_to_private(src),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src1[sizeof(r_.f64) / sizeof(r_.f64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+    src1[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(const uint8_t*, &(src_.f64[i]));
+    simde_prefetch(src1[i], 0);
+  }
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+    simde_memcpy(&(r_.f64[i]), src1[i], sizeof(r_.f64[i]));
+  }
+
+  return simde__m256d_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mmask_i64gather_pd(src, k, vindex, base_addr, scale) _mm256_mmask_i64gather_pd(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mmask_i64gather_pd
+  #define _mm256_mmask_i64gather_pd(src, k, vindex, base_addr, scale) simde_mm256_mmask_i64gather_pd(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm256_mmask_i64gather_ps (simde__m128 src, simde__mmask8 k, simde__m256i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m128_private
+    src_ = simde__m128_to_private(src),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src1[sizeof(r_.f32) / sizeof(r_.f32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+    src1[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(const uint8_t*, &(src_.f32[i]));
+    simde_prefetch(src1[i], 0);
+  }
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+    simde_memcpy(&(r_.f32[i]), src1[i], sizeof(r_.f32[i]));
+  }
+
+  return simde__m128_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mmask_i64gather_ps(src, k, vindex, base_addr, scale) _mm256_mmask_i64gather_ps(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mmask_i64gather_ps
+  #define _mm256_mmask_i64gather_ps(src, k, vindex, base_addr, scale) simde_mm256_mmask_i64gather_ps(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_i32gather_epi32 (simde__m512i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512i_private
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src1[sizeof(r_.i32) / sizeof(r_.i32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+    src1[i] = addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale));
+    simde_prefetch(src1[i], 0);
+  }
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+    simde_memcpy(&(r_.i32[i]), src1[i], sizeof(r_.i32[i]));
+  }
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i32gather_epi32(vindex, base_addr, scale) _mm512_i32gather_epi32(vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i32gather_epi32
+  #define _mm512_i32gather_epi32(vindex, base_addr, scale) simde_mm512_i32gather_epi32(vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_i32gather_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512i_private
+    src_ = simde__m512i_to_private(src),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src1[sizeof(r_.i32) / sizeof(r_.i32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+    src1[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(const uint8_t*, &(src_.i32[i]));
+    simde_prefetch(src1[i], 0);
+  }
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+    simde_memcpy(&(r_.i32[i]), src1[i], sizeof(r_.i32[i]));
+  }
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i32gather_epi32(src, k, vindex, base_addr, scale) _mm512_mask_i32gather_epi32(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i32gather_epi32
+  #define _mm512_mask_i32gather_epi32(src, k, vindex, base_addr, scale) simde_mm512_mask_i32gather_epi32(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_i32gather_epi64 (simde__m256i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m512i_private
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src1[sizeof(r_.i64) / sizeof(r_.i64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+    src1[i] = addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale));
+    simde_prefetch(src1[i], 0);
+  }
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+    simde_memcpy(&(r_.i64[i]), src1[i], sizeof(r_.i64[i]));
+  }
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i32gather_epi64(vindex, base_addr, scale) _mm512_i32gather_epi64(vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i32gather_epi64
+  #define _mm512_i32gather_epi64(vindex, base_addr, scale) simde_mm512_i32gather_epi64(vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_i32gather_epi64 (simde__m512i src, simde__mmask8 k, simde__m256i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m512i_private
+    src_ = simde__m512i_to_private(src),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src1[sizeof(r_.i64) / sizeof(r_.i64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+    src1[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(const uint8_t*, &(src_.i64[i]));
+    simde_prefetch(src1[i], 0);
+  }
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+    simde_memcpy(&(r_.i64[i]), src1[i], sizeof(r_.i64[i]));
+  }
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i32gather_epi64(src, k, vindex, base_addr, scale) _mm512_mask_i32gather_epi64(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i32gather_epi64
+  #define _mm512_mask_i32gather_epi64(src, k, vindex, base_addr, scale) simde_mm512_mask_i32gather_epi64(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_i32gather_pd (simde__m256i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m512d_private
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src1[sizeof(r_.f64) / sizeof(r_.f64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+    src1[i] = addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale));
+    simde_prefetch(src1[i], 0);
+  }
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+    simde_memcpy(&(r_.f64[i]), src1[i], sizeof(r_.f64[i]));
+  }
+
+  return simde__m512d_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i32gather_pd(vindex, base_addr, scale) _mm512_i32gather_pd(vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i32gather_pd
+  #define _mm512_i32gather_pd(vindex, base_addr, scale) simde_mm512_i32gather_pd(vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_i32gather_pd (simde__m512d src, simde__mmask8 k, simde__m256i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m512d_private
+    src_ = simde__m512d_to_private(src),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src1[sizeof(r_.f64) / sizeof(r_.f64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+    src1[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(const uint8_t*, &(src_.f64[i]));
+    simde_prefetch(src1[i], 0);
+  }
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+    simde_memcpy(&(r_.f64[i]), src1[i], sizeof(r_.f64[i]));
+  }
+
+  return simde__m512d_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i32gather_pd(src, k, vindex, base_addr, scale) _mm512_mask_i32gather_pd(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i32gather_pd
+  #define _mm512_mask_i32gather_pd(src, k, vindex, base_addr, scale) simde_mm512_mask_i32gather_pd(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_i32gather_ps (simde__m512i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512_private
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src1[sizeof(r_.f32) / sizeof(r_.f32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+    src1[i] = addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale));
+    simde_prefetch(src1[i], 0);
+  }
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+    simde_memcpy(&(r_.f32[i]), src1[i], sizeof(r_.f32[i]));
+  }
+
+  return simde__m512_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i32gather_ps(vindex, base_addr, scale) _mm512_i32gather_ps(vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i32gather_ps
+  #define _mm512_i32gather_ps(vindex, base_addr, scale) simde_mm512_i32gather_ps(vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_i32gather_ps (simde__m512 src, simde__mmask16 k, simde__m512i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512_private
+    src_ = simde__m512_to_private(src),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src1[sizeof(r_.f32) / sizeof(r_.f32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+    src1[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(const uint8_t*, &(src_.f32[i]));
+    simde_prefetch(src1[i], 0);
+  }
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+    simde_memcpy(&(r_.f32[i]), src1[i], sizeof(r_.f32[i]));
+  }
+
+  return simde__m512_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i32gather_ps(src, k, vindex, base_addr, scale) _mm512_mask_i32gather_ps(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i32gather_ps
+  #define _mm512_mask_i32gather_ps(src, k, vindex, base_addr, scale) simde_mm512_mask_i32gather_ps(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm512_i64gather_epi32 (simde__m512i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m256i_private
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src1[sizeof(r_.i32) / sizeof(r_.i32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+    src1[i] = addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale));
+    simde_prefetch(src1[i], 0);
+  }
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+    simde_memcpy(&(r_.i32[i]), src1[i], sizeof(r_.i32[i]));
+  }
+
+  return simde__m256i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i64gather_epi32(vindex, base_addr, scale) _mm512_i64gather_epi32(vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i64gather_epi32
+  #define _mm512_i64gather_epi32(vindex, base_addr, scale) simde_mm512_i64gather_epi32(vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm512_mask_i64gather_epi32 (simde__m256i src, simde__mmask8 k, simde__m512i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m256i_private
+    src_ = simde__m256i_to_private(src),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src1[sizeof(r_.i32) / sizeof(r_.i32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+    src1[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(const uint8_t*, &(src_.i32[i]));
+    simde_prefetch(src1[i], 0);
+  }
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.i32) / sizeof(r_.i32[0])) ; i++) {
+    simde_memcpy(&(r_.i32[i]), src1[i], sizeof(r_.i32[i]));
+  }
+
+  return simde__m256i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i64gather_epi32(src, k, vindex, base_addr, scale) _mm512_mask_i64gather_epi32(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i64gather_epi32
+  #define _mm512_mask_i64gather_epi32(src, k, vindex, base_addr, scale) simde_mm512_mask_i64gather_epi32(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_i64gather_epi64 (simde__m512i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512i_private
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src1[sizeof(r_.i64) / sizeof(r_.i64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+    src1[i] = addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale));
+    simde_prefetch(src1[i], 0);
+  }
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+    simde_memcpy(&(r_.i64[i]), src1[i], sizeof(r_.i64[i]));
+  }
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i64gather_epi64(vindex, base_addr, scale) _mm512_i64gather_epi64(vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i64gather_epi64
+  #define _mm512_i64gather_epi64(vindex, base_addr, scale) simde_mm512_i64gather_epi64(vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_i64gather_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512i_private
+    src_ = simde__m512i_to_private(src),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src1[sizeof(r_.i64) / sizeof(r_.i64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+    src1[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(const uint8_t*, &(src_.i64[i]));
+    simde_prefetch(src1[i], 0);
+  }
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.i64) / sizeof(r_.i64[0])) ; i++) {
+    simde_memcpy(&(r_.i64[i]), src1[i], sizeof(r_.i64[i]));
+  }
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i64gather_epi64(src, k, vindex, base_addr, scale) _mm512_mask_i64gather_epi64(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i64gather_epi64
+  #define _mm512_mask_i64gather_epi64(src, k, vindex, base_addr, scale) simde_mm512_mask_i64gather_epi64(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_i64gather_pd (simde__m512i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512d_private
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src1[sizeof(r_.f64) / sizeof(r_.f64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+    src1[i] = addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale));
+    simde_prefetch(src1[i], 0);
+  }
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+    simde_memcpy(&(r_.f64[i]), src1[i], sizeof(r_.f64[i]));
+  }
+
+  return simde__m512d_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i64gather_pd(vindex, base_addr, scale) _mm512_i64gather_pd(vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i64gather_pd
+  #define _mm512_i64gather_pd(vindex, base_addr, scale) simde_mm512_i64gather_pd(vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_i64gather_pd (simde__m512d src, simde__mmask8 k, simde__m512i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512d_private
+    src_ = simde__m512d_to_private(src),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src1[sizeof(r_.f64) / sizeof(r_.f64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+    src1[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(const uint8_t*, &(src_.f64[i]));
+    simde_prefetch(src1[i], 0);
+  }
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+    simde_memcpy(&(r_.f64[i]), src1[i], sizeof(r_.f64[i]));
+  }
+
+  return simde__m512d_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i64gather_pd(src, k, vindex, base_addr, scale) _mm512_mask_i64gather_pd(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i64gather_pd
+  #define _mm512_mask_i64gather_pd(src, k, vindex, base_addr, scale) simde_mm512_mask_i64gather_pd(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm512_i64gather_ps (simde__m512i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m256_private
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src1[sizeof(r_.f32) / sizeof(r_.f32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+    src1[i] = addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale));
+    simde_prefetch(src1[i], 0);
+  }
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+    simde_memcpy(&(r_.f32[i]), src1[i], sizeof(r_.f32[i]));
+  }
+
+  return simde__m256_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i64gather_ps(vindex, base_addr, scale) _mm512_i64gather_ps(vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i64gather_ps
+  #define _mm512_i64gather_ps(vindex, base_addr, scale) simde_mm512_i64gather_ps(vindex, base_addr, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm512_mask_i64gather_ps (simde__m256 src, simde__mmask8 k, simde__m512i vindex, const void* base_addr, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m256_private
+    src_ = simde__m256_to_private(src),
+    r_;
+  const uint8_t* addr = HEDLEY_REINTERPRET_CAST(const uint8_t*, base_addr);
+  const uint8_t* src1[sizeof(r_.f32) / sizeof(r_.f32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+    src1[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(const uint8_t*, &(src_.f32[i]));
+    simde_prefetch(src1[i], 0);
+  }
+
+  SIMDE_VECTORIZE
+  for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+    simde_memcpy(&(r_.f32[i]), src1[i], sizeof(r_.f32[i]));
+  }
+
+  return simde__m256_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i64gather_ps(src, k, vindex, base_addr, scale) _mm512_mask_i64gather_ps(src, k, vindex, base_addr, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i64gather_ps
+  #define _mm512_mask_i64gather_ps(src, k, vindex, base_addr, scale) simde_mm512_mask_i64gather_ps(src, k, vindex, base_addr, scale)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_GATHER_H) */
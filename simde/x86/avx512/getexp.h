@@ -0,0 +1,168 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#if !defined(SIMDE_X86_AVX512_GETEXP_H)
+#define SIMDE_X86_AVX512_GETEXP_H
+
+#include "types.h"
+#include "mov.h"
+#include "../bmi.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_getexp_ps (simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_getexp_ps(a);
+  #else
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+      const uint32_t u = a_.u32[i] & UINT32_C(0x7fffffff);
+
+      if (u > UINT32_C(0x7f800000)) {
+        r_.u32[i] = a_.u32[i] | UINT32_C(0x00400000);
+      } else if (u == UINT32_C(0x7f800000)) {
+        r_.u32[i] = UINT32_C(0x7f800000);
+      } else if (u == 0) {
+        r_.u32[i] = UINT32_C(0x80000000) | UINT32_C(0x7f800000);
+      } else {
+        int e = HEDLEY_STATIC_CAST(int, u >> 23);
+        /* Denormals report the exponent they would have once normalized. */
+        if (e == 0)
+          e = 9 - simde_x_clz32(u);
+        r_.f32[i] = HEDLEY_STATIC_CAST(simde_float32, e - 127);
+      }
+    }
+
+    return simde__m512_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_getexp_ps
+  #define _mm512_getexp_ps(a) simde_mm512_getexp_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_getexp_ps (simde__m512 src, simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_getexp_ps(src, k, a);
+  #else
+    return simde_mm512_mask_mov_ps(src, k, simde_mm512_getexp_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_getexp_ps
+  #define _mm512_mask_getexp_ps(src, k, a) simde_mm512_mask_getexp_ps(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_getexp_ps (simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_maskz_getexp_ps(k, a);
+  #else
+    return simde_mm512_maskz_mov_ps(k, simde_mm512_getexp_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_getexp_ps
+  #define _mm512_maskz_getexp_ps(k, a) simde_mm512_maskz_getexp_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_getexp_pd (simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_getexp_pd(a);
+  #else
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+      const uint64_t u = a_.u64[i] & UINT64_C(0x7fffffffffffffff);
+
+      if (u > UINT64_C(0x7ff0000000000000)) {
+        r_.u64[i] = a_.u64[i] | UINT64_C(0x0008000000000000);
+      } else if (u == UINT64_C(0x7ff0000000000000)) {
+        r_.u64[i] = UINT64_C(0x7ff0000000000000);
+      } else if (u == 0) {
+        r_.u64[i] = UINT64_C(0x8000000000000000) | UINT64_C(0x7ff0000000000000);
+      } else {
+        int e = HEDLEY_STATIC_CAST(int, u >> 52);
+        if (e == 0)
+          e = 12 - simde_x_clz64(u);
+        r_.f64[i] = HEDLEY_STATIC_CAST(simde_float64, e - 1023);
+      }
+    }
+
+    return simde__m512d_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_getexp_pd
+  #define _mm512_getexp_pd(a) simde_mm512_getexp_pd(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_getexp_pd (simde__m512d src, simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_getexp_pd(src, k, a);
+  #else
+    return simde_mm512_mask_mov_pd(src, k, simde_mm512_getexp_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_getexp_pd
+  #define _mm512_mask_getexp_pd(src, k, a) simde_mm512_mask_getexp_pd(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_getexp_pd (simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_maskz_getexp_pd(k, a);
+  #else
+    return simde_mm512_maskz_mov_pd(k, simde_mm512_getexp_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_getexp_pd
+  #define _mm512_maskz_getexp_pd(k, a) simde_mm512_maskz_getexp_pd(k, a)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_GETEXP_H) */
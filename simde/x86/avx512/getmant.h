@@ -0,0 +1,231 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#if !defined(SIMDE_X86_AVX512_GETMANT_H)
+#define SIMDE_X86_AVX512_GETMANT_H
+
+#include "types.h"
+#include "mov.h"
+#include "../bmi.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define SIMDE_MM_MANT_NORM_1_2      _MM_MANT_NORM_1_2
+  #define SIMDE_MM_MANT_NORM_p5_2     _MM_MANT_NORM_p5_2
+  #define SIMDE_MM_MANT_NORM_p5_1     _MM_MANT_NORM_p5_1
+  #define SIMDE_MM_MANT_NORM_p75_1p5  _MM_MANT_NORM_p75_1p5
+  #define SIMDE_MM_MANT_SIGN_src      _MM_MANT_SIGN_src
+  #define SIMDE_MM_MANT_SIGN_zero     _MM_MANT_SIGN_zero
+  #define SIMDE_MM_MANT_SIGN_nan      _MM_MANT_SIGN_nan
+#else
+  #define SIMDE_MM_MANT_NORM_1_2      0
+  #define SIMDE_MM_MANT_NORM_p5_2     1
+  #define SIMDE_MM_MANT_NORM_p5_1     2
+  #define SIMDE_MM_MANT_NORM_p75_1p5  3
+  #define SIMDE_MM_MANT_SIGN_src      0
+  #define SIMDE_MM_MANT_SIGN_zero     1
+  #define SIMDE_MM_MANT_SIGN_nan      2
+#endif
+
+/* On x86 the compiler's headers declare these as enumerators even when
+ * AVX-512 isn't enabled, so only provide them elsewhere. */
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && !defined(SIMDE_ARCH_X86)
+  #define _MM_MANT_NORM_1_2 SIMDE_MM_MANT_NORM_1_2
+  #define _MM_MANT_NORM_p5_2 SIMDE_MM_MANT_NORM_p5_2
+  #define _MM_MANT_NORM_p5_1 SIMDE_MM_MANT_NORM_p5_1
+  #define _MM_MANT_NORM_p75_1p5 SIMDE_MM_MANT_NORM_p75_1p5
+  #define _MM_MANT_SIGN_src SIMDE_MM_MANT_SIGN_src
+  #define _MM_MANT_SIGN_zero SIMDE_MM_MANT_SIGN_zero
+  #define _MM_MANT_SIGN_nan SIMDE_MM_MANT_SIGN_nan
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_getmant_ps (simde__m512 a, int interv, int sc)
+    SIMDE_REQUIRE_CONSTANT_RANGE(interv, 0, 3)
+    SIMDE_REQUIRE_CONSTANT_RANGE(sc, 0, 3) {
+  simde__m512_private
+    r_,
+    a_ = simde__m512_to_private(a);
+
+  for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+    const uint32_t sign = (sc & SIMDE_MM_MANT_SIGN_zero) ? 0 : (a_.u32[i] & UINT32_C(0x80000000));
+    uint32_t u = a_.u32[i] & UINT32_C(0x7fffffff);
+
+    if (u > UINT32_C(0x7f800000)) {
+      r_.u32[i] = a_.u32[i] | UINT32_C(0x00400000);
+    } else if (u == 0) {
+      r_.u32[i] = sign | UINT32_C(0x3f800000);
+    } else if ((sc & SIMDE_MM_MANT_SIGN_nan) && (a_.u32[i] & UINT32_C(0x80000000))) {
+      r_.u32[i] = UINT32_C(0xffc00000);
+    } else if (u == UINT32_C(0x7f800000)) {
+      r_.u32[i] = sign | UINT32_C(0x3f800000);
+    } else {
+      int e = HEDLEY_STATIC_CAST(int, u >> 23);
+      uint32_t ne;
+      if (e == 0) {
+        /* Normalize denormals; only the parity of the exponent is used
+         * below, so it may go negative. */
+        const int shift = simde_x_clz32(u) - 8;
+        u <<= shift;
+        e = 1 - shift;
+      }
+
+      switch (interv) {
+        case SIMDE_MM_MANT_NORM_1_2:
+          ne = 127;
+          break;
+        case SIMDE_MM_MANT_NORM_p5_2:
+          ne = (e & 1) ? 127 : 126;
+          break;
+        case SIMDE_MM_MANT_NORM_p5_1:
+          ne = 126;
+          break;
+        default:
+          ne = (u & UINT32_C(0x00400000)) ? 126 : 127;
+          break;
+      }
+
+      r_.u32[i] = sign | (ne << 23) | (u & UINT32_C(0x007fffff));
+    }
+  }
+
+  return simde__m512_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_getmant_ps(a, interv, sc) _mm512_getmant_ps(a, HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_getmant_ps
+  #define _mm512_getmant_ps(a, interv, sc) simde_mm512_getmant_ps(a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_getmant_ps(src, k, a, interv, sc) _mm512_mask_getmant_ps(src, k, a, HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  #define simde_mm512_mask_getmant_ps(src, k, a, interv, sc) simde_mm512_mask_mov_ps(src, k, simde_mm512_getmant_ps(a, interv, sc))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_getmant_ps
+  #define _mm512_mask_getmant_ps(src, k, a, interv, sc) simde_mm512_mask_getmant_ps(src, k, a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_maskz_getmant_ps(k, a, interv, sc) _mm512_maskz_getmant_ps(k, a, HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  #define simde_mm512_maskz_getmant_ps(k, a, interv, sc) simde_mm512_maskz_mov_ps(k, simde_mm512_getmant_ps(a, interv, sc))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_getmant_ps
+  #define _mm512_maskz_getmant_ps(k, a, interv, sc) simde_mm512_maskz_getmant_ps(k, a, interv, sc)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_getmant_pd (simde__m512d a, int interv, int sc)
+    SIMDE_REQUIRE_CONSTANT_RANGE(interv, 0, 3)
+    SIMDE_REQUIRE_CONSTANT_RANGE(sc, 0, 3) {
+  simde__m512d_private
+    r_,
+    a_ = simde__m512d_to_private(a);
+
+  for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+    const uint64_t sign = (sc & SIMDE_MM_MANT_SIGN_zero) ? 0 : (a_.u64[i] & UINT64_C(0x8000000000000000));
+    uint64_t u = a_.u64[i] & UINT64_C(0x7fffffffffffffff);
+
+    if (u > UINT64_C(0x7ff0000000000000)) {
+      r_.u64[i] = a_.u64[i] | UINT64_C(0x0008000000000000);
+    } else if (u == 0) {
+      r_.u64[i] = sign | UINT64_C(0x3ff0000000000000);
+    } else if ((sc & SIMDE_MM_MANT_SIGN_nan) && (a_.u64[i] & UINT64_C(0x8000000000000000))) {
+      r_.u64[i] = UINT64_C(0xfff8000000000000);
+    } else if (u == UINT64_C(0x7ff0000000000000)) {
+      r_.u64[i] = sign | UINT64_C(0x3ff0000000000000);
+    } else {
+      int e = HEDLEY_STATIC_CAST(int, u >> 52);
+      uint64_t ne;
+      if (e == 0) {
+        const int shift = simde_x_clz64(u) - 11;
+        u <<= shift;
+        e = 1 - shift;
+      }
+
+      switch (interv) {
+        case SIMDE_MM_MANT_NORM_1_2:
+          ne = 1023;
+          break;
+        case SIMDE_MM_MANT_NORM_p5_2:
+          ne = (e & 1) ? 1023 : 1022;
+          break;
+        case SIMDE_MM_MANT_NORM_p5_1:
+          ne = 1022;
+          break;
+        default:
+          ne = (u & UINT64_C(0x0008000000000000)) ? 1022 : 1023;
+          break;
+      }
+
+      r_.u64[i] = sign | (ne << 52) | (u & UINT64_C(0x000fffffffffffff));
+    }
+  }
+
+  return simde__m512d_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_getmant_pd(a, interv, sc) _mm512_getmant_pd(a, HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_getmant_pd
+  #define _mm512_getmant_pd(a, interv, sc) simde_mm512_getmant_pd(a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_getmant_pd(src, k, a, interv, sc) _mm512_mask_getmant_pd(src, k, a, HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  #define simde_mm512_mask_getmant_pd(src, k, a, interv, sc) simde_mm512_mask_mov_pd(src, k, simde_mm512_getmant_pd(a, interv, sc))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_getmant_pd
+  #define _mm512_mask_getmant_pd(src, k, a, interv, sc) simde_mm512_mask_getmant_pd(src, k, a, interv, sc)
+#endif
+
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_maskz_getmant_pd(k, a, interv, sc) _mm512_maskz_getmant_pd(k, a, HEDLEY_STATIC_CAST(_MM_MANTISSA_NORM_ENUM, interv), HEDLEY_STATIC_CAST(_MM_MANTISSA_SIGN_ENUM, sc))
+#else
+  #define simde_mm512_maskz_getmant_pd(k, a, interv, sc) simde_mm512_maskz_mov_pd(k, simde_mm512_getmant_pd(a, interv, sc))
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_getmant_pd
+  #define _mm512_maskz_getmant_pd(k, a, interv, sc) simde_mm512_maskz_getmant_pd(k, a, interv, sc)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_GETMANT_H) */
@@ -0,0 +1,277 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#if !defined(SIMDE_X86_AVX512_KMOV_H)
+#define SIMDE_X86_AVX512_KMOV_H
+
+#include "types.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned int
+simde_cvtmask8_u32 (simde__mmask8 a) {
+  #if defined(SIMDE_X86_AVX512DQ_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _cvtmask8_u32(a);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned int, a);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512DQ_ENABLE_NATIVE_ALIASES)
+  #undef _cvtmask8_u32
+  #define _cvtmask8_u32(a) simde_cvtmask8_u32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_cvtu32_mask8 (unsigned int a) {
+  #if defined(SIMDE_X86_AVX512DQ_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _cvtu32_mask8(a);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask8, a);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512DQ_ENABLE_NATIVE_ALIASES)
+  #undef _cvtu32_mask8
+  #define _cvtu32_mask8(a) simde_cvtu32_mask8(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned int
+simde_cvtmask16_u32 (simde__mmask16 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _cvtmask16_u32(a);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned int, a);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _cvtmask16_u32
+  #define _cvtmask16_u32(a) simde_cvtmask16_u32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_cvtu32_mask16 (unsigned int a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _cvtu32_mask16(a);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask16, a);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _cvtu32_mask16
+  #define _cvtu32_mask16(a) simde_cvtu32_mask16(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned int
+simde_cvtmask32_u32 (simde__mmask32 a) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _cvtmask32_u32(a);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned int, a);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _cvtmask32_u32
+  #define _cvtmask32_u32(a) simde_cvtmask32_u32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_cvtu32_mask32 (unsigned int a) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _cvtu32_mask32(a);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask32, a);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _cvtu32_mask32
+  #define _cvtu32_mask32(a) simde_cvtu32_mask32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_cvtmask64_u64 (simde__mmask64 a) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _cvtmask64_u64(a);
+  #else
+    return HEDLEY_STATIC_CAST(uint64_t, a);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _cvtmask64_u64
+  #define _cvtmask64_u64(a) simde_cvtmask64_u64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_cvtu64_mask64 (uint64_t a) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _cvtu64_mask64(a);
+  #else
+    return HEDLEY_STATIC_CAST(simde__mmask64, a);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _cvtu64_mask64
+  #define _cvtu64_mask64(a) simde_cvtu64_mask64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__mmask8
+simde_load_mask8 (simde__mmask8* mem_addr) {
+  #if defined(SIMDE_X86_AVX512DQ_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _load_mask8(mem_addr);
+  #else
+    return *mem_addr;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512DQ_ENABLE_NATIVE_ALIASES)
+  #undef _load_mask8
+  #define _load_mask8(mem_addr) simde_load_mask8(mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_store_mask8 (simde__mmask8* mem_addr, simde__mmask8 a) {
+  #if defined(SIMDE_X86_AVX512DQ_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    _store_mask8(mem_addr, a);
+  #else
+    *mem_addr = a;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512DQ_ENABLE_NATIVE_ALIASES)
+  #undef _store_mask8
+  #define _store_mask8(mem_addr, a) simde_store_mask8(mem_addr, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_load_mask16 (simde__mmask16* mem_addr) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _load_mask16(mem_addr);
+  #else
+    return *mem_addr;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _load_mask16
+  #define _load_mask16(mem_addr) simde_load_mask16(mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_store_mask16 (simde__mmask16* mem_addr, simde__mmask16 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    _store_mask16(mem_addr, a);
+  #else
+    *mem_addr = a;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _store_mask16
+  #define _store_mask16(mem_addr, a) simde_store_mask16(mem_addr, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__mmask32
+simde_load_mask32 (simde__mmask32* mem_addr) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _load_mask32(HEDLEY_REINTERPRET_CAST(__mmask32*, mem_addr));
+  #else
+    return *mem_addr;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _load_mask32
+  #define _load_mask32(mem_addr) simde_load_mask32(mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_store_mask32 (simde__mmask32* mem_addr, simde__mmask32 a) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    _store_mask32(HEDLEY_REINTERPRET_CAST(__mmask32*, mem_addr), a);
+  #else
+    *mem_addr = a;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _store_mask32
+  #define _store_mask32(mem_addr, a) simde_store_mask32(mem_addr, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__mmask64
+simde_load_mask64 (simde__mmask64* mem_addr) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _load_mask64(HEDLEY_REINTERPRET_CAST(__mmask64*, mem_addr));
+  #else
+    return *mem_addr;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _load_mask64
+  #define _load_mask64(mem_addr) simde_load_mask64(mem_addr)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_store_mask64 (simde__mmask64* mem_addr, simde__mmask64 a) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    _store_mask64(HEDLEY_REINTERPRET_CAST(__mmask64*, mem_addr), a);
+  #else
+    *mem_addr = a;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _store_mask64
+  #define _store_mask64(mem_addr, a) simde_store_mask64(mem_addr, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__mmask16
+simde_mm512_kmov (simde__mmask16 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_kmov(a);
+  #else
+    return a;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_kmov
+  #define _mm512_kmov(a) simde_mm512_kmov(a)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_KMOV_H) */
@@ -0,0 +1,239 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#if !defined(SIMDE_X86_AVX512_KORTEST_H)
+#define SIMDE_X86_AVX512_KORTEST_H
+
+#include "types.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortestz_mask8_u8 (simde__mmask8 a, simde__mmask8 b) {
+  #if defined(SIMDE_X86_AVX512DQ_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _kortestz_mask8_u8(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned char, (a | b) == 0);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512DQ_ENABLE_NATIVE_ALIASES)
+  #undef _kortestz_mask8_u8
+  #define _kortestz_mask8_u8(a, b) simde_kortestz_mask8_u8(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortestc_mask8_u8 (simde__mmask8 a, simde__mmask8 b) {
+  #if defined(SIMDE_X86_AVX512DQ_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _kortestc_mask8_u8(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned char, (a | b) == UINT8_MAX);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512DQ_ENABLE_NATIVE_ALIASES)
+  #undef _kortestc_mask8_u8
+  #define _kortestc_mask8_u8(a, b) simde_kortestc_mask8_u8(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortest_mask8_u8 (simde__mmask8 a, simde__mmask8 b, unsigned char* all_ones) {
+  #if defined(SIMDE_X86_AVX512DQ_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _kortest_mask8_u8(a, b, all_ones);
+  #else
+    *all_ones = simde_kortestc_mask8_u8(a, b);
+    return simde_kortestz_mask8_u8(a, b);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512DQ_ENABLE_NATIVE_ALIASES)
+  #undef _kortest_mask8_u8
+  #define _kortest_mask8_u8(a, b, all_ones) simde_kortest_mask8_u8(a, b, all_ones)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortestz_mask16_u8 (simde__mmask16 a, simde__mmask16 b) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _kortestz_mask16_u8(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned char, (a | b) == 0);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _kortestz_mask16_u8
+  #define _kortestz_mask16_u8(a, b) simde_kortestz_mask16_u8(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortestc_mask16_u8 (simde__mmask16 a, simde__mmask16 b) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _kortestc_mask16_u8(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned char, (a | b) == UINT16_MAX);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _kortestc_mask16_u8
+  #define _kortestc_mask16_u8(a, b) simde_kortestc_mask16_u8(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortest_mask16_u8 (simde__mmask16 a, simde__mmask16 b, unsigned char* all_ones) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _kortest_mask16_u8(a, b, all_ones);
+  #else
+    *all_ones = simde_kortestc_mask16_u8(a, b);
+    return simde_kortestz_mask16_u8(a, b);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _kortest_mask16_u8
+  #define _kortest_mask16_u8(a, b, all_ones) simde_kortest_mask16_u8(a, b, all_ones)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortestz_mask32_u8 (simde__mmask32 a, simde__mmask32 b) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _kortestz_mask32_u8(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned char, (a | b) == 0);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _kortestz_mask32_u8
+  #define _kortestz_mask32_u8(a, b) simde_kortestz_mask32_u8(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortestc_mask32_u8 (simde__mmask32 a, simde__mmask32 b) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _kortestc_mask32_u8(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned char, (a | b) == UINT32_MAX);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _kortestc_mask32_u8
+  #define _kortestc_mask32_u8(a, b) simde_kortestc_mask32_u8(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortest_mask32_u8 (simde__mmask32 a, simde__mmask32 b, unsigned char* all_ones) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _kortest_mask32_u8(a, b, all_ones);
+  #else
+    *all_ones = simde_kortestc_mask32_u8(a, b);
+    return simde_kortestz_mask32_u8(a, b);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _kortest_mask32_u8
+  #define _kortest_mask32_u8(a, b, all_ones) simde_kortest_mask32_u8(a, b, all_ones)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortestz_mask64_u8 (simde__mmask64 a, simde__mmask64 b) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _kortestz_mask64_u8(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned char, (a | b) == 0);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _kortestz_mask64_u8
+  #define _kortestz_mask64_u8(a, b) simde_kortestz_mask64_u8(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortestc_mask64_u8 (simde__mmask64 a, simde__mmask64 b) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _kortestc_mask64_u8(a, b);
+  #else
+    return HEDLEY_STATIC_CAST(unsigned char, (a | b) == UINT64_MAX);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _kortestc_mask64_u8
+  #define _kortestc_mask64_u8(a, b) simde_kortestc_mask64_u8(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+unsigned char
+simde_kortest_mask64_u8 (simde__mmask64 a, simde__mmask64 b, unsigned char* all_ones) {
+  #if defined(SIMDE_X86_AVX512BW_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _kortest_mask64_u8(a, b, all_ones);
+  #else
+    *all_ones = simde_kortestc_mask64_u8(a, b);
+    return simde_kortestz_mask64_u8(a, b);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512BW_ENABLE_NATIVE_ALIASES)
+  #undef _kortest_mask64_u8
+  #define _kortest_mask64_u8(a, b, all_ones) simde_kortest_mask64_u8(a, b, all_ones)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_mm512_kortestz (simde__mmask16 a, simde__mmask16 b) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_kortestz(a, b);
+  #else
+    return simde_kortestz_mask16_u8(a, b);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_kortestz
+  #define _mm512_kortestz(a, b) simde_mm512_kortestz(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int
+simde_mm512_kortestc (simde__mmask16 a, simde__mmask16 b) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_kortestc(a, b);
+  #else
+    return simde_kortestc_mask16_u8(a, b);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_kortestc
+  #define _mm512_kortestc(a, b) simde_mm512_kortestc(a, b)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_KORTEST_H) */
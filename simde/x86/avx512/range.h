@@ -0,0 +1,223 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#if !defined(SIMDE_X86_AVX512_RANGE_H)
+#define SIMDE_X86_AVX512_RANGE_H
+
+#include "types.h"
+#include "mov.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_range_ps (simde__m512 a, simde__m512 b, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 15) {
+  simde__m512_private
+    r_,
+    a_ = simde__m512_to_private(a),
+    b_ = simde__m512_to_private(b);
+
+  for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+    const uint32_t ax = a_.u32[i], au = ax & UINT32_C(0x7fffffff);
+    const uint32_t bx = b_.u32[i], bu = bx & UINT32_C(0x7fffffff);
+    uint32_t r;
+
+    if ((au > UINT32_C(0x7f800000)) && !(ax & UINT32_C(0x00400000))) {
+      r_.u32[i] = ax | UINT32_C(0x00400000);
+      continue;
+    } else if ((bu > UINT32_C(0x7f800000)) && !(bx & UINT32_C(0x00400000))) {
+      r_.u32[i] = bx | UINT32_C(0x00400000);
+      continue;
+    }
+
+    /* A single quiet NaN loses to the other operand.  When the values
+     * compare equal, or/and-ing the bits picks -0 for min and +0 for
+     * max. */
+    if (au > UINT32_C(0x7f800000)) {
+      r = (bu > UINT32_C(0x7f800000)) ? ax : bx;
+    } else if (bu > UINT32_C(0x7f800000)) {
+      r = ax;
+    } else {
+      switch (imm8 & 3) {
+        case 0:
+          r = (a_.f32[i] < b_.f32[i]) ? ax : ((b_.f32[i] < a_.f32[i]) ? bx : (ax | bx));
+          break;
+        case 1:
+          r = (a_.f32[i] > b_.f32[i]) ? ax : ((b_.f32[i] > a_.f32[i]) ? bx : (ax & bx));
+          break;
+        case 2:
+          r = (au < bu) ? ax : ((bu < au) ? bx : (ax | bx));
+          break;
+        default:
+          r = (au > bu) ? ax : ((bu > au) ? bx : (ax & bx));
+          break;
+      }
+    }
+
+    switch ((imm8 >> 2) & 3) {
+      case 0:
+        r = (r & UINT32_C(0x7fffffff)) | (ax & UINT32_C(0x80000000));
+        break;
+      case 1:
+        break;
+      case 2:
+        r &= UINT32_C(0x7fffffff);
+        break;
+      default:
+        r |= UINT32_C(0x80000000);
+        break;
+    }
+
+    r_.u32[i] = r;
+  }
+
+  return simde__m512_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512DQ_NATIVE)
+  #define simde_mm512_range_ps(a, b, imm8) _mm512_range_ps(a, b, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512DQ_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_range_ps
+  #define _mm512_range_ps(a, b, imm8) simde_mm512_range_ps(a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512DQ_NATIVE)
+  #define simde_mm512_mask_range_ps(src, k, a, b, imm8) _mm512_mask_range_ps(src, k, a, b, imm8)
+#else
+  #define simde_mm512_mask_range_ps(src, k, a, b, imm8) simde_mm512_mask_mov_ps(src, k, simde_mm512_range_ps(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512DQ_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_range_ps
+  #define _mm512_mask_range_ps(src, k, a, b, imm8) simde_mm512_mask_range_ps(src, k, a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512DQ_NATIVE)
+  #define simde_mm512_maskz_range_ps(k, a, b, imm8) _mm512_maskz_range_ps(k, a, b, imm8)
+#else
+  #define simde_mm512_maskz_range_ps(k, a, b, imm8) simde_mm512_maskz_mov_ps(k, simde_mm512_range_ps(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512DQ_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_range_ps
+  #define _mm512_maskz_range_ps(k, a, b, imm8) simde_mm512_maskz_range_ps(k, a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_range_pd (simde__m512d a, simde__m512d b, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 15) {
+  simde__m512d_private
+    r_,
+    a_ = simde__m512d_to_private(a),
+    b_ = simde__m512d_to_private(b);
+
+  for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+    const uint64_t ax = a_.u64[i], au = ax & UINT64_C(0x7fffffffffffffff);
+    const uint64_t bx = b_.u64[i], bu = bx & UINT64_C(0x7fffffffffffffff);
+    uint64_t r;
+
+    if ((au > UINT64_C(0x7ff0000000000000)) && !(ax & UINT64_C(0x0008000000000000))) {
+      r_.u64[i] = ax | UINT64_C(0x0008000000000000);
+      continue;
+    } else if ((bu > UINT64_C(0x7ff0000000000000)) && !(bx & UINT64_C(0x0008000000000000))) {
+      r_.u64[i] = bx | UINT64_C(0x0008000000000000);
+      continue;
+    }
+
+    if (au > UINT64_C(0x7ff0000000000000)) {
+      r = (bu > UINT64_C(0x7ff0000000000000)) ? ax : bx;
+    } else if (bu > UINT64_C(0x7ff0000000000000)) {
+      r = ax;
+    } else {
+      switch (imm8 & 3) {
+        case 0:
+          r = (a_.f64[i] < b_.f64[i]) ? ax : ((b_.f64[i] < a_.f64[i]) ? bx : (ax | bx));
+          break;
+        case 1:
+          r = (a_.f64[i] > b_.f64[i]) ? ax : ((b_.f64[i] > a_.f64[i]) ? bx : (ax & bx));
+          break;
+        case 2:
+          r = (au < bu) ? ax : ((bu < au) ? bx : (ax | bx));
+          break;
+        default:
+          r = (au > bu) ? ax : ((bu > au) ? bx : (ax & bx));
+          break;
+      }
+    }
+
+    switch ((imm8 >> 2) & 3) {
+      case 0:
+        r = (r & UINT64_C(0x7fffffffffffffff)) | (ax & UINT64_C(0x8000000000000000));
+        break;
+      case 1:
+        break;
+      case 2:
+        r &= UINT64_C(0x7fffffffffffffff);
+        break;
+      default:
+        r |= UINT64_C(0x8000000000000000);
+        break;
+    }
+
+    r_.u64[i] = r;
+  }
+
+  return simde__m512d_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512DQ_NATIVE)
+  #define simde_mm512_range_pd(a, b, imm8) _mm512_range_pd(a, b, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512DQ_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_range_pd
+  #define _mm512_range_pd(a, b, imm8) simde_mm512_range_pd(a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512DQ_NATIVE)
+  #define simde_mm512_mask_range_pd(src, k, a, b, imm8) _mm512_mask_range_pd(src, k, a, b, imm8)
+#else
+  #define simde_mm512_mask_range_pd(src, k, a, b, imm8) simde_mm512_mask_mov_pd(src, k, simde_mm512_range_pd(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512DQ_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_range_pd
+  #define _mm512_mask_range_pd(src, k, a, b, imm8) simde_mm512_mask_range_pd(src, k, a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512DQ_NATIVE)
+  #define simde_mm512_maskz_range_pd(k, a, b, imm8) _mm512_maskz_range_pd(k, a, b, imm8)
+#else
+  #define simde_mm512_maskz_range_pd(k, a, b, imm8) simde_mm512_maskz_mov_pd(k, simde_mm512_range_pd(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512DQ_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_range_pd
+  #define _mm512_maskz_range_pd(k, a, b, imm8) simde_mm512_maskz_range_pd(k, a, b, imm8)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_RANGE_H) */
@@ -0,0 +1,904 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#if !defined(SIMDE_X86_AVX512_REDUCE_H)
+#define SIMDE_X86_AVX512_REDUCE_H
+
+#include "types.h"
+#include "../avx2.h"
+#include "mov.h"
+#include "set1.h"
+#include "setzero.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* The portable versions fold the two 256-bit halves together, then the
+ * two 128-bit halves, then finish with in-register shuffles, which is the
+ * same order of operations GCC and clang use for the native sequences. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_reduce_add_epi32 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_reduce_add_epi32(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      return vaddvq_s32(vaddq_s32(vaddq_s32(a_.m128i_private[0].neon_i32, a_.m128i_private[2].neon_i32), vaddq_s32(a_.m128i_private[1].neon_i32, a_.m128i_private[3].neon_i32)));
+    #else
+      simde__m256i_private t256_ = simde__m256i_to_private(simde_mm256_add_epi32(a_.m256i[0], a_.m256i[1]));
+      simde__m128i t = simde_mm_add_epi32(t256_.m128i[0], t256_.m128i[1]);
+      t = simde_mm_add_epi32(t, simde_mm_shuffle_epi32(t, SIMDE_MM_SHUFFLE(1, 0, 3, 2)));
+      t = simde_mm_add_epi32(t, simde_mm_shuffle_epi32(t, SIMDE_MM_SHUFFLE(2, 3, 0, 1)));
+      return simde_mm_cvtsi128_si32(t);
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_add_epi32
+  #define _mm512_reduce_add_epi32(a) simde_mm512_reduce_add_epi32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_mask_reduce_add_epi32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_mask_reduce_add_epi32(k, a);
+  #else
+    return simde_mm512_reduce_add_epi32(simde_mm512_maskz_mov_epi32(k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_add_epi32
+  #define _mm512_mask_reduce_add_epi32(k, a) simde_mm512_mask_reduce_add_epi32(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_reduce_add_epi64 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_reduce_add_epi64(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      return vaddvq_s64(vaddq_s64(vaddq_s64(a_.m128i_private[0].neon_i64, a_.m128i_private[2].neon_i64), vaddq_s64(a_.m128i_private[1].neon_i64, a_.m128i_private[3].neon_i64)));
+    #else
+      simde__m256i_private t256_ = simde__m256i_to_private(simde_mm256_add_epi64(a_.m256i[0], a_.m256i[1]));
+      simde__m128i t = simde_mm_add_epi64(t256_.m128i[0], t256_.m128i[1]);
+      t = simde_mm_add_epi64(t, simde_mm_shuffle_epi32(t, SIMDE_MM_SHUFFLE(1, 0, 3, 2)));
+      return simde_mm_cvtsi128_si64(t);
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_add_epi64
+  #define _mm512_reduce_add_epi64(a) simde_mm512_reduce_add_epi64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_mask_reduce_add_epi64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_mask_reduce_add_epi64(k, a);
+  #else
+    return simde_mm512_reduce_add_epi64(simde_mm512_maskz_mov_epi64(k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_add_epi64
+  #define _mm512_mask_reduce_add_epi64(k, a) simde_mm512_mask_reduce_add_epi64(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_reduce_add_ps (simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_reduce_add_ps(a);
+  #else
+    simde__m512_private a_ = simde__m512_to_private(a);
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      return vaddvq_f32(vaddq_f32(vaddq_f32(a_.m128_private[0].neon_f32, a_.m128_private[2].neon_f32), vaddq_f32(a_.m128_private[1].neon_f32, a_.m128_private[3].neon_f32)));
+    #else
+      simde__m256_private t256_ = simde__m256_to_private(simde_mm256_add_ps(a_.m256[0], a_.m256[1]));
+      simde__m128 t = simde_mm_add_ps(t256_.m128[0], t256_.m128[1]);
+      t = simde_mm_add_ps(t, simde_mm_shuffle_ps(t, t, SIMDE_MM_SHUFFLE(1, 0, 3, 2)));
+      t = simde_mm_add_ps(t, simde_mm_shuffle_ps(t, t, SIMDE_MM_SHUFFLE(2, 3, 0, 1)));
+      return simde_mm_cvtss_f32(t);
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_add_ps
+  #define _mm512_reduce_add_ps(a) simde_mm512_reduce_add_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_mask_reduce_add_ps (simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_mask_reduce_add_ps(k, a);
+  #else
+    return simde_mm512_reduce_add_ps(simde_mm512_maskz_mov_ps(k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_add_ps
+  #define _mm512_mask_reduce_add_ps(k, a) simde_mm512_mask_reduce_add_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_reduce_add_pd (simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_reduce_add_pd(a);
+  #else
+    simde__m512d_private a_ = simde__m512d_to_private(a);
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      return vaddvq_f64(vaddq_f64(vaddq_f64(a_.m128d_private[0].neon_f64, a_.m128d_private[2].neon_f64), vaddq_f64(a_.m128d_private[1].neon_f64, a_.m128d_private[3].neon_f64)));
+    #else
+      simde__m256d_private t256_ = simde__m256d_to_private(simde_mm256_add_pd(a_.m256d[0], a_.m256d[1]));
+      simde__m128d t = simde_mm_add_pd(t256_.m128d[0], t256_.m128d[1]);
+      t = simde_mm_add_pd(t, simde_mm_shuffle_pd(t, t, 1));
+      return simde_mm_cvtsd_f64(t);
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_add_pd
+  #define _mm512_reduce_add_pd(a) simde_mm512_reduce_add_pd(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_mask_reduce_add_pd (simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_mask_reduce_add_pd(k, a);
+  #else
+    return simde_mm512_reduce_add_pd(simde_mm512_maskz_mov_pd(k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_add_pd
+  #define _mm512_mask_reduce_add_pd(k, a) simde_mm512_mask_reduce_add_pd(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_reduce_mul_epi32 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_reduce_mul_epi32(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+
+    simde__m256i_private t256_ = simde__m256i_to_private(simde_mm256_mullo_epi32(a_.m256i[0], a_.m256i[1]));
+    simde__m128i t = simde_mm_mullo_epi32(t256_.m128i[0], t256_.m128i[1]);
+    t = simde_mm_mullo_epi32(t, simde_mm_shuffle_epi32(t, SIMDE_MM_SHUFFLE(1, 0, 3, 2)));
+    t = simde_mm_mullo_epi32(t, simde_mm_shuffle_epi32(t, SIMDE_MM_SHUFFLE(2, 3, 0, 1)));
+    return simde_mm_cvtsi128_si32(t);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_mul_epi32
+  #define _mm512_reduce_mul_epi32(a) simde_mm512_reduce_mul_epi32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_mask_reduce_mul_epi32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_mask_reduce_mul_epi32(k, a);
+  #else
+    return simde_mm512_reduce_mul_epi32(simde_mm512_mask_mov_epi32(simde_mm512_set1_epi32(1), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_mul_epi32
+  #define _mm512_mask_reduce_mul_epi32(k, a) simde_mm512_mask_reduce_mul_epi32(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_reduce_mul_epi64 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_reduce_mul_epi64(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+
+    uint64_t r = a_.u64[0];
+    for (size_t i = 1 ; i < (sizeof(a_.u64) / sizeof(a_.u64[0])) ; i++) {
+      r *= a_.u64[i];
+    }
+    return HEDLEY_STATIC_CAST(int64_t, r);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_mul_epi64
+  #define _mm512_reduce_mul_epi64(a) simde_mm512_reduce_mul_epi64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_mask_reduce_mul_epi64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_mask_reduce_mul_epi64(k, a);
+  #else
+    return simde_mm512_reduce_mul_epi64(simde_mm512_mask_mov_epi64(simde_mm512_set1_epi64(1), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_mul_epi64
+  #define _mm512_mask_reduce_mul_epi64(k, a) simde_mm512_mask_reduce_mul_epi64(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_reduce_mul_ps (simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_reduce_mul_ps(a);
+  #else
+    simde__m512_private a_ = simde__m512_to_private(a);
+
+    simde__m256_private t256_ = simde__m256_to_private(simde_mm256_mul_ps(a_.m256[0], a_.m256[1]));
+    simde__m128 t = simde_mm_mul_ps(t256_.m128[0], t256_.m128[1]);
+    t = simde_mm_mul_ps(t, simde_mm_shuffle_ps(t, t, SIMDE_MM_SHUFFLE(1, 0, 3, 2)));
+    t = simde_mm_mul_ps(t, simde_mm_shuffle_ps(t, t, SIMDE_MM_SHUFFLE(2, 3, 0, 1)));
+    return simde_mm_cvtss_f32(t);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_mul_ps
+  #define _mm512_reduce_mul_ps(a) simde_mm512_reduce_mul_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_mask_reduce_mul_ps (simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_mask_reduce_mul_ps(k, a);
+  #else
+    return simde_mm512_reduce_mul_ps(simde_mm512_mask_mov_ps(simde_mm512_set1_ps(SIMDE_FLOAT32_C(1.0)), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_mul_ps
+  #define _mm512_mask_reduce_mul_ps(k, a) simde_mm512_mask_reduce_mul_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_reduce_mul_pd (simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_reduce_mul_pd(a);
+  #else
+    simde__m512d_private a_ = simde__m512d_to_private(a);
+
+    simde__m256d_private t256_ = simde__m256d_to_private(simde_mm256_mul_pd(a_.m256d[0], a_.m256d[1]));
+    simde__m128d t = simde_mm_mul_pd(t256_.m128d[0], t256_.m128d[1]);
+    t = simde_mm_mul_pd(t, simde_mm_shuffle_pd(t, t, 1));
+    return simde_mm_cvtsd_f64(t);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_mul_pd
+  #define _mm512_reduce_mul_pd(a) simde_mm512_reduce_mul_pd(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_mask_reduce_mul_pd (simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_mask_reduce_mul_pd(k, a);
+  #else
+    return simde_mm512_reduce_mul_pd(simde_mm512_mask_mov_pd(simde_mm512_set1_pd(SIMDE_FLOAT64_C(1.0)), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_mul_pd
+  #define _mm512_mask_reduce_mul_pd(k, a) simde_mm512_mask_reduce_mul_pd(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_reduce_max_epi32 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_reduce_max_epi32(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      return vmaxvq_s32(vmaxq_s32(vmaxq_s32(a_.m128i_private[0].neon_i32, a_.m128i_private[2].neon_i32), vmaxq_s32(a_.m128i_private[1].neon_i32, a_.m128i_private[3].neon_i32)));
+    #else
+      simde__m256i_private t256_ = simde__m256i_to_private(simde_mm256_max_epi32(a_.m256i[0], a_.m256i[1]));
+      simde__m128i t = simde_mm_max_epi32(t256_.m128i[0], t256_.m128i[1]);
+      t = simde_mm_max_epi32(t, simde_mm_shuffle_epi32(t, SIMDE_MM_SHUFFLE(1, 0, 3, 2)));
+      t = simde_mm_max_epi32(t, simde_mm_shuffle_epi32(t, SIMDE_MM_SHUFFLE(2, 3, 0, 1)));
+      return simde_mm_cvtsi128_si32(t);
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_max_epi32
+  #define _mm512_reduce_max_epi32(a) simde_mm512_reduce_max_epi32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_mask_reduce_max_epi32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_mask_reduce_max_epi32(k, a);
+  #else
+    return simde_mm512_reduce_max_epi32(simde_mm512_mask_mov_epi32(simde_mm512_set1_epi32(INT32_MIN), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_max_epi32
+  #define _mm512_mask_reduce_max_epi32(k, a) simde_mm512_mask_reduce_max_epi32(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_mm512_reduce_max_epu32 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_reduce_max_epu32(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      return vmaxvq_u32(vmaxq_u32(vmaxq_u32(a_.m128i_private[0].neon_u32, a_.m128i_private[2].neon_u32), vmaxq_u32(a_.m128i_private[1].neon_u32, a_.m128i_private[3].neon_u32)));
+    #else
+      simde__m256i_private t256_ = simde__m256i_to_private(simde_mm256_max_epu32(a_.m256i[0], a_.m256i[1]));
+      simde__m128i t = simde_mm_max_epu32(t256_.m128i[0], t256_.m128i[1]);
+      t = simde_mm_max_epu32(t, simde_mm_shuffle_epi32(t, SIMDE_MM_SHUFFLE(1, 0, 3, 2)));
+      t = simde_mm_max_epu32(t, simde_mm_shuffle_epi32(t, SIMDE_MM_SHUFFLE(2, 3, 0, 1)));
+      return HEDLEY_STATIC_CAST(uint32_t, simde_mm_cvtsi128_si32(t));
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_max_epu32
+  #define _mm512_reduce_max_epu32(a) simde_mm512_reduce_max_epu32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_mm512_mask_reduce_max_epu32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_mask_reduce_max_epu32(k, a);
+  #else
+    return simde_mm512_reduce_max_epu32(simde_mm512_mask_mov_epi32(simde_mm512_setzero_si512(), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_max_epu32
+  #define _mm512_mask_reduce_max_epu32(k, a) simde_mm512_mask_reduce_max_epu32(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_reduce_max_epi64 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_reduce_max_epi64(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+
+    int64_t r = a_.i64[0];
+    for (size_t i = 1 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+      r = (r > a_.i64[i]) ? r : a_.i64[i];
+    }
+    return r;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_max_epi64
+  #define _mm512_reduce_max_epi64(a) simde_mm512_reduce_max_epi64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_mask_reduce_max_epi64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_mask_reduce_max_epi64(k, a);
+  #else
+    return simde_mm512_reduce_max_epi64(simde_mm512_mask_mov_epi64(simde_mm512_set1_epi64(INT64_MIN), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_max_epi64
+  #define _mm512_mask_reduce_max_epi64(k, a) simde_mm512_mask_reduce_max_epi64(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_mm512_reduce_max_epu64 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_reduce_max_epu64(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+
+    uint64_t r = a_.u64[0];
+    for (size_t i = 1 ; i < (sizeof(a_.u64) / sizeof(a_.u64[0])) ; i++) {
+      r = (r > a_.u64[i]) ? r : a_.u64[i];
+    }
+    return r;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_max_epu64
+  #define _mm512_reduce_max_epu64(a) simde_mm512_reduce_max_epu64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_mm512_mask_reduce_max_epu64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_mask_reduce_max_epu64(k, a);
+  #else
+    return simde_mm512_reduce_max_epu64(simde_mm512_mask_mov_epi64(simde_mm512_setzero_si512(), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_max_epu64
+  #define _mm512_mask_reduce_max_epu64(k, a) simde_mm512_mask_reduce_max_epu64(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_reduce_max_ps (simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_reduce_max_ps(a);
+  #else
+    simde__m512_private a_ = simde__m512_to_private(a);
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(SIMDE_FAST_NANS)
+      return vmaxvq_f32(vmaxq_f32(vmaxq_f32(a_.m128_private[0].neon_f32, a_.m128_private[2].neon_f32), vmaxq_f32(a_.m128_private[1].neon_f32, a_.m128_private[3].neon_f32)));
+    #else
+      simde__m256_private t256_ = simde__m256_to_private(simde_mm256_max_ps(a_.m256[0], a_.m256[1]));
+      simde__m128 t = simde_mm_max_ps(t256_.m128[0], t256_.m128[1]);
+      t = simde_mm_max_ps(t, simde_mm_shuffle_ps(t, t, SIMDE_MM_SHUFFLE(1, 0, 3, 2)));
+      t = simde_mm_max_ps(t, simde_mm_shuffle_ps(t, t, SIMDE_MM_SHUFFLE(2, 3, 0, 1)));
+      return simde_mm_cvtss_f32(t);
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_max_ps
+  #define _mm512_reduce_max_ps(a) simde_mm512_reduce_max_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_mask_reduce_max_ps (simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_mask_reduce_max_ps(k, a);
+  #else
+    return simde_mm512_reduce_max_ps(simde_mm512_mask_mov_ps(simde_mm512_set1_ps(-SIMDE_MATH_INFINITYF), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_max_ps
+  #define _mm512_mask_reduce_max_ps(k, a) simde_mm512_mask_reduce_max_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_reduce_max_pd (simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_reduce_max_pd(a);
+  #else
+    simde__m512d_private a_ = simde__m512d_to_private(a);
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(SIMDE_FAST_NANS)
+      return vmaxvq_f64(vmaxq_f64(vmaxq_f64(a_.m128d_private[0].neon_f64, a_.m128d_private[2].neon_f64), vmaxq_f64(a_.m128d_private[1].neon_f64, a_.m128d_private[3].neon_f64)));
+    #else
+      simde__m256d_private t256_ = simde__m256d_to_private(simde_mm256_max_pd(a_.m256d[0], a_.m256d[1]));
+      simde__m128d t = simde_mm_max_pd(t256_.m128d[0], t256_.m128d[1]);
+      t = simde_mm_max_pd(t, simde_mm_shuffle_pd(t, t, 1));
+      return simde_mm_cvtsd_f64(t);
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_max_pd
+  #define _mm512_reduce_max_pd(a) simde_mm512_reduce_max_pd(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_mask_reduce_max_pd (simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_mask_reduce_max_pd(k, a);
+  #else
+    return simde_mm512_reduce_max_pd(simde_mm512_mask_mov_pd(simde_mm512_set1_pd(-SIMDE_MATH_INFINITY), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_max_pd
+  #define _mm512_mask_reduce_max_pd(k, a) simde_mm512_mask_reduce_max_pd(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_reduce_min_epi32 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_reduce_min_epi32(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      return vminvq_s32(vminq_s32(vminq_s32(a_.m128i_private[0].neon_i32, a_.m128i_private[2].neon_i32), vminq_s32(a_.m128i_private[1].neon_i32, a_.m128i_private[3].neon_i32)));
+    #else
+      simde__m256i_private t256_ = simde__m256i_to_private(simde_mm256_min_epi32(a_.m256i[0], a_.m256i[1]));
+      simde__m128i t = simde_mm_min_epi32(t256_.m128i[0], t256_.m128i[1]);
+      t = simde_mm_min_epi32(t, simde_mm_shuffle_epi32(t, SIMDE_MM_SHUFFLE(1, 0, 3, 2)));
+      t = simde_mm_min_epi32(t, simde_mm_shuffle_epi32(t, SIMDE_MM_SHUFFLE(2, 3, 0, 1)));
+      return simde_mm_cvtsi128_si32(t);
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_min_epi32
+  #define _mm512_reduce_min_epi32(a) simde_mm512_reduce_min_epi32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_mask_reduce_min_epi32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_mask_reduce_min_epi32(k, a);
+  #else
+    return simde_mm512_reduce_min_epi32(simde_mm512_mask_mov_epi32(simde_mm512_set1_epi32(INT32_MAX), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_min_epi32
+  #define _mm512_mask_reduce_min_epi32(k, a) simde_mm512_mask_reduce_min_epi32(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_mm512_reduce_min_epu32 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_reduce_min_epu32(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      return vminvq_u32(vminq_u32(vminq_u32(a_.m128i_private[0].neon_u32, a_.m128i_private[2].neon_u32), vminq_u32(a_.m128i_private[1].neon_u32, a_.m128i_private[3].neon_u32)));
+    #else
+      simde__m256i_private t256_ = simde__m256i_to_private(simde_mm256_min_epu32(a_.m256i[0], a_.m256i[1]));
+      simde__m128i t = simde_mm_min_epu32(t256_.m128i[0], t256_.m128i[1]);
+      t = simde_mm_min_epu32(t, simde_mm_shuffle_epi32(t, SIMDE_MM_SHUFFLE(1, 0, 3, 2)));
+      t = simde_mm_min_epu32(t, simde_mm_shuffle_epi32(t, SIMDE_MM_SHUFFLE(2, 3, 0, 1)));
+      return HEDLEY_STATIC_CAST(uint32_t, simde_mm_cvtsi128_si32(t));
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_min_epu32
+  #define _mm512_reduce_min_epu32(a) simde_mm512_reduce_min_epu32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_mm512_mask_reduce_min_epu32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_mask_reduce_min_epu32(k, a);
+  #else
+    return simde_mm512_reduce_min_epu32(simde_mm512_mask_mov_epi32(simde_mm512_set1_epi32(~INT32_C(0)), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_min_epu32
+  #define _mm512_mask_reduce_min_epu32(k, a) simde_mm512_mask_reduce_min_epu32(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_reduce_min_epi64 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_reduce_min_epi64(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+
+    int64_t r = a_.i64[0];
+    for (size_t i = 1 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+      r = (r < a_.i64[i]) ? r : a_.i64[i];
+    }
+    return r;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_min_epi64
+  #define _mm512_reduce_min_epi64(a) simde_mm512_reduce_min_epi64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_mask_reduce_min_epi64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_mask_reduce_min_epi64(k, a);
+  #else
+    return simde_mm512_reduce_min_epi64(simde_mm512_mask_mov_epi64(simde_mm512_set1_epi64(INT64_MAX), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_min_epi64
+  #define _mm512_mask_reduce_min_epi64(k, a) simde_mm512_mask_reduce_min_epi64(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_mm512_reduce_min_epu64 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_reduce_min_epu64(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+
+    uint64_t r = a_.u64[0];
+    for (size_t i = 1 ; i < (sizeof(a_.u64) / sizeof(a_.u64[0])) ; i++) {
+      r = (r < a_.u64[i]) ? r : a_.u64[i];
+    }
+    return r;
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_min_epu64
+  #define _mm512_reduce_min_epu64(a) simde_mm512_reduce_min_epu64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_mm512_mask_reduce_min_epu64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_mask_reduce_min_epu64(k, a);
+  #else
+    return simde_mm512_reduce_min_epu64(simde_mm512_mask_mov_epi64(simde_mm512_set1_epi64(~INT64_C(0)), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_min_epu64
+  #define _mm512_mask_reduce_min_epu64(k, a) simde_mm512_mask_reduce_min_epu64(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_reduce_min_ps (simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_reduce_min_ps(a);
+  #else
+    simde__m512_private a_ = simde__m512_to_private(a);
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(SIMDE_FAST_NANS)
+      return vminvq_f32(vminq_f32(vminq_f32(a_.m128_private[0].neon_f32, a_.m128_private[2].neon_f32), vminq_f32(a_.m128_private[1].neon_f32, a_.m128_private[3].neon_f32)));
+    #else
+      simde__m256_private t256_ = simde__m256_to_private(simde_mm256_min_ps(a_.m256[0], a_.m256[1]));
+      simde__m128 t = simde_mm_min_ps(t256_.m128[0], t256_.m128[1]);
+      t = simde_mm_min_ps(t, simde_mm_shuffle_ps(t, t, SIMDE_MM_SHUFFLE(1, 0, 3, 2)));
+      t = simde_mm_min_ps(t, simde_mm_shuffle_ps(t, t, SIMDE_MM_SHUFFLE(2, 3, 0, 1)));
+      return simde_mm_cvtss_f32(t);
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_min_ps
+  #define _mm512_reduce_min_ps(a) simde_mm512_reduce_min_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_mm512_mask_reduce_min_ps (simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_mask_reduce_min_ps(k, a);
+  #else
+    return simde_mm512_reduce_min_ps(simde_mm512_mask_mov_ps(simde_mm512_set1_ps(SIMDE_MATH_INFINITYF), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_min_ps
+  #define _mm512_mask_reduce_min_ps(k, a) simde_mm512_mask_reduce_min_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_reduce_min_pd (simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_reduce_min_pd(a);
+  #else
+    simde__m512d_private a_ = simde__m512d_to_private(a);
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE) && defined(SIMDE_FAST_NANS)
+      return vminvq_f64(vminq_f64(vminq_f64(a_.m128d_private[0].neon_f64, a_.m128d_private[2].neon_f64), vminq_f64(a_.m128d_private[1].neon_f64, a_.m128d_private[3].neon_f64)));
+    #else
+      simde__m256d_private t256_ = simde__m256d_to_private(simde_mm256_min_pd(a_.m256d[0], a_.m256d[1]));
+      simde__m128d t = simde_mm_min_pd(t256_.m128d[0], t256_.m128d[1]);
+      t = simde_mm_min_pd(t, simde_mm_shuffle_pd(t, t, 1));
+      return simde_mm_cvtsd_f64(t);
+    #endif
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_min_pd
+  #define _mm512_reduce_min_pd(a) simde_mm512_reduce_min_pd(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float64
+simde_mm512_mask_reduce_min_pd (simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_mask_reduce_min_pd(k, a);
+  #else
+    return simde_mm512_reduce_min_pd(simde_mm512_mask_mov_pd(simde_mm512_set1_pd(SIMDE_MATH_INFINITY), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_min_pd
+  #define _mm512_mask_reduce_min_pd(k, a) simde_mm512_mask_reduce_min_pd(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_reduce_and_epi32 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_reduce_and_epi32(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+
+    simde__m256i_private t256_ = simde__m256i_to_private(simde_mm256_and_si256(a_.m256i[0], a_.m256i[1]));
+    simde__m128i t = simde_mm_and_si128(t256_.m128i[0], t256_.m128i[1]);
+    t = simde_mm_and_si128(t, simde_mm_shuffle_epi32(t, SIMDE_MM_SHUFFLE(1, 0, 3, 2)));
+    t = simde_mm_and_si128(t, simde_mm_shuffle_epi32(t, SIMDE_MM_SHUFFLE(2, 3, 0, 1)));
+    return simde_mm_cvtsi128_si32(t);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_and_epi32
+  #define _mm512_reduce_and_epi32(a) simde_mm512_reduce_and_epi32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_mask_reduce_and_epi32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_mask_reduce_and_epi32(k, a);
+  #else
+    return simde_mm512_reduce_and_epi32(simde_mm512_mask_mov_epi32(simde_mm512_set1_epi32(~INT32_C(0)), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_and_epi32
+  #define _mm512_mask_reduce_and_epi32(k, a) simde_mm512_mask_reduce_and_epi32(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_reduce_and_epi64 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_reduce_and_epi64(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+
+    simde__m256i_private t256_ = simde__m256i_to_private(simde_mm256_and_si256(a_.m256i[0], a_.m256i[1]));
+    simde__m128i t = simde_mm_and_si128(t256_.m128i[0], t256_.m128i[1]);
+    t = simde_mm_and_si128(t, simde_mm_shuffle_epi32(t, SIMDE_MM_SHUFFLE(1, 0, 3, 2)));
+    return simde_mm_cvtsi128_si64(t);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_and_epi64
+  #define _mm512_reduce_and_epi64(a) simde_mm512_reduce_and_epi64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_mask_reduce_and_epi64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_mask_reduce_and_epi64(k, a);
+  #else
+    return simde_mm512_reduce_and_epi64(simde_mm512_mask_mov_epi64(simde_mm512_set1_epi64(~INT64_C(0)), k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_and_epi64
+  #define _mm512_mask_reduce_and_epi64(k, a) simde_mm512_mask_reduce_and_epi64(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_reduce_or_epi32 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_reduce_or_epi32(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+
+    simde__m256i_private t256_ = simde__m256i_to_private(simde_mm256_or_si256(a_.m256i[0], a_.m256i[1]));
+    simde__m128i t = simde_mm_or_si128(t256_.m128i[0], t256_.m128i[1]);
+    t = simde_mm_or_si128(t, simde_mm_shuffle_epi32(t, SIMDE_MM_SHUFFLE(1, 0, 3, 2)));
+    t = simde_mm_or_si128(t, simde_mm_shuffle_epi32(t, SIMDE_MM_SHUFFLE(2, 3, 0, 1)));
+    return simde_mm_cvtsi128_si32(t);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_or_epi32
+  #define _mm512_reduce_or_epi32(a) simde_mm512_reduce_or_epi32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm512_mask_reduce_or_epi32 (simde__mmask16 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_mask_reduce_or_epi32(k, a);
+  #else
+    return simde_mm512_reduce_or_epi32(simde_mm512_maskz_mov_epi32(k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_or_epi32
+  #define _mm512_mask_reduce_or_epi32(k, a) simde_mm512_mask_reduce_or_epi32(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_reduce_or_epi64 (simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_reduce_or_epi64(a);
+  #else
+    simde__m512i_private a_ = simde__m512i_to_private(a);
+
+    simde__m256i_private t256_ = simde__m256i_to_private(simde_mm256_or_si256(a_.m256i[0], a_.m256i[1]));
+    simde__m128i t = simde_mm_or_si128(t256_.m128i[0], t256_.m128i[1]);
+    t = simde_mm_or_si128(t, simde_mm_shuffle_epi32(t, SIMDE_MM_SHUFFLE(1, 0, 3, 2)));
+    return simde_mm_cvtsi128_si64(t);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_reduce_or_epi64
+  #define _mm512_reduce_or_epi64(a) simde_mm512_reduce_or_epi64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm512_mask_reduce_or_epi64 (simde__mmask8 k, simde__m512i a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && (!defined(HEDLEY_GCC_VERSION) || HEDLEY_GCC_VERSION_CHECK(7,0,0))
+    return _mm512_mask_reduce_or_epi64(k, a);
+  #else
+    return simde_mm512_reduce_or_epi64(simde_mm512_maskz_mov_epi64(k, a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_reduce_or_epi64
+  #define _mm512_mask_reduce_or_epi64(k, a) simde_mm512_mask_reduce_or_epi64(k, a)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_REDUCE_H) */
@@ -0,0 +1,626 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#if !defined(SIMDE_X86_AVX512_RSQRT_H)
+#define SIMDE_X86_AVX512_RSQRT_H
+
+#include "types.h"
+#include "mov.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_rsqrt14_ps (simde__m128 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_rsqrt14_ps(a);
+  #else
+    simde__m128_private
+      r_,
+      a_ = simde__m128_to_private(a);
+
+    #if defined(SIMDE_ARM_NEON_A32V7_NATIVE)
+      /* Refine with vrsqrts(a, r * r) rather than vrsqrts(a * r, r) so
+       * that zero and infinite inputs keep their ±inf/±0 results. */
+      r_.neon_f32 = vrsqrteq_f32(a_.neon_f32);
+      r_.neon_f32 = vmulq_f32(r_.neon_f32, vrsqrtsq_f32(a_.neon_f32, vmulq_f32(r_.neon_f32, r_.neon_f32)));
+      #if SIMDE_ACCURACY_PREFERENCE > 1
+        r_.neon_f32 = vmulq_f32(r_.neon_f32, vrsqrtsq_f32(a_.neon_f32, vmulq_f32(r_.neon_f32, r_.neon_f32)));
+      #endif
+    #elif defined(SIMDE_X86_SSE_NATIVE) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+      /* rsqrtps is good to 12 bits, so one Newton-Raphson step covers the
+       * 2^-14 bound.  It treats denormal inputs as zero, so vectors with a
+       * lane that isn't a positive, finite normal take the exact path. */
+      const __m128 in_range =
+        _mm_and_ps(
+          _mm_cmpge_ps(a_.n, _mm_set1_ps(SIMDE_MATH_FLT_MIN)),
+          _mm_cmplt_ps(a_.n, _mm_set1_ps(SIMDE_MATH_INFINITYF)));
+      if (HEDLEY_LIKELY(_mm_movemask_ps(in_range) == 0xf)) {
+        const __m128 x = _mm_rsqrt_ps(a_.n);
+        const __m128 half_a = _mm_mul_ps(a_.n, _mm_set1_ps(SIMDE_FLOAT32_C(0.5)));
+        r_.n = _mm_mul_ps(x, _mm_sub_ps(_mm_set1_ps(SIMDE_FLOAT32_C(1.5)), _mm_mul_ps(half_a, _mm_mul_ps(x, x))));
+      } else {
+        r_.n = _mm_div_ps(_mm_set1_ps(SIMDE_FLOAT32_C(1.0)), _mm_sqrt_ps(a_.n));
+      }
+    #elif defined(simde_math_sqrtf)
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = SIMDE_FLOAT32_C(1.0) / simde_math_sqrtf(a_.f32[i]);
+      }
+    #else
+      HEDLEY_UNREACHABLE();
+    #endif
+
+    return simde__m128_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_rsqrt14_ps
+  #define _mm_rsqrt14_ps(a) simde_mm_rsqrt14_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_mask_rsqrt14_ps (simde__m128 src, simde__mmask8 k, simde__m128 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_rsqrt14_ps(src, k, a);
+  #else
+    return simde_mm_mask_mov_ps(src, k, simde_mm_rsqrt14_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_rsqrt14_ps
+  #define _mm_mask_rsqrt14_ps(src, k, a) simde_mm_mask_rsqrt14_ps(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_maskz_rsqrt14_ps (simde__mmask8 k, simde__m128 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_rsqrt14_ps(k, a);
+  #else
+    return simde_mm_maskz_mov_ps(k, simde_mm_rsqrt14_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_rsqrt14_ps
+  #define _mm_maskz_rsqrt14_ps(k, a) simde_mm_maskz_rsqrt14_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_rsqrt14_pd (simde__m128d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_rsqrt14_pd(a);
+  #else
+    simde__m128d_private
+      r_,
+      a_ = simde__m128d_to_private(a);
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      r_.neon_f64 = vrsqrteq_f64(a_.neon_f64);
+      r_.neon_f64 = vmulq_f64(r_.neon_f64, vrsqrtsq_f64(a_.neon_f64, vmulq_f64(r_.neon_f64, r_.neon_f64)));
+      #if SIMDE_ACCURACY_PREFERENCE > 1
+        r_.neon_f64 = vmulq_f64(r_.neon_f64, vrsqrtsq_f64(a_.neon_f64, vmulq_f64(r_.neon_f64, r_.neon_f64)));
+        r_.neon_f64 = vmulq_f64(r_.neon_f64, vrsqrtsq_f64(a_.neon_f64, vmulq_f64(r_.neon_f64, r_.neon_f64)));
+      #endif
+    #elif defined(simde_math_sqrt)
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = SIMDE_FLOAT64_C(1.0) / simde_math_sqrt(a_.f64[i]);
+      }
+    #else
+      HEDLEY_UNREACHABLE();
+    #endif
+
+    return simde__m128d_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_rsqrt14_pd
+  #define _mm_rsqrt14_pd(a) simde_mm_rsqrt14_pd(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_mask_rsqrt14_pd (simde__m128d src, simde__mmask8 k, simde__m128d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_rsqrt14_pd(src, k, a);
+  #else
+    return simde_mm_mask_mov_pd(src, k, simde_mm_rsqrt14_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_rsqrt14_pd
+  #define _mm_mask_rsqrt14_pd(src, k, a) simde_mm_mask_rsqrt14_pd(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_maskz_rsqrt14_pd (simde__mmask8 k, simde__m128d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_rsqrt14_pd(k, a);
+  #else
+    return simde_mm_maskz_mov_pd(k, simde_mm_rsqrt14_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_rsqrt14_pd
+  #define _mm_maskz_rsqrt14_pd(k, a) simde_mm_maskz_rsqrt14_pd(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_rsqrt14_ps (simde__m256 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_rsqrt14_ps(a);
+  #else
+    simde__m256_private
+      r_,
+      a_ = simde__m256_to_private(a);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+      for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+        r_.m128[i] = simde_mm_rsqrt14_ps(a_.m128[i]);
+      }
+    #elif defined(SIMDE_X86_AVX_NATIVE) && (SIMDE_ACCURACY_PREFERENCE <= 1)
+      const __m256 in_range =
+        _mm256_and_ps(
+          _mm256_cmp_ps(a_.n, _mm256_set1_ps(SIMDE_MATH_FLT_MIN), _CMP_GE_OQ),
+          _mm256_cmp_ps(a_.n, _mm256_set1_ps(SIMDE_MATH_INFINITYF), _CMP_LT_OQ));
+      if (HEDLEY_LIKELY(_mm256_movemask_ps(in_range) == 0xff)) {
+        const __m256 x = _mm256_rsqrt_ps(a_.n);
+        const __m256 half_a = _mm256_mul_ps(a_.n, _mm256_set1_ps(SIMDE_FLOAT32_C(0.5)));
+        r_.n = _mm256_mul_ps(x, _mm256_sub_ps(_mm256_set1_ps(SIMDE_FLOAT32_C(1.5)), _mm256_mul_ps(half_a, _mm256_mul_ps(x, x))));
+      } else {
+        r_.n = _mm256_div_ps(_mm256_set1_ps(SIMDE_FLOAT32_C(1.0)), _mm256_sqrt_ps(a_.n));
+      }
+    #elif defined(simde_math_sqrtf)
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = SIMDE_FLOAT32_C(1.0) / simde_math_sqrtf(a_.f32[i]);
+      }
+    #else
+      HEDLEY_UNREACHABLE();
+    #endif
+
+    return simde__m256_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_rsqrt14_ps
+  #define _mm256_rsqrt14_ps(a) simde_mm256_rsqrt14_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_mask_rsqrt14_ps (simde__m256 src, simde__mmask8 k, simde__m256 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_rsqrt14_ps(src, k, a);
+  #else
+    return simde_mm256_mask_mov_ps(src, k, simde_mm256_rsqrt14_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_rsqrt14_ps
+  #define _mm256_mask_rsqrt14_ps(src, k, a) simde_mm256_mask_rsqrt14_ps(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_maskz_rsqrt14_ps (simde__mmask8 k, simde__m256 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_rsqrt14_ps(k, a);
+  #else
+    return simde_mm256_maskz_mov_ps(k, simde_mm256_rsqrt14_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_rsqrt14_ps
+  #define _mm256_maskz_rsqrt14_ps(k, a) simde_mm256_maskz_rsqrt14_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_rsqrt14_pd (simde__m256d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_rsqrt14_pd(a);
+  #else
+    simde__m256d_private
+      r_,
+      a_ = simde__m256d_to_private(a);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+      for (size_t i = 0 ; i < (sizeof(r_.m128d) / sizeof(r_.m128d[0])) ; i++) {
+        r_.m128d[i] = simde_mm_rsqrt14_pd(a_.m128d[i]);
+      }
+    #elif defined(simde_math_sqrt)
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = SIMDE_FLOAT64_C(1.0) / simde_math_sqrt(a_.f64[i]);
+      }
+    #else
+      HEDLEY_UNREACHABLE();
+    #endif
+
+    return simde__m256d_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_rsqrt14_pd
+  #define _mm256_rsqrt14_pd(a) simde_mm256_rsqrt14_pd(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_mask_rsqrt14_pd (simde__m256d src, simde__mmask8 k, simde__m256d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_rsqrt14_pd(src, k, a);
+  #else
+    return simde_mm256_mask_mov_pd(src, k, simde_mm256_rsqrt14_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_rsqrt14_pd
+  #define _mm256_mask_rsqrt14_pd(src, k, a) simde_mm256_mask_rsqrt14_pd(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_mm256_maskz_rsqrt14_pd (simde__mmask8 k, simde__m256d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_rsqrt14_pd(k, a);
+  #else
+    return simde_mm256_maskz_mov_pd(k, simde_mm256_rsqrt14_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_rsqrt14_pd
+  #define _mm256_maskz_rsqrt14_pd(k, a) simde_mm256_maskz_rsqrt14_pd(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_rsqrt14_ps (simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_rsqrt14_ps(a);
+  #else
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+      for (size_t i = 0 ; i < (sizeof(r_.m128) / sizeof(r_.m128[0])) ; i++) {
+        r_.m128[i] = simde_mm_rsqrt14_ps(a_.m128[i]);
+      }
+    #elif SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+      for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
+        r_.m256[i] = simde_mm256_rsqrt14_ps(a_.m256[i]);
+      }
+    #elif defined(simde_math_sqrtf)
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = SIMDE_FLOAT32_C(1.0) / simde_math_sqrtf(a_.f32[i]);
+      }
+    #else
+      HEDLEY_UNREACHABLE();
+    #endif
+
+    return simde__m512_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_rsqrt14_ps
+  #define _mm512_rsqrt14_ps(a) simde_mm512_rsqrt14_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_rsqrt14_ps (simde__m512 src, simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_rsqrt14_ps(src, k, a);
+  #else
+    return simde_mm512_mask_mov_ps(src, k, simde_mm512_rsqrt14_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_rsqrt14_ps
+  #define _mm512_mask_rsqrt14_ps(src, k, a) simde_mm512_mask_rsqrt14_ps(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_rsqrt14_ps (simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_maskz_rsqrt14_ps(k, a);
+  #else
+    return simde_mm512_maskz_mov_ps(k, simde_mm512_rsqrt14_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_rsqrt14_ps
+  #define _mm512_maskz_rsqrt14_ps(k, a) simde_mm512_maskz_rsqrt14_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_rsqrt14_pd (simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_rsqrt14_pd(a);
+  #else
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+      for (size_t i = 0 ; i < (sizeof(r_.m128d) / sizeof(r_.m128d[0])) ; i++) {
+        r_.m128d[i] = simde_mm_rsqrt14_pd(a_.m128d[i]);
+      }
+    #elif defined(simde_math_sqrt)
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = SIMDE_FLOAT64_C(1.0) / simde_math_sqrt(a_.f64[i]);
+      }
+    #else
+      HEDLEY_UNREACHABLE();
+    #endif
+
+    return simde__m512d_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_rsqrt14_pd
+  #define _mm512_rsqrt14_pd(a) simde_mm512_rsqrt14_pd(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_rsqrt14_pd (simde__m512d src, simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_rsqrt14_pd(src, k, a);
+  #else
+    return simde_mm512_mask_mov_pd(src, k, simde_mm512_rsqrt14_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_rsqrt14_pd
+  #define _mm512_mask_rsqrt14_pd(src, k, a) simde_mm512_mask_rsqrt14_pd(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_rsqrt14_pd (simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_maskz_rsqrt14_pd(k, a);
+  #else
+    return simde_mm512_maskz_mov_pd(k, simde_mm512_rsqrt14_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_rsqrt14_pd
+  #define _mm512_maskz_rsqrt14_pd(k, a) simde_mm512_maskz_rsqrt14_pd(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_rsqrt14_ss (simde__m128 a, simde__m128 b) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm_rsqrt14_ss(a, b);
+  #else
+    return simde_mm_move_ss(a, simde_mm_rsqrt14_ps(b));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm_rsqrt14_ss
+  #define _mm_rsqrt14_ss(a, b) simde_mm_rsqrt14_ss(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_mask_rsqrt14_ss (simde__m128 src, simde__mmask8 k, simde__m128 a, simde__m128 b) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm_mask_rsqrt14_ss(src, k, a, b);
+  #else
+    return simde_mm_move_ss(a, simde_mm_mask_mov_ps(src, k, simde_mm_rsqrt14_ps(b)));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_rsqrt14_ss
+  #define _mm_mask_rsqrt14_ss(src, k, a, b) simde_mm_mask_rsqrt14_ss(src, k, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_maskz_rsqrt14_ss (simde__mmask8 k, simde__m128 a, simde__m128 b) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm_maskz_rsqrt14_ss(k, a, b);
+  #else
+    return simde_mm_move_ss(a, simde_mm_maskz_mov_ps(k, simde_mm_rsqrt14_ps(b)));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_rsqrt14_ss
+  #define _mm_maskz_rsqrt14_ss(k, a, b) simde_mm_maskz_rsqrt14_ss(k, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_rsqrt14_sd (simde__m128d a, simde__m128d b) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm_rsqrt14_sd(a, b);
+  #else
+    return simde_mm_move_sd(a, simde_mm_rsqrt14_pd(b));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm_rsqrt14_sd
+  #define _mm_rsqrt14_sd(a, b) simde_mm_rsqrt14_sd(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_mask_rsqrt14_sd (simde__m128d src, simde__mmask8 k, simde__m128d a, simde__m128d b) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm_mask_rsqrt14_sd(src, k, a, b);
+  #else
+    return simde_mm_move_sd(a, simde_mm_mask_mov_pd(src, k, simde_mm_rsqrt14_pd(b)));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_rsqrt14_sd
+  #define _mm_mask_rsqrt14_sd(src, k, a, b) simde_mm_mask_rsqrt14_sd(src, k, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_mm_maskz_rsqrt14_sd (simde__mmask8 k, simde__m128d a, simde__m128d b) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm_maskz_rsqrt14_sd(k, a, b);
+  #else
+    return simde_mm_move_sd(a, simde_mm_maskz_mov_pd(k, simde_mm_rsqrt14_pd(b)));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_rsqrt14_sd
+  #define _mm_maskz_rsqrt14_sd(k, a, b) simde_mm_maskz_rsqrt14_sd(k, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_rsqrt28_ps (simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512ER_NATIVE)
+    return _mm512_rsqrt28_ps(a);
+  #else
+    simde__m512_private
+      r_,
+      a_ = simde__m512_to_private(a);
+
+    #if defined(simde_math_sqrtf)
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        r_.f32[i] = SIMDE_FLOAT32_C(1.0) / simde_math_sqrtf(a_.f32[i]);
+      }
+    #else
+      HEDLEY_UNREACHABLE();
+    #endif
+
+    return simde__m512_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512ER_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_rsqrt28_ps
+  #define _mm512_rsqrt28_ps(a) simde_mm512_rsqrt28_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_rsqrt28_ps (simde__m512 src, simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512ER_NATIVE)
+    return _mm512_mask_rsqrt28_ps(src, k, a);
+  #else
+    return simde_mm512_mask_mov_ps(src, k, simde_mm512_rsqrt28_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512ER_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_rsqrt28_ps
+  #define _mm512_mask_rsqrt28_ps(src, k, a) simde_mm512_mask_rsqrt28_ps(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_rsqrt28_ps (simde__mmask16 k, simde__m512 a) {
+  #if defined(SIMDE_X86_AVX512ER_NATIVE)
+    return _mm512_maskz_rsqrt28_ps(k, a);
+  #else
+    return simde_mm512_maskz_mov_ps(k, simde_mm512_rsqrt28_ps(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512ER_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_rsqrt28_ps
+  #define _mm512_maskz_rsqrt28_ps(k, a) simde_mm512_maskz_rsqrt28_ps(k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_rsqrt28_pd (simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512ER_NATIVE)
+    return _mm512_rsqrt28_pd(a);
+  #else
+    simde__m512d_private
+      r_,
+      a_ = simde__m512d_to_private(a);
+
+    #if defined(simde_math_sqrt)
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        r_.f64[i] = SIMDE_FLOAT64_C(1.0) / simde_math_sqrt(a_.f64[i]);
+      }
+    #else
+      HEDLEY_UNREACHABLE();
+    #endif
+
+    return simde__m512d_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512ER_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_rsqrt28_pd
+  #define _mm512_rsqrt28_pd(a) simde_mm512_rsqrt28_pd(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_rsqrt28_pd (simde__m512d src, simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512ER_NATIVE)
+    return _mm512_mask_rsqrt28_pd(src, k, a);
+  #else
+    return simde_mm512_mask_mov_pd(src, k, simde_mm512_rsqrt28_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512ER_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_rsqrt28_pd
+  #define _mm512_mask_rsqrt28_pd(src, k, a) simde_mm512_mask_rsqrt28_pd(src, k, a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_rsqrt28_pd (simde__mmask8 k, simde__m512d a) {
+  #if defined(SIMDE_X86_AVX512ER_NATIVE)
+    return _mm512_maskz_rsqrt28_pd(k, a);
+  #else
+    return simde_mm512_maskz_mov_pd(k, simde_mm512_rsqrt28_pd(a));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512ER_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_rsqrt28_pd
+  #define _mm512_maskz_rsqrt28_pd(k, a) simde_mm512_maskz_rsqrt28_pd(k, a)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_RSQRT_H) */
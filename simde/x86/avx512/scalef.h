@@ -0,0 +1,244 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#if !defined(SIMDE_X86_AVX512_SCALEF_H)
+#define SIMDE_X86_AVX512_SCALEF_H
+
+#include "types.h"
+#include "mov.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_scalef_ps (simde__m512 a, simde__m512 b) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_scalef_ps(a, b);
+  #else
+    simde__m512_private
+      r_,
+      s_,
+      a_ = simde__m512_to_private(a),
+      b_ = simde__m512_to_private(b);
+
+    for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+      const uint32_t au = a_.u32[i] & UINT32_C(0x7fffffff);
+      const uint32_t bu = b_.u32[i] & UINT32_C(0x7fffffff);
+
+      s_.u32[i] = UINT32_C(0x3f800000);
+      if (au > UINT32_C(0x7f800000)) {
+        /* Scaling a quiet NaN by ±inf yields +inf/+0 rather than the NaN. */
+        if ((a_.u32[i] & UINT32_C(0x00400000)) && (bu == UINT32_C(0x7f800000)))
+          r_.u32[i] = (b_.u32[i] & UINT32_C(0x80000000)) ? 0 : UINT32_C(0x7f800000);
+        else
+          r_.u32[i] = a_.u32[i] | UINT32_C(0x00400000);
+      } else if (bu > UINT32_C(0x7f800000)) {
+        r_.u32[i] = b_.u32[i] | UINT32_C(0x00400000);
+      } else if (bu == UINT32_C(0x7f800000)) {
+        if (b_.u32[i] & UINT32_C(0x80000000))
+          r_.u32[i] = (au == UINT32_C(0x7f800000)) ? UINT32_C(0xffc00000) : (a_.u32[i] & UINT32_C(0x80000000));
+        else
+          r_.u32[i] = (au == 0) ? UINT32_C(0xffc00000) : ((a_.u32[i] & UINT32_C(0x80000000)) | UINT32_C(0x7f800000));
+      } else {
+        const simde_float32 fl = simde_math_floorf(b_.f32[i]);
+        int n = (fl > SIMDE_FLOAT32_C(1000.0)) ? 1000 : ((fl < SIMDE_FLOAT32_C(-1000.0)) ? -1000 : HEDLEY_STATIC_CAST(int, fl));
+        simde_float32 y = a_.f32[i];
+
+        /* Apply 2^n in up to three steps so that intermediate results
+         * neither overflow nor get rounded twice on the way to a
+         * denormal; the final factor is built directly from bits. */
+        if (n > 127) {
+          y *= SIMDE_FLOAT32_C(1.7014118346046923e+38);
+          n -= 127;
+          if (n > 127) {
+            y *= SIMDE_FLOAT32_C(1.7014118346046923e+38);
+            n -= 127;
+            if (n > 127)
+              n = 127;
+          }
+        } else if (n < -126) {
+          y *= SIMDE_FLOAT32_C(1.9721522630525295e-31);
+          n += 102;
+          if (n < -126) {
+            y *= SIMDE_FLOAT32_C(1.9721522630525295e-31);
+            n += 102;
+            if (n < -126)
+              n = -126;
+          }
+        }
+
+        r_.f32[i] = y;
+        s_.u32[i] = HEDLEY_STATIC_CAST(uint32_t, n + 127) << 23;
+      }
+    }
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+      r_.f32[i] *= s_.f32[i];
+    }
+
+    return simde__m512_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_scalef_ps
+  #define _mm512_scalef_ps(a, b) simde_mm512_scalef_ps(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_mask_scalef_ps (simde__m512 src, simde__mmask16 k, simde__m512 a, simde__m512 b) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_scalef_ps(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_ps(src, k, simde_mm512_scalef_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_scalef_ps
+  #define _mm512_mask_scalef_ps(src, k, a, b) simde_mm512_mask_scalef_ps(src, k, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512
+simde_mm512_maskz_scalef_ps (simde__mmask16 k, simde__m512 a, simde__m512 b) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_maskz_scalef_ps(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_ps(k, simde_mm512_scalef_ps(a, b));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_scalef_ps
+  #define _mm512_maskz_scalef_ps(k, a, b) simde_mm512_maskz_scalef_ps(k, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_scalef_pd (simde__m512d a, simde__m512d b) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_scalef_pd(a, b);
+  #else
+    simde__m512d_private
+      r_,
+      s_,
+      a_ = simde__m512d_to_private(a),
+      b_ = simde__m512d_to_private(b);
+
+    for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+      const uint64_t au = a_.u64[i] & UINT64_C(0x7fffffffffffffff);
+      const uint64_t bu = b_.u64[i] & UINT64_C(0x7fffffffffffffff);
+
+      s_.u64[i] = UINT64_C(0x3ff0000000000000);
+      if (au > UINT64_C(0x7ff0000000000000)) {
+        if ((a_.u64[i] & UINT64_C(0x0008000000000000)) && (bu == UINT64_C(0x7ff0000000000000)))
+          r_.u64[i] = (b_.u64[i] & UINT64_C(0x8000000000000000)) ? 0 : UINT64_C(0x7ff0000000000000);
+        else
+          r_.u64[i] = a_.u64[i] | UINT64_C(0x0008000000000000);
+      } else if (bu > UINT64_C(0x7ff0000000000000)) {
+        r_.u64[i] = b_.u64[i] | UINT64_C(0x0008000000000000);
+      } else if (bu == UINT64_C(0x7ff0000000000000)) {
+        if (b_.u64[i] & UINT64_C(0x8000000000000000))
+          r_.u64[i] = (au == UINT64_C(0x7ff0000000000000)) ? UINT64_C(0xfff8000000000000) : (a_.u64[i] & UINT64_C(0x8000000000000000));
+        else
+          r_.u64[i] = (au == 0) ? UINT64_C(0xfff8000000000000) : ((a_.u64[i] & UINT64_C(0x8000000000000000)) | UINT64_C(0x7ff0000000000000));
+      } else {
+        const simde_float64 fl = simde_math_floor(b_.f64[i]);
+        int n = (fl > SIMDE_FLOAT64_C(4000.0)) ? 4000 : ((fl < SIMDE_FLOAT64_C(-4000.0)) ? -4000 : HEDLEY_STATIC_CAST(int, fl));
+        simde_float64 y = a_.f64[i];
+
+        if (n > 1023) {
+          y *= SIMDE_FLOAT64_C(8.98846567431158e+307);
+          n -= 1023;
+          if (n > 1023) {
+            y *= SIMDE_FLOAT64_C(8.98846567431158e+307);
+            n -= 1023;
+            if (n > 1023)
+              n = 1023;
+          }
+        } else if (n < -1022) {
+          y *= SIMDE_FLOAT64_C(2.004168360008973e-292);
+          n += 969;
+          if (n < -1022) {
+            y *= SIMDE_FLOAT64_C(2.004168360008973e-292);
+            n += 969;
+            if (n < -1022)
+              n = -1022;
+          }
+        }
+
+        r_.f64[i] = y;
+        s_.u64[i] = HEDLEY_STATIC_CAST(uint64_t, n + 1023) << 52;
+      }
+    }
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+      r_.f64[i] *= s_.f64[i];
+    }
+
+    return simde__m512d_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_scalef_pd
+  #define _mm512_scalef_pd(a, b) simde_mm512_scalef_pd(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_mask_scalef_pd (simde__m512d src, simde__mmask8 k, simde__m512d a, simde__m512d b) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_mask_scalef_pd(src, k, a, b);
+  #else
+    return simde_mm512_mask_mov_pd(src, k, simde_mm512_scalef_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_scalef_pd
+  #define _mm512_mask_scalef_pd(src, k, a, b) simde_mm512_mask_scalef_pd(src, k, a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512d
+simde_mm512_maskz_scalef_pd (simde__mmask8 k, simde__m512d a, simde__m512d b) {
+  #if defined(SIMDE_X86_AVX512F_NATIVE)
+    return _mm512_maskz_scalef_pd(k, a, b);
+  #else
+    return simde_mm512_maskz_mov_pd(k, simde_mm512_scalef_pd(a, b));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_scalef_pd
+  #define _mm512_maskz_scalef_pd(k, a, b) simde_mm512_maskz_scalef_pd(k, a, b)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_SCALEF_H) */
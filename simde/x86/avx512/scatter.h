@@ -0,0 +1,1365 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#if !defined(SIMDE_X86_AVX512_SCATTER_H)
+#define SIMDE_X86_AVX512_SCATTER_H
+
+#include "types.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* Elements are stored in lane order, so when two lanes share an
+ * address the higher lane wins just like it does in hardware.  Masked
+ * off lanes are stored to a local instead of skipped to keep the loop
+ * free of data-dependent branches.  The destinations are all
+ * computed and prefetched for writing before the first store. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_i32scatter_epi32 (void* base_addr, simde__m128i vindex, simde__m128i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128i_private a_ = simde__m128i_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  uint8_t* dst[sizeof(a_.i32) / sizeof(a_.i32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
+    dst[i] = addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale));
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.i32[i]), sizeof(a_.i32[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_i32scatter_epi32(base_addr, vindex, a, scale) _mm_i32scatter_epi32(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_i32scatter_epi32
+  #define _mm_i32scatter_epi32(base_addr, vindex, a, scale) simde_mm_i32scatter_epi32(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_i32scatter_epi32 (void* base_addr, simde__mmask8 k, simde__m128i vindex, simde__m128i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128i_private a_ = simde__m128i_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  int32_t discard;
+  uint8_t* dst[sizeof(a_.i32) / sizeof(a_.i32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
+    dst[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(uint8_t*, &discard);
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.i32[i]), sizeof(a_.i32[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_i32scatter_epi32(base_addr, k, vindex, a, scale) _mm_mask_i32scatter_epi32(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_i32scatter_epi32
+  #define _mm_mask_i32scatter_epi32(base_addr, k, vindex, a, scale) simde_mm_mask_i32scatter_epi32(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_i32scatter_epi64 (void* base_addr, simde__m128i vindex, simde__m128i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128i_private a_ = simde__m128i_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  uint8_t* dst[sizeof(a_.i64) / sizeof(a_.i64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+    dst[i] = addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale));
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.i64[i]), sizeof(a_.i64[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_i32scatter_epi64(base_addr, vindex, a, scale) _mm_i32scatter_epi64(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_i32scatter_epi64
+  #define _mm_i32scatter_epi64(base_addr, vindex, a, scale) simde_mm_i32scatter_epi64(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_i32scatter_epi64 (void* base_addr, simde__mmask8 k, simde__m128i vindex, simde__m128i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128i_private a_ = simde__m128i_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  int64_t discard;
+  uint8_t* dst[sizeof(a_.i64) / sizeof(a_.i64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+    dst[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(uint8_t*, &discard);
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.i64[i]), sizeof(a_.i64[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_i32scatter_epi64(base_addr, k, vindex, a, scale) _mm_mask_i32scatter_epi64(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_i32scatter_epi64
+  #define _mm_mask_i32scatter_epi64(base_addr, k, vindex, a, scale) simde_mm_mask_i32scatter_epi64(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_i32scatter_pd (void* base_addr, simde__m128i vindex, simde__m128d a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128d_private a_ = simde__m128d_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  uint8_t* dst[sizeof(a_.f64) / sizeof(a_.f64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+    dst[i] = addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale));
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.f64[i]), sizeof(a_.f64[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_i32scatter_pd(base_addr, vindex, a, scale) _mm_i32scatter_pd(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_i32scatter_pd
+  #define _mm_i32scatter_pd(base_addr, vindex, a, scale) simde_mm_i32scatter_pd(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_i32scatter_pd (void* base_addr, simde__mmask8 k, simde__m128i vindex, simde__m128d a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128d_private a_ = simde__m128d_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde_float64 discard;
+  uint8_t* dst[sizeof(a_.f64) / sizeof(a_.f64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+    dst[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(uint8_t*, &discard);
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.f64[i]), sizeof(a_.f64[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_i32scatter_pd(base_addr, k, vindex, a, scale) _mm_mask_i32scatter_pd(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_i32scatter_pd
+  #define _mm_mask_i32scatter_pd(base_addr, k, vindex, a, scale) simde_mm_mask_i32scatter_pd(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_i32scatter_ps (void* base_addr, simde__m128i vindex, simde__m128 a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128_private a_ = simde__m128_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  uint8_t* dst[sizeof(a_.f32) / sizeof(a_.f32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
+    dst[i] = addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale));
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.f32[i]), sizeof(a_.f32[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_i32scatter_ps(base_addr, vindex, a, scale) _mm_i32scatter_ps(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_i32scatter_ps
+  #define _mm_i32scatter_ps(base_addr, vindex, a, scale) simde_mm_i32scatter_ps(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_i32scatter_ps (void* base_addr, simde__mmask8 k, simde__m128i vindex, simde__m128 a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128_private a_ = simde__m128_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde_float32 discard;
+  uint8_t* dst[sizeof(a_.f32) / sizeof(a_.f32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
+    dst[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(uint8_t*, &discard);
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.f32[i]), sizeof(a_.f32[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_i32scatter_ps(base_addr, k, vindex, a, scale) _mm_mask_i32scatter_ps(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_i32scatter_ps
+  #define _mm_mask_i32scatter_ps(base_addr, k, vindex, a, scale) simde_mm_mask_i32scatter_ps(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_i64scatter_epi32 (void* base_addr, simde__m128i vindex, simde__m128i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128i_private a_ = simde__m128i_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  uint8_t* dst[sizeof(vindex_.i64) / sizeof(vindex_.i64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(vindex_.i64) / sizeof(vindex_.i64[0])) ; i++) {
+    dst[i] = addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale));
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(vindex_.i64) / sizeof(vindex_.i64[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.i32[i]), sizeof(a_.i32[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_i64scatter_epi32(base_addr, vindex, a, scale) _mm_i64scatter_epi32(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_i64scatter_epi32
+  #define _mm_i64scatter_epi32(base_addr, vindex, a, scale) simde_mm_i64scatter_epi32(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_i64scatter_epi32 (void* base_addr, simde__mmask8 k, simde__m128i vindex, simde__m128i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128i_private a_ = simde__m128i_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  int32_t discard;
+  uint8_t* dst[sizeof(vindex_.i64) / sizeof(vindex_.i64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(vindex_.i64) / sizeof(vindex_.i64[0])) ; i++) {
+    dst[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(uint8_t*, &discard);
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(vindex_.i64) / sizeof(vindex_.i64[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.i32[i]), sizeof(a_.i32[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_i64scatter_epi32(base_addr, k, vindex, a, scale) _mm_mask_i64scatter_epi32(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_i64scatter_epi32
+  #define _mm_mask_i64scatter_epi32(base_addr, k, vindex, a, scale) simde_mm_mask_i64scatter_epi32(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_i64scatter_epi64 (void* base_addr, simde__m128i vindex, simde__m128i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128i_private a_ = simde__m128i_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  uint8_t* dst[sizeof(a_.i64) / sizeof(a_.i64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+    dst[i] = addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale));
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.i64[i]), sizeof(a_.i64[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_i64scatter_epi64(base_addr, vindex, a, scale) _mm_i64scatter_epi64(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_i64scatter_epi64
+  #define _mm_i64scatter_epi64(base_addr, vindex, a, scale) simde_mm_i64scatter_epi64(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_i64scatter_epi64 (void* base_addr, simde__mmask8 k, simde__m128i vindex, simde__m128i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128i_private a_ = simde__m128i_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  int64_t discard;
+  uint8_t* dst[sizeof(a_.i64) / sizeof(a_.i64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+    dst[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(uint8_t*, &discard);
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.i64[i]), sizeof(a_.i64[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_i64scatter_epi64(base_addr, k, vindex, a, scale) _mm_mask_i64scatter_epi64(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_i64scatter_epi64
+  #define _mm_mask_i64scatter_epi64(base_addr, k, vindex, a, scale) simde_mm_mask_i64scatter_epi64(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_i64scatter_pd (void* base_addr, simde__m128i vindex, simde__m128d a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128d_private a_ = simde__m128d_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  uint8_t* dst[sizeof(a_.f64) / sizeof(a_.f64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+    dst[i] = addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale));
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.f64[i]), sizeof(a_.f64[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_i64scatter_pd(base_addr, vindex, a, scale) _mm_i64scatter_pd(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_i64scatter_pd
+  #define _mm_i64scatter_pd(base_addr, vindex, a, scale) simde_mm_i64scatter_pd(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_i64scatter_pd (void* base_addr, simde__mmask8 k, simde__m128i vindex, simde__m128d a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128d_private a_ = simde__m128d_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde_float64 discard;
+  uint8_t* dst[sizeof(a_.f64) / sizeof(a_.f64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+    dst[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(uint8_t*, &discard);
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.f64[i]), sizeof(a_.f64[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_i64scatter_pd(base_addr, k, vindex, a, scale) _mm_mask_i64scatter_pd(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_i64scatter_pd
+  #define _mm_mask_i64scatter_pd(base_addr, k, vindex, a, scale) simde_mm_mask_i64scatter_pd(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_i64scatter_ps (void* base_addr, simde__m128i vindex, simde__m128 a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128_private a_ = simde__m128_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  uint8_t* dst[sizeof(vindex_.i64) / sizeof(vindex_.i64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(vindex_.i64) / sizeof(vindex_.i64[0])) ; i++) {
+    dst[i] = addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale));
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(vindex_.i64) / sizeof(vindex_.i64[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.f32[i]), sizeof(a_.f32[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_i64scatter_ps(base_addr, vindex, a, scale) _mm_i64scatter_ps(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_i64scatter_ps
+  #define _mm_i64scatter_ps(base_addr, vindex, a, scale) simde_mm_i64scatter_ps(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm_mask_i64scatter_ps (void* base_addr, simde__mmask8 k, simde__m128i vindex, simde__m128 a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m128_private a_ = simde__m128_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde_float32 discard;
+  uint8_t* dst[sizeof(vindex_.i64) / sizeof(vindex_.i64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(vindex_.i64) / sizeof(vindex_.i64[0])) ; i++) {
+    dst[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(uint8_t*, &discard);
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(vindex_.i64) / sizeof(vindex_.i64[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.f32[i]), sizeof(a_.f32[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_i64scatter_ps(base_addr, k, vindex, a, scale) _mm_mask_i64scatter_ps(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_i64scatter_ps
+  #define _mm_mask_i64scatter_ps(base_addr, k, vindex, a, scale) simde_mm_mask_i64scatter_ps(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_i32scatter_epi32 (void* base_addr, simde__m256i vindex, simde__m256i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m256i_private a_ = simde__m256i_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  uint8_t* dst[sizeof(a_.i32) / sizeof(a_.i32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
+    dst[i] = addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale));
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.i32[i]), sizeof(a_.i32[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_i32scatter_epi32(base_addr, vindex, a, scale) _mm256_i32scatter_epi32(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_i32scatter_epi32
+  #define _mm256_i32scatter_epi32(base_addr, vindex, a, scale) simde_mm256_i32scatter_epi32(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_i32scatter_epi32 (void* base_addr, simde__mmask8 k, simde__m256i vindex, simde__m256i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m256i_private a_ = simde__m256i_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  int32_t discard;
+  uint8_t* dst[sizeof(a_.i32) / sizeof(a_.i32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
+    dst[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(uint8_t*, &discard);
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.i32[i]), sizeof(a_.i32[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_i32scatter_epi32(base_addr, k, vindex, a, scale) _mm256_mask_i32scatter_epi32(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_i32scatter_epi32
+  #define _mm256_mask_i32scatter_epi32(base_addr, k, vindex, a, scale) simde_mm256_mask_i32scatter_epi32(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_i32scatter_epi64 (void* base_addr, simde__m128i vindex, simde__m256i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m256i_private a_ = simde__m256i_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  uint8_t* dst[sizeof(a_.i64) / sizeof(a_.i64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+    dst[i] = addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale));
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.i64[i]), sizeof(a_.i64[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_i32scatter_epi64(base_addr, vindex, a, scale) _mm256_i32scatter_epi64(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_i32scatter_epi64
+  #define _mm256_i32scatter_epi64(base_addr, vindex, a, scale) simde_mm256_i32scatter_epi64(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_i32scatter_epi64 (void* base_addr, simde__mmask8 k, simde__m128i vindex, simde__m256i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m256i_private a_ = simde__m256i_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  int64_t discard;
+  uint8_t* dst[sizeof(a_.i64) / sizeof(a_.i64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+    dst[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(uint8_t*, &discard);
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.i64[i]), sizeof(a_.i64[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_i32scatter_epi64(base_addr, k, vindex, a, scale) _mm256_mask_i32scatter_epi64(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_i32scatter_epi64
+  #define _mm256_mask_i32scatter_epi64(base_addr, k, vindex, a, scale) simde_mm256_mask_i32scatter_epi64(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_i32scatter_pd (void* base_addr, simde__m128i vindex, simde__m256d a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m256d_private a_ = simde__m256d_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  uint8_t* dst[sizeof(a_.f64) / sizeof(a_.f64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+    dst[i] = addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale));
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.f64[i]), sizeof(a_.f64[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_i32scatter_pd(base_addr, vindex, a, scale) _mm256_i32scatter_pd(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_i32scatter_pd
+  #define _mm256_i32scatter_pd(base_addr, vindex, a, scale) simde_mm256_i32scatter_pd(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_i32scatter_pd (void* base_addr, simde__mmask8 k, simde__m128i vindex, simde__m256d a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m128i_private vindex_ = simde__m128i_to_private(vindex);
+  simde__m256d_private a_ = simde__m256d_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde_float64 discard;
+  uint8_t* dst[sizeof(a_.f64) / sizeof(a_.f64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+    dst[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(uint8_t*, &discard);
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.f64[i]), sizeof(a_.f64[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_i32scatter_pd(base_addr, k, vindex, a, scale) _mm256_mask_i32scatter_pd(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_i32scatter_pd
+  #define _mm256_mask_i32scatter_pd(base_addr, k, vindex, a, scale) simde_mm256_mask_i32scatter_pd(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_i32scatter_ps (void* base_addr, simde__m256i vindex, simde__m256 a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m256_private a_ = simde__m256_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  uint8_t* dst[sizeof(a_.f32) / sizeof(a_.f32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
+    dst[i] = addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale));
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.f32[i]), sizeof(a_.f32[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_i32scatter_ps(base_addr, vindex, a, scale) _mm256_i32scatter_ps(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_i32scatter_ps
+  #define _mm256_i32scatter_ps(base_addr, vindex, a, scale) simde_mm256_i32scatter_ps(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_i32scatter_ps (void* base_addr, simde__mmask8 k, simde__m256i vindex, simde__m256 a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m256_private a_ = simde__m256_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde_float32 discard;
+  uint8_t* dst[sizeof(a_.f32) / sizeof(a_.f32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
+    dst[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(uint8_t*, &discard);
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.f32[i]), sizeof(a_.f32[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_i32scatter_ps(base_addr, k, vindex, a, scale) _mm256_mask_i32scatter_ps(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_i32scatter_ps
+  #define _mm256_mask_i32scatter_ps(base_addr, k, vindex, a, scale) simde_mm256_mask_i32scatter_ps(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_i64scatter_epi32 (void* base_addr, simde__m256i vindex, simde__m128i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m128i_private a_ = simde__m128i_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  uint8_t* dst[sizeof(a_.i32) / sizeof(a_.i32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
+    dst[i] = addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale));
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.i32[i]), sizeof(a_.i32[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_i64scatter_epi32(base_addr, vindex, a, scale) _mm256_i64scatter_epi32(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_i64scatter_epi32
+  #define _mm256_i64scatter_epi32(base_addr, vindex, a, scale) simde_mm256_i64scatter_epi32(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_i64scatter_epi32 (void* base_addr, simde__mmask8 k, simde__m256i vindex, simde__m128i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m128i_private a_ = simde__m128i_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  int32_t discard;
+  uint8_t* dst[sizeof(a_.i32) / sizeof(a_.i32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
+    dst[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(uint8_t*, &discard);
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.i32[i]), sizeof(a_.i32[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_i64scatter_epi32(base_addr, k, vindex, a, scale) _mm256_mask_i64scatter_epi32(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_i64scatter_epi32
+  #define _mm256_mask_i64scatter_epi32(base_addr, k, vindex, a, scale) simde_mm256_mask_i64scatter_epi32(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_i64scatter_epi64 (void* base_addr, simde__m256i vindex, simde__m256i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m256i_private a_ = simde__m256i_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  uint8_t* dst[sizeof(a_.i64) / sizeof(a_.i64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+    dst[i] = addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale));
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.i64[i]), sizeof(a_.i64[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_i64scatter_epi64(base_addr, vindex, a, scale) _mm256_i64scatter_epi64(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_i64scatter_epi64
+  #define _mm256_i64scatter_epi64(base_addr, vindex, a, scale) simde_mm256_i64scatter_epi64(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_i64scatter_epi64 (void* base_addr, simde__mmask8 k, simde__m256i vindex, simde__m256i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m256i_private a_ = simde__m256i_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  int64_t discard;
+  uint8_t* dst[sizeof(a_.i64) / sizeof(a_.i64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+    dst[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(uint8_t*, &discard);
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.i64[i]), sizeof(a_.i64[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_i64scatter_epi64(base_addr, k, vindex, a, scale) _mm256_mask_i64scatter_epi64(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_i64scatter_epi64
+  #define _mm256_mask_i64scatter_epi64(base_addr, k, vindex, a, scale) simde_mm256_mask_i64scatter_epi64(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_i64scatter_pd (void* base_addr, simde__m256i vindex, simde__m256d a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m256d_private a_ = simde__m256d_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  uint8_t* dst[sizeof(a_.f64) / sizeof(a_.f64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+    dst[i] = addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale));
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.f64[i]), sizeof(a_.f64[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_i64scatter_pd(base_addr, vindex, a, scale) _mm256_i64scatter_pd(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_i64scatter_pd
+  #define _mm256_i64scatter_pd(base_addr, vindex, a, scale) simde_mm256_i64scatter_pd(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_i64scatter_pd (void* base_addr, simde__mmask8 k, simde__m256i vindex, simde__m256d a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m256d_private a_ = simde__m256d_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde_float64 discard;
+  uint8_t* dst[sizeof(a_.f64) / sizeof(a_.f64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+    dst[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(uint8_t*, &discard);
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.f64[i]), sizeof(a_.f64[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_i64scatter_pd(base_addr, k, vindex, a, scale) _mm256_mask_i64scatter_pd(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_i64scatter_pd
+  #define _mm256_mask_i64scatter_pd(base_addr, k, vindex, a, scale) simde_mm256_mask_i64scatter_pd(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_i64scatter_ps (void* base_addr, simde__m256i vindex, simde__m128 a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m128_private a_ = simde__m128_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  uint8_t* dst[sizeof(a_.f32) / sizeof(a_.f32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
+    dst[i] = addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale));
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.f32[i]), sizeof(a_.f32[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_i64scatter_ps(base_addr, vindex, a, scale) _mm256_i64scatter_ps(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_i64scatter_ps
+  #define _mm256_i64scatter_ps(base_addr, vindex, a, scale) simde_mm256_i64scatter_ps(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm256_mask_i64scatter_ps (void* base_addr, simde__mmask8 k, simde__m256i vindex, simde__m128 a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m128_private a_ = simde__m128_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde_float32 discard;
+  uint8_t* dst[sizeof(a_.f32) / sizeof(a_.f32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
+    dst[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(uint8_t*, &discard);
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.f32[i]), sizeof(a_.f32[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_i64scatter_ps(base_addr, k, vindex, a, scale) _mm256_mask_i64scatter_ps(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_i64scatter_ps
+  #define _mm256_mask_i64scatter_ps(base_addr, k, vindex, a, scale) simde_mm256_mask_i64scatter_ps(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_i32scatter_epi32 (void* base_addr, simde__m512i vindex, simde__m512i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512i_private a_ = simde__m512i_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  uint8_t* dst[sizeof(a_.i32) / sizeof(a_.i32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
+    dst[i] = addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale));
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.i32[i]), sizeof(a_.i32[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i32scatter_epi32(base_addr, vindex, a, scale) _mm512_i32scatter_epi32(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i32scatter_epi32
+  #define _mm512_i32scatter_epi32(base_addr, vindex, a, scale) simde_mm512_i32scatter_epi32(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_i32scatter_epi32 (void* base_addr, simde__mmask16 k, simde__m512i vindex, simde__m512i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512i_private a_ = simde__m512i_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  int32_t discard;
+  uint8_t* dst[sizeof(a_.i32) / sizeof(a_.i32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
+    dst[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(uint8_t*, &discard);
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.i32[i]), sizeof(a_.i32[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i32scatter_epi32(base_addr, k, vindex, a, scale) _mm512_mask_i32scatter_epi32(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i32scatter_epi32
+  #define _mm512_mask_i32scatter_epi32(base_addr, k, vindex, a, scale) simde_mm512_mask_i32scatter_epi32(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_i32scatter_epi64 (void* base_addr, simde__m256i vindex, simde__m512i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m512i_private a_ = simde__m512i_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  uint8_t* dst[sizeof(a_.i64) / sizeof(a_.i64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+    dst[i] = addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale));
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.i64[i]), sizeof(a_.i64[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i32scatter_epi64(base_addr, vindex, a, scale) _mm512_i32scatter_epi64(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i32scatter_epi64
+  #define _mm512_i32scatter_epi64(base_addr, vindex, a, scale) simde_mm512_i32scatter_epi64(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_i32scatter_epi64 (void* base_addr, simde__mmask8 k, simde__m256i vindex, simde__m512i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m512i_private a_ = simde__m512i_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  int64_t discard;
+  uint8_t* dst[sizeof(a_.i64) / sizeof(a_.i64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+    dst[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(uint8_t*, &discard);
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.i64[i]), sizeof(a_.i64[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i32scatter_epi64(base_addr, k, vindex, a, scale) _mm512_mask_i32scatter_epi64(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i32scatter_epi64
+  #define _mm512_mask_i32scatter_epi64(base_addr, k, vindex, a, scale) simde_mm512_mask_i32scatter_epi64(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_i32scatter_pd (void* base_addr, simde__m256i vindex, simde__m512d a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m512d_private a_ = simde__m512d_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  uint8_t* dst[sizeof(a_.f64) / sizeof(a_.f64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+    dst[i] = addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale));
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.f64[i]), sizeof(a_.f64[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i32scatter_pd(base_addr, vindex, a, scale) _mm512_i32scatter_pd(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i32scatter_pd
+  #define _mm512_i32scatter_pd(base_addr, vindex, a, scale) simde_mm512_i32scatter_pd(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_i32scatter_pd (void* base_addr, simde__mmask8 k, simde__m256i vindex, simde__m512d a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m256i_private vindex_ = simde__m256i_to_private(vindex);
+  simde__m512d_private a_ = simde__m512d_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde_float64 discard;
+  uint8_t* dst[sizeof(a_.f64) / sizeof(a_.f64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+    dst[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(uint8_t*, &discard);
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.f64[i]), sizeof(a_.f64[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i32scatter_pd(base_addr, k, vindex, a, scale) _mm512_mask_i32scatter_pd(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i32scatter_pd
+  #define _mm512_mask_i32scatter_pd(base_addr, k, vindex, a, scale) simde_mm512_mask_i32scatter_pd(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_i32scatter_ps (void* base_addr, simde__m512i vindex, simde__m512 a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512_private a_ = simde__m512_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  uint8_t* dst[sizeof(a_.f32) / sizeof(a_.f32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
+    dst[i] = addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale));
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.f32[i]), sizeof(a_.f32[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i32scatter_ps(base_addr, vindex, a, scale) _mm512_i32scatter_ps(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i32scatter_ps
+  #define _mm512_i32scatter_ps(base_addr, vindex, a, scale) simde_mm512_i32scatter_ps(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_i32scatter_ps (void* base_addr, simde__mmask16 k, simde__m512i vindex, simde__m512 a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512_private a_ = simde__m512_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde_float32 discard;
+  uint8_t* dst[sizeof(a_.f32) / sizeof(a_.f32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
+    dst[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i32[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(uint8_t*, &discard);
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.f32[i]), sizeof(a_.f32[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i32scatter_ps(base_addr, k, vindex, a, scale) _mm512_mask_i32scatter_ps(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i32scatter_ps
+  #define _mm512_mask_i32scatter_ps(base_addr, k, vindex, a, scale) simde_mm512_mask_i32scatter_ps(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_i64scatter_epi32 (void* base_addr, simde__m512i vindex, simde__m256i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m256i_private a_ = simde__m256i_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  uint8_t* dst[sizeof(a_.i32) / sizeof(a_.i32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
+    dst[i] = addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale));
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.i32[i]), sizeof(a_.i32[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i64scatter_epi32(base_addr, vindex, a, scale) _mm512_i64scatter_epi32(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i64scatter_epi32
+  #define _mm512_i64scatter_epi32(base_addr, vindex, a, scale) simde_mm512_i64scatter_epi32(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_i64scatter_epi32 (void* base_addr, simde__mmask8 k, simde__m512i vindex, simde__m256i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m256i_private a_ = simde__m256i_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  int32_t discard;
+  uint8_t* dst[sizeof(a_.i32) / sizeof(a_.i32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
+    dst[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(uint8_t*, &discard);
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.i32) / sizeof(a_.i32[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.i32[i]), sizeof(a_.i32[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i64scatter_epi32(base_addr, k, vindex, a, scale) _mm512_mask_i64scatter_epi32(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i64scatter_epi32
+  #define _mm512_mask_i64scatter_epi32(base_addr, k, vindex, a, scale) simde_mm512_mask_i64scatter_epi32(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_i64scatter_epi64 (void* base_addr, simde__m512i vindex, simde__m512i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512i_private a_ = simde__m512i_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  uint8_t* dst[sizeof(a_.i64) / sizeof(a_.i64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+    dst[i] = addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale));
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.i64[i]), sizeof(a_.i64[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i64scatter_epi64(base_addr, vindex, a, scale) _mm512_i64scatter_epi64(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i64scatter_epi64
+  #define _mm512_i64scatter_epi64(base_addr, vindex, a, scale) simde_mm512_i64scatter_epi64(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_i64scatter_epi64 (void* base_addr, simde__mmask8 k, simde__m512i vindex, simde__m512i a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512i_private a_ = simde__m512i_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  int64_t discard;
+  uint8_t* dst[sizeof(a_.i64) / sizeof(a_.i64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+    dst[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(uint8_t*, &discard);
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.i64) / sizeof(a_.i64[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.i64[i]), sizeof(a_.i64[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i64scatter_epi64(base_addr, k, vindex, a, scale) _mm512_mask_i64scatter_epi64(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i64scatter_epi64
+  #define _mm512_mask_i64scatter_epi64(base_addr, k, vindex, a, scale) simde_mm512_mask_i64scatter_epi64(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_i64scatter_pd (void* base_addr, simde__m512i vindex, simde__m512d a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512d_private a_ = simde__m512d_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  uint8_t* dst[sizeof(a_.f64) / sizeof(a_.f64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+    dst[i] = addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale));
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.f64[i]), sizeof(a_.f64[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i64scatter_pd(base_addr, vindex, a, scale) _mm512_i64scatter_pd(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i64scatter_pd
+  #define _mm512_i64scatter_pd(base_addr, vindex, a, scale) simde_mm512_i64scatter_pd(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_i64scatter_pd (void* base_addr, simde__mmask8 k, simde__m512i vindex, simde__m512d a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m512d_private a_ = simde__m512d_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde_float64 discard;
+  uint8_t* dst[sizeof(a_.f64) / sizeof(a_.f64[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+    dst[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(uint8_t*, &discard);
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.f64) / sizeof(a_.f64[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.f64[i]), sizeof(a_.f64[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i64scatter_pd(base_addr, k, vindex, a, scale) _mm512_mask_i64scatter_pd(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i64scatter_pd
+  #define _mm512_mask_i64scatter_pd(base_addr, k, vindex, a, scale) simde_mm512_mask_i64scatter_pd(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_i64scatter_ps (void* base_addr, simde__m512i vindex, simde__m256 a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m256_private a_ = simde__m256_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  uint8_t* dst[sizeof(a_.f32) / sizeof(a_.f32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
+    dst[i] = addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale));
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.f32[i]), sizeof(a_.f32[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_i64scatter_ps(base_addr, vindex, a, scale) _mm512_i64scatter_ps(base_addr, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_i64scatter_ps
+  #define _mm512_i64scatter_ps(base_addr, vindex, a, scale) simde_mm512_i64scatter_ps(base_addr, vindex, a, scale)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+void
+simde_mm512_mask_i64scatter_ps (void* base_addr, simde__mmask8 k, simde__m512i vindex, simde__m256 a, const int32_t scale)
+    SIMDE_REQUIRE_CONSTANT(scale)
+    HEDLEY_REQUIRE_MSG((scale && scale <= 8 && !(scale & (scale - 1))), "`scale' must be a power of two less than or equal to 8") {
+  simde__m512i_private vindex_ = simde__m512i_to_private(vindex);
+  simde__m256_private a_ = simde__m256_to_private(a);
+  uint8_t* addr = HEDLEY_REINTERPRET_CAST(uint8_t*, base_addr);
+  simde_float32 discard;
+  uint8_t* dst[sizeof(a_.f32) / sizeof(a_.f32[0])];
+
+  for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
+    dst[i] = ((k >> i) & 1) ? (addr + (HEDLEY_STATIC_CAST(size_t , vindex_.i64[i]) * HEDLEY_STATIC_CAST(size_t , scale))) : HEDLEY_REINTERPRET_CAST(uint8_t*, &discard);
+    simde_prefetch(dst[i], 1);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(a_.f32) / sizeof(a_.f32[0])) ; i++) {
+    simde_memcpy(dst[i], &(a_.f32[i]), sizeof(a_.f32[i]));
+  }
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_i64scatter_ps(base_addr, k, vindex, a, scale) _mm512_mask_i64scatter_ps(base_addr, k, vindex, a, scale)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_i64scatter_ps
+  #define _mm512_mask_i64scatter_ps(base_addr, k, vindex, a, scale) simde_mm512_mask_i64scatter_ps(base_addr, k, vindex, a, scale)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_SCATTER_H) */
@@ -0,0 +1,348 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#if !defined(SIMDE_X86_AVX512_SHRDI_H)
+#define SIMDE_X86_AVX512_SHRDI_H
+
+#include "types.h"
+#include "mov.h"
+#include "set1.h"
+#include "shrdv.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_shrdi_epi16 (simde__m128i a, simde__m128i b, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_mm_shrdv_epi16(a, b, simde_mm_set1_epi16(HEDLEY_STATIC_CAST(int16_t, imm8)));
+}
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_shrdi_epi16(a, b, imm8) _mm_shrdi_epi16(a, b, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_shrdi_epi16
+  #define _mm_shrdi_epi16(a, b, imm8) simde_mm_shrdi_epi16(a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_shrdi_epi16(src, k, a, b, imm8) _mm_mask_shrdi_epi16(src, k, a, b, imm8)
+#else
+  #define simde_mm_mask_shrdi_epi16(src, k, a, b, imm8) simde_mm_mask_mov_epi16(src, k, simde_mm_shrdi_epi16(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_shrdi_epi16
+  #define _mm_mask_shrdi_epi16(src, k, a, b, imm8) simde_mm_mask_shrdi_epi16(src, k, a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_maskz_shrdi_epi16(k, a, b, imm8) _mm_maskz_shrdi_epi16(k, a, b, imm8)
+#else
+  #define simde_mm_maskz_shrdi_epi16(k, a, b, imm8) simde_mm_maskz_mov_epi16(k, simde_mm_shrdi_epi16(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_shrdi_epi16
+  #define _mm_maskz_shrdi_epi16(k, a, b, imm8) simde_mm_maskz_shrdi_epi16(k, a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_shrdi_epi32 (simde__m128i a, simde__m128i b, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_mm_shrdv_epi32(a, b, simde_mm_set1_epi32(imm8));
+}
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_shrdi_epi32(a, b, imm8) _mm_shrdi_epi32(a, b, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_shrdi_epi32
+  #define _mm_shrdi_epi32(a, b, imm8) simde_mm_shrdi_epi32(a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_shrdi_epi32(src, k, a, b, imm8) _mm_mask_shrdi_epi32(src, k, a, b, imm8)
+#else
+  #define simde_mm_mask_shrdi_epi32(src, k, a, b, imm8) simde_mm_mask_mov_epi32(src, k, simde_mm_shrdi_epi32(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_shrdi_epi32
+  #define _mm_mask_shrdi_epi32(src, k, a, b, imm8) simde_mm_mask_shrdi_epi32(src, k, a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_maskz_shrdi_epi32(k, a, b, imm8) _mm_maskz_shrdi_epi32(k, a, b, imm8)
+#else
+  #define simde_mm_maskz_shrdi_epi32(k, a, b, imm8) simde_mm_maskz_mov_epi32(k, simde_mm_shrdi_epi32(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_shrdi_epi32
+  #define _mm_maskz_shrdi_epi32(k, a, b, imm8) simde_mm_maskz_shrdi_epi32(k, a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_shrdi_epi64 (simde__m128i a, simde__m128i b, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_mm_shrdv_epi64(a, b, simde_mm_set1_epi64x(HEDLEY_STATIC_CAST(int64_t, imm8)));
+}
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_shrdi_epi64(a, b, imm8) _mm_shrdi_epi64(a, b, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_shrdi_epi64
+  #define _mm_shrdi_epi64(a, b, imm8) simde_mm_shrdi_epi64(a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_shrdi_epi64(src, k, a, b, imm8) _mm_mask_shrdi_epi64(src, k, a, b, imm8)
+#else
+  #define simde_mm_mask_shrdi_epi64(src, k, a, b, imm8) simde_mm_mask_mov_epi64(src, k, simde_mm_shrdi_epi64(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_shrdi_epi64
+  #define _mm_mask_shrdi_epi64(src, k, a, b, imm8) simde_mm_mask_shrdi_epi64(src, k, a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_maskz_shrdi_epi64(k, a, b, imm8) _mm_maskz_shrdi_epi64(k, a, b, imm8)
+#else
+  #define simde_mm_maskz_shrdi_epi64(k, a, b, imm8) simde_mm_maskz_mov_epi64(k, simde_mm_shrdi_epi64(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_shrdi_epi64
+  #define _mm_maskz_shrdi_epi64(k, a, b, imm8) simde_mm_maskz_shrdi_epi64(k, a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_shrdi_epi16 (simde__m256i a, simde__m256i b, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_mm256_shrdv_epi16(a, b, simde_mm256_set1_epi16(HEDLEY_STATIC_CAST(int16_t, imm8)));
+}
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_shrdi_epi16(a, b, imm8) _mm256_shrdi_epi16(a, b, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_shrdi_epi16
+  #define _mm256_shrdi_epi16(a, b, imm8) simde_mm256_shrdi_epi16(a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_shrdi_epi16(src, k, a, b, imm8) _mm256_mask_shrdi_epi16(src, k, a, b, imm8)
+#else
+  #define simde_mm256_mask_shrdi_epi16(src, k, a, b, imm8) simde_mm256_mask_mov_epi16(src, k, simde_mm256_shrdi_epi16(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_shrdi_epi16
+  #define _mm256_mask_shrdi_epi16(src, k, a, b, imm8) simde_mm256_mask_shrdi_epi16(src, k, a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_maskz_shrdi_epi16(k, a, b, imm8) _mm256_maskz_shrdi_epi16(k, a, b, imm8)
+#else
+  #define simde_mm256_maskz_shrdi_epi16(k, a, b, imm8) simde_mm256_maskz_mov_epi16(k, simde_mm256_shrdi_epi16(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_shrdi_epi16
+  #define _mm256_maskz_shrdi_epi16(k, a, b, imm8) simde_mm256_maskz_shrdi_epi16(k, a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_shrdi_epi32 (simde__m256i a, simde__m256i b, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_mm256_shrdv_epi32(a, b, simde_mm256_set1_epi32(imm8));
+}
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_shrdi_epi32(a, b, imm8) _mm256_shrdi_epi32(a, b, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_shrdi_epi32
+  #define _mm256_shrdi_epi32(a, b, imm8) simde_mm256_shrdi_epi32(a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_shrdi_epi32(src, k, a, b, imm8) _mm256_mask_shrdi_epi32(src, k, a, b, imm8)
+#else
+  #define simde_mm256_mask_shrdi_epi32(src, k, a, b, imm8) simde_mm256_mask_mov_epi32(src, k, simde_mm256_shrdi_epi32(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_shrdi_epi32
+  #define _mm256_mask_shrdi_epi32(src, k, a, b, imm8) simde_mm256_mask_shrdi_epi32(src, k, a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_maskz_shrdi_epi32(k, a, b, imm8) _mm256_maskz_shrdi_epi32(k, a, b, imm8)
+#else
+  #define simde_mm256_maskz_shrdi_epi32(k, a, b, imm8) simde_mm256_maskz_mov_epi32(k, simde_mm256_shrdi_epi32(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_shrdi_epi32
+  #define _mm256_maskz_shrdi_epi32(k, a, b, imm8) simde_mm256_maskz_shrdi_epi32(k, a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_shrdi_epi64 (simde__m256i a, simde__m256i b, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_mm256_shrdv_epi64(a, b, simde_mm256_set1_epi64x(HEDLEY_STATIC_CAST(int64_t, imm8)));
+}
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_shrdi_epi64(a, b, imm8) _mm256_shrdi_epi64(a, b, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_shrdi_epi64
+  #define _mm256_shrdi_epi64(a, b, imm8) simde_mm256_shrdi_epi64(a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_shrdi_epi64(src, k, a, b, imm8) _mm256_mask_shrdi_epi64(src, k, a, b, imm8)
+#else
+  #define simde_mm256_mask_shrdi_epi64(src, k, a, b, imm8) simde_mm256_mask_mov_epi64(src, k, simde_mm256_shrdi_epi64(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_shrdi_epi64
+  #define _mm256_mask_shrdi_epi64(src, k, a, b, imm8) simde_mm256_mask_shrdi_epi64(src, k, a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_maskz_shrdi_epi64(k, a, b, imm8) _mm256_maskz_shrdi_epi64(k, a, b, imm8)
+#else
+  #define simde_mm256_maskz_shrdi_epi64(k, a, b, imm8) simde_mm256_maskz_mov_epi64(k, simde_mm256_shrdi_epi64(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_shrdi_epi64
+  #define _mm256_maskz_shrdi_epi64(k, a, b, imm8) simde_mm256_maskz_shrdi_epi64(k, a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_shrdi_epi16 (simde__m512i a, simde__m512i b, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_mm512_shrdv_epi16(a, b, simde_mm512_set1_epi16(HEDLEY_STATIC_CAST(int16_t, imm8)));
+}
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+  #define simde_mm512_shrdi_epi16(a, b, imm8) _mm512_shrdi_epi16(a, b, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_shrdi_epi16
+  #define _mm512_shrdi_epi16(a, b, imm8) simde_mm512_shrdi_epi16(a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+  #define simde_mm512_mask_shrdi_epi16(src, k, a, b, imm8) _mm512_mask_shrdi_epi16(src, k, a, b, imm8)
+#else
+  #define simde_mm512_mask_shrdi_epi16(src, k, a, b, imm8) simde_mm512_mask_mov_epi16(src, k, simde_mm512_shrdi_epi16(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_shrdi_epi16
+  #define _mm512_mask_shrdi_epi16(src, k, a, b, imm8) simde_mm512_mask_shrdi_epi16(src, k, a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+  #define simde_mm512_maskz_shrdi_epi16(k, a, b, imm8) _mm512_maskz_shrdi_epi16(k, a, b, imm8)
+#else
+  #define simde_mm512_maskz_shrdi_epi16(k, a, b, imm8) simde_mm512_maskz_mov_epi16(k, simde_mm512_shrdi_epi16(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_shrdi_epi16
+  #define _mm512_maskz_shrdi_epi16(k, a, b, imm8) simde_mm512_maskz_shrdi_epi16(k, a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_shrdi_epi32 (simde__m512i a, simde__m512i b, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_mm512_shrdv_epi32(a, b, simde_mm512_set1_epi32(imm8));
+}
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+  #define simde_mm512_shrdi_epi32(a, b, imm8) _mm512_shrdi_epi32(a, b, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_shrdi_epi32
+  #define _mm512_shrdi_epi32(a, b, imm8) simde_mm512_shrdi_epi32(a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+  #define simde_mm512_mask_shrdi_epi32(src, k, a, b, imm8) _mm512_mask_shrdi_epi32(src, k, a, b, imm8)
+#else
+  #define simde_mm512_mask_shrdi_epi32(src, k, a, b, imm8) simde_mm512_mask_mov_epi32(src, k, simde_mm512_shrdi_epi32(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_shrdi_epi32
+  #define _mm512_mask_shrdi_epi32(src, k, a, b, imm8) simde_mm512_mask_shrdi_epi32(src, k, a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+  #define simde_mm512_maskz_shrdi_epi32(k, a, b, imm8) _mm512_maskz_shrdi_epi32(k, a, b, imm8)
+#else
+  #define simde_mm512_maskz_shrdi_epi32(k, a, b, imm8) simde_mm512_maskz_mov_epi32(k, simde_mm512_shrdi_epi32(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_shrdi_epi32
+  #define _mm512_maskz_shrdi_epi32(k, a, b, imm8) simde_mm512_maskz_shrdi_epi32(k, a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_shrdi_epi64 (simde__m512i a, simde__m512i b, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_mm512_shrdv_epi64(a, b, simde_mm512_set1_epi64(HEDLEY_STATIC_CAST(int64_t, imm8)));
+}
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+  #define simde_mm512_shrdi_epi64(a, b, imm8) _mm512_shrdi_epi64(a, b, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_shrdi_epi64
+  #define _mm512_shrdi_epi64(a, b, imm8) simde_mm512_shrdi_epi64(a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+  #define simde_mm512_mask_shrdi_epi64(src, k, a, b, imm8) _mm512_mask_shrdi_epi64(src, k, a, b, imm8)
+#else
+  #define simde_mm512_mask_shrdi_epi64(src, k, a, b, imm8) simde_mm512_mask_mov_epi64(src, k, simde_mm512_shrdi_epi64(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_shrdi_epi64
+  #define _mm512_mask_shrdi_epi64(src, k, a, b, imm8) simde_mm512_mask_shrdi_epi64(src, k, a, b, imm8)
+#endif
+
+#if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+  #define simde_mm512_maskz_shrdi_epi64(k, a, b, imm8) _mm512_maskz_shrdi_epi64(k, a, b, imm8)
+#else
+  #define simde_mm512_maskz_shrdi_epi64(k, a, b, imm8) simde_mm512_maskz_mov_epi64(k, simde_mm512_shrdi_epi64(a, b, imm8))
+#endif
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_shrdi_epi64
+  #define _mm512_maskz_shrdi_epi64(k, a, b, imm8) simde_mm512_maskz_shrdi_epi64(k, a, b, imm8)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_SHRDI_H) */
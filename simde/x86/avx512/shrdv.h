@@ -0,0 +1,578 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#if !defined(SIMDE_X86_AVX512_SHRDV_H)
+#define SIMDE_X86_AVX512_SHRDV_H
+
+#include "types.h"
+#include "mov.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_shrdv_epi16 (simde__m128i a, simde__m128i b, simde__m128i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_shrdv_epi16(a, b, c);
+  #else
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      b_ = simde__m128i_to_private(b),
+      c_ = simde__m128i_to_private(c);
+
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u16) / sizeof(r_.u16[0])) ; i++) {
+      const uint32_t t = (HEDLEY_STATIC_CAST(uint32_t, b_.u16[i]) << 16) | a_.u16[i];
+      r_.u16[i] = HEDLEY_STATIC_CAST(uint16_t, t >> (c_.u16[i] & 15));
+    }
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_shrdv_epi16
+  #define _mm_shrdv_epi16(a, b, c) simde_mm_shrdv_epi16(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_shrdv_epi16 (simde__m128i a, simde__mmask8 k, simde__m128i b, simde__m128i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_shrdv_epi16(a, k, b, c);
+  #else
+    return simde_mm_mask_mov_epi16(a, k, simde_mm_shrdv_epi16(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_shrdv_epi16
+  #define _mm_mask_shrdv_epi16(a, k, b, c) simde_mm_mask_shrdv_epi16(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_shrdv_epi16 (simde__mmask8 k, simde__m128i a, simde__m128i b, simde__m128i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_shrdv_epi16(k, a, b, c);
+  #else
+    return simde_mm_maskz_mov_epi16(k, simde_mm_shrdv_epi16(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_shrdv_epi16
+  #define _mm_maskz_shrdv_epi16(k, a, b, c) simde_mm_maskz_shrdv_epi16(k, a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_shrdv_epi32 (simde__m128i a, simde__m128i b, simde__m128i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_shrdv_epi32(a, b, c);
+  #else
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      b_ = simde__m128i_to_private(b),
+      c_ = simde__m128i_to_private(c);
+
+    #if defined(SIMDE_X86_AVX2_NATIVE)
+      const __m128i n = _mm_and_si128(c_.n, _mm_set1_epi32(31));
+      r_.n = _mm_or_si128(_mm_srlv_epi32(a_.n, n), _mm_sllv_epi32(_mm_slli_epi32(b_.n, 1), _mm_xor_si128(n, _mm_set1_epi32(31))));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+        const uint64_t t = (HEDLEY_STATIC_CAST(uint64_t, b_.u32[i]) << 32) | a_.u32[i];
+        r_.u32[i] = HEDLEY_STATIC_CAST(uint32_t, t >> (c_.u32[i] & 31));
+      }
+    #endif
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_shrdv_epi32
+  #define _mm_shrdv_epi32(a, b, c) simde_mm_shrdv_epi32(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_shrdv_epi32 (simde__m128i a, simde__mmask8 k, simde__m128i b, simde__m128i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_shrdv_epi32(a, k, b, c);
+  #else
+    return simde_mm_mask_mov_epi32(a, k, simde_mm_shrdv_epi32(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_shrdv_epi32
+  #define _mm_mask_shrdv_epi32(a, k, b, c) simde_mm_mask_shrdv_epi32(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_shrdv_epi32 (simde__mmask8 k, simde__m128i a, simde__m128i b, simde__m128i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_shrdv_epi32(k, a, b, c);
+  #else
+    return simde_mm_maskz_mov_epi32(k, simde_mm_shrdv_epi32(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_shrdv_epi32
+  #define _mm_maskz_shrdv_epi32(k, a, b, c) simde_mm_maskz_shrdv_epi32(k, a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_shrdv_epi64 (simde__m128i a, simde__m128i b, simde__m128i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_shrdv_epi64(a, b, c);
+  #else
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      b_ = simde__m128i_to_private(b),
+      c_ = simde__m128i_to_private(c);
+
+    #if defined(SIMDE_X86_AVX2_NATIVE)
+      const __m128i n = _mm_and_si128(c_.n, _mm_set1_epi64x(63));
+      r_.n = _mm_or_si128(_mm_srlv_epi64(a_.n, n), _mm_sllv_epi64(_mm_slli_epi64(b_.n, 1), _mm_xor_si128(n, _mm_set1_epi64x(63))));
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+        const unsigned int n = HEDLEY_STATIC_CAST(unsigned int, c_.u64[i] & 63);
+        r_.u64[i] = (a_.u64[i] >> n) | ((b_.u64[i] << 1) << (63 - n));
+      }
+    #endif
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_shrdv_epi64
+  #define _mm_shrdv_epi64(a, b, c) simde_mm_shrdv_epi64(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_shrdv_epi64 (simde__m128i a, simde__mmask8 k, simde__m128i b, simde__m128i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_mask_shrdv_epi64(a, k, b, c);
+  #else
+    return simde_mm_mask_mov_epi64(a, k, simde_mm_shrdv_epi64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_shrdv_epi64
+  #define _mm_mask_shrdv_epi64(a, k, b, c) simde_mm_mask_shrdv_epi64(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_shrdv_epi64 (simde__mmask8 k, simde__m128i a, simde__m128i b, simde__m128i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm_maskz_shrdv_epi64(k, a, b, c);
+  #else
+    return simde_mm_maskz_mov_epi64(k, simde_mm_shrdv_epi64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_shrdv_epi64
+  #define _mm_maskz_shrdv_epi64(k, a, b, c) simde_mm_maskz_shrdv_epi64(k, a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_shrdv_epi16 (simde__m256i a, simde__m256i b, simde__m256i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_shrdv_epi16(a, b, c);
+  #else
+    simde__m256i_private
+      r_,
+      a_ = simde__m256i_to_private(a),
+      b_ = simde__m256i_to_private(b),
+      c_ = simde__m256i_to_private(c);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+      for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+        r_.m128i[i] = simde_mm_shrdv_epi16(a_.m128i[i], b_.m128i[i], c_.m128i[i]);
+      }
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u16) / sizeof(r_.u16[0])) ; i++) {
+        const uint32_t t = (HEDLEY_STATIC_CAST(uint32_t, b_.u16[i]) << 16) | a_.u16[i];
+        r_.u16[i] = HEDLEY_STATIC_CAST(uint16_t, t >> (c_.u16[i] & 15));
+      }
+    #endif
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_shrdv_epi16
+  #define _mm256_shrdv_epi16(a, b, c) simde_mm256_shrdv_epi16(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_shrdv_epi16 (simde__m256i a, simde__mmask16 k, simde__m256i b, simde__m256i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_shrdv_epi16(a, k, b, c);
+  #else
+    return simde_mm256_mask_mov_epi16(a, k, simde_mm256_shrdv_epi16(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_shrdv_epi16
+  #define _mm256_mask_shrdv_epi16(a, k, b, c) simde_mm256_mask_shrdv_epi16(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_shrdv_epi16 (simde__mmask16 k, simde__m256i a, simde__m256i b, simde__m256i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_shrdv_epi16(k, a, b, c);
+  #else
+    return simde_mm256_maskz_mov_epi16(k, simde_mm256_shrdv_epi16(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_shrdv_epi16
+  #define _mm256_maskz_shrdv_epi16(k, a, b, c) simde_mm256_maskz_shrdv_epi16(k, a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_shrdv_epi32 (simde__m256i a, simde__m256i b, simde__m256i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_shrdv_epi32(a, b, c);
+  #else
+    simde__m256i_private
+      r_,
+      a_ = simde__m256i_to_private(a),
+      b_ = simde__m256i_to_private(b),
+      c_ = simde__m256i_to_private(c);
+
+    #if defined(SIMDE_X86_AVX2_NATIVE)
+      const __m256i n = _mm256_and_si256(c_.n, _mm256_set1_epi32(31));
+      r_.n = _mm256_or_si256(_mm256_srlv_epi32(a_.n, n), _mm256_sllv_epi32(_mm256_slli_epi32(b_.n, 1), _mm256_xor_si256(n, _mm256_set1_epi32(31))));
+    #elif SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+      for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+        r_.m128i[i] = simde_mm_shrdv_epi32(a_.m128i[i], b_.m128i[i], c_.m128i[i]);
+      }
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+        const uint64_t t = (HEDLEY_STATIC_CAST(uint64_t, b_.u32[i]) << 32) | a_.u32[i];
+        r_.u32[i] = HEDLEY_STATIC_CAST(uint32_t, t >> (c_.u32[i] & 31));
+      }
+    #endif
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_shrdv_epi32
+  #define _mm256_shrdv_epi32(a, b, c) simde_mm256_shrdv_epi32(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_shrdv_epi32 (simde__m256i a, simde__mmask8 k, simde__m256i b, simde__m256i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_shrdv_epi32(a, k, b, c);
+  #else
+    return simde_mm256_mask_mov_epi32(a, k, simde_mm256_shrdv_epi32(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_shrdv_epi32
+  #define _mm256_mask_shrdv_epi32(a, k, b, c) simde_mm256_mask_shrdv_epi32(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_shrdv_epi32 (simde__mmask8 k, simde__m256i a, simde__m256i b, simde__m256i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_shrdv_epi32(k, a, b, c);
+  #else
+    return simde_mm256_maskz_mov_epi32(k, simde_mm256_shrdv_epi32(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_shrdv_epi32
+  #define _mm256_maskz_shrdv_epi32(k, a, b, c) simde_mm256_maskz_shrdv_epi32(k, a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_shrdv_epi64 (simde__m256i a, simde__m256i b, simde__m256i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_shrdv_epi64(a, b, c);
+  #else
+    simde__m256i_private
+      r_,
+      a_ = simde__m256i_to_private(a),
+      b_ = simde__m256i_to_private(b),
+      c_ = simde__m256i_to_private(c);
+
+    #if defined(SIMDE_X86_AVX2_NATIVE)
+      const __m256i n = _mm256_and_si256(c_.n, _mm256_set1_epi64x(63));
+      r_.n = _mm256_or_si256(_mm256_srlv_epi64(a_.n, n), _mm256_sllv_epi64(_mm256_slli_epi64(b_.n, 1), _mm256_xor_si256(n, _mm256_set1_epi64x(63))));
+    #elif SIMDE_NATURAL_VECTOR_SIZE_LE(128)
+      for (size_t i = 0 ; i < (sizeof(r_.m128i) / sizeof(r_.m128i[0])) ; i++) {
+        r_.m128i[i] = simde_mm_shrdv_epi64(a_.m128i[i], b_.m128i[i], c_.m128i[i]);
+      }
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+        const unsigned int n = HEDLEY_STATIC_CAST(unsigned int, c_.u64[i] & 63);
+        r_.u64[i] = (a_.u64[i] >> n) | ((b_.u64[i] << 1) << (63 - n));
+      }
+    #endif
+
+    return simde__m256i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_shrdv_epi64
+  #define _mm256_shrdv_epi64(a, b, c) simde_mm256_shrdv_epi64(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_shrdv_epi64 (simde__m256i a, simde__mmask8 k, simde__m256i b, simde__m256i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_mask_shrdv_epi64(a, k, b, c);
+  #else
+    return simde_mm256_mask_mov_epi64(a, k, simde_mm256_shrdv_epi64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_shrdv_epi64
+  #define _mm256_mask_shrdv_epi64(a, k, b, c) simde_mm256_mask_shrdv_epi64(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_shrdv_epi64 (simde__mmask8 k, simde__m256i a, simde__m256i b, simde__m256i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE) && defined(SIMDE_X86_AVX512VL_NATIVE)
+    return _mm256_maskz_shrdv_epi64(k, a, b, c);
+  #else
+    return simde_mm256_maskz_mov_epi64(k, simde_mm256_shrdv_epi64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES) && defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_shrdv_epi64
+  #define _mm256_maskz_shrdv_epi64(k, a, b, c) simde_mm256_maskz_shrdv_epi64(k, a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_shrdv_epi16 (simde__m512i a, simde__m512i b, simde__m512i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_shrdv_epi16(a, b, c);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b),
+      c_ = simde__m512i_to_private(c);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_shrdv_epi16(a_.m256i[i], b_.m256i[i], c_.m256i[i]);
+      }
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u16) / sizeof(r_.u16[0])) ; i++) {
+        const uint32_t t = (HEDLEY_STATIC_CAST(uint32_t, b_.u16[i]) << 16) | a_.u16[i];
+        r_.u16[i] = HEDLEY_STATIC_CAST(uint16_t, t >> (c_.u16[i] & 15));
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_shrdv_epi16
+  #define _mm512_shrdv_epi16(a, b, c) simde_mm512_shrdv_epi16(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_shrdv_epi16 (simde__m512i a, simde__mmask32 k, simde__m512i b, simde__m512i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_mask_shrdv_epi16(a, k, b, c);
+  #else
+    return simde_mm512_mask_mov_epi16(a, k, simde_mm512_shrdv_epi16(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_shrdv_epi16
+  #define _mm512_mask_shrdv_epi16(a, k, b, c) simde_mm512_mask_shrdv_epi16(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_shrdv_epi16 (simde__mmask32 k, simde__m512i a, simde__m512i b, simde__m512i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_maskz_shrdv_epi16(k, a, b, c);
+  #else
+    return simde_mm512_maskz_mov_epi16(k, simde_mm512_shrdv_epi16(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_shrdv_epi16
+  #define _mm512_maskz_shrdv_epi16(k, a, b, c) simde_mm512_maskz_shrdv_epi16(k, a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_shrdv_epi32 (simde__m512i a, simde__m512i b, simde__m512i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_shrdv_epi32(a, b, c);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b),
+      c_ = simde__m512i_to_private(c);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_shrdv_epi32(a_.m256i[i], b_.m256i[i], c_.m256i[i]);
+      }
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+        const uint64_t t = (HEDLEY_STATIC_CAST(uint64_t, b_.u32[i]) << 32) | a_.u32[i];
+        r_.u32[i] = HEDLEY_STATIC_CAST(uint32_t, t >> (c_.u32[i] & 31));
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_shrdv_epi32
+  #define _mm512_shrdv_epi32(a, b, c) simde_mm512_shrdv_epi32(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_shrdv_epi32 (simde__m512i a, simde__mmask16 k, simde__m512i b, simde__m512i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_mask_shrdv_epi32(a, k, b, c);
+  #else
+    return simde_mm512_mask_mov_epi32(a, k, simde_mm512_shrdv_epi32(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_shrdv_epi32
+  #define _mm512_mask_shrdv_epi32(a, k, b, c) simde_mm512_mask_shrdv_epi32(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_shrdv_epi32 (simde__mmask16 k, simde__m512i a, simde__m512i b, simde__m512i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_maskz_shrdv_epi32(k, a, b, c);
+  #else
+    return simde_mm512_maskz_mov_epi32(k, simde_mm512_shrdv_epi32(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_shrdv_epi32
+  #define _mm512_maskz_shrdv_epi32(k, a, b, c) simde_mm512_maskz_shrdv_epi32(k, a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_shrdv_epi64 (simde__m512i a, simde__m512i b, simde__m512i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_shrdv_epi64(a, b, c);
+  #else
+    simde__m512i_private
+      r_,
+      a_ = simde__m512i_to_private(a),
+      b_ = simde__m512i_to_private(b),
+      c_ = simde__m512i_to_private(c);
+
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+      for (size_t i = 0 ; i < (sizeof(r_.m256i) / sizeof(r_.m256i[0])) ; i++) {
+        r_.m256i[i] = simde_mm256_shrdv_epi64(a_.m256i[i], b_.m256i[i], c_.m256i[i]);
+      }
+    #else
+      SIMDE_VECTORIZE
+      for (size_t i = 0 ; i < (sizeof(r_.u64) / sizeof(r_.u64[0])) ; i++) {
+        const unsigned int n = HEDLEY_STATIC_CAST(unsigned int, c_.u64[i] & 63);
+        r_.u64[i] = (a_.u64[i] >> n) | ((b_.u64[i] << 1) << (63 - n));
+      }
+    #endif
+
+    return simde__m512i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_shrdv_epi64
+  #define _mm512_shrdv_epi64(a, b, c) simde_mm512_shrdv_epi64(a, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_shrdv_epi64 (simde__m512i a, simde__mmask8 k, simde__m512i b, simde__m512i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_mask_shrdv_epi64(a, k, b, c);
+  #else
+    return simde_mm512_mask_mov_epi64(a, k, simde_mm512_shrdv_epi64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_shrdv_epi64
+  #define _mm512_mask_shrdv_epi64(a, k, b, c) simde_mm512_mask_shrdv_epi64(a, k, b, c)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_shrdv_epi64 (simde__mmask8 k, simde__m512i a, simde__m512i b, simde__m512i c) {
+  #if defined(SIMDE_X86_AVX512VBMI2_NATIVE)
+    return _mm512_maskz_shrdv_epi64(k, a, b, c);
+  #else
+    return simde_mm512_maskz_mov_epi64(k, simde_mm512_shrdv_epi64(a, b, c));
+  #endif
+}
+#if defined(SIMDE_X86_AVX512VBMI2_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_shrdv_epi64
+  #define _mm512_maskz_shrdv_epi64(k, a, b, c) simde_mm512_maskz_shrdv_epi64(k, a, b, c)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_SHRDV_H) */
@@ -0,0 +1,607 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#if !defined(SIMDE_X86_AVX512_TERNARYLOGIC_H)
+#define SIMDE_X86_AVX512_TERNARYLOGIC_H
+
+#include "types.h"
+#include "mov.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* Each of the 256 possible truth tables, expressed with the fewest
+ * bitwise operations (counting ~x & y as one, since SSE2 and NEON both
+ * have an and-not instruction).  imm8 is always a constant in
+ * practice, so once the function is inlined only one case survives
+ * and it is lowered to plain and/or/xor/andnot instructions on
+ * whatever vector unit is available. */
+#define SIMDE_X86_TERNARYLOGIC_SWITCH_(imm8, r, a, b, c) \
+  switch ((imm8) & 0xff) { \
+    case 0x00: (r) = (a) ^ (a); break; \
+    case 0x01: (r) = ~((a) | (b)) & ~(c); break; \
+    case 0x02: (r) = ~((a) | (b)) & (c); break; \
+    case 0x03: (r) = ~(a) & ~(b); break; \
+    case 0x04: (r) = ~((a) | (c)) & (b); break; \
+    case 0x05: (r) = ~(a) & ~(c); break; \
+    case 0x06: (r) = ~(a) & ((b) ^ (c)); break; \
+    case 0x07: (r) = ~((b) & (c)) & ~(a); break; \
+    case 0x08: (r) = ~(a) & ((b) & (c)); break; \
+    case 0x09: (r) = ~(a) & ((b) ^ ~(c)); break; \
+    case 0x0a: (r) = ~(a) & (c); break; \
+    case 0x0b: (r) = ~(a) & ((c) | ~(b)); break; \
+    case 0x0c: (r) = ~(a) & (b); break; \
+    case 0x0d: (r) = ~(a) & ((b) | ~(c)); break; \
+    case 0x0e: (r) = ~(a) & ((b) | (c)); break; \
+    case 0x0f: (r) = ~(a); break; \
+    case 0x10: (r) = ~((b) | (c)) & (a); break; \
+    case 0x11: (r) = ~(b) & ~(c); break; \
+    case 0x12: (r) = ~(b) & ((a) ^ (c)); break; \
+    case 0x13: (r) = ~((a) & (c)) & ~(b); break; \
+    case 0x14: (r) = ~(c) & ((a) ^ (b)); break; \
+    case 0x15: (r) = ~((a) & (b)) & ~(c); break; \
+    case 0x16: (r) = (a) ^ (((a) & (b)) | ((b) ^ (c))); break; \
+    case 0x17: (r) = (a) ^ (((a) ^ ~(b)) | ((b) ^ (c))); break; \
+    case 0x18: (r) = ((a) ^ (b)) & ((a) ^ (c)); break; \
+    case 0x19: (r) = (b) ^ (~(c) | ((a) & (b))); break; \
+    case 0x1a: (r) = (a) ^ ((c) | ((a) & (b))); break; \
+    case 0x1b: (r) = ((a) & (c)) ^ ((c) | ~(b)); break; \
+    case 0x1c: (r) = (a) ^ ((b) | ((a) & (c))); break; \
+    case 0x1d: (r) = ((a) & (b)) ^ ((b) | ~(c)); break; \
+    case 0x1e: (r) = (a) ^ ((b) | (c)); break; \
+    case 0x1f: (r) = ~((a) & ((b) | (c))); break; \
+    case 0x20: (r) = (a) & (~(b) & (c)); break; \
+    case 0x21: (r) = ~(b) & ((a) ^ ~(c)); break; \
+    case 0x22: (r) = ~(b) & (c); break; \
+    case 0x23: (r) = ~(b) & ((c) | ~(a)); break; \
+    case 0x24: (r) = ((a) ^ (b)) & ((b) ^ (c)); break; \
+    case 0x25: (r) = (a) ^ (~(c) | ((a) & (b))); break; \
+    case 0x26: (r) = (b) ^ ((c) | ((a) & (b))); break; \
+    case 0x27: (r) = ((a) | (c)) ^ ((b) | ~(c)); break; \
+    case 0x28: (r) = (c) & ((a) ^ (b)); break; \
+    case 0x29: (r) = (a) ^ (((a) & (b)) | ((b) ^ ~(c))); break; \
+    case 0x2a: (r) = ~((a) & (b)) & (c); break; \
+    case 0x2b: (r) = (a) ^ (((a) ^ (c)) | ((a) ^ ~(b))); break; \
+    case 0x2c: (r) = ((a) ^ (b)) & ((b) | (c)); break; \
+    case 0x2d: (r) = (a) ^ ((b) | ~(c)); break; \
+    case 0x2e: (r) = ((a) & (b)) ^ ((b) | (c)); break; \
+    case 0x2f: (r) = ~(a) | (~(b) & (c)); break; \
+    case 0x30: (r) = ~(b) & (a); break; \
+    case 0x31: (r) = ~(b) & ((a) | ~(c)); break; \
+    case 0x32: (r) = ~(b) & ((a) | (c)); break; \
+    case 0x33: (r) = ~(b); break; \
+    case 0x34: (r) = (b) ^ ((a) | ((b) & (c))); break; \
+    case 0x35: (r) = ((a) & (b)) ^ ((a) | ~(c)); break; \
+    case 0x36: (r) = (b) ^ ((a) | (c)); break; \
+    case 0x37: (r) = ~((b) & ((a) | (c))); break; \
+    case 0x38: (r) = ((a) ^ (b)) & ((a) | (c)); break; \
+    case 0x39: (r) = (b) ^ ((a) | ~(c)); break; \
+    case 0x3a: (r) = ((a) & (b)) ^ ((a) | (c)); break; \
+    case 0x3b: (r) = ~(b) | (~(a) & (c)); break; \
+    case 0x3c: (r) = (a) ^ (b); break; \
+    case 0x3d: (r) = ((a) ^ (b)) | (~(a) & ~(c)); break; \
+    case 0x3e: (r) = ((a) ^ (b)) | (~(a) & (c)); break; \
+    case 0x3f: (r) = ~((a) & (b)); break; \
+    case 0x40: (r) = (a) & (~(c) & (b)); break; \
+    case 0x41: (r) = ~(c) & ((a) ^ ~(b)); break; \
+    case 0x42: (r) = ((a) ^ (c)) & ((b) ^ (c)); break; \
+    case 0x43: (r) = (a) ^ (~(b) | ((a) & (c))); break; \
+    case 0x44: (r) = ~(c) & (b); break; \
+    case 0x45: (r) = ~(c) & ((b) | ~(a)); break; \
+    case 0x46: (r) = (c) ^ ((b) | ((a) & (c))); break; \
+    case 0x47: (r) = ((a) | (b)) ^ ((c) | ~(b)); break; \
+    case 0x48: (r) = (b) & ((a) ^ (c)); break; \
+    case 0x49: (r) = (a) ^ (((a) & (c)) | ((b) ^ ~(c))); break; \
+    case 0x4a: (r) = ((a) ^ (c)) & ((b) | (c)); break; \
+    case 0x4b: (r) = (a) ^ ((c) | ~(b)); break; \
+    case 0x4c: (r) = ~((a) & (c)) & (b); break; \
+    case 0x4d: (r) = (a) ^ (((a) ^ (b)) | ((a) ^ ~(c))); break; \
+    case 0x4e: (r) = ((a) & (c)) ^ ((b) | (c)); break; \
+    case 0x4f: (r) = ~(a) | (~(c) & (b)); break; \
+    case 0x50: (r) = ~(c) & (a); break; \
+    case 0x51: (r) = ~(c) & ((a) | ~(b)); break; \
+    case 0x52: (r) = (c) ^ ((a) | ((b) & (c))); break; \
+    case 0x53: (r) = ((a) | (b)) ^ ((c) | ~(a)); break; \
+    case 0x54: (r) = ~(c) & ((a) | (b)); break; \
+    case 0x55: (r) = ~(c); break; \
+    case 0x56: (r) = (c) ^ ((a) | (b)); break; \
+    case 0x57: (r) = ~((c) & ((a) | (b))); break; \
+    case 0x58: (r) = ((a) | (b)) & ((a) ^ (c)); break; \
+    case 0x59: (r) = (c) ^ ((a) | ~(b)); break; \
+    case 0x5a: (r) = (a) ^ (c); break; \
+    case 0x5b: (r) = ((a) ^ (c)) | (~(a) & ~(b)); break; \
+    case 0x5c: (r) = ((a) | (b)) ^ ((a) & (c)); break; \
+    case 0x5d: (r) = ~(c) | (~(a) & (b)); break; \
+    case 0x5e: (r) = (~(a) & (b)) | ((a) ^ (c)); break; \
+    case 0x5f: (r) = ~((a) & (c)); break; \
+    case 0x60: (r) = (a) & ((b) ^ (c)); break; \
+    case 0x61: (r) = (b) ^ (((a) ^ ~(c)) | ((b) & (c))); break; \
+    case 0x62: (r) = ((a) | (c)) & ((b) ^ (c)); break; \
+    case 0x63: (r) = (b) ^ ((c) | ~(a)); break; \
+    case 0x64: (r) = ((a) | (b)) & ((b) ^ (c)); break; \
+    case 0x65: (r) = (c) ^ ((b) | ~(a)); break; \
+    case 0x66: (r) = (b) ^ (c); break; \
+    case 0x67: (r) = (~(a) & ~(b)) | ((b) ^ (c)); break; \
+    case 0x68: (r) = ((a) & (b)) ^ ((c) & ((a) | (b))); break; \
+    case 0x69: (r) = (a) ^ ((b) ^ ~(c)); break; \
+    case 0x6a: (r) = (c) ^ ((a) & (b)); break; \
+    case 0x6b: (r) = ~(a) ^ (((a) | (b)) & ((b) ^ (c))); break; \
+    case 0x6c: (r) = (b) ^ ((a) & (c)); break; \
+    case 0x6d: (r) = ~(a) ^ (((a) | (c)) & ((b) ^ (c))); break; \
+    case 0x6e: (r) = (~(a) & (b)) | ((b) ^ (c)); break; \
+    case 0x6f: (r) = ~(a) | ((b) ^ (c)); break; \
+    case 0x70: (r) = ~((b) & (c)) & (a); break; \
+    case 0x71: (r) = (b) ^ (((a) ^ (b)) | ((a) ^ ~(c))); break; \
+    case 0x72: (r) = ((a) | (c)) ^ ((b) & (c)); break; \
+    case 0x73: (r) = ~(b) | (~(c) & (a)); break; \
+    case 0x74: (r) = ((a) | (b)) ^ ((b) & (c)); break; \
+    case 0x75: (r) = ~(c) | (~(b) & (a)); break; \
+    case 0x76: (r) = (~(b) & (a)) | ((b) ^ (c)); break; \
+    case 0x77: (r) = ~((b) & (c)); break; \
+    case 0x78: (r) = (a) ^ ((b) & (c)); break; \
+    case 0x79: (r) = ~(b) ^ (((a) ^ (c)) & ((b) | (c))); break; \
+    case 0x7a: (r) = ((a) ^ (c)) | (~(b) & (a)); break; \
+    case 0x7b: (r) = ~(b) | ((a) ^ (c)); break; \
+    case 0x7c: (r) = ((a) ^ (b)) | (~(c) & (a)); break; \
+    case 0x7d: (r) = ~(c) | ((a) ^ (b)); break; \
+    case 0x7e: (r) = ((a) ^ (b)) | ((a) ^ (c)); break; \
+    case 0x7f: (r) = ~((a) & ((b) & (c))); break; \
+    case 0x80: (r) = (a) & ((b) & (c)); break; \
+    case 0x81: (r) = ~((a) ^ (b)) & ((a) ^ ~(c)); break; \
+    case 0x82: (r) = ~((a) ^ (b)) & (c); break; \
+    case 0x83: (r) = ~((a) ^ (b)) & ((c) | ~(a)); break; \
+    case 0x84: (r) = ~((a) ^ (c)) & (b); break; \
+    case 0x85: (r) = ~((a) ^ (c)) & ((b) | ~(a)); break; \
+    case 0x86: (r) = (b) ^ (((a) ^ (c)) & ((b) | (c))); break; \
+    case 0x87: (r) = ~(a) ^ ((b) & (c)); break; \
+    case 0x88: (r) = (b) & (c); break; \
+    case 0x89: (r) = ~((b) ^ (c)) & ((b) | ~(a)); break; \
+    case 0x8a: (r) = (c) & ((b) | ~(a)); break; \
+    case 0x8b: (r) = (a) ^ (~(b) | ((a) ^ (c))); break; \
+    case 0x8c: (r) = (b) & ((c) | ~(a)); break; \
+    case 0x8d: (r) = (a) ^ (~(c) | ((a) ^ (b))); break; \
+    case 0x8e: (r) = (a) ^ (((a) ^ (b)) | ((a) ^ (c))); break; \
+    case 0x8f: (r) = ~(a) | ((b) & (c)); break; \
+    case 0x90: (r) = ~((b) ^ (c)) & (a); break; \
+    case 0x91: (r) = ~((b) ^ (c)) & ((a) | ~(b)); break; \
+    case 0x92: (r) = (a) ^ (((a) | (c)) & ((b) ^ (c))); break; \
+    case 0x93: (r) = ~(b) ^ ((a) & (c)); break; \
+    case 0x94: (r) = (a) ^ (((a) | (b)) & ((b) ^ (c))); break; \
+    case 0x95: (r) = ~(c) ^ ((a) & (b)); break; \
+    case 0x96: (r) = (a) ^ ((b) ^ (c)); break; \
+    case 0x97: (r) = (a) ^ ((~(a) & ~(b)) | ((b) ^ (c))); break; \
+    case 0x98: (r) = ~((b) ^ (c)) & ((a) | (b)); break; \
+    case 0x99: (r) = (b) ^ ~(c); break; \
+    case 0x9a: (r) = (c) ^ (~(b) & (a)); break; \
+    case 0x9b: (r) = ~(b) ^ ((c) & ((a) | (b))); break; \
+    case 0x9c: (r) = (b) ^ (~(c) & (a)); break; \
+    case 0x9d: (r) = ~(c) ^ ((b) & ((a) | (c))); break; \
+    case 0x9e: (r) = ((b) & (c)) | ((a) ^ ((b) | (c))); break; \
+    case 0x9f: (r) = ~((a) & ((b) ^ (c))); break; \
+    case 0xa0: (r) = (a) & (c); break; \
+    case 0xa1: (r) = ~((a) ^ (c)) & ((a) | ~(b)); break; \
+    case 0xa2: (r) = (c) & ((a) | ~(b)); break; \
+    case 0xa3: (r) = (b) ^ (~(a) | ((b) ^ (c))); break; \
+    case 0xa4: (r) = ~((a) ^ (c)) & ((a) | (b)); break; \
+    case 0xa5: (r) = (a) ^ ~(c); break; \
+    case 0xa6: (r) = (c) ^ (~(a) & (b)); break; \
+    case 0xa7: (r) = ~(a) ^ ((c) & ((a) | (b))); break; \
+    case 0xa8: (r) = (c) & ((a) | (b)); break; \
+    case 0xa9: (r) = ~(c) ^ ((a) | (b)); break; \
+    case 0xaa: (r) = (c); break; \
+    case 0xab: (r) = (c) | (~(a) & ~(b)); break; \
+    case 0xac: (r) = (b) ^ ((a) & ((b) ^ (c))); break; \
+    case 0xad: (r) = ((a) ^ ~(c)) | ((b) & (c)); break; \
+    case 0xae: (r) = (c) | (~(a) & (b)); break; \
+    case 0xaf: (r) = (c) | ~(a); break; \
+    case 0xb0: (r) = (a) & ((c) | ~(b)); break; \
+    case 0xb1: (r) = (b) ^ (~(c) | ((a) ^ (b))); break; \
+    case 0xb2: (r) = (a) ^ (((a) ^ (c)) & ((b) ^ (c))); break; \
+    case 0xb3: (r) = ~(b) | ((a) & (c)); break; \
+    case 0xb4: (r) = (a) ^ (~(c) & (b)); break; \
+    case 0xb5: (r) = ~(c) ^ ((a) & ((b) | (c))); break; \
+    case 0xb6: (r) = ((a) & (c)) | ((a) ^ ((b) ^ (c))); break; \
+    case 0xb7: (r) = ~((b) & ((a) ^ (c))); break; \
+    case 0xb8: (r) = (a) ^ ((b) & ((a) ^ (c))); break; \
+    case 0xb9: (r) = ((a) & (c)) | ((b) ^ ~(c)); break; \
+    case 0xba: (r) = (c) | (~(b) & (a)); break; \
+    case 0xbb: (r) = (c) | ~(b); break; \
+    case 0xbc: (r) = ((a) ^ (b)) | ((a) & (c)); break; \
+    case 0xbd: (r) = ((a) ^ (b)) | ((a) ^ ~(c)); break; \
+    case 0xbe: (r) = (c) | ((a) ^ (b)); break; \
+    case 0xbf: (r) = (c) | ~((a) & (b)); break; \
+    case 0xc0: (r) = (a) & (b); break; \
+    case 0xc1: (r) = ~((a) ^ (b)) & ((a) | ~(c)); break; \
+    case 0xc2: (r) = ~((a) ^ (b)) & ((a) | (c)); break; \
+    case 0xc3: (r) = (a) ^ ~(b); break; \
+    case 0xc4: (r) = (b) & ((a) | ~(c)); break; \
+    case 0xc5: (r) = (c) ^ (~(a) | ((b) ^ (c))); break; \
+    case 0xc6: (r) = (b) ^ (~(a) & (c)); break; \
+    case 0xc7: (r) = ~(a) ^ ((b) & ((a) | (c))); break; \
+    case 0xc8: (r) = (b) & ((a) | (c)); break; \
+    case 0xc9: (r) = ~(b) ^ ((a) | (c)); break; \
+    case 0xca: (r) = (c) ^ ((a) & ((b) ^ (c))); break; \
+    case 0xcb: (r) = ((a) ^ ~(b)) | ((b) & (c)); break; \
+    case 0xcc: (r) = (b); break; \
+    case 0xcd: (r) = (b) | (~(a) & ~(c)); break; \
+    case 0xce: (r) = (b) | (~(a) & (c)); break; \
+    case 0xcf: (r) = (b) | ~(a); break; \
+    case 0xd0: (r) = (a) & ((b) | ~(c)); break; \
+    case 0xd1: (r) = (c) ^ (~(b) | ((a) ^ (c))); break; \
+    case 0xd2: (r) = (a) ^ (~(b) & (c)); break; \
+    case 0xd3: (r) = ~(b) ^ ((a) & ((b) | (c))); break; \
+    case 0xd4: (r) = (a) ^ (((a) ^ (b)) & ((b) ^ (c))); break; \
+    case 0xd5: (r) = ~(c) | ((a) & (b)); break; \
+    case 0xd6: (r) = ((a) & (b)) | ((a) ^ ((b) ^ (c))); break; \
+    case 0xd7: (r) = ~((c) & ((a) ^ (b))); break; \
+    case 0xd8: (r) = (a) ^ ((c) & ((a) ^ (b))); break; \
+    case 0xd9: (r) = ((a) & (b)) | ((b) ^ ~(c)); break; \
+    case 0xda: (r) = ((a) & (b)) | ((a) ^ (c)); break; \
+    case 0xdb: (r) = ((a) ^ (c)) | ((a) ^ ~(b)); break; \
+    case 0xdc: (r) = (b) | (~(c) & (a)); break; \
+    case 0xdd: (r) = (b) | ~(c); break; \
+    case 0xde: (r) = (b) | ((a) ^ (c)); break; \
+    case 0xdf: (r) = (b) | ~((a) & (c)); break; \
+    case 0xe0: (r) = (a) & ((b) | (c)); break; \
+    case 0xe1: (r) = ~(a) ^ ((b) | (c)); break; \
+    case 0xe2: (r) = (c) ^ ((b) & ((a) ^ (c))); break; \
+    case 0xe3: (r) = ((a) & (c)) | ((a) ^ ~(b)); break; \
+    case 0xe4: (r) = (b) ^ ((c) & ((a) ^ (b))); break; \
+    case 0xe5: (r) = ((a) & (b)) | ((a) ^ ~(c)); break; \
+    case 0xe6: (r) = ((a) & (b)) | ((b) ^ (c)); break; \
+    case 0xe7: (r) = ((a) ^ ~(b)) | ((b) ^ (c)); break; \
+    case 0xe8: (r) = (a) ^ (((a) ^ (b)) & ((a) ^ (c))); break; \
+    case 0xe9: (r) = ~(a) ^ (((a) & (b)) | ((b) ^ (c))); break; \
+    case 0xea: (r) = (c) | ((a) & (b)); break; \
+    case 0xeb: (r) = (c) | ((a) ^ ~(b)); break; \
+    case 0xec: (r) = (b) | ((a) & (c)); break; \
+    case 0xed: (r) = (b) | ((a) ^ ~(c)); break; \
+    case 0xee: (r) = (b) | (c); break; \
+    case 0xef: (r) = (b) | ((c) | ~(a)); break; \
+    case 0xf0: (r) = (a); break; \
+    case 0xf1: (r) = (a) | (~(b) & ~(c)); break; \
+    case 0xf2: (r) = (a) | (~(b) & (c)); break; \
+    case 0xf3: (r) = (a) | ~(b); break; \
+    case 0xf4: (r) = (a) | (~(c) & (b)); break; \
+    case 0xf5: (r) = (a) | ~(c); break; \
+    case 0xf6: (r) = (a) | ((b) ^ (c)); break; \
+    case 0xf7: (r) = (a) | ~((b) & (c)); break; \
+    case 0xf8: (r) = (a) | ((b) & (c)); break; \
+    case 0xf9: (r) = (a) | ((b) ^ ~(c)); break; \
+    case 0xfa: (r) = (a) | (c); break; \
+    case 0xfb: (r) = (a) | ((c) | ~(b)); break; \
+    case 0xfc: (r) = (a) | (b); break; \
+    case 0xfd: (r) = (a) | ((b) | ~(c)); break; \
+    case 0xfe: (r) = (a) | ((b) | (c)); break; \
+    case 0xff: (r) = (a) | ~(a); break; \
+    default: HEDLEY_UNREACHABLE(); break; \
+  }
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_ternarylogic_epi32 (simde__m128i a, simde__m128i b, simde__m128i c, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  simde__m128i_private
+    r_,
+    a_ = simde__m128i_to_private(a),
+    b_ = simde__m128i_to_private(b),
+    c_ = simde__m128i_to_private(c);
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS) && !defined(SIMDE_BUG_CLANG_BAD_VI64_OPS)
+    SIMDE_X86_TERNARYLOGIC_SWITCH_(imm8, r_.i32f, a_.i32f, b_.i32f, c_.i32f);
+  #else
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i32f) / sizeof(r_.i32f[0])) ; i++) {
+      SIMDE_X86_TERNARYLOGIC_SWITCH_(imm8, r_.i32f[i], a_.i32f[i], b_.i32f[i], c_.i32f[i]);
+    }
+  #endif
+
+  return simde__m128i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_ternarylogic_epi32(a, b, c, imm8) _mm_ternarylogic_epi32(a, b, c, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_ternarylogic_epi32
+  #define _mm_ternarylogic_epi32(a, b, c, imm8) simde_mm_ternarylogic_epi32(a, b, c, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_ternarylogic_epi64 (simde__m128i a, simde__m128i b, simde__m128i c, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  /* Without a mask the element size doesn't matter. */
+  return simde_mm_ternarylogic_epi32(a, b, c, imm8);
+}
+#if defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_ternarylogic_epi64(a, b, c, imm8) _mm_ternarylogic_epi64(a, b, c, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_ternarylogic_epi64
+  #define _mm_ternarylogic_epi64(a, b, c, imm8) simde_mm_ternarylogic_epi64(a, b, c, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_ternarylogic_epi32 (simde__m128i src, simde__mmask8 k, simde__m128i a, simde__m128i b, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_mm_mask_mov_epi32(src, k, simde_mm_ternarylogic_epi32(src, a, b, imm8));
+}
+#if defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_ternarylogic_epi32(src, k, a, b, imm8) _mm_mask_ternarylogic_epi32(src, k, a, b, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_ternarylogic_epi32
+  #define _mm_mask_ternarylogic_epi32(src, k, a, b, imm8) simde_mm_mask_ternarylogic_epi32(src, k, a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_ternarylogic_epi32 (simde__mmask8 k, simde__m128i a, simde__m128i b, simde__m128i c, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_mm_maskz_mov_epi32(k, simde_mm_ternarylogic_epi32(a, b, c, imm8));
+}
+#if defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_maskz_ternarylogic_epi32(k, a, b, c, imm8) _mm_maskz_ternarylogic_epi32(k, a, b, c, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_ternarylogic_epi32
+  #define _mm_maskz_ternarylogic_epi32(k, a, b, c, imm8) simde_mm_maskz_ternarylogic_epi32(k, a, b, c, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_mask_ternarylogic_epi64 (simde__m128i src, simde__mmask8 k, simde__m128i a, simde__m128i b, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_mm_mask_mov_epi64(src, k, simde_mm_ternarylogic_epi64(src, a, b, imm8));
+}
+#if defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_mask_ternarylogic_epi64(src, k, a, b, imm8) _mm_mask_ternarylogic_epi64(src, k, a, b, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_mask_ternarylogic_epi64
+  #define _mm_mask_ternarylogic_epi64(src, k, a, b, imm8) simde_mm_mask_ternarylogic_epi64(src, k, a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_maskz_ternarylogic_epi64 (simde__mmask8 k, simde__m128i a, simde__m128i b, simde__m128i c, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_mm_maskz_mov_epi64(k, simde_mm_ternarylogic_epi64(a, b, c, imm8));
+}
+#if defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm_maskz_ternarylogic_epi64(k, a, b, c, imm8) _mm_maskz_ternarylogic_epi64(k, a, b, c, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm_maskz_ternarylogic_epi64
+  #define _mm_maskz_ternarylogic_epi64(k, a, b, c, imm8) simde_mm_maskz_ternarylogic_epi64(k, a, b, c, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_ternarylogic_epi32 (simde__m256i a, simde__m256i b, simde__m256i c, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  simde__m256i_private
+    r_,
+    a_ = simde__m256i_to_private(a),
+    b_ = simde__m256i_to_private(b),
+    c_ = simde__m256i_to_private(c);
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS) && !defined(SIMDE_BUG_CLANG_BAD_VI64_OPS)
+    SIMDE_X86_TERNARYLOGIC_SWITCH_(imm8, r_.i32f, a_.i32f, b_.i32f, c_.i32f);
+  #else
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i32f) / sizeof(r_.i32f[0])) ; i++) {
+      SIMDE_X86_TERNARYLOGIC_SWITCH_(imm8, r_.i32f[i], a_.i32f[i], b_.i32f[i], c_.i32f[i]);
+    }
+  #endif
+
+  return simde__m256i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_ternarylogic_epi32(a, b, c, imm8) _mm256_ternarylogic_epi32(a, b, c, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_ternarylogic_epi32
+  #define _mm256_ternarylogic_epi32(a, b, c, imm8) simde_mm256_ternarylogic_epi32(a, b, c, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_ternarylogic_epi64 (simde__m256i a, simde__m256i b, simde__m256i c, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  /* Without a mask the element size doesn't matter. */
+  return simde_mm256_ternarylogic_epi32(a, b, c, imm8);
+}
+#if defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_ternarylogic_epi64(a, b, c, imm8) _mm256_ternarylogic_epi64(a, b, c, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_ternarylogic_epi64
+  #define _mm256_ternarylogic_epi64(a, b, c, imm8) simde_mm256_ternarylogic_epi64(a, b, c, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_ternarylogic_epi32 (simde__m256i src, simde__mmask8 k, simde__m256i a, simde__m256i b, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_mm256_mask_mov_epi32(src, k, simde_mm256_ternarylogic_epi32(src, a, b, imm8));
+}
+#if defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_ternarylogic_epi32(src, k, a, b, imm8) _mm256_mask_ternarylogic_epi32(src, k, a, b, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_ternarylogic_epi32
+  #define _mm256_mask_ternarylogic_epi32(src, k, a, b, imm8) simde_mm256_mask_ternarylogic_epi32(src, k, a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_ternarylogic_epi32 (simde__mmask8 k, simde__m256i a, simde__m256i b, simde__m256i c, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_mm256_maskz_mov_epi32(k, simde_mm256_ternarylogic_epi32(a, b, c, imm8));
+}
+#if defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_maskz_ternarylogic_epi32(k, a, b, c, imm8) _mm256_maskz_ternarylogic_epi32(k, a, b, c, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_ternarylogic_epi32
+  #define _mm256_maskz_ternarylogic_epi32(k, a, b, c, imm8) simde_mm256_maskz_ternarylogic_epi32(k, a, b, c, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_mask_ternarylogic_epi64 (simde__m256i src, simde__mmask8 k, simde__m256i a, simde__m256i b, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_mm256_mask_mov_epi64(src, k, simde_mm256_ternarylogic_epi64(src, a, b, imm8));
+}
+#if defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_mask_ternarylogic_epi64(src, k, a, b, imm8) _mm256_mask_ternarylogic_epi64(src, k, a, b, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_mask_ternarylogic_epi64
+  #define _mm256_mask_ternarylogic_epi64(src, k, a, b, imm8) simde_mm256_mask_ternarylogic_epi64(src, k, a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256i
+simde_mm256_maskz_ternarylogic_epi64 (simde__mmask8 k, simde__m256i a, simde__m256i b, simde__m256i c, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_mm256_maskz_mov_epi64(k, simde_mm256_ternarylogic_epi64(a, b, c, imm8));
+}
+#if defined(SIMDE_X86_AVX512VL_NATIVE)
+  #define simde_mm256_maskz_ternarylogic_epi64(k, a, b, c, imm8) _mm256_maskz_ternarylogic_epi64(k, a, b, c, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512VL_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_maskz_ternarylogic_epi64
+  #define _mm256_maskz_ternarylogic_epi64(k, a, b, c, imm8) simde_mm256_maskz_ternarylogic_epi64(k, a, b, c, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_ternarylogic_epi32 (simde__m512i a, simde__m512i b, simde__m512i c, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  simde__m512i_private
+    r_,
+    a_ = simde__m512i_to_private(a),
+    b_ = simde__m512i_to_private(b),
+    c_ = simde__m512i_to_private(c);
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_OPS) && !defined(SIMDE_BUG_CLANG_BAD_VI64_OPS)
+    SIMDE_X86_TERNARYLOGIC_SWITCH_(imm8, r_.i32f, a_.i32f, b_.i32f, c_.i32f);
+  #else
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.i32f) / sizeof(r_.i32f[0])) ; i++) {
+      SIMDE_X86_TERNARYLOGIC_SWITCH_(imm8, r_.i32f[i], a_.i32f[i], b_.i32f[i], c_.i32f[i]);
+    }
+  #endif
+
+  return simde__m512i_from_private(r_);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_ternarylogic_epi32(a, b, c, imm8) _mm512_ternarylogic_epi32(a, b, c, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_ternarylogic_epi32
+  #define _mm512_ternarylogic_epi32(a, b, c, imm8) simde_mm512_ternarylogic_epi32(a, b, c, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_ternarylogic_epi64 (simde__m512i a, simde__m512i b, simde__m512i c, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  /* Without a mask the element size doesn't matter. */
+  return simde_mm512_ternarylogic_epi32(a, b, c, imm8);
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_ternarylogic_epi64(a, b, c, imm8) _mm512_ternarylogic_epi64(a, b, c, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_ternarylogic_epi64
+  #define _mm512_ternarylogic_epi64(a, b, c, imm8) simde_mm512_ternarylogic_epi64(a, b, c, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_ternarylogic_epi32 (simde__m512i src, simde__mmask16 k, simde__m512i a, simde__m512i b, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_mm512_mask_mov_epi32(src, k, simde_mm512_ternarylogic_epi32(src, a, b, imm8));
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_ternarylogic_epi32(src, k, a, b, imm8) _mm512_mask_ternarylogic_epi32(src, k, a, b, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_ternarylogic_epi32
+  #define _mm512_mask_ternarylogic_epi32(src, k, a, b, imm8) simde_mm512_mask_ternarylogic_epi32(src, k, a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_ternarylogic_epi32 (simde__mmask16 k, simde__m512i a, simde__m512i b, simde__m512i c, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_mm512_maskz_mov_epi32(k, simde_mm512_ternarylogic_epi32(a, b, c, imm8));
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_maskz_ternarylogic_epi32(k, a, b, c, imm8) _mm512_maskz_ternarylogic_epi32(k, a, b, c, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_ternarylogic_epi32
+  #define _mm512_maskz_ternarylogic_epi32(k, a, b, c, imm8) simde_mm512_maskz_ternarylogic_epi32(k, a, b, c, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_mask_ternarylogic_epi64 (simde__m512i src, simde__mmask8 k, simde__m512i a, simde__m512i b, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_mm512_mask_mov_epi64(src, k, simde_mm512_ternarylogic_epi64(src, a, b, imm8));
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_mask_ternarylogic_epi64(src, k, a, b, imm8) _mm512_mask_ternarylogic_epi64(src, k, a, b, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_mask_ternarylogic_epi64
+  #define _mm512_mask_ternarylogic_epi64(src, k, a, b, imm8) simde_mm512_mask_ternarylogic_epi64(src, k, a, b, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m512i
+simde_mm512_maskz_ternarylogic_epi64 (simde__mmask8 k, simde__m512i a, simde__m512i b, simde__m512i c, int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 255) {
+  return simde_mm512_maskz_mov_epi64(k, simde_mm512_ternarylogic_epi64(a, b, c, imm8));
+}
+#if defined(SIMDE_X86_AVX512F_NATIVE)
+  #define simde_mm512_maskz_ternarylogic_epi64(k, a, b, c, imm8) _mm512_maskz_ternarylogic_epi64(k, a, b, c, imm8)
+#endif
+#if defined(SIMDE_X86_AVX512F_ENABLE_NATIVE_ALIASES)
+  #undef _mm512_maskz_ternarylogic_epi64
+  #define _mm512_maskz_ternarylogic_epi64(k, a, b, c, imm8) simde_mm512_maskz_ternarylogic_epi64(k, a, b, c, imm8)
+#endif
+
+SIMDE_END_DECLS_
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_AVX512_TERNARYLOGIC_H) */
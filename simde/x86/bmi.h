@@ -0,0 +1,445 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+/* BMI1 and LZCNT.  These are scalar instructions, so the portable
+ * versions are just plain C; the interesting part is getting
+ * count-leading/trailing-zeros down to a single instruction on as
+ * many compilers as possible. */
+
+#if !defined(SIMDE_X86_BMI_H)
+#define SIMDE_X86_BMI_H
+
+#include "../simde-common.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* simde_x_clz{32,64} and simde_x_ctz{32,64} return the number of
+ * leading/trailing zero bits.  Like the builtins they are based on,
+ * the result is undefined if the input is zero. */
+#if \
+    ( HEDLEY_HAS_BUILTIN(__builtin_clz) || \
+      HEDLEY_GCC_VERSION_CHECK(3,4,0) || \
+      HEDLEY_ARM_VERSION_CHECK(4,1,0) || \
+      HEDLEY_INTEL_VERSION_CHECK(16,0,0) ) && \
+    defined(__INT_MAX__) && defined(__LONG_MAX__) && defined(__LONG_LONG_MAX__) && \
+    defined(__INT32_MAX__) && defined(__INT64_MAX__)
+  #if __INT_MAX__ == __INT32_MAX__
+    #define simde_x_clz32(v) __builtin_clz(HEDLEY_STATIC_CAST(unsigned int, (v)))
+    #define simde_x_ctz32(v) __builtin_ctz(HEDLEY_STATIC_CAST(unsigned int, (v)))
+  #elif __LONG_MAX__ == __INT32_MAX__
+    #define simde_x_clz32(v) __builtin_clzl(HEDLEY_STATIC_CAST(unsigned long, (v)))
+    #define simde_x_ctz32(v) __builtin_ctzl(HEDLEY_STATIC_CAST(unsigned long, (v)))
+  #elif __LONG_LONG_MAX__ == __INT32_MAX__
+    #define simde_x_clz32(v) __builtin_clzll(HEDLEY_STATIC_CAST(unsigned long long, (v)))
+    #define simde_x_ctz32(v) __builtin_ctzll(HEDLEY_STATIC_CAST(unsigned long long, (v)))
+  #endif
+
+  #if __INT_MAX__ == __INT64_MAX__
+    #define simde_x_clz64(v) __builtin_clz(HEDLEY_STATIC_CAST(unsigned int, (v)))
+    #define simde_x_ctz64(v) __builtin_ctz(HEDLEY_STATIC_CAST(unsigned int, (v)))
+  #elif __LONG_MAX__ == __INT64_MAX__
+    #define simde_x_clz64(v) __builtin_clzl(HEDLEY_STATIC_CAST(unsigned long, (v)))
+    #define simde_x_ctz64(v) __builtin_ctzl(HEDLEY_STATIC_CAST(unsigned long, (v)))
+  #elif __LONG_LONG_MAX__ == __INT64_MAX__
+    #define simde_x_clz64(v) __builtin_clzll(HEDLEY_STATIC_CAST(unsigned long long, (v)))
+    #define simde_x_ctz64(v) __builtin_ctzll(HEDLEY_STATIC_CAST(unsigned long long, (v)))
+  #endif
+#elif HEDLEY_MSVC_VERSION_CHECK(14,0,0)
+  static int simde_x_clz32(uint32_t x) {
+    unsigned long r;
+    _BitScanReverse(&r, x);
+    return 31 - HEDLEY_STATIC_CAST(int, r);
+  }
+  #define simde_x_clz32 simde_x_clz32
+
+  static int simde_x_ctz32(uint32_t x) {
+    unsigned long r;
+    _BitScanForward(&r, x);
+    return HEDLEY_STATIC_CAST(int, r);
+  }
+  #define simde_x_ctz32 simde_x_ctz32
+
+  static int simde_x_clz64(uint64_t x) {
+    unsigned long r;
+
+    #if defined(_M_AMD64) || defined(_M_ARM64)
+      _BitScanReverse64(&r, x);
+      return 63 - HEDLEY_STATIC_CAST(int, r);
+    #else
+      uint32_t high = HEDLEY_STATIC_CAST(uint32_t, x >> 32);
+      if (high != 0)
+        return simde_x_clz32(high);
+      else
+        return simde_x_clz32(HEDLEY_STATIC_CAST(uint32_t, x)) + 32;
+    #endif
+  }
+  #define simde_x_clz64 simde_x_clz64
+
+  static int simde_x_ctz64(uint64_t x) {
+    unsigned long r;
+
+    #if defined(_M_AMD64) || defined(_M_ARM64)
+      _BitScanForward64(&r, x);
+      return HEDLEY_STATIC_CAST(int, r);
+    #else
+      uint32_t low = HEDLEY_STATIC_CAST(uint32_t, x);
+      if (low != 0)
+        return simde_x_ctz32(low);
+      else
+        return simde_x_ctz32(HEDLEY_STATIC_CAST(uint32_t, x >> 32)) + 32;
+    #endif
+  }
+  #define simde_x_ctz64 simde_x_ctz64
+#elif HEDLEY_IBM_VERSION_CHECK(13,1,0)
+  #define simde_x_clz32(v) HEDLEY_STATIC_CAST(int, __cntlz4(HEDLEY_STATIC_CAST(unsigned int, (v))))
+  #define simde_x_ctz32(v) HEDLEY_STATIC_CAST(int, __cnttz4(HEDLEY_STATIC_CAST(unsigned int, (v))))
+  #define simde_x_clz64(v) HEDLEY_STATIC_CAST(int, __cntlz8(HEDLEY_STATIC_CAST(unsigned long long, (v))))
+  #define simde_x_ctz64(v) HEDLEY_STATIC_CAST(int, __cnttz8(HEDLEY_STATIC_CAST(unsigned long long, (v))))
+#endif
+
+#if !defined(simde_x_clz32) || !defined(simde_x_clz64)
+  static uint8_t simde_x_clz_lookup_(const uint8_t value) {
+    static const uint8_t lut[256] = {
+      7, 7, 6, 6, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4,
+      3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+      2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+      2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+    };
+    return lut[value];
+  };
+
+  #if !defined(simde_x_clz32)
+    static int simde_x_clz32(uint32_t x) {
+      size_t s = sizeof(x) * 8;
+      uint32_t r;
+
+      while ((s -= 8) != 0) {
+        r = x >> s;
+        if (r != 0)
+          return simde_x_clz_lookup_(HEDLEY_STATIC_CAST(uint8_t, r)) +
+            (((sizeof(x) - 1) * 8) - s);
+      }
+
+      if (x == 0)
+        return (int) ((sizeof(x) * 8) - 1);
+      else
+        return simde_x_clz_lookup_(HEDLEY_STATIC_CAST(uint8_t, x)) +
+          ((sizeof(x) - 1) * 8);
+    }
+  #endif
+
+  #if !defined(simde_x_clz64)
+    static int simde_x_clz64(uint64_t x) {
+      size_t s = sizeof(x) * 8;
+      uint64_t r;
+
+      while ((s -= 8) != 0) {
+        r = x >> s;
+        if (r != 0)
+          return simde_x_clz_lookup_(HEDLEY_STATIC_CAST(uint8_t, r)) +
+            (((sizeof(x) - 1) * 8) - s);
+      }
+
+      if (x == 0)
+        return (int) ((sizeof(x) * 8) - 1);
+      else
+        return simde_x_clz_lookup_(HEDLEY_STATIC_CAST(uint8_t, x)) +
+          ((sizeof(x) - 1) * 8);
+    }
+  #endif
+#endif
+
+#if !defined(simde_x_ctz32) || !defined(simde_x_ctz64)
+  /* Isolate the lowest set bit and use a de Bruijn sequence to find
+   * its index. */
+  #if !defined(simde_x_ctz32)
+    static int simde_x_ctz32(uint32_t x) {
+      static const uint8_t lut[32] = {
+         0,  1, 28,  2, 29, 14, 24,  3, 30, 22, 20, 15, 25, 17,  4,  8,
+        31, 27, 13, 23, 21, 19, 16,  7, 26, 12, 18,  6, 11,  5, 10,  9
+      };
+      return lut[HEDLEY_STATIC_CAST(uint32_t, (x & (~x + 1)) * UINT32_C(0x077CB531)) >> 27];
+    }
+  #endif
+
+  #if !defined(simde_x_ctz64)
+    static int simde_x_ctz64(uint64_t x) {
+      static const uint8_t lut[64] = {
+         0,  1,  2, 53,  3,  7, 54, 27,  4, 38, 41,  8, 34, 55, 48, 28,
+        62,  5, 39, 46, 44, 42, 22,  9, 24, 35, 59, 56, 49, 18, 29, 11,
+        63, 52,  6, 26, 37, 40, 33, 47, 61, 45, 43, 21, 23, 58, 17, 10,
+        51, 25, 36, 32, 60, 20, 57, 16, 50, 31, 19, 15, 30, 14, 13, 12
+      };
+      return lut[((x & (~x + 1)) * UINT64_C(0x022FDD63CC95386D)) >> 58];
+    }
+  #endif
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_andn_u32 (uint32_t a, uint32_t b) {
+  #if defined(SIMDE_X86_BMI1_NATIVE)
+    return _andn_u32(a, b);
+  #else
+    return ~a & b;
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #define _andn_u32(a, b) simde_andn_u32(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_andn_u64 (uint64_t a, uint64_t b) {
+  #if defined(SIMDE_X86_BMI1_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    return _andn_u64(a, b);
+  #else
+    return ~a & b;
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #define _andn_u64(a, b) simde_andn_u64(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_bextr_u32 (uint32_t a, uint32_t start, uint32_t len) {
+  #if defined(SIMDE_X86_BMI1_NATIVE)
+    return _bextr_u32(a, start, len);
+  #else
+    start &= 0xff;
+    len &= 0xff;
+
+    const uint32_t r = (start < 32) ? (a >> start) : 0;
+    return (len < 32) ? (r & ((UINT32_C(1) << len) - 1)) : r;
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #define _bextr_u32(a, start, len) simde_bextr_u32(a, start, len)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_bextr_u64 (uint64_t a, uint32_t start, uint32_t len) {
+  #if defined(SIMDE_X86_BMI1_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    return _bextr_u64(a, start, len);
+  #else
+    start &= 0xff;
+    len &= 0xff;
+
+    const uint64_t r = (start < 64) ? (a >> start) : 0;
+    return (len < 64) ? (r & ((UINT64_C(1) << len) - 1)) : r;
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #define _bextr_u64(a, start, len) simde_bextr_u64(a, start, len)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_bextr2_u32 (uint32_t a, uint32_t control) {
+  return simde_bextr_u32(a, control & 0xff, (control >> 8) & 0xff);
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #define _bextr2_u32(a, control) simde_bextr2_u32(a, control)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_bextr2_u64 (uint64_t a, uint64_t control) {
+  return simde_bextr_u64(a, HEDLEY_STATIC_CAST(uint32_t, control & 0xff), HEDLEY_STATIC_CAST(uint32_t, (control >> 8) & 0xff));
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #define _bextr2_u64(a, control) simde_bextr2_u64(a, control)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_blsi_u32 (uint32_t a) {
+  #if defined(SIMDE_X86_BMI1_NATIVE)
+    return _blsi_u32(a);
+  #else
+    return a & (~a + 1);
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #define _blsi_u32(a) simde_blsi_u32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_blsi_u64 (uint64_t a) {
+  #if defined(SIMDE_X86_BMI1_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    return _blsi_u64(a);
+  #else
+    return a & (~a + 1);
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #define _blsi_u64(a) simde_blsi_u64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_blsmsk_u32 (uint32_t a) {
+  #if defined(SIMDE_X86_BMI1_NATIVE)
+    return _blsmsk_u32(a);
+  #else
+    return a ^ (a - 1);
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #define _blsmsk_u32(a) simde_blsmsk_u32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_blsmsk_u64 (uint64_t a) {
+  #if defined(SIMDE_X86_BMI1_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    return _blsmsk_u64(a);
+  #else
+    return a ^ (a - 1);
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #define _blsmsk_u64(a) simde_blsmsk_u64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_blsr_u32 (uint32_t a) {
+  #if defined(SIMDE_X86_BMI1_NATIVE)
+    return _blsr_u32(a);
+  #else
+    return a & (a - 1);
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #define _blsr_u32(a) simde_blsr_u32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_blsr_u64 (uint64_t a) {
+  #if defined(SIMDE_X86_BMI1_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    return _blsr_u64(a);
+  #else
+    return a & (a - 1);
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #define _blsr_u64(a) simde_blsr_u64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_tzcnt_u32 (uint32_t a) {
+  #if defined(SIMDE_X86_BMI1_NATIVE)
+    return _tzcnt_u32(a);
+  #else
+    return HEDLEY_LIKELY(a != 0) ? HEDLEY_STATIC_CAST(uint32_t, simde_x_ctz32(a)) : 32;
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #define _tzcnt_u32(a) simde_tzcnt_u32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_tzcnt_u64 (uint64_t a) {
+  #if defined(SIMDE_X86_BMI1_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    return _tzcnt_u64(a);
+  #else
+    return HEDLEY_LIKELY(a != 0) ? HEDLEY_STATIC_CAST(uint64_t, simde_x_ctz64(a)) : 64;
+  #endif
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #define _tzcnt_u64(a) simde_tzcnt_u64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm_tzcnt_32 (uint32_t a) {
+  return HEDLEY_STATIC_CAST(int32_t, simde_tzcnt_u32(a));
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #define _mm_tzcnt_32(a) simde_mm_tzcnt_32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm_tzcnt_64 (uint64_t a) {
+  return HEDLEY_STATIC_CAST(int64_t, simde_tzcnt_u64(a));
+}
+#if defined(SIMDE_X86_BMI1_ENABLE_NATIVE_ALIASES)
+  #define _mm_tzcnt_64(a) simde_mm_tzcnt_64(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_lzcnt_u32 (uint32_t a) {
+  #if defined(SIMDE_X86_LZCNT_NATIVE)
+    return _lzcnt_u32(a);
+  #else
+    return HEDLEY_LIKELY(a != 0) ? HEDLEY_STATIC_CAST(uint32_t, simde_x_clz32(a)) : 32;
+  #endif
+}
+#if defined(SIMDE_X86_LZCNT_ENABLE_NATIVE_ALIASES)
+  #define _lzcnt_u32(a) simde_lzcnt_u32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_lzcnt_u64 (uint64_t a) {
+  #if defined(SIMDE_X86_LZCNT_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    return _lzcnt_u64(a);
+  #else
+    return HEDLEY_LIKELY(a != 0) ? HEDLEY_STATIC_CAST(uint64_t, simde_x_clz64(a)) : 64;
+  #endif
+}
+#if defined(SIMDE_X86_LZCNT_ENABLE_NATIVE_ALIASES)
+  #define _lzcnt_u64(a) simde_lzcnt_u64(a)
+#endif
+
+SIMDE_END_DECLS_
+
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_BMI_H) */
@@ -0,0 +1,209 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#if !defined(SIMDE_X86_BMI2_H)
+#define SIMDE_X86_BMI2_H
+
+#include "bmi.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_bzhi_u32 (uint32_t a, uint32_t index) {
+  #if defined(SIMDE_X86_BMI2_NATIVE)
+    return _bzhi_u32(a, index);
+  #else
+    index &= 0xff;
+    return (index < 32) ? (a & ((UINT32_C(1) << index) - 1)) : a;
+  #endif
+}
+#if defined(SIMDE_X86_BMI2_ENABLE_NATIVE_ALIASES)
+  #define _bzhi_u32(a, index) simde_bzhi_u32(a, index)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_bzhi_u64 (uint64_t a, uint32_t index) {
+  #if defined(SIMDE_X86_BMI2_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    return _bzhi_u64(a, index);
+  #else
+    index &= 0xff;
+    return (index < 64) ? (a & ((UINT64_C(1) << index) - 1)) : a;
+  #endif
+}
+#if defined(SIMDE_X86_BMI2_ENABLE_NATIVE_ALIASES)
+  #define _bzhi_u64(a, index) simde_bzhi_u64(a, index)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_mulx_u32 (uint32_t a, uint32_t b, uint32_t* hi) {
+  /* GCC and clang only provide _mulx_u32 on 32-bit x86. */
+  #if defined(SIMDE_X86_BMI2_NATIVE) && (!defined(SIMDE_ARCH_AMD64) || defined(HEDLEY_MSVC_VERSION))
+    unsigned int hi_;
+    const uint32_t r = _mulx_u32(a, b, &hi_);
+    *hi = hi_;
+    return r;
+  #else
+    const uint64_t r = HEDLEY_STATIC_CAST(uint64_t, a) * HEDLEY_STATIC_CAST(uint64_t, b);
+    *hi = HEDLEY_STATIC_CAST(uint32_t, r >> 32);
+    return HEDLEY_STATIC_CAST(uint32_t, r);
+  #endif
+}
+#if defined(SIMDE_X86_BMI2_ENABLE_NATIVE_ALIASES)
+  #define _mulx_u32(a, b, hi) simde_mulx_u32(a, b, hi)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_mulx_u64 (uint64_t a, uint64_t b, uint64_t* hi) {
+  #if defined(SIMDE_X86_BMI2_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    unsigned long long hi_;
+    const uint64_t r = _mulx_u64(a, b, &hi_);
+    *hi = hi_;
+    return r;
+  #elif defined(SIMDE_HAVE_INT128_)
+    const simde_uint128 r = HEDLEY_STATIC_CAST(simde_uint128, a) * HEDLEY_STATIC_CAST(simde_uint128, b);
+    *hi = HEDLEY_STATIC_CAST(uint64_t, r >> 64);
+    return HEDLEY_STATIC_CAST(uint64_t, r);
+  #elif HEDLEY_MSVC_VERSION_CHECK(14,0,0) && defined(_M_AMD64)
+    return _umul128(a, b, hi);
+  #else
+    const uint64_t
+      a_lo = a & UINT64_C(0xffffffff), a_hi = a >> 32,
+      b_lo = b & UINT64_C(0xffffffff), b_hi = b >> 32;
+    const uint64_t
+      ll = a_lo * b_lo,
+      lh = a_lo * b_hi,
+      hl = a_hi * b_lo,
+      hh = a_hi * b_hi;
+    const uint64_t mid = (ll >> 32) + (lh & UINT64_C(0xffffffff)) + (hl & UINT64_C(0xffffffff));
+
+    *hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+    return (mid << 32) | (ll & UINT64_C(0xffffffff));
+  #endif
+}
+#if defined(SIMDE_X86_BMI2_ENABLE_NATIVE_ALIASES)
+  #define _mulx_u64(a, b, hi) simde_mulx_u64(a, b, hi)
+#endif
+
+/* The portable PDEP/PEXT implementations move one contiguous run of
+ * set bits in the mask per iteration instead of a single bit, so
+ * they take at most popcount(mask) iterations (and usually far fewer)
+ * rather than one per bit of the operand. */
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_pdep_u64 (uint64_t a, uint64_t mask) {
+  #if defined(SIMDE_X86_BMI2_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    return _pdep_u64(a, mask);
+  #else
+    uint64_t r = 0;
+    int i = 0;
+
+    if (HEDLEY_UNLIKELY(mask == ~UINT64_C(0)))
+      return a;
+
+    while (mask != 0) {
+      const int start = simde_x_ctz64(mask);
+      const int len = simde_x_ctz64(~(mask >> start));
+      const uint64_t run = (UINT64_C(1) << len) - 1;
+
+      r |= ((a >> i) & run) << start;
+      mask &= ~(run << start);
+      i += len;
+    }
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_X86_BMI2_ENABLE_NATIVE_ALIASES)
+  #define _pdep_u64(a, mask) simde_pdep_u64(a, mask)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_pdep_u32 (uint32_t a, uint32_t mask) {
+  #if defined(SIMDE_X86_BMI2_NATIVE)
+    return _pdep_u32(a, mask);
+  #else
+    return HEDLEY_STATIC_CAST(uint32_t, simde_pdep_u64(a, mask));
+  #endif
+}
+#if defined(SIMDE_X86_BMI2_ENABLE_NATIVE_ALIASES)
+  #define _pdep_u32(a, mask) simde_pdep_u32(a, mask)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint64_t
+simde_pext_u64 (uint64_t a, uint64_t mask) {
+  #if defined(SIMDE_X86_BMI2_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    return _pext_u64(a, mask);
+  #else
+    uint64_t r = 0;
+    int i = 0;
+
+    if (HEDLEY_UNLIKELY(mask == ~UINT64_C(0)))
+      return a;
+
+    while (mask != 0) {
+      const int start = simde_x_ctz64(mask);
+      const int len = simde_x_ctz64(~(mask >> start));
+      const uint64_t run = (UINT64_C(1) << len) - 1;
+
+      r |= ((a >> start) & run) << i;
+      mask &= ~(run << start);
+      i += len;
+    }
+
+    return r;
+  #endif
+}
+#if defined(SIMDE_X86_BMI2_ENABLE_NATIVE_ALIASES)
+  #define _pext_u64(a, mask) simde_pext_u64(a, mask)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_pext_u32 (uint32_t a, uint32_t mask) {
+  #if defined(SIMDE_X86_BMI2_NATIVE)
+    return _pext_u32(a, mask);
+  #else
+    return HEDLEY_STATIC_CAST(uint32_t, simde_pext_u64(a, mask));
+  #endif
+}
+#if defined(SIMDE_X86_BMI2_ENABLE_NATIVE_ALIASES)
+  #define _pext_u32(a, mask) simde_pext_u32(a, mask)
+#endif
+
+SIMDE_END_DECLS_
+
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_BMI2_H) */
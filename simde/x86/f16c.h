@@ -0,0 +1,376 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#if !defined(SIMDE_X86_F16C_H)
+#define SIMDE_X86_F16C_H
+
+#include "avx.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+/* The NEON conversions need the half-precision storage format, which
+ * is always present on AArch64 but optional on 32-bit ARM. */
+#if defined(SIMDE_ARM_NEON_A64V8_NATIVE) || (defined(SIMDE_ARM_NEON_A32V7_NATIVE) && defined(__ARM_FP) && (__ARM_FP & 2))
+  #define SIMDE_X86_F16C_NEON_FP16_
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_x_float16_to_float32 (uint16_t value) {
+  const uint32_t
+    sign = HEDLEY_STATIC_CAST(uint32_t, value & 0x8000) << 16,
+    em = HEDLEY_STATIC_CAST(uint32_t, value & 0x7fff);
+  uint32_t bits;
+  simde_float32 r;
+
+  if (em >= 0x7c00) {
+    /* Infinity or NaN; NaNs are quieted and keep their payload. */
+    bits = UINT32_C(0x7f800000) | ((em & 0x3ff) << 13) | ((em > 0x7c00) ? UINT32_C(0x00400000) : 0);
+  } else if (em >= 0x0400) {
+    bits = (em << 13) + (UINT32_C(112) << 23);
+  } else {
+    /* Zero or subnormal; em * 2^-24 is exact in binary32. */
+    r = HEDLEY_STATIC_CAST(simde_float32, em) * SIMDE_FLOAT32_C(5.9604644775390625e-08);
+    return sign ? -r : r;
+  }
+
+  bits |= sign;
+  simde_memcpy(&r, &bits, sizeof(r));
+  return r;
+}
+
+/* rounding is one of the SIMDE_MM_FROUND_TO_* values. */
+SIMDE_FUNCTION_ATTRIBUTES
+uint16_t
+simde_x_float32_to_float16 (simde_float32 value, int rounding) {
+  uint32_t bits, abs_, e, base, shift, q, rem, round_bit, sticky;
+  uint16_t sign;
+  int inc, to_inf;
+
+  simde_memcpy(&bits, &value, sizeof(bits));
+  sign = HEDLEY_STATIC_CAST(uint16_t, (bits >> 16) & 0x8000);
+  abs_ = bits & UINT32_C(0x7fffffff);
+
+  if (abs_ > UINT32_C(0x7f800000))
+    return HEDLEY_STATIC_CAST(uint16_t, sign | 0x7e00 | ((abs_ >> 13) & 0x3ff));
+  if (abs_ == UINT32_C(0x7f800000))
+    return HEDLEY_STATIC_CAST(uint16_t, sign | 0x7c00);
+
+  /* Results which are normal in binary16 only need the exponent
+   * rebiased; subnormal results shift the explicit mantissa right by
+   * up to 25 bits, which is enough to push every bit below the
+   * rounding position. */
+  e = abs_ >> 23;
+  if (e > 112) {
+    base = abs_ - (UINT32_C(112) << 23);
+    shift = 13;
+  } else {
+    base = (abs_ & UINT32_C(0x7fffff)) | ((e != 0) ? UINT32_C(0x800000) : 0);
+    shift = (e < 101) ? 25 : (126 - e);
+  }
+
+  q = base >> shift;
+  rem = base - (q << shift);
+  round_bit = (rem >> (shift - 1)) & 1;
+  sticky = (rem - (round_bit << (shift - 1))) != 0;
+
+  switch (rounding & 3) {
+    case SIMDE_MM_FROUND_TO_NEAREST_INT:
+      inc = round_bit && (sticky || (q & 1));
+      to_inf = 1;
+      break;
+    case SIMDE_MM_FROUND_TO_NEG_INF:
+      inc = sign && (rem != 0);
+      to_inf = sign != 0;
+      break;
+    case SIMDE_MM_FROUND_TO_POS_INF:
+      inc = !sign && (rem != 0);
+      to_inf = sign == 0;
+      break;
+    default:
+      inc = 0;
+      to_inf = 0;
+      break;
+  }
+
+  q += HEDLEY_STATIC_CAST(uint32_t, inc);
+  if (q > 0x7bff)
+    q = to_inf ? 0x7c00 : 0x7bff;
+
+  return HEDLEY_STATIC_CAST(uint16_t, sign | q);
+}
+
+/* Convert the binary16 values held in the low 16 bits of each 32-bit
+ * lane of a to single precision. */
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_x_mm_cvtph32_ps (simde__m128i a) {
+  simde__m128_private r_;
+  simde__m128i_private a_ = simde__m128i_to_private(a);
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    simde__m128_private d_;
+    __typeof__(r_.u32) em, e, infnan, nan, zero, denorm;
+
+    em = a_.u32 & UINT32_C(0x7fff);
+    r_.u32 = em << 13;
+    e = r_.u32 & UINT32_C(0x0f800000);
+    r_.u32 += UINT32_C(112) << 23;
+
+    infnan = HEDLEY_STATIC_CAST(__typeof__(infnan), e == UINT32_C(0x0f800000));
+    nan = HEDLEY_STATIC_CAST(__typeof__(nan), em > UINT32_C(0x7c00));
+    r_.u32 += infnan & (UINT32_C(112) << 23);
+    r_.u32 |= nan & UINT32_C(0x00400000);
+
+    /* Subnormals: build 2^-14 * (1 + m / 1024) and subtract 2^-14,
+     * which is exact.  Zero is masked separately so the sign of the
+     * difference never depends on the rounding mode. */
+    zero = HEDLEY_STATIC_CAST(__typeof__(zero), em == 0);
+    denorm = HEDLEY_STATIC_CAST(__typeof__(denorm), e == 0) & ~zero;
+    d_.u32 = r_.u32 + (UINT32_C(1) << 23);
+    d_.f32 -= SIMDE_FLOAT32_C(6.103515625e-05);
+    r_.u32 = ((denorm & d_.u32) | (~denorm & r_.u32)) & ~zero;
+
+    r_.u32 |= (a_.u32 & UINT32_C(0x8000)) << 16;
+  #else
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+      r_.f32[i] = simde_x_float16_to_float32(HEDLEY_STATIC_CAST(uint16_t, a_.u32[i]));
+    }
+  #endif
+
+  return simde__m128_from_private(r_);
+}
+
+/* Convert each lane of a to binary16, leaving the result in the low
+ * 16 bits of the corresponding 32-bit lane.  rounding is one of the
+ * SIMDE_MM_FROUND_TO_* values; the rounding mode is the same for all
+ * lanes, so the only data-dependent control flow is lane masks. */
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_mm_cvtps_ph32 (simde__m128 a, int rounding) {
+  simde__m128i_private r_;
+  simde__m128_private a_ = simde__m128_to_private(a);
+
+  #if defined(SIMDE_VECTOR_SUBSCRIPT_SCALAR)
+    __typeof__(r_.u32) sign, abs_, e, norm, wide, base, shift, rem, round_bit, sticky, inexact, inc, ovf, to_inf, nan;
+
+    sign = a_.u32 >> 31;
+    abs_ = a_.u32 & UINT32_C(0x7fffffff);
+    e = abs_ >> 23;
+
+    norm = HEDLEY_STATIC_CAST(__typeof__(norm), e > 112);
+    wide = HEDLEY_STATIC_CAST(__typeof__(wide), e < 101);
+    base =
+      (norm & (abs_ - (UINT32_C(112) << 23))) |
+      (~norm & ((abs_ & UINT32_C(0x7fffff)) | (HEDLEY_STATIC_CAST(__typeof__(e), e != 0) & UINT32_C(0x800000))));
+    shift = (norm & 13) | (~norm & ((wide & 25) | (~wide & (126 - e))));
+
+    r_.u32 = base >> shift;
+    rem = base - (r_.u32 << shift);
+    round_bit = (rem >> (shift - 1)) & 1;
+    sticky = HEDLEY_STATIC_CAST(__typeof__(sticky), (rem - (round_bit << (shift - 1))) != 0) & 1;
+    inexact = HEDLEY_STATIC_CAST(__typeof__(inexact), rem != 0) & 1;
+
+    /* inc and to_inf are 0/1 per lane. */
+    switch (rounding & 3) {
+      case SIMDE_MM_FROUND_TO_NEAREST_INT:
+        inc = round_bit & (sticky | r_.u32);
+        to_inf = sign | 1;
+        break;
+      case SIMDE_MM_FROUND_TO_NEG_INF:
+        inc = inexact & sign;
+        to_inf = sign;
+        break;
+      case SIMDE_MM_FROUND_TO_POS_INF:
+        inc = inexact & (sign ^ 1);
+        to_inf = sign ^ 1;
+        break;
+      default:
+        inc = sign & 0;
+        to_inf = sign & 0;
+        break;
+    }
+
+    r_.u32 += inc & 1;
+
+    /* Finite values which round past the largest binary16 value become
+     * infinity or saturate depending on the rounding direction;
+     * infinite inputs always stay infinite. */
+    to_inf |= HEDLEY_STATIC_CAST(__typeof__(to_inf), abs_ == UINT32_C(0x7f800000)) & 1;
+    ovf = HEDLEY_STATIC_CAST(__typeof__(ovf), r_.u32 > UINT32_C(0x7bff));
+    r_.u32 = (~ovf & r_.u32) | (ovf & (UINT32_C(0x7bff) + (to_inf & 1)));
+
+    nan = HEDLEY_STATIC_CAST(__typeof__(nan), abs_ > UINT32_C(0x7f800000));
+    r_.u32 = (~nan & r_.u32) | (nan & (UINT32_C(0x7e00) | ((abs_ >> 13) & UINT32_C(0x3ff))));
+
+    r_.u32 |= sign << 15;
+  #else
+    SIMDE_VECTORIZE
+    for (size_t i = 0 ; i < (sizeof(r_.u32) / sizeof(r_.u32[0])) ; i++) {
+      r_.u32[i] = simde_x_float32_to_float16(a_.f32[i], rounding);
+    }
+  #endif
+
+  return simde__m128i_from_private(r_);
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde_float32
+simde_cvtsh_ss (uint16_t a) {
+  #if defined(SIMDE_X86_F16C_NATIVE)
+    return _cvtsh_ss(a);
+  #else
+    return simde_x_float16_to_float32(a);
+  #endif
+}
+#if defined(SIMDE_X86_F16C_ENABLE_NATIVE_ALIASES)
+  #undef _cvtsh_ss
+  #define _cvtsh_ss(a) simde_cvtsh_ss(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint16_t
+simde_cvtss_sh (simde_float32 a, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 15) {
+  const int rounding = (imm8 & SIMDE_MM_FROUND_CUR_DIRECTION) ? HEDLEY_STATIC_CAST(int, SIMDE_MM_GET_ROUNDING_MODE() >> 13) : imm8;
+  return simde_x_float32_to_float16(a, rounding);
+}
+#if defined(SIMDE_X86_F16C_NATIVE)
+  #define simde_cvtss_sh(a, imm8) _cvtss_sh(a, imm8)
+#endif
+#if defined(SIMDE_X86_F16C_ENABLE_NATIVE_ALIASES)
+  #undef _cvtss_sh
+  #define _cvtss_sh(a, imm8) simde_cvtss_sh(a, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_mm_cvtph_ps (simde__m128i a) {
+  #if defined(SIMDE_X86_F16C_NATIVE)
+    return _mm_cvtph_ps(a);
+  #elif defined(SIMDE_X86_F16C_NEON_FP16_)
+    simde__m128_private r_;
+    simde__m128i_private a_ = simde__m128i_to_private(a);
+
+    r_.neon_f32 = vcvt_f32_f16(vreinterpret_f16_u16(vget_low_u16(a_.neon_u16)));
+
+    return simde__m128_from_private(r_);
+  #else
+    return simde_x_mm_cvtph32_ps(simde_mm_unpacklo_epi16(a, simde_mm_setzero_si128()));
+  #endif
+}
+#if defined(SIMDE_X86_F16C_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cvtph_ps
+  #define _mm_cvtph_ps(a) simde_mm_cvtph_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_mm256_cvtph_ps (simde__m128i a) {
+  #if defined(SIMDE_X86_F16C_NATIVE)
+    return _mm256_cvtph_ps(a);
+  #elif defined(SIMDE_X86_F16C_NEON_FP16_)
+    simde__m256_private r_;
+    simde__m128i_private a_ = simde__m128i_to_private(a);
+
+    r_.m128_private[0].neon_f32 = vcvt_f32_f16(vreinterpret_f16_u16(vget_low_u16(a_.neon_u16)));
+    r_.m128_private[1].neon_f32 = vcvt_f32_f16(vreinterpret_f16_u16(vget_high_u16(a_.neon_u16)));
+
+    return simde__m256_from_private(r_);
+  #else
+    const simde__m128i zero = simde_mm_setzero_si128();
+    return simde_mm256_set_m128(
+      simde_x_mm_cvtph32_ps(simde_mm_unpackhi_epi16(a, zero)),
+      simde_x_mm_cvtph32_ps(simde_mm_unpacklo_epi16(a, zero)));
+  #endif
+}
+#if defined(SIMDE_X86_F16C_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_cvtph_ps
+  #define _mm256_cvtph_ps(a) simde_mm256_cvtph_ps(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_cvtps_ph (simde__m128 a, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 15) {
+  const int rounding = (imm8 & SIMDE_MM_FROUND_CUR_DIRECTION) ? HEDLEY_STATIC_CAST(int, SIMDE_MM_GET_ROUNDING_MODE() >> 13) : (imm8 & 3);
+
+  #if defined(SIMDE_X86_F16C_NEON_FP16_)
+    /* vcvt_f16_f32 always honours the FPCR rounding mode. */
+    if ((imm8 & SIMDE_MM_FROUND_CUR_DIRECTION) || (HEDLEY_STATIC_CAST(unsigned int, rounding) << 13) == SIMDE_MM_GET_ROUNDING_MODE()) {
+      simde__m128i_private r_;
+      simde__m128_private a_ = simde__m128_to_private(a);
+
+      r_.neon_u16 = vcombine_u16(vreinterpret_u16_f16(vcvt_f16_f32(a_.neon_f32)), vdup_n_u16(0));
+
+      return simde__m128i_from_private(r_);
+    }
+  #endif
+
+  return simde_mm_packus_epi32(simde_x_mm_cvtps_ph32(a, rounding), simde_mm_setzero_si128());
+}
+#if defined(SIMDE_X86_F16C_NATIVE)
+  #define simde_mm_cvtps_ph(a, imm8) _mm_cvtps_ph(a, imm8)
+#endif
+#if defined(SIMDE_X86_F16C_ENABLE_NATIVE_ALIASES)
+  #undef _mm_cvtps_ph
+  #define _mm_cvtps_ph(a, imm8) simde_mm_cvtps_ph(a, imm8)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm256_cvtps_ph (simde__m256 a, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 0, 15) {
+  simde__m256_private a_ = simde__m256_to_private(a);
+
+  #if defined(SIMDE_X86_F16C_NEON_FP16_)
+    return simde_mm_unpacklo_epi64(
+      simde_mm_cvtps_ph(simde__m128_from_private(a_.m128_private[0]), imm8),
+      simde_mm_cvtps_ph(simde__m128_from_private(a_.m128_private[1]), imm8));
+  #else
+    const int rounding = (imm8 & SIMDE_MM_FROUND_CUR_DIRECTION) ? HEDLEY_STATIC_CAST(int, SIMDE_MM_GET_ROUNDING_MODE() >> 13) : (imm8 & 3);
+
+    return simde_mm_packus_epi32(
+      simde_x_mm_cvtps_ph32(simde__m128_from_private(a_.m128_private[0]), rounding),
+      simde_x_mm_cvtps_ph32(simde__m128_from_private(a_.m128_private[1]), rounding));
+  #endif
+}
+#if defined(SIMDE_X86_F16C_NATIVE)
+  #define simde_mm256_cvtps_ph(a, imm8) _mm256_cvtps_ph(a, imm8)
+#endif
+#if defined(SIMDE_X86_F16C_ENABLE_NATIVE_ALIASES)
+  #undef _mm256_cvtps_ph
+  #define _mm256_cvtps_ph(a, imm8) simde_mm256_cvtps_ph(a, imm8)
+#endif
+
+SIMDE_END_DECLS_
+
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_F16C_H) */
@@ -0,0 +1,84 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#if !defined(SIMDE_X86_POPCNT_H)
+#define SIMDE_X86_POPCNT_H
+
+#include "../simde-common.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+int32_t
+simde_mm_popcnt_u32 (uint32_t a) {
+  #if defined(SIMDE_X86_POPCNT_NATIVE)
+    return _mm_popcnt_u32(a);
+  #elif \
+      HEDLEY_HAS_BUILTIN(__builtin_popcount) || \
+      HEDLEY_GCC_VERSION_CHECK(3,4,0) || \
+      HEDLEY_ARM_VERSION_CHECK(4,1,0) || \
+      HEDLEY_INTEL_VERSION_CHECK(13,0,0)
+    return __builtin_popcount(HEDLEY_STATIC_CAST(unsigned int, a));
+  #else
+    a -= (a >> 1) & UINT32_C(0x55555555);
+    a = (a & UINT32_C(0x33333333)) + ((a >> 2) & UINT32_C(0x33333333));
+    a = (a + (a >> 4)) & UINT32_C(0x0f0f0f0f);
+    return HEDLEY_STATIC_CAST(int32_t, (a * UINT32_C(0x01010101)) >> 24);
+  #endif
+}
+#if defined(SIMDE_X86_POPCNT_ENABLE_NATIVE_ALIASES)
+  #define _mm_popcnt_u32(a) simde_mm_popcnt_u32(a)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+int64_t
+simde_mm_popcnt_u64 (uint64_t a) {
+  #if defined(SIMDE_X86_POPCNT_NATIVE) && defined(SIMDE_ARCH_AMD64)
+    return _mm_popcnt_u64(a);
+  #elif \
+      HEDLEY_HAS_BUILTIN(__builtin_popcountll) || \
+      HEDLEY_GCC_VERSION_CHECK(3,4,0) || \
+      HEDLEY_ARM_VERSION_CHECK(4,1,0) || \
+      HEDLEY_INTEL_VERSION_CHECK(13,0,0)
+    return __builtin_popcountll(HEDLEY_STATIC_CAST(unsigned long long, a));
+  #else
+    a -= (a >> 1) & UINT64_C(0x5555555555555555);
+    a = (a & UINT64_C(0x3333333333333333)) + ((a >> 2) & UINT64_C(0x3333333333333333));
+    a = (a + (a >> 4)) & UINT64_C(0x0f0f0f0f0f0f0f0f);
+    return HEDLEY_STATIC_CAST(int64_t, (a * UINT64_C(0x0101010101010101)) >> 56);
+  #endif
+}
+#if defined(SIMDE_X86_POPCNT_ENABLE_NATIVE_ALIASES)
+  #define _mm_popcnt_u64(a) simde_mm_popcnt_u64(a)
+#endif
+
+SIMDE_END_DECLS_
+
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_POPCNT_H) */
@@ -0,0 +1,328 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+/* The x86 SHA extensions keep the state in a different order than
+ * the ARMv8 ones (for SHA-1, A is in the most significant element
+ * instead of the least significant one, and for SHA-256 the state is
+ * split into ABEF and CDGH instead of ABCD and EFGH).  SHA256RNDS2
+ * also only does two rounds while SHA256H does four, so there is no
+ * reasonable way to map it to ARM; only the functions which line up
+ * are implemented using the ARM instructions. */
+
+#if !defined(SIMDE_X86_SHA_H)
+#define SIMDE_X86_SHA_H
+
+#include "sse2.h"
+
+HEDLEY_DIAGNOSTIC_PUSH
+SIMDE_DISABLE_UNWANTED_DIAGNOSTICS
+SIMDE_BEGIN_DECLS_
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_sha_rol_epi32_ (simde__m128i a, const int imm8)
+    SIMDE_REQUIRE_CONSTANT_RANGE(imm8, 1, 31) {
+  return simde_mm_or_si128(simde_mm_slli_epi32(a, imm8), simde_mm_srli_epi32(a, 32 - imm8));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_x_sha_rol_u32_ (uint32_t a, const int imm8) {
+  return HEDLEY_STATIC_CAST(uint32_t, (a << imm8) | (a >> (32 - imm8)));
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+uint32_t
+simde_x_sha_ror_u32_ (uint32_t a, const int imm8) {
+  return HEDLEY_STATIC_CAST(uint32_t, (a >> imm8) | (a << (32 - imm8)));
+}
+
+#if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
+/* Reverses the order of the 32-bit elements. */
+SIMDE_FUNCTION_ATTRIBUTES
+uint32x4_t
+simde_x_sha_neon_reverse_ (uint32x4_t a) {
+  a = vrev64q_u32(a);
+  return vextq_u32(a, a, 2);
+}
+#endif
+
+/* sigma0 from the SHA-256 message schedule: ror 7 ^ ror 18 ^ shr 3 */
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_sha256_sigma0_ (simde__m128i x) {
+  return
+    simde_mm_xor_si128(
+      simde_mm_xor_si128(
+        simde_mm_srli_epi32(x, 3),
+        simde_mm_xor_si128(simde_mm_srli_epi32(x, 7), simde_mm_slli_epi32(x, 25))
+      ),
+      simde_mm_xor_si128(simde_mm_srli_epi32(x, 18), simde_mm_slli_epi32(x, 14))
+    );
+}
+
+/* sigma1 from the SHA-256 message schedule: ror 17 ^ ror 19 ^ shr 10 */
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_x_sha256_sigma1_ (simde__m128i x) {
+  return
+    simde_mm_xor_si128(
+      simde_mm_xor_si128(
+        simde_mm_srli_epi32(x, 10),
+        simde_mm_xor_si128(simde_mm_srli_epi32(x, 17), simde_mm_slli_epi32(x, 15))
+      ),
+      simde_mm_xor_si128(simde_mm_srli_epi32(x, 19), simde_mm_slli_epi32(x, 13))
+    );
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha1msg1_epu32 (simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_X86_SHA_NATIVE)
+    return _mm_sha1msg1_epu32(a, b);
+  #else
+    /* { W0 ^ W2, W1 ^ W3, W2 ^ W4, W3 ^ W5 }, with W0 in the high
+     * element of a. */
+    return simde_mm_xor_si128(a, simde_mm_unpacklo_epi64(simde_mm_unpackhi_epi64(b, b), a));
+  #endif
+}
+#if defined(SIMDE_X86_SHA_ENABLE_NATIVE_ALIASES)
+  #define _mm_sha1msg1_epu32(a, b) simde_mm_sha1msg1_epu32(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha1msg2_epu32 (simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_X86_SHA_NATIVE)
+    return _mm_sha1msg2_epu32(a, b);
+  #else
+    /* W19 depends on W16, which is computed in the high element; since
+     * rotation distributes over xor it can be fixed up afterwards. */
+    simde__m128i r = simde_x_sha_rol_epi32_(simde_mm_xor_si128(a, simde_mm_slli_si128(b, 4)), 1);
+    return simde_mm_xor_si128(r, simde_x_sha_rol_epi32_(simde_mm_srli_si128(r, 12), 1));
+  #endif
+}
+#if defined(SIMDE_X86_SHA_ENABLE_NATIVE_ALIASES)
+  #define _mm_sha1msg2_epu32(a, b) simde_mm_sha1msg2_epu32(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha1nexte_epu32 (simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_X86_SHA_NATIVE)
+    return _mm_sha1nexte_epu32(a, b);
+  #else
+    const simde__m128i e = simde_mm_and_si128(a, simde_mm_set_epi32(~INT32_C(0), 0, 0, 0));
+    return simde_mm_add_epi32(b, simde_x_sha_rol_epi32_(e, 30));
+  #endif
+}
+#if defined(SIMDE_X86_SHA_ENABLE_NATIVE_ALIASES)
+  #define _mm_sha1nexte_epu32(a, b) simde_mm_sha1nexte_epu32(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha1rnds4_epu32 (simde__m128i a, simde__m128i b, const int func)
+    SIMDE_REQUIRE_CONSTANT_RANGE(func, 0, 3) {
+  const uint32_t k =
+    ((func & 3) == 0) ? UINT32_C(0x5a827999) :
+    ((func & 3) == 1) ? UINT32_C(0x6ed9eba1) :
+    ((func & 3) == 2) ? UINT32_C(0x8f1bbcdc) :
+                        UINT32_C(0xca62c1d6);
+  simde__m128i_private
+    r_,
+    a_ = simde__m128i_to_private(a),
+    b_ = simde__m128i_to_private(b);
+
+  #if defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
+    /* The Intel instruction expects E to already be added to W0 (by
+     * SHA1NEXTE), so pass 0 for e. */
+    const uint32x4_t abcd = simde_x_sha_neon_reverse_(a_.neon_u32);
+    const uint32x4_t wk = vaddq_u32(simde_x_sha_neon_reverse_(b_.neon_u32), vdupq_n_u32(k));
+    switch (func & 3) {
+      case 0:
+        r_.neon_u32 = vsha1cq_u32(abcd, 0, wk);
+        break;
+      case 2:
+        r_.neon_u32 = vsha1mq_u32(abcd, 0, wk);
+        break;
+      default:
+        r_.neon_u32 = vsha1pq_u32(abcd, 0, wk);
+        break;
+    }
+    r_.neon_u32 = simde_x_sha_neon_reverse_(r_.neon_u32);
+  #else
+    uint32_t
+      A = a_.u32[3],
+      B = a_.u32[2],
+      C = a_.u32[1],
+      D = a_.u32[0],
+      E = 0;
+
+    for (int i = 3 ; i >= 0 ; i--) {
+      uint32_t f;
+      switch (func & 3) {
+        case 0:
+          f = (B & C) ^ (~B & D);
+          break;
+        case 2:
+          f = (B & C) ^ (B & D) ^ (C & D);
+          break;
+        default:
+          f = B ^ C ^ D;
+          break;
+      }
+
+      const uint32_t T = simde_x_sha_rol_u32_(A, 5) + f + E + b_.u32[i] + k;
+      E = D;
+      D = C;
+      C = simde_x_sha_rol_u32_(B, 30);
+      B = A;
+      A = T;
+    }
+
+    r_.u32[3] = A;
+    r_.u32[2] = B;
+    r_.u32[1] = C;
+    r_.u32[0] = D;
+  #endif
+
+  return simde__m128i_from_private(r_);
+}
+#if defined(SIMDE_X86_SHA_NATIVE)
+  #define simde_mm_sha1rnds4_epu32(a, b, func) _mm_sha1rnds4_epu32(a, b, func)
+#endif
+#if defined(SIMDE_X86_SHA_ENABLE_NATIVE_ALIASES)
+  #define _mm_sha1rnds4_epu32(a, b, func) simde_mm_sha1rnds4_epu32(a, b, func)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha256msg1_epu32 (simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_X86_SHA_NATIVE)
+    return _mm_sha256msg1_epu32(a, b);
+  #elif defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      b_ = simde__m128i_to_private(b);
+
+    r_.neon_u32 = vsha256su0q_u32(a_.neon_u32, b_.neon_u32);
+
+    return simde__m128i_from_private(r_);
+  #else
+    /* { W0 + s0(W1), W1 + s0(W2), W2 + s0(W3), W3 + s0(W4) } */
+    const simde__m128i w1 = simde_mm_or_si128(simde_mm_srli_si128(a, 4), simde_mm_slli_si128(b, 12));
+    return simde_mm_add_epi32(a, simde_x_sha256_sigma0_(w1));
+  #endif
+}
+#if defined(SIMDE_X86_SHA_ENABLE_NATIVE_ALIASES)
+  #define _mm_sha256msg1_epu32(a, b) simde_mm_sha256msg1_epu32(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha256msg2_epu32 (simde__m128i a, simde__m128i b) {
+  #if defined(SIMDE_X86_SHA_NATIVE)
+    return _mm_sha256msg2_epu32(a, b);
+  #elif defined(SIMDE_ARM_NEON_A32V8_NATIVE) && defined(__ARM_FEATURE_SHA2)
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      b_ = simde__m128i_to_private(b);
+
+    /* SHA256SU1 also adds W[t-7]; passing zeros for W9..W12 makes it
+     * compute the same thing as SHA256MSG2. */
+    r_.neon_u32 = vsha256su1q_u32(a_.neon_u32, vdupq_n_u32(0), vsetq_lane_u32(0, b_.neon_u32, 0));
+
+    return simde__m128i_from_private(r_);
+  #else
+    /* W16 and W17 depend on W14 and W15 (the high half of b), W18 and
+     * W19 depend on W16 and W17. */
+    const simde__m128i r = simde_mm_add_epi32(a, simde_x_sha256_sigma1_(simde_mm_srli_si128(b, 8)));
+    return simde_mm_add_epi32(r, simde_x_sha256_sigma1_(simde_mm_slli_si128(r, 8)));
+  #endif
+}
+#if defined(SIMDE_X86_SHA_ENABLE_NATIVE_ALIASES)
+  #define _mm_sha256msg2_epu32(a, b) simde_mm_sha256msg2_epu32(a, b)
+#endif
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128i
+simde_mm_sha256rnds2_epu32 (simde__m128i a, simde__m128i b, simde__m128i k) {
+  #if defined(SIMDE_X86_SHA_NATIVE)
+    return _mm_sha256rnds2_epu32(a, b, k);
+  #else
+    simde__m128i_private
+      r_,
+      a_ = simde__m128i_to_private(a),
+      b_ = simde__m128i_to_private(b),
+      k_ = simde__m128i_to_private(k);
+
+    uint32_t
+      A = b_.u32[3],
+      B = b_.u32[2],
+      C = a_.u32[3],
+      D = a_.u32[2],
+      E = b_.u32[1],
+      F = b_.u32[0],
+      G = a_.u32[1],
+      H = a_.u32[0];
+
+    for (size_t i = 0 ; i < 2 ; i++) {
+      const uint32_t S1 = simde_x_sha_ror_u32_(E, 6) ^ simde_x_sha_ror_u32_(E, 11) ^ simde_x_sha_ror_u32_(E, 25);
+      const uint32_t ch = (E & F) ^ (~E & G);
+      const uint32_t T1 = H + S1 + ch + k_.u32[i];
+      const uint32_t S0 = simde_x_sha_ror_u32_(A, 2) ^ simde_x_sha_ror_u32_(A, 13) ^ simde_x_sha_ror_u32_(A, 22);
+      const uint32_t maj = (A & B) ^ (A & C) ^ (B & C);
+
+      H = G;
+      G = F;
+      F = E;
+      E = D + T1;
+      D = C;
+      C = B;
+      B = A;
+      A = T1 + S0 + maj;
+    }
+
+    r_.u32[3] = A;
+    r_.u32[2] = B;
+    r_.u32[1] = E;
+    r_.u32[0] = F;
+
+    return simde__m128i_from_private(r_);
+  #endif
+}
+#if defined(SIMDE_X86_SHA_ENABLE_NATIVE_ALIASES)
+  #define _mm_sha256rnds2_epu32(a, b, k) simde_mm_sha256rnds2_epu32(a, b, k)
+#endif
+
+SIMDE_END_DECLS_
+
+HEDLEY_DIAGNOSTIC_POP
+
+#endif /* !defined(SIMDE_X86_SHA_H) */
@@ -321,6 +321,10 @@ simde_mm_shuffle_epi8 (simde__m128i a, simde__m128i b) {
       SIMDE_POWER_ALTIVEC_VECTOR(signed char) msb_mask = HEDLEY_REINTERPRET_CAST(SIMDE_POWER_ALTIVEC_VECTOR(signed char), vec_cmplt(b_.altivec_i8, z));
       SIMDE_POWER_ALTIVEC_VECTOR(signed char) c = vec_perm(a_.altivec_i8, a_.altivec_i8, HEDLEY_REINTERPRET_CAST(SIMDE_POWER_ALTIVEC_VECTOR(unsigned char), b_.altivec_i8));
       r_.altivec_i8 = vec_sel(c, z, HEDLEY_REINTERPRET_CAST(SIMDE_POWER_ALTIVEC_VECTOR(unsigned char), msb_mask));
+    #elif defined(SIMDE_WASM_SIMD128_NATIVE)
+      /* swizzle returns 0 for any index above 15, so keeping the high
+       * bit zeroes the same lanes PSHUFB does. */
+      r_.wasm_v128 = wasm_v8x16_swizzle(a_.wasm_v128, wasm_v128_and(b_.wasm_v128, wasm_i8x16_splat(HEDLEY_STATIC_CAST(int8_t, 0x8f))));
     #else
       for (size_t i = 0 ; i < (sizeof(r_.i8) / sizeof(r_.i8[0])) ; i++) {
         r_.i8[i] = a_.i8[b_.i8[i] & 15] & (~(b_.i8[i]) >> 7);
@@ -59,6 +59,184 @@ SIMDE_BEGIN_DECLS_
 #  define SIMDE_X86_SVML_ENABLE_NATIVE_ALIASES
 #endif
 
+/* Multiply-add for the polynomial kernels (sin, cos, exp and log).
+ * Without native FMA, simde_mm_fmadd_ps is a loop calling fmaf for
+ * each lane on targets with 128-bit vectors, which costs more than
+ * the libm call the kernels are meant to replace, so use the vector
+ * FMA if there is one and a separate multiply and add otherwise. */
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_x_mm_svml_fmadd_ps (simde__m128 a, simde__m128 b, simde__m128 c) {
+  #if defined(SIMDE_X86_FMA_NATIVE)
+    return simde_mm_fmadd_ps(a, b, c);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE) || defined(SIMDE_POWER_ALTIVEC_P7_NATIVE)
+    simde__m128_private
+      r_,
+      a_ = simde__m128_to_private(a),
+      b_ = simde__m128_to_private(b),
+      c_ = simde__m128_to_private(c);
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      r_.neon_f32 = vfmaq_f32(c_.neon_f32, a_.neon_f32, b_.neon_f32);
+    #else
+      r_.altivec_f32 = vec_madd(a_.altivec_f32, b_.altivec_f32, c_.altivec_f32);
+    #endif
+
+    return simde__m128_from_private(r_);
+  #else
+    return simde_mm_add_ps(simde_mm_mul_ps(a, b), c);
+  #endif
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128
+simde_x_mm_svml_fnmadd_ps (simde__m128 a, simde__m128 b, simde__m128 c) {
+  #if defined(SIMDE_X86_FMA_NATIVE)
+    return simde_mm_fnmadd_ps(a, b, c);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE) || defined(SIMDE_POWER_ALTIVEC_P7_NATIVE)
+    simde__m128_private
+      r_,
+      a_ = simde__m128_to_private(a),
+      b_ = simde__m128_to_private(b),
+      c_ = simde__m128_to_private(c);
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      r_.neon_f32 = vfmsq_f32(c_.neon_f32, a_.neon_f32, b_.neon_f32);
+    #else
+      r_.altivec_f32 = vec_nmsub(a_.altivec_f32, b_.altivec_f32, c_.altivec_f32);
+    #endif
+
+    return simde__m128_from_private(r_);
+  #else
+    return simde_mm_sub_ps(c, simde_mm_mul_ps(a, b));
+  #endif
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_x_mm_svml_fmadd_pd (simde__m128d a, simde__m128d b, simde__m128d c) {
+  #if defined(SIMDE_X86_FMA_NATIVE)
+    return simde_mm_fmadd_pd(a, b, c);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE) || defined(SIMDE_POWER_ALTIVEC_P7_NATIVE)
+    simde__m128d_private
+      r_,
+      a_ = simde__m128d_to_private(a),
+      b_ = simde__m128d_to_private(b),
+      c_ = simde__m128d_to_private(c);
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      r_.neon_f64 = vfmaq_f64(c_.neon_f64, a_.neon_f64, b_.neon_f64);
+    #else
+      r_.altivec_f64 = vec_madd(a_.altivec_f64, b_.altivec_f64, c_.altivec_f64);
+    #endif
+
+    return simde__m128d_from_private(r_);
+  #else
+    return simde_mm_add_pd(simde_mm_mul_pd(a, b), c);
+  #endif
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_x_mm_svml_fnmadd_pd (simde__m128d a, simde__m128d b, simde__m128d c) {
+  #if defined(SIMDE_X86_FMA_NATIVE)
+    return simde_mm_fnmadd_pd(a, b, c);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE) || defined(SIMDE_POWER_ALTIVEC_P7_NATIVE)
+    simde__m128d_private
+      r_,
+      a_ = simde__m128d_to_private(a),
+      b_ = simde__m128d_to_private(b),
+      c_ = simde__m128d_to_private(c);
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      r_.neon_f64 = vfmsq_f64(c_.neon_f64, a_.neon_f64, b_.neon_f64);
+    #else
+      r_.altivec_f64 = vec_nmsub(a_.altivec_f64, b_.altivec_f64, c_.altivec_f64);
+    #endif
+
+    return simde__m128d_from_private(r_);
+  #else
+    return simde_mm_sub_pd(c, simde_mm_mul_pd(a, b));
+  #endif
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m128d
+simde_x_mm_svml_fmsub_pd (simde__m128d a, simde__m128d b, simde__m128d c) {
+  #if defined(SIMDE_X86_FMA_NATIVE)
+    return simde_mm_fmsub_pd(a, b, c);
+  #elif defined(SIMDE_ARM_NEON_A64V8_NATIVE) || defined(SIMDE_POWER_ALTIVEC_P7_NATIVE)
+    simde__m128d_private
+      r_,
+      a_ = simde__m128d_to_private(a),
+      b_ = simde__m128d_to_private(b),
+      c_ = simde__m128d_to_private(c);
+
+    #if defined(SIMDE_ARM_NEON_A64V8_NATIVE)
+      r_.neon_f64 = vfmaq_f64(vnegq_f64(c_.neon_f64), a_.neon_f64, b_.neon_f64);
+    #else
+      r_.altivec_f64 = vec_msub(a_.altivec_f64, b_.altivec_f64, c_.altivec_f64);
+    #endif
+
+    return simde__m128d_from_private(r_);
+  #else
+    return simde_mm_sub_pd(simde_mm_mul_pd(a, b), c);
+  #endif
+}
+
+/* The 256-bit kernels are only used with 256-bit natural vectors
+ * (i.e., AVX), where the multiply and add are vectorized even without
+ * FMA. */
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_x_mm256_svml_fmadd_ps (simde__m256 a, simde__m256 b, simde__m256 c) {
+  #if defined(SIMDE_X86_FMA_NATIVE)
+    return simde_mm256_fmadd_ps(a, b, c);
+  #else
+    return simde_mm256_add_ps(simde_mm256_mul_ps(a, b), c);
+  #endif
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256
+simde_x_mm256_svml_fnmadd_ps (simde__m256 a, simde__m256 b, simde__m256 c) {
+  #if defined(SIMDE_X86_FMA_NATIVE)
+    return simde_mm256_fnmadd_ps(a, b, c);
+  #else
+    return simde_mm256_sub_ps(c, simde_mm256_mul_ps(a, b));
+  #endif
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_x_mm256_svml_fmadd_pd (simde__m256d a, simde__m256d b, simde__m256d c) {
+  #if defined(SIMDE_X86_FMA_NATIVE)
+    return simde_mm256_fmadd_pd(a, b, c);
+  #else
+    return simde_mm256_add_pd(simde_mm256_mul_pd(a, b), c);
+  #endif
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_x_mm256_svml_fnmadd_pd (simde__m256d a, simde__m256d b, simde__m256d c) {
+  #if defined(SIMDE_X86_FMA_NATIVE)
+    return simde_mm256_fnmadd_pd(a, b, c);
+  #else
+    return simde_mm256_sub_pd(c, simde_mm256_mul_pd(a, b));
+  #endif
+}
+
+SIMDE_FUNCTION_ATTRIBUTES
+simde__m256d
+simde_x_mm256_svml_fmsub_pd (simde__m256d a, simde__m256d b, simde__m256d c) {
+  #if defined(SIMDE_X86_FMA_NATIVE)
+    return simde_mm256_fmsub_pd(a, b, c);
+  #else
+    return simde_mm256_sub_pd(simde_mm256_mul_pd(a, b), c);
+  #endif
+}
+
 SIMDE_FUNCTION_ATTRIBUTES
 simde__m128
 simde_mm_acos_ps (simde__m128 a) {
@@ -1846,6 +2024,69 @@ simde_mm_cos_ps (simde__m128 a) {
     #else
       return Sleef_cosf4_u35(a);
     #endif
+  #elif (SIMDE_ACCURACY_PREFERENCE <= 1) && SIMDE_NATURAL_VECTOR_SIZE_GE(128)
+    /* Reduce |a| to xr = |a| - n * (pi / 2), |xr| <= pi / 4, and
+     * evaluate either the sine or the cosine polynomial depending on
+     * the quadrant.  Adding 1.5 * 2^23 rounds to the nearest integer
+     * and leaves n in the low bits of t.  pi / 2 is split into four
+     * parts, the first three short enough that multiplying them by n
+     * is exact.  Large inputs, infinities and NaNs are handled by
+     * libm. */
+    static const simde_float32 sin_coeffs[] = {
+      SIMDE_FLOAT32_C(-1.9515295891e-4),
+      SIMDE_FLOAT32_C( 8.3321608736e-3),
+      SIMDE_FLOAT32_C(-1.6666654611e-1)
+    };
+    static const simde_float32 cos_coeffs[] = {
+      SIMDE_FLOAT32_C( 2.443315711809948e-5),
+      SIMDE_FLOAT32_C(-1.388731625493765e-3),
+      SIMDE_FLOAT32_C( 4.166664568298827e-2)
+    };
+    const simde__m128 sign_mask = simde_mm_set1_ps(-SIMDE_FLOAT32_C(0.0));
+    const simde__m128 magic = simde_mm_set1_ps(SIMDE_FLOAT32_C(12582912.0));
+    const simde__m128 x = simde_mm_andnot_ps(sign_mask, a);
+    const simde__m128 in_range = simde_mm_cmple_ps(x, simde_mm_set1_ps(SIMDE_FLOAT32_C(8192.0)));
+    const simde__m128 t = simde_x_mm_svml_fmadd_ps(x, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.636619772367581343075535053490057448)), magic);
+    const simde__m128 n = simde_mm_sub_ps(t, magic);
+    const simde__m128i q = simde_mm_castps_si128(t);
+
+    simde__m128 xr = simde_x_mm_svml_fnmadd_ps(n, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.5703125)), x);
+    xr = simde_x_mm_svml_fnmadd_ps(n, simde_mm_set1_ps(SIMDE_FLOAT32_C(4.837512969970703125e-4)), xr);
+    xr = simde_x_mm_svml_fnmadd_ps(n, simde_mm_set1_ps(SIMDE_FLOAT32_C(7.54953362047672271729e-8)), xr);
+    xr = simde_x_mm_svml_fnmadd_ps(n, simde_mm_set1_ps(SIMDE_FLOAT32_C(2.56334406825708960298e-12)), xr);
+    const simde__m128 z = simde_mm_mul_ps(xr, xr);
+
+    simde__m128 s = simde_mm_set1_ps(sin_coeffs[0]);
+    for (size_t i = 1 ; i < (sizeof(sin_coeffs) / sizeof(sin_coeffs[0])) ; i++)
+      s = simde_x_mm_svml_fmadd_ps(s, z, simde_mm_set1_ps(sin_coeffs[i]));
+    s = simde_x_mm_svml_fmadd_ps(simde_mm_mul_ps(s, z), xr, xr);
+
+    simde__m128 c = simde_mm_set1_ps(cos_coeffs[0]);
+    for (size_t i = 1 ; i < (sizeof(cos_coeffs) / sizeof(cos_coeffs[0])) ; i++)
+      c = simde_x_mm_svml_fmadd_ps(c, z, simde_mm_set1_ps(cos_coeffs[i]));
+    c = simde_x_mm_svml_fmadd_ps(simde_mm_mul_ps(c, z), z, simde_x_mm_svml_fnmadd_ps(z, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.5)), simde_mm_set1_ps(SIMDE_FLOAT32_C(1.0))));
+
+    /* Odd quadrants use the sine polynomial, and the result is
+     * negated in quadrants 1 and 2. */
+    const simde__m128i qs = simde_mm_add_epi32(q, simde_mm_set1_epi32(1));
+    simde__m128 r = simde_mm_blendv_ps(c, s, simde_mm_castsi128_ps(simde_mm_slli_epi32(q, 31)));
+    r = simde_mm_xor_ps(r, simde_mm_and_ps(sign_mask, simde_mm_castsi128_ps(simde_mm_slli_epi32(qs, 30))));
+
+    if (HEDLEY_UNLIKELY(simde_mm_movemask_ps(in_range) != 0xf)) {
+      simde__m128_private
+        r_ = simde__m128_to_private(r),
+        a_ = simde__m128_to_private(a),
+        m_ = simde__m128_to_private(in_range);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        if (m_.i32[i] == 0)
+          r_.f32[i] = simde_math_cosf(a_.f32[i]);
+      }
+
+      r = simde__m128_from_private(r_);
+    }
+
+    return r;
   #else
     simde__m128_private
       r_,
@@ -1875,6 +2116,72 @@ simde_mm_cos_pd (simde__m128d a) {
     #else
       return Sleef_cosd2_u35(a);
     #endif
+  #elif (SIMDE_ACCURACY_PREFERENCE <= 1) && SIMDE_NATURAL_VECTOR_SIZE_GE(128)
+    /* Reduce |a| to xr = |a| - n * (pi / 2), |xr| <= pi / 4, and
+     * evaluate either the sine or the cosine polynomial depending on
+     * the quadrant.  Adding 1.5 * 2^52 rounds to the nearest integer
+     * and leaves n in the low bits of t.  Large inputs, infinities
+     * and NaNs are handled by libm. */
+    static const simde_float64 sin_coeffs[] = {
+      SIMDE_FLOAT64_C( 1.58962301576546568060e-10),
+      SIMDE_FLOAT64_C(-2.50507477628578072866e-08),
+      SIMDE_FLOAT64_C( 2.75573136213857245213e-06),
+      SIMDE_FLOAT64_C(-1.98412698295895385996e-04),
+      SIMDE_FLOAT64_C( 8.33333333332211858878e-03),
+      SIMDE_FLOAT64_C(-1.66666666666666307295e-01)
+    };
+    static const simde_float64 cos_coeffs[] = {
+      SIMDE_FLOAT64_C(-1.13585365213876817300e-11),
+      SIMDE_FLOAT64_C( 2.08757008419747316778e-09),
+      SIMDE_FLOAT64_C(-2.75573141792967388112e-07),
+      SIMDE_FLOAT64_C( 2.48015872888517045348e-05),
+      SIMDE_FLOAT64_C(-1.38888888888730564116e-03),
+      SIMDE_FLOAT64_C( 4.16666666666665929218e-02)
+    };
+    const simde__m128d sign_mask = simde_mm_set1_pd(-SIMDE_FLOAT64_C(0.0));
+    const simde__m128d magic = simde_mm_set1_pd(SIMDE_FLOAT64_C(6755399441055744.0));
+    const simde__m128d x = simde_mm_andnot_pd(sign_mask, a);
+    const simde__m128d in_range = simde_mm_cmple_pd(x, simde_mm_set1_pd(SIMDE_FLOAT64_C(1048576.0)));
+    const simde__m128d t = simde_x_mm_svml_fmadd_pd(x, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.636619772367581343075535053490057448)), magic);
+    const simde__m128d n = simde_mm_sub_pd(t, magic);
+    const simde__m128i q = simde_mm_castpd_si128(t);
+
+    simde__m128d xr = simde_x_mm_svml_fnmadd_pd(n, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.57079625129699707031e+00)), x);
+    xr = simde_x_mm_svml_fnmadd_pd(n, simde_mm_set1_pd(SIMDE_FLOAT64_C(7.54978941586159635336e-08)), xr);
+    xr = simde_x_mm_svml_fnmadd_pd(n, simde_mm_set1_pd(SIMDE_FLOAT64_C(5.39030285815811905290e-15)), xr);
+    const simde__m128d z = simde_mm_mul_pd(xr, xr);
+
+    simde__m128d s = simde_mm_set1_pd(sin_coeffs[0]);
+    for (size_t i = 1 ; i < (sizeof(sin_coeffs) / sizeof(sin_coeffs[0])) ; i++)
+      s = simde_x_mm_svml_fmadd_pd(s, z, simde_mm_set1_pd(sin_coeffs[i]));
+    s = simde_x_mm_svml_fmadd_pd(simde_mm_mul_pd(s, z), xr, xr);
+
+    simde__m128d c = simde_mm_set1_pd(cos_coeffs[0]);
+    for (size_t i = 1 ; i < (sizeof(cos_coeffs) / sizeof(cos_coeffs[0])) ; i++)
+      c = simde_x_mm_svml_fmadd_pd(c, z, simde_mm_set1_pd(cos_coeffs[i]));
+    c = simde_x_mm_svml_fmadd_pd(simde_mm_mul_pd(c, z), z, simde_x_mm_svml_fnmadd_pd(z, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.5)), simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0))));
+
+    /* Odd quadrants use the sine polynomial, and the result is
+     * negated in quadrants 1 and 2. */
+    const simde__m128i qs = simde_mm_add_epi64(q, simde_mm_set1_epi64x(1));
+    simde__m128d r = simde_mm_blendv_pd(c, s, simde_mm_castsi128_pd(simde_mm_slli_epi64(q, 63)));
+    r = simde_mm_xor_pd(r, simde_mm_and_pd(sign_mask, simde_mm_castsi128_pd(simde_mm_slli_epi64(qs, 62))));
+
+    if (HEDLEY_UNLIKELY(simde_mm_movemask_pd(in_range) != 0x3)) {
+      simde__m128d_private
+        r_ = simde__m128d_to_private(r),
+        a_ = simde__m128d_to_private(a),
+        m_ = simde__m128d_to_private(in_range);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        if (m_.i64[i] == 0)
+          r_.f64[i] = simde_math_cos(a_.f64[i]);
+      }
+
+      r = simde__m128d_from_private(r_);
+    }
+
+    return r;
   #else
     simde__m128d_private
       r_,
@@ -1904,6 +2211,69 @@ simde_mm256_cos_ps (simde__m256 a) {
     #else
       return Sleef_cosf8_u35(a);
     #endif
+  #elif (SIMDE_ACCURACY_PREFERENCE <= 1) && SIMDE_NATURAL_VECTOR_SIZE_GE(256)
+    /* Reduce |a| to xr = |a| - n * (pi / 2), |xr| <= pi / 4, and
+     * evaluate either the sine or the cosine polynomial depending on
+     * the quadrant.  Adding 1.5 * 2^23 rounds to the nearest integer
+     * and leaves n in the low bits of t.  pi / 2 is split into four
+     * parts, the first three short enough that multiplying them by n
+     * is exact.  Large inputs, infinities and NaNs are handled by
+     * libm. */
+    static const simde_float32 sin_coeffs[] = {
+      SIMDE_FLOAT32_C(-1.9515295891e-4),
+      SIMDE_FLOAT32_C( 8.3321608736e-3),
+      SIMDE_FLOAT32_C(-1.6666654611e-1)
+    };
+    static const simde_float32 cos_coeffs[] = {
+      SIMDE_FLOAT32_C( 2.443315711809948e-5),
+      SIMDE_FLOAT32_C(-1.388731625493765e-3),
+      SIMDE_FLOAT32_C( 4.166664568298827e-2)
+    };
+    const simde__m256 sign_mask = simde_mm256_set1_ps(-SIMDE_FLOAT32_C(0.0));
+    const simde__m256 magic = simde_mm256_set1_ps(SIMDE_FLOAT32_C(12582912.0));
+    const simde__m256 x = simde_mm256_andnot_ps(sign_mask, a);
+    const simde__m256 in_range = simde_mm256_cmp_ps(x, simde_mm256_set1_ps(SIMDE_FLOAT32_C(8192.0)), SIMDE_CMP_LE_OQ);
+    const simde__m256 t = simde_x_mm256_svml_fmadd_ps(x, simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.636619772367581343075535053490057448)), magic);
+    const simde__m256 n = simde_mm256_sub_ps(t, magic);
+    const simde__m256i q = simde_mm256_castps_si256(t);
+
+    simde__m256 xr = simde_x_mm256_svml_fnmadd_ps(n, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.5703125)), x);
+    xr = simde_x_mm256_svml_fnmadd_ps(n, simde_mm256_set1_ps(SIMDE_FLOAT32_C(4.837512969970703125e-4)), xr);
+    xr = simde_x_mm256_svml_fnmadd_ps(n, simde_mm256_set1_ps(SIMDE_FLOAT32_C(7.54953362047672271729e-8)), xr);
+    xr = simde_x_mm256_svml_fnmadd_ps(n, simde_mm256_set1_ps(SIMDE_FLOAT32_C(2.56334406825708960298e-12)), xr);
+    const simde__m256 z = simde_mm256_mul_ps(xr, xr);
+
+    simde__m256 s = simde_mm256_set1_ps(sin_coeffs[0]);
+    for (size_t i = 1 ; i < (sizeof(sin_coeffs) / sizeof(sin_coeffs[0])) ; i++)
+      s = simde_x_mm256_svml_fmadd_ps(s, z, simde_mm256_set1_ps(sin_coeffs[i]));
+    s = simde_x_mm256_svml_fmadd_ps(simde_mm256_mul_ps(s, z), xr, xr);
+
+    simde__m256 c = simde_mm256_set1_ps(cos_coeffs[0]);
+    for (size_t i = 1 ; i < (sizeof(cos_coeffs) / sizeof(cos_coeffs[0])) ; i++)
+      c = simde_x_mm256_svml_fmadd_ps(c, z, simde_mm256_set1_ps(cos_coeffs[i]));
+    c = simde_x_mm256_svml_fmadd_ps(simde_mm256_mul_ps(c, z), z, simde_x_mm256_svml_fnmadd_ps(z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.5)), simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.0))));
+
+    /* Odd quadrants use the sine polynomial, and the result is
+     * negated in quadrants 1 and 2. */
+    const simde__m256i qs = simde_mm256_add_epi32(q, simde_mm256_set1_epi32(1));
+    simde__m256 r = simde_mm256_blendv_ps(c, s, simde_mm256_castsi256_ps(simde_mm256_slli_epi32(q, 31)));
+    r = simde_mm256_xor_ps(r, simde_mm256_and_ps(sign_mask, simde_mm256_castsi256_ps(simde_mm256_slli_epi32(qs, 30))));
+
+    if (HEDLEY_UNLIKELY(simde_mm256_movemask_ps(in_range) != 0xff)) {
+      simde__m256_private
+        r_ = simde__m256_to_private(r),
+        a_ = simde__m256_to_private(a),
+        m_ = simde__m256_to_private(in_range);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        if (m_.i32[i] == 0)
+          r_.f32[i] = simde_math_cosf(a_.f32[i]);
+      }
+
+      r = simde__m256_from_private(r_);
+    }
+
+    return r;
   #else
     simde__m256_private
       r_,
@@ -1940,6 +2310,72 @@ simde_mm256_cos_pd (simde__m256d a) {
     #else
       return Sleef_cosd4_u35(a);
     #endif
+  #elif (SIMDE_ACCURACY_PREFERENCE <= 1) && SIMDE_NATURAL_VECTOR_SIZE_GE(256)
+    /* Reduce |a| to xr = |a| - n * (pi / 2), |xr| <= pi / 4, and
+     * evaluate either the sine or the cosine polynomial depending on
+     * the quadrant.  Adding 1.5 * 2^52 rounds to the nearest integer
+     * and leaves n in the low bits of t.  Large inputs, infinities
+     * and NaNs are handled by libm. */
+    static const simde_float64 sin_coeffs[] = {
+      SIMDE_FLOAT64_C( 1.58962301576546568060e-10),
+      SIMDE_FLOAT64_C(-2.50507477628578072866e-08),
+      SIMDE_FLOAT64_C( 2.75573136213857245213e-06),
+      SIMDE_FLOAT64_C(-1.98412698295895385996e-04),
+      SIMDE_FLOAT64_C( 8.33333333332211858878e-03),
+      SIMDE_FLOAT64_C(-1.66666666666666307295e-01)
+    };
+    static const simde_float64 cos_coeffs[] = {
+      SIMDE_FLOAT64_C(-1.13585365213876817300e-11),
+      SIMDE_FLOAT64_C( 2.08757008419747316778e-09),
+      SIMDE_FLOAT64_C(-2.75573141792967388112e-07),
+      SIMDE_FLOAT64_C( 2.48015872888517045348e-05),
+      SIMDE_FLOAT64_C(-1.38888888888730564116e-03),
+      SIMDE_FLOAT64_C( 4.16666666666665929218e-02)
+    };
+    const simde__m256d sign_mask = simde_mm256_set1_pd(-SIMDE_FLOAT64_C(0.0));
+    const simde__m256d magic = simde_mm256_set1_pd(SIMDE_FLOAT64_C(6755399441055744.0));
+    const simde__m256d x = simde_mm256_andnot_pd(sign_mask, a);
+    const simde__m256d in_range = simde_mm256_cmp_pd(x, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1048576.0)), SIMDE_CMP_LE_OQ);
+    const simde__m256d t = simde_x_mm256_svml_fmadd_pd(x, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.636619772367581343075535053490057448)), magic);
+    const simde__m256d n = simde_mm256_sub_pd(t, magic);
+    const simde__m256i q = simde_mm256_castpd_si256(t);
+
+    simde__m256d xr = simde_x_mm256_svml_fnmadd_pd(n, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.57079625129699707031e+00)), x);
+    xr = simde_x_mm256_svml_fnmadd_pd(n, simde_mm256_set1_pd(SIMDE_FLOAT64_C(7.54978941586159635336e-08)), xr);
+    xr = simde_x_mm256_svml_fnmadd_pd(n, simde_mm256_set1_pd(SIMDE_FLOAT64_C(5.39030285815811905290e-15)), xr);
+    const simde__m256d z = simde_mm256_mul_pd(xr, xr);
+
+    simde__m256d s = simde_mm256_set1_pd(sin_coeffs[0]);
+    for (size_t i = 1 ; i < (sizeof(sin_coeffs) / sizeof(sin_coeffs[0])) ; i++)
+      s = simde_x_mm256_svml_fmadd_pd(s, z, simde_mm256_set1_pd(sin_coeffs[i]));
+    s = simde_x_mm256_svml_fmadd_pd(simde_mm256_mul_pd(s, z), xr, xr);
+
+    simde__m256d c = simde_mm256_set1_pd(cos_coeffs[0]);
+    for (size_t i = 1 ; i < (sizeof(cos_coeffs) / sizeof(cos_coeffs[0])) ; i++)
+      c = simde_x_mm256_svml_fmadd_pd(c, z, simde_mm256_set1_pd(cos_coeffs[i]));
+    c = simde_x_mm256_svml_fmadd_pd(simde_mm256_mul_pd(c, z), z, simde_x_mm256_svml_fnmadd_pd(z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.5)), simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0))));
+
+    /* Odd quadrants use the sine polynomial, and the result is
+     * negated in quadrants 1 and 2. */
+    const simde__m256i qs = simde_mm256_add_epi64(q, simde_mm256_set1_epi64x(1));
+    simde__m256d r = simde_mm256_blendv_pd(c, s, simde_mm256_castsi256_pd(simde_mm256_slli_epi64(q, 63)));
+    r = simde_mm256_xor_pd(r, simde_mm256_and_pd(sign_mask, simde_mm256_castsi256_pd(simde_mm256_slli_epi64(qs, 62))));
+
+    if (HEDLEY_UNLIKELY(simde_mm256_movemask_pd(in_range) != 0xf)) {
+      simde__m256d_private
+        r_ = simde__m256d_to_private(r),
+        a_ = simde__m256d_to_private(a),
+        m_ = simde__m256d_to_private(in_range);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        if (m_.i64[i] == 0)
+          r_.f64[i] = simde_math_cos(a_.f64[i]);
+      }
+
+      r = simde__m256d_from_private(r_);
+    }
+
+    return r;
   #else
     simde__m256d_private
       r_,
@@ -1980,7 +2416,7 @@ simde_mm512_cos_ps (simde__m512 a) {
       r_,
       a_ = simde__m512_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256) || ((SIMDE_ACCURACY_PREFERENCE <= 1) && SIMDE_NATURAL_VECTOR_SIZE_GE(256))
       for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
         r_.m256[i] = simde_mm256_cos_ps(a_.m256[i]);
       }
@@ -2015,7 +2451,7 @@ simde_mm512_cos_pd (simde__m512d a) {
       r_,
       a_ = simde__m512d_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256) || ((SIMDE_ACCURACY_PREFERENCE <= 1) && SIMDE_NATURAL_VECTOR_SIZE_GE(256))
       for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
         r_.m256d[i] = simde_mm256_cos_pd(a_.m256d[i]);
       }
@@ -3915,6 +4351,55 @@ simde_mm_exp_ps (simde__m128 a) {
     return _mm_exp_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_expf4_u10(a);
+  #elif (SIMDE_ACCURACY_PREFERENCE <= 1) && SIMDE_NATURAL_VECTOR_SIZE_GE(128)
+    /* Reduce to xr = a - n * ln(2), |xr| <= ln(2) / 2, evaluate a
+     * short polynomial for (exp(xr) - 1 - xr) / xr^2, and scale by
+     * 2^n.  Adding 1.5 * 2^23 rounds to the nearest integer and
+     * leaves n in the low bits of t, where it can be shifted directly
+     * into the exponent field.  Lanes which could
+     * overflow or produce a subnormal result, as well as NaNs, are
+     * handled by libm. */
+    static const simde_float32 coeffs[] = {
+      SIMDE_FLOAT32_C(1.9875691500e-4),
+      SIMDE_FLOAT32_C(1.3981999507e-3),
+      SIMDE_FLOAT32_C(8.3334519073e-3),
+      SIMDE_FLOAT32_C(4.1665795894e-2),
+      SIMDE_FLOAT32_C(1.6666665459e-1),
+      SIMDE_FLOAT32_C(5.0000001201e-1)
+    };
+    const simde__m128 magic = simde_mm_set1_ps(SIMDE_FLOAT32_C(12582912.0));
+    const simde__m128 in_range = simde_mm_and_ps(
+      simde_mm_cmpge_ps(a, simde_mm_set1_ps(SIMDE_FLOAT32_C(-87.0))),
+      simde_mm_cmple_ps(a, simde_mm_set1_ps(SIMDE_FLOAT32_C(88.0))));
+    const simde__m128 t = simde_x_mm_svml_fmadd_ps(a, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.442695040888963407359924681001892137)), magic);
+    const simde__m128 n = simde_mm_sub_ps(t, magic);
+
+    simde__m128 xr = simde_x_mm_svml_fnmadd_ps(n, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.693359375)), a);
+    xr = simde_x_mm_svml_fnmadd_ps(n, simde_mm_set1_ps(SIMDE_FLOAT32_C(-2.12194440e-4)), xr);
+
+    simde__m128 p = simde_mm_set1_ps(coeffs[0]);
+    for (size_t i = 1 ; i < (sizeof(coeffs) / sizeof(coeffs[0])) ; i++)
+      p = simde_x_mm_svml_fmadd_ps(p, xr, simde_mm_set1_ps(coeffs[i]));
+    p = simde_x_mm_svml_fmadd_ps(p, simde_mm_mul_ps(xr, xr), xr);
+    p = simde_mm_add_ps(p, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.0)));
+
+    simde__m128 r = simde_mm_mul_ps(p, simde_mm_castsi128_ps(simde_mm_slli_epi32(simde_mm_add_epi32(simde_mm_castps_si128(t), simde_mm_set1_epi32(127)), 23)));
+
+    if (HEDLEY_UNLIKELY(simde_mm_movemask_ps(in_range) != 0xf)) {
+      simde__m128_private
+        r_ = simde__m128_to_private(r),
+        a_ = simde__m128_to_private(a),
+        m_ = simde__m128_to_private(in_range);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        if (m_.i32[i] == 0)
+          r_.f32[i] = simde_math_expf(a_.f32[i]);
+      }
+
+      r = simde__m128_from_private(r_);
+    }
+
+    return r;
   #else
     simde__m128_private
       r_,
@@ -3940,6 +4425,69 @@ simde_mm_exp_pd (simde__m128d a) {
     return _mm_exp_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_SSE_NATIVE)
     return Sleef_expd2_u10(a);
+  #elif (SIMDE_ACCURACY_PREFERENCE <= 1) && SIMDE_NATURAL_VECTOR_SIZE_GE(128)
+    /* Reduce to xr = a - n * ln(2), |xr| <= ln(2) / 2, evaluate the
+     * Taylor series of exp(xr), which converges quickly enough on that
+     * interval, and scale by 2^n.  Adding 1.5 * 2^52 rounds to the
+     * nearest integer and leaves n in the low bits of t, where it can
+     * be shifted directly into the exponent field.  Lanes which could
+     * overflow or produce a subnormal result, as well as NaNs, are
+     * handled by libm. */
+    static const simde_float64 coeffs[] = {
+      SIMDE_FLOAT64_C(1.6059043836821614599e-10),
+      SIMDE_FLOAT64_C(2.0876756987868098979e-09),
+      SIMDE_FLOAT64_C(2.5052108385441718775e-08),
+      SIMDE_FLOAT64_C(2.7557319223985890653e-07),
+      SIMDE_FLOAT64_C(2.7557319223985890653e-06),
+      SIMDE_FLOAT64_C(2.4801587301587301587e-05),
+      SIMDE_FLOAT64_C(1.9841269841269841270e-04),
+      SIMDE_FLOAT64_C(1.3888888888888888889e-03),
+      SIMDE_FLOAT64_C(8.3333333333333333333e-03),
+      SIMDE_FLOAT64_C(4.1666666666666666667e-02),
+      SIMDE_FLOAT64_C(1.6666666666666666667e-01),
+      SIMDE_FLOAT64_C(5.0000000000000000000e-01),
+      SIMDE_FLOAT64_C(1.0000000000000000000e+00),
+      SIMDE_FLOAT64_C(1.0000000000000000000e+00)
+    };
+    const simde__m128d magic = simde_mm_set1_pd(SIMDE_FLOAT64_C(6755399441055744.0));
+    const simde__m128d in_range = simde_mm_and_pd(
+      simde_mm_cmpge_pd(a, simde_mm_set1_pd(SIMDE_FLOAT64_C(-708.0))),
+      simde_mm_cmple_pd(a, simde_mm_set1_pd(SIMDE_FLOAT64_C(708.0))));
+    const simde__m128d t = simde_x_mm_svml_fmadd_pd(a, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.442695040888963407359924681001892137)), magic);
+    const simde__m128d n = simde_mm_sub_pd(t, magic);
+
+    simde__m128d xr = simde_x_mm_svml_fnmadd_pd(n, simde_mm_set1_pd(SIMDE_FLOAT64_C(6.93147180369123816490e-01)), a);
+    xr = simde_x_mm_svml_fnmadd_pd(n, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.90821492927058770002e-10)), xr);
+
+    /* Estrin's scheme; with Horner's the 13 multiply-adds would form
+     * a single dependency chain. */
+    const simde__m128d x2 = simde_mm_mul_pd(xr, xr);
+    const simde__m128d x4 = simde_mm_mul_pd(x2, x2);
+    const simde__m128d x8 = simde_mm_mul_pd(x4, x4);
+    simde__m128d c[7];
+    for (size_t i = 0 ; i < (sizeof(c) / sizeof(c[0])) ; i++)
+      c[i] = simde_x_mm_svml_fmadd_pd(simde_mm_set1_pd(coeffs[12 - (2 * i)]), xr, simde_mm_set1_pd(coeffs[13 - (2 * i)]));
+    const simde__m128d p0 = simde_x_mm_svml_fmadd_pd(simde_x_mm_svml_fmadd_pd(c[3], x2, c[2]), x4, simde_x_mm_svml_fmadd_pd(c[1], x2, c[0]));
+    const simde__m128d p1 = simde_x_mm_svml_fmadd_pd(c[6], x4, simde_x_mm_svml_fmadd_pd(c[5], x2, c[4]));
+    const simde__m128d p = simde_x_mm_svml_fmadd_pd(p1, x8, p0);
+
+    simde__m128d r = simde_mm_mul_pd(p, simde_mm_castsi128_pd(simde_mm_slli_epi64(simde_mm_add_epi64(simde_mm_castpd_si128(t), simde_mm_set1_epi64x(1023)), 52)));
+
+    if (HEDLEY_UNLIKELY(simde_mm_movemask_pd(in_range) != 0x3)) {
+      simde__m128d_private
+        r_ = simde__m128d_to_private(r),
+        a_ = simde__m128d_to_private(a),
+        m_ = simde__m128d_to_private(in_range);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        if (m_.i64[i] == 0)
+          r_.f64[i] = simde_math_exp(a_.f64[i]);
+      }
+
+      r = simde__m128d_from_private(r_);
+    }
+
+    return r;
   #else
     simde__m128d_private
       r_,
@@ -3965,6 +4513,55 @@ simde_mm256_exp_ps (simde__m256 a) {
     return _mm256_exp_ps(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_expf8_u10(a);
+  #elif (SIMDE_ACCURACY_PREFERENCE <= 1) && SIMDE_NATURAL_VECTOR_SIZE_GE(256)
+    /* Reduce to xr = a - n * ln(2), |xr| <= ln(2) / 2, evaluate a
+     * short polynomial for (exp(xr) - 1 - xr) / xr^2, and scale by
+     * 2^n.  Adding 1.5 * 2^23 rounds to the nearest integer and
+     * leaves n in the low bits of t, where it can be shifted directly
+     * into the exponent field.  Lanes which could
+     * overflow or produce a subnormal result, as well as NaNs, are
+     * handled by libm. */
+    static const simde_float32 coeffs[] = {
+      SIMDE_FLOAT32_C(1.9875691500e-4),
+      SIMDE_FLOAT32_C(1.3981999507e-3),
+      SIMDE_FLOAT32_C(8.3334519073e-3),
+      SIMDE_FLOAT32_C(4.1665795894e-2),
+      SIMDE_FLOAT32_C(1.6666665459e-1),
+      SIMDE_FLOAT32_C(5.0000001201e-1)
+    };
+    const simde__m256 magic = simde_mm256_set1_ps(SIMDE_FLOAT32_C(12582912.0));
+    const simde__m256 in_range = simde_mm256_and_ps(
+      simde_mm256_cmp_ps(a, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-87.0)), SIMDE_CMP_GE_OQ),
+      simde_mm256_cmp_ps(a, simde_mm256_set1_ps(SIMDE_FLOAT32_C(88.0)), SIMDE_CMP_LE_OQ));
+    const simde__m256 t = simde_x_mm256_svml_fmadd_ps(a, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.442695040888963407359924681001892137)), magic);
+    const simde__m256 n = simde_mm256_sub_ps(t, magic);
+
+    simde__m256 xr = simde_x_mm256_svml_fnmadd_ps(n, simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.693359375)), a);
+    xr = simde_x_mm256_svml_fnmadd_ps(n, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-2.12194440e-4)), xr);
+
+    simde__m256 p = simde_mm256_set1_ps(coeffs[0]);
+    for (size_t i = 1 ; i < (sizeof(coeffs) / sizeof(coeffs[0])) ; i++)
+      p = simde_x_mm256_svml_fmadd_ps(p, xr, simde_mm256_set1_ps(coeffs[i]));
+    p = simde_x_mm256_svml_fmadd_ps(p, simde_mm256_mul_ps(xr, xr), xr);
+    p = simde_mm256_add_ps(p, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.0)));
+
+    simde__m256 r = simde_mm256_mul_ps(p, simde_mm256_castsi256_ps(simde_mm256_slli_epi32(simde_mm256_add_epi32(simde_mm256_castps_si256(t), simde_mm256_set1_epi32(127)), 23)));
+
+    if (HEDLEY_UNLIKELY(simde_mm256_movemask_ps(in_range) != 0xff)) {
+      simde__m256_private
+        r_ = simde__m256_to_private(r),
+        a_ = simde__m256_to_private(a),
+        m_ = simde__m256_to_private(in_range);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        if (m_.i32[i] == 0)
+          r_.f32[i] = simde_math_expf(a_.f32[i]);
+      }
+
+      r = simde__m256_from_private(r_);
+    }
+
+    return r;
   #else
     simde__m256_private
       r_,
@@ -3997,6 +4594,69 @@ simde_mm256_exp_pd (simde__m256d a) {
     return _mm256_exp_pd(a);
   #elif defined(SIMDE_MATH_SLEEF_ENABLE) && defined(SIMDE_X86_AVX_NATIVE)
     return Sleef_expd4_u10(a);
+  #elif (SIMDE_ACCURACY_PREFERENCE <= 1) && SIMDE_NATURAL_VECTOR_SIZE_GE(256)
+    /* Reduce to xr = a - n * ln(2), |xr| <= ln(2) / 2, evaluate the
+     * Taylor series of exp(xr), which converges quickly enough on that
+     * interval, and scale by 2^n.  Adding 1.5 * 2^52 rounds to the
+     * nearest integer and leaves n in the low bits of t, where it can
+     * be shifted directly into the exponent field.  Lanes which could
+     * overflow or produce a subnormal result, as well as NaNs, are
+     * handled by libm. */
+    static const simde_float64 coeffs[] = {
+      SIMDE_FLOAT64_C(1.6059043836821614599e-10),
+      SIMDE_FLOAT64_C(2.0876756987868098979e-09),
+      SIMDE_FLOAT64_C(2.5052108385441718775e-08),
+      SIMDE_FLOAT64_C(2.7557319223985890653e-07),
+      SIMDE_FLOAT64_C(2.7557319223985890653e-06),
+      SIMDE_FLOAT64_C(2.4801587301587301587e-05),
+      SIMDE_FLOAT64_C(1.9841269841269841270e-04),
+      SIMDE_FLOAT64_C(1.3888888888888888889e-03),
+      SIMDE_FLOAT64_C(8.3333333333333333333e-03),
+      SIMDE_FLOAT64_C(4.1666666666666666667e-02),
+      SIMDE_FLOAT64_C(1.6666666666666666667e-01),
+      SIMDE_FLOAT64_C(5.0000000000000000000e-01),
+      SIMDE_FLOAT64_C(1.0000000000000000000e+00),
+      SIMDE_FLOAT64_C(1.0000000000000000000e+00)
+    };
+    const simde__m256d magic = simde_mm256_set1_pd(SIMDE_FLOAT64_C(6755399441055744.0));
+    const simde__m256d in_range = simde_mm256_and_pd(
+      simde_mm256_cmp_pd(a, simde_mm256_set1_pd(SIMDE_FLOAT64_C(-708.0)), SIMDE_CMP_GE_OQ),
+      simde_mm256_cmp_pd(a, simde_mm256_set1_pd(SIMDE_FLOAT64_C(708.0)), SIMDE_CMP_LE_OQ));
+    const simde__m256d t = simde_x_mm256_svml_fmadd_pd(a, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.442695040888963407359924681001892137)), magic);
+    const simde__m256d n = simde_mm256_sub_pd(t, magic);
+
+    simde__m256d xr = simde_x_mm256_svml_fnmadd_pd(n, simde_mm256_set1_pd(SIMDE_FLOAT64_C(6.93147180369123816490e-01)), a);
+    xr = simde_x_mm256_svml_fnmadd_pd(n, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.90821492927058770002e-10)), xr);
+
+    /* Estrin's scheme; with Horner's the 13 multiply-adds would form
+     * a single dependency chain. */
+    const simde__m256d x2 = simde_mm256_mul_pd(xr, xr);
+    const simde__m256d x4 = simde_mm256_mul_pd(x2, x2);
+    const simde__m256d x8 = simde_mm256_mul_pd(x4, x4);
+    simde__m256d c[7];
+    for (size_t i = 0 ; i < (sizeof(c) / sizeof(c[0])) ; i++)
+      c[i] = simde_x_mm256_svml_fmadd_pd(simde_mm256_set1_pd(coeffs[12 - (2 * i)]), xr, simde_mm256_set1_pd(coeffs[13 - (2 * i)]));
+    const simde__m256d p0 = simde_x_mm256_svml_fmadd_pd(simde_x_mm256_svml_fmadd_pd(c[3], x2, c[2]), x4, simde_x_mm256_svml_fmadd_pd(c[1], x2, c[0]));
+    const simde__m256d p1 = simde_x_mm256_svml_fmadd_pd(c[6], x4, simde_x_mm256_svml_fmadd_pd(c[5], x2, c[4]));
+    const simde__m256d p = simde_x_mm256_svml_fmadd_pd(p1, x8, p0);
+
+    simde__m256d r = simde_mm256_mul_pd(p, simde_mm256_castsi256_pd(simde_mm256_slli_epi64(simde_mm256_add_epi64(simde_mm256_castpd_si256(t), simde_mm256_set1_epi64x(1023)), 52)));
+
+    if (HEDLEY_UNLIKELY(simde_mm256_movemask_pd(in_range) != 0xf)) {
+      simde__m256d_private
+        r_ = simde__m256d_to_private(r),
+        a_ = simde__m256d_to_private(a),
+        m_ = simde__m256d_to_private(in_range);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        if (m_.i64[i] == 0)
+          r_.f64[i] = simde_math_exp(a_.f64[i]);
+      }
+
+      r = simde__m256d_from_private(r_);
+    }
+
+    return r;
   #else
     simde__m256d_private
       r_,
@@ -4033,7 +4693,7 @@ simde_mm512_exp_ps (simde__m512 a) {
       r_,
       a_ = simde__m512_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256) || ((SIMDE_ACCURACY_PREFERENCE <= 1) && SIMDE_NATURAL_VECTOR_SIZE_GE(256))
       for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
         r_.m256[i] = simde_mm256_exp_ps(a_.m256[i]);
       }
@@ -4064,7 +4724,7 @@ simde_mm512_exp_pd (simde__m512d a) {
       r_,
       a_ = simde__m512d_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256) || ((SIMDE_ACCURACY_PREFERENCE <= 1) && SIMDE_NATURAL_VECTOR_SIZE_GE(256))
       for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
         r_.m256d[i] = simde_mm256_exp_pd(a_.m256d[i]);
       }
@@ -5546,6 +6206,60 @@ simde_mm_log_ps (simde__m128 a) {
     #else
       return Sleef_logf4_u35(a);
     #endif
+  #elif (SIMDE_ACCURACY_PREFERENCE <= 1) && SIMDE_NATURAL_VECTOR_SIZE_GE(128)
+    /* Split a into m * 2^e with m in [sqrt(0.5), sqrt(2)) by
+     * manipulating the exponent bits directly, then approximate
+     * log(m) with a polynomial in m - 1.  Zero, negative, subnormal
+     * and non-finite inputs are handled by libm. */
+    static const simde_float32 coeffs[] = {
+      SIMDE_FLOAT32_C( 7.0376836292e-2),
+      SIMDE_FLOAT32_C(-1.1514610310e-1),
+      SIMDE_FLOAT32_C( 1.1676998740e-1),
+      SIMDE_FLOAT32_C(-1.2420140846e-1),
+      SIMDE_FLOAT32_C( 1.4249322787e-1),
+      SIMDE_FLOAT32_C(-1.6668057665e-1),
+      SIMDE_FLOAT32_C( 2.0000714765e-1),
+      SIMDE_FLOAT32_C(-2.4999993993e-1),
+      SIMDE_FLOAT32_C( 3.3333331174e-1)
+    };
+    const simde__m128 one = simde_mm_set1_ps(SIMDE_FLOAT32_C(1.0));
+    const simde__m128 in_range = simde_mm_and_ps(
+      simde_mm_cmpge_ps(a, simde_mm_set1_ps(SIMDE_MATH_FLT_MIN)),
+      simde_mm_cmple_ps(a, simde_mm_set1_ps(SIMDE_FLOAT32_C(3.40282346638528859811704183484516925e+38))));
+    const simde__m128i bits = simde_mm_castps_si128(a);
+
+    simde__m128 e = simde_mm_cvtepi32_ps(simde_mm_sub_epi32(simde_mm_srli_epi32(bits, 23), simde_mm_set1_epi32(126)));
+    simde__m128 m = simde_mm_castsi128_ps(simde_mm_or_si128(simde_mm_and_si128(bits, simde_mm_set1_epi32(0x007fffff)), simde_mm_set1_epi32(0x3f000000)));
+    const simde__m128 small = simde_mm_cmplt_ps(m, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.707106781186547524400844362104849039)));
+    e = simde_mm_sub_ps(e, simde_mm_and_ps(small, one));
+    m = simde_mm_add_ps(simde_mm_sub_ps(m, one), simde_mm_and_ps(small, m));
+
+    const simde__m128 z = simde_mm_mul_ps(m, m);
+    simde__m128 p = simde_mm_set1_ps(coeffs[0]);
+    for (size_t i = 1 ; i < (sizeof(coeffs) / sizeof(coeffs[0])) ; i++)
+      p = simde_x_mm_svml_fmadd_ps(p, m, simde_mm_set1_ps(coeffs[i]));
+    p = simde_mm_mul_ps(simde_mm_mul_ps(p, m), z);
+    p = simde_x_mm_svml_fmadd_ps(e, simde_mm_set1_ps(SIMDE_FLOAT32_C(-2.12194440e-4)), p);
+    p = simde_x_mm_svml_fnmadd_ps(z, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.5)), p);
+
+    simde__m128 r = simde_mm_add_ps(m, p);
+    r = simde_x_mm_svml_fmadd_ps(e, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.693359375)), r);
+
+    if (HEDLEY_UNLIKELY(simde_mm_movemask_ps(in_range) != 0xf)) {
+      simde__m128_private
+        r_ = simde__m128_to_private(r),
+        a_ = simde__m128_to_private(a),
+        m_ = simde__m128_to_private(in_range);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        if (m_.i32[i] == 0)
+          r_.f32[i] = simde_math_logf(a_.f32[i]);
+      }
+
+      r = simde__m128_from_private(r_);
+    }
+
+    return r;
   #else
     simde__m128_private
       r_,
@@ -5575,6 +6289,70 @@ simde_mm_log_pd (simde__m128d a) {
     #else
       return Sleef_logd2_u35(a);
     #endif
+  #elif (SIMDE_ACCURACY_PREFERENCE <= 1) && SIMDE_NATURAL_VECTOR_SIZE_GE(128)
+    /* Split a into m * 2^e with m in [sqrt(0.5), sqrt(2)) by
+     * manipulating the exponent bits directly (the exponent is
+     * converted to a double by or-ing it into the mantissa of 2^52),
+     * then approximate log(m) = log(1 + f) using a polynomial in
+     * s = f / (2 + f).  Zero, negative, subnormal and non-finite
+     * inputs are handled by libm. */
+    static const simde_float64 coeffs_odd[] = {
+      SIMDE_FLOAT64_C(1.479819860511658591e-01),
+      SIMDE_FLOAT64_C(1.818357216161805012e-01),
+      SIMDE_FLOAT64_C(2.857142874366239149e-01),
+      SIMDE_FLOAT64_C(6.666666666666735130e-01)
+    };
+    static const simde_float64 coeffs_even[] = {
+      SIMDE_FLOAT64_C(1.531383769920937332e-01),
+      SIMDE_FLOAT64_C(2.222219843214978396e-01),
+      SIMDE_FLOAT64_C(3.999999999940941908e-01)
+    };
+    const simde__m128d one = simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0));
+    const simde__m128d two52 = simde_mm_set1_pd(SIMDE_FLOAT64_C(4503599627370496.0));
+    const simde__m128d in_range = simde_mm_and_pd(
+      simde_mm_cmpge_pd(a, simde_mm_set1_pd(SIMDE_MATH_DBL_MIN)),
+      simde_mm_cmple_pd(a, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.79769313486231570814527423731704357e+308))));
+    const simde__m128i bits = simde_mm_castpd_si128(a);
+
+    simde__m128d e = simde_mm_castsi128_pd(simde_mm_or_si128(simde_mm_srli_epi64(bits, 52), simde_mm_castpd_si128(two52)));
+    e = simde_mm_sub_pd(e, simde_mm_add_pd(two52, simde_mm_set1_pd(SIMDE_FLOAT64_C(1022.0))));
+    simde__m128d f = simde_mm_castsi128_pd(simde_mm_or_si128(simde_mm_and_si128(bits, simde_mm_set1_epi64x(INT64_C(0x000fffffffffffff))), simde_mm_set1_epi64x(INT64_C(0x3fe0000000000000))));
+    const simde__m128d small = simde_mm_cmplt_pd(f, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.707106781186547524400844362104849039)));
+    e = simde_mm_sub_pd(e, simde_mm_and_pd(small, one));
+    f = simde_mm_add_pd(simde_mm_sub_pd(f, one), simde_mm_and_pd(small, f));
+
+    const simde__m128d s = simde_mm_div_pd(f, simde_mm_add_pd(f, simde_mm_set1_pd(SIMDE_FLOAT64_C(2.0))));
+    const simde__m128d z = simde_mm_mul_pd(s, s);
+    const simde__m128d w = simde_mm_mul_pd(z, z);
+    simde__m128d t1 = simde_mm_set1_pd(coeffs_even[0]);
+    for (size_t i = 1 ; i < (sizeof(coeffs_even) / sizeof(coeffs_even[0])) ; i++)
+      t1 = simde_x_mm_svml_fmadd_pd(t1, w, simde_mm_set1_pd(coeffs_even[i]));
+    simde__m128d t2 = simde_mm_set1_pd(coeffs_odd[0]);
+    for (size_t i = 1 ; i < (sizeof(coeffs_odd) / sizeof(coeffs_odd[0])) ; i++)
+      t2 = simde_x_mm_svml_fmadd_pd(t2, w, simde_mm_set1_pd(coeffs_odd[i]));
+    const simde__m128d R = simde_x_mm_svml_fmadd_pd(t1, w, simde_mm_mul_pd(t2, z));
+    const simde__m128d hfsq = simde_mm_mul_pd(simde_mm_mul_pd(simde_mm_set1_pd(SIMDE_FLOAT64_C(0.5)), f), f);
+
+    /* e * ln2_hi - ((hfsq - (s * (hfsq + R) + e * ln2_lo)) - f) */
+    simde__m128d r = simde_x_mm_svml_fmadd_pd(s, simde_mm_add_pd(hfsq, R), simde_mm_mul_pd(e, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.90821492927058770002e-10))));
+    r = simde_mm_sub_pd(simde_mm_sub_pd(hfsq, r), f);
+    r = simde_x_mm_svml_fmsub_pd(e, simde_mm_set1_pd(SIMDE_FLOAT64_C(6.93147180369123816490e-01)), r);
+
+    if (HEDLEY_UNLIKELY(simde_mm_movemask_pd(in_range) != 0x3)) {
+      simde__m128d_private
+        r_ = simde__m128d_to_private(r),
+        a_ = simde__m128d_to_private(a),
+        m_ = simde__m128d_to_private(in_range);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        if (m_.i64[i] == 0)
+          r_.f64[i] = simde_math_log(a_.f64[i]);
+      }
+
+      r = simde__m128d_from_private(r_);
+    }
+
+    return r;
   #else
     simde__m128d_private
       r_,
@@ -5604,6 +6382,60 @@ simde_mm256_log_ps (simde__m256 a) {
     #else
       return Sleef_logf8_u35(a);
     #endif
+  #elif (SIMDE_ACCURACY_PREFERENCE <= 1) && SIMDE_NATURAL_VECTOR_SIZE_GE(256)
+    /* Split a into m * 2^e with m in [sqrt(0.5), sqrt(2)) by
+     * manipulating the exponent bits directly, then approximate
+     * log(m) with a polynomial in m - 1.  Zero, negative, subnormal
+     * and non-finite inputs are handled by libm. */
+    static const simde_float32 coeffs[] = {
+      SIMDE_FLOAT32_C( 7.0376836292e-2),
+      SIMDE_FLOAT32_C(-1.1514610310e-1),
+      SIMDE_FLOAT32_C( 1.1676998740e-1),
+      SIMDE_FLOAT32_C(-1.2420140846e-1),
+      SIMDE_FLOAT32_C( 1.4249322787e-1),
+      SIMDE_FLOAT32_C(-1.6668057665e-1),
+      SIMDE_FLOAT32_C( 2.0000714765e-1),
+      SIMDE_FLOAT32_C(-2.4999993993e-1),
+      SIMDE_FLOAT32_C( 3.3333331174e-1)
+    };
+    const simde__m256 one = simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.0));
+    const simde__m256 in_range = simde_mm256_and_ps(
+      simde_mm256_cmp_ps(a, simde_mm256_set1_ps(SIMDE_MATH_FLT_MIN), SIMDE_CMP_GE_OQ),
+      simde_mm256_cmp_ps(a, simde_mm256_set1_ps(SIMDE_FLOAT32_C(3.40282346638528859811704183484516925e+38)), SIMDE_CMP_LE_OQ));
+    const simde__m256i bits = simde_mm256_castps_si256(a);
+
+    simde__m256 e = simde_mm256_cvtepi32_ps(simde_mm256_sub_epi32(simde_mm256_srli_epi32(bits, 23), simde_mm256_set1_epi32(126)));
+    simde__m256 m = simde_mm256_castsi256_ps(simde_mm256_or_si256(simde_mm256_and_si256(bits, simde_mm256_set1_epi32(0x007fffff)), simde_mm256_set1_epi32(0x3f000000)));
+    const simde__m256 small = simde_mm256_cmp_ps(m, simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.707106781186547524400844362104849039)), SIMDE_CMP_LT_OQ);
+    e = simde_mm256_sub_ps(e, simde_mm256_and_ps(small, one));
+    m = simde_mm256_add_ps(simde_mm256_sub_ps(m, one), simde_mm256_and_ps(small, m));
+
+    const simde__m256 z = simde_mm256_mul_ps(m, m);
+    simde__m256 p = simde_mm256_set1_ps(coeffs[0]);
+    for (size_t i = 1 ; i < (sizeof(coeffs) / sizeof(coeffs[0])) ; i++)
+      p = simde_x_mm256_svml_fmadd_ps(p, m, simde_mm256_set1_ps(coeffs[i]));
+    p = simde_mm256_mul_ps(simde_mm256_mul_ps(p, m), z);
+    p = simde_x_mm256_svml_fmadd_ps(e, simde_mm256_set1_ps(SIMDE_FLOAT32_C(-2.12194440e-4)), p);
+    p = simde_x_mm256_svml_fnmadd_ps(z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.5)), p);
+
+    simde__m256 r = simde_mm256_add_ps(m, p);
+    r = simde_x_mm256_svml_fmadd_ps(e, simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.693359375)), r);
+
+    if (HEDLEY_UNLIKELY(simde_mm256_movemask_ps(in_range) != 0xff)) {
+      simde__m256_private
+        r_ = simde__m256_to_private(r),
+        a_ = simde__m256_to_private(a),
+        m_ = simde__m256_to_private(in_range);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        if (m_.i32[i] == 0)
+          r_.f32[i] = simde_math_logf(a_.f32[i]);
+      }
+
+      r = simde__m256_from_private(r_);
+    }
+
+    return r;
   #else
     simde__m256_private
       r_,
@@ -5640,6 +6472,70 @@ simde_mm256_log_pd (simde__m256d a) {
     #else
       return Sleef_logd4_u35(a);
     #endif
+  #elif (SIMDE_ACCURACY_PREFERENCE <= 1) && SIMDE_NATURAL_VECTOR_SIZE_GE(256)
+    /* Split a into m * 2^e with m in [sqrt(0.5), sqrt(2)) by
+     * manipulating the exponent bits directly (the exponent is
+     * converted to a double by or-ing it into the mantissa of 2^52),
+     * then approximate log(m) = log(1 + f) using a polynomial in
+     * s = f / (2 + f).  Zero, negative, subnormal and non-finite
+     * inputs are handled by libm. */
+    static const simde_float64 coeffs_odd[] = {
+      SIMDE_FLOAT64_C(1.479819860511658591e-01),
+      SIMDE_FLOAT64_C(1.818357216161805012e-01),
+      SIMDE_FLOAT64_C(2.857142874366239149e-01),
+      SIMDE_FLOAT64_C(6.666666666666735130e-01)
+    };
+    static const simde_float64 coeffs_even[] = {
+      SIMDE_FLOAT64_C(1.531383769920937332e-01),
+      SIMDE_FLOAT64_C(2.222219843214978396e-01),
+      SIMDE_FLOAT64_C(3.999999999940941908e-01)
+    };
+    const simde__m256d one = simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0));
+    const simde__m256d two52 = simde_mm256_set1_pd(SIMDE_FLOAT64_C(4503599627370496.0));
+    const simde__m256d in_range = simde_mm256_and_pd(
+      simde_mm256_cmp_pd(a, simde_mm256_set1_pd(SIMDE_MATH_DBL_MIN), SIMDE_CMP_GE_OQ),
+      simde_mm256_cmp_pd(a, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.79769313486231570814527423731704357e+308)), SIMDE_CMP_LE_OQ));
+    const simde__m256i bits = simde_mm256_castpd_si256(a);
+
+    simde__m256d e = simde_mm256_castsi256_pd(simde_mm256_or_si256(simde_mm256_srli_epi64(bits, 52), simde_mm256_castpd_si256(two52)));
+    e = simde_mm256_sub_pd(e, simde_mm256_add_pd(two52, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1022.0))));
+    simde__m256d f = simde_mm256_castsi256_pd(simde_mm256_or_si256(simde_mm256_and_si256(bits, simde_mm256_set1_epi64x(INT64_C(0x000fffffffffffff))), simde_mm256_set1_epi64x(INT64_C(0x3fe0000000000000))));
+    const simde__m256d small = simde_mm256_cmp_pd(f, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.707106781186547524400844362104849039)), SIMDE_CMP_LT_OQ);
+    e = simde_mm256_sub_pd(e, simde_mm256_and_pd(small, one));
+    f = simde_mm256_add_pd(simde_mm256_sub_pd(f, one), simde_mm256_and_pd(small, f));
+
+    const simde__m256d s = simde_mm256_div_pd(f, simde_mm256_add_pd(f, simde_mm256_set1_pd(SIMDE_FLOAT64_C(2.0))));
+    const simde__m256d z = simde_mm256_mul_pd(s, s);
+    const simde__m256d w = simde_mm256_mul_pd(z, z);
+    simde__m256d t1 = simde_mm256_set1_pd(coeffs_even[0]);
+    for (size_t i = 1 ; i < (sizeof(coeffs_even) / sizeof(coeffs_even[0])) ; i++)
+      t1 = simde_x_mm256_svml_fmadd_pd(t1, w, simde_mm256_set1_pd(coeffs_even[i]));
+    simde__m256d t2 = simde_mm256_set1_pd(coeffs_odd[0]);
+    for (size_t i = 1 ; i < (sizeof(coeffs_odd) / sizeof(coeffs_odd[0])) ; i++)
+      t2 = simde_x_mm256_svml_fmadd_pd(t2, w, simde_mm256_set1_pd(coeffs_odd[i]));
+    const simde__m256d R = simde_x_mm256_svml_fmadd_pd(t1, w, simde_mm256_mul_pd(t2, z));
+    const simde__m256d hfsq = simde_mm256_mul_pd(simde_mm256_mul_pd(simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.5)), f), f);
+
+    /* e * ln2_hi - ((hfsq - (s * (hfsq + R) + e * ln2_lo)) - f) */
+    simde__m256d r = simde_x_mm256_svml_fmadd_pd(s, simde_mm256_add_pd(hfsq, R), simde_mm256_mul_pd(e, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.90821492927058770002e-10))));
+    r = simde_mm256_sub_pd(simde_mm256_sub_pd(hfsq, r), f);
+    r = simde_x_mm256_svml_fmsub_pd(e, simde_mm256_set1_pd(SIMDE_FLOAT64_C(6.93147180369123816490e-01)), r);
+
+    if (HEDLEY_UNLIKELY(simde_mm256_movemask_pd(in_range) != 0xf)) {
+      simde__m256d_private
+        r_ = simde__m256d_to_private(r),
+        a_ = simde__m256d_to_private(a),
+        m_ = simde__m256d_to_private(in_range);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        if (m_.i64[i] == 0)
+          r_.f64[i] = simde_math_log(a_.f64[i]);
+      }
+
+      r = simde__m256d_from_private(r_);
+    }
+
+    return r;
   #else
     simde__m256d_private
       r_,
@@ -5680,7 +6576,7 @@ simde_mm512_log_ps (simde__m512 a) {
       r_,
       a_ = simde__m512_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256) || ((SIMDE_ACCURACY_PREFERENCE <= 1) && SIMDE_NATURAL_VECTOR_SIZE_GE(256))
       for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
         r_.m256[i] = simde_mm256_log_ps(a_.m256[i]);
       }
@@ -5715,7 +6611,7 @@ simde_mm512_log_pd (simde__m512d a) {
       r_,
       a_ = simde__m512d_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256) || ((SIMDE_ACCURACY_PREFERENCE <= 1) && SIMDE_NATURAL_VECTOR_SIZE_GE(256))
       for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
         r_.m256d[i] = simde_mm256_log_pd(a_.m256d[i]);
       }
@@ -9860,6 +10756,69 @@ simde_mm_sin_ps (simde__m128 a) {
     #else
       return Sleef_sinf4_u35(a);
     #endif
+  #elif (SIMDE_ACCURACY_PREFERENCE <= 1) && SIMDE_NATURAL_VECTOR_SIZE_GE(128)
+    /* Reduce |a| to xr = |a| - n * (pi / 2), |xr| <= pi / 4, and
+     * evaluate either the sine or the cosine polynomial depending on
+     * the quadrant.  Adding 1.5 * 2^23 rounds to the nearest integer
+     * and leaves n in the low bits of t.  pi / 2 is split into four
+     * parts, the first three short enough that multiplying them by n
+     * is exact.  Large inputs, infinities and NaNs are handled by
+     * libm. */
+    static const simde_float32 sin_coeffs[] = {
+      SIMDE_FLOAT32_C(-1.9515295891e-4),
+      SIMDE_FLOAT32_C( 8.3321608736e-3),
+      SIMDE_FLOAT32_C(-1.6666654611e-1)
+    };
+    static const simde_float32 cos_coeffs[] = {
+      SIMDE_FLOAT32_C( 2.443315711809948e-5),
+      SIMDE_FLOAT32_C(-1.388731625493765e-3),
+      SIMDE_FLOAT32_C( 4.166664568298827e-2)
+    };
+    const simde__m128 sign_mask = simde_mm_set1_ps(-SIMDE_FLOAT32_C(0.0));
+    const simde__m128 magic = simde_mm_set1_ps(SIMDE_FLOAT32_C(12582912.0));
+    const simde__m128 x = simde_mm_andnot_ps(sign_mask, a);
+    const simde__m128 in_range = simde_mm_cmple_ps(x, simde_mm_set1_ps(SIMDE_FLOAT32_C(8192.0)));
+    const simde__m128 t = simde_x_mm_svml_fmadd_ps(x, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.636619772367581343075535053490057448)), magic);
+    const simde__m128 n = simde_mm_sub_ps(t, magic);
+    const simde__m128i q = simde_mm_castps_si128(t);
+
+    simde__m128 xr = simde_x_mm_svml_fnmadd_ps(n, simde_mm_set1_ps(SIMDE_FLOAT32_C(1.5703125)), x);
+    xr = simde_x_mm_svml_fnmadd_ps(n, simde_mm_set1_ps(SIMDE_FLOAT32_C(4.837512969970703125e-4)), xr);
+    xr = simde_x_mm_svml_fnmadd_ps(n, simde_mm_set1_ps(SIMDE_FLOAT32_C(7.54953362047672271729e-8)), xr);
+    xr = simde_x_mm_svml_fnmadd_ps(n, simde_mm_set1_ps(SIMDE_FLOAT32_C(2.56334406825708960298e-12)), xr);
+    const simde__m128 z = simde_mm_mul_ps(xr, xr);
+
+    simde__m128 s = simde_mm_set1_ps(sin_coeffs[0]);
+    for (size_t i = 1 ; i < (sizeof(sin_coeffs) / sizeof(sin_coeffs[0])) ; i++)
+      s = simde_x_mm_svml_fmadd_ps(s, z, simde_mm_set1_ps(sin_coeffs[i]));
+    s = simde_x_mm_svml_fmadd_ps(simde_mm_mul_ps(s, z), xr, xr);
+
+    simde__m128 c = simde_mm_set1_ps(cos_coeffs[0]);
+    for (size_t i = 1 ; i < (sizeof(cos_coeffs) / sizeof(cos_coeffs[0])) ; i++)
+      c = simde_x_mm_svml_fmadd_ps(c, z, simde_mm_set1_ps(cos_coeffs[i]));
+    c = simde_x_mm_svml_fmadd_ps(simde_mm_mul_ps(c, z), z, simde_x_mm_svml_fnmadd_ps(z, simde_mm_set1_ps(SIMDE_FLOAT32_C(0.5)), simde_mm_set1_ps(SIMDE_FLOAT32_C(1.0))));
+
+    /* Odd quadrants use the cosine polynomial, and the result is
+     * negated in quadrants 2 and 3 and for negative inputs. */
+    simde__m128 r = simde_mm_blendv_ps(s, c, simde_mm_castsi128_ps(simde_mm_slli_epi32(q, 31)));
+    r = simde_mm_xor_ps(r, simde_mm_and_ps(sign_mask, simde_mm_castsi128_ps(simde_mm_slli_epi32(q, 30))));
+    r = simde_mm_xor_ps(r, simde_mm_and_ps(sign_mask, a));
+
+    if (HEDLEY_UNLIKELY(simde_mm_movemask_ps(in_range) != 0xf)) {
+      simde__m128_private
+        r_ = simde__m128_to_private(r),
+        a_ = simde__m128_to_private(a),
+        m_ = simde__m128_to_private(in_range);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        if (m_.i32[i] == 0)
+          r_.f32[i] = simde_math_sinf(a_.f32[i]);
+      }
+
+      r = simde__m128_from_private(r_);
+    }
+
+    return r;
   #else
     simde__m128_private
       r_,
@@ -9889,6 +10848,72 @@ simde_mm_sin_pd (simde__m128d a) {
     #else
       return Sleef_sind2_u35(a);
     #endif
+  #elif (SIMDE_ACCURACY_PREFERENCE <= 1) && SIMDE_NATURAL_VECTOR_SIZE_GE(128)
+    /* Reduce |a| to xr = |a| - n * (pi / 2), |xr| <= pi / 4, and
+     * evaluate either the sine or the cosine polynomial depending on
+     * the quadrant.  Adding 1.5 * 2^52 rounds to the nearest integer
+     * and leaves n in the low bits of t.  Large inputs, infinities
+     * and NaNs are handled by libm. */
+    static const simde_float64 sin_coeffs[] = {
+      SIMDE_FLOAT64_C( 1.58962301576546568060e-10),
+      SIMDE_FLOAT64_C(-2.50507477628578072866e-08),
+      SIMDE_FLOAT64_C( 2.75573136213857245213e-06),
+      SIMDE_FLOAT64_C(-1.98412698295895385996e-04),
+      SIMDE_FLOAT64_C( 8.33333333332211858878e-03),
+      SIMDE_FLOAT64_C(-1.66666666666666307295e-01)
+    };
+    static const simde_float64 cos_coeffs[] = {
+      SIMDE_FLOAT64_C(-1.13585365213876817300e-11),
+      SIMDE_FLOAT64_C( 2.08757008419747316778e-09),
+      SIMDE_FLOAT64_C(-2.75573141792967388112e-07),
+      SIMDE_FLOAT64_C( 2.48015872888517045348e-05),
+      SIMDE_FLOAT64_C(-1.38888888888730564116e-03),
+      SIMDE_FLOAT64_C( 4.16666666666665929218e-02)
+    };
+    const simde__m128d sign_mask = simde_mm_set1_pd(-SIMDE_FLOAT64_C(0.0));
+    const simde__m128d magic = simde_mm_set1_pd(SIMDE_FLOAT64_C(6755399441055744.0));
+    const simde__m128d x = simde_mm_andnot_pd(sign_mask, a);
+    const simde__m128d in_range = simde_mm_cmple_pd(x, simde_mm_set1_pd(SIMDE_FLOAT64_C(1048576.0)));
+    const simde__m128d t = simde_x_mm_svml_fmadd_pd(x, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.636619772367581343075535053490057448)), magic);
+    const simde__m128d n = simde_mm_sub_pd(t, magic);
+    const simde__m128i q = simde_mm_castpd_si128(t);
+
+    simde__m128d xr = simde_x_mm_svml_fnmadd_pd(n, simde_mm_set1_pd(SIMDE_FLOAT64_C(1.57079625129699707031e+00)), x);
+    xr = simde_x_mm_svml_fnmadd_pd(n, simde_mm_set1_pd(SIMDE_FLOAT64_C(7.54978941586159635336e-08)), xr);
+    xr = simde_x_mm_svml_fnmadd_pd(n, simde_mm_set1_pd(SIMDE_FLOAT64_C(5.39030285815811905290e-15)), xr);
+    const simde__m128d z = simde_mm_mul_pd(xr, xr);
+
+    simde__m128d s = simde_mm_set1_pd(sin_coeffs[0]);
+    for (size_t i = 1 ; i < (sizeof(sin_coeffs) / sizeof(sin_coeffs[0])) ; i++)
+      s = simde_x_mm_svml_fmadd_pd(s, z, simde_mm_set1_pd(sin_coeffs[i]));
+    s = simde_x_mm_svml_fmadd_pd(simde_mm_mul_pd(s, z), xr, xr);
+
+    simde__m128d c = simde_mm_set1_pd(cos_coeffs[0]);
+    for (size_t i = 1 ; i < (sizeof(cos_coeffs) / sizeof(cos_coeffs[0])) ; i++)
+      c = simde_x_mm_svml_fmadd_pd(c, z, simde_mm_set1_pd(cos_coeffs[i]));
+    c = simde_x_mm_svml_fmadd_pd(simde_mm_mul_pd(c, z), z, simde_x_mm_svml_fnmadd_pd(z, simde_mm_set1_pd(SIMDE_FLOAT64_C(0.5)), simde_mm_set1_pd(SIMDE_FLOAT64_C(1.0))));
+
+    /* Odd quadrants use the cosine polynomial, and the result is
+     * negated in quadrants 2 and 3 and for negative inputs. */
+    simde__m128d r = simde_mm_blendv_pd(s, c, simde_mm_castsi128_pd(simde_mm_slli_epi64(q, 63)));
+    r = simde_mm_xor_pd(r, simde_mm_and_pd(sign_mask, simde_mm_castsi128_pd(simde_mm_slli_epi64(q, 62))));
+    r = simde_mm_xor_pd(r, simde_mm_and_pd(sign_mask, a));
+
+    if (HEDLEY_UNLIKELY(simde_mm_movemask_pd(in_range) != 0x3)) {
+      simde__m128d_private
+        r_ = simde__m128d_to_private(r),
+        a_ = simde__m128d_to_private(a),
+        m_ = simde__m128d_to_private(in_range);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        if (m_.i64[i] == 0)
+          r_.f64[i] = simde_math_sin(a_.f64[i]);
+      }
+
+      r = simde__m128d_from_private(r_);
+    }
+
+    return r;
   #else
     simde__m128d_private
       r_,
@@ -9918,6 +10943,69 @@ simde_mm256_sin_ps (simde__m256 a) {
     #else
       return Sleef_sinf8_u35(a);
     #endif
+  #elif (SIMDE_ACCURACY_PREFERENCE <= 1) && SIMDE_NATURAL_VECTOR_SIZE_GE(256)
+    /* Reduce |a| to xr = |a| - n * (pi / 2), |xr| <= pi / 4, and
+     * evaluate either the sine or the cosine polynomial depending on
+     * the quadrant.  Adding 1.5 * 2^23 rounds to the nearest integer
+     * and leaves n in the low bits of t.  pi / 2 is split into four
+     * parts, the first three short enough that multiplying them by n
+     * is exact.  Large inputs, infinities and NaNs are handled by
+     * libm. */
+    static const simde_float32 sin_coeffs[] = {
+      SIMDE_FLOAT32_C(-1.9515295891e-4),
+      SIMDE_FLOAT32_C( 8.3321608736e-3),
+      SIMDE_FLOAT32_C(-1.6666654611e-1)
+    };
+    static const simde_float32 cos_coeffs[] = {
+      SIMDE_FLOAT32_C( 2.443315711809948e-5),
+      SIMDE_FLOAT32_C(-1.388731625493765e-3),
+      SIMDE_FLOAT32_C( 4.166664568298827e-2)
+    };
+    const simde__m256 sign_mask = simde_mm256_set1_ps(-SIMDE_FLOAT32_C(0.0));
+    const simde__m256 magic = simde_mm256_set1_ps(SIMDE_FLOAT32_C(12582912.0));
+    const simde__m256 x = simde_mm256_andnot_ps(sign_mask, a);
+    const simde__m256 in_range = simde_mm256_cmp_ps(x, simde_mm256_set1_ps(SIMDE_FLOAT32_C(8192.0)), SIMDE_CMP_LE_OQ);
+    const simde__m256 t = simde_x_mm256_svml_fmadd_ps(x, simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.636619772367581343075535053490057448)), magic);
+    const simde__m256 n = simde_mm256_sub_ps(t, magic);
+    const simde__m256i q = simde_mm256_castps_si256(t);
+
+    simde__m256 xr = simde_x_mm256_svml_fnmadd_ps(n, simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.5703125)), x);
+    xr = simde_x_mm256_svml_fnmadd_ps(n, simde_mm256_set1_ps(SIMDE_FLOAT32_C(4.837512969970703125e-4)), xr);
+    xr = simde_x_mm256_svml_fnmadd_ps(n, simde_mm256_set1_ps(SIMDE_FLOAT32_C(7.54953362047672271729e-8)), xr);
+    xr = simde_x_mm256_svml_fnmadd_ps(n, simde_mm256_set1_ps(SIMDE_FLOAT32_C(2.56334406825708960298e-12)), xr);
+    const simde__m256 z = simde_mm256_mul_ps(xr, xr);
+
+    simde__m256 s = simde_mm256_set1_ps(sin_coeffs[0]);
+    for (size_t i = 1 ; i < (sizeof(sin_coeffs) / sizeof(sin_coeffs[0])) ; i++)
+      s = simde_x_mm256_svml_fmadd_ps(s, z, simde_mm256_set1_ps(sin_coeffs[i]));
+    s = simde_x_mm256_svml_fmadd_ps(simde_mm256_mul_ps(s, z), xr, xr);
+
+    simde__m256 c = simde_mm256_set1_ps(cos_coeffs[0]);
+    for (size_t i = 1 ; i < (sizeof(cos_coeffs) / sizeof(cos_coeffs[0])) ; i++)
+      c = simde_x_mm256_svml_fmadd_ps(c, z, simde_mm256_set1_ps(cos_coeffs[i]));
+    c = simde_x_mm256_svml_fmadd_ps(simde_mm256_mul_ps(c, z), z, simde_x_mm256_svml_fnmadd_ps(z, simde_mm256_set1_ps(SIMDE_FLOAT32_C(0.5)), simde_mm256_set1_ps(SIMDE_FLOAT32_C(1.0))));
+
+    /* Odd quadrants use the cosine polynomial, and the result is
+     * negated in quadrants 2 and 3 and for negative inputs. */
+    simde__m256 r = simde_mm256_blendv_ps(s, c, simde_mm256_castsi256_ps(simde_mm256_slli_epi32(q, 31)));
+    r = simde_mm256_xor_ps(r, simde_mm256_and_ps(sign_mask, simde_mm256_castsi256_ps(simde_mm256_slli_epi32(q, 30))));
+    r = simde_mm256_xor_ps(r, simde_mm256_and_ps(sign_mask, a));
+
+    if (HEDLEY_UNLIKELY(simde_mm256_movemask_ps(in_range) != 0xff)) {
+      simde__m256_private
+        r_ = simde__m256_to_private(r),
+        a_ = simde__m256_to_private(a),
+        m_ = simde__m256_to_private(in_range);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f32) / sizeof(r_.f32[0])) ; i++) {
+        if (m_.i32[i] == 0)
+          r_.f32[i] = simde_math_sinf(a_.f32[i]);
+      }
+
+      r = simde__m256_from_private(r_);
+    }
+
+    return r;
   #else
     simde__m256_private
       r_,
@@ -9954,6 +11042,72 @@ simde_mm256_sin_pd (simde__m256d a) {
     #else
       return Sleef_sind4_u35(a);
     #endif
+  #elif (SIMDE_ACCURACY_PREFERENCE <= 1) && SIMDE_NATURAL_VECTOR_SIZE_GE(256)
+    /* Reduce |a| to xr = |a| - n * (pi / 2), |xr| <= pi / 4, and
+     * evaluate either the sine or the cosine polynomial depending on
+     * the quadrant.  Adding 1.5 * 2^52 rounds to the nearest integer
+     * and leaves n in the low bits of t.  Large inputs, infinities
+     * and NaNs are handled by libm. */
+    static const simde_float64 sin_coeffs[] = {
+      SIMDE_FLOAT64_C( 1.58962301576546568060e-10),
+      SIMDE_FLOAT64_C(-2.50507477628578072866e-08),
+      SIMDE_FLOAT64_C( 2.75573136213857245213e-06),
+      SIMDE_FLOAT64_C(-1.98412698295895385996e-04),
+      SIMDE_FLOAT64_C( 8.33333333332211858878e-03),
+      SIMDE_FLOAT64_C(-1.66666666666666307295e-01)
+    };
+    static const simde_float64 cos_coeffs[] = {
+      SIMDE_FLOAT64_C(-1.13585365213876817300e-11),
+      SIMDE_FLOAT64_C( 2.08757008419747316778e-09),
+      SIMDE_FLOAT64_C(-2.75573141792967388112e-07),
+      SIMDE_FLOAT64_C( 2.48015872888517045348e-05),
+      SIMDE_FLOAT64_C(-1.38888888888730564116e-03),
+      SIMDE_FLOAT64_C( 4.16666666666665929218e-02)
+    };
+    const simde__m256d sign_mask = simde_mm256_set1_pd(-SIMDE_FLOAT64_C(0.0));
+    const simde__m256d magic = simde_mm256_set1_pd(SIMDE_FLOAT64_C(6755399441055744.0));
+    const simde__m256d x = simde_mm256_andnot_pd(sign_mask, a);
+    const simde__m256d in_range = simde_mm256_cmp_pd(x, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1048576.0)), SIMDE_CMP_LE_OQ);
+    const simde__m256d t = simde_x_mm256_svml_fmadd_pd(x, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.636619772367581343075535053490057448)), magic);
+    const simde__m256d n = simde_mm256_sub_pd(t, magic);
+    const simde__m256i q = simde_mm256_castpd_si256(t);
+
+    simde__m256d xr = simde_x_mm256_svml_fnmadd_pd(n, simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.57079625129699707031e+00)), x);
+    xr = simde_x_mm256_svml_fnmadd_pd(n, simde_mm256_set1_pd(SIMDE_FLOAT64_C(7.54978941586159635336e-08)), xr);
+    xr = simde_x_mm256_svml_fnmadd_pd(n, simde_mm256_set1_pd(SIMDE_FLOAT64_C(5.39030285815811905290e-15)), xr);
+    const simde__m256d z = simde_mm256_mul_pd(xr, xr);
+
+    simde__m256d s = simde_mm256_set1_pd(sin_coeffs[0]);
+    for (size_t i = 1 ; i < (sizeof(sin_coeffs) / sizeof(sin_coeffs[0])) ; i++)
+      s = simde_x_mm256_svml_fmadd_pd(s, z, simde_mm256_set1_pd(sin_coeffs[i]));
+    s = simde_x_mm256_svml_fmadd_pd(simde_mm256_mul_pd(s, z), xr, xr);
+
+    simde__m256d c = simde_mm256_set1_pd(cos_coeffs[0]);
+    for (size_t i = 1 ; i < (sizeof(cos_coeffs) / sizeof(cos_coeffs[0])) ; i++)
+      c = simde_x_mm256_svml_fmadd_pd(c, z, simde_mm256_set1_pd(cos_coeffs[i]));
+    c = simde_x_mm256_svml_fmadd_pd(simde_mm256_mul_pd(c, z), z, simde_x_mm256_svml_fnmadd_pd(z, simde_mm256_set1_pd(SIMDE_FLOAT64_C(0.5)), simde_mm256_set1_pd(SIMDE_FLOAT64_C(1.0))));
+
+    /* Odd quadrants use the cosine polynomial, and the result is
+     * negated in quadrants 2 and 3 and for negative inputs. */
+    simde__m256d r = simde_mm256_blendv_pd(s, c, simde_mm256_castsi256_pd(simde_mm256_slli_epi64(q, 63)));
+    r = simde_mm256_xor_pd(r, simde_mm256_and_pd(sign_mask, simde_mm256_castsi256_pd(simde_mm256_slli_epi64(q, 62))));
+    r = simde_mm256_xor_pd(r, simde_mm256_and_pd(sign_mask, a));
+
+    if (HEDLEY_UNLIKELY(simde_mm256_movemask_pd(in_range) != 0xf)) {
+      simde__m256d_private
+        r_ = simde__m256d_to_private(r),
+        a_ = simde__m256d_to_private(a),
+        m_ = simde__m256d_to_private(in_range);
+
+      for (size_t i = 0 ; i < (sizeof(r_.f64) / sizeof(r_.f64[0])) ; i++) {
+        if (m_.i64[i] == 0)
+          r_.f64[i] = simde_math_sin(a_.f64[i]);
+      }
+
+      r = simde__m256d_from_private(r_);
+    }
+
+    return r;
   #else
     simde__m256d_private
       r_,
@@ -9994,7 +11148,7 @@ simde_mm512_sin_ps (simde__m512 a) {
       r_,
       a_ = simde__m512_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256) || ((SIMDE_ACCURACY_PREFERENCE <= 1) && SIMDE_NATURAL_VECTOR_SIZE_GE(256))
       for (size_t i = 0 ; i < (sizeof(r_.m256) / sizeof(r_.m256[0])) ; i++) {
         r_.m256[i] = simde_mm256_sin_ps(a_.m256[i]);
       }
@@ -10029,7 +11183,7 @@ simde_mm512_sin_pd (simde__m512d a) {
       r_,
       a_ = simde__m512d_to_private(a);
 
-    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256)
+    #if SIMDE_NATURAL_VECTOR_SIZE_LE(256) || ((SIMDE_ACCURACY_PREFERENCE <= 1) && SIMDE_NATURAL_VECTOR_SIZE_GE(256))
       for (size_t i = 0 ; i < (sizeof(r_.m256d) / sizeof(r_.m256d[0])) ; i++) {
         r_.m256d[i] = simde_mm256_sin_pd(a_.m256d[i]);
       }
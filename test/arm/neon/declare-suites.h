@@ -9,6 +9,7 @@ SIMDE_TEST_DECLARE_SUITE(addv)
 SIMDE_TEST_DECLARE_SUITE(addlv)
 SIMDE_TEST_DECLARE_SUITE(addw)
 SIMDE_TEST_DECLARE_SUITE(addw_high)
+SIMDE_TEST_DECLARE_SUITE(aes)
 SIMDE_TEST_DECLARE_SUITE(and)
 SIMDE_TEST_DECLARE_SUITE(bic)
 SIMDE_TEST_DECLARE_SUITE(bsl)
@@ -35,11 +36,18 @@ SIMDE_TEST_DECLARE_SUITE(dup_n)
 SIMDE_TEST_DECLARE_SUITE(dup_lane)
 SIMDE_TEST_DECLARE_SUITE(eor)
 SIMDE_TEST_DECLARE_SUITE(ext)
+SIMDE_TEST_DECLARE_SUITE(fma)
+SIMDE_TEST_DECLARE_SUITE(fma_lane)
+SIMDE_TEST_DECLARE_SUITE(fma_n)
+SIMDE_TEST_DECLARE_SUITE(fms)
+SIMDE_TEST_DECLARE_SUITE(fms_lane)
+SIMDE_TEST_DECLARE_SUITE(fms_n)
 SIMDE_TEST_DECLARE_SUITE(get_high)
 SIMDE_TEST_DECLARE_SUITE(get_lane)
 SIMDE_TEST_DECLARE_SUITE(get_low)
 SIMDE_TEST_DECLARE_SUITE(hadd)
 SIMDE_TEST_DECLARE_SUITE(hsub)
+SIMDE_TEST_DECLARE_SUITE(ld2)
 SIMDE_TEST_DECLARE_SUITE(max)
 SIMDE_TEST_DECLARE_SUITE(maxnm)
 SIMDE_TEST_DECLARE_SUITE(maxv)
@@ -89,6 +97,8 @@ SIMDE_TEST_DECLARE_SUITE(qsub)
 SIMDE_TEST_DECLARE_SUITE(qtbl)
 SIMDE_TEST_DECLARE_SUITE(qtbx)
 SIMDE_TEST_DECLARE_SUITE(rbit)
+SIMDE_TEST_DECLARE_SUITE(recpe)
+SIMDE_TEST_DECLARE_SUITE(recps)
 SIMDE_TEST_DECLARE_SUITE(reinterpret)
 SIMDE_TEST_DECLARE_SUITE(rev16)
 SIMDE_TEST_DECLARE_SUITE(rev32)
@@ -97,9 +107,14 @@ SIMDE_TEST_DECLARE_SUITE(rhadd)
 SIMDE_TEST_DECLARE_SUITE(rnd)
 SIMDE_TEST_DECLARE_SUITE(rshl)
 SIMDE_TEST_DECLARE_SUITE(rshr_n)
+SIMDE_TEST_DECLARE_SUITE(rsqrte)
+SIMDE_TEST_DECLARE_SUITE(rsqrts)
 SIMDE_TEST_DECLARE_SUITE(rsra_n)
 SIMDE_TEST_DECLARE_SUITE(set_lane)
+SIMDE_TEST_DECLARE_SUITE(sha1)
+SIMDE_TEST_DECLARE_SUITE(sha256)
 SIMDE_TEST_DECLARE_SUITE(st1_lane)
+SIMDE_TEST_DECLARE_SUITE(st2)
 SIMDE_TEST_DECLARE_SUITE(st3)
 SIMDE_TEST_DECLARE_SUITE(st4)
 SIMDE_TEST_DECLARE_SUITE(shl)
@@ -0,0 +1,229 @@
+#define SIMDE_TEST_ARM_NEON_INSN fma
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/fma.h"
+
+static int
+test_simde_vfma_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 b[2];
+    simde_float32 c[2];
+    simde_float32 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(      42.47), SIMDE_FLOAT32_C(      67.96) },
+      { SIMDE_FLOAT32_C(     -63.48), SIMDE_FLOAT32_C(      99.66) },
+      { SIMDE_FLOAT32_C(     -61.18), SIMDE_FLOAT32_C(      34.18) },
+      { SIMDE_FLOAT32_C(  3926.1765), SIMDE_FLOAT32_C(  3474.3389) } },
+    { { SIMDE_FLOAT32_C(     -81.64), SIMDE_FLOAT32_C(      51.55) },
+      { SIMDE_FLOAT32_C(     -69.74), SIMDE_FLOAT32_C(      41.31) },
+      { SIMDE_FLOAT32_C(      44.89), SIMDE_FLOAT32_C(      53.19) },
+      { SIMDE_FLOAT32_C( -3212.2686), SIMDE_FLOAT32_C(  2248.8289) } },
+    { { SIMDE_FLOAT32_C(     -11.72), SIMDE_FLOAT32_C(      73.15) },
+      { SIMDE_FLOAT32_C(      97.58), SIMDE_FLOAT32_C(     -76.88) },
+      { SIMDE_FLOAT32_C(       3.38), SIMDE_FLOAT32_C(      91.63) },
+      { SIMDE_FLOAT32_C(   318.1004), SIMDE_FLOAT32_C( -6971.3638) } },
+    { { SIMDE_FLOAT32_C(      47.83), SIMDE_FLOAT32_C(     -11.16) },
+      { SIMDE_FLOAT32_C(     -39.08), SIMDE_FLOAT32_C(      90.61) },
+      { SIMDE_FLOAT32_C(     -82.98), SIMDE_FLOAT32_C(      52.11) },
+      { SIMDE_FLOAT32_C(  3290.6887), SIMDE_FLOAT32_C(  4710.5273) } },
+    { { SIMDE_FLOAT32_C(      68.65), SIMDE_FLOAT32_C(     -68.46) },
+      { SIMDE_FLOAT32_C(     -34.63), SIMDE_FLOAT32_C(     -38.93) },
+      { SIMDE_FLOAT32_C(       8.42), SIMDE_FLOAT32_C(     -26.60) },
+      { SIMDE_FLOAT32_C(  -222.9346), SIMDE_FLOAT32_C(   967.0780) } },
+    { { SIMDE_FLOAT32_C(      78.74), SIMDE_FLOAT32_C(      84.93) },
+      { SIMDE_FLOAT32_C(     -36.77), SIMDE_FLOAT32_C(      78.96) },
+      { SIMDE_FLOAT32_C(     -86.08), SIMDE_FLOAT32_C(     -80.62) },
+      { SIMDE_FLOAT32_C(  3243.9016), SIMDE_FLOAT32_C( -6280.8252) } },
+    { { SIMDE_FLOAT32_C(      33.03), SIMDE_FLOAT32_C(      59.81) },
+      { SIMDE_FLOAT32_C(      63.83), SIMDE_FLOAT32_C(      98.40) },
+      { SIMDE_FLOAT32_C(      71.95), SIMDE_FLOAT32_C(     -46.72) },
+      { SIMDE_FLOAT32_C(  4625.5986), SIMDE_FLOAT32_C( -4537.4380) } },
+    { { SIMDE_FLOAT32_C(      48.56), SIMDE_FLOAT32_C(      84.93) },
+      { SIMDE_FLOAT32_C(     -81.28), SIMDE_FLOAT32_C(      -1.11) },
+      { SIMDE_FLOAT32_C(     -69.14), SIMDE_FLOAT32_C(     -71.38) },
+      { SIMDE_FLOAT32_C(  5668.2593), SIMDE_FLOAT32_C(   164.1618) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32x2_t b = simde_vld1_f32(test_vec[i].b);
+    simde_float32x2_t c = simde_vld1_f32(test_vec[i].c);
+    simde_float32x2_t r = simde_vfma_f32(a, b, c);
+
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfma_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[1];
+    simde_float64 b[1];
+    simde_float64 c[1];
+    simde_float64 r[1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(      -4.09) },
+      { SIMDE_FLOAT64_C(      34.08) },
+      { SIMDE_FLOAT64_C(      94.75) },
+      { SIMDE_FLOAT64_C(  3224.9900) } },
+    { { SIMDE_FLOAT64_C(     -73.73) },
+      { SIMDE_FLOAT64_C(       1.09) },
+      { SIMDE_FLOAT64_C(      99.47) },
+      { SIMDE_FLOAT64_C(    34.6923) } },
+    { { SIMDE_FLOAT64_C(      53.00) },
+      { SIMDE_FLOAT64_C(       6.42) },
+      { SIMDE_FLOAT64_C(     -51.48) },
+      { SIMDE_FLOAT64_C(  -277.5016) } },
+    { { SIMDE_FLOAT64_C(      26.19) },
+      { SIMDE_FLOAT64_C(     -47.81) },
+      { SIMDE_FLOAT64_C(      28.78) },
+      { SIMDE_FLOAT64_C( -1349.7818) } },
+    { { SIMDE_FLOAT64_C(      29.74) },
+      { SIMDE_FLOAT64_C(     -21.75) },
+      { SIMDE_FLOAT64_C(      58.95) },
+      { SIMDE_FLOAT64_C( -1252.4225) } },
+    { { SIMDE_FLOAT64_C(     -19.29) },
+      { SIMDE_FLOAT64_C(      -6.22) },
+      { SIMDE_FLOAT64_C(      66.33) },
+      { SIMDE_FLOAT64_C(  -431.8626) } },
+    { { SIMDE_FLOAT64_C(     -49.89) },
+      { SIMDE_FLOAT64_C(     -62.90) },
+      { SIMDE_FLOAT64_C(      14.87) },
+      { SIMDE_FLOAT64_C(  -985.2130) } },
+    { { SIMDE_FLOAT64_C(     -13.08) },
+      { SIMDE_FLOAT64_C(      74.83) },
+      { SIMDE_FLOAT64_C(     -50.21) },
+      { SIMDE_FLOAT64_C( -3770.2943) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_float64x1_t b = simde_vld1_f64(test_vec[i].b);
+    simde_float64x1_t c = simde_vld1_f64(test_vec[i].c);
+    simde_float64x1_t r = simde_vfma_f64(a, b, c);
+
+    simde_test_arm_neon_assert_equal_f64x1(r, simde_vld1_f64(test_vec[i].r), 2);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfmaq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 b[4];
+    simde_float32 c[4];
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(     -25.74), SIMDE_FLOAT32_C(     -88.45), SIMDE_FLOAT32_C(      -9.83), SIMDE_FLOAT32_C(     -37.49) },
+      { SIMDE_FLOAT32_C(     -10.25), SIMDE_FLOAT32_C(      52.80), SIMDE_FLOAT32_C(     -92.51), SIMDE_FLOAT32_C(      97.85) },
+      { SIMDE_FLOAT32_C(      42.29), SIMDE_FLOAT32_C(      62.27), SIMDE_FLOAT32_C(       7.76), SIMDE_FLOAT32_C(      15.27) },
+      { SIMDE_FLOAT32_C(  -459.2125), SIMDE_FLOAT32_C(  3199.4060), SIMDE_FLOAT32_C(  -727.7076), SIMDE_FLOAT32_C(  1456.6796) } },
+    { { SIMDE_FLOAT32_C(     -18.09), SIMDE_FLOAT32_C(     -20.77), SIMDE_FLOAT32_C(     -55.84), SIMDE_FLOAT32_C(     -39.40) },
+      { SIMDE_FLOAT32_C(     -41.23), SIMDE_FLOAT32_C(     -32.77), SIMDE_FLOAT32_C(      81.44), SIMDE_FLOAT32_C(      59.68) },
+      { SIMDE_FLOAT32_C(      28.22), SIMDE_FLOAT32_C(     -96.56), SIMDE_FLOAT32_C(     -47.53), SIMDE_FLOAT32_C(       8.64) },
+      { SIMDE_FLOAT32_C( -1181.6006), SIMDE_FLOAT32_C(  3143.5012), SIMDE_FLOAT32_C( -3926.6831), SIMDE_FLOAT32_C(   476.2352) } },
+    { { SIMDE_FLOAT32_C(      38.42), SIMDE_FLOAT32_C(     -16.15), SIMDE_FLOAT32_C(      26.54), SIMDE_FLOAT32_C(      81.02) },
+      { SIMDE_FLOAT32_C(     -46.50), SIMDE_FLOAT32_C(     -23.59), SIMDE_FLOAT32_C(      52.05), SIMDE_FLOAT32_C(     -36.28) },
+      { SIMDE_FLOAT32_C(      44.27), SIMDE_FLOAT32_C(     -20.57), SIMDE_FLOAT32_C(     -96.12), SIMDE_FLOAT32_C(      -7.48) },
+      { SIMDE_FLOAT32_C( -2020.1350), SIMDE_FLOAT32_C(   469.0963), SIMDE_FLOAT32_C( -4976.5059), SIMDE_FLOAT32_C(   352.3944) } },
+    { { SIMDE_FLOAT32_C(     -86.38), SIMDE_FLOAT32_C(      56.94), SIMDE_FLOAT32_C(      69.01), SIMDE_FLOAT32_C(       5.91) },
+      { SIMDE_FLOAT32_C(      79.86), SIMDE_FLOAT32_C(     -57.39), SIMDE_FLOAT32_C(     -10.86), SIMDE_FLOAT32_C(     -64.87) },
+      { SIMDE_FLOAT32_C(     -90.27), SIMDE_FLOAT32_C(      64.89), SIMDE_FLOAT32_C(     -89.56), SIMDE_FLOAT32_C(      86.90) },
+      { SIMDE_FLOAT32_C( -7295.3418), SIMDE_FLOAT32_C( -3667.0969), SIMDE_FLOAT32_C(  1041.6316), SIMDE_FLOAT32_C( -5631.2935) } },
+    { { SIMDE_FLOAT32_C(      11.35), SIMDE_FLOAT32_C(      40.14), SIMDE_FLOAT32_C(     -90.08), SIMDE_FLOAT32_C(      81.46) },
+      { SIMDE_FLOAT32_C(      58.75), SIMDE_FLOAT32_C(     -79.23), SIMDE_FLOAT32_C(     -63.43), SIMDE_FLOAT32_C(     -71.84) },
+      { SIMDE_FLOAT32_C(       0.81), SIMDE_FLOAT32_C(     -84.26), SIMDE_FLOAT32_C(      59.70), SIMDE_FLOAT32_C(      -0.71) },
+      { SIMDE_FLOAT32_C(    58.9375), SIMDE_FLOAT32_C(  6716.0601), SIMDE_FLOAT32_C( -3876.8511), SIMDE_FLOAT32_C(   132.4664) } },
+    { { SIMDE_FLOAT32_C(      40.82), SIMDE_FLOAT32_C(     -49.08), SIMDE_FLOAT32_C(      30.81), SIMDE_FLOAT32_C(      -9.29) },
+      { SIMDE_FLOAT32_C(      29.67), SIMDE_FLOAT32_C(     -17.85), SIMDE_FLOAT32_C(      97.95), SIMDE_FLOAT32_C(      69.25) },
+      { SIMDE_FLOAT32_C(      66.54), SIMDE_FLOAT32_C(     -31.75), SIMDE_FLOAT32_C(     -61.78), SIMDE_FLOAT32_C(     -69.32) },
+      { SIMDE_FLOAT32_C(  2015.0619), SIMDE_FLOAT32_C(   517.6575), SIMDE_FLOAT32_C( -6020.5405), SIMDE_FLOAT32_C( -4809.7002) } },
+    { { SIMDE_FLOAT32_C(     -73.68), SIMDE_FLOAT32_C(      93.48), SIMDE_FLOAT32_C(     -43.57), SIMDE_FLOAT32_C(      74.11) },
+      { SIMDE_FLOAT32_C(     -53.56), SIMDE_FLOAT32_C(      23.94), SIMDE_FLOAT32_C(     -50.16), SIMDE_FLOAT32_C(     -38.57) },
+      { SIMDE_FLOAT32_C(      49.52), SIMDE_FLOAT32_C(      21.68), SIMDE_FLOAT32_C(      89.18), SIMDE_FLOAT32_C(     -52.51) },
+      { SIMDE_FLOAT32_C( -2725.9712), SIMDE_FLOAT32_C(   612.4992), SIMDE_FLOAT32_C( -4516.8389), SIMDE_FLOAT32_C(  2099.4207) } },
+    { { SIMDE_FLOAT32_C(     -45.91), SIMDE_FLOAT32_C(     -87.44), SIMDE_FLOAT32_C(     -57.19), SIMDE_FLOAT32_C(      96.13) },
+      { SIMDE_FLOAT32_C(      12.76), SIMDE_FLOAT32_C(      -4.90), SIMDE_FLOAT32_C(     -31.83), SIMDE_FLOAT32_C(      51.94) },
+      { SIMDE_FLOAT32_C(      37.83), SIMDE_FLOAT32_C(     -68.88), SIMDE_FLOAT32_C(     -90.74), SIMDE_FLOAT32_C(     -65.30) },
+      { SIMDE_FLOAT32_C(   436.8008), SIMDE_FLOAT32_C(   250.0720), SIMDE_FLOAT32_C(  2831.0642), SIMDE_FLOAT32_C( -3295.5520) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32x4_t b = simde_vld1q_f32(test_vec[i].b);
+    simde_float32x4_t c = simde_vld1q_f32(test_vec[i].c);
+    simde_float32x4_t r = simde_vfmaq_f32(a, b, c);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfmaq_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 b[2];
+    simde_float64 c[2];
+    simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(      63.43), SIMDE_FLOAT64_C(      46.58) },
+      { SIMDE_FLOAT64_C(     -54.72), SIMDE_FLOAT64_C(     -53.16) },
+      { SIMDE_FLOAT64_C(     -38.54), SIMDE_FLOAT64_C(      35.85) },
+      { SIMDE_FLOAT64_C(  2172.3388), SIMDE_FLOAT64_C( -1859.2060) } },
+    { { SIMDE_FLOAT64_C(      49.67), SIMDE_FLOAT64_C(     -52.34) },
+      { SIMDE_FLOAT64_C(     -34.20), SIMDE_FLOAT64_C(     -52.56) },
+      { SIMDE_FLOAT64_C(      89.13), SIMDE_FLOAT64_C(      10.34) },
+      { SIMDE_FLOAT64_C( -2998.5760), SIMDE_FLOAT64_C(  -595.8104) } },
+    { { SIMDE_FLOAT64_C(      87.94), SIMDE_FLOAT64_C(     -51.56) },
+      { SIMDE_FLOAT64_C(      26.52), SIMDE_FLOAT64_C(      13.76) },
+      { SIMDE_FLOAT64_C(      86.40), SIMDE_FLOAT64_C(     -27.10) },
+      { SIMDE_FLOAT64_C(  2379.2680), SIMDE_FLOAT64_C(  -424.4560) } },
+    { { SIMDE_FLOAT64_C(     -54.30), SIMDE_FLOAT64_C(      63.54) },
+      { SIMDE_FLOAT64_C(      90.54), SIMDE_FLOAT64_C(       1.76) },
+      { SIMDE_FLOAT64_C(     -33.46), SIMDE_FLOAT64_C(     -82.95) },
+      { SIMDE_FLOAT64_C( -3083.7684), SIMDE_FLOAT64_C(   -82.4520) } },
+    { { SIMDE_FLOAT64_C(     -11.15), SIMDE_FLOAT64_C(      85.02) },
+      { SIMDE_FLOAT64_C(     -28.55), SIMDE_FLOAT64_C(     -10.26) },
+      { SIMDE_FLOAT64_C(      12.87), SIMDE_FLOAT64_C(     -52.43) },
+      { SIMDE_FLOAT64_C(  -378.5885), SIMDE_FLOAT64_C(   622.9518) } },
+    { { SIMDE_FLOAT64_C(     -78.30), SIMDE_FLOAT64_C(       3.80) },
+      { SIMDE_FLOAT64_C(      93.46), SIMDE_FLOAT64_C(      74.39) },
+      { SIMDE_FLOAT64_C(     -39.60), SIMDE_FLOAT64_C(      56.86) },
+      { SIMDE_FLOAT64_C( -3779.3160), SIMDE_FLOAT64_C(  4233.6154) } },
+    { { SIMDE_FLOAT64_C(      66.39), SIMDE_FLOAT64_C(      16.65) },
+      { SIMDE_FLOAT64_C(     -28.10), SIMDE_FLOAT64_C(     -60.83) },
+      { SIMDE_FLOAT64_C(      40.72), SIMDE_FLOAT64_C(      37.28) },
+      { SIMDE_FLOAT64_C( -1077.8420), SIMDE_FLOAT64_C( -2251.0924) } },
+    { { SIMDE_FLOAT64_C(     -57.26), SIMDE_FLOAT64_C(     -71.73) },
+      { SIMDE_FLOAT64_C(     -77.20), SIMDE_FLOAT64_C(      65.66) },
+      { SIMDE_FLOAT64_C(      77.10), SIMDE_FLOAT64_C(       3.37) },
+      { SIMDE_FLOAT64_C( -6009.3800), SIMDE_FLOAT64_C(   149.5442) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64x2_t b = simde_vld1q_f64(test_vec[i].b);
+    simde_float64x2_t c = simde_vld1q_f64(test_vec[i].c);
+    simde_float64x2_t r = simde_vfmaq_f64(a, b, c);
+
+    simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 2);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vfma_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfma_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmaq_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmaq_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,533 @@
+#define SIMDE_TEST_ARM_NEON_INSN fma_lane
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/fma_lane.h"
+
+static int
+test_simde_vfma_lane_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 b[2];
+    simde_float32 c[2];
+    int8_t lane;
+    simde_float32 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(      22.19), SIMDE_FLOAT32_C(      41.47) },
+      { SIMDE_FLOAT32_C(     -68.63), SIMDE_FLOAT32_C(       3.90) },
+      { SIMDE_FLOAT32_C(     -10.37), SIMDE_FLOAT32_C(      73.90) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(   733.8831), SIMDE_FLOAT32_C(     1.0270) } },
+    { { SIMDE_FLOAT32_C(     -43.04), SIMDE_FLOAT32_C(      15.86) },
+      { SIMDE_FLOAT32_C(     -23.78), SIMDE_FLOAT32_C(     -96.78) },
+      { SIMDE_FLOAT32_C(      69.04), SIMDE_FLOAT32_C(     -51.70) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C( -1684.8113), SIMDE_FLOAT32_C( -6665.8311) } },
+    { { SIMDE_FLOAT32_C(     -50.57), SIMDE_FLOAT32_C(      54.37) },
+      { SIMDE_FLOAT32_C(      90.70), SIMDE_FLOAT32_C(      53.28) },
+      { SIMDE_FLOAT32_C(     -72.14), SIMDE_FLOAT32_C(       7.46) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C( -6593.6675), SIMDE_FLOAT32_C( -3789.2490) } },
+    { { SIMDE_FLOAT32_C(      68.36), SIMDE_FLOAT32_C(     -29.96) },
+      { SIMDE_FLOAT32_C(     -80.85), SIMDE_FLOAT32_C(      27.50) },
+      { SIMDE_FLOAT32_C(     -77.53), SIMDE_FLOAT32_C(      25.24) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(  6336.6602), SIMDE_FLOAT32_C( -2162.0349) } },
+    { { SIMDE_FLOAT32_C(      32.35), SIMDE_FLOAT32_C(      96.72) },
+      { SIMDE_FLOAT32_C(     -54.32), SIMDE_FLOAT32_C(      15.65) },
+      { SIMDE_FLOAT32_C(     -31.39), SIMDE_FLOAT32_C(      20.12) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(  1737.4547), SIMDE_FLOAT32_C(  -394.5335) } },
+    { { SIMDE_FLOAT32_C(      94.79), SIMDE_FLOAT32_C(     -49.08) },
+      { SIMDE_FLOAT32_C(      -4.98), SIMDE_FLOAT32_C(     -23.74) },
+      { SIMDE_FLOAT32_C(     -87.60), SIMDE_FLOAT32_C(       7.89) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(    55.4978), SIMDE_FLOAT32_C(  -236.3886) } },
+    { { SIMDE_FLOAT32_C(     -60.35), SIMDE_FLOAT32_C(      68.27) },
+      { SIMDE_FLOAT32_C(      58.23), SIMDE_FLOAT32_C(      47.59) },
+      { SIMDE_FLOAT32_C(      97.18), SIMDE_FLOAT32_C(     -67.13) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(  5598.4414), SIMDE_FLOAT32_C(  4693.0664) } },
+    { { SIMDE_FLOAT32_C(      89.45), SIMDE_FLOAT32_C(      75.33) },
+      { SIMDE_FLOAT32_C(     -72.30), SIMDE_FLOAT32_C(     -85.45) },
+      { SIMDE_FLOAT32_C(       5.58), SIMDE_FLOAT32_C(      49.64) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(  -313.9840), SIMDE_FLOAT32_C(  -401.4810) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32x2_t b = simde_vld1_f32(test_vec[i].b);
+    simde_float32x2_t c = simde_vld1_f32(test_vec[i].c);
+
+    simde_float32x2_t r;
+    SIMDE_CONSTIFY_2_(simde_vfma_lane_f32, r, (HEDLEY_UNREACHABLE(), simde_vdup_n_f32(SIMDE_FLOAT32_C(0.0))), test_vec[i].lane, a, b, c);
+
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfma_lane_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[1];
+    simde_float64 b[1];
+    simde_float64 c[1];
+    int8_t lane;
+    simde_float64 r[1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(      47.18) },
+      { SIMDE_FLOAT64_C(      66.95) },
+      { SIMDE_FLOAT64_C(      55.67) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(  3774.2865) } },
+    { { SIMDE_FLOAT64_C(      15.13) },
+      { SIMDE_FLOAT64_C(     -65.69) },
+      { SIMDE_FLOAT64_C(     -26.08) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(  1728.3252) } },
+    { { SIMDE_FLOAT64_C(      23.94) },
+      { SIMDE_FLOAT64_C(     -74.48) },
+      { SIMDE_FLOAT64_C(     -67.92) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(  5082.6216) } },
+    { { SIMDE_FLOAT64_C(     -15.56) },
+      { SIMDE_FLOAT64_C(     -62.44) },
+      { SIMDE_FLOAT64_C(      94.09) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C( -5890.5396) } },
+    { { SIMDE_FLOAT64_C(     -13.18) },
+      { SIMDE_FLOAT64_C(      71.43) },
+      { SIMDE_FLOAT64_C(     -40.67) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C( -2918.2381) } },
+    { { SIMDE_FLOAT64_C(      -4.51) },
+      { SIMDE_FLOAT64_C(     -56.32) },
+      { SIMDE_FLOAT64_C(     -46.36) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(  2606.4852) } },
+    { { SIMDE_FLOAT64_C(       0.71) },
+      { SIMDE_FLOAT64_C(      49.47) },
+      { SIMDE_FLOAT64_C(      20.57) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(  1018.3079) } },
+    { { SIMDE_FLOAT64_C(     -44.90) },
+      { SIMDE_FLOAT64_C(      44.34) },
+      { SIMDE_FLOAT64_C(     -74.73) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C( -3358.4282) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_float64x1_t b = simde_vld1_f64(test_vec[i].b);
+    simde_float64x1_t c = simde_vld1_f64(test_vec[i].c);
+    simde_float64x1_t r = simde_vfma_lane_f64(a, b, c, 0);
+
+    simde_test_arm_neon_assert_equal_f64x1(r, simde_vld1_f64(test_vec[i].r), 2);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfma_laneq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 b[2];
+    simde_float32 c[4];
+    int8_t lane;
+    simde_float32 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(     -71.59), SIMDE_FLOAT32_C(     -99.52) },
+      { SIMDE_FLOAT32_C(      82.83), SIMDE_FLOAT32_C(     -62.70) },
+      { SIMDE_FLOAT32_C(       6.62), SIMDE_FLOAT32_C(     -42.01), SIMDE_FLOAT32_C(     -72.58), SIMDE_FLOAT32_C(     -48.37) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(   476.7446), SIMDE_FLOAT32_C(  -514.5940) } },
+    { { SIMDE_FLOAT32_C(     -58.57), SIMDE_FLOAT32_C(     -79.98) },
+      { SIMDE_FLOAT32_C(     -13.53), SIMDE_FLOAT32_C(     -39.55) },
+      { SIMDE_FLOAT32_C(      20.14), SIMDE_FLOAT32_C(      44.58), SIMDE_FLOAT32_C(      75.88), SIMDE_FLOAT32_C(     -53.24) },
+       INT8_C(   3),
+      { SIMDE_FLOAT32_C(   661.7672), SIMDE_FLOAT32_C(  2025.6620) } },
+    { { SIMDE_FLOAT32_C(      89.70), SIMDE_FLOAT32_C(      68.63) },
+      { SIMDE_FLOAT32_C(      22.62), SIMDE_FLOAT32_C(      -0.49) },
+      { SIMDE_FLOAT32_C(     -77.07), SIMDE_FLOAT32_C(     -93.48), SIMDE_FLOAT32_C(      23.81), SIMDE_FLOAT32_C(      92.36) },
+       INT8_C(   3),
+      { SIMDE_FLOAT32_C(  2178.8833), SIMDE_FLOAT32_C(    23.3736) } },
+    { { SIMDE_FLOAT32_C(     -13.23), SIMDE_FLOAT32_C(      -5.93) },
+      { SIMDE_FLOAT32_C(     -80.11), SIMDE_FLOAT32_C(     -27.33) },
+      { SIMDE_FLOAT32_C(      93.84), SIMDE_FLOAT32_C(      20.96), SIMDE_FLOAT32_C(     -21.61), SIMDE_FLOAT32_C(      77.64) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C( -1692.3356), SIMDE_FLOAT32_C(  -578.7668) } },
+    { { SIMDE_FLOAT32_C(      95.23), SIMDE_FLOAT32_C(      64.86) },
+      { SIMDE_FLOAT32_C(     -81.03), SIMDE_FLOAT32_C(      -5.98) },
+      { SIMDE_FLOAT32_C(      63.89), SIMDE_FLOAT32_C(      70.44), SIMDE_FLOAT32_C(     -96.73), SIMDE_FLOAT32_C(      57.31) },
+       INT8_C(   3),
+      { SIMDE_FLOAT32_C( -4548.5991), SIMDE_FLOAT32_C(  -277.8538) } },
+    { { SIMDE_FLOAT32_C(      26.29), SIMDE_FLOAT32_C(     -93.73) },
+      { SIMDE_FLOAT32_C(     -49.22), SIMDE_FLOAT32_C(      33.82) },
+      { SIMDE_FLOAT32_C(      19.15), SIMDE_FLOAT32_C(      82.43), SIMDE_FLOAT32_C(     -65.91), SIMDE_FLOAT32_C(      77.29) },
+       INT8_C(   2),
+      { SIMDE_FLOAT32_C(  3270.3804), SIMDE_FLOAT32_C( -2322.8064) } },
+    { { SIMDE_FLOAT32_C(     -75.79), SIMDE_FLOAT32_C(     -28.88) },
+      { SIMDE_FLOAT32_C(       2.86), SIMDE_FLOAT32_C(      50.95) },
+      { SIMDE_FLOAT32_C(      36.01), SIMDE_FLOAT32_C(      28.24), SIMDE_FLOAT32_C(      42.10), SIMDE_FLOAT32_C(     -29.43) },
+       INT8_C(   2),
+      { SIMDE_FLOAT32_C(    44.6160), SIMDE_FLOAT32_C(  2116.1150) } },
+    { { SIMDE_FLOAT32_C(      93.09), SIMDE_FLOAT32_C(     -70.99) },
+      { SIMDE_FLOAT32_C(      95.58), SIMDE_FLOAT32_C(     -52.54) },
+      { SIMDE_FLOAT32_C(     -73.67), SIMDE_FLOAT32_C(     -71.13), SIMDE_FLOAT32_C(     -54.01), SIMDE_FLOAT32_C(     -15.88) },
+       INT8_C(   3),
+      { SIMDE_FLOAT32_C( -1424.7205), SIMDE_FLOAT32_C(   763.3452) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32x2_t b = simde_vld1_f32(test_vec[i].b);
+    simde_float32x4_t c = simde_vld1q_f32(test_vec[i].c);
+
+    simde_float32x2_t r;
+    SIMDE_CONSTIFY_4_(simde_vfma_laneq_f32, r, (HEDLEY_UNREACHABLE(), simde_vdup_n_f32(SIMDE_FLOAT32_C(0.0))), test_vec[i].lane, a, b, c);
+
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfma_laneq_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[1];
+    simde_float64 b[1];
+    simde_float64 c[2];
+    int8_t lane;
+    simde_float64 r[1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(      85.10) },
+      { SIMDE_FLOAT64_C(      15.36) },
+      { SIMDE_FLOAT64_C(     -14.80), SIMDE_FLOAT64_C(     -19.58) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(  -142.2280) } },
+    { { SIMDE_FLOAT64_C(     -38.50) },
+      { SIMDE_FLOAT64_C(     -20.41) },
+      { SIMDE_FLOAT64_C(     -58.83), SIMDE_FLOAT64_C(     -76.63) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C(  1525.5183) } },
+    { { SIMDE_FLOAT64_C(     -73.89) },
+      { SIMDE_FLOAT64_C(      -7.68) },
+      { SIMDE_FLOAT64_C(      98.55), SIMDE_FLOAT64_C(      26.51) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(  -830.7540) } },
+    { { SIMDE_FLOAT64_C(      53.60) },
+      { SIMDE_FLOAT64_C(      13.03) },
+      { SIMDE_FLOAT64_C(     -56.35), SIMDE_FLOAT64_C(     -65.68) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C(  -802.2104) } },
+    { { SIMDE_FLOAT64_C(      28.88) },
+      { SIMDE_FLOAT64_C(      35.05) },
+      { SIMDE_FLOAT64_C(     -80.64), SIMDE_FLOAT64_C(      76.47) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C( -2797.5520) } },
+    { { SIMDE_FLOAT64_C(      34.85) },
+      { SIMDE_FLOAT64_C(     -60.65) },
+      { SIMDE_FLOAT64_C(     -29.75), SIMDE_FLOAT64_C(       2.61) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C(  -123.4465) } },
+    { { SIMDE_FLOAT64_C(     -51.37) },
+      { SIMDE_FLOAT64_C(     -11.71) },
+      { SIMDE_FLOAT64_C(     -51.86), SIMDE_FLOAT64_C(      -3.38) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C(   -11.7902) } },
+    { { SIMDE_FLOAT64_C(      35.67) },
+      { SIMDE_FLOAT64_C(     -59.42) },
+      { SIMDE_FLOAT64_C(      83.14), SIMDE_FLOAT64_C(      75.42) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C( -4445.7864) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_float64x1_t b = simde_vld1_f64(test_vec[i].b);
+    simde_float64x2_t c = simde_vld1q_f64(test_vec[i].c);
+
+    simde_float64x1_t r;
+    SIMDE_CONSTIFY_2_(simde_vfma_laneq_f64, r, (HEDLEY_UNREACHABLE(), simde_vdup_n_f64(SIMDE_FLOAT64_C(0.0))), test_vec[i].lane, a, b, c);
+
+    simde_test_arm_neon_assert_equal_f64x1(r, simde_vld1_f64(test_vec[i].r), 2);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfmaq_lane_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 b[4];
+    simde_float32 c[2];
+    int8_t lane;
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(      82.03), SIMDE_FLOAT32_C(     -89.53), SIMDE_FLOAT32_C(      99.51), SIMDE_FLOAT32_C(     -72.53) },
+      { SIMDE_FLOAT32_C(     -62.29), SIMDE_FLOAT32_C(      62.21), SIMDE_FLOAT32_C(      68.29), SIMDE_FLOAT32_C(     -58.15) },
+      { SIMDE_FLOAT32_C(     -77.84), SIMDE_FLOAT32_C(     -39.27) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(  2528.1584), SIMDE_FLOAT32_C( -2532.5166), SIMDE_FLOAT32_C( -2582.2383), SIMDE_FLOAT32_C(  2211.0205) } },
+    { { SIMDE_FLOAT32_C(      94.34), SIMDE_FLOAT32_C(     -36.07), SIMDE_FLOAT32_C(      64.02), SIMDE_FLOAT32_C(     -34.03) },
+      { SIMDE_FLOAT32_C(     -17.93), SIMDE_FLOAT32_C(       2.87), SIMDE_FLOAT32_C(      -9.13), SIMDE_FLOAT32_C(      50.28) },
+      { SIMDE_FLOAT32_C(     -37.15), SIMDE_FLOAT32_C(      88.38) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(   760.4395), SIMDE_FLOAT32_C(  -142.6905), SIMDE_FLOAT32_C(   403.1995), SIMDE_FLOAT32_C( -1901.9320) } },
+    { { SIMDE_FLOAT32_C(      51.66), SIMDE_FLOAT32_C(     -90.64), SIMDE_FLOAT32_C(     -85.79), SIMDE_FLOAT32_C(      63.35) },
+      { SIMDE_FLOAT32_C(     -23.23), SIMDE_FLOAT32_C(     -79.14), SIMDE_FLOAT32_C(     -52.72), SIMDE_FLOAT32_C(     -94.76) },
+      { SIMDE_FLOAT32_C(     -44.86), SIMDE_FLOAT32_C(     -64.43) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(  1093.7578), SIMDE_FLOAT32_C(  3459.5803), SIMDE_FLOAT32_C(  2279.2292), SIMDE_FLOAT32_C(  4314.2837) } },
+    { { SIMDE_FLOAT32_C(      99.44), SIMDE_FLOAT32_C(     -74.83), SIMDE_FLOAT32_C(     -95.48), SIMDE_FLOAT32_C(     -59.69) },
+      { SIMDE_FLOAT32_C(      -2.84), SIMDE_FLOAT32_C(     -83.09), SIMDE_FLOAT32_C(      26.52), SIMDE_FLOAT32_C(      76.99) },
+      { SIMDE_FLOAT32_C(      37.57), SIMDE_FLOAT32_C(      59.40) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(   -69.2560), SIMDE_FLOAT32_C( -5010.3760), SIMDE_FLOAT32_C(  1479.8081), SIMDE_FLOAT32_C(  4513.5161) } },
+    { { SIMDE_FLOAT32_C(      70.42), SIMDE_FLOAT32_C(      25.71), SIMDE_FLOAT32_C(     -14.94), SIMDE_FLOAT32_C(     -26.40) },
+      { SIMDE_FLOAT32_C(     -75.56), SIMDE_FLOAT32_C(     -89.37), SIMDE_FLOAT32_C(      28.81), SIMDE_FLOAT32_C(     -43.33) },
+      { SIMDE_FLOAT32_C(     -68.67), SIMDE_FLOAT32_C(      -4.37) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(  5259.1250), SIMDE_FLOAT32_C(  6162.7480), SIMDE_FLOAT32_C( -1993.3226), SIMDE_FLOAT32_C(  2949.0710) } },
+    { { SIMDE_FLOAT32_C(      61.10), SIMDE_FLOAT32_C(     -76.81), SIMDE_FLOAT32_C(      94.74), SIMDE_FLOAT32_C(     -47.31) },
+      { SIMDE_FLOAT32_C(     -34.25), SIMDE_FLOAT32_C(     -46.77), SIMDE_FLOAT32_C(      53.78), SIMDE_FLOAT32_C(      -6.81) },
+      { SIMDE_FLOAT32_C(     -67.18), SIMDE_FLOAT32_C(      -6.18) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(  2362.0149), SIMDE_FLOAT32_C(  3065.1987), SIMDE_FLOAT32_C( -3518.2004), SIMDE_FLOAT32_C(   410.1858) } },
+    { { SIMDE_FLOAT32_C(     -42.31), SIMDE_FLOAT32_C(     -97.93), SIMDE_FLOAT32_C(      40.45), SIMDE_FLOAT32_C(     -84.79) },
+      { SIMDE_FLOAT32_C(      -6.52), SIMDE_FLOAT32_C(      68.07), SIMDE_FLOAT32_C(      44.65), SIMDE_FLOAT32_C(     -60.63) },
+      { SIMDE_FLOAT32_C(      79.44), SIMDE_FLOAT32_C(     -81.37) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(  -560.2588), SIMDE_FLOAT32_C(  5309.5508), SIMDE_FLOAT32_C(  3587.4463), SIMDE_FLOAT32_C( -4901.2373) } },
+    { { SIMDE_FLOAT32_C(     -94.77), SIMDE_FLOAT32_C(      20.36), SIMDE_FLOAT32_C(     -95.89), SIMDE_FLOAT32_C(      57.36) },
+      { SIMDE_FLOAT32_C(      18.01), SIMDE_FLOAT32_C(      13.71), SIMDE_FLOAT32_C(     -25.69), SIMDE_FLOAT32_C(      56.45) },
+      { SIMDE_FLOAT32_C(     -93.14), SIMDE_FLOAT32_C(     -69.40) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C( -1772.2214), SIMDE_FLOAT32_C( -1256.5894), SIMDE_FLOAT32_C(  2296.8767), SIMDE_FLOAT32_C( -5200.3931) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32x4_t b = simde_vld1q_f32(test_vec[i].b);
+    simde_float32x2_t c = simde_vld1_f32(test_vec[i].c);
+
+    simde_float32x4_t r;
+    SIMDE_CONSTIFY_2_(simde_vfmaq_lane_f32, r, (HEDLEY_UNREACHABLE(), simde_vdupq_n_f32(SIMDE_FLOAT32_C(0.0))), test_vec[i].lane, a, b, c);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfmaq_lane_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 b[2];
+    simde_float64 c[1];
+    int8_t lane;
+    simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(      44.33), SIMDE_FLOAT64_C(      52.65) },
+      { SIMDE_FLOAT64_C(      12.72), SIMDE_FLOAT64_C(     -95.51) },
+      { SIMDE_FLOAT64_C(     -19.84) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(  -208.0348), SIMDE_FLOAT64_C(  1947.5684) } },
+    { { SIMDE_FLOAT64_C(      93.17), SIMDE_FLOAT64_C(     -77.79) },
+      { SIMDE_FLOAT64_C(     -68.42), SIMDE_FLOAT64_C(     -16.56) },
+      { SIMDE_FLOAT64_C(     -95.19) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(  6606.0698), SIMDE_FLOAT64_C(  1498.5564) } },
+    { { SIMDE_FLOAT64_C(     -15.44), SIMDE_FLOAT64_C(     -89.26) },
+      { SIMDE_FLOAT64_C(     -33.70), SIMDE_FLOAT64_C(      54.20) },
+      { SIMDE_FLOAT64_C(      70.37) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C( -2386.9090), SIMDE_FLOAT64_C(  3724.7940) } },
+    { { SIMDE_FLOAT64_C(      44.03), SIMDE_FLOAT64_C(     -70.73) },
+      { SIMDE_FLOAT64_C(      85.47), SIMDE_FLOAT64_C(     -13.36) },
+      { SIMDE_FLOAT64_C(      55.30) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(  4770.5210), SIMDE_FLOAT64_C(  -809.5380) } },
+    { { SIMDE_FLOAT64_C(     -59.27), SIMDE_FLOAT64_C(     -43.90) },
+      { SIMDE_FLOAT64_C(      55.55), SIMDE_FLOAT64_C(     -89.43) },
+      { SIMDE_FLOAT64_C(     -22.62) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C( -1315.8110), SIMDE_FLOAT64_C(  1979.0066) } },
+    { { SIMDE_FLOAT64_C(     -19.80), SIMDE_FLOAT64_C(      -9.92) },
+      { SIMDE_FLOAT64_C(      47.73), SIMDE_FLOAT64_C(     -23.89) },
+      { SIMDE_FLOAT64_C(       5.58) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(   246.5334), SIMDE_FLOAT64_C(  -143.2262) } },
+    { { SIMDE_FLOAT64_C(      84.37), SIMDE_FLOAT64_C(     -73.81) },
+      { SIMDE_FLOAT64_C(      88.16), SIMDE_FLOAT64_C(      -6.72) },
+      { SIMDE_FLOAT64_C(      91.44) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(  8145.7204), SIMDE_FLOAT64_C(  -688.2868) } },
+    { { SIMDE_FLOAT64_C(     -45.12), SIMDE_FLOAT64_C(     -68.63) },
+      { SIMDE_FLOAT64_C(      30.29), SIMDE_FLOAT64_C(     -76.13) },
+      { SIMDE_FLOAT64_C(      22.61) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(   639.7369), SIMDE_FLOAT64_C( -1789.9293) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64x2_t b = simde_vld1q_f64(test_vec[i].b);
+    simde_float64x1_t c = simde_vld1_f64(test_vec[i].c);
+    simde_float64x2_t r = simde_vfmaq_lane_f64(a, b, c, 0);
+
+    simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 2);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfmaq_laneq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 b[4];
+    simde_float32 c[4];
+    int8_t lane;
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(     -34.36), SIMDE_FLOAT32_C(      89.65), SIMDE_FLOAT32_C(      52.94), SIMDE_FLOAT32_C(     -11.60) },
+      { SIMDE_FLOAT32_C(      28.95), SIMDE_FLOAT32_C(      98.51), SIMDE_FLOAT32_C(      -8.66), SIMDE_FLOAT32_C(      46.00) },
+      { SIMDE_FLOAT32_C(      17.57), SIMDE_FLOAT32_C(     -82.00), SIMDE_FLOAT32_C(     -35.41), SIMDE_FLOAT32_C(      75.12) },
+       INT8_C(   3),
+      { SIMDE_FLOAT32_C(  2140.3643), SIMDE_FLOAT32_C(  7489.7217), SIMDE_FLOAT32_C(  -597.5992), SIMDE_FLOAT32_C(  3443.9202) } },
+    { { SIMDE_FLOAT32_C(     -12.27), SIMDE_FLOAT32_C(     -27.30), SIMDE_FLOAT32_C(     -17.00), SIMDE_FLOAT32_C(       9.73) },
+      { SIMDE_FLOAT32_C(      78.88), SIMDE_FLOAT32_C(     -25.35), SIMDE_FLOAT32_C(     -40.92), SIMDE_FLOAT32_C(      17.97) },
+      { SIMDE_FLOAT32_C(      57.92), SIMDE_FLOAT32_C(       4.13), SIMDE_FLOAT32_C(     -92.24), SIMDE_FLOAT32_C(      68.04) },
+       INT8_C(   3),
+      { SIMDE_FLOAT32_C(  5354.7251), SIMDE_FLOAT32_C( -1752.1140), SIMDE_FLOAT32_C( -2801.1968), SIMDE_FLOAT32_C(  1232.4088) } },
+    { { SIMDE_FLOAT32_C(     -17.81), SIMDE_FLOAT32_C(      45.45), SIMDE_FLOAT32_C(     -58.19), SIMDE_FLOAT32_C(     -48.11) },
+      { SIMDE_FLOAT32_C(     -29.51), SIMDE_FLOAT32_C(      21.81), SIMDE_FLOAT32_C(      87.92), SIMDE_FLOAT32_C(     -67.82) },
+      { SIMDE_FLOAT32_C(     -91.56), SIMDE_FLOAT32_C(     -49.06), SIMDE_FLOAT32_C(      29.16), SIMDE_FLOAT32_C(      36.60) },
+       INT8_C(   2),
+      { SIMDE_FLOAT32_C(  -878.3216), SIMDE_FLOAT32_C(   681.4296), SIMDE_FLOAT32_C(  2505.5571), SIMDE_FLOAT32_C( -2025.7412) } },
+    { { SIMDE_FLOAT32_C(      44.34), SIMDE_FLOAT32_C(      -3.75), SIMDE_FLOAT32_C(     -68.67), SIMDE_FLOAT32_C(      91.66) },
+      { SIMDE_FLOAT32_C(     -32.39), SIMDE_FLOAT32_C(     -98.52), SIMDE_FLOAT32_C(     -65.94), SIMDE_FLOAT32_C(     -48.25) },
+      { SIMDE_FLOAT32_C(      43.40), SIMDE_FLOAT32_C(     -40.02), SIMDE_FLOAT32_C(     -65.26), SIMDE_FLOAT32_C(      37.55) },
+       INT8_C(   2),
+      { SIMDE_FLOAT32_C(  2158.1113), SIMDE_FLOAT32_C(  6425.6650), SIMDE_FLOAT32_C(  4234.5747), SIMDE_FLOAT32_C(  3240.4551) } },
+    { { SIMDE_FLOAT32_C(      72.44), SIMDE_FLOAT32_C(     -82.81), SIMDE_FLOAT32_C(      70.65), SIMDE_FLOAT32_C(      72.04) },
+      { SIMDE_FLOAT32_C(     -60.38), SIMDE_FLOAT32_C(      90.75), SIMDE_FLOAT32_C(     -34.90), SIMDE_FLOAT32_C(       9.42) },
+      { SIMDE_FLOAT32_C(     -49.61), SIMDE_FLOAT32_C(      50.50), SIMDE_FLOAT32_C(     -12.89), SIMDE_FLOAT32_C(     -61.30) },
+       INT8_C(   2),
+      { SIMDE_FLOAT32_C(   850.7382), SIMDE_FLOAT32_C( -1252.5775), SIMDE_FLOAT32_C(   520.5110), SIMDE_FLOAT32_C(   -49.3838) } },
+    { { SIMDE_FLOAT32_C(      65.48), SIMDE_FLOAT32_C(     -20.22), SIMDE_FLOAT32_C(     -81.63), SIMDE_FLOAT32_C(     -53.31) },
+      { SIMDE_FLOAT32_C(     -75.54), SIMDE_FLOAT32_C(     -21.68), SIMDE_FLOAT32_C(     -47.54), SIMDE_FLOAT32_C(     -52.15) },
+      { SIMDE_FLOAT32_C(      73.09), SIMDE_FLOAT32_C(     -99.51), SIMDE_FLOAT32_C(     -55.28), SIMDE_FLOAT32_C(      82.84) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(  7582.4658), SIMDE_FLOAT32_C(  2137.1570), SIMDE_FLOAT32_C(  4649.0757), SIMDE_FLOAT32_C(  5136.1367) } },
+    { { SIMDE_FLOAT32_C(     -97.74), SIMDE_FLOAT32_C(      66.39), SIMDE_FLOAT32_C(     -16.64), SIMDE_FLOAT32_C(      20.19) },
+      { SIMDE_FLOAT32_C(      26.07), SIMDE_FLOAT32_C(     -75.54), SIMDE_FLOAT32_C(     -10.07), SIMDE_FLOAT32_C(      38.98) },
+      { SIMDE_FLOAT32_C(      12.23), SIMDE_FLOAT32_C(     -45.67), SIMDE_FLOAT32_C(      77.25), SIMDE_FLOAT32_C(      22.81) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(   221.0961), SIMDE_FLOAT32_C(  -857.4642), SIMDE_FLOAT32_C(  -139.7961), SIMDE_FLOAT32_C(   496.9154) } },
+    { { SIMDE_FLOAT32_C(      75.43), SIMDE_FLOAT32_C(      -0.22), SIMDE_FLOAT32_C(     -77.53), SIMDE_FLOAT32_C(     -56.02) },
+      { SIMDE_FLOAT32_C(      78.00), SIMDE_FLOAT32_C(     -22.71), SIMDE_FLOAT32_C(      98.73), SIMDE_FLOAT32_C(      95.46) },
+      { SIMDE_FLOAT32_C(      16.73), SIMDE_FLOAT32_C(      71.40), SIMDE_FLOAT32_C(     -28.98), SIMDE_FLOAT32_C(      58.33) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(  1380.3700), SIMDE_FLOAT32_C(  -380.1583), SIMDE_FLOAT32_C(  1574.2229), SIMDE_FLOAT32_C(  1541.0258) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32x4_t b = simde_vld1q_f32(test_vec[i].b);
+    simde_float32x4_t c = simde_vld1q_f32(test_vec[i].c);
+
+    simde_float32x4_t r;
+    SIMDE_CONSTIFY_4_(simde_vfmaq_laneq_f32, r, (HEDLEY_UNREACHABLE(), simde_vdupq_n_f32(SIMDE_FLOAT32_C(0.0))), test_vec[i].lane, a, b, c);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfmaq_laneq_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 b[2];
+    simde_float64 c[2];
+    int8_t lane;
+    simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(     -40.49), SIMDE_FLOAT64_C(      66.69) },
+      { SIMDE_FLOAT64_C(     -74.62), SIMDE_FLOAT64_C(     -70.78) },
+      { SIMDE_FLOAT64_C(     -14.10), SIMDE_FLOAT64_C(     -91.86) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(  1011.6520), SIMDE_FLOAT64_C(  1064.6880) } },
+    { { SIMDE_FLOAT64_C(      74.93), SIMDE_FLOAT64_C(      90.88) },
+      { SIMDE_FLOAT64_C(     -11.63), SIMDE_FLOAT64_C(     -71.30) },
+      { SIMDE_FLOAT64_C(      54.18), SIMDE_FLOAT64_C(      17.69) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(  -555.1834), SIMDE_FLOAT64_C( -3772.1540) } },
+    { { SIMDE_FLOAT64_C(     -12.36), SIMDE_FLOAT64_C(      19.93) },
+      { SIMDE_FLOAT64_C(      47.64), SIMDE_FLOAT64_C(      56.26) },
+      { SIMDE_FLOAT64_C(      -4.88), SIMDE_FLOAT64_C(     -72.35) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C( -3459.1140), SIMDE_FLOAT64_C( -4050.4810) } },
+    { { SIMDE_FLOAT64_C(     -90.35), SIMDE_FLOAT64_C(     -76.64) },
+      { SIMDE_FLOAT64_C(     -18.30), SIMDE_FLOAT64_C(     -22.23) },
+      { SIMDE_FLOAT64_C(      83.30), SIMDE_FLOAT64_C(       0.44) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C( -1614.7400), SIMDE_FLOAT64_C( -1928.3990) } },
+    { { SIMDE_FLOAT64_C(      35.74), SIMDE_FLOAT64_C(      40.54) },
+      { SIMDE_FLOAT64_C(      68.60), SIMDE_FLOAT64_C(      71.78) },
+      { SIMDE_FLOAT64_C(      38.73), SIMDE_FLOAT64_C(      -1.14) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C(   -42.4640), SIMDE_FLOAT64_C(   -41.2892) } },
+    { { SIMDE_FLOAT64_C(      37.90), SIMDE_FLOAT64_C(      51.12) },
+      { SIMDE_FLOAT64_C(      68.87), SIMDE_FLOAT64_C(      99.64) },
+      { SIMDE_FLOAT64_C(     -41.29), SIMDE_FLOAT64_C(     -95.88) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C( -6565.3556), SIMDE_FLOAT64_C( -9502.3632) } },
+    { { SIMDE_FLOAT64_C(      40.71), SIMDE_FLOAT64_C(      97.25) },
+      { SIMDE_FLOAT64_C(      28.18), SIMDE_FLOAT64_C(      41.87) },
+      { SIMDE_FLOAT64_C(       7.33), SIMDE_FLOAT64_C(     -70.51) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C( -1946.2618), SIMDE_FLOAT64_C( -2855.0037) } },
+    { { SIMDE_FLOAT64_C(      80.99), SIMDE_FLOAT64_C(     -38.57) },
+      { SIMDE_FLOAT64_C(      19.59), SIMDE_FLOAT64_C(     -94.37) },
+      { SIMDE_FLOAT64_C(      81.02), SIMDE_FLOAT64_C(      27.22) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C(   614.2298), SIMDE_FLOAT64_C( -2607.3214) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64x2_t b = simde_vld1q_f64(test_vec[i].b);
+    simde_float64x2_t c = simde_vld1q_f64(test_vec[i].c);
+
+    simde_float64x2_t r;
+    SIMDE_CONSTIFY_2_(simde_vfmaq_laneq_f64, r, (HEDLEY_UNREACHABLE(), simde_vdupq_n_f64(SIMDE_FLOAT64_C(0.0))), test_vec[i].lane, a, b, c);
+
+    simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 2);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vfma_lane_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfma_lane_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfma_laneq_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfma_laneq_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmaq_lane_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmaq_lane_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmaq_laneq_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmaq_laneq_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
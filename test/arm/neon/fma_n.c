@@ -0,0 +1,225 @@
+#define SIMDE_TEST_ARM_NEON_INSN fma_n
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/fma_n.h"
+
+static int
+test_simde_vfma_n_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 b[2];
+    simde_float32 c;
+    simde_float32 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(     -41.01), SIMDE_FLOAT32_C(     -48.60) },
+      { SIMDE_FLOAT32_C(     -11.25), SIMDE_FLOAT32_C(     -82.07) },
+      SIMDE_FLOAT32_C(      -1.84),
+      { SIMDE_FLOAT32_C(   -20.3100), SIMDE_FLOAT32_C(   102.4088) } },
+    { { SIMDE_FLOAT32_C(      79.07), SIMDE_FLOAT32_C(      75.92) },
+      { SIMDE_FLOAT32_C(      55.47), SIMDE_FLOAT32_C(     -63.63) },
+      SIMDE_FLOAT32_C(     -21.40),
+      { SIMDE_FLOAT32_C( -1107.9880), SIMDE_FLOAT32_C(  1437.6021) } },
+    { { SIMDE_FLOAT32_C(     -76.27), SIMDE_FLOAT32_C(     -60.39) },
+      { SIMDE_FLOAT32_C(     -92.44), SIMDE_FLOAT32_C(     -87.12) },
+      SIMDE_FLOAT32_C(      44.62),
+      { SIMDE_FLOAT32_C( -4200.9429), SIMDE_FLOAT32_C( -3947.6843) } },
+    { { SIMDE_FLOAT32_C(     -46.17), SIMDE_FLOAT32_C(      34.74) },
+      { SIMDE_FLOAT32_C(      -1.80), SIMDE_FLOAT32_C(     -48.51) },
+      SIMDE_FLOAT32_C(      32.33),
+      { SIMDE_FLOAT32_C(  -104.3640), SIMDE_FLOAT32_C( -1533.5884) } },
+    { { SIMDE_FLOAT32_C(      -1.92), SIMDE_FLOAT32_C(     -61.39) },
+      { SIMDE_FLOAT32_C(     -45.66), SIMDE_FLOAT32_C(       0.19) },
+      SIMDE_FLOAT32_C(     -52.28),
+      { SIMDE_FLOAT32_C(  2385.1848), SIMDE_FLOAT32_C(   -71.3232) } },
+    { { SIMDE_FLOAT32_C(      -3.40), SIMDE_FLOAT32_C(     -26.46) },
+      { SIMDE_FLOAT32_C(      88.53), SIMDE_FLOAT32_C(     -69.52) },
+      SIMDE_FLOAT32_C(      57.66),
+      { SIMDE_FLOAT32_C(  5101.2397), SIMDE_FLOAT32_C( -4034.9829) } },
+    { { SIMDE_FLOAT32_C(     -66.69), SIMDE_FLOAT32_C(     -91.45) },
+      { SIMDE_FLOAT32_C(      66.88), SIMDE_FLOAT32_C(      52.35) },
+      SIMDE_FLOAT32_C(     -19.77),
+      { SIMDE_FLOAT32_C( -1388.9076), SIMDE_FLOAT32_C( -1126.4095) } },
+    { { SIMDE_FLOAT32_C(      79.55), SIMDE_FLOAT32_C(     -41.49) },
+      { SIMDE_FLOAT32_C(     -24.61), SIMDE_FLOAT32_C(      70.52) },
+      SIMDE_FLOAT32_C(      60.80),
+      { SIMDE_FLOAT32_C( -1416.7380), SIMDE_FLOAT32_C(  4246.1260) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32x2_t b = simde_vld1_f32(test_vec[i].b);
+    simde_float32x2_t r = simde_vfma_n_f32(a, b, test_vec[i].c);
+
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfma_n_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[1];
+    simde_float64 b[1];
+    simde_float64 c;
+    simde_float64 r[1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(      89.82) },
+      { SIMDE_FLOAT64_C(     -32.48) },
+      SIMDE_FLOAT64_C(      46.80),
+      { SIMDE_FLOAT64_C( -1430.2440) } },
+    { { SIMDE_FLOAT64_C(      83.74) },
+      { SIMDE_FLOAT64_C(      42.23) },
+      SIMDE_FLOAT64_C(     -31.45),
+      { SIMDE_FLOAT64_C( -1244.3935) } },
+    { { SIMDE_FLOAT64_C(      86.00) },
+      { SIMDE_FLOAT64_C(      61.80) },
+      SIMDE_FLOAT64_C(     -90.96),
+      { SIMDE_FLOAT64_C( -5535.3280) } },
+    { { SIMDE_FLOAT64_C(      -3.09) },
+      { SIMDE_FLOAT64_C(      93.89) },
+      SIMDE_FLOAT64_C(      60.24),
+      { SIMDE_FLOAT64_C(  5652.8436) } },
+    { { SIMDE_FLOAT64_C(      39.70) },
+      { SIMDE_FLOAT64_C(     -85.12) },
+      SIMDE_FLOAT64_C(      69.35),
+      { SIMDE_FLOAT64_C( -5863.3720) } },
+    { { SIMDE_FLOAT64_C(     -47.18) },
+      { SIMDE_FLOAT64_C(     -56.59) },
+      SIMDE_FLOAT64_C(      47.54),
+      { SIMDE_FLOAT64_C( -2737.4686) } },
+    { { SIMDE_FLOAT64_C(      -4.75) },
+      { SIMDE_FLOAT64_C(      99.38) },
+      SIMDE_FLOAT64_C(      67.59),
+      { SIMDE_FLOAT64_C(  6712.3442) } },
+    { { SIMDE_FLOAT64_C(     -83.29) },
+      { SIMDE_FLOAT64_C(     -91.23) },
+      SIMDE_FLOAT64_C(     -64.17),
+      { SIMDE_FLOAT64_C(  5770.9391) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_float64x1_t b = simde_vld1_f64(test_vec[i].b);
+    simde_float64x1_t r = simde_vfma_n_f64(a, b, test_vec[i].c);
+
+    simde_test_arm_neon_assert_equal_f64x1(r, simde_vld1_f64(test_vec[i].r), 2);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfmaq_n_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 b[4];
+    simde_float32 c;
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(     -85.56), SIMDE_FLOAT32_C(     -44.84), SIMDE_FLOAT32_C(     -25.83), SIMDE_FLOAT32_C(     -96.31) },
+      { SIMDE_FLOAT32_C(      44.77), SIMDE_FLOAT32_C(      61.95), SIMDE_FLOAT32_C(     -24.36), SIMDE_FLOAT32_C(      -0.94) },
+      SIMDE_FLOAT32_C(      17.60),
+      { SIMDE_FLOAT32_C(   702.3920), SIMDE_FLOAT32_C(  1045.4800), SIMDE_FLOAT32_C(  -454.5660), SIMDE_FLOAT32_C(  -112.8540) } },
+    { { SIMDE_FLOAT32_C(      97.51), SIMDE_FLOAT32_C(      52.28), SIMDE_FLOAT32_C(     -61.08), SIMDE_FLOAT32_C(      10.94) },
+      { SIMDE_FLOAT32_C(     -39.32), SIMDE_FLOAT32_C(      80.74), SIMDE_FLOAT32_C(      74.22), SIMDE_FLOAT32_C(      -7.17) },
+      SIMDE_FLOAT32_C(      89.88),
+      { SIMDE_FLOAT32_C( -3436.5715), SIMDE_FLOAT32_C(  7309.1909), SIMDE_FLOAT32_C(  6609.8135), SIMDE_FLOAT32_C(  -633.4996) } },
+    { { SIMDE_FLOAT32_C(      57.03), SIMDE_FLOAT32_C(      64.52), SIMDE_FLOAT32_C(     -28.60), SIMDE_FLOAT32_C(      65.38) },
+      { SIMDE_FLOAT32_C(     -67.48), SIMDE_FLOAT32_C(      66.54), SIMDE_FLOAT32_C(     -23.88), SIMDE_FLOAT32_C(      82.20) },
+      SIMDE_FLOAT32_C(      -6.99),
+      { SIMDE_FLOAT32_C(   528.7152), SIMDE_FLOAT32_C(  -400.5946), SIMDE_FLOAT32_C(   138.3212), SIMDE_FLOAT32_C(  -509.1980) } },
+    { { SIMDE_FLOAT32_C(     -44.90), SIMDE_FLOAT32_C(     -46.75), SIMDE_FLOAT32_C(     -31.01), SIMDE_FLOAT32_C(      75.40) },
+      { SIMDE_FLOAT32_C(      -6.43), SIMDE_FLOAT32_C(     -33.77), SIMDE_FLOAT32_C(      93.37), SIMDE_FLOAT32_C(      57.36) },
+      SIMDE_FLOAT32_C(     -89.07),
+      { SIMDE_FLOAT32_C(   527.8201), SIMDE_FLOAT32_C(  2961.1440), SIMDE_FLOAT32_C( -8347.4766), SIMDE_FLOAT32_C( -5033.6553) } },
+    { { SIMDE_FLOAT32_C(       0.91), SIMDE_FLOAT32_C(      88.13), SIMDE_FLOAT32_C(     -20.64), SIMDE_FLOAT32_C(     -99.25) },
+      { SIMDE_FLOAT32_C(      13.65), SIMDE_FLOAT32_C(      47.84), SIMDE_FLOAT32_C(      51.23), SIMDE_FLOAT32_C(      29.65) },
+      SIMDE_FLOAT32_C(     -17.29),
+      { SIMDE_FLOAT32_C(  -235.0985), SIMDE_FLOAT32_C(  -739.0236), SIMDE_FLOAT32_C(  -906.4067), SIMDE_FLOAT32_C(  -611.8985) } },
+    { { SIMDE_FLOAT32_C(     -13.58), SIMDE_FLOAT32_C(     -77.23), SIMDE_FLOAT32_C(      86.10), SIMDE_FLOAT32_C(      97.97) },
+      { SIMDE_FLOAT32_C(     -76.28), SIMDE_FLOAT32_C(     -72.72), SIMDE_FLOAT32_C(     -94.43), SIMDE_FLOAT32_C(     -26.63) },
+      SIMDE_FLOAT32_C(      50.67),
+      { SIMDE_FLOAT32_C( -3878.6875), SIMDE_FLOAT32_C( -3761.9524), SIMDE_FLOAT32_C( -4698.6680), SIMDE_FLOAT32_C( -1251.3719) } },
+    { { SIMDE_FLOAT32_C(     -25.81), SIMDE_FLOAT32_C(     -48.53), SIMDE_FLOAT32_C(      -8.60), SIMDE_FLOAT32_C(      24.65) },
+      { SIMDE_FLOAT32_C(      13.76), SIMDE_FLOAT32_C(       0.69), SIMDE_FLOAT32_C(     -17.11), SIMDE_FLOAT32_C(     -10.63) },
+      SIMDE_FLOAT32_C(      29.41),
+      { SIMDE_FLOAT32_C(   378.8716), SIMDE_FLOAT32_C(   -28.2371), SIMDE_FLOAT32_C(  -511.8051), SIMDE_FLOAT32_C(  -287.9783) } },
+    { { SIMDE_FLOAT32_C(     -38.40), SIMDE_FLOAT32_C(      97.16), SIMDE_FLOAT32_C(      31.57), SIMDE_FLOAT32_C(      68.67) },
+      { SIMDE_FLOAT32_C(      29.95), SIMDE_FLOAT32_C(      99.64), SIMDE_FLOAT32_C(     -97.55), SIMDE_FLOAT32_C(     -41.58) },
+      SIMDE_FLOAT32_C(      10.25),
+      { SIMDE_FLOAT32_C(   268.5875), SIMDE_FLOAT32_C(  1118.4700), SIMDE_FLOAT32_C(  -968.3175), SIMDE_FLOAT32_C(  -357.5250) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32x4_t b = simde_vld1q_f32(test_vec[i].b);
+    simde_float32x4_t r = simde_vfmaq_n_f32(a, b, test_vec[i].c);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfmaq_n_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 b[2];
+    simde_float64 c;
+    simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(      86.76), SIMDE_FLOAT64_C(     -11.68) },
+      { SIMDE_FLOAT64_C(     -59.76), SIMDE_FLOAT64_C(      20.78) },
+      SIMDE_FLOAT64_C(      97.89),
+      { SIMDE_FLOAT64_C( -5763.1464), SIMDE_FLOAT64_C(  2022.4742) } },
+    { { SIMDE_FLOAT64_C(     -97.66), SIMDE_FLOAT64_C(     -84.19) },
+      { SIMDE_FLOAT64_C(      24.35), SIMDE_FLOAT64_C(     -66.20) },
+      SIMDE_FLOAT64_C(      85.43),
+      { SIMDE_FLOAT64_C(  1982.5605), SIMDE_FLOAT64_C( -5739.6560) } },
+    { { SIMDE_FLOAT64_C(     -94.43), SIMDE_FLOAT64_C(      42.82) },
+      { SIMDE_FLOAT64_C(     -39.46), SIMDE_FLOAT64_C(      19.32) },
+      SIMDE_FLOAT64_C(      33.22),
+      { SIMDE_FLOAT64_C( -1405.2912), SIMDE_FLOAT64_C(   684.6304) } },
+    { { SIMDE_FLOAT64_C(       0.03), SIMDE_FLOAT64_C(     -30.06) },
+      { SIMDE_FLOAT64_C(      91.75), SIMDE_FLOAT64_C(     -11.05) },
+      SIMDE_FLOAT64_C(     -58.19),
+      { SIMDE_FLOAT64_C( -5338.9025), SIMDE_FLOAT64_C(   612.9395) } },
+    { { SIMDE_FLOAT64_C(     -98.41), SIMDE_FLOAT64_C(      24.87) },
+      { SIMDE_FLOAT64_C(     -56.36), SIMDE_FLOAT64_C(       7.96) },
+      SIMDE_FLOAT64_C(     -51.06),
+      { SIMDE_FLOAT64_C(  2779.3316), SIMDE_FLOAT64_C(  -381.5676) } },
+    { { SIMDE_FLOAT64_C(     -77.69), SIMDE_FLOAT64_C(      -3.72) },
+      { SIMDE_FLOAT64_C(      29.04), SIMDE_FLOAT64_C(     -17.81) },
+      SIMDE_FLOAT64_C(      93.03),
+      { SIMDE_FLOAT64_C(  2623.9012), SIMDE_FLOAT64_C( -1660.5843) } },
+    { { SIMDE_FLOAT64_C(      76.41), SIMDE_FLOAT64_C(      31.61) },
+      { SIMDE_FLOAT64_C(      38.95), SIMDE_FLOAT64_C(      77.44) },
+      SIMDE_FLOAT64_C(     -13.88),
+      { SIMDE_FLOAT64_C(  -464.2160), SIMDE_FLOAT64_C( -1043.2572) } },
+    { { SIMDE_FLOAT64_C(      87.09), SIMDE_FLOAT64_C(     -50.71) },
+      { SIMDE_FLOAT64_C(      88.34), SIMDE_FLOAT64_C(      74.15) },
+      SIMDE_FLOAT64_C(     -79.67),
+      { SIMDE_FLOAT64_C( -6950.9578), SIMDE_FLOAT64_C( -5958.2405) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64x2_t b = simde_vld1q_f64(test_vec[i].b);
+    simde_float64x2_t r = simde_vfmaq_n_f64(a, b, test_vec[i].c);
+
+    simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 2);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vfma_n_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfma_n_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmaq_n_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmaq_n_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,229 @@
+#define SIMDE_TEST_ARM_NEON_INSN fms
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/fms.h"
+
+static int
+test_simde_vfms_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 b[2];
+    simde_float32 c[2];
+    simde_float32 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(     -99.00), SIMDE_FLOAT32_C(      20.88) },
+      { SIMDE_FLOAT32_C(     -23.45), SIMDE_FLOAT32_C(     -11.34) },
+      { SIMDE_FLOAT32_C(     -89.11), SIMDE_FLOAT32_C(     -12.43) },
+      { SIMDE_FLOAT32_C( -2188.6296), SIMDE_FLOAT32_C(  -120.0762) } },
+    { { SIMDE_FLOAT32_C(      22.77), SIMDE_FLOAT32_C(      51.81) },
+      { SIMDE_FLOAT32_C(      16.10), SIMDE_FLOAT32_C(      40.16) },
+      { SIMDE_FLOAT32_C(     -12.89), SIMDE_FLOAT32_C(      88.32) },
+      { SIMDE_FLOAT32_C(   230.2990), SIMDE_FLOAT32_C( -3495.1211) } },
+    { { SIMDE_FLOAT32_C(     -53.42), SIMDE_FLOAT32_C(      -1.48) },
+      { SIMDE_FLOAT32_C(     -27.60), SIMDE_FLOAT32_C(      71.55) },
+      { SIMDE_FLOAT32_C(     -23.77), SIMDE_FLOAT32_C(     -76.74) },
+      { SIMDE_FLOAT32_C(  -709.4720), SIMDE_FLOAT32_C(  5489.2671) } },
+    { { SIMDE_FLOAT32_C(      46.14), SIMDE_FLOAT32_C(      33.22) },
+      { SIMDE_FLOAT32_C(     -41.67), SIMDE_FLOAT32_C(      85.03) },
+      { SIMDE_FLOAT32_C(     -99.04), SIMDE_FLOAT32_C(     -47.09) },
+      { SIMDE_FLOAT32_C( -4080.8567), SIMDE_FLOAT32_C(  4037.2827) } },
+    { { SIMDE_FLOAT32_C(      76.74), SIMDE_FLOAT32_C(      69.68) },
+      { SIMDE_FLOAT32_C(       8.81), SIMDE_FLOAT32_C(     -40.67) },
+      { SIMDE_FLOAT32_C(     -89.34), SIMDE_FLOAT32_C(      46.87) },
+      { SIMDE_FLOAT32_C(   863.8254), SIMDE_FLOAT32_C(  1975.8828) } },
+    { { SIMDE_FLOAT32_C(     -75.98), SIMDE_FLOAT32_C(      93.46) },
+      { SIMDE_FLOAT32_C(     -64.17), SIMDE_FLOAT32_C(     -54.44) },
+      { SIMDE_FLOAT32_C(     -90.54), SIMDE_FLOAT32_C(     -23.94) },
+      { SIMDE_FLOAT32_C( -5885.9316), SIMDE_FLOAT32_C( -1209.8336) } },
+    { { SIMDE_FLOAT32_C(      -6.66), SIMDE_FLOAT32_C(      57.76) },
+      { SIMDE_FLOAT32_C(     -65.95), SIMDE_FLOAT32_C(     -82.59) },
+      { SIMDE_FLOAT32_C(     -37.90), SIMDE_FLOAT32_C(      85.98) },
+      { SIMDE_FLOAT32_C( -2506.1650), SIMDE_FLOAT32_C(  7158.8481) } },
+    { { SIMDE_FLOAT32_C(     -41.63), SIMDE_FLOAT32_C(     -26.48) },
+      { SIMDE_FLOAT32_C(      91.23), SIMDE_FLOAT32_C(      67.06) },
+      { SIMDE_FLOAT32_C(     -13.61), SIMDE_FLOAT32_C(      48.80) },
+      { SIMDE_FLOAT32_C(  1200.0103), SIMDE_FLOAT32_C( -3299.0078) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32x2_t b = simde_vld1_f32(test_vec[i].b);
+    simde_float32x2_t c = simde_vld1_f32(test_vec[i].c);
+    simde_float32x2_t r = simde_vfms_f32(a, b, c);
+
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfms_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[1];
+    simde_float64 b[1];
+    simde_float64 c[1];
+    simde_float64 r[1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(     -21.52) },
+      { SIMDE_FLOAT64_C(      20.56) },
+      { SIMDE_FLOAT64_C(      42.55) },
+      { SIMDE_FLOAT64_C(  -896.3480) } },
+    { { SIMDE_FLOAT64_C(     -44.75) },
+      { SIMDE_FLOAT64_C(     -89.04) },
+      { SIMDE_FLOAT64_C(      42.70) },
+      { SIMDE_FLOAT64_C(  3757.2580) } },
+    { { SIMDE_FLOAT64_C(      41.46) },
+      { SIMDE_FLOAT64_C(      74.85) },
+      { SIMDE_FLOAT64_C(     -83.66) },
+      { SIMDE_FLOAT64_C(  6303.4110) } },
+    { { SIMDE_FLOAT64_C(       2.85) },
+      { SIMDE_FLOAT64_C(       3.09) },
+      { SIMDE_FLOAT64_C(     -52.21) },
+      { SIMDE_FLOAT64_C(   164.1789) } },
+    { { SIMDE_FLOAT64_C(     -14.20) },
+      { SIMDE_FLOAT64_C(      18.76) },
+      { SIMDE_FLOAT64_C(      84.24) },
+      { SIMDE_FLOAT64_C( -1594.5424) } },
+    { { SIMDE_FLOAT64_C(     -78.61) },
+      { SIMDE_FLOAT64_C(     -66.54) },
+      { SIMDE_FLOAT64_C(      93.11) },
+      { SIMDE_FLOAT64_C(  6116.9294) } },
+    { { SIMDE_FLOAT64_C(       1.63) },
+      { SIMDE_FLOAT64_C(     -12.46) },
+      { SIMDE_FLOAT64_C(      66.99) },
+      { SIMDE_FLOAT64_C(   836.3254) } },
+    { { SIMDE_FLOAT64_C(      92.16) },
+      { SIMDE_FLOAT64_C(     -28.72) },
+      { SIMDE_FLOAT64_C(      96.27) },
+      { SIMDE_FLOAT64_C(  2857.0344) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_float64x1_t b = simde_vld1_f64(test_vec[i].b);
+    simde_float64x1_t c = simde_vld1_f64(test_vec[i].c);
+    simde_float64x1_t r = simde_vfms_f64(a, b, c);
+
+    simde_test_arm_neon_assert_equal_f64x1(r, simde_vld1_f64(test_vec[i].r), 2);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfmsq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 b[4];
+    simde_float32 c[4];
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(      14.50), SIMDE_FLOAT32_C(     -13.65), SIMDE_FLOAT32_C(      39.61), SIMDE_FLOAT32_C(       7.20) },
+      { SIMDE_FLOAT32_C(      38.35), SIMDE_FLOAT32_C(     -81.81), SIMDE_FLOAT32_C(      60.97), SIMDE_FLOAT32_C(     -54.16) },
+      { SIMDE_FLOAT32_C(     -41.02), SIMDE_FLOAT32_C(      22.54), SIMDE_FLOAT32_C(      21.24), SIMDE_FLOAT32_C(      11.41) },
+      { SIMDE_FLOAT32_C(  1587.6169), SIMDE_FLOAT32_C(  1830.3474), SIMDE_FLOAT32_C( -1255.3928), SIMDE_FLOAT32_C(   625.1656) } },
+    { { SIMDE_FLOAT32_C(     -61.13), SIMDE_FLOAT32_C(     -40.01), SIMDE_FLOAT32_C(      26.19), SIMDE_FLOAT32_C(     -13.96) },
+      { SIMDE_FLOAT32_C(     -82.19), SIMDE_FLOAT32_C(     -43.50), SIMDE_FLOAT32_C(       0.75), SIMDE_FLOAT32_C(      14.54) },
+      { SIMDE_FLOAT32_C(      96.05), SIMDE_FLOAT32_C(      17.93), SIMDE_FLOAT32_C(      76.55), SIMDE_FLOAT32_C(      75.05) },
+      { SIMDE_FLOAT32_C(  7833.2202), SIMDE_FLOAT32_C(   739.9450), SIMDE_FLOAT32_C(   -31.2225), SIMDE_FLOAT32_C( -1105.1870) } },
+    { { SIMDE_FLOAT32_C(     -72.85), SIMDE_FLOAT32_C(     -93.80), SIMDE_FLOAT32_C(      76.93), SIMDE_FLOAT32_C(     -15.81) },
+      { SIMDE_FLOAT32_C(      28.51), SIMDE_FLOAT32_C(      97.57), SIMDE_FLOAT32_C(     -97.48), SIMDE_FLOAT32_C(     -11.00) },
+      { SIMDE_FLOAT32_C(      47.85), SIMDE_FLOAT32_C(     -26.48), SIMDE_FLOAT32_C(      43.89), SIMDE_FLOAT32_C(     -46.31) },
+      { SIMDE_FLOAT32_C( -1437.0535), SIMDE_FLOAT32_C(  2489.8535), SIMDE_FLOAT32_C(  4355.3271), SIMDE_FLOAT32_C(  -525.2200) } },
+    { { SIMDE_FLOAT32_C(      70.62), SIMDE_FLOAT32_C(      28.24), SIMDE_FLOAT32_C(     -81.03), SIMDE_FLOAT32_C(      21.17) },
+      { SIMDE_FLOAT32_C(     -37.69), SIMDE_FLOAT32_C(     -60.94), SIMDE_FLOAT32_C(      85.80), SIMDE_FLOAT32_C(     -70.85) },
+      { SIMDE_FLOAT32_C(      12.16), SIMDE_FLOAT32_C(     -26.18), SIMDE_FLOAT32_C(      12.26), SIMDE_FLOAT32_C(      -7.91) },
+      { SIMDE_FLOAT32_C(   528.9304), SIMDE_FLOAT32_C( -1567.1692), SIMDE_FLOAT32_C( -1132.9381), SIMDE_FLOAT32_C(  -539.2535) } },
+    { { SIMDE_FLOAT32_C(     -19.72), SIMDE_FLOAT32_C(      38.38), SIMDE_FLOAT32_C(     -63.32), SIMDE_FLOAT32_C(      15.01) },
+      { SIMDE_FLOAT32_C(      17.66), SIMDE_FLOAT32_C(     -37.71), SIMDE_FLOAT32_C(     -82.97), SIMDE_FLOAT32_C(      49.21) },
+      { SIMDE_FLOAT32_C(      19.12), SIMDE_FLOAT32_C(      82.22), SIMDE_FLOAT32_C(      73.44), SIMDE_FLOAT32_C(     -67.79) },
+      { SIMDE_FLOAT32_C(  -357.3792), SIMDE_FLOAT32_C(  3138.8962), SIMDE_FLOAT32_C(  6029.9971), SIMDE_FLOAT32_C(  3350.9558) } },
+    { { SIMDE_FLOAT32_C(      94.99), SIMDE_FLOAT32_C(     -30.55), SIMDE_FLOAT32_C(      -0.04), SIMDE_FLOAT32_C(     -37.82) },
+      { SIMDE_FLOAT32_C(      18.69), SIMDE_FLOAT32_C(      40.73), SIMDE_FLOAT32_C(     -43.81), SIMDE_FLOAT32_C(     -49.81) },
+      { SIMDE_FLOAT32_C(      21.01), SIMDE_FLOAT32_C(       1.24), SIMDE_FLOAT32_C(      14.51), SIMDE_FLOAT32_C(     -77.21) },
+      { SIMDE_FLOAT32_C(  -297.6869), SIMDE_FLOAT32_C(   -81.0552), SIMDE_FLOAT32_C(   635.6431), SIMDE_FLOAT32_C( -3883.6501) } },
+    { { SIMDE_FLOAT32_C(      86.99), SIMDE_FLOAT32_C(      78.38), SIMDE_FLOAT32_C(     -74.74), SIMDE_FLOAT32_C(     -42.09) },
+      { SIMDE_FLOAT32_C(     -91.87), SIMDE_FLOAT32_C(     -86.08), SIMDE_FLOAT32_C(     -95.85), SIMDE_FLOAT32_C(     -61.79) },
+      { SIMDE_FLOAT32_C(      18.76), SIMDE_FLOAT32_C(      87.06), SIMDE_FLOAT32_C(       2.84), SIMDE_FLOAT32_C(     -70.76) },
+      { SIMDE_FLOAT32_C(  1810.4713), SIMDE_FLOAT32_C(  7572.5049), SIMDE_FLOAT32_C(   197.4740), SIMDE_FLOAT32_C( -4414.3506) } },
+    { { SIMDE_FLOAT32_C(      68.81), SIMDE_FLOAT32_C(     -72.95), SIMDE_FLOAT32_C(      25.67), SIMDE_FLOAT32_C(     -15.77) },
+      { SIMDE_FLOAT32_C(     -10.05), SIMDE_FLOAT32_C(     -74.44), SIMDE_FLOAT32_C(     -76.45), SIMDE_FLOAT32_C(      30.55) },
+      { SIMDE_FLOAT32_C(      35.25), SIMDE_FLOAT32_C(      -9.30), SIMDE_FLOAT32_C(     -31.13), SIMDE_FLOAT32_C(      49.24) },
+      { SIMDE_FLOAT32_C(   423.0725), SIMDE_FLOAT32_C(  -765.2420), SIMDE_FLOAT32_C( -2354.2183), SIMDE_FLOAT32_C( -1520.0520) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32x4_t b = simde_vld1q_f32(test_vec[i].b);
+    simde_float32x4_t c = simde_vld1q_f32(test_vec[i].c);
+    simde_float32x4_t r = simde_vfmsq_f32(a, b, c);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfmsq_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 b[2];
+    simde_float64 c[2];
+    simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(     -12.33), SIMDE_FLOAT64_C(      72.38) },
+      { SIMDE_FLOAT64_C(      26.29), SIMDE_FLOAT64_C(     -90.46) },
+      { SIMDE_FLOAT64_C(     -72.60), SIMDE_FLOAT64_C(     -33.47) },
+      { SIMDE_FLOAT64_C(  1896.3240), SIMDE_FLOAT64_C( -2955.3162) } },
+    { { SIMDE_FLOAT64_C(     -98.00), SIMDE_FLOAT64_C(      34.43) },
+      { SIMDE_FLOAT64_C(      74.84), SIMDE_FLOAT64_C(      66.07) },
+      { SIMDE_FLOAT64_C(       9.95), SIMDE_FLOAT64_C(      15.05) },
+      { SIMDE_FLOAT64_C(  -842.6580), SIMDE_FLOAT64_C(  -959.9235) } },
+    { { SIMDE_FLOAT64_C(      80.99), SIMDE_FLOAT64_C(     -30.61) },
+      { SIMDE_FLOAT64_C(      85.44), SIMDE_FLOAT64_C(     -82.13) },
+      { SIMDE_FLOAT64_C(     -90.63), SIMDE_FLOAT64_C(      47.20) },
+      { SIMDE_FLOAT64_C(  7824.4172), SIMDE_FLOAT64_C(  3845.9260) } },
+    { { SIMDE_FLOAT64_C(      63.67), SIMDE_FLOAT64_C(     -68.33) },
+      { SIMDE_FLOAT64_C(     -30.16), SIMDE_FLOAT64_C(      69.15) },
+      { SIMDE_FLOAT64_C(      87.66), SIMDE_FLOAT64_C(      82.97) },
+      { SIMDE_FLOAT64_C(  2707.4956), SIMDE_FLOAT64_C( -5805.7055) } },
+    { { SIMDE_FLOAT64_C(       4.80), SIMDE_FLOAT64_C(      19.96) },
+      { SIMDE_FLOAT64_C(      85.32), SIMDE_FLOAT64_C(      89.87) },
+      { SIMDE_FLOAT64_C(     -62.17), SIMDE_FLOAT64_C(      76.29) },
+      { SIMDE_FLOAT64_C(  5309.1444), SIMDE_FLOAT64_C( -6836.2223) } },
+    { { SIMDE_FLOAT64_C(      86.31), SIMDE_FLOAT64_C(      16.18) },
+      { SIMDE_FLOAT64_C(     -50.60), SIMDE_FLOAT64_C(     -14.06) },
+      { SIMDE_FLOAT64_C(      49.71), SIMDE_FLOAT64_C(      59.18) },
+      { SIMDE_FLOAT64_C(  2601.6360), SIMDE_FLOAT64_C(   848.2508) } },
+    { { SIMDE_FLOAT64_C(     -11.12), SIMDE_FLOAT64_C(     -87.99) },
+      { SIMDE_FLOAT64_C(     -75.01), SIMDE_FLOAT64_C(     -54.93) },
+      { SIMDE_FLOAT64_C(     -38.36), SIMDE_FLOAT64_C(     -28.86) },
+      { SIMDE_FLOAT64_C( -2888.5036), SIMDE_FLOAT64_C( -1673.2698) } },
+    { { SIMDE_FLOAT64_C(     -14.22), SIMDE_FLOAT64_C(     -17.99) },
+      { SIMDE_FLOAT64_C(     -37.03), SIMDE_FLOAT64_C(      -2.34) },
+      { SIMDE_FLOAT64_C(     -97.71), SIMDE_FLOAT64_C(     -33.45) },
+      { SIMDE_FLOAT64_C( -3632.4213), SIMDE_FLOAT64_C(   -96.2630) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64x2_t b = simde_vld1q_f64(test_vec[i].b);
+    simde_float64x2_t c = simde_vld1q_f64(test_vec[i].c);
+    simde_float64x2_t r = simde_vfmsq_f64(a, b, c);
+
+    simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 2);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vfms_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfms_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmsq_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmsq_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
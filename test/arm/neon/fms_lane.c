@@ -0,0 +1,533 @@
+#define SIMDE_TEST_ARM_NEON_INSN fms_lane
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/fms_lane.h"
+
+static int
+test_simde_vfms_lane_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 b[2];
+    simde_float32 c[2];
+    int8_t lane;
+    simde_float32 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(      53.96), SIMDE_FLOAT32_C(      67.01) },
+      { SIMDE_FLOAT32_C(     -88.36), SIMDE_FLOAT32_C(       4.82) },
+      { SIMDE_FLOAT32_C(      30.88), SIMDE_FLOAT32_C(     -82.24) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C( -7212.7661), SIMDE_FLOAT32_C(   463.4068) } },
+    { { SIMDE_FLOAT32_C(       4.09), SIMDE_FLOAT32_C(     -87.98) },
+      { SIMDE_FLOAT32_C(      32.79), SIMDE_FLOAT32_C(       4.79) },
+      { SIMDE_FLOAT32_C(      -6.30), SIMDE_FLOAT32_C(      35.92) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(   210.6670), SIMDE_FLOAT32_C(   -57.8030) } },
+    { { SIMDE_FLOAT32_C(     -54.26), SIMDE_FLOAT32_C(      14.04) },
+      { SIMDE_FLOAT32_C(     -17.13), SIMDE_FLOAT32_C(     -82.91) },
+      { SIMDE_FLOAT32_C(      20.71), SIMDE_FLOAT32_C(      75.74) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(   300.5023), SIMDE_FLOAT32_C(  1731.1061) } },
+    { { SIMDE_FLOAT32_C(      84.83), SIMDE_FLOAT32_C(      29.00) },
+      { SIMDE_FLOAT32_C(     -72.36), SIMDE_FLOAT32_C(      85.44) },
+      { SIMDE_FLOAT32_C(     -50.04), SIMDE_FLOAT32_C(     -53.29) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C( -3536.0645), SIMDE_FLOAT32_C(  4304.4180) } },
+    { { SIMDE_FLOAT32_C(     -99.06), SIMDE_FLOAT32_C(     -68.13) },
+      { SIMDE_FLOAT32_C(     -13.09), SIMDE_FLOAT32_C(     -46.38) },
+      { SIMDE_FLOAT32_C(      26.37), SIMDE_FLOAT32_C(     -64.08) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(   246.1233), SIMDE_FLOAT32_C(  1154.9106) } },
+    { { SIMDE_FLOAT32_C(     -57.69), SIMDE_FLOAT32_C(     -97.85) },
+      { SIMDE_FLOAT32_C(     -82.30), SIMDE_FLOAT32_C(       0.35) },
+      { SIMDE_FLOAT32_C(      59.63), SIMDE_FLOAT32_C(      64.87) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(  4849.8594), SIMDE_FLOAT32_C(  -118.7205) } },
+    { { SIMDE_FLOAT32_C(     -10.09), SIMDE_FLOAT32_C(     -29.98) },
+      { SIMDE_FLOAT32_C(     -77.10), SIMDE_FLOAT32_C(     -85.37) },
+      { SIMDE_FLOAT32_C(     -87.89), SIMDE_FLOAT32_C(     -59.09) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C( -6786.4087), SIMDE_FLOAT32_C( -7533.1494) } },
+    { { SIMDE_FLOAT32_C(     -87.38), SIMDE_FLOAT32_C(      88.40) },
+      { SIMDE_FLOAT32_C(     -83.44), SIMDE_FLOAT32_C(      39.47) },
+      { SIMDE_FLOAT32_C(      40.31), SIMDE_FLOAT32_C(     -53.46) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(  3276.0867), SIMDE_FLOAT32_C( -1502.6357) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32x2_t b = simde_vld1_f32(test_vec[i].b);
+    simde_float32x2_t c = simde_vld1_f32(test_vec[i].c);
+
+    simde_float32x2_t r;
+    SIMDE_CONSTIFY_2_(simde_vfms_lane_f32, r, (HEDLEY_UNREACHABLE(), simde_vdup_n_f32(SIMDE_FLOAT32_C(0.0))), test_vec[i].lane, a, b, c);
+
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfms_lane_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[1];
+    simde_float64 b[1];
+    simde_float64 c[1];
+    int8_t lane;
+    simde_float64 r[1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(     -24.05) },
+      { SIMDE_FLOAT64_C(      91.55) },
+      { SIMDE_FLOAT64_C(      56.60) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C( -5205.7800) } },
+    { { SIMDE_FLOAT64_C(      43.47) },
+      { SIMDE_FLOAT64_C(     -43.90) },
+      { SIMDE_FLOAT64_C(     -24.64) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C( -1038.2260) } },
+    { { SIMDE_FLOAT64_C(      66.35) },
+      { SIMDE_FLOAT64_C(     -22.66) },
+      { SIMDE_FLOAT64_C(      86.80) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(  2033.2380) } },
+    { { SIMDE_FLOAT64_C(      21.72) },
+      { SIMDE_FLOAT64_C(      83.23) },
+      { SIMDE_FLOAT64_C(      93.72) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C( -7778.5956) } },
+    { { SIMDE_FLOAT64_C(      90.90) },
+      { SIMDE_FLOAT64_C(      10.39) },
+      { SIMDE_FLOAT64_C(      12.13) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(   -35.1307) } },
+    { { SIMDE_FLOAT64_C(     -64.53) },
+      { SIMDE_FLOAT64_C(      82.64) },
+      { SIMDE_FLOAT64_C(      14.48) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C( -1261.1572) } },
+    { { SIMDE_FLOAT64_C(     -47.89) },
+      { SIMDE_FLOAT64_C(     -47.88) },
+      { SIMDE_FLOAT64_C(      78.43) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(  3707.3384) } },
+    { { SIMDE_FLOAT64_C(      75.12) },
+      { SIMDE_FLOAT64_C(      69.05) },
+      { SIMDE_FLOAT64_C(     -55.63) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(  3916.3715) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_float64x1_t b = simde_vld1_f64(test_vec[i].b);
+    simde_float64x1_t c = simde_vld1_f64(test_vec[i].c);
+    simde_float64x1_t r = simde_vfms_lane_f64(a, b, c, 0);
+
+    simde_test_arm_neon_assert_equal_f64x1(r, simde_vld1_f64(test_vec[i].r), 2);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfms_laneq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 b[2];
+    simde_float32 c[4];
+    int8_t lane;
+    simde_float32 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(     -96.75), SIMDE_FLOAT32_C(     -95.96) },
+      { SIMDE_FLOAT32_C(      96.43), SIMDE_FLOAT32_C(      63.75) },
+      { SIMDE_FLOAT32_C(       6.56), SIMDE_FLOAT32_C(     -99.60), SIMDE_FLOAT32_C(       5.04), SIMDE_FLOAT32_C(      71.98) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(  9507.6777), SIMDE_FLOAT32_C(  6253.5400) } },
+    { { SIMDE_FLOAT32_C(      91.56), SIMDE_FLOAT32_C(      -2.88) },
+      { SIMDE_FLOAT32_C(      -1.23), SIMDE_FLOAT32_C(      82.52) },
+      { SIMDE_FLOAT32_C(      20.41), SIMDE_FLOAT32_C(      77.05), SIMDE_FLOAT32_C(      61.58), SIMDE_FLOAT32_C(      43.96) },
+       INT8_C(   2),
+      { SIMDE_FLOAT32_C(   167.3034), SIMDE_FLOAT32_C( -5084.4614) } },
+    { { SIMDE_FLOAT32_C(      -6.09), SIMDE_FLOAT32_C(     -94.27) },
+      { SIMDE_FLOAT32_C(     -84.82), SIMDE_FLOAT32_C(       9.60) },
+      { SIMDE_FLOAT32_C(      47.63), SIMDE_FLOAT32_C(      28.51), SIMDE_FLOAT32_C(      43.89), SIMDE_FLOAT32_C(      41.74) },
+       INT8_C(   3),
+      { SIMDE_FLOAT32_C(  3534.2969), SIMDE_FLOAT32_C(  -494.9740) } },
+    { { SIMDE_FLOAT32_C(     -35.98), SIMDE_FLOAT32_C(      43.27) },
+      { SIMDE_FLOAT32_C(     -43.56), SIMDE_FLOAT32_C(     -50.80) },
+      { SIMDE_FLOAT32_C(      79.50), SIMDE_FLOAT32_C(      70.45), SIMDE_FLOAT32_C(       6.58), SIMDE_FLOAT32_C(       1.64) },
+       INT8_C(   3),
+      { SIMDE_FLOAT32_C(    35.4584), SIMDE_FLOAT32_C(   126.5820) } },
+    { { SIMDE_FLOAT32_C(      -1.87), SIMDE_FLOAT32_C(       1.84) },
+      { SIMDE_FLOAT32_C(     -28.67), SIMDE_FLOAT32_C(     -60.92) },
+      { SIMDE_FLOAT32_C(      69.69), SIMDE_FLOAT32_C(      17.32), SIMDE_FLOAT32_C(      41.33), SIMDE_FLOAT32_C(      42.80) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(   494.6944), SIMDE_FLOAT32_C(  1056.9744) } },
+    { { SIMDE_FLOAT32_C(      62.65), SIMDE_FLOAT32_C(      29.51) },
+      { SIMDE_FLOAT32_C(      67.88), SIMDE_FLOAT32_C(     -58.46) },
+      { SIMDE_FLOAT32_C(     -24.29), SIMDE_FLOAT32_C(     -49.69), SIMDE_FLOAT32_C(      54.69), SIMDE_FLOAT32_C(      27.89) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(  1711.4552), SIMDE_FLOAT32_C( -1390.4834) } },
+    { { SIMDE_FLOAT32_C(      -5.14), SIMDE_FLOAT32_C(      15.01) },
+      { SIMDE_FLOAT32_C(     -22.01), SIMDE_FLOAT32_C(      81.34) },
+      { SIMDE_FLOAT32_C(     -27.92), SIMDE_FLOAT32_C(      66.33), SIMDE_FLOAT32_C(      50.72), SIMDE_FLOAT32_C(      18.36) },
+       INT8_C(   3),
+      { SIMDE_FLOAT32_C(   398.9636), SIMDE_FLOAT32_C( -1478.3923) } },
+    { { SIMDE_FLOAT32_C(      67.35), SIMDE_FLOAT32_C(       9.96) },
+      { SIMDE_FLOAT32_C(      96.10), SIMDE_FLOAT32_C(     -69.25) },
+      { SIMDE_FLOAT32_C(      90.03), SIMDE_FLOAT32_C(     -42.30), SIMDE_FLOAT32_C(     -14.22), SIMDE_FLOAT32_C(     -45.72) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C( -8584.5332), SIMDE_FLOAT32_C(  6244.5376) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32x2_t b = simde_vld1_f32(test_vec[i].b);
+    simde_float32x4_t c = simde_vld1q_f32(test_vec[i].c);
+
+    simde_float32x2_t r;
+    SIMDE_CONSTIFY_4_(simde_vfms_laneq_f32, r, (HEDLEY_UNREACHABLE(), simde_vdup_n_f32(SIMDE_FLOAT32_C(0.0))), test_vec[i].lane, a, b, c);
+
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfms_laneq_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[1];
+    simde_float64 b[1];
+    simde_float64 c[2];
+    int8_t lane;
+    simde_float64 r[1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(      21.41) },
+      { SIMDE_FLOAT64_C(     -61.06) },
+      { SIMDE_FLOAT64_C(      34.20), SIMDE_FLOAT64_C(     -53.53) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(  2109.6620) } },
+    { { SIMDE_FLOAT64_C(     -38.57) },
+      { SIMDE_FLOAT64_C(       9.60) },
+      { SIMDE_FLOAT64_C(     -76.97), SIMDE_FLOAT64_C(     -72.88) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C(   661.0780) } },
+    { { SIMDE_FLOAT64_C(      -3.39) },
+      { SIMDE_FLOAT64_C(       8.21) },
+      { SIMDE_FLOAT64_C(      68.65), SIMDE_FLOAT64_C(     -61.47) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C(   501.2787) } },
+    { { SIMDE_FLOAT64_C(      40.83) },
+      { SIMDE_FLOAT64_C(     -79.00) },
+      { SIMDE_FLOAT64_C(     -89.97), SIMDE_FLOAT64_C(      15.04) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C(  1228.9900) } },
+    { { SIMDE_FLOAT64_C(     -10.68) },
+      { SIMDE_FLOAT64_C(      -4.60) },
+      { SIMDE_FLOAT64_C(     -10.41), SIMDE_FLOAT64_C(     -33.72) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(   -58.5660) } },
+    { { SIMDE_FLOAT64_C(      36.06) },
+      { SIMDE_FLOAT64_C(     -65.73) },
+      { SIMDE_FLOAT64_C(      92.65), SIMDE_FLOAT64_C(      46.21) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C(  3073.4433) } },
+    { { SIMDE_FLOAT64_C(     -20.15) },
+      { SIMDE_FLOAT64_C(     -49.67) },
+      { SIMDE_FLOAT64_C(      87.50), SIMDE_FLOAT64_C(     -32.60) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C( -1639.3920) } },
+    { { SIMDE_FLOAT64_C(      84.68) },
+      { SIMDE_FLOAT64_C(      69.35) },
+      { SIMDE_FLOAT64_C(     -81.62), SIMDE_FLOAT64_C(      81.92) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(  5745.0270) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_float64x1_t b = simde_vld1_f64(test_vec[i].b);
+    simde_float64x2_t c = simde_vld1q_f64(test_vec[i].c);
+
+    simde_float64x1_t r;
+    SIMDE_CONSTIFY_2_(simde_vfms_laneq_f64, r, (HEDLEY_UNREACHABLE(), simde_vdup_n_f64(SIMDE_FLOAT64_C(0.0))), test_vec[i].lane, a, b, c);
+
+    simde_test_arm_neon_assert_equal_f64x1(r, simde_vld1_f64(test_vec[i].r), 2);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfmsq_lane_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 b[4];
+    simde_float32 c[2];
+    int8_t lane;
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(     -55.30), SIMDE_FLOAT32_C(     -32.03), SIMDE_FLOAT32_C(     -68.11), SIMDE_FLOAT32_C(     -68.61) },
+      { SIMDE_FLOAT32_C(     -89.51), SIMDE_FLOAT32_C(      -5.30), SIMDE_FLOAT32_C(      27.15), SIMDE_FLOAT32_C(       1.98) },
+      { SIMDE_FLOAT32_C(     -28.97), SIMDE_FLOAT32_C(      -7.91) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C( -2648.4048), SIMDE_FLOAT32_C(  -185.5710), SIMDE_FLOAT32_C(   718.4255), SIMDE_FLOAT32_C(   -11.2494) } },
+    { { SIMDE_FLOAT32_C(       6.41), SIMDE_FLOAT32_C(      48.13), SIMDE_FLOAT32_C(      17.20), SIMDE_FLOAT32_C(      56.96) },
+      { SIMDE_FLOAT32_C(     -21.14), SIMDE_FLOAT32_C(       2.74), SIMDE_FLOAT32_C(      14.01), SIMDE_FLOAT32_C(      94.70) },
+      { SIMDE_FLOAT32_C(      99.51), SIMDE_FLOAT32_C(     -78.39) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C( -1650.7545), SIMDE_FLOAT32_C(   262.9186), SIMDE_FLOAT32_C(  1115.4440), SIMDE_FLOAT32_C(  7480.4927) } },
+    { { SIMDE_FLOAT32_C(     -92.80), SIMDE_FLOAT32_C(     -43.64), SIMDE_FLOAT32_C(      54.37), SIMDE_FLOAT32_C(     -15.66) },
+      { SIMDE_FLOAT32_C(      61.00), SIMDE_FLOAT32_C(      21.81), SIMDE_FLOAT32_C(     -40.24), SIMDE_FLOAT32_C(      13.58) },
+      { SIMDE_FLOAT32_C(     -76.76), SIMDE_FLOAT32_C(      10.04) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(  -705.2400), SIMDE_FLOAT32_C(  -262.6124), SIMDE_FLOAT32_C(   458.3796), SIMDE_FLOAT32_C(  -152.0032) } },
+    { { SIMDE_FLOAT32_C(     -97.17), SIMDE_FLOAT32_C(     -38.08), SIMDE_FLOAT32_C(      47.92), SIMDE_FLOAT32_C(     -67.45) },
+      { SIMDE_FLOAT32_C(     -88.84), SIMDE_FLOAT32_C(      -7.91), SIMDE_FLOAT32_C(     -91.34), SIMDE_FLOAT32_C(     -93.00) },
+      { SIMDE_FLOAT32_C(     -85.35), SIMDE_FLOAT32_C(      10.72) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(   855.1948), SIMDE_FLOAT32_C(    46.7152), SIMDE_FLOAT32_C(  1027.0848), SIMDE_FLOAT32_C(   929.5100) } },
+    { { SIMDE_FLOAT32_C(     -58.41), SIMDE_FLOAT32_C(      61.56), SIMDE_FLOAT32_C(     -19.94), SIMDE_FLOAT32_C(     -60.72) },
+      { SIMDE_FLOAT32_C(      89.32), SIMDE_FLOAT32_C(     -11.03), SIMDE_FLOAT32_C(      93.10), SIMDE_FLOAT32_C(      55.19) },
+      { SIMDE_FLOAT32_C(      12.34), SIMDE_FLOAT32_C(      -1.48) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C(    73.7836), SIMDE_FLOAT32_C(    45.2356), SIMDE_FLOAT32_C(   117.8480), SIMDE_FLOAT32_C(    20.9612) } },
+    { { SIMDE_FLOAT32_C(      82.17), SIMDE_FLOAT32_C(      89.36), SIMDE_FLOAT32_C(     -48.82), SIMDE_FLOAT32_C(      48.04) },
+      { SIMDE_FLOAT32_C(      77.44), SIMDE_FLOAT32_C(      95.69), SIMDE_FLOAT32_C(      22.99), SIMDE_FLOAT32_C(     -53.73) },
+      { SIMDE_FLOAT32_C(     -25.73), SIMDE_FLOAT32_C(     -15.10) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(  2074.7012), SIMDE_FLOAT32_C(  2551.4636), SIMDE_FLOAT32_C(   542.7127), SIMDE_FLOAT32_C( -1334.4329) } },
+    { { SIMDE_FLOAT32_C(      45.48), SIMDE_FLOAT32_C(     -22.58), SIMDE_FLOAT32_C(     -67.16), SIMDE_FLOAT32_C(      -6.92) },
+      { SIMDE_FLOAT32_C(      64.23), SIMDE_FLOAT32_C(      89.93), SIMDE_FLOAT32_C(     -21.35), SIMDE_FLOAT32_C(     -42.84) },
+      { SIMDE_FLOAT32_C(      39.96), SIMDE_FLOAT32_C(      70.96) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C( -4512.2808), SIMDE_FLOAT32_C( -6404.0127), SIMDE_FLOAT32_C(  1447.8361), SIMDE_FLOAT32_C(  3033.0063) } },
+    { { SIMDE_FLOAT32_C(      -1.39), SIMDE_FLOAT32_C(      67.98), SIMDE_FLOAT32_C(     -64.38), SIMDE_FLOAT32_C(      38.65) },
+      { SIMDE_FLOAT32_C(      77.91), SIMDE_FLOAT32_C(       3.47), SIMDE_FLOAT32_C(     -42.21), SIMDE_FLOAT32_C(     -93.32) },
+      { SIMDE_FLOAT32_C(      88.89), SIMDE_FLOAT32_C(      49.10) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C( -6926.8101), SIMDE_FLOAT32_C(  -240.4683), SIMDE_FLOAT32_C(  3687.6667), SIMDE_FLOAT32_C(  8333.8643) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32x4_t b = simde_vld1q_f32(test_vec[i].b);
+    simde_float32x2_t c = simde_vld1_f32(test_vec[i].c);
+
+    simde_float32x4_t r;
+    SIMDE_CONSTIFY_2_(simde_vfmsq_lane_f32, r, (HEDLEY_UNREACHABLE(), simde_vdupq_n_f32(SIMDE_FLOAT32_C(0.0))), test_vec[i].lane, a, b, c);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfmsq_lane_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 b[2];
+    simde_float64 c[1];
+    int8_t lane;
+    simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(      41.71), SIMDE_FLOAT64_C(      11.14) },
+      { SIMDE_FLOAT64_C(     -97.60), SIMDE_FLOAT64_C(      21.91) },
+      { SIMDE_FLOAT64_C(     -95.59) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C( -9287.8740), SIMDE_FLOAT64_C(  2105.5169) } },
+    { { SIMDE_FLOAT64_C(      51.89), SIMDE_FLOAT64_C(       5.31) },
+      { SIMDE_FLOAT64_C(     -27.24), SIMDE_FLOAT64_C(      55.29) },
+      { SIMDE_FLOAT64_C(     -86.02) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C( -2291.2948), SIMDE_FLOAT64_C(  4761.3558) } },
+    { { SIMDE_FLOAT64_C(      74.61), SIMDE_FLOAT64_C(      19.24) },
+      { SIMDE_FLOAT64_C(     -79.75), SIMDE_FLOAT64_C(     -86.54) },
+      { SIMDE_FLOAT64_C(     -35.04) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C( -2719.8300), SIMDE_FLOAT64_C( -3013.1216) } },
+    { { SIMDE_FLOAT64_C(     -80.42), SIMDE_FLOAT64_C(     -14.04) },
+      { SIMDE_FLOAT64_C(      55.60), SIMDE_FLOAT64_C(       8.41) },
+      { SIMDE_FLOAT64_C(     -72.58) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(  3955.0280), SIMDE_FLOAT64_C(   596.3578) } },
+    { { SIMDE_FLOAT64_C(      -7.40), SIMDE_FLOAT64_C(     -35.81) },
+      { SIMDE_FLOAT64_C(     -84.82), SIMDE_FLOAT64_C(     -33.71) },
+      { SIMDE_FLOAT64_C(      42.98) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(  3638.1636), SIMDE_FLOAT64_C(  1413.0458) } },
+    { { SIMDE_FLOAT64_C(     -19.01), SIMDE_FLOAT64_C(      54.47) },
+      { SIMDE_FLOAT64_C(     -49.00), SIMDE_FLOAT64_C(     -18.41) },
+      { SIMDE_FLOAT64_C(       9.56) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(   449.4300), SIMDE_FLOAT64_C(   230.4696) } },
+    { { SIMDE_FLOAT64_C(      94.51), SIMDE_FLOAT64_C(     -78.57) },
+      { SIMDE_FLOAT64_C(     -19.72), SIMDE_FLOAT64_C(     -22.95) },
+      { SIMDE_FLOAT64_C(     -25.93) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(  -416.8296), SIMDE_FLOAT64_C(  -673.6635) } },
+    { { SIMDE_FLOAT64_C(      58.12), SIMDE_FLOAT64_C(     -12.89) },
+      { SIMDE_FLOAT64_C(     -28.95), SIMDE_FLOAT64_C(     -80.55) },
+      { SIMDE_FLOAT64_C(      50.71) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(  1526.1745), SIMDE_FLOAT64_C(  4071.8005) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64x2_t b = simde_vld1q_f64(test_vec[i].b);
+    simde_float64x1_t c = simde_vld1_f64(test_vec[i].c);
+    simde_float64x2_t r = simde_vfmsq_lane_f64(a, b, c, 0);
+
+    simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 2);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfmsq_laneq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 b[4];
+    simde_float32 c[4];
+    int8_t lane;
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(     -54.96), SIMDE_FLOAT32_C(      42.42), SIMDE_FLOAT32_C(     -66.11), SIMDE_FLOAT32_C(       8.73) },
+      { SIMDE_FLOAT32_C(      58.84), SIMDE_FLOAT32_C(     -29.92), SIMDE_FLOAT32_C(      99.17), SIMDE_FLOAT32_C(     -95.26) },
+      { SIMDE_FLOAT32_C(      99.29), SIMDE_FLOAT32_C(      79.53), SIMDE_FLOAT32_C(     -56.36), SIMDE_FLOAT32_C(      66.84) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C( -5897.1836), SIMDE_FLOAT32_C(  3013.1768), SIMDE_FLOAT32_C( -9912.6992), SIMDE_FLOAT32_C(  9467.0957) } },
+    { { SIMDE_FLOAT32_C(     -15.45), SIMDE_FLOAT32_C(      80.15), SIMDE_FLOAT32_C(      75.77), SIMDE_FLOAT32_C(     -44.56) },
+      { SIMDE_FLOAT32_C(      59.06), SIMDE_FLOAT32_C(      61.04), SIMDE_FLOAT32_C(      38.24), SIMDE_FLOAT32_C(      74.63) },
+      { SIMDE_FLOAT32_C(     -36.91), SIMDE_FLOAT32_C(     -94.15), SIMDE_FLOAT32_C(       6.39), SIMDE_FLOAT32_C(      -8.22) },
+       INT8_C(   3),
+      { SIMDE_FLOAT32_C(   470.0232), SIMDE_FLOAT32_C(   581.8988), SIMDE_FLOAT32_C(   390.1028), SIMDE_FLOAT32_C(   568.8986) } },
+    { { SIMDE_FLOAT32_C(     -24.02), SIMDE_FLOAT32_C(      72.24), SIMDE_FLOAT32_C(     -74.35), SIMDE_FLOAT32_C(      86.14) },
+      { SIMDE_FLOAT32_C(     -50.64), SIMDE_FLOAT32_C(     -18.68), SIMDE_FLOAT32_C(     -34.81), SIMDE_FLOAT32_C(      25.47) },
+      { SIMDE_FLOAT32_C(      75.45), SIMDE_FLOAT32_C(     -65.90), SIMDE_FLOAT32_C(     -97.25), SIMDE_FLOAT32_C(     -98.72) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C( -3361.1960), SIMDE_FLOAT32_C( -1158.7721), SIMDE_FLOAT32_C( -2368.3291), SIMDE_FLOAT32_C(  1764.6130) } },
+    { { SIMDE_FLOAT32_C(      44.21), SIMDE_FLOAT32_C(      90.53), SIMDE_FLOAT32_C(      65.24), SIMDE_FLOAT32_C(      18.64) },
+      { SIMDE_FLOAT32_C(      16.36), SIMDE_FLOAT32_C(     -54.26), SIMDE_FLOAT32_C(      86.30), SIMDE_FLOAT32_C(     -28.00) },
+      { SIMDE_FLOAT32_C(      76.81), SIMDE_FLOAT32_C(     -72.16), SIMDE_FLOAT32_C(      74.47), SIMDE_FLOAT32_C(      76.72) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C( -1212.4016), SIMDE_FLOAT32_C(  4258.2402), SIMDE_FLOAT32_C( -6563.4629), SIMDE_FLOAT32_C(  2169.3198) } },
+    { { SIMDE_FLOAT32_C(     -59.40), SIMDE_FLOAT32_C(     -29.24), SIMDE_FLOAT32_C(      28.33), SIMDE_FLOAT32_C(     -34.30) },
+      { SIMDE_FLOAT32_C(     -81.74), SIMDE_FLOAT32_C(      75.04), SIMDE_FLOAT32_C(      65.82), SIMDE_FLOAT32_C(     -17.49) },
+      { SIMDE_FLOAT32_C(     -94.04), SIMDE_FLOAT32_C(     -48.81), SIMDE_FLOAT32_C(      31.82), SIMDE_FLOAT32_C(      -1.68) },
+       INT8_C(   3),
+      { SIMDE_FLOAT32_C(  -196.7232), SIMDE_FLOAT32_C(    96.8272), SIMDE_FLOAT32_C(   138.9076), SIMDE_FLOAT32_C(   -63.6832) } },
+    { { SIMDE_FLOAT32_C(     -87.77), SIMDE_FLOAT32_C(     -92.84), SIMDE_FLOAT32_C(     -61.57), SIMDE_FLOAT32_C(     -66.38) },
+      { SIMDE_FLOAT32_C(     -24.84), SIMDE_FLOAT32_C(     -83.46), SIMDE_FLOAT32_C(      47.11), SIMDE_FLOAT32_C(     -84.23) },
+      { SIMDE_FLOAT32_C(      23.78), SIMDE_FLOAT32_C(       2.60), SIMDE_FLOAT32_C(      -7.45), SIMDE_FLOAT32_C(       1.65) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(   502.9252), SIMDE_FLOAT32_C(  1891.8389), SIMDE_FLOAT32_C( -1181.8458), SIMDE_FLOAT32_C(  1936.6095) } },
+    { { SIMDE_FLOAT32_C(     -13.04), SIMDE_FLOAT32_C(     -95.82), SIMDE_FLOAT32_C(     -20.80), SIMDE_FLOAT32_C(     -12.62) },
+      { SIMDE_FLOAT32_C(      -2.02), SIMDE_FLOAT32_C(     -20.35), SIMDE_FLOAT32_C(      33.13), SIMDE_FLOAT32_C(      81.21) },
+      { SIMDE_FLOAT32_C(       8.02), SIMDE_FLOAT32_C(      32.94), SIMDE_FLOAT32_C(      -3.63), SIMDE_FLOAT32_C(      89.26) },
+       INT8_C(   0),
+      { SIMDE_FLOAT32_C(     3.1604), SIMDE_FLOAT32_C(    67.3870), SIMDE_FLOAT32_C(  -286.5026), SIMDE_FLOAT32_C(  -663.9243) } },
+    { { SIMDE_FLOAT32_C(     -77.20), SIMDE_FLOAT32_C(     -68.78), SIMDE_FLOAT32_C(     -87.23), SIMDE_FLOAT32_C(     -85.27) },
+      { SIMDE_FLOAT32_C(      73.90), SIMDE_FLOAT32_C(     -43.27), SIMDE_FLOAT32_C(     -61.86), SIMDE_FLOAT32_C(     -88.26) },
+      { SIMDE_FLOAT32_C(     -19.20), SIMDE_FLOAT32_C(      91.61), SIMDE_FLOAT32_C(      68.63), SIMDE_FLOAT32_C(      -3.70) },
+       INT8_C(   1),
+      { SIMDE_FLOAT32_C( -6847.1792), SIMDE_FLOAT32_C(  3895.1848), SIMDE_FLOAT32_C(  5579.7646), SIMDE_FLOAT32_C(  8000.2290) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32x4_t b = simde_vld1q_f32(test_vec[i].b);
+    simde_float32x4_t c = simde_vld1q_f32(test_vec[i].c);
+
+    simde_float32x4_t r;
+    SIMDE_CONSTIFY_4_(simde_vfmsq_laneq_f32, r, (HEDLEY_UNREACHABLE(), simde_vdupq_n_f32(SIMDE_FLOAT32_C(0.0))), test_vec[i].lane, a, b, c);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfmsq_laneq_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 b[2];
+    simde_float64 c[2];
+    int8_t lane;
+    simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(     -81.01), SIMDE_FLOAT64_C(     -81.56) },
+      { SIMDE_FLOAT64_C(      52.25), SIMDE_FLOAT64_C(       0.04) },
+      { SIMDE_FLOAT64_C(     -18.47), SIMDE_FLOAT64_C(      88.27) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C( -4693.1175), SIMDE_FLOAT64_C(   -85.0908) } },
+    { { SIMDE_FLOAT64_C(       0.92), SIMDE_FLOAT64_C(       6.34) },
+      { SIMDE_FLOAT64_C(     -11.21), SIMDE_FLOAT64_C(      93.99) },
+      { SIMDE_FLOAT64_C(     -18.54), SIMDE_FLOAT64_C(     -33.47) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(  -206.9134), SIMDE_FLOAT64_C(  1748.9146) } },
+    { { SIMDE_FLOAT64_C(     -55.26), SIMDE_FLOAT64_C(     -16.24) },
+      { SIMDE_FLOAT64_C(      91.02), SIMDE_FLOAT64_C(     -27.54) },
+      { SIMDE_FLOAT64_C(      68.12), SIMDE_FLOAT64_C(     -78.66) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C( -6255.5424), SIMDE_FLOAT64_C(  1859.7848) } },
+    { { SIMDE_FLOAT64_C(     -15.76), SIMDE_FLOAT64_C(       4.83) },
+      { SIMDE_FLOAT64_C(      88.50), SIMDE_FLOAT64_C(      12.93) },
+      { SIMDE_FLOAT64_C(     -12.44), SIMDE_FLOAT64_C(      28.11) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C( -2503.4950), SIMDE_FLOAT64_C(  -358.6323) } },
+    { { SIMDE_FLOAT64_C(      64.91), SIMDE_FLOAT64_C(      57.14) },
+      { SIMDE_FLOAT64_C(      47.06), SIMDE_FLOAT64_C(     -52.79) },
+      { SIMDE_FLOAT64_C(     -90.14), SIMDE_FLOAT64_C(      92.07) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C( -4267.9042), SIMDE_FLOAT64_C(  4917.5153) } },
+    { { SIMDE_FLOAT64_C(      -7.97), SIMDE_FLOAT64_C(     -13.58) },
+      { SIMDE_FLOAT64_C(     -19.99), SIMDE_FLOAT64_C(     -31.11) },
+      { SIMDE_FLOAT64_C(      88.21), SIMDE_FLOAT64_C(      56.39) },
+       INT8_C(   0),
+      { SIMDE_FLOAT64_C(  1755.3479), SIMDE_FLOAT64_C(  2730.6331) } },
+    { { SIMDE_FLOAT64_C(      88.70), SIMDE_FLOAT64_C(     -53.93) },
+      { SIMDE_FLOAT64_C(      79.53), SIMDE_FLOAT64_C(      82.98) },
+      { SIMDE_FLOAT64_C(     -26.49), SIMDE_FLOAT64_C(      11.22) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C(  -803.6266), SIMDE_FLOAT64_C(  -984.9656) } },
+    { { SIMDE_FLOAT64_C(      74.61), SIMDE_FLOAT64_C(     -92.51) },
+      { SIMDE_FLOAT64_C(      80.75), SIMDE_FLOAT64_C(      55.23) },
+      { SIMDE_FLOAT64_C(      15.53), SIMDE_FLOAT64_C(     -55.87) },
+       INT8_C(   1),
+      { SIMDE_FLOAT64_C(  4586.1125), SIMDE_FLOAT64_C(  2993.1901) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64x2_t b = simde_vld1q_f64(test_vec[i].b);
+    simde_float64x2_t c = simde_vld1q_f64(test_vec[i].c);
+
+    simde_float64x2_t r;
+    SIMDE_CONSTIFY_2_(simde_vfmsq_laneq_f64, r, (HEDLEY_UNREACHABLE(), simde_vdupq_n_f64(SIMDE_FLOAT64_C(0.0))), test_vec[i].lane, a, b, c);
+
+    simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 2);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vfms_lane_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfms_lane_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfms_laneq_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfms_laneq_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmsq_lane_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmsq_lane_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmsq_laneq_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmsq_laneq_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
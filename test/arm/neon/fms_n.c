@@ -0,0 +1,225 @@
+#define SIMDE_TEST_ARM_NEON_INSN fms_n
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/fms_n.h"
+
+static int
+test_simde_vfms_n_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 b[2];
+    simde_float32 c;
+    simde_float32 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(      54.96), SIMDE_FLOAT32_C(     -31.67) },
+      { SIMDE_FLOAT32_C(     -87.70), SIMDE_FLOAT32_C(      70.63) },
+      SIMDE_FLOAT32_C(      60.52),
+      { SIMDE_FLOAT32_C(  5362.5640), SIMDE_FLOAT32_C( -4306.1973) } },
+    { { SIMDE_FLOAT32_C(     -37.45), SIMDE_FLOAT32_C(      82.69) },
+      { SIMDE_FLOAT32_C(     -54.40), SIMDE_FLOAT32_C(       8.31) },
+      SIMDE_FLOAT32_C(      32.56),
+      { SIMDE_FLOAT32_C(  1733.8141), SIMDE_FLOAT32_C(  -187.8836) } },
+    { { SIMDE_FLOAT32_C(      79.25), SIMDE_FLOAT32_C(     -83.06) },
+      { SIMDE_FLOAT32_C(      25.04), SIMDE_FLOAT32_C(     -55.03) },
+      SIMDE_FLOAT32_C(     -60.83),
+      { SIMDE_FLOAT32_C(  1602.4333), SIMDE_FLOAT32_C( -3430.5349) } },
+    { { SIMDE_FLOAT32_C(      91.58), SIMDE_FLOAT32_C(     -72.41) },
+      { SIMDE_FLOAT32_C(      84.65), SIMDE_FLOAT32_C(      85.87) },
+      SIMDE_FLOAT32_C(     -96.26),
+      { SIMDE_FLOAT32_C(  8239.9893), SIMDE_FLOAT32_C(  8193.4365) } },
+    { { SIMDE_FLOAT32_C(     -57.24), SIMDE_FLOAT32_C(      28.33) },
+      { SIMDE_FLOAT32_C(     -15.51), SIMDE_FLOAT32_C(      60.91) },
+      SIMDE_FLOAT32_C(       4.26),
+      { SIMDE_FLOAT32_C(     8.8326), SIMDE_FLOAT32_C(  -231.1466) } },
+    { { SIMDE_FLOAT32_C(       7.52), SIMDE_FLOAT32_C(      -0.92) },
+      { SIMDE_FLOAT32_C(     -18.00), SIMDE_FLOAT32_C(      17.71) },
+      SIMDE_FLOAT32_C(     -41.86),
+      { SIMDE_FLOAT32_C(  -745.9600), SIMDE_FLOAT32_C(   740.4206) } },
+    { { SIMDE_FLOAT32_C(      94.75), SIMDE_FLOAT32_C(     -37.52) },
+      { SIMDE_FLOAT32_C(      70.91), SIMDE_FLOAT32_C(      84.88) },
+      SIMDE_FLOAT32_C(      96.08),
+      { SIMDE_FLOAT32_C( -6718.2832), SIMDE_FLOAT32_C( -8192.7900) } },
+    { { SIMDE_FLOAT32_C(     -40.70), SIMDE_FLOAT32_C(     -67.82) },
+      { SIMDE_FLOAT32_C(      40.78), SIMDE_FLOAT32_C(     -72.86) },
+      SIMDE_FLOAT32_C(      -5.16),
+      { SIMDE_FLOAT32_C(   169.7248), SIMDE_FLOAT32_C(  -443.7776) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32x2_t b = simde_vld1_f32(test_vec[i].b);
+    simde_float32x2_t r = simde_vfms_n_f32(a, b, test_vec[i].c);
+
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfms_n_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[1];
+    simde_float64 b[1];
+    simde_float64 c;
+    simde_float64 r[1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(      86.89) },
+      { SIMDE_FLOAT64_C(      34.70) },
+      SIMDE_FLOAT64_C(     -44.30),
+      { SIMDE_FLOAT64_C(  1624.1000) } },
+    { { SIMDE_FLOAT64_C(      20.25) },
+      { SIMDE_FLOAT64_C(      86.55) },
+      SIMDE_FLOAT64_C(     -18.05),
+      { SIMDE_FLOAT64_C(  1582.4775) } },
+    { { SIMDE_FLOAT64_C(      -5.13) },
+      { SIMDE_FLOAT64_C(      51.72) },
+      SIMDE_FLOAT64_C(     -96.49),
+      { SIMDE_FLOAT64_C(  4985.3328) } },
+    { { SIMDE_FLOAT64_C(      12.78) },
+      { SIMDE_FLOAT64_C(      32.09) },
+      SIMDE_FLOAT64_C(     -41.03),
+      { SIMDE_FLOAT64_C(  1329.4327) } },
+    { { SIMDE_FLOAT64_C(      46.27) },
+      { SIMDE_FLOAT64_C(      23.93) },
+      SIMDE_FLOAT64_C(      60.39),
+      { SIMDE_FLOAT64_C( -1398.8627) } },
+    { { SIMDE_FLOAT64_C(     -50.29) },
+      { SIMDE_FLOAT64_C(      76.39) },
+      SIMDE_FLOAT64_C(     -30.64),
+      { SIMDE_FLOAT64_C(  2290.2996) } },
+    { { SIMDE_FLOAT64_C(      64.90) },
+      { SIMDE_FLOAT64_C(      60.80) },
+      SIMDE_FLOAT64_C(      33.56),
+      { SIMDE_FLOAT64_C( -1975.5480) } },
+    { { SIMDE_FLOAT64_C(      23.70) },
+      { SIMDE_FLOAT64_C(      93.54) },
+      SIMDE_FLOAT64_C(      87.02),
+      { SIMDE_FLOAT64_C( -8116.1508) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_float64x1_t b = simde_vld1_f64(test_vec[i].b);
+    simde_float64x1_t r = simde_vfms_n_f64(a, b, test_vec[i].c);
+
+    simde_test_arm_neon_assert_equal_f64x1(r, simde_vld1_f64(test_vec[i].r), 2);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfmsq_n_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 b[4];
+    simde_float32 c;
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(      93.54), SIMDE_FLOAT32_C(     -19.41), SIMDE_FLOAT32_C(     -28.05), SIMDE_FLOAT32_C(      95.93) },
+      { SIMDE_FLOAT32_C(     -85.04), SIMDE_FLOAT32_C(      91.99), SIMDE_FLOAT32_C(     -82.84), SIMDE_FLOAT32_C(      -4.95) },
+      SIMDE_FLOAT32_C(      45.57),
+      { SIMDE_FLOAT32_C(  3968.8127), SIMDE_FLOAT32_C( -4211.3940), SIMDE_FLOAT32_C(  3746.9685), SIMDE_FLOAT32_C(   321.5015) } },
+    { { SIMDE_FLOAT32_C(     -43.37), SIMDE_FLOAT32_C(       6.42), SIMDE_FLOAT32_C(      95.15), SIMDE_FLOAT32_C(     -71.94) },
+      { SIMDE_FLOAT32_C(     -60.02), SIMDE_FLOAT32_C(     -19.70), SIMDE_FLOAT32_C(      86.42), SIMDE_FLOAT32_C(      42.98) },
+      SIMDE_FLOAT32_C(      84.78),
+      { SIMDE_FLOAT32_C(  5045.1255), SIMDE_FLOAT32_C(  1676.5861), SIMDE_FLOAT32_C( -7231.5371), SIMDE_FLOAT32_C( -3715.7844) } },
+    { { SIMDE_FLOAT32_C(      30.14), SIMDE_FLOAT32_C(       9.41), SIMDE_FLOAT32_C(     -40.33), SIMDE_FLOAT32_C(     -15.94) },
+      { SIMDE_FLOAT32_C(      -6.28), SIMDE_FLOAT32_C(     -74.69), SIMDE_FLOAT32_C(      22.01), SIMDE_FLOAT32_C(      67.94) },
+      SIMDE_FLOAT32_C(       5.88),
+      { SIMDE_FLOAT32_C(    67.0664), SIMDE_FLOAT32_C(   448.5872), SIMDE_FLOAT32_C(  -169.7488), SIMDE_FLOAT32_C(  -415.4272) } },
+    { { SIMDE_FLOAT32_C(     -74.41), SIMDE_FLOAT32_C(      84.58), SIMDE_FLOAT32_C(      51.23), SIMDE_FLOAT32_C(     -18.43) },
+      { SIMDE_FLOAT32_C(      72.45), SIMDE_FLOAT32_C(      22.64), SIMDE_FLOAT32_C(      29.18), SIMDE_FLOAT32_C(      80.21) },
+      SIMDE_FLOAT32_C(      37.99),
+      { SIMDE_FLOAT32_C( -2826.7854), SIMDE_FLOAT32_C(  -775.5136), SIMDE_FLOAT32_C( -1057.3182), SIMDE_FLOAT32_C( -3065.6079) } },
+    { { SIMDE_FLOAT32_C(      19.92), SIMDE_FLOAT32_C(     -48.50), SIMDE_FLOAT32_C(     -72.55), SIMDE_FLOAT32_C(      14.74) },
+      { SIMDE_FLOAT32_C(       2.90), SIMDE_FLOAT32_C(      62.51), SIMDE_FLOAT32_C(     -70.87), SIMDE_FLOAT32_C(      60.22) },
+      SIMDE_FLOAT32_C(      59.50),
+      { SIMDE_FLOAT32_C(  -152.6300), SIMDE_FLOAT32_C( -3767.8450), SIMDE_FLOAT32_C(  4144.2153), SIMDE_FLOAT32_C( -3568.3501) } },
+    { { SIMDE_FLOAT32_C(     -55.84), SIMDE_FLOAT32_C(      41.00), SIMDE_FLOAT32_C(      75.38), SIMDE_FLOAT32_C(      -1.17) },
+      { SIMDE_FLOAT32_C(      -0.17), SIMDE_FLOAT32_C(      86.98), SIMDE_FLOAT32_C(      -1.29), SIMDE_FLOAT32_C(      83.49) },
+      SIMDE_FLOAT32_C(      75.46),
+      { SIMDE_FLOAT32_C(   -43.0118), SIMDE_FLOAT32_C( -6522.5107), SIMDE_FLOAT32_C(   172.7234), SIMDE_FLOAT32_C( -6301.3252) } },
+    { { SIMDE_FLOAT32_C(      79.98), SIMDE_FLOAT32_C(      21.73), SIMDE_FLOAT32_C(     -32.71), SIMDE_FLOAT32_C(     -48.96) },
+      { SIMDE_FLOAT32_C(      67.07), SIMDE_FLOAT32_C(       0.01), SIMDE_FLOAT32_C(      43.08), SIMDE_FLOAT32_C(     -90.07) },
+      SIMDE_FLOAT32_C(       0.47),
+      { SIMDE_FLOAT32_C(    48.4571), SIMDE_FLOAT32_C(    21.7253), SIMDE_FLOAT32_C(   -52.9576), SIMDE_FLOAT32_C(    -6.6271) } },
+    { { SIMDE_FLOAT32_C(     -37.43), SIMDE_FLOAT32_C(     -76.68), SIMDE_FLOAT32_C(     -69.36), SIMDE_FLOAT32_C(      53.43) },
+      { SIMDE_FLOAT32_C(       5.43), SIMDE_FLOAT32_C(      10.49), SIMDE_FLOAT32_C(     -97.08), SIMDE_FLOAT32_C(      50.99) },
+      SIMDE_FLOAT32_C(     -48.66),
+      { SIMDE_FLOAT32_C(   226.7938), SIMDE_FLOAT32_C(   433.7634), SIMDE_FLOAT32_C( -4793.2729), SIMDE_FLOAT32_C(  2534.6035) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32x4_t b = simde_vld1q_f32(test_vec[i].b);
+    simde_float32x4_t r = simde_vfmsq_n_f32(a, b, test_vec[i].c);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 2);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vfmsq_n_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 b[2];
+    simde_float64 c;
+    simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(     -42.38), SIMDE_FLOAT64_C(      83.04) },
+      { SIMDE_FLOAT64_C(     -10.29), SIMDE_FLOAT64_C(     -65.03) },
+      SIMDE_FLOAT64_C(      54.28),
+      { SIMDE_FLOAT64_C(   516.1612), SIMDE_FLOAT64_C(  3612.8684) } },
+    { { SIMDE_FLOAT64_C(      18.05), SIMDE_FLOAT64_C(     -57.94) },
+      { SIMDE_FLOAT64_C(       5.35), SIMDE_FLOAT64_C(      33.26) },
+      SIMDE_FLOAT64_C(      -8.12),
+      { SIMDE_FLOAT64_C(    61.4920), SIMDE_FLOAT64_C(   212.1312) } },
+    { { SIMDE_FLOAT64_C(     -49.83), SIMDE_FLOAT64_C(       8.23) },
+      { SIMDE_FLOAT64_C(     -76.47), SIMDE_FLOAT64_C(     -74.45) },
+      SIMDE_FLOAT64_C(      34.47),
+      { SIMDE_FLOAT64_C(  2586.0909), SIMDE_FLOAT64_C(  2574.5215) } },
+    { { SIMDE_FLOAT64_C(     -47.71), SIMDE_FLOAT64_C(      17.23) },
+      { SIMDE_FLOAT64_C(     -82.50), SIMDE_FLOAT64_C(      90.70) },
+      SIMDE_FLOAT64_C(     -26.26),
+      { SIMDE_FLOAT64_C( -2214.1600), SIMDE_FLOAT64_C(  2399.0120) } },
+    { { SIMDE_FLOAT64_C(     -80.26), SIMDE_FLOAT64_C(     -71.22) },
+      { SIMDE_FLOAT64_C(      51.64), SIMDE_FLOAT64_C(     -76.96) },
+      SIMDE_FLOAT64_C(      90.86),
+      { SIMDE_FLOAT64_C( -4772.2704), SIMDE_FLOAT64_C(  6921.3656) } },
+    { { SIMDE_FLOAT64_C(      60.10), SIMDE_FLOAT64_C(      -2.44) },
+      { SIMDE_FLOAT64_C(      48.95), SIMDE_FLOAT64_C(      38.57) },
+      SIMDE_FLOAT64_C(      57.10),
+      { SIMDE_FLOAT64_C( -2734.9450), SIMDE_FLOAT64_C( -2204.7870) } },
+    { { SIMDE_FLOAT64_C(     -57.88), SIMDE_FLOAT64_C(      21.73) },
+      { SIMDE_FLOAT64_C(      28.52), SIMDE_FLOAT64_C(     -98.36) },
+      SIMDE_FLOAT64_C(      35.26),
+      { SIMDE_FLOAT64_C( -1063.4952), SIMDE_FLOAT64_C(  3489.9036) } },
+    { { SIMDE_FLOAT64_C(      67.08), SIMDE_FLOAT64_C(     -52.10) },
+      { SIMDE_FLOAT64_C(      80.62), SIMDE_FLOAT64_C(      -8.18) },
+      SIMDE_FLOAT64_C(     -46.02),
+      { SIMDE_FLOAT64_C(  3777.2124), SIMDE_FLOAT64_C(  -428.5436) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64x2_t b = simde_vld1q_f64(test_vec[i].b);
+    simde_float64x2_t r = simde_vfmsq_n_f64(a, b, test_vec[i].c);
+
+    simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 2);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vfms_n_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfms_n_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmsq_n_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vfmsq_n_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,2332 @@
+#define SIMDE_TEST_ARM_NEON_INSN ld2
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/ld2.h"
+#include "../../../simde/arm/neon/st2.h"
+
+#if !defined(SIMDE_BUG_INTEL_857088)
+
+static int
+test_simde_vld2_dup_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 r0[2];
+    simde_float32 r1[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -190.78), SIMDE_FLOAT32_C(    40.87) },
+      { SIMDE_FLOAT32_C(  -190.78), SIMDE_FLOAT32_C(  -190.78) },
+      { SIMDE_FLOAT32_C(    40.87), SIMDE_FLOAT32_C(    40.87) } },
+    { { SIMDE_FLOAT32_C(    89.25), SIMDE_FLOAT32_C(  -821.70) },
+      { SIMDE_FLOAT32_C(    89.25), SIMDE_FLOAT32_C(    89.25) },
+      { SIMDE_FLOAT32_C(  -821.70), SIMDE_FLOAT32_C(  -821.70) } },
+    { { SIMDE_FLOAT32_C(   118.78), SIMDE_FLOAT32_C(  -222.08) },
+      { SIMDE_FLOAT32_C(   118.78), SIMDE_FLOAT32_C(   118.78) },
+      { SIMDE_FLOAT32_C(  -222.08), SIMDE_FLOAT32_C(  -222.08) } },
+    { { SIMDE_FLOAT32_C(   784.45), SIMDE_FLOAT32_C(   271.59) },
+      { SIMDE_FLOAT32_C(   784.45), SIMDE_FLOAT32_C(   784.45) },
+      { SIMDE_FLOAT32_C(   271.59), SIMDE_FLOAT32_C(   271.59) } },
+    { { SIMDE_FLOAT32_C(   -10.95), SIMDE_FLOAT32_C(  -252.23) },
+      { SIMDE_FLOAT32_C(   -10.95), SIMDE_FLOAT32_C(   -10.95) },
+      { SIMDE_FLOAT32_C(  -252.23), SIMDE_FLOAT32_C(  -252.23) } },
+    { { SIMDE_FLOAT32_C(   615.49), SIMDE_FLOAT32_C(   176.34) },
+      { SIMDE_FLOAT32_C(   615.49), SIMDE_FLOAT32_C(   615.49) },
+      { SIMDE_FLOAT32_C(   176.34), SIMDE_FLOAT32_C(   176.34) } },
+    { { SIMDE_FLOAT32_C(  -637.61), SIMDE_FLOAT32_C(  -627.50) },
+      { SIMDE_FLOAT32_C(  -637.61), SIMDE_FLOAT32_C(  -637.61) },
+      { SIMDE_FLOAT32_C(  -627.50), SIMDE_FLOAT32_C(  -627.50) } },
+    { { SIMDE_FLOAT32_C(  -241.78), SIMDE_FLOAT32_C(   478.74) },
+      { SIMDE_FLOAT32_C(  -241.78), SIMDE_FLOAT32_C(  -241.78) },
+      { SIMDE_FLOAT32_C(   478.74), SIMDE_FLOAT32_C(   478.74) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2x2_t r = simde_vld2_dup_f32(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_f32x2(r.val[0], simde_vld1_f32(test_vec[i].r0), 1);
+    simde_test_arm_neon_assert_equal_f32x2(r.val[1], simde_vld1_f32(test_vec[i].r1), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_dup_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 r0[1];
+    simde_float64 r1[1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -219.54), SIMDE_FLOAT64_C(  -833.02) },
+      { SIMDE_FLOAT64_C(  -219.54) },
+      { SIMDE_FLOAT64_C(  -833.02) } },
+    { { SIMDE_FLOAT64_C(   250.43), SIMDE_FLOAT64_C(  -312.33) },
+      { SIMDE_FLOAT64_C(   250.43) },
+      { SIMDE_FLOAT64_C(  -312.33) } },
+    { { SIMDE_FLOAT64_C(  -144.13), SIMDE_FLOAT64_C(   147.15) },
+      { SIMDE_FLOAT64_C(  -144.13) },
+      { SIMDE_FLOAT64_C(   147.15) } },
+    { { SIMDE_FLOAT64_C(   723.92), SIMDE_FLOAT64_C(  -646.94) },
+      { SIMDE_FLOAT64_C(   723.92) },
+      { SIMDE_FLOAT64_C(  -646.94) } },
+    { { SIMDE_FLOAT64_C(  -883.26), SIMDE_FLOAT64_C(  -751.54) },
+      { SIMDE_FLOAT64_C(  -883.26) },
+      { SIMDE_FLOAT64_C(  -751.54) } },
+    { { SIMDE_FLOAT64_C(    60.70), SIMDE_FLOAT64_C(  -819.96) },
+      { SIMDE_FLOAT64_C(    60.70) },
+      { SIMDE_FLOAT64_C(  -819.96) } },
+    { { SIMDE_FLOAT64_C(   965.28), SIMDE_FLOAT64_C(  -205.01) },
+      { SIMDE_FLOAT64_C(   965.28) },
+      { SIMDE_FLOAT64_C(  -205.01) } },
+    { { SIMDE_FLOAT64_C(  -557.66), SIMDE_FLOAT64_C(   875.84) },
+      { SIMDE_FLOAT64_C(  -557.66) },
+      { SIMDE_FLOAT64_C(   875.84) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1x2_t r = simde_vld2_dup_f64(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_f64x1(r.val[0], simde_vld1_f64(test_vec[i].r0), 1);
+    simde_test_arm_neon_assert_equal_f64x1(r.val[1], simde_vld1_f64(test_vec[i].r1), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_dup_s8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t a[2];
+    int8_t r0[8];
+    int8_t r1[8];
+  } test_vec[] = {
+    { {  INT8_C(  72), -INT8_C( 101) },
+      {  INT8_C(  72),  INT8_C(  72),  INT8_C(  72),  INT8_C(  72),  INT8_C(  72),  INT8_C(  72),  INT8_C(  72),  INT8_C(  72) },
+      { -INT8_C( 101), -INT8_C( 101), -INT8_C( 101), -INT8_C( 101), -INT8_C( 101), -INT8_C( 101), -INT8_C( 101), -INT8_C( 101) } },
+    { { -INT8_C(  66),  INT8_C(  86) },
+      { -INT8_C(  66), -INT8_C(  66), -INT8_C(  66), -INT8_C(  66), -INT8_C(  66), -INT8_C(  66), -INT8_C(  66), -INT8_C(  66) },
+      {  INT8_C(  86),  INT8_C(  86),  INT8_C(  86),  INT8_C(  86),  INT8_C(  86),  INT8_C(  86),  INT8_C(  86),  INT8_C(  86) } },
+    { {  INT8_C(  79), -INT8_C( 115) },
+      {  INT8_C(  79),  INT8_C(  79),  INT8_C(  79),  INT8_C(  79),  INT8_C(  79),  INT8_C(  79),  INT8_C(  79),  INT8_C(  79) },
+      { -INT8_C( 115), -INT8_C( 115), -INT8_C( 115), -INT8_C( 115), -INT8_C( 115), -INT8_C( 115), -INT8_C( 115), -INT8_C( 115) } },
+    { {  INT8_C(  84), -INT8_C(  81) },
+      {  INT8_C(  84),  INT8_C(  84),  INT8_C(  84),  INT8_C(  84),  INT8_C(  84),  INT8_C(  84),  INT8_C(  84),  INT8_C(  84) },
+      { -INT8_C(  81), -INT8_C(  81), -INT8_C(  81), -INT8_C(  81), -INT8_C(  81), -INT8_C(  81), -INT8_C(  81), -INT8_C(  81) } },
+    { { -INT8_C( 114), -INT8_C( 121) },
+      { -INT8_C( 114), -INT8_C( 114), -INT8_C( 114), -INT8_C( 114), -INT8_C( 114), -INT8_C( 114), -INT8_C( 114), -INT8_C( 114) },
+      { -INT8_C( 121), -INT8_C( 121), -INT8_C( 121), -INT8_C( 121), -INT8_C( 121), -INT8_C( 121), -INT8_C( 121), -INT8_C( 121) } },
+    { { -INT8_C(  78), -INT8_C(  10) },
+      { -INT8_C(  78), -INT8_C(  78), -INT8_C(  78), -INT8_C(  78), -INT8_C(  78), -INT8_C(  78), -INT8_C(  78), -INT8_C(  78) },
+      { -INT8_C(  10), -INT8_C(  10), -INT8_C(  10), -INT8_C(  10), -INT8_C(  10), -INT8_C(  10), -INT8_C(  10), -INT8_C(  10) } },
+    { {  INT8_C(  30),  INT8_C( 127) },
+      {  INT8_C(  30),  INT8_C(  30),  INT8_C(  30),  INT8_C(  30),  INT8_C(  30),  INT8_C(  30),  INT8_C(  30),  INT8_C(  30) },
+      {  INT8_C( 127),  INT8_C( 127),  INT8_C( 127),  INT8_C( 127),  INT8_C( 127),  INT8_C( 127),  INT8_C( 127),  INT8_C( 127) } },
+    { { -INT8_C(  37), -INT8_C( 109) },
+      { -INT8_C(  37), -INT8_C(  37), -INT8_C(  37), -INT8_C(  37), -INT8_C(  37), -INT8_C(  37), -INT8_C(  37), -INT8_C(  37) },
+      { -INT8_C( 109), -INT8_C( 109), -INT8_C( 109), -INT8_C( 109), -INT8_C( 109), -INT8_C( 109), -INT8_C( 109), -INT8_C( 109) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x8x2_t r = simde_vld2_dup_s8(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i8x8(r.val[0], simde_vld1_s8(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i8x8(r.val[1], simde_vld1_s8(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_dup_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t a[2];
+    int16_t r0[4];
+    int16_t r1[4];
+  } test_vec[] = {
+    { { -INT16_C( 25110), -INT16_C( 16248) },
+      { -INT16_C( 25110), -INT16_C( 25110), -INT16_C( 25110), -INT16_C( 25110) },
+      { -INT16_C( 16248), -INT16_C( 16248), -INT16_C( 16248), -INT16_C( 16248) } },
+    { {  INT16_C( 25438), -INT16_C( 15187) },
+      {  INT16_C( 25438),  INT16_C( 25438),  INT16_C( 25438),  INT16_C( 25438) },
+      { -INT16_C( 15187), -INT16_C( 15187), -INT16_C( 15187), -INT16_C( 15187) } },
+    { {  INT16_C( 13013),  INT16_C( 13194) },
+      {  INT16_C( 13013),  INT16_C( 13013),  INT16_C( 13013),  INT16_C( 13013) },
+      {  INT16_C( 13194),  INT16_C( 13194),  INT16_C( 13194),  INT16_C( 13194) } },
+    { {  INT16_C( 23524), -INT16_C(  9404) },
+      {  INT16_C( 23524),  INT16_C( 23524),  INT16_C( 23524),  INT16_C( 23524) },
+      { -INT16_C(  9404), -INT16_C(  9404), -INT16_C(  9404), -INT16_C(  9404) } },
+    { { -INT16_C( 27803), -INT16_C( 21367) },
+      { -INT16_C( 27803), -INT16_C( 27803), -INT16_C( 27803), -INT16_C( 27803) },
+      { -INT16_C( 21367), -INT16_C( 21367), -INT16_C( 21367), -INT16_C( 21367) } },
+    { { -INT16_C(  2172),  INT16_C( 12565) },
+      { -INT16_C(  2172), -INT16_C(  2172), -INT16_C(  2172), -INT16_C(  2172) },
+      {  INT16_C( 12565),  INT16_C( 12565),  INT16_C( 12565),  INT16_C( 12565) } },
+    { {  INT16_C( 31281),  INT16_C( 26236) },
+      {  INT16_C( 31281),  INT16_C( 31281),  INT16_C( 31281),  INT16_C( 31281) },
+      {  INT16_C( 26236),  INT16_C( 26236),  INT16_C( 26236),  INT16_C( 26236) } },
+    { {  INT16_C( 30861), -INT16_C( 21949) },
+      {  INT16_C( 30861),  INT16_C( 30861),  INT16_C( 30861),  INT16_C( 30861) },
+      { -INT16_C( 21949), -INT16_C( 21949), -INT16_C( 21949), -INT16_C( 21949) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x4x2_t r = simde_vld2_dup_s16(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i16x4(r.val[0], simde_vld1_s16(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i16x4(r.val[1], simde_vld1_s16(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_dup_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t a[2];
+    int32_t r0[2];
+    int32_t r1[2];
+  } test_vec[] = {
+    { {  INT32_C(  240996238), -INT32_C( 1876362378) },
+      {  INT32_C(  240996238),  INT32_C(  240996238) },
+      { -INT32_C( 1876362378), -INT32_C( 1876362378) } },
+    { { -INT32_C(  923622988), -INT32_C(  397662802) },
+      { -INT32_C(  923622988), -INT32_C(  923622988) },
+      { -INT32_C(  397662802), -INT32_C(  397662802) } },
+    { { -INT32_C( 1373623635),  INT32_C( 1866615486) },
+      { -INT32_C( 1373623635), -INT32_C( 1373623635) },
+      {  INT32_C( 1866615486),  INT32_C( 1866615486) } },
+    { { -INT32_C(  537995023), -INT32_C( 1892144376) },
+      { -INT32_C(  537995023), -INT32_C(  537995023) },
+      { -INT32_C( 1892144376), -INT32_C( 1892144376) } },
+    { {  INT32_C( 1044809159), -INT32_C( 1554436527) },
+      {  INT32_C( 1044809159),  INT32_C( 1044809159) },
+      { -INT32_C( 1554436527), -INT32_C( 1554436527) } },
+    { { -INT32_C(  125429352),  INT32_C(  625104378) },
+      { -INT32_C(  125429352), -INT32_C(  125429352) },
+      {  INT32_C(  625104378),  INT32_C(  625104378) } },
+    { { -INT32_C( 1890317640),  INT32_C( 1122675660) },
+      { -INT32_C( 1890317640), -INT32_C( 1890317640) },
+      {  INT32_C( 1122675660),  INT32_C( 1122675660) } },
+    { {  INT32_C(  660917435), -INT32_C(  206491890) },
+      {  INT32_C(  660917435),  INT32_C(  660917435) },
+      { -INT32_C(  206491890), -INT32_C(  206491890) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x2x2_t r = simde_vld2_dup_s32(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i32x2(r.val[0], simde_vld1_s32(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i32x2(r.val[1], simde_vld1_s32(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_dup_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t a[2];
+    int64_t r0[1];
+    int64_t r1[1];
+  } test_vec[] = {
+    { { -INT64_C( 8392488172591595725),  INT64_C(  938100439484965630) },
+      { -INT64_C( 8392488172591595725) },
+      {  INT64_C(  938100439484965630) } },
+    { { -INT64_C( 7384782385300328060), -INT64_C( 7861012210384201389) },
+      { -INT64_C( 7384782385300328060) },
+      { -INT64_C( 7861012210384201389) } },
+    { { -INT64_C( 8175605420245867997),  INT64_C( 8061366420857386185) },
+      { -INT64_C( 8175605420245867997) },
+      {  INT64_C( 8061366420857386185) } },
+    { { -INT64_C( 7328414176917419540), -INT64_C(  458646188596216540) },
+      { -INT64_C( 7328414176917419540) },
+      { -INT64_C(  458646188596216540) } },
+    { {  INT64_C( 5923035238569985920), -INT64_C( 5520091147254177001) },
+      {  INT64_C( 5923035238569985920) },
+      { -INT64_C( 5520091147254177001) } },
+    { { -INT64_C( 2029864131058239812),  INT64_C( 5418087953644964807) },
+      { -INT64_C( 2029864131058239812) },
+      {  INT64_C( 5418087953644964807) } },
+    { {  INT64_C( 1191096203280448743), -INT64_C( 5640743373095828165) },
+      {  INT64_C( 1191096203280448743) },
+      { -INT64_C( 5640743373095828165) } },
+    { {  INT64_C(  676997232210819097),  INT64_C( 9126713865749804458) },
+      {  INT64_C(  676997232210819097) },
+      {  INT64_C( 9126713865749804458) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x1x2_t r = simde_vld2_dup_s64(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i64x1(r.val[0], simde_vld1_s64(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i64x1(r.val[1], simde_vld1_s64(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_dup_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t a[2];
+    uint8_t r0[8];
+    uint8_t r1[8];
+  } test_vec[] = {
+    { { UINT8_C(194), UINT8_C(136) },
+      { UINT8_C(194), UINT8_C(194), UINT8_C(194), UINT8_C(194), UINT8_C(194), UINT8_C(194), UINT8_C(194), UINT8_C(194) },
+      { UINT8_C(136), UINT8_C(136), UINT8_C(136), UINT8_C(136), UINT8_C(136), UINT8_C(136), UINT8_C(136), UINT8_C(136) } },
+    { { UINT8_C( 12), UINT8_C( 29) },
+      { UINT8_C( 12), UINT8_C( 12), UINT8_C( 12), UINT8_C( 12), UINT8_C( 12), UINT8_C( 12), UINT8_C( 12), UINT8_C( 12) },
+      { UINT8_C( 29), UINT8_C( 29), UINT8_C( 29), UINT8_C( 29), UINT8_C( 29), UINT8_C( 29), UINT8_C( 29), UINT8_C( 29) } },
+    { { UINT8_C( 32), UINT8_C(  6) },
+      { UINT8_C( 32), UINT8_C( 32), UINT8_C( 32), UINT8_C( 32), UINT8_C( 32), UINT8_C( 32), UINT8_C( 32), UINT8_C( 32) },
+      { UINT8_C(  6), UINT8_C(  6), UINT8_C(  6), UINT8_C(  6), UINT8_C(  6), UINT8_C(  6), UINT8_C(  6), UINT8_C(  6) } },
+    { { UINT8_C( 26), UINT8_C(223) },
+      { UINT8_C( 26), UINT8_C( 26), UINT8_C( 26), UINT8_C( 26), UINT8_C( 26), UINT8_C( 26), UINT8_C( 26), UINT8_C( 26) },
+      { UINT8_C(223), UINT8_C(223), UINT8_C(223), UINT8_C(223), UINT8_C(223), UINT8_C(223), UINT8_C(223), UINT8_C(223) } },
+    { { UINT8_C(149), UINT8_C(236) },
+      { UINT8_C(149), UINT8_C(149), UINT8_C(149), UINT8_C(149), UINT8_C(149), UINT8_C(149), UINT8_C(149), UINT8_C(149) },
+      { UINT8_C(236), UINT8_C(236), UINT8_C(236), UINT8_C(236), UINT8_C(236), UINT8_C(236), UINT8_C(236), UINT8_C(236) } },
+    { { UINT8_C( 86), UINT8_C(217) },
+      { UINT8_C( 86), UINT8_C( 86), UINT8_C( 86), UINT8_C( 86), UINT8_C( 86), UINT8_C( 86), UINT8_C( 86), UINT8_C( 86) },
+      { UINT8_C(217), UINT8_C(217), UINT8_C(217), UINT8_C(217), UINT8_C(217), UINT8_C(217), UINT8_C(217), UINT8_C(217) } },
+    { { UINT8_C( 79), UINT8_C(  6) },
+      { UINT8_C( 79), UINT8_C( 79), UINT8_C( 79), UINT8_C( 79), UINT8_C( 79), UINT8_C( 79), UINT8_C( 79), UINT8_C( 79) },
+      { UINT8_C(  6), UINT8_C(  6), UINT8_C(  6), UINT8_C(  6), UINT8_C(  6), UINT8_C(  6), UINT8_C(  6), UINT8_C(  6) } },
+    { { UINT8_C(227), UINT8_C( 93) },
+      { UINT8_C(227), UINT8_C(227), UINT8_C(227), UINT8_C(227), UINT8_C(227), UINT8_C(227), UINT8_C(227), UINT8_C(227) },
+      { UINT8_C( 93), UINT8_C( 93), UINT8_C( 93), UINT8_C( 93), UINT8_C( 93), UINT8_C( 93), UINT8_C( 93), UINT8_C( 93) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x8x2_t r = simde_vld2_dup_u8(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u8x8(r.val[0], simde_vld1_u8(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u8x8(r.val[1], simde_vld1_u8(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_dup_u16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t a[2];
+    uint16_t r0[4];
+    uint16_t r1[4];
+  } test_vec[] = {
+    { { UINT16_C(61355), UINT16_C(24290) },
+      { UINT16_C(61355), UINT16_C(61355), UINT16_C(61355), UINT16_C(61355) },
+      { UINT16_C(24290), UINT16_C(24290), UINT16_C(24290), UINT16_C(24290) } },
+    { { UINT16_C(46890), UINT16_C(61001) },
+      { UINT16_C(46890), UINT16_C(46890), UINT16_C(46890), UINT16_C(46890) },
+      { UINT16_C(61001), UINT16_C(61001), UINT16_C(61001), UINT16_C(61001) } },
+    { { UINT16_C(41232), UINT16_C(16262) },
+      { UINT16_C(41232), UINT16_C(41232), UINT16_C(41232), UINT16_C(41232) },
+      { UINT16_C(16262), UINT16_C(16262), UINT16_C(16262), UINT16_C(16262) } },
+    { { UINT16_C(19072), UINT16_C(61256) },
+      { UINT16_C(19072), UINT16_C(19072), UINT16_C(19072), UINT16_C(19072) },
+      { UINT16_C(61256), UINT16_C(61256), UINT16_C(61256), UINT16_C(61256) } },
+    { { UINT16_C(54275), UINT16_C(14447) },
+      { UINT16_C(54275), UINT16_C(54275), UINT16_C(54275), UINT16_C(54275) },
+      { UINT16_C(14447), UINT16_C(14447), UINT16_C(14447), UINT16_C(14447) } },
+    { { UINT16_C( 6840), UINT16_C(15040) },
+      { UINT16_C( 6840), UINT16_C( 6840), UINT16_C( 6840), UINT16_C( 6840) },
+      { UINT16_C(15040), UINT16_C(15040), UINT16_C(15040), UINT16_C(15040) } },
+    { { UINT16_C(29164), UINT16_C(35893) },
+      { UINT16_C(29164), UINT16_C(29164), UINT16_C(29164), UINT16_C(29164) },
+      { UINT16_C(35893), UINT16_C(35893), UINT16_C(35893), UINT16_C(35893) } },
+    { { UINT16_C(11697), UINT16_C(45734) },
+      { UINT16_C(11697), UINT16_C(11697), UINT16_C(11697), UINT16_C(11697) },
+      { UINT16_C(45734), UINT16_C(45734), UINT16_C(45734), UINT16_C(45734) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x4x2_t r = simde_vld2_dup_u16(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u16x4(r.val[0], simde_vld1_u16(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u16x4(r.val[1], simde_vld1_u16(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_dup_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a[2];
+    uint32_t r0[2];
+    uint32_t r1[2];
+  } test_vec[] = {
+    { { UINT32_C(3526284006), UINT32_C(4126386213) },
+      { UINT32_C(3526284006), UINT32_C(3526284006) },
+      { UINT32_C(4126386213), UINT32_C(4126386213) } },
+    { { UINT32_C( 349363111), UINT32_C(4102874331) },
+      { UINT32_C( 349363111), UINT32_C( 349363111) },
+      { UINT32_C(4102874331), UINT32_C(4102874331) } },
+    { { UINT32_C(3059157528), UINT32_C(1594906052) },
+      { UINT32_C(3059157528), UINT32_C(3059157528) },
+      { UINT32_C(1594906052), UINT32_C(1594906052) } },
+    { { UINT32_C( 656427600), UINT32_C(3381686076) },
+      { UINT32_C( 656427600), UINT32_C( 656427600) },
+      { UINT32_C(3381686076), UINT32_C(3381686076) } },
+    { { UINT32_C(2597117032), UINT32_C(4003467282) },
+      { UINT32_C(2597117032), UINT32_C(2597117032) },
+      { UINT32_C(4003467282), UINT32_C(4003467282) } },
+    { { UINT32_C(3660379977), UINT32_C(  89865409) },
+      { UINT32_C(3660379977), UINT32_C(3660379977) },
+      { UINT32_C(  89865409), UINT32_C(  89865409) } },
+    { { UINT32_C(3082433970), UINT32_C(4276646158) },
+      { UINT32_C(3082433970), UINT32_C(3082433970) },
+      { UINT32_C(4276646158), UINT32_C(4276646158) } },
+    { { UINT32_C( 774078587), UINT32_C(3385228822) },
+      { UINT32_C( 774078587), UINT32_C( 774078587) },
+      { UINT32_C(3385228822), UINT32_C(3385228822) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x2x2_t r = simde_vld2_dup_u32(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u32x2(r.val[0], simde_vld1_u32(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u32x2(r.val[1], simde_vld1_u32(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_dup_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a[2];
+    uint64_t r0[1];
+    uint64_t r1[1];
+  } test_vec[] = {
+    { { UINT64_C(17053413103762403895), UINT64_C(12447564413682190357) },
+      { UINT64_C(17053413103762403895) },
+      { UINT64_C(12447564413682190357) } },
+    { { UINT64_C( 7282262288099131121), UINT64_C( 7042761032352541504) },
+      { UINT64_C( 7282262288099131121) },
+      { UINT64_C( 7042761032352541504) } },
+    { { UINT64_C(10377364904441520073), UINT64_C(15498962778217998417) },
+      { UINT64_C(10377364904441520073) },
+      { UINT64_C(15498962778217998417) } },
+    { { UINT64_C( 6599114188676879440), UINT64_C(10700935202277793808) },
+      { UINT64_C( 6599114188676879440) },
+      { UINT64_C(10700935202277793808) } },
+    { { UINT64_C( 8327618358856354292), UINT64_C( 1303834089132691790) },
+      { UINT64_C( 8327618358856354292) },
+      { UINT64_C( 1303834089132691790) } },
+    { { UINT64_C(16406645953067494759), UINT64_C(18260326814932787779) },
+      { UINT64_C(16406645953067494759) },
+      { UINT64_C(18260326814932787779) } },
+    { { UINT64_C( 3695573719965496957), UINT64_C( 2985918616810082794) },
+      { UINT64_C( 3695573719965496957) },
+      { UINT64_C( 2985918616810082794) } },
+    { { UINT64_C( 3853549973308338470), UINT64_C( 7185718493004488170) },
+      { UINT64_C( 3853549973308338470) },
+      { UINT64_C( 7185718493004488170) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x1x2_t r = simde_vld2_dup_u64(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u64x1(r.val[0], simde_vld1_u64(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u64x1(r.val[1], simde_vld1_u64(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_dup_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 r0[4];
+    simde_float32 r1[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   751.38), SIMDE_FLOAT32_C(  -206.90) },
+      { SIMDE_FLOAT32_C(   751.38), SIMDE_FLOAT32_C(   751.38), SIMDE_FLOAT32_C(   751.38), SIMDE_FLOAT32_C(   751.38) },
+      { SIMDE_FLOAT32_C(  -206.90), SIMDE_FLOAT32_C(  -206.90), SIMDE_FLOAT32_C(  -206.90), SIMDE_FLOAT32_C(  -206.90) } },
+    { { SIMDE_FLOAT32_C(   758.92), SIMDE_FLOAT32_C(   641.40) },
+      { SIMDE_FLOAT32_C(   758.92), SIMDE_FLOAT32_C(   758.92), SIMDE_FLOAT32_C(   758.92), SIMDE_FLOAT32_C(   758.92) },
+      { SIMDE_FLOAT32_C(   641.40), SIMDE_FLOAT32_C(   641.40), SIMDE_FLOAT32_C(   641.40), SIMDE_FLOAT32_C(   641.40) } },
+    { { SIMDE_FLOAT32_C(   109.01), SIMDE_FLOAT32_C(  -796.74) },
+      { SIMDE_FLOAT32_C(   109.01), SIMDE_FLOAT32_C(   109.01), SIMDE_FLOAT32_C(   109.01), SIMDE_FLOAT32_C(   109.01) },
+      { SIMDE_FLOAT32_C(  -796.74), SIMDE_FLOAT32_C(  -796.74), SIMDE_FLOAT32_C(  -796.74), SIMDE_FLOAT32_C(  -796.74) } },
+    { { SIMDE_FLOAT32_C(  -332.64), SIMDE_FLOAT32_C(   909.87) },
+      { SIMDE_FLOAT32_C(  -332.64), SIMDE_FLOAT32_C(  -332.64), SIMDE_FLOAT32_C(  -332.64), SIMDE_FLOAT32_C(  -332.64) },
+      { SIMDE_FLOAT32_C(   909.87), SIMDE_FLOAT32_C(   909.87), SIMDE_FLOAT32_C(   909.87), SIMDE_FLOAT32_C(   909.87) } },
+    { { SIMDE_FLOAT32_C(  -472.15), SIMDE_FLOAT32_C(   180.65) },
+      { SIMDE_FLOAT32_C(  -472.15), SIMDE_FLOAT32_C(  -472.15), SIMDE_FLOAT32_C(  -472.15), SIMDE_FLOAT32_C(  -472.15) },
+      { SIMDE_FLOAT32_C(   180.65), SIMDE_FLOAT32_C(   180.65), SIMDE_FLOAT32_C(   180.65), SIMDE_FLOAT32_C(   180.65) } },
+    { { SIMDE_FLOAT32_C(  -598.30), SIMDE_FLOAT32_C(   464.68) },
+      { SIMDE_FLOAT32_C(  -598.30), SIMDE_FLOAT32_C(  -598.30), SIMDE_FLOAT32_C(  -598.30), SIMDE_FLOAT32_C(  -598.30) },
+      { SIMDE_FLOAT32_C(   464.68), SIMDE_FLOAT32_C(   464.68), SIMDE_FLOAT32_C(   464.68), SIMDE_FLOAT32_C(   464.68) } },
+    { { SIMDE_FLOAT32_C(   375.63), SIMDE_FLOAT32_C(   779.87) },
+      { SIMDE_FLOAT32_C(   375.63), SIMDE_FLOAT32_C(   375.63), SIMDE_FLOAT32_C(   375.63), SIMDE_FLOAT32_C(   375.63) },
+      { SIMDE_FLOAT32_C(   779.87), SIMDE_FLOAT32_C(   779.87), SIMDE_FLOAT32_C(   779.87), SIMDE_FLOAT32_C(   779.87) } },
+    { { SIMDE_FLOAT32_C(   187.25), SIMDE_FLOAT32_C(  -779.24) },
+      { SIMDE_FLOAT32_C(   187.25), SIMDE_FLOAT32_C(   187.25), SIMDE_FLOAT32_C(   187.25), SIMDE_FLOAT32_C(   187.25) },
+      { SIMDE_FLOAT32_C(  -779.24), SIMDE_FLOAT32_C(  -779.24), SIMDE_FLOAT32_C(  -779.24), SIMDE_FLOAT32_C(  -779.24) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4x2_t r = simde_vld2q_dup_f32(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_f32x4(r.val[0], simde_vld1q_f32(test_vec[i].r0), 1);
+    simde_test_arm_neon_assert_equal_f32x4(r.val[1], simde_vld1q_f32(test_vec[i].r1), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_dup_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 r0[2];
+    simde_float64 r1[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   592.00), SIMDE_FLOAT64_C(   152.41) },
+      { SIMDE_FLOAT64_C(   592.00), SIMDE_FLOAT64_C(   592.00) },
+      { SIMDE_FLOAT64_C(   152.41), SIMDE_FLOAT64_C(   152.41) } },
+    { { SIMDE_FLOAT64_C(   886.61), SIMDE_FLOAT64_C(    39.09) },
+      { SIMDE_FLOAT64_C(   886.61), SIMDE_FLOAT64_C(   886.61) },
+      { SIMDE_FLOAT64_C(    39.09), SIMDE_FLOAT64_C(    39.09) } },
+    { { SIMDE_FLOAT64_C(  -351.40), SIMDE_FLOAT64_C(  -113.73) },
+      { SIMDE_FLOAT64_C(  -351.40), SIMDE_FLOAT64_C(  -351.40) },
+      { SIMDE_FLOAT64_C(  -113.73), SIMDE_FLOAT64_C(  -113.73) } },
+    { { SIMDE_FLOAT64_C(   122.78), SIMDE_FLOAT64_C(   397.04) },
+      { SIMDE_FLOAT64_C(   122.78), SIMDE_FLOAT64_C(   122.78) },
+      { SIMDE_FLOAT64_C(   397.04), SIMDE_FLOAT64_C(   397.04) } },
+    { { SIMDE_FLOAT64_C(   264.72), SIMDE_FLOAT64_C(   723.65) },
+      { SIMDE_FLOAT64_C(   264.72), SIMDE_FLOAT64_C(   264.72) },
+      { SIMDE_FLOAT64_C(   723.65), SIMDE_FLOAT64_C(   723.65) } },
+    { { SIMDE_FLOAT64_C(    71.84), SIMDE_FLOAT64_C(  -590.25) },
+      { SIMDE_FLOAT64_C(    71.84), SIMDE_FLOAT64_C(    71.84) },
+      { SIMDE_FLOAT64_C(  -590.25), SIMDE_FLOAT64_C(  -590.25) } },
+    { { SIMDE_FLOAT64_C(   717.91), SIMDE_FLOAT64_C(   422.65) },
+      { SIMDE_FLOAT64_C(   717.91), SIMDE_FLOAT64_C(   717.91) },
+      { SIMDE_FLOAT64_C(   422.65), SIMDE_FLOAT64_C(   422.65) } },
+    { { SIMDE_FLOAT64_C(  -683.78), SIMDE_FLOAT64_C(   -78.37) },
+      { SIMDE_FLOAT64_C(  -683.78), SIMDE_FLOAT64_C(  -683.78) },
+      { SIMDE_FLOAT64_C(   -78.37), SIMDE_FLOAT64_C(   -78.37) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2x2_t r = simde_vld2q_dup_f64(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_f64x2(r.val[0], simde_vld1q_f64(test_vec[i].r0), 1);
+    simde_test_arm_neon_assert_equal_f64x2(r.val[1], simde_vld1q_f64(test_vec[i].r1), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_dup_s8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t a[2];
+    int8_t r0[16];
+    int8_t r1[16];
+  } test_vec[] = {
+    { {  INT8_C(  90),  INT8_C( 127) },
+      {  INT8_C(  90),  INT8_C(  90),  INT8_C(  90),  INT8_C(  90),  INT8_C(  90),  INT8_C(  90),  INT8_C(  90),  INT8_C(  90),
+         INT8_C(  90),  INT8_C(  90),  INT8_C(  90),  INT8_C(  90),  INT8_C(  90),  INT8_C(  90),  INT8_C(  90),  INT8_C(  90) },
+      {  INT8_C( 127),  INT8_C( 127),  INT8_C( 127),  INT8_C( 127),  INT8_C( 127),  INT8_C( 127),  INT8_C( 127),  INT8_C( 127),
+         INT8_C( 127),  INT8_C( 127),  INT8_C( 127),  INT8_C( 127),  INT8_C( 127),  INT8_C( 127),  INT8_C( 127),  INT8_C( 127) } },
+    { {  INT8_C(  20), -INT8_C(  59) },
+      {  INT8_C(  20),  INT8_C(  20),  INT8_C(  20),  INT8_C(  20),  INT8_C(  20),  INT8_C(  20),  INT8_C(  20),  INT8_C(  20),
+         INT8_C(  20),  INT8_C(  20),  INT8_C(  20),  INT8_C(  20),  INT8_C(  20),  INT8_C(  20),  INT8_C(  20),  INT8_C(  20) },
+      { -INT8_C(  59), -INT8_C(  59), -INT8_C(  59), -INT8_C(  59), -INT8_C(  59), -INT8_C(  59), -INT8_C(  59), -INT8_C(  59),
+        -INT8_C(  59), -INT8_C(  59), -INT8_C(  59), -INT8_C(  59), -INT8_C(  59), -INT8_C(  59), -INT8_C(  59), -INT8_C(  59) } },
+    { { -INT8_C(  96),  INT8_C( 107) },
+      { -INT8_C(  96), -INT8_C(  96), -INT8_C(  96), -INT8_C(  96), -INT8_C(  96), -INT8_C(  96), -INT8_C(  96), -INT8_C(  96),
+        -INT8_C(  96), -INT8_C(  96), -INT8_C(  96), -INT8_C(  96), -INT8_C(  96), -INT8_C(  96), -INT8_C(  96), -INT8_C(  96) },
+      {  INT8_C( 107),  INT8_C( 107),  INT8_C( 107),  INT8_C( 107),  INT8_C( 107),  INT8_C( 107),  INT8_C( 107),  INT8_C( 107),
+         INT8_C( 107),  INT8_C( 107),  INT8_C( 107),  INT8_C( 107),  INT8_C( 107),  INT8_C( 107),  INT8_C( 107),  INT8_C( 107) } },
+    { {  INT8_C(  94),  INT8_C(   7) },
+      {  INT8_C(  94),  INT8_C(  94),  INT8_C(  94),  INT8_C(  94),  INT8_C(  94),  INT8_C(  94),  INT8_C(  94),  INT8_C(  94),
+         INT8_C(  94),  INT8_C(  94),  INT8_C(  94),  INT8_C(  94),  INT8_C(  94),  INT8_C(  94),  INT8_C(  94),  INT8_C(  94) },
+      {  INT8_C(   7),  INT8_C(   7),  INT8_C(   7),  INT8_C(   7),  INT8_C(   7),  INT8_C(   7),  INT8_C(   7),  INT8_C(   7),
+         INT8_C(   7),  INT8_C(   7),  INT8_C(   7),  INT8_C(   7),  INT8_C(   7),  INT8_C(   7),  INT8_C(   7),  INT8_C(   7) } },
+    { {  INT8_C(  60), -INT8_C(  43) },
+      {  INT8_C(  60),  INT8_C(  60),  INT8_C(  60),  INT8_C(  60),  INT8_C(  60),  INT8_C(  60),  INT8_C(  60),  INT8_C(  60),
+         INT8_C(  60),  INT8_C(  60),  INT8_C(  60),  INT8_C(  60),  INT8_C(  60),  INT8_C(  60),  INT8_C(  60),  INT8_C(  60) },
+      { -INT8_C(  43), -INT8_C(  43), -INT8_C(  43), -INT8_C(  43), -INT8_C(  43), -INT8_C(  43), -INT8_C(  43), -INT8_C(  43),
+        -INT8_C(  43), -INT8_C(  43), -INT8_C(  43), -INT8_C(  43), -INT8_C(  43), -INT8_C(  43), -INT8_C(  43), -INT8_C(  43) } },
+    { { -INT8_C(  77), -INT8_C(  17) },
+      { -INT8_C(  77), -INT8_C(  77), -INT8_C(  77), -INT8_C(  77), -INT8_C(  77), -INT8_C(  77), -INT8_C(  77), -INT8_C(  77),
+        -INT8_C(  77), -INT8_C(  77), -INT8_C(  77), -INT8_C(  77), -INT8_C(  77), -INT8_C(  77), -INT8_C(  77), -INT8_C(  77) },
+      { -INT8_C(  17), -INT8_C(  17), -INT8_C(  17), -INT8_C(  17), -INT8_C(  17), -INT8_C(  17), -INT8_C(  17), -INT8_C(  17),
+        -INT8_C(  17), -INT8_C(  17), -INT8_C(  17), -INT8_C(  17), -INT8_C(  17), -INT8_C(  17), -INT8_C(  17), -INT8_C(  17) } },
+    { {  INT8_C(  50),  INT8_C(   7) },
+      {  INT8_C(  50),  INT8_C(  50),  INT8_C(  50),  INT8_C(  50),  INT8_C(  50),  INT8_C(  50),  INT8_C(  50),  INT8_C(  50),
+         INT8_C(  50),  INT8_C(  50),  INT8_C(  50),  INT8_C(  50),  INT8_C(  50),  INT8_C(  50),  INT8_C(  50),  INT8_C(  50) },
+      {  INT8_C(   7),  INT8_C(   7),  INT8_C(   7),  INT8_C(   7),  INT8_C(   7),  INT8_C(   7),  INT8_C(   7),  INT8_C(   7),
+         INT8_C(   7),  INT8_C(   7),  INT8_C(   7),  INT8_C(   7),  INT8_C(   7),  INT8_C(   7),  INT8_C(   7),  INT8_C(   7) } },
+    { {  INT8_C(  94),  INT8_C(  64) },
+      {  INT8_C(  94),  INT8_C(  94),  INT8_C(  94),  INT8_C(  94),  INT8_C(  94),  INT8_C(  94),  INT8_C(  94),  INT8_C(  94),
+         INT8_C(  94),  INT8_C(  94),  INT8_C(  94),  INT8_C(  94),  INT8_C(  94),  INT8_C(  94),  INT8_C(  94),  INT8_C(  94) },
+      {  INT8_C(  64),  INT8_C(  64),  INT8_C(  64),  INT8_C(  64),  INT8_C(  64),  INT8_C(  64),  INT8_C(  64),  INT8_C(  64),
+         INT8_C(  64),  INT8_C(  64),  INT8_C(  64),  INT8_C(  64),  INT8_C(  64),  INT8_C(  64),  INT8_C(  64),  INT8_C(  64) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x16x2_t r = simde_vld2q_dup_s8(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i8x16(r.val[0], simde_vld1q_s8(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i8x16(r.val[1], simde_vld1q_s8(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_dup_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t a[2];
+    int16_t r0[8];
+    int16_t r1[8];
+  } test_vec[] = {
+    { {  INT16_C(  4956),  INT16_C( 13369) },
+      {  INT16_C(  4956),  INT16_C(  4956),  INT16_C(  4956),  INT16_C(  4956),  INT16_C(  4956),  INT16_C(  4956),  INT16_C(  4956),  INT16_C(  4956) },
+      {  INT16_C( 13369),  INT16_C( 13369),  INT16_C( 13369),  INT16_C( 13369),  INT16_C( 13369),  INT16_C( 13369),  INT16_C( 13369),  INT16_C( 13369) } },
+    { {  INT16_C( 29377),  INT16_C( 29663) },
+      {  INT16_C( 29377),  INT16_C( 29377),  INT16_C( 29377),  INT16_C( 29377),  INT16_C( 29377),  INT16_C( 29377),  INT16_C( 29377),  INT16_C( 29377) },
+      {  INT16_C( 29663),  INT16_C( 29663),  INT16_C( 29663),  INT16_C( 29663),  INT16_C( 29663),  INT16_C( 29663),  INT16_C( 29663),  INT16_C( 29663) } },
+    { {  INT16_C(  2486),  INT16_C( 10375) },
+      {  INT16_C(  2486),  INT16_C(  2486),  INT16_C(  2486),  INT16_C(  2486),  INT16_C(  2486),  INT16_C(  2486),  INT16_C(  2486),  INT16_C(  2486) },
+      {  INT16_C( 10375),  INT16_C( 10375),  INT16_C( 10375),  INT16_C( 10375),  INT16_C( 10375),  INT16_C( 10375),  INT16_C( 10375),  INT16_C( 10375) } },
+    { { -INT16_C( 31972), -INT16_C( 17134) },
+      { -INT16_C( 31972), -INT16_C( 31972), -INT16_C( 31972), -INT16_C( 31972), -INT16_C( 31972), -INT16_C( 31972), -INT16_C( 31972), -INT16_C( 31972) },
+      { -INT16_C( 17134), -INT16_C( 17134), -INT16_C( 17134), -INT16_C( 17134), -INT16_C( 17134), -INT16_C( 17134), -INT16_C( 17134), -INT16_C( 17134) } },
+    { {  INT16_C( 10447),  INT16_C( 16752) },
+      {  INT16_C( 10447),  INT16_C( 10447),  INT16_C( 10447),  INT16_C( 10447),  INT16_C( 10447),  INT16_C( 10447),  INT16_C( 10447),  INT16_C( 10447) },
+      {  INT16_C( 16752),  INT16_C( 16752),  INT16_C( 16752),  INT16_C( 16752),  INT16_C( 16752),  INT16_C( 16752),  INT16_C( 16752),  INT16_C( 16752) } },
+    { {  INT16_C( 21641),  INT16_C( 16400) },
+      {  INT16_C( 21641),  INT16_C( 21641),  INT16_C( 21641),  INT16_C( 21641),  INT16_C( 21641),  INT16_C( 21641),  INT16_C( 21641),  INT16_C( 21641) },
+      {  INT16_C( 16400),  INT16_C( 16400),  INT16_C( 16400),  INT16_C( 16400),  INT16_C( 16400),  INT16_C( 16400),  INT16_C( 16400),  INT16_C( 16400) } },
+    { {  INT16_C( 27284),  INT16_C(  7598) },
+      {  INT16_C( 27284),  INT16_C( 27284),  INT16_C( 27284),  INT16_C( 27284),  INT16_C( 27284),  INT16_C( 27284),  INT16_C( 27284),  INT16_C( 27284) },
+      {  INT16_C(  7598),  INT16_C(  7598),  INT16_C(  7598),  INT16_C(  7598),  INT16_C(  7598),  INT16_C(  7598),  INT16_C(  7598),  INT16_C(  7598) } },
+    { {  INT16_C( 16728), -INT16_C( 13460) },
+      {  INT16_C( 16728),  INT16_C( 16728),  INT16_C( 16728),  INT16_C( 16728),  INT16_C( 16728),  INT16_C( 16728),  INT16_C( 16728),  INT16_C( 16728) },
+      { -INT16_C( 13460), -INT16_C( 13460), -INT16_C( 13460), -INT16_C( 13460), -INT16_C( 13460), -INT16_C( 13460), -INT16_C( 13460), -INT16_C( 13460) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8x2_t r = simde_vld2q_dup_s16(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i16x8(r.val[0], simde_vld1q_s16(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i16x8(r.val[1], simde_vld1q_s16(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_dup_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t a[2];
+    int32_t r0[4];
+    int32_t r1[4];
+  } test_vec[] = {
+    { {  INT32_C( 1898259698), -INT32_C( 1030680086) },
+      {  INT32_C( 1898259698),  INT32_C( 1898259698),  INT32_C( 1898259698),  INT32_C( 1898259698) },
+      { -INT32_C( 1030680086), -INT32_C( 1030680086), -INT32_C( 1030680086), -INT32_C( 1030680086) } },
+    { {  INT32_C( 1302302816), -INT32_C( 2133550653) },
+      {  INT32_C( 1302302816),  INT32_C( 1302302816),  INT32_C( 1302302816),  INT32_C( 1302302816) },
+      { -INT32_C( 2133550653), -INT32_C( 2133550653), -INT32_C( 2133550653), -INT32_C( 2133550653) } },
+    { { -INT32_C(  112660043), -INT32_C(   11487441) },
+      { -INT32_C(  112660043), -INT32_C(  112660043), -INT32_C(  112660043), -INT32_C(  112660043) },
+      { -INT32_C(   11487441), -INT32_C(   11487441), -INT32_C(   11487441), -INT32_C(   11487441) } },
+    { { -INT32_C( 1888093323),  INT32_C(  313755623) },
+      { -INT32_C( 1888093323), -INT32_C( 1888093323), -INT32_C( 1888093323), -INT32_C( 1888093323) },
+      {  INT32_C(  313755623),  INT32_C(  313755623),  INT32_C(  313755623),  INT32_C(  313755623) } },
+    { { -INT32_C( 1427929457),  INT32_C( 1799092504) },
+      { -INT32_C( 1427929457), -INT32_C( 1427929457), -INT32_C( 1427929457), -INT32_C( 1427929457) },
+      {  INT32_C( 1799092504),  INT32_C( 1799092504),  INT32_C( 1799092504),  INT32_C( 1799092504) } },
+    { { -INT32_C( 1936058818), -INT32_C( 1781877925) },
+      { -INT32_C( 1936058818), -INT32_C( 1936058818), -INT32_C( 1936058818), -INT32_C( 1936058818) },
+      { -INT32_C( 1781877925), -INT32_C( 1781877925), -INT32_C( 1781877925), -INT32_C( 1781877925) } },
+    { {  INT32_C( 1827389721),  INT32_C(  966433253) },
+      {  INT32_C( 1827389721),  INT32_C( 1827389721),  INT32_C( 1827389721),  INT32_C( 1827389721) },
+      {  INT32_C(  966433253),  INT32_C(  966433253),  INT32_C(  966433253),  INT32_C(  966433253) } },
+    { {  INT32_C( 1320394706),  INT32_C(  840573635) },
+      {  INT32_C( 1320394706),  INT32_C( 1320394706),  INT32_C( 1320394706),  INT32_C( 1320394706) },
+      {  INT32_C(  840573635),  INT32_C(  840573635),  INT32_C(  840573635),  INT32_C(  840573635) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4x2_t r = simde_vld2q_dup_s32(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i32x4(r.val[0], simde_vld1q_s32(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i32x4(r.val[1], simde_vld1q_s32(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_dup_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t a[2];
+    int64_t r0[2];
+    int64_t r1[2];
+  } test_vec[] = {
+    { {  INT64_C( 6969876754362314417),  INT64_C( 5011788995917728712) },
+      {  INT64_C( 6969876754362314417),  INT64_C( 6969876754362314417) },
+      {  INT64_C( 5011788995917728712),  INT64_C( 5011788995917728712) } },
+    { {  INT64_C( 5160505024586266623),  INT64_C(  774592281898834419) },
+      {  INT64_C( 5160505024586266623),  INT64_C( 5160505024586266623) },
+      {  INT64_C(  774592281898834419),  INT64_C(  774592281898834419) } },
+    { { -INT64_C( 1202314667783408084), -INT64_C( 2896138383065426917) },
+      { -INT64_C( 1202314667783408084), -INT64_C( 1202314667783408084) },
+      { -INT64_C( 2896138383065426917), -INT64_C( 2896138383065426917) } },
+    { { -INT64_C( 4329855472540262292),  INT64_C( 3876366293070024955) },
+      { -INT64_C( 4329855472540262292), -INT64_C( 4329855472540262292) },
+      {  INT64_C( 3876366293070024955),  INT64_C( 3876366293070024955) } },
+    { {  INT64_C( 3187709816335069662),  INT64_C(  900866205698924203) },
+      {  INT64_C( 3187709816335069662),  INT64_C( 3187709816335069662) },
+      {  INT64_C(  900866205698924203),  INT64_C(  900866205698924203) } },
+    { { -INT64_C( 6765758635192452297),  INT64_C( 9074634154766578870) },
+      { -INT64_C( 6765758635192452297), -INT64_C( 6765758635192452297) },
+      {  INT64_C( 9074634154766578870),  INT64_C( 9074634154766578870) } },
+    { {  INT64_C( 4191741816152347272),  INT64_C( 4414142341096088010) },
+      {  INT64_C( 4191741816152347272),  INT64_C( 4191741816152347272) },
+      {  INT64_C( 4414142341096088010),  INT64_C( 4414142341096088010) } },
+    { {  INT64_C(  407091593913990178),  INT64_C( 4670342856861658782) },
+      {  INT64_C(  407091593913990178),  INT64_C(  407091593913990178) },
+      {  INT64_C( 4670342856861658782),  INT64_C( 4670342856861658782) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2x2_t r = simde_vld2q_dup_s64(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_i64x2(r.val[0], simde_vld1q_s64(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i64x2(r.val[1], simde_vld1q_s64(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_dup_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t a[2];
+    uint8_t r0[16];
+    uint8_t r1[16];
+  } test_vec[] = {
+    { { UINT8_C(204), UINT8_C(171) },
+      { UINT8_C(204), UINT8_C(204), UINT8_C(204), UINT8_C(204), UINT8_C(204), UINT8_C(204), UINT8_C(204), UINT8_C(204),
+        UINT8_C(204), UINT8_C(204), UINT8_C(204), UINT8_C(204), UINT8_C(204), UINT8_C(204), UINT8_C(204), UINT8_C(204) },
+      { UINT8_C(171), UINT8_C(171), UINT8_C(171), UINT8_C(171), UINT8_C(171), UINT8_C(171), UINT8_C(171), UINT8_C(171),
+        UINT8_C(171), UINT8_C(171), UINT8_C(171), UINT8_C(171), UINT8_C(171), UINT8_C(171), UINT8_C(171), UINT8_C(171) } },
+    { { UINT8_C( 23), UINT8_C( 56) },
+      { UINT8_C( 23), UINT8_C( 23), UINT8_C( 23), UINT8_C( 23), UINT8_C( 23), UINT8_C( 23), UINT8_C( 23), UINT8_C( 23),
+        UINT8_C( 23), UINT8_C( 23), UINT8_C( 23), UINT8_C( 23), UINT8_C( 23), UINT8_C( 23), UINT8_C( 23), UINT8_C( 23) },
+      { UINT8_C( 56), UINT8_C( 56), UINT8_C( 56), UINT8_C( 56), UINT8_C( 56), UINT8_C( 56), UINT8_C( 56), UINT8_C( 56),
+        UINT8_C( 56), UINT8_C( 56), UINT8_C( 56), UINT8_C( 56), UINT8_C( 56), UINT8_C( 56), UINT8_C( 56), UINT8_C( 56) } },
+    { { UINT8_C( 86), UINT8_C(  5) },
+      { UINT8_C( 86), UINT8_C( 86), UINT8_C( 86), UINT8_C( 86), UINT8_C( 86), UINT8_C( 86), UINT8_C( 86), UINT8_C( 86),
+        UINT8_C( 86), UINT8_C( 86), UINT8_C( 86), UINT8_C( 86), UINT8_C( 86), UINT8_C( 86), UINT8_C( 86), UINT8_C( 86) },
+      { UINT8_C(  5), UINT8_C(  5), UINT8_C(  5), UINT8_C(  5), UINT8_C(  5), UINT8_C(  5), UINT8_C(  5), UINT8_C(  5),
+        UINT8_C(  5), UINT8_C(  5), UINT8_C(  5), UINT8_C(  5), UINT8_C(  5), UINT8_C(  5), UINT8_C(  5), UINT8_C(  5) } },
+    { { UINT8_C(142), UINT8_C(124) },
+      { UINT8_C(142), UINT8_C(142), UINT8_C(142), UINT8_C(142), UINT8_C(142), UINT8_C(142), UINT8_C(142), UINT8_C(142),
+        UINT8_C(142), UINT8_C(142), UINT8_C(142), UINT8_C(142), UINT8_C(142), UINT8_C(142), UINT8_C(142), UINT8_C(142) },
+      { UINT8_C(124), UINT8_C(124), UINT8_C(124), UINT8_C(124), UINT8_C(124), UINT8_C(124), UINT8_C(124), UINT8_C(124),
+        UINT8_C(124), UINT8_C(124), UINT8_C(124), UINT8_C(124), UINT8_C(124), UINT8_C(124), UINT8_C(124), UINT8_C(124) } },
+    { { UINT8_C(172), UINT8_C( 99) },
+      { UINT8_C(172), UINT8_C(172), UINT8_C(172), UINT8_C(172), UINT8_C(172), UINT8_C(172), UINT8_C(172), UINT8_C(172),
+        UINT8_C(172), UINT8_C(172), UINT8_C(172), UINT8_C(172), UINT8_C(172), UINT8_C(172), UINT8_C(172), UINT8_C(172) },
+      { UINT8_C( 99), UINT8_C( 99), UINT8_C( 99), UINT8_C( 99), UINT8_C( 99), UINT8_C( 99), UINT8_C( 99), UINT8_C( 99),
+        UINT8_C( 99), UINT8_C( 99), UINT8_C( 99), UINT8_C( 99), UINT8_C( 99), UINT8_C( 99), UINT8_C( 99), UINT8_C( 99) } },
+    { { UINT8_C(186), UINT8_C(254) },
+      { UINT8_C(186), UINT8_C(186), UINT8_C(186), UINT8_C(186), UINT8_C(186), UINT8_C(186), UINT8_C(186), UINT8_C(186),
+        UINT8_C(186), UINT8_C(186), UINT8_C(186), UINT8_C(186), UINT8_C(186), UINT8_C(186), UINT8_C(186), UINT8_C(186) },
+      { UINT8_C(254), UINT8_C(254), UINT8_C(254), UINT8_C(254), UINT8_C(254), UINT8_C(254), UINT8_C(254), UINT8_C(254),
+        UINT8_C(254), UINT8_C(254), UINT8_C(254), UINT8_C(254), UINT8_C(254), UINT8_C(254), UINT8_C(254), UINT8_C(254) } },
+    { { UINT8_C(147), UINT8_C(172) },
+      { UINT8_C(147), UINT8_C(147), UINT8_C(147), UINT8_C(147), UINT8_C(147), UINT8_C(147), UINT8_C(147), UINT8_C(147),
+        UINT8_C(147), UINT8_C(147), UINT8_C(147), UINT8_C(147), UINT8_C(147), UINT8_C(147), UINT8_C(147), UINT8_C(147) },
+      { UINT8_C(172), UINT8_C(172), UINT8_C(172), UINT8_C(172), UINT8_C(172), UINT8_C(172), UINT8_C(172), UINT8_C(172),
+        UINT8_C(172), UINT8_C(172), UINT8_C(172), UINT8_C(172), UINT8_C(172), UINT8_C(172), UINT8_C(172), UINT8_C(172) } },
+    { { UINT8_C( 85), UINT8_C(192) },
+      { UINT8_C( 85), UINT8_C( 85), UINT8_C( 85), UINT8_C( 85), UINT8_C( 85), UINT8_C( 85), UINT8_C( 85), UINT8_C( 85),
+        UINT8_C( 85), UINT8_C( 85), UINT8_C( 85), UINT8_C( 85), UINT8_C( 85), UINT8_C( 85), UINT8_C( 85), UINT8_C( 85) },
+      { UINT8_C(192), UINT8_C(192), UINT8_C(192), UINT8_C(192), UINT8_C(192), UINT8_C(192), UINT8_C(192), UINT8_C(192),
+        UINT8_C(192), UINT8_C(192), UINT8_C(192), UINT8_C(192), UINT8_C(192), UINT8_C(192), UINT8_C(192), UINT8_C(192) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x16x2_t r = simde_vld2q_dup_u8(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u8x16(r.val[0], simde_vld1q_u8(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u8x16(r.val[1], simde_vld1q_u8(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_dup_u16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t a[2];
+    uint16_t r0[8];
+    uint16_t r1[8];
+  } test_vec[] = {
+    { { UINT16_C(18440), UINT16_C(40876) },
+      { UINT16_C(18440), UINT16_C(18440), UINT16_C(18440), UINT16_C(18440), UINT16_C(18440), UINT16_C(18440), UINT16_C(18440), UINT16_C(18440) },
+      { UINT16_C(40876), UINT16_C(40876), UINT16_C(40876), UINT16_C(40876), UINT16_C(40876), UINT16_C(40876), UINT16_C(40876), UINT16_C(40876) } },
+    { { UINT16_C(11451), UINT16_C(62754) },
+      { UINT16_C(11451), UINT16_C(11451), UINT16_C(11451), UINT16_C(11451), UINT16_C(11451), UINT16_C(11451), UINT16_C(11451), UINT16_C(11451) },
+      { UINT16_C(62754), UINT16_C(62754), UINT16_C(62754), UINT16_C(62754), UINT16_C(62754), UINT16_C(62754), UINT16_C(62754), UINT16_C(62754) } },
+    { { UINT16_C(22167), UINT16_C(19696) },
+      { UINT16_C(22167), UINT16_C(22167), UINT16_C(22167), UINT16_C(22167), UINT16_C(22167), UINT16_C(22167), UINT16_C(22167), UINT16_C(22167) },
+      { UINT16_C(19696), UINT16_C(19696), UINT16_C(19696), UINT16_C(19696), UINT16_C(19696), UINT16_C(19696), UINT16_C(19696), UINT16_C(19696) } },
+    { { UINT16_C(41649), UINT16_C(25040) },
+      { UINT16_C(41649), UINT16_C(41649), UINT16_C(41649), UINT16_C(41649), UINT16_C(41649), UINT16_C(41649), UINT16_C(41649), UINT16_C(41649) },
+      { UINT16_C(25040), UINT16_C(25040), UINT16_C(25040), UINT16_C(25040), UINT16_C(25040), UINT16_C(25040), UINT16_C(25040), UINT16_C(25040) } },
+    { { UINT16_C(40865), UINT16_C(12818) },
+      { UINT16_C(40865), UINT16_C(40865), UINT16_C(40865), UINT16_C(40865), UINT16_C(40865), UINT16_C(40865), UINT16_C(40865), UINT16_C(40865) },
+      { UINT16_C(12818), UINT16_C(12818), UINT16_C(12818), UINT16_C(12818), UINT16_C(12818), UINT16_C(12818), UINT16_C(12818), UINT16_C(12818) } },
+    { { UINT16_C(58404), UINT16_C(42428) },
+      { UINT16_C(58404), UINT16_C(58404), UINT16_C(58404), UINT16_C(58404), UINT16_C(58404), UINT16_C(58404), UINT16_C(58404), UINT16_C(58404) },
+      { UINT16_C(42428), UINT16_C(42428), UINT16_C(42428), UINT16_C(42428), UINT16_C(42428), UINT16_C(42428), UINT16_C(42428), UINT16_C(42428) } },
+    { { UINT16_C(40923), UINT16_C( 8003) },
+      { UINT16_C(40923), UINT16_C(40923), UINT16_C(40923), UINT16_C(40923), UINT16_C(40923), UINT16_C(40923), UINT16_C(40923), UINT16_C(40923) },
+      { UINT16_C( 8003), UINT16_C( 8003), UINT16_C( 8003), UINT16_C( 8003), UINT16_C( 8003), UINT16_C( 8003), UINT16_C( 8003), UINT16_C( 8003) } },
+    { { UINT16_C(43635), UINT16_C(40597) },
+      { UINT16_C(43635), UINT16_C(43635), UINT16_C(43635), UINT16_C(43635), UINT16_C(43635), UINT16_C(43635), UINT16_C(43635), UINT16_C(43635) },
+      { UINT16_C(40597), UINT16_C(40597), UINT16_C(40597), UINT16_C(40597), UINT16_C(40597), UINT16_C(40597), UINT16_C(40597), UINT16_C(40597) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x8x2_t r = simde_vld2q_dup_u16(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u16x8(r.val[0], simde_vld1q_u16(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u16x8(r.val[1], simde_vld1q_u16(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_dup_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a[2];
+    uint32_t r0[4];
+    uint32_t r1[4];
+  } test_vec[] = {
+    { { UINT32_C(1745975023), UINT32_C(2518814659) },
+      { UINT32_C(1745975023), UINT32_C(1745975023), UINT32_C(1745975023), UINT32_C(1745975023) },
+      { UINT32_C(2518814659), UINT32_C(2518814659), UINT32_C(2518814659), UINT32_C(2518814659) } },
+    { { UINT32_C(1162560193), UINT32_C(3077503412) },
+      { UINT32_C(1162560193), UINT32_C(1162560193), UINT32_C(1162560193), UINT32_C(1162560193) },
+      { UINT32_C(3077503412), UINT32_C(3077503412), UINT32_C(3077503412), UINT32_C(3077503412) } },
+    { { UINT32_C(3258311105), UINT32_C( 611996966) },
+      { UINT32_C(3258311105), UINT32_C(3258311105), UINT32_C(3258311105), UINT32_C(3258311105) },
+      { UINT32_C( 611996966), UINT32_C( 611996966), UINT32_C( 611996966), UINT32_C( 611996966) } },
+    { { UINT32_C(1311984973), UINT32_C(  73343603) },
+      { UINT32_C(1311984973), UINT32_C(1311984973), UINT32_C(1311984973), UINT32_C(1311984973) },
+      { UINT32_C(  73343603), UINT32_C(  73343603), UINT32_C(  73343603), UINT32_C(  73343603) } },
+    { { UINT32_C(3351860407), UINT32_C(2658626583) },
+      { UINT32_C(3351860407), UINT32_C(3351860407), UINT32_C(3351860407), UINT32_C(3351860407) },
+      { UINT32_C(2658626583), UINT32_C(2658626583), UINT32_C(2658626583), UINT32_C(2658626583) } },
+    { { UINT32_C(1141082341), UINT32_C(2176052740) },
+      { UINT32_C(1141082341), UINT32_C(1141082341), UINT32_C(1141082341), UINT32_C(1141082341) },
+      { UINT32_C(2176052740), UINT32_C(2176052740), UINT32_C(2176052740), UINT32_C(2176052740) } },
+    { { UINT32_C( 424108307), UINT32_C(2176931808) },
+      { UINT32_C( 424108307), UINT32_C( 424108307), UINT32_C( 424108307), UINT32_C( 424108307) },
+      { UINT32_C(2176931808), UINT32_C(2176931808), UINT32_C(2176931808), UINT32_C(2176931808) } },
+    { { UINT32_C(1736083468), UINT32_C(3746081785) },
+      { UINT32_C(1736083468), UINT32_C(1736083468), UINT32_C(1736083468), UINT32_C(1736083468) },
+      { UINT32_C(3746081785), UINT32_C(3746081785), UINT32_C(3746081785), UINT32_C(3746081785) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4x2_t r = simde_vld2q_dup_u32(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u32x4(r.val[0], simde_vld1q_u32(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u32x4(r.val[1], simde_vld1q_u32(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_dup_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a[2];
+    uint64_t r0[2];
+    uint64_t r1[2];
+  } test_vec[] = {
+    { { UINT64_C( 2205928517571379551), UINT64_C(10008160462277237138) },
+      { UINT64_C( 2205928517571379551), UINT64_C( 2205928517571379551) },
+      { UINT64_C(10008160462277237138), UINT64_C(10008160462277237138) } },
+    { { UINT64_C(16012956327034457832), UINT64_C( 6647728807630673971) },
+      { UINT64_C(16012956327034457832), UINT64_C(16012956327034457832) },
+      { UINT64_C( 6647728807630673971), UINT64_C( 6647728807630673971) } },
+    { { UINT64_C(10667120287638367055), UINT64_C(15694617230679815198) },
+      { UINT64_C(10667120287638367055), UINT64_C(10667120287638367055) },
+      { UINT64_C(15694617230679815198), UINT64_C(15694617230679815198) } },
+    { { UINT64_C(  412633198796191614), UINT64_C(12201050913280879233) },
+      { UINT64_C(  412633198796191614), UINT64_C(  412633198796191614) },
+      { UINT64_C(12201050913280879233), UINT64_C(12201050913280879233) } },
+    { { UINT64_C( 4162836210918003557), UINT64_C( 8318989795507454377) },
+      { UINT64_C( 4162836210918003557), UINT64_C( 4162836210918003557) },
+      { UINT64_C( 8318989795507454377), UINT64_C( 8318989795507454377) } },
+    { { UINT64_C( 4255303948903308091), UINT64_C( 2761012821338240370) },
+      { UINT64_C( 4255303948903308091), UINT64_C( 4255303948903308091) },
+      { UINT64_C( 2761012821338240370), UINT64_C( 2761012821338240370) } },
+    { { UINT64_C( 2054068149993335833), UINT64_C(15312137380361307091) },
+      { UINT64_C( 2054068149993335833), UINT64_C( 2054068149993335833) },
+      { UINT64_C(15312137380361307091), UINT64_C(15312137380361307091) } },
+    { { UINT64_C( 2051709548914455069), UINT64_C(14132344351424428855) },
+      { UINT64_C( 2051709548914455069), UINT64_C( 2051709548914455069) },
+      { UINT64_C(14132344351424428855), UINT64_C(14132344351424428855) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2x2_t r = simde_vld2q_dup_u64(test_vec[i].a);
+    simde_test_arm_neon_assert_equal_u64x2(r.val[0], simde_vld1q_u64(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u64x2(r.val[1], simde_vld1q_u64(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_lane_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 src0[2];
+    simde_float32 src1[2];
+    simde_float32 a[2];
+    simde_float32 r0[2];
+    simde_float32 r1[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   533.34), SIMDE_FLOAT32_C(   710.77) },
+      { SIMDE_FLOAT32_C(   273.23), SIMDE_FLOAT32_C(   998.97) },
+      { SIMDE_FLOAT32_C(   490.07), SIMDE_FLOAT32_C(  -449.19) },
+      { SIMDE_FLOAT32_C(   533.34), SIMDE_FLOAT32_C(   490.07) },
+      { SIMDE_FLOAT32_C(   273.23), SIMDE_FLOAT32_C(  -449.19) } },
+    { { SIMDE_FLOAT32_C(   177.71), SIMDE_FLOAT32_C(  -849.29) },
+      { SIMDE_FLOAT32_C(  -403.34), SIMDE_FLOAT32_C(   895.42) },
+      { SIMDE_FLOAT32_C(  -293.61), SIMDE_FLOAT32_C(   525.59) },
+      { SIMDE_FLOAT32_C(   177.71), SIMDE_FLOAT32_C(  -293.61) },
+      { SIMDE_FLOAT32_C(  -403.34), SIMDE_FLOAT32_C(   525.59) } },
+    { { SIMDE_FLOAT32_C(  -344.75), SIMDE_FLOAT32_C(   404.19) },
+      { SIMDE_FLOAT32_C(   777.18), SIMDE_FLOAT32_C(  -792.14) },
+      { SIMDE_FLOAT32_C(  -454.65), SIMDE_FLOAT32_C(  -852.28) },
+      { SIMDE_FLOAT32_C(  -344.75), SIMDE_FLOAT32_C(  -454.65) },
+      { SIMDE_FLOAT32_C(   777.18), SIMDE_FLOAT32_C(  -852.28) } },
+    { { SIMDE_FLOAT32_C(   -42.35), SIMDE_FLOAT32_C(  -591.62) },
+      { SIMDE_FLOAT32_C(     6.56), SIMDE_FLOAT32_C(   638.49) },
+      { SIMDE_FLOAT32_C(   720.65), SIMDE_FLOAT32_C(   971.93) },
+      { SIMDE_FLOAT32_C(   -42.35), SIMDE_FLOAT32_C(   720.65) },
+      { SIMDE_FLOAT32_C(     6.56), SIMDE_FLOAT32_C(   971.93) } },
+    { { SIMDE_FLOAT32_C(  -907.46), SIMDE_FLOAT32_C(   656.59) },
+      { SIMDE_FLOAT32_C(   188.73), SIMDE_FLOAT32_C(  -543.42) },
+      { SIMDE_FLOAT32_C(   697.38), SIMDE_FLOAT32_C(   604.73) },
+      { SIMDE_FLOAT32_C(  -907.46), SIMDE_FLOAT32_C(   697.38) },
+      { SIMDE_FLOAT32_C(   188.73), SIMDE_FLOAT32_C(   604.73) } },
+    { { SIMDE_FLOAT32_C(  -455.05), SIMDE_FLOAT32_C(  -925.51) },
+      { SIMDE_FLOAT32_C(   918.33), SIMDE_FLOAT32_C(  -365.27) },
+      { SIMDE_FLOAT32_C(  -553.25), SIMDE_FLOAT32_C(  -742.99) },
+      { SIMDE_FLOAT32_C(  -455.05), SIMDE_FLOAT32_C(  -553.25) },
+      { SIMDE_FLOAT32_C(   918.33), SIMDE_FLOAT32_C(  -742.99) } },
+    { { SIMDE_FLOAT32_C(   825.05), SIMDE_FLOAT32_C(   783.33) },
+      { SIMDE_FLOAT32_C(  -758.71), SIMDE_FLOAT32_C(    56.82) },
+      { SIMDE_FLOAT32_C(  -274.56), SIMDE_FLOAT32_C(  -452.08) },
+      { SIMDE_FLOAT32_C(   825.05), SIMDE_FLOAT32_C(  -274.56) },
+      { SIMDE_FLOAT32_C(  -758.71), SIMDE_FLOAT32_C(  -452.08) } },
+    { { SIMDE_FLOAT32_C(   491.31), SIMDE_FLOAT32_C(  -666.96) },
+      { SIMDE_FLOAT32_C(  -787.93), SIMDE_FLOAT32_C(   726.15) },
+      { SIMDE_FLOAT32_C(   834.54), SIMDE_FLOAT32_C(  -176.10) },
+      { SIMDE_FLOAT32_C(   491.31), SIMDE_FLOAT32_C(   834.54) },
+      { SIMDE_FLOAT32_C(  -787.93), SIMDE_FLOAT32_C(  -176.10) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2x2_t src = { { simde_vld1_f32(test_vec[i].src0),
+                                   simde_vld1_f32(test_vec[i].src1) } };
+
+    simde_float32x2x2_t r = simde_vld2_lane_f32(test_vec[i].a, src, 1);
+    simde_test_arm_neon_assert_equal_f32x2(r.val[0], simde_vld1_f32(test_vec[i].r0), 1);
+    simde_test_arm_neon_assert_equal_f32x2(r.val[1], simde_vld1_f32(test_vec[i].r1), 1);
+
+    simde_float32 a_[2];
+    simde_vst2_lane_f32(a_, r, 1);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_lane_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 src0[1];
+    simde_float64 src1[1];
+    simde_float64 a[2];
+    simde_float64 r0[1];
+    simde_float64 r1[1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   925.83) },
+      { SIMDE_FLOAT64_C(   459.68) },
+      { SIMDE_FLOAT64_C(   793.07), SIMDE_FLOAT64_C(  -322.28) },
+      { SIMDE_FLOAT64_C(   793.07) },
+      { SIMDE_FLOAT64_C(  -322.28) } },
+    { { SIMDE_FLOAT64_C(   567.28) },
+      { SIMDE_FLOAT64_C(   -58.80) },
+      { SIMDE_FLOAT64_C(   566.48), SIMDE_FLOAT64_C(   846.17) },
+      { SIMDE_FLOAT64_C(   566.48) },
+      { SIMDE_FLOAT64_C(   846.17) } },
+    { { SIMDE_FLOAT64_C(  -818.42) },
+      { SIMDE_FLOAT64_C(  -178.06) },
+      { SIMDE_FLOAT64_C(  -355.33), SIMDE_FLOAT64_C(   415.19) },
+      { SIMDE_FLOAT64_C(  -355.33) },
+      { SIMDE_FLOAT64_C(   415.19) } },
+    { { SIMDE_FLOAT64_C(   908.44) },
+      { SIMDE_FLOAT64_C(   950.14) },
+      { SIMDE_FLOAT64_C(   618.36), SIMDE_FLOAT64_C(  -140.90) },
+      { SIMDE_FLOAT64_C(   618.36) },
+      { SIMDE_FLOAT64_C(  -140.90) } },
+    { { SIMDE_FLOAT64_C(  -722.56) },
+      { SIMDE_FLOAT64_C(   933.12) },
+      { SIMDE_FLOAT64_C(  -928.12), SIMDE_FLOAT64_C(    67.12) },
+      { SIMDE_FLOAT64_C(  -928.12) },
+      { SIMDE_FLOAT64_C(    67.12) } },
+    { { SIMDE_FLOAT64_C(   141.80) },
+      { SIMDE_FLOAT64_C(   361.71) },
+      { SIMDE_FLOAT64_C(   960.72), SIMDE_FLOAT64_C(   898.53) },
+      { SIMDE_FLOAT64_C(   960.72) },
+      { SIMDE_FLOAT64_C(   898.53) } },
+    { { SIMDE_FLOAT64_C(   -34.37) },
+      { SIMDE_FLOAT64_C(  -911.32) },
+      { SIMDE_FLOAT64_C(  -533.97), SIMDE_FLOAT64_C(   392.29) },
+      { SIMDE_FLOAT64_C(  -533.97) },
+      { SIMDE_FLOAT64_C(   392.29) } },
+    { { SIMDE_FLOAT64_C(   763.99) },
+      { SIMDE_FLOAT64_C(  -529.28) },
+      { SIMDE_FLOAT64_C(  -455.00), SIMDE_FLOAT64_C(  -828.27) },
+      { SIMDE_FLOAT64_C(  -455.00) },
+      { SIMDE_FLOAT64_C(  -828.27) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1x2_t src = { { simde_vld1_f64(test_vec[i].src0),
+                                   simde_vld1_f64(test_vec[i].src1) } };
+
+    simde_float64x1x2_t r = simde_vld2_lane_f64(test_vec[i].a, src, 0);
+    simde_test_arm_neon_assert_equal_f64x1(r.val[0], simde_vld1_f64(test_vec[i].r0), 1);
+    simde_test_arm_neon_assert_equal_f64x1(r.val[1], simde_vld1_f64(test_vec[i].r1), 1);
+
+    simde_float64 a_[2];
+    simde_vst2_lane_f64(a_, r, 0);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_lane_s8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t src0[8];
+    int8_t src1[8];
+    int8_t a[2];
+    int8_t r0[8];
+    int8_t r1[8];
+  } test_vec[] = {
+    { { -INT8_C(  30), -INT8_C(  64),  INT8_C( 103), -INT8_C(  33), -INT8_C(  57),  INT8_C(  99),  INT8_C(  26), -INT8_C( 112) },
+      { -INT8_C(  60),  INT8_C(  59),  INT8_C(  16), -INT8_C(   8),  INT8_C(  28), -INT8_C(  87),  INT8_C( 121),  INT8_C(  20) },
+      { -INT8_C(  12), -INT8_C(  25) },
+      { -INT8_C(  30), -INT8_C(  64),  INT8_C( 103), -INT8_C(  33), -INT8_C(  12),  INT8_C(  99),  INT8_C(  26), -INT8_C( 112) },
+      { -INT8_C(  60),  INT8_C(  59),  INT8_C(  16), -INT8_C(   8), -INT8_C(  25), -INT8_C(  87),  INT8_C( 121),  INT8_C(  20) } },
+    { { -INT8_C(  97),  INT8_C(  22), -INT8_C( 102),  INT8_C(  10), -INT8_C(  90), -INT8_C(  61), -INT8_C(   6),  INT8_C(  93) },
+      { -INT8_C( 104), -INT8_C( 121),  INT8_C(  50), -INT8_C(  17), -INT8_C(  78), -INT8_C( 117), -INT8_C(  21),  INT8_C(  57) },
+      { -INT8_C( 122), -INT8_C(   9) },
+      { -INT8_C(  97),  INT8_C(  22), -INT8_C( 102),  INT8_C(  10), -INT8_C( 122), -INT8_C(  61), -INT8_C(   6),  INT8_C(  93) },
+      { -INT8_C( 104), -INT8_C( 121),  INT8_C(  50), -INT8_C(  17), -INT8_C(   9), -INT8_C( 117), -INT8_C(  21),  INT8_C(  57) } },
+    { {  INT8_C(  16),  INT8_C(  66),  INT8_C(  34),  INT8_C(  20),  INT8_C(  21), -INT8_C(  30),  INT8_C( 117), -INT8_C( 109) },
+      {  INT8_C(  38),  INT8_C(  91), -INT8_C(  87),  INT8_C(  46),  INT8_C(  89), -INT8_C(  61), -INT8_C( 108), -INT8_C( 106) },
+      { -INT8_C(  63),  INT8_C(  34) },
+      {  INT8_C(  16),  INT8_C(  66),  INT8_C(  34),  INT8_C(  20), -INT8_C(  63), -INT8_C(  30),  INT8_C( 117), -INT8_C( 109) },
+      {  INT8_C(  38),  INT8_C(  91), -INT8_C(  87),  INT8_C(  46),  INT8_C(  34), -INT8_C(  61), -INT8_C( 108), -INT8_C( 106) } },
+    { { -INT8_C(  23),  INT8_C( 111), -INT8_C( 100),  INT8_C(  63),  INT8_C( 116),  INT8_C( 109), -INT8_C(  14),  INT8_C( 127) },
+      {  INT8_C(  26), -INT8_C(  95), -INT8_C(  63), -INT8_C(  80), -INT8_C( 102), -INT8_C(   8), -INT8_C( 121), -INT8_C(  99) },
+      {  INT8_C(  59), -INT8_C(   4) },
+      { -INT8_C(  23),  INT8_C( 111), -INT8_C( 100),  INT8_C(  63),  INT8_C(  59),  INT8_C( 109), -INT8_C(  14),  INT8_C( 127) },
+      {  INT8_C(  26), -INT8_C(  95), -INT8_C(  63), -INT8_C(  80), -INT8_C(   4), -INT8_C(   8), -INT8_C( 121), -INT8_C(  99) } },
+    { {  INT8_C(  89),  INT8_C(  81),  INT8_C(  78), -INT8_C(  61),  INT8_C( 101),  INT8_C(  82), -INT8_C(  69), -INT8_C(  62) },
+      { -INT8_C( 118),  INT8_C(  81), -INT8_C(  69), -INT8_C( 108), -INT8_C(  97),  INT8_C( 107), -INT8_C( 116), -INT8_C(   2) },
+      {  INT8_C(  21),  INT8_C(  12) },
+      {  INT8_C(  89),  INT8_C(  81),  INT8_C(  78), -INT8_C(  61),  INT8_C(  21),  INT8_C(  82), -INT8_C(  69), -INT8_C(  62) },
+      { -INT8_C( 118),  INT8_C(  81), -INT8_C(  69), -INT8_C( 108),  INT8_C(  12),  INT8_C( 107), -INT8_C( 116), -INT8_C(   2) } },
+    { { -INT8_C( 122), -INT8_C( 123),  INT8_C(  50),  INT8_C(  31), -INT8_C(  21), -INT8_C(  54),  INT8_C( 104),  INT8_C(  54) },
+      { -INT8_C(  29), -INT8_C(  67),  INT8_C(  86), -INT8_C(  33),  INT8_C(  65),  INT8_C(  94), -INT8_C(  32), -INT8_C( 106) },
+      {  INT8_C(  72),  INT8_C(  75) },
+      { -INT8_C( 122), -INT8_C( 123),  INT8_C(  50),  INT8_C(  31),  INT8_C(  72), -INT8_C(  54),  INT8_C( 104),  INT8_C(  54) },
+      { -INT8_C(  29), -INT8_C(  67),  INT8_C(  86), -INT8_C(  33),  INT8_C(  75),  INT8_C(  94), -INT8_C(  32), -INT8_C( 106) } },
+    { {  INT8_C(  26),  INT8_C(  14),  INT8_C(  24), -INT8_C(  58), -INT8_C(  18),  INT8_C(  27), -INT8_C(  88),  INT8_C(  86) },
+      {  INT8_C(   6), -INT8_C(  27),  INT8_C(   5), -INT8_C(   1), -INT8_C(  17),  INT8_C(  66),  INT8_C( 124), -INT8_C( 124) },
+      { -INT8_C(  84),  INT8_C(  23) },
+      {  INT8_C(  26),  INT8_C(  14),  INT8_C(  24), -INT8_C(  58), -INT8_C(  84),  INT8_C(  27), -INT8_C(  88),  INT8_C(  86) },
+      {  INT8_C(   6), -INT8_C(  27),  INT8_C(   5), -INT8_C(   1),  INT8_C(  23),  INT8_C(  66),  INT8_C( 124), -INT8_C( 124) } },
+    { {  INT8_C( 106),  INT8_C(   7),  INT8_C(  15), -INT8_C(  89), -INT8_C( 102), -INT8_C(  62),  INT8_C(  17), -INT8_C(  58) },
+      { -INT8_C(  79),  INT8_C( 120), -INT8_C(   1),  INT8_C(  63), -INT8_C(   5),  INT8_C(  88),  INT8_C(  70),  INT8_C(   7) },
+      {  INT8_C( 105), -INT8_C(  84) },
+      {  INT8_C( 106),  INT8_C(   7),  INT8_C(  15), -INT8_C(  89),  INT8_C( 105), -INT8_C(  62),  INT8_C(  17), -INT8_C(  58) },
+      { -INT8_C(  79),  INT8_C( 120), -INT8_C(   1),  INT8_C(  63), -INT8_C(  84),  INT8_C(  88),  INT8_C(  70),  INT8_C(   7) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x8x2_t src = { { simde_vld1_s8(test_vec[i].src0),
+                                simde_vld1_s8(test_vec[i].src1) } };
+
+    simde_int8x8x2_t r = simde_vld2_lane_s8(test_vec[i].a, src, 4);
+    simde_test_arm_neon_assert_equal_i8x8(r.val[0], simde_vld1_s8(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i8x8(r.val[1], simde_vld1_s8(test_vec[i].r1));
+
+    int8_t a_[2];
+    simde_vst2_lane_s8(a_, r, 4);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_lane_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t src0[4];
+    int16_t src1[4];
+    int16_t a[2];
+    int16_t r0[4];
+    int16_t r1[4];
+  } test_vec[] = {
+    { { -INT16_C( 28066),  INT16_C(  3510),  INT16_C( 24694),  INT16_C(  4948) },
+      {  INT16_C( 28666), -INT16_C( 20642), -INT16_C( 22851), -INT16_C(  7531) },
+      { -INT16_C( 27443),  INT16_C(  2505) },
+      { -INT16_C( 28066),  INT16_C(  3510), -INT16_C( 27443),  INT16_C(  4948) },
+      {  INT16_C( 28666), -INT16_C( 20642),  INT16_C(  2505), -INT16_C(  7531) } },
+    { { -INT16_C(  2358),  INT16_C( 10213), -INT16_C( 30680), -INT16_C( 18127) },
+      { -INT16_C( 24590),  INT16_C( 19861),  INT16_C(   703),  INT16_C(  3207) },
+      { -INT16_C( 19060), -INT16_C( 13759) },
+      { -INT16_C(  2358),  INT16_C( 10213), -INT16_C( 19060), -INT16_C( 18127) },
+      { -INT16_C( 24590),  INT16_C( 19861), -INT16_C( 13759),  INT16_C(  3207) } },
+    { {  INT16_C(  6583),  INT16_C(   687), -INT16_C( 19137),  INT16_C( 26544) },
+      {  INT16_C( 10893),  INT16_C(  4424),  INT16_C(  8136), -INT16_C(   878) },
+      { -INT16_C( 27809),  INT16_C( 22582) },
+      {  INT16_C(  6583),  INT16_C(   687), -INT16_C( 27809),  INT16_C( 26544) },
+      {  INT16_C( 10893),  INT16_C(  4424),  INT16_C( 22582), -INT16_C(   878) } },
+    { {  INT16_C( 12099), -INT16_C( 16621),  INT16_C( 27696),  INT16_C( 15018) },
+      {  INT16_C( 32377),  INT16_C( 24057), -INT16_C( 30012),  INT16_C( 28781) },
+      {  INT16_C( 12333),  INT16_C( 16787) },
+      {  INT16_C( 12099), -INT16_C( 16621),  INT16_C( 12333),  INT16_C( 15018) },
+      {  INT16_C( 32377),  INT16_C( 24057),  INT16_C( 16787),  INT16_C( 28781) } },
+    { { -INT16_C( 11850),  INT16_C( 15049), -INT16_C(  5443),  INT16_C(   808) },
+      { -INT16_C(  2634),  INT16_C(  2333), -INT16_C( 29565),  INT16_C(  3454) },
+      {  INT16_C(  8479), -INT16_C(  8138) },
+      { -INT16_C( 11850),  INT16_C( 15049),  INT16_C(  8479),  INT16_C(   808) },
+      { -INT16_C(  2634),  INT16_C(  2333), -INT16_C(  8138),  INT16_C(  3454) } },
+    { { -INT16_C( 24237), -INT16_C(  2474),  INT16_C( 23311), -INT16_C(  8844) },
+      { -INT16_C( 26106),  INT16_C(  2645),  INT16_C(  8042),  INT16_C( 29181) },
+      {  INT16_C(  3508), -INT16_C(  9146) },
+      { -INT16_C( 24237), -INT16_C(  2474),  INT16_C(  3508), -INT16_C(  8844) },
+      { -INT16_C( 26106),  INT16_C(  2645), -INT16_C(  9146),  INT16_C( 29181) } },
+    { { -INT16_C( 30656),  INT16_C( 20481), -INT16_C( 25297),  INT16_C( 24227) },
+      { -INT16_C(   263), -INT16_C( 17600), -INT16_C(  7191), -INT16_C(  9952) },
+      { -INT16_C( 22608), -INT16_C( 16446) },
+      { -INT16_C( 30656),  INT16_C( 20481), -INT16_C( 22608),  INT16_C( 24227) },
+      { -INT16_C(   263), -INT16_C( 17600), -INT16_C( 16446), -INT16_C(  9952) } },
+    { { -INT16_C( 26131), -INT16_C( 13792), -INT16_C( 17591),  INT16_C(  9363) },
+      {  INT16_C( 20570), -INT16_C(  2833), -INT16_C( 23795), -INT16_C(  3142) },
+      {  INT16_C( 16835),  INT16_C( 18375) },
+      { -INT16_C( 26131), -INT16_C( 13792),  INT16_C( 16835),  INT16_C(  9363) },
+      {  INT16_C( 20570), -INT16_C(  2833),  INT16_C( 18375), -INT16_C(  3142) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x4x2_t src = { { simde_vld1_s16(test_vec[i].src0),
+                                 simde_vld1_s16(test_vec[i].src1) } };
+
+    simde_int16x4x2_t r = simde_vld2_lane_s16(test_vec[i].a, src, 2);
+    simde_test_arm_neon_assert_equal_i16x4(r.val[0], simde_vld1_s16(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i16x4(r.val[1], simde_vld1_s16(test_vec[i].r1));
+
+    int16_t a_[2];
+    simde_vst2_lane_s16(a_, r, 2);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_lane_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t src0[2];
+    int32_t src1[2];
+    int32_t a[2];
+    int32_t r0[2];
+    int32_t r1[2];
+  } test_vec[] = {
+    { { -INT32_C( 1657276586),  INT32_C( 1137178667) },
+      {  INT32_C( 1360665487), -INT32_C(  577045955) },
+      {  INT32_C( 1163789818), -INT32_C( 1802902563) },
+      { -INT32_C( 1657276586),  INT32_C( 1163789818) },
+      {  INT32_C( 1360665487), -INT32_C( 1802902563) } },
+    { {  INT32_C( 1639712273), -INT32_C(  991319458) },
+      { -INT32_C(  471292264),  INT32_C(  912919088) },
+      {  INT32_C( 2039318057), -INT32_C(  152921007) },
+      {  INT32_C( 1639712273),  INT32_C( 2039318057) },
+      { -INT32_C(  471292264), -INT32_C(  152921007) } },
+    { { -INT32_C(  368310141), -INT32_C( 1341435196) },
+      {  INT32_C(  562207141),  INT32_C(  908361655) },
+      {  INT32_C( 1411074571), -INT32_C( 1135717924) },
+      { -INT32_C(  368310141),  INT32_C( 1411074571) },
+      {  INT32_C(  562207141), -INT32_C( 1135717924) } },
+    { { -INT32_C( 1497083146),  INT32_C( 1400160385) },
+      { -INT32_C( 1952205573),  INT32_C( 1167864368) },
+      {  INT32_C(  834194336), -INT32_C(   35593358) },
+      { -INT32_C( 1497083146),  INT32_C(  834194336) },
+      { -INT32_C( 1952205573), -INT32_C(   35593358) } },
+    { { -INT32_C( 1172428951), -INT32_C(  827242372) },
+      { -INT32_C( 1205909706),  INT32_C( 1821928590) },
+      { -INT32_C(   27510298), -INT32_C( 1392375213) },
+      { -INT32_C( 1172428951), -INT32_C(   27510298) },
+      { -INT32_C( 1205909706), -INT32_C( 1392375213) } },
+    { { -INT32_C( 1408421125), -INT32_C(  473075133) },
+      { -INT32_C(  985767894),  INT32_C(  612410846) },
+      { -INT32_C( 1277034870), -INT32_C( 1291724965) },
+      { -INT32_C( 1408421125), -INT32_C( 1277034870) },
+      { -INT32_C(  985767894), -INT32_C( 1291724965) } },
+    { { -INT32_C( 1755399470), -INT32_C( 1092952172) },
+      {  INT32_C( 1355466710),  INT32_C( 1837795347) },
+      {  INT32_C( 1477329501), -INT32_C(  409227595) },
+      { -INT32_C( 1755399470),  INT32_C( 1477329501) },
+      {  INT32_C( 1355466710), -INT32_C(  409227595) } },
+    { {  INT32_C(  996372797),  INT32_C( 1568400181) },
+      { -INT32_C(  259373104),  INT32_C( 1315655947) },
+      {  INT32_C( 1813728903),  INT32_C(  487399917) },
+      {  INT32_C(  996372797),  INT32_C( 1813728903) },
+      { -INT32_C(  259373104),  INT32_C(  487399917) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x2x2_t src = { { simde_vld1_s32(test_vec[i].src0),
+                                 simde_vld1_s32(test_vec[i].src1) } };
+
+    simde_int32x2x2_t r = simde_vld2_lane_s32(test_vec[i].a, src, 1);
+    simde_test_arm_neon_assert_equal_i32x2(r.val[0], simde_vld1_s32(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i32x2(r.val[1], simde_vld1_s32(test_vec[i].r1));
+
+    int32_t a_[2];
+    simde_vst2_lane_s32(a_, r, 1);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_lane_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t src0[1];
+    int64_t src1[1];
+    int64_t a[2];
+    int64_t r0[1];
+    int64_t r1[1];
+  } test_vec[] = {
+    { {  INT64_C( 5518280898854071229) },
+      {  INT64_C( 4397745208644437081) },
+      {  INT64_C( 3963813845712577552), -INT64_C( 9010964127056605252) },
+      {  INT64_C( 3963813845712577552) },
+      { -INT64_C( 9010964127056605252) } },
+    { { -INT64_C( 4840565297146532153) },
+      {  INT64_C( 8686534151683935638) },
+      {  INT64_C( 7633725333875551631),  INT64_C( 2066593117111205687) },
+      {  INT64_C( 7633725333875551631) },
+      {  INT64_C( 2066593117111205687) } },
+    { {  INT64_C( 3844916164258098596) },
+      {  INT64_C( 6369638392775770482) },
+      {  INT64_C( 3228852501037385582),  INT64_C( 8277314624747354404) },
+      {  INT64_C( 3228852501037385582) },
+      {  INT64_C( 8277314624747354404) } },
+    { { -INT64_C(  690217264510302938) },
+      {  INT64_C( 8329000137316945808) },
+      {  INT64_C(  368311689599659111), -INT64_C( 4864091836202661060) },
+      {  INT64_C(  368311689599659111) },
+      { -INT64_C( 4864091836202661060) } },
+    { { -INT64_C( 2976670680634426830) },
+      { -INT64_C( 6788658990661458971) },
+      {  INT64_C( 1069338410495292050),  INT64_C( 2670309749583725607) },
+      {  INT64_C( 1069338410495292050) },
+      {  INT64_C( 2670309749583725607) } },
+    { {  INT64_C( 6197855071358561340) },
+      { -INT64_C( 8964263916421360495) },
+      { -INT64_C( 7910701316166894590), -INT64_C(  658492523380956130) },
+      { -INT64_C( 7910701316166894590) },
+      { -INT64_C(  658492523380956130) } },
+    { { -INT64_C( 2142733670672952994) },
+      { -INT64_C( 8887549698220337822) },
+      { -INT64_C( 3504747649192749383),  INT64_C( 8946393114962579557) },
+      { -INT64_C( 3504747649192749383) },
+      {  INT64_C( 8946393114962579557) } },
+    { { -INT64_C( 1748163829488289520) },
+      {  INT64_C(  829439602607840734) },
+      { -INT64_C( 6454358975807152824), -INT64_C( 8614466635782447720) },
+      { -INT64_C( 6454358975807152824) },
+      { -INT64_C( 8614466635782447720) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x1x2_t src = { { simde_vld1_s64(test_vec[i].src0),
+                                 simde_vld1_s64(test_vec[i].src1) } };
+
+    simde_int64x1x2_t r = simde_vld2_lane_s64(test_vec[i].a, src, 0);
+    simde_test_arm_neon_assert_equal_i64x1(r.val[0], simde_vld1_s64(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i64x1(r.val[1], simde_vld1_s64(test_vec[i].r1));
+
+    int64_t a_[2];
+    simde_vst2_lane_s64(a_, r, 0);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_lane_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t src0[8];
+    uint8_t src1[8];
+    uint8_t a[2];
+    uint8_t r0[8];
+    uint8_t r1[8];
+  } test_vec[] = {
+    { { UINT8_C(140), UINT8_C(226), UINT8_C(183), UINT8_C(112), UINT8_C( 46), UINT8_C(136), UINT8_C(250), UINT8_C(249) },
+      { UINT8_C(171), UINT8_C(167), UINT8_C(165), UINT8_C( 54), UINT8_C(183), UINT8_C( 54), UINT8_C( 68), UINT8_C( 73) },
+      { UINT8_C(234), UINT8_C(163) },
+      { UINT8_C(140), UINT8_C(226), UINT8_C(183), UINT8_C(112), UINT8_C(234), UINT8_C(136), UINT8_C(250), UINT8_C(249) },
+      { UINT8_C(171), UINT8_C(167), UINT8_C(165), UINT8_C( 54), UINT8_C(163), UINT8_C( 54), UINT8_C( 68), UINT8_C( 73) } },
+    { { UINT8_C(172), UINT8_C(247), UINT8_C(157), UINT8_C(252), UINT8_C( 72), UINT8_C(241), UINT8_C( 10), UINT8_C( 84) },
+      { UINT8_C(112), UINT8_C(117), UINT8_C(222), UINT8_C(168), UINT8_C(221), UINT8_C(143), UINT8_C(144), UINT8_C(255) },
+      { UINT8_C( 45), UINT8_C( 26) },
+      { UINT8_C(172), UINT8_C(247), UINT8_C(157), UINT8_C(252), UINT8_C( 45), UINT8_C(241), UINT8_C( 10), UINT8_C( 84) },
+      { UINT8_C(112), UINT8_C(117), UINT8_C(222), UINT8_C(168), UINT8_C( 26), UINT8_C(143), UINT8_C(144), UINT8_C(255) } },
+    { { UINT8_C( 63), UINT8_C( 53), UINT8_C(190), UINT8_C(109), UINT8_C( 36), UINT8_C(173), UINT8_C(240), UINT8_C( 29) },
+      { UINT8_C(154), UINT8_C(252), UINT8_C( 92), UINT8_C(163), UINT8_C( 21), UINT8_C(220), UINT8_C( 19), UINT8_C( 33) },
+      { UINT8_C(162), UINT8_C(180) },
+      { UINT8_C( 63), UINT8_C( 53), UINT8_C(190), UINT8_C(109), UINT8_C(162), UINT8_C(173), UINT8_C(240), UINT8_C( 29) },
+      { UINT8_C(154), UINT8_C(252), UINT8_C( 92), UINT8_C(163), UINT8_C(180), UINT8_C(220), UINT8_C( 19), UINT8_C( 33) } },
+    { { UINT8_C(104), UINT8_C( 51), UINT8_C( 97), UINT8_C( 13), UINT8_C(190), UINT8_C(231), UINT8_C( 24), UINT8_C(158) },
+      { UINT8_C(143), UINT8_C( 78), UINT8_C( 65), UINT8_C( 96), UINT8_C(189), UINT8_C( 57), UINT8_C(163), UINT8_C(139) },
+      { UINT8_C( 52), UINT8_C(102) },
+      { UINT8_C(104), UINT8_C( 51), UINT8_C( 97), UINT8_C( 13), UINT8_C( 52), UINT8_C(231), UINT8_C( 24), UINT8_C(158) },
+      { UINT8_C(143), UINT8_C( 78), UINT8_C( 65), UINT8_C( 96), UINT8_C(102), UINT8_C( 57), UINT8_C(163), UINT8_C(139) } },
+    { { UINT8_C( 15), UINT8_C( 63), UINT8_C( 72), UINT8_C(108), UINT8_C(126), UINT8_C(116), UINT8_C( 96), UINT8_C( 75) },
+      { UINT8_C( 69), UINT8_C( 37), UINT8_C(240), UINT8_C( 42), UINT8_C( 67), UINT8_C(238), UINT8_C(126), UINT8_C( 72) },
+      { UINT8_C(154), UINT8_C(176) },
+      { UINT8_C( 15), UINT8_C( 63), UINT8_C( 72), UINT8_C(108), UINT8_C(154), UINT8_C(116), UINT8_C( 96), UINT8_C( 75) },
+      { UINT8_C( 69), UINT8_C( 37), UINT8_C(240), UINT8_C( 42), UINT8_C(176), UINT8_C(238), UINT8_C(126), UINT8_C( 72) } },
+    { { UINT8_C( 41), UINT8_C(150), UINT8_C(191), UINT8_C(220), UINT8_C(142), UINT8_C(131), UINT8_C( 22), UINT8_C(178) },
+      { UINT8_C(175), UINT8_C(127), UINT8_C(196), UINT8_C( 29), UINT8_C( 48), UINT8_C( 73), UINT8_C(155), UINT8_C(  0) },
+      { UINT8_C(240), UINT8_C( 27) },
+      { UINT8_C( 41), UINT8_C(150), UINT8_C(191), UINT8_C(220), UINT8_C(240), UINT8_C(131), UINT8_C( 22), UINT8_C(178) },
+      { UINT8_C(175), UINT8_C(127), UINT8_C(196), UINT8_C( 29), UINT8_C( 27), UINT8_C( 73), UINT8_C(155), UINT8_C(  0) } },
+    { { UINT8_C(198), UINT8_C(112), UINT8_C( 61), UINT8_C(231), UINT8_C(214), UINT8_C(218), UINT8_C( 93), UINT8_C(150) },
+      { UINT8_C( 74), UINT8_C( 55), UINT8_C(253), UINT8_C( 34), UINT8_C(253), UINT8_C( 60), UINT8_C(190), UINT8_C( 47) },
+      { UINT8_C(225), UINT8_C(111) },
+      { UINT8_C(198), UINT8_C(112), UINT8_C( 61), UINT8_C(231), UINT8_C(225), UINT8_C(218), UINT8_C( 93), UINT8_C(150) },
+      { UINT8_C( 74), UINT8_C( 55), UINT8_C(253), UINT8_C( 34), UINT8_C(111), UINT8_C( 60), UINT8_C(190), UINT8_C( 47) } },
+    { { UINT8_C( 14), UINT8_C(217), UINT8_C(204), UINT8_C( 87), UINT8_C( 82), UINT8_C(233), UINT8_C(148), UINT8_C(175) },
+      { UINT8_C(215), UINT8_C(  1), UINT8_C(165), UINT8_C(180), UINT8_C( 59), UINT8_C(180), UINT8_C( 72), UINT8_C(190) },
+      { UINT8_C(101), UINT8_C(130) },
+      { UINT8_C( 14), UINT8_C(217), UINT8_C(204), UINT8_C( 87), UINT8_C(101), UINT8_C(233), UINT8_C(148), UINT8_C(175) },
+      { UINT8_C(215), UINT8_C(  1), UINT8_C(165), UINT8_C(180), UINT8_C(130), UINT8_C(180), UINT8_C( 72), UINT8_C(190) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x8x2_t src = { { simde_vld1_u8(test_vec[i].src0),
+                                 simde_vld1_u8(test_vec[i].src1) } };
+
+    simde_uint8x8x2_t r = simde_vld2_lane_u8(test_vec[i].a, src, 4);
+    simde_test_arm_neon_assert_equal_u8x8(r.val[0], simde_vld1_u8(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u8x8(r.val[1], simde_vld1_u8(test_vec[i].r1));
+
+    uint8_t a_[2];
+    simde_vst2_lane_u8(a_, r, 4);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_lane_u16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t src0[4];
+    uint16_t src1[4];
+    uint16_t a[2];
+    uint16_t r0[4];
+    uint16_t r1[4];
+  } test_vec[] = {
+    { { UINT16_C(10355), UINT16_C(11178), UINT16_C(10170), UINT16_C(65198) },
+      { UINT16_C(23421), UINT16_C(43435), UINT16_C(53200), UINT16_C(17294) },
+      { UINT16_C(39974), UINT16_C(27696) },
+      { UINT16_C(10355), UINT16_C(11178), UINT16_C(39974), UINT16_C(65198) },
+      { UINT16_C(23421), UINT16_C(43435), UINT16_C(27696), UINT16_C(17294) } },
+    { { UINT16_C(50331), UINT16_C(62240), UINT16_C(23497), UINT16_C(54471) },
+      { UINT16_C(50014), UINT16_C(38388), UINT16_C(50449), UINT16_C( 8159) },
+      { UINT16_C(34848), UINT16_C(44616) },
+      { UINT16_C(50331), UINT16_C(62240), UINT16_C(34848), UINT16_C(54471) },
+      { UINT16_C(50014), UINT16_C(38388), UINT16_C(44616), UINT16_C( 8159) } },
+    { { UINT16_C(17729), UINT16_C( 7403), UINT16_C( 9015), UINT16_C(62115) },
+      { UINT16_C(57387), UINT16_C(17855), UINT16_C( 8626), UINT16_C(53591) },
+      { UINT16_C(47341), UINT16_C(27730) },
+      { UINT16_C(17729), UINT16_C( 7403), UINT16_C(47341), UINT16_C(62115) },
+      { UINT16_C(57387), UINT16_C(17855), UINT16_C(27730), UINT16_C(53591) } },
+    { { UINT16_C( 7541), UINT16_C(18379), UINT16_C( 2820), UINT16_C( 1354) },
+      { UINT16_C(28022), UINT16_C(64496), UINT16_C( 2479), UINT16_C( 6487) },
+      { UINT16_C(  978), UINT16_C(48038) },
+      { UINT16_C( 7541), UINT16_C(18379), UINT16_C(  978), UINT16_C( 1354) },
+      { UINT16_C(28022), UINT16_C(64496), UINT16_C(48038), UINT16_C( 6487) } },
+    { { UINT16_C( 4159), UINT16_C( 5186), UINT16_C(10217), UINT16_C(60539) },
+      { UINT16_C(62114), UINT16_C( 4868), UINT16_C(54316), UINT16_C(  654) },
+      { UINT16_C(23044), UINT16_C(11675) },
+      { UINT16_C( 4159), UINT16_C( 5186), UINT16_C(23044), UINT16_C(60539) },
+      { UINT16_C(62114), UINT16_C( 4868), UINT16_C(11675), UINT16_C(  654) } },
+    { { UINT16_C(42421), UINT16_C(38147), UINT16_C(29439), UINT16_C(30759) },
+      { UINT16_C(30233), UINT16_C(11721), UINT16_C(11957), UINT16_C(46350) },
+      { UINT16_C(20610), UINT16_C(65437) },
+      { UINT16_C(42421), UINT16_C(38147), UINT16_C(20610), UINT16_C(30759) },
+      { UINT16_C(30233), UINT16_C(11721), UINT16_C(65437), UINT16_C(46350) } },
+    { { UINT16_C(39508), UINT16_C(56625), UINT16_C( 2558), UINT16_C(41445) },
+      { UINT16_C( 1536), UINT16_C(46792), UINT16_C(50939), UINT16_C(61242) },
+      { UINT16_C(21929), UINT16_C( 6720) },
+      { UINT16_C(39508), UINT16_C(56625), UINT16_C(21929), UINT16_C(41445) },
+      { UINT16_C( 1536), UINT16_C(46792), UINT16_C( 6720), UINT16_C(61242) } },
+    { { UINT16_C(21912), UINT16_C(43610), UINT16_C(60049), UINT16_C(28498) },
+      { UINT16_C(36372), UINT16_C(26231), UINT16_C(43654), UINT16_C(62785) },
+      { UINT16_C(35150), UINT16_C(35352) },
+      { UINT16_C(21912), UINT16_C(43610), UINT16_C(35150), UINT16_C(28498) },
+      { UINT16_C(36372), UINT16_C(26231), UINT16_C(35352), UINT16_C(62785) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x4x2_t src = { { simde_vld1_u16(test_vec[i].src0),
+                                  simde_vld1_u16(test_vec[i].src1) } };
+
+    simde_uint16x4x2_t r = simde_vld2_lane_u16(test_vec[i].a, src, 2);
+    simde_test_arm_neon_assert_equal_u16x4(r.val[0], simde_vld1_u16(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u16x4(r.val[1], simde_vld1_u16(test_vec[i].r1));
+
+    uint16_t a_[2];
+    simde_vst2_lane_u16(a_, r, 2);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_lane_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t src0[2];
+    uint32_t src1[2];
+    uint32_t a[2];
+    uint32_t r0[2];
+    uint32_t r1[2];
+  } test_vec[] = {
+    { { UINT32_C(3676590322), UINT32_C(  76196697) },
+      { UINT32_C(3985378140), UINT32_C( 864488855) },
+      { UINT32_C( 569664986), UINT32_C(2889574865) },
+      { UINT32_C(3676590322), UINT32_C( 569664986) },
+      { UINT32_C(3985378140), UINT32_C(2889574865) } },
+    { { UINT32_C(4284155508), UINT32_C(3227452920) },
+      { UINT32_C(3382670150), UINT32_C(1878891621) },
+      { UINT32_C( 101496825), UINT32_C(4152856719) },
+      { UINT32_C(4284155508), UINT32_C( 101496825) },
+      { UINT32_C(3382670150), UINT32_C(4152856719) } },
+    { { UINT32_C( 293170291), UINT32_C( 379555803) },
+      { UINT32_C(1876826158), UINT32_C(3980276882) },
+      { UINT32_C(1971503545), UINT32_C(4228158805) },
+      { UINT32_C( 293170291), UINT32_C(1971503545) },
+      { UINT32_C(1876826158), UINT32_C(4228158805) } },
+    { { UINT32_C(3656876781), UINT32_C(2222842916) },
+      { UINT32_C(2842342767), UINT32_C(3462724427) },
+      { UINT32_C(1102624832), UINT32_C(1225811323) },
+      { UINT32_C(3656876781), UINT32_C(1102624832) },
+      { UINT32_C(2842342767), UINT32_C(1225811323) } },
+    { { UINT32_C(3282248374), UINT32_C(1310964417) },
+      { UINT32_C(2974197554), UINT32_C(2442576316) },
+      { UINT32_C(2506504888), UINT32_C(2021784523) },
+      { UINT32_C(3282248374), UINT32_C(2506504888) },
+      { UINT32_C(2974197554), UINT32_C(2021784523) } },
+    { { UINT32_C( 904453831), UINT32_C(1623758115) },
+      { UINT32_C( 375777200), UINT32_C(  91677234) },
+      { UINT32_C( 668964384), UINT32_C( 199240162) },
+      { UINT32_C( 904453831), UINT32_C( 668964384) },
+      { UINT32_C( 375777200), UINT32_C( 199240162) } },
+    { { UINT32_C(3366046641), UINT32_C( 746904002) },
+      { UINT32_C(3582108001), UINT32_C( 514108859) },
+      { UINT32_C(  52593531), UINT32_C( 114370893) },
+      { UINT32_C(3366046641), UINT32_C(  52593531) },
+      { UINT32_C(3582108001), UINT32_C( 114370893) } },
+    { { UINT32_C(1359488556), UINT32_C(1966240225) },
+      { UINT32_C( 878120715), UINT32_C( 357432406) },
+      { UINT32_C(1063094162), UINT32_C(1650060194) },
+      { UINT32_C(1359488556), UINT32_C(1063094162) },
+      { UINT32_C( 878120715), UINT32_C(1650060194) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x2x2_t src = { { simde_vld1_u32(test_vec[i].src0),
+                                  simde_vld1_u32(test_vec[i].src1) } };
+
+    simde_uint32x2x2_t r = simde_vld2_lane_u32(test_vec[i].a, src, 1);
+    simde_test_arm_neon_assert_equal_u32x2(r.val[0], simde_vld1_u32(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u32x2(r.val[1], simde_vld1_u32(test_vec[i].r1));
+
+    uint32_t a_[2];
+    simde_vst2_lane_u32(a_, r, 1);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2_lane_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t src0[1];
+    uint64_t src1[1];
+    uint64_t a[2];
+    uint64_t r0[1];
+    uint64_t r1[1];
+  } test_vec[] = {
+    { { UINT64_C(10186794537406055106) },
+      { UINT64_C(18310551745706727531) },
+      { UINT64_C( 8022374352921031641), UINT64_C(16101851489489723412) },
+      { UINT64_C( 8022374352921031641) },
+      { UINT64_C(16101851489489723412) } },
+    { { UINT64_C( 4636890541465338410) },
+      { UINT64_C( 1612076295513320805) },
+      { UINT64_C( 4300869233326624773), UINT64_C(17769040778420296573) },
+      { UINT64_C( 4300869233326624773) },
+      { UINT64_C(17769040778420296573) } },
+    { { UINT64_C(11594472556879790231) },
+      { UINT64_C(16483258414540526443) },
+      { UINT64_C( 6665040404622500872), UINT64_C(  181140108007609623) },
+      { UINT64_C( 6665040404622500872) },
+      { UINT64_C(  181140108007609623) } },
+    { { UINT64_C( 8931640769850450313) },
+      { UINT64_C( 6102712898107408743) },
+      { UINT64_C(14140272733238422470), UINT64_C( 6583965810187247198) },
+      { UINT64_C(14140272733238422470) },
+      { UINT64_C( 6583965810187247198) } },
+    { { UINT64_C(10660525637093337013) },
+      { UINT64_C( 1115793639273481594) },
+      { UINT64_C(15998028985049184968), UINT64_C( 3543494423806964982) },
+      { UINT64_C(15998028985049184968) },
+      { UINT64_C( 3543494423806964982) } },
+    { { UINT64_C(12603659206368007261) },
+      { UINT64_C(15129587072252390830) },
+      { UINT64_C(  829575858982156533), UINT64_C(17366761260488864528) },
+      { UINT64_C(  829575858982156533) },
+      { UINT64_C(17366761260488864528) } },
+    { { UINT64_C( 9190750849756107044) },
+      { UINT64_C( 2895393386280066126) },
+      { UINT64_C( 4694085703828685517), UINT64_C( 4084600473831962827) },
+      { UINT64_C( 4694085703828685517) },
+      { UINT64_C( 4084600473831962827) } },
+    { { UINT64_C( 4554953653078621556) },
+      { UINT64_C( 3508128354145954113) },
+      { UINT64_C( 8879644675399716014), UINT64_C(  142395261315262042) },
+      { UINT64_C( 8879644675399716014) },
+      { UINT64_C(  142395261315262042) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x1x2_t src = { { simde_vld1_u64(test_vec[i].src0),
+                                  simde_vld1_u64(test_vec[i].src1) } };
+
+    simde_uint64x1x2_t r = simde_vld2_lane_u64(test_vec[i].a, src, 0);
+    simde_test_arm_neon_assert_equal_u64x1(r.val[0], simde_vld1_u64(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u64x1(r.val[1], simde_vld1_u64(test_vec[i].r1));
+
+    uint64_t a_[2];
+    simde_vst2_lane_u64(a_, r, 0);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_lane_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 src0[4];
+    simde_float32 src1[4];
+    simde_float32 a[2];
+    simde_float32 r0[4];
+    simde_float32 r1[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   882.04), SIMDE_FLOAT32_C(   393.86), SIMDE_FLOAT32_C(  -595.92), SIMDE_FLOAT32_C(   492.53) },
+      { SIMDE_FLOAT32_C(    30.71), SIMDE_FLOAT32_C(  -117.32), SIMDE_FLOAT32_C(  -982.67), SIMDE_FLOAT32_C(  -917.78) },
+      { SIMDE_FLOAT32_C(   456.24), SIMDE_FLOAT32_C(    72.10) },
+      { SIMDE_FLOAT32_C(   882.04), SIMDE_FLOAT32_C(   393.86), SIMDE_FLOAT32_C(   456.24), SIMDE_FLOAT32_C(   492.53) },
+      { SIMDE_FLOAT32_C(    30.71), SIMDE_FLOAT32_C(  -117.32), SIMDE_FLOAT32_C(    72.10), SIMDE_FLOAT32_C(  -917.78) } },
+    { { SIMDE_FLOAT32_C(  -148.95), SIMDE_FLOAT32_C(  -413.64), SIMDE_FLOAT32_C(   276.78), SIMDE_FLOAT32_C(  -444.95) },
+      { SIMDE_FLOAT32_C(  -685.56), SIMDE_FLOAT32_C(   163.70), SIMDE_FLOAT32_C(  -292.28), SIMDE_FLOAT32_C(   334.52) },
+      { SIMDE_FLOAT32_C(   199.89), SIMDE_FLOAT32_C(  -152.80) },
+      { SIMDE_FLOAT32_C(  -148.95), SIMDE_FLOAT32_C(  -413.64), SIMDE_FLOAT32_C(   199.89), SIMDE_FLOAT32_C(  -444.95) },
+      { SIMDE_FLOAT32_C(  -685.56), SIMDE_FLOAT32_C(   163.70), SIMDE_FLOAT32_C(  -152.80), SIMDE_FLOAT32_C(   334.52) } },
+    { { SIMDE_FLOAT32_C(  -338.37), SIMDE_FLOAT32_C(  -483.87), SIMDE_FLOAT32_C(  -455.88), SIMDE_FLOAT32_C(  -544.28) },
+      { SIMDE_FLOAT32_C(  -256.75), SIMDE_FLOAT32_C(   682.61), SIMDE_FLOAT32_C(   160.27), SIMDE_FLOAT32_C(   921.49) },
+      { SIMDE_FLOAT32_C(  -749.92), SIMDE_FLOAT32_C(   801.55) },
+      { SIMDE_FLOAT32_C(  -338.37), SIMDE_FLOAT32_C(  -483.87), SIMDE_FLOAT32_C(  -749.92), SIMDE_FLOAT32_C(  -544.28) },
+      { SIMDE_FLOAT32_C(  -256.75), SIMDE_FLOAT32_C(   682.61), SIMDE_FLOAT32_C(   801.55), SIMDE_FLOAT32_C(   921.49) } },
+    { { SIMDE_FLOAT32_C(   805.73), SIMDE_FLOAT32_C(   612.26), SIMDE_FLOAT32_C(   646.89), SIMDE_FLOAT32_C(  -983.96) },
+      { SIMDE_FLOAT32_C(  -307.14), SIMDE_FLOAT32_C(  -644.81), SIMDE_FLOAT32_C(    -0.94), SIMDE_FLOAT32_C(   771.26) },
+      { SIMDE_FLOAT32_C(   750.72), SIMDE_FLOAT32_C(  -177.46) },
+      { SIMDE_FLOAT32_C(   805.73), SIMDE_FLOAT32_C(   612.26), SIMDE_FLOAT32_C(   750.72), SIMDE_FLOAT32_C(  -983.96) },
+      { SIMDE_FLOAT32_C(  -307.14), SIMDE_FLOAT32_C(  -644.81), SIMDE_FLOAT32_C(  -177.46), SIMDE_FLOAT32_C(   771.26) } },
+    { { SIMDE_FLOAT32_C(   858.41), SIMDE_FLOAT32_C(  -591.19), SIMDE_FLOAT32_C(   382.23), SIMDE_FLOAT32_C(   -45.58) },
+      { SIMDE_FLOAT32_C(   719.51), SIMDE_FLOAT32_C(   785.85), SIMDE_FLOAT32_C(  -321.61), SIMDE_FLOAT32_C(  -541.18) },
+      { SIMDE_FLOAT32_C(   199.84), SIMDE_FLOAT32_C(   176.32) },
+      { SIMDE_FLOAT32_C(   858.41), SIMDE_FLOAT32_C(  -591.19), SIMDE_FLOAT32_C(   199.84), SIMDE_FLOAT32_C(   -45.58) },
+      { SIMDE_FLOAT32_C(   719.51), SIMDE_FLOAT32_C(   785.85), SIMDE_FLOAT32_C(   176.32), SIMDE_FLOAT32_C(  -541.18) } },
+    { { SIMDE_FLOAT32_C(   184.16), SIMDE_FLOAT32_C(   728.45), SIMDE_FLOAT32_C(  -800.25), SIMDE_FLOAT32_C(   538.12) },
+      { SIMDE_FLOAT32_C(   279.54), SIMDE_FLOAT32_C(    34.51), SIMDE_FLOAT32_C(   795.02), SIMDE_FLOAT32_C(  -464.68) },
+      { SIMDE_FLOAT32_C(   264.98), SIMDE_FLOAT32_C(   375.49) },
+      { SIMDE_FLOAT32_C(   184.16), SIMDE_FLOAT32_C(   728.45), SIMDE_FLOAT32_C(   264.98), SIMDE_FLOAT32_C(   538.12) },
+      { SIMDE_FLOAT32_C(   279.54), SIMDE_FLOAT32_C(    34.51), SIMDE_FLOAT32_C(   375.49), SIMDE_FLOAT32_C(  -464.68) } },
+    { { SIMDE_FLOAT32_C(   974.24), SIMDE_FLOAT32_C(   527.23), SIMDE_FLOAT32_C(    74.81), SIMDE_FLOAT32_C(   238.98) },
+      { SIMDE_FLOAT32_C(   924.49), SIMDE_FLOAT32_C(  -145.22), SIMDE_FLOAT32_C(  -666.58), SIMDE_FLOAT32_C(  -832.63) },
+      { SIMDE_FLOAT32_C(  -567.27), SIMDE_FLOAT32_C(  -611.98) },
+      { SIMDE_FLOAT32_C(   974.24), SIMDE_FLOAT32_C(   527.23), SIMDE_FLOAT32_C(  -567.27), SIMDE_FLOAT32_C(   238.98) },
+      { SIMDE_FLOAT32_C(   924.49), SIMDE_FLOAT32_C(  -145.22), SIMDE_FLOAT32_C(  -611.98), SIMDE_FLOAT32_C(  -832.63) } },
+    { { SIMDE_FLOAT32_C(   -53.26), SIMDE_FLOAT32_C(   856.91), SIMDE_FLOAT32_C(   198.49), SIMDE_FLOAT32_C(   892.51) },
+      { SIMDE_FLOAT32_C(  -673.71), SIMDE_FLOAT32_C(   951.25), SIMDE_FLOAT32_C(  -636.41), SIMDE_FLOAT32_C(  -943.64) },
+      { SIMDE_FLOAT32_C(   507.90), SIMDE_FLOAT32_C(  -299.28) },
+      { SIMDE_FLOAT32_C(   -53.26), SIMDE_FLOAT32_C(   856.91), SIMDE_FLOAT32_C(   507.90), SIMDE_FLOAT32_C(   892.51) },
+      { SIMDE_FLOAT32_C(  -673.71), SIMDE_FLOAT32_C(   951.25), SIMDE_FLOAT32_C(  -299.28), SIMDE_FLOAT32_C(  -943.64) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4x2_t src = { { simde_vld1q_f32(test_vec[i].src0),
+                                   simde_vld1q_f32(test_vec[i].src1) } };
+
+    simde_float32x4x2_t r = simde_vld2q_lane_f32(test_vec[i].a, src, 2);
+    simde_test_arm_neon_assert_equal_f32x4(r.val[0], simde_vld1q_f32(test_vec[i].r0), 1);
+    simde_test_arm_neon_assert_equal_f32x4(r.val[1], simde_vld1q_f32(test_vec[i].r1), 1);
+
+    simde_float32 a_[2];
+    simde_vst2q_lane_f32(a_, r, 2);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_lane_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 src0[2];
+    simde_float64 src1[2];
+    simde_float64 a[2];
+    simde_float64 r0[2];
+    simde_float64 r1[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -813.91), SIMDE_FLOAT64_C(   140.28) },
+      { SIMDE_FLOAT64_C(   -61.76), SIMDE_FLOAT64_C(   619.28) },
+      { SIMDE_FLOAT64_C(  -838.27), SIMDE_FLOAT64_C(  -710.87) },
+      { SIMDE_FLOAT64_C(  -813.91), SIMDE_FLOAT64_C(  -838.27) },
+      { SIMDE_FLOAT64_C(   -61.76), SIMDE_FLOAT64_C(  -710.87) } },
+    { { SIMDE_FLOAT64_C(  -415.72), SIMDE_FLOAT64_C(   412.07) },
+      { SIMDE_FLOAT64_C(   -32.77), SIMDE_FLOAT64_C(   611.09) },
+      { SIMDE_FLOAT64_C(  -421.54), SIMDE_FLOAT64_C(     8.87) },
+      { SIMDE_FLOAT64_C(  -415.72), SIMDE_FLOAT64_C(  -421.54) },
+      { SIMDE_FLOAT64_C(   -32.77), SIMDE_FLOAT64_C(     8.87) } },
+    { { SIMDE_FLOAT64_C(   849.80), SIMDE_FLOAT64_C(  -140.66) },
+      { SIMDE_FLOAT64_C(  -112.80), SIMDE_FLOAT64_C(  -538.71) },
+      { SIMDE_FLOAT64_C(    61.20), SIMDE_FLOAT64_C(   266.09) },
+      { SIMDE_FLOAT64_C(   849.80), SIMDE_FLOAT64_C(    61.20) },
+      { SIMDE_FLOAT64_C(  -112.80), SIMDE_FLOAT64_C(   266.09) } },
+    { { SIMDE_FLOAT64_C(   840.25), SIMDE_FLOAT64_C(   276.52) },
+      { SIMDE_FLOAT64_C(  -159.38), SIMDE_FLOAT64_C(   138.12) },
+      { SIMDE_FLOAT64_C(  -339.10), SIMDE_FLOAT64_C(   529.46) },
+      { SIMDE_FLOAT64_C(   840.25), SIMDE_FLOAT64_C(  -339.10) },
+      { SIMDE_FLOAT64_C(  -159.38), SIMDE_FLOAT64_C(   529.46) } },
+    { { SIMDE_FLOAT64_C(  -111.09), SIMDE_FLOAT64_C(   897.39) },
+      { SIMDE_FLOAT64_C(  -707.32), SIMDE_FLOAT64_C(  -754.48) },
+      { SIMDE_FLOAT64_C(   -30.97), SIMDE_FLOAT64_C(  -169.11) },
+      { SIMDE_FLOAT64_C(  -111.09), SIMDE_FLOAT64_C(   -30.97) },
+      { SIMDE_FLOAT64_C(  -707.32), SIMDE_FLOAT64_C(  -169.11) } },
+    { { SIMDE_FLOAT64_C(   981.29), SIMDE_FLOAT64_C(   752.95) },
+      { SIMDE_FLOAT64_C(  -603.49), SIMDE_FLOAT64_C(  -929.27) },
+      { SIMDE_FLOAT64_C(  -843.56), SIMDE_FLOAT64_C(  -281.55) },
+      { SIMDE_FLOAT64_C(   981.29), SIMDE_FLOAT64_C(  -843.56) },
+      { SIMDE_FLOAT64_C(  -603.49), SIMDE_FLOAT64_C(  -281.55) } },
+    { { SIMDE_FLOAT64_C(   737.84), SIMDE_FLOAT64_C(   211.97) },
+      { SIMDE_FLOAT64_C(  -932.86), SIMDE_FLOAT64_C(   -30.65) },
+      { SIMDE_FLOAT64_C(  -102.02), SIMDE_FLOAT64_C(  -684.26) },
+      { SIMDE_FLOAT64_C(   737.84), SIMDE_FLOAT64_C(  -102.02) },
+      { SIMDE_FLOAT64_C(  -932.86), SIMDE_FLOAT64_C(  -684.26) } },
+    { { SIMDE_FLOAT64_C(   389.08), SIMDE_FLOAT64_C(    99.66) },
+      { SIMDE_FLOAT64_C(  -821.26), SIMDE_FLOAT64_C(    -7.42) },
+      { SIMDE_FLOAT64_C(  -687.07), SIMDE_FLOAT64_C(   -85.44) },
+      { SIMDE_FLOAT64_C(   389.08), SIMDE_FLOAT64_C(  -687.07) },
+      { SIMDE_FLOAT64_C(  -821.26), SIMDE_FLOAT64_C(   -85.44) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2x2_t src = { { simde_vld1q_f64(test_vec[i].src0),
+                                   simde_vld1q_f64(test_vec[i].src1) } };
+
+    simde_float64x2x2_t r = simde_vld2q_lane_f64(test_vec[i].a, src, 1);
+    simde_test_arm_neon_assert_equal_f64x2(r.val[0], simde_vld1q_f64(test_vec[i].r0), 1);
+    simde_test_arm_neon_assert_equal_f64x2(r.val[1], simde_vld1q_f64(test_vec[i].r1), 1);
+
+    simde_float64 a_[2];
+    simde_vst2q_lane_f64(a_, r, 1);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_lane_s8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t src0[16];
+    int8_t src1[16];
+    int8_t a[2];
+    int8_t r0[16];
+    int8_t r1[16];
+  } test_vec[] = {
+    { {  INT8_C(  67), -INT8_C( 127), -INT8_C(  22), -INT8_C( 120),  INT8_C(  80),  INT8_C(  92), -INT8_C(  87),  INT8_C(  33),
+        -INT8_C(  62), -INT8_C(  73), -INT8_C(   4),  INT8_C(  75), -INT8_C(  27),  INT8_C( 101),  INT8_C(  72), -INT8_C( 114) },
+      {  INT8_C(  60), -INT8_C(  81), -INT8_C( 124),  INT8_C(  45),  INT8_C(  68),  INT8_C(  71),  INT8_C(  96), -INT8_C(  59),
+        -INT8_C(  71), -INT8_C(   4), -INT8_C(  10), -INT8_C(  42), -INT8_C(  29),  INT8_C( 107),  INT8_C(  86), -INT8_C(   2) },
+      {  INT8_C(  20), -INT8_C(  63) },
+      {  INT8_C(  67), -INT8_C( 127), -INT8_C(  22), -INT8_C( 120),  INT8_C(  80),  INT8_C(  92), -INT8_C(  87),  INT8_C(  33),
+         INT8_C(  20), -INT8_C(  73), -INT8_C(   4),  INT8_C(  75), -INT8_C(  27),  INT8_C( 101),  INT8_C(  72), -INT8_C( 114) },
+      {  INT8_C(  60), -INT8_C(  81), -INT8_C( 124),  INT8_C(  45),  INT8_C(  68),  INT8_C(  71),  INT8_C(  96), -INT8_C(  59),
+        -INT8_C(  63), -INT8_C(   4), -INT8_C(  10), -INT8_C(  42), -INT8_C(  29),  INT8_C( 107),  INT8_C(  86), -INT8_C(   2) } },
+    { {  INT8_C(  35),  INT8_C(  81),  INT8_C( 105),  INT8_C(  82),  INT8_C( 107), -INT8_C( 123),  INT8_C(  44), -INT8_C( 103),
+        -INT8_C( 119),  INT8_C(  88), -INT8_C(  33),  INT8_C( 107),  INT8_C( 121),  INT8_C( 105), -INT8_C(   6), -INT8_C( 105) },
+      { -INT8_C( 120),  INT8_C(  49),  INT8_C(  44),  INT8_C(  89),  INT8_C(  14),  INT8_C(  74),  INT8_C(  59), -INT8_C( 118),
+         INT8_C(  15),  INT8_C(  16), -INT8_C(  55),  INT8_C(   6), -INT8_C(  31), -INT8_C(  43), -INT8_C(  94),  INT8_C(  90) },
+      { -INT8_C(  21), -INT8_C( 127) },
+      {  INT8_C(  35),  INT8_C(  81),  INT8_C( 105),  INT8_C(  82),  INT8_C( 107), -INT8_C( 123),  INT8_C(  44), -INT8_C( 103),
+        -INT8_C(  21),  INT8_C(  88), -INT8_C(  33),  INT8_C( 107),  INT8_C( 121),  INT8_C( 105), -INT8_C(   6), -INT8_C( 105) },
+      { -INT8_C( 120),  INT8_C(  49),  INT8_C(  44),  INT8_C(  89),  INT8_C(  14),  INT8_C(  74),  INT8_C(  59), -INT8_C( 118),
+        -INT8_C( 127),  INT8_C(  16), -INT8_C(  55),  INT8_C(   6), -INT8_C(  31), -INT8_C(  43), -INT8_C(  94),  INT8_C(  90) } },
+    { {  INT8_C(   3), -INT8_C( 115), -INT8_C(  94),  INT8_C(  59), -INT8_C( 114), -INT8_C(  31),  INT8_C(  34),  INT8_C( 126),
+         INT8_C(  36), -INT8_C( 126),  INT8_C(  70), -INT8_C(  88), -INT8_C(   8),  INT8_C( 101), -INT8_C( 105),  INT8_C(   4) },
+      {  INT8_C(   6),  INT8_C( 115), -INT8_C(  52),  INT8_C(  87),  INT8_C( 104),  INT8_C(  45), -INT8_C(  72),  INT8_C(  24),
+         INT8_C(  80),  INT8_C(   3),  INT8_C(  37),  INT8_C(  82), -INT8_C(  52), -INT8_C(  47),  INT8_C(  25), -INT8_C(  92) },
+      { -INT8_C( 110), -INT8_C(  74) },
+      {  INT8_C(   3), -INT8_C( 115), -INT8_C(  94),  INT8_C(  59), -INT8_C( 114), -INT8_C(  31),  INT8_C(  34),  INT8_C( 126),
+        -INT8_C( 110), -INT8_C( 126),  INT8_C(  70), -INT8_C(  88), -INT8_C(   8),  INT8_C( 101), -INT8_C( 105),  INT8_C(   4) },
+      {  INT8_C(   6),  INT8_C( 115), -INT8_C(  52),  INT8_C(  87),  INT8_C( 104),  INT8_C(  45), -INT8_C(  72),  INT8_C(  24),
+        -INT8_C(  74),  INT8_C(   3),  INT8_C(  37),  INT8_C(  82), -INT8_C(  52), -INT8_C(  47),  INT8_C(  25), -INT8_C(  92) } },
+    { { -INT8_C(  58), -INT8_C( 107),  INT8_C(  53), -INT8_C(  88), -INT8_C( 117), -INT8_C(  87),  INT8_C(  15),  INT8_C(  21),
+         INT8_C( 104), -INT8_C( 124),  INT8_C( 119),  INT8_C(  63),  INT8_C(  70), -INT8_C(  98),  INT8_C(  84),  INT8_C(  55) },
+      { -INT8_C(  47), -INT8_C(  54), -INT8_C(  36), -INT8_C(  77), -INT8_C(  61), -INT8_C(  60), -INT8_C( 111), -INT8_C( 125),
+        -INT8_C( 106),  INT8_C(  23), -INT8_C( 113), -INT8_C( 101), -INT8_C(  72),  INT8_C(  93), -INT8_C(  43),  INT8_C(  44) },
+      { -INT8_C(  31),  INT8_C(  25) },
+      { -INT8_C(  58), -INT8_C( 107),  INT8_C(  53), -INT8_C(  88), -INT8_C( 117), -INT8_C(  87),  INT8_C(  15),  INT8_C(  21),
+        -INT8_C(  31), -INT8_C( 124),  INT8_C( 119),  INT8_C(  63),  INT8_C(  70), -INT8_C(  98),  INT8_C(  84),  INT8_C(  55) },
+      { -INT8_C(  47), -INT8_C(  54), -INT8_C(  36), -INT8_C(  77), -INT8_C(  61), -INT8_C(  60), -INT8_C( 111), -INT8_C( 125),
+         INT8_C(  25),  INT8_C(  23), -INT8_C( 113), -INT8_C( 101), -INT8_C(  72),  INT8_C(  93), -INT8_C(  43),  INT8_C(  44) } },
+    { { -INT8_C(   4),  INT8_C(  87),  INT8_C(  86),  INT8_C( 118), -INT8_C(  34),  INT8_C(  29), -INT8_C(   8), -INT8_C(  11),
+         INT8_C(  78), -INT8_C(  36), -INT8_C(  13),  INT8_C(  49),  INT8_C(  58),  INT8_C(  92),  INT8_C( 121), -INT8_C(  91) },
+      {  INT8_C( 102),  INT8_C(  15), -INT8_C(  56),  INT8_C(  59),  INT8_C(  88), -INT8_C(  15),  INT8_C( 110),  INT8_C(   0),
+        -INT8_C(  68), -INT8_C( 126), -INT8_C(  90),  INT8_C(  44),  INT8_C(  59), -INT8_C(  11),  INT8_C(  42), -INT8_C(  89) },
+      { -INT8_C(  75), -INT8_C(  77) },
+      { -INT8_C(   4),  INT8_C(  87),  INT8_C(  86),  INT8_C( 118), -INT8_C(  34),  INT8_C(  29), -INT8_C(   8), -INT8_C(  11),
+        -INT8_C(  75), -INT8_C(  36), -INT8_C(  13),  INT8_C(  49),  INT8_C(  58),  INT8_C(  92),  INT8_C( 121), -INT8_C(  91) },
+      {  INT8_C( 102),  INT8_C(  15), -INT8_C(  56),  INT8_C(  59),  INT8_C(  88), -INT8_C(  15),  INT8_C( 110),  INT8_C(   0),
+        -INT8_C(  77), -INT8_C( 126), -INT8_C(  90),  INT8_C(  44),  INT8_C(  59), -INT8_C(  11),  INT8_C(  42), -INT8_C(  89) } },
+    { {  INT8_C( 124), -INT8_C(  51), -INT8_C(   8),  INT8_C(  33),  INT8_C( 123), -INT8_C( 121),  INT8_C(   1),  INT8_C(  29),
+         INT8_C(  57),  INT8_C(  66), -INT8_C(  92), -INT8_C(  71),  INT8_C(  80),  INT8_C(  38), -INT8_C(  14), -INT8_C( 118) },
+      { -INT8_C(  71),  INT8_C(  37), -INT8_C(  18),  INT8_C(  61),  INT8_C(  41), -INT8_C(  58),  INT8_C( 100),  INT8_C(  27),
+         INT8_C(  68), -INT8_C(  33),  INT8_C( 107),  INT8_C(  22),  INT8_C(  67),  INT8_C(  61), -INT8_C(  32), -INT8_C(  34) },
+      { -INT8_C(  83),  INT8_C(  85) },
+      {  INT8_C( 124), -INT8_C(  51), -INT8_C(   8),  INT8_C(  33),  INT8_C( 123), -INT8_C( 121),  INT8_C(   1),  INT8_C(  29),
+        -INT8_C(  83),  INT8_C(  66), -INT8_C(  92), -INT8_C(  71),  INT8_C(  80),  INT8_C(  38), -INT8_C(  14), -INT8_C( 118) },
+      { -INT8_C(  71),  INT8_C(  37), -INT8_C(  18),  INT8_C(  61),  INT8_C(  41), -INT8_C(  58),  INT8_C( 100),  INT8_C(  27),
+         INT8_C(  85), -INT8_C(  33),  INT8_C( 107),  INT8_C(  22),  INT8_C(  67),  INT8_C(  61), -INT8_C(  32), -INT8_C(  34) } },
+    { {  INT8_C( 105),  INT8_C(  77), -INT8_C(  16),  INT8_C( 124),  INT8_C( 117), -INT8_C(  30),  INT8_C(  45),  INT8_C(  65),
+         INT8_C(  75),  INT8_C(  40),  INT8_C(  23),  INT8_C(  14), -INT8_C(  76),  INT8_C(  11), -INT8_C(   3),  INT8_C(  54) },
+      {  INT8_C(  42),  INT8_C(  54), -INT8_C(  99),  INT8_C(  23), -INT8_C(  32), -INT8_C(  82),  INT8_C(  77), -INT8_C(  67),
+        -INT8_C(  72), -INT8_C(  94), -INT8_C( 124), -INT8_C(  99), -INT8_C(  71),  INT8_C(  25), -INT8_C(  16), -INT8_C( 115) },
+      { -INT8_C(  55),  INT8_C(   8) },
+      {  INT8_C( 105),  INT8_C(  77), -INT8_C(  16),  INT8_C( 124),  INT8_C( 117), -INT8_C(  30),  INT8_C(  45),  INT8_C(  65),
+        -INT8_C(  55),  INT8_C(  40),  INT8_C(  23),  INT8_C(  14), -INT8_C(  76),  INT8_C(  11), -INT8_C(   3),  INT8_C(  54) },
+      {  INT8_C(  42),  INT8_C(  54), -INT8_C(  99),  INT8_C(  23), -INT8_C(  32), -INT8_C(  82),  INT8_C(  77), -INT8_C(  67),
+         INT8_C(   8), -INT8_C(  94), -INT8_C( 124), -INT8_C(  99), -INT8_C(  71),  INT8_C(  25), -INT8_C(  16), -INT8_C( 115) } },
+    { {  INT8_C(   7), -INT8_C(  48), -INT8_C(  58),  INT8_C( 100), -INT8_C(  17), -INT8_C(  27),  INT8_C( 108),  INT8_C(  64),
+         INT8_C(  85),  INT8_C(  27),  INT8_C(  67), -INT8_C(  62), -INT8_C(  15),  INT8_C(  55),  INT8_C(  14), -INT8_C( 101) },
+      {  INT8_C(  77), -INT8_C(  34), -INT8_C(  75), -INT8_C(  76), -INT8_C(  36),  INT8_C(  90), -INT8_C(  92), -INT8_C(  98),
+        -INT8_C(  11), -INT8_C(  46), -INT8_C(  48), -INT8_C(  67),  INT8_C(  45), -INT8_C(  78), -INT8_C(  35),  INT8_C(  42) },
+      {  INT8_C(  39),  INT8_C(  39) },
+      {  INT8_C(   7), -INT8_C(  48), -INT8_C(  58),  INT8_C( 100), -INT8_C(  17), -INT8_C(  27),  INT8_C( 108),  INT8_C(  64),
+         INT8_C(  39),  INT8_C(  27),  INT8_C(  67), -INT8_C(  62), -INT8_C(  15),  INT8_C(  55),  INT8_C(  14), -INT8_C( 101) },
+      {  INT8_C(  77), -INT8_C(  34), -INT8_C(  75), -INT8_C(  76), -INT8_C(  36),  INT8_C(  90), -INT8_C(  92), -INT8_C(  98),
+         INT8_C(  39), -INT8_C(  46), -INT8_C(  48), -INT8_C(  67),  INT8_C(  45), -INT8_C(  78), -INT8_C(  35),  INT8_C(  42) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x16x2_t src = { { simde_vld1q_s8(test_vec[i].src0),
+                                 simde_vld1q_s8(test_vec[i].src1) } };
+
+    simde_int8x16x2_t r = simde_vld2q_lane_s8(test_vec[i].a, src, 8);
+    simde_test_arm_neon_assert_equal_i8x16(r.val[0], simde_vld1q_s8(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i8x16(r.val[1], simde_vld1q_s8(test_vec[i].r1));
+
+    int8_t a_[2];
+    simde_vst2q_lane_s8(a_, r, 8);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_lane_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t src0[8];
+    int16_t src1[8];
+    int16_t a[2];
+    int16_t r0[8];
+    int16_t r1[8];
+  } test_vec[] = {
+    { {  INT16_C(  4997),  INT16_C(  5455),  INT16_C(  5874), -INT16_C(  7378), -INT16_C(  4616), -INT16_C( 21488), -INT16_C(  5330),  INT16_C(  9524) },
+      { -INT16_C( 24572), -INT16_C( 20842),  INT16_C(  9607), -INT16_C( 21672), -INT16_C( 11660), -INT16_C( 30810), -INT16_C( 14151), -INT16_C(  4216) },
+      {  INT16_C( 26037),  INT16_C( 30507) },
+      {  INT16_C(  4997),  INT16_C(  5455),  INT16_C(  5874), -INT16_C(  7378),  INT16_C( 26037), -INT16_C( 21488), -INT16_C(  5330),  INT16_C(  9524) },
+      { -INT16_C( 24572), -INT16_C( 20842),  INT16_C(  9607), -INT16_C( 21672),  INT16_C( 30507), -INT16_C( 30810), -INT16_C( 14151), -INT16_C(  4216) } },
+    { { -INT16_C(  5399),  INT16_C( 19490), -INT16_C( 25694),  INT16_C( 27555),  INT16_C(  8034),  INT16_C( 24121), -INT16_C(  6561),  INT16_C( 19500) },
+      { -INT16_C(  7523), -INT16_C( 28587),  INT16_C(  6851),  INT16_C( 19895),  INT16_C(   212),  INT16_C( 25391),  INT16_C( 26024),  INT16_C( 32287) },
+      { -INT16_C( 13159), -INT16_C( 19376) },
+      { -INT16_C(  5399),  INT16_C( 19490), -INT16_C( 25694),  INT16_C( 27555), -INT16_C( 13159),  INT16_C( 24121), -INT16_C(  6561),  INT16_C( 19500) },
+      { -INT16_C(  7523), -INT16_C( 28587),  INT16_C(  6851),  INT16_C( 19895), -INT16_C( 19376),  INT16_C( 25391),  INT16_C( 26024),  INT16_C( 32287) } },
+    { {  INT16_C( 20530),  INT16_C( 23589),  INT16_C( 22576), -INT16_C(  1782), -INT16_C( 15908), -INT16_C(  9556), -INT16_C( 31745),  INT16_C( 18525) },
+      { -INT16_C( 22605), -INT16_C( 17399),  INT16_C(  2048),  INT16_C( 23144),  INT16_C( 24048), -INT16_C( 26912), -INT16_C(  2205),  INT16_C( 13132) },
+      { -INT16_C( 17106), -INT16_C( 16304) },
+      {  INT16_C( 20530),  INT16_C( 23589),  INT16_C( 22576), -INT16_C(  1782), -INT16_C( 17106), -INT16_C(  9556), -INT16_C( 31745),  INT16_C( 18525) },
+      { -INT16_C( 22605), -INT16_C( 17399),  INT16_C(  2048),  INT16_C( 23144), -INT16_C( 16304), -INT16_C( 26912), -INT16_C(  2205),  INT16_C( 13132) } },
+    { {  INT16_C(  5818), -INT16_C( 12818),  INT16_C( 18986), -INT16_C( 31929),  INT16_C( 27869), -INT16_C( 12196),  INT16_C(  3626),  INT16_C(  9677) },
+      { -INT16_C( 20177),  INT16_C( 16741),  INT16_C(  3624), -INT16_C( 31453),  INT16_C(    25), -INT16_C(  1232), -INT16_C( 18968),  INT16_C( 20012) },
+      { -INT16_C( 26224),  INT16_C( 19194) },
+      {  INT16_C(  5818), -INT16_C( 12818),  INT16_C( 18986), -INT16_C( 31929), -INT16_C( 26224), -INT16_C( 12196),  INT16_C(  3626),  INT16_C(  9677) },
+      { -INT16_C( 20177),  INT16_C( 16741),  INT16_C(  3624), -INT16_C( 31453),  INT16_C( 19194), -INT16_C(  1232), -INT16_C( 18968),  INT16_C( 20012) } },
+    { {  INT16_C( 24559),  INT16_C( 18596), -INT16_C( 14267),  INT16_C( 16619),  INT16_C( 24339),  INT16_C( 20290),  INT16_C(  4389),  INT16_C(  9390) },
+      { -INT16_C( 32606),  INT16_C( 13425),  INT16_C( 26432),  INT16_C(  3477),  INT16_C( 31523), -INT16_C( 17959), -INT16_C( 20826), -INT16_C( 19540) },
+      {  INT16_C( 12657),  INT16_C( 10972) },
+      {  INT16_C( 24559),  INT16_C( 18596), -INT16_C( 14267),  INT16_C( 16619),  INT16_C( 12657),  INT16_C( 20290),  INT16_C(  4389),  INT16_C(  9390) },
+      { -INT16_C( 32606),  INT16_C( 13425),  INT16_C( 26432),  INT16_C(  3477),  INT16_C( 10972), -INT16_C( 17959), -INT16_C( 20826), -INT16_C( 19540) } },
+    { { -INT16_C( 29987), -INT16_C( 32708),  INT16_C( 25831), -INT16_C(  7678), -INT16_C( 23540), -INT16_C( 29461),  INT16_C(  7669),  INT16_C( 23912) },
+      {  INT16_C( 16258), -INT16_C(  1131),  INT16_C(  5809),  INT16_C( 16954),  INT16_C( 25104),  INT16_C( 25355), -INT16_C( 21081),  INT16_C( 22751) },
+      {  INT16_C( 30996),  INT16_C(  3661) },
+      { -INT16_C( 29987), -INT16_C( 32708),  INT16_C( 25831), -INT16_C(  7678),  INT16_C( 30996), -INT16_C( 29461),  INT16_C(  7669),  INT16_C( 23912) },
+      {  INT16_C( 16258), -INT16_C(  1131),  INT16_C(  5809),  INT16_C( 16954),  INT16_C(  3661),  INT16_C( 25355), -INT16_C( 21081),  INT16_C( 22751) } },
+    { {  INT16_C(  9911),  INT16_C( 24150), -INT16_C( 25482), -INT16_C( 28499), -INT16_C( 30250),  INT16_C( 25494), -INT16_C( 18946), -INT16_C( 20049) },
+      { -INT16_C( 24998), -INT16_C(  8326), -INT16_C(  7634),  INT16_C( 16230), -INT16_C( 24698), -INT16_C( 24370), -INT16_C( 13466), -INT16_C( 22962) },
+      {  INT16_C( 23160),  INT16_C( 27787) },
+      {  INT16_C(  9911),  INT16_C( 24150), -INT16_C( 25482), -INT16_C( 28499),  INT16_C( 23160),  INT16_C( 25494), -INT16_C( 18946), -INT16_C( 20049) },
+      { -INT16_C( 24998), -INT16_C(  8326), -INT16_C(  7634),  INT16_C( 16230),  INT16_C( 27787), -INT16_C( 24370), -INT16_C( 13466), -INT16_C( 22962) } },
+    { {  INT16_C( 13198),  INT16_C( 19172), -INT16_C( 14238), -INT16_C( 29930), -INT16_C( 24928), -INT16_C(  1469), -INT16_C( 26791), -INT16_C( 25738) },
+      { -INT16_C( 12359),  INT16_C( 15704), -INT16_C( 28492),  INT16_C( 14852), -INT16_C( 23608),  INT16_C(  2564),  INT16_C( 32305),  INT16_C( 29672) },
+      { -INT16_C( 11351), -INT16_C( 10777) },
+      {  INT16_C( 13198),  INT16_C( 19172), -INT16_C( 14238), -INT16_C( 29930), -INT16_C( 11351), -INT16_C(  1469), -INT16_C( 26791), -INT16_C( 25738) },
+      { -INT16_C( 12359),  INT16_C( 15704), -INT16_C( 28492),  INT16_C( 14852), -INT16_C( 10777),  INT16_C(  2564),  INT16_C( 32305),  INT16_C( 29672) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8x2_t src = { { simde_vld1q_s16(test_vec[i].src0),
+                                 simde_vld1q_s16(test_vec[i].src1) } };
+
+    simde_int16x8x2_t r = simde_vld2q_lane_s16(test_vec[i].a, src, 4);
+    simde_test_arm_neon_assert_equal_i16x8(r.val[0], simde_vld1q_s16(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i16x8(r.val[1], simde_vld1q_s16(test_vec[i].r1));
+
+    int16_t a_[2];
+    simde_vst2q_lane_s16(a_, r, 4);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_lane_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t src0[4];
+    int32_t src1[4];
+    int32_t a[2];
+    int32_t r0[4];
+    int32_t r1[4];
+  } test_vec[] = {
+    { {  INT32_C( 1420161992), -INT32_C(  671963297), -INT32_C( 1907548800), -INT32_C(  522021164) },
+      { -INT32_C( 1481629945), -INT32_C(  560557355), -INT32_C( 1928101177),  INT32_C( 1698408570) },
+      {  INT32_C(  145553356),  INT32_C( 1585183297) },
+      {  INT32_C( 1420161992), -INT32_C(  671963297),  INT32_C(  145553356), -INT32_C(  522021164) },
+      { -INT32_C( 1481629945), -INT32_C(  560557355),  INT32_C( 1585183297),  INT32_C( 1698408570) } },
+    { {  INT32_C( 1606634146), -INT32_C( 1807541111),  INT32_C( 1509284209),  INT32_C(  129820050) },
+      { -INT32_C(  578656684), -INT32_C(  919293285),  INT32_C( 1275359966), -INT32_C(  433786444) },
+      { -INT32_C(  470457740), -INT32_C(  691129982) },
+      {  INT32_C( 1606634146), -INT32_C( 1807541111), -INT32_C(  470457740),  INT32_C(  129820050) },
+      { -INT32_C(  578656684), -INT32_C(  919293285), -INT32_C(  691129982), -INT32_C(  433786444) } },
+    { {  INT32_C(   94853963),  INT32_C( 1015870565), -INT32_C(  920199897), -INT32_C(   58985535) },
+      { -INT32_C(  725850501),  INT32_C( 1808946373),  INT32_C(  605278110),  INT32_C( 1141560942) },
+      { -INT32_C(  484154997), -INT32_C( 1613718812) },
+      {  INT32_C(   94853963),  INT32_C( 1015870565), -INT32_C(  484154997), -INT32_C(   58985535) },
+      { -INT32_C(  725850501),  INT32_C( 1808946373), -INT32_C( 1613718812),  INT32_C( 1141560942) } },
+    { { -INT32_C( 1295478755),  INT32_C(  536200632), -INT32_C(  700928224),  INT32_C(  939463677) },
+      { -INT32_C( 1978066902),  INT32_C( 1988173981), -INT32_C(  527644138), -INT32_C(   55491423) },
+      {  INT32_C( 1800497236), -INT32_C( 1085309824) },
+      { -INT32_C( 1295478755),  INT32_C(  536200632),  INT32_C( 1800497236),  INT32_C(  939463677) },
+      { -INT32_C( 1978066902),  INT32_C( 1988173981), -INT32_C( 1085309824), -INT32_C(   55491423) } },
+    { {  INT32_C(  254099663), -INT32_C(  389211091), -INT32_C(  994244898),  INT32_C( 1005837761) },
+      { -INT32_C(  118144732),  INT32_C( 1839334560),  INT32_C(  136397313), -INT32_C(  417772066) },
+      { -INT32_C( 1525407594), -INT32_C( 1546972818) },
+      {  INT32_C(  254099663), -INT32_C(  389211091), -INT32_C( 1525407594),  INT32_C( 1005837761) },
+      { -INT32_C(  118144732),  INT32_C( 1839334560), -INT32_C( 1546972818), -INT32_C(  417772066) } },
+    { {  INT32_C(  187388046),  INT32_C(  979841064), -INT32_C(  980760031), -INT32_C(  257190389) },
+      { -INT32_C( 1678791922),  INT32_C(  600828522), -INT32_C( 1174385525),  INT32_C(   25648728) },
+      { -INT32_C(  684989183), -INT32_C( 1690120661) },
+      {  INT32_C(  187388046),  INT32_C(  979841064), -INT32_C(  684989183), -INT32_C(  257190389) },
+      { -INT32_C( 1678791922),  INT32_C(  600828522), -INT32_C( 1690120661),  INT32_C(   25648728) } },
+    { {  INT32_C(  934746215), -INT32_C(   33086250), -INT32_C( 1938047190),  INT32_C(  202210419) },
+      { -INT32_C(   70860953),  INT32_C( 1645903943),  INT32_C(  338909048), -INT32_C( 1907298416) },
+      {  INT32_C( 1491119440),  INT32_C(  332639657) },
+      {  INT32_C(  934746215), -INT32_C(   33086250),  INT32_C( 1491119440),  INT32_C(  202210419) },
+      { -INT32_C(   70860953),  INT32_C( 1645903943),  INT32_C(  332639657), -INT32_C( 1907298416) } },
+    { { -INT32_C( 1539942942), -INT32_C( 1772635836),  INT32_C( 1204019941), -INT32_C( 1209470663) },
+      { -INT32_C(  695069911), -INT32_C( 1764910866), -INT32_C( 1604639742),  INT32_C(  575058160) },
+      {  INT32_C(  739870671), -INT32_C(  843667102) },
+      { -INT32_C( 1539942942), -INT32_C( 1772635836),  INT32_C(  739870671), -INT32_C( 1209470663) },
+      { -INT32_C(  695069911), -INT32_C( 1764910866), -INT32_C(  843667102),  INT32_C(  575058160) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4x2_t src = { { simde_vld1q_s32(test_vec[i].src0),
+                                 simde_vld1q_s32(test_vec[i].src1) } };
+
+    simde_int32x4x2_t r = simde_vld2q_lane_s32(test_vec[i].a, src, 2);
+    simde_test_arm_neon_assert_equal_i32x4(r.val[0], simde_vld1q_s32(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i32x4(r.val[1], simde_vld1q_s32(test_vec[i].r1));
+
+    int32_t a_[2];
+    simde_vst2q_lane_s32(a_, r, 2);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_lane_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t src0[2];
+    int64_t src1[2];
+    int64_t a[2];
+    int64_t r0[2];
+    int64_t r1[2];
+  } test_vec[] = {
+    { { -INT64_C( 6964047003613076898),  INT64_C(  936206607397978364) },
+      {  INT64_C( 1065371401992280865),  INT64_C( 1928423126172326415) },
+      { -INT64_C( 8669159138091971870),  INT64_C( 7726299851687878243) },
+      { -INT64_C( 6964047003613076898), -INT64_C( 8669159138091971870) },
+      {  INT64_C( 1065371401992280865),  INT64_C( 7726299851687878243) } },
+    { { -INT64_C( 8044072420687713728),  INT64_C( 2125554430279947983) },
+      { -INT64_C( 5161342372510091679),  INT64_C(  882641705449928454) },
+      {  INT64_C( 7620909126656451612),  INT64_C( 1915678632837759032) },
+      { -INT64_C( 8044072420687713728),  INT64_C( 7620909126656451612) },
+      { -INT64_C( 5161342372510091679),  INT64_C( 1915678632837759032) } },
+    { {  INT64_C( 6938533983392852406), -INT64_C( 4637008786365863799) },
+      {  INT64_C( 3826867853486228311), -INT64_C( 2524738643744804133) },
+      {  INT64_C( 7557236843496708549),  INT64_C( 3097565408195480694) },
+      {  INT64_C( 6938533983392852406),  INT64_C( 7557236843496708549) },
+      {  INT64_C( 3826867853486228311),  INT64_C( 3097565408195480694) } },
+    { {  INT64_C(  636930020936650909), -INT64_C( 5752870509864567477) },
+      { -INT64_C( 8065764645166746891),  INT64_C( 8885746861624606426) },
+      { -INT64_C( 3030218662678306926),  INT64_C( 5187266531870373441) },
+      {  INT64_C(  636930020936650909), -INT64_C( 3030218662678306926) },
+      { -INT64_C( 8065764645166746891),  INT64_C( 5187266531870373441) } },
+    { { -INT64_C(  932903933488095728), -INT64_C( 9033985827174090030) },
+      { -INT64_C( 6912880076812097699),  INT64_C( 7813195686762971355) },
+      { -INT64_C(  104449275952988829),  INT64_C( 7017915797601492652) },
+      { -INT64_C(  932903933488095728), -INT64_C(  104449275952988829) },
+      { -INT64_C( 6912880076812097699),  INT64_C( 7017915797601492652) } },
+    { { -INT64_C( 1815772180200769433),  INT64_C( 5617098492824040061) },
+      { -INT64_C( 2891638326377905353),  INT64_C( 7308084600864364241) },
+      { -INT64_C( 3513647658680761436),  INT64_C( 5889975711172172175) },
+      { -INT64_C( 1815772180200769433), -INT64_C( 3513647658680761436) },
+      { -INT64_C( 2891638326377905353),  INT64_C( 5889975711172172175) } },
+    { { -INT64_C( 2776111003311672155),  INT64_C( 7468646934169892106) },
+      {  INT64_C(  988937161699284822),  INT64_C( 7659625655038183187) },
+      {  INT64_C(  890415122827527059),  INT64_C( 6107986053596892827) },
+      { -INT64_C( 2776111003311672155),  INT64_C(  890415122827527059) },
+      {  INT64_C(  988937161699284822),  INT64_C( 6107986053596892827) } },
+    { {  INT64_C( 4114698412946689504),  INT64_C( 4011740574169083773) },
+      {  INT64_C( 6977243702848772718),  INT64_C( 8097728377491077697) },
+      { -INT64_C(  928207173466771123), -INT64_C(  448136604271165649) },
+      {  INT64_C( 4114698412946689504), -INT64_C(  928207173466771123) },
+      {  INT64_C( 6977243702848772718), -INT64_C(  448136604271165649) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2x2_t src = { { simde_vld1q_s64(test_vec[i].src0),
+                                 simde_vld1q_s64(test_vec[i].src1) } };
+
+    simde_int64x2x2_t r = simde_vld2q_lane_s64(test_vec[i].a, src, 1);
+    simde_test_arm_neon_assert_equal_i64x2(r.val[0], simde_vld1q_s64(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i64x2(r.val[1], simde_vld1q_s64(test_vec[i].r1));
+
+    int64_t a_[2];
+    simde_vst2q_lane_s64(a_, r, 1);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_lane_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t src0[16];
+    uint8_t src1[16];
+    uint8_t a[2];
+    uint8_t r0[16];
+    uint8_t r1[16];
+  } test_vec[] = {
+    { { UINT8_C(224), UINT8_C(223), UINT8_C(  3), UINT8_C(182), UINT8_C(170), UINT8_C(139), UINT8_C( 96), UINT8_C(119),
+        UINT8_C(112), UINT8_C(230), UINT8_C(189), UINT8_C(228), UINT8_C(150), UINT8_C(178), UINT8_C( 42), UINT8_C( 12) },
+      { UINT8_C(222), UINT8_C( 83), UINT8_C( 47), UINT8_C(221), UINT8_C(176), UINT8_C(194), UINT8_C( 11), UINT8_C( 54),
+        UINT8_C(214), UINT8_C(181), UINT8_C(241), UINT8_C(231), UINT8_C( 31), UINT8_C(210), UINT8_C(106), UINT8_C( 57) },
+      { UINT8_C( 56), UINT8_C(136) },
+      { UINT8_C(224), UINT8_C(223), UINT8_C(  3), UINT8_C(182), UINT8_C(170), UINT8_C(139), UINT8_C( 96), UINT8_C(119),
+        UINT8_C( 56), UINT8_C(230), UINT8_C(189), UINT8_C(228), UINT8_C(150), UINT8_C(178), UINT8_C( 42), UINT8_C( 12) },
+      { UINT8_C(222), UINT8_C( 83), UINT8_C( 47), UINT8_C(221), UINT8_C(176), UINT8_C(194), UINT8_C( 11), UINT8_C( 54),
+        UINT8_C(136), UINT8_C(181), UINT8_C(241), UINT8_C(231), UINT8_C( 31), UINT8_C(210), UINT8_C(106), UINT8_C( 57) } },
+    { { UINT8_C( 25), UINT8_C( 13), UINT8_C( 77), UINT8_C( 54), UINT8_C( 22), UINT8_C( 52), UINT8_C(197), UINT8_C(181),
+        UINT8_C( 29), UINT8_C(229), UINT8_C(110), UINT8_C(107), UINT8_C(  6), UINT8_C( 83), UINT8_C( 60), UINT8_C( 56) },
+      { UINT8_C(191), UINT8_C(243), UINT8_C(148), UINT8_C( 59), UINT8_C(140), UINT8_C( 19), UINT8_C( 26), UINT8_C(  1),
+        UINT8_C( 20), UINT8_C(122), UINT8_C( 95), UINT8_C( 85), UINT8_C(146), UINT8_C(194), UINT8_C(184), UINT8_C( 40) },
+      { UINT8_C( 26), UINT8_C(162) },
+      { UINT8_C( 25), UINT8_C( 13), UINT8_C( 77), UINT8_C( 54), UINT8_C( 22), UINT8_C( 52), UINT8_C(197), UINT8_C(181),
+        UINT8_C( 26), UINT8_C(229), UINT8_C(110), UINT8_C(107), UINT8_C(  6), UINT8_C( 83), UINT8_C( 60), UINT8_C( 56) },
+      { UINT8_C(191), UINT8_C(243), UINT8_C(148), UINT8_C( 59), UINT8_C(140), UINT8_C( 19), UINT8_C( 26), UINT8_C(  1),
+        UINT8_C(162), UINT8_C(122), UINT8_C( 95), UINT8_C( 85), UINT8_C(146), UINT8_C(194), UINT8_C(184), UINT8_C( 40) } },
+    { { UINT8_C(208), UINT8_C(119), UINT8_C(223), UINT8_C( 47), UINT8_C(126), UINT8_C(232), UINT8_C( 73), UINT8_C(105),
+        UINT8_C(255), UINT8_C(113), UINT8_C(252), UINT8_C(183), UINT8_C(215), UINT8_C(113), UINT8_C( 36), UINT8_C(115) },
+      { UINT8_C( 45), UINT8_C(137), UINT8_C( 46), UINT8_C( 24), UINT8_C(181), UINT8_C(156), UINT8_C(102), UINT8_C( 88),
+        UINT8_C( 78), UINT8_C( 94), UINT8_C( 33), UINT8_C(133), UINT8_C(147), UINT8_C( 48), UINT8_C(212), UINT8_C( 10) },
+      { UINT8_C( 41), UINT8_C( 31) },
+      { UINT8_C(208), UINT8_C(119), UINT8_C(223), UINT8_C( 47), UINT8_C(126), UINT8_C(232), UINT8_C( 73), UINT8_C(105),
+        UINT8_C( 41), UINT8_C(113), UINT8_C(252), UINT8_C(183), UINT8_C(215), UINT8_C(113), UINT8_C( 36), UINT8_C(115) },
+      { UINT8_C( 45), UINT8_C(137), UINT8_C( 46), UINT8_C( 24), UINT8_C(181), UINT8_C(156), UINT8_C(102), UINT8_C( 88),
+        UINT8_C( 31), UINT8_C( 94), UINT8_C( 33), UINT8_C(133), UINT8_C(147), UINT8_C( 48), UINT8_C(212), UINT8_C( 10) } },
+    { { UINT8_C( 60), UINT8_C( 28), UINT8_C(168), UINT8_C(207), UINT8_C( 70), UINT8_C(201), UINT8_C( 16), UINT8_C(150),
+        UINT8_C(249), UINT8_C( 63), UINT8_C(113), UINT8_C(121), UINT8_C( 25), UINT8_C( 84), UINT8_C(164), UINT8_C(105) },
+      { UINT8_C( 54), UINT8_C(115), UINT8_C(122), UINT8_C( 47), UINT8_C(160), UINT8_C(135), UINT8_C(245), UINT8_C(215),
+        UINT8_C(175), UINT8_C(155), UINT8_C(227), UINT8_C(136), UINT8_C(165), UINT8_C(154), UINT8_C(167), UINT8_C(142) },
+      { UINT8_C(182), UINT8_C(213) },
+      { UINT8_C( 60), UINT8_C( 28), UINT8_C(168), UINT8_C(207), UINT8_C( 70), UINT8_C(201), UINT8_C( 16), UINT8_C(150),
+        UINT8_C(182), UINT8_C( 63), UINT8_C(113), UINT8_C(121), UINT8_C( 25), UINT8_C( 84), UINT8_C(164), UINT8_C(105) },
+      { UINT8_C( 54), UINT8_C(115), UINT8_C(122), UINT8_C( 47), UINT8_C(160), UINT8_C(135), UINT8_C(245), UINT8_C(215),
+        UINT8_C(213), UINT8_C(155), UINT8_C(227), UINT8_C(136), UINT8_C(165), UINT8_C(154), UINT8_C(167), UINT8_C(142) } },
+    { { UINT8_C(138), UINT8_C( 20), UINT8_C(134), UINT8_C(104), UINT8_C(209), UINT8_C(148), UINT8_C(173), UINT8_C( 36),
+        UINT8_C(107), UINT8_C(211), UINT8_C(196), UINT8_C(232), UINT8_C(239), UINT8_C( 25), UINT8_C(205), UINT8_C(124) },
+      { UINT8_C(217), UINT8_C(161), UINT8_C( 13), UINT8_C(161), UINT8_C(162), UINT8_C( 46), UINT8_C(229), UINT8_C(150),
+        UINT8_C( 99), UINT8_C(147), UINT8_C(187), UINT8_C(239), UINT8_C( 37), UINT8_C(137), UINT8_C( 68), UINT8_C( 88) },
+      { UINT8_C(100), UINT8_C(147) },
+      { UINT8_C(138), UINT8_C( 20), UINT8_C(134), UINT8_C(104), UINT8_C(209), UINT8_C(148), UINT8_C(173), UINT8_C( 36),
+        UINT8_C(100), UINT8_C(211), UINT8_C(196), UINT8_C(232), UINT8_C(239), UINT8_C( 25), UINT8_C(205), UINT8_C(124) },
+      { UINT8_C(217), UINT8_C(161), UINT8_C( 13), UINT8_C(161), UINT8_C(162), UINT8_C( 46), UINT8_C(229), UINT8_C(150),
+        UINT8_C(147), UINT8_C(147), UINT8_C(187), UINT8_C(239), UINT8_C( 37), UINT8_C(137), UINT8_C( 68), UINT8_C( 88) } },
+    { { UINT8_C(107), UINT8_C(247), UINT8_C( 68), UINT8_C( 24), UINT8_C(105), UINT8_C( 55), UINT8_C(159), UINT8_C(121),
+        UINT8_C( 44), UINT8_C( 21), UINT8_C(225), UINT8_C( 79), UINT8_C(219), UINT8_C( 39), UINT8_C(194), UINT8_C(220) },
+      { UINT8_C( 94), UINT8_C(205), UINT8_C(101), UINT8_C(249), UINT8_C( 11), UINT8_C(134), UINT8_C(127), UINT8_C(157),
+        UINT8_C(172), UINT8_C(252), UINT8_C( 84), UINT8_C(182), UINT8_C( 30), UINT8_C( 47), UINT8_C(179), UINT8_C(241) },
+      { UINT8_C(161), UINT8_C(159) },
+      { UINT8_C(107), UINT8_C(247), UINT8_C( 68), UINT8_C( 24), UINT8_C(105), UINT8_C( 55), UINT8_C(159), UINT8_C(121),
+        UINT8_C(161), UINT8_C( 21), UINT8_C(225), UINT8_C( 79), UINT8_C(219), UINT8_C( 39), UINT8_C(194), UINT8_C(220) },
+      { UINT8_C( 94), UINT8_C(205), UINT8_C(101), UINT8_C(249), UINT8_C( 11), UINT8_C(134), UINT8_C(127), UINT8_C(157),
+        UINT8_C(159), UINT8_C(252), UINT8_C( 84), UINT8_C(182), UINT8_C( 30), UINT8_C( 47), UINT8_C(179), UINT8_C(241) } },
+    { { UINT8_C(125), UINT8_C(207), UINT8_C(180), UINT8_C(164), UINT8_C( 63), UINT8_C(145), UINT8_C(107), UINT8_C( 93),
+        UINT8_C(140), UINT8_C( 98), UINT8_C( 98), UINT8_C(254), UINT8_C(195), UINT8_C(163), UINT8_C( 83), UINT8_C(246) },
+      { UINT8_C(210), UINT8_C(132), UINT8_C(233), UINT8_C(197), UINT8_C( 58), UINT8_C(147), UINT8_C(197), UINT8_C( 65),
+        UINT8_C(138), UINT8_C(254), UINT8_C(165), UINT8_C( 15), UINT8_C(217), UINT8_C(156), UINT8_C( 76), UINT8_C( 74) },
+      { UINT8_C(127), UINT8_C(234) },
+      { UINT8_C(125), UINT8_C(207), UINT8_C(180), UINT8_C(164), UINT8_C( 63), UINT8_C(145), UINT8_C(107), UINT8_C( 93),
+        UINT8_C(127), UINT8_C( 98), UINT8_C( 98), UINT8_C(254), UINT8_C(195), UINT8_C(163), UINT8_C( 83), UINT8_C(246) },
+      { UINT8_C(210), UINT8_C(132), UINT8_C(233), UINT8_C(197), UINT8_C( 58), UINT8_C(147), UINT8_C(197), UINT8_C( 65),
+        UINT8_C(234), UINT8_C(254), UINT8_C(165), UINT8_C( 15), UINT8_C(217), UINT8_C(156), UINT8_C( 76), UINT8_C( 74) } },
+    { { UINT8_C(123), UINT8_C(231), UINT8_C(228), UINT8_C(209), UINT8_C( 66), UINT8_C( 28), UINT8_C(164), UINT8_C( 49),
+        UINT8_C(151), UINT8_C(200), UINT8_C(138), UINT8_C(221), UINT8_C(117), UINT8_C( 86), UINT8_C( 34), UINT8_C( 43) },
+      { UINT8_C(175), UINT8_C(203), UINT8_C( 31), UINT8_C( 25), UINT8_C(  7), UINT8_C( 40), UINT8_C( 47), UINT8_C(120),
+        UINT8_C( 71), UINT8_C(  6), UINT8_C( 24), UINT8_C(167), UINT8_C( 12), UINT8_C(188), UINT8_C(101), UINT8_C( 35) },
+      { UINT8_C( 68), UINT8_C(112) },
+      { UINT8_C(123), UINT8_C(231), UINT8_C(228), UINT8_C(209), UINT8_C( 66), UINT8_C( 28), UINT8_C(164), UINT8_C( 49),
+        UINT8_C( 68), UINT8_C(200), UINT8_C(138), UINT8_C(221), UINT8_C(117), UINT8_C( 86), UINT8_C( 34), UINT8_C( 43) },
+      { UINT8_C(175), UINT8_C(203), UINT8_C( 31), UINT8_C( 25), UINT8_C(  7), UINT8_C( 40), UINT8_C( 47), UINT8_C(120),
+        UINT8_C(112), UINT8_C(  6), UINT8_C( 24), UINT8_C(167), UINT8_C( 12), UINT8_C(188), UINT8_C(101), UINT8_C( 35) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x16x2_t src = { { simde_vld1q_u8(test_vec[i].src0),
+                                  simde_vld1q_u8(test_vec[i].src1) } };
+
+    simde_uint8x16x2_t r = simde_vld2q_lane_u8(test_vec[i].a, src, 8);
+    simde_test_arm_neon_assert_equal_u8x16(r.val[0], simde_vld1q_u8(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u8x16(r.val[1], simde_vld1q_u8(test_vec[i].r1));
+
+    uint8_t a_[2];
+    simde_vst2q_lane_u8(a_, r, 8);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_lane_u16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t src0[8];
+    uint16_t src1[8];
+    uint16_t a[2];
+    uint16_t r0[8];
+    uint16_t r1[8];
+  } test_vec[] = {
+    { { UINT16_C(65453), UINT16_C(52042), UINT16_C(14470), UINT16_C(49243), UINT16_C(63390), UINT16_C(17529), UINT16_C( 8220), UINT16_C(50887) },
+      { UINT16_C(17250), UINT16_C(58126), UINT16_C(65457), UINT16_C(15062), UINT16_C(23313), UINT16_C(32450), UINT16_C(19715), UINT16_C(43708) },
+      { UINT16_C(55315), UINT16_C(55029) },
+      { UINT16_C(65453), UINT16_C(52042), UINT16_C(14470), UINT16_C(49243), UINT16_C(55315), UINT16_C(17529), UINT16_C( 8220), UINT16_C(50887) },
+      { UINT16_C(17250), UINT16_C(58126), UINT16_C(65457), UINT16_C(15062), UINT16_C(55029), UINT16_C(32450), UINT16_C(19715), UINT16_C(43708) } },
+    { { UINT16_C(43004), UINT16_C(20436), UINT16_C(42686), UINT16_C(33804), UINT16_C(38185), UINT16_C(22884), UINT16_C(17279), UINT16_C(49116) },
+      { UINT16_C(13454), UINT16_C(31362), UINT16_C(53575), UINT16_C(54625), UINT16_C(20671), UINT16_C( 2858), UINT16_C( 1126), UINT16_C(59937) },
+      { UINT16_C(55915), UINT16_C(18032) },
+      { UINT16_C(43004), UINT16_C(20436), UINT16_C(42686), UINT16_C(33804), UINT16_C(55915), UINT16_C(22884), UINT16_C(17279), UINT16_C(49116) },
+      { UINT16_C(13454), UINT16_C(31362), UINT16_C(53575), UINT16_C(54625), UINT16_C(18032), UINT16_C( 2858), UINT16_C( 1126), UINT16_C(59937) } },
+    { { UINT16_C(48841), UINT16_C(63725), UINT16_C(45629), UINT16_C(35315), UINT16_C(64122), UINT16_C(62900), UINT16_C(23925), UINT16_C(59641) },
+      { UINT16_C(32440), UINT16_C( 4653), UINT16_C(35197), UINT16_C(26161), UINT16_C(11746), UINT16_C( 2837), UINT16_C(60614), UINT16_C( 2655) },
+      { UINT16_C(63491), UINT16_C(54031) },
+      { UINT16_C(48841), UINT16_C(63725), UINT16_C(45629), UINT16_C(35315), UINT16_C(63491), UINT16_C(62900), UINT16_C(23925), UINT16_C(59641) },
+      { UINT16_C(32440), UINT16_C( 4653), UINT16_C(35197), UINT16_C(26161), UINT16_C(54031), UINT16_C( 2837), UINT16_C(60614), UINT16_C( 2655) } },
+    { { UINT16_C(49703), UINT16_C(22927), UINT16_C(13258), UINT16_C(37311), UINT16_C(53333), UINT16_C(41694), UINT16_C(46399), UINT16_C(38681) },
+      { UINT16_C(61032), UINT16_C(60239), UINT16_C(14129), UINT16_C(51424), UINT16_C(56104), UINT16_C(58971), UINT16_C(52715), UINT16_C(51769) },
+      { UINT16_C(53556), UINT16_C(44890) },
+      { UINT16_C(49703), UINT16_C(22927), UINT16_C(13258), UINT16_C(37311), UINT16_C(53556), UINT16_C(41694), UINT16_C(46399), UINT16_C(38681) },
+      { UINT16_C(61032), UINT16_C(60239), UINT16_C(14129), UINT16_C(51424), UINT16_C(44890), UINT16_C(58971), UINT16_C(52715), UINT16_C(51769) } },
+    { { UINT16_C( 2988), UINT16_C(47482), UINT16_C(20073), UINT16_C(46172), UINT16_C(35890), UINT16_C(57458), UINT16_C(57675), UINT16_C(13259) },
+      { UINT16_C(58004), UINT16_C(39491), UINT16_C(34556), UINT16_C(39577), UINT16_C(  635), UINT16_C(25111), UINT16_C(18293), UINT16_C(36804) },
+      { UINT16_C(60966), UINT16_C(42335) },
+      { UINT16_C( 2988), UINT16_C(47482), UINT16_C(20073), UINT16_C(46172), UINT16_C(60966), UINT16_C(57458), UINT16_C(57675), UINT16_C(13259) },
+      { UINT16_C(58004), UINT16_C(39491), UINT16_C(34556), UINT16_C(39577), UINT16_C(42335), UINT16_C(25111), UINT16_C(18293), UINT16_C(36804) } },
+    { { UINT16_C(30251), UINT16_C(31333), UINT16_C(33890), UINT16_C( 1672), UINT16_C(  745), UINT16_C( 4735), UINT16_C(43018), UINT16_C(  647) },
+      { UINT16_C(10582), UINT16_C(18254), UINT16_C(42191), UINT16_C(14288), UINT16_C( 5663), UINT16_C(59179), UINT16_C(62278), UINT16_C(56734) },
+      { UINT16_C(16119), UINT16_C(49026) },
+      { UINT16_C(30251), UINT16_C(31333), UINT16_C(33890), UINT16_C( 1672), UINT16_C(16119), UINT16_C( 4735), UINT16_C(43018), UINT16_C(  647) },
+      { UINT16_C(10582), UINT16_C(18254), UINT16_C(42191), UINT16_C(14288), UINT16_C(49026), UINT16_C(59179), UINT16_C(62278), UINT16_C(56734) } },
+    { { UINT16_C(31483), UINT16_C(47864), UINT16_C( 7397), UINT16_C(38868), UINT16_C(56876), UINT16_C(63093), UINT16_C(29048), UINT16_C(48081) },
+      { UINT16_C(31255), UINT16_C(36392), UINT16_C(27391), UINT16_C(37906), UINT16_C( 6784), UINT16_C(25647), UINT16_C(58318), UINT16_C(18157) },
+      { UINT16_C(15574), UINT16_C(26318) },
+      { UINT16_C(31483), UINT16_C(47864), UINT16_C( 7397), UINT16_C(38868), UINT16_C(15574), UINT16_C(63093), UINT16_C(29048), UINT16_C(48081) },
+      { UINT16_C(31255), UINT16_C(36392), UINT16_C(27391), UINT16_C(37906), UINT16_C(26318), UINT16_C(25647), UINT16_C(58318), UINT16_C(18157) } },
+    { { UINT16_C( 2313), UINT16_C( 4145), UINT16_C(47092), UINT16_C(34627), UINT16_C( 7825), UINT16_C(25248), UINT16_C(28090), UINT16_C( 7164) },
+      { UINT16_C(15917), UINT16_C(46821), UINT16_C( 4846), UINT16_C(51062), UINT16_C(20380), UINT16_C(59027), UINT16_C(48578), UINT16_C(25415) },
+      { UINT16_C( 4978), UINT16_C(14816) },
+      { UINT16_C( 2313), UINT16_C( 4145), UINT16_C(47092), UINT16_C(34627), UINT16_C( 4978), UINT16_C(25248), UINT16_C(28090), UINT16_C( 7164) },
+      { UINT16_C(15917), UINT16_C(46821), UINT16_C( 4846), UINT16_C(51062), UINT16_C(14816), UINT16_C(59027), UINT16_C(48578), UINT16_C(25415) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x8x2_t src = { { simde_vld1q_u16(test_vec[i].src0),
+                                  simde_vld1q_u16(test_vec[i].src1) } };
+
+    simde_uint16x8x2_t r = simde_vld2q_lane_u16(test_vec[i].a, src, 4);
+    simde_test_arm_neon_assert_equal_u16x8(r.val[0], simde_vld1q_u16(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u16x8(r.val[1], simde_vld1q_u16(test_vec[i].r1));
+
+    uint16_t a_[2];
+    simde_vst2q_lane_u16(a_, r, 4);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_lane_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t src0[4];
+    uint32_t src1[4];
+    uint32_t a[2];
+    uint32_t r0[4];
+    uint32_t r1[4];
+  } test_vec[] = {
+    { { UINT32_C(  12672170), UINT32_C(2904268329), UINT32_C(4042750774), UINT32_C(2810167964) },
+      { UINT32_C(2741963417), UINT32_C(2144428231), UINT32_C(1639656687), UINT32_C(3945064062) },
+      { UINT32_C(2310527867), UINT32_C( 596845844) },
+      { UINT32_C(  12672170), UINT32_C(2904268329), UINT32_C(2310527867), UINT32_C(2810167964) },
+      { UINT32_C(2741963417), UINT32_C(2144428231), UINT32_C( 596845844), UINT32_C(3945064062) } },
+    { { UINT32_C(1079286539), UINT32_C(3049478449), UINT32_C(1294040236), UINT32_C( 194228965) },
+      { UINT32_C(2292589608), UINT32_C(1760618336), UINT32_C(1571889833), UINT32_C(2116730605) },
+      { UINT32_C(1351704160), UINT32_C(1112487629) },
+      { UINT32_C(1079286539), UINT32_C(3049478449), UINT32_C(1351704160), UINT32_C( 194228965) },
+      { UINT32_C(2292589608), UINT32_C(1760618336), UINT32_C(1112487629), UINT32_C(2116730605) } },
+    { { UINT32_C(1886607442), UINT32_C( 412507004), UINT32_C(1206077223), UINT32_C(3438814661) },
+      { UINT32_C(3676999252), UINT32_C(2671946593), UINT32_C( 227528340), UINT32_C( 355394588) },
+      { UINT32_C(1206336797), UINT32_C(4164637047) },
+      { UINT32_C(1886607442), UINT32_C( 412507004), UINT32_C(1206336797), UINT32_C(3438814661) },
+      { UINT32_C(3676999252), UINT32_C(2671946593), UINT32_C(4164637047), UINT32_C( 355394588) } },
+    { { UINT32_C(3246561381), UINT32_C(3673897613), UINT32_C(3460882594), UINT32_C( 233729636) },
+      { UINT32_C(1713676691), UINT32_C(4138274168), UINT32_C(4253407576), UINT32_C( 485736537) },
+      { UINT32_C(1153388459), UINT32_C(1231202292) },
+      { UINT32_C(3246561381), UINT32_C(3673897613), UINT32_C(1153388459), UINT32_C( 233729636) },
+      { UINT32_C(1713676691), UINT32_C(4138274168), UINT32_C(1231202292), UINT32_C( 485736537) } },
+    { { UINT32_C(2079495810), UINT32_C(3485400770), UINT32_C(2433223930), UINT32_C(1539411073) },
+      { UINT32_C(1788002417), UINT32_C(2996611662), UINT32_C( 971703023), UINT32_C(4169753938) },
+      { UINT32_C(4213414283), UINT32_C(2572667471) },
+      { UINT32_C(2079495810), UINT32_C(3485400770), UINT32_C(4213414283), UINT32_C(1539411073) },
+      { UINT32_C(1788002417), UINT32_C(2996611662), UINT32_C(2572667471), UINT32_C(4169753938) } },
+    { { UINT32_C(2949629491), UINT32_C(3130237298), UINT32_C(1038094915), UINT32_C( 266497340) },
+      { UINT32_C(3815854643), UINT32_C( 236623826), UINT32_C(3777135828), UINT32_C(2000877908) },
+      { UINT32_C( 433785314), UINT32_C(3392651626) },
+      { UINT32_C(2949629491), UINT32_C(3130237298), UINT32_C( 433785314), UINT32_C( 266497340) },
+      { UINT32_C(3815854643), UINT32_C( 236623826), UINT32_C(3392651626), UINT32_C(2000877908) } },
+    { { UINT32_C(4044145521), UINT32_C(1596706397), UINT32_C(1056228760), UINT32_C(3662136768) },
+      { UINT32_C(2542278259), UINT32_C(2970715564), UINT32_C( 939526715), UINT32_C(1340362908) },
+      { UINT32_C(1608865011), UINT32_C( 604404871) },
+      { UINT32_C(4044145521), UINT32_C(1596706397), UINT32_C(1608865011), UINT32_C(3662136768) },
+      { UINT32_C(2542278259), UINT32_C(2970715564), UINT32_C( 604404871), UINT32_C(1340362908) } },
+    { { UINT32_C( 600305879), UINT32_C( 513445604), UINT32_C(3455076638), UINT32_C(2746413149) },
+      { UINT32_C(3772937062), UINT32_C(2744747429), UINT32_C(1037379163), UINT32_C(3867258730) },
+      { UINT32_C(3850761246), UINT32_C(2700177493) },
+      { UINT32_C( 600305879), UINT32_C( 513445604), UINT32_C(3850761246), UINT32_C(2746413149) },
+      { UINT32_C(3772937062), UINT32_C(2744747429), UINT32_C(2700177493), UINT32_C(3867258730) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4x2_t src = { { simde_vld1q_u32(test_vec[i].src0),
+                                  simde_vld1q_u32(test_vec[i].src1) } };
+
+    simde_uint32x4x2_t r = simde_vld2q_lane_u32(test_vec[i].a, src, 2);
+    simde_test_arm_neon_assert_equal_u32x4(r.val[0], simde_vld1q_u32(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u32x4(r.val[1], simde_vld1q_u32(test_vec[i].r1));
+
+    uint32_t a_[2];
+    simde_vst2q_lane_u32(a_, r, 2);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vld2q_lane_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t src0[2];
+    uint64_t src1[2];
+    uint64_t a[2];
+    uint64_t r0[2];
+    uint64_t r1[2];
+  } test_vec[] = {
+    { { UINT64_C(17442643499590672913), UINT64_C(12522457740236554498) },
+      { UINT64_C(16727121570672873246), UINT64_C(12056839767068357167) },
+      { UINT64_C( 6971533053183999260), UINT64_C(11519317449494664078) },
+      { UINT64_C(17442643499590672913), UINT64_C( 6971533053183999260) },
+      { UINT64_C(16727121570672873246), UINT64_C(11519317449494664078) } },
+    { { UINT64_C( 2352579613657667403), UINT64_C( 7311004733555590974) },
+      { UINT64_C(13047191407121800744), UINT64_C(16890943890492425964) },
+      { UINT64_C( 8426687981565914346), UINT64_C( 4589937932053958615) },
+      { UINT64_C( 2352579613657667403), UINT64_C( 8426687981565914346) },
+      { UINT64_C(13047191407121800744), UINT64_C( 4589937932053958615) } },
+    { { UINT64_C(18446547082419818330), UINT64_C(10298495410222565881) },
+      { UINT64_C(12264190555423420063), UINT64_C(12349806982069692580) },
+      { UINT64_C(12225274762998100194), UINT64_C(  197499763838215289) },
+      { UINT64_C(18446547082419818330), UINT64_C(12225274762998100194) },
+      { UINT64_C(12264190555423420063), UINT64_C(  197499763838215289) } },
+    { { UINT64_C(15975626215505969416), UINT64_C(10281330654143841149) },
+      { UINT64_C( 5330261778167224065), UINT64_C( 3565394385527140833) },
+      { UINT64_C(16789757151512266794), UINT64_C(10915191086305672110) },
+      { UINT64_C(15975626215505969416), UINT64_C(16789757151512266794) },
+      { UINT64_C( 5330261778167224065), UINT64_C(10915191086305672110) } },
+    { { UINT64_C( 9484849865199467055), UINT64_C(11514378965595957108) },
+      { UINT64_C(13388071393396217279), UINT64_C( 5776538325339236897) },
+      { UINT64_C(  612238233490924962), UINT64_C(15044766016506607720) },
+      { UINT64_C( 9484849865199467055), UINT64_C(  612238233490924962) },
+      { UINT64_C(13388071393396217279), UINT64_C(15044766016506607720) } },
+    { { UINT64_C(10995727406960839178), UINT64_C(15499567960002587708) },
+      { UINT64_C( 1828982919295344998), UINT64_C(13996415018988028739) },
+      { UINT64_C( 1246064550299002452), UINT64_C(  733161075497639343) },
+      { UINT64_C(10995727406960839178), UINT64_C( 1246064550299002452) },
+      { UINT64_C( 1828982919295344998), UINT64_C(  733161075497639343) } },
+    { { UINT64_C(10937336338966782078), UINT64_C(12074632696648855852) },
+      { UINT64_C( 6066017928996234776), UINT64_C(15695842163028888708) },
+      { UINT64_C(14045831146962763478), UINT64_C(  479768271500422896) },
+      { UINT64_C(10937336338966782078), UINT64_C(14045831146962763478) },
+      { UINT64_C( 6066017928996234776), UINT64_C(  479768271500422896) } },
+    { { UINT64_C( 9055491982115310122), UINT64_C(17816120250183781091) },
+      { UINT64_C( 8739492967997871208), UINT64_C(14061212051151056480) },
+      { UINT64_C(18221037346430880051), UINT64_C(12877940965458409540) },
+      { UINT64_C( 9055491982115310122), UINT64_C(18221037346430880051) },
+      { UINT64_C( 8739492967997871208), UINT64_C(12877940965458409540) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2x2_t src = { { simde_vld1q_u64(test_vec[i].src0),
+                                  simde_vld1q_u64(test_vec[i].src1) } };
+
+    simde_uint64x2x2_t r = simde_vld2q_lane_u64(test_vec[i].a, src, 1);
+    simde_test_arm_neon_assert_equal_u64x2(r.val[0], simde_vld1q_u64(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u64x2(r.val[1], simde_vld1q_u64(test_vec[i].r1));
+
+    uint64_t a_[2];
+    simde_vst2q_lane_u64(a_, r, 1);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+  }
+
+  return 0;
+}
+
+#endif /* !defined(SIMDE_BUG_INTEL_857088) */
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+#if !defined(SIMDE_BUG_INTEL_857088)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2_dup_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2_dup_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2_dup_s8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2_dup_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2_dup_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2_dup_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2_dup_u8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2_dup_u16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2_dup_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2_dup_u64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_dup_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_dup_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_dup_s8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_dup_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_dup_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_dup_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_dup_u8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_dup_u16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_dup_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_dup_u64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2_lane_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2_lane_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2_lane_s8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2_lane_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2_lane_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2_lane_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2_lane_u8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2_lane_u16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2_lane_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2_lane_u64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_lane_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_lane_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_lane_s8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_lane_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_lane_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_lane_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_lane_u8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_lane_u16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_lane_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vld2q_lane_u64)
+#endif /* !defined(SIMDE_BUG_INTEL_857088) */
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,277 @@
+#define SIMDE_TEST_ARM_NEON_INSN recpe
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/recpe.h"
+
+static int
+test_simde_vrecpes_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32_t a;
+    simde_float32_t r;
+  } test_vec[] = {
+    { SIMDE_FLOAT32_C(         13.87), SIMDE_FLOAT32_C(    0.07226562) },
+    { SIMDE_FLOAT32_C(        -25.88), SIMDE_FLOAT32_C(   -0.03857422) },
+    { SIMDE_FLOAT32_C(        -76.22), SIMDE_FLOAT32_C(   -0.01312256) },
+    { SIMDE_FLOAT32_C(         65.33), SIMDE_FLOAT32_C(    0.01528931) },
+    { SIMDE_FLOAT32_C(          9.84), SIMDE_FLOAT32_C(    0.10180664) },
+    { SIMDE_FLOAT32_C(        -89.39), SIMDE_FLOAT32_C(   -0.01119995) },
+    { SIMDE_FLOAT32_C(         43.56), SIMDE_FLOAT32_C(    0.02294922) },
+    { SIMDE_FLOAT32_C(        -69.74), SIMDE_FLOAT32_C(   -0.01437378) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32_t r = simde_vrecpes_f32(test_vec[i].a);
+    simde_assert_equal_f32(r, test_vec[i].r, 6);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vrecped_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64_t a;
+    simde_float64_t r;
+  } test_vec[] = {
+    { SIMDE_FLOAT64_C(         72.29), SIMDE_FLOAT64_C(    0.01382446) },
+    { SIMDE_FLOAT64_C(         59.32), SIMDE_FLOAT64_C(    0.01684570) },
+    { SIMDE_FLOAT64_C(         90.19), SIMDE_FLOAT64_C(    0.01110840) },
+    { SIMDE_FLOAT64_C(          2.72), SIMDE_FLOAT64_C(    0.36718750) },
+    { SIMDE_FLOAT64_C(        -93.95), SIMDE_FLOAT64_C(   -0.01065063) },
+    { SIMDE_FLOAT64_C(        -68.81), SIMDE_FLOAT64_C(   -0.01452637) },
+    { SIMDE_FLOAT64_C(         72.72), SIMDE_FLOAT64_C(    0.01376343) },
+    { SIMDE_FLOAT64_C(        -76.49), SIMDE_FLOAT64_C(   -0.01309204) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64_t r = simde_vrecped_f64(test_vec[i].a);
+    simde_assert_equal_f64(r, test_vec[i].r, 6);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vrecpe_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(          0.00),            SIMDE_MATH_INFINITYF },
+      {            SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    0.00000000) } },
+    { { SIMDE_FLOAT32_C(        -55.51), SIMDE_FLOAT32_C(         23.47) },
+      { SIMDE_FLOAT32_C(   -0.01800537), SIMDE_FLOAT32_C(    0.04260254) } },
+    { { SIMDE_FLOAT32_C(        -76.21), SIMDE_FLOAT32_C(        -92.69) },
+      { SIMDE_FLOAT32_C(   -0.01312256), SIMDE_FLOAT32_C(   -0.01080322) } },
+    { { SIMDE_FLOAT32_C(         83.84), SIMDE_FLOAT32_C(        -19.00) },
+      { SIMDE_FLOAT32_C(    0.01193237), SIMDE_FLOAT32_C(   -0.05249023) } },
+    { { SIMDE_FLOAT32_C(        -12.53), SIMDE_FLOAT32_C(        -89.61) },
+      { SIMDE_FLOAT32_C(   -0.07983398), SIMDE_FLOAT32_C(   -0.01116943) } },
+    { { SIMDE_FLOAT32_C(         51.02), SIMDE_FLOAT32_C(        -30.69) },
+      { SIMDE_FLOAT32_C(    0.01959229), SIMDE_FLOAT32_C(   -0.03259277) } },
+    { { SIMDE_FLOAT32_C(        -84.70), SIMDE_FLOAT32_C(         59.11) },
+      { SIMDE_FLOAT32_C(   -0.01181030), SIMDE_FLOAT32_C(    0.01690674) } },
+    { { SIMDE_FLOAT32_C(        -48.28), SIMDE_FLOAT32_C(         41.72) },
+      { SIMDE_FLOAT32_C(   -0.02069092), SIMDE_FLOAT32_C(    0.02398682) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32x2_t r = simde_vrecpe_f32(a);
+
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 6);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vrecpe_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[1];
+    simde_float64 r[1];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(          0.00) },
+      {             SIMDE_MATH_INFINITY } },
+    { { SIMDE_FLOAT64_C(        -37.03) },
+      { SIMDE_FLOAT64_C(   -0.02697754) } },
+    { { SIMDE_FLOAT64_C(          9.10) },
+      { SIMDE_FLOAT64_C(    0.10986328) } },
+    { { SIMDE_FLOAT64_C(        -77.96) },
+      { SIMDE_FLOAT64_C(   -0.01284790) } },
+    { { SIMDE_FLOAT64_C(         37.37) },
+      { SIMDE_FLOAT64_C(    0.02679443) } },
+    { { SIMDE_FLOAT64_C(        -47.20) },
+      { SIMDE_FLOAT64_C(   -0.02117920) } },
+    { { SIMDE_FLOAT64_C(        -70.49) },
+      { SIMDE_FLOAT64_C(   -0.01422119) } },
+    { { SIMDE_FLOAT64_C(         64.89) },
+      { SIMDE_FLOAT64_C(    0.01541138) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_float64x1_t r = simde_vrecpe_f64(a);
+
+    simde_test_arm_neon_assert_equal_f64x1(r, simde_vld1_f64(test_vec[i].r), 6);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vrecpe_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a[2];
+    uint32_t r[2];
+  } test_vec[] = {
+    { { UINT32_C(   9614548), UINT32_C(  52834893) },
+      { UINT32_C(4294967295), UINT32_C(4294967295) } },
+    { { UINT32_C(2317639275), UINT32_C( 207612152) },
+      { UINT32_C(3976200192), UINT32_C(4294967295) } },
+    { { UINT32_C(2206632489), UINT32_C(3639817240) },
+      { UINT32_C(4169138176), UINT32_C(2533359616) } },
+    { { UINT32_C(1971955755), UINT32_C(2831306050) },
+      { UINT32_C(4294967295), UINT32_C(3254779904) } },
+    { { UINT32_C(4110783109), UINT32_C(1647934407) },
+      { UINT32_C(2239758336), UINT32_C(4294967295) } },
+    { { UINT32_C(3523960153), UINT32_C(4030651559) },
+      { UINT32_C(2617245696), UINT32_C(2290089984) } },
+    { { UINT32_C( 254003944), UINT32_C(3338895465) },
+      { UINT32_C(4294967295), UINT32_C(2759852032) } },
+    { { UINT32_C(1830045531), UINT32_C(2066316555) },
+      { UINT32_C(4294967295), UINT32_C(4294967295) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x2_t a = simde_vld1_u32(test_vec[i].a);
+    simde_uint32x2_t r = simde_vrecpe_u32(a);
+
+    simde_test_arm_neon_assert_equal_u32x2(r, simde_vld1_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vrecpeq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(          0.00),            SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(         -0.00),           -SIMDE_MATH_INFINITYF },
+      {            SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    0.00000000),           -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   -0.00000000) } },
+    { { SIMDE_FLOAT32_C(         57.21), SIMDE_FLOAT32_C(        -94.13), SIMDE_FLOAT32_C(        -48.75), SIMDE_FLOAT32_C(         41.74) },
+      { SIMDE_FLOAT32_C(    0.01745605), SIMDE_FLOAT32_C(   -0.01062012), SIMDE_FLOAT32_C(   -0.02050781), SIMDE_FLOAT32_C(    0.02398682) } },
+    { { SIMDE_FLOAT32_C(        -54.08), SIMDE_FLOAT32_C(         46.09), SIMDE_FLOAT32_C(         80.55), SIMDE_FLOAT32_C(         55.30) },
+      { SIMDE_FLOAT32_C(   -0.01849365), SIMDE_FLOAT32_C(    0.02172852), SIMDE_FLOAT32_C(    0.01239014), SIMDE_FLOAT32_C(    0.01806641) } },
+    { { SIMDE_FLOAT32_C(        -86.17), SIMDE_FLOAT32_C(          3.73), SIMDE_FLOAT32_C(          8.78), SIMDE_FLOAT32_C(        -45.57) },
+      { SIMDE_FLOAT32_C(   -0.01159668), SIMDE_FLOAT32_C(    0.26757812), SIMDE_FLOAT32_C(    0.11401367), SIMDE_FLOAT32_C(   -0.02197266) } },
+    { { SIMDE_FLOAT32_C(         25.33), SIMDE_FLOAT32_C(         79.83), SIMDE_FLOAT32_C(         34.77), SIMDE_FLOAT32_C(        -17.16) },
+      { SIMDE_FLOAT32_C(    0.03942871), SIMDE_FLOAT32_C(    0.01251221), SIMDE_FLOAT32_C(    0.02874756), SIMDE_FLOAT32_C(   -0.05822754) } },
+    { { SIMDE_FLOAT32_C(         52.97), SIMDE_FLOAT32_C(        -65.84), SIMDE_FLOAT32_C(        -45.74), SIMDE_FLOAT32_C(         49.90) },
+      { SIMDE_FLOAT32_C(    0.01885986), SIMDE_FLOAT32_C(   -0.01516724), SIMDE_FLOAT32_C(   -0.02191162), SIMDE_FLOAT32_C(    0.02001953) } },
+    { { SIMDE_FLOAT32_C(         -2.85), SIMDE_FLOAT32_C(         34.66), SIMDE_FLOAT32_C(        -26.21), SIMDE_FLOAT32_C(         90.03) },
+      { SIMDE_FLOAT32_C(   -0.35156250), SIMDE_FLOAT32_C(    0.02880859), SIMDE_FLOAT32_C(   -0.03808594), SIMDE_FLOAT32_C(    0.01110840) } },
+    { { SIMDE_FLOAT32_C(        -96.57), SIMDE_FLOAT32_C(         81.80), SIMDE_FLOAT32_C(        -22.92), SIMDE_FLOAT32_C(         15.07) },
+      { SIMDE_FLOAT32_C(   -0.01034546), SIMDE_FLOAT32_C(    0.01220703), SIMDE_FLOAT32_C(   -0.04370117), SIMDE_FLOAT32_C(    0.06640625) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32x4_t r = simde_vrecpeq_f32(a);
+
+    #if defined(SIMDE_FAST_MATH)
+      simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 2);
+    #else
+      simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 6);
+    #endif
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vrecpeq_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(          0.00),             SIMDE_MATH_INFINITY },
+      {             SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(    0.00000000) } },
+    { { SIMDE_FLOAT64_C(        -44.84), SIMDE_FLOAT64_C(         54.70) },
+      { SIMDE_FLOAT64_C(   -0.02233887), SIMDE_FLOAT64_C(    0.01831055) } },
+    { { SIMDE_FLOAT64_C(        -97.71), SIMDE_FLOAT64_C(         22.71) },
+      { SIMDE_FLOAT64_C(   -0.01025391), SIMDE_FLOAT64_C(    0.04406738) } },
+    { { SIMDE_FLOAT64_C(        -39.79), SIMDE_FLOAT64_C(        -66.15) },
+      { SIMDE_FLOAT64_C(   -0.02514648), SIMDE_FLOAT64_C(   -0.01513672) } },
+    { { SIMDE_FLOAT64_C(         -6.35), SIMDE_FLOAT64_C(         13.01) },
+      { SIMDE_FLOAT64_C(   -0.15722656), SIMDE_FLOAT64_C(    0.07690430) } },
+    { { SIMDE_FLOAT64_C(        -87.62), SIMDE_FLOAT64_C(          7.54) },
+      { SIMDE_FLOAT64_C(   -0.01141357), SIMDE_FLOAT64_C(    0.13281250) } },
+    { { SIMDE_FLOAT64_C(        -31.38), SIMDE_FLOAT64_C(        -74.51) },
+      { SIMDE_FLOAT64_C(   -0.03186035), SIMDE_FLOAT64_C(   -0.01339722) } },
+    { { SIMDE_FLOAT64_C(         56.71), SIMDE_FLOAT64_C(          1.34) },
+      { SIMDE_FLOAT64_C(    0.01763916), SIMDE_FLOAT64_C(    0.74609375) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64x2_t r = simde_vrecpeq_f64(a);
+
+    #if defined(SIMDE_FAST_MATH)
+      simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 2);
+    #else
+      simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 6);
+    #endif
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vrecpeq_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(2536538838), UINT32_C(4132622344), UINT32_C( 905604568), UINT32_C(3727091285) },
+      { UINT32_C(3632267264), UINT32_C(2231369728), UINT32_C(4294967295), UINT32_C(2474639360) } },
+    { { UINT32_C(3350148646), UINT32_C(  38112456), UINT32_C( 860743485), UINT32_C( 883740024) },
+      { UINT32_C(2751463424), UINT32_C(4294967295), UINT32_C(4294967295), UINT32_C(4294967295) } },
+    { { UINT32_C(3850720559), UINT32_C( 833733246), UINT32_C(4028481321), UINT32_C(1271622434) },
+      { UINT32_C(2390753280), UINT32_C(4294967295), UINT32_C(2290089984), UINT32_C(4294967295) } },
+    { { UINT32_C(  73874293), UINT32_C(3743585872), UINT32_C( 134654593), UINT32_C( 862657093) },
+      { UINT32_C(4294967295), UINT32_C(2466250752), UINT32_C(4294967295), UINT32_C(4294967295) } },
+    { { UINT32_C(3483815742), UINT32_C( 140447046), UINT32_C( 769831739), UINT32_C( 749278841) },
+      { UINT32_C(2642411520), UINT32_C(4294967295), UINT32_C(4294967295), UINT32_C(4294967295) } },
+    { { UINT32_C(1628796354), UINT32_C(1476823709), UINT32_C(3597862969), UINT32_C(2080906167) },
+      { UINT32_C(4294967295), UINT32_C(4294967295), UINT32_C(2566914048), UINT32_C(4294967295) } },
+    { { UINT32_C( 139674118), UINT32_C( 968365621), UINT32_C( 571303723), UINT32_C(3912662745) },
+      { UINT32_C(4294967295), UINT32_C(4294967295), UINT32_C(4294967295), UINT32_C(2357198848) } },
+    { { UINT32_C(1151093922), UINT32_C(2577877284), UINT32_C(1096467456), UINT32_C( 387772142) },
+      { UINT32_C(4294967295), UINT32_C(3573547008), UINT32_C(4294967295), UINT32_C(4294967295) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t a = simde_vld1q_u32(test_vec[i].a);
+    simde_uint32x4_t r = simde_vrecpeq_u32(a);
+
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vrecpes_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrecped_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrecpe_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrecpe_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrecpe_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrecpeq_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrecpeq_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrecpeq_u32)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
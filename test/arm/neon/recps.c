@@ -0,0 +1,249 @@
+#define SIMDE_TEST_ARM_NEON_INSN recps
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/recps.h"
+
+static int
+test_simde_vrecpss_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32_t a;
+    simde_float32_t b;
+    simde_float32_t r;
+  } test_vec[] = {
+    { SIMDE_FLOAT32_C(         -7.31), SIMDE_FLOAT32_C(          6.95), SIMDE_FLOAT32_C(     52.804497) },
+    { SIMDE_FLOAT32_C(          5.28), SIMDE_FLOAT32_C(         -4.90), SIMDE_FLOAT32_C(     27.872002) },
+    { SIMDE_FLOAT32_C(         -0.09), SIMDE_FLOAT32_C(         -1.01), SIMDE_FLOAT32_C(      1.909100) },
+    { SIMDE_FLOAT32_C(          3.03), SIMDE_FLOAT32_C(          5.77), SIMDE_FLOAT32_C(    -15.483100) },
+    { SIMDE_FLOAT32_C(         -8.12), SIMDE_FLOAT32_C(         -9.43), SIMDE_FLOAT32_C(    -74.571602) },
+    { SIMDE_FLOAT32_C(          6.72), SIMDE_FLOAT32_C(         -1.34), SIMDE_FLOAT32_C(     11.004800) },
+    { SIMDE_FLOAT32_C(          5.25), SIMDE_FLOAT32_C(         -9.96), SIMDE_FLOAT32_C(     54.290001) },
+    { SIMDE_FLOAT32_C(         -1.09), SIMDE_FLOAT32_C(          4.43), SIMDE_FLOAT32_C(      6.828700) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32_t r = simde_vrecpss_f32(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_f32(r, test_vec[i].r, 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vrecpsd_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64_t a;
+    simde_float64_t b;
+    simde_float64_t r;
+  } test_vec[] = {
+    { SIMDE_FLOAT64_C(         -5.42), SIMDE_FLOAT64_C(          8.91), SIMDE_FLOAT64_C(     50.292200) },
+    { SIMDE_FLOAT64_C(          8.03), SIMDE_FLOAT64_C(         -9.39), SIMDE_FLOAT64_C(     77.401700) },
+    { SIMDE_FLOAT64_C(         -9.49), SIMDE_FLOAT64_C(          0.83), SIMDE_FLOAT64_C(      9.876700) },
+    { SIMDE_FLOAT64_C(          8.78), SIMDE_FLOAT64_C(         -2.38), SIMDE_FLOAT64_C(     22.896400) },
+    { SIMDE_FLOAT64_C(         -5.67), SIMDE_FLOAT64_C(         -1.56), SIMDE_FLOAT64_C(     -6.845200) },
+    { SIMDE_FLOAT64_C(         -9.42), SIMDE_FLOAT64_C(         -5.57), SIMDE_FLOAT64_C(    -50.469400) },
+    { SIMDE_FLOAT64_C(         -1.24), SIMDE_FLOAT64_C(         -0.08), SIMDE_FLOAT64_C(      1.900800) },
+    { SIMDE_FLOAT64_C(         -5.34), SIMDE_FLOAT64_C(         -5.38), SIMDE_FLOAT64_C(    -26.729200) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64_t r = simde_vrecpsd_f64(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_f64(r, test_vec[i].r, 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vrecps_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 b[2];
+    simde_float32 r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {            SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(          0.00) },
+      { SIMDE_FLOAT32_C(          0.00),           -SIMDE_MATH_INFINITYF },
+      { SIMDE_FLOAT32_C(      2.000000), SIMDE_FLOAT32_C(      2.000000) } },
+    #endif
+    { { SIMDE_FLOAT32_C(         -5.62), SIMDE_FLOAT32_C(         -0.81) },
+      { SIMDE_FLOAT32_C(         -4.20), SIMDE_FLOAT32_C(         -9.57) },
+      { SIMDE_FLOAT32_C(    -21.603998), SIMDE_FLOAT32_C(     -5.751700) } },
+    { { SIMDE_FLOAT32_C(          6.75), SIMDE_FLOAT32_C(          1.13) },
+      { SIMDE_FLOAT32_C(          2.85), SIMDE_FLOAT32_C(         -6.28) },
+      { SIMDE_FLOAT32_C(    -17.237499), SIMDE_FLOAT32_C(      9.096400) } },
+    { { SIMDE_FLOAT32_C(          9.85), SIMDE_FLOAT32_C(          7.20) },
+      { SIMDE_FLOAT32_C(         -7.58), SIMDE_FLOAT32_C(         -3.35) },
+      { SIMDE_FLOAT32_C(     76.663002), SIMDE_FLOAT32_C(     26.119999) } },
+    { { SIMDE_FLOAT32_C(          4.43), SIMDE_FLOAT32_C(          4.22) },
+      { SIMDE_FLOAT32_C(          8.73), SIMDE_FLOAT32_C(         -1.56) },
+      { SIMDE_FLOAT32_C(    -36.673897), SIMDE_FLOAT32_C(      8.583200) } },
+    { { SIMDE_FLOAT32_C(          6.60), SIMDE_FLOAT32_C(          3.41) },
+      { SIMDE_FLOAT32_C(         -3.93), SIMDE_FLOAT32_C(          1.75) },
+      { SIMDE_FLOAT32_C(     27.938000), SIMDE_FLOAT32_C(     -3.967500) } },
+    { { SIMDE_FLOAT32_C(          7.65), SIMDE_FLOAT32_C(          6.92) },
+      { SIMDE_FLOAT32_C(          0.11), SIMDE_FLOAT32_C(          1.78) },
+      { SIMDE_FLOAT32_C(      1.158500), SIMDE_FLOAT32_C(    -10.317600) } },
+    { { SIMDE_FLOAT32_C(         -9.31), SIMDE_FLOAT32_C(         -5.15) },
+      { SIMDE_FLOAT32_C(          5.95), SIMDE_FLOAT32_C(         -1.71) },
+      { SIMDE_FLOAT32_C(     57.394501), SIMDE_FLOAT32_C(     -6.806500) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32x2_t b = simde_vld1_f32(test_vec[i].b);
+    simde_float32x2_t r = simde_vrecps_f32(a, b);
+
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vrecps_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[1];
+    simde_float64 b[1];
+    simde_float64 r[1];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {             SIMDE_MATH_INFINITY },
+      { SIMDE_FLOAT64_C(          0.00) },
+      { SIMDE_FLOAT64_C(      2.000000) } },
+    #endif
+    { { SIMDE_FLOAT64_C(         -6.54) },
+      { SIMDE_FLOAT64_C(          0.98) },
+      { SIMDE_FLOAT64_C(      8.409200) } },
+    { { SIMDE_FLOAT64_C(          4.06) },
+      { SIMDE_FLOAT64_C(          3.49) },
+      { SIMDE_FLOAT64_C(    -12.169400) } },
+    { { SIMDE_FLOAT64_C(         -2.51) },
+      { SIMDE_FLOAT64_C(         -1.22) },
+      { SIMDE_FLOAT64_C(     -1.062200) } },
+    { { SIMDE_FLOAT64_C(          0.17) },
+      { SIMDE_FLOAT64_C(          5.57) },
+      { SIMDE_FLOAT64_C(      1.053100) } },
+    { { SIMDE_FLOAT64_C(          0.42) },
+      { SIMDE_FLOAT64_C(         -2.13) },
+      { SIMDE_FLOAT64_C(      2.894600) } },
+    { { SIMDE_FLOAT64_C(         -0.21) },
+      { SIMDE_FLOAT64_C(         -9.41) },
+      { SIMDE_FLOAT64_C(      0.023900) } },
+    { { SIMDE_FLOAT64_C(         -9.13) },
+      { SIMDE_FLOAT64_C(          4.07) },
+      { SIMDE_FLOAT64_C(     39.159100) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_float64x1_t b = simde_vld1_f64(test_vec[i].b);
+    simde_float64x1_t r = simde_vrecps_f64(a, b);
+
+    simde_test_arm_neon_assert_equal_f64x1(r, simde_vld1_f64(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vrecpsq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 b[4];
+    simde_float32 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {            SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(          0.00), SIMDE_FLOAT32_C(          9.66), SIMDE_FLOAT32_C(          1.86) },
+      { SIMDE_FLOAT32_C(          0.00),           -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(         -2.13), SIMDE_FLOAT32_C(         -6.59) },
+      { SIMDE_FLOAT32_C(      2.000000), SIMDE_FLOAT32_C(      2.000000), SIMDE_FLOAT32_C(     22.575800), SIMDE_FLOAT32_C(     14.257401) } },
+    #endif
+    { { SIMDE_FLOAT32_C(          0.04), SIMDE_FLOAT32_C(          9.64), SIMDE_FLOAT32_C(          5.41), SIMDE_FLOAT32_C(          0.79) },
+      { SIMDE_FLOAT32_C(          7.21), SIMDE_FLOAT32_C(         -5.36), SIMDE_FLOAT32_C(          0.28), SIMDE_FLOAT32_C(          9.05) },
+      { SIMDE_FLOAT32_C(      1.711600), SIMDE_FLOAT32_C(     53.670403), SIMDE_FLOAT32_C(      0.485200), SIMDE_FLOAT32_C(     -5.149500) } },
+    { { SIMDE_FLOAT32_C(          1.56), SIMDE_FLOAT32_C(         -0.82), SIMDE_FLOAT32_C(         -4.61), SIMDE_FLOAT32_C(          0.96) },
+      { SIMDE_FLOAT32_C(          9.14), SIMDE_FLOAT32_C(         -9.89), SIMDE_FLOAT32_C(          5.67), SIMDE_FLOAT32_C(          6.41) },
+      { SIMDE_FLOAT32_C(    -12.258400), SIMDE_FLOAT32_C(     -6.109800), SIMDE_FLOAT32_C(     28.138700), SIMDE_FLOAT32_C(     -4.153600) } },
+    { { SIMDE_FLOAT32_C(          7.72), SIMDE_FLOAT32_C(          4.81), SIMDE_FLOAT32_C(          6.18), SIMDE_FLOAT32_C(          0.37) },
+      { SIMDE_FLOAT32_C(          1.23), SIMDE_FLOAT32_C(         -1.48), SIMDE_FLOAT32_C(         -8.88), SIMDE_FLOAT32_C(          7.40) },
+      { SIMDE_FLOAT32_C(     -7.495600), SIMDE_FLOAT32_C(      9.118800), SIMDE_FLOAT32_C(     56.878399), SIMDE_FLOAT32_C(     -0.738000) } },
+    { { SIMDE_FLOAT32_C(          1.40), SIMDE_FLOAT32_C(         -6.00), SIMDE_FLOAT32_C(          0.09), SIMDE_FLOAT32_C(         -0.30) },
+      { SIMDE_FLOAT32_C(         -2.86), SIMDE_FLOAT32_C(         -3.08), SIMDE_FLOAT32_C(          0.77), SIMDE_FLOAT32_C(          2.47) },
+      { SIMDE_FLOAT32_C(      6.004000), SIMDE_FLOAT32_C(    -16.480000), SIMDE_FLOAT32_C(      1.930700), SIMDE_FLOAT32_C(      2.741000) } },
+    { { SIMDE_FLOAT32_C(          2.25), SIMDE_FLOAT32_C(         -0.84), SIMDE_FLOAT32_C(         -9.44), SIMDE_FLOAT32_C(         -5.41) },
+      { SIMDE_FLOAT32_C(         -6.46), SIMDE_FLOAT32_C(          1.69), SIMDE_FLOAT32_C(          7.22), SIMDE_FLOAT32_C(          5.97) },
+      { SIMDE_FLOAT32_C(     16.535000), SIMDE_FLOAT32_C(      3.419600), SIMDE_FLOAT32_C(     70.156792), SIMDE_FLOAT32_C(     34.297699) } },
+    { { SIMDE_FLOAT32_C(          5.94), SIMDE_FLOAT32_C(          6.33), SIMDE_FLOAT32_C(         -4.89), SIMDE_FLOAT32_C(          6.83) },
+      { SIMDE_FLOAT32_C(          3.46), SIMDE_FLOAT32_C(         -8.34), SIMDE_FLOAT32_C(         -9.67), SIMDE_FLOAT32_C(         -9.71) },
+      { SIMDE_FLOAT32_C(    -18.552401), SIMDE_FLOAT32_C(     54.792202), SIMDE_FLOAT32_C(    -45.286301), SIMDE_FLOAT32_C(     68.319298) } },
+    { { SIMDE_FLOAT32_C(          5.11), SIMDE_FLOAT32_C(         -5.01), SIMDE_FLOAT32_C(         -7.81), SIMDE_FLOAT32_C(          2.50) },
+      { SIMDE_FLOAT32_C(         -3.11), SIMDE_FLOAT32_C(         -8.61), SIMDE_FLOAT32_C(         -6.81), SIMDE_FLOAT32_C(          0.55) },
+      { SIMDE_FLOAT32_C(     17.892099), SIMDE_FLOAT32_C(    -41.136101), SIMDE_FLOAT32_C(    -51.186100), SIMDE_FLOAT32_C(      0.625000) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32x4_t b = simde_vld1q_f32(test_vec[i].b);
+    simde_float32x4_t r = simde_vrecpsq_f32(a, b);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vrecpsq_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 b[2];
+    simde_float64 r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {             SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(          0.00) },
+      { SIMDE_FLOAT64_C(          0.00),            -SIMDE_MATH_INFINITY },
+      { SIMDE_FLOAT64_C(      2.000000), SIMDE_FLOAT64_C(      2.000000) } },
+    #endif
+    { { SIMDE_FLOAT64_C(         -6.64), SIMDE_FLOAT64_C(         -4.54) },
+      { SIMDE_FLOAT64_C(          4.23), SIMDE_FLOAT64_C(         -0.91) },
+      { SIMDE_FLOAT64_C(     30.087200), SIMDE_FLOAT64_C(     -2.131400) } },
+    { { SIMDE_FLOAT64_C(         -3.56), SIMDE_FLOAT64_C(         -0.52) },
+      { SIMDE_FLOAT64_C(         -9.53), SIMDE_FLOAT64_C(         -2.27) },
+      { SIMDE_FLOAT64_C(    -31.926800), SIMDE_FLOAT64_C(      0.819600) } },
+    { { SIMDE_FLOAT64_C(         -1.58), SIMDE_FLOAT64_C(         -6.24) },
+      { SIMDE_FLOAT64_C(         -7.82), SIMDE_FLOAT64_C(          8.00) },
+      { SIMDE_FLOAT64_C(    -10.355600), SIMDE_FLOAT64_C(     51.920000) } },
+    { { SIMDE_FLOAT64_C(          0.20), SIMDE_FLOAT64_C(         -5.82) },
+      { SIMDE_FLOAT64_C(          2.11), SIMDE_FLOAT64_C(          6.34) },
+      { SIMDE_FLOAT64_C(      1.578000), SIMDE_FLOAT64_C(     38.898800) } },
+    { { SIMDE_FLOAT64_C(         -9.58), SIMDE_FLOAT64_C(         -9.64) },
+      { SIMDE_FLOAT64_C(         -7.07), SIMDE_FLOAT64_C(          4.38) },
+      { SIMDE_FLOAT64_C(    -65.730600), SIMDE_FLOAT64_C(     44.223200) } },
+    { { SIMDE_FLOAT64_C(         -6.80), SIMDE_FLOAT64_C(          4.09) },
+      { SIMDE_FLOAT64_C(          3.56), SIMDE_FLOAT64_C(          0.89) },
+      { SIMDE_FLOAT64_C(     26.208000), SIMDE_FLOAT64_C(     -1.640100) } },
+    { { SIMDE_FLOAT64_C(         -5.59), SIMDE_FLOAT64_C(          9.51) },
+      { SIMDE_FLOAT64_C(          5.96), SIMDE_FLOAT64_C(          0.33) },
+      { SIMDE_FLOAT64_C(     35.316400), SIMDE_FLOAT64_C(     -1.138300) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64x2_t b = simde_vld1q_f64(test_vec[i].b);
+    simde_float64x2_t r = simde_vrecpsq_f64(a, b);
+
+    simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vrecpss_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrecpsd_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrecps_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrecps_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrecpsq_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrecpsq_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
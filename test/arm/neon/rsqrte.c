@@ -0,0 +1,285 @@
+#define SIMDE_TEST_ARM_NEON_INSN rsqrte
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/rsqrte.h"
+
+static int
+test_simde_vrsqrtes_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32_t a;
+    simde_float32_t r;
+  } test_vec[] = {
+    { SIMDE_FLOAT32_C(         13.65), SIMDE_FLOAT32_C(    0.27050781) },
+    { SIMDE_FLOAT32_C(         84.78), SIMDE_FLOAT32_C(    0.10864258) },
+    { SIMDE_FLOAT32_C(         76.44), SIMDE_FLOAT32_C(    0.11450195) },
+    { SIMDE_FLOAT32_C(         25.69), SIMDE_FLOAT32_C(    0.19726562) },
+    { SIMDE_FLOAT32_C(         49.67), SIMDE_FLOAT32_C(    0.14208984) },
+    { SIMDE_FLOAT32_C(         45.09), SIMDE_FLOAT32_C(    0.14892578) },
+    { SIMDE_FLOAT32_C(         65.25), SIMDE_FLOAT32_C(    0.12377930) },
+    { SIMDE_FLOAT32_C(         78.93), SIMDE_FLOAT32_C(    0.11279297) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32_t r = simde_vrsqrtes_f32(test_vec[i].a);
+    simde_assert_equal_f32(r, test_vec[i].r, 6);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vrsqrted_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64_t a;
+    simde_float64_t r;
+  } test_vec[] = {
+    { SIMDE_FLOAT64_C(          9.61), SIMDE_FLOAT64_C(    0.32324219) },
+    { SIMDE_FLOAT64_C(          3.08), SIMDE_FLOAT64_C(    0.56835938) },
+    { SIMDE_FLOAT64_C(         83.62), SIMDE_FLOAT64_C(    0.10937500) },
+    { SIMDE_FLOAT64_C(         43.42), SIMDE_FLOAT64_C(    0.15185547) },
+    { SIMDE_FLOAT64_C(         76.29), SIMDE_FLOAT64_C(    0.11450195) },
+    { SIMDE_FLOAT64_C(          0.46), SIMDE_FLOAT64_C(    1.47265625) },
+    { SIMDE_FLOAT64_C(         44.68), SIMDE_FLOAT64_C(    0.14990234) },
+    { SIMDE_FLOAT64_C(         72.22), SIMDE_FLOAT64_C(    0.11767578) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64_t r = simde_vrsqrted_f64(test_vec[i].a);
+    simde_assert_equal_f64(r, test_vec[i].r, 6);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vrsqrte_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { { SIMDE_FLOAT32_C(          0.00),            SIMDE_MATH_INFINITYF },
+      {            SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    0.00000000) } },
+    #endif
+    { { SIMDE_FLOAT32_C(         23.07), SIMDE_FLOAT32_C(         94.54) },
+      { SIMDE_FLOAT32_C(    0.20800781), SIMDE_FLOAT32_C(    0.10278320) } },
+    { { SIMDE_FLOAT32_C(         90.17), SIMDE_FLOAT32_C(          3.30) },
+      { SIMDE_FLOAT32_C(    0.10522461), SIMDE_FLOAT32_C(    0.55078125) } },
+    { { SIMDE_FLOAT32_C(          2.79), SIMDE_FLOAT32_C(         54.26) },
+      { SIMDE_FLOAT32_C(    0.59960938), SIMDE_FLOAT32_C(    0.13574219) } },
+    { { SIMDE_FLOAT32_C(         93.93), SIMDE_FLOAT32_C(         38.28) },
+      { SIMDE_FLOAT32_C(    0.10327148), SIMDE_FLOAT32_C(    0.16162109) } },
+    { { SIMDE_FLOAT32_C(         21.86), SIMDE_FLOAT32_C(         42.36) },
+      { SIMDE_FLOAT32_C(    0.21435547), SIMDE_FLOAT32_C(    0.15380859) } },
+    { { SIMDE_FLOAT32_C(          3.15), SIMDE_FLOAT32_C(         22.36) },
+      { SIMDE_FLOAT32_C(    0.56445312), SIMDE_FLOAT32_C(    0.21191406) } },
+    { { SIMDE_FLOAT32_C(         43.93), SIMDE_FLOAT32_C(         49.71) },
+      { SIMDE_FLOAT32_C(    0.15087891), SIMDE_FLOAT32_C(    0.14208984) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32x2_t r = simde_vrsqrte_f32(a);
+
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 6);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vrsqrte_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[1];
+    simde_float64 r[1];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { { SIMDE_FLOAT64_C(         -2.00) },
+      {                  SIMDE_MATH_NAN } },
+    #endif
+    { { SIMDE_FLOAT64_C(         23.50) },
+      { SIMDE_FLOAT64_C(    0.20605469) } },
+    { { SIMDE_FLOAT64_C(         23.28) },
+      { SIMDE_FLOAT64_C(    0.20703125) } },
+    { { SIMDE_FLOAT64_C(         22.07) },
+      { SIMDE_FLOAT64_C(    0.21289062) } },
+    { { SIMDE_FLOAT64_C(         46.10) },
+      { SIMDE_FLOAT64_C(    0.14746094) } },
+    { { SIMDE_FLOAT64_C(         29.16) },
+      { SIMDE_FLOAT64_C(    0.18505859) } },
+    { { SIMDE_FLOAT64_C(          2.39) },
+      { SIMDE_FLOAT64_C(    0.64843750) } },
+    { { SIMDE_FLOAT64_C(         83.80) },
+      { SIMDE_FLOAT64_C(    0.10937500) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_float64x1_t r = simde_vrsqrte_f64(a);
+
+    simde_test_arm_neon_assert_equal_f64x1(r, simde_vld1_f64(test_vec[i].r), 6);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vrsqrte_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a[2];
+    uint32_t r[2];
+  } test_vec[] = {
+    { { UINT32_C(2389953095), UINT32_C( 429497919) },
+      { UINT32_C(2877292544), UINT32_C(4294967295) } },
+    { { UINT32_C(4262941488), UINT32_C( 199245232) },
+      { UINT32_C(2155872256), UINT32_C(4294967295) } },
+    { { UINT32_C(1428914934), UINT32_C(4180086606) },
+      { UINT32_C(3724541952), UINT32_C(2172649472) } },
+    { { UINT32_C(4021981692), UINT32_C(2180628982) },
+      { UINT32_C(2222981120), UINT32_C(3019898880) } },
+    { { UINT32_C( 731456842), UINT32_C(1220455187) },
+      { UINT32_C(4294967295), UINT32_C(4026531840) } },
+    { { UINT32_C(3790218436), UINT32_C(4041192613) },
+      { UINT32_C(2290089984), UINT32_C(2214592512) } },
+    { { UINT32_C(2529745433), UINT32_C( 988817340) },
+      { UINT32_C(2801795072), UINT32_C(4294967295) } },
+    { { UINT32_C(3424825176), UINT32_C( 707568047) },
+      { UINT32_C(2399141888), UINT32_C(4294967295) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x2_t a = simde_vld1_u32(test_vec[i].a);
+    simde_uint32x2_t r = simde_vrsqrte_u32(a);
+
+    simde_test_arm_neon_assert_equal_u32x2(r, simde_vld1_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vrsqrteq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { { SIMDE_FLOAT32_C(          0.00),            SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(         -1.00), SIMDE_FLOAT32_C(          4.00) },
+      {            SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    0.00000000),                 SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    0.49902344) } },
+    #endif
+    { { SIMDE_FLOAT32_C(         54.99), SIMDE_FLOAT32_C(         70.38), SIMDE_FLOAT32_C(         67.53), SIMDE_FLOAT32_C(         37.63) },
+      { SIMDE_FLOAT32_C(    0.13476562), SIMDE_FLOAT32_C(    0.11938477), SIMDE_FLOAT32_C(    0.12158203), SIMDE_FLOAT32_C(    0.16308594) } },
+    { { SIMDE_FLOAT32_C(         44.04), SIMDE_FLOAT32_C(         50.97), SIMDE_FLOAT32_C(         77.90), SIMDE_FLOAT32_C(         52.21) },
+      { SIMDE_FLOAT32_C(    0.15039062), SIMDE_FLOAT32_C(    0.14013672), SIMDE_FLOAT32_C(    0.11352539), SIMDE_FLOAT32_C(    0.13867188) } },
+    { { SIMDE_FLOAT32_C(         39.48), SIMDE_FLOAT32_C(         49.10), SIMDE_FLOAT32_C(          3.20), SIMDE_FLOAT32_C(          4.59) },
+      { SIMDE_FLOAT32_C(    0.15917969), SIMDE_FLOAT32_C(    0.14257812), SIMDE_FLOAT32_C(    0.55859375), SIMDE_FLOAT32_C(    0.46777344) } },
+    { { SIMDE_FLOAT32_C(         70.41), SIMDE_FLOAT32_C(         98.32), SIMDE_FLOAT32_C(         59.42), SIMDE_FLOAT32_C(         39.51) },
+      { SIMDE_FLOAT32_C(    0.11938477), SIMDE_FLOAT32_C(    0.10083008), SIMDE_FLOAT32_C(    0.12988281), SIMDE_FLOAT32_C(    0.15869141) } },
+    { { SIMDE_FLOAT32_C(         17.24), SIMDE_FLOAT32_C(         50.35), SIMDE_FLOAT32_C(         98.21), SIMDE_FLOAT32_C(         77.11) },
+      { SIMDE_FLOAT32_C(    0.24121094), SIMDE_FLOAT32_C(    0.14111328), SIMDE_FLOAT32_C(    0.10083008), SIMDE_FLOAT32_C(    0.11376953) } },
+    { { SIMDE_FLOAT32_C(         54.08), SIMDE_FLOAT32_C(         86.06), SIMDE_FLOAT32_C(         23.41), SIMDE_FLOAT32_C(         51.50) },
+      { SIMDE_FLOAT32_C(    0.13574219), SIMDE_FLOAT32_C(    0.10766602), SIMDE_FLOAT32_C(    0.20654297), SIMDE_FLOAT32_C(    0.13916016) } },
+    { { SIMDE_FLOAT32_C(         95.26), SIMDE_FLOAT32_C(         57.89), SIMDE_FLOAT32_C(         46.05), SIMDE_FLOAT32_C(         27.11) },
+      { SIMDE_FLOAT32_C(    0.10253906), SIMDE_FLOAT32_C(    0.13134766), SIMDE_FLOAT32_C(    0.14746094), SIMDE_FLOAT32_C(    0.19238281) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32x4_t r = simde_vrsqrteq_f32(a);
+
+    #if defined(SIMDE_FAST_MATH)
+      simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 2);
+    #else
+      simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 6);
+    #endif
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vrsqrteq_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { { SIMDE_FLOAT64_C(          0.00),             SIMDE_MATH_INFINITY },
+      {             SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(    0.00000000) } },
+    #endif
+    { { SIMDE_FLOAT64_C(         54.91), SIMDE_FLOAT64_C(         95.72) },
+      { SIMDE_FLOAT64_C(    0.13476562), SIMDE_FLOAT64_C(    0.10229492) } },
+    { { SIMDE_FLOAT64_C(          0.82), SIMDE_FLOAT64_C(         78.42) },
+      { SIMDE_FLOAT64_C(    1.10546875), SIMDE_FLOAT64_C(    0.11303711) } },
+    { { SIMDE_FLOAT64_C(         82.09), SIMDE_FLOAT64_C(         88.65) },
+      { SIMDE_FLOAT64_C(    0.11035156), SIMDE_FLOAT64_C(    0.10620117) } },
+    { { SIMDE_FLOAT64_C(         74.12), SIMDE_FLOAT64_C(         80.96) },
+      { SIMDE_FLOAT64_C(    0.11596680), SIMDE_FLOAT64_C(    0.11132812) } },
+    { { SIMDE_FLOAT64_C(         51.99), SIMDE_FLOAT64_C(         56.25) },
+      { SIMDE_FLOAT64_C(    0.13867188), SIMDE_FLOAT64_C(    0.13330078) } },
+    { { SIMDE_FLOAT64_C(         42.75), SIMDE_FLOAT64_C(          5.85) },
+      { SIMDE_FLOAT64_C(    0.15283203), SIMDE_FLOAT64_C(    0.41308594) } },
+    { { SIMDE_FLOAT64_C(         87.03), SIMDE_FLOAT64_C(         57.11) },
+      { SIMDE_FLOAT64_C(    0.10717773), SIMDE_FLOAT64_C(    0.13232422) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64x2_t r = simde_vrsqrteq_f64(a);
+
+    #if defined(SIMDE_FAST_MATH)
+      simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 2);
+    #else
+      simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 6);
+    #endif
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vrsqrteq_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C( 858303752), UINT32_C(1775539677), UINT32_C(1532401219), UINT32_C(   6806440) },
+      { UINT32_C(4294967295), UINT32_C(3338665984), UINT32_C(3598712832), UINT32_C(4294967295) } },
+    { { UINT32_C(2677866793), UINT32_C(1422224538), UINT32_C( 120151618), UINT32_C( 581414431) },
+      { UINT32_C(2717908992), UINT32_C(3732930560), UINT32_C(4294967295), UINT32_C(4294967295) } },
+    { { UINT32_C( 362756689), UINT32_C( 393425036), UINT32_C(3423507950), UINT32_C(3998399926) },
+      { UINT32_C(4294967295), UINT32_C(4294967295), UINT32_C(2399141888), UINT32_C(2222981120) } },
+    { { UINT32_C(3615266496), UINT32_C( 302595366), UINT32_C(  71685718), UINT32_C(3239029312) },
+      { UINT32_C(2340421632), UINT32_C(4294967295), UINT32_C(4294967295), UINT32_C(2466250752) } },
+    { { UINT32_C(1071848707), UINT32_C(3424324670), UINT32_C(1479284937), UINT32_C( 719279514) },
+      { UINT32_C(4294967295), UINT32_C(2399141888), UINT32_C(3657433088), UINT32_C(4294967295) } },
+    { { UINT32_C(2265081540), UINT32_C(2820318218), UINT32_C(3056255486), UINT32_C(3017753764) },
+      { UINT32_C(2952790016), UINT32_C(2650800128), UINT32_C(2541748224), UINT32_C(2566914048) } },
+    { { UINT32_C( 961089195), UINT32_C(1340050970), UINT32_C(1807831941), UINT32_C(  36167201) },
+      { UINT32_C(4294967295), UINT32_C(3850371072), UINT32_C(3313500160), UINT32_C(4294967295) } },
+    { { UINT32_C(3864691017), UINT32_C( 973833496), UINT32_C(2601241110), UINT32_C( 968744613) },
+      { UINT32_C(2264924160), UINT32_C(4294967295), UINT32_C(2751463424), UINT32_C(4294967295) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t a = simde_vld1q_u32(test_vec[i].a);
+    simde_uint32x4_t r = simde_vrsqrteq_u32(a);
+
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vrsqrtes_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrsqrted_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrsqrte_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrsqrte_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrsqrte_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrsqrteq_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrsqrteq_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrsqrteq_u32)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,249 @@
+#define SIMDE_TEST_ARM_NEON_INSN rsqrts
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/rsqrts.h"
+
+static int
+test_simde_vrsqrtss_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32_t a;
+    simde_float32_t b;
+    simde_float32_t r;
+  } test_vec[] = {
+    { SIMDE_FLOAT32_C(         -7.31), SIMDE_FLOAT32_C(          6.95), SIMDE_FLOAT32_C(     26.902248) },
+    { SIMDE_FLOAT32_C(          5.28), SIMDE_FLOAT32_C(         -4.90), SIMDE_FLOAT32_C(     14.436001) },
+    { SIMDE_FLOAT32_C(         -0.09), SIMDE_FLOAT32_C(         -1.01), SIMDE_FLOAT32_C(      1.454550) },
+    { SIMDE_FLOAT32_C(          3.03), SIMDE_FLOAT32_C(          5.77), SIMDE_FLOAT32_C(     -7.241550) },
+    { SIMDE_FLOAT32_C(         -8.12), SIMDE_FLOAT32_C(         -9.43), SIMDE_FLOAT32_C(    -36.785801) },
+    { SIMDE_FLOAT32_C(          6.72), SIMDE_FLOAT32_C(         -1.34), SIMDE_FLOAT32_C(      6.002400) },
+    { SIMDE_FLOAT32_C(          5.25), SIMDE_FLOAT32_C(         -9.96), SIMDE_FLOAT32_C(     27.645000) },
+    { SIMDE_FLOAT32_C(         -1.09), SIMDE_FLOAT32_C(          4.43), SIMDE_FLOAT32_C(      3.914350) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32_t r = simde_vrsqrtss_f32(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_f32(r, test_vec[i].r, 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vrsqrtsd_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64_t a;
+    simde_float64_t b;
+    simde_float64_t r;
+  } test_vec[] = {
+    { SIMDE_FLOAT64_C(         -5.42), SIMDE_FLOAT64_C(          8.91), SIMDE_FLOAT64_C(     25.646100) },
+    { SIMDE_FLOAT64_C(          8.03), SIMDE_FLOAT64_C(         -9.39), SIMDE_FLOAT64_C(     39.200850) },
+    { SIMDE_FLOAT64_C(         -9.49), SIMDE_FLOAT64_C(          0.83), SIMDE_FLOAT64_C(      5.438350) },
+    { SIMDE_FLOAT64_C(          8.78), SIMDE_FLOAT64_C(         -2.38), SIMDE_FLOAT64_C(     11.948200) },
+    { SIMDE_FLOAT64_C(         -5.67), SIMDE_FLOAT64_C(         -1.56), SIMDE_FLOAT64_C(     -2.922600) },
+    { SIMDE_FLOAT64_C(         -9.42), SIMDE_FLOAT64_C(         -5.57), SIMDE_FLOAT64_C(    -24.734700) },
+    { SIMDE_FLOAT64_C(         -1.24), SIMDE_FLOAT64_C(         -0.08), SIMDE_FLOAT64_C(      1.450400) },
+    { SIMDE_FLOAT64_C(         -5.34), SIMDE_FLOAT64_C(         -5.38), SIMDE_FLOAT64_C(    -12.864600) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64_t r = simde_vrsqrtsd_f64(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_f64(r, test_vec[i].r, 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vrsqrts_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[2];
+    simde_float32 b[2];
+    simde_float32 r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {            SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(          0.00) },
+      { SIMDE_FLOAT32_C(          0.00),           -SIMDE_MATH_INFINITYF },
+      { SIMDE_FLOAT32_C(      1.500000), SIMDE_FLOAT32_C(      1.500000) } },
+    #endif
+    { { SIMDE_FLOAT32_C(         -5.62), SIMDE_FLOAT32_C(         -0.81) },
+      { SIMDE_FLOAT32_C(         -4.20), SIMDE_FLOAT32_C(         -9.57) },
+      { SIMDE_FLOAT32_C(    -10.301999), SIMDE_FLOAT32_C(     -2.375850) } },
+    { { SIMDE_FLOAT32_C(          6.75), SIMDE_FLOAT32_C(          1.13) },
+      { SIMDE_FLOAT32_C(          2.85), SIMDE_FLOAT32_C(         -6.28) },
+      { SIMDE_FLOAT32_C(     -8.118750), SIMDE_FLOAT32_C(      5.048200) } },
+    { { SIMDE_FLOAT32_C(          9.85), SIMDE_FLOAT32_C(          7.20) },
+      { SIMDE_FLOAT32_C(         -7.58), SIMDE_FLOAT32_C(         -3.35) },
+      { SIMDE_FLOAT32_C(     38.831501), SIMDE_FLOAT32_C(     13.559999) } },
+    { { SIMDE_FLOAT32_C(          4.43), SIMDE_FLOAT32_C(          4.22) },
+      { SIMDE_FLOAT32_C(          8.73), SIMDE_FLOAT32_C(         -1.56) },
+      { SIMDE_FLOAT32_C(    -17.836948), SIMDE_FLOAT32_C(      4.791600) } },
+    { { SIMDE_FLOAT32_C(          6.60), SIMDE_FLOAT32_C(          3.41) },
+      { SIMDE_FLOAT32_C(         -3.93), SIMDE_FLOAT32_C(          1.75) },
+      { SIMDE_FLOAT32_C(     14.469000), SIMDE_FLOAT32_C(     -1.483750) } },
+    { { SIMDE_FLOAT32_C(          7.65), SIMDE_FLOAT32_C(          6.92) },
+      { SIMDE_FLOAT32_C(          0.11), SIMDE_FLOAT32_C(          1.78) },
+      { SIMDE_FLOAT32_C(      1.079250), SIMDE_FLOAT32_C(     -4.658800) } },
+    { { SIMDE_FLOAT32_C(         -9.31), SIMDE_FLOAT32_C(         -5.15) },
+      { SIMDE_FLOAT32_C(          5.95), SIMDE_FLOAT32_C(         -1.71) },
+      { SIMDE_FLOAT32_C(     29.197250), SIMDE_FLOAT32_C(     -2.903250) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2_t a = simde_vld1_f32(test_vec[i].a);
+    simde_float32x2_t b = simde_vld1_f32(test_vec[i].b);
+    simde_float32x2_t r = simde_vrsqrts_f32(a, b);
+
+    simde_test_arm_neon_assert_equal_f32x2(r, simde_vld1_f32(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vrsqrts_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[1];
+    simde_float64 b[1];
+    simde_float64 r[1];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {             SIMDE_MATH_INFINITY },
+      { SIMDE_FLOAT64_C(          0.00) },
+      { SIMDE_FLOAT64_C(      1.500000) } },
+    #endif
+    { { SIMDE_FLOAT64_C(         -6.54) },
+      { SIMDE_FLOAT64_C(          0.98) },
+      { SIMDE_FLOAT64_C(      4.704600) } },
+    { { SIMDE_FLOAT64_C(          4.06) },
+      { SIMDE_FLOAT64_C(          3.49) },
+      { SIMDE_FLOAT64_C(     -5.584700) } },
+    { { SIMDE_FLOAT64_C(         -2.51) },
+      { SIMDE_FLOAT64_C(         -1.22) },
+      { SIMDE_FLOAT64_C(     -0.031100) } },
+    { { SIMDE_FLOAT64_C(          0.17) },
+      { SIMDE_FLOAT64_C(          5.57) },
+      { SIMDE_FLOAT64_C(      1.026550) } },
+    { { SIMDE_FLOAT64_C(          0.42) },
+      { SIMDE_FLOAT64_C(         -2.13) },
+      { SIMDE_FLOAT64_C(      1.947300) } },
+    { { SIMDE_FLOAT64_C(         -0.21) },
+      { SIMDE_FLOAT64_C(         -9.41) },
+      { SIMDE_FLOAT64_C(      0.511950) } },
+    { { SIMDE_FLOAT64_C(         -9.13) },
+      { SIMDE_FLOAT64_C(          4.07) },
+      { SIMDE_FLOAT64_C(     20.079550) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1_t a = simde_vld1_f64(test_vec[i].a);
+    simde_float64x1_t b = simde_vld1_f64(test_vec[i].b);
+    simde_float64x1_t r = simde_vrsqrts_f64(a, b);
+
+    simde_test_arm_neon_assert_equal_f64x1(r, simde_vld1_f64(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vrsqrtsq_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 a[4];
+    simde_float32 b[4];
+    simde_float32 r[4];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {            SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(          0.00), SIMDE_FLOAT32_C(          9.66), SIMDE_FLOAT32_C(          1.86) },
+      { SIMDE_FLOAT32_C(          0.00),           -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(         -2.13), SIMDE_FLOAT32_C(         -6.59) },
+      { SIMDE_FLOAT32_C(      1.500000), SIMDE_FLOAT32_C(      1.500000), SIMDE_FLOAT32_C(     11.787900), SIMDE_FLOAT32_C(      7.628700) } },
+    #endif
+    { { SIMDE_FLOAT32_C(          0.04), SIMDE_FLOAT32_C(          9.64), SIMDE_FLOAT32_C(          5.41), SIMDE_FLOAT32_C(          0.79) },
+      { SIMDE_FLOAT32_C(          7.21), SIMDE_FLOAT32_C(         -5.36), SIMDE_FLOAT32_C(          0.28), SIMDE_FLOAT32_C(          9.05) },
+      { SIMDE_FLOAT32_C(      1.355800), SIMDE_FLOAT32_C(     27.335201), SIMDE_FLOAT32_C(      0.742600), SIMDE_FLOAT32_C(     -2.074750) } },
+    { { SIMDE_FLOAT32_C(          1.56), SIMDE_FLOAT32_C(         -0.82), SIMDE_FLOAT32_C(         -4.61), SIMDE_FLOAT32_C(          0.96) },
+      { SIMDE_FLOAT32_C(          9.14), SIMDE_FLOAT32_C(         -9.89), SIMDE_FLOAT32_C(          5.67), SIMDE_FLOAT32_C(          6.41) },
+      { SIMDE_FLOAT32_C(     -5.629200), SIMDE_FLOAT32_C(     -2.554900), SIMDE_FLOAT32_C(     14.569350), SIMDE_FLOAT32_C(     -1.576800) } },
+    { { SIMDE_FLOAT32_C(          7.72), SIMDE_FLOAT32_C(          4.81), SIMDE_FLOAT32_C(          6.18), SIMDE_FLOAT32_C(          0.37) },
+      { SIMDE_FLOAT32_C(          1.23), SIMDE_FLOAT32_C(         -1.48), SIMDE_FLOAT32_C(         -8.88), SIMDE_FLOAT32_C(          7.40) },
+      { SIMDE_FLOAT32_C(     -3.247800), SIMDE_FLOAT32_C(      5.059400), SIMDE_FLOAT32_C(     28.939199), SIMDE_FLOAT32_C(      0.131000) } },
+    { { SIMDE_FLOAT32_C(          1.40), SIMDE_FLOAT32_C(         -6.00), SIMDE_FLOAT32_C(          0.09), SIMDE_FLOAT32_C(         -0.30) },
+      { SIMDE_FLOAT32_C(         -2.86), SIMDE_FLOAT32_C(         -3.08), SIMDE_FLOAT32_C(          0.77), SIMDE_FLOAT32_C(          2.47) },
+      { SIMDE_FLOAT32_C(      3.502000), SIMDE_FLOAT32_C(     -7.740000), SIMDE_FLOAT32_C(      1.465350), SIMDE_FLOAT32_C(      1.870500) } },
+    { { SIMDE_FLOAT32_C(          2.25), SIMDE_FLOAT32_C(         -0.84), SIMDE_FLOAT32_C(         -9.44), SIMDE_FLOAT32_C(         -5.41) },
+      { SIMDE_FLOAT32_C(         -6.46), SIMDE_FLOAT32_C(          1.69), SIMDE_FLOAT32_C(          7.22), SIMDE_FLOAT32_C(          5.97) },
+      { SIMDE_FLOAT32_C(      8.767500), SIMDE_FLOAT32_C(      2.209800), SIMDE_FLOAT32_C(     35.578396), SIMDE_FLOAT32_C(     17.648849) } },
+    { { SIMDE_FLOAT32_C(          5.94), SIMDE_FLOAT32_C(          6.33), SIMDE_FLOAT32_C(         -4.89), SIMDE_FLOAT32_C(          6.83) },
+      { SIMDE_FLOAT32_C(          3.46), SIMDE_FLOAT32_C(         -8.34), SIMDE_FLOAT32_C(         -9.67), SIMDE_FLOAT32_C(         -9.71) },
+      { SIMDE_FLOAT32_C(     -8.776200), SIMDE_FLOAT32_C(     27.896101), SIMDE_FLOAT32_C(    -22.143150), SIMDE_FLOAT32_C(     34.659649) } },
+    { { SIMDE_FLOAT32_C(          5.11), SIMDE_FLOAT32_C(         -5.01), SIMDE_FLOAT32_C(         -7.81), SIMDE_FLOAT32_C(          2.50) },
+      { SIMDE_FLOAT32_C(         -3.11), SIMDE_FLOAT32_C(         -8.61), SIMDE_FLOAT32_C(         -6.81), SIMDE_FLOAT32_C(          0.55) },
+      { SIMDE_FLOAT32_C(      9.446050), SIMDE_FLOAT32_C(    -20.068050), SIMDE_FLOAT32_C(    -25.093050), SIMDE_FLOAT32_C(      0.812500) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4_t a = simde_vld1q_f32(test_vec[i].a);
+    simde_float32x4_t b = simde_vld1q_f32(test_vec[i].b);
+    simde_float32x4_t r = simde_vrsqrtsq_f32(a, b);
+
+    simde_test_arm_neon_assert_equal_f32x4(r, simde_vld1q_f32(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vrsqrtsq_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 a[2];
+    simde_float64 b[2];
+    simde_float64 r[2];
+  } test_vec[] = {
+    #if !defined(SIMDE_FAST_NANS)
+    { {             SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(          0.00) },
+      { SIMDE_FLOAT64_C(          0.00),            -SIMDE_MATH_INFINITY },
+      { SIMDE_FLOAT64_C(      1.500000), SIMDE_FLOAT64_C(      1.500000) } },
+    #endif
+    { { SIMDE_FLOAT64_C(         -6.64), SIMDE_FLOAT64_C(         -4.54) },
+      { SIMDE_FLOAT64_C(          4.23), SIMDE_FLOAT64_C(         -0.91) },
+      { SIMDE_FLOAT64_C(     15.543600), SIMDE_FLOAT64_C(     -0.565700) } },
+    { { SIMDE_FLOAT64_C(         -3.56), SIMDE_FLOAT64_C(         -0.52) },
+      { SIMDE_FLOAT64_C(         -9.53), SIMDE_FLOAT64_C(         -2.27) },
+      { SIMDE_FLOAT64_C(    -15.463400), SIMDE_FLOAT64_C(      0.909800) } },
+    { { SIMDE_FLOAT64_C(         -1.58), SIMDE_FLOAT64_C(         -6.24) },
+      { SIMDE_FLOAT64_C(         -7.82), SIMDE_FLOAT64_C(          8.00) },
+      { SIMDE_FLOAT64_C(     -4.677800), SIMDE_FLOAT64_C(     26.460000) } },
+    { { SIMDE_FLOAT64_C(          0.20), SIMDE_FLOAT64_C(         -5.82) },
+      { SIMDE_FLOAT64_C(          2.11), SIMDE_FLOAT64_C(          6.34) },
+      { SIMDE_FLOAT64_C(      1.289000), SIMDE_FLOAT64_C(     19.949400) } },
+    { { SIMDE_FLOAT64_C(         -9.58), SIMDE_FLOAT64_C(         -9.64) },
+      { SIMDE_FLOAT64_C(         -7.07), SIMDE_FLOAT64_C(          4.38) },
+      { SIMDE_FLOAT64_C(    -32.365300), SIMDE_FLOAT64_C(     22.611600) } },
+    { { SIMDE_FLOAT64_C(         -6.80), SIMDE_FLOAT64_C(          4.09) },
+      { SIMDE_FLOAT64_C(          3.56), SIMDE_FLOAT64_C(          0.89) },
+      { SIMDE_FLOAT64_C(     13.604000), SIMDE_FLOAT64_C(     -0.320050) } },
+    { { SIMDE_FLOAT64_C(         -5.59), SIMDE_FLOAT64_C(          9.51) },
+      { SIMDE_FLOAT64_C(          5.96), SIMDE_FLOAT64_C(          0.33) },
+      { SIMDE_FLOAT64_C(     18.158200), SIMDE_FLOAT64_C(     -0.069150) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2_t a = simde_vld1q_f64(test_vec[i].a);
+    simde_float64x2_t b = simde_vld1q_f64(test_vec[i].b);
+    simde_float64x2_t r = simde_vrsqrtsq_f64(a, b);
+
+    simde_test_arm_neon_assert_equal_f64x2(r, simde_vld1q_f64(test_vec[i].r), 4);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vrsqrtss_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrsqrtsd_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrsqrts_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrsqrts_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrsqrtsq_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vrsqrtsq_f64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
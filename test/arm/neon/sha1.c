@@ -0,0 +1,295 @@
+#define SIMDE_TEST_ARM_NEON_INSN sha1
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/sha1.h"
+
+static int
+test_simde_vsha1h_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t hash_e;
+    uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(4032171012), UINT32_C(1008042753) },
+    { UINT32_C( 368245033), UINT32_C(1165803082) },
+    { UINT32_C(2072584227), UINT32_C(3739371528) },
+    { UINT32_C(1034053326), UINT32_C(2405996979) },
+    { UINT32_C(3585641670), UINT32_C(3043894065) },
+    { UINT32_C(2651606310), UINT32_C(2810385225) },
+    { UINT32_C(1574744923), UINT32_C(3614911702) },
+    { UINT32_C(3384003475), UINT32_C(4067226340) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_assert_equal_u32(simde_vsha1h_u32(test_vec[i].hash_e), test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsha1cq_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t hash_abcd[4];
+    uint32_t hash_e;
+    uint32_t wk[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(2810644043), UINT32_C(1145978366), UINT32_C(3344307874), UINT32_C(3880597820) },
+      UINT32_C( 786867337),
+      { UINT32_C(3592694048), UINT32_C(3909979004), UINT32_C(1471993776), UINT32_C( 843675890) },
+      { UINT32_C(3373959292), UINT32_C(3902728171), UINT32_C(2382419175), UINT32_C(4148996847) } },
+    { { UINT32_C( 578313870), UINT32_C( 673558692), UINT32_C( 702817077), UINT32_C(4161779576) },
+      UINT32_C(2322549219),
+      { UINT32_C(1005673292), UINT32_C(2829754040), UINT32_C(1845303879), UINT32_C(1350209065) },
+      { UINT32_C(3613794127), UINT32_C(2513362154), UINT32_C(2548474962), UINT32_C(3278284699) } },
+    { { UINT32_C(4037754526), UINT32_C( 961842133), UINT32_C( 896319914), UINT32_C(3255997109) },
+      UINT32_C(2830578892),
+      { UINT32_C(2476760165), UINT32_C(3078970029), UINT32_C(3296006626), UINT32_C( 334894131) },
+      { UINT32_C(3428642482), UINT32_C(4224154190), UINT32_C(2548509119), UINT32_C(3510730155) } },
+    { { UINT32_C(1100602365), UINT32_C( 488591670), UINT32_C(1348713996), UINT32_C(4216235546) },
+      UINT32_C(1643606256),
+      { UINT32_C(3550582582), UINT32_C(1862019809), UINT32_C(2865921049), UINT32_C(2069274705) },
+      { UINT32_C(1663900432), UINT32_C(2790146431), UINT32_C(4155351076), UINT32_C(2529562486) } },
+    { { UINT32_C(2712744000), UINT32_C(4126993884), UINT32_C(2109367731), UINT32_C(2438197203) },
+      UINT32_C(3906546650),
+      { UINT32_C(2470040868), UINT32_C( 104130444), UINT32_C(2746759590), UINT32_C(1218902504) },
+      { UINT32_C( 895971127), UINT32_C(3291359597), UINT32_C(2228525181), UINT32_C(1241324585) } },
+    { { UINT32_C(3598342456), UINT32_C(1228812258), UINT32_C(1942165744), UINT32_C(2753855790) },
+      UINT32_C( 956852237),
+      { UINT32_C(4034389127), UINT32_C(4165422075), UINT32_C(1065736754), UINT32_C(  95349942) },
+      { UINT32_C(  34912373), UINT32_C( 161798669), UINT32_C(  41786015), UINT32_C(3077799718) } },
+    { { UINT32_C( 472982560), UINT32_C(3011211694), UINT32_C(1042346128), UINT32_C( 205599683) },
+      UINT32_C(3671673205),
+      { UINT32_C(1690641947), UINT32_C(2660431999), UINT32_C( 389952504), UINT32_C( 625032632) },
+      { UINT32_C(2871673584), UINT32_C(2931124989), UINT32_C(2505339612), UINT32_C(  16308629) } },
+    { { UINT32_C(3857701615), UINT32_C(3044059471), UINT32_C( 438370370), UINT32_C(1753560125) },
+      UINT32_C(1782788641),
+      { UINT32_C( 246643322), UINT32_C(2835168503), UINT32_C(1366411893), UINT32_C(2248397867) },
+      { UINT32_C(3598493546), UINT32_C(3409548818), UINT32_C(  15505194), UINT32_C(1676003266) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t hash_abcd = simde_vld1q_u32(test_vec[i].hash_abcd);
+    simde_uint32x4_t wk = simde_vld1q_u32(test_vec[i].wk);
+    simde_uint32x4_t r = simde_vsha1cq_u32(hash_abcd, test_vec[i].hash_e, wk);
+
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsha1pq_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t hash_abcd[4];
+    uint32_t hash_e;
+    uint32_t wk[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(3667483681), UINT32_C(2188121097), UINT32_C(4083362341), UINT32_C(3044793906) },
+      UINT32_C(1667409731),
+      { UINT32_C( 624265126), UINT32_C(3349936574), UINT32_C(2655341403), UINT32_C(4006359043) },
+      { UINT32_C(3341744598), UINT32_C(4213481505), UINT32_C(3009866962), UINT32_C(2819499216) } },
+    { { UINT32_C(1067895824), UINT32_C( 457807108), UINT32_C(3839636212), UINT32_C( 820306921) },
+      UINT32_C( 995122436),
+      { UINT32_C(1435136847), UINT32_C(4104292415), UINT32_C(1419680436), UINT32_C( 541714987) },
+      { UINT32_C(3805866605), UINT32_C(2448676050), UINT32_C(3925390733), UINT32_C(3578357148) } },
+    { { UINT32_C(2746076863), UINT32_C( 329390474), UINT32_C(4235211682), UINT32_C(4180159500) },
+      UINT32_C( 848756102),
+      { UINT32_C(2764264535), UINT32_C(1191553090), UINT32_C( 293306762), UINT32_C(2206936354) },
+      { UINT32_C(2577480870), UINT32_C(3139657367), UINT32_C(1732924318), UINT32_C(1493404669) } },
+    { { UINT32_C(2073824258), UINT32_C(3137759719), UINT32_C(3540550374), UINT32_C( 637728867) },
+      UINT32_C( 494928185),
+      { UINT32_C(2421106162), UINT32_C(4240835957), UINT32_C(2667004511), UINT32_C(4269110495) },
+      { UINT32_C(3283188114), UINT32_C( 673687860), UINT32_C(2502777728), UINT32_C( 467087031) } },
+    { { UINT32_C(3310679029), UINT32_C( 912556821), UINT32_C(1522113285), UINT32_C(2519412957) },
+      UINT32_C(1374319477),
+      { UINT32_C(2390767832), UINT32_C(2476811615), UINT32_C( 307460812), UINT32_C(1614468515) },
+      { UINT32_C(2386929029), UINT32_C(2879618546), UINT32_C(1862977072), UINT32_C(2709509364) } },
+    { { UINT32_C( 581212967), UINT32_C(1922753096), UINT32_C(1969189011), UINT32_C(3338465240) },
+      UINT32_C(1722938892),
+      { UINT32_C(4181352261), UINT32_C(4155691246), UINT32_C(4256361227), UINT32_C(3543733754) },
+      { UINT32_C(1843456944), UINT32_C( 994600025), UINT32_C(2957835966), UINT32_C( 493768142) } },
+    { { UINT32_C( 748787928), UINT32_C(3881373811), UINT32_C(2324187610), UINT32_C(2755496540) },
+      UINT32_C(2331347668),
+      { UINT32_C( 619025814), UINT32_C(2369988682), UINT32_C(3407548453), UINT32_C( 846179981) },
+      { UINT32_C(2732360513), UINT32_C(1894715383), UINT32_C(1412992273), UINT32_C(  58639321) } },
+    { { UINT32_C(1410904947), UINT32_C(1391254878), UINT32_C( 269285707), UINT32_C(1698038763) },
+      UINT32_C( 381925267),
+      { UINT32_C( 831265825), UINT32_C( 787367766), UINT32_C(2089012901), UINT32_C(1476542225) },
+      { UINT32_C(2027822230), UINT32_C(3409167200), UINT32_C(3004711699), UINT32_C(1020205703) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t hash_abcd = simde_vld1q_u32(test_vec[i].hash_abcd);
+    simde_uint32x4_t wk = simde_vld1q_u32(test_vec[i].wk);
+    simde_uint32x4_t r = simde_vsha1pq_u32(hash_abcd, test_vec[i].hash_e, wk);
+
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsha1mq_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t hash_abcd[4];
+    uint32_t hash_e;
+    uint32_t wk[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(3900701139), UINT32_C( 954538859), UINT32_C(2836472406), UINT32_C(1052733920) },
+      UINT32_C( 678898874),
+      { UINT32_C(2259771451), UINT32_C(1077353017), UINT32_C(2263612732), UINT32_C(1572503562) },
+      { UINT32_C(2807904234), UINT32_C(2281983890), UINT32_C(1488179810), UINT32_C(1039613621) } },
+    { { UINT32_C(2082486862), UINT32_C(3548539873), UINT32_C(2588858417), UINT32_C( 135387013) },
+      UINT32_C( 849171615),
+      { UINT32_C( 371724217), UINT32_C(  80358059), UINT32_C(3613144436), UINT32_C(2841006832) },
+      { UINT32_C(4280980931), UINT32_C(1311657737), UINT32_C( 415987053), UINT32_C( 431219314) } },
+    { { UINT32_C(1568264846), UINT32_C(2615674470), UINT32_C( 790343394), UINT32_C(3099659395) },
+      UINT32_C(2326779294),
+      { UINT32_C(3117332516), UINT32_C( 173518048), UINT32_C( 513777912), UINT32_C(3060193082) },
+      { UINT32_C(1007775391), UINT32_C(1339486433), UINT32_C(3098837624), UINT32_C(3957357467) } },
+    { { UINT32_C( 615124861), UINT32_C(3819259061), UINT32_C( 489230284), UINT32_C( 253360694) },
+      UINT32_C( 187324238),
+      { UINT32_C(2253427667), UINT32_C(1020107493), UINT32_C(3994489066), UINT32_C(4035849256) },
+      { UINT32_C(3011772568), UINT32_C( 803510267), UINT32_C(2438296811), UINT32_C(1299810910) } },
+    { { UINT32_C(1341814471), UINT32_C(2825486080), UINT32_C(1272778623), UINT32_C( 701224123) },
+      UINT32_C(3790776494),
+      { UINT32_C(3382539277), UINT32_C(   5944872), UINT32_C(1263837136), UINT32_C( 187246526) },
+      { UINT32_C(1946833260), UINT32_C(3411861921), UINT32_C(  46326185), UINT32_C(4113175863) } },
+    { { UINT32_C(4227358446), UINT32_C(2571308440), UINT32_C(1034393843), UINT32_C(3548622865) },
+      UINT32_C(3816291977),
+      { UINT32_C(2454794248), UINT32_C(3424916617), UINT32_C(2948556090), UINT32_C(1183764014) },
+      { UINT32_C(1150108163), UINT32_C(4050090885), UINT32_C(1789612012), UINT32_C(1670785344) } },
+    { { UINT32_C(1777110073), UINT32_C(3935738550), UINT32_C(4126383268), UINT32_C( 630216074) },
+      UINT32_C(1355856531),
+      { UINT32_C(1585843884), UINT32_C(2415871366), UINT32_C(3915016820), UINT32_C( 747363688) },
+      { UINT32_C(1785353165), UINT32_C(2485317925), UINT32_C(4290032261), UINT32_C(3030301508) } },
+    { { UINT32_C(2957206631), UINT32_C(1303186071), UINT32_C(1863073064), UINT32_C(2649997878) },
+      UINT32_C(2538247577),
+      { UINT32_C( 310846755), UINT32_C(3447863062), UINT32_C(3245492451), UINT32_C(1315160407) },
+      { UINT32_C(1236210698), UINT32_C(3042781631), UINT32_C( 386590372), UINT32_C(1073403002) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t hash_abcd = simde_vld1q_u32(test_vec[i].hash_abcd);
+    simde_uint32x4_t wk = simde_vld1q_u32(test_vec[i].wk);
+    simde_uint32x4_t r = simde_vsha1mq_u32(hash_abcd, test_vec[i].hash_e, wk);
+
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsha1su0q_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t w0_3[4];
+    uint32_t w4_7[4];
+    uint32_t w8_11[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(1034442240), UINT32_C(3276079588), UINT32_C(3385933367), UINT32_C(4023458325) },
+      { UINT32_C( 587161773), UINT32_C(1583994002), UINT32_C(2698198678), UINT32_C(1479763807) },
+      { UINT32_C(2127552184), UINT32_C(2625721038), UINT32_C(1053109627), UINT32_C(2338454304) },
+      { UINT32_C(2327230095), UINT32_C(2954185023), UINT32_C(3588977633), UINT32_C( 987313575) } },
+    { { UINT32_C(3378542124), UINT32_C(3051653490), UINT32_C(2962703373), UINT32_C( 573452449) },
+      { UINT32_C(1741732760), UINT32_C(2841236134), UINT32_C(2363082585), UINT32_C(1650057335) },
+      { UINT32_C(1825861161), UINT32_C(1119575793), UINT32_C(3290161508), UINT32_C(1613025435) },
+      { UINT32_C( 354638856), UINT32_C(3581011746), UINT32_C( 324804337), UINT32_C(3948098204) } },
+    { { UINT32_C( 146755677), UINT32_C( 427573895), UINT32_C( 225405805), UINT32_C( 902932875) },
+      { UINT32_C(2451144512), UINT32_C(2600711520), UINT32_C( 270261478), UINT32_C(2761781255) },
+      { UINT32_C(3775452136), UINT32_C(1359959640), UINT32_C(3823240025), UINT32_C(1437664582) },
+      { UINT32_C(3839420632), UINT32_C(2107817300), UINT32_C(2090080116), UINT32_C(4217575853) } },
+    { { UINT32_C(1003701984), UINT32_C(3141847138), UINT32_C( 783226056), UINT32_C(3747453781) },
+      { UINT32_C(3743213800), UINT32_C(2377966885), UINT32_C( 289885047), UINT32_C(3393029533) },
+      { UINT32_C(2183879851), UINT32_C(2286782811), UINT32_C( 486262868), UINT32_C( 103384785) },
+      { UINT32_C(2539064963), UINT32_C(3964983916), UINT32_C(3980932212), UINT32_C(1422456993) } },
+    { { UINT32_C(4259604719), UINT32_C(1070033066), UINT32_C(1805140077), UINT32_C(2036086811) },
+      { UINT32_C(2894374029), UINT32_C(1902506553), UINT32_C(1239150670), UINT32_C(1459876945) },
+      { UINT32_C(3754782992), UINT32_C(1584865627), UINT32_C(3126552523), UINT32_C( 336061938) },
+      { UINT32_C(1236359570), UINT32_C( 418148842), UINT32_C(2101838635), UINT32_C( 473837520) } },
+    { { UINT32_C(  23410890), UINT32_C(3788113516), UINT32_C( 347063259), UINT32_C(2243069279) },
+      { UINT32_C(1307908698), UINT32_C(4193544352), UINT32_C(1397370737), UINT32_C( 787014586) },
+      { UINT32_C( 112810605), UINT32_C(2862367370), UINT32_C(2675202317), UINT32_C(1302584006) },
+      { UINT32_C( 326345084), UINT32_C(3471098297), UINT32_C(3324936332), UINT32_C( 837105465) } },
+    { { UINT32_C( 109622244), UINT32_C(2149219639), UINT32_C(2317469541), UINT32_C(3062856810) },
+      { UINT32_C(3226417338), UINT32_C(3828435243), UINT32_C(1203730508), UINT32_C(1181591483) },
+      { UINT32_C(1298455624), UINT32_C(3829582130), UINT32_C(3682840271), UINT32_C( 835061509) },
+      { UINT32_C(3251480777), UINT32_C(3537356911), UINT32_C(2448249104), UINT32_C(1668821572) } },
+    { { UINT32_C(3308033461), UINT32_C(2443117228), UINT32_C(3291958046), UINT32_C(1159993969) },
+      { UINT32_C( 419995902), UINT32_C(4088747365), UINT32_C(1097695403), UINT32_C( 483380718) },
+      { UINT32_C(1577467409), UINT32_C( 979315195), UINT32_C(2110578318), UINT32_C(2897353178) },
+      { UINT32_C(1595793594), UINT32_C(4007932198), UINT32_C(2700293486), UINT32_C( 438523598) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t w0_3 = simde_vld1q_u32(test_vec[i].w0_3);
+    simde_uint32x4_t w4_7 = simde_vld1q_u32(test_vec[i].w4_7);
+    simde_uint32x4_t w8_11 = simde_vld1q_u32(test_vec[i].w8_11);
+    simde_uint32x4_t r = simde_vsha1su0q_u32(w0_3, w4_7, w8_11);
+
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsha1su1q_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t tw0_3[4];
+    uint32_t w12_15[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(3253197608), UINT32_C(2633118089), UINT32_C(3867510356), UINT32_C(3744826288) },
+      { UINT32_C(2483499914), UINT32_C(1503404102), UINT32_C( 300578839), UINT32_C(4182883294) },
+      { UINT32_C( 821556957), UINT32_C( 439391037), UINT32_C(1068006164), UINT32_C(3750030043) } },
+    { { UINT32_C( 141400990), UINT32_C(1423544128), UINT32_C(1718432604), UINT32_C(4199280199) },
+      { UINT32_C(4053651847), UINT32_C(1905831122), UINT32_C( 323881969), UINT32_C(3223880474) },
+      { UINT32_C(4092227224), UINT32_C(2402224482), UINT32_C(1284202637), UINT32_C( 323158462) } },
+    { { UINT32_C(4194141688), UINT32_C(1622612979), UINT32_C(  59361109), UINT32_C( 701495457) },
+      { UINT32_C( 101890382), UINT32_C(1736539400), UINT32_C(2029108472), UINT32_C(1344430936) },
+      { UINT32_C(1023013345), UINT32_C( 814566934), UINT32_C(2807515162), UINT32_C( 711725696) } },
+    { { UINT32_C( 303724943), UINT32_C(3152852160), UINT32_C(1458202365), UINT32_C(2895238994) },
+      { UINT32_C(4210265230), UINT32_C(2614270105), UINT32_C(4176819438), UINT32_C( 834830905) },
+      { UINT32_C( 328319533), UINT32_C(2251489372), UINT32_C(3461466504), UINT32_C(2113940223) } },
+    { { UINT32_C(3397792159), UINT32_C( 746556100), UINT32_C(2921886780), UINT32_C(4249380049) },
+      { UINT32_C(1527404294), UINT32_C(2772508854), UINT32_C(1729506697), UINT32_C( 779672836) },
+      { UINT32_C(3750634066), UINT32_C(2530430618), UINT32_C(  10572401), UINT32_C(1166839046) } },
+    { { UINT32_C(2261504203), UINT32_C(3308599973), UINT32_C(1460524893), UINT32_C(1414462981) },
+      { UINT32_C(2706189979), UINT32_C( 374418007), UINT32_C( 878909550), UINT32_C( 989691344) },
+      { UINT32_C( 557184313), UINT32_C(3802940823), UINT32_C(3688977690), UINT32_C(3941996152) } },
+    { { UINT32_C(2226692970), UINT32_C(1342589353), UINT32_C(1735478812), UINT32_C(2819127361) },
+      { UINT32_C( 568529877), UINT32_C(  81326682), UINT32_C( 715886091), UINT32_C(2956801953) },
+      { UINT32_C(  12624481), UINT32_C(4116418372), UINT32_C(2929259387), UINT32_C(1368503361) } },
+    { { UINT32_C(1942866545), UINT32_C( 914591346), UINT32_C(1561038950), UINT32_C(2173422020) },
+      { UINT32_C(1656528974), UINT32_C(1348469752), UINT32_C(3974488391), UINT32_C(  11390702) },
+      { UINT32_C(1197183762), UINT32_C(3033325163), UINT32_C(3142368528), UINT32_C(2376119725) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t tw0_3 = simde_vld1q_u32(test_vec[i].tw0_3);
+    simde_uint32x4_t w12_15 = simde_vld1q_u32(test_vec[i].w12_15);
+    simde_uint32x4_t r = simde_vsha1su1q_u32(tw0_3, w12_15);
+
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vsha1h_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsha1cq_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsha1pq_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsha1mq_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsha1su0q_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsha1su1q_u32)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
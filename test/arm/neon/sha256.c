@@ -0,0 +1,219 @@
+#define SIMDE_TEST_ARM_NEON_INSN sha256
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/sha256.h"
+
+static int
+test_simde_vsha256hq_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t hash_abcd[4];
+    uint32_t hash_efgh[4];
+    uint32_t wk[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(1222203889), UINT32_C( 658590140), UINT32_C(1614840926), UINT32_C(1659450454) },
+      { UINT32_C(1610185196), UINT32_C(3496710507), UINT32_C(4072304076), UINT32_C(  81992588) },
+      { UINT32_C(4241052958), UINT32_C( 345435873), UINT32_C(3206637364), UINT32_C(2272671491) },
+      { UINT32_C(1238892915), UINT32_C( 214320953), UINT32_C(3340019135), UINT32_C(3145568906) } },
+    { { UINT32_C(  17899875), UINT32_C(2963438542), UINT32_C(2255376437), UINT32_C(3467654757) },
+      { UINT32_C(4096611497), UINT32_C(2876151651), UINT32_C(1063091505), UINT32_C( 288968623) },
+      { UINT32_C(3277408413), UINT32_C(2558812136), UINT32_C(2916732094), UINT32_C(2594548105) },
+      { UINT32_C(1350926104), UINT32_C(3649275105), UINT32_C(3663288022), UINT32_C(3025106875) } },
+    { { UINT32_C(2326205253), UINT32_C(2075017425), UINT32_C(4052006397), UINT32_C(1378542161) },
+      { UINT32_C(1167206246), UINT32_C(3005419444), UINT32_C(4134129802), UINT32_C(3170711058) },
+      { UINT32_C(1279052037), UINT32_C(2152155654), UINT32_C(3659975900), UINT32_C(3116486228) },
+      { UINT32_C(3088007449), UINT32_C(1345579948), UINT32_C( 940164035), UINT32_C(3655449174) } },
+    { { UINT32_C(2967801491), UINT32_C(1549172629), UINT32_C(2444451582), UINT32_C(3429502841) },
+      { UINT32_C(1899038068), UINT32_C(3597083795), UINT32_C( 675324734), UINT32_C(3450918483) },
+      { UINT32_C(1482035731), UINT32_C(2307739530), UINT32_C(3766370179), UINT32_C(2305222354) },
+      { UINT32_C(2271136705), UINT32_C( 896219435), UINT32_C(3973375092), UINT32_C(  63360883) } },
+    { { UINT32_C(2331647222), UINT32_C(1850888051), UINT32_C( 592558056), UINT32_C(3037187620) },
+      { UINT32_C(2530196030), UINT32_C(2287668606), UINT32_C(2237668756), UINT32_C(3467305416) },
+      { UINT32_C(3801746722), UINT32_C( 564479741), UINT32_C(3841524315), UINT32_C(1828012186) },
+      { UINT32_C( 989665311), UINT32_C(3453017551), UINT32_C(2258036984), UINT32_C(3838844852) } },
+    { { UINT32_C(3773307377), UINT32_C(2736999985), UINT32_C( 650986588), UINT32_C(2582938953) },
+      { UINT32_C(2191848598), UINT32_C(3539742022), UINT32_C(2138676632), UINT32_C(2356633544) },
+      { UINT32_C(1852662955), UINT32_C(1381867877), UINT32_C(3728297883), UINT32_C(2533008674) },
+      { UINT32_C(3870448028), UINT32_C(2671867577), UINT32_C( 776387419), UINT32_C(1346277566) } },
+    { { UINT32_C(4074352063), UINT32_C(2089819658), UINT32_C( 548447975), UINT32_C(1126872527) },
+      { UINT32_C(3426194180), UINT32_C( 779628411), UINT32_C(1772924384), UINT32_C(  38408615) },
+      { UINT32_C(1733124019), UINT32_C(3579735046), UINT32_C( 107003622), UINT32_C(3067994484) },
+      { UINT32_C(1624648780), UINT32_C(3306016709), UINT32_C(3972140564), UINT32_C(1749036330) } },
+    { { UINT32_C(2194192517), UINT32_C(1166114091), UINT32_C(2633712763), UINT32_C(1758533800) },
+      { UINT32_C(3041554417), UINT32_C(4042966988), UINT32_C( 582408076), UINT32_C( 574985938) },
+      { UINT32_C(1240918874), UINT32_C(2779286296), UINT32_C(2302696441), UINT32_C(2102077140) },
+      { UINT32_C(1990902352), UINT32_C(3298744967), UINT32_C( 177447259), UINT32_C(3361045690) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t hash_abcd = simde_vld1q_u32(test_vec[i].hash_abcd);
+    simde_uint32x4_t hash_efgh = simde_vld1q_u32(test_vec[i].hash_efgh);
+    simde_uint32x4_t wk = simde_vld1q_u32(test_vec[i].wk);
+    simde_uint32x4_t r = simde_vsha256hq_u32(hash_abcd, hash_efgh, wk);
+
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsha256h2q_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t hash_efgh[4];
+    uint32_t hash_abcd[4];
+    uint32_t wk[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(1154648966), UINT32_C(3050156132), UINT32_C(3762579792), UINT32_C(3706129467) },
+      { UINT32_C(1911665684), UINT32_C( 749658708), UINT32_C( 135637064), UINT32_C( 313847391) },
+      { UINT32_C(2329831581), UINT32_C(4248327500), UINT32_C( 722633733), UINT32_C(1909162032) },
+      { UINT32_C(2775893021), UINT32_C(1973534491), UINT32_C( 507184230), UINT32_C( 534599400) } },
+    { { UINT32_C(3147256799), UINT32_C(  25003971), UINT32_C(1748263372), UINT32_C(2539700425) },
+      { UINT32_C(3929999070), UINT32_C( 821023136), UINT32_C( 691369623), UINT32_C(3645698594) },
+      { UINT32_C(3005480890), UINT32_C( 567580433), UINT32_C(2946170680), UINT32_C( 658402084) },
+      { UINT32_C( 436057345), UINT32_C(2276990598), UINT32_C(1847679975), UINT32_C( 867669728) } },
+    { { UINT32_C(1568450078), UINT32_C(1453343420), UINT32_C(3604818089), UINT32_C( 460383694) },
+      { UINT32_C(3578007036), UINT32_C(3616836747), UINT32_C(4109313548), UINT32_C(1247766734) },
+      { UINT32_C(2577909049), UINT32_C( 952699426), UINT32_C( 892976054), UINT32_C(1156855189) },
+      { UINT32_C(1625784774), UINT32_C(1566631001), UINT32_C(2835914324), UINT32_C(3674632372) } },
+    { { UINT32_C(3570569055), UINT32_C(1889012493), UINT32_C( 780679425), UINT32_C(1197037449) },
+      { UINT32_C(3086062762), UINT32_C(3963417098), UINT32_C(1298116480), UINT32_C(3390662519) },
+      { UINT32_C(1664454229), UINT32_C(1110135966), UINT32_C(1386574973), UINT32_C(3382600341) },
+      { UINT32_C(  25853967), UINT32_C(2153101771), UINT32_C(1540372981), UINT32_C(3979282408) } },
+    { { UINT32_C(2653930519), UINT32_C(3418881231), UINT32_C(3720328112), UINT32_C(2293571693) },
+      { UINT32_C(3559670735), UINT32_C(3316093214), UINT32_C(  59813124), UINT32_C(2383358156) },
+      { UINT32_C(3660386024), UINT32_C( 734293619), UINT32_C(2990035559), UINT32_C( 295171109) },
+      { UINT32_C( 314907067), UINT32_C( 430115799), UINT32_C( 902565318), UINT32_C(2280833263) } },
+    { { UINT32_C(1627878871), UINT32_C(3635605369), UINT32_C(3769899383), UINT32_C(1200751343) },
+      { UINT32_C(1179881159), UINT32_C(3295496280), UINT32_C(3632402930), UINT32_C(3932623556) },
+      { UINT32_C(4088832850), UINT32_C(1866895165), UINT32_C(3023554364), UINT32_C(3537933290) },
+      { UINT32_C( 183434051), UINT32_C(2163739447), UINT32_C(4072602950), UINT32_C(1261763839) } },
+    { { UINT32_C(1475773556), UINT32_C(2025618264), UINT32_C(1597862476), UINT32_C(1729375958) },
+      { UINT32_C(1259485600), UINT32_C(1625697384), UINT32_C(1833170062), UINT32_C(1304666352) },
+      { UINT32_C( 660795396), UINT32_C( 889072598), UINT32_C(3719811573), UINT32_C(1999440139) },
+      { UINT32_C(3350851705), UINT32_C(3148028476), UINT32_C(1217087430), UINT32_C(3650048268) } },
+    { { UINT32_C(1485522044), UINT32_C( 956886310), UINT32_C( 944770597), UINT32_C(2903916313) },
+      { UINT32_C( 880087630), UINT32_C(1564536119), UINT32_C(2559064754), UINT32_C( 987538352) },
+      { UINT32_C( 251579615), UINT32_C(2344684956), UINT32_C(3421862905), UINT32_C( 800777627) },
+      { UINT32_C(2851881297), UINT32_C(3692325087), UINT32_C(2106219308), UINT32_C(1788149794) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t hash_efgh = simde_vld1q_u32(test_vec[i].hash_efgh);
+    simde_uint32x4_t hash_abcd = simde_vld1q_u32(test_vec[i].hash_abcd);
+    simde_uint32x4_t wk = simde_vld1q_u32(test_vec[i].wk);
+    simde_uint32x4_t r = simde_vsha256h2q_u32(hash_efgh, hash_abcd, wk);
+
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsha256su0q_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t w0_3[4];
+    uint32_t w4_7[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C(3675742108), UINT32_C(2272204312), UINT32_C(1339036053), UINT32_C( 243216094) },
+      { UINT32_C( 742865598), UINT32_C(3667651908), UINT32_C(4154840602), UINT32_C(2079726718) },
+      { UINT32_C(3212606672), UINT32_C(2926577661), UINT32_C(3325340078), UINT32_C(3321827601) } },
+    { { UINT32_C(1772402086), UINT32_C(1377244446), UINT32_C(4198821498), UINT32_C( 109450776) },
+      { UINT32_C(2939516312), UINT32_C(1984373781), UINT32_C(2807791964), UINT32_C(2309451302) },
+      { UINT32_C(1564872114), UINT32_C( 590987168), UINT32_C(2946547144), UINT32_C(2154104237) } },
+    { { UINT32_C(2431231531), UINT32_C(1850603237), UINT32_C( 330985981), UINT32_C(1174892298) },
+      { UINT32_C( 621889228), UINT32_C(4186228302), UINT32_C(3197205293), UINT32_C(3936711259) },
+      { UINT32_C(1268131021), UINT32_C(3531437335), UINT32_C(3678987451), UINT32_C( 325218842) } },
+    { { UINT32_C(1523745984), UINT32_C( 628811127), UINT32_C(1317842789), UINT32_C( 908199436) },
+      { UINT32_C(4027789969), UINT32_C(3605778609), UINT32_C(1072413690), UINT32_C( 408744248) },
+      { UINT32_C(2928338170), UINT32_C( 235979912), UINT32_C(3988240554), UINT32_C( 661144127) } },
+    { { UINT32_C(2170424128), UINT32_C(3246042911), UINT32_C(1977105526), UINT32_C(3615423655) },
+      { UINT32_C(3634606114), UINT32_C(3082767386), UINT32_C( 817578965), UINT32_C( 998067613) },
+      { UINT32_C( 231234595), UINT32_C(2932332959), UINT32_C(1614877736), UINT32_C(2318173171) } },
+    { { UINT32_C(1432756794), UINT32_C(1981897159), UINT32_C(1459799001), UINT32_C(3171472703) },
+      { UINT32_C( 646746579), UINT32_C( 820668333), UINT32_C(2014542072), UINT32_C(2695247174) },
+      { UINT32_C( 733992509), UINT32_C(2128175619), UINT32_C(3029837864), UINT32_C(1139873785) } },
+    { { UINT32_C(3245078943), UINT32_C(1410809538), UINT32_C(3213522808), UINT32_C(2766369870) },
+      { UINT32_C(1389117520), UINT32_C(3070611832), UINT32_C(2845840895), UINT32_C(1868602566) },
+      { UINT32_C(  50746943), UINT32_C(3479680165), UINT32_C( 340818129), UINT32_C(1607170183) } },
+    { { UINT32_C(2063624255), UINT32_C(3215435354), UINT32_C(1610470433), UINT32_C( 561652266) },
+      { UINT32_C(3204555431), UINT32_C(2480983410), UINT32_C(2601406910), UINT32_C(2755225717) },
+      { UINT32_C(3323821229), UINT32_C(4226792749), UINT32_C( 954535040), UINT32_C(1370618619) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t w0_3 = simde_vld1q_u32(test_vec[i].w0_3);
+    simde_uint32x4_t w4_7 = simde_vld1q_u32(test_vec[i].w4_7);
+    simde_uint32x4_t r = simde_vsha256su0q_u32(w0_3, w4_7);
+
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vsha256su1q_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t tw0_3[4];
+    uint32_t w8_11[4];
+    uint32_t w12_15[4];
+    uint32_t r[4];
+  } test_vec[] = {
+    { { UINT32_C( 513597082), UINT32_C(2179451958), UINT32_C(1561086920), UINT32_C(2613396614) },
+      { UINT32_C(2800134674), UINT32_C(2985955571), UINT32_C(1239374291), UINT32_C( 243808477) },
+      { UINT32_C(2600729554), UINT32_C(1103369200), UINT32_C( 835719895), UINT32_C(3046198884) },
+      { UINT32_C(3688102499), UINT32_C(1520094770), UINT32_C(3990873874), UINT32_C(1972568325) } },
+    { { UINT32_C(1162192970), UINT32_C(3659980254), UINT32_C( 885260353), UINT32_C(4052603587) },
+      { UINT32_C(3511484748), UINT32_C( 594818726), UINT32_C(2003545365), UINT32_C(1668179106) },
+      { UINT32_C( 499942302), UINT32_C( 326952903), UINT32_C(2555342960), UINT32_C( 920511260) },
+      { UINT32_C(3200920546), UINT32_C(2675094976), UINT32_C(3906281241), UINT32_C( 467261275) } },
+    { { UINT32_C( 872397809), UINT32_C(1059570778), UINT32_C( 118323370), UINT32_C(3369490414) },
+      { UINT32_C(4070361067), UINT32_C( 638373761), UINT32_C( 361757383), UINT32_C(1069408210) },
+      { UINT32_C(4083158813), UINT32_C(2187914108), UINT32_C(1696654040), UINT32_C(4177140456) },
+      { UINT32_C(3342532990), UINT32_C(2731482373), UINT32_C( 661442102), UINT32_C( 692141572) } },
+    { { UINT32_C( 515232974), UINT32_C(1524241967), UINT32_C(3682671996), UINT32_C(3054251872) },
+      { UINT32_C(2802797471), UINT32_C(2303936453), UINT32_C(2654037349), UINT32_C(3225886513) },
+      { UINT32_C( 625475224), UINT32_C(2174834229), UINT32_C(4077480831), UINT32_C( 294013613) },
+      { UINT32_C(1089856082), UINT32_C(3843213045), UINT32_C(3912995273), UINT32_C( 384907410) } },
+    { { UINT32_C(3601025197), UINT32_C(1975141828), UINT32_C(2305483898), UINT32_C( 978167447) },
+      { UINT32_C(1770234019), UINT32_C(3522701684), UINT32_C(4255606624), UINT32_C( 168098943) },
+      { UINT32_C(4017500474), UINT32_C( 422126152), UINT32_C(1414958993), UINT32_C(1475649077) },
+      { UINT32_C(1053493027), UINT32_C(1345038663), UINT32_C(1995058038), UINT32_C(3412271307) } },
+    { { UINT32_C(1823759291), UINT32_C(1891356946), UINT32_C(2359037809), UINT32_C(2506014138) },
+      { UINT32_C(2884286017), UINT32_C(1170942892), UINT32_C(4275598287), UINT32_C(3651516374) },
+      { UINT32_C(3330451019), UINT32_C(2763086862), UINT32_C( 942696098), UINT32_C( 506860404) },
+      { UINT32_C(4060798574), UINT32_C( 996623930), UINT32_C(2600987962), UINT32_C(2813716243) } },
+    { { UINT32_C( 467784251), UINT32_C( 736894173), UINT32_C( 179879293), UINT32_C(3661474308) },
+      { UINT32_C( 482095301), UINT32_C(1657362796), UINT32_C( 435712062), UINT32_C( 461483418) },
+      { UINT32_C(1584745821), UINT32_C(2899818206), UINT32_C(2313962514), UINT32_C( 786942334) },
+      { UINT32_C( 693410433), UINT32_C(1669331064), UINT32_C(  72699837), UINT32_C(1004460431) } },
+    { { UINT32_C(2218452022), UINT32_C(4144595968), UINT32_C(2491020117), UINT32_C(2491203365) },
+      { UINT32_C(3254524145), UINT32_C(1441609541), UINT32_C(  31027887), UINT32_C( 925816473) },
+      { UINT32_C(3037014087), UINT32_C(3842770028), UINT32_C( 607848505), UINT32_C(3395028931) },
+      { UINT32_C(3208303571), UINT32_C(2081292819), UINT32_C(4284821692), UINT32_C( 181844338) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4_t tw0_3 = simde_vld1q_u32(test_vec[i].tw0_3);
+    simde_uint32x4_t w8_11 = simde_vld1q_u32(test_vec[i].w8_11);
+    simde_uint32x4_t w12_15 = simde_vld1q_u32(test_vec[i].w12_15);
+    simde_uint32x4_t r = simde_vsha256su1q_u32(tw0_3, w8_11, w12_15);
+
+    simde_test_arm_neon_assert_equal_u32x4(r, simde_vld1q_u32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+SIMDE_TEST_FUNC_LIST_ENTRY(vsha256hq_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsha256h2q_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsha256su0q_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vsha256su1q_u32)
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
@@ -0,0 +1,1176 @@
+#define SIMDE_TEST_ARM_NEON_INSN st2
+
+#include "test-neon.h"
+#include "../../../simde/arm/neon/st2.h"
+#include "../../../simde/arm/neon/ld2.h"
+
+#if !defined(SIMDE_BUG_INTEL_857088)
+
+static int
+test_simde_vst2_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 r0[2];
+    simde_float32 r1[2];
+    simde_float32 a[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -670.10), SIMDE_FLOAT32_C(   379.53) },
+      { SIMDE_FLOAT32_C(   270.00), SIMDE_FLOAT32_C(   -41.80) },
+      { SIMDE_FLOAT32_C(  -670.10), SIMDE_FLOAT32_C(   270.00), SIMDE_FLOAT32_C(   379.53), SIMDE_FLOAT32_C(   -41.80) } },
+    { { SIMDE_FLOAT32_C(  -567.97), SIMDE_FLOAT32_C(   585.27) },
+      { SIMDE_FLOAT32_C(   615.71), SIMDE_FLOAT32_C(    24.91) },
+      { SIMDE_FLOAT32_C(  -567.97), SIMDE_FLOAT32_C(   615.71), SIMDE_FLOAT32_C(   585.27), SIMDE_FLOAT32_C(    24.91) } },
+    { { SIMDE_FLOAT32_C(    10.17), SIMDE_FLOAT32_C(  -527.89) },
+      { SIMDE_FLOAT32_C(  -993.64), SIMDE_FLOAT32_C(  -257.91) },
+      { SIMDE_FLOAT32_C(    10.17), SIMDE_FLOAT32_C(  -993.64), SIMDE_FLOAT32_C(  -527.89), SIMDE_FLOAT32_C(  -257.91) } },
+    { { SIMDE_FLOAT32_C(   170.72), SIMDE_FLOAT32_C(  -861.47) },
+      { SIMDE_FLOAT32_C(   587.50), SIMDE_FLOAT32_C(  -535.49) },
+      { SIMDE_FLOAT32_C(   170.72), SIMDE_FLOAT32_C(   587.50), SIMDE_FLOAT32_C(  -861.47), SIMDE_FLOAT32_C(  -535.49) } },
+    { { SIMDE_FLOAT32_C(  -534.61), SIMDE_FLOAT32_C(  -915.33) },
+      { SIMDE_FLOAT32_C(   995.12), SIMDE_FLOAT32_C(   477.38) },
+      { SIMDE_FLOAT32_C(  -534.61), SIMDE_FLOAT32_C(   995.12), SIMDE_FLOAT32_C(  -915.33), SIMDE_FLOAT32_C(   477.38) } },
+    { { SIMDE_FLOAT32_C(   750.08), SIMDE_FLOAT32_C(   231.78) },
+      { SIMDE_FLOAT32_C(  -931.86), SIMDE_FLOAT32_C(  -342.14) },
+      { SIMDE_FLOAT32_C(   750.08), SIMDE_FLOAT32_C(  -931.86), SIMDE_FLOAT32_C(   231.78), SIMDE_FLOAT32_C(  -342.14) } },
+    { { SIMDE_FLOAT32_C(    -4.90), SIMDE_FLOAT32_C(  -768.38) },
+      { SIMDE_FLOAT32_C(   903.93), SIMDE_FLOAT32_C(  -263.11) },
+      { SIMDE_FLOAT32_C(    -4.90), SIMDE_FLOAT32_C(   903.93), SIMDE_FLOAT32_C(  -768.38), SIMDE_FLOAT32_C(  -263.11) } },
+    { { SIMDE_FLOAT32_C(  -690.37), SIMDE_FLOAT32_C(   635.02) },
+      { SIMDE_FLOAT32_C(  -750.25), SIMDE_FLOAT32_C(   855.89) },
+      { SIMDE_FLOAT32_C(  -690.37), SIMDE_FLOAT32_C(  -750.25), SIMDE_FLOAT32_C(   635.02), SIMDE_FLOAT32_C(   855.89) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x2x2_t r_ = { { simde_vld1_f32(test_vec[i].r0),
+                                  simde_vld1_f32(test_vec[i].r1) } };
+
+    simde_float32 a_[4];
+    simde_vst2_f32(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2_f32(a_);
+    simde_test_arm_neon_assert_equal_f32x2(r_.val[0], simde_vld1_f32(test_vec[i].r0), 1);
+    simde_test_arm_neon_assert_equal_f32x2(r_.val[1], simde_vld1_f32(test_vec[i].r1), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst2_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 r0[1];
+    simde_float64 r1[1];
+    simde_float64 a[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   -93.74) },
+      { SIMDE_FLOAT64_C(   104.01) },
+      { SIMDE_FLOAT64_C(   -93.74), SIMDE_FLOAT64_C(   104.01) } },
+    { { SIMDE_FLOAT64_C(  -314.16) },
+      { SIMDE_FLOAT64_C(   -30.59) },
+      { SIMDE_FLOAT64_C(  -314.16), SIMDE_FLOAT64_C(   -30.59) } },
+    { { SIMDE_FLOAT64_C(  -626.18) },
+      { SIMDE_FLOAT64_C(  -925.72) },
+      { SIMDE_FLOAT64_C(  -626.18), SIMDE_FLOAT64_C(  -925.72) } },
+    { { SIMDE_FLOAT64_C(   731.77) },
+      { SIMDE_FLOAT64_C(  -530.27) },
+      { SIMDE_FLOAT64_C(   731.77), SIMDE_FLOAT64_C(  -530.27) } },
+    { { SIMDE_FLOAT64_C(   560.52) },
+      { SIMDE_FLOAT64_C(  -582.88) },
+      { SIMDE_FLOAT64_C(   560.52), SIMDE_FLOAT64_C(  -582.88) } },
+    { { SIMDE_FLOAT64_C(   937.54) },
+      { SIMDE_FLOAT64_C(   787.93) },
+      { SIMDE_FLOAT64_C(   937.54), SIMDE_FLOAT64_C(   787.93) } },
+    { { SIMDE_FLOAT64_C(   509.58) },
+      { SIMDE_FLOAT64_C(   525.59) },
+      { SIMDE_FLOAT64_C(   509.58), SIMDE_FLOAT64_C(   525.59) } },
+    { { SIMDE_FLOAT64_C(   161.53) },
+      { SIMDE_FLOAT64_C(   459.51) },
+      { SIMDE_FLOAT64_C(   161.53), SIMDE_FLOAT64_C(   459.51) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x1x2_t r_ = { { simde_vld1_f64(test_vec[i].r0),
+                                  simde_vld1_f64(test_vec[i].r1) } };
+
+    simde_float64 a_[2];
+    simde_vst2_f64(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2_f64(a_);
+    simde_test_arm_neon_assert_equal_f64x1(r_.val[0], simde_vld1_f64(test_vec[i].r0), 1);
+    simde_test_arm_neon_assert_equal_f64x1(r_.val[1], simde_vld1_f64(test_vec[i].r1), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst2_s8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t r0[8];
+    int8_t r1[8];
+    int8_t a[16];
+  } test_vec[] = {
+    { { -INT8_C(  96),  INT8_C(  16), -INT8_C(   6),  INT8_C(  16),  INT8_C(  84), -INT8_C(  28), -INT8_C(  76), -INT8_C(  40) },
+      {  INT8_C( 109), -INT8_C(  90),  INT8_C( 100),  INT8_C(  10), -INT8_C(  23), -INT8_C(  53), -INT8_C(  34),  INT8_C( 117) },
+      { -INT8_C(  96),  INT8_C( 109),  INT8_C(  16), -INT8_C(  90), -INT8_C(   6),  INT8_C( 100),  INT8_C(  16),  INT8_C(  10),
+         INT8_C(  84), -INT8_C(  23), -INT8_C(  28), -INT8_C(  53), -INT8_C(  76), -INT8_C(  34), -INT8_C(  40),  INT8_C( 117) } },
+    { { -INT8_C(  12),  INT8_C(   1), -INT8_C(  29), -INT8_C(  46),  INT8_C( 127), -INT8_C(   3), -INT8_C(  29), -INT8_C(  59) },
+      { -INT8_C( 121),  INT8_C(  86), -INT8_C( 104), -INT8_C(  87),  INT8_C(  56),  INT8_C(  56),  INT8_C( 127),  INT8_C( 124) },
+      { -INT8_C(  12), -INT8_C( 121),  INT8_C(   1),  INT8_C(  86), -INT8_C(  29), -INT8_C( 104), -INT8_C(  46), -INT8_C(  87),
+         INT8_C( 127),  INT8_C(  56), -INT8_C(   3),  INT8_C(  56), -INT8_C(  29),  INT8_C( 127), -INT8_C(  59),  INT8_C( 124) } },
+    { { -INT8_C(   1), -INT8_C( 127), -INT8_C(   2), -INT8_C( 110),  INT8_C(  13),  INT8_C(  26),  INT8_C(  64),  INT8_C(   6) },
+      { -INT8_C(  71),  INT8_C(  19),  INT8_C(  28), -INT8_C(  46),  INT8_C(  15),  INT8_C( 123),  INT8_C(  32), -INT8_C(  99) },
+      { -INT8_C(   1), -INT8_C(  71), -INT8_C( 127),  INT8_C(  19), -INT8_C(   2),  INT8_C(  28), -INT8_C( 110), -INT8_C(  46),
+         INT8_C(  13),  INT8_C(  15),  INT8_C(  26),  INT8_C( 123),  INT8_C(  64),  INT8_C(  32),  INT8_C(   6), -INT8_C(  99) } },
+    { { -INT8_C(  81),  INT8_C(  44), -INT8_C(  84),  INT8_C(  33), -INT8_C(  38),  INT8_C(  86),  INT8_C( 110), -INT8_C(  42) },
+      { -INT8_C(  39),  INT8_C(  68),  INT8_C(  25),  INT8_C( 111), -INT8_C(  49), -INT8_C(  65), -INT8_C( 101), -INT8_C(  84) },
+      { -INT8_C(  81), -INT8_C(  39),  INT8_C(  44),  INT8_C(  68), -INT8_C(  84),  INT8_C(  25),  INT8_C(  33),  INT8_C( 111),
+        -INT8_C(  38), -INT8_C(  49),  INT8_C(  86), -INT8_C(  65),  INT8_C( 110), -INT8_C( 101), -INT8_C(  42), -INT8_C(  84) } },
+    { { -INT8_C( 111),  INT8_C( 109),  INT8_C(  81), -INT8_C(  83),  INT8_C(  71), -INT8_C(  18), -INT8_C(  32), -INT8_C(  87) },
+      {  INT8_C(  47), -INT8_C( 118),  INT8_C(  46),  INT8_C(   6),  INT8_C( 103),  INT8_C(  41),  INT8_C( 118), -INT8_C(  66) },
+      { -INT8_C( 111),  INT8_C(  47),  INT8_C( 109), -INT8_C( 118),  INT8_C(  81),  INT8_C(  46), -INT8_C(  83),  INT8_C(   6),
+         INT8_C(  71),  INT8_C( 103), -INT8_C(  18),  INT8_C(  41), -INT8_C(  32),  INT8_C( 118), -INT8_C(  87), -INT8_C(  66) } },
+    { { -INT8_C(  23),  INT8_C( 107),  INT8_C( 126), -INT8_C(  86),  INT8_C( 119),  INT8_C(  62),  INT8_C(  24), -INT8_C( 124) },
+      {  INT8_C(  99), -INT8_C(  39), -INT8_C(   2),  INT8_C(   2), -INT8_C(  31),  INT8_C(  43), -INT8_C(  64),  INT8_C( 112) },
+      { -INT8_C(  23),  INT8_C(  99),  INT8_C( 107), -INT8_C(  39),  INT8_C( 126), -INT8_C(   2), -INT8_C(  86),  INT8_C(   2),
+         INT8_C( 119), -INT8_C(  31),  INT8_C(  62),  INT8_C(  43),  INT8_C(  24), -INT8_C(  64), -INT8_C( 124),  INT8_C( 112) } },
+    { {  INT8_C(  97), -INT8_C(  65), -INT8_C(  86),  INT8_C(  16), -INT8_C( 110), -INT8_C(  15),  INT8_C(  79), -INT8_C(  23) },
+      {  INT8_C(  71),  INT8_C(  62), -INT8_C(   4), -INT8_C( 113),  INT8_C(  87), -INT8_C(  54), -INT8_C( 114),  INT8_C(  91) },
+      {  INT8_C(  97),  INT8_C(  71), -INT8_C(  65),  INT8_C(  62), -INT8_C(  86), -INT8_C(   4),  INT8_C(  16), -INT8_C( 113),
+        -INT8_C( 110),  INT8_C(  87), -INT8_C(  15), -INT8_C(  54),  INT8_C(  79), -INT8_C( 114), -INT8_C(  23),  INT8_C(  91) } },
+    { { -INT8_C(  61),  INT8_C(  41), -INT8_C(  53), -INT8_C( 119), -INT8_C(  20), -INT8_C(  64), -INT8_C(  84), -INT8_C(  27) },
+      { -INT8_C( 110),  INT8_C(  95), -INT8_C(  41),  INT8_C(  38),  INT8_C( 103), -INT8_C(  90),  INT8_C( 124), -INT8_C(  89) },
+      { -INT8_C(  61), -INT8_C( 110),  INT8_C(  41),  INT8_C(  95), -INT8_C(  53), -INT8_C(  41), -INT8_C( 119),  INT8_C(  38),
+        -INT8_C(  20),  INT8_C( 103), -INT8_C(  64), -INT8_C(  90), -INT8_C(  84),  INT8_C( 124), -INT8_C(  27), -INT8_C(  89) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x8x2_t r_ = { { simde_vld1_s8(test_vec[i].r0),
+                               simde_vld1_s8(test_vec[i].r1) } };
+
+    int8_t a_[16];
+    simde_vst2_s8(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2_s8(a_);
+    simde_test_arm_neon_assert_equal_i8x8(r_.val[0], simde_vld1_s8(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i8x8(r_.val[1], simde_vld1_s8(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst2_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t r0[4];
+    int16_t r1[4];
+    int16_t a[8];
+  } test_vec[] = {
+    { {  INT16_C( 16112),  INT16_C( 14974), -INT16_C(  1378), -INT16_C( 29530) },
+      { -INT16_C( 16238), -INT16_C( 23619),  INT16_C( 30073),  INT16_C(  9847) },
+      {  INT16_C( 16112), -INT16_C( 16238),  INT16_C( 14974), -INT16_C( 23619), -INT16_C(  1378),  INT16_C( 30073), -INT16_C( 29530),  INT16_C(  9847) } },
+    { {  INT16_C(  1680),  INT16_C( 26965),  INT16_C( 14983), -INT16_C(  1371) },
+      { -INT16_C( 30913),  INT16_C( 29677), -INT16_C( 18868),  INT16_C( 26178) },
+      {  INT16_C(  1680), -INT16_C( 30913),  INT16_C( 26965),  INT16_C( 29677),  INT16_C( 14983), -INT16_C( 18868), -INT16_C(  1371),  INT16_C( 26178) } },
+    { {  INT16_C( 22169), -INT16_C(  8799),  INT16_C( 19348), -INT16_C( 22685) },
+      {  INT16_C( 24999), -INT16_C(  8601),  INT16_C(  6643),  INT16_C( 17876) },
+      {  INT16_C( 22169),  INT16_C( 24999), -INT16_C(  8799), -INT16_C(  8601),  INT16_C( 19348),  INT16_C(  6643), -INT16_C( 22685),  INT16_C( 17876) } },
+    { { -INT16_C(  4844), -INT16_C(  1018),  INT16_C(  5318),  INT16_C( 26385) },
+      {  INT16_C( 22895), -INT16_C(  1517), -INT16_C( 12584), -INT16_C( 23671) },
+      { -INT16_C(  4844),  INT16_C( 22895), -INT16_C(  1018), -INT16_C(  1517),  INT16_C(  5318), -INT16_C( 12584),  INT16_C( 26385), -INT16_C( 23671) } },
+    { {  INT16_C(  2251),  INT16_C(  5795), -INT16_C( 14681), -INT16_C( 23638) },
+      {  INT16_C( 17581),  INT16_C( 14469), -INT16_C( 32097), -INT16_C(  7709) },
+      {  INT16_C(  2251),  INT16_C( 17581),  INT16_C(  5795),  INT16_C( 14469), -INT16_C( 14681), -INT16_C( 32097), -INT16_C( 23638), -INT16_C(  7709) } },
+    { {  INT16_C( 12144), -INT16_C( 24518),  INT16_C( 29752),  INT16_C( 14136) },
+      { -INT16_C( 31227), -INT16_C( 15438),  INT16_C(  6140), -INT16_C( 11392) },
+      {  INT16_C( 12144), -INT16_C( 31227), -INT16_C( 24518), -INT16_C( 15438),  INT16_C( 29752),  INT16_C(  6140),  INT16_C( 14136), -INT16_C( 11392) } },
+    { {  INT16_C(  9428), -INT16_C( 16399),  INT16_C( 23048),  INT16_C( 29864) },
+      {  INT16_C(  5528), -INT16_C(  5170), -INT16_C( 15912),  INT16_C( 12003) },
+      {  INT16_C(  9428),  INT16_C(  5528), -INT16_C( 16399), -INT16_C(  5170),  INT16_C( 23048), -INT16_C( 15912),  INT16_C( 29864),  INT16_C( 12003) } },
+    { { -INT16_C(  6186),  INT16_C( 16492),  INT16_C( 30063),  INT16_C( 20458) },
+      {  INT16_C( 26582), -INT16_C( 23690), -INT16_C( 24016), -INT16_C( 23464) },
+      { -INT16_C(  6186),  INT16_C( 26582),  INT16_C( 16492), -INT16_C( 23690),  INT16_C( 30063), -INT16_C( 24016),  INT16_C( 20458), -INT16_C( 23464) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x4x2_t r_ = { { simde_vld1_s16(test_vec[i].r0),
+                                simde_vld1_s16(test_vec[i].r1) } };
+
+    int16_t a_[8];
+    simde_vst2_s16(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2_s16(a_);
+    simde_test_arm_neon_assert_equal_i16x4(r_.val[0], simde_vld1_s16(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i16x4(r_.val[1], simde_vld1_s16(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst2_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t r0[2];
+    int32_t r1[2];
+    int32_t a[4];
+  } test_vec[] = {
+    { { -INT32_C( 1740152698), -INT32_C(  442549585) },
+      { -INT32_C( 1744019439), -INT32_C( 1345697544) },
+      { -INT32_C( 1740152698), -INT32_C( 1744019439), -INT32_C(  442549585), -INT32_C( 1345697544) } },
+    { { -INT32_C( 2038747945),  INT32_C(  608755773) },
+      { -INT32_C(  228254059),  INT32_C( 1228983984) },
+      { -INT32_C( 2038747945), -INT32_C(  228254059),  INT32_C(  608755773),  INT32_C( 1228983984) } },
+    { { -INT32_C( 1542640742), -INT32_C( 1838720084) },
+      {  INT32_C( 1577696816), -INT32_C( 1636071383) },
+      { -INT32_C( 1542640742),  INT32_C( 1577696816), -INT32_C( 1838720084), -INT32_C( 1636071383) } },
+    { {  INT32_C(  667108368), -INT32_C(  939138269) },
+      { -INT32_C( 1604049847), -INT32_C(  841701972) },
+      {  INT32_C(  667108368), -INT32_C( 1604049847), -INT32_C(  939138269), -INT32_C(  841701972) } },
+    { {  INT32_C(  166037488),  INT32_C( 1898764559) },
+      { -INT32_C(  754725038), -INT32_C(  445468468) },
+      {  INT32_C(  166037488), -INT32_C(  754725038),  INT32_C( 1898764559), -INT32_C(  445468468) } },
+    { { -INT32_C(   26342050),  INT32_C( 1666259151) },
+      { -INT32_C( 1204274808),  INT32_C(  520554489) },
+      { -INT32_C(   26342050), -INT32_C( 1204274808),  INT32_C( 1666259151),  INT32_C(  520554489) } },
+    { { -INT32_C( 1434173545), -INT32_C( 1367623603) },
+      { -INT32_C( 1357454090),  INT32_C( 1535425239) },
+      { -INT32_C( 1434173545), -INT32_C( 1357454090), -INT32_C( 1367623603),  INT32_C( 1535425239) } },
+    { { -INT32_C(  524798947), -INT32_C( 1281528389) },
+      {  INT32_C(  901836587),  INT32_C( 1048823816) },
+      { -INT32_C(  524798947),  INT32_C(  901836587), -INT32_C( 1281528389),  INT32_C( 1048823816) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x2x2_t r_ = { { simde_vld1_s32(test_vec[i].r0),
+                                simde_vld1_s32(test_vec[i].r1) } };
+
+    int32_t a_[4];
+    simde_vst2_s32(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2_s32(a_);
+    simde_test_arm_neon_assert_equal_i32x2(r_.val[0], simde_vld1_s32(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i32x2(r_.val[1], simde_vld1_s32(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst2_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t r0[1];
+    int64_t r1[1];
+    int64_t a[2];
+  } test_vec[] = {
+    { {  INT64_C( 4741848926000195868) },
+      {  INT64_C( 1916579690899999659) },
+      {  INT64_C( 4741848926000195868),  INT64_C( 1916579690899999659) } },
+    { {  INT64_C(   90014945550006498) },
+      {  INT64_C( 4529821630531494050) },
+      {  INT64_C(   90014945550006498),  INT64_C( 4529821630531494050) } },
+    { { -INT64_C( 8177957640560366607) },
+      {  INT64_C( 7917167641090653262) },
+      { -INT64_C( 8177957640560366607),  INT64_C( 7917167641090653262) } },
+    { { -INT64_C( 2072527943141118590) },
+      {  INT64_C( 6723154164324553229) },
+      { -INT64_C( 2072527943141118590),  INT64_C( 6723154164324553229) } },
+    { { -INT64_C( 1882731302277285540) },
+      {  INT64_C( 1234871008608928868) },
+      { -INT64_C( 1882731302277285540),  INT64_C( 1234871008608928868) } },
+    { {  INT64_C( 6538251607629383200) },
+      { -INT64_C( 4919426340594905822) },
+      {  INT64_C( 6538251607629383200), -INT64_C( 4919426340594905822) } },
+    { {  INT64_C( 8559323527943975354) },
+      {  INT64_C( 1940353785081436545) },
+      {  INT64_C( 8559323527943975354),  INT64_C( 1940353785081436545) } },
+    { {  INT64_C( 4534376724410480856) },
+      { -INT64_C( 4709249949882470279) },
+      {  INT64_C( 4534376724410480856), -INT64_C( 4709249949882470279) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x1x2_t r_ = { { simde_vld1_s64(test_vec[i].r0),
+                                simde_vld1_s64(test_vec[i].r1) } };
+
+    int64_t a_[2];
+    simde_vst2_s64(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2_s64(a_);
+    simde_test_arm_neon_assert_equal_i64x1(r_.val[0], simde_vld1_s64(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i64x1(r_.val[1], simde_vld1_s64(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst2_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t r0[8];
+    uint8_t r1[8];
+    uint8_t a[16];
+  } test_vec[] = {
+    { { UINT8_C(199), UINT8_C( 79), UINT8_C(158), UINT8_C(151), UINT8_C(250), UINT8_C( 50), UINT8_C( 30), UINT8_C(165) },
+      { UINT8_C(158), UINT8_C(149), UINT8_C( 97), UINT8_C( 32), UINT8_C(166), UINT8_C(103), UINT8_C(181), UINT8_C( 33) },
+      { UINT8_C(199), UINT8_C(158), UINT8_C( 79), UINT8_C(149), UINT8_C(158), UINT8_C( 97), UINT8_C(151), UINT8_C( 32),
+        UINT8_C(250), UINT8_C(166), UINT8_C( 50), UINT8_C(103), UINT8_C( 30), UINT8_C(181), UINT8_C(165), UINT8_C( 33) } },
+    { { UINT8_C(162), UINT8_C(215), UINT8_C( 55), UINT8_C( 38), UINT8_C( 37), UINT8_C(229), UINT8_C( 10), UINT8_C(226) },
+      { UINT8_C(241), UINT8_C(199), UINT8_C(205), UINT8_C( 36), UINT8_C(115), UINT8_C( 12), UINT8_C( 24), UINT8_C(222) },
+      { UINT8_C(162), UINT8_C(241), UINT8_C(215), UINT8_C(199), UINT8_C( 55), UINT8_C(205), UINT8_C( 38), UINT8_C( 36),
+        UINT8_C( 37), UINT8_C(115), UINT8_C(229), UINT8_C( 12), UINT8_C( 10), UINT8_C( 24), UINT8_C(226), UINT8_C(222) } },
+    { { UINT8_C( 21), UINT8_C(126), UINT8_C(141), UINT8_C(207), UINT8_C(218), UINT8_C(233), UINT8_C(121), UINT8_C(204) },
+      { UINT8_C(197), UINT8_C(167), UINT8_C(249), UINT8_C(116), UINT8_C( 43), UINT8_C( 19), UINT8_C(245), UINT8_C( 88) },
+      { UINT8_C( 21), UINT8_C(197), UINT8_C(126), UINT8_C(167), UINT8_C(141), UINT8_C(249), UINT8_C(207), UINT8_C(116),
+        UINT8_C(218), UINT8_C( 43), UINT8_C(233), UINT8_C( 19), UINT8_C(121), UINT8_C(245), UINT8_C(204), UINT8_C( 88) } },
+    { { UINT8_C(251), UINT8_C(190), UINT8_C(110), UINT8_C(230), UINT8_C(134), UINT8_C(125), UINT8_C(246), UINT8_C(255) },
+      { UINT8_C(197), UINT8_C(156), UINT8_C(195), UINT8_C(  3), UINT8_C( 82), UINT8_C(160), UINT8_C(103), UINT8_C(159) },
+      { UINT8_C(251), UINT8_C(197), UINT8_C(190), UINT8_C(156), UINT8_C(110), UINT8_C(195), UINT8_C(230), UINT8_C(  3),
+        UINT8_C(134), UINT8_C( 82), UINT8_C(125), UINT8_C(160), UINT8_C(246), UINT8_C(103), UINT8_C(255), UINT8_C(159) } },
+    { { UINT8_C(200), UINT8_C( 74), UINT8_C( 46), UINT8_C( 89), UINT8_C( 40), UINT8_C(154), UINT8_C(192), UINT8_C(236) },
+      { UINT8_C( 55), UINT8_C( 85), UINT8_C(221), UINT8_C(105), UINT8_C(171), UINT8_C(190), UINT8_C( 96), UINT8_C(133) },
+      { UINT8_C(200), UINT8_C( 55), UINT8_C( 74), UINT8_C( 85), UINT8_C( 46), UINT8_C(221), UINT8_C( 89), UINT8_C(105),
+        UINT8_C( 40), UINT8_C(171), UINT8_C(154), UINT8_C(190), UINT8_C(192), UINT8_C( 96), UINT8_C(236), UINT8_C(133) } },
+    { { UINT8_C( 41), UINT8_C( 14), UINT8_C(164), UINT8_C(130), UINT8_C( 78), UINT8_C(102), UINT8_C(122), UINT8_C(142) },
+      { UINT8_C(194), UINT8_C( 80), UINT8_C(201), UINT8_C(239), UINT8_C(205), UINT8_C(223), UINT8_C(235), UINT8_C(143) },
+      { UINT8_C( 41), UINT8_C(194), UINT8_C( 14), UINT8_C( 80), UINT8_C(164), UINT8_C(201), UINT8_C(130), UINT8_C(239),
+        UINT8_C( 78), UINT8_C(205), UINT8_C(102), UINT8_C(223), UINT8_C(122), UINT8_C(235), UINT8_C(142), UINT8_C(143) } },
+    { { UINT8_C( 89), UINT8_C(196), UINT8_C(139), UINT8_C( 50), UINT8_C( 96), UINT8_C(110), UINT8_C( 17), UINT8_C(179) },
+      { UINT8_C(188), UINT8_C(  9), UINT8_C( 38), UINT8_C( 20), UINT8_C(203), UINT8_C(225), UINT8_C(230), UINT8_C(122) },
+      { UINT8_C( 89), UINT8_C(188), UINT8_C(196), UINT8_C(  9), UINT8_C(139), UINT8_C( 38), UINT8_C( 50), UINT8_C( 20),
+        UINT8_C( 96), UINT8_C(203), UINT8_C(110), UINT8_C(225), UINT8_C( 17), UINT8_C(230), UINT8_C(179), UINT8_C(122) } },
+    { { UINT8_C(  3), UINT8_C( 75), UINT8_C( 48), UINT8_C(158), UINT8_C( 97), UINT8_C(232), UINT8_C(189), UINT8_C(  1) },
+      { UINT8_C(189), UINT8_C( 85), UINT8_C( 69), UINT8_C(221), UINT8_C( 25), UINT8_C(158), UINT8_C( 96), UINT8_C(213) },
+      { UINT8_C(  3), UINT8_C(189), UINT8_C( 75), UINT8_C( 85), UINT8_C( 48), UINT8_C( 69), UINT8_C(158), UINT8_C(221),
+        UINT8_C( 97), UINT8_C( 25), UINT8_C(232), UINT8_C(158), UINT8_C(189), UINT8_C( 96), UINT8_C(  1), UINT8_C(213) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x8x2_t r_ = { { simde_vld1_u8(test_vec[i].r0),
+                                simde_vld1_u8(test_vec[i].r1) } };
+
+    uint8_t a_[16];
+    simde_vst2_u8(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2_u8(a_);
+    simde_test_arm_neon_assert_equal_u8x8(r_.val[0], simde_vld1_u8(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u8x8(r_.val[1], simde_vld1_u8(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst2_u16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t r0[4];
+    uint16_t r1[4];
+    uint16_t a[8];
+  } test_vec[] = {
+    { { UINT16_C(52818), UINT16_C(32023), UINT16_C(29506), UINT16_C(61307) },
+      { UINT16_C( 2307), UINT16_C( 9569), UINT16_C(10543), UINT16_C(57119) },
+      { UINT16_C(52818), UINT16_C( 2307), UINT16_C(32023), UINT16_C( 9569), UINT16_C(29506), UINT16_C(10543), UINT16_C(61307), UINT16_C(57119) } },
+    { { UINT16_C(24680), UINT16_C(19936), UINT16_C( 7817), UINT16_C(65189) },
+      { UINT16_C(64407), UINT16_C(61749), UINT16_C(44301), UINT16_C(20015) },
+      { UINT16_C(24680), UINT16_C(64407), UINT16_C(19936), UINT16_C(61749), UINT16_C( 7817), UINT16_C(44301), UINT16_C(65189), UINT16_C(20015) } },
+    { { UINT16_C(35353), UINT16_C(20115), UINT16_C(46284), UINT16_C(37745) },
+      { UINT16_C(39057), UINT16_C( 1211), UINT16_C( 9308), UINT16_C( 8864) },
+      { UINT16_C(35353), UINT16_C(39057), UINT16_C(20115), UINT16_C( 1211), UINT16_C(46284), UINT16_C( 9308), UINT16_C(37745), UINT16_C( 8864) } },
+    { { UINT16_C(24424), UINT16_C(12865), UINT16_C(24875), UINT16_C(47210) },
+      { UINT16_C(35370), UINT16_C(46185), UINT16_C( 7701), UINT16_C(21246) },
+      { UINT16_C(24424), UINT16_C(35370), UINT16_C(12865), UINT16_C(46185), UINT16_C(24875), UINT16_C( 7701), UINT16_C(47210), UINT16_C(21246) } },
+    { { UINT16_C( 4869), UINT16_C(64888), UINT16_C(36077), UINT16_C(52359) },
+      { UINT16_C(20733), UINT16_C( 4251), UINT16_C(13645), UINT16_C(30497) },
+      { UINT16_C( 4869), UINT16_C(20733), UINT16_C(64888), UINT16_C( 4251), UINT16_C(36077), UINT16_C(13645), UINT16_C(52359), UINT16_C(30497) } },
+    { { UINT16_C(47001), UINT16_C(32825), UINT16_C(53532), UINT16_C(26079) },
+      { UINT16_C(25366), UINT16_C(55505), UINT16_C(10264), UINT16_C(42545) },
+      { UINT16_C(47001), UINT16_C(25366), UINT16_C(32825), UINT16_C(55505), UINT16_C(53532), UINT16_C(10264), UINT16_C(26079), UINT16_C(42545) } },
+    { { UINT16_C(28713), UINT16_C(28012), UINT16_C( 5305), UINT16_C(46173) },
+      { UINT16_C(22818), UINT16_C( 2758), UINT16_C(48299), UINT16_C(64724) },
+      { UINT16_C(28713), UINT16_C(22818), UINT16_C(28012), UINT16_C( 2758), UINT16_C( 5305), UINT16_C(48299), UINT16_C(46173), UINT16_C(64724) } },
+    { { UINT16_C(62716), UINT16_C(21235), UINT16_C(57866), UINT16_C( 2467) },
+      { UINT16_C(36643), UINT16_C( 7295), UINT16_C(28483), UINT16_C(14646) },
+      { UINT16_C(62716), UINT16_C(36643), UINT16_C(21235), UINT16_C( 7295), UINT16_C(57866), UINT16_C(28483), UINT16_C( 2467), UINT16_C(14646) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x4x2_t r_ = { { simde_vld1_u16(test_vec[i].r0),
+                                 simde_vld1_u16(test_vec[i].r1) } };
+
+    uint16_t a_[8];
+    simde_vst2_u16(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2_u16(a_);
+    simde_test_arm_neon_assert_equal_u16x4(r_.val[0], simde_vld1_u16(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u16x4(r_.val[1], simde_vld1_u16(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst2_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t r0[2];
+    uint32_t r1[2];
+    uint32_t a[4];
+  } test_vec[] = {
+    { { UINT32_C(4166876150), UINT32_C(1675663821) },
+      { UINT32_C(4045145269), UINT32_C(3409660034) },
+      { UINT32_C(4166876150), UINT32_C(4045145269), UINT32_C(1675663821), UINT32_C(3409660034) } },
+    { { UINT32_C(1511478004), UINT32_C(2635369869) },
+      { UINT32_C(2607853978), UINT32_C(3245604818) },
+      { UINT32_C(1511478004), UINT32_C(2607853978), UINT32_C(2635369869), UINT32_C(3245604818) } },
+    { { UINT32_C( 693525737), UINT32_C(3786831780) },
+      { UINT32_C( 888329619), UINT32_C(2383102856) },
+      { UINT32_C( 693525737), UINT32_C( 888329619), UINT32_C(3786831780), UINT32_C(2383102856) } },
+    { { UINT32_C(3331083705), UINT32_C( 355696670) },
+      { UINT32_C( 765646260), UINT32_C( 459740788) },
+      { UINT32_C(3331083705), UINT32_C( 765646260), UINT32_C( 355696670), UINT32_C( 459740788) } },
+    { { UINT32_C(2246401154), UINT32_C(2207336755) },
+      { UINT32_C( 527625497), UINT32_C(2752509249) },
+      { UINT32_C(2246401154), UINT32_C( 527625497), UINT32_C(2207336755), UINT32_C(2752509249) } },
+    { { UINT32_C(3310894343), UINT32_C(3227152916) },
+      { UINT32_C(2795073775), UINT32_C(1086419204) },
+      { UINT32_C(3310894343), UINT32_C(2795073775), UINT32_C(3227152916), UINT32_C(1086419204) } },
+    { { UINT32_C(1623669411), UINT32_C(2102721251) },
+      { UINT32_C(1140258551), UINT32_C(1970453179) },
+      { UINT32_C(1623669411), UINT32_C(1140258551), UINT32_C(2102721251), UINT32_C(1970453179) } },
+    { { UINT32_C(3534312548), UINT32_C(2518746121) },
+      { UINT32_C(3447794983), UINT32_C(3163430497) },
+      { UINT32_C(3534312548), UINT32_C(3447794983), UINT32_C(2518746121), UINT32_C(3163430497) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x2x2_t r_ = { { simde_vld1_u32(test_vec[i].r0),
+                                 simde_vld1_u32(test_vec[i].r1) } };
+
+    uint32_t a_[4];
+    simde_vst2_u32(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2_u32(a_);
+    simde_test_arm_neon_assert_equal_u32x2(r_.val[0], simde_vld1_u32(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u32x2(r_.val[1], simde_vld1_u32(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst2_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t r0[1];
+    uint64_t r1[1];
+    uint64_t a[2];
+  } test_vec[] = {
+    { { UINT64_C( 6952078660078951022) },
+      { UINT64_C(  604097322355506717) },
+      { UINT64_C( 6952078660078951022), UINT64_C(  604097322355506717) } },
+    { { UINT64_C(18403382177658672794) },
+      { UINT64_C( 8965273137757941629) },
+      { UINT64_C(18403382177658672794), UINT64_C( 8965273137757941629) } },
+    { { UINT64_C(14114048671779123604) },
+      { UINT64_C( 1013738951921335084) },
+      { UINT64_C(14114048671779123604), UINT64_C( 1013738951921335084) } },
+    { { UINT64_C( 9220315468111913354) },
+      { UINT64_C( 6535867854764668610) },
+      { UINT64_C( 9220315468111913354), UINT64_C( 6535867854764668610) } },
+    { { UINT64_C(11593322554978681119) },
+      { UINT64_C(15961471637708812563) },
+      { UINT64_C(11593322554978681119), UINT64_C(15961471637708812563) } },
+    { { UINT64_C( 1928944333542971317) },
+      { UINT64_C(13761057989601837692) },
+      { UINT64_C( 1928944333542971317), UINT64_C(13761057989601837692) } },
+    { { UINT64_C(11689187078375704458) },
+      { UINT64_C( 4885454745493873183) },
+      { UINT64_C(11689187078375704458), UINT64_C( 4885454745493873183) } },
+    { { UINT64_C(11382809530957993420) },
+      { UINT64_C( 2470218417907140834) },
+      { UINT64_C(11382809530957993420), UINT64_C( 2470218417907140834) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x1x2_t r_ = { { simde_vld1_u64(test_vec[i].r0),
+                                 simde_vld1_u64(test_vec[i].r1) } };
+
+    uint64_t a_[2];
+    simde_vst2_u64(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2_u64(a_);
+    simde_test_arm_neon_assert_equal_u64x1(r_.val[0], simde_vld1_u64(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u64x1(r_.val[1], simde_vld1_u64(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst2q_f32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float32 r0[4];
+    simde_float32 r1[4];
+    simde_float32 a[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   542.37), SIMDE_FLOAT32_C(    -9.55), SIMDE_FLOAT32_C(  -935.68), SIMDE_FLOAT32_C(   800.90) },
+      { SIMDE_FLOAT32_C(   842.81), SIMDE_FLOAT32_C(    45.18), SIMDE_FLOAT32_C(  -981.66), SIMDE_FLOAT32_C(   685.55) },
+      { SIMDE_FLOAT32_C(   542.37), SIMDE_FLOAT32_C(   842.81), SIMDE_FLOAT32_C(    -9.55), SIMDE_FLOAT32_C(    45.18),
+        SIMDE_FLOAT32_C(  -935.68), SIMDE_FLOAT32_C(  -981.66), SIMDE_FLOAT32_C(   800.90), SIMDE_FLOAT32_C(   685.55) } },
+    { { SIMDE_FLOAT32_C(  -432.55), SIMDE_FLOAT32_C(  -475.10), SIMDE_FLOAT32_C(   649.80), SIMDE_FLOAT32_C(  -879.13) },
+      { SIMDE_FLOAT32_C(   512.31), SIMDE_FLOAT32_C(   203.72), SIMDE_FLOAT32_C(    21.94), SIMDE_FLOAT32_C(   992.78) },
+      { SIMDE_FLOAT32_C(  -432.55), SIMDE_FLOAT32_C(   512.31), SIMDE_FLOAT32_C(  -475.10), SIMDE_FLOAT32_C(   203.72),
+        SIMDE_FLOAT32_C(   649.80), SIMDE_FLOAT32_C(    21.94), SIMDE_FLOAT32_C(  -879.13), SIMDE_FLOAT32_C(   992.78) } },
+    { { SIMDE_FLOAT32_C(  -535.04), SIMDE_FLOAT32_C(   408.82), SIMDE_FLOAT32_C(   -24.16), SIMDE_FLOAT32_C(    75.05) },
+      { SIMDE_FLOAT32_C(    97.58), SIMDE_FLOAT32_C(  -134.97), SIMDE_FLOAT32_C(  -957.41), SIMDE_FLOAT32_C(   902.18) },
+      { SIMDE_FLOAT32_C(  -535.04), SIMDE_FLOAT32_C(    97.58), SIMDE_FLOAT32_C(   408.82), SIMDE_FLOAT32_C(  -134.97),
+        SIMDE_FLOAT32_C(   -24.16), SIMDE_FLOAT32_C(  -957.41), SIMDE_FLOAT32_C(    75.05), SIMDE_FLOAT32_C(   902.18) } },
+    { { SIMDE_FLOAT32_C(  -714.74), SIMDE_FLOAT32_C(  -196.35), SIMDE_FLOAT32_C(  -112.60), SIMDE_FLOAT32_C(   295.86) },
+      { SIMDE_FLOAT32_C(   437.97), SIMDE_FLOAT32_C(   172.43), SIMDE_FLOAT32_C(  -121.77), SIMDE_FLOAT32_C(  -535.06) },
+      { SIMDE_FLOAT32_C(  -714.74), SIMDE_FLOAT32_C(   437.97), SIMDE_FLOAT32_C(  -196.35), SIMDE_FLOAT32_C(   172.43),
+        SIMDE_FLOAT32_C(  -112.60), SIMDE_FLOAT32_C(  -121.77), SIMDE_FLOAT32_C(   295.86), SIMDE_FLOAT32_C(  -535.06) } },
+    { { SIMDE_FLOAT32_C(   704.45), SIMDE_FLOAT32_C(   795.31), SIMDE_FLOAT32_C(   687.12), SIMDE_FLOAT32_C(   549.38) },
+      { SIMDE_FLOAT32_C(   804.41), SIMDE_FLOAT32_C(   498.29), SIMDE_FLOAT32_C(  -310.30), SIMDE_FLOAT32_C(  -691.21) },
+      { SIMDE_FLOAT32_C(   704.45), SIMDE_FLOAT32_C(   804.41), SIMDE_FLOAT32_C(   795.31), SIMDE_FLOAT32_C(   498.29),
+        SIMDE_FLOAT32_C(   687.12), SIMDE_FLOAT32_C(  -310.30), SIMDE_FLOAT32_C(   549.38), SIMDE_FLOAT32_C(  -691.21) } },
+    { { SIMDE_FLOAT32_C(  -973.05), SIMDE_FLOAT32_C(  -457.77), SIMDE_FLOAT32_C(   384.73), SIMDE_FLOAT32_C(  -401.46) },
+      { SIMDE_FLOAT32_C(   929.11), SIMDE_FLOAT32_C(   -86.44), SIMDE_FLOAT32_C(  -596.27), SIMDE_FLOAT32_C(  -979.32) },
+      { SIMDE_FLOAT32_C(  -973.05), SIMDE_FLOAT32_C(   929.11), SIMDE_FLOAT32_C(  -457.77), SIMDE_FLOAT32_C(   -86.44),
+        SIMDE_FLOAT32_C(   384.73), SIMDE_FLOAT32_C(  -596.27), SIMDE_FLOAT32_C(  -401.46), SIMDE_FLOAT32_C(  -979.32) } },
+    { { SIMDE_FLOAT32_C(  -683.87), SIMDE_FLOAT32_C(  -693.78), SIMDE_FLOAT32_C(   101.65), SIMDE_FLOAT32_C(  -666.59) },
+      { SIMDE_FLOAT32_C(   286.75), SIMDE_FLOAT32_C(   257.05), SIMDE_FLOAT32_C(  -755.43), SIMDE_FLOAT32_C(  -752.11) },
+      { SIMDE_FLOAT32_C(  -683.87), SIMDE_FLOAT32_C(   286.75), SIMDE_FLOAT32_C(  -693.78), SIMDE_FLOAT32_C(   257.05),
+        SIMDE_FLOAT32_C(   101.65), SIMDE_FLOAT32_C(  -755.43), SIMDE_FLOAT32_C(  -666.59), SIMDE_FLOAT32_C(  -752.11) } },
+    { { SIMDE_FLOAT32_C(   400.87), SIMDE_FLOAT32_C(  -583.53), SIMDE_FLOAT32_C(  -964.04), SIMDE_FLOAT32_C(   559.84) },
+      { SIMDE_FLOAT32_C(  -560.85), SIMDE_FLOAT32_C(   136.05), SIMDE_FLOAT32_C(  -510.50), SIMDE_FLOAT32_C(  -136.32) },
+      { SIMDE_FLOAT32_C(   400.87), SIMDE_FLOAT32_C(  -560.85), SIMDE_FLOAT32_C(  -583.53), SIMDE_FLOAT32_C(   136.05),
+        SIMDE_FLOAT32_C(  -964.04), SIMDE_FLOAT32_C(  -510.50), SIMDE_FLOAT32_C(   559.84), SIMDE_FLOAT32_C(  -136.32) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float32x4x2_t r_ = { { simde_vld1q_f32(test_vec[i].r0),
+                                  simde_vld1q_f32(test_vec[i].r1) } };
+
+    simde_float32 a_[8];
+    simde_vst2q_f32(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2q_f32(a_);
+    simde_test_arm_neon_assert_equal_f32x4(r_.val[0], simde_vld1q_f32(test_vec[i].r0), 1);
+    simde_test_arm_neon_assert_equal_f32x4(r_.val[1], simde_vld1q_f32(test_vec[i].r1), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst2q_f64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    simde_float64 r0[2];
+    simde_float64 r1[2];
+    simde_float64 a[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   577.20), SIMDE_FLOAT64_C(   857.05) },
+      { SIMDE_FLOAT64_C(   396.94), SIMDE_FLOAT64_C(   625.04) },
+      { SIMDE_FLOAT64_C(   577.20), SIMDE_FLOAT64_C(   396.94),
+        SIMDE_FLOAT64_C(   857.05), SIMDE_FLOAT64_C(   625.04) } },
+    { { SIMDE_FLOAT64_C(  -200.64), SIMDE_FLOAT64_C(   919.12) },
+      { SIMDE_FLOAT64_C(   612.95), SIMDE_FLOAT64_C(   374.07) },
+      { SIMDE_FLOAT64_C(  -200.64), SIMDE_FLOAT64_C(   612.95),
+        SIMDE_FLOAT64_C(   919.12), SIMDE_FLOAT64_C(   374.07) } },
+    { { SIMDE_FLOAT64_C(   768.98), SIMDE_FLOAT64_C(  -164.53) },
+      { SIMDE_FLOAT64_C(   154.10), SIMDE_FLOAT64_C(  -907.18) },
+      { SIMDE_FLOAT64_C(   768.98), SIMDE_FLOAT64_C(   154.10),
+        SIMDE_FLOAT64_C(  -164.53), SIMDE_FLOAT64_C(  -907.18) } },
+    { { SIMDE_FLOAT64_C(  -191.87), SIMDE_FLOAT64_C(   613.04) },
+      { SIMDE_FLOAT64_C(   -35.69), SIMDE_FLOAT64_C(  -924.11) },
+      { SIMDE_FLOAT64_C(  -191.87), SIMDE_FLOAT64_C(   -35.69),
+        SIMDE_FLOAT64_C(   613.04), SIMDE_FLOAT64_C(  -924.11) } },
+    { { SIMDE_FLOAT64_C(   281.13), SIMDE_FLOAT64_C(   558.00) },
+      { SIMDE_FLOAT64_C(  -486.18), SIMDE_FLOAT64_C(   -56.49) },
+      { SIMDE_FLOAT64_C(   281.13), SIMDE_FLOAT64_C(  -486.18),
+        SIMDE_FLOAT64_C(   558.00), SIMDE_FLOAT64_C(   -56.49) } },
+    { { SIMDE_FLOAT64_C(  -476.39), SIMDE_FLOAT64_C(   649.96) },
+      { SIMDE_FLOAT64_C(  -421.78), SIMDE_FLOAT64_C(  -257.83) },
+      { SIMDE_FLOAT64_C(  -476.39), SIMDE_FLOAT64_C(  -421.78),
+        SIMDE_FLOAT64_C(   649.96), SIMDE_FLOAT64_C(  -257.83) } },
+    { { SIMDE_FLOAT64_C(   -18.04), SIMDE_FLOAT64_C(  -471.81) },
+      { SIMDE_FLOAT64_C(   832.89), SIMDE_FLOAT64_C(  -413.95) },
+      { SIMDE_FLOAT64_C(   -18.04), SIMDE_FLOAT64_C(   832.89),
+        SIMDE_FLOAT64_C(  -471.81), SIMDE_FLOAT64_C(  -413.95) } },
+    { { SIMDE_FLOAT64_C(  -769.12), SIMDE_FLOAT64_C(   169.75) },
+      { SIMDE_FLOAT64_C(   -26.51), SIMDE_FLOAT64_C(   641.22) },
+      { SIMDE_FLOAT64_C(  -769.12), SIMDE_FLOAT64_C(   -26.51),
+        SIMDE_FLOAT64_C(   169.75), SIMDE_FLOAT64_C(   641.22) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_float64x2x2_t r_ = { { simde_vld1q_f64(test_vec[i].r0),
+                                  simde_vld1q_f64(test_vec[i].r1) } };
+
+    simde_float64 a_[4];
+    simde_vst2q_f64(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2q_f64(a_);
+    simde_test_arm_neon_assert_equal_f64x2(r_.val[0], simde_vld1q_f64(test_vec[i].r0), 1);
+    simde_test_arm_neon_assert_equal_f64x2(r_.val[1], simde_vld1q_f64(test_vec[i].r1), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst2q_s8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int8_t r0[16];
+    int8_t r1[16];
+    int8_t a[32];
+  } test_vec[] = {
+    { { -INT8_C(  92),  INT8_C(  65),  INT8_C(  57), -INT8_C(  89), -INT8_C(  48), -INT8_C(  49), -INT8_C(  28), -INT8_C(  99),
+        -INT8_C(  58),  INT8_C(  42),  INT8_C(  46), -INT8_C(  14),  INT8_C( 105), -INT8_C(  68), -INT8_C( 115), -INT8_C(  32) },
+      {  INT8_C(  63),  INT8_C(  94),  INT8_C(  84), -INT8_C(  19),  INT8_C(   4),  INT8_C(  49), -INT8_C( 100),  INT8_C(  33),
+         INT8_C( 121), -INT8_C(   6), -INT8_C(  72),  INT8_C(  15),  INT8_C(  99), -INT8_C(  34),  INT8_C(  58), -INT8_C(  77) },
+      { -INT8_C(  92),  INT8_C(  63),  INT8_C(  65),  INT8_C(  94),  INT8_C(  57),  INT8_C(  84), -INT8_C(  89), -INT8_C(  19),
+        -INT8_C(  48),  INT8_C(   4), -INT8_C(  49),  INT8_C(  49), -INT8_C(  28), -INT8_C( 100), -INT8_C(  99),  INT8_C(  33),
+        -INT8_C(  58),  INT8_C( 121),  INT8_C(  42), -INT8_C(   6),  INT8_C(  46), -INT8_C(  72), -INT8_C(  14),  INT8_C(  15),
+         INT8_C( 105),  INT8_C(  99), -INT8_C(  68), -INT8_C(  34), -INT8_C( 115),  INT8_C(  58), -INT8_C(  32), -INT8_C(  77) } },
+    { { -INT8_C( 116), -INT8_C(   1),  INT8_C(  33), -INT8_C(  50),  INT8_C(  28), -INT8_C(  43), -INT8_C(  16), -INT8_C(  80),
+         INT8_C(  70),  INT8_C( 106), -INT8_C( 123), -INT8_C(  19),  INT8_C(   1), -INT8_C(  76), -INT8_C(  86), -INT8_C( 119) },
+      { -INT8_C(  72), -INT8_C(  73), -INT8_C(  85),  INT8_C(  95),  INT8_C( 119), -INT8_C(  41), -INT8_C( 124),  INT8_C(  43),
+         INT8_C(  71), -INT8_C(  68),  INT8_C(  90),  INT8_C(  39),  INT8_C( 119), -INT8_C(  12), -INT8_C(  64),  INT8_C(  61) },
+      { -INT8_C( 116), -INT8_C(  72), -INT8_C(   1), -INT8_C(  73),  INT8_C(  33), -INT8_C(  85), -INT8_C(  50),  INT8_C(  95),
+         INT8_C(  28),  INT8_C( 119), -INT8_C(  43), -INT8_C(  41), -INT8_C(  16), -INT8_C( 124), -INT8_C(  80),  INT8_C(  43),
+         INT8_C(  70),  INT8_C(  71),  INT8_C( 106), -INT8_C(  68), -INT8_C( 123),  INT8_C(  90), -INT8_C(  19),  INT8_C(  39),
+         INT8_C(   1),  INT8_C( 119), -INT8_C(  76), -INT8_C(  12), -INT8_C(  86), -INT8_C(  64), -INT8_C( 119),  INT8_C(  61) } },
+    { { -INT8_C(  37),  INT8_C(   8),  INT8_C(  89), -INT8_C(  31), -INT8_C(  79), -INT8_C(  56),  INT8_C(  52),  INT8_C(  25),
+         INT8_C( 103),  INT8_C(  85), -INT8_C(  81),  INT8_C(  50), -INT8_C(  33), -INT8_C(   5), -INT8_C(  91), -INT8_C(  43) },
+      { -INT8_C(  33),  INT8_C( 101),  INT8_C( 104),  INT8_C(  89),  INT8_C(  39), -INT8_C(  90), -INT8_C(  54),  INT8_C(  46),
+         INT8_C(  65),  INT8_C(  70),  INT8_C(  51),  INT8_C(  46),  INT8_C(  61),  INT8_C( 119), -INT8_C( 107),  INT8_C(  98) },
+      { -INT8_C(  37), -INT8_C(  33),  INT8_C(   8),  INT8_C( 101),  INT8_C(  89),  INT8_C( 104), -INT8_C(  31),  INT8_C(  89),
+        -INT8_C(  79),  INT8_C(  39), -INT8_C(  56), -INT8_C(  90),  INT8_C(  52), -INT8_C(  54),  INT8_C(  25),  INT8_C(  46),
+         INT8_C( 103),  INT8_C(  65),  INT8_C(  85),  INT8_C(  70), -INT8_C(  81),  INT8_C(  51),  INT8_C(  50),  INT8_C(  46),
+        -INT8_C(  33),  INT8_C(  61), -INT8_C(   5),  INT8_C( 119), -INT8_C(  91), -INT8_C( 107), -INT8_C(  43),  INT8_C(  98) } },
+    { { -INT8_C( 113), -INT8_C(  65),  INT8_C(  57), -INT8_C(  50), -INT8_C(  44),  INT8_C(  16), -INT8_C(  30),  INT8_C(  83),
+         INT8_C( 122),  INT8_C(  73), -INT8_C(  85),  INT8_C(  57), -INT8_C(  26), -INT8_C( 120),  INT8_C(  33),  INT8_C(  20) },
+      { -INT8_C(  58),  INT8_C( 107), -INT8_C(  59), -INT8_C(  73),  INT8_C(  76),  INT8_C( 125),  INT8_C(  29),  INT8_C(  69),
+         INT8_C(  63), -INT8_C(  68),  INT8_C(  75), -INT8_C(  96),  INT8_C(  96), -INT8_C( 121),  INT8_C( 101), -INT8_C(  74) },
+      { -INT8_C( 113), -INT8_C(  58), -INT8_C(  65),  INT8_C( 107),  INT8_C(  57), -INT8_C(  59), -INT8_C(  50), -INT8_C(  73),
+        -INT8_C(  44),  INT8_C(  76),  INT8_C(  16),  INT8_C( 125), -INT8_C(  30),  INT8_C(  29),  INT8_C(  83),  INT8_C(  69),
+         INT8_C( 122),  INT8_C(  63),  INT8_C(  73), -INT8_C(  68), -INT8_C(  85),  INT8_C(  75),  INT8_C(  57), -INT8_C(  96),
+        -INT8_C(  26),  INT8_C(  96), -INT8_C( 120), -INT8_C( 121),  INT8_C(  33),  INT8_C( 101),  INT8_C(  20), -INT8_C(  74) } },
+    { {  INT8_C(  83), -INT8_C(  31),  INT8_C( 123), -INT8_C(  79),  INT8_C(   0),  INT8_C(  39),  INT8_C(  52),  INT8_C(  43),
+         INT8_C(   4), -INT8_C(  73),  INT8_C( 121), -INT8_C(  85),  INT8_C(  40),  INT8_C( 103), -INT8_C(  17), -INT8_C(  30) },
+      {  INT8_C(  42),  INT8_C( 110), -INT8_C(  52),  INT8_C(  70), -INT8_C(  94),  INT8_C(   5), -INT8_C(  29), -INT8_C( 115),
+        -INT8_C(  92),  INT8_C(  55), -INT8_C( 126),  INT8_C(  66), -INT8_C( 104), -INT8_C(  85), -INT8_C(  11), -INT8_C(  99) },
+      {  INT8_C(  83),  INT8_C(  42), -INT8_C(  31),  INT8_C( 110),  INT8_C( 123), -INT8_C(  52), -INT8_C(  79),  INT8_C(  70),
+         INT8_C(   0), -INT8_C(  94),  INT8_C(  39),  INT8_C(   5),  INT8_C(  52), -INT8_C(  29),  INT8_C(  43), -INT8_C( 115),
+         INT8_C(   4), -INT8_C(  92), -INT8_C(  73),  INT8_C(  55),  INT8_C( 121), -INT8_C( 126), -INT8_C(  85),  INT8_C(  66),
+         INT8_C(  40), -INT8_C( 104),  INT8_C( 103), -INT8_C(  85), -INT8_C(  17), -INT8_C(  11), -INT8_C(  30), -INT8_C(  99) } },
+    { {  INT8_C(  68), -INT8_C(   6), -INT8_C( 115), -INT8_C( 108),  INT8_C(  35), -INT8_C(  44), -INT8_C(  99), -INT8_C(  82),
+         INT8_C(   3),  INT8_C(  22), -INT8_C(  52),  INT8_C(  40), -INT8_C(  13),  INT8_C(  96),  INT8_C(  55), -INT8_C(  53) },
+      { -INT8_C(  22),  INT8_C(  69), -INT8_C(  27),  INT8_C( 116),  INT8_C(  59),  INT8_C(  14), -INT8_C(  98), -INT8_C(  56),
+        -INT8_C(  38), -INT8_C( 126),  INT8_C(  52), -INT8_C(  23),  INT8_C(  86),  INT8_C(  75),  INT8_C( 123),  INT8_C(  97) },
+      {  INT8_C(  68), -INT8_C(  22), -INT8_C(   6),  INT8_C(  69), -INT8_C( 115), -INT8_C(  27), -INT8_C( 108),  INT8_C( 116),
+         INT8_C(  35),  INT8_C(  59), -INT8_C(  44),  INT8_C(  14), -INT8_C(  99), -INT8_C(  98), -INT8_C(  82), -INT8_C(  56),
+         INT8_C(   3), -INT8_C(  38),  INT8_C(  22), -INT8_C( 126), -INT8_C(  52),  INT8_C(  52),  INT8_C(  40), -INT8_C(  23),
+        -INT8_C(  13),  INT8_C(  86),  INT8_C(  96),  INT8_C(  75),  INT8_C(  55),  INT8_C( 123), -INT8_C(  53),  INT8_C(  97) } },
+    { { -INT8_C(  62), -INT8_C(   9),  INT8_C(  33),  INT8_C( 105), -INT8_C(  47),  INT8_C(  98),  INT8_C(  52), -INT8_C(  60),
+         INT8_C(  89), -INT8_C(  38), -INT8_C(  93),  INT8_C(   8), -INT8_C(  39),  INT8_C(  39),  INT8_C( 112),  INT8_C(  34) },
+      { -INT8_C(  37), -INT8_C(  75),  INT8_C(  34), -INT8_C(  86),  INT8_C(  82), -INT8_C( 104), -INT8_C(  56),  INT8_C(  76),
+         INT8_C(  73), -INT8_C(  86), -INT8_C( 127),  INT8_C( 120), -INT8_C(  40), -INT8_C( 116), -INT8_C(  85),  INT8_C(  75) },
+      { -INT8_C(  62), -INT8_C(  37), -INT8_C(   9), -INT8_C(  75),  INT8_C(  33),  INT8_C(  34),  INT8_C( 105), -INT8_C(  86),
+        -INT8_C(  47),  INT8_C(  82),  INT8_C(  98), -INT8_C( 104),  INT8_C(  52), -INT8_C(  56), -INT8_C(  60),  INT8_C(  76),
+         INT8_C(  89),  INT8_C(  73), -INT8_C(  38), -INT8_C(  86), -INT8_C(  93), -INT8_C( 127),  INT8_C(   8),  INT8_C( 120),
+        -INT8_C(  39), -INT8_C(  40),  INT8_C(  39), -INT8_C( 116),  INT8_C( 112), -INT8_C(  85),  INT8_C(  34),  INT8_C(  75) } },
+    { { -INT8_C(  39),  INT8_C(  50), -INT8_C(  73),  INT8_C(   2), -INT8_C( 121), -INT8_C( 117),  INT8_C(  78), -INT8_C( 120),
+        -INT8_C(  83), -INT8_C(  44),  INT8_C(  19),  INT8_C(  47),  INT8_C(  14), -INT8_C(  68),  INT8_C(  90), -INT8_C(  95) },
+      {  INT8_C(  89), -INT8_C(  45),  INT8_C(  32),  INT8_C(  56), -INT8_C(  84),  INT8_C(  28),  INT8_C(  67), -INT8_C(  77),
+        -INT8_C( 103), -INT8_C(  83),  INT8_C( 110),  INT8_C(  60), -INT8_C(  49), -INT8_C(  22), -INT8_C(  63), -INT8_C(  44) },
+      { -INT8_C(  39),  INT8_C(  89),  INT8_C(  50), -INT8_C(  45), -INT8_C(  73),  INT8_C(  32),  INT8_C(   2),  INT8_C(  56),
+        -INT8_C( 121), -INT8_C(  84), -INT8_C( 117),  INT8_C(  28),  INT8_C(  78),  INT8_C(  67), -INT8_C( 120), -INT8_C(  77),
+        -INT8_C(  83), -INT8_C( 103), -INT8_C(  44), -INT8_C(  83),  INT8_C(  19),  INT8_C( 110),  INT8_C(  47),  INT8_C(  60),
+         INT8_C(  14), -INT8_C(  49), -INT8_C(  68), -INT8_C(  22),  INT8_C(  90), -INT8_C(  63), -INT8_C(  95), -INT8_C(  44) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int8x16x2_t r_ = { { simde_vld1q_s8(test_vec[i].r0),
+                                simde_vld1q_s8(test_vec[i].r1) } };
+
+    int8_t a_[32];
+    simde_vst2q_s8(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2q_s8(a_);
+    simde_test_arm_neon_assert_equal_i8x16(r_.val[0], simde_vld1q_s8(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i8x16(r_.val[1], simde_vld1q_s8(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst2q_s16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int16_t r0[8];
+    int16_t r1[8];
+    int16_t a[16];
+  } test_vec[] = {
+    { { -INT16_C( 18572),  INT16_C( 14884), -INT16_C(  6807), -INT16_C(  7600),  INT16_C( 19107),  INT16_C( 19325),  INT16_C( 23259), -INT16_C( 13346) },
+      {  INT16_C( 16126),  INT16_C( 28038),  INT16_C( 15029), -INT16_C( 30076), -INT16_C( 16771), -INT16_C( 13164), -INT16_C( 11718), -INT16_C( 17846) },
+      { -INT16_C( 18572),  INT16_C( 16126),  INT16_C( 14884),  INT16_C( 28038), -INT16_C(  6807),  INT16_C( 15029), -INT16_C(  7600), -INT16_C( 30076),
+         INT16_C( 19107), -INT16_C( 16771),  INT16_C( 19325), -INT16_C( 13164),  INT16_C( 23259), -INT16_C( 11718), -INT16_C( 13346), -INT16_C( 17846) } },
+    { { -INT16_C( 12830),  INT16_C( 21058), -INT16_C(  4368),  INT16_C( 17681),  INT16_C( 24542), -INT16_C( 20358),  INT16_C( 32503),  INT16_C( 29892) },
+      { -INT16_C( 27279),  INT16_C(  7728),  INT16_C( 30447),  INT16_C( 26204),  INT16_C( 27418), -INT16_C(  2352), -INT16_C(  2561),  INT16_C( 13873) },
+      { -INT16_C( 12830), -INT16_C( 27279),  INT16_C( 21058),  INT16_C(  7728), -INT16_C(  4368),  INT16_C( 30447),  INT16_C( 17681),  INT16_C( 26204),
+         INT16_C( 24542),  INT16_C( 27418), -INT16_C( 20358), -INT16_C(  2352),  INT16_C( 32503), -INT16_C(  2561),  INT16_C( 29892),  INT16_C( 13873) } },
+    { {  INT16_C( 12636),  INT16_C( 28418),  INT16_C( 18645), -INT16_C( 20750), -INT16_C( 20521),  INT16_C( 14375),  INT16_C(  7592), -INT16_C(  4046) },
+      {  INT16_C( 31569), -INT16_C( 29478),  INT16_C( 24928), -INT16_C(  7814),  INT16_C( 26975), -INT16_C(   857), -INT16_C( 27214),  INT16_C( 26314) },
+      {  INT16_C( 12636),  INT16_C( 31569),  INT16_C( 28418), -INT16_C( 29478),  INT16_C( 18645),  INT16_C( 24928), -INT16_C( 20750), -INT16_C(  7814),
+        -INT16_C( 20521),  INT16_C( 26975),  INT16_C( 14375), -INT16_C(   857),  INT16_C(  7592), -INT16_C( 27214), -INT16_C(  4046),  INT16_C( 26314) } },
+    { {  INT16_C( 14068),  INT16_C(  3636), -INT16_C(   883),  INT16_C( 26509),  INT16_C( 26819),  INT16_C( 28367), -INT16_C( 21830),  INT16_C( 20786) },
+      {  INT16_C(  3198),  INT16_C( 26832), -INT16_C( 24864),  INT16_C(  7622),  INT16_C( 19948), -INT16_C( 32185),  INT16_C( 14587),  INT16_C( 17462) },
+      {  INT16_C( 14068),  INT16_C(  3198),  INT16_C(  3636),  INT16_C( 26832), -INT16_C(   883), -INT16_C( 24864),  INT16_C( 26509),  INT16_C(  7622),
+         INT16_C( 26819),  INT16_C( 19948),  INT16_C( 28367), -INT16_C( 32185), -INT16_C( 21830),  INT16_C( 14587),  INT16_C( 20786),  INT16_C( 17462) } },
+    { { -INT16_C( 30726),  INT16_C( 31973), -INT16_C( 12478),  INT16_C(  1378), -INT16_C( 23489),  INT16_C( 14534),  INT16_C(  8878), -INT16_C( 32643) },
+      {  INT16_C(  8519),  INT16_C( 25411), -INT16_C( 28661),  INT16_C( 24348),  INT16_C( 29550),  INT16_C( 31864),  INT16_C( 30492),  INT16_C( 30106) },
+      { -INT16_C( 30726),  INT16_C(  8519),  INT16_C( 31973),  INT16_C( 25411), -INT16_C( 12478), -INT16_C( 28661),  INT16_C(  1378),  INT16_C( 24348),
+        -INT16_C( 23489),  INT16_C( 29550),  INT16_C( 14534),  INT16_C( 31864),  INT16_C(  8878),  INT16_C( 30492), -INT16_C( 32643),  INT16_C( 30106) } },
+    { { -INT16_C(  3887), -INT16_C( 26868),  INT16_C(  4861), -INT16_C(  6064), -INT16_C(  8948),  INT16_C( 31701),  INT16_C(  6958),  INT16_C( 23820) },
+      { -INT16_C(  6657),  INT16_C( 18870), -INT16_C(  3884), -INT16_C(   752),  INT16_C( 16369), -INT16_C( 15384), -INT16_C( 20548),  INT16_C(  4307) },
+      { -INT16_C(  3887), -INT16_C(  6657), -INT16_C( 26868),  INT16_C( 18870),  INT16_C(  4861), -INT16_C(  3884), -INT16_C(  6064), -INT16_C(   752),
+        -INT16_C(  8948),  INT16_C( 16369),  INT16_C( 31701), -INT16_C( 15384),  INT16_C(  6958), -INT16_C( 20548),  INT16_C( 23820),  INT16_C(  4307) } },
+    { { -INT16_C( 13219),  INT16_C(  9134),  INT16_C( 17280),  INT16_C( 30944), -INT16_C( 18025), -INT16_C( 12987), -INT16_C( 28258),  INT16_C( 27996) },
+      {  INT16_C( 26972), -INT16_C( 23446), -INT16_C( 22314),  INT16_C( 27421), -INT16_C(  5829),  INT16_C( 10077), -INT16_C( 12223),  INT16_C(  3820) },
+      { -INT16_C( 13219),  INT16_C( 26972),  INT16_C(  9134), -INT16_C( 23446),  INT16_C( 17280), -INT16_C( 22314),  INT16_C( 30944),  INT16_C( 27421),
+        -INT16_C( 18025), -INT16_C(  5829), -INT16_C( 12987),  INT16_C( 10077), -INT16_C( 28258), -INT16_C( 12223),  INT16_C( 27996),  INT16_C(  3820) } },
+    { { -INT16_C( 15618),  INT16_C( 17635), -INT16_C(  9669), -INT16_C(  7050),  INT16_C(  2448),  INT16_C( 16037), -INT16_C( 25162), -INT16_C(  8639) },
+      {  INT16_C(  2179),  INT16_C(   699), -INT16_C( 29420),  INT16_C( 26963), -INT16_C( 27596),  INT16_C(  9271), -INT16_C( 19519),  INT16_C( 25460) },
+      { -INT16_C( 15618),  INT16_C(  2179),  INT16_C( 17635),  INT16_C(   699), -INT16_C(  9669), -INT16_C( 29420), -INT16_C(  7050),  INT16_C( 26963),
+         INT16_C(  2448), -INT16_C( 27596),  INT16_C( 16037),  INT16_C(  9271), -INT16_C( 25162), -INT16_C( 19519), -INT16_C(  8639),  INT16_C( 25460) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int16x8x2_t r_ = { { simde_vld1q_s16(test_vec[i].r0),
+                                simde_vld1q_s16(test_vec[i].r1) } };
+
+    int16_t a_[16];
+    simde_vst2q_s16(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2q_s16(a_);
+    simde_test_arm_neon_assert_equal_i16x8(r_.val[0], simde_vld1q_s16(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i16x8(r_.val[1], simde_vld1q_s16(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst2q_s32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int32_t r0[4];
+    int32_t r1[4];
+    int32_t a[8];
+  } test_vec[] = {
+    { { -INT32_C( 1115458636), -INT32_C(  171399253), -INT32_C(  680615978), -INT32_C(  117452921) },
+      { -INT32_C(  896535649),  INT32_C(   67072489),  INT32_C( 1446789098), -INT32_C( 1109632034) },
+      { -INT32_C( 1115458636), -INT32_C(  896535649), -INT32_C(  171399253),  INT32_C(   67072489),
+        -INT32_C(  680615978),  INT32_C( 1446789098), -INT32_C(  117452921), -INT32_C( 1109632034) } },
+    { {  INT32_C(  678617166),  INT32_C(  220388128), -INT32_C(  115198104), -INT32_C(  946849493) },
+      {  INT32_C( 1165558055), -INT32_C( 1310519487),  INT32_C(  798329786),  INT32_C(  310088363) },
+      {  INT32_C(  678617166),  INT32_C( 1165558055),  INT32_C(  220388128), -INT32_C( 1310519487),
+        -INT32_C(  115198104),  INT32_C(  798329786), -INT32_C(  946849493),  INT32_C(  310088363) } },
+    { { -INT32_C(  792938344), -INT32_C(  787077655),  INT32_C(  497733222),  INT32_C(  385109117) },
+      {  INT32_C( 1054183632), -INT32_C(   71345547),  INT32_C(  147453787), -INT32_C(  342593912) },
+      { -INT32_C(  792938344),  INT32_C( 1054183632), -INT32_C(  787077655), -INT32_C(   71345547),
+         INT32_C(  497733222),  INT32_C(  147453787),  INT32_C(  385109117), -INT32_C(  342593912) } },
+    { {  INT32_C( 1084568402), -INT32_C( 1161010103),  INT32_C(  570343442),  INT32_C( 1708800183) },
+      {  INT32_C( 1837791259),  INT32_C( 1589179159), -INT32_C( 1013097618), -INT32_C( 1273030754) },
+      {  INT32_C( 1084568402),  INT32_C( 1837791259), -INT32_C( 1161010103),  INT32_C( 1589179159),
+         INT32_C(  570343442), -INT32_C( 1013097618),  INT32_C( 1708800183), -INT32_C( 1273030754) } },
+    { {  INT32_C(  736890683), -INT32_C( 1375834503),  INT32_C( 2047984905),  INT32_C(  175215703) },
+      {  INT32_C(  120677018),  INT32_C( 1974039738),  INT32_C( 1740478072), -INT32_C( 1437099775) },
+      {  INT32_C(  736890683),  INT32_C(  120677018), -INT32_C( 1375834503),  INT32_C( 1974039738),
+         INT32_C( 2047984905),  INT32_C( 1740478072),  INT32_C(  175215703), -INT32_C( 1437099775) } },
+    { { -INT32_C( 1740741474),  INT32_C( 1906063122),  INT32_C(  960071935), -INT32_C( 1350600293) },
+      { -INT32_C( 1007742405),  INT32_C( 1428398294),  INT32_C( 1074978125), -INT32_C(   81397355) },
+      { -INT32_C( 1740741474), -INT32_C( 1007742405),  INT32_C( 1906063122),  INT32_C( 1428398294),
+         INT32_C(  960071935),  INT32_C( 1074978125), -INT32_C( 1350600293), -INT32_C(   81397355) } },
+    { { -INT32_C(  328656094),  INT32_C(  415519760),  INT32_C(  150445613), -INT32_C(  986173594) },
+      { -INT32_C( 1080078758),  INT32_C(    8662528), -INT32_C( 1043503525), -INT32_C( 1773804871) },
+      { -INT32_C(  328656094), -INT32_C( 1080078758),  INT32_C(  415519760),  INT32_C(    8662528),
+         INT32_C(  150445613), -INT32_C( 1043503525), -INT32_C(  986173594), -INT32_C( 1773804871) } },
+    { {  INT32_C( 1569773355),  INT32_C(  450891889),  INT32_C(  615563964),  INT32_C( 1330131598) },
+      {  INT32_C(  552934241),  INT32_C( 1765016459), -INT32_C( 1650404266),  INT32_C( 1493297868) },
+      {  INT32_C( 1569773355),  INT32_C(  552934241),  INT32_C(  450891889),  INT32_C( 1765016459),
+         INT32_C(  615563964), -INT32_C( 1650404266),  INT32_C( 1330131598),  INT32_C( 1493297868) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int32x4x2_t r_ = { { simde_vld1q_s32(test_vec[i].r0),
+                                simde_vld1q_s32(test_vec[i].r1) } };
+
+    int32_t a_[8];
+    simde_vst2q_s32(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2q_s32(a_);
+    simde_test_arm_neon_assert_equal_i32x4(r_.val[0], simde_vld1q_s32(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i32x4(r_.val[1], simde_vld1q_s32(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst2q_s64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    int64_t r0[2];
+    int64_t r1[2];
+    int64_t a[4];
+  } test_vec[] = {
+    { {  INT64_C( 1165079183891148400), -INT64_C( 8069268119298341775) },
+      {  INT64_C( 9104455757784893092), -INT64_C( 6082465139629594754) },
+      {  INT64_C( 1165079183891148400),  INT64_C( 9104455757784893092),
+        -INT64_C( 8069268119298341775), -INT64_C( 6082465139629594754) } },
+    { { -INT64_C( 9017056218873422973),  INT64_C( 4972267547529263319) },
+      {  INT64_C(  115135482742162144),  INT64_C( 5498278726889993454) },
+      { -INT64_C( 9017056218873422973),  INT64_C(  115135482742162144),
+         INT64_C( 4972267547529263319),  INT64_C( 5498278726889993454) } },
+    { {  INT64_C( 2529166429900115501),  INT64_C( 2591270838618412750) },
+      {  INT64_C( 3662492728826163190),  INT64_C( 9159663418661225580) },
+      {  INT64_C( 2529166429900115501),  INT64_C( 3662492728826163190),
+         INT64_C( 2591270838618412750),  INT64_C( 9159663418661225580) } },
+    { {  INT64_C( 6408493479500606848), -INT64_C( 1905491387914433317) },
+      {  INT64_C( 2171276432205953907), -INT64_C( 5899985512000545822) },
+      {  INT64_C( 6408493479500606848),  INT64_C( 2171276432205953907),
+        -INT64_C( 1905491387914433317), -INT64_C( 5899985512000545822) } },
+    { { -INT64_C( 5678202593186800559),  INT64_C( 3898372154846650224) },
+      {  INT64_C( 8642013498374009366), -INT64_C( 1515529193604326331) },
+      { -INT64_C( 5678202593186800559),  INT64_C( 8642013498374009366),
+         INT64_C( 3898372154846650224), -INT64_C( 1515529193604326331) } },
+    { {  INT64_C( 7227503780381184848),  INT64_C( 2893841339340013215) },
+      { -INT64_C( 4413719937721552229),  INT64_C( 4077540486220878043) },
+      {  INT64_C( 7227503780381184848), -INT64_C( 4413719937721552229),
+         INT64_C( 2893841339340013215),  INT64_C( 4077540486220878043) } },
+    { {  INT64_C( 3041865239536557623), -INT64_C( 1895001535101600050) },
+      { -INT64_C( 3999318671697825516),  INT64_C( 4289622843079813697) },
+      {  INT64_C( 3041865239536557623), -INT64_C( 3999318671697825516),
+        -INT64_C( 1895001535101600050),  INT64_C( 4289622843079813697) } },
+    { { -INT64_C( 4962548550198390586),  INT64_C( 3157745237146125166) },
+      { -INT64_C( 4577124801587396976),  INT64_C( 8499115203735367123) },
+      { -INT64_C( 4962548550198390586), -INT64_C( 4577124801587396976),
+         INT64_C( 3157745237146125166),  INT64_C( 8499115203735367123) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_int64x2x2_t r_ = { { simde_vld1q_s64(test_vec[i].r0),
+                                simde_vld1q_s64(test_vec[i].r1) } };
+
+    int64_t a_[4];
+    simde_vst2q_s64(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2q_s64(a_);
+    simde_test_arm_neon_assert_equal_i64x2(r_.val[0], simde_vld1q_s64(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_i64x2(r_.val[1], simde_vld1q_s64(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst2q_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint8_t r0[16];
+    uint8_t r1[16];
+    uint8_t a[32];
+  } test_vec[] = {
+    { { UINT8_C(174), UINT8_C(219), UINT8_C( 29), UINT8_C(135), UINT8_C( 82), UINT8_C(119), UINT8_C( 95), UINT8_C( 52),
+        UINT8_C(171), UINT8_C(115), UINT8_C( 87), UINT8_C( 88), UINT8_C(161), UINT8_C( 43), UINT8_C( 17), UINT8_C( 26) },
+      { UINT8_C(246), UINT8_C( 93), UINT8_C( 86), UINT8_C(203), UINT8_C(192), UINT8_C(154), UINT8_C(237), UINT8_C( 21),
+        UINT8_C( 84), UINT8_C( 74), UINT8_C( 95), UINT8_C(194), UINT8_C(229), UINT8_C( 84), UINT8_C(206), UINT8_C(196) },
+      { UINT8_C(174), UINT8_C(246), UINT8_C(219), UINT8_C( 93), UINT8_C( 29), UINT8_C( 86), UINT8_C(135), UINT8_C(203),
+        UINT8_C( 82), UINT8_C(192), UINT8_C(119), UINT8_C(154), UINT8_C( 95), UINT8_C(237), UINT8_C( 52), UINT8_C( 21),
+        UINT8_C(171), UINT8_C( 84), UINT8_C(115), UINT8_C( 74), UINT8_C( 87), UINT8_C( 95), UINT8_C( 88), UINT8_C(194),
+        UINT8_C(161), UINT8_C(229), UINT8_C( 43), UINT8_C( 84), UINT8_C( 17), UINT8_C(206), UINT8_C( 26), UINT8_C(196) } },
+    { { UINT8_C(175), UINT8_C( 60), UINT8_C(104), UINT8_C( 91), UINT8_C( 50), UINT8_C( 58), UINT8_C(172), UINT8_C( 20),
+        UINT8_C( 58), UINT8_C(195), UINT8_C(172), UINT8_C(205), UINT8_C(244), UINT8_C(139), UINT8_C( 43), UINT8_C(205) },
+      { UINT8_C( 27), UINT8_C(128), UINT8_C( 75), UINT8_C(183), UINT8_C(255), UINT8_C( 45), UINT8_C(163), UINT8_C( 51),
+        UINT8_C(233), UINT8_C(203), UINT8_C(210), UINT8_C(231), UINT8_C(245), UINT8_C(144), UINT8_C( 29), UINT8_C(210) },
+      { UINT8_C(175), UINT8_C( 27), UINT8_C( 60), UINT8_C(128), UINT8_C(104), UINT8_C( 75), UINT8_C( 91), UINT8_C(183),
+        UINT8_C( 50), UINT8_C(255), UINT8_C( 58), UINT8_C( 45), UINT8_C(172), UINT8_C(163), UINT8_C( 20), UINT8_C( 51),
+        UINT8_C( 58), UINT8_C(233), UINT8_C(195), UINT8_C(203), UINT8_C(172), UINT8_C(210), UINT8_C(205), UINT8_C(231),
+        UINT8_C(244), UINT8_C(245), UINT8_C(139), UINT8_C(144), UINT8_C( 43), UINT8_C( 29), UINT8_C(205), UINT8_C(210) } },
+    { { UINT8_C(124), UINT8_C( 27), UINT8_C(135), UINT8_C(123), UINT8_C(241), UINT8_C(134), UINT8_C(139), UINT8_C(218),
+        UINT8_C(119), UINT8_C(222), UINT8_C(194), UINT8_C(175), UINT8_C( 97), UINT8_C(160), UINT8_C(185), UINT8_C(145) },
+      { UINT8_C(144), UINT8_C(228), UINT8_C( 13), UINT8_C( 46), UINT8_C(140), UINT8_C( 35), UINT8_C( 60), UINT8_C(254),
+        UINT8_C(240), UINT8_C(163), UINT8_C(216), UINT8_C(168), UINT8_C(199), UINT8_C(116), UINT8_C(132), UINT8_C( 38) },
+      { UINT8_C(124), UINT8_C(144), UINT8_C( 27), UINT8_C(228), UINT8_C(135), UINT8_C( 13), UINT8_C(123), UINT8_C( 46),
+        UINT8_C(241), UINT8_C(140), UINT8_C(134), UINT8_C( 35), UINT8_C(139), UINT8_C( 60), UINT8_C(218), UINT8_C(254),
+        UINT8_C(119), UINT8_C(240), UINT8_C(222), UINT8_C(163), UINT8_C(194), UINT8_C(216), UINT8_C(175), UINT8_C(168),
+        UINT8_C( 97), UINT8_C(199), UINT8_C(160), UINT8_C(116), UINT8_C(185), UINT8_C(132), UINT8_C(145), UINT8_C( 38) } },
+    { { UINT8_C( 71), UINT8_C( 90), UINT8_C( 39), UINT8_C(102), UINT8_C(190), UINT8_C(207), UINT8_C(204), UINT8_C(251),
+        UINT8_C( 54), UINT8_C( 74), UINT8_C( 44), UINT8_C(204), UINT8_C(252), UINT8_C( 97), UINT8_C(213), UINT8_C(116) },
+      { UINT8_C(116), UINT8_C(141), UINT8_C(105), UINT8_C(  9), UINT8_C( 86), UINT8_C(103), UINT8_C( 26), UINT8_C(170),
+        UINT8_C(203), UINT8_C(101), UINT8_C( 56), UINT8_C(205), UINT8_C(144), UINT8_C( 47), UINT8_C(137), UINT8_C( 18) },
+      { UINT8_C( 71), UINT8_C(116), UINT8_C( 90), UINT8_C(141), UINT8_C( 39), UINT8_C(105), UINT8_C(102), UINT8_C(  9),
+        UINT8_C(190), UINT8_C( 86), UINT8_C(207), UINT8_C(103), UINT8_C(204), UINT8_C( 26), UINT8_C(251), UINT8_C(170),
+        UINT8_C( 54), UINT8_C(203), UINT8_C( 74), UINT8_C(101), UINT8_C( 44), UINT8_C( 56), UINT8_C(204), UINT8_C(205),
+        UINT8_C(252), UINT8_C(144), UINT8_C( 97), UINT8_C( 47), UINT8_C(213), UINT8_C(137), UINT8_C(116), UINT8_C( 18) } },
+    { { UINT8_C(125), UINT8_C(248), UINT8_C(196), UINT8_C(216), UINT8_C(176), UINT8_C( 31), UINT8_C(191), UINT8_C(244),
+        UINT8_C(139), UINT8_C( 12), UINT8_C( 10), UINT8_C( 65), UINT8_C( 16), UINT8_C(248), UINT8_C(198), UINT8_C(161) },
+      { UINT8_C(237), UINT8_C( 41), UINT8_C(138), UINT8_C( 25), UINT8_C(134), UINT8_C(162), UINT8_C(157), UINT8_C( 94),
+        UINT8_C( 21), UINT8_C( 67), UINT8_C( 86), UINT8_C( 18), UINT8_C(135), UINT8_C( 82), UINT8_C(198), UINT8_C(115) },
+      { UINT8_C(125), UINT8_C(237), UINT8_C(248), UINT8_C( 41), UINT8_C(196), UINT8_C(138), UINT8_C(216), UINT8_C( 25),
+        UINT8_C(176), UINT8_C(134), UINT8_C( 31), UINT8_C(162), UINT8_C(191), UINT8_C(157), UINT8_C(244), UINT8_C( 94),
+        UINT8_C(139), UINT8_C( 21), UINT8_C( 12), UINT8_C( 67), UINT8_C( 10), UINT8_C( 86), UINT8_C( 65), UINT8_C( 18),
+        UINT8_C( 16), UINT8_C(135), UINT8_C(248), UINT8_C( 82), UINT8_C(198), UINT8_C(198), UINT8_C(161), UINT8_C(115) } },
+    { { UINT8_C( 12), UINT8_C( 42), UINT8_C(132), UINT8_C(221), UINT8_C( 44), UINT8_C(177), UINT8_C(194), UINT8_C(242),
+        UINT8_C(243), UINT8_C(128), UINT8_C( 36), UINT8_C(248), UINT8_C(174), UINT8_C(124), UINT8_C(172), UINT8_C(111) },
+      { UINT8_C(  0), UINT8_C( 80), UINT8_C(244), UINT8_C(202), UINT8_C( 84), UINT8_C(  0), UINT8_C(  7), UINT8_C(245),
+        UINT8_C(132), UINT8_C( 36), UINT8_C( 73), UINT8_C( 92), UINT8_C(133), UINT8_C( 20), UINT8_C( 71), UINT8_C(114) },
+      { UINT8_C( 12), UINT8_C(  0), UINT8_C( 42), UINT8_C( 80), UINT8_C(132), UINT8_C(244), UINT8_C(221), UINT8_C(202),
+        UINT8_C( 44), UINT8_C( 84), UINT8_C(177), UINT8_C(  0), UINT8_C(194), UINT8_C(  7), UINT8_C(242), UINT8_C(245),
+        UINT8_C(243), UINT8_C(132), UINT8_C(128), UINT8_C( 36), UINT8_C( 36), UINT8_C( 73), UINT8_C(248), UINT8_C( 92),
+        UINT8_C(174), UINT8_C(133), UINT8_C(124), UINT8_C( 20), UINT8_C(172), UINT8_C( 71), UINT8_C(111), UINT8_C(114) } },
+    { { UINT8_C(244), UINT8_C(103), UINT8_C(103), UINT8_C(187), UINT8_C(247), UINT8_C(160), UINT8_C( 26), UINT8_C( 73),
+        UINT8_C( 66), UINT8_C(178), UINT8_C(144), UINT8_C(214), UINT8_C(143), UINT8_C(152), UINT8_C(184), UINT8_C(197) },
+      { UINT8_C(189), UINT8_C(106), UINT8_C( 93), UINT8_C(174), UINT8_C( 16), UINT8_C(136), UINT8_C(125), UINT8_C(132),
+        UINT8_C(208), UINT8_C(112), UINT8_C(161), UINT8_C(173), UINT8_C( 79), UINT8_C(  4), UINT8_C( 24), UINT8_C( 18) },
+      { UINT8_C(244), UINT8_C(189), UINT8_C(103), UINT8_C(106), UINT8_C(103), UINT8_C( 93), UINT8_C(187), UINT8_C(174),
+        UINT8_C(247), UINT8_C( 16), UINT8_C(160), UINT8_C(136), UINT8_C( 26), UINT8_C(125), UINT8_C( 73), UINT8_C(132),
+        UINT8_C( 66), UINT8_C(208), UINT8_C(178), UINT8_C(112), UINT8_C(144), UINT8_C(161), UINT8_C(214), UINT8_C(173),
+        UINT8_C(143), UINT8_C( 79), UINT8_C(152), UINT8_C(  4), UINT8_C(184), UINT8_C( 24), UINT8_C(197), UINT8_C( 18) } },
+    { { UINT8_C(235), UINT8_C( 80), UINT8_C(252), UINT8_C(216), UINT8_C(232), UINT8_C( 79), UINT8_C(223), UINT8_C(223),
+        UINT8_C(116), UINT8_C( 75), UINT8_C( 21), UINT8_C(174), UINT8_C(246), UINT8_C( 60), UINT8_C(218), UINT8_C(163) },
+      { UINT8_C(135), UINT8_C(218), UINT8_C( 63), UINT8_C(145), UINT8_C(  9), UINT8_C(134), UINT8_C(126), UINT8_C(156),
+        UINT8_C(240), UINT8_C( 95), UINT8_C( 34), UINT8_C(168), UINT8_C(171), UINT8_C(236), UINT8_C(176), UINT8_C(226) },
+      { UINT8_C(235), UINT8_C(135), UINT8_C( 80), UINT8_C(218), UINT8_C(252), UINT8_C( 63), UINT8_C(216), UINT8_C(145),
+        UINT8_C(232), UINT8_C(  9), UINT8_C( 79), UINT8_C(134), UINT8_C(223), UINT8_C(126), UINT8_C(223), UINT8_C(156),
+        UINT8_C(116), UINT8_C(240), UINT8_C( 75), UINT8_C( 95), UINT8_C( 21), UINT8_C( 34), UINT8_C(174), UINT8_C(168),
+        UINT8_C(246), UINT8_C(171), UINT8_C( 60), UINT8_C(236), UINT8_C(218), UINT8_C(176), UINT8_C(163), UINT8_C(226) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint8x16x2_t r_ = { { simde_vld1q_u8(test_vec[i].r0),
+                                 simde_vld1q_u8(test_vec[i].r1) } };
+
+    uint8_t a_[32];
+    simde_vst2q_u8(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2q_u8(a_);
+    simde_test_arm_neon_assert_equal_u8x16(r_.val[0], simde_vld1q_u8(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u8x16(r_.val[1], simde_vld1q_u8(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst2q_u16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint16_t r0[8];
+    uint16_t r1[8];
+    uint16_t a[16];
+  } test_vec[] = {
+    { { UINT16_C(23020), UINT16_C(57220), UINT16_C(46875), UINT16_C(63472), UINT16_C(29140), UINT16_C(24556), UINT16_C(31978), UINT16_C(64266) },
+      { UINT16_C(10410), UINT16_C(49369), UINT16_C(22480), UINT16_C(10005), UINT16_C(46326), UINT16_C(19702), UINT16_C(58401), UINT16_C(38279) },
+      { UINT16_C(23020), UINT16_C(10410), UINT16_C(57220), UINT16_C(49369), UINT16_C(46875), UINT16_C(22480), UINT16_C(63472), UINT16_C(10005),
+        UINT16_C(29140), UINT16_C(46326), UINT16_C(24556), UINT16_C(19702), UINT16_C(31978), UINT16_C(58401), UINT16_C(64266), UINT16_C(38279) } },
+    { { UINT16_C(62026), UINT16_C(50397), UINT16_C(41343), UINT16_C(10579), UINT16_C(25973), UINT16_C(49598), UINT16_C(40680), UINT16_C(29389) },
+      { UINT16_C( 7476), UINT16_C(42458), UINT16_C(48990), UINT16_C(39228), UINT16_C(42328), UINT16_C( 2729), UINT16_C(22736), UINT16_C(   16) },
+      { UINT16_C(62026), UINT16_C( 7476), UINT16_C(50397), UINT16_C(42458), UINT16_C(41343), UINT16_C(48990), UINT16_C(10579), UINT16_C(39228),
+        UINT16_C(25973), UINT16_C(42328), UINT16_C(49598), UINT16_C( 2729), UINT16_C(40680), UINT16_C(22736), UINT16_C(29389), UINT16_C(   16) } },
+    { { UINT16_C(50895), UINT16_C(39697), UINT16_C(58551), UINT16_C(15033), UINT16_C(22062), UINT16_C( 9475), UINT16_C( 4075), UINT16_C(27126) },
+      { UINT16_C(31146), UINT16_C(56399), UINT16_C( 9376), UINT16_C(52088), UINT16_C(20802), UINT16_C(26686), UINT16_C(10127), UINT16_C(58099) },
+      { UINT16_C(50895), UINT16_C(31146), UINT16_C(39697), UINT16_C(56399), UINT16_C(58551), UINT16_C( 9376), UINT16_C(15033), UINT16_C(52088),
+        UINT16_C(22062), UINT16_C(20802), UINT16_C( 9475), UINT16_C(26686), UINT16_C( 4075), UINT16_C(10127), UINT16_C(27126), UINT16_C(58099) } },
+    { { UINT16_C( 2199), UINT16_C(10317), UINT16_C(64293), UINT16_C(53294), UINT16_C( 4598), UINT16_C(17484), UINT16_C(63277), UINT16_C(56426) },
+      { UINT16_C(25940), UINT16_C(18059), UINT16_C(  257), UINT16_C( 7647), UINT16_C(45202), UINT16_C(16884), UINT16_C(25824), UINT16_C(40695) },
+      { UINT16_C( 2199), UINT16_C(25940), UINT16_C(10317), UINT16_C(18059), UINT16_C(64293), UINT16_C(  257), UINT16_C(53294), UINT16_C( 7647),
+        UINT16_C( 4598), UINT16_C(45202), UINT16_C(17484), UINT16_C(16884), UINT16_C(63277), UINT16_C(25824), UINT16_C(56426), UINT16_C(40695) } },
+    { { UINT16_C(12571), UINT16_C(38978), UINT16_C(23205), UINT16_C(53896), UINT16_C(46818), UINT16_C(51943), UINT16_C( 8828), UINT16_C(34036) },
+      { UINT16_C(59257), UINT16_C(55281), UINT16_C(40007), UINT16_C( 5363), UINT16_C(56892), UINT16_C(29136), UINT16_C( 6717), UINT16_C(16942) },
+      { UINT16_C(12571), UINT16_C(59257), UINT16_C(38978), UINT16_C(55281), UINT16_C(23205), UINT16_C(40007), UINT16_C(53896), UINT16_C( 5363),
+        UINT16_C(46818), UINT16_C(56892), UINT16_C(51943), UINT16_C(29136), UINT16_C( 8828), UINT16_C( 6717), UINT16_C(34036), UINT16_C(16942) } },
+    { { UINT16_C(39944), UINT16_C(63299), UINT16_C(60161), UINT16_C(10207), UINT16_C(38047), UINT16_C(45851), UINT16_C(50343), UINT16_C(11829) },
+      { UINT16_C( 4803), UINT16_C(40877), UINT16_C(29588), UINT16_C(62953), UINT16_C(34531), UINT16_C(55640), UINT16_C(12562), UINT16_C(48173) },
+      { UINT16_C(39944), UINT16_C( 4803), UINT16_C(63299), UINT16_C(40877), UINT16_C(60161), UINT16_C(29588), UINT16_C(10207), UINT16_C(62953),
+        UINT16_C(38047), UINT16_C(34531), UINT16_C(45851), UINT16_C(55640), UINT16_C(50343), UINT16_C(12562), UINT16_C(11829), UINT16_C(48173) } },
+    { { UINT16_C( 1169), UINT16_C(20027), UINT16_C(44433), UINT16_C(56676), UINT16_C( 2165), UINT16_C(18675), UINT16_C(40949), UINT16_C(45567) },
+      { UINT16_C(16293), UINT16_C(58202), UINT16_C(51443), UINT16_C(13483), UINT16_C(18888), UINT16_C(45969), UINT16_C( 7868), UINT16_C(26144) },
+      { UINT16_C( 1169), UINT16_C(16293), UINT16_C(20027), UINT16_C(58202), UINT16_C(44433), UINT16_C(51443), UINT16_C(56676), UINT16_C(13483),
+        UINT16_C( 2165), UINT16_C(18888), UINT16_C(18675), UINT16_C(45969), UINT16_C(40949), UINT16_C( 7868), UINT16_C(45567), UINT16_C(26144) } },
+    { { UINT16_C(18724), UINT16_C(24190), UINT16_C(16962), UINT16_C(60111), UINT16_C(58481), UINT16_C(15633), UINT16_C(33995), UINT16_C(58532) },
+      { UINT16_C(20958), UINT16_C(18886), UINT16_C( 4760), UINT16_C(47300), UINT16_C( 9814), UINT16_C(56957), UINT16_C(10503), UINT16_C(37373) },
+      { UINT16_C(18724), UINT16_C(20958), UINT16_C(24190), UINT16_C(18886), UINT16_C(16962), UINT16_C( 4760), UINT16_C(60111), UINT16_C(47300),
+        UINT16_C(58481), UINT16_C( 9814), UINT16_C(15633), UINT16_C(56957), UINT16_C(33995), UINT16_C(10503), UINT16_C(58532), UINT16_C(37373) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint16x8x2_t r_ = { { simde_vld1q_u16(test_vec[i].r0),
+                                 simde_vld1q_u16(test_vec[i].r1) } };
+
+    uint16_t a_[16];
+    simde_vst2q_u16(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2q_u16(a_);
+    simde_test_arm_neon_assert_equal_u16x8(r_.val[0], simde_vld1q_u16(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u16x8(r_.val[1], simde_vld1q_u16(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst2q_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t r0[4];
+    uint32_t r1[4];
+    uint32_t a[8];
+  } test_vec[] = {
+    { { UINT32_C(3392280314), UINT32_C(2770543045), UINT32_C(3413362401), UINT32_C( 921771755) },
+      { UINT32_C(2149677438), UINT32_C(4002981801), UINT32_C( 773033663), UINT32_C(1219956251) },
+      { UINT32_C(3392280314), UINT32_C(2149677438), UINT32_C(2770543045), UINT32_C(4002981801),
+        UINT32_C(3413362401), UINT32_C( 773033663), UINT32_C( 921771755), UINT32_C(1219956251) } },
+    { { UINT32_C(3628413491), UINT32_C( 774083580), UINT32_C( 650079096), UINT32_C(2608414450) },
+      { UINT32_C(3732485723), UINT32_C(1153450781), UINT32_C(3638876687), UINT32_C(3429260954) },
+      { UINT32_C(3628413491), UINT32_C(3732485723), UINT32_C( 774083580), UINT32_C(1153450781),
+        UINT32_C( 650079096), UINT32_C(3638876687), UINT32_C(2608414450), UINT32_C(3429260954) } },
+    { { UINT32_C(1934879972), UINT32_C(3098727368), UINT32_C(3942956901), UINT32_C(2665687859) },
+      { UINT32_C(1154634173), UINT32_C( 427161787), UINT32_C( 995580138), UINT32_C(2656734027) },
+      { UINT32_C(1934879972), UINT32_C(1154634173), UINT32_C(3098727368), UINT32_C( 427161787),
+        UINT32_C(3942956901), UINT32_C( 995580138), UINT32_C(2665687859), UINT32_C(2656734027) } },
+    { { UINT32_C(4051260718), UINT32_C(3908832580), UINT32_C(3253690273), UINT32_C(4269280719) },
+      { UINT32_C(3601323359), UINT32_C(3425013402), UINT32_C(  16283472), UINT32_C(4178996367) },
+      { UINT32_C(4051260718), UINT32_C(3601323359), UINT32_C(3908832580), UINT32_C(3425013402),
+        UINT32_C(3253690273), UINT32_C(  16283472), UINT32_C(4269280719), UINT32_C(4178996367) } },
+    { { UINT32_C(1876144442), UINT32_C(3967589514), UINT32_C(3739832569), UINT32_C( 842447465) },
+      { UINT32_C(3434175629), UINT32_C(1181664496), UINT32_C(1060647629), UINT32_C(1283045013) },
+      { UINT32_C(1876144442), UINT32_C(3434175629), UINT32_C(3967589514), UINT32_C(1181664496),
+        UINT32_C(3739832569), UINT32_C(1060647629), UINT32_C( 842447465), UINT32_C(1283045013) } },
+    { { UINT32_C(2176365976), UINT32_C(3898896655), UINT32_C(1052328748), UINT32_C( 358103147) },
+      { UINT32_C( 462389898), UINT32_C( 698570617), UINT32_C(1958615945), UINT32_C(2109384846) },
+      { UINT32_C(2176365976), UINT32_C( 462389898), UINT32_C(3898896655), UINT32_C( 698570617),
+        UINT32_C(1052328748), UINT32_C(1958615945), UINT32_C( 358103147), UINT32_C(2109384846) } },
+    { { UINT32_C( 515468631), UINT32_C( 189018951), UINT32_C(2715160977), UINT32_C(3948472072) },
+      { UINT32_C( 794553952), UINT32_C(3009728109), UINT32_C(1243503330), UINT32_C(3982420652) },
+      { UINT32_C( 515468631), UINT32_C( 794553952), UINT32_C( 189018951), UINT32_C(3009728109),
+        UINT32_C(2715160977), UINT32_C(1243503330), UINT32_C(3948472072), UINT32_C(3982420652) } },
+    { { UINT32_C(3010507626), UINT32_C(2318922402), UINT32_C(2244679445), UINT32_C(1600145014) },
+      { UINT32_C(1778683298), UINT32_C(1595602655), UINT32_C(1270165054), UINT32_C(4195279280) },
+      { UINT32_C(3010507626), UINT32_C(1778683298), UINT32_C(2318922402), UINT32_C(1595602655),
+        UINT32_C(2244679445), UINT32_C(1270165054), UINT32_C(1600145014), UINT32_C(4195279280) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint32x4x2_t r_ = { { simde_vld1q_u32(test_vec[i].r0),
+                                 simde_vld1q_u32(test_vec[i].r1) } };
+
+    uint32_t a_[8];
+    simde_vst2q_u32(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2q_u32(a_);
+    simde_test_arm_neon_assert_equal_u32x4(r_.val[0], simde_vld1q_u32(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u32x4(r_.val[1], simde_vld1q_u32(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_vst2q_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t r0[2];
+    uint64_t r1[2];
+    uint64_t a[4];
+  } test_vec[] = {
+    { { UINT64_C( 8360577825867480549), UINT64_C( 5247671378346414176) },
+      { UINT64_C( 1469523937450355253), UINT64_C(  513567803451005900) },
+      { UINT64_C( 8360577825867480549), UINT64_C( 1469523937450355253),
+        UINT64_C( 5247671378346414176), UINT64_C(  513567803451005900) } },
+    { { UINT64_C(  611742281158992397), UINT64_C(13159763966771496546) },
+      { UINT64_C(14899630864553596941), UINT64_C(15237496575746315632) },
+      { UINT64_C(  611742281158992397), UINT64_C(14899630864553596941),
+        UINT64_C(13159763966771496546), UINT64_C(15237496575746315632) } },
+    { { UINT64_C(11421158814047394034), UINT64_C(11414901081671306298) },
+      { UINT64_C( 6522736490629848724), UINT64_C(13175303551459185637) },
+      { UINT64_C(11421158814047394034), UINT64_C( 6522736490629848724),
+        UINT64_C(11414901081671306298), UINT64_C(13175303551459185637) } },
+    { { UINT64_C(13147268860296328110), UINT64_C( 7230429130618710258) },
+      { UINT64_C(15805671986254846501), UINT64_C( 2413837173543498908) },
+      { UINT64_C(13147268860296328110), UINT64_C(15805671986254846501),
+        UINT64_C( 7230429130618710258), UINT64_C( 2413837173543498908) } },
+    { { UINT64_C( 1282571983908730093), UINT64_C( 1659958111109628475) },
+      { UINT64_C( 9162085029373048902), UINT64_C( 8259735448835176744) },
+      { UINT64_C( 1282571983908730093), UINT64_C( 9162085029373048902),
+        UINT64_C( 1659958111109628475), UINT64_C( 8259735448835176744) } },
+    { { UINT64_C(13886847639694151714), UINT64_C(17574617995142276483) },
+      { UINT64_C(16873760706468088811), UINT64_C( 9717639169991051134) },
+      { UINT64_C(13886847639694151714), UINT64_C(16873760706468088811),
+        UINT64_C(17574617995142276483), UINT64_C( 9717639169991051134) } },
+    { { UINT64_C( 8053910393297052783), UINT64_C( 8746522453610669507) },
+      { UINT64_C(15298059107553053842), UINT64_C(11134919723553381225) },
+      { UINT64_C( 8053910393297052783), UINT64_C(15298059107553053842),
+        UINT64_C( 8746522453610669507), UINT64_C(11134919723553381225) } },
+    { { UINT64_C(10199785562139895137), UINT64_C(13918669617750462312) },
+      { UINT64_C(10950434823318968623), UINT64_C( 5660003303921777850) },
+      { UINT64_C(10199785562139895137), UINT64_C(10950434823318968623),
+        UINT64_C(13918669617750462312), UINT64_C( 5660003303921777850) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_uint64x2x2_t r_ = { { simde_vld1q_u64(test_vec[i].r0),
+                                 simde_vld1q_u64(test_vec[i].r1) } };
+
+    uint64_t a_[4];
+    simde_vst2q_u64(a_, r_);
+    simde_assert_equal_i(0, simde_memcmp(a_, test_vec[i].a, sizeof(test_vec[i].a)));
+
+    r_ = simde_vld2q_u64(a_);
+    simde_test_arm_neon_assert_equal_u64x2(r_.val[0], simde_vld1q_u64(test_vec[i].r0));
+    simde_test_arm_neon_assert_equal_u64x2(r_.val[1], simde_vld1q_u64(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+#endif /* !defined(SIMDE_BUG_INTEL_857088) */
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+#if !defined(SIMDE_BUG_INTEL_857088)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2_s8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2_u8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2_u16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2_u64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2q_f32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2q_f64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2q_s8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2q_s16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2q_s32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2q_s64)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2q_u8)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2q_u16)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2q_u32)
+SIMDE_TEST_FUNC_LIST_ENTRY(vst2q_u64)
+#endif /* !defined(SIMDE_BUG_INTEL_857088) */
+SIMDE_TEST_FUNC_LIST_END
+
+#include "test-neon-footer.h"
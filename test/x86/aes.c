@@ -0,0 +1,293 @@
+/* Copyright (c) 2026 agent <agent@local>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TESTS_CURRENT_ISAX aes
+#include <simde/x86/aes.h>
+#include <test/x86/test-sse2.h>
+
+static int
+test_simde_mm_aesenc_si128 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[2];
+    const int64_t round_key[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { {  INT64_C(                   0),  INT64_C(                   0) },
+      { -INT64_C( 6317044494804889247),  INT64_C( 3969138339147058051) },
+      { -INT64_C( 3803788087902719486),  INT64_C( 6086145581596403936) } },
+    { {  INT64_C( 2151964491410470484),  INT64_C( 3189475157600038840) },
+      { -INT64_C( 3820155293877838745),  INT64_C( 1654247987768168223) },
+      { -INT64_C( 8570312840019796921),  INT64_C( 8123868347326347190) } },
+    { {  INT64_C( 5897645803426746305), -INT64_C( 4656284130793981538) },
+      {  INT64_C(  560155201674061549), -INT64_C( 1619223251468746528) },
+      {  INT64_C( 1785117789232723322),  INT64_C(  983596256324273377) } },
+    { {  INT64_C( 2908672632439273185), -INT64_C( 3016632850905035700) },
+      {  INT64_C( 6177712327320309588), -INT64_C( 8602372853103120566) },
+      {  INT64_C( 8556595897449251406), -INT64_C(  583540919900834645) } },
+    { {  INT64_C( 1219843860726487956), -INT64_C( 8203643532616308573) },
+      {  INT64_C( 9024264326960108210), -INT64_C(   43618552873459305) },
+      { -INT64_C( 1981523877667677999), -INT64_C( 3543089460994851394) } },
+    { {  INT64_C( 6646911202940837012),  INT64_C( 9141592197490298157) },
+      {  INT64_C( 5611410220317503223),  INT64_C(  429598502114965994) },
+      {  INT64_C( 1729469053278657272), -INT64_C( 3494990750759816224) } },
+    { {  INT64_C( 6299747594664818457),  INT64_C( 8156751500412710199) },
+      { -INT64_C( 8941527642997115091), -INT64_C( 8921949421340461053) },
+      {  INT64_C( 8038070789823848577),  INT64_C( 4619201696405802927) } },
+    { {  INT64_C( 2260277405108037427),  INT64_C( 8370226487120975677) },
+      { -INT64_C( 8460556232721044781), -INT64_C( 1419339629810033210) },
+      {  INT64_C( 5182585326035816371),  INT64_C( 7133009367650645098) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i round_key = simde_x_mm_loadu_epi64(test_vec[i].round_key);
+    simde__m128i r = simde_mm_aesenc_si128(a, round_key);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_aesenclast_si128 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[2];
+    const int64_t round_key[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { {  INT64_C(                   0),  INT64_C(                   0) },
+      { -INT64_C( 8281082921546443490), -INT64_C( 2406324150265821772) },
+      { -INT64_C( 1265285449639201155), -INT64_C( 4757939154726869289) } },
+    { {  INT64_C( 9019082264829379647),  INT64_C(   61218913875195767) },
+      {  INT64_C( 5941137849839512409),  INT64_C( 8989981113061114575) },
+      {  INT64_C( 4847634212926615852), -INT64_C( 4888710653066645190) } },
+    { { -INT64_C( 6766263737555016694), -INT64_C( 1422132599864312638) },
+      { -INT64_C( 6986689100715137221),  INT64_C( 2398211188550059573) },
+      { -INT64_C( 4030670631985097636), -INT64_C( 2838360123068889328) } },
+    { { -INT64_C( 3297609456444366087), -INT64_C( 7490920169687160580) },
+      {  INT64_C( 1289906012893654573), -INT64_C( 7900912669897600975) },
+      {  INT64_C( 8395045938990287284), -INT64_C( 5570457039014837119) } },
+    { { -INT64_C( 8025798222575025711),  INT64_C( 9075631206963019026) },
+      {  INT64_C( 1145182936086154344), -INT64_C( 2281033407027243920) },
+      {  INT64_C( 7848038811444119126), -INT64_C( 4516081413194914119) } },
+    { {  INT64_C( 4424547851624130392),  INT64_C( 7627326512657562902) },
+      { -INT64_C( 8747695986343459220),  INT64_C( 1421752996709702624) },
+      {  INT64_C( 8623284506171650310),  INT64_C( 4197029424925658791) } },
+    { { -INT64_C( 8550175331244304681), -INT64_C( 9119268302034533574) },
+      { -INT64_C( 3497327150488056644), -INT64_C( 7677074091280594267) },
+      { -INT64_C( 6785495778133664334), -INT64_C( 4670572741634769115) } },
+    { {  INT64_C( 8174003538463963376), -INT64_C( 3776176894784710527) },
+      {  INT64_C( 5393893002974690160), -INT64_C(  876939057221587578) },
+      {  INT64_C(  980821571026555644), -INT64_C(  973767825161404278) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i round_key = simde_x_mm_loadu_epi64(test_vec[i].round_key);
+    simde__m128i r = simde_mm_aesenclast_si128(a, round_key);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_aesdec_si128 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[2];
+    const int64_t round_key[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { {  INT64_C(                   0),  INT64_C(                   0) },
+      { -INT64_C( 6811875315501096128), -INT64_C( 1391733808822718714) },
+      { -INT64_C(  926324048217214702), -INT64_C( 4684373447182500524) } },
+    { {  INT64_C( 7024247185773239896),  INT64_C( 4513904363695805028) },
+      { -INT64_C( 7926321980699258304),  INT64_C( 4767092165721611236) },
+      { -INT64_C( 7026604262485193304),  INT64_C( 3777206475351754422) } },
+    { {  INT64_C(   45556003813779027),  INT64_C( 1854732587186551647) },
+      { -INT64_C( 3179520162045461399),  INT64_C( 6751749478844492497) },
+      {  INT64_C( 3787687677073301699), -INT64_C( 8897937848777729881) } },
+    { { -INT64_C( 1377416833025894844), -INT64_C( 6391393425289398936) },
+      {  INT64_C( 2824420617535379458),  INT64_C( 5543871484946473010) },
+      { -INT64_C( 2915265824047361229),  INT64_C( 6396960519527831430) } },
+    { { -INT64_C( 3686488003147603598), -INT64_C( 6501373187004254672) },
+      {  INT64_C( 5734570397248488284), -INT64_C( 5183589405744546982) },
+      { -INT64_C( 6155547904019768653), -INT64_C( 1357182972452164347) } },
+    { {  INT64_C( 7143840652744298924), -INT64_C( 5675259116223473265) },
+      {  INT64_C(  361798091750129148),  INT64_C( 2154037253892382343) },
+      { -INT64_C( 6829546405481975853), -INT64_C( 1078461380412728942) } },
+    { { -INT64_C( 1373490912449285510), -INT64_C(  855601911041221730) },
+      { -INT64_C( 5658931029885894615),  INT64_C(  170121531486504169) },
+      {  INT64_C(  921525159804080314), -INT64_C( 2799803764735122621) } },
+    { {  INT64_C(  931098163457282720),  INT64_C( 5129911244642237701) },
+      {  INT64_C( 2608023987114672447), -INT64_C( 2988945945902843651) },
+      { -INT64_C( 1125090117506755033), -INT64_C( 2313256945348361838) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i round_key = simde_x_mm_loadu_epi64(test_vec[i].round_key);
+    simde__m128i r = simde_mm_aesdec_si128(a, round_key);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_aesdeclast_si128 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[2];
+    const int64_t round_key[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { {  INT64_C(                   0),  INT64_C(                   0) },
+      { -INT64_C(  318188265774356873), -INT64_C( 2985631684570988677) },
+      { -INT64_C( 6212782588319222747), -INT64_C( 8880335818692170455) } },
+    { { -INT64_C( 1454062620609741627),  INT64_C( 5618940024696123004) },
+      { -INT64_C( 6767524931293100000), -INT64_C( 2366300633970927184) },
+      { -INT64_C( 7709952617853368025), -INT64_C( 6604941311231794511) } },
+    { {  INT64_C( 3083257422288467587),  INT64_C( 4805720547466663982) },
+      { -INT64_C( 4851138590168120290),  INT64_C( 4861686400405761430) },
+      {  INT64_C( 1800155050356052319), -INT64_C( 9193531750048992171) } },
+    { { -INT64_C( 8212138844556306227), -INT64_C( 2424371213774661060) },
+      { -INT64_C( 3499971344191661176),  INT64_C( 8670624119202768959) },
+      { -INT64_C( 4455265290300790008), -INT64_C(  438123596301433262) } },
+    { {  INT64_C( 2964853342565302319), -INT64_C( 6303272426527878161) },
+      { -INT64_C( 8362314016753771256), -INT64_C( 7808899369686834894) },
+      {  INT64_C( 7435237660777712454),  INT64_C( 7810110019758979411) } },
+    { { -INT64_C( 8272873384248116368),  INT64_C( 2098758853105521030) },
+      { -INT64_C( 5832850334798041307),  INT64_C( 9022788595625096763) },
+      { -INT64_C( 5595284289245973515), -INT64_C( 1855537216283405337) } },
+    { { -INT64_C( 5890551955143376105), -INT64_C( 8546815631704522159) },
+      { -INT64_C( 6342332133783025643), -INT64_C( 4677165701834256443) },
+      { -INT64_C( 5621646067457436526),  INT64_C( 6009267078806743477) } },
+    { {  INT64_C( 3964355446982905882),  INT64_C( 7710197410889714874) },
+      { -INT64_C(  592468714212438621), -INT64_C( 2443773027465597192) },
+      {  INT64_C( 6311051948785600224),  INT64_C( 5919381613451089976) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i round_key = simde_x_mm_loadu_epi64(test_vec[i].round_key);
+    simde__m128i r = simde_mm_aesdeclast_si128(a, round_key);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_aesimc_si128 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { {  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { { -INT64_C(  656793341378215725),  INT64_C( 1150024204050598546) },
+      {  INT64_C( 4368939587961757078), -INT64_C(  245421062853836991) } },
+    { {  INT64_C( 4137026958789154613), -INT64_C( 7595914396201429669) },
+      { -INT64_C( 7521342058335048472),  INT64_C( 1142395541102539437) } },
+    { {  INT64_C( 7502574972610626149),  INT64_C( 3391178446333876641) },
+      {  INT64_C( 2341135017791280656),  INT64_C( 9054658983208780473) } },
+    { { -INT64_C( 8401455204573360677), -INT64_C(  274151525557058688) },
+      {  INT64_C( 5257960658531661076), -INT64_C( 8949873431689304768) } },
+    { { -INT64_C(  271925984657207918), -INT64_C( 2073313698167736567) },
+      {  INT64_C( 3426382521933842666),  INT64_C( 6640110127360693677) } },
+    { {  INT64_C( 3612019927871940531),  INT64_C( 2277175003592199100) },
+      { -INT64_C( 3741451184835619193),  INT64_C( 2122972241264658508) } },
+    { { -INT64_C( 2564700538080424037),  INT64_C( 5071611702551700548) },
+      { -INT64_C( 6529374645264126140), -INT64_C(  617273812100180879) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i r = simde_mm_aesimc_si128(a);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_aeskeygenassist_si128 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { {  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C( 7161677106674623331),  INT64_C( 7161677106674623331) } },
+    { { -INT64_C(  240289583968676340),  INT64_C( 3432857827278237984) },
+      { -INT64_C( 2760516585030626855),  INT64_C( 8941064012935348860) } },
+    { { -INT64_C( 3404806877202966926),  INT64_C( 8890369784262315998) },
+      {  INT64_C( 1544743474455656213), -INT64_C( 7340356419787387750) } },
+    { {  INT64_C( 1870404259826062790), -INT64_C( 1883850367040324883) },
+      {  INT64_C( 3374575496169158446), -INT64_C( 3901883123684014135) } },
+    { { -INT64_C( 8530804181276788987),  INT64_C(  741918050945744555) },
+      {  INT64_C( 2281036870066303775), -INT64_C( 6383936359359072857) } },
+    { { -INT64_C( 4324554509078301002),  INT64_C( 4797714609233116891) },
+      { -INT64_C( 8057308386805371504), -INT64_C(  996383483664098318) } },
+    { {  INT64_C( 7090094362491341396), -INT64_C( 6003546210851665728) },
+      { -INT64_C( 8959263521325089405),  INT64_C( 1698271869900780055) } },
+    { { -INT64_C( 1315735349360252520), -INT64_C( 5672815019227634229) },
+      {  INT64_C( 7085704271755903330),  INT64_C( 2290179795127540767) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i r;
+
+    switch(i & 3) {
+      case 0:
+        r = simde_mm_aeskeygenassist_si128(a, 0x01);
+        break;
+      case 1:
+        r = simde_mm_aeskeygenassist_si128(a, 0x1b);
+        break;
+      case 2:
+        r = simde_mm_aeskeygenassist_si128(a, 0x36);
+        break;
+      case 3:
+        r = simde_mm_aeskeygenassist_si128(a, 0xff);
+        break;
+      default:
+        HEDLEY_UNREACHABLE();
+    }
+
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_aesenc_si128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_aesenclast_si128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_aesdec_si128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_aesdeclast_si128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_aesimc_si128)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_aeskeygenassist_si128)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/test-x86-footer.h>
@@ -0,0 +1,2330 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+#define SIMDE_TEST_X86_AVX512_INSN alignr
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/alignr.h>
+
+static int
+test_simde_mm_mask_alignr_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[16];
+    const simde__mmask16 k;
+    const int8_t a[16];
+    const int8_t b[16];
+    const int8_t r[16];
+  } test_vec[] = {
+    { { -INT8_C(  32), -INT8_C(  73),  INT8_C(  54), -INT8_C( 114), -INT8_C(  63), -INT8_C(  48),  INT8_C( 109),  INT8_C(  15),
+        -INT8_C(  39), -INT8_C(  44),  INT8_C( 121), -INT8_C( 107),  INT8_C(  38), -INT8_C(  52), -INT8_C(  65),  INT8_C(  10) },
+      UINT16_C(58343),
+      {  INT8_C(  24), -INT8_C(  26),  INT8_C( 111), -INT8_C(  91), -INT8_C(  38), -INT8_C( 111),  INT8_C(  72),  INT8_C(  54),
+         INT8_C(  44),  INT8_C(  90), -INT8_C(  58), -INT8_C(  31), -INT8_C(  52),  INT8_C(  23),  INT8_C(  53), -INT8_C( 127) },
+      {  INT8_C( 127),  INT8_C(  23),  INT8_C(  81),  INT8_C(  79),  INT8_C( 121),  INT8_C(  21), -INT8_C(  19),  INT8_C(  90),
+         INT8_C(  42), -INT8_C(  38),  INT8_C(  59), -INT8_C(  81),  INT8_C(  82),  INT8_C( 120), -INT8_C( 108),  INT8_C( 107) },
+      {  INT8_C(  42), -INT8_C(  38),  INT8_C(  59), -INT8_C( 114), -INT8_C(  63),  INT8_C( 120), -INT8_C( 108),  INT8_C( 107),
+         INT8_C(  24), -INT8_C(  26),  INT8_C( 121), -INT8_C( 107),  INT8_C(  38), -INT8_C( 111),  INT8_C(  72),  INT8_C(  54) } },
+    { { -INT8_C(  90),  INT8_C(  15),  INT8_C(   1), -INT8_C(  79), -INT8_C(  44), -INT8_C( 125),  INT8_C(  72),  INT8_C(  96),
+         INT8_C(  16),  INT8_C( 100), -INT8_C(  24), -INT8_C(  91),  INT8_C(  26),  INT8_C(  28), -INT8_C(  20),  INT8_C(  31) },
+      UINT16_C(10866),
+      {  INT8_C(  16), -INT8_C( 106), -INT8_C(  61), -INT8_C(  58), -INT8_C(  17), -INT8_C(  40), -INT8_C( 101),  INT8_C(  32),
+        -INT8_C(  36),  INT8_C(  37),  INT8_C(   1), -INT8_C(  83),  INT8_C(  16), -INT8_C(  56), -INT8_C(  95),  INT8_C(  90) },
+      { -INT8_C( 106),  INT8_C( 113), -INT8_C(  41), -INT8_C( 116), -INT8_C(  47),  INT8_C(  76),  INT8_C(   0), -INT8_C(  34),
+        -INT8_C(  31),  INT8_C(   2),  INT8_C(  98), -INT8_C(  42), -INT8_C( 111),  INT8_C( 110),  INT8_C(  90),  INT8_C( 114) },
+      { -INT8_C(  90),  INT8_C(   2),  INT8_C(   1), -INT8_C(  79), -INT8_C( 111),  INT8_C( 110),  INT8_C(  90),  INT8_C(  96),
+         INT8_C(  16), -INT8_C( 106), -INT8_C(  24), -INT8_C(  58),  INT8_C(  26), -INT8_C(  40), -INT8_C(  20),  INT8_C(  31) } },
+    { { -INT8_C( 103), -INT8_C(  16), -INT8_C( 117), -INT8_C(  24), -INT8_C(  69), -INT8_C( 120), -INT8_C(  47), -INT8_C(  38),
+        -INT8_C(  57), -INT8_C(  90), -INT8_C(  51),  INT8_C( 108), -INT8_C(   8), -INT8_C(  91),  INT8_C(  92),  INT8_C( 106) },
+      UINT16_C(23649),
+      { -INT8_C(  95),  INT8_C(  44), -INT8_C(  66), -INT8_C(  39),  INT8_C(  46), -INT8_C( 112), -INT8_C(  83), -INT8_C(  76),
+        -INT8_C(  91), -INT8_C(  44),  INT8_C(  13), -INT8_C(  97), -INT8_C(  98),  INT8_C(  53), -INT8_C( 107),  INT8_C(  78) },
+      {  INT8_C(   8),  INT8_C(  12),  INT8_C(  94),  INT8_C(  20), -INT8_C(  30), -INT8_C( 119),  INT8_C(  42),  INT8_C(  68),
+        -INT8_C( 102),  INT8_C( 109), -INT8_C(   5), -INT8_C(  80), -INT8_C(  29),  INT8_C(  82), -INT8_C( 116), -INT8_C(  95) },
+      { -INT8_C( 102), -INT8_C(  16), -INT8_C( 117), -INT8_C(  24), -INT8_C(  69),  INT8_C(  82), -INT8_C( 116), -INT8_C(  38),
+        -INT8_C(  57), -INT8_C(  90), -INT8_C(  66), -INT8_C(  39),  INT8_C(  46), -INT8_C(  91), -INT8_C(  83),  INT8_C( 106) } },
+    { { -INT8_C(  41),  INT8_C(  32), -INT8_C( 112), -INT8_C(  59), -INT8_C( 108),  INT8_C(   9), -INT8_C(  99), -INT8_C(  72),
+        -INT8_C(  35),  INT8_C(   8),  INT8_C( 118), -INT8_C(  26),  INT8_C(  87),  INT8_C( 123), -INT8_C(  11),  INT8_C(  36) },
+      UINT16_C(62845),
+      { -INT8_C(  42), -INT8_C(  81), -INT8_C(  22), -INT8_C( 119),  INT8_C(  26),  INT8_C(  30), -INT8_C(   4), -INT8_C(  23),
+        -INT8_C(  58),  INT8_C(  97), -INT8_C( 109),  INT8_C( 100), -INT8_C(  52),  INT8_C(  67), -INT8_C(   5), -INT8_C( 124) },
+      { -INT8_C(   3), -INT8_C(  90),  INT8_C( 111),  INT8_C(  73),  INT8_C(  71), -INT8_C(  87), -INT8_C(  68),  INT8_C(  27),
+        -INT8_C(  47),  INT8_C( 102), -INT8_C( 100),  INT8_C(  29), -INT8_C( 101), -INT8_C(  38),  INT8_C(  59), -INT8_C(   1) },
+      { -INT8_C(  47),  INT8_C(  32), -INT8_C( 100),  INT8_C(  29), -INT8_C( 101), -INT8_C(  38),  INT8_C(  59), -INT8_C(  72),
+        -INT8_C(  42),  INT8_C(   8), -INT8_C(  22), -INT8_C(  26),  INT8_C(  26),  INT8_C(  30), -INT8_C(   4), -INT8_C(  23) } },
+    { { -INT8_C(  48), -INT8_C(  87),  INT8_C(  78), -INT8_C(  26),  INT8_C(  27), -INT8_C(  27), -INT8_C(   8), -INT8_C(  31),
+        -INT8_C(  78), -INT8_C(  23),      INT8_MIN,  INT8_C(  83), -INT8_C(  73),  INT8_C(   2),  INT8_C( 124),  INT8_C( 110) },
+      UINT16_C(18335),
+      { -INT8_C(  79),  INT8_C(  18),  INT8_C(  10), -INT8_C(  42), -INT8_C(  33),  INT8_C(  90),  INT8_C(  36),  INT8_C( 118),
+        -INT8_C(  60), -INT8_C(  27),  INT8_C(  50),  INT8_C(  94),  INT8_C(  94), -INT8_C(  72),  INT8_C( 103),  INT8_C(  93) },
+      { -INT8_C(  12), -INT8_C(  37),  INT8_C(  16),  INT8_C(  66), -INT8_C(  48),  INT8_C(  13), -INT8_C(  37),  INT8_C(  42),
+        -INT8_C(  38),  INT8_C(   7),  INT8_C(  57), -INT8_C( 103),  INT8_C(   0),  INT8_C(  92),  INT8_C(  70), -INT8_C(  54) },
+      { -INT8_C(  38),  INT8_C(   7),  INT8_C(  57), -INT8_C( 103),  INT8_C(   0), -INT8_C(  27), -INT8_C(   8), -INT8_C(  54),
+        -INT8_C(  79),  INT8_C(  18),  INT8_C(  10),  INT8_C(  83), -INT8_C(  73),  INT8_C(   2),  INT8_C(  36),  INT8_C( 110) } },
+    { {  INT8_C(  37),  INT8_C(  59),  INT8_C(  27), -INT8_C(  89), -INT8_C( 118),  INT8_C(  25),  INT8_C(  49), -INT8_C(  97),
+        -INT8_C(  88),  INT8_C( 107), -INT8_C(  21),  INT8_C(  34), -INT8_C( 124),  INT8_C(  77),  INT8_C(  47),  INT8_C(  29) },
+      UINT16_C(54607),
+      {  INT8_C( 107),  INT8_C( 123), -INT8_C( 111), -INT8_C( 100),  INT8_C(  67),  INT8_C(  55), -INT8_C(  67),  INT8_C(  54),
+         INT8_C(  54),  INT8_C(  88),  INT8_C(  76), -INT8_C(  74),  INT8_C(   1),  INT8_C(  89), -INT8_C(  37), -INT8_C(  10) },
+      { -INT8_C(  63), -INT8_C(  60),  INT8_C(  11),  INT8_C(   5),  INT8_C( 109), -INT8_C(  25), -INT8_C(   8), -INT8_C( 123),
+        -INT8_C(  92), -INT8_C(  41),  INT8_C(  32),  INT8_C(   0),  INT8_C( 104),  INT8_C( 108),  INT8_C(  36), -INT8_C(  68) },
+      { -INT8_C(  92), -INT8_C(  41),  INT8_C(  32),  INT8_C(   0), -INT8_C( 118),  INT8_C(  25),  INT8_C(  36), -INT8_C(  97),
+         INT8_C( 107),  INT8_C( 107), -INT8_C( 111),  INT8_C(  34),  INT8_C(  67),  INT8_C(  77), -INT8_C(  67),  INT8_C(  54) } },
+    { {  INT8_C(  88), -INT8_C(  44), -INT8_C(  99), -INT8_C(  64), -INT8_C(  13),  INT8_C(  34),  INT8_C(  22),  INT8_C(  16),
+        -INT8_C( 106), -INT8_C(  59),  INT8_C( 112),  INT8_C(  44), -INT8_C(  12), -INT8_C(  27),  INT8_C( 106), -INT8_C(  66) },
+      UINT16_C(55981),
+      { -INT8_C(  68), -INT8_C(  35), -INT8_C(  34), -INT8_C( 103), -INT8_C(  82),  INT8_C( 123),  INT8_C(  45), -INT8_C(  81),
+        -INT8_C( 120),  INT8_C( 123),  INT8_C(  45), -INT8_C(  67),  INT8_C(  52),  INT8_C(  70), -INT8_C(  42),  INT8_C(  81) },
+      {  INT8_C(  15),  INT8_C(  65),  INT8_C(  31), -INT8_C(  17), -INT8_C(  76),  INT8_C(  25), -INT8_C(   5),  INT8_C( 124),
+         INT8_C(  64),      INT8_MIN, -INT8_C(  11),  INT8_C(  80),  INT8_C(  90), -INT8_C(  26),  INT8_C(  35), -INT8_C(  27) },
+      {  INT8_C(  64), -INT8_C(  44), -INT8_C(  11),  INT8_C(  80), -INT8_C(  13), -INT8_C(  26),  INT8_C(  22), -INT8_C(  27),
+        -INT8_C( 106), -INT8_C(  35),  INT8_C( 112), -INT8_C( 103), -INT8_C(  82), -INT8_C(  27),  INT8_C(  45), -INT8_C(  81) } },
+    { { -INT8_C(  87), -INT8_C(  92), -INT8_C(  93), -INT8_C(  60), -INT8_C( 113),  INT8_C(  40),  INT8_C( 124), -INT8_C(  70),
+         INT8_C(  15), -INT8_C(  53),  INT8_C(  98), -INT8_C(   2),  INT8_C( 107),  INT8_C( 109), -INT8_C(  75),  INT8_C(   0) },
+      UINT16_C(40596),
+      {  INT8_C(  98),  INT8_C(  60), -INT8_C(  50),  INT8_C( 109), -INT8_C(  47), -INT8_C(   4),  INT8_C( 103),  INT8_C(  27),
+         INT8_C(  33), -INT8_C( 107),  INT8_C(  56),  INT8_C( 110),  INT8_C( 110),  INT8_C(  68), -INT8_C(  76),  INT8_C( 101) },
+      {  INT8_C(  36), -INT8_C(  24),  INT8_C( 113),  INT8_C(  33),  INT8_C(  13),  INT8_C(  61), -INT8_C( 107),  INT8_C(  26),
+        -INT8_C(  52),  INT8_C( 127), -INT8_C( 107),  INT8_C(  14), -INT8_C( 112),  INT8_C(  57), -INT8_C(  61), -INT8_C( 116) },
+      { -INT8_C(  87), -INT8_C(  92), -INT8_C( 107), -INT8_C(  60), -INT8_C( 112),  INT8_C(  40),  INT8_C( 124), -INT8_C( 116),
+         INT8_C(  15),  INT8_C(  60), -INT8_C(  50),  INT8_C( 109), -INT8_C(  47),  INT8_C( 109), -INT8_C(  75),  INT8_C(  27) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi8(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi8(test_vec[i].b);
+    simde__m128i r = simde_mm_mask_alignr_epi8(src, test_vec[i].k, a, b, INT32_C(  8));
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_alignr_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int8_t a[16];
+    const int8_t b[16];
+    const int8_t r[16];
+  } test_vec[] = {
+    { UINT16_C(29438),
+      { -INT8_C( 101), -INT8_C(  60), -INT8_C(  69), -INT8_C(  58), -INT8_C(  95), -INT8_C(  94), -INT8_C(  61), -INT8_C( 112),
+        -INT8_C(  67), -INT8_C(  96),  INT8_C(  91), -INT8_C( 115), -INT8_C(  70), -INT8_C(  33), -INT8_C( 108), -INT8_C(  17) },
+      {  INT8_C(  40), -INT8_C(  92),  INT8_C(  53), -INT8_C(  71), -INT8_C(  72), -INT8_C( 113),  INT8_C(  90),  INT8_C(  32),
+         INT8_C(  18), -INT8_C( 110),  INT8_C(  45), -INT8_C(  33),  INT8_C(  46),  INT8_C(  58),  INT8_C( 112), -INT8_C(  52) },
+      {  INT8_C(   0),  INT8_C(  45), -INT8_C(  33),  INT8_C(  46),  INT8_C(  58),  INT8_C( 112), -INT8_C(  52), -INT8_C( 101),
+         INT8_C(   0), -INT8_C(  69),  INT8_C(   0),  INT8_C(   0), -INT8_C(  94), -INT8_C(  61), -INT8_C( 112),  INT8_C(   0) } },
+    { UINT16_C(30219),
+      {  INT8_C(  39), -INT8_C( 113),  INT8_C(  70), -INT8_C(   8), -INT8_C(  71),  INT8_C(  36),  INT8_C(   6), -INT8_C(  72),
+         INT8_C(  83), -INT8_C(  63), -INT8_C(   8), -INT8_C(  25),  INT8_C(  64), -INT8_C( 122),  INT8_C(  23), -INT8_C(   5) },
+      {  INT8_C(  30), -INT8_C(   4), -INT8_C(  69), -INT8_C(   4), -INT8_C(   3), -INT8_C(  34),  INT8_C(  63), -INT8_C(  61),
+         INT8_C(  62), -INT8_C(  84),  INT8_C( 121),  INT8_C(   5), -INT8_C(  65), -INT8_C( 124),  INT8_C( 123),  INT8_C(   3) },
+      { -INT8_C(  84),  INT8_C( 121),  INT8_C(   0), -INT8_C(  65),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(  70), -INT8_C(   8),  INT8_C(   0),  INT8_C(  36),  INT8_C(   6), -INT8_C(  72),  INT8_C(   0) } },
+    { UINT16_C(25524),
+      {  INT8_C( 115), -INT8_C(  41), -INT8_C(   2), -INT8_C(  63),  INT8_C(  40), -INT8_C(  18), -INT8_C(  83),  INT8_C(  22),
+         INT8_C( 120), -INT8_C(  60),  INT8_C(  45), -INT8_C(  15),  INT8_C(  42),  INT8_C( 114), -INT8_C(  40), -INT8_C(  97) },
+      { -INT8_C(   4), -INT8_C(  65),  INT8_C(  86),  INT8_C( 120),  INT8_C(  24), -INT8_C(  10), -INT8_C(   9), -INT8_C(  84),
+        -INT8_C( 121), -INT8_C( 112),  INT8_C(  77), -INT8_C( 115), -INT8_C(  74), -INT8_C( 117), -INT8_C(  14), -INT8_C( 125) },
+      {  INT8_C(   0),  INT8_C(   0), -INT8_C( 115),  INT8_C(   0), -INT8_C( 117), -INT8_C(  14),  INT8_C(   0),  INT8_C( 115),
+        -INT8_C(  41), -INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  83),  INT8_C(  22),  INT8_C(   0) } },
+    { UINT16_C(60445),
+      { -INT8_C( 123), -INT8_C( 124),  INT8_C(  17),  INT8_C(   9), -INT8_C(  61),  INT8_C(  82), -INT8_C(  96),  INT8_C(  55),
+        -INT8_C(  69),  INT8_C( 102), -INT8_C(  98),  INT8_C(  23), -INT8_C(  69),  INT8_C(   6), -INT8_C(  78), -INT8_C( 103) },
+      {  INT8_C(  52), -INT8_C(  50), -INT8_C(  65), -INT8_C(  86), -INT8_C(  21), -INT8_C(  16),  INT8_C(   9), -INT8_C(  27),
+         INT8_C( 108), -INT8_C( 108), -INT8_C(  59),  INT8_C(  82), -INT8_C(  42), -INT8_C(  89), -INT8_C( 108),  INT8_C(  61) },
+      { -INT8_C( 108),  INT8_C(   0),  INT8_C(  82), -INT8_C(  42), -INT8_C(  89),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   9), -INT8_C(  61),  INT8_C(   0), -INT8_C(  96),  INT8_C(  55), -INT8_C(  69) } },
+    { UINT16_C(57227),
+      { -INT8_C(  12),  INT8_C(  17),  INT8_C(  91), -INT8_C(  55), -INT8_C( 116), -INT8_C(  77),  INT8_C( 110),  INT8_C(   2),
+         INT8_C(  82), -INT8_C(  78),  INT8_C(  21), -INT8_C(  55), -INT8_C(  76), -INT8_C(  85),  INT8_C(  72),  INT8_C(  84) },
+      {  INT8_C(  45), -INT8_C(  99),  INT8_C(   0), -INT8_C(  38),  INT8_C( 119), -INT8_C(   3),  INT8_C(  26), -INT8_C(  22),
+         INT8_C(  13), -INT8_C( 103),  INT8_C(  10),  INT8_C( 108), -INT8_C(  72), -INT8_C(  73),  INT8_C( 114), -INT8_C(  48) },
+      { -INT8_C( 103),  INT8_C(  10),  INT8_C(   0), -INT8_C(  72),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  12),
+         INT8_C(  17),  INT8_C(  91), -INT8_C(  55), -INT8_C( 116), -INT8_C(  77),  INT8_C(   0),  INT8_C(   2),  INT8_C(  82) } },
+    { UINT16_C(30707),
+      { -INT8_C(  36), -INT8_C(  17),  INT8_C(  48),  INT8_C(  64), -INT8_C(  38), -INT8_C(  99), -INT8_C(  84),  INT8_C(  75),
+        -INT8_C(  79), -INT8_C( 118), -INT8_C( 107), -INT8_C( 102), -INT8_C(  59),  INT8_C(  28), -INT8_C( 126),  INT8_C( 101) },
+      {  INT8_C(  37), -INT8_C(  75),  INT8_C( 114),  INT8_C(   0),  INT8_C(  78), -INT8_C(  64), -INT8_C(  25),  INT8_C(  16),
+         INT8_C(  34), -INT8_C(  70),  INT8_C( 101), -INT8_C(  57), -INT8_C(  40), -INT8_C(  23), -INT8_C(  22), -INT8_C(  43) },
+      { -INT8_C(  70),  INT8_C( 101),  INT8_C(   0),  INT8_C(   0), -INT8_C(  23), -INT8_C(  22), -INT8_C(  43), -INT8_C(  36),
+        -INT8_C(  17),  INT8_C(  48),  INT8_C(  64),  INT8_C(   0), -INT8_C(  99), -INT8_C(  84),  INT8_C(  75),  INT8_C(   0) } },
+    { UINT16_C( 9154),
+      {  INT8_C(   5), -INT8_C(  65),  INT8_C(   6),  INT8_C(  66), -INT8_C( 114),  INT8_C(  63), -INT8_C( 115), -INT8_C(   8),
+        -INT8_C(  41), -INT8_C(  92), -INT8_C(  79),  INT8_C( 114),  INT8_C(  60),  INT8_C(  26),  INT8_C(  34), -INT8_C( 100) },
+      { -INT8_C(  58), -INT8_C(  55), -INT8_C(  96),  INT8_C( 103), -INT8_C(  87), -INT8_C(  76), -INT8_C( 111), -INT8_C(  52),
+        -INT8_C(  95), -INT8_C(  38), -INT8_C(  47),  INT8_C(   2),  INT8_C(  38),  INT8_C(  24), -INT8_C( 106),  INT8_C( 117) },
+      {  INT8_C(   0), -INT8_C(  47),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 117),  INT8_C(   5),
+        -INT8_C(  65),  INT8_C(   6),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 115),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(33413),
+      { -INT8_C(  64),  INT8_C(  73),  INT8_C( 123), -INT8_C(   5),  INT8_C( 112), -INT8_C( 118), -INT8_C( 105), -INT8_C(  54),
+         INT8_C( 107), -INT8_C(  85),  INT8_C(  30),  INT8_C(  40),  INT8_C( 122),  INT8_C(  18),  INT8_C(  30), -INT8_C(  18) },
+      { -INT8_C( 104),  INT8_C(  53), -INT8_C(   9),  INT8_C(  28), -INT8_C( 102),  INT8_C(  23), -INT8_C(  15), -INT8_C(  82),
+        -INT8_C(   3),  INT8_C(  10), -INT8_C(  54),  INT8_C(  93), -INT8_C( 123),  INT8_C(  62),  INT8_C( 122), -INT8_C( 110) },
+      {  INT8_C(  10),  INT8_C(   0),  INT8_C(  93),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  64),
+         INT8_C(   0),  INT8_C( 123),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 107) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi8(test_vec[i].b);
+    simde__m128i r = simde_mm_maskz_alignr_epi8(test_vec[i].k, a, b, INT32_C(  9));
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_alignr_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[32];
+    const simde__mmask32 k;
+    const int8_t a[32];
+    const int8_t b[32];
+    const int8_t r[32];
+  } test_vec[] = {
+    { {  INT8_C( 125), -INT8_C(  29),  INT8_C(  34), -INT8_C(  82),  INT8_C(  83), -INT8_C(  81),  INT8_C(  52),  INT8_C(  54),
+        -INT8_C(  34), -INT8_C(  59),  INT8_C( 124),  INT8_C(  82),  INT8_C(  66),  INT8_C(  60), -INT8_C(  74),  INT8_C(  85),
+        -INT8_C( 105),  INT8_C( 104),  INT8_C(  34),  INT8_C(  74), -INT8_C(  70), -INT8_C(  51),  INT8_C( 112), -INT8_C(   2),
+         INT8_C(  79), -INT8_C( 115), -INT8_C(  32), -INT8_C( 113),  INT8_C(  46), -INT8_C(  16), -INT8_C(  13),  INT8_C( 114) },
+      UINT32_C(4102869279),
+      { -INT8_C( 113),  INT8_C(   4),  INT8_C(  32),  INT8_C( 108), -INT8_C(  86), -INT8_C(  41),  INT8_C(  44), -INT8_C(  66),
+         INT8_C(  75),  INT8_C(  29),  INT8_C(  19), -INT8_C(  61),  INT8_C( 102), -INT8_C(  26), -INT8_C(  43),  INT8_C(  64),
+        -INT8_C(  84),  INT8_C(  57), -INT8_C(  57), -INT8_C(   2), -INT8_C(  33),  INT8_C(  38),  INT8_C(  34),  INT8_C(  22),
+         INT8_C(  74),      INT8_MIN, -INT8_C(  83), -INT8_C( 120),  INT8_C( 105),  INT8_C(  97), -INT8_C(  99),  INT8_C(  56) },
+      { -INT8_C(  22),  INT8_C(  33),  INT8_C(  25),  INT8_C( 107), -INT8_C( 109), -INT8_C(  62),  INT8_C(  85),  INT8_C(  95),
+         INT8_C( 109),  INT8_C( 125), -INT8_C(  81),  INT8_C(  96),  INT8_C(  74),  INT8_C( 104),  INT8_C(  84),  INT8_C(  92),
+         INT8_C( 114), -INT8_C(  54), -INT8_C(  11), -INT8_C(  62), -INT8_C(  13), -INT8_C(  98),  INT8_C( 111), -INT8_C(  11),
+         INT8_C( 102),  INT8_C( 106),  INT8_C(  80), -INT8_C(  34),  INT8_C(   5), -INT8_C(  21), -INT8_C( 122),  INT8_C(  11) },
+      {  INT8_C(  92), -INT8_C( 113),  INT8_C(   4),  INT8_C(  32),  INT8_C( 108), -INT8_C(  81),  INT8_C(  52),  INT8_C(  54),
+        -INT8_C(  66), -INT8_C(  59),  INT8_C( 124),  INT8_C(  82), -INT8_C(  61),  INT8_C(  60), -INT8_C(  26), -INT8_C(  43),
+        -INT8_C( 105),  INT8_C( 104),  INT8_C(  57), -INT8_C(  57), -INT8_C(  70), -INT8_C(  51),  INT8_C( 112),  INT8_C(  34),
+         INT8_C(  79), -INT8_C( 115),      INT8_MIN, -INT8_C( 113), -INT8_C( 120),  INT8_C( 105),  INT8_C(  97), -INT8_C(  99) } },
+    { {  INT8_C(  96),  INT8_C(  96), -INT8_C( 116), -INT8_C(  53),  INT8_C(  10),  INT8_C( 104), -INT8_C(  44), -INT8_C(  13),
+         INT8_C(  10),  INT8_C( 120),  INT8_C(   2), -INT8_C(  84),  INT8_C(  73),  INT8_C(  97), -INT8_C(   5), -INT8_C( 102),
+         INT8_C( 109),  INT8_C(  97), -INT8_C(  95),  INT8_C(  10), -INT8_C(  44),  INT8_C( 119), -INT8_C(  67),  INT8_C(  46),
+         INT8_C(  78),  INT8_C(   4),  INT8_C(   4), -INT8_C(  70),  INT8_C( 107),  INT8_C(  25),  INT8_C(  85),  INT8_C(  91) },
+      UINT32_C( 340497803),
+      {  INT8_C(   8),  INT8_C(  12),  INT8_C(  24), -INT8_C(  58), -INT8_C(  13), -INT8_C(   4), -INT8_C(  47), -INT8_C(  14),
+         INT8_C(  13),  INT8_C(  99), -INT8_C(  71), -INT8_C(  54), -INT8_C(  19),  INT8_C(  52), -INT8_C(  72), -INT8_C(  81),
+         INT8_C( 110),  INT8_C(  20), -INT8_C( 108),  INT8_C(  25), -INT8_C(  13), -INT8_C(  64),  INT8_C(  19), -INT8_C(  57),
+         INT8_C(  82), -INT8_C( 122),  INT8_C(  15), -INT8_C( 127),  INT8_C(  94),  INT8_C(  50),      INT8_MIN,  INT8_C(  51) },
+      { -INT8_C(  39), -INT8_C(  10), -INT8_C(  13),  INT8_C(  72), -INT8_C(  80), -INT8_C(  85),  INT8_C(  88), -INT8_C( 104),
+         INT8_C(  93), -INT8_C(   9),  INT8_C(   8), -INT8_C(  10), -INT8_C( 101),  INT8_C(   4),  INT8_C( 124), -INT8_C(   6),
+         INT8_C( 125), -INT8_C(  61), -INT8_C(  64),  INT8_C(  89), -INT8_C(   9),  INT8_C(  26),  INT8_C(  72), -INT8_C(  86),
+         INT8_C(  83),  INT8_C(   1),  INT8_C(  49), -INT8_C(  93), -INT8_C(  32), -INT8_C( 109),  INT8_C(  40),  INT8_C(  24) },
+      { -INT8_C(   6),  INT8_C(   8), -INT8_C( 116),  INT8_C(  24),  INT8_C(  10),  INT8_C( 104), -INT8_C(  44), -INT8_C(  47),
+        -INT8_C(  14),  INT8_C( 120),  INT8_C(  99), -INT8_C(  84), -INT8_C(  54),  INT8_C(  97), -INT8_C(   5), -INT8_C(  72),
+         INT8_C(  24),  INT8_C( 110), -INT8_C(  95), -INT8_C( 108), -INT8_C(  44),  INT8_C( 119), -INT8_C(  64),  INT8_C(  46),
+         INT8_C(  78),  INT8_C(   4), -INT8_C( 122), -INT8_C(  70), -INT8_C( 127),  INT8_C(  25),  INT8_C(  85),  INT8_C(  91) } },
+    { { -INT8_C(  74),  INT8_C( 123), -INT8_C(  77), -INT8_C(  80), -INT8_C(  47), -INT8_C(  34),  INT8_C(   1),  INT8_C(  79),
+        -INT8_C(  97), -INT8_C(   4), -INT8_C(  49),  INT8_C(  52),      INT8_MIN,  INT8_C( 109), -INT8_C( 109),  INT8_C(  92),
+        -INT8_C(   4),  INT8_C(  93),  INT8_C( 119), -INT8_C(  61),  INT8_C(  60), -INT8_C(  92), -INT8_C( 121), -INT8_C(  72),
+        -INT8_C( 105), -INT8_C(  66), -INT8_C(  57),  INT8_C(  98), -INT8_C(  10),  INT8_C(  51),  INT8_C(   1),  INT8_C(   7) },
+      UINT32_C( 796100646),
+      {  INT8_C(  47),  INT8_C(  19), -INT8_C(  71), -INT8_C(  98), -INT8_C(  95),  INT8_C(  60),  INT8_C(  86),  INT8_C( 122),
+         INT8_C(  20),  INT8_C( 108), -INT8_C(  46),  INT8_C( 111), -INT8_C(  19),  INT8_C(  30), -INT8_C( 108),  INT8_C(  71),
+        -INT8_C(  85), -INT8_C(  42),  INT8_C(   3),  INT8_C(  37), -INT8_C(  79),  INT8_C( 116), -INT8_C( 114),  INT8_C(  35),
+        -INT8_C(  55),  INT8_C( 104), -INT8_C(  28), -INT8_C( 105),  INT8_C(  34), -INT8_C(  94), -INT8_C(  55),  INT8_C( 108) },
+      {  INT8_C( 127), -INT8_C( 115),  INT8_C(  82),  INT8_C(  92),  INT8_C(  46),  INT8_C(  38), -INT8_C(  96),  INT8_C(  39),
+         INT8_C(  51), -INT8_C(  71),  INT8_C( 102),  INT8_C(  48),  INT8_C(   0), -INT8_C(   6), -INT8_C(  39),  INT8_C(  74),
+        -INT8_C( 112),  INT8_C(  61),  INT8_C( 125), -INT8_C(   1),  INT8_C(   0), -INT8_C(  78),  INT8_C(  21),  INT8_C(  99),
+         INT8_C(  59),  INT8_C(  35), -INT8_C(  19), -INT8_C( 116), -INT8_C(  39),  INT8_C(  62), -INT8_C( 114),  INT8_C(  83) },
+      { -INT8_C(  74),  INT8_C(  47),  INT8_C(  19), -INT8_C(  80), -INT8_C(  47), -INT8_C(  95),  INT8_C(   1),  INT8_C(  79),
+        -INT8_C(  97), -INT8_C(   4), -INT8_C(  49), -INT8_C(  46),      INT8_MIN,  INT8_C( 109), -INT8_C( 109), -INT8_C( 108),
+         INT8_C(  83), -INT8_C(  85),  INT8_C( 119), -INT8_C(  61),  INT8_C(  37), -INT8_C(  79),  INT8_C( 116), -INT8_C(  72),
+         INT8_C(  35), -INT8_C(  55),  INT8_C( 104), -INT8_C(  28), -INT8_C(  10),  INT8_C(  34),  INT8_C(   1),  INT8_C(   7) } },
+    { {  INT8_C(  27),  INT8_C( 121), -INT8_C( 121), -INT8_C(  48),  INT8_C(  97),  INT8_C(   3), -INT8_C(  99),  INT8_C(  40),
+        -INT8_C(  50), -INT8_C( 125),  INT8_C(  56),  INT8_C( 120),  INT8_C( 104), -INT8_C(  66), -INT8_C(  15),  INT8_C(   0),
+        -INT8_C(   4), -INT8_C(  75), -INT8_C(  78),  INT8_C( 111),  INT8_C(  25), -INT8_C(  67),  INT8_C(  68), -INT8_C( 104),
+         INT8_C(  95),  INT8_C(   9),  INT8_C( 121),  INT8_C(  61), -INT8_C(  41), -INT8_C( 100),  INT8_C(  15), -INT8_C(  59) },
+      UINT32_C(1122298828),
+      {  INT8_C( 108), -INT8_C(  74), -INT8_C(  17), -INT8_C(  38), -INT8_C( 119),  INT8_C(  78),  INT8_C(  50),  INT8_C(  52),
+         INT8_C(  44), -INT8_C( 108), -INT8_C(  85), -INT8_C(  20),  INT8_C(   7),  INT8_C(  99),  INT8_C(  39), -INT8_C(  95),
+        -INT8_C( 122), -INT8_C(  43), -INT8_C(  36), -INT8_C(   3), -INT8_C(   2),  INT8_C(  15),  INT8_C(  23), -INT8_C(  95),
+        -INT8_C(  70), -INT8_C(  89), -INT8_C(  18), -INT8_C(  65), -INT8_C( 102), -INT8_C(  13), -INT8_C(  42),  INT8_C( 111) },
+      { -INT8_C( 125),  INT8_C( 108),  INT8_C(  24),  INT8_C(   8),  INT8_C(  10),  INT8_C(  86), -INT8_C(  92),  INT8_C(  87),
+        -INT8_C(  41), -INT8_C(   8),  INT8_C(  65),  INT8_C(  35),  INT8_C(  81),  INT8_C(  21), -INT8_C( 111),  INT8_C( 118),
+        -INT8_C(  16), -INT8_C(  25), -INT8_C(   2),  INT8_C(  45), -INT8_C(  29),  INT8_C(  10), -INT8_C(  26), -INT8_C(  63),
+        -INT8_C( 112), -INT8_C(  95), -INT8_C(  14), -INT8_C(  23), -INT8_C(  16),  INT8_C(  41),  INT8_C(   1), -INT8_C(  31) },
+      {  INT8_C(  27),  INT8_C( 121), -INT8_C(  74), -INT8_C(  17),  INT8_C(  97),  INT8_C(   3),  INT8_C(  78),  INT8_C(  50),
+         INT8_C(  52),  INT8_C(  44),  INT8_C(  56), -INT8_C(  85),  INT8_C( 104),  INT8_C(   7),  INT8_C(  99),  INT8_C(  39),
+        -INT8_C(   4), -INT8_C(  75), -INT8_C(  43),  INT8_C( 111),  INT8_C(  25), -INT8_C(   2),  INT8_C(  15),  INT8_C(  23),
+         INT8_C(  95), -INT8_C(  70),  INT8_C( 121),  INT8_C(  61), -INT8_C(  41), -INT8_C( 100), -INT8_C(  13), -INT8_C(  59) } },
+    { {  INT8_C( 106),  INT8_C(  58),  INT8_C(  46), -INT8_C(   6),  INT8_C(  67),  INT8_C( 125),  INT8_C(  29), -INT8_C(  27),
+         INT8_C(  48), -INT8_C(   6), -INT8_C(  85),  INT8_C(  20),  INT8_C(  36), -INT8_C( 104), -INT8_C(  15),  INT8_C(  86),
+         INT8_C(  68), -INT8_C(  14), -INT8_C(  37),  INT8_C( 118),      INT8_MIN,  INT8_C(  25),  INT8_C(  13), -INT8_C(  87),
+        -INT8_C(  48),  INT8_C(  79), -INT8_C(   7), -INT8_C( 126),  INT8_C(  27), -INT8_C(  23), -INT8_C( 104),  INT8_C(  25) },
+      UINT32_C(1510547691),
+      {  INT8_C(  22),  INT8_C(   4),  INT8_C(  90), -INT8_C(  48), -INT8_C(  63),  INT8_C(  58),  INT8_C( 118),  INT8_C( 112),
+         INT8_C(  18),  INT8_C(  20), -INT8_C(  76),  INT8_C(  85), -INT8_C(  79),  INT8_C( 126), -INT8_C( 126),  INT8_C( 109),
+         INT8_C(  93),  INT8_C(  79),  INT8_C( 119),  INT8_C(  63),  INT8_C(   3),  INT8_C( 117),  INT8_C(   3), -INT8_C(  93),
+        -INT8_C( 102),  INT8_C(  59), -INT8_C(  21),  INT8_C(   0), -INT8_C( 110),  INT8_C( 109), -INT8_C(  67),  INT8_C(  40) },
+      { -INT8_C(  55),  INT8_C(  84),  INT8_C(  66), -INT8_C(  28),  INT8_C(   7),  INT8_C( 111), -INT8_C(  65),  INT8_C(  34),
+         INT8_C(  50), -INT8_C(  38),  INT8_C(  75),  INT8_C(  57),  INT8_C(  43),  INT8_C( 109),  INT8_C(  11), -INT8_C(   5),
+         INT8_C(  46),  INT8_C(  30),  INT8_C(  30),  INT8_C(  98),  INT8_C(  14),  INT8_C(  10), -INT8_C(   6),  INT8_C(  97),
+         INT8_C(  27), -INT8_C(  67), -INT8_C(  12), -INT8_C(  31), -INT8_C(  54), -INT8_C( 109),  INT8_C(  98), -INT8_C(   4) },
+      { -INT8_C(   5),  INT8_C(  22),  INT8_C(  46),  INT8_C(  90),  INT8_C(  67), -INT8_C(  63),  INT8_C(  58),  INT8_C( 118),
+         INT8_C(  48), -INT8_C(   6), -INT8_C(  85),  INT8_C(  20),  INT8_C(  36), -INT8_C(  79), -INT8_C(  15),  INT8_C(  86),
+        -INT8_C(   4), -INT8_C(  14), -INT8_C(  37),  INT8_C( 119),      INT8_MIN,  INT8_C(  25),  INT8_C(  13), -INT8_C(  87),
+        -INT8_C(  48), -INT8_C( 102), -INT8_C(   7), -INT8_C(  21),  INT8_C(   0), -INT8_C(  23),  INT8_C( 109),  INT8_C(  25) } },
+    { {  INT8_C(  90), -INT8_C(  36),  INT8_C(  37),  INT8_C(  99),  INT8_C(   3), -INT8_C(  95), -INT8_C( 124),  INT8_C(  55),
+         INT8_C(  75), -INT8_C( 101), -INT8_C(  46),  INT8_C( 115), -INT8_C(  61),  INT8_C( 124), -INT8_C(  66), -INT8_C( 111),
+        -INT8_C(  26), -INT8_C(  73),  INT8_C( 122), -INT8_C(  32), -INT8_C(  81), -INT8_C( 100), -INT8_C(   1), -INT8_C(  92),
+         INT8_C(  57), -INT8_C(   3),  INT8_C(  16), -INT8_C(  96),  INT8_C(  97), -INT8_C(  21),  INT8_C( 118), -INT8_C(  58) },
+      UINT32_C(3450378411),
+      {  INT8_C(  54), -INT8_C(  38), -INT8_C(  89),  INT8_C(   4), -INT8_C(  32),  INT8_C(  43), -INT8_C(  73), -INT8_C(  66),
+         INT8_C(  33),  INT8_C(  19),  INT8_C(  21),  INT8_C(  45),  INT8_C(  69),  INT8_C( 127), -INT8_C(  83),  INT8_C(   4),
+        -INT8_C( 112), -INT8_C(  51), -INT8_C(   2),  INT8_C( 117), -INT8_C(  89),  INT8_C( 114),  INT8_C(  42), -INT8_C(  32),
+        -INT8_C(   9),  INT8_C(   4), -INT8_C(  16),  INT8_C(  31),  INT8_C(  99),  INT8_C(  83), -INT8_C(  37), -INT8_C(  10) },
+      { -INT8_C(  78), -INT8_C(  95), -INT8_C(  82), -INT8_C( 125), -INT8_C(  20), -INT8_C( 101),  INT8_C(  16), -INT8_C(  56),
+         INT8_C( 111),  INT8_C(  79), -INT8_C(  19), -INT8_C( 100),  INT8_C(  85), -INT8_C(  71),  INT8_C( 112), -INT8_C( 126),
+         INT8_C( 121),  INT8_C( 111), -INT8_C( 127),  INT8_C(  36), -INT8_C( 102),  INT8_C(  93), -INT8_C(  33),  INT8_C(  88),
+         INT8_C(   8),  INT8_C( 108), -INT8_C(  72), -INT8_C( 121),  INT8_C(  98), -INT8_C(  24), -INT8_C(  99),  INT8_C(  32) },
+      { -INT8_C( 126),  INT8_C(  54),  INT8_C(  37), -INT8_C(  89),  INT8_C(   3), -INT8_C(  32), -INT8_C( 124), -INT8_C(  73),
+         INT8_C(  75), -INT8_C( 101), -INT8_C(  46),  INT8_C(  21),  INT8_C(  45),  INT8_C( 124), -INT8_C(  66), -INT8_C(  83),
+        -INT8_C(  26), -INT8_C(  73),  INT8_C( 122), -INT8_C(   2), -INT8_C(  81), -INT8_C(  89), -INT8_C(   1),  INT8_C(  42),
+        -INT8_C(  32), -INT8_C(   3),  INT8_C(   4), -INT8_C(  16),  INT8_C(  97), -INT8_C(  21),  INT8_C(  83), -INT8_C(  37) } },
+    { {  INT8_C( 100),  INT8_C(  78),  INT8_C( 108), -INT8_C(  26), -INT8_C(  19),  INT8_C(  10), -INT8_C(  46), -INT8_C( 101),
+         INT8_C(  10), -INT8_C(  88),  INT8_C( 117),  INT8_C(   9), -INT8_C(  71),  INT8_C(  72),  INT8_C( 108), -INT8_C( 114),
+        -INT8_C(  27), -INT8_C(  94), -INT8_C( 101), -INT8_C( 122), -INT8_C(  29), -INT8_C(  42), -INT8_C(  49),  INT8_C(  10),
+        -INT8_C( 122), -INT8_C(  87),  INT8_C(  10), -INT8_C( 106), -INT8_C( 125),  INT8_C(  50),  INT8_C(  80), -INT8_C(  74) },
+      UINT32_C(2519613605),
+      { -INT8_C( 108), -INT8_C(  23), -INT8_C(  64),  INT8_C(  45),  INT8_C(  13),  INT8_C(  91), -INT8_C(  31),  INT8_C(  26),
+        -INT8_C(  44), -INT8_C(  27), -INT8_C(  70),  INT8_C(  67),  INT8_C(  63),  INT8_C(  77), -INT8_C(  65), -INT8_C(  54),
+         INT8_C(  45), -INT8_C( 119), -INT8_C(  94),  INT8_C(  81),  INT8_C(  35),  INT8_C( 119),  INT8_C(  67),  INT8_C(  31),
+        -INT8_C( 123),  INT8_C(  68), -INT8_C(  32),  INT8_C( 121), -INT8_C(  37),  INT8_C( 118),  INT8_C( 114),  INT8_C( 126) },
+      { -INT8_C(  38), -INT8_C(  25),  INT8_C(  72), -INT8_C(  66), -INT8_C(  61),  INT8_C(   0), -INT8_C(   8), -INT8_C(  87),
+         INT8_C(  30), -INT8_C(  82), -INT8_C(  43), -INT8_C(  80),  INT8_C(  13),  INT8_C(  63), -INT8_C(  67), -INT8_C(  42),
+         INT8_C(  93), -INT8_C( 109), -INT8_C(  52), -INT8_C(  31),  INT8_C(  14), -INT8_C(  50), -INT8_C(  73),  INT8_C( 118),
+        -INT8_C( 110),  INT8_C( 109),  INT8_C( 121),  INT8_C(  29),  INT8_C(  31),  INT8_C( 123), -INT8_C( 115), -INT8_C(  20) },
+      { -INT8_C(  42),  INT8_C(  78), -INT8_C(  23), -INT8_C(  26), -INT8_C(  19),  INT8_C(  13), -INT8_C(  46), -INT8_C(  31),
+         INT8_C(  10), -INT8_C(  88),  INT8_C( 117),  INT8_C(   9), -INT8_C(  71),  INT8_C(  72),  INT8_C(  77), -INT8_C( 114),
+        -INT8_C(  27),  INT8_C(  45), -INT8_C( 119), -INT8_C(  94), -INT8_C(  29),  INT8_C(  35), -INT8_C(  49),  INT8_C(  10),
+        -INT8_C( 122), -INT8_C( 123),  INT8_C(  68), -INT8_C( 106),  INT8_C( 121),  INT8_C(  50),  INT8_C(  80),  INT8_C( 114) } },
+    { {  INT8_C(  21),  INT8_C(  23),  INT8_C( 107), -INT8_C( 117), -INT8_C(  88),  INT8_C(  73), -INT8_C( 109), -INT8_C(  70),
+         INT8_C(  91),  INT8_C(  11), -INT8_C(  55), -INT8_C(  20),  INT8_C( 117),  INT8_C(  27), -INT8_C(  45), -INT8_C( 106),
+        -INT8_C( 105),  INT8_C(  34), -INT8_C(  74), -INT8_C(  55), -INT8_C(  26), -INT8_C(  25), -INT8_C(  80), -INT8_C( 125),
+        -INT8_C( 126),  INT8_C( 125), -INT8_C(  89),  INT8_C(  30),  INT8_C(  98), -INT8_C(  26),  INT8_C(  71),  INT8_C(  49) },
+      UINT32_C(1496838896),
+      {  INT8_C( 112), -INT8_C(  32), -INT8_C(  11),  INT8_C(  70),  INT8_C(  90),  INT8_C(  40), -INT8_C(  16), -INT8_C(  83),
+        -INT8_C(  60), -INT8_C(  49),  INT8_C( 110), -INT8_C(  72), -INT8_C(   7), -INT8_C(  40), -INT8_C(  91),  INT8_C( 120),
+        -INT8_C(  70),  INT8_C( 101),  INT8_C(  37),  INT8_C(  81), -INT8_C(  91), -INT8_C(  40),  INT8_C(  43), -INT8_C( 127),
+         INT8_C(  90), -INT8_C(  34), -INT8_C( 123),  INT8_C(  56), -INT8_C(  42),  INT8_C(  41),  INT8_C( 107),  INT8_C(  95) },
+      {  INT8_C(  38),  INT8_C(  44),  INT8_C(   0),  INT8_C( 110),  INT8_C(  54),  INT8_C(  50),  INT8_C(  98), -INT8_C(  62),
+         INT8_C(  51),  INT8_C(  61), -INT8_C(   5), -INT8_C(  84), -INT8_C(  63),  INT8_C(   0),  INT8_C(   0),  INT8_C(  66),
+        -INT8_C(  30),  INT8_C( 109), -INT8_C( 125), -INT8_C(  76), -INT8_C(  47),  INT8_C(  74), -INT8_C(  50), -INT8_C(  79),
+        -INT8_C( 104),  INT8_C(  53), -INT8_C(  53),  INT8_C( 116),  INT8_C(  94), -INT8_C(  54), -INT8_C(   9),  INT8_C( 102) },
+      {  INT8_C(  21),  INT8_C(  23),  INT8_C( 107), -INT8_C( 117),  INT8_C(  70),  INT8_C(  90),  INT8_C(  40), -INT8_C(  16),
+         INT8_C(  91), -INT8_C(  60), -INT8_C(  55), -INT8_C(  20), -INT8_C(  72), -INT8_C(   7), -INT8_C(  40), -INT8_C(  91),
+         INT8_C( 102), -INT8_C(  70),  INT8_C( 101), -INT8_C(  55),  INT8_C(  81), -INT8_C(  91), -INT8_C(  80), -INT8_C( 125),
+        -INT8_C( 127),  INT8_C( 125), -INT8_C(  89), -INT8_C( 123),  INT8_C(  56), -INT8_C(  26),  INT8_C(  41),  INT8_C(  49) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi8(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi8(test_vec[i].b);
+    simde__m256i r = simde_mm256_mask_alignr_epi8(src, test_vec[i].k, a, b, INT32_C( 15));
+    simde_test_x86_assert_equal_i8x32(r, simde_x_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_alignr_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 k;
+    const int8_t a[32];
+    const int8_t b[32];
+    const int8_t r[32];
+  } test_vec[] = {
+    { UINT32_C( 320021525),
+      {  INT8_C(  29),  INT8_C(  19),  INT8_C(  65), -INT8_C( 125), -INT8_C( 122),  INT8_C(  53),  INT8_C(  63),  INT8_C(  71),
+        -INT8_C(  13),  INT8_C(  98),  INT8_C( 110), -INT8_C(   8), -INT8_C(  91), -INT8_C( 104),  INT8_C(  53),  INT8_C( 123),
+        -INT8_C(  13),  INT8_C(  62), -INT8_C(  36),  INT8_C(  87), -INT8_C(  71), -INT8_C(  30),  INT8_C(  75), -INT8_C( 119),
+        -INT8_C(  62),  INT8_C(  31), -INT8_C(  29),  INT8_C(  66),  INT8_C(  96), -INT8_C(  84), -INT8_C(  47), -INT8_C(  22) },
+      {  INT8_C( 115), -INT8_C(  93),  INT8_C( 114), -INT8_C(  90), -INT8_C(  53), -INT8_C(   2), -INT8_C(  35),  INT8_C( 118),
+        -INT8_C(  96),  INT8_C( 127),  INT8_C(  23), -INT8_C(  61),  INT8_C(  18), -INT8_C(  40),  INT8_C(  55), -INT8_C(  19),
+        -INT8_C( 104),  INT8_C( 125), -INT8_C(  85),  INT8_C(  90), -INT8_C(  82),  INT8_C( 125), -INT8_C(  27),  INT8_C(  66),
+        -INT8_C(  36), -INT8_C( 111),  INT8_C( 104),  INT8_C(  86),  INT8_C(  12), -INT8_C(   4),  INT8_C(  19),  INT8_C(  93) },
+      {  INT8_C(  29),  INT8_C(   0),  INT8_C(  65),  INT8_C(   0), -INT8_C( 122),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C( 110),  INT8_C(   0),  INT8_C(   0), -INT8_C( 104),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  13),  INT8_C(  62),  INT8_C(   0),  INT8_C(   0), -INT8_C(  71),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  62),  INT8_C(  31),  INT8_C(   0),  INT8_C(   0),  INT8_C(  96),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(1744770816),
+      {  INT8_C(  46), -INT8_C(   4), -INT8_C(  99),  INT8_C(  26), -INT8_C(  24),  INT8_C( 101), -INT8_C( 101),  INT8_C(  54),
+         INT8_C(  36),      INT8_MIN,  INT8_C(   9),  INT8_C(  85), -INT8_C(  29),  INT8_C(  94), -INT8_C(  64), -INT8_C(  15),
+         INT8_C(  50), -INT8_C(   4),  INT8_C(  77), -INT8_C( 127), -INT8_C(  92), -INT8_C(  49), -INT8_C(  76), -INT8_C( 103),
+         INT8_C( 122),  INT8_C( 126), -INT8_C(   2), -INT8_C(  37),  INT8_C(  72),  INT8_C(  36),  INT8_C(   8),  INT8_C( 120) },
+      {  INT8_C(  47),  INT8_C(  53),  INT8_C(  41),  INT8_C(  39), -INT8_C(  63), -INT8_C( 120),  INT8_C( 125),  INT8_C(  89),
+         INT8_C(  51), -INT8_C(  55), -INT8_C( 122), -INT8_C(  65), -INT8_C(  36), -INT8_C(   5),  INT8_C(  98), -INT8_C(  30),
+        -INT8_C(  69), -INT8_C(  98), -INT8_C(  77),  INT8_C(  32),  INT8_C( 124), -INT8_C(  38),  INT8_C( 119), -INT8_C(  85),
+        -INT8_C(  50), -INT8_C(  83),  INT8_C( 106),  INT8_C(  14), -INT8_C( 122), -INT8_C( 125),  INT8_C( 100), -INT8_C(  30) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  36),      INT8_MIN,  INT8_C(   9),  INT8_C(   0), -INT8_C(  29),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  50), -INT8_C(   4),  INT8_C(  77), -INT8_C( 127), -INT8_C(  92), -INT8_C(  49), -INT8_C(  76), -INT8_C( 103),
+         INT8_C( 122),  INT8_C( 126), -INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(  36),  INT8_C(   8),  INT8_C(   0) } },
+    { UINT32_C( 408958378),
+      {  INT8_C(  65), -INT8_C(  65), -INT8_C( 118),  INT8_C( 127),  INT8_C(  45),  INT8_C(  61), -INT8_C(  93),  INT8_C(   4),
+         INT8_C(  10), -INT8_C(  84),  INT8_C( 103), -INT8_C(  41),  INT8_C(  48), -INT8_C(  70), -INT8_C( 103),  INT8_C( 112),
+         INT8_C(  68),  INT8_C( 100), -INT8_C(  12), -INT8_C( 127),  INT8_C(  42), -INT8_C(  30),  INT8_C(  15), -INT8_C( 121),
+        -INT8_C(  48), -INT8_C(  51), -INT8_C(   8),  INT8_C( 107), -INT8_C(  79),  INT8_C(  96), -INT8_C( 114), -INT8_C(  67) },
+      {  INT8_C(  99),  INT8_C(  97),  INT8_C(  75),  INT8_C(  39),  INT8_C(  15),  INT8_C(  53), -INT8_C( 115),  INT8_C(  86),
+         INT8_C(  32),  INT8_C(  94), -INT8_C( 102), -INT8_C(  43), -INT8_C(  98), -INT8_C( 123),  INT8_C(  78),  INT8_C(  34),
+        -INT8_C(  80), -INT8_C(  99),  INT8_C( 116),  INT8_C(  70), -INT8_C(  68), -INT8_C(  47), -INT8_C(  70),  INT8_C(  11),
+        -INT8_C(  89), -INT8_C( 108), -INT8_C( 109),  INT8_C( 102), -INT8_C( 106), -INT8_C(  43), -INT8_C(  50),  INT8_C(  51) },
+      {  INT8_C(   0), -INT8_C(  65),  INT8_C(   0),  INT8_C( 127),  INT8_C(   0),  INT8_C(  61),  INT8_C(   0),  INT8_C(   4),
+         INT8_C(  10),  INT8_C(   0),  INT8_C( 103),  INT8_C(   0),  INT8_C(  48), -INT8_C(  70),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  30),  INT8_C(  15),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 107), -INT8_C(  79),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(3127312734),
+      { -INT8_C(  36),  INT8_C( 109), -INT8_C(  13),  INT8_C(  14),  INT8_C(  82), -INT8_C(  86), -INT8_C(  19),  INT8_C( 110),
+        -INT8_C(   2),  INT8_C(  63),  INT8_C( 105), -INT8_C(  67),  INT8_C( 100), -INT8_C(  18), -INT8_C( 103), -INT8_C(  72),
+        -INT8_C(  45), -INT8_C( 108),  INT8_C(  79), -INT8_C(   5),  INT8_C(  94), -INT8_C(  28), -INT8_C( 109),  INT8_C(  26),
+        -INT8_C(  82), -INT8_C(  77),  INT8_C(  78),  INT8_C(  42),  INT8_C(  34),  INT8_C(  70),  INT8_C(   4),  INT8_C( 118) },
+      {  INT8_C(  46), -INT8_C(  92),  INT8_C(  99),  INT8_C( 103), -INT8_C(  63),  INT8_C(  48), -INT8_C(  32), -INT8_C( 113),
+         INT8_C(  38), -INT8_C(  12),  INT8_C(  41),  INT8_C(  57),  INT8_C(  65),  INT8_C( 109), -INT8_C(  67),  INT8_C(  56),
+         INT8_C(  56), -INT8_C( 102),  INT8_C( 105),  INT8_C(  97), -INT8_C(  87),  INT8_C(  68),  INT8_C(   8), -INT8_C(  88),
+        -INT8_C(  51), -INT8_C( 106), -INT8_C(  71),  INT8_C(  64),  INT8_C(  46), -INT8_C(  80),  INT8_C(  21), -INT8_C(  81) },
+      {  INT8_C(   0),  INT8_C( 109), -INT8_C(  13),  INT8_C(  14),  INT8_C(  82),  INT8_C(   0), -INT8_C(  19),  INT8_C(   0),
+        -INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  45), -INT8_C( 108),  INT8_C(  79),  INT8_C(   0),  INT8_C(   0), -INT8_C(  28), -INT8_C( 109),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(  77),  INT8_C(   0),  INT8_C(  42),  INT8_C(  34),  INT8_C(  70),  INT8_C(   0),  INT8_C( 118) } },
+    { UINT32_C(4073960957),
+      { -INT8_C(  42), -INT8_C(  51),  INT8_C(  94),  INT8_C(  32),  INT8_C(  76),  INT8_C(  64), -INT8_C(  26), -INT8_C(  17),
+        -INT8_C(  76), -INT8_C(  79), -INT8_C(  62), -INT8_C(  69),  INT8_C(  92), -INT8_C( 116),  INT8_C(  15),  INT8_C(  55),
+         INT8_C(  93), -INT8_C(  91),  INT8_C(   6),  INT8_C(  46),  INT8_C(  32), -INT8_C( 118),  INT8_C( 109),  INT8_C(  89),
+         INT8_C( 113), -INT8_C(  37), -INT8_C(   8), -INT8_C( 121), -INT8_C( 116),  INT8_C( 127),  INT8_C(  59),  INT8_C( 115) },
+      {  INT8_C(  41), -INT8_C( 103),  INT8_C(  54), -INT8_C( 120), -INT8_C( 101), -INT8_C( 106),  INT8_C(  19), -INT8_C(  49),
+         INT8_C(  54), -INT8_C( 108), -INT8_C(   3),  INT8_C( 100), -INT8_C(  66), -INT8_C(  89),  INT8_C( 124),  INT8_C( 116),
+        -INT8_C(  36),  INT8_C(  65), -INT8_C( 103),  INT8_C(  26),  INT8_C( 116), -INT8_C( 106),  INT8_C(  97),  INT8_C(  41),
+        -INT8_C(  61), -INT8_C(  16), -INT8_C(  95),  INT8_C(  44), -INT8_C(  10), -INT8_C(  83), -INT8_C(  86),  INT8_C(  47) },
+      { -INT8_C(  42),  INT8_C(   0),  INT8_C(  94),  INT8_C(  32),  INT8_C(  76),  INT8_C(  64), -INT8_C(  26), -INT8_C(  17),
+        -INT8_C(  76),  INT8_C(   0), -INT8_C(  62),  INT8_C(   0),  INT8_C(  92), -INT8_C( 116),  INT8_C(   0),  INT8_C(  55),
+         INT8_C(  93), -INT8_C(  91),  INT8_C(   0),  INT8_C(   0),  INT8_C(  32),  INT8_C(   0),  INT8_C( 109),  INT8_C(  89),
+         INT8_C(   0), -INT8_C(  37),  INT8_C(   0),  INT8_C(   0), -INT8_C( 116),  INT8_C( 127),  INT8_C(  59),  INT8_C( 115) } },
+    { UINT32_C(2425126599),
+      { -INT8_C(   6),  INT8_C(  21),  INT8_C(  63),  INT8_C(  81), -INT8_C(  21), -INT8_C( 122),  INT8_C( 107), -INT8_C( 125),
+         INT8_C(  24), -INT8_C(  30),  INT8_C(  59), -INT8_C(  43), -INT8_C(  94),  INT8_C(  61),  INT8_C(  93), -INT8_C(  31),
+        -INT8_C( 120),  INT8_C(  99),  INT8_C(  77),  INT8_C(  73), -INT8_C(   7), -INT8_C(  40),  INT8_C(  87),  INT8_C(  43),
+         INT8_C(  87), -INT8_C(  81),  INT8_C( 116), -INT8_C(  82),  INT8_C(  83),  INT8_C( 103),  INT8_C(  27), -INT8_C(  17) },
+      { -INT8_C(  10),  INT8_C(  23),  INT8_C(  79), -INT8_C(  27),  INT8_C( 120), -INT8_C(  54),  INT8_C( 121),  INT8_C(   7),
+         INT8_C( 107),  INT8_C(  93), -INT8_C(  51),  INT8_C(  18), -INT8_C(  98), -INT8_C(  35),  INT8_C(  50), -INT8_C(  98),
+        -INT8_C(  93), -INT8_C(  32), -INT8_C(  37), -INT8_C(  94),  INT8_C(  87), -INT8_C( 115),  INT8_C(  56),  INT8_C(  82),
+        -INT8_C( 126), -INT8_C(  39),  INT8_C(  60), -INT8_C(  78),  INT8_C( 107),  INT8_C( 105), -INT8_C(  49),  INT8_C(  62) },
+      { -INT8_C(   6),  INT8_C(  21),  INT8_C(  63),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 107), -INT8_C( 125),
+         INT8_C(   0), -INT8_C(  30),  INT8_C(  59), -INT8_C(  43), -INT8_C(  94),  INT8_C(  61),  INT8_C(  93),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  77),  INT8_C(  73),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  43),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  83),  INT8_C(   0),  INT8_C(   0), -INT8_C(  17) } },
+    { UINT32_C(1302038033),
+      {  INT8_C(  93),  INT8_C(  55),  INT8_C(  87), -INT8_C(  73), -INT8_C( 106),  INT8_C(  83),  INT8_C(  49),  INT8_C(  69),
+         INT8_C(  43), -INT8_C(  57), -INT8_C(  50), -INT8_C(  91), -INT8_C( 114),  INT8_C(  69), -INT8_C(  73), -INT8_C(  78),
+         INT8_C(  29), -INT8_C(  35),  INT8_C(  62),  INT8_C(  58),  INT8_C(  94), -INT8_C(  46),  INT8_C( 111), -INT8_C(  55),
+         INT8_C( 126), -INT8_C(  44),  INT8_C(  65), -INT8_C(  99), -INT8_C( 104),  INT8_C(  23), -INT8_C(  99), -INT8_C( 104) },
+      {  INT8_C(  94), -INT8_C( 126),  INT8_C(  61), -INT8_C( 119), -INT8_C( 122),  INT8_C(  17), -INT8_C(  59),      INT8_MIN,
+        -INT8_C( 113), -INT8_C( 120),  INT8_C(  35), -INT8_C(  61), -INT8_C(  26),  INT8_C(  71), -INT8_C(  67),  INT8_C(  26),
+        -INT8_C(  56), -INT8_C(  37),  INT8_C(  28), -INT8_C(  82),  INT8_C( 125),  INT8_C(  97), -INT8_C(  97), -INT8_C(  66),
+        -INT8_C( 111),  INT8_C(  16),  INT8_C(  66), -INT8_C(  80), -INT8_C( 115),  INT8_C(  12), -INT8_C(   6), -INT8_C( 105) },
+      {  INT8_C(  93),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 106),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(  57), -INT8_C(  50),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  78),
+         INT8_C(  29), -INT8_C(  35),  INT8_C(   0),  INT8_C(  58),  INT8_C(  94),  INT8_C(   0),  INT8_C(   0), -INT8_C(  55),
+         INT8_C( 126),  INT8_C(   0),  INT8_C(  65), -INT8_C(  99),  INT8_C(   0),  INT8_C(   0), -INT8_C(  99),  INT8_C(   0) } },
+    { UINT32_C(2424871987),
+      { -INT8_C(  53), -INT8_C(  56),  INT8_C(  85),  INT8_C(  95), -INT8_C(  65),  INT8_C(  44), -INT8_C(  44),  INT8_C(  11),
+         INT8_C( 111), -INT8_C(  93), -INT8_C(  96),  INT8_C(  31),  INT8_C(  77), -INT8_C(  25), -INT8_C(  96),  INT8_C( 119),
+         INT8_C(  35), -INT8_C(  85),  INT8_C( 112), -INT8_C(  36),  INT8_C(  83), -INT8_C(  31),  INT8_C(  92), -INT8_C(  50),
+        -INT8_C(  93), -INT8_C(  42),  INT8_C(  67),  INT8_C(  41),  INT8_C( 117), -INT8_C(  27), -INT8_C(  74), -INT8_C(  49) },
+      {  INT8_C(   8),  INT8_C( 104),  INT8_C(  80),  INT8_C(  86),  INT8_C(  32), -INT8_C( 100), -INT8_C(  85),  INT8_C(   8),
+        -INT8_C(  32), -INT8_C(  39), -INT8_C( 102), -INT8_C(  15),  INT8_C(   0),  INT8_C(  24), -INT8_C(  52), -INT8_C( 111),
+         INT8_C(  10),  INT8_C(  56),  INT8_C(  60),  INT8_C(   6),  INT8_C( 112), -INT8_C( 120),  INT8_C(  39), -INT8_C(  39),
+         INT8_C(  50), -INT8_C(  50),  INT8_C(  85),  INT8_C( 107),  INT8_C(   7),  INT8_C(  13), -INT8_C( 101), -INT8_C(  10) },
+      { -INT8_C(  53), -INT8_C(  56),  INT8_C(   0),  INT8_C(   0), -INT8_C(  65),  INT8_C(  44),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0), -INT8_C(  96),  INT8_C(  31),  INT8_C(  77),  INT8_C(   0),  INT8_C(   0),  INT8_C( 119),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  36),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  50),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 117),  INT8_C(   0),  INT8_C(   0), -INT8_C(  49) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi8(test_vec[i].b);
+    simde__m256i r = simde_mm256_maskz_alignr_epi8(test_vec[i].k, a, b, INT32_C( 16));
+    simde_test_x86_assert_equal_i8x32(r, simde_x_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_alignr_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[64];
+    const int8_t b[64];
+    const int8_t r[64];
+  } test_vec[] = {
+    { {  INT8_C( 126),  INT8_C(  24), -INT8_C(  58),  INT8_C(  51),  INT8_C(  41), -INT8_C(  81), -INT8_C(  34), -INT8_C(  29),
+        -INT8_C( 114),  INT8_C( 105), -INT8_C(  53),  INT8_C( 120), -INT8_C(  54),  INT8_C(  53),  INT8_C(  67), -INT8_C(  61),
+         INT8_C(  18), -INT8_C(  62),  INT8_C(  73), -INT8_C(  51), -INT8_C(  56),  INT8_C(  49),  INT8_C(   7), -INT8_C(  95),
+         INT8_C(   0),  INT8_C(  22), -INT8_C( 120),  INT8_C(  51),  INT8_C(  33), -INT8_C( 127), -INT8_C(   2), -INT8_C(  53),
+         INT8_C( 100), -INT8_C(  68), -INT8_C(  25),  INT8_C(   0),  INT8_C( 100),  INT8_C(  22),  INT8_C(  30), -INT8_C(  50),
+         INT8_C(  81), -INT8_C(  95), -INT8_C(  10), -INT8_C(  49), -INT8_C(  64),  INT8_C(  97),  INT8_C( 119), -INT8_C(  97),
+         INT8_C(  78), -INT8_C(  30), -INT8_C(  57),  INT8_C(  20), -INT8_C(  24), -INT8_C(  29),  INT8_C(  24), -INT8_C(  56),
+         INT8_C(  49),  INT8_C(   9), -INT8_C(  61),  INT8_C(  66), -INT8_C(  12), -INT8_C(  95), -INT8_C(  76), -INT8_C(  79) },
+      { -INT8_C(  86), -INT8_C(  97), -INT8_C(  30), -INT8_C(  11),  INT8_C( 118), -INT8_C( 116), -INT8_C( 111), -INT8_C(  80),
+        -INT8_C(  93), -INT8_C(  58),  INT8_C(  79),  INT8_C(  23), -INT8_C(  39), -INT8_C(  38),  INT8_C( 123), -INT8_C(  57),
+         INT8_C( 118), -INT8_C(  66),  INT8_C(  73),  INT8_C( 125),  INT8_C(  37), -INT8_C(  21),  INT8_C(  24),  INT8_C(  10),
+         INT8_C(  82), -INT8_C( 108),  INT8_C(  61),  INT8_C( 121), -INT8_C(  71),  INT8_C(  54), -INT8_C(  44),  INT8_C( 121),
+         INT8_C(  61), -INT8_C(  51),  INT8_C(  62), -INT8_C(  26),  INT8_C(  95), -INT8_C(  17),  INT8_C(  98),  INT8_C(  26),
+        -INT8_C(  70),  INT8_C(  77), -INT8_C(  37),  INT8_C( 104),  INT8_C(  22), -INT8_C( 106),  INT8_C(  77), -INT8_C(  95),
+        -INT8_C(  44), -INT8_C(  79),  INT8_C(  32),  INT8_C(  98),  INT8_C(  34), -INT8_C(  76), -INT8_C( 107), -INT8_C( 126),
+        -INT8_C( 109),  INT8_C( 126),  INT8_C(  34),  INT8_C(  66),  INT8_C(  88), -INT8_C(  16), -INT8_C(  61),  INT8_C(  12) },
+      { -INT8_C(  54),  INT8_C(  53),  INT8_C(  67), -INT8_C(  61),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  33), -INT8_C( 127), -INT8_C(   2), -INT8_C(  53),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  64),  INT8_C(  97),  INT8_C( 119), -INT8_C(  97),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  12), -INT8_C(  95), -INT8_C(  76), -INT8_C(  79),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { { -INT8_C(  94),  INT8_C(  87), -INT8_C(  67),  INT8_C( 110),  INT8_C(  40),  INT8_C(  48), -INT8_C( 102),  INT8_C(  85),
+        -INT8_C(  97), -INT8_C( 116), -INT8_C( 103),  INT8_C( 104),  INT8_C( 122),  INT8_C( 112), -INT8_C(  48), -INT8_C(  41),
+         INT8_C( 116),  INT8_C(  12),  INT8_C(  76), -INT8_C( 106), -INT8_C(  61),  INT8_C(  74), -INT8_C(  76), -INT8_C(   7),
+        -INT8_C(  30),  INT8_C( 123), -INT8_C(  21),  INT8_C(  40), -INT8_C( 108), -INT8_C(  43), -INT8_C(  84), -INT8_C(  41),
+        -INT8_C(  50),  INT8_C(  43),  INT8_C(  85), -INT8_C(  93),  INT8_C( 126),  INT8_C(  78), -INT8_C(  22), -INT8_C(  55),
+         INT8_C( 102), -INT8_C(  46), -INT8_C(  17),  INT8_C(  98),  INT8_C( 102), -INT8_C( 114),  INT8_C(  43), -INT8_C(  71),
+         INT8_C(   6), -INT8_C( 116),  INT8_C(  91),  INT8_C( 119),  INT8_C(  81),  INT8_C(  29), -INT8_C(  19),  INT8_C(  44),
+        -INT8_C(  56),  INT8_C( 123),  INT8_C( 127), -INT8_C(  75),  INT8_C(  10), -INT8_C(   4), -INT8_C(  25), -INT8_C(  56) },
+      {  INT8_C(  39),  INT8_C(  11),  INT8_C(  73),  INT8_C(  39), -INT8_C( 127), -INT8_C( 116),  INT8_C( 113), -INT8_C(  29),
+        -INT8_C(  92), -INT8_C(  23),  INT8_C( 126),  INT8_C(  94), -INT8_C( 110), -INT8_C( 125),  INT8_C(  68), -INT8_C(  30),
+         INT8_C(  53),  INT8_C(  99), -INT8_C(  83),  INT8_C(   2),      INT8_MIN,  INT8_C(  93), -INT8_C(  71), -INT8_C(  98),
+        -INT8_C(  69), -INT8_C( 114), -INT8_C(  21),  INT8_C( 106),  INT8_C(  62),  INT8_C(  66),  INT8_C( 102),  INT8_C(  40),
+         INT8_C( 116), -INT8_C(  34), -INT8_C(  93), -INT8_C( 126), -INT8_C(  27),  INT8_C( 124), -INT8_C( 108), -INT8_C(  61),
+         INT8_C(  90), -INT8_C(  18), -INT8_C(  59), -INT8_C(  82),  INT8_C(  75), -INT8_C( 105),  INT8_C(   8),  INT8_C( 112),
+         INT8_C( 116),  INT8_C(  66),  INT8_C(  38),  INT8_C(  18),  INT8_C(  94),  INT8_C(  10), -INT8_C(  36), -INT8_C( 117),
+         INT8_C(  66),  INT8_C(  62),  INT8_C(  82),  INT8_C(  30), -INT8_C(  94), -INT8_C(  19), -INT8_C( 106),  INT8_C(  31) },
+      {  INT8_C( 122),  INT8_C( 112), -INT8_C(  48), -INT8_C(  41),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C( 108), -INT8_C(  43), -INT8_C(  84), -INT8_C(  41),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C( 102), -INT8_C( 114),  INT8_C(  43), -INT8_C(  71),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  10), -INT8_C(   4), -INT8_C(  25), -INT8_C(  56),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { {  INT8_C(  33),  INT8_C(  29),  INT8_C( 111), -INT8_C(   3), -INT8_C(  92), -INT8_C(  47), -INT8_C(  86),  INT8_C(   1),
+         INT8_C( 125),  INT8_C( 119),  INT8_C( 111),  INT8_C(  19),  INT8_C( 117), -INT8_C( 107),  INT8_C(  52),  INT8_C(  48),
+        -INT8_C(  38), -INT8_C(  13), -INT8_C( 102), -INT8_C( 121), -INT8_C( 110),  INT8_C( 127),  INT8_C(  23),  INT8_C(  67),
+        -INT8_C( 117),  INT8_C(  74), -INT8_C( 118),  INT8_C(  15),  INT8_C(  23),  INT8_C(  21),  INT8_C( 117), -INT8_C(  47),
+         INT8_C(  58), -INT8_C(  40), -INT8_C(  59),  INT8_C(  38), -INT8_C( 124),  INT8_C(  73), -INT8_C(  97), -INT8_C(  26),
+         INT8_C(  35),  INT8_C( 109),  INT8_C(  89), -INT8_C(  75),  INT8_C( 126), -INT8_C(  12),  INT8_C(  29),  INT8_C(  51),
+         INT8_C( 107),  INT8_C( 119), -INT8_C(  35),  INT8_C( 120),  INT8_C(  72), -INT8_C(  44), -INT8_C(  87),  INT8_C(  52),
+         INT8_C(   6),  INT8_C( 122),  INT8_C(  10),  INT8_C(  46), -INT8_C(  36), -INT8_C(  47),  INT8_C(  48),  INT8_C(  58) },
+      { -INT8_C(  36),  INT8_C(  85), -INT8_C( 127), -INT8_C(  52),  INT8_C(  15), -INT8_C(  43), -INT8_C(  40),  INT8_C(  55),
+         INT8_C(  29),  INT8_C(  91), -INT8_C(  13), -INT8_C(  68),  INT8_C(  15), -INT8_C(  25), -INT8_C(  28),  INT8_C(  35),
+        -INT8_C(  29),  INT8_C(  26),  INT8_C(   0),  INT8_C(  44), -INT8_C(  24), -INT8_C( 109), -INT8_C(  54), -INT8_C( 117),
+             INT8_MIN, -INT8_C(  11), -INT8_C(  44), -INT8_C(   9),  INT8_C( 106),  INT8_C(  58), -INT8_C(  18),  INT8_C(  77),
+        -INT8_C( 107),  INT8_C(  24), -INT8_C( 100), -INT8_C(  89), -INT8_C(  80),  INT8_C(  31), -INT8_C(  65), -INT8_C(  48),
+         INT8_C(  11), -INT8_C(  55),  INT8_C( 122),  INT8_C(  70), -INT8_C(  48), -INT8_C(   7), -INT8_C(  10), -INT8_C(  93),
+        -INT8_C(  44),  INT8_C( 109),  INT8_C(  93),  INT8_C( 121),  INT8_C(  37), -INT8_C(  17),  INT8_C(  18), -INT8_C(  26),
+        -INT8_C(   1), -INT8_C(  18),  INT8_C(  33),  INT8_C(  25),  INT8_C(   7),  INT8_C(  31),  INT8_C(  27),  INT8_C(  65) },
+      {  INT8_C( 117), -INT8_C( 107),  INT8_C(  52),  INT8_C(  48),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  23),  INT8_C(  21),  INT8_C( 117), -INT8_C(  47),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C( 126), -INT8_C(  12),  INT8_C(  29),  INT8_C(  51),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  36), -INT8_C(  47),  INT8_C(  48),  INT8_C(  58),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { {  INT8_C(   4),  INT8_C(  90), -INT8_C(  66),  INT8_C(  45),  INT8_C(  33),  INT8_C(   7), -INT8_C(  11),  INT8_C(  46),
+         INT8_C(  80),  INT8_C(  96), -INT8_C(  40), -INT8_C(  67),  INT8_C( 106),  INT8_C(   2), -INT8_C(  56), -INT8_C(  65),
+         INT8_C(  94),  INT8_C(  38),  INT8_C(  36),  INT8_C(   8),  INT8_C(  40), -INT8_C(  18),  INT8_C(  29), -INT8_C(  39),
+        -INT8_C(  36), -INT8_C(  97), -INT8_C(  78), -INT8_C(  57),  INT8_C( 112), -INT8_C(  14),  INT8_C(  51), -INT8_C(  97),
+        -INT8_C(  82),  INT8_C(  51), -INT8_C( 121),  INT8_C(  86),  INT8_C(  64),  INT8_C(  54),  INT8_C(  14),  INT8_C(  16),
+         INT8_C( 100), -INT8_C( 116), -INT8_C(  55), -INT8_C( 104),  INT8_C(   1), -INT8_C(   9), -INT8_C(  80), -INT8_C(  97),
+        -INT8_C(  84), -INT8_C( 107), -INT8_C(  92),  INT8_C(  49),  INT8_C(  73), -INT8_C(  21),  INT8_C(  36),  INT8_C(  98),
+        -INT8_C(  36),  INT8_C(  17), -INT8_C(  63),  INT8_C(  30), -INT8_C(  78), -INT8_C(  79), -INT8_C(  44),  INT8_C(  93) },
+      {  INT8_C(   5), -INT8_C(  63),  INT8_C( 108), -INT8_C(  98), -INT8_C(  25),  INT8_C( 126), -INT8_C(  80), -INT8_C(  55),
+         INT8_C( 120), -INT8_C(  26), -INT8_C(   7),  INT8_C(   4), -INT8_C( 100), -INT8_C(  23), -INT8_C( 110), -INT8_C( 103),
+         INT8_C(  12),  INT8_C(  94),  INT8_C(  98), -INT8_C(  60), -INT8_C(  25),  INT8_C( 116),  INT8_C(  58),  INT8_C(   8),
+        -INT8_C( 114),  INT8_C(  35), -INT8_C( 105), -INT8_C(  36),  INT8_C( 115),  INT8_C(  87),  INT8_C(  37),  INT8_C(  11),
+        -INT8_C(  45),  INT8_C( 112), -INT8_C(  78), -INT8_C(   7), -INT8_C(  22), -INT8_C(  75), -INT8_C(  72),  INT8_C(  21),
+         INT8_C( 111), -INT8_C(  97), -INT8_C(  14), -INT8_C(  63),  INT8_C( 102), -INT8_C(   2), -INT8_C( 107),  INT8_C(  90),
+         INT8_C( 112), -INT8_C(  14), -INT8_C(   1), -INT8_C(  40),  INT8_C(  15), -INT8_C( 109),  INT8_C(  52),  INT8_C(  56),
+        -INT8_C(  96), -INT8_C( 109),  INT8_C(  40),  INT8_C(  90), -INT8_C(  30),  INT8_C(  25),  INT8_C(  15), -INT8_C(  21) },
+      {  INT8_C( 106),  INT8_C(   2), -INT8_C(  56), -INT8_C(  65),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C( 112), -INT8_C(  14),  INT8_C(  51), -INT8_C(  97),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   1), -INT8_C(   9), -INT8_C(  80), -INT8_C(  97),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  78), -INT8_C(  79), -INT8_C(  44),  INT8_C(  93),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { {  INT8_C(  21),  INT8_C(  67),  INT8_C(  63), -INT8_C(  87),  INT8_C(  64),  INT8_C(  82), -INT8_C(  44),  INT8_C( 119),
+         INT8_C(  33),  INT8_C(  43), -INT8_C(  87),  INT8_C(  22), -INT8_C(  78),  INT8_C(  77), -INT8_C( 113), -INT8_C(  96),
+         INT8_C(   1), -INT8_C( 127),  INT8_C(  12),  INT8_C(  98), -INT8_C( 124), -INT8_C(  97), -INT8_C(  30),  INT8_C(  85),
+         INT8_C(  55), -INT8_C( 121),  INT8_C(  74), -INT8_C(  44), -INT8_C(  45),  INT8_C(  72), -INT8_C(  98),  INT8_C(   1),
+         INT8_C( 103), -INT8_C(  83),  INT8_C(  36),  INT8_C(  10), -INT8_C(  18),  INT8_C(  25),  INT8_C(  65), -INT8_C(   3),
+         INT8_C( 114), -INT8_C(  36),  INT8_C( 119), -INT8_C(  33), -INT8_C(   6),  INT8_C(  19), -INT8_C(  91),  INT8_C(  42),
+        -INT8_C( 122),  INT8_C(  91),  INT8_C(  17),  INT8_C( 107),  INT8_C(  57),  INT8_C(  97), -INT8_C(  65), -INT8_C(  56),
+        -INT8_C(  27), -INT8_C(  30),  INT8_C(  11),  INT8_C(   9), -INT8_C(  33), -INT8_C( 104), -INT8_C(  39),  INT8_C(   0) },
+      {  INT8_C(  56),  INT8_C(  62),  INT8_C(  28), -INT8_C(  92), -INT8_C(  53),  INT8_C(  78),  INT8_C(  54),  INT8_C(  92),
+        -INT8_C(  84), -INT8_C(  11), -INT8_C(   4), -INT8_C( 111), -INT8_C(  42), -INT8_C(   9),  INT8_C(  18), -INT8_C(  56),
+         INT8_C(  63),  INT8_C(  95),  INT8_C(  41),  INT8_C(  87), -INT8_C(  71),  INT8_C(  98), -INT8_C(  90), -INT8_C(  87),
+        -INT8_C( 122),  INT8_C(  49), -INT8_C( 107), -INT8_C(  66), -INT8_C( 117),  INT8_C(  84),  INT8_C(  26),  INT8_C( 120),
+        -INT8_C(  78), -INT8_C(  17), -INT8_C(  30), -INT8_C( 119),  INT8_C(  50),  INT8_C(  90),  INT8_C(  58),  INT8_C(  80),
+        -INT8_C( 100), -INT8_C(  73), -INT8_C(  32), -INT8_C(   7), -INT8_C(  88), -INT8_C(  65),  INT8_C( 108),  INT8_C( 108),
+         INT8_C( 126), -INT8_C(  36), -INT8_C( 123), -INT8_C(  74), -INT8_C(  85),  INT8_C(  40),  INT8_C(  38),  INT8_C(  18),
+         INT8_C(  66),  INT8_C( 100), -INT8_C(  62), -INT8_C( 101),  INT8_C( 124), -INT8_C( 104), -INT8_C(  97), -INT8_C(  38) },
+      { -INT8_C(  78),  INT8_C(  77), -INT8_C( 113), -INT8_C(  96),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  45),  INT8_C(  72), -INT8_C(  98),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(   6),  INT8_C(  19), -INT8_C(  91),  INT8_C(  42),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  33), -INT8_C( 104), -INT8_C(  39),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { {  INT8_C(  12), -INT8_C(  82),  INT8_C( 121),  INT8_C(  65),  INT8_C(  47), -INT8_C( 127),  INT8_C(  12), -INT8_C( 120),
+         INT8_C(  97), -INT8_C( 117),  INT8_C(   8),  INT8_C(  58), -INT8_C(  92), -INT8_C(  81),  INT8_C(  78),  INT8_C(   4),
+        -INT8_C(  14),  INT8_C(  17),  INT8_C(  27),  INT8_C(  21),  INT8_C(  77), -INT8_C(  23), -INT8_C( 112),  INT8_C(  27),
+         INT8_C(  17),  INT8_C(  63), -INT8_C(  33), -INT8_C(  94),  INT8_C(  45),  INT8_C( 105), -INT8_C( 107),  INT8_C(  12),
+         INT8_C(  74), -INT8_C(  72), -INT8_C(  79), -INT8_C(  80),  INT8_C(  43),  INT8_C(  11),  INT8_C(  73),  INT8_C( 117),
+        -INT8_C(  69), -INT8_C( 122),  INT8_C(  67),  INT8_C( 111),  INT8_C(  63),  INT8_C(  31),  INT8_C(  13), -INT8_C(   5),
+        -INT8_C(  40), -INT8_C(  37), -INT8_C( 118), -INT8_C(  21), -INT8_C(  30), -INT8_C(  13),  INT8_C( 116), -INT8_C(  52),
+         INT8_C(  55),  INT8_C(  65),  INT8_C( 125),  INT8_C(  63), -INT8_C(  17), -INT8_C(  36), -INT8_C(  53),  INT8_C(   6) },
+      { -INT8_C(  88),  INT8_C(  11), -INT8_C(   9), -INT8_C( 108), -INT8_C(  59),  INT8_C(   4),  INT8_C(  62), -INT8_C( 110),
+        -INT8_C(  89), -INT8_C(  30),  INT8_C(  71),  INT8_C(  27),  INT8_C(  95), -INT8_C(  51), -INT8_C( 110),  INT8_C(  23),
+        -INT8_C(  83), -INT8_C(  64),  INT8_C(  65),  INT8_C(  97),  INT8_C(  93),  INT8_C(   5), -INT8_C(  25),  INT8_C( 100),
+         INT8_C(  56),  INT8_C(  54), -INT8_C(  54), -INT8_C(  57),      INT8_MIN,  INT8_C(  55), -INT8_C(   7), -INT8_C( 102),
+         INT8_C(  41),  INT8_C(  99), -INT8_C(  21), -INT8_C(   2), -INT8_C(  85), -INT8_C( 124),  INT8_C( 111),  INT8_C(  89),
+         INT8_C( 101),  INT8_C( 111), -INT8_C(   9), -INT8_C(  64),  INT8_C(  79),  INT8_C(  11),  INT8_C(  79), -INT8_C(  77),
+        -INT8_C( 102), -INT8_C(  69), -INT8_C(  16), -INT8_C(   7), -INT8_C( 124), -INT8_C(  75), -INT8_C(  52), -INT8_C( 103),
+        -INT8_C( 102), -INT8_C(  33),  INT8_C(  56),  INT8_C(  44), -INT8_C(  18),  INT8_C( 113),  INT8_C(  55), -INT8_C(  25) },
+      { -INT8_C(  92), -INT8_C(  81),  INT8_C(  78),  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  45),  INT8_C( 105), -INT8_C( 107),  INT8_C(  12),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  63),  INT8_C(  31),  INT8_C(  13), -INT8_C(   5),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  17), -INT8_C(  36), -INT8_C(  53),  INT8_C(   6),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { {  INT8_C(  69), -INT8_C(  25),  INT8_C(  24), -INT8_C( 124), -INT8_C(  77), -INT8_C(  52), -INT8_C(  21), -INT8_C( 114),
+        -INT8_C(  13), -INT8_C(  66),  INT8_C(  27), -INT8_C( 123),  INT8_C(  26),  INT8_C(   6),  INT8_C(  76), -INT8_C(  52),
+        -INT8_C(  97), -INT8_C(  46), -INT8_C(  79),  INT8_C(  48),  INT8_C( 122),  INT8_C(  28),  INT8_C(  74),  INT8_C( 110),
+         INT8_C( 108),  INT8_C( 112),  INT8_C(  88), -INT8_C(   6),  INT8_C(  75),  INT8_C(  13), -INT8_C(  27), -INT8_C(  14),
+        -INT8_C(  91),  INT8_C( 122), -INT8_C(  20),  INT8_C(  87),  INT8_C(  69), -INT8_C(  43),  INT8_C(  64),  INT8_C(  10),
+         INT8_C(  42), -INT8_C(  82),  INT8_C(  95),  INT8_C(  73),  INT8_C( 125), -INT8_C(  31),  INT8_C(  84), -INT8_C(  22),
+        -INT8_C( 123),  INT8_C( 116),  INT8_C(  30),  INT8_C( 106),  INT8_C( 124),  INT8_C(  40), -INT8_C(  58), -INT8_C(  23),
+        -INT8_C(   6),  INT8_C(  29), -INT8_C(  17), -INT8_C( 118),  INT8_C(  69), -INT8_C(   3),  INT8_C(  10),  INT8_C(  90) },
+      {  INT8_C(  10),  INT8_C(  96), -INT8_C(  30), -INT8_C(  85), -INT8_C(  40), -INT8_C(  87),  INT8_C(  38),  INT8_C(  32),
+        -INT8_C(  56), -INT8_C(  35),  INT8_C(  34),  INT8_C(  40),  INT8_C(  24),  INT8_C(   6), -INT8_C(  34),  INT8_C( 109),
+         INT8_C( 121),  INT8_C(  35),  INT8_C(  53),  INT8_C(  85), -INT8_C(  41), -INT8_C(  56), -INT8_C(  53), -INT8_C(  32),
+         INT8_C(  39), -INT8_C( 113),  INT8_C(  42), -INT8_C(  64), -INT8_C(  37),  INT8_C(  44),  INT8_C(  22), -INT8_C(  68),
+         INT8_C(  83), -INT8_C(  71),  INT8_C(  64),  INT8_C(  46),  INT8_C(  56), -INT8_C(  90), -INT8_C(  97),  INT8_C( 110),
+        -INT8_C(  52),  INT8_C(  85), -INT8_C(  11),  INT8_C(  30), -INT8_C(  90),  INT8_C(  69),  INT8_C(  13), -INT8_C(  85),
+        -INT8_C( 112), -INT8_C(  35), -INT8_C(  32),  INT8_C(  29), -INT8_C(  31), -INT8_C(   6),  INT8_C(  77),  INT8_C(  53),
+         INT8_C(  99),  INT8_C(  63), -INT8_C(  45), -INT8_C(  58), -INT8_C(  73), -INT8_C( 114), -INT8_C(  45), -INT8_C(  72) },
+      {  INT8_C(  26),  INT8_C(   6),  INT8_C(  76), -INT8_C(  52),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  75),  INT8_C(  13), -INT8_C(  27), -INT8_C(  14),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C( 125), -INT8_C(  31),  INT8_C(  84), -INT8_C(  22),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  69), -INT8_C(   3),  INT8_C(  10),  INT8_C(  90),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { { -INT8_C(  65), -INT8_C(  50),  INT8_C(  61), -INT8_C(  41),  INT8_C( 104), -INT8_C(  12),  INT8_C(  37),  INT8_C(  55),
+         INT8_C(  35), -INT8_C(  35),  INT8_C( 114),  INT8_C(  40),  INT8_C(  54),  INT8_C( 112), -INT8_C(  40), -INT8_C( 115),
+         INT8_C(  20),  INT8_C(  26), -INT8_C(  50),  INT8_C(  25), -INT8_C( 125), -INT8_C(  94),  INT8_C(  83),  INT8_C(   3),
+         INT8_C( 121), -INT8_C( 123),  INT8_C(  28),  INT8_C(  18), -INT8_C(  24),  INT8_C(  79),  INT8_C(  31),  INT8_C(   7),
+        -INT8_C(  67),  INT8_C(  82), -INT8_C(  54),  INT8_C(  37),  INT8_C(  55), -INT8_C(  45),  INT8_C(  30),  INT8_C(  62),
+         INT8_C( 114),  INT8_C(  78),  INT8_C( 106), -INT8_C( 100), -INT8_C(  81),  INT8_C(  70), -INT8_C(  86), -INT8_C( 103),
+        -INT8_C( 100),  INT8_C(  65), -INT8_C(  61),  INT8_C(  14),  INT8_C( 118), -INT8_C(  34),  INT8_C( 101), -INT8_C(  77),
+         INT8_C(  76),  INT8_C(  14),  INT8_C(  56), -INT8_C(  46),  INT8_C(   7),  INT8_C(  45), -INT8_C(  31), -INT8_C(  38) },
+      { -INT8_C(  55),  INT8_C(  80), -INT8_C(  70), -INT8_C( 125),  INT8_C(  14), -INT8_C(  44),  INT8_C(  39),  INT8_C(  67),
+         INT8_C(   5),  INT8_C(   3), -INT8_C(  45),  INT8_C(  12), -INT8_C(  38), -INT8_C(  51), -INT8_C(  72),  INT8_C( 105),
+         INT8_C(  25),  INT8_C(  85), -INT8_C(  49), -INT8_C(  18),  INT8_C(  53),  INT8_C(  59), -INT8_C(  33), -INT8_C(  28),
+         INT8_C(  33),  INT8_C(  39),  INT8_C(  37), -INT8_C(  89), -INT8_C( 100),  INT8_C(  19),  INT8_C(  39), -INT8_C( 113),
+        -INT8_C(   6),  INT8_C(  89),  INT8_C(  97), -INT8_C(  73),  INT8_C(  34),  INT8_C(  32), -INT8_C(  28),  INT8_C(  91),
+         INT8_C(  19),  INT8_C(  87),  INT8_C(  35),  INT8_C( 119),  INT8_C(   1),  INT8_C(  81), -INT8_C(  25),  INT8_C(  78),
+         INT8_C(  78), -INT8_C( 120),  INT8_C(  11),  INT8_C(  47),  INT8_C(  37), -INT8_C(  19), -INT8_C(  86),  INT8_C(  17),
+         INT8_C(  15),  INT8_C(  17),  INT8_C( 119),  INT8_C(  27), -INT8_C(  63),  INT8_C(  82), -INT8_C(  10),  INT8_C(  51) },
+      {  INT8_C(  54),  INT8_C( 112), -INT8_C(  40), -INT8_C( 115),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  24),  INT8_C(  79),  INT8_C(  31),  INT8_C(   7),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  81),  INT8_C(  70), -INT8_C(  86), -INT8_C( 103),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   7),  INT8_C(  45), -INT8_C(  31), -INT8_C(  38),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi8(test_vec[i].b);
+    simde__m512i r = simde_mm512_alignr_epi8(a, b, INT32_C( 28));
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_alignr_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[64];
+    const simde__mmask64 k;
+    const int8_t a[64];
+    const int8_t b[64];
+    const int8_t r[64];
+  } test_vec[] = {
+    { { -INT8_C( 106),  INT8_C(  91),  INT8_C(  55),  INT8_C( 111), -INT8_C(  15), -INT8_C(  22),  INT8_C(  47),  INT8_C(  73),
+        -INT8_C(  45), -INT8_C(  84),  INT8_C(  31),  INT8_C(   7),  INT8_C(  57), -INT8_C(  63), -INT8_C(  38), -INT8_C(  93),
+         INT8_C(  12), -INT8_C( 102),  INT8_C(  95), -INT8_C(  23),  INT8_C(  64),  INT8_C(  14),  INT8_C( 118), -INT8_C(  72),
+         INT8_C(  43), -INT8_C(   9),  INT8_C( 120), -INT8_C(  24), -INT8_C(  77),  INT8_C(  88), -INT8_C(  48),  INT8_C(  25),
+        -INT8_C( 121),  INT8_C(  48), -INT8_C( 104),  INT8_C( 125), -INT8_C(  27),  INT8_C(  54),  INT8_C( 124), -INT8_C(   4),
+        -INT8_C( 103), -INT8_C( 104),  INT8_C(  23), -INT8_C( 115),  INT8_C( 110),  INT8_C(  38), -INT8_C(   6),  INT8_C(  91),
+         INT8_C( 123), -INT8_C(  53),  INT8_C(  84),  INT8_C( 112),  INT8_C(  76),  INT8_C(  36), -INT8_C(  46),  INT8_C(  31),
+         INT8_C(  81), -INT8_C(  27),  INT8_C( 102),  INT8_C(  24), -INT8_C(  48),  INT8_C(  69),  INT8_C(  95), -INT8_C(   1) },
+      UINT64_C( 3880127992941305071),
+      { -INT8_C(  50), -INT8_C(  81), -INT8_C( 114),  INT8_C(  49), -INT8_C(  51), -INT8_C(  80), -INT8_C(  57), -INT8_C(  26),
+         INT8_C(  11), -INT8_C( 125), -INT8_C(  16),  INT8_C(  27), -INT8_C( 105),  INT8_C(  48), -INT8_C(  36), -INT8_C(  37),
+         INT8_C( 108),  INT8_C(  16),  INT8_C(   8), -INT8_C(  28),  INT8_C(  31), -INT8_C(  13), -INT8_C(  32),  INT8_C(  43),
+         INT8_C(  69),  INT8_C( 105),  INT8_C(  27),  INT8_C(  71), -INT8_C(  79), -INT8_C( 106), -INT8_C(  71),  INT8_C(  74),
+        -INT8_C(  22), -INT8_C(  41),  INT8_C(  54), -INT8_C(  28), -INT8_C(  43),  INT8_C(  88),  INT8_C( 126),  INT8_C(  38),
+         INT8_C(  56),  INT8_C(  96),  INT8_C(  22), -INT8_C(  36), -INT8_C(  21),  INT8_C(  44), -INT8_C(  84),  INT8_C(  69),
+        -INT8_C(  13),  INT8_C(  82),  INT8_C(  26),  INT8_C(   8), -INT8_C(   6),  INT8_C(  73), -INT8_C(  63),  INT8_C(  92),
+         INT8_C(  10),  INT8_C( 116), -INT8_C(  58), -INT8_C(  91), -INT8_C( 124),  INT8_C(   3),  INT8_C(  39),  INT8_C(  79) },
+      {  INT8_C(  83), -INT8_C( 115),  INT8_C(  68),  INT8_C(  94),  INT8_C(  88), -INT8_C(  98),  INT8_C(  61),  INT8_C( 115),
+        -INT8_C( 119),  INT8_C(  86),  INT8_C(  34), -INT8_C(  14),  INT8_C(  39), -INT8_C(  73), -INT8_C(  76), -INT8_C(  55),
+        -INT8_C(  26), -INT8_C(  97),  INT8_C(  84), -INT8_C(  46),  INT8_C(  13), -INT8_C(  37), -INT8_C(  84), -INT8_C( 103),
+         INT8_C(  42), -INT8_C(  66), -INT8_C(  99), -INT8_C( 112), -INT8_C(  65), -INT8_C( 126), -INT8_C( 107),  INT8_C(  28),
+        -INT8_C(  80), -INT8_C(  51), -INT8_C(  94), -INT8_C( 113),  INT8_C(  38),  INT8_C(  20),  INT8_C(  70),  INT8_C(  20),
+        -INT8_C(  48), -INT8_C( 105), -INT8_C(  16),  INT8_C(  75), -INT8_C( 117), -INT8_C(  76), -INT8_C(  55), -INT8_C(  16),
+        -INT8_C( 117),  INT8_C(  78), -INT8_C(  12),  INT8_C(  31),  INT8_C(   5), -INT8_C(  97), -INT8_C(  36),  INT8_C( 111),
+         INT8_C(  17), -INT8_C( 127), -INT8_C(  64),  INT8_C(  43), -INT8_C(  25),  INT8_C(  44),  INT8_C(  44),  INT8_C(   2) },
+      {  INT8_C(  48), -INT8_C(  36), -INT8_C(  37),  INT8_C(   0), -INT8_C(  15),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  45), -INT8_C(  84),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  63),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  12), -INT8_C( 102),  INT8_C(  95), -INT8_C(  23),  INT8_C(   0),  INT8_C(  14),  INT8_C(   0), -INT8_C(  72),
+         INT8_C(  43),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  77),  INT8_C(  88), -INT8_C(  48),  INT8_C(  25),
+        -INT8_C( 121), -INT8_C(  84), -INT8_C( 104),  INT8_C(   0),  INT8_C(   0),  INT8_C(  54),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  23),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C( 123), -INT8_C(  53),  INT8_C(  84),  INT8_C(   0),  INT8_C(   0),  INT8_C(  36),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(  27),  INT8_C(   0),  INT8_C(  24),  INT8_C(   0),  INT8_C(   0),  INT8_C(  95), -INT8_C(   1) } },
+    { { -INT8_C(  26),  INT8_C(   9), -INT8_C(  91), -INT8_C( 106), -INT8_C( 109), -INT8_C(   8), -INT8_C(  29), -INT8_C(  94),
+        -INT8_C(  13), -INT8_C(  52),  INT8_C(  99), -INT8_C( 115),  INT8_C(   6),  INT8_C( 126), -INT8_C(   6),  INT8_C(  19),
+         INT8_C( 115), -INT8_C(  35),  INT8_C(  82),  INT8_C(  66), -INT8_C(  68),  INT8_C(  81), -INT8_C(  87), -INT8_C( 120),
+         INT8_C(  27), -INT8_C(   1),  INT8_C(  70),  INT8_C(  86), -INT8_C(  48), -INT8_C(  47),  INT8_C(  48),  INT8_C( 102),
+         INT8_C(  58),  INT8_C( 120), -INT8_C(  66),  INT8_C(  49), -INT8_C(  61),  INT8_C( 108),  INT8_C(  48),  INT8_C(  36),
+        -INT8_C(  86), -INT8_C( 121), -INT8_C(  66), -INT8_C(  79),  INT8_C(  44), -INT8_C( 122), -INT8_C(  15),  INT8_C( 100),
+        -INT8_C(  98), -INT8_C(  11), -INT8_C(  70), -INT8_C(  47), -INT8_C(  98),  INT8_C( 117), -INT8_C(  87), -INT8_C( 126),
+         INT8_C(  65),  INT8_C(  79), -INT8_C( 115), -INT8_C(  36),  INT8_C(  53),  INT8_C(   7), -INT8_C(   9),  INT8_C( 102) },
+      UINT64_C( 8087389479078050261),
+      { -INT8_C( 102), -INT8_C(  23),  INT8_C(  24),  INT8_C(  68), -INT8_C(  88),  INT8_C(  63),  INT8_C(  29), -INT8_C( 123),
+        -INT8_C(  38), -INT8_C(  75),  INT8_C(  56),  INT8_C(  78),  INT8_C(  34),  INT8_C(  42),  INT8_C(  14), -INT8_C(  52),
+         INT8_C( 113), -INT8_C(  23), -INT8_C(  42), -INT8_C( 115),  INT8_C(  20),  INT8_C(  56), -INT8_C(  18),  INT8_C(  67),
+         INT8_C(  53), -INT8_C(   7),  INT8_C(  18),  INT8_C( 122), -INT8_C(  10),  INT8_C(  79),  INT8_C(  51),  INT8_C(  25),
+         INT8_C(  49), -INT8_C(  85),  INT8_C( 106),  INT8_C(  88),  INT8_C(  46),  INT8_C(  82), -INT8_C(  26), -INT8_C(  75),
+        -INT8_C(  88),  INT8_C(  89), -INT8_C(  55), -INT8_C(  62), -INT8_C(  43), -INT8_C(  46), -INT8_C(  29),  INT8_C(  36),
+         INT8_C(  86),  INT8_C(  72),  INT8_C(  18), -INT8_C(  90),  INT8_C(   7), -INT8_C( 127), -INT8_C(  92), -INT8_C(  83),
+        -INT8_C(  14), -INT8_C(  83), -INT8_C(  98), -INT8_C(  69), -INT8_C(  36),  INT8_C( 127), -INT8_C( 107),  INT8_C(  18) },
+      { -INT8_C( 112),  INT8_C( 103),  INT8_C(  89), -INT8_C(   5), -INT8_C(  18),  INT8_C(  41),  INT8_C(  21),  INT8_C(  83),
+        -INT8_C(  11), -INT8_C(  46), -INT8_C(  45),  INT8_C(  44), -INT8_C(  26), -INT8_C( 107),  INT8_C(  22), -INT8_C(  50),
+         INT8_C( 111),  INT8_C(  29), -INT8_C( 105),  INT8_C(  62),  INT8_C( 124), -INT8_C( 116),  INT8_C(  59), -INT8_C(  29),
+         INT8_C(  76),  INT8_C(  20),  INT8_C(  48),  INT8_C(  54), -INT8_C(  46), -INT8_C(  25),  INT8_C(  60), -INT8_C( 102),
+         INT8_C(   9),  INT8_C( 105), -INT8_C( 119),  INT8_C(  58),  INT8_C(  64), -INT8_C(  40), -INT8_C( 107), -INT8_C(  98),
+         INT8_C(  59), -INT8_C(  69), -INT8_C(  36),  INT8_C(  39), -INT8_C( 119),  INT8_C(  84), -INT8_C( 106),  INT8_C(  53),
+        -INT8_C( 119),      INT8_MIN, -INT8_C(   7),  INT8_C( 106),  INT8_C(   0), -INT8_C(  92), -INT8_C(  45), -INT8_C(   4),
+         INT8_C(   5), -INT8_C( 107),  INT8_C(   0), -INT8_C( 110),  INT8_C(  55), -INT8_C(  97), -INT8_C(  64),  INT8_C( 121) },
+      {  INT8_C(  42),  INT8_C(   9), -INT8_C(  52), -INT8_C( 106),  INT8_C(   0), -INT8_C(   8),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(  52),  INT8_C(  99),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   6),  INT8_C(   0),
+         INT8_C(  79), -INT8_C(  35),  INT8_C(  25),  INT8_C(   0), -INT8_C(  68),  INT8_C(   0), -INT8_C(  87),  INT8_C(   0),
+         INT8_C(  27), -INT8_C(   1),  INT8_C(   0),  INT8_C(  86), -INT8_C(  48),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  46),  INT8_C( 120), -INT8_C(  66),  INT8_C(  49), -INT8_C(  61),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0), -INT8_C( 121),  INT8_C(   0),  INT8_C(   0),  INT8_C(  44),  INT8_C(   0), -INT8_C(  15),  INT8_C( 100),
+        -INT8_C(  98), -INT8_C(  11),  INT8_C(  18),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  87), -INT8_C( 126),
+         INT8_C(  65),  INT8_C(  79), -INT8_C( 115), -INT8_C(  36),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 102) } },
+    { {  INT8_C(  35),  INT8_C(  89),  INT8_C(  17), -INT8_C(   3),  INT8_C(  30),  INT8_C(   0), -INT8_C(   2),  INT8_C( 117),
+         INT8_C(  15), -INT8_C(  39), -INT8_C(  48), -INT8_C( 109), -INT8_C(  74),  INT8_C(  77), -INT8_C(  13), -INT8_C(  20),
+        -INT8_C(  87), -INT8_C(  16), -INT8_C(  57), -INT8_C(  96),  INT8_C(  69),  INT8_C(   5), -INT8_C(  91),  INT8_C( 120),
+         INT8_C(  12),  INT8_C(  64),  INT8_C( 124), -INT8_C(  28),  INT8_C(  71),  INT8_C(  81), -INT8_C( 125),  INT8_C(  68),
+         INT8_C(   0),  INT8_C(  18),  INT8_C(  62), -INT8_C(  70), -INT8_C( 121), -INT8_C(  52), -INT8_C(  35), -INT8_C( 114),
+         INT8_C(  85),  INT8_C(   9), -INT8_C(  41), -INT8_C(  20), -INT8_C(  71), -INT8_C(  82), -INT8_C(  67), -INT8_C(  18),
+         INT8_C(   7),  INT8_C( 103),  INT8_C(  69),  INT8_C( 127), -INT8_C(  31), -INT8_C(  48), -INT8_C(  95), -INT8_C(  78),
+         INT8_C(  11),  INT8_C(  15), -INT8_C(  69), -INT8_C(  84),  INT8_C(  67),  INT8_C(  69),  INT8_C( 103),  INT8_C( 107) },
+      UINT64_C( 8270196229304373632),
+      { -INT8_C(  65),  INT8_C(  54), -INT8_C(  20),  INT8_C(  39),  INT8_C( 119), -INT8_C(  17), -INT8_C(  14), -INT8_C(  29),
+         INT8_C(  90),  INT8_C(  88), -INT8_C(  72),  INT8_C(  53),  INT8_C(  11), -INT8_C(  61), -INT8_C( 108),  INT8_C(  11),
+        -INT8_C(  41),  INT8_C(  96),  INT8_C(  38),  INT8_C(  72), -INT8_C(  30),  INT8_C(  37), -INT8_C(  53),  INT8_C( 110),
+         INT8_C(   2), -INT8_C(  32),  INT8_C( 107),  INT8_C( 123),  INT8_C(  47), -INT8_C(  59),  INT8_C(  30),  INT8_C(  24),
+        -INT8_C(  96), -INT8_C(  35), -INT8_C(  18), -INT8_C( 127), -INT8_C(  94), -INT8_C(  25), -INT8_C(  88),  INT8_C( 111),
+        -INT8_C( 109),  INT8_C(  40),  INT8_C(  66),  INT8_C(  20), -INT8_C( 110), -INT8_C(  77),  INT8_C(  68), -INT8_C( 112),
+         INT8_C(  85), -INT8_C(  99), -INT8_C(  50),  INT8_C(  67),  INT8_C(  75), -INT8_C(  17), -INT8_C(   6), -INT8_C(  11),
+         INT8_C(  32),  INT8_C(  26),  INT8_C( 102),  INT8_C(  36),  INT8_C(   2), -INT8_C(  28), -INT8_C( 123), -INT8_C(  48) },
+      {  INT8_C(  91), -INT8_C(  49), -INT8_C( 120),  INT8_C(  75), -INT8_C(  13),  INT8_C(   6),  INT8_C(  52),  INT8_C(  86),
+        -INT8_C(  76), -INT8_C(  45), -INT8_C(  18),  INT8_C(   1), -INT8_C(  51),  INT8_C(  98),  INT8_C( 110),  INT8_C(  80),
+        -INT8_C(  36), -INT8_C(  37), -INT8_C(  44),  INT8_C(  37),  INT8_C(  61), -INT8_C( 127), -INT8_C(  92),  INT8_C(  65),
+        -INT8_C(  95),  INT8_C(  38),  INT8_C(  58), -INT8_C( 118),  INT8_C(  47),  INT8_C(  67), -INT8_C(  45), -INT8_C( 102),
+         INT8_C(  15), -INT8_C(  21), -INT8_C(  98),  INT8_C(  49),  INT8_C(  61),  INT8_C(  65),  INT8_C( 105), -INT8_C(  69),
+         INT8_C( 120), -INT8_C(  38), -INT8_C(  17),  INT8_C(  68),  INT8_C( 110), -INT8_C(  34), -INT8_C(  35),  INT8_C(  80),
+         INT8_C(  46),  INT8_C(  46), -INT8_C(   2),  INT8_C(  97),  INT8_C(  25),  INT8_C(  27), -INT8_C(  51), -INT8_C( 122),
+         INT8_C(  79), -INT8_C(  85),  INT8_C(  32), -INT8_C(   6), -INT8_C(  53),  INT8_C( 116),  INT8_C(  40), -INT8_C(  42) },
+      {  INT8_C(  35),  INT8_C(  89),  INT8_C(  17), -INT8_C(   3),  INT8_C(  30),  INT8_C(   0), -INT8_C(   2),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(  39), -INT8_C(  48), -INT8_C( 109),  INT8_C(   0),  INT8_C(  77),  INT8_C(   0), -INT8_C(  20),
+        -INT8_C(  87),  INT8_C(  30),  INT8_C(  24), -INT8_C(  96),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 120),
+         INT8_C(  12),  INT8_C(   0),  INT8_C(   0), -INT8_C(  28),  INT8_C(   0),  INT8_C(   0), -INT8_C( 125),  INT8_C(  68),
+        -INT8_C(  77),  INT8_C(  68), -INT8_C( 112), -INT8_C(  70), -INT8_C( 121),  INT8_C(   0), -INT8_C(  35),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0), -INT8_C(  41), -INT8_C(  20), -INT8_C(  71),  INT8_C(   0), -INT8_C(  67),  INT8_C(   0),
+        -INT8_C(  28),  INT8_C( 103), -INT8_C(  48),  INT8_C( 127), -INT8_C(  31), -INT8_C(  48),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  11),  INT8_C(   0), -INT8_C(  69), -INT8_C(  84),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 107) } },
+    { { -INT8_C(  45), -INT8_C(  34),  INT8_C(  79),  INT8_C(  69),  INT8_C(  81), -INT8_C( 111), -INT8_C(  98),  INT8_C(  19),
+         INT8_C(  25), -INT8_C(  87), -INT8_C(  54), -INT8_C(  13),  INT8_C( 124), -INT8_C(  50), -INT8_C( 115), -INT8_C(  84),
+         INT8_C(  91),  INT8_C(  15), -INT8_C(  39),  INT8_C( 122), -INT8_C(  98), -INT8_C(  33), -INT8_C(  98),  INT8_C(  11),
+        -INT8_C(  31), -INT8_C(  48), -INT8_C(  79),  INT8_C(  48),  INT8_C(  70), -INT8_C(  82), -INT8_C(  27),  INT8_C( 124),
+        -INT8_C(  72), -INT8_C( 109), -INT8_C( 108),  INT8_C(  35), -INT8_C(   7), -INT8_C(  42), -INT8_C(  53),  INT8_C(  10),
+        -INT8_C( 112), -INT8_C( 113),  INT8_C(  78),  INT8_C( 116), -INT8_C(  90),  INT8_C(  63),  INT8_C( 101),  INT8_C(  43),
+         INT8_C(  73), -INT8_C(  59), -INT8_C(  36), -INT8_C(  15), -INT8_C(  86),  INT8_C(   9),  INT8_C(  75), -INT8_C(  61),
+        -INT8_C(  94), -INT8_C(  13), -INT8_C(  28),  INT8_C(  17), -INT8_C(  45),  INT8_C(  64), -INT8_C(  16),  INT8_C(  55) },
+      UINT64_C( 2417553909380474201),
+      {  INT8_C(  45), -INT8_C(  79), -INT8_C(  70), -INT8_C( 107),  INT8_C(   2), -INT8_C(  74), -INT8_C(  59),  INT8_C( 124),
+        -INT8_C(  48), -INT8_C( 127), -INT8_C(  12),  INT8_C( 103),  INT8_C(  51),  INT8_C(  23), -INT8_C(  27), -INT8_C(  74),
+        -INT8_C(  45), -INT8_C(  10),  INT8_C( 125), -INT8_C(  49),  INT8_C( 102), -INT8_C(  48), -INT8_C(   3),  INT8_C(   4),
+        -INT8_C( 110),  INT8_C(  33), -INT8_C(  43),  INT8_C(  42),  INT8_C(  34), -INT8_C(  50), -INT8_C( 103),  INT8_C(  38),
+         INT8_C(  30), -INT8_C(  98),  INT8_C(  35),  INT8_C(  41), -INT8_C(  99), -INT8_C( 122),  INT8_C(  43), -INT8_C( 123),
+        -INT8_C(  36), -INT8_C( 103), -INT8_C( 112), -INT8_C(  91),  INT8_C(  44), -INT8_C(   8), -INT8_C( 119), -INT8_C( 104),
+         INT8_C(  33),  INT8_C(  79),  INT8_C( 117), -INT8_C(   9), -INT8_C(  86),  INT8_C(  73), -INT8_C(  33),  INT8_C(  22),
+        -INT8_C(  76),  INT8_C( 111),  INT8_C(  49), -INT8_C(  25), -INT8_C(  20), -INT8_C(  47), -INT8_C(  94), -INT8_C( 107) },
+      {  INT8_C(  28), -INT8_C(  74),  INT8_C(  87),  INT8_C(  39),  INT8_C(  79), -INT8_C(  53), -INT8_C(   6), -INT8_C( 101),
+         INT8_C(  50), -INT8_C(   4), -INT8_C( 105),  INT8_C(  98),  INT8_C(  94), -INT8_C(  18), -INT8_C(  91), -INT8_C(   4),
+        -INT8_C(  77), -INT8_C(  32),  INT8_C(  99),  INT8_C( 127), -INT8_C(  97), -INT8_C( 120),  INT8_C(  55),  INT8_C(  25),
+         INT8_C(  17), -INT8_C(  65),  INT8_C(  64),  INT8_C(  94),  INT8_C(  98),  INT8_C(  28),  INT8_C( 100), -INT8_C(  28),
+        -INT8_C(   9),  INT8_C(  12), -INT8_C( 124), -INT8_C(  57),  INT8_C(  86), -INT8_C(  86),  INT8_C(  71),  INT8_C(  85),
+         INT8_C(   9),  INT8_C(  77),  INT8_C(  67),  INT8_C(  89),  INT8_C( 113), -INT8_C( 123), -INT8_C(  40), -INT8_C(  79),
+        -INT8_C(   8),  INT8_C(  79),  INT8_C(  33),  INT8_C( 127),  INT8_C(  73),  INT8_C(  59), -INT8_C( 107),  INT8_C(  28),
+         INT8_C(  12), -INT8_C( 126),  INT8_C(  77), -INT8_C(  55), -INT8_C(  64),  INT8_C( 127), -INT8_C( 127), -INT8_C(  38) },
+      {  INT8_C(  23), -INT8_C(  34),  INT8_C(  79),  INT8_C(   0),  INT8_C(   0), -INT8_C( 111),  INT8_C(   0),  INT8_C(  19),
+         INT8_C(   0), -INT8_C(  87),  INT8_C(   0), -INT8_C(  13),  INT8_C( 124),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  91), -INT8_C( 103), -INT8_C(  39),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(  48), -INT8_C(  79),  INT8_C(   0),  INT8_C(  70), -INT8_C(  82),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  72), -INT8_C( 109), -INT8_C( 108),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  10),
+        -INT8_C( 112), -INT8_C( 113),  INT8_C(  78),  INT8_C( 116), -INT8_C(  90),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  73), -INT8_C(  59), -INT8_C( 107),  INT8_C(   0), -INT8_C(  86),  INT8_C(   9),  INT8_C(  75),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(  13), -INT8_C(  28),  INT8_C(  17), -INT8_C(  45),  INT8_C(   0), -INT8_C(  16),  INT8_C(  55) } },
+    { { -INT8_C(   2), -INT8_C(  57),  INT8_C(   0), -INT8_C(  68), -INT8_C( 123),  INT8_C( 104),  INT8_C( 122), -INT8_C(  96),
+        -INT8_C(  15),  INT8_C(  40), -INT8_C( 114),  INT8_C(  35),  INT8_C( 105), -INT8_C(  51),  INT8_C(  64), -INT8_C(  70),
+         INT8_C(  95), -INT8_C(  37),  INT8_C(  32),  INT8_C( 106),  INT8_C(  68), -INT8_C( 122),  INT8_C( 105), -INT8_C( 101),
+        -INT8_C(  24),  INT8_C(  41), -INT8_C(  87),  INT8_C(  82),  INT8_C(  66),  INT8_C(  22),  INT8_C( 118), -INT8_C( 122),
+        -INT8_C(  35),  INT8_C(  38), -INT8_C(  16),  INT8_C(  55),  INT8_C(  65),  INT8_C(  57),  INT8_C(  61), -INT8_C(  31),
+         INT8_C(  38), -INT8_C(  26), -INT8_C(  15), -INT8_C( 110),  INT8_C(  57),  INT8_C(  11), -INT8_C(  57), -INT8_C(  66),
+        -INT8_C(  61), -INT8_C( 114),  INT8_C(  51),  INT8_C( 107), -INT8_C(  57),  INT8_C( 124), -INT8_C(  62),  INT8_C( 111),
+         INT8_C(  59),  INT8_C(  35), -INT8_C(  79), -INT8_C(  48), -INT8_C(  69),  INT8_C(  36),  INT8_C(  26),  INT8_C(  40) },
+      UINT64_C( 2926530153902517733),
+      {  INT8_C(  80), -INT8_C( 120), -INT8_C(  69), -INT8_C(  22), -INT8_C(  69), -INT8_C( 126), -INT8_C(  55),  INT8_C(  24),
+         INT8_C(  46), -INT8_C(  96),  INT8_C(  69), -INT8_C(  57), -INT8_C( 118), -INT8_C(  53), -INT8_C(  94),  INT8_C(  57),
+        -INT8_C( 101),  INT8_C( 110), -INT8_C( 116), -INT8_C(  69),  INT8_C(  22),  INT8_C( 114), -INT8_C(  88), -INT8_C(  61),
+         INT8_C(  68), -INT8_C(  82), -INT8_C(  45),  INT8_C(  64), -INT8_C(  28), -INT8_C(  19),  INT8_C( 118),  INT8_C(  74),
+         INT8_C( 124),  INT8_C(  74), -INT8_C(  12),  INT8_C(  93), -INT8_C(  81),  INT8_C(  84),  INT8_C( 102),  INT8_C(  62),
+        -INT8_C(  26),  INT8_C(  41),  INT8_C( 113), -INT8_C(  79), -INT8_C( 116), -INT8_C( 107), -INT8_C(   6), -INT8_C(  53),
+        -INT8_C(  46), -INT8_C(  43),      INT8_MIN,  INT8_C(  61),  INT8_C(  33), -INT8_C(  33),  INT8_C( 118),  INT8_C(  46),
+         INT8_C( 126), -INT8_C(  44),  INT8_C(  17),  INT8_C(  51), -INT8_C( 107), -INT8_C( 110), -INT8_C(   7), -INT8_C(  94) },
+      {  INT8_C(  85),  INT8_C(  93), -INT8_C(  49), -INT8_C( 102),  INT8_C(  27),  INT8_C(  45), -INT8_C(  49),  INT8_C( 118),
+        -INT8_C( 106),  INT8_C(  79),  INT8_C(  45),  INT8_C(  17),  INT8_C( 127),  INT8_C(  75),  INT8_C( 123),  INT8_C(  15),
+        -INT8_C( 105), -INT8_C(  28), -INT8_C(  19),  INT8_C(  70),  INT8_C( 126),  INT8_C(  36),  INT8_C(   0), -INT8_C(  42),
+         INT8_C(  25),  INT8_C( 127),  INT8_C(  51), -INT8_C(  43), -INT8_C(  54),  INT8_C(  13), -INT8_C(  55), -INT8_C( 100),
+        -INT8_C(  73),  INT8_C(   2), -INT8_C( 118), -INT8_C(   5),  INT8_C(  24),  INT8_C(  26),  INT8_C(  48), -INT8_C(  40),
+        -INT8_C(   5), -INT8_C( 102), -INT8_C(  41),  INT8_C(  28), -INT8_C(  14),  INT8_C(  95),  INT8_C(  99),  INT8_C(  31),
+        -INT8_C( 117),  INT8_C(  72),  INT8_C( 114),  INT8_C(   8), -INT8_C(  52),  INT8_C(  61),  INT8_C( 127),  INT8_C(  49),
+         INT8_C(  49),  INT8_C(  91),  INT8_C(  51),  INT8_C( 109),  INT8_C(  33),  INT8_C(  87),  INT8_C( 107),  INT8_C(   5) },
+      { -INT8_C(  53), -INT8_C(  57),  INT8_C(  57), -INT8_C(  68), -INT8_C( 123),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(  40),  INT8_C(   0),  INT8_C(   0),  INT8_C( 105),  INT8_C(   0),  INT8_C(  64), -INT8_C(  70),
+         INT8_C(  95), -INT8_C(  37),  INT8_C(  74),  INT8_C( 106),  INT8_C(   0), -INT8_C( 122),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  82),  INT8_C(  66),  INT8_C(   0),  INT8_C(   0), -INT8_C( 122),
+        -INT8_C( 107), -INT8_C(   6), -INT8_C(  16),  INT8_C(   0),  INT8_C(  65),  INT8_C(   0),  INT8_C(  61),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  11), -INT8_C(  57), -INT8_C(  66),
+        -INT8_C( 110), -INT8_C( 114), -INT8_C(  94),  INT8_C(   0),  INT8_C(   0),  INT8_C( 124), -INT8_C(  62),  INT8_C(   0),
+         INT8_C(  59),  INT8_C(  35), -INT8_C(  79),  INT8_C(   0), -INT8_C(  69),  INT8_C(   0),  INT8_C(  26),  INT8_C(  40) } },
+    { { -INT8_C(  97),  INT8_C(  84),  INT8_C(  14),  INT8_C(   6), -INT8_C(  34), -INT8_C(  49), -INT8_C(  12),  INT8_C(  39),
+        -INT8_C(  75),  INT8_C(  24), -INT8_C( 106), -INT8_C(  29),  INT8_C(  86),  INT8_C( 112), -INT8_C(  68),  INT8_C(  47),
+        -INT8_C(  17), -INT8_C( 112), -INT8_C(  83), -INT8_C(  32),  INT8_C( 125), -INT8_C(   9), -INT8_C(  70), -INT8_C(  51),
+         INT8_C(  34), -INT8_C(  42), -INT8_C(  73), -INT8_C(  62),  INT8_C(  41),  INT8_C( 123),  INT8_C(  81),  INT8_C(   1),
+         INT8_C(  79),  INT8_C(  45), -INT8_C(  15), -INT8_C(  38), -INT8_C(   9), -INT8_C(  40),  INT8_C(  17), -INT8_C(  41),
+        -INT8_C( 100),  INT8_C(   3), -INT8_C(  61), -INT8_C(  34), -INT8_C(  13),  INT8_C( 114),  INT8_C(   8),  INT8_C(  48),
+         INT8_C( 112), -INT8_C(  84),  INT8_C(  93), -INT8_C(  51),  INT8_C(  40),  INT8_C(  82), -INT8_C(   2), -INT8_C(  95),
+         INT8_C(  72), -INT8_C(  48),  INT8_C(  47), -INT8_C(  69),  INT8_C( 120),  INT8_C(  12),  INT8_C( 104), -INT8_C(  34) },
+      UINT64_C( 5562431021039949935),
+      {  INT8_C(  47),  INT8_C(  97), -INT8_C(  59),  INT8_C(  96),  INT8_C(   4), -INT8_C( 102),  INT8_C(  51),  INT8_C(  47),
+         INT8_C( 113), -INT8_C(  59), -INT8_C(  20),  INT8_C(   7),  INT8_C(  83),  INT8_C(  81), -INT8_C(   3),  INT8_C(  26),
+        -INT8_C(  60),  INT8_C(  25),  INT8_C( 103), -INT8_C(  35),  INT8_C(  94),  INT8_C( 118), -INT8_C(   8),  INT8_C(  43),
+         INT8_C(  27),  INT8_C(  37),  INT8_C(   5),  INT8_C(  11),  INT8_C(  15),  INT8_C(  79),  INT8_C(  77), -INT8_C( 111),
+        -INT8_C(  84), -INT8_C(  87),  INT8_C(  48), -INT8_C(  38), -INT8_C(   3), -INT8_C(  60),  INT8_C(  91),  INT8_C(  27),
+         INT8_C(  33), -INT8_C( 111),  INT8_C( 120),  INT8_C(   6), -INT8_C(   4),  INT8_C(  27),  INT8_C(  71), -INT8_C(  47),
+         INT8_C( 116), -INT8_C( 120),  INT8_C(  35), -INT8_C(  99),  INT8_C( 100), -INT8_C( 102), -INT8_C( 117), -INT8_C( 114),
+        -INT8_C(  27),  INT8_C(  92), -INT8_C(  70),  INT8_C(  91),  INT8_C(  11),  INT8_C(  89),  INT8_C(  11),  INT8_C( 125) },
+      { -INT8_C(  11),  INT8_C(  72), -INT8_C(  54),  INT8_C(  49), -INT8_C(  59),  INT8_C( 126),  INT8_C( 108),      INT8_MIN,
+        -INT8_C( 101), -INT8_C( 114),  INT8_C( 121), -INT8_C(  83),  INT8_C(  10), -INT8_C(  62), -INT8_C(  65),  INT8_C( 108),
+        -INT8_C(  22), -INT8_C( 119), -INT8_C(  84),  INT8_C(  41),  INT8_C(  57),  INT8_C(  73),  INT8_C(   9),  INT8_C( 121),
+        -INT8_C(  13),  INT8_C(  98), -INT8_C(  82), -INT8_C(  33), -INT8_C(   4),  INT8_C(  73), -INT8_C(  85), -INT8_C(  20),
+         INT8_C( 115),  INT8_C(  87),  INT8_C(  87), -INT8_C(  91), -INT8_C(  98), -INT8_C(   5), -INT8_C( 100),  INT8_C( 115),
+        -INT8_C(  41),  INT8_C(  24),  INT8_C( 122), -INT8_C(  66),  INT8_C(  37),  INT8_C(   5), -INT8_C( 105),      INT8_MIN,
+        -INT8_C( 125), -INT8_C(  84),  INT8_C(   9), -INT8_C( 121),  INT8_C(  64),  INT8_C( 110), -INT8_C( 114),  INT8_C(  55),
+        -INT8_C(  97),  INT8_C(  26),  INT8_C(  28),  INT8_C(  36),  INT8_C(  56),  INT8_C( 122),  INT8_C(  14),  INT8_C(  74) },
+      {  INT8_C(  81), -INT8_C(   3),  INT8_C(  26),  INT8_C(   0), -INT8_C(  34),  INT8_C(   0),  INT8_C(   0),  INT8_C(  39),
+        -INT8_C(  75),  INT8_C(  24), -INT8_C( 106),  INT8_C(   0),  INT8_C(   0),  INT8_C( 112), -INT8_C(  68),  INT8_C(  47),
+         INT8_C(  79),  INT8_C(  77), -INT8_C(  83), -INT8_C(  32),  INT8_C(   0),  INT8_C(   0), -INT8_C(  70),  INT8_C(   0),
+         INT8_C(  34), -INT8_C(  42), -INT8_C(  73),  INT8_C(   0),  INT8_C(  41),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  79),  INT8_C(  71), -INT8_C(  15),  INT8_C(   0), -INT8_C(   9), -INT8_C(  40),  INT8_C(  17),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   3), -INT8_C(  61),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   8),  INT8_C(   0),
+         INT8_C(  89), -INT8_C(  84),  INT8_C(  93), -INT8_C(  51),  INT8_C(   0),  INT8_C(   0), -INT8_C(   2), -INT8_C(  95),
+         INT8_C(   0), -INT8_C(  48),  INT8_C(   0),  INT8_C(   0),  INT8_C( 120),  INT8_C(  12),  INT8_C(   0), -INT8_C(  34) } },
+    { {  INT8_C(  20),  INT8_C(  96),  INT8_C(  96), -INT8_C( 112),  INT8_C(   1),  INT8_C(  77),  INT8_C(  37),  INT8_C(  27),
+        -INT8_C( 125),  INT8_C(  34),  INT8_C(  52),  INT8_C(  66),  INT8_C( 112),  INT8_C(  80),  INT8_C( 120), -INT8_C(  66),
+        -INT8_C(  43),  INT8_C( 118),  INT8_C(  54), -INT8_C(  38), -INT8_C( 125),  INT8_C( 126),  INT8_C(  66),  INT8_C(  84),
+         INT8_C(  64), -INT8_C(  14),  INT8_C(  51),  INT8_C(  15),  INT8_C(  39), -INT8_C(  29), -INT8_C( 108), -INT8_C(  99),
+        -INT8_C( 110), -INT8_C(  67), -INT8_C( 120), -INT8_C(  89),  INT8_C( 108), -INT8_C( 120), -INT8_C(   1), -INT8_C(  22),
+        -INT8_C(  45),  INT8_C(  10),  INT8_C(  90),  INT8_C(  50), -INT8_C(  22), -INT8_C(  69),  INT8_C(  52), -INT8_C(  60),
+         INT8_C(  29), -INT8_C(  71),  INT8_C(  92),  INT8_C( 104), -INT8_C( 120),  INT8_C(  15), -INT8_C(  43),  INT8_C(   8),
+         INT8_C( 114),  INT8_C(  38), -INT8_C(  20),  INT8_C(  29),  INT8_C( 115),  INT8_C( 109),  INT8_C(  35),  INT8_C(  25) },
+      UINT64_C( 6111456893906976618),
+      { -INT8_C(  35),  INT8_C( 100), -INT8_C(  20),  INT8_C( 111), -INT8_C( 115),  INT8_C(   4),  INT8_C( 104), -INT8_C(  36),
+         INT8_C( 125),  INT8_C( 105), -INT8_C( 113),  INT8_C(  18),  INT8_C( 120),  INT8_C( 122),  INT8_C(  98),  INT8_C(  90),
+         INT8_C(  14), -INT8_C(  68), -INT8_C(  15),  INT8_C( 124),  INT8_C(  90), -INT8_C(  12), -INT8_C(  95),  INT8_C(  60),
+        -INT8_C(  36), -INT8_C( 111),  INT8_C(  90),  INT8_C(  34),  INT8_C(  72), -INT8_C(  16), -INT8_C(  83),  INT8_C( 104),
+        -INT8_C(  12),  INT8_C(  25), -INT8_C(   3), -INT8_C(  10), -INT8_C(  61), -INT8_C(  12),  INT8_C( 119), -INT8_C(  99),
+        -INT8_C(  40), -INT8_C(  39),  INT8_C(  58),  INT8_C(  28), -INT8_C( 126),  INT8_C( 115), -INT8_C(  17), -INT8_C(  40),
+        -INT8_C(  15), -INT8_C(  78), -INT8_C(  71), -INT8_C(  94), -INT8_C(  55), -INT8_C(  34), -INT8_C(  31), -INT8_C(  10),
+        -INT8_C(  71),  INT8_C( 118),  INT8_C(  48), -INT8_C(   8), -INT8_C(  61), -INT8_C(  70),  INT8_C(  51),  INT8_C(  23) },
+      {  INT8_C(  21),  INT8_C(  33),  INT8_C(  93), -INT8_C(  77), -INT8_C(  78),  INT8_C( 117), -INT8_C( 117),  INT8_C( 108),
+        -INT8_C(  50), -INT8_C(  97), -INT8_C( 120),  INT8_C( 111), -INT8_C(  99),  INT8_C(  72),  INT8_C(  30),  INT8_C(  82),
+        -INT8_C( 122), -INT8_C( 119),  INT8_C( 108), -INT8_C(  50), -INT8_C(  33),  INT8_C( 126),  INT8_C(  32), -INT8_C(   4),
+        -INT8_C(  69), -INT8_C(  12), -INT8_C(  85),  INT8_C(  20), -INT8_C( 114),  INT8_C( 109), -INT8_C(  75), -INT8_C(  44),
+         INT8_C(  95),  INT8_C(  25), -INT8_C(  19),  INT8_C(  86),  INT8_C(  74), -INT8_C( 120),  INT8_C(  35),  INT8_C(  51),
+         INT8_C(  73), -INT8_C(  91),  INT8_C( 106),  INT8_C(  30),  INT8_C( 106), -INT8_C(  10),  INT8_C(  69),  INT8_C(  77),
+         INT8_C(  57),  INT8_C( 101), -INT8_C(  59),  INT8_C(  56), -INT8_C(  30), -INT8_C(  19),  INT8_C(  82),  INT8_C(   4),
+         INT8_C(  90),  INT8_C(   0),  INT8_C(  38),  INT8_C(  88),  INT8_C(  44), -INT8_C( 126), -INT8_C(  37), -INT8_C(  24) },
+      {  INT8_C(  20),  INT8_C(  98),  INT8_C(  96),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(  27),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  16), -INT8_C(  83),  INT8_C( 104),  INT8_C(   0), -INT8_C( 125),  INT8_C(   0),  INT8_C(   0),  INT8_C(  84),
+         INT8_C(   0), -INT8_C(  14),  INT8_C(   0),  INT8_C(  15),  INT8_C(  39), -INT8_C(  29),  INT8_C(   0), -INT8_C(  99),
+        -INT8_C( 110), -INT8_C(  17), -INT8_C( 120),  INT8_C(   0),  INT8_C( 108),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(  10),  INT8_C(  90),  INT8_C(  50), -INT8_C(  22), -INT8_C(  69),  INT8_C(   0), -INT8_C(  60),
+         INT8_C(  29), -INT8_C(  71),  INT8_C(  92),  INT8_C( 104),  INT8_C(   0),  INT8_C(  15),  INT8_C(   0),  INT8_C(   0),
+         INT8_C( 114),  INT8_C(  38),  INT8_C(   0),  INT8_C(  29),  INT8_C(   0),  INT8_C( 109),  INT8_C(   0),  INT8_C(  25) } },
+    { {  INT8_C(  69), -INT8_C(  77),  INT8_C(  22), -INT8_C(  74),  INT8_C(   9), -INT8_C(   3), -INT8_C( 116), -INT8_C(  75),
+        -INT8_C(  90),  INT8_C(  69), -INT8_C(  11),  INT8_C(  10),  INT8_C(  26), -INT8_C( 122),  INT8_C(  91), -INT8_C( 107),
+         INT8_C( 100), -INT8_C(  52),  INT8_C(  51),  INT8_C(  27),  INT8_C( 107),  INT8_C(  61),  INT8_C(   9), -INT8_C(  73),
+         INT8_C(  46), -INT8_C( 102), -INT8_C(  99),  INT8_C(  84), -INT8_C(  84),  INT8_C(  87), -INT8_C(   1), -INT8_C( 114),
+        -INT8_C( 117), -INT8_C( 114),  INT8_C(  39), -INT8_C(  71),  INT8_C( 120),  INT8_C( 106), -INT8_C(  14),  INT8_C(  41),
+         INT8_C(  35), -INT8_C(  97),  INT8_C( 118), -INT8_C(  24), -INT8_C(  73), -INT8_C(  48),  INT8_C(  69), -INT8_C(  23),
+        -INT8_C(  74),  INT8_C(  81),  INT8_C(  97),  INT8_C(  19),  INT8_C(  95), -INT8_C(  51), -INT8_C(  74), -INT8_C(   3),
+         INT8_C(  68),  INT8_C(  90),  INT8_C( 102),  INT8_C(  60), -INT8_C(  46),  INT8_C(  91),  INT8_C(  81),  INT8_C( 115) },
+      UINT64_C( 3604569036981903750),
+      { -INT8_C(   3),  INT8_C(  34), -INT8_C(  64), -INT8_C(  81), -INT8_C(  70),  INT8_C(  43),  INT8_C( 109),  INT8_C( 109),
+        -INT8_C( 121), -INT8_C(  30), -INT8_C( 127),  INT8_C(  60), -INT8_C(  32), -INT8_C( 119), -INT8_C(  66),  INT8_C( 117),
+        -INT8_C(  33), -INT8_C(  22),  INT8_C(  73),  INT8_C(  39),  INT8_C(  45),  INT8_C(  59), -INT8_C(  87),  INT8_C( 122),
+        -INT8_C( 112), -INT8_C(  51), -INT8_C(  52), -INT8_C(   5), -INT8_C(  66),  INT8_C(  31),  INT8_C(   1),  INT8_C(   3),
+        -INT8_C(  23),  INT8_C(  68), -INT8_C(  68),  INT8_C(  59),  INT8_C( 109), -INT8_C(  59), -INT8_C(  98),  INT8_C(  59),
+        -INT8_C(  31), -INT8_C(  94), -INT8_C(  27),  INT8_C(  24), -INT8_C(   8), -INT8_C(  73),  INT8_C(  70), -INT8_C(  68),
+        -INT8_C(  93),  INT8_C(  40), -INT8_C(  64),  INT8_C( 107), -INT8_C(  83),  INT8_C(   0),  INT8_C(  72),  INT8_C(  36),
+        -INT8_C(  64),  INT8_C(  21), -INT8_C(  77), -INT8_C(  90), -INT8_C( 107), -INT8_C(  70), -INT8_C( 111),  INT8_C(   0) },
+      { -INT8_C(  32),  INT8_C(  27), -INT8_C(  33),  INT8_C(  36),  INT8_C( 102),  INT8_C(  76),  INT8_C(  40),  INT8_C(  64),
+         INT8_C(  24),  INT8_C(  12), -INT8_C(  40), -INT8_C(  61), -INT8_C(  14),  INT8_C(  43), -INT8_C(  47),  INT8_C(   8),
+         INT8_C(  96), -INT8_C(  62), -INT8_C(  71),  INT8_C(  22), -INT8_C( 126),  INT8_C(   5),  INT8_C(  95),  INT8_C(  69),
+         INT8_C(  71),  INT8_C(  35),  INT8_C( 127), -INT8_C(  13), -INT8_C(  74), -INT8_C(  81), -INT8_C(  56),  INT8_C(  99),
+         INT8_C(  37), -INT8_C(  73), -INT8_C(  54),  INT8_C(  89), -INT8_C( 109), -INT8_C( 118), -INT8_C(  47),  INT8_C(  50),
+        -INT8_C(  34), -INT8_C( 111),  INT8_C(  68),  INT8_C( 118),  INT8_C(  96), -INT8_C(  46),  INT8_C(  11), -INT8_C(  47),
+        -INT8_C(  36), -INT8_C(  99),  INT8_C(  84), -INT8_C(  10), -INT8_C(  17), -INT8_C(  28),  INT8_C( 101),  INT8_C( 123),
+         INT8_C(   7), -INT8_C(  77),  INT8_C(  54),  INT8_C(  86),  INT8_C(  88),  INT8_C(  26),  INT8_C(  74),  INT8_C(   6) },
+      {  INT8_C(  69), -INT8_C(  66),  INT8_C( 117), -INT8_C(  74),  INT8_C(   9), -INT8_C(   3), -INT8_C( 116),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(  69), -INT8_C(  11),  INT8_C(  10),  INT8_C(  26),  INT8_C(   0),  INT8_C(  91),  INT8_C(   0),
+         INT8_C(  31), -INT8_C(  52),  INT8_C(   3),  INT8_C(   0),  INT8_C( 107),  INT8_C(   0),  INT8_C(   9),  INT8_C(   0),
+         INT8_C(   0), -INT8_C( 102), -INT8_C(  99),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C( 117), -INT8_C( 114),  INT8_C(  39), -INT8_C(  71),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  41),
+         INT8_C(  35), -INT8_C(  97),  INT8_C( 118), -INT8_C(  24), -INT8_C(  73), -INT8_C(  48),  INT8_C(  69), -INT8_C(  23),
+        -INT8_C(  74), -INT8_C( 111),  INT8_C(   0),  INT8_C(  19),  INT8_C(  95), -INT8_C(  51), -INT8_C(  74), -INT8_C(   3),
+         INT8_C(  68),  INT8_C(   0),  INT8_C( 102),  INT8_C(  60),  INT8_C(   0),  INT8_C(   0),  INT8_C(  81),  INT8_C( 115) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi8(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi8(test_vec[i].b);
+    simde__m512i r = simde_mm512_mask_alignr_epi8(src, test_vec[i].k, a, b, INT32_C( 29));
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_alignr_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 k;
+    const int8_t a[64];
+    const int8_t b[64];
+    const int8_t r[64];
+  } test_vec[] = {
+    { UINT64_C( 8335757840589184465),
+      {  INT8_C(  42),  INT8_C(  66), -INT8_C(  50),  INT8_C(  27),  INT8_C(  21),  INT8_C( 115),  INT8_C( 121), -INT8_C(  11),
+        -INT8_C(  48), -INT8_C(  33),  INT8_C(  14),  INT8_C(  62),  INT8_C(  40),  INT8_C(  24), -INT8_C( 108),  INT8_C( 101),
+         INT8_C( 123), -INT8_C( 101),  INT8_C( 106),  INT8_C(  74), -INT8_C(  28), -INT8_C(  91),  INT8_C(  64),  INT8_C(  40),
+         INT8_C( 112), -INT8_C(  58), -INT8_C(  67),  INT8_C(  20), -INT8_C(  66),  INT8_C(  69), -INT8_C( 123),  INT8_C(  74),
+        -INT8_C(   8), -INT8_C(  55), -INT8_C(  64), -INT8_C(  15),  INT8_C(   4), -INT8_C(  42),  INT8_C(  73), -INT8_C(  25),
+        -INT8_C( 126),  INT8_C(   1), -INT8_C( 105),  INT8_C(  26),  INT8_C(   6), -INT8_C(  58), -INT8_C(  73), -INT8_C(  34),
+         INT8_C(  23), -INT8_C(  53), -INT8_C(  66), -INT8_C( 125),  INT8_C( 104), -INT8_C( 118), -INT8_C( 117), -INT8_C(  72),
+        -INT8_C(  11), -INT8_C(  62),  INT8_C( 101),  INT8_C( 111),  INT8_C( 119),  INT8_C(  55), -INT8_C(  81),  INT8_C(  48) },
+      {  INT8_C(  68),  INT8_C( 126),  INT8_C(  88),  INT8_C(  50), -INT8_C(  78), -INT8_C(  83), -INT8_C( 102), -INT8_C( 103),
+             INT8_MIN, -INT8_C(   9),  INT8_C( 100),  INT8_C(  58), -INT8_C(  94), -INT8_C(  89),  INT8_C(  92),  INT8_C(  98),
+         INT8_C(  30),  INT8_C(  90), -INT8_C(  80), -INT8_C( 103), -INT8_C(  50), -INT8_C(  51), -INT8_C(  70), -INT8_C(  33),
+         INT8_C(  58), -INT8_C( 124),  INT8_C(  87), -INT8_C(  31),  INT8_C(  10),  INT8_C(  36), -INT8_C(  24),  INT8_C(  41),
+        -INT8_C(  11),  INT8_C(  34), -INT8_C( 114),  INT8_C( 119),  INT8_C( 101),  INT8_C(  21), -INT8_C(  21), -INT8_C(  36),
+         INT8_C(  67), -INT8_C(  69),  INT8_C(   8),  INT8_C(  86),  INT8_C(  96), -INT8_C(  28), -INT8_C(  85),  INT8_C( 100),
+         INT8_C(  28), -INT8_C(  88), -INT8_C(  31), -INT8_C(  30), -INT8_C( 103),  INT8_C(  54), -INT8_C(  42),  INT8_C( 105),
+         INT8_C(  43), -INT8_C(  43),  INT8_C(  76), -INT8_C( 110), -INT8_C(  79), -INT8_C( 120), -INT8_C(   7),  INT8_C(  76) },
+      { -INT8_C( 108),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(  74),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  73), -INT8_C(  34),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(  48),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C( 6229186189756451963),
+      {  INT8_C(  35),  INT8_C(  73), -INT8_C(  43), -INT8_C(  98),  INT8_C(  83), -INT8_C( 119),  INT8_C( 120),  INT8_C(  32),
+         INT8_C(  24), -INT8_C(  64), -INT8_C( 109), -INT8_C(  44),  INT8_C(  55),  INT8_C( 103),  INT8_C(  97),  INT8_C(   3),
+        -INT8_C(  63), -INT8_C(  30), -INT8_C(  31), -INT8_C(  34), -INT8_C(  89),  INT8_C( 118),  INT8_C(  80), -INT8_C(  32),
+        -INT8_C(  35),  INT8_C(   8),  INT8_C(  84), -INT8_C( 118), -INT8_C(  59), -INT8_C(  24), -INT8_C( 115),  INT8_C(  26),
+        -INT8_C(  78),  INT8_C(  95),  INT8_C(  55), -INT8_C(  79),  INT8_C(  32), -INT8_C(  22),  INT8_C( 107),  INT8_C( 121),
+         INT8_C(  33),  INT8_C(  71), -INT8_C(  53),  INT8_C(  34),  INT8_C( 120), -INT8_C(  56), -INT8_C(   7), -INT8_C(  62),
+         INT8_C(  73), -INT8_C(  47),  INT8_C(  18),  INT8_C( 118),  INT8_C(  58),  INT8_C(  40),  INT8_C(   2),  INT8_C(  42),
+         INT8_C(  84),  INT8_C(  18),  INT8_C(  62),  INT8_C(  30),  INT8_C(  98),  INT8_C(  14),  INT8_C(  56),  INT8_C(  96) },
+      { -INT8_C(  14), -INT8_C( 121), -INT8_C(  34),  INT8_C(  11),  INT8_C(  39),  INT8_C(  63),  INT8_C(  37),  INT8_C(  35),
+         INT8_C(  19),  INT8_C(   9), -INT8_C(  85),  INT8_C(  94), -INT8_C(  92),  INT8_C(  41),  INT8_C( 125),  INT8_C(  93),
+         INT8_C( 107), -INT8_C(  61),  INT8_C(  82),  INT8_C(  24), -INT8_C(  98), -INT8_C( 117), -INT8_C(  32), -INT8_C( 119),
+         INT8_C(  80),  INT8_C( 100),  INT8_C(  20),  INT8_C(  10),  INT8_C(  82),  INT8_C(  58), -INT8_C( 106), -INT8_C(  97),
+        -INT8_C(  46), -INT8_C(  15),  INT8_C(  22), -INT8_C(  88), -INT8_C(  37), -INT8_C( 120), -INT8_C(  23),  INT8_C(  36),
+        -INT8_C(  74),  INT8_C(  69),  INT8_C(  65),  INT8_C(  99),  INT8_C(  37), -INT8_C( 107),  INT8_C(  88), -INT8_C( 112),
+         INT8_C(   9), -INT8_C(  65), -INT8_C(  82),  INT8_C(  45),  INT8_C(  93), -INT8_C(  79),  INT8_C( 124),  INT8_C( 116),
+         INT8_C(   8), -INT8_C(  14),  INT8_C(  25),  INT8_C(  61), -INT8_C(  89), -INT8_C(  28), -INT8_C(  33),      INT8_MIN },
+      {  INT8_C(  97),  INT8_C(   3),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C( 115),  INT8_C(  26),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(  62),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(  96),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C(13639367481333702968),
+      { -INT8_C(   6), -INT8_C( 121), -INT8_C(  26), -INT8_C(  11),  INT8_C(  22),  INT8_C(  40),  INT8_C(  74), -INT8_C(  94),
+         INT8_C(  87), -INT8_C( 119),  INT8_C(  70), -INT8_C(  94), -INT8_C(  93),  INT8_C( 102), -INT8_C(  22),  INT8_C( 117),
+         INT8_C( 109),  INT8_C(  19), -INT8_C(  45),  INT8_C( 102), -INT8_C(  20), -INT8_C(  47), -INT8_C(  76),  INT8_C(  47),
+         INT8_C( 103), -INT8_C(  61), -INT8_C(  88), -INT8_C(  99),  INT8_C( 126),  INT8_C( 112), -INT8_C(  24),  INT8_C(  65),
+        -INT8_C( 121), -INT8_C(  74), -INT8_C( 113), -INT8_C( 124), -INT8_C(  53),  INT8_C( 110),  INT8_C( 102),  INT8_C(  40),
+        -INT8_C(  34), -INT8_C(  91),  INT8_C(  28), -INT8_C( 110), -INT8_C( 111), -INT8_C( 112),  INT8_C(  95), -INT8_C(  25),
+        -INT8_C(  34),  INT8_C(   5),  INT8_C(  81),  INT8_C(  91), -INT8_C(  65), -INT8_C(   8), -INT8_C( 121),  INT8_C(   8),
+         INT8_C(   8), -INT8_C(  88),  INT8_C( 127), -INT8_C(  35), -INT8_C(  30), -INT8_C(  31),      INT8_MIN,  INT8_C( 121) },
+      {  INT8_C(  17),  INT8_C( 127),  INT8_C(  31),  INT8_C(   3),  INT8_C( 125), -INT8_C(  23),  INT8_C(  26), -INT8_C(   6),
+         INT8_C( 125),  INT8_C(  67),  INT8_C(  87), -INT8_C(   3),  INT8_C(  56), -INT8_C( 126), -INT8_C(  81), -INT8_C(  84),
+         INT8_C(  93), -INT8_C(  99),  INT8_C(  60),  INT8_C(  76), -INT8_C(  14),  INT8_C(  75),  INT8_C(  23),  INT8_C(  29),
+         INT8_C(  11), -INT8_C(  23), -INT8_C(  42),  INT8_C(  61),  INT8_C(   1),  INT8_C(  51),  INT8_C(   5),  INT8_C(  39),
+        -INT8_C(  69),  INT8_C(  84),  INT8_C( 112), -INT8_C(  40), -INT8_C( 105), -INT8_C(  92), -INT8_C(  39),  INT8_C(   0),
+         INT8_C(  52), -INT8_C(  62),  INT8_C(   7), -INT8_C( 117),  INT8_C(  28), -INT8_C(  46), -INT8_C(   3), -INT8_C(  66),
+         INT8_C(  17),  INT8_C(  73),  INT8_C(  25), -INT8_C(  25), -INT8_C(  20),  INT8_C(  75),  INT8_C(   5), -INT8_C(  49),
+        -INT8_C(   6),  INT8_C(  67), -INT8_C( 111),  INT8_C(  68),  INT8_C(  38),  INT8_C(  16), -INT8_C( 120), -INT8_C(  33) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  95),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C( 8892692970197997750),
+      { -INT8_C( 121),  INT8_C(  34),  INT8_C( 122), -INT8_C(  48), -INT8_C(  53),  INT8_C( 116), -INT8_C(  92),  INT8_C(  43),
+        -INT8_C(  23), -INT8_C(  18),  INT8_C(   3),  INT8_C(  71), -INT8_C( 107), -INT8_C(  40), -INT8_C(  37),  INT8_C(  96),
+        -INT8_C(  52), -INT8_C(  99), -INT8_C( 126),  INT8_C( 109),  INT8_C(  33), -INT8_C(  47), -INT8_C(  54),  INT8_C(  71),
+        -INT8_C(  51), -INT8_C(   8), -INT8_C(  87),  INT8_C(  58),  INT8_C(  94),  INT8_C(  52),  INT8_C( 106), -INT8_C( 126),
+        -INT8_C(  63),  INT8_C( 102),  INT8_C(  56), -INT8_C( 102),  INT8_C(  37),  INT8_C( 111),  INT8_C(   1), -INT8_C(  31),
+         INT8_C(   0), -INT8_C( 118), -INT8_C(  19), -INT8_C(  58), -INT8_C( 119),  INT8_C(  30),  INT8_C(  26), -INT8_C( 108),
+         INT8_C(  13), -INT8_C(  73), -INT8_C(  50),  INT8_C( 113), -INT8_C(   3), -INT8_C( 110),  INT8_C(  45), -INT8_C(  39),
+         INT8_C( 114), -INT8_C(  90), -INT8_C(  87), -INT8_C(  14),  INT8_C(  49), -INT8_C(  55), -INT8_C(  44), -INT8_C(  29) },
+      {  INT8_C(  86),  INT8_C(  14),  INT8_C(  10),  INT8_C(  94), -INT8_C(  62),  INT8_C(  31),  INT8_C(  17),  INT8_C(  39),
+        -INT8_C(  65), -INT8_C( 112),  INT8_C(  19),  INT8_C(   9),  INT8_C(  73), -INT8_C( 119),  INT8_C( 108),  INT8_C(  12),
+         INT8_C( 104), -INT8_C(  64),  INT8_C(  49), -INT8_C(   5), -INT8_C(  92), -INT8_C( 105), -INT8_C(  84),  INT8_C(  73),
+         INT8_C( 127), -INT8_C(  93), -INT8_C( 116),  INT8_C(  39), -INT8_C(  75),  INT8_C( 108),  INT8_C(   0),  INT8_C(   2),
+        -INT8_C(   2),  INT8_C( 123), -INT8_C(  79),  INT8_C( 120), -INT8_C(  46),  INT8_C(  17),  INT8_C(  67), -INT8_C(  87),
+         INT8_C(   0), -INT8_C(  20), -INT8_C(  27), -INT8_C( 104), -INT8_C(  57),  INT8_C(  48), -INT8_C(  72), -INT8_C(  87),
+        -INT8_C(  16),  INT8_C(  81), -INT8_C(  87), -INT8_C( 122),  INT8_C(  29), -INT8_C(  43), -INT8_C(  26),  INT8_C(  33),
+         INT8_C(   5), -INT8_C(  37),  INT8_C(  66),  INT8_C(  38),  INT8_C(  24), -INT8_C( 108),  INT8_C(   1), -INT8_C(  93) },
+      {  INT8_C(   0),  INT8_C(  96),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C( 106), -INT8_C( 126),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  44),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C( 2602824413844723212),
+      { -INT8_C(  96), -INT8_C(  67),  INT8_C( 104), -INT8_C(  20), -INT8_C(  77), -INT8_C(  66),  INT8_C(  75),  INT8_C(  47),
+         INT8_C( 125), -INT8_C(  97),  INT8_C(  96), -INT8_C(  68), -INT8_C( 125), -INT8_C( 108), -INT8_C(  97), -INT8_C(  16),
+        -INT8_C(  87),  INT8_C( 108), -INT8_C(   6), -INT8_C(  25),  INT8_C(  80),  INT8_C(  80),  INT8_C(  42),  INT8_C(  98),
+        -INT8_C(  16),  INT8_C(  51), -INT8_C(  75),  INT8_C(  78), -INT8_C( 118), -INT8_C(  51),  INT8_C(  30),  INT8_C(  90),
+        -INT8_C(  36), -INT8_C(  43), -INT8_C(  72),  INT8_C(  29),  INT8_C(  59),  INT8_C(  85), -INT8_C( 113),  INT8_C(  30),
+         INT8_C( 116),  INT8_C(  70), -INT8_C( 126),  INT8_C(  15), -INT8_C(  89), -INT8_C( 118),  INT8_C(  41), -INT8_C(  65),
+         INT8_C(  86), -INT8_C( 116), -INT8_C(  51),  INT8_C(  62), -INT8_C(  62),  INT8_C( 123), -INT8_C(   3), -INT8_C(  64),
+        -INT8_C( 103),  INT8_C(  50),  INT8_C(  74),  INT8_C( 106),  INT8_C(  42), -INT8_C( 110), -INT8_C( 101), -INT8_C(  74) },
+      { -INT8_C(  57),  INT8_C( 120),  INT8_C(  14),  INT8_C(  68),  INT8_C(  94),  INT8_C(  52),  INT8_C(  68),  INT8_C(  52),
+        -INT8_C(  64), -INT8_C( 111), -INT8_C(  60), -INT8_C(  29),  INT8_C(  54), -INT8_C( 112),  INT8_C(  41),  INT8_C(  19),
+         INT8_C(  17),  INT8_C(  53), -INT8_C(  31),  INT8_C(  52),  INT8_C(  36),  INT8_C(  52), -INT8_C(  36), -INT8_C(  33),
+        -INT8_C( 120), -INT8_C( 113),  INT8_C(  58),  INT8_C(   8), -INT8_C(  68),  INT8_C(  97), -INT8_C( 127), -INT8_C(  30),
+         INT8_C(  55), -INT8_C( 127),  INT8_C(  36),  INT8_C( 104),  INT8_C(  92),  INT8_C(  78),  INT8_C(  70), -INT8_C( 110),
+         INT8_C(  89), -INT8_C(  31), -INT8_C(  12),  INT8_C(  61), -INT8_C(  57),  INT8_C(  46),  INT8_C(   0), -INT8_C(  50),
+         INT8_C(  33),  INT8_C(  51), -INT8_C(  83), -INT8_C(   8), -INT8_C(   7), -INT8_C( 102),  INT8_C( 105), -INT8_C(  15),
+         INT8_C( 106),  INT8_C( 110), -INT8_C( 126), -INT8_C(  51), -INT8_C(  40), -INT8_C(   9), -INT8_C( 100),  INT8_C( 121) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  30),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  41), -INT8_C(  65),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C( 101), -INT8_C(  74),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C( 7110237526911996509),
+      { -INT8_C(  71), -INT8_C(  60),  INT8_C(  71),  INT8_C(  59), -INT8_C(  31),  INT8_C( 110), -INT8_C( 116),  INT8_C(  97),
+        -INT8_C(   3),  INT8_C(  64),  INT8_C(  96),  INT8_C( 104),  INT8_C(  86), -INT8_C(  70), -INT8_C( 107), -INT8_C(  84),
+         INT8_C(  53),  INT8_C( 127),  INT8_C(   5), -INT8_C(  27),  INT8_C(   8), -INT8_C(  60),  INT8_C(  93), -INT8_C( 127),
+        -INT8_C( 118), -INT8_C( 121),  INT8_C(  32),  INT8_C(  52),  INT8_C(  78), -INT8_C(  98),  INT8_C(  75), -INT8_C( 101),
+         INT8_C(  24),  INT8_C( 100),  INT8_C( 100), -INT8_C(  84), -INT8_C(  93), -INT8_C(  14), -INT8_C(  63),  INT8_C(  70),
+         INT8_C(  82), -INT8_C(  56), -INT8_C(  37), -INT8_C( 126), -INT8_C( 101), -INT8_C(  42), -INT8_C(   9),  INT8_C(  88),
+         INT8_C(  58),  INT8_C(  82), -INT8_C(  12),  INT8_C(  19),  INT8_C(   9), -INT8_C( 123),  INT8_C(  82),  INT8_C(  56),
+         INT8_C(  34), -INT8_C(  26), -INT8_C( 111),  INT8_C(  58), -INT8_C(  48),  INT8_C(  63), -INT8_C(  65),  INT8_C(  52) },
+      { -INT8_C(  92), -INT8_C( 117),  INT8_C(  34),  INT8_C(  84), -INT8_C( 118),  INT8_C(  63), -INT8_C(   7),  INT8_C(  24),
+         INT8_C(  90), -INT8_C(  24), -INT8_C( 121),  INT8_C( 102),  INT8_C( 108),  INT8_C(  80), -INT8_C(  92), -INT8_C( 117),
+         INT8_C( 124), -INT8_C(  54),  INT8_C( 105), -INT8_C( 121),  INT8_C(  50),  INT8_C(  38), -INT8_C(  34),  INT8_C(  31),
+        -INT8_C(  87), -INT8_C(  74),  INT8_C(  73), -INT8_C(  19), -INT8_C( 106),  INT8_C(  59),  INT8_C( 121), -INT8_C(  79),
+        -INT8_C( 106), -INT8_C(  23), -INT8_C(  50),  INT8_C(   5), -INT8_C(  35),  INT8_C(  30), -INT8_C(  86),  INT8_C(  49),
+        -INT8_C(  73),  INT8_C(   2), -INT8_C( 114), -INT8_C( 101), -INT8_C(  52),  INT8_C(   3), -INT8_C(  87), -INT8_C(  30),
+         INT8_C( 101), -INT8_C(  97), -INT8_C(   6), -INT8_C(  15), -INT8_C(  90),  INT8_C(  29),  INT8_C(  27), -INT8_C(  33),
+         INT8_C( 106), -INT8_C(  84),  INT8_C(  71), -INT8_C( 111),  INT8_C( 104), -INT8_C( 112), -INT8_C(  23), -INT8_C(  62) },
+      { -INT8_C( 107),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  75),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(   9),  INT8_C(  88),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C( 7616063133293295603),
+      {  INT8_C(  92), -INT8_C(  98), -INT8_C(  65),  INT8_C( 106), -INT8_C(  46),  INT8_C(  77), -INT8_C(  27),  INT8_C(   8),
+        -INT8_C(  82), -INT8_C(  35),  INT8_C( 100),  INT8_C(  78),  INT8_C(  60), -INT8_C(  36),  INT8_C( 119), -INT8_C(  95),
+         INT8_C(  94), -INT8_C(  12), -INT8_C( 127), -INT8_C( 118), -INT8_C(  93),  INT8_C(  32), -INT8_C(   8), -INT8_C( 117),
+         INT8_C(  18),  INT8_C(   0), -INT8_C(  24),  INT8_C( 121), -INT8_C(  13), -INT8_C(  26), -INT8_C(  47),  INT8_C(  32),
+         INT8_C(  28), -INT8_C( 120), -INT8_C( 119), -INT8_C(  64), -INT8_C(  79),  INT8_C( 122),  INT8_C( 102), -INT8_C(  80),
+         INT8_C(  37), -INT8_C(  59), -INT8_C(  20), -INT8_C(  31),  INT8_C( 108), -INT8_C(  58), -INT8_C(  21), -INT8_C(  56),
+        -INT8_C(  83),  INT8_C( 116),  INT8_C(  70), -INT8_C(  86), -INT8_C(  87),  INT8_C( 114), -INT8_C( 104),  INT8_C(   7),
+        -INT8_C(  17),  INT8_C(  68), -INT8_C(  64),  INT8_C(  23), -INT8_C(   1),  INT8_C( 110),  INT8_C(   4), -INT8_C(  14) },
+      {  INT8_C(  29),  INT8_C(  73),  INT8_C(  57),  INT8_C(   1),  INT8_C(  37),  INT8_C( 113), -INT8_C(  73),  INT8_C(  56),
+        -INT8_C( 114),  INT8_C(  81),  INT8_C( 119),  INT8_C(  91),  INT8_C( 101), -INT8_C( 111),  INT8_C( 102),  INT8_C( 104),
+        -INT8_C(   2), -INT8_C(  57),  INT8_C(  14),  INT8_C(  64),  INT8_C( 106), -INT8_C(  84),  INT8_C( 125), -INT8_C(  95),
+        -INT8_C( 104), -INT8_C(  59),  INT8_C(   6),  INT8_C(  14),  INT8_C(  42), -INT8_C(  70),  INT8_C(  33), -INT8_C(   9),
+         INT8_C(  74), -INT8_C(  26), -INT8_C( 111),  INT8_C( 122), -INT8_C(  90),  INT8_C(  83), -INT8_C( 121),  INT8_C(  40),
+         INT8_C( 114),  INT8_C(   6),  INT8_C(  12), -INT8_C(  44),  INT8_C( 111),  INT8_C(  55), -INT8_C(  17),  INT8_C(  46),
+         INT8_C( 100),  INT8_C(  78), -INT8_C(  48),  INT8_C(  79), -INT8_C( 111), -INT8_C(  22), -INT8_C( 115),  INT8_C(  78),
+         INT8_C(  76),  INT8_C(  24),  INT8_C(   0), -INT8_C( 100), -INT8_C(  39),  INT8_C( 120), -INT8_C(  14),  INT8_C(  89) },
+      {  INT8_C( 119), -INT8_C(  95),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  47),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  21),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C( 7447861273569395289),
+      {  INT8_C(  29), -INT8_C(  51),  INT8_C(  54),  INT8_C(  38), -INT8_C(  38),  INT8_C(  11),  INT8_C(  31),  INT8_C(  59),
+         INT8_C(   9), -INT8_C(  99),  INT8_C(  10),  INT8_C(   8), -INT8_C(  28),  INT8_C(  71),  INT8_C(  53),  INT8_C(  29),
+         INT8_C( 123), -INT8_C(  85),  INT8_C(   0), -INT8_C(  66),  INT8_C( 113),  INT8_C( 121),  INT8_C(  87),  INT8_C(  71),
+         INT8_C(   3),  INT8_C(   9), -INT8_C(  63),  INT8_C(  38), -INT8_C(  50), -INT8_C(  45), -INT8_C(  88),  INT8_C(  79),
+         INT8_C(   3), -INT8_C(  11),  INT8_C(  28),  INT8_C(  70), -INT8_C( 104), -INT8_C( 109), -INT8_C(   4), -INT8_C( 123),
+        -INT8_C(  70), -INT8_C(  13), -INT8_C( 124), -INT8_C(  17), -INT8_C(   2), -INT8_C(  65),  INT8_C( 118), -INT8_C(  80),
+        -INT8_C( 105), -INT8_C(  62),  INT8_C(  97), -INT8_C(  39),  INT8_C(   8),  INT8_C(  76), -INT8_C(  56), -INT8_C(   9),
+        -INT8_C(  70), -INT8_C(  59), -INT8_C(  50),  INT8_C(  57), -INT8_C(  49), -INT8_C(  20),  INT8_C( 127), -INT8_C( 109) },
+      { -INT8_C(  10),  INT8_C(  31), -INT8_C(  83),  INT8_C(  58), -INT8_C(  60),  INT8_C(  79),  INT8_C(  19),  INT8_C( 115),
+        -INT8_C(   3),  INT8_C(  30),  INT8_C(  16), -INT8_C( 106),  INT8_C(  85),  INT8_C(  67), -INT8_C(  63), -INT8_C( 106),
+        -INT8_C(  21),  INT8_C(  76), -INT8_C(  98), -INT8_C( 105), -INT8_C(  32),  INT8_C(  13), -INT8_C(  61),  INT8_C(  80),
+         INT8_C( 124),  INT8_C( 118), -INT8_C(  10), -INT8_C(  25),  INT8_C(  26),  INT8_C(  92),  INT8_C(  64), -INT8_C(   8),
+         INT8_C(  67), -INT8_C( 103), -INT8_C(  22),  INT8_C( 125), -INT8_C(  97),  INT8_C(  84),  INT8_C(  78),  INT8_C(  92),
+        -INT8_C( 114),  INT8_C(  45), -INT8_C(  21),  INT8_C( 120), -INT8_C( 110), -INT8_C(  59),  INT8_C(  74), -INT8_C(  34),
+        -INT8_C(  41), -INT8_C(  32), -INT8_C(  99),  INT8_C(  52), -INT8_C(  34), -INT8_C( 117), -INT8_C(  46),  INT8_C(  43),
+         INT8_C(  83),  INT8_C(  41), -INT8_C(  97), -INT8_C(  78), -INT8_C(  39), -INT8_C(  76),  INT8_C( 115), -INT8_C(   7) },
+      {  INT8_C(  53),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(  79),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(  80),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi8(test_vec[i].b);
+    simde__m512i r = simde_mm512_maskz_alignr_epi8(test_vec[i].k, a, b, INT32_C( 30));
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_alignr_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(  2076930243), -INT32_C(  1982297759), -INT32_C(  1851380614), -INT32_C(   330506314) },
+      {  INT32_C(   497188585), -INT32_C(  1864404677),  INT32_C(   855340309),  INT32_C(   720456674) },
+      {  INT32_C(   720456674), -INT32_C(  2076930243), -INT32_C(  1982297759), -INT32_C(  1851380614) } },
+    { {  INT32_C(   557388160),  INT32_C(  1066568455),  INT32_C(   875612477),  INT32_C(    60972088) },
+      { -INT32_C(   809185866),  INT32_C(   589553228),  INT32_C(  2104831859),  INT32_C(  1015908603) },
+      {  INT32_C(  1015908603),  INT32_C(   557388160),  INT32_C(  1066568455),  INT32_C(   875612477) } },
+    { {  INT32_C(   681431166), -INT32_C(    12343778), -INT32_C(  2018750346),  INT32_C(  1098612672) },
+      { -INT32_C(  1821038202), -INT32_C(  2034946096),  INT32_C(   843376421),  INT32_C(  1391436382) },
+      {  INT32_C(  1391436382),  INT32_C(   681431166), -INT32_C(    12343778), -INT32_C(  2018750346) } },
+    { { -INT32_C(   334964836), -INT32_C(   349996719), -INT32_C(  1642315744),  INT32_C(   183486155) },
+      { -INT32_C(   161026624),  INT32_C(  1735347481),  INT32_C(   744640699),  INT32_C(   983659004) },
+      {  INT32_C(   983659004), -INT32_C(   334964836), -INT32_C(   349996719), -INT32_C(  1642315744) } },
+    { { -INT32_C(  1917685212),  INT32_C(  1426943382), -INT32_C(  2030349527),  INT32_C(  1673152243) },
+      { -INT32_C(   967148960), -INT32_C(   844437231),  INT32_C(    79897034),  INT32_C(   824777128) },
+      {  INT32_C(   824777128), -INT32_C(  1917685212),  INT32_C(  1426943382), -INT32_C(  2030349527) } },
+    { {  INT32_C(   895868043), -INT32_C(   488151223), -INT32_C(   914206541),  INT32_C(   572715400) },
+      { -INT32_C(  1793901176), -INT32_C(   888316930), -INT32_C(   839627698), -INT32_C(  1319545962) },
+      { -INT32_C(  1319545962),  INT32_C(   895868043), -INT32_C(   488151223), -INT32_C(   914206541) } },
+    { { -INT32_C(  2053109063),  INT32_C(  1353690642), -INT32_C(   962650214), -INT32_C(   713320277) },
+      { -INT32_C(  1224917022),  INT32_C(   335826561), -INT32_C(  1639145016), -INT32_C(   522380427) },
+      { -INT32_C(   522380427), -INT32_C(  2053109063),  INT32_C(  1353690642), -INT32_C(   962650214) } },
+    { {  INT32_C(   519034027), -INT32_C(   735268456),  INT32_C(   162830179),  INT32_C(  2046995831) },
+      { -INT32_C(   766603467), -INT32_C(  1467530955),  INT32_C(   644225761),  INT32_C(  1791319540) },
+      {  INT32_C(  1791319540),  INT32_C(   519034027), -INT32_C(   735268456),  INT32_C(   162830179) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_alignr_epi32(a, b, INT32_C(  3));
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_alignr_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C(   489517427), -INT32_C(  1175655603), -INT32_C(   383947378),  INT32_C(    16735708) },
+      UINT8_C(242),
+      {  INT32_C(   911479989),  INT32_C(   769691128),  INT32_C(  1826061617),  INT32_C(  1088015984) },
+      { -INT32_C(  1988266066), -INT32_C(  1932800454),  INT32_C(  1948581211),  INT32_C(  1362828246) },
+      {  INT32_C(   489517427), -INT32_C(  1932800454), -INT32_C(   383947378),  INT32_C(    16735708) } },
+    { { -INT32_C(  1301086764),  INT32_C(  1040611523), -INT32_C(   223751666), -INT32_C(   494168353) },
+      UINT8_C( 44),
+      { -INT32_C(  1495944005),  INT32_C(   992969979), -INT32_C(  2018468527), -INT32_C(  1648873956) },
+      {  INT32_C(  1238936399),  INT32_C(  1111770267),  INT32_C(  1609627022),  INT32_C(  1941895547) },
+      { -INT32_C(  1301086764),  INT32_C(  1040611523),  INT32_C(  1609627022),  INT32_C(  1941895547) } },
+    { { -INT32_C(  1344005050), -INT32_C(   947937186), -INT32_C(   745009128),  INT32_C(  1805779580) },
+      UINT8_C(227),
+      {  INT32_C(  1357353629), -INT32_C(   310644660),  INT32_C(  1512998304),  INT32_C(   682845570) },
+      {  INT32_C(  1891601958), -INT32_C(   356031496), -INT32_C(  1189104963),  INT32_C(   470611880) },
+      {  INT32_C(  1891601958), -INT32_C(   356031496), -INT32_C(   745009128),  INT32_C(  1805779580) } },
+    { {  INT32_C(   936573926), -INT32_C(  1081433855), -INT32_C(  1992619628), -INT32_C(  1156876378) },
+      UINT8_C(245),
+      {  INT32_C(  1301418235), -INT32_C(   301796045),  INT32_C(   429949207),  INT32_C(  1600897765) },
+      { -INT32_C(  1880851860),  INT32_C(  1194325008), -INT32_C(  1636170593),  INT32_C(   875199121) },
+      { -INT32_C(  1880851860), -INT32_C(  1081433855), -INT32_C(  1636170593), -INT32_C(  1156876378) } },
+    { { -INT32_C(  1932962963),  INT32_C(    63590599),  INT32_C(  1454736529),  INT32_C(  1556565466) },
+      UINT8_C(182),
+      {  INT32_C(  2033961518), -INT32_C(  1838778211),  INT32_C(   485180745), -INT32_C(   800186260) },
+      { -INT32_C(   284974389), -INT32_C(   545557116),  INT32_C(  1558147968),  INT32_C(   740224402) },
+      { -INT32_C(  1932962963), -INT32_C(   545557116),  INT32_C(  1558147968),  INT32_C(  1556565466) } },
+    { {  INT32_C(  1042567831),  INT32_C(  1074688638), -INT32_C(  1113798240), -INT32_C(    13501428) },
+      UINT8_C(138),
+      { -INT32_C(  1061592122), -INT32_C(  1976766197), -INT32_C(  1156093575), -INT32_C(   913415156) },
+      {  INT32_C(   221209984), -INT32_C(   446751911),  INT32_C(  1938307628),  INT32_C(   100584193) },
+      {  INT32_C(  1042567831), -INT32_C(   446751911), -INT32_C(  1113798240),  INT32_C(   100584193) } },
+    { {  INT32_C(   781027535), -INT32_C(  1438749608),  INT32_C(  1419613945),  INT32_C(  1919334330) },
+      UINT8_C( 57),
+      {  INT32_C(   870240571), -INT32_C(  1431860579),  INT32_C(  2034473191), -INT32_C(  1375162597) },
+      {  INT32_C(   267272865), -INT32_C(   280400081),  INT32_C(  1214262342),  INT32_C(  1436059592) },
+      {  INT32_C(   267272865), -INT32_C(  1438749608),  INT32_C(  1419613945),  INT32_C(  1436059592) } },
+    { {  INT32_C(   991010001),  INT32_C(  1284320039),  INT32_C(   867321946),  INT32_C(   237954931) },
+      UINT8_C( 41),
+      { -INT32_C(   539087792),  INT32_C(   923115564),  INT32_C(   530763569), -INT32_C(  1833197887) },
+      { -INT32_C(  1160528830), -INT32_C(  2083723423),  INT32_C(   905463386), -INT32_C(   109373135) },
+      { -INT32_C(  1160528830),  INT32_C(  1284320039),  INT32_C(   867321946), -INT32_C(   109373135) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_mask_alignr_epi32(src, test_vec[i].k, a, b, INT32_C(  4));
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_alignr_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { UINT8_C( 33),
+      { -INT32_C(   735819095), -INT32_C(   379099311), -INT32_C(    16678298), -INT32_C(  1386672228) },
+      { -INT32_C(  2023678143), -INT32_C(    67443258), -INT32_C(  1670633368),  INT32_C(  1059035359) },
+      { -INT32_C(    67443258),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C( 58),
+      { -INT32_C(    17099340), -INT32_C(  1637300973), -INT32_C(   985016625),  INT32_C(  1307631030) },
+      {  INT32_C(   921928774),  INT32_C(   972466090),  INT32_C(    86463825), -INT32_C(  1658228977) },
+      {  INT32_C(           0),  INT32_C(    86463825),  INT32_C(           0), -INT32_C(    17099340) } },
+    { UINT8_C( 73),
+      { -INT32_C(   598456661), -INT32_C(   815686501), -INT32_C(   438433264),  INT32_C(   383091240) },
+      { -INT32_C(  1289420378),  INT32_C(  1897599900),  INT32_C(   949684497),  INT32_C(  1939398576) },
+      {  INT32_C(  1897599900),  INT32_C(           0),  INT32_C(           0), -INT32_C(   598456661) } },
+    { UINT8_C(198),
+      { -INT32_C(  1144198345), -INT32_C(  2043147702), -INT32_C(  1162645723), -INT32_C(  1630942977) },
+      { -INT32_C(  1568315607), -INT32_C(   960770333), -INT32_C(  1702644095),  INT32_C(  1104969403) },
+      {  INT32_C(           0), -INT32_C(  1702644095),  INT32_C(  1104969403),  INT32_C(           0) } },
+    { UINT8_C(173),
+      {  INT32_C(  1578414548), -INT32_C(   872406960),  INT32_C(   377589429),  INT32_C(   125265402) },
+      {  INT32_C(  1280598598),  INT32_C(  2034342470),  INT32_C(   824674013),  INT32_C(   182278003) },
+      {  INT32_C(  2034342470),  INT32_C(           0),  INT32_C(   182278003),  INT32_C(  1578414548) } },
+    { UINT8_C(  1),
+      { -INT32_C(   931048081),  INT32_C(  1315356479), -INT32_C(   715709546), -INT32_C(   625236948) },
+      { -INT32_C(  1263328387),  INT32_C(  1071578371), -INT32_C(   821999247), -INT32_C(   381836690) },
+      {  INT32_C(  1071578371),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C( 29),
+      { -INT32_C(  1737433851), -INT32_C(    62114683),  INT32_C(  1373437741),  INT32_C(  1267380485) },
+      {  INT32_C(  1065909425),  INT32_C(  1686195511),  INT32_C(  1117617140),  INT32_C(  2056102436) },
+      {  INT32_C(  1686195511),  INT32_C(           0),  INT32_C(  2056102436), -INT32_C(  1737433851) } },
+    { UINT8_C(186),
+      {  INT32_C(  1603278479), -INT32_C(  1036093201), -INT32_C(   300905655),  INT32_C(    82927875) },
+      {  INT32_C(  2136729243),  INT32_C(  1450859173), -INT32_C(  1465442364), -INT32_C(  1397508935) },
+      {  INT32_C(           0), -INT32_C(  1465442364),  INT32_C(           0),  INT32_C(  1603278479) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_maskz_alignr_epi32(test_vec[i].k, a, b, INT32_C(  5));
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_alignr_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[8];
+    const int32_t b[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { {  INT32_C(   872808546), -INT32_C(  1212637794),  INT32_C(  1940655696),  INT32_C(  1018628871), -INT32_C(  1174113224),  INT32_C(  1035760827),  INT32_C(  1457610077), -INT32_C(  1279619702) },
+      { -INT32_C(   873016469), -INT32_C(  1819221630),  INT32_C(   875185670), -INT32_C(   307994612), -INT32_C(    28128854),  INT32_C(  1354566923), -INT32_C(  1673211940),  INT32_C(   521086307) },
+      { -INT32_C(  1673211940),  INT32_C(   521086307),  INT32_C(   872808546), -INT32_C(  1212637794),  INT32_C(  1940655696),  INT32_C(  1018628871), -INT32_C(  1174113224),  INT32_C(  1035760827) } },
+    { { -INT32_C(  2103752786), -INT32_C(   905952531), -INT32_C(  1955737901), -INT32_C(  1052006788),  INT32_C(   513656890), -INT32_C(  1074992170),  INT32_C(   130595714), -INT32_C(   773151427) },
+      {  INT32_C(  1893979236), -INT32_C(   539060256),  INT32_C(   792056416),  INT32_C(    27580771), -INT32_C(   585382221), -INT32_C(  1994002338), -INT32_C(  1471223404), -INT32_C(  2013633305) },
+      { -INT32_C(  1471223404), -INT32_C(  2013633305), -INT32_C(  2103752786), -INT32_C(   905952531), -INT32_C(  1955737901), -INT32_C(  1052006788),  INT32_C(   513656890), -INT32_C(  1074992170) } },
+    { { -INT32_C(   549387878),  INT32_C(   894156880),  INT32_C(  1945526425), -INT32_C(   520634131), -INT32_C(  1202568565), -INT32_C(   502260079), -INT32_C(  1719520553),  INT32_C(  1579066818) },
+      {  INT32_C(   758615050), -INT32_C(   418791753),  INT32_C(   465192022), -INT32_C(  2132698471), -INT32_C(  1629911357), -INT32_C(   606295285),  INT32_C(  1272898542),  INT32_C(  1901066381) },
+      {  INT32_C(  1272898542),  INT32_C(  1901066381), -INT32_C(   549387878),  INT32_C(   894156880),  INT32_C(  1945526425), -INT32_C(   520634131), -INT32_C(  1202568565), -INT32_C(   502260079) } },
+    { {  INT32_C(   670478087), -INT32_C(  1723775693), -INT32_C(  1445319670),  INT32_C(   969812510),  INT32_C(  1466156705), -INT32_C(   134194021), -INT32_C(  1118576441),  INT32_C(  1249309686) },
+      { -INT32_C(  1709019114), -INT32_C(  1904844669),  INT32_C(  1019598557),  INT32_C(  1052634112), -INT32_C(   256913378), -INT32_C(   871343435),  INT32_C(  1745636065), -INT32_C(  1244240778) },
+      {  INT32_C(  1745636065), -INT32_C(  1244240778),  INT32_C(   670478087), -INT32_C(  1723775693), -INT32_C(  1445319670),  INT32_C(   969812510),  INT32_C(  1466156705), -INT32_C(   134194021) } },
+    { {  INT32_C(   336108464), -INT32_C(   299343790),  INT32_C(  2041717899), -INT32_C(  1792867025), -INT32_C(    40361962), -INT32_C(   739327490), -INT32_C(  1590460500), -INT32_C(   208911776) },
+      { -INT32_C(   413011775), -INT32_C(  1960599494), -INT32_C(   230636662),  INT32_C(   951162009), -INT32_C(  1631515754), -INT32_C(   851508971),  INT32_C(  1736388600), -INT32_C(   573786247) },
+      {  INT32_C(  1736388600), -INT32_C(   573786247),  INT32_C(   336108464), -INT32_C(   299343790),  INT32_C(  2041717899), -INT32_C(  1792867025), -INT32_C(    40361962), -INT32_C(   739327490) } },
+    { {  INT32_C(   781290737), -INT32_C(  1918865884), -INT32_C(  2091699832), -INT32_C(  1018206754),  INT32_C(  1343539182),  INT32_C(   229535242),  INT32_C(   712908533),  INT32_C(   612987826) },
+      { -INT32_C(  2082994967),  INT32_C(  1237983250), -INT32_C(  1299203897),  INT32_C(   175379711), -INT32_C(  1957953980),  INT32_C(  1507375036), -INT32_C(  1744511145),  INT32_C(   121873091) },
+      { -INT32_C(  1744511145),  INT32_C(   121873091),  INT32_C(   781290737), -INT32_C(  1918865884), -INT32_C(  2091699832), -INT32_C(  1018206754),  INT32_C(  1343539182),  INT32_C(   229535242) } },
+    { {  INT32_C(  1895037500),  INT32_C(      932368), -INT32_C(   840542652), -INT32_C(   238668172),  INT32_C(  1879597122),  INT32_C(  1337349190), -INT32_C(  1579908343),  INT32_C(  1635101730) },
+      {  INT32_C(  1894374434), -INT32_C(   504727970),  INT32_C(  1924879306), -INT32_C(    93666340), -INT32_C(  1568145729),  INT32_C(  1081404223),  INT32_C(   208962464),  INT32_C(  1387874768) },
+      {  INT32_C(   208962464),  INT32_C(  1387874768),  INT32_C(  1895037500),  INT32_C(      932368), -INT32_C(   840542652), -INT32_C(   238668172),  INT32_C(  1879597122),  INT32_C(  1337349190) } },
+    { { -INT32_C(  1150349443), -INT32_C(   505241102),  INT32_C(   160233460),  INT32_C(  1372744857),  INT32_C(   792696485),  INT32_C(  1932997977), -INT32_C(  1473746245), -INT32_C(   325775097) },
+      { -INT32_C(   398934124),  INT32_C(    74093875), -INT32_C(   883428294),  INT32_C(    93217860), -INT32_C(  1044715651),  INT32_C(  1980672968),  INT32_C(  1946609626), -INT32_C(  1762447390) },
+      {  INT32_C(  1946609626), -INT32_C(  1762447390), -INT32_C(  1150349443), -INT32_C(   505241102),  INT32_C(   160233460),  INT32_C(  1372744857),  INT32_C(   792696485),  INT32_C(  1932997977) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i r = simde_mm256_alignr_epi32(a, b, INT32_C(  6));
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_alignr_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t b[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { {  INT32_C(  1898302000),  INT32_C(   235143849), -INT32_C(  1850843636),  INT32_C(   884295094),  INT32_C(  1400587660),  INT32_C(   866713439),  INT32_C(   294974767),  INT32_C(    48350915) },
+      UINT8_C(201),
+      {  INT32_C(   665601219),  INT32_C(   812548891), -INT32_C(   552616322), -INT32_C(  1432497078), -INT32_C(  1601611517), -INT32_C(   463061323), -INT32_C(    33527679),  INT32_C(   537953045) },
+      { -INT32_C(   859605235),  INT32_C(  1973189291),  INT32_C(  1969732343), -INT32_C(   949542619), -INT32_C(  1306739822),  INT32_C(  1618398565),  INT32_C(  1348139422), -INT32_C(  1625073768) },
+      { -INT32_C(  1625073768),  INT32_C(   235143849), -INT32_C(  1850843636), -INT32_C(   552616322),  INT32_C(  1400587660),  INT32_C(   866713439), -INT32_C(   463061323), -INT32_C(    33527679) } },
+    { {  INT32_C(   948655600),  INT32_C(   896248332),  INT32_C(   453220067),  INT32_C(  1465906935), -INT32_C(   268278019), -INT32_C(   510388073), -INT32_C(  1174877270),  INT32_C(  1016795086) },
+      UINT8_C(245),
+      {  INT32_C(  1596178569),  INT32_C(  1374610813), -INT32_C(  1108444459),  INT32_C(   828502100), -INT32_C(  2045192427),  INT32_C(  1884322999),  INT32_C(  1823597092),  INT32_C(    39115664) },
+      {  INT32_C(  1387786752),  INT32_C(   885085612), -INT32_C(   671728586),  INT32_C(   152812034), -INT32_C(  1493204243), -INT32_C(   249698049), -INT32_C(    75199490), -INT32_C(   627091568) },
+      { -INT32_C(   627091568),  INT32_C(   896248332),  INT32_C(  1374610813),  INT32_C(  1465906935),  INT32_C(   828502100), -INT32_C(  2045192427),  INT32_C(  1884322999),  INT32_C(  1823597092) } },
+    { { -INT32_C(   645898111), -INT32_C(  1610606982),  INT32_C(  1018379081),  INT32_C(  1024397802), -INT32_C(      129381),  INT32_C(  1259026318),  INT32_C(   799729443),  INT32_C(  1880403789) },
+      UINT8_C( 77),
+      {  INT32_C(   673474747), -INT32_C(  1054798854), -INT32_C(   745383368),  INT32_C(   160974900),  INT32_C(  2127279277), -INT32_C(   175067242),  INT32_C(   621877634),  INT32_C(   396276507) },
+      { -INT32_C(   611651618),  INT32_C(   646558724), -INT32_C(   234325944), -INT32_C(   764280147), -INT32_C(   808130223), -INT32_C(   670001166),  INT32_C(   274518867), -INT32_C(   727723398) },
+      { -INT32_C(   727723398), -INT32_C(  1610606982), -INT32_C(  1054798854), -INT32_C(   745383368), -INT32_C(      129381),  INT32_C(  1259026318), -INT32_C(   175067242),  INT32_C(  1880403789) } },
+    { {  INT32_C(   672276512),  INT32_C(  2126610960), -INT32_C(  1574961140), -INT32_C(  1267018919), -INT32_C(   397651315),  INT32_C(  1804609689),  INT32_C(  1287254741), -INT32_C(  2101912676) },
+      UINT8_C(145),
+      {  INT32_C(   994534241), -INT32_C(   602101937),  INT32_C(   664183565),  INT32_C(   311539929),  INT32_C(  1313482792), -INT32_C(  1368211974), -INT32_C(  1016914125), -INT32_C(  1287013856) },
+      {  INT32_C(   144639815), -INT32_C(  1387666874),  INT32_C(  2118151778), -INT32_C(  1861630942),  INT32_C(   324494332),  INT32_C(  1528521569),  INT32_C(   595152243),  INT32_C(   342665575) },
+      {  INT32_C(   342665575),  INT32_C(  2126610960), -INT32_C(  1574961140), -INT32_C(  1267018919),  INT32_C(   311539929),  INT32_C(  1804609689),  INT32_C(  1287254741), -INT32_C(  1016914125) } },
+    { { -INT32_C(   197500687), -INT32_C(  2140375871),  INT32_C(   519007015),  INT32_C(  2120277388),  INT32_C(  1472894442),  INT32_C(   798932799),  INT32_C(  1382348045),  INT32_C(  1611434998) },
+      UINT8_C(176),
+      { -INT32_C(   261833441),  INT32_C(  1526033783), -INT32_C(   240896996), -INT32_C(   715046522),  INT32_C(  1373427148), -INT32_C(    81956035), -INT32_C(   455623664),  INT32_C(   952064311) },
+      {  INT32_C(  2027920962), -INT32_C(  1639176598),  INT32_C(  1988565357), -INT32_C(  2072487816), -INT32_C(  1441741531), -INT32_C(    87727785), -INT32_C(   136124651),  INT32_C(  1821344804) },
+      { -INT32_C(   197500687), -INT32_C(  2140375871),  INT32_C(   519007015),  INT32_C(  2120277388), -INT32_C(   715046522),  INT32_C(  1373427148),  INT32_C(  1382348045), -INT32_C(   455623664) } },
+    { {  INT32_C(   911615006), -INT32_C(  1575295594),  INT32_C(     9167509),  INT32_C(  1206163364),  INT32_C(   720460635), -INT32_C(   129206182),  INT32_C(  1812609751), -INT32_C(  1252321388) },
+      UINT8_C(  8),
+      {  INT32_C(   487144795), -INT32_C(  1757675811), -INT32_C(  1231166456),  INT32_C(    35669245),  INT32_C(  2093558728), -INT32_C(  1411768228),  INT32_C(  1077944416),  INT32_C(  1654387220) },
+      { -INT32_C(  1543884700),  INT32_C(  1459220504),  INT32_C(  1908305532), -INT32_C(  2136354655),  INT32_C(   537277059), -INT32_C(  1712452086), -INT32_C(  1849497728), -INT32_C(   401826404) },
+      {  INT32_C(   911615006), -INT32_C(  1575295594),  INT32_C(     9167509), -INT32_C(  1231166456),  INT32_C(   720460635), -INT32_C(   129206182),  INT32_C(  1812609751), -INT32_C(  1252321388) } },
+    { { -INT32_C(   373935467),  INT32_C(  1473019458),  INT32_C(   299121875),  INT32_C(   916824303),  INT32_C(  1958025162),  INT32_C(    76361644),  INT32_C(   678493102),  INT32_C(  1761992820) },
+      UINT8_C( 59),
+      { -INT32_C(    86399988),  INT32_C(   345622145), -INT32_C(  1266298772), -INT32_C(   883470509),  INT32_C(  1961877570), -INT32_C(   446469122), -INT32_C(   963705918), -INT32_C(   296205077) },
+      { -INT32_C(    48136736), -INT32_C(  1078926904),  INT32_C(  2001711698),  INT32_C(   905582217), -INT32_C(  1275314513),  INT32_C(   758352982), -INT32_C(  1334135439), -INT32_C(  1249706159) },
+      { -INT32_C(  1249706159), -INT32_C(    86399988),  INT32_C(   299121875), -INT32_C(  1266298772), -INT32_C(   883470509),  INT32_C(  1961877570),  INT32_C(   678493102),  INT32_C(  1761992820) } },
+    { { -INT32_C(  2035480152),  INT32_C(  1653314219), -INT32_C(  1864556592), -INT32_C(  1690751125),  INT32_C(  1994868184),  INT32_C(   261533070), -INT32_C(  1975621401),  INT32_C(   133212511) },
+      UINT8_C( 58),
+      { -INT32_C(  1803454181),  INT32_C(   122912997), -INT32_C(   299889969),  INT32_C(  1082347855), -INT32_C(  1305736066),  INT32_C(   720365187), -INT32_C(  1862834728),  INT32_C(   687677735) },
+      {  INT32_C(    15204009), -INT32_C(   746320828),  INT32_C(   381258854),  INT32_C(   930173382),  INT32_C(  1742616253),  INT32_C(  1678955779),  INT32_C(  1846064082),  INT32_C(   898369626) },
+      { -INT32_C(  2035480152), -INT32_C(  1803454181), -INT32_C(  1864556592), -INT32_C(   299889969),  INT32_C(  1082347855), -INT32_C(  1305736066), -INT32_C(  1975621401),  INT32_C(   133212511) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i r = simde_mm256_mask_alignr_epi32(src, test_vec[i].k, a, b, INT32_C(  7));
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_alignr_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t b[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { UINT8_C(161),
+      {  INT32_C(   878195836),  INT32_C(  1678411674), -INT32_C(  1174244340),  INT32_C(  1870796963),  INT32_C(   657402731),  INT32_C(  1686356101),  INT32_C(   564403758),  INT32_C(   881718461) },
+      {  INT32_C(   326060927), -INT32_C(   717525125), -INT32_C(    66521216),  INT32_C(   126099181), -INT32_C(   507195619), -INT32_C(   973681750), -INT32_C(  1705495480),  INT32_C(   257525415) },
+      {  INT32_C(   326060927),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(   973681750),  INT32_C(           0),  INT32_C(   257525415) } },
+    { UINT8_C(221),
+      {  INT32_C(   807970716),  INT32_C(  1063499386), -INT32_C(   790796929), -INT32_C(   239455553),  INT32_C(   442015704), -INT32_C(  1788494722), -INT32_C(   644832380), -INT32_C(  1842586596) },
+      { -INT32_C(  1014177282),  INT32_C(  1456977486),  INT32_C(  1540016628),  INT32_C(   811246391),  INT32_C(   476484512), -INT32_C(  1493719952),  INT32_C(  1753444181), -INT32_C(  1287310942) },
+      { -INT32_C(  1014177282),  INT32_C(           0),  INT32_C(  1540016628),  INT32_C(   811246391),  INT32_C(   476484512),  INT32_C(           0),  INT32_C(  1753444181), -INT32_C(  1287310942) } },
+    { UINT8_C( 95),
+      { -INT32_C(  1847309627),  INT32_C(   962851860), -INT32_C(  1535624567), -INT32_C(   306419009), -INT32_C(  1958013990), -INT32_C(   316723232),  INT32_C(  1536726496), -INT32_C(   947770725) },
+      {  INT32_C(   912019709), -INT32_C(  1696897578),  INT32_C(   119626583), -INT32_C(  1057359111), -INT32_C(   367602903), -INT32_C(  1378689177),  INT32_C(  1675641454), -INT32_C(  1631767771) },
+      {  INT32_C(   912019709), -INT32_C(  1696897578),  INT32_C(   119626583), -INT32_C(  1057359111), -INT32_C(   367602903),  INT32_C(           0),  INT32_C(  1675641454),  INT32_C(           0) } },
+    { UINT8_C(134),
+      { -INT32_C(  1420832003), -INT32_C(  1984420760), -INT32_C(   310932370),  INT32_C(  1442505162), -INT32_C(   865276115), -INT32_C(   777367833), -INT32_C(   426912724),  INT32_C(  1528238437) },
+      { -INT32_C(   706198287),  INT32_C(   840847984),  INT32_C(   462996894),  INT32_C(  1816984835),  INT32_C(  1889480118),  INT32_C(   339762766),  INT32_C(  2117127660), -INT32_C(   291555436) },
+      {  INT32_C(           0),  INT32_C(   840847984),  INT32_C(   462996894),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(   291555436) } },
+    { UINT8_C(210),
+      {  INT32_C(  2041859265), -INT32_C(  1013311807),  INT32_C(   522441322), -INT32_C(   427301227),  INT32_C(   322172639),  INT32_C(   803112721), -INT32_C(  1272566055), -INT32_C(     2188027) },
+      { -INT32_C(  1027910375),  INT32_C(   169148229), -INT32_C(   776028214),  INT32_C(  1402232410), -INT32_C(  1358719245), -INT32_C(  1209477674), -INT32_C(  1157156990),  INT32_C(   309502460) },
+      {  INT32_C(           0),  INT32_C(   169148229),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1358719245),  INT32_C(           0), -INT32_C(  1157156990),  INT32_C(   309502460) } },
+    { UINT8_C(122),
+      {  INT32_C(  1831014876), -INT32_C(  1245397683), -INT32_C(   879219656),  INT32_C(  1741320798),  INT32_C(   878107965),  INT32_C(  2096965004),  INT32_C(  1828808104), -INT32_C(    59624227) },
+      {  INT32_C(   878727240), -INT32_C(   179314152), -INT32_C(    86927754),  INT32_C(   904975223), -INT32_C(  1277951293), -INT32_C(   826974256),  INT32_C(   859121459),  INT32_C(  1231759145) },
+      {  INT32_C(           0), -INT32_C(   179314152),  INT32_C(           0),  INT32_C(   904975223), -INT32_C(  1277951293), -INT32_C(   826974256),  INT32_C(   859121459),  INT32_C(           0) } },
+    { UINT8_C(105),
+      {  INT32_C(   174900499),  INT32_C(   972846110),  INT32_C(   285450941), -INT32_C(   956051217),  INT32_C(   332670020),  INT32_C(  1508514557),  INT32_C(  2028334761),  INT32_C(   278486922) },
+      {  INT32_C(   988106073),  INT32_C(   762398668),  INT32_C(  1962748787), -INT32_C(   983179758),  INT32_C(  1152324996),  INT32_C(  2055673332), -INT32_C(  1162107794),  INT32_C(  1441576217) },
+      {  INT32_C(   988106073),  INT32_C(           0),  INT32_C(           0), -INT32_C(   983179758),  INT32_C(           0),  INT32_C(  2055673332), -INT32_C(  1162107794),  INT32_C(           0) } },
+    { UINT8_C( 46),
+      { -INT32_C(    31135842), -INT32_C(   328699751),  INT32_C(   759004965),  INT32_C(  2102070065), -INT32_C(   211208415), -INT32_C(  1097267812), -INT32_C(  1836995909),  INT32_C(  1107435745) },
+      {  INT32_C(   457515377), -INT32_C(  1338450169), -INT32_C(  1633590003),  INT32_C(  1152880793),  INT32_C(  1417167442), -INT32_C(   117351978), -INT32_C(   632906814),  INT32_C(  1073673059) },
+      {  INT32_C(           0), -INT32_C(  1338450169), -INT32_C(  1633590003),  INT32_C(  1152880793),  INT32_C(           0), -INT32_C(   117351978),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i r = simde_mm256_maskz_alignr_epi32(test_vec[i].k, a, b, INT32_C(  8));
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_alignr_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const int32_t b[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { { -INT32_C(  1106469559),  INT32_C(     3826925), -INT32_C(  1730210926),  INT32_C(  1536616763),  INT32_C(    60556955), -INT32_C(   227886755), -INT32_C(   992116979),  INT32_C(  1817627991),
+        -INT32_C(  1655969262),  INT32_C(   722708042), -INT32_C(  2133746009),  INT32_C(  2108313815), -INT32_C(   104446785), -INT32_C(    41147310),  INT32_C(  1377996174),  INT32_C(   145558956) },
+      {  INT32_C(  1818244702), -INT32_C(   424943590),  INT32_C(   297043313), -INT32_C(   576825113),  INT32_C(  1571291208),  INT32_C(   626104553), -INT32_C(   617629497),  INT32_C(   755364406),
+        -INT32_C(  1173570699),  INT32_C(   998254769),  INT32_C(  1281260763),  INT32_C(  1956872808), -INT32_C(     6119470),  INT32_C(     2016760), -INT32_C(  1040173540), -INT32_C(   934390037) },
+      { -INT32_C(     6119470),  INT32_C(     2016760), -INT32_C(  1040173540), -INT32_C(   934390037), -INT32_C(  1106469559),  INT32_C(     3826925), -INT32_C(  1730210926),  INT32_C(  1536616763),
+         INT32_C(    60556955), -INT32_C(   227886755), -INT32_C(   992116979),  INT32_C(  1817627991), -INT32_C(  1655969262),  INT32_C(   722708042), -INT32_C(  2133746009),  INT32_C(  2108313815) } },
+    { { -INT32_C(   790683212), -INT32_C(  2126832363),  INT32_C(  1708547654),  INT32_C(   943997075),  INT32_C(   593187248),  INT32_C(  1502519593),  INT32_C(  1417066345), -INT32_C(  1870449770),
+         INT32_C(  1861345005),  INT32_C(   962588786), -INT32_C(    24517999),  INT32_C(  1529829177),  INT32_C(  1429977759), -INT32_C(  1735796499),  INT32_C(   490594955), -INT32_C(  1688515757) },
+      {  INT32_C(   834855916),  INT32_C(  1530513055),  INT32_C(   883637565),  INT32_C(  1709591648),  INT32_C(   352653651),  INT32_C(  1518221953),  INT32_C(  1641599916), -INT32_C(   783682923),
+         INT32_C(   399779922), -INT32_C(   687231793), -INT32_C(   928282084), -INT32_C(  1075786921),  INT32_C(  1961309084), -INT32_C(   734368146),  INT32_C(  1143361683),  INT32_C(   493436390) },
+      {  INT32_C(  1961309084), -INT32_C(   734368146),  INT32_C(  1143361683),  INT32_C(   493436390), -INT32_C(   790683212), -INT32_C(  2126832363),  INT32_C(  1708547654),  INT32_C(   943997075),
+         INT32_C(   593187248),  INT32_C(  1502519593),  INT32_C(  1417066345), -INT32_C(  1870449770),  INT32_C(  1861345005),  INT32_C(   962588786), -INT32_C(    24517999),  INT32_C(  1529829177) } },
+    { {  INT32_C(   654570737), -INT32_C(  1817132279), -INT32_C(   869632428), -INT32_C(  1355832119), -INT32_C(   759826346), -INT32_C(   511311229),  INT32_C(  1853535180), -INT32_C(  1341258700),
+         INT32_C(   828351719), -INT32_C(  1766758565), -INT32_C(   996808457), -INT32_C(   851868487),  INT32_C(  1793676260), -INT32_C(  1101370268),  INT32_C(  1623548683),  INT32_C(   626118228) },
+      {  INT32_C(   944145715),  INT32_C(  1314962384), -INT32_C(   851491346),  INT32_C(    16985486), -INT32_C(  1433063611), -INT32_C(   395942709), -INT32_C(  1287020823), -INT32_C(   634344482),
+        -INT32_C(  1790736689),  INT32_C(   358158318),  INT32_C(  1884702423),  INT32_C(  1803485640),  INT32_C(   863333133),  INT32_C(     2389647),  INT32_C(  1366499264),  INT32_C(  1363244383) },
+      {  INT32_C(   863333133),  INT32_C(     2389647),  INT32_C(  1366499264),  INT32_C(  1363244383),  INT32_C(   654570737), -INT32_C(  1817132279), -INT32_C(   869632428), -INT32_C(  1355832119),
+        -INT32_C(   759826346), -INT32_C(   511311229),  INT32_C(  1853535180), -INT32_C(  1341258700),  INT32_C(   828351719), -INT32_C(  1766758565), -INT32_C(   996808457), -INT32_C(   851868487) } },
+    { {  INT32_C(  2064467408), -INT32_C(  1434192743), -INT32_C(   272578179), -INT32_C(   361221578), -INT32_C(  2101372233), -INT32_C(  1816461469), -INT32_C(  2066384490), -INT32_C(   246555915),
+         INT32_C(  1834081396),  INT32_C(  1946307275), -INT32_C(  1814648350), -INT32_C(   804886466),  INT32_C(  1399427809),  INT32_C(   921149099), -INT32_C(  1490037708), -INT32_C(  1370739092) },
+      {  INT32_C(   316504423),  INT32_C(  1820669318), -INT32_C(   772490796), -INT32_C(   384458734), -INT32_C(   509083094),  INT32_C(  1325100018),  INT32_C(   382176270), -INT32_C(  1237415538),
+        -INT32_C(   797683471), -INT32_C(   309572989),  INT32_C(  1065548738),  INT32_C(   532986691),  INT32_C(   372408607),  INT32_C(   566504522), -INT32_C(   645501773),  INT32_C(   819811242) },
+      {  INT32_C(   372408607),  INT32_C(   566504522), -INT32_C(   645501773),  INT32_C(   819811242),  INT32_C(  2064467408), -INT32_C(  1434192743), -INT32_C(   272578179), -INT32_C(   361221578),
+        -INT32_C(  2101372233), -INT32_C(  1816461469), -INT32_C(  2066384490), -INT32_C(   246555915),  INT32_C(  1834081396),  INT32_C(  1946307275), -INT32_C(  1814648350), -INT32_C(   804886466) } },
+    { {  INT32_C(   501350958), -INT32_C(   533431153),  INT32_C(  1468953239), -INT32_C(   973066109), -INT32_C(    59194557),  INT32_C(    68209489), -INT32_C(  1470864862), -INT32_C(  1658888959),
+        -INT32_C(   304983430),  INT32_C(  1830765030), -INT32_C(   697937207),  INT32_C(  1991705947), -INT32_C(  1704843214), -INT32_C(  1561608017), -INT32_C(   676017395), -INT32_C(  1670510030) },
+      {  INT32_C(   113189125),  INT32_C(   436114418), -INT32_C(   299495779), -INT32_C(  1711359205),  INT32_C(  1677912030),  INT32_C(   567841190),  INT32_C(   712913583),  INT32_C(  1610146756),
+         INT32_C(  1849725743), -INT32_C(  1562267044), -INT32_C(   553530203), -INT32_C(   548421526),  INT32_C(   597960774), -INT32_C(  1291514527),  INT32_C(   478230472),  INT32_C(   203168380) },
+      {  INT32_C(   597960774), -INT32_C(  1291514527),  INT32_C(   478230472),  INT32_C(   203168380),  INT32_C(   501350958), -INT32_C(   533431153),  INT32_C(  1468953239), -INT32_C(   973066109),
+        -INT32_C(    59194557),  INT32_C(    68209489), -INT32_C(  1470864862), -INT32_C(  1658888959), -INT32_C(   304983430),  INT32_C(  1830765030), -INT32_C(   697937207),  INT32_C(  1991705947) } },
+    { { -INT32_C(  1033592854), -INT32_C(  1078939359), -INT32_C(  1169401282),  INT32_C(  2044768631), -INT32_C(  1213405373), -INT32_C(  1441517552),  INT32_C(  1256140583), -INT32_C(   953960336),
+        -INT32_C(  1615152152),  INT32_C(  1884222960), -INT32_C(  1977586106), -INT32_C(   456962801),  INT32_C(  1414810773),  INT32_C(   682614296),  INT32_C(   137773128),  INT32_C(   443590630) },
+      { -INT32_C(  1414599798),  INT32_C(   297850844), -INT32_C(  1898983753),  INT32_C(  1709060781),  INT32_C(  1705168205), -INT32_C(  1692042943),  INT32_C(  1883958684),  INT32_C(  1070995530),
+         INT32_C(  2003895599),  INT32_C(   884078817),  INT32_C(  1001917974), -INT32_C(  1494091015),  INT32_C(   828625577),  INT32_C(  1315738999), -INT32_C(  1173046350), -INT32_C(   404708059) },
+      {  INT32_C(   828625577),  INT32_C(  1315738999), -INT32_C(  1173046350), -INT32_C(   404708059), -INT32_C(  1033592854), -INT32_C(  1078939359), -INT32_C(  1169401282),  INT32_C(  2044768631),
+        -INT32_C(  1213405373), -INT32_C(  1441517552),  INT32_C(  1256140583), -INT32_C(   953960336), -INT32_C(  1615152152),  INT32_C(  1884222960), -INT32_C(  1977586106), -INT32_C(   456962801) } },
+    { { -INT32_C(   274166870), -INT32_C(   432515532),  INT32_C(   155307723), -INT32_C(   252192021), -INT32_C(  1421269219),  INT32_C(   248626812),  INT32_C(   274913158),  INT32_C(   241234882),
+         INT32_C(  1301689862),  INT32_C(  1998835335),  INT32_C(  1029671579), -INT32_C(   526023975),  INT32_C(   537137383), -INT32_C(  1907228094),  INT32_C(   558306053),  INT32_C(  1878677167) },
+      { -INT32_C(  1238744397),  INT32_C(   117521247),  INT32_C(   495250779), -INT32_C(  1738483959),  INT32_C(    75887275), -INT32_C(  1515017288), -INT32_C(  1495690186), -INT32_C(   741979441),
+         INT32_C(   925610086),  INT32_C(   467452269), -INT32_C(  1015326403), -INT32_C(   968974456), -INT32_C(  1474166533),  INT32_C(   383738685), -INT32_C(  1056339888),  INT32_C(  1584539188) },
+      { -INT32_C(  1474166533),  INT32_C(   383738685), -INT32_C(  1056339888),  INT32_C(  1584539188), -INT32_C(   274166870), -INT32_C(   432515532),  INT32_C(   155307723), -INT32_C(   252192021),
+        -INT32_C(  1421269219),  INT32_C(   248626812),  INT32_C(   274913158),  INT32_C(   241234882),  INT32_C(  1301689862),  INT32_C(  1998835335),  INT32_C(  1029671579), -INT32_C(   526023975) } },
+    { {  INT32_C(   454115587),  INT32_C(   296406377), -INT32_C(   386175685),  INT32_C(  1018504501), -INT32_C(     5234564), -INT32_C(   478808528),  INT32_C(    87777730),  INT32_C(   708498277),
+        -INT32_C(   364052580), -INT32_C(   807869695),  INT32_C(  1463919128), -INT32_C(  1686775147),  INT32_C(   675947092), -INT32_C(   997070228),  INT32_C(  1970645741),  INT32_C(  1396554435) },
+      {  INT32_C(  1987202261), -INT32_C(  1437967246), -INT32_C(  1236632339),  INT32_C(  1707229923),  INT32_C(   452027205), -INT32_C(   509060560),  INT32_C(   582082102), -INT32_C(  2140643230),
+         INT32_C(   713794739),  INT32_C(  2131456444), -INT32_C(  1677022899),  INT32_C(   673713315),  INT32_C(   897604158), -INT32_C(  1426255079), -INT32_C(  2070173565),  INT32_C(   944782585) },
+      {  INT32_C(   897604158), -INT32_C(  1426255079), -INT32_C(  2070173565),  INT32_C(   944782585),  INT32_C(   454115587),  INT32_C(   296406377), -INT32_C(   386175685),  INT32_C(  1018504501),
+        -INT32_C(     5234564), -INT32_C(   478808528),  INT32_C(    87777730),  INT32_C(   708498277), -INT32_C(   364052580), -INT32_C(   807869695),  INT32_C(  1463919128), -INT32_C(  1686775147) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi32(test_vec[i].b);
+    simde__m512i r = simde_mm512_alignr_epi32(a, b, INT32_C( 12));
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_alignr_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t b[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { { -INT32_C(   242998760),  INT32_C(  1232596086), -INT32_C(   928527209), -INT32_C(  1659691693),  INT32_C(   678451728), -INT32_C(    78423586), -INT32_C(   758133760),  INT32_C(   830438237),
+         INT32_C(   562987831),  INT32_C(  1894328587), -INT32_C(   684761112),  INT32_C(   713250262),  INT32_C(  1352486868), -INT32_C(   111997048),  INT32_C(    61252016),  INT32_C(  1767333211) },
+      UINT16_C(45176),
+      {  INT32_C(   546002775),  INT32_C(  2006731898), -INT32_C(  1327761721),  INT32_C(  1832117497),  INT32_C(  1734990999),  INT32_C(   738484391),  INT32_C(   195977238), -INT32_C(  1899672215),
+        -INT32_C(   414228219), -INT32_C(  1480813626),  INT32_C(  1379984862), -INT32_C(  1885326278),  INT32_C(  1818395034), -INT32_C(   847261178),  INT32_C(  1529981442),  INT32_C(   228368751) },
+      {  INT32_C(   884304731), -INT32_C(    97346598),  INT32_C(  1024695475), -INT32_C(   606174861),  INT32_C(   120916908), -INT32_C(   489832737),  INT32_C(  2074665235), -INT32_C(  2021963983),
+        -INT32_C(  1360016280),  INT32_C(  1273114791), -INT32_C(  1572706645), -INT32_C(   675763887),  INT32_C(   827164218),  INT32_C(  1299145517), -INT32_C(   620525903), -INT32_C(  1435592784) },
+      { -INT32_C(   242998760),  INT32_C(  1232596086), -INT32_C(   928527209),  INT32_C(   546002775),  INT32_C(  2006731898), -INT32_C(  1327761721),  INT32_C(  1832117497),  INT32_C(   830438237),
+         INT32_C(   562987831),  INT32_C(  1894328587), -INT32_C(   684761112),  INT32_C(   713250262), -INT32_C(  1480813626),  INT32_C(  1379984862),  INT32_C(    61252016),  INT32_C(  1818395034) } },
+    { { -INT32_C(   165370089), -INT32_C(   868960931),  INT32_C(   226805553),  INT32_C(   881559217), -INT32_C(  1330445880), -INT32_C(   490526423), -INT32_C(   426428131), -INT32_C(   510198521),
+        -INT32_C(  2146958808), -INT32_C(   813646569),  INT32_C(   359997336),  INT32_C(  1511282323), -INT32_C(  1272672780), -INT32_C(  1061459629),  INT32_C(  2109507417),  INT32_C(  1472392575) },
+      UINT16_C(54399),
+      { -INT32_C(  1284282083),  INT32_C(   911093346), -INT32_C(   382131822),  INT32_C(  1820942208),  INT32_C(  1789080984),  INT32_C(  2078677588), -INT32_C(  1792203517), -INT32_C(  1246327348),
+         INT32_C(   329158100), -INT32_C(  1540295865),  INT32_C(  1628120867), -INT32_C(   558269659), -INT32_C(  1273864975),  INT32_C(  1137600723),  INT32_C(   833919851),  INT32_C(  1885250305) },
+      { -INT32_C(  1896274986), -INT32_C(   414717275), -INT32_C(  1082533776),  INT32_C(   350990448), -INT32_C(   784103872),  INT32_C(   874446276), -INT32_C(   204074486), -INT32_C(  1941409164),
+        -INT32_C(    17442677), -INT32_C(    29738771),  INT32_C(   745832105),  INT32_C(  1409585060), -INT32_C(   198134338),  INT32_C(   993220455), -INT32_C(   680411503), -INT32_C(   641316334) },
+      {  INT32_C(   993220455), -INT32_C(   680411503), -INT32_C(   641316334), -INT32_C(  1284282083),  INT32_C(   911093346), -INT32_C(   382131822),  INT32_C(  1820942208), -INT32_C(   510198521),
+        -INT32_C(  2146958808), -INT32_C(   813646569), -INT32_C(  1246327348),  INT32_C(  1511282323), -INT32_C(  1540295865), -INT32_C(  1061459629), -INT32_C(   558269659), -INT32_C(  1273864975) } },
+    { {  INT32_C(   851148553),  INT32_C(  1017340414),  INT32_C(  1280731688), -INT32_C(  1857080444),  INT32_C(  1458148866), -INT32_C(   355921438),  INT32_C(  1088269047),  INT32_C(   150426570),
+        -INT32_C(  1584387986),  INT32_C(  1063231554), -INT32_C(  1223470831), -INT32_C(  1498078286),  INT32_C(   401376559), -INT32_C(   843562807), -INT32_C(  2081807326), -INT32_C(  1103884262) },
+      UINT16_C(58560),
+      { -INT32_C(  1013272291), -INT32_C(   837227082), -INT32_C(  2119788789),  INT32_C(  1809502592),  INT32_C(  1963528055), -INT32_C(   139792625),  INT32_C(  1859744666), -INT32_C(  2143495170),
+        -INT32_C(  1135685831), -INT32_C(  2142234973), -INT32_C(  1504251053), -INT32_C(   361081651), -INT32_C(   925894497),  INT32_C(  1320806653), -INT32_C(  1214754702), -INT32_C(  1911771738) },
+      { -INT32_C(  1018741493), -INT32_C(  1565719670),  INT32_C(  1951151851),  INT32_C(  1146520486), -INT32_C(  1358217844), -INT32_C(  1552327224), -INT32_C(  1469306756), -INT32_C(   359189227),
+         INT32_C(   556348285),  INT32_C(   948911385), -INT32_C(   822248014), -INT32_C(   293826299), -INT32_C(  1261202811), -INT32_C(  1616856313), -INT32_C(   428554366),  INT32_C(  1665335649) },
+      {  INT32_C(   851148553),  INT32_C(  1017340414),  INT32_C(  1280731688), -INT32_C(  1857080444),  INT32_C(  1458148866), -INT32_C(   355921438),  INT32_C(  1809502592),  INT32_C(  1963528055),
+        -INT32_C(  1584387986),  INT32_C(  1063231554), -INT32_C(  2143495170), -INT32_C(  1498078286),  INT32_C(   401376559), -INT32_C(  1504251053), -INT32_C(   361081651), -INT32_C(   925894497) } },
+    { { -INT32_C(   905273485), -INT32_C(   395928205),  INT32_C(   599568679), -INT32_C(    50629361), -INT32_C(  1858009823),  INT32_C(   394080652), -INT32_C(  1061859511), -INT32_C(   245505301),
+         INT32_C(   130422374),  INT32_C(   775194389),  INT32_C(   504133170),  INT32_C(  1550606458),  INT32_C(  1475225188), -INT32_C(   485240185), -INT32_C(   519497820),  INT32_C(  1576681480) },
+      UINT16_C(30620),
+      { -INT32_C(  1447931771), -INT32_C(  1403214428),  INT32_C(  1758163257),  INT32_C(   135943168), -INT32_C(    63382636),  INT32_C(    39896363), -INT32_C(  1043845056), -INT32_C(  1026980230),
+         INT32_C(  1108741805),  INT32_C(   284293216), -INT32_C(  1297916948), -INT32_C(  1599378571), -INT32_C(  1533835045),  INT32_C(  1933953719), -INT32_C(  1603733665),  INT32_C(  1626408767) },
+      {  INT32_C(   257419876), -INT32_C(   148297935), -INT32_C(   981311958), -INT32_C(  1068584522),  INT32_C(  1122198347),  INT32_C(   895336452),  INT32_C(  1035622555), -INT32_C(  1483203343),
+        -INT32_C(   446101024),  INT32_C(   250550768),  INT32_C(   631127126),  INT32_C(  2014757697), -INT32_C(   821452776),  INT32_C(    17012750),  INT32_C(  1368148729), -INT32_C(  1733044513) },
+      { -INT32_C(   905273485), -INT32_C(   395928205), -INT32_C(  1733044513), -INT32_C(  1447931771), -INT32_C(  1403214428),  INT32_C(   394080652), -INT32_C(  1061859511), -INT32_C(    63382636),
+         INT32_C(    39896363), -INT32_C(  1043845056), -INT32_C(  1026980230),  INT32_C(  1550606458),  INT32_C(   284293216), -INT32_C(  1297916948), -INT32_C(  1599378571),  INT32_C(  1576681480) } },
+    { { -INT32_C(  2083466802),  INT32_C(   969946162), -INT32_C(  1196847419),  INT32_C(  1744449709),  INT32_C(  1224571749),  INT32_C(   904316368), -INT32_C(   830601081),  INT32_C(   600190197),
+         INT32_C(  1730804457), -INT32_C(  1791155889), -INT32_C(  2073023372),  INT32_C(   733251939),  INT32_C(   774412149),  INT32_C(   764575284), -INT32_C(  1672811201), -INT32_C(  2113525039) },
+      UINT16_C(27863),
+      {  INT32_C(  1471581039), -INT32_C(  1565024091), -INT32_C(  1821304551),  INT32_C(  2029993930), -INT32_C(  1654291956),  INT32_C(  2007934442), -INT32_C(  1468505383), -INT32_C(  2055389861),
+        -INT32_C(  1045157826),  INT32_C(   595910128), -INT32_C(  1622341253), -INT32_C(   320404094),  INT32_C(   255796513), -INT32_C(   712372995), -INT32_C(   696134562), -INT32_C(  1019232599) },
+      {  INT32_C(  2037091338), -INT32_C(   178932547), -INT32_C(   141893122), -INT32_C(  1605863374), -INT32_C(   340484225), -INT32_C(   420122166), -INT32_C(   985153383), -INT32_C(   146720804),
+         INT32_C(   307423628),  INT32_C(   462738358),  INT32_C(   199120005),  INT32_C(  1021157085), -INT32_C(    31317442), -INT32_C(   997915783), -INT32_C(  1208182419), -INT32_C(   881334702) },
+      { -INT32_C(   997915783), -INT32_C(  1208182419), -INT32_C(   881334702),  INT32_C(  1744449709), -INT32_C(  1565024091),  INT32_C(   904316368),  INT32_C(  2029993930), -INT32_C(  1654291956),
+         INT32_C(  1730804457), -INT32_C(  1791155889), -INT32_C(  2055389861), -INT32_C(  1045157826),  INT32_C(   774412149), -INT32_C(  1622341253), -INT32_C(   320404094), -INT32_C(  2113525039) } },
+    { {  INT32_C(  1594437441),  INT32_C(   376838865), -INT32_C(  1521880556), -INT32_C(  1013414500), -INT32_C(  1890092152),  INT32_C(   933671320),  INT32_C(   116600577), -INT32_C(  1918183018),
+         INT32_C(   578592254),  INT32_C(  1954796086),  INT32_C(  1949313590),  INT32_C(  2054327182),  INT32_C(   454644660), -INT32_C(   406005939), -INT32_C(  1963217308), -INT32_C(  1459776771) },
+      UINT16_C(13933),
+      { -INT32_C(  1880167061), -INT32_C(  1649868926), -INT32_C(   846415998),  INT32_C(  1293530220), -INT32_C(  1603746005), -INT32_C(  1720640165),  INT32_C(  1279951244), -INT32_C(   681193424),
+        -INT32_C(   420922416),  INT32_C(   358735585),  INT32_C(  1025869515),  INT32_C(   935494453),  INT32_C(  2102910169),  INT32_C(  1754342265),  INT32_C(  1560135770), -INT32_C(  2098345462) },
+      {  INT32_C(   214412487), -INT32_C(  1386351528), -INT32_C(  1625691058), -INT32_C(  1762534806),  INT32_C(  1699730167), -INT32_C(  1457057491), -INT32_C(  1608243124),  INT32_C(   925887165),
+        -INT32_C(  1710686915), -INT32_C(  1111563473),  INT32_C(  1655817298),  INT32_C(  1388167754), -INT32_C(   925654006),  INT32_C(   328114551), -INT32_C(  1579272049),  INT32_C(   280691614) },
+      {  INT32_C(   328114551),  INT32_C(   376838865),  INT32_C(   280691614), -INT32_C(  1880167061), -INT32_C(  1890092152), -INT32_C(   846415998),  INT32_C(  1293530220), -INT32_C(  1918183018),
+         INT32_C(   578592254),  INT32_C(  1279951244), -INT32_C(   681193424),  INT32_C(  2054327182),  INT32_C(   358735585),  INT32_C(  1025869515), -INT32_C(  1963217308), -INT32_C(  1459776771) } },
+    { {  INT32_C(   392801384),  INT32_C(   217908525), -INT32_C(  2006647902), -INT32_C(   528577761), -INT32_C(   683837177),  INT32_C(   384921592), -INT32_C(  1645433918),  INT32_C(  2053917700),
+         INT32_C(  1566687780), -INT32_C(  1950700705),  INT32_C(   294408812), -INT32_C(  1684250435), -INT32_C(  1741147032),  INT32_C(   262862135), -INT32_C(  1570233687),  INT32_C(  1549036217) },
+      UINT16_C(56658),
+      {  INT32_C(  1863566868), -INT32_C(   980268863), -INT32_C(  1390047736), -INT32_C(  1580955706),  INT32_C(   311267424),  INT32_C(   842459546),  INT32_C(  2094215588),  INT32_C(   258170866),
+         INT32_C(   899553973), -INT32_C(   726305505),  INT32_C(  1245330655),  INT32_C(  1421948820), -INT32_C(  1508353468), -INT32_C(   723658617), -INT32_C(   858917703),  INT32_C(   703264549) },
+      {  INT32_C(   552441033),  INT32_C(   970989134),  INT32_C(  1591706837), -INT32_C(   883462684), -INT32_C(  1102955400), -INT32_C(  2095616237), -INT32_C(   238026710),  INT32_C(  1371589574),
+        -INT32_C(   693809803), -INT32_C(  1452558201),  INT32_C(  1990012810),  INT32_C(   695835148),  INT32_C(   556515989),  INT32_C(  1557761153),  INT32_C(   457009066),  INT32_C(  1022206129) },
+      {  INT32_C(   392801384),  INT32_C(   457009066), -INT32_C(  2006647902), -INT32_C(   528577761), -INT32_C(   980268863),  INT32_C(   384921592), -INT32_C(  1580955706),  INT32_C(  2053917700),
+         INT32_C(   842459546), -INT32_C(  1950700705),  INT32_C(   258170866),  INT32_C(   899553973), -INT32_C(   726305505),  INT32_C(   262862135),  INT32_C(  1421948820), -INT32_C(  1508353468) } },
+    { {  INT32_C(  1605398586), -INT32_C(  1032151755),  INT32_C(  1659308367),  INT32_C(  2020005302),  INT32_C(  1592210868),  INT32_C(   548910668),  INT32_C(  1741430294), -INT32_C(  1659535175),
+         INT32_C(  2057788414), -INT32_C(   558763932),  INT32_C(  1196249381), -INT32_C(   516740801), -INT32_C(  1404254730),  INT32_C(  1660650645), -INT32_C(  2130625646),  INT32_C(  1991444414) },
+      UINT16_C(22985),
+      { -INT32_C(   392088114),  INT32_C(   462094133),  INT32_C(  1065188141),  INT32_C(   772995353),  INT32_C(  2082650536),  INT32_C(  2023310218),  INT32_C(   174352972), -INT32_C(   467380618),
+        -INT32_C(  1027143919),  INT32_C(   267181433),  INT32_C(   879401729),  INT32_C(    20146086),  INT32_C(  2147248383), -INT32_C(  1410549903), -INT32_C(  1065248214), -INT32_C(   613594769) },
+      { -INT32_C(  1711512982),  INT32_C(  1504335944),  INT32_C(   622926197), -INT32_C(  1945717421),  INT32_C(   403708053), -INT32_C(   754746898), -INT32_C(  2010447968), -INT32_C(  1984524979),
+        -INT32_C(  1064461702), -INT32_C(     9084077),  INT32_C(     8600534),  INT32_C(  1686843350), -INT32_C(   786070010),  INT32_C(    58889618), -INT32_C(   448328369), -INT32_C(   815437900) },
+      {  INT32_C(    58889618), -INT32_C(  1032151755),  INT32_C(  1659308367), -INT32_C(   392088114),  INT32_C(  1592210868),  INT32_C(   548910668),  INT32_C(   772995353),  INT32_C(  2082650536),
+         INT32_C(  2023310218), -INT32_C(   558763932),  INT32_C(  1196249381), -INT32_C(  1027143919),  INT32_C(   267181433),  INT32_C(  1660650645),  INT32_C(    20146086),  INT32_C(  1991444414) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi32(test_vec[i].b);
+    simde__m512i r = simde_mm512_mask_alignr_epi32(src, test_vec[i].k, a, b, INT32_C( 13));
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_alignr_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t b[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { UINT16_C(63436),
+      {  INT32_C(  1697864995),  INT32_C(   607812267),  INT32_C(  1680658906),  INT32_C(  1323142178), -INT32_C(   975303640),  INT32_C(  1817324036),  INT32_C(     3969534),  INT32_C(    36616160),
+        -INT32_C(   721877528),  INT32_C(   792710289),  INT32_C(  1279935649), -INT32_C(  2103083090),  INT32_C(   477245655), -INT32_C(  1090542994),  INT32_C(   169773407), -INT32_C(   851757134) },
+      {  INT32_C(  1418558930),  INT32_C(   668368420),  INT32_C(  1687502609), -INT32_C(    33154436), -INT32_C(  1905772367),  INT32_C(  2145141927), -INT32_C(   556806453),  INT32_C(   505709317),
+         INT32_C(   226165224), -INT32_C(   819262185), -INT32_C(   442061876),  INT32_C(    84619228), -INT32_C(  1970427657), -INT32_C(  1177416037), -INT32_C(  2138867230),  INT32_C(   552554769) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(  1697864995),  INT32_C(   607812267),  INT32_C(           0),  INT32_C(           0), -INT32_C(   975303640),  INT32_C(  1817324036),
+         INT32_C(     3969534),  INT32_C(    36616160), -INT32_C(   721877528),  INT32_C(           0),  INT32_C(  1279935649), -INT32_C(  2103083090),  INT32_C(   477245655), -INT32_C(  1090542994) } },
+    { UINT16_C(52810),
+      { -INT32_C(   508542890),  INT32_C(   597844024), -INT32_C(   471718763),  INT32_C(   482809302),  INT32_C(   429706680), -INT32_C(   573921981),  INT32_C(  2084086160),  INT32_C(  2040058260),
+         INT32_C(  1369360173),  INT32_C(  1144847171), -INT32_C(   345152564),  INT32_C(   123564442), -INT32_C(  1590445437),  INT32_C(   489135700), -INT32_C(   503778515), -INT32_C(   571829780) },
+      {  INT32_C(   967086032), -INT32_C(   676714281), -INT32_C(  2028361682), -INT32_C(   615572606),  INT32_C(   770194944),  INT32_C(  1606424197), -INT32_C(  1227026081), -INT32_C(   416979627),
+        -INT32_C(  1718730736), -INT32_C(   136382990), -INT32_C(   780302326), -INT32_C(   680531900), -INT32_C(  1904813584), -INT32_C(   788536613),  INT32_C(   361526435),  INT32_C(   285671683) },
+      {  INT32_C(           0),  INT32_C(   285671683),  INT32_C(           0),  INT32_C(   597844024),  INT32_C(           0),  INT32_C(           0),  INT32_C(   429706680),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(  2040058260),  INT32_C(  1369360173),  INT32_C(  1144847171),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1590445437),  INT32_C(   489135700) } },
+    { UINT16_C(64756),
+      { -INT32_C(   564480755),  INT32_C(   335840119), -INT32_C(  1998377050), -INT32_C(  1119010047), -INT32_C(  1546233310), -INT32_C(  2091028040), -INT32_C(  1865460798),  INT32_C(  1225905293),
+        -INT32_C(  1741015881), -INT32_C(  1976423259), -INT32_C(   138088183), -INT32_C(   723972652),  INT32_C(     2891511),  INT32_C(  1706590660),  INT32_C(   280699263), -INT32_C(   863765472) },
+      {  INT32_C(   798408005),  INT32_C(   300823245), -INT32_C(  1532154053),  INT32_C(   864064297), -INT32_C(  1854579885), -INT32_C(   265655744), -INT32_C(   861970673),  INT32_C(   921532705),
+        -INT32_C(  1969764852), -INT32_C(   653714057),  INT32_C(  1207494606),  INT32_C(  2029251807), -INT32_C(  1092486634),  INT32_C(   592550649),  INT32_C(   767064757),  INT32_C(  1245072019) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(   564480755),  INT32_C(           0), -INT32_C(  1998377050), -INT32_C(  1119010047), -INT32_C(  1546233310), -INT32_C(  2091028040),
+         INT32_C(           0),  INT32_C(           0), -INT32_C(  1741015881), -INT32_C(  1976423259), -INT32_C(   138088183), -INT32_C(   723972652),  INT32_C(     2891511),  INT32_C(  1706590660) } },
+    { UINT16_C(58890),
+      { -INT32_C(  1768162234),  INT32_C(     9770253), -INT32_C(  1846786020),  INT32_C(   678176784), -INT32_C(   936224698), -INT32_C(  1260683085),  INT32_C(  1070110489),  INT32_C(  2020126547),
+        -INT32_C(  1172675030), -INT32_C(  1483312959),  INT32_C(  2062778336),  INT32_C(  1570123346), -INT32_C(  1443882307),  INT32_C(  1895392704),  INT32_C(   528181666),  INT32_C(    43340081) },
+      {  INT32_C(  1245234118),  INT32_C(  1048682550), -INT32_C(  2056794538), -INT32_C(  1162218388),  INT32_C(   336466113), -INT32_C(   533719038),  INT32_C(   664290029), -INT32_C(   722238805),
+        -INT32_C(   485898511), -INT32_C(  1516991046),  INT32_C(   612120092), -INT32_C(  1853585512), -INT32_C(  1731359216), -INT32_C(   663847779),  INT32_C(  1993290571), -INT32_C(  1969897368) },
+      {  INT32_C(           0), -INT32_C(  1969897368),  INT32_C(           0),  INT32_C(     9770253),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(  2020126547), -INT32_C(  1172675030),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1570123346), -INT32_C(  1443882307),  INT32_C(  1895392704) } },
+    { UINT16_C(41101),
+      { -INT32_C(   750448244), -INT32_C(  2055211924), -INT32_C(  1559550564),  INT32_C(  1812249502), -INT32_C(   212739556),  INT32_C(  1072300588),  INT32_C(   875075945), -INT32_C(   440095274),
+        -INT32_C(  2142235526),  INT32_C(  1098949915),  INT32_C(   962942839), -INT32_C(  2086906669), -INT32_C(  2014419920),  INT32_C(  1343934896),  INT32_C(  1839519148), -INT32_C(  1754068111) },
+      { -INT32_C(   764796858), -INT32_C(    83818711),  INT32_C(     7797226), -INT32_C(   544949336), -INT32_C(  1295795184), -INT32_C(  1704982795),  INT32_C(  2069705497),  INT32_C(   698755267),
+         INT32_C(  1085622573),  INT32_C(    82652150),  INT32_C(  1723019690),  INT32_C(  1160332174), -INT32_C(  1715200819),  INT32_C(  1241254912), -INT32_C(   126316675),  INT32_C(   823608127) },
+      { -INT32_C(   126316675),  INT32_C(           0), -INT32_C(   750448244), -INT32_C(  2055211924),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1072300588),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  2086906669),  INT32_C(           0),  INT32_C(  1343934896) } },
+    { UINT16_C(11577),
+      {  INT32_C(   719788323),  INT32_C(   680493166),  INT32_C(   741661108), -INT32_C(  1171384812),  INT32_C(  1509819091),  INT32_C(    14544081), -INT32_C(  2055788672), -INT32_C(   214829514),
+         INT32_C(   975478150),  INT32_C(    13631056), -INT32_C(   592063892),  INT32_C(  1892412119), -INT32_C(  1305849768),  INT32_C(   327482741), -INT32_C(  1506515815), -INT32_C(  1125537623) },
+      {  INT32_C(  1432075421), -INT32_C(  1229861703),  INT32_C(  1775900909),  INT32_C(  1996302137),  INT32_C(   294283814), -INT32_C(   913825047),  INT32_C(   525669796), -INT32_C(  1653475077),
+        -INT32_C(   491526116), -INT32_C(   770954001),  INT32_C(   995984547),  INT32_C(    11602235),  INT32_C(  1347182654),  INT32_C(  1318818312),  INT32_C(    69881402),  INT32_C(  1026909064) },
+      {  INT32_C(    69881402),  INT32_C(           0),  INT32_C(           0),  INT32_C(   680493166),  INT32_C(   741661108), -INT32_C(  1171384812),  INT32_C(           0),  INT32_C(           0),
+        -INT32_C(  2055788672),  INT32_C(           0),  INT32_C(   975478150),  INT32_C(    13631056),  INT32_C(           0),  INT32_C(  1892412119),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(63230),
+      { -INT32_C(  1408860525), -INT32_C(   388247335), -INT32_C(   912369445), -INT32_C(   921236488),  INT32_C(  1011381354),  INT32_C(  1104684084),  INT32_C(  1621986989),  INT32_C(   545735140),
+         INT32_C(   887990786),  INT32_C(   959400922),  INT32_C(   767702183), -INT32_C(  1183096997), -INT32_C(   392857604), -INT32_C(  1849765521),  INT32_C(  1395765302),  INT32_C(  1475660157) },
+      {  INT32_C(  1375514919),  INT32_C(  1056820365),  INT32_C(   565638646), -INT32_C(  1446073487), -INT32_C(  2037940190), -INT32_C(   581605629), -INT32_C(   403391526),  INT32_C(  2036987968),
+         INT32_C(   946270993),  INT32_C(   488879678), -INT32_C(  1441360033), -INT32_C(   376916723),  INT32_C(   669130292),  INT32_C(  1026120501),  INT32_C(   443470105), -INT32_C(   230895636) },
+      {  INT32_C(           0), -INT32_C(   230895636), -INT32_C(  1408860525), -INT32_C(   388247335), -INT32_C(   912369445), -INT32_C(   921236488),  INT32_C(  1011381354),  INT32_C(  1104684084),
+         INT32_C(           0),  INT32_C(   545735140),  INT32_C(   887990786),  INT32_C(           0),  INT32_C(   767702183), -INT32_C(  1183096997), -INT32_C(   392857604), -INT32_C(  1849765521) } },
+    { UINT16_C(47188),
+      {  INT32_C(  1256712228), -INT32_C(  1755510908),  INT32_C(   440980408), -INT32_C(  1487409150),  INT32_C(   115948000),  INT32_C(   810816518),  INT32_C(  1221305922), -INT32_C(  2123535370),
+         INT32_C(  1287355278), -INT32_C(   897462270),  INT32_C(  1629877463),  INT32_C(  1227340025), -INT32_C(  1764263595), -INT32_C(  2032683861), -INT32_C(    24158887),  INT32_C(   788904185) },
+      {  INT32_C(  1878192931), -INT32_C(  1445290119),  INT32_C(  2115680728),  INT32_C(   145306004),  INT32_C(    85979696), -INT32_C(   367118087), -INT32_C(   695786683),  INT32_C(   889135999),
+         INT32_C(  1236445668),  INT32_C(  1021381907),  INT32_C(  1978284658), -INT32_C(  1209092231),  INT32_C(   440729572), -INT32_C(   708045810),  INT32_C(  1063357544), -INT32_C(   696635707) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(  1256712228),  INT32_C(           0),  INT32_C(   440980408),  INT32_C(           0),  INT32_C(   115948000),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(   897462270),  INT32_C(  1629877463),  INT32_C(  1227340025),  INT32_C(           0), -INT32_C(  2032683861) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi32(test_vec[i].b);
+    simde__m512i r = simde_mm512_maskz_alignr_epi32(test_vec[i].k, a, b, INT32_C( 14));
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_alignr_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[2];
+    const int64_t b[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { {  INT64_C( 5546000173083643470), -INT64_C( 9011197034491243590) },
+      { -INT64_C( 5427099533839970611), -INT64_C( 4699562820942633685) },
+      { -INT64_C( 4699562820942633685),  INT64_C( 5546000173083643470) } },
+    { { -INT64_C( 6132960240650758192), -INT64_C(  340836476695598857) },
+      { -INT64_C( 4463404637183368774),  INT64_C( 8756320920236631353) },
+      {  INT64_C( 8756320920236631353), -INT64_C( 6132960240650758192) } },
+    { { -INT64_C(  537214920957566470),  INT64_C( 7379256522580391179) },
+      { -INT64_C(  784824682565075231), -INT64_C( 3933970901160381474) },
+      { -INT64_C( 3933970901160381474), -INT64_C(  537214920957566470) } },
+    { {  INT64_C(  264094924966224508), -INT64_C( 3498419875763128455) },
+      { -INT64_C( 4100222623911062165),  INT64_C( 3763532934137153412) },
+      {  INT64_C( 3763532934137153412),  INT64_C(  264094924966224508) } },
+    { {  INT64_C( 7363562787254724737), -INT64_C(  819682742962272380) },
+      { -INT64_C( 5266661014098389343), -INT64_C( 1000309080935391077) },
+      { -INT64_C( 1000309080935391077),  INT64_C( 7363562787254724737) } },
+    { { -INT64_C( 3016688415959945668),  INT64_C( 8201771737273193711) },
+      {  INT64_C( 5873852914133004352), -INT64_C( 4075289167424423597) },
+      { -INT64_C( 4075289167424423597), -INT64_C( 3016688415959945668) } },
+    { { -INT64_C( 6926257025041752281), -INT64_C( 2463965819797706294) },
+      { -INT64_C( 4203930437228563844), -INT64_C(  490011421508815422) },
+      { -INT64_C(  490011421508815422), -INT64_C( 6926257025041752281) } },
+    { {  INT64_C( 5164728818634618924),  INT64_C(  537435800249412803) },
+      {  INT64_C( 4140227980427024920), -INT64_C( 6092959568037667697) },
+      { -INT64_C( 6092959568037667697),  INT64_C( 5164728818634618924) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i r = simde_mm_alignr_epi64(a, b, INT32_C(  1));
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_alignr_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[2];
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t b[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { {  INT64_C( 1889981265353825143), -INT64_C( 2780575165121793022) },
+      UINT8_C(240),
+      {  INT64_C( 7587190291288046837), -INT64_C( 5992669754278012699) },
+      { -INT64_C( 4507728216411108266),  INT64_C( 1490639113995458500) },
+      {  INT64_C( 1889981265353825143), -INT64_C( 2780575165121793022) } },
+    { {  INT64_C( 6372750787151568256), -INT64_C( 5947278442937914954) },
+      UINT8_C( 86),
+      { -INT64_C( 1453260496878864575), -INT64_C(  171537998782721104) },
+      { -INT64_C( 2910354071513519783), -INT64_C( 7677722948170547076) },
+      {  INT64_C( 6372750787151568256), -INT64_C( 7677722948170547076) } },
+    { {  INT64_C( 6426940126387139184),  INT64_C( 7841093617754388293) },
+      UINT8_C( 10),
+      { -INT64_C(  919561769577407080),  INT64_C( 5790695950263420358) },
+      { -INT64_C( 4040216373276492445),  INT64_C( 8636969066172590072) },
+      {  INT64_C( 6426940126387139184),  INT64_C( 8636969066172590072) } },
+    { { -INT64_C( 3045439670431537429),  INT64_C( 6718711537227643004) },
+      UINT8_C(146),
+      {  INT64_C( 6018509529625342793),  INT64_C( 2256862957824431431) },
+      {  INT64_C( 4994219104318999542),  INT64_C( 2886840547099357453) },
+      { -INT64_C( 3045439670431537429),  INT64_C( 2886840547099357453) } },
+    { { -INT64_C( 1415226885635072839),  INT64_C( 7282780408113101683) },
+      UINT8_C(166),
+      { -INT64_C( 3287053662098336981), -INT64_C( 5035974436383638293) },
+      { -INT64_C( 3948638159530924548),  INT64_C( 3280980297285311366) },
+      { -INT64_C( 1415226885635072839),  INT64_C( 3280980297285311366) } },
+    { {  INT64_C( 6261439179124377610), -INT64_C( 5281656940414772210) },
+      UINT8_C(215),
+      {  INT64_C( 8551139735435436355),  INT64_C(   83288154304798320) },
+      {  INT64_C(  450574735306471872),  INT64_C( 9160801211554017686) },
+      {  INT64_C(  450574735306471872),  INT64_C( 9160801211554017686) } },
+    { {  INT64_C( 2244898563765470985),  INT64_C( 2616073290123366725) },
+      UINT8_C(164),
+      { -INT64_C( 7347968829849026185), -INT64_C( 5391000401052867743) },
+      {  INT64_C( 3476256487590813612), -INT64_C( 5266473768945062812) },
+      {  INT64_C( 2244898563765470985),  INT64_C( 2616073290123366725) } },
+    { {  INT64_C( 6073175090330992781), -INT64_C( 1069648776917973426) },
+      UINT8_C( 75),
+      { -INT64_C( 1222422068536566700), -INT64_C(  322961935051674082) },
+      {  INT64_C(  614560526377473837),  INT64_C( 3933870302610761604) },
+      {  INT64_C(  614560526377473837),  INT64_C( 3933870302610761604) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi64(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i r = simde_mm_mask_alignr_epi64(src, test_vec[i].k, a, b, INT32_C(  2));
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_alignr_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t b[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { UINT8_C(181),
+      {  INT64_C( 1510141357032307166), -INT64_C( 3919563921311382950) },
+      {  INT64_C( 2259615550110007236), -INT64_C( 4405197440824358269) },
+      { -INT64_C( 4405197440824358269),  INT64_C(                   0) } },
+    { UINT8_C( 96),
+      {  INT64_C( 8218714271326766628), -INT64_C( 9056471604102042524) },
+      {  INT64_C(  535114322460875623),  INT64_C( 8247307844768619259) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(162),
+      { -INT64_C(  222075889885192879), -INT64_C( 1529199409213520543) },
+      { -INT64_C(  855566447229155776),  INT64_C( 4953260576229313181) },
+      {  INT64_C(                   0), -INT64_C(  222075889885192879) } },
+    { UINT8_C(183),
+      {  INT64_C(  138703118342319148),  INT64_C( 1295499455217629447) },
+      { -INT64_C( 2375109331781152551), -INT64_C( 6622900164767998068) },
+      { -INT64_C( 6622900164767998068),  INT64_C(  138703118342319148) } },
+    { UINT8_C(247),
+      { -INT64_C( 7387759893174875720), -INT64_C(  825330050696980952) },
+      {  INT64_C( 6541456626597782225),  INT64_C( 1375628761310920190) },
+      {  INT64_C( 1375628761310920190), -INT64_C( 7387759893174875720) } },
+    { UINT8_C(209),
+      { -INT64_C( 2653855019415875972),  INT64_C( 6968720704355057252) },
+      { -INT64_C( 7756636958174198651), -INT64_C( 3082907534082117791) },
+      { -INT64_C( 3082907534082117791),  INT64_C(                   0) } },
+    { UINT8_C(236),
+      {  INT64_C( 8450319581288279369), -INT64_C(  666190705837055821) },
+      {  INT64_C( 4243913876281324450), -INT64_C( 2879280984785951216) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  0),
+      {  INT64_C( 6425849352391209050), -INT64_C( 8373729164855772839) },
+      { -INT64_C( 4638441679801506350), -INT64_C( 5613140135688620094) },
+      {  INT64_C(                   0),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i r = simde_mm_maskz_alignr_epi64(test_vec[i].k, a, b, INT32_C(  3));
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_alignr_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[4];
+    const int64_t b[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { {  INT64_C( 4770475704893738442),  INT64_C( 2444040190740417566), -INT64_C( 7554463381269042395), -INT64_C( 1910728328143087186) },
+      {  INT64_C( 4937517787336189263), -INT64_C( 2755402979873089558), -INT64_C( 6612884240463030154),  INT64_C( 7148283656365621023) },
+      { -INT64_C( 6612884240463030154),  INT64_C( 7148283656365621023),  INT64_C( 4770475704893738442),  INT64_C( 2444040190740417566) } },
+    { { -INT64_C( 1125194847798238796),  INT64_C( 5779402277065980625), -INT64_C( 2613655420494251984),  INT64_C( 3740465938436945834) },
+      { -INT64_C( 5167161921050572384),  INT64_C( 2045204504626582711), -INT64_C(  632417925450801054),  INT64_C( 6176345067177227890) },
+      { -INT64_C(  632417925450801054),  INT64_C( 6176345067177227890), -INT64_C( 1125194847798238796),  INT64_C( 5779402277065980625) } },
+    { {  INT64_C(  809279390037306049),  INT64_C( 1623879001983411453), -INT64_C( 2488279512248141900), -INT64_C( 8496999881050951656) },
+      { -INT64_C( 2336799948134785420),  INT64_C( 3461025693541374406), -INT64_C( 3673259094515449384),  INT64_C( 7903968322265487274) },
+      { -INT64_C( 3673259094515449384),  INT64_C( 7903968322265487274),  INT64_C(  809279390037306049),  INT64_C( 1623879001983411453) } },
+    { { -INT64_C( 1162922533374151562), -INT64_C( 1583422471919730260),  INT64_C( 7327447454086935331), -INT64_C(  655341603280455377) },
+      { -INT64_C( 3893776325491674423), -INT64_C( 6098473561920484320),  INT64_C( 5104655602745389018), -INT64_C( 9120419845946692210) },
+      {  INT64_C( 5104655602745389018), -INT64_C( 9120419845946692210), -INT64_C( 1162922533374151562), -INT64_C( 1583422471919730260) } },
+    { { -INT64_C( 4411407351955737004),  INT64_C( 7083127349469783273),  INT64_C( 6976604021119331308),  INT64_C( 3557775985986186196) },
+      { -INT64_C( 7591454558939104609),  INT64_C( 2019008288551474867), -INT64_C( 1711729020924301770), -INT64_C( 5499227558268585091) },
+      { -INT64_C( 1711729020924301770), -INT64_C( 5499227558268585091), -INT64_C( 4411407351955737004),  INT64_C( 7083127349469783273) } },
+    { {  INT64_C( 1634041184484723853), -INT64_C( 6980746623718649224),  INT64_C( 5988558842471701436),  INT64_C( 1059763405928318225) },
+      { -INT64_C( 1576138501176312270), -INT64_C(   55877204482045195),  INT64_C( 4688777523938144246),  INT64_C(  803092003233406303) },
+      {  INT64_C( 4688777523938144246),  INT64_C(  803092003233406303),  INT64_C( 1634041184484723853), -INT64_C( 6980746623718649224) } },
+    { {  INT64_C( 7320308270549879079), -INT64_C( 5166473365638947539),  INT64_C( 4000524433316351645),  INT64_C( 1453589723679937737) },
+      { -INT64_C(  685530465640546864),  INT64_C( 4734543595911519909), -INT64_C( 2670075299015330513), -INT64_C( 8170169157765625477) },
+      { -INT64_C( 2670075299015330513), -INT64_C( 8170169157765625477),  INT64_C( 7320308270549879079), -INT64_C( 5166473365638947539) } },
+    { { -INT64_C(  114252339341061034), -INT64_C( 2738106283735429769),  INT64_C( 1208073908626306863), -INT64_C( 5456556502844889104) },
+      {  INT64_C( 8228188688884351271),  INT64_C( 8272848609693883820), -INT64_C( 4488750579199110634), -INT64_C( 7701275461296921132) },
+      { -INT64_C( 4488750579199110634), -INT64_C( 7701275461296921132), -INT64_C(  114252339341061034), -INT64_C( 2738106283735429769) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i r = simde_mm256_alignr_epi64(a, b, INT32_C(  2));
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_alignr_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[4];
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t b[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { {  INT64_C( 7472165357287291284), -INT64_C( 8617562601545942285),  INT64_C( 9027866961018951513),  INT64_C(  379181634811088057) },
+      UINT8_C( 50),
+      { -INT64_C( 6346068245029249177),  INT64_C( 5940432138248781312), -INT64_C( 1047695143695822264),  INT64_C( 6927799399928562700) },
+      {  INT64_C( 3189381658605040560),  INT64_C( 2103098026372935590), -INT64_C( 9049285606141345105),  INT64_C( 3994425729298956043) },
+      {  INT64_C( 7472165357287291284), -INT64_C( 6346068245029249177),  INT64_C( 9027866961018951513),  INT64_C(  379181634811088057) } },
+    { { -INT64_C( 1538618765098326799), -INT64_C( 7066497468420738411), -INT64_C( 2184794787005084640),  INT64_C( 3907513390921787480) },
+      UINT8_C(109),
+      {  INT64_C( 1223721627383120119),  INT64_C( 5505340133670647348), -INT64_C( 3973988951864903656),  INT64_C( 1645891174591293811) },
+      {  INT64_C( 1659316392263745793), -INT64_C( 6221588016613435733),  INT64_C( 5057659265280522780), -INT64_C( 1551931107643660888) },
+      { -INT64_C( 1551931107643660888), -INT64_C( 7066497468420738411),  INT64_C( 5505340133670647348), -INT64_C( 3973988951864903656) } },
+    { {  INT64_C( 6114158362906389875),  INT64_C(  953973092690404866),  INT64_C( 3497983326214237055),  INT64_C( 4819255787706401318) },
+      UINT8_C( 89),
+      { -INT64_C( 2095429234226080716), -INT64_C( 4136001604607965035),  INT64_C( 5273095412417868551),  INT64_C( 5188946890463666899) },
+      { -INT64_C( 4746784995420713484),  INT64_C( 2128519087620582191),  INT64_C( 3900952140507247269), -INT64_C( 1375360629980113876) },
+      { -INT64_C( 1375360629980113876),  INT64_C(  953973092690404866),  INT64_C( 3497983326214237055),  INT64_C( 5273095412417868551) } },
+    { {  INT64_C( 3475348610652906986), -INT64_C( 8317079042627472266),  INT64_C( 7486779271907688727), -INT64_C( 5845340841209534655) },
+      UINT8_C(137),
+      { -INT64_C( 2703609572062000471), -INT64_C( 4515000199287193277),  INT64_C( 3123557536365800060),  INT64_C( 4594386019091452043) },
+      {  INT64_C( 1495707467301414432),  INT64_C( 1930907887202030464), -INT64_C( 6357870552476918244), -INT64_C( 4737654035141915022) },
+      { -INT64_C( 4737654035141915022), -INT64_C( 8317079042627472266),  INT64_C( 7486779271907688727),  INT64_C( 3123557536365800060) } },
+    { {  INT64_C( 5834184474498035425),  INT64_C( 3667959687596901886),  INT64_C( 1945866662488753144),  INT64_C(  735485054975850175) },
+      UINT8_C(188),
+      {  INT64_C( 1018421107542661592), -INT64_C( 5511135605408412658),  INT64_C( 2255656979566871036), -INT64_C(   78514545760784713) },
+      { -INT64_C( 7355417747873761330), -INT64_C( 5649566030157351504),  INT64_C( 2596458067337980816), -INT64_C( 8083392911217836040) },
+      {  INT64_C( 5834184474498035425),  INT64_C( 3667959687596901886), -INT64_C( 5511135605408412658),  INT64_C( 2255656979566871036) } },
+    { { -INT64_C( 4913176518209574767), -INT64_C( 2827250732793386538), -INT64_C( 1564803255884671639), -INT64_C( 8244155953987837309) },
+      UINT8_C(117),
+      {  INT64_C( 7416037906226607206), -INT64_C(  952652278870724070),  INT64_C( 5521873022724348047), -INT64_C( 4756266967289257530) },
+      { -INT64_C( 7659949814209217096),  INT64_C( 6779869345971237254), -INT64_C( 4548858057090951652), -INT64_C( 3666589287517256997) },
+      { -INT64_C( 3666589287517256997), -INT64_C( 2827250732793386538), -INT64_C(  952652278870724070), -INT64_C( 8244155953987837309) } },
+    { { -INT64_C( 1617236440751554885), -INT64_C( 2342683735000944212), -INT64_C( 3384513660940582384),  INT64_C( 1395509472205921744) },
+      UINT8_C(130),
+      {  INT64_C( 1576920338104869031),  INT64_C( 5692311676148147879), -INT64_C( 5931064981908188188), -INT64_C( 5431443561314068032) },
+      { -INT64_C( 3998234227385024319), -INT64_C( 4179800037613965019), -INT64_C( 8016062198254095980),  INT64_C( 2546744587507507571) },
+      { -INT64_C( 1617236440751554885),  INT64_C( 1576920338104869031), -INT64_C( 3384513660940582384),  INT64_C( 1395509472205921744) } },
+    { {  INT64_C( 3419824273513997091),  INT64_C( 8074623832864965319),  INT64_C( 3508158062192863828), -INT64_C( 2576417870772784256) },
+      UINT8_C(236),
+      {  INT64_C( 6176952143858575832), -INT64_C( 1583496786150608069), -INT64_C( 3874695667618313577),  INT64_C( 4753123152381079197) },
+      {  INT64_C( 6003084035624276052),  INT64_C( 7138650193301920009),  INT64_C( 4275489419840562419),  INT64_C( 7696028099242590005) },
+      {  INT64_C( 3419824273513997091),  INT64_C( 8074623832864965319), -INT64_C( 1583496786150608069), -INT64_C( 3874695667618313577) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi64(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i r = simde_mm256_mask_alignr_epi64(src, test_vec[i].k, a, b, INT32_C(  3));
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_alignr_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t b[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { UINT8_C(128),
+      { -INT64_C( 3757548759280165525), -INT64_C( 3514601231457945504), -INT64_C(  602682704658451938), -INT64_C( 1574892902839243226) },
+      {  INT64_C( 7222652858563658352),  INT64_C(   93889705450481064), -INT64_C( 4037778363438481681),  INT64_C( 6235594130362357862) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(219),
+      { -INT64_C( 1899293296565519238),  INT64_C( 6899197851384644702),  INT64_C( 4500901692937696067),  INT64_C( 1398773425888786942) },
+      { -INT64_C( 6413871576822580628), -INT64_C( 8658559774208362201),  INT64_C( 3015871802795110468), -INT64_C( 1144972022868508901) },
+      { -INT64_C( 6413871576822580628), -INT64_C( 8658559774208362201),  INT64_C(                   0), -INT64_C( 1144972022868508901) } },
+    { UINT8_C( 86),
+      {  INT64_C( 5858491057298107988), -INT64_C( 1803715632802472579),  INT64_C( 1848739149914115907), -INT64_C( 7011801648875883177) },
+      { -INT64_C(  861106969276756213), -INT64_C(   72766626026463573),  INT64_C(  698869376206197107), -INT64_C( 1681224387513744609) },
+      {  INT64_C(                   0), -INT64_C(   72766626026463573),  INT64_C(  698869376206197107),  INT64_C(                   0) } },
+    { UINT8_C(118),
+      {  INT64_C( 5585190560097066882),  INT64_C( 2880873951890990385), -INT64_C( 8689776084160850301), -INT64_C( 3539965274510974348) },
+      {  INT64_C( 4303304657622302238),  INT64_C(  636008806183952223), -INT64_C( 6543824273779088338), -INT64_C( 2821710147838694908) },
+      {  INT64_C(                   0),  INT64_C(  636008806183952223), -INT64_C( 6543824273779088338),  INT64_C(                   0) } },
+    { UINT8_C(246),
+      { -INT64_C( 6829791921093889315),  INT64_C( 6210545794509649316),  INT64_C( 6485770999074132086),  INT64_C( 5894362814790583696) },
+      {  INT64_C(  121310551319871456),  INT64_C( 7714981866918428005), -INT64_C( 7643130854447576749),  INT64_C( 8005045467638865892) },
+      {  INT64_C(                   0),  INT64_C( 7714981866918428005), -INT64_C( 7643130854447576749),  INT64_C(                   0) } },
+    { UINT8_C( 60),
+      { -INT64_C( 2372948066355624906),  INT64_C( 7406658352815303774), -INT64_C( 1572672157649628660),  INT64_C( 1200001732248702129) },
+      { -INT64_C( 5258554358892967392), -INT64_C( 3531561762486025238), -INT64_C(  515931111517606261),  INT64_C( 1562250765523220113) },
+      {  INT64_C(                   0),  INT64_C(                   0), -INT64_C(  515931111517606261),  INT64_C( 1562250765523220113) } },
+    { UINT8_C( 39),
+      { -INT64_C( 2122934428886007093), -INT64_C( 6789460229534619475), -INT64_C( 5708504356457975378),  INT64_C( 9217955743005760293) },
+      { -INT64_C(  766306193244657465),  INT64_C( 5891408208514617376), -INT64_C( 5304577955907771183), -INT64_C( 4727456649630144199) },
+      { -INT64_C(  766306193244657465),  INT64_C( 5891408208514617376), -INT64_C( 5304577955907771183),  INT64_C(                   0) } },
+    { UINT8_C( 69),
+      {  INT64_C( 1099316899315428507),  INT64_C( 2509622518116511893), -INT64_C( 9187809326111583764), -INT64_C( 6876660185418757305) },
+      { -INT64_C( 3436223702288301450),  INT64_C( 3278524578083405013),  INT64_C( 8626143969676785807),  INT64_C(  224018906734129333) },
+      { -INT64_C( 3436223702288301450),  INT64_C(                   0),  INT64_C( 8626143969676785807),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i r = simde_mm256_maskz_alignr_epi64(test_vec[i].k, a, b, INT32_C(  4));
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_alignr_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t b[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { { -INT64_C( 6344781155611037001),  INT64_C( 1449601512424778224), -INT64_C( 6496340877269072428),  INT64_C( 3008406810238183390),
+        -INT64_C(  128334720301476553), -INT64_C( 1395589836284465967),  INT64_C( 8641416012881651487), -INT64_C( 6415030745509802835) },
+      {  INT64_C( 7014098653250807133),  INT64_C( 7703366150073752813), -INT64_C( 8457203316201364394), -INT64_C( 4921819775706750805),
+        -INT64_C( 5037706948305593306), -INT64_C( 1799340402446928131),  INT64_C( 2030596763378736592),  INT64_C( 3041155416677168646) },
+      { -INT64_C( 5037706948305593306), -INT64_C( 1799340402446928131),  INT64_C( 2030596763378736592),  INT64_C( 3041155416677168646),
+        -INT64_C( 6344781155611037001),  INT64_C( 1449601512424778224), -INT64_C( 6496340877269072428),  INT64_C( 3008406810238183390) } },
+    { {  INT64_C( 7301944726339916559), -INT64_C( 1242686496827118431),  INT64_C( 6162718712153082497), -INT64_C(  415957966222858983),
+        -INT64_C( 1771152088002479971),  INT64_C( 8215172703428552704),  INT64_C( 3814984755293683836), -INT64_C( 3719215054388453290) },
+      { -INT64_C( 8072099201588996827),  INT64_C( 3348650447053802070), -INT64_C( 5229456367512275488),  INT64_C( 3183616828995229168),
+        -INT64_C( 5517557753090427820), -INT64_C( 1912980707727325746), -INT64_C( 5246215964872166310),  INT64_C(   32861903564958222) },
+      { -INT64_C( 5517557753090427820), -INT64_C( 1912980707727325746), -INT64_C( 5246215964872166310),  INT64_C(   32861903564958222),
+         INT64_C( 7301944726339916559), -INT64_C( 1242686496827118431),  INT64_C( 6162718712153082497), -INT64_C(  415957966222858983) } },
+    { { -INT64_C(    4966562802020705),  INT64_C(  139106150064155090), -INT64_C( 6822052151872176965), -INT64_C( 6708891123044265514),
+         INT64_C( 7132449041132409073), -INT64_C( 2386933843739236470), -INT64_C( 5488733411654443187),  INT64_C( 8859653662985896878) },
+      {  INT64_C( 4379609567897705034), -INT64_C( 6371848172801417756), -INT64_C( 4729132425340347446), -INT64_C( 6832130499588040919),
+        -INT64_C( 4820197599395622410), -INT64_C( 1521706264549291922),  INT64_C( 1039939583757824815),  INT64_C( 1943055881089670068) },
+      { -INT64_C( 4820197599395622410), -INT64_C( 1521706264549291922),  INT64_C( 1039939583757824815),  INT64_C( 1943055881089670068),
+        -INT64_C(    4966562802020705),  INT64_C(  139106150064155090), -INT64_C( 6822052151872176965), -INT64_C( 6708891123044265514) } },
+    { { -INT64_C( 3417745173516224831), -INT64_C( 6204091987397756663),  INT64_C( 4125732831892445710), -INT64_C( 4980443905005948275),
+         INT64_C( 5750806402551312681), -INT64_C( 4617862953352241403), -INT64_C( 4000317063453449648),  INT64_C( 3863168573961982295) },
+      {  INT64_C( 4295022051093269695),  INT64_C(  895364655726951209),  INT64_C( 7037583815478998640), -INT64_C( 1417879694777182413),
+         INT64_C(  623704947865965723),  INT64_C( 1878183212439007700), -INT64_C( 7837052886456913450),  INT64_C( 4594886432123823536) },
+      {  INT64_C(  623704947865965723),  INT64_C( 1878183212439007700), -INT64_C( 7837052886456913450),  INT64_C( 4594886432123823536),
+        -INT64_C( 3417745173516224831), -INT64_C( 6204091987397756663),  INT64_C( 4125732831892445710), -INT64_C( 4980443905005948275) } },
+    { {  INT64_C( 7019185065466933919),  INT64_C( 4422502824086359179), -INT64_C( 7930717900913859287), -INT64_C( 4132092015106527772),
+        -INT64_C(  953219457302161755), -INT64_C(  289808936355333445), -INT64_C( 1592345780777552486), -INT64_C( 6951861820592168964) },
+      {  INT64_C( 7457332431991157202),  INT64_C( 4674092110233495807),  INT64_C(  153694834118226478),  INT64_C( 8762450866401748910),
+         INT64_C( 6296365521312862533), -INT64_C( 8963219927540207351),  INT64_C( 5733742682518429280), -INT64_C( 4650694900085369561) },
+      {  INT64_C( 6296365521312862533), -INT64_C( 8963219927540207351),  INT64_C( 5733742682518429280), -INT64_C( 4650694900085369561),
+         INT64_C( 7019185065466933919),  INT64_C( 4422502824086359179), -INT64_C( 7930717900913859287), -INT64_C( 4132092015106527772) } },
+    { { -INT64_C( 6521459488580412820),  INT64_C( 7476212289235680758), -INT64_C( 4130937068067862897), -INT64_C( 2575907663260476633),
+         INT64_C( 6183066085416910007),  INT64_C(  327475542863881369), -INT64_C(  843208150226774114), -INT64_C( 4409240462692800659) },
+      {  INT64_C( 1786017144679376149),  INT64_C( 8949812114644185590),  INT64_C( 1629513324447461826),  INT64_C(  552444487154776668),
+         INT64_C( 2181696654349617503),  INT64_C( 2332392215290124172),  INT64_C( 8878026155186095604),  INT64_C( 4002160096596084427) },
+      {  INT64_C( 2181696654349617503),  INT64_C( 2332392215290124172),  INT64_C( 8878026155186095604),  INT64_C( 4002160096596084427),
+        -INT64_C( 6521459488580412820),  INT64_C( 7476212289235680758), -INT64_C( 4130937068067862897), -INT64_C( 2575907663260476633) } },
+    { { -INT64_C( 7030624424026048791),  INT64_C( 1743723589532203843),  INT64_C( 6538074439584819778), -INT64_C( 3732221660674650624),
+         INT64_C( 1962417580971734317), -INT64_C( 6659059801920469149),  INT64_C( 2768205064176046986), -INT64_C( 7326159657422632058) },
+      {  INT64_C( 3537503216911529157),  INT64_C( 7727389361000570063),  INT64_C( 9092774299979067601),  INT64_C( 4943676797037728344),
+        -INT64_C( 3085587998656053144), -INT64_C( 8737177108594621970),  INT64_C( 2959344789781987023), -INT64_C( 1756687999475863275) },
+      { -INT64_C( 3085587998656053144), -INT64_C( 8737177108594621970),  INT64_C( 2959344789781987023), -INT64_C( 1756687999475863275),
+        -INT64_C( 7030624424026048791),  INT64_C( 1743723589532203843),  INT64_C( 6538074439584819778), -INT64_C( 3732221660674650624) } },
+    { { -INT64_C( 4240164880274913469), -INT64_C( 6303916989485618248), -INT64_C( 8318249536924997879),  INT64_C( 8513659076331439281),
+        -INT64_C( 2494141055624271856), -INT64_C( 3989741910065953674),  INT64_C( 3242336241591806627), -INT64_C( 3977418023713023596) },
+      { -INT64_C( 5694360879181416137), -INT64_C( 2017020628268881779),  INT64_C( 1268587213068490577),  INT64_C( 6712013585777214287),
+         INT64_C( 1017255488536052945),  INT64_C( 3815075393933869992),  INT64_C( 8934265631212528620),  INT64_C( 6275563098989464339) },
+      {  INT64_C( 1017255488536052945),  INT64_C( 3815075393933869992),  INT64_C( 8934265631212528620),  INT64_C( 6275563098989464339),
+        -INT64_C( 4240164880274913469), -INT64_C( 6303916989485618248), -INT64_C( 8318249536924997879),  INT64_C( 8513659076331439281) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i r = simde_mm512_alignr_epi64(a, b, INT32_C(  4));
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_alignr_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[8];
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t b[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { {  INT64_C( 4858709455571299101), -INT64_C( 7182513630652706477), -INT64_C(  491025771162972369), -INT64_C( 3740236783384325710),
+        -INT64_C( 6626306874184574295),  INT64_C(  620369591683928785),  INT64_C( 8872374745223207322),  INT64_C( 2685646227196488925) },
+      UINT8_C(178),
+      { -INT64_C( 3211642463524439289),  INT64_C( 9142133248226684332), -INT64_C( 4802070612182073238), -INT64_C( 6656052932290053646),
+         INT64_C( 9129811290519514130), -INT64_C( 6970542554514962936), -INT64_C( 3910578182193657258),  INT64_C( 6908069371202779214) },
+      { -INT64_C( 5661861100941373271),  INT64_C( 3996311960425037890), -INT64_C( 2589317163746417835), -INT64_C( 5438356765532541601),
+        -INT64_C( 4078796933107338475), -INT64_C( 8761493965855567472), -INT64_C( 3244924669474775859),  INT64_C(  132508417422428467) },
+      {  INT64_C( 4858709455571299101), -INT64_C( 3244924669474775859), -INT64_C(  491025771162972369), -INT64_C( 3740236783384325710),
+         INT64_C( 9142133248226684332), -INT64_C( 4802070612182073238),  INT64_C( 8872374745223207322),  INT64_C( 9129811290519514130) } },
+    { {  INT64_C( 5537107709749844741),  INT64_C( 4147489188861086632), -INT64_C( 8385114354439435583), -INT64_C( 6373596028313061908),
+        -INT64_C( 6574290342371454588),  INT64_C( 3840815554204855047), -INT64_C( 1142712574643471073),  INT64_C( 2962063983290907357) },
+      UINT8_C( 49),
+      { -INT64_C( 2426099460452979393), -INT64_C( 7129419190423375109), -INT64_C( 2248523206636770942), -INT64_C( 4437024661717529911),
+        -INT64_C( 5637843903696218893),  INT64_C( 4712873704309241366),  INT64_C(  949495418789545149), -INT64_C( 9114490202543684809) },
+      { -INT64_C( 7058658182006485592),  INT64_C(  717308917894592217), -INT64_C( 6247666010486994777), -INT64_C( 8304656451353616404),
+        -INT64_C(  101932597840053103),  INT64_C( 8937457474368296073), -INT64_C( 5814236680589575260),  INT64_C( 6334886907949170078) },
+      {  INT64_C( 8937457474368296073),  INT64_C( 4147489188861086632), -INT64_C( 8385114354439435583), -INT64_C( 6373596028313061908),
+        -INT64_C( 7129419190423375109), -INT64_C( 2248523206636770942), -INT64_C( 1142712574643471073),  INT64_C( 2962063983290907357) } },
+    { { -INT64_C(  166391946946586271), -INT64_C( 6605089240437356980), -INT64_C( 4625597969265820957),  INT64_C( 7834319125133340562),
+        -INT64_C( 7446946340544687590),  INT64_C( 3558908483473508059),  INT64_C( 5054837972225758355), -INT64_C( 4167249117578507668) },
+      UINT8_C(200),
+      {  INT64_C( 2222492201667316515), -INT64_C( 8906220551275535280),  INT64_C( 7819311280565154459), -INT64_C( 4391611493373268006),
+         INT64_C(  522905939534788188),  INT64_C( 3213711400452296041),  INT64_C( 1443114593078281136), -INT64_C( 3668234583909737956) },
+      { -INT64_C( 5773572912743228466), -INT64_C( 8684144168354755656),  INT64_C( 4279866027180854144), -INT64_C(  639044454458420479),
+        -INT64_C( 4338436283981418052), -INT64_C( 8265396874153527206),  INT64_C( 4863254945549574544), -INT64_C( 4252615851381571309) },
+      { -INT64_C(  166391946946586271), -INT64_C( 6605089240437356980), -INT64_C( 4625597969265820957),  INT64_C( 2222492201667316515),
+        -INT64_C( 7446946340544687590),  INT64_C( 3558908483473508059), -INT64_C( 4391611493373268006),  INT64_C(  522905939534788188) } },
+    { { -INT64_C( 3298161512778201369),  INT64_C( 3241319920741894879), -INT64_C( 3820866537809369068), -INT64_C( 6247652833271903081),
+        -INT64_C( 6766530413680967688), -INT64_C( 6260064250398356849),  INT64_C( 8612216955197824036), -INT64_C( 7296499862874688751) },
+      UINT8_C(224),
+      {  INT64_C( 7861534882576937297),  INT64_C( 5719960036784639299),  INT64_C( 7838806664618705653), -INT64_C( 7854489180303344152),
+         INT64_C( 2093916369216411967),  INT64_C( 3159430658470826679), -INT64_C( 7918423177265888941),  INT64_C( 6488005310091344533) },
+      { -INT64_C( 8698221022171319326), -INT64_C(  414847419834972566), -INT64_C(  689954771660803923),  INT64_C( 7285462454651729025),
+        -INT64_C( 8525189921544939213), -INT64_C( 3117171660553752162), -INT64_C( 3422183348026668165),  INT64_C( 8943709661588320577) },
+      { -INT64_C( 3298161512778201369),  INT64_C( 3241319920741894879), -INT64_C( 3820866537809369068), -INT64_C( 6247652833271903081),
+        -INT64_C( 6766530413680967688),  INT64_C( 7838806664618705653), -INT64_C( 7854489180303344152),  INT64_C( 2093916369216411967) } },
+    { { -INT64_C( 1210593618706780222), -INT64_C( 1898619888174191738), -INT64_C(  953243961456471528), -INT64_C(   61376168897818921),
+         INT64_C( 3515547907410406306),  INT64_C( 8856712848757155836), -INT64_C( 3213898077869792872),  INT64_C( 7190648180720386636) },
+      UINT8_C(241),
+      {  INT64_C( 5527582465036765409), -INT64_C( 4462352751641211376),  INT64_C( 6939735948926476077), -INT64_C( 2046747413046313486),
+         INT64_C( 4525460404309602358), -INT64_C( 5348534572569598416), -INT64_C( 3700966532944351680),  INT64_C( 8539217503310184163) },
+      { -INT64_C( 3341994322803107428),  INT64_C(  400382797447171178),  INT64_C( 3697868473471681837), -INT64_C( 6238102795043925217),
+        -INT64_C( 1297511630096030640),  INT64_C( 2724295009648182198),  INT64_C(  107270127050327865), -INT64_C( 7512969727438988089) },
+      {  INT64_C( 2724295009648182198), -INT64_C( 1898619888174191738), -INT64_C(  953243961456471528), -INT64_C(   61376168897818921),
+        -INT64_C( 4462352751641211376),  INT64_C( 6939735948926476077), -INT64_C( 2046747413046313486),  INT64_C( 4525460404309602358) } },
+    { { -INT64_C( 8615177213357220661), -INT64_C( 4132658963238183125), -INT64_C( 6775612413969141061),  INT64_C( 5303785842825649778),
+        -INT64_C( 8706710486704278715),  INT64_C( 9046725432341688912), -INT64_C( 7456406003209179415), -INT64_C( 6510462371285123233) },
+      UINT8_C(220),
+      {  INT64_C( 4637661772869302874), -INT64_C( 4384434702405972940), -INT64_C( 1260638475545084838),  INT64_C( 4879767465877889407),
+        -INT64_C(  705839793011460301),  INT64_C( 3189806755908161787), -INT64_C( 4784288394429779490), -INT64_C( 3188366487747686806) },
+      {  INT64_C( 5542232308589031988),  INT64_C( 5776030356431422992), -INT64_C( 6430619028605472712), -INT64_C( 8852562737920867639),
+         INT64_C( 2380507930434580010),  INT64_C( 8409339948160811349),  INT64_C( 5483820841883838944), -INT64_C(  347451241884071438) },
+      { -INT64_C( 8615177213357220661), -INT64_C( 4132658963238183125), -INT64_C(  347451241884071438),  INT64_C( 4637661772869302874),
+        -INT64_C( 4384434702405972940),  INT64_C( 9046725432341688912),  INT64_C( 4879767465877889407), -INT64_C(  705839793011460301) } },
+    { { -INT64_C( 3901100650211840918),  INT64_C(  557014090938918352), -INT64_C( 6012923091948680495),  INT64_C( 6343517426573331309),
+         INT64_C( 4145822496412732812), -INT64_C( 2401042569508023645), -INT64_C( 3012861327301413639),  INT64_C( 7369227992488973483) },
+      UINT8_C(116),
+      {  INT64_C( 5820092304872703016),  INT64_C(   83122968206582742), -INT64_C( 3520772390638498513), -INT64_C( 8825867640102482834),
+         INT64_C( 8551163762018078242), -INT64_C( 4548789709480984586), -INT64_C( 2854528710065814273),  INT64_C(  260860779322535563) },
+      {  INT64_C( 2674959383819281665), -INT64_C( 4133907442861199167),  INT64_C( 3018147706292770509),  INT64_C( 9203165731548205939),
+        -INT64_C( 8236849316410869423),  INT64_C( 5026236753020184680),  INT64_C(  521180262296894729),  INT64_C( 6355954722370955581) },
+      { -INT64_C( 3901100650211840918),  INT64_C(  557014090938918352),  INT64_C( 6355954722370955581),  INT64_C( 6343517426573331309),
+         INT64_C(   83122968206582742), -INT64_C( 3520772390638498513), -INT64_C( 8825867640102482834),  INT64_C( 7369227992488973483) } },
+    { {  INT64_C( 3766328635466230607),  INT64_C(   68029599113511026),  INT64_C(  887481265789000608),  INT64_C( 2158454230955745918),
+        -INT64_C( 4995878419730588405), -INT64_C( 4384953430728960151), -INT64_C( 3513431757459929058), -INT64_C( 2127791095532416526) },
+      UINT8_C( 37),
+      {  INT64_C(  344402632621933707),  INT64_C( 4019586285579579792), -INT64_C( 3756919805077905163),  INT64_C( 4568127162752266626),
+         INT64_C( 7126702072227001143), -INT64_C( 7891990654381484476),  INT64_C( 8790173089449054077), -INT64_C( 7280197759697445139) },
+      { -INT64_C( 3681138444314866015),  INT64_C(  345421600892615543), -INT64_C( 6815096299331779474), -INT64_C( 6141975860536016846),
+        -INT64_C( 6466972106324155657), -INT64_C( 7195934762001719001), -INT64_C(  337300776171675825),  INT64_C(   69218656902114800) },
+      { -INT64_C( 7195934762001719001),  INT64_C(   68029599113511026),  INT64_C(   69218656902114800),  INT64_C( 2158454230955745918),
+        -INT64_C( 4995878419730588405), -INT64_C( 3756919805077905163), -INT64_C( 3513431757459929058), -INT64_C( 2127791095532416526) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi64(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i r = simde_mm512_mask_alignr_epi64(src, test_vec[i].k, a, b, INT32_C(  5));
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_alignr_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t b[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { UINT8_C( 90),
+      {  INT64_C( 5331158778781126666),  INT64_C( 1322513621075470063), -INT64_C( 6340866187692720596),  INT64_C( 8789380416419805865),
+        -INT64_C( 7737218990892073139), -INT64_C( 5822148431996045481),  INT64_C(   49279492456038982),  INT64_C( 4348817265208201742) },
+      {  INT64_C( 6285203126554929072),  INT64_C( 1408689396465781979), -INT64_C( 4845408809051915399),  INT64_C( 7961517028255790893),
+        -INT64_C( 4855720576061971488), -INT64_C( 3669479764840892049), -INT64_C( 1655115839841480102),  INT64_C( 3687179082235801094) },
+      {  INT64_C(                   0),  INT64_C( 3687179082235801094),  INT64_C(                   0),  INT64_C( 1322513621075470063),
+        -INT64_C( 6340866187692720596),  INT64_C(                   0), -INT64_C( 7737218990892073139),  INT64_C(                   0) } },
+    { UINT8_C(214),
+      {  INT64_C( 8314166545876128949),  INT64_C( 3837356796636749589),  INT64_C( 3406905046483197115),  INT64_C( 5674934661704384357),
+         INT64_C( 1560169385807692832),  INT64_C( 5797274972704414561), -INT64_C( 6401408797551583334),  INT64_C( 9088476942723058738) },
+      {  INT64_C( 5720985339012534214),  INT64_C( 2335182758250879319), -INT64_C(  930774984355938404), -INT64_C(  348492174779542102),
+         INT64_C( 6579170392018744782),  INT64_C( 8841089801065751713),  INT64_C( 8476943192135870850), -INT64_C( 3849113294011235675) },
+      {  INT64_C(                   0), -INT64_C( 3849113294011235675),  INT64_C( 8314166545876128949),  INT64_C(                   0),
+         INT64_C( 3406905046483197115),  INT64_C(                   0),  INT64_C( 1560169385807692832),  INT64_C( 5797274972704414561) } },
+    { UINT8_C(239),
+      {  INT64_C( 7073559224354699744),  INT64_C( 3289970194965025256), -INT64_C( 5731887389058704589),  INT64_C( 3556030315861316401),
+         INT64_C( 3687103579200192187), -INT64_C( 3698649008809589513),  INT64_C( 7892596425352102703),  INT64_C( 1669613677769690433) },
+      { -INT64_C( 5289667226511423119),  INT64_C( 9129214106028749967), -INT64_C( 1894161741899258316),  INT64_C( 5553342092921796700),
+         INT64_C( 3051189016600085199), -INT64_C( 1989897919283946024),  INT64_C( 6553092838969407237),  INT64_C( 6246857672493343326) },
+      {  INT64_C( 6553092838969407237),  INT64_C( 6246857672493343326),  INT64_C( 7073559224354699744),  INT64_C( 3289970194965025256),
+         INT64_C(                   0),  INT64_C( 3556030315861316401),  INT64_C( 3687103579200192187), -INT64_C( 3698649008809589513) } },
+    { UINT8_C(194),
+      {  INT64_C( 6676413847770928387), -INT64_C( 5472727237609775616), -INT64_C( 6475917571221803697),  INT64_C( 8564136291645786795),
+        -INT64_C( 1089002907010943082), -INT64_C( 4768624914902642359), -INT64_C( 1138730690920734714),  INT64_C( 2725874610079045891) },
+      {  INT64_C( 8865253239874900675),  INT64_C(  313000945632932521),  INT64_C( 9201647426372872778), -INT64_C( 8764561218953217765),
+        -INT64_C( 8914834806815146211), -INT64_C( 4025551382229698845), -INT64_C( 7719851085301936925), -INT64_C( 1465154882109859189) },
+      {  INT64_C(                   0), -INT64_C( 1465154882109859189),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0), -INT64_C( 1089002907010943082), -INT64_C( 4768624914902642359) } },
+    { UINT8_C( 72),
+      {  INT64_C( 2263032700800268746),  INT64_C( 2042471075302070981),  INT64_C( 5764161519226782112),  INT64_C( 1195476349456855253),
+        -INT64_C( 6819137480172181570), -INT64_C( 2303995930554940832), -INT64_C( 8400023285435207971),  INT64_C( 3195308552625426968) },
+      {  INT64_C(  168490637666076102), -INT64_C( 1509891058950569034), -INT64_C( 2614190990605389202), -INT64_C( 8226316614200216046),
+        -INT64_C( 7423274112297203614), -INT64_C( 7583736854300210543), -INT64_C(  302720212559400635), -INT64_C( 7756608584923552828) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 2042471075302070981),
+         INT64_C(                   0),  INT64_C(                   0), -INT64_C( 6819137480172181570),  INT64_C(                   0) } },
+    { UINT8_C(244),
+      {  INT64_C( 2232092955935917703), -INT64_C( 8793630464639942770), -INT64_C( 2919058958754926994), -INT64_C(  591436694443283960),
+         INT64_C( 8265026699428338776), -INT64_C( 1851347725093634666), -INT64_C( 7430508375188261037), -INT64_C( 5109010743935976105) },
+      {  INT64_C( 8687801536209351700),  INT64_C( 1791062106984990642),  INT64_C( 8504633984884201924),  INT64_C( 3881805962158382138),
+        -INT64_C( 3277526543018026751),  INT64_C( 3345059999083932833), -INT64_C( 7870242861412039758),  INT64_C( 7479548331754468715) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 2232092955935917703),  INT64_C(                   0),
+        -INT64_C( 2919058958754926994), -INT64_C(  591436694443283960),  INT64_C( 8265026699428338776), -INT64_C( 1851347725093634666) } },
+    { UINT8_C(175),
+      {  INT64_C( 8628426528281020342),  INT64_C( 2396893551876137665),  INT64_C( 5566197903900843887),  INT64_C( 1408558883249261401),
+        -INT64_C( 7012779211391164097), -INT64_C( 3597556321185011577), -INT64_C( 8958152193619197599),  INT64_C( 6808394360693084754) },
+      {  INT64_C(  569948892128081016),  INT64_C( 4272030818650242397), -INT64_C( 8779069602023913215), -INT64_C( 3031332056417977141),
+         INT64_C( 6287982844963732018),  INT64_C( 7168938078938773789), -INT64_C( 1538753721501617517),  INT64_C( 3960143232388881255) },
+      { -INT64_C( 1538753721501617517),  INT64_C( 3960143232388881255),  INT64_C( 8628426528281020342),  INT64_C( 2396893551876137665),
+         INT64_C(                   0),  INT64_C( 1408558883249261401),  INT64_C(                   0), -INT64_C( 3597556321185011577) } },
+    { UINT8_C(210),
+      { -INT64_C( 5232270793863599913),  INT64_C( 4150856156922213368), -INT64_C(   86864203607260907), -INT64_C( 4295722275245647185),
+        -INT64_C( 6886480307658871987), -INT64_C( 7664501842834347269),  INT64_C( 5314987805268494926), -INT64_C( 5404581559648483015) },
+      {  INT64_C( 2450773278007486623),  INT64_C( 5110398586934253596), -INT64_C( 3181119591495555176),  INT64_C( 1931350117613534668),
+         INT64_C(   33408941352033860), -INT64_C( 7489485875949333418), -INT64_C( 7928928733924349181),  INT64_C( 1601220019879837278) },
+      {  INT64_C(                   0),  INT64_C( 1601220019879837278),  INT64_C(                   0),  INT64_C(                   0),
+        -INT64_C(   86864203607260907),  INT64_C(                   0), -INT64_C( 6886480307658871987), -INT64_C( 7664501842834347269) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i r = simde_mm512_maskz_alignr_epi64(test_vec[i].k, a, b, INT32_C(  6));
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_alignr_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_alignr_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_alignr_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_alignr_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_alignr_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_alignr_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_alignr_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_alignr_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_alignr_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_alignr_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_alignr_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_alignr_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_alignr_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_alignr_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_alignr_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_alignr_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_alignr_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_alignr_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_alignr_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_alignr_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_alignr_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_alignr_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_alignr_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_alignr_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_alignr_epi64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
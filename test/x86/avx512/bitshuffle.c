@@ -0,0 +1,520 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN bitshuffle
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/bitshuffle.h>
+
+static int
+test_simde_mm_bitshuffle_epi64_mask (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t b[2];
+    const int8_t c[16];
+    const simde__mmask16 r;
+  } test_vec[] = {
+    { {  INT64_C( 1111774212763596768),  INT64_C(  774562127019627737) },
+      {  INT8_C(  24), -INT8_C(  26),  INT8_C( 111), -INT8_C(  91), -INT8_C(  38), -INT8_C( 111),  INT8_C(  72),  INT8_C(  54),
+         INT8_C(  44),  INT8_C(  90), -INT8_C(  58), -INT8_C(  31), -INT8_C(  52),  INT8_C(  23),  INT8_C(  53), -INT8_C( 127) },
+      UINT16_C(24310) },
+    { {  INT64_C( 3052012373982269719),  INT64_C( 9181595509829090266) },
+      { -INT8_C(  74),  INT8_C(  41),  INT8_C( 127), -INT8_C(  81),  INT8_C(  12),  INT8_C(  42),  INT8_C(  28),  INT8_C(  70),
+        -INT8_C( 110), -INT8_C(  15), -INT8_C(  26), -INT8_C( 121), -INT8_C(  84), -INT8_C(  43), -INT8_C(  32), -INT8_C(  63) },
+      UINT16_C(49017) },
+    { {  INT64_C( 1180022833417355535), -INT64_C( 6836486103874803612) },
+      { -INT8_C( 106), -INT8_C(  61), -INT8_C(  58), -INT8_C(  17), -INT8_C(  40), -INT8_C( 101),  INT8_C(  32), -INT8_C(  36),
+         INT8_C(  37),  INT8_C(   1), -INT8_C(  83),  INT8_C(  16), -INT8_C(  56), -INT8_C(  95),  INT8_C(  90), -INT8_C(  14) },
+      UINT16_C(36034) },
+    { {  INT64_C(  207691150705921239), -INT64_C( 6485620680639261086) },
+      {  INT8_C(  81),  INT8_C(  51), -INT8_C(  35),  INT8_C(  66), -INT8_C(  16), -INT8_C(  85),  INT8_C(   8), -INT8_C(  12),
+        -INT8_C(  51), -INT8_C(  26),  INT8_C(  55), -INT8_C( 111), -INT8_C(  22), -INT8_C( 119),  INT8_C(  76), -INT8_C(  10) },
+      UINT16_C(58936) },
+    { { -INT64_C( 6428929349571057525),  INT64_C( 2748438618756902093) },
+      { -INT8_C(  66), -INT8_C(  39),  INT8_C(  46), -INT8_C( 112), -INT8_C(  83), -INT8_C(  76), -INT8_C(  91), -INT8_C(  44),
+         INT8_C(  13), -INT8_C(  97), -INT8_C(  98),  INT8_C(  53), -INT8_C( 107),  INT8_C(  78),  INT8_C( 108),  INT8_C(   0) },
+      UINT16_C(48012) },
+    { { -INT64_C(  329437580166045164), -INT64_C( 2115576226229591120) },
+      {  INT8_C( 122), -INT8_C( 108), -INT8_C( 103), -INT8_C(  38), -INT8_C(  59), -INT8_C(  26), -INT8_C( 115),  INT8_C(  78),
+         INT8_C(  84),  INT8_C(  90), -INT8_C(  32), -INT8_C(  87), -INT8_C(  24),  INT8_C(  11), -INT8_C(  39),  INT8_C(  40) },
+      UINT16_C( 4068) },
+    { {  INT64_C( 8505291681267553477), -INT64_C( 7638074022957459482) },
+      { -INT8_C( 119),  INT8_C(  26),  INT8_C(  30), -INT8_C(   4), -INT8_C(  23), -INT8_C(  58),  INT8_C(  97), -INT8_C( 109),
+         INT8_C( 100), -INT8_C(  52),  INT8_C(  67), -INT8_C(   5), -INT8_C( 124),  INT8_C(  13), -INT8_C( 103), -INT8_C(  54) },
+      UINT16_C(33450) },
+    { {  INT64_C( 2133693371766319431),  INT64_C( 7404827835119688347) },
+      { -INT8_C(  82),  INT8_C(  77), -INT8_C(  55), -INT8_C(  70), -INT8_C(  31),  INT8_C(  26), -INT8_C(  34),  INT8_C( 127),
+        -INT8_C(   7),  INT8_C(  10),  INT8_C( 124),  INT8_C( 106), -INT8_C(  48),  INT8_C(  57),  INT8_C(  55), -INT8_C(  41) },
+      UINT16_C(28939) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi8(test_vec[i].c);
+    simde__mmask16 r = simde_mm_bitshuffle_epi64_mask(b, c);
+    simde_assert_equal_u16(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_bitshuffle_epi64_mask (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int64_t b[2];
+    const int8_t c[16];
+    const simde__mmask16 r;
+  } test_vec[] = {
+    { UINT16_C(16102),
+      {  INT64_C( 6017066056671618331),  INT64_C( 8953916399126577847) },
+      { -INT8_C(  33),  INT8_C(  90),  INT8_C(  36),  INT8_C( 118), -INT8_C(  60), -INT8_C(  27),  INT8_C(  50),  INT8_C(  94),
+         INT8_C(  94), -INT8_C(  72),  INT8_C( 103),  INT8_C(  93), -INT8_C(  43),  INT8_C( 110), -INT8_C(  60), -INT8_C(  71) },
+      UINT16_C( 7332) },
+    { UINT16_C(61136),
+      {  INT64_C(   43128377324526349), -INT64_C( 7397865840688085412) },
+      {  INT8_C(  17), -INT8_C( 127),  INT8_C(  10),  INT8_C(  48),  INT8_C( 112),  INT8_C(   8),  INT8_C(  60), -INT8_C(  64),
+        -INT8_C(   9),  INT8_C(  86),  INT8_C( 102), -INT8_C(  46), -INT8_C( 109),  INT8_C( 122),  INT8_C(  30),  INT8_C(  54) },
+      UINT16_C(33424) },
+    { UINT16_C(35210),
+      { -INT64_C( 8925312663871868647), -INT64_C( 3764441766483382451) },
+      {  INT8_C(  55), -INT8_C(  67),  INT8_C(  54),  INT8_C(  54),  INT8_C(  88),  INT8_C(  76), -INT8_C(  74),  INT8_C(   1),
+         INT8_C(  89), -INT8_C(  37), -INT8_C(  10), -INT8_C(  23),  INT8_C(  14),  INT8_C( 110), -INT8_C(  64),  INT8_C(  17) },
+      UINT16_C(  256) },
+    { UINT16_C(28647),
+      {  INT64_C( 7811493694730962424),  INT64_C( 8959938036559887396) },
+      {  INT8_C(  73), -INT8_C(  75), -INT8_C(  48),  INT8_C(  63), -INT8_C(  21), -INT8_C( 116), -INT8_C(  87), -INT8_C(  22),
+        -INT8_C( 121), -INT8_C( 116),  INT8_C(  85), -INT8_C(  75),  INT8_C(  70),  INT8_C( 106),  INT8_C(  42),  INT8_C(  88) },
+      UINT16_C( 1538) },
+    { UINT16_C(55842),
+      { -INT64_C( 1876826281843748842), -INT64_C(  635077388872073622) },
+      {  INT8_C(  45), -INT8_C(  81), -INT8_C( 120),  INT8_C( 123),  INT8_C(  45), -INT8_C(  67),  INT8_C(  52),  INT8_C(  70),
+        -INT8_C(  42),  INT8_C(  81),  INT8_C( 115), -INT8_C(  59),  INT8_C(  54),  INT8_C(  48), -INT8_C( 106), -INT8_C(  35) },
+      UINT16_C(18464) },
+    { UINT16_C(41979),
+      {  INT64_C( 2586854339733635196),  INT64_C( 3897304796124053221) },
+      { -INT8_C(  18), -INT8_C(   7),  INT8_C(  42), -INT8_C(  38), -INT8_C(  47),  INT8_C( 116),      INT8_MIN, -INT8_C( 105),
+         INT8_C(   2),  INT8_C(  98), -INT8_C( 114),  INT8_C(   7), -INT8_C(   3),  INT8_C(  32),  INT8_C( 102), -INT8_C(  42) },
+      UINT16_C(33163) },
+    { UINT16_C(25468),
+      { -INT64_C( 5373520040059793478),  INT64_C( 3492802924175565824) },
+      {  INT8_C(  27),  INT8_C(  33), -INT8_C( 107),  INT8_C(  56),  INT8_C( 110),  INT8_C( 110),  INT8_C(  68), -INT8_C(  76),
+         INT8_C( 101),  INT8_C(  85), -INT8_C( 127),  INT8_C(  96),  INT8_C(   4),  INT8_C( 114),  INT8_C(  12), -INT8_C( 120) },
+      UINT16_C(  632) },
+    { UINT16_C(11034),
+      { -INT64_C( 8303729997058310196),  INT64_C(  980692047708291275) },
+      {  INT8_C(  33),  INT8_C(   5),  INT8_C(  65), -INT8_C(  87),  INT8_C(  88), -INT8_C(  80), -INT8_C(  33), -INT8_C(  96),
+         INT8_C(  23),  INT8_C(  99), -INT8_C(  19),  INT8_C( 114),  INT8_C(  62), -INT8_C(  86), -INT8_C(  23),  INT8_C(  96) },
+      UINT16_C(11008) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi8(test_vec[i].c);
+    simde__mmask16 r = simde_mm_mask_bitshuffle_epi64_mask(test_vec[i].k, b, c);
+    simde_assert_equal_u16(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_bitshuffle_epi64_mask (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t b[4];
+    const int8_t c[32];
+    const simde__mmask32 r;
+  } test_vec[] = {
+    { { -INT64_C( 1183074809763094339), -INT64_C( 3877957942004863064), -INT64_C( 3611151113218764499), -INT64_C( 8293577682913606656) },
+      {  INT8_C(  18), -INT8_C( 110),  INT8_C(  45), -INT8_C(  33),  INT8_C(  46),  INT8_C(  58),  INT8_C( 112), -INT8_C(  52),
+        -INT8_C(   3), -INT8_C( 114), -INT8_C(   3),  INT8_C(  64), -INT8_C(  14),  INT8_C( 109),  INT8_C(  59),  INT8_C( 105),
+         INT8_C(  39),  INT8_C( 111), -INT8_C(  39),  INT8_C(  56), -INT8_C(   4),  INT8_C(  13),  INT8_C( 111), -INT8_C(   9),
+        -INT8_C( 102),  INT8_C(  29),  INT8_C(  33),  INT8_C(  21),  INT8_C(  35), -INT8_C(  31), -INT8_C(   6),  INT8_C( 127) },
+      UINT32_C(3553521720) },
+    { { -INT64_C( 7409205058745806312),  INT64_C( 3971607721861515664),  INT64_C(  205449115725098163),  INT64_C( 8804058491907927436) },
+      { -INT8_C(  61),  INT8_C( 122), -INT8_C(  40), -INT8_C( 113),  INT8_C(  18), -INT8_C(  98), -INT8_C(  51),  INT8_C(  62),
+        -INT8_C( 114),  INT8_C(  57), -INT8_C(   5), -INT8_C( 114),  INT8_C( 101), -INT8_C(  89),  INT8_C(  62),  INT8_C(  16),
+        -INT8_C( 118),  INT8_C(  69),  INT8_C(  97), -INT8_C(  49), -INT8_C(  12),  INT8_C(  63),  INT8_C(  19),  INT8_C(  15),
+         INT8_C(   3),  INT8_C(  15), -INT8_C(  73),  INT8_C(  62),  INT8_C(  26),  INT8_C(  88),  INT8_C(  36), -INT8_C( 118) },
+      UINT32_C(3138621981) },
+    { {  INT64_C(  503021648763943105), -INT64_C( 4580134102560814992), -INT64_C( 6805830374386997913),  INT64_C( 3396584469544010352) },
+      { -INT8_C(  84),  INT8_C( 121),  INT8_C(   5), -INT8_C(  65), -INT8_C( 124),  INT8_C( 123),  INT8_C(   3), -INT8_C(  91),
+         INT8_C(  64),  INT8_C(   8), -INT8_C( 102),  INT8_C(  71), -INT8_C(  49), -INT8_C(  50),  INT8_C(  19), -INT8_C(  17),
+        -INT8_C( 120),  INT8_C( 103),  INT8_C(  49), -INT8_C( 127),  INT8_C(  64), -INT8_C( 112), -INT8_C(   9),  INT8_C(   4),
+         INT8_C( 102),  INT8_C(  88),  INT8_C( 120),  INT8_C(  32), -INT8_C(  30),  INT8_C(  61),  INT8_C(  91),  INT8_C( 101) },
+      UINT32_C( 880357379) },
+    { { -INT64_C( 8579438198084226927), -INT64_C( 7279667306255974063),  INT64_C( 7971308603945504901),  INT64_C( 3012464061409384960) },
+      { -INT8_C(  81),  INT8_C(  68),  INT8_C(  12), -INT8_C(  96), -INT8_C(   3), -INT8_C(  82),  INT8_C(  89),  INT8_C(  57),
+        -INT8_C( 115),  INT8_C(  54),  INT8_C(  48),  INT8_C(  56), -INT8_C(  16), -INT8_C(  67), -INT8_C(  96), -INT8_C(  25),
+         INT8_C(  16), -INT8_C(  80),  INT8_C(  63),  INT8_C( 105),  INT8_C(  45), -INT8_C(  35), -INT8_C(  28),  INT8_C(  33),
+         INT8_C( 125), -INT8_C(  59), -INT8_C(  80),  INT8_C(  23), -INT8_C(  51),  INT8_C(   6), -INT8_C(  60),  INT8_C( 123) },
+      UINT32_C(2303415879) },
+    { {  INT64_C( 3162828590298100013),  INT64_C( 3136952591529517767), -INT64_C( 4641276572250709713),  INT64_C( 8987218290218577352) },
+      {  INT8_C(  77), -INT8_C( 115), -INT8_C(  74), -INT8_C( 117), -INT8_C(  14), -INT8_C( 125),  INT8_C(  46), -INT8_C( 118),
+         INT8_C(  79), -INT8_C(  99),  INT8_C( 124),  INT8_C(  14), -INT8_C(  90), -INT8_C( 111), -INT8_C(  96), -INT8_C(   9),
+        -INT8_C(  40), -INT8_C(  97), -INT8_C( 122),  INT8_C(  15), -INT8_C(  87),  INT8_C( 110),  INT8_C(   2),  INT8_C(   4),
+        -INT8_C( 100),  INT8_C(  45),  INT8_C(   7), -INT8_C(  19), -INT8_C( 106), -INT8_C(  29), -INT8_C(  62),  INT8_C( 125) },
+      UINT32_C(3027284791) },
+    { { -INT64_C( 8893052320248134501),  INT64_C( 4891638384180058779),  INT64_C( 4581403470087417143),  INT64_C( 6297522578821270285) },
+      { -INT8_C(  75), -INT8_C(  12),  INT8_C(  15),  INT8_C( 115), -INT8_C(  23),  INT8_C(  74),  INT8_C(  72), -INT8_C(  24),
+         INT8_C( 119), -INT8_C(  75), -INT8_C(  98),  INT8_C(  29), -INT8_C(  81), -INT8_C(  54), -INT8_C(  59),  INT8_C(  48),
+        -INT8_C( 118), -INT8_C(  23), -INT8_C(   2),  INT8_C( 121), -INT8_C(  65), -INT8_C( 126),  INT8_C(  73),  INT8_C( 111),
+        -INT8_C( 117),  INT8_C(  90), -INT8_C(  28), -INT8_C(  95),  INT8_C(  58),  INT8_C(  68),  INT8_C(  66), -INT8_C(  74) },
+      UINT32_C(3643478822) },
+    { {  INT64_C( 5096890164765440791), -INT64_C( 4937666494229335642),  INT64_C( 1768758090487544422),  INT64_C( 8541063509039835588) },
+      {  INT8_C(  82), -INT8_C(  42), -INT8_C(  89), -INT8_C( 108),  INT8_C(  61), -INT8_C( 125),  INT8_C(  66),  INT8_C(  96),
+         INT8_C(  78),  INT8_C(  28), -INT8_C(  60),  INT8_C(  33), -INT8_C(  63), -INT8_C(  98),  INT8_C(   3),  INT8_C( 117),
+        -INT8_C(  99),  INT8_C( 122),  INT8_C(  48), -INT8_C(  44), -INT8_C( 111),  INT8_C(  52), -INT8_C( 110),  INT8_C( 107),
+        -INT8_C( 109), -INT8_C(  54), -INT8_C( 123), -INT8_C( 126), -INT8_C( 115),  INT8_C(  20),  INT8_C(  74), -INT8_C(  46) },
+      UINT32_C(3105722565) },
+    { {  INT64_C( 6767226289554209443), -INT64_C( 5581917308139739475),  INT64_C( 5773258132385668253),  INT64_C( 2214043164610185648) },
+      {  INT8_C(  60), -INT8_C( 122),  INT8_C(   1), -INT8_C( 117),  INT8_C(  92), -INT8_C(  64), -INT8_C( 107), -INT8_C( 126),
+        -INT8_C( 117), -INT8_C(  60),  INT8_C( 101),  INT8_C(  43),  INT8_C( 119), -INT8_C(  29), -INT8_C(  16), -INT8_C(  63),
+         INT8_C(  86), -INT8_C( 120), -INT8_C(  51), -INT8_C( 118), -INT8_C( 113), -INT8_C(  96), -INT8_C(  23),  INT8_C(  98),
+         INT8_C(   6),  INT8_C(  34),  INT8_C( 120),  INT8_C(  70), -INT8_C(  88),  INT8_C(  35),  INT8_C(  31),  INT8_C(   9) },
+      UINT32_C(  47806525) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi8(test_vec[i].c);
+    simde__mmask32 r = simde_mm256_bitshuffle_epi64_mask(b, c);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_bitshuffle_epi64_mask (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 k;
+    const int64_t b[4];
+    const int8_t c[32];
+    const simde__mmask32 r;
+  } test_vec[] = {
+    { UINT32_C(3611401929),
+      {  INT64_C( 6379685229653175220),  INT64_C( 2397533915617115580),  INT64_C( 4840619676488992067), -INT64_C( 6090044440102205209) },
+      { -INT8_C(  72), -INT8_C(  73),  INT8_C( 114), -INT8_C(  48), -INT8_C( 113),  INT8_C( 120),  INT8_C(  84), -INT8_C(  80),
+         INT8_C(  97),  INT8_C( 115), -INT8_C(  65), -INT8_C(  84),  INT8_C(  91),  INT8_C(  51), -INT8_C(   7), -INT8_C(  72),
+        -INT8_C(  45), -INT8_C(  84),  INT8_C(  11), -INT8_C(   5), -INT8_C( 118),  INT8_C(  31),  INT8_C(  93),  INT8_C(  13),
+        -INT8_C( 125),  INT8_C(  92),  INT8_C(  52),  INT8_C(  20),  INT8_C(  84),  INT8_C(  26), -INT8_C( 102), -INT8_C(  95) },
+      UINT32_C( 339771520) },
+    { UINT32_C(1357267271),
+      {  INT64_C( 5425526754587655429), -INT64_C( 3268633051610454885), -INT64_C(  761306863237707565),  INT64_C( 1212907892157157904) },
+      { -INT8_C(  65),  INT8_C(  22),      INT8_MIN, -INT8_C(  85),  INT8_C(  82),  INT8_C(  96), -INT8_C(   8),  INT8_C(  67),
+         INT8_C(   3), -INT8_C( 119), -INT8_C(  28),  INT8_C( 103),  INT8_C( 123),  INT8_C(  17),  INT8_C( 119),  INT8_C(  41),
+        -INT8_C(  25),  INT8_C( 122),  INT8_C( 124),  INT8_C(   6),  INT8_C(  96), -INT8_C(  90), -INT8_C(  29),  INT8_C( 126),
+        -INT8_C(  64),  INT8_C( 109), -INT8_C(  55),  INT8_C( 102),  INT8_C(  36),  INT8_C(  56),  INT8_C(   4), -INT8_C( 104) },
+      UINT32_C(1084637508) },
+    { UINT32_C(3012119749),
+      { -INT64_C( 2666960421115297252), -INT64_C( 8241465998348346535), -INT64_C(  301043573570935186), -INT64_C( 8807320283618344952) },
+      { -INT8_C(  23), -INT8_C(  22), -INT8_C(  43), -INT8_C(  78), -INT8_C(   7), -INT8_C(  20),  INT8_C(  69),  INT8_C(  19),
+        -INT8_C(  11), -INT8_C(  70), -INT8_C(  99), -INT8_C(  50), -INT8_C(  83), -INT8_C(   4),  INT8_C(  43),  INT8_C(  69),
+        -INT8_C(  25), -INT8_C(  20),  INT8_C(   5), -INT8_C(  71), -INT8_C( 110), -INT8_C( 121), -INT8_C( 108),  INT8_C(  15),
+         INT8_C(   7),  INT8_C(  73),  INT8_C( 117), -INT8_C(  81), -INT8_C(  94),  INT8_C(  67),  INT8_C(   9), -INT8_C(  57) },
+      UINT32_C( 814236676) },
+    { UINT32_C(3673521648),
+      {  INT64_C( 7743897900883713291),  INT64_C( 7769511779283560317),  INT64_C( 6360842290269149869), -INT64_C(  702964824018531802) },
+      {  INT8_C(  67), -INT8_C(  77), -INT8_C(  48),  INT8_C(  45),  INT8_C(  51),  INT8_C(  87),  INT8_C(  43),  INT8_C(  85),
+        -INT8_C(  57), -INT8_C(  80),  INT8_C(  11), -INT8_C(  25), -INT8_C(  26),  INT8_C( 121), -INT8_C(  57),  INT8_C(   2),
+        -INT8_C(  12),  INT8_C(  15),  INT8_C(  29), -INT8_C(  19),  INT8_C(  78),  INT8_C(  24), -INT8_C(  50),  INT8_C(  23),
+         INT8_C(  53), -INT8_C( 127),  INT8_C(  34),  INT8_C(  82),  INT8_C( 108), -INT8_C( 116), -INT8_C(  89),  INT8_C( 124) },
+      UINT32_C(2599434304) },
+    { UINT32_C(4169325594),
+      { -INT64_C( 9115955934185808862), -INT64_C( 4152689301426894448),  INT64_C( 8638471622758596845),  INT64_C( 4835497952779842799) },
+      { -INT8_C( 106),  INT8_C( 117),  INT8_C(  33),  INT8_C(  27), -INT8_C(  61),  INT8_C(  60),  INT8_C(  16),  INT8_C(  44),
+        -INT8_C(  96), -INT8_C(  73), -INT8_C(  66), -INT8_C(  19),  INT8_C(  52),  INT8_C(  16), -INT8_C(  80),  INT8_C( 105),
+         INT8_C(  83), -INT8_C(  27), -INT8_C(  92), -INT8_C(  39),  INT8_C(  92), -INT8_C(  56), -INT8_C(  11),  INT8_C( 124),
+         INT8_C(  70),  INT8_C(  28), -INT8_C(  14),  INT8_C(  21), -INT8_C(  15), -INT8_C(  56),  INT8_C(  21), -INT8_C( 117) },
+      UINT32_C( 276995074) },
+    { UINT32_C(  87921520),
+      {  INT64_C( 4865745110227861078), -INT64_C( 6009126679617242299), -INT64_C( 5855248041999893209), -INT64_C( 1013291706731317097) },
+      {  INT8_C( 102),  INT8_C( 120), -INT8_C(  60),  INT8_C(  21),  INT8_C( 125),  INT8_C(  47),  INT8_C( 127), -INT8_C(  37),
+        -INT8_C(  48), -INT8_C(  63), -INT8_C( 114),  INT8_C(  97),  INT8_C( 125),  INT8_C(  57),  INT8_C(  61), -INT8_C(  33),
+         INT8_C(  32),  INT8_C(  48), -INT8_C(  62),  INT8_C(  43),  INT8_C(   1),  INT8_C(   3), -INT8_C(  79),  INT8_C(  88),
+         INT8_C(  84),  INT8_C(  64),  INT8_C(  16),  INT8_C( 114), -INT8_C( 120), -INT8_C(  41), -INT8_C( 104), -INT8_C(  31) },
+      UINT32_C(   1904928) },
+    { UINT32_C(1594931230),
+      { -INT64_C( 6764925316463537170), -INT64_C( 4683206515203506533),  INT64_C( 8204569679326166472),  INT64_C(  866629718209908993) },
+      { -INT8_C( 110),  INT8_C( 119),  INT8_C(  23),  INT8_C(  19), -INT8_C( 101), -INT8_C(  20),  INT8_C(  63), -INT8_C(   7),
+        -INT8_C(  30), -INT8_C(  89), -INT8_C(  66),  INT8_C(  15),  INT8_C(  63),  INT8_C( 101),  INT8_C(  97), -INT8_C(  39),
+         INT8_C(  70), -INT8_C(  34), -INT8_C( 111),  INT8_C( 106), -INT8_C(  80), -INT8_C(  45),  INT8_C(  10), -INT8_C(   6),
+         INT8_C(  75),  INT8_C( 101), -INT8_C(  31), -INT8_C(  54), -INT8_C(  89),  INT8_C(  58),      INT8_MIN,  INT8_C(  79) },
+      UINT32_C(1174452240) },
+    { UINT32_C(4062496641),
+      { -INT64_C( 1776801725628526002),  INT64_C( 1777626226176918044),  INT64_C( 8711057777286047280), -INT64_C(  401356787422151790) },
+      { -INT8_C(  26), -INT8_C(  33), -INT8_C(  72), -INT8_C( 103), -INT8_C(  54),  INT8_C(  45), -INT8_C(  29), -INT8_C(  38),
+        -INT8_C( 109),  INT8_C(  50), -INT8_C( 102),  INT8_C(  65), -INT8_C( 119), -INT8_C(  50), -INT8_C(  33), -INT8_C( 100),
+        -INT8_C( 101), -INT8_C( 114), -INT8_C( 107),  INT8_C( 126),  INT8_C(  76),  INT8_C(  94),  INT8_C(  78), -INT8_C(  54),
+        -INT8_C(  83),  INT8_C(   4), -INT8_C(  44),  INT8_C(  77),  INT8_C( 109), -INT8_C(  71), -INT8_C(  10),  INT8_C(  59) },
+      UINT32_C(3791650816) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi8(test_vec[i].c);
+    simde__mmask32 r = simde_mm256_mask_bitshuffle_epi64_mask(test_vec[i].k, b, c);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_bitshuffle_epi64_mask (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t b[8];
+    const int8_t c[64];
+    const simde__mmask64 r;
+  } test_vec[] = {
+    { { -INT64_C(  112363790692882281),  INT64_C( 8283228222437494095), -INT64_C( 8807326801628700752),  INT64_C( 2489720673322475926),
+        -INT64_C( 3011591589248855614), -INT64_C( 4990680981316182839), -INT64_C( 4743179180569525105),  INT64_C( 4671893517500620107) },
+      { -INT8_C(  84),  INT8_C(  57), -INT8_C(  57), -INT8_C(   2), -INT8_C(  33),  INT8_C(  38),  INT8_C(  34),  INT8_C(  22),
+         INT8_C(  74),      INT8_MIN, -INT8_C(  83), -INT8_C( 120),  INT8_C( 105),  INT8_C(  97), -INT8_C(  99),  INT8_C(  56),
+        -INT8_C(  96),  INT8_C( 127),  INT8_C(  43),  INT8_C(  85), -INT8_C(  49),  INT8_C(  42),  INT8_C(  82), -INT8_C(  24),
+        -INT8_C( 109), -INT8_C(  38), -INT8_C(  83), -INT8_C(  36), -INT8_C(  73),  INT8_C( 100), -INT8_C( 112), -INT8_C( 117),
+        -INT8_C(  38),  INT8_C(  83),  INT8_C(  55),  INT8_C(  79), -INT8_C(  77), -INT8_C(  44), -INT8_C(  55), -INT8_C(  42),
+        -INT8_C(  79), -INT8_C(  54), -INT8_C( 125), -INT8_C(  12), -INT8_C( 123), -INT8_C(  38),  INT8_C(  39), -INT8_C(  17),
+        -INT8_C(  22),  INT8_C(  33),  INT8_C(  25),  INT8_C( 107), -INT8_C( 109), -INT8_C(  62),  INT8_C(  85),  INT8_C(  95),
+         INT8_C( 109),  INT8_C( 125), -INT8_C(  81),  INT8_C(  96),  INT8_C(  74),  INT8_C( 104),  INT8_C(  84),  INT8_C(  92) },
+      UINT64_C( 6152918232035176206) },
+    { {  INT64_C( 7418958689647916490),  INT64_C(  939993291210772586),  INT64_C( 7936049656511749337),  INT64_C( 5501964543511865856),
+        -INT64_C( 4168466924093621316),  INT64_C( 2309254377811060441),  INT64_C(  188010626512164372),  INT64_C( 1764349876519528400) },
+      { -INT8_C(  56),  INT8_C(  39), -INT8_C(   9), -INT8_C(  98),  INT8_C(  39),  INT8_C(  13),  INT8_C( 121), -INT8_C(   7),
+         INT8_C(  88),  INT8_C(  92), -INT8_C( 108), -INT8_C(  53),  INT8_C( 126),  INT8_C(  98),  INT8_C(  60), -INT8_C(  82),
+         INT8_C(  45), -INT8_C(  93),  INT8_C(  34),  INT8_C(  16), -INT8_C(  22), -INT8_C( 117),  INT8_C( 126), -INT8_C(   4),
+         INT8_C( 127), -INT8_C(   5),  INT8_C( 112), -INT8_C(  60), -INT8_C(  11), -INT8_C(  48), -INT8_C(  11),  INT8_C( 126),
+         INT8_C(  10),  INT8_C(  30), -INT8_C(  42), -INT8_C(  43),  INT8_C(  44), -INT8_C( 116),  INT8_C(  51),  INT8_C(  51),
+         INT8_C(  33),  INT8_C( 115),  INT8_C(  61),  INT8_C(  57),  INT8_C(  29),  INT8_C(   1),  INT8_C(  85), -INT8_C( 117),
+         INT8_C(  96),  INT8_C(  96), -INT8_C( 116), -INT8_C(  53),  INT8_C(  10),  INT8_C( 104), -INT8_C(  44), -INT8_C(  13),
+         INT8_C(  10),  INT8_C( 120),  INT8_C(   2), -INT8_C(  84),  INT8_C(  73),  INT8_C(  97), -INT8_C(   5), -INT8_C( 102) },
+      UINT64_C( 6455724440073668095) },
+    { {  INT64_C( 5633648506243293537),  INT64_C(   97765384588493828), -INT64_C( 4228351695240658069), -INT64_C( 9005523177470416878),
+         INT64_C( 4178313656749904388),  INT64_C(  627431640921044217),  INT64_C( 1005096551208851468),  INT64_C( 7975796002563733859) },
+      {  INT8_C(  20), -INT8_C( 108),  INT8_C(  25), -INT8_C(  13), -INT8_C(  64),  INT8_C(  19), -INT8_C(  57),  INT8_C(  82),
+        -INT8_C( 122),  INT8_C(  15), -INT8_C( 127),  INT8_C(  94),  INT8_C(  50),      INT8_MIN,  INT8_C(  51), -INT8_C(  89),
+        -INT8_C(  82),  INT8_C(  27),  INT8_C(  85), -INT8_C(  49),  INT8_C( 106), -INT8_C( 118),  INT8_C(   1), -INT8_C(  43),
+        -INT8_C(   8), -INT8_C(  57), -INT8_C(  28), -INT8_C(  35), -INT8_C( 112),  INT8_C(  75), -INT8_C(   7), -INT8_C(  18),
+         INT8_C(  81),  INT8_C( 109),  INT8_C(  95), -INT8_C(   1),  INT8_C(  70),  INT8_C(  36),  INT8_C( 118),  INT8_C( 126),
+         INT8_C(  48),  INT8_C(   8),  INT8_C(  38), -INT8_C(  42), -INT8_C(  51),  INT8_C(  44), -INT8_C( 108), -INT8_C(  39),
+        -INT8_C(  10), -INT8_C(  13),  INT8_C(  72), -INT8_C(  80), -INT8_C(  85),  INT8_C(  88), -INT8_C( 104),  INT8_C(  93),
+        -INT8_C(   9),  INT8_C(   8), -INT8_C(  10), -INT8_C( 101),  INT8_C(   4),  INT8_C( 124), -INT8_C(   6),  INT8_C( 125) },
+      UINT64_C(14691161177204541496) },
+    { {  INT64_C(   95607243771697600),  INT64_C( 2036779494037037873), -INT64_C( 4502208516467892250), -INT64_C( 1520799286305395302),
+        -INT64_C( 2160570525280319737), -INT64_C( 4368698976317575987),  INT64_C( 6550263170824803942),  INT64_C( 4482834806179824012) },
+      { -INT8_C(  78), -INT8_C(  35),  INT8_C(  80), -INT8_C(  98), -INT8_C(  49), -INT8_C(  16),  INT8_C(  39), -INT8_C(  97),
+        -INT8_C( 106), -INT8_C( 117),  INT8_C(  76),  INT8_C( 114), -INT8_C(  74), -INT8_C(  61), -INT8_C(  72),  INT8_C(  87),
+        -INT8_C(  99), -INT8_C(  64), -INT8_C(  73),  INT8_C(  90),  INT8_C(  76),  INT8_C(  56), -INT8_C(  74),  INT8_C(  17),
+         INT8_C(  55),  INT8_C(  67), -INT8_C(  31),  INT8_C( 104),  INT8_C(   0), -INT8_C(  54), -INT8_C(  85),  INT8_C(  86),
+         INT8_C(  66),  INT8_C(  32),  INT8_C( 102),  INT8_C(  98), -INT8_C(   4),  INT8_C(  19),  INT8_C(  47), -INT8_C(  77),
+        -INT8_C( 102), -INT8_C(  81), -INT8_C(  62),  INT8_C( 103),  INT8_C( 115), -INT8_C(  87),  INT8_C(  38), -INT8_C(  74),
+         INT8_C( 123), -INT8_C(  77), -INT8_C(  80), -INT8_C(  47), -INT8_C(  34),  INT8_C(   1),  INT8_C(  79), -INT8_C(  97),
+        -INT8_C(   4), -INT8_C(  49),  INT8_C(  52),      INT8_MIN,  INT8_C( 109), -INT8_C( 109),  INT8_C(  92), -INT8_C(   4) },
+      UINT64_C(17667045380631402788) },
+    { { -INT64_C( 4713095592304393353), -INT64_C( 7987970662323559737),  INT64_C(  252903282637686820), -INT64_C( 7345149788311908663),
+        -INT64_C( 7218132441175232721),  INT64_C( 1382565666837618218),  INT64_C( 7787984166433431225), -INT64_C( 2978208027075842094) },
+      {  INT8_C(   3),  INT8_C(  37), -INT8_C(  79),  INT8_C( 116), -INT8_C( 114),  INT8_C(  35), -INT8_C(  55),  INT8_C( 104),
+        -INT8_C(  28), -INT8_C( 105),  INT8_C(  34), -INT8_C(  94), -INT8_C(  55),  INT8_C( 108), -INT8_C( 122), -INT8_C(  67),
+         INT8_C(  62),  INT8_C(  86),  INT8_C(  58), -INT8_C( 110), -INT8_C(  63), -INT8_C(  20),  INT8_C(  99), -INT8_C(  81),
+        -INT8_C(  70),  INT8_C(  41), -INT8_C(  19),  INT8_C(  62), -INT8_C(  16),  INT8_C(  55), -INT8_C(  91), -INT8_C(  32),
+         INT8_C( 125), -INT8_C( 107), -INT8_C( 106),  INT8_C(  51),  INT8_C(   7), -INT8_C(  11), -INT8_C(  14), -INT8_C(  81),
+        -INT8_C(  18), -INT8_C(  67), -INT8_C(  40), -INT8_C( 103),  INT8_C(  90), -INT8_C(  32),  INT8_C( 127), -INT8_C( 115),
+         INT8_C(  82),  INT8_C(  92),  INT8_C(  46),  INT8_C(  38), -INT8_C(  96),  INT8_C(  39),  INT8_C(  51), -INT8_C(  71),
+         INT8_C( 102),  INT8_C(  48),  INT8_C(   0), -INT8_C(   6), -INT8_C(  39),  INT8_C(  74), -INT8_C( 112),  INT8_C(  61) },
+      UINT64_C( 8794977296007582300) },
+    { { -INT64_C( 1359177365783969537), -INT64_C( 8425334043918280308),  INT64_C( 4618609828263107124), -INT64_C( 6107533729540496266),
+         INT64_C(  539046064673570746), -INT64_C( 3029734807592631603),  INT64_C( 1212375973095346586), -INT64_C( 4800295222661561422) },
+      { -INT8_C(  80),  INT8_C(  63), -INT8_C(  31),  INT8_C(   0),  INT8_C(  82),  INT8_C( 120),  INT8_C(   6),  INT8_C( 126),
+         INT8_C(   4),  INT8_C(  46),  INT8_C( 126), -INT8_C(   4), -INT8_C(  97), -INT8_C(  64),  INT8_C( 115),  INT8_C(  61),
+         INT8_C(  43),  INT8_C(  73), -INT8_C(  45), -INT8_C(  42), -INT8_C(  47), -INT8_C(  98),  INT8_C(  31), -INT8_C(  13),
+         INT8_C(  58),  INT8_C(   4),  INT8_C(  46), -INT8_C(  82),  INT8_C(  93),  INT8_C(  63), -INT8_C(  89), -INT8_C( 108),
+        -INT8_C(  75),  INT8_C(  60),  INT8_C(  44), -INT8_C(  94), -INT8_C(  63), -INT8_C(  48), -INT8_C(   1), -INT8_C(  78),
+        -INT8_C(  65),  INT8_C(  66), -INT8_C( 106), -INT8_C( 123),  INT8_C(  14), -INT8_C(  52),  INT8_C(  27),  INT8_C( 121),
+        -INT8_C( 121), -INT8_C(  48),  INT8_C(  97),  INT8_C(   3), -INT8_C(  99),  INT8_C(  40), -INT8_C(  50), -INT8_C( 125),
+         INT8_C(  56),  INT8_C( 120),  INT8_C( 104), -INT8_C(  66), -INT8_C(  15),  INT8_C(   0), -INT8_C(   4), -INT8_C(  75) },
+      UINT64_C(14105000345302929647) },
+    { {  INT64_C( 8721607260972587375),  INT64_C( 6431697467139217213), -INT64_C( 7736633591723186445),  INT64_C( 3426809302902495931),
+         INT64_C( 2937208639967481055), -INT64_C( 1173631733549903792), -INT64_C( 6083188593976768038), -INT64_C( 2533971188617377812) },
+      { -INT8_C(   3), -INT8_C(   2),  INT8_C(  15),  INT8_C(  23), -INT8_C(  95), -INT8_C(  70), -INT8_C(  89), -INT8_C(  18),
+        -INT8_C(  65), -INT8_C( 102), -INT8_C(  13), -INT8_C(  42),  INT8_C( 111),  INT8_C(  35), -INT8_C(  41),  INT8_C(  26),
+         INT8_C(  32), -INT8_C(  24), -INT8_C( 117),  INT8_C( 120),  INT8_C( 110), -INT8_C( 118),  INT8_C( 117), -INT8_C(  91),
+        -INT8_C(  54),  INT8_C(  93),  INT8_C(   9),  INT8_C( 127),  INT8_C(  55), -INT8_C(  29), -INT8_C(  10), -INT8_C(  93),
+         INT8_C( 110), -INT8_C( 100),  INT8_C(  27),  INT8_C(   1), -INT8_C(  11),  INT8_C(  40),  INT8_C(  48), -INT8_C(   4),
+        -INT8_C(   7),  INT8_C( 100), -INT8_C(   8), -INT8_C(  61), -INT8_C(  94), -INT8_C( 125),  INT8_C( 108),  INT8_C(  24),
+         INT8_C(   8),  INT8_C(  10),  INT8_C(  86), -INT8_C(  92),  INT8_C(  87), -INT8_C(  41), -INT8_C(   8),  INT8_C(  65),
+         INT8_C(  35),  INT8_C(  81),  INT8_C(  21), -INT8_C( 111),  INT8_C( 118), -INT8_C(  16), -INT8_C(  25), -INT8_C(   2) },
+      UINT64_C(18360337209068999371) },
+    { { -INT64_C( 1589030075407922461), -INT64_C( 7292676335359415824),  INT64_C(  474518589713512793),  INT64_C( 3984478595646444468),
+        -INT64_C( 3883731539714360103), -INT64_C( 2725656853981225607), -INT64_C( 6712293012567845507),  INT64_C( 2027748958169008447) },
+      { -INT8_C(  80),  INT8_C(  61), -INT8_C(  11),  INT8_C(  32),  INT8_C(  82), -INT8_C(  14), -INT8_C( 113),  INT8_C(  78),
+         INT8_C(  98), -INT8_C(  62), -INT8_C(  83),  INT8_C( 114),  INT8_C(  94), -INT8_C( 112), -INT8_C(  29), -INT8_C(  10),
+         INT8_C(  19), -INT8_C(  11),  INT8_C(  56),  INT8_C(  98),  INT8_C( 124), -INT8_C( 124),  INT8_C(  59),  INT8_C(  41),
+         INT8_C(  19),  INT8_C( 101), -INT8_C( 113), -INT8_C(  96), -INT8_C(  29),  INT8_C(  38), -INT8_C(  74), -INT8_C(  29),
+         INT8_C(  70), -INT8_C(  30),  INT8_C(  45),  INT8_C(  59),  INT8_C(   7),  INT8_C(  49),  INT8_C(  17), -INT8_C( 125),
+        -INT8_C(  80), -INT8_C(  57),  INT8_C( 114), -INT8_C( 100), -INT8_C(  21),  INT8_C( 106),  INT8_C(  58),  INT8_C(  46),
+        -INT8_C(   6),  INT8_C(  67),  INT8_C( 125),  INT8_C(  29), -INT8_C(  27),  INT8_C(  48), -INT8_C(   6), -INT8_C(  85),
+         INT8_C(  20),  INT8_C(  36), -INT8_C( 104), -INT8_C(  15),  INT8_C(  86),  INT8_C(  68), -INT8_C(  14), -INT8_C(  37) },
+      UINT64_C(17667098794504270870) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi8(test_vec[i].c);
+    simde__mmask64 r = simde_mm512_bitshuffle_epi64_mask(b, c);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_bitshuffle_epi64_mask (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 k;
+    const int64_t b[8];
+    const int8_t c[64];
+    const simde__mmask64 r;
+  } test_vec[] = {
+    { UINT64_C(13211966393604717430),
+      { -INT64_C( 9009081821969966720), -INT64_C( 7570057709071308517),  INT64_C( 7147001390905035479), -INT64_C( 5537241204535420097),
+        -INT64_C( 7424845409704291934), -INT64_C( 3433427271767754441),  INT64_C( 6175583058460555969),  INT64_C( 4573211209305849521) },
+      {  INT8_C(   3),  INT8_C( 117),  INT8_C(   3), -INT8_C(  93), -INT8_C( 102),  INT8_C(  59), -INT8_C(  21),  INT8_C(   0),
+        -INT8_C( 110),  INT8_C( 109), -INT8_C(  67),  INT8_C(  40),  INT8_C(  56), -INT8_C( 102),  INT8_C(  61),  INT8_C( 123),
+         INT8_C(  83), -INT8_C(  71),  INT8_C(  22), -INT8_C(   4), -INT8_C(  57),  INT8_C(  86),  INT8_C( 122), -INT8_C(  38),
+        -INT8_C(  37), -INT8_C(  12), -INT8_C(  15),  INT8_C(  94),  INT8_C(   6),  INT8_C(  82),  INT8_C(  62), -INT8_C(  12),
+         INT8_C(  31),  INT8_C( 121),  INT8_C(  17),  INT8_C(  75), -INT8_C(  63), -INT8_C(  46),  INT8_C(  95),  INT8_C(  99),
+         INT8_C( 117),  INT8_C(  21),  INT8_C(  99),  INT8_C(  87), -INT8_C(  55),  INT8_C(  84),  INT8_C(  66), -INT8_C(  28),
+         INT8_C(   7),  INT8_C( 111), -INT8_C(  65),  INT8_C(  34),  INT8_C(  50), -INT8_C(  38),  INT8_C(  75),  INT8_C(  57),
+         INT8_C(  43),  INT8_C( 109),  INT8_C(  11), -INT8_C(   5),  INT8_C(  46),  INT8_C(  30),  INT8_C(  30),  INT8_C(  98) },
+      UINT64_C(13065012905077964866) },
+    { UINT64_C(16036967575046636046),
+      { -INT64_C( 3827509115242808822), -INT64_C( 4822988937444433261), -INT64_C( 8434132896366033440), -INT64_C( 1561944577334886645),
+         INT64_C(  403653359374729557), -INT64_C( 1480169820689290573), -INT64_C( 5637921265404318596), -INT64_C( 2807071605384241784) },
+      { -INT8_C(  32), -INT8_C(  59),  INT8_C(  22), -INT8_C(  32),  INT8_C(  61), -INT8_C(  89), -INT8_C(  36), -INT8_C(  89),
+        -INT8_C(  50),  INT8_C(   1), -INT8_C(  59), -INT8_C(  26), -INT8_C( 123),  INT8_C(  58),  INT8_C( 106),  INT8_C(  70),
+         INT8_C(  86), -INT8_C( 108), -INT8_C(   7),  INT8_C( 110),  INT8_C(  90),  INT8_C( 126),  INT8_C(  54), -INT8_C(  44),
+         INT8_C( 121), -INT8_C(   9),  INT8_C(  34),  INT8_C( 120),  INT8_C( 120), -INT8_C( 104), -INT8_C(   7),  INT8_C(  64),
+         INT8_C(  60),  INT8_C(  52),  INT8_C( 108),  INT8_C(  48), -INT8_C(  46), -INT8_C( 123),  INT8_C(  32), -INT8_C( 126),
+         INT8_C(  93), -INT8_C(  67), -INT8_C(  62), -INT8_C(  85),  INT8_C(  90), -INT8_C(  36),  INT8_C(  37),  INT8_C(  99),
+         INT8_C(   3), -INT8_C(  95), -INT8_C( 124),  INT8_C(  55),  INT8_C(  75), -INT8_C( 101), -INT8_C(  46),  INT8_C( 115),
+        -INT8_C(  61),  INT8_C( 124), -INT8_C(  66), -INT8_C( 111), -INT8_C(  26), -INT8_C(  73),  INT8_C( 122), -INT8_C(  32) },
+      UINT64_C( 9659729730840838668) },
+    { UINT64_C(11507405259314166191),
+      {  INT64_C( 7034641297732599708),  INT64_C( 1437368500267415275),  INT64_C( 1876449210301908711), -INT64_C( 2938840794399068748),
+        -INT64_C( 3826602471357775400), -INT64_C( 2304532553648274629),  INT64_C( 4984663534483715883), -INT64_C( 6379913138262463105) },
+      {  INT8_C( 114),  INT8_C(  42), -INT8_C(  32), -INT8_C(   9),  INT8_C(   4), -INT8_C(  16),  INT8_C(  31),  INT8_C(  99),
+         INT8_C(  83), -INT8_C(  37), -INT8_C(  10), -INT8_C( 111),  INT8_C(  40),  INT8_C(  28), -INT8_C(   2),  INT8_C(  97),
+         INT8_C(  83),  INT8_C(  53),  INT8_C(  35),  INT8_C(  93), -INT8_C(  53), -INT8_C( 124),  INT8_C( 111),  INT8_C(  99),
+        -INT8_C(  99),  INT8_C(  62), -INT8_C(  52), -INT8_C(  27),  INT8_C(  78),  INT8_C(  76),  INT8_C(  42),  INT8_C(  80),
+         INT8_C(  96),  INT8_C(  74), -INT8_C(  50),  INT8_C(  25), -INT8_C(  87),  INT8_C(  38), -INT8_C( 114),  INT8_C( 101),
+         INT8_C(  23),  INT8_C(  95), -INT8_C(  79), -INT8_C(  78), -INT8_C(  95), -INT8_C(  82), -INT8_C( 125), -INT8_C(  20),
+        -INT8_C( 101),  INT8_C(  16), -INT8_C(  56),  INT8_C( 111),  INT8_C(  79), -INT8_C(  19), -INT8_C( 100),  INT8_C(  85),
+        -INT8_C(  71),  INT8_C( 112), -INT8_C( 126),  INT8_C( 121),  INT8_C( 111), -INT8_C( 127),  INT8_C(  36), -INT8_C( 102) },
+      UINT64_C( 2274317850535606412) },
+    { UINT64_C( 8648108524344893789),
+      { -INT64_C( 1701648483036407585), -INT64_C( 9157561242894458723), -INT64_C( 1027221443262593189), -INT64_C( 6628478611966073424),
+         INT64_C( 6240111034489907431), -INT64_C( 2510270250569067408),  INT64_C( 2053085414438820272), -INT64_C( 1411770147180668874) },
+      { -INT8_C(  87), -INT8_C(  32), -INT8_C( 101),  INT8_C(  74),  INT8_C(   0), -INT8_C(  80), -INT8_C(  57),  INT8_C(  76),
+        -INT8_C(  72), -INT8_C(  49), -INT8_C(  82),  INT8_C(  35),  INT8_C(  71),  INT8_C(  17), -INT8_C(  11),  INT8_C(  50),
+        -INT8_C(  94), -INT8_C(  69), -INT8_C(  30),  INT8_C(   1), -INT8_C(  97),  INT8_C( 102), -INT8_C(  54), -INT8_C(  55),
+         INT8_C(  56),  INT8_C(  40),  INT8_C(  98), -INT8_C(  86), -INT8_C(  35), -INT8_C(  94), -INT8_C(  13), -INT8_C(  36),
+        -INT8_C(  73),  INT8_C(  28), -INT8_C(  20),  INT8_C(  53), -INT8_C(  87),  INT8_C(  74), -INT8_C(  90),  INT8_C(  65),
+        -INT8_C(  77), -INT8_C( 110), -INT8_C(  91),  INT8_C( 100),  INT8_C(  78),  INT8_C( 108), -INT8_C(  26), -INT8_C(  19),
+         INT8_C(  10), -INT8_C(  46), -INT8_C( 101),  INT8_C(  10), -INT8_C(  88),  INT8_C( 117),  INT8_C(   9), -INT8_C(  71),
+         INT8_C(  72),  INT8_C( 108), -INT8_C( 114), -INT8_C(  27), -INT8_C(  94), -INT8_C( 101), -INT8_C( 122), -INT8_C(  29) },
+      UINT64_C( 1152922329249497173) },
+    { UINT64_C(13125604594155375830),
+      {  INT64_C( 3639917896383466191), -INT64_C( 1589010267466123696), -INT64_C( 7962593768281358328),  INT64_C( 8961108080239150642),
+         INT64_C( 6995580670867665462),  INT64_C( 6560950538724463327),  INT64_C( 5566242134452083425),  INT64_C( 8584795073226328767) },
+      {  INT8_C(  67),  INT8_C(  31), -INT8_C( 123),  INT8_C(  68), -INT8_C(  32),  INT8_C( 121), -INT8_C(  37),  INT8_C( 118),
+         INT8_C( 114),  INT8_C( 126), -INT8_C(  46), -INT8_C(  89), -INT8_C( 102), -INT8_C( 115), -INT8_C(  48), -INT8_C(  51),
+         INT8_C( 122), -INT8_C(  38),  INT8_C(  61), -INT8_C(  93),  INT8_C(  44),  INT8_C(  32),  INT8_C(   2),  INT8_C(  46),
+        -INT8_C(  36), -INT8_C( 125), -INT8_C( 126),  INT8_C(  95), -INT8_C(  25),  INT8_C(  96), -INT8_C(  80),  INT8_C(  73),
+         INT8_C(   5), -INT8_C( 103),  INT8_C(  42), -INT8_C(  32), -INT8_C(  91),  INT8_C(  88), -INT8_C( 106), -INT8_C(  71),
+        -INT8_C( 124), -INT8_C(  55), -INT8_C(  38), -INT8_C(  25),  INT8_C(  72), -INT8_C(  66), -INT8_C(  61),  INT8_C(   0),
+        -INT8_C(   8), -INT8_C(  87),  INT8_C(  30), -INT8_C(  82), -INT8_C(  43), -INT8_C(  80),  INT8_C(  13),  INT8_C(  63),
+        -INT8_C(  67), -INT8_C(  42),  INT8_C(  93), -INT8_C( 109), -INT8_C(  52), -INT8_C(  31),  INT8_C(  14), -INT8_C(  50) },
+      UINT64_C(11540336606183475266) },
+    { UINT64_C(13327303016068382903),
+      { -INT64_C( 8251967680774565258), -INT64_C( 1971655288610523156), -INT64_C( 8083713934153667745), -INT64_C( 2428983964844001198),
+         INT64_C( 1890029326072030851), -INT64_C( 2225579042881580632),  INT64_C( 9086154530497724440),  INT64_C( 2546516462902618066) },
+      {  INT8_C( 115), -INT8_C(  11), -INT8_C( 102), -INT8_C(  97), -INT8_C( 100),  INT8_C(  47), -INT8_C(  23),  INT8_C(  42),
+        -INT8_C(  44),  INT8_C(  55),  INT8_C(  25),  INT8_C(  41), -INT8_C(  37), -INT8_C(  12),  INT8_C(  27), -INT8_C(  19),
+         INT8_C( 106),  INT8_C(  42),  INT8_C(  92), -INT8_C( 124),  INT8_C(  37),  INT8_C(  41), -INT8_C(   7), -INT8_C(  22),
+        -INT8_C( 127), -INT8_C( 118),  INT8_C(  97), -INT8_C(  79), -INT8_C(  58),  INT8_C( 119),  INT8_C(  23),  INT8_C(  35),
+        -INT8_C(  41),  INT8_C(  14), -INT8_C(   8), -INT8_C(   1), -INT8_C(  70), -INT8_C(  47), -INT8_C(  12), -INT8_C( 107),
+         INT8_C(  66), -INT8_C(  16),  INT8_C(  21),  INT8_C(  23),  INT8_C( 107), -INT8_C( 117), -INT8_C(  88),  INT8_C(  73),
+        -INT8_C( 109), -INT8_C(  70),  INT8_C(  91),  INT8_C(  11), -INT8_C(  55), -INT8_C(  20),  INT8_C( 117),  INT8_C(  27),
+        -INT8_C(  45), -INT8_C( 106), -INT8_C( 105),  INT8_C(  34), -INT8_C(  74), -INT8_C(  55), -INT8_C(  26), -INT8_C(  25) },
+      UINT64_C( 3495926086989774995) },
+    { UINT64_C(11096662216006080944),
+      {  INT64_C( 5180936305134895747),  INT64_C(  129167906434795313), -INT64_C( 5860926296503341839), -INT64_C( 6027799940048686233),
+        -INT64_C( 3246132438658709273), -INT64_C( 1141563244719083313), -INT64_C( 6496167891953531731),  INT64_C( 3159456906538760824) },
+      { -INT8_C( 127),  INT8_C(  90), -INT8_C(  34), -INT8_C( 123),  INT8_C(  56), -INT8_C(  42),  INT8_C(  41),  INT8_C( 107),
+         INT8_C(  95), -INT8_C( 123), -INT8_C(  82), -INT8_C(   1),  INT8_C(  42), -INT8_C(  72),  INT8_C(  39),  INT8_C(  81),
+         INT8_C(  71),  INT8_C(  25),  INT8_C(  43),  INT8_C(  93),  INT8_C(  39),  INT8_C( 115),  INT8_C( 127), -INT8_C(  49),
+         INT8_C(  36), -INT8_C(  12),  INT8_C(  19), -INT8_C(  55), -INT8_C(  74), -INT8_C( 127), -INT8_C(  54), -INT8_C(  19),
+         INT8_C(  28),  INT8_C(  10), -INT8_C(  48),  INT8_C( 105),  INT8_C(  59), -INT8_C(  65),  INT8_C(  52),  INT8_C(  92),
+         INT8_C(  86),  INT8_C(  38),  INT8_C(  44),  INT8_C(   0),  INT8_C( 110),  INT8_C(  54),  INT8_C(  50),  INT8_C(  98),
+        -INT8_C(  62),  INT8_C(  51),  INT8_C(  61), -INT8_C(   5), -INT8_C(  84), -INT8_C(  63),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  66), -INT8_C(  30),  INT8_C( 109), -INT8_C( 125), -INT8_C(  76), -INT8_C(  47),  INT8_C(  74), -INT8_C(  50) },
+      UINT64_C( 1789903122786292016) },
+    { UINT64_C(12977314872436405425),
+      {  INT64_C( 7419621418151392664), -INT64_C( 2017049243532039224), -INT64_C( 3404258484628847313), -INT64_C( 9109493451590573865),
+         INT64_C(  110945449300138424),  INT64_C( 8721083074141222139), -INT64_C( 2671345197365374597), -INT64_C( 3580306210827272975) },
+      { -INT8_C(   9),  INT8_C( 124), -INT8_C(  32), -INT8_C(  99), -INT8_C(  38),  INT8_C( 111), -INT8_C(  53),  INT8_C(   8),
+         INT8_C( 126), -INT8_C(  32), -INT8_C( 123),  INT8_C(  48),  INT8_C(  16), -INT8_C(  56), -INT8_C( 107), -INT8_C( 104),
+        -INT8_C(  85),  INT8_C(  30),  INT8_C(  12),  INT8_C( 104), -INT8_C(  40),  INT8_C(  49),  INT8_C(  39), -INT8_C(  77),
+        -INT8_C(  58), -INT8_C(  97),  INT8_C(  44),  INT8_C(  80), -INT8_C( 112),  INT8_C(  59),  INT8_C(   3),  INT8_C(  41),
+         INT8_C( 121), -INT8_C(  51), -INT8_C( 120),  INT8_C( 109),  INT8_C(  89), -INT8_C(  33), -INT8_C(  40),  INT8_C( 109),
+         INT8_C(  21),  INT8_C(  29),  INT8_C(  19),  INT8_C(  65), -INT8_C( 125), -INT8_C( 122),  INT8_C(  53),  INT8_C(  63),
+         INT8_C(  71), -INT8_C(  13),  INT8_C(  98),  INT8_C( 110), -INT8_C(   8), -INT8_C(  91), -INT8_C( 104),  INT8_C(  53),
+         INT8_C( 123), -INT8_C(  13),  INT8_C(  62), -INT8_C(  36),  INT8_C(  87), -INT8_C(  71), -INT8_C(  30),  INT8_C(  75) },
+      UINT64_C(12972667227647127729) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi8(test_vec[i].c);
+    simde__mmask64 r = simde_mm512_mask_bitshuffle_epi64_mask(test_vec[i].k, b, c);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_bitshuffle_epi64_mask)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_bitshuffle_epi64_mask)
+
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_bitshuffle_epi64_mask)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_bitshuffle_epi64_mask)
+
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_bitshuffle_epi64_mask)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_bitshuffle_epi64_mask)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -3676,6 +3676,214 @@ test_simde_mm512_broadcastw_epi16(SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm_broadcastmw_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t r[4];
+  } test_vec[] = {
+    { UINT16_C(    0),
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(65535),
+      {  INT32_C(       65535),  INT32_C(       65535),  INT32_C(       65535),  INT32_C(       65535) } },
+    { UINT16_C(41143),
+      {  INT32_C(       41143),  INT32_C(       41143),  INT32_C(       41143),  INT32_C(       41143) } },
+    { UINT16_C( 7222),
+      {  INT32_C(        7222),  INT32_C(        7222),  INT32_C(        7222),  INT32_C(        7222) } },
+    { UINT16_C(26510),
+      {  INT32_C(       26510),  INT32_C(       26510),  INT32_C(       26510),  INT32_C(       26510) } },
+    { UINT16_C(10433),
+      {  INT32_C(       10433),  INT32_C(       10433),  INT32_C(       10433),  INT32_C(       10433) } },
+    { UINT16_C(57040),
+      {  INT32_C(       57040),  INT32_C(       57040),  INT32_C(       57040),  INT32_C(       57040) } },
+    { UINT16_C(37229),
+      {  INT32_C(       37229),  INT32_C(       37229),  INT32_C(       37229),  INT32_C(       37229) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i r = simde_mm_broadcastmw_epi32(test_vec[i].k);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_broadcastmb_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t r[2];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(255),
+      {  INT64_C(                 255),  INT64_C(                 255) } },
+    { UINT8_C(212),
+      {  INT64_C(                 212),  INT64_C(                 212) } },
+    { UINT8_C(121),
+      {  INT64_C(                 121),  INT64_C(                 121) } },
+    { UINT8_C(149),
+      {  INT64_C(                 149),  INT64_C(                 149) } },
+    { UINT8_C( 38),
+      {  INT64_C(                  38),  INT64_C(                  38) } },
+    { UINT8_C(204),
+      {  INT64_C(                 204),  INT64_C(                 204) } },
+    { UINT8_C(191),
+      {  INT64_C(                 191),  INT64_C(                 191) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i r = simde_mm_broadcastmb_epi64(test_vec[i].k);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_broadcastmw_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t r[8];
+  } test_vec[] = {
+    { UINT16_C(    0),
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(65535),
+      {  INT32_C(       65535),  INT32_C(       65535),  INT32_C(       65535),  INT32_C(       65535),  INT32_C(       65535),  INT32_C(       65535),  INT32_C(       65535),  INT32_C(       65535) } },
+    { UINT16_C(29109),
+      {  INT32_C(       29109),  INT32_C(       29109),  INT32_C(       29109),  INT32_C(       29109),  INT32_C(       29109),  INT32_C(       29109),  INT32_C(       29109),  INT32_C(       29109) } },
+    { UINT16_C(46102),
+      {  INT32_C(       46102),  INT32_C(       46102),  INT32_C(       46102),  INT32_C(       46102),  INT32_C(       46102),  INT32_C(       46102),  INT32_C(       46102),  INT32_C(       46102) } },
+    { UINT16_C(48382),
+      {  INT32_C(       48382),  INT32_C(       48382),  INT32_C(       48382),  INT32_C(       48382),  INT32_C(       48382),  INT32_C(       48382),  INT32_C(       48382),  INT32_C(       48382) } },
+    { UINT16_C(56839),
+      {  INT32_C(       56839),  INT32_C(       56839),  INT32_C(       56839),  INT32_C(       56839),  INT32_C(       56839),  INT32_C(       56839),  INT32_C(       56839),  INT32_C(       56839) } },
+    { UINT16_C(47227),
+      {  INT32_C(       47227),  INT32_C(       47227),  INT32_C(       47227),  INT32_C(       47227),  INT32_C(       47227),  INT32_C(       47227),  INT32_C(       47227),  INT32_C(       47227) } },
+    { UINT16_C( 1483),
+      {  INT32_C(        1483),  INT32_C(        1483),  INT32_C(        1483),  INT32_C(        1483),  INT32_C(        1483),  INT32_C(        1483),  INT32_C(        1483),  INT32_C(        1483) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i r = simde_mm256_broadcastmw_epi32(test_vec[i].k);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_broadcastmb_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t r[4];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(255),
+      {  INT64_C(                 255),  INT64_C(                 255),  INT64_C(                 255),  INT64_C(                 255) } },
+    { UINT8_C(127),
+      {  INT64_C(                 127),  INT64_C(                 127),  INT64_C(                 127),  INT64_C(                 127) } },
+    { UINT8_C( 85),
+      {  INT64_C(                  85),  INT64_C(                  85),  INT64_C(                  85),  INT64_C(                  85) } },
+    { UINT8_C(135),
+      {  INT64_C(                 135),  INT64_C(                 135),  INT64_C(                 135),  INT64_C(                 135) } },
+    { UINT8_C(166),
+      {  INT64_C(                 166),  INT64_C(                 166),  INT64_C(                 166),  INT64_C(                 166) } },
+    { UINT8_C( 29),
+      {  INT64_C(                  29),  INT64_C(                  29),  INT64_C(                  29),  INT64_C(                  29) } },
+    { UINT8_C(147),
+      {  INT64_C(                 147),  INT64_C(                 147),  INT64_C(                 147),  INT64_C(                 147) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i r = simde_mm256_broadcastmb_epi64(test_vec[i].k);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_broadcastmw_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t r[16];
+  } test_vec[] = {
+    { UINT16_C(    0),
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(65535),
+      {  INT32_C(       65535),  INT32_C(       65535),  INT32_C(       65535),  INT32_C(       65535),  INT32_C(       65535),  INT32_C(       65535),  INT32_C(       65535),  INT32_C(       65535),
+         INT32_C(       65535),  INT32_C(       65535),  INT32_C(       65535),  INT32_C(       65535),  INT32_C(       65535),  INT32_C(       65535),  INT32_C(       65535),  INT32_C(       65535) } },
+    { UINT16_C(48694),
+      {  INT32_C(       48694),  INT32_C(       48694),  INT32_C(       48694),  INT32_C(       48694),  INT32_C(       48694),  INT32_C(       48694),  INT32_C(       48694),  INT32_C(       48694),
+         INT32_C(       48694),  INT32_C(       48694),  INT32_C(       48694),  INT32_C(       48694),  INT32_C(       48694),  INT32_C(       48694),  INT32_C(       48694),  INT32_C(       48694) } },
+    { UINT16_C(31434),
+      {  INT32_C(       31434),  INT32_C(       31434),  INT32_C(       31434),  INT32_C(       31434),  INT32_C(       31434),  INT32_C(       31434),  INT32_C(       31434),  INT32_C(       31434),
+         INT32_C(       31434),  INT32_C(       31434),  INT32_C(       31434),  INT32_C(       31434),  INT32_C(       31434),  INT32_C(       31434),  INT32_C(       31434),  INT32_C(       31434) } },
+    { UINT16_C(57023),
+      {  INT32_C(       57023),  INT32_C(       57023),  INT32_C(       57023),  INT32_C(       57023),  INT32_C(       57023),  INT32_C(       57023),  INT32_C(       57023),  INT32_C(       57023),
+         INT32_C(       57023),  INT32_C(       57023),  INT32_C(       57023),  INT32_C(       57023),  INT32_C(       57023),  INT32_C(       57023),  INT32_C(       57023),  INT32_C(       57023) } },
+    { UINT16_C(44738),
+      {  INT32_C(       44738),  INT32_C(       44738),  INT32_C(       44738),  INT32_C(       44738),  INT32_C(       44738),  INT32_C(       44738),  INT32_C(       44738),  INT32_C(       44738),
+         INT32_C(       44738),  INT32_C(       44738),  INT32_C(       44738),  INT32_C(       44738),  INT32_C(       44738),  INT32_C(       44738),  INT32_C(       44738),  INT32_C(       44738) } },
+    { UINT16_C(62751),
+      {  INT32_C(       62751),  INT32_C(       62751),  INT32_C(       62751),  INT32_C(       62751),  INT32_C(       62751),  INT32_C(       62751),  INT32_C(       62751),  INT32_C(       62751),
+         INT32_C(       62751),  INT32_C(       62751),  INT32_C(       62751),  INT32_C(       62751),  INT32_C(       62751),  INT32_C(       62751),  INT32_C(       62751),  INT32_C(       62751) } },
+    { UINT16_C(58677),
+      {  INT32_C(       58677),  INT32_C(       58677),  INT32_C(       58677),  INT32_C(       58677),  INT32_C(       58677),  INT32_C(       58677),  INT32_C(       58677),  INT32_C(       58677),
+         INT32_C(       58677),  INT32_C(       58677),  INT32_C(       58677),  INT32_C(       58677),  INT32_C(       58677),  INT32_C(       58677),  INT32_C(       58677),  INT32_C(       58677) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i r = simde_mm512_broadcastmw_epi32(test_vec[i].k);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_broadcastmb_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t r[8];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(255),
+      {  INT64_C(                 255),  INT64_C(                 255),  INT64_C(                 255),  INT64_C(                 255),
+         INT64_C(                 255),  INT64_C(                 255),  INT64_C(                 255),  INT64_C(                 255) } },
+    { UINT8_C( 27),
+      {  INT64_C(                  27),  INT64_C(                  27),  INT64_C(                  27),  INT64_C(                  27),
+         INT64_C(                  27),  INT64_C(                  27),  INT64_C(                  27),  INT64_C(                  27) } },
+    { UINT8_C( 39),
+      {  INT64_C(                  39),  INT64_C(                  39),  INT64_C(                  39),  INT64_C(                  39),
+         INT64_C(                  39),  INT64_C(                  39),  INT64_C(                  39),  INT64_C(                  39) } },
+    { UINT8_C(117),
+      {  INT64_C(                 117),  INT64_C(                 117),  INT64_C(                 117),  INT64_C(                 117),
+         INT64_C(                 117),  INT64_C(                 117),  INT64_C(                 117),  INT64_C(                 117) } },
+    { UINT8_C(219),
+      {  INT64_C(                 219),  INT64_C(                 219),  INT64_C(                 219),  INT64_C(                 219),
+         INT64_C(                 219),  INT64_C(                 219),  INT64_C(                 219),  INT64_C(                 219) } },
+    { UINT8_C(154),
+      {  INT64_C(                 154),  INT64_C(                 154),  INT64_C(                 154),  INT64_C(                 154),
+         INT64_C(                 154),  INT64_C(                 154),  INT64_C(                 154),  INT64_C(                 154) } },
+    { UINT8_C(223),
+      {  INT64_C(                 223),  INT64_C(                 223),  INT64_C(                 223),  INT64_C(                 223),
+         INT64_C(                 223),  INT64_C(                 223),  INT64_C(                 223),  INT64_C(                 223) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i r = simde_mm512_broadcastmb_epi64(test_vec[i].k);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
 SIMDE_TEST_FUNC_LIST_BEGIN
 
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_broadcast_f32x2)
@@ -3725,6 +3933,12 @@ SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_broadcastb_epi8)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_broadcastb_epi8)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_broadcastw_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_broadcastmw_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_broadcastmb_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_broadcastmw_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_broadcastmb_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_broadcastmw_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_broadcastmb_epi64)
 SIMDE_TEST_FUNC_LIST_END
 
 #include <test/x86/avx512/test-avx512-footer.h>
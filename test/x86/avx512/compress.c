@@ -0,0 +1,3787 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN compress
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/compress.h>
+
+static int
+test_simde_mm_mask_compress_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(  1909016608),  INT32_C(   258855105), -INT32_C(  1787177767),  INT32_C(   180341798) },
+      UINT8_C(  0),
+      { -INT32_C(  1519393256),  INT32_C(   910725594), -INT32_C(   507094484), -INT32_C(  2127226932) },
+      { -INT32_C(  1909016608),  INT32_C(   258855105), -INT32_C(  1787177767),  INT32_C(   180341798) } },
+    { {  INT32_C(  2035241239),  INT32_C(   710602005),  INT32_C(  1387215834),  INT32_C(  2137756792) },
+      UINT8_C( 15),
+      { -INT32_C(  1350620746),  INT32_C(  1176250892), -INT32_C(  2014908014), -INT32_C(  1042229844) },
+      { -INT32_C(  1350620746),  INT32_C(  1176250892), -INT32_C(  2014908014), -INT32_C(  1042229844) } },
+    { { -INT32_C(   726597361),  INT32_C(   274745475),  INT32_C(   447080548), -INT32_C(  1591743460) },
+      UINT8_C(  6),
+      { -INT32_C(   272186474), -INT32_C(   601842728),  INT32_C(   279773477), -INT32_C(   228941368) },
+      { -INT32_C(   601842728),  INT32_C(   279773477),  INT32_C(   447080548), -INT32_C(  1591743460) } },
+    { {  INT32_C(  1288801495),  INT32_C(    48356864),  INT32_C(  1855051362), -INT32_C(  1510051238) },
+      UINT8_C(  1),
+      {  INT32_C(  1121792849), -INT32_C(   200758288), -INT32_C(  1858607411), -INT32_C(   162756118) },
+      {  INT32_C(  1121792849),  INT32_C(    48356864),  INT32_C(  1855051362), -INT32_C(  1510051238) } },
+    { { -INT32_C(  2000951157), -INT32_C(  1496851759), -INT32_C(  1510445875),  INT32_C(   639920732) },
+      UINT8_C(  0),
+      { -INT32_C(  1875977794), -INT32_C(   727337811),  INT32_C(   899587853),  INT32_C(     7098005) },
+      { -INT32_C(  2000951157), -INT32_C(  1496851759), -INT32_C(  1510445875),  INT32_C(   639920732) } },
+    { {  INT32_C(   713679380), -INT32_C(    76703164), -INT32_C(  1940724816), -INT32_C(   492570975) },
+      UINT8_C( 14),
+      { -INT32_C(   627469190),  INT32_C(  1317922501), -INT32_C(  1444914604),  INT32_C(   685313000) },
+      {  INT32_C(  1317922501), -INT32_C(  1444914604),  INT32_C(   685313000), -INT32_C(   492570975) } },
+    { { -INT32_C(  1660316475),  INT32_C(  1980292536), -INT32_C(   176465946), -INT32_C(  1778377692) },
+      UINT8_C(  0),
+      { -INT32_C(    65135991), -INT32_C(  1822308631), -INT32_C(    79442844), -INT32_C(   895939196) },
+      { -INT32_C(  1660316475),  INT32_C(  1980292536), -INT32_C(   176465946), -INT32_C(  1778377692) } },
+    { {  INT32_C(   465348935),  INT32_C(   496789201), -INT32_C(    12854629),  INT32_C(  1724070830) },
+      UINT8_C(  9),
+      { -INT32_C(  1161212498),  INT32_C(  2145262305),  INT32_C(  1786514169), -INT32_C(   684246576) },
+      { -INT32_C(  1161212498), -INT32_C(   684246576), -INT32_C(    12854629),  INT32_C(  1724070830) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_compress_epi32(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_compress_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[2];
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { {  INT64_C( 6017066056671618331),  INT64_C( 8953916399126577847) },
+      UINT8_C(  0),
+      {  INT64_C( 6787740220359203551), -INT64_C( 5060798218583426978) },
+      {  INT64_C( 6017066056671618331),  INT64_C( 8953916399126577847) } },
+    { {  INT64_C(   43128377324526349), -INT64_C( 7397865840688085412) },
+      UINT8_C(  3),
+      { -INT64_C( 4594788241889394415),  INT64_C( 3899689102658131703) },
+      { -INT64_C( 4594788241889394415),  INT64_C( 3899689102658131703) } },
+    { { -INT64_C( 8925312663871868647), -INT64_C( 3764441766483382451) },
+      UINT8_C(  2),
+      {  INT64_C(  123369981549657399),  INT64_C( 1279143304507087705) },
+      {  INT64_C( 1279143304507087705), -INT64_C( 3764441766483382451) } },
+    { {  INT64_C( 7811493694730962424),  INT64_C( 8959938036559887396) },
+      UINT8_C(  3),
+      { -INT64_C( 1537542855754468023),  INT64_C( 6353007076282043527) },
+      { -INT64_C( 1537542855754468023),  INT64_C( 6353007076282043527) } },
+    { { -INT64_C( 1876826281843748842), -INT64_C(  635077388872073622) },
+      UINT8_C(  2),
+      {  INT64_C( 5058876284487642925), -INT64_C( 2479741533021842986) },
+      { -INT64_C( 2479741533021842986), -INT64_C(  635077388872073622) } },
+    { {  INT64_C( 2586854339733635196),  INT64_C( 3897304796124053221) },
+      UINT8_C(  3),
+      { -INT64_C( 7529890132306232850), -INT64_C( 2997672230842899966) },
+      { -INT64_C( 7529890132306232850), -INT64_C( 2997672230842899966) } },
+    { { -INT64_C( 5373520040059793478),  INT64_C( 3492802924175565824) },
+      UINT8_C(  0),
+      { -INT64_C( 5457115428791443173), -INT64_C( 8643408221706300059) },
+      { -INT64_C( 5373520040059793478),  INT64_C( 3492802924175565824) } },
+    { { -INT64_C( 8303729997058310196),  INT64_C(  980692047708291275) },
+      UINT8_C(  2),
+      { -INT64_C( 6854566212991384287),  INT64_C( 6983299882407518999) },
+      {  INT64_C( 6983299882407518999),  INT64_C(  980692047708291275) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi64(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_compress_epi64(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_compress_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[2];
+    const simde__mmask8 k;
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   341.41), SIMDE_FLOAT64_C(  -136.96) },
+      UINT8_C(  0),
+      { SIMDE_FLOAT64_C(  -263.55), SIMDE_FLOAT64_C(  -370.71) },
+      { SIMDE_FLOAT64_C(   341.41), SIMDE_FLOAT64_C(  -136.96) } },
+    { { SIMDE_FLOAT64_C(  -862.45), SIMDE_FLOAT64_C(   -85.93) },
+      UINT8_C(  3),
+      { SIMDE_FLOAT64_C(   546.96), SIMDE_FLOAT64_C(   763.18) },
+      { SIMDE_FLOAT64_C(   546.96), SIMDE_FLOAT64_C(   763.18) } },
+    { { SIMDE_FLOAT64_C(    62.21), SIMDE_FLOAT64_C(  -354.57) },
+      UINT8_C(  2),
+      { SIMDE_FLOAT64_C(  -275.91), SIMDE_FLOAT64_C(  -810.00) },
+      { SIMDE_FLOAT64_C(  -810.00), SIMDE_FLOAT64_C(  -354.57) } },
+    { { SIMDE_FLOAT64_C(  -651.55), SIMDE_FLOAT64_C(   628.45) },
+      UINT8_C(  2),
+      { SIMDE_FLOAT64_C(   535.30), SIMDE_FLOAT64_C(    70.03) },
+      { SIMDE_FLOAT64_C(    70.03), SIMDE_FLOAT64_C(   628.45) } },
+    { { SIMDE_FLOAT64_C(    21.97), SIMDE_FLOAT64_C(  -717.11) },
+      UINT8_C(  1),
+      { SIMDE_FLOAT64_C(   623.94), SIMDE_FLOAT64_C(  -782.71) },
+      { SIMDE_FLOAT64_C(   623.94), SIMDE_FLOAT64_C(  -717.11) } },
+    { { SIMDE_FLOAT64_C(   281.78), SIMDE_FLOAT64_C(   716.05) },
+      UINT8_C(  3),
+      { SIMDE_FLOAT64_C(  -300.03), SIMDE_FLOAT64_C(  -963.86) },
+      { SIMDE_FLOAT64_C(  -300.03), SIMDE_FLOAT64_C(  -963.86) } },
+    { { SIMDE_FLOAT64_C(   874.86), SIMDE_FLOAT64_C(   900.93) },
+      UINT8_C(  2),
+      { SIMDE_FLOAT64_C(  -200.01), SIMDE_FLOAT64_C(   669.95) },
+      { SIMDE_FLOAT64_C(   669.95), SIMDE_FLOAT64_C(   900.93) } },
+    { { SIMDE_FLOAT64_C(   686.96), SIMDE_FLOAT64_C(  -247.17) },
+      UINT8_C(  0),
+      { SIMDE_FLOAT64_C(  -563.55), SIMDE_FLOAT64_C(  -683.73) },
+      { SIMDE_FLOAT64_C(   686.96), SIMDE_FLOAT64_C(  -247.17) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d src = simde_mm_loadu_pd(test_vec[i].src);
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_mask_compress_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_compress_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[4];
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -517.49), SIMDE_FLOAT32_C(   151.42), SIMDE_FLOAT32_C(  -690.40), SIMDE_FLOAT32_C(  -571.76) },
+      UINT8_C(  0),
+      { SIMDE_FLOAT32_C(  -233.16), SIMDE_FLOAT32_C(   355.85), SIMDE_FLOAT32_C(   138.40), SIMDE_FLOAT32_C(  -738.22) },
+      { SIMDE_FLOAT32_C(  -517.49), SIMDE_FLOAT32_C(   151.42), SIMDE_FLOAT32_C(  -690.40), SIMDE_FLOAT32_C(  -571.76) } },
+    { { SIMDE_FLOAT32_C(  -235.28), SIMDE_FLOAT32_C(  -154.31), SIMDE_FLOAT32_C(  -160.12), SIMDE_FLOAT32_C(   483.01) },
+      UINT8_C( 15),
+      { SIMDE_FLOAT32_C(   229.10), SIMDE_FLOAT32_C(   614.68), SIMDE_FLOAT32_C(  -205.17), SIMDE_FLOAT32_C(  -809.96) },
+      { SIMDE_FLOAT32_C(   229.10), SIMDE_FLOAT32_C(   614.68), SIMDE_FLOAT32_C(  -205.17), SIMDE_FLOAT32_C(  -809.96) } },
+    { { SIMDE_FLOAT32_C(   614.72), SIMDE_FLOAT32_C(   989.20), SIMDE_FLOAT32_C(  -306.62), SIMDE_FLOAT32_C(   717.83) },
+      UINT8_C(  5),
+      { SIMDE_FLOAT32_C(    85.82), SIMDE_FLOAT32_C(  -693.20), SIMDE_FLOAT32_C(  -839.44), SIMDE_FLOAT32_C(   645.12) },
+      { SIMDE_FLOAT32_C(    85.82), SIMDE_FLOAT32_C(  -839.44), SIMDE_FLOAT32_C(  -306.62), SIMDE_FLOAT32_C(   717.83) } },
+    { { SIMDE_FLOAT32_C(   814.59), SIMDE_FLOAT32_C(   958.33), SIMDE_FLOAT32_C(   347.40), SIMDE_FLOAT32_C(  -926.20) },
+      UINT8_C(  8),
+      { SIMDE_FLOAT32_C(  -789.28), SIMDE_FLOAT32_C(   826.93), SIMDE_FLOAT32_C(   934.89), SIMDE_FLOAT32_C(  -719.89) },
+      { SIMDE_FLOAT32_C(  -719.89), SIMDE_FLOAT32_C(   958.33), SIMDE_FLOAT32_C(   347.40), SIMDE_FLOAT32_C(  -926.20) } },
+    { { SIMDE_FLOAT32_C(   536.65), SIMDE_FLOAT32_C(   283.42), SIMDE_FLOAT32_C(  -431.69), SIMDE_FLOAT32_C(   684.87) },
+      UINT8_C(  1),
+      { SIMDE_FLOAT32_C(   372.42), SIMDE_FLOAT32_C(   121.75), SIMDE_FLOAT32_C(   871.10), SIMDE_FLOAT32_C(   122.82) },
+      { SIMDE_FLOAT32_C(   372.42), SIMDE_FLOAT32_C(   283.42), SIMDE_FLOAT32_C(  -431.69), SIMDE_FLOAT32_C(   684.87) } },
+    { { SIMDE_FLOAT32_C(  -295.35), SIMDE_FLOAT32_C(   388.23), SIMDE_FLOAT32_C(  -150.86), SIMDE_FLOAT32_C(  -504.54) },
+      UINT8_C(  8),
+      { SIMDE_FLOAT32_C(  -808.85), SIMDE_FLOAT32_C(  -937.33), SIMDE_FLOAT32_C(  -732.96), SIMDE_FLOAT32_C(  -835.74) },
+      { SIMDE_FLOAT32_C(  -835.74), SIMDE_FLOAT32_C(   388.23), SIMDE_FLOAT32_C(  -150.86), SIMDE_FLOAT32_C(  -504.54) } },
+    { { SIMDE_FLOAT32_C(   187.76), SIMDE_FLOAT32_C(   920.48), SIMDE_FLOAT32_C(   -61.79), SIMDE_FLOAT32_C(  -279.68) },
+      UINT8_C(  0),
+      { SIMDE_FLOAT32_C(  -782.81), SIMDE_FLOAT32_C(  -736.83), SIMDE_FLOAT32_C(  -160.26), SIMDE_FLOAT32_C(   390.12) },
+      { SIMDE_FLOAT32_C(   187.76), SIMDE_FLOAT32_C(   920.48), SIMDE_FLOAT32_C(   -61.79), SIMDE_FLOAT32_C(  -279.68) } },
+    { { SIMDE_FLOAT32_C(   731.85), SIMDE_FLOAT32_C(  -171.98), SIMDE_FLOAT32_C(   496.36), SIMDE_FLOAT32_C(  -357.06) },
+      UINT8_C(  5),
+      { SIMDE_FLOAT32_C(  -362.10), SIMDE_FLOAT32_C(   366.21), SIMDE_FLOAT32_C(  -259.30), SIMDE_FLOAT32_C(  -714.64) },
+      { SIMDE_FLOAT32_C(  -362.10), SIMDE_FLOAT32_C(  -259.30), SIMDE_FLOAT32_C(   496.36), SIMDE_FLOAT32_C(  -357.06) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 src = simde_mm_loadu_ps(test_vec[i].src);
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_mask_compress_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_compress_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { -INT32_C(   140471898),  INT32_C(   260480984),  INT32_C(    67268265), -INT32_C(   318296676) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C( 15),
+      {  INT32_C(   818268847),  INT32_C(  2046749066),  INT32_C(  1867088575), -INT32_C(  1578870133) },
+      {  INT32_C(   818268847),  INT32_C(  2046749066),  INT32_C(  1867088575), -INT32_C(  1578870133) } },
+    { UINT8_C(  0),
+      {  INT32_C(  1963171521), -INT32_C(   735020387),  INT32_C(  1804743825), -INT32_C(  2105161069) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(  2),
+      { -INT32_C(  1041177737), -INT32_C(  1966241706),  INT32_C(  1659478159),  INT32_C(  1182278150) },
+      { -INT32_C(  1966241706),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(  1),
+      { -INT32_C(  1191627941), -INT32_C(    83120941),  INT32_C(   224206730),  INT32_C(   338975875) },
+      { -INT32_C(  1191627941),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(  9),
+      {  INT32_C(   695669115),  INT32_C(   108821223),  INT32_C(  2128848480),  INT32_C(  1724476864) },
+      {  INT32_C(   695669115),  INT32_C(  1724476864),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(  3),
+      {  INT32_C(  1160510637), -INT32_C(  1190794009),  INT32_C(   261392274), -INT32_C(  1351268089) },
+      {  INT32_C(  1160510637), -INT32_C(  1190794009),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(  2),
+      {  INT32_C(    46627302), -INT32_C(   316862476),  INT32_C(   399382606),  INT32_C(  1377993013) },
+      { -INT32_C(   316862476),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_compress_epi32(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_compress_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { -INT64_C( 2763832124880449484),  INT64_C( 1581357508230236252) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  3),
+      {  INT64_C( 3153135606855186813),  INT64_C( 8219140050960581377) },
+      {  INT64_C( 3153135606855186813),  INT64_C( 8219140050960581377) } },
+    { UINT8_C(  3),
+      {  INT64_C( 7679163235519522111), -INT64_C( 3827666831296244816) },
+      {  INT64_C( 7679163235519522111), -INT64_C( 3827666831296244816) } },
+    { UINT8_C(  2),
+      {  INT64_C( 9121353419311795849),  INT64_C( 5608112580453097036) },
+      {  INT64_C( 5608112580453097036),  INT64_C(                   0) } },
+    { UINT8_C(  3),
+      {  INT64_C( 6137139243343765865), -INT64_C( 2545137885601715505) },
+      {  INT64_C( 6137139243343765865), -INT64_C( 2545137885601715505) } },
+    { UINT8_C(  1),
+      {  INT64_C( 1162671070407058046), -INT64_C( 4291653917768512534) },
+      {  INT64_C( 1162671070407058046),  INT64_C(                   0) } },
+    { UINT8_C(  3),
+      { -INT64_C( 3506866297894633422), -INT64_C( 2457619625097983382) },
+      { -INT64_C( 3506866297894633422), -INT64_C( 2457619625097983382) } },
+    { UINT8_C(  3),
+      {  INT64_C( 6536905166165689270),  INT64_C( 7557395553503819852) },
+      {  INT64_C( 6536905166165689270),  INT64_C( 7557395553503819852) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_compress_epi64(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_compress_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { SIMDE_FLOAT64_C(   811.03), SIMDE_FLOAT64_C(  -970.47) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(  3),
+      { SIMDE_FLOAT64_C(  -270.33), SIMDE_FLOAT64_C(  -444.69) },
+      { SIMDE_FLOAT64_C(  -270.33), SIMDE_FLOAT64_C(  -444.69) } },
+    { UINT8_C(  0),
+      { SIMDE_FLOAT64_C(   738.61), SIMDE_FLOAT64_C(  -612.48) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(  3),
+      { SIMDE_FLOAT64_C(  -994.91), SIMDE_FLOAT64_C(   818.85) },
+      { SIMDE_FLOAT64_C(  -994.91), SIMDE_FLOAT64_C(   818.85) } },
+    { UINT8_C(  3),
+      { SIMDE_FLOAT64_C(  -597.65), SIMDE_FLOAT64_C(  -100.22) },
+      { SIMDE_FLOAT64_C(  -597.65), SIMDE_FLOAT64_C(  -100.22) } },
+    { UINT8_C(  1),
+      { SIMDE_FLOAT64_C(  -882.40), SIMDE_FLOAT64_C(   466.23) },
+      { SIMDE_FLOAT64_C(  -882.40), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(  3),
+      { SIMDE_FLOAT64_C(   501.40), SIMDE_FLOAT64_C(   -31.88) },
+      { SIMDE_FLOAT64_C(   501.40), SIMDE_FLOAT64_C(   -31.88) } },
+    { UINT8_C(  0),
+      { SIMDE_FLOAT64_C(    79.29), SIMDE_FLOAT64_C(  -253.15) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_maskz_compress_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_compress_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { SIMDE_FLOAT32_C(    45.04), SIMDE_FLOAT32_C(   339.36), SIMDE_FLOAT32_C(   -12.62), SIMDE_FLOAT32_C(  -396.33) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C( 15),
+      { SIMDE_FLOAT32_C(   565.03), SIMDE_FLOAT32_C(   204.81), SIMDE_FLOAT32_C(   100.10), SIMDE_FLOAT32_C(  -586.17) },
+      { SIMDE_FLOAT32_C(   565.03), SIMDE_FLOAT32_C(   204.81), SIMDE_FLOAT32_C(   100.10), SIMDE_FLOAT32_C(  -586.17) } },
+    { UINT8_C(  8),
+      { SIMDE_FLOAT32_C(   875.73), SIMDE_FLOAT32_C(  -689.20), SIMDE_FLOAT32_C(  -881.12), SIMDE_FLOAT32_C(  -493.16) },
+      { SIMDE_FLOAT32_C(  -493.16), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(  7),
+      { SIMDE_FLOAT32_C(  -290.08), SIMDE_FLOAT32_C(   224.65), SIMDE_FLOAT32_C(   -92.62), SIMDE_FLOAT32_C(   892.25) },
+      { SIMDE_FLOAT32_C(  -290.08), SIMDE_FLOAT32_C(   224.65), SIMDE_FLOAT32_C(   -92.62), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(  4),
+      { SIMDE_FLOAT32_C(   926.30), SIMDE_FLOAT32_C(   438.34), SIMDE_FLOAT32_C(  -973.02), SIMDE_FLOAT32_C(  -566.15) },
+      { SIMDE_FLOAT32_C(  -973.02), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(  5),
+      { SIMDE_FLOAT32_C(   304.47), SIMDE_FLOAT32_C(   673.74), SIMDE_FLOAT32_C(  -675.18), SIMDE_FLOAT32_C(  -571.18) },
+      { SIMDE_FLOAT32_C(   304.47), SIMDE_FLOAT32_C(  -675.18), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C( 11),
+      { SIMDE_FLOAT32_C(   418.91), SIMDE_FLOAT32_C(   510.24), SIMDE_FLOAT32_C(    88.71), SIMDE_FLOAT32_C(   492.34) },
+      { SIMDE_FLOAT32_C(   418.91), SIMDE_FLOAT32_C(   510.24), SIMDE_FLOAT32_C(   492.34), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C( 11),
+      { SIMDE_FLOAT32_C(   616.02), SIMDE_FLOAT32_C(  -281.01), SIMDE_FLOAT32_C(    25.05), SIMDE_FLOAT32_C(  -767.44) },
+      { SIMDE_FLOAT32_C(   616.02), SIMDE_FLOAT32_C(  -281.01), SIMDE_FLOAT32_C(  -767.44), SIMDE_FLOAT32_C(     0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_maskz_compress_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_compressstoreu_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      {  INT32_C(  1592915163), -INT32_C(   197242362),  INT32_C(  1259436319),  INT32_C(  1667224257) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C( 15),
+      {  INT32_C(  2015557497),  INT32_C(  1090099320),  INT32_C(   812397628), -INT32_C(  2111797806) },
+      {  INT32_C(  2015557497),  INT32_C(  1090099320),  INT32_C(   812397628), -INT32_C(  2111797806) } },
+    { UINT8_C( 10),
+      { -INT32_C(   439599459),  INT32_C(  1344949326),  INT32_C(   432949856),  INT32_C(  1703814825) },
+      {  INT32_C(  1344949326),  INT32_C(  1703814825),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(  1),
+      { -INT32_C(  1436407752), -INT32_C(   588012835),  INT32_C(   904666295),  INT32_C(  1101417129) },
+      { -INT32_C(  1436407752),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(  1),
+      {  INT32_C(  1602388956),  INT32_C(  1236295911), -INT32_C(   534079227), -INT32_C(  1181329243) },
+      {  INT32_C(  1602388956),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C( 15),
+      { -INT32_C(  1319007615),  INT32_C(   588740550), -INT32_C(      520489), -INT32_C(  1779117638) },
+      { -INT32_C(  1319007615),  INT32_C(   588740550), -INT32_C(      520489), -INT32_C(  1779117638) } },
+    { UINT8_C( 14),
+      { -INT32_C(   921439196), -INT32_C(   305495626),  INT32_C(  1775241756),  INT32_C(  1546960699) },
+      { -INT32_C(   305495626),  INT32_C(  1775241756),  INT32_C(  1546960699),  INT32_C(           0) } },
+    { UINT8_C(  0),
+      {  INT32_C(  1345101766),  INT32_C(   688077712),  INT32_C(  1837682041),  INT32_C(  1842929497) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    int32_t r[4] = { 0, };
+    simde_mm_mask_compressstoreu_epi32(r, test_vec[i].k, a);
+    simde_assert_equal_vi32(4, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_compressstoreu_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      {  INT64_C( 8073870689394763776),  INT64_C( 1773014968529030660) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  3),
+      {  INT64_C( 5381174869875746876),  INT64_C(   66406191651634722) },
+      {  INT64_C( 5381174869875746876),  INT64_C(   66406191651634722) } },
+    { UINT8_C(  1),
+      {  INT64_C( 6022509602505897673), -INT64_C( 1523426134566586587) },
+      {  INT64_C( 6022509602505897673),  INT64_C(                   0) } },
+    { UINT8_C(  2),
+      { -INT64_C( 4752315436198027029),  INT64_C( 4731752449121176717) },
+      {  INT64_C( 4731752449121176717),  INT64_C(                   0) } },
+    { UINT8_C(  2),
+      { -INT64_C( 8734439552860889720),  INT64_C( 8244437392542378123) },
+      {  INT64_C( 8244437392542378123),  INT64_C(                   0) } },
+    { UINT8_C(  2),
+      {  INT64_C(  472736618429080913),  INT64_C( 7916306514566108074) },
+      {  INT64_C( 7916306514566108074),  INT64_C(                   0) } },
+    { UINT8_C(  3),
+      { -INT64_C( 8485291558710449365), -INT64_C( 2252563454320760573) },
+      { -INT64_C( 8485291558710449365), -INT64_C( 2252563454320760573) } },
+    { UINT8_C(  1),
+      {  INT64_C( 5941973040705753584),  INT64_C( 6831352593836365224) },
+      {  INT64_C( 5941973040705753584),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    int64_t r[2] = { 0, };
+    simde_mm_mask_compressstoreu_epi64(r, test_vec[i].k, a);
+    simde_assert_equal_vi64(2, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_compressstoreu_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { SIMDE_FLOAT64_C(  -300.21), SIMDE_FLOAT64_C(  -281.70) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(  3),
+      { SIMDE_FLOAT64_C(   580.05), SIMDE_FLOAT64_C(   256.11) },
+      { SIMDE_FLOAT64_C(   580.05), SIMDE_FLOAT64_C(   256.11) } },
+    { UINT8_C(  0),
+      { SIMDE_FLOAT64_C(   627.23), SIMDE_FLOAT64_C(   838.48) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(  3),
+      { SIMDE_FLOAT64_C(  -193.95), SIMDE_FLOAT64_C(    68.19) },
+      { SIMDE_FLOAT64_C(  -193.95), SIMDE_FLOAT64_C(    68.19) } },
+    { UINT8_C(  0),
+      { SIMDE_FLOAT64_C(   708.95), SIMDE_FLOAT64_C(   640.26) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(  2),
+      { SIMDE_FLOAT64_C(    55.89), SIMDE_FLOAT64_C(  -975.31) },
+      { SIMDE_FLOAT64_C(  -975.31), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(  0),
+      { SIMDE_FLOAT64_C(  -502.38), SIMDE_FLOAT64_C(    43.15) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(  3),
+      { SIMDE_FLOAT64_C(   156.12), SIMDE_FLOAT64_C(  -555.45) },
+      { SIMDE_FLOAT64_C(   156.12), SIMDE_FLOAT64_C(  -555.45) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde_float64 r[2] = { 0, };
+    simde_mm_mask_compressstoreu_pd(r, test_vec[i].k, a);
+    simde_assert_equal_vf64(2, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_compressstoreu_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { SIMDE_FLOAT32_C(   390.26), SIMDE_FLOAT32_C(   962.54), SIMDE_FLOAT32_C(   748.77), SIMDE_FLOAT32_C(   -75.98) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C( 15),
+      { SIMDE_FLOAT32_C(  -867.41), SIMDE_FLOAT32_C(   113.73), SIMDE_FLOAT32_C(   292.61), SIMDE_FLOAT32_C(   933.19) },
+      { SIMDE_FLOAT32_C(  -867.41), SIMDE_FLOAT32_C(   113.73), SIMDE_FLOAT32_C(   292.61), SIMDE_FLOAT32_C(   933.19) } },
+    { UINT8_C(  1),
+      { SIMDE_FLOAT32_C(   209.96), SIMDE_FLOAT32_C(    -4.37), SIMDE_FLOAT32_C(  -957.78), SIMDE_FLOAT32_C(   -14.10) },
+      { SIMDE_FLOAT32_C(   209.96), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C( 15),
+      { SIMDE_FLOAT32_C(  -358.52), SIMDE_FLOAT32_C(  -325.14), SIMDE_FLOAT32_C(    34.57), SIMDE_FLOAT32_C(  -941.78) },
+      { SIMDE_FLOAT32_C(  -358.52), SIMDE_FLOAT32_C(  -325.14), SIMDE_FLOAT32_C(    34.57), SIMDE_FLOAT32_C(  -941.78) } },
+    { UINT8_C( 11),
+      { SIMDE_FLOAT32_C(   815.88), SIMDE_FLOAT32_C(  -648.80), SIMDE_FLOAT32_C(   187.60), SIMDE_FLOAT32_C(   -97.74) },
+      { SIMDE_FLOAT32_C(   815.88), SIMDE_FLOAT32_C(  -648.80), SIMDE_FLOAT32_C(   -97.74), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(  5),
+      { SIMDE_FLOAT32_C(  -154.64), SIMDE_FLOAT32_C(   573.84), SIMDE_FLOAT32_C(   499.37), SIMDE_FLOAT32_C(   730.71) },
+      { SIMDE_FLOAT32_C(  -154.64), SIMDE_FLOAT32_C(   499.37), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(  1),
+      { SIMDE_FLOAT32_C(  -144.03), SIMDE_FLOAT32_C(   676.45), SIMDE_FLOAT32_C(  -521.30), SIMDE_FLOAT32_C(   969.22) },
+      { SIMDE_FLOAT32_C(  -144.03), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C( 11),
+      { SIMDE_FLOAT32_C(   435.48), SIMDE_FLOAT32_C(   890.18), SIMDE_FLOAT32_C(  -612.39), SIMDE_FLOAT32_C(   187.33) },
+      { SIMDE_FLOAT32_C(   435.48), SIMDE_FLOAT32_C(   890.18), SIMDE_FLOAT32_C(   187.33), SIMDE_FLOAT32_C(     0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde_float32 r[4] = { 0, };
+    simde_mm_mask_compressstoreu_ps(r, test_vec[i].k, a);
+    simde_assert_equal_vf32(4, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_compress_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { {  INT32_C(   294029629), -INT32_C(  2003861307),  INT32_C(  1206305571), -INT32_C(   607642947),  INT32_C(  1635626524),  INT32_C(   277986975),  INT32_C(   210612290), -INT32_C(   302213126) },
+      UINT8_C(  0),
+      { -INT32_C(   254339692), -INT32_C(   161831589), -INT32_C(    16023373),  INT32_C(   468893570), -INT32_C(    99688621),  INT32_C(   534028151), -INT32_C(  2071381167), -INT32_C(  1245830521) },
+      {  INT32_C(   294029629), -INT32_C(  2003861307),  INT32_C(  1206305571), -INT32_C(   607642947),  INT32_C(  1635626524),  INT32_C(   277986975),  INT32_C(   210612290), -INT32_C(   302213126) } },
+    { {  INT32_C(   531271949),  INT32_C(  1350323411), -INT32_C(   186317900),  INT32_C(  1185668251), -INT32_C(  1318227060),  INT32_C(   415888408),  INT32_C(  2110148658), -INT32_C(   506534585) },
+      UINT8_C(255),
+      {  INT32_C(   750739285), -INT32_C(  1553003564), -INT32_C(   414376032), -INT32_C(  1423738976), -INT32_C(   514597776), -INT32_C(   693907876), -INT32_C(   445306557), -INT32_C(  1652240458) },
+      {  INT32_C(   750739285), -INT32_C(  1553003564), -INT32_C(   414376032), -INT32_C(  1423738976), -INT32_C(   514597776), -INT32_C(   693907876), -INT32_C(   445306557), -INT32_C(  1652240458) } },
+    { { -INT32_C(  1415831466), -INT32_C(  1696997368), -INT32_C(   870842127),  INT32_C(  1010305681),  INT32_C(   663252998),  INT32_C(  1439576793), -INT32_C(  1693644949), -INT32_C(  1222032394) },
+      UINT8_C( 80),
+      { -INT32_C(   247898805),  INT32_C(  1452918832),  INT32_C(   991951904),  INT32_C(  1307315857), -INT32_C(  1840596667),  INT32_C(  2122919237),  INT32_C(   188460086),  INT32_C(   536617629) },
+      { -INT32_C(  1840596667),  INT32_C(   188460086), -INT32_C(   870842127),  INT32_C(  1010305681),  INT32_C(   663252998),  INT32_C(  1439576793), -INT32_C(  1693644949), -INT32_C(  1222032394) } },
+    { {  INT32_C(  1306154217),  INT32_C(   943339227),  INT32_C(    88187994),  INT32_C(  1593047803),  INT32_C(   657677186), -INT32_C(  1669673711),  INT32_C(   812562763),  INT32_C(   811614790) },
+      UINT8_C(148),
+      { -INT32_C(   558945997), -INT32_C(   882274589),  INT32_C(  1127598712),  INT32_C(  1237455555),  INT32_C(   120703181), -INT32_C(  2011823967), -INT32_C(    25091789), -INT32_C(   407083829) },
+      {  INT32_C(  1127598712),  INT32_C(   120703181), -INT32_C(   407083829),  INT32_C(  1593047803),  INT32_C(   657677186), -INT32_C(  1669673711),  INT32_C(   812562763),  INT32_C(   811614790) } },
+    { { -INT32_C(  1332638602),  INT32_C(   391104163), -INT32_C(   948184359),  INT32_C(  2101984886),  INT32_C(   169405221),  INT32_C(  2034078802),  INT32_C(  2043950777), -INT32_C(   432091843) },
+      UINT8_C(245),
+      { -INT32_C(   554309560), -INT32_C(  1882417911), -INT32_C(  2092989376), -INT32_C(   963150900),  INT32_C(  1254955271), -INT32_C(   771475848),  INT32_C(   817312043),  INT32_C(  1540411384) },
+      { -INT32_C(   554309560), -INT32_C(  2092989376),  INT32_C(  1254955271), -INT32_C(   771475848),  INT32_C(   817312043),  INT32_C(  1540411384),  INT32_C(  2043950777), -INT32_C(   432091843) } },
+    { {  INT32_C(   155517291), -INT32_C(  2121653019),  INT32_C(   806149614), -INT32_C(  1611780598),  INT32_C(   308416088), -INT32_C(  2040867932), -INT32_C(  1219157223), -INT32_C(  1748755968) },
+      UINT8_C( 91),
+      {  INT32_C(  1436168232),  INT32_C(  1754893471), -INT32_C(   674205574), -INT32_C(  1773400972), -INT32_C(   105624893),  INT32_C(   686521314), -INT32_C(   676538988), -INT32_C(  1554699314) },
+      {  INT32_C(  1436168232),  INT32_C(  1754893471), -INT32_C(  1773400972), -INT32_C(   105624893), -INT32_C(   676538988), -INT32_C(  2040867932), -INT32_C(  1219157223), -INT32_C(  1748755968) } },
+    { { -INT32_C(  1528598132), -INT32_C(  1839300887),  INT32_C(   904021123), -INT32_C(  2147308189), -INT32_C(  1147225763),  INT32_C(  1047194510),  INT32_C(  1948804674), -INT32_C(   444423202) },
+      UINT8_C(129),
+      {  INT32_C(  1078653263), -INT32_C(  1763998658), -INT32_C(   562390657),  INT32_C(    14228771), -INT32_C(   946423398),  INT32_C(  1317909056), -INT32_C(  1452829594), -INT32_C(   525781018) },
+      {  INT32_C(  1078653263), -INT32_C(   525781018),  INT32_C(   904021123), -INT32_C(  2147308189), -INT32_C(  1147225763),  INT32_C(  1047194510),  INT32_C(  1948804674), -INT32_C(   444423202) } },
+    { { -INT32_C(   647911793), -INT32_C(   202497922), -INT32_C(  1721398680), -INT32_C(   774191124), -INT32_C(   252983714), -INT32_C(   362617539), -INT32_C(  1460150581), -INT32_C(  1985176717) },
+      UINT8_C(178),
+      {  INT32_C(  2097261265),  INT32_C(  1964207991), -INT32_C(   634375019), -INT32_C(  1836606733), -INT32_C(  1958537345),  INT32_C(   386894410),  INT32_C(   986805525), -INT32_C(  2077833768) },
+      {  INT32_C(  1964207991), -INT32_C(  1958537345),  INT32_C(   386894410), -INT32_C(  2077833768), -INT32_C(   252983714), -INT32_C(   362617539), -INT32_C(  1460150581), -INT32_C(  1985176717) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_compress_epi32(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_compress_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[4];
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { { -INT64_C( 1797009972905822248), -INT64_C( 7788927176574557212),  INT64_C( 4209449295755119562),  INT64_C( 2283509299946016238) },
+      UINT8_C(  0),
+      {  INT64_C( 3916450279229545856),  INT64_C(   96672882374961088),  INT64_C(   67493134455962811),  INT64_C( 3443679610078754878) },
+      { -INT64_C( 1797009972905822248), -INT64_C( 7788927176574557212),  INT64_C( 4209449295755119562),  INT64_C( 2283509299946016238) } },
+    { { -INT64_C( 3657633949561890673),  INT64_C( 6653004203774288384),  INT64_C( 8544945426081625124),  INT64_C( 6561683414736885750) },
+      UINT8_C( 15),
+      {  INT64_C(  174160272633638645), -INT64_C( 1285768742258688056), -INT64_C(  977061549139240675),  INT64_C( 3909219615245246259) },
+      {  INT64_C(  174160272633638645), -INT64_C( 1285768742258688056), -INT64_C(  977061549139240675),  INT64_C( 3909219615245246259) } },
+    { { -INT64_C( 7860580129412056887),  INT64_C( 4212246382148193433),  INT64_C( 2690746693642849800), -INT64_C( 5136941441784687861) },
+      UINT8_C(  0),
+      {  INT64_C( 7080407948852073637), -INT64_C( 8835505517174051722), -INT64_C( 2387535977641884194), -INT64_C( 5986991723636613459) },
+      { -INT64_C( 7860580129412056887),  INT64_C( 4212246382148193433),  INT64_C( 2690746693642849800), -INT64_C( 5136941441784687861) } },
+    { {  INT64_C( 3578913824541512818), -INT64_C( 1400850713755710127),  INT64_C( 4260244188859312351),  INT64_C( 5447742522391246997) },
+      UINT8_C(  1),
+      { -INT64_C( 8120638742681935497), -INT64_C( 2116827743189401184), -INT64_C( 7041145108656867499),  INT64_C( 4691042214215509761) },
+      { -INT64_C( 8120638742681935497), -INT64_C( 1400850713755710127),  INT64_C( 4260244188859312351),  INT64_C( 5447742522391246997) } },
+    { { -INT64_C( 4029886215598836308), -INT64_C( 6222177286994960577),  INT64_C( 8654322593120465286),  INT64_C( 5781032244791668658) },
+      UINT8_C( 12),
+      {  INT64_C( 6198284999372597306), -INT64_C( 4669912113523467664),  INT64_C( 3559531428928869826), -INT64_C( 6984046746451183901) },
+      {  INT64_C( 3559531428928869826), -INT64_C( 6984046746451183901),  INT64_C( 8654322593120465286),  INT64_C( 5781032244791668658) } },
+    { { -INT64_C( 3626253730593038987),  INT64_C( 7309870638267685296), -INT64_C( 1039007777648537451),  INT64_C(  132881056648263234) },
+      UINT8_C(  1),
+      {  INT64_C(  310378544218278753),  INT64_C( 1986343952946237938),  INT64_C(  906746544712007441),  INT64_C( 8451298458013382730) },
+      {  INT64_C(  310378544218278753),  INT64_C( 7309870638267685296), -INT64_C( 1039007777648537451),  INT64_C(  132881056648263234) } },
+    { { -INT64_C( 5974144969922099230),  INT64_C( 4063626774022537664),  INT64_C( 2997982518747580982),  INT64_C( 7302990886369946467) },
+      UINT8_C(  7),
+      {  INT64_C( 7693811591865996073), -INT64_C( 8054490684259294104), -INT64_C( 8304192565802729245),  INT64_C( 2776253409309237937) },
+      {  INT64_C( 7693811591865996073), -INT64_C( 8054490684259294104), -INT64_C( 8304192565802729245),  INT64_C( 7302990886369946467) } },
+    { { -INT64_C( 1007642323426058678), -INT64_C( 5541959106084990725),  INT64_C( 8237844031860381804),  INT64_C( 5645892083217864282) },
+      UINT8_C( 12),
+      { -INT64_C( 6932082137331590210),  INT64_C( 7813263889703940562), -INT64_C( 6488872267815430032),  INT64_C( 3029304984095681658) },
+      { -INT64_C( 6488872267815430032),  INT64_C( 3029304984095681658),  INT64_C( 8237844031860381804),  INT64_C( 5645892083217864282) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi64(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_compress_epi64(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_compress_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[4];
+    const simde__mmask8 k;
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -334.06), SIMDE_FLOAT64_C(   665.68), SIMDE_FLOAT64_C(   948.40), SIMDE_FLOAT64_C(  -101.38) },
+      UINT8_C(  0),
+      { SIMDE_FLOAT64_C(   772.58), SIMDE_FLOAT64_C(  -699.84), SIMDE_FLOAT64_C(  -929.97), SIMDE_FLOAT64_C(   561.40) },
+      { SIMDE_FLOAT64_C(  -334.06), SIMDE_FLOAT64_C(   665.68), SIMDE_FLOAT64_C(   948.40), SIMDE_FLOAT64_C(  -101.38) } },
+    { { SIMDE_FLOAT64_C(   762.22), SIMDE_FLOAT64_C(   513.34), SIMDE_FLOAT64_C(  -278.03), SIMDE_FLOAT64_C(  -560.19) },
+      UINT8_C( 15),
+      { SIMDE_FLOAT64_C(  -271.62), SIMDE_FLOAT64_C(  -140.57), SIMDE_FLOAT64_C(   127.18), SIMDE_FLOAT64_C(  -144.13) },
+      { SIMDE_FLOAT64_C(  -271.62), SIMDE_FLOAT64_C(  -140.57), SIMDE_FLOAT64_C(   127.18), SIMDE_FLOAT64_C(  -144.13) } },
+    { { SIMDE_FLOAT64_C(   610.13), SIMDE_FLOAT64_C(  -685.74), SIMDE_FLOAT64_C(  -705.09), SIMDE_FLOAT64_C(  -481.09) },
+      UINT8_C( 13),
+      { SIMDE_FLOAT64_C(   256.11), SIMDE_FLOAT64_C(    54.43), SIMDE_FLOAT64_C(  -499.26), SIMDE_FLOAT64_C(   327.56) },
+      { SIMDE_FLOAT64_C(   256.11), SIMDE_FLOAT64_C(  -499.26), SIMDE_FLOAT64_C(   327.56), SIMDE_FLOAT64_C(  -481.09) } },
+    { { SIMDE_FLOAT64_C(  -577.83), SIMDE_FLOAT64_C(   685.90), SIMDE_FLOAT64_C(  -182.11), SIMDE_FLOAT64_C(   414.98) },
+      UINT8_C( 14),
+      { SIMDE_FLOAT64_C(   436.49), SIMDE_FLOAT64_C(   939.06), SIMDE_FLOAT64_C(  -258.72), SIMDE_FLOAT64_C(   852.60) },
+      { SIMDE_FLOAT64_C(   939.06), SIMDE_FLOAT64_C(  -258.72), SIMDE_FLOAT64_C(   852.60), SIMDE_FLOAT64_C(   414.98) } },
+    { { SIMDE_FLOAT64_C(  -670.68), SIMDE_FLOAT64_C(   368.77), SIMDE_FLOAT64_C(    41.24), SIMDE_FLOAT64_C(  -847.92) },
+      UINT8_C(  0),
+      { SIMDE_FLOAT64_C(  -345.31), SIMDE_FLOAT64_C(   288.09), SIMDE_FLOAT64_C(  -620.35), SIMDE_FLOAT64_C(   975.45) },
+      { SIMDE_FLOAT64_C(  -670.68), SIMDE_FLOAT64_C(   368.77), SIMDE_FLOAT64_C(    41.24), SIMDE_FLOAT64_C(  -847.92) } },
+    { { SIMDE_FLOAT64_C(   783.49), SIMDE_FLOAT64_C(   315.64), SIMDE_FLOAT64_C(   592.07), SIMDE_FLOAT64_C(   769.84) },
+      UINT8_C(  8),
+      { SIMDE_FLOAT64_C(  -654.46), SIMDE_FLOAT64_C(  -675.91), SIMDE_FLOAT64_C(  -803.53), SIMDE_FLOAT64_C(   557.26) },
+      { SIMDE_FLOAT64_C(   557.26), SIMDE_FLOAT64_C(   315.64), SIMDE_FLOAT64_C(   592.07), SIMDE_FLOAT64_C(   769.84) } },
+    { { SIMDE_FLOAT64_C(   734.53), SIMDE_FLOAT64_C(    74.76), SIMDE_FLOAT64_C(  -246.46), SIMDE_FLOAT64_C(   581.58) },
+      UINT8_C(  8),
+      { SIMDE_FLOAT64_C(  -576.25), SIMDE_FLOAT64_C(   900.77), SIMDE_FLOAT64_C(   -17.42), SIMDE_FLOAT64_C(   -32.22) },
+      { SIMDE_FLOAT64_C(   -32.22), SIMDE_FLOAT64_C(    74.76), SIMDE_FLOAT64_C(  -246.46), SIMDE_FLOAT64_C(   581.58) } },
+    { { SIMDE_FLOAT64_C(  -254.76), SIMDE_FLOAT64_C(  -450.87), SIMDE_FLOAT64_C(  -741.41), SIMDE_FLOAT64_C(  -379.06) },
+      UINT8_C(  9),
+      { SIMDE_FLOAT64_C(   364.57), SIMDE_FLOAT64_C(   959.20), SIMDE_FLOAT64_C(  -359.42), SIMDE_FLOAT64_C(  -796.45) },
+      { SIMDE_FLOAT64_C(   364.57), SIMDE_FLOAT64_C(  -796.45), SIMDE_FLOAT64_C(  -741.41), SIMDE_FLOAT64_C(  -379.06) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d src = simde_mm256_loadu_pd(test_vec[i].src);
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde__m256d r = simde_mm256_mask_compress_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_compress_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[8];
+    const simde__mmask8 k;
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   958.61), SIMDE_FLOAT32_C(  -543.53), SIMDE_FLOAT32_C(   270.86), SIMDE_FLOAT32_C(  -206.51),
+        SIMDE_FLOAT32_C(   510.35), SIMDE_FLOAT32_C(  -609.29), SIMDE_FLOAT32_C(   368.04), SIMDE_FLOAT32_C(   496.65) },
+      UINT8_C(  0),
+      { SIMDE_FLOAT32_C(   934.33), SIMDE_FLOAT32_C(  -526.07), SIMDE_FLOAT32_C(   452.71), SIMDE_FLOAT32_C(  -414.06),
+        SIMDE_FLOAT32_C(   446.72), SIMDE_FLOAT32_C(   390.44), SIMDE_FLOAT32_C(  -618.93), SIMDE_FLOAT32_C(   623.87) },
+      { SIMDE_FLOAT32_C(   958.61), SIMDE_FLOAT32_C(  -543.53), SIMDE_FLOAT32_C(   270.86), SIMDE_FLOAT32_C(  -206.51),
+        SIMDE_FLOAT32_C(   510.35), SIMDE_FLOAT32_C(  -609.29), SIMDE_FLOAT32_C(   368.04), SIMDE_FLOAT32_C(   496.65) } },
+    { { SIMDE_FLOAT32_C(  -496.85), SIMDE_FLOAT32_C(  -703.85), SIMDE_FLOAT32_C(   352.69), SIMDE_FLOAT32_C(   468.61),
+        SIMDE_FLOAT32_C(   231.14), SIMDE_FLOAT32_C(  -466.07), SIMDE_FLOAT32_C(  -808.49), SIMDE_FLOAT32_C(  -503.19) },
+      UINT8_C(255),
+      { SIMDE_FLOAT32_C(   -55.85), SIMDE_FLOAT32_C(   179.93), SIMDE_FLOAT32_C(   890.70), SIMDE_FLOAT32_C(  -389.36),
+        SIMDE_FLOAT32_C(  -616.99), SIMDE_FLOAT32_C(    76.13), SIMDE_FLOAT32_C(   132.92), SIMDE_FLOAT32_C(  -433.76) },
+      { SIMDE_FLOAT32_C(   -55.85), SIMDE_FLOAT32_C(   179.93), SIMDE_FLOAT32_C(   890.70), SIMDE_FLOAT32_C(  -389.36),
+        SIMDE_FLOAT32_C(  -616.99), SIMDE_FLOAT32_C(    76.13), SIMDE_FLOAT32_C(   132.92), SIMDE_FLOAT32_C(  -433.76) } },
+    { { SIMDE_FLOAT32_C(  -786.86), SIMDE_FLOAT32_C(  -763.01), SIMDE_FLOAT32_C(  -524.29), SIMDE_FLOAT32_C(  -471.69),
+        SIMDE_FLOAT32_C(   -34.70), SIMDE_FLOAT32_C(  -566.63), SIMDE_FLOAT32_C(  -113.27), SIMDE_FLOAT32_C(  -740.11) },
+      UINT8_C(235),
+      { SIMDE_FLOAT32_C(   363.85), SIMDE_FLOAT32_C(     1.60), SIMDE_FLOAT32_C(  -763.09), SIMDE_FLOAT32_C(   327.84),
+        SIMDE_FLOAT32_C(   916.45), SIMDE_FLOAT32_C(    -0.64), SIMDE_FLOAT32_C(   857.69), SIMDE_FLOAT32_C(   120.56) },
+      { SIMDE_FLOAT32_C(   363.85), SIMDE_FLOAT32_C(     1.60), SIMDE_FLOAT32_C(   327.84), SIMDE_FLOAT32_C(    -0.64),
+        SIMDE_FLOAT32_C(   857.69), SIMDE_FLOAT32_C(   120.56), SIMDE_FLOAT32_C(  -113.27), SIMDE_FLOAT32_C(  -740.11) } },
+    { { SIMDE_FLOAT32_C(  -595.49), SIMDE_FLOAT32_C(   223.62), SIMDE_FLOAT32_C(     0.47), SIMDE_FLOAT32_C(  -359.18),
+        SIMDE_FLOAT32_C(  -769.30), SIMDE_FLOAT32_C(  -661.52), SIMDE_FLOAT32_C(  -928.88), SIMDE_FLOAT32_C(  -146.21) },
+      UINT8_C(172),
+      { SIMDE_FLOAT32_C(   397.83), SIMDE_FLOAT32_C(   653.59), SIMDE_FLOAT32_C(  -571.37), SIMDE_FLOAT32_C(   541.99),
+        SIMDE_FLOAT32_C(   343.57), SIMDE_FLOAT32_C(   270.07), SIMDE_FLOAT32_C(  -733.59), SIMDE_FLOAT32_C(   152.98) },
+      { SIMDE_FLOAT32_C(  -571.37), SIMDE_FLOAT32_C(   541.99), SIMDE_FLOAT32_C(   270.07), SIMDE_FLOAT32_C(   152.98),
+        SIMDE_FLOAT32_C(  -769.30), SIMDE_FLOAT32_C(  -661.52), SIMDE_FLOAT32_C(  -928.88), SIMDE_FLOAT32_C(  -146.21) } },
+    { { SIMDE_FLOAT32_C(  -863.40), SIMDE_FLOAT32_C(   900.94), SIMDE_FLOAT32_C(   934.84), SIMDE_FLOAT32_C(   520.99),
+        SIMDE_FLOAT32_C(  -898.46), SIMDE_FLOAT32_C(  -239.94), SIMDE_FLOAT32_C(   367.47), SIMDE_FLOAT32_C(  -883.92) },
+      UINT8_C(211),
+      { SIMDE_FLOAT32_C(   278.38), SIMDE_FLOAT32_C(   979.63), SIMDE_FLOAT32_C(   756.20), SIMDE_FLOAT32_C(  -859.26),
+        SIMDE_FLOAT32_C(   530.14), SIMDE_FLOAT32_C(   870.68), SIMDE_FLOAT32_C(  -866.62), SIMDE_FLOAT32_C(   400.30) },
+      { SIMDE_FLOAT32_C(   278.38), SIMDE_FLOAT32_C(   979.63), SIMDE_FLOAT32_C(   530.14), SIMDE_FLOAT32_C(  -866.62),
+        SIMDE_FLOAT32_C(   400.30), SIMDE_FLOAT32_C(  -239.94), SIMDE_FLOAT32_C(   367.47), SIMDE_FLOAT32_C(  -883.92) } },
+    { { SIMDE_FLOAT32_C(   324.42), SIMDE_FLOAT32_C(   994.22), SIMDE_FLOAT32_C(  -784.62), SIMDE_FLOAT32_C(   317.34),
+        SIMDE_FLOAT32_C(   486.29), SIMDE_FLOAT32_C(   307.38), SIMDE_FLOAT32_C(   -71.18), SIMDE_FLOAT32_C(  -709.28) },
+      UINT8_C(139),
+      { SIMDE_FLOAT32_C(  -745.50), SIMDE_FLOAT32_C(   -75.37), SIMDE_FLOAT32_C(  -876.39), SIMDE_FLOAT32_C(   -89.73),
+        SIMDE_FLOAT32_C(   297.72), SIMDE_FLOAT32_C(  -839.05), SIMDE_FLOAT32_C(  -859.77), SIMDE_FLOAT32_C(   167.29) },
+      { SIMDE_FLOAT32_C(  -745.50), SIMDE_FLOAT32_C(   -75.37), SIMDE_FLOAT32_C(   -89.73), SIMDE_FLOAT32_C(   167.29),
+        SIMDE_FLOAT32_C(   486.29), SIMDE_FLOAT32_C(   307.38), SIMDE_FLOAT32_C(   -71.18), SIMDE_FLOAT32_C(  -709.28) } },
+    { { SIMDE_FLOAT32_C(  -731.30), SIMDE_FLOAT32_C(   350.96), SIMDE_FLOAT32_C(  -285.97), SIMDE_FLOAT32_C(    35.43),
+        SIMDE_FLOAT32_C(  -820.88), SIMDE_FLOAT32_C(   860.24), SIMDE_FLOAT32_C(  -250.69), SIMDE_FLOAT32_C(   255.92) },
+      UINT8_C( 14),
+      { SIMDE_FLOAT32_C(  -897.64), SIMDE_FLOAT32_C(  -846.44), SIMDE_FLOAT32_C(  -409.67), SIMDE_FLOAT32_C(   301.36),
+        SIMDE_FLOAT32_C(   654.63), SIMDE_FLOAT32_C(  -500.67), SIMDE_FLOAT32_C(   847.50), SIMDE_FLOAT32_C(   640.70) },
+      { SIMDE_FLOAT32_C(  -846.44), SIMDE_FLOAT32_C(  -409.67), SIMDE_FLOAT32_C(   301.36), SIMDE_FLOAT32_C(    35.43),
+        SIMDE_FLOAT32_C(  -820.88), SIMDE_FLOAT32_C(   860.24), SIMDE_FLOAT32_C(  -250.69), SIMDE_FLOAT32_C(   255.92) } },
+    { { SIMDE_FLOAT32_C(   339.83), SIMDE_FLOAT32_C(  -465.43), SIMDE_FLOAT32_C(  -383.31), SIMDE_FLOAT32_C(   -56.26),
+        SIMDE_FLOAT32_C(   979.76), SIMDE_FLOAT32_C(   342.24), SIMDE_FLOAT32_C(  -883.47), SIMDE_FLOAT32_C(  -190.73) },
+      UINT8_C(210),
+      { SIMDE_FLOAT32_C(  -670.66), SIMDE_FLOAT32_C(  -147.41), SIMDE_FLOAT32_C(  -884.13), SIMDE_FLOAT32_C(   312.48),
+        SIMDE_FLOAT32_C(  -768.05), SIMDE_FLOAT32_C(   398.63), SIMDE_FLOAT32_C(  -417.76), SIMDE_FLOAT32_C(  -301.48) },
+      { SIMDE_FLOAT32_C(  -147.41), SIMDE_FLOAT32_C(  -768.05), SIMDE_FLOAT32_C(  -417.76), SIMDE_FLOAT32_C(  -301.48),
+        SIMDE_FLOAT32_C(   979.76), SIMDE_FLOAT32_C(   342.24), SIMDE_FLOAT32_C(  -883.47), SIMDE_FLOAT32_C(  -190.73) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 src = simde_mm256_loadu_ps(test_vec[i].src);
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m256 r = simde_mm256_mask_compress_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_compress_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { -INT32_C(  1868710358),  INT32_C(   479560383), -INT32_C(  1885155920),  INT32_C(   340136998),  INT32_C(  1274058704), -INT32_C(   255216501),  INT32_C(   536104587),  INT32_C(  1876729605) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(255),
+      {  INT32_C(  1447493403),  INT32_C(  1714475472),  INT32_C(   834566202),  INT32_C(   607153347), -INT32_C(  1312913494),  INT32_C(  1693550124), -INT32_C(   776276578), -INT32_C(  2102823522) },
+      {  INT32_C(  1447493403),  INT32_C(  1714475472),  INT32_C(   834566202),  INT32_C(   607153347), -INT32_C(  1312913494),  INT32_C(  1693550124), -INT32_C(   776276578), -INT32_C(  2102823522) } },
+    { UINT8_C( 53),
+      { -INT32_C(   768200684),  INT32_C(   161103079),  INT32_C(  1077578089),  INT32_C(  1000248792), -INT32_C(  1993876293), -INT32_C(  1992976812),  INT32_C(     7010688),  INT32_C(   100455332) },
+      { -INT32_C(   768200684),  INT32_C(  1077578089), -INT32_C(  1993876293), -INT32_C(  1992976812),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(209),
+      {  INT32_C(  1206156352),  INT32_C(     4490065), -INT32_C(  2017837550),  INT32_C(  1435426252), -INT32_C(  1175660791),  INT32_C(   133086638), -INT32_C(   511752857),  INT32_C(   196256208) },
+      {  INT32_C(  1206156352), -INT32_C(  1175660791), -INT32_C(   511752857),  INT32_C(   196256208),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(224),
+      {  INT32_C(  1127189050), -INT32_C(   351298861),  INT32_C(  1094529438), -INT32_C(   629621911), -INT32_C(   563198737),  INT32_C(   774787293),  INT32_C(   454648318), -INT32_C(  1420851507) },
+      {  INT32_C(   774787293),  INT32_C(   454648318), -INT32_C(  1420851507),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(223),
+      { -INT32_C(  1371131727), -INT32_C(  1816625947), -INT32_C(   688315500), -INT32_C(  1886385461),  INT32_C(  1067873358), -INT32_C(   985060507),  INT32_C(   162197980), -INT32_C(   207436981) },
+      { -INT32_C(  1371131727), -INT32_C(  1816625947), -INT32_C(   688315500), -INT32_C(  1886385461),  INT32_C(  1067873358),  INT32_C(   162197980), -INT32_C(   207436981),  INT32_C(           0) } },
+    { UINT8_C(213),
+      {  INT32_C(  1679581790), -INT32_C(  2079524892),  INT32_C(  1202345671),  INT32_C(  1129122133), -INT32_C(   662343335),  INT32_C(   558889137), -INT32_C(  1791276673),  INT32_C(  1300368412) },
+      {  INT32_C(  1679581790),  INT32_C(  1202345671), -INT32_C(   662343335), -INT32_C(  1791276673),  INT32_C(  1300368412),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(165),
+      {  INT32_C(  1981170258), -INT32_C(   265888378),  INT32_C(  1027162423), -INT32_C(   236575007), -INT32_C(   955565678),  INT32_C(   864994238), -INT32_C(  1032009877), -INT32_C(  1323091089) },
+      {  INT32_C(  1981170258),  INT32_C(  1027162423),  INT32_C(   864994238), -INT32_C(  1323091089),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_compress_epi32(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_compress_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { -INT64_C(  321441435770876470),  INT64_C( 2078300159509273112),  INT64_C(  608628662012698610),  INT64_C( 7868733240788336076) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 15),
+      { -INT64_C( 2670303286706210007), -INT64_C( 2395066604672919305), -INT64_C( 3648570525258059021), -INT64_C( 4958515654337605080) },
+      { -INT64_C( 2670303286706210007), -INT64_C( 2395066604672919305), -INT64_C( 3648570525258059021), -INT64_C( 4958515654337605080) } },
+    { UINT8_C( 15),
+      { -INT64_C( 7015104811441018039),  INT64_C( 2719745472090840315),  INT64_C( 4649695776828593925),  INT64_C( 4045389265951493742) },
+      { -INT64_C( 7015104811441018039),  INT64_C( 2719745472090840315),  INT64_C( 4649695776828593925),  INT64_C( 4045389265951493742) } },
+    { UINT8_C( 13),
+      {  INT64_C( 7829376824996893923), -INT64_C( 1571094317447315576), -INT64_C( 8617535936835341125),  INT64_C( 8295045738552415503) },
+      {  INT64_C( 7829376824996893923), -INT64_C( 8617535936835341125),  INT64_C( 8295045738552415503),  INT64_C(                   0) } },
+    { UINT8_C(  0),
+      { -INT64_C( 8625986559941815115), -INT64_C(  690706149459545309), -INT64_C( 1305418521526055611), -INT64_C( 9066775029565750190) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  9),
+      {  INT64_C( 7672085544772013823), -INT64_C( 3406998996908824078), -INT64_C( 3648175864443115195),  INT64_C( 6616417212859481526) },
+      {  INT64_C( 7672085544772013823),  INT64_C( 6616417212859481526),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  1),
+      { -INT64_C( 3347701359134169757),  INT64_C(  851849340599262770),  INT64_C( 7342257133781376209),  INT64_C( 5339677435509278587) },
+      { -INT64_C( 3347701359134169757),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  5),
+      {  INT64_C( 5320445446152910922), -INT64_C( 5204465608107654425), -INT64_C( 8391780040600512546), -INT64_C( 5821052673020725832) },
+      {  INT64_C( 5320445446152910922), -INT64_C( 8391780040600512546),  INT64_C(                   0),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_compress_epi64(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_compress_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { SIMDE_FLOAT64_C(  -446.12), SIMDE_FLOAT64_C(    55.76), SIMDE_FLOAT64_C(   -16.63), SIMDE_FLOAT64_C(  -545.90) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C( 15),
+      { SIMDE_FLOAT64_C(  -792.12), SIMDE_FLOAT64_C(   554.24), SIMDE_FLOAT64_C(   460.14), SIMDE_FLOAT64_C(   912.47) },
+      { SIMDE_FLOAT64_C(  -792.12), SIMDE_FLOAT64_C(   554.24), SIMDE_FLOAT64_C(   460.14), SIMDE_FLOAT64_C(   912.47) } },
+    { UINT8_C( 11),
+      { SIMDE_FLOAT64_C(  -295.57), SIMDE_FLOAT64_C(  -528.19), SIMDE_FLOAT64_C(   791.37), SIMDE_FLOAT64_C(   -58.50) },
+      { SIMDE_FLOAT64_C(  -295.57), SIMDE_FLOAT64_C(  -528.19), SIMDE_FLOAT64_C(   -58.50), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(  2),
+      { SIMDE_FLOAT64_C(   272.09), SIMDE_FLOAT64_C(  -974.51), SIMDE_FLOAT64_C(   778.64), SIMDE_FLOAT64_C(   305.62) },
+      { SIMDE_FLOAT64_C(  -974.51), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(  3),
+      { SIMDE_FLOAT64_C(   178.73), SIMDE_FLOAT64_C(  -685.21), SIMDE_FLOAT64_C(  -163.59), SIMDE_FLOAT64_C(  -993.52) },
+      { SIMDE_FLOAT64_C(   178.73), SIMDE_FLOAT64_C(  -685.21), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C( 14),
+      { SIMDE_FLOAT64_C(  -486.33), SIMDE_FLOAT64_C(   510.30), SIMDE_FLOAT64_C(  -133.92), SIMDE_FLOAT64_C(  -595.84) },
+      { SIMDE_FLOAT64_C(   510.30), SIMDE_FLOAT64_C(  -133.92), SIMDE_FLOAT64_C(  -595.84), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(  0),
+      { SIMDE_FLOAT64_C(   105.04), SIMDE_FLOAT64_C(  -128.30), SIMDE_FLOAT64_C(  -236.06), SIMDE_FLOAT64_C(   271.24) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C( 15),
+      { SIMDE_FLOAT64_C(   700.80), SIMDE_FLOAT64_C(   662.81), SIMDE_FLOAT64_C(   -88.48), SIMDE_FLOAT64_C(  -555.48) },
+      { SIMDE_FLOAT64_C(   700.80), SIMDE_FLOAT64_C(   662.81), SIMDE_FLOAT64_C(   -88.48), SIMDE_FLOAT64_C(  -555.48) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde__m256d r = simde_mm256_maskz_compress_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_compress_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { SIMDE_FLOAT32_C(   651.08), SIMDE_FLOAT32_C(   541.84), SIMDE_FLOAT32_C(   761.78), SIMDE_FLOAT32_C(   -71.11),
+        SIMDE_FLOAT32_C(  -955.23), SIMDE_FLOAT32_C(  -330.81), SIMDE_FLOAT32_C(   926.76), SIMDE_FLOAT32_C(  -280.97) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(255),
+      { SIMDE_FLOAT32_C(   -93.05), SIMDE_FLOAT32_C(   681.53), SIMDE_FLOAT32_C(  -995.01), SIMDE_FLOAT32_C(  -785.29),
+        SIMDE_FLOAT32_C(   440.65), SIMDE_FLOAT32_C(  -947.15), SIMDE_FLOAT32_C(   839.08), SIMDE_FLOAT32_C(   425.29) },
+      { SIMDE_FLOAT32_C(   -93.05), SIMDE_FLOAT32_C(   681.53), SIMDE_FLOAT32_C(  -995.01), SIMDE_FLOAT32_C(  -785.29),
+        SIMDE_FLOAT32_C(   440.65), SIMDE_FLOAT32_C(  -947.15), SIMDE_FLOAT32_C(   839.08), SIMDE_FLOAT32_C(   425.29) } },
+    { UINT8_C(232),
+      { SIMDE_FLOAT32_C(  -402.23), SIMDE_FLOAT32_C(   646.12), SIMDE_FLOAT32_C(  -624.59), SIMDE_FLOAT32_C(   854.50),
+        SIMDE_FLOAT32_C(   559.72), SIMDE_FLOAT32_C(  -821.51), SIMDE_FLOAT32_C(  -441.00), SIMDE_FLOAT32_C(  -973.85) },
+      { SIMDE_FLOAT32_C(   854.50), SIMDE_FLOAT32_C(  -821.51), SIMDE_FLOAT32_C(  -441.00), SIMDE_FLOAT32_C(  -973.85),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(  8),
+      { SIMDE_FLOAT32_C(  -753.89), SIMDE_FLOAT32_C(  -396.66), SIMDE_FLOAT32_C(  -137.25), SIMDE_FLOAT32_C(  -691.68),
+        SIMDE_FLOAT32_C(   577.09), SIMDE_FLOAT32_C(   240.69), SIMDE_FLOAT32_C(  -207.97), SIMDE_FLOAT32_C(   400.20) },
+      { SIMDE_FLOAT32_C(  -691.68), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(212),
+      { SIMDE_FLOAT32_C(  -435.67), SIMDE_FLOAT32_C(   849.70), SIMDE_FLOAT32_C(   527.94), SIMDE_FLOAT32_C(  -797.48),
+        SIMDE_FLOAT32_C(  -838.62), SIMDE_FLOAT32_C(    29.68), SIMDE_FLOAT32_C(   -56.06), SIMDE_FLOAT32_C(  -393.21) },
+      { SIMDE_FLOAT32_C(   527.94), SIMDE_FLOAT32_C(  -838.62), SIMDE_FLOAT32_C(   -56.06), SIMDE_FLOAT32_C(  -393.21),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C( 70),
+      { SIMDE_FLOAT32_C(  -663.71), SIMDE_FLOAT32_C(   642.86), SIMDE_FLOAT32_C(   996.64), SIMDE_FLOAT32_C(    98.64),
+        SIMDE_FLOAT32_C(  -338.23), SIMDE_FLOAT32_C(  -847.61), SIMDE_FLOAT32_C(   370.78), SIMDE_FLOAT32_C(   536.79) },
+      { SIMDE_FLOAT32_C(   642.86), SIMDE_FLOAT32_C(   996.64), SIMDE_FLOAT32_C(   370.78), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(146),
+      { SIMDE_FLOAT32_C(  -522.86), SIMDE_FLOAT32_C(  -839.67), SIMDE_FLOAT32_C(  -173.12), SIMDE_FLOAT32_C(  -210.95),
+        SIMDE_FLOAT32_C(   145.77), SIMDE_FLOAT32_C(   871.35), SIMDE_FLOAT32_C(   650.23), SIMDE_FLOAT32_C(   537.95) },
+      { SIMDE_FLOAT32_C(  -839.67), SIMDE_FLOAT32_C(   145.77), SIMDE_FLOAT32_C(   537.95), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C( 56),
+      { SIMDE_FLOAT32_C(   277.31), SIMDE_FLOAT32_C(   842.61), SIMDE_FLOAT32_C(   263.75), SIMDE_FLOAT32_C(   433.55),
+        SIMDE_FLOAT32_C(  -609.40), SIMDE_FLOAT32_C(  -996.32), SIMDE_FLOAT32_C(   469.68), SIMDE_FLOAT32_C(  -650.97) },
+      { SIMDE_FLOAT32_C(   433.55), SIMDE_FLOAT32_C(  -609.40), SIMDE_FLOAT32_C(  -996.32), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m256 r = simde_mm256_maskz_compress_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_compressstoreu_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      {  INT32_C(  1814037062),  INT32_C(   559676492),  INT32_C(   337687825), -INT32_C(   265420690), -INT32_C(    33510053),  INT32_C(   853662451),  INT32_C(   175044070), -INT32_C(  2110115276) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(255),
+      { -INT32_C(  1223846886), -INT32_C(  1828884018), -INT32_C(  1502422739), -INT32_C(   919473495),  INT32_C(   240575444),  INT32_C(   532831754), -INT32_C(  1866520815), -INT32_C(  1991702253) },
+      { -INT32_C(  1223846886), -INT32_C(  1828884018), -INT32_C(  1502422739), -INT32_C(   919473495),  INT32_C(   240575444),  INT32_C(   532831754), -INT32_C(  1866520815), -INT32_C(  1991702253) } },
+    { UINT8_C(184),
+      { -INT32_C(  1792160077), -INT32_C(  1180510788),  INT32_C(  2047480852), -INT32_C(  1602466192), -INT32_C(  1114860797), -INT32_C(   361835020),  INT32_C(  1574582503), -INT32_C(  1180161815) },
+      { -INT32_C(  1602466192), -INT32_C(  1114860797), -INT32_C(   361835020), -INT32_C(  1180161815),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(234),
+      { -INT32_C(   846440769), -INT32_C(    42220994),  INT32_C(  1244830144), -INT32_C(  1684919702),  INT32_C(   242796470),  INT32_C(  1144282692), -INT32_C(   997081036),  INT32_C(   697317091) },
+      { -INT32_C(    42220994), -INT32_C(  1684919702),  INT32_C(  1144282692), -INT32_C(   997081036),  INT32_C(   697317091),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(206),
+      {  INT32_C(  1931152772),  INT32_C(  1860785937),  INT32_C(  1521591860), -INT32_C(   210021462), -INT32_C(   729479724),  INT32_C(  1921758851),  INT32_C(  2110661696), -INT32_C(   860915359) },
+      {  INT32_C(  1860785937),  INT32_C(  1521591860), -INT32_C(   210021462),  INT32_C(  2110661696), -INT32_C(   860915359),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C( 88),
+      {  INT32_C(   334778938),  INT32_C(   944932105),  INT32_C(   982640162),  INT32_C(   884948944),  INT32_C(  1411550116),  INT32_C(   418987914),  INT32_C(  1720182874), -INT32_C(  1952165780) },
+      {  INT32_C(   884948944),  INT32_C(  1411550116),  INT32_C(  1720182874),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(101),
+      {  INT32_C(    15964786),  INT32_C(   532832806),  INT32_C(  2090302227), -INT32_C(  1391461874),  INT32_C(  2050247718),  INT32_C(  1355150352), -INT32_C(  1976418760),  INT32_C(  1489438543) },
+      {  INT32_C(    15964786),  INT32_C(  2090302227),  INT32_C(  1355150352), -INT32_C(  1976418760),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(233),
+      { -INT32_C(  1448458636), -INT32_C(   284714894), -INT32_C(    15220668),  INT32_C(   502400110),  INT32_C(   620837193), -INT32_C(  1908885647),  INT32_C(  1700493137), -INT32_C(    26712431) },
+      { -INT32_C(  1448458636),  INT32_C(   502400110), -INT32_C(  1908885647),  INT32_C(  1700493137), -INT32_C(    26712431),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    int32_t r[8] = { 0, };
+    simde_mm256_mask_compressstoreu_epi32(r, test_vec[i].k, a);
+    simde_assert_equal_vi32(8, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_compressstoreu_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { -INT64_C( 5613592147977909278), -INT64_C( 8521935547747215031),  INT64_C(  702781376520281716),  INT64_C( 5271832338466136385) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 15),
+      { -INT64_C( 4198771262928397983),  INT64_C( 2303190437089720782),  INT64_C( 2233067517025467053),  INT64_C( 5542689523212064272) },
+      { -INT64_C( 4198771262928397983),  INT64_C( 2303190437089720782),  INT64_C( 2233067517025467053),  INT64_C( 5542689523212064272) } },
+    { UINT8_C( 13),
+      { -INT64_C( 2108481100178739804),  INT64_C( 5667049756946149221), -INT64_C( 5876535000594274218),  INT64_C( 6359347758759591769) },
+      { -INT64_C( 2108481100178739804), -INT64_C( 5876535000594274218),  INT64_C( 6359347758759591769),  INT64_C(                   0) } },
+    { UINT8_C(  8),
+      { -INT64_C( 2225961064023603467), -INT64_C( 6737690926375136696), -INT64_C(  327331685946279139),  INT64_C( 5554587792426394162) },
+      {  INT64_C( 5554587792426394162),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 15),
+      { -INT64_C( 3949710915916963485), -INT64_C( 4639110595882793952), -INT64_C( 3305446728836909184),  INT64_C( 5663160442612746995) },
+      { -INT64_C( 3949710915916963485), -INT64_C( 4639110595882793952), -INT64_C( 3305446728836909184),  INT64_C( 5663160442612746995) } },
+    { UINT8_C(  9),
+      { -INT64_C( 2309573283529107821), -INT64_C( 3475426828688061826),  INT64_C( 9040183998573436492),  INT64_C(  821174245950064891) },
+      { -INT64_C( 2309573283529107821),  INT64_C(  821174245950064891),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 13),
+      { -INT64_C( 2328810737578540456),  INT64_C( 1423939656847226946),  INT64_C( 8904782361092274935),  INT64_C( 2707262135296090765) },
+      { -INT64_C( 2328810737578540456),  INT64_C( 8904782361092274935),  INT64_C( 2707262135296090765),  INT64_C(                   0) } },
+    { UINT8_C(  8),
+      {  INT64_C( 2974442563161431136), -INT64_C( 3417258871034452323),  INT64_C( 6787563347958478127), -INT64_C( 7441908497923248222) },
+      { -INT64_C( 7441908497923248222),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    int64_t r[4] = { 0, };
+    simde_mm256_mask_compressstoreu_epi64(r, test_vec[i].k, a);
+    simde_assert_equal_vi64(4, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_compressstoreu_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { SIMDE_FLOAT64_C(  -760.56), SIMDE_FLOAT64_C(   504.16), SIMDE_FLOAT64_C(  -235.25), SIMDE_FLOAT64_C(  -829.99) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C( 15),
+      { SIMDE_FLOAT64_C(  -129.60), SIMDE_FLOAT64_C(   617.24), SIMDE_FLOAT64_C(   924.78), SIMDE_FLOAT64_C(  -389.47) },
+      { SIMDE_FLOAT64_C(  -129.60), SIMDE_FLOAT64_C(   617.24), SIMDE_FLOAT64_C(   924.78), SIMDE_FLOAT64_C(  -389.47) } },
+    { UINT8_C(  1),
+      { SIMDE_FLOAT64_C(  -484.42), SIMDE_FLOAT64_C(   525.96), SIMDE_FLOAT64_C(   -54.89), SIMDE_FLOAT64_C(   555.24) },
+      { SIMDE_FLOAT64_C(  -484.42), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C( 15),
+      { SIMDE_FLOAT64_C(   -82.07), SIMDE_FLOAT64_C(  -377.57), SIMDE_FLOAT64_C(   122.96), SIMDE_FLOAT64_C(  -489.93) },
+      { SIMDE_FLOAT64_C(   -82.07), SIMDE_FLOAT64_C(  -377.57), SIMDE_FLOAT64_C(   122.96), SIMDE_FLOAT64_C(  -489.93) } },
+    { UINT8_C( 13),
+      { SIMDE_FLOAT64_C(   633.28), SIMDE_FLOAT64_C(  -471.08), SIMDE_FLOAT64_C(  -108.18), SIMDE_FLOAT64_C(   361.39) },
+      { SIMDE_FLOAT64_C(   633.28), SIMDE_FLOAT64_C(  -108.18), SIMDE_FLOAT64_C(   361.39), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(  9),
+      { SIMDE_FLOAT64_C(  -235.05), SIMDE_FLOAT64_C(  -904.02), SIMDE_FLOAT64_C(   -55.66), SIMDE_FLOAT64_C(  -886.55) },
+      { SIMDE_FLOAT64_C(  -235.05), SIMDE_FLOAT64_C(  -886.55), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(  4),
+      { SIMDE_FLOAT64_C(  -343.56), SIMDE_FLOAT64_C(   712.60), SIMDE_FLOAT64_C(   612.65), SIMDE_FLOAT64_C(   746.25) },
+      { SIMDE_FLOAT64_C(   612.65), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C( 14),
+      { SIMDE_FLOAT64_C(   137.97), SIMDE_FLOAT64_C(  -476.57), SIMDE_FLOAT64_C(   570.95), SIMDE_FLOAT64_C(  -873.91) },
+      { SIMDE_FLOAT64_C(  -476.57), SIMDE_FLOAT64_C(   570.95), SIMDE_FLOAT64_C(  -873.91), SIMDE_FLOAT64_C(     0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde_float64 r[4] = { 0, };
+    simde_mm256_mask_compressstoreu_pd(r, test_vec[i].k, a);
+    simde_assert_equal_vf64(4, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_compressstoreu_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { SIMDE_FLOAT32_C(   298.68), SIMDE_FLOAT32_C(  -129.25), SIMDE_FLOAT32_C(  -654.08), SIMDE_FLOAT32_C(  -288.00),
+        SIMDE_FLOAT32_C(   419.77), SIMDE_FLOAT32_C(   372.45), SIMDE_FLOAT32_C(  -258.96), SIMDE_FLOAT32_C(   523.31) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(255),
+      { SIMDE_FLOAT32_C(   975.97), SIMDE_FLOAT32_C(   529.26), SIMDE_FLOAT32_C(   -24.22), SIMDE_FLOAT32_C(  -550.08),
+        SIMDE_FLOAT32_C(    82.93), SIMDE_FLOAT32_C(   -48.00), SIMDE_FLOAT32_C(   791.74), SIMDE_FLOAT32_C(   730.89) },
+      { SIMDE_FLOAT32_C(   975.97), SIMDE_FLOAT32_C(   529.26), SIMDE_FLOAT32_C(   -24.22), SIMDE_FLOAT32_C(  -550.08),
+        SIMDE_FLOAT32_C(    82.93), SIMDE_FLOAT32_C(   -48.00), SIMDE_FLOAT32_C(   791.74), SIMDE_FLOAT32_C(   730.89) } },
+    { UINT8_C(164),
+      { SIMDE_FLOAT32_C(   -91.50), SIMDE_FLOAT32_C(  -325.93), SIMDE_FLOAT32_C(   934.56), SIMDE_FLOAT32_C(  -214.81),
+        SIMDE_FLOAT32_C(   834.97), SIMDE_FLOAT32_C(   389.34), SIMDE_FLOAT32_C(  -505.95), SIMDE_FLOAT32_C(   589.72) },
+      { SIMDE_FLOAT32_C(   934.56), SIMDE_FLOAT32_C(   389.34), SIMDE_FLOAT32_C(   589.72), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(135),
+      { SIMDE_FLOAT32_C(   175.31), SIMDE_FLOAT32_C(  -122.20), SIMDE_FLOAT32_C(   457.15), SIMDE_FLOAT32_C(   -71.83),
+        SIMDE_FLOAT32_C(  -351.99), SIMDE_FLOAT32_C(  -908.11), SIMDE_FLOAT32_C(   601.75), SIMDE_FLOAT32_C(    -4.19) },
+      { SIMDE_FLOAT32_C(   175.31), SIMDE_FLOAT32_C(  -122.20), SIMDE_FLOAT32_C(   457.15), SIMDE_FLOAT32_C(    -4.19),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(169),
+      { SIMDE_FLOAT32_C(  -496.95), SIMDE_FLOAT32_C(  -415.02), SIMDE_FLOAT32_C(  -645.20), SIMDE_FLOAT32_C(   426.27),
+        SIMDE_FLOAT32_C(   349.81), SIMDE_FLOAT32_C(   809.50), SIMDE_FLOAT32_C(   930.35), SIMDE_FLOAT32_C(   368.60) },
+      { SIMDE_FLOAT32_C(  -496.95), SIMDE_FLOAT32_C(   426.27), SIMDE_FLOAT32_C(   809.50), SIMDE_FLOAT32_C(   368.60),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(161),
+      { SIMDE_FLOAT32_C(   -74.75), SIMDE_FLOAT32_C(    34.61), SIMDE_FLOAT32_C(   399.47), SIMDE_FLOAT32_C(  -839.12),
+        SIMDE_FLOAT32_C(  -275.79), SIMDE_FLOAT32_C(   108.91), SIMDE_FLOAT32_C(   459.11), SIMDE_FLOAT32_C(   402.97) },
+      { SIMDE_FLOAT32_C(   -74.75), SIMDE_FLOAT32_C(   108.91), SIMDE_FLOAT32_C(   402.97), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(122),
+      { SIMDE_FLOAT32_C(   258.75), SIMDE_FLOAT32_C(  -989.75), SIMDE_FLOAT32_C(   141.03), SIMDE_FLOAT32_C(   867.25),
+        SIMDE_FLOAT32_C(   159.89), SIMDE_FLOAT32_C(  -189.65), SIMDE_FLOAT32_C(  -234.02), SIMDE_FLOAT32_C(   581.65) },
+      { SIMDE_FLOAT32_C(  -989.75), SIMDE_FLOAT32_C(   867.25), SIMDE_FLOAT32_C(   159.89), SIMDE_FLOAT32_C(  -189.65),
+        SIMDE_FLOAT32_C(  -234.02), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C( 12),
+      { SIMDE_FLOAT32_C(  -156.18), SIMDE_FLOAT32_C(   590.04), SIMDE_FLOAT32_C(   930.16), SIMDE_FLOAT32_C(   886.33),
+        SIMDE_FLOAT32_C(  -429.93), SIMDE_FLOAT32_C(   266.38), SIMDE_FLOAT32_C(    53.28), SIMDE_FLOAT32_C(  -353.92) },
+      { SIMDE_FLOAT32_C(   930.16), SIMDE_FLOAT32_C(   886.33), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde_float32 r[8] = { 0, };
+    simde_mm256_mask_compressstoreu_ps(r, test_vec[i].k, a);
+    simde_assert_equal_vf32(8, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_compress_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { {  INT32_C(   593612400), -INT32_C(   847945939), -INT32_C(  1099499526),  INT32_C(   860967755), -INT32_C(  1870728853), -INT32_C(   139159223),  INT32_C(  2017357878),  INT32_C(  2074003868),
+        -INT32_C(  1497900909),  INT32_C(  1941583505), -INT32_C(   466822389), -INT32_C(  1860632245),  INT32_C(  1131646526), -INT32_C(  1347112583),  INT32_C(  1476805178), -INT32_C(   432755754) },
+      UINT16_C(    0),
+      { -INT32_C(  1743892323), -INT32_C(  1124001481), -INT32_C(  2101237206),  INT32_C(  2042913981),  INT32_C(   875187943), -INT32_C(    64853988), -INT32_C(  1421401231), -INT32_C(   555644306),
+         INT32_C(  1741952173), -INT32_C(   349464321), -INT32_C(  1114100198),  INT32_C(   550599144),  INT32_C(  1941200924),  INT32_C(   198339763), -INT32_C(  1560422709),  INT32_C(  1708952367) },
+      {  INT32_C(   593612400), -INT32_C(   847945939), -INT32_C(  1099499526),  INT32_C(   860967755), -INT32_C(  1870728853), -INT32_C(   139159223),  INT32_C(  2017357878),  INT32_C(  2074003868),
+        -INT32_C(  1497900909),  INT32_C(  1941583505), -INT32_C(   466822389), -INT32_C(  1860632245),  INT32_C(  1131646526), -INT32_C(  1347112583),  INT32_C(  1476805178), -INT32_C(   432755754) } },
+    { { -INT32_C(   488151223), -INT32_C(   914206541),  INT32_C(   572715400),  INT32_C(  1021415972),  INT32_C(  1072880632),  INT32_C(   130716443), -INT32_C(  1800425287), -INT32_C(   131961171),
+         INT32_C(    63474537),  INT32_C(   790607501),  INT32_C(   709818701),  INT32_C(  1596556290), -INT32_C(  1069367993),  INT32_C(   440420013), -INT32_C(  1929041510), -INT32_C(  1793901176) },
+      UINT16_C(65535),
+      { -INT32_C(   888316930), -INT32_C(   839627698), -INT32_C(  1319545962),  INT32_C(   669820844), -INT32_C(  1168241435), -INT32_C(  1654044833), -INT32_C(   573832192),  INT32_C(  1080474074),
+        -INT32_C(  1308338150),  INT32_C(   130084687),  INT32_C(   567981873),  INT32_C(  1805840159),  INT32_C(  1086414635), -INT32_C(  1075688838),  INT32_C(  1857626548),  INT32_C(  2093859336) },
+      { -INT32_C(   888316930), -INT32_C(   839627698), -INT32_C(  1319545962),  INT32_C(   669820844), -INT32_C(  1168241435), -INT32_C(  1654044833), -INT32_C(   573832192),  INT32_C(  1080474074),
+        -INT32_C(  1308338150),  INT32_C(   130084687),  INT32_C(   567981873),  INT32_C(  1805840159),  INT32_C(  1086414635), -INT32_C(  1075688838),  INT32_C(  1857626548),  INT32_C(  2093859336) } },
+    { {  INT32_C(  1753995888), -INT32_C(   507978804),  INT32_C(  1758459494), -INT32_C(  1452080694), -INT32_C(   989217714), -INT32_C(   877520352), -INT32_C(   580399536),  INT32_C(   956783592),
+         INT32_C(   271873677), -INT32_C(  1137558470),  INT32_C(  2101808415), -INT32_C(   919384247), -INT32_C(   321690692), -INT32_C(   129709713), -INT32_C(   702883505),  INT32_C(   540703475) },
+      UINT16_C(13852),
+      { -INT32_C(  1556006944),  INT32_C(   298232260), -INT32_C(   111285615),  INT32_C(  1407091682), -INT32_C(  1016764149), -INT32_C(  2088340984), -INT32_C(   369183294),  INT32_C(   104136184),
+         INT32_C(   744025496), -INT32_C(  1606649816),  INT32_C(  1662989595),  INT32_C(   197047153), -INT32_C(   638391447), -INT32_C(  1118337514),  INT32_C(   160600058), -INT32_C(  2053109063) },
+      { -INT32_C(   111285615),  INT32_C(  1407091682), -INT32_C(  1016764149), -INT32_C(  1606649816),  INT32_C(  1662989595), -INT32_C(   638391447), -INT32_C(  1118337514),  INT32_C(   956783592),
+         INT32_C(   271873677), -INT32_C(  1137558470),  INT32_C(  2101808415), -INT32_C(   919384247), -INT32_C(   321690692), -INT32_C(   129709713), -INT32_C(   702883505),  INT32_C(   540703475) } },
+    { { -INT32_C(  1705988178), -INT32_C(  1413046497), -INT32_C(  1059751016), -INT32_C(   817271431), -INT32_C(  1360805820),  INT32_C(  1358662887),  INT32_C(   352526808),  INT32_C(   959309957),
+        -INT32_C(  2139003009), -INT32_C(  1167310173),  INT32_C(   163750665),  INT32_C(    92448041), -INT32_C(  1870448259), -INT32_C(  1764815597), -INT32_C(   492761223), -INT32_C(  2118714049) },
+      UINT16_C( 7698),
+      { -INT32_C(   938212274),  INT32_C(  1973308577), -INT32_C(   270476005),  INT32_C(  2082532854), -INT32_C(   292483692),  INT32_C(   403491599),  INT32_C(  1653733438),  INT32_C(   168046148),
+         INT32_C(  1457372274), -INT32_C(   245760936),  INT32_C(  1387359696),  INT32_C(   601407978), -INT32_C(   375232831),  INT32_C(    28734504),  INT32_C(  1668240199),  INT32_C(  1510741201) },
+      {  INT32_C(  1973308577), -INT32_C(   292483692), -INT32_C(   245760936),  INT32_C(  1387359696),  INT32_C(   601407978), -INT32_C(   375232831),  INT32_C(   352526808),  INT32_C(   959309957),
+        -INT32_C(  2139003009), -INT32_C(  1167310173),  INT32_C(   163750665),  INT32_C(    92448041), -INT32_C(  1870448259), -INT32_C(  1764815597), -INT32_C(   492761223), -INT32_C(  2118714049) } },
+    { { -INT32_C(   326797862),  INT32_C(  1908672189),  INT32_C(  1515122555), -INT32_C(  1922475546), -INT32_C(  1224910954), -INT32_C(  1563957553), -INT32_C(   645522269), -INT32_C(   545224758),
+         INT32_C(  1301330396), -INT32_C(   102453895),  INT32_C(  1928050790), -INT32_C(  1491634292),  INT32_C(   178482066), -INT32_C(  1180171230), -INT32_C(  1104665496),  INT32_C(  1619751289) },
+      UINT16_C(54140),
+      {  INT32_C(   623711112),  INT32_C(   527635217), -INT32_C(  1745987889), -INT32_C(   411035060), -INT32_C(  1967261606),  INT32_C(  1162976971),  INT32_C(  1266727213),  INT32_C(  1873563323),
+         INT32_C(   493577535), -INT32_C(    19839155), -INT32_C(  2104385885), -INT32_C(   171902169),  INT32_C(   387029080), -INT32_C(   912898383), -INT32_C(  1425058376), -INT32_C(  1742802988) },
+      { -INT32_C(  1745987889), -INT32_C(   411035060), -INT32_C(  1967261606),  INT32_C(  1162976971),  INT32_C(  1266727213),  INT32_C(   493577535), -INT32_C(    19839155),  INT32_C(   387029080),
+        -INT32_C(  1425058376), -INT32_C(  1742802988),  INT32_C(  1928050790), -INT32_C(  1491634292),  INT32_C(   178482066), -INT32_C(  1180171230), -INT32_C(  1104665496),  INT32_C(  1619751289) } },
+    { { -INT32_C(  1755065300), -INT32_C(  1384707660), -INT32_C(  1449362942), -INT32_C(   130091608), -INT32_C(   766706841), -INT32_C(  1186898595), -INT32_C(   806838326), -INT32_C(  1667656700),
+        -INT32_C(   754512117),  INT32_C(   595602538), -INT32_C(   553937217), -INT32_C(   524738697),  INT32_C(  1908683487),  INT32_C(  1258789035), -INT32_C(  1892351177),  INT32_C(  1094046286) },
+      UINT16_C(28337),
+      {  INT32_C(   450996359),  INT32_C(  1576281702), -INT32_C(  1003328827),  INT32_C(   457644373), -INT32_C(   880381219),  INT32_C(   306495934),  INT32_C(   243054066), -INT32_C(  1639172564),
+        -INT32_C(   523259165),  INT32_C(   992047465), -INT32_C(    28165901), -INT32_C(  2018212017), -INT32_C(  2086087262), -INT32_C(   811930150),  INT32_C(  1065798088),  INT32_C(  1276153143) },
+      {  INT32_C(   450996359), -INT32_C(   880381219),  INT32_C(   306495934), -INT32_C(  1639172564),  INT32_C(   992047465), -INT32_C(    28165901), -INT32_C(  2018212017), -INT32_C(   811930150),
+         INT32_C(  1065798088),  INT32_C(   595602538), -INT32_C(   553937217), -INT32_C(   524738697),  INT32_C(  1908683487),  INT32_C(  1258789035), -INT32_C(  1892351177),  INT32_C(  1094046286) } },
+    { {  INT32_C(  1301041341), -INT32_C(  1943371419), -INT32_C(  1194215279), -INT32_C(  1153597603), -INT32_C(   602892364),  INT32_C(  1892389543),  INT32_C(  1515876882), -INT32_C(  1098837532),
+        -INT32_C(   820051645), -INT32_C(  1208460260),  INT32_C(  1107066382), -INT32_C(   929890013), -INT32_C(  1555043171),  INT32_C(  1092999180),  INT32_C(  1505277765),  INT32_C(   668377983) },
+      UINT16_C(56202),
+      {  INT32_C(   817612999), -INT32_C(  1806512232),  INT32_C(  1263269507),  INT32_C(  1306405547),  INT32_C(   179651939), -INT32_C(   360353334),  INT32_C(   767316667),  INT32_C(    82412745),
+         INT32_C(  1873992674),  INT32_C(  1673021681), -INT32_C(   770565953), -INT32_C(  1048764643),  INT32_C(   611200038),  INT32_C(  1876324944),  INT32_C(  1903424247), -INT32_C(   347267795) },
+      { -INT32_C(  1806512232),  INT32_C(  1306405547),  INT32_C(    82412745),  INT32_C(  1873992674),  INT32_C(  1673021681), -INT32_C(  1048764643),  INT32_C(   611200038),  INT32_C(  1903424247),
+        -INT32_C(   347267795), -INT32_C(  1208460260),  INT32_C(  1107066382), -INT32_C(   929890013), -INT32_C(  1555043171),  INT32_C(  1092999180),  INT32_C(  1505277765),  INT32_C(   668377983) } },
+    { {  INT32_C(   493719225), -INT32_C(    10625815),  INT32_C(  1669605376),  INT32_C(     5930643),  INT32_C(  1972695480), -INT32_C(  1525561201), -INT32_C(  1009461280), -INT32_C(    61944390),
+         INT32_C(    13062455),  INT32_C(   561489518),  INT32_C(   217123585), -INT32_C(  1904086926),  INT32_C(   803480749),  INT32_C(  1869327563),  INT32_C(  1410643217), -INT32_C(   527566794) },
+      UINT16_C(10988),
+      { -INT32_C(   679661267), -INT32_C(   640782228),  INT32_C(     8894528),  INT32_C(   193987174),  INT32_C(    24069981), -INT32_C(  1199207179),  INT32_C(  1566282935), -INT32_C(  1923109157),
+        -INT32_C(  1432357264),  INT32_C(  1460211559),  INT32_C(   225519409),  INT32_C(   483328291), -INT32_C(   642495394), -INT32_C(   703799308),  INT32_C(  2104995553), -INT32_C(   875677047) },
+      {  INT32_C(     8894528),  INT32_C(   193987174), -INT32_C(  1199207179),  INT32_C(  1566282935), -INT32_C(  1923109157),  INT32_C(  1460211559),  INT32_C(   483328291), -INT32_C(   703799308),
+         INT32_C(    13062455),  INT32_C(   561489518),  INT32_C(   217123585), -INT32_C(  1904086926),  INT32_C(   803480749),  INT32_C(  1869327563),  INT32_C(  1410643217), -INT32_C(   527566794) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_compress_epi32(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_compress_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[8];
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { {  INT64_C( 5853302748583624027), -INT64_C( 8307528779580386447),  INT64_C( 9039765499974332703),  INT64_C( 6706732747472094911),
+        -INT64_C( 4770224957575182029), -INT64_C( 3043710669477423702), -INT64_C( 7294196977615312978), -INT64_C(  956155981517384373) },
+      UINT8_C(  0),
+      {  INT64_C( 4843975428211831611), -INT64_C( 8577172821264440667), -INT64_C( 3299333065529148035), -INT64_C( 6528075219124102521),
+         INT64_C(  795840901498309512), -INT64_C( 1729891807248535829),  INT64_C( 5486153338688124468),  INT64_C(  466337732633678892) },
+      {  INT64_C( 5853302748583624027), -INT64_C( 8307528779580386447),  INT64_C( 9039765499974332703),  INT64_C( 6706732747472094911),
+        -INT64_C( 4770224957575182029), -INT64_C( 3043710669477423702), -INT64_C( 7294196977615312978), -INT64_C(  956155981517384373) } },
+    { { -INT64_C( 2122436910781967858), -INT64_C( 8953539730279201471),  INT64_C( 2993393892746346096), -INT64_C(  229194966544579859),
+        -INT64_C( 4027798497562189597), -INT64_C( 9163197261876991697),  INT64_C( 3878423276631403369),  INT64_C( 4264773588513830075) },
+      UINT8_C(255),
+      { -INT64_C( 7081859713969644207), -INT64_C(  338502938255255076),  INT64_C( 8522199877134814750),  INT64_C( 7458093139280241670),
+         INT64_C( 1182981375950839531), -INT64_C( 6378423332406616588), -INT64_C( 3133961999308388922),  INT64_C( 4775016938669124431) },
+      { -INT64_C( 7081859713969644207), -INT64_C(  338502938255255076),  INT64_C( 8522199877134814750),  INT64_C( 7458093139280241670),
+         INT64_C( 1182981375950839531), -INT64_C( 6378423332406616588), -INT64_C( 3133961999308388922),  INT64_C( 4775016938669124431) } },
+    { { -INT64_C( 1624745061824597771), -INT64_C(  823805301679515756),  INT64_C( 6125792126777728263), -INT64_C( 5471237856719707837),
+         INT64_C( 6811999263732630717), -INT64_C( 6936997824034260960), -INT64_C(  144089935955224498), -INT64_C( 9208675695602563381) },
+      UINT8_C(142),
+      { -INT64_C( 5796128242801062723), -INT64_C(  667717334788815468),  INT64_C( 4206368959018933977),  INT64_C( 2085626395310289516),
+        -INT64_C( 4902573088501062738), -INT64_C( 1863745790712638942), -INT64_C( 2085901606356016473), -INT64_C( 4071359209581306810) },
+      { -INT64_C(  667717334788815468),  INT64_C( 4206368959018933977),  INT64_C( 2085626395310289516), -INT64_C( 4071359209581306810),
+         INT64_C( 6811999263732630717), -INT64_C( 6936997824034260960), -INT64_C(  144089935955224498), -INT64_C( 9208675695602563381) } },
+    { { -INT64_C( 8544557736437508080), -INT64_C( 7046417702835635782), -INT64_C( 1595715471036056807), -INT64_C( 4530185325383844908),
+         INT64_C( 6471226512605408136),  INT64_C( 5370904540170749733), -INT64_C( 7130334743720019970), -INT64_C( 6850683186157918318) },
+      UINT8_C( 24),
+      { -INT64_C( 3735538642343809403), -INT64_C(  751340844296951097),  INT64_C( 4419440127231576056), -INT64_C( 8969919040844420799),
+        -INT64_C( 6946027023738844656),  INT64_C( 7710041701723799044),  INT64_C( 2783724571968226774), -INT64_C( 4761774423807049842) },
+      { -INT64_C( 8969919040844420799), -INT64_C( 6946027023738844656), -INT64_C( 1595715471036056807), -INT64_C( 4530185325383844908),
+         INT64_C( 6471226512605408136),  INT64_C( 5370904540170749733), -INT64_C( 7130334743720019970), -INT64_C( 6850683186157918318) } },
+    { { -INT64_C( 5014164393103410913),  INT64_C( 3190505584461256037),  INT64_C( 8436359473891768414),  INT64_C( 2939608186012593297),
+        -INT64_C(  362698917282762326),  INT64_C( 9174830801288423553), -INT64_C( 3727216778904978721), -INT64_C( 2684834979904316089) },
+      UINT8_C(178),
+      {  INT64_C( 8869231253160550255), -INT64_C( 2015152226205193495), -INT64_C( 5889483353159967447),  INT64_C( 1379087506898908933),
+         INT64_C( 1496661810119298199),  INT64_C( 4892066883382012420), -INT64_C( 1804499734411371293), -INT64_C( 7728306011429678341) },
+      { -INT64_C( 2015152226205193495),  INT64_C( 1496661810119298199),  INT64_C( 4892066883382012420), -INT64_C( 7728306011429678341),
+        -INT64_C(  362698917282762326),  INT64_C( 9174830801288423553), -INT64_C( 3727216778904978721), -INT64_C( 2684834979904316089) } },
+    { {  INT64_C( 9057507458521925947),  INT64_C( 4238976417640026401),  INT64_C( 2829108578240373124),  INT64_C( 3712780964269415625),
+        -INT64_C( 2645410721045047669), -INT64_C(  566658188331371578),  INT64_C( 1223758996602979543), -INT64_C( 9144578821881377390) },
+      UINT8_C(  9),
+      { -INT64_C( 2961856263490299488), -INT64_C( 6161815425783880933), -INT64_C( 6804268059815806773),  INT64_C( 3237848329317545050),
+         INT64_C( 6769542217604058514), -INT64_C( 3971852111614185261),  INT64_C( 8821448216499258735),  INT64_C(  333063168732467172) },
+      { -INT64_C( 2961856263490299488),  INT64_C( 3237848329317545050),  INT64_C( 2829108578240373124),  INT64_C( 3712780964269415625),
+        -INT64_C( 2645410721045047669), -INT64_C(  566658188331371578),  INT64_C( 1223758996602979543), -INT64_C( 9144578821881377390) } },
+    { {  INT64_C( 1887107423965712798), -INT64_C( 7913914853724946428), -INT64_C( 4985078828788385415), -INT64_C( 4090626264054587117),
+        -INT64_C( 4465194984455963684), -INT64_C( 1795825560778073937), -INT64_C( 4921115598634131542), -INT64_C( 4079780930557575560) },
+      UINT8_C(122),
+      { -INT64_C( 8564845191015326654), -INT64_C( 1726981955808995964), -INT64_C( 7764512327501633287), -INT64_C( 6332945115842823421),
+        -INT64_C( 2621460632136720711), -INT64_C( 4259887801618378132),  INT64_C( 6011661303908503725), -INT64_C( 8894323621606486839) },
+      { -INT64_C( 1726981955808995964), -INT64_C( 6332945115842823421), -INT64_C( 2621460632136720711), -INT64_C( 4259887801618378132),
+         INT64_C( 6011661303908503725), -INT64_C( 1795825560778073937), -INT64_C( 4921115598634131542), -INT64_C( 4079780930557575560) } },
+    { { -INT64_C( 2117848112615794090),  INT64_C( 4003251848421091107), -INT64_C( 4318876565110878923), -INT64_C( 3076037560317074121),
+         INT64_C( 1009548844052195802), -INT64_C( 4153744682787804616),  INT64_C( 4308307633365065353), -INT64_C( 1493706808270217863) },
+      UINT8_C(181),
+      { -INT64_C( 5661240440731440100),  INT64_C(  674318195214330778), -INT64_C( 4057681267584385861), -INT64_C( 4993431305665345038),
+         INT64_C( 2863823846420370687),  INT64_C( 4845071706380493177),  INT64_C(  261995114106129203), -INT64_C( 2345389283592534801) },
+      { -INT64_C( 5661240440731440100), -INT64_C( 4057681267584385861),  INT64_C( 2863823846420370687),  INT64_C( 4845071706380493177),
+        -INT64_C( 2345389283592534801), -INT64_C( 4153744682787804616),  INT64_C( 4308307633365065353), -INT64_C( 1493706808270217863) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi64(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_compress_epi64(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_compress_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[8];
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   -71.18), SIMDE_FLOAT64_C(   831.49), SIMDE_FLOAT64_C(   888.94), SIMDE_FLOAT64_C(   229.88),
+        SIMDE_FLOAT64_C(  -783.46), SIMDE_FLOAT64_C(  -795.10), SIMDE_FLOAT64_C(  -633.24), SIMDE_FLOAT64_C(  -178.07) },
+      UINT8_C(  0),
+      { SIMDE_FLOAT64_C(   972.47), SIMDE_FLOAT64_C(  -100.60), SIMDE_FLOAT64_C(  -417.82), SIMDE_FLOAT64_C(  -964.40),
+        SIMDE_FLOAT64_C(  -548.20), SIMDE_FLOAT64_C(   423.83), SIMDE_FLOAT64_C(   258.94), SIMDE_FLOAT64_C(  -896.88) },
+      { SIMDE_FLOAT64_C(   -71.18), SIMDE_FLOAT64_C(   831.49), SIMDE_FLOAT64_C(   888.94), SIMDE_FLOAT64_C(   229.88),
+        SIMDE_FLOAT64_C(  -783.46), SIMDE_FLOAT64_C(  -795.10), SIMDE_FLOAT64_C(  -633.24), SIMDE_FLOAT64_C(  -178.07) } },
+    { { SIMDE_FLOAT64_C(   945.56), SIMDE_FLOAT64_C(   643.70), SIMDE_FLOAT64_C(   869.60), SIMDE_FLOAT64_C(   590.64),
+        SIMDE_FLOAT64_C(  -390.31), SIMDE_FLOAT64_C(   321.18), SIMDE_FLOAT64_C(  -661.75), SIMDE_FLOAT64_C(  -452.01) },
+      UINT8_C(255),
+      { SIMDE_FLOAT64_C(   179.81), SIMDE_FLOAT64_C(  -104.49), SIMDE_FLOAT64_C(  -111.60), SIMDE_FLOAT64_C(   656.31),
+        SIMDE_FLOAT64_C(   562.82), SIMDE_FLOAT64_C(   567.57), SIMDE_FLOAT64_C(  -696.95), SIMDE_FLOAT64_C(   -40.57) },
+      { SIMDE_FLOAT64_C(   179.81), SIMDE_FLOAT64_C(  -104.49), SIMDE_FLOAT64_C(  -111.60), SIMDE_FLOAT64_C(   656.31),
+        SIMDE_FLOAT64_C(   562.82), SIMDE_FLOAT64_C(   567.57), SIMDE_FLOAT64_C(  -696.95), SIMDE_FLOAT64_C(   -40.57) } },
+    { { SIMDE_FLOAT64_C(   709.01), SIMDE_FLOAT64_C(    94.58), SIMDE_FLOAT64_C(  -630.42), SIMDE_FLOAT64_C(   972.14),
+        SIMDE_FLOAT64_C(  -987.12), SIMDE_FLOAT64_C(   716.71), SIMDE_FLOAT64_C(   195.25), SIMDE_FLOAT64_C(  -216.48) },
+      UINT8_C(196),
+      { SIMDE_FLOAT64_C(   885.43), SIMDE_FLOAT64_C(  -459.50), SIMDE_FLOAT64_C(  -567.71), SIMDE_FLOAT64_C(   429.63),
+        SIMDE_FLOAT64_C(  -552.60), SIMDE_FLOAT64_C(  -754.80), SIMDE_FLOAT64_C(   511.60), SIMDE_FLOAT64_C(   -16.66) },
+      { SIMDE_FLOAT64_C(  -567.71), SIMDE_FLOAT64_C(   511.60), SIMDE_FLOAT64_C(   -16.66), SIMDE_FLOAT64_C(   972.14),
+        SIMDE_FLOAT64_C(  -987.12), SIMDE_FLOAT64_C(   716.71), SIMDE_FLOAT64_C(   195.25), SIMDE_FLOAT64_C(  -216.48) } },
+    { { SIMDE_FLOAT64_C(   312.21), SIMDE_FLOAT64_C(  -945.96), SIMDE_FLOAT64_C(  -486.74), SIMDE_FLOAT64_C(  -692.03),
+        SIMDE_FLOAT64_C(   418.14), SIMDE_FLOAT64_C(  -210.52), SIMDE_FLOAT64_C(  -551.02), SIMDE_FLOAT64_C(   150.57) },
+      UINT8_C(222),
+      { SIMDE_FLOAT64_C(   204.69), SIMDE_FLOAT64_C(   953.38), SIMDE_FLOAT64_C(   127.27), SIMDE_FLOAT64_C(  -554.38),
+        SIMDE_FLOAT64_C(   823.72), SIMDE_FLOAT64_C(   437.42), SIMDE_FLOAT64_C(  -284.50), SIMDE_FLOAT64_C(   889.14) },
+      { SIMDE_FLOAT64_C(   953.38), SIMDE_FLOAT64_C(   127.27), SIMDE_FLOAT64_C(  -554.38), SIMDE_FLOAT64_C(   823.72),
+        SIMDE_FLOAT64_C(  -284.50), SIMDE_FLOAT64_C(   889.14), SIMDE_FLOAT64_C(  -551.02), SIMDE_FLOAT64_C(   150.57) } },
+    { { SIMDE_FLOAT64_C(   791.35), SIMDE_FLOAT64_C(  -891.50), SIMDE_FLOAT64_C(  -257.08), SIMDE_FLOAT64_C(   537.36),
+        SIMDE_FLOAT64_C(   307.74), SIMDE_FLOAT64_C(  -286.86), SIMDE_FLOAT64_C(  -596.81), SIMDE_FLOAT64_C(   888.75) },
+      UINT8_C( 49),
+      { SIMDE_FLOAT64_C(    28.81), SIMDE_FLOAT64_C(   964.19), SIMDE_FLOAT64_C(   586.31), SIMDE_FLOAT64_C(   579.99),
+        SIMDE_FLOAT64_C(  -274.87), SIMDE_FLOAT64_C(   297.76), SIMDE_FLOAT64_C(  -582.10), SIMDE_FLOAT64_C(   -37.77) },
+      { SIMDE_FLOAT64_C(    28.81), SIMDE_FLOAT64_C(  -274.87), SIMDE_FLOAT64_C(   297.76), SIMDE_FLOAT64_C(   537.36),
+        SIMDE_FLOAT64_C(   307.74), SIMDE_FLOAT64_C(  -286.86), SIMDE_FLOAT64_C(  -596.81), SIMDE_FLOAT64_C(   888.75) } },
+    { { SIMDE_FLOAT64_C(   780.64), SIMDE_FLOAT64_C(  -676.20), SIMDE_FLOAT64_C(  -316.91), SIMDE_FLOAT64_C(    52.81),
+        SIMDE_FLOAT64_C(  -809.76), SIMDE_FLOAT64_C(   904.54), SIMDE_FLOAT64_C(  -128.93), SIMDE_FLOAT64_C(  -370.40) },
+      UINT8_C( 90),
+      { SIMDE_FLOAT64_C(  -465.54), SIMDE_FLOAT64_C(   770.59), SIMDE_FLOAT64_C(   425.85), SIMDE_FLOAT64_C(   143.04),
+        SIMDE_FLOAT64_C(  -228.69), SIMDE_FLOAT64_C(  -228.31), SIMDE_FLOAT64_C(    64.12), SIMDE_FLOAT64_C(   209.06) },
+      { SIMDE_FLOAT64_C(   770.59), SIMDE_FLOAT64_C(   143.04), SIMDE_FLOAT64_C(  -228.69), SIMDE_FLOAT64_C(    64.12),
+        SIMDE_FLOAT64_C(  -809.76), SIMDE_FLOAT64_C(   904.54), SIMDE_FLOAT64_C(  -128.93), SIMDE_FLOAT64_C(  -370.40) } },
+    { { SIMDE_FLOAT64_C(   646.78), SIMDE_FLOAT64_C(   502.60), SIMDE_FLOAT64_C(   503.96), SIMDE_FLOAT64_C(   809.67),
+        SIMDE_FLOAT64_C(  -694.80), SIMDE_FLOAT64_C(    -4.90), SIMDE_FLOAT64_C(  -979.84), SIMDE_FLOAT64_C(  -868.38) },
+      UINT8_C( 60),
+      { SIMDE_FLOAT64_C(   932.60), SIMDE_FLOAT64_C(  -136.76), SIMDE_FLOAT64_C(  -385.16), SIMDE_FLOAT64_C(   372.63),
+        SIMDE_FLOAT64_C(   884.30), SIMDE_FLOAT64_C(  -931.50), SIMDE_FLOAT64_C(   642.91), SIMDE_FLOAT64_C(   748.55) },
+      { SIMDE_FLOAT64_C(  -385.16), SIMDE_FLOAT64_C(   372.63), SIMDE_FLOAT64_C(   884.30), SIMDE_FLOAT64_C(  -931.50),
+        SIMDE_FLOAT64_C(  -694.80), SIMDE_FLOAT64_C(    -4.90), SIMDE_FLOAT64_C(  -979.84), SIMDE_FLOAT64_C(  -868.38) } },
+    { { SIMDE_FLOAT64_C(  -730.02), SIMDE_FLOAT64_C(  -229.11), SIMDE_FLOAT64_C(   508.38), SIMDE_FLOAT64_C(   615.02),
+        SIMDE_FLOAT64_C(  -638.72), SIMDE_FLOAT64_C(   830.70), SIMDE_FLOAT64_C(  -918.41), SIMDE_FLOAT64_C(   101.31) },
+      UINT8_C(235),
+      { SIMDE_FLOAT64_C(   989.59), SIMDE_FLOAT64_C(   223.17), SIMDE_FLOAT64_C(   837.05), SIMDE_FLOAT64_C(  -606.77),
+        SIMDE_FLOAT64_C(  -192.65), SIMDE_FLOAT64_C(  -789.71), SIMDE_FLOAT64_C(    70.52), SIMDE_FLOAT64_C(   -83.58) },
+      { SIMDE_FLOAT64_C(   989.59), SIMDE_FLOAT64_C(   223.17), SIMDE_FLOAT64_C(  -606.77), SIMDE_FLOAT64_C(  -789.71),
+        SIMDE_FLOAT64_C(    70.52), SIMDE_FLOAT64_C(   -83.58), SIMDE_FLOAT64_C(  -918.41), SIMDE_FLOAT64_C(   101.31) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d src = simde_mm512_loadu_pd(test_vec[i].src);
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_mask_compress_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_compress_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[16];
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   321.26), SIMDE_FLOAT32_C(  -990.79), SIMDE_FLOAT32_C(   621.53), SIMDE_FLOAT32_C(  -780.39),
+        SIMDE_FLOAT32_C(   -41.26), SIMDE_FLOAT32_C(  -326.21), SIMDE_FLOAT32_C(   453.77), SIMDE_FLOAT32_C(   352.14),
+        SIMDE_FLOAT32_C(    62.07), SIMDE_FLOAT32_C(   153.64), SIMDE_FLOAT32_C(  -715.53), SIMDE_FLOAT32_C(  -527.46),
+        SIMDE_FLOAT32_C(  -820.72), SIMDE_FLOAT32_C(  -677.06), SIMDE_FLOAT32_C(   931.73), SIMDE_FLOAT32_C(  -651.80) },
+      UINT16_C(    0),
+      { SIMDE_FLOAT32_C(   731.27), SIMDE_FLOAT32_C(  -340.65), SIMDE_FLOAT32_C(   532.89), SIMDE_FLOAT32_C(  -885.62),
+        SIMDE_FLOAT32_C(   758.95), SIMDE_FLOAT32_C(  -998.13), SIMDE_FLOAT32_C(   858.12), SIMDE_FLOAT32_C(   357.72),
+        SIMDE_FLOAT32_C(   760.04), SIMDE_FLOAT32_C(  -450.19), SIMDE_FLOAT32_C(   160.45), SIMDE_FLOAT32_C(   307.31),
+        SIMDE_FLOAT32_C(   126.11), SIMDE_FLOAT32_C(  -804.29), SIMDE_FLOAT32_C(   554.09), SIMDE_FLOAT32_C(   573.05) },
+      { SIMDE_FLOAT32_C(   321.26), SIMDE_FLOAT32_C(  -990.79), SIMDE_FLOAT32_C(   621.53), SIMDE_FLOAT32_C(  -780.39),
+        SIMDE_FLOAT32_C(   -41.26), SIMDE_FLOAT32_C(  -326.21), SIMDE_FLOAT32_C(   453.77), SIMDE_FLOAT32_C(   352.14),
+        SIMDE_FLOAT32_C(    62.07), SIMDE_FLOAT32_C(   153.64), SIMDE_FLOAT32_C(  -715.53), SIMDE_FLOAT32_C(  -527.46),
+        SIMDE_FLOAT32_C(  -820.72), SIMDE_FLOAT32_C(  -677.06), SIMDE_FLOAT32_C(   931.73), SIMDE_FLOAT32_C(  -651.80) } },
+    { { SIMDE_FLOAT32_C(  -258.99), SIMDE_FLOAT32_C(   597.28), SIMDE_FLOAT32_C(  -843.33), SIMDE_FLOAT32_C(  -703.78),
+        SIMDE_FLOAT32_C(   533.10), SIMDE_FLOAT32_C(  -814.63), SIMDE_FLOAT32_C(  -856.06), SIMDE_FLOAT32_C(    -2.29),
+        SIMDE_FLOAT32_C(    49.85), SIMDE_FLOAT32_C(   481.69), SIMDE_FLOAT32_C(   566.67), SIMDE_FLOAT32_C(  -234.95),
+        SIMDE_FLOAT32_C(   438.97), SIMDE_FLOAT32_C(  -769.56), SIMDE_FLOAT32_C(    25.35), SIMDE_FLOAT32_C(  -512.39) },
+      UINT16_C(65535),
+      { SIMDE_FLOAT32_C(  -136.22), SIMDE_FLOAT32_C(   659.03), SIMDE_FLOAT32_C(   254.10), SIMDE_FLOAT32_C(   667.41),
+        SIMDE_FLOAT32_C(  -972.89), SIMDE_FLOAT32_C(   809.64), SIMDE_FLOAT32_C(   208.89), SIMDE_FLOAT32_C(    -4.39),
+        SIMDE_FLOAT32_C(     6.59), SIMDE_FLOAT32_C(  -973.73), SIMDE_FLOAT32_C(  -662.46), SIMDE_FLOAT32_C(   756.99),
+        SIMDE_FLOAT32_C(   451.26), SIMDE_FLOAT32_C(  -819.90), SIMDE_FLOAT32_C(   429.60), SIMDE_FLOAT32_C(   408.58) },
+      { SIMDE_FLOAT32_C(  -136.22), SIMDE_FLOAT32_C(   659.03), SIMDE_FLOAT32_C(   254.10), SIMDE_FLOAT32_C(   667.41),
+        SIMDE_FLOAT32_C(  -972.89), SIMDE_FLOAT32_C(   809.64), SIMDE_FLOAT32_C(   208.89), SIMDE_FLOAT32_C(    -4.39),
+        SIMDE_FLOAT32_C(     6.59), SIMDE_FLOAT32_C(  -973.73), SIMDE_FLOAT32_C(  -662.46), SIMDE_FLOAT32_C(   756.99),
+        SIMDE_FLOAT32_C(   451.26), SIMDE_FLOAT32_C(  -819.90), SIMDE_FLOAT32_C(   429.60), SIMDE_FLOAT32_C(   408.58) } },
+    { { SIMDE_FLOAT32_C(  -269.59), SIMDE_FLOAT32_C(   379.84), SIMDE_FLOAT32_C(   303.21), SIMDE_FLOAT32_C(  -601.43),
+        SIMDE_FLOAT32_C(  -852.82), SIMDE_FLOAT32_C(   439.16), SIMDE_FLOAT32_C(   879.20), SIMDE_FLOAT32_C(  -621.58),
+        SIMDE_FLOAT32_C(   575.00), SIMDE_FLOAT32_C(   898.54), SIMDE_FLOAT32_C(   470.35), SIMDE_FLOAT32_C(   830.32),
+        SIMDE_FLOAT32_C(  -476.38), SIMDE_FLOAT32_C(  -533.89), SIMDE_FLOAT32_C(  -514.68), SIMDE_FLOAT32_C(  -112.44) },
+      UINT16_C( 1887),
+      { SIMDE_FLOAT32_C(   -44.05), SIMDE_FLOAT32_C(  -810.71), SIMDE_FLOAT32_C(  -227.81), SIMDE_FLOAT32_C(   163.61),
+        SIMDE_FLOAT32_C(  -658.13), SIMDE_FLOAT32_C(  -563.34), SIMDE_FLOAT32_C(  -260.90), SIMDE_FLOAT32_C(  -413.42),
+        SIMDE_FLOAT32_C(  -647.32), SIMDE_FLOAT32_C(  -985.13), SIMDE_FLOAT32_C(  -242.14), SIMDE_FLOAT32_C(   819.36),
+        SIMDE_FLOAT32_C(  -745.12), SIMDE_FLOAT32_C(   344.14), SIMDE_FLOAT32_C(  -667.86), SIMDE_FLOAT32_C(  -246.32) },
+      { SIMDE_FLOAT32_C(   -44.05), SIMDE_FLOAT32_C(  -810.71), SIMDE_FLOAT32_C(  -227.81), SIMDE_FLOAT32_C(   163.61),
+        SIMDE_FLOAT32_C(  -658.13), SIMDE_FLOAT32_C(  -260.90), SIMDE_FLOAT32_C(  -647.32), SIMDE_FLOAT32_C(  -985.13),
+        SIMDE_FLOAT32_C(  -242.14), SIMDE_FLOAT32_C(   898.54), SIMDE_FLOAT32_C(   470.35), SIMDE_FLOAT32_C(   830.32),
+        SIMDE_FLOAT32_C(  -476.38), SIMDE_FLOAT32_C(  -533.89), SIMDE_FLOAT32_C(  -514.68), SIMDE_FLOAT32_C(  -112.44) } },
+    { { SIMDE_FLOAT32_C(   852.10), SIMDE_FLOAT32_C(  -463.29), SIMDE_FLOAT32_C(  -126.31), SIMDE_FLOAT32_C(   942.73),
+        SIMDE_FLOAT32_C(  -757.80), SIMDE_FLOAT32_C(    38.43), SIMDE_FLOAT32_C(  -920.29), SIMDE_FLOAT32_C(  -971.97),
+        SIMDE_FLOAT32_C(  -531.82), SIMDE_FLOAT32_C(    10.42), SIMDE_FLOAT32_C(   -89.99), SIMDE_FLOAT32_C(   589.91),
+        SIMDE_FLOAT32_C(   333.84), SIMDE_FLOAT32_C(  -506.43), SIMDE_FLOAT32_C(   346.38), SIMDE_FLOAT32_C(   795.44) },
+      UINT16_C(47694),
+      { SIMDE_FLOAT32_C(  -381.32), SIMDE_FLOAT32_C(   473.26), SIMDE_FLOAT32_C(    -5.66), SIMDE_FLOAT32_C(  -127.75),
+        SIMDE_FLOAT32_C(  -405.86), SIMDE_FLOAT32_C(  -641.95), SIMDE_FLOAT32_C(   358.28), SIMDE_FLOAT32_C(   407.30),
+        SIMDE_FLOAT32_C(   615.27), SIMDE_FLOAT32_C(  -883.14), SIMDE_FLOAT32_C(  -135.50), SIMDE_FLOAT32_C(  -199.36),
+        SIMDE_FLOAT32_C(   416.41), SIMDE_FLOAT32_C(   195.97), SIMDE_FLOAT32_C(  -945.99), SIMDE_FLOAT32_C(   605.62) },
+      { SIMDE_FLOAT32_C(   473.26), SIMDE_FLOAT32_C(    -5.66), SIMDE_FLOAT32_C(  -127.75), SIMDE_FLOAT32_C(   358.28),
+        SIMDE_FLOAT32_C(  -883.14), SIMDE_FLOAT32_C(  -199.36), SIMDE_FLOAT32_C(   416.41), SIMDE_FLOAT32_C(   195.97),
+        SIMDE_FLOAT32_C(   605.62), SIMDE_FLOAT32_C(    10.42), SIMDE_FLOAT32_C(   -89.99), SIMDE_FLOAT32_C(   589.91),
+        SIMDE_FLOAT32_C(   333.84), SIMDE_FLOAT32_C(  -506.43), SIMDE_FLOAT32_C(   346.38), SIMDE_FLOAT32_C(   795.44) } },
+    { { SIMDE_FLOAT32_C(   170.86), SIMDE_FLOAT32_C(    70.98), SIMDE_FLOAT32_C(  -667.88), SIMDE_FLOAT32_C(   439.06),
+        SIMDE_FLOAT32_C(   862.64), SIMDE_FLOAT32_C(  -148.22), SIMDE_FLOAT32_C(  -599.34), SIMDE_FLOAT32_C(  -101.51),
+        SIMDE_FLOAT32_C(  -262.83), SIMDE_FLOAT32_C(   232.30), SIMDE_FLOAT32_C(  -784.47), SIMDE_FLOAT32_C(  -782.06),
+        SIMDE_FLOAT32_C(   134.69), SIMDE_FLOAT32_C(   454.12), SIMDE_FLOAT32_C(     3.27), SIMDE_FLOAT32_C(  -668.07) },
+      UINT16_C(50198),
+      { SIMDE_FLOAT32_C(   408.83), SIMDE_FLOAT32_C(   447.35), SIMDE_FLOAT32_C(  -594.47), SIMDE_FLOAT32_C(   346.12),
+        SIMDE_FLOAT32_C(  -777.07), SIMDE_FLOAT32_C(   743.37), SIMDE_FLOAT32_C(  -478.68), SIMDE_FLOAT32_C(   596.12),
+        SIMDE_FLOAT32_C(   386.90), SIMDE_FLOAT32_C(   512.46), SIMDE_FLOAT32_C(   983.68), SIMDE_FLOAT32_C(   792.05),
+        SIMDE_FLOAT32_C(  -449.99), SIMDE_FLOAT32_C(   663.24), SIMDE_FLOAT32_C(   790.04), SIMDE_FLOAT32_C(  -672.24) },
+      { SIMDE_FLOAT32_C(   447.35), SIMDE_FLOAT32_C(  -594.47), SIMDE_FLOAT32_C(  -777.07), SIMDE_FLOAT32_C(   983.68),
+        SIMDE_FLOAT32_C(   790.04), SIMDE_FLOAT32_C(  -672.24), SIMDE_FLOAT32_C(  -599.34), SIMDE_FLOAT32_C(  -101.51),
+        SIMDE_FLOAT32_C(  -262.83), SIMDE_FLOAT32_C(   232.30), SIMDE_FLOAT32_C(  -784.47), SIMDE_FLOAT32_C(  -782.06),
+        SIMDE_FLOAT32_C(   134.69), SIMDE_FLOAT32_C(   454.12), SIMDE_FLOAT32_C(     3.27), SIMDE_FLOAT32_C(  -668.07) } },
+    { { SIMDE_FLOAT32_C(   528.36), SIMDE_FLOAT32_C(  -752.82), SIMDE_FLOAT32_C(  -708.94), SIMDE_FLOAT32_C(   371.56),
+        SIMDE_FLOAT32_C(   308.22), SIMDE_FLOAT32_C(   197.35), SIMDE_FLOAT32_C(  -944.97), SIMDE_FLOAT32_C(  -254.10),
+        SIMDE_FLOAT32_C(   799.04), SIMDE_FLOAT32_C(  -588.53), SIMDE_FLOAT32_C(    39.53), SIMDE_FLOAT32_C(   663.02),
+        SIMDE_FLOAT32_C(  -938.05), SIMDE_FLOAT32_C(  -607.39), SIMDE_FLOAT32_C(  -923.74), SIMDE_FLOAT32_C(   -57.53) },
+      UINT16_C(50510),
+      { SIMDE_FLOAT32_C(   891.62), SIMDE_FLOAT32_C(   628.55), SIMDE_FLOAT32_C(  -512.72), SIMDE_FLOAT32_C(  -555.81),
+        SIMDE_FLOAT32_C(  -939.91), SIMDE_FLOAT32_C(   937.55), SIMDE_FLOAT32_C(   326.55), SIMDE_FLOAT32_C(   968.72),
+        SIMDE_FLOAT32_C(   606.22), SIMDE_FLOAT32_C(  -535.37), SIMDE_FLOAT32_C(   313.14), SIMDE_FLOAT32_C(  -113.18),
+        SIMDE_FLOAT32_C(  -857.23), SIMDE_FLOAT32_C(  -956.37), SIMDE_FLOAT32_C(   224.64), SIMDE_FLOAT32_C(  -928.27) },
+      { SIMDE_FLOAT32_C(   628.55), SIMDE_FLOAT32_C(  -512.72), SIMDE_FLOAT32_C(  -555.81), SIMDE_FLOAT32_C(   326.55),
+        SIMDE_FLOAT32_C(   606.22), SIMDE_FLOAT32_C(   313.14), SIMDE_FLOAT32_C(   224.64), SIMDE_FLOAT32_C(  -928.27),
+        SIMDE_FLOAT32_C(   799.04), SIMDE_FLOAT32_C(  -588.53), SIMDE_FLOAT32_C(    39.53), SIMDE_FLOAT32_C(   663.02),
+        SIMDE_FLOAT32_C(  -938.05), SIMDE_FLOAT32_C(  -607.39), SIMDE_FLOAT32_C(  -923.74), SIMDE_FLOAT32_C(   -57.53) } },
+    { { SIMDE_FLOAT32_C(   233.77), SIMDE_FLOAT32_C(  -139.70), SIMDE_FLOAT32_C(    86.37), SIMDE_FLOAT32_C(  -207.02),
+        SIMDE_FLOAT32_C(   258.79), SIMDE_FLOAT32_C(  -619.77), SIMDE_FLOAT32_C(  -820.62), SIMDE_FLOAT32_C(   938.16),
+        SIMDE_FLOAT32_C(  -257.67), SIMDE_FLOAT32_C(   907.25), SIMDE_FLOAT32_C(  -558.19), SIMDE_FLOAT32_C(  -185.70),
+        SIMDE_FLOAT32_C(   829.77), SIMDE_FLOAT32_C(    77.85), SIMDE_FLOAT32_C(    33.41), SIMDE_FLOAT32_C(  -766.25) },
+      UINT16_C(28269),
+      { SIMDE_FLOAT32_C(  -810.49), SIMDE_FLOAT32_C(  -139.39), SIMDE_FLOAT32_C(   650.72), SIMDE_FLOAT32_C(   891.90),
+        SIMDE_FLOAT32_C(   775.29), SIMDE_FLOAT32_C(   365.23), SIMDE_FLOAT32_C(  -129.33), SIMDE_FLOAT32_C(   663.43),
+        SIMDE_FLOAT32_C(  -513.39), SIMDE_FLOAT32_C(  -980.75), SIMDE_FLOAT32_C(  -516.79), SIMDE_FLOAT32_C(   285.60),
+        SIMDE_FLOAT32_C(  -520.90), SIMDE_FLOAT32_C(  -145.46), SIMDE_FLOAT32_C(   487.62), SIMDE_FLOAT32_C(  -379.11) },
+      { SIMDE_FLOAT32_C(  -810.49), SIMDE_FLOAT32_C(   650.72), SIMDE_FLOAT32_C(   891.90), SIMDE_FLOAT32_C(   365.23),
+        SIMDE_FLOAT32_C(  -129.33), SIMDE_FLOAT32_C(  -980.75), SIMDE_FLOAT32_C(  -516.79), SIMDE_FLOAT32_C(   285.60),
+        SIMDE_FLOAT32_C(  -145.46), SIMDE_FLOAT32_C(   487.62), SIMDE_FLOAT32_C(  -558.19), SIMDE_FLOAT32_C(  -185.70),
+        SIMDE_FLOAT32_C(   829.77), SIMDE_FLOAT32_C(    77.85), SIMDE_FLOAT32_C(    33.41), SIMDE_FLOAT32_C(  -766.25) } },
+    { { SIMDE_FLOAT32_C(   -83.90), SIMDE_FLOAT32_C(   509.70), SIMDE_FLOAT32_C(  -420.44), SIMDE_FLOAT32_C(  -750.76),
+        SIMDE_FLOAT32_C(   219.75), SIMDE_FLOAT32_C(  -992.60), SIMDE_FLOAT32_C(  -909.01), SIMDE_FLOAT32_C(    35.21),
+        SIMDE_FLOAT32_C(  -823.34), SIMDE_FLOAT32_C(  -221.94), SIMDE_FLOAT32_C(   133.59), SIMDE_FLOAT32_C(  -336.49),
+        SIMDE_FLOAT32_C(   -71.53), SIMDE_FLOAT32_C(   -57.19), SIMDE_FLOAT32_C(    64.79), SIMDE_FLOAT32_C(  -112.26) },
+      UINT16_C(  219),
+      { SIMDE_FLOAT32_C(   498.68), SIMDE_FLOAT32_C(  -753.28), SIMDE_FLOAT32_C(   215.44), SIMDE_FLOAT32_C(  -483.44),
+        SIMDE_FLOAT32_C(   806.79), SIMDE_FLOAT32_C(  -863.44), SIMDE_FLOAT32_C(   -38.51), SIMDE_FLOAT32_C(   -51.11),
+        SIMDE_FLOAT32_C(  -560.36), SIMDE_FLOAT32_C(   905.94), SIMDE_FLOAT32_C(  -841.16), SIMDE_FLOAT32_C(   -74.62),
+        SIMDE_FLOAT32_C(   997.91), SIMDE_FLOAT32_C(   815.52), SIMDE_FLOAT32_C(   309.28), SIMDE_FLOAT32_C(  -988.63) },
+      { SIMDE_FLOAT32_C(   498.68), SIMDE_FLOAT32_C(  -753.28), SIMDE_FLOAT32_C(  -483.44), SIMDE_FLOAT32_C(   806.79),
+        SIMDE_FLOAT32_C(   -38.51), SIMDE_FLOAT32_C(   -51.11), SIMDE_FLOAT32_C(  -909.01), SIMDE_FLOAT32_C(    35.21),
+        SIMDE_FLOAT32_C(  -823.34), SIMDE_FLOAT32_C(  -221.94), SIMDE_FLOAT32_C(   133.59), SIMDE_FLOAT32_C(  -336.49),
+        SIMDE_FLOAT32_C(   -71.53), SIMDE_FLOAT32_C(   -57.19), SIMDE_FLOAT32_C(    64.79), SIMDE_FLOAT32_C(  -112.26) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 src = simde_mm512_loadu_ps(test_vec[i].src);
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_mask_compress_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_compress_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { UINT16_C(    0),
+      { -INT32_C(  2044144182), -INT32_C(  1033592015),  INT32_C(  1398889291),  INT32_C(   978618667),  INT32_C(  2035655218), -INT32_C(   500107411), -INT32_C(  1972715249), -INT32_C(  1143851291),
+        -INT32_C(    61193164), -INT32_C(   785802559),  INT32_C(   658182556),  INT32_C(  1514966315),  INT32_C(  1932767816), -INT32_C(   435278105),  INT32_C(  1068406621),  INT32_C(   921372529) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(65535),
+      {  INT32_C(   791372595),  INT32_C(   484147427), -INT32_C(   774196808), -INT32_C(  1497150586), -INT32_C(  1845699237), -INT32_C(   479394314),  INT32_C(  1092037062), -INT32_C(   744296697),
+         INT32_C(   497741268), -INT32_C(  1136523113), -INT32_C(   413025581),  INT32_C(  1180337100),  INT32_C(   422655480),  INT32_C(   334559611),  INT32_C(  1511163259),  INT32_C(  2112104454) },
+      {  INT32_C(   791372595),  INT32_C(   484147427), -INT32_C(   774196808), -INT32_C(  1497150586), -INT32_C(  1845699237), -INT32_C(   479394314),  INT32_C(  1092037062), -INT32_C(   744296697),
+         INT32_C(   497741268), -INT32_C(  1136523113), -INT32_C(   413025581),  INT32_C(  1180337100),  INT32_C(   422655480),  INT32_C(   334559611),  INT32_C(  1511163259),  INT32_C(  2112104454) } },
+    { UINT16_C(23869),
+      {  INT32_C(   561095353),  INT32_C(  1879591147), -INT32_C(    59365790), -INT32_C(  1095548617),  INT32_C(   238345531),  INT32_C(   494607854),  INT32_C(   931965237),  INT32_C(   729830633),
+         INT32_C(   682863759),  INT32_C(  1252598230),  INT32_C(  1733415972), -INT32_C(  2107184793),  INT32_C(   261947137), -INT32_C(   840520359),  INT32_C(   216605618),  INT32_C(   120127936) },
+      {  INT32_C(   561095353), -INT32_C(    59365790), -INT32_C(  1095548617),  INT32_C(   238345531),  INT32_C(   494607854),  INT32_C(   682863759),  INT32_C(  1733415972), -INT32_C(  2107184793),
+         INT32_C(   261947137),  INT32_C(   216605618),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(48079),
+      { -INT32_C(  1682768398),  INT32_C(   626476492),  INT32_C(  1833001853), -INT32_C(  1644266261),  INT32_C(   512867904), -INT32_C(  1699233736), -INT32_C(    88620391),  INT32_C(   388473477),
+         INT32_C(  1483747469), -INT32_C(  1090418564), -INT32_C(   103142822),  INT32_C(  1685636052), -INT32_C(  1008983490), -INT32_C(   743669374),  INT32_C(   671489574), -INT32_C(  1051217912) },
+      { -INT32_C(  1682768398),  INT32_C(   626476492),  INT32_C(  1833001853), -INT32_C(  1644266261), -INT32_C(    88620391),  INT32_C(   388473477),  INT32_C(  1483747469), -INT32_C(  1090418564),
+         INT32_C(  1685636052), -INT32_C(  1008983490), -INT32_C(   743669374), -INT32_C(  1051217912),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(32828),
+      { -INT32_C(  1738505915), -INT32_C(  1507788937),  INT32_C(  1878275809),  INT32_C(   288482551), -INT32_C(   745352367),  INT32_C(   263237554),  INT32_C(   293593317), -INT32_C(   144323937),
+        -INT32_C(  1913504692), -INT32_C(    82463686),  INT32_C(  1757746174),  INT32_C(  1238814622), -INT32_C(   253905211), -INT32_C(  1974953651), -INT32_C(  1890086237), -INT32_C(   671689312) },
+      {  INT32_C(  1878275809),  INT32_C(   288482551), -INT32_C(   745352367),  INT32_C(   263237554), -INT32_C(   671689312),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(58224),
+      { -INT32_C(   887539766), -INT32_C(  1632286726),  INT32_C(  2121801345),  INT32_C(   409120682), -INT32_C(  2052319726),  INT32_C(  2051203060),  INT32_C(  1394020848), -INT32_C(  1877853443),
+        -INT32_C(   977751717),  INT32_C(  1857805392),  INT32_C(  1989002774), -INT32_C(   118403698),  INT32_C(   709403965),  INT32_C(  1522231772),  INT32_C(  1963572288), -INT32_C(   633990957) },
+      { -INT32_C(  2052319726),  INT32_C(  2051203060),  INT32_C(  1394020848), -INT32_C(   977751717),  INT32_C(  1857805392),  INT32_C(  1522231772),  INT32_C(  1963572288), -INT32_C(   633990957),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(23441),
+      { -INT32_C(  1941795966), -INT32_C(   951226617),  INT32_C(  1521696748),  INT32_C(  1416140772),  INT32_C(  1756045288),  INT32_C(   846857830),  INT32_C(  1364569098), -INT32_C(  1673000257),
+         INT32_C(  1234491191), -INT32_C(   598456661), -INT32_C(   815686501), -INT32_C(   438433264),  INT32_C(   383091240),  INT32_C(  1321301956), -INT32_C(  1572042342),  INT32_C(  1011790677) },
+      { -INT32_C(  1941795966),  INT32_C(  1756045288), -INT32_C(  1673000257),  INT32_C(  1234491191), -INT32_C(   598456661), -INT32_C(   438433264),  INT32_C(   383091240), -INT32_C(  1572042342),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(26252),
+      { -INT32_C(  1700412175),  INT32_C(   302694171),  INT32_C(   980192230),  INT32_C(   771362882),  INT32_C(  1675771635), -INT32_C(   309160665), -INT32_C(   257557478),  INT32_C(  1556956973),
+        -INT32_C(  1731088352), -INT32_C(  1130807445),  INT32_C(  1913839393),  INT32_C(   404412814),  INT32_C(  1745545652),  INT32_C(   663646284), -INT32_C(   716083877),  INT32_C(   812318134) },
+      {  INT32_C(   980192230),  INT32_C(   771362882),  INT32_C(  1556956973), -INT32_C(  1130807445),  INT32_C(  1913839393),  INT32_C(   663646284), -INT32_C(   716083877),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_compress_epi32(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_compress_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      {  INT64_C( 5638606104605193571),  INT64_C( 6174085018379618900),  INT64_C( 2423045293790845653), -INT64_C( 2593952255678032115),
+         INT64_C( 5385123090076680367), -INT64_C(   19505958417450998),  INT64_C( 6332841337752046024), -INT64_C( 6322331158265348387) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(255),
+      {  INT64_C( 2824169709921341566), -INT64_C( 8955782655319156877), -INT64_C( 4057468988823639110),  INT64_C( 9202126341531597262),
+        -INT64_C( 5639497878557316909),  INT64_C( 2156897768763875272), -INT64_C(  467755366132474639), -INT64_C( 4403552931481712136) },
+      {  INT64_C( 2824169709921341566), -INT64_C( 8955782655319156877), -INT64_C( 4057468988823639110),  INT64_C( 9202126341531597262),
+        -INT64_C( 5639497878557316909),  INT64_C( 2156897768763875272), -INT64_C(  467755366132474639), -INT64_C( 4403552931481712136) } },
+    { UINT8_C( 13),
+      {  INT64_C( 5888717394989780016),  INT64_C( 7819211665332389095),  INT64_C( 6219707615620127310),  INT64_C(  388881938877528682),
+         INT64_C( 2328464450326408561),  INT64_C( 7348210487709256704), -INT64_C( 6766593647774333065), -INT64_C( 5828375438147281645) },
+      {  INT64_C( 5888717394989780016),  INT64_C( 6219707615620127310),  INT64_C(  388881938877528682),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 74),
+      {  INT64_C( 6947933041344087096),  INT64_C( 3834049636551008140), -INT64_C( 8818472384136060729),  INT64_C( 2577821296703839810),
+        -INT64_C( 1336144890201388853), -INT64_C( 2972469703073757140), -INT64_C( 6621957281839803543),  INT64_C( 6214550956553320199) },
+      {  INT64_C( 3834049636551008140),  INT64_C( 2577821296703839810), -INT64_C( 6621957281839803543),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(224),
+      { -INT64_C( 5097772396229587773),  INT64_C( 6760054235675247148),  INT64_C( 2359306095752045361),  INT64_C( 2128074372997095308),
+         INT64_C( 7403706442816253697), -INT64_C( 4925762797634873778),  INT64_C( 1390972861362511834), -INT64_C( 1470356822971333819) },
+      { -INT64_C( 4925762797634873778),  INT64_C( 1390972861362511834), -INT64_C( 1470356822971333819),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(194),
+      {  INT64_C( 7317407803948769535),  INT64_C( 3907533376522968231),  INT64_C( 1154282148612237206),  INT64_C( 2644108539926963748),
+        -INT64_C( 2398749325018684852), -INT64_C( 2478646413021256503), -INT64_C( 8136901948715361310),  INT64_C( 8848176673542257204) },
+      {  INT64_C( 3907533376522968231), -INT64_C( 8136901948715361310),  INT64_C( 8848176673542257204),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 46),
+      {  INT64_C( 4661131949560392967), -INT64_C( 1964848156552342510),  INT64_C( 8351043147406893761),  INT64_C( 2148912839885843179),
+        -INT64_C(  266780529528873723),  INT64_C( 5443357736037056301), -INT64_C(  776969727138623801),  INT64_C(  601906311519408212) },
+      { -INT64_C( 1964848156552342510),  INT64_C( 8351043147406893761),  INT64_C( 2148912839885843179),  INT64_C( 5443357736037056301),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(106),
+      {  INT64_C( 9004728871515170854),  INT64_C( 1251776001069079550), -INT64_C( 2554105495027428707), -INT64_C( 7922325746963617473),
+        -INT64_C( 5110126417637584565), -INT64_C(  764677399888785350),  INT64_C( 7208092828509793382), -INT64_C( 8078066660846284332) },
+      {  INT64_C( 1251776001069079550), -INT64_C( 7922325746963617473), -INT64_C(  764677399888785350),  INT64_C( 7208092828509793382),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_compress_epi64(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_compress_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { SIMDE_FLOAT64_C(  -321.57), SIMDE_FLOAT64_C(  -744.04), SIMDE_FLOAT64_C(  -777.89), SIMDE_FLOAT64_C(   440.04),
+        SIMDE_FLOAT64_C(   131.26), SIMDE_FLOAT64_C(  -713.31), SIMDE_FLOAT64_C(   227.00), SIMDE_FLOAT64_C(   266.15) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(255),
+      { SIMDE_FLOAT64_C(   799.16), SIMDE_FLOAT64_C(  -615.09), SIMDE_FLOAT64_C(  -384.23), SIMDE_FLOAT64_C(  -966.54),
+        SIMDE_FLOAT64_C(  -169.41), SIMDE_FLOAT64_C(  -261.22), SIMDE_FLOAT64_C(   666.53), SIMDE_FLOAT64_C(  -257.74) },
+      { SIMDE_FLOAT64_C(   799.16), SIMDE_FLOAT64_C(  -615.09), SIMDE_FLOAT64_C(  -384.23), SIMDE_FLOAT64_C(  -966.54),
+        SIMDE_FLOAT64_C(  -169.41), SIMDE_FLOAT64_C(  -261.22), SIMDE_FLOAT64_C(   666.53), SIMDE_FLOAT64_C(  -257.74) } },
+    { UINT8_C( 16),
+      { SIMDE_FLOAT64_C(  -855.98), SIMDE_FLOAT64_C(   -63.77), SIMDE_FLOAT64_C(   596.00), SIMDE_FLOAT64_C(   208.01),
+        SIMDE_FLOAT64_C(  -733.30), SIMDE_FLOAT64_C(  -969.22), SIMDE_FLOAT64_C(   454.73), SIMDE_FLOAT64_C(   950.95) },
+      { SIMDE_FLOAT64_C(  -733.30), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C( 95),
+      { SIMDE_FLOAT64_C(  -399.83), SIMDE_FLOAT64_C(  -103.72), SIMDE_FLOAT64_C(  -499.50), SIMDE_FLOAT64_C(  -489.90),
+        SIMDE_FLOAT64_C(    71.22), SIMDE_FLOAT64_C(  -808.18), SIMDE_FLOAT64_C(  -917.52), SIMDE_FLOAT64_C(  -303.22) },
+      { SIMDE_FLOAT64_C(  -399.83), SIMDE_FLOAT64_C(  -103.72), SIMDE_FLOAT64_C(  -499.50), SIMDE_FLOAT64_C(  -489.90),
+        SIMDE_FLOAT64_C(    71.22), SIMDE_FLOAT64_C(  -917.52), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(252),
+      { SIMDE_FLOAT64_C(   -51.27), SIMDE_FLOAT64_C(   -69.99), SIMDE_FLOAT64_C(  -969.05), SIMDE_FLOAT64_C(  -515.25),
+        SIMDE_FLOAT64_C(  -623.73), SIMDE_FLOAT64_C(   986.67), SIMDE_FLOAT64_C(   105.48), SIMDE_FLOAT64_C(  -472.00) },
+      { SIMDE_FLOAT64_C(  -969.05), SIMDE_FLOAT64_C(  -515.25), SIMDE_FLOAT64_C(  -623.73), SIMDE_FLOAT64_C(   986.67),
+        SIMDE_FLOAT64_C(   105.48), SIMDE_FLOAT64_C(  -472.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C( 90),
+      { SIMDE_FLOAT64_C(  -552.62), SIMDE_FLOAT64_C(   718.08), SIMDE_FLOAT64_C(  -961.29), SIMDE_FLOAT64_C(  -985.38),
+        SIMDE_FLOAT64_C(   694.93), SIMDE_FLOAT64_C(   186.59), SIMDE_FLOAT64_C(   564.38), SIMDE_FLOAT64_C(   209.41) },
+      { SIMDE_FLOAT64_C(   718.08), SIMDE_FLOAT64_C(  -985.38), SIMDE_FLOAT64_C(   694.93), SIMDE_FLOAT64_C(   564.38),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(121),
+      { SIMDE_FLOAT64_C(   810.53), SIMDE_FLOAT64_C(   838.24), SIMDE_FLOAT64_C(   -47.74), SIMDE_FLOAT64_C(   577.35),
+        SIMDE_FLOAT64_C(   863.29), SIMDE_FLOAT64_C(    40.81), SIMDE_FLOAT64_C(  -847.53), SIMDE_FLOAT64_C(   507.39) },
+      { SIMDE_FLOAT64_C(   810.53), SIMDE_FLOAT64_C(   577.35), SIMDE_FLOAT64_C(   863.29), SIMDE_FLOAT64_C(    40.81),
+        SIMDE_FLOAT64_C(  -847.53), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(191),
+      { SIMDE_FLOAT64_C(  -768.40), SIMDE_FLOAT64_C(  -490.53), SIMDE_FLOAT64_C(   805.61), SIMDE_FLOAT64_C(   599.48),
+        SIMDE_FLOAT64_C(  -796.69), SIMDE_FLOAT64_C(   143.57), SIMDE_FLOAT64_C(  -508.15), SIMDE_FLOAT64_C(  -583.36) },
+      { SIMDE_FLOAT64_C(  -768.40), SIMDE_FLOAT64_C(  -490.53), SIMDE_FLOAT64_C(   805.61), SIMDE_FLOAT64_C(   599.48),
+        SIMDE_FLOAT64_C(  -796.69), SIMDE_FLOAT64_C(   143.57), SIMDE_FLOAT64_C(  -583.36), SIMDE_FLOAT64_C(     0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_maskz_compress_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_compress_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { UINT16_C(    0),
+      { SIMDE_FLOAT32_C(  -516.30), SIMDE_FLOAT32_C(   853.12), SIMDE_FLOAT32_C(   508.00), SIMDE_FLOAT32_C(   161.38),
+        SIMDE_FLOAT32_C(  -508.96), SIMDE_FLOAT32_C(  -326.41), SIMDE_FLOAT32_C(  -989.53), SIMDE_FLOAT32_C(   389.73),
+        SIMDE_FLOAT32_C(   848.62), SIMDE_FLOAT32_C(   950.69), SIMDE_FLOAT32_C(  -608.96), SIMDE_FLOAT32_C(  -267.54),
+        SIMDE_FLOAT32_C(  -378.73), SIMDE_FLOAT32_C(   747.71), SIMDE_FLOAT32_C(   673.94), SIMDE_FLOAT32_C(   964.64) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(65535),
+      { SIMDE_FLOAT32_C(   960.31), SIMDE_FLOAT32_C(   304.40), SIMDE_FLOAT32_C(  -220.86), SIMDE_FLOAT32_C(   194.43),
+        SIMDE_FLOAT32_C(  -470.11), SIMDE_FLOAT32_C(  -597.21), SIMDE_FLOAT32_C(   122.92), SIMDE_FLOAT32_C(  -369.29),
+        SIMDE_FLOAT32_C(    36.26), SIMDE_FLOAT32_C(  -721.77), SIMDE_FLOAT32_C(   423.06), SIMDE_FLOAT32_C(  -501.31),
+        SIMDE_FLOAT32_C(   154.64), SIMDE_FLOAT32_C(  -703.23), SIMDE_FLOAT32_C(   160.73), SIMDE_FLOAT32_C(  -529.23) },
+      { SIMDE_FLOAT32_C(   960.31), SIMDE_FLOAT32_C(   304.40), SIMDE_FLOAT32_C(  -220.86), SIMDE_FLOAT32_C(   194.43),
+        SIMDE_FLOAT32_C(  -470.11), SIMDE_FLOAT32_C(  -597.21), SIMDE_FLOAT32_C(   122.92), SIMDE_FLOAT32_C(  -369.29),
+        SIMDE_FLOAT32_C(    36.26), SIMDE_FLOAT32_C(  -721.77), SIMDE_FLOAT32_C(   423.06), SIMDE_FLOAT32_C(  -501.31),
+        SIMDE_FLOAT32_C(   154.64), SIMDE_FLOAT32_C(  -703.23), SIMDE_FLOAT32_C(   160.73), SIMDE_FLOAT32_C(  -529.23) } },
+    { UINT16_C(49251),
+      { SIMDE_FLOAT32_C(  -312.78), SIMDE_FLOAT32_C(   847.30), SIMDE_FLOAT32_C(    96.78), SIMDE_FLOAT32_C(    67.24),
+        SIMDE_FLOAT32_C(  -638.83), SIMDE_FLOAT32_C(    57.80), SIMDE_FLOAT32_C(  -588.14), SIMDE_FLOAT32_C(  -833.60),
+        SIMDE_FLOAT32_C(  -135.30), SIMDE_FLOAT32_C(    68.04), SIMDE_FLOAT32_C(  -493.46), SIMDE_FLOAT32_C(  -232.99),
+        SIMDE_FLOAT32_C(   150.64), SIMDE_FLOAT32_C(   -22.81), SIMDE_FLOAT32_C(  -935.20), SIMDE_FLOAT32_C(   457.42) },
+      { SIMDE_FLOAT32_C(  -312.78), SIMDE_FLOAT32_C(   847.30), SIMDE_FLOAT32_C(    57.80), SIMDE_FLOAT32_C(  -588.14),
+        SIMDE_FLOAT32_C(  -935.20), SIMDE_FLOAT32_C(   457.42), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(28588),
+      { SIMDE_FLOAT32_C(  -967.14), SIMDE_FLOAT32_C(  -357.34), SIMDE_FLOAT32_C(  -703.55), SIMDE_FLOAT32_C(  -497.66),
+        SIMDE_FLOAT32_C(   -43.33), SIMDE_FLOAT32_C(    38.22), SIMDE_FLOAT32_C(   850.50), SIMDE_FLOAT32_C(   242.56),
+        SIMDE_FLOAT32_C(   -32.76), SIMDE_FLOAT32_C(   923.52), SIMDE_FLOAT32_C(   272.32), SIMDE_FLOAT32_C(  -231.19),
+        SIMDE_FLOAT32_C(  -155.89), SIMDE_FLOAT32_C(    41.27), SIMDE_FLOAT32_C(  -790.51), SIMDE_FLOAT32_C(   276.39) },
+      { SIMDE_FLOAT32_C(  -703.55), SIMDE_FLOAT32_C(  -497.66), SIMDE_FLOAT32_C(    38.22), SIMDE_FLOAT32_C(   242.56),
+        SIMDE_FLOAT32_C(   -32.76), SIMDE_FLOAT32_C(   923.52), SIMDE_FLOAT32_C(   272.32), SIMDE_FLOAT32_C(  -231.19),
+        SIMDE_FLOAT32_C(    41.27), SIMDE_FLOAT32_C(  -790.51), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(26312),
+      { SIMDE_FLOAT32_C(  -166.72), SIMDE_FLOAT32_C(  -809.28), SIMDE_FLOAT32_C(  -166.21), SIMDE_FLOAT32_C(   713.94),
+        SIMDE_FLOAT32_C(  -255.25), SIMDE_FLOAT32_C(   970.11), SIMDE_FLOAT32_C(  -653.86), SIMDE_FLOAT32_C(  -882.13),
+        SIMDE_FLOAT32_C(   205.78), SIMDE_FLOAT32_C(  -399.99), SIMDE_FLOAT32_C(  -463.52), SIMDE_FLOAT32_C(   494.59),
+        SIMDE_FLOAT32_C(  -348.42), SIMDE_FLOAT32_C(   -15.62), SIMDE_FLOAT32_C(  -830.62), SIMDE_FLOAT32_C(  -307.00) },
+      { SIMDE_FLOAT32_C(   713.94), SIMDE_FLOAT32_C(  -653.86), SIMDE_FLOAT32_C(  -882.13), SIMDE_FLOAT32_C(  -399.99),
+        SIMDE_FLOAT32_C(  -463.52), SIMDE_FLOAT32_C(   -15.62), SIMDE_FLOAT32_C(  -830.62), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(46604),
+      { SIMDE_FLOAT32_C(   547.25), SIMDE_FLOAT32_C(   721.75), SIMDE_FLOAT32_C(   743.67), SIMDE_FLOAT32_C(    37.87),
+        SIMDE_FLOAT32_C(  -638.48), SIMDE_FLOAT32_C(   760.86), SIMDE_FLOAT32_C(   856.99), SIMDE_FLOAT32_C(  -488.69),
+        SIMDE_FLOAT32_C(   578.63), SIMDE_FLOAT32_C(  -329.66), SIMDE_FLOAT32_C(  -318.49), SIMDE_FLOAT32_C(   314.91),
+        SIMDE_FLOAT32_C(  -804.60), SIMDE_FLOAT32_C(  -921.57), SIMDE_FLOAT32_C(   390.74), SIMDE_FLOAT32_C(   487.41) },
+      { SIMDE_FLOAT32_C(   743.67), SIMDE_FLOAT32_C(    37.87), SIMDE_FLOAT32_C(  -329.66), SIMDE_FLOAT32_C(  -318.49),
+        SIMDE_FLOAT32_C(  -804.60), SIMDE_FLOAT32_C(  -921.57), SIMDE_FLOAT32_C(   487.41), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(29381),
+      { SIMDE_FLOAT32_C(   235.26), SIMDE_FLOAT32_C(   867.92), SIMDE_FLOAT32_C(   788.43), SIMDE_FLOAT32_C(  -270.65),
+        SIMDE_FLOAT32_C(   282.40), SIMDE_FLOAT32_C(   654.16), SIMDE_FLOAT32_C(  -910.06), SIMDE_FLOAT32_C(   834.80),
+        SIMDE_FLOAT32_C(  -484.19), SIMDE_FLOAT32_C(   293.25), SIMDE_FLOAT32_C(  -331.30), SIMDE_FLOAT32_C(  -744.13),
+        SIMDE_FLOAT32_C(   600.82), SIMDE_FLOAT32_C(  -110.64), SIMDE_FLOAT32_C(   529.15), SIMDE_FLOAT32_C(   770.92) },
+      { SIMDE_FLOAT32_C(   235.26), SIMDE_FLOAT32_C(   788.43), SIMDE_FLOAT32_C(  -910.06), SIMDE_FLOAT32_C(   834.80),
+        SIMDE_FLOAT32_C(   293.25), SIMDE_FLOAT32_C(   600.82), SIMDE_FLOAT32_C(  -110.64), SIMDE_FLOAT32_C(   529.15),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(  502),
+      { SIMDE_FLOAT32_C(   879.23), SIMDE_FLOAT32_C(  -179.44), SIMDE_FLOAT32_C(  -121.96), SIMDE_FLOAT32_C(  -282.53),
+        SIMDE_FLOAT32_C(   880.07), SIMDE_FLOAT32_C(  -672.11), SIMDE_FLOAT32_C(  -463.50), SIMDE_FLOAT32_C(   455.10),
+        SIMDE_FLOAT32_C(  -500.61), SIMDE_FLOAT32_C(   574.70), SIMDE_FLOAT32_C(  -984.84), SIMDE_FLOAT32_C(  -210.19),
+        SIMDE_FLOAT32_C(   -31.99), SIMDE_FLOAT32_C(   900.69), SIMDE_FLOAT32_C(  -551.60), SIMDE_FLOAT32_C(  -794.15) },
+      { SIMDE_FLOAT32_C(  -179.44), SIMDE_FLOAT32_C(  -121.96), SIMDE_FLOAT32_C(   880.07), SIMDE_FLOAT32_C(  -672.11),
+        SIMDE_FLOAT32_C(  -463.50), SIMDE_FLOAT32_C(   455.10), SIMDE_FLOAT32_C(  -500.61), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_maskz_compress_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_compressstoreu_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { UINT16_C(    0),
+      { -INT32_C(  1940722730), -INT32_C(  1351377775), -INT32_C(   495649378), -INT32_C(   571065211), -INT32_C(  1689801142),  INT32_C(     4386178),  INT32_C(  1842271178),  INT32_C(  1269202059),
+        -INT32_C(  1647822143), -INT32_C(   320088546), -INT32_C(   927235393), -INT32_C(   358269689),  INT32_C(  1148995281),  INT32_C(   288069672), -INT32_C(  1897953079), -INT32_C(   568829277) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(65535),
+      {  INT32_C(  1311807827),  INT32_C(   772975042), -INT32_C(  2138875474), -INT32_C(   692222831), -INT32_C(   861841583), -INT32_C(  1828911293),  INT32_C(  1784033529), -INT32_C(  2043520448),
+        -INT32_C(  1170809487),  INT32_C(  1957643605),  INT32_C(  1004599212),  INT32_C(  2095154351),  INT32_C(   998064530), -INT32_C(   146550549), -INT32_C(   345307708),  INT32_C(   549814322) },
+      {  INT32_C(  1311807827),  INT32_C(   772975042), -INT32_C(  2138875474), -INT32_C(   692222831), -INT32_C(   861841583), -INT32_C(  1828911293),  INT32_C(  1784033529), -INT32_C(  2043520448),
+        -INT32_C(  1170809487),  INT32_C(  1957643605),  INT32_C(  1004599212),  INT32_C(  2095154351),  INT32_C(   998064530), -INT32_C(   146550549), -INT32_C(   345307708),  INT32_C(   549814322) } },
+    { UINT16_C(53808),
+      {  INT32_C(  1012186514),  INT32_C(  1560137750), -INT32_C(  1109085266),  INT32_C(  1223929368), -INT32_C(   549387878),  INT32_C(   894156880),  INT32_C(  1945526425), -INT32_C(   520634131),
+        -INT32_C(  1202568565), -INT32_C(   502260079), -INT32_C(  1719520553),  INT32_C(  1579066818), -INT32_C(   167619550),  INT32_C(   135706955),  INT32_C(  1660548188), -INT32_C(  1145519664) },
+      { -INT32_C(   549387878),  INT32_C(   894156880), -INT32_C(   502260079), -INT32_C(   167619550),  INT32_C(  1660548188), -INT32_C(  1145519664),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(11322),
+      { -INT32_C(   347240313),  INT32_C(    40430486),  INT32_C(  1808162878), -INT32_C(  1255179985),  INT32_C(  1356065842),  INT32_C(  1814963728),  INT32_C(  1040188462), -INT32_C(   682675774),
+         INT32_C(   499561442),  INT32_C(  1689613653), -INT32_C(   975520812), -INT32_C(  1126756892), -INT32_C(   637234401),  INT32_C(   249890129), -INT32_C(  1470495742),  INT32_C(  2057905963) },
+      {  INT32_C(    40430486), -INT32_C(  1255179985),  INT32_C(  1356065842),  INT32_C(  1814963728), -INT32_C(   975520812), -INT32_C(  1126756892),  INT32_C(   249890129),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(34626),
+      { -INT32_C(  1053467837), -INT32_C(  1039497824), -INT32_C(  2024024931),  INT32_C(   133198948),  INT32_C(   858257071),  INT32_C(   177815877),  INT32_C(   514447916), -INT32_C(  1590047190),
+        -INT32_C(  1688771642), -INT32_C(   940048292), -INT32_C(   155364384),  INT32_C(  1615492851),  INT32_C(   902431308), -INT32_C(   921359589),  INT32_C(  1293907842), -INT32_C(  1772613897) },
+      { -INT32_C(  1039497824),  INT32_C(   514447916), -INT32_C(  1688771642), -INT32_C(   940048292), -INT32_C(   155364384), -INT32_C(  1772613897),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(51747),
+      { -INT32_C(   381429654), -INT32_C(  1555856780), -INT32_C(   515114944), -INT32_C(  1177388456),  INT32_C(   311676026),  INT32_C(   439530486),  INT32_C(  1242186864), -INT32_C(   619745392),
+        -INT32_C(   741964312),  INT32_C(   569405548),  INT32_C(  1681187635), -INT32_C(  1530843720), -INT32_C(   196559025),  INT32_C(   186598147),  INT32_C(  2141737633), -INT32_C(  1852268729) },
+      { -INT32_C(   381429654), -INT32_C(  1555856780),  INT32_C(   439530486),  INT32_C(   569405548), -INT32_C(  1530843720),  INT32_C(  2141737633), -INT32_C(  1852268729),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C( 9156),
+      { -INT32_C(  1142816025),  INT32_C(  1975546406), -INT32_C(  1245815619), -INT32_C(  1682958332),  INT32_C(  1615991816),  INT32_C(   613150248),  INT32_C(    86997426),  INT32_C(   538350883),
+        -INT32_C(  1040253544),  INT32_C(  2142032878),  INT32_C(  1113628979), -INT32_C(  1603996788), -INT32_C(  1232252589), -INT32_C(  1620181259),  INT32_C(   389631918),  INT32_C(  1829057317) },
+      { -INT32_C(  1245815619),  INT32_C(    86997426),  INT32_C(   538350883), -INT32_C(  1040253544),  INT32_C(  2142032878), -INT32_C(  1620181259),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(32189),
+      {  INT32_C(   599550560), -INT32_C(  1801209669), -INT32_C(   799362773),  INT32_C(  1100011273),  INT32_C(   640714601),  INT32_C(   392927316), -INT32_C(   622389411), -INT32_C(  1928624907),
+         INT32_C(  1461190188), -INT32_C(  1094105275),  INT32_C(  1566154913),  INT32_C(  1892929205), -INT32_C(   727210928), -INT32_C(    30011157),  INT32_C(  1600880869), -INT32_C(   955546993) },
+      {  INT32_C(   599550560), -INT32_C(   799362773),  INT32_C(  1100011273),  INT32_C(   640714601),  INT32_C(   392927316), -INT32_C(  1928624907),  INT32_C(  1461190188),  INT32_C(  1566154913),
+         INT32_C(  1892929205), -INT32_C(   727210928), -INT32_C(    30011157),  INT32_C(  1600880869),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r[16] = { 0, };
+    simde_mm512_mask_compressstoreu_epi32(r, test_vec[i].k, a);
+    simde_assert_equal_vi32(16, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_compressstoreu_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      {  INT64_C( 8831397834188120775), -INT64_C( 7958720979775378402),  INT64_C( 5994722720870179886),  INT64_C( 1497427923742088835),
+         INT64_C( 9087970537190066768),  INT64_C( 3207051274775409194),  INT64_C( 4551850253035459028), -INT64_C( 6567393306036593847) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(255),
+      {  INT64_C( 9146082443557418827), -INT64_C( 4045302711724189794), -INT64_C(  246050773002733556), -INT64_C( 6458161242581572857),
+         INT64_C(  334119544648069415), -INT64_C( 7488741554655451094), -INT64_C( 6043679385586889055), -INT64_C( 8846307233728519813) },
+      {  INT64_C( 9146082443557418827), -INT64_C( 4045302711724189794), -INT64_C(  246050773002733556), -INT64_C( 6458161242581572857),
+         INT64_C(  334119544648069415), -INT64_C( 7488741554655451094), -INT64_C( 6043679385586889055), -INT64_C( 8846307233728519813) } },
+    { UINT8_C( 40),
+      { -INT64_C( 2294362933697239807),  INT64_C( 8139124090198387987), -INT64_C( 3610103201232176624),  INT64_C( 8072808172702021236),
+        -INT64_C( 6785654662525201338),  INT64_C( 5656839197415549986),  INT64_C( 5597500377728262720),  INT64_C( 1635695065524935031) },
+      {  INT64_C( 8072808172702021236),  INT64_C( 5656839197415549986),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(120),
+      {  INT64_C( 1940228107580248927), -INT64_C( 4863503465876486202), -INT64_C( 2995761232702785179), -INT64_C( 5333828945958437007),
+         INT64_C( 4948236124116831620),  INT64_C( 8735113800899582866),  INT64_C( 9134908215458065237), -INT64_C( 6981294698611238886) },
+      { -INT64_C( 5333828945958437007),  INT64_C( 4948236124116831620),  INT64_C( 8735113800899582866),  INT64_C( 9134908215458065237),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 10),
+      { -INT64_C( 1474288530534626521), -INT64_C(  956048383561021332), -INT64_C( 7419243914522926431),  INT64_C( 6426425109532234348),
+         INT64_C(  551735393229420341),  INT64_C(    3983296483333393),  INT64_C( 8234859130252847204), -INT64_C( 6723540473123492412) },
+      { -INT64_C(  956048383561021332),  INT64_C( 6426425109532234348),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(121),
+      { -INT64_C(  624549665590848353), -INT64_C( 5947112178875027536), -INT64_C( 8706706069077929586), -INT64_C( 5031536031346076046),
+         INT64_C(  316551230000593609), -INT64_C( 2774961606393693098), -INT64_C( 7468533808816093082), -INT64_C( 4372126714536679707) },
+      { -INT64_C(  624549665590848353), -INT64_C( 5031536031346076046),  INT64_C(  316551230000593609), -INT64_C( 2774961606393693098),
+        -INT64_C( 7468533808816093082),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(212),
+      {  INT64_C( 4867444789458774271),  INT64_C(  191808866259880273),  INT64_C( 5023362612466552324), -INT64_C(   45225682337516363),
+        -INT64_C( 4124433502274899032), -INT64_C( 5049523662800157983),  INT64_C(  355708088443180654),  INT64_C( 2427626704153759286) },
+      {  INT64_C( 5023362612466552324), -INT64_C( 4124433502274899032),  INT64_C(  355708088443180654),  INT64_C( 2427626704153759286),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 25),
+      {  INT64_C( 2380564862392491010), -INT64_C( 7171230560693056235),  INT64_C( 7431262046319736693),  INT64_C( 8560610282361819847),
+         INT64_C( 2546671585192418912), -INT64_C( 3858180274087381345), -INT64_C( 1817356790914000567), -INT64_C( 3744551942777949361) },
+      {  INT64_C( 2380564862392491010),  INT64_C( 8560610282361819847),  INT64_C( 2546671585192418912),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r[8] = { 0, };
+    simde_mm512_mask_compressstoreu_epi64(r, test_vec[i].k, a);
+    simde_assert_equal_vi64(8, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_compressstoreu_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { SIMDE_FLOAT64_C(   228.60), SIMDE_FLOAT64_C(  -329.20), SIMDE_FLOAT64_C(  -816.17), SIMDE_FLOAT64_C(   195.95),
+        SIMDE_FLOAT64_C(   298.78), SIMDE_FLOAT64_C(   952.88), SIMDE_FLOAT64_C(  -361.27), SIMDE_FLOAT64_C(  -703.01) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(255),
+      { SIMDE_FLOAT64_C(   373.77), SIMDE_FLOAT64_C(   848.76), SIMDE_FLOAT64_C(  -648.11), SIMDE_FLOAT64_C(  -130.92),
+        SIMDE_FLOAT64_C(   935.99), SIMDE_FLOAT64_C(  -117.28), SIMDE_FLOAT64_C(   507.74), SIMDE_FLOAT64_C(  -799.25) },
+      { SIMDE_FLOAT64_C(   373.77), SIMDE_FLOAT64_C(   848.76), SIMDE_FLOAT64_C(  -648.11), SIMDE_FLOAT64_C(  -130.92),
+        SIMDE_FLOAT64_C(   935.99), SIMDE_FLOAT64_C(  -117.28), SIMDE_FLOAT64_C(   507.74), SIMDE_FLOAT64_C(  -799.25) } },
+    { UINT8_C( 17),
+      { SIMDE_FLOAT64_C(  -742.50), SIMDE_FLOAT64_C(  -197.41), SIMDE_FLOAT64_C(   415.95), SIMDE_FLOAT64_C(   810.47),
+        SIMDE_FLOAT64_C(    77.02), SIMDE_FLOAT64_C(    97.91), SIMDE_FLOAT64_C(  -363.61), SIMDE_FLOAT64_C(   551.33) },
+      { SIMDE_FLOAT64_C(  -742.50), SIMDE_FLOAT64_C(    77.02), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(203),
+      { SIMDE_FLOAT64_C(  -231.82), SIMDE_FLOAT64_C(   496.10), SIMDE_FLOAT64_C(   314.24), SIMDE_FLOAT64_C(  -107.98),
+        SIMDE_FLOAT64_C(   698.22), SIMDE_FLOAT64_C(  -929.30), SIMDE_FLOAT64_C(   692.92), SIMDE_FLOAT64_C(   959.48) },
+      { SIMDE_FLOAT64_C(  -231.82), SIMDE_FLOAT64_C(   496.10), SIMDE_FLOAT64_C(  -107.98), SIMDE_FLOAT64_C(   692.92),
+        SIMDE_FLOAT64_C(   959.48), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(200),
+      { SIMDE_FLOAT64_C(   343.97), SIMDE_FLOAT64_C(   -50.04), SIMDE_FLOAT64_C(  -225.12), SIMDE_FLOAT64_C(  -501.11),
+        SIMDE_FLOAT64_C(   409.77), SIMDE_FLOAT64_C(   984.85), SIMDE_FLOAT64_C(   968.23), SIMDE_FLOAT64_C(  -944.08) },
+      { SIMDE_FLOAT64_C(  -501.11), SIMDE_FLOAT64_C(   968.23), SIMDE_FLOAT64_C(  -944.08), SIMDE_FLOAT64_C(     0.00),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(108),
+      { SIMDE_FLOAT64_C(  -654.56), SIMDE_FLOAT64_C(    71.91), SIMDE_FLOAT64_C(    22.40), SIMDE_FLOAT64_C(   130.30),
+        SIMDE_FLOAT64_C(  -258.94), SIMDE_FLOAT64_C(  -901.06), SIMDE_FLOAT64_C(  -589.62), SIMDE_FLOAT64_C(  -900.48) },
+      { SIMDE_FLOAT64_C(    22.40), SIMDE_FLOAT64_C(   130.30), SIMDE_FLOAT64_C(  -901.06), SIMDE_FLOAT64_C(  -589.62),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(142),
+      { SIMDE_FLOAT64_C(  -756.86), SIMDE_FLOAT64_C(  -294.45), SIMDE_FLOAT64_C(    47.77), SIMDE_FLOAT64_C(  -607.23),
+        SIMDE_FLOAT64_C(   -43.18), SIMDE_FLOAT64_C(  -433.61), SIMDE_FLOAT64_C(  -622.02), SIMDE_FLOAT64_C(  -802.25) },
+      { SIMDE_FLOAT64_C(  -294.45), SIMDE_FLOAT64_C(    47.77), SIMDE_FLOAT64_C(  -607.23), SIMDE_FLOAT64_C(  -802.25),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C( 87),
+      { SIMDE_FLOAT64_C(  -362.58), SIMDE_FLOAT64_C(  -476.48), SIMDE_FLOAT64_C(   585.38), SIMDE_FLOAT64_C(  -696.29),
+        SIMDE_FLOAT64_C(  -130.05), SIMDE_FLOAT64_C(  -733.74), SIMDE_FLOAT64_C(  -477.51), SIMDE_FLOAT64_C(  -147.12) },
+      { SIMDE_FLOAT64_C(  -362.58), SIMDE_FLOAT64_C(  -476.48), SIMDE_FLOAT64_C(   585.38), SIMDE_FLOAT64_C(  -130.05),
+        SIMDE_FLOAT64_C(  -477.51), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_float64 r[8] = { 0, };
+    simde_mm512_mask_compressstoreu_pd(r, test_vec[i].k, a);
+    simde_assert_equal_vf64(8, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_compressstoreu_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { UINT16_C(    0),
+      { SIMDE_FLOAT32_C(   732.23), SIMDE_FLOAT32_C(  -243.58), SIMDE_FLOAT32_C(   972.52), SIMDE_FLOAT32_C(  -191.40),
+        SIMDE_FLOAT32_C(   441.13), SIMDE_FLOAT32_C(  -222.36), SIMDE_FLOAT32_C(   947.95), SIMDE_FLOAT32_C(   675.51),
+        SIMDE_FLOAT32_C(   -38.77), SIMDE_FLOAT32_C(  -107.24), SIMDE_FLOAT32_C(   632.35), SIMDE_FLOAT32_C(   462.66),
+        SIMDE_FLOAT32_C(  -762.29), SIMDE_FLOAT32_C(   -51.17), SIMDE_FLOAT32_C(   702.32), SIMDE_FLOAT32_C(  -236.47) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(65535),
+      { SIMDE_FLOAT32_C(  -692.50), SIMDE_FLOAT32_C(   488.87), SIMDE_FLOAT32_C(   -86.57), SIMDE_FLOAT32_C(  -405.57),
+        SIMDE_FLOAT32_C(  -478.67), SIMDE_FLOAT32_C(  -631.06), SIMDE_FLOAT32_C(   531.30), SIMDE_FLOAT32_C(   248.27),
+        SIMDE_FLOAT32_C(  -141.85), SIMDE_FLOAT32_C(   331.23), SIMDE_FLOAT32_C(   527.70), SIMDE_FLOAT32_C(  -280.81),
+        SIMDE_FLOAT32_C(    58.86), SIMDE_FLOAT32_C(  -821.40), SIMDE_FLOAT32_C(  -806.70), SIMDE_FLOAT32_C(  -318.15) },
+      { SIMDE_FLOAT32_C(  -692.50), SIMDE_FLOAT32_C(   488.87), SIMDE_FLOAT32_C(   -86.57), SIMDE_FLOAT32_C(  -405.57),
+        SIMDE_FLOAT32_C(  -478.67), SIMDE_FLOAT32_C(  -631.06), SIMDE_FLOAT32_C(   531.30), SIMDE_FLOAT32_C(   248.27),
+        SIMDE_FLOAT32_C(  -141.85), SIMDE_FLOAT32_C(   331.23), SIMDE_FLOAT32_C(   527.70), SIMDE_FLOAT32_C(  -280.81),
+        SIMDE_FLOAT32_C(    58.86), SIMDE_FLOAT32_C(  -821.40), SIMDE_FLOAT32_C(  -806.70), SIMDE_FLOAT32_C(  -318.15) } },
+    { UINT16_C(50765),
+      { SIMDE_FLOAT32_C(   533.07), SIMDE_FLOAT32_C(  -740.74), SIMDE_FLOAT32_C(  -311.38), SIMDE_FLOAT32_C(   697.27),
+        SIMDE_FLOAT32_C(  -654.26), SIMDE_FLOAT32_C(  -242.33), SIMDE_FLOAT32_C(   550.83), SIMDE_FLOAT32_C(   657.71),
+        SIMDE_FLOAT32_C(  -581.09), SIMDE_FLOAT32_C(  -198.33), SIMDE_FLOAT32_C(   388.58), SIMDE_FLOAT32_C(  -202.09),
+        SIMDE_FLOAT32_C(   742.21), SIMDE_FLOAT32_C(  -304.49), SIMDE_FLOAT32_C(  -835.32), SIMDE_FLOAT32_C(    50.72) },
+      { SIMDE_FLOAT32_C(   533.07), SIMDE_FLOAT32_C(  -311.38), SIMDE_FLOAT32_C(   697.27), SIMDE_FLOAT32_C(   550.83),
+        SIMDE_FLOAT32_C(  -198.33), SIMDE_FLOAT32_C(   388.58), SIMDE_FLOAT32_C(  -835.32), SIMDE_FLOAT32_C(    50.72),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(62104),
+      { SIMDE_FLOAT32_C(  -522.54), SIMDE_FLOAT32_C(    73.20), SIMDE_FLOAT32_C(  -295.74), SIMDE_FLOAT32_C(  -654.76),
+        SIMDE_FLOAT32_C(   608.28), SIMDE_FLOAT32_C(   610.43), SIMDE_FLOAT32_C(   265.98), SIMDE_FLOAT32_C(   995.51),
+        SIMDE_FLOAT32_C(   929.08), SIMDE_FLOAT32_C(   136.86), SIMDE_FLOAT32_C(  -938.34), SIMDE_FLOAT32_C(  -244.79),
+        SIMDE_FLOAT32_C(   502.93), SIMDE_FLOAT32_C(   -13.47), SIMDE_FLOAT32_C(   179.96), SIMDE_FLOAT32_C(   431.63) },
+      { SIMDE_FLOAT32_C(  -654.76), SIMDE_FLOAT32_C(   608.28), SIMDE_FLOAT32_C(   995.51), SIMDE_FLOAT32_C(   136.86),
+        SIMDE_FLOAT32_C(   502.93), SIMDE_FLOAT32_C(   -13.47), SIMDE_FLOAT32_C(   179.96), SIMDE_FLOAT32_C(   431.63),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C( 9832),
+      { SIMDE_FLOAT32_C(  -922.45), SIMDE_FLOAT32_C(  -570.58), SIMDE_FLOAT32_C(   723.10), SIMDE_FLOAT32_C(   638.23),
+        SIMDE_FLOAT32_C(   500.32), SIMDE_FLOAT32_C(   820.05), SIMDE_FLOAT32_C(   960.34), SIMDE_FLOAT32_C(   734.01),
+        SIMDE_FLOAT32_C(  -224.79), SIMDE_FLOAT32_C(  -710.35), SIMDE_FLOAT32_C(   637.39), SIMDE_FLOAT32_C(  -130.37),
+        SIMDE_FLOAT32_C(   568.30), SIMDE_FLOAT32_C(   321.83), SIMDE_FLOAT32_C(  -472.41), SIMDE_FLOAT32_C(   874.11) },
+      { SIMDE_FLOAT32_C(   638.23), SIMDE_FLOAT32_C(   820.05), SIMDE_FLOAT32_C(   960.34), SIMDE_FLOAT32_C(  -710.35),
+        SIMDE_FLOAT32_C(   637.39), SIMDE_FLOAT32_C(   321.83), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(37908),
+      { SIMDE_FLOAT32_C(   234.65), SIMDE_FLOAT32_C(  -888.61), SIMDE_FLOAT32_C(  -284.15), SIMDE_FLOAT32_C(  -417.31),
+        SIMDE_FLOAT32_C(  -797.24), SIMDE_FLOAT32_C(   698.47), SIMDE_FLOAT32_C(  -167.81), SIMDE_FLOAT32_C(  -931.38),
+        SIMDE_FLOAT32_C(    14.45), SIMDE_FLOAT32_C(  -421.18), SIMDE_FLOAT32_C(   837.83), SIMDE_FLOAT32_C(  -188.10),
+        SIMDE_FLOAT32_C(  -389.48), SIMDE_FLOAT32_C(  -401.30), SIMDE_FLOAT32_C(  -323.05), SIMDE_FLOAT32_C(  -613.98) },
+      { SIMDE_FLOAT32_C(  -284.15), SIMDE_FLOAT32_C(  -797.24), SIMDE_FLOAT32_C(   837.83), SIMDE_FLOAT32_C(  -389.48),
+        SIMDE_FLOAT32_C(  -613.98), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(36827),
+      { SIMDE_FLOAT32_C(  -692.94), SIMDE_FLOAT32_C(    93.99), SIMDE_FLOAT32_C(   149.60), SIMDE_FLOAT32_C(  -515.28),
+        SIMDE_FLOAT32_C(   714.11), SIMDE_FLOAT32_C(   303.87), SIMDE_FLOAT32_C(  -874.28), SIMDE_FLOAT32_C(  -393.12),
+        SIMDE_FLOAT32_C(  -909.82), SIMDE_FLOAT32_C(   499.70), SIMDE_FLOAT32_C(  -494.09), SIMDE_FLOAT32_C(   806.28),
+        SIMDE_FLOAT32_C(  -695.95), SIMDE_FLOAT32_C(  -844.14), SIMDE_FLOAT32_C(   562.94), SIMDE_FLOAT32_C(   254.90) },
+      { SIMDE_FLOAT32_C(  -692.94), SIMDE_FLOAT32_C(    93.99), SIMDE_FLOAT32_C(  -515.28), SIMDE_FLOAT32_C(   714.11),
+        SIMDE_FLOAT32_C(  -874.28), SIMDE_FLOAT32_C(  -393.12), SIMDE_FLOAT32_C(  -909.82), SIMDE_FLOAT32_C(   499.70),
+        SIMDE_FLOAT32_C(  -494.09), SIMDE_FLOAT32_C(   806.28), SIMDE_FLOAT32_C(   254.90), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(63101),
+      { SIMDE_FLOAT32_C(  -565.63), SIMDE_FLOAT32_C(  -704.42), SIMDE_FLOAT32_C(  -615.19), SIMDE_FLOAT32_C(  -578.23),
+        SIMDE_FLOAT32_C(    10.64), SIMDE_FLOAT32_C(  -264.21), SIMDE_FLOAT32_C(   275.64), SIMDE_FLOAT32_C(  -757.77),
+        SIMDE_FLOAT32_C(   328.04), SIMDE_FLOAT32_C(   207.22), SIMDE_FLOAT32_C(  -521.91), SIMDE_FLOAT32_C(    97.18),
+        SIMDE_FLOAT32_C(   374.82), SIMDE_FLOAT32_C(   351.18), SIMDE_FLOAT32_C(  -826.51), SIMDE_FLOAT32_C(   336.00) },
+      { SIMDE_FLOAT32_C(  -565.63), SIMDE_FLOAT32_C(  -615.19), SIMDE_FLOAT32_C(  -578.23), SIMDE_FLOAT32_C(    10.64),
+        SIMDE_FLOAT32_C(  -264.21), SIMDE_FLOAT32_C(   275.64), SIMDE_FLOAT32_C(   207.22), SIMDE_FLOAT32_C(  -521.91),
+        SIMDE_FLOAT32_C(   374.82), SIMDE_FLOAT32_C(   351.18), SIMDE_FLOAT32_C(  -826.51), SIMDE_FLOAT32_C(   336.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_float32 r[16] = { 0, };
+    simde_mm512_mask_compressstoreu_ps(r, test_vec[i].k, a);
+    simde_assert_equal_vf32(16, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_compress_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int8_t a[16];
+    const int8_t r[16];
+  } test_vec[] = {
+    { UINT16_C(    0),
+      { -INT8_C(  32), -INT8_C(  73),  INT8_C(  54), -INT8_C( 114), -INT8_C(  63), -INT8_C(  48),  INT8_C( 109),  INT8_C(  15),
+        -INT8_C(  39), -INT8_C(  44),  INT8_C( 121), -INT8_C( 107),  INT8_C(  38), -INT8_C(  52), -INT8_C(  65),  INT8_C(  10) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(65535),
+      { -INT8_C(  90),  INT8_C(  15),  INT8_C(   1), -INT8_C(  79), -INT8_C(  44), -INT8_C( 125),  INT8_C(  72),  INT8_C(  96),
+         INT8_C(  16),  INT8_C( 100), -INT8_C(  24), -INT8_C(  91),  INT8_C(  26),  INT8_C(  28), -INT8_C(  20),  INT8_C(  31) },
+      { -INT8_C(  90),  INT8_C(  15),  INT8_C(   1), -INT8_C(  79), -INT8_C(  44), -INT8_C( 125),  INT8_C(  72),  INT8_C(  96),
+         INT8_C(  16),  INT8_C( 100), -INT8_C(  24), -INT8_C(  91),  INT8_C(  26),  INT8_C(  28), -INT8_C(  20),  INT8_C(  31) } },
+    { UINT16_C(23649),
+      { -INT8_C( 103), -INT8_C(  16), -INT8_C( 117), -INT8_C(  24), -INT8_C(  69), -INT8_C( 120), -INT8_C(  47), -INT8_C(  38),
+        -INT8_C(  57), -INT8_C(  90), -INT8_C(  51),  INT8_C( 108), -INT8_C(   8), -INT8_C(  91),  INT8_C(  92),  INT8_C( 106) },
+      { -INT8_C( 103), -INT8_C( 120), -INT8_C(  47), -INT8_C(  51),  INT8_C( 108), -INT8_C(   8),  INT8_C(  92),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(62845),
+      { -INT8_C(  41),  INT8_C(  32), -INT8_C( 112), -INT8_C(  59), -INT8_C( 108),  INT8_C(   9), -INT8_C(  99), -INT8_C(  72),
+        -INT8_C(  35),  INT8_C(   8),  INT8_C( 118), -INT8_C(  26),  INT8_C(  87),  INT8_C( 123), -INT8_C(  11),  INT8_C(  36) },
+      { -INT8_C(  41), -INT8_C( 112), -INT8_C(  59), -INT8_C( 108),  INT8_C(   9), -INT8_C(  99), -INT8_C(  35),  INT8_C( 118),
+         INT8_C(  87),  INT8_C( 123), -INT8_C(  11),  INT8_C(  36),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(18335),
+      { -INT8_C(  48), -INT8_C(  87),  INT8_C(  78), -INT8_C(  26),  INT8_C(  27), -INT8_C(  27), -INT8_C(   8), -INT8_C(  31),
+        -INT8_C(  78), -INT8_C(  23),      INT8_MIN,  INT8_C(  83), -INT8_C(  73),  INT8_C(   2),  INT8_C( 124),  INT8_C( 110) },
+      { -INT8_C(  48), -INT8_C(  87),  INT8_C(  78), -INT8_C(  26),  INT8_C(  27), -INT8_C(  31), -INT8_C(  78), -INT8_C(  23),
+             INT8_MIN,  INT8_C( 124),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(54607),
+      {  INT8_C(  37),  INT8_C(  59),  INT8_C(  27), -INT8_C(  89), -INT8_C( 118),  INT8_C(  25),  INT8_C(  49), -INT8_C(  97),
+        -INT8_C(  88),  INT8_C( 107), -INT8_C(  21),  INT8_C(  34), -INT8_C( 124),  INT8_C(  77),  INT8_C(  47),  INT8_C(  29) },
+      {  INT8_C(  37),  INT8_C(  59),  INT8_C(  27), -INT8_C(  89),  INT8_C(  49), -INT8_C(  88), -INT8_C(  21), -INT8_C( 124),
+         INT8_C(  47),  INT8_C(  29),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(55981),
+      {  INT8_C(  88), -INT8_C(  44), -INT8_C(  99), -INT8_C(  64), -INT8_C(  13),  INT8_C(  34),  INT8_C(  22),  INT8_C(  16),
+        -INT8_C( 106), -INT8_C(  59),  INT8_C( 112),  INT8_C(  44), -INT8_C(  12), -INT8_C(  27),  INT8_C( 106), -INT8_C(  66) },
+      {  INT8_C(  88), -INT8_C(  99), -INT8_C(  64),  INT8_C(  34),  INT8_C(  16), -INT8_C(  59),  INT8_C(  44), -INT8_C(  12),
+         INT8_C( 106), -INT8_C(  66),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(40596),
+      { -INT8_C(  87), -INT8_C(  92), -INT8_C(  93), -INT8_C(  60), -INT8_C( 113),  INT8_C(  40),  INT8_C( 124), -INT8_C(  70),
+         INT8_C(  15), -INT8_C(  53),  INT8_C(  98), -INT8_C(   2),  INT8_C( 107),  INT8_C( 109), -INT8_C(  75),  INT8_C(   0) },
+      { -INT8_C(  93), -INT8_C( 113), -INT8_C(  70), -INT8_C(  53),  INT8_C(  98), -INT8_C(   2),  INT8_C( 107),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_compress_epi8(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_compress_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t r[8];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { -INT16_C( 15205), -INT16_C( 14661), -INT16_C( 23903), -INT16_C( 28477), -INT16_C( 24387), -INT16_C( 29349), -INT16_C(  8262), -INT16_C(  4204) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(255),
+      { -INT16_C( 28889), -INT16_C(  1978),  INT16_C(  9401), -INT16_C( 18426), -INT16_C( 16045), -INT16_C(  6152), -INT16_C( 31168), -INT16_C(  1257) },
+      { -INT16_C( 28889), -INT16_C(  1978),  INT16_C(  9401), -INT16_C( 18426), -INT16_C( 16045), -INT16_C(  6152), -INT16_C( 31168), -INT16_C(  1257) } },
+    { UINT8_C(180),
+      { -INT16_C( 10381), -INT16_C( 15874), -INT16_C(  4568),  INT16_C(  5805), -INT16_C( 15240), -INT16_C(  3795),  INT16_C( 29226), -INT16_C( 24616) },
+      { -INT16_C(  4568), -INT16_C( 15240), -INT16_C(  3795), -INT16_C( 24616),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C( 29),
+      { -INT16_C( 31611),  INT16_C(  2321),  INT16_C( 21187),  INT16_C( 14240),  INT16_C( 26299),  INT16_C(  6046),  INT16_C(  1723), -INT16_C( 26190) },
+      { -INT16_C( 31611),  INT16_C( 21187),  INT16_C( 14240),  INT16_C( 26299),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(139),
+      {  INT16_C(  4596), -INT16_C( 13989), -INT16_C( 19572),  INT16_C(   622), -INT16_C( 19886), -INT16_C( 14059), -INT16_C( 21580),  INT16_C( 21576) },
+      {  INT16_C(  4596), -INT16_C( 13989),  INT16_C(   622),  INT16_C( 21576),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(243),
+      { -INT16_C(  4132),  INT16_C( 16432), -INT16_C( 25126),  INT16_C( 19372), -INT16_C( 30031), -INT16_C( 25963),  INT16_C(  7365),  INT16_C( 25986) },
+      { -INT16_C(  4132),  INT16_C( 16432), -INT16_C( 30031), -INT16_C( 25963),  INT16_C(  7365),  INT16_C( 25986),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(194),
+      { -INT16_C( 16635),  INT16_C( 16902),  INT16_C( 16270), -INT16_C(  1907), -INT16_C( 23337),  INT16_C( 29361),  INT16_C(  6716), -INT16_C( 25566) },
+      {  INT16_C( 16902),  INT16_C(  6716), -INT16_C( 25566),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(133),
+      {  INT16_C( 18880), -INT16_C(  1157), -INT16_C( 30096), -INT16_C( 13673), -INT16_C( 21653),  INT16_C( 10270),  INT16_C(  4730), -INT16_C(  4578) },
+      {  INT16_C( 18880), -INT16_C( 30096), -INT16_C(  4578),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_compress_epi16(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_compress_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 k;
+    const int8_t a[32];
+    const int8_t r[32];
+  } test_vec[] = {
+    { UINT32_C(         0),
+      {  INT8_C( 125), -INT8_C(  29),  INT8_C(  34), -INT8_C(  82),  INT8_C(  83), -INT8_C(  81),  INT8_C(  52),  INT8_C(  54),
+        -INT8_C(  34), -INT8_C(  59),  INT8_C( 124),  INT8_C(  82),  INT8_C(  66),  INT8_C(  60), -INT8_C(  74),  INT8_C(  85),
+        -INT8_C( 105),  INT8_C( 104),  INT8_C(  34),  INT8_C(  74), -INT8_C(  70), -INT8_C(  51),  INT8_C( 112), -INT8_C(   2),
+         INT8_C(  79), -INT8_C( 115), -INT8_C(  32), -INT8_C( 113),  INT8_C(  46), -INT8_C(  16), -INT8_C(  13),  INT8_C( 114) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(4294967295),
+      {  INT8_C(  96),  INT8_C(  96), -INT8_C( 116), -INT8_C(  53),  INT8_C(  10),  INT8_C( 104), -INT8_C(  44), -INT8_C(  13),
+         INT8_C(  10),  INT8_C( 120),  INT8_C(   2), -INT8_C(  84),  INT8_C(  73),  INT8_C(  97), -INT8_C(   5), -INT8_C( 102),
+         INT8_C( 109),  INT8_C(  97), -INT8_C(  95),  INT8_C(  10), -INT8_C(  44),  INT8_C( 119), -INT8_C(  67),  INT8_C(  46),
+         INT8_C(  78),  INT8_C(   4),  INT8_C(   4), -INT8_C(  70),  INT8_C( 107),  INT8_C(  25),  INT8_C(  85),  INT8_C(  91) },
+      {  INT8_C(  96),  INT8_C(  96), -INT8_C( 116), -INT8_C(  53),  INT8_C(  10),  INT8_C( 104), -INT8_C(  44), -INT8_C(  13),
+         INT8_C(  10),  INT8_C( 120),  INT8_C(   2), -INT8_C(  84),  INT8_C(  73),  INT8_C(  97), -INT8_C(   5), -INT8_C( 102),
+         INT8_C( 109),  INT8_C(  97), -INT8_C(  95),  INT8_C(  10), -INT8_C(  44),  INT8_C( 119), -INT8_C(  67),  INT8_C(  46),
+         INT8_C(  78),  INT8_C(   4),  INT8_C(   4), -INT8_C(  70),  INT8_C( 107),  INT8_C(  25),  INT8_C(  85),  INT8_C(  91) } },
+    { UINT32_C( 796100646),
+      { -INT8_C(  74),  INT8_C( 123), -INT8_C(  77), -INT8_C(  80), -INT8_C(  47), -INT8_C(  34),  INT8_C(   1),  INT8_C(  79),
+        -INT8_C(  97), -INT8_C(   4), -INT8_C(  49),  INT8_C(  52),      INT8_MIN,  INT8_C( 109), -INT8_C( 109),  INT8_C(  92),
+        -INT8_C(   4),  INT8_C(  93),  INT8_C( 119), -INT8_C(  61),  INT8_C(  60), -INT8_C(  92), -INT8_C( 121), -INT8_C(  72),
+        -INT8_C( 105), -INT8_C(  66), -INT8_C(  57),  INT8_C(  98), -INT8_C(  10),  INT8_C(  51),  INT8_C(   1),  INT8_C(   7) },
+      {  INT8_C( 123), -INT8_C(  77), -INT8_C(  34),  INT8_C(  52),  INT8_C(  92), -INT8_C(   4),  INT8_C(  93),  INT8_C(  60),
+        -INT8_C(  92), -INT8_C( 121), -INT8_C( 105), -INT8_C(  66), -INT8_C(  57),  INT8_C(  98),  INT8_C(  51),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(1122298828),
+      {  INT8_C(  27),  INT8_C( 121), -INT8_C( 121), -INT8_C(  48),  INT8_C(  97),  INT8_C(   3), -INT8_C(  99),  INT8_C(  40),
+        -INT8_C(  50), -INT8_C( 125),  INT8_C(  56),  INT8_C( 120),  INT8_C( 104), -INT8_C(  66), -INT8_C(  15),  INT8_C(   0),
+        -INT8_C(   4), -INT8_C(  75), -INT8_C(  78),  INT8_C( 111),  INT8_C(  25), -INT8_C(  67),  INT8_C(  68), -INT8_C( 104),
+         INT8_C(  95),  INT8_C(   9),  INT8_C( 121),  INT8_C(  61), -INT8_C(  41), -INT8_C( 100),  INT8_C(  15), -INT8_C(  59) },
+      { -INT8_C( 121), -INT8_C(  48), -INT8_C(  99),  INT8_C(  40), -INT8_C(  50), -INT8_C( 125),  INT8_C( 120), -INT8_C(  66),
+        -INT8_C(  15),  INT8_C(   0), -INT8_C(  78), -INT8_C(  67),  INT8_C(  68), -INT8_C( 104),  INT8_C(   9),  INT8_C(  15),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(1510547691),
+      {  INT8_C( 106),  INT8_C(  58),  INT8_C(  46), -INT8_C(   6),  INT8_C(  67),  INT8_C( 125),  INT8_C(  29), -INT8_C(  27),
+         INT8_C(  48), -INT8_C(   6), -INT8_C(  85),  INT8_C(  20),  INT8_C(  36), -INT8_C( 104), -INT8_C(  15),  INT8_C(  86),
+         INT8_C(  68), -INT8_C(  14), -INT8_C(  37),  INT8_C( 118),      INT8_MIN,  INT8_C(  25),  INT8_C(  13), -INT8_C(  87),
+        -INT8_C(  48),  INT8_C(  79), -INT8_C(   7), -INT8_C( 126),  INT8_C(  27), -INT8_C(  23), -INT8_C( 104),  INT8_C(  25) },
+      {  INT8_C( 106),  INT8_C(  58), -INT8_C(   6),  INT8_C( 125),  INT8_C(  29), -INT8_C(  27), -INT8_C( 104),  INT8_C(  68),
+         INT8_C( 118),  INT8_C(  79), -INT8_C( 126),  INT8_C(  27), -INT8_C( 104),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(3450378411),
+      {  INT8_C(  90), -INT8_C(  36),  INT8_C(  37),  INT8_C(  99),  INT8_C(   3), -INT8_C(  95), -INT8_C( 124),  INT8_C(  55),
+         INT8_C(  75), -INT8_C( 101), -INT8_C(  46),  INT8_C( 115), -INT8_C(  61),  INT8_C( 124), -INT8_C(  66), -INT8_C( 111),
+        -INT8_C(  26), -INT8_C(  73),  INT8_C( 122), -INT8_C(  32), -INT8_C(  81), -INT8_C( 100), -INT8_C(   1), -INT8_C(  92),
+         INT8_C(  57), -INT8_C(   3),  INT8_C(  16), -INT8_C(  96),  INT8_C(  97), -INT8_C(  21),  INT8_C( 118), -INT8_C(  58) },
+      {  INT8_C(  90), -INT8_C(  36),  INT8_C(  99), -INT8_C(  95),  INT8_C(  55),  INT8_C( 115), -INT8_C(  61), -INT8_C( 111),
+        -INT8_C(  32), -INT8_C( 100), -INT8_C(  92),  INT8_C(  57),  INT8_C(  16), -INT8_C(  96),  INT8_C( 118), -INT8_C(  58),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(2519613605),
+      {  INT8_C( 100),  INT8_C(  78),  INT8_C( 108), -INT8_C(  26), -INT8_C(  19),  INT8_C(  10), -INT8_C(  46), -INT8_C( 101),
+         INT8_C(  10), -INT8_C(  88),  INT8_C( 117),  INT8_C(   9), -INT8_C(  71),  INT8_C(  72),  INT8_C( 108), -INT8_C( 114),
+        -INT8_C(  27), -INT8_C(  94), -INT8_C( 101), -INT8_C( 122), -INT8_C(  29), -INT8_C(  42), -INT8_C(  49),  INT8_C(  10),
+        -INT8_C( 122), -INT8_C(  87),  INT8_C(  10), -INT8_C( 106), -INT8_C( 125),  INT8_C(  50),  INT8_C(  80), -INT8_C(  74) },
+      {  INT8_C( 100),  INT8_C( 108),  INT8_C(  10), -INT8_C( 101),  INT8_C( 108), -INT8_C(  94), -INT8_C( 101), -INT8_C( 122),
+        -INT8_C(  42), -INT8_C(  87),  INT8_C(  10), -INT8_C( 125), -INT8_C(  74),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(1496838896),
+      {  INT8_C(  21),  INT8_C(  23),  INT8_C( 107), -INT8_C( 117), -INT8_C(  88),  INT8_C(  73), -INT8_C( 109), -INT8_C(  70),
+         INT8_C(  91),  INT8_C(  11), -INT8_C(  55), -INT8_C(  20),  INT8_C( 117),  INT8_C(  27), -INT8_C(  45), -INT8_C( 106),
+        -INT8_C( 105),  INT8_C(  34), -INT8_C(  74), -INT8_C(  55), -INT8_C(  26), -INT8_C(  25), -INT8_C(  80), -INT8_C( 125),
+        -INT8_C( 126),  INT8_C( 125), -INT8_C(  89),  INT8_C(  30),  INT8_C(  98), -INT8_C(  26),  INT8_C(  71),  INT8_C(  49) },
+      { -INT8_C(  88),  INT8_C(  73), -INT8_C( 109), -INT8_C(  70),  INT8_C(  11),  INT8_C( 117),  INT8_C(  27), -INT8_C(  45),
+        -INT8_C( 106), -INT8_C( 105),  INT8_C(  34), -INT8_C(  74), -INT8_C(  26), -INT8_C(  25), -INT8_C( 126),  INT8_C(  30),
+         INT8_C(  98),  INT8_C(  71),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_compress_epi8(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x32(r, simde_x_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_compress_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int16_t a[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    { UINT16_C(    0),
+      {  INT16_C(  4893), -INT16_C( 31935),  INT16_C( 13702),  INT16_C( 18239),  INT16_C( 25331), -INT16_C(  1938), -INT16_C( 26459),  INT16_C( 31541),
+         INT16_C( 16115),  INT16_C( 22492), -INT16_C(  7495), -INT16_C( 30389),  INT16_C(  8130),  INT16_C( 17123), -INT16_C( 21408), -INT16_C(  5423) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(65535),
+      { -INT16_C(   978),  INT16_C(  6813),  INT16_C( 26088),  INT16_C( 13979), -INT16_C( 32732),  INT16_C( 21769),  INT16_C( 24291), -INT16_C(  3648),
+        -INT16_C(   974), -INT16_C( 32435), -INT16_C( 12380), -INT16_C( 26188),  INT16_C( 32378), -INT16_C(  9218),  INT16_C(  9288),  INT16_C( 30728) },
+      { -INT16_C(   978),  INT16_C(  6813),  INT16_C( 26088),  INT16_C( 13979), -INT16_C( 32732),  INT16_C( 21769),  INT16_C( 24291), -INT16_C(  3648),
+        -INT16_C(   974), -INT16_C( 32435), -INT16_C( 12380), -INT16_C( 26188),  INT16_C( 32378), -INT16_C(  9218),  INT16_C(  9288),  INT16_C( 30728) } },
+    { UINT16_C(13738),
+      { -INT16_C( 16575),  INT16_C( 32650),  INT16_C( 15661),  INT16_C(  1187), -INT16_C( 21494), -INT16_C( 10393), -INT16_C( 17872),  INT16_C( 28825),
+         INT16_C( 25668), -INT16_C( 32268), -INT16_C(  7638), -INT16_C( 30961), -INT16_C( 12848),  INT16_C( 27640),  INT16_C( 24753), -INT16_C( 17010) },
+      {  INT16_C( 32650),  INT16_C(  1187), -INT16_C( 10393),  INT16_C( 28825),  INT16_C( 25668), -INT16_C(  7638), -INT16_C( 12848),  INT16_C( 27640),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(  350),
+      {  INT16_C( 28124),  INT16_C(  3827), -INT16_C( 21934),  INT16_C( 28397),  INT16_C( 16382), -INT16_C( 17047), -INT16_C(  4508), -INT16_C( 18279),
+        -INT16_C( 27437), -INT16_C(  1201), -INT16_C(  7074),  INT16_C(  6803), -INT16_C( 19538),  INT16_C( 10830),  INT16_C( 17954),  INT16_C( 30212) },
+      {  INT16_C(  3827), -INT16_C( 21934),  INT16_C( 28397),  INT16_C( 16382), -INT16_C(  4508), -INT16_C( 27437),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(46589),
+      { -INT16_C( 12842),  INT16_C(  8286),  INT16_C( 16460), -INT16_C(  4122), -INT16_C( 20044), -INT16_C( 17470), -INT16_C( 29604),  INT16_C( 14095),
+        -INT16_C( 23203),  INT16_C( 11782), -INT16_C( 30176),  INT16_C( 22893), -INT16_C(  9359), -INT16_C( 30728),  INT16_C( 32652),  INT16_C( 29499) },
+      { -INT16_C( 12842),  INT16_C( 16460), -INT16_C(  4122), -INT16_C( 20044), -INT16_C( 17470), -INT16_C( 29604),  INT16_C( 14095), -INT16_C( 23203),
+        -INT16_C( 30176), -INT16_C(  9359), -INT16_C( 30728),  INT16_C( 29499),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(32455),
+      {  INT16_C(  5626),  INT16_C( 20799), -INT16_C( 30997), -INT16_C( 31893), -INT16_C(  7656), -INT16_C( 10949),  INT16_C( 15778), -INT16_C(  7843),
+         INT16_C( 25480),  INT16_C( 18765), -INT16_C(  9991),  INT16_C( 11095), -INT16_C( 20649), -INT16_C( 20876),  INT16_C( 26451), -INT16_C(  4325) },
+      {  INT16_C(  5626),  INT16_C( 20799), -INT16_C( 30997),  INT16_C( 15778), -INT16_C(  7843),  INT16_C( 18765), -INT16_C(  9991),  INT16_C( 11095),
+        -INT16_C( 20649), -INT16_C( 20876),  INT16_C( 26451),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(34321),
+      {  INT16_C( 14173), -INT16_C( 18601),  INT16_C( 21398),  INT16_C( 17713), -INT16_C( 14549), -INT16_C( 23090),  INT16_C( 17806), -INT16_C( 19785),
+        -INT16_C(  8931),  INT16_C( 14910), -INT16_C( 11682), -INT16_C( 13969), -INT16_C( 11138), -INT16_C( 25279),  INT16_C(  6040), -INT16_C( 26467) },
+      {  INT16_C( 14173), -INT16_C( 14549),  INT16_C( 14910), -INT16_C( 11682), -INT16_C( 26467),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(39987),
+      { -INT16_C( 14133),  INT16_C( 24405),  INT16_C( 11455),  INT16_C(  3028), -INT16_C( 23697),  INT16_C(  8096), -INT16_C(  6323),  INT16_C( 30624),
+        -INT16_C( 21725), -INT16_C(  9104), -INT16_C(  7853), -INT16_C( 12708), -INT16_C( 10589),  INT16_C( 10563), -INT16_C(  6795), -INT16_C( 12362) },
+      { -INT16_C( 14133),  INT16_C( 24405), -INT16_C( 23697),  INT16_C(  8096), -INT16_C(  7853), -INT16_C( 12708), -INT16_C( 10589), -INT16_C( 12362),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_compress_epi16(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x16(r, simde_x_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_compress_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 k;
+    const int8_t a[64];
+    const int8_t r[64];
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      {  INT8_C( 126),  INT8_C(  24), -INT8_C(  58),  INT8_C(  51),  INT8_C(  41), -INT8_C(  81), -INT8_C(  34), -INT8_C(  29),
+        -INT8_C( 114),  INT8_C( 105), -INT8_C(  53),  INT8_C( 120), -INT8_C(  54),  INT8_C(  53),  INT8_C(  67), -INT8_C(  61),
+         INT8_C(  18), -INT8_C(  62),  INT8_C(  73), -INT8_C(  51), -INT8_C(  56),  INT8_C(  49),  INT8_C(   7), -INT8_C(  95),
+         INT8_C(   0),  INT8_C(  22), -INT8_C( 120),  INT8_C(  51),  INT8_C(  33), -INT8_C( 127), -INT8_C(   2), -INT8_C(  53),
+         INT8_C( 100), -INT8_C(  68), -INT8_C(  25),  INT8_C(   0),  INT8_C( 100),  INT8_C(  22),  INT8_C(  30), -INT8_C(  50),
+         INT8_C(  81), -INT8_C(  95), -INT8_C(  10), -INT8_C(  49), -INT8_C(  64),  INT8_C(  97),  INT8_C( 119), -INT8_C(  97),
+         INT8_C(  78), -INT8_C(  30), -INT8_C(  57),  INT8_C(  20), -INT8_C(  24), -INT8_C(  29),  INT8_C(  24), -INT8_C(  56),
+         INT8_C(  49),  INT8_C(   9), -INT8_C(  61),  INT8_C(  66), -INT8_C(  12), -INT8_C(  95), -INT8_C(  76), -INT8_C(  79) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C(18446744073709551615),
+      { -INT8_C(  94),  INT8_C(  87), -INT8_C(  67),  INT8_C( 110),  INT8_C(  40),  INT8_C(  48), -INT8_C( 102),  INT8_C(  85),
+        -INT8_C(  97), -INT8_C( 116), -INT8_C( 103),  INT8_C( 104),  INT8_C( 122),  INT8_C( 112), -INT8_C(  48), -INT8_C(  41),
+         INT8_C( 116),  INT8_C(  12),  INT8_C(  76), -INT8_C( 106), -INT8_C(  61),  INT8_C(  74), -INT8_C(  76), -INT8_C(   7),
+        -INT8_C(  30),  INT8_C( 123), -INT8_C(  21),  INT8_C(  40), -INT8_C( 108), -INT8_C(  43), -INT8_C(  84), -INT8_C(  41),
+        -INT8_C(  50),  INT8_C(  43),  INT8_C(  85), -INT8_C(  93),  INT8_C( 126),  INT8_C(  78), -INT8_C(  22), -INT8_C(  55),
+         INT8_C( 102), -INT8_C(  46), -INT8_C(  17),  INT8_C(  98),  INT8_C( 102), -INT8_C( 114),  INT8_C(  43), -INT8_C(  71),
+         INT8_C(   6), -INT8_C( 116),  INT8_C(  91),  INT8_C( 119),  INT8_C(  81),  INT8_C(  29), -INT8_C(  19),  INT8_C(  44),
+        -INT8_C(  56),  INT8_C( 123),  INT8_C( 127), -INT8_C(  75),  INT8_C(  10), -INT8_C(   4), -INT8_C(  25), -INT8_C(  56) },
+      { -INT8_C(  94),  INT8_C(  87), -INT8_C(  67),  INT8_C( 110),  INT8_C(  40),  INT8_C(  48), -INT8_C( 102),  INT8_C(  85),
+        -INT8_C(  97), -INT8_C( 116), -INT8_C( 103),  INT8_C( 104),  INT8_C( 122),  INT8_C( 112), -INT8_C(  48), -INT8_C(  41),
+         INT8_C( 116),  INT8_C(  12),  INT8_C(  76), -INT8_C( 106), -INT8_C(  61),  INT8_C(  74), -INT8_C(  76), -INT8_C(   7),
+        -INT8_C(  30),  INT8_C( 123), -INT8_C(  21),  INT8_C(  40), -INT8_C( 108), -INT8_C(  43), -INT8_C(  84), -INT8_C(  41),
+        -INT8_C(  50),  INT8_C(  43),  INT8_C(  85), -INT8_C(  93),  INT8_C( 126),  INT8_C(  78), -INT8_C(  22), -INT8_C(  55),
+         INT8_C( 102), -INT8_C(  46), -INT8_C(  17),  INT8_C(  98),  INT8_C( 102), -INT8_C( 114),  INT8_C(  43), -INT8_C(  71),
+         INT8_C(   6), -INT8_C( 116),  INT8_C(  91),  INT8_C( 119),  INT8_C(  81),  INT8_C(  29), -INT8_C(  19),  INT8_C(  44),
+        -INT8_C(  56),  INT8_C( 123),  INT8_C( 127), -INT8_C(  75),  INT8_C(  10), -INT8_C(   4), -INT8_C(  25), -INT8_C(  56) } },
+    { UINT64_C( 8468540978084493845),
+      {  INT8_C(  33),  INT8_C(  29),  INT8_C( 111), -INT8_C(   3), -INT8_C(  92), -INT8_C(  47), -INT8_C(  86),  INT8_C(   1),
+         INT8_C( 125),  INT8_C( 119),  INT8_C( 111),  INT8_C(  19),  INT8_C( 117), -INT8_C( 107),  INT8_C(  52),  INT8_C(  48),
+        -INT8_C(  38), -INT8_C(  13), -INT8_C( 102), -INT8_C( 121), -INT8_C( 110),  INT8_C( 127),  INT8_C(  23),  INT8_C(  67),
+        -INT8_C( 117),  INT8_C(  74), -INT8_C( 118),  INT8_C(  15),  INT8_C(  23),  INT8_C(  21),  INT8_C( 117), -INT8_C(  47),
+         INT8_C(  58), -INT8_C(  40), -INT8_C(  59),  INT8_C(  38), -INT8_C( 124),  INT8_C(  73), -INT8_C(  97), -INT8_C(  26),
+         INT8_C(  35),  INT8_C( 109),  INT8_C(  89), -INT8_C(  75),  INT8_C( 126), -INT8_C(  12),  INT8_C(  29),  INT8_C(  51),
+         INT8_C( 107),  INT8_C( 119), -INT8_C(  35),  INT8_C( 120),  INT8_C(  72), -INT8_C(  44), -INT8_C(  87),  INT8_C(  52),
+         INT8_C(   6),  INT8_C( 122),  INT8_C(  10),  INT8_C(  46), -INT8_C(  36), -INT8_C(  47),  INT8_C(  48),  INT8_C(  58) },
+      {  INT8_C(  33),  INT8_C( 111), -INT8_C(  92),  INT8_C( 119),  INT8_C(  19),  INT8_C( 117), -INT8_C( 107),  INT8_C(  48),
+        -INT8_C( 110),  INT8_C(  67), -INT8_C( 118),  INT8_C(  15),  INT8_C(  23),  INT8_C(  21), -INT8_C(  47), -INT8_C(  40),
+        -INT8_C(  59),  INT8_C(  73),  INT8_C(  35),  INT8_C(  89), -INT8_C(  75),  INT8_C(  29),  INT8_C( 119), -INT8_C(  35),
+         INT8_C(  52),  INT8_C(   6),  INT8_C(  10), -INT8_C(  36), -INT8_C(  47),  INT8_C(  48),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C(10075718460086299740),
+      {  INT8_C(   4),  INT8_C(  90), -INT8_C(  66),  INT8_C(  45),  INT8_C(  33),  INT8_C(   7), -INT8_C(  11),  INT8_C(  46),
+         INT8_C(  80),  INT8_C(  96), -INT8_C(  40), -INT8_C(  67),  INT8_C( 106),  INT8_C(   2), -INT8_C(  56), -INT8_C(  65),
+         INT8_C(  94),  INT8_C(  38),  INT8_C(  36),  INT8_C(   8),  INT8_C(  40), -INT8_C(  18),  INT8_C(  29), -INT8_C(  39),
+        -INT8_C(  36), -INT8_C(  97), -INT8_C(  78), -INT8_C(  57),  INT8_C( 112), -INT8_C(  14),  INT8_C(  51), -INT8_C(  97),
+        -INT8_C(  82),  INT8_C(  51), -INT8_C( 121),  INT8_C(  86),  INT8_C(  64),  INT8_C(  54),  INT8_C(  14),  INT8_C(  16),
+         INT8_C( 100), -INT8_C( 116), -INT8_C(  55), -INT8_C( 104),  INT8_C(   1), -INT8_C(   9), -INT8_C(  80), -INT8_C(  97),
+        -INT8_C(  84), -INT8_C( 107), -INT8_C(  92),  INT8_C(  49),  INT8_C(  73), -INT8_C(  21),  INT8_C(  36),  INT8_C(  98),
+        -INT8_C(  36),  INT8_C(  17), -INT8_C(  63),  INT8_C(  30), -INT8_C(  78), -INT8_C(  79), -INT8_C(  44),  INT8_C(  93) },
+      { -INT8_C(  66),  INT8_C(  45),  INT8_C(  33), -INT8_C(  11), -INT8_C(  40), -INT8_C(  67),  INT8_C(   2),  INT8_C(  38),
+         INT8_C(   8),  INT8_C(  29), -INT8_C(  97), -INT8_C(  78),  INT8_C( 112),  INT8_C(  51),  INT8_C(  51), -INT8_C( 121),
+         INT8_C(  86),  INT8_C(  16), -INT8_C(  55), -INT8_C(   9), -INT8_C(  92),  INT8_C(  73),  INT8_C(  36),  INT8_C(  98),
+        -INT8_C(  36),  INT8_C(  17),  INT8_C(  30),  INT8_C(  93),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C(  470750262573499993),
+      {  INT8_C(  21),  INT8_C(  67),  INT8_C(  63), -INT8_C(  87),  INT8_C(  64),  INT8_C(  82), -INT8_C(  44),  INT8_C( 119),
+         INT8_C(  33),  INT8_C(  43), -INT8_C(  87),  INT8_C(  22), -INT8_C(  78),  INT8_C(  77), -INT8_C( 113), -INT8_C(  96),
+         INT8_C(   1), -INT8_C( 127),  INT8_C(  12),  INT8_C(  98), -INT8_C( 124), -INT8_C(  97), -INT8_C(  30),  INT8_C(  85),
+         INT8_C(  55), -INT8_C( 121),  INT8_C(  74), -INT8_C(  44), -INT8_C(  45),  INT8_C(  72), -INT8_C(  98),  INT8_C(   1),
+         INT8_C( 103), -INT8_C(  83),  INT8_C(  36),  INT8_C(  10), -INT8_C(  18),  INT8_C(  25),  INT8_C(  65), -INT8_C(   3),
+         INT8_C( 114), -INT8_C(  36),  INT8_C( 119), -INT8_C(  33), -INT8_C(   6),  INT8_C(  19), -INT8_C(  91),  INT8_C(  42),
+        -INT8_C( 122),  INT8_C(  91),  INT8_C(  17),  INT8_C( 107),  INT8_C(  57),  INT8_C(  97), -INT8_C(  65), -INT8_C(  56),
+        -INT8_C(  27), -INT8_C(  30),  INT8_C(  11),  INT8_C(   9), -INT8_C(  33), -INT8_C( 104), -INT8_C(  39),  INT8_C(   0) },
+      {  INT8_C(  21), -INT8_C(  87),  INT8_C(  64), -INT8_C(  44),  INT8_C(  43), -INT8_C(  87), -INT8_C(  96),  INT8_C(   1),
+         INT8_C(  12),  INT8_C(  98), -INT8_C( 124),  INT8_C(  85), -INT8_C( 121),  INT8_C(  72),  INT8_C(   1), -INT8_C(  83),
+         INT8_C(  36),  INT8_C(  10), -INT8_C(  18),  INT8_C(  65), -INT8_C(   3), -INT8_C(   6),  INT8_C(  19), -INT8_C(  91),
+         INT8_C( 107), -INT8_C(  56), -INT8_C(  30),  INT8_C(  11),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C( 1416448648818694655),
+      {  INT8_C(  12), -INT8_C(  82),  INT8_C( 121),  INT8_C(  65),  INT8_C(  47), -INT8_C( 127),  INT8_C(  12), -INT8_C( 120),
+         INT8_C(  97), -INT8_C( 117),  INT8_C(   8),  INT8_C(  58), -INT8_C(  92), -INT8_C(  81),  INT8_C(  78),  INT8_C(   4),
+        -INT8_C(  14),  INT8_C(  17),  INT8_C(  27),  INT8_C(  21),  INT8_C(  77), -INT8_C(  23), -INT8_C( 112),  INT8_C(  27),
+         INT8_C(  17),  INT8_C(  63), -INT8_C(  33), -INT8_C(  94),  INT8_C(  45),  INT8_C( 105), -INT8_C( 107),  INT8_C(  12),
+         INT8_C(  74), -INT8_C(  72), -INT8_C(  79), -INT8_C(  80),  INT8_C(  43),  INT8_C(  11),  INT8_C(  73),  INT8_C( 117),
+        -INT8_C(  69), -INT8_C( 122),  INT8_C(  67),  INT8_C( 111),  INT8_C(  63),  INT8_C(  31),  INT8_C(  13), -INT8_C(   5),
+        -INT8_C(  40), -INT8_C(  37), -INT8_C( 118), -INT8_C(  21), -INT8_C(  30), -INT8_C(  13),  INT8_C( 116), -INT8_C(  52),
+         INT8_C(  55),  INT8_C(  65),  INT8_C( 125),  INT8_C(  63), -INT8_C(  17), -INT8_C(  36), -INT8_C(  53),  INT8_C(   6) },
+      {  INT8_C(  12), -INT8_C(  82),  INT8_C( 121),  INT8_C(  65),  INT8_C(  47), -INT8_C( 127),  INT8_C(  12), -INT8_C( 120),
+         INT8_C(  97),  INT8_C(  58), -INT8_C(  92),  INT8_C(   4), -INT8_C(  14),  INT8_C(  17),  INT8_C(  21), -INT8_C(  23),
+        -INT8_C( 112),  INT8_C(  17),  INT8_C(  63), -INT8_C(  94),  INT8_C(  45),  INT8_C(  12), -INT8_C(  72), -INT8_C(  80),
+         INT8_C( 117),  INT8_C(  67),  INT8_C( 111),  INT8_C(  63),  INT8_C(  31), -INT8_C(  21), -INT8_C(  13), -INT8_C(  52),
+         INT8_C(  55),  INT8_C(  65), -INT8_C(  17),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C(15051109384895716671),
+      {  INT8_C(  69), -INT8_C(  25),  INT8_C(  24), -INT8_C( 124), -INT8_C(  77), -INT8_C(  52), -INT8_C(  21), -INT8_C( 114),
+        -INT8_C(  13), -INT8_C(  66),  INT8_C(  27), -INT8_C( 123),  INT8_C(  26),  INT8_C(   6),  INT8_C(  76), -INT8_C(  52),
+        -INT8_C(  97), -INT8_C(  46), -INT8_C(  79),  INT8_C(  48),  INT8_C( 122),  INT8_C(  28),  INT8_C(  74),  INT8_C( 110),
+         INT8_C( 108),  INT8_C( 112),  INT8_C(  88), -INT8_C(   6),  INT8_C(  75),  INT8_C(  13), -INT8_C(  27), -INT8_C(  14),
+        -INT8_C(  91),  INT8_C( 122), -INT8_C(  20),  INT8_C(  87),  INT8_C(  69), -INT8_C(  43),  INT8_C(  64),  INT8_C(  10),
+         INT8_C(  42), -INT8_C(  82),  INT8_C(  95),  INT8_C(  73),  INT8_C( 125), -INT8_C(  31),  INT8_C(  84), -INT8_C(  22),
+        -INT8_C( 123),  INT8_C( 116),  INT8_C(  30),  INT8_C( 106),  INT8_C( 124),  INT8_C(  40), -INT8_C(  58), -INT8_C(  23),
+        -INT8_C(   6),  INT8_C(  29), -INT8_C(  17), -INT8_C( 118),  INT8_C(  69), -INT8_C(   3),  INT8_C(  10),  INT8_C(  90) },
+      {  INT8_C(  69), -INT8_C(  25),  INT8_C(  24), -INT8_C( 124), -INT8_C(  77), -INT8_C(  52), -INT8_C(  13),  INT8_C(  27),
+        -INT8_C( 123),  INT8_C(  26),  INT8_C(  76), -INT8_C(  52), -INT8_C(  97),  INT8_C(  74),  INT8_C( 112), -INT8_C(   6),
+        -INT8_C(  27), -INT8_C(  14), -INT8_C(  91), -INT8_C(  20),  INT8_C(  87),  INT8_C(  69), -INT8_C(  43),  INT8_C(  73),
+         INT8_C(  84),  INT8_C(  40), -INT8_C(  58), -INT8_C(  23),  INT8_C(  69),  INT8_C(  10),  INT8_C(  90),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C( 9538174164622832409),
+      { -INT8_C(  65), -INT8_C(  50),  INT8_C(  61), -INT8_C(  41),  INT8_C( 104), -INT8_C(  12),  INT8_C(  37),  INT8_C(  55),
+         INT8_C(  35), -INT8_C(  35),  INT8_C( 114),  INT8_C(  40),  INT8_C(  54),  INT8_C( 112), -INT8_C(  40), -INT8_C( 115),
+         INT8_C(  20),  INT8_C(  26), -INT8_C(  50),  INT8_C(  25), -INT8_C( 125), -INT8_C(  94),  INT8_C(  83),  INT8_C(   3),
+         INT8_C( 121), -INT8_C( 123),  INT8_C(  28),  INT8_C(  18), -INT8_C(  24),  INT8_C(  79),  INT8_C(  31),  INT8_C(   7),
+        -INT8_C(  67),  INT8_C(  82), -INT8_C(  54),  INT8_C(  37),  INT8_C(  55), -INT8_C(  45),  INT8_C(  30),  INT8_C(  62),
+         INT8_C( 114),  INT8_C(  78),  INT8_C( 106), -INT8_C( 100), -INT8_C(  81),  INT8_C(  70), -INT8_C(  86), -INT8_C( 103),
+        -INT8_C( 100),  INT8_C(  65), -INT8_C(  61),  INT8_C(  14),  INT8_C( 118), -INT8_C(  34),  INT8_C( 101), -INT8_C(  77),
+         INT8_C(  76),  INT8_C(  14),  INT8_C(  56), -INT8_C(  46),  INT8_C(   7),  INT8_C(  45), -INT8_C(  31), -INT8_C(  38) },
+      { -INT8_C(  65), -INT8_C(  41),  INT8_C( 104),  INT8_C(  35), -INT8_C(  35),  INT8_C(  54),  INT8_C( 112), -INT8_C(  40),
+        -INT8_C( 115),  INT8_C(  26), -INT8_C(  50), -INT8_C(  94),  INT8_C(  18),  INT8_C(  82), -INT8_C(  54),  INT8_C(  37),
+         INT8_C(  55),  INT8_C(  30),  INT8_C(  62),  INT8_C(  78),  INT8_C( 106),  INT8_C(  70), -INT8_C(  86),  INT8_C(  65),
+        -INT8_C(  61),  INT8_C(  14),  INT8_C( 118),  INT8_C( 101),  INT8_C(  56), -INT8_C(  38),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_compress_epi8(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_compress_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 k;
+    const int16_t a[32];
+    const int16_t r[32];
+  } test_vec[] = {
+    { UINT32_C(         0),
+      {  INT16_C( 23446),  INT16_C( 28471), -INT16_C(  5391),  INT16_C( 18735), -INT16_C( 21293),  INT16_C(  1823), -INT16_C( 16071), -INT16_C( 23590),
+        -INT16_C( 26100), -INT16_C(  5793),  INT16_C(  3648), -INT16_C( 18314), -INT16_C(  2261), -INT16_C(  6024),  INT16_C( 22707),  INT16_C(  6608),
+         INT16_C( 12423),  INT16_C( 32152),  INT16_C( 14053), -INT16_C(   900), -INT16_C( 26471), -INT16_C( 29417),  INT16_C(  9838),  INT16_C( 23546),
+        -INT16_C( 13445),  INT16_C( 28756),  INT16_C(  9292),  INT16_C(  8146), -INT16_C(  6831),  INT16_C(  6246),  INT16_C( 17872), -INT16_C(   161) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(4294967295),
+      {  INT16_C(  2534), -INT16_C( 26971), -INT16_C(  1901), -INT16_C( 23837), -INT16_C( 13069), -INT16_C( 29341),  INT16_C( 32262),  INT16_C(  5114),
+        -INT16_C(  8845),  INT16_C( 16978),  INT16_C( 20924), -INT16_C( 30551), -INT16_C(   229),  INT16_C( 22086), -INT16_C( 11824),  INT16_C( 26160),
+         INT16_C( 30778),  INT16_C( 12734),  INT16_C( 27843),  INT16_C(  9264), -INT16_C( 30806), -INT16_C( 20034), -INT16_C( 31188),  INT16_C( 25841),
+        -INT16_C(  2658), -INT16_C( 11846),  INT16_C( 30110), -INT16_C( 32087),  INT16_C( 20289), -INT16_C(  9075),  INT16_C(  1845),  INT16_C( 26359) },
+      {  INT16_C(  2534), -INT16_C( 26971), -INT16_C(  1901), -INT16_C( 23837), -INT16_C( 13069), -INT16_C( 29341),  INT16_C( 32262),  INT16_C(  5114),
+        -INT16_C(  8845),  INT16_C( 16978),  INT16_C( 20924), -INT16_C( 30551), -INT16_C(   229),  INT16_C( 22086), -INT16_C( 11824),  INT16_C( 26160),
+         INT16_C( 30778),  INT16_C( 12734),  INT16_C( 27843),  INT16_C(  9264), -INT16_C( 30806), -INT16_C( 20034), -INT16_C( 31188),  INT16_C( 25841),
+        -INT16_C(  2658), -INT16_C( 11846),  INT16_C( 30110), -INT16_C( 32087),  INT16_C( 20289), -INT16_C(  9075),  INT16_C(  1845),  INT16_C( 26359) } },
+    { UINT32_C( 913723776),
+      {  INT16_C( 22819), -INT16_C(   751),  INT16_C(    30),  INT16_C( 30206), -INT16_C(  9969), -INT16_C( 27696),  INT16_C( 19894), -INT16_C(  4877),
+        -INT16_C(  3927), -INT16_C( 24377),  INT16_C(  1349),  INT16_C( 30885),  INT16_C( 16396), -INT16_C(  7044),  INT16_C( 20807),  INT16_C( 17539),
+         INT16_C(  4608), -INT16_C( 17858), -INT16_C( 13177), -INT16_C( 28963),  INT16_C(  2389), -INT16_C(  4905), -INT16_C( 20807), -INT16_C(  4419),
+         INT16_C( 26375),  INT16_C( 32581), -INT16_C( 12063), -INT16_C( 19807),  INT16_C(  3851), -INT16_C( 21317),  INT16_C( 17731),  INT16_C( 27495) },
+      { -INT16_C(  4877), -INT16_C(  3927),  INT16_C( 16396),  INT16_C( 20807), -INT16_C( 17858), -INT16_C( 13177),  INT16_C(  2389), -INT16_C(  4905),
+        -INT16_C( 20807),  INT16_C( 32581), -INT16_C( 12063),  INT16_C(  3851), -INT16_C( 21317),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(3388663129),
+      { -INT16_C(  8493),  INT16_C( 17743), -INT16_C( 28335),  INT16_C(  5022), -INT16_C( 22247), -INT16_C(  3126), -INT16_C( 12676), -INT16_C( 21363),
+         INT16_C(  3931),  INT16_C( 31449), -INT16_C(  8290),  INT16_C(  2974), -INT16_C( 12063),  INT16_C( 12465), -INT16_C( 20922),  INT16_C( 31973),
+        -INT16_C( 27720),  INT16_C(  9108), -INT16_C( 10503),  INT16_C(  2763), -INT16_C( 28784),  INT16_C( 29774),  INT16_C( 16294),  INT16_C( 11109),
+        -INT16_C( 15031), -INT16_C(  3620),  INT16_C(  2474), -INT16_C( 15541), -INT16_C(  3166),  INT16_C(  4580),  INT16_C( 16595),  INT16_C( 14320) },
+      { -INT16_C(  8493),  INT16_C(  5022), -INT16_C( 22247), -INT16_C( 12676),  INT16_C(  3931), -INT16_C(  8290),  INT16_C( 12465), -INT16_C( 20922),
+         INT16_C( 31973),  INT16_C(  9108),  INT16_C(  2763), -INT16_C( 28784),  INT16_C( 29774),  INT16_C( 16294),  INT16_C( 11109), -INT16_C( 15031),
+        -INT16_C( 15541),  INT16_C( 16595),  INT16_C( 14320),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(1741958629),
+      { -INT16_C( 14338), -INT16_C( 17408),  INT16_C( 26757), -INT16_C( 24454),  INT16_C( 10481),  INT16_C(  9102), -INT16_C( 12951), -INT16_C( 17856),
+        -INT16_C(  9377),  INT16_C( 27168), -INT16_C( 31164), -INT16_C( 25751),  INT16_C( 10728),  INT16_C( 21161),  INT16_C(  5698), -INT16_C( 31114),
+         INT16_C(  9949),  INT16_C( 14320),  INT16_C( 14657), -INT16_C(  7875), -INT16_C(  6618), -INT16_C( 27919),  INT16_C(  2873), -INT16_C( 16697),
+        -INT16_C( 28989),  INT16_C( 27443),  INT16_C( 31943),  INT16_C( 28610),  INT16_C(  9019), -INT16_C( 12111),  INT16_C(  9403),  INT16_C( 10266) },
+      { -INT16_C( 14338),  INT16_C( 26757),  INT16_C(  9102), -INT16_C( 12951), -INT16_C( 17856), -INT16_C(  9377), -INT16_C( 31164), -INT16_C( 25751),
+         INT16_C( 21161),  INT16_C( 14657), -INT16_C(  6618),  INT16_C(  2873), -INT16_C( 16697), -INT16_C( 28989),  INT16_C( 27443),  INT16_C( 31943),
+        -INT16_C( 12111),  INT16_C(  9403),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(3904051311),
+      {  INT16_C( 21663),  INT16_C(  1550), -INT16_C( 12322),  INT16_C( 10228),  INT16_C(  6325), -INT16_C(  7274),  INT16_C( 28758),  INT16_C( 12220),
+        -INT16_C( 28433), -INT16_C(  8019), -INT16_C(  2179), -INT16_C( 12870), -INT16_C( 10718), -INT16_C( 15689),  INT16_C( 31529),  INT16_C(   337),
+         INT16_C( 11599), -INT16_C(  9487), -INT16_C(  9993), -INT16_C( 10479),  INT16_C(   924), -INT16_C(  8509),  INT16_C( 29427),  INT16_C( 12296),
+        -INT16_C( 21392), -INT16_C( 12963),  INT16_C( 21032), -INT16_C( 24066), -INT16_C( 12216), -INT16_C( 17617),  INT16_C(  3192), -INT16_C(  8600) },
+      {  INT16_C( 21663),  INT16_C(  1550), -INT16_C( 12322),  INT16_C( 10228), -INT16_C(  7274),  INT16_C( 28758), -INT16_C( 12870), -INT16_C( 10718),
+         INT16_C( 11599), -INT16_C(  9487),  INT16_C(   924), -INT16_C(  8509),  INT16_C( 12296), -INT16_C( 24066), -INT16_C( 17617),  INT16_C(  3192),
+        -INT16_C(  8600),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(1164967786),
+      {  INT16_C( 24596), -INT16_C( 28576),  INT16_C( 19713),  INT16_C(  6949),  INT16_C(  8835),  INT16_C( 16948),  INT16_C( 20592), -INT16_C( 16776),
+         INT16_C( 30421), -INT16_C(  9674),  INT16_C( 32387),  INT16_C( 21570), -INT16_C(  3520),  INT16_C(  3891), -INT16_C(  7385), -INT16_C( 25196),
+        -INT16_C( 17006), -INT16_C( 22648), -INT16_C( 30612), -INT16_C(  5377),  INT16_C(  2771),  INT16_C( 12890), -INT16_C( 17430), -INT16_C( 15308),
+        -INT16_C( 18147),  INT16_C( 26716),  INT16_C(  3976),  INT16_C(  2261),  INT16_C(  9842),  INT16_C(  7660),  INT16_C( 28019),  INT16_C(  6435) },
+      { -INT16_C( 28576),  INT16_C(  6949),  INT16_C( 16948),  INT16_C( 20592),  INT16_C( 30421), -INT16_C(  9674),  INT16_C( 32387),  INT16_C( 21570),
+        -INT16_C(  3520),  INT16_C(  3891), -INT16_C(  7385), -INT16_C( 25196), -INT16_C( 17006), -INT16_C( 22648), -INT16_C( 30612), -INT16_C(  5377),
+         INT16_C( 12890), -INT16_C( 17430), -INT16_C( 18147),  INT16_C(  3976),  INT16_C( 28019),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(4188905862),
+      { -INT16_C( 19643), -INT16_C( 18922), -INT16_C(   759), -INT16_C( 19060),  INT16_C( 17830),  INT16_C(  2805), -INT16_C( 31206), -INT16_C( 27301),
+        -INT16_C( 13212),  INT16_C(  6963),  INT16_C( 15723), -INT16_C( 18679), -INT16_C( 26066),  INT16_C( 21661),  INT16_C( 22444), -INT16_C( 28929),
+        -INT16_C( 29045), -INT16_C( 18137),  INT16_C( 27256),  INT16_C( 10738), -INT16_C( 24797), -INT16_C(  6026), -INT16_C( 12105), -INT16_C(  5819),
+         INT16_C( 20918),  INT16_C(  4961), -INT16_C( 12961), -INT16_C(   586),  INT16_C( 23108),  INT16_C( 15462),  INT16_C( 23506),  INT16_C( 29521) },
+      { -INT16_C( 18922), -INT16_C(   759), -INT16_C( 27301), -INT16_C( 13212),  INT16_C( 21661), -INT16_C( 28929), -INT16_C( 29045),  INT16_C( 27256),
+         INT16_C( 10738), -INT16_C(  6026), -INT16_C(  5819),  INT16_C( 20918), -INT16_C(   586),  INT16_C( 23108),  INT16_C( 15462),  INT16_C( 23506),
+         INT16_C( 29521),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_compress_epi16(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x32(r, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_compress_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[16];
+    const simde__mmask16 k;
+    const int8_t a[16];
+    const int8_t r[16];
+  } test_vec[] = {
+    { {  INT8_C(  42),  INT8_C(  66), -INT8_C(  50),  INT8_C(  27),  INT8_C(  21),  INT8_C( 115),  INT8_C( 121), -INT8_C(  11),
+        -INT8_C(  48), -INT8_C(  33),  INT8_C(  14),  INT8_C(  62),  INT8_C(  40),  INT8_C(  24), -INT8_C( 108),  INT8_C( 101) },
+      UINT16_C(    0),
+      {  INT8_C(  68),  INT8_C( 126),  INT8_C(  88),  INT8_C(  50), -INT8_C(  78), -INT8_C(  83), -INT8_C( 102), -INT8_C( 103),
+             INT8_MIN, -INT8_C(   9),  INT8_C( 100),  INT8_C(  58), -INT8_C(  94), -INT8_C(  89),  INT8_C(  92),  INT8_C(  98) },
+      {  INT8_C(  42),  INT8_C(  66), -INT8_C(  50),  INT8_C(  27),  INT8_C(  21),  INT8_C( 115),  INT8_C( 121), -INT8_C(  11),
+        -INT8_C(  48), -INT8_C(  33),  INT8_C(  14),  INT8_C(  62),  INT8_C(  40),  INT8_C(  24), -INT8_C( 108),  INT8_C( 101) } },
+    { {  INT8_C(  35),  INT8_C(  73), -INT8_C(  43), -INT8_C(  98),  INT8_C(  83), -INT8_C( 119),  INT8_C( 120),  INT8_C(  32),
+         INT8_C(  24), -INT8_C(  64), -INT8_C( 109), -INT8_C(  44),  INT8_C(  55),  INT8_C( 103),  INT8_C(  97),  INT8_C(   3) },
+      UINT16_C(65535),
+      { -INT8_C(  14), -INT8_C( 121), -INT8_C(  34),  INT8_C(  11),  INT8_C(  39),  INT8_C(  63),  INT8_C(  37),  INT8_C(  35),
+         INT8_C(  19),  INT8_C(   9), -INT8_C(  85),  INT8_C(  94), -INT8_C(  92),  INT8_C(  41),  INT8_C( 125),  INT8_C(  93) },
+      { -INT8_C(  14), -INT8_C( 121), -INT8_C(  34),  INT8_C(  11),  INT8_C(  39),  INT8_C(  63),  INT8_C(  37),  INT8_C(  35),
+         INT8_C(  19),  INT8_C(   9), -INT8_C(  85),  INT8_C(  94), -INT8_C(  92),  INT8_C(  41),  INT8_C( 125),  INT8_C(  93) } },
+    { { -INT8_C(   6), -INT8_C( 121), -INT8_C(  26), -INT8_C(  11),  INT8_C(  22),  INT8_C(  40),  INT8_C(  74), -INT8_C(  94),
+         INT8_C(  87), -INT8_C( 119),  INT8_C(  70), -INT8_C(  94), -INT8_C(  93),  INT8_C( 102), -INT8_C(  22),  INT8_C( 117) },
+      UINT16_C(57656),
+      {  INT8_C(  17),  INT8_C( 127),  INT8_C(  31),  INT8_C(   3),  INT8_C( 125), -INT8_C(  23),  INT8_C(  26), -INT8_C(   6),
+         INT8_C( 125),  INT8_C(  67),  INT8_C(  87), -INT8_C(   3),  INT8_C(  56), -INT8_C( 126), -INT8_C(  81), -INT8_C(  84) },
+      {  INT8_C(   3),  INT8_C( 125), -INT8_C(  23),  INT8_C( 125), -INT8_C( 126), -INT8_C(  81), -INT8_C(  84), -INT8_C(  94),
+         INT8_C(  87), -INT8_C( 119),  INT8_C(  70), -INT8_C(  94), -INT8_C(  93),  INT8_C( 102), -INT8_C(  22),  INT8_C( 117) } },
+    { { -INT8_C( 121),  INT8_C(  34),  INT8_C( 122), -INT8_C(  48), -INT8_C(  53),  INT8_C( 116), -INT8_C(  92),  INT8_C(  43),
+        -INT8_C(  23), -INT8_C(  18),  INT8_C(   3),  INT8_C(  71), -INT8_C( 107), -INT8_C(  40), -INT8_C(  37),  INT8_C(  96) },
+      UINT16_C(55478),
+      {  INT8_C(  86),  INT8_C(  14),  INT8_C(  10),  INT8_C(  94), -INT8_C(  62),  INT8_C(  31),  INT8_C(  17),  INT8_C(  39),
+        -INT8_C(  65), -INT8_C( 112),  INT8_C(  19),  INT8_C(   9),  INT8_C(  73), -INT8_C( 119),  INT8_C( 108),  INT8_C(  12) },
+      {  INT8_C(  14),  INT8_C(  10), -INT8_C(  62),  INT8_C(  31),  INT8_C(  39),  INT8_C(   9),  INT8_C(  73),  INT8_C( 108),
+         INT8_C(  12), -INT8_C(  18),  INT8_C(   3),  INT8_C(  71), -INT8_C( 107), -INT8_C(  40), -INT8_C(  37),  INT8_C(  96) } },
+    { { -INT8_C(  96), -INT8_C(  67),  INT8_C( 104), -INT8_C(  20), -INT8_C(  77), -INT8_C(  66),  INT8_C(  75),  INT8_C(  47),
+         INT8_C( 125), -INT8_C(  97),  INT8_C(  96), -INT8_C(  68), -INT8_C( 125), -INT8_C( 108), -INT8_C(  97), -INT8_C(  16) },
+      UINT16_C(54796),
+      { -INT8_C(  57),  INT8_C( 120),  INT8_C(  14),  INT8_C(  68),  INT8_C(  94),  INT8_C(  52),  INT8_C(  68),  INT8_C(  52),
+        -INT8_C(  64), -INT8_C( 111), -INT8_C(  60), -INT8_C(  29),  INT8_C(  54), -INT8_C( 112),  INT8_C(  41),  INT8_C(  19) },
+      {  INT8_C(  14),  INT8_C(  68), -INT8_C( 111), -INT8_C(  60),  INT8_C(  54),  INT8_C(  41),  INT8_C(  19),  INT8_C(  47),
+         INT8_C( 125), -INT8_C(  97),  INT8_C(  96), -INT8_C(  68), -INT8_C( 125), -INT8_C( 108), -INT8_C(  97), -INT8_C(  16) } },
+    { { -INT8_C(  71), -INT8_C(  60),  INT8_C(  71),  INT8_C(  59), -INT8_C(  31),  INT8_C( 110), -INT8_C( 116),  INT8_C(  97),
+        -INT8_C(   3),  INT8_C(  64),  INT8_C(  96),  INT8_C( 104),  INT8_C(  86), -INT8_C(  70), -INT8_C( 107), -INT8_C(  84) },
+      UINT16_C(53853),
+      { -INT8_C(  92), -INT8_C( 117),  INT8_C(  34),  INT8_C(  84), -INT8_C( 118),  INT8_C(  63), -INT8_C(   7),  INT8_C(  24),
+         INT8_C(  90), -INT8_C(  24), -INT8_C( 121),  INT8_C( 102),  INT8_C( 108),  INT8_C(  80), -INT8_C(  92), -INT8_C( 117) },
+      { -INT8_C(  92),  INT8_C(  34),  INT8_C(  84), -INT8_C( 118), -INT8_C(   7), -INT8_C(  24),  INT8_C( 108), -INT8_C(  92),
+        -INT8_C( 117),  INT8_C(  64),  INT8_C(  96),  INT8_C( 104),  INT8_C(  86), -INT8_C(  70), -INT8_C( 107), -INT8_C(  84) } },
+    { {  INT8_C(  92), -INT8_C(  98), -INT8_C(  65),  INT8_C( 106), -INT8_C(  46),  INT8_C(  77), -INT8_C(  27),  INT8_C(   8),
+        -INT8_C(  82), -INT8_C(  35),  INT8_C( 100),  INT8_C(  78),  INT8_C(  60), -INT8_C(  36),  INT8_C( 119), -INT8_C(  95) },
+      UINT16_C(14323),
+      {  INT8_C(  29),  INT8_C(  73),  INT8_C(  57),  INT8_C(   1),  INT8_C(  37),  INT8_C( 113), -INT8_C(  73),  INT8_C(  56),
+        -INT8_C( 114),  INT8_C(  81),  INT8_C( 119),  INT8_C(  91),  INT8_C( 101), -INT8_C( 111),  INT8_C( 102),  INT8_C( 104) },
+      {  INT8_C(  29),  INT8_C(  73),  INT8_C(  37),  INT8_C( 113), -INT8_C(  73),  INT8_C(  56), -INT8_C( 114),  INT8_C(  81),
+         INT8_C( 119),  INT8_C( 101), -INT8_C( 111),  INT8_C(  78),  INT8_C(  60), -INT8_C(  36),  INT8_C( 119), -INT8_C(  95) } },
+    { {  INT8_C(  29), -INT8_C(  51),  INT8_C(  54),  INT8_C(  38), -INT8_C(  38),  INT8_C(  11),  INT8_C(  31),  INT8_C(  59),
+         INT8_C(   9), -INT8_C(  99),  INT8_C(  10),  INT8_C(   8), -INT8_C(  28),  INT8_C(  71),  INT8_C(  53),  INT8_C(  29) },
+      UINT16_C(  601),
+      { -INT8_C(  10),  INT8_C(  31), -INT8_C(  83),  INT8_C(  58), -INT8_C(  60),  INT8_C(  79),  INT8_C(  19),  INT8_C( 115),
+        -INT8_C(   3),  INT8_C(  30),  INT8_C(  16), -INT8_C( 106),  INT8_C(  85),  INT8_C(  67), -INT8_C(  63), -INT8_C( 106) },
+      { -INT8_C(  10),  INT8_C(  58), -INT8_C(  60),  INT8_C(  19),  INT8_C(  30),  INT8_C(  11),  INT8_C(  31),  INT8_C(  59),
+         INT8_C(   9), -INT8_C(  99),  INT8_C(  10),  INT8_C(   8), -INT8_C(  28),  INT8_C(  71),  INT8_C(  53),  INT8_C(  29) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi8(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_compress_epi8(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_compress_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[8];
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t r[8];
+  } test_vec[] = {
+    { { -INT16_C( 28867), -INT16_C( 31692), -INT16_C( 30367), -INT16_C( 30248),  INT16_C( 11386), -INT16_C( 28250), -INT16_C(  8266), -INT16_C(  5044) },
+      UINT8_C(  0),
+      {  INT16_C( 32489),  INT16_C(  7586),  INT16_C( 28987), -INT16_C( 28449),  INT16_C( 29973),  INT16_C( 13051),  INT16_C( 19426),  INT16_C( 10993) },
+      { -INT16_C( 28867), -INT16_C( 31692), -INT16_C( 30367), -INT16_C( 30248),  INT16_C( 11386), -INT16_C( 28250), -INT16_C(  8266), -INT16_C(  5044) } },
+    { {  INT16_C(  4480),  INT16_C(  8505), -INT16_C( 29945),  INT16_C( 16274), -INT16_C( 14019),  INT16_C( 13360),  INT16_C( 23608),  INT16_C(   930) },
+      UINT8_C(255),
+      { -INT16_C( 12874), -INT16_C( 12348), -INT16_C(  8628),  INT16_C(  8995),  INT16_C( 12147),  INT16_C( 32117), -INT16_C( 30469),  INT16_C( 15501) },
+      { -INT16_C( 12874), -INT16_C( 12348), -INT16_C(  8628),  INT16_C(  8995),  INT16_C( 12147),  INT16_C( 32117), -INT16_C( 30469),  INT16_C( 15501) } },
+    { { -INT16_C( 12162),  INT16_C( 10397), -INT16_C( 23010), -INT16_C(   189),  INT16_C( 20598), -INT16_C( 30804),  INT16_C( 32704),  INT16_C( 16763) },
+      UINT8_C(104),
+      {  INT16_C( 10630), -INT16_C( 27787),  INT16_C( 12240), -INT16_C( 31051), -INT16_C(  6363),  INT16_C( 12868), -INT16_C( 23970),  INT16_C( 21231) },
+      { -INT16_C( 31051),  INT16_C( 12868), -INT16_C( 23970), -INT16_C(   189),  INT16_C( 20598), -INT16_C( 30804),  INT16_C( 32704),  INT16_C( 16763) } },
+    { { -INT16_C( 10340), -INT16_C(  5112),  INT16_C( 31057), -INT16_C(  5341),  INT16_C( 16416), -INT16_C( 25060), -INT16_C( 14645),  INT16_C(  2799) },
+      UINT8_C( 44),
+      { -INT16_C(  4672), -INT16_C(  2458),  INT16_C( 19737),  INT16_C( 26479),  INT16_C( 20667),  INT16_C( 11362),  INT16_C( 29180),  INT16_C( 15009) },
+      {  INT16_C( 19737),  INT16_C( 26479),  INT16_C( 11362), -INT16_C(  5341),  INT16_C( 16416), -INT16_C( 25060), -INT16_C( 14645),  INT16_C(  2799) } },
+    { {  INT16_C( 29220), -INT16_C( 29262),  INT16_C( 28054),  INT16_C( 21773),  INT16_C( 21289), -INT16_C( 30981),  INT16_C( 18163),  INT16_C( 25530) },
+      UINT8_C(169),
+      {  INT16_C( 31328), -INT16_C( 14758), -INT16_C(  5871), -INT16_C( 12886),  INT16_C(  8650),  INT16_C(  1219),  INT16_C(  6568),  INT16_C( 12585) },
+      {  INT16_C( 31328), -INT16_C( 12886),  INT16_C(  1219),  INT16_C( 12585),  INT16_C( 21289), -INT16_C( 30981),  INT16_C( 18163),  INT16_C( 25530) } },
+    { { -INT16_C(  9077),  INT16_C( 13669),  INT16_C( 26441), -INT16_C(  7449),  INT16_C( 20659), -INT16_C( 13950), -INT16_C(  3704),  INT16_C(  8738) },
+      UINT8_C( 47),
+      {  INT16_C( 15752), -INT16_C( 27373),  INT16_C( 23550), -INT16_C( 13555),  INT16_C( 19534), -INT16_C( 12812),  INT16_C( 21398), -INT16_C( 20135) },
+      {  INT16_C( 15752), -INT16_C( 27373),  INT16_C( 23550), -INT16_C( 13555), -INT16_C( 12812), -INT16_C( 13950), -INT16_C(  3704),  INT16_C(  8738) } },
+    { {  INT16_C(  2745), -INT16_C( 31328), -INT16_C( 20974),  INT16_C( 20655),  INT16_C(  8090), -INT16_C( 14689), -INT16_C( 26453), -INT16_C( 10885) },
+      UINT8_C(  9),
+      {  INT16_C( 16354), -INT16_C( 18691),  INT16_C( 20097),  INT16_C(  5124), -INT16_C( 24120), -INT16_C( 25012),  INT16_C(  7029), -INT16_C(  7971) },
+      {  INT16_C( 16354),  INT16_C(  5124), -INT16_C( 20974),  INT16_C( 20655),  INT16_C(  8090), -INT16_C( 14689), -INT16_C( 26453), -INT16_C( 10885) } },
+    { { -INT16_C( 11093),  INT16_C(  7919), -INT16_C( 20072), -INT16_C( 11220), -INT16_C( 26781),  INT16_C(  2484), -INT16_C( 21129),  INT16_C( 31234) },
+      UINT8_C( 15),
+      { -INT16_C( 28875), -INT16_C( 11698),  INT16_C( 16693), -INT16_C( 22393),  INT16_C(  6881),  INT16_C(  9830),  INT16_C( 24052),  INT16_C( 27333) },
+      { -INT16_C( 28875), -INT16_C( 11698),  INT16_C( 16693), -INT16_C( 22393), -INT16_C( 26781),  INT16_C(  2484), -INT16_C( 21129),  INT16_C( 31234) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi16(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_compress_epi16(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_compress_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[32];
+    const simde__mmask32 k;
+    const int8_t a[32];
+    const int8_t r[32];
+  } test_vec[] = {
+    { {  INT8_C( 115),  INT8_C( 113),  INT8_C(  45),  INT8_C(  29),  INT8_C(  77), -INT8_C(  21), -INT8_C(  20), -INT8_C(  71),
+        -INT8_C( 114),  INT8_C( 109),  INT8_C(  29), -INT8_C(  23), -INT8_C(  36),  INT8_C(  93), -INT8_C(   1),  INT8_C(   0),
+         INT8_C(  40), -INT8_C( 124),  INT8_C(  99), -INT8_C( 109),  INT8_C( 126),  INT8_C(  90),  INT8_C(   0), -INT8_C(  72),
+        -INT8_C(  15), -INT8_C( 108),  INT8_C( 117), -INT8_C( 113), -INT8_C(  56),  INT8_C(  17), -INT8_C(  91), -INT8_C(  32) },
+      UINT32_C(         0),
+      { -INT8_C(  75),  INT8_C(  20),  INT8_C(  84),  INT8_C(  54), -INT8_C(   8), -INT8_C( 115), -INT8_C(  32),  INT8_C(  45),
+         INT8_C(  49),  INT8_C( 125), -INT8_C(  41),  INT8_C( 108),  INT8_C( 112), -INT8_C(  50), -INT8_C(  39),  INT8_C(  64),
+        -INT8_C(  72), -INT8_C( 121),  INT8_C(   0),  INT8_C( 102),  INT8_C(   2), -INT8_C( 112),  INT8_C(  11),  INT8_C(  93),
+         INT8_C(  71),  INT8_C( 111),  INT8_C(   1), -INT8_C(  11), -INT8_C( 116), -INT8_C( 123), -INT8_C(  72), -INT8_C(  73) },
+      {  INT8_C( 115),  INT8_C( 113),  INT8_C(  45),  INT8_C(  29),  INT8_C(  77), -INT8_C(  21), -INT8_C(  20), -INT8_C(  71),
+        -INT8_C( 114),  INT8_C( 109),  INT8_C(  29), -INT8_C(  23), -INT8_C(  36),  INT8_C(  93), -INT8_C(   1),  INT8_C(   0),
+         INT8_C(  40), -INT8_C( 124),  INT8_C(  99), -INT8_C( 109),  INT8_C( 126),  INT8_C(  90),  INT8_C(   0), -INT8_C(  72),
+        -INT8_C(  15), -INT8_C( 108),  INT8_C( 117), -INT8_C( 113), -INT8_C(  56),  INT8_C(  17), -INT8_C(  91), -INT8_C(  32) } },
+    { { -INT8_C(  44), -INT8_C(   3),  INT8_C( 114), -INT8_C(  78), -INT8_C(  61),  INT8_C( 120),  INT8_C(   6),  INT8_C(  62),
+         INT8_C(  14), -INT8_C(  46), -INT8_C(  87), -INT8_C(  14), -INT8_C(  33), -INT8_C( 106), -INT8_C( 117), -INT8_C(  30),
+         INT8_C(  65), -INT8_C( 123),  INT8_C(  92), -INT8_C(  98),  INT8_C(  13), -INT8_C(  93), -INT8_C(  66), -INT8_C( 125),
+         INT8_C( 112),  INT8_C(  62), -INT8_C(   8), -INT8_C(  63), -INT8_C(  30), -INT8_C(  85), -INT8_C( 118),  INT8_C(  41) },
+      UINT32_C(4294967295),
+      { -INT8_C(  69), -INT8_C(  76), -INT8_C(  43), -INT8_C(  90), -INT8_C(   5), -INT8_C( 124),  INT8_C(  47),  INT8_C(  59),
+         INT8_C(  81), -INT8_C(  99), -INT8_C(  80), -INT8_C( 121),  INT8_C(  28),  INT8_C(  46), -INT8_C(  72), -INT8_C(  99),
+        -INT8_C(  36), -INT8_C( 103), -INT8_C(  34),  INT8_C(   1),  INT8_C(  95),  INT8_C( 101),  INT8_C(  77), -INT8_C(   5),
+         INT8_C(  30), -INT8_C( 114),  INT8_C( 127), -INT8_C(  67), -INT8_C(  94), -INT8_C(  17),  INT8_C(  68),  INT8_C( 118) },
+      { -INT8_C(  69), -INT8_C(  76), -INT8_C(  43), -INT8_C(  90), -INT8_C(   5), -INT8_C( 124),  INT8_C(  47),  INT8_C(  59),
+         INT8_C(  81), -INT8_C(  99), -INT8_C(  80), -INT8_C( 121),  INT8_C(  28),  INT8_C(  46), -INT8_C(  72), -INT8_C(  99),
+        -INT8_C(  36), -INT8_C( 103), -INT8_C(  34),  INT8_C(   1),  INT8_C(  95),  INT8_C( 101),  INT8_C(  77), -INT8_C(   5),
+         INT8_C(  30), -INT8_C( 114),  INT8_C( 127), -INT8_C(  67), -INT8_C(  94), -INT8_C(  17),  INT8_C(  68),  INT8_C( 118) } },
+    { {  INT8_C(  70),  INT8_C(  28), -INT8_C(  28), -INT8_C(  81),  INT8_C(  94), -INT8_C(  96),  INT8_C( 127), -INT8_C(  57),
+         INT8_C(  24),  INT8_C(  16), -INT8_C( 104), -INT8_C(  45),  INT8_C( 124),  INT8_C(   2), -INT8_C(  94),  INT8_C( 107),
+        -INT8_C( 119), -INT8_C(  70),  INT8_C(  57),  INT8_C( 117), -INT8_C(  53),  INT8_C( 110),  INT8_C(  24),  INT8_C(  54),
+        -INT8_C(  98),  INT8_C(  25), -INT8_C(   5),  INT8_C(  76), -INT8_C(  54),  INT8_C(  59), -INT8_C(  31), -INT8_C(  38) },
+      UINT32_C(4286821091),
+      { -INT8_C(  99), -INT8_C( 110), -INT8_C(  25),  INT8_C(  80),  INT8_C(  76), -INT8_C(  16),  INT8_C( 123), -INT8_C(  19),
+        -INT8_C(  96), -INT8_C( 123),  INT8_C(  46),  INT8_C(  90), -INT8_C( 126),  INT8_C( 101), -INT8_C(  77),  INT8_C(  40),
+        -INT8_C(  52), -INT8_C(  57),  INT8_C(  42),  INT8_C( 112), -INT8_C(  98),  INT8_C( 123), -INT8_C(  77), -INT8_C( 110),
+        -INT8_C(  11), -INT8_C(   8), -INT8_C(  57), -INT8_C(  66),  INT8_C( 105),  INT8_C(  97),  INT8_C(   1),  INT8_C(  85) },
+      { -INT8_C(  99), -INT8_C( 110), -INT8_C(  16),  INT8_C( 123), -INT8_C(  19), -INT8_C( 123), -INT8_C( 126),  INT8_C( 101),
+         INT8_C(  40), -INT8_C(  52), -INT8_C(  57), -INT8_C( 110), -INT8_C(  11), -INT8_C(   8), -INT8_C(  57), -INT8_C(  66),
+         INT8_C( 105),  INT8_C(  97),  INT8_C(   1),  INT8_C(  85), -INT8_C(  53),  INT8_C( 110),  INT8_C(  24),  INT8_C(  54),
+        -INT8_C(  98),  INT8_C(  25), -INT8_C(   5),  INT8_C(  76), -INT8_C(  54),  INT8_C(  59), -INT8_C(  31), -INT8_C(  38) } },
+    { { -INT8_C(  26), -INT8_C(   5), -INT8_C(  46),  INT8_C(  55),  INT8_C(   1), -INT8_C(  95), -INT8_C( 118), -INT8_C(  65),
+        -INT8_C( 108),  INT8_C(   9),  INT8_C(  59), -INT8_C( 119), -INT8_C(  90),  INT8_C( 119),  INT8_C(  11), -INT8_C(  69),
+        -INT8_C(  78),  INT8_C( 125),  INT8_C(  33),  INT8_C(  17), -INT8_C(  79), -INT8_C(  64), -INT8_C( 105), -INT8_C(  34),
+        -INT8_C(  45),  INT8_C(  58), -INT8_C( 124),  INT8_C(  33),  INT8_C(   7),  INT8_C(  61),  INT8_C(  67),  INT8_C(   3) },
+      UINT32_C(3793562101),
+      { -INT8_C(   5),  INT8_C(  16), -INT8_C( 110),  INT8_C(  77),  INT8_C(  51), -INT8_C(  11),  INT8_C(   2), -INT8_C(  18),
+         INT8_C(  23), -INT8_C( 127), -INT8_C(  96),  INT8_C(  25), -INT8_C(  27), -INT8_C(  62),  INT8_C( 107),  INT8_C(  95),
+        -INT8_C(  27), -INT8_C(  42),  INT8_C(  27),  INT8_C(  35), -INT8_C(  95),  INT8_C(  86), -INT8_C( 124), -INT8_C(  43),
+         INT8_C( 124), -INT8_C(  86), -INT8_C(  53),  INT8_C( 120),  INT8_C(  36),  INT8_C(  10),  INT8_C(  64),  INT8_C(  98) },
+      { -INT8_C(   5), -INT8_C( 110),  INT8_C(  51), -INT8_C(  11),  INT8_C(   2), -INT8_C(  18),  INT8_C(  23),  INT8_C(  25),
+        -INT8_C(  62), -INT8_C(  27),  INT8_C(  27),  INT8_C(  35), -INT8_C(  95), -INT8_C(  86),  INT8_C(  10),  INT8_C(  64),
+         INT8_C(  98),  INT8_C( 125),  INT8_C(  33),  INT8_C(  17), -INT8_C(  79), -INT8_C(  64), -INT8_C( 105), -INT8_C(  34),
+        -INT8_C(  45),  INT8_C(  58), -INT8_C( 124),  INT8_C(  33),  INT8_C(   7),  INT8_C(  61),  INT8_C(  67),  INT8_C(   3) } },
+    { {  INT8_C( 109),  INT8_C(  83), -INT8_C(  55), -INT8_C( 116), -INT8_C(  57),  INT8_C(  80), -INT8_C(  54),  INT8_C(   3),
+        -INT8_C( 111), -INT8_C( 124), -INT8_C(  75),  INT8_C(  86), -INT8_C(  38),  INT8_C(  77), -INT8_C(  57),  INT8_C(  92),
+        -INT8_C(  28), -INT8_C( 101), -INT8_C(  30),  INT8_C(  35), -INT8_C(  89), -INT8_C( 112), -INT8_C( 109),  INT8_C(  88),
+         INT8_C( 104), -INT8_C( 114),  INT8_C(  55),  INT8_C(  53), -INT8_C( 115), -INT8_C(  50),  INT8_C( 123), -INT8_C(  91) },
+      UINT32_C( 912240054),
+      {  INT8_C(  46), -INT8_C(  54),  INT8_C(  59),  INT8_C( 121), -INT8_C(  99),  INT8_C( 120),  INT8_C( 102), -INT8_C( 110),
+         INT8_C(  73),  INT8_C(  69), -INT8_C(  21),  INT8_C(  28),  INT8_C( 108),  INT8_C(  32),  INT8_C(  78), -INT8_C(  48),
+         INT8_C(  59),  INT8_C( 111), -INT8_C(  79), -INT8_C( 102),  INT8_C(  43),  INT8_C(  85),  INT8_C( 107), -INT8_C(  45),
+        -INT8_C(  88),  INT8_C(  91),  INT8_C(   9), -INT8_C(  69),  INT8_C(  60), -INT8_C(  32), -INT8_C(  71),  INT8_C(  98) },
+      { -INT8_C(  54),  INT8_C(  59), -INT8_C(  99),  INT8_C( 120), -INT8_C( 110),  INT8_C(  73), -INT8_C(  21),  INT8_C(  28),
+         INT8_C(  32), -INT8_C(  48),  INT8_C(  59),  INT8_C( 111), -INT8_C(  79), -INT8_C( 102),  INT8_C(  43),  INT8_C( 107),
+         INT8_C(  91),  INT8_C(   9),  INT8_C(  60), -INT8_C(  32), -INT8_C(  89), -INT8_C( 112), -INT8_C( 109),  INT8_C(  88),
+         INT8_C( 104), -INT8_C( 114),  INT8_C(  55),  INT8_C(  53), -INT8_C( 115), -INT8_C(  50),  INT8_C( 123), -INT8_C(  91) } },
+    { { -INT8_C( 105),  INT8_C(  82),  INT8_C(  36),  INT8_C(  62),  INT8_C( 126),  INT8_C( 114),  INT8_C(  14),  INT8_C(  64),
+        -INT8_C(  96), -INT8_C(  55), -INT8_C( 100), -INT8_C(  67),  INT8_C(  12), -INT8_C(   4),  INT8_C(  49), -INT8_C(   1),
+         INT8_C(  34),  INT8_C( 116),  INT8_C(   8),  INT8_C(  86), -INT8_C(  46),  INT8_C( 127), -INT8_C(  53),  INT8_C(  96),
+         INT8_C(  32),  INT8_C(  24), -INT8_C(  64), -INT8_C(  19),  INT8_C(  74),  INT8_C( 100), -INT8_C(  92),  INT8_C(  33) },
+      UINT32_C(3000454794),
+      { -INT8_C(  58),  INT8_C(  99), -INT8_C(  71), -INT8_C(  64),  INT8_C(  11), -INT8_C(  15),  INT8_C(  44), -INT8_C( 118),
+         INT8_C( 121),  INT8_C( 105),  INT8_C(  23), -INT8_C(  69),  INT8_C(  12),  INT8_C( 100), -INT8_C( 114), -INT8_C(  55),
+         INT8_C(  60),  INT8_C(   6),  INT8_C(  52), -INT8_C(  68), -INT8_C(  89),  INT8_C(  56),  INT8_C( 118),  INT8_C(  32),
+         INT8_C( 106),  INT8_C( 108),  INT8_C(  64),  INT8_C(  66),  INT8_C( 100), -INT8_C(  88),  INT8_C(  31), -INT8_C( 115) },
+      {  INT8_C(  99), -INT8_C(  64), -INT8_C( 118),  INT8_C( 105),  INT8_C(  23), -INT8_C(  69), -INT8_C( 114),  INT8_C(  60),
+         INT8_C(   6),  INT8_C(  52), -INT8_C(  89),  INT8_C( 118),  INT8_C(  32),  INT8_C( 108),  INT8_C( 100), -INT8_C(  88),
+        -INT8_C( 115),  INT8_C( 116),  INT8_C(   8),  INT8_C(  86), -INT8_C(  46),  INT8_C( 127), -INT8_C(  53),  INT8_C(  96),
+         INT8_C(  32),  INT8_C(  24), -INT8_C(  64), -INT8_C(  19),  INT8_C(  74),  INT8_C( 100), -INT8_C(  92),  INT8_C(  33) } },
+    { { -INT8_C(  49), -INT8_C( 120), -INT8_C( 115),  INT8_C(  46),  INT8_C(  88),  INT8_C( 108),  INT8_C(  62), -INT8_C(  86),
+        -INT8_C(   7), -INT8_C( 106), -INT8_C(  99),  INT8_C(  84), -INT8_C(  70), -INT8_C(  73),  INT8_C( 102),  INT8_C( 114),
+             INT8_MIN,  INT8_C(   9),  INT8_C(  45), -INT8_C( 103),  INT8_C( 114),  INT8_C(  22),  INT8_C(  30),  INT8_C(  90),
+         INT8_C( 124),  INT8_C(  34),  INT8_C(  88),  INT8_C( 122), -INT8_C( 126),  INT8_C(  57), -INT8_C(  75), -INT8_C(  98) },
+      UINT32_C(1593531193),
+      {  INT8_C(  59), -INT8_C(  47), -INT8_C(  34),  INT8_C(  51), -INT8_C(  99), -INT8_C( 118), -INT8_C(  89), -INT8_C(  86),
+        -INT8_C(  25), -INT8_C( 104),  INT8_C(  67),  INT8_C( 121),  INT8_C(  27), -INT8_C(  81),  INT8_C(   8), -INT8_C(  82),
+        -INT8_C(  65),  INT8_C(  50), -INT8_C(  22),  INT8_C(  69), -INT8_C( 117), -INT8_C(  32),  INT8_C(  69),  INT8_C( 109),
+        -INT8_C(  15), -INT8_C(  50), -INT8_C(  99), -INT8_C( 126),  INT8_C(  55), -INT8_C(  57),  INT8_C(  82), -INT8_C( 104) },
+      {  INT8_C(  59),  INT8_C(  51), -INT8_C(  99), -INT8_C( 118), -INT8_C(  25), -INT8_C( 104),  INT8_C( 121),  INT8_C(  27),
+         INT8_C(   8), -INT8_C(  65),  INT8_C(  50),  INT8_C(  69), -INT8_C( 117), -INT8_C(  32),  INT8_C(  69),  INT8_C( 109),
+        -INT8_C(  50), -INT8_C(  99), -INT8_C( 126),  INT8_C(  55),  INT8_C(  82),  INT8_C(  22),  INT8_C(  30),  INT8_C(  90),
+         INT8_C( 124),  INT8_C(  34),  INT8_C(  88),  INT8_C( 122), -INT8_C( 126),  INT8_C(  57), -INT8_C(  75), -INT8_C(  98) } },
+    { { -INT8_C(  47), -INT8_C( 100),  INT8_C(  17),  INT8_C(  59),  INT8_C(  39),  INT8_C(  43), -INT8_C( 115),  INT8_C(  76),
+         INT8_C(  90),  INT8_C(  72), -INT8_C(  78),  INT8_C(  51),  INT8_C( 115), -INT8_C(  25),  INT8_C(  46),  INT8_C(  14),
+        -INT8_C(  26),  INT8_C(  93), -INT8_C( 105), -INT8_C(  82),  INT8_C(  63),  INT8_C( 113),  INT8_C(   7), -INT8_C(  21),
+         INT8_C(  54),  INT8_C( 104),  INT8_C(  88),  INT8_C( 102), -INT8_C(  10),  INT8_C(  65),  INT8_C(  11),  INT8_C( 119) },
+      UINT32_C(1899519017),
+      {  INT8_C(  80),  INT8_C(  44), -INT8_C(  34), -INT8_C(  33),  INT8_C(  44), -INT8_C(  96),  INT8_C(   5),  INT8_C(  55),
+         INT8_C(  49), -INT8_C(  49), -INT8_C(  94),  INT8_C(  31), -INT8_C(  63), -INT8_C(  98), -INT8_C(  69), -INT8_C( 110),
+         INT8_C(  11), -INT8_C(  43),  INT8_C( 114), -INT8_C(  48), -INT8_C(  63), -INT8_C(  44), -INT8_C(  41),  INT8_C(  18),
+         INT8_C(  58), -INT8_C(  86),  INT8_C(  51),  INT8_C(  99),  INT8_C(  43),  INT8_C(  47), -INT8_C(  29),      INT8_MIN },
+      {  INT8_C(  80), -INT8_C(  33), -INT8_C(  96), -INT8_C(  94),  INT8_C(  31), -INT8_C(  63), -INT8_C(  69), -INT8_C(  48),
+        -INT8_C(  63), -INT8_C(  44),  INT8_C(  58),  INT8_C(  43),  INT8_C(  47), -INT8_C(  29),  INT8_C(  46),  INT8_C(  14),
+        -INT8_C(  26),  INT8_C(  93), -INT8_C( 105), -INT8_C(  82),  INT8_C(  63),  INT8_C( 113),  INT8_C(   7), -INT8_C(  21),
+         INT8_C(  54),  INT8_C( 104),  INT8_C(  88),  INT8_C( 102), -INT8_C(  10),  INT8_C(  65),  INT8_C(  11),  INT8_C( 119) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi8(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_compress_epi8(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x32(r, simde_x_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_compress_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[16];
+    const simde__mmask16 k;
+    const int16_t a[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    { {  INT16_C( 19113), -INT16_C( 11228),  INT16_C( 26449), -INT16_C(  5785), -INT16_C( 32154), -INT16_C(   255),  INT16_C(  3996), -INT16_C( 21159),
+        -INT16_C( 12826),  INT16_C(  9138),  INT16_C(  3305),  INT16_C(   448),  INT16_C(  1833),  INT16_C( 30927), -INT16_C(  5634), -INT16_C( 31792) },
+      UINT16_C(    0),
+      {  INT16_C(  8001), -INT16_C( 30879), -INT16_C(  6714), -INT16_C(  1030),  INT16_C( 10344), -INT16_C( 25492), -INT16_C( 26401),  INT16_C( 16159),
+         INT16_C( 11471), -INT16_C( 19412),  INT16_C( 18695),  INT16_C(  9345), -INT16_C( 16910), -INT16_C(  3524), -INT16_C( 19715), -INT16_C( 13157) },
+      {  INT16_C( 19113), -INT16_C( 11228),  INT16_C( 26449), -INT16_C(  5785), -INT16_C( 32154), -INT16_C(   255),  INT16_C(  3996), -INT16_C( 21159),
+        -INT16_C( 12826),  INT16_C(  9138),  INT16_C(  3305),  INT16_C(   448),  INT16_C(  1833),  INT16_C( 30927), -INT16_C(  5634), -INT16_C( 31792) } },
+    { {  INT16_C(  5556), -INT16_C(   261), -INT16_C( 15085), -INT16_C( 24984), -INT16_C( 10545), -INT16_C( 15031), -INT16_C(  8778),  INT16_C( 19952),
+         INT16_C( 18585), -INT16_C( 23670),  INT16_C( 22418), -INT16_C( 24433), -INT16_C(  2347),  INT16_C( 28887),  INT16_C(  5046),  INT16_C(  8057) },
+      UINT16_C(65535),
+      { -INT16_C( 31674),  INT16_C( 14067), -INT16_C( 22614),  INT16_C( 14838),  INT16_C( 21841),  INT16_C(  1319),  INT16_C( 28431), -INT16_C( 25303),
+         INT16_C(  3476), -INT16_C(   335), -INT16_C(  6273),  INT16_C(  6690),  INT16_C(  7246),  INT16_C( 32318),  INT16_C( 14282), -INT16_C( 13543) },
+      { -INT16_C( 31674),  INT16_C( 14067), -INT16_C( 22614),  INT16_C( 14838),  INT16_C( 21841),  INT16_C(  1319),  INT16_C( 28431), -INT16_C( 25303),
+         INT16_C(  3476), -INT16_C(   335), -INT16_C(  6273),  INT16_C(  6690),  INT16_C(  7246),  INT16_C( 32318),  INT16_C( 14282), -INT16_C( 13543) } },
+    { {  INT16_C( 18091), -INT16_C(  9132), -INT16_C( 25445), -INT16_C( 12447),  INT16_C(  2576), -INT16_C(  6690), -INT16_C( 32216),  INT16_C(  5845),
+         INT16_C( 30660),  INT16_C( 20161), -INT16_C( 30310), -INT16_C( 23988), -INT16_C( 19627),  INT16_C( 15438),  INT16_C( 16780),  INT16_C( 31923) },
+      UINT16_C(53577),
+      {  INT16_C(   422), -INT16_C( 19675),  INT16_C(  5020),  INT16_C( 28955),  INT16_C(  2321),  INT16_C( 14491), -INT16_C(  8272),  INT16_C( 29592),
+         INT16_C( 30551), -INT16_C( 17051),  INT16_C( 23040), -INT16_C(   512), -INT16_C( 19289),  INT16_C( 11397), -INT16_C(  3628), -INT16_C( 23100) },
+      {  INT16_C(   422),  INT16_C( 28955), -INT16_C(  8272),  INT16_C( 30551), -INT16_C( 19289), -INT16_C(  3628), -INT16_C( 23100),  INT16_C(  5845),
+         INT16_C( 30660),  INT16_C( 20161), -INT16_C( 30310), -INT16_C( 23988), -INT16_C( 19627),  INT16_C( 15438),  INT16_C( 16780),  INT16_C( 31923) } },
+    { { -INT16_C(  5321), -INT16_C( 17460),  INT16_C(  2634), -INT16_C( 31176),  INT16_C( 28453), -INT16_C( 17741), -INT16_C( 14081), -INT16_C( 24887),
+        -INT16_C( 23341), -INT16_C(  7483), -INT16_C(  8873),  INT16_C( 13758),  INT16_C( 20231),  INT16_C( 17041),  INT16_C( 32680), -INT16_C( 22715) },
+      UINT16_C(47302),
+      {  INT16_C( 26409), -INT16_C( 23931), -INT16_C( 12573), -INT16_C( 14661), -INT16_C( 18815), -INT16_C( 25981),  INT16_C( 32443),  INT16_C( 16860),
+         INT16_C( 27385),  INT16_C( 24566), -INT16_C( 18565),  INT16_C( 11266), -INT16_C(  6570), -INT16_C( 14597), -INT16_C( 17063), -INT16_C( 28546) },
+      { -INT16_C( 23931), -INT16_C( 12573),  INT16_C( 32443),  INT16_C( 16860),  INT16_C( 11266), -INT16_C(  6570), -INT16_C( 14597), -INT16_C( 28546),
+        -INT16_C( 23341), -INT16_C(  7483), -INT16_C(  8873),  INT16_C( 13758),  INT16_C( 20231),  INT16_C( 17041),  INT16_C( 32680), -INT16_C( 22715) } },
+    { { -INT16_C( 20012),  INT16_C( 24084),  INT16_C(  8272), -INT16_C( 13312), -INT16_C( 29003),  INT16_C(  5761),  INT16_C( 26106),  INT16_C(  1911),
+        -INT16_C( 23297),  INT16_C( 15085), -INT16_C( 24040), -INT16_C( 25325),  INT16_C( 18334),  INT16_C( 29547), -INT16_C( 20707),  INT16_C(  4170) },
+      UINT16_C(40109),
+      {  INT16_C( 25158),  INT16_C( 19540), -INT16_C( 26042),  INT16_C( 31041), -INT16_C( 31011),  INT16_C( 12583),  INT16_C( 22387),  INT16_C(  2781),
+         INT16_C( 24988),  INT16_C( 18179), -INT16_C( 25275), -INT16_C( 18520), -INT16_C( 15788), -INT16_C( 12441), -INT16_C( 31190),  INT16_C( 14475) },
+      {  INT16_C( 25158), -INT16_C( 26042),  INT16_C( 31041),  INT16_C( 12583),  INT16_C(  2781), -INT16_C( 25275), -INT16_C( 18520), -INT16_C( 15788),
+         INT16_C( 14475),  INT16_C( 15085), -INT16_C( 24040), -INT16_C( 25325),  INT16_C( 18334),  INT16_C( 29547), -INT16_C( 20707),  INT16_C(  4170) } },
+    { {  INT16_C( 21871), -INT16_C( 14207), -INT16_C( 16577),  INT16_C( 20070),  INT16_C(  9110), -INT16_C( 10921), -INT16_C( 23508), -INT16_C(  9541),
+        -INT16_C( 18273),  INT16_C( 29341),  INT16_C( 19898),  INT16_C( 17683), -INT16_C( 18237),  INT16_C( 17025), -INT16_C( 26562), -INT16_C( 15637) },
+      UINT16_C( 5889),
+      {  INT16_C(  9085), -INT16_C( 19277), -INT16_C(   765),  INT16_C( 16350),  INT16_C( 18801), -INT16_C( 12543), -INT16_C( 23954), -INT16_C(  5827),
+         INT16_C( 31124), -INT16_C( 24233),  INT16_C( 23060), -INT16_C( 15896), -INT16_C(  3060),  INT16_C( 25263),  INT16_C( 14728),  INT16_C(  4391) },
+      {  INT16_C(  9085),  INT16_C( 31124), -INT16_C( 24233),  INT16_C( 23060), -INT16_C(  3060), -INT16_C( 10921), -INT16_C( 23508), -INT16_C(  9541),
+        -INT16_C( 18273),  INT16_C( 29341),  INT16_C( 19898),  INT16_C( 17683), -INT16_C( 18237),  INT16_C( 17025), -INT16_C( 26562), -INT16_C( 15637) } },
+    { { -INT16_C(  8955), -INT16_C( 26512),  INT16_C( 13445), -INT16_C(   948), -INT16_C(   211),  INT16_C( 20956), -INT16_C( 20219),  INT16_C( 19338),
+        -INT16_C( 28985),  INT16_C( 21675), -INT16_C( 23002), -INT16_C(  2761),  INT16_C(  4180), -INT16_C(  4562),  INT16_C( 26265),  INT16_C(  2138) },
+      UINT16_C(44061),
+      {  INT16_C( 31921),  INT16_C( 16264),  INT16_C( 19767),  INT16_C( 25729),  INT16_C( 31732),  INT16_C( 17053), -INT16_C( 24028),  INT16_C( 31373),
+         INT16_C(  2608),  INT16_C( 32718),  INT16_C( 16229),  INT16_C(  8033),  INT16_C( 21277), -INT16_C( 29833), -INT16_C( 27130), -INT16_C( 22375) },
+      {  INT16_C( 31921),  INT16_C( 19767),  INT16_C( 25729),  INT16_C( 31732),  INT16_C( 16229),  INT16_C(  8033), -INT16_C( 29833), -INT16_C( 22375),
+        -INT16_C( 28985),  INT16_C( 21675), -INT16_C( 23002), -INT16_C(  2761),  INT16_C(  4180), -INT16_C(  4562),  INT16_C( 26265),  INT16_C(  2138) } },
+    { {  INT16_C(  5775),  INT16_C( 24464),  INT16_C( 30959), -INT16_C( 15810), -INT16_C( 29879), -INT16_C(  4592),  INT16_C( 24835),  INT16_C(  1265),
+        -INT16_C( 26620), -INT16_C(  7969),  INT16_C(  7409),  INT16_C( 16962),  INT16_C( 28210), -INT16_C( 20872), -INT16_C(  4449),  INT16_C( 14685) },
+      UINT16_C(23226),
+      { -INT16_C(  6501),  INT16_C( 32603),  INT16_C( 23205),  INT16_C( 22138),  INT16_C(  8132), -INT16_C( 22361), -INT16_C( 19271), -INT16_C( 21325),
+         INT16_C( 11123), -INT16_C( 25817),  INT16_C( 12880), -INT16_C(  8126), -INT16_C( 18721), -INT16_C( 31915),  INT16_C( 11670), -INT16_C( 22317) },
+      {  INT16_C( 32603),  INT16_C( 22138),  INT16_C(  8132), -INT16_C( 22361), -INT16_C( 21325), -INT16_C( 25817), -INT16_C(  8126), -INT16_C( 18721),
+         INT16_C( 11670), -INT16_C(  7969),  INT16_C(  7409),  INT16_C( 16962),  INT16_C( 28210), -INT16_C( 20872), -INT16_C(  4449),  INT16_C( 14685) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi16(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_compress_epi16(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x16(r, simde_x_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_compress_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[64];
+    const simde__mmask64 k;
+    const int8_t a[64];
+    const int8_t r[64];
+  } test_vec[] = {
+    { {  INT8_C(  98),  INT8_C(   0),  INT8_C(   6),  INT8_C(  52), -INT8_C(  98), -INT8_C(  99), -INT8_C(  72), -INT8_C(  73),
+         INT8_C(  80),  INT8_C(  14), -INT8_C(  84),  INT8_C( 115),  INT8_C(   7),  INT8_C(  11), -INT8_C(  73),  INT8_C(  60),
+         INT8_C(  56),  INT8_C( 116),  INT8_C(   4), -INT8_C(  70), -INT8_C(  69),  INT8_C( 116), -INT8_C(  68),  INT8_C(  61),
+         INT8_C(  93),  INT8_C(  93), -INT8_C(  31),  INT8_C(  86), -INT8_C( 118), -INT8_C( 115), -INT8_C(  70), -INT8_C(  77),
+         INT8_C(  78),  INT8_C(  90),  INT8_C(  32),  INT8_C(  84),  INT8_C(  32), -INT8_C(  64),  INT8_C(  81),  INT8_C( 123),
+         INT8_C(  63),  INT8_C(  85), -INT8_C(  41), -INT8_C(  56),  INT8_C(   5),  INT8_C(  81), -INT8_C(  47), -INT8_C(  74),
+         INT8_C(  23), -INT8_C(   5), -INT8_C(  82),  INT8_C(  99),  INT8_C(  11),  INT8_C(  29),  INT8_C(  73),  INT8_C( 105),
+        -INT8_C(  23), -INT8_C( 108), -INT8_C(  93),  INT8_C(  56),  INT8_C(   0), -INT8_C(  64), -INT8_C(  77), -INT8_C(  62) },
+      UINT64_C(                   0),
+      {  INT8_C( 107), -INT8_C(  45), -INT8_C(  10), -INT8_C(  53), -INT8_C( 126), -INT8_C(  31), -INT8_C( 112), -INT8_C( 109),
+         INT8_C(   6),  INT8_C(  70),  INT8_C(  42),  INT8_C(  52),  INT8_C(  12),  INT8_C(  96), -INT8_C(  92), -INT8_C(  19),
+        -INT8_C(  86), -INT8_C(  55),  INT8_C(  82), -INT8_C(   2),  INT8_C(  11),  INT8_C(  13), -INT8_C(  67),  INT8_C(  80),
+        -INT8_C(  36), -INT8_C(  49),  INT8_C(  68), -INT8_C( 100),  INT8_C(  99),  INT8_C(  37),  INT8_C(  15),  INT8_C(  31),
+        -INT8_C(  85),  INT8_C( 120), -INT8_C( 106),  INT8_C(  35),  INT8_C(  59), -INT8_C(  89), -INT8_C( 102),  INT8_C(  55),
+        -INT8_C(  93), -INT8_C( 108), -INT8_C(  29), -INT8_C(  62),  INT8_C(  69), -INT8_C(  59),  INT8_C(  96),  INT8_C(  98),
+         INT8_C(  94),  INT8_C(  78), -INT8_C(  44), -INT8_C(  47), -INT8_C(  22), -INT8_C(  23),  INT8_C(  72),  INT8_C(  94),
+        -INT8_C(  76),  INT8_C( 121), -INT8_C(   3), -INT8_C(  82),  INT8_C(   9), -INT8_C(  99),  INT8_C(  70), -INT8_C(  24) },
+      {  INT8_C(  98),  INT8_C(   0),  INT8_C(   6),  INT8_C(  52), -INT8_C(  98), -INT8_C(  99), -INT8_C(  72), -INT8_C(  73),
+         INT8_C(  80),  INT8_C(  14), -INT8_C(  84),  INT8_C( 115),  INT8_C(   7),  INT8_C(  11), -INT8_C(  73),  INT8_C(  60),
+         INT8_C(  56),  INT8_C( 116),  INT8_C(   4), -INT8_C(  70), -INT8_C(  69),  INT8_C( 116), -INT8_C(  68),  INT8_C(  61),
+         INT8_C(  93),  INT8_C(  93), -INT8_C(  31),  INT8_C(  86), -INT8_C( 118), -INT8_C( 115), -INT8_C(  70), -INT8_C(  77),
+         INT8_C(  78),  INT8_C(  90),  INT8_C(  32),  INT8_C(  84),  INT8_C(  32), -INT8_C(  64),  INT8_C(  81),  INT8_C( 123),
+         INT8_C(  63),  INT8_C(  85), -INT8_C(  41), -INT8_C(  56),  INT8_C(   5),  INT8_C(  81), -INT8_C(  47), -INT8_C(  74),
+         INT8_C(  23), -INT8_C(   5), -INT8_C(  82),  INT8_C(  99),  INT8_C(  11),  INT8_C(  29),  INT8_C(  73),  INT8_C( 105),
+        -INT8_C(  23), -INT8_C( 108), -INT8_C(  93),  INT8_C(  56),  INT8_C(   0), -INT8_C(  64), -INT8_C(  77), -INT8_C(  62) } },
+    { { -INT8_C(  82),  INT8_C(  71), -INT8_C( 101), -INT8_C( 126), -INT8_C(  19),  INT8_C(  66),  INT8_C(   0), -INT8_C(  54),
+        -INT8_C(  45), -INT8_C(  50),  INT8_C( 109), -INT8_C( 117),  INT8_C( 124), -INT8_C(  90),  INT8_C(  75), -INT8_C(  63),
+         INT8_C(  58), -INT8_C(  56), -INT8_C(  99),  INT8_C(  30), -INT8_C(  42), -INT8_C(  21), -INT8_C(  20), -INT8_C(  65),
+        -INT8_C( 126), -INT8_C(  69), -INT8_C(  56),  INT8_C(   7),  INT8_C(  61), -INT8_C(  91), -INT8_C(  22), -INT8_C(  47),
+         INT8_C(  70),  INT8_C( 124),  INT8_C(  68),  INT8_C(  40), -INT8_C( 104),  INT8_C(  43),  INT8_C(  17), -INT8_C(  55),
+        -INT8_C( 120), -INT8_C(  33), -INT8_C( 114), -INT8_C(  93),  INT8_C(  90),  INT8_C(  24), -INT8_C(  34),  INT8_C(  47),
+         INT8_C(  35),  INT8_C(  73), -INT8_C(  69), -INT8_C(  96), -INT8_C(  17), -INT8_C( 104), -INT8_C( 103), -INT8_C(  74),
+        -INT8_C( 123),  INT8_C(  24), -INT8_C(  42), -INT8_C(  11), -INT8_C(  38),  INT8_C(  23),  INT8_C(  57), -INT8_C(  69) },
+      UINT64_C(18446744073709551615),
+      {  INT8_C( 100), -INT8_C(  44), -INT8_C(  29),  INT8_C( 112), -INT8_C(  32), -INT8_C( 105), -INT8_C(  34), -INT8_C(  33),
+         INT8_C(  96), -INT8_C(  46),  INT8_C(  53),  INT8_C(  47),  INT8_C(  99), -INT8_C(  39), -INT8_C(  92),  INT8_C(   1),
+        -INT8_C(  77), -INT8_C(  58),  INT8_C(  27), -INT8_C(  35),  INT8_C(  94), -INT8_C(  16),  INT8_C(  37), -INT8_C( 119),
+        -INT8_C( 108), -INT8_C(  23),  INT8_C(  78), -INT8_C(  88), -INT8_C(  25),  INT8_C( 100), -INT8_C(   6), -INT8_C( 121),
+        -INT8_C( 122),  INT8_C( 127), -INT8_C(  37),  INT8_C(  22), -INT8_C(  44),  INT8_C(  61), -INT8_C(  77), -INT8_C( 106),
+        -INT8_C( 107), -INT8_C( 122),  INT8_C(  69),  INT8_C(  85), -INT8_C(  39), -INT8_C( 124),  INT8_C(  83),  INT8_C(  51),
+         INT8_C(  83), -INT8_C( 103),  INT8_C(  48),  INT8_C(  78), -INT8_C(  62), -INT8_C(  87),  INT8_C(  18),  INT8_C(  46),
+        -INT8_C(  82),  INT8_C(  89), -INT8_C( 125),      INT8_MIN, -INT8_C( 111), -INT8_C( 124), -INT8_C(  67), -INT8_C(  42) },
+      {  INT8_C( 100), -INT8_C(  44), -INT8_C(  29),  INT8_C( 112), -INT8_C(  32), -INT8_C( 105), -INT8_C(  34), -INT8_C(  33),
+         INT8_C(  96), -INT8_C(  46),  INT8_C(  53),  INT8_C(  47),  INT8_C(  99), -INT8_C(  39), -INT8_C(  92),  INT8_C(   1),
+        -INT8_C(  77), -INT8_C(  58),  INT8_C(  27), -INT8_C(  35),  INT8_C(  94), -INT8_C(  16),  INT8_C(  37), -INT8_C( 119),
+        -INT8_C( 108), -INT8_C(  23),  INT8_C(  78), -INT8_C(  88), -INT8_C(  25),  INT8_C( 100), -INT8_C(   6), -INT8_C( 121),
+        -INT8_C( 122),  INT8_C( 127), -INT8_C(  37),  INT8_C(  22), -INT8_C(  44),  INT8_C(  61), -INT8_C(  77), -INT8_C( 106),
+        -INT8_C( 107), -INT8_C( 122),  INT8_C(  69),  INT8_C(  85), -INT8_C(  39), -INT8_C( 124),  INT8_C(  83),  INT8_C(  51),
+         INT8_C(  83), -INT8_C( 103),  INT8_C(  48),  INT8_C(  78), -INT8_C(  62), -INT8_C(  87),  INT8_C(  18),  INT8_C(  46),
+        -INT8_C(  82),  INT8_C(  89), -INT8_C( 125),      INT8_MIN, -INT8_C( 111), -INT8_C( 124), -INT8_C(  67), -INT8_C(  42) } },
+    { { -INT8_C( 102),  INT8_C(   1),  INT8_C(  65), -INT8_C(  33),  INT8_C(  80), -INT8_C(  64),  INT8_C(  75),  INT8_C(  53),
+        -INT8_C( 103),  INT8_C(  96), -INT8_C(  10),  INT8_C( 115), -INT8_C(  19), -INT8_C(  64), -INT8_C(   9), -INT8_C(  32),
+        -INT8_C( 117),  INT8_C(  66),  INT8_C(  82), -INT8_C(  72), -INT8_C( 111),  INT8_C(  30),  INT8_C(  16), -INT8_C(  30),
+        -INT8_C(  41),  INT8_C(  50), -INT8_C( 126), -INT8_C( 103), -INT8_C(  62), -INT8_C(  91),  INT8_C(  30),  INT8_C(  94),
+         INT8_C(  34),  INT8_C(  84),  INT8_C(   2), -INT8_C(  10),  INT8_C(  75), -INT8_C(  71),  INT8_C(  22),  INT8_C(   8),
+         INT8_C(  92), -INT8_C(  12), -INT8_C(   7),  INT8_C(  98), -INT8_C(  48), -INT8_C(  63), -INT8_C(  72), -INT8_C(  69),
+         INT8_C(  58), -INT8_C(  30), -INT8_C(   9), -INT8_C(  68), -INT8_C( 109),  INT8_C(  40),  INT8_C(  72), -INT8_C(  80),
+        -INT8_C(  97),  INT8_C( 120), -INT8_C(  68),  INT8_C(  19), -INT8_C(  43), -INT8_C(  92),  INT8_C(  81), -INT8_C(  57) },
+      UINT64_C( 3389024321008265544),
+      {  INT8_C(  10), -INT8_C( 116),  INT8_C(  55),  INT8_C(  45), -INT8_C(  73), -INT8_C(  66),  INT8_C(   9), -INT8_C(  25),
+         INT8_C(  86),  INT8_C(  68), -INT8_C(  70),  INT8_C(  27), -INT8_C( 103), -INT8_C( 102), -INT8_C(  31),      INT8_MIN,
+        -INT8_C(  61), -INT8_C( 122), -INT8_C(  39), -INT8_C(  98),  INT8_C(  11), -INT8_C(  85), -INT8_C(  36), -INT8_C(  37),
+        -INT8_C(  18), -INT8_C(  29), -INT8_C(  34),  INT8_C(  75), -INT8_C( 115), -INT8_C(   8),  INT8_C(  79),  INT8_C( 113),
+         INT8_C(  91), -INT8_C(  55),  INT8_C(  56),  INT8_C(  60), -INT8_C(  88),  INT8_C(  17),  INT8_C(  99), -INT8_C( 119),
+        -INT8_C(  98), -INT8_C(  31),  INT8_C( 120),  INT8_C( 110), -INT8_C(  90),  INT8_C(   9), -INT8_C( 115),  INT8_C(   6),
+        -INT8_C(  72), -INT8_C( 121), -INT8_C( 120),  INT8_C(  77), -INT8_C(  21), -INT8_C( 106), -INT8_C(  21),  INT8_C( 104),
+         INT8_C(   2),  INT8_C(  62),  INT8_C(  96), -INT8_C(  58),  INT8_C( 107),  INT8_C(  47),  INT8_C( 121),  INT8_C(  47) },
+      {  INT8_C(  45),  INT8_C(   9),  INT8_C(  86),  INT8_C(  27), -INT8_C( 102), -INT8_C(  31), -INT8_C(  61), -INT8_C( 122),
+        -INT8_C(  98),  INT8_C(  11), -INT8_C(  36), -INT8_C(  37), -INT8_C(  34), -INT8_C(  55),  INT8_C(  60),  INT8_C(  17),
+        -INT8_C( 119), -INT8_C(  98), -INT8_C(  31),  INT8_C( 110), -INT8_C(  90),  INT8_C(   9),  INT8_C(  77),  INT8_C(   2),
+         INT8_C(  62),  INT8_C(  96), -INT8_C(  58),  INT8_C(  47), -INT8_C(  62), -INT8_C(  91),  INT8_C(  30),  INT8_C(  94),
+         INT8_C(  34),  INT8_C(  84),  INT8_C(   2), -INT8_C(  10),  INT8_C(  75), -INT8_C(  71),  INT8_C(  22),  INT8_C(   8),
+         INT8_C(  92), -INT8_C(  12), -INT8_C(   7),  INT8_C(  98), -INT8_C(  48), -INT8_C(  63), -INT8_C(  72), -INT8_C(  69),
+         INT8_C(  58), -INT8_C(  30), -INT8_C(   9), -INT8_C(  68), -INT8_C( 109),  INT8_C(  40),  INT8_C(  72), -INT8_C(  80),
+        -INT8_C(  97),  INT8_C( 120), -INT8_C(  68),  INT8_C(  19), -INT8_C(  43), -INT8_C(  92),  INT8_C(  81), -INT8_C(  57) } },
+    { {  INT8_C(   7), -INT8_C(  81), -INT8_C(  10),  INT8_C(  39),  INT8_C(  51),  INT8_C(  69),  INT8_C(  65), -INT8_C( 103),
+         INT8_C(  10),  INT8_C(  44), -INT8_C(  38), -INT8_C(  87),  INT8_C(  30),  INT8_C(  42), -INT8_C(  50),  INT8_C(  57),
+        -INT8_C(  95), -INT8_C(  58),  INT8_C(  99),  INT8_C(  87), -INT8_C( 101),  INT8_C(  92),  INT8_C(   0), -INT8_C(   8),
+        -INT8_C(  57), -INT8_C(  32),  INT8_C(  83), -INT8_C(  67), -INT8_C(  10), -INT8_C(  13),  INT8_C( 118),  INT8_C(  74),
+         INT8_C(  96),  INT8_C(  76),  INT8_C(   2), -INT8_C(  54),  INT8_C(  53),  INT8_C(  27),  INT8_C(  43),  INT8_C(  21),
+        -INT8_C(  55), -INT8_C( 126),  INT8_C( 119),  INT8_C(  31),  INT8_C(  77), -INT8_C(   9),  INT8_C(  14),  INT8_C(  88),
+        -INT8_C( 106),  INT8_C(  35),  INT8_C( 119),  INT8_C( 121),  INT8_C(   1),  INT8_C(  63), -INT8_C(  23), -INT8_C(  80),
+        -INT8_C(  85), -INT8_C(  96),  INT8_C(  91), -INT8_C(  63),  INT8_C( 124), -INT8_C(  30), -INT8_C(  55),  INT8_C( 100) },
+      UINT64_C( 1747258994434112496),
+      {  INT8_C(  22),  INT8_C( 112),  INT8_C(  34), -INT8_C( 102), -INT8_C( 125),  INT8_C(  96),  INT8_C( 118), -INT8_C( 114),
+        -INT8_C(  35), -INT8_C(  42), -INT8_C(  59),  INT8_C(  60),  INT8_C(   0), -INT8_C(  20), -INT8_C(  67),  INT8_C(  62),
+         INT8_C(  30), -INT8_C(  48), -INT8_C(  81), -INT8_C(  16), -INT8_C(  75),  INT8_C(  90),  INT8_C(  16), -INT8_C(  52),
+        -INT8_C(  31),  INT8_C(  74),  INT8_C(  12),  INT8_C( 104),  INT8_C( 118),  INT8_C( 100), -INT8_C(  42), -INT8_C(  75),
+         INT8_C(  68),  INT8_C( 108),  INT8_C(  20),  INT8_C(  16), -INT8_C(  30),  INT8_C(  57),  INT8_C(  95),  INT8_C(  19),
+         INT8_C( 111), -INT8_C(  31),  INT8_C( 106), -INT8_C(  44), -INT8_C( 117),  INT8_C( 118), -INT8_C(  84),  INT8_C(  27),
+        -INT8_C(  81),  INT8_C(  94),  INT8_C( 106), -INT8_C(  40),  INT8_C(  67), -INT8_C(  23),  INT8_C( 116), -INT8_C( 126),
+         INT8_C(  67), -INT8_C(  93),  INT8_C(  64), -INT8_C(   8),  INT8_C(  75), -INT8_C(  31),  INT8_C(  88),  INT8_C( 122) },
+      { -INT8_C( 125),  INT8_C(  96),  INT8_C( 118), -INT8_C( 114), -INT8_C(  35), -INT8_C(  42),  INT8_C(  60),  INT8_C(   0),
+        -INT8_C(  20), -INT8_C(  67),  INT8_C(  62),  INT8_C(  30), -INT8_C(  16), -INT8_C(  75),  INT8_C(  16), -INT8_C(  52),
+        -INT8_C(  31),  INT8_C(  12),  INT8_C( 104), -INT8_C(  42),  INT8_C(  20),  INT8_C(  16),  INT8_C(  95),  INT8_C(  19),
+        -INT8_C(  31),  INT8_C(  27), -INT8_C(  81),  INT8_C(  94),  INT8_C( 106), -INT8_C(  40),  INT8_C(  67), -INT8_C(  23),
+        -INT8_C(   8),  INT8_C(  75),  INT8_C(   2), -INT8_C(  54),  INT8_C(  53),  INT8_C(  27),  INT8_C(  43),  INT8_C(  21),
+        -INT8_C(  55), -INT8_C( 126),  INT8_C( 119),  INT8_C(  31),  INT8_C(  77), -INT8_C(   9),  INT8_C(  14),  INT8_C(  88),
+        -INT8_C( 106),  INT8_C(  35),  INT8_C( 119),  INT8_C( 121),  INT8_C(   1),  INT8_C(  63), -INT8_C(  23), -INT8_C(  80),
+        -INT8_C(  85), -INT8_C(  96),  INT8_C(  91), -INT8_C(  63),  INT8_C( 124), -INT8_C(  30), -INT8_C(  55),  INT8_C( 100) } },
+    { { -INT8_C(  80), -INT8_C( 101),  INT8_C(   8),  INT8_C(  20),  INT8_C(  82),  INT8_C(  96),  INT8_C(  40), -INT8_C(  18),
+        -INT8_C( 117),  INT8_C(  36), -INT8_C(  78),  INT8_C( 121),  INT8_C(  47),  INT8_C(   5),  INT8_C(  35), -INT8_C( 107),
+         INT8_C(  22),  INT8_C(  32), -INT8_C( 104), -INT8_C(   3), -INT8_C(   2), -INT8_C(  63), -INT8_C(  18), -INT8_C(  45),
+        -INT8_C(  84),  INT8_C( 127),  INT8_C(  51), -INT8_C(  95),  INT8_C(  96),  INT8_C(  66), -INT8_C( 116), -INT8_C(  13),
+         INT8_C( 100), -INT8_C(  96),  INT8_C(  83),  INT8_C(  81), -INT8_C( 115), -INT8_C(  74), -INT8_C(  11), -INT8_C(   2),
+         INT8_C( 109), -INT8_C(  97), -INT8_C(  82),  INT8_C(  79),  INT8_C(  57),  INT8_C(  23),  INT8_C(  37),  INT8_C(  51),
+         INT8_C(   5),  INT8_C( 109), -INT8_C(  67),  INT8_C(   6), -INT8_C(  70),  INT8_C(  63), -INT8_C(  31), -INT8_C(  84),
+         INT8_C(  87), -INT8_C(  71), -INT8_C(  36), -INT8_C(  23),      INT8_MIN,  INT8_C(  89),  INT8_C(   3),  INT8_C(  91) },
+      UINT64_C(13767149109991691288),
+      { -INT8_C(  63), -INT8_C(  16),  INT8_C(  97), -INT8_C(  25),  INT8_C(  58), -INT8_C(  96),  INT8_C(  35), -INT8_C( 117),
+        -INT8_C( 118), -INT8_C(  61),  INT8_C(  64), -INT8_C(  14), -INT8_C( 103), -INT8_C( 108), -INT8_C(  79),  INT8_C(  56),
+        -INT8_C( 106),  INT8_C(  11), -INT8_C(  63), -INT8_C(  98),  INT8_C(  21),  INT8_C(   1),  INT8_C(  63), -INT8_C(  51),
+        -INT8_C(   8),  INT8_C(  47),  INT8_C( 127),  INT8_C( 103),  INT8_C( 121), -INT8_C(  73), -INT8_C(  52), -INT8_C(  35),
+         INT8_C(  94),  INT8_C(  16),  INT8_C(   8), -INT8_C( 120), -INT8_C( 125), -INT8_C( 100), -INT8_C(  15), -INT8_C(  50),
+        -INT8_C( 109), -INT8_C(  56),  INT8_C(  15),  INT8_C(  31),  INT8_C(  35),  INT8_C( 125), -INT8_C(  39),      INT8_MIN,
+        -INT8_C( 107), -INT8_C(   4), -INT8_C(  33),  INT8_C(  96),  INT8_C( 106), -INT8_C(  68),  INT8_C(  35), -INT8_C(  69),
+        -INT8_C(  72), -INT8_C(  93), -INT8_C( 108),  INT8_C(  43), -INT8_C(  79),  INT8_C(  90), -INT8_C(  48),  INT8_C(   9) },
+      { -INT8_C(  25),  INT8_C(  58),  INT8_C(  64), -INT8_C( 103), -INT8_C(  79),  INT8_C(  56), -INT8_C( 106),  INT8_C(  11),
+         INT8_C(   1),  INT8_C(  63), -INT8_C(  51),  INT8_C(  47),  INT8_C( 127),  INT8_C( 103), -INT8_C(  35),  INT8_C(   8),
+        -INT8_C( 120), -INT8_C( 100), -INT8_C( 109),  INT8_C(  15),  INT8_C(  31),  INT8_C(  35),  INT8_C( 125),      INT8_MIN,
+        -INT8_C(   4), -INT8_C(  33),  INT8_C(  96), -INT8_C(  72), -INT8_C(  93), -INT8_C( 108),  INT8_C(  43), -INT8_C(  79),
+         INT8_C(  90),  INT8_C(   9),  INT8_C(  83),  INT8_C(  81), -INT8_C( 115), -INT8_C(  74), -INT8_C(  11), -INT8_C(   2),
+         INT8_C( 109), -INT8_C(  97), -INT8_C(  82),  INT8_C(  79),  INT8_C(  57),  INT8_C(  23),  INT8_C(  37),  INT8_C(  51),
+         INT8_C(   5),  INT8_C( 109), -INT8_C(  67),  INT8_C(   6), -INT8_C(  70),  INT8_C(  63), -INT8_C(  31), -INT8_C(  84),
+         INT8_C(  87), -INT8_C(  71), -INT8_C(  36), -INT8_C(  23),      INT8_MIN,  INT8_C(  89),  INT8_C(   3),  INT8_C(  91) } },
+    { { -INT8_C(  15), -INT8_C( 116), -INT8_C( 111),  INT8_C(  46),  INT8_C(  36),  INT8_C( 110), -INT8_C(  96), -INT8_C( 115),
+        -INT8_C( 120),  INT8_C(  49),  INT8_C(  83), -INT8_C( 125), -INT8_C(  34),  INT8_C( 101),  INT8_C(  79), -INT8_C(  61),
+        -INT8_C(  18), -INT8_C(  57),  INT8_C(  20),  INT8_C(  80),  INT8_C(  10),  INT8_C( 110), -INT8_C(  82),  INT8_C(  13),
+        -INT8_C(  11),  INT8_C(  30),  INT8_C( 126),  INT8_C(  42), -INT8_C(  78),  INT8_C( 115), -INT8_C( 119),  INT8_C(  36),
+        -INT8_C(  68), -INT8_C( 127),  INT8_C(  44), -INT8_C(  44),  INT8_C(  81), -INT8_C(  13),  INT8_C(  58), -INT8_C(  80),
+         INT8_C( 107),  INT8_C(  43),  INT8_C(  63),  INT8_C(  73),  INT8_C(  27),  INT8_C( 105),  INT8_C( 109), -INT8_C( 107),
+        -INT8_C(  18), -INT8_C(  37), -INT8_C(  92), -INT8_C(  17),  INT8_C(  60),  INT8_C(  36), -INT8_C(  92), -INT8_C(   3),
+         INT8_C(  64),  INT8_C(  24),  INT8_C(  42),  INT8_C(   2),  INT8_C(  54), -INT8_C(  94), -INT8_C(  57), -INT8_C( 118) },
+      UINT64_C(15425793642966888303),
+      { -INT8_C(  23),  INT8_C(   4), -INT8_C(  40), -INT8_C( 125),  INT8_C(  18),  INT8_C(  32), -INT8_C(  54),  INT8_C(  73),
+        -INT8_C(  57), -INT8_C(  72), -INT8_C( 113), -INT8_C(  78), -INT8_C(   1),  INT8_C(  20),  INT8_C( 116),  INT8_C(  10),
+         INT8_C(  68), -INT8_C(   2),  INT8_C(  75), -INT8_C( 117), -INT8_C(  68), -INT8_C(  73), -INT8_C(  40),  INT8_C(  89),
+         INT8_C(  87), -INT8_C(  33),  INT8_C(   4), -INT8_C( 104), -INT8_C(  61), -INT8_C(  94),  INT8_C(  67),  INT8_C(   7),
+        -INT8_C(  47), -INT8_C(  18), -INT8_C( 105), -INT8_C(  14),  INT8_C( 125),  INT8_C( 115),  INT8_C(  41),  INT8_C(   1),
+        -INT8_C(  21),  INT8_C(  66),  INT8_C(  66), -INT8_C(  46),  INT8_C(  19),  INT8_C(  83),  INT8_C(  75), -INT8_C(  95),
+         INT8_C(  80),  INT8_C(  64),  INT8_C(  10), -INT8_C(  40),  INT8_C(  75),  INT8_C(  55), -INT8_C(  83),  INT8_C(  62),
+        -INT8_C( 122),  INT8_C( 105), -INT8_C(  19),  INT8_C( 126), -INT8_C(  98),  INT8_C(  87), -INT8_C(  63), -INT8_C(  38) },
+      { -INT8_C(  23),  INT8_C(   4), -INT8_C(  40), -INT8_C( 125),  INT8_C(  32), -INT8_C(  54), -INT8_C(  57), -INT8_C(  72),
+        -INT8_C( 113), -INT8_C(  78),  INT8_C(  20),  INT8_C(  68),  INT8_C(  75),  INT8_C(  89),  INT8_C(  87), -INT8_C(  33),
+         INT8_C(  67),  INT8_C(   7), -INT8_C(  18), -INT8_C( 105),  INT8_C( 125),  INT8_C(   1), -INT8_C(  21),  INT8_C(  66),
+        -INT8_C(  46),  INT8_C(  83),  INT8_C(  75),  INT8_C(  80),  INT8_C(  64),  INT8_C(  75),  INT8_C( 105), -INT8_C(  19),
+        -INT8_C(  98), -INT8_C(  63), -INT8_C(  38), -INT8_C(  44),  INT8_C(  81), -INT8_C(  13),  INT8_C(  58), -INT8_C(  80),
+         INT8_C( 107),  INT8_C(  43),  INT8_C(  63),  INT8_C(  73),  INT8_C(  27),  INT8_C( 105),  INT8_C( 109), -INT8_C( 107),
+        -INT8_C(  18), -INT8_C(  37), -INT8_C(  92), -INT8_C(  17),  INT8_C(  60),  INT8_C(  36), -INT8_C(  92), -INT8_C(   3),
+         INT8_C(  64),  INT8_C(  24),  INT8_C(  42),  INT8_C(   2),  INT8_C(  54), -INT8_C(  94), -INT8_C(  57), -INT8_C( 118) } },
+    { {  INT8_C(  60), -INT8_C(   6), -INT8_C(  13),  INT8_C( 112),  INT8_C(  16),  INT8_C(  58),  INT8_C(  14),  INT8_C(   0),
+         INT8_C(  68),  INT8_C(  86), -INT8_C(  26), -INT8_C(  51),  INT8_C( 116),  INT8_C(  54), -INT8_C(  58), -INT8_C(  15),
+         INT8_C(  66),  INT8_C(  96),  INT8_C(   8),  INT8_C( 112),  INT8_C(  70),  INT8_C(  84), -INT8_C(  74),  INT8_C(  79),
+         INT8_C(   9), -INT8_C( 125), -INT8_C(  44), -INT8_C(  95),  INT8_C(  34), -INT8_C(  84),  INT8_C( 117),  INT8_C(  97),
+         INT8_C(  71),  INT8_C(  33), -INT8_C( 127),  INT8_C(  78),  INT8_C(  64), -INT8_C(  94), -INT8_C( 101), -INT8_C(  52),
+        -INT8_C(  17),  INT8_C(  80), -INT8_C(  82),  INT8_C(  77),  INT8_C( 119),  INT8_C(  25),  INT8_C( 121), -INT8_C(  19),
+        -INT8_C(   2),  INT8_C(  39), -INT8_C(  77),  INT8_C(  22),  INT8_C( 120),  INT8_C( 122), -INT8_C(  34), -INT8_C(  91),
+         INT8_C( 114),  INT8_C(   8), -INT8_C(  88),  INT8_C(  61), -INT8_C(  75), -INT8_C(  46),  INT8_C(  69), -INT8_C( 127) },
+      UINT64_C( 6824792937946425267),
+      {  INT8_C(  34), -INT8_C(  36), -INT8_C(  23),  INT8_C( 112),  INT8_C(  94),  INT8_C( 118), -INT8_C(  22), -INT8_C(  31),
+        -INT8_C(  54),  INT8_C(  83), -INT8_C(  69),  INT8_C( 114), -INT8_C(  36), -INT8_C(  61),  INT8_C( 106), -INT8_C(   6),
+        -INT8_C(  65), -INT8_C(   2), -INT8_C( 121), -INT8_C(  94),  INT8_C(  63), -INT8_C(  21),  INT8_C( 116),  INT8_C(  64),
+        -INT8_C(  96), -INT8_C( 125),  INT8_C( 116),  INT8_C(  12), -INT8_C(  48),  INT8_C(  73), -INT8_C(  71),  INT8_C(  82),
+        -INT8_C(  90), -INT8_C(  63),  INT8_C(  98),  INT8_C( 122),  INT8_C(  40),  INT8_C(  78), -INT8_C(  24), -INT8_C(  23),
+        -INT8_C(  96),  INT8_C( 123),  INT8_C(  29), -INT8_C( 117),  INT8_C(   2),  INT8_C( 114), -INT8_C(  10), -INT8_C(  55),
+         INT8_C( 114),  INT8_C( 108), -INT8_C(  28), -INT8_C(   7), -INT8_C(  70),  INT8_C(  95), -INT8_C( 109), -INT8_C( 116),
+         INT8_C(  31),  INT8_C(  47),  INT8_C(  19), -INT8_C(  19),  INT8_C(  26), -INT8_C(  58),  INT8_C(   7), -INT8_C( 115) },
+      {  INT8_C(  34), -INT8_C(  36),  INT8_C(  94),  INT8_C( 118), -INT8_C(  31), -INT8_C(  54),  INT8_C(  83), -INT8_C(  69),
+        -INT8_C(  61), -INT8_C( 121), -INT8_C(  21),  INT8_C( 116),  INT8_C(  64), -INT8_C(  96), -INT8_C( 125),  INT8_C(  12),
+         INT8_C(  82),  INT8_C(  98), -INT8_C(  96), -INT8_C( 117), -INT8_C(  55),  INT8_C( 108), -INT8_C(  28), -INT8_C(  70),
+         INT8_C(  95), -INT8_C( 116),  INT8_C(  47),  INT8_C(  19), -INT8_C(  19),  INT8_C(  26),  INT8_C(   7),  INT8_C(  97),
+         INT8_C(  71),  INT8_C(  33), -INT8_C( 127),  INT8_C(  78),  INT8_C(  64), -INT8_C(  94), -INT8_C( 101), -INT8_C(  52),
+        -INT8_C(  17),  INT8_C(  80), -INT8_C(  82),  INT8_C(  77),  INT8_C( 119),  INT8_C(  25),  INT8_C( 121), -INT8_C(  19),
+        -INT8_C(   2),  INT8_C(  39), -INT8_C(  77),  INT8_C(  22),  INT8_C( 120),  INT8_C( 122), -INT8_C(  34), -INT8_C(  91),
+         INT8_C( 114),  INT8_C(   8), -INT8_C(  88),  INT8_C(  61), -INT8_C(  75), -INT8_C(  46),  INT8_C(  69), -INT8_C( 127) } },
+    { {  INT8_C( 125),  INT8_C(  15),  INT8_C( 111), -INT8_C(  69), -INT8_C(  14), -INT8_C(  95), -INT8_C(  30), -INT8_C(  31),
+        -INT8_C(  12), -INT8_C(   9), -INT8_C( 116),  INT8_C(   9), -INT8_C( 103),  INT8_C( 108), -INT8_C(  46),  INT8_C(  81),
+        -INT8_C(  91), -INT8_C( 106),  INT8_C(  63),  INT8_C(  47),  INT8_C(  89),  INT8_C(  53),  INT8_C(  55),  INT8_C( 115),
+        -INT8_C(  69),  INT8_C( 106),  INT8_C(  40), -INT8_C(  88),  INT8_C(   7),  INT8_C(  17), -INT8_C( 107), -INT8_C(  20),
+         INT8_C( 123), -INT8_C(  55),  INT8_C(  38),  INT8_C(  14),  INT8_C(   0),  INT8_C( 100),  INT8_C( 104),  INT8_C(  26),
+        -INT8_C(  78), -INT8_C(  65),  INT8_C(  24),  INT8_C(  72),  INT8_C( 114), -INT8_C(  60),  INT8_C(  45), -INT8_C( 125),
+         INT8_C(   2), -INT8_C( 112),  INT8_C(  47), -INT8_C(  79), -INT8_C(  94),  INT8_C( 121),  INT8_C(  65),  INT8_C(  27),
+        -INT8_C( 125),  INT8_C(  92),  INT8_C(  48), -INT8_C(  92), -INT8_C(  69),  INT8_C( 120),  INT8_C( 112),  INT8_C(  42) },
+      UINT64_C(17182975847709745090),
+      { -INT8_C( 108), -INT8_C(  65),  INT8_C(  56), -INT8_C(  24),  INT8_C(  51), -INT8_C( 107),  INT8_C( 106),  INT8_C(   4),
+         INT8_C(  58), -INT8_C(  12),  INT8_C(  87), -INT8_C(  53),  INT8_C(  68),  INT8_C( 100), -INT8_C( 114),  INT8_C(   5),
+         INT8_C( 125), -INT8_C(  25), -INT8_C(  70), -INT8_C(  63), -INT8_C(  56), -INT8_C(  85),  INT8_C(  14),  INT8_C( 118),
+        -INT8_C(  38), -INT8_C(  25),  INT8_C(   6),  INT8_C( 116), -INT8_C(  30),  INT8_C(  47), -INT8_C(  13), -INT8_C( 106),
+        -INT8_C(  95),  INT8_C(  74), -INT8_C(  62), -INT8_C(  67),  INT8_C(  72), -INT8_C(  64),  INT8_C( 103), -INT8_C(  51),
+         INT8_C(   6),  INT8_C(  42),  INT8_C(  82), -INT8_C(  98),  INT8_C(  51),  INT8_C(  11),  INT8_C(  13), -INT8_C(  81),
+         INT8_C(  66), -INT8_C(  62),  INT8_C(  61),  INT8_C(  61),  INT8_C(  89),  INT8_C(  71), -INT8_C(  97),  INT8_C(  84),
+        -INT8_C(  34),  INT8_C(  93),  INT8_C(  99),  INT8_C(  39),  INT8_C(  85), -INT8_C(   9), -INT8_C(  80),  INT8_C(  47) },
+      { -INT8_C(  65),  INT8_C( 106),  INT8_C(   4),  INT8_C(  58), -INT8_C(  12),  INT8_C(  87), -INT8_C(  53),  INT8_C(  68),
+         INT8_C( 125), -INT8_C(  25), -INT8_C(  63), -INT8_C(  56),  INT8_C(  14),  INT8_C( 118), -INT8_C(  25), -INT8_C( 106),
+         INT8_C(  74), -INT8_C(  62), -INT8_C(  67),  INT8_C(  72), -INT8_C(  64),  INT8_C( 103),  INT8_C(   6),  INT8_C(  51),
+         INT8_C(  11), -INT8_C(  62),  INT8_C(  61),  INT8_C(  89),  INT8_C(  71), -INT8_C(  97),  INT8_C(  93),  INT8_C(  99),
+         INT8_C(  39), -INT8_C(   9), -INT8_C(  80),  INT8_C(  47),  INT8_C(   0),  INT8_C( 100),  INT8_C( 104),  INT8_C(  26),
+        -INT8_C(  78), -INT8_C(  65),  INT8_C(  24),  INT8_C(  72),  INT8_C( 114), -INT8_C(  60),  INT8_C(  45), -INT8_C( 125),
+         INT8_C(   2), -INT8_C( 112),  INT8_C(  47), -INT8_C(  79), -INT8_C(  94),  INT8_C( 121),  INT8_C(  65),  INT8_C(  27),
+        -INT8_C( 125),  INT8_C(  92),  INT8_C(  48), -INT8_C(  92), -INT8_C(  69),  INT8_C( 120),  INT8_C( 112),  INT8_C(  42) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi8(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_compress_epi8(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_compress_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[32];
+    const simde__mmask32 k;
+    const int16_t a[32];
+    const int16_t r[32];
+  } test_vec[] = {
+    { { -INT16_C( 13776),  INT16_C( 28965),  INT16_C(   681),  INT16_C(  3588),  INT16_C( 24076), -INT16_C( 28242),  INT16_C( 17846),  INT16_C( 13493),
+         INT16_C( 17804),  INT16_C( 21371), -INT16_C(   161),  INT16_C( 13224), -INT16_C(  2769),  INT16_C(  4500), -INT16_C( 14653),  INT16_C(   737),
+         INT16_C( 29150),  INT16_C( 31995), -INT16_C( 17940), -INT16_C( 27026),  INT16_C( 12131), -INT16_C( 17761),  INT16_C(  1263),  INT16_C( 20022),
+         INT16_C(  5206), -INT16_C( 22112),  INT16_C(  8624),  INT16_C(  4377), -INT16_C(  7543), -INT16_C( 17197),  INT16_C( 17555),  INT16_C( 32222) },
+      UINT32_C(         0),
+      {  INT16_C( 17603),  INT16_C( 10156), -INT16_C( 31973),  INT16_C( 12398), -INT16_C( 16770), -INT16_C(  8433), -INT16_C( 11190), -INT16_C( 21859),
+         INT16_C( 22787), -INT16_C( 24439),  INT16_C( 16053), -INT16_C(  7066),  INT16_C( 26753), -INT16_C(   512), -INT16_C( 31979),  INT16_C(  8208),
+         INT16_C( 15392), -INT16_C( 28134),  INT16_C( 27955), -INT16_C( 18205), -INT16_C(  5389), -INT16_C( 22849),  INT16_C( 24945), -INT16_C( 18261),
+         INT16_C( 17727), -INT16_C( 19683), -INT16_C(  2542),  INT16_C(   695), -INT16_C( 20900),  INT16_C(  8491),  INT16_C(  2423),  INT16_C(  5409) },
+      { -INT16_C( 13776),  INT16_C( 28965),  INT16_C(   681),  INT16_C(  3588),  INT16_C( 24076), -INT16_C( 28242),  INT16_C( 17846),  INT16_C( 13493),
+         INT16_C( 17804),  INT16_C( 21371), -INT16_C(   161),  INT16_C( 13224), -INT16_C(  2769),  INT16_C(  4500), -INT16_C( 14653),  INT16_C(   737),
+         INT16_C( 29150),  INT16_C( 31995), -INT16_C( 17940), -INT16_C( 27026),  INT16_C( 12131), -INT16_C( 17761),  INT16_C(  1263),  INT16_C( 20022),
+         INT16_C(  5206), -INT16_C( 22112),  INT16_C(  8624),  INT16_C(  4377), -INT16_C(  7543), -INT16_C( 17197),  INT16_C( 17555),  INT16_C( 32222) } },
+    { {  INT16_C( 22000),  INT16_C( 14475), -INT16_C( 22004),  INT16_C( 13675), -INT16_C( 26909),  INT16_C(  6915), -INT16_C(  2313),  INT16_C( 22367),
+         INT16_C( 26365), -INT16_C(  4094),  INT16_C(  6295), -INT16_C(  7788), -INT16_C( 13398), -INT16_C( 17928),  INT16_C(  4046),  INT16_C( 15515),
+         INT16_C( 28548), -INT16_C(   193), -INT16_C(  1552),  INT16_C( 31266),  INT16_C( 20486),  INT16_C( 27218),  INT16_C( 29280),  INT16_C(  7710),
+         INT16_C( 27724),  INT16_C( 28726),  INT16_C( 16922), -INT16_C( 10118),  INT16_C( 19617),  INT16_C( 11720),  INT16_C(  2869),  INT16_C(  8017) },
+      UINT32_C(4294967295),
+      { -INT16_C( 16247),  INT16_C( 24355), -INT16_C(  6787),  INT16_C( 20974),  INT16_C( 31445), -INT16_C( 16914), -INT16_C(  4012),  INT16_C( 12641),
+        -INT16_C( 10475), -INT16_C( 31208),  INT16_C( 31927),  INT16_C( 28752), -INT16_C(  7644),  INT16_C( 27825), -INT16_C(  9328),  INT16_C(   596),
+        -INT16_C( 22096), -INT16_C( 26630),  INT16_C( 31294),  INT16_C(  9302),  INT16_C( 31824),  INT16_C( 23576), -INT16_C( 18512),  INT16_C(  1568),
+         INT16_C(  9850), -INT16_C( 24562), -INT16_C( 32471),  INT16_C( 16484),  INT16_C( 11204), -INT16_C(  2759),  INT16_C( 16782),  INT16_C( 13553) },
+      { -INT16_C( 16247),  INT16_C( 24355), -INT16_C(  6787),  INT16_C( 20974),  INT16_C( 31445), -INT16_C( 16914), -INT16_C(  4012),  INT16_C( 12641),
+        -INT16_C( 10475), -INT16_C( 31208),  INT16_C( 31927),  INT16_C( 28752), -INT16_C(  7644),  INT16_C( 27825), -INT16_C(  9328),  INT16_C(   596),
+        -INT16_C( 22096), -INT16_C( 26630),  INT16_C( 31294),  INT16_C(  9302),  INT16_C( 31824),  INT16_C( 23576), -INT16_C( 18512),  INT16_C(  1568),
+         INT16_C(  9850), -INT16_C( 24562), -INT16_C( 32471),  INT16_C( 16484),  INT16_C( 11204), -INT16_C(  2759),  INT16_C( 16782),  INT16_C( 13553) } },
+    { {  INT16_C( 24705), -INT16_C(  9856),  INT16_C(  5754), -INT16_C( 24576),  INT16_C( 15177),  INT16_C( 15539),  INT16_C(  4586),  INT16_C( 15631),
+         INT16_C(  1691), -INT16_C(     2),  INT16_C( 14222),  INT16_C( 19211), -INT16_C(  6365),  INT16_C( 12202), -INT16_C( 20659),  INT16_C( 28692),
+         INT16_C( 32152), -INT16_C( 15061),  INT16_C( 16466),  INT16_C( 10116),  INT16_C( 16525), -INT16_C( 31718),  INT16_C( 16139),  INT16_C(  9053),
+         INT16_C( 17087),  INT16_C( 23160), -INT16_C( 17380), -INT16_C( 14701),  INT16_C( 19711), -INT16_C( 27114),  INT16_C( 21761), -INT16_C( 21347) },
+      UINT32_C( 475186765),
+      {  INT16_C( 26811),  INT16_C( 10276),  INT16_C(  3066), -INT16_C( 16095),  INT16_C( 23096), -INT16_C( 11374),  INT16_C( 18484),  INT16_C(  2456),
+        -INT16_C( 19283),  INT16_C( 32459), -INT16_C( 20586), -INT16_C(  2672),  INT16_C(  6530),  INT16_C(  9489), -INT16_C( 19685),  INT16_C(  6046),
+        -INT16_C( 27881),  INT16_C( 15380), -INT16_C( 22428),  INT16_C(  5891),  INT16_C( 20295), -INT16_C(  9067),  INT16_C( 28343), -INT16_C( 29802),
+        -INT16_C(  7768),  INT16_C(  2516),  INT16_C( 24899), -INT16_C( 19235), -INT16_C( 27849), -INT16_C( 14898), -INT16_C(  6246),  INT16_C( 31782) },
+      {  INT16_C( 26811),  INT16_C(  3066), -INT16_C( 16095),  INT16_C( 18484),  INT16_C( 32459), -INT16_C( 20586), -INT16_C( 19685),  INT16_C(  6046),
+         INT16_C( 15380),  INT16_C( 20295),  INT16_C( 28343),  INT16_C( 24899), -INT16_C( 19235), -INT16_C( 27849), -INT16_C( 20659),  INT16_C( 28692),
+         INT16_C( 32152), -INT16_C( 15061),  INT16_C( 16466),  INT16_C( 10116),  INT16_C( 16525), -INT16_C( 31718),  INT16_C( 16139),  INT16_C(  9053),
+         INT16_C( 17087),  INT16_C( 23160), -INT16_C( 17380), -INT16_C( 14701),  INT16_C( 19711), -INT16_C( 27114),  INT16_C( 21761), -INT16_C( 21347) } },
+    { {  INT16_C(  8224),  INT16_C( 10258), -INT16_C( 32240),  INT16_C( 32449),  INT16_C(    12), -INT16_C( 24032), -INT16_C( 11431), -INT16_C( 19334),
+         INT16_C( 21133), -INT16_C(  6068),  INT16_C( 10393),  INT16_C( 27536), -INT16_C(  3371),  INT16_C( 19641),  INT16_C( 23452), -INT16_C( 32073),
+        -INT16_C( 11037),  INT16_C(  9931), -INT16_C(  4206), -INT16_C(  9250), -INT16_C( 15860),  INT16_C( 28931), -INT16_C( 12657),  INT16_C( 24917),
+         INT16_C( 24381),  INT16_C( 12957),  INT16_C(  4148), -INT16_C(  5126),  INT16_C( 32700), -INT16_C(  2221),  INT16_C(  4658),  INT16_C(  4992) },
+      UINT32_C(2105440401),
+      {  INT16_C( 25441),  INT16_C( 15175), -INT16_C( 22705), -INT16_C(  9188), -INT16_C( 23795),  INT16_C( 10134), -INT16_C( 18215),  INT16_C(  4753),
+         INT16_C( 10280),  INT16_C( 20042), -INT16_C( 16902), -INT16_C( 20878),  INT16_C(  7987), -INT16_C( 15517), -INT16_C( 17888), -INT16_C( 19639),
+         INT16_C( 12842), -INT16_C( 15464),  INT16_C( 20424), -INT16_C( 30511),  INT16_C( 12005), -INT16_C( 22478),  INT16_C( 20741), -INT16_C( 17651),
+        -INT16_C( 15266),  INT16_C( 31979), -INT16_C( 12214),  INT16_C( 22907), -INT16_C( 24411), -INT16_C( 24791),  INT16_C(   392), -INT16_C( 28433) },
+      {  INT16_C( 25441), -INT16_C( 23795),  INT16_C(  4753), -INT16_C( 20878),  INT16_C(  7987), -INT16_C( 15517), -INT16_C( 17888), -INT16_C( 15464),
+         INT16_C( 20424), -INT16_C( 30511),  INT16_C( 12005), -INT16_C( 22478),  INT16_C( 20741), -INT16_C( 15266), -INT16_C( 12214),  INT16_C( 22907),
+        -INT16_C( 24411), -INT16_C( 24791),  INT16_C(   392), -INT16_C(  9250), -INT16_C( 15860),  INT16_C( 28931), -INT16_C( 12657),  INT16_C( 24917),
+         INT16_C( 24381),  INT16_C( 12957),  INT16_C(  4148), -INT16_C(  5126),  INT16_C( 32700), -INT16_C(  2221),  INT16_C(  4658),  INT16_C(  4992) } },
+    { {  INT16_C( 24817), -INT16_C(  3014),  INT16_C( 29889), -INT16_C( 32660),  INT16_C( 27431),  INT16_C(  7919), -INT16_C(  8820),  INT16_C( 32352),
+        -INT16_C( 27158),  INT16_C( 22474), -INT16_C( 16577),  INT16_C( 12190), -INT16_C(  2803),  INT16_C( 21092), -INT16_C( 29706),  INT16_C( 24588),
+         INT16_C( 29678),  INT16_C( 31061), -INT16_C( 13061),  INT16_C( 24395), -INT16_C( 19585),  INT16_C(  3516), -INT16_C( 24343), -INT16_C( 32603),
+         INT16_C(  7009),  INT16_C( 15743),  INT16_C( 30497),  INT16_C( 24425), -INT16_C( 26889), -INT16_C( 29379),  INT16_C( 16768), -INT16_C( 13143) },
+      UINT32_C(1903304880),
+      { -INT16_C( 17121), -INT16_C(  3996),  INT16_C( 28023),  INT16_C( 23285),  INT16_C( 13340), -INT16_C(  3676),  INT16_C( 16774), -INT16_C( 10911),
+        -INT16_C( 10804),  INT16_C( 20956),  INT16_C( 29501), -INT16_C(  1251), -INT16_C( 17392), -INT16_C(  6953),  INT16_C( 22839),  INT16_C( 14527),
+        -INT16_C( 22614),  INT16_C(  2080),  INT16_C( 11324),  INT16_C( 31656), -INT16_C(  5365), -INT16_C(  2578), -INT16_C(  7200),  INT16_C( 17014),
+         INT16_C( 16496),  INT16_C( 29108), -INT16_C( 29879), -INT16_C(  7646),  INT16_C( 25327),  INT16_C(  9122), -INT16_C( 32459), -INT16_C( 30748) },
+      {  INT16_C( 13340), -INT16_C(  3676), -INT16_C( 10911), -INT16_C(  6953),  INT16_C(  2080), -INT16_C(  5365), -INT16_C(  2578), -INT16_C(  7200),
+         INT16_C( 16496),  INT16_C( 25327),  INT16_C(  9122), -INT16_C( 32459), -INT16_C(  2803),  INT16_C( 21092), -INT16_C( 29706),  INT16_C( 24588),
+         INT16_C( 29678),  INT16_C( 31061), -INT16_C( 13061),  INT16_C( 24395), -INT16_C( 19585),  INT16_C(  3516), -INT16_C( 24343), -INT16_C( 32603),
+         INT16_C(  7009),  INT16_C( 15743),  INT16_C( 30497),  INT16_C( 24425), -INT16_C( 26889), -INT16_C( 29379),  INT16_C( 16768), -INT16_C( 13143) } },
+    { {  INT16_C(  9246),  INT16_C( 13910), -INT16_C(  6762), -INT16_C( 24038), -INT16_C(  7531),  INT16_C(   139), -INT16_C( 26716),  INT16_C( 18404),
+         INT16_C( 23387),  INT16_C( 10993),  INT16_C( 30810), -INT16_C(  1972),  INT16_C( 15063),  INT16_C( 27658),  INT16_C(  6036), -INT16_C( 19109),
+        -INT16_C( 26166),  INT16_C(  8824), -INT16_C( 30108), -INT16_C(  1387),  INT16_C( 18711),  INT16_C(  4779), -INT16_C( 18850), -INT16_C(  9407),
+        -INT16_C(  8118), -INT16_C(  1819),  INT16_C(  1735),  INT16_C( 25712), -INT16_C(  9794), -INT16_C( 14964), -INT16_C(  7188),  INT16_C( 24454) },
+      UINT32_C(2987002632),
+      {  INT16_C( 15707),  INT16_C(  7433), -INT16_C(   291), -INT16_C( 26821), -INT16_C(  7160), -INT16_C( 18787),  INT16_C( 17661),  INT16_C(   544),
+         INT16_C( 11208),  INT16_C( 31945),  INT16_C(  8284), -INT16_C( 21542),  INT16_C(  8288),  INT16_C( 16448), -INT16_C(  3564),  INT16_C( 25243),
+        -INT16_C( 15902), -INT16_C( 14870), -INT16_C( 22048), -INT16_C( 25610), -INT16_C( 19030),  INT16_C( 19916),  INT16_C( 32011),  INT16_C( 26809),
+         INT16_C( 13870),  INT16_C( 30268),  INT16_C( 10168), -INT16_C( 30375), -INT16_C( 27018),  INT16_C( 17229),  INT16_C( 19215), -INT16_C( 31903) },
+      { -INT16_C( 26821),  INT16_C( 11208),  INT16_C( 31945), -INT16_C( 21542), -INT16_C( 14870), -INT16_C( 25610),  INT16_C( 30268), -INT16_C( 27018),
+         INT16_C( 17229), -INT16_C( 31903),  INT16_C( 30810), -INT16_C(  1972),  INT16_C( 15063),  INT16_C( 27658),  INT16_C(  6036), -INT16_C( 19109),
+        -INT16_C( 26166),  INT16_C(  8824), -INT16_C( 30108), -INT16_C(  1387),  INT16_C( 18711),  INT16_C(  4779), -INT16_C( 18850), -INT16_C(  9407),
+        -INT16_C(  8118), -INT16_C(  1819),  INT16_C(  1735),  INT16_C( 25712), -INT16_C(  9794), -INT16_C( 14964), -INT16_C(  7188),  INT16_C( 24454) } },
+    { {  INT16_C( 12949), -INT16_C(  5706),  INT16_C( 32322),  INT16_C( 22476),  INT16_C( 15571),  INT16_C(  4564), -INT16_C( 24337),  INT16_C( 13989),
+         INT16_C(  6090),  INT16_C( 29877),  INT16_C( 12204),  INT16_C(  1165), -INT16_C(  1106),  INT16_C( 10352), -INT16_C(  8076),  INT16_C( 26885),
+        -INT16_C( 13633), -INT16_C( 32035), -INT16_C( 18265), -INT16_C(  1827),  INT16_C( 31937), -INT16_C(  1118),  INT16_C( 26020),  INT16_C( 23237),
+        -INT16_C(   126),  INT16_C( 21428), -INT16_C( 21171),  INT16_C( 17850), -INT16_C(  9083),  INT16_C(  3839),  INT16_C( 27052),  INT16_C( 30863) },
+      UINT32_C(2549430075),
+      { -INT16_C( 23540), -INT16_C(  1319), -INT16_C( 14719),  INT16_C(  5273), -INT16_C( 12180), -INT16_C( 19323),  INT16_C( 20307), -INT16_C( 13481),
+        -INT16_C(  8126),  INT16_C( 29935),  INT16_C( 27646), -INT16_C(  6813),  INT16_C(   962), -INT16_C( 14705),  INT16_C( 17643), -INT16_C(  4520),
+         INT16_C( 14009),  INT16_C( 18984),  INT16_C(  7614),  INT16_C( 10443), -INT16_C( 14946),  INT16_C(  9816),  INT16_C( 30292), -INT16_C( 20914),
+        -INT16_C( 29915),  INT16_C(  6036),  INT16_C(  6801), -INT16_C( 11210), -INT16_C(  7463),  INT16_C(  1727),  INT16_C(  9802), -INT16_C( 19538) },
+      { -INT16_C( 23540), -INT16_C(  1319),  INT16_C(  5273), -INT16_C( 12180), -INT16_C( 19323), -INT16_C(  8126),  INT16_C( 29935),  INT16_C( 27646),
+         INT16_C(   962), -INT16_C( 14705),  INT16_C( 14009),  INT16_C(  7614), -INT16_C( 14946),  INT16_C(  9816),  INT16_C( 30292), -INT16_C( 20914),
+        -INT16_C( 29915),  INT16_C(  6036),  INT16_C(  6801), -INT16_C(  7463), -INT16_C( 19538), -INT16_C(  1118),  INT16_C( 26020),  INT16_C( 23237),
+        -INT16_C(   126),  INT16_C( 21428), -INT16_C( 21171),  INT16_C( 17850), -INT16_C(  9083),  INT16_C(  3839),  INT16_C( 27052),  INT16_C( 30863) } },
+    { {  INT16_C(  2472), -INT16_C( 31059), -INT16_C( 27989),  INT16_C( 25227),  INT16_C(  8144), -INT16_C( 28451),  INT16_C( 12139), -INT16_C( 25799),
+         INT16_C( 17880),  INT16_C( 30439), -INT16_C( 21106),  INT16_C(  3990),  INT16_C( 26855), -INT16_C( 30146), -INT16_C( 22177),  INT16_C(  2032),
+         INT16_C( 18139),  INT16_C( 15448), -INT16_C( 29222), -INT16_C(  4640), -INT16_C(  9280),  INT16_C( 20878),  INT16_C( 12649), -INT16_C( 23771),
+        -INT16_C(  7642), -INT16_C( 12999), -INT16_C( 18368), -INT16_C( 21641), -INT16_C(  6682), -INT16_C(  4170), -INT16_C( 25130), -INT16_C( 11156) },
+      UINT32_C(2641070394),
+      {  INT16_C( 31003), -INT16_C( 27519), -INT16_C( 32539),  INT16_C(  1875),  INT16_C(  2767), -INT16_C(  4576),  INT16_C( 20815),  INT16_C( 16515),
+         INT16_C(  3198), -INT16_C( 19924), -INT16_C(  6525),  INT16_C( 10991),  INT16_C( 26072), -INT16_C( 28425),  INT16_C(  8487),  INT16_C( 10493),
+         INT16_C( 27558), -INT16_C( 31091),  INT16_C( 24947), -INT16_C( 25305), -INT16_C( 22016), -INT16_C(  6467),  INT16_C( 20185), -INT16_C( 23640),
+         INT16_C( 29082),  INT16_C(  5967), -INT16_C( 23295), -INT16_C(  9282),  INT16_C( 31720), -INT16_C( 31001),  INT16_C( 14125), -INT16_C(  1809) },
+      { -INT16_C( 27519),  INT16_C(  1875),  INT16_C(  2767), -INT16_C(  4576),  INT16_C(  3198),  INT16_C( 10991),  INT16_C( 10493),  INT16_C( 27558),
+        -INT16_C( 31091), -INT16_C( 25305), -INT16_C(  6467),  INT16_C( 20185),  INT16_C( 29082), -INT16_C( 23295), -INT16_C(  9282),  INT16_C( 31720),
+        -INT16_C(  1809),  INT16_C( 15448), -INT16_C( 29222), -INT16_C(  4640), -INT16_C(  9280),  INT16_C( 20878),  INT16_C( 12649), -INT16_C( 23771),
+        -INT16_C(  7642), -INT16_C( 12999), -INT16_C( 18368), -INT16_C( 21641), -INT16_C(  6682), -INT16_C(  4170), -INT16_C( 25130), -INT16_C( 11156) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi16(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_compress_epi16(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x32(r, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_compressstoreu_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int8_t a[16];
+    const int8_t r[16];
+  } test_vec[] = {
+    { UINT16_C(    0),
+      {  INT8_C( 124),  INT8_C(  52),  INT8_C(  88),  INT8_C(  52), -INT8_C( 102), -INT8_C( 121),  INT8_C(  10),  INT8_C( 100),
+         INT8_C(  12),  INT8_C( 116),  INT8_C(   2), -INT8_C(  70), -INT8_C(  93),  INT8_C(  24), -INT8_C( 126),  INT8_C( 111) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(65535),
+      { -INT8_C( 100), -INT8_C(  89),  INT8_C(  40),  INT8_C(  48),  INT8_C( 122), -INT8_C(  74),  INT8_C(  99),  INT8_C(  63),
+         INT8_C( 127),  INT8_C( 101), -INT8_C(  35), -INT8_C(  48), -INT8_C(  65),  INT8_C(  50), -INT8_C(  70), -INT8_C(  15) },
+      { -INT8_C( 100), -INT8_C(  89),  INT8_C(  40),  INT8_C(  48),  INT8_C( 122), -INT8_C(  74),  INT8_C(  99),  INT8_C(  63),
+         INT8_C( 127),  INT8_C( 101), -INT8_C(  35), -INT8_C(  48), -INT8_C(  65),  INT8_C(  50), -INT8_C(  70), -INT8_C(  15) } },
+    { UINT16_C(44383),
+      { -INT8_C(  59),  INT8_C(  74), -INT8_C(  28), -INT8_C( 111),  INT8_C(  20), -INT8_C(  12),  INT8_C(  99),  INT8_C(  57),
+        -INT8_C( 119),  INT8_C(  58),  INT8_C( 120), -INT8_C(  92), -INT8_C(  65),  INT8_C( 106), -INT8_C(  68), -INT8_C(  19) },
+      { -INT8_C(  59),  INT8_C(  74), -INT8_C(  28), -INT8_C( 111),  INT8_C(  20),  INT8_C(  99), -INT8_C( 119),  INT8_C( 120),
+        -INT8_C(  92),  INT8_C( 106), -INT8_C(  19),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(64902),
+      { -INT8_C(   3), -INT8_C(  46),  INT8_C(  79), -INT8_C(  85),  INT8_C( 104),  INT8_C(  36), -INT8_C(  72), -INT8_C( 119),
+         INT8_C( 110), -INT8_C( 116),  INT8_C( 119), -INT8_C(  19), -INT8_C(  54), -INT8_C(  31), -INT8_C(   6),  INT8_C(  85) },
+      { -INT8_C(  46),  INT8_C(  79), -INT8_C( 119),  INT8_C( 110),  INT8_C( 119), -INT8_C(  19), -INT8_C(  54), -INT8_C(  31),
+        -INT8_C(   6),  INT8_C(  85),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(51666),
+      { -INT8_C(  63),  INT8_C(  76), -INT8_C(  76),  INT8_C( 121), -INT8_C(  63),  INT8_C(  22), -INT8_C( 102), -INT8_C(  61),
+         INT8_C( 106), -INT8_C(  46),  INT8_C(  35),  INT8_C(  31), -INT8_C( 107), -INT8_C(  26), -INT8_C( 121), -INT8_C(  26) },
+      {  INT8_C(  76), -INT8_C(  63), -INT8_C( 102), -INT8_C(  61),  INT8_C( 106),  INT8_C(  31), -INT8_C( 121), -INT8_C(  26),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(37754),
+      { -INT8_C(  36),  INT8_C(  17),  INT8_C(  35),  INT8_C( 109),  INT8_C(  77), -INT8_C(  67), -INT8_C(  60), -INT8_C(  75),
+         INT8_C(  56),  INT8_C(  44), -INT8_C( 104), -INT8_C(  53),  INT8_C(  94),  INT8_C( 114), -INT8_C(  54),  INT8_C( 103) },
+      {  INT8_C(  17),  INT8_C( 109),  INT8_C(  77), -INT8_C(  67), -INT8_C(  60),  INT8_C(  56),  INT8_C(  44),  INT8_C(  94),
+         INT8_C( 103),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C( 7529),
+      {  INT8_C(  19), -INT8_C(  59),  INT8_C( 108),  INT8_C(  10),  INT8_C(  30),  INT8_C( 116), -INT8_C(   4),  INT8_C(  57),
+        -INT8_C(  67), -INT8_C(  94),  INT8_C(   3),  INT8_C(  17), -INT8_C(  17), -INT8_C(  48),  INT8_C(   3), -INT8_C(  57) },
+      {  INT8_C(  19),  INT8_C(  10),  INT8_C( 116), -INT8_C(   4), -INT8_C(  67),  INT8_C(   3),  INT8_C(  17), -INT8_C(  17),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(38958),
+      { -INT8_C(  98), -INT8_C(  25),  INT8_C(  36), -INT8_C(   2), -INT8_C( 103),  INT8_C( 112),  INT8_C( 104), -INT8_C(  20),
+         INT8_C(  37),  INT8_C( 127),  INT8_C(  61),  INT8_C(  45),  INT8_C(  49),  INT8_C(  11),  INT8_C(  75),  INT8_C( 125) },
+      { -INT8_C(  25),  INT8_C(  36), -INT8_C(   2),  INT8_C( 112),  INT8_C(  45),  INT8_C(  49),  INT8_C( 125),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    int8_t r[16] = { 0, };
+    simde_mm_mask_compressstoreu_epi8(r, test_vec[i].k, a);
+    simde_assert_equal_vi8(16, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_compressstoreu_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t r[8];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { -INT16_C( 25271), -INT16_C( 16884),  INT16_C( 25837),  INT16_C(    58),  INT16_C(  5010), -INT16_C( 26401), -INT16_C(  5829),  INT16_C( 23446) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(255),
+      {  INT16_C(  8628), -INT16_C( 12065),  INT16_C(  7445), -INT16_C( 32453),  INT16_C( 24134),  INT16_C( 26070),  INT16_C( 16531),  INT16_C( 14404) },
+      {  INT16_C(  8628), -INT16_C( 12065),  INT16_C(  7445), -INT16_C( 32453),  INT16_C( 24134),  INT16_C( 26070),  INT16_C( 16531),  INT16_C( 14404) } },
+    { UINT8_C( 93),
+      { -INT16_C(  2831),  INT16_C(  9987), -INT16_C( 15607), -INT16_C( 27728),  INT16_C( 30292), -INT16_C( 13270), -INT16_C( 23351), -INT16_C( 20689) },
+      { -INT16_C(  2831), -INT16_C( 15607), -INT16_C( 27728),  INT16_C( 30292), -INT16_C( 23351),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(159),
+      {  INT16_C( 17872),  INT16_C( 31501), -INT16_C(  2919), -INT16_C( 21885), -INT16_C( 13955), -INT16_C(  4160),  INT16_C( 12854), -INT16_C(  5512) },
+      {  INT16_C( 17872),  INT16_C( 31501), -INT16_C(  2919), -INT16_C( 21885), -INT16_C( 13955), -INT16_C(  5512),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(147),
+      {  INT16_C(   558),  INT16_C(  7650),  INT16_C( 31887), -INT16_C(  8140),  INT16_C( 29335),  INT16_C( 22414),  INT16_C( 12419), -INT16_C( 14848) },
+      {  INT16_C(   558),  INT16_C(  7650),  INT16_C( 29335), -INT16_C( 14848),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C( 12),
+      { -INT16_C( 24598), -INT16_C( 15772), -INT16_C( 20191), -INT16_C( 16464),  INT16_C( 23102), -INT16_C( 17844), -INT16_C( 20105),  INT16_C( 31200) },
+      { -INT16_C( 20191), -INT16_C( 16464),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(110),
+      { -INT16_C( 29782), -INT16_C(  4184),  INT16_C( 22068), -INT16_C(  6600), -INT16_C( 12597),  INT16_C(  2369), -INT16_C(  9493), -INT16_C(  3849) },
+      { -INT16_C(  4184),  INT16_C( 22068), -INT16_C(  6600),  INT16_C(  2369), -INT16_C(  9493),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(103),
+      {  INT16_C( 16643),  INT16_C(  6929), -INT16_C( 12951),  INT16_C(  4522),  INT16_C( 27963), -INT16_C(  5893),  INT16_C(  9525),  INT16_C( 15541) },
+      {  INT16_C( 16643),  INT16_C(  6929), -INT16_C( 12951), -INT16_C(  5893),  INT16_C(  9525),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    int16_t r[8] = { 0, };
+    simde_mm_mask_compressstoreu_epi16(r, test_vec[i].k, a);
+    simde_assert_equal_vi16(8, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_compressstoreu_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 k;
+    const int8_t a[32];
+    const int8_t r[32];
+  } test_vec[] = {
+    { UINT32_C(         0),
+      {  INT8_C(  24),  INT8_C(  34), -INT8_C( 124), -INT8_C(  15),  INT8_C( 118), -INT8_C(  20),  INT8_C( 119),  INT8_C(  73),
+        -INT8_C( 105), -INT8_C(  52), -INT8_C(  89), -INT8_C(  56),  INT8_C(  83),  INT8_C(  29),  INT8_C(  19), -INT8_C(  99),
+         INT8_C(  16),  INT8_C(  90),  INT8_C( 112),  INT8_C(  40), -INT8_C(  34),  INT8_C(  89),  INT8_C(  83), -INT8_C(   5),
+         INT8_C(   0), -INT8_C(  52), -INT8_C(  49), -INT8_C(  46),  INT8_C(  93),  INT8_C( 123),  INT8_C( 127),  INT8_C(  49) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(4294967295),
+      {  INT8_C(  23), -INT8_C(  89),  INT8_C(  36), -INT8_C(  10),  INT8_C(  93), -INT8_C(  75),  INT8_C(  52), -INT8_C(  52),
+         INT8_C(  49), -INT8_C(  57), -INT8_C( 124),  INT8_C(  13), -INT8_C(  79), -INT8_C( 122), -INT8_C( 117),  INT8_C(  52),
+        -INT8_C(  56),  INT8_C(   1), -INT8_C(  77), -INT8_C(  80),  INT8_C(  41),  INT8_C(  41), -INT8_C(  61), -INT8_C(  30),
+         INT8_C(  29),  INT8_C(  57), -INT8_C( 107), -INT8_C(  26),  INT8_C(   7), -INT8_C(   3), -INT8_C( 106), -INT8_C(  31) },
+      {  INT8_C(  23), -INT8_C(  89),  INT8_C(  36), -INT8_C(  10),  INT8_C(  93), -INT8_C(  75),  INT8_C(  52), -INT8_C(  52),
+         INT8_C(  49), -INT8_C(  57), -INT8_C( 124),  INT8_C(  13), -INT8_C(  79), -INT8_C( 122), -INT8_C( 117),  INT8_C(  52),
+        -INT8_C(  56),  INT8_C(   1), -INT8_C(  77), -INT8_C(  80),  INT8_C(  41),  INT8_C(  41), -INT8_C(  61), -INT8_C(  30),
+         INT8_C(  29),  INT8_C(  57), -INT8_C( 107), -INT8_C(  26),  INT8_C(   7), -INT8_C(   3), -INT8_C( 106), -INT8_C(  31) } },
+    { UINT32_C(3567772864),
+      {  INT8_C(   9),  INT8_C( 127), -INT8_C(  69),  INT8_C(  50), -INT8_C(   2),  INT8_C(  97), -INT8_C(  93),  INT8_C(  60),
+         INT8_C(  40),  INT8_C( 106),  INT8_C(  86),  INT8_C(  76), -INT8_C( 124),  INT8_C(  51),  INT8_C(  79), -INT8_C( 111),
+         INT8_C(   2), -INT8_C( 106), -INT8_C(  23),  INT8_C(  86), -INT8_C(  30),  INT8_C(  17), -INT8_C(  55), -INT8_C(  22),
+        -INT8_C(   9), -INT8_C(  86), -INT8_C(  35),  INT8_C(  64), -INT8_C(  54),  INT8_C(  83), -INT8_C(   9),  INT8_C(   8) },
+      { -INT8_C(  93),  INT8_C(  60),  INT8_C(  86),  INT8_C(  51),  INT8_C(  79), -INT8_C( 111),  INT8_C(   2), -INT8_C( 106),
+        -INT8_C(  23),  INT8_C(  17), -INT8_C(  22), -INT8_C(  35), -INT8_C(  54), -INT8_C(   9),  INT8_C(   8),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(1971550108),
+      {  INT8_C( 115), -INT8_C(  97),  INT8_C(  10), -INT8_C(  54),  INT8_C( 115), -INT8_C(  99),  INT8_C( 102), -INT8_C(  24),
+         INT8_C(  39), -INT8_C(  79), -INT8_C(  68),  INT8_C(  35),  INT8_C(  15),  INT8_C( 117), -INT8_C(   5), -INT8_C(   4),
+         INT8_C(  33),  INT8_C(   5),  INT8_C(  65), -INT8_C( 111), -INT8_C( 116),  INT8_C(  49),  INT8_C( 125),  INT8_C(  23),
+         INT8_C(  73),  INT8_C(  79), -INT8_C(  75), -INT8_C(  64), -INT8_C(  21), -INT8_C(  30),  INT8_C(  93), -INT8_C(  15) },
+      {  INT8_C(  10), -INT8_C(  54),  INT8_C( 115), -INT8_C(  24),  INT8_C(  39), -INT8_C(  79), -INT8_C(  68),  INT8_C(  15),
+         INT8_C( 117), -INT8_C(   5),  INT8_C(  33),  INT8_C(   5),  INT8_C(  23),  INT8_C(  73), -INT8_C(  75), -INT8_C(  21),
+        -INT8_C(  30),  INT8_C(  93),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(1685810391),
+      { -INT8_C(  50), -INT8_C(  47), -INT8_C(  48), -INT8_C( 125),  INT8_C(  50),  INT8_C(  52), -INT8_C(  48),  INT8_C(  57),
+        -INT8_C(  59), -INT8_C( 114), -INT8_C(  87), -INT8_C(  72), -INT8_C(  83),  INT8_C(  48), -INT8_C(   6),  INT8_C( 103),
+         INT8_C( 101),  INT8_C( 123), -INT8_C(   3),  INT8_C(  72), -INT8_C(  48), -INT8_C(  59), -INT8_C(  26),  INT8_C(  53),
+        -INT8_C( 121),  INT8_C(   8),  INT8_C( 126), -INT8_C(  50), -INT8_C(  11),  INT8_C(  44), -INT8_C(  58),  INT8_C(  35) },
+      { -INT8_C(  50), -INT8_C(  47), -INT8_C(  48),  INT8_C(  50), -INT8_C(  48),  INT8_C(  57), -INT8_C(  87), -INT8_C(  72),
+         INT8_C(  48), -INT8_C(   6),  INT8_C( 101),  INT8_C( 123),  INT8_C(  72), -INT8_C(  48), -INT8_C(  59), -INT8_C(  26),
+         INT8_C( 126),  INT8_C(  44), -INT8_C(  58),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(3264034413),
+      {  INT8_C(  65),  INT8_C(  47),  INT8_C(   9),  INT8_C(  95), -INT8_C(  47),  INT8_C(  26),  INT8_C( 118),  INT8_C(  22),
+         INT8_C(  20), -INT8_C(  14),  INT8_C(  73), -INT8_C(  91), -INT8_C( 100), -INT8_C( 123), -INT8_C( 104), -INT8_C(  61),
+        -INT8_C( 120),  INT8_C( 123),  INT8_C(  87), -INT8_C( 113), -INT8_C( 104), -INT8_C(  79), -INT8_C(  90),  INT8_C(  55),
+         INT8_C(   1),  INT8_C(  47), -INT8_C(  13),  INT8_C(   6), -INT8_C( 106), -INT8_C(  39), -INT8_C(  86), -INT8_C( 115) },
+      {  INT8_C(  65),  INT8_C(   9),  INT8_C(  95),  INT8_C(  26),  INT8_C( 118), -INT8_C(  14),  INT8_C(  73), -INT8_C( 100),
+        -INT8_C( 123), -INT8_C( 120),  INT8_C(  87), -INT8_C( 113),  INT8_C(  55),  INT8_C(  47), -INT8_C(  86), -INT8_C( 115),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(2329271634),
+      {  INT8_C( 104), -INT8_C(  84),  INT8_C( 105),  INT8_C(  23),  INT8_C(  45),  INT8_C(   5), -INT8_C(   3),  INT8_C(  12),
+        -INT8_C(  94), -INT8_C(   5),  INT8_C( 100), -INT8_C( 120),  INT8_C(  31), -INT8_C( 117),  INT8_C( 126), -INT8_C(  32),
+         INT8_C(   7),  INT8_C( 121),  INT8_C(  61), -INT8_C(  41), -INT8_C(   8),  INT8_C( 111), -INT8_C(  15),  INT8_C(  22),
+        -INT8_C(  62), -INT8_C(  85), -INT8_C(  20), -INT8_C(  99),  INT8_C(   4),  INT8_C(  76),  INT8_C( 108),  INT8_C( 122) },
+      { -INT8_C(  84),  INT8_C(  45), -INT8_C(   3), -INT8_C(  94),  INT8_C( 100), -INT8_C( 120),  INT8_C(  31),  INT8_C( 126),
+        -INT8_C(  32),  INT8_C(   7),  INT8_C(  61), -INT8_C(   8), -INT8_C(  15),  INT8_C(  22), -INT8_C(  85), -INT8_C(  99),
+         INT8_C( 122),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(3036109257),
+      {  INT8_C(  58),  INT8_C( 112), -INT8_C(  80),  INT8_C(  95),  INT8_C(  53), -INT8_C(  99),  INT8_C( 122), -INT8_C(  62),
+         INT8_C(  79),  INT8_C(   9), -INT8_C(  25),  INT8_C(  98), -INT8_C(  74), -INT8_C(  43),  INT8_C( 102),  INT8_C( 120),
+        -INT8_C(  76),  INT8_C(  53), -INT8_C(  25),  INT8_C(  94),  INT8_C(  76), -INT8_C(  74), -INT8_C(  73),  INT8_C(  32),
+         INT8_C(  22),  INT8_C(  30), -INT8_C(  52),  INT8_C( 103), -INT8_C(  71),      INT8_MIN,  INT8_C(  21), -INT8_C(  99) },
+      {  INT8_C(  58),  INT8_C(  95),  INT8_C( 122), -INT8_C(  62),  INT8_C(  79),  INT8_C(  98), -INT8_C(  74),  INT8_C( 102),
+        -INT8_C(  76),  INT8_C(  53), -INT8_C(  25),  INT8_C(  76), -INT8_C(  74), -INT8_C(  73),  INT8_C(  32), -INT8_C(  52),
+        -INT8_C(  71),      INT8_MIN, -INT8_C(  99),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    int8_t r[32] = { 0, };
+    simde_mm256_mask_compressstoreu_epi8(r, test_vec[i].k, a);
+    simde_assert_equal_vi8(32, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_compressstoreu_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int16_t a[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    { UINT16_C(    0),
+      {  INT16_C( 23843),  INT16_C( 25907),  INT16_C( 31403),  INT16_C(  9274), -INT16_C( 11814),  INT16_C( 25644), -INT16_C( 29662),  INT16_C( 20189),
+         INT16_C(  3112), -INT16_C( 14882),  INT16_C( 10756),  INT16_C( 27730), -INT16_C( 28162),  INT16_C(    60), -INT16_C( 18464),  INT16_C(   558) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(65535),
+      {  INT16_C( 16470), -INT16_C(  7760),  INT16_C( 24632),  INT16_C(  9122),  INT16_C(  9365), -INT16_C(  7198),  INT16_C(  5590),  INT16_C(  7367),
+        -INT16_C( 12872),  INT16_C(  6556), -INT16_C( 23229), -INT16_C(  8758), -INT16_C( 24176),  INT16_C( 31800), -INT16_C( 11884),  INT16_C( 31128) },
+      {  INT16_C( 16470), -INT16_C(  7760),  INT16_C( 24632),  INT16_C(  9122),  INT16_C(  9365), -INT16_C(  7198),  INT16_C(  5590),  INT16_C(  7367),
+        -INT16_C( 12872),  INT16_C(  6556), -INT16_C( 23229), -INT16_C(  8758), -INT16_C( 24176),  INT16_C( 31800), -INT16_C( 11884),  INT16_C( 31128) } },
+    { UINT16_C(64756),
+      { -INT16_C( 19187), -INT16_C(  8614), -INT16_C( 31881),  INT16_C(  5124),  INT16_C( 12198), -INT16_C( 30493),  INT16_C( 17153), -INT16_C( 17075),
+         INT16_C( 23074), -INT16_C( 23594),  INT16_C( 29112), -INT16_C( 31907),  INT16_C( 21442), -INT16_C( 28465), -INT16_C( 11123),  INT16_C( 18705) },
+      { -INT16_C( 31881),  INT16_C( 12198), -INT16_C( 30493),  INT16_C( 17153), -INT16_C( 17075),  INT16_C( 29112), -INT16_C( 31907),  INT16_C( 21442),
+        -INT16_C( 28465), -INT16_C( 11123),  INT16_C( 18705),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(58890),
+      { -INT16_C(   954), -INT16_C( 26981),  INT16_C(  5389),  INT16_C(   149),  INT16_C( 18460), -INT16_C( 28180),  INT16_C( 10256),  INT16_C( 10348),
+         INT16_C( 22598), -INT16_C( 14286), -INT16_C( 32589), -INT16_C( 19237), -INT16_C( 26855),  INT16_C( 16328), -INT16_C( 20653),  INT16_C( 30824) },
+      { -INT16_C( 26981),  INT16_C(   149), -INT16_C( 14286), -INT16_C( 32589),  INT16_C( 16328), -INT16_C( 20653),  INT16_C( 30824),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(41101),
+      {  INT16_C(  4492), -INT16_C( 11451), -INT16_C(  2964), -INT16_C( 31361),  INT16_C(  9628), -INT16_C( 23797), -INT16_C( 17506),  INT16_C( 27652),
+        -INT16_C(  9700), -INT16_C(  3247),  INT16_C(   556),  INT16_C( 16362), -INT16_C( 26263),  INT16_C( 13352), -INT16_C( 21034), -INT16_C(  6716) },
+      {  INT16_C(  4492), -INT16_C(  2964), -INT16_C( 31361),  INT16_C( 27652),  INT16_C( 13352), -INT16_C(  6716),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(11577),
+      {  INT16_C(  6435),  INT16_C( 10983), -INT16_C( 32658),  INT16_C( 10383), -INT16_C(  9804),  INT16_C( 11316),  INT16_C(  5652), -INT16_C( 17874),
+         INT16_C(   723),  INT16_C( 23038), -INT16_C(  4911),  INT16_C(   221),  INT16_C( 10112), -INT16_C( 31369), -INT16_C(  2506), -INT16_C(  3279) },
+      {  INT16_C(  6435),  INT16_C( 10383), -INT16_C(  9804),  INT16_C( 11316),  INT16_C(   723), -INT16_C(  4911),  INT16_C(   221), -INT16_C( 31369),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(63230),
+      {  INT16_C( 32403), -INT16_C( 21498), -INT16_C( 12071), -INT16_C(  5925),  INT16_C( 22747), -INT16_C( 13922),  INT16_C(  3064), -INT16_C( 14057),
+         INT16_C( 29802),  INT16_C( 15432),  INT16_C(  9268),  INT16_C( 16856), -INT16_C( 29011),  INT16_C( 24749),  INT16_C( 16868),  INT16_C(  8327) },
+      { -INT16_C( 21498), -INT16_C( 12071), -INT16_C(  5925),  INT16_C( 22747), -INT16_C( 13922),  INT16_C(  3064), -INT16_C( 14057),  INT16_C( 15432),
+         INT16_C(  9268), -INT16_C( 29011),  INT16_C( 24749),  INT16_C( 16868),  INT16_C(  8327),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(47188),
+      { -INT16_C(  6108),  INT16_C( 19175),  INT16_C(  1924), -INT16_C( 26787), -INT16_C( 11336),  INT16_C(  6728), -INT16_C(  4094), -INT16_C( 22697),
+         INT16_C( 14816),  INT16_C(  1769),  INT16_C(  5126),  INT16_C( 12372), -INT16_C( 22974),  INT16_C( 18635),  INT16_C( 27638), -INT16_C( 32403) },
+      {  INT16_C(  1924), -INT16_C( 11336), -INT16_C(  4094),  INT16_C( 12372), -INT16_C( 22974),  INT16_C( 18635), -INT16_C( 32403),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    int16_t r[16] = { 0, };
+    simde_mm256_mask_compressstoreu_epi16(r, test_vec[i].k, a);
+    simde_assert_equal_vi16(16, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_compressstoreu_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 k;
+    const int8_t a[64];
+    const int8_t r[64];
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      {  INT8_C(  78), -INT8_C(  50), -INT8_C(  25),  INT8_C(   0), -INT8_C(  58),  INT8_C(  89), -INT8_C(   9),  INT8_C(  76),
+        -INT8_C(  70), -INT8_C( 109),  INT8_C(  24),  INT8_C(  94),  INT8_C(  10), -INT8_C(  52), -INT8_C(  15), -INT8_C( 126),
+        -INT8_C( 113), -INT8_C( 110),  INT8_C( 107),  INT8_C( 101), -INT8_C(  51),  INT8_C(  98),  INT8_C(   4), -INT8_C(  34),
+        -INT8_C(  91), -INT8_C(  12),  INT8_C( 125),  INT8_C(  17), -INT8_C(   5), -INT8_C(  94), -INT8_C( 119),  INT8_C(  94),
+         INT8_C( 118),  INT8_C(  16),  INT8_C(  52),  INT8_C(  24),  INT8_C(  26),  INT8_C( 116), -INT8_C(  34),  INT8_C( 127),
+        -INT8_C(   1), -INT8_C(  38),  INT8_C(  11), -INT8_C(  43),  INT8_C(  46),  INT8_C(  86), -INT8_C(  88),  INT8_C(  75),
+        -INT8_C(  71),  INT8_C(  12), -INT8_C( 122),  INT8_C(  55),  INT8_C(  37),  INT8_C(  87),  INT8_C(  53),  INT8_C(  89),
+         INT8_C(  77), -INT8_C(  11),  INT8_C(  88),  INT8_C( 104), -INT8_C( 118),  INT8_C(   5), -INT8_C( 113), -INT8_C( 100) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C(18446744073709551615),
+      { -INT8_C(  48), -INT8_C(  41),  INT8_C( 106), -INT8_C(  86),  INT8_C(  39),  INT8_C(  89), -INT8_C(  29), -INT8_C(  86),
+        -INT8_C(   9),  INT8_C(  40),  INT8_C(  16), -INT8_C(  64),  INT8_C(   7),  INT8_C(  27),  INT8_C(  69), -INT8_C(   5),
+         INT8_C(  98),  INT8_C(  38), -INT8_C(  44),  INT8_C(  67),  INT8_C(  51),  INT8_C(  73), -INT8_C(  33),  INT8_C( 122),
+         INT8_C(  16), -INT8_C(  92), -INT8_C(  27),  INT8_C(  48),  INT8_C(  40),  INT8_C(  74), -INT8_C(  58),  INT8_C(  15),
+        -INT8_C( 115),  INT8_C(  88),  INT8_C(  88),  INT8_C( 116), -INT8_C( 102), -INT8_C( 119), -INT8_C(  54), -INT8_C(   3),
+         INT8_C(  74), -INT8_C( 122), -INT8_C(  97),  INT8_C(  96), -INT8_C( 108), -INT8_C(  69), -INT8_C(  36), -INT8_C(  91),
+        -INT8_C(  70),  INT8_C(   3),  INT8_C(  11), -INT8_C(  81), -INT8_C(  70),  INT8_C( 107), -INT8_C(  41),  INT8_C( 108),
+         INT8_C(  14), -INT8_C(  52),  INT8_C(   3),  INT8_C(  95), -INT8_C(  75), -INT8_C(  58),  INT8_C(  21), -INT8_C( 105) },
+      { -INT8_C(  48), -INT8_C(  41),  INT8_C( 106), -INT8_C(  86),  INT8_C(  39),  INT8_C(  89), -INT8_C(  29), -INT8_C(  86),
+        -INT8_C(   9),  INT8_C(  40),  INT8_C(  16), -INT8_C(  64),  INT8_C(   7),  INT8_C(  27),  INT8_C(  69), -INT8_C(   5),
+         INT8_C(  98),  INT8_C(  38), -INT8_C(  44),  INT8_C(  67),  INT8_C(  51),  INT8_C(  73), -INT8_C(  33),  INT8_C( 122),
+         INT8_C(  16), -INT8_C(  92), -INT8_C(  27),  INT8_C(  48),  INT8_C(  40),  INT8_C(  74), -INT8_C(  58),  INT8_C(  15),
+        -INT8_C( 115),  INT8_C(  88),  INT8_C(  88),  INT8_C( 116), -INT8_C( 102), -INT8_C( 119), -INT8_C(  54), -INT8_C(   3),
+         INT8_C(  74), -INT8_C( 122), -INT8_C(  97),  INT8_C(  96), -INT8_C( 108), -INT8_C(  69), -INT8_C(  36), -INT8_C(  91),
+        -INT8_C(  70),  INT8_C(   3),  INT8_C(  11), -INT8_C(  81), -INT8_C(  70),  INT8_C( 107), -INT8_C(  41),  INT8_C( 108),
+         INT8_C(  14), -INT8_C(  52),  INT8_C(   3),  INT8_C(  95), -INT8_C(  75), -INT8_C(  58),  INT8_C(  21), -INT8_C( 105) } },
+    { UINT64_C( 6234768451215190767),
+      { -INT8_C(   6), -INT8_C(  31),  INT8_C(  72),  INT8_C(  44), -INT8_C(  32),  INT8_C( 109), -INT8_C( 117), -INT8_C(   8),
+         INT8_C(  11),  INT8_C( 117), -INT8_C(  29), -INT8_C(  42), -INT8_C(  75),  INT8_C(  98),  INT8_C( 104),  INT8_C( 102),
+        -INT8_C(  44),  INT8_C(   5),  INT8_C(  85), -INT8_C(  31), -INT8_C(  54),  INT8_C(  71),  INT8_C(  31), -INT8_C(  91),
+         INT8_C(  58),  INT8_C(  86), -INT8_C(   6),  INT8_C(   7),  INT8_C( 123),  INT8_C( 121), -INT8_C( 123),  INT8_C(  56),
+        -INT8_C(  26),  INT8_C(  19),  INT8_C(   1), -INT8_C(  83), -INT8_C(   8), -INT8_C( 105),  INT8_C(  56),  INT8_C(  40),
+         INT8_C(  56), -INT8_C( 102),  INT8_C(  45),  INT8_C(  81), -INT8_C( 115), -INT8_C(  60), -INT8_C(  57), -INT8_C(  40),
+         INT8_C(  91),  INT8_C(  97), -INT8_C(  77), -INT8_C(  72),  INT8_C(  79),  INT8_C( 107),  INT8_C(   3), -INT8_C(  35),
+         INT8_C(  64), -INT8_C( 100),  INT8_C(   5),  INT8_C(  15),  INT8_C(  61), -INT8_C(  97),  INT8_C( 118), -INT8_C(  18) },
+      { -INT8_C(   6), -INT8_C(  31),  INT8_C(  72),  INT8_C(  44),  INT8_C( 109), -INT8_C( 117), -INT8_C(   8),  INT8_C( 117),
+        -INT8_C(  42),  INT8_C(  98),  INT8_C( 104),  INT8_C(   5),  INT8_C(  85), -INT8_C(  31), -INT8_C(  54),  INT8_C(  71),
+         INT8_C(  31),  INT8_C(  58),  INT8_C(  86), -INT8_C(   6),  INT8_C(  56), -INT8_C(  26),  INT8_C(  19),  INT8_C(   1),
+        -INT8_C(  83), -INT8_C(   8),  INT8_C(  56),  INT8_C(  40),  INT8_C(  81), -INT8_C( 115), -INT8_C(  57),  INT8_C(  97),
+        -INT8_C(  77), -INT8_C(  35), -INT8_C( 100),  INT8_C(   5),  INT8_C(  61),  INT8_C( 118),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C(13484507868440541704),
+      {  INT8_C( 124),  INT8_C(  98), -INT8_C( 104),  INT8_C(  93), -INT8_C(  17),  INT8_C(  64), -INT8_C(  86),  INT8_C(   3),
+         INT8_C( 121), -INT8_C(   9), -INT8_C(   8), -INT8_C( 115), -INT8_C(  88),  INT8_C(  29),  INT8_C( 115), -INT8_C(  49),
+        -INT8_C( 112), -INT8_C(  37), -INT8_C( 112),  INT8_C( 121), -INT8_C( 111), -INT8_C(  72), -INT8_C(  43), -INT8_C(  48),
+         INT8_C(  67),  INT8_C(  57),  INT8_C(  95), -INT8_C(  11), -INT8_C(  52), -INT8_C(  73),  INT8_C( 120), -INT8_C(  24),
+         INT8_C(  67), -INT8_C(  11),  INT8_C( 102), -INT8_C(  52), -INT8_C(  23), -INT8_C(  60), -INT8_C( 115),  INT8_C(  78),
+        -INT8_C(   4),  INT8_C( 119),  INT8_C( 127), -INT8_C(  65), -INT8_C(  62), -INT8_C(  11), -INT8_C( 104), -INT8_C(  65),
+        -INT8_C(  88), -INT8_C(  95), -INT8_C(  32), -INT8_C(  81), -INT8_C(   8),  INT8_C(  45), -INT8_C(  71),  INT8_C(  32),
+         INT8_C(  88),  INT8_C(  14), -INT8_C(  72), -INT8_C(  39),  INT8_C(  20), -INT8_C( 112), -INT8_C(  47), -INT8_C(  34) },
+      {  INT8_C(  93), -INT8_C(   9), -INT8_C( 115), -INT8_C(  88),  INT8_C(  29), -INT8_C(  49), -INT8_C( 112), -INT8_C(  37),
+         INT8_C( 121), -INT8_C( 111), -INT8_C(  43),  INT8_C(  67),  INT8_C(  95), -INT8_C(  11), -INT8_C(  52),  INT8_C( 120),
+        -INT8_C(  11),  INT8_C( 102), -INT8_C(  23), -INT8_C(  60), -INT8_C( 115), -INT8_C(  65), -INT8_C(  62), -INT8_C(  65),
+        -INT8_C(  95),  INT8_C(  45),  INT8_C(  88),  INT8_C(  14), -INT8_C(  39),  INT8_C(  20), -INT8_C( 112), -INT8_C(  34),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C( 6175537064405545251),
+      { -INT8_C( 127),  INT8_C( 104), -INT8_C( 102),  INT8_C(  87),  INT8_C(  87), -INT8_C(  95),  INT8_C(  48),  INT8_C( 102),
+        -INT8_C( 124),  INT8_C(  71),  INT8_C(  55),  INT8_C(  93), -INT8_C(  29), -INT8_C(  26), -INT8_C(  97), -INT8_C(  12),
+        -INT8_C(  39),  INT8_C( 124),  INT8_C(  58), -INT8_C(   4),  INT8_C(  95),  INT8_C( 119),  INT8_C(  73),  INT8_C(  71),
+        -INT8_C(  73),  INT8_C(  26), -INT8_C(  78), -INT8_C(   5), -INT8_C( 106), -INT8_C(  37), -INT8_C(  10),  INT8_C(  31),
+         INT8_C(   5),  INT8_C(  27),  INT8_C(  75),  INT8_C(  63), -INT8_C(   3), -INT8_C(  80), -INT8_C(  27), -INT8_C(  62),
+        -INT8_C(   5),  INT8_C( 126),  INT8_C(  18),  INT8_C(  48),  INT8_C( 102), -INT8_C(  30), -INT8_C(  43),  INT8_C(  48),
+        -INT8_C(  32),  INT8_C(  37),  INT8_C( 121), -INT8_C(  27), -INT8_C( 100), -INT8_C(  85), -INT8_C(  84),  INT8_C( 105),
+         INT8_C(  75), -INT8_C(  43),  INT8_C(   0),  INT8_C(  80), -INT8_C(  70), -INT8_C(  69), -INT8_C( 102),  INT8_C(  29) },
+      { -INT8_C( 127),  INT8_C( 104), -INT8_C(  95), -INT8_C( 124), -INT8_C(  29), -INT8_C(  26), -INT8_C(  12),  INT8_C( 124),
+         INT8_C(  58),  INT8_C( 119), -INT8_C(  73), -INT8_C(  78), -INT8_C(   5), -INT8_C( 106),  INT8_C(  31),  INT8_C(   5),
+         INT8_C(  75),  INT8_C(  63), -INT8_C(   3), -INT8_C(  80),  INT8_C( 126),  INT8_C(  48), -INT8_C(  30), -INT8_C(  43),
+         INT8_C(  48), -INT8_C(  32),  INT8_C(  37), -INT8_C( 100), -INT8_C(  85),  INT8_C( 105),  INT8_C(  75),  INT8_C(   0),
+        -INT8_C(  70), -INT8_C( 102),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C(14723421599099046633),
+      {  INT8_C(  60), -INT8_C(  18), -INT8_C(  85),  INT8_C( 104), -INT8_C(  34), -INT8_C( 111),  INT8_C(  34), -INT8_C(  42),
+        -INT8_C(  17), -INT8_C(  44),  INT8_C(   1), -INT8_C(  79), -INT8_C(  16), -INT8_C( 117), -INT8_C(  46),  INT8_C( 113),
+         INT8_C(  93),  INT8_C(  99),  INT8_C(  91), -INT8_C(  23), -INT8_C(  90), -INT8_C(  93),  INT8_C(  38),  INT8_C(  46),
+             INT8_MIN,  INT8_C(  17), -INT8_C(  17), -INT8_C(  16),  INT8_C( 117),  INT8_C(  65),  INT8_C(  49),  INT8_C(  85),
+        -INT8_C(  73),  INT8_C(  88),  INT8_C(  46),  INT8_C(  96), -INT8_C(  10),  INT8_C(   3),  INT8_C( 121),  INT8_C(  89),
+         INT8_C(  57), -INT8_C(  71), -INT8_C(   2), -INT8_C(   5), -INT8_C( 114), -INT8_C(  83),  INT8_C(  42), -INT8_C(  34),
+         INT8_C(  49), -INT8_C(   5),  INT8_C(  68), -INT8_C(   6), -INT8_C( 121),  INT8_C(  80), -INT8_C(  16),  INT8_C( 101),
+         INT8_C(  17), -INT8_C(  15), -INT8_C(  96), -INT8_C(  41),  INT8_C(  92), -INT8_C(  86),  INT8_C(  75), -INT8_C( 103) },
+      {  INT8_C(  60),  INT8_C( 104), -INT8_C( 111),  INT8_C(  34), -INT8_C(  42), -INT8_C(  44), -INT8_C(  79), -INT8_C(  46),
+         INT8_C( 113),  INT8_C(  91), -INT8_C(  23), -INT8_C(  90),  INT8_C(  46), -INT8_C(  17),  INT8_C( 117),  INT8_C(  65),
+         INT8_C(  85), -INT8_C(  73),  INT8_C(  88),  INT8_C(  46),  INT8_C(  96),  INT8_C(   3),  INT8_C( 121),  INT8_C(  89),
+         INT8_C(  57), -INT8_C(   5), -INT8_C( 114),  INT8_C(  68), -INT8_C( 121), -INT8_C(  16), -INT8_C(  96), -INT8_C(  41),
+         INT8_C(  75), -INT8_C( 103),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C( 6147837526785875356),
+      {  INT8_C(  39),  INT8_C(  31),  INT8_C(  85), -INT8_C(  65), -INT8_C(  18), -INT8_C(   3), -INT8_C(  32), -INT8_C(  97),
+        -INT8_C(  54), -INT8_C(  23),  INT8_C(  64),  INT8_C(  60),  INT8_C(  36),  INT8_C(  60), -INT8_C(  50), -INT8_C(  35),
+         INT8_C(  66),  INT8_C(  24),  INT8_C( 112),  INT8_C(  58),  INT8_C(   4),  INT8_C(  12),      INT8_MIN,  INT8_C(  61),
+         INT8_C( 105), -INT8_C(  35),  INT8_C(  36),  INT8_C(   2),  INT8_C(  50), -INT8_C(  72),  INT8_C(  99),  INT8_C(  11),
+         INT8_C(  65),  INT8_C(  53),  INT8_C(  33), -INT8_C(  43),  INT8_C(  54), -INT8_C(  18),  INT8_C( 123), -INT8_C(  13),
+        -INT8_C(  14),  INT8_C(   9),  INT8_C(  33), -INT8_C(  33), -INT8_C(  84),  INT8_C(  79),  INT8_C(  73), -INT8_C( 127),
+        -INT8_C(  80), -INT8_C(  83), -INT8_C(  56),  INT8_C(  59), -INT8_C(  45),  INT8_C( 106),  INT8_C(  36), -INT8_C( 114),
+         INT8_C(  73), -INT8_C(  15), -INT8_C( 102), -INT8_C(  41),  INT8_C( 122), -INT8_C(  18),  INT8_C(  67), -INT8_C(  45) },
+      {  INT8_C(  85), -INT8_C(  65), -INT8_C(  18), -INT8_C(  97), -INT8_C(  54),  INT8_C(  64),  INT8_C(  60),  INT8_C(  36),
+        -INT8_C(  50),  INT8_C(  66),  INT8_C(  24),  INT8_C(  12),      INT8_MIN,  INT8_C(  61),  INT8_C(  50), -INT8_C(  72),
+         INT8_C(  99), -INT8_C(  43), -INT8_C(  18), -INT8_C(  13), -INT8_C(  14), -INT8_C( 127), -INT8_C(  80), -INT8_C(  45),
+         INT8_C(  36),  INT8_C(  73), -INT8_C( 102),  INT8_C( 122),  INT8_C(  67),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C(10111154629809707036),
+      {  INT8_C(  44),  INT8_C( 120), -INT8_C(  16),  INT8_C(  35),  INT8_C( 127), -INT8_C(  51), -INT8_C(  84),  INT8_C(  71),
+        -INT8_C(  61), -INT8_C(  84),  INT8_C( 113),  INT8_C(  75),  INT8_C(   3),  INT8_C(  91),  INT8_C( 117),  INT8_C(   7),
+        -INT8_C( 117),  INT8_C(  26), -INT8_C(  64), -INT8_C(  83), -INT8_C( 100), -INT8_C(  59),  INT8_C( 110), -INT8_C( 116),
+        -INT8_C(  79),  INT8_C(  72),  INT8_C(  62), -INT8_C(  88),  INT8_C(  95),  INT8_C( 109),  INT8_C(   7),  INT8_C( 105),
+         INT8_C(  99), -INT8_C(  45),  INT8_C(  34), -INT8_C(  96),  INT8_C(  57), -INT8_C(  87),  INT8_C(  40), -INT8_C(  22),
+        -INT8_C( 109),  INT8_C(  52),  INT8_C(  62),  INT8_C( 122),  INT8_C(  40), -INT8_C(  88),  INT8_C(  37),  INT8_C( 107),
+         INT8_C( 103), -INT8_C(  47),  INT8_C( 108), -INT8_C( 104), -INT8_C( 119),  INT8_C(  16),  INT8_C(  96),  INT8_C(  42),
+        -INT8_C(  68), -INT8_C(  47), -INT8_C(  10), -INT8_C(  91),  INT8_C(  46),  INT8_C(  70), -INT8_C(  48), -INT8_C( 111) },
+      { -INT8_C(  16),  INT8_C(  35),  INT8_C( 127),  INT8_C(  75),  INT8_C(   3),  INT8_C(   7),  INT8_C(  26), -INT8_C(  83),
+        -INT8_C( 100),  INT8_C( 110), -INT8_C( 116),  INT8_C(  72), -INT8_C(  88),  INT8_C( 105),  INT8_C(  57), -INT8_C(  22),
+        -INT8_C( 109),  INT8_C( 122), -INT8_C(  47), -INT8_C( 119),  INT8_C(  96), -INT8_C(  10), -INT8_C(  91), -INT8_C( 111),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    int8_t r[64] = { 0, };
+    simde_mm512_mask_compressstoreu_epi8(r, test_vec[i].k, a);
+    simde_assert_equal_vi8(64, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_compressstoreu_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 k;
+    const int16_t a[32];
+    const int16_t r[32];
+  } test_vec[] = {
+    { UINT32_C(         0),
+      { -INT16_C(  9353), -INT16_C( 32370), -INT16_C( 28686),  INT16_C(  6714),  INT16_C( 29698), -INT16_C( 27740),  INT16_C( 27038), -INT16_C(  9879),
+         INT16_C( 28784), -INT16_C( 10308), -INT16_C( 10156),  INT16_C(  7523), -INT16_C( 15661), -INT16_C(  4943), -INT16_C( 19839), -INT16_C( 32031),
+         INT16_C( 11065), -INT16_C( 18753),  INT16_C(  8373),  INT16_C( 22574),  INT16_C( 26096), -INT16_C( 12449),  INT16_C( 26168), -INT16_C(  4016),
+         INT16_C( 19107),  INT16_C(  7232),  INT16_C(  9824), -INT16_C(  4072),  INT16_C( 15177),  INT16_C( 22873),  INT16_C( 25735), -INT16_C(  7046) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(4294967295),
+      { -INT16_C( 25216), -INT16_C( 25022), -INT16_C( 28909),  INT16_C( 22640), -INT16_C(  5706),  INT16_C(  9304),  INT16_C(  1476), -INT16_C( 21129),
+         INT16_C( 11238),  INT16_C(  7399), -INT16_C(  8802), -INT16_C( 21036), -INT16_C( 24578),  INT16_C( 22034),  INT16_C( 13254),  INT16_C( 27973),
+         INT16_C( 25935),  INT16_C( 17723),  INT16_C(  4877),  INT16_C(  3749), -INT16_C( 30116), -INT16_C(  7003),  INT16_C(  4291), -INT16_C(  5128),
+         INT16_C( 26506), -INT16_C( 31079), -INT16_C( 23175),  INT16_C( 13810),  INT16_C( 21263),  INT16_C( 17141), -INT16_C(  5744), -INT16_C( 24550) },
+      { -INT16_C( 25216), -INT16_C( 25022), -INT16_C( 28909),  INT16_C( 22640), -INT16_C(  5706),  INT16_C(  9304),  INT16_C(  1476), -INT16_C( 21129),
+         INT16_C( 11238),  INT16_C(  7399), -INT16_C(  8802), -INT16_C( 21036), -INT16_C( 24578),  INT16_C( 22034),  INT16_C( 13254),  INT16_C( 27973),
+         INT16_C( 25935),  INT16_C( 17723),  INT16_C(  4877),  INT16_C(  3749), -INT16_C( 30116), -INT16_C(  7003),  INT16_C(  4291), -INT16_C(  5128),
+         INT16_C( 26506), -INT16_C( 31079), -INT16_C( 23175),  INT16_C( 13810),  INT16_C( 21263),  INT16_C( 17141), -INT16_C(  5744), -INT16_C( 24550) } },
+    { UINT32_C(2583657738),
+      {  INT16_C( 29296),  INT16_C( 23042),  INT16_C(  5118),  INT16_C( 22833),  INT16_C( 14149), -INT16_C(  1835),  INT16_C( 10521),  INT16_C( 27857),
+        -INT16_C( 28750),  INT16_C(  2640), -INT16_C( 16936),  INT16_C(  6146), -INT16_C( 30174), -INT16_C(  7375),  INT16_C( 13894), -INT16_C( 10788),
+         INT16_C( 12282), -INT16_C( 16027),  INT16_C( 17988),  INT16_C(  9660),  INT16_C( 24907),  INT16_C( 30045), -INT16_C(  5477), -INT16_C( 29323),
+         INT16_C( 13856),  INT16_C( 14850), -INT16_C(  1122),  INT16_C( 18404), -INT16_C( 16121), -INT16_C( 10716),  INT16_C(  5421), -INT16_C( 31485) },
+      {  INT16_C( 23042),  INT16_C( 22833), -INT16_C( 28750), -INT16_C( 16936),  INT16_C(  6146), -INT16_C( 30174), -INT16_C(  7375),  INT16_C( 13894),
+         INT16_C( 12282), -INT16_C( 16027),  INT16_C( 17988),  INT16_C(  9660),  INT16_C( 24907),  INT16_C( 30045), -INT16_C(  5477), -INT16_C( 29323),
+         INT16_C( 13856),  INT16_C( 18404), -INT16_C( 16121), -INT16_C( 31485),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(2561637522),
+      { -INT16_C( 22805),  INT16_C( 21259),  INT16_C( 27841), -INT16_C( 10820), -INT16_C( 18308), -INT16_C( 17211), -INT16_C( 22389),  INT16_C( 23869),
+         INT16_C( 20613),  INT16_C( 20904),  INT16_C( 29829), -INT16_C( 17400),  INT16_C(  5771), -INT16_C( 26154),  INT16_C( 27712),  INT16_C(   900),
+        -INT16_C( 32461), -INT16_C( 32678), -INT16_C( 24263),  INT16_C( 22424), -INT16_C( 17759),  INT16_C( 15079), -INT16_C( 19336),  INT16_C( 31551),
+        -INT16_C( 24845),  INT16_C( 10949), -INT16_C(    44), -INT16_C( 30104),  INT16_C(  3357),  INT16_C(  7387),  INT16_C( 10224), -INT16_C( 18225) },
+      {  INT16_C( 21259), -INT16_C( 18308),  INT16_C( 23869),  INT16_C( 29829), -INT16_C( 17400),  INT16_C(  5771), -INT16_C( 26154),  INT16_C( 27712),
+        -INT16_C( 32461), -INT16_C( 32678), -INT16_C( 24263),  INT16_C( 22424),  INT16_C( 15079),  INT16_C( 31551), -INT16_C( 30104),  INT16_C(  3357),
+        -INT16_C( 18225),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(3345633190),
+      { -INT16_C( 25415),  INT16_C( 19747),  INT16_C(  6821), -INT16_C(  5028),  INT16_C( 31603),  INT16_C(   705), -INT16_C( 24014),  INT16_C( 25873),
+        -INT16_C( 27879),  INT16_C(  8084),  INT16_C( 24877),  INT16_C( 10111),  INT16_C(  7441),  INT16_C( 17657),  INT16_C( 15308),  INT16_C( 23179),
+         INT16_C(  5128), -INT16_C(  4130),  INT16_C( 30788), -INT16_C(  8272), -INT16_C( 24554),  INT16_C( 16641),  INT16_C(  9949), -INT16_C( 26650),
+        -INT16_C( 30834),  INT16_C( 22562),  INT16_C( 26724), -INT16_C( 32364),  INT16_C(   910),  INT16_C(  6365),  INT16_C( 14426),  INT16_C( 30594) },
+      {  INT16_C( 19747),  INT16_C(  6821),  INT16_C(   705),  INT16_C( 25873), -INT16_C( 27879),  INT16_C(  8084),  INT16_C( 24877),  INT16_C( 10111),
+         INT16_C( 15308), -INT16_C(  4130), -INT16_C(  8272),  INT16_C( 16641),  INT16_C(  9949), -INT16_C( 30834),  INT16_C( 22562),  INT16_C( 26724),
+         INT16_C( 14426),  INT16_C( 30594),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(3159166679),
+      {  INT16_C(  2058),  INT16_C( 18028),  INT16_C(  6594),  INT16_C( 22245), -INT16_C(  9202),  INT16_C(   281), -INT16_C( 14081), -INT16_C( 18765),
+         INT16_C( 32465), -INT16_C( 15926),  INT16_C(  8580),  INT16_C( 16583), -INT16_C( 27116), -INT16_C( 27989),  INT16_C( 11113),  INT16_C( 10993),
+        -INT16_C( 32240),  INT16_C(  6515), -INT16_C( 11065), -INT16_C( 23395),  INT16_C( 11553), -INT16_C( 20707),  INT16_C( 32164),  INT16_C( 11019),
+        -INT16_C( 21161), -INT16_C(  1546),  INT16_C( 20438), -INT16_C( 12647), -INT16_C( 15107), -INT16_C(  7453),  INT16_C( 24389), -INT16_C(   857) },
+      {  INT16_C(  2058),  INT16_C( 18028),  INT16_C(  6594), -INT16_C(  9202), -INT16_C( 14081), -INT16_C( 18765), -INT16_C( 15926),  INT16_C(  8580),
+         INT16_C( 16583), -INT16_C( 32240), -INT16_C( 11065), -INT16_C( 23395),  INT16_C( 32164),  INT16_C( 20438), -INT16_C( 12647), -INT16_C( 15107),
+        -INT16_C(  7453), -INT16_C(   857),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(1724667556),
+      { -INT16_C( 30967), -INT16_C( 30202),  INT16_C( 31577),  INT16_C(  7975), -INT16_C( 11963), -INT16_C(   976),  INT16_C( 10443),  INT16_C(  9294),
+         INT16_C( 24036),  INT16_C( 31951),  INT16_C(   952),  INT16_C(  7995),  INT16_C( 25249), -INT16_C(  3028), -INT16_C( 12655),  INT16_C( 14149),
+        -INT16_C(  8859), -INT16_C( 30088), -INT16_C( 25761),  INT16_C( 12728),  INT16_C( 10903),  INT16_C( 27624),  INT16_C( 23365), -INT16_C( 25287),
+        -INT16_C( 15836), -INT16_C( 15071), -INT16_C(  6646), -INT16_C(  6305), -INT16_C( 11266), -INT16_C( 30658),  INT16_C(  5447), -INT16_C(  9543) },
+      {  INT16_C( 31577), -INT16_C(   976),  INT16_C(  9294),  INT16_C( 31951),  INT16_C(   952),  INT16_C( 25249), -INT16_C( 12655), -INT16_C( 25761),
+         INT16_C( 12728),  INT16_C( 23365), -INT16_C( 25287), -INT16_C( 15071), -INT16_C(  6646), -INT16_C( 30658),  INT16_C(  5447),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C( 413893451),
+      {  INT16_C(   141),  INT16_C( 19950),  INT16_C( 16529),  INT16_C( 21576), -INT16_C( 31154), -INT16_C( 13985), -INT16_C( 10214), -INT16_C(  3801),
+        -INT16_C( 23596), -INT16_C( 20582),  INT16_C( 11290),  INT16_C( 11902), -INT16_C( 20436), -INT16_C( 13011),  INT16_C( 15898), -INT16_C(  1962),
+         INT16_C( 11411), -INT16_C(  5662),  INT16_C( 30162), -INT16_C( 27419), -INT16_C(  7521),  INT16_C( 21667), -INT16_C( 22650), -INT16_C(  3170),
+         INT16_C(  1130),  INT16_C( 11308), -INT16_C( 29576),  INT16_C(  4761), -INT16_C(  4070), -INT16_C( 19135), -INT16_C( 21026), -INT16_C(    56) },
+      {  INT16_C(   141),  INT16_C( 19950),  INT16_C( 21576), -INT16_C( 10214), -INT16_C( 23596), -INT16_C( 20582), -INT16_C(  1962),  INT16_C( 11411),
+        -INT16_C(  5662), -INT16_C( 27419),  INT16_C( 21667), -INT16_C(  3170),  INT16_C(  4761), -INT16_C(  4070),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    int16_t r[32] = { 0, };
+    simde_mm512_mask_compressstoreu_epi16(r, test_vec[i].k, a);
+    simde_assert_equal_vi16(32, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_compress_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_compress_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_compress_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_compress_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_compress_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_compress_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_compress_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_compress_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_compressstoreu_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_compressstoreu_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_compressstoreu_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_compressstoreu_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_compress_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_compress_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_compress_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_compress_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_compress_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_compress_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_compress_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_compress_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_compressstoreu_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_compressstoreu_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_compressstoreu_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_compressstoreu_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_compress_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_compress_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_compress_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_compress_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_compress_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_compress_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_compress_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_compress_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_compressstoreu_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_compressstoreu_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_compressstoreu_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_compressstoreu_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_compress_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_compress_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_compress_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_compress_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_compress_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_compress_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_compress_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_compress_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_compress_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_compress_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_compress_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_compress_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_compressstoreu_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_compressstoreu_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_compressstoreu_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_compressstoreu_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_compressstoreu_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_compressstoreu_epi16)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,927 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN conflict
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/conflict.h>
+
+static int
+test_simde_mm_conflict_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           4) } },
+    { {  INT32_C(           0),  INT32_C(           2),  INT32_C(           2), -INT32_C(           2) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           2),  INT32_C(           0) } },
+    { { -INT32_C(           2),  INT32_C(           3), -INT32_C(           3),  INT32_C(           1) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT32_C(           2),  INT32_C(           4), -INT32_C(           4),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           5) } },
+    { {  INT32_C(           1), -INT32_C(           1),  INT32_C(           2), -INT32_C(           2) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT32_C(           2), -INT32_C(           4), -INT32_C(           2), -INT32_C(           3) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           0) } },
+    { {  INT32_C(   906922315), -INT32_C(  1845061740),  INT32_C(   311785092), -INT32_C(  2144282157) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i r = simde_mm_conflict_epi32(a);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_conflict_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(   936761171),  INT32_C(  1920912717),  INT32_C(  1229265834),  INT32_C(  1396665671) },
+      UINT8_C(  6),
+      { -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1) },
+      { -INT32_C(   936761171),  INT32_C(           1),  INT32_C(           3),  INT32_C(  1396665671) } },
+    { { -INT32_C(  1046076171), -INT32_C(   445971018), -INT32_C(  1674519088),  INT32_C(  1363792075) },
+      UINT8_C( 15),
+      { -INT32_C(           1), -INT32_C(           1), -INT32_C(           2),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT32_C(   841242172), -INT32_C(  1218758174), -INT32_C(   357575128), -INT32_C(    65135991) },
+      UINT8_C(  4),
+      { -INT32_C(           4), -INT32_C(           4),  INT32_C(           3), -INT32_C(           2) },
+      {  INT32_C(   841242172), -INT32_C(  1218758174),  INT32_C(           0), -INT32_C(    65135991) } },
+    { {  INT32_C(   496789201), -INT32_C(    12854629),  INT32_C(  1724070830),  INT32_C(  1184596536) },
+      UINT8_C( 11),
+      {  INT32_C(           2), -INT32_C(           3),  INT32_C(           5), -INT32_C(           4) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(  1724070830),  INT32_C(           0) } },
+    { {  INT32_C(  1485136231),  INT32_C(   478045794), -INT32_C(  1032267802), -INT32_C(   507193561) },
+      UINT8_C( 14),
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1) },
+      {  INT32_C(  1485136231),  INT32_C(           1),  INT32_C(           0),  INT32_C(           4) } },
+    { {  INT32_C(  1852086047), -INT32_C(   603263514),  INT32_C(     7797547),  INT32_C(   283601364) },
+      UINT8_C( 11),
+      {  INT32_C(           1),  INT32_C(           2), -INT32_C(           1),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(     7797547),  INT32_C(           0) } },
+    { { -INT32_C(   550809293), -INT32_C(   604725762),  INT32_C(   231752208),  INT32_C(   131738331) },
+      UINT8_C( 15),
+      { -INT32_C(           3), -INT32_C(           4), -INT32_C(           2),  INT32_C(           1) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT32_C(  1459077180),  INT32_C(  2056508006),  INT32_C(  1280587294),  INT32_C(   629411958) },
+      UINT8_C(  8),
+      {  INT32_C(   247436066), -INT32_C(  1068658355),  INT32_C(   681504541),  INT32_C(  1379898920) },
+      {  INT32_C(  1459077180),  INT32_C(  2056508006),  INT32_C(  1280587294),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_conflict_epi32(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_conflict_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { UINT8_C(  5),
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C( 11),
+      {  INT32_C(           0), -INT32_C(           2), -INT32_C(           2), -INT32_C(           2) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           6) } },
+    { UINT8_C(  9),
+      {  INT32_C(           0),  INT32_C(           1), -INT32_C(           2),  INT32_C(           2) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C( 10),
+      { -INT32_C(           5),  INT32_C(           4), -INT32_C(           1), -INT32_C(           1) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           4) } },
+    { UINT8_C( 13),
+      { -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           2),  INT32_C(           6) } },
+    { UINT8_C(  6),
+      { -INT32_C(           1), -INT32_C(           1),  INT32_C(           2),  INT32_C(           2) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(  5),
+      {  INT32_C(           1),  INT32_C(           1), -INT32_C(           3), -INT32_C(           4) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(  5),
+      { -INT32_C(  1433459808), -INT32_C(   312861300), -INT32_C(   629557278), -INT32_C(  1632578891) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_conflict_epi32(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_conflict_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { {  INT64_C(                   0), -INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { { -INT64_C(                   1), -INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                   1) } },
+    { { -INT64_C(                   3), -INT64_C(                   3) },
+      {  INT64_C(                   0),  INT64_C(                   1) } },
+    { {  INT64_C(                   4),  INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { {  INT64_C(                   0), -INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { { -INT64_C(                   1), -INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                   1) } },
+    { {  INT64_C(                   3), -INT64_C(                   2) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { {  INT64_C( 8308630545661733537), -INT64_C( 3874304694455291277) },
+      {  INT64_C(                   0),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i r = simde_mm_conflict_epi64(a);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_conflict_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[2];
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { { -INT64_C(   46264394838663208),  INT64_C( 5667605511290794434) },
+      UINT8_C(  2),
+      { -INT64_C(                   1),  INT64_C(                   0) },
+      { -INT64_C(   46264394838663208),  INT64_C(                   0) } },
+    { { -INT64_C( 6264640535551041391), -INT64_C( 7571387506067504530) },
+      UINT8_C(  2),
+      {  INT64_C(                   1), -INT64_C(                   2) },
+      { -INT64_C( 6264640535551041391),  INT64_C(                   0) } },
+    { {  INT64_C( 7742713376387601514),  INT64_C( 8581603074606851403) },
+      UINT8_C(  2),
+      { -INT64_C(                   2), -INT64_C(                   3) },
+      {  INT64_C( 7742713376387601514),  INT64_C(                   0) } },
+    { {  INT64_C( 8299562685909284418),  INT64_C( 4899984919529210631) },
+      UINT8_C(  0),
+      {  INT64_C(                   4),  INT64_C(                   1) },
+      {  INT64_C( 8299562685909284418),  INT64_C( 4899984919529210631) } },
+    { { -INT64_C( 9200732107012382214),  INT64_C( 3765684996111329431) },
+      UINT8_C(  2),
+      {  INT64_C(                   0),  INT64_C(                   0) },
+      { -INT64_C( 9200732107012382214),  INT64_C(                   1) } },
+    { {  INT64_C( 5467015359187162913),  INT64_C( 3268209722571347075) },
+      UINT8_C(  0),
+      {  INT64_C(                   2), -INT64_C(                   1) },
+      {  INT64_C( 5467015359187162913),  INT64_C( 3268209722571347075) } },
+    { {  INT64_C( 1225408114983098282), -INT64_C( 7656017614434059065) },
+      UINT8_C(  3),
+      { -INT64_C(                   1), -INT64_C(                   3) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { { -INT64_C( 8560803768937237303),  INT64_C( 5026127965566385240) },
+      UINT8_C(  1),
+      { -INT64_C( 2712016657895290952), -INT64_C( 7979518171355737742) },
+      {  INT64_C(                   0),  INT64_C( 5026127965566385240) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi64(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_conflict_epi64(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_conflict_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { -INT64_C(                   1),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  1),
+      {  INT64_C(                   1),  INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  1),
+      {  INT64_C(                   0), -INT64_C(                   4) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  3),
+      {  INT64_C(                   0), -INT64_C(                   5) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  0),
+      { -INT64_C(                   1), -INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  1),
+      {  INT64_C(                   2), -INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  0),
+      { -INT64_C(                   3), -INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  2),
+      { -INT64_C( 6634413149536231837),  INT64_C( 3376593119532320843) },
+      {  INT64_C(                   0),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_conflict_epi64(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_conflict_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { { -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           3),  INT32_C(           4),  INT32_C(          11),  INT32_C(          20),  INT32_C(          84) } },
+    { {  INT32_C(           2), -INT32_C(           2), -INT32_C(           1), -INT32_C(           2), -INT32_C(           2), -INT32_C(           2), -INT32_C(           1), -INT32_C(           1) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           2),  INT32_C(          10),  INT32_C(          26),  INT32_C(           4),  INT32_C(          68) } },
+    { {  INT32_C(           1),  INT32_C(           2),  INT32_C(           0), -INT32_C(           2), -INT32_C(           3),  INT32_C(           2), -INT32_C(           2),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           2),  INT32_C(           8),  INT32_C(           4) } },
+    { { -INT32_C(           5),  INT32_C(           3), -INT32_C(           5), -INT32_C(           2),  INT32_C(           4), -INT32_C(           3), -INT32_C(           5), -INT32_C(           5) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           5),  INT32_C(          69) } },
+    { { -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           2),  INT32_C(           1),  INT32_C(           9),  INT32_C(           6),  INT32_C(          25),  INT32_C(          89) } },
+    { { -INT32_C(           1), -INT32_C(           2), -INT32_C(           2),  INT32_C(           1),  INT32_C(           0),  INT32_C(           1), -INT32_C(           2), -INT32_C(           2) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           2),  INT32_C(           0),  INT32_C(           0),  INT32_C(           8),  INT32_C(           6),  INT32_C(          70) } },
+    { { -INT32_C(           2),  INT32_C(           0), -INT32_C(           4), -INT32_C(           4),  INT32_C(           3),  INT32_C(           3),  INT32_C(           2),  INT32_C(           3) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           4),  INT32_C(           0),  INT32_C(          16),  INT32_C(           0),  INT32_C(          48) } },
+    { {  INT32_C(  2130136411), -INT32_C(  1030286229),  INT32_C(  1413134530),  INT32_C(   992416905),  INT32_C(  1238035025),  INT32_C(  1479793938), -INT32_C(   540591788), -INT32_C(  1607103646) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i r = simde_mm256_conflict_epi32(a);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_conflict_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { {  INT32_C(   403441845), -INT32_C(   771951674), -INT32_C(  1184690702), -INT32_C(  1204490806), -INT32_C(  1810600273),  INT32_C(   331412249),  INT32_C(   260461255), -INT32_C(  2144182655) },
+      UINT8_C( 21),
+      { -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1) },
+      {  INT32_C(           0), -INT32_C(   771951674),  INT32_C(           1), -INT32_C(  1204490806),  INT32_C(           5),  INT32_C(   331412249),  INT32_C(   260461255), -INT32_C(  2144182655) } },
+    { {  INT32_C(  1505805181), -INT32_C(  1438115081), -INT32_C(  1557069485),  INT32_C(   405312480),  INT32_C(  1608916036), -INT32_C(   248168655),  INT32_C(  1838858628),  INT32_C(   152784153) },
+      UINT8_C(250),
+      {  INT32_C(           2), -INT32_C(           1), -INT32_C(           2),  INT32_C(           1),  INT32_C(           1),  INT32_C(           2),  INT32_C(           0),  INT32_C(           1) },
+      {  INT32_C(  1505805181),  INT32_C(           0), -INT32_C(  1557069485),  INT32_C(           0),  INT32_C(           8),  INT32_C(           1),  INT32_C(           0),  INT32_C(          24) } },
+    { { -INT32_C(  1212113577), -INT32_C(  1237824422), -INT32_C(   515688687), -INT32_C(  1412824984),  INT32_C(  1713390166),  INT32_C(   789838946), -INT32_C(  1028678989),  INT32_C(   648639335) },
+      UINT8_C(184),
+      {  INT32_C(           1), -INT32_C(           3),  INT32_C(           0), -INT32_C(           4),  INT32_C(           2),  INT32_C(           0), -INT32_C(           2),  INT32_C(           2) },
+      { -INT32_C(  1212113577), -INT32_C(  1237824422), -INT32_C(   515688687),  INT32_C(           0),  INT32_C(           0),  INT32_C(           4), -INT32_C(  1028678989),  INT32_C(          16) } },
+    { {  INT32_C(   116338586), -INT32_C(   737490498), -INT32_C(  2116146533),  INT32_C(   802956826), -INT32_C(  1583433453),  INT32_C(   343561788), -INT32_C(   311438740), -INT32_C(  1421372386) },
+      UINT8_C( 16),
+      { -INT32_C(           5),  INT32_C(           4),  INT32_C(           0), -INT32_C(           3),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3),  INT32_C(           1) },
+      {  INT32_C(   116338586), -INT32_C(   737490498), -INT32_C(  2116146533),  INT32_C(   802956826),  INT32_C(           0),  INT32_C(   343561788), -INT32_C(   311438740), -INT32_C(  1421372386) } },
+    { {  INT32_C(   640572498), -INT32_C(  1187829856), -INT32_C(   100650906),  INT32_C(  1032866521), -INT32_C(  1308557443),  INT32_C(   591094549),  INT32_C(  1054444781),  INT32_C(   322130830) },
+      UINT8_C(141),
+      {  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(           0), -INT32_C(  1187829856),  INT32_C(           1),  INT32_C(           5), -INT32_C(  1308557443),  INT32_C(   591094549),  INT32_C(  1054444781),  INT32_C(          77) } },
+    { {  INT32_C(    14761904),  INT32_C(  2114353234), -INT32_C(    58839548),  INT32_C(  1030996127), -INT32_C(   690796245), -INT32_C(   216031535), -INT32_C(  1372715974), -INT32_C(  1800978595) },
+      UINT8_C(189),
+      {  INT32_C(           1), -INT32_C(           1),  INT32_C(           2), -INT32_C(           2), -INT32_C(           2),  INT32_C(           2),  INT32_C(           0),  INT32_C(           2) },
+      {  INT32_C(           0),  INT32_C(  2114353234),  INT32_C(           0),  INT32_C(           0),  INT32_C(           8),  INT32_C(           4), -INT32_C(  1372715974),  INT32_C(          36) } },
+    { {  INT32_C(   536618739), -INT32_C(  1801325379), -INT32_C(  1400776005),  INT32_C(   797866215),  INT32_C(   813190367),  INT32_C(   683872178),  INT32_C(   279040080), -INT32_C(   273257432) },
+      UINT8_C( 89),
+      { -INT32_C(           4), -INT32_C(           4), -INT32_C(           1), -INT32_C(           4),  INT32_C(           2), -INT32_C(           2),  INT32_C(           1),  INT32_C(           1) },
+      {  INT32_C(           0), -INT32_C(  1801325379), -INT32_C(  1400776005),  INT32_C(           3),  INT32_C(           0),  INT32_C(   683872178),  INT32_C(           0), -INT32_C(   273257432) } },
+    { { -INT32_C(   184476772), -INT32_C(   100913112), -INT32_C(  1564215196),  INT32_C(   135818371),  INT32_C(  1470387722),  INT32_C(   591526103),  INT32_C(  1989219665),  INT32_C(   771680240) },
+      UINT8_C(110),
+      {  INT32_C(  1249751612), -INT32_C(  1863174956), -INT32_C(  1835411914), -INT32_C(  1566795318),  INT32_C(   994526493),  INT32_C(   555426638), -INT32_C(  1048087419),  INT32_C(   523801562) },
+      { -INT32_C(   184476772),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1470387722),  INT32_C(           0),  INT32_C(           0),  INT32_C(   771680240) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_conflict_epi32(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_conflict_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { UINT8_C(176),
+      { -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(          14),  INT32_C(           0),  INT32_C(          17) } },
+    { UINT8_C(215),
+      {  INT32_C(           1),  INT32_C(           1),  INT32_C(           2),  INT32_C(           2),  INT32_C(           2), -INT32_C(           2), -INT32_C(           2), -INT32_C(           2) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(          12),  INT32_C(           0),  INT32_C(          32),  INT32_C(          96) } },
+    { UINT8_C(121),
+      { -INT32_C(           3),  INT32_C(           0), -INT32_C(           3),  INT32_C(           3), -INT32_C(           4), -INT32_C(           2),  INT32_C(           1), -INT32_C(           1) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(108),
+      { -INT32_C(           3), -INT32_C(           3),  INT32_C(           1), -INT32_C(           5),  INT32_C(           1), -INT32_C(           5), -INT32_C(           3),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           8),  INT32_C(           3),  INT32_C(           0) } },
+    { UINT8_C(255),
+      { -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           5),  INT32_C(           2),  INT32_C(          18),  INT32_C(          50),  INT32_C(         114) } },
+    { UINT8_C( 35),
+      { -INT32_C(           1), -INT32_C(           1),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           2) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           4),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(196),
+      {  INT32_C(           1), -INT32_C(           3), -INT32_C(           2),  INT32_C(           2), -INT32_C(           3), -INT32_C(           1), -INT32_C(           2),  INT32_C(           1) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           4),  INT32_C(           1) } },
+    { UINT8_C( 10),
+      { -INT32_C(   775537478), -INT32_C(  1843930817), -INT32_C(     2925889),  INT32_C(   758542893), -INT32_C(   943441502), -INT32_C(  1741927901),  INT32_C(   344575555), -INT32_C(  1823883131) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_conflict_epi32(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_conflict_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { { -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   2),  INT64_C(                   1) } },
+    { {  INT64_C(                   2), -INT64_C(                   2), -INT64_C(                   1),  INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { {  INT64_C(                   2), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   2) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   2),  INT64_C(                   0) } },
+    { {  INT64_C(                   1), -INT64_C(                   3), -INT64_C(                   1), -INT64_C(                   2) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { {  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   3) } },
+    { {  INT64_C(                   2), -INT64_C(                   2),  INT64_C(                   2), -INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   0) } },
+    { { -INT64_C(                   1),  INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   5) } },
+    { {  INT64_C( 6578846779978579571), -INT64_C( 4776729673976033301), -INT64_C( 2310623245054443709), -INT64_C(  394149440162932559) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i r = simde_mm256_conflict_epi64(a);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_conflict_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[4];
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { { -INT64_C( 3150591952404875680), -INT64_C( 3376581525923782361), -INT64_C( 2439219849888492614),  INT64_C( 7776248844222948613) },
+      UINT8_C(  1),
+      { -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1) },
+      {  INT64_C(                   0), -INT64_C( 3376581525923782361), -INT64_C( 2439219849888492614),  INT64_C( 7776248844222948613) } },
+    { {  INT64_C( 3934850746991639598), -INT64_C( 1026716384563199964), -INT64_C( 7371038384647701454),  INT64_C( 8649202979712171642) },
+      UINT8_C(  0),
+      {  INT64_C(                   2),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   1) },
+      {  INT64_C( 3934850746991639598), -INT64_C( 1026716384563199964), -INT64_C( 7371038384647701454),  INT64_C( 8649202979712171642) } },
+    { { -INT64_C( 4908251810000566583), -INT64_C( 3554615700609780834), -INT64_C(  873024861703869779),  INT64_C(   58969599823985666) },
+      UINT8_C(  3),
+      {  INT64_C(                   1), -INT64_C(                   2), -INT64_C(                   1), -INT64_C(                   4) },
+      {  INT64_C(                   0),  INT64_C(                   0), -INT64_C(  873024861703869779),  INT64_C(   58969599823985666) } },
+    { {  INT64_C( 7543372988921541138),  INT64_C( 6025273785317383076),  INT64_C( 2078284131802166915), -INT64_C( 8740975830191103518) },
+      UINT8_C(  3),
+      { -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   3) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C( 2078284131802166915), -INT64_C( 8740975830191103518) } },
+    { { -INT64_C( 5367453960943141766),  INT64_C( 8351992558832192606), -INT64_C( 1508212395012547417), -INT64_C( 8233129452496433248) },
+      UINT8_C(  2),
+      { -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1) },
+      { -INT64_C( 5367453960943141766),  INT64_C(                   0), -INT64_C( 1508212395012547417), -INT64_C( 8233129452496433248) } },
+    { {  INT64_C(  872250627910163641),  INT64_C( 3206228204556751934), -INT64_C(  705839914517588078),  INT64_C( 5431732090468810901) },
+      UINT8_C(  7),
+      {  INT64_C(                   2),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   2) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 5431732090468810901) } },
+    { { -INT64_C( 2483554974546725087), -INT64_C( 6301795055568882790),  INT64_C( 8498981246932659055),  INT64_C( 6531869566973894309) },
+      UINT8_C( 10),
+      { -INT64_C(                   4),  INT64_C(                   1),  INT64_C(                   1), -INT64_C(                   3) },
+      { -INT64_C( 2483554974546725087),  INT64_C(                   0),  INT64_C( 8498981246932659055),  INT64_C(                   0) } },
+    { { -INT64_C( 4828595781555790386), -INT64_C( 8459698480170575005),  INT64_C( 5069071050492918587),  INT64_C( 7089404350760631924) },
+      UINT8_C(  9),
+      {  INT64_C( 5153514989159582501),  INT64_C( 5236544304618510463), -INT64_C( 8691609813704665594),  INT64_C( 4134181864343068883) },
+      {  INT64_C(                   0), -INT64_C( 8459698480170575005),  INT64_C( 5069071050492918587),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi64(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_conflict_epi64(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_conflict_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { UINT8_C(  2),
+      { -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 13),
+      {  INT64_C(                   0), -INT64_C(                   2), -INT64_C(                   1), -INT64_C(                   2) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   2) } },
+    { UINT8_C(  7),
+      { -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   2), -INT64_C(                   2) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  2),
+      { -INT64_C(                   2),  INT64_C(                   4),  INT64_C(                   4), -INT64_C(                   5) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 10),
+      {  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   2) } },
+    { UINT8_C( 10),
+      { -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   2), -INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   1) } },
+    { UINT8_C( 10),
+      {  INT64_C(                   1),  INT64_C(                   2), -INT64_C(                   2),  INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   1) } },
+    { UINT8_C(  5),
+      { -INT64_C( 4703318455412625691), -INT64_C(   64809852725487158), -INT64_C( 2887537763401968121),  INT64_C( 6387669595113154653) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_conflict_epi64(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_conflict_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { {  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+        -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           3),  INT32_C(           4),  INT32_C(          11),  INT32_C(          43),  INT32_C(          20),
+         INT32_C(         148),  INT32_C(         404),  INT32_C(         107),  INT32_C(        1131),  INT32_C(         916),  INT32_C(        5012),  INT32_C(       13204),  INT32_C(        3179) } },
+    { {  INT32_C(           1),  INT32_C(           0),  INT32_C(           2),  INT32_C(           1),  INT32_C(           2),  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),
+         INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           2), -INT32_C(           1),  INT32_C(           2),  INT32_C(           0), -INT32_C(           1) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           4),  INT32_C(           2),  INT32_C(          34),  INT32_C(           9),
+         INT32_C(          98),  INT32_C(         354),  INT32_C(           0),  INT32_C(           0),  INT32_C(        1024),  INT32_C(          20),  INT32_C(         866),  INT32_C(        5120) } },
+    { {  INT32_C(           1), -INT32_C(           4), -INT32_C(           1),  INT32_C(           3),  INT32_C(           2),  INT32_C(           0),  INT32_C(           1),  INT32_C(           2),
+         INT32_C(           1),  INT32_C(           1),  INT32_C(           3), -INT32_C(           3),  INT32_C(           2), -INT32_C(           2),  INT32_C(           1), -INT32_C(           3) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(          16),
+         INT32_C(          65),  INT32_C(         321),  INT32_C(           8),  INT32_C(           0),  INT32_C(         144),  INT32_C(           0),  INT32_C(         833),  INT32_C(        2048) } },
+    { {  INT32_C(           0),  INT32_C(           1), -INT32_C(           1), -INT32_C(           3), -INT32_C(           4),  INT32_C(           4),  INT32_C(           5), -INT32_C(           2),
+         INT32_C(           0),  INT32_C(           3), -INT32_C(           2), -INT32_C(           1), -INT32_C(           3),  INT32_C(           5),  INT32_C(           2), -INT32_C(           2) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           1),  INT32_C(           0),  INT32_C(         128),  INT32_C(           4),  INT32_C(           8),  INT32_C(          64),  INT32_C(           0),  INT32_C(        1152) } },
+    { {  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           2),  INT32_C(           1),  INT32_C(           6),  INT32_C(          22),  INT32_C(          54),  INT32_C(         118),
+         INT32_C(           9),  INT32_C(         265),  INT32_C(         777),  INT32_C(         246),  INT32_C(        1801),  INT32_C(        2294),  INT32_C(        5897),  INT32_C(       10486) } },
+    { {  INT32_C(           2),  INT32_C(           2),  INT32_C(           0),  INT32_C(           1), -INT32_C(           2),  INT32_C(           1), -INT32_C(           2), -INT32_C(           2),
+        -INT32_C(           1), -INT32_C(           2), -INT32_C(           2), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           2),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           8),  INT32_C(          16),  INT32_C(          80),
+         INT32_C(           0),  INT32_C(         208),  INT32_C(         720),  INT32_C(         256),  INT32_C(        2304),  INT32_C(           4),  INT32_C(           3),  INT32_C(        8196) } },
+    { { -INT32_C(           4), -INT32_C(           4), -INT32_C(           4),  INT32_C(           2), -INT32_C(           2), -INT32_C(           3),  INT32_C(           0), -INT32_C(           1),
+        -INT32_C(           1),  INT32_C(           3),  INT32_C(           1), -INT32_C(           4), -INT32_C(           1),  INT32_C(           1), -INT32_C(           3), -INT32_C(           3) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           3),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(         128),  INT32_C(           0),  INT32_C(           0),  INT32_C(           7),  INT32_C(         384),  INT32_C(        1024),  INT32_C(          32),  INT32_C(       16416) } },
+    { { -INT32_C(  1130019274), -INT32_C(  1990184648),  INT32_C(   942469796),  INT32_C(   699358981), -INT32_C(  1509538566), -INT32_C(  1049973154), -INT32_C(   781953957),  INT32_C(  1867414311),
+        -INT32_C(  1899103283), -INT32_C(   758453348),  INT32_C(  1974815673),  INT32_C(   530234160),  INT32_C(  1513410882),  INT32_C(  1628965168),  INT32_C(   511052104), -INT32_C(  1211135308) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i r = simde_mm512_conflict_epi32(a);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_conflict_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { {  INT32_C(   604154256),  INT32_C(  1427600280), -INT32_C(   133534565), -INT32_C(  1655199067),  INT32_C(  1236674642),  INT32_C(  1287469863),  INT32_C(   868620414), -INT32_C(   471945431),
+         INT32_C(  2026596750), -INT32_C(  1019005494), -INT32_C(   850804206), -INT32_C(  1593364024),  INT32_C(   864556544), -INT32_C(   872513247),  INT32_C(    15187044), -INT32_C(   836888988) },
+      UINT16_C(14497),
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+        -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1) },
+      {  INT32_C(           0),  INT32_C(  1427600280), -INT32_C(   133534565), -INT32_C(  1655199067),  INT32_C(  1236674642),  INT32_C(          11),  INT32_C(   868620414),  INT32_C(         107),
+         INT32_C(  2026596750), -INT32_C(  1019005494), -INT32_C(   850804206),  INT32_C(         788),  INT32_C(        2836),  INT32_C(        1259),  INT32_C(    15187044), -INT32_C(   836888988) } },
+    { { -INT32_C(   196951287), -INT32_C(  1431194463),  INT32_C(  1995825823), -INT32_C(  1548709492), -INT32_C(   652783674),  INT32_C(  1992784858),  INT32_C(   628967870),  INT32_C(  1376393451),
+        -INT32_C(  1183236716),  INT32_C(  1031394358),  INT32_C(  1608924877), -INT32_C(  1172675857),  INT32_C(   375970637), -INT32_C(   727626346),  INT32_C(   576856241), -INT32_C(  1820158540) },
+      UINT16_C(48177),
+      {  INT32_C(           0), -INT32_C(           1),  INT32_C(           1),  INT32_C(           2),  INT32_C(           0), -INT32_C(           2), -INT32_C(           2),  INT32_C(           0),
+         INT32_C(           0), -INT32_C(           1),  INT32_C(           2),  INT32_C(           2),  INT32_C(           1),  INT32_C(           2),  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(           0), -INT32_C(  1431194463),  INT32_C(  1995825823), -INT32_C(  1548709492),  INT32_C(           1),  INT32_C(           0),  INT32_C(   628967870),  INT32_C(  1376393451),
+        -INT32_C(  1183236716),  INT32_C(  1031394358),  INT32_C(           8),  INT32_C(        1032),  INT32_C(           4),  INT32_C(        3080),  INT32_C(   576856241),  INT32_C(       16785) } },
+    { { -INT32_C(  2076143668),  INT32_C(  2077000511),  INT32_C(   419939991),  INT32_C(   913853133),  INT32_C(   824955396), -INT32_C(   805818185), -INT32_C(  2090640432), -INT32_C(  1074750030),
+        -INT32_C(  1499642908),  INT32_C(   227289733),  INT32_C(   426464623),  INT32_C(   362205481), -INT32_C(  1445450053),  INT32_C(   843211326),  INT32_C(  1801168470), -INT32_C(   452377343) },
+      UINT16_C( 3221),
+      {  INT32_C(           0), -INT32_C(           2), -INT32_C(           3),  INT32_C(           2),  INT32_C(           1),  INT32_C(           0), -INT32_C(           4), -INT32_C(           2),
+         INT32_C(           2),  INT32_C(           2),  INT32_C(           3), -INT32_C(           4),  INT32_C(           2), -INT32_C(           2), -INT32_C(           2),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(  2077000511),  INT32_C(           0),  INT32_C(   913853133),  INT32_C(           0), -INT32_C(   805818185), -INT32_C(  2090640432),  INT32_C(           2),
+        -INT32_C(  1499642908),  INT32_C(   227289733),  INT32_C(           0),  INT32_C(          64), -INT32_C(  1445450053),  INT32_C(   843211326),  INT32_C(  1801168470), -INT32_C(   452377343) } },
+    { {  INT32_C(   588875354),  INT32_C(   436254549),  INT32_C(   567187396), -INT32_C(  1145796293), -INT32_C(  1509293546), -INT32_C(  2070327453),  INT32_C(   487317643), -INT32_C(   428450581),
+         INT32_C(  1850606811),  INT32_C(  1470293396),  INT32_C(   807956157), -INT32_C(  1935714918),  INT32_C(  1887070361),  INT32_C(   208984016),  INT32_C(  1254331980),  INT32_C(  2078472628) },
+      UINT16_C( 9427),
+      {  INT32_C(           1),  INT32_C(           4),  INT32_C(           0),  INT32_C(           4), -INT32_C(           5),  INT32_C(           5), -INT32_C(           3),  INT32_C(           3),
+        -INT32_C(           2),  INT32_C(           1),  INT32_C(           3),  INT32_C(           1),  INT32_C(           2),  INT32_C(           4), -INT32_C(           4), -INT32_C(           2) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(   567187396), -INT32_C(  1145796293),  INT32_C(           0), -INT32_C(  2070327453),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(  1850606811),  INT32_C(  1470293396),  INT32_C(         128), -INT32_C(  1935714918),  INT32_C(  1887070361),  INT32_C(          10),  INT32_C(  1254331980),  INT32_C(  2078472628) } },
+    { {  INT32_C(   730752610),  INT32_C(  1535903417), -INT32_C(   316845705),  INT32_C(  2138818604), -INT32_C(   402912587),  INT32_C(  1225467848),  INT32_C(  1905033511),  INT32_C(  2129241315),
+         INT32_C(  1149473374), -INT32_C(  1386007070), -INT32_C(  1185054718), -INT32_C(   342967394),  INT32_C(  1715617386), -INT32_C(  1545702360), -INT32_C(  1803754110), -INT32_C(   974234941) },
+      UINT16_C(42735),
+      { -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+        -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           2),  INT32_C(           1), -INT32_C(   402912587),  INT32_C(          25),  INT32_C(          57),  INT32_C(         121),
+         INT32_C(  1149473374),  INT32_C(         505),  INT32_C(        1017), -INT32_C(   342967394),  INT32_C(  1715617386),  INT32_C(        4089), -INT32_C(  1803754110),  INT32_C(       28665) } },
+    { {  INT32_C(   529984930), -INT32_C(  1589547195),  INT32_C(  1257328616), -INT32_C(   612090304),  INT32_C(  2056880022), -INT32_C(   652401698), -INT32_C(  1766221312), -INT32_C(  1917697849),
+         INT32_C(  1737778766), -INT32_C(  1455954263),  INT32_C(   445210080),  INT32_C(  1468854204), -INT32_C(   390475619), -INT32_C(    57952079),  INT32_C(  1021049511),  INT32_C(   131487820) },
+      UINT16_C( 7710),
+      {  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           2),  INT32_C(           2),  INT32_C(           0),  INT32_C(           2),  INT32_C(           1),
+         INT32_C(           0),  INT32_C(           1),  INT32_C(           1),  INT32_C(           1), -INT32_C(           1), -INT32_C(           2), -INT32_C(           1), -INT32_C(           2) },
+      {  INT32_C(   529984930),  INT32_C(           0),  INT32_C(           2),  INT32_C(           0),  INT32_C(           0), -INT32_C(   652401698), -INT32_C(  1766221312), -INT32_C(  1917697849),
+         INT32_C(  1737778766),  INT32_C(         128),  INT32_C(         640),  INT32_C(        1664),  INT32_C(           6), -INT32_C(    57952079),  INT32_C(  1021049511),  INT32_C(   131487820) } },
+    { {  INT32_C(  1703569651), -INT32_C(   624431975), -INT32_C(   339321135),  INT32_C(  1659190768), -INT32_C(   136393750), -INT32_C(  1399098456),  INT32_C(   845692041),  INT32_C(  1288273310),
+         INT32_C(  1842370096), -INT32_C(  2003329831),  INT32_C(  1705004233), -INT32_C(  1711091447),  INT32_C(   357761871), -INT32_C(    43049695),  INT32_C(    27972004),  INT32_C(   326072189) },
+      UINT16_C(20206),
+      {  INT32_C(           1),  INT32_C(           1),  INT32_C(           0), -INT32_C(           4), -INT32_C(           2), -INT32_C(           1), -INT32_C(           2),  INT32_C(           3),
+        -INT32_C(           2),  INT32_C(           3),  INT32_C(           3), -INT32_C(           1), -INT32_C(           1), -INT32_C(           2), -INT32_C(           2),  INT32_C(           3) },
+      {  INT32_C(  1703569651),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(   136393750),  INT32_C(           0),  INT32_C(          16),  INT32_C(           0),
+         INT32_C(  1842370096),  INT32_C(         128),  INT32_C(         640),  INT32_C(          32),  INT32_C(   357761871), -INT32_C(    43049695),  INT32_C(        8528),  INT32_C(   326072189) } },
+    { {  INT32_C(   986805525), -INT32_C(  2077833768),  INT32_C(   602316617),  INT32_C(  2125814125),  INT32_C(  1798512116),  INT32_C(  1215880567),  INT32_C(   104114644), -INT32_C(   600962438),
+        -INT32_C(   600166191),  INT32_C(   265060693),  INT32_C(   490199253),  INT32_C(   264041307), -INT32_C(   484186905), -INT32_C(   399769574), -INT32_C(  2138322285),  INT32_C(  1794626805) },
+      UINT16_C(24855),
+      {  INT32_C(   238227950),  INT32_C(  1402005141),  INT32_C(    71867804),  INT32_C(   470144944),  INT32_C(  1515902911),  INT32_C(  1382875403),  INT32_C(   990240378),  INT32_C(  1132696784),
+         INT32_C(  1374055158),  INT32_C(  1676205268),  INT32_C(   889565789), -INT32_C(   426162907),  INT32_C(  2073639442), -INT32_C(   523736833),  INT32_C(   186498081),  INT32_C(  1261956103) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  2125814125),  INT32_C(           0),  INT32_C(  1215880567),  INT32_C(   104114644), -INT32_C(   600962438),
+         INT32_C(           0),  INT32_C(   265060693),  INT32_C(   490199253),  INT32_C(   264041307), -INT32_C(   484186905),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1794626805) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_conflict_epi32(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_conflict_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { UINT16_C(25119),
+      { -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1),
+         INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           2),  INT32_C(           6),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(         366),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(        4974),  INT32_C(       13166),  INT32_C(           0) } },
+    { UINT16_C(18125),
+      {  INT32_C(           1), -INT32_C(           2), -INT32_C(           1), -INT32_C(           1), -INT32_C(           2), -INT32_C(           1), -INT32_C(           2), -INT32_C(           1),
+         INT32_C(           2),  INT32_C(           2), -INT32_C(           2),  INT32_C(           1),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           2) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           4),  INT32_C(           0),  INT32_C(           0),  INT32_C(          18),  INT32_C(          44),
+         INT32_C(           0),  INT32_C(         256),  INT32_C(          82),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(        8192),  INT32_C(           0) } },
+    { UINT16_C(13875),
+      { -INT32_C(           1), -INT32_C(           1), -INT32_C(           4), -INT32_C(           2), -INT32_C(           3), -INT32_C(           2),  INT32_C(           1), -INT32_C(           4),
+         INT32_C(           1),  INT32_C(           3),  INT32_C(           3), -INT32_C(           2), -INT32_C(           3),  INT32_C(           2),  INT32_C(           2),  INT32_C(           1) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           8),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(         512),  INT32_C(           0),  INT32_C(          16),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(21850),
+      {  INT32_C(           4), -INT32_C(           1),  INT32_C(           2),  INT32_C(           3), -INT32_C(           4),  INT32_C(           2),  INT32_C(           1),  INT32_C(           2),
+        -INT32_C(           1), -INT32_C(           1), -INT32_C(           4),  INT32_C(           4),  INT32_C(           5), -INT32_C(           5),  INT32_C(           0),  INT32_C(           4) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           2),  INT32_C(           0),  INT32_C(          16),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(11051),
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           1) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           7),  INT32_C(           0),  INT32_C(          16),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(         143),  INT32_C(         399),  INT32_C(           0),  INT32_C(         112),  INT32_C(           0),  INT32_C(        1935),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(24577),
+      {  INT32_C(           0),  INT32_C(           2), -INT32_C(           2), -INT32_C(           1),  INT32_C(           2),  INT32_C(           1),  INT32_C(           2),  INT32_C(           1),
+        -INT32_C(           2),  INT32_C(           2), -INT32_C(           1), -INT32_C(           1),  INT32_C(           0),  INT32_C(           1),  INT32_C(           2), -INT32_C(           2) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(         160),  INT32_C(         594),  INT32_C(           0) } },
+    { UINT16_C(26351),
+      {  INT32_C(           1),  INT32_C(           3),  INT32_C(           0),  INT32_C(           2), -INT32_C(           1),  INT32_C(           3), -INT32_C(           2), -INT32_C(           3),
+        -INT32_C(           2),  INT32_C(           1),  INT32_C(           0),  INT32_C(           2),  INT32_C(           2), -INT32_C(           1),  INT32_C(           1),  INT32_C(           2) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           2),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           1),  INT32_C(           4),  INT32_C(           0),  INT32_C(           0),  INT32_C(          16),  INT32_C(         513),  INT32_C(           0) } },
+    { UINT16_C( 9176),
+      { -INT32_C(   793924808), -INT32_C(   790569070),  INT32_C(  1853230232), -INT32_C(   230017204), -INT32_C(   350116542), -INT32_C(   444982939), -INT32_C(  1687447041),  INT32_C(  1289628590),
+        -INT32_C(  1285023935), -INT32_C(   325949823),  INT32_C(  1958868104), -INT32_C(   283303541), -INT32_C(  2008936646),  INT32_C(  1243549871), -INT32_C(   708445436), -INT32_C(   195877615) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_conflict_epi32(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_conflict_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+        -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   3),  INT64_C(                   7),
+         INT64_C(                   0),  INT64_C(                  16),  INT64_C(                  48),  INT64_C(                 112) } },
+    { {  INT64_C(                   1),  INT64_C(                   1),  INT64_C(                   2), -INT64_C(                   2),
+        -INT64_C(                   2),  INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   8),  INT64_C(                   3),  INT64_C(                   0),  INT64_C(                  64) } },
+    { {  INT64_C(                   0),  INT64_C(                   3),  INT64_C(                   0), -INT64_C(                   2),
+         INT64_C(                   2), -INT64_C(                   4), -INT64_C(                   2), -INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   8),  INT64_C(                   0) } },
+    { {  INT64_C(                   1),  INT64_C(                   1),  INT64_C(                   1), -INT64_C(                   2),
+        -INT64_C(                   2), -INT64_C(                   4), -INT64_C(                   2), -INT64_C(                   4) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   3),  INT64_C(                   0),
+         INT64_C(                   8),  INT64_C(                   0),  INT64_C(                  24),  INT64_C(                  32) } },
+    { {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   3),  INT64_C(                   7),
+         INT64_C(                  15),  INT64_C(                   0),  INT64_C(                  31),  INT64_C(                  32) } },
+    { {  INT64_C(                   1), -INT64_C(                   2), -INT64_C(                   1),  INT64_C(                   1),
+         INT64_C(                   2), -INT64_C(                   2),  INT64_C(                   1), -INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   1),
+         INT64_C(                   0),  INT64_C(                   2),  INT64_C(                   9),  INT64_C(                   4) } },
+    { {  INT64_C(                   3), -INT64_C(                   1),  INT64_C(                   1), -INT64_C(                   2),
+        -INT64_C(                   4),  INT64_C(                   2), -INT64_C(                   4), -INT64_C(                   4) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                  16),  INT64_C(                  80) } },
+    { { -INT64_C(  570285696653955755), -INT64_C( 9096316246209024530),  INT64_C( 8320683468233151035),  INT64_C( 5051575819810136804),
+        -INT64_C( 5850271058131361497), -INT64_C( 3122515623165690457), -INT64_C( 1752217205881865709),  INT64_C( 4474833050953603727) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i r = simde_mm512_conflict_epi64(a);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_conflict_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[8];
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { {  INT64_C( 1394959336273830233),  INT64_C( 5642701718244762455),  INT64_C( 1085836920680811400),  INT64_C( 3545448166958266129),
+         INT64_C(  926929843384831751), -INT64_C( 4501150474678137936),  INT64_C(  689788873173298128),  INT64_C( 4968441903748384097) },
+      UINT8_C(250),
+      { -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),
+         INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1) },
+      {  INT64_C( 1394959336273830233),  INT64_C(                   0),  INT64_C( 1085836920680811400),  INT64_C(                   1),
+         INT64_C(                   6),  INT64_C(                   9),  INT64_C(                  22),  INT64_C(                  41) } },
+    { { -INT64_C( 7111275409189938760),  INT64_C( 8655376218323135588), -INT64_C( 2486739391588383864),  INT64_C( 6851478268282342874),
+        -INT64_C( 6580039400226446639),  INT64_C( 7702224424670570739), -INT64_C(  986208124474430490),  INT64_C( 8537141316215544587) },
+      UINT8_C(169),
+      {  INT64_C(                   1),  INT64_C(                   1), -INT64_C(                   2), -INT64_C(                   1),
+        -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   2),  INT64_C(                   2) },
+      {  INT64_C(                   0),  INT64_C( 8655376218323135588), -INT64_C( 2486739391588383864),  INT64_C(                   0),
+        -INT64_C( 6580039400226446639),  INT64_C(                   0), -INT64_C(  986208124474430490),  INT64_C(                  64) } },
+    { { -INT64_C( 7649818898169374786),  INT64_C( 6599726053165388402), -INT64_C( 5993366208946016457), -INT64_C( 7346316732208183521),
+        -INT64_C(  636212105158006433),  INT64_C( 3496792018308556920), -INT64_C( 7450646498080621160), -INT64_C( 3784329931930039017) },
+      UINT8_C(225),
+      {  INT64_C(                   0), -INT64_C(                   4),  INT64_C(                   0),  INT64_C(                   0),
+        -INT64_C(                   2),  INT64_C(                   3), -INT64_C(                   3),  INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C( 6599726053165388402), -INT64_C( 5993366208946016457), -INT64_C( 7346316732208183521),
+        -INT64_C(  636212105158006433),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { { -INT64_C( 8165080003189026792), -INT64_C( 1116035196837114575),  INT64_C(  581084043478603547),  INT64_C( 1975185966338613220),
+         INT64_C( 3951884804703039815),  INT64_C( 1612350404578301412),  INT64_C( 1896845873643318236), -INT64_C( 4146677963405264376) },
+      UINT8_C(102),
+      {  INT64_C(                   5),  INT64_C(                   3), -INT64_C(                   2), -INT64_C(                   2),
+         INT64_C(                   5), -INT64_C(                   4), -INT64_C(                   1), -INT64_C(                   5) },
+      { -INT64_C( 8165080003189026792),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 1975185966338613220),
+         INT64_C( 3951884804703039815),  INT64_C(                   0),  INT64_C(                   0), -INT64_C( 4146677963405264376) } },
+    { { -INT64_C(  999141018978902440), -INT64_C( 3290829614125631705), -INT64_C( 8026049870728209651), -INT64_C( 8096683023781231937),
+         INT64_C( 5472040467204281382),  INT64_C( 2302551672440337547),  INT64_C( 3152661651050503941), -INT64_C( 6848371618823263001) },
+      UINT8_C( 94),
+      {  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),
+        -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   0), -INT64_C(                   1) },
+      { -INT64_C(  999141018978902440),  INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   3),
+         INT64_C(                   4),  INT64_C( 2302551672440337547),  INT64_C(                  11), -INT64_C( 6848371618823263001) } },
+    { { -INT64_C( 5156612491506934435),  INT64_C( 7914115349181335729), -INT64_C( 1889625189566016377),  INT64_C( 6602882376999471180),
+        -INT64_C( 2828310355606441135),  INT64_C( 1088063602800777059), -INT64_C( 7591650709836958421), -INT64_C( 8258531944885389165) },
+      UINT8_C( 91),
+      {  INT64_C(                   0), -INT64_C(                   2),  INT64_C(                   1), -INT64_C(                   1),
+         INT64_C(                   2),  INT64_C(                   0),  INT64_C(                   2),  INT64_C(                   2) },
+      {  INT64_C(                   0),  INT64_C(                   0), -INT64_C( 1889625189566016377),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C( 1088063602800777059),  INT64_C(                  16), -INT64_C( 8258531944885389165) } },
+    { { -INT64_C( 3434479604330878639), -INT64_C( 4381511538869653295),  INT64_C( 3220564698430976108), -INT64_C( 7002610381497241210),
+         INT64_C( 3881132350427539829), -INT64_C( 6321900585324447993),  INT64_C( 2471975599179373887),  INT64_C( 1481076150599683626) },
+      UINT8_C(188),
+      { -INT64_C(                   4),  INT64_C(                   2), -INT64_C(                   1),  INT64_C(                   1),
+        -INT64_C(                   3), -INT64_C(                   2), -INT64_C(                   2),  INT64_C(                   2) },
+      { -INT64_C( 3434479604330878639), -INT64_C( 4381511538869653295),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C( 2471975599179373887),  INT64_C(                   2) } },
+    { {  INT64_C( 5921767775200680243), -INT64_C( 3254480985656871450), -INT64_C( 9149161520526646045),  INT64_C( 9213445227890781604),
+         INT64_C( 3021628761420337813), -INT64_C( 7645374029125823723), -INT64_C( 8323709192532668906), -INT64_C( 1742270525712047301) },
+      UINT8_C( 79),
+      {  INT64_C( 7933657696322947482), -INT64_C( 3183716027405315991),  INT64_C( 7598810372314758458),  INT64_C(  723526305846044376),
+         INT64_C( 3163308443380126366), -INT64_C( 2676580391454747717),  INT64_C( 2792192470604592935), -INT64_C( 1087670853835759276) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C( 3021628761420337813), -INT64_C( 7645374029125823723),  INT64_C(                   0), -INT64_C( 1742270525712047301) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi64(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_conflict_epi64(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_conflict_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { UINT8_C(150),
+      {  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+        -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   2),  INT64_C(                   0),
+         INT64_C(                  14),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                  30) } },
+    { UINT8_C(149),
+      { -INT64_C(                   1), -INT64_C(                   2), -INT64_C(                   1), -INT64_C(                   1),
+        -INT64_C(                   2),  INT64_C(                   0), -INT64_C(                   2),  INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   1),  INT64_C(                   0),
+         INT64_C(                   2),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(107),
+      { -INT64_C(                   1),  INT64_C(                   3), -INT64_C(                   4), -INT64_C(                   1),
+        -INT64_C(                   1),  INT64_C(                   2),  INT64_C(                   0),  INT64_C(                   2) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   1),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(180),
+      {  INT64_C(                   2), -INT64_C(                   1), -INT64_C(                   2),  INT64_C(                   2),
+         INT64_C(                   2),  INT64_C(                   5),  INT64_C(                   2),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   9),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 96),
+      {  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   1), -INT64_C(                   1),
+         INT64_C(                   0), -INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                  12),  INT64_C(                  19),  INT64_C(                   0) } },
+    { UINT8_C(208),
+      {  INT64_C(                   2),  INT64_C(                   2),  INT64_C(                   1),  INT64_C(                   0),
+        -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   2), -INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                  48) } },
+    { UINT8_C( 35),
+      {  INT64_C(                   3),  INT64_C(                   2), -INT64_C(                   2),  INT64_C(                   3),
+         INT64_C(                   1), -INT64_C(                   3),  INT64_C(                   1), -INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 89),
+      {  INT64_C( 3696966219484253891), -INT64_C( 2284179120506544693),  INT64_C( 6394173437858751601), -INT64_C( 6840621670366092491),
+         INT64_C( 3864663091335334298),  INT64_C( 3197350267241543035),  INT64_C( 6060575352273144380), -INT64_C( 6640000594328592440) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_conflict_epi64(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_conflict_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_conflict_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_conflict_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_conflict_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_conflict_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_conflict_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_conflict_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_conflict_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_conflict_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_conflict_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_conflict_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_conflict_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_conflict_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_conflict_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_conflict_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_conflict_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_conflict_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_conflict_epi64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
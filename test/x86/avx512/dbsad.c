@@ -0,0 +1,1170 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+#define SIMDE_TEST_X86_AVX512_INSN dbsad
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/dbsad.h>
+
+static int
+test_simde_mm_dbsad_epu8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[16];
+    const int8_t b[16];
+    const int16_t r[8];
+  } test_vec[] = {
+    { { -INT8_C(  32), -INT8_C(  73),  INT8_C(  54), -INT8_C( 114), -INT8_C(  63), -INT8_C(  48),  INT8_C( 109),  INT8_C(  15),
+        -INT8_C(  39), -INT8_C(  44),  INT8_C( 121), -INT8_C( 107),  INT8_C(  38), -INT8_C(  52), -INT8_C(  65),  INT8_C(  10) },
+      {  INT8_C(  24), -INT8_C(  26),  INT8_C( 111), -INT8_C(  91), -INT8_C(  38), -INT8_C( 111),  INT8_C(  72),  INT8_C(  54),
+         INT8_C(  44),  INT8_C(  90), -INT8_C(  58), -INT8_C(  31), -INT8_C(  52),  INT8_C(  23),  INT8_C(  53), -INT8_C( 127) },
+      {  INT16_C(   194),  INT16_C(   504),  INT16_C(   359),  INT16_C(   430),  INT16_C(   212),  INT16_C(   404),  INT16_C(   571),  INT16_C(   336) } },
+    { { -INT8_C(  90),  INT8_C(  15),  INT8_C(   1), -INT8_C(  79), -INT8_C(  44), -INT8_C( 125),  INT8_C(  72),  INT8_C(  96),
+         INT8_C(  16),  INT8_C( 100), -INT8_C(  24), -INT8_C(  91),  INT8_C(  26),  INT8_C(  28), -INT8_C(  20),  INT8_C(  31) },
+      {  INT8_C(  16), -INT8_C( 106), -INT8_C(  61), -INT8_C(  58), -INT8_C(  17), -INT8_C(  40), -INT8_C( 101),  INT8_C(  32),
+        -INT8_C(  36),  INT8_C(  37),  INT8_C(   1), -INT8_C(  83),  INT8_C(  16), -INT8_C(  56), -INT8_C(  95),  INT8_C(  90) },
+      {  INT16_C(   582),  INT16_C(   312),  INT16_C(   299),  INT16_C(   341),  INT16_C(   549),  INT16_C(   604),  INT16_C(   472),  INT16_C(   268) } },
+    { { -INT8_C( 103), -INT8_C(  16), -INT8_C( 117), -INT8_C(  24), -INT8_C(  69), -INT8_C( 120), -INT8_C(  47), -INT8_C(  38),
+        -INT8_C(  57), -INT8_C(  90), -INT8_C(  51),  INT8_C( 108), -INT8_C(   8), -INT8_C(  91),  INT8_C(  92),  INT8_C( 106) },
+      { -INT8_C(  95),  INT8_C(  44), -INT8_C(  66), -INT8_C(  39),  INT8_C(  46), -INT8_C( 112), -INT8_C(  83), -INT8_C(  76),
+        -INT8_C(  91), -INT8_C(  44),  INT8_C(  13), -INT8_C(  97), -INT8_C(  98),  INT8_C(  53), -INT8_C( 107),  INT8_C(  78) },
+      {  INT16_C(   356),  INT16_C(   319),  INT16_C(   146),  INT16_C(   346),  INT16_C(   279),  INT16_C(   140),  INT16_C(   221),  INT16_C(   204) } },
+    { { -INT8_C(  41),  INT8_C(  32), -INT8_C( 112), -INT8_C(  59), -INT8_C( 108),  INT8_C(   9), -INT8_C(  99), -INT8_C(  72),
+        -INT8_C(  35),  INT8_C(   8),  INT8_C( 118), -INT8_C(  26),  INT8_C(  87),  INT8_C( 123), -INT8_C(  11),  INT8_C(  36) },
+      { -INT8_C(  42), -INT8_C(  81), -INT8_C(  22), -INT8_C( 119),  INT8_C(  26),  INT8_C(  30), -INT8_C(   4), -INT8_C(  23),
+        -INT8_C(  58),  INT8_C(  97), -INT8_C( 109),  INT8_C( 100), -INT8_C(  52),  INT8_C(  67), -INT8_C(   5), -INT8_C( 124) },
+      {  INT16_C(   218),  INT16_C(   380),  INT16_C(   354),  INT16_C(   302),  INT16_C(   354),  INT16_C(   566),  INT16_C(   445),  INT16_C(   505) } },
+    { { -INT8_C(  48), -INT8_C(  87),  INT8_C(  78), -INT8_C(  26),  INT8_C(  27), -INT8_C(  27), -INT8_C(   8), -INT8_C(  31),
+        -INT8_C(  78), -INT8_C(  23),      INT8_MIN,  INT8_C(  83), -INT8_C(  73),  INT8_C(   2),  INT8_C( 124),  INT8_C( 110) },
+      { -INT8_C(  79),  INT8_C(  18),  INT8_C(  10), -INT8_C(  42), -INT8_C(  33),  INT8_C(  90),  INT8_C(  36),  INT8_C( 118),
+        -INT8_C(  60), -INT8_C(  27),  INT8_C(  50),  INT8_C(  94),  INT8_C(  94), -INT8_C(  72),  INT8_C( 103),  INT8_C(  93) },
+      {  INT16_C(   291),  INT16_C(   139),  INT16_C(   268),  INT16_C(   293),  INT16_C(   315),  INT16_C(   389),  INT16_C(   408),  INT16_C(   446) } },
+    { {  INT8_C(  37),  INT8_C(  59),  INT8_C(  27), -INT8_C(  89), -INT8_C( 118),  INT8_C(  25),  INT8_C(  49), -INT8_C(  97),
+        -INT8_C(  88),  INT8_C( 107), -INT8_C(  21),  INT8_C(  34), -INT8_C( 124),  INT8_C(  77),  INT8_C(  47),  INT8_C(  29) },
+      {  INT8_C( 107),  INT8_C( 123), -INT8_C( 111), -INT8_C( 100),  INT8_C(  67),  INT8_C(  55), -INT8_C(  67),  INT8_C(  54),
+         INT8_C(  54),  INT8_C(  88),  INT8_C(  76), -INT8_C(  74),  INT8_C(   1),  INT8_C(  89), -INT8_C(  37), -INT8_C(  10) },
+      {  INT16_C(   337),  INT16_C(   544),  INT16_C(   378),  INT16_C(   259),  INT16_C(   219),  INT16_C(   449),  INT16_C(   234),  INT16_C(   300) } },
+    { {  INT8_C(  88), -INT8_C(  44), -INT8_C(  99), -INT8_C(  64), -INT8_C(  13),  INT8_C(  34),  INT8_C(  22),  INT8_C(  16),
+        -INT8_C( 106), -INT8_C(  59),  INT8_C( 112),  INT8_C(  44), -INT8_C(  12), -INT8_C(  27),  INT8_C( 106), -INT8_C(  66) },
+      { -INT8_C(  68), -INT8_C(  35), -INT8_C(  34), -INT8_C( 103), -INT8_C(  82),  INT8_C( 123),  INT8_C(  45), -INT8_C(  81),
+        -INT8_C( 120),  INT8_C( 123),  INT8_C(  45), -INT8_C(  67),  INT8_C(  52),  INT8_C(  70), -INT8_C(  42),  INT8_C(  81) },
+      {  INT16_C(   346),  INT16_C(   152),  INT16_C(   297),  INT16_C(   394),  INT16_C(   296),  INT16_C(   386),  INT16_C(   366),  INT16_C(   257) } },
+    { { -INT8_C(  87), -INT8_C(  92), -INT8_C(  93), -INT8_C(  60), -INT8_C( 113),  INT8_C(  40),  INT8_C( 124), -INT8_C(  70),
+         INT8_C(  15), -INT8_C(  53),  INT8_C(  98), -INT8_C(   2),  INT8_C( 107),  INT8_C( 109), -INT8_C(  75),  INT8_C(   0) },
+      {  INT8_C(  98),  INT8_C(  60), -INT8_C(  50),  INT8_C( 109), -INT8_C(  47), -INT8_C(   4),  INT8_C( 103),  INT8_C(  27),
+         INT8_C(  33), -INT8_C( 107),  INT8_C(  56),  INT8_C( 110),  INT8_C( 110),  INT8_C(  68), -INT8_C(  76),  INT8_C( 101) },
+      {  INT16_C(   267),  INT16_C(   342),  INT16_C(   226),  INT16_C(   204),  INT16_C(   475),  INT16_C(   564),  INT16_C(   229),  INT16_C(   418) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi8(test_vec[i].b);
+    simde__m128i r = simde_mm_dbsad_epu8(a, b, INT32_C( 27));
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_dbsad_epu8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[8];
+    const simde__mmask8 k;
+    const int8_t a[16];
+    const int8_t b[16];
+    const int16_t r[8];
+  } test_vec[] = {
+    { { -INT16_C( 15205), -INT16_C( 14661), -INT16_C( 23903), -INT16_C( 28477), -INT16_C( 24387), -INT16_C( 29349), -INT16_C(  8262), -INT16_C(  4204) },
+      UINT8_C(254),
+      {  INT8_C(  40), -INT8_C(  92),  INT8_C(  53), -INT8_C(  71), -INT8_C(  72), -INT8_C( 113),  INT8_C(  90),  INT8_C(  32),
+         INT8_C(  18), -INT8_C( 110),  INT8_C(  45), -INT8_C(  33),  INT8_C(  46),  INT8_C(  58),  INT8_C( 112), -INT8_C(  52) },
+      { -INT8_C(  32),  INT8_C(  91), -INT8_C(  29), -INT8_C(  98), -INT8_C(   3), -INT8_C( 112),  INT8_C(  23), -INT8_C(  25),
+         INT8_C( 124),  INT8_C(  24), -INT8_C(  46),  INT8_C( 109),  INT8_C(  53),  INT8_C(  65),  INT8_C(  55),  INT8_C(  45) },
+      { -INT16_C( 15205),  INT16_C(   287),  INT16_C(   333),  INT16_C(   199),  INT16_C(   507),  INT16_C(   304),  INT16_C(   413),  INT16_C(   264) } },
+    { { -INT16_C( 28889), -INT16_C(  1978),  INT16_C(  9401), -INT16_C( 18426), -INT16_C( 16045), -INT16_C(  6152), -INT16_C( 31168), -INT16_C(  1257) },
+      UINT8_C( 11),
+      {  INT8_C(  30), -INT8_C(   4), -INT8_C(  69), -INT8_C(   4), -INT8_C(   3), -INT8_C(  34),  INT8_C(  63), -INT8_C(  61),
+         INT8_C(  62), -INT8_C(  84),  INT8_C( 121),  INT8_C(   5), -INT8_C(  65), -INT8_C( 124),  INT8_C( 123),  INT8_C(   3) },
+      { -INT8_C(  48), -INT8_C(  45), -INT8_C( 112),  INT8_C(  37),  INT8_C(  17), -INT8_C(  85), -INT8_C(  90),  INT8_C(  55),
+        -INT8_C(  21), -INT8_C( 102), -INT8_C( 111), -INT8_C(  80), -INT8_C(  59),  INT8_C(  38),  INT8_C( 106), -INT8_C(  74) },
+      {  INT16_C(   477),  INT16_C(   674),  INT16_C(  9401),  INT16_C(   558), -INT16_C( 16045), -INT16_C(  6152), -INT16_C( 31168), -INT16_C(  1257) } },
+    { { -INT16_C( 10381), -INT16_C( 15874), -INT16_C(  4568),  INT16_C(  5805), -INT16_C( 15240), -INT16_C(  3795),  INT16_C( 29226), -INT16_C( 24616) },
+      UINT8_C(180),
+      { -INT8_C(   4), -INT8_C(  65),  INT8_C(  86),  INT8_C( 120),  INT8_C(  24), -INT8_C(  10), -INT8_C(   9), -INT8_C(  84),
+        -INT8_C( 121), -INT8_C( 112),  INT8_C(  77), -INT8_C( 115), -INT8_C(  74), -INT8_C( 117), -INT8_C(  14), -INT8_C( 125) },
+      { -INT8_C(  82), -INT8_C(  75), -INT8_C(  36), -INT8_C( 115),  INT8_C(  50), -INT8_C(  44), -INT8_C(   9), -INT8_C(  48),
+         INT8_C(  83),  INT8_C(  65),  INT8_C(  91), -INT8_C( 101), -INT8_C( 124), -INT8_C(  91),  INT8_C(  58),  INT8_C(   8) },
+      { -INT16_C( 10381), -INT16_C( 15874),  INT16_C(   538),  INT16_C(  5805),  INT16_C(   159),  INT16_C(   210),  INT16_C( 29226),  INT16_C(   184) } },
+    { { -INT16_C( 31611),  INT16_C(  2321),  INT16_C( 21187),  INT16_C( 14240),  INT16_C( 26299),  INT16_C(  6046),  INT16_C(  1723), -INT16_C( 26190) },
+      UINT8_C( 29),
+      {  INT8_C(  52), -INT8_C(  50), -INT8_C(  65), -INT8_C(  86), -INT8_C(  21), -INT8_C(  16),  INT8_C(   9), -INT8_C(  27),
+         INT8_C( 108), -INT8_C( 108), -INT8_C(  59),  INT8_C(  82), -INT8_C(  42), -INT8_C(  89), -INT8_C( 108),  INT8_C(  61) },
+      { -INT8_C(  34),  INT8_C(  75), -INT8_C( 125), -INT8_C(  44),  INT8_C(  87),  INT8_C(  77),  INT8_C( 109),  INT8_C(   3),
+         INT8_C(  91),  INT8_C(  45), -INT8_C(  13), -INT8_C( 122), -INT8_C(  93),  INT8_C(  58), -INT8_C( 112), -INT8_C(  65) },
+      {  INT16_C(   403),  INT16_C(  2321),  INT16_C(   362),  INT16_C(   364),  INT16_C(   218),  INT16_C(  6046),  INT16_C(  1723), -INT16_C( 26190) } },
+    { {  INT16_C(  4596), -INT16_C( 13989), -INT16_C( 19572),  INT16_C(   622), -INT16_C( 19886), -INT16_C( 14059), -INT16_C( 21580),  INT16_C( 21576) },
+      UINT8_C(139),
+      {  INT8_C(  45), -INT8_C(  99),  INT8_C(   0), -INT8_C(  38),  INT8_C( 119), -INT8_C(   3),  INT8_C(  26), -INT8_C(  22),
+         INT8_C(  13), -INT8_C( 103),  INT8_C(  10),  INT8_C( 108), -INT8_C(  72), -INT8_C(  73),  INT8_C( 114), -INT8_C(  48) },
+      { -INT8_C(  39), -INT8_C(  72), -INT8_C(  91), -INT8_C(  46), -INT8_C( 105), -INT8_C(  12), -INT8_C(  63), -INT8_C(  66),
+        -INT8_C(  43), -INT8_C(  30), -INT8_C(  35), -INT8_C( 114),  INT8_C(  71),  INT8_C(   5),  INT8_C(  61), -INT8_C( 109) },
+      {  INT16_C(   372),  INT16_C(   424), -INT16_C( 19572),  INT16_C(   452), -INT16_C( 19886), -INT16_C( 14059), -INT16_C( 21580),  INT16_C(   410) } },
+    { { -INT16_C(  4132),  INT16_C( 16432), -INT16_C( 25126),  INT16_C( 19372), -INT16_C( 30031), -INT16_C( 25963),  INT16_C(  7365),  INT16_C( 25986) },
+      UINT8_C(243),
+      {  INT8_C(  37), -INT8_C(  75),  INT8_C( 114),  INT8_C(   0),  INT8_C(  78), -INT8_C(  64), -INT8_C(  25),  INT8_C(  16),
+         INT8_C(  34), -INT8_C(  70),  INT8_C( 101), -INT8_C(  57), -INT8_C(  40), -INT8_C(  23), -INT8_C(  22), -INT8_C(  43) },
+      { -INT8_C( 114),  INT8_C( 123),  INT8_C( 119), -INT8_C(  21),  INT8_C(  30),  INT8_C(   6),  INT8_C(  60), -INT8_C( 114),
+         INT8_C( 123),  INT8_C( 103),  INT8_C(   9),  INT8_C(  79), -INT8_C(  49), -INT8_C(  16),  INT8_C(  11),  INT8_C(  29) },
+      {  INT16_C(   403),  INT16_C(   299), -INT16_C( 25126),  INT16_C( 19372),  INT16_C(   384),  INT16_C(   276),  INT16_C(   415),  INT16_C(   371) } },
+    { { -INT16_C( 16635),  INT16_C( 16902),  INT16_C( 16270), -INT16_C(  1907), -INT16_C( 23337),  INT16_C( 29361),  INT16_C(  6716), -INT16_C( 25566) },
+      UINT8_C(194),
+      { -INT8_C(  58), -INT8_C(  55), -INT8_C(  96),  INT8_C( 103), -INT8_C(  87), -INT8_C(  76), -INT8_C( 111), -INT8_C(  52),
+        -INT8_C(  95), -INT8_C(  38), -INT8_C(  47),  INT8_C(   2),  INT8_C(  38),  INT8_C(  24), -INT8_C( 106),  INT8_C( 117) },
+      {  INT8_C(  94),  INT8_C(  82), -INT8_C( 112),  INT8_C(  37), -INT8_C(  99),  INT8_C(  34),  INT8_C(  26), -INT8_C(  88),
+         INT8_C(  59),  INT8_C( 103), -INT8_C(  61), -INT8_C(  44),  INT8_C(  95), -INT8_C( 127),  INT8_C( 112),  INT8_C(  86) },
+      { -INT16_C( 16635),  INT16_C(   350),  INT16_C( 16270), -INT16_C(  1907), -INT16_C( 23337),  INT16_C( 29361),  INT16_C(   412),  INT16_C(   271) } },
+    { {  INT16_C( 18880), -INT16_C(  1157), -INT16_C( 30096), -INT16_C( 13673), -INT16_C( 21653),  INT16_C( 10270),  INT16_C(  4730), -INT16_C(  4578) },
+      UINT8_C(133),
+      { -INT8_C( 104),  INT8_C(  53), -INT8_C(   9),  INT8_C(  28), -INT8_C( 102),  INT8_C(  23), -INT8_C(  15), -INT8_C(  82),
+        -INT8_C(   3),  INT8_C(  10), -INT8_C(  54),  INT8_C(  93), -INT8_C( 123),  INT8_C(  62),  INT8_C( 122), -INT8_C( 110) },
+      {  INT8_C(   1), -INT8_C( 123), -INT8_C( 106),  INT8_C(  49), -INT8_C(   9), -INT8_C( 102), -INT8_C(  13), -INT8_C(  44),
+         INT8_C(  19),  INT8_C(  47),  INT8_C(  73), -INT8_C(  43),  INT8_C(  54),  INT8_C( 108), -INT8_C(  38), -INT8_C( 127) },
+      {  INT16_C(   349), -INT16_C(  1157),  INT16_C(    56), -INT16_C( 13673), -INT16_C( 21653),  INT16_C( 10270),  INT16_C(  4730),  INT16_C(   174) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi16(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi8(test_vec[i].b);
+    simde__m128i r = simde_mm_mask_dbsad_epu8(src, test_vec[i].k, a, b, INT32_C(228));
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_dbsad_epu8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int8_t a[16];
+    const int8_t b[16];
+    const int16_t r[8];
+  } test_vec[] = {
+    { UINT8_C( 31),
+      {  INT8_C( 125), -INT8_C(  29),  INT8_C(  34), -INT8_C(  82),  INT8_C(  83), -INT8_C(  81),  INT8_C(  52),  INT8_C(  54),
+        -INT8_C(  34), -INT8_C(  59),  INT8_C( 124),  INT8_C(  82),  INT8_C(  66),  INT8_C(  60), -INT8_C(  74),  INT8_C(  85) },
+      { -INT8_C( 113),  INT8_C(   4),  INT8_C(  32),  INT8_C( 108), -INT8_C(  86), -INT8_C(  41),  INT8_C(  44), -INT8_C(  66),
+         INT8_C(  75),  INT8_C(  29),  INT8_C(  19), -INT8_C(  61),  INT8_C( 102), -INT8_C(  26), -INT8_C(  43),  INT8_C(  64) },
+      {  INT16_C(    83),  INT16_C(   528),  INT16_C(   102),  INT16_C(   265),  INT16_C(   260),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(139),
+      {  INT8_C(  96),  INT8_C(  96), -INT8_C( 116), -INT8_C(  53),  INT8_C(  10),  INT8_C( 104), -INT8_C(  44), -INT8_C(  13),
+         INT8_C(  10),  INT8_C( 120),  INT8_C(   2), -INT8_C(  84),  INT8_C(  73),  INT8_C(  97), -INT8_C(   5), -INT8_C( 102) },
+      {  INT8_C(   8),  INT8_C(  12),  INT8_C(  24), -INT8_C(  58), -INT8_C(  13), -INT8_C(   4), -INT8_C(  47), -INT8_C(  14),
+         INT8_C(  13),  INT8_C(  99), -INT8_C(  71), -INT8_C(  54), -INT8_C(  19),  INT8_C(  52), -INT8_C(  72), -INT8_C(  81) },
+      {  INT16_C(   411),  INT16_C(   561),  INT16_C(     0),  INT16_C(   494),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   560) } },
+    { UINT8_C( 38),
+      { -INT8_C(  74),  INT8_C( 123), -INT8_C(  77), -INT8_C(  80), -INT8_C(  47), -INT8_C(  34),  INT8_C(   1),  INT8_C(  79),
+        -INT8_C(  97), -INT8_C(   4), -INT8_C(  49),  INT8_C(  52),      INT8_MIN,  INT8_C( 109), -INT8_C( 109),  INT8_C(  92) },
+      {  INT8_C(  47),  INT8_C(  19), -INT8_C(  71), -INT8_C(  98), -INT8_C(  95),  INT8_C(  60),  INT8_C(  86),  INT8_C( 122),
+         INT8_C(  20),  INT8_C( 108), -INT8_C(  46),  INT8_C( 111), -INT8_C(  19),  INT8_C(  30), -INT8_C( 108),  INT8_C(  71) },
+      {  INT16_C(     0),  INT16_C(   372),  INT16_C(   271),  INT16_C(     0),  INT16_C(     0),  INT16_C(   374),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(204),
+      {  INT8_C(  27),  INT8_C( 121), -INT8_C( 121), -INT8_C(  48),  INT8_C(  97),  INT8_C(   3), -INT8_C(  99),  INT8_C(  40),
+        -INT8_C(  50), -INT8_C( 125),  INT8_C(  56),  INT8_C( 120),  INT8_C( 104), -INT8_C(  66), -INT8_C(  15),  INT8_C(   0) },
+      {  INT8_C( 108), -INT8_C(  74), -INT8_C(  17), -INT8_C(  38), -INT8_C( 119),  INT8_C(  78),  INT8_C(  50),  INT8_C(  52),
+         INT8_C(  44), -INT8_C( 108), -INT8_C(  85), -INT8_C(  20),  INT8_C(   7),  INT8_C(  99),  INT8_C(  39), -INT8_C(  95) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(   317),  INT16_C(   226),  INT16_C(     0),  INT16_C(     0),  INT16_C(   409),  INT16_C(   437) } },
+    { UINT8_C(235),
+      {  INT8_C( 106),  INT8_C(  58),  INT8_C(  46), -INT8_C(   6),  INT8_C(  67),  INT8_C( 125),  INT8_C(  29), -INT8_C(  27),
+         INT8_C(  48), -INT8_C(   6), -INT8_C(  85),  INT8_C(  20),  INT8_C(  36), -INT8_C( 104), -INT8_C(  15),  INT8_C(  86) },
+      {  INT8_C(  22),  INT8_C(   4),  INT8_C(  90), -INT8_C(  48), -INT8_C(  63),  INT8_C(  58),  INT8_C( 118),  INT8_C( 112),
+         INT8_C(  18),  INT8_C(  20), -INT8_C(  76),  INT8_C(  85), -INT8_C(  79),  INT8_C( 126), -INT8_C( 126),  INT8_C( 109) },
+      {  INT16_C(   297),  INT16_C(   406),  INT16_C(     0),  INT16_C(   210),  INT16_C(     0),  INT16_C(   262),  INT16_C(   438),  INT16_C(   444) } },
+    { UINT8_C(171),
+      {  INT8_C(  90), -INT8_C(  36),  INT8_C(  37),  INT8_C(  99),  INT8_C(   3), -INT8_C(  95), -INT8_C( 124),  INT8_C(  55),
+         INT8_C(  75), -INT8_C( 101), -INT8_C(  46),  INT8_C( 115), -INT8_C(  61),  INT8_C( 124), -INT8_C(  66), -INT8_C( 111) },
+      {  INT8_C(  54), -INT8_C(  38), -INT8_C(  89),  INT8_C(   4), -INT8_C(  32),  INT8_C(  43), -INT8_C(  73), -INT8_C(  66),
+         INT8_C(  33),  INT8_C(  19),  INT8_C(  21),  INT8_C(  45),  INT8_C(  69),  INT8_C( 127), -INT8_C(  83),  INT8_C(   4) },
+      {  INT16_C(   548),  INT16_C(   303),  INT16_C(     0),  INT16_C(   462),  INT16_C(     0),  INT16_C(   337),  INT16_C(     0),  INT16_C(   311) } },
+    { UINT8_C(165),
+      {  INT8_C( 100),  INT8_C(  78),  INT8_C( 108), -INT8_C(  26), -INT8_C(  19),  INT8_C(  10), -INT8_C(  46), -INT8_C( 101),
+         INT8_C(  10), -INT8_C(  88),  INT8_C( 117),  INT8_C(   9), -INT8_C(  71),  INT8_C(  72),  INT8_C( 108), -INT8_C( 114) },
+      { -INT8_C( 108), -INT8_C(  23), -INT8_C(  64),  INT8_C(  45),  INT8_C(  13),  INT8_C(  91), -INT8_C(  31),  INT8_C(  26),
+        -INT8_C(  44), -INT8_C(  27), -INT8_C(  70),  INT8_C(  67),  INT8_C(  63),  INT8_C(  77), -INT8_C(  65), -INT8_C(  54) },
+      {  INT16_C(   421),  INT16_C(     0),  INT16_C(   104),  INT16_C(     0),  INT16_C(     0),  INT16_C(   314),  INT16_C(     0),  INT16_C(   268) } },
+    { UINT8_C(240),
+      {  INT8_C(  21),  INT8_C(  23),  INT8_C( 107), -INT8_C( 117), -INT8_C(  88),  INT8_C(  73), -INT8_C( 109), -INT8_C(  70),
+         INT8_C(  91),  INT8_C(  11), -INT8_C(  55), -INT8_C(  20),  INT8_C( 117),  INT8_C(  27), -INT8_C(  45), -INT8_C( 106) },
+      {  INT8_C( 112), -INT8_C(  32), -INT8_C(  11),  INT8_C(  70),  INT8_C(  90),  INT8_C(  40), -INT8_C(  16), -INT8_C(  83),
+        -INT8_C(  60), -INT8_C(  49),  INT8_C( 110), -INT8_C(  72), -INT8_C(   7), -INT8_C(  40), -INT8_C(  91),  INT8_C( 120) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   515),  INT16_C(   484),  INT16_C(   314),  INT16_C(   196) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi8(test_vec[i].b);
+    simde__m128i r = simde_mm_maskz_dbsad_epu8(test_vec[i].k, a, b, INT32_C( 57));
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_dbsad_epu8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[32];
+    const int8_t b[32];
+    const int16_t r[16];
+  } test_vec[] = {
+    { {  INT8_C(  29),  INT8_C(  19),  INT8_C(  65), -INT8_C( 125), -INT8_C( 122),  INT8_C(  53),  INT8_C(  63),  INT8_C(  71),
+        -INT8_C(  13),  INT8_C(  98),  INT8_C( 110), -INT8_C(   8), -INT8_C(  91), -INT8_C( 104),  INT8_C(  53),  INT8_C( 123),
+        -INT8_C(  13),  INT8_C(  62), -INT8_C(  36),  INT8_C(  87), -INT8_C(  71), -INT8_C(  30),  INT8_C(  75), -INT8_C( 119),
+        -INT8_C(  62),  INT8_C(  31), -INT8_C(  29),  INT8_C(  66),  INT8_C(  96), -INT8_C(  84), -INT8_C(  47), -INT8_C(  22) },
+      {  INT8_C( 115), -INT8_C(  93),  INT8_C( 114), -INT8_C(  90), -INT8_C(  53), -INT8_C(   2), -INT8_C(  35),  INT8_C( 118),
+        -INT8_C(  96),  INT8_C( 127),  INT8_C(  23), -INT8_C(  61),  INT8_C(  18), -INT8_C(  40),  INT8_C(  55), -INT8_C(  19),
+        -INT8_C( 104),  INT8_C( 125), -INT8_C(  85),  INT8_C(  90), -INT8_C(  82),  INT8_C( 125), -INT8_C(  27),  INT8_C(  66),
+        -INT8_C(  36), -INT8_C( 111),  INT8_C( 104),  INT8_C(  86),  INT8_C(  12), -INT8_C(   4),  INT8_C(  19),  INT8_C(  93) },
+      {  INT16_C(   324),  INT16_C(   424),  INT16_C(   416),  INT16_C(   322),  INT16_C(   437),  INT16_C(   275),  INT16_C(   192),  INT16_C(   203),
+         INT16_C(   628),  INT16_C(   312),  INT16_C(   452),  INT16_C(   201),  INT16_C(   116),  INT16_C(   514),  INT16_C(   405),  INT16_C(   197) } },
+    { {  INT8_C(  46), -INT8_C(   4), -INT8_C(  99),  INT8_C(  26), -INT8_C(  24),  INT8_C( 101), -INT8_C( 101),  INT8_C(  54),
+         INT8_C(  36),      INT8_MIN,  INT8_C(   9),  INT8_C(  85), -INT8_C(  29),  INT8_C(  94), -INT8_C(  64), -INT8_C(  15),
+         INT8_C(  50), -INT8_C(   4),  INT8_C(  77), -INT8_C( 127), -INT8_C(  92), -INT8_C(  49), -INT8_C(  76), -INT8_C( 103),
+         INT8_C( 122),  INT8_C( 126), -INT8_C(   2), -INT8_C(  37),  INT8_C(  72),  INT8_C(  36),  INT8_C(   8),  INT8_C( 120) },
+      {  INT8_C(  47),  INT8_C(  53),  INT8_C(  41),  INT8_C(  39), -INT8_C(  63), -INT8_C( 120),  INT8_C( 125),  INT8_C(  89),
+         INT8_C(  51), -INT8_C(  55), -INT8_C( 122), -INT8_C(  65), -INT8_C(  36), -INT8_C(   5),  INT8_C(  98), -INT8_C(  30),
+        -INT8_C(  69), -INT8_C(  98), -INT8_C(  77),  INT8_C(  32),  INT8_C( 124), -INT8_C(  38),  INT8_C( 119), -INT8_C(  85),
+        -INT8_C(  50), -INT8_C(  83),  INT8_C( 106),  INT8_C(  14), -INT8_C( 122), -INT8_C( 125),  INT8_C( 100), -INT8_C(  30) },
+      {  INT16_C(   434),  INT16_C(   453),  INT16_C(   510),  INT16_C(   182),  INT16_C(   285),  INT16_C(   221),  INT16_C(   440),  INT16_C(   524),
+         INT16_C(   325),  INT16_C(   459),  INT16_C(   129),  INT16_C(   117),  INT16_C(   277),  INT16_C(   218),  INT16_C(   399),  INT16_C(   459) } },
+    { {  INT8_C(  65), -INT8_C(  65), -INT8_C( 118),  INT8_C( 127),  INT8_C(  45),  INT8_C(  61), -INT8_C(  93),  INT8_C(   4),
+         INT8_C(  10), -INT8_C(  84),  INT8_C( 103), -INT8_C(  41),  INT8_C(  48), -INT8_C(  70), -INT8_C( 103),  INT8_C( 112),
+         INT8_C(  68),  INT8_C( 100), -INT8_C(  12), -INT8_C( 127),  INT8_C(  42), -INT8_C(  30),  INT8_C(  15), -INT8_C( 121),
+        -INT8_C(  48), -INT8_C(  51), -INT8_C(   8),  INT8_C( 107), -INT8_C(  79),  INT8_C(  96), -INT8_C( 114), -INT8_C(  67) },
+      {  INT8_C(  99),  INT8_C(  97),  INT8_C(  75),  INT8_C(  39),  INT8_C(  15),  INT8_C(  53), -INT8_C( 115),  INT8_C(  86),
+         INT8_C(  32),  INT8_C(  94), -INT8_C( 102), -INT8_C(  43), -INT8_C(  98), -INT8_C( 123),  INT8_C(  78),  INT8_C(  34),
+        -INT8_C(  80), -INT8_C(  99),  INT8_C( 116),  INT8_C(  70), -INT8_C(  68), -INT8_C(  47), -INT8_C(  70),  INT8_C(  11),
+        -INT8_C(  89), -INT8_C( 108), -INT8_C( 109),  INT8_C( 102), -INT8_C( 106), -INT8_C(  43), -INT8_C(  50),  INT8_C(  51) },
+      {  INT16_C(   304),  INT16_C(   380),  INT16_C(   281),  INT16_C(   259),  INT16_C(   291),  INT16_C(   207),  INT16_C(   262),  INT16_C(   218),
+         INT16_C(   311),  INT16_C(   482),  INT16_C(   504),  INT16_C(   213),  INT16_C(   182),  INT16_C(   326),  INT16_C(   160),  INT16_C(   334) } },
+    { { -INT8_C(  36),  INT8_C( 109), -INT8_C(  13),  INT8_C(  14),  INT8_C(  82), -INT8_C(  86), -INT8_C(  19),  INT8_C( 110),
+        -INT8_C(   2),  INT8_C(  63),  INT8_C( 105), -INT8_C(  67),  INT8_C( 100), -INT8_C(  18), -INT8_C( 103), -INT8_C(  72),
+        -INT8_C(  45), -INT8_C( 108),  INT8_C(  79), -INT8_C(   5),  INT8_C(  94), -INT8_C(  28), -INT8_C( 109),  INT8_C(  26),
+        -INT8_C(  82), -INT8_C(  77),  INT8_C(  78),  INT8_C(  42),  INT8_C(  34),  INT8_C(  70),  INT8_C(   4),  INT8_C( 118) },
+      {  INT8_C(  46), -INT8_C(  92),  INT8_C(  99),  INT8_C( 103), -INT8_C(  63),  INT8_C(  48), -INT8_C(  32), -INT8_C( 113),
+         INT8_C(  38), -INT8_C(  12),  INT8_C(  41),  INT8_C(  57),  INT8_C(  65),  INT8_C( 109), -INT8_C(  67),  INT8_C(  56),
+         INT8_C(  56), -INT8_C( 102),  INT8_C( 105),  INT8_C(  97), -INT8_C(  87),  INT8_C(  68),  INT8_C(   8), -INT8_C(  88),
+        -INT8_C(  51), -INT8_C( 106), -INT8_C(  71),  INT8_C(  64),  INT8_C(  46), -INT8_C(  80),  INT8_C(  21), -INT8_C(  81) },
+      {  INT16_C(   251),  INT16_C(   402),  INT16_C(   554),  INT16_C(   234),  INT16_C(   241),  INT16_C(   548),  INT16_C(   346),  INT16_C(   331),
+         INT16_C(   327),  INT16_C(   304),  INT16_C(   308),  INT16_C(   266),  INT16_C(   312),  INT16_C(   381),  INT16_C(   212),  INT16_C(   311) } },
+    { { -INT8_C(  42), -INT8_C(  51),  INT8_C(  94),  INT8_C(  32),  INT8_C(  76),  INT8_C(  64), -INT8_C(  26), -INT8_C(  17),
+        -INT8_C(  76), -INT8_C(  79), -INT8_C(  62), -INT8_C(  69),  INT8_C(  92), -INT8_C( 116),  INT8_C(  15),  INT8_C(  55),
+         INT8_C(  93), -INT8_C(  91),  INT8_C(   6),  INT8_C(  46),  INT8_C(  32), -INT8_C( 118),  INT8_C( 109),  INT8_C(  89),
+         INT8_C( 113), -INT8_C(  37), -INT8_C(   8), -INT8_C( 121), -INT8_C( 116),  INT8_C( 127),  INT8_C(  59),  INT8_C( 115) },
+      {  INT8_C(  41), -INT8_C( 103),  INT8_C(  54), -INT8_C( 120), -INT8_C( 101), -INT8_C( 106),  INT8_C(  19), -INT8_C(  49),
+         INT8_C(  54), -INT8_C( 108), -INT8_C(   3),  INT8_C( 100), -INT8_C(  66), -INT8_C(  89),  INT8_C( 124),  INT8_C( 116),
+        -INT8_C(  36),  INT8_C(  65), -INT8_C( 103),  INT8_C(  26),  INT8_C( 116), -INT8_C( 106),  INT8_C(  97),  INT8_C(  41),
+        -INT8_C(  61), -INT8_C(  16), -INT8_C(  95),  INT8_C(  44), -INT8_C(  10), -INT8_C(  83), -INT8_C(  86),  INT8_C(  47) },
+      {  INT16_C(   176),  INT16_C(   172),  INT16_C(   367),  INT16_C(   146),  INT16_C(   247),  INT16_C(   347),  INT16_C(   264),  INT16_C(   353),
+         INT16_C(   326),  INT16_C(   275),  INT16_C(   466),  INT16_C(   275),  INT16_C(   317),  INT16_C(   451),  INT16_C(   340),  INT16_C(   236) } },
+    { { -INT8_C(   6),  INT8_C(  21),  INT8_C(  63),  INT8_C(  81), -INT8_C(  21), -INT8_C( 122),  INT8_C( 107), -INT8_C( 125),
+         INT8_C(  24), -INT8_C(  30),  INT8_C(  59), -INT8_C(  43), -INT8_C(  94),  INT8_C(  61),  INT8_C(  93), -INT8_C(  31),
+        -INT8_C( 120),  INT8_C(  99),  INT8_C(  77),  INT8_C(  73), -INT8_C(   7), -INT8_C(  40),  INT8_C(  87),  INT8_C(  43),
+         INT8_C(  87), -INT8_C(  81),  INT8_C( 116), -INT8_C(  82),  INT8_C(  83),  INT8_C( 103),  INT8_C(  27), -INT8_C(  17) },
+      { -INT8_C(  10),  INT8_C(  23),  INT8_C(  79), -INT8_C(  27),  INT8_C( 120), -INT8_C(  54),  INT8_C( 121),  INT8_C(   7),
+         INT8_C( 107),  INT8_C(  93), -INT8_C(  51),  INT8_C(  18), -INT8_C(  98), -INT8_C(  35),  INT8_C(  50), -INT8_C(  98),
+        -INT8_C(  93), -INT8_C(  32), -INT8_C(  37), -INT8_C(  94),  INT8_C(  87), -INT8_C( 115),  INT8_C(  56),  INT8_C(  82),
+        -INT8_C( 126), -INT8_C(  39),  INT8_C(  60), -INT8_C(  78),  INT8_C( 107),  INT8_C( 105), -INT8_C(  49),  INT8_C(  62) },
+      {  INT16_C(   382),  INT16_C(   179),  INT16_C(   247),  INT16_C(   192),  INT16_C(   388),  INT16_C(   368),  INT16_C(   450),  INT16_C(   556),
+         INT16_C(   176),  INT16_C(   211),  INT16_C(   413),  INT16_C(   420),  INT16_C(   186),  INT16_C(   218),  INT16_C(   199),  INT16_C(   278) } },
+    { {  INT8_C(  93),  INT8_C(  55),  INT8_C(  87), -INT8_C(  73), -INT8_C( 106),  INT8_C(  83),  INT8_C(  49),  INT8_C(  69),
+         INT8_C(  43), -INT8_C(  57), -INT8_C(  50), -INT8_C(  91), -INT8_C( 114),  INT8_C(  69), -INT8_C(  73), -INT8_C(  78),
+         INT8_C(  29), -INT8_C(  35),  INT8_C(  62),  INT8_C(  58),  INT8_C(  94), -INT8_C(  46),  INT8_C( 111), -INT8_C(  55),
+         INT8_C( 126), -INT8_C(  44),  INT8_C(  65), -INT8_C(  99), -INT8_C( 104),  INT8_C(  23), -INT8_C(  99), -INT8_C( 104) },
+      {  INT8_C(  94), -INT8_C( 126),  INT8_C(  61), -INT8_C( 119), -INT8_C( 122),  INT8_C(  17), -INT8_C(  59),      INT8_MIN,
+        -INT8_C( 113), -INT8_C( 120),  INT8_C(  35), -INT8_C(  61), -INT8_C(  26),  INT8_C(  71), -INT8_C(  67),  INT8_C(  26),
+        -INT8_C(  56), -INT8_C(  37),  INT8_C(  28), -INT8_C(  82),  INT8_C( 125),  INT8_C(  97), -INT8_C(  97), -INT8_C(  66),
+        -INT8_C( 111),  INT8_C(  16),  INT8_C(  66), -INT8_C(  80), -INT8_C( 115),  INT8_C(  12), -INT8_C(   6), -INT8_C( 105) },
+      {  INT16_C(   412),  INT16_C(   257),  INT16_C(   257),  INT16_C(   305),  INT16_C(   319),  INT16_C(   177),  INT16_C(   251),  INT16_C(   209),
+         INT16_C(   602),  INT16_C(   222),  INT16_C(   434),  INT16_C(   352),  INT16_C(   243),  INT16_C(   250),  INT16_C(   284),  INT16_C(   401) } },
+    { { -INT8_C(  53), -INT8_C(  56),  INT8_C(  85),  INT8_C(  95), -INT8_C(  65),  INT8_C(  44), -INT8_C(  44),  INT8_C(  11),
+         INT8_C( 111), -INT8_C(  93), -INT8_C(  96),  INT8_C(  31),  INT8_C(  77), -INT8_C(  25), -INT8_C(  96),  INT8_C( 119),
+         INT8_C(  35), -INT8_C(  85),  INT8_C( 112), -INT8_C(  36),  INT8_C(  83), -INT8_C(  31),  INT8_C(  92), -INT8_C(  50),
+        -INT8_C(  93), -INT8_C(  42),  INT8_C(  67),  INT8_C(  41),  INT8_C( 117), -INT8_C(  27), -INT8_C(  74), -INT8_C(  49) },
+      {  INT8_C(   8),  INT8_C( 104),  INT8_C(  80),  INT8_C(  86),  INT8_C(  32), -INT8_C( 100), -INT8_C(  85),  INT8_C(   8),
+        -INT8_C(  32), -INT8_C(  39), -INT8_C( 102), -INT8_C(  15),  INT8_C(   0),  INT8_C(  24), -INT8_C(  52), -INT8_C( 111),
+         INT8_C(  10),  INT8_C(  56),  INT8_C(  60),  INT8_C(   6),  INT8_C( 112), -INT8_C( 120),  INT8_C(  39), -INT8_C(  39),
+         INT8_C(  50), -INT8_C(  50),  INT8_C(  85),  INT8_C( 107),  INT8_C(   7),  INT8_C(  13), -INT8_C( 101), -INT8_C(  10) },
+      {  INT16_C(   548),  INT16_C(   372),  INT16_C(   332),  INT16_C(   374),  INT16_C(   120),  INT16_C(   228),  INT16_C(   484),  INT16_C(   387),
+         INT16_C(   255),  INT16_C(   342),  INT16_C(   135),  INT16_C(   573),  INT16_C(   333),  INT16_C(   383),  INT16_C(   413),  INT16_C(   592) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi8(test_vec[i].b);
+    simde__m256i r = simde_mm256_dbsad_epu8(a, b, INT32_C( 27));
+    simde_test_x86_assert_equal_i16x16(r, simde_x_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_dbsad_epu8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[16];
+    const simde__mmask16 k;
+    const int8_t a[32];
+    const int8_t b[32];
+    const int16_t r[16];
+  } test_vec[] = {
+    { {  INT16_C(  6270),  INT16_C( 13254), -INT16_C( 20695), -INT16_C(  7202),  INT16_C( 27022),  INT16_C( 30923),  INT16_C( 13770), -INT16_C( 15549),
+        -INT16_C( 15854), -INT16_C( 12983),  INT16_C( 12744), -INT16_C( 24313),  INT16_C(  5632),  INT16_C( 13192), -INT16_C( 32479), -INT16_C( 13314) },
+      UINT16_C(39244),
+      { -INT8_C(  86), -INT8_C(  97), -INT8_C(  30), -INT8_C(  11),  INT8_C( 118), -INT8_C( 116), -INT8_C( 111), -INT8_C(  80),
+        -INT8_C(  93), -INT8_C(  58),  INT8_C(  79),  INT8_C(  23), -INT8_C(  39), -INT8_C(  38),  INT8_C( 123), -INT8_C(  57),
+         INT8_C( 118), -INT8_C(  66),  INT8_C(  73),  INT8_C( 125),  INT8_C(  37), -INT8_C(  21),  INT8_C(  24),  INT8_C(  10),
+         INT8_C(  82), -INT8_C( 108),  INT8_C(  61),  INT8_C( 121), -INT8_C(  71),  INT8_C(  54), -INT8_C(  44),  INT8_C( 121) },
+      { -INT8_C(  16),  INT8_C(  31),  INT8_C(  35), -INT8_C( 103),  INT8_C(  72), -INT8_C(  24), -INT8_C(  11), -INT8_C(  34),
+         INT8_C(   9), -INT8_C( 107), -INT8_C(  52), -INT8_C( 113),  INT8_C(  64), -INT8_C( 124),  INT8_C(  63), -INT8_C( 125),
+        -INT8_C(  52),  INT8_C( 123), -INT8_C( 105), -INT8_C(  58),  INT8_C(   7),  INT8_C(  25), -INT8_C(  51),  INT8_C(  74),
+         INT8_C( 120),  INT8_C(  54),  INT8_C(   4), -INT8_C(  46),  INT8_C(  43),  INT8_C(  49), -INT8_C(  73),  INT8_C(  48) },
+      {  INT16_C(  6270),  INT16_C( 13254),  INT16_C(   225),  INT16_C(   259),  INT16_C( 27022),  INT16_C( 30923),  INT16_C(   214), -INT16_C( 15549),
+         INT16_C(   304), -INT16_C( 12983),  INT16_C( 12744),  INT16_C(   585),  INT16_C(   278),  INT16_C( 13192), -INT16_C( 32479),  INT16_C(   261) } },
+    { {  INT16_C( 22434),  INT16_C( 28349),  INT16_C( 12328),  INT16_C( 21914), -INT16_C( 29537),  INT16_C( 26777),  INT16_C( 28794), -INT16_C( 10288),
+         INT16_C(  3188), -INT16_C( 27060),  INT16_C( 19139), -INT16_C(  1612),  INT16_C( 31714),  INT16_C( 10475), -INT16_C( 10860), -INT16_C( 10324) },
+      UINT16_C(  997),
+      {  INT8_C(  39),  INT8_C(  11),  INT8_C(  73),  INT8_C(  39), -INT8_C( 127), -INT8_C( 116),  INT8_C( 113), -INT8_C(  29),
+        -INT8_C(  92), -INT8_C(  23),  INT8_C( 126),  INT8_C(  94), -INT8_C( 110), -INT8_C( 125),  INT8_C(  68), -INT8_C(  30),
+         INT8_C(  53),  INT8_C(  99), -INT8_C(  83),  INT8_C(   2),      INT8_MIN,  INT8_C(  93), -INT8_C(  71), -INT8_C(  98),
+        -INT8_C(  69), -INT8_C( 114), -INT8_C(  21),  INT8_C( 106),  INT8_C(  62),  INT8_C(  66),  INT8_C( 102),  INT8_C(  40) },
+      {  INT8_C(  69),  INT8_C( 111),  INT8_C(  65), -INT8_C(  95), -INT8_C(  24),  INT8_C(  79), -INT8_C(  15),  INT8_C(  74),
+         INT8_C(  64),  INT8_C(  62), -INT8_C( 124), -INT8_C(  37), -INT8_C( 106),  INT8_C( 127), -INT8_C( 103),  INT8_C( 122),
+        -INT8_C(  34),  INT8_C(  35),  INT8_C(  29), -INT8_C(  39),  INT8_C(   0), -INT8_C( 102), -INT8_C(  71), -INT8_C( 106),
+        -INT8_C(  57),  INT8_C(  64), -INT8_C(  78), -INT8_C( 115),  INT8_C(  78),  INT8_C( 102), -INT8_C( 108),  INT8_C( 103) },
+      {  INT16_C(   260),  INT16_C( 28349),  INT16_C(   352),  INT16_C( 21914), -INT16_C( 29537),  INT16_C(   352),  INT16_C(   283),  INT16_C(   224),
+         INT16_C(   592),  INT16_C(   134),  INT16_C( 19139), -INT16_C(  1612),  INT16_C( 31714),  INT16_C( 10475), -INT16_C( 10860), -INT16_C( 10324) } },
+    { {  INT16_C(  7457), -INT16_C(   657), -INT16_C( 11868),  INT16_C(   426),  INT16_C( 30589),  INT16_C(  4975), -INT16_C( 27275),  INT16_C( 12340),
+        -INT16_C(  3110), -INT16_C( 30822),  INT16_C( 32658),  INT16_C( 17175),  INT16_C( 19083),  INT16_C(  3978),  INT16_C(  5399), -INT16_C( 11915) },
+      UINT16_C(47637),
+      { -INT8_C(  36),  INT8_C(  85), -INT8_C( 127), -INT8_C(  52),  INT8_C(  15), -INT8_C(  43), -INT8_C(  40),  INT8_C(  55),
+         INT8_C(  29),  INT8_C(  91), -INT8_C(  13), -INT8_C(  68),  INT8_C(  15), -INT8_C(  25), -INT8_C(  28),  INT8_C(  35),
+        -INT8_C(  29),  INT8_C(  26),  INT8_C(   0),  INT8_C(  44), -INT8_C(  24), -INT8_C( 109), -INT8_C(  54), -INT8_C( 117),
+             INT8_MIN, -INT8_C(  11), -INT8_C(  44), -INT8_C(   9),  INT8_C( 106),  INT8_C(  58), -INT8_C(  18),  INT8_C(  77) },
+      {  INT8_C(  93),  INT8_C(  91),  INT8_C(  95),  INT8_C(  31), -INT8_C(  31),  INT8_C(  78),      INT8_MIN, -INT8_C(  35),
+        -INT8_C(  12),  INT8_C(  89), -INT8_C(  57),  INT8_C(   6),  INT8_C(  90),  INT8_C(  54), -INT8_C(  64),  INT8_C( 103),
+         INT8_C(  95),  INT8_C( 109),  INT8_C( 121),  INT8_C( 115),  INT8_C(  87),  INT8_C(   1), -INT8_C(  69),  INT8_C( 124),
+         INT8_C(   6), -INT8_C(  16), -INT8_C(  91), -INT8_C(  56), -INT8_C(  17),  INT8_C(   0),  INT8_C(  62), -INT8_C(   8) },
+      {  INT16_C(   340), -INT16_C(   657),  INT16_C(   294),  INT16_C(   426),  INT16_C(   443),  INT16_C(  4975), -INT16_C( 27275),  INT16_C( 12340),
+        -INT16_C(  3110),  INT16_C(   371),  INT16_C( 32658),  INT16_C(   426),  INT16_C(   221),  INT16_C(   212),  INT16_C(  5399),  INT16_C(   528) } },
+    { {  INT16_C( 23044),  INT16_C( 11710),  INT16_C(  1825),  INT16_C( 12021),  INT16_C( 24656), -INT16_C( 16936),  INT16_C(   618), -INT16_C( 16440),
+         INT16_C(  9822),  INT16_C(  2084), -INT16_C(  4568), -INT16_C(  9955), -INT16_C( 24612), -INT16_C( 14414), -INT16_C(  3472), -INT16_C( 24781) },
+      UINT16_C(11356),
+      {  INT8_C(   5), -INT8_C(  63),  INT8_C( 108), -INT8_C(  98), -INT8_C(  25),  INT8_C( 126), -INT8_C(  80), -INT8_C(  55),
+         INT8_C( 120), -INT8_C(  26), -INT8_C(   7),  INT8_C(   4), -INT8_C( 100), -INT8_C(  23), -INT8_C( 110), -INT8_C( 103),
+         INT8_C(  12),  INT8_C(  94),  INT8_C(  98), -INT8_C(  60), -INT8_C(  25),  INT8_C( 116),  INT8_C(  58),  INT8_C(   8),
+        -INT8_C( 114),  INT8_C(  35), -INT8_C( 105), -INT8_C(  36),  INT8_C( 115),  INT8_C(  87),  INT8_C(  37),  INT8_C(  11) },
+      {  INT8_C(  78), -INT8_C(  44),  INT8_C( 105), -INT8_C(  33),  INT8_C(  14),  INT8_C(  70), -INT8_C(  86), -INT8_C(  91),
+         INT8_C(  20),  INT8_C(  46),  INT8_C(  16), -INT8_C( 124), -INT8_C(  87),  INT8_C(  66),  INT8_C(  98),  INT8_C( 118),
+         INT8_C(  44), -INT8_C(  42),  INT8_C( 109), -INT8_C( 117), -INT8_C(   6),  INT8_C(  97), -INT8_C( 123), -INT8_C(  34),
+        -INT8_C(  59),  INT8_C(  48), -INT8_C( 108), -INT8_C(  83), -INT8_C(  60), -INT8_C(  35), -INT8_C(  34), -INT8_C(  83) },
+      {  INT16_C( 23044),  INT16_C( 11710),  INT16_C(   516),  INT16_C(   257),  INT16_C(   645), -INT16_C( 16936),  INT16_C(   351), -INT16_C( 16440),
+         INT16_C(  9822),  INT16_C(  2084),  INT16_C(   426),  INT16_C(   390), -INT16_C( 24612),  INT16_C(   253), -INT16_C(  3472), -INT16_C( 24781) } },
+    { {  INT16_C( 17173), -INT16_C( 22209),  INT16_C( 21056),  INT16_C( 30676),  INT16_C( 11041),  INT16_C(  5801),  INT16_C( 19890), -INT16_C( 24433),
+        -INT16_C( 32511),  INT16_C( 25100), -INT16_C( 24700),  INT16_C( 21986), -INT16_C( 30921), -INT16_C( 11190),  INT16_C( 18643),  INT16_C(   414) },
+      UINT16_C(34393),
+      {  INT8_C(  56),  INT8_C(  62),  INT8_C(  28), -INT8_C(  92), -INT8_C(  53),  INT8_C(  78),  INT8_C(  54),  INT8_C(  92),
+        -INT8_C(  84), -INT8_C(  11), -INT8_C(   4), -INT8_C( 111), -INT8_C(  42), -INT8_C(   9),  INT8_C(  18), -INT8_C(  56),
+         INT8_C(  63),  INT8_C(  95),  INT8_C(  41),  INT8_C(  87), -INT8_C(  71),  INT8_C(  98), -INT8_C(  90), -INT8_C(  87),
+        -INT8_C( 122),  INT8_C(  49), -INT8_C( 107), -INT8_C(  66), -INT8_C( 117),  INT8_C(  84),  INT8_C(  26),  INT8_C( 120) },
+      { -INT8_C(  35),  INT8_C(  54),  INT8_C(  60),  INT8_C(  64), -INT8_C(  76), -INT8_C(  21),  INT8_C( 126),  INT8_C(   4),
+         INT8_C(  58),  INT8_C( 104),  INT8_C(  60), -INT8_C(  12),  INT8_C(  93), -INT8_C(  69),  INT8_C(   4),  INT8_C(  86),
+         INT8_C( 112), -INT8_C(  38),  INT8_C(  35), -INT8_C(  51), -INT8_C(  84),  INT8_C(  35),  INT8_C(  49), -INT8_C(  65),
+        -INT8_C(  62), -INT8_C(  43),  INT8_C(  36), -INT8_C(  76), -INT8_C(   7), -INT8_C(   2),  INT8_C( 101),  INT8_C(  49) },
+      {  INT16_C(   305), -INT16_C( 22209),  INT16_C( 21056),  INT16_C(   456),  INT16_C(   546),  INT16_C(  5801),  INT16_C(   245), -INT16_C( 24433),
+        -INT16_C( 32511),  INT16_C(   464),  INT16_C(   397),  INT16_C( 21986), -INT16_C( 30921), -INT16_C( 11190),  INT16_C( 18643),  INT16_C(   453) } },
+    { { -INT16_C( 20980),  INT16_C( 16761), -INT16_C( 32465), -INT16_C( 30708), -INT16_C( 29855),  INT16_C( 14856), -INT16_C( 20572),  INT16_C(  1102),
+         INT16_C(  4594),  INT16_C(  5403), -INT16_C(  5811),  INT16_C(  7056),  INT16_C( 16145), -INT16_C( 23841),  INT16_C( 26925),  INT16_C(  3221) },
+      UINT16_C(39423),
+      { -INT8_C(  88),  INT8_C(  11), -INT8_C(   9), -INT8_C( 108), -INT8_C(  59),  INT8_C(   4),  INT8_C(  62), -INT8_C( 110),
+        -INT8_C(  89), -INT8_C(  30),  INT8_C(  71),  INT8_C(  27),  INT8_C(  95), -INT8_C(  51), -INT8_C( 110),  INT8_C(  23),
+        -INT8_C(  83), -INT8_C(  64),  INT8_C(  65),  INT8_C(  97),  INT8_C(  93),  INT8_C(   5), -INT8_C(  25),  INT8_C( 100),
+         INT8_C(  56),  INT8_C(  54), -INT8_C(  54), -INT8_C(  57),      INT8_MIN,  INT8_C(  55), -INT8_C(   7), -INT8_C( 102) },
+      {  INT8_C(  56), -INT8_C( 120), -INT8_C(  71),  INT8_C(  88), -INT8_C( 120),  INT8_C( 111),  INT8_C( 105), -INT8_C( 105),
+        -INT8_C(  40),  INT8_C(  41), -INT8_C( 109), -INT8_C(  12),  INT8_C(  21), -INT8_C(  31), -INT8_C(  24), -INT8_C(  59),
+         INT8_C( 106),  INT8_C( 104),  INT8_C(  36),  INT8_C(   8), -INT8_C(  82),  INT8_C( 101), -INT8_C(  77),  INT8_C(  56),
+        -INT8_C( 112), -INT8_C(  29),      INT8_MIN, -INT8_C(  29), -INT8_C(  32), -INT8_C(  37), -INT8_C( 108), -INT8_C(  63) },
+      {  INT16_C(   359),  INT16_C(   377),  INT16_C(   205),  INT16_C(   331),  INT16_C(   527),  INT16_C(   384),  INT16_C(   418),  INT16_C(   621),
+         INT16_C(   273),  INT16_C(  5403), -INT16_C(  5811),  INT16_C(   463),  INT16_C(   363), -INT16_C( 23841),  INT16_C( 26925),  INT16_C(   304) } },
+    { { -INT16_C(  6331), -INT16_C( 31720), -INT16_C( 13133), -INT16_C( 28949), -INT16_C( 16653), -INT16_C( 31461),  INT16_C(  1562), -INT16_C( 13236),
+        -INT16_C( 11617),  INT16_C( 12465),  INT16_C(  7290),  INT16_C( 28234),  INT16_C( 28780), -INT16_C(  1448),  INT16_C(  3403), -INT16_C(  3355) },
+      UINT16_C(56639),
+      {  INT8_C(  10),  INT8_C(  96), -INT8_C(  30), -INT8_C(  85), -INT8_C(  40), -INT8_C(  87),  INT8_C(  38),  INT8_C(  32),
+        -INT8_C(  56), -INT8_C(  35),  INT8_C(  34),  INT8_C(  40),  INT8_C(  24),  INT8_C(   6), -INT8_C(  34),  INT8_C( 109),
+         INT8_C( 121),  INT8_C(  35),  INT8_C(  53),  INT8_C(  85), -INT8_C(  41), -INT8_C(  56), -INT8_C(  53), -INT8_C(  32),
+         INT8_C(  39), -INT8_C( 113),  INT8_C(  42), -INT8_C(  64), -INT8_C(  37),  INT8_C(  44),  INT8_C(  22), -INT8_C(  68) },
+      {  INT8_C(   5),  INT8_C(  67),  INT8_C( 127),  INT8_C(  17), -INT8_C(  57), -INT8_C(  96),  INT8_C(  73),  INT8_C(  29),
+         INT8_C(  37), -INT8_C(  37), -INT8_C(  86),  INT8_C(  13), -INT8_C(  11), -INT8_C( 126),  INT8_C(  51),  INT8_C(  51),
+         INT8_C(  83), -INT8_C(  43),  INT8_C(  80), -INT8_C(  14), -INT8_C( 123),  INT8_C(  94), -INT8_C(  80), -INT8_C(  55),
+        -INT8_C(  82), -INT8_C(  35), -INT8_C(  80),  INT8_C(  89),  INT8_C( 107), -INT8_C(  93),  INT8_C(  90), -INT8_C( 108) },
+      {  INT16_C(   287),  INT16_C(   325),  INT16_C(   530),  INT16_C(   392),  INT16_C(   328),  INT16_C(   296),  INT16_C(  1562), -INT16_C( 13236),
+         INT16_C(   400),  INT16_C( 12465),  INT16_C(   377),  INT16_C(   251),  INT16_C(   450), -INT16_C(  1448),  INT16_C(   198),  INT16_C(   432) } },
+    { { -INT16_C( 12609), -INT16_C( 10435), -INT16_C(  2968),  INT16_C( 14117), -INT16_C(  8925),  INT16_C( 10354),  INT16_C( 28726), -INT16_C( 29224),
+         INT16_C(  6676),  INT16_C(  6606), -INT16_C( 23933),  INT16_C(   851), -INT16_C( 31367),  INT16_C(  4636),  INT16_C( 20456),  INT16_C(  1823) },
+      UINT16_C(62233),
+      { -INT8_C(  55),  INT8_C(  80), -INT8_C(  70), -INT8_C( 125),  INT8_C(  14), -INT8_C(  44),  INT8_C(  39),  INT8_C(  67),
+         INT8_C(   5),  INT8_C(   3), -INT8_C(  45),  INT8_C(  12), -INT8_C(  38), -INT8_C(  51), -INT8_C(  72),  INT8_C( 105),
+         INT8_C(  25),  INT8_C(  85), -INT8_C(  49), -INT8_C(  18),  INT8_C(  53),  INT8_C(  59), -INT8_C(  33), -INT8_C(  28),
+         INT8_C(  33),  INT8_C(  39),  INT8_C(  37), -INT8_C(  89), -INT8_C( 100),  INT8_C(  19),  INT8_C(  39), -INT8_C( 113) },
+      {  INT8_C(  49),  INT8_C(   7),  INT8_C(  79), -INT8_C(  87),  INT8_C(  14), -INT8_C(  56),  INT8_C(  29), -INT8_C(  35),
+         INT8_C(  12), -INT8_C(  80), -INT8_C( 117),  INT8_C(  58), -INT8_C(  52),  INT8_C( 125), -INT8_C(  77), -INT8_C( 120),
+        -INT8_C(  63), -INT8_C(  48), -INT8_C(  21), -INT8_C( 126),  INT8_C(  83),  INT8_C(  83), -INT8_C(  97), -INT8_C( 110),
+         INT8_C(   9),  INT8_C(  97), -INT8_C( 123),  INT8_C(  22),  INT8_C( 104), -INT8_C( 106),  INT8_C( 115), -INT8_C(  13) },
+      {  INT16_C(   370), -INT16_C( 10435), -INT16_C(  2968),  INT16_C(   552),  INT16_C(   298),  INT16_C( 10354),  INT16_C( 28726), -INT16_C( 29224),
+         INT16_C(   427),  INT16_C(   565), -INT16_C( 23933),  INT16_C(   851),  INT16_C(   323),  INT16_C(   236),  INT16_C(    98),  INT16_C(   358) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi16(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi8(test_vec[i].b);
+    simde__m256i r = simde_mm256_mask_dbsad_epu8(src, test_vec[i].k, a, b, INT32_C(228));
+    simde_test_x86_assert_equal_i16x16(r, simde_x_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_dbsad_epu8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int8_t a[32];
+    const int8_t b[32];
+    const int16_t r[16];
+  } test_vec[] = {
+    { UINT16_C(56559),
+      { -INT8_C( 106),  INT8_C(  91),  INT8_C(  55),  INT8_C( 111), -INT8_C(  15), -INT8_C(  22),  INT8_C(  47),  INT8_C(  73),
+        -INT8_C(  45), -INT8_C(  84),  INT8_C(  31),  INT8_C(   7),  INT8_C(  57), -INT8_C(  63), -INT8_C(  38), -INT8_C(  93),
+         INT8_C(  12), -INT8_C( 102),  INT8_C(  95), -INT8_C(  23),  INT8_C(  64),  INT8_C(  14),  INT8_C( 118), -INT8_C(  72),
+         INT8_C(  43), -INT8_C(   9),  INT8_C( 120), -INT8_C(  24), -INT8_C(  77),  INT8_C(  88), -INT8_C(  48),  INT8_C(  25) },
+      { -INT8_C(  50), -INT8_C(  81), -INT8_C( 114),  INT8_C(  49), -INT8_C(  51), -INT8_C(  80), -INT8_C(  57), -INT8_C(  26),
+         INT8_C(  11), -INT8_C( 125), -INT8_C(  16),  INT8_C(  27), -INT8_C( 105),  INT8_C(  48), -INT8_C(  36), -INT8_C(  37),
+         INT8_C( 108),  INT8_C(  16),  INT8_C(   8), -INT8_C(  28),  INT8_C(  31), -INT8_C(  13), -INT8_C(  32),  INT8_C(  43),
+         INT8_C(  69),  INT8_C( 105),  INT8_C(  27),  INT8_C(  71), -INT8_C(  79), -INT8_C( 106), -INT8_C(  71),  INT8_C(  74) },
+      {  INT16_C(   403),  INT16_C(   409),  INT16_C(   140),  INT16_C(   485),  INT16_C(     0),  INT16_C(   598),  INT16_C(   213),  INT16_C(   239),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(   317),  INT16_C(   246),  INT16_C(   454),  INT16_C(     0),  INT16_C(   129),  INT16_C(   334) } },
+    { UINT16_C(47573),
+      { -INT8_C(  26),  INT8_C(   9), -INT8_C(  91), -INT8_C( 106), -INT8_C( 109), -INT8_C(   8), -INT8_C(  29), -INT8_C(  94),
+        -INT8_C(  13), -INT8_C(  52),  INT8_C(  99), -INT8_C( 115),  INT8_C(   6),  INT8_C( 126), -INT8_C(   6),  INT8_C(  19),
+         INT8_C( 115), -INT8_C(  35),  INT8_C(  82),  INT8_C(  66), -INT8_C(  68),  INT8_C(  81), -INT8_C(  87), -INT8_C( 120),
+         INT8_C(  27), -INT8_C(   1),  INT8_C(  70),  INT8_C(  86), -INT8_C(  48), -INT8_C(  47),  INT8_C(  48),  INT8_C( 102) },
+      { -INT8_C( 102), -INT8_C(  23),  INT8_C(  24),  INT8_C(  68), -INT8_C(  88),  INT8_C(  63),  INT8_C(  29), -INT8_C( 123),
+        -INT8_C(  38), -INT8_C(  75),  INT8_C(  56),  INT8_C(  78),  INT8_C(  34),  INT8_C(  42),  INT8_C(  14), -INT8_C(  52),
+         INT8_C( 113), -INT8_C(  23), -INT8_C(  42), -INT8_C( 115),  INT8_C(  20),  INT8_C(  56), -INT8_C(  18),  INT8_C(  67),
+         INT8_C(  53), -INT8_C(   7),  INT8_C(  18),  INT8_C( 122), -INT8_C(  10),  INT8_C(  79),  INT8_C(  51),  INT8_C(  25) },
+      {  INT16_C(   269),  INT16_C(     0),  INT16_C(   261),  INT16_C(     0),  INT16_C(   519),  INT16_C(     0),  INT16_C(   396),  INT16_C(   248),
+         INT16_C(   417),  INT16_C(     0),  INT16_C(     0),  INT16_C(   347),  INT16_C(   475),  INT16_C(   328),  INT16_C(     0),  INT16_C(   576) } },
+    { UINT16_C(20864),
+      {  INT8_C(  35),  INT8_C(  89),  INT8_C(  17), -INT8_C(   3),  INT8_C(  30),  INT8_C(   0), -INT8_C(   2),  INT8_C( 117),
+         INT8_C(  15), -INT8_C(  39), -INT8_C(  48), -INT8_C( 109), -INT8_C(  74),  INT8_C(  77), -INT8_C(  13), -INT8_C(  20),
+        -INT8_C(  87), -INT8_C(  16), -INT8_C(  57), -INT8_C(  96),  INT8_C(  69),  INT8_C(   5), -INT8_C(  91),  INT8_C( 120),
+         INT8_C(  12),  INT8_C(  64),  INT8_C( 124), -INT8_C(  28),  INT8_C(  71),  INT8_C(  81), -INT8_C( 125),  INT8_C(  68) },
+      { -INT8_C(  65),  INT8_C(  54), -INT8_C(  20),  INT8_C(  39),  INT8_C( 119), -INT8_C(  17), -INT8_C(  14), -INT8_C(  29),
+         INT8_C(  90),  INT8_C(  88), -INT8_C(  72),  INT8_C(  53),  INT8_C(  11), -INT8_C(  61), -INT8_C( 108),  INT8_C(  11),
+        -INT8_C(  41),  INT8_C(  96),  INT8_C(  38),  INT8_C(  72), -INT8_C(  30),  INT8_C(  37), -INT8_C(  53),  INT8_C( 110),
+         INT8_C(   2), -INT8_C(  32),  INT8_C( 107),  INT8_C( 123),  INT8_C(  47), -INT8_C(  59),  INT8_C(  30),  INT8_C(  24) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   474),
+         INT16_C(   314),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   466),  INT16_C(     0),  INT16_C(   210),  INT16_C(     0) } },
+    { UINT16_C(58713),
+      { -INT8_C(  45), -INT8_C(  34),  INT8_C(  79),  INT8_C(  69),  INT8_C(  81), -INT8_C( 111), -INT8_C(  98),  INT8_C(  19),
+         INT8_C(  25), -INT8_C(  87), -INT8_C(  54), -INT8_C(  13),  INT8_C( 124), -INT8_C(  50), -INT8_C( 115), -INT8_C(  84),
+         INT8_C(  91),  INT8_C(  15), -INT8_C(  39),  INT8_C( 122), -INT8_C(  98), -INT8_C(  33), -INT8_C(  98),  INT8_C(  11),
+        -INT8_C(  31), -INT8_C(  48), -INT8_C(  79),  INT8_C(  48),  INT8_C(  70), -INT8_C(  82), -INT8_C(  27),  INT8_C( 124) },
+      {  INT8_C(  45), -INT8_C(  79), -INT8_C(  70), -INT8_C( 107),  INT8_C(   2), -INT8_C(  74), -INT8_C(  59),  INT8_C( 124),
+        -INT8_C(  48), -INT8_C( 127), -INT8_C(  12),  INT8_C( 103),  INT8_C(  51),  INT8_C(  23), -INT8_C(  27), -INT8_C(  74),
+        -INT8_C(  45), -INT8_C(  10),  INT8_C( 125), -INT8_C(  49),  INT8_C( 102), -INT8_C(  48), -INT8_C(   3),  INT8_C(   4),
+        -INT8_C( 110),  INT8_C(  33), -INT8_C(  43),  INT8_C(  42),  INT8_C(  34), -INT8_C(  50), -INT8_C( 103),  INT8_C(  38) },
+      {  INT16_C(   422),  INT16_C(     0),  INT16_C(     0),  INT16_C(   360),  INT16_C(   260),  INT16_C(     0),  INT16_C(   230),  INT16_C(     0),
+         INT16_C(   358),  INT16_C(     0),  INT16_C(   348),  INT16_C(     0),  INT16_C(     0),  INT16_C(   376),  INT16_C(   359),  INT16_C(    87) } },
+    { UINT16_C(11749),
+      { -INT8_C(   2), -INT8_C(  57),  INT8_C(   0), -INT8_C(  68), -INT8_C( 123),  INT8_C( 104),  INT8_C( 122), -INT8_C(  96),
+        -INT8_C(  15),  INT8_C(  40), -INT8_C( 114),  INT8_C(  35),  INT8_C( 105), -INT8_C(  51),  INT8_C(  64), -INT8_C(  70),
+         INT8_C(  95), -INT8_C(  37),  INT8_C(  32),  INT8_C( 106),  INT8_C(  68), -INT8_C( 122),  INT8_C( 105), -INT8_C( 101),
+        -INT8_C(  24),  INT8_C(  41), -INT8_C(  87),  INT8_C(  82),  INT8_C(  66),  INT8_C(  22),  INT8_C( 118), -INT8_C( 122) },
+      {  INT8_C(  80), -INT8_C( 120), -INT8_C(  69), -INT8_C(  22), -INT8_C(  69), -INT8_C( 126), -INT8_C(  55),  INT8_C(  24),
+         INT8_C(  46), -INT8_C(  96),  INT8_C(  69), -INT8_C(  57), -INT8_C( 118), -INT8_C(  53), -INT8_C(  94),  INT8_C(  57),
+        -INT8_C( 101),  INT8_C( 110), -INT8_C( 116), -INT8_C(  69),  INT8_C(  22),  INT8_C( 114), -INT8_C(  88), -INT8_C(  61),
+         INT8_C(  68), -INT8_C(  82), -INT8_C(  45),  INT8_C(  64), -INT8_C(  28), -INT8_C(  19),  INT8_C( 118),  INT8_C(  74) },
+      {  INT16_C(   501),  INT16_C(     0),  INT16_C(   224),  INT16_C(     0),  INT16_C(     0),  INT16_C(   290),  INT16_C(   271),  INT16_C(   246),
+         INT16_C(   403),  INT16_C(     0),  INT16_C(   217),  INT16_C(   318),  INT16_C(     0),  INT16_C(   250),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C( 6255),
+      { -INT8_C(  97),  INT8_C(  84),  INT8_C(  14),  INT8_C(   6), -INT8_C(  34), -INT8_C(  49), -INT8_C(  12),  INT8_C(  39),
+        -INT8_C(  75),  INT8_C(  24), -INT8_C( 106), -INT8_C(  29),  INT8_C(  86),  INT8_C( 112), -INT8_C(  68),  INT8_C(  47),
+        -INT8_C(  17), -INT8_C( 112), -INT8_C(  83), -INT8_C(  32),  INT8_C( 125), -INT8_C(   9), -INT8_C(  70), -INT8_C(  51),
+         INT8_C(  34), -INT8_C(  42), -INT8_C(  73), -INT8_C(  62),  INT8_C(  41),  INT8_C( 123),  INT8_C(  81),  INT8_C(   1) },
+      {  INT8_C(  47),  INT8_C(  97), -INT8_C(  59),  INT8_C(  96),  INT8_C(   4), -INT8_C( 102),  INT8_C(  51),  INT8_C(  47),
+         INT8_C( 113), -INT8_C(  59), -INT8_C(  20),  INT8_C(   7),  INT8_C(  83),  INT8_C(  81), -INT8_C(   3),  INT8_C(  26),
+        -INT8_C(  60),  INT8_C(  25),  INT8_C( 103), -INT8_C(  35),  INT8_C(  94),  INT8_C( 118), -INT8_C(   8),  INT8_C(  43),
+         INT8_C(  27),  INT8_C(  37),  INT8_C(   5),  INT8_C(  11),  INT8_C(  15),  INT8_C(  79),  INT8_C(  77), -INT8_C( 111) },
+      {  INT16_C(   303),  INT16_C(   178),  INT16_C(   620),  INT16_C(   513),  INT16_C(     0),  INT16_C(   633),  INT16_C(   444),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   651),  INT16_C(   309),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(65386),
+      {  INT8_C(  20),  INT8_C(  96),  INT8_C(  96), -INT8_C( 112),  INT8_C(   1),  INT8_C(  77),  INT8_C(  37),  INT8_C(  27),
+        -INT8_C( 125),  INT8_C(  34),  INT8_C(  52),  INT8_C(  66),  INT8_C( 112),  INT8_C(  80),  INT8_C( 120), -INT8_C(  66),
+        -INT8_C(  43),  INT8_C( 118),  INT8_C(  54), -INT8_C(  38), -INT8_C( 125),  INT8_C( 126),  INT8_C(  66),  INT8_C(  84),
+         INT8_C(  64), -INT8_C(  14),  INT8_C(  51),  INT8_C(  15),  INT8_C(  39), -INT8_C(  29), -INT8_C( 108), -INT8_C(  99) },
+      { -INT8_C(  35),  INT8_C( 100), -INT8_C(  20),  INT8_C( 111), -INT8_C( 115),  INT8_C(   4),  INT8_C( 104), -INT8_C(  36),
+         INT8_C( 125),  INT8_C( 105), -INT8_C( 113),  INT8_C(  18),  INT8_C( 120),  INT8_C( 122),  INT8_C(  98),  INT8_C(  90),
+         INT8_C(  14), -INT8_C(  68), -INT8_C(  15),  INT8_C( 124),  INT8_C(  90), -INT8_C(  12), -INT8_C(  95),  INT8_C(  60),
+        -INT8_C(  36), -INT8_C( 111),  INT8_C(  90),  INT8_C(  34),  INT8_C(  72), -INT8_C(  16), -INT8_C(  83),  INT8_C( 104) },
+      {  INT16_C(     0),  INT16_C(   167),  INT16_C(     0),  INT16_C(   451),  INT16_C(     0),  INT16_C(   266),  INT16_C(   215),  INT16_C(     0),
+         INT16_C(   514),  INT16_C(    82),  INT16_C(   311),  INT16_C(   250),  INT16_C(   221),  INT16_C(   299),  INT16_C(   422),  INT16_C(   402) } },
+    { UINT16_C(41350),
+      {  INT8_C(  69), -INT8_C(  77),  INT8_C(  22), -INT8_C(  74),  INT8_C(   9), -INT8_C(   3), -INT8_C( 116), -INT8_C(  75),
+        -INT8_C(  90),  INT8_C(  69), -INT8_C(  11),  INT8_C(  10),  INT8_C(  26), -INT8_C( 122),  INT8_C(  91), -INT8_C( 107),
+         INT8_C( 100), -INT8_C(  52),  INT8_C(  51),  INT8_C(  27),  INT8_C( 107),  INT8_C(  61),  INT8_C(   9), -INT8_C(  73),
+         INT8_C(  46), -INT8_C( 102), -INT8_C(  99),  INT8_C(  84), -INT8_C(  84),  INT8_C(  87), -INT8_C(   1), -INT8_C( 114) },
+      { -INT8_C(   3),  INT8_C(  34), -INT8_C(  64), -INT8_C(  81), -INT8_C(  70),  INT8_C(  43),  INT8_C( 109),  INT8_C( 109),
+        -INT8_C( 121), -INT8_C(  30), -INT8_C( 127),  INT8_C(  60), -INT8_C(  32), -INT8_C( 119), -INT8_C(  66),  INT8_C( 117),
+        -INT8_C(  33), -INT8_C(  22),  INT8_C(  73),  INT8_C(  39),  INT8_C(  45),  INT8_C(  59), -INT8_C(  87),  INT8_C( 122),
+        -INT8_C( 112), -INT8_C(  51), -INT8_C(  52), -INT8_C(   5), -INT8_C(  66),  INT8_C(  31),  INT8_C(   1),  INT8_C(   3) },
+      {  INT16_C(     0),  INT16_C(   230),  INT16_C(   294),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   310),
+         INT16_C(   413),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   461),  INT16_C(     0),  INT16_C(   395) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi8(test_vec[i].b);
+    simde__m256i r = simde_mm256_maskz_dbsad_epu8(test_vec[i].k, a, b, INT32_C( 57));
+    simde_test_x86_assert_equal_i16x16(r, simde_x_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_dbsad_epu8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[64];
+    const int8_t b[64];
+    const int16_t r[32];
+  } test_vec[] = {
+    { {  INT8_C(  42),  INT8_C(  66), -INT8_C(  50),  INT8_C(  27),  INT8_C(  21),  INT8_C( 115),  INT8_C( 121), -INT8_C(  11),
+        -INT8_C(  48), -INT8_C(  33),  INT8_C(  14),  INT8_C(  62),  INT8_C(  40),  INT8_C(  24), -INT8_C( 108),  INT8_C( 101),
+         INT8_C( 123), -INT8_C( 101),  INT8_C( 106),  INT8_C(  74), -INT8_C(  28), -INT8_C(  91),  INT8_C(  64),  INT8_C(  40),
+         INT8_C( 112), -INT8_C(  58), -INT8_C(  67),  INT8_C(  20), -INT8_C(  66),  INT8_C(  69), -INT8_C( 123),  INT8_C(  74),
+        -INT8_C(   8), -INT8_C(  55), -INT8_C(  64), -INT8_C(  15),  INT8_C(   4), -INT8_C(  42),  INT8_C(  73), -INT8_C(  25),
+        -INT8_C( 126),  INT8_C(   1), -INT8_C( 105),  INT8_C(  26),  INT8_C(   6), -INT8_C(  58), -INT8_C(  73), -INT8_C(  34),
+         INT8_C(  23), -INT8_C(  53), -INT8_C(  66), -INT8_C( 125),  INT8_C( 104), -INT8_C( 118), -INT8_C( 117), -INT8_C(  72),
+        -INT8_C(  11), -INT8_C(  62),  INT8_C( 101),  INT8_C( 111),  INT8_C( 119),  INT8_C(  55), -INT8_C(  81),  INT8_C(  48) },
+      {  INT8_C(  68),  INT8_C( 126),  INT8_C(  88),  INT8_C(  50), -INT8_C(  78), -INT8_C(  83), -INT8_C( 102), -INT8_C( 103),
+             INT8_MIN, -INT8_C(   9),  INT8_C( 100),  INT8_C(  58), -INT8_C(  94), -INT8_C(  89),  INT8_C(  92),  INT8_C(  98),
+         INT8_C(  30),  INT8_C(  90), -INT8_C(  80), -INT8_C( 103), -INT8_C(  50), -INT8_C(  51), -INT8_C(  70), -INT8_C(  33),
+         INT8_C(  58), -INT8_C( 124),  INT8_C(  87), -INT8_C(  31),  INT8_C(  10),  INT8_C(  36), -INT8_C(  24),  INT8_C(  41),
+        -INT8_C(  11),  INT8_C(  34), -INT8_C( 114),  INT8_C( 119),  INT8_C( 101),  INT8_C(  21), -INT8_C(  21), -INT8_C(  36),
+         INT8_C(  67), -INT8_C(  69),  INT8_C(   8),  INT8_C(  86),  INT8_C(  96), -INT8_C(  28), -INT8_C(  85),  INT8_C( 100),
+         INT8_C(  28), -INT8_C(  88), -INT8_C(  31), -INT8_C(  30), -INT8_C( 103),  INT8_C(  54), -INT8_C(  42),  INT8_C( 105),
+         INT8_C(  43), -INT8_C(  43),  INT8_C(  76), -INT8_C( 110), -INT8_C(  79), -INT8_C( 120), -INT8_C(   7),  INT8_C(  76) },
+      {  INT16_C(   406),  INT16_C(   360),  INT16_C(    97),  INT16_C(   361),  INT16_C(   311),  INT16_C(   249),  INT16_C(   348),  INT16_C(   192),
+         INT16_C(   391),  INT16_C(   245),  INT16_C(   226),  INT16_C(   409),  INT16_C(   307),  INT16_C(   149),  INT16_C(   277),  INT16_C(   217),
+         INT16_C(   341),  INT16_C(   316),  INT16_C(   331),  INT16_C(   580),  INT16_C(   327),  INT16_C(   631),  INT16_C(   501),  INT16_C(   490),
+         INT16_C(   335),  INT16_C(   361),  INT16_C(   332),  INT16_C(   305),  INT16_C(   351),  INT16_C(   298),  INT16_C(   412),  INT16_C(   225) } },
+    { {  INT8_C(  35),  INT8_C(  73), -INT8_C(  43), -INT8_C(  98),  INT8_C(  83), -INT8_C( 119),  INT8_C( 120),  INT8_C(  32),
+         INT8_C(  24), -INT8_C(  64), -INT8_C( 109), -INT8_C(  44),  INT8_C(  55),  INT8_C( 103),  INT8_C(  97),  INT8_C(   3),
+        -INT8_C(  63), -INT8_C(  30), -INT8_C(  31), -INT8_C(  34), -INT8_C(  89),  INT8_C( 118),  INT8_C(  80), -INT8_C(  32),
+        -INT8_C(  35),  INT8_C(   8),  INT8_C(  84), -INT8_C( 118), -INT8_C(  59), -INT8_C(  24), -INT8_C( 115),  INT8_C(  26),
+        -INT8_C(  78),  INT8_C(  95),  INT8_C(  55), -INT8_C(  79),  INT8_C(  32), -INT8_C(  22),  INT8_C( 107),  INT8_C( 121),
+         INT8_C(  33),  INT8_C(  71), -INT8_C(  53),  INT8_C(  34),  INT8_C( 120), -INT8_C(  56), -INT8_C(   7), -INT8_C(  62),
+         INT8_C(  73), -INT8_C(  47),  INT8_C(  18),  INT8_C( 118),  INT8_C(  58),  INT8_C(  40),  INT8_C(   2),  INT8_C(  42),
+         INT8_C(  84),  INT8_C(  18),  INT8_C(  62),  INT8_C(  30),  INT8_C(  98),  INT8_C(  14),  INT8_C(  56),  INT8_C(  96) },
+      { -INT8_C(  14), -INT8_C( 121), -INT8_C(  34),  INT8_C(  11),  INT8_C(  39),  INT8_C(  63),  INT8_C(  37),  INT8_C(  35),
+         INT8_C(  19),  INT8_C(   9), -INT8_C(  85),  INT8_C(  94), -INT8_C(  92),  INT8_C(  41),  INT8_C( 125),  INT8_C(  93),
+         INT8_C( 107), -INT8_C(  61),  INT8_C(  82),  INT8_C(  24), -INT8_C(  98), -INT8_C( 117), -INT8_C(  32), -INT8_C( 119),
+         INT8_C(  80),  INT8_C( 100),  INT8_C(  20),  INT8_C(  10),  INT8_C(  82),  INT8_C(  58), -INT8_C( 106), -INT8_C(  97),
+        -INT8_C(  46), -INT8_C(  15),  INT8_C(  22), -INT8_C(  88), -INT8_C(  37), -INT8_C( 120), -INT8_C(  23),  INT8_C(  36),
+        -INT8_C(  74),  INT8_C(  69),  INT8_C(  65),  INT8_C(  99),  INT8_C(  37), -INT8_C( 107),  INT8_C(  88), -INT8_C( 112),
+         INT8_C(   9), -INT8_C(  65), -INT8_C(  82),  INT8_C(  45),  INT8_C(  93), -INT8_C(  79),  INT8_C( 124),  INT8_C( 116),
+         INT8_C(   8), -INT8_C(  14),  INT8_C(  25),  INT8_C(  61), -INT8_C(  89), -INT8_C(  28), -INT8_C(  33),      INT8_MIN },
+      {  INT16_C(   314),  INT16_C(   317),  INT16_C(   210),  INT16_C(   378),  INT16_C(   431),  INT16_C(   336),  INT16_C(   363),  INT16_C(   416),
+         INT16_C(   417),  INT16_C(   419),  INT16_C(   182),  INT16_C(   270),  INT16_C(   335),  INT16_C(   382),  INT16_C(   325),  INT16_C(   295),
+         INT16_C(   261),  INT16_C(   130),  INT16_C(   273),  INT16_C(   258),  INT16_C(   283),  INT16_C(   608),  INT16_C(   363),  INT16_C(   274),
+         INT16_C(   328),  INT16_C(   389),  INT16_C(   459),  INT16_C(   359),  INT16_C(   316),  INT16_C(   274),  INT16_C(   270),  INT16_C(   236) } },
+    { { -INT8_C(   6), -INT8_C( 121), -INT8_C(  26), -INT8_C(  11),  INT8_C(  22),  INT8_C(  40),  INT8_C(  74), -INT8_C(  94),
+         INT8_C(  87), -INT8_C( 119),  INT8_C(  70), -INT8_C(  94), -INT8_C(  93),  INT8_C( 102), -INT8_C(  22),  INT8_C( 117),
+         INT8_C( 109),  INT8_C(  19), -INT8_C(  45),  INT8_C( 102), -INT8_C(  20), -INT8_C(  47), -INT8_C(  76),  INT8_C(  47),
+         INT8_C( 103), -INT8_C(  61), -INT8_C(  88), -INT8_C(  99),  INT8_C( 126),  INT8_C( 112), -INT8_C(  24),  INT8_C(  65),
+        -INT8_C( 121), -INT8_C(  74), -INT8_C( 113), -INT8_C( 124), -INT8_C(  53),  INT8_C( 110),  INT8_C( 102),  INT8_C(  40),
+        -INT8_C(  34), -INT8_C(  91),  INT8_C(  28), -INT8_C( 110), -INT8_C( 111), -INT8_C( 112),  INT8_C(  95), -INT8_C(  25),
+        -INT8_C(  34),  INT8_C(   5),  INT8_C(  81),  INT8_C(  91), -INT8_C(  65), -INT8_C(   8), -INT8_C( 121),  INT8_C(   8),
+         INT8_C(   8), -INT8_C(  88),  INT8_C( 127), -INT8_C(  35), -INT8_C(  30), -INT8_C(  31),      INT8_MIN,  INT8_C( 121) },
+      {  INT8_C(  17),  INT8_C( 127),  INT8_C(  31),  INT8_C(   3),  INT8_C( 125), -INT8_C(  23),  INT8_C(  26), -INT8_C(   6),
+         INT8_C( 125),  INT8_C(  67),  INT8_C(  87), -INT8_C(   3),  INT8_C(  56), -INT8_C( 126), -INT8_C(  81), -INT8_C(  84),
+         INT8_C(  93), -INT8_C(  99),  INT8_C(  60),  INT8_C(  76), -INT8_C(  14),  INT8_C(  75),  INT8_C(  23),  INT8_C(  29),
+         INT8_C(  11), -INT8_C(  23), -INT8_C(  42),  INT8_C(  61),  INT8_C(   1),  INT8_C(  51),  INT8_C(   5),  INT8_C(  39),
+        -INT8_C(  69),  INT8_C(  84),  INT8_C( 112), -INT8_C(  40), -INT8_C( 105), -INT8_C(  92), -INT8_C(  39),  INT8_C(   0),
+         INT8_C(  52), -INT8_C(  62),  INT8_C(   7), -INT8_C( 117),  INT8_C(  28), -INT8_C(  46), -INT8_C(   3), -INT8_C(  66),
+         INT8_C(  17),  INT8_C(  73),  INT8_C(  25), -INT8_C(  25), -INT8_C(  20),  INT8_C(  75),  INT8_C(   5), -INT8_C(  49),
+        -INT8_C(   6),  INT8_C(  67), -INT8_C( 111),  INT8_C(  68),  INT8_C(  38),  INT8_C(  16), -INT8_C( 120), -INT8_C(  33) },
+      {  INT16_C(   327),  INT16_C(   338),  INT16_C(   431),  INT16_C(   317),  INT16_C(   266),  INT16_C(   582),  INT16_C(   512),  INT16_C(   365),
+         INT16_C(   409),  INT16_C(   335),  INT16_C(   756),  INT16_C(   615),  INT16_C(   532),  INT16_C(   403),  INT16_C(   417),  INT16_C(   196),
+         INT16_C(   303),  INT16_C(   273),  INT16_C(   334),  INT16_C(   196),  INT16_C(   407),  INT16_C(   179),  INT16_C(   455),  INT16_C(   318),
+         INT16_C(   382),  INT16_C(   638),  INT16_C(   254),  INT16_C(   239),  INT16_C(   457),  INT16_C(   514),  INT16_C(   398),  INT16_C(   378) } },
+    { { -INT8_C( 121),  INT8_C(  34),  INT8_C( 122), -INT8_C(  48), -INT8_C(  53),  INT8_C( 116), -INT8_C(  92),  INT8_C(  43),
+        -INT8_C(  23), -INT8_C(  18),  INT8_C(   3),  INT8_C(  71), -INT8_C( 107), -INT8_C(  40), -INT8_C(  37),  INT8_C(  96),
+        -INT8_C(  52), -INT8_C(  99), -INT8_C( 126),  INT8_C( 109),  INT8_C(  33), -INT8_C(  47), -INT8_C(  54),  INT8_C(  71),
+        -INT8_C(  51), -INT8_C(   8), -INT8_C(  87),  INT8_C(  58),  INT8_C(  94),  INT8_C(  52),  INT8_C( 106), -INT8_C( 126),
+        -INT8_C(  63),  INT8_C( 102),  INT8_C(  56), -INT8_C( 102),  INT8_C(  37),  INT8_C( 111),  INT8_C(   1), -INT8_C(  31),
+         INT8_C(   0), -INT8_C( 118), -INT8_C(  19), -INT8_C(  58), -INT8_C( 119),  INT8_C(  30),  INT8_C(  26), -INT8_C( 108),
+         INT8_C(  13), -INT8_C(  73), -INT8_C(  50),  INT8_C( 113), -INT8_C(   3), -INT8_C( 110),  INT8_C(  45), -INT8_C(  39),
+         INT8_C( 114), -INT8_C(  90), -INT8_C(  87), -INT8_C(  14),  INT8_C(  49), -INT8_C(  55), -INT8_C(  44), -INT8_C(  29) },
+      {  INT8_C(  86),  INT8_C(  14),  INT8_C(  10),  INT8_C(  94), -INT8_C(  62),  INT8_C(  31),  INT8_C(  17),  INT8_C(  39),
+        -INT8_C(  65), -INT8_C( 112),  INT8_C(  19),  INT8_C(   9),  INT8_C(  73), -INT8_C( 119),  INT8_C( 108),  INT8_C(  12),
+         INT8_C( 104), -INT8_C(  64),  INT8_C(  49), -INT8_C(   5), -INT8_C(  92), -INT8_C( 105), -INT8_C(  84),  INT8_C(  73),
+         INT8_C( 127), -INT8_C(  93), -INT8_C( 116),  INT8_C(  39), -INT8_C(  75),  INT8_C( 108),  INT8_C(   0),  INT8_C(   2),
+        -INT8_C(   2),  INT8_C( 123), -INT8_C(  79),  INT8_C( 120), -INT8_C(  46),  INT8_C(  17),  INT8_C(  67), -INT8_C(  87),
+         INT8_C(   0), -INT8_C(  20), -INT8_C(  27), -INT8_C( 104), -INT8_C(  57),  INT8_C(  48), -INT8_C(  72), -INT8_C(  87),
+        -INT8_C(  16),  INT8_C(  81), -INT8_C(  87), -INT8_C( 122),  INT8_C(  29), -INT8_C(  43), -INT8_C(  26),  INT8_C(  33),
+         INT8_C(   5), -INT8_C(  37),  INT8_C(  66),  INT8_C(  38),  INT8_C(  24), -INT8_C( 108),  INT8_C(   1), -INT8_C(  93) },
+      {  INT16_C(   375),  INT16_C(   203),  INT16_C(   327),  INT16_C(   310),  INT16_C(   292),  INT16_C(   474),  INT16_C(   524),  INT16_C(   531),
+         INT16_C(   309),  INT16_C(   399),  INT16_C(   407),  INT16_C(   221),  INT16_C(   156),  INT16_C(   272),  INT16_C(   163),  INT16_C(   240),
+         INT16_C(   203),  INT16_C(   494),  INT16_C(   217),  INT16_C(   482),  INT16_C(   530),  INT16_C(   212),  INT16_C(   462),  INT16_C(   382),
+         INT16_C(   301),  INT16_C(   468),  INT16_C(   311),  INT16_C(   556),  INT16_C(   402),  INT16_C(   301),  INT16_C(   523),  INT16_C(   244) } },
+    { { -INT8_C(  96), -INT8_C(  67),  INT8_C( 104), -INT8_C(  20), -INT8_C(  77), -INT8_C(  66),  INT8_C(  75),  INT8_C(  47),
+         INT8_C( 125), -INT8_C(  97),  INT8_C(  96), -INT8_C(  68), -INT8_C( 125), -INT8_C( 108), -INT8_C(  97), -INT8_C(  16),
+        -INT8_C(  87),  INT8_C( 108), -INT8_C(   6), -INT8_C(  25),  INT8_C(  80),  INT8_C(  80),  INT8_C(  42),  INT8_C(  98),
+        -INT8_C(  16),  INT8_C(  51), -INT8_C(  75),  INT8_C(  78), -INT8_C( 118), -INT8_C(  51),  INT8_C(  30),  INT8_C(  90),
+        -INT8_C(  36), -INT8_C(  43), -INT8_C(  72),  INT8_C(  29),  INT8_C(  59),  INT8_C(  85), -INT8_C( 113),  INT8_C(  30),
+         INT8_C( 116),  INT8_C(  70), -INT8_C( 126),  INT8_C(  15), -INT8_C(  89), -INT8_C( 118),  INT8_C(  41), -INT8_C(  65),
+         INT8_C(  86), -INT8_C( 116), -INT8_C(  51),  INT8_C(  62), -INT8_C(  62),  INT8_C( 123), -INT8_C(   3), -INT8_C(  64),
+        -INT8_C( 103),  INT8_C(  50),  INT8_C(  74),  INT8_C( 106),  INT8_C(  42), -INT8_C( 110), -INT8_C( 101), -INT8_C(  74) },
+      { -INT8_C(  57),  INT8_C( 120),  INT8_C(  14),  INT8_C(  68),  INT8_C(  94),  INT8_C(  52),  INT8_C(  68),  INT8_C(  52),
+        -INT8_C(  64), -INT8_C( 111), -INT8_C(  60), -INT8_C(  29),  INT8_C(  54), -INT8_C( 112),  INT8_C(  41),  INT8_C(  19),
+         INT8_C(  17),  INT8_C(  53), -INT8_C(  31),  INT8_C(  52),  INT8_C(  36),  INT8_C(  52), -INT8_C(  36), -INT8_C(  33),
+        -INT8_C( 120), -INT8_C( 113),  INT8_C(  58),  INT8_C(   8), -INT8_C(  68),  INT8_C(  97), -INT8_C( 127), -INT8_C(  30),
+         INT8_C(  55), -INT8_C( 127),  INT8_C(  36),  INT8_C( 104),  INT8_C(  92),  INT8_C(  78),  INT8_C(  70), -INT8_C( 110),
+         INT8_C(  89), -INT8_C(  31), -INT8_C(  12),  INT8_C(  61), -INT8_C(  57),  INT8_C(  46),  INT8_C(   0), -INT8_C(  50),
+         INT8_C(  33),  INT8_C(  51), -INT8_C(  83), -INT8_C(   8), -INT8_C(   7), -INT8_C( 102),  INT8_C( 105), -INT8_C(  15),
+         INT8_C( 106),  INT8_C( 110), -INT8_C( 126), -INT8_C(  51), -INT8_C(  40), -INT8_C(   9), -INT8_C( 100),  INT8_C( 121) },
+      {  INT16_C(   431),  INT16_C(   293),  INT16_C(   524),  INT16_C(   381),  INT16_C(   302),  INT16_C(   219),  INT16_C(   319),  INT16_C(   395),
+         INT16_C(   156),  INT16_C(   212),  INT16_C(   334),  INT16_C(   343),  INT16_C(   389),  INT16_C(   460),  INT16_C(   150),  INT16_C(   431),
+         INT16_C(   549),  INT16_C(   469),  INT16_C(   429),  INT16_C(   447),  INT16_C(   223),  INT16_C(    94),  INT16_C(   181),  INT16_C(   347),
+         INT16_C(   345),  INT16_C(   305),  INT16_C(   269),  INT16_C(   295),  INT16_C(   366),  INT16_C(   296),  INT16_C(   411),  INT16_C(   425) } },
+    { { -INT8_C(  71), -INT8_C(  60),  INT8_C(  71),  INT8_C(  59), -INT8_C(  31),  INT8_C( 110), -INT8_C( 116),  INT8_C(  97),
+        -INT8_C(   3),  INT8_C(  64),  INT8_C(  96),  INT8_C( 104),  INT8_C(  86), -INT8_C(  70), -INT8_C( 107), -INT8_C(  84),
+         INT8_C(  53),  INT8_C( 127),  INT8_C(   5), -INT8_C(  27),  INT8_C(   8), -INT8_C(  60),  INT8_C(  93), -INT8_C( 127),
+        -INT8_C( 118), -INT8_C( 121),  INT8_C(  32),  INT8_C(  52),  INT8_C(  78), -INT8_C(  98),  INT8_C(  75), -INT8_C( 101),
+         INT8_C(  24),  INT8_C( 100),  INT8_C( 100), -INT8_C(  84), -INT8_C(  93), -INT8_C(  14), -INT8_C(  63),  INT8_C(  70),
+         INT8_C(  82), -INT8_C(  56), -INT8_C(  37), -INT8_C( 126), -INT8_C( 101), -INT8_C(  42), -INT8_C(   9),  INT8_C(  88),
+         INT8_C(  58),  INT8_C(  82), -INT8_C(  12),  INT8_C(  19),  INT8_C(   9), -INT8_C( 123),  INT8_C(  82),  INT8_C(  56),
+         INT8_C(  34), -INT8_C(  26), -INT8_C( 111),  INT8_C(  58), -INT8_C(  48),  INT8_C(  63), -INT8_C(  65),  INT8_C(  52) },
+      { -INT8_C(  92), -INT8_C( 117),  INT8_C(  34),  INT8_C(  84), -INT8_C( 118),  INT8_C(  63), -INT8_C(   7),  INT8_C(  24),
+         INT8_C(  90), -INT8_C(  24), -INT8_C( 121),  INT8_C( 102),  INT8_C( 108),  INT8_C(  80), -INT8_C(  92), -INT8_C( 117),
+         INT8_C( 124), -INT8_C(  54),  INT8_C( 105), -INT8_C( 121),  INT8_C(  50),  INT8_C(  38), -INT8_C(  34),  INT8_C(  31),
+        -INT8_C(  87), -INT8_C(  74),  INT8_C(  73), -INT8_C(  19), -INT8_C( 106),  INT8_C(  59),  INT8_C( 121), -INT8_C(  79),
+        -INT8_C( 106), -INT8_C(  23), -INT8_C(  50),  INT8_C(   5), -INT8_C(  35),  INT8_C(  30), -INT8_C(  86),  INT8_C(  49),
+        -INT8_C(  73),  INT8_C(   2), -INT8_C( 114), -INT8_C( 101), -INT8_C(  52),  INT8_C(   3), -INT8_C(  87), -INT8_C(  30),
+         INT8_C( 101), -INT8_C(  97), -INT8_C(   6), -INT8_C(  15), -INT8_C(  90),  INT8_C(  29),  INT8_C(  27), -INT8_C(  33),
+         INT8_C( 106), -INT8_C(  84),  INT8_C(  71), -INT8_C( 111),  INT8_C( 104), -INT8_C( 112), -INT8_C(  23), -INT8_C(  62) },
+      {  INT16_C(   366),  INT16_C(   236),  INT16_C(   275),  INT16_C(   236),  INT16_C(   349),  INT16_C(   507),  INT16_C(   373),  INT16_C(   232),
+         INT16_C(   333),  INT16_C(   244),  INT16_C(   261),  INT16_C(   341),  INT16_C(   396),  INT16_C(   260),  INT16_C(   367),  INT16_C(   258),
+         INT16_C(   400),  INT16_C(   227),  INT16_C(   100),  INT16_C(   385),  INT16_C(   439),  INT16_C(   272),  INT16_C(   422),  INT16_C(   302),
+         INT16_C(   294),  INT16_C(   374),  INT16_C(   425),  INT16_C(   317),  INT16_C(   616),  INT16_C(   329),  INT16_C(   538),  INT16_C(   283) } },
+    { {  INT8_C(  92), -INT8_C(  98), -INT8_C(  65),  INT8_C( 106), -INT8_C(  46),  INT8_C(  77), -INT8_C(  27),  INT8_C(   8),
+        -INT8_C(  82), -INT8_C(  35),  INT8_C( 100),  INT8_C(  78),  INT8_C(  60), -INT8_C(  36),  INT8_C( 119), -INT8_C(  95),
+         INT8_C(  94), -INT8_C(  12), -INT8_C( 127), -INT8_C( 118), -INT8_C(  93),  INT8_C(  32), -INT8_C(   8), -INT8_C( 117),
+         INT8_C(  18),  INT8_C(   0), -INT8_C(  24),  INT8_C( 121), -INT8_C(  13), -INT8_C(  26), -INT8_C(  47),  INT8_C(  32),
+         INT8_C(  28), -INT8_C( 120), -INT8_C( 119), -INT8_C(  64), -INT8_C(  79),  INT8_C( 122),  INT8_C( 102), -INT8_C(  80),
+         INT8_C(  37), -INT8_C(  59), -INT8_C(  20), -INT8_C(  31),  INT8_C( 108), -INT8_C(  58), -INT8_C(  21), -INT8_C(  56),
+        -INT8_C(  83),  INT8_C( 116),  INT8_C(  70), -INT8_C(  86), -INT8_C(  87),  INT8_C( 114), -INT8_C( 104),  INT8_C(   7),
+        -INT8_C(  17),  INT8_C(  68), -INT8_C(  64),  INT8_C(  23), -INT8_C(   1),  INT8_C( 110),  INT8_C(   4), -INT8_C(  14) },
+      {  INT8_C(  29),  INT8_C(  73),  INT8_C(  57),  INT8_C(   1),  INT8_C(  37),  INT8_C( 113), -INT8_C(  73),  INT8_C(  56),
+        -INT8_C( 114),  INT8_C(  81),  INT8_C( 119),  INT8_C(  91),  INT8_C( 101), -INT8_C( 111),  INT8_C( 102),  INT8_C( 104),
+        -INT8_C(   2), -INT8_C(  57),  INT8_C(  14),  INT8_C(  64),  INT8_C( 106), -INT8_C(  84),  INT8_C( 125), -INT8_C(  95),
+        -INT8_C( 104), -INT8_C(  59),  INT8_C(   6),  INT8_C(  14),  INT8_C(  42), -INT8_C(  70),  INT8_C(  33), -INT8_C(   9),
+         INT8_C(  74), -INT8_C(  26), -INT8_C( 111),  INT8_C( 122), -INT8_C(  90),  INT8_C(  83), -INT8_C( 121),  INT8_C(  40),
+         INT8_C( 114),  INT8_C(   6),  INT8_C(  12), -INT8_C(  44),  INT8_C( 111),  INT8_C(  55), -INT8_C(  17),  INT8_C(  46),
+         INT8_C( 100),  INT8_C(  78), -INT8_C(  48),  INT8_C(  79), -INT8_C( 111), -INT8_C(  22), -INT8_C( 115),  INT8_C(  78),
+         INT8_C(  76),  INT8_C(  24),  INT8_C(   0), -INT8_C( 100), -INT8_C(  39),  INT8_C( 120), -INT8_C(  14),  INT8_C(  89) },
+      {  INT16_C(   113),  INT16_C(   232),  INT16_C(   295),  INT16_C(   430),  INT16_C(   350),  INT16_C(   192),  INT16_C(   465),  INT16_C(   345),
+         INT16_C(   315),  INT16_C(   435),  INT16_C(   499),  INT16_C(   388),  INT16_C(   407),  INT16_C(   483),  INT16_C(   399),  INT16_C(   134),
+         INT16_C(   412),  INT16_C(   299),  INT16_C(   320),  INT16_C(   399),  INT16_C(   529),  INT16_C(   455),  INT16_C(   376),  INT16_C(   252),
+         INT16_C(   301),  INT16_C(   292),  INT16_C(   191),  INT16_C(   253),  INT16_C(   366),  INT16_C(   269),  INT16_C(   406),  INT16_C(   295) } },
+    { {  INT8_C(  29), -INT8_C(  51),  INT8_C(  54),  INT8_C(  38), -INT8_C(  38),  INT8_C(  11),  INT8_C(  31),  INT8_C(  59),
+         INT8_C(   9), -INT8_C(  99),  INT8_C(  10),  INT8_C(   8), -INT8_C(  28),  INT8_C(  71),  INT8_C(  53),  INT8_C(  29),
+         INT8_C( 123), -INT8_C(  85),  INT8_C(   0), -INT8_C(  66),  INT8_C( 113),  INT8_C( 121),  INT8_C(  87),  INT8_C(  71),
+         INT8_C(   3),  INT8_C(   9), -INT8_C(  63),  INT8_C(  38), -INT8_C(  50), -INT8_C(  45), -INT8_C(  88),  INT8_C(  79),
+         INT8_C(   3), -INT8_C(  11),  INT8_C(  28),  INT8_C(  70), -INT8_C( 104), -INT8_C( 109), -INT8_C(   4), -INT8_C( 123),
+        -INT8_C(  70), -INT8_C(  13), -INT8_C( 124), -INT8_C(  17), -INT8_C(   2), -INT8_C(  65),  INT8_C( 118), -INT8_C(  80),
+        -INT8_C( 105), -INT8_C(  62),  INT8_C(  97), -INT8_C(  39),  INT8_C(   8),  INT8_C(  76), -INT8_C(  56), -INT8_C(   9),
+        -INT8_C(  70), -INT8_C(  59), -INT8_C(  50),  INT8_C(  57), -INT8_C(  49), -INT8_C(  20),  INT8_C( 127), -INT8_C( 109) },
+      { -INT8_C(  10),  INT8_C(  31), -INT8_C(  83),  INT8_C(  58), -INT8_C(  60),  INT8_C(  79),  INT8_C(  19),  INT8_C( 115),
+        -INT8_C(   3),  INT8_C(  30),  INT8_C(  16), -INT8_C( 106),  INT8_C(  85),  INT8_C(  67), -INT8_C(  63), -INT8_C( 106),
+        -INT8_C(  21),  INT8_C(  76), -INT8_C(  98), -INT8_C( 105), -INT8_C(  32),  INT8_C(  13), -INT8_C(  61),  INT8_C(  80),
+         INT8_C( 124),  INT8_C( 118), -INT8_C(  10), -INT8_C(  25),  INT8_C(  26),  INT8_C(  92),  INT8_C(  64), -INT8_C(   8),
+         INT8_C(  67), -INT8_C( 103), -INT8_C(  22),  INT8_C( 125), -INT8_C(  97),  INT8_C(  84),  INT8_C(  78),  INT8_C(  92),
+        -INT8_C( 114),  INT8_C(  45), -INT8_C(  21),  INT8_C( 120), -INT8_C( 110), -INT8_C(  59),  INT8_C(  74), -INT8_C(  34),
+        -INT8_C(  41), -INT8_C(  32), -INT8_C(  99),  INT8_C(  52), -INT8_C(  34), -INT8_C( 117), -INT8_C(  46),  INT8_C(  43),
+         INT8_C(  83),  INT8_C(  41), -INT8_C(  97), -INT8_C(  78), -INT8_C(  39), -INT8_C(  76),  INT8_C( 115), -INT8_C(   7) },
+      {  INT16_C(   445),  INT16_C(   361),  INT16_C(   415),  INT16_C(   354),  INT16_C(   381),  INT16_C(   551),  INT16_C(   448),  INT16_C(   454),
+         INT16_C(   298),  INT16_C(   452),  INT16_C(   260),  INT16_C(   344),  INT16_C(   269),  INT16_C(   506),  INT16_C(   212),  INT16_C(   321),
+         INT16_C(   389),  INT16_C(   631),  INT16_C(   351),  INT16_C(   384),  INT16_C(   387),  INT16_C(   479),  INT16_C(   349),  INT16_C(   379),
+         INT16_C(   130),  INT16_C(   394),  INT16_C(   603),  INT16_C(   495),  INT16_C(   112),  INT16_C(   381),  INT16_C(   361),  INT16_C(   292) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi8(test_vec[i].b);
+    simde__m512i r = simde_mm512_dbsad_epu8(a, b, INT32_C( 27));
+    simde_test_x86_assert_equal_i16x32(r, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_dbsad_epu8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[32];
+    const simde__mmask32 k;
+    const int8_t a[64];
+    const int8_t b[64];
+    const int16_t r[32];
+  } test_vec[] = {
+    { { -INT16_C( 28867), -INT16_C( 31692), -INT16_C( 30367), -INT16_C( 30248),  INT16_C( 11386), -INT16_C( 28250), -INT16_C(  8266), -INT16_C(  5044),
+         INT16_C(  2427), -INT16_C( 16513), -INT16_C( 31242),  INT16_C(  2146), -INT16_C( 30210),  INT16_C(  7660),  INT16_C( 30429),  INT16_C( 27770),
+         INT16_C( 17516),  INT16_C( 12258), -INT16_C(  4271),  INT16_C( 23002), -INT16_C(  4235),  INT16_C( 21054),  INT16_C( 14370),  INT16_C(  5038),
+        -INT16_C( 24239), -INT16_C(  2614),  INT16_C(  1478),  INT16_C( 13495),  INT16_C(  7116),  INT16_C( 18657),  INT16_C(  2450), -INT16_C( 13089) },
+      UINT32_C(2569667514),
+      { -INT8_C(  23),  INT8_C( 126), -INT8_C(  94),  INT8_C(  29),  INT8_C(  59),  INT8_C( 113), -INT8_C(  33), -INT8_C( 112),
+         INT8_C(  21),  INT8_C( 117), -INT8_C(   5),  INT8_C(  50), -INT8_C(  30),  INT8_C(  75), -INT8_C(  15),  INT8_C(  42),
+        -INT8_C(  36),  INT8_C(  21),  INT8_C(  77),  INT8_C(  19), -INT8_C(  13), -INT8_C(  76), -INT8_C(  71), -INT8_C( 100),
+        -INT8_C(  55), -INT8_C( 114), -INT8_C(  99),  INT8_C(  48),  INT8_C( 102),  INT8_C(  44),  INT8_C( 122),  INT8_C(  92),
+         INT8_C(  78),  INT8_C( 100),  INT8_C(  56),  INT8_C( 104), -INT8_C( 110), -INT8_C( 105), -INT8_C(  94),  INT8_C(  27),
+        -INT8_C(  63),  INT8_C(  30),  INT8_C(  44),  INT8_C(  64),  INT8_C(  40), -INT8_C( 120), -INT8_C(  75),  INT8_C(  46),
+         INT8_C( 126), -INT8_C(  64),  INT8_C( 125),  INT8_C(  95), -INT8_C(  69), -INT8_C(  52),  INT8_C(  87), -INT8_C( 121),
+        -INT8_C(  12), -INT8_C( 107),  INT8_C(  20), -INT8_C( 116),  INT8_C(  57), -INT8_C( 121), -INT8_C( 118), -INT8_C(  23) },
+      { -INT8_C(  14),  INT8_C( 113), -INT8_C(  77), -INT8_C( 118),  INT8_C( 111), -INT8_C(  33), -INT8_C( 100), -INT8_C(  41),
+        -INT8_C(  62),  INT8_C(   3),  INT8_C(  87),  INT8_C(  99), -INT8_C(  85),  INT8_C( 116), -INT8_C( 106),  INT8_C( 109),
+        -INT8_C( 125),  INT8_C( 122), -INT8_C(  70), -INT8_C( 111),  INT8_C(  26), -INT8_C(  80),  INT8_C(  43),  INT8_C(  99),
+         INT8_C(  47),  INT8_C(  37), -INT8_C(  75), -INT8_C(  80),  INT8_C(   3),  INT8_C( 103),  INT8_C(  89),  INT8_C(  13),
+        -INT8_C(  43),  INT8_C(  48),  INT8_C(  76),  INT8_C(  26), -INT8_C(  48),  INT8_C(  69),  INT8_C(  61), -INT8_C(  65),
+        -INT8_C( 118),  INT8_C(  91),  INT8_C(  25),  INT8_C(  91), -INT8_C(  75),  INT8_C( 106),  INT8_C(  20),  INT8_C( 120),
+        -INT8_C(  16),  INT8_C( 105),  INT8_C(  25),  INT8_C(  55),  INT8_C(  99),  INT8_C(  97),  INT8_C(  73),  INT8_C(  51),
+        -INT8_C(  39), -INT8_C(  50),  INT8_C(  47), -INT8_C(  55),  INT8_C(  32), -INT8_C(  60), -INT8_C(  89), -INT8_C(   6) },
+      { -INT16_C( 28867),  INT16_C(   279), -INT16_C( 30367),  INT16_C(    93),  INT16_C(   500),  INT16_C(   321), -INT16_C(  8266),  INT16_C(   456),
+         INT16_C(   425),  INT16_C(   338), -INT16_C( 31242),  INT16_C(  2146), -INT16_C( 30210),  INT16_C(  7660),  INT16_C( 30429),  INT16_C( 27770),
+         INT16_C( 17516),  INT16_C(   188), -INT16_C(  4271),  INT16_C(   304), -INT16_C(  4235),  INT16_C(   271),  INT16_C( 14370),  INT16_C(  5038),
+         INT16_C(   341), -INT16_C(  2614),  INT16_C(  1478),  INT16_C(   309),  INT16_C(   172),  INT16_C( 18657),  INT16_C(  2450),  INT16_C(   371) } },
+    { {  INT16_C(  4480),  INT16_C(  8505), -INT16_C( 29945),  INT16_C( 16274), -INT16_C( 14019),  INT16_C( 13360),  INT16_C( 23608),  INT16_C(   930),
+         INT16_C( 32061), -INT16_C( 18193), -INT16_C(  7031),  INT16_C( 20209),  INT16_C( 31250),  INT16_C(  6036), -INT16_C( 13047), -INT16_C(  7134),
+         INT16_C( 30473),  INT16_C( 23873), -INT16_C( 29975),  INT16_C( 27433),  INT16_C( 19177),  INT16_C( 30310),  INT16_C( 11726),  INT16_C( 28961),
+         INT16_C(  4901), -INT16_C(  4393), -INT16_C( 10605), -INT16_C( 11133), -INT16_C( 16555), -INT16_C(  8206), -INT16_C( 30082), -INT16_C( 32465) },
+      UINT32_C( 186650849),
+      { -INT8_C(  74), -INT8_C(  51), -INT8_C(  60), -INT8_C(  49),  INT8_C(  76), -INT8_C(  34),  INT8_C(  35),  INT8_C(  35),
+         INT8_C( 115),  INT8_C(  47),  INT8_C( 117),  INT8_C( 125), -INT8_C(   5), -INT8_C( 120), -INT8_C( 115),  INT8_C(  60),
+        -INT8_C(  96),  INT8_C( 101),  INT8_C( 101),  INT8_C(  11),  INT8_C(   1), -INT8_C( 111),  INT8_C(  36), -INT8_C( 100),
+         INT8_C(  51),  INT8_C(  77),  INT8_C(  87),  INT8_C(  89),  INT8_C(   5),  INT8_C( 119),  INT8_C(  51),  INT8_C(  55),
+         INT8_C(  93),  INT8_C(  95),  INT8_C(  95),  INT8_C(  31), -INT8_C(  55),  INT8_C(  10), -INT8_C(  96),  INT8_C( 125),
+        -INT8_C(  19), -INT8_C(  88),  INT8_C(  59), -INT8_C(  79),  INT8_C( 108),  INT8_C( 118), -INT8_C(  92),  INT8_C( 119),
+         INT8_C(  19), -INT8_C(  77),  INT8_C( 122), -INT8_C( 122), -INT8_C( 115), -INT8_C(  72), -INT8_C( 105),  INT8_C( 106),
+        -INT8_C(  50), -INT8_C(   5),  INT8_C( 110), -INT8_C(  12),  INT8_C(  41),  INT8_C(  83),  INT8_C(   3),  INT8_C( 109) },
+      { -INT8_C(   3),  INT8_C( 116), -INT8_C(  64),  INT8_C(   9), -INT8_C( 105),  INT8_C(  80),  INT8_C(  60), -INT8_C( 100),
+         INT8_C(  89),  INT8_C(  15), -INT8_C(   5), -INT8_C( 124),  INT8_C(  55), -INT8_C(  67), -INT8_C(  96),  INT8_C(  77),
+         INT8_C( 119),  INT8_C(  57), -INT8_C(  11), -INT8_C(  58),  INT8_C(  99),  INT8_C(  21),  INT8_C(  79), -INT8_C(   9),
+        -INT8_C(  76), -INT8_C(  79),  INT8_C(  48), -INT8_C(  76),  INT8_C(  25), -INT8_C(  87),  INT8_C( 126), -INT8_C(  20),
+         INT8_C( 105),  INT8_C(  13),  INT8_C(  61),  INT8_C(  65), -INT8_C(  31), -INT8_C(  40), -INT8_C(  57), -INT8_C(  30),
+         INT8_C(  39),  INT8_C(   7), -INT8_C(  27),  INT8_C(  54), -INT8_C(  74),  INT8_C( 101),  INT8_C(  61),  INT8_C(  33),
+         INT8_C(  15),  INT8_C(  29), -INT8_C(  73), -INT8_C(  36), -INT8_C(  95),  INT8_C(  88),  INT8_C(   2), -INT8_C( 124),
+         INT8_C(   5), -INT8_C(   7),  INT8_C( 102), -INT8_C(  82), -INT8_C(  33),  INT8_C(  66),  INT8_C( 120), -INT8_C(   8) },
+      {  INT16_C(   362),  INT16_C(  8505), -INT16_C( 29945),  INT16_C( 16274), -INT16_C( 14019),  INT16_C(   389),  INT16_C(   219),  INT16_C(   348),
+         INT16_C( 32061), -INT16_C( 18193), -INT16_C(  7031),  INT16_C( 20209),  INT16_C(   359),  INT16_C(  6036), -INT16_C( 13047), -INT16_C(  7134),
+         INT16_C( 30473),  INT16_C( 23873), -INT16_C( 29975),  INT16_C( 27433),  INT16_C( 19177),  INT16_C(   301),  INT16_C( 11726),  INT16_C( 28961),
+         INT16_C(   301),  INT16_C(   139), -INT16_C( 10605),  INT16_C(   269), -INT16_C( 16555), -INT16_C(  8206), -INT16_C( 30082), -INT16_C( 32465) } },
+    { { -INT16_C( 12162),  INT16_C( 10397), -INT16_C( 23010), -INT16_C(   189),  INT16_C( 20598), -INT16_C( 30804),  INT16_C( 32704),  INT16_C( 16763),
+        -INT16_C( 23307),  INT16_C( 18235), -INT16_C(  8867),  INT16_C(  4642),  INT16_C( 14328), -INT16_C(  3723),  INT16_C( 14764), -INT16_C( 30553),
+        -INT16_C( 17041),  INT16_C( 11886), -INT16_C(  7296), -INT16_C( 27562),  INT16_C( 27399),  INT16_C(   283),  INT16_C( 21791),  INT16_C(  2899),
+         INT16_C( 19287),  INT16_C( 28351),  INT16_C( 24618),  INT16_C(  2588), -INT16_C( 16258),  INT16_C( 18263), -INT16_C( 25303),  INT16_C( 28774) },
+      UINT32_C( 333646696),
+      { -INT8_C( 122),  INT8_C(  41),  INT8_C( 117), -INT8_C( 109), -INT8_C(  48),  INT8_C(  47), -INT8_C(  75), -INT8_C( 122),
+         INT8_C(  37), -INT8_C(  25),  INT8_C(  68),  INT8_C(  50),  INT8_C(  94), -INT8_C(  94), -INT8_C(  17),  INT8_C(  82),
+         INT8_C( 106), -INT8_C(  90),  INT8_C(   7), -INT8_C(  71), -INT8_C( 104),  INT8_C(  67),  INT8_C(  49),  INT8_C(   7),
+        -INT8_C(  81),  INT8_C( 110),  INT8_C(   2), -INT8_C( 124), -INT8_C( 123), -INT8_C(  76),  INT8_C(  61), -INT8_C( 125),
+        -INT8_C(   4),  INT8_C( 111), -INT8_C( 123), -INT8_C(  44),  INT8_C( 121), -INT8_C(  27), -INT8_C(  66),  INT8_C(  91),
+         INT8_C( 105), -INT8_C( 101), -INT8_C(  96),  INT8_C(  71),  INT8_C(   1), -INT8_C(  67), -INT8_C(  84), -INT8_C( 117),
+         INT8_C(  10), -INT8_C(  14),  INT8_C(  31), -INT8_C(   3), -INT8_C(  78),  INT8_C(   7), -INT8_C(  31),  INT8_C(   6),
+        -INT8_C(  76),  INT8_C( 119), -INT8_C(  69), -INT8_C( 102), -INT8_C( 119),  INT8_C( 102),  INT8_C(  94),  INT8_C(  10) },
+      { -INT8_C(  18),  INT8_C(  95),  INT8_C(   7),  INT8_C(  91),  INT8_C(  89), -INT8_C(  69),  INT8_C(  72), -INT8_C(  48),
+         INT8_C(  59),  INT8_C( 105), -INT8_C( 127),  INT8_C( 110), -INT8_C(   2),  INT8_C( 111), -INT8_C( 101),  INT8_C(  44),
+         INT8_C(  68), -INT8_C(  58), -INT8_C(  45), -INT8_C(  30),  INT8_C(  77),  INT8_C(  73), -INT8_C(   7), -INT8_C(   2),
+         INT8_C(  43),  INT8_C( 123),  INT8_C(  51),  INT8_C( 117),  INT8_C(  13),  INT8_C( 117), -INT8_C( 119),  INT8_C( 122),
+        -INT8_C(  30), -INT8_C( 113),  INT8_C( 106), -INT8_C(  84),  INT8_C(  91),  INT8_C( 111), -INT8_C( 127),  INT8_C(  64),
+         INT8_C( 124), -INT8_C(  34), -INT8_C(  67),  INT8_C(  28),  INT8_C(   2), -INT8_C(  64),  INT8_C(  83),  INT8_C(  43),
+         INT8_C(   7), -INT8_C(  31), -INT8_C(   2),  INT8_C(  35),  INT8_C( 123), -INT8_C(  33), -INT8_C(  30),  INT8_C(   1),
+        -INT8_C(  93),  INT8_C(  54), -INT8_C(  84), -INT8_C(  25), -INT8_C(   4), -INT8_C(  11), -INT8_C(  28), -INT8_C(   9) },
+      { -INT16_C( 12162),  INT16_C( 10397), -INT16_C( 23010),  INT16_C(   227),  INT16_C( 20598),  INT16_C(   416),  INT16_C(   131),  INT16_C( 16763),
+         INT16_C(   315),  INT16_C(   464), -INT16_C(  8867),  INT16_C(   350),  INT16_C( 14328), -INT16_C(  3723),  INT16_C( 14764), -INT16_C( 30553),
+         INT16_C(   125),  INT16_C(   274), -INT16_C(  7296), -INT16_C( 27562),  INT16_C( 27399),  INT16_C(   352),  INT16_C(   572),  INT16_C(   290),
+         INT16_C(   461),  INT16_C(   361),  INT16_C( 24618),  INT16_C(  2588),  INT16_C(   174),  INT16_C( 18263), -INT16_C( 25303),  INT16_C( 28774) } },
+    { { -INT16_C( 10340), -INT16_C(  5112),  INT16_C( 31057), -INT16_C(  5341),  INT16_C( 16416), -INT16_C( 25060), -INT16_C( 14645),  INT16_C(  2799),
+        -INT16_C(  3108), -INT16_C( 12870),  INT16_C(  9122),  INT16_C(  7007), -INT16_C( 18097), -INT16_C( 24966), -INT16_C( 11997), -INT16_C( 11880),
+         INT16_C( 22110), -INT16_C( 12282),  INT16_C( 26293), -INT16_C( 32192),  INT16_C( 14715),  INT16_C( 16079),  INT16_C(  4514),  INT16_C(  1293),
+         INT16_C( 14981), -INT16_C(  9200), -INT16_C( 31439), -INT16_C(  2152), -INT16_C( 26726),  INT16_C(  6692),  INT16_C( 11308),  INT16_C(  8232) },
+      UINT32_C(2067486764),
+      { -INT8_C(  64), -INT8_C(  19),  INT8_C( 102), -INT8_C(  10),  INT8_C(  25),  INT8_C(  77),  INT8_C( 111),  INT8_C( 103),
+        -INT8_C(  69),  INT8_C(  80),  INT8_C(  98),  INT8_C(  44), -INT8_C(   4),  INT8_C( 113), -INT8_C(  95),  INT8_C(  58),
+         INT8_C(  48),  INT8_C(  56), -INT8_C(  58), -INT8_C(  47),  INT8_C(   8), -INT8_C(  78),  INT8_C(  21), -INT8_C(  21),
+        -INT8_C(  74),  INT8_C(  17), -INT8_C( 123),  INT8_C( 126), -INT8_C(  34),  INT8_C(  17),  INT8_C(  59), -INT8_C(  93),
+        -INT8_C(  88),  INT8_C(  33),  INT8_C(   9),  INT8_C(  23), -INT8_C(  73),  INT8_C(  14),  INT8_C(  30),  INT8_C(  28),
+        -INT8_C(   2), -INT8_C(  49), -INT8_C(  46),  INT8_C( 101),  INT8_C(   5),  INT8_C( 119),  INT8_C(  39),  INT8_C(  65),
+         INT8_C(  55), -INT8_C(   7),  INT8_C(  68),  INT8_C(  16),  INT8_C(  18),  INT8_C(  86), -INT8_C( 106), -INT8_C(  53),
+         INT8_C(   6),  INT8_C( 116), -INT8_C(  28), -INT8_C(  35),  INT8_C(  44),  INT8_C( 116),  INT8_C(  12),  INT8_C(  68) },
+      { -INT8_C( 112),  INT8_C(  81),  INT8_C(  93), -INT8_C(  61), -INT8_C(  96),  INT8_C(  51), -INT8_C(   9), -INT8_C(   6),
+        -INT8_C(  59), -INT8_C( 122),  INT8_C(  85),  INT8_C(  61), -INT8_C(  41), -INT8_C( 116), -INT8_C(  29),  INT8_C(  96),
+        -INT8_C(  32),  INT8_C(  89), -INT8_C(  99), -INT8_C(   8), -INT8_C(  53),  INT8_C(  82),  INT8_C(  36), -INT8_C( 104),
+        -INT8_C(  25),  INT8_C(  66),  INT8_C(  26), -INT8_C( 124),  INT8_C(   7), -INT8_C(  57), -INT8_C(  14),  INT8_C( 111),
+         INT8_C(  77), -INT8_C( 125), -INT8_C(  20), -INT8_C(  33),  INT8_C(  76),  INT8_C(  16), -INT8_C(  88),  INT8_C(  17),
+        -INT8_C(  83), -INT8_C( 104),  INT8_C(   9),  INT8_C(  63),  INT8_C(  75),  INT8_C(  69), -INT8_C(  99),  INT8_C(  30),
+         INT8_C( 106), -INT8_C(  64), -INT8_C(  59),  INT8_C(  32), -INT8_C(  26), -INT8_C(  95), -INT8_C(  32),  INT8_C(  19),
+         INT8_C( 127), -INT8_C(   9),      INT8_MIN,  INT8_C(   9), -INT8_C(  45),  INT8_C(  74), -INT8_C(  92), -INT8_C( 115) },
+      { -INT16_C( 10340), -INT16_C(  5112),  INT16_C(   287),  INT16_C(   457),  INT16_C( 16416),  INT16_C(   266), -INT16_C( 14645),  INT16_C(  2799),
+        -INT16_C(  3108), -INT16_C( 12870),  INT16_C(  9122),  INT16_C(   525),  INT16_C(   211), -INT16_C( 24966),  INT16_C(   399), -INT16_C( 11880),
+         INT16_C(   616),  INT16_C(   507),  INT16_C( 26293),  INT16_C(   256),  INT16_C(   375),  INT16_C(   473),  INT16_C(  4514),  INT16_C(  1293),
+         INT16_C(   253),  INT16_C(   439), -INT16_C( 31439),  INT16_C(   190),  INT16_C(   564),  INT16_C(   482),  INT16_C(   396),  INT16_C(  8232) } },
+    { {  INT16_C( 29220), -INT16_C( 29262),  INT16_C( 28054),  INT16_C( 21773),  INT16_C( 21289), -INT16_C( 30981),  INT16_C( 18163),  INT16_C( 25530),
+         INT16_C( 17089),  INT16_C(  9176), -INT16_C( 26939), -INT16_C(  9013),  INT16_C( 12977),  INT16_C(   438),  INT16_C( 14695), -INT16_C( 28991),
+        -INT16_C( 29535), -INT16_C( 16241),  INT16_C( 10035),  INT16_C( 29431),  INT16_C(   928),  INT16_C( 21715),  INT16_C( 28212),  INT16_C( 31212),
+         INT16_C( 11629), -INT16_C(  5275),  INT16_C( 26008),  INT16_C( 30507), -INT16_C( 26487),  INT16_C( 26403), -INT16_C(  2829), -INT16_C(  4317) },
+      UINT32_C( 321119913),
+      {  INT8_C(  96),  INT8_C( 122),  INT8_C(  90), -INT8_C(  58),  INT8_C(  17), -INT8_C(  23), -INT8_C(  86), -INT8_C(  51),
+        -INT8_C(  54),  INT8_C(  33), -INT8_C(  61),  INT8_C(   4), -INT8_C(  88),  INT8_C(  25),  INT8_C(  41),  INT8_C(  49),
+         INT8_C(  91),  INT8_C(  61),  INT8_C(  51),  INT8_C(   1),  INT8_C( 119),  INT8_C( 101),  INT8_C(  85), -INT8_C(  53),
+        -INT8_C(  74),  INT8_C(  85),  INT8_C(  57), -INT8_C(   9),      INT8_MIN,  INT8_C(  71), -INT8_C(   5), -INT8_C( 114),
+         INT8_C(  43), -INT8_C(  29),  INT8_C(  12), -INT8_C(  36), -INT8_C(  69),  INT8_C(   0), -INT8_C(  48), -INT8_C( 125),
+        -INT8_C(  10), -INT8_C( 119), -INT8_C(  44), -INT8_C(  27),  INT8_C(  48), -INT8_C(  94),  INT8_C( 119),  INT8_C(  79),
+        -INT8_C(  79), -INT8_C(  54), -INT8_C( 117),  INT8_C(  94),  INT8_C(  92), -INT8_C(  72),  INT8_C(  89), -INT8_C(  81),
+         INT8_C(  46),  INT8_C(  48), -INT8_C(  96),  INT8_C( 119),  INT8_C(  21),  INT8_C(  95),  INT8_C(  27),  INT8_C(  79) },
+      { -INT8_C(  39),  INT8_C(   6), -INT8_C(  24), -INT8_C(  61),  INT8_C( 112), -INT8_C(  50),  INT8_C(  97),  INT8_C(  35),
+         INT8_C(  45),  INT8_C(  95),  INT8_C( 117), -INT8_C(  51), -INT8_C(   6), -INT8_C(   9),  INT8_C( 118), -INT8_C(  66),
+         INT8_C(  75),  INT8_C(  83),  INT8_C(  81),  INT8_C(  51),  INT8_C( 107), -INT8_C(  15),  INT8_C( 126), -INT8_C( 112),
+         INT8_C(  73), -INT8_C( 103), -INT8_C(  76), -INT8_C(   9),  INT8_C(  54),  INT8_C( 112),  INT8_C(  62),  INT8_C( 120),
+        -INT8_C( 100), -INT8_C(  55), -INT8_C(  98),  INT8_C( 123), -INT8_C( 109), -INT8_C(  40), -INT8_C(  73), -INT8_C(  90),
+        -INT8_C( 111),  INT8_C(  54), -INT8_C(  70),  INT8_C( 115),  INT8_C(  11), -INT8_C(  37),  INT8_C(  44), -INT8_C(  28),
+         INT8_C(  75),  INT8_C(   1),  INT8_C(  25), -INT8_C( 111),  INT8_C(  62), -INT8_C( 114),  INT8_C( 115),  INT8_C(  67),
+         INT8_C( 121), -INT8_C(  79), -INT8_C(  76), -INT8_C(  81),  INT8_C(  58),  INT8_C(  66),  INT8_C(   6),  INT8_C(  88) },
+      {  INT16_C(   382), -INT16_C( 29262),  INT16_C( 28054),  INT16_C(   443),  INT16_C( 21289),  INT16_C(   447),  INT16_C( 18163),  INT16_C(   537),
+         INT16_C( 17089),  INT16_C(   134),  INT16_C(   148), -INT16_C(  9013),  INT16_C( 12977),  INT16_C(   507),  INT16_C(   455),  INT16_C(   355),
+         INT16_C(   382),  INT16_C(   411),  INT16_C( 10035),  INT16_C( 29431),  INT16_C(   928),  INT16_C(   556),  INT16_C( 28212),  INT16_C( 31212),
+         INT16_C(   468),  INT16_C(   391),  INT16_C( 26008),  INT16_C( 30507),  INT16_C(   280),  INT16_C( 26403), -INT16_C(  2829), -INT16_C(  4317) } },
+    { { -INT16_C(  9077),  INT16_C( 13669),  INT16_C( 26441), -INT16_C(  7449),  INT16_C( 20659), -INT16_C( 13950), -INT16_C(  3704),  INT16_C(  8738),
+        -INT16_C( 28124),  INT16_C( 15585), -INT16_C(  9224),  INT16_C( 16370), -INT16_C( 27877),  INT16_C(  1994), -INT16_C( 20295), -INT16_C( 27473),
+         INT16_C( 28333), -INT16_C(  2014), -INT16_C( 29847),  INT16_C(   968), -INT16_C( 18803),  INT16_C( 12063), -INT16_C(  1715),  INT16_C( 10830),
+        -INT16_C( 31742),  INT16_C( 24361), -INT16_C( 17081), -INT16_C( 16318),  INT16_C( 18093),  INT16_C(  6720),  INT16_C( 10650), -INT16_C( 29435) },
+      UINT32_C(2387161647),
+      { -INT8_C( 120),  INT8_C(  61),  INT8_C(  19), -INT8_C( 107), -INT8_C(   2),  INT8_C(  91),  INT8_C(  13), -INT8_C(  53),
+         INT8_C(  78),  INT8_C(  76), -INT8_C(  12), -INT8_C(  51), -INT8_C( 106),  INT8_C(  83),  INT8_C(  89), -INT8_C(  79),
+        -INT8_C(  84), -INT8_C(  89), -INT8_C(  20),  INT8_C(  39), -INT8_C(  27),  INT8_C(  12),  INT8_C(  94), -INT8_C(  70),
+         INT8_C(  95),  INT8_C(  71),  INT8_C( 105), -INT8_C(  99),  INT8_C(   0),  INT8_C(   4), -INT8_C(  52), -INT8_C(  35),
+        -INT8_C(  38), -INT8_C(  71),  INT8_C( 102),  INT8_C(  64),  INT8_C(  26),  INT8_C(  88),  INT8_C(   4), -INT8_C(  78),
+         INT8_C(  79), -INT8_C(  17), -INT8_C(  64),  INT8_C(   7),  INT8_C(  49), -INT8_C(  73), -INT8_C(  38),  INT8_C(  33),
+         INT8_C(  31), -INT8_C(  17), -INT8_C(  94),  INT8_C( 107),  INT8_C(  43),  INT8_C(  95), -INT8_C(  63),  INT8_C(  64),
+         INT8_C( 122),  INT8_C(  74), -INT8_C(  30), -INT8_C(  65), -INT8_C(  76),  INT8_C(  33), -INT8_C(  71),  INT8_C( 110) },
+      {  INT8_C(   8), -INT8_C(  62), -INT8_C(  51),  INT8_C( 124),  INT8_C(  28),  INT8_C( 112), -INT8_C(  38), -INT8_C( 117),
+         INT8_C( 104), -INT8_C(  52), -INT8_C(  37), -INT8_C(  72), -INT8_C(  31),  INT8_C( 102), -INT8_C(  10), -INT8_C(  49),
+         INT8_C( 104), -INT8_C(  54),  INT8_C(   1),  INT8_C( 115), -INT8_C(  87),  INT8_C(  78), -INT8_C(  68),  INT8_C(   9),
+        -INT8_C(  59),  INT8_C(  32),  INT8_C(  26), -INT8_C(  78), -INT8_C(  53),  INT8_C(  80), -INT8_C(  50),  INT8_C( 103),
+        -INT8_C(  35), -INT8_C(  24),  INT8_C(  91),  INT8_C(   7),  INT8_C(  57), -INT8_C( 115),  INT8_C( 118),  INT8_C(  52),
+         INT8_C(  16),  INT8_C(  58),  INT8_C(  60),  INT8_C(  50), -INT8_C(  68),  INT8_C(  31),  INT8_C(  13),  INT8_C(  71),
+         INT8_C( 125),  INT8_C(  73),  INT8_C(  79),  INT8_C(  51), -INT8_C(  55), -INT8_C(  68),  INT8_C(  99), -INT8_C(  45),
+        -INT8_C(  20),  INT8_C( 111), -INT8_C(  55),  INT8_C(  68), -INT8_C(   8),  INT8_C(  79), -INT8_C(  39),  INT8_C(  26) },
+      {  INT16_C(   472),  INT16_C(   428),  INT16_C(   188),  INT16_C(   307),  INT16_C( 20659),  INT16_C(   349), -INT16_C(  3704),  INT16_C(  8738),
+        -INT16_C( 28124),  INT16_C(   447), -INT16_C(  9224),  INT16_C( 16370),  INT16_C(   241),  INT16_C(   227), -INT16_C( 20295), -INT16_C( 27473),
+         INT16_C(   118), -INT16_C(  2014), -INT16_C( 29847),  INT16_C(   247), -INT16_C( 18803),  INT16_C( 12063),  INT16_C(   176),  INT16_C( 10830),
+        -INT16_C( 31742),  INT16_C(   407),  INT16_C(   212),  INT16_C(   154),  INT16_C( 18093),  INT16_C(  6720),  INT16_C( 10650),  INT16_C(   540) } },
+    { {  INT16_C(  2745), -INT16_C( 31328), -INT16_C( 20974),  INT16_C( 20655),  INT16_C(  8090), -INT16_C( 14689), -INT16_C( 26453), -INT16_C( 10885),
+         INT16_C( 31168),  INT16_C( 18797),  INT16_C( 17615), -INT16_C(  7232), -INT16_C(  6226), -INT16_C(  1140), -INT16_C( 10160),  INT16_C(   801),
+        -INT16_C( 31467),  INT16_C( 11752),  INT16_C( 32569), -INT16_C( 32409), -INT16_C( 23680),  INT16_C( 27714),  INT16_C(  2490), -INT16_C( 15709),
+         INT16_C( 10505), -INT16_C( 32091),  INT16_C( 32005), -INT16_C( 31943),  INT16_C(  5008), -INT16_C( 12531),  INT16_C( 31126), -INT16_C( 24305) },
+      UINT32_C(3335649289),
+      { -INT8_C(  30),  INT8_C(  63), -INT8_C(   3), -INT8_C(  74), -INT8_C( 127),  INT8_C(  78),  INT8_C(   4),  INT8_C(  20),
+        -INT8_C(  56), -INT8_C(  95),  INT8_C(  76), -INT8_C(  98),  INT8_C( 117),  INT8_C(  27), -INT8_C(  35), -INT8_C(  32),
+        -INT8_C(  17), -INT8_C(  10), -INT8_C(  19),  INT8_C(  32),  INT8_C( 124), -INT8_C( 108),  INT8_C(  13), -INT8_C( 111),
+        -INT8_C(  18),  INT8_C(  15), -INT8_C(  53),  INT8_C(  12),  INT8_C(  24),  INT8_C(  62), -INT8_C(   8), -INT8_C( 111),
+         INT8_C(  98),  INT8_C(  68),  INT8_C(  46),  INT8_C(   4),  INT8_C(  10),  INT8_C( 114), -INT8_C(  68), -INT8_C(  35),
+         INT8_C(  86),  INT8_C(  88), -INT8_C(   4),  INT8_C(  89), -INT8_C(  15), -INT8_C(  48),  INT8_C( 109), -INT8_C(  79),
+         INT8_C(  82), -INT8_C(  22), -INT8_C(  63), -INT8_C(  40),  INT8_C(  35), -INT8_C(  63),  INT8_C( 102), -INT8_C(  94),
+        -INT8_C(  23),  INT8_C(  40),  INT8_C( 116), -INT8_C(  74),  INT8_C(   1),  INT8_C(  71),  INT8_C(  83),  INT8_C( 111) },
+      {  INT8_C(  99), -INT8_C(  47),  INT8_C(  20),  INT8_C(  12),  INT8_C(  90),  INT8_C( 124), -INT8_C(  38),  INT8_C( 117),
+        -INT8_C( 123), -INT8_C(  20), -INT8_C(  67),  INT8_C(   6), -INT8_C(  60),  INT8_C( 113),  INT8_C( 123), -INT8_C(  17),
+         INT8_C(  78),  INT8_C(  90), -INT8_C(  26),  INT8_C(  89),  INT8_C( 105), -INT8_C( 115), -INT8_C( 106),  INT8_C(  87),
+        -INT8_C(   3), -INT8_C(  74), -INT8_C(  49), -INT8_C(  26), -INT8_C(  57), -INT8_C(  94), -INT8_C(  93),  INT8_C(  28),
+        -INT8_C( 122), -INT8_C(  39), -INT8_C(  54), -INT8_C( 121),      INT8_MIN, -INT8_C(  33), -INT8_C(  36), -INT8_C(  71),
+        -INT8_C( 112),  INT8_C(  77),  INT8_C( 121), -INT8_C(  83), -INT8_C(  28), -INT8_C(   7),  INT8_C( 102), -INT8_C(  72),
+        -INT8_C(  21),  INT8_C( 114), -INT8_C( 116),  INT8_C( 119),  INT8_C(  23), -INT8_C(  89), -INT8_C( 110),  INT8_C( 107),
+        -INT8_C(  93),  INT8_C(  10),  INT8_C(  34),  INT8_C(   4), -INT8_C(  88), -INT8_C(  71),  INT8_C( 104),  INT8_C(  36) },
+      {  INT16_C(   676), -INT16_C( 31328), -INT16_C( 20974),  INT16_C(   447),  INT16_C(  8090), -INT16_C( 14689), -INT16_C( 26453), -INT16_C( 10885),
+         INT16_C( 31168),  INT16_C( 18797),  INT16_C( 17615),  INT16_C(   211),  INT16_C(   404),  INT16_C(   462),  INT16_C(   417),  INT16_C(   447),
+         INT16_C(   472),  INT16_C( 11752),  INT16_C( 32569), -INT16_C( 32409),  INT16_C(   284),  INT16_C( 27714),  INT16_C(   346),  INT16_C(   303),
+         INT16_C( 10505),  INT16_C(   393),  INT16_C(   263), -INT16_C( 31943),  INT16_C(  5008), -INT16_C( 12531),  INT16_C(   259),  INT16_C(   209) } },
+    { { -INT16_C( 11093),  INT16_C(  7919), -INT16_C( 20072), -INT16_C( 11220), -INT16_C( 26781),  INT16_C(  2484), -INT16_C( 21129),  INT16_C( 31234),
+        -INT16_C( 22116), -INT16_C(  2648), -INT16_C(  1986), -INT16_C(  1177), -INT16_C( 11700),  INT16_C( 23901), -INT16_C( 18111), -INT16_C( 24630),
+        -INT16_C( 12312), -INT16_C( 27644), -INT16_C( 25447),  INT16_C(  3851), -INT16_C( 11513),  INT16_C( 11370),  INT16_C(  9088), -INT16_C( 26945),
+        -INT16_C(  8453),  INT16_C(  8055), -INT16_C(  8007),  INT16_C( 13023),  INT16_C( 29124), -INT16_C( 26453),  INT16_C( 19207),  INT16_C(   823) },
+      UINT32_C(3691459087),
+      {  INT8_C(  53), -INT8_C( 113),  INT8_C(  78), -INT8_C(  46),  INT8_C(  53),  INT8_C(  65), -INT8_C( 121), -INT8_C(  88),
+        -INT8_C(  31),  INT8_C(  26),  INT8_C( 102),  INT8_C(  38), -INT8_C(  12),  INT8_C(  93), -INT8_C(  59),  INT8_C( 106),
+         INT8_C(  50), -INT8_C(  60),  INT8_C(  85),  INT8_C(  25),  INT8_C(  71),  INT8_C(  27), -INT8_C(  35),  INT8_C( 114),
+        -INT8_C( 122), -INT8_C(  53), -INT8_C(  66), -INT8_C(  63),  INT8_C(  68),  INT8_C(  18), -INT8_C(  14), -INT8_C(  75),
+         INT8_C( 124),  INT8_C(  14),  INT8_C(  44),  INT8_C(  54),  INT8_C(  76), -INT8_C(  98), -INT8_C(  29), -INT8_C(  78),
+        -INT8_C(  49), -INT8_C(  32),  INT8_C( 105),  INT8_C( 113),  INT8_C(  33),  INT8_C(  59), -INT8_C(  13),  INT8_C(  56),
+         INT8_C(  82), -INT8_C(   2),  INT8_C(  79), -INT8_C( 121), -INT8_C(  76), -INT8_C( 121), -INT8_C(  94), -INT8_C(  43),
+        -INT8_C(  88), -INT8_C( 125), -INT8_C(  38), -INT8_C(  19), -INT8_C( 102), -INT8_C(  49), -INT8_C(  56), -INT8_C(  55) },
+      { -INT8_C( 122),  INT8_C(  63),  INT8_C(  55), -INT8_C( 115),  INT8_C(  16),  INT8_C(  76), -INT8_C( 118), -INT8_C(  67),
+         INT8_C(  80), -INT8_C( 116),  INT8_C(  77),  INT8_C( 101), -INT8_C( 127),  INT8_C(  42), -INT8_C( 116), -INT8_C( 111),
+        -INT8_C(  72), -INT8_C(  47), -INT8_C(  72),  INT8_C(  93),  INT8_C( 127),  INT8_C(  61), -INT8_C(  69), -INT8_C(  76),
+        -INT8_C( 105),  INT8_C(  16), -INT8_C(  36), -INT8_C(  89), -INT8_C( 110), -INT8_C(  53),  INT8_C( 112),  INT8_C(  18),
+         INT8_C( 114),  INT8_C(  90),  INT8_C(  90), -INT8_C(  28),  INT8_C(  17), -INT8_C( 127), -INT8_C(  66),  INT8_C(  67),
+         INT8_C(   1),  INT8_C(  31), -INT8_C(  49),  INT8_C(  28),  INT8_C(  92), -INT8_C(   8), -INT8_C(  73),  INT8_C(  14),
+         INT8_C( 126), -INT8_C(   4),  INT8_C(  65),  INT8_C(  35),  INT8_C(   1), -INT8_C( 109), -INT8_C(  56), -INT8_C(  99),
+        -INT8_C(  20),  INT8_C(  79), -INT8_C(  93),  INT8_C(  12), -INT8_C(  40),  INT8_C(  37),  INT8_C(  65),  INT8_C(  69) },
+      {  INT16_C(   253),  INT16_C(   355),  INT16_C(   289),  INT16_C(   226), -INT16_C( 26781),  INT16_C(  2484), -INT16_C( 21129),  INT16_C( 31234),
+        -INT16_C( 22116),  INT16_C(   281), -INT16_C(  1986), -INT16_C(  1177),  INT16_C(   260),  INT16_C(   205), -INT16_C( 18111), -INT16_C( 24630),
+         INT16_C(   306),  INT16_C(   331),  INT16_C(   343),  INT16_C(  3851), -INT16_C( 11513),  INT16_C( 11370),  INT16_C(  9088), -INT16_C( 26945),
+        -INT16_C(  8453),  INT16_C(  8055),  INT16_C(   442),  INT16_C(   307),  INT16_C(   400), -INT16_C( 26453),  INT16_C(   384),  INT16_C(   450) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi16(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi8(test_vec[i].b);
+    simde__m512i r = simde_mm512_mask_dbsad_epu8(src, test_vec[i].k, a, b, INT32_C(228));
+    simde_test_x86_assert_equal_i16x32(r, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_dbsad_epu8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 k;
+    const int8_t a[64];
+    const int8_t b[64];
+    const int16_t r[32];
+  } test_vec[] = {
+    { UINT32_C(1603174642),
+      {  INT8_C( 115),  INT8_C( 113),  INT8_C(  45),  INT8_C(  29),  INT8_C(  77), -INT8_C(  21), -INT8_C(  20), -INT8_C(  71),
+        -INT8_C( 114),  INT8_C( 109),  INT8_C(  29), -INT8_C(  23), -INT8_C(  36),  INT8_C(  93), -INT8_C(   1),  INT8_C(   0),
+         INT8_C(  40), -INT8_C( 124),  INT8_C(  99), -INT8_C( 109),  INT8_C( 126),  INT8_C(  90),  INT8_C(   0), -INT8_C(  72),
+        -INT8_C(  15), -INT8_C( 108),  INT8_C( 117), -INT8_C( 113), -INT8_C(  56),  INT8_C(  17), -INT8_C(  91), -INT8_C(  32),
+        -INT8_C(  41), -INT8_C(  44), -INT8_C(  61), -INT8_C(  70), -INT8_C(  51),  INT8_C(  78), -INT8_C(   4),  INT8_C(  55),
+         INT8_C(  81), -INT8_C(  57),  INT8_C(   0),  INT8_C( 110), -INT8_C(  90),  INT8_C( 119),  INT8_C(  33),  INT8_C(   1),
+         INT8_C(  11), -INT8_C(  15),  INT8_C(  12),  INT8_C( 114), -INT8_C(  16), -INT8_C( 127), -INT8_C( 114), -INT8_C(  83),
+         INT8_C(  36), -INT8_C(  28),  INT8_C(  47), -INT8_C(  53), -INT8_C(  84),  INT8_C( 107),  INT8_C( 111),  INT8_C(  17) },
+      { -INT8_C(  75),  INT8_C(  20),  INT8_C(  84),  INT8_C(  54), -INT8_C(   8), -INT8_C( 115), -INT8_C(  32),  INT8_C(  45),
+         INT8_C(  49),  INT8_C( 125), -INT8_C(  41),  INT8_C( 108),  INT8_C( 112), -INT8_C(  50), -INT8_C(  39),  INT8_C(  64),
+        -INT8_C(  72), -INT8_C( 121),  INT8_C(   0),  INT8_C( 102),  INT8_C(   2), -INT8_C( 112),  INT8_C(  11),  INT8_C(  93),
+         INT8_C(  71),  INT8_C( 111),  INT8_C(   1), -INT8_C(  11), -INT8_C( 116), -INT8_C( 123), -INT8_C(  72), -INT8_C(  73),
+        -INT8_C( 108),  INT8_C(  91),  INT8_C(  93), -INT8_C(  37), -INT8_C(  82),  INT8_C(  95), -INT8_C( 115),  INT8_C( 112),
+        -INT8_C(  10), -INT8_C(  97), -INT8_C(  86),  INT8_C( 103),  INT8_C(  15),  INT8_C(   9),  INT8_C(  87),  INT8_C(  49),
+         INT8_C(  39),  INT8_C( 113),  INT8_C(  13),  INT8_C(  35),  INT8_C(   1), -INT8_C(  49),  INT8_C(  28),  INT8_C(  94),
+         INT8_C(  76), -INT8_C(  76), -INT8_C(  39), -INT8_C(  12), -INT8_C(  33),  INT8_C(  12), -INT8_C(  42), -INT8_C(  31) },
+      {  INT16_C(     0),  INT16_C(   157),  INT16_C(     0),  INT16_C(     0),  INT16_C(   484),  INT16_C(   259),  INT16_C(   126),  INT16_C(   563),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   438),
+         INT16_C(     0),  INT16_C(   334),  INT16_C(   208),  INT16_C(   469),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   296),
+         INT16_C(    80),  INT16_C(   529),  INT16_C(   320),  INT16_C(   281),  INT16_C(   592),  INT16_C(     0),  INT16_C(   328),  INT16_C(     0) } },
+    { UINT32_C(2150759468),
+      { -INT8_C(  44), -INT8_C(   3),  INT8_C( 114), -INT8_C(  78), -INT8_C(  61),  INT8_C( 120),  INT8_C(   6),  INT8_C(  62),
+         INT8_C(  14), -INT8_C(  46), -INT8_C(  87), -INT8_C(  14), -INT8_C(  33), -INT8_C( 106), -INT8_C( 117), -INT8_C(  30),
+         INT8_C(  65), -INT8_C( 123),  INT8_C(  92), -INT8_C(  98),  INT8_C(  13), -INT8_C(  93), -INT8_C(  66), -INT8_C( 125),
+         INT8_C( 112),  INT8_C(  62), -INT8_C(   8), -INT8_C(  63), -INT8_C(  30), -INT8_C(  85), -INT8_C( 118),  INT8_C(  41),
+        -INT8_C(  19), -INT8_C( 126), -INT8_C(  51),  INT8_C( 106),  INT8_C( 100), -INT8_C(  68), -INT8_C(  47), -INT8_C(   4),
+        -INT8_C(  29),  INT8_C(  32), -INT8_C(  12),  INT8_C(  77), -INT8_C( 101),  INT8_C(  98),  INT8_C(  26), -INT8_C(  56),
+         INT8_C(  47),  INT8_C( 105), -INT8_C(   3), -INT8_C( 106), -INT8_C(  93), -INT8_C(  56), -INT8_C(  43),      INT8_MIN,
+         INT8_C( 105), -INT8_C(  85),  INT8_C(  56), -INT8_C(  36),  INT8_C( 107), -INT8_C(  19), -INT8_C(  46),  INT8_C(  53) },
+      { -INT8_C(  69), -INT8_C(  76), -INT8_C(  43), -INT8_C(  90), -INT8_C(   5), -INT8_C( 124),  INT8_C(  47),  INT8_C(  59),
+         INT8_C(  81), -INT8_C(  99), -INT8_C(  80), -INT8_C( 121),  INT8_C(  28),  INT8_C(  46), -INT8_C(  72), -INT8_C(  99),
+        -INT8_C(  36), -INT8_C( 103), -INT8_C(  34),  INT8_C(   1),  INT8_C(  95),  INT8_C( 101),  INT8_C(  77), -INT8_C(   5),
+         INT8_C(  30), -INT8_C( 114),  INT8_C( 127), -INT8_C(  67), -INT8_C(  94), -INT8_C(  17),  INT8_C(  68),  INT8_C( 118),
+         INT8_C(   6), -INT8_C(  92), -INT8_C( 109),  INT8_C(  12),  INT8_C(  50),  INT8_C( 120),      INT8_MIN,  INT8_C( 103),
+        -INT8_C(  21), -INT8_C(  34),  INT8_C( 115),  INT8_C(  49),  INT8_C(  75), -INT8_C(  53),  INT8_C( 106),  INT8_C(  16),
+        -INT8_C(  12),  INT8_C(  29), -INT8_C(  41),  INT8_C(   4), -INT8_C(  58),  INT8_C(  73),  INT8_C( 123), -INT8_C(  89),
+        -INT8_C(  58), -INT8_C( 123), -INT8_C(  90), -INT8_C( 125),  INT8_C(  42), -INT8_C(  18), -INT8_C( 127), -INT8_C(  44) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(   379),  INT16_C(   440),  INT16_C(     0),  INT16_C(   125),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(   323),  INT16_C(   423),  INT16_C(   482),  INT16_C(   290),  INT16_C(   405),  INT16_C(   353),
+         INT16_C(   277),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   522),  INT16_C(   397),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   455) } },
+    { UINT32_C(4286821091),
+      {  INT8_C(  70),  INT8_C(  28), -INT8_C(  28), -INT8_C(  81),  INT8_C(  94), -INT8_C(  96),  INT8_C( 127), -INT8_C(  57),
+         INT8_C(  24),  INT8_C(  16), -INT8_C( 104), -INT8_C(  45),  INT8_C( 124),  INT8_C(   2), -INT8_C(  94),  INT8_C( 107),
+        -INT8_C( 119), -INT8_C(  70),  INT8_C(  57),  INT8_C( 117), -INT8_C(  53),  INT8_C( 110),  INT8_C(  24),  INT8_C(  54),
+        -INT8_C(  98),  INT8_C(  25), -INT8_C(   5),  INT8_C(  76), -INT8_C(  54),  INT8_C(  59), -INT8_C(  31), -INT8_C(  38),
+        -INT8_C(  23), -INT8_C(  44), -INT8_C(   5), -INT8_C(  50), -INT8_C(  47),  INT8_C( 114), -INT8_C( 116),  INT8_C(  33),
+        -INT8_C(  63), -INT8_C( 120),  INT8_C( 107), -INT8_C(  17),  INT8_C(  40),  INT8_C(  58),  INT8_C( 106), -INT8_C(  50),
+         INT8_C(  89),  INT8_C(  37),  INT8_C(   7),  INT8_C( 105),  INT8_C(  23),  INT8_C(  57),  INT8_C(  73), -INT8_C( 119),
+         INT8_C(  74), -INT8_C(   2),  INT8_C(  55), -INT8_C(  15),  INT8_C(  38),  INT8_C(  84), -INT8_C(  10),  INT8_C(  11) },
+      { -INT8_C(  99), -INT8_C( 110), -INT8_C(  25),  INT8_C(  80),  INT8_C(  76), -INT8_C(  16),  INT8_C( 123), -INT8_C(  19),
+        -INT8_C(  96), -INT8_C( 123),  INT8_C(  46),  INT8_C(  90), -INT8_C( 126),  INT8_C( 101), -INT8_C(  77),  INT8_C(  40),
+        -INT8_C(  52), -INT8_C(  57),  INT8_C(  42),  INT8_C( 112), -INT8_C(  98),  INT8_C( 123), -INT8_C(  77), -INT8_C( 110),
+        -INT8_C(  11), -INT8_C(   8), -INT8_C(  57), -INT8_C(  66),  INT8_C( 105),  INT8_C(  97),  INT8_C(   1),  INT8_C(  85),
+         INT8_C(  61),  INT8_C(  65), -INT8_C(  87),  INT8_C( 116),  INT8_C(  50),  INT8_C(  40),  INT8_C( 114), -INT8_C( 124),
+        -INT8_C( 125),  INT8_C(  16),  INT8_C(  74), -INT8_C(  56),  INT8_C(  57),  INT8_C(  57), -INT8_C(  63), -INT8_C( 102),
+        -INT8_C(  97),  INT8_C(   4), -INT8_C(   2), -INT8_C(  79),  INT8_C(   2),  INT8_C(  20), -INT8_C( 110), -INT8_C(   1),
+         INT8_C( 106), -INT8_C(  42),  INT8_C(  69), -INT8_C(  79), -INT8_C(  40), -INT8_C(  65), -INT8_C(  58), -INT8_C(  95) },
+      {  INT16_C(   385),  INT16_C(   289),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   406),  INT16_C(   137),  INT16_C(   379),
+         INT16_C(     0),  INT16_C(   238),  INT16_C(     0),  INT16_C(     0),  INT16_C(   384),  INT16_C(   379),  INT16_C(     0),  INT16_C(   464),
+         INT16_C(   566),  INT16_C(   485),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   195),
+         INT16_C(   393),  INT16_C(   427),  INT16_C(   431),  INT16_C(   490),  INT16_C(   428),  INT16_C(   361),  INT16_C(   331),  INT16_C(   683) } },
+    { UINT32_C(3793562101),
+      { -INT8_C(  26), -INT8_C(   5), -INT8_C(  46),  INT8_C(  55),  INT8_C(   1), -INT8_C(  95), -INT8_C( 118), -INT8_C(  65),
+        -INT8_C( 108),  INT8_C(   9),  INT8_C(  59), -INT8_C( 119), -INT8_C(  90),  INT8_C( 119),  INT8_C(  11), -INT8_C(  69),
+        -INT8_C(  78),  INT8_C( 125),  INT8_C(  33),  INT8_C(  17), -INT8_C(  79), -INT8_C(  64), -INT8_C( 105), -INT8_C(  34),
+        -INT8_C(  45),  INT8_C(  58), -INT8_C( 124),  INT8_C(  33),  INT8_C(   7),  INT8_C(  61),  INT8_C(  67),  INT8_C(   3),
+         INT8_C(  67),  INT8_C(  39), -INT8_C(  55),  INT8_C(  92),  INT8_C(  28), -INT8_C(  88), -INT8_C(  99),  INT8_C( 114),
+        -INT8_C( 122),  INT8_C(  51), -INT8_C( 117), -INT8_C( 106),  INT8_C(  25),  INT8_C(  23), -INT8_C(   9), -INT8_C( 100),
+         INT8_C(  73), -INT8_C(  37), -INT8_C(  58),  INT8_C(  51),  INT8_C( 113),  INT8_C(  71),  INT8_C(  97), -INT8_C(  45),
+         INT8_C(  34), -INT8_C(   8), -INT8_C(  41), -INT8_C( 124),  INT8_C(  53), -INT8_C(  37),  INT8_C(  82), -INT8_C(  86) },
+      { -INT8_C(   5),  INT8_C(  16), -INT8_C( 110),  INT8_C(  77),  INT8_C(  51), -INT8_C(  11),  INT8_C(   2), -INT8_C(  18),
+         INT8_C(  23), -INT8_C( 127), -INT8_C(  96),  INT8_C(  25), -INT8_C(  27), -INT8_C(  62),  INT8_C( 107),  INT8_C(  95),
+        -INT8_C(  27), -INT8_C(  42),  INT8_C(  27),  INT8_C(  35), -INT8_C(  95),  INT8_C(  86), -INT8_C( 124), -INT8_C(  43),
+         INT8_C( 124), -INT8_C(  86), -INT8_C(  53),  INT8_C( 120),  INT8_C(  36),  INT8_C(  10),  INT8_C(  64),  INT8_C(  98),
+        -INT8_C( 110), -INT8_C(  95),  INT8_C(  90),  INT8_C( 116), -INT8_C( 112), -INT8_C( 111), -INT8_C(  26),  INT8_C(  37),
+        -INT8_C(  17),  INT8_C(  44), -INT8_C( 110), -INT8_C(  51),  INT8_C(  76), -INT8_C(  60), -INT8_C(  57),  INT8_C(  62),
+        -INT8_C(  14),  INT8_C(  93), -INT8_C(  45), -INT8_C(  16), -INT8_C(  39),  INT8_C(  90), -INT8_C( 116),  INT8_C(  37),
+        -INT8_C(  31), -INT8_C(  56),  INT8_C( 111),  INT8_C(   5), -INT8_C(  15),  INT8_C(  52),  INT8_C( 106),  INT8_C(  20) },
+      {  INT16_C(   576),  INT16_C(     0),  INT16_C(   255),  INT16_C(     0),  INT16_C(   356),  INT16_C(   294),  INT16_C(   494),  INT16_C(   249),
+         INT16_C(   351),  INT16_C(     0),  INT16_C(     0),  INT16_C(   142),  INT16_C(     0),  INT16_C(   437),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(   267),  INT16_C(     0),  INT16_C(   485),  INT16_C(   225),  INT16_C(   351),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(   431),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   465),  INT16_C(   489),  INT16_C(   108) } },
+    { UINT32_C( 912240054),
+      {  INT8_C( 109),  INT8_C(  83), -INT8_C(  55), -INT8_C( 116), -INT8_C(  57),  INT8_C(  80), -INT8_C(  54),  INT8_C(   3),
+        -INT8_C( 111), -INT8_C( 124), -INT8_C(  75),  INT8_C(  86), -INT8_C(  38),  INT8_C(  77), -INT8_C(  57),  INT8_C(  92),
+        -INT8_C(  28), -INT8_C( 101), -INT8_C(  30),  INT8_C(  35), -INT8_C(  89), -INT8_C( 112), -INT8_C( 109),  INT8_C(  88),
+         INT8_C( 104), -INT8_C( 114),  INT8_C(  55),  INT8_C(  53), -INT8_C( 115), -INT8_C(  50),  INT8_C( 123), -INT8_C(  91),
+         INT8_C(  68),  INT8_C(  16), -INT8_C(  60),  INT8_C(  55), -INT8_C(  91), -INT8_C( 118), -INT8_C(  19),  INT8_C(  34),
+        -INT8_C(  72),  INT8_C(  79), -INT8_C(  43), -INT8_C(  38),  INT8_C(  41),  INT8_C(  35),  INT8_C(  41),  INT8_C(  83),
+        -INT8_C(  93),  INT8_C(   2),  INT8_C(  14),  INT8_C(  56), -INT8_C(  22), -INT8_C(  61), -INT8_C(  18),  INT8_C(  55),
+        -INT8_C(  17),  INT8_C(  90), -INT8_C(  58), -INT8_C( 119),  INT8_C(  30), -INT8_C(  44),  INT8_C(  85), -INT8_C(   9) },
+      {  INT8_C(  46), -INT8_C(  54),  INT8_C(  59),  INT8_C( 121), -INT8_C(  99),  INT8_C( 120),  INT8_C( 102), -INT8_C( 110),
+         INT8_C(  73),  INT8_C(  69), -INT8_C(  21),  INT8_C(  28),  INT8_C( 108),  INT8_C(  32),  INT8_C(  78), -INT8_C(  48),
+         INT8_C(  59),  INT8_C( 111), -INT8_C(  79), -INT8_C( 102),  INT8_C(  43),  INT8_C(  85),  INT8_C( 107), -INT8_C(  45),
+        -INT8_C(  88),  INT8_C(  91),  INT8_C(   9), -INT8_C(  69),  INT8_C(  60), -INT8_C(  32), -INT8_C(  71),  INT8_C(  98),
+         INT8_C(  56), -INT8_C(  80), -INT8_C(  57), -INT8_C(  14), -INT8_C( 119),      INT8_MIN,  INT8_C(  15), -INT8_C(  81),
+        -INT8_C(  60), -INT8_C(  77), -INT8_C(  70), -INT8_C(   1), -INT8_C(  44),  INT8_C(  45),  INT8_C( 121), -INT8_C(  99),
+         INT8_C(  88), -INT8_C(  66),  INT8_C(  39),  INT8_C( 121), -INT8_C(  31),  INT8_C(  26), -INT8_C(  14),  INT8_C(  11),
+         INT8_C(  39),  INT8_C(  61),  INT8_C(  67),  INT8_C(  51),  INT8_C(  11),  INT8_C(  47),  INT8_C(  13),  INT8_C(  43) },
+      {  INT16_C(     0),  INT16_C(   152),  INT16_C(   358),  INT16_C(     0),  INT16_C(   362),  INT16_C(   234),  INT16_C(     0),  INT16_C(    77),
+         INT16_C(   550),  INT16_C(     0),  INT16_C(   151),  INT16_C(   203),  INT16_C(     0),  INT16_C(   212),  INT16_C(     0),  INT16_C(   214),
+         INT16_C(   482),  INT16_C(   223),  INT16_C(   373),  INT16_C(   278),  INT16_C(   215),  INT16_C(     0),  INT16_C(   310),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(   397),  INT16_C(   397),  INT16_C(     0),  INT16_C(   550),  INT16_C(   473),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(3000454794),
+      { -INT8_C( 105),  INT8_C(  82),  INT8_C(  36),  INT8_C(  62),  INT8_C( 126),  INT8_C( 114),  INT8_C(  14),  INT8_C(  64),
+        -INT8_C(  96), -INT8_C(  55), -INT8_C( 100), -INT8_C(  67),  INT8_C(  12), -INT8_C(   4),  INT8_C(  49), -INT8_C(   1),
+         INT8_C(  34),  INT8_C( 116),  INT8_C(   8),  INT8_C(  86), -INT8_C(  46),  INT8_C( 127), -INT8_C(  53),  INT8_C(  96),
+         INT8_C(  32),  INT8_C(  24), -INT8_C(  64), -INT8_C(  19),  INT8_C(  74),  INT8_C( 100), -INT8_C(  92),  INT8_C(  33),
+         INT8_C(   3),  INT8_C( 103),  INT8_C( 111), -INT8_C( 127),  INT8_C(  48), -INT8_C(   2), -INT8_C(  97),  INT8_C( 106),
+         INT8_C(  60), -INT8_C( 102),  INT8_C(  81), -INT8_C( 123),  INT8_C(  18), -INT8_C( 104), -INT8_C(  31),  INT8_C(  90),
+         INT8_C(  80), -INT8_C(   4),  INT8_C(  85), -INT8_C(  63),  INT8_C(  80), -INT8_C(  74), -INT8_C( 125), -INT8_C(  80),
+         INT8_C( 125),  INT8_C(   9), -INT8_C(  93),  INT8_C(  36), -INT8_C( 120), -INT8_C(   9), -INT8_C( 100), -INT8_C( 125) },
+      { -INT8_C(  58),  INT8_C(  99), -INT8_C(  71), -INT8_C(  64),  INT8_C(  11), -INT8_C(  15),  INT8_C(  44), -INT8_C( 118),
+         INT8_C( 121),  INT8_C( 105),  INT8_C(  23), -INT8_C(  69),  INT8_C(  12),  INT8_C( 100), -INT8_C( 114), -INT8_C(  55),
+         INT8_C(  60),  INT8_C(   6),  INT8_C(  52), -INT8_C(  68), -INT8_C(  89),  INT8_C(  56),  INT8_C( 118),  INT8_C(  32),
+         INT8_C( 106),  INT8_C( 108),  INT8_C(  64),  INT8_C(  66),  INT8_C( 100), -INT8_C(  88),  INT8_C(  31), -INT8_C( 115),
+         INT8_C( 106),  INT8_C(  44),  INT8_C(  52), -INT8_C(  20), -INT8_C(  17),  INT8_C(  78), -INT8_C( 126),  INT8_C(  67),
+         INT8_C(   7),  INT8_C(  77), -INT8_C(  57), -INT8_C( 102), -INT8_C(  27),  INT8_C(  56), -INT8_C(  60), -INT8_C(  93),
+        -INT8_C(  98), -INT8_C(  21), -INT8_C(  10), -INT8_C(  31),  INT8_C(  54),  INT8_C(  94),  INT8_C(  96), -INT8_C(  34),
+         INT8_C(  95), -INT8_C(  13),  INT8_C(  44), -INT8_C( 102),  INT8_C(  39), -INT8_C( 125), -INT8_C(   4), -INT8_C(  49) },
+      {  INT16_C(     0),  INT16_C(   289),  INT16_C(     0),  INT16_C(   151),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   363),
+         INT16_C(     0),  INT16_C(    68),  INT16_C(   296),  INT16_C(   326),  INT16_C(     0),  INT16_C(     0),  INT16_C(   215),  INT16_C(     0),
+         INT16_C(   342),  INT16_C(   268),  INT16_C(   450),  INT16_C(     0),  INT16_C(   412),  INT16_C(     0),  INT16_C(   354),  INT16_C(   410),
+         INT16_C(     0),  INT16_C(   405),  INT16_C(     0),  INT16_C(     0),  INT16_C(   468),  INT16_C(   415),  INT16_C(     0),  INT16_C(   354) } },
+    { UINT32_C(1593531193),
+      { -INT8_C(  49), -INT8_C( 120), -INT8_C( 115),  INT8_C(  46),  INT8_C(  88),  INT8_C( 108),  INT8_C(  62), -INT8_C(  86),
+        -INT8_C(   7), -INT8_C( 106), -INT8_C(  99),  INT8_C(  84), -INT8_C(  70), -INT8_C(  73),  INT8_C( 102),  INT8_C( 114),
+             INT8_MIN,  INT8_C(   9),  INT8_C(  45), -INT8_C( 103),  INT8_C( 114),  INT8_C(  22),  INT8_C(  30),  INT8_C(  90),
+         INT8_C( 124),  INT8_C(  34),  INT8_C(  88),  INT8_C( 122), -INT8_C( 126),  INT8_C(  57), -INT8_C(  75), -INT8_C(  98),
+        -INT8_C(  15), -INT8_C(  94), -INT8_C(   3), -INT8_C( 124),  INT8_C( 103),  INT8_C(  41),  INT8_C(  83),  INT8_C(  95),
+        -INT8_C(  23), -INT8_C(  44),  INT8_C(  21), -INT8_C(  63),  INT8_C(  36),  INT8_C( 124),  INT8_C(  66),  INT8_C(  14),
+        -INT8_C(  96),  INT8_C(  69), -INT8_C( 103),  INT8_C( 116),  INT8_C(  60),  INT8_C(  72),  INT8_C(  78),  INT8_C(  68),
+         INT8_C(  14),  INT8_C( 114),  INT8_C(   4), -INT8_C( 122),  INT8_C( 119), -INT8_C(   1),  INT8_C(  94), -INT8_C(  64) },
+      {  INT8_C(  59), -INT8_C(  47), -INT8_C(  34),  INT8_C(  51), -INT8_C(  99), -INT8_C( 118), -INT8_C(  89), -INT8_C(  86),
+        -INT8_C(  25), -INT8_C( 104),  INT8_C(  67),  INT8_C( 121),  INT8_C(  27), -INT8_C(  81),  INT8_C(   8), -INT8_C(  82),
+        -INT8_C(  65),  INT8_C(  50), -INT8_C(  22),  INT8_C(  69), -INT8_C( 117), -INT8_C(  32),  INT8_C(  69),  INT8_C( 109),
+        -INT8_C(  15), -INT8_C(  50), -INT8_C(  99), -INT8_C( 126),  INT8_C(  55), -INT8_C(  57),  INT8_C(  82), -INT8_C( 104),
+         INT8_C(  57),  INT8_C(   5), -INT8_C( 107), -INT8_C( 106),  INT8_C(  65),  INT8_C(  73),  INT8_C( 109),  INT8_C(  79),
+         INT8_C(  71), -INT8_C(  83),  INT8_C(  80), -INT8_C(  58),  INT8_C( 121),  INT8_C(  11),  INT8_C(  27),  INT8_C(   7),
+         INT8_C(  21),  INT8_C(   5), -INT8_C(  63),  INT8_C( 112),  INT8_C( 102),  INT8_C(  14), -INT8_C( 102),  INT8_C(   9),
+        -INT8_C(  37),  INT8_C(  26),  INT8_C(  58),  INT8_C( 100), -INT8_C(  36), -INT8_C(   9), -INT8_C(  28),  INT8_C(  11) },
+      {  INT16_C(   202),  INT16_C(     0),  INT16_C(     0),  INT16_C(   398),  INT16_C(   486),  INT16_C(   258),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(   294),  INT16_C(   308),  INT16_C(     0),  INT16_C(   467),  INT16_C(   270),  INT16_C(     0),  INT16_C(   261),  INT16_C(     0),
+         INT16_C(   462),  INT16_C(   456),  INT16_C(     0),  INT16_C(   159),  INT16_C(   505),  INT16_C(   557),  INT16_C(   144),  INT16_C(   292),
+         INT16_C(     0),  INT16_C(   478),  INT16_C(   340),  INT16_C(   260),  INT16_C(   686),  INT16_C(     0),  INT16_C(   613),  INT16_C(     0) } },
+    { UINT32_C(1899519017),
+      { -INT8_C(  47), -INT8_C( 100),  INT8_C(  17),  INT8_C(  59),  INT8_C(  39),  INT8_C(  43), -INT8_C( 115),  INT8_C(  76),
+         INT8_C(  90),  INT8_C(  72), -INT8_C(  78),  INT8_C(  51),  INT8_C( 115), -INT8_C(  25),  INT8_C(  46),  INT8_C(  14),
+        -INT8_C(  26),  INT8_C(  93), -INT8_C( 105), -INT8_C(  82),  INT8_C(  63),  INT8_C( 113),  INT8_C(   7), -INT8_C(  21),
+         INT8_C(  54),  INT8_C( 104),  INT8_C(  88),  INT8_C( 102), -INT8_C(  10),  INT8_C(  65),  INT8_C(  11),  INT8_C( 119),
+        -INT8_C(  75),  INT8_C(  72),  INT8_C(  28),  INT8_C(  60), -INT8_C(  30),  INT8_C(  71), -INT8_C(  95),  INT8_C( 106),
+         INT8_C(  78), -INT8_C(  66), -INT8_C( 105), -INT8_C( 124), -INT8_C(  21), -INT8_C(  40),  INT8_C(  63),  INT8_C(  21),
+         INT8_C(  79), -INT8_C(  29), -INT8_C(  84), -INT8_C(  17),  INT8_C( 126), -INT8_C(  70),  INT8_C( 105), -INT8_C(  87),
+         INT8_C(  22),  INT8_C(  66), -INT8_C(  68), -INT8_C(  63),  INT8_C( 100), -INT8_C( 108),  INT8_C(  39), -INT8_C( 113) },
+      {  INT8_C(  80),  INT8_C(  44), -INT8_C(  34), -INT8_C(  33),  INT8_C(  44), -INT8_C(  96),  INT8_C(   5),  INT8_C(  55),
+         INT8_C(  49), -INT8_C(  49), -INT8_C(  94),  INT8_C(  31), -INT8_C(  63), -INT8_C(  98), -INT8_C(  69), -INT8_C( 110),
+         INT8_C(  11), -INT8_C(  43),  INT8_C( 114), -INT8_C(  48), -INT8_C(  63), -INT8_C(  44), -INT8_C(  41),  INT8_C(  18),
+         INT8_C(  58), -INT8_C(  86),  INT8_C(  51),  INT8_C(  99),  INT8_C(  43),  INT8_C(  47), -INT8_C(  29),      INT8_MIN,
+        -INT8_C(  37),  INT8_C(  28), -INT8_C(  72), -INT8_C(  79), -INT8_C(  38), -INT8_C(  47), -INT8_C( 122),  INT8_C(  75),
+        -INT8_C(  61), -INT8_C(  90),  INT8_C(  91), -INT8_C(  35), -INT8_C(   4), -INT8_C( 111), -INT8_C(  10),  INT8_C(   5),
+         INT8_C( 109), -INT8_C(  29), -INT8_C(  58),  INT8_C(  41),  INT8_C(  23),  INT8_C(  65),  INT8_C(   7), -INT8_C(  17),
+        -INT8_C(  94), -INT8_C(  45), -INT8_C(  44), -INT8_C(  19), -INT8_C(  86),  INT8_C(  29), -INT8_C( 105),  INT8_C(   8) },
+      {  INT16_C(   185),  INT16_C(     0),  INT16_C(     0),  INT16_C(   174),  INT16_C(     0),  INT16_C(   244),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(   363),  INT16_C(   447),  INT16_C(   233),  INT16_C(     0),  INT16_C(   176),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   295),  INT16_C(   441),  INT16_C(   356),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(   383),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   407),  INT16_C(   356),  INT16_C(   345),  INT16_C(     0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi8(test_vec[i].b);
+    simde__m512i r = simde_mm512_maskz_dbsad_epu8(test_vec[i].k, a, b, INT32_C( 57));
+    simde_test_x86_assert_equal_i16x32(r, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_dbsad_epu8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_dbsad_epu8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_dbsad_epu8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_dbsad_epu8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_dbsad_epu8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_dbsad_epu8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_dbsad_epu8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_dbsad_epu8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_dbsad_epu8)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -2,9 +2,11 @@ SIMDE_TEST_DECLARE_SUITE(2intersect)
 SIMDE_TEST_DECLARE_SUITE(abs)
 SIMDE_TEST_DECLARE_SUITE(add)
 SIMDE_TEST_DECLARE_SUITE(adds)
+SIMDE_TEST_DECLARE_SUITE(alignr)
 SIMDE_TEST_DECLARE_SUITE(and)
 SIMDE_TEST_DECLARE_SUITE(andnot)
 SIMDE_TEST_DECLARE_SUITE(avg)
+SIMDE_TEST_DECLARE_SUITE(bitshuffle)
 SIMDE_TEST_DECLARE_SUITE(blend)
 SIMDE_TEST_DECLARE_SUITE(broadcast)
 SIMDE_TEST_DECLARE_SUITE(cast)
@@ -14,17 +16,40 @@ SIMDE_TEST_DECLARE_SUITE(cmpgt)
 SIMDE_TEST_DECLARE_SUITE(cmp)
 SIMDE_TEST_DECLARE_SUITE(cmple)
 SIMDE_TEST_DECLARE_SUITE(cmplt)
+SIMDE_TEST_DECLARE_SUITE(compress)
+SIMDE_TEST_DECLARE_SUITE(conflict)
 SIMDE_TEST_DECLARE_SUITE(copysign)
 SIMDE_TEST_DECLARE_SUITE(cvt)
 SIMDE_TEST_DECLARE_SUITE(cvts)
+SIMDE_TEST_DECLARE_SUITE(dbsad)
 SIMDE_TEST_DECLARE_SUITE(div)
+SIMDE_TEST_DECLARE_SUITE(dpbusd)
+SIMDE_TEST_DECLARE_SUITE(dpbusds)
+SIMDE_TEST_DECLARE_SUITE(dpwssd)
+SIMDE_TEST_DECLARE_SUITE(dpwssds)
+SIMDE_TEST_DECLARE_SUITE(expand)
 SIMDE_TEST_DECLARE_SUITE(extract)
+SIMDE_TEST_DECLARE_SUITE(fixupimm)
 SIMDE_TEST_DECLARE_SUITE(fmadd)
 SIMDE_TEST_DECLARE_SUITE(fmsub)
 SIMDE_TEST_DECLARE_SUITE(fnmadd)
 SIMDE_TEST_DECLARE_SUITE(fnmsub)
+SIMDE_TEST_DECLARE_SUITE(gather)
+SIMDE_TEST_DECLARE_SUITE(getexp)
+SIMDE_TEST_DECLARE_SUITE(getmant)
 SIMDE_TEST_DECLARE_SUITE(insert)
+SIMDE_TEST_DECLARE_SUITE(kadd)
+SIMDE_TEST_DECLARE_SUITE(kand)
+SIMDE_TEST_DECLARE_SUITE(kandn)
+SIMDE_TEST_DECLARE_SUITE(kmov)
+SIMDE_TEST_DECLARE_SUITE(knot)
+SIMDE_TEST_DECLARE_SUITE(kor)
+SIMDE_TEST_DECLARE_SUITE(kortest)
 SIMDE_TEST_DECLARE_SUITE(kshift)
+SIMDE_TEST_DECLARE_SUITE(ktest)
+SIMDE_TEST_DECLARE_SUITE(kunpack)
+SIMDE_TEST_DECLARE_SUITE(kxnor)
+SIMDE_TEST_DECLARE_SUITE(kxor)
 SIMDE_TEST_DECLARE_SUITE(load)
 SIMDE_TEST_DECLARE_SUITE(loadu)
 SIMDE_TEST_DECLARE_SUITE(lzcnt)
@@ -39,13 +64,22 @@ SIMDE_TEST_DECLARE_SUITE(mul)
 SIMDE_TEST_DECLARE_SUITE(mulhi)
 SIMDE_TEST_DECLARE_SUITE(mulhrs)
 SIMDE_TEST_DECLARE_SUITE(mullo)
+SIMDE_TEST_DECLARE_SUITE(multishift)
 SIMDE_TEST_DECLARE_SUITE(negate)
 SIMDE_TEST_DECLARE_SUITE(or)
 SIMDE_TEST_DECLARE_SUITE(packs)
 SIMDE_TEST_DECLARE_SUITE(packus)
 SIMDE_TEST_DECLARE_SUITE(permutex2var)
 SIMDE_TEST_DECLARE_SUITE(permutexvar)
+SIMDE_TEST_DECLARE_SUITE(popcnt)
+SIMDE_TEST_DECLARE_SUITE(range)
+SIMDE_TEST_DECLARE_SUITE(rcp)
+SIMDE_TEST_DECLARE_SUITE(reduce)
+SIMDE_TEST_DECLARE_SUITE(roundscale)
+SIMDE_TEST_DECLARE_SUITE(rsqrt)
 SIMDE_TEST_DECLARE_SUITE(sad)
+SIMDE_TEST_DECLARE_SUITE(scalef)
+SIMDE_TEST_DECLARE_SUITE(scatter)
 SIMDE_TEST_DECLARE_SUITE(set1)
 SIMDE_TEST_DECLARE_SUITE(set4)
 SIMDE_TEST_DECLARE_SUITE(set)
@@ -53,6 +87,10 @@ SIMDE_TEST_DECLARE_SUITE(setone)
 SIMDE_TEST_DECLARE_SUITE(setr4)
 SIMDE_TEST_DECLARE_SUITE(setr)
 SIMDE_TEST_DECLARE_SUITE(setzero)
+SIMDE_TEST_DECLARE_SUITE(shldi)
+SIMDE_TEST_DECLARE_SUITE(shldv)
+SIMDE_TEST_DECLARE_SUITE(shrdi)
+SIMDE_TEST_DECLARE_SUITE(shrdv)
 SIMDE_TEST_DECLARE_SUITE(shuffle)
 SIMDE_TEST_DECLARE_SUITE(sll)
 SIMDE_TEST_DECLARE_SUITE(slli)
@@ -68,6 +106,7 @@ SIMDE_TEST_DECLARE_SUITE(store)
 SIMDE_TEST_DECLARE_SUITE(storeu)
 SIMDE_TEST_DECLARE_SUITE(sub)
 SIMDE_TEST_DECLARE_SUITE(subs)
+SIMDE_TEST_DECLARE_SUITE(ternarylogic)
 SIMDE_TEST_DECLARE_SUITE(test)
 SIMDE_TEST_DECLARE_SUITE(unpackhi)
 SIMDE_TEST_DECLARE_SUITE(unpacklo)
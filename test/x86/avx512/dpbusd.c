@@ -0,0 +1,779 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN dpbusd
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/dpbusd.h>
+
+static int
+test_simde_mm_dpbusd_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(  1909016608),  INT32_C(   258855105), -INT32_C(  1787177767),  INT32_C(   180341798) },
+      { -INT32_C(  1519393256),  INT32_C(   910725594), -INT32_C(   507094484), -INT32_C(  2127226932) },
+      {  INT32_C(  1330714495),  INT32_C(  1525486969), -INT32_C(  1355032022),  INT32_C(  1804892242) },
+      { -INT32_C(  1908986244),  INT32_C(   258888020), -INT32_C(  1787185882),  INT32_C(   180369365) } },
+    { { -INT32_C(  1350620746),  INT32_C(  1176250892), -INT32_C(  2014908014), -INT32_C(  1042229844) },
+      { -INT32_C(  1325330522),  INT32_C(  1615365076), -INT32_C(  1511496688),  INT32_C(   535567386) },
+      { -INT32_C(   960260592),  INT32_C(   547084527), -INT32_C(  1392433700),  INT32_C(  1520551952) },
+      { -INT32_C(  1350630007),  INT32_C(  1176237848), -INT32_C(  2014918353), -INT32_C(  1042250626) } },
+    { { -INT32_C(   779298959), -INT32_C(   505544628), -INT32_C(  1848221182), -INT32_C(    26060178) },
+      { -INT32_C(   583839383),  INT32_C(   145485890),  INT32_C(   937872884),  INT32_C(  1284106897) },
+      { -INT32_C(   393482087), -INT32_C(   623802181),  INT32_C(  1825416903),  INT32_C(  1784456696) },
+      { -INT32_C(   779322341), -INT32_C(   505586323), -INT32_C(  1848259330), -INT32_C(    26061972) } },
+    { {  INT32_C(   786021932), -INT32_C(  1514885744), -INT32_C(  1633743404),  INT32_C(  1817089333) },
+      { -INT32_C(   501981684), -INT32_C(  1706808695), -INT32_C(   474940563), -INT32_C(   157184942) },
+      { -INT32_C(  1803904189), -INT32_C(   423241063),  INT32_C(  1515474573),  INT32_C(   199797216) },
+      {  INT32_C(   785991274), -INT32_C(  1514909467), -INT32_C(  1633701147),  INT32_C(  1817073371) } },
+    { { -INT32_C(  1798991840), -INT32_C(   575103735),  INT32_C(  1474721288),  INT32_C(   472184187) },
+      {  INT32_C(   445246127), -INT32_C(   957744098), -INT32_C(   865823903),  INT32_C(   226818883) },
+      {  INT32_C(  1195995046), -INT32_C(   786711383), -INT32_C(  1692558234), -INT32_C(  1359004710) },
+      { -INT32_C(  1798969769), -INT32_C(   575126496),  INT32_C(  1474698778),  INT32_C(   472195252) } },
+    { {  INT32_C(  1303312255),  INT32_C(   451001033),  INT32_C(   184123358),  INT32_C(   969960060) },
+      {  INT32_C(   468078249), -INT32_C(  1293813531), -INT32_C(  1219264279), -INT32_C(  2039579646) },
+      { -INT32_C(   539620846), -INT32_C(   998890406),  INT32_C(  1583231717), -INT32_C(   715298888) },
+      {  INT32_C(  1303305526),  INT32_C(   451046441),  INT32_C(   184148471),  INT32_C(   969977156) } },
+    { {  INT32_C(   231752208),  INT32_C(   131738331),  INT32_C(  1543543097),  INT32_C(   916834886) },
+      {  INT32_C(   289508438),  INT32_C(  1882196609), -INT32_C(   138396664), -INT32_C(  1814927786) },
+      { -INT32_C(  1968760005), -INT32_C(  1465962215), -INT32_C(  2078086293), -INT32_C(  2095239347) },
+      {  INT32_C(   231753271),  INT32_C(   131727534),  INT32_C(  1543518593),  INT32_C(   916834017) } },
+    { {  INT32_C(   927177873),  INT32_C(  1479947965),  INT32_C(  1493284428),  INT32_C(   250214107) },
+      { -INT32_C(   412285685), -INT32_C(   677083656),  INT32_C(  1818755104),  INT32_C(   648657956) },
+      {  INT32_C(  1024063693),  INT32_C(  1070642505), -INT32_C(   357987093), -INT32_C(  1252684665) },
+      {  INT32_C(   927192344),  INT32_C(  1479961767),  INT32_C(  1493272332),  INT32_C(   250199458) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_dpbusd_epi32(src, a, b);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_dpbusd_avx_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(  1909016608),  INT32_C(   258855105), -INT32_C(  1787177767),  INT32_C(   180341798) },
+      { -INT32_C(  1519393256),  INT32_C(   910725594), -INT32_C(   507094484), -INT32_C(  2127226932) },
+      {  INT32_C(  1330714495),  INT32_C(  1525486969), -INT32_C(  1355032022),  INT32_C(  1804892242) },
+      { -INT32_C(  1908986244),  INT32_C(   258888020), -INT32_C(  1787185882),  INT32_C(   180369365) } },
+    { { -INT32_C(  1350620746),  INT32_C(  1176250892), -INT32_C(  2014908014), -INT32_C(  1042229844) },
+      { -INT32_C(  1325330522),  INT32_C(  1615365076), -INT32_C(  1511496688),  INT32_C(   535567386) },
+      { -INT32_C(   960260592),  INT32_C(   547084527), -INT32_C(  1392433700),  INT32_C(  1520551952) },
+      { -INT32_C(  1350630007),  INT32_C(  1176237848), -INT32_C(  2014918353), -INT32_C(  1042250626) } },
+    { { -INT32_C(   779298959), -INT32_C(   505544628), -INT32_C(  1848221182), -INT32_C(    26060178) },
+      { -INT32_C(   583839383),  INT32_C(   145485890),  INT32_C(   937872884),  INT32_C(  1284106897) },
+      { -INT32_C(   393482087), -INT32_C(   623802181),  INT32_C(  1825416903),  INT32_C(  1784456696) },
+      { -INT32_C(   779322341), -INT32_C(   505586323), -INT32_C(  1848259330), -INT32_C(    26061972) } },
+    { {  INT32_C(   786021932), -INT32_C(  1514885744), -INT32_C(  1633743404),  INT32_C(  1817089333) },
+      { -INT32_C(   501981684), -INT32_C(  1706808695), -INT32_C(   474940563), -INT32_C(   157184942) },
+      { -INT32_C(  1803904189), -INT32_C(   423241063),  INT32_C(  1515474573),  INT32_C(   199797216) },
+      {  INT32_C(   785991274), -INT32_C(  1514909467), -INT32_C(  1633701147),  INT32_C(  1817073371) } },
+    { { -INT32_C(  1798991840), -INT32_C(   575103735),  INT32_C(  1474721288),  INT32_C(   472184187) },
+      {  INT32_C(   445246127), -INT32_C(   957744098), -INT32_C(   865823903),  INT32_C(   226818883) },
+      {  INT32_C(  1195995046), -INT32_C(   786711383), -INT32_C(  1692558234), -INT32_C(  1359004710) },
+      { -INT32_C(  1798969769), -INT32_C(   575126496),  INT32_C(  1474698778),  INT32_C(   472195252) } },
+    { {  INT32_C(  1303312255),  INT32_C(   451001033),  INT32_C(   184123358),  INT32_C(   969960060) },
+      {  INT32_C(   468078249), -INT32_C(  1293813531), -INT32_C(  1219264279), -INT32_C(  2039579646) },
+      { -INT32_C(   539620846), -INT32_C(   998890406),  INT32_C(  1583231717), -INT32_C(   715298888) },
+      {  INT32_C(  1303305526),  INT32_C(   451046441),  INT32_C(   184148471),  INT32_C(   969977156) } },
+    { {  INT32_C(   231752208),  INT32_C(   131738331),  INT32_C(  1543543097),  INT32_C(   916834886) },
+      {  INT32_C(   289508438),  INT32_C(  1882196609), -INT32_C(   138396664), -INT32_C(  1814927786) },
+      { -INT32_C(  1968760005), -INT32_C(  1465962215), -INT32_C(  2078086293), -INT32_C(  2095239347) },
+      {  INT32_C(   231753271),  INT32_C(   131727534),  INT32_C(  1543518593),  INT32_C(   916834017) } },
+    { {  INT32_C(   927177873),  INT32_C(  1479947965),  INT32_C(  1493284428),  INT32_C(   250214107) },
+      { -INT32_C(   412285685), -INT32_C(   677083656),  INT32_C(  1818755104),  INT32_C(   648657956) },
+      {  INT32_C(  1024063693),  INT32_C(  1070642505), -INT32_C(   357987093), -INT32_C(  1252684665) },
+      {  INT32_C(   927192344),  INT32_C(  1479961767),  INT32_C(  1493272332),  INT32_C(   250199458) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_dpbusd_avx_epi32(src, a, b);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_dpbusd_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C(   586399901), -INT32_C(   980021226), -INT32_C(   436982672), -INT32_C(   949633430) },
+      UINT8_C(  4),
+      {  INT32_C(  2075040222),  INT32_C(  2072555309),  INT32_C(  1177861421), -INT32_C(   982298154) },
+      {  INT32_C(   431288095), -INT32_C(  2143257349), -INT32_C(   430288651),  INT32_C(  1719592227) },
+      {  INT32_C(   586399901), -INT32_C(   980021226), -INT32_C(   436965187), -INT32_C(   949633430) } },
+    { {  INT32_C(   418609509), -INT32_C(   634717714), -INT32_C(  1753189167),  INT32_C(   126771714) },
+      UINT8_C(  6),
+      {  INT32_C(   680510627), -INT32_C(   888161668),  INT32_C(  1835794018), -INT32_C(   299630411) },
+      { -INT32_C(    53383730), -INT32_C(  1792992409),  INT32_C(  1148087864), -INT32_C(  2125109836) },
+      {  INT32_C(   418609509), -INT32_C(   634721146), -INT32_C(  1753136557),  INT32_C(   126771714) } },
+    { { -INT32_C(  1791161055), -INT32_C(  1786786790), -INT32_C(  1019637746), -INT32_C(  1275016308) },
+      UINT8_C(  1),
+      {  INT32_C(  1392225535),  INT32_C(  1090855418), -INT32_C(   542091095), -INT32_C(   312272992) },
+      { -INT32_C(  1566456133), -INT32_C(  1598189373), -INT32_C(   541422245),  INT32_C(   799600532) },
+      { -INT32_C(  1791220179), -INT32_C(  1786786790), -INT32_C(  1019637746), -INT32_C(  1275016308) } },
+    { {  INT32_C(  1519368377),  INT32_C(   764547616),  INT32_C(  1882861279), -INT32_C(    40960564) },
+      UINT8_C(  5),
+      {  INT32_C(   395378078), -INT32_C(   770147097),  INT32_C(   927020397),  INT32_C(   160471341) },
+      { -INT32_C(  1792598693),  INT32_C(  2059643404), -INT32_C(  1642950696),  INT32_C(   965623501) },
+      {  INT32_C(  1519393247),  INT32_C(   764547616),  INT32_C(  1882846710), -INT32_C(    40960564) } },
+    { {  INT32_C(   103070200), -INT32_C(   121547848),  INT32_C(   394674407), -INT32_C(   932182277) },
+      UINT8_C(  6),
+      {  INT32_C(  1071578620),  INT32_C(  2041331395),  INT32_C(  2072297221),  INT32_C(   138454275) },
+      { -INT32_C(  1498738395), -INT32_C(  1852118217),  INT32_C(  1780925872),  INT32_C(  1367928758) },
+      {  INT32_C(   103070200), -INT32_C(   121569400),  INT32_C(   394680792), -INT32_C(   932182277) } },
+    { { -INT32_C(  1437533333),  INT32_C(  1152383649), -INT32_C(  1359110132),  INT32_C(   915224921) },
+      UINT8_C(  6),
+      { -INT32_C(  1376900927),  INT32_C(   767850518), -INT32_C(   663606543), -INT32_C(   953424737) },
+      { -INT32_C(   134866824),  INT32_C(  1301317548), -INT32_C(   225724787),  INT32_C(  1334455939) },
+      { -INT32_C(  1437533333),  INT32_C(  1152348794), -INT32_C(  1359157317),  INT32_C(   915224921) } },
+    { { -INT32_C(   789064654), -INT32_C(  1688518317),  INT32_C(   138061188), -INT32_C(  1685809784) },
+      UINT8_C( 13),
+      { -INT32_C(  1569845738), -INT32_C(  1252850351), -INT32_C(   378335244),  INT32_C(  2011711562) },
+      { -INT32_C(  1605188855), -INT32_C(  1637434569), -INT32_C(  1308181737),  INT32_C(  1186712217) },
+      { -INT32_C(   789071842), -INT32_C(  1688518317),  INT32_C(   138048281), -INT32_C(  1685828972) } },
+    { { -INT32_C(   452333333),  INT32_C(  1388680300),  INT32_C(  1033152470),  INT32_C(  1314931331) },
+      UINT8_C( 10),
+      {  INT32_C(    57494871), -INT32_C(  2030883493), -INT32_C(  1081066845),  INT32_C(  1575617652) },
+      {  INT32_C(   807826135), -INT32_C(   955186810), -INT32_C(  1962834372), -INT32_C(  2104115108) },
+      { -INT32_C(   452333333),  INT32_C(  1388665736),  INT32_C(  1033152470),  INT32_C(  1314904991) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_mask_dpbusd_epi32(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_dpbusd_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t src[4];
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { UINT8_C(  9),
+      {  INT32_C(    40809356), -INT32_C(   921324974),  INT32_C(  1414048692),  INT32_C(  1485386218) },
+      { -INT32_C(   367329929),  INT32_C(  1812633869), -INT32_C(   797788232), -INT32_C(  1336641393) },
+      { -INT32_C(  1094585193), -INT32_C(  1898061099), -INT32_C(  1824717497),  INT32_C(  1264047726) },
+      {  INT32_C(    40776743),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1485417416) } },
+    { UINT8_C(  1),
+      { -INT32_C(  1216358314), -INT32_C(  1775631794), -INT32_C(  1417668929),  INT32_C(  1140351058) },
+      {  INT32_C(  1269603802), -INT32_C(  1701475663),  INT32_C(  1703025861), -INT32_C(    49438579) },
+      {  INT32_C(   283623502), -INT32_C(   949634526), -INT32_C(   706025000),  INT32_C(  1173158322) },
+      { -INT32_C(  1216354458),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C( 14),
+      {  INT32_C(  2072919046), -INT32_C(   816903833),  INT32_C(   287116272),  INT32_C(  2010782887) },
+      {  INT32_C(  1701147001), -INT32_C(   653173925), -INT32_C(   793558062),  INT32_C(   727135021) },
+      { -INT32_C(   124960882),  INT32_C(  1924244695), -INT32_C(  1675486660), -INT32_C(  1637854531) },
+      {  INT32_C(           0), -INT32_C(   816892541),  INT32_C(   287115900),  INT32_C(  2010788192) } },
+    { UINT8_C(  9),
+      { -INT32_C(  1580428876),  INT32_C(   637719002),  INT32_C(   561354264),  INT32_C(   272417563) },
+      {  INT32_C(  1000872482),  INT32_C(  1607779175), -INT32_C(  1101631359), -INT32_C(  1721377095) },
+      {  INT32_C(   689647008), -INT32_C(   252229343),  INT32_C(  2020013407),  INT32_C(   796726724) },
+      { -INT32_C(  1580424015),  INT32_C(           0),  INT32_C(           0),  INT32_C(   272430941) } },
+    { UINT8_C(  0),
+      {  INT32_C(  1808439178),  INT32_C(  2049449643), -INT32_C(   739369454),  INT32_C(   675564580) },
+      { -INT32_C(    38866665), -INT32_C(  2057450998),  INT32_C(  2006088254), -INT32_C(   325381353) },
+      {  INT32_C(   332723098),  INT32_C(   919947567),  INT32_C(  1317132908),  INT32_C(  1049861202) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C( 10),
+      { -INT32_C(  2096777019),  INT32_C(  1588142572), -INT32_C(   538563564),  INT32_C(   768252344) },
+      { -INT32_C(   566872913),  INT32_C(  1112702149), -INT32_C(  1755990468), -INT32_C(  1169546648) },
+      {  INT32_C(  1270754519),  INT32_C(  1724060445), -INT32_C(  1405037082), -INT32_C(   536950983) },
+      {  INT32_C(           0),  INT32_C(  1588152371),  INT32_C(           0),  INT32_C(   768250048) } },
+    { UINT8_C(  2),
+      {  INT32_C(  2104319829),  INT32_C(  1749704879), -INT32_C(   898474924), -INT32_C(  1628192011) },
+      { -INT32_C(   805135374), -INT32_C(   580816025), -INT32_C(   937919430),  INT32_C(   664729383) },
+      {  INT32_C(   183751784),  INT32_C(  1236009592),  INT32_C(  1838873441), -INT32_C(   737500831) },
+      {  INT32_C(           0),  INT32_C(  1749725454),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C( 12),
+      {  INT32_C(  1661858513),  INT32_C(   887999161),  INT32_C(   342798264), -INT32_C(  1057810028) },
+      { -INT32_C(   144861096),  INT32_C(    77329928), -INT32_C(  1015154052),  INT32_C(   452417984) },
+      {  INT32_C(  1525101990),  INT32_C(  1360724364),  INT32_C(  1043741313), -INT32_C(  1638867534) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(   342815856), -INT32_C(  1057810907) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_maskz_dpbusd_epi32(test_vec[i].k, src, a, b);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_dpbusd_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const int32_t a[8];
+    const int32_t b[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { { -INT32_C(    56668415),  INT32_C(  1837118671),  INT32_C(  1576819859), -INT32_C(  1539521673), -INT32_C(  1097353081),  INT32_C(   871785159), -INT32_C(  1859844351),  INT32_C(   338053156) },
+      {  INT32_C(  1813281366),  INT32_C(   518877138), -INT32_C(   693418092),  INT32_C(  1957766403),  INT32_C(  1758012302), -INT32_C(  1574791196), -INT32_C(  1115263799), -INT32_C(  1841670594) },
+      { -INT32_C(  1187829856), -INT32_C(   100650906),  INT32_C(  1032866521), -INT32_C(  1308557443),  INT32_C(   591094549),  INT32_C(  1054444781),  INT32_C(   322130830), -INT32_C(  1072024437) },
+      { -INT32_C(    56678561),  INT32_C(  1837145239),  INT32_C(  1576813243), -INT32_C(  1539530383), -INT32_C(  1097331135),  INT32_C(   871772029), -INT32_C(  1859847876),  INT32_C(   338042538) } },
+    { {  INT32_C(   282278278), -INT32_C(  1807694926), -INT32_C(  1117655827),  INT32_C(    14761904),  INT32_C(  2114353234), -INT32_C(    58839548),  INT32_C(  1030996127), -INT32_C(   690796245) },
+      { -INT32_C(  2083641187), -INT32_C(  1100449736), -INT32_C(  1241775887), -INT32_C(  1122406478),  INT32_C(   157259844), -INT32_C(  1663615623),  INT32_C(  1106953487), -INT32_C(    64556199) },
+      { -INT32_C(  1809042382),  INT32_C(  1661463723), -INT32_C(   712597209),  INT32_C(   268369372), -INT32_C(  1480941289), -INT32_C(   207962130), -INT32_C(   685543466), -INT32_C(  1947721702) },
+      {  INT32_C(   282283124), -INT32_C(  1807682548), -INT32_C(  1117684955),  INT32_C(    14757948),  INT32_C(  2114332907), -INT32_C(    58869649),  INT32_C(  1031023449), -INT32_C(   690816551) } },
+    { {  INT32_C(  1106827095), -INT32_C(  1860873949), -INT32_C(    18354058), -INT32_C(   435494099), -INT32_C(   224292671),  INT32_C(    19525865), -INT32_C(   885685535),  INT32_C(   830036378) },
+      { -INT32_C(   651882115),  INT32_C(  1426669474),  INT32_C(   604172057), -INT32_C(   180506596), -INT32_C(  1879944672), -INT32_C(  1379769778), -INT32_C(   477077902),  INT32_C(   955585526) },
+      { -INT32_C(    97458915), -INT32_C(  1742465877), -INT32_C(   230402319),  INT32_C(   427849435),  INT32_C(  1339074829), -INT32_C(   384072967), -INT32_C(  1063315048),  INT32_C(   181901041) },
+      {  INT32_C(  1106830735), -INT32_C(  1860894975), -INT32_C(    18334247), -INT32_C(   435476050), -INT32_C(   224299708),  INT32_C(    19514230), -INT32_C(   885723537),  INT32_C(   830021189) } },
+    { { -INT32_C(  1273752976), -INT32_C(  2105626283),  INT32_C(  2001689965),  INT32_C(    58000191), -INT32_C(   348415325), -INT32_C(  1116892672),  INT32_C(  1033517096),  INT32_C(   381244283) },
+      {  INT32_C(  1272590882),  INT32_C(   191703865),  INT32_C(   505294587), -INT32_C(   100004254), -INT32_C(   188933279),  INT32_C(  1653852897),  INT32_C(  1293769724), -INT32_C(  2048869103) },
+      {  INT32_C(   343599092), -INT32_C(  1651985982),  INT32_C(  1195333116), -INT32_C(   975120117), -INT32_C(  1489117162),  INT32_C(    30320604),  INT32_C(   981853893), -INT32_C(  1806285206) },
+      { -INT32_C(  1273726538), -INT32_C(  2105647383),  INT32_C(  2001696891),  INT32_C(    57985653), -INT32_C(   348424242), -INT32_C(  1116926002),  INT32_C(  1033500761),  INT32_C(   381264215) } },
+    { { -INT32_C(   761574601), -INT32_C(  1099119757),  INT32_C(  2058872465), -INT32_C(     6508576),  INT32_C(   285030820),  INT32_C(  1995137440), -INT32_C(  1895230010), -INT32_C(  2031676430) },
+      {  INT32_C(   353575358), -INT32_C(  1384168147), -INT32_C(    20082684),  INT32_C(   712157045), -INT32_C(   268109856), -INT32_C(   615292129),  INT32_C(   472420854),  INT32_C(   894657022) },
+      { -INT32_C(   313561144),  INT32_C(  1891194268), -INT32_C(  2123400830), -INT32_C(   547513820), -INT32_C(  1200879528), -INT32_C(  1645714809), -INT32_C(  1853594592),  INT32_C(  1535175118) },
+      { -INT32_C(   761580476), -INT32_C(  1099108033),  INT32_C(  2058879882), -INT32_C(     6512182),  INT32_C(   285035660),  INT32_C(  1995119718), -INT32_C(  1895215706), -INT32_C(  2031697162) } },
+    { {  INT32_C(   105809193), -INT32_C(  1741284226),  INT32_C(  1653076171), -INT32_C(   525734808), -INT32_C(  1342158181), -INT32_C(   810005305),  INT32_C(   289874862), -INT32_C(  1146998027) },
+      {  INT32_C(  1973947035),  INT32_C(  1816705289), -INT32_C(  1683823218), -INT32_C(   808000634),  INT32_C(   178882058),  INT32_C(  1345487766), -INT32_C(  1800979530),  INT32_C(   149549747) },
+      { -INT32_C(  1159343078), -INT32_C(  1085456573), -INT32_C(  1568068150),  INT32_C(  1131881297), -INT32_C(   532380385),  INT32_C(  1920392057), -INT32_C(  1700277634),  INT32_C(  2060308621) },
+      {  INT32_C(   105800057), -INT32_C(  1741273444),  INT32_C(  1653044960), -INT32_C(   525676674), -INT32_C(  1342163181), -INT32_C(   809976982),  INT32_C(   289865121), -INT32_C(  1147041135) } },
+    { { -INT32_C(  1328173538), -INT32_C(   692240627), -INT32_C(   506686627),  INT32_C(  1991757326),  INT32_C(   494497170), -INT32_C(   326272225), -INT32_C(   166274697),  INT32_C(  1608819525) },
+      {  INT32_C(  1739366272), -INT32_C(   763488127),  INT32_C(   992083623),  INT32_C(  1931695883), -INT32_C(  1667261707), -INT32_C(   735385297), -INT32_C(   618063561),  INT32_C(  1793924084) },
+      { -INT32_C(   922002502), -INT32_C(   753175060), -INT32_C(  1239246954), -INT32_C(  1326979383), -INT32_C(  1484946813),  INT32_C(  1206280734), -INT32_C(   882030799),  INT32_C(    30074246) },
+      { -INT32_C(  1328171802), -INT32_C(   692246447), -INT32_C(   506734243),  INT32_C(  1991744384),  INT32_C(   494453132), -INT32_C(   326234021), -INT32_C(   166277365),  INT32_C(  1608776336) } },
+    { { -INT32_C(  1200697404),  INT32_C(  2024134905),  INT32_C(  1361405370), -INT32_C(  2127832923),  INT32_C(   948297306),  INT32_C(  1600858582),  INT32_C(   721399429),  INT32_C(  1196500920) },
+      { -INT32_C(  1392820941),  INT32_C(  1107296449), -INT32_C(  1266455070), -INT32_C(  1311880495),  INT32_C(  1959474584),  INT32_C(  1727515230),  INT32_C(  1489857480), -INT32_C(   469630874) },
+      {  INT32_C(  1184321915), -INT32_C(   621971022),  INT32_C(  1954807025), -INT32_C(   833605000), -INT32_C(  1646232329),  INT32_C(   147550170),  INT32_C(   814080126), -INT32_C(  1735014384) },
+      { -INT32_C(  1200700505),  INT32_C(  2024117343),  INT32_C(  1361406049), -INT32_C(  2127796513),  INT32_C(   948284530),  INT32_C(  1600865157),  INT32_C(   721400214),  INT32_C(  1196478626) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i r = simde_mm256_dpbusd_epi32(src, a, b);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_dpbusd_avx_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const int32_t a[8];
+    const int32_t b[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { { -INT32_C(    56668415),  INT32_C(  1837118671),  INT32_C(  1576819859), -INT32_C(  1539521673), -INT32_C(  1097353081),  INT32_C(   871785159), -INT32_C(  1859844351),  INT32_C(   338053156) },
+      {  INT32_C(  1813281366),  INT32_C(   518877138), -INT32_C(   693418092),  INT32_C(  1957766403),  INT32_C(  1758012302), -INT32_C(  1574791196), -INT32_C(  1115263799), -INT32_C(  1841670594) },
+      { -INT32_C(  1187829856), -INT32_C(   100650906),  INT32_C(  1032866521), -INT32_C(  1308557443),  INT32_C(   591094549),  INT32_C(  1054444781),  INT32_C(   322130830), -INT32_C(  1072024437) },
+      { -INT32_C(    56678561),  INT32_C(  1837145239),  INT32_C(  1576813243), -INT32_C(  1539530383), -INT32_C(  1097331135),  INT32_C(   871772029), -INT32_C(  1859847876),  INT32_C(   338042538) } },
+    { {  INT32_C(   282278278), -INT32_C(  1807694926), -INT32_C(  1117655827),  INT32_C(    14761904),  INT32_C(  2114353234), -INT32_C(    58839548),  INT32_C(  1030996127), -INT32_C(   690796245) },
+      { -INT32_C(  2083641187), -INT32_C(  1100449736), -INT32_C(  1241775887), -INT32_C(  1122406478),  INT32_C(   157259844), -INT32_C(  1663615623),  INT32_C(  1106953487), -INT32_C(    64556199) },
+      { -INT32_C(  1809042382),  INT32_C(  1661463723), -INT32_C(   712597209),  INT32_C(   268369372), -INT32_C(  1480941289), -INT32_C(   207962130), -INT32_C(   685543466), -INT32_C(  1947721702) },
+      {  INT32_C(   282283124), -INT32_C(  1807682548), -INT32_C(  1117684955),  INT32_C(    14757948),  INT32_C(  2114332907), -INT32_C(    58869649),  INT32_C(  1031023449), -INT32_C(   690816551) } },
+    { {  INT32_C(  1106827095), -INT32_C(  1860873949), -INT32_C(    18354058), -INT32_C(   435494099), -INT32_C(   224292671),  INT32_C(    19525865), -INT32_C(   885685535),  INT32_C(   830036378) },
+      { -INT32_C(   651882115),  INT32_C(  1426669474),  INT32_C(   604172057), -INT32_C(   180506596), -INT32_C(  1879944672), -INT32_C(  1379769778), -INT32_C(   477077902),  INT32_C(   955585526) },
+      { -INT32_C(    97458915), -INT32_C(  1742465877), -INT32_C(   230402319),  INT32_C(   427849435),  INT32_C(  1339074829), -INT32_C(   384072967), -INT32_C(  1063315048),  INT32_C(   181901041) },
+      {  INT32_C(  1106830735), -INT32_C(  1860894975), -INT32_C(    18334247), -INT32_C(   435476050), -INT32_C(   224299708),  INT32_C(    19514230), -INT32_C(   885723537),  INT32_C(   830021189) } },
+    { { -INT32_C(  1273752976), -INT32_C(  2105626283),  INT32_C(  2001689965),  INT32_C(    58000191), -INT32_C(   348415325), -INT32_C(  1116892672),  INT32_C(  1033517096),  INT32_C(   381244283) },
+      {  INT32_C(  1272590882),  INT32_C(   191703865),  INT32_C(   505294587), -INT32_C(   100004254), -INT32_C(   188933279),  INT32_C(  1653852897),  INT32_C(  1293769724), -INT32_C(  2048869103) },
+      {  INT32_C(   343599092), -INT32_C(  1651985982),  INT32_C(  1195333116), -INT32_C(   975120117), -INT32_C(  1489117162),  INT32_C(    30320604),  INT32_C(   981853893), -INT32_C(  1806285206) },
+      { -INT32_C(  1273726538), -INT32_C(  2105647383),  INT32_C(  2001696891),  INT32_C(    57985653), -INT32_C(   348424242), -INT32_C(  1116926002),  INT32_C(  1033500761),  INT32_C(   381264215) } },
+    { { -INT32_C(   761574601), -INT32_C(  1099119757),  INT32_C(  2058872465), -INT32_C(     6508576),  INT32_C(   285030820),  INT32_C(  1995137440), -INT32_C(  1895230010), -INT32_C(  2031676430) },
+      {  INT32_C(   353575358), -INT32_C(  1384168147), -INT32_C(    20082684),  INT32_C(   712157045), -INT32_C(   268109856), -INT32_C(   615292129),  INT32_C(   472420854),  INT32_C(   894657022) },
+      { -INT32_C(   313561144),  INT32_C(  1891194268), -INT32_C(  2123400830), -INT32_C(   547513820), -INT32_C(  1200879528), -INT32_C(  1645714809), -INT32_C(  1853594592),  INT32_C(  1535175118) },
+      { -INT32_C(   761580476), -INT32_C(  1099108033),  INT32_C(  2058879882), -INT32_C(     6512182),  INT32_C(   285035660),  INT32_C(  1995119718), -INT32_C(  1895215706), -INT32_C(  2031697162) } },
+    { {  INT32_C(   105809193), -INT32_C(  1741284226),  INT32_C(  1653076171), -INT32_C(   525734808), -INT32_C(  1342158181), -INT32_C(   810005305),  INT32_C(   289874862), -INT32_C(  1146998027) },
+      {  INT32_C(  1973947035),  INT32_C(  1816705289), -INT32_C(  1683823218), -INT32_C(   808000634),  INT32_C(   178882058),  INT32_C(  1345487766), -INT32_C(  1800979530),  INT32_C(   149549747) },
+      { -INT32_C(  1159343078), -INT32_C(  1085456573), -INT32_C(  1568068150),  INT32_C(  1131881297), -INT32_C(   532380385),  INT32_C(  1920392057), -INT32_C(  1700277634),  INT32_C(  2060308621) },
+      {  INT32_C(   105800057), -INT32_C(  1741273444),  INT32_C(  1653044960), -INT32_C(   525676674), -INT32_C(  1342163181), -INT32_C(   809976982),  INT32_C(   289865121), -INT32_C(  1147041135) } },
+    { { -INT32_C(  1328173538), -INT32_C(   692240627), -INT32_C(   506686627),  INT32_C(  1991757326),  INT32_C(   494497170), -INT32_C(   326272225), -INT32_C(   166274697),  INT32_C(  1608819525) },
+      {  INT32_C(  1739366272), -INT32_C(   763488127),  INT32_C(   992083623),  INT32_C(  1931695883), -INT32_C(  1667261707), -INT32_C(   735385297), -INT32_C(   618063561),  INT32_C(  1793924084) },
+      { -INT32_C(   922002502), -INT32_C(   753175060), -INT32_C(  1239246954), -INT32_C(  1326979383), -INT32_C(  1484946813),  INT32_C(  1206280734), -INT32_C(   882030799),  INT32_C(    30074246) },
+      { -INT32_C(  1328171802), -INT32_C(   692246447), -INT32_C(   506734243),  INT32_C(  1991744384),  INT32_C(   494453132), -INT32_C(   326234021), -INT32_C(   166277365),  INT32_C(  1608776336) } },
+    { { -INT32_C(  1200697404),  INT32_C(  2024134905),  INT32_C(  1361405370), -INT32_C(  2127832923),  INT32_C(   948297306),  INT32_C(  1600858582),  INT32_C(   721399429),  INT32_C(  1196500920) },
+      { -INT32_C(  1392820941),  INT32_C(  1107296449), -INT32_C(  1266455070), -INT32_C(  1311880495),  INT32_C(  1959474584),  INT32_C(  1727515230),  INT32_C(  1489857480), -INT32_C(   469630874) },
+      {  INT32_C(  1184321915), -INT32_C(   621971022),  INT32_C(  1954807025), -INT32_C(   833605000), -INT32_C(  1646232329),  INT32_C(   147550170),  INT32_C(   814080126), -INT32_C(  1735014384) },
+      { -INT32_C(  1200700505),  INT32_C(  2024117343),  INT32_C(  1361406049), -INT32_C(  2127796513),  INT32_C(   948284530),  INT32_C(  1600865157),  INT32_C(   721400214),  INT32_C(  1196478626) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i r = simde_mm256_dpbusd_avx_epi32(src, a, b);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_dpbusd_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t b[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { { -INT32_C(   126983437),  INT32_C(  2067110053),  INT32_C(  1474051827), -INT32_C(  1991515463),  INT32_C(  1122181058), -INT32_C(   355357600),  INT32_C(   391346969),  INT32_C(   933148995) },
+      UINT8_C( 71),
+      { -INT32_C(  1021870176), -INT32_C(   315107310),  INT32_C(  1521188248),  INT32_C(  1122336174),  INT32_C(  1449693660),  INT32_C(  1561590796), -INT32_C(   142156965),  INT32_C(   440040512) },
+      { -INT32_C(   576809006), -INT32_C(  1243467666), -INT32_C(  1498700752),  INT32_C(  1700890323), -INT32_C(   259013923),  INT32_C(   342130967),  INT32_C(   306888164),  INT32_C(   701527552) },
+      { -INT32_C(   127013211),  INT32_C(  2067102976),  INT32_C(  1474024988), -INT32_C(  1991515463),  INT32_C(  1122181058), -INT32_C(   355357600),  INT32_C(   391344110),  INT32_C(   933148995) } },
+    { {  INT32_C(  2018922643),  INT32_C(    98444838),  INT32_C(   530379621),  INT32_C(   292285129), -INT32_C(    93972271),  INT32_C(  1993572509),  INT32_C(  2079740014),  INT32_C(  1745253571) },
+      UINT8_C(186),
+      {  INT32_C(  1426685988), -INT32_C(   239051037), -INT32_C(  2125595598), -INT32_C(  1716203612), -INT32_C(   604078470),  INT32_C(  2013799496),  INT32_C(   887201288), -INT32_C(   261449764) },
+      { -INT32_C(  1081685709), -INT32_C(   496829476),  INT32_C(   548642491), -INT32_C(  1418208644),  INT32_C(   241872334), -INT32_C(   496729210),  INT32_C(   238813939), -INT32_C(   780105246) },
+      {  INT32_C(  2018922643),  INT32_C(    98447782),  INT32_C(   530379621),  INT32_C(   292306014), -INT32_C(    93958839),  INT32_C(  1993556425),  INT32_C(  2079740014),  INT32_C(  1745204154) } },
+    { {  INT32_C(  1221315221), -INT32_C(   869893626), -INT32_C(   235793677), -INT32_C(  1351498668),  INT32_C(  1356571752), -INT32_C(  1642949216),  INT32_C(  1714848595), -INT32_C(   678664166) },
+      UINT8_C(113),
+      { -INT32_C(  1982020710), -INT32_C(   845937660), -INT32_C(  1958527542), -INT32_C(   656456284),  INT32_C(  2088395405), -INT32_C(   116425288),  INT32_C(   207533442),  INT32_C(  1023099878) },
+      { -INT32_C(   681071606),  INT32_C(  1889122864), -INT32_C(  2114689980), -INT32_C(  2029002198),  INT32_C(  1811467728), -INT32_C(  1114742607), -INT32_C(  1183375440),  INT32_C(  1394586204) },
+      {  INT32_C(  1221317424), -INT32_C(   869893626), -INT32_C(   235793677), -INT32_C(  1351498668),  INT32_C(  1356572278), -INT32_C(  1642970145),  INT32_C(  1714854140), -INT32_C(   678664166) } },
+    { { -INT32_C(  1630168482), -INT32_C(  1339928955), -INT32_C(  1136233315), -INT32_C(  1492403503), -INT32_C(  1771662444),  INT32_C(  1060359893),  INT32_C(  1521057077),  INT32_C(  1563548286) },
+      UINT8_C( 32),
+      { -INT32_C(   967137828),  INT32_C(  2081693323), -INT32_C(  1720773170),  INT32_C(   384556578), -INT32_C(  1379771314), -INT32_C(   230289402), -INT32_C(  1570972861), -INT32_C(   660099375) },
+      {  INT32_C(  1180235075),  INT32_C(   473054836),  INT32_C(  1650630578),  INT32_C(  1161511908), -INT32_C(  2044149997),  INT32_C(  2014077679), -INT32_C(  1310457838), -INT32_C(  1450289624) },
+      { -INT32_C(  1630168482), -INT32_C(  1339928955), -INT32_C(  1136233315), -INT32_C(  1492403503), -INT32_C(  1771662444),  INT32_C(  1060391239),  INT32_C(  1521057077),  INT32_C(  1563548286) } },
+    { {  INT32_C(  1690134847), -INT32_C(   742876690),  INT32_C(  1593528212), -INT32_C(  1373989916),  INT32_C(   573198003), -INT32_C(  1904868282),  INT32_C(  1263214455), -INT32_C(  1270346011) },
+      UINT8_C(254),
+      {  INT32_C(  1094265332),  INT32_C(   943242605), -INT32_C(  1453233766), -INT32_C(   844625852),  INT32_C(   775993750),  INT32_C(   414127536),  INT32_C(  1003010542),  INT32_C(  1150015203) },
+      {  INT32_C(   193916223),  INT32_C(  1675378413),  INT32_C(  1396136233), -INT32_C(   371661051), -INT32_C(  1616588828), -INT32_C(  1566977484), -INT32_C(   554344679),  INT32_C(  2145319179) },
+      {  INT32_C(  1690134847), -INT32_C(   742863515),  INT32_C(  1593563233), -INT32_C(  1374001211),  INT32_C(   573174388), -INT32_C(  1904880377),  INT32_C(  1263233774), -INT32_C(  1270341102) } },
+    { {  INT32_C(   823084387),  INT32_C(   887576435),  INT32_C(  1339049558),  INT32_C(  1249698591),  INT32_C(   950221698), -INT32_C(  1199672768),  INT32_C(  1805910657), -INT32_C(  1641650483) },
+      UINT8_C( 45),
+      {  INT32_C(  1555808945),  INT32_C(  1563889548),  INT32_C(   539887269),  INT32_C(  1901686154), -INT32_C(  1937245989), -INT32_C(   277660801),  INT32_C(  1003794916), -INT32_C(   676704609) },
+      { -INT32_C(  1100677740), -INT32_C(   596345689),  INT32_C(  1947900225), -INT32_C(  1020698218), -INT32_C(   164847120),  INT32_C(   154118829), -INT32_C(  1699527371), -INT32_C(   474420427) },
+      {  INT32_C(   823077317),  INT32_C(   887576435),  INT32_C(  1339064573),  INT32_C(  1249691292),  INT32_C(   950221698), -INT32_C(  1199680827),  INT32_C(  1805910657), -INT32_C(  1641650483) } },
+    { {  INT32_C(   726469981),  INT32_C(   186360961), -INT32_C(  1164718863), -INT32_C(   892523741), -INT32_C(  2056017245), -INT32_C(  1340956232),  INT32_C(   351646877),  INT32_C(   188947872) },
+      UINT8_C( 71),
+      { -INT32_C(  1537553125), -INT32_C(  1319959249), -INT32_C(  1208952916),  INT32_C(  1616811502),  INT32_C(  2048269432),  INT32_C(  1055228466),  INT32_C(  1663416938),  INT32_C(   890091699) },
+      { -INT32_C(  1563083806), -INT32_C(  1998496451), -INT32_C(   112636573),  INT32_C(  1462458328),  INT32_C(  1403942063), -INT32_C(   219210905),  INT32_C(  1146011475), -INT32_C(   388514714) },
+      {  INT32_C(   726461980),  INT32_C(   186340480), -INT32_C(  1164669041), -INT32_C(   892523741), -INT32_C(  2056017245), -INT32_C(  1340956232),  INT32_C(   351653203),  INT32_C(   188947872) } },
+    { { -INT32_C(   576843059), -INT32_C(   526148046), -INT32_C(  1923636517), -INT32_C(   645770696),  INT32_C(  1768665660), -INT32_C(   597541169),  INT32_C(   592836309), -INT32_C(   466428629) },
+      UINT8_C( 93),
+      { -INT32_C(  1527417583),  INT32_C(  1675525803), -INT32_C(   791717575), -INT32_C(    47062351),  INT32_C(  1608666712), -INT32_C(  2004991237), -INT32_C(   327899365),  INT32_C(  1559836499) },
+      { -INT32_C(   307724714),  INT32_C(   674255912),  INT32_C(  1894342642), -INT32_C(  1568154004),  INT32_C(  1051014939),  INT32_C(   973530508), -INT32_C(  1556395610),  INT32_C(  1121180284) },
+      { -INT32_C(   576851531), -INT32_C(   526148046), -INT32_C(  1923610325), -INT32_C(   645788975),  INT32_C(  1768657650), -INT32_C(   597541169),  INT32_C(   592830966), -INT32_C(   466428629) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i r = simde_mm256_mask_dpbusd_epi32(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_dpbusd_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t src[8];
+    const int32_t a[8];
+    const int32_t b[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { UINT8_C(199),
+      {  INT32_C(  1166976462), -INT32_C(   585256265), -INT32_C(   765576642), -INT32_C(   729888401),  INT32_C(   395877697),  INT32_C(  1451989149),  INT32_C(   732835918), -INT32_C(   686991065) },
+      {  INT32_C(  1206305571), -INT32_C(   607642947),  INT32_C(  1635626524),  INT32_C(   277986975),  INT32_C(   210612290), -INT32_C(   302213126),  INT32_C(  1293508084),  INT32_C(  1285138673) },
+      { -INT32_C(    16023373),  INT32_C(   468893570), -INT32_C(    99688621),  INT32_C(   534028151), -INT32_C(  2071381167), -INT32_C(  1245830521), -INT32_C(   229108680),  INT32_C(   926752623) },
+      {  INT32_C(  1166951266), -INT32_C(   585278656), -INT32_C(   765578892),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   732852564), -INT32_C(   686945593) } },
+    { UINT8_C( 80),
+      { -INT32_C(   186317900),  INT32_C(  1185668251), -INT32_C(  1318227060),  INT32_C(   415888408),  INT32_C(  2110148658), -INT32_C(   506534585), -INT32_C(  1170674298),  INT32_C(  1943068425) },
+      { -INT32_C(   414376032), -INT32_C(  1423738976), -INT32_C(   514597776), -INT32_C(   693907876), -INT32_C(   445306557), -INT32_C(  1652240458), -INT32_C(  1184144976), -INT32_C(   798861240) },
+      {  INT32_C(   402715034),  INT32_C(   940216780), -INT32_C(  2005924292), -INT32_C(   835528409),  INT32_C(   218590037),  INT32_C(   692319899),  INT32_C(  1188803255),  INT32_C(  1113986590) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  2110162536),  INT32_C(           0), -INT32_C(  1170685721),  INT32_C(           0) } },
+    { UINT8_C( 86),
+      {  INT32_C(   991951904),  INT32_C(  1307315857), -INT32_C(  1840596667),  INT32_C(  2122919237),  INT32_C(   188460086),  INT32_C(   536617629), -INT32_C(   906178759),  INT32_C(   839934992) },
+      {  INT32_C(  1101290040), -INT32_C(   201655547),  INT32_C(   861635166),  INT32_C(  2060259623),  INT32_C(  1857637276),  INT32_C(  1614956080),  INT32_C(  1514676784), -INT32_C(  1450139212) },
+      {  INT32_C(   902461643), -INT32_C(  1038957757),  INT32_C(   835243337),  INT32_C(   369139975), -INT32_C(  2128530552), -INT32_C(  1134244866),  INT32_C(   375652583), -INT32_C(  1588474338) },
+      {  INT32_C(           0),  INT32_C(  1307290315), -INT32_C(  1840599032),  INT32_C(           0),  INT32_C(   188437326),  INT32_C(           0), -INT32_C(   906170779),  INT32_C(           0) } },
+    { UINT8_C( 79),
+      {  INT32_C(  2077939991),  INT32_C(  1237219015),  INT32_C(   418063741),  INT32_C(  1033130506), -INT32_C(   734611079),  INT32_C(  1053638009),  INT32_C(  1659854822), -INT32_C(   615663078) },
+      {  INT32_C(  1065631887), -INT32_C(  1753494397), -INT32_C(   853997626),  INT32_C(    70678602), -INT32_C(  1221514286), -INT32_C(   791676880), -INT32_C(  1300012197), -INT32_C(   457183075) },
+      { -INT32_C(   571571830),  INT32_C(   772419596),  INT32_C(   240689134), -INT32_C(   744222110),  INT32_C(   588875354),  INT32_C(   436254549),  INT32_C(   567187396), -INT32_C(  1145796293) },
+      {  INT32_C(  2077910408),  INT32_C(  1237238555),  INT32_C(   418064568),  INT32_C(  1033134770),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1659838291),  INT32_C(           0) } },
+    { UINT8_C(153),
+      { -INT32_C(   797935000),  INT32_C(  1275884759), -INT32_C(  1270168682), -INT32_C(   344202503), -INT32_C(  1395289048),  INT32_C(  1428934359), -INT32_C(   363954525), -INT32_C(   271423799) },
+      {  INT32_C(  1149473374), -INT32_C(  1386007070), -INT32_C(  1185054718), -INT32_C(   342967394),  INT32_C(  1715617386), -INT32_C(  1545702360), -INT32_C(  1803754110), -INT32_C(   974234941) },
+      { -INT32_C(  1719691557),  INT32_C(   488889978), -INT32_C(  1181089575), -INT32_C(  1304377450), -INT32_C(  1805234547),  INT32_C(   937863527), -INT32_C(  1990336343), -INT32_C(  1930445798) },
+      { -INT32_C(   797944321),  INT32_C(           0),  INT32_C(           0), -INT32_C(   344239152), -INT32_C(  1395300686),  INT32_C(           0),  INT32_C(           0), -INT32_C(   271451747) } },
+    { UINT8_C( 32),
+      { -INT32_C(  1972833298), -INT32_C(   940795547), -INT32_C(   966864422), -INT32_C(   448925461), -INT32_C(   557061534), -INT32_C(  1686918921),  INT32_C(  1748797868), -INT32_C(   914514382) },
+      {  INT32_C(   882210067), -INT32_C(  1695294928),  INT32_C(   394236551), -INT32_C(  1974826173),  INT32_C(  1964316431), -INT32_C(   975684911), -INT32_C(  1622571994),  INT32_C(  1500324838) },
+      { -INT32_C(   454619204),  INT32_C(     1762083), -INT32_C(   896276436), -INT32_C(   722108277), -INT32_C(   298161417), -INT32_C(  1676110515), -INT32_C(  1088442201),  INT32_C(  2059996112) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1686923550),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(  6),
+      {  INT32_C(  1740650074),  INT32_C(  1937337695),  INT32_C(  2092630359), -INT32_C(   928649210), -INT32_C(   130154257),  INT32_C(  1750869759),  INT32_C(   691351498), -INT32_C(  1782569741) },
+      {  INT32_C(    13450617),  INT32_C(   318711202),  INT32_C(   610030648), -INT32_C(  1752518220), -INT32_C(   160000578),  INT32_C(  1290270423), -INT32_C(   312799288),  INT32_C(   757429642) },
+      { -INT32_C(   939365699),  INT32_C(   606494399),  INT32_C(   502147080), -INT32_C(  1298146087),  INT32_C(   871526599), -INT32_C(  2026656097),  INT32_C(   238436438), -INT32_C(   913546224) },
+      {  INT32_C(           0),  INT32_C(  1937340981),  INT32_C(  2092633555),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(  4),
+      { -INT32_C(  1718425188), -INT32_C(  1000186356),  INT32_C(   138048743), -INT32_C(   594074738),  INT32_C(   186996595), -INT32_C(   105746221),  INT32_C(   364426730), -INT32_C(  1041064081) },
+      {  INT32_C(  1986151081), -INT32_C(  1955736020), -INT32_C(   561683974), -INT32_C(  1382797115), -INT32_C(  1377903164), -INT32_C(  1083215970),  INT32_C(  1236068846), -INT32_C(  1824784737) },
+      {  INT32_C(   833280809), -INT32_C(  1489171119), -INT32_C(   326160974), -INT32_C(  1654544161),  INT32_C(   991915396), -INT32_C(   219432811),  INT32_C(  1268401397),  INT32_C(  1585515889) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(   138014139),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i r = simde_mm256_maskz_dpbusd_epi32(test_vec[i].k, src, a, b);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_dpbusd_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const int32_t a[16];
+    const int32_t b[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { { -INT32_C(  1601221198),  INT32_C(  1644986625),  INT32_C(  1440915332), -INT32_C(   733313225),  INT32_C(    27150547),  INT32_C(   170175847), -INT32_C(    46065170), -INT32_C(   545792910),
+         INT32_C(   715461626),  INT32_C(  1796299654), -INT32_C(   926981831),  INT32_C(   151773925),  INT32_C(    14260447), -INT32_C(  1541652936),  INT32_C(  1547062987), -INT32_C(  1845693012) },
+      { -INT32_C(   938281002),  INT32_C(  1462329151), -INT32_C(  1448713543), -INT32_C(  1097518714),  INT32_C(  2014991499), -INT32_C(  1981616206),  INT32_C(  1346001458), -INT32_C(   102713444),
+         INT32_C(  1819066280), -INT32_C(  1232741250),  INT32_C(   304490667), -INT32_C(  1681759166), -INT32_C(   627074948),  INT32_C(  1077688029),  INT32_C(    75426740), -INT32_C(   197367750) },
+      {  INT32_C(  1443150685), -INT32_C(   853288336), -INT32_C(  1087298644), -INT32_C(  1272654398),  INT32_C(   828767993), -INT32_C(  1223821597), -INT32_C(  1626100100), -INT32_C(    41750094),
+         INT32_C(  1404466708), -INT32_C(  1613211987),  INT32_C(  1690434560), -INT32_C(  1626087378),  INT32_C(   611224460),  INT32_C(  2004684172), -INT32_C(    26412743), -INT32_C(  1860340415) },
+      { -INT32_C(  1601201067),  INT32_C(  1644987069),  INT32_C(  1440900371), -INT32_C(   733332716),  INT32_C(    27157912),  INT32_C(   170161232), -INT32_C(    46073008), -INT32_C(   545836794),
+         INT32_C(   715488496),  INT32_C(  1796285142), -INT32_C(   926982585),  INT32_C(   151762412),  INT32_C(    14253617), -INT32_C(  1541662754),  INT32_C(  1547085202), -INT32_C(  1845702418) } },
+    { { -INT32_C(   844302991), -INT32_C(  1140794960),  INT32_C(  1701961885),  INT32_C(  1583616149), -INT32_C(   241912850), -INT32_C(   219810238),  INT32_C(    30938781), -INT32_C(  1859967711),
+         INT32_C(  2025268638),  INT32_C(   943858266), -INT32_C(  1733455250),  INT32_C(  1109544065), -INT32_C(    15243896),  INT32_C(  1098493452), -INT32_C(  2012446417),  INT32_C(   973638497) },
+      {  INT32_C(    72265636),  INT32_C(   354095602),  INT32_C(   462481741), -INT32_C(  1562427631),  INT32_C(   211118381), -INT32_C(  1330530230),  INT32_C(  1967721259),  INT32_C(  1866696379),
+        -INT32_C(    83026113), -INT32_C(   343221288), -INT32_C(   864750622),  INT32_C(  1065173303),  INT32_C(   114023663), -INT32_C(  1795748952), -INT32_C(  1841429307),  INT32_C(   457695911) },
+      {  INT32_C(   395496799),  INT32_C(  1631699117),  INT32_C(  1692861789), -INT32_C(   943049160), -INT32_C(  1694943360), -INT32_C(    18128087),  INT32_C(  1500480683), -INT32_C(  1057525915),
+        -INT32_C(  1286665393), -INT32_C(   101663846), -INT32_C(  1714637436),  INT32_C(   741924762), -INT32_C(   415796754),  INT32_C(  1488554040), -INT32_C(  1754697848), -INT32_C(   191682088) },
+      { -INT32_C(   844304824), -INT32_C(  1140812342),  INT32_C(  1701969311),  INT32_C(  1583599227), -INT32_C(   241915102), -INT32_C(   219793057),  INT32_C(    30952278), -INT32_C(  1859941657),
+         INT32_C(  2025255656),  INT32_C(   943817270), -INT32_C(  1733528543),  INT32_C(  1109546082), -INT32_C(    15212323),  INT32_C(  1098497027), -INT32_C(  2012478433),  INT32_C(   973633020) } },
+    { {  INT32_C(  1791355105), -INT32_C(  1375198104), -INT32_C(  1875332251), -INT32_C(   521961245), -INT32_C(  1933470501),  INT32_C(  1012409009),  INT32_C(   646396868), -INT32_C(  1228338816),
+        -INT32_C(  1950721407), -INT32_C(  1421525528), -INT32_C(   552374822), -INT32_C(  1981261262), -INT32_C(  1855721384),  INT32_C(    19609044),  INT32_C(   541608101), -INT32_C(  1973532068) },
+      {  INT32_C(    69379395),  INT32_C(   269548530),  INT32_C(   385977914),  INT32_C(   471362739),  INT32_C(  1387495490),  INT32_C(  1679186546),  INT32_C(  1513942972),  INT32_C(  1672106062),
+        -INT32_C(   206127259),  INT32_C(   322645438),  INT32_C(  1347166427), -INT32_C(   210801178),  INT32_C(  1062032366), -INT32_C(  2078742715), -INT32_C(  1897149261), -INT32_C(  2061779213) },
+      { -INT32_C(   867432934),  INT32_C(   816960159),  INT32_C(  1850350714), -INT32_C(    94867348), -INT32_C(   219869877),  INT32_C(  1475115685),  INT32_C(   172021061),  INT32_C(  1231007274),
+        -INT32_C(   363536003),  INT32_C(  1780380805), -INT32_C(   372889476), -INT32_C(  1964040710),  INT32_C(  1510669637), -INT32_C(  1411227638),  INT32_C(   539404760),  INT32_C(   673373640) },
+      {  INT32_C(  1791360213), -INT32_C(  1375233620), -INT32_C(  1875318595), -INT32_C(   521927873), -INT32_C(  1933469868),  INT32_C(  1012417875),  INT32_C(   646404303), -INT32_C(  1228318723),
+        -INT32_C(  1950704761), -INT32_C(  1421539894), -INT32_C(   552352634), -INT32_C(  1981290042), -INT32_C(  1855698771),  INT32_C(    19619970),  INT32_C(   541596667), -INT32_C(  1973546088) } },
+    { {  INT32_C(  2037243398), -INT32_C(   682281693),  INT32_C(   669043656), -INT32_C(   608163185),  INT32_C(  1404835372),  INT32_C(   942555321), -INT32_C(   865165402), -INT32_C(  1507920555),
+        -INT32_C(  1867838139), -INT32_C(   518135587),  INT32_C(  1664437754), -INT32_C(  1211706561),  INT32_C(    95998862), -INT32_C(   955154621),  INT32_C(   622676384), -INT32_C(   183653669) },
+      {  INT32_C(  1395864450), -INT32_C(  2047717163), -INT32_C(  1362513826),  INT32_C(  1801040093), -INT32_C(  1517004125), -INT32_C(    94881174),  INT32_C(  1136535693), -INT32_C(   824345337),
+        -INT32_C(  1161965847), -INT32_C(  1525297477),  INT32_C(  1265567168),  INT32_C(  1709989113), -INT32_C(  1404030303), -INT32_C(   977367189), -INT32_C(  1061339668),  INT32_C(  2018522789) },
+      {  INT32_C(  1018012768), -INT32_C(   361712728),  INT32_C(  1490623755),  INT32_C(   643177594),  INT32_C(  1294564756),  INT32_C(   802074985),  INT32_C(  1607501181), -INT32_C(  2076401295),
+        -INT32_C(   324151167), -INT32_C(  1261971289), -INT32_C(   903418603),  INT32_C(   470682859),  INT32_C(   431668676), -INT32_C(   683815233),  INT32_C(   925234280),  INT32_C(   678616355) },
+      {  INT32_C(  2037251933), -INT32_C(   682282419),  INT32_C(   669057267), -INT32_C(   608119575),  INT32_C(  1404847791),  INT32_C(   942569219), -INT32_C(   865155452), -INT32_C(  1507943923),
+        -INT32_C(  1867895377), -INT32_C(   518174207),  INT32_C(  1664441859), -INT32_C(  1211704554),  INT32_C(    95984552), -INT32_C(   955165213),  INT32_C(   622717749), -INT32_C(   183635864) } },
+    { {  INT32_C(   344840304), -INT32_C(  2095460838),  INT32_C(  2030261154), -INT32_C(   401466235), -INT32_C(  1123606705),  INT32_C(   925223506),  INT32_C(  1916673747), -INT32_C(  1348703666),
+        -INT32_C(  1667651002),  INT32_C(  1980678977),  INT32_C(  1286825438),  INT32_C(   131217422), -INT32_C(   908402387),  INT32_C(   243513936),  INT32_C(    88287188), -INT32_C(   636693757) },
+      {  INT32_C(   426358989),  INT32_C(   904843093),  INT32_C(   568647483), -INT32_C(  1666767577), -INT32_C(    91281645),  INT32_C(   582443353),  INT32_C(   324789280),  INT32_C(    24585047),
+         INT32_C(  1313793873),  INT32_C(   623840136),  INT32_C(   252816109), -INT32_C(  1055164655),  INT32_C(   825488978),  INT32_C(   245976839),  INT32_C(   215817672), -INT32_C(   868578384) },
+      { -INT32_C(  1048005763),  INT32_C(  1401088976),  INT32_C(   160603987),  INT32_C(  1746306401),  INT32_C(  1156805526), -INT32_C(  1061063226), -INT32_C(  1600262005),  INT32_C(  1129953449),
+         INT32_C(  1336717639), -INT32_C(  2085854051),  INT32_C(   504549370),  INT32_C(  1732479096),  INT32_C(  2102637275),  INT32_C(  1192090333),  INT32_C(   358035247),  INT32_C(  1839386975) },
+      {  INT32_C(   344837586), -INT32_C(  2095494854),  INT32_C(  2030219637), -INT32_C(   401447105), -INT32_C(  1123589093),  INT32_C(   925215988),  INT32_C(  1916655522), -INT32_C(  1348703097),
+        -INT32_C(  1667663890),  INT32_C(  1980658040),  INT32_C(  1286816442),  INT32_C(   131226870), -INT32_C(   908414251),  INT32_C(   243513880),  INT32_C(    88317430), -INT32_C(   636666786) } },
+    { { -INT32_C(  1532034809),  INT32_C(  1557375219),  INT32_C(  1793313870), -INT32_C(  1709642778), -INT32_C(   229619473), -INT32_C(  1638491381),  INT32_C(  1987708107),  INT32_C(   511597116),
+        -INT32_C(  1405346296), -INT32_C(  1957183775), -INT32_C(   698204646), -INT32_C(   799903083), -INT32_C(  1762664219), -INT32_C(   244369573), -INT32_C(   750178326),  INT32_C(   956768172) },
+      {  INT32_C(   212064961),  INT32_C(  1089036186),  INT32_C(   733509134), -INT32_C(  1276610313), -INT32_C(  2028351400), -INT32_C(   444753872), -INT32_C(  1711506378),  INT32_C(  1854740376),
+         INT32_C(  2069625382),  INT32_C(  1282430155),  INT32_C(  1361039908), -INT32_C(   803707163), -INT32_C(   822124731), -INT32_C(   852390225),  INT32_C(   199673776), -INT32_C(  1759776637) },
+      {  INT32_C(  1826348080),  INT32_C(   535037968),  INT32_C(  1160503539), -INT32_C(  1320739991), -INT32_C(   364201578), -INT32_C(   706464041),  INT32_C(   942046808), -INT32_C(   337897888),
+        -INT32_C(   213537748), -INT32_C(   100132270),  INT32_C(   173850953), -INT32_C(  2069510540),  INT32_C(  1397696259),  INT32_C(  1482572941), -INT32_C(  1988936290),  INT32_C(   670179926) },
+      { -INT32_C(  1532038128),  INT32_C(  1557373903),  INT32_C(  1793320791), -INT32_C(  1709611272), -INT32_C(   229644689), -INT32_C(  1638498488),  INT32_C(  1987746627),  INT32_C(   511604828),
+        -INT32_C(  1405360944), -INT32_C(  1957164505), -INT32_C(   698211586), -INT32_C(   799910411), -INT32_C(  1762623064), -INT32_C(   244357396), -INT32_C(   750158294),  INT32_C(   956793109) } },
+    { { -INT32_C(  1612265036), -INT32_C(   619851180), -INT32_C(  1104504404), -INT32_C(  2101374819), -INT32_C(   844096363),  INT32_C(   338071458), -INT32_C(  1747971002), -INT32_C(  1265939472),
+         INT32_C(  1317793993), -INT32_C(  1627054092), -INT32_C(  2129563684),  INT32_C(   753347520), -INT32_C(  1303641556), -INT32_C(  1959550731), -INT32_C(  1173690888),  INT32_C(  1566286069) },
+      {  INT32_C(  1116168989), -INT32_C(  1313312760), -INT32_C(    88904824), -INT32_C(  2022845291), -INT32_C(   421967468),  INT32_C(  1290127027), -INT32_C(  1982939768),  INT32_C(  1364959782),
+        -INT32_C(  1217166093),  INT32_C(  1675149266),  INT32_C(   351926487),  INT32_C(   722409876), -INT32_C(   422227083), -INT32_C(  1818843895), -INT32_C(   207428616),  INT32_C(   109929420) },
+      {  INT32_C(  1930689150), -INT32_C(  1136504099),  INT32_C(   461941073), -INT32_C(   799652097),  INT32_C(   979775697), -INT32_C(  1020150152), -INT32_C(  1440468884),  INT32_C(   749846151),
+        -INT32_C(  1637551738), -INT32_C(  1630422283),  INT32_C(  1099082101),  INT32_C(   903646543), -INT32_C(  1704528121), -INT32_C(  1471932183), -INT32_C(   628810433),  INT32_C(   575551669) },
+      { -INT32_C(  1612251821), -INT32_C(   619842168), -INT32_C(  1104517427), -INT32_C(  2101357234), -INT32_C(   844064341),  INT32_C(   338086455), -INT32_C(  1747951608), -INT32_C(  1265958387),
+         INT32_C(  1317755933), -INT32_C(  1627089626), -INT32_C(  2129590179),  INT32_C(   753358076), -INT32_C(  1303643218), -INT32_C(  1959549714), -INT32_C(  1173697841),  INT32_C(  1566287515) } },
+    { { -INT32_C(   378418162),  INT32_C(   940871126), -INT32_C(   113949714),  INT32_C(  1341553170), -INT32_C(  1422845645),  INT32_C(  1378769002),  INT32_C(  1504228838), -INT32_C(   757742903),
+         INT32_C(  1213605091), -INT32_C(  2130205166), -INT32_C(  1376604764),  INT32_C(  2145172382),  INT32_C(  1737495189),  INT32_C(   703527769), -INT32_C(   755674347), -INT32_C(  1780077357) },
+      {  INT32_C(   493866518), -INT32_C(  1938014569),  INT32_C(   340583227), -INT32_C(   405653968),  INT32_C(  1762236988), -INT32_C(   666879351), -INT32_C(  1153720683),  INT32_C(  1418274780),
+        -INT32_C(  2138491498), -INT32_C(  1543476487), -INT32_C(  1794769709), -INT32_C(  1623748096), -INT32_C(  1250199104),  INT32_C(  1118898086),  INT32_C(   235968428), -INT32_C(  2021649394) },
+      { -INT32_C(   997621238),  INT32_C(  1337750249), -INT32_C(   784081693), -INT32_C(   446997610), -INT32_C(   359813022), -INT32_C(   832126655), -INT32_C(    99577081),  INT32_C(  1821746933),
+         INT32_C(  1717866962), -INT32_C(    13245934), -INT32_C(   935553630),  INT32_C(  1406179073),  INT32_C(   595602173),  INT32_C(   519901529),  INT32_C(   259390976), -INT32_C(  1231826727) },
+      { -INT32_C(   378458847),  INT32_C(   940877349), -INT32_C(   113955445),  INT32_C(  1341565869), -INT32_C(  1422855430),  INT32_C(  1378769981),  INT32_C(  1504212481), -INT32_C(   757754420),
+         INT32_C(  1213619064), -INT32_C(  2130204028), -INT32_C(  1376659606),  INT32_C(  2145167609),  INT32_C(  1737490286),  INT32_C(   703544111), -INT32_C(   755672567), -INT32_C(  1780102805) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi32(test_vec[i].b);
+    simde__m512i r = simde_mm512_dpbusd_epi32(src, a, b);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_dpbusd_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t b[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { { -INT32_C(   257299213),  INT32_C(    88449223),  INT32_C(  1074559141),  INT32_C(  1363666044),  INT32_C(   302007427), -INT32_C(   863520194),  INT32_C(   156602077), -INT32_C(  1363546921),
+         INT32_C(  1728573117), -INT32_C(   790528187),  INT32_C(   252424865),  INT32_C(  1162063035),  INT32_C(   918514535), -INT32_C(   277403668),  INT32_C(  1482351602), -INT32_C(  1022675528) },
+      UINT16_C(65357),
+      {  INT32_C(  1624705940),  INT32_C(   635586598), -INT32_C(   536711477), -INT32_C(   986743957), -INT32_C(   576710626), -INT32_C(   408780306),  INT32_C(   680751016), -INT32_C(  1282272190),
+        -INT32_C(  1655336892), -INT32_C(   280280114),  INT32_C(   438367738), -INT32_C(   469621658), -INT32_C(   816066427),  INT32_C(   116607880), -INT32_C(   743156172),  INT32_C(  1657602542) },
+      { -INT32_C(   606318482), -INT32_C(  2126699052),  INT32_C(   648102308),  INT32_C(  1127189050), -INT32_C(   351298861),  INT32_C(  1094529438), -INT32_C(   629621911), -INT32_C(   563198737),
+         INT32_C(   774787293),  INT32_C(   454648318), -INT32_C(  1420851507),  INT32_C(  1959524896),  INT32_C(  1528813096),  INT32_C(  1853542155), -INT32_C(   319574518), -INT32_C(  1897584855) },
+      { -INT32_C(   257293345),  INT32_C(    88449223),  INT32_C(  1074555937),  INT32_C(  1363673144),  INT32_C(   302007427), -INT32_C(   863520194),  INT32_C(   156628178), -INT32_C(  1363546921),
+         INT32_C(  1728593389), -INT32_C(   790513772),  INT32_C(   252382543),  INT32_C(  1162092425),  INT32_C(   918532777), -INT32_C(   277375541),  INT32_C(  1482338510), -INT32_C(  1022682438) } },
+    { {  INT32_C(  1415583760), -INT32_C(   911569960), -INT32_C(   540489766),  INT32_C(  2019558998),  INT32_C(   296758384),  INT32_C(  1368704293),  INT32_C(   464453427), -INT32_C(   901473419),
+         INT32_C(  1126527791),  INT32_C(  1112684715), -INT32_C(  1792714360), -INT32_C(  2053463560), -INT32_C(   556574308), -INT32_C(  1856944817), -INT32_C(  1457974370), -INT32_C(   830671926) },
+      UINT16_C(45491),
+      {  INT32_C(   257666189), -INT32_C(   543261991), -INT32_C(   790557794), -INT32_C(  1371131727), -INT32_C(  1816625947), -INT32_C(   688315500), -INT32_C(  1886385461),  INT32_C(  1067873358),
+        -INT32_C(   985060507),  INT32_C(   162197980), -INT32_C(   207436981),  INT32_C(  1087574500), -INT32_C(  1322436624), -INT32_C(  1241344582), -INT32_C(  2117043003),  INT32_C(   389244916) },
+      { -INT32_C(   153897243), -INT32_C(   798568579),  INT32_C(   563217661), -INT32_C(   836621611), -INT32_C(  1642191207), -INT32_C(  2036520669), -INT32_C(  1713601237), -INT32_C(   131291760),
+         INT32_C(  1327601801),  INT32_C(  1235941237),  INT32_C(  1874073311), -INT32_C(   773003471), -INT32_C(  1239640670), -INT32_C(   884005033), -INT32_C(    63792134), -INT32_C(   295804265) },
+      {  INT32_C(  1415562980), -INT32_C(   911543401), -INT32_C(   540489766),  INT32_C(  2019558998),  INT32_C(   296730623),  INT32_C(  1368660149),  INT32_C(   464453427), -INT32_C(   901485911),
+         INT32_C(  1126529272),  INT32_C(  1112684715), -INT32_C(  1792714360), -INT32_C(  2053463560), -INT32_C(   556614591), -INT32_C(  1856932312), -INT32_C(  1457974370), -INT32_C(   830683072) } },
+    { {  INT32_C(  1675670524),  INT32_C(   931700607),  INT32_C(  1086263577),  INT32_C(  1679581790), -INT32_C(  2079524892),  INT32_C(  1202345671),  INT32_C(  1129122133), -INT32_C(   662343335),
+         INT32_C(   558889137), -INT32_C(  1791276673),  INT32_C(  1300368412), -INT32_C(  2122334007), -INT32_C(  2065625638),  INT32_C(  1571217187),  INT32_C(   368877945), -INT32_C(  2008351929) },
+      UINT16_C( 3237),
+      { -INT32_C(  1864651033),  INT32_C(   133701877), -INT32_C(  1977192779), -INT32_C(   847280987),  INT32_C(  1078907340),  INT32_C(  1700379748), -INT32_C(   595832165), -INT32_C(  1631362205),
+         INT32_C(  2037493963),  INT32_C(   161133365),  INT32_C(   675074427),  INT32_C(  1061779400), -INT32_C(   939596479),  INT32_C(  1753594880),  INT32_C(   686923898), -INT32_C(   848747634) },
+      { -INT32_C(   614483392), -INT32_C(  2042336736),  INT32_C(   703109993),  INT32_C(   373445289),  INT32_C(   652052086),  INT32_C(   960575472), -INT32_C(   433659587),  INT32_C(   188322545),
+        -INT32_C(  1899774265),  INT32_C(  2093443891),  INT32_C(   591097794),  INT32_C(   616288433), -INT32_C(  2008012774), -INT32_C(  2101613893), -INT32_C(  1607591735), -INT32_C(   880097467) },
+      {  INT32_C(  1675688605),  INT32_C(   931700607),  INT32_C(  1086276218),  INT32_C(  1679581790), -INT32_C(  2079524892),  INT32_C(  1202365953),  INT32_C(  1129122133), -INT32_C(   662342857),
+         INT32_C(   558889137), -INT32_C(  1791276673),  INT32_C(  1300388925), -INT32_C(  2122358288), -INT32_C(  2065625638),  INT32_C(  1571217187),  INT32_C(   368877945), -INT32_C(  2008351929) } },
+    { { -INT32_C(  1938908359), -INT32_C(  1468918085), -INT32_C(   743553853),  INT32_C(  1995301952), -INT32_C(   196445110),  INT32_C(  1716825949),  INT32_C(  1898571326), -INT32_C(    90862415),
+        -INT32_C(  2133470517),  INT32_C(  1994334525),  INT32_C(   299138606), -INT32_C(   107834061), -INT32_C(   815966814), -INT32_C(   819127398),  INT32_C(   760190582),  INT32_C(  2068545297) },
+      UINT16_C( 3490),
+      { -INT32_C(   303786225),  INT32_C(     2391622),  INT32_C(   863967702), -INT32_C(   921842987), -INT32_C(  1979533412),  INT32_C(   807016699), -INT32_C(   677708840),  INT32_C(  1667232284),
+         INT32_C(  1917356831),  INT32_C(  2134756360),  INT32_C(   861614385),  INT32_C(  1800872301), -INT32_C(  1359406331),  INT32_C(   140254943),  INT32_C(   179506648),  INT32_C(   246904766) },
+      {  INT32_C(    94020018), -INT32_C(    60662651),  INT32_C(  1660914325),  INT32_C(  1617067542),  INT32_C(  1932253222), -INT32_C(  1325546345),  INT32_C(   535452409),  INT32_C(  1965117799),
+        -INT32_C(  2089187647), -INT32_C(  1237574532),  INT32_C(   726125769), -INT32_C(   477058763),  INT32_C(  1419734938), -INT32_C(   807533042),  INT32_C(   414525428),  INT32_C(  1884742550) },
+      { -INT32_C(  1938908359), -INT32_C(  1468911575), -INT32_C(   743553853),  INT32_C(  1995301952), -INT32_C(   196445110),  INT32_C(  1716794236),  INT32_C(  1898571326), -INT32_C(    90825211),
+        -INT32_C(  2133494966),  INT32_C(  1994334525),  INT32_C(   299142017), -INT32_C(   107844002), -INT32_C(   815966814), -INT32_C(   819127398),  INT32_C(   760190582),  INT32_C(  2068545297) } },
+    { { -INT32_C(  1383010513), -INT32_C(  1158185504), -INT32_C(  1210703155),  INT32_C(  1367026114), -INT32_C(   248688895),  INT32_C(   299431898), -INT32_C(  1023173417),  INT32_C(   141751262),
+         INT32_C(  1571582000), -INT32_C(    28170035),  INT32_C(   802179233),  INT32_C(  1745647803), -INT32_C(   983486498),  INT32_C(   865731680), -INT32_C(   322604753), -INT32_C(    45001977) },
+      UINT16_C(18876),
+      {  INT32_C(  1729741850), -INT32_C(   126460195),  INT32_C(    86317867),  INT32_C(  1297026827),  INT32_C(   816426129),  INT32_C(  1539636698),  INT32_C(  2022777115),  INT32_C(  1193016326),
+         INT32_C(   596145361), -INT32_C(  1952815971), -INT32_C(  1168317042),  INT32_C(   190384987), -INT32_C(   901188227),  INT32_C(  1820247345),  INT32_C(  2039389056), -INT32_C(  1077802323) },
+      { -INT32_C(  1400247700),  INT32_C(   155793705), -INT32_C(  1369246855), -INT32_C(  1421214497),  INT32_C(  1465349100), -INT32_C(  1661231451),  INT32_C(  2048448371), -INT32_C(  1761270338),
+         INT32_C(   162300800), -INT32_C(  1905377145),  INT32_C(   471506743),  INT32_C(   242890788), -INT32_C(   354294198), -INT32_C(  2126804279), -INT32_C(  1450304916),  INT32_C(   663664618) },
+      { -INT32_C(  1383010513), -INT32_C(  1158185504), -INT32_C(  1210695087),  INT32_C(  1367024913), -INT32_C(   248653136),  INT32_C(   299377186), -INT32_C(  1023173417),  INT32_C(   141752870),
+         INT32_C(  1571529639), -INT32_C(    28170035),  INT32_C(   802179233),  INT32_C(  1745662707), -INT32_C(   983486498),  INT32_C(   865731680), -INT32_C(   322613614), -INT32_C(    45001977) } },
+    { { -INT32_C(  1906784816),  INT32_C(   181927559), -INT32_C(  1130944538),  INT32_C(  1326918969),  INT32_C(  2047376549),  INT32_C(   712271910), -INT32_C(  1290423758), -INT32_C(  1483153948),
+        -INT32_C(   276365884), -INT32_C(  1503654830), -INT32_C(  1656415381), -INT32_C(   404080002),  INT32_C(  1616909418),  INT32_C(   625803664),  INT32_C(   874677019),  INT32_C(  2018537538) },
+      UINT16_C(48877),
+      {  INT32_C(   913757630),  INT32_C(  1115587546),  INT32_C(   871514196), -INT32_C(  1797052657), -INT32_C(  2000842083), -INT32_C(     7836505),  INT32_C(  1510659050),  INT32_C(   884730418),
+         INT32_C(  1555635652), -INT32_C(   720402328), -INT32_C(   333024760),  INT32_C(   594375453), -INT32_C(   328934119),  INT32_C(  1745128815), -INT32_C(  1888911908),  INT32_C(  1652193298) },
+      { -INT32_C(   239333798), -INT32_C(  1577821572),  INT32_C(  1519508540), -INT32_C(  1376761822), -INT32_C(    48630680),  INT32_C(  2012529654),  INT32_C(   987355293), -INT32_C(   277642724),
+        -INT32_C(  1179455016), -INT32_C(   505493086),  INT32_C(   813087222),  INT32_C(   867877880),  INT32_C(  1562449175), -INT32_C(  1955220813), -INT32_C(  2002792852),  INT32_C(   508075375) },
+      { -INT32_C(  1906773568),  INT32_C(   181927559), -INT32_C(  1130964074),  INT32_C(  1326906371),  INT32_C(  2047376549),  INT32_C(   712292365), -INT32_C(  1290450534), -INT32_C(  1483161411),
+        -INT32_C(   276365884), -INT32_C(  1503679199), -INT32_C(  1656407743), -INT32_C(   404093094),  INT32_C(  1616939882),  INT32_C(   625772419),  INT32_C(   874677019),  INT32_C(  2018539380) } },
+    { { -INT32_C(   831747706), -INT32_C(    64979233),  INT32_C(   346813627), -INT32_C(   726307442),  INT32_C(  1458379103),  INT32_C(   857966666),  INT32_C(   510305609),  INT32_C(  1296430698),
+         INT32_C(   952460601),  INT32_C(    72543714),  INT32_C(  1478885466), -INT32_C(   388267476),  INT32_C(  1683498733), -INT32_C(  1026331690),  INT32_C(  1012174627),  INT32_C(  1995166752) },
+      UINT16_C(43602),
+      { -INT32_C(  1465820786),  INT32_C(   115075315),  INT32_C(   414122932), -INT32_C(  1789298720), -INT32_C(  1301020574), -INT32_C(  1654716067),  INT32_C(   783022620),  INT32_C(    18031508),
+         INT32_C(  1430507181), -INT32_C(  1228711553),  INT32_C(   742157039), -INT32_C(  1084233154),  INT32_C(   380847494), -INT32_C(  1929573962), -INT32_C(   179984715),  INT32_C(  1535515146) },
+      {  INT32_C(   869033109),  INT32_C(   155020059), -INT32_C(  1650839881), -INT32_C(    11031468),  INT32_C(   663653262), -INT32_C(   227903303),  INT32_C(  1990140713),  INT32_C(  1171306472),
+         INT32_C(  1632745193), -INT32_C(  1228054765),  INT32_C(  1717191933),  INT32_C(  1364972092), -INT32_C(  1071448717),  INT32_C(  1831582383), -INT32_C(  2115860627), -INT32_C(  1098260420) },
+      { -INT32_C(   831747706), -INT32_C(    64934435),  INT32_C(   346813627), -INT32_C(   726307442),  INT32_C(  1458361649),  INT32_C(   857966666),  INT32_C(   510304348),  INT32_C(  1296430698),
+         INT32_C(   952460601),  INT32_C(    72531169),  INT32_C(  1478885466), -INT32_C(   388250404),  INT32_C(  1683498733), -INT32_C(  1026320923),  INT32_C(  1012174627),  INT32_C(  1995144568) } },
+    { {  INT32_C(   659155679),  INT32_C(  2057911085), -INT32_C(    70464112),  INT32_C(    50405310),  INT32_C(  1002194153),  INT32_C(  1000260973),  INT32_C(   417702625), -INT32_C(  1136216072),
+         INT32_C(  1807755427),  INT32_C(   608698541), -INT32_C(  1498212928),  INT32_C(     9550485),  INT32_C(   618601440),  INT32_C(  1076382822), -INT32_C(  1009251304),  INT32_C(   147926002) },
+      UINT16_C(30069),
+      {  INT32_C(   381272672),  INT32_C(  1163855234), -INT32_C(   209771705),  INT32_C(  1674096566),  INT32_C(  1506457381),  INT32_C(   852593299),  INT32_C(  1984205278), -INT32_C(   787754400),
+        -INT32_C(   162226724),  INT32_C(  2070275311),  INT32_C(  1446425351),  INT32_C(   105519704),  INT32_C(  1351444472),  INT32_C(   885985736),  INT32_C(  1237585492), -INT32_C(  1927974613) },
+      {  INT32_C(  1866434056),  INT32_C(  1439071943), -INT32_C(   478605507),  INT32_C(   100463536),  INT32_C(   489159829),  INT32_C(  1317351793), -INT32_C(   134836280), -INT32_C(  1233483868),
+        -INT32_C(  1692287867),  INT32_C(  2025424922), -INT32_C(  1884935596),  INT32_C(  2099603912), -INT32_C(   834524463),  INT32_C(  2037585179),  INT32_C(   249549045), -INT32_C(  1810356162) },
+      {  INT32_C(   659146876),  INT32_C(  2057911085), -INT32_C(    70450936),  INT32_C(    50405310),  INT32_C(  1002199921),  INT32_C(  1000262539),  INT32_C(   417672066), -INT32_C(  1136216072),
+         INT32_C(  1807695617),  INT32_C(   608698541), -INT32_C(  1498219400),  INT32_C(     9550485),  INT32_C(   618599416),  INT32_C(  1076418676), -INT32_C(  1009258346),  INT32_C(   147926002) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi32(test_vec[i].b);
+    simde__m512i r = simde_mm512_mask_dpbusd_epi32(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_dpbusd_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t src[16];
+    const int32_t a[16];
+    const int32_t b[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { UINT16_C(12133),
+      {  INT32_C(  1248500603),  INT32_C(   675325412),  INT32_C(   347981424),  INT32_C(  1250248126), -INT32_C(   239023624), -INT32_C(   414591484),  INT32_C(   446103938), -INT32_C(   558381562),
+        -INT32_C(  2084648169), -INT32_C(  1198814616),  INT32_C(  1868940021),  INT32_C(   816789367),  INT32_C(   844660292), -INT32_C(  1717916238),  INT32_C(   979695488),  INT32_C(  1650239394) },
+      { -INT32_C(  1716495842), -INT32_C(   541405746), -INT32_C(   514358214),  INT32_C(   703079434),  INT32_C(  2005803765), -INT32_C(   588573339),  INT32_C(  1443412803),  INT32_C(  1688986720),
+        -INT32_C(   488527844),  INT32_C(  1775646361), -INT32_C(  1840458453),  INT32_C(  1291421873),  INT32_C(   666118700), -INT32_C(   910795527),  INT32_C(  1362194328),  INT32_C(   415232225) },
+      { -INT32_C(   568298430), -INT32_C(  1346044593), -INT32_C(   133124650),  INT32_C(   744268579),  INT32_C(   199412726),  INT32_C(  1989664919), -INT32_C(   944856622),  INT32_C(  1864360010),
+         INT32_C(  1294671171),  INT32_C(   826656449),  INT32_C(   390845137), -INT32_C(  1494008979), -INT32_C(  1438501147), -INT32_C(  1364354927), -INT32_C(   697534253), -INT32_C(  1914432851) },
+      {  INT32_C(  1248513453),  INT32_C(           0),  INT32_C(   347967624),  INT32_C(           0),  INT32_C(           0), -INT32_C(   414601476),  INT32_C(   446077533),  INT32_C(           0),
+        -INT32_C(  2084614344), -INT32_C(  1198807476),  INT32_C(  1868937260),  INT32_C(   816806607),  INT32_C(           0), -INT32_C(  1717985033),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(46388),
+      { -INT32_C(   177617826),  INT32_C(  1395491400), -INT32_C(  1248158861), -INT32_C(  1756632534), -INT32_C(  2023540234), -INT32_C(  1811275188), -INT32_C(  1985848133), -INT32_C(   241389602),
+         INT32_C(  1897082366),  INT32_C(   931707191), -INT32_C(  1709281097),  INT32_C(  2073745219), -INT32_C(  1630189277),  INT32_C(   544770387), -INT32_C(   728514536),  INT32_C(    56715063) },
+      { -INT32_C(   555621695), -INT32_C(   531597657), -INT32_C(  1974204195),  INT32_C(   445507781), -INT32_C(  1321771086),  INT32_C(  2037115424),  INT32_C(   583747361), -INT32_C(  1023817608),
+         INT32_C(  1980944713),  INT32_C(   704784442),  INT32_C(   507384404),  INT32_C(  1614286434),  INT32_C(   199133170),  INT32_C(   589643559),  INT32_C(  1588267283),  INT32_C(  1568483748) },
+      {  INT32_C(   408077163), -INT32_C(  1981772898),  INT32_C(   169108560), -INT32_C(  1617544622), -INT32_C(  1474891310),  INT32_C(   619284699),  INT32_C(  1665222070), -INT32_C(  1873242843),
+         INT32_C(   766426889),  INT32_C(  1954328925),  INT32_C(  1025110536), -INT32_C(  2132810585), -INT32_C(  1513316033), -INT32_C(  1530548102),  INT32_C(  1531275109),  INT32_C(  1501013709) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(  1248137321),  INT32_C(           0), -INT32_C(  2023564213), -INT32_C(  1811302557),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(  1897073272),  INT32_C(           0), -INT32_C(  1709277297),  INT32_C(           0), -INT32_C(  1630199401),  INT32_C(   544764702),  INT32_C(           0),  INT32_C(    56726161) } },
+    { UINT16_C(48033),
+      {  INT32_C(   172001174),  INT32_C(   133732228),  INT32_C(    18821913), -INT32_C(  1233017691), -INT32_C(   264098633), -INT32_C(   400673151), -INT32_C(  1482230987), -INT32_C(  1531320754),
+         INT32_C(   991934667), -INT32_C(  1395530109),  INT32_C(  1789248705),  INT32_C(   933018052),  INT32_C(  1445083277), -INT32_C(   652267034), -INT32_C(  1126853624), -INT32_C(   341916873) },
+      {  INT32_C(  1484679242), -INT32_C(  1444798934), -INT32_C(  1011948546), -INT32_C(   479900176),  INT32_C(  1633796212),  INT32_C(  1403692305),  INT32_C(   258069657), -INT32_C(  2013227155),
+        -INT32_C(   194969739), -INT32_C(   122471557),  INT32_C(  1253142885),  INT32_C(   940203034), -INT32_C(   169441286), -INT32_C(  1572198378), -INT32_C(  1572435625),  INT32_C(  1978295971) },
+      {  INT32_C(  1725109101),  INT32_C(   800379372), -INT32_C(  1649884313),  INT32_C(  1105752190), -INT32_C(  2070956409),  INT32_C(   677801675), -INT32_C(  1843616290), -INT32_C(   413167471),
+         INT32_C(  1532036574),  INT32_C(   143128767), -INT32_C(   578836472),  INT32_C(  2038489570),  INT32_C(    52395793), -INT32_C(    98899587), -INT32_C(    44612739), -INT32_C(  1397784008) },
+      {  INT32_C(   172014522),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(   400635242),  INT32_C(           0), -INT32_C(  1531353165),
+         INT32_C(   991961944), -INT32_C(  1395558251),  INT32_C(           0),  INT32_C(   933019916),  INT32_C(  1445112537), -INT32_C(   652264252),  INT32_C(           0), -INT32_C(   341949379) } },
+    { UINT16_C(49245),
+      { -INT32_C(   229884771),  INT32_C(   186455883),  INT32_C(    20829929), -INT32_C(  1155070669), -INT32_C(  1747423148),  INT32_C(   872470948),  INT32_C(   478873538),  INT32_C(   297729490),
+        -INT32_C(   320399031), -INT32_C(    87095989),  INT32_C(   642027843), -INT32_C(  1696626672),  INT32_C(  1638426349),  INT32_C(  2106622747), -INT32_C(   604850361), -INT32_C(   663615922) },
+      {  INT32_C(   633776903), -INT32_C(   642066051),  INT32_C(   354506690),  INT32_C(  1617588409),  INT32_C(     3691552),  INT32_C(     9163788),  INT32_C(  1629302730),  INT32_C(   537020121),
+         INT32_C(  1543261292),  INT32_C(   548737313),  INT32_C(   771780116),  INT32_C(    11361264), -INT32_C(   505744386),  INT32_C(  1861609010),  INT32_C(   976368650),  INT32_C(  1676080002) },
+      { -INT32_C(   867643051), -INT32_C(  1626499401), -INT32_C(  1930742280), -INT32_C(  1544907431), -INT32_C(  1790878798), -INT32_C(  1102557656), -INT32_C(    15625061), -INT32_C(   456181272),
+         INT32_C(   205831505),  INT32_C(  1545220160),  INT32_C(   984464944), -INT32_C(  1226316738), -INT32_C(   797302137),  INT32_C(   732198091),  INT32_C(  1191440105),  INT32_C(  1625020565) },
+      { -INT32_C(   229879881),  INT32_C(           0),  INT32_C(    20829859), -INT32_C(  1155077448), -INT32_C(  1747414360),  INT32_C(           0),  INT32_C(   478848456),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(   604847259), -INT32_C(   663638558) } },
+    { UINT16_C(10444),
+      {  INT32_C(   560824989), -INT32_C(   850933039),  INT32_C(  1580902904), -INT32_C(  1048417740),  INT32_C(   630863974),  INT32_C(    14745967), -INT32_C(  1983451766),  INT32_C(   227809822),
+        -INT32_C(    42873161),  INT32_C(  1926835602),  INT32_C(   837986726),  INT32_C(  1457771721), -INT32_C(  1034024434), -INT32_C(  1087958753),  INT32_C(  1225331600),  INT32_C(  1745644681) },
+      { -INT32_C(  1527041600),  INT32_C(  2135534743), -INT32_C(  1255699293), -INT32_C(    33423252), -INT32_C(   763842181),  INT32_C(    11092753), -INT32_C(   946280980), -INT32_C(   257312720),
+         INT32_C(   495364433),  INT32_C(    86107861),  INT32_C(   405160667), -INT32_C(  1398603372),  INT32_C(  1446401705), -INT32_C(   191509982), -INT32_C(  1076472137), -INT32_C(  1795594864) },
+      { -INT32_C(  1898188581), -INT32_C(   291382119), -INT32_C(     4849451), -INT32_C(   668406842), -INT32_C(   876940441),  INT32_C(   639824258), -INT32_C(  1545460118), -INT32_C(   827068406),
+        -INT32_C(   709061331),  INT32_C(   336902562),  INT32_C(  1315994122), -INT32_C(  1828478852), -INT32_C(   705380980),  INT32_C(   954722926),  INT32_C(   686382554),  INT32_C(  2082519464) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(  1580892828), -INT32_C(  1048434084),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1983441115),  INT32_C(   227782345),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1457771718),  INT32_C(           0), -INT32_C(  1087949518),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(12900),
+      {  INT32_C(  1775118848),  INT32_C(  2008088369),  INT32_C(  1196510005),  INT32_C(   615055627), -INT32_C(   303520848),  INT32_C(  1412618218),  INT32_C(  2058179058),  INT32_C(   416279054),
+         INT32_C(   484391354),  INT32_C(  1288521092),  INT32_C(  1639600140), -INT32_C(  1609765543), -INT32_C(  1276352323),  INT32_C(  2100251582), -INT32_C(  2084806497), -INT32_C(  1443848300) },
+      {  INT32_C(  1357380204), -INT32_C(   262002096), -INT32_C(  1974553293), -INT32_C(   598073651),  INT32_C(   991803605),  INT32_C(  1948159829), -INT32_C(  1492155834),  INT32_C(  1455368586),
+        -INT32_C(  1036071540), -INT32_C(  1715405445),  INT32_C(   711608882), -INT32_C(   944333934),  INT32_C(  1581518456), -INT32_C(  1070316492),  INT32_C(   920896657),  INT32_C(   286468496) },
+      {  INT32_C(   607445301), -INT32_C(  1998595020), -INT32_C(  1140311409),  INT32_C(   937591137),  INT32_C(  1550328961),  INT32_C(  1502758478), -INT32_C(   952240927),  INT32_C(   567148590),
+        -INT32_C(   101143245),  INT32_C(  1794206106), -INT32_C(   657620370), -INT32_C(   679895817), -INT32_C(   604448316),  INT32_C(   213905982),  INT32_C(  1837098548), -INT32_C(  1964691679) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(  1196505980),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1412641882),  INT32_C(  2058166724),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(  1288548449),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1276364091),  INT32_C(  2100252778),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C( 7253),
+      {  INT32_C(   386207533), -INT32_C(  1567769871), -INT32_C(  1073185553),  INT32_C(  2141464245), -INT32_C(  1592051889),  INT32_C(  1657917970), -INT32_C(   393095660),  INT32_C(   226762901),
+         INT32_C(  1460761371), -INT32_C(  1506513175),  INT32_C(  1403673265),  INT32_C(    97842043), -INT32_C(  1232874363),  INT32_C(   608203403),  INT32_C(  2036432334), -INT32_C(  1218589521) },
+      {  INT32_C(   347339378),  INT32_C(   599556518),  INT32_C(   327482139),  INT32_C(   103957173),  INT32_C(  1821986246), -INT32_C(  1367726484),  INT32_C(  2045046093),  INT32_C(  1213757695),
+         INT32_C(  1487607288),  INT32_C(  1880522338),  INT32_C(  1689737678), -INT32_C(  1185045420), -INT32_C(   516208700), -INT32_C(    43938706),  INT32_C(  1449680960),  INT32_C(   900502970) },
+      {  INT32_C(   149226879), -INT32_C(  1971233340),  INT32_C(  1312039047),  INT32_C(   412830622), -INT32_C(  1548983196),  INT32_C(  1380368882), -INT32_C(  1685922872),  INT32_C(   978909142),
+         INT32_C(   152302674),  INT32_C(   574116485), -INT32_C(   801467930), -INT32_C(  1540047041), -INT32_C(  1974197621),  INT32_C(  1511586111),  INT32_C(  1818658792),  INT32_C(  2089526352) },
+      {  INT32_C(   386218588),  INT32_C(           0), -INT32_C(  1073172442),  INT32_C(           0), -INT32_C(  1592047285),  INT32_C(           0), -INT32_C(   393149690),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(  1403663844),  INT32_C(    97824491), -INT32_C(  1232916475),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C( 4554),
+      {  INT32_C(   640845673), -INT32_C(  1230430242),  INT32_C(   999746889), -INT32_C(   376000135),  INT32_C(   517801422),  INT32_C(    45560234),  INT32_C(    63740814), -INT32_C(  1620712791),
+         INT32_C(   497480186), -INT32_C(  1402282213), -INT32_C(  1872195257), -INT32_C(  2092973335),  INT32_C(  1293540880), -INT32_C(   854999349), -INT32_C(   431998374), -INT32_C(   657458433) },
+      {  INT32_C(    30994693),  INT32_C(   880456987),  INT32_C(   532443678), -INT32_C(  1517793057),  INT32_C(   531539352),  INT32_C(   981979895), -INT32_C(  1444783088),  INT32_C(  1913404486),
+         INT32_C(   637596570),  INT32_C(   320848482),  INT32_C(   243046267),  INT32_C(   648876026),  INT32_C(   276444236),  INT32_C(   944817652),  INT32_C(  1334456894),  INT32_C(  1012451079) },
+      { -INT32_C(  1518649430),  INT32_C(  1124414916), -INT32_C(  1359119521), -INT32_C(  1937836249), -INT32_C(   296058577), -INT32_C(   728762187),  INT32_C(   561243785), -INT32_C(   379639025),
+        -INT32_C(  1842189742), -INT32_C(   111201921), -INT32_C(   569619914),  INT32_C(  1559471851), -INT32_C(   764756066), -INT32_C(  1375148723),  INT32_C(  1011770589),  INT32_C(  1587640284) },
+      {  INT32_C(           0), -INT32_C(  1230418175),  INT32_C(           0), -INT32_C(   375994162),  INT32_C(           0),  INT32_C(           0),  INT32_C(    63768085), -INT32_C(  1620710643),
+         INT32_C(   497514392),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1293542248),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi32(test_vec[i].b);
+    simde__m512i r = simde_mm512_maskz_dpbusd_epi32(test_vec[i].k, src, a, b);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_dpbusd_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_dpbusd_avx_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_dpbusd_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_dpbusd_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_dpbusd_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_dpbusd_avx_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_dpbusd_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_dpbusd_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_dpbusd_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_dpbusd_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_dpbusd_epi32)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
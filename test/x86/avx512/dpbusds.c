@@ -0,0 +1,779 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN dpbusds
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/dpbusds.h>
+
+static int
+test_simde_mm_dpbusds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(  1909016608),  INT32_C(   258855105), -INT32_C(  2147418945),  INT32_C(   180341798) },
+      { -INT32_C(  1519393256),  INT32_C(   910725594), -INT32_C(   507094484), -INT32_C(  2127226932) },
+      {  INT32_C(  1330714495),  INT32_C(  1525486969), -INT32_C(  1355032022),  INT32_C(  1804892242) },
+      { -INT32_C(  1908986244),  INT32_C(   258888020), -INT32_C(  2147427060),  INT32_C(   180369365) } },
+    { { -INT32_C(  2147402609),  INT32_C(   875042428), -INT32_C(  2147459232), -INT32_C(    68369414) },
+      {  INT32_C(   694667905),  INT32_C(  1445479663), -INT32_C(  1120725058), -INT32_C(   681362442) },
+      { -INT32_C(   472763145), -INT32_C(   434442802), -INT32_C(  1965860497), -INT32_C(  1868224757) },
+      { -INT32_C(  2147399193),  INT32_C(   875027990), -INT32_C(  2147460692), -INT32_C(    68397496) } },
+    { { -INT32_C(  2147478389), -INT32_C(   756027836),  INT32_C(  2147384492),  INT32_C(  1775784103) },
+      { -INT32_C(   914776526),  INT32_C(  1597337546), -INT32_C(  1488345391), -INT32_C(  1721651604) },
+      { -INT32_C(  1900551592), -INT32_C(   389435157),  INT32_C(   457644913), -INT32_C(  1592413505) },
+      {              INT32_MIN, -INT32_C(   756046153),  INT32_C(  2147422283),  INT32_C(  1775751013) } },
+    { {  INT32_C(  2147390291),  INT32_C(  1977787382),  INT32_C(   682473119),  INT32_C(  2147392242) },
+      { -INT32_C(   391520166),  INT32_C(   640211211),  INT32_C(  1417470386),  INT32_C(  1756600390) },
+      { -INT32_C(   176465946), -INT32_C(  1778377692), -INT32_C(   478128495), -INT32_C(   368832494) },
+      {  INT32_C(  2147425674),  INT32_C(  1977789826),  INT32_C(   682454403),  INT32_C(  2147394362) } },
+    { { -INT32_C(  1133101321), -INT32_C(  1826522297),  INT32_C(  2147396562),  INT32_C(  1213365874) },
+      { -INT32_C(   829070444),  INT32_C(  1194842281),  INT32_C(  1696061087), -INT32_C(  1049804511) },
+      { -INT32_C(   507193561),  INT32_C(  1942502946), -INT32_C(   793262359), -INT32_C(  1248037209) },
+      { -INT32_C(  1133114934), -INT32_C(  1826498074),  INT32_C(  2147373966),  INT32_C(  1213345232) } },
+    { { -INT32_C(  2147443490), -INT32_C(   703982927), -INT32_C(  2147384625), -INT32_C(  2147477253) },
+      { -INT32_C(  1644241109),  INT32_C(  1108401140),  INT32_C(   718998992), -INT32_C(  1724315686) },
+      { -INT32_C(  1963633278), -INT32_C(  1940491567),  INT32_C(   176230721),  INT32_C(  1007185968) },
+      { -INT32_C(  2147451273), -INT32_C(   703975709), -INT32_C(  2147398277), -INT32_C(  2147456369) } },
+    { {  INT32_C(   787591883),  INT32_C(  2147459401), -INT32_C(  2147461134),  INT32_C(   164502540) },
+      { -INT32_C(  1916610799),  INT32_C(   447023540),  INT32_C(  1217498718), -INT32_C(  1188606548) },
+      { -INT32_C(  1909949352),  INT32_C(  1252996909), -INT32_C(  2037316146), -INT32_C(  1844139185) },
+      {  INT32_C(   787611725),  INT32_C(  2147456555),              INT32_MIN,  INT32_C(   164490013) } },
+    { {  INT32_C(  1039720761),  INT32_C(  2147471477), -INT32_C(  1308070731),  INT32_C(  2060393745) },
+      { -INT32_C(  1420068543),  INT32_C(  1504865912),  INT32_C(   593854221),  INT32_C(  1776597803) },
+      {  INT32_C(   462732778), -INT32_C(  1058460347),  INT32_C(    52247905),  INT32_C(  1595629877) },
+      {  INT32_C(  1039706013),  INT32_C(  2147474917), -INT32_C(  1308058689),  INT32_C(  2060430294) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_dpbusds_epi32(src, a, b);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_dpbusds_avx_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(  1909016608),  INT32_C(   258855105), -INT32_C(  2147418945),  INT32_C(   180341798) },
+      { -INT32_C(  1519393256),  INT32_C(   910725594), -INT32_C(   507094484), -INT32_C(  2127226932) },
+      {  INT32_C(  1330714495),  INT32_C(  1525486969), -INT32_C(  1355032022),  INT32_C(  1804892242) },
+      { -INT32_C(  1908986244),  INT32_C(   258888020), -INT32_C(  2147427060),  INT32_C(   180369365) } },
+    { { -INT32_C(  2147402609),  INT32_C(   875042428), -INT32_C(  2147459232), -INT32_C(    68369414) },
+      {  INT32_C(   694667905),  INT32_C(  1445479663), -INT32_C(  1120725058), -INT32_C(   681362442) },
+      { -INT32_C(   472763145), -INT32_C(   434442802), -INT32_C(  1965860497), -INT32_C(  1868224757) },
+      { -INT32_C(  2147399193),  INT32_C(   875027990), -INT32_C(  2147460692), -INT32_C(    68397496) } },
+    { { -INT32_C(  2147478389), -INT32_C(   756027836),  INT32_C(  2147384492),  INT32_C(  1775784103) },
+      { -INT32_C(   914776526),  INT32_C(  1597337546), -INT32_C(  1488345391), -INT32_C(  1721651604) },
+      { -INT32_C(  1900551592), -INT32_C(   389435157),  INT32_C(   457644913), -INT32_C(  1592413505) },
+      {              INT32_MIN, -INT32_C(   756046153),  INT32_C(  2147422283),  INT32_C(  1775751013) } },
+    { {  INT32_C(  2147390291),  INT32_C(  1977787382),  INT32_C(   682473119),  INT32_C(  2147392242) },
+      { -INT32_C(   391520166),  INT32_C(   640211211),  INT32_C(  1417470386),  INT32_C(  1756600390) },
+      { -INT32_C(   176465946), -INT32_C(  1778377692), -INT32_C(   478128495), -INT32_C(   368832494) },
+      {  INT32_C(  2147425674),  INT32_C(  1977789826),  INT32_C(   682454403),  INT32_C(  2147394362) } },
+    { { -INT32_C(  1133101321), -INT32_C(  1826522297),  INT32_C(  2147396562),  INT32_C(  1213365874) },
+      { -INT32_C(   829070444),  INT32_C(  1194842281),  INT32_C(  1696061087), -INT32_C(  1049804511) },
+      { -INT32_C(   507193561),  INT32_C(  1942502946), -INT32_C(   793262359), -INT32_C(  1248037209) },
+      { -INT32_C(  1133114934), -INT32_C(  1826498074),  INT32_C(  2147373966),  INT32_C(  1213345232) } },
+    { { -INT32_C(  2147443490), -INT32_C(   703982927), -INT32_C(  2147384625), -INT32_C(  2147477253) },
+      { -INT32_C(  1644241109),  INT32_C(  1108401140),  INT32_C(   718998992), -INT32_C(  1724315686) },
+      { -INT32_C(  1963633278), -INT32_C(  1940491567),  INT32_C(   176230721),  INT32_C(  1007185968) },
+      { -INT32_C(  2147451273), -INT32_C(   703975709), -INT32_C(  2147398277), -INT32_C(  2147456369) } },
+    { {  INT32_C(   787591883),  INT32_C(  2147459401), -INT32_C(  2147461134),  INT32_C(   164502540) },
+      { -INT32_C(  1916610799),  INT32_C(   447023540),  INT32_C(  1217498718), -INT32_C(  1188606548) },
+      { -INT32_C(  1909949352),  INT32_C(  1252996909), -INT32_C(  2037316146), -INT32_C(  1844139185) },
+      {  INT32_C(   787611725),  INT32_C(  2147456555),              INT32_MIN,  INT32_C(   164490013) } },
+    { {  INT32_C(  1039720761),  INT32_C(  2147471477), -INT32_C(  1308070731),  INT32_C(  2060393745) },
+      { -INT32_C(  1420068543),  INT32_C(  1504865912),  INT32_C(   593854221),  INT32_C(  1776597803) },
+      {  INT32_C(   462732778), -INT32_C(  1058460347),  INT32_C(    52247905),  INT32_C(  1595629877) },
+      {  INT32_C(  1039706013),  INT32_C(  2147474917), -INT32_C(  1308058689),  INT32_C(  2060430294) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_dpbusds_avx_epi32(src, a, b);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_dpbusds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(  2147457247), -INT32_C(  2147437283), -INT32_C(  2147470790),  INT32_C(  2147430176) },
+      UINT8_C(  6),
+      {  INT32_C(   680510627), -INT32_C(   888161668),  INT32_C(  1835794018), -INT32_C(   299630411) },
+      { -INT32_C(    53383730), -INT32_C(  1792992409),  INT32_C(  1148087864), -INT32_C(  2125109836) },
+      { -INT32_C(  2147457247), -INT32_C(  2147440715), -INT32_C(  2147418180),  INT32_C(  2147430176) } },
+    { { -INT32_C(  1215502432), -INT32_C(  2147443007), -INT32_C(  2147387933), -INT32_C(  2147396358) },
+      UINT8_C( 15),
+      { -INT32_C(  1415704462),  INT32_C(   840303200), -INT32_C(   530794104), -INT32_C(  1235688631) },
+      { -INT32_C(   455883776), -INT32_C(  1930999031),  INT32_C(  1661942545),  INT32_C(   145485987) },
+      { -INT32_C(  1215515290), -INT32_C(  2147448343), -INT32_C(  2147351150), -INT32_C(  2147412803) } },
+    { { -INT32_C(  2147445519), -INT32_C(  2147476300),  INT32_C(  2147417280),  INT32_C(  2147460737) },
+      UINT8_C(  9),
+      { -INT32_C(  1391093057),  INT32_C(  1489185182),  INT32_C(   656235464), -INT32_C(  1012265835) },
+      {  INT32_C(  1208106506),  INT32_C(   655064450), -INT32_C(  1174911345),  INT32_C(  1404569124) },
+      { -INT32_C(  2147421563), -INT32_C(  2147476300),  INT32_C(  2147417280),  INT32_C(  2147470118) } },
+    { { -INT32_C(   283914545), -INT32_C(  2127468664),  INT32_C(    83333184), -INT32_C(  2147398808) },
+      UINT8_C(  7),
+      { -INT32_C(   110286977),  INT32_C(   802194842), -INT32_C(  1614352123), -INT32_C(   270925714) },
+      { -INT32_C(  1598164936),  INT32_C(  1068503271), -INT32_C(   455266967), -INT32_C(  1329234655) },
+      { -INT32_C(   283939264), -INT32_C(  2127484065),  INT32_C(    83333172), -INT32_C(  2147398808) } },
+    { {  INT32_C(   883014268),  INT32_C(  1491413896), -INT32_C(  2147409004),  INT32_C(  1341406300) },
+      UINT8_C(  9),
+      {  INT32_C(  2072174461),  INT32_C(   123809595),  INT32_C(  1111399183),  INT32_C(  1423123922) },
+      { -INT32_C(  2022615195), -INT32_C(   646506502), -INT32_C(  1566206362),  INT32_C(   111219971) },
+      {  INT32_C(   883046101),  INT32_C(  1491413896), -INT32_C(  2147409004),  INT32_C(  1341388166) } },
+    { { -INT32_C(  2147423428), -INT32_C(  2147451268),  INT32_C(  1723545504),  INT32_C(   112924574) },
+      UINT8_C( 10),
+      { -INT32_C(   835435930), -INT32_C(   252990785), -INT32_C(  1804802807), -INT32_C(  1479126331) },
+      {  INT32_C(  1272888704),  INT32_C(  1297601667),  INT32_C(   760939373),  INT32_C(   983795443) },
+      { -INT32_C(  2147423428), -INT32_C(  2147443698),  INT32_C(  1723545504),  INT32_C(   112901793) } },
+    { {  INT32_C(  2147440678), -INT32_C(  1966241706),  INT32_C(  1659478159),  INT32_C(  1182278150) },
+      UINT8_C( 11),
+      {  INT32_C(  1170236609), -INT32_C(   461028575),  INT32_C(   760607477),  INT32_C(  1569253187) },
+      { -INT32_C(   114074708),  INT32_C(   195875768),  INT32_C(  1562348283),  INT32_C(   878478093) },
+      {  INT32_C(  2147442875), -INT32_C(  1966255761),  INT32_C(  1659478159),  INT32_C(  1182267494) } },
+    { { -INT32_C(    18660555), -INT32_C(  2147478336),  INT32_C(  2147421323), -INT32_C(  2060747280) },
+      UINT8_C( 15),
+      { -INT32_C(  2106270838), -INT32_C(  1041836777), -INT32_C(  1267685422), -INT32_C(  2093102953) },
+      {  INT32_C(   710052264), -INT32_C(   545310296),  INT32_C(   977184730),  INT32_C(  1022310298) },
+      { -INT32_C(    18683788), -INT32_C(  2147445378),  INT32_C(  2147415864), -INT32_C(  2060744859) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_mask_dpbusds_epi32(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_dpbusds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t src[4];
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { UINT8_C( 14),
+      { -INT32_C(  2147477964), -INT32_C(  2147474260), -INT32_C(  2147399238), -INT32_C(  2147426046) },
+      {  INT32_C(  1701147001), -INT32_C(   653173925), -INT32_C(   793558062),  INT32_C(   727135021) },
+      { -INT32_C(   124960882),  INT32_C(  1924244695), -INT32_C(  1675486660), -INT32_C(  1637854531) },
+      {  INT32_C(           0), -INT32_C(  2147462968), -INT32_C(  2147399610), -INT32_C(  2147420741) } },
+    { UINT8_C(  5),
+      {  INT32_C(  2147472706), -INT32_C(  2147450153), -INT32_C(   923724302),  INT32_C(  2147413635) },
+      { -INT32_C(   308229251), -INT32_C(  1750155782), -INT32_C(  1883869640), -INT32_C(   151916528) },
+      {  INT32_C(    19644976),  INT32_C(  1415098627), -INT32_C(  2005790656), -INT32_C(   790521641) },
+      {  INT32_C(  2147473237),  INT32_C(           0), -INT32_C(   923715370),  INT32_C(           0) } },
+    { UINT8_C( 12),
+      { -INT32_C(   912606228), -INT32_C(  1742576578),  INT32_C(  2147405695), -INT32_C(    38866665) },
+      {  INT32_C(  1249798738),  INT32_C(    31987212), -INT32_C(   147745147),  INT32_C(   332723098) },
+      { -INT32_C(   968093080), -INT32_C(   624875243), -INT32_C(  1951527701),  INT32_C(    95995290) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(  2147371785), -INT32_C(    38911879) } },
+    { UINT8_C( 12),
+      {  INT32_C(  1754748342),  INT32_C(  2147398631),  INT32_C(  2147418424), -INT32_C(   265383968) },
+      {  INT32_C(   967590101),  INT32_C(   652213959), -INT32_C(  2142628318),  INT32_C(  1634306221) },
+      { -INT32_C(   898474924), -INT32_C(  1628192011),  INT32_C(  1785132399), -INT32_C(   351936944) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(  2147443072), -INT32_C(   265376264) } },
+    { UINT8_C( 11),
+      { -INT32_C(  2147394671),  INT32_C(  2147442686),  INT32_C(   504004341), -INT32_C(  2147434791) },
+      {  INT32_C(   314921440),  INT32_C(  1646679080),  INT32_C(    75695604),  INT32_C(   571915730) },
+      { -INT32_C(   120258166), -INT32_C(  1864506169),  INT32_C(  1374615883),  INT32_C(  1191141229) },
+      { -INT32_C(  2147429637),  INT32_C(  2147425748),  INT32_C(           0), -INT32_C(  2147391588) } },
+    { UINT8_C( 15),
+      {  INT32_C(  1444308675), -INT32_C(  2147483374),  INT32_C(  2147415313),  INT32_C(   909803857) },
+      { -INT32_C(  1330414666),  INT32_C(  1325522641),  INT32_C(   886045855),  INT32_C(  1553165696) },
+      { -INT32_C(  1632038097),  INT32_C(  2052471969),  INT32_C(  1876061204),  INT32_C(  1200889581) },
+      {  INT32_C(  1444289609), -INT32_C(  2147480185),  INT32_C(  2147441959),  INT32_C(   909795351) } },
+    { UINT8_C( 13),
+      { -INT32_C(  1908483700), -INT32_C(  1961675949),  INT32_C(   432020020),  INT32_C(  1075353899) },
+      { -INT32_C(    58839548),  INT32_C(  1030996127), -INT32_C(   690796245), -INT32_C(   216031535) },
+      { -INT32_C(  1663615623),  INT32_C(  1106953487), -INT32_C(    64556199), -INT32_C(  1577796321) },
+      { -INT32_C(  1908510776),  INT32_C(           0),  INT32_C(   432030060),  INT32_C(  1075326335) } },
+    { UINT8_C( 15),
+      { -INT32_C(  1544101065),  INT32_C(  2147463209),  INT32_C(  2147478264), -INT32_C(  1007131399) },
+      {  INT32_C(  1270230028),  INT32_C(  1480382775),  INT32_C(   439795156), -INT32_C(   685934134) },
+      { -INT32_C(  1238965344),  INT32_C(   769804003),  INT32_C(   288425787),  INT32_C(  1925689475) },
+      { -INT32_C(  1544102127),  INT32_C(  2147478964),  INT32_C(  2147483647), -INT32_C(  1007143472) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_maskz_dpbusds_epi32(test_vec[i].k, src, a, b);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_dpbusds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const int32_t a[8];
+    const int32_t b[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { {  INT32_C(  1437864978),  INT32_C(  1837268657),  INT32_C(  1064783709), -INT32_C(  1560054525),  INT32_C(    15416218),  INT32_C(   683502994),  INT32_C(  2147420769), -INT32_C(  2147388698) },
+      {  INT32_C(   961272370), -INT32_C(    83137237),  INT32_C(  1646140974),  INT32_C(  1643776526), -INT32_C(   504054501), -INT32_C(    60648502),  INT32_C(   290266459), -INT32_C(  1434066755) },
+      { -INT32_C(  1038845209), -INT32_C(    56784719),  INT32_C(   189218645),  INT32_C(   382066905), -INT32_C(   593019424), -INT32_C(   989737305),  INT32_C(  1782220262), -INT32_C(   107719098) },
+      {  INT32_C(  1437888290),  INT32_C(  1837250087),  INT32_C(  1064792717), -INT32_C(  1560068007),  INT32_C(    15397067),  INT32_C(   683462896),  INT32_C(  2147421104), -INT32_C(  2147371758) } },
+    { { -INT32_C(  1895230010), -INT32_C(  2031676430),  INT32_C(  2090691355), -INT32_C(  1380705782), -INT32_C(  2147391979), -INT32_C(  2116495561),  INT32_C(   760452630), -INT32_C(  2093233435) },
+      {  INT32_C(   472420854),  INT32_C(   894657022), -INT32_C(  2067047133),  INT32_C(  1050501999),  INT32_C(  1280239052),  INT32_C(  1247825962),  INT32_C(   648616398),  INT32_C(  1595368846) },
+      { -INT32_C(  1853594592),  INT32_C(  1535175118), -INT32_C(  1976521913), -INT32_C(  1326334317), -INT32_C(   766214939), -INT32_C(   408681751), -INT32_C(   324942808),  INT32_C(  1884723539) },
+      { -INT32_C(  1895215706), -INT32_C(  2031697162),  INT32_C(  2090680103), -INT32_C(  1380731730), -INT32_C(  2147366035), -INT32_C(  2116507049),  INT32_C(   760442555), -INT32_C(  2093219434) } },
+    { { -INT32_C(   333662244), -INT32_C(  1505056459), -INT32_C(  1517112511), -INT32_C(   429109660), -INT32_C(  1680733459),  INT32_C(  2147475932),  INT32_C(  2147437412), -INT32_C(  2036620571) },
+      { -INT32_C(   231310244),  INT32_C(  1267618983),  INT32_C(  1390371093),  INT32_C(   767617428),  INT32_C(   450976525),  INT32_C(  1136322004), -INT32_C(   893432513),  INT32_C(  1369606445) },
+      { -INT32_C(  1727706704),  INT32_C(  1487265834), -INT32_C(   914048618), -INT32_C(  1102518310), -INT32_C(  1443364669), -INT32_C(  1328173538), -INT32_C(   692240627), -INT32_C(   506686627) },
+      { -INT32_C(   333685208), -INT32_C(  1505058455), -INT32_C(  1517153786), -INT32_C(   429110255), -INT32_C(  1680738314),  INT32_C(  2147450156),  INT32_C(  2147421801), -INT32_C(  2036642254) } },
+    { {  INT32_C(  2115535207),  INT32_C(  2147457790),  INT32_C(  2147395039), -INT32_C(  1617234573),  INT32_C(   719925148), -INT32_C(  2147402109),  INT32_C(  2147404782), -INT32_C(  2074334614) },
+      {  INT32_C(   460713161),  INT32_C(   580359891), -INT32_C(   404305482),  INT32_C(  2105705392), -INT32_C(   429777241),  INT32_C(  1833382215), -INT32_C(   890927413),  INT32_C(   741142785) },
+      { -INT32_C(   654722962),  INT32_C(  1706719397), -INT32_C(   660254427), -INT32_C(   564494037),  INT32_C(   701905029), -INT32_C(  1366990997),  INT32_C(   666381055),  INT32_C(   723076945) },
+      {  INT32_C(  2115538426),  INT32_C(  2147449453),  INT32_C(  2147387884), -INT32_C(  1617236192),  INT32_C(   719911601), -INT32_C(  2147407528),  INT32_C(  2147401597), -INT32_C(  2074314430) } },
+    { {  INT32_C(    33580632),  INT32_C(   377827300),  INT32_C(  2147472035),  INT32_C(   845207504), -INT32_C(  1802241970),  INT32_C(  2147398122),  INT32_C(  2147438400),  INT32_C(  2147410352) },
+      { -INT32_C(  1782050768),  INT32_C(   203336600),  INT32_C(   657578088),  INT32_C(   748668595),  INT32_C(    54235216), -INT32_C(  1999800023), -INT32_C(   656451219),  INT32_C(   320673133) },
+      { -INT32_C(  1186785453),  INT32_C(  1015625630),  INT32_C(     2514008),  INT32_C(   234234378), -INT32_C(    12731679),  INT32_C(   422545020), -INT32_C(  1165022861), -INT32_C(  1552707913) },
+      {  INT32_C(    33587805),  INT32_C(   377818959),  INT32_C(  2147483647),  INT32_C(   845215008), -INT32_C(  1802250934),  INT32_C(  2147401479),  INT32_C(  2147414265),  INT32_C(  2147401569) } },
+    { { -INT32_C(   867034981), -INT32_C(  2147388188), -INT32_C(  1747826116), -INT32_C(  2147439511), -INT32_C(  1540311582), -INT32_C(  2147388248), -INT32_C(  2147410599), -INT32_C(  2129137521) },
+      { -INT32_C(  1591225274), -INT32_C(   117573590), -INT32_C(  1816473309),  INT32_C(   645420624),  INT32_C(  1694883366), -INT32_C(   920675085), -INT32_C(   787387414), -INT32_C(  1644534248) },
+      {  INT32_C(   771812332), -INT32_C(   400908804),  INT32_C(   607558501), -INT32_C(   480966272),  INT32_C(   854704222), -INT32_C(  1535029764),  INT32_C(  2056893647),  INT32_C(  1222377086) },
+      { -INT32_C(   867033427), -INT32_C(  2147412282), -INT32_C(  1747828354), -INT32_C(  2147439879), -INT32_C(  1540317243), -INT32_C(  2147399637), -INT32_C(  2147406450), -INT32_C(  2129132647) } },
+    { { -INT32_C(  2147412822),  INT32_C(   241872334), -INT32_C(   496729210),  INT32_C(   238813939),  INT32_C(  2147483506),  INT32_C(  2147400244), -INT32_C(  2147403168), -INT32_C(  1103705620) },
+      {  INT32_C(  1908692209), -INT32_C(   609982289),  INT32_C(   311795792),  INT32_C(   914576286), -INT32_C(  1939334554),  INT32_C(   568466647), -INT32_C(   791983313), -INT32_C(  1697413455) },
+      { -INT32_C(   549084021),  INT32_C(  2053279192),  INT32_C(   259897468),  INT32_C(  1588953849), -INT32_C(    79436276), -INT32_C(  1485576132), -INT32_C(   783454308), -INT32_C(  1595207232) },
+      { -INT32_C(  2147438952),  INT32_C(   241896164), -INT32_C(   496711915),  INT32_C(   238797626),  INT32_C(  2147483647),  INT32_C(  2147435525), -INT32_C(  2147393688), -INT32_C(  1103733885) } },
+    { { -INT32_C(  2147403241),  INT32_C(  2147459149), -INT32_C(   484994516),  INT32_C(   878335586), -INT32_C(  2147454214), -INT32_C(  2147448655), -INT32_C(  2147437016), -INT32_C(  2147398733) },
+      { -INT32_C(   148796926), -INT32_C(  1545029124), -INT32_C(   207954552), -INT32_C(  2033645184), -INT32_C(  1418745717),  INT32_C(  1919557664), -INT32_C(   559581710), -INT32_C(   591164759) },
+      {  INT32_C(  2113415397), -INT32_C(  1747011299), -INT32_C(   822507426), -INT32_C(  1204000035),  INT32_C(  1673330017),  INT32_C(   230589787),  INT32_C(   998938909),  INT32_C(  1131010235) },
+      { -INT32_C(  2147367164),  INT32_C(  2147428319), -INT32_C(   485021480),  INT32_C(   878334472), -INT32_C(  2147431854), -INT32_C(  2147455193), -INT32_C(  2147448421), -INT32_C(  2147380699) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i r = simde_mm256_dpbusds_epi32(src, a, b);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_dpbusds_avx_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const int32_t a[8];
+    const int32_t b[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { {  INT32_C(  1437864978),  INT32_C(  1837268657),  INT32_C(  1064783709), -INT32_C(  1560054525),  INT32_C(    15416218),  INT32_C(   683502994),  INT32_C(  2147420769), -INT32_C(  2147388698) },
+      {  INT32_C(   961272370), -INT32_C(    83137237),  INT32_C(  1646140974),  INT32_C(  1643776526), -INT32_C(   504054501), -INT32_C(    60648502),  INT32_C(   290266459), -INT32_C(  1434066755) },
+      { -INT32_C(  1038845209), -INT32_C(    56784719),  INT32_C(   189218645),  INT32_C(   382066905), -INT32_C(   593019424), -INT32_C(   989737305),  INT32_C(  1782220262), -INT32_C(   107719098) },
+      {  INT32_C(  1437888290),  INT32_C(  1837250087),  INT32_C(  1064792717), -INT32_C(  1560068007),  INT32_C(    15397067),  INT32_C(   683462896),  INT32_C(  2147421104), -INT32_C(  2147371758) } },
+    { { -INT32_C(  1895230010), -INT32_C(  2031676430),  INT32_C(  2090691355), -INT32_C(  1380705782), -INT32_C(  2147391979), -INT32_C(  2116495561),  INT32_C(   760452630), -INT32_C(  2093233435) },
+      {  INT32_C(   472420854),  INT32_C(   894657022), -INT32_C(  2067047133),  INT32_C(  1050501999),  INT32_C(  1280239052),  INT32_C(  1247825962),  INT32_C(   648616398),  INT32_C(  1595368846) },
+      { -INT32_C(  1853594592),  INT32_C(  1535175118), -INT32_C(  1976521913), -INT32_C(  1326334317), -INT32_C(   766214939), -INT32_C(   408681751), -INT32_C(   324942808),  INT32_C(  1884723539) },
+      { -INT32_C(  1895215706), -INT32_C(  2031697162),  INT32_C(  2090680103), -INT32_C(  1380731730), -INT32_C(  2147366035), -INT32_C(  2116507049),  INT32_C(   760442555), -INT32_C(  2093219434) } },
+    { { -INT32_C(   333662244), -INT32_C(  1505056459), -INT32_C(  1517112511), -INT32_C(   429109660), -INT32_C(  1680733459),  INT32_C(  2147475932),  INT32_C(  2147437412), -INT32_C(  2036620571) },
+      { -INT32_C(   231310244),  INT32_C(  1267618983),  INT32_C(  1390371093),  INT32_C(   767617428),  INT32_C(   450976525),  INT32_C(  1136322004), -INT32_C(   893432513),  INT32_C(  1369606445) },
+      { -INT32_C(  1727706704),  INT32_C(  1487265834), -INT32_C(   914048618), -INT32_C(  1102518310), -INT32_C(  1443364669), -INT32_C(  1328173538), -INT32_C(   692240627), -INT32_C(   506686627) },
+      { -INT32_C(   333685208), -INT32_C(  1505058455), -INT32_C(  1517153786), -INT32_C(   429110255), -INT32_C(  1680738314),  INT32_C(  2147450156),  INT32_C(  2147421801), -INT32_C(  2036642254) } },
+    { {  INT32_C(  2115535207),  INT32_C(  2147457790),  INT32_C(  2147395039), -INT32_C(  1617234573),  INT32_C(   719925148), -INT32_C(  2147402109),  INT32_C(  2147404782), -INT32_C(  2074334614) },
+      {  INT32_C(   460713161),  INT32_C(   580359891), -INT32_C(   404305482),  INT32_C(  2105705392), -INT32_C(   429777241),  INT32_C(  1833382215), -INT32_C(   890927413),  INT32_C(   741142785) },
+      { -INT32_C(   654722962),  INT32_C(  1706719397), -INT32_C(   660254427), -INT32_C(   564494037),  INT32_C(   701905029), -INT32_C(  1366990997),  INT32_C(   666381055),  INT32_C(   723076945) },
+      {  INT32_C(  2115538426),  INT32_C(  2147449453),  INT32_C(  2147387884), -INT32_C(  1617236192),  INT32_C(   719911601), -INT32_C(  2147407528),  INT32_C(  2147401597), -INT32_C(  2074314430) } },
+    { {  INT32_C(    33580632),  INT32_C(   377827300),  INT32_C(  2147472035),  INT32_C(   845207504), -INT32_C(  1802241970),  INT32_C(  2147398122),  INT32_C(  2147438400),  INT32_C(  2147410352) },
+      { -INT32_C(  1782050768),  INT32_C(   203336600),  INT32_C(   657578088),  INT32_C(   748668595),  INT32_C(    54235216), -INT32_C(  1999800023), -INT32_C(   656451219),  INT32_C(   320673133) },
+      { -INT32_C(  1186785453),  INT32_C(  1015625630),  INT32_C(     2514008),  INT32_C(   234234378), -INT32_C(    12731679),  INT32_C(   422545020), -INT32_C(  1165022861), -INT32_C(  1552707913) },
+      {  INT32_C(    33587805),  INT32_C(   377818959),  INT32_C(  2147483647),  INT32_C(   845215008), -INT32_C(  1802250934),  INT32_C(  2147401479),  INT32_C(  2147414265),  INT32_C(  2147401569) } },
+    { { -INT32_C(   867034981), -INT32_C(  2147388188), -INT32_C(  1747826116), -INT32_C(  2147439511), -INT32_C(  1540311582), -INT32_C(  2147388248), -INT32_C(  2147410599), -INT32_C(  2129137521) },
+      { -INT32_C(  1591225274), -INT32_C(   117573590), -INT32_C(  1816473309),  INT32_C(   645420624),  INT32_C(  1694883366), -INT32_C(   920675085), -INT32_C(   787387414), -INT32_C(  1644534248) },
+      {  INT32_C(   771812332), -INT32_C(   400908804),  INT32_C(   607558501), -INT32_C(   480966272),  INT32_C(   854704222), -INT32_C(  1535029764),  INT32_C(  2056893647),  INT32_C(  1222377086) },
+      { -INT32_C(   867033427), -INT32_C(  2147412282), -INT32_C(  1747828354), -INT32_C(  2147439879), -INT32_C(  1540317243), -INT32_C(  2147399637), -INT32_C(  2147406450), -INT32_C(  2129132647) } },
+    { { -INT32_C(  2147412822),  INT32_C(   241872334), -INT32_C(   496729210),  INT32_C(   238813939),  INT32_C(  2147483506),  INT32_C(  2147400244), -INT32_C(  2147403168), -INT32_C(  1103705620) },
+      {  INT32_C(  1908692209), -INT32_C(   609982289),  INT32_C(   311795792),  INT32_C(   914576286), -INT32_C(  1939334554),  INT32_C(   568466647), -INT32_C(   791983313), -INT32_C(  1697413455) },
+      { -INT32_C(   549084021),  INT32_C(  2053279192),  INT32_C(   259897468),  INT32_C(  1588953849), -INT32_C(    79436276), -INT32_C(  1485576132), -INT32_C(   783454308), -INT32_C(  1595207232) },
+      { -INT32_C(  2147438952),  INT32_C(   241896164), -INT32_C(   496711915),  INT32_C(   238797626),  INT32_C(  2147483647),  INT32_C(  2147435525), -INT32_C(  2147393688), -INT32_C(  1103733885) } },
+    { { -INT32_C(  2147403241),  INT32_C(  2147459149), -INT32_C(   484994516),  INT32_C(   878335586), -INT32_C(  2147454214), -INT32_C(  2147448655), -INT32_C(  2147437016), -INT32_C(  2147398733) },
+      { -INT32_C(   148796926), -INT32_C(  1545029124), -INT32_C(   207954552), -INT32_C(  2033645184), -INT32_C(  1418745717),  INT32_C(  1919557664), -INT32_C(   559581710), -INT32_C(   591164759) },
+      {  INT32_C(  2113415397), -INT32_C(  1747011299), -INT32_C(   822507426), -INT32_C(  1204000035),  INT32_C(  1673330017),  INT32_C(   230589787),  INT32_C(   998938909),  INT32_C(  1131010235) },
+      { -INT32_C(  2147367164),  INT32_C(  2147428319), -INT32_C(   485021480),  INT32_C(   878334472), -INT32_C(  2147431854), -INT32_C(  2147455193), -INT32_C(  2147448421), -INT32_C(  2147380699) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i r = simde_mm256_dpbusds_avx_epi32(src, a, b);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_dpbusds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t b[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { { -INT32_C(  2147408481),  INT32_C(  2147478328),  INT32_C(  2147446818), -INT32_C(   742876690),  INT32_C(  1593528212), -INT32_C(  2147447901), -INT32_C(  2147471953), -INT32_C(  2147468045) },
+      UINT8_C(220),
+      { -INT32_C(  1050188892),  INT32_C(   646963248),  INT32_C(  1094265332),  INT32_C(   943242605), -INT32_C(  1453233766), -INT32_C(   844625852),  INT32_C(   775993750),  INT32_C(   414127536) },
+      {  INT32_C(  1333256381), -INT32_C(   185489771),  INT32_C(   193916223),  INT32_C(  1675378413),  INT32_C(  1396136233), -INT32_C(   371661051), -INT32_C(  1616588828), -INT32_C(  1566977484) },
+      { -INT32_C(  2147408481),  INT32_C(  2147478328),  INT32_C(  2147455628), -INT32_C(   742863515),  INT32_C(  1593563233), -INT32_C(  2147447901),              INT32_MIN, -INT32_C(  2147480140) } },
+    { {  INT32_C(  1077453627), -INT32_C(  2118615438), -INT32_C(   848583678), -INT32_C(  2147402888), -INT32_C(  2147420782),  INT32_C(  2147478434),  INT32_C(  2147462474),  INT32_C(  2147401695) },
+      UINT8_C(130),
+      {  INT32_C(  2139916280), -INT32_C(   454069445), -INT32_C(  1623468879), -INT32_C(   925390258),  INT32_C(   679943977), -INT32_C(   726807534), -INT32_C(  1135720253), -INT32_C(  2090229589) },
+      { -INT32_C(  1376375647),  INT32_C(   889794474),  INT32_C(   899330885), -INT32_C(  1058817813), -INT32_C(  1059717415), -INT32_C(   644169443), -INT32_C(   592507430), -INT32_C(   849631559) },
+      {  INT32_C(  1077453627), -INT32_C(  2118600872), -INT32_C(   848583678), -INT32_C(  2147402888), -INT32_C(  2147420782),  INT32_C(  2147478434),  INT32_C(  2147462474),  INT32_C(  2147378028) } },
+    { {  INT32_C(  2147467421), -INT32_C(  2147456808), -INT32_C(  1745180208),  INT32_C(    94908432), -INT32_C(  2147456223), -INT32_C(  1537553125), -INT32_C(  1319959249), -INT32_C(  1208952916) },
+      UINT8_C( 23),
+      { -INT32_C(  1738003835),  INT32_C(  1571450501), -INT32_C(    87589055), -INT32_C(   346996971),  INT32_C(   411265926), -INT32_C(  1563083806), -INT32_C(  1998496451), -INT32_C(   112636573) },
+      { -INT32_C(  1539398160),  INT32_C(  1341688167), -INT32_C(   153793769),  INT32_C(  2028293911),  INT32_C(  1795652042), -INT32_C(  1642934947), -INT32_C(  1549913379),  INT32_C(  1470290912) },
+      {  INT32_C(  2147453935), -INT32_C(  2147450212), -INT32_C(  1745180245),  INT32_C(    94908432), -INT32_C(  2147447027), -INT32_C(  1537553125), -INT32_C(  1319959249), -INT32_C(  1208952916) } },
+    { {  INT32_C(  1675525803), -INT32_C(  2147466438),  INT32_C(  2147442948),  INT32_C(  2147447697), -INT32_C(  2147476767), -INT32_C(   327899365),  INT32_C(  1559836499), -INT32_C(  2147420336) },
+      UINT8_C(164),
+      {  INT32_C(   674255912),  INT32_C(  1894342642), -INT32_C(  1568154004),  INT32_C(  1051014939),  INT32_C(   973530508), -INT32_C(  1556395610),  INT32_C(  1121180284),  INT32_C(   129646156) },
+      {  INT32_C(   498251589),  INT32_C(  1580875485),  INT32_C(  2127130578), -INT32_C(  1734524460), -INT32_C(  1952932585), -INT32_C(  1372565930),  INT32_C(   223946539), -INT32_C(   964814633) },
+      {  INT32_C(  1675525803), -INT32_C(  2147466438),  INT32_C(  2147475609),  INT32_C(  2147447697), -INT32_C(  2147476767), -INT32_C(   327889929),  INT32_C(  1559836499), -INT32_C(  2147398934) } },
+    { {  INT32_C(  1138504780),  INT32_C(  2147430512), -INT32_C(  1053819390), -INT32_C(  2147418523), -INT32_C(  2147419603),  INT32_C(  2147448011), -INT32_C(   686451624),  INT32_C(  1520786416) },
+      UINT8_C(153),
+      { -INT32_C(  1615022281),  INT32_C(  1280229878),  INT32_C(  1769190438), -INT32_C(   454711149), -INT32_C(  1210034445),  INT32_C(  1571585064), -INT32_C(  1861415555),  INT32_C(  1288904618) },
+      { -INT32_C(  1486654512), -INT32_C(  1355865116),  INT32_C(   806922724),  INT32_C(   395086316), -INT32_C(  1293168963),  INT32_C(   869933697),  INT32_C(  1599457483),  INT32_C(   198454463) },
+      {  INT32_C(  1138527646),  INT32_C(  2147430512), -INT32_C(  1053819390), -INT32_C(  2147462775), -INT32_C(  2147459162),  INT32_C(  2147448011), -INT32_C(   686451624),  INT32_C(  1520768282) } },
+    { {  INT32_C(   542527592),  INT32_C(  2147451833),  INT32_C(    15833817), -INT32_C(  2147402801),  INT32_C(  1879456824),  INT32_C(   853092232),  INT32_C(   124474830), -INT32_C(  2147431701) },
+      UINT8_C(  8),
+      {  INT32_C(  1565241549), -INT32_C(   936316615), -INT32_C(    64989543),  INT32_C(   244398879), -INT32_C(  1186640404),  INT32_C(   759534154), -INT32_C(  1405714807),  INT32_C(   580717371) },
+      { -INT32_C(   376137967), -INT32_C(   615654828),  INT32_C(  1513634358), -INT32_C(    83541596), -INT32_C(  2107706374),  INT32_C(   287781723),  INT32_C(  1268546253),  INT32_C(  1177579193) },
+      {  INT32_C(   542527592),  INT32_C(  2147451833),  INT32_C(    15833817), -INT32_C(  2147401163),  INT32_C(  1879456824),  INT32_C(   853092232),  INT32_C(   124474830), -INT32_C(  2147431701) } },
+    { {  INT32_C(   864556544),  INT32_C(  2147384972),  INT32_C(    15187044), -INT32_C(   836888988), -INT32_C(  2147430717), -INT32_C(  2147456809),  INT32_C(  2147416421),  INT32_C(  2147440200) },
+      UINT8_C(161),
+      {  INT32_C(  2034078802),  INT32_C(  2043950777), -INT32_C(   432091843),  INT32_C(   442691423),  INT32_C(  1759202746), -INT32_C(  1588750826),  INT32_C(  1646309844), -INT32_C(  2104118238) },
+      { -INT32_C(   771475848),  INT32_C(   817312043),  INT32_C(  1540411384), -INT32_C(  1649245341),  INT32_C(  1139064816),  INT32_C(   713402013),  INT32_C(  1433341324), -INT32_C(   785835669) },
+      {  INT32_C(   864569054),  INT32_C(  2147384972),  INT32_C(    15187044), -INT32_C(   836888988), -INT32_C(  2147430717), -INT32_C(  2147475196),  INT32_C(  2147416421),  INT32_C(  2147448337) } },
+    { {  INT32_C(  2147390798),  INT32_C(  2147387700),  INT32_C(  2147434712), -INT32_C(  1804710396), -INT32_C(  1118330139),  INT32_C(  2147426195),  INT32_C(  2147458185), -INT32_C(   797935000) },
+      UINT8_C( 99),
+      {  INT32_C(  1535903417), -INT32_C(   316845705),  INT32_C(  2138818604), -INT32_C(   402912587),  INT32_C(  1225467848),  INT32_C(  1905033511),  INT32_C(  2129241315),  INT32_C(  1149473374) },
+      {  INT32_C(   641889392), -INT32_C(   603300334),  INT32_C(  1379811979), -INT32_C(  1762811362),  INT32_C(  1097811231), -INT32_C(   246421343), -INT32_C(  2076295094), -INT32_C(  1719691557) },
+      {  INT32_C(  2147424912),  INT32_C(  2147389214),  INT32_C(  2147434712), -INT32_C(  1804710396), -INT32_C(  1118330139),  INT32_C(  2147428759),  INT32_C(  2147483647), -INT32_C(   797935000) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i r = simde_mm256_mask_dpbusds_epi32(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_dpbusds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t src[8];
+    const int32_t a[8];
+    const int32_t b[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { UINT8_C(143),
+      {  INT32_C(  2147436962),  INT32_C(  2147468934), -INT32_C(   325491318),  INT32_C(  1590811335),  INT32_C(  1039199174), -INT32_C(   873831707),  INT32_C(  2147442232),  INT32_C(  1015655579) },
+      {  INT32_C(  2004681130), -INT32_C(  1787489425), -INT32_C(   203804620),  INT32_C(  2140309402),  INT32_C(  1250640663),  INT32_C(   353832842), -INT32_C(   667233931),  INT32_C(  1233397445) },
+      {  INT32_C(  1528641496), -INT32_C(   418398989),  INT32_C(   451093476), -INT32_C(  1813500928), -INT32_C(   176124982),  INT32_C(   980088788),  INT32_C(   412437998),  INT32_C(   531670940) },
+      {  INT32_C(  2147444671),  INT32_C(  2147464229), -INT32_C(   325491098),  INT32_C(  1590799928),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1015624200) } },
+    { UINT8_C(248),
+      {  INT32_C(  1750869759),  INT32_C(   691351498),  INT32_C(  2147441517), -INT32_C(  2147459414), -INT32_C(  2147404424), -INT32_C(  2147446065), -INT32_C(  1736792713),  INT32_C(  1134470493) },
+      {  INT32_C(  1290270423), -INT32_C(   312799288),  INT32_C(   757429642), -INT32_C(   986856287), -INT32_C(  1049139782),  INT32_C(  1500586906), -INT32_C(  1269274417),  INT32_C(  1076787845) },
+      { -INT32_C(  2026656097),  INT32_C(   238436438), -INT32_C(   913546224), -INT32_C(  1325989480), -INT32_C(  1533694817),  INT32_C(   619399473), -INT32_C(  1055794078), -INT32_C(   726552034) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),              INT32_MIN, -INT32_C(  2147461439), -INT32_C(  2147435133), -INT32_C(  1736786015),  INT32_C(  1134458517) } },
+    { UINT8_C(160),
+      { -INT32_C(  2147445662),  INT32_C(  1324027673), -INT32_C(  2147476705),  INT32_C(  2147440326),  INT32_C(  2147448743),  INT32_C(   745955906),  INT32_C(  2147440155), -INT32_C(   975272607) },
+      {  INT32_C(   286099609),  INT32_C(   737546931),  INT32_C(   256492221),  INT32_C(  1927380247),  INT32_C(   693733396),  INT32_C(  1362209499), -INT32_C(  1297662707), -INT32_C(   538144979) },
+      {  INT32_C(   360146199),  INT32_C(  1497487521), -INT32_C(  1455471851),  INT32_C(  2010403392),  INT32_C(   380185377), -INT32_C(  1601221198),  INT32_C(  1644986625),  INT32_C(  1440915332) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   745938601),  INT32_C(           0), -INT32_C(   975280183) } },
+    { UINT8_C( 95),
+      { -INT32_C(  2147476709), -INT32_C(  2147419635), -INT32_C(  2147472080), -INT32_C(   273516518), -INT32_C(  2147458593), -INT32_C(  1214492614), -INT32_C(  1079445024), -INT32_C(  2147451159) },
+      {  INT32_C(   598527267), -INT32_C(   708657359), -INT32_C(    17189852), -INT32_C(   152882843), -INT32_C(  1367558387), -INT32_C(   239952109),  INT32_C(  1981087106),  INT32_C(  1454199734) },
+      { -INT32_C(  1648623399), -INT32_C(  1788513824), -INT32_C(   295803888),  INT32_C(  1123128499), -INT32_C(  1645025802),  INT32_C(   553768982), -INT32_C(  1634655451),  INT32_C(  1517860645) },
+      {              INT32_MIN, -INT32_C(  2147402817), -INT32_C(  2147434670), -INT32_C(   273516756), -INT32_C(  2147482626),  INT32_C(           0), -INT32_C(  1079445143),  INT32_C(           0) } },
+    { UINT8_C( 67),
+      {  INT32_C(   220151663), -INT32_C(  1965303557), -INT32_C(  2147390145),  INT32_C(  2101426124), -INT32_C(   874713281), -INT32_C(   150231034), -INT32_C(  2147480901),  INT32_C(  1206036370) },
+      {  INT32_C(  1326141376), -INT32_C(   256140621), -INT32_C(   860519175),  INT32_C(   954178201),  INT32_C(   930213420), -INT32_C(  1182254873),  INT32_C(  1768917080), -INT32_C(  1825974121) },
+      {  INT32_C(  1518450377),  INT32_C(  1038650298),  INT32_C(  1843047237),  INT32_C(  1513283347), -INT32_C(   262632984),  INT32_C(   903123299),  INT32_C(  1218773291),  INT32_C(  1247551560) },
+      {  INT32_C(   220140970), -INT32_C(  1965323953),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  2147479522),  INT32_C(           0) } },
+    { UINT8_C( 69),
+      { -INT32_C(  1283188505), -INT32_C(   208737332),  INT32_C(   444931006), -INT32_C(  2147422580), -INT32_C(  2147384835),  INT32_C(  2147419866),  INT32_C(  1274697840),  INT32_C(  2147422951) },
+      { -INT32_C(   659824032), -INT32_C(   937417047),  INT32_C(   405283549),  INT32_C(  2037243398), -INT32_C(   682281693),  INT32_C(   669043656), -INT32_C(   608163185),  INT32_C(  1404835372) },
+      { -INT32_C(   955154621),  INT32_C(   622676384), -INT32_C(   183653669),  INT32_C(  1395864450), -INT32_C(  2047717163), -INT32_C(  1362513826),  INT32_C(  1801040093), -INT32_C(  1517004125) },
+      { -INT32_C(  1283162776),  INT32_C(           0),  INT32_C(   444920161),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1274729996),  INT32_C(           0) } },
+    { UINT8_C( 38),
+      {  INT32_C(  2147397001),  INT32_C(   802074985),  INT32_C(  1607501181),  INT32_C(  2147410137), -INT32_C(  2147447263),  INT32_C(  2147459956),  INT32_C(  2147392002),  INT32_C(  2147397878) },
+      {  INT32_C(   119492584),  INT32_C(   634016445),  INT32_C(  1042207543), -INT32_C(  1670754702), -INT32_C(  1716894033),  INT32_C(   247677340), -INT32_C(  1285169546), -INT32_C(   768078260) },
+      { -INT32_C(  1893264484), -INT32_C(  1218356742),  INT32_C(  1541677090),  INT32_C(  1998804755),  INT32_C(  1323782401),  INT32_C(   789284942),  INT32_C(   296414501),  INT32_C(   460787983) },
+      {  INT32_C(           0),  INT32_C(   802098042),  INT32_C(  1607514605),  INT32_C(           0),  INT32_C(           0),  INT32_C(  2147467127),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(207),
+      { -INT32_C(  2147437540), -INT32_C(  1294244029),  INT32_C(  2147464921), -INT32_C(  2147457564), -INT32_C(   782297769),  INT32_C(   120417698), -INT32_C(   207311103),  INT32_C(  1314706344) },
+      { -INT32_C(  1781112258), -INT32_C(   439332238),  INT32_C(  1536618464), -INT32_C(   353276105), -INT32_C(  1395439313), -INT32_C(  1053227233), -INT32_C(  1710447654),  INT32_C(   239135071) },
+      { -INT32_C(   447668270),  INT32_C(  1171265638), -INT32_C(  1345388705), -INT32_C(  1328729714), -INT32_C(  2096372025),  INT32_C(   815209456),  INT32_C(   275569628), -INT32_C(   216013816) },
+      { -INT32_C(  2147424043), -INT32_C(  1294224616),  INT32_C(  2147471091),              INT32_MIN,  INT32_C(           0),  INT32_C(           0), -INT32_C(   207321222),  INT32_C(  1314702382) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i r = simde_mm256_maskz_dpbusds_epi32(test_vec[i].k, src, a, b);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_dpbusds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const int32_t a[16];
+    const int32_t b[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { { -INT32_C(  1612265036), -INT32_C(   619851180),  INT32_C(  2147436910), -INT32_C(  2147402250), -INT32_C(  2147454028),  INT32_C(  2147393617), -INT32_C(  1747971002), -INT32_C(  2147432999),
+         INT32_C(  1317793993), -INT32_C(  1627054092), -INT32_C(  2129563684),  INT32_C(   753347520), -INT32_C(  1303641556), -INT32_C(  2147407503), -INT32_C(  1173690888),  INT32_C(  1566286069) },
+      {  INT32_C(  1116168989), -INT32_C(  1313312760), -INT32_C(    88904824), -INT32_C(  2022845291), -INT32_C(   421967468),  INT32_C(  1290127027), -INT32_C(  1982939768),  INT32_C(  1364959782),
+        -INT32_C(  1217166093),  INT32_C(  1675149266),  INT32_C(   351926487),  INT32_C(   722409876), -INT32_C(   422227083), -INT32_C(  1818843895), -INT32_C(   207428616),  INT32_C(   109929420) },
+      {  INT32_C(  1930689150), -INT32_C(  1136504099),  INT32_C(   461941073), -INT32_C(   799652097),  INT32_C(   979775697), -INT32_C(  1020150152), -INT32_C(  1440468884),  INT32_C(   749846151),
+        -INT32_C(  1637551738), -INT32_C(  1630422283),  INT32_C(  1099082101),  INT32_C(   903646543), -INT32_C(  1704528121), -INT32_C(  1471932183), -INT32_C(   628810433),  INT32_C(   575551669) },
+      { -INT32_C(  1612251821), -INT32_C(   619842168),  INT32_C(  2147423887), -INT32_C(  2147384665), -INT32_C(  2147422006),  INT32_C(  2147408614), -INT32_C(  1747951608), -INT32_C(  2147451914),
+         INT32_C(  1317755933), -INT32_C(  1627089626), -INT32_C(  2129590179),  INT32_C(   753358076), -INT32_C(  1303643218), -INT32_C(  2147406486), -INT32_C(  1173697841),  INT32_C(  1566287515) } },
+    { { -INT32_C(  1243196882), -INT32_C(  1026991704),  INT32_C(  2147474242), -INT32_C(  1508751274), -INT32_C(  2147443095), -INT32_C(  1147228686),  INT32_C(  2147401062), -INT32_C(    78026864),
+        -INT32_C(  2147451186),  INT32_C(   752079605), -INT32_C(   837380634), -INT32_C(  2147404993), -INT32_C(  2147425232), -INT32_C(  2147400142), -INT32_C(  1707284526),  INT32_C(   982083849) },
+      { -INT32_C(  1634346944),  INT32_C(   668777275),  INT32_C(   899044489),  INT32_C(  1794736265), -INT32_C(    53238784), -INT32_C(  1845455611),  INT32_C(  2042666807),  INT32_C(   128365947),
+        -INT32_C(  1750318415),  INT32_C(   336465424), -INT32_C(  2113239168),  INT32_C(  1927922825), -INT32_C(   589082692),  INT32_C(  1536610627), -INT32_C(  1335696037), -INT32_C(  1052644723) },
+      { -INT32_C(  1828204954), -INT32_C(  1493829104), -INT32_C(  1848480619), -INT32_C(   502110620), -INT32_C(  1784479947), -INT32_C(  1761490884),  INT32_C(   721245136),  INT32_C(   291054464),
+        -INT32_C(    33546499), -INT32_C(   791081099), -INT32_C(   213010797), -INT32_C(   940529172), -INT32_C(  1526381152),  INT32_C(  2084572280), -INT32_C(  2091825180),  INT32_C(  1041367108) },
+      { -INT32_C(  1243217333), -INT32_C(  1026997812),  INT32_C(  2147455872), -INT32_C(  1508723216),              INT32_MIN, -INT32_C(  1147252060),  INT32_C(  2147416125), -INT32_C(    78021380),
+        -INT32_C(  2147450039),  INT32_C(   752080181), -INT32_C(   837405496), -INT32_C(  2147435011), -INT32_C(  2147456714), -INT32_C(  2147368710), -INT32_C(  1707284877),  INT32_C(   982106573) } },
+    { {  INT32_C(  2147406206), -INT32_C(   331956373), -INT32_C(  2147405476), -INT32_C(  2147481229), -INT32_C(  1799156939),  INT32_C(   643880715), -INT32_C(  2147395855), -INT32_C(  2147424450),
+         INT32_C(   516239227), -INT32_C(  2147456887), -INT32_C(  1461214591),  INT32_C(  1109955439),  INT32_C(  2147425521), -INT32_C(  2147412724), -INT32_C(    84980925),  INT32_C(  1712988405) },
+      { -INT32_C(  2048654812), -INT32_C(  1999676464),  INT32_C(   872870731), -INT32_C(   288115626),  INT32_C(  1851968769), -INT32_C(   723788720), -INT32_C(  1535034075),  INT32_C(   975610177),
+        -INT32_C(   750571638), -INT32_C(  1628762214),  INT32_C(  1765883185), -INT32_C(   270894917), -INT32_C(   572625340), -INT32_C(    30527920), -INT32_C(   853862047),  INT32_C(   548097926) },
+      {  INT32_C(   678743034),  INT32_C(   190521302),  INT32_C(   175012559),  INT32_C(   703394734), -INT32_C(  1282480857),  INT32_C(  1415583760), -INT32_C(   911569960), -INT32_C(   540489766),
+         INT32_C(  2019558998),  INT32_C(   296758384),  INT32_C(  1368704293),  INT32_C(   464453427), -INT32_C(   901473419),  INT32_C(  1126527791),  INT32_C(  1112684715), -INT32_C(  1792714360) },
+      {  INT32_C(  2147437652), -INT32_C(   331941955), -INT32_C(  2147378325),              INT32_MIN, -INT32_C(  1799182077),  INT32_C(   643926107), -INT32_C(  2147424586), -INT32_C(  2147440139),
+         INT32_C(   516283129), -INT32_C(  2147455093), -INT32_C(  1461214892),  INT32_C(  1109953433),  INT32_C(  2147425529), -INT32_C(  2147384954), -INT32_C(    84972026),  INT32_C(  1712982259) } },
+    { { -INT32_C(  2147408384),  INT32_C(  2147456056), -INT32_C(  2147464818), -INT32_C(  1802258308), -INT32_C(   875103965), -INT32_C(  2147395452),  INT32_C(  1698670196), -INT32_C(  2147389460),
+        -INT32_C(  2147483474),  INT32_C(  2147453755),  INT32_C(  2147418022), -INT32_C(  2147469413), -INT32_C(   977927531),  INT32_C(  2147467267), -INT32_C(   451464345),  INT32_C(  2113328054) },
+      { -INT32_C(    36673841), -INT32_C(   719220220), -INT32_C(  1714544086),  INT32_C(   597564966),  INT32_C(   730242345), -INT32_C(  1868964731), -INT32_C(  1980224347),  INT32_C(  1968120216),
+        -INT32_C(   548820233),  INT32_C(   829404182), -INT32_C(  1563300633),  INT32_C(  1471552661), -INT32_C(    87339225), -INT32_C(  1745079653), -INT32_C(  1511104926),  INT32_C(  1675670524) },
+      {  INT32_C(   931700607),  INT32_C(  1086263577),  INT32_C(  1679581790), -INT32_C(  2079524892),  INT32_C(  1202345671),  INT32_C(  1129122133), -INT32_C(   662343335),  INT32_C(   558889137),
+        -INT32_C(  1791276673),  INT32_C(  1300368412), -INT32_C(  2122334007), -INT32_C(  2065625638),  INT32_C(  1571217187),  INT32_C(   368877945), -INT32_C(  2008351929), -INT32_C(  1864651033) },
+      { -INT32_C(  2147403034),  INT32_C(  2147470125), -INT32_C(  2147436470), -INT32_C(  1802262086), -INT32_C(   875101271), -INT32_C(  2147360738),  INT32_C(  1698653869), -INT32_C(  2147391630),
+        -INT32_C(  2147459249),  INT32_C(  2147446318),  INT32_C(  2147396182),              INT32_MIN, -INT32_C(   977923793),  INT32_C(  2147483435), -INT32_C(   451460045),  INT32_C(  2113287700) } },
+    { {  INT32_C(  1907411870), -INT32_C(  1699531399),  INT32_C(  1020361481),  INT32_C(  1232586792),  INT32_C(  2147459821),  INT32_C(  2147389011), -INT32_C(  2147475553), -INT32_C(  2147472687),
+         INT32_C(  1606041805),  INT32_C(  1147805915), -INT32_C(  2147426783),  INT32_C(  1112713513), -INT32_C(   578390506), -INT32_C(  2147463525), -INT32_C(  2147454002),  INT32_C(   965931494) },
+      { -INT32_C(  1010907381), -INT32_C(   949275762),  INT32_C(   997180028), -INT32_C(  1143951069),  INT32_C(  1344805412), -INT32_C(  1142244472),  INT32_C(   773376386), -INT32_C(  1966652000),
+        -INT32_C(  1690721589),  INT32_C(   381389934),  INT32_C(  1153673330), -INT32_C(   465513554),  INT32_C(  2085254893), -INT32_C(  1352797110), -INT32_C(   432118188), -INT32_C(  1934528215) },
+      { -INT32_C(   758383979),  INT32_C(   557678805),  INT32_C(  2116974303), -INT32_C(  1791815212),  INT32_C(  1436744082),  INT32_C(   463130461), -INT32_C(  1770598611),  INT32_C(  2131832143),
+        -INT32_C(  1760593077),  INT32_C(  2118577636),  INT32_C(   433455140), -INT32_C(   891997313), -INT32_C(  1214461683),  INT32_C(   419138050), -INT32_C(    69717990), -INT32_C(   232990822) },
+      {  INT32_C(  1907390459), -INT32_C(  1699530939),  INT32_C(  1020392821),  INT32_C(  1232578860),  INT32_C(  2147458719),  INT32_C(  2147373677), -INT32_C(  2147481596), -INT32_C(  2147436033),
+         INT32_C(  1606061536),  INT32_C(  1147816037), -INT32_C(  2147429169),  INT32_C(  1112731308), -INT32_C(   578410367),              INT32_MIN, -INT32_C(  2147450552),  INT32_C(   965925675) } },
+    { { -INT32_C(  2147402850),  INT32_C(  2147443583), -INT32_C(  1582166345),  INT32_C(  1552221594), -INT32_C(  2147421203),  INT32_C(  2115396351), -INT32_C(   668573598), -INT32_C(   996707541),
+         INT32_C(  2147458101), -INT32_C(  2147390676), -INT32_C(  2147405799), -INT32_C(  2147452215), -INT32_C(  2147465517), -INT32_C(  1456133305),  INT32_C(  1872421776),  INT32_C(   101602463) },
+      {  INT32_C(   670355422), -INT32_C(   476702539),  INT32_C(   800878678), -INT32_C(   525496081), -INT32_C(   843384963), -INT32_C(  1028139486),  INT32_C(    22117161), -INT32_C(   621728433),
+        -INT32_C(   686696201), -INT32_C(   557644900),  INT32_C(   805860083), -INT32_C(   849499024), -INT32_C(  1577168344), -INT32_C(  1154494392), -INT32_C(   563606408),  INT32_C(  1623548207) },
+      {  INT32_C(   791910916),  INT32_C(   132957553),  INT32_C(   452809043), -INT32_C(   580445756),  INT32_C(   737703518),  INT32_C(   184886555), -INT32_C(  1857204465), -INT32_C(   634345044),
+         INT32_C(   458999037),  INT32_C(   108564769), -INT32_C(   783868932), -INT32_C(  1658615692), -INT32_C(  1903453596),  INT32_C(  1538940133),  INT32_C(  2097895691),  INT32_C(   835340533) },
+      { -INT32_C(  2147408799),  INT32_C(  2147461209), -INT32_C(  1582149477),  INT32_C(  1552220833), -INT32_C(  2147372980),  INT32_C(  2115408236), -INT32_C(   668557140), -INT32_C(   996714808),
+         INT32_C(  2147451752), -INT32_C(  2147361129), -INT32_C(  2147405381), -INT32_C(  2147476903),              INT32_MIN, -INT32_C(  1456102386),  INT32_C(  1872453058),  INT32_C(   101602996) } },
+    { {  INT32_C(  2147461551), -INT32_C(  2147440600),  INT32_C(  2147463974), -INT32_C(  2147446314), -INT32_C(  2088724731),  INT32_C(  2147482376), -INT32_C(  2147393544), -INT32_C(  2147414630),
+         INT32_C(  2147431293), -INT32_C(  1966478623),  INT32_C(   443318587),  INT32_C(  2147431374), -INT32_C(   789764210), -INT32_C(  2147424350), -INT32_C(  2147409570), -INT32_C(  2147453354) },
+      { -INT32_C(  1521543379),  INT32_C(   645531772),  INT32_C(   841643112), -INT32_C(   458025550), -INT32_C(   995649315),  INT32_C(  1391429373),  INT32_C(  1806065676),  INT32_C(  2124236059),
+         INT32_C(  1793583674), -INT32_C(  1872732140),  INT32_C(   455429377),  INT32_C(  1110712963), -INT32_C(  1099411344), -INT32_C(   633964843),  INT32_C(  1413643907),  INT32_C(   255062592) },
+      { -INT32_C(  1651186905), -INT32_C(  1484210798), -INT32_C(   352352148),  INT32_C(   844761811), -INT32_C(  1003176982),  INT32_C(  1750907165),  INT32_C(   148180872),  INT32_C(   502015602),
+         INT32_C(   421752179),  INT32_C(  1877763293), -INT32_C(   597162867),  INT32_C(   311388541),  INT32_C(  1516403320),  INT32_C(  2096217102),  INT32_C(  1017246810),  INT32_C(   576360924) },
+      {  INT32_C(  2147437772), -INT32_C(  2147472798),  INT32_C(  2147460144), -INT32_C(  2147426604), -INT32_C(  2088743157),  INT32_C(  2147483647), -INT32_C(  2147399826), -INT32_C(  2147408416),
+         INT32_C(  2147474204), -INT32_C(  1966455659),  INT32_C(   443321656),  INT32_C(  2147446631), -INT32_C(   789712150), -INT32_C(  2147403170), -INT32_C(  2147400522), -INT32_C(  2147477420) } },
+    { {  INT32_C(  2147401381),  INT32_C(   353842106),  INT32_C(  2147425389), -INT32_C(   831747211), -INT32_C(  2147385357), -INT32_C(  2147447486),  INT32_C(  2147453488), -INT32_C(  1141104514),
+        -INT32_C(  1911247884), -INT32_C(  2147472275),  INT32_C(  1247210777),  INT32_C(  1228088200), -INT32_C(  2147453508),  INT32_C(  2147403926), -INT32_C(   499595931), -INT32_C(  2147431393) },
+      {  INT32_C(   743974400), -INT32_C(   303506558), -INT32_C(   698066906),  INT32_C(   599970667),  INT32_C(   540824719), -INT32_C(  1904809004), -INT32_C(   207052455), -INT32_C(  1274618904),
+        -INT32_C(   535253245),  INT32_C(  1653954935),  INT32_C(  1571976192),  INT32_C(   480075529), -INT32_C(  1808880646), -INT32_C(  1392438493),  INT32_C(  2136294350), -INT32_C(   273235111) },
+      {  INT32_C(  1043086442), -INT32_C(  2034278422), -INT32_C(  1240026299), -INT32_C(  1249051383),  INT32_C(   183846310), -INT32_C(  1789164006),  INT32_C(   456379492), -INT32_C(  1224131221),
+         INT32_C(  1419614766), -INT32_C(  1895868500), -INT32_C(  1188589941),  INT32_C(   703752824), -INT32_C(   394879197), -INT32_C(   381300553),  INT32_C(   325145014), -INT32_C(    38351521) },
+      {  INT32_C(  2147410261),  INT32_C(   353816057),  INT32_C(  2147407599), -INT32_C(   831772010), -INT32_C(  2147392771), -INT32_C(  2147475100),  INT32_C(  2147469145), -INT32_C(  1141079417),
+        -INT32_C(  1911249156),              INT32_MIN,  INT32_C(  1247197892),  INT32_C(  1228098300), -INT32_C(  2147459469),  INT32_C(  2147396549), -INT32_C(   499595090), -INT32_C(  2147447068) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi32(test_vec[i].b);
+    simde__m512i r = simde_mm512_dpbusds_epi32(src, a, b);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_dpbusds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t b[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { {  INT32_C(   992814921), -INT32_C(   846169431),  INT32_C(   532609996),  INT32_C(  2147478778),  INT32_C(  2147440631),  INT32_C(  2147471161), -INT32_C(  2147414796),  INT32_C(   681819206),
+        -INT32_C(  2147473179),  INT32_C(   364913736),  INT32_C(  2147410774),  INT32_C(  2147429710),  INT32_C(  2147471625), -INT32_C(  2147408153),  INT32_C(   737330136), -INT32_C(  2147467113) },
+      UINT16_C( 4586),
+      {  INT32_C(    92411577),  INT32_C(   591873375), -INT32_C(  1346964609), -INT32_C(  1222286392), -INT32_C(  1970054710), -INT32_C(  1847708975), -INT32_C(   765430204), -INT32_C(  1646472949),
+        -INT32_C(   454035884), -INT32_C(  1291355291),  INT32_C(   441996854),  INT32_C(  1744307786),  INT32_C(   298340493),  INT32_C(   240399567),  INT32_C(  1898662340), -INT32_C(  2046259947) },
+      {  INT32_C(  2126999359),  INT32_C(   255677894), -INT32_C(   206511239), -INT32_C(    57342468),  INT32_C(   829496615), -INT32_C(  1882698107), -INT32_C(  2019231754), -INT32_C(  1132087686),
+        -INT32_C(  2011522271),  INT32_C(   710179001),  INT32_C(  1774751654),  INT32_C(   718372133),  INT32_C(   354143810), -INT32_C(   789218957),  INT32_C(   675155679),  INT32_C(  2070254616) },
+      {  INT32_C(   992814921), -INT32_C(   846164220),  INT32_C(   532609996),  INT32_C(  2147473782),  INT32_C(  2147440631),  INT32_C(  2147420537), -INT32_C(  2147450780),  INT32_C(   681767346),
+                     INT32_MIN,  INT32_C(   364913736),  INT32_C(  2147410774),  INT32_C(  2147429710),  INT32_C(  2147482688), -INT32_C(  2147408153),  INT32_C(   737330136), -INT32_C(  2147467113) } },
+    { { -INT32_C(  2147459906), -INT32_C(  2084648169),  INT32_C(  2147454318),  INT32_C(  1868940021), -INT32_C(  2147470957), -INT32_C(  2147452169), -INT32_C(  2147483000),  INT32_C(   979695488),
+         INT32_C(  1650239394),  INT32_C(  2147452769), -INT32_C(   541405746), -INT32_C(   514358214),  INT32_C(   703079434),  INT32_C(  2005803765), -INT32_C(   588573339),  INT32_C(  1443412803) },
+      UINT16_C(19994),
+      {  INT32_C(  1688986720), -INT32_C(   488527844),  INT32_C(  1775646361), -INT32_C(  1840458453),  INT32_C(  1291421873),  INT32_C(   666118700), -INT32_C(   910795527),  INT32_C(  1362194328),
+         INT32_C(   415232225), -INT32_C(   568298430), -INT32_C(  1346044593), -INT32_C(   133124650),  INT32_C(   744268579),  INT32_C(   199412726),  INT32_C(  1989664919), -INT32_C(   944856622) },
+      {  INT32_C(  1864360010),  INT32_C(  1294671171),  INT32_C(   826656449),  INT32_C(   390845137), -INT32_C(  1494008979), -INT32_C(  1438501147), -INT32_C(  1364354927), -INT32_C(   697534253),
+        -INT32_C(  1914432851),  INT32_C(  1774476852),  INT32_C(   763513077), -INT32_C(  1701088429),  INT32_C(  1273637557),  INT32_C(  1664743063),  INT32_C(   170019975), -INT32_C(  1570980972) },
+      { -INT32_C(  2147459906), -INT32_C(  2084614344),  INT32_C(  2147454318),  INT32_C(  1868937260), -INT32_C(  2147453717), -INT32_C(  2147452169), -INT32_C(  2147483000),  INT32_C(   979695488),
+         INT32_C(  1650239394),  INT32_C(  2147483647), -INT32_C(   541405220), -INT32_C(   514347469),  INT32_C(   703079434),  INT32_C(  2005803765), -INT32_C(   588568272),  INT32_C(  1443412803) } },
+    { {  INT32_C(  2147428637), -INT32_C(  1072160648),  INT32_C(  1731712147), -INT32_C(  2147410881), -INT32_C(  2147483320),  INT32_C(  2147445130),  INT32_C(  2147467720),  INT32_C(  1605507725),
+        -INT32_C(   366956233),  INT32_C(  1193376107), -INT32_C(   931650869),  INT32_C(  2147431329),  INT32_C(  2147392501),  INT32_C(   307505666),  INT32_C(   241311294), -INT32_C(  2147441058) },
+      UINT16_C(61001),
+      {  INT32_C(  1059523550),  INT32_C(   152249125),  INT32_C(   698637995), -INT32_C(  1016373891), -INT32_C(  1952573358),  INT32_C(  1682999776),  INT32_C(   978455060), -INT32_C(   237854826),
+        -INT32_C(  1998870506),  INT32_C(  1169564905), -INT32_C(  1792711871), -INT32_C(  1089892264), -INT32_C(  1319293522), -INT32_C(   234326916), -INT32_C(   458801895), -INT32_C(  1589673761) },
+      { -INT32_C(  1334139444),  INT32_C(  1734714565), -INT32_C(  1496491195), -INT32_C(  1767810697), -INT32_C(  2079702905),  INT32_C(   419952791), -INT32_C(  1526653133), -INT32_C(  1212776028),
+        -INT32_C(  2114960852),  INT32_C(   904404534),  INT32_C(  1319610099), -INT32_C(   878396954), -INT32_C(  2093277256), -INT32_C(  1045638682), -INT32_C(   999643708), -INT32_C(  1925735239) },
+      {  INT32_C(  2147415810), -INT32_C(  1072160648),  INT32_C(  1731712147), -INT32_C(  2147418564), -INT32_C(  2147483320),  INT32_C(  2147445130),  INT32_C(  2147463854),  INT32_C(  1605507725),
+        -INT32_C(   366956233),  INT32_C(  1193389058), -INT32_C(   931652295),  INT32_C(  2147407866),  INT32_C(  2147392501),  INT32_C(   307481072),  INT32_C(   241308265),              INT32_MIN } },
+    { {  INT32_C(  1307624366), -INT32_C(  2147405579), -INT32_C(  2147410032), -INT32_C(   728149078),  INT32_C(  2147384191),  INT32_C(  2147421959),  INT32_C(  2147431251),  INT32_C(  2147416628),
+         INT32_C(  2147455701), -INT32_C(  2013644790), -INT32_C(  2147468671), -INT32_C(  2147452442),  INT32_C(  1721999942),  INT32_C(  2147476051),  INT32_C(  2147475299), -INT32_C(  1016647756) },
+      UINT16_C(18147),
+      {  INT32_C(  1887346088), -INT32_C(  1232649752),  INT32_C(  1858831503), -INT32_C(  1512167322), -INT32_C(  1869508068),  INT32_C(    98494303), -INT32_C(   121676975), -INT32_C(  1475868537),
+        -INT32_C(   505225857),  INT32_C(  2131851648), -INT32_C(   377683169),  INT32_C(  1132329498), -INT32_C(  2110194345), -INT32_C(  1654805329),  INT32_C(  1274170428), -INT32_C(   385147625) },
+      {  INT32_C(   855719382),  INT32_C(  1421551365), -INT32_C(  1533552528), -INT32_C(  1036779303), -INT32_C(   769881337),  INT32_C(  1225899773),  INT32_C(  1273816857),  INT32_C(  1140510469),
+         INT32_C(   270943377), -INT32_C(   308617336),  INT32_C(   459384934),  INT32_C(  1199411331),  INT32_C(  1323037367),  INT32_C(   131625478),  INT32_C(  2099627691), -INT32_C(  1025918247) },
+      {  INT32_C(  1307632725), -INT32_C(  2147395911), -INT32_C(  2147410032), -INT32_C(   728149078),  INT32_C(  2147384191),  INT32_C(  2147410567),  INT32_C(  2147445781),  INT32_C(  2147428119),
+         INT32_C(  2147455701), -INT32_C(  2013668290), -INT32_C(  2147447357), -INT32_C(  2147452442),  INT32_C(  1721999942),  INT32_C(  2147476051),  INT32_C(  2147483647), -INT32_C(  1016647756) } },
+    { { -INT32_C(  2147453690), -INT32_C(  2147454075), -INT32_C(    33510053),  INT32_C(   853662451),  INT32_C(   175044070),  INT32_C(  2147472523), -INT32_C(  2147397181),  INT32_C(  2147395766),
+        -INT32_C(   123794026),  INT32_C(  1502407477), -INT32_C(  1297880427),  INT32_C(   680870235), -INT32_C(  1682028466), -INT32_C(  2147445036),  INT32_C(  1373949753),  INT32_C(  1074545853) },
+      UINT16_C(14369),
+      {  INT32_C(   811342384),  INT32_C(  1044032958), -INT32_C(  2018056220), -INT32_C(   875529694), -INT32_C(   383015820), -INT32_C(  1790508050), -INT32_C(   866067496),  INT32_C(   560824989),
+        -INT32_C(   850933039),  INT32_C(  1580902904), -INT32_C(  1048417740),  INT32_C(   630863974),  INT32_C(    14745967), -INT32_C(  1983451766),  INT32_C(   227809822), -INT32_C(    42873161) },
+      {  INT32_C(  1926835602),  INT32_C(   837986726),  INT32_C(  1457771721), -INT32_C(  1034024434), -INT32_C(  1087958753),  INT32_C(  1225331600),  INT32_C(  1745644681), -INT32_C(  1527041600),
+         INT32_C(  2135534743), -INT32_C(  1255699293), -INT32_C(    33423252), -INT32_C(   763842181),  INT32_C(    11092753), -INT32_C(   946280980), -INT32_C(   257312720),  INT32_C(   495364433) },
+      { -INT32_C(  2147455916), -INT32_C(  2147454075), -INT32_C(    33510053),  INT32_C(   853662451),  INT32_C(   175044070),  INT32_C(  2147457440), -INT32_C(  2147397181),  INT32_C(  2147395766),
+        -INT32_C(   123794026),  INT32_C(  1502407477), -INT32_C(  1297880427),  INT32_C(   680895135), -INT32_C(  1682046087), -INT32_C(  2147482596),  INT32_C(  1373949753),  INT32_C(  1074545853) } },
+    { { -INT32_C(   110784321), -INT32_C(   604972140),  INT32_C(  2147483446), -INT32_C(  1241459218), -INT32_C(  2147451915), -INT32_C(  2147387500),  INT32_C(  2147414827),  INT32_C(  2147407200),
+         INT32_C(  2147451216), -INT32_C(  1131074098),  INT32_C(  2147477571), -INT32_C(  2147470143),  INT32_C(    60849230), -INT32_C(   188904301), -INT32_C(  2147435644),  INT32_C(  2147397891) },
+      UINT16_C(29910),
+      {  INT32_C(   549038120),  INT32_C(   704668796), -INT32_C(    13538866),  INT32_C(  1261795248),  INT32_C(    17516369), -INT32_C(  1548737367), -INT32_C(   672469528),  INT32_C(  1374835762),
+        -INT32_C(   368149843),  INT32_C(   968497359),  INT32_C(  1166286047),  INT32_C(  1342983373), -INT32_C(   312909382),  INT32_C(  1757257740),  INT32_C(  1270789100),  INT32_C(  1621065007) },
+      { -INT32_C(  1617656900), -INT32_C(    93541904),  INT32_C(   709906663), -INT32_C(  1254887326),  INT32_C(   516786766), -INT32_C(  1193943974), -INT32_C(  1890239715), -INT32_C(  2109311970),
+         INT32_C(   696952591), -INT32_C(   846440769), -INT32_C(    42220994),  INT32_C(  1244830144), -INT32_C(  1684919702),  INT32_C(   242796470),  INT32_C(  1144282692), -INT32_C(   997081036) },
+      { -INT32_C(   110784321), -INT32_C(   604983076),  INT32_C(  2147483647), -INT32_C(  1241459218), -INT32_C(  2147454506), -INT32_C(  2147387500),  INT32_C(  2147431133),  INT32_C(  2147425178),
+         INT32_C(  2147451216), -INT32_C(  1131074098),  INT32_C(  2147483647), -INT32_C(  2147470143),  INT32_C(    60839293), -INT32_C(   188890173), -INT32_C(  2147387790),  INT32_C(  2147397891) } },
+    { { -INT32_C(   514223546), -INT32_C(  2147455962),  INT32_C(   857853440),  INT32_C(  2147448164),  INT32_C(  1852502377), -INT32_C(   136786558), -INT32_C(   992511588),  INT32_C(  1054603481),
+         INT32_C(  2147391397),  INT32_C(   560824294),  INT32_C(  2147481516), -INT32_C(  2147421755), -INT32_C(  1567769871),  INT32_C(  2147435709),  INT32_C(  2141464245), -INT32_C(  2147482374) },
+      UINT16_C(50254),
+      {  INT32_C(  1657917970), -INT32_C(   393095660),  INT32_C(   226762901),  INT32_C(  1460761371), -INT32_C(  1506513175),  INT32_C(  1403673265),  INT32_C(    97842043), -INT32_C(  1232874363),
+         INT32_C(   608203403),  INT32_C(  2036432334), -INT32_C(  1218589521),  INT32_C(   347339378),  INT32_C(   599556518),  INT32_C(   327482139),  INT32_C(   103957173),  INT32_C(  1821986246) },
+      { -INT32_C(  1367726484),  INT32_C(  2045046093),  INT32_C(  1213757695),  INT32_C(  1487607288),  INT32_C(  1880522338),  INT32_C(  1689737678), -INT32_C(  1185045420), -INT32_C(   516208700),
+        -INT32_C(    43938706),  INT32_C(  1449680960),  INT32_C(   900502970),  INT32_C(   149226879), -INT32_C(  1971233340),  INT32_C(  1312039047),  INT32_C(   412830622), -INT32_C(  1548983196) },
+      { -INT32_C(   514223546), -INT32_C(  2147434476),  INT32_C(   857869683),  INT32_C(  2147456574),  INT32_C(  1852502377), -INT32_C(   136786558), -INT32_C(   992504251),  INT32_C(  1054603481),
+         INT32_C(  2147391397),  INT32_C(   560824294),  INT32_C(  2147449325), -INT32_C(  2147421755), -INT32_C(  1567769871),  INT32_C(  2147435709),  INT32_C(  2141446551), -INT32_C(  2147477770) } },
+    { { -INT32_C(  1540047041), -INT32_C(  1974197621),  INT32_C(  1511586111),  INT32_C(  1818658792),  INT32_C(  2147391393),  INT32_C(   847735242), -INT32_C(  1457529306), -INT32_C(  1762833994),
+        -INT32_C(  2147426619),  INT32_C(  2147433201), -INT32_C(  2147448764), -INT32_C(   862220798),  INT32_C(  2147457859), -INT32_C(  1494091105), -INT32_C(  2147443874),  INT32_C(  2147407550) },
+      UINT16_C(63440),
+      {  INT32_C(  1069738384),  INT32_C(   433983619),  INT32_C(   163498829),  INT32_C(  1077566157), -INT32_C(   805634074), -INT32_C(   655292968),  INT32_C(  2058689281), -INT32_C(  1133371852),
+        -INT32_C(  2007965921), -INT32_C(  1364879195), -INT32_C(  2016217313), -INT32_C(   497283014),  INT32_C(   205276841),  INT32_C(    15964786),  INT32_C(   532832806),  INT32_C(  2090302227) },
+      { -INT32_C(  1391461874),  INT32_C(  2050247718),  INT32_C(  1355150352), -INT32_C(  1976418760),  INT32_C(  1489438543),  INT32_C(  2067769916),  INT32_C(    87409829), -INT32_C(    42246333),
+         INT32_C(  2130126766),  INT32_C(  1518415756), -INT32_C(  1879525906),  INT32_C(  1944488404),  INT32_C(  1596657441),  INT32_C(   845828841),  INT32_C(  1597079442),  INT32_C(   206190329) },
+      { -INT32_C(  1540047041), -INT32_C(  1974197621),  INT32_C(  1511586111),  INT32_C(  1818658792),  INT32_C(  2147415314),  INT32_C(   847735242), -INT32_C(  1457520814), -INT32_C(  1762814202),
+        -INT32_C(  2147404048),  INT32_C(  2147415910),              INT32_MIN, -INT32_C(   862220798),  INT32_C(  2147468206), -INT32_C(  1494055341), -INT32_C(  2147423157),  INT32_C(  2147426721) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi32(test_vec[i].b);
+    simde__m512i r = simde_mm512_mask_dpbusds_epi32(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_dpbusds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t src[16];
+    const int32_t a[16];
+    const int32_t b[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { UINT16_C(54410),
+      { -INT32_C(  2147388763),  INT32_C(  2045247506),  INT32_C(   550627059), -INT32_C(  1064728548), -INT32_C(  1335461199), -INT32_C(  2147405835), -INT32_C(   924072340),  INT32_C(  2147407790),
+        -INT32_C(  2147392222),  INT32_C(   398476527),  INT32_C(  2147388169),  INT32_C(    20531485),  INT32_C(  2147460422), -INT32_C(  2147475851),  INT32_C(  1751552357),  INT32_C(  1074710526) },
+      { -INT32_C(  1585599382),  INT32_C(   235324824), -INT32_C(   148784598),  INT32_C(  2056382026),  INT32_C(   679957414), -INT32_C(   737409422),  INT32_C(   787429231),  INT32_C(  1339051620),
+         INT32_C(  1317923473), -INT32_C(  1677715380),  INT32_C(  1509062873),  INT32_C(  1754466075),  INT32_C(   779529674),  INT32_C(    58296384),  INT32_C(  1778939609),  INT32_C(  1571450908) },
+      { -INT32_C(   846300945),  INT32_C(   814159838), -INT32_C(  2076023714), -INT32_C(  1782678901),  INT32_C(   610322312),  INT32_C(  1783948700),  INT32_C(   214113746), -INT32_C(   874325068),
+        -INT32_C(  2085684774), -INT32_C(   649481704),  INT32_C(    12926400),  INT32_C(  1584695740), -INT32_C(   940556736), -INT32_C(   515831360),  INT32_C(  1335138736),  INT32_C(   359876905) },
+      {  INT32_C(           0),  INT32_C(  2045246815),  INT32_C(           0), -INT32_C(  1064731770),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  2147386877),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(  2147367323),  INT32_C(           0),  INT32_C(  2147479566),  INT32_C(           0),  INT32_C(  1751530353),  INT32_C(  1074741353) } },
+    { UINT16_C(38333),
+      {  INT32_C(  2147473713),  INT32_C(    58725386), -INT32_C(  2147457758),  INT32_C(  2147400265),  INT32_C(  2147423803), -INT32_C(  2147469544),  INT32_C(  2147419971),  INT32_C(   178063675),
+        -INT32_C(  2147384478), -INT32_C(  2147419633), -INT32_C(  2147430777), -INT32_C(  1056373945), -INT32_C(  1462514138), -INT32_C(  2147464146), -INT32_C(    57436090),  INT32_C(  2147402322) },
+      {  INT32_C(  1992294127),  INT32_C(  1640142768), -INT32_C(   934541095), -INT32_C(   825902345),  INT32_C(  2146225977), -INT32_C(  1390414189),  INT32_C(   323994682),  INT32_C(   270466419),
+        -INT32_C(  1052551786), -INT32_C(  1639126122), -INT32_C(  1022500713), -INT32_C(   160007088),  INT32_C(  1079778023), -INT32_C(   359054344),  INT32_C(  1314168701), -INT32_C(   349335972) },
+      {  INT32_C(  1254462072), -INT32_C(  1646209058), -INT32_C(   762585548), -INT32_C(  1624681685),  INT32_C(  1941232050),  INT32_C(   370043129), -INT32_C(  1232768594),  INT32_C(   923888939),
+         INT32_C(   828066055), -INT32_C(  2014539945),  INT32_C(  1282202616),  INT32_C(  1207477678),  INT32_C(  1390270687), -INT32_C(  1133882754), -INT32_C(   299827921), -INT32_C(  1855858465) },
+      {  INT32_C(  2147471916),  INT32_C(           0), -INT32_C(  2147464838),  INT32_C(  2147414419),  INT32_C(  2147407953), -INT32_C(  2147440749),  INT32_C(           0),  INT32_C(   178097587),
+        -INT32_C(  2147361669),  INT32_C(           0), -INT32_C(  2147424049),  INT32_C(           0), -INT32_C(  1462520773),  INT32_C(           0),  INT32_C(           0),  INT32_C(  2147371886) } },
+    { UINT16_C( 2907),
+      {  INT32_C(  2147404264), -INT32_C(   469057703),  INT32_C(  1480651031),  INT32_C(   219932744),  INT32_C(   345587573),  INT32_C(   491878830),  INT32_C(  2147482185), -INT32_C(  2147414557),
+        -INT32_C(   540228343),  INT32_C(  1842516434), -INT32_C(  2147406118),  INT32_C(  2147442260),  INT32_C(  1798649260), -INT32_C(   359329479), -INT32_C(  2147476171),  INT32_C(  2147470332) },
+      {  INT32_C(   746228184), -INT32_C(   541683290),  INT32_C(   159116364), -INT32_C(  2047426689), -INT32_C(  1979840414),  INT32_C(  1994202604),  INT32_C(  1147956346), -INT32_C(   279891998),
+        -INT32_C(   277521958),  INT32_C(   941773374), -INT32_C(  1588522066),  INT32_C(    96925130),  INT32_C(   466367671),  INT32_C(   160581857),  INT32_C(  2129251551),  INT32_C(  1899699618) },
+      {  INT32_C(  1964347615),  INT32_C(  1273115387),  INT32_C(   366750449), -INT32_C(  1259138227), -INT32_C(  1899389767),  INT32_C(   744894621),  INT32_C(  1682857082), -INT32_C(  1752012744),
+         INT32_C(   515972002), -INT32_C(  2010628052), -INT32_C(  1065472331), -INT32_C(   860135555), -INT32_C(  1779136681), -INT32_C(  2026271724),  INT32_C(  1911744906), -INT32_C(   546338125) },
+      {  INT32_C(  2147389502), -INT32_C(   469040018),  INT32_C(           0),  INT32_C(   219932846),  INT32_C(   345550227),  INT32_C(           0),  INT32_C(  2147483647),  INT32_C(           0),
+        -INT32_C(   540246633),  INT32_C(  1842519050),  INT32_C(           0),  INT32_C(  2147476863),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(32615),
+      {  INT32_C(   819268953),  INT32_C(  1171266124),  INT32_C(  1535819581), -INT32_C(  2147457473),  INT32_C(  1777367060),  INT32_C(  1633892121), -INT32_C(  2147400406),  INT32_C(  2147414818),
+        -INT32_C(  2147450872), -INT32_C(   142557282), -INT32_C(  2147461908),  INT32_C(   183751200),  INT32_C(  2147402056), -INT32_C(   204976489), -INT32_C(   871746482),  INT32_C(  1362094257) },
+      { -INT32_C(  1232358673), -INT32_C(   797690193),  INT32_C(   433112865),  INT32_C(  1296108297),  INT32_C(  1003540783), -INT32_C(  1057405653),  INT32_C(   966404259), -INT32_C(  1843071163),
+        -INT32_C(  2132682097),  INT32_C(   119617809),  INT32_C(  1027576459),  INT32_C(   942944457),  INT32_C(  1023648348), -INT32_C(  1984368771),  INT32_C(   307163620),  INT32_C(   152540282) },
+      {  INT32_C(   165946061), -INT32_C(   379764361), -INT32_C(   378852982), -INT32_C(   831101366),  INT32_C(   628171053), -INT32_C(  1813063917),  INT32_C(  1439990742),  INT32_C(  2128605887),
+        -INT32_C(  1233047670),  INT32_C(  1288684749),  INT32_C(  1931682782), -INT32_C(    75664081), -INT32_C(  1606644344),  INT32_C(    17524069),  INT32_C(   865870993),  INT32_C(    89741133) },
+      {  INT32_C(   819260562),  INT32_C(  1171296463),  INT32_C(  1535845527),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1633864699), -INT32_C(  2147414183),  INT32_C(           0),
+                     INT32_MIN, -INT32_C(   142562654), -INT32_C(  2147452304),  INT32_C(   183772483),  INT32_C(  2147366710), -INT32_C(   204937564), -INT32_C(   871769996),  INT32_C(           0) } },
+    { UINT16_C(17798),
+      {  INT32_C(  1788328077), -INT32_C(   194053170),  INT32_C(  2147454019),  INT32_C(   163607805), -INT32_C(  1673768809),  INT32_C(  2147401064),  INT32_C(  1302379831), -INT32_C(  2147402979),
+        -INT32_C(   145812125),  INT32_C(  2147477305), -INT32_C(  2147444619),  INT32_C(  1094520169),  INT32_C(  2147467920), -INT32_C(  2147403578), -INT32_C(  2147449785),  INT32_C(  2147457709) },
+      { -INT32_C(  2080221023), -INT32_C(  1368983291), -INT32_C(   126336289), -INT32_C(  1025928493),  INT32_C(   297465619), -INT32_C(  1809555269),  INT32_C(   811765115), -INT32_C(  1843359360),
+        -INT32_C(    15762139),  INT32_C(   537828814), -INT32_C(   560105484), -INT32_C(   236712319), -INT32_C(  1146721276), -INT32_C(  1129762392),  INT32_C(      290039),  INT32_C(  1240386502) },
+      { -INT32_C(  1191188227),  INT32_C(   275572549), -INT32_C(  1349504422), -INT32_C(  1647280536),  INT32_C(  1134960168), -INT32_C(  1404012801),  INT32_C(  2071969927),  INT32_C(  1000666433),
+         INT32_C(   584932679),  INT32_C(  1966602258), -INT32_C(  1489392399),  INT32_C(  1857908616),  INT32_C(  1457750062),  INT32_C(   459999124),  INT32_C(  1398087425), -INT32_C(  1085581557) },
+      {  INT32_C(           0), -INT32_C(   194045250),  INT32_C(  2147443861),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  2147390584),
+        -INT32_C(   145789728),  INT32_C(           0), -INT32_C(  2147469084),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  2147445850),  INT32_C(           0) } },
+    { UINT16_C(48734),
+      {  INT32_C(  1783820194), -INT32_C(  1732704346), -INT32_C(  1358483133), -INT32_C(  2054946194),  INT32_C(  2147470796),  INT32_C(  2043970927), -INT32_C(  2147417374),  INT32_C(    21471387),
+         INT32_C(   176925885), -INT32_C(  1292034062), -INT32_C(  1274617593), -INT32_C(  2147404710), -INT32_C(   301310362),  INT32_C(  1499137887), -INT32_C(  2147385864), -INT32_C(  2147447394) },
+      {  INT32_C(  1143774063),  INT32_C(  1306710982),  INT32_C(   738130249),  INT32_C(   225784699), -INT32_C(   495285899),  INT32_C(  1538026127),  INT32_C(  2084602223),  INT32_C(    35438046),
+         INT32_C(   120280000),  INT32_C(  2065956577), -INT32_C(  1560157473), -INT32_C(    51925962), -INT32_C(  1359485707),  INT32_C(  2136979145),  INT32_C(   651636519), -INT32_C(   775622764) },
+      { -INT32_C(   702932450), -INT32_C(   690523805),  INT32_C(  2140158107),  INT32_C(   675816071),  INT32_C(   574890094),  INT32_C(   754671606), -INT32_C(  1375721892), -INT32_C(     1531119),
+         INT32_C(  1843299306), -INT32_C(   682772809),  INT32_C(  1140724312),  INT32_C(  1181891277),  INT32_C(   750867432), -INT32_C(   334964836), -INT32_C(   349996719), -INT32_C(  1642315744) },
+      {  INT32_C(           0), -INT32_C(  1732673401), -INT32_C(  1358499549), -INT32_C(  2054950399),  INT32_C(  2147483647),  INT32_C(           0), -INT32_C(  2147412428),  INT32_C(           0),
+         INT32_C(           0), -INT32_C(  1292071631), -INT32_C(  1274582982), -INT32_C(  2147353514), -INT32_C(   301305223),  INT32_C(  1499108545),  INT32_C(           0), -INT32_C(  2147442356) } },
+    { UINT16_C(26710),
+      {  INT32_C(  1723191302),  INT32_C(   964395584),  INT32_C(  2147468418),  INT32_C(   981796109), -INT32_C(  2060329968), -INT32_C(  1751451752),  INT32_C(  2147420372),  INT32_C(  2147442053),
+        -INT32_C(  2147461357), -INT32_C(  2147466117),  INT32_C(  2147437932), -INT32_C(  2147418847), -INT32_C(  2147423473), -INT32_C(  2147394446),  INT32_C(   299794053),  INT32_C(  2147477898) },
+      {  INT32_C(   246880009), -INT32_C(   805430242),  INT32_C(  1996842450), -INT32_C(   113819353),  INT32_C(  1444024388),  INT32_C(  1946602390),  INT32_C(  1949097444),  INT32_C(  1368409100),
+         INT32_C(   866173789), -INT32_C(  2033845513), -INT32_C(  1932051115),  INT32_C(  1507877091),  INT32_C(  1389099165),  INT32_C(  1122474020), -INT32_C(   955808742), -INT32_C(  2092077070) },
+      {  INT32_C(   273473516), -INT32_C(  1733488216),  INT32_C(  1162559241), -INT32_C(  1066787171), -INT32_C(  1578753851), -INT32_C(   142666784),  INT32_C(  1255344512), -INT32_C(   107180636),
+         INT32_C(  1091787698),  INT32_C(   779382965), -INT32_C(  1997683198), -INT32_C(  1328553247), -INT32_C(  1107900105),  INT32_C(  1418554812), -INT32_C(   789373568), -INT32_C(   334854281) },
+      {  INT32_C(           0),  INT32_C(   964350810),  INT32_C(  2147483647),  INT32_C(           0), -INT32_C(  2060342106),  INT32_C(           0),  INT32_C(  2147399781),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  2147446860),  INT32_C(           0), -INT32_C(  2147401347),  INT32_C(   299784910),  INT32_C(           0) } },
+    { UINT16_C(53009),
+      { -INT32_C(  1459514673), -INT32_C(  1917685212),  INT32_C(  1426943382),  INT32_C(  2147458761),  INT32_C(  1673152243),  INT32_C(  2147470457), -INT32_C(  2147401680),  INT32_C(    28717745),
+         INT32_C(  2147434152), -INT32_C(  2147417183), -INT32_C(  2147439254),  INT32_C(  1423115168), -INT32_C(  2147402334), -INT32_C(  2147477084),  INT32_C(  2147400710),  INT32_C(  1730386057) },
+      { -INT32_C(   282856205), -INT32_C(   967148960), -INT32_C(   844437231),  INT32_C(    79897034),  INT32_C(   824777128),  INT32_C(    20135259), -INT32_C(   883595913), -INT32_C(   147237450),
+        -INT32_C(  1896134784), -INT32_C(   603135189), -INT32_C(  2083520325), -INT32_C(   439055882),  INT32_C(  1333240368),  INT32_C(  1586219697), -INT32_C(  1353074596),  INT32_C(  2006986798) },
+      {  INT32_C(  1327193877), -INT32_C(  1008204071),  INT32_C(   593612400), -INT32_C(   847945939), -INT32_C(  1099499526),  INT32_C(   860967755), -INT32_C(  1870728853), -INT32_C(   139159223),
+         INT32_C(  2017357878),  INT32_C(  2074003868), -INT32_C(  1497900909),  INT32_C(  1941583505), -INT32_C(   466822389), -INT32_C(  1860632245),  INT32_C(  1131646526), -INT32_C(  1347112583) },
+      { -INT32_C(  1459466564),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1673152614),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(  2147481618), -INT32_C(  2147408084),              INT32_MIN,  INT32_C(  1423106755),  INT32_C(           0),  INT32_C(           0),  INT32_C(  2147407398),  INT32_C(  1730366032) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi32(test_vec[i].b);
+    simde__m512i r = simde_mm512_maskz_dpbusds_epi32(test_vec[i].k, src, a, b);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_dpbusds_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_dpbusds_avx_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_dpbusds_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_dpbusds_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_dpbusds_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_dpbusds_avx_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_dpbusds_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_dpbusds_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_dpbusds_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_dpbusds_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_dpbusds_epi32)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,779 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN dpwssds
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/dpwssds.h>
+
+static int
+test_simde_mm_dpwssds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(  1909016608), -INT32_C(  2147418945),  INT32_C(  2147414037),  INT32_C(   180341798) },
+      { -INT32_C(  1519393256),  INT32_C(   910725594), -INT32_C(  2147450880), -INT32_C(  2127226932) },
+      {  INT32_C(  1330714495),  INT32_C(  1525486969), -INT32_C(  2147450880),  INT32_C(  1804892242) },
+      {              INT32_MIN, -INT32_C(  1978966159),  INT32_C(  2147483647), -INT32_C(   525933278) } },
+    { {  INT32_C(   667300009),  INT32_C(  1778666633),  INT32_C(  2147461772), -INT32_C(  2147435397) },
+      {  INT32_C(   748243368), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  2147450880) },
+      {  INT32_C(   776383769), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  2147450880) },
+      {  INT32_C(   402364903),  INT32_C(  2147483647),  INT32_C(  2147483647),  INT32_C(       48251) } },
+    { { -INT32_C(  2147459105), -INT32_C(  2147482936),  INT32_C(  2147414194),  INT32_C(  1563624366) },
+      { -INT32_C(   416331356),  INT32_C(   807447990), -INT32_C(   710488106), -INT32_C(   827901496) },
+      { -INT32_C(  1504955786), -INT32_C(   949286059), -INT32_C(   989625806),  INT32_C(  1731692150) },
+      { -INT32_C(  1758038677),              INT32_MIN,  INT32_C(  2147483647),  INT32_C(   769584319) } },
+    { { -INT32_C(  1375554092), -INT32_C(  2147478303), -INT32_C(   423241063), -INT32_C(  2147479065) },
+      {  INT32_C(  2098455610), -INT32_C(   980410153), -INT32_C(  1197667948), -INT32_C(   428472099) },
+      {  INT32_C(   683105081), -INT32_C(  1981108266), -INT32_C(   369353190),  INT32_C(  1687380422) },
+      { -INT32_C(  1207859885), -INT32_C(  1867765957), -INT32_C(   301348051),              INT32_MIN } },
+    { { -INT32_C(  2147449072),  INT32_C(  2147465849),  INT32_C(  1696061087), -INT32_C(  1049804511) },
+      { -INT32_C(   507193561), -INT32_C(  2147450880), -INT32_C(   793262359), -INT32_C(  2147450880) },
+      {  INT32_C(   769441559), -INT32_C(  2147450880),  INT32_C(   183363182), -INT32_C(  2147450880) },
+      { -INT32_C(  2064552703),  INT32_C(  2147483647),  INT32_C(  1757873192),  INT32_C(  1097679137) } },
+    { {  INT32_C(  2147464489), -INT32_C(  2147434661), -INT32_C(  2147461266),  INT32_C(  2147473934) },
+      {  INT32_C(  1459077180),  INT32_C(  2056508006),  INT32_C(  1280587294),  INT32_C(   629411958) },
+      {  INT32_C(  1300505323),  INT32_C(   679681327), -INT32_C(  1295269372), -INT32_C(  1876939023) },
+      {  INT32_C(  2147483647), -INT32_C(  1909219506),              INT32_MIN,  INT32_C(  1923055012) } },
+    { { -INT32_C(  1403618726), -INT32_C(  2147463489), -INT32_C(   857658101),  INT32_C(   197443889) },
+      {  INT32_C(  2064634468), -INT32_C(  1724959477),  INT32_C(  1278530026), -INT32_C(  2147450880) },
+      {  INT32_C(  1823831831),  INT32_C(   487698952),  INT32_C(   736262863), -INT32_C(  2147450880) },
+      { -INT32_C(   882887951),              INT32_MIN, -INT32_C(  1009422551),  INT32_C(  2147483647) } },
+    { {  INT32_C(  2147468857), -INT32_C(  2147427726),  INT32_C(  1696670148),  INT32_C(   241980591) },
+      { -INT32_C(   744988082),  INT32_C(   120922032),  INT32_C(  1184087755),  INT32_C(  1179407452) },
+      {  INT32_C(   388842279),  INT32_C(   751950023), -INT32_C(  1990483956), -INT32_C(  2134797800) },
+      {  INT32_C(  2147483647),              INT32_MIN,  INT32_C(  1557968009), -INT32_C(   951864165) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_dpwssds_epi32(src, a, b);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_dpwssds_avx_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(  1909016608), -INT32_C(  2147418945),  INT32_C(  2147414037),  INT32_C(   180341798) },
+      { -INT32_C(  1519393256),  INT32_C(   910725594), -INT32_C(  2147450880), -INT32_C(  2127226932) },
+      {  INT32_C(  1330714495),  INT32_C(  1525486969), -INT32_C(  2147450880),  INT32_C(  1804892242) },
+      {              INT32_MIN, -INT32_C(  1978966159),  INT32_C(  2147483647), -INT32_C(   525933278) } },
+    { {  INT32_C(   667300009),  INT32_C(  1778666633),  INT32_C(  2147461772), -INT32_C(  2147435397) },
+      {  INT32_C(   748243368), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  2147450880) },
+      {  INT32_C(   776383769), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  2147450880) },
+      {  INT32_C(   402364903),  INT32_C(  2147483647),  INT32_C(  2147483647),  INT32_C(       48251) } },
+    { { -INT32_C(  2147459105), -INT32_C(  2147482936),  INT32_C(  2147414194),  INT32_C(  1563624366) },
+      { -INT32_C(   416331356),  INT32_C(   807447990), -INT32_C(   710488106), -INT32_C(   827901496) },
+      { -INT32_C(  1504955786), -INT32_C(   949286059), -INT32_C(   989625806),  INT32_C(  1731692150) },
+      { -INT32_C(  1758038677),              INT32_MIN,  INT32_C(  2147483647),  INT32_C(   769584319) } },
+    { { -INT32_C(  1375554092), -INT32_C(  2147478303), -INT32_C(   423241063), -INT32_C(  2147479065) },
+      {  INT32_C(  2098455610), -INT32_C(   980410153), -INT32_C(  1197667948), -INT32_C(   428472099) },
+      {  INT32_C(   683105081), -INT32_C(  1981108266), -INT32_C(   369353190),  INT32_C(  1687380422) },
+      { -INT32_C(  1207859885), -INT32_C(  1867765957), -INT32_C(   301348051),              INT32_MIN } },
+    { { -INT32_C(  2147449072),  INT32_C(  2147465849),  INT32_C(  1696061087), -INT32_C(  1049804511) },
+      { -INT32_C(   507193561), -INT32_C(  2147450880), -INT32_C(   793262359), -INT32_C(  2147450880) },
+      {  INT32_C(   769441559), -INT32_C(  2147450880),  INT32_C(   183363182), -INT32_C(  2147450880) },
+      { -INT32_C(  2064552703),  INT32_C(  2147483647),  INT32_C(  1757873192),  INT32_C(  1097679137) } },
+    { {  INT32_C(  2147464489), -INT32_C(  2147434661), -INT32_C(  2147461266),  INT32_C(  2147473934) },
+      {  INT32_C(  1459077180),  INT32_C(  2056508006),  INT32_C(  1280587294),  INT32_C(   629411958) },
+      {  INT32_C(  1300505323),  INT32_C(   679681327), -INT32_C(  1295269372), -INT32_C(  1876939023) },
+      {  INT32_C(  2147483647), -INT32_C(  1909219506),              INT32_MIN,  INT32_C(  1923055012) } },
+    { { -INT32_C(  1403618726), -INT32_C(  2147463489), -INT32_C(   857658101),  INT32_C(   197443889) },
+      {  INT32_C(  2064634468), -INT32_C(  1724959477),  INT32_C(  1278530026), -INT32_C(  2147450880) },
+      {  INT32_C(  1823831831),  INT32_C(   487698952),  INT32_C(   736262863), -INT32_C(  2147450880) },
+      { -INT32_C(   882887951),              INT32_MIN, -INT32_C(  1009422551),  INT32_C(  2147483647) } },
+    { {  INT32_C(  2147468857), -INT32_C(  2147427726),  INT32_C(  1696670148),  INT32_C(   241980591) },
+      { -INT32_C(   744988082),  INT32_C(   120922032),  INT32_C(  1184087755),  INT32_C(  1179407452) },
+      {  INT32_C(   388842279),  INT32_C(   751950023), -INT32_C(  1990483956), -INT32_C(  2134797800) },
+      {  INT32_C(  2147483647),              INT32_MIN,  INT32_C(  1557968009), -INT32_C(   951864165) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_dpwssds_avx_epi32(src, a, b);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_dpwssds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C(  2147478820), -INT32_C(  2147404926),  INT32_C(  2147449506), -INT32_C(  2125109836) },
+      UINT8_C( 12),
+      {  INT32_C(  1024270705),  INT32_C(  2144082581), -INT32_C(  2147450880),  INT32_C(    13339843) },
+      { -INT32_C(    72548356),  INT32_C(    86112850), -INT32_C(  2147450880),  INT32_C(  1662492895) },
+      {  INT32_C(  2147478820), -INT32_C(  2147404926),  INT32_C(  2147483647), -INT32_C(  1401522482) } },
+    { {  INT32_C(   145485987),  INT32_C(  2147414951), -INT32_C(  1515427770), -INT32_C(  2147422794) },
+      UINT8_C(  3),
+      {  INT32_C(   243660957),  INT32_C(   644618260), -INT32_C(  1623198108), -INT32_C(  2147450880) },
+      {  INT32_C(  1289089787), -INT32_C(   395411924), -INT32_C(  2025733989), -INT32_C(  2147450880) },
+      {  INT32_C(   224898363),  INT32_C(  2147483647), -INT32_C(  1515427770), -INT32_C(  2147422794) } },
+    { { -INT32_C(  2147437735),  INT32_C(  1880640737),  INT32_C(  2147391599),  INT32_C(  2147455128) },
+      UINT8_C( 11),
+      { -INT32_C(  1710735195), -INT32_C(  2147450880),  INT32_C(   828868847), -INT32_C(  2147450880) },
+      { -INT32_C(  2125362961), -INT32_C(  2147450880), -INT32_C(   796550407), -INT32_C(  2147450880) },
+      { -INT32_C(  1805288980),  INT32_C(  2147483647),  INT32_C(  2147391599),  INT32_C(  2147483647) } },
+    { { -INT32_C(  1589700335), -INT32_C(    19434572), -INT32_C(  1376900927), -INT32_C(  2147464245) },
+      UINT8_C(  5),
+      { -INT32_C(  2147450880),  INT32_C(  1455422530), -INT32_C(   134866824),  INT32_C(  1301317548) },
+      { -INT32_C(  2147450880), -INT32_C(   592073180), -INT32_C(   137088371),  INT32_C(  1531007952) },
+      {  INT32_C(   557783313), -INT32_C(    19434572), -INT32_C(  1291533167), -INT32_C(  2147464245) } },
+    { { -INT32_C(   463828113),  INT32_C(  2147468079),  INT32_C(  2147473448),  INT32_C(  2147432102) },
+      UINT8_C(  9),
+      { -INT32_C(   373024629), -INT32_C(   201175970), -INT32_C(   666995065),  INT32_C(  1241672873) },
+      { -INT32_C(   896308334),  INT32_C(   344818309), -INT32_C(  1165766070), -INT32_C(  1258713379) },
+      { -INT32_C(   212957375),  INT32_C(  2147468079),  INT32_C(  2147473448),  INT32_C(   977872509) } },
+    { { -INT32_C(  2147392658), -INT32_C(  2147428611),  INT32_C(  1707379586), -INT32_C(   253528277) },
+      UINT8_C(  1),
+      { -INT32_C(  1414215403),  INT32_C(   837440584),  INT32_C(  1035753609), -INT32_C(  1067138737) },
+      { -INT32_C(  1212650486),  INT32_C(  2022690930),  INT32_C(  1935781972),  INT32_C(   861646015) },
+      { -INT32_C(  2136920160), -INT32_C(  2147428611),  INT32_C(  1707379586), -INT32_C(   253528277) } },
+    { {  INT32_C(  2147411617),  INT32_C(  2147481540), -INT32_C(  2060747280),  INT32_C(  1955184154) },
+      UINT8_C( 14),
+      { -INT32_C(  2147450880), -INT32_C(  1267685422), -INT32_C(  2093102953), -INT32_C(  2147450880) },
+      { -INT32_C(  2147450880),  INT32_C(   977184730),  INT32_C(  1022310298), -INT32_C(  2147450880) },
+      {  INT32_C(  2147411617),  INT32_C(  2147483647),              INT32_MIN,  INT32_C(  2147483647) } },
+    { { -INT32_C(   640912792), -INT32_C(  2147392972),  INT32_C(  2147439478), -INT32_C(  2147401724) },
+      UINT8_C(  7),
+      {  INT32_C(  2045175563), -INT32_C(  2147450880),  INT32_C(   407825693), -INT32_C(  2127226930) },
+      {  INT32_C(   353231497), -INT32_C(  2147450880),  INT32_C(   740086144), -INT32_C(   277356028) },
+      { -INT32_C(   424551431),  INT32_C(       90676),  INT32_C(  2147483647), -INT32_C(  2147401724) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_mask_dpwssds_epi32(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_dpwssds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t src[4];
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { UINT8_C(  2),
+      {  INT32_C(   630215262), -INT32_C(  2147390633), -INT32_C(   725391557), -INT32_C(  2147460690) },
+      { -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(   146202327),  INT32_C(  1727356912) },
+      { -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(   514550730),  INT32_C(   504527400) },
+      {  INT32_C(           0),  INT32_C(       93015),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(  3),
+      {  INT32_C(  1699478026),  INT32_C(   984074977), -INT32_C(   151957632), -INT32_C(  2147431453) },
+      { -INT32_C(  1837571100),  INT32_C(   551125691),  INT32_C(  1744465432),  INT32_C(  1499927299) },
+      { -INT32_C(  1379250594),  INT32_C(  1833817092), -INT32_C(   314837319), -INT32_C(  2050824274) },
+      {  INT32_C(  2145241714),  INT32_C(  1580464146),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(  6),
+      { -INT32_C(  2147404639), -INT32_C(   536950983), -INT32_C(  2147410367),  INT32_C(  2147469448) },
+      {  INT32_C(  1918653544), -INT32_C(   205326902),  INT32_C(  1727360926),  INT32_C(    98455658) },
+      {  INT32_C(   410794717), -INT32_C(  1627969592), -INT32_C(   109507289), -INT32_C(   879469480) },
+      {  INT32_C(           0), -INT32_C(   485720265), -INT32_C(  2095244256),  INT32_C(           0) } },
+    { UINT8_C( 10),
+      {  INT32_C(  1962490364),  INT32_C(   364957168),  INT32_C(   403441845), -INT32_C(   771951674) },
+      {  INT32_C(   137395830),  INT32_C(   751687206), -INT32_C(   201926252),  INT32_C(  1487646792) },
+      { -INT32_C(   840825828),  INT32_C(  1835661932),  INT32_C(  1724079939), -INT32_C(  1507174890) },
+      {  INT32_C(           0),  INT32_C(   701491981),  INT32_C(           0), -INT32_C(  1743734780) } },
+    { UINT8_C(  1),
+      {  INT32_C(   613491975),  INT32_C(   840181320), -INT32_C(   922516866),  INT32_C(   789422606) },
+      { -INT32_C(  2147450880), -INT32_C(  1047381418), -INT32_C(  1162910740), -INT32_C(   264311511) },
+      { -INT32_C(  2147450880),  INT32_C(   432020020),  INT32_C(  1075353899), -INT32_C(  1660574602) },
+      {  INT32_C(  2147483647),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(  1),
+      { -INT32_C(  2147400690), -INT32_C(  2147416635), -INT32_C(    67046978), -INT32_C(  2147454411) },
+      {  INT32_C(   741618254),  INT32_C(   132950932), -INT32_C(  2036258973), -INT32_C(    16917291) },
+      { -INT32_C(   682122154),  INT32_C(  1361265144), -INT32_C(   260665067), -INT32_C(   483524889) },
+      {              INT32_MIN,  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C( 15),
+      { -INT32_C(  1238965344), -INT32_C(  2147384626),  INT32_C(   288425787), -INT32_C(  2147398495) },
+      { -INT32_C(   998881278), -INT32_C(   777866457), -INT32_C(  1502594462), -INT32_C(  2147450880) },
+      {  INT32_C(  1376149233),  INT32_C(  2032137278), -INT32_C(   759084271), -INT32_C(  2147450880) },
+      { -INT32_C(  1110978490),              INT32_MIN,  INT32_C(   841218093),  INT32_C(       85153) } },
+    { UINT8_C(  0),
+      { -INT32_C(  2147469313),  INT32_C(  2147442867), -INT32_C(  2048473855),  INT32_C(  2147389122) },
+      { -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(   365328107), -INT32_C(  2147450880) },
+      { -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  1846092973), -INT32_C(  2147450880) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_maskz_dpwssds_epi32(test_vec[i].k, src, a, b);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_dpwssds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const int32_t a[8];
+    const int32_t b[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { { -INT32_C(  2147454780), -INT32_C(   584467839),  INT32_C(  2147443009),  INT32_C(  2147436711), -INT32_C(   255092682), -INT32_C(  2147452368),  INT32_C(  1251729577),  INT32_C(  1288155136) },
+      {  INT32_C(  1688572595), -INT32_C(   303666098),  INT32_C(   177984010), -INT32_C(  1190562392), -INT32_C(   443651000), -INT32_C(   477717598), -INT32_C(  2046111786), -INT32_C(  2087318871) },
+      { -INT32_C(  1806508191),  INT32_C(   221102313), -INT32_C(   736435877),  INT32_C(  1061403365),  INT32_C(   768261965),  INT32_C(   592552585), -INT32_C(  2061548681), -INT32_C(   612769724) },
+      {              INT32_MIN, -INT32_C(  1047900947),  INT32_C(  2147483647),  INT32_C(  1320369226), -INT32_C(   793576982), -INT32_C(  1598580920),  INT32_C(  2020928601),  INT32_C(  1563814090) } },
+    { {  INT32_C(  2147392440), -INT32_C(   519989019),  INT32_C(  2018676688), -INT32_C(  2081158566),  INT32_C(   646176330),  INT32_C(  2147423595), -INT32_C(  2147472682),  INT32_C(   665252221) },
+      {  INT32_C(   711650587),  INT32_C(   690324572), -INT32_C(  1971197191),  INT32_C(  2009510241),  INT32_C(   248980247), -INT32_C(   776273928), -INT32_C(   264071692), -INT32_C(  1955916011) },
+      { -INT32_C(   251540763), -INT32_C(  1778766804),  INT32_C(  1739499982), -INT32_C(   467384589), -INT32_C(   408135437), -INT32_C(  1091837944), -INT32_C(   808258709),  INT32_C(  1190518896) },
+      {  INT32_C(  2147483647), -INT32_C(  1163796521),  INT32_C(  1339101148),              INT32_MIN,  INT32_C(   827068051),  INT32_C(  2147483647), -INT32_C(  2010322954),  INT32_C(    75373076) } },
+    { { -INT32_C(   498991104), -INT32_C(   776699027),  INT32_C(  2147427586),  INT32_C(  1584712501), -INT32_C(  2147469947),  INT32_C(  2147463310),  INT32_C(   803471872),  INT32_C(  2147471180) },
+      { -INT32_C(  2147450880),  INT32_C(  2020901884), -INT32_C(   137473998), -INT32_C(   627187588),  INT32_C(  2114505583), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(   664269794) },
+      { -INT32_C(  2147450880),  INT32_C(  1474051827), -INT32_C(  1991515463),  INT32_C(  1122181058), -INT32_C(   355357600), -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(  1549286537) },
+      {  INT32_C(  1648492544), -INT32_C(   594754735),  INT32_C(  2057311358),  INT32_C(  1355235428), -INT32_C(  2034350163),  INT32_C(  2147483647),  INT32_C(  2147483647),  INT32_C(  1955927834) } },
+    { {  INT32_C(  2147429654), -INT32_C(  1202413682),  INT32_C(  1377344259), -INT32_C(  2147415085), -INT32_C(  2147388188), -INT32_C(  2147439511), -INT32_C(  2147388248), -INT32_C(  2147410093) },
+      { -INT32_C(  2147450880),  INT32_C(  1339339766),  INT32_C(   668223193), -INT32_C(    34067807), -INT32_C(  1160698888),  INT32_C(  2018922643),  INT32_C(    98444838),  INT32_C(   530379621) },
+      { -INT32_C(  2147450880),  INT32_C(  1481129506),  INT32_C(    15461396),  INT32_C(   446561326),  INT32_C(   916153832),  INT32_C(  1426685988), -INT32_C(   239051037), -INT32_C(  2125595598) },
+      {  INT32_C(  2147483647), -INT32_C(  1050186278),  INT32_C(  1287241619),              INT32_MIN,              INT32_MIN,              INT32_MIN, -INT32_C(  1915641638),              INT32_MIN } },
+    { { -INT32_C(  2147403168), -INT32_C(  2147476112),  INT32_C(    13729929),  INT32_C(  2147392877), -INT32_C(   333802084),  INT32_C(   700331721),  INT32_C(  1402224787), -INT32_C(  2147435503) },
+      { -INT32_C(  1642949216),  INT32_C(  1714848595), -INT32_C(   678664166),  INT32_C(   790749724), -INT32_C(  1311716533), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  2147450880) },
+      { -INT32_C(   116425288),  INT32_C(   207533442),  INT32_C(  1023099878), -INT32_C(  1666747416), -INT32_C(  1060024977), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  2147450880) },
+      {              INT32_MIN, -INT32_C(  1455977366),  INT32_C(   315292713),  INT32_C(  1613493588), -INT32_C(   277515023),  INT32_C(  2147483647),  INT32_C(  2147483647),  INT32_C(       48145) } },
+    { {  INT32_C(   542543157), -INT32_C(  2147451314), -INT32_C(  1339928955), -INT32_C(  2147398684), -INT32_C(  2147407496),  INT32_C(  2147470224),  INT32_C(  1060359893),  INT32_C(  1521057077) },
+      { -INT32_C(  1014322722), -INT32_C(   967137828),  INT32_C(  2081693323), -INT32_C(  1720773170),  INT32_C(   384556578), -INT32_C(  1379771314), -INT32_C(  2147450880), -INT32_C(  1570972861) },
+      {  INT32_C(  1775811387),  INT32_C(  1180235075),  INT32_C(   473054836),  INT32_C(  1650630578),  INT32_C(  1161511908), -INT32_C(  2044149997), -INT32_C(  2147450880), -INT32_C(  1310457838) },
+      {  INT32_C(   511341519),              INT32_MIN, -INT32_C(   985646231),              INT32_MIN,              INT32_MIN,  INT32_C(  2147483647),  INT32_C(  2147483647),  INT32_C(  2000231899) } },
+    { {  INT32_C(  1332061341), -INT32_C(  2147452320), -INT32_C(  2147414632),  INT32_C(  2147482190),  INT32_C(  2147450208),  INT32_C(  1734583342),  INT32_C(  2147412842),  INT32_C(   959050790) },
+      {  INT32_C(  1594225915),  INT32_C(   722704127),  INT32_C(  1221292395),  INT32_C(    59391536), -INT32_C(  2147450880),  INT32_C(  2011217225), -INT32_C(   240741041), -INT32_C(  1897054220) },
+      { -INT32_C(   548705796),  INT32_C(   757724190), -INT32_C(   301035651), -INT32_C(   534363463), -INT32_C(  2147450880), -INT32_C(   522240759), -INT32_C(  1218602841),  INT32_C(  1164127718) },
+      {  INT32_C(  1051848744), -INT32_C(  1938197171),              INT32_MIN,  INT32_C(  2147483647),  INT32_C(  2147483647),  INT32_C(  1223171295),  INT32_C(  2147483647),  INT32_C(   637236229) } },
+    { {  INT32_C(  1901686154), -INT32_C(  2147449602),  INT32_C(  2147447139),  INT32_C(  1003794916), -INT32_C(   676704609), -INT32_C(  2028000824), -INT32_C(  1379134936),  INT32_C(  1313391572) },
+      { -INT32_C(  1020698218), -INT32_C(  2147450880),  INT32_C(   154118829), -INT32_C(  1699527371), -INT32_C(   474420427), -INT32_C(   704718400), -INT32_C(  1698619968), -INT32_C(  1358046503) },
+      { -INT32_C(   852810822), -INT32_C(  2147450880),  INT32_C(   312588421), -INT32_C(   172712528),  INT32_C(  1126014996), -INT32_C(  1601628917), -INT32_C(  1517928199), -INT32_C(  1830848086) },
+      {  INT32_C(  2147483647),  INT32_C(       34046),  INT32_C(  2147483647),  INT32_C(   626252848), -INT32_C(   670383461), -INT32_C(  1817933322), -INT32_C(   652122130),  INT32_C(  1596100417) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i r = simde_mm256_dpwssds_epi32(src, a, b);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_dpwssds_avx_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const int32_t a[8];
+    const int32_t b[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { { -INT32_C(  2147454780), -INT32_C(   584467839),  INT32_C(  2147443009),  INT32_C(  2147436711), -INT32_C(   255092682), -INT32_C(  2147452368),  INT32_C(  1251729577),  INT32_C(  1288155136) },
+      {  INT32_C(  1688572595), -INT32_C(   303666098),  INT32_C(   177984010), -INT32_C(  1190562392), -INT32_C(   443651000), -INT32_C(   477717598), -INT32_C(  2046111786), -INT32_C(  2087318871) },
+      { -INT32_C(  1806508191),  INT32_C(   221102313), -INT32_C(   736435877),  INT32_C(  1061403365),  INT32_C(   768261965),  INT32_C(   592552585), -INT32_C(  2061548681), -INT32_C(   612769724) },
+      {              INT32_MIN, -INT32_C(  1047900947),  INT32_C(  2147483647),  INT32_C(  1320369226), -INT32_C(   793576982), -INT32_C(  1598580920),  INT32_C(  2020928601),  INT32_C(  1563814090) } },
+    { {  INT32_C(  2147392440), -INT32_C(   519989019),  INT32_C(  2018676688), -INT32_C(  2081158566),  INT32_C(   646176330),  INT32_C(  2147423595), -INT32_C(  2147472682),  INT32_C(   665252221) },
+      {  INT32_C(   711650587),  INT32_C(   690324572), -INT32_C(  1971197191),  INT32_C(  2009510241),  INT32_C(   248980247), -INT32_C(   776273928), -INT32_C(   264071692), -INT32_C(  1955916011) },
+      { -INT32_C(   251540763), -INT32_C(  1778766804),  INT32_C(  1739499982), -INT32_C(   467384589), -INT32_C(   408135437), -INT32_C(  1091837944), -INT32_C(   808258709),  INT32_C(  1190518896) },
+      {  INT32_C(  2147483647), -INT32_C(  1163796521),  INT32_C(  1339101148),              INT32_MIN,  INT32_C(   827068051),  INT32_C(  2147483647), -INT32_C(  2010322954),  INT32_C(    75373076) } },
+    { { -INT32_C(   498991104), -INT32_C(   776699027),  INT32_C(  2147427586),  INT32_C(  1584712501), -INT32_C(  2147469947),  INT32_C(  2147463310),  INT32_C(   803471872),  INT32_C(  2147471180) },
+      { -INT32_C(  2147450880),  INT32_C(  2020901884), -INT32_C(   137473998), -INT32_C(   627187588),  INT32_C(  2114505583), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(   664269794) },
+      { -INT32_C(  2147450880),  INT32_C(  1474051827), -INT32_C(  1991515463),  INT32_C(  1122181058), -INT32_C(   355357600), -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(  1549286537) },
+      {  INT32_C(  1648492544), -INT32_C(   594754735),  INT32_C(  2057311358),  INT32_C(  1355235428), -INT32_C(  2034350163),  INT32_C(  2147483647),  INT32_C(  2147483647),  INT32_C(  1955927834) } },
+    { {  INT32_C(  2147429654), -INT32_C(  1202413682),  INT32_C(  1377344259), -INT32_C(  2147415085), -INT32_C(  2147388188), -INT32_C(  2147439511), -INT32_C(  2147388248), -INT32_C(  2147410093) },
+      { -INT32_C(  2147450880),  INT32_C(  1339339766),  INT32_C(   668223193), -INT32_C(    34067807), -INT32_C(  1160698888),  INT32_C(  2018922643),  INT32_C(    98444838),  INT32_C(   530379621) },
+      { -INT32_C(  2147450880),  INT32_C(  1481129506),  INT32_C(    15461396),  INT32_C(   446561326),  INT32_C(   916153832),  INT32_C(  1426685988), -INT32_C(   239051037), -INT32_C(  2125595598) },
+      {  INT32_C(  2147483647), -INT32_C(  1050186278),  INT32_C(  1287241619),              INT32_MIN,              INT32_MIN,              INT32_MIN, -INT32_C(  1915641638),              INT32_MIN } },
+    { { -INT32_C(  2147403168), -INT32_C(  2147476112),  INT32_C(    13729929),  INT32_C(  2147392877), -INT32_C(   333802084),  INT32_C(   700331721),  INT32_C(  1402224787), -INT32_C(  2147435503) },
+      { -INT32_C(  1642949216),  INT32_C(  1714848595), -INT32_C(   678664166),  INT32_C(   790749724), -INT32_C(  1311716533), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  2147450880) },
+      { -INT32_C(   116425288),  INT32_C(   207533442),  INT32_C(  1023099878), -INT32_C(  1666747416), -INT32_C(  1060024977), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  2147450880) },
+      {              INT32_MIN, -INT32_C(  1455977366),  INT32_C(   315292713),  INT32_C(  1613493588), -INT32_C(   277515023),  INT32_C(  2147483647),  INT32_C(  2147483647),  INT32_C(       48145) } },
+    { {  INT32_C(   542543157), -INT32_C(  2147451314), -INT32_C(  1339928955), -INT32_C(  2147398684), -INT32_C(  2147407496),  INT32_C(  2147470224),  INT32_C(  1060359893),  INT32_C(  1521057077) },
+      { -INT32_C(  1014322722), -INT32_C(   967137828),  INT32_C(  2081693323), -INT32_C(  1720773170),  INT32_C(   384556578), -INT32_C(  1379771314), -INT32_C(  2147450880), -INT32_C(  1570972861) },
+      {  INT32_C(  1775811387),  INT32_C(  1180235075),  INT32_C(   473054836),  INT32_C(  1650630578),  INT32_C(  1161511908), -INT32_C(  2044149997), -INT32_C(  2147450880), -INT32_C(  1310457838) },
+      {  INT32_C(   511341519),              INT32_MIN, -INT32_C(   985646231),              INT32_MIN,              INT32_MIN,  INT32_C(  2147483647),  INT32_C(  2147483647),  INT32_C(  2000231899) } },
+    { {  INT32_C(  1332061341), -INT32_C(  2147452320), -INT32_C(  2147414632),  INT32_C(  2147482190),  INT32_C(  2147450208),  INT32_C(  1734583342),  INT32_C(  2147412842),  INT32_C(   959050790) },
+      {  INT32_C(  1594225915),  INT32_C(   722704127),  INT32_C(  1221292395),  INT32_C(    59391536), -INT32_C(  2147450880),  INT32_C(  2011217225), -INT32_C(   240741041), -INT32_C(  1897054220) },
+      { -INT32_C(   548705796),  INT32_C(   757724190), -INT32_C(   301035651), -INT32_C(   534363463), -INT32_C(  2147450880), -INT32_C(   522240759), -INT32_C(  1218602841),  INT32_C(  1164127718) },
+      {  INT32_C(  1051848744), -INT32_C(  1938197171),              INT32_MIN,  INT32_C(  2147483647),  INT32_C(  2147483647),  INT32_C(  1223171295),  INT32_C(  2147483647),  INT32_C(   637236229) } },
+    { {  INT32_C(  1901686154), -INT32_C(  2147449602),  INT32_C(  2147447139),  INT32_C(  1003794916), -INT32_C(   676704609), -INT32_C(  2028000824), -INT32_C(  1379134936),  INT32_C(  1313391572) },
+      { -INT32_C(  1020698218), -INT32_C(  2147450880),  INT32_C(   154118829), -INT32_C(  1699527371), -INT32_C(   474420427), -INT32_C(   704718400), -INT32_C(  1698619968), -INT32_C(  1358046503) },
+      { -INT32_C(   852810822), -INT32_C(  2147450880),  INT32_C(   312588421), -INT32_C(   172712528),  INT32_C(  1126014996), -INT32_C(  1601628917), -INT32_C(  1517928199), -INT32_C(  1830848086) },
+      {  INT32_C(  2147483647),  INT32_C(       34046),  INT32_C(  2147483647),  INT32_C(   626252848), -INT32_C(   670383461), -INT32_C(  1817933322), -INT32_C(   652122130),  INT32_C(  1596100417) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i r = simde_mm256_dpwssds_avx_epi32(src, a, b);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_dpwssds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t b[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { { -INT32_C(  2147406158),  INT32_C(  1363088890), -INT32_C(  2090105109), -INT32_C(   717495784), -INT32_C(   513983070),  INT32_C(  2147431379),  INT32_C(   727177465),  INT32_C(  2147432626) },
+      UINT8_C(170),
+      { -INT32_C(   716499121), -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(   315448683), -INT32_C(  2147450880), -INT32_C(  1562648413),  INT32_C(  1379437911), -INT32_C(  2147450880) },
+      {  INT32_C(  1110835873), -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(  1964074343), -INT32_C(  2147450880),  INT32_C(  1496933342), -INT32_C(   491663153), -INT32_C(  2147450880) },
+      { -INT32_C(  2147406158),  INT32_C(  2147483647), -INT32_C(  2090105109),  INT32_C(    47554498), -INT32_C(   513983070),  INT32_C(  1397518320),  INT32_C(   727177465),  INT32_C(  2147483647) } },
+    { {  INT32_C(  2147431307),  INT32_C(  1279448026),  INT32_C(  1862777406),  INT32_C(  1908963555),  INT32_C(  2147459136), -INT32_C(  2147446578),  INT32_C(  2116687017),  INT32_C(   928846284) },
+      UINT8_C(166),
+      { -INT32_C(  2147450880), -INT32_C(   686991065),  INT32_C(   734428696),  INT32_C(  1014552921), -INT32_C(  1328731686), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  2107733753) },
+      { -INT32_C(  2147450880),  INT32_C(  1285138673),  INT32_C(  1094966324),  INT32_C(    46870823),  INT32_C(  1019293694), -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(  1488433901) },
+      {  INT32_C(  2147431307),  INT32_C(   565230678),  INT32_C(  1754182128),  INT32_C(  1908963555),  INT32_C(  2147459136),  INT32_C(       37070),  INT32_C(  2116687017),  INT32_C(   799362169) } },
+    { { -INT32_C(  2147446346),  INT32_C(  2147428672), -INT32_C(  2147446034), -INT32_C(  2147405691), -INT32_C(   967822824), -INT32_C(  2147460819),  INT32_C(   955090657),  INT32_C(  2147409668) },
+      UINT8_C(124),
+      { -INT32_C(  2147450880),  INT32_C(   595042535), -INT32_C(  2147450880), -INT32_C(  1546756895),  INT32_C(  1965638614), -INT32_C(  2066762011),  INT32_C(  1801564317),  INT32_C(  1649952953) },
+      { -INT32_C(  2147450880),  INT32_C(   177327128), -INT32_C(  2147450880),  INT32_C(   853092232),  INT32_C(   124474830),  INT32_C(  1140235021), -INT32_C(   609044695),  INT32_C(  1712725574) },
+      { -INT32_C(  2147446346),  INT32_C(  2147428672),  INT32_C(       37614),              INT32_MIN, -INT32_C(   529404561),              INT32_MIN,  INT32_C(  1078570872),  INT32_C(  2147409668) } },
+    { {  INT32_C(  1904018805), -INT32_C(  2147437310),  INT32_C(  1329850009), -INT32_C(   376137967),  INT32_C(  2147438332),  INT32_C(  2147415200), -INT32_C(  2147396504), -INT32_C(  2147459266) },
+      UINT8_C(123),
+      { -INT32_C(  2147450880),  INT32_C(  1236674642),  INT32_C(  1287469863), -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(  2026596750), -INT32_C(  2147450880), -INT32_C(   850804206) },
+      { -INT32_C(  2147450880),  INT32_C(  1120078129), -INT32_C(  1313562124), -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(   391104163), -INT32_C(  2147450880),  INT32_C(  2101984886) },
+      {  INT32_C(  2147483647), -INT32_C(  1800642474),  INT32_C(  1329850009),  INT32_C(  1771345681),  INT32_C(  2147483647),  INT32_C(  1935114671),  INT32_C(       87144), -INT32_C(  2147459266) } },
+    { { -INT32_C(   805818185),  INT32_C(  2147390763), -INT32_C(  1074750030), -INT32_C(  2147430724),  INT32_C(   227289733),  INT32_C(   426464623),  INT32_C(   362205481), -INT32_C(  1445450053) },
+      UINT8_C( 49),
+      {  INT32_C(    12014883), -INT32_C(   828914662), -INT32_C(  1266074847), -INT32_C(  2147450880), -INT32_C(  1722850394),  INT32_C(   199265156),  INT32_C(  1985800989), -INT32_C(  2147450880) },
+      { -INT32_C(   824726315),  INT32_C(  2124633387),  INT32_C(  1724508750), -INT32_C(  2147450880),  INT32_C(   112798606),  INT32_C(  1366776716), -INT32_C(   936579811), -INT32_C(  2147450880) },
+      { -INT32_C(  1272158585),  INT32_C(  2147390763), -INT32_C(  1074750030), -INT32_C(  2147430724),  INT32_C(   466482864), -INT32_C(   208997697),  INT32_C(   362205481), -INT32_C(  1445450053) } },
+    { {  INT32_C(  2147471280),  INT32_C(  2147466344),  INT32_C(  2056880022),  INT32_C(  2147423920),  INT32_C(  2147447996), -INT32_C(  1917697849),  INT32_C(  2147435543), -INT32_C(  1455954263) },
+      UINT8_C(161),
+      { -INT32_C(  1500531987),  INT32_C(   545184097), -INT32_C(  1972833298), -INT32_C(   940795547), -INT32_C(   966864422), -INT32_C(  2147450880), -INT32_C(   557061534), -INT32_C(  1686918921) },
+      { -INT32_C(  1429101315),  INT32_C(  1870101761),  INT32_C(   882210067), -INT32_C(  1695294928),  INT32_C(   394236551), -INT32_C(  2147450880),  INT32_C(  1964316431), -INT32_C(   975684911) },
+      {  INT32_C(  2147483647),  INT32_C(  2147466344),  INT32_C(  2056880022),  INT32_C(  2147423920),  INT32_C(  2147447996),  INT32_C(   229785799),  INT32_C(  2147435543), -INT32_C(  1408207272) } },
+    { { -INT32_C(  2147422313),  INT32_C(   628710765), -INT32_C(  2147404156), -INT32_C(  2147445941),  INT32_C(  1564547871), -INT32_C(  2147448319), -INT32_C(   186810290),  INT32_C(  2147455234) },
+      UINT8_C(208),
+      { -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(  2003672142), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(   578972439),  INT32_C(  1485793158),  INT32_C(  2035107316) },
+      { -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(   816221917), -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(   767449604),  INT32_C(   787810081), -INT32_C(  1109893040) },
+      { -INT32_C(  2147422313),  INT32_C(   628710765), -INT32_C(  2147404156), -INT32_C(  2147445941),  INT32_C(  2147483647), -INT32_C(  2147448319),  INT32_C(   134083951),  INT32_C(  2063081274) } },
+    { { -INT32_C(  1759277560),  INT32_C(   626488284), -INT32_C(  1301228789), -INT32_C(  1196037383), -INT32_C(   224432363), -INT32_C(  1778489663),  INT32_C(  2147404565), -INT32_C(  2147467295) },
+      UINT8_C( 58),
+      { -INT32_C(  1808742946), -INT32_C(   555891539), -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(  1006542665), -INT32_C(    29857133),  INT32_C(   636154679),  INT32_C(  1932637321) },
+      {  INT32_C(  1638457324),  INT32_C(   527271069), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  2129825461), -INT32_C(  1184769442),  INT32_C(  1020914278), -INT32_C(  1358700014) },
+      { -INT32_C(  1759277560),  INT32_C(  1037954318), -INT32_C(  1301228789),  INT32_C(   951446265), -INT32_C(  1441637282), -INT32_C(  2033090061),  INT32_C(  2147404565), -INT32_C(  2147467295) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i r = simde_mm256_mask_dpwssds_epi32(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_dpwssds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t src[8];
+    const int32_t a[8];
+    const int32_t b[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { UINT8_C(  9),
+      {  INT32_C(    14260447), -INT32_C(  2147415081),  INT32_C(  2147410545), -INT32_C(  2147453681),  INT32_C(  2147413207),  INT32_C(  1462329151), -INT32_C(  1448713543), -INT32_C(  1097518714) },
+      { -INT32_C(  2147450880),  INT32_C(  1077688029),  INT32_C(    75426740), -INT32_C(   197367750),  INT32_C(  1443150685), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  1272654398) },
+      { -INT32_C(  2147450880),  INT32_C(  2004684172), -INT32_C(    26412743), -INT32_C(  1860340415), -INT32_C(  1393200678), -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(  1678808421) },
+      {  INT32_C(  2147483647),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1261038443),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(177),
+      {  INT32_C(  1225468848),  INT32_C(  2147445936),  INT32_C(   220151663),  INT32_C(  2147410645), -INT32_C(  2147390145),  INT32_C(  2101426124), -INT32_C(  2147480901), -INT32_C(   150231034) },
+      { -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(  1326141376), -INT32_C(   256140621), -INT32_C(   860519175),  INT32_C(   954178201),  INT32_C(   930213420), -INT32_C(  2147450880) },
+      { -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(  1518450377),  INT32_C(  1038650298),  INT32_C(  1843047237),  INT32_C(  1513283347), -INT32_C(   262632984), -INT32_C(  2147450880) },
+      {  INT32_C(  2147483647),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1833502082),  INT32_C(  2147483647),  INT32_C(           0),  INT32_C(  1997252614) } },
+    { UINT8_C( 27),
+      {  INT32_C(  2147422951),  INT32_C(  2147446770),  INT32_C(  2147396140),  INT32_C(  1483762798), -INT32_C(  2147398631), -INT32_C(   327506446),  INT32_C(  1087718743),  INT32_C(  2147418178) },
+      { -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(   714024928), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  1616496594), -INT32_C(   178926482) },
+      { -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  1327649079), -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(   680393304),  INT32_C(  2097628094) },
+      {  INT32_C(  2147483647),  INT32_C(  2147483647),  INT32_C(           0),  INT32_C(  1050806465),  INT32_C(       85017),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C( 21),
+      { -INT32_C(   339073299), -INT32_C(  1004794356),  INT32_C(  2147476535),  INT32_C(  1758936526),  INT32_C(   590816756), -INT32_C(  2147450595), -INT32_C(  2147443865), -INT32_C(  2095460838) },
+      {  INT32_C(  1286825438),  INT32_C(   131217422), -INT32_C(   908402387),  INT32_C(   243513936),  INT32_C(    88287188), -INT32_C(   636693757),  INT32_C(   426358989),  INT32_C(   904843093) },
+      {  INT32_C(   252816109), -INT32_C(  1055164655),  INT32_C(   825488978),  INT32_C(   245976839),  INT32_C(   215817672), -INT32_C(   868578384), -INT32_C(  1048005763),  INT32_C(  1401088976) },
+      { -INT32_C(   831293866),  INT32_C(           0),  INT32_C(  1992438543),  INT32_C(           0),  INT32_C(   672986731),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(230),
+      { -INT32_C(  2147390768),  INT32_C(   200429640),  INT32_C(  2147387087),  INT32_C(  1014397444),  INT32_C(   136216154), -INT32_C(   508806114),  INT32_C(  2147400968), -INT32_C(  1781112258) },
+      {  INT32_C(  1488185464),  INT32_C(   814160336),  INT32_C(   921009560), -INT32_C(  1734738820), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(   447668270) },
+      { -INT32_C(  1766766821), -INT32_C(   672511303),  INT32_C(  1490412598),  INT32_C(  1614292606), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(  1946836161) },
+      {  INT32_C(           0),  INT32_C(   199349246),  INT32_C(  2147483647),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1638677534),  INT32_C(  2147483647), -INT32_C(  1790607174) } },
+    { UINT8_C(178),
+      { -INT32_C(  1959550731), -INT32_C(  1173690888), -INT32_C(  2147395019), -INT32_C(  2147399374),  INT32_C(  2147431097), -INT32_C(    88904824), -INT32_C(  2022845291), -INT32_C(   421967468) },
+      { -INT32_C(  1818843895), -INT32_C(   207428616),  INT32_C(   109929420),  INT32_C(  1930689150), -INT32_C(  1136504099),  INT32_C(   461941073), -INT32_C(   799652097),  INT32_C(   979775697) },
+      { -INT32_C(  1471932183), -INT32_C(   628810433),  INT32_C(   575551669),  INT32_C(  1909198378),  INT32_C(   344839913),  INT32_C(   893644344), -INT32_C(   159771911),  INT32_C(   823735119) },
+      {  INT32_C(           0), -INT32_C(  1197039830),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1833055288),  INT32_C(   108208088),  INT32_C(           0), -INT32_C(    69912823) } },
+    { UINT8_C(187),
+      {  INT32_C(  2147465917), -INT32_C(  2138491498),  INT32_C(  2147474255), -INT32_C(  2147409874), -INT32_C(  1623748096), -INT32_C(  1250199104),  INT32_C(  2147465829),  INT32_C(  2147397245) },
+      { -INT32_C(  2147450880),  INT32_C(  1717866962), -INT32_C(    13245934), -INT32_C(   935553630),  INT32_C(  1406179073),  INT32_C(   595602173),  INT32_C(   519901529), -INT32_C(  2147450880) },
+      { -INT32_C(  2147450880),  INT32_C(   133086638), -INT32_C(   511752857),  INT32_C(   196256208),  INT32_C(  1135393551), -INT32_C(  1083480251),  INT32_C(  1999105078), -INT32_C(  2147450880) },
+      {  INT32_C(  2147483647), -INT32_C(  1606399670),  INT32_C(           0), -INT32_C(  1533582458), -INT32_C(   777656881), -INT32_C(  1109511823),  INT32_C(           0),  INT32_C(  2147483647) } },
+    { UINT8_C(220),
+      {  INT32_C(  1025889499), -INT32_C(  2147462705),  INT32_C(  2147464482),  INT32_C(   261804867), -INT32_C(  2147417334),  INT32_C(  2025548097),  INT32_C(  1850011610),  INT32_C(   777051614) },
+      { -INT32_C(  1948756896), -INT32_C(   941962838), -INT32_C(  2147450880),  INT32_C(   745568352), -INT32_C(   987426384), -INT32_C(    13413996), -INT32_C(  1686824018),  INT32_C(  1932511812) },
+      {  INT32_C(  2061045595),  INT32_C(   194961310), -INT32_C(  2147450880),  INT32_C(  2095427142),  INT32_C(   596939704),  INT32_C(   181131001),  INT32_C(  1951305616),  INT32_C(   728055718) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(  2147483647), -INT32_C(    19202637),              INT32_MIN,  INT32_C(           0),  INT32_C(   879695200),  INT32_C(   880482433) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i r = simde_mm256_maskz_dpwssds_epi32(test_vec[i].k, src, a, b);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_dpwssds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const int32_t a[16];
+    const int32_t b[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { { -INT32_C(   320392849), -INT32_C(  2147437104),  INT32_C(  2147388165),  INT32_C(  2147470039),  INT32_C(  1583519740), -INT32_C(  1275288082),  INT32_C(  2147450705), -INT32_C(  2147404121),
+         INT32_C(  1650344127), -INT32_C(  2147438213),  INT32_C(  2147456996),  INT32_C(   156583850),  INT32_C(  1901675341), -INT32_C(   122562427),  INT32_C(  2147432155),  INT32_C(   203199803) },
+      { -INT32_C(  1060549246),  INT32_C(   232423807), -INT32_C(  2147450880), -INT32_C(  1585881690), -INT32_C(    79227396), -INT32_C(  1360558006), -INT32_C(  2147450880),  INT32_C(  1857357816),
+        -INT32_C(  2069525978), -INT32_C(   775107201), -INT32_C(  1134280626), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  1328832829), -INT32_C(  1288341135), -INT32_C(   780465766) },
+      {  INT32_C(  2009606204), -INT32_C(   448708791), -INT32_C(  2147450880), -INT32_C(  1602590587),  INT32_C(   596519153), -INT32_C(  1170158231), -INT32_C(  2147450880), -INT32_C(  1687583164),
+         INT32_C(  1386818024), -INT32_C(  2039081406),  INT32_C(   938485469), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  1094251719),  INT32_C(  1798540995),  INT32_C(  1875016903) },
+      { -INT32_C(   612255761),              INT32_MIN,  INT32_C(  2147483647),  INT32_C(  2147483647),  INT32_C(  1631502490), -INT32_C(   507683320),  INT32_C(  2147483647),              INT32_MIN,
+         INT32_C(   658437148), -INT32_C(  1853091263),  INT32_C(  2063386874),  INT32_C(  2147483647),  INT32_C(  2147483647),  INT32_C(   144485053),  INT32_C(   706691197), -INT32_C(    59000793) } },
+    { { -INT32_C(  1352797110), -INT32_C(  2147390054),  INT32_C(  2147425902),  INT32_C(  2147385852),  INT32_C(   557678805),  INT32_C(  2116974303),  INT32_C(  2147394703), -INT32_C(  2147407347),
+         INT32_C(   463130461), -INT32_C(  2147479928),  INT32_C(  2131832143),  INT32_C(  2147392243),  INT32_C(  2118577636), -INT32_C(  2147426715),  INT32_C(  2147480869), -INT32_C(  1214461683) },
+      {  INT32_C(   419138050), -INT32_C(    69717990), -INT32_C(   232990822), -INT32_C(  1960877217), -INT32_C(   871861688), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  2147450880),
+         INT32_C(   517975801), -INT32_C(  2147450880),  INT32_C(  2008943283), -INT32_C(  2147450880),  INT32_C(  1552221594), -INT32_C(  2147450880),  INT32_C(  2115396351), -INT32_C(   668573598) },
+      { -INT32_C(   996707541),  INT32_C(  1526313213),  INT32_C(  1365712874), -INT32_C(  2034141919),  INT32_C(   477922169), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  2147450880),
+         INT32_C(   101602463), -INT32_C(  2147450880), -INT32_C(   476702539), -INT32_C(  2147450880), -INT32_C(   525496081), -INT32_C(  2147450880), -INT32_C(  1028139486),  INT32_C(    22117161) },
+      {              INT32_MIN,              INT32_MIN,  INT32_C(  1988828278),  INT32_C(  2147483647), -INT32_C(   471985987),  INT32_C(  2147483647),  INT32_C(  2147483647),  INT32_C(       76301),
+         INT32_C(    26024502),  INT32_C(        3720),  INT32_C(  1926179122),  INT32_C(  2147483647),  INT32_C(  1887874699),  INT32_C(       56933),  INT32_C(  1369445053), -INT32_C(   439953211) } },
+    { {  INT32_C(  1364396012),  INT32_C(   432282365),  INT32_C(  2147472263), -INT32_C(  2147410474),  INT32_C(  1326385925), -INT32_C(  1448308403),  INT32_C(  2147386047), -INT32_C(  1860101285),
+         INT32_C(   469501560),  INT32_C(  2147409890), -INT32_C(  2147398040),  INT32_C(  2147467127),  INT32_C(  1493916602),  INT32_C(  1224047883),  INT32_C(  2126852554), -INT32_C(  1902411668) },
+      { -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(  1228482988),  INT32_C(  1660123401),  INT32_C(  1241309102),  INT32_C(  1467215019), -INT32_C(    73489065),  INT32_C(   416773020),
+         INT32_C(    86359674), -INT32_C(  1400668009),  INT32_C(  1849722633),  INT32_C(   446642062),  INT32_C(  2050499612), -INT32_C(   505001458),  INT32_C(   998951402), -INT32_C(  2147450880) },
+      { -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(    24670632),  INT32_C(   669387479),  INT32_C(   758758551),  INT32_C(  2091208471),  INT32_C(  1747352072), -INT32_C(  1305335180),
+        -INT32_C(   572214507), -INT32_C(    37443688),  INT32_C(   206761862),  INT32_C(   460039776),  INT32_C(   981376325),  INT32_C(   342550506),  INT32_C(    26239072), -INT32_C(  2147450880) },
+      {  INT32_C(  2147483647),  INT32_C(  2147483647),  INT32_C(  1830009270), -INT32_C(  1802696265),  INT32_C(  1688438723), -INT32_C(   834164023),  INT32_C(  1392422123), -INT32_C(  1665110519),
+         INT32_C(   788298350),  INT32_C(  2147483647), -INT32_C(  1927760738),  INT32_C(  1868992044),  INT32_C(  1728781014),  INT32_C(  1066881299),  INT32_C(  1791340842),  INT32_C(   245071980) } },
+    { { -INT32_C(  2147436882), -INT32_C(  2147404769),  INT32_C(   502015602),  INT32_C(   421752179),  INT32_C(  2147442099), -INT32_C(   597162867),  INT32_C(   311388541), -INT32_C(  2147447917),
+         INT32_C(  2096217102), -INT32_C(  2147402708),  INT32_C(   576360924), -INT32_C(  2147403062), -INT32_C(   151184908), -INT32_C(  2147415068),  INT32_C(   473618904), -INT32_C(   655395966) },
+      { -INT32_C(  1564888335), -INT32_C(   152969527), -INT32_C(   131041607),  INT32_C(   389266115), -INT32_C(  1285742315),  INT32_C(  1821078962),  INT32_C(  1871224782),  INT32_C(  1377716381),
+        -INT32_C(   831747706), -INT32_C(    64979233),  INT32_C(   346813627), -INT32_C(   726307442),  INT32_C(  1458379103), -INT32_C(  2147450880),  INT32_C(   510305609),  INT32_C(  1296430698) },
+      {  INT32_C(   952460601),  INT32_C(    72543714),  INT32_C(  1478885466), -INT32_C(   388267476),  INT32_C(  1683498733), -INT32_C(  1026331690),  INT32_C(  1012174627),  INT32_C(  1995166752),
+        -INT32_C(  1465820786),  INT32_C(   115075315),  INT32_C(   414122932), -INT32_C(  1789298720), -INT32_C(  1301020574), -INT32_C(  2147450880),  INT32_C(   783022620),  INT32_C(    18031508) },
+      {              INT32_MIN, -INT32_C(  2110550365),  INT32_C(   459618972),  INT32_C(   957521304),  INT32_C(  1727862812), -INT32_C(   200566294),  INT32_C(  1463864647), -INT32_C(  1716266819),
+         INT32_C(  1684753486),              INT32_MIN,  INT32_C(   607059773), -INT32_C(   984128265), -INT32_C(   592314954),  INT32_C(       68580),  INT32_C(   601658530), -INT32_C(   672307223) } },
+    { { -INT32_C(  2147430563), -INT32_C(  2147437501),  INT32_C(   663653262), -INT32_C(  2147478027),  INT32_C(  1990140713), -INT32_C(  2147440975),  INT32_C(  1632745193), -INT32_C(  1228054765),
+         INT32_C(  1717191933),  INT32_C(  1364972092), -INT32_C(  1071448717),  INT32_C(  2147481950), -INT32_C(  2115860627), -INT32_C(  2147416712),  INT32_C(  1240129397), -INT32_C(  1455739609) },
+      { -INT32_C(   858943366), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(   442310341),  INT32_C(  1186461720), -INT32_C(  2147450880),  INT32_C(  1208003947),
+        -INT32_C(  2147450880), -INT32_C(  1850042970), -INT32_C(   551821312),  INT32_C(   676095524), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  1178443768), -INT32_C(  2147450880) },
+      {  INT32_C(  2133018437), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(  1150410290),  INT32_C(   198336630), -INT32_C(  2147450880),  INT32_C(  1709502454),
+        -INT32_C(  2147450880),  INT32_C(  1243240534), -INT32_C(  1922566138), -INT32_C(   820918192), -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(  1065748621), -INT32_C(  2147450880) },
+      {              INT32_MIN,  INT32_C(       46147),  INT32_C(  2147483647),  INT32_C(        5621),  INT32_C(  1939825521), -INT32_C(  2142641953),  INT32_C(  2147483647), -INT32_C(   660469531),
+         INT32_C(  2147483647),  INT32_C(   213760228), -INT32_C(   807673776),  INT32_C(  1645487530),  INT32_C(    31623021),  INT32_C(       66936),  INT32_C(  1001520489),  INT32_C(   691744039) } },
+    { {  INT32_C(   718372133),  INT32_C(   354143810), -INT32_C(   789218957),  INT32_C(   675155679),  INT32_C(  2147433106), -INT32_C(   464885093),  INT32_C(  2147400617), -INT32_C(  1105936954),
+        -INT32_C(  2147417516),  INT32_C(  2147456438),  INT32_C(  2147453085),  INT32_C(   102405889),  INT32_C(   400472006), -INT32_C(  2147397462), -INT32_C(   172455030),  INT32_C(  2003789250) },
+      {  INT32_C(  1144041271), -INT32_C(  1305323394), -INT32_C(  2137417043), -INT32_C(  1573231369),  INT32_C(   509762727), -INT32_C(  2147450880),  INT32_C(   987740877), -INT32_C(  2147450880),
+        -INT32_C(   181802972),  INT32_C(  1702333986),  INT32_C(  1138551573),  INT32_C(  1616251067),  INT32_C(   476359652), -INT32_C(  1713184344),  INT32_C(   728356406), -INT32_C(  1315812139) },
+      {  INT32_C(   743242120), -INT32_C(   114838486), -INT32_C(  1731611044), -INT32_C(   514772625),  INT32_C(  1108918256), -INT32_C(  2147450880), -INT32_C(   693123843), -INT32_C(  2147450880),
+        -INT32_C(   164864861), -INT32_C(  1760828725), -INT32_C(   763979808),  INT32_C(  1254600353),  INT32_C(  1131356128), -INT32_C(  1051907299), -INT32_C(   785300026),  INT32_C(  1830243282) },
+      {  INT32_C(   950570909), -INT32_C(    50744692),  INT32_C(   561569216),  INT32_C(  1190816594),  INT32_C(  1890045266),  INT32_C(  1682598555),  INT32_C(  2147483647),  INT32_C(  1041546694),
+                     INT32_MIN,  INT32_C(  1667488713),  INT32_C(  2087673189),  INT32_C(   527953270),  INT32_C(   350238370), -INT32_C(  1813527636), -INT32_C(   496709785),  INT32_C(  1824846234) } },
+    { {  INT32_C(   170019975), -INT32_C(  2147432010),  INT32_C(  2147446186),  INT32_C(   321781489), -INT32_C(  2001127567), -INT32_C(  2147395612),  INT32_C(  2147440864), -INT32_C(   716627077),
+        -INT32_C(  2147441236),  INT32_C(  2147446106),  INT32_C(  2147465798), -INT32_C(   505233149),  INT32_C(  2147428637),  INT32_C(  1409867232), -INT32_C(  1914124918),  INT32_C(  2147481291) },
+      { -INT32_C(  2147450880), -INT32_C(   884530823), -INT32_C(   104302558),  INT32_C(   315705794),  INT32_C(    36190838),  INT32_C(  1041388586),  INT32_C(   940466718), -INT32_C(   561515936),
+         INT32_C(   624895755), -INT32_C(  1425468637), -INT32_C(  2147450880),  INT32_C(  1388538717), -INT32_C(   527720936),  INT32_C(   342118537), -INT32_C(  1774562806),  INT32_C(   384946847) },
+      { -INT32_C(  2147450880),  INT32_C(  1095087652),  INT32_C(  1486169443), -INT32_C(  1363211888),  INT32_C(  2091998509),  INT32_C(   435292276), -INT32_C(   538663107), -INT32_C(   861847680),
+        -INT32_C(   978290011),  INT32_C(  1164404132), -INT32_C(  2147450880), -INT32_C(  2020171431), -INT32_C(  1752954304),  INT32_C(   857278456), -INT32_C(  1532690145),  INT32_C(   750237313) },
+      {  INT32_C(  2147483647),              INT32_MIN,  INT32_C(  2147483647),  INT32_C(   267806208), -INT32_C(  1626523177), -INT32_C(  1995228688),  INT32_C(  1458727550), -INT32_C(   660637086),
+        -INT32_C(  1975966701),  INT32_C(  1888468069),  INT32_C(  2147483647), -INT32_C(  1824332646),  INT32_C(  2147483647),  INT32_C(  1520208732), -INT32_C(  1274824158),  INT32_C(  2147483647) } },
+    { { -INT32_C(   341916873),  INT32_C(  1484679242),  INT32_C(  2147437176), -INT32_C(  1011948546), -INT32_C(  2147394503), -INT32_C(  2147393694), -INT32_C(  2147405579),  INT32_C(  2147458005),
+         INT32_C(  2147463051),  INT32_C(  2147431251), -INT32_C(   122471557),  INT32_C(  1253142885), -INT32_C(  2147468671), -INT32_C(   169441286),  INT32_C(  2147476051),  INT32_C(  2147457316) },
+      {  INT32_C(  1978295971),  INT32_C(  1725109101),  INT32_C(   800379372), -INT32_C(  1649884313),  INT32_C(  1105752190), -INT32_C(  2070956409),  INT32_C(   677801675), -INT32_C(  2147450880),
+        -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(   578836472),  INT32_C(  2038489570),  INT32_C(    52395793), -INT32_C(  2147450880), -INT32_C(    44612739) },
+      { -INT32_C(  1397784008),  INT32_C(  1279040861),  INT32_C(   488066034),  INT32_C(  1037494539),  INT32_C(   654652161), -INT32_C(   663726917),  INT32_C(    14263447), -INT32_C(  2147450880),
+        -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(  1150370810), -INT32_C(   544731098), -INT32_C(  1469649510), -INT32_C(  2147450880), -INT32_C(   222869635) },
+      { -INT32_C(  1831809067),  INT32_C(  1872825687),  INT32_C(  2009042108), -INT32_C(  1319314725), -INT32_C(  1602844609),              INT32_MIN,              INT32_MIN,  INT32_C(  2147483647),
+         INT32_C(  2147483647),  INT32_C(  2147483647),  INT32_C(  2025012091),  INT32_C(   706204196),              INT32_MIN, -INT32_C(   340571250),  INT32_C(  2147483647),  INT32_C(  2147483647) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi32(test_vec[i].b);
+    simde__m512i r = simde_mm512_dpwssds_epi32(src, a, b);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_dpwssds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t b[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { {  INT32_C(  1846812853), -INT32_C(  2147405861), -INT32_C(   201457491),  INT32_C(  2147439870),  INT32_C(  2147395766), -INT32_C(   209569230), -INT32_C(   782933018), -INT32_C(  2147445036),
+         INT32_C(   905486093), -INT32_C(  1789293333), -INT32_C(  2147397479),  INT32_C(  1311282497), -INT32_C(  1801732536), -INT32_C(  2147463108), -INT32_C(  1118706481),  INT32_C(  2147418857) },
+      UINT16_C(29201),
+      { -INT32_C(  1104126950), -INT32_C(   465683795), -INT32_C(  2147450880),  INT32_C(  1959514234), -INT32_C(   286708828), -INT32_C(   661305597), -INT32_C(  1647550245), -INT32_C(   786338430),
+        -INT32_C(   120764470), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  1979653887),  INT32_C(   512345837), -INT32_C(  1223846886), -INT32_C(  1828884018) },
+      { -INT32_C(  1502422739), -INT32_C(   919473495), -INT32_C(  2147450880),  INT32_C(   532831754), -INT32_C(  1866520815), -INT32_C(  1991702253), -INT32_C(  1066922900), -INT32_C(  1750795471),
+        -INT32_C(  1551939156), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(   335500989),  INT32_C(   818387173),  INT32_C(  1374726584), -INT32_C(   719485271) },
+      {  INT32_C(  1998728359), -INT32_C(  2147405861), -INT32_C(   201457491),  INT32_C(  2147439870),  INT32_C(  2147483647), -INT32_C(   209569230), -INT32_C(   782933018), -INT32_C(  2147445036),
+         INT32_C(   905486093),  INT32_C(   358190315), -INT32_C(  2147397479),  INT32_C(  1311282497), -INT32_C(  1470870901), -INT32_C(  1664194884), -INT32_C(   900318545),  INT32_C(  2147418857) } },
+    { { -INT32_C(  2147470143), -INT32_C(  2100577549),  INT32_C(  2147482775),  INT32_C(   178512422),  INT32_C(   768521200), -INT32_C(  2147406444),  INT32_C(   169088185),  INT32_C(  2147388593),
+        -INT32_C(  1936522336),  INT32_C(  2147441990), -INT32_C(  2147423919), -INT32_C(  1473713827), -INT32_C(  2147436040),  INT32_C(  2147449606),  INT32_C(  2147474534),  INT32_C(  1196510005) },
+      UINT16_C(22214),
+      {  INT32_C(   615055627), -INT32_C(   303520848), -INT32_C(  2147450880),  INT32_C(  2058179058),  INT32_C(   416279054),  INT32_C(   484391354),  INT32_C(  1288521092),  INT32_C(  1639600140),
+        -INT32_C(  1609765543), -INT32_C(  1276352323),  INT32_C(  2100251582), -INT32_C(  2084806497), -INT32_C(  1443848300),  INT32_C(  1357380204), -INT32_C(  2147450880), -INT32_C(  1974553293) },
+      { -INT32_C(   598073651),  INT32_C(   991803605), -INT32_C(  2147450880), -INT32_C(  1492155834),  INT32_C(  1455368586), -INT32_C(  1036071540), -INT32_C(  1715405445),  INT32_C(   711608882),
+        -INT32_C(   944333934),  INT32_C(  1581518456), -INT32_C(  1070316492),  INT32_C(   920896657),  INT32_C(   286468496),  INT32_C(   607445301), -INT32_C(  2147450880), -INT32_C(  1140311409) },
+      { -INT32_C(  2147470143), -INT32_C(  1740122197),  INT32_C(  2147483647),  INT32_C(   178512422),  INT32_C(   768521200), -INT32_C(  2147406444), -INT32_C(   357036571),  INT32_C(  2147483647),
+        -INT32_C(  1936522336),  INT32_C(  1776762510),              INT32_MIN, -INT32_C(  1473713827),              INT32_MIN,  INT32_C(  2147449606),  INT32_C(  2147483647),  INT32_C(  1196510005) } },
+    { { -INT32_C(  2147420616),  INT32_C(  2147433144),  INT32_C(  2147426511), -INT32_C(   250149617), -INT32_C(   274559558), -INT32_C(  1245706116),  INT32_C(  1333765158),  INT32_C(   312548151),
+         INT32_C(   342020562), -INT32_C(  2147406698), -INT32_C(  2147406223), -INT32_C(  2147395186), -INT32_C(  2147430530), -INT32_C(  2147383785), -INT32_C(  2063215373),  INT32_C(  2147402940) },
+      UINT16_C(59122),
+      { -INT32_C(   836485006), -INT32_C(  1350999683), -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(   455326849), -INT32_C(  1257011973), -INT32_C(   972672446),  INT32_C(  1819056461),
+         INT32_C(  1303280166), -INT32_C(     8788755), -INT32_C(   129476488),  INT32_C(  1649978133), -INT32_C(   831515010),  INT32_C(  1415886681), -INT32_C(   994484828),  INT32_C(  1860254535) },
+      {  INT32_C(  1090347404), -INT32_C(  1168742304), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  2020966051), -INT32_C(  1639042016),  INT32_C(  1679334219), -INT32_C(   224154524),
+        -INT32_C(   934132031), -INT32_C(   694451493),  INT32_C(  1379555575), -INT32_C(  2063002636), -INT32_C(   433964974),  INT32_C(  1070611089), -INT32_C(  1952172865),  INT32_C(  1066030114) },
+      { -INT32_C(  2147420616),  INT32_C(  2147483647),  INT32_C(  2147426511), -INT32_C(   250149617),  INT32_C(    71376757), -INT32_C(  1186231898),  INT32_C(   621755404),  INT32_C(   780327439),
+         INT32_C(   342020562), -INT32_C(  1923927656), -INT32_C(  1673192823), -INT32_C(  2147395186), -INT32_C(  2147430530), -INT32_C(  2073315648), -INT32_C(  1287488557),  INT32_C(  2147483647) } },
+    { {  INT32_C(  2147407698), -INT32_C(   551871066), -INT32_C(  2147414542), -INT32_C(  1024880536),  INT32_C(  2147417407), -INT32_C(  1093972711),  INT32_C(  2147419949), -INT32_C(  2147469191),
+        -INT32_C(  2147385423),  INT32_C(  2147424881),  INT32_C(  1914582138), -INT32_C(  2147409231),  INT32_C(  2147397761), -INT32_C(   755556434),  INT32_C(  1544567431), -INT32_C(  2147410655) },
+      UINT16_C(  994),
+      { -INT32_C(  2147450880), -INT32_C(  1033755136), -INT32_C(  2147450880),  INT32_C(   268045948),  INT32_C(   877405869), -INT32_C(   973860742),  INT32_C(   842938448), -INT32_C(   955822198),
+         INT32_C(  1068121176),  INT32_C(   902079867),  INT32_C(  2069840645), -INT32_C(   148394243), -INT32_C(  2127590274), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  2147450880) },
+      { -INT32_C(  2147450880),  INT32_C(   830444082), -INT32_C(  2147450880), -INT32_C(  1494491636), -INT32_C(  1080140557), -INT32_C(   447884694),  INT32_C(  1692249608),  INT32_C(  2010922062),
+        -INT32_C(  2114691423), -INT32_C(   132078710), -INT32_C(   402648437), -INT32_C(   773393543), -INT32_C(  1987568608), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  2147450880) },
+      {  INT32_C(  2147407698), -INT32_C(  1025197500), -INT32_C(  2147414542), -INT32_C(  1024880536),  INT32_C(  2147417407), -INT32_C(  1041628671),  INT32_C(  2147483647),              INT32_MIN,
+                     INT32_MIN,  INT32_C(  2147483647),  INT32_C(  1914582138), -INT32_C(  2147409231),  INT32_C(  2147397761), -INT32_C(   755556434),  INT32_C(  1544567431), -INT32_C(  2147410655) } },
+    { { -INT32_C(  2147410559), -INT32_C(   431294687),  INT32_C(  2147427344), -INT32_C(  2147468580),  INT32_C(  2147392588), -INT32_C(  2147391718),  INT32_C(  2147410032),  INT32_C(   407654029),
+         INT32_C(  2147481224), -INT32_C(  2147439079),  INT32_C(  2147474423), -INT32_C(  2009059722),  INT32_C(  1993933689),  INT32_C(  1880910344),  INT32_C(  2028953002),  INT32_C(   400477582) },
+      UINT16_C(16837),
+      {  INT32_C(  1683894407),  INT32_C(  2055963714), -INT32_C(   947350082), -INT32_C(   442751904), -INT32_C(  2147450880), -INT32_C(   608957245), -INT32_C(   103101470), -INT32_C(  1307016274),
+         INT32_C(  1036048713), -INT32_C(  2147450880),  INT32_C(  1044405876),  INT32_C(   163629040), -INT32_C(  1716461247), -INT32_C(  2147450880), -INT32_C(   986376845),  INT32_C(  1395333038) },
+      { -INT32_C(  2077051563), -INT32_C(  1887262383), -INT32_C(   732817912),  INT32_C(  1261772057), -INT32_C(  2147450880),  INT32_C(   336201927),  INT32_C(   486867840), -INT32_C(   347789007),
+         INT32_C(  1401031710), -INT32_C(  2147450880), -INT32_C(   635029811),  INT32_C(   154869515), -INT32_C(   469235043), -INT32_C(  2147450880),  INT32_C(  1908277419),  INT32_C(    55007097) },
+      {              INT32_MIN, -INT32_C(   431294687),  INT32_C(  2147483647), -INT32_C(  2147468580),  INT32_C(  2147392588), -INT32_C(  2147391718),  INT32_C(  2123762354),  INT32_C(   177891667),
+         INT32_C(  2147483647), -INT32_C(  2147439079),  INT32_C(  2147474423), -INT32_C(  2009059722),  INT32_C(  1993933689),  INT32_C(  1880910344),  INT32_C(  1591636945),  INT32_C(   400477582) } },
+    { {  INT32_C(  2147463259), -INT32_C(  2147416392), -INT32_C(  1052551786), -INT32_C(  1639126122), -INT32_C(  1022500713),  INT32_C(  2147384435), -INT32_C(  2147424481), -INT32_C(   359054344),
+         INT32_C(  1314168701), -INT32_C(   349335972),  INT32_C(  2147392098), -INT32_C(  1646209058),  INT32_C(  2147450771), -INT32_C(  1624681685), -INT32_C(  2147436721), -INT32_C(  2147409803) },
+      UINT16_C(60333),
+      { -INT32_C(  1232768594),  INT32_C(   923888939), -INT32_C(  2147450880), -INT32_C(  2014539945),  INT32_C(  1282202616),  INT32_C(  1207477678),  INT32_C(  1390270687), -INT32_C(  1133882754),
+        -INT32_C(  2147450880), -INT32_C(  1855858465), -INT32_C(   302100896),  INT32_C(   947269634), -INT32_C(  2147450880), -INT32_C(   490919012), -INT32_C(  2026033307),  INT32_C(  1319462842) },
+      {  INT32_C(  1533913174), -INT32_C(  1368237427), -INT32_C(  2147450880),  INT32_C(  1480651031),  INT32_C(   219932744),  INT32_C(   345587573),  INT32_C(   491878830), -INT32_C(   519236845),
+        -INT32_C(  2147450880), -INT32_C(   540228343),  INT32_C(  1842516434), -INT32_C(   815670591), -INT32_C(  2147450880),  INT32_C(  1798649260), -INT32_C(   359329479), -INT32_C(  1891779965) },
+      {  INT32_C(  1054084720), -INT32_C(  2147416392),  INT32_C(  1094931862),              INT32_MIN, -INT32_C(  1022500713),  INT32_C(  1868917297), -INT32_C(  2147424481), -INT32_C(   118851404),
+         INT32_C(  2147483647),  INT32_C(    35332479),  INT32_C(  2147392098), -INT32_C(  1943303146),  INT32_C(  2147450771), -INT32_C(  1676878820), -INT32_C(  1924435379),              INT32_MIN } },
+    { { -INT32_C(  1372052910), -INT32_C(  2147415825),  INT32_C(  2147408804), -INT32_C(  2147458663), -INT32_C(   553020856), -INT32_C(  1568740916), -INT32_C(  2147421289), -INT32_C(    76212848),
+        -INT32_C(   246685134),  INT32_C(  2147435598), -INT32_C(  2147400633), -INT32_C(  1651586660), -INT32_C(  2147407863),  INT32_C(  2147405703), -INT32_C(  1567124888), -INT32_C(  2147465251) },
+      UINT16_C(63038),
+      { -INT32_C(  1249368000),  INT32_C(  2109767214),  INT32_C(  1473035103), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  1284377879), -INT32_C(  2147450880),  INT32_C(  1459864279),
+        -INT32_C(  1770738845), -INT32_C(  1166376083),  INT32_C(   732961425), -INT32_C(  1255854237), -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(  1027985434),  INT32_C(   425429695) },
+      {  INT32_C(   342537563),  INT32_C(   426373240),  INT32_C(  1231119159), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  1634632198), -INT32_C(  2147450880),  INT32_C(   548517519),
+        -INT32_C(    99945518), -INT32_C(  1751749897),  INT32_C(  1324599374), -INT32_C(  1312028108), -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(   567309366),  INT32_C(   152686791) },
+      { -INT32_C(  1372052910), -INT32_C(  2066439617),  INT32_C(  2123385433),  INT32_C(       24985),  INT32_C(  1594462792), -INT32_C(  1187952809), -INT32_C(  2147421289), -INT32_C(    76212848),
+        -INT32_C(   246685134),  INT32_C(  1749904885), -INT32_C(  2018329467), -INT32_C(  1651586660),  INT32_C(       75785),  INT32_C(  2147483647), -INT32_C(  1796150028), -INT32_C(  1769472199) } },
+    { { -INT32_C(  2147469027),  INT32_C(   395606546), -INT32_C(  2147387090),  INT32_C(  2147403720),  INT32_C(  1797884649),  INT32_C(  1986415337), -INT32_C(  2147416796), -INT32_C(   287894747),
+         INT32_C(  2147453742),  INT32_C(  2147420552),  INT32_C(  2147442943), -INT32_C(   809185866), -INT32_C(  2147415683),  INT32_C(  2104831859), -INT32_C(  2147472665),  INT32_C(  2147418277) },
+      UINT16_C( 6328),
+      { -INT32_C(  1675325183),  INT32_C(  1498893619), -INT32_C(  2147450880),  INT32_C(   526344029),  INT32_C(  2107640521), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  2038779117),
+         INT32_C(  1788328077), -INT32_C(  2147450880),  INT32_C(  1828934441),  INT32_C(   163607805), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(   957007497) },
+      { -INT32_C(   145812125), -INT32_C(  1271877196), -INT32_C(  2147450880),  INT32_C(  1094520169), -INT32_C(   490219295), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(   591979249),
+        -INT32_C(  2080221023), -INT32_C(  2147450880), -INT32_C(   126336289), -INT32_C(  1025928493), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  1843359360) },
+      { -INT32_C(  2147469027),  INT32_C(   395606546), -INT32_C(  2147387090),  INT32_C(  2147483647),  INT32_C(  1529644274),  INT32_C(  2147483647), -INT32_C(  2147416796), -INT32_C(   153374344),
+         INT32_C(  2147453742),  INT32_C(  2147420552),  INT32_C(  2147442943), -INT32_C(  1685305347),  INT32_C(       67965),  INT32_C(  2104831859), -INT32_C(  2147472665),  INT32_C(  2147418277) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi32(test_vec[i].b);
+    simde__m512i r = simde_mm512_mask_dpwssds_epi32(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_dpwssds_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t src[16];
+    const int32_t a[16];
+    const int32_t b[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { UINT16_C( 8080),
+      {  INT32_C(  2147402632), -INT32_C(  2147451722),  INT32_C(  1349975875),  INT32_C(  2143324076), -INT32_C(  1527430789), -INT32_C(   581089477), -INT32_C(  2147454402),  INT32_C(   967635317),
+        -INT32_C(  1116763993), -INT32_C(   478138770),  INT32_C(  1795658838),  INT32_C(  2147412928),  INT32_C(  1263995731),  INT32_C(  2147418961),  INT32_C(  2147462589), -INT32_C(  1658239145) },
+      {  INT32_C(   696676454),  INT32_C(   802198389), -INT32_C(   416971083), -INT32_C(  1570885052), -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(  1856964401), -INT32_C(  1266318334),
+         INT32_C(  1878819645), -INT32_C(   445000571), -INT32_C(  2147450880), -INT32_C(  1123989600), -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(  2008286945),  INT32_C(  1720294075) },
+      {  INT32_C(  1609435742), -INT32_C(  1151771897),  INT32_C(  1765527624),  INT32_C(  1878945409), -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(  2066480889),  INT32_C(  1963816243),
+        -INT32_C(  1880982903),  INT32_C(  1868278890), -INT32_C(  2147450880), -INT32_C(  1073603395), -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(   916652514), -INT32_C(   167974996) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   620052859),  INT32_C(           0),  INT32_C(           0), -INT32_C(   563733604),
+                     INT32_MIN, -INT32_C(   433548669),  INT32_C(  2147483647),  INT32_C(  2147483647),  INT32_C(  2147483647),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(14380),
+      {  INT32_C(  2147431535), -INT32_C(  2147395827), -INT32_C(  2147397313), -INT32_C(  2147386051),  INT32_C(  1140724312), -INT32_C(  2147388448), -INT32_C(  2147402624), -INT32_C(   334964836),
+         INT32_C(  2147390102), -INT32_C(  1642315744), -INT32_C(  2147401284), -INT32_C(   843385892),  INT32_C(   459219874), -INT32_C(  2147440400), -INT32_C(   778514141), -INT32_C(   804891042) },
+      { -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(    84742562), -INT32_C(   602916219), -INT32_C(  2147450880),  INT32_C(   438605722),  INT32_C(   539503660), -INT32_C(   161026624),
+         INT32_C(  1735347481), -INT32_C(  2147450880),  INT32_C(   983659004), -INT32_C(   775538640), -INT32_C(   350899704), -INT32_C(  2147450880), -INT32_C(  1556409890),  INT32_C(   386474408) },
+      { -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(  1093105413),  INT32_C(   272955703), -INT32_C(  2147450880), -INT32_C(   572230650),  INT32_C(  1141666860), -INT32_C(  1017294448),
+        -INT32_C(    84462688), -INT32_C(  2147450880),  INT32_C(  1625525463), -INT32_C(   123905568), -INT32_C(  1742449973), -INT32_C(  2147450880),  INT32_C(  1878181639), -INT32_C(   538148019) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(  1988294300),              INT32_MIN,  INT32_C(           0),              INT32_MIN,  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(   490060726),  INT32_C(   178546414),  INT32_C(       43248),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(46216),
+      { -INT32_C(  1328553247), -INT32_C(  1107900105),  INT32_C(  1418554812), -INT32_C(   789373568), -INT32_C(  2147455970), -INT32_C(  2147449767), -INT32_C(  1405686969),  INT32_C(  2147431265),
+         INT32_C(  2147427286),  INT32_C(  1696665907),  INT32_C(  2147452168), -INT32_C(  2147400714),  INT32_C(   615055762), -INT32_C(  1769098638),  INT32_C(  2147458452), -INT32_C(  2147403599) },
+      { -INT32_C(  1050428858), -INT32_C(   987506622), -INT32_C(  1310930026),  INT32_C(  1728165426), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  1603078361), -INT32_C(  2147450880),
+         INT32_C(  1836706926), -INT32_C(  1729403603), -INT32_C(  1988678811), -INT32_C(   211344488),  INT32_C(  1626285044), -INT32_C(  2147450880), -INT32_C(   892491031), -INT32_C(  1476082911) },
+      {  INT32_C(  1529948441),  INT32_C(  1996567357), -INT32_C(  1228188315), -INT32_C(  2131281579), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(   159133696), -INT32_C(  2147450880),
+        -INT32_C(  1320192094),  INT32_C(  1549700042),  INT32_C(   783243704),  INT32_C(   360161328), -INT32_C(   649127073), -INT32_C(  2147450880),  INT32_C(   757293518), -INT32_C(    87198369) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1924227055),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  2147483647),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(  2039950585),  INT32_C(           0),  INT32_C(   433755615),  INT32_C(   378385010),  INT32_C(           0),              INT32_MIN } },
+    { UINT16_C(48782),
+      { -INT32_C(  1317452941),  INT32_C(  2147422725), -INT32_C(  1412016122),  INT32_C(  2147399806),  INT32_C(   423073806), -INT32_C(  1440039679),  INT32_C(  2147446691),  INT32_C(  1323792836),
+         INT32_C(  2147417715),  INT32_C(  2147472094), -INT32_C(  1972458681),  INT32_C(  2147460149), -INT32_C(  1728092204),  INT32_C(   773516075), -INT32_C(  2147438267),  INT32_C(  1612456145) },
+      {  INT32_C(  1823699892), -INT32_C(   691336238), -INT32_C(  1959812355),  INT32_C(  1228236252), -INT32_C(  2147450880), -INT32_C(  2000059824), -INT32_C(  2147450880), -INT32_C(   130227822),
+         INT32_C(   457175771), -INT32_C(  1190671725), -INT32_C(  1382764624),  INT32_C(  1777869422), -INT32_C(  1929131893), -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(  1197418884) },
+      { -INT32_C(  1379908931), -INT32_C(  1709555642), -INT32_C(  2004024023), -INT32_C(    23784643), -INT32_C(  2147450880), -INT32_C(  1764887476), -INT32_C(  2147450880), -INT32_C(   450368345),
+         INT32_C(  1606049292),  INT32_C(    10316103), -INT32_C(   622998524),  INT32_C(   440428217),  INT32_C(  1337066584), -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(   728474351) },
+      {  INT32_C(           0),  INT32_C(  2147483647), -INT32_C(   529005458),  INT32_C(  2147483647),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1376040230),
+         INT32_C(           0),  INT32_C(  1776010734), -INT32_C(  1498248501),  INT32_C(  2147483647),              INT32_MIN,  INT32_C(  2147483647),  INT32_C(           0),  INT32_C(  1562326210) } },
+    { UINT16_C(11723),
+      {  INT32_C(  2147461665), -INT32_C(  2147475902),  INT32_C(   271873677), -INT32_C(  1137558470),  INT32_C(  2147387682),  INT32_C(  2147450211), -INT32_C(  2147471376), -INT32_C(  2147455630),
+        -INT32_C(  2147423432), -INT32_C(  2147482362), -INT32_C(  2147459064),  INT32_C(   298232260), -INT32_C(   111285615),  INT32_C(  1407091682), -INT32_C(  2147414412), -INT32_C(  2088340984) },
+      { -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  1606649816),  INT32_C(  1662989595),  INT32_C(   197047153), -INT32_C(   638391447), -INT32_C(  1118337514),
+         INT32_C(   160600058), -INT32_C(  2053109063), -INT32_C(  2147450880), -INT32_C(   962650214), -INT32_C(   713320277),  INT32_C(  1231911360), -INT32_C(  2147450880), -INT32_C(  2147450880) },
+      { -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(  1816306560), -INT32_C(  1029502534), -INT32_C(  2103105271), -INT32_C(  2093384443), -INT32_C(   821226608),
+        -INT32_C(  1592821354), -INT32_C(  1224917022), -INT32_C(  2147450880), -INT32_C(  1639145016), -INT32_C(   522380427),  INT32_C(   552466159), -INT32_C(  2147450880), -INT32_C(  2147450880) },
+      {  INT32_C(  2147483647),  INT32_C(        7746),  INT32_C(           0),              INT32_MIN,  INT32_C(           0),  INT32_C(           0), -INT32_C(  2004981025), -INT32_C(  2089913795),
+                     INT32_MIN,  INT32_C(           0),  INT32_C(       24584),  INT32_C(   470502728),  INT32_C(           0),  INT32_C(  1493190667),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(38874),
+      { -INT32_C(  1108572811), -INT32_C(  2147481862), -INT32_C(   430289169), -INT32_C(  2147401819), -INT32_C(   810091177), -INT32_C(  2147384711), -INT32_C(   891714020), -INT32_C(   589332345),
+         INT32_C(  2035126457), -INT32_C(  2147408988), -INT32_C(  1938625608),  INT32_C(  2147433649),  INT32_C(   571122539),  INT32_C(  1756997636),  INT32_C(  2042505252),  INT32_C(  2147422998) },
+      { -INT32_C(  2147450880), -INT32_C(   820022509), -INT32_C(  2147450880),  INT32_C(  1525121050), -INT32_C(  2147450880),  INT32_C(   759517598), -INT32_C(  1152679751),  INT32_C(  1064283214),
+         INT32_C(  1293773669), -INT32_C(  1543581369),  INT32_C(   662868382), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  1194748346), -INT32_C(   726986923), -INT32_C(  1315430673) },
+      { -INT32_C(  2147450880), -INT32_C(  1384707660), -INT32_C(  2147450880), -INT32_C(   130091608), -INT32_C(  2147450880), -INT32_C(  1186898595), -INT32_C(   806838326), -INT32_C(  1667656700),
+        -INT32_C(   754512117),  INT32_C(   595602538), -INT32_C(   553937217), -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(  1258789035), -INT32_C(  1892351177),  INT32_C(  1094046286) },
+      {  INT32_C(           0), -INT32_C(  1809918529),  INT32_C(           0), -INT32_C(  2106917209),  INT32_C(  1337392471),  INT32_C(           0),  INT32_C(   127361038), -INT32_C(   410265834),
+         INT32_C(  1913723867),              INT32_MIN, -INT32_C(  1262707440),  INT32_C(           0),  INT32_C(  2147483647),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1719724640) } },
+    { UINT16_C(44321),
+      {  INT32_C(  1379463995), -INT32_C(  2147467327), -INT32_C(  2147421172),  INT32_C(  2147418558), -INT32_C(  2147463740),  INT32_C(   277690175),  INT32_C(  2147386900), -INT32_C(  2147477195),
+         INT32_C(  2147440777), -INT32_C(  2147402912), -INT32_C(  2147478659),  INT32_C(  2147453775), -INT32_C(  2147402784),  INT32_C(   300178010),  INT32_C(    21216897),  INT32_C(  2147390196) },
+      {  INT32_C(  2114893816),  INT32_C(    19087868), -INT32_C(   325203821), -INT32_C(   670260401), -INT32_C(  2147450880), -INT32_C(  1551935048), -INT32_C(   926472234), -INT32_C(  2147450880),
+        -INT32_C(  2147450880),  INT32_C(   715869003),  INT32_C(  1164135902),  INT32_C(  1909066421), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(   605944599),  INT32_C(  1223782322) },
+      {  INT32_C(   415196088),  INT32_C(   522048018),  INT32_C(   740737405),  INT32_C(  1917854830), -INT32_C(  2147450880),  INT32_C(   489517427), -INT32_C(  1175655603), -INT32_C(  2147450880),
+        -INT32_C(  2147450880), -INT32_C(  1822194648), -INT32_C(  1207936386), -INT32_C(  1888119567), -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(   939282125),  INT32_C(  1845544785) },
+      {  INT32_C(  1113158125),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   767876410),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(  2147483647),  INT32_C(           0), -INT32_C(  2013095231),  INT32_C(  1233066758),  INT32_C(           0),  INT32_C(  2147483647),  INT32_C(           0),  INT32_C(  2147483647) } },
+    { UINT16_C(29767),
+      {  INT32_C(  2147383649), -INT32_C(  2147427934), -INT32_C(  1361355429), -INT32_C(  2147450206),  INT32_C(   258452127),  INT32_C(  2147456302),  INT32_C(    19074417),  INT32_C(  2147448498),
+        -INT32_C(   537601612),  INT32_C(  2147464656), -INT32_C(  2147464298),  INT32_C(  2147386858), -INT32_C(  2147479029),  INT32_C(  2147425844), -INT32_C(  1760311597),  INT32_C(   529315258) },
+      { -INT32_C(  2147450880), -INT32_C(  1082297422), -INT32_C(   429355578),  INT32_C(   861737753), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  1361722735),
+         INT32_C(  2126742247),  INT32_C(  1268434382),  INT32_C(   862177941), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  1522321087), -INT32_C(  1018468894), -INT32_C(  2147450880) },
+      { -INT32_C(  2147450880), -INT32_C(  2016266646),  INT32_C(   753472474), -INT32_C(  2002425954), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(  2147450880),  INT32_C(   887619120),
+         INT32_C(  1695011894),  INT32_C(   743187131), -INT32_C(  1301086764), -INT32_C(  2147450880), -INT32_C(  2147450880), -INT32_C(   494168353), -INT32_C(  1638103743), -INT32_C(  2147450880) },
+      {  INT32_C(  2147483647), -INT32_C(  1226748704), -INT32_C(  1585291617),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  2147483647),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),              INT32_MIN,  INT32_C(           0),  INT32_C(        4619),  INT32_C(  1928131892),              INT32_MIN,  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi32(test_vec[i].b);
+    simde__m512i r = simde_mm512_maskz_dpwssds_epi32(test_vec[i].k, src, a, b);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_dpwssds_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_dpwssds_avx_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_dpwssds_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_dpwssds_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_dpwssds_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_dpwssds_avx_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_dpwssds_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_dpwssds_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_dpwssds_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_dpwssds_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_dpwssds_epi32)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,2643 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN expand
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/expand.h>
+
+static int
+test_simde_mm_mask_expand_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(  1909016608),  INT32_C(   258855105), -INT32_C(  1787177767),  INT32_C(   180341798) },
+      UINT8_C(  0),
+      { -INT32_C(  1519393256),  INT32_C(   910725594), -INT32_C(   507094484), -INT32_C(  2127226932) },
+      { -INT32_C(  1909016608),  INT32_C(   258855105), -INT32_C(  1787177767),  INT32_C(   180341798) } },
+    { {  INT32_C(  2035241239),  INT32_C(   710602005),  INT32_C(  1387215834),  INT32_C(  2137756792) },
+      UINT8_C( 15),
+      { -INT32_C(  1350620746),  INT32_C(  1176250892), -INT32_C(  2014908014), -INT32_C(  1042229844) },
+      { -INT32_C(  1350620746),  INT32_C(  1176250892), -INT32_C(  2014908014), -INT32_C(  1042229844) } },
+    { { -INT32_C(   726597361),  INT32_C(   274745475),  INT32_C(   447080548), -INT32_C(  1591743460) },
+      UINT8_C(  6),
+      { -INT32_C(   272186474), -INT32_C(   601842728),  INT32_C(   279773477), -INT32_C(   228941368) },
+      { -INT32_C(   726597361), -INT32_C(   272186474), -INT32_C(   601842728), -INT32_C(  1591743460) } },
+    { {  INT32_C(  1288801495),  INT32_C(    48356864),  INT32_C(  1855051362), -INT32_C(  1510051238) },
+      UINT8_C(  1),
+      {  INT32_C(  1121792849), -INT32_C(   200758288), -INT32_C(  1858607411), -INT32_C(   162756118) },
+      {  INT32_C(  1121792849),  INT32_C(    48356864),  INT32_C(  1855051362), -INT32_C(  1510051238) } },
+    { { -INT32_C(  2000951157), -INT32_C(  1496851759), -INT32_C(  1510445875),  INT32_C(   639920732) },
+      UINT8_C(  0),
+      { -INT32_C(  1875977794), -INT32_C(   727337811),  INT32_C(   899587853),  INT32_C(     7098005) },
+      { -INT32_C(  2000951157), -INT32_C(  1496851759), -INT32_C(  1510445875),  INT32_C(   639920732) } },
+    { {  INT32_C(   713679380), -INT32_C(    76703164), -INT32_C(  1940724816), -INT32_C(   492570975) },
+      UINT8_C( 14),
+      { -INT32_C(   627469190),  INT32_C(  1317922501), -INT32_C(  1444914604),  INT32_C(   685313000) },
+      {  INT32_C(   713679380), -INT32_C(   627469190),  INT32_C(  1317922501), -INT32_C(  1444914604) } },
+    { { -INT32_C(  1660316475),  INT32_C(  1980292536), -INT32_C(   176465946), -INT32_C(  1778377692) },
+      UINT8_C(  0),
+      { -INT32_C(    65135991), -INT32_C(  1822308631), -INT32_C(    79442844), -INT32_C(   895939196) },
+      { -INT32_C(  1660316475),  INT32_C(  1980292536), -INT32_C(   176465946), -INT32_C(  1778377692) } },
+    { {  INT32_C(   465348935),  INT32_C(   496789201), -INT32_C(    12854629),  INT32_C(  1724070830) },
+      UINT8_C(  9),
+      { -INT32_C(  1161212498),  INT32_C(  2145262305),  INT32_C(  1786514169), -INT32_C(   684246576) },
+      { -INT32_C(  1161212498),  INT32_C(   496789201), -INT32_C(    12854629),  INT32_C(  2145262305) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_expand_epi32(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_expand_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[2];
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { {  INT64_C( 6017066056671618331),  INT64_C( 8953916399126577847) },
+      UINT8_C(  0),
+      {  INT64_C( 6787740220359203551), -INT64_C( 5060798218583426978) },
+      {  INT64_C( 6017066056671618331),  INT64_C( 8953916399126577847) } },
+    { {  INT64_C(   43128377324526349), -INT64_C( 7397865840688085412) },
+      UINT8_C(  3),
+      { -INT64_C( 4594788241889394415),  INT64_C( 3899689102658131703) },
+      { -INT64_C( 4594788241889394415),  INT64_C( 3899689102658131703) } },
+    { { -INT64_C( 8925312663871868647), -INT64_C( 3764441766483382451) },
+      UINT8_C(  2),
+      {  INT64_C(  123369981549657399),  INT64_C( 1279143304507087705) },
+      { -INT64_C( 8925312663871868647),  INT64_C(  123369981549657399) } },
+    { {  INT64_C( 7811493694730962424),  INT64_C( 8959938036559887396) },
+      UINT8_C(  3),
+      { -INT64_C( 1537542855754468023),  INT64_C( 6353007076282043527) },
+      { -INT64_C( 1537542855754468023),  INT64_C( 6353007076282043527) } },
+    { { -INT64_C( 1876826281843748842), -INT64_C(  635077388872073622) },
+      UINT8_C(  2),
+      {  INT64_C( 5058876284487642925), -INT64_C( 2479741533021842986) },
+      { -INT64_C( 1876826281843748842),  INT64_C( 5058876284487642925) } },
+    { {  INT64_C( 2586854339733635196),  INT64_C( 3897304796124053221) },
+      UINT8_C(  3),
+      { -INT64_C( 7529890132306232850), -INT64_C( 2997672230842899966) },
+      { -INT64_C( 7529890132306232850), -INT64_C( 2997672230842899966) } },
+    { { -INT64_C( 5373520040059793478),  INT64_C( 3492802924175565824) },
+      UINT8_C(  0),
+      { -INT64_C( 5457115428791443173), -INT64_C( 8643408221706300059) },
+      { -INT64_C( 5373520040059793478),  INT64_C( 3492802924175565824) } },
+    { { -INT64_C( 8303729997058310196),  INT64_C(  980692047708291275) },
+      UINT8_C(  2),
+      { -INT64_C( 6854566212991384287),  INT64_C( 6983299882407518999) },
+      { -INT64_C( 8303729997058310196), -INT64_C( 6854566212991384287) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi64(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_expand_epi64(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_expand_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[2];
+    const simde__mmask8 k;
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   341.41), SIMDE_FLOAT64_C(  -136.96) },
+      UINT8_C(  0),
+      { SIMDE_FLOAT64_C(  -263.55), SIMDE_FLOAT64_C(  -370.71) },
+      { SIMDE_FLOAT64_C(   341.41), SIMDE_FLOAT64_C(  -136.96) } },
+    { { SIMDE_FLOAT64_C(  -862.45), SIMDE_FLOAT64_C(   -85.93) },
+      UINT8_C(  3),
+      { SIMDE_FLOAT64_C(   546.96), SIMDE_FLOAT64_C(   763.18) },
+      { SIMDE_FLOAT64_C(   546.96), SIMDE_FLOAT64_C(   763.18) } },
+    { { SIMDE_FLOAT64_C(    62.21), SIMDE_FLOAT64_C(  -354.57) },
+      UINT8_C(  2),
+      { SIMDE_FLOAT64_C(  -275.91), SIMDE_FLOAT64_C(  -810.00) },
+      { SIMDE_FLOAT64_C(    62.21), SIMDE_FLOAT64_C(  -275.91) } },
+    { { SIMDE_FLOAT64_C(  -651.55), SIMDE_FLOAT64_C(   628.45) },
+      UINT8_C(  2),
+      { SIMDE_FLOAT64_C(   535.30), SIMDE_FLOAT64_C(    70.03) },
+      { SIMDE_FLOAT64_C(  -651.55), SIMDE_FLOAT64_C(   535.30) } },
+    { { SIMDE_FLOAT64_C(    21.97), SIMDE_FLOAT64_C(  -717.11) },
+      UINT8_C(  1),
+      { SIMDE_FLOAT64_C(   623.94), SIMDE_FLOAT64_C(  -782.71) },
+      { SIMDE_FLOAT64_C(   623.94), SIMDE_FLOAT64_C(  -717.11) } },
+    { { SIMDE_FLOAT64_C(   281.78), SIMDE_FLOAT64_C(   716.05) },
+      UINT8_C(  3),
+      { SIMDE_FLOAT64_C(  -300.03), SIMDE_FLOAT64_C(  -963.86) },
+      { SIMDE_FLOAT64_C(  -300.03), SIMDE_FLOAT64_C(  -963.86) } },
+    { { SIMDE_FLOAT64_C(   874.86), SIMDE_FLOAT64_C(   900.93) },
+      UINT8_C(  2),
+      { SIMDE_FLOAT64_C(  -200.01), SIMDE_FLOAT64_C(   669.95) },
+      { SIMDE_FLOAT64_C(   874.86), SIMDE_FLOAT64_C(  -200.01) } },
+    { { SIMDE_FLOAT64_C(   686.96), SIMDE_FLOAT64_C(  -247.17) },
+      UINT8_C(  0),
+      { SIMDE_FLOAT64_C(  -563.55), SIMDE_FLOAT64_C(  -683.73) },
+      { SIMDE_FLOAT64_C(   686.96), SIMDE_FLOAT64_C(  -247.17) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d src = simde_mm_loadu_pd(test_vec[i].src);
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_mask_expand_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_expand_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[4];
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -517.49), SIMDE_FLOAT32_C(   151.42), SIMDE_FLOAT32_C(  -690.40), SIMDE_FLOAT32_C(  -571.76) },
+      UINT8_C(  0),
+      { SIMDE_FLOAT32_C(  -233.16), SIMDE_FLOAT32_C(   355.85), SIMDE_FLOAT32_C(   138.40), SIMDE_FLOAT32_C(  -738.22) },
+      { SIMDE_FLOAT32_C(  -517.49), SIMDE_FLOAT32_C(   151.42), SIMDE_FLOAT32_C(  -690.40), SIMDE_FLOAT32_C(  -571.76) } },
+    { { SIMDE_FLOAT32_C(  -235.28), SIMDE_FLOAT32_C(  -154.31), SIMDE_FLOAT32_C(  -160.12), SIMDE_FLOAT32_C(   483.01) },
+      UINT8_C( 15),
+      { SIMDE_FLOAT32_C(   229.10), SIMDE_FLOAT32_C(   614.68), SIMDE_FLOAT32_C(  -205.17), SIMDE_FLOAT32_C(  -809.96) },
+      { SIMDE_FLOAT32_C(   229.10), SIMDE_FLOAT32_C(   614.68), SIMDE_FLOAT32_C(  -205.17), SIMDE_FLOAT32_C(  -809.96) } },
+    { { SIMDE_FLOAT32_C(   614.72), SIMDE_FLOAT32_C(   989.20), SIMDE_FLOAT32_C(  -306.62), SIMDE_FLOAT32_C(   717.83) },
+      UINT8_C(  5),
+      { SIMDE_FLOAT32_C(    85.82), SIMDE_FLOAT32_C(  -693.20), SIMDE_FLOAT32_C(  -839.44), SIMDE_FLOAT32_C(   645.12) },
+      { SIMDE_FLOAT32_C(    85.82), SIMDE_FLOAT32_C(   989.20), SIMDE_FLOAT32_C(  -693.20), SIMDE_FLOAT32_C(   717.83) } },
+    { { SIMDE_FLOAT32_C(   814.59), SIMDE_FLOAT32_C(   958.33), SIMDE_FLOAT32_C(   347.40), SIMDE_FLOAT32_C(  -926.20) },
+      UINT8_C(  8),
+      { SIMDE_FLOAT32_C(  -789.28), SIMDE_FLOAT32_C(   826.93), SIMDE_FLOAT32_C(   934.89), SIMDE_FLOAT32_C(  -719.89) },
+      { SIMDE_FLOAT32_C(   814.59), SIMDE_FLOAT32_C(   958.33), SIMDE_FLOAT32_C(   347.40), SIMDE_FLOAT32_C(  -789.28) } },
+    { { SIMDE_FLOAT32_C(   536.65), SIMDE_FLOAT32_C(   283.42), SIMDE_FLOAT32_C(  -431.69), SIMDE_FLOAT32_C(   684.87) },
+      UINT8_C(  1),
+      { SIMDE_FLOAT32_C(   372.42), SIMDE_FLOAT32_C(   121.75), SIMDE_FLOAT32_C(   871.10), SIMDE_FLOAT32_C(   122.82) },
+      { SIMDE_FLOAT32_C(   372.42), SIMDE_FLOAT32_C(   283.42), SIMDE_FLOAT32_C(  -431.69), SIMDE_FLOAT32_C(   684.87) } },
+    { { SIMDE_FLOAT32_C(  -295.35), SIMDE_FLOAT32_C(   388.23), SIMDE_FLOAT32_C(  -150.86), SIMDE_FLOAT32_C(  -504.54) },
+      UINT8_C(  8),
+      { SIMDE_FLOAT32_C(  -808.85), SIMDE_FLOAT32_C(  -937.33), SIMDE_FLOAT32_C(  -732.96), SIMDE_FLOAT32_C(  -835.74) },
+      { SIMDE_FLOAT32_C(  -295.35), SIMDE_FLOAT32_C(   388.23), SIMDE_FLOAT32_C(  -150.86), SIMDE_FLOAT32_C(  -808.85) } },
+    { { SIMDE_FLOAT32_C(   187.76), SIMDE_FLOAT32_C(   920.48), SIMDE_FLOAT32_C(   -61.79), SIMDE_FLOAT32_C(  -279.68) },
+      UINT8_C(  0),
+      { SIMDE_FLOAT32_C(  -782.81), SIMDE_FLOAT32_C(  -736.83), SIMDE_FLOAT32_C(  -160.26), SIMDE_FLOAT32_C(   390.12) },
+      { SIMDE_FLOAT32_C(   187.76), SIMDE_FLOAT32_C(   920.48), SIMDE_FLOAT32_C(   -61.79), SIMDE_FLOAT32_C(  -279.68) } },
+    { { SIMDE_FLOAT32_C(   731.85), SIMDE_FLOAT32_C(  -171.98), SIMDE_FLOAT32_C(   496.36), SIMDE_FLOAT32_C(  -357.06) },
+      UINT8_C(  5),
+      { SIMDE_FLOAT32_C(  -362.10), SIMDE_FLOAT32_C(   366.21), SIMDE_FLOAT32_C(  -259.30), SIMDE_FLOAT32_C(  -714.64) },
+      { SIMDE_FLOAT32_C(  -362.10), SIMDE_FLOAT32_C(  -171.98), SIMDE_FLOAT32_C(   366.21), SIMDE_FLOAT32_C(  -357.06) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 src = simde_mm_loadu_ps(test_vec[i].src);
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_mask_expand_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_expand_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { -INT32_C(   140471898),  INT32_C(   260480984),  INT32_C(    67268265), -INT32_C(   318296676) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C( 15),
+      {  INT32_C(   818268847),  INT32_C(  2046749066),  INT32_C(  1867088575), -INT32_C(  1578870133) },
+      {  INT32_C(   818268847),  INT32_C(  2046749066),  INT32_C(  1867088575), -INT32_C(  1578870133) } },
+    { UINT8_C(  0),
+      {  INT32_C(  1963171521), -INT32_C(   735020387),  INT32_C(  1804743825), -INT32_C(  2105161069) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(  2),
+      { -INT32_C(  1041177737), -INT32_C(  1966241706),  INT32_C(  1659478159),  INT32_C(  1182278150) },
+      {  INT32_C(           0), -INT32_C(  1041177737),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(  1),
+      { -INT32_C(  1191627941), -INT32_C(    83120941),  INT32_C(   224206730),  INT32_C(   338975875) },
+      { -INT32_C(  1191627941),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(  9),
+      {  INT32_C(   695669115),  INT32_C(   108821223),  INT32_C(  2128848480),  INT32_C(  1724476864) },
+      {  INT32_C(   695669115),  INT32_C(           0),  INT32_C(           0),  INT32_C(   108821223) } },
+    { UINT8_C(  3),
+      {  INT32_C(  1160510637), -INT32_C(  1190794009),  INT32_C(   261392274), -INT32_C(  1351268089) },
+      {  INT32_C(  1160510637), -INT32_C(  1190794009),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(  2),
+      {  INT32_C(    46627302), -INT32_C(   316862476),  INT32_C(   399382606),  INT32_C(  1377993013) },
+      {  INT32_C(           0),  INT32_C(    46627302),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_expand_epi32(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_expand_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { -INT64_C( 2763832124880449484),  INT64_C( 1581357508230236252) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  3),
+      {  INT64_C( 3153135606855186813),  INT64_C( 8219140050960581377) },
+      {  INT64_C( 3153135606855186813),  INT64_C( 8219140050960581377) } },
+    { UINT8_C(  3),
+      {  INT64_C( 7679163235519522111), -INT64_C( 3827666831296244816) },
+      {  INT64_C( 7679163235519522111), -INT64_C( 3827666831296244816) } },
+    { UINT8_C(  2),
+      {  INT64_C( 9121353419311795849),  INT64_C( 5608112580453097036) },
+      {  INT64_C(                   0),  INT64_C( 9121353419311795849) } },
+    { UINT8_C(  3),
+      {  INT64_C( 6137139243343765865), -INT64_C( 2545137885601715505) },
+      {  INT64_C( 6137139243343765865), -INT64_C( 2545137885601715505) } },
+    { UINT8_C(  1),
+      {  INT64_C( 1162671070407058046), -INT64_C( 4291653917768512534) },
+      {  INT64_C( 1162671070407058046),  INT64_C(                   0) } },
+    { UINT8_C(  3),
+      { -INT64_C( 3506866297894633422), -INT64_C( 2457619625097983382) },
+      { -INT64_C( 3506866297894633422), -INT64_C( 2457619625097983382) } },
+    { UINT8_C(  3),
+      {  INT64_C( 6536905166165689270),  INT64_C( 7557395553503819852) },
+      {  INT64_C( 6536905166165689270),  INT64_C( 7557395553503819852) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_expand_epi64(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_expand_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { SIMDE_FLOAT64_C(   811.03), SIMDE_FLOAT64_C(  -970.47) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(  3),
+      { SIMDE_FLOAT64_C(  -270.33), SIMDE_FLOAT64_C(  -444.69) },
+      { SIMDE_FLOAT64_C(  -270.33), SIMDE_FLOAT64_C(  -444.69) } },
+    { UINT8_C(  0),
+      { SIMDE_FLOAT64_C(   738.61), SIMDE_FLOAT64_C(  -612.48) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(  3),
+      { SIMDE_FLOAT64_C(  -994.91), SIMDE_FLOAT64_C(   818.85) },
+      { SIMDE_FLOAT64_C(  -994.91), SIMDE_FLOAT64_C(   818.85) } },
+    { UINT8_C(  3),
+      { SIMDE_FLOAT64_C(  -597.65), SIMDE_FLOAT64_C(  -100.22) },
+      { SIMDE_FLOAT64_C(  -597.65), SIMDE_FLOAT64_C(  -100.22) } },
+    { UINT8_C(  1),
+      { SIMDE_FLOAT64_C(  -882.40), SIMDE_FLOAT64_C(   466.23) },
+      { SIMDE_FLOAT64_C(  -882.40), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(  3),
+      { SIMDE_FLOAT64_C(   501.40), SIMDE_FLOAT64_C(   -31.88) },
+      { SIMDE_FLOAT64_C(   501.40), SIMDE_FLOAT64_C(   -31.88) } },
+    { UINT8_C(  0),
+      { SIMDE_FLOAT64_C(    79.29), SIMDE_FLOAT64_C(  -253.15) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_maskz_expand_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_expand_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { SIMDE_FLOAT32_C(    45.04), SIMDE_FLOAT32_C(   339.36), SIMDE_FLOAT32_C(   -12.62), SIMDE_FLOAT32_C(  -396.33) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C( 15),
+      { SIMDE_FLOAT32_C(   565.03), SIMDE_FLOAT32_C(   204.81), SIMDE_FLOAT32_C(   100.10), SIMDE_FLOAT32_C(  -586.17) },
+      { SIMDE_FLOAT32_C(   565.03), SIMDE_FLOAT32_C(   204.81), SIMDE_FLOAT32_C(   100.10), SIMDE_FLOAT32_C(  -586.17) } },
+    { UINT8_C(  8),
+      { SIMDE_FLOAT32_C(   875.73), SIMDE_FLOAT32_C(  -689.20), SIMDE_FLOAT32_C(  -881.12), SIMDE_FLOAT32_C(  -493.16) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   875.73) } },
+    { UINT8_C(  7),
+      { SIMDE_FLOAT32_C(  -290.08), SIMDE_FLOAT32_C(   224.65), SIMDE_FLOAT32_C(   -92.62), SIMDE_FLOAT32_C(   892.25) },
+      { SIMDE_FLOAT32_C(  -290.08), SIMDE_FLOAT32_C(   224.65), SIMDE_FLOAT32_C(   -92.62), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(  4),
+      { SIMDE_FLOAT32_C(   926.30), SIMDE_FLOAT32_C(   438.34), SIMDE_FLOAT32_C(  -973.02), SIMDE_FLOAT32_C(  -566.15) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   926.30), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(  5),
+      { SIMDE_FLOAT32_C(   304.47), SIMDE_FLOAT32_C(   673.74), SIMDE_FLOAT32_C(  -675.18), SIMDE_FLOAT32_C(  -571.18) },
+      { SIMDE_FLOAT32_C(   304.47), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   673.74), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C( 11),
+      { SIMDE_FLOAT32_C(   418.91), SIMDE_FLOAT32_C(   510.24), SIMDE_FLOAT32_C(    88.71), SIMDE_FLOAT32_C(   492.34) },
+      { SIMDE_FLOAT32_C(   418.91), SIMDE_FLOAT32_C(   510.24), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    88.71) } },
+    { UINT8_C( 11),
+      { SIMDE_FLOAT32_C(   616.02), SIMDE_FLOAT32_C(  -281.01), SIMDE_FLOAT32_C(    25.05), SIMDE_FLOAT32_C(  -767.44) },
+      { SIMDE_FLOAT32_C(   616.02), SIMDE_FLOAT32_C(  -281.01), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    25.05) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_maskz_expand_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_expand_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { {  INT32_C(  1208130367), -INT32_C(  1289239434),  INT32_C(   979554722), -INT32_C(  1728731536),  INT32_C(  1613035831), -INT32_C(   799407082),  INT32_C(  1886796481),  INT32_C(  1437864978) },
+      UINT8_C(  0),
+      {  INT32_C(  1592915163), -INT32_C(   197242362),  INT32_C(  1259436319),  INT32_C(  1667224257),  INT32_C(  1466111349), -INT32_C(   465414967),  INT32_C(   582971143),  INT32_C(   961272370) },
+      {  INT32_C(  1208130367), -INT32_C(  1289239434),  INT32_C(   979554722), -INT32_C(  1728731536),  INT32_C(  1613035831), -INT32_C(   799407082),  INT32_C(  1886796481),  INT32_C(  1437864978) } },
+    { { -INT32_C(  1256505589), -INT32_C(   363668562),  INT32_C(  2045542741),  INT32_C(    93982871), -INT32_C(   292574541), -INT32_C(   344628893), -INT32_C(   403411844), -INT32_C(  1312680838) },
+      UINT8_C(255),
+      {  INT32_C(  2015557497),  INT32_C(  1090099320),  INT32_C(   812397628), -INT32_C(  2111797806), -INT32_C(  1413300899),  INT32_C(  1663425626),  INT32_C(   931438851),  INT32_C(  1943182155) },
+      {  INT32_C(  2015557497),  INT32_C(  1090099320),  INT32_C(   812397628), -INT32_C(  2111797806), -INT32_C(  1413300899),  INT32_C(  1663425626),  INT32_C(   931438851),  INT32_C(  1943182155) } },
+    { {  INT32_C(  1047178676), -INT32_C(   684252194), -INT32_C(  1776909864), -INT32_C(   890950317),  INT32_C(   913867579), -INT32_C(   536565798),  INT32_C(   566146859),  INT32_C(  1160582419) },
+      UINT8_C( 26),
+      { -INT32_C(   439599459),  INT32_C(  1344949326),  INT32_C(   432949856),  INT32_C(  1703814825), -INT32_C(  1296998633), -INT32_C(   326914399),  INT32_C(  1875382427),  INT32_C(  1436347727) },
+      {  INT32_C(  1047178676), -INT32_C(   439599459), -INT32_C(  1776909864),  INT32_C(  1344949326),  INT32_C(   432949856), -INT32_C(   536565798),  INT32_C(   566146859),  INT32_C(  1160582419) } },
+    { {  INT32_C(  1417471408), -INT32_C(  1543312942), -INT32_C(  1580979993),  INT32_C(  1452889068), -INT32_C(   795241360), -INT32_C(   584467839), -INT32_C(  2060887632),  INT32_C(   478021198) },
+      UINT8_C(241),
+      { -INT32_C(  1436407752), -INT32_C(   588012835),  INT32_C(   904666295),  INT32_C(  1101417129),  INT32_C(  1688572595), -INT32_C(   303666098),  INT32_C(   177984010), -INT32_C(  1190562392) },
+      { -INT32_C(  1436407752), -INT32_C(  1543312942), -INT32_C(  1580979993),  INT32_C(  1452889068), -INT32_C(   588012835),  INT32_C(   904666295),  INT32_C(  1101417129),  INT32_C(  1688572595) } },
+    { {  INT32_C(   747210290),  INT32_C(  2086420562),  INT32_C(  1420292662),  INT32_C(  1628785550), -INT32_C(   376155425),  INT32_C(  1527590336), -INT32_C(   439084319),  INT32_C(  1295991738) },
+      UINT8_C(145),
+      {  INT32_C(  1602388956),  INT32_C(  1236295911), -INT32_C(   534079227), -INT32_C(  1181329243), -INT32_C(   405091964),  INT32_C(    12828232), -INT32_C(  1373722120),  INT32_C(  1057861845) },
+      {  INT32_C(  1602388956),  INT32_C(  2086420562),  INT32_C(  1420292662),  INT32_C(  1628785550),  INT32_C(  1236295911),  INT32_C(  1527590336), -INT32_C(   439084319), -INT32_C(   534079227) } },
+    { {  INT32_C(   173701202), -INT32_C(   565541900), -INT32_C(  2087180669),  INT32_C(   440056744), -INT32_C(   243445336), -INT32_C(   518183002), -INT32_C(  1398833128),  INT32_C(  2115535207) },
+      UINT8_C(143),
+      { -INT32_C(  1319007615),  INT32_C(   588740550), -INT32_C(      520489), -INT32_C(  1779117638),  INT32_C(   387313730),  INT32_C(  1235782507),  INT32_C(   190560915),  INT32_C(   460713161) },
+      { -INT32_C(  1319007615),  INT32_C(   588740550), -INT32_C(      520489), -INT32_C(  1779117638), -INT32_C(   243445336), -INT32_C(   518183002), -INT32_C(  1398833128),  INT32_C(   387313730) } },
+    { {  INT32_C(   608629607), -INT32_C(  1403456540), -INT32_C(   337639193), -INT32_C(   755799106), -INT32_C(   169840433), -INT32_C(   265790906),  INT32_C(  1859110061), -INT32_C(  1512506952) },
+      UINT8_C(174),
+      { -INT32_C(   921439196), -INT32_C(   305495626),  INT32_C(  1775241756),  INT32_C(  1546960699),  INT32_C(     2893398),  INT32_C(  1647457902), -INT32_C(    79875134),  INT32_C(       49580) },
+      {  INT32_C(   608629607), -INT32_C(   921439196), -INT32_C(   305495626),  INT32_C(  1775241756), -INT32_C(   169840433),  INT32_C(  1546960699),  INT32_C(  1859110061),  INT32_C(     2893398) } },
+    { {  INT32_C(  1311924439), -INT32_C(  2120969224),  INT32_C(  1593514424),  INT32_C(    25831500), -INT32_C(  2099514117),  INT32_C(  2030535385),  INT32_C(  1184321915), -INT32_C(   621971022) },
+      UINT8_C(208),
+      {  INT32_C(  1345101766),  INT32_C(   688077712),  INT32_C(  1837682041),  INT32_C(  1842929497),  INT32_C(  1091771669),  INT32_C(  1060472451),  INT32_C(  1851978567),  INT32_C(   899196408) },
+      {  INT32_C(  1311924439), -INT32_C(  2120969224),  INT32_C(  1593514424),  INT32_C(    25831500),  INT32_C(  1345101766),  INT32_C(  2030535385),  INT32_C(   688077712),  INT32_C(  1837682041) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_expand_epi32(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_expand_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[4];
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { { -INT64_C( 8755842934921687562), -INT64_C( 8162850675547236049),  INT64_C( 8565282216952898419), -INT64_C( 1353375587907436640) },
+      UINT8_C(  0),
+      {  INT64_C( 8073870689394763776),  INT64_C( 1773014968529030660),  INT64_C( 5349327787358014546), -INT64_C( 5340652955385292846) },
+      { -INT64_C( 8755842934921687562), -INT64_C( 8162850675547236049),  INT64_C( 8565282216952898419), -INT64_C( 1353375587907436640) } },
+    { {  INT64_C( 6980945650684994040),  INT64_C( 2869996761703035894), -INT64_C( 4985163760202667359),  INT64_C(  422817361688940691) },
+      UINT8_C( 15),
+      {  INT64_C( 5381174869875746876),  INT64_C(   66406191651634722),  INT64_C( 3934850746991639598), -INT64_C( 1026716384563199964) },
+      {  INT64_C( 5381174869875746876),  INT64_C(   66406191651634722),  INT64_C( 3934850746991639598), -INT64_C( 1026716384563199964) } },
+    { { -INT64_C( 6459849849400954145),  INT64_C( 3442106838894584187),  INT64_C( 3700126595171166517), -INT64_C( 4908251810000566583) },
+      UINT8_C(  9),
+      {  INT64_C( 6022509602505897673), -INT64_C( 1523426134566586587),  INT64_C( 8150806917224002849), -INT64_C( 3736164673447540075) },
+      {  INT64_C( 6022509602505897673),  INT64_C( 3442106838894584187),  INT64_C( 3700126595171166517), -INT64_C( 1523426134566586587) } },
+    { { -INT64_C( 3551749354718520621),  INT64_C( 4249083143167061301), -INT64_C( 7292113285930283476), -INT64_C( 3833244962845500221) },
+      UINT8_C(  6),
+      { -INT64_C( 4752315436198027029),  INT64_C( 4731752449121176717),  INT64_C(  721881323437787839),  INT64_C( 4931610616933083052) },
+      { -INT64_C( 3551749354718520621), -INT64_C( 4752315436198027029),  INT64_C( 4731752449121176717), -INT64_C( 3833244962845500221) } },
+    { {  INT64_C( 3772422620592968236),  INT64_C( 7017609631799219702),  INT64_C( 6782516203300529995), -INT64_C( 7084124493209217638) },
+      UINT8_C( 14),
+      { -INT64_C( 8734439552860889720),  INT64_C( 8244437392542378123), -INT64_C( 2539033302717336078), -INT64_C( 3567954683357668699) },
+      {  INT64_C( 3772422620592968236), -INT64_C( 8734439552860889720),  INT64_C( 8244437392542378123), -INT64_C( 2539033302717336078) } },
+    { {  INT64_C( 7041444447079299464),  INT64_C( 2093538881770339581), -INT64_C(  773658331402499431), -INT64_C( 6939453073702762920) },
+      UINT8_C( 14),
+      {  INT64_C(  472736618429080913),  INT64_C( 7916306514566108074),  INT64_C( 4611245035517775603), -INT64_C( 7722625964741182103) },
+      {  INT64_C( 7041444447079299464),  INT64_C(  472736618429080913),  INT64_C( 7916306514566108074),  INT64_C( 4611245035517775603) } },
+    { { -INT64_C(   76152413940431517),  INT64_C( 7179914568430603125),  INT64_C( 3023083649255915879),  INT64_C( 7609456336743252281) },
+      UINT8_C(  3),
+      { -INT64_C( 8485291558710449365), -INT64_C( 2252563454320760573), -INT64_C( 1351092044468760713),  INT64_C( 6424776141020400526) },
+      { -INT64_C( 8485291558710449365), -INT64_C( 2252563454320760573),  INT64_C( 3023083649255915879),  INT64_C( 7609456336743252281) } },
+    { { -INT64_C( 2295073593768374403), -INT64_C( 2243006976280879421),  INT64_C( 4999890480253474983),  INT64_C( 5068296598861328655) },
+      UINT8_C( 13),
+      {  INT64_C( 5941973040705753584),  INT64_C( 6831352593836365224), -INT64_C( 4417550817020589024),  INT64_C(  478891426450267323) },
+      {  INT64_C( 5941973040705753584), -INT64_C( 2243006976280879421),  INT64_C( 6831352593836365224), -INT64_C( 4417550817020589024) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi64(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_expand_epi64(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_expand_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[4];
+    const simde__mmask8 k;
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -295.86), SIMDE_FLOAT64_C(  -761.32), SIMDE_FLOAT64_C(  -504.21), SIMDE_FLOAT64_C(  -399.36) },
+      UINT8_C(  0),
+      { SIMDE_FLOAT64_C(  -300.21), SIMDE_FLOAT64_C(  -281.70), SIMDE_FLOAT64_C(   378.75), SIMDE_FLOAT64_C(   301.91) },
+      { SIMDE_FLOAT64_C(  -295.86), SIMDE_FLOAT64_C(  -761.32), SIMDE_FLOAT64_C(  -504.21), SIMDE_FLOAT64_C(  -399.36) } },
+    { { SIMDE_FLOAT64_C(  -636.26), SIMDE_FLOAT64_C(   286.09), SIMDE_FLOAT64_C(   230.49), SIMDE_FLOAT64_C(   200.03) },
+      UINT8_C( 15),
+      { SIMDE_FLOAT64_C(   580.05), SIMDE_FLOAT64_C(   256.11), SIMDE_FLOAT64_C(   811.12), SIMDE_FLOAT64_C(   540.83) },
+      { SIMDE_FLOAT64_C(   580.05), SIMDE_FLOAT64_C(   256.11), SIMDE_FLOAT64_C(   811.12), SIMDE_FLOAT64_C(   540.83) } },
+    { { SIMDE_FLOAT64_C(  -904.71), SIMDE_FLOAT64_C(   880.06), SIMDE_FLOAT64_C(   392.27), SIMDE_FLOAT64_C(  -539.71) },
+      UINT8_C( 12),
+      { SIMDE_FLOAT64_C(   627.23), SIMDE_FLOAT64_C(   838.48), SIMDE_FLOAT64_C(  -173.04), SIMDE_FLOAT64_C(  -953.85) },
+      { SIMDE_FLOAT64_C(  -904.71), SIMDE_FLOAT64_C(   880.06), SIMDE_FLOAT64_C(   627.23), SIMDE_FLOAT64_C(   838.48) } },
+    { { SIMDE_FLOAT64_C(  -886.93), SIMDE_FLOAT64_C(   271.81), SIMDE_FLOAT64_C(   448.42), SIMDE_FLOAT64_C(   631.07) },
+      UINT8_C(  3),
+      { SIMDE_FLOAT64_C(  -193.95), SIMDE_FLOAT64_C(    68.19), SIMDE_FLOAT64_C(   408.75), SIMDE_FLOAT64_C(   493.97) },
+      { SIMDE_FLOAT64_C(  -193.95), SIMDE_FLOAT64_C(    68.19), SIMDE_FLOAT64_C(   448.42), SIMDE_FLOAT64_C(   631.07) } },
+    { { SIMDE_FLOAT64_C(  -142.14), SIMDE_FLOAT64_C(  -498.78), SIMDE_FLOAT64_C(   296.90), SIMDE_FLOAT64_C(   371.72) },
+      UINT8_C(  8),
+      { SIMDE_FLOAT64_C(   708.95), SIMDE_FLOAT64_C(   640.26), SIMDE_FLOAT64_C(  -797.49), SIMDE_FLOAT64_C(  -873.79) },
+      { SIMDE_FLOAT64_C(  -142.14), SIMDE_FLOAT64_C(  -498.78), SIMDE_FLOAT64_C(   296.90), SIMDE_FLOAT64_C(   708.95) } },
+    { { SIMDE_FLOAT64_C(   645.12), SIMDE_FLOAT64_C(   192.24), SIMDE_FLOAT64_C(  -634.92), SIMDE_FLOAT64_C(  -906.98) },
+      UINT8_C( 14),
+      { SIMDE_FLOAT64_C(    55.89), SIMDE_FLOAT64_C(  -975.31), SIMDE_FLOAT64_C(  -770.35), SIMDE_FLOAT64_C(   956.95) },
+      { SIMDE_FLOAT64_C(   645.12), SIMDE_FLOAT64_C(    55.89), SIMDE_FLOAT64_C(  -975.31), SIMDE_FLOAT64_C(  -770.35) } },
+    { { SIMDE_FLOAT64_C(  -698.51), SIMDE_FLOAT64_C(   887.82), SIMDE_FLOAT64_C(  -566.30), SIMDE_FLOAT64_C(   216.93) },
+      UINT8_C(  8),
+      { SIMDE_FLOAT64_C(  -502.38), SIMDE_FLOAT64_C(    43.15), SIMDE_FLOAT64_C(  -335.47), SIMDE_FLOAT64_C(  -827.50) },
+      { SIMDE_FLOAT64_C(  -698.51), SIMDE_FLOAT64_C(   887.82), SIMDE_FLOAT64_C(  -566.30), SIMDE_FLOAT64_C(  -502.38) } },
+    { { SIMDE_FLOAT64_C(  -731.32), SIMDE_FLOAT64_C(  -582.90), SIMDE_FLOAT64_C(   719.23), SIMDE_FLOAT64_C(   713.03) },
+      UINT8_C( 15),
+      { SIMDE_FLOAT64_C(   156.12), SIMDE_FLOAT64_C(  -555.45), SIMDE_FLOAT64_C(   859.87), SIMDE_FLOAT64_C(  -854.54) },
+      { SIMDE_FLOAT64_C(   156.12), SIMDE_FLOAT64_C(  -555.45), SIMDE_FLOAT64_C(   859.87), SIMDE_FLOAT64_C(  -854.54) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d src = simde_mm256_loadu_pd(test_vec[i].src);
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde__m256d r = simde_mm256_mask_expand_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_expand_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[8];
+    const simde__mmask8 k;
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   676.08), SIMDE_FLOAT32_C(  -734.89), SIMDE_FLOAT32_C(  -126.81), SIMDE_FLOAT32_C(  -496.85),
+        SIMDE_FLOAT32_C(   175.25), SIMDE_FLOAT32_C(    18.14), SIMDE_FLOAT32_C(  -339.93), SIMDE_FLOAT32_C(  -460.33) },
+      UINT8_C(  0),
+      { SIMDE_FLOAT32_C(   390.26), SIMDE_FLOAT32_C(   962.54), SIMDE_FLOAT32_C(   748.77), SIMDE_FLOAT32_C(   -75.98),
+        SIMDE_FLOAT32_C(  -348.18), SIMDE_FLOAT32_C(  -739.17), SIMDE_FLOAT32_C(  -130.56), SIMDE_FLOAT32_C(   375.63) },
+      { SIMDE_FLOAT32_C(   676.08), SIMDE_FLOAT32_C(  -734.89), SIMDE_FLOAT32_C(  -126.81), SIMDE_FLOAT32_C(  -496.85),
+        SIMDE_FLOAT32_C(   175.25), SIMDE_FLOAT32_C(    18.14), SIMDE_FLOAT32_C(  -339.93), SIMDE_FLOAT32_C(  -460.33) } },
+    { { SIMDE_FLOAT32_C(   -40.21), SIMDE_FLOAT32_C(  -513.83), SIMDE_FLOAT32_C(   891.35), SIMDE_FLOAT32_C(  -861.78),
+        SIMDE_FLOAT32_C(  -620.14), SIMDE_FLOAT32_C(   207.96), SIMDE_FLOAT32_C(  -932.59), SIMDE_FLOAT32_C(   569.82) },
+      UINT8_C(255),
+      { SIMDE_FLOAT32_C(  -867.41), SIMDE_FLOAT32_C(   113.73), SIMDE_FLOAT32_C(   292.61), SIMDE_FLOAT32_C(   933.19),
+        SIMDE_FLOAT32_C(   370.68), SIMDE_FLOAT32_C(  -283.63), SIMDE_FLOAT32_C(  -314.02), SIMDE_FLOAT32_C(   646.80) },
+      { SIMDE_FLOAT32_C(  -867.41), SIMDE_FLOAT32_C(   113.73), SIMDE_FLOAT32_C(   292.61), SIMDE_FLOAT32_C(   933.19),
+        SIMDE_FLOAT32_C(   370.68), SIMDE_FLOAT32_C(  -283.63), SIMDE_FLOAT32_C(  -314.02), SIMDE_FLOAT32_C(   646.80) } },
+    { { SIMDE_FLOAT32_C(  -339.50), SIMDE_FLOAT32_C(  -749.22), SIMDE_FLOAT32_C(  -576.94), SIMDE_FLOAT32_C(   613.54),
+        SIMDE_FLOAT32_C(   428.64), SIMDE_FLOAT32_C(  -110.26), SIMDE_FLOAT32_C(   604.29), SIMDE_FLOAT32_C(  -922.82) },
+      UINT8_C(161),
+      { SIMDE_FLOAT32_C(   209.96), SIMDE_FLOAT32_C(    -4.37), SIMDE_FLOAT32_C(  -957.78), SIMDE_FLOAT32_C(   -14.10),
+        SIMDE_FLOAT32_C(   269.47), SIMDE_FLOAT32_C(  -990.47), SIMDE_FLOAT32_C(   291.13), SIMDE_FLOAT32_C(   819.67) },
+      { SIMDE_FLOAT32_C(   209.96), SIMDE_FLOAT32_C(  -749.22), SIMDE_FLOAT32_C(  -576.94), SIMDE_FLOAT32_C(   613.54),
+        SIMDE_FLOAT32_C(   428.64), SIMDE_FLOAT32_C(    -4.37), SIMDE_FLOAT32_C(   604.29), SIMDE_FLOAT32_C(  -957.78) } },
+    { { SIMDE_FLOAT32_C(    41.23), SIMDE_FLOAT32_C(    70.74), SIMDE_FLOAT32_C(  -308.82), SIMDE_FLOAT32_C(   454.80),
+        SIMDE_FLOAT32_C(   343.63), SIMDE_FLOAT32_C(  -149.69), SIMDE_FLOAT32_C(  -783.80), SIMDE_FLOAT32_C(  -162.44) },
+      UINT8_C( 95),
+      { SIMDE_FLOAT32_C(  -358.52), SIMDE_FLOAT32_C(  -325.14), SIMDE_FLOAT32_C(    34.57), SIMDE_FLOAT32_C(  -941.78),
+        SIMDE_FLOAT32_C(  -927.56), SIMDE_FLOAT32_C(  -589.46), SIMDE_FLOAT32_C(  -451.58), SIMDE_FLOAT32_C(  -322.51) },
+      { SIMDE_FLOAT32_C(  -358.52), SIMDE_FLOAT32_C(  -325.14), SIMDE_FLOAT32_C(    34.57), SIMDE_FLOAT32_C(  -941.78),
+        SIMDE_FLOAT32_C(  -927.56), SIMDE_FLOAT32_C(  -149.69), SIMDE_FLOAT32_C(  -589.46), SIMDE_FLOAT32_C(  -162.44) } },
+    { { SIMDE_FLOAT32_C(    72.79), SIMDE_FLOAT32_C(  -893.52), SIMDE_FLOAT32_C(   695.15), SIMDE_FLOAT32_C(   949.20),
+        SIMDE_FLOAT32_C(   373.07), SIMDE_FLOAT32_C(  -396.89), SIMDE_FLOAT32_C(   422.35), SIMDE_FLOAT32_C(  -644.28) },
+      UINT8_C( 91),
+      { SIMDE_FLOAT32_C(   815.88), SIMDE_FLOAT32_C(  -648.80), SIMDE_FLOAT32_C(   187.60), SIMDE_FLOAT32_C(   -97.74),
+        SIMDE_FLOAT32_C(  -608.65), SIMDE_FLOAT32_C(    60.89), SIMDE_FLOAT32_C(   839.84), SIMDE_FLOAT32_C(   510.20) },
+      { SIMDE_FLOAT32_C(   815.88), SIMDE_FLOAT32_C(  -648.80), SIMDE_FLOAT32_C(   695.15), SIMDE_FLOAT32_C(   187.60),
+        SIMDE_FLOAT32_C(   -97.74), SIMDE_FLOAT32_C(  -396.89), SIMDE_FLOAT32_C(  -608.65), SIMDE_FLOAT32_C(  -644.28) } },
+    { { SIMDE_FLOAT32_C(   697.98), SIMDE_FLOAT32_C(   264.58), SIMDE_FLOAT32_C(   509.50), SIMDE_FLOAT32_C(   373.53),
+        SIMDE_FLOAT32_C(   575.63), SIMDE_FLOAT32_C(   384.67), SIMDE_FLOAT32_C(   130.84), SIMDE_FLOAT32_C(   310.98) },
+      UINT8_C(229),
+      { SIMDE_FLOAT32_C(  -154.64), SIMDE_FLOAT32_C(   573.84), SIMDE_FLOAT32_C(   499.37), SIMDE_FLOAT32_C(   730.71),
+        SIMDE_FLOAT32_C(   -81.13), SIMDE_FLOAT32_C(   114.12), SIMDE_FLOAT32_C(  -631.05), SIMDE_FLOAT32_C(   463.33) },
+      { SIMDE_FLOAT32_C(  -154.64), SIMDE_FLOAT32_C(   264.58), SIMDE_FLOAT32_C(   573.84), SIMDE_FLOAT32_C(   373.53),
+        SIMDE_FLOAT32_C(   575.63), SIMDE_FLOAT32_C(   499.37), SIMDE_FLOAT32_C(   730.71), SIMDE_FLOAT32_C(   -81.13) } },
+    { { SIMDE_FLOAT32_C(   266.85), SIMDE_FLOAT32_C(  -324.25), SIMDE_FLOAT32_C(  -430.17), SIMDE_FLOAT32_C(   175.59),
+        SIMDE_FLOAT32_C(  -841.70), SIMDE_FLOAT32_C(  -522.37), SIMDE_FLOAT32_C(   818.73), SIMDE_FLOAT32_C(   334.45) },
+      UINT8_C( 17),
+      { SIMDE_FLOAT32_C(  -144.03), SIMDE_FLOAT32_C(   676.45), SIMDE_FLOAT32_C(  -521.30), SIMDE_FLOAT32_C(   969.22),
+        SIMDE_FLOAT32_C(  -609.94), SIMDE_FLOAT32_C(  -968.46), SIMDE_FLOAT32_C(   498.71), SIMDE_FLOAT32_C(  -699.11) },
+      { SIMDE_FLOAT32_C(  -144.03), SIMDE_FLOAT32_C(  -324.25), SIMDE_FLOAT32_C(  -430.17), SIMDE_FLOAT32_C(   175.59),
+        SIMDE_FLOAT32_C(   676.45), SIMDE_FLOAT32_C(  -522.37), SIMDE_FLOAT32_C(   818.73), SIMDE_FLOAT32_C(   334.45) } },
+    { { SIMDE_FLOAT32_C(  -492.26), SIMDE_FLOAT32_C(  -793.14), SIMDE_FLOAT32_C(   392.48), SIMDE_FLOAT32_C(  -394.74),
+        SIMDE_FLOAT32_C(   201.07), SIMDE_FLOAT32_C(   609.35), SIMDE_FLOAT32_C(   381.37), SIMDE_FLOAT32_C(   -20.67) },
+      UINT8_C(139),
+      { SIMDE_FLOAT32_C(   435.48), SIMDE_FLOAT32_C(   890.18), SIMDE_FLOAT32_C(  -612.39), SIMDE_FLOAT32_C(   187.33),
+        SIMDE_FLOAT32_C(   690.72), SIMDE_FLOAT32_C(   683.79), SIMDE_FLOAT32_C(   779.35), SIMDE_FLOAT32_C(  -864.02) },
+      { SIMDE_FLOAT32_C(   435.48), SIMDE_FLOAT32_C(   890.18), SIMDE_FLOAT32_C(   392.48), SIMDE_FLOAT32_C(  -612.39),
+        SIMDE_FLOAT32_C(   201.07), SIMDE_FLOAT32_C(   609.35), SIMDE_FLOAT32_C(   381.37), SIMDE_FLOAT32_C(   187.33) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 src = simde_mm256_loadu_ps(test_vec[i].src);
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m256 r = simde_mm256_mask_expand_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_expand_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { -INT32_C(   254339692), -INT32_C(   161831589), -INT32_C(    16023373),  INT32_C(   468893570), -INT32_C(    99688621),  INT32_C(   534028151), -INT32_C(  2071381167), -INT32_C(  1245830521) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(255),
+      {  INT32_C(   750739285), -INT32_C(  1553003564), -INT32_C(   414376032), -INT32_C(  1423738976), -INT32_C(   514597776), -INT32_C(   693907876), -INT32_C(   445306557), -INT32_C(  1652240458) },
+      {  INT32_C(   750739285), -INT32_C(  1553003564), -INT32_C(   414376032), -INT32_C(  1423738976), -INT32_C(   514597776), -INT32_C(   693907876), -INT32_C(   445306557), -INT32_C(  1652240458) } },
+    { UINT8_C( 80),
+      { -INT32_C(   247898805),  INT32_C(  1452918832),  INT32_C(   991951904),  INT32_C(  1307315857), -INT32_C(  1840596667),  INT32_C(  2122919237),  INT32_C(   188460086),  INT32_C(   536617629) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(   247898805),  INT32_C(           0),  INT32_C(  1452918832),  INT32_C(           0) } },
+    { UINT8_C(148),
+      { -INT32_C(   558945997), -INT32_C(   882274589),  INT32_C(  1127598712),  INT32_C(  1237455555),  INT32_C(   120703181), -INT32_C(  2011823967), -INT32_C(    25091789), -INT32_C(   407083829) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(   558945997),  INT32_C(           0), -INT32_C(   882274589),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1127598712) } },
+    { UINT8_C(245),
+      { -INT32_C(   554309560), -INT32_C(  1882417911), -INT32_C(  2092989376), -INT32_C(   963150900),  INT32_C(  1254955271), -INT32_C(   771475848),  INT32_C(   817312043),  INT32_C(  1540411384) },
+      { -INT32_C(   554309560),  INT32_C(           0), -INT32_C(  1882417911),  INT32_C(           0), -INT32_C(  2092989376), -INT32_C(   963150900),  INT32_C(  1254955271), -INT32_C(   771475848) } },
+    { UINT8_C( 91),
+      {  INT32_C(  1436168232),  INT32_C(  1754893471), -INT32_C(   674205574), -INT32_C(  1773400972), -INT32_C(   105624893),  INT32_C(   686521314), -INT32_C(   676538988), -INT32_C(  1554699314) },
+      {  INT32_C(  1436168232),  INT32_C(  1754893471),  INT32_C(           0), -INT32_C(   674205574), -INT32_C(  1773400972),  INT32_C(           0), -INT32_C(   105624893),  INT32_C(           0) } },
+    { UINT8_C(129),
+      {  INT32_C(  1078653263), -INT32_C(  1763998658), -INT32_C(   562390657),  INT32_C(    14228771), -INT32_C(   946423398),  INT32_C(  1317909056), -INT32_C(  1452829594), -INT32_C(   525781018) },
+      {  INT32_C(  1078653263),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1763998658) } },
+    { UINT8_C(178),
+      {  INT32_C(  2097261265),  INT32_C(  1964207991), -INT32_C(   634375019), -INT32_C(  1836606733), -INT32_C(  1958537345),  INT32_C(   386894410),  INT32_C(   986805525), -INT32_C(  2077833768) },
+      {  INT32_C(           0),  INT32_C(  2097261265),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1964207991), -INT32_C(   634375019),  INT32_C(           0), -INT32_C(  1836606733) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_expand_epi32(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_expand_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      {  INT64_C( 3916450279229545856),  INT64_C(   96672882374961088),  INT64_C(   67493134455962811),  INT64_C( 3443679610078754878) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 15),
+      {  INT64_C(  174160272633638645), -INT64_C( 1285768742258688056), -INT64_C(  977061549139240675),  INT64_C( 3909219615245246259) },
+      {  INT64_C(  174160272633638645), -INT64_C( 1285768742258688056), -INT64_C(  977061549139240675),  INT64_C( 3909219615245246259) } },
+    { UINT8_C(  0),
+      {  INT64_C( 7080407948852073637), -INT64_C( 8835505517174051722), -INT64_C( 2387535977641884194), -INT64_C( 5986991723636613459) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  1),
+      { -INT64_C( 8120638742681935497), -INT64_C( 2116827743189401184), -INT64_C( 7041145108656867499),  INT64_C( 4691042214215509761) },
+      { -INT64_C( 8120638742681935497),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 12),
+      {  INT64_C( 6198284999372597306), -INT64_C( 4669912113523467664),  INT64_C( 3559531428928869826), -INT64_C( 6984046746451183901) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 6198284999372597306), -INT64_C( 4669912113523467664) } },
+    { UINT8_C(  1),
+      {  INT64_C(  310378544218278753),  INT64_C( 1986343952946237938),  INT64_C(  906746544712007441),  INT64_C( 8451298458013382730) },
+      {  INT64_C(  310378544218278753),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  7),
+      {  INT64_C( 7693811591865996073), -INT64_C( 8054490684259294104), -INT64_C( 8304192565802729245),  INT64_C( 2776253409309237937) },
+      {  INT64_C( 7693811591865996073), -INT64_C( 8054490684259294104), -INT64_C( 8304192565802729245),  INT64_C(                   0) } },
+    { UINT8_C( 12),
+      { -INT64_C( 6932082137331590210),  INT64_C( 7813263889703940562), -INT64_C( 6488872267815430032),  INT64_C( 3029304984095681658) },
+      {  INT64_C(                   0),  INT64_C(                   0), -INT64_C( 6932082137331590210),  INT64_C( 7813263889703940562) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_expand_epi64(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_expand_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { SIMDE_FLOAT64_C(   772.58), SIMDE_FLOAT64_C(  -699.84), SIMDE_FLOAT64_C(  -929.97), SIMDE_FLOAT64_C(   561.40) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C( 15),
+      { SIMDE_FLOAT64_C(  -271.62), SIMDE_FLOAT64_C(  -140.57), SIMDE_FLOAT64_C(   127.18), SIMDE_FLOAT64_C(  -144.13) },
+      { SIMDE_FLOAT64_C(  -271.62), SIMDE_FLOAT64_C(  -140.57), SIMDE_FLOAT64_C(   127.18), SIMDE_FLOAT64_C(  -144.13) } },
+    { UINT8_C( 13),
+      { SIMDE_FLOAT64_C(   256.11), SIMDE_FLOAT64_C(    54.43), SIMDE_FLOAT64_C(  -499.26), SIMDE_FLOAT64_C(   327.56) },
+      { SIMDE_FLOAT64_C(   256.11), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(    54.43), SIMDE_FLOAT64_C(  -499.26) } },
+    { UINT8_C( 14),
+      { SIMDE_FLOAT64_C(   436.49), SIMDE_FLOAT64_C(   939.06), SIMDE_FLOAT64_C(  -258.72), SIMDE_FLOAT64_C(   852.60) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   436.49), SIMDE_FLOAT64_C(   939.06), SIMDE_FLOAT64_C(  -258.72) } },
+    { UINT8_C(  0),
+      { SIMDE_FLOAT64_C(  -345.31), SIMDE_FLOAT64_C(   288.09), SIMDE_FLOAT64_C(  -620.35), SIMDE_FLOAT64_C(   975.45) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(  8),
+      { SIMDE_FLOAT64_C(  -654.46), SIMDE_FLOAT64_C(  -675.91), SIMDE_FLOAT64_C(  -803.53), SIMDE_FLOAT64_C(   557.26) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -654.46) } },
+    { UINT8_C(  8),
+      { SIMDE_FLOAT64_C(  -576.25), SIMDE_FLOAT64_C(   900.77), SIMDE_FLOAT64_C(   -17.42), SIMDE_FLOAT64_C(   -32.22) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -576.25) } },
+    { UINT8_C(  9),
+      { SIMDE_FLOAT64_C(   364.57), SIMDE_FLOAT64_C(   959.20), SIMDE_FLOAT64_C(  -359.42), SIMDE_FLOAT64_C(  -796.45) },
+      { SIMDE_FLOAT64_C(   364.57), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   959.20) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde__m256d r = simde_mm256_maskz_expand_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_expand_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { SIMDE_FLOAT32_C(   934.33), SIMDE_FLOAT32_C(  -526.07), SIMDE_FLOAT32_C(   452.71), SIMDE_FLOAT32_C(  -414.06),
+        SIMDE_FLOAT32_C(   446.72), SIMDE_FLOAT32_C(   390.44), SIMDE_FLOAT32_C(  -618.93), SIMDE_FLOAT32_C(   623.87) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(255),
+      { SIMDE_FLOAT32_C(   -55.85), SIMDE_FLOAT32_C(   179.93), SIMDE_FLOAT32_C(   890.70), SIMDE_FLOAT32_C(  -389.36),
+        SIMDE_FLOAT32_C(  -616.99), SIMDE_FLOAT32_C(    76.13), SIMDE_FLOAT32_C(   132.92), SIMDE_FLOAT32_C(  -433.76) },
+      { SIMDE_FLOAT32_C(   -55.85), SIMDE_FLOAT32_C(   179.93), SIMDE_FLOAT32_C(   890.70), SIMDE_FLOAT32_C(  -389.36),
+        SIMDE_FLOAT32_C(  -616.99), SIMDE_FLOAT32_C(    76.13), SIMDE_FLOAT32_C(   132.92), SIMDE_FLOAT32_C(  -433.76) } },
+    { UINT8_C(235),
+      { SIMDE_FLOAT32_C(   363.85), SIMDE_FLOAT32_C(     1.60), SIMDE_FLOAT32_C(  -763.09), SIMDE_FLOAT32_C(   327.84),
+        SIMDE_FLOAT32_C(   916.45), SIMDE_FLOAT32_C(    -0.64), SIMDE_FLOAT32_C(   857.69), SIMDE_FLOAT32_C(   120.56) },
+      { SIMDE_FLOAT32_C(   363.85), SIMDE_FLOAT32_C(     1.60), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -763.09),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   327.84), SIMDE_FLOAT32_C(   916.45), SIMDE_FLOAT32_C(    -0.64) } },
+    { UINT8_C(172),
+      { SIMDE_FLOAT32_C(   397.83), SIMDE_FLOAT32_C(   653.59), SIMDE_FLOAT32_C(  -571.37), SIMDE_FLOAT32_C(   541.99),
+        SIMDE_FLOAT32_C(   343.57), SIMDE_FLOAT32_C(   270.07), SIMDE_FLOAT32_C(  -733.59), SIMDE_FLOAT32_C(   152.98) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   397.83), SIMDE_FLOAT32_C(   653.59),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -571.37), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   541.99) } },
+    { UINT8_C(211),
+      { SIMDE_FLOAT32_C(   278.38), SIMDE_FLOAT32_C(   979.63), SIMDE_FLOAT32_C(   756.20), SIMDE_FLOAT32_C(  -859.26),
+        SIMDE_FLOAT32_C(   530.14), SIMDE_FLOAT32_C(   870.68), SIMDE_FLOAT32_C(  -866.62), SIMDE_FLOAT32_C(   400.30) },
+      { SIMDE_FLOAT32_C(   278.38), SIMDE_FLOAT32_C(   979.63), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(   756.20), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -859.26), SIMDE_FLOAT32_C(   530.14) } },
+    { UINT8_C(139),
+      { SIMDE_FLOAT32_C(  -745.50), SIMDE_FLOAT32_C(   -75.37), SIMDE_FLOAT32_C(  -876.39), SIMDE_FLOAT32_C(   -89.73),
+        SIMDE_FLOAT32_C(   297.72), SIMDE_FLOAT32_C(  -839.05), SIMDE_FLOAT32_C(  -859.77), SIMDE_FLOAT32_C(   167.29) },
+      { SIMDE_FLOAT32_C(  -745.50), SIMDE_FLOAT32_C(   -75.37), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -876.39),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   -89.73) } },
+    { UINT8_C( 14),
+      { SIMDE_FLOAT32_C(  -897.64), SIMDE_FLOAT32_C(  -846.44), SIMDE_FLOAT32_C(  -409.67), SIMDE_FLOAT32_C(   301.36),
+        SIMDE_FLOAT32_C(   654.63), SIMDE_FLOAT32_C(  -500.67), SIMDE_FLOAT32_C(   847.50), SIMDE_FLOAT32_C(   640.70) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -897.64), SIMDE_FLOAT32_C(  -846.44), SIMDE_FLOAT32_C(  -409.67),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT8_C(210),
+      { SIMDE_FLOAT32_C(  -670.66), SIMDE_FLOAT32_C(  -147.41), SIMDE_FLOAT32_C(  -884.13), SIMDE_FLOAT32_C(   312.48),
+        SIMDE_FLOAT32_C(  -768.05), SIMDE_FLOAT32_C(   398.63), SIMDE_FLOAT32_C(  -417.76), SIMDE_FLOAT32_C(  -301.48) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -670.66), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(  -147.41), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -884.13), SIMDE_FLOAT32_C(   312.48) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m256 r = simde_mm256_maskz_expand_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_expand_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { {  INT32_C(  1192978757),  INT32_C(  1253676721), -INT32_C(   466167830),  INT32_C(   645814485), -INT32_C(   602513352),  INT32_C(  1168911595),  INT32_C(   135942899),  INT32_C(  1556171258),
+        -INT32_C(  1513720822),  INT32_C(  1327956868),  INT32_C(  1581550931),  INT32_C(  1933418072), -INT32_C(   232630647), -INT32_C(   910903513), -INT32_C(   766205978), -INT32_C(  1716724979) },
+      UINT16_C(    0),
+      { -INT32_C(  1868710358),  INT32_C(   479560383), -INT32_C(  1885155920),  INT32_C(   340136998),  INT32_C(  1274058704), -INT32_C(   255216501),  INT32_C(   536104587),  INT32_C(  1876729605),
+         INT32_C(   734036241),  INT32_C(    36449511), -INT32_C(  1594510772), -INT32_C(   436696269), -INT32_C(  1594508790),  INT32_C(  1662868827),  INT32_C(  1879589511),  INT32_C(  1804120504) },
+      {  INT32_C(  1192978757),  INT32_C(  1253676721), -INT32_C(   466167830),  INT32_C(   645814485), -INT32_C(   602513352),  INT32_C(  1168911595),  INT32_C(   135942899),  INT32_C(  1556171258),
+        -INT32_C(  1513720822),  INT32_C(  1327956868),  INT32_C(  1581550931),  INT32_C(  1933418072), -INT32_C(   232630647), -INT32_C(   910903513), -INT32_C(   766205978), -INT32_C(  1716724979) } },
+    { {  INT32_C(  1842648570), -INT32_C(   649489273), -INT32_C(   439962650), -INT32_C(   826439604),  INT32_C(  1537353353),  INT32_C(  1938092881), -INT32_C(   658517321), -INT32_C(   101132445),
+         INT32_C(   253334548), -INT32_C(   715950805), -INT32_C(  1767568922), -INT32_C(  1562117997), -INT32_C(  1922839309),  INT32_C(   335183366),  INT32_C(  1112726899), -INT32_C(  2002169412) },
+      UINT16_C(65535),
+      {  INT32_C(  1447493403),  INT32_C(  1714475472),  INT32_C(   834566202),  INT32_C(   607153347), -INT32_C(  1312913494),  INT32_C(  1693550124), -INT32_C(   776276578), -INT32_C(  2102823522),
+        -INT32_C(   594718911),  INT32_C(  1727465269),  INT32_C(  1142483354), -INT32_C(  2061680728),  INT32_C(  1312339418), -INT32_C(   871486942), -INT32_C(  1915295375),  INT32_C(  1139685396) },
+      {  INT32_C(  1447493403),  INT32_C(  1714475472),  INT32_C(   834566202),  INT32_C(   607153347), -INT32_C(  1312913494),  INT32_C(  1693550124), -INT32_C(   776276578), -INT32_C(  2102823522),
+        -INT32_C(   594718911),  INT32_C(  1727465269),  INT32_C(  1142483354), -INT32_C(  2061680728),  INT32_C(  1312339418), -INT32_C(   871486942), -INT32_C(  1915295375),  INT32_C(  1139685396) } },
+    { { -INT32_C(   159771911),  INT32_C(   823735119),  INT32_C(   777546411), -INT32_C(  1464474030), -INT32_C(   708654759),  INT32_C(  1445258194),  INT32_C(   128324168), -INT32_C(   223501183),
+        -INT32_C(   591683923), -INT32_C(  1877830273), -INT32_C(   285517465), -INT32_C(   179104471), -INT32_C(   433269806),  INT32_C(  1875777173),  INT32_C(  2084476701),  INT32_C(  1289960332) },
+      UINT16_C(17973),
+      { -INT32_C(   768200684),  INT32_C(   161103079),  INT32_C(  1077578089),  INT32_C(  1000248792), -INT32_C(  1993876293), -INT32_C(  1992976812),  INT32_C(     7010688),  INT32_C(   100455332),
+         INT32_C(   932315285),  INT32_C(  2071576735), -INT32_C(  1324898635),  INT32_C(   278375490), -INT32_C(  2146169330), -INT32_C(  1987966329), -INT32_C(  1133319740),  INT32_C(  1138549583) },
+      { -INT32_C(   768200684),  INT32_C(   823735119),  INT32_C(   161103079), -INT32_C(  1464474030),  INT32_C(  1077578089),  INT32_C(  1000248792),  INT32_C(   128324168), -INT32_C(   223501183),
+        -INT32_C(   591683923), -INT32_C(  1993876293), -INT32_C(  1992976812), -INT32_C(   179104471), -INT32_C(   433269806),  INT32_C(  1875777173),  INT32_C(     7010688),  INT32_C(  1289960332) } },
+    { { -INT32_C(   446997610), -INT32_C(   359813022), -INT32_C(   832126655), -INT32_C(    99577081),  INT32_C(  1821746933),  INT32_C(  1717866962), -INT32_C(    13245934), -INT32_C(   935553630),
+         INT32_C(  1406179073),  INT32_C(   595602173),  INT32_C(   519901529),  INT32_C(   259390976), -INT32_C(  1231826727), -INT32_C(  1444089011),  INT32_C(  1168164848),  INT32_C(   209233157) },
+      UINT16_C(33745),
+      {  INT32_C(  1206156352),  INT32_C(     4490065), -INT32_C(  2017837550),  INT32_C(  1435426252), -INT32_C(  1175660791),  INT32_C(   133086638), -INT32_C(   511752857),  INT32_C(   196256208),
+         INT32_C(  1135393551), -INT32_C(  1083480251),  INT32_C(  1999105078),  INT32_C(  1524888303),  INT32_C(   188069976), -INT32_C(   687106877), -INT32_C(   498588064),  INT32_C(    40815397) },
+      {  INT32_C(  1206156352), -INT32_C(   359813022), -INT32_C(   832126655), -INT32_C(    99577081),  INT32_C(     4490065),  INT32_C(  1717866962), -INT32_C(  2017837550),  INT32_C(  1435426252),
+        -INT32_C(  1175660791),  INT32_C(   133086638),  INT32_C(   519901529),  INT32_C(   259390976), -INT32_C(  1231826727), -INT32_C(  1444089011),  INT32_C(  1168164848), -INT32_C(   511752857) } },
+    { { -INT32_C(   986743957), -INT32_C(   576710626), -INT32_C(   408780306),  INT32_C(   680751016), -INT32_C(  1282272190), -INT32_C(  1655336892), -INT32_C(   280280114),  INT32_C(   438367738),
+        -INT32_C(   469621658), -INT32_C(   816066427),  INT32_C(   116607880), -INT32_C(   743156172),  INT32_C(  1657602542), -INT32_C(   606318482), -INT32_C(  2126699052),  INT32_C(   648102308) },
+      UINT16_C(50656),
+      {  INT32_C(  1127189050), -INT32_C(   351298861),  INT32_C(  1094529438), -INT32_C(   629621911), -INT32_C(   563198737),  INT32_C(   774787293),  INT32_C(   454648318), -INT32_C(  1420851507),
+         INT32_C(  1959524896),  INT32_C(  1528813096),  INT32_C(  1853542155), -INT32_C(   319574518), -INT32_C(  1897584855),  INT32_C(  1612189875), -INT32_C(  1433675692), -INT32_C(   926426423) },
+      { -INT32_C(   986743957), -INT32_C(   576710626), -INT32_C(   408780306),  INT32_C(   680751016), -INT32_C(  1282272190),  INT32_C(  1127189050), -INT32_C(   351298861),  INT32_C(  1094529438),
+        -INT32_C(   629621911), -INT32_C(   816066427), -INT32_C(   563198737), -INT32_C(   743156172),  INT32_C(  1657602542), -INT32_C(   606318482),  INT32_C(   774787293),  INT32_C(   454648318) } },
+    { {  INT32_C(  2019558998),  INT32_C(   296758384),  INT32_C(  1368704293),  INT32_C(   464453427), -INT32_C(   901473419),  INT32_C(  1126527791),  INT32_C(  1112684715), -INT32_C(  1792714360),
+        -INT32_C(  2053463560), -INT32_C(   556574308), -INT32_C(  1856944817), -INT32_C(  1457974370), -INT32_C(   830671926),  INT32_C(   257666189), -INT32_C(   543261991), -INT32_C(   790557794) },
+      UINT16_C(42207),
+      { -INT32_C(  1371131727), -INT32_C(  1816625947), -INT32_C(   688315500), -INT32_C(  1886385461),  INT32_C(  1067873358), -INT32_C(   985060507),  INT32_C(   162197980), -INT32_C(   207436981),
+         INT32_C(  1087574500), -INT32_C(  1322436624), -INT32_C(  1241344582), -INT32_C(  2117043003),  INT32_C(   389244916), -INT32_C(   153897243), -INT32_C(   798568579),  INT32_C(   563217661) },
+      { -INT32_C(  1371131727), -INT32_C(  1816625947), -INT32_C(   688315500), -INT32_C(  1886385461),  INT32_C(  1067873358),  INT32_C(  1126527791), -INT32_C(   985060507),  INT32_C(   162197980),
+        -INT32_C(  2053463560), -INT32_C(   556574308), -INT32_C(   207436981), -INT32_C(  1457974370), -INT32_C(   830671926),  INT32_C(  1087574500), -INT32_C(   543261991), -INT32_C(  1322436624) } },
+    { { -INT32_C(  1714544086),  INT32_C(   597564966),  INT32_C(   730242345), -INT32_C(  1868964731), -INT32_C(  1980224347),  INT32_C(  1968120216), -INT32_C(   548820233),  INT32_C(   829404182),
+        -INT32_C(  1563300633),  INT32_C(  1471552661), -INT32_C(    87339225), -INT32_C(  1745079653), -INT32_C(  1511104926),  INT32_C(  1675670524),  INT32_C(   931700607),  INT32_C(  1086263577) },
+      UINT16_C(24533),
+      {  INT32_C(  1679581790), -INT32_C(  2079524892),  INT32_C(  1202345671),  INT32_C(  1129122133), -INT32_C(   662343335),  INT32_C(   558889137), -INT32_C(  1791276673),  INT32_C(  1300368412),
+        -INT32_C(  2122334007), -INT32_C(  2065625638),  INT32_C(  1571217187),  INT32_C(   368877945), -INT32_C(  2008351929), -INT32_C(  1864651033),  INT32_C(   133701877), -INT32_C(  1977192779) },
+      {  INT32_C(  1679581790),  INT32_C(   597564966), -INT32_C(  2079524892), -INT32_C(  1868964731),  INT32_C(  1202345671),  INT32_C(  1968120216),  INT32_C(  1129122133), -INT32_C(   662343335),
+         INT32_C(   558889137), -INT32_C(  1791276673),  INT32_C(  1300368412), -INT32_C(  2122334007), -INT32_C(  2065625638),  INT32_C(  1675670524),  INT32_C(  1571217187),  INT32_C(  1086263577) } },
+    { { -INT32_C(   858947708),  INT32_C(  1681936081), -INT32_C(  1687856708),  INT32_C(  1675394130), -INT32_C(   878787741),  INT32_C(   897151408),  INT32_C(  2064226995), -INT32_C(   936887087),
+         INT32_C(  1094666615),  INT32_C(    13106917),  INT32_C(  2053670332), -INT32_C(  1909919328),  INT32_C(  1087203619),  INT32_C(   551247802),  INT32_C(  1770407018), -INT32_C(  1456871269) },
+      UINT16_C(12453),
+      {  INT32_C(  1981170258), -INT32_C(   265888378),  INT32_C(  1027162423), -INT32_C(   236575007), -INT32_C(   955565678),  INT32_C(   864994238), -INT32_C(  1032009877), -INT32_C(  1323091089),
+         INT32_C(   438614992), -INT32_C(  1148694488), -INT32_C(   914179094),  INT32_C(  1168125464), -INT32_C(  1563718969), -INT32_C(  1938908359), -INT32_C(  1468918085), -INT32_C(   743553853) },
+      {  INT32_C(  1981170258),  INT32_C(  1681936081), -INT32_C(   265888378),  INT32_C(  1675394130), -INT32_C(   878787741),  INT32_C(  1027162423),  INT32_C(  2064226995), -INT32_C(   236575007),
+         INT32_C(  1094666615),  INT32_C(    13106917),  INT32_C(  2053670332), -INT32_C(  1909919328), -INT32_C(   955565678),  INT32_C(   864994238),  INT32_C(  1770407018), -INT32_C(  1456871269) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_expand_epi32(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_expand_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[8];
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { {  INT64_C( 6770118037530406372), -INT64_C( 5660697187761892177),  INT64_C( 4431777134674613644),  INT64_C( 3679956008948916001),
+        -INT64_C( 7291506649301675371),  INT64_C( 1237732980253732123),  INT64_C( 5110992489586314111), -INT64_C( 3083981570877414274) },
+      UINT8_C(  0),
+      { -INT64_C(  321441435770876470),  INT64_C( 2078300159509273112),  INT64_C(  608628662012698610),  INT64_C( 7868733240788336076),
+        -INT64_C( 2328650062853613791), -INT64_C( 4752789584695763938), -INT64_C( 8861506672513861769),  INT64_C( 1613132587238974044) },
+      {  INT64_C( 6770118037530406372), -INT64_C( 5660697187761892177),  INT64_C( 4431777134674613644),  INT64_C( 3679956008948916001),
+        -INT64_C( 7291506649301675371),  INT64_C( 1237732980253732123),  INT64_C( 5110992489586314111), -INT64_C( 3083981570877414274) } },
+    { { -INT64_C( 4280826288645185438),  INT64_C( 5865692131082481917),  INT64_C( 2052660088149210401), -INT64_C( 6254044920155621828),
+         INT64_C(  436379257650471824), -INT64_C( 2047421814254809122), -INT64_C( 2256988481270288298), -INT64_C( 4415825464644667523) },
+      UINT8_C(255),
+      { -INT64_C( 2670303286706210007), -INT64_C( 2395066604672919305), -INT64_C( 3648570525258059021), -INT64_C( 4958515654337605080),
+         INT64_C( 6973086456275799160),  INT64_C(  571048342683097604), -INT64_C( 2492995538669186733),  INT64_C(  794081707932808798) },
+      { -INT64_C( 2670303286706210007), -INT64_C( 2395066604672919305), -INT64_C( 3648570525258059021), -INT64_C( 4958515654337605080),
+         INT64_C( 6973086456275799160),  INT64_C(  571048342683097604), -INT64_C( 2492995538669186733),  INT64_C(  794081707932808798) } },
+    { { -INT64_C(  154757731888050865), -INT64_C(  286408961570415676),  INT64_C( 7249990044118763291),  INT64_C(  818452665448958874),
+        -INT64_C( 4237383359673857191),  INT64_C(  769404764751424638),  INT64_C( 4119013042550521794), -INT64_C(  225269716330411703) },
+      UINT8_C( 15),
+      { -INT64_C( 7015104811441018039),  INT64_C( 2719745472090840315),  INT64_C( 4649695776828593925),  INT64_C( 4045389265951493742),
+        -INT64_C( 8445961370204500358), -INT64_C( 5194152792424677061), -INT64_C( 8678901825259362418),  INT64_C( 4160366353402484734) },
+      { -INT64_C( 7015104811441018039),  INT64_C( 2719745472090840315),  INT64_C( 4649695776828593925),  INT64_C( 4045389265951493742),
+        -INT64_C( 4237383359673857191),  INT64_C(  769404764751424638),  INT64_C( 4119013042550521794), -INT64_C(  225269716330411703) } },
+    { {  INT64_C( 7504820005929045783), -INT64_C( 2457642590872130956),  INT64_C(  888035439607588760),  INT64_C( 4214979221403706976),
+         INT64_C(  112695956459939818),  INT64_C( 8089085203543958861), -INT64_C( 8945777825797998512),  INT64_C( 2814525407684215422) },
+      UINT8_C( 45),
+      {  INT64_C( 7829376824996893923), -INT64_C( 1571094317447315576), -INT64_C( 8617535936835341125),  INT64_C( 8295045738552415503),
+        -INT64_C( 8255119673996532883),  INT64_C( 8652135517378078724),  INT64_C( 6520352150522585722),  INT64_C( 5197816502450692596) },
+      {  INT64_C( 7829376824996893923), -INT64_C( 2457642590872130956), -INT64_C( 1571094317447315576), -INT64_C( 8617535936835341125),
+         INT64_C(  112695956459939818),  INT64_C( 8295045738552415503), -INT64_C( 8945777825797998512),  INT64_C( 2814525407684215422) } },
+    { { -INT64_C(  809531941073950547),  INT64_C( 8323246100422630775), -INT64_C( 2393202808515864337), -INT64_C( 4988871075162360095),
+         INT64_C( 8481038260860426035),  INT64_C( 5232460974661725323),  INT64_C( 9142252734144467486),  INT64_C( 7894269925604981792) },
+      UINT8_C(240),
+      { -INT64_C( 8625986559941815115), -INT64_C(  690706149459545309), -INT64_C( 1305418521526055611), -INT64_C( 9066775029565750190),
+         INT64_C( 7770508536847395035), -INT64_C( 3161460604537683245), -INT64_C( 1660798426623871253),  INT64_C( 8637931225257084635) },
+      { -INT64_C(  809531941073950547),  INT64_C( 8323246100422630775), -INT64_C( 2393202808515864337), -INT64_C( 4988871075162360095),
+        -INT64_C( 8625986559941815115), -INT64_C(  690706149459545309), -INT64_C( 1305418521526055611), -INT64_C( 9066775029565750190) } },
+    { {  INT64_C( 6848107729425293973),  INT64_C( 1379108839080205469), -INT64_C( 4370321959199789823),  INT64_C( 6911404937866571702),
+        -INT64_C(  213439298710174017), -INT64_C( 8783696074680912500),  INT64_C( 4425660968108070235),  INT64_C( 6317517413167314697) },
+      UINT8_C( 89),
+      {  INT64_C( 7672085544772013823), -INT64_C( 3406998996908824078), -INT64_C( 3648175864443115195),  INT64_C( 6616417212859481526),
+         INT64_C( 3151024129054700369), -INT64_C( 8511736767181263507),  INT64_C( 4264107620616336830),  INT64_C( 2287542517791488681) },
+      {  INT64_C( 7672085544772013823),  INT64_C( 1379108839080205469), -INT64_C( 4370321959199789823), -INT64_C( 3406998996908824078),
+        -INT64_C( 3648175864443115195), -INT64_C( 8783696074680912500),  INT64_C( 6616417212859481526),  INT64_C( 6317517413167314697) } },
+    { { -INT64_C( 7006073541975807741),  INT64_C( 5095814289208566075),  INT64_C( 5188337449027806140), -INT64_C( 7945874049340162012),
+         INT64_C( 2903808168295129088), -INT64_C( 3374336572826838976),  INT64_C( 6847021842604122120), -INT64_C( 3985765988273273019) },
+      UINT8_C(  1),
+      { -INT64_C( 3347701359134169757),  INT64_C(  851849340599262770),  INT64_C( 7342257133781376209),  INT64_C( 5339677435509278587),
+        -INT64_C( 3525816784959047674),  INT64_C( 1545063742986671156), -INT64_C( 4143655326513231731), -INT64_C(  219637465775915691) },
+      { -INT64_C( 3347701359134169757),  INT64_C( 5095814289208566075),  INT64_C( 5188337449027806140), -INT64_C( 7945874049340162012),
+         INT64_C( 2903808168295129088), -INT64_C( 3374336572826838976),  INT64_C( 6847021842604122120), -INT64_C( 3985765988273273019) } },
+    { {  INT64_C( 5657982868751121557), -INT64_C( 5297772869043449912),  INT64_C( 8699133803096030341),  INT64_C( 9017730139003693652),
+         INT64_C( 8751361710079748817), -INT64_C( 7775420509652528907),  INT64_C( 4658380397851933541), -INT64_C( 8843453296979578840) },
+      UINT8_C(  5),
+      {  INT64_C( 5320445446152910922), -INT64_C( 5204465608107654425), -INT64_C( 8391780040600512546), -INT64_C( 5821052673020725832),
+        -INT64_C( 7300983491594927056),  INT64_C( 6676483344285794457), -INT64_C( 4986102052945256862), -INT64_C( 1719237194796483873) },
+      {  INT64_C( 5320445446152910922), -INT64_C( 5297772869043449912), -INT64_C( 5204465608107654425),  INT64_C( 9017730139003693652),
+         INT64_C( 8751361710079748817), -INT64_C( 7775420509652528907),  INT64_C( 4658380397851933541), -INT64_C( 8843453296979578840) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi64(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_expand_epi64(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_expand_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[8];
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   818.77), SIMDE_FLOAT64_C(  -384.62), SIMDE_FLOAT64_C(  -620.98), SIMDE_FLOAT64_C(   501.99),
+        SIMDE_FLOAT64_C(  -856.91), SIMDE_FLOAT64_C(   138.13), SIMDE_FLOAT64_C(  -991.25), SIMDE_FLOAT64_C(  -852.52) },
+      UINT8_C(  0),
+      { SIMDE_FLOAT64_C(  -446.12), SIMDE_FLOAT64_C(    55.76), SIMDE_FLOAT64_C(   -16.63), SIMDE_FLOAT64_C(  -545.90),
+        SIMDE_FLOAT64_C(   779.45), SIMDE_FLOAT64_C(   688.22), SIMDE_FLOAT64_C(   220.70), SIMDE_FLOAT64_C(   753.37) },
+      { SIMDE_FLOAT64_C(   818.77), SIMDE_FLOAT64_C(  -384.62), SIMDE_FLOAT64_C(  -620.98), SIMDE_FLOAT64_C(   501.99),
+        SIMDE_FLOAT64_C(  -856.91), SIMDE_FLOAT64_C(   138.13), SIMDE_FLOAT64_C(  -991.25), SIMDE_FLOAT64_C(  -852.52) } },
+    { { SIMDE_FLOAT64_C(  -572.06), SIMDE_FLOAT64_C(   213.96), SIMDE_FLOAT64_C(   496.07), SIMDE_FLOAT64_C(  -623.75),
+        SIMDE_FLOAT64_C(  -501.80), SIMDE_FLOAT64_C(   165.34), SIMDE_FLOAT64_C(   287.77), SIMDE_FLOAT64_C(  -554.96) },
+      UINT8_C(255),
+      { SIMDE_FLOAT64_C(  -792.12), SIMDE_FLOAT64_C(   554.24), SIMDE_FLOAT64_C(   460.14), SIMDE_FLOAT64_C(   912.47),
+        SIMDE_FLOAT64_C(  -183.39), SIMDE_FLOAT64_C(  -528.28), SIMDE_FLOAT64_C(   983.19), SIMDE_FLOAT64_C(   389.66) },
+      { SIMDE_FLOAT64_C(  -792.12), SIMDE_FLOAT64_C(   554.24), SIMDE_FLOAT64_C(   460.14), SIMDE_FLOAT64_C(   912.47),
+        SIMDE_FLOAT64_C(  -183.39), SIMDE_FLOAT64_C(  -528.28), SIMDE_FLOAT64_C(   983.19), SIMDE_FLOAT64_C(   389.66) } },
+    { { SIMDE_FLOAT64_C(   940.18), SIMDE_FLOAT64_C(   427.31), SIMDE_FLOAT64_C(  -265.05), SIMDE_FLOAT64_C(  -764.80),
+        SIMDE_FLOAT64_C(  -274.01), SIMDE_FLOAT64_C(  -458.66), SIMDE_FLOAT64_C(   122.74), SIMDE_FLOAT64_C(   483.85) },
+      UINT8_C(203),
+      { SIMDE_FLOAT64_C(  -295.57), SIMDE_FLOAT64_C(  -528.19), SIMDE_FLOAT64_C(   791.37), SIMDE_FLOAT64_C(   -58.50),
+        SIMDE_FLOAT64_C(   507.25), SIMDE_FLOAT64_C(   343.21), SIMDE_FLOAT64_C(   532.33), SIMDE_FLOAT64_C(   392.18) },
+      { SIMDE_FLOAT64_C(  -295.57), SIMDE_FLOAT64_C(  -528.19), SIMDE_FLOAT64_C(  -265.05), SIMDE_FLOAT64_C(   791.37),
+        SIMDE_FLOAT64_C(  -274.01), SIMDE_FLOAT64_C(  -458.66), SIMDE_FLOAT64_C(   -58.50), SIMDE_FLOAT64_C(   507.25) } },
+    { { SIMDE_FLOAT64_C(   -17.82), SIMDE_FLOAT64_C(  -672.15), SIMDE_FLOAT64_C(   376.24), SIMDE_FLOAT64_C(  -494.59),
+        SIMDE_FLOAT64_C(  -989.30), SIMDE_FLOAT64_C(  -783.49), SIMDE_FLOAT64_C(   541.68), SIMDE_FLOAT64_C(  -207.88) },
+      UINT8_C( 66),
+      { SIMDE_FLOAT64_C(   272.09), SIMDE_FLOAT64_C(  -974.51), SIMDE_FLOAT64_C(   778.64), SIMDE_FLOAT64_C(   305.62),
+        SIMDE_FLOAT64_C(   912.13), SIMDE_FLOAT64_C(   458.75), SIMDE_FLOAT64_C(  -643.65), SIMDE_FLOAT64_C(  -537.65) },
+      { SIMDE_FLOAT64_C(   -17.82), SIMDE_FLOAT64_C(   272.09), SIMDE_FLOAT64_C(   376.24), SIMDE_FLOAT64_C(  -494.59),
+        SIMDE_FLOAT64_C(  -989.30), SIMDE_FLOAT64_C(  -783.49), SIMDE_FLOAT64_C(  -974.51), SIMDE_FLOAT64_C(  -207.88) } },
+    { { SIMDE_FLOAT64_C(  -838.65), SIMDE_FLOAT64_C(  -793.16), SIMDE_FLOAT64_C(   954.26), SIMDE_FLOAT64_C(  -723.42),
+        SIMDE_FLOAT64_C(   108.04), SIMDE_FLOAT64_C(  -280.69), SIMDE_FLOAT64_C(  -452.52), SIMDE_FLOAT64_C(   577.94) },
+      UINT8_C( 99),
+      { SIMDE_FLOAT64_C(   178.73), SIMDE_FLOAT64_C(  -685.21), SIMDE_FLOAT64_C(  -163.59), SIMDE_FLOAT64_C(  -993.52),
+        SIMDE_FLOAT64_C(  -721.69), SIMDE_FLOAT64_C(    58.47), SIMDE_FLOAT64_C(    -1.12), SIMDE_FLOAT64_C(  -691.22) },
+      { SIMDE_FLOAT64_C(   178.73), SIMDE_FLOAT64_C(  -685.21), SIMDE_FLOAT64_C(   954.26), SIMDE_FLOAT64_C(  -723.42),
+        SIMDE_FLOAT64_C(   108.04), SIMDE_FLOAT64_C(  -163.59), SIMDE_FLOAT64_C(  -993.52), SIMDE_FLOAT64_C(   577.94) } },
+    { { SIMDE_FLOAT64_C(   922.75), SIMDE_FLOAT64_C(  -864.23), SIMDE_FLOAT64_C(  -536.72), SIMDE_FLOAT64_C(   394.88),
+        SIMDE_FLOAT64_C(  -324.56), SIMDE_FLOAT64_C(   914.24), SIMDE_FLOAT64_C(  -343.81), SIMDE_FLOAT64_C(   205.32) },
+      UINT8_C(158),
+      { SIMDE_FLOAT64_C(  -486.33), SIMDE_FLOAT64_C(   510.30), SIMDE_FLOAT64_C(  -133.92), SIMDE_FLOAT64_C(  -595.84),
+        SIMDE_FLOAT64_C(   935.01), SIMDE_FLOAT64_C(  -336.88), SIMDE_FLOAT64_C(   936.20), SIMDE_FLOAT64_C(   206.50) },
+      { SIMDE_FLOAT64_C(   922.75), SIMDE_FLOAT64_C(  -486.33), SIMDE_FLOAT64_C(   510.30), SIMDE_FLOAT64_C(  -133.92),
+        SIMDE_FLOAT64_C(  -595.84), SIMDE_FLOAT64_C(   914.24), SIMDE_FLOAT64_C(  -343.81), SIMDE_FLOAT64_C(   935.01) } },
+    { { SIMDE_FLOAT64_C(   -98.46), SIMDE_FLOAT64_C(  -303.25), SIMDE_FLOAT64_C(  -697.99), SIMDE_FLOAT64_C(  -277.11),
+        SIMDE_FLOAT64_C(   678.79), SIMDE_FLOAT64_C(  -993.49), SIMDE_FLOAT64_C(   176.02), SIMDE_FLOAT64_C(     2.80) },
+      UINT8_C( 32),
+      { SIMDE_FLOAT64_C(   105.04), SIMDE_FLOAT64_C(  -128.30), SIMDE_FLOAT64_C(  -236.06), SIMDE_FLOAT64_C(   271.24),
+        SIMDE_FLOAT64_C(  -889.74), SIMDE_FLOAT64_C(   374.06), SIMDE_FLOAT64_C(   543.98), SIMDE_FLOAT64_C(  -706.54) },
+      { SIMDE_FLOAT64_C(   -98.46), SIMDE_FLOAT64_C(  -303.25), SIMDE_FLOAT64_C(  -697.99), SIMDE_FLOAT64_C(  -277.11),
+        SIMDE_FLOAT64_C(   678.79), SIMDE_FLOAT64_C(   105.04), SIMDE_FLOAT64_C(   176.02), SIMDE_FLOAT64_C(     2.80) } },
+    { { SIMDE_FLOAT64_C(   -92.75), SIMDE_FLOAT64_C(  -614.37), SIMDE_FLOAT64_C(    63.23), SIMDE_FLOAT64_C(  -100.07),
+        SIMDE_FLOAT64_C(   938.35), SIMDE_FLOAT64_C(   847.34), SIMDE_FLOAT64_C(  -378.84), SIMDE_FLOAT64_C(  -831.27) },
+      UINT8_C( 63),
+      { SIMDE_FLOAT64_C(   700.80), SIMDE_FLOAT64_C(   662.81), SIMDE_FLOAT64_C(   -88.48), SIMDE_FLOAT64_C(  -555.48),
+        SIMDE_FLOAT64_C(   893.32), SIMDE_FLOAT64_C(   763.30), SIMDE_FLOAT64_C(   312.82), SIMDE_FLOAT64_C(  -117.50) },
+      { SIMDE_FLOAT64_C(   700.80), SIMDE_FLOAT64_C(   662.81), SIMDE_FLOAT64_C(   -88.48), SIMDE_FLOAT64_C(  -555.48),
+        SIMDE_FLOAT64_C(   893.32), SIMDE_FLOAT64_C(   763.30), SIMDE_FLOAT64_C(  -378.84), SIMDE_FLOAT64_C(  -831.27) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d src = simde_mm512_loadu_pd(test_vec[i].src);
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_mask_expand_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_expand_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[16];
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -558.68), SIMDE_FLOAT32_C(  -318.50), SIMDE_FLOAT32_C(  -688.27), SIMDE_FLOAT32_C(    19.53),
+        SIMDE_FLOAT32_C(  -241.25), SIMDE_FLOAT32_C(  -931.15), SIMDE_FLOAT32_C(  -874.35), SIMDE_FLOAT32_C(  -874.96),
+        SIMDE_FLOAT32_C(   572.64), SIMDE_FLOAT32_C(   950.17), SIMDE_FLOAT32_C(  -408.01), SIMDE_FLOAT32_C(  -305.14),
+        SIMDE_FLOAT32_C(   581.89), SIMDE_FLOAT32_C(  -621.47), SIMDE_FLOAT32_C(   585.13), SIMDE_FLOAT32_C(  -466.28) },
+      UINT16_C(    0),
+      { SIMDE_FLOAT32_C(   651.08), SIMDE_FLOAT32_C(   541.84), SIMDE_FLOAT32_C(   761.78), SIMDE_FLOAT32_C(   -71.11),
+        SIMDE_FLOAT32_C(  -955.23), SIMDE_FLOAT32_C(  -330.81), SIMDE_FLOAT32_C(   926.76), SIMDE_FLOAT32_C(  -280.97),
+        SIMDE_FLOAT32_C(  -430.40), SIMDE_FLOAT32_C(   671.03), SIMDE_FLOAT32_C(   330.25), SIMDE_FLOAT32_C(  -983.24),
+        SIMDE_FLOAT32_C(    82.61), SIMDE_FLOAT32_C(  -943.74), SIMDE_FLOAT32_C(    89.12), SIMDE_FLOAT32_C(  -953.23) },
+      { SIMDE_FLOAT32_C(  -558.68), SIMDE_FLOAT32_C(  -318.50), SIMDE_FLOAT32_C(  -688.27), SIMDE_FLOAT32_C(    19.53),
+        SIMDE_FLOAT32_C(  -241.25), SIMDE_FLOAT32_C(  -931.15), SIMDE_FLOAT32_C(  -874.35), SIMDE_FLOAT32_C(  -874.96),
+        SIMDE_FLOAT32_C(   572.64), SIMDE_FLOAT32_C(   950.17), SIMDE_FLOAT32_C(  -408.01), SIMDE_FLOAT32_C(  -305.14),
+        SIMDE_FLOAT32_C(   581.89), SIMDE_FLOAT32_C(  -621.47), SIMDE_FLOAT32_C(   585.13), SIMDE_FLOAT32_C(  -466.28) } },
+    { { SIMDE_FLOAT32_C(    -9.55), SIMDE_FLOAT32_C(  -806.97), SIMDE_FLOAT32_C(  -913.55), SIMDE_FLOAT32_C(   160.59),
+        SIMDE_FLOAT32_C(  -491.07), SIMDE_FLOAT32_C(   320.70), SIMDE_FLOAT32_C(  -971.93), SIMDE_FLOAT32_C(   959.29),
+        SIMDE_FLOAT32_C(   311.05), SIMDE_FLOAT32_C(  -569.70), SIMDE_FLOAT32_C(  -436.09), SIMDE_FLOAT32_C(    16.32),
+        SIMDE_FLOAT32_C(  -141.66), SIMDE_FLOAT32_C(  -623.64), SIMDE_FLOAT32_C(  -261.85), SIMDE_FLOAT32_C(  -811.92) },
+      UINT16_C(65535),
+      { SIMDE_FLOAT32_C(   -93.05), SIMDE_FLOAT32_C(   681.53), SIMDE_FLOAT32_C(  -995.01), SIMDE_FLOAT32_C(  -785.29),
+        SIMDE_FLOAT32_C(   440.65), SIMDE_FLOAT32_C(  -947.15), SIMDE_FLOAT32_C(   839.08), SIMDE_FLOAT32_C(   425.29),
+        SIMDE_FLOAT32_C(  -984.74), SIMDE_FLOAT32_C(   -52.25), SIMDE_FLOAT32_C(  -431.88), SIMDE_FLOAT32_C(  -508.46),
+        SIMDE_FLOAT32_C(   944.80), SIMDE_FLOAT32_C(   697.29), SIMDE_FLOAT32_C(  -483.62), SIMDE_FLOAT32_C(   807.66) },
+      { SIMDE_FLOAT32_C(   -93.05), SIMDE_FLOAT32_C(   681.53), SIMDE_FLOAT32_C(  -995.01), SIMDE_FLOAT32_C(  -785.29),
+        SIMDE_FLOAT32_C(   440.65), SIMDE_FLOAT32_C(  -947.15), SIMDE_FLOAT32_C(   839.08), SIMDE_FLOAT32_C(   425.29),
+        SIMDE_FLOAT32_C(  -984.74), SIMDE_FLOAT32_C(   -52.25), SIMDE_FLOAT32_C(  -431.88), SIMDE_FLOAT32_C(  -508.46),
+        SIMDE_FLOAT32_C(   944.80), SIMDE_FLOAT32_C(   697.29), SIMDE_FLOAT32_C(  -483.62), SIMDE_FLOAT32_C(   807.66) } },
+    { { SIMDE_FLOAT32_C(   374.61), SIMDE_FLOAT32_C(  -946.37), SIMDE_FLOAT32_C(   -85.70), SIMDE_FLOAT32_C(   165.19),
+        SIMDE_FLOAT32_C(  -677.30), SIMDE_FLOAT32_C(   327.74), SIMDE_FLOAT32_C(   740.09), SIMDE_FLOAT32_C(  -119.64),
+        SIMDE_FLOAT32_C(   304.43), SIMDE_FLOAT32_C(   906.48), SIMDE_FLOAT32_C(  -572.17), SIMDE_FLOAT32_C(   242.19),
+        SIMDE_FLOAT32_C(  -572.45), SIMDE_FLOAT32_C(   867.26), SIMDE_FLOAT32_C(   355.69), SIMDE_FLOAT32_C(  -575.88) },
+      UINT16_C(61160),
+      { SIMDE_FLOAT32_C(  -402.23), SIMDE_FLOAT32_C(   646.12), SIMDE_FLOAT32_C(  -624.59), SIMDE_FLOAT32_C(   854.50),
+        SIMDE_FLOAT32_C(   559.72), SIMDE_FLOAT32_C(  -821.51), SIMDE_FLOAT32_C(  -441.00), SIMDE_FLOAT32_C(  -973.85),
+        SIMDE_FLOAT32_C(   973.89), SIMDE_FLOAT32_C(  -153.36), SIMDE_FLOAT32_C(  -449.90), SIMDE_FLOAT32_C(  -382.82),
+        SIMDE_FLOAT32_C(  -962.50), SIMDE_FLOAT32_C(  -353.11), SIMDE_FLOAT32_C(   727.67), SIMDE_FLOAT32_C(   863.93) },
+      { SIMDE_FLOAT32_C(   374.61), SIMDE_FLOAT32_C(  -946.37), SIMDE_FLOAT32_C(   -85.70), SIMDE_FLOAT32_C(  -402.23),
+        SIMDE_FLOAT32_C(  -677.30), SIMDE_FLOAT32_C(   646.12), SIMDE_FLOAT32_C(  -624.59), SIMDE_FLOAT32_C(   854.50),
+        SIMDE_FLOAT32_C(   304.43), SIMDE_FLOAT32_C(   559.72), SIMDE_FLOAT32_C(  -821.51), SIMDE_FLOAT32_C(  -441.00),
+        SIMDE_FLOAT32_C(  -572.45), SIMDE_FLOAT32_C(  -973.85), SIMDE_FLOAT32_C(   973.89), SIMDE_FLOAT32_C(  -153.36) } },
+    { { SIMDE_FLOAT32_C(    23.56), SIMDE_FLOAT32_C(   385.17), SIMDE_FLOAT32_C(  -818.28), SIMDE_FLOAT32_C(  -840.73),
+        SIMDE_FLOAT32_C(  -522.53), SIMDE_FLOAT32_C(  -647.70), SIMDE_FLOAT32_C(   -71.57), SIMDE_FLOAT32_C(   409.38),
+        SIMDE_FLOAT32_C(  -178.48), SIMDE_FLOAT32_C(   523.18), SIMDE_FLOAT32_C(   522.16), SIMDE_FLOAT32_C(   911.46),
+        SIMDE_FLOAT32_C(  -171.54), SIMDE_FLOAT32_C(   166.42), SIMDE_FLOAT32_C(  -902.95), SIMDE_FLOAT32_C(   425.90) },
+      UINT16_C(19976),
+      { SIMDE_FLOAT32_C(  -753.89), SIMDE_FLOAT32_C(  -396.66), SIMDE_FLOAT32_C(  -137.25), SIMDE_FLOAT32_C(  -691.68),
+        SIMDE_FLOAT32_C(   577.09), SIMDE_FLOAT32_C(   240.69), SIMDE_FLOAT32_C(  -207.97), SIMDE_FLOAT32_C(   400.20),
+        SIMDE_FLOAT32_C(   749.12), SIMDE_FLOAT32_C(  -607.35), SIMDE_FLOAT32_C(  -620.79), SIMDE_FLOAT32_C(  -377.11),
+        SIMDE_FLOAT32_C(   890.93), SIMDE_FLOAT32_C(   620.26), SIMDE_FLOAT32_C(  -289.41), SIMDE_FLOAT32_C(  -892.87) },
+      { SIMDE_FLOAT32_C(    23.56), SIMDE_FLOAT32_C(   385.17), SIMDE_FLOAT32_C(  -818.28), SIMDE_FLOAT32_C(  -753.89),
+        SIMDE_FLOAT32_C(  -522.53), SIMDE_FLOAT32_C(  -647.70), SIMDE_FLOAT32_C(   -71.57), SIMDE_FLOAT32_C(   409.38),
+        SIMDE_FLOAT32_C(  -178.48), SIMDE_FLOAT32_C(  -396.66), SIMDE_FLOAT32_C(  -137.25), SIMDE_FLOAT32_C(  -691.68),
+        SIMDE_FLOAT32_C(  -171.54), SIMDE_FLOAT32_C(   166.42), SIMDE_FLOAT32_C(   577.09), SIMDE_FLOAT32_C(   425.90) } },
+    { { SIMDE_FLOAT32_C(   -31.35), SIMDE_FLOAT32_C(   424.79), SIMDE_FLOAT32_C(  -908.03), SIMDE_FLOAT32_C(  -242.01),
+        SIMDE_FLOAT32_C(   962.88), SIMDE_FLOAT32_C(   315.92), SIMDE_FLOAT32_C(  -808.75), SIMDE_FLOAT32_C(   486.07),
+        SIMDE_FLOAT32_C(   954.24), SIMDE_FLOAT32_C(   974.28), SIMDE_FLOAT32_C(   455.95), SIMDE_FLOAT32_C(   173.07),
+        SIMDE_FLOAT32_C(   147.39), SIMDE_FLOAT32_C(   238.32), SIMDE_FLOAT32_C(   371.25), SIMDE_FLOAT32_C(  -745.43) },
+      UINT16_C(23252),
+      { SIMDE_FLOAT32_C(  -435.67), SIMDE_FLOAT32_C(   849.70), SIMDE_FLOAT32_C(   527.94), SIMDE_FLOAT32_C(  -797.48),
+        SIMDE_FLOAT32_C(  -838.62), SIMDE_FLOAT32_C(    29.68), SIMDE_FLOAT32_C(   -56.06), SIMDE_FLOAT32_C(  -393.21),
+        SIMDE_FLOAT32_C(   817.34), SIMDE_FLOAT32_C(  -559.15), SIMDE_FLOAT32_C(  -291.94), SIMDE_FLOAT32_C(   619.60),
+        SIMDE_FLOAT32_C(  -464.22), SIMDE_FLOAT32_C(  -849.26), SIMDE_FLOAT32_C(  -759.77), SIMDE_FLOAT32_C(  -731.75) },
+      { SIMDE_FLOAT32_C(   -31.35), SIMDE_FLOAT32_C(   424.79), SIMDE_FLOAT32_C(  -435.67), SIMDE_FLOAT32_C(  -242.01),
+        SIMDE_FLOAT32_C(   849.70), SIMDE_FLOAT32_C(   315.92), SIMDE_FLOAT32_C(   527.94), SIMDE_FLOAT32_C(  -797.48),
+        SIMDE_FLOAT32_C(   954.24), SIMDE_FLOAT32_C(  -838.62), SIMDE_FLOAT32_C(   455.95), SIMDE_FLOAT32_C(    29.68),
+        SIMDE_FLOAT32_C(   -56.06), SIMDE_FLOAT32_C(   238.32), SIMDE_FLOAT32_C(  -393.21), SIMDE_FLOAT32_C(  -745.43) } },
+    { { SIMDE_FLOAT32_C(  -439.02), SIMDE_FLOAT32_C(    74.27), SIMDE_FLOAT32_C(  -556.74), SIMDE_FLOAT32_C(   997.86),
+        SIMDE_FLOAT32_C(   187.73), SIMDE_FLOAT32_C(  -989.95), SIMDE_FLOAT32_C(  -368.77), SIMDE_FLOAT32_C(  -940.93),
+        SIMDE_FLOAT32_C(  -570.82), SIMDE_FLOAT32_C(   703.48), SIMDE_FLOAT32_C(  -365.59), SIMDE_FLOAT32_C(  -706.36),
+        SIMDE_FLOAT32_C(   -26.09), SIMDE_FLOAT32_C(  -393.53), SIMDE_FLOAT32_C(  -193.57), SIMDE_FLOAT32_C(   142.16) },
+      UINT16_C(45638),
+      { SIMDE_FLOAT32_C(  -663.71), SIMDE_FLOAT32_C(   642.86), SIMDE_FLOAT32_C(   996.64), SIMDE_FLOAT32_C(    98.64),
+        SIMDE_FLOAT32_C(  -338.23), SIMDE_FLOAT32_C(  -847.61), SIMDE_FLOAT32_C(   370.78), SIMDE_FLOAT32_C(   536.79),
+        SIMDE_FLOAT32_C(   698.60), SIMDE_FLOAT32_C(   741.55), SIMDE_FLOAT32_C(   609.42), SIMDE_FLOAT32_C(   149.82),
+        SIMDE_FLOAT32_C(  -760.24), SIMDE_FLOAT32_C(  -526.10), SIMDE_FLOAT32_C(  -153.55), SIMDE_FLOAT32_C(   332.76) },
+      { SIMDE_FLOAT32_C(  -439.02), SIMDE_FLOAT32_C(  -663.71), SIMDE_FLOAT32_C(   642.86), SIMDE_FLOAT32_C(   997.86),
+        SIMDE_FLOAT32_C(   187.73), SIMDE_FLOAT32_C(  -989.95), SIMDE_FLOAT32_C(   996.64), SIMDE_FLOAT32_C(  -940.93),
+        SIMDE_FLOAT32_C(  -570.82), SIMDE_FLOAT32_C(    98.64), SIMDE_FLOAT32_C(  -365.59), SIMDE_FLOAT32_C(  -706.36),
+        SIMDE_FLOAT32_C(  -338.23), SIMDE_FLOAT32_C(  -847.61), SIMDE_FLOAT32_C(  -193.57), SIMDE_FLOAT32_C(   370.78) } },
+    { { SIMDE_FLOAT32_C(   361.45), SIMDE_FLOAT32_C(   816.48), SIMDE_FLOAT32_C(   479.99), SIMDE_FLOAT32_C(     2.63),
+        SIMDE_FLOAT32_C(  -633.62), SIMDE_FLOAT32_C(  -919.95), SIMDE_FLOAT32_C(   461.93), SIMDE_FLOAT32_C(   102.35),
+        SIMDE_FLOAT32_C(    23.35), SIMDE_FLOAT32_C(  -772.88), SIMDE_FLOAT32_C(   722.95), SIMDE_FLOAT32_C(   743.44),
+        SIMDE_FLOAT32_C(  -646.64), SIMDE_FLOAT32_C(   192.72), SIMDE_FLOAT32_C(  -680.01), SIMDE_FLOAT32_C(   396.77) },
+      UINT16_C(49554),
+      { SIMDE_FLOAT32_C(  -522.86), SIMDE_FLOAT32_C(  -839.67), SIMDE_FLOAT32_C(  -173.12), SIMDE_FLOAT32_C(  -210.95),
+        SIMDE_FLOAT32_C(   145.77), SIMDE_FLOAT32_C(   871.35), SIMDE_FLOAT32_C(   650.23), SIMDE_FLOAT32_C(   537.95),
+        SIMDE_FLOAT32_C(    20.77), SIMDE_FLOAT32_C(   384.73), SIMDE_FLOAT32_C(  -503.10), SIMDE_FLOAT32_C(  -276.22),
+        SIMDE_FLOAT32_C(   -50.91), SIMDE_FLOAT32_C(   430.43), SIMDE_FLOAT32_C(   429.35), SIMDE_FLOAT32_C(   191.65) },
+      { SIMDE_FLOAT32_C(   361.45), SIMDE_FLOAT32_C(  -522.86), SIMDE_FLOAT32_C(   479.99), SIMDE_FLOAT32_C(     2.63),
+        SIMDE_FLOAT32_C(  -839.67), SIMDE_FLOAT32_C(  -919.95), SIMDE_FLOAT32_C(   461.93), SIMDE_FLOAT32_C(  -173.12),
+        SIMDE_FLOAT32_C(  -210.95), SIMDE_FLOAT32_C(  -772.88), SIMDE_FLOAT32_C(   722.95), SIMDE_FLOAT32_C(   743.44),
+        SIMDE_FLOAT32_C(  -646.64), SIMDE_FLOAT32_C(   192.72), SIMDE_FLOAT32_C(   145.77), SIMDE_FLOAT32_C(   871.35) } },
+    { { SIMDE_FLOAT32_C(  -674.86), SIMDE_FLOAT32_C(   894.87), SIMDE_FLOAT32_C(  -117.64), SIMDE_FLOAT32_C(  -884.51),
+        SIMDE_FLOAT32_C(   719.33), SIMDE_FLOAT32_C(  -214.76), SIMDE_FLOAT32_C(   656.44), SIMDE_FLOAT32_C(  -745.42),
+        SIMDE_FLOAT32_C(  -656.85), SIMDE_FLOAT32_C(   161.83), SIMDE_FLOAT32_C(   603.49), SIMDE_FLOAT32_C(   653.87),
+        SIMDE_FLOAT32_C(   531.93), SIMDE_FLOAT32_C(   558.62), SIMDE_FLOAT32_C(  -471.39), SIMDE_FLOAT32_C(   180.17) },
+      UINT16_C(56632),
+      { SIMDE_FLOAT32_C(   277.31), SIMDE_FLOAT32_C(   842.61), SIMDE_FLOAT32_C(   263.75), SIMDE_FLOAT32_C(   433.55),
+        SIMDE_FLOAT32_C(  -609.40), SIMDE_FLOAT32_C(  -996.32), SIMDE_FLOAT32_C(   469.68), SIMDE_FLOAT32_C(  -650.97),
+        SIMDE_FLOAT32_C(   508.20), SIMDE_FLOAT32_C(   822.97), SIMDE_FLOAT32_C(  -756.80), SIMDE_FLOAT32_C(  -321.72),
+        SIMDE_FLOAT32_C(  -861.74), SIMDE_FLOAT32_C(   871.43), SIMDE_FLOAT32_C(  -648.53), SIMDE_FLOAT32_C(  -716.84) },
+      { SIMDE_FLOAT32_C(  -674.86), SIMDE_FLOAT32_C(   894.87), SIMDE_FLOAT32_C(  -117.64), SIMDE_FLOAT32_C(   277.31),
+        SIMDE_FLOAT32_C(   842.61), SIMDE_FLOAT32_C(   263.75), SIMDE_FLOAT32_C(   656.44), SIMDE_FLOAT32_C(  -745.42),
+        SIMDE_FLOAT32_C(   433.55), SIMDE_FLOAT32_C(   161.83), SIMDE_FLOAT32_C(  -609.40), SIMDE_FLOAT32_C(  -996.32),
+        SIMDE_FLOAT32_C(   469.68), SIMDE_FLOAT32_C(   558.62), SIMDE_FLOAT32_C(  -650.97), SIMDE_FLOAT32_C(   508.20) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 src = simde_mm512_loadu_ps(test_vec[i].src);
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_mask_expand_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_expand_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { UINT16_C(    0),
+      {  INT32_C(  1814037062),  INT32_C(   559676492),  INT32_C(   337687825), -INT32_C(   265420690), -INT32_C(    33510053),  INT32_C(   853662451),  INT32_C(   175044070), -INT32_C(  2110115276),
+         INT32_C(  1432610547), -INT32_C(  1211348783), -INT32_C(   123794026),  INT32_C(  1502407477), -INT32_C(  1297880427),  INT32_C(   680870235), -INT32_C(  1682028466), -INT32_C(   385937004) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(65535),
+      { -INT32_C(  1223846886), -INT32_C(  1828884018), -INT32_C(  1502422739), -INT32_C(   919473495),  INT32_C(   240575444),  INT32_C(   532831754), -INT32_C(  1866520815), -INT32_C(  1991702253),
+        -INT32_C(  1066922900), -INT32_C(  1750795471), -INT32_C(  1551939156),  INT32_C(  1823811468),  INT32_C(  2080244224),  INT32_C(   299006129), -INT32_C(   335500989),  INT32_C(   818387173) },
+      { -INT32_C(  1223846886), -INT32_C(  1828884018), -INT32_C(  1502422739), -INT32_C(   919473495),  INT32_C(   240575444),  INT32_C(   532831754), -INT32_C(  1866520815), -INT32_C(  1991702253),
+        -INT32_C(  1066922900), -INT32_C(  1750795471), -INT32_C(  1551939156),  INT32_C(  1823811468),  INT32_C(  2080244224),  INT32_C(   299006129), -INT32_C(   335500989),  INT32_C(   818387173) } },
+    { UINT16_C( 2232),
+      { -INT32_C(  1792160077), -INT32_C(  1180510788),  INT32_C(  2047480852), -INT32_C(  1602466192), -INT32_C(  1114860797), -INT32_C(   361835020),  INT32_C(  1574582503), -INT32_C(  1180161815),
+         INT32_C(     6585376),  INT32_C(   829017642),  INT32_C(   897036543),  INT32_C(   189223243), -INT32_C(  1339774719), -INT32_C(   353507165), -INT32_C(   229362985),  INT32_C(   242920785) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1792160077), -INT32_C(  1180510788),  INT32_C(  2047480852),  INT32_C(           0), -INT32_C(  1602466192),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1114860797),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(53994),
+      { -INT32_C(   846440769), -INT32_C(    42220994),  INT32_C(  1244830144), -INT32_C(  1684919702),  INT32_C(   242796470),  INT32_C(  1144282692), -INT32_C(   997081036),  INT32_C(   697317091),
+        -INT32_C(   516615917), -INT32_C(   600562636),  INT32_C(   982485215), -INT32_C(  2124301304),  INT32_C(   612448226),  INT32_C(  1179540584), -INT32_C(   186558062),  INT32_C(     3065661) },
+      {  INT32_C(           0), -INT32_C(   846440769),  INT32_C(           0), -INT32_C(    42220994),  INT32_C(           0),  INT32_C(  1244830144), -INT32_C(  1684919702),  INT32_C(   242796470),
+         INT32_C(           0),  INT32_C(  1144282692),  INT32_C(           0),  INT32_C(           0), -INT32_C(   997081036),  INT32_C(           0),  INT32_C(   697317091), -INT32_C(   516615917) } },
+    { UINT16_C(47054),
+      {  INT32_C(  1931152772),  INT32_C(  1860785937),  INT32_C(  1521591860), -INT32_C(   210021462), -INT32_C(   729479724),  INT32_C(  1921758851),  INT32_C(  2110661696), -INT32_C(   860915359),
+        -INT32_C(    93145251), -INT32_C(  2119822157), -INT32_C(    82107460),  INT32_C(  1119163268),  INT32_C(  1304823346),  INT32_C(   644639897), -INT32_C(   313676166),  INT32_C(  2030008804) },
+      {  INT32_C(           0),  INT32_C(  1931152772),  INT32_C(  1860785937),  INT32_C(  1521591860),  INT32_C(           0),  INT32_C(           0), -INT32_C(   210021462), -INT32_C(   729479724),
+         INT32_C(  1921758851),  INT32_C(  2110661696), -INT32_C(   860915359),  INT32_C(           0), -INT32_C(    93145251), -INT32_C(  2119822157),  INT32_C(           0), -INT32_C(    82107460) } },
+    { UINT16_C( 2136),
+      {  INT32_C(   334778938),  INT32_C(   944932105),  INT32_C(   982640162),  INT32_C(   884948944),  INT32_C(  1411550116),  INT32_C(   418987914),  INT32_C(  1720182874), -INT32_C(  1952165780),
+        -INT32_C(  2023110020),  INT32_C(   534652466), -INT32_C(   313936215), -INT32_C(  1317454954),  INT32_C(    97446294),  INT32_C(   833232605), -INT32_C(  1685192009), -INT32_C(   492239924) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   334778938),  INT32_C(   944932105),  INT32_C(           0),  INT32_C(   982640162),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   884948944),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(23909),
+      {  INT32_C(    15964786),  INT32_C(   532832806),  INT32_C(  2090302227), -INT32_C(  1391461874),  INT32_C(  2050247718),  INT32_C(  1355150352), -INT32_C(  1976418760),  INT32_C(  1489438543),
+         INT32_C(  2067769916),  INT32_C(    87409829), -INT32_C(    42246333),  INT32_C(  2130126766),  INT32_C(  1518415756), -INT32_C(  1879525906),  INT32_C(  1944488404),  INT32_C(  1596657441) },
+      {  INT32_C(    15964786),  INT32_C(           0),  INT32_C(   532832806),  INT32_C(           0),  INT32_C(           0),  INT32_C(  2090302227), -INT32_C(  1391461874),  INT32_C(           0),
+         INT32_C(  2050247718),  INT32_C(           0),  INT32_C(  1355150352), -INT32_C(  1976418760),  INT32_C(  1489438543),  INT32_C(           0),  INT32_C(  2067769916),  INT32_C(           0) } },
+    { UINT16_C(65001),
+      { -INT32_C(  1448458636), -INT32_C(   284714894), -INT32_C(    15220668),  INT32_C(   502400110),  INT32_C(   620837193), -INT32_C(  1908885647),  INT32_C(  1700493137), -INT32_C(    26712431),
+         INT32_C(  1782582983), -INT32_C(  1734246996),  INT32_C(   705562309),  INT32_C(  1257710010), -INT32_C(  1501916698),  INT32_C(  1915258707),  INT32_C(  1876167686),  INT32_C(  1680797495) },
+      { -INT32_C(  1448458636),  INT32_C(           0),  INT32_C(           0), -INT32_C(   284714894),  INT32_C(           0), -INT32_C(    15220668),  INT32_C(   502400110),  INT32_C(   620837193),
+        -INT32_C(  1908885647),  INT32_C(           0),  INT32_C(  1700493137), -INT32_C(    26712431),  INT32_C(  1782582983), -INT32_C(  1734246996),  INT32_C(   705562309),  INT32_C(  1257710010) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_expand_epi32(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_expand_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { -INT64_C( 5613592147977909278), -INT64_C( 8521935547747215031),  INT64_C(  702781376520281716),  INT64_C( 5271832338466136385),
+         INT64_C( 5992909768546915699), -INT64_C( 8105730211738110635),  INT64_C( 5419269723383797256),  INT64_C( 1443976282220444943) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(255),
+      { -INT64_C( 4198771262928397983),  INT64_C( 2303190437089720782),  INT64_C( 2233067517025467053),  INT64_C( 5542689523212064272),
+         INT64_C( 8537787792269285278), -INT64_C( 7402800407160100874),  INT64_C( 3282662669896613354), -INT64_C( 2245081476497245973) },
+      { -INT64_C( 4198771262928397983),  INT64_C( 2303190437089720782),  INT64_C( 2233067517025467053),  INT64_C( 5542689523212064272),
+         INT64_C( 8537787792269285278), -INT64_C( 7402800407160100874),  INT64_C( 3282662669896613354), -INT64_C( 2245081476497245973) } },
+    { UINT8_C(157),
+      { -INT64_C( 2108481100178739804),  INT64_C( 5667049756946149221), -INT64_C( 5876535000594274218),  INT64_C( 6359347758759591769),
+         INT64_C( 1484287324158945352), -INT64_C( 2230105267661342290), -INT64_C( 2320263065155247612), -INT64_C( 3503278510811475502) },
+      { -INT64_C( 2108481100178739804),  INT64_C(                   0),  INT64_C( 5667049756946149221), -INT64_C( 5876535000594274218),
+         INT64_C( 6359347758759591769),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 1484287324158945352) } },
+    { UINT8_C( 40),
+      { -INT64_C( 2225961064023603467), -INT64_C( 6737690926375136696), -INT64_C(  327331685946279139),  INT64_C( 5554587792426394162),
+        -INT64_C( 7093510688094227693),  INT64_C( 4063458922888717872),  INT64_C( 3179190711406269032),  INT64_C( 9061381189348632640) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0), -INT64_C( 2225961064023603467),
+         INT64_C(                   0), -INT64_C( 6737690926375136696),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 95),
+      { -INT64_C( 3949710915916963485), -INT64_C( 4639110595882793952), -INT64_C( 3305446728836909184),  INT64_C( 5663160442612746995),
+        -INT64_C( 1679336841833155640),  INT64_C( 3940568910091211055),  INT64_C(  795195193692377204),  INT64_C( 4984143180664360257) },
+      { -INT64_C( 3949710915916963485), -INT64_C( 4639110595882793952), -INT64_C( 3305446728836909184),  INT64_C( 5663160442612746995),
+        -INT64_C( 1679336841833155640),  INT64_C(                   0),  INT64_C( 3940568910091211055),  INT64_C(                   0) } },
+    { UINT8_C(249),
+      { -INT64_C( 2309573283529107821), -INT64_C( 3475426828688061826),  INT64_C( 9040183998573436492),  INT64_C(  821174245950064891),
+         INT64_C( 6437699076407726337),  INT64_C( 2260630391925995269), -INT64_C( 5675757167402022199), -INT64_C( 8756489629275490708) },
+      { -INT64_C( 2309573283529107821),  INT64_C(                   0),  INT64_C(                   0), -INT64_C( 3475426828688061826),
+         INT64_C( 9040183998573436492),  INT64_C(  821174245950064891),  INT64_C( 6437699076407726337),  INT64_C( 2260630391925995269) } },
+    { UINT8_C(141),
+      { -INT64_C( 2328810737578540456),  INT64_C( 1423939656847226946),  INT64_C( 8904782361092274935),  INT64_C( 2707262135296090765),
+        -INT64_C(  855667858254917763),  INT64_C(  356316596498505079), -INT64_C(  595415019970386324), -INT64_C(  195362549846244244) },
+      { -INT64_C( 2328810737578540456),  INT64_C(                   0),  INT64_C( 1423939656847226946),  INT64_C( 8904782361092274935),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 2707262135296090765) } },
+    { UINT8_C(232),
+      {  INT64_C( 2974442563161431136), -INT64_C( 3417258871034452323),  INT64_C( 6787563347958478127), -INT64_C( 7441908497923248222),
+        -INT64_C( 8825926695333187261),  INT64_C( 8778788289676262836),  INT64_C(   92218906732379877), -INT64_C( 5549244041431110467) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 2974442563161431136),
+         INT64_C(                   0), -INT64_C( 3417258871034452323),  INT64_C( 6787563347958478127), -INT64_C( 7441908497923248222) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_expand_epi64(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_expand_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { SIMDE_FLOAT64_C(  -760.56), SIMDE_FLOAT64_C(   504.16), SIMDE_FLOAT64_C(  -235.25), SIMDE_FLOAT64_C(  -829.99),
+        SIMDE_FLOAT64_C(   184.65), SIMDE_FLOAT64_C(   147.98), SIMDE_FLOAT64_C(   393.26), SIMDE_FLOAT64_C(  -145.77) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(255),
+      { SIMDE_FLOAT64_C(  -129.60), SIMDE_FLOAT64_C(   617.24), SIMDE_FLOAT64_C(   924.78), SIMDE_FLOAT64_C(  -389.47),
+        SIMDE_FLOAT64_C(   466.52), SIMDE_FLOAT64_C(   137.94), SIMDE_FLOAT64_C(   464.32), SIMDE_FLOAT64_C(  -488.45) },
+      { SIMDE_FLOAT64_C(  -129.60), SIMDE_FLOAT64_C(   617.24), SIMDE_FLOAT64_C(   924.78), SIMDE_FLOAT64_C(  -389.47),
+        SIMDE_FLOAT64_C(   466.52), SIMDE_FLOAT64_C(   137.94), SIMDE_FLOAT64_C(   464.32), SIMDE_FLOAT64_C(  -488.45) } },
+    { UINT8_C(  1),
+      { SIMDE_FLOAT64_C(  -484.42), SIMDE_FLOAT64_C(   525.96), SIMDE_FLOAT64_C(   -54.89), SIMDE_FLOAT64_C(   555.24),
+        SIMDE_FLOAT64_C(  -391.19), SIMDE_FLOAT64_C(   292.46), SIMDE_FLOAT64_C(  -735.42), SIMDE_FLOAT64_C(  -928.70) },
+      { SIMDE_FLOAT64_C(  -484.42), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(127),
+      { SIMDE_FLOAT64_C(   -82.07), SIMDE_FLOAT64_C(  -377.57), SIMDE_FLOAT64_C(   122.96), SIMDE_FLOAT64_C(  -489.93),
+        SIMDE_FLOAT64_C(   802.02), SIMDE_FLOAT64_C(   519.39), SIMDE_FLOAT64_C(   418.54), SIMDE_FLOAT64_C(    86.53) },
+      { SIMDE_FLOAT64_C(   -82.07), SIMDE_FLOAT64_C(  -377.57), SIMDE_FLOAT64_C(   122.96), SIMDE_FLOAT64_C(  -489.93),
+        SIMDE_FLOAT64_C(   802.02), SIMDE_FLOAT64_C(   519.39), SIMDE_FLOAT64_C(   418.54), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(205),
+      { SIMDE_FLOAT64_C(   633.28), SIMDE_FLOAT64_C(  -471.08), SIMDE_FLOAT64_C(  -108.18), SIMDE_FLOAT64_C(   361.39),
+        SIMDE_FLOAT64_C(  -891.78), SIMDE_FLOAT64_C(  -187.37), SIMDE_FLOAT64_C(  -680.54), SIMDE_FLOAT64_C(   712.28) },
+      { SIMDE_FLOAT64_C(   633.28), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -471.08), SIMDE_FLOAT64_C(  -108.18),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   361.39), SIMDE_FLOAT64_C(  -891.78) } },
+    { UINT8_C(185),
+      { SIMDE_FLOAT64_C(  -235.05), SIMDE_FLOAT64_C(  -904.02), SIMDE_FLOAT64_C(   -55.66), SIMDE_FLOAT64_C(  -886.55),
+        SIMDE_FLOAT64_C(  -584.51), SIMDE_FLOAT64_C(   -69.39), SIMDE_FLOAT64_C(  -191.63), SIMDE_FLOAT64_C(   599.30) },
+      { SIMDE_FLOAT64_C(  -235.05), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -904.02),
+        SIMDE_FLOAT64_C(   -55.66), SIMDE_FLOAT64_C(  -886.55), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -584.51) } },
+    { UINT8_C( 36),
+      { SIMDE_FLOAT64_C(  -343.56), SIMDE_FLOAT64_C(   712.60), SIMDE_FLOAT64_C(   612.65), SIMDE_FLOAT64_C(   746.25),
+        SIMDE_FLOAT64_C(   329.86), SIMDE_FLOAT64_C(  -816.48), SIMDE_FLOAT64_C(  -466.32), SIMDE_FLOAT64_C(  -272.26) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(  -343.56), SIMDE_FLOAT64_C(     0.00),
+        SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   712.60), SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(     0.00) } },
+    { UINT8_C(126),
+      { SIMDE_FLOAT64_C(   137.97), SIMDE_FLOAT64_C(  -476.57), SIMDE_FLOAT64_C(   570.95), SIMDE_FLOAT64_C(  -873.91),
+        SIMDE_FLOAT64_C(   149.99), SIMDE_FLOAT64_C(  -825.35), SIMDE_FLOAT64_C(  -921.88), SIMDE_FLOAT64_C(   219.36) },
+      { SIMDE_FLOAT64_C(     0.00), SIMDE_FLOAT64_C(   137.97), SIMDE_FLOAT64_C(  -476.57), SIMDE_FLOAT64_C(   570.95),
+        SIMDE_FLOAT64_C(  -873.91), SIMDE_FLOAT64_C(   149.99), SIMDE_FLOAT64_C(  -825.35), SIMDE_FLOAT64_C(     0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_maskz_expand_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_expand_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { UINT16_C(    0),
+      { SIMDE_FLOAT32_C(   298.68), SIMDE_FLOAT32_C(  -129.25), SIMDE_FLOAT32_C(  -654.08), SIMDE_FLOAT32_C(  -288.00),
+        SIMDE_FLOAT32_C(   419.77), SIMDE_FLOAT32_C(   372.45), SIMDE_FLOAT32_C(  -258.96), SIMDE_FLOAT32_C(   523.31),
+        SIMDE_FLOAT32_C(   681.46), SIMDE_FLOAT32_C(  -813.40), SIMDE_FLOAT32_C(  -334.80), SIMDE_FLOAT32_C(   329.67),
+        SIMDE_FLOAT32_C(  -316.46), SIMDE_FLOAT32_C(  -517.18), SIMDE_FLOAT32_C(   919.40), SIMDE_FLOAT32_C(   790.15) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(65535),
+      { SIMDE_FLOAT32_C(   975.97), SIMDE_FLOAT32_C(   529.26), SIMDE_FLOAT32_C(   -24.22), SIMDE_FLOAT32_C(  -550.08),
+        SIMDE_FLOAT32_C(    82.93), SIMDE_FLOAT32_C(   -48.00), SIMDE_FLOAT32_C(   791.74), SIMDE_FLOAT32_C(   730.89),
+        SIMDE_FLOAT32_C(   810.24), SIMDE_FLOAT32_C(   136.19), SIMDE_FLOAT32_C(  -644.81), SIMDE_FLOAT32_C(   417.51),
+        SIMDE_FLOAT32_C(  -136.00), SIMDE_FLOAT32_C(   935.45), SIMDE_FLOAT32_C(   590.59), SIMDE_FLOAT32_C(    25.38) },
+      { SIMDE_FLOAT32_C(   975.97), SIMDE_FLOAT32_C(   529.26), SIMDE_FLOAT32_C(   -24.22), SIMDE_FLOAT32_C(  -550.08),
+        SIMDE_FLOAT32_C(    82.93), SIMDE_FLOAT32_C(   -48.00), SIMDE_FLOAT32_C(   791.74), SIMDE_FLOAT32_C(   730.89),
+        SIMDE_FLOAT32_C(   810.24), SIMDE_FLOAT32_C(   136.19), SIMDE_FLOAT32_C(  -644.81), SIMDE_FLOAT32_C(   417.51),
+        SIMDE_FLOAT32_C(  -136.00), SIMDE_FLOAT32_C(   935.45), SIMDE_FLOAT32_C(   590.59), SIMDE_FLOAT32_C(    25.38) } },
+    { UINT16_C(38052),
+      { SIMDE_FLOAT32_C(   -91.50), SIMDE_FLOAT32_C(  -325.93), SIMDE_FLOAT32_C(   934.56), SIMDE_FLOAT32_C(  -214.81),
+        SIMDE_FLOAT32_C(   834.97), SIMDE_FLOAT32_C(   389.34), SIMDE_FLOAT32_C(  -505.95), SIMDE_FLOAT32_C(   589.72),
+        SIMDE_FLOAT32_C(   274.05), SIMDE_FLOAT32_C(  -713.79), SIMDE_FLOAT32_C(  -822.52), SIMDE_FLOAT32_C(  -509.12),
+        SIMDE_FLOAT32_C(  -354.59), SIMDE_FLOAT32_C(  -289.09), SIMDE_FLOAT32_C(  -751.52), SIMDE_FLOAT32_C(  -984.73) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   -91.50), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -325.93), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   934.56),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -214.81), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(   834.97), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   389.34) } },
+    { UINT16_C( 9863),
+      { SIMDE_FLOAT32_C(   175.31), SIMDE_FLOAT32_C(  -122.20), SIMDE_FLOAT32_C(   457.15), SIMDE_FLOAT32_C(   -71.83),
+        SIMDE_FLOAT32_C(  -351.99), SIMDE_FLOAT32_C(  -908.11), SIMDE_FLOAT32_C(   601.75), SIMDE_FLOAT32_C(    -4.19),
+        SIMDE_FLOAT32_C(  -107.98), SIMDE_FLOAT32_C(   352.74), SIMDE_FLOAT32_C(   279.00), SIMDE_FLOAT32_C(  -942.51),
+        SIMDE_FLOAT32_C(  -750.23), SIMDE_FLOAT32_C(   520.15), SIMDE_FLOAT32_C(   630.26), SIMDE_FLOAT32_C(   284.49) },
+      { SIMDE_FLOAT32_C(   175.31), SIMDE_FLOAT32_C(  -122.20), SIMDE_FLOAT32_C(   457.15), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   -71.83),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -351.99), SIMDE_FLOAT32_C(  -908.11), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   601.75), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(59049),
+      { SIMDE_FLOAT32_C(  -496.95), SIMDE_FLOAT32_C(  -415.02), SIMDE_FLOAT32_C(  -645.20), SIMDE_FLOAT32_C(   426.27),
+        SIMDE_FLOAT32_C(   349.81), SIMDE_FLOAT32_C(   809.50), SIMDE_FLOAT32_C(   930.35), SIMDE_FLOAT32_C(   368.60),
+        SIMDE_FLOAT32_C(  -341.59), SIMDE_FLOAT32_C(  -424.14), SIMDE_FLOAT32_C(   157.66), SIMDE_FLOAT32_C(   711.37),
+        SIMDE_FLOAT32_C(  -615.61), SIMDE_FLOAT32_C(   820.09), SIMDE_FLOAT32_C(  -441.91), SIMDE_FLOAT32_C(  -385.46) },
+      { SIMDE_FLOAT32_C(  -496.95), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -415.02),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -645.20), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   426.27),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   349.81), SIMDE_FLOAT32_C(   809.50), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   930.35), SIMDE_FLOAT32_C(   368.60), SIMDE_FLOAT32_C(  -341.59) } },
+    { UINT16_C(46753),
+      { SIMDE_FLOAT32_C(   -74.75), SIMDE_FLOAT32_C(    34.61), SIMDE_FLOAT32_C(   399.47), SIMDE_FLOAT32_C(  -839.12),
+        SIMDE_FLOAT32_C(  -275.79), SIMDE_FLOAT32_C(   108.91), SIMDE_FLOAT32_C(   459.11), SIMDE_FLOAT32_C(   402.97),
+        SIMDE_FLOAT32_C(  -946.64), SIMDE_FLOAT32_C(   428.83), SIMDE_FLOAT32_C(   -90.17), SIMDE_FLOAT32_C(   364.99),
+        SIMDE_FLOAT32_C(   669.64), SIMDE_FLOAT32_C(  -869.73), SIMDE_FLOAT32_C(  -511.85), SIMDE_FLOAT32_C(  -536.96) },
+      { SIMDE_FLOAT32_C(   -74.75), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    34.61), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   399.47),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -839.12), SIMDE_FLOAT32_C(  -275.79), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(   108.91), SIMDE_FLOAT32_C(   459.11), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   402.97) } },
+    { UINT16_C(20602),
+      { SIMDE_FLOAT32_C(   258.75), SIMDE_FLOAT32_C(  -989.75), SIMDE_FLOAT32_C(   141.03), SIMDE_FLOAT32_C(   867.25),
+        SIMDE_FLOAT32_C(   159.89), SIMDE_FLOAT32_C(  -189.65), SIMDE_FLOAT32_C(  -234.02), SIMDE_FLOAT32_C(   581.65),
+        SIMDE_FLOAT32_C(   816.25), SIMDE_FLOAT32_C(    39.27), SIMDE_FLOAT32_C(   665.92), SIMDE_FLOAT32_C(  -425.21),
+        SIMDE_FLOAT32_C(   142.99), SIMDE_FLOAT32_C(  -388.02), SIMDE_FLOAT32_C(   343.79), SIMDE_FLOAT32_C(  -210.53) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   258.75), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -989.75),
+        SIMDE_FLOAT32_C(   141.03), SIMDE_FLOAT32_C(   867.25), SIMDE_FLOAT32_C(   159.89), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(  -189.65), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -234.02), SIMDE_FLOAT32_C(     0.00) } },
+    { UINT16_C(26636),
+      { SIMDE_FLOAT32_C(  -156.18), SIMDE_FLOAT32_C(   590.04), SIMDE_FLOAT32_C(   930.16), SIMDE_FLOAT32_C(   886.33),
+        SIMDE_FLOAT32_C(  -429.93), SIMDE_FLOAT32_C(   266.38), SIMDE_FLOAT32_C(    53.28), SIMDE_FLOAT32_C(  -353.92),
+        SIMDE_FLOAT32_C(   -90.65), SIMDE_FLOAT32_C(   982.29), SIMDE_FLOAT32_C(  -880.65), SIMDE_FLOAT32_C(   764.75),
+        SIMDE_FLOAT32_C(  -332.97), SIMDE_FLOAT32_C(   177.85), SIMDE_FLOAT32_C(  -786.82), SIMDE_FLOAT32_C(   112.08) },
+      { SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(  -156.18), SIMDE_FLOAT32_C(   590.04),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   930.16),
+        SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(   886.33), SIMDE_FLOAT32_C(  -429.93), SIMDE_FLOAT32_C(     0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_maskz_expand_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_expand_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int8_t a[16];
+    const int8_t r[16];
+  } test_vec[] = {
+    { UINT16_C(    0),
+      { -INT8_C(  32), -INT8_C(  73),  INT8_C(  54), -INT8_C( 114), -INT8_C(  63), -INT8_C(  48),  INT8_C( 109),  INT8_C(  15),
+        -INT8_C(  39), -INT8_C(  44),  INT8_C( 121), -INT8_C( 107),  INT8_C(  38), -INT8_C(  52), -INT8_C(  65),  INT8_C(  10) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(65535),
+      { -INT8_C(  90),  INT8_C(  15),  INT8_C(   1), -INT8_C(  79), -INT8_C(  44), -INT8_C( 125),  INT8_C(  72),  INT8_C(  96),
+         INT8_C(  16),  INT8_C( 100), -INT8_C(  24), -INT8_C(  91),  INT8_C(  26),  INT8_C(  28), -INT8_C(  20),  INT8_C(  31) },
+      { -INT8_C(  90),  INT8_C(  15),  INT8_C(   1), -INT8_C(  79), -INT8_C(  44), -INT8_C( 125),  INT8_C(  72),  INT8_C(  96),
+         INT8_C(  16),  INT8_C( 100), -INT8_C(  24), -INT8_C(  91),  INT8_C(  26),  INT8_C(  28), -INT8_C(  20),  INT8_C(  31) } },
+    { UINT16_C(23649),
+      { -INT8_C( 103), -INT8_C(  16), -INT8_C( 117), -INT8_C(  24), -INT8_C(  69), -INT8_C( 120), -INT8_C(  47), -INT8_C(  38),
+        -INT8_C(  57), -INT8_C(  90), -INT8_C(  51),  INT8_C( 108), -INT8_C(   8), -INT8_C(  91),  INT8_C(  92),  INT8_C( 106) },
+      { -INT8_C( 103),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  16), -INT8_C( 117),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0), -INT8_C(  24), -INT8_C(  69), -INT8_C( 120),  INT8_C(   0), -INT8_C(  47),  INT8_C(   0) } },
+    { UINT16_C(62845),
+      { -INT8_C(  41),  INT8_C(  32), -INT8_C( 112), -INT8_C(  59), -INT8_C( 108),  INT8_C(   9), -INT8_C(  99), -INT8_C(  72),
+        -INT8_C(  35),  INT8_C(   8),  INT8_C( 118), -INT8_C(  26),  INT8_C(  87),  INT8_C( 123), -INT8_C(  11),  INT8_C(  36) },
+      { -INT8_C(  41),  INT8_C(   0),  INT8_C(  32), -INT8_C( 112), -INT8_C(  59), -INT8_C( 108),  INT8_C(   9),  INT8_C(   0),
+        -INT8_C(  99),  INT8_C(   0), -INT8_C(  72),  INT8_C(   0), -INT8_C(  35),  INT8_C(   8),  INT8_C( 118), -INT8_C(  26) } },
+    { UINT16_C(18335),
+      { -INT8_C(  48), -INT8_C(  87),  INT8_C(  78), -INT8_C(  26),  INT8_C(  27), -INT8_C(  27), -INT8_C(   8), -INT8_C(  31),
+        -INT8_C(  78), -INT8_C(  23),      INT8_MIN,  INT8_C(  83), -INT8_C(  73),  INT8_C(   2),  INT8_C( 124),  INT8_C( 110) },
+      { -INT8_C(  48), -INT8_C(  87),  INT8_C(  78), -INT8_C(  26),  INT8_C(  27),  INT8_C(   0),  INT8_C(   0), -INT8_C(  27),
+        -INT8_C(   8), -INT8_C(  31), -INT8_C(  78),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  23),  INT8_C(   0) } },
+    { UINT16_C(54607),
+      {  INT8_C(  37),  INT8_C(  59),  INT8_C(  27), -INT8_C(  89), -INT8_C( 118),  INT8_C(  25),  INT8_C(  49), -INT8_C(  97),
+        -INT8_C(  88),  INT8_C( 107), -INT8_C(  21),  INT8_C(  34), -INT8_C( 124),  INT8_C(  77),  INT8_C(  47),  INT8_C(  29) },
+      {  INT8_C(  37),  INT8_C(  59),  INT8_C(  27), -INT8_C(  89),  INT8_C(   0),  INT8_C(   0), -INT8_C( 118),  INT8_C(   0),
+         INT8_C(  25),  INT8_C(   0),  INT8_C(  49),  INT8_C(   0), -INT8_C(  97),  INT8_C(   0), -INT8_C(  88),  INT8_C( 107) } },
+    { UINT16_C(55981),
+      {  INT8_C(  88), -INT8_C(  44), -INT8_C(  99), -INT8_C(  64), -INT8_C(  13),  INT8_C(  34),  INT8_C(  22),  INT8_C(  16),
+        -INT8_C( 106), -INT8_C(  59),  INT8_C( 112),  INT8_C(  44), -INT8_C(  12), -INT8_C(  27),  INT8_C( 106), -INT8_C(  66) },
+      {  INT8_C(  88),  INT8_C(   0), -INT8_C(  44), -INT8_C(  99),  INT8_C(   0), -INT8_C(  64),  INT8_C(   0), -INT8_C(  13),
+         INT8_C(   0),  INT8_C(  34),  INT8_C(   0),  INT8_C(  22),  INT8_C(  16),  INT8_C(   0), -INT8_C( 106), -INT8_C(  59) } },
+    { UINT16_C(40596),
+      { -INT8_C(  87), -INT8_C(  92), -INT8_C(  93), -INT8_C(  60), -INT8_C( 113),  INT8_C(  40),  INT8_C( 124), -INT8_C(  70),
+         INT8_C(  15), -INT8_C(  53),  INT8_C(  98), -INT8_C(   2),  INT8_C( 107),  INT8_C( 109), -INT8_C(  75),  INT8_C(   0) },
+      {  INT8_C(   0),  INT8_C(   0), -INT8_C(  87),  INT8_C(   0), -INT8_C(  92),  INT8_C(   0),  INT8_C(   0), -INT8_C(  93),
+         INT8_C(   0), -INT8_C(  60), -INT8_C( 113),  INT8_C(  40),  INT8_C( 124),  INT8_C(   0),  INT8_C(   0), -INT8_C(  70) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_expand_epi8(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_expand_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t r[8];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { -INT16_C( 15205), -INT16_C( 14661), -INT16_C( 23903), -INT16_C( 28477), -INT16_C( 24387), -INT16_C( 29349), -INT16_C(  8262), -INT16_C(  4204) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(255),
+      { -INT16_C( 28889), -INT16_C(  1978),  INT16_C(  9401), -INT16_C( 18426), -INT16_C( 16045), -INT16_C(  6152), -INT16_C( 31168), -INT16_C(  1257) },
+      { -INT16_C( 28889), -INT16_C(  1978),  INT16_C(  9401), -INT16_C( 18426), -INT16_C( 16045), -INT16_C(  6152), -INT16_C( 31168), -INT16_C(  1257) } },
+    { UINT8_C(180),
+      { -INT16_C( 10381), -INT16_C( 15874), -INT16_C(  4568),  INT16_C(  5805), -INT16_C( 15240), -INT16_C(  3795),  INT16_C( 29226), -INT16_C( 24616) },
+      {  INT16_C(     0),  INT16_C(     0), -INT16_C( 10381),  INT16_C(     0), -INT16_C( 15874), -INT16_C(  4568),  INT16_C(     0),  INT16_C(  5805) } },
+    { UINT8_C( 29),
+      { -INT16_C( 31611),  INT16_C(  2321),  INT16_C( 21187),  INT16_C( 14240),  INT16_C( 26299),  INT16_C(  6046),  INT16_C(  1723), -INT16_C( 26190) },
+      { -INT16_C( 31611),  INT16_C(     0),  INT16_C(  2321),  INT16_C( 21187),  INT16_C( 14240),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(139),
+      {  INT16_C(  4596), -INT16_C( 13989), -INT16_C( 19572),  INT16_C(   622), -INT16_C( 19886), -INT16_C( 14059), -INT16_C( 21580),  INT16_C( 21576) },
+      {  INT16_C(  4596), -INT16_C( 13989),  INT16_C(     0), -INT16_C( 19572),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(   622) } },
+    { UINT8_C(243),
+      { -INT16_C(  4132),  INT16_C( 16432), -INT16_C( 25126),  INT16_C( 19372), -INT16_C( 30031), -INT16_C( 25963),  INT16_C(  7365),  INT16_C( 25986) },
+      { -INT16_C(  4132),  INT16_C( 16432),  INT16_C(     0),  INT16_C(     0), -INT16_C( 25126),  INT16_C( 19372), -INT16_C( 30031), -INT16_C( 25963) } },
+    { UINT8_C(194),
+      { -INT16_C( 16635),  INT16_C( 16902),  INT16_C( 16270), -INT16_C(  1907), -INT16_C( 23337),  INT16_C( 29361),  INT16_C(  6716), -INT16_C( 25566) },
+      {  INT16_C(     0), -INT16_C( 16635),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 16902),  INT16_C( 16270) } },
+    { UINT8_C(133),
+      {  INT16_C( 18880), -INT16_C(  1157), -INT16_C( 30096), -INT16_C( 13673), -INT16_C( 21653),  INT16_C( 10270),  INT16_C(  4730), -INT16_C(  4578) },
+      {  INT16_C( 18880),  INT16_C(     0), -INT16_C(  1157),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 30096) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_expand_epi16(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_expand_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 k;
+    const int8_t a[32];
+    const int8_t r[32];
+  } test_vec[] = {
+    { UINT32_C(         0),
+      {  INT8_C( 125), -INT8_C(  29),  INT8_C(  34), -INT8_C(  82),  INT8_C(  83), -INT8_C(  81),  INT8_C(  52),  INT8_C(  54),
+        -INT8_C(  34), -INT8_C(  59),  INT8_C( 124),  INT8_C(  82),  INT8_C(  66),  INT8_C(  60), -INT8_C(  74),  INT8_C(  85),
+        -INT8_C( 105),  INT8_C( 104),  INT8_C(  34),  INT8_C(  74), -INT8_C(  70), -INT8_C(  51),  INT8_C( 112), -INT8_C(   2),
+         INT8_C(  79), -INT8_C( 115), -INT8_C(  32), -INT8_C( 113),  INT8_C(  46), -INT8_C(  16), -INT8_C(  13),  INT8_C( 114) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(4294967295),
+      {  INT8_C(  96),  INT8_C(  96), -INT8_C( 116), -INT8_C(  53),  INT8_C(  10),  INT8_C( 104), -INT8_C(  44), -INT8_C(  13),
+         INT8_C(  10),  INT8_C( 120),  INT8_C(   2), -INT8_C(  84),  INT8_C(  73),  INT8_C(  97), -INT8_C(   5), -INT8_C( 102),
+         INT8_C( 109),  INT8_C(  97), -INT8_C(  95),  INT8_C(  10), -INT8_C(  44),  INT8_C( 119), -INT8_C(  67),  INT8_C(  46),
+         INT8_C(  78),  INT8_C(   4),  INT8_C(   4), -INT8_C(  70),  INT8_C( 107),  INT8_C(  25),  INT8_C(  85),  INT8_C(  91) },
+      {  INT8_C(  96),  INT8_C(  96), -INT8_C( 116), -INT8_C(  53),  INT8_C(  10),  INT8_C( 104), -INT8_C(  44), -INT8_C(  13),
+         INT8_C(  10),  INT8_C( 120),  INT8_C(   2), -INT8_C(  84),  INT8_C(  73),  INT8_C(  97), -INT8_C(   5), -INT8_C( 102),
+         INT8_C( 109),  INT8_C(  97), -INT8_C(  95),  INT8_C(  10), -INT8_C(  44),  INT8_C( 119), -INT8_C(  67),  INT8_C(  46),
+         INT8_C(  78),  INT8_C(   4),  INT8_C(   4), -INT8_C(  70),  INT8_C( 107),  INT8_C(  25),  INT8_C(  85),  INT8_C(  91) } },
+    { UINT32_C( 796100646),
+      { -INT8_C(  74),  INT8_C( 123), -INT8_C(  77), -INT8_C(  80), -INT8_C(  47), -INT8_C(  34),  INT8_C(   1),  INT8_C(  79),
+        -INT8_C(  97), -INT8_C(   4), -INT8_C(  49),  INT8_C(  52),      INT8_MIN,  INT8_C( 109), -INT8_C( 109),  INT8_C(  92),
+        -INT8_C(   4),  INT8_C(  93),  INT8_C( 119), -INT8_C(  61),  INT8_C(  60), -INT8_C(  92), -INT8_C( 121), -INT8_C(  72),
+        -INT8_C( 105), -INT8_C(  66), -INT8_C(  57),  INT8_C(  98), -INT8_C(  10),  INT8_C(  51),  INT8_C(   1),  INT8_C(   7) },
+      {  INT8_C(   0), -INT8_C(  74),  INT8_C( 123),  INT8_C(   0),  INT8_C(   0), -INT8_C(  77),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  80),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  47),
+        -INT8_C(  34),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(  79), -INT8_C(  97), -INT8_C(   4),  INT8_C(   0),
+        -INT8_C(  49),  INT8_C(  52),      INT8_MIN,  INT8_C( 109),  INT8_C(   0), -INT8_C( 109),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(1122298828),
+      {  INT8_C(  27),  INT8_C( 121), -INT8_C( 121), -INT8_C(  48),  INT8_C(  97),  INT8_C(   3), -INT8_C(  99),  INT8_C(  40),
+        -INT8_C(  50), -INT8_C( 125),  INT8_C(  56),  INT8_C( 120),  INT8_C( 104), -INT8_C(  66), -INT8_C(  15),  INT8_C(   0),
+        -INT8_C(   4), -INT8_C(  75), -INT8_C(  78),  INT8_C( 111),  INT8_C(  25), -INT8_C(  67),  INT8_C(  68), -INT8_C( 104),
+         INT8_C(  95),  INT8_C(   9),  INT8_C( 121),  INT8_C(  61), -INT8_C(  41), -INT8_C( 100),  INT8_C(  15), -INT8_C(  59) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(  27),  INT8_C( 121),  INT8_C(   0),  INT8_C(   0), -INT8_C( 121), -INT8_C(  48),
+         INT8_C(  97),  INT8_C(   3),  INT8_C(   0), -INT8_C(  99),  INT8_C(   0),  INT8_C(  40), -INT8_C(  50), -INT8_C( 125),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  56),  INT8_C(   0),  INT8_C(   0),  INT8_C( 120),  INT8_C( 104), -INT8_C(  66),
+         INT8_C(   0), -INT8_C(  15),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(1510547691),
+      {  INT8_C( 106),  INT8_C(  58),  INT8_C(  46), -INT8_C(   6),  INT8_C(  67),  INT8_C( 125),  INT8_C(  29), -INT8_C(  27),
+         INT8_C(  48), -INT8_C(   6), -INT8_C(  85),  INT8_C(  20),  INT8_C(  36), -INT8_C( 104), -INT8_C(  15),  INT8_C(  86),
+         INT8_C(  68), -INT8_C(  14), -INT8_C(  37),  INT8_C( 118),      INT8_MIN,  INT8_C(  25),  INT8_C(  13), -INT8_C(  87),
+        -INT8_C(  48),  INT8_C(  79), -INT8_C(   7), -INT8_C( 126),  INT8_C(  27), -INT8_C(  23), -INT8_C( 104),  INT8_C(  25) },
+      {  INT8_C( 106),  INT8_C(  58),  INT8_C(   0),  INT8_C(  46),  INT8_C(   0), -INT8_C(   6),  INT8_C(  67),  INT8_C( 125),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  29),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  27),  INT8_C(   0),  INT8_C(   0),  INT8_C(  48),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(   6),  INT8_C(   0), -INT8_C(  85),  INT8_C(  20),  INT8_C(   0),  INT8_C(  36),  INT8_C(   0) } },
+    { UINT32_C(3450378411),
+      {  INT8_C(  90), -INT8_C(  36),  INT8_C(  37),  INT8_C(  99),  INT8_C(   3), -INT8_C(  95), -INT8_C( 124),  INT8_C(  55),
+         INT8_C(  75), -INT8_C( 101), -INT8_C(  46),  INT8_C( 115), -INT8_C(  61),  INT8_C( 124), -INT8_C(  66), -INT8_C( 111),
+        -INT8_C(  26), -INT8_C(  73),  INT8_C( 122), -INT8_C(  32), -INT8_C(  81), -INT8_C( 100), -INT8_C(   1), -INT8_C(  92),
+         INT8_C(  57), -INT8_C(   3),  INT8_C(  16), -INT8_C(  96),  INT8_C(  97), -INT8_C(  21),  INT8_C( 118), -INT8_C(  58) },
+      {  INT8_C(  90), -INT8_C(  36),  INT8_C(   0),  INT8_C(  37),  INT8_C(   0),  INT8_C(  99),  INT8_C(   0),  INT8_C(   3),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  95), -INT8_C( 124),  INT8_C(   0),  INT8_C(   0),  INT8_C(  55),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  75),  INT8_C(   0), -INT8_C( 101),  INT8_C(   0), -INT8_C(  46),
+         INT8_C( 115),  INT8_C(   0), -INT8_C(  61),  INT8_C( 124),  INT8_C(   0),  INT8_C(   0), -INT8_C(  66), -INT8_C( 111) } },
+    { UINT32_C(2519613605),
+      {  INT8_C( 100),  INT8_C(  78),  INT8_C( 108), -INT8_C(  26), -INT8_C(  19),  INT8_C(  10), -INT8_C(  46), -INT8_C( 101),
+         INT8_C(  10), -INT8_C(  88),  INT8_C( 117),  INT8_C(   9), -INT8_C(  71),  INT8_C(  72),  INT8_C( 108), -INT8_C( 114),
+        -INT8_C(  27), -INT8_C(  94), -INT8_C( 101), -INT8_C( 122), -INT8_C(  29), -INT8_C(  42), -INT8_C(  49),  INT8_C(  10),
+        -INT8_C( 122), -INT8_C(  87),  INT8_C(  10), -INT8_C( 106), -INT8_C( 125),  INT8_C(  50),  INT8_C(  80), -INT8_C(  74) },
+      {  INT8_C( 100),  INT8_C(   0),  INT8_C(  78),  INT8_C(   0),  INT8_C(   0),  INT8_C( 108),  INT8_C(   0), -INT8_C(  26),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  19),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(  10), -INT8_C(  46), -INT8_C( 101),  INT8_C(   0),  INT8_C(  10),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(  88),  INT8_C( 117),  INT8_C(   0),  INT8_C(   9),  INT8_C(   0),  INT8_C(   0), -INT8_C(  71) } },
+    { UINT32_C(1496838896),
+      {  INT8_C(  21),  INT8_C(  23),  INT8_C( 107), -INT8_C( 117), -INT8_C(  88),  INT8_C(  73), -INT8_C( 109), -INT8_C(  70),
+         INT8_C(  91),  INT8_C(  11), -INT8_C(  55), -INT8_C(  20),  INT8_C( 117),  INT8_C(  27), -INT8_C(  45), -INT8_C( 106),
+        -INT8_C( 105),  INT8_C(  34), -INT8_C(  74), -INT8_C(  55), -INT8_C(  26), -INT8_C(  25), -INT8_C(  80), -INT8_C( 125),
+        -INT8_C( 126),  INT8_C( 125), -INT8_C(  89),  INT8_C(  30),  INT8_C(  98), -INT8_C(  26),  INT8_C(  71),  INT8_C(  49) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  21),  INT8_C(  23),  INT8_C( 107), -INT8_C( 117),
+         INT8_C(   0), -INT8_C(  88),  INT8_C(   0),  INT8_C(   0),  INT8_C(  73), -INT8_C( 109), -INT8_C(  70),  INT8_C(  91),
+         INT8_C(  11), -INT8_C(  55), -INT8_C(  20),  INT8_C(   0),  INT8_C( 117),  INT8_C(  27),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  45),  INT8_C(   0),  INT8_C(   0), -INT8_C( 106), -INT8_C( 105),  INT8_C(   0),  INT8_C(  34),  INT8_C(   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_expand_epi8(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x32(r, simde_x_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_expand_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int16_t a[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    { UINT16_C(    0),
+      {  INT16_C(  4893), -INT16_C( 31935),  INT16_C( 13702),  INT16_C( 18239),  INT16_C( 25331), -INT16_C(  1938), -INT16_C( 26459),  INT16_C( 31541),
+         INT16_C( 16115),  INT16_C( 22492), -INT16_C(  7495), -INT16_C( 30389),  INT16_C(  8130),  INT16_C( 17123), -INT16_C( 21408), -INT16_C(  5423) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(65535),
+      { -INT16_C(   978),  INT16_C(  6813),  INT16_C( 26088),  INT16_C( 13979), -INT16_C( 32732),  INT16_C( 21769),  INT16_C( 24291), -INT16_C(  3648),
+        -INT16_C(   974), -INT16_C( 32435), -INT16_C( 12380), -INT16_C( 26188),  INT16_C( 32378), -INT16_C(  9218),  INT16_C(  9288),  INT16_C( 30728) },
+      { -INT16_C(   978),  INT16_C(  6813),  INT16_C( 26088),  INT16_C( 13979), -INT16_C( 32732),  INT16_C( 21769),  INT16_C( 24291), -INT16_C(  3648),
+        -INT16_C(   974), -INT16_C( 32435), -INT16_C( 12380), -INT16_C( 26188),  INT16_C( 32378), -INT16_C(  9218),  INT16_C(  9288),  INT16_C( 30728) } },
+    { UINT16_C(13738),
+      { -INT16_C( 16575),  INT16_C( 32650),  INT16_C( 15661),  INT16_C(  1187), -INT16_C( 21494), -INT16_C( 10393), -INT16_C( 17872),  INT16_C( 28825),
+         INT16_C( 25668), -INT16_C( 32268), -INT16_C(  7638), -INT16_C( 30961), -INT16_C( 12848),  INT16_C( 27640),  INT16_C( 24753), -INT16_C( 17010) },
+      {  INT16_C(     0), -INT16_C( 16575),  INT16_C(     0),  INT16_C( 32650),  INT16_C(     0),  INT16_C( 15661),  INT16_C(     0),  INT16_C(  1187),
+        -INT16_C( 21494),  INT16_C(     0), -INT16_C( 10393),  INT16_C(     0), -INT16_C( 17872),  INT16_C( 28825),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(  350),
+      {  INT16_C( 28124),  INT16_C(  3827), -INT16_C( 21934),  INT16_C( 28397),  INT16_C( 16382), -INT16_C( 17047), -INT16_C(  4508), -INT16_C( 18279),
+        -INT16_C( 27437), -INT16_C(  1201), -INT16_C(  7074),  INT16_C(  6803), -INT16_C( 19538),  INT16_C( 10830),  INT16_C( 17954),  INT16_C( 30212) },
+      {  INT16_C(     0),  INT16_C( 28124),  INT16_C(  3827), -INT16_C( 21934),  INT16_C( 28397),  INT16_C(     0),  INT16_C( 16382),  INT16_C(     0),
+        -INT16_C( 17047),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(46589),
+      { -INT16_C( 12842),  INT16_C(  8286),  INT16_C( 16460), -INT16_C(  4122), -INT16_C( 20044), -INT16_C( 17470), -INT16_C( 29604),  INT16_C( 14095),
+        -INT16_C( 23203),  INT16_C( 11782), -INT16_C( 30176),  INT16_C( 22893), -INT16_C(  9359), -INT16_C( 30728),  INT16_C( 32652),  INT16_C( 29499) },
+      { -INT16_C( 12842),  INT16_C(     0),  INT16_C(  8286),  INT16_C( 16460), -INT16_C(  4122), -INT16_C( 20044), -INT16_C( 17470), -INT16_C( 29604),
+         INT16_C( 14095),  INT16_C(     0), -INT16_C( 23203),  INT16_C(     0),  INT16_C( 11782), -INT16_C( 30176),  INT16_C(     0),  INT16_C( 22893) } },
+    { UINT16_C(32455),
+      {  INT16_C(  5626),  INT16_C( 20799), -INT16_C( 30997), -INT16_C( 31893), -INT16_C(  7656), -INT16_C( 10949),  INT16_C( 15778), -INT16_C(  7843),
+         INT16_C( 25480),  INT16_C( 18765), -INT16_C(  9991),  INT16_C( 11095), -INT16_C( 20649), -INT16_C( 20876),  INT16_C( 26451), -INT16_C(  4325) },
+      {  INT16_C(  5626),  INT16_C( 20799), -INT16_C( 30997),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 31893), -INT16_C(  7656),
+         INT16_C(     0), -INT16_C( 10949),  INT16_C( 15778), -INT16_C(  7843),  INT16_C( 25480),  INT16_C( 18765), -INT16_C(  9991),  INT16_C(     0) } },
+    { UINT16_C(34321),
+      {  INT16_C( 14173), -INT16_C( 18601),  INT16_C( 21398),  INT16_C( 17713), -INT16_C( 14549), -INT16_C( 23090),  INT16_C( 17806), -INT16_C( 19785),
+        -INT16_C(  8931),  INT16_C( 14910), -INT16_C( 11682), -INT16_C( 13969), -INT16_C( 11138), -INT16_C( 25279),  INT16_C(  6040), -INT16_C( 26467) },
+      {  INT16_C( 14173),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 18601),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C( 21398),  INT16_C( 17713),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 14549) } },
+    { UINT16_C(39987),
+      { -INT16_C( 14133),  INT16_C( 24405),  INT16_C( 11455),  INT16_C(  3028), -INT16_C( 23697),  INT16_C(  8096), -INT16_C(  6323),  INT16_C( 30624),
+        -INT16_C( 21725), -INT16_C(  9104), -INT16_C(  7853), -INT16_C( 12708), -INT16_C( 10589),  INT16_C( 10563), -INT16_C(  6795), -INT16_C( 12362) },
+      { -INT16_C( 14133),  INT16_C( 24405),  INT16_C(     0),  INT16_C(     0),  INT16_C( 11455),  INT16_C(  3028),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0), -INT16_C( 23697),  INT16_C(  8096), -INT16_C(  6323),  INT16_C(     0),  INT16_C(     0),  INT16_C( 30624) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_expand_epi16(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x16(r, simde_x_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_expand_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 k;
+    const int8_t a[64];
+    const int8_t r[64];
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      {  INT8_C( 126),  INT8_C(  24), -INT8_C(  58),  INT8_C(  51),  INT8_C(  41), -INT8_C(  81), -INT8_C(  34), -INT8_C(  29),
+        -INT8_C( 114),  INT8_C( 105), -INT8_C(  53),  INT8_C( 120), -INT8_C(  54),  INT8_C(  53),  INT8_C(  67), -INT8_C(  61),
+         INT8_C(  18), -INT8_C(  62),  INT8_C(  73), -INT8_C(  51), -INT8_C(  56),  INT8_C(  49),  INT8_C(   7), -INT8_C(  95),
+         INT8_C(   0),  INT8_C(  22), -INT8_C( 120),  INT8_C(  51),  INT8_C(  33), -INT8_C( 127), -INT8_C(   2), -INT8_C(  53),
+         INT8_C( 100), -INT8_C(  68), -INT8_C(  25),  INT8_C(   0),  INT8_C( 100),  INT8_C(  22),  INT8_C(  30), -INT8_C(  50),
+         INT8_C(  81), -INT8_C(  95), -INT8_C(  10), -INT8_C(  49), -INT8_C(  64),  INT8_C(  97),  INT8_C( 119), -INT8_C(  97),
+         INT8_C(  78), -INT8_C(  30), -INT8_C(  57),  INT8_C(  20), -INT8_C(  24), -INT8_C(  29),  INT8_C(  24), -INT8_C(  56),
+         INT8_C(  49),  INT8_C(   9), -INT8_C(  61),  INT8_C(  66), -INT8_C(  12), -INT8_C(  95), -INT8_C(  76), -INT8_C(  79) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C(18446744073709551615),
+      { -INT8_C(  94),  INT8_C(  87), -INT8_C(  67),  INT8_C( 110),  INT8_C(  40),  INT8_C(  48), -INT8_C( 102),  INT8_C(  85),
+        -INT8_C(  97), -INT8_C( 116), -INT8_C( 103),  INT8_C( 104),  INT8_C( 122),  INT8_C( 112), -INT8_C(  48), -INT8_C(  41),
+         INT8_C( 116),  INT8_C(  12),  INT8_C(  76), -INT8_C( 106), -INT8_C(  61),  INT8_C(  74), -INT8_C(  76), -INT8_C(   7),
+        -INT8_C(  30),  INT8_C( 123), -INT8_C(  21),  INT8_C(  40), -INT8_C( 108), -INT8_C(  43), -INT8_C(  84), -INT8_C(  41),
+        -INT8_C(  50),  INT8_C(  43),  INT8_C(  85), -INT8_C(  93),  INT8_C( 126),  INT8_C(  78), -INT8_C(  22), -INT8_C(  55),
+         INT8_C( 102), -INT8_C(  46), -INT8_C(  17),  INT8_C(  98),  INT8_C( 102), -INT8_C( 114),  INT8_C(  43), -INT8_C(  71),
+         INT8_C(   6), -INT8_C( 116),  INT8_C(  91),  INT8_C( 119),  INT8_C(  81),  INT8_C(  29), -INT8_C(  19),  INT8_C(  44),
+        -INT8_C(  56),  INT8_C( 123),  INT8_C( 127), -INT8_C(  75),  INT8_C(  10), -INT8_C(   4), -INT8_C(  25), -INT8_C(  56) },
+      { -INT8_C(  94),  INT8_C(  87), -INT8_C(  67),  INT8_C( 110),  INT8_C(  40),  INT8_C(  48), -INT8_C( 102),  INT8_C(  85),
+        -INT8_C(  97), -INT8_C( 116), -INT8_C( 103),  INT8_C( 104),  INT8_C( 122),  INT8_C( 112), -INT8_C(  48), -INT8_C(  41),
+         INT8_C( 116),  INT8_C(  12),  INT8_C(  76), -INT8_C( 106), -INT8_C(  61),  INT8_C(  74), -INT8_C(  76), -INT8_C(   7),
+        -INT8_C(  30),  INT8_C( 123), -INT8_C(  21),  INT8_C(  40), -INT8_C( 108), -INT8_C(  43), -INT8_C(  84), -INT8_C(  41),
+        -INT8_C(  50),  INT8_C(  43),  INT8_C(  85), -INT8_C(  93),  INT8_C( 126),  INT8_C(  78), -INT8_C(  22), -INT8_C(  55),
+         INT8_C( 102), -INT8_C(  46), -INT8_C(  17),  INT8_C(  98),  INT8_C( 102), -INT8_C( 114),  INT8_C(  43), -INT8_C(  71),
+         INT8_C(   6), -INT8_C( 116),  INT8_C(  91),  INT8_C( 119),  INT8_C(  81),  INT8_C(  29), -INT8_C(  19),  INT8_C(  44),
+        -INT8_C(  56),  INT8_C( 123),  INT8_C( 127), -INT8_C(  75),  INT8_C(  10), -INT8_C(   4), -INT8_C(  25), -INT8_C(  56) } },
+    { UINT64_C( 8468540978084493845),
+      {  INT8_C(  33),  INT8_C(  29),  INT8_C( 111), -INT8_C(   3), -INT8_C(  92), -INT8_C(  47), -INT8_C(  86),  INT8_C(   1),
+         INT8_C( 125),  INT8_C( 119),  INT8_C( 111),  INT8_C(  19),  INT8_C( 117), -INT8_C( 107),  INT8_C(  52),  INT8_C(  48),
+        -INT8_C(  38), -INT8_C(  13), -INT8_C( 102), -INT8_C( 121), -INT8_C( 110),  INT8_C( 127),  INT8_C(  23),  INT8_C(  67),
+        -INT8_C( 117),  INT8_C(  74), -INT8_C( 118),  INT8_C(  15),  INT8_C(  23),  INT8_C(  21),  INT8_C( 117), -INT8_C(  47),
+         INT8_C(  58), -INT8_C(  40), -INT8_C(  59),  INT8_C(  38), -INT8_C( 124),  INT8_C(  73), -INT8_C(  97), -INT8_C(  26),
+         INT8_C(  35),  INT8_C( 109),  INT8_C(  89), -INT8_C(  75),  INT8_C( 126), -INT8_C(  12),  INT8_C(  29),  INT8_C(  51),
+         INT8_C( 107),  INT8_C( 119), -INT8_C(  35),  INT8_C( 120),  INT8_C(  72), -INT8_C(  44), -INT8_C(  87),  INT8_C(  52),
+         INT8_C(   6),  INT8_C( 122),  INT8_C(  10),  INT8_C(  46), -INT8_C(  36), -INT8_C(  47),  INT8_C(  48),  INT8_C(  58) },
+      {  INT8_C(  33),  INT8_C(   0),  INT8_C(  29),  INT8_C(   0),  INT8_C( 111),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(   3),  INT8_C(   0), -INT8_C(  92), -INT8_C(  47), -INT8_C(  86),  INT8_C(   0),  INT8_C(   1),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 125),  INT8_C(   0),  INT8_C(   0),  INT8_C( 119),
+         INT8_C(   0),  INT8_C(   0),  INT8_C( 111),  INT8_C(  19),  INT8_C( 117), -INT8_C( 107),  INT8_C(   0),  INT8_C(  52),
+         INT8_C(   0),  INT8_C(  48), -INT8_C(  38),  INT8_C(   0),  INT8_C(   0), -INT8_C(  13),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C( 102),  INT8_C(   0), -INT8_C( 121), -INT8_C( 110),  INT8_C(   0),  INT8_C(   0),  INT8_C( 127),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(  23),  INT8_C(  67),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 117),
+         INT8_C(  74),  INT8_C(   0), -INT8_C( 118),  INT8_C(   0),  INT8_C(  15),  INT8_C(  23),  INT8_C(  21),  INT8_C(   0) } },
+    { UINT64_C(10075718460086299740),
+      {  INT8_C(   4),  INT8_C(  90), -INT8_C(  66),  INT8_C(  45),  INT8_C(  33),  INT8_C(   7), -INT8_C(  11),  INT8_C(  46),
+         INT8_C(  80),  INT8_C(  96), -INT8_C(  40), -INT8_C(  67),  INT8_C( 106),  INT8_C(   2), -INT8_C(  56), -INT8_C(  65),
+         INT8_C(  94),  INT8_C(  38),  INT8_C(  36),  INT8_C(   8),  INT8_C(  40), -INT8_C(  18),  INT8_C(  29), -INT8_C(  39),
+        -INT8_C(  36), -INT8_C(  97), -INT8_C(  78), -INT8_C(  57),  INT8_C( 112), -INT8_C(  14),  INT8_C(  51), -INT8_C(  97),
+        -INT8_C(  82),  INT8_C(  51), -INT8_C( 121),  INT8_C(  86),  INT8_C(  64),  INT8_C(  54),  INT8_C(  14),  INT8_C(  16),
+         INT8_C( 100), -INT8_C( 116), -INT8_C(  55), -INT8_C( 104),  INT8_C(   1), -INT8_C(   9), -INT8_C(  80), -INT8_C(  97),
+        -INT8_C(  84), -INT8_C( 107), -INT8_C(  92),  INT8_C(  49),  INT8_C(  73), -INT8_C(  21),  INT8_C(  36),  INT8_C(  98),
+        -INT8_C(  36),  INT8_C(  17), -INT8_C(  63),  INT8_C(  30), -INT8_C(  78), -INT8_C(  79), -INT8_C(  44),  INT8_C(  93) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(  90), -INT8_C(  66),  INT8_C(   0),  INT8_C(  45),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  33),  INT8_C(   7),  INT8_C(   0), -INT8_C(  11),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(  46),  INT8_C(   0),  INT8_C(  80),  INT8_C(   0),  INT8_C(   0),  INT8_C(  96),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(  40), -INT8_C(  67),  INT8_C(   0),  INT8_C( 106),  INT8_C(   0),  INT8_C(   2),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(  56), -INT8_C(  65),  INT8_C(  94),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  38),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  36),  INT8_C(   0),  INT8_C(   0),  INT8_C(   8),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  40),  INT8_C(   0), -INT8_C(  18),  INT8_C(   0),  INT8_C(  29), -INT8_C(  39),
+        -INT8_C(  36), -INT8_C(  97),  INT8_C(   0), -INT8_C(  78),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  57) } },
+    { UINT64_C(  470750262573499993),
+      {  INT8_C(  21),  INT8_C(  67),  INT8_C(  63), -INT8_C(  87),  INT8_C(  64),  INT8_C(  82), -INT8_C(  44),  INT8_C( 119),
+         INT8_C(  33),  INT8_C(  43), -INT8_C(  87),  INT8_C(  22), -INT8_C(  78),  INT8_C(  77), -INT8_C( 113), -INT8_C(  96),
+         INT8_C(   1), -INT8_C( 127),  INT8_C(  12),  INT8_C(  98), -INT8_C( 124), -INT8_C(  97), -INT8_C(  30),  INT8_C(  85),
+         INT8_C(  55), -INT8_C( 121),  INT8_C(  74), -INT8_C(  44), -INT8_C(  45),  INT8_C(  72), -INT8_C(  98),  INT8_C(   1),
+         INT8_C( 103), -INT8_C(  83),  INT8_C(  36),  INT8_C(  10), -INT8_C(  18),  INT8_C(  25),  INT8_C(  65), -INT8_C(   3),
+         INT8_C( 114), -INT8_C(  36),  INT8_C( 119), -INT8_C(  33), -INT8_C(   6),  INT8_C(  19), -INT8_C(  91),  INT8_C(  42),
+        -INT8_C( 122),  INT8_C(  91),  INT8_C(  17),  INT8_C( 107),  INT8_C(  57),  INT8_C(  97), -INT8_C(  65), -INT8_C(  56),
+        -INT8_C(  27), -INT8_C(  30),  INT8_C(  11),  INT8_C(   9), -INT8_C(  33), -INT8_C( 104), -INT8_C(  39),  INT8_C(   0) },
+      {  INT8_C(  21),  INT8_C(   0),  INT8_C(   0),  INT8_C(  67),  INT8_C(  63),  INT8_C(   0), -INT8_C(  87),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(  64),  INT8_C(  82),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  44),
+         INT8_C( 119),  INT8_C(   0),  INT8_C(  33),  INT8_C(  43), -INT8_C(  87),  INT8_C(   0),  INT8_C(   0),  INT8_C(  22),
+         INT8_C(   0), -INT8_C(  78),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  77),  INT8_C(   0), -INT8_C( 113),
+         INT8_C(   0), -INT8_C(  96),  INT8_C(   1), -INT8_C( 127),  INT8_C(  12),  INT8_C(   0),  INT8_C(  98), -INT8_C( 124),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  97), -INT8_C(  30),  INT8_C(  85),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  55),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 121),
+         INT8_C(   0),  INT8_C(  74), -INT8_C(  44),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C( 1416448648818694655),
+      {  INT8_C(  12), -INT8_C(  82),  INT8_C( 121),  INT8_C(  65),  INT8_C(  47), -INT8_C( 127),  INT8_C(  12), -INT8_C( 120),
+         INT8_C(  97), -INT8_C( 117),  INT8_C(   8),  INT8_C(  58), -INT8_C(  92), -INT8_C(  81),  INT8_C(  78),  INT8_C(   4),
+        -INT8_C(  14),  INT8_C(  17),  INT8_C(  27),  INT8_C(  21),  INT8_C(  77), -INT8_C(  23), -INT8_C( 112),  INT8_C(  27),
+         INT8_C(  17),  INT8_C(  63), -INT8_C(  33), -INT8_C(  94),  INT8_C(  45),  INT8_C( 105), -INT8_C( 107),  INT8_C(  12),
+         INT8_C(  74), -INT8_C(  72), -INT8_C(  79), -INT8_C(  80),  INT8_C(  43),  INT8_C(  11),  INT8_C(  73),  INT8_C( 117),
+        -INT8_C(  69), -INT8_C( 122),  INT8_C(  67),  INT8_C( 111),  INT8_C(  63),  INT8_C(  31),  INT8_C(  13), -INT8_C(   5),
+        -INT8_C(  40), -INT8_C(  37), -INT8_C( 118), -INT8_C(  21), -INT8_C(  30), -INT8_C(  13),  INT8_C( 116), -INT8_C(  52),
+         INT8_C(  55),  INT8_C(  65),  INT8_C( 125),  INT8_C(  63), -INT8_C(  17), -INT8_C(  36), -INT8_C(  53),  INT8_C(   6) },
+      {  INT8_C(  12), -INT8_C(  82),  INT8_C( 121),  INT8_C(  65),  INT8_C(  47), -INT8_C( 127),  INT8_C(  12), -INT8_C( 120),
+         INT8_C(  97),  INT8_C(   0),  INT8_C(   0), -INT8_C( 117),  INT8_C(   8),  INT8_C(   0),  INT8_C(   0),  INT8_C(  58),
+        -INT8_C(  92), -INT8_C(  81),  INT8_C(   0),  INT8_C(  78),  INT8_C(   0),  INT8_C(   4), -INT8_C(  14),  INT8_C(   0),
+         INT8_C(  17),  INT8_C(  27),  INT8_C(   0),  INT8_C(  21),  INT8_C(  77),  INT8_C(   0),  INT8_C(   0), -INT8_C(  23),
+         INT8_C(   0), -INT8_C( 112),  INT8_C(   0),  INT8_C(  27),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  17),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  63), -INT8_C(  33), -INT8_C(  94),  INT8_C(  45),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 105),  INT8_C(   0), -INT8_C( 107),  INT8_C(   0),  INT8_C(  12),
+         INT8_C(  74), -INT8_C(  72),  INT8_C(   0),  INT8_C(   0), -INT8_C(  79),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C(15051109384895716671),
+      {  INT8_C(  69), -INT8_C(  25),  INT8_C(  24), -INT8_C( 124), -INT8_C(  77), -INT8_C(  52), -INT8_C(  21), -INT8_C( 114),
+        -INT8_C(  13), -INT8_C(  66),  INT8_C(  27), -INT8_C( 123),  INT8_C(  26),  INT8_C(   6),  INT8_C(  76), -INT8_C(  52),
+        -INT8_C(  97), -INT8_C(  46), -INT8_C(  79),  INT8_C(  48),  INT8_C( 122),  INT8_C(  28),  INT8_C(  74),  INT8_C( 110),
+         INT8_C( 108),  INT8_C( 112),  INT8_C(  88), -INT8_C(   6),  INT8_C(  75),  INT8_C(  13), -INT8_C(  27), -INT8_C(  14),
+        -INT8_C(  91),  INT8_C( 122), -INT8_C(  20),  INT8_C(  87),  INT8_C(  69), -INT8_C(  43),  INT8_C(  64),  INT8_C(  10),
+         INT8_C(  42), -INT8_C(  82),  INT8_C(  95),  INT8_C(  73),  INT8_C( 125), -INT8_C(  31),  INT8_C(  84), -INT8_C(  22),
+        -INT8_C( 123),  INT8_C( 116),  INT8_C(  30),  INT8_C( 106),  INT8_C( 124),  INT8_C(  40), -INT8_C(  58), -INT8_C(  23),
+        -INT8_C(   6),  INT8_C(  29), -INT8_C(  17), -INT8_C( 118),  INT8_C(  69), -INT8_C(   3),  INT8_C(  10),  INT8_C(  90) },
+      {  INT8_C(  69), -INT8_C(  25),  INT8_C(  24), -INT8_C( 124), -INT8_C(  77), -INT8_C(  52),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  21),  INT8_C(   0), -INT8_C( 114), -INT8_C(  13), -INT8_C(  66),  INT8_C(   0),  INT8_C(  27), -INT8_C( 123),
+         INT8_C(  26),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   6),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(  76),  INT8_C(   0), -INT8_C(  52),  INT8_C(   0),  INT8_C(   0), -INT8_C(  97), -INT8_C(  46),
+        -INT8_C(  79),  INT8_C(   0),  INT8_C(  48),  INT8_C( 122),  INT8_C(  28),  INT8_C(  74),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 110),  INT8_C(   0),  INT8_C(   0),  INT8_C( 108),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 112),  INT8_C(  88), -INT8_C(   6),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  75),  INT8_C(   0),  INT8_C(  13), -INT8_C(  27) } },
+    { UINT64_C( 9538174164622832409),
+      { -INT8_C(  65), -INT8_C(  50),  INT8_C(  61), -INT8_C(  41),  INT8_C( 104), -INT8_C(  12),  INT8_C(  37),  INT8_C(  55),
+         INT8_C(  35), -INT8_C(  35),  INT8_C( 114),  INT8_C(  40),  INT8_C(  54),  INT8_C( 112), -INT8_C(  40), -INT8_C( 115),
+         INT8_C(  20),  INT8_C(  26), -INT8_C(  50),  INT8_C(  25), -INT8_C( 125), -INT8_C(  94),  INT8_C(  83),  INT8_C(   3),
+         INT8_C( 121), -INT8_C( 123),  INT8_C(  28),  INT8_C(  18), -INT8_C(  24),  INT8_C(  79),  INT8_C(  31),  INT8_C(   7),
+        -INT8_C(  67),  INT8_C(  82), -INT8_C(  54),  INT8_C(  37),  INT8_C(  55), -INT8_C(  45),  INT8_C(  30),  INT8_C(  62),
+         INT8_C( 114),  INT8_C(  78),  INT8_C( 106), -INT8_C( 100), -INT8_C(  81),  INT8_C(  70), -INT8_C(  86), -INT8_C( 103),
+        -INT8_C( 100),  INT8_C(  65), -INT8_C(  61),  INT8_C(  14),  INT8_C( 118), -INT8_C(  34),  INT8_C( 101), -INT8_C(  77),
+         INT8_C(  76),  INT8_C(  14),  INT8_C(  56), -INT8_C(  46),  INT8_C(   7),  INT8_C(  45), -INT8_C(  31), -INT8_C(  38) },
+      { -INT8_C(  65),  INT8_C(   0),  INT8_C(   0), -INT8_C(  50),  INT8_C(  61),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  41),  INT8_C( 104),  INT8_C(   0),  INT8_C(   0), -INT8_C(  12),  INT8_C(  37),  INT8_C(  55),  INT8_C(  35),
+         INT8_C(   0), -INT8_C(  35),  INT8_C( 114),  INT8_C(   0),  INT8_C(   0),  INT8_C(  40),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  54),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C( 112), -INT8_C(  40), -INT8_C( 115),  INT8_C(  20),  INT8_C(   0),  INT8_C(  26), -INT8_C(  50),
+         INT8_C(   0),  INT8_C(  25), -INT8_C( 125),  INT8_C(   0),  INT8_C(   0), -INT8_C(  94),  INT8_C(  83),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   3),  INT8_C( 121), -INT8_C( 123),  INT8_C(  28),  INT8_C(   0),  INT8_C(  18),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0), -INT8_C(  24),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  79) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_expand_epi8(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_expand_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 k;
+    const int16_t a[32];
+    const int16_t r[32];
+  } test_vec[] = {
+    { UINT32_C(         0),
+      {  INT16_C( 23446),  INT16_C( 28471), -INT16_C(  5391),  INT16_C( 18735), -INT16_C( 21293),  INT16_C(  1823), -INT16_C( 16071), -INT16_C( 23590),
+        -INT16_C( 26100), -INT16_C(  5793),  INT16_C(  3648), -INT16_C( 18314), -INT16_C(  2261), -INT16_C(  6024),  INT16_C( 22707),  INT16_C(  6608),
+         INT16_C( 12423),  INT16_C( 32152),  INT16_C( 14053), -INT16_C(   900), -INT16_C( 26471), -INT16_C( 29417),  INT16_C(  9838),  INT16_C( 23546),
+        -INT16_C( 13445),  INT16_C( 28756),  INT16_C(  9292),  INT16_C(  8146), -INT16_C(  6831),  INT16_C(  6246),  INT16_C( 17872), -INT16_C(   161) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(4294967295),
+      {  INT16_C(  2534), -INT16_C( 26971), -INT16_C(  1901), -INT16_C( 23837), -INT16_C( 13069), -INT16_C( 29341),  INT16_C( 32262),  INT16_C(  5114),
+        -INT16_C(  8845),  INT16_C( 16978),  INT16_C( 20924), -INT16_C( 30551), -INT16_C(   229),  INT16_C( 22086), -INT16_C( 11824),  INT16_C( 26160),
+         INT16_C( 30778),  INT16_C( 12734),  INT16_C( 27843),  INT16_C(  9264), -INT16_C( 30806), -INT16_C( 20034), -INT16_C( 31188),  INT16_C( 25841),
+        -INT16_C(  2658), -INT16_C( 11846),  INT16_C( 30110), -INT16_C( 32087),  INT16_C( 20289), -INT16_C(  9075),  INT16_C(  1845),  INT16_C( 26359) },
+      {  INT16_C(  2534), -INT16_C( 26971), -INT16_C(  1901), -INT16_C( 23837), -INT16_C( 13069), -INT16_C( 29341),  INT16_C( 32262),  INT16_C(  5114),
+        -INT16_C(  8845),  INT16_C( 16978),  INT16_C( 20924), -INT16_C( 30551), -INT16_C(   229),  INT16_C( 22086), -INT16_C( 11824),  INT16_C( 26160),
+         INT16_C( 30778),  INT16_C( 12734),  INT16_C( 27843),  INT16_C(  9264), -INT16_C( 30806), -INT16_C( 20034), -INT16_C( 31188),  INT16_C( 25841),
+        -INT16_C(  2658), -INT16_C( 11846),  INT16_C( 30110), -INT16_C( 32087),  INT16_C( 20289), -INT16_C(  9075),  INT16_C(  1845),  INT16_C( 26359) } },
+    { UINT32_C( 913723776),
+      {  INT16_C( 22819), -INT16_C(   751),  INT16_C(    30),  INT16_C( 30206), -INT16_C(  9969), -INT16_C( 27696),  INT16_C( 19894), -INT16_C(  4877),
+        -INT16_C(  3927), -INT16_C( 24377),  INT16_C(  1349),  INT16_C( 30885),  INT16_C( 16396), -INT16_C(  7044),  INT16_C( 20807),  INT16_C( 17539),
+         INT16_C(  4608), -INT16_C( 17858), -INT16_C( 13177), -INT16_C( 28963),  INT16_C(  2389), -INT16_C(  4905), -INT16_C( 20807), -INT16_C(  4419),
+         INT16_C( 26375),  INT16_C( 32581), -INT16_C( 12063), -INT16_C( 19807),  INT16_C(  3851), -INT16_C( 21317),  INT16_C( 17731),  INT16_C( 27495) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 22819),
+        -INT16_C(   751),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(    30),  INT16_C(     0),  INT16_C( 30206),  INT16_C(     0),
+         INT16_C(     0), -INT16_C(  9969), -INT16_C( 27696),  INT16_C(     0),  INT16_C( 19894), -INT16_C(  4877), -INT16_C(  3927),  INT16_C(     0),
+         INT16_C(     0), -INT16_C( 24377),  INT16_C(  1349),  INT16_C(     0),  INT16_C( 30885),  INT16_C( 16396),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(3388663129),
+      { -INT16_C(  8493),  INT16_C( 17743), -INT16_C( 28335),  INT16_C(  5022), -INT16_C( 22247), -INT16_C(  3126), -INT16_C( 12676), -INT16_C( 21363),
+         INT16_C(  3931),  INT16_C( 31449), -INT16_C(  8290),  INT16_C(  2974), -INT16_C( 12063),  INT16_C( 12465), -INT16_C( 20922),  INT16_C( 31973),
+        -INT16_C( 27720),  INT16_C(  9108), -INT16_C( 10503),  INT16_C(  2763), -INT16_C( 28784),  INT16_C( 29774),  INT16_C( 16294),  INT16_C( 11109),
+        -INT16_C( 15031), -INT16_C(  3620),  INT16_C(  2474), -INT16_C( 15541), -INT16_C(  3166),  INT16_C(  4580),  INT16_C( 16595),  INT16_C( 14320) },
+      { -INT16_C(  8493),  INT16_C(     0),  INT16_C(     0),  INT16_C( 17743), -INT16_C( 28335),  INT16_C(     0),  INT16_C(  5022),  INT16_C(     0),
+        -INT16_C( 22247),  INT16_C(     0), -INT16_C(  3126),  INT16_C(     0),  INT16_C(     0), -INT16_C( 12676), -INT16_C( 21363),  INT16_C(  3931),
+         INT16_C(     0),  INT16_C( 31449),  INT16_C(     0), -INT16_C(  8290),  INT16_C(  2974), -INT16_C( 12063),  INT16_C( 12465), -INT16_C( 20922),
+         INT16_C( 31973),  INT16_C(     0),  INT16_C(     0), -INT16_C( 27720),  INT16_C(     0),  INT16_C(     0),  INT16_C(  9108), -INT16_C( 10503) } },
+    { UINT32_C(1741958629),
+      { -INT16_C( 14338), -INT16_C( 17408),  INT16_C( 26757), -INT16_C( 24454),  INT16_C( 10481),  INT16_C(  9102), -INT16_C( 12951), -INT16_C( 17856),
+        -INT16_C(  9377),  INT16_C( 27168), -INT16_C( 31164), -INT16_C( 25751),  INT16_C( 10728),  INT16_C( 21161),  INT16_C(  5698), -INT16_C( 31114),
+         INT16_C(  9949),  INT16_C( 14320),  INT16_C( 14657), -INT16_C(  7875), -INT16_C(  6618), -INT16_C( 27919),  INT16_C(  2873), -INT16_C( 16697),
+        -INT16_C( 28989),  INT16_C( 27443),  INT16_C( 31943),  INT16_C( 28610),  INT16_C(  9019), -INT16_C( 12111),  INT16_C(  9403),  INT16_C( 10266) },
+      { -INT16_C( 14338),  INT16_C(     0), -INT16_C( 17408),  INT16_C(     0),  INT16_C(     0),  INT16_C( 26757), -INT16_C( 24454),  INT16_C( 10481),
+         INT16_C(  9102),  INT16_C(     0), -INT16_C( 12951), -INT16_C( 17856),  INT16_C(     0), -INT16_C(  9377),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C( 27168),  INT16_C(     0), -INT16_C( 31164),  INT16_C(     0), -INT16_C( 25751),  INT16_C( 10728),
+         INT16_C( 21161),  INT16_C(  5698), -INT16_C( 31114),  INT16_C(     0),  INT16_C(     0),  INT16_C(  9949),  INT16_C( 14320),  INT16_C(     0) } },
+    { UINT32_C(3904051311),
+      {  INT16_C( 21663),  INT16_C(  1550), -INT16_C( 12322),  INT16_C( 10228),  INT16_C(  6325), -INT16_C(  7274),  INT16_C( 28758),  INT16_C( 12220),
+        -INT16_C( 28433), -INT16_C(  8019), -INT16_C(  2179), -INT16_C( 12870), -INT16_C( 10718), -INT16_C( 15689),  INT16_C( 31529),  INT16_C(   337),
+         INT16_C( 11599), -INT16_C(  9487), -INT16_C(  9993), -INT16_C( 10479),  INT16_C(   924), -INT16_C(  8509),  INT16_C( 29427),  INT16_C( 12296),
+        -INT16_C( 21392), -INT16_C( 12963),  INT16_C( 21032), -INT16_C( 24066), -INT16_C( 12216), -INT16_C( 17617),  INT16_C(  3192), -INT16_C(  8600) },
+      {  INT16_C( 21663),  INT16_C(  1550), -INT16_C( 12322),  INT16_C( 10228),  INT16_C(     0),  INT16_C(  6325), -INT16_C(  7274),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 28758),  INT16_C( 12220),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+        -INT16_C( 28433), -INT16_C(  8019),  INT16_C(     0),  INT16_C(     0), -INT16_C(  2179), -INT16_C( 12870),  INT16_C(     0), -INT16_C( 10718),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 15689),  INT16_C(     0),  INT16_C( 31529),  INT16_C(   337),  INT16_C( 11599) } },
+    { UINT32_C(1164967786),
+      {  INT16_C( 24596), -INT16_C( 28576),  INT16_C( 19713),  INT16_C(  6949),  INT16_C(  8835),  INT16_C( 16948),  INT16_C( 20592), -INT16_C( 16776),
+         INT16_C( 30421), -INT16_C(  9674),  INT16_C( 32387),  INT16_C( 21570), -INT16_C(  3520),  INT16_C(  3891), -INT16_C(  7385), -INT16_C( 25196),
+        -INT16_C( 17006), -INT16_C( 22648), -INT16_C( 30612), -INT16_C(  5377),  INT16_C(  2771),  INT16_C( 12890), -INT16_C( 17430), -INT16_C( 15308),
+        -INT16_C( 18147),  INT16_C( 26716),  INT16_C(  3976),  INT16_C(  2261),  INT16_C(  9842),  INT16_C(  7660),  INT16_C( 28019),  INT16_C(  6435) },
+      {  INT16_C(     0),  INT16_C( 24596),  INT16_C(     0), -INT16_C( 28576),  INT16_C(     0),  INT16_C( 19713),  INT16_C(  6949),  INT16_C(     0),
+         INT16_C(  8835),  INT16_C( 16948),  INT16_C( 20592), -INT16_C( 16776),  INT16_C( 30421), -INT16_C(  9674),  INT16_C( 32387),  INT16_C( 21570),
+        -INT16_C(  3520),  INT16_C(  3891), -INT16_C(  7385), -INT16_C( 25196),  INT16_C(     0), -INT16_C( 17006), -INT16_C( 22648),  INT16_C(     0),
+        -INT16_C( 30612),  INT16_C(     0), -INT16_C(  5377),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  2771),  INT16_C(     0) } },
+    { UINT32_C(4188905862),
+      { -INT16_C( 19643), -INT16_C( 18922), -INT16_C(   759), -INT16_C( 19060),  INT16_C( 17830),  INT16_C(  2805), -INT16_C( 31206), -INT16_C( 27301),
+        -INT16_C( 13212),  INT16_C(  6963),  INT16_C( 15723), -INT16_C( 18679), -INT16_C( 26066),  INT16_C( 21661),  INT16_C( 22444), -INT16_C( 28929),
+        -INT16_C( 29045), -INT16_C( 18137),  INT16_C( 27256),  INT16_C( 10738), -INT16_C( 24797), -INT16_C(  6026), -INT16_C( 12105), -INT16_C(  5819),
+         INT16_C( 20918),  INT16_C(  4961), -INT16_C( 12961), -INT16_C(   586),  INT16_C( 23108),  INT16_C( 15462),  INT16_C( 23506),  INT16_C( 29521) },
+      {  INT16_C(     0), -INT16_C( 19643), -INT16_C( 18922),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(   759),
+        -INT16_C( 19060),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 17830),  INT16_C(     0),  INT16_C(  2805),
+        -INT16_C( 31206),  INT16_C(     0), -INT16_C( 27301), -INT16_C( 13212),  INT16_C(     0),  INT16_C(  6963),  INT16_C(     0),  INT16_C( 15723),
+        -INT16_C( 18679),  INT16_C(     0),  INT16_C(     0), -INT16_C( 26066),  INT16_C( 21661),  INT16_C( 22444), -INT16_C( 28929), -INT16_C( 29045) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_expand_epi16(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x32(r, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_expand_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[16];
+    const simde__mmask16 k;
+    const int8_t a[16];
+    const int8_t r[16];
+  } test_vec[] = {
+    { {  INT8_C(  42),  INT8_C(  66), -INT8_C(  50),  INT8_C(  27),  INT8_C(  21),  INT8_C( 115),  INT8_C( 121), -INT8_C(  11),
+        -INT8_C(  48), -INT8_C(  33),  INT8_C(  14),  INT8_C(  62),  INT8_C(  40),  INT8_C(  24), -INT8_C( 108),  INT8_C( 101) },
+      UINT16_C(    0),
+      {  INT8_C(  68),  INT8_C( 126),  INT8_C(  88),  INT8_C(  50), -INT8_C(  78), -INT8_C(  83), -INT8_C( 102), -INT8_C( 103),
+             INT8_MIN, -INT8_C(   9),  INT8_C( 100),  INT8_C(  58), -INT8_C(  94), -INT8_C(  89),  INT8_C(  92),  INT8_C(  98) },
+      {  INT8_C(  42),  INT8_C(  66), -INT8_C(  50),  INT8_C(  27),  INT8_C(  21),  INT8_C( 115),  INT8_C( 121), -INT8_C(  11),
+        -INT8_C(  48), -INT8_C(  33),  INT8_C(  14),  INT8_C(  62),  INT8_C(  40),  INT8_C(  24), -INT8_C( 108),  INT8_C( 101) } },
+    { {  INT8_C(  35),  INT8_C(  73), -INT8_C(  43), -INT8_C(  98),  INT8_C(  83), -INT8_C( 119),  INT8_C( 120),  INT8_C(  32),
+         INT8_C(  24), -INT8_C(  64), -INT8_C( 109), -INT8_C(  44),  INT8_C(  55),  INT8_C( 103),  INT8_C(  97),  INT8_C(   3) },
+      UINT16_C(65535),
+      { -INT8_C(  14), -INT8_C( 121), -INT8_C(  34),  INT8_C(  11),  INT8_C(  39),  INT8_C(  63),  INT8_C(  37),  INT8_C(  35),
+         INT8_C(  19),  INT8_C(   9), -INT8_C(  85),  INT8_C(  94), -INT8_C(  92),  INT8_C(  41),  INT8_C( 125),  INT8_C(  93) },
+      { -INT8_C(  14), -INT8_C( 121), -INT8_C(  34),  INT8_C(  11),  INT8_C(  39),  INT8_C(  63),  INT8_C(  37),  INT8_C(  35),
+         INT8_C(  19),  INT8_C(   9), -INT8_C(  85),  INT8_C(  94), -INT8_C(  92),  INT8_C(  41),  INT8_C( 125),  INT8_C(  93) } },
+    { { -INT8_C(   6), -INT8_C( 121), -INT8_C(  26), -INT8_C(  11),  INT8_C(  22),  INT8_C(  40),  INT8_C(  74), -INT8_C(  94),
+         INT8_C(  87), -INT8_C( 119),  INT8_C(  70), -INT8_C(  94), -INT8_C(  93),  INT8_C( 102), -INT8_C(  22),  INT8_C( 117) },
+      UINT16_C(57656),
+      {  INT8_C(  17),  INT8_C( 127),  INT8_C(  31),  INT8_C(   3),  INT8_C( 125), -INT8_C(  23),  INT8_C(  26), -INT8_C(   6),
+         INT8_C( 125),  INT8_C(  67),  INT8_C(  87), -INT8_C(   3),  INT8_C(  56), -INT8_C( 126), -INT8_C(  81), -INT8_C(  84) },
+      { -INT8_C(   6), -INT8_C( 121), -INT8_C(  26),  INT8_C(  17),  INT8_C( 127),  INT8_C(  31),  INT8_C(  74), -INT8_C(  94),
+         INT8_C(   3), -INT8_C( 119),  INT8_C(  70), -INT8_C(  94), -INT8_C(  93),  INT8_C( 125), -INT8_C(  23),  INT8_C(  26) } },
+    { { -INT8_C( 121),  INT8_C(  34),  INT8_C( 122), -INT8_C(  48), -INT8_C(  53),  INT8_C( 116), -INT8_C(  92),  INT8_C(  43),
+        -INT8_C(  23), -INT8_C(  18),  INT8_C(   3),  INT8_C(  71), -INT8_C( 107), -INT8_C(  40), -INT8_C(  37),  INT8_C(  96) },
+      UINT16_C(55478),
+      {  INT8_C(  86),  INT8_C(  14),  INT8_C(  10),  INT8_C(  94), -INT8_C(  62),  INT8_C(  31),  INT8_C(  17),  INT8_C(  39),
+        -INT8_C(  65), -INT8_C( 112),  INT8_C(  19),  INT8_C(   9),  INT8_C(  73), -INT8_C( 119),  INT8_C( 108),  INT8_C(  12) },
+      { -INT8_C( 121),  INT8_C(  86),  INT8_C(  14), -INT8_C(  48),  INT8_C(  10),  INT8_C(  94), -INT8_C(  92), -INT8_C(  62),
+        -INT8_C(  23), -INT8_C(  18),  INT8_C(   3),  INT8_C(  31),  INT8_C(  17), -INT8_C(  40),  INT8_C(  39), -INT8_C(  65) } },
+    { { -INT8_C(  96), -INT8_C(  67),  INT8_C( 104), -INT8_C(  20), -INT8_C(  77), -INT8_C(  66),  INT8_C(  75),  INT8_C(  47),
+         INT8_C( 125), -INT8_C(  97),  INT8_C(  96), -INT8_C(  68), -INT8_C( 125), -INT8_C( 108), -INT8_C(  97), -INT8_C(  16) },
+      UINT16_C(54796),
+      { -INT8_C(  57),  INT8_C( 120),  INT8_C(  14),  INT8_C(  68),  INT8_C(  94),  INT8_C(  52),  INT8_C(  68),  INT8_C(  52),
+        -INT8_C(  64), -INT8_C( 111), -INT8_C(  60), -INT8_C(  29),  INT8_C(  54), -INT8_C( 112),  INT8_C(  41),  INT8_C(  19) },
+      { -INT8_C(  96), -INT8_C(  67), -INT8_C(  57),  INT8_C( 120), -INT8_C(  77), -INT8_C(  66),  INT8_C(  75),  INT8_C(  47),
+         INT8_C( 125),  INT8_C(  14),  INT8_C(  68), -INT8_C(  68),  INT8_C(  94), -INT8_C( 108),  INT8_C(  52),  INT8_C(  68) } },
+    { { -INT8_C(  71), -INT8_C(  60),  INT8_C(  71),  INT8_C(  59), -INT8_C(  31),  INT8_C( 110), -INT8_C( 116),  INT8_C(  97),
+        -INT8_C(   3),  INT8_C(  64),  INT8_C(  96),  INT8_C( 104),  INT8_C(  86), -INT8_C(  70), -INT8_C( 107), -INT8_C(  84) },
+      UINT16_C(53853),
+      { -INT8_C(  92), -INT8_C( 117),  INT8_C(  34),  INT8_C(  84), -INT8_C( 118),  INT8_C(  63), -INT8_C(   7),  INT8_C(  24),
+         INT8_C(  90), -INT8_C(  24), -INT8_C( 121),  INT8_C( 102),  INT8_C( 108),  INT8_C(  80), -INT8_C(  92), -INT8_C( 117) },
+      { -INT8_C(  92), -INT8_C(  60), -INT8_C( 117),  INT8_C(  34),  INT8_C(  84),  INT8_C( 110), -INT8_C( 118),  INT8_C(  97),
+        -INT8_C(   3),  INT8_C(  63),  INT8_C(  96),  INT8_C( 104), -INT8_C(   7), -INT8_C(  70),  INT8_C(  24),  INT8_C(  90) } },
+    { {  INT8_C(  92), -INT8_C(  98), -INT8_C(  65),  INT8_C( 106), -INT8_C(  46),  INT8_C(  77), -INT8_C(  27),  INT8_C(   8),
+        -INT8_C(  82), -INT8_C(  35),  INT8_C( 100),  INT8_C(  78),  INT8_C(  60), -INT8_C(  36),  INT8_C( 119), -INT8_C(  95) },
+      UINT16_C(14323),
+      {  INT8_C(  29),  INT8_C(  73),  INT8_C(  57),  INT8_C(   1),  INT8_C(  37),  INT8_C( 113), -INT8_C(  73),  INT8_C(  56),
+        -INT8_C( 114),  INT8_C(  81),  INT8_C( 119),  INT8_C(  91),  INT8_C( 101), -INT8_C( 111),  INT8_C( 102),  INT8_C( 104) },
+      {  INT8_C(  29),  INT8_C(  73), -INT8_C(  65),  INT8_C( 106),  INT8_C(  57),  INT8_C(   1),  INT8_C(  37),  INT8_C( 113),
+        -INT8_C(  73),  INT8_C(  56), -INT8_C( 114),  INT8_C(  78),  INT8_C(  81),  INT8_C( 119),  INT8_C( 119), -INT8_C(  95) } },
+    { {  INT8_C(  29), -INT8_C(  51),  INT8_C(  54),  INT8_C(  38), -INT8_C(  38),  INT8_C(  11),  INT8_C(  31),  INT8_C(  59),
+         INT8_C(   9), -INT8_C(  99),  INT8_C(  10),  INT8_C(   8), -INT8_C(  28),  INT8_C(  71),  INT8_C(  53),  INT8_C(  29) },
+      UINT16_C(  601),
+      { -INT8_C(  10),  INT8_C(  31), -INT8_C(  83),  INT8_C(  58), -INT8_C(  60),  INT8_C(  79),  INT8_C(  19),  INT8_C( 115),
+        -INT8_C(   3),  INT8_C(  30),  INT8_C(  16), -INT8_C( 106),  INT8_C(  85),  INT8_C(  67), -INT8_C(  63), -INT8_C( 106) },
+      { -INT8_C(  10), -INT8_C(  51),  INT8_C(  54),  INT8_C(  31), -INT8_C(  83),  INT8_C(  11),  INT8_C(  58),  INT8_C(  59),
+         INT8_C(   9), -INT8_C(  60),  INT8_C(  10),  INT8_C(   8), -INT8_C(  28),  INT8_C(  71),  INT8_C(  53),  INT8_C(  29) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi8(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_expand_epi8(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_expand_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[8];
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t r[8];
+  } test_vec[] = {
+    { { -INT16_C( 28867), -INT16_C( 31692), -INT16_C( 30367), -INT16_C( 30248),  INT16_C( 11386), -INT16_C( 28250), -INT16_C(  8266), -INT16_C(  5044) },
+      UINT8_C(  0),
+      {  INT16_C( 32489),  INT16_C(  7586),  INT16_C( 28987), -INT16_C( 28449),  INT16_C( 29973),  INT16_C( 13051),  INT16_C( 19426),  INT16_C( 10993) },
+      { -INT16_C( 28867), -INT16_C( 31692), -INT16_C( 30367), -INT16_C( 30248),  INT16_C( 11386), -INT16_C( 28250), -INT16_C(  8266), -INT16_C(  5044) } },
+    { {  INT16_C(  4480),  INT16_C(  8505), -INT16_C( 29945),  INT16_C( 16274), -INT16_C( 14019),  INT16_C( 13360),  INT16_C( 23608),  INT16_C(   930) },
+      UINT8_C(255),
+      { -INT16_C( 12874), -INT16_C( 12348), -INT16_C(  8628),  INT16_C(  8995),  INT16_C( 12147),  INT16_C( 32117), -INT16_C( 30469),  INT16_C( 15501) },
+      { -INT16_C( 12874), -INT16_C( 12348), -INT16_C(  8628),  INT16_C(  8995),  INT16_C( 12147),  INT16_C( 32117), -INT16_C( 30469),  INT16_C( 15501) } },
+    { { -INT16_C( 12162),  INT16_C( 10397), -INT16_C( 23010), -INT16_C(   189),  INT16_C( 20598), -INT16_C( 30804),  INT16_C( 32704),  INT16_C( 16763) },
+      UINT8_C(104),
+      {  INT16_C( 10630), -INT16_C( 27787),  INT16_C( 12240), -INT16_C( 31051), -INT16_C(  6363),  INT16_C( 12868), -INT16_C( 23970),  INT16_C( 21231) },
+      { -INT16_C( 12162),  INT16_C( 10397), -INT16_C( 23010),  INT16_C( 10630),  INT16_C( 20598), -INT16_C( 27787),  INT16_C( 12240),  INT16_C( 16763) } },
+    { { -INT16_C( 10340), -INT16_C(  5112),  INT16_C( 31057), -INT16_C(  5341),  INT16_C( 16416), -INT16_C( 25060), -INT16_C( 14645),  INT16_C(  2799) },
+      UINT8_C( 44),
+      { -INT16_C(  4672), -INT16_C(  2458),  INT16_C( 19737),  INT16_C( 26479),  INT16_C( 20667),  INT16_C( 11362),  INT16_C( 29180),  INT16_C( 15009) },
+      { -INT16_C( 10340), -INT16_C(  5112), -INT16_C(  4672), -INT16_C(  2458),  INT16_C( 16416),  INT16_C( 19737), -INT16_C( 14645),  INT16_C(  2799) } },
+    { {  INT16_C( 29220), -INT16_C( 29262),  INT16_C( 28054),  INT16_C( 21773),  INT16_C( 21289), -INT16_C( 30981),  INT16_C( 18163),  INT16_C( 25530) },
+      UINT8_C(169),
+      {  INT16_C( 31328), -INT16_C( 14758), -INT16_C(  5871), -INT16_C( 12886),  INT16_C(  8650),  INT16_C(  1219),  INT16_C(  6568),  INT16_C( 12585) },
+      {  INT16_C( 31328), -INT16_C( 29262),  INT16_C( 28054), -INT16_C( 14758),  INT16_C( 21289), -INT16_C(  5871),  INT16_C( 18163), -INT16_C( 12886) } },
+    { { -INT16_C(  9077),  INT16_C( 13669),  INT16_C( 26441), -INT16_C(  7449),  INT16_C( 20659), -INT16_C( 13950), -INT16_C(  3704),  INT16_C(  8738) },
+      UINT8_C( 47),
+      {  INT16_C( 15752), -INT16_C( 27373),  INT16_C( 23550), -INT16_C( 13555),  INT16_C( 19534), -INT16_C( 12812),  INT16_C( 21398), -INT16_C( 20135) },
+      {  INT16_C( 15752), -INT16_C( 27373),  INT16_C( 23550), -INT16_C( 13555),  INT16_C( 20659),  INT16_C( 19534), -INT16_C(  3704),  INT16_C(  8738) } },
+    { {  INT16_C(  2745), -INT16_C( 31328), -INT16_C( 20974),  INT16_C( 20655),  INT16_C(  8090), -INT16_C( 14689), -INT16_C( 26453), -INT16_C( 10885) },
+      UINT8_C(  9),
+      {  INT16_C( 16354), -INT16_C( 18691),  INT16_C( 20097),  INT16_C(  5124), -INT16_C( 24120), -INT16_C( 25012),  INT16_C(  7029), -INT16_C(  7971) },
+      {  INT16_C( 16354), -INT16_C( 31328), -INT16_C( 20974), -INT16_C( 18691),  INT16_C(  8090), -INT16_C( 14689), -INT16_C( 26453), -INT16_C( 10885) } },
+    { { -INT16_C( 11093),  INT16_C(  7919), -INT16_C( 20072), -INT16_C( 11220), -INT16_C( 26781),  INT16_C(  2484), -INT16_C( 21129),  INT16_C( 31234) },
+      UINT8_C( 15),
+      { -INT16_C( 28875), -INT16_C( 11698),  INT16_C( 16693), -INT16_C( 22393),  INT16_C(  6881),  INT16_C(  9830),  INT16_C( 24052),  INT16_C( 27333) },
+      { -INT16_C( 28875), -INT16_C( 11698),  INT16_C( 16693), -INT16_C( 22393), -INT16_C( 26781),  INT16_C(  2484), -INT16_C( 21129),  INT16_C( 31234) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi16(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_expand_epi16(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_expand_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[32];
+    const simde__mmask32 k;
+    const int8_t a[32];
+    const int8_t r[32];
+  } test_vec[] = {
+    { {  INT8_C( 115),  INT8_C( 113),  INT8_C(  45),  INT8_C(  29),  INT8_C(  77), -INT8_C(  21), -INT8_C(  20), -INT8_C(  71),
+        -INT8_C( 114),  INT8_C( 109),  INT8_C(  29), -INT8_C(  23), -INT8_C(  36),  INT8_C(  93), -INT8_C(   1),  INT8_C(   0),
+         INT8_C(  40), -INT8_C( 124),  INT8_C(  99), -INT8_C( 109),  INT8_C( 126),  INT8_C(  90),  INT8_C(   0), -INT8_C(  72),
+        -INT8_C(  15), -INT8_C( 108),  INT8_C( 117), -INT8_C( 113), -INT8_C(  56),  INT8_C(  17), -INT8_C(  91), -INT8_C(  32) },
+      UINT32_C(         0),
+      { -INT8_C(  75),  INT8_C(  20),  INT8_C(  84),  INT8_C(  54), -INT8_C(   8), -INT8_C( 115), -INT8_C(  32),  INT8_C(  45),
+         INT8_C(  49),  INT8_C( 125), -INT8_C(  41),  INT8_C( 108),  INT8_C( 112), -INT8_C(  50), -INT8_C(  39),  INT8_C(  64),
+        -INT8_C(  72), -INT8_C( 121),  INT8_C(   0),  INT8_C( 102),  INT8_C(   2), -INT8_C( 112),  INT8_C(  11),  INT8_C(  93),
+         INT8_C(  71),  INT8_C( 111),  INT8_C(   1), -INT8_C(  11), -INT8_C( 116), -INT8_C( 123), -INT8_C(  72), -INT8_C(  73) },
+      {  INT8_C( 115),  INT8_C( 113),  INT8_C(  45),  INT8_C(  29),  INT8_C(  77), -INT8_C(  21), -INT8_C(  20), -INT8_C(  71),
+        -INT8_C( 114),  INT8_C( 109),  INT8_C(  29), -INT8_C(  23), -INT8_C(  36),  INT8_C(  93), -INT8_C(   1),  INT8_C(   0),
+         INT8_C(  40), -INT8_C( 124),  INT8_C(  99), -INT8_C( 109),  INT8_C( 126),  INT8_C(  90),  INT8_C(   0), -INT8_C(  72),
+        -INT8_C(  15), -INT8_C( 108),  INT8_C( 117), -INT8_C( 113), -INT8_C(  56),  INT8_C(  17), -INT8_C(  91), -INT8_C(  32) } },
+    { { -INT8_C(  44), -INT8_C(   3),  INT8_C( 114), -INT8_C(  78), -INT8_C(  61),  INT8_C( 120),  INT8_C(   6),  INT8_C(  62),
+         INT8_C(  14), -INT8_C(  46), -INT8_C(  87), -INT8_C(  14), -INT8_C(  33), -INT8_C( 106), -INT8_C( 117), -INT8_C(  30),
+         INT8_C(  65), -INT8_C( 123),  INT8_C(  92), -INT8_C(  98),  INT8_C(  13), -INT8_C(  93), -INT8_C(  66), -INT8_C( 125),
+         INT8_C( 112),  INT8_C(  62), -INT8_C(   8), -INT8_C(  63), -INT8_C(  30), -INT8_C(  85), -INT8_C( 118),  INT8_C(  41) },
+      UINT32_C(4294967295),
+      { -INT8_C(  69), -INT8_C(  76), -INT8_C(  43), -INT8_C(  90), -INT8_C(   5), -INT8_C( 124),  INT8_C(  47),  INT8_C(  59),
+         INT8_C(  81), -INT8_C(  99), -INT8_C(  80), -INT8_C( 121),  INT8_C(  28),  INT8_C(  46), -INT8_C(  72), -INT8_C(  99),
+        -INT8_C(  36), -INT8_C( 103), -INT8_C(  34),  INT8_C(   1),  INT8_C(  95),  INT8_C( 101),  INT8_C(  77), -INT8_C(   5),
+         INT8_C(  30), -INT8_C( 114),  INT8_C( 127), -INT8_C(  67), -INT8_C(  94), -INT8_C(  17),  INT8_C(  68),  INT8_C( 118) },
+      { -INT8_C(  69), -INT8_C(  76), -INT8_C(  43), -INT8_C(  90), -INT8_C(   5), -INT8_C( 124),  INT8_C(  47),  INT8_C(  59),
+         INT8_C(  81), -INT8_C(  99), -INT8_C(  80), -INT8_C( 121),  INT8_C(  28),  INT8_C(  46), -INT8_C(  72), -INT8_C(  99),
+        -INT8_C(  36), -INT8_C( 103), -INT8_C(  34),  INT8_C(   1),  INT8_C(  95),  INT8_C( 101),  INT8_C(  77), -INT8_C(   5),
+         INT8_C(  30), -INT8_C( 114),  INT8_C( 127), -INT8_C(  67), -INT8_C(  94), -INT8_C(  17),  INT8_C(  68),  INT8_C( 118) } },
+    { {  INT8_C(  70),  INT8_C(  28), -INT8_C(  28), -INT8_C(  81),  INT8_C(  94), -INT8_C(  96),  INT8_C( 127), -INT8_C(  57),
+         INT8_C(  24),  INT8_C(  16), -INT8_C( 104), -INT8_C(  45),  INT8_C( 124),  INT8_C(   2), -INT8_C(  94),  INT8_C( 107),
+        -INT8_C( 119), -INT8_C(  70),  INT8_C(  57),  INT8_C( 117), -INT8_C(  53),  INT8_C( 110),  INT8_C(  24),  INT8_C(  54),
+        -INT8_C(  98),  INT8_C(  25), -INT8_C(   5),  INT8_C(  76), -INT8_C(  54),  INT8_C(  59), -INT8_C(  31), -INT8_C(  38) },
+      UINT32_C(4286821091),
+      { -INT8_C(  99), -INT8_C( 110), -INT8_C(  25),  INT8_C(  80),  INT8_C(  76), -INT8_C(  16),  INT8_C( 123), -INT8_C(  19),
+        -INT8_C(  96), -INT8_C( 123),  INT8_C(  46),  INT8_C(  90), -INT8_C( 126),  INT8_C( 101), -INT8_C(  77),  INT8_C(  40),
+        -INT8_C(  52), -INT8_C(  57),  INT8_C(  42),  INT8_C( 112), -INT8_C(  98),  INT8_C( 123), -INT8_C(  77), -INT8_C( 110),
+        -INT8_C(  11), -INT8_C(   8), -INT8_C(  57), -INT8_C(  66),  INT8_C( 105),  INT8_C(  97),  INT8_C(   1),  INT8_C(  85) },
+      { -INT8_C(  99), -INT8_C( 110), -INT8_C(  28), -INT8_C(  81),  INT8_C(  94), -INT8_C(  25),  INT8_C(  80),  INT8_C(  76),
+         INT8_C(  24), -INT8_C(  16), -INT8_C( 104), -INT8_C(  45),  INT8_C( 123), -INT8_C(  19), -INT8_C(  94), -INT8_C(  96),
+        -INT8_C( 123),  INT8_C(  46),  INT8_C(  57),  INT8_C( 117), -INT8_C(  53),  INT8_C( 110),  INT8_C(  24),  INT8_C(  90),
+        -INT8_C( 126),  INT8_C( 101), -INT8_C(  77),  INT8_C(  40), -INT8_C(  52), -INT8_C(  57),  INT8_C(  42),  INT8_C( 112) } },
+    { { -INT8_C(  26), -INT8_C(   5), -INT8_C(  46),  INT8_C(  55),  INT8_C(   1), -INT8_C(  95), -INT8_C( 118), -INT8_C(  65),
+        -INT8_C( 108),  INT8_C(   9),  INT8_C(  59), -INT8_C( 119), -INT8_C(  90),  INT8_C( 119),  INT8_C(  11), -INT8_C(  69),
+        -INT8_C(  78),  INT8_C( 125),  INT8_C(  33),  INT8_C(  17), -INT8_C(  79), -INT8_C(  64), -INT8_C( 105), -INT8_C(  34),
+        -INT8_C(  45),  INT8_C(  58), -INT8_C( 124),  INT8_C(  33),  INT8_C(   7),  INT8_C(  61),  INT8_C(  67),  INT8_C(   3) },
+      UINT32_C(3793562101),
+      { -INT8_C(   5),  INT8_C(  16), -INT8_C( 110),  INT8_C(  77),  INT8_C(  51), -INT8_C(  11),  INT8_C(   2), -INT8_C(  18),
+         INT8_C(  23), -INT8_C( 127), -INT8_C(  96),  INT8_C(  25), -INT8_C(  27), -INT8_C(  62),  INT8_C( 107),  INT8_C(  95),
+        -INT8_C(  27), -INT8_C(  42),  INT8_C(  27),  INT8_C(  35), -INT8_C(  95),  INT8_C(  86), -INT8_C( 124), -INT8_C(  43),
+         INT8_C( 124), -INT8_C(  86), -INT8_C(  53),  INT8_C( 120),  INT8_C(  36),  INT8_C(  10),  INT8_C(  64),  INT8_C(  98) },
+      { -INT8_C(   5), -INT8_C(   5),  INT8_C(  16),  INT8_C(  55), -INT8_C( 110),  INT8_C(  77),  INT8_C(  51), -INT8_C(  11),
+         INT8_C(   2),  INT8_C(   9),  INT8_C(  59), -INT8_C(  18), -INT8_C(  90),  INT8_C(  23),  INT8_C(  11), -INT8_C(  69),
+        -INT8_C( 127),  INT8_C( 125), -INT8_C(  96),  INT8_C(  25), -INT8_C(  27), -INT8_C(  64), -INT8_C( 105), -INT8_C(  34),
+        -INT8_C(  45), -INT8_C(  62), -INT8_C( 124),  INT8_C(  33),  INT8_C(   7),  INT8_C( 107),  INT8_C(  95), -INT8_C(  27) } },
+    { {  INT8_C( 109),  INT8_C(  83), -INT8_C(  55), -INT8_C( 116), -INT8_C(  57),  INT8_C(  80), -INT8_C(  54),  INT8_C(   3),
+        -INT8_C( 111), -INT8_C( 124), -INT8_C(  75),  INT8_C(  86), -INT8_C(  38),  INT8_C(  77), -INT8_C(  57),  INT8_C(  92),
+        -INT8_C(  28), -INT8_C( 101), -INT8_C(  30),  INT8_C(  35), -INT8_C(  89), -INT8_C( 112), -INT8_C( 109),  INT8_C(  88),
+         INT8_C( 104), -INT8_C( 114),  INT8_C(  55),  INT8_C(  53), -INT8_C( 115), -INT8_C(  50),  INT8_C( 123), -INT8_C(  91) },
+      UINT32_C( 912240054),
+      {  INT8_C(  46), -INT8_C(  54),  INT8_C(  59),  INT8_C( 121), -INT8_C(  99),  INT8_C( 120),  INT8_C( 102), -INT8_C( 110),
+         INT8_C(  73),  INT8_C(  69), -INT8_C(  21),  INT8_C(  28),  INT8_C( 108),  INT8_C(  32),  INT8_C(  78), -INT8_C(  48),
+         INT8_C(  59),  INT8_C( 111), -INT8_C(  79), -INT8_C( 102),  INT8_C(  43),  INT8_C(  85),  INT8_C( 107), -INT8_C(  45),
+        -INT8_C(  88),  INT8_C(  91),  INT8_C(   9), -INT8_C(  69),  INT8_C(  60), -INT8_C(  32), -INT8_C(  71),  INT8_C(  98) },
+      {  INT8_C( 109),  INT8_C(  46), -INT8_C(  54), -INT8_C( 116),  INT8_C(  59),  INT8_C( 121), -INT8_C(  54), -INT8_C(  99),
+         INT8_C( 120), -INT8_C( 124),  INT8_C( 102), -INT8_C( 110), -INT8_C(  38),  INT8_C(  73), -INT8_C(  57),  INT8_C(  69),
+        -INT8_C(  21),  INT8_C(  28),  INT8_C( 108),  INT8_C(  32),  INT8_C(  78), -INT8_C( 112), -INT8_C(  48),  INT8_C(  88),
+         INT8_C( 104),  INT8_C(  59),  INT8_C( 111),  INT8_C(  53), -INT8_C(  79), -INT8_C( 102),  INT8_C( 123), -INT8_C(  91) } },
+    { { -INT8_C( 105),  INT8_C(  82),  INT8_C(  36),  INT8_C(  62),  INT8_C( 126),  INT8_C( 114),  INT8_C(  14),  INT8_C(  64),
+        -INT8_C(  96), -INT8_C(  55), -INT8_C( 100), -INT8_C(  67),  INT8_C(  12), -INT8_C(   4),  INT8_C(  49), -INT8_C(   1),
+         INT8_C(  34),  INT8_C( 116),  INT8_C(   8),  INT8_C(  86), -INT8_C(  46),  INT8_C( 127), -INT8_C(  53),  INT8_C(  96),
+         INT8_C(  32),  INT8_C(  24), -INT8_C(  64), -INT8_C(  19),  INT8_C(  74),  INT8_C( 100), -INT8_C(  92),  INT8_C(  33) },
+      UINT32_C(3000454794),
+      { -INT8_C(  58),  INT8_C(  99), -INT8_C(  71), -INT8_C(  64),  INT8_C(  11), -INT8_C(  15),  INT8_C(  44), -INT8_C( 118),
+         INT8_C( 121),  INT8_C( 105),  INT8_C(  23), -INT8_C(  69),  INT8_C(  12),  INT8_C( 100), -INT8_C( 114), -INT8_C(  55),
+         INT8_C(  60),  INT8_C(   6),  INT8_C(  52), -INT8_C(  68), -INT8_C(  89),  INT8_C(  56),  INT8_C( 118),  INT8_C(  32),
+         INT8_C( 106),  INT8_C( 108),  INT8_C(  64),  INT8_C(  66),  INT8_C( 100), -INT8_C(  88),  INT8_C(  31), -INT8_C( 115) },
+      { -INT8_C( 105), -INT8_C(  58),  INT8_C(  36),  INT8_C(  99),  INT8_C( 126),  INT8_C( 114),  INT8_C(  14), -INT8_C(  71),
+        -INT8_C(  96), -INT8_C(  64),  INT8_C(  11), -INT8_C(  15),  INT8_C(  12), -INT8_C(   4),  INT8_C(  44), -INT8_C(   1),
+        -INT8_C( 118),  INT8_C( 121),  INT8_C( 105),  INT8_C(  86),  INT8_C(  23),  INT8_C( 127), -INT8_C(  69),  INT8_C(  12),
+         INT8_C(  32),  INT8_C( 100), -INT8_C(  64), -INT8_C(  19), -INT8_C( 114), -INT8_C(  55), -INT8_C(  92),  INT8_C(  60) } },
+    { { -INT8_C(  49), -INT8_C( 120), -INT8_C( 115),  INT8_C(  46),  INT8_C(  88),  INT8_C( 108),  INT8_C(  62), -INT8_C(  86),
+        -INT8_C(   7), -INT8_C( 106), -INT8_C(  99),  INT8_C(  84), -INT8_C(  70), -INT8_C(  73),  INT8_C( 102),  INT8_C( 114),
+             INT8_MIN,  INT8_C(   9),  INT8_C(  45), -INT8_C( 103),  INT8_C( 114),  INT8_C(  22),  INT8_C(  30),  INT8_C(  90),
+         INT8_C( 124),  INT8_C(  34),  INT8_C(  88),  INT8_C( 122), -INT8_C( 126),  INT8_C(  57), -INT8_C(  75), -INT8_C(  98) },
+      UINT32_C(1593531193),
+      {  INT8_C(  59), -INT8_C(  47), -INT8_C(  34),  INT8_C(  51), -INT8_C(  99), -INT8_C( 118), -INT8_C(  89), -INT8_C(  86),
+        -INT8_C(  25), -INT8_C( 104),  INT8_C(  67),  INT8_C( 121),  INT8_C(  27), -INT8_C(  81),  INT8_C(   8), -INT8_C(  82),
+        -INT8_C(  65),  INT8_C(  50), -INT8_C(  22),  INT8_C(  69), -INT8_C( 117), -INT8_C(  32),  INT8_C(  69),  INT8_C( 109),
+        -INT8_C(  15), -INT8_C(  50), -INT8_C(  99), -INT8_C( 126),  INT8_C(  55), -INT8_C(  57),  INT8_C(  82), -INT8_C( 104) },
+      {  INT8_C(  59), -INT8_C( 120), -INT8_C( 115), -INT8_C(  47), -INT8_C(  34),  INT8_C(  51),  INT8_C(  62), -INT8_C(  86),
+        -INT8_C(  99), -INT8_C( 118), -INT8_C(  99), -INT8_C(  89), -INT8_C(  86), -INT8_C(  73), -INT8_C(  25),  INT8_C( 114),
+        -INT8_C( 104),  INT8_C(  67),  INT8_C(  45),  INT8_C( 121),  INT8_C(  27), -INT8_C(  81),  INT8_C(   8), -INT8_C(  82),
+         INT8_C( 124), -INT8_C(  65),  INT8_C(  50), -INT8_C(  22),  INT8_C(  69),  INT8_C(  57), -INT8_C( 117), -INT8_C(  98) } },
+    { { -INT8_C(  47), -INT8_C( 100),  INT8_C(  17),  INT8_C(  59),  INT8_C(  39),  INT8_C(  43), -INT8_C( 115),  INT8_C(  76),
+         INT8_C(  90),  INT8_C(  72), -INT8_C(  78),  INT8_C(  51),  INT8_C( 115), -INT8_C(  25),  INT8_C(  46),  INT8_C(  14),
+        -INT8_C(  26),  INT8_C(  93), -INT8_C( 105), -INT8_C(  82),  INT8_C(  63),  INT8_C( 113),  INT8_C(   7), -INT8_C(  21),
+         INT8_C(  54),  INT8_C( 104),  INT8_C(  88),  INT8_C( 102), -INT8_C(  10),  INT8_C(  65),  INT8_C(  11),  INT8_C( 119) },
+      UINT32_C(1899519017),
+      {  INT8_C(  80),  INT8_C(  44), -INT8_C(  34), -INT8_C(  33),  INT8_C(  44), -INT8_C(  96),  INT8_C(   5),  INT8_C(  55),
+         INT8_C(  49), -INT8_C(  49), -INT8_C(  94),  INT8_C(  31), -INT8_C(  63), -INT8_C(  98), -INT8_C(  69), -INT8_C( 110),
+         INT8_C(  11), -INT8_C(  43),  INT8_C( 114), -INT8_C(  48), -INT8_C(  63), -INT8_C(  44), -INT8_C(  41),  INT8_C(  18),
+         INT8_C(  58), -INT8_C(  86),  INT8_C(  51),  INT8_C(  99),  INT8_C(  43),  INT8_C(  47), -INT8_C(  29),      INT8_MIN },
+      {  INT8_C(  80), -INT8_C( 100),  INT8_C(  17),  INT8_C(  44),  INT8_C(  39), -INT8_C(  34), -INT8_C( 115),  INT8_C(  76),
+         INT8_C(  90),  INT8_C(  72), -INT8_C(  33),  INT8_C(  44), -INT8_C(  96), -INT8_C(  25),  INT8_C(   5),  INT8_C(  14),
+        -INT8_C(  26),  INT8_C(  93), -INT8_C( 105),  INT8_C(  55),  INT8_C(  49), -INT8_C(  49),  INT8_C(   7), -INT8_C(  21),
+        -INT8_C(  94),  INT8_C( 104),  INT8_C(  88),  INT8_C( 102),  INT8_C(  31), -INT8_C(  63), -INT8_C(  98),  INT8_C( 119) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi8(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_expand_epi8(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x32(r, simde_x_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_expand_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[16];
+    const simde__mmask16 k;
+    const int16_t a[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    { {  INT16_C( 19113), -INT16_C( 11228),  INT16_C( 26449), -INT16_C(  5785), -INT16_C( 32154), -INT16_C(   255),  INT16_C(  3996), -INT16_C( 21159),
+        -INT16_C( 12826),  INT16_C(  9138),  INT16_C(  3305),  INT16_C(   448),  INT16_C(  1833),  INT16_C( 30927), -INT16_C(  5634), -INT16_C( 31792) },
+      UINT16_C(    0),
+      {  INT16_C(  8001), -INT16_C( 30879), -INT16_C(  6714), -INT16_C(  1030),  INT16_C( 10344), -INT16_C( 25492), -INT16_C( 26401),  INT16_C( 16159),
+         INT16_C( 11471), -INT16_C( 19412),  INT16_C( 18695),  INT16_C(  9345), -INT16_C( 16910), -INT16_C(  3524), -INT16_C( 19715), -INT16_C( 13157) },
+      {  INT16_C( 19113), -INT16_C( 11228),  INT16_C( 26449), -INT16_C(  5785), -INT16_C( 32154), -INT16_C(   255),  INT16_C(  3996), -INT16_C( 21159),
+        -INT16_C( 12826),  INT16_C(  9138),  INT16_C(  3305),  INT16_C(   448),  INT16_C(  1833),  INT16_C( 30927), -INT16_C(  5634), -INT16_C( 31792) } },
+    { {  INT16_C(  5556), -INT16_C(   261), -INT16_C( 15085), -INT16_C( 24984), -INT16_C( 10545), -INT16_C( 15031), -INT16_C(  8778),  INT16_C( 19952),
+         INT16_C( 18585), -INT16_C( 23670),  INT16_C( 22418), -INT16_C( 24433), -INT16_C(  2347),  INT16_C( 28887),  INT16_C(  5046),  INT16_C(  8057) },
+      UINT16_C(65535),
+      { -INT16_C( 31674),  INT16_C( 14067), -INT16_C( 22614),  INT16_C( 14838),  INT16_C( 21841),  INT16_C(  1319),  INT16_C( 28431), -INT16_C( 25303),
+         INT16_C(  3476), -INT16_C(   335), -INT16_C(  6273),  INT16_C(  6690),  INT16_C(  7246),  INT16_C( 32318),  INT16_C( 14282), -INT16_C( 13543) },
+      { -INT16_C( 31674),  INT16_C( 14067), -INT16_C( 22614),  INT16_C( 14838),  INT16_C( 21841),  INT16_C(  1319),  INT16_C( 28431), -INT16_C( 25303),
+         INT16_C(  3476), -INT16_C(   335), -INT16_C(  6273),  INT16_C(  6690),  INT16_C(  7246),  INT16_C( 32318),  INT16_C( 14282), -INT16_C( 13543) } },
+    { {  INT16_C( 18091), -INT16_C(  9132), -INT16_C( 25445), -INT16_C( 12447),  INT16_C(  2576), -INT16_C(  6690), -INT16_C( 32216),  INT16_C(  5845),
+         INT16_C( 30660),  INT16_C( 20161), -INT16_C( 30310), -INT16_C( 23988), -INT16_C( 19627),  INT16_C( 15438),  INT16_C( 16780),  INT16_C( 31923) },
+      UINT16_C(53577),
+      {  INT16_C(   422), -INT16_C( 19675),  INT16_C(  5020),  INT16_C( 28955),  INT16_C(  2321),  INT16_C( 14491), -INT16_C(  8272),  INT16_C( 29592),
+         INT16_C( 30551), -INT16_C( 17051),  INT16_C( 23040), -INT16_C(   512), -INT16_C( 19289),  INT16_C( 11397), -INT16_C(  3628), -INT16_C( 23100) },
+      {  INT16_C(   422), -INT16_C(  9132), -INT16_C( 25445), -INT16_C( 19675),  INT16_C(  2576), -INT16_C(  6690),  INT16_C(  5020),  INT16_C(  5845),
+         INT16_C( 28955),  INT16_C( 20161), -INT16_C( 30310), -INT16_C( 23988),  INT16_C(  2321),  INT16_C( 15438),  INT16_C( 14491), -INT16_C(  8272) } },
+    { { -INT16_C(  5321), -INT16_C( 17460),  INT16_C(  2634), -INT16_C( 31176),  INT16_C( 28453), -INT16_C( 17741), -INT16_C( 14081), -INT16_C( 24887),
+        -INT16_C( 23341), -INT16_C(  7483), -INT16_C(  8873),  INT16_C( 13758),  INT16_C( 20231),  INT16_C( 17041),  INT16_C( 32680), -INT16_C( 22715) },
+      UINT16_C(47302),
+      {  INT16_C( 26409), -INT16_C( 23931), -INT16_C( 12573), -INT16_C( 14661), -INT16_C( 18815), -INT16_C( 25981),  INT16_C( 32443),  INT16_C( 16860),
+         INT16_C( 27385),  INT16_C( 24566), -INT16_C( 18565),  INT16_C( 11266), -INT16_C(  6570), -INT16_C( 14597), -INT16_C( 17063), -INT16_C( 28546) },
+      { -INT16_C(  5321),  INT16_C( 26409), -INT16_C( 23931), -INT16_C( 31176),  INT16_C( 28453), -INT16_C( 17741), -INT16_C( 12573), -INT16_C( 14661),
+        -INT16_C( 23341), -INT16_C(  7483), -INT16_C(  8873), -INT16_C( 18815), -INT16_C( 25981),  INT16_C( 32443),  INT16_C( 32680),  INT16_C( 16860) } },
+    { { -INT16_C( 20012),  INT16_C( 24084),  INT16_C(  8272), -INT16_C( 13312), -INT16_C( 29003),  INT16_C(  5761),  INT16_C( 26106),  INT16_C(  1911),
+        -INT16_C( 23297),  INT16_C( 15085), -INT16_C( 24040), -INT16_C( 25325),  INT16_C( 18334),  INT16_C( 29547), -INT16_C( 20707),  INT16_C(  4170) },
+      UINT16_C(40109),
+      {  INT16_C( 25158),  INT16_C( 19540), -INT16_C( 26042),  INT16_C( 31041), -INT16_C( 31011),  INT16_C( 12583),  INT16_C( 22387),  INT16_C(  2781),
+         INT16_C( 24988),  INT16_C( 18179), -INT16_C( 25275), -INT16_C( 18520), -INT16_C( 15788), -INT16_C( 12441), -INT16_C( 31190),  INT16_C( 14475) },
+      {  INT16_C( 25158),  INT16_C( 24084),  INT16_C( 19540), -INT16_C( 26042), -INT16_C( 29003),  INT16_C( 31041),  INT16_C( 26106), -INT16_C( 31011),
+        -INT16_C( 23297),  INT16_C( 15085),  INT16_C( 12583),  INT16_C( 22387),  INT16_C(  2781),  INT16_C( 29547), -INT16_C( 20707),  INT16_C( 24988) } },
+    { {  INT16_C( 21871), -INT16_C( 14207), -INT16_C( 16577),  INT16_C( 20070),  INT16_C(  9110), -INT16_C( 10921), -INT16_C( 23508), -INT16_C(  9541),
+        -INT16_C( 18273),  INT16_C( 29341),  INT16_C( 19898),  INT16_C( 17683), -INT16_C( 18237),  INT16_C( 17025), -INT16_C( 26562), -INT16_C( 15637) },
+      UINT16_C( 5889),
+      {  INT16_C(  9085), -INT16_C( 19277), -INT16_C(   765),  INT16_C( 16350),  INT16_C( 18801), -INT16_C( 12543), -INT16_C( 23954), -INT16_C(  5827),
+         INT16_C( 31124), -INT16_C( 24233),  INT16_C( 23060), -INT16_C( 15896), -INT16_C(  3060),  INT16_C( 25263),  INT16_C( 14728),  INT16_C(  4391) },
+      {  INT16_C(  9085), -INT16_C( 14207), -INT16_C( 16577),  INT16_C( 20070),  INT16_C(  9110), -INT16_C( 10921), -INT16_C( 23508), -INT16_C(  9541),
+        -INT16_C( 19277), -INT16_C(   765),  INT16_C( 16350),  INT16_C( 17683),  INT16_C( 18801),  INT16_C( 17025), -INT16_C( 26562), -INT16_C( 15637) } },
+    { { -INT16_C(  8955), -INT16_C( 26512),  INT16_C( 13445), -INT16_C(   948), -INT16_C(   211),  INT16_C( 20956), -INT16_C( 20219),  INT16_C( 19338),
+        -INT16_C( 28985),  INT16_C( 21675), -INT16_C( 23002), -INT16_C(  2761),  INT16_C(  4180), -INT16_C(  4562),  INT16_C( 26265),  INT16_C(  2138) },
+      UINT16_C(44061),
+      {  INT16_C( 31921),  INT16_C( 16264),  INT16_C( 19767),  INT16_C( 25729),  INT16_C( 31732),  INT16_C( 17053), -INT16_C( 24028),  INT16_C( 31373),
+         INT16_C(  2608),  INT16_C( 32718),  INT16_C( 16229),  INT16_C(  8033),  INT16_C( 21277), -INT16_C( 29833), -INT16_C( 27130), -INT16_C( 22375) },
+      {  INT16_C( 31921), -INT16_C( 26512),  INT16_C( 16264),  INT16_C( 19767),  INT16_C( 25729),  INT16_C( 20956), -INT16_C( 20219),  INT16_C( 19338),
+        -INT16_C( 28985),  INT16_C( 21675),  INT16_C( 31732),  INT16_C( 17053),  INT16_C(  4180), -INT16_C( 24028),  INT16_C( 26265),  INT16_C( 31373) } },
+    { {  INT16_C(  5775),  INT16_C( 24464),  INT16_C( 30959), -INT16_C( 15810), -INT16_C( 29879), -INT16_C(  4592),  INT16_C( 24835),  INT16_C(  1265),
+        -INT16_C( 26620), -INT16_C(  7969),  INT16_C(  7409),  INT16_C( 16962),  INT16_C( 28210), -INT16_C( 20872), -INT16_C(  4449),  INT16_C( 14685) },
+      UINT16_C(23226),
+      { -INT16_C(  6501),  INT16_C( 32603),  INT16_C( 23205),  INT16_C( 22138),  INT16_C(  8132), -INT16_C( 22361), -INT16_C( 19271), -INT16_C( 21325),
+         INT16_C( 11123), -INT16_C( 25817),  INT16_C( 12880), -INT16_C(  8126), -INT16_C( 18721), -INT16_C( 31915),  INT16_C( 11670), -INT16_C( 22317) },
+      {  INT16_C(  5775), -INT16_C(  6501),  INT16_C( 30959),  INT16_C( 32603),  INT16_C( 23205),  INT16_C( 22138),  INT16_C( 24835),  INT16_C(  8132),
+        -INT16_C( 26620), -INT16_C( 22361),  INT16_C(  7409), -INT16_C( 19271), -INT16_C( 21325), -INT16_C( 20872),  INT16_C( 11123),  INT16_C( 14685) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi16(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_expand_epi16(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x16(r, simde_x_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_expand_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[64];
+    const simde__mmask64 k;
+    const int8_t a[64];
+    const int8_t r[64];
+  } test_vec[] = {
+    { {  INT8_C(  98),  INT8_C(   0),  INT8_C(   6),  INT8_C(  52), -INT8_C(  98), -INT8_C(  99), -INT8_C(  72), -INT8_C(  73),
+         INT8_C(  80),  INT8_C(  14), -INT8_C(  84),  INT8_C( 115),  INT8_C(   7),  INT8_C(  11), -INT8_C(  73),  INT8_C(  60),
+         INT8_C(  56),  INT8_C( 116),  INT8_C(   4), -INT8_C(  70), -INT8_C(  69),  INT8_C( 116), -INT8_C(  68),  INT8_C(  61),
+         INT8_C(  93),  INT8_C(  93), -INT8_C(  31),  INT8_C(  86), -INT8_C( 118), -INT8_C( 115), -INT8_C(  70), -INT8_C(  77),
+         INT8_C(  78),  INT8_C(  90),  INT8_C(  32),  INT8_C(  84),  INT8_C(  32), -INT8_C(  64),  INT8_C(  81),  INT8_C( 123),
+         INT8_C(  63),  INT8_C(  85), -INT8_C(  41), -INT8_C(  56),  INT8_C(   5),  INT8_C(  81), -INT8_C(  47), -INT8_C(  74),
+         INT8_C(  23), -INT8_C(   5), -INT8_C(  82),  INT8_C(  99),  INT8_C(  11),  INT8_C(  29),  INT8_C(  73),  INT8_C( 105),
+        -INT8_C(  23), -INT8_C( 108), -INT8_C(  93),  INT8_C(  56),  INT8_C(   0), -INT8_C(  64), -INT8_C(  77), -INT8_C(  62) },
+      UINT64_C(                   0),
+      {  INT8_C( 107), -INT8_C(  45), -INT8_C(  10), -INT8_C(  53), -INT8_C( 126), -INT8_C(  31), -INT8_C( 112), -INT8_C( 109),
+         INT8_C(   6),  INT8_C(  70),  INT8_C(  42),  INT8_C(  52),  INT8_C(  12),  INT8_C(  96), -INT8_C(  92), -INT8_C(  19),
+        -INT8_C(  86), -INT8_C(  55),  INT8_C(  82), -INT8_C(   2),  INT8_C(  11),  INT8_C(  13), -INT8_C(  67),  INT8_C(  80),
+        -INT8_C(  36), -INT8_C(  49),  INT8_C(  68), -INT8_C( 100),  INT8_C(  99),  INT8_C(  37),  INT8_C(  15),  INT8_C(  31),
+        -INT8_C(  85),  INT8_C( 120), -INT8_C( 106),  INT8_C(  35),  INT8_C(  59), -INT8_C(  89), -INT8_C( 102),  INT8_C(  55),
+        -INT8_C(  93), -INT8_C( 108), -INT8_C(  29), -INT8_C(  62),  INT8_C(  69), -INT8_C(  59),  INT8_C(  96),  INT8_C(  98),
+         INT8_C(  94),  INT8_C(  78), -INT8_C(  44), -INT8_C(  47), -INT8_C(  22), -INT8_C(  23),  INT8_C(  72),  INT8_C(  94),
+        -INT8_C(  76),  INT8_C( 121), -INT8_C(   3), -INT8_C(  82),  INT8_C(   9), -INT8_C(  99),  INT8_C(  70), -INT8_C(  24) },
+      {  INT8_C(  98),  INT8_C(   0),  INT8_C(   6),  INT8_C(  52), -INT8_C(  98), -INT8_C(  99), -INT8_C(  72), -INT8_C(  73),
+         INT8_C(  80),  INT8_C(  14), -INT8_C(  84),  INT8_C( 115),  INT8_C(   7),  INT8_C(  11), -INT8_C(  73),  INT8_C(  60),
+         INT8_C(  56),  INT8_C( 116),  INT8_C(   4), -INT8_C(  70), -INT8_C(  69),  INT8_C( 116), -INT8_C(  68),  INT8_C(  61),
+         INT8_C(  93),  INT8_C(  93), -INT8_C(  31),  INT8_C(  86), -INT8_C( 118), -INT8_C( 115), -INT8_C(  70), -INT8_C(  77),
+         INT8_C(  78),  INT8_C(  90),  INT8_C(  32),  INT8_C(  84),  INT8_C(  32), -INT8_C(  64),  INT8_C(  81),  INT8_C( 123),
+         INT8_C(  63),  INT8_C(  85), -INT8_C(  41), -INT8_C(  56),  INT8_C(   5),  INT8_C(  81), -INT8_C(  47), -INT8_C(  74),
+         INT8_C(  23), -INT8_C(   5), -INT8_C(  82),  INT8_C(  99),  INT8_C(  11),  INT8_C(  29),  INT8_C(  73),  INT8_C( 105),
+        -INT8_C(  23), -INT8_C( 108), -INT8_C(  93),  INT8_C(  56),  INT8_C(   0), -INT8_C(  64), -INT8_C(  77), -INT8_C(  62) } },
+    { { -INT8_C(  82),  INT8_C(  71), -INT8_C( 101), -INT8_C( 126), -INT8_C(  19),  INT8_C(  66),  INT8_C(   0), -INT8_C(  54),
+        -INT8_C(  45), -INT8_C(  50),  INT8_C( 109), -INT8_C( 117),  INT8_C( 124), -INT8_C(  90),  INT8_C(  75), -INT8_C(  63),
+         INT8_C(  58), -INT8_C(  56), -INT8_C(  99),  INT8_C(  30), -INT8_C(  42), -INT8_C(  21), -INT8_C(  20), -INT8_C(  65),
+        -INT8_C( 126), -INT8_C(  69), -INT8_C(  56),  INT8_C(   7),  INT8_C(  61), -INT8_C(  91), -INT8_C(  22), -INT8_C(  47),
+         INT8_C(  70),  INT8_C( 124),  INT8_C(  68),  INT8_C(  40), -INT8_C( 104),  INT8_C(  43),  INT8_C(  17), -INT8_C(  55),
+        -INT8_C( 120), -INT8_C(  33), -INT8_C( 114), -INT8_C(  93),  INT8_C(  90),  INT8_C(  24), -INT8_C(  34),  INT8_C(  47),
+         INT8_C(  35),  INT8_C(  73), -INT8_C(  69), -INT8_C(  96), -INT8_C(  17), -INT8_C( 104), -INT8_C( 103), -INT8_C(  74),
+        -INT8_C( 123),  INT8_C(  24), -INT8_C(  42), -INT8_C(  11), -INT8_C(  38),  INT8_C(  23),  INT8_C(  57), -INT8_C(  69) },
+      UINT64_C(18446744073709551615),
+      {  INT8_C( 100), -INT8_C(  44), -INT8_C(  29),  INT8_C( 112), -INT8_C(  32), -INT8_C( 105), -INT8_C(  34), -INT8_C(  33),
+         INT8_C(  96), -INT8_C(  46),  INT8_C(  53),  INT8_C(  47),  INT8_C(  99), -INT8_C(  39), -INT8_C(  92),  INT8_C(   1),
+        -INT8_C(  77), -INT8_C(  58),  INT8_C(  27), -INT8_C(  35),  INT8_C(  94), -INT8_C(  16),  INT8_C(  37), -INT8_C( 119),
+        -INT8_C( 108), -INT8_C(  23),  INT8_C(  78), -INT8_C(  88), -INT8_C(  25),  INT8_C( 100), -INT8_C(   6), -INT8_C( 121),
+        -INT8_C( 122),  INT8_C( 127), -INT8_C(  37),  INT8_C(  22), -INT8_C(  44),  INT8_C(  61), -INT8_C(  77), -INT8_C( 106),
+        -INT8_C( 107), -INT8_C( 122),  INT8_C(  69),  INT8_C(  85), -INT8_C(  39), -INT8_C( 124),  INT8_C(  83),  INT8_C(  51),
+         INT8_C(  83), -INT8_C( 103),  INT8_C(  48),  INT8_C(  78), -INT8_C(  62), -INT8_C(  87),  INT8_C(  18),  INT8_C(  46),
+        -INT8_C(  82),  INT8_C(  89), -INT8_C( 125),      INT8_MIN, -INT8_C( 111), -INT8_C( 124), -INT8_C(  67), -INT8_C(  42) },
+      {  INT8_C( 100), -INT8_C(  44), -INT8_C(  29),  INT8_C( 112), -INT8_C(  32), -INT8_C( 105), -INT8_C(  34), -INT8_C(  33),
+         INT8_C(  96), -INT8_C(  46),  INT8_C(  53),  INT8_C(  47),  INT8_C(  99), -INT8_C(  39), -INT8_C(  92),  INT8_C(   1),
+        -INT8_C(  77), -INT8_C(  58),  INT8_C(  27), -INT8_C(  35),  INT8_C(  94), -INT8_C(  16),  INT8_C(  37), -INT8_C( 119),
+        -INT8_C( 108), -INT8_C(  23),  INT8_C(  78), -INT8_C(  88), -INT8_C(  25),  INT8_C( 100), -INT8_C(   6), -INT8_C( 121),
+        -INT8_C( 122),  INT8_C( 127), -INT8_C(  37),  INT8_C(  22), -INT8_C(  44),  INT8_C(  61), -INT8_C(  77), -INT8_C( 106),
+        -INT8_C( 107), -INT8_C( 122),  INT8_C(  69),  INT8_C(  85), -INT8_C(  39), -INT8_C( 124),  INT8_C(  83),  INT8_C(  51),
+         INT8_C(  83), -INT8_C( 103),  INT8_C(  48),  INT8_C(  78), -INT8_C(  62), -INT8_C(  87),  INT8_C(  18),  INT8_C(  46),
+        -INT8_C(  82),  INT8_C(  89), -INT8_C( 125),      INT8_MIN, -INT8_C( 111), -INT8_C( 124), -INT8_C(  67), -INT8_C(  42) } },
+    { { -INT8_C( 102),  INT8_C(   1),  INT8_C(  65), -INT8_C(  33),  INT8_C(  80), -INT8_C(  64),  INT8_C(  75),  INT8_C(  53),
+        -INT8_C( 103),  INT8_C(  96), -INT8_C(  10),  INT8_C( 115), -INT8_C(  19), -INT8_C(  64), -INT8_C(   9), -INT8_C(  32),
+        -INT8_C( 117),  INT8_C(  66),  INT8_C(  82), -INT8_C(  72), -INT8_C( 111),  INT8_C(  30),  INT8_C(  16), -INT8_C(  30),
+        -INT8_C(  41),  INT8_C(  50), -INT8_C( 126), -INT8_C( 103), -INT8_C(  62), -INT8_C(  91),  INT8_C(  30),  INT8_C(  94),
+         INT8_C(  34),  INT8_C(  84),  INT8_C(   2), -INT8_C(  10),  INT8_C(  75), -INT8_C(  71),  INT8_C(  22),  INT8_C(   8),
+         INT8_C(  92), -INT8_C(  12), -INT8_C(   7),  INT8_C(  98), -INT8_C(  48), -INT8_C(  63), -INT8_C(  72), -INT8_C(  69),
+         INT8_C(  58), -INT8_C(  30), -INT8_C(   9), -INT8_C(  68), -INT8_C( 109),  INT8_C(  40),  INT8_C(  72), -INT8_C(  80),
+        -INT8_C(  97),  INT8_C( 120), -INT8_C(  68),  INT8_C(  19), -INT8_C(  43), -INT8_C(  92),  INT8_C(  81), -INT8_C(  57) },
+      UINT64_C( 3389024321008265544),
+      {  INT8_C(  10), -INT8_C( 116),  INT8_C(  55),  INT8_C(  45), -INT8_C(  73), -INT8_C(  66),  INT8_C(   9), -INT8_C(  25),
+         INT8_C(  86),  INT8_C(  68), -INT8_C(  70),  INT8_C(  27), -INT8_C( 103), -INT8_C( 102), -INT8_C(  31),      INT8_MIN,
+        -INT8_C(  61), -INT8_C( 122), -INT8_C(  39), -INT8_C(  98),  INT8_C(  11), -INT8_C(  85), -INT8_C(  36), -INT8_C(  37),
+        -INT8_C(  18), -INT8_C(  29), -INT8_C(  34),  INT8_C(  75), -INT8_C( 115), -INT8_C(   8),  INT8_C(  79),  INT8_C( 113),
+         INT8_C(  91), -INT8_C(  55),  INT8_C(  56),  INT8_C(  60), -INT8_C(  88),  INT8_C(  17),  INT8_C(  99), -INT8_C( 119),
+        -INT8_C(  98), -INT8_C(  31),  INT8_C( 120),  INT8_C( 110), -INT8_C(  90),  INT8_C(   9), -INT8_C( 115),  INT8_C(   6),
+        -INT8_C(  72), -INT8_C( 121), -INT8_C( 120),  INT8_C(  77), -INT8_C(  21), -INT8_C( 106), -INT8_C(  21),  INT8_C( 104),
+         INT8_C(   2),  INT8_C(  62),  INT8_C(  96), -INT8_C(  58),  INT8_C( 107),  INT8_C(  47),  INT8_C( 121),  INT8_C(  47) },
+      { -INT8_C( 102),  INT8_C(   1),  INT8_C(  65),  INT8_C(  10),  INT8_C(  80), -INT8_C(  64), -INT8_C( 116),  INT8_C(  53),
+         INT8_C(  55),  INT8_C(  96), -INT8_C(  10),  INT8_C(  45), -INT8_C(  19), -INT8_C(  73), -INT8_C(  66), -INT8_C(  32),
+         INT8_C(   9), -INT8_C(  25),  INT8_C(  82),  INT8_C(  86),  INT8_C(  68),  INT8_C(  30), -INT8_C(  70),  INT8_C(  27),
+        -INT8_C(  41),  INT8_C(  50), -INT8_C( 103), -INT8_C( 103), -INT8_C(  62), -INT8_C(  91),  INT8_C(  30),  INT8_C(  94),
+         INT8_C(  34), -INT8_C( 102),  INT8_C(   2), -INT8_C(  31),  INT8_C(  75),      INT8_MIN,  INT8_C(  22), -INT8_C(  61),
+        -INT8_C( 122), -INT8_C(  39), -INT8_C(   7), -INT8_C(  98),  INT8_C(  11), -INT8_C(  85), -INT8_C(  72), -INT8_C(  69),
+         INT8_C(  58), -INT8_C(  30), -INT8_C(   9), -INT8_C(  36), -INT8_C( 109),  INT8_C(  40),  INT8_C(  72), -INT8_C(  80),
+        -INT8_C(  37), -INT8_C(  18), -INT8_C(  29), -INT8_C(  34), -INT8_C(  43),  INT8_C(  75),  INT8_C(  81), -INT8_C(  57) } },
+    { {  INT8_C(   7), -INT8_C(  81), -INT8_C(  10),  INT8_C(  39),  INT8_C(  51),  INT8_C(  69),  INT8_C(  65), -INT8_C( 103),
+         INT8_C(  10),  INT8_C(  44), -INT8_C(  38), -INT8_C(  87),  INT8_C(  30),  INT8_C(  42), -INT8_C(  50),  INT8_C(  57),
+        -INT8_C(  95), -INT8_C(  58),  INT8_C(  99),  INT8_C(  87), -INT8_C( 101),  INT8_C(  92),  INT8_C(   0), -INT8_C(   8),
+        -INT8_C(  57), -INT8_C(  32),  INT8_C(  83), -INT8_C(  67), -INT8_C(  10), -INT8_C(  13),  INT8_C( 118),  INT8_C(  74),
+         INT8_C(  96),  INT8_C(  76),  INT8_C(   2), -INT8_C(  54),  INT8_C(  53),  INT8_C(  27),  INT8_C(  43),  INT8_C(  21),
+        -INT8_C(  55), -INT8_C( 126),  INT8_C( 119),  INT8_C(  31),  INT8_C(  77), -INT8_C(   9),  INT8_C(  14),  INT8_C(  88),
+        -INT8_C( 106),  INT8_C(  35),  INT8_C( 119),  INT8_C( 121),  INT8_C(   1),  INT8_C(  63), -INT8_C(  23), -INT8_C(  80),
+        -INT8_C(  85), -INT8_C(  96),  INT8_C(  91), -INT8_C(  63),  INT8_C( 124), -INT8_C(  30), -INT8_C(  55),  INT8_C( 100) },
+      UINT64_C( 1747258994434112496),
+      {  INT8_C(  22),  INT8_C( 112),  INT8_C(  34), -INT8_C( 102), -INT8_C( 125),  INT8_C(  96),  INT8_C( 118), -INT8_C( 114),
+        -INT8_C(  35), -INT8_C(  42), -INT8_C(  59),  INT8_C(  60),  INT8_C(   0), -INT8_C(  20), -INT8_C(  67),  INT8_C(  62),
+         INT8_C(  30), -INT8_C(  48), -INT8_C(  81), -INT8_C(  16), -INT8_C(  75),  INT8_C(  90),  INT8_C(  16), -INT8_C(  52),
+        -INT8_C(  31),  INT8_C(  74),  INT8_C(  12),  INT8_C( 104),  INT8_C( 118),  INT8_C( 100), -INT8_C(  42), -INT8_C(  75),
+         INT8_C(  68),  INT8_C( 108),  INT8_C(  20),  INT8_C(  16), -INT8_C(  30),  INT8_C(  57),  INT8_C(  95),  INT8_C(  19),
+         INT8_C( 111), -INT8_C(  31),  INT8_C( 106), -INT8_C(  44), -INT8_C( 117),  INT8_C( 118), -INT8_C(  84),  INT8_C(  27),
+        -INT8_C(  81),  INT8_C(  94),  INT8_C( 106), -INT8_C(  40),  INT8_C(  67), -INT8_C(  23),  INT8_C( 116), -INT8_C( 126),
+         INT8_C(  67), -INT8_C(  93),  INT8_C(  64), -INT8_C(   8),  INT8_C(  75), -INT8_C(  31),  INT8_C(  88),  INT8_C( 122) },
+      {  INT8_C(   7), -INT8_C(  81), -INT8_C(  10),  INT8_C(  39),  INT8_C(  22),  INT8_C( 112),  INT8_C(  34), -INT8_C( 102),
+        -INT8_C( 125),  INT8_C(  96), -INT8_C(  38),  INT8_C( 118), -INT8_C( 114), -INT8_C(  35), -INT8_C(  42), -INT8_C(  59),
+         INT8_C(  60), -INT8_C(  58),  INT8_C(  99),  INT8_C(   0), -INT8_C(  20),  INT8_C(  92), -INT8_C(  67),  INT8_C(  62),
+         INT8_C(  30), -INT8_C(  32), -INT8_C(  48), -INT8_C(  81), -INT8_C(  10), -INT8_C(  13), -INT8_C(  16),  INT8_C(  74),
+         INT8_C(  96),  INT8_C(  76), -INT8_C(  75),  INT8_C(  90),  INT8_C(  53),  INT8_C(  27),  INT8_C(  16), -INT8_C(  52),
+        -INT8_C(  55), -INT8_C(  31),  INT8_C( 119),  INT8_C(  31),  INT8_C(  77), -INT8_C(   9),  INT8_C(  14),  INT8_C(  74),
+         INT8_C(  12),  INT8_C( 104),  INT8_C( 118),  INT8_C( 100), -INT8_C(  42), -INT8_C(  75), -INT8_C(  23), -INT8_C(  80),
+        -INT8_C(  85), -INT8_C(  96),  INT8_C(  91),  INT8_C(  68),  INT8_C( 108), -INT8_C(  30), -INT8_C(  55),  INT8_C( 100) } },
+    { { -INT8_C(  80), -INT8_C( 101),  INT8_C(   8),  INT8_C(  20),  INT8_C(  82),  INT8_C(  96),  INT8_C(  40), -INT8_C(  18),
+        -INT8_C( 117),  INT8_C(  36), -INT8_C(  78),  INT8_C( 121),  INT8_C(  47),  INT8_C(   5),  INT8_C(  35), -INT8_C( 107),
+         INT8_C(  22),  INT8_C(  32), -INT8_C( 104), -INT8_C(   3), -INT8_C(   2), -INT8_C(  63), -INT8_C(  18), -INT8_C(  45),
+        -INT8_C(  84),  INT8_C( 127),  INT8_C(  51), -INT8_C(  95),  INT8_C(  96),  INT8_C(  66), -INT8_C( 116), -INT8_C(  13),
+         INT8_C( 100), -INT8_C(  96),  INT8_C(  83),  INT8_C(  81), -INT8_C( 115), -INT8_C(  74), -INT8_C(  11), -INT8_C(   2),
+         INT8_C( 109), -INT8_C(  97), -INT8_C(  82),  INT8_C(  79),  INT8_C(  57),  INT8_C(  23),  INT8_C(  37),  INT8_C(  51),
+         INT8_C(   5),  INT8_C( 109), -INT8_C(  67),  INT8_C(   6), -INT8_C(  70),  INT8_C(  63), -INT8_C(  31), -INT8_C(  84),
+         INT8_C(  87), -INT8_C(  71), -INT8_C(  36), -INT8_C(  23),      INT8_MIN,  INT8_C(  89),  INT8_C(   3),  INT8_C(  91) },
+      UINT64_C(13767149109991691288),
+      { -INT8_C(  63), -INT8_C(  16),  INT8_C(  97), -INT8_C(  25),  INT8_C(  58), -INT8_C(  96),  INT8_C(  35), -INT8_C( 117),
+        -INT8_C( 118), -INT8_C(  61),  INT8_C(  64), -INT8_C(  14), -INT8_C( 103), -INT8_C( 108), -INT8_C(  79),  INT8_C(  56),
+        -INT8_C( 106),  INT8_C(  11), -INT8_C(  63), -INT8_C(  98),  INT8_C(  21),  INT8_C(   1),  INT8_C(  63), -INT8_C(  51),
+        -INT8_C(   8),  INT8_C(  47),  INT8_C( 127),  INT8_C( 103),  INT8_C( 121), -INT8_C(  73), -INT8_C(  52), -INT8_C(  35),
+         INT8_C(  94),  INT8_C(  16),  INT8_C(   8), -INT8_C( 120), -INT8_C( 125), -INT8_C( 100), -INT8_C(  15), -INT8_C(  50),
+        -INT8_C( 109), -INT8_C(  56),  INT8_C(  15),  INT8_C(  31),  INT8_C(  35),  INT8_C( 125), -INT8_C(  39),      INT8_MIN,
+        -INT8_C( 107), -INT8_C(   4), -INT8_C(  33),  INT8_C(  96),  INT8_C( 106), -INT8_C(  68),  INT8_C(  35), -INT8_C(  69),
+        -INT8_C(  72), -INT8_C(  93), -INT8_C( 108),  INT8_C(  43), -INT8_C(  79),  INT8_C(  90), -INT8_C(  48),  INT8_C(   9) },
+      { -INT8_C(  80), -INT8_C( 101),  INT8_C(   8), -INT8_C(  63), -INT8_C(  16),  INT8_C(  96),  INT8_C(  40), -INT8_C(  18),
+        -INT8_C( 117),  INT8_C(  36),  INT8_C(  97),  INT8_C( 121), -INT8_C(  25),  INT8_C(   5),  INT8_C(  58), -INT8_C(  96),
+         INT8_C(  35), -INT8_C( 117), -INT8_C( 104), -INT8_C(   3), -INT8_C(   2), -INT8_C( 118), -INT8_C(  61),  INT8_C(  64),
+        -INT8_C(  84), -INT8_C(  14), -INT8_C( 103), -INT8_C( 108),  INT8_C(  96),  INT8_C(  66), -INT8_C( 116), -INT8_C(  79),
+         INT8_C( 100), -INT8_C(  96),  INT8_C(  56), -INT8_C( 106), -INT8_C( 115),  INT8_C(  11), -INT8_C(  11), -INT8_C(   2),
+        -INT8_C(  63), -INT8_C(  97), -INT8_C(  98),  INT8_C(  21),  INT8_C(   1),  INT8_C(  63),  INT8_C(  37), -INT8_C(  51),
+         INT8_C(   5), -INT8_C(   8),  INT8_C(  47),  INT8_C( 127), -INT8_C(  70),  INT8_C(  63), -INT8_C(  31), -INT8_C(  84),
+         INT8_C( 103),  INT8_C( 121), -INT8_C(  73), -INT8_C(  52), -INT8_C(  35),  INT8_C(  94),  INT8_C(   3),  INT8_C(  16) } },
+    { { -INT8_C(  15), -INT8_C( 116), -INT8_C( 111),  INT8_C(  46),  INT8_C(  36),  INT8_C( 110), -INT8_C(  96), -INT8_C( 115),
+        -INT8_C( 120),  INT8_C(  49),  INT8_C(  83), -INT8_C( 125), -INT8_C(  34),  INT8_C( 101),  INT8_C(  79), -INT8_C(  61),
+        -INT8_C(  18), -INT8_C(  57),  INT8_C(  20),  INT8_C(  80),  INT8_C(  10),  INT8_C( 110), -INT8_C(  82),  INT8_C(  13),
+        -INT8_C(  11),  INT8_C(  30),  INT8_C( 126),  INT8_C(  42), -INT8_C(  78),  INT8_C( 115), -INT8_C( 119),  INT8_C(  36),
+        -INT8_C(  68), -INT8_C( 127),  INT8_C(  44), -INT8_C(  44),  INT8_C(  81), -INT8_C(  13),  INT8_C(  58), -INT8_C(  80),
+         INT8_C( 107),  INT8_C(  43),  INT8_C(  63),  INT8_C(  73),  INT8_C(  27),  INT8_C( 105),  INT8_C( 109), -INT8_C( 107),
+        -INT8_C(  18), -INT8_C(  37), -INT8_C(  92), -INT8_C(  17),  INT8_C(  60),  INT8_C(  36), -INT8_C(  92), -INT8_C(   3),
+         INT8_C(  64),  INT8_C(  24),  INT8_C(  42),  INT8_C(   2),  INT8_C(  54), -INT8_C(  94), -INT8_C(  57), -INT8_C( 118) },
+      UINT64_C(15425793642966888303),
+      { -INT8_C(  23),  INT8_C(   4), -INT8_C(  40), -INT8_C( 125),  INT8_C(  18),  INT8_C(  32), -INT8_C(  54),  INT8_C(  73),
+        -INT8_C(  57), -INT8_C(  72), -INT8_C( 113), -INT8_C(  78), -INT8_C(   1),  INT8_C(  20),  INT8_C( 116),  INT8_C(  10),
+         INT8_C(  68), -INT8_C(   2),  INT8_C(  75), -INT8_C( 117), -INT8_C(  68), -INT8_C(  73), -INT8_C(  40),  INT8_C(  89),
+         INT8_C(  87), -INT8_C(  33),  INT8_C(   4), -INT8_C( 104), -INT8_C(  61), -INT8_C(  94),  INT8_C(  67),  INT8_C(   7),
+        -INT8_C(  47), -INT8_C(  18), -INT8_C( 105), -INT8_C(  14),  INT8_C( 125),  INT8_C( 115),  INT8_C(  41),  INT8_C(   1),
+        -INT8_C(  21),  INT8_C(  66),  INT8_C(  66), -INT8_C(  46),  INT8_C(  19),  INT8_C(  83),  INT8_C(  75), -INT8_C(  95),
+         INT8_C(  80),  INT8_C(  64),  INT8_C(  10), -INT8_C(  40),  INT8_C(  75),  INT8_C(  55), -INT8_C(  83),  INT8_C(  62),
+        -INT8_C( 122),  INT8_C( 105), -INT8_C(  19),  INT8_C( 126), -INT8_C(  98),  INT8_C(  87), -INT8_C(  63), -INT8_C(  38) },
+      { -INT8_C(  23),  INT8_C(   4), -INT8_C(  40), -INT8_C( 125),  INT8_C(  36),  INT8_C(  18),  INT8_C(  32), -INT8_C( 115),
+        -INT8_C(  54),  INT8_C(  73), -INT8_C(  57), -INT8_C(  72), -INT8_C(  34), -INT8_C( 113),  INT8_C(  79), -INT8_C(  61),
+        -INT8_C(  78), -INT8_C(  57), -INT8_C(   1),  INT8_C(  80),  INT8_C(  10),  INT8_C( 110), -INT8_C(  82),  INT8_C(  20),
+         INT8_C( 116),  INT8_C(  10),  INT8_C( 126),  INT8_C(  42), -INT8_C(  78),  INT8_C( 115),  INT8_C(  68), -INT8_C(   2),
+        -INT8_C(  68),  INT8_C(  75), -INT8_C( 117), -INT8_C(  44), -INT8_C(  68), -INT8_C(  13),  INT8_C(  58), -INT8_C(  73),
+        -INT8_C(  40),  INT8_C(  43),  INT8_C(  89),  INT8_C(  87),  INT8_C(  27), -INT8_C(  33),  INT8_C(   4), -INT8_C( 107),
+        -INT8_C( 104), -INT8_C(  61), -INT8_C(  92), -INT8_C(  17), -INT8_C(  94),  INT8_C(  36), -INT8_C(  92), -INT8_C(   3),
+         INT8_C(  64),  INT8_C(  67),  INT8_C(   7),  INT8_C(   2), -INT8_C(  47), -INT8_C(  94), -INT8_C(  18), -INT8_C( 105) } },
+    { {  INT8_C(  60), -INT8_C(   6), -INT8_C(  13),  INT8_C( 112),  INT8_C(  16),  INT8_C(  58),  INT8_C(  14),  INT8_C(   0),
+         INT8_C(  68),  INT8_C(  86), -INT8_C(  26), -INT8_C(  51),  INT8_C( 116),  INT8_C(  54), -INT8_C(  58), -INT8_C(  15),
+         INT8_C(  66),  INT8_C(  96),  INT8_C(   8),  INT8_C( 112),  INT8_C(  70),  INT8_C(  84), -INT8_C(  74),  INT8_C(  79),
+         INT8_C(   9), -INT8_C( 125), -INT8_C(  44), -INT8_C(  95),  INT8_C(  34), -INT8_C(  84),  INT8_C( 117),  INT8_C(  97),
+         INT8_C(  71),  INT8_C(  33), -INT8_C( 127),  INT8_C(  78),  INT8_C(  64), -INT8_C(  94), -INT8_C( 101), -INT8_C(  52),
+        -INT8_C(  17),  INT8_C(  80), -INT8_C(  82),  INT8_C(  77),  INT8_C( 119),  INT8_C(  25),  INT8_C( 121), -INT8_C(  19),
+        -INT8_C(   2),  INT8_C(  39), -INT8_C(  77),  INT8_C(  22),  INT8_C( 120),  INT8_C( 122), -INT8_C(  34), -INT8_C(  91),
+         INT8_C( 114),  INT8_C(   8), -INT8_C(  88),  INT8_C(  61), -INT8_C(  75), -INT8_C(  46),  INT8_C(  69), -INT8_C( 127) },
+      UINT64_C( 6824792937946425267),
+      {  INT8_C(  34), -INT8_C(  36), -INT8_C(  23),  INT8_C( 112),  INT8_C(  94),  INT8_C( 118), -INT8_C(  22), -INT8_C(  31),
+        -INT8_C(  54),  INT8_C(  83), -INT8_C(  69),  INT8_C( 114), -INT8_C(  36), -INT8_C(  61),  INT8_C( 106), -INT8_C(   6),
+        -INT8_C(  65), -INT8_C(   2), -INT8_C( 121), -INT8_C(  94),  INT8_C(  63), -INT8_C(  21),  INT8_C( 116),  INT8_C(  64),
+        -INT8_C(  96), -INT8_C( 125),  INT8_C( 116),  INT8_C(  12), -INT8_C(  48),  INT8_C(  73), -INT8_C(  71),  INT8_C(  82),
+        -INT8_C(  90), -INT8_C(  63),  INT8_C(  98),  INT8_C( 122),  INT8_C(  40),  INT8_C(  78), -INT8_C(  24), -INT8_C(  23),
+        -INT8_C(  96),  INT8_C( 123),  INT8_C(  29), -INT8_C( 117),  INT8_C(   2),  INT8_C( 114), -INT8_C(  10), -INT8_C(  55),
+         INT8_C( 114),  INT8_C( 108), -INT8_C(  28), -INT8_C(   7), -INT8_C(  70),  INT8_C(  95), -INT8_C( 109), -INT8_C( 116),
+         INT8_C(  31),  INT8_C(  47),  INT8_C(  19), -INT8_C(  19),  INT8_C(  26), -INT8_C(  58),  INT8_C(   7), -INT8_C( 115) },
+      {  INT8_C(  34), -INT8_C(  36), -INT8_C(  13),  INT8_C( 112), -INT8_C(  23),  INT8_C( 112),  INT8_C(  14),  INT8_C(  94),
+         INT8_C( 118), -INT8_C(  22), -INT8_C(  31), -INT8_C(  51),  INT8_C( 116), -INT8_C(  54), -INT8_C(  58), -INT8_C(  15),
+         INT8_C(  66),  INT8_C(  96),  INT8_C(  83),  INT8_C( 112),  INT8_C(  70), -INT8_C(  69),  INT8_C( 114), -INT8_C(  36),
+        -INT8_C(  61),  INT8_C( 106), -INT8_C(  44), -INT8_C(   6),  INT8_C(  34), -INT8_C(  84),  INT8_C( 117), -INT8_C(  65),
+         INT8_C(  71),  INT8_C(  33), -INT8_C(   2),  INT8_C(  78),  INT8_C(  64), -INT8_C(  94), -INT8_C( 101), -INT8_C(  52),
+        -INT8_C( 121),  INT8_C(  80), -INT8_C(  82), -INT8_C(  94),  INT8_C( 119),  INT8_C(  25),  INT8_C( 121),  INT8_C(  63),
+        -INT8_C(   2), -INT8_C(  21),  INT8_C( 116),  INT8_C(  22),  INT8_C(  64), -INT8_C(  96), -INT8_C(  34), -INT8_C( 125),
+         INT8_C( 114),  INT8_C( 116),  INT8_C(  12), -INT8_C(  48),  INT8_C(  73), -INT8_C(  46), -INT8_C(  71), -INT8_C( 127) } },
+    { {  INT8_C( 125),  INT8_C(  15),  INT8_C( 111), -INT8_C(  69), -INT8_C(  14), -INT8_C(  95), -INT8_C(  30), -INT8_C(  31),
+        -INT8_C(  12), -INT8_C(   9), -INT8_C( 116),  INT8_C(   9), -INT8_C( 103),  INT8_C( 108), -INT8_C(  46),  INT8_C(  81),
+        -INT8_C(  91), -INT8_C( 106),  INT8_C(  63),  INT8_C(  47),  INT8_C(  89),  INT8_C(  53),  INT8_C(  55),  INT8_C( 115),
+        -INT8_C(  69),  INT8_C( 106),  INT8_C(  40), -INT8_C(  88),  INT8_C(   7),  INT8_C(  17), -INT8_C( 107), -INT8_C(  20),
+         INT8_C( 123), -INT8_C(  55),  INT8_C(  38),  INT8_C(  14),  INT8_C(   0),  INT8_C( 100),  INT8_C( 104),  INT8_C(  26),
+        -INT8_C(  78), -INT8_C(  65),  INT8_C(  24),  INT8_C(  72),  INT8_C( 114), -INT8_C(  60),  INT8_C(  45), -INT8_C( 125),
+         INT8_C(   2), -INT8_C( 112),  INT8_C(  47), -INT8_C(  79), -INT8_C(  94),  INT8_C( 121),  INT8_C(  65),  INT8_C(  27),
+        -INT8_C( 125),  INT8_C(  92),  INT8_C(  48), -INT8_C(  92), -INT8_C(  69),  INT8_C( 120),  INT8_C( 112),  INT8_C(  42) },
+      UINT64_C(17182975847709745090),
+      { -INT8_C( 108), -INT8_C(  65),  INT8_C(  56), -INT8_C(  24),  INT8_C(  51), -INT8_C( 107),  INT8_C( 106),  INT8_C(   4),
+         INT8_C(  58), -INT8_C(  12),  INT8_C(  87), -INT8_C(  53),  INT8_C(  68),  INT8_C( 100), -INT8_C( 114),  INT8_C(   5),
+         INT8_C( 125), -INT8_C(  25), -INT8_C(  70), -INT8_C(  63), -INT8_C(  56), -INT8_C(  85),  INT8_C(  14),  INT8_C( 118),
+        -INT8_C(  38), -INT8_C(  25),  INT8_C(   6),  INT8_C( 116), -INT8_C(  30),  INT8_C(  47), -INT8_C(  13), -INT8_C( 106),
+        -INT8_C(  95),  INT8_C(  74), -INT8_C(  62), -INT8_C(  67),  INT8_C(  72), -INT8_C(  64),  INT8_C( 103), -INT8_C(  51),
+         INT8_C(   6),  INT8_C(  42),  INT8_C(  82), -INT8_C(  98),  INT8_C(  51),  INT8_C(  11),  INT8_C(  13), -INT8_C(  81),
+         INT8_C(  66), -INT8_C(  62),  INT8_C(  61),  INT8_C(  61),  INT8_C(  89),  INT8_C(  71), -INT8_C(  97),  INT8_C(  84),
+        -INT8_C(  34),  INT8_C(  93),  INT8_C(  99),  INT8_C(  39),  INT8_C(  85), -INT8_C(   9), -INT8_C(  80),  INT8_C(  47) },
+      {  INT8_C( 125), -INT8_C( 108),  INT8_C( 111), -INT8_C(  69), -INT8_C(  14), -INT8_C(  95), -INT8_C(  65),  INT8_C(  56),
+        -INT8_C(  24),  INT8_C(  51), -INT8_C( 107),  INT8_C( 106),  INT8_C(   4),  INT8_C( 108), -INT8_C(  46),  INT8_C(  81),
+         INT8_C(  58), -INT8_C(  12),  INT8_C(  63),  INT8_C(  87), -INT8_C(  53),  INT8_C(  53),  INT8_C(  68),  INT8_C( 100),
+        -INT8_C(  69), -INT8_C( 114),  INT8_C(  40), -INT8_C(  88),  INT8_C(   7),  INT8_C(  17), -INT8_C( 107),  INT8_C(   5),
+         INT8_C( 123),  INT8_C( 125), -INT8_C(  25), -INT8_C(  70), -INT8_C(  63), -INT8_C(  56), -INT8_C(  85),  INT8_C(  26),
+         INT8_C(  14), -INT8_C(  65),  INT8_C(  24),  INT8_C(  72),  INT8_C( 118), -INT8_C(  38),  INT8_C(  45), -INT8_C( 125),
+         INT8_C(   2), -INT8_C(  25),  INT8_C(   6), -INT8_C(  79),  INT8_C( 116), -INT8_C(  30),  INT8_C(  47),  INT8_C(  27),
+        -INT8_C( 125), -INT8_C(  13), -INT8_C( 106), -INT8_C(  95), -INT8_C(  69),  INT8_C(  74), -INT8_C(  62), -INT8_C(  67) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi8(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_expand_epi8(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_expand_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[32];
+    const simde__mmask32 k;
+    const int16_t a[32];
+    const int16_t r[32];
+  } test_vec[] = {
+    { { -INT16_C( 13776),  INT16_C( 28965),  INT16_C(   681),  INT16_C(  3588),  INT16_C( 24076), -INT16_C( 28242),  INT16_C( 17846),  INT16_C( 13493),
+         INT16_C( 17804),  INT16_C( 21371), -INT16_C(   161),  INT16_C( 13224), -INT16_C(  2769),  INT16_C(  4500), -INT16_C( 14653),  INT16_C(   737),
+         INT16_C( 29150),  INT16_C( 31995), -INT16_C( 17940), -INT16_C( 27026),  INT16_C( 12131), -INT16_C( 17761),  INT16_C(  1263),  INT16_C( 20022),
+         INT16_C(  5206), -INT16_C( 22112),  INT16_C(  8624),  INT16_C(  4377), -INT16_C(  7543), -INT16_C( 17197),  INT16_C( 17555),  INT16_C( 32222) },
+      UINT32_C(         0),
+      {  INT16_C( 17603),  INT16_C( 10156), -INT16_C( 31973),  INT16_C( 12398), -INT16_C( 16770), -INT16_C(  8433), -INT16_C( 11190), -INT16_C( 21859),
+         INT16_C( 22787), -INT16_C( 24439),  INT16_C( 16053), -INT16_C(  7066),  INT16_C( 26753), -INT16_C(   512), -INT16_C( 31979),  INT16_C(  8208),
+         INT16_C( 15392), -INT16_C( 28134),  INT16_C( 27955), -INT16_C( 18205), -INT16_C(  5389), -INT16_C( 22849),  INT16_C( 24945), -INT16_C( 18261),
+         INT16_C( 17727), -INT16_C( 19683), -INT16_C(  2542),  INT16_C(   695), -INT16_C( 20900),  INT16_C(  8491),  INT16_C(  2423),  INT16_C(  5409) },
+      { -INT16_C( 13776),  INT16_C( 28965),  INT16_C(   681),  INT16_C(  3588),  INT16_C( 24076), -INT16_C( 28242),  INT16_C( 17846),  INT16_C( 13493),
+         INT16_C( 17804),  INT16_C( 21371), -INT16_C(   161),  INT16_C( 13224), -INT16_C(  2769),  INT16_C(  4500), -INT16_C( 14653),  INT16_C(   737),
+         INT16_C( 29150),  INT16_C( 31995), -INT16_C( 17940), -INT16_C( 27026),  INT16_C( 12131), -INT16_C( 17761),  INT16_C(  1263),  INT16_C( 20022),
+         INT16_C(  5206), -INT16_C( 22112),  INT16_C(  8624),  INT16_C(  4377), -INT16_C(  7543), -INT16_C( 17197),  INT16_C( 17555),  INT16_C( 32222) } },
+    { {  INT16_C( 22000),  INT16_C( 14475), -INT16_C( 22004),  INT16_C( 13675), -INT16_C( 26909),  INT16_C(  6915), -INT16_C(  2313),  INT16_C( 22367),
+         INT16_C( 26365), -INT16_C(  4094),  INT16_C(  6295), -INT16_C(  7788), -INT16_C( 13398), -INT16_C( 17928),  INT16_C(  4046),  INT16_C( 15515),
+         INT16_C( 28548), -INT16_C(   193), -INT16_C(  1552),  INT16_C( 31266),  INT16_C( 20486),  INT16_C( 27218),  INT16_C( 29280),  INT16_C(  7710),
+         INT16_C( 27724),  INT16_C( 28726),  INT16_C( 16922), -INT16_C( 10118),  INT16_C( 19617),  INT16_C( 11720),  INT16_C(  2869),  INT16_C(  8017) },
+      UINT32_C(4294967295),
+      { -INT16_C( 16247),  INT16_C( 24355), -INT16_C(  6787),  INT16_C( 20974),  INT16_C( 31445), -INT16_C( 16914), -INT16_C(  4012),  INT16_C( 12641),
+        -INT16_C( 10475), -INT16_C( 31208),  INT16_C( 31927),  INT16_C( 28752), -INT16_C(  7644),  INT16_C( 27825), -INT16_C(  9328),  INT16_C(   596),
+        -INT16_C( 22096), -INT16_C( 26630),  INT16_C( 31294),  INT16_C(  9302),  INT16_C( 31824),  INT16_C( 23576), -INT16_C( 18512),  INT16_C(  1568),
+         INT16_C(  9850), -INT16_C( 24562), -INT16_C( 32471),  INT16_C( 16484),  INT16_C( 11204), -INT16_C(  2759),  INT16_C( 16782),  INT16_C( 13553) },
+      { -INT16_C( 16247),  INT16_C( 24355), -INT16_C(  6787),  INT16_C( 20974),  INT16_C( 31445), -INT16_C( 16914), -INT16_C(  4012),  INT16_C( 12641),
+        -INT16_C( 10475), -INT16_C( 31208),  INT16_C( 31927),  INT16_C( 28752), -INT16_C(  7644),  INT16_C( 27825), -INT16_C(  9328),  INT16_C(   596),
+        -INT16_C( 22096), -INT16_C( 26630),  INT16_C( 31294),  INT16_C(  9302),  INT16_C( 31824),  INT16_C( 23576), -INT16_C( 18512),  INT16_C(  1568),
+         INT16_C(  9850), -INT16_C( 24562), -INT16_C( 32471),  INT16_C( 16484),  INT16_C( 11204), -INT16_C(  2759),  INT16_C( 16782),  INT16_C( 13553) } },
+    { {  INT16_C( 24705), -INT16_C(  9856),  INT16_C(  5754), -INT16_C( 24576),  INT16_C( 15177),  INT16_C( 15539),  INT16_C(  4586),  INT16_C( 15631),
+         INT16_C(  1691), -INT16_C(     2),  INT16_C( 14222),  INT16_C( 19211), -INT16_C(  6365),  INT16_C( 12202), -INT16_C( 20659),  INT16_C( 28692),
+         INT16_C( 32152), -INT16_C( 15061),  INT16_C( 16466),  INT16_C( 10116),  INT16_C( 16525), -INT16_C( 31718),  INT16_C( 16139),  INT16_C(  9053),
+         INT16_C( 17087),  INT16_C( 23160), -INT16_C( 17380), -INT16_C( 14701),  INT16_C( 19711), -INT16_C( 27114),  INT16_C( 21761), -INT16_C( 21347) },
+      UINT32_C( 475186765),
+      {  INT16_C( 26811),  INT16_C( 10276),  INT16_C(  3066), -INT16_C( 16095),  INT16_C( 23096), -INT16_C( 11374),  INT16_C( 18484),  INT16_C(  2456),
+        -INT16_C( 19283),  INT16_C( 32459), -INT16_C( 20586), -INT16_C(  2672),  INT16_C(  6530),  INT16_C(  9489), -INT16_C( 19685),  INT16_C(  6046),
+        -INT16_C( 27881),  INT16_C( 15380), -INT16_C( 22428),  INT16_C(  5891),  INT16_C( 20295), -INT16_C(  9067),  INT16_C( 28343), -INT16_C( 29802),
+        -INT16_C(  7768),  INT16_C(  2516),  INT16_C( 24899), -INT16_C( 19235), -INT16_C( 27849), -INT16_C( 14898), -INT16_C(  6246),  INT16_C( 31782) },
+      {  INT16_C( 26811), -INT16_C(  9856),  INT16_C( 10276),  INT16_C(  3066),  INT16_C( 15177),  INT16_C( 15539), -INT16_C( 16095),  INT16_C( 15631),
+         INT16_C(  1691),  INT16_C( 23096), -INT16_C( 11374),  INT16_C( 19211), -INT16_C(  6365),  INT16_C( 12202),  INT16_C( 18484),  INT16_C(  2456),
+         INT16_C( 32152), -INT16_C( 19283),  INT16_C( 16466),  INT16_C( 10116),  INT16_C( 32459), -INT16_C( 31718), -INT16_C( 20586),  INT16_C(  9053),
+         INT16_C( 17087),  INT16_C( 23160), -INT16_C(  2672),  INT16_C(  6530),  INT16_C(  9489), -INT16_C( 27114),  INT16_C( 21761), -INT16_C( 21347) } },
+    { {  INT16_C(  8224),  INT16_C( 10258), -INT16_C( 32240),  INT16_C( 32449),  INT16_C(    12), -INT16_C( 24032), -INT16_C( 11431), -INT16_C( 19334),
+         INT16_C( 21133), -INT16_C(  6068),  INT16_C( 10393),  INT16_C( 27536), -INT16_C(  3371),  INT16_C( 19641),  INT16_C( 23452), -INT16_C( 32073),
+        -INT16_C( 11037),  INT16_C(  9931), -INT16_C(  4206), -INT16_C(  9250), -INT16_C( 15860),  INT16_C( 28931), -INT16_C( 12657),  INT16_C( 24917),
+         INT16_C( 24381),  INT16_C( 12957),  INT16_C(  4148), -INT16_C(  5126),  INT16_C( 32700), -INT16_C(  2221),  INT16_C(  4658),  INT16_C(  4992) },
+      UINT32_C(2105440401),
+      {  INT16_C( 25441),  INT16_C( 15175), -INT16_C( 22705), -INT16_C(  9188), -INT16_C( 23795),  INT16_C( 10134), -INT16_C( 18215),  INT16_C(  4753),
+         INT16_C( 10280),  INT16_C( 20042), -INT16_C( 16902), -INT16_C( 20878),  INT16_C(  7987), -INT16_C( 15517), -INT16_C( 17888), -INT16_C( 19639),
+         INT16_C( 12842), -INT16_C( 15464),  INT16_C( 20424), -INT16_C( 30511),  INT16_C( 12005), -INT16_C( 22478),  INT16_C( 20741), -INT16_C( 17651),
+        -INT16_C( 15266),  INT16_C( 31979), -INT16_C( 12214),  INT16_C( 22907), -INT16_C( 24411), -INT16_C( 24791),  INT16_C(   392), -INT16_C( 28433) },
+      {  INT16_C( 25441),  INT16_C( 10258), -INT16_C( 32240),  INT16_C( 32449),  INT16_C( 15175), -INT16_C( 24032), -INT16_C( 11431), -INT16_C( 22705),
+         INT16_C( 21133), -INT16_C(  6068),  INT16_C( 10393), -INT16_C(  9188), -INT16_C( 23795),  INT16_C( 10134), -INT16_C( 18215), -INT16_C( 32073),
+        -INT16_C( 11037),  INT16_C(  4753),  INT16_C( 10280),  INT16_C( 20042), -INT16_C( 16902), -INT16_C( 20878),  INT16_C(  7987),  INT16_C( 24917),
+        -INT16_C( 15517),  INT16_C( 12957), -INT16_C( 17888), -INT16_C( 19639),  INT16_C( 12842), -INT16_C( 15464),  INT16_C( 20424),  INT16_C(  4992) } },
+    { {  INT16_C( 24817), -INT16_C(  3014),  INT16_C( 29889), -INT16_C( 32660),  INT16_C( 27431),  INT16_C(  7919), -INT16_C(  8820),  INT16_C( 32352),
+        -INT16_C( 27158),  INT16_C( 22474), -INT16_C( 16577),  INT16_C( 12190), -INT16_C(  2803),  INT16_C( 21092), -INT16_C( 29706),  INT16_C( 24588),
+         INT16_C( 29678),  INT16_C( 31061), -INT16_C( 13061),  INT16_C( 24395), -INT16_C( 19585),  INT16_C(  3516), -INT16_C( 24343), -INT16_C( 32603),
+         INT16_C(  7009),  INT16_C( 15743),  INT16_C( 30497),  INT16_C( 24425), -INT16_C( 26889), -INT16_C( 29379),  INT16_C( 16768), -INT16_C( 13143) },
+      UINT32_C(1903304880),
+      { -INT16_C( 17121), -INT16_C(  3996),  INT16_C( 28023),  INT16_C( 23285),  INT16_C( 13340), -INT16_C(  3676),  INT16_C( 16774), -INT16_C( 10911),
+        -INT16_C( 10804),  INT16_C( 20956),  INT16_C( 29501), -INT16_C(  1251), -INT16_C( 17392), -INT16_C(  6953),  INT16_C( 22839),  INT16_C( 14527),
+        -INT16_C( 22614),  INT16_C(  2080),  INT16_C( 11324),  INT16_C( 31656), -INT16_C(  5365), -INT16_C(  2578), -INT16_C(  7200),  INT16_C( 17014),
+         INT16_C( 16496),  INT16_C( 29108), -INT16_C( 29879), -INT16_C(  7646),  INT16_C( 25327),  INT16_C(  9122), -INT16_C( 32459), -INT16_C( 30748) },
+      {  INT16_C( 24817), -INT16_C(  3014),  INT16_C( 29889), -INT16_C( 32660), -INT16_C( 17121), -INT16_C(  3996), -INT16_C(  8820),  INT16_C( 28023),
+        -INT16_C( 27158),  INT16_C( 22474), -INT16_C( 16577),  INT16_C( 12190), -INT16_C(  2803),  INT16_C( 23285), -INT16_C( 29706),  INT16_C( 24588),
+         INT16_C( 29678),  INT16_C( 13340), -INT16_C( 13061),  INT16_C( 24395), -INT16_C(  3676),  INT16_C( 16774), -INT16_C( 10911), -INT16_C( 32603),
+        -INT16_C( 10804),  INT16_C( 15743),  INT16_C( 30497),  INT16_C( 24425),  INT16_C( 20956),  INT16_C( 29501), -INT16_C(  1251), -INT16_C( 13143) } },
+    { {  INT16_C(  9246),  INT16_C( 13910), -INT16_C(  6762), -INT16_C( 24038), -INT16_C(  7531),  INT16_C(   139), -INT16_C( 26716),  INT16_C( 18404),
+         INT16_C( 23387),  INT16_C( 10993),  INT16_C( 30810), -INT16_C(  1972),  INT16_C( 15063),  INT16_C( 27658),  INT16_C(  6036), -INT16_C( 19109),
+        -INT16_C( 26166),  INT16_C(  8824), -INT16_C( 30108), -INT16_C(  1387),  INT16_C( 18711),  INT16_C(  4779), -INT16_C( 18850), -INT16_C(  9407),
+        -INT16_C(  8118), -INT16_C(  1819),  INT16_C(  1735),  INT16_C( 25712), -INT16_C(  9794), -INT16_C( 14964), -INT16_C(  7188),  INT16_C( 24454) },
+      UINT32_C(2987002632),
+      {  INT16_C( 15707),  INT16_C(  7433), -INT16_C(   291), -INT16_C( 26821), -INT16_C(  7160), -INT16_C( 18787),  INT16_C( 17661),  INT16_C(   544),
+         INT16_C( 11208),  INT16_C( 31945),  INT16_C(  8284), -INT16_C( 21542),  INT16_C(  8288),  INT16_C( 16448), -INT16_C(  3564),  INT16_C( 25243),
+        -INT16_C( 15902), -INT16_C( 14870), -INT16_C( 22048), -INT16_C( 25610), -INT16_C( 19030),  INT16_C( 19916),  INT16_C( 32011),  INT16_C( 26809),
+         INT16_C( 13870),  INT16_C( 30268),  INT16_C( 10168), -INT16_C( 30375), -INT16_C( 27018),  INT16_C( 17229),  INT16_C( 19215), -INT16_C( 31903) },
+      {  INT16_C(  9246),  INT16_C( 13910), -INT16_C(  6762),  INT16_C( 15707), -INT16_C(  7531),  INT16_C(   139), -INT16_C( 26716),  INT16_C( 18404),
+         INT16_C(  7433), -INT16_C(   291),  INT16_C( 30810), -INT16_C( 26821),  INT16_C( 15063),  INT16_C( 27658),  INT16_C(  6036), -INT16_C( 19109),
+        -INT16_C( 26166), -INT16_C(  7160), -INT16_C( 30108), -INT16_C( 18787),  INT16_C( 18711),  INT16_C(  4779), -INT16_C( 18850), -INT16_C(  9407),
+        -INT16_C(  8118),  INT16_C( 17661),  INT16_C(  1735),  INT16_C( 25712),  INT16_C(   544),  INT16_C( 11208), -INT16_C(  7188),  INT16_C( 31945) } },
+    { {  INT16_C( 12949), -INT16_C(  5706),  INT16_C( 32322),  INT16_C( 22476),  INT16_C( 15571),  INT16_C(  4564), -INT16_C( 24337),  INT16_C( 13989),
+         INT16_C(  6090),  INT16_C( 29877),  INT16_C( 12204),  INT16_C(  1165), -INT16_C(  1106),  INT16_C( 10352), -INT16_C(  8076),  INT16_C( 26885),
+        -INT16_C( 13633), -INT16_C( 32035), -INT16_C( 18265), -INT16_C(  1827),  INT16_C( 31937), -INT16_C(  1118),  INT16_C( 26020),  INT16_C( 23237),
+        -INT16_C(   126),  INT16_C( 21428), -INT16_C( 21171),  INT16_C( 17850), -INT16_C(  9083),  INT16_C(  3839),  INT16_C( 27052),  INT16_C( 30863) },
+      UINT32_C(2549430075),
+      { -INT16_C( 23540), -INT16_C(  1319), -INT16_C( 14719),  INT16_C(  5273), -INT16_C( 12180), -INT16_C( 19323),  INT16_C( 20307), -INT16_C( 13481),
+        -INT16_C(  8126),  INT16_C( 29935),  INT16_C( 27646), -INT16_C(  6813),  INT16_C(   962), -INT16_C( 14705),  INT16_C( 17643), -INT16_C(  4520),
+         INT16_C( 14009),  INT16_C( 18984),  INT16_C(  7614),  INT16_C( 10443), -INT16_C( 14946),  INT16_C(  9816),  INT16_C( 30292), -INT16_C( 20914),
+        -INT16_C( 29915),  INT16_C(  6036),  INT16_C(  6801), -INT16_C( 11210), -INT16_C(  7463),  INT16_C(  1727),  INT16_C(  9802), -INT16_C( 19538) },
+      { -INT16_C( 23540), -INT16_C(  1319),  INT16_C( 32322), -INT16_C( 14719),  INT16_C(  5273), -INT16_C( 12180), -INT16_C( 24337),  INT16_C( 13989),
+        -INT16_C( 19323),  INT16_C( 20307), -INT16_C( 13481),  INT16_C(  1165), -INT16_C(  8126),  INT16_C( 29935), -INT16_C(  8076),  INT16_C( 26885),
+         INT16_C( 27646), -INT16_C( 32035), -INT16_C(  6813), -INT16_C(  1827),  INT16_C(   962), -INT16_C( 14705),  INT16_C( 17643), -INT16_C(  4520),
+         INT16_C( 14009),  INT16_C( 18984),  INT16_C(  7614),  INT16_C( 17850),  INT16_C( 10443),  INT16_C(  3839),  INT16_C( 27052), -INT16_C( 14946) } },
+    { {  INT16_C(  2472), -INT16_C( 31059), -INT16_C( 27989),  INT16_C( 25227),  INT16_C(  8144), -INT16_C( 28451),  INT16_C( 12139), -INT16_C( 25799),
+         INT16_C( 17880),  INT16_C( 30439), -INT16_C( 21106),  INT16_C(  3990),  INT16_C( 26855), -INT16_C( 30146), -INT16_C( 22177),  INT16_C(  2032),
+         INT16_C( 18139),  INT16_C( 15448), -INT16_C( 29222), -INT16_C(  4640), -INT16_C(  9280),  INT16_C( 20878),  INT16_C( 12649), -INT16_C( 23771),
+        -INT16_C(  7642), -INT16_C( 12999), -INT16_C( 18368), -INT16_C( 21641), -INT16_C(  6682), -INT16_C(  4170), -INT16_C( 25130), -INT16_C( 11156) },
+      UINT32_C(2641070394),
+      {  INT16_C( 31003), -INT16_C( 27519), -INT16_C( 32539),  INT16_C(  1875),  INT16_C(  2767), -INT16_C(  4576),  INT16_C( 20815),  INT16_C( 16515),
+         INT16_C(  3198), -INT16_C( 19924), -INT16_C(  6525),  INT16_C( 10991),  INT16_C( 26072), -INT16_C( 28425),  INT16_C(  8487),  INT16_C( 10493),
+         INT16_C( 27558), -INT16_C( 31091),  INT16_C( 24947), -INT16_C( 25305), -INT16_C( 22016), -INT16_C(  6467),  INT16_C( 20185), -INT16_C( 23640),
+         INT16_C( 29082),  INT16_C(  5967), -INT16_C( 23295), -INT16_C(  9282),  INT16_C( 31720), -INT16_C( 31001),  INT16_C( 14125), -INT16_C(  1809) },
+      {  INT16_C(  2472),  INT16_C( 31003), -INT16_C( 27989), -INT16_C( 27519), -INT16_C( 32539),  INT16_C(  1875),  INT16_C( 12139), -INT16_C( 25799),
+         INT16_C(  2767),  INT16_C( 30439), -INT16_C( 21106), -INT16_C(  4576),  INT16_C( 26855), -INT16_C( 30146), -INT16_C( 22177),  INT16_C( 20815),
+         INT16_C( 16515),  INT16_C(  3198), -INT16_C( 29222), -INT16_C( 19924), -INT16_C(  9280), -INT16_C(  6525),  INT16_C( 10991), -INT16_C( 23771),
+         INT16_C( 26072), -INT16_C( 12999), -INT16_C( 28425),  INT16_C(  8487),  INT16_C( 10493), -INT16_C(  4170), -INT16_C( 25130),  INT16_C( 27558) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi16(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_expand_epi16(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x32(r, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_expand_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_expand_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_expand_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_expand_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_expand_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_expand_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_expand_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_expand_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_expand_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_expand_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_expand_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_expand_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_expand_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_expand_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_expand_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_expand_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_expand_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_expand_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_expand_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_expand_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_expand_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_expand_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_expand_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_expand_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_expand_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_expand_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_expand_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_expand_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_expand_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_expand_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_expand_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_expand_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_expand_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_expand_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_expand_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_expand_epi16)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
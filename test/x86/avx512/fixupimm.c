@@ -0,0 +1,730 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+#define SIMDE_TEST_X86_AVX512_INSN fixupimm
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/fixupimm.h>
+
+static int
+test_simde_mm512_fixupimm_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[16];
+    const simde_float32 b[16];
+    const int32_t c[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  541.4000), SIMDE_FLOAT32_C( -489.0600), SIMDE_FLOAT32_C( -939.7700), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C( -928.9700), SIMDE_FLOAT32_C( -301.6900), SIMDE_FLOAT32_C(  712.2900), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(  909.8600), SIMDE_FLOAT32_C(  396.5000), SIMDE_FLOAT32_C( -452.2700), SIMDE_FLOAT32_C(   14.9600),
+        SIMDE_FLOAT32_C(  469.8300), SIMDE_FLOAT32_C(  -41.6500), SIMDE_FLOAT32_C(  757.7500), SIMDE_FLOAT32_C(  -43.6400) },
+      { SIMDE_FLOAT32_C( -736.0500), SIMDE_FLOAT32_C(  736.0200), SIMDE_FLOAT32_C(  587.9200), SIMDE_FLOAT32_C(  812.8600),
+        SIMDE_FLOAT32_C(   65.7400), SIMDE_FLOAT32_C(    0.0000),        SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C( -334.5700),
+        SIMDE_FLOAT32_C(  782.0200), SIMDE_FLOAT32_C(  456.0800), SIMDE_FLOAT32_C(  626.6800), SIMDE_FLOAT32_C(  559.1000),
+        SIMDE_FLOAT32_C( -986.4400), SIMDE_FLOAT32_C( -443.9500), SIMDE_FLOAT32_C(   37.6000), SIMDE_FLOAT32_C( -739.5000) },
+      { -INT32_C(   538683378), -INT32_C(  1980986456), -INT32_C(   694708168),  INT32_C(   420048719),  INT32_C(   199792441), -INT32_C(   546461485), -INT32_C(   956981724), -INT32_C(  1475301511),
+        -INT32_C(   327927081), -INT32_C(  1049625347),  INT32_C(   966138488),  INT32_C(  1330714495),  INT32_C(  1525486969), -INT32_C(  1355032022),  INT32_C(  1804892242), -INT32_C(   833570945) },
+      { SIMDE_FLOAT32_C(-3.40282347e+38), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    1.5708), SIMDE_FLOAT32_C(  812.8600),
+        SIMDE_FLOAT32_C( -928.9700), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(-3.40282347e+38), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(3.40282347e+38), SIMDE_FLOAT32_C(   90.0000),             SIMDE_MATH_NANF,       -SIMDE_MATH_INFINITYF,
+        SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C(-3.40282347e+38),        SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(3.40282347e+38) } },
+    { {             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  152.8600), SIMDE_FLOAT32_C( -230.1200), SIMDE_FLOAT32_C(  268.4900),
+        SIMDE_FLOAT32_C( -174.2200), SIMDE_FLOAT32_C(  494.9100), SIMDE_FLOAT32_C(  436.9900), SIMDE_FLOAT32_C(  769.3500),
+        SIMDE_FLOAT32_C( -375.8600), SIMDE_FLOAT32_C(  680.6900), SIMDE_FLOAT32_C(  719.5900), SIMDE_FLOAT32_C( -457.5300),
+        SIMDE_FLOAT32_C(  136.8200), SIMDE_FLOAT32_C(  770.1400), SIMDE_FLOAT32_C(  178.6500), SIMDE_FLOAT32_C(  862.8700) },
+      { SIMDE_FLOAT32_C( -303.9000), SIMDE_FLOAT32_C(  585.9800), SIMDE_FLOAT32_C(  459.0500), SIMDE_FLOAT32_C( -496.2500),
+        SIMDE_FLOAT32_C(   -0.0000), SIMDE_FLOAT32_C(  899.2200), SIMDE_FLOAT32_C( -514.3900), SIMDE_FLOAT32_C(  154.6100),
+        SIMDE_FLOAT32_C( -494.6900), SIMDE_FLOAT32_C(  817.3200), SIMDE_FLOAT32_C(  988.1500), SIMDE_FLOAT32_C( -624.5500),
+        SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C(  161.6200), SIMDE_FLOAT32_C(  176.9700), SIMDE_FLOAT32_C(  235.1400) },
+      {  INT32_C(  1236335596),  INT32_C(   667300009),  INT32_C(  1778666633),  INT32_C(   579153390),  INT32_C(  1597111840),  INT32_C(  1416928015),  INT32_C(    17802866),  INT32_C(  1216599217),
+        -INT32_C(   396095392), -INT32_C(   333702491), -INT32_C(  1648451297),  INT32_C(  1186584146), -INT32_C(   897453956),  INT32_C(  1156524391),  INT32_C(   398349864),  INT32_C(  1006026035) },
+      { SIMDE_FLOAT32_C(   -1.0000),             SIMDE_MATH_NANF,        SIMDE_MATH_INFINITYF,             SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(3.40282347e+38),        SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C( -514.3900),       -SIMDE_MATH_INFINITYF,
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(3.40282347e+38), SIMDE_FLOAT32_C(   -1.0000),       -SIMDE_MATH_INFINITYF,
+        SIMDE_FLOAT32_C(-3.40282347e+38),       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  176.9700),             SIMDE_MATH_NANF } },
+    { { SIMDE_FLOAT32_C(  310.0600), SIMDE_FLOAT32_C(   85.1000), SIMDE_FLOAT32_C(  972.8800), SIMDE_FLOAT32_C(  552.4900),
+        SIMDE_FLOAT32_C( -926.2400), SIMDE_FLOAT32_C(   31.7100),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  832.0000),
+        SIMDE_FLOAT32_C(  494.7700),        SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C( -295.0300), SIMDE_FLOAT32_C(  593.4600),
+        SIMDE_FLOAT32_C(  279.5000), SIMDE_FLOAT32_C(  442.9700), SIMDE_FLOAT32_C( -893.9000), SIMDE_FLOAT32_C(  -28.7400) },
+      { SIMDE_FLOAT32_C(  392.5200), SIMDE_FLOAT32_C(  169.6300), SIMDE_FLOAT32_C(  318.8500), SIMDE_FLOAT32_C( -288.5800),
+        SIMDE_FLOAT32_C(  485.6900), SIMDE_FLOAT32_C(  564.9000), SIMDE_FLOAT32_C(  384.7100), SIMDE_FLOAT32_C(  753.7600),
+        SIMDE_FLOAT32_C( -428.1200), SIMDE_FLOAT32_C(  990.2100), SIMDE_FLOAT32_C(  474.3800), SIMDE_FLOAT32_C( -735.5600),
+        SIMDE_FLOAT32_C(  251.1900), SIMDE_FLOAT32_C( -779.1200), SIMDE_FLOAT32_C( -503.5900), SIMDE_FLOAT32_C(   98.0400) },
+      {  INT32_C(   576635378),  INT32_C(  1905679472),  INT32_C(  1288801495),  INT32_C(    48356864),  INT32_C(  1855051362), -INT32_C(  1510051238),  INT32_C(  1233787462),  INT32_C(  1564987629),
+         INT32_C(     9775919),  INT32_C(   493695898),  INT32_C(   217828487), -INT32_C(  2073417652),  INT32_C(   240030565), -INT32_C(   254571404), -INT32_C(   912221351), -INT32_C(   756027836) },
+      {             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   -0.0000),       -SIMDE_MATH_INFINITYF,             SIMDE_MATH_NANF,
+               SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    1.0000),       -SIMDE_MATH_INFINITYF,        SIMDE_MATH_INFINITYF,
+        SIMDE_FLOAT32_C(  494.7700), SIMDE_FLOAT32_C(  990.2100), SIMDE_FLOAT32_C( -295.0300),       -SIMDE_MATH_INFINITYF,
+        SIMDE_FLOAT32_C(  279.5000), SIMDE_FLOAT32_C(  442.9700), SIMDE_FLOAT32_C(   -1.0000), SIMDE_FLOAT32_C(    1.5708) } },
+    { { SIMDE_FLOAT32_C(  205.5000), SIMDE_FLOAT32_C(  989.2900), SIMDE_FLOAT32_C( -194.1500), SIMDE_FLOAT32_C(  166.6200),
+        SIMDE_FLOAT32_C(  -12.4900), SIMDE_FLOAT32_C( -197.2400), SIMDE_FLOAT32_C(  310.6000), SIMDE_FLOAT32_C( -344.1100),
+        SIMDE_FLOAT32_C(  889.4600), SIMDE_FLOAT32_C(  263.1300), SIMDE_FLOAT32_C( -928.3600), SIMDE_FLOAT32_C( -797.0900),
+        SIMDE_FLOAT32_C( -583.7100), SIMDE_FLOAT32_C( -725.6600), SIMDE_FLOAT32_C( -599.0500), SIMDE_FLOAT32_C(    1.0000) },
+      { SIMDE_FLOAT32_C(   -0.0000), SIMDE_FLOAT32_C( -858.7500), SIMDE_FLOAT32_C(  673.2200), SIMDE_FLOAT32_C(  323.8200),
+        SIMDE_FLOAT32_C(  -43.7500), SIMDE_FLOAT32_C( -824.8100), SIMDE_FLOAT32_C(  834.5500), SIMDE_FLOAT32_C( -553.5400),
+        SIMDE_FLOAT32_C( -577.8500), SIMDE_FLOAT32_C( -174.5800),       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  500.5600),
+        SIMDE_FLOAT32_C(  775.4400), SIMDE_FLOAT32_C(  185.5400), SIMDE_FLOAT32_C(  546.6200),       -SIMDE_MATH_INFINITYF },
+      {  INT32_C(   639920732),  INT32_C(   793355274),  INT32_C(   548255463), -INT32_C(  1496328656), -INT32_C(  1489385259),  INT32_C(   135450574), -INT32_C(  1873903126),  INT32_C(  1842755289),
+         INT32_C(  1488662909), -INT32_C(   342968350),  INT32_C(  1911081392), -INT32_C(  1088731365),  INT32_C(   748754354), -INT32_C(  1875977794), -INT32_C(   727337811),  INT32_C(   899587853) },
+      { SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C(-3.40282347e+38),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    1.0000),
+        SIMDE_FLOAT32_C(   -0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -1.0000), SIMDE_FLOAT32_C(    1.5708),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.5000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.5000),
+                    SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   -1.0000), SIMDE_FLOAT32_C(    1.5708), SIMDE_FLOAT32_C(3.40282347e+38) } },
+    { { SIMDE_FLOAT32_C( -939.9400), SIMDE_FLOAT32_C( -874.6500), SIMDE_FLOAT32_C( -379.1100), SIMDE_FLOAT32_C(  314.3300),
+        SIMDE_FLOAT32_C( -335.8500), SIMDE_FLOAT32_C(  135.5000), SIMDE_FLOAT32_C( -872.7100), SIMDE_FLOAT32_C(    1.0000),
+        SIMDE_FLOAT32_C( -437.4500), SIMDE_FLOAT32_C( -947.4100), SIMDE_FLOAT32_C( -409.6800), SIMDE_FLOAT32_C(  262.1900),
+        SIMDE_FLOAT32_C( -699.0000), SIMDE_FLOAT32_C( -932.1200), SIMDE_FLOAT32_C(   -0.0000),        SIMDE_MATH_INFINITYF },
+      { SIMDE_FLOAT32_C(  738.5400), SIMDE_FLOAT32_C(  188.8200), SIMDE_FLOAT32_C(  954.3400), SIMDE_FLOAT32_C( -908.2200),
+              -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C( -234.3800), SIMDE_FLOAT32_C(  232.3300), SIMDE_FLOAT32_C( -231.6500),
+        SIMDE_FLOAT32_C( -248.7500), SIMDE_FLOAT32_C(  738.1400), SIMDE_FLOAT32_C(    7.1200), SIMDE_FLOAT32_C(  101.5200),
+        SIMDE_FLOAT32_C(  851.0100), SIMDE_FLOAT32_C( -734.5400), SIMDE_FLOAT32_C( -746.9300), SIMDE_FLOAT32_C(  457.3700) },
+      {  INT32_C(  1465073517),  INT32_C(  1795364707), -INT32_C(  1875604205), -INT32_C(   641296537), -INT32_C(   710388208),  INT32_C(   825884238), -INT32_C(  1244375349), -INT32_C(  1690063358),
+        -INT32_C(   627469190),  INT32_C(  1317922501), -INT32_C(  1444914604),  INT32_C(   685313000),  INT32_C(  2095165990), -INT32_C(  1281866156),  INT32_C(     9956968),  INT32_C(  1067220566) },
+      {        SIMDE_MATH_INFINITYF,        SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   -1.0000), SIMDE_FLOAT32_C(   -1.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C( -234.3800), SIMDE_FLOAT32_C(    0.5000), SIMDE_FLOAT32_C(    0.5000),
+        SIMDE_FLOAT32_C(    1.0000),       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    1.0000),             SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(   -0.0000),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   -0.0000),             SIMDE_MATH_NANF } },
+    { { SIMDE_FLOAT32_C( -201.7600), SIMDE_FLOAT32_C(  230.2500), SIMDE_FLOAT32_C( -593.6500), SIMDE_FLOAT32_C( -538.3700),
+        SIMDE_FLOAT32_C( -931.4300), SIMDE_FLOAT32_C(  565.8000), SIMDE_FLOAT32_C(   18.8500),             SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(  456.8400),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  150.1600), SIMDE_FLOAT32_C( -724.4200),
+        SIMDE_FLOAT32_C( -837.4900), SIMDE_FLOAT32_C( -367.3200), SIMDE_FLOAT32_C(  798.4000), SIMDE_FLOAT32_C(  758.2500) },
+      { SIMDE_FLOAT32_C(  198.0800),        SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  771.9400), SIMDE_FLOAT32_C(  235.0100),
+        SIMDE_FLOAT32_C(  946.7900), SIMDE_FLOAT32_C( -711.3000), SIMDE_FLOAT32_C( -741.9500), SIMDE_FLOAT32_C( -414.2500),
+        SIMDE_FLOAT32_C(   -0.0000), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C(  693.2300), SIMDE_FLOAT32_C(  265.9500),
+        SIMDE_FLOAT32_C( -267.9000), SIMDE_FLOAT32_C( -549.6300), SIMDE_FLOAT32_C( -384.9400), SIMDE_FLOAT32_C(  452.8400) },
+      { -INT32_C(   500030378),  INT32_C(   683105081), -INT32_C(  1981108266), -INT32_C(   369353190),  INT32_C(  1687380422), -INT32_C(  2063907892),  INT32_C(  1305123085),  INT32_C(   229394635),
+        -INT32_C(  1485070701),  INT32_C(  1708977578),  INT32_C(  1140387161),  INT32_C(  1983838013),  INT32_C(   561727420),  INT32_C(   756272275),  INT32_C(  1384018643),  INT32_C(  1354754632) },
+      { SIMDE_FLOAT32_C(3.40282347e+38), SIMDE_FLOAT32_C(    0.5000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(3.40282347e+38),
+               SIMDE_MATH_INFINITYF,       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    1.5708), SIMDE_FLOAT32_C(    1.5708),
+        SIMDE_FLOAT32_C(3.40282347e+38), SIMDE_FLOAT32_C(3.40282347e+38),       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   -0.0000),
+        SIMDE_FLOAT32_C( -267.9000), SIMDE_FLOAT32_C(    1.5708),             SIMDE_MATH_NANF,        SIMDE_MATH_INFINITYF } },
+    { { SIMDE_FLOAT32_C(  784.7000), SIMDE_FLOAT32_C(  854.3700), SIMDE_FLOAT32_C( -419.2600), SIMDE_FLOAT32_C( -701.7700),
+        SIMDE_FLOAT32_C(  -16.3700),        SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  920.2700), SIMDE_FLOAT32_C( -147.6800),
+        SIMDE_FLOAT32_C(  445.8200), SIMDE_FLOAT32_C( -235.8500), SIMDE_FLOAT32_C(  945.8100), SIMDE_FLOAT32_C(  627.6900),
+        SIMDE_FLOAT32_C(   -0.0000), SIMDE_FLOAT32_C(  810.7600), SIMDE_FLOAT32_C( -574.1900), SIMDE_FLOAT32_C(   -0.0000) },
+      { SIMDE_FLOAT32_C( -414.9700), SIMDE_FLOAT32_C( -300.9000), SIMDE_FLOAT32_C(   33.3300), SIMDE_FLOAT32_C( -921.9100),
+        SIMDE_FLOAT32_C( -655.6700), SIMDE_FLOAT32_C(  241.4400), SIMDE_FLOAT32_C( -835.0400), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(  130.6100), SIMDE_FLOAT32_C(  534.6500), SIMDE_FLOAT32_C(  314.1600), SIMDE_FLOAT32_C(  868.7100),
+        SIMDE_FLOAT32_C(  193.7300), SIMDE_FLOAT32_C( -802.9400), SIMDE_FLOAT32_C( -951.7400), SIMDE_FLOAT32_C( -559.0500) },
+      { -INT32_C(   798327798), -INT32_C(  1630062791), -INT32_C(   562366107),  INT32_C(  1485136231),  INT32_C(   478045794), -INT32_C(  1032267802), -INT32_C(   507193561),  INT32_C(  1942502946),
+        -INT32_C(   793262359), -INT32_C(  1248037209), -INT32_C(  1264881236),  INT32_C(  1063643877), -INT32_C(  1621268695), -INT32_C(   431052336), -INT32_C(   503782117),  INT32_C(  1400957362) },
+      { SIMDE_FLOAT32_C(  784.7000), SIMDE_FLOAT32_C(3.40282347e+38), SIMDE_FLOAT32_C(    1.5708), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(   90.0000), SIMDE_FLOAT32_C(   90.0000), SIMDE_FLOAT32_C( -835.0400), SIMDE_FLOAT32_C(3.40282347e+38),
+        SIMDE_FLOAT32_C(    1.5708), SIMDE_FLOAT32_C(    0.5000), SIMDE_FLOAT32_C(    0.5000),             SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(   -1.0000),       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C( -951.7400),             SIMDE_MATH_NANF } },
+    { { SIMDE_FLOAT32_C(  899.5100), SIMDE_FLOAT32_C(  -10.4000), SIMDE_FLOAT32_C(   -0.0000), SIMDE_FLOAT32_C( -367.4500),
+        SIMDE_FLOAT32_C(  362.8400), SIMDE_FLOAT32_C( -713.4900), SIMDE_FLOAT32_C( -441.6900), SIMDE_FLOAT32_C( -472.8200),
+        SIMDE_FLOAT32_C(  358.5300), SIMDE_FLOAT32_C(  962.5200), SIMDE_FLOAT32_C(  132.7500), SIMDE_FLOAT32_C( -816.3200),
+        SIMDE_FLOAT32_C( -489.5100),       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  710.9300), SIMDE_FLOAT32_C(    1.0000) },
+      { SIMDE_FLOAT32_C( -429.2700), SIMDE_FLOAT32_C( -338.1400), SIMDE_FLOAT32_C( -603.5300), SIMDE_FLOAT32_C( -212.4400),
+        SIMDE_FLOAT32_C(  955.8800), SIMDE_FLOAT32_C(  655.5400),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  834.5300),
+        SIMDE_FLOAT32_C( -392.1800), SIMDE_FLOAT32_C(  -20.8700), SIMDE_FLOAT32_C(  880.2700), SIMDE_FLOAT32_C(   -0.0000),
+        SIMDE_FLOAT32_C( -241.7800), SIMDE_FLOAT32_C( -528.2300), SIMDE_FLOAT32_C( -148.6800), SIMDE_FLOAT32_C( -539.8700) },
+      { -INT32_C(   257866419),  INT32_C(     2504953), -INT32_C(  2010228146), -INT32_C(   310931769), -INT32_C(  1988144192),  INT32_C(   262330338), -INT32_C(   550809293), -INT32_C(   604725762),
+         INT32_C(   231752208),  INT32_C(   131738331),  INT32_C(  1543543097),  INT32_C(   916834886),  INT32_C(  1016681856),  INT32_C(   572955542), -INT32_C(   985300868),  INT32_C(  1969088048) },
+      { SIMDE_FLOAT32_C(  899.5100), SIMDE_FLOAT32_C(  -10.4000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    1.5708),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C( -713.4900),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    1.5708),
+        SIMDE_FLOAT32_C(    1.5708), SIMDE_FLOAT32_C(   -0.0000),        SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    1.0000),
+        SIMDE_FLOAT32_C(   90.0000),             SIMDE_MATH_NANF,        SIMDE_MATH_INFINITYF,        SIMDE_MATH_INFINITYF } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 b = simde_mm512_loadu_ps(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi32(test_vec[i].c);
+    simde__m512 r = simde_mm512_fixupimm_ps(a, b, c, 0);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_fixupimm_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[16];
+    const simde__mmask16 k;
+    const simde_float32 b[16];
+    const int32_t c[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  356.7700), SIMDE_FLOAT32_C( -644.9400), SIMDE_FLOAT32_C(   60.5300), SIMDE_FLOAT32_C( -954.4200),
+        SIMDE_FLOAT32_C(  164.1600), SIMDE_FLOAT32_C( -686.8300), SIMDE_FLOAT32_C( -877.6600), SIMDE_FLOAT32_C( -627.6600),
+        SIMDE_FLOAT32_C( -453.9600), SIMDE_FLOAT32_C( -275.3500), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   54.8000),
+        SIMDE_FLOAT32_C( -472.6400), SIMDE_FLOAT32_C(  -36.5800), SIMDE_FLOAT32_C(  -84.6200), SIMDE_FLOAT32_C( -134.7800) },
+      UINT16_C( 1933),
+      { SIMDE_FLOAT32_C( -886.1800), SIMDE_FLOAT32_C(  985.4000), SIMDE_FLOAT32_C(   30.5600), SIMDE_FLOAT32_C( -831.3100),
+        SIMDE_FLOAT32_C(  336.7900), SIMDE_FLOAT32_C( -613.9400), SIMDE_FLOAT32_C( -976.2200), SIMDE_FLOAT32_C(  242.3900),
+        SIMDE_FLOAT32_C( -504.5100), SIMDE_FLOAT32_C(  736.5400), SIMDE_FLOAT32_C(  929.0000), SIMDE_FLOAT32_C(  775.8500),
+        SIMDE_FLOAT32_C(  693.0100), SIMDE_FLOAT32_C(  998.0900), SIMDE_FLOAT32_C(  740.4600), SIMDE_FLOAT32_C( -516.1200) },
+      {  INT32_C(   839823165), -INT32_C(  1907445824),  INT32_C(   689413861),  INT32_C(   456861007),  INT32_C(   823757479), -INT32_C(   345266017),  INT32_C(   793609250),  INT32_C(    69763869),
+        -INT32_C(   239940670), -INT32_C(  1752162258),  INT32_C(  1667628604), -INT32_C(   837022481),  INT32_C(   164686089),  INT32_C(  1696707241), -INT32_C(  1721281783),  INT32_C(  1660622286) },
+      {             SIMDE_MATH_NANF, SIMDE_FLOAT32_C( -644.9400),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    0.5000),
+        SIMDE_FLOAT32_C(  164.1600), SIMDE_FLOAT32_C( -686.8300), SIMDE_FLOAT32_C( -877.6600), SIMDE_FLOAT32_C( -627.6600),
+        SIMDE_FLOAT32_C( -504.5100), SIMDE_FLOAT32_C(   -1.0000),        SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   54.8000),
+        SIMDE_FLOAT32_C( -472.6400), SIMDE_FLOAT32_C(  -36.5800), SIMDE_FLOAT32_C(  -84.6200), SIMDE_FLOAT32_C( -134.7800) } },
+    { { SIMDE_FLOAT32_C(  257.6300), SIMDE_FLOAT32_C(  642.2100), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  191.5800),
+        SIMDE_FLOAT32_C(  989.3700), SIMDE_FLOAT32_C(  815.5800), SIMDE_FLOAT32_C(  223.8200), SIMDE_FLOAT32_C(  182.0800),
+        SIMDE_FLOAT32_C(  796.0700), SIMDE_FLOAT32_C(   71.4900), SIMDE_FLOAT32_C(  616.7300), SIMDE_FLOAT32_C(  913.2200),
+        SIMDE_FLOAT32_C( -317.6200), SIMDE_FLOAT32_C(  203.2800), SIMDE_FLOAT32_C(  157.2500), SIMDE_FLOAT32_C( -106.6300) },
+      UINT16_C(39620),
+      { SIMDE_FLOAT32_C( -310.6200), SIMDE_FLOAT32_C(  138.5000), SIMDE_FLOAT32_C(  508.1700), SIMDE_FLOAT32_C(  385.7700),
+        SIMDE_FLOAT32_C(  459.5600), SIMDE_FLOAT32_C(  959.5300), SIMDE_FLOAT32_C( -934.5200), SIMDE_FLOAT32_C(  412.7400),
+        SIMDE_FLOAT32_C(  823.5800), SIMDE_FLOAT32_C(  618.7900),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  116.6100),
+        SIMDE_FLOAT32_C( -446.2800), SIMDE_FLOAT32_C(  163.5300), SIMDE_FLOAT32_C(  392.7500), SIMDE_FLOAT32_C(  968.4500) },
+      { -INT32_C(   677083656),  INT32_C(  1818755104),  INT32_C(   648657956),  INT32_C(  2086148140),  INT32_C(   925732392),  INT32_C(    97405615), -INT32_C(  1420851567), -INT32_C(  2023386604),
+        -INT32_C(   766863976),  INT32_C(   917481177), -INT32_C(  1858761172),  INT32_C(   265446458),  INT32_C(   792005499),  INT32_C(   886172313),  INT32_C(   125691980),  INT32_C(  1024063693) },
+      { SIMDE_FLOAT32_C(  257.6300), SIMDE_FLOAT32_C(  642.2100),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  191.5800),
+        SIMDE_FLOAT32_C(  989.3700), SIMDE_FLOAT32_C(  815.5800), SIMDE_FLOAT32_C(    0.5000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(  796.0700),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  616.7300), SIMDE_FLOAT32_C(  913.2200),
+        SIMDE_FLOAT32_C(-3.40282347e+38), SIMDE_FLOAT32_C(  203.2800), SIMDE_FLOAT32_C(  157.2500),             SIMDE_MATH_NANF } },
+    { { SIMDE_FLOAT32_C(  241.5700), SIMDE_FLOAT32_C( -605.0200), SIMDE_FLOAT32_C( -844.1900), SIMDE_FLOAT32_C(  112.2100),
+        SIMDE_FLOAT32_C(  288.3500), SIMDE_FLOAT32_C(  859.2000), SIMDE_FLOAT32_C( -652.2200), SIMDE_FLOAT32_C(    1.0000),
+        SIMDE_FLOAT32_C( -668.1600), SIMDE_FLOAT32_C( -915.5800), SIMDE_FLOAT32_C(  331.4300), SIMDE_FLOAT32_C(   -0.0000),
+        SIMDE_FLOAT32_C( -266.1300), SIMDE_FLOAT32_C( -588.2500), SIMDE_FLOAT32_C( -578.9900), SIMDE_FLOAT32_C(  529.6800) },
+      UINT16_C(24137),
+      { SIMDE_FLOAT32_C( -255.5100), SIMDE_FLOAT32_C(  -61.6100), SIMDE_FLOAT32_C( -947.8200), SIMDE_FLOAT32_C( -585.4300),
+        SIMDE_FLOAT32_C( -275.9200), SIMDE_FLOAT32_C(   -0.0000), SIMDE_FLOAT32_C(  175.3800), SIMDE_FLOAT32_C( -538.4000),
+        SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C( -359.4800), SIMDE_FLOAT32_C( -592.5400), SIMDE_FLOAT32_C( -915.7900),
+        SIMDE_FLOAT32_C(   -0.0000), SIMDE_FLOAT32_C(   -5.5300), SIMDE_FLOAT32_C( -510.2700), SIMDE_FLOAT32_C( -806.3400) },
+      { -INT32_C(   906859912),  INT32_C(   600479138),  INT32_C(    12930843), -INT32_C(  1718566014),  INT32_C(  1534673346), -INT32_C(  1301382997),  INT32_C(  1702825305), -INT32_C(   457495773),
+         INT32_C(  1586436457), -INT32_C(   555893690),  INT32_C(   763080345),  INT32_C(   763070639), -INT32_C(   700042051),  INT32_C(   918909777),  INT32_C(    14521904),  INT32_C(   818536536) },
+      { SIMDE_FLOAT32_C(   -1.0000), SIMDE_FLOAT32_C( -605.0200), SIMDE_FLOAT32_C( -844.1900), SIMDE_FLOAT32_C(   -1.0000),
+        SIMDE_FLOAT32_C(  288.3500), SIMDE_FLOAT32_C(  859.2000),        SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    1.0000),
+        SIMDE_FLOAT32_C( -668.1600), SIMDE_FLOAT32_C(3.40282347e+38), SIMDE_FLOAT32_C(    1.5708), SIMDE_FLOAT32_C(    1.5708),
+              -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C( -588.2500), SIMDE_FLOAT32_C( -578.9900), SIMDE_FLOAT32_C(  529.6800) } },
+    { { SIMDE_FLOAT32_C(  547.9400), SIMDE_FLOAT32_C( -512.1200), SIMDE_FLOAT32_C( -197.3900),             SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(  -89.9500), SIMDE_FLOAT32_C(  435.5500), SIMDE_FLOAT32_C( -723.8300), SIMDE_FLOAT32_C(  799.3500),
+        SIMDE_FLOAT32_C( -739.3600), SIMDE_FLOAT32_C( -327.2200), SIMDE_FLOAT32_C(  177.6100), SIMDE_FLOAT32_C( -252.6500),
+        SIMDE_FLOAT32_C(  281.5300), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C( -158.0200) },
+      UINT16_C(49270),
+      { SIMDE_FLOAT32_C( -138.1900), SIMDE_FLOAT32_C( -568.9000), SIMDE_FLOAT32_C( -946.7200), SIMDE_FLOAT32_C(  698.7800),
+        SIMDE_FLOAT32_C( -319.1600), SIMDE_FLOAT32_C(  532.4000),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C( -582.8800),
+        SIMDE_FLOAT32_C(  121.8100), SIMDE_FLOAT32_C(   -5.9700), SIMDE_FLOAT32_C(   48.5100), SIMDE_FLOAT32_C( -513.3200),
+        SIMDE_FLOAT32_C( -327.2400), SIMDE_FLOAT32_C( -757.4000), SIMDE_FLOAT32_C( -992.4600), SIMDE_FLOAT32_C( -878.3000) },
+      {  INT32_C(  1723929859), -INT32_C(   571726822),  INT32_C(   814029748),  INT32_C(  1107703400),  INT32_C(  1705396858), -INT32_C(   300354695), -INT32_C(   774231303),  INT32_C(    43483252),
+        -INT32_C(    49836446), -INT32_C(   438933984),  INT32_C(  1126692402), -INT32_C(   658041043), -INT32_C(  1609814831), -INT32_C(  1843885733),  INT32_C(  1150779585),  INT32_C(   482689962) },
+      { SIMDE_FLOAT32_C(  547.9400), SIMDE_FLOAT32_C(    1.5708), SIMDE_FLOAT32_C( -197.3900),             SIMDE_MATH_NANF,
+               SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(3.40282347e+38), SIMDE_FLOAT32_C(   -1.0000), SIMDE_FLOAT32_C(  799.3500),
+        SIMDE_FLOAT32_C( -739.3600), SIMDE_FLOAT32_C( -327.2200), SIMDE_FLOAT32_C(  177.6100), SIMDE_FLOAT32_C( -252.6500),
+        SIMDE_FLOAT32_C(  281.5300), SIMDE_FLOAT32_C(    1.0000),       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   90.0000) } },
+    { { SIMDE_FLOAT32_C( -489.5100), SIMDE_FLOAT32_C(    5.1500), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C(  835.4600),
+        SIMDE_FLOAT32_C(  333.2300), SIMDE_FLOAT32_C(   89.9000), SIMDE_FLOAT32_C( -888.8300), SIMDE_FLOAT32_C( -653.1200),
+        SIMDE_FLOAT32_C( -573.3000), SIMDE_FLOAT32_C(  480.3200), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  -80.6000),
+        SIMDE_FLOAT32_C( -852.1000), SIMDE_FLOAT32_C(  330.1700), SIMDE_FLOAT32_C(  258.4700), SIMDE_FLOAT32_C( -374.0700) },
+      UINT16_C(22640),
+      { SIMDE_FLOAT32_C(  649.3000), SIMDE_FLOAT32_C( -308.2500), SIMDE_FLOAT32_C(  135.1400),        SIMDE_MATH_INFINITYF,
+        SIMDE_FLOAT32_C( -990.7200), SIMDE_FLOAT32_C(  207.4900), SIMDE_FLOAT32_C(   -0.0000), SIMDE_FLOAT32_C(  236.9000),
+        SIMDE_FLOAT32_C(  274.3100), SIMDE_FLOAT32_C(  534.1200), SIMDE_FLOAT32_C( -144.4300), SIMDE_FLOAT32_C(  632.1900),
+        SIMDE_FLOAT32_C(   17.5300), SIMDE_FLOAT32_C(  827.7400), SIMDE_FLOAT32_C( -393.5800), SIMDE_FLOAT32_C(  -75.0600) },
+      {  INT32_C(   459799761),  INT32_C(  1849201953),  INT32_C(  1706312814),  INT32_C(    73433429), -INT32_C(   846721934), -INT32_C(    47198628),  INT32_C(   352555560), -INT32_C(  1533561091),
+         INT32_C(   289274551), -INT32_C(   670292801),  INT32_C(   902192353), -INT32_C(   985536853), -INT32_C(   997071822),  INT32_C(  1986009295),  INT32_C(   415333854),  INT32_C(   561113124) },
+      { SIMDE_FLOAT32_C( -489.5100), SIMDE_FLOAT32_C(    5.1500), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C(  835.4600),
+        SIMDE_FLOAT32_C(    1.5708), SIMDE_FLOAT32_C(-3.40282347e+38),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C( -653.1200),
+        SIMDE_FLOAT32_C( -573.3000), SIMDE_FLOAT32_C(  480.3200), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   90.0000),
+        SIMDE_FLOAT32_C(   90.0000), SIMDE_FLOAT32_C(  330.1700), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C( -374.0700) } },
+    { { SIMDE_FLOAT32_C(  819.1800), SIMDE_FLOAT32_C(  -48.1900), SIMDE_FLOAT32_C(   -0.0000), SIMDE_FLOAT32_C(  349.1200),
+        SIMDE_FLOAT32_C(  384.7200),       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  364.6000), SIMDE_FLOAT32_C( -152.9400),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  705.0000), SIMDE_FLOAT32_C( -128.2200),
+        SIMDE_FLOAT32_C(  316.4400), SIMDE_FLOAT32_C(  -56.5800), SIMDE_FLOAT32_C(  314.3000), SIMDE_FLOAT32_C(  791.8300) },
+      UINT16_C(47117),
+      { SIMDE_FLOAT32_C(  678.1700), SIMDE_FLOAT32_C(  788.2300), SIMDE_FLOAT32_C(   99.9300), SIMDE_FLOAT32_C( -860.1400),
+        SIMDE_FLOAT32_C(  212.3600), SIMDE_FLOAT32_C(  461.7500), SIMDE_FLOAT32_C( -533.4900), SIMDE_FLOAT32_C(  109.0600),
+        SIMDE_FLOAT32_C(  280.6900), SIMDE_FLOAT32_C(    0.0000),       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  107.5500),
+        SIMDE_FLOAT32_C(  441.1400), SIMDE_FLOAT32_C(  914.0200), SIMDE_FLOAT32_C( -204.1600), SIMDE_FLOAT32_C( -662.8100) },
+      {  INT32_C(   972607888),  INT32_C(   275965219),  INT32_C(    39889822), -INT32_C(  1182256618), -INT32_C(   481697700),  INT32_C(  1967371864),  INT32_C(  1671327391),  INT32_C(   241603869),
+        -INT32_C(  1776504414), -INT32_C(   996409683), -INT32_C(  1566456133), -INT32_C(  1598189373), -INT32_C(   541422245),  INT32_C(   799600532), -INT32_C(  1177793307), -INT32_C(   785528274) },
+      {             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -48.1900), SIMDE_FLOAT32_C(   -0.0000), SIMDE_FLOAT32_C(   -1.0000),
+        SIMDE_FLOAT32_C(  384.7200),       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  364.6000), SIMDE_FLOAT32_C( -152.9400),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  705.0000), SIMDE_FLOAT32_C(    1.0000),
+        SIMDE_FLOAT32_C(    1.5708),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  314.3000), SIMDE_FLOAT32_C( -662.8100) } },
+    { { SIMDE_FLOAT32_C(  535.7100), SIMDE_FLOAT32_C(  975.5200), SIMDE_FLOAT32_C(  149.5200), SIMDE_FLOAT32_C(  952.5500),
+        SIMDE_FLOAT32_C( -963.1100), SIMDE_FLOAT32_C( -673.2000), SIMDE_FLOAT32_C(  953.0100), SIMDE_FLOAT32_C(  546.9600),
+        SIMDE_FLOAT32_C(  483.9900), SIMDE_FLOAT32_C( -400.2300), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C(  571.7300),
+        SIMDE_FLOAT32_C(  612.0800), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  623.8600), SIMDE_FLOAT32_C( -354.5700) },
+      UINT16_C( 5718),
+      { SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C( -134.7500), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C(  -81.7900),
+        SIMDE_FLOAT32_C(  553.0500), SIMDE_FLOAT32_C(  535.8300), SIMDE_FLOAT32_C( -810.0000), SIMDE_FLOAT32_C(  635.3300),
+        SIMDE_FLOAT32_C(  658.1500), SIMDE_FLOAT32_C( -252.1900), SIMDE_FLOAT32_C(  893.3300), SIMDE_FLOAT32_C( -616.9500),
+        SIMDE_FLOAT32_C(  950.0700), SIMDE_FLOAT32_C(  -90.3700), SIMDE_FLOAT32_C( -651.5500), SIMDE_FLOAT32_C(  966.0000) },
+      {  INT32_C(  1813517326),  INT32_C(  1073112102),  INT32_C(  2092543647),  INT32_C(   143342522), -INT32_C(   480518108),  INT32_C(   395378078), -INT32_C(   770147097),  INT32_C(   927020397),
+         INT32_C(   160471341), -INT32_C(    64079679),  INT32_C(  1823684381), -INT32_C(   421406154), -INT32_C(   309591335),  INT32_C(  1284337646),  INT32_C(   763656750), -INT32_C(   705496303) },
+      { SIMDE_FLOAT32_C(  535.7100), SIMDE_FLOAT32_C(-3.40282347e+38), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C(  952.5500),
+        SIMDE_FLOAT32_C(3.40282347e+38), SIMDE_FLOAT32_C( -673.2000),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  546.9600),
+        SIMDE_FLOAT32_C(  483.9900), SIMDE_FLOAT32_C(   90.0000),        SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  571.7300),
+        SIMDE_FLOAT32_C(3.40282347e+38), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  623.8600), SIMDE_FLOAT32_C( -354.5700) } },
+    { { SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C( -831.4100), SIMDE_FLOAT32_C(  669.5100), SIMDE_FLOAT32_C(  382.5200),
+        SIMDE_FLOAT32_C(  521.3100), SIMDE_FLOAT32_C(   -6.4800), SIMDE_FLOAT32_C( -531.3400), SIMDE_FLOAT32_C(  900.9300),
+        SIMDE_FLOAT32_C( -380.3400), SIMDE_FLOAT32_C(  958.3500), SIMDE_FLOAT32_C(  529.9700), SIMDE_FLOAT32_C(    1.0000),
+        SIMDE_FLOAT32_C(  443.2500), SIMDE_FLOAT32_C(  771.6700), SIMDE_FLOAT32_C( -200.0100), SIMDE_FLOAT32_C( -983.2100) },
+      UINT16_C(12364),
+      { SIMDE_FLOAT32_C(  -83.3700), SIMDE_FLOAT32_C( -955.8600), SIMDE_FLOAT32_C(   69.6800), SIMDE_FLOAT32_C(  722.3400),
+        SIMDE_FLOAT32_C( -595.4300), SIMDE_FLOAT32_C( -806.6500),       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  823.4300),
+        SIMDE_FLOAT32_C( -438.0700), SIMDE_FLOAT32_C(  379.1200), SIMDE_FLOAT32_C(  523.7700), SIMDE_FLOAT32_C(    3.2700),
+        SIMDE_FLOAT32_C(  111.0200), SIMDE_FLOAT32_C(  792.7200), SIMDE_FLOAT32_C( -563.5500), SIMDE_FLOAT32_C( -842.8100) },
+      {  INT32_C(   616167494), -INT32_C(  1051478010), -INT32_C(  2042566664),  INT32_C(  1879505687),  INT32_C(  1289827784),  INT32_C(  1740664856),  INT32_C(  1431640421),  INT32_C(  1889635541),
+        -INT32_C(  1807431806),  INT32_C(  1563370263),  INT32_C(   499911343), -INT32_C(  1715954921),  INT32_C(  1670827476),  INT32_C(   567054681), -INT32_C(   262895279), -INT32_C(    65135425) },
+      { SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C( -831.4100), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0000),
+        SIMDE_FLOAT32_C(  521.3100), SIMDE_FLOAT32_C(   -6.4800),        SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  900.9300),
+        SIMDE_FLOAT32_C( -380.3400), SIMDE_FLOAT32_C(  958.3500), SIMDE_FLOAT32_C(  529.9700), SIMDE_FLOAT32_C(    1.0000),
+               SIMDE_MATH_INFINITYF,             SIMDE_MATH_NANF, SIMDE_FLOAT32_C( -200.0100), SIMDE_FLOAT32_C( -983.2100) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 b = simde_mm512_loadu_ps(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi32(test_vec[i].c);
+    simde__m512 r = simde_mm512_mask_fixupimm_ps(a, test_vec[i].k, b, c, 0);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_fixupimm_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 b[16];
+    const int32_t c[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { UINT16_C(50107),
+      { SIMDE_FLOAT32_C( -306.6200), SIMDE_FLOAT32_C( -217.1300), SIMDE_FLOAT32_C( -845.5700), SIMDE_FLOAT32_C( -960.8800),
+        SIMDE_FLOAT32_C( -969.4300), SIMDE_FLOAT32_C(   -0.0000), SIMDE_FLOAT32_C(  452.8400), SIMDE_FLOAT32_C(    1.0000),
+        SIMDE_FLOAT32_C(  917.1400), SIMDE_FLOAT32_C(  534.3500), SIMDE_FLOAT32_C( -475.5300), SIMDE_FLOAT32_C(  650.5700),
+        SIMDE_FLOAT32_C( -738.3400), SIMDE_FLOAT32_C(  716.6600), SIMDE_FLOAT32_C( -258.8000), SIMDE_FLOAT32_C(  958.3300) },
+      { SIMDE_FLOAT32_C( -926.2000), SIMDE_FLOAT32_C(  390.2500), SIMDE_FLOAT32_C(  725.3300), SIMDE_FLOAT32_C( -114.9600),
+        SIMDE_FLOAT32_C(   54.6700),       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C( -789.2800), SIMDE_FLOAT32_C(  934.8900),
+        SIMDE_FLOAT32_C(  255.4200), SIMDE_FLOAT32_C(  725.2300),       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C( -282.8200),
+        SIMDE_FLOAT32_C(  299.1000), SIMDE_FLOAT32_C( -541.6800), SIMDE_FLOAT32_C(  536.6500), SIMDE_FLOAT32_C( -431.6900) },
+      { -INT32_C(  2053441171), -INT32_C(   251318320),  INT32_C(     7249862),  INT32_C(   442953690),  INT32_C(  2099891820), -INT32_C(   497758371),  INT32_C(   518126327),  INT32_C(   851902888),
+         INT32_C(  1848167370), -INT32_C(  1140436464),  INT32_C(   708359529),  INT32_C(  1358654390), -INT32_C(  1342529110), -INT32_C(    39842748), -INT32_C(  1925621330), -INT32_C(   264753098) },
+      {        SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(-3.40282347e+38), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    1.0000),
+        SIMDE_FLOAT32_C(   -0.0000),       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    0.0000),             SIMDE_MATH_NANF,
+               SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    0.5000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  958.3300) } },
+    { UINT16_C(11965),
+      { SIMDE_FLOAT32_C(  390.1200), SIMDE_FLOAT32_C(  503.6500), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C( -251.6300),
+        SIMDE_FLOAT32_C(  -88.7200), SIMDE_FLOAT32_C( -884.3400), SIMDE_FLOAT32_C( -330.6700), SIMDE_FLOAT32_C( -171.9800),
+        SIMDE_FLOAT32_C( -357.0600), SIMDE_FLOAT32_C( -621.8700), SIMDE_FLOAT32_C(  795.4500), SIMDE_FLOAT32_C(  335.3700),
+        SIMDE_FLOAT32_C( -396.6100), SIMDE_FLOAT32_C(  -62.4200), SIMDE_FLOAT32_C(  742.4800), SIMDE_FLOAT32_C(  366.2100) },
+      { SIMDE_FLOAT32_C( -714.6400), SIMDE_FLOAT32_C( -234.1100), SIMDE_FLOAT32_C(  -26.7800), SIMDE_FLOAT32_C(  -71.7600),
+        SIMDE_FLOAT32_C( -424.9200), SIMDE_FLOAT32_C( -700.4100), SIMDE_FLOAT32_C( -620.8500), SIMDE_FLOAT32_C(   57.3000),
+        SIMDE_FLOAT32_C(  848.4000), SIMDE_FLOAT32_C( -906.7300), SIMDE_FLOAT32_C( -574.6500), SIMDE_FLOAT32_C(  365.2400),
+        SIMDE_FLOAT32_C(  881.8200), SIMDE_FLOAT32_C(  931.6000), SIMDE_FLOAT32_C(  870.3900), SIMDE_FLOAT32_C( -177.1700) },
+      { -INT32_C(  1581613895), -INT32_C(   450131916),  INT32_C(  1724249688), -INT32_C(   197370800), -INT32_C(  1662179505),  INT32_C(  1108802875),  INT32_C(  2018951164), -INT32_C(  1393035752),
+        -INT32_C(  1924296569), -INT32_C(  2081256522), -INT32_C(  1655731666), -INT32_C(  1851388292), -INT32_C(  1613170784),  INT32_C(  1856573318),  INT32_C(   765199362), -INT32_C(   476648185) },
+      { SIMDE_FLOAT32_C( -714.6400), SIMDE_FLOAT32_C(    0.0000),       -SIMDE_MATH_INFINITYF,       -SIMDE_MATH_INFINITYF,
+        SIMDE_FLOAT32_C(   90.0000),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    1.0000),
+        SIMDE_FLOAT32_C(    0.0000),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    1.5708), SIMDE_FLOAT32_C(   -1.0000),
+        SIMDE_FLOAT32_C(    0.0000),        SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT16_C( 8130),
+      { SIMDE_FLOAT32_C( -715.2200), SIMDE_FLOAT32_C(   -0.0000), SIMDE_FLOAT32_C(  850.4300), SIMDE_FLOAT32_C(  605.5800),
+        SIMDE_FLOAT32_C(  696.2800), SIMDE_FLOAT32_C( -591.1800),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  670.4100),
+        SIMDE_FLOAT32_C( -395.5700), SIMDE_FLOAT32_C( -956.7500),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  811.2400),
+        SIMDE_FLOAT32_C( -755.2600), SIMDE_FLOAT32_C( -137.2600), SIMDE_FLOAT32_C( -476.2500), SIMDE_FLOAT32_C( -415.0100) },
+      { SIMDE_FLOAT32_C( -879.8700), SIMDE_FLOAT32_C(  162.9500), SIMDE_FLOAT32_C( -349.9800), SIMDE_FLOAT32_C(  359.3500),
+        SIMDE_FLOAT32_C(  335.1500), SIMDE_FLOAT32_C(  285.6300), SIMDE_FLOAT32_C(   51.6300), SIMDE_FLOAT32_C(  967.5900),
+        SIMDE_FLOAT32_C(  549.5100), SIMDE_FLOAT32_C(  844.0700), SIMDE_FLOAT32_C( -261.8300), SIMDE_FLOAT32_C(  184.8600),
+        SIMDE_FLOAT32_C( -495.9800), SIMDE_FLOAT32_C(  443.4100), SIMDE_FLOAT32_C( -222.9800), SIMDE_FLOAT32_C(  347.1300) },
+      { -INT32_C(   892748236), -INT32_C(     9738941), -INT32_C(  1569845738), -INT32_C(  1252850351), -INT32_C(   378335244),  INT32_C(  2011711562), -INT32_C(  1357013323), -INT32_C(  1976515126),
+        -INT32_C(  1082523927), -INT32_C(  1955640958),  INT32_C(   983688282), -INT32_C(  1246346684),  INT32_C(   771246644),  INT32_C(  1329792883),  INT32_C(     4084405),  INT32_C(  1128778820) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(-3.40282347e+38), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.5000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C(    0.5000),
+        SIMDE_FLOAT32_C(    1.5708), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT16_C(43679),
+      { SIMDE_FLOAT32_C(  303.6300), SIMDE_FLOAT32_C( -763.9800), SIMDE_FLOAT32_C( -418.7800), SIMDE_FLOAT32_C( -558.9800),
+        SIMDE_FLOAT32_C(  894.8900), SIMDE_FLOAT32_C( -464.9600), SIMDE_FLOAT32_C(  -94.7000), SIMDE_FLOAT32_C( -493.1700),
+        SIMDE_FLOAT32_C( -800.3800), SIMDE_FLOAT32_C( -527.2300), SIMDE_FLOAT32_C(   62.1200), SIMDE_FLOAT32_C( -862.1600),
+        SIMDE_FLOAT32_C(  672.0900), SIMDE_FLOAT32_C(  233.4000), SIMDE_FLOAT32_C(  123.0800), SIMDE_FLOAT32_C( -354.9800) },
+      { SIMDE_FLOAT32_C(  410.1600), SIMDE_FLOAT32_C(  185.7200), SIMDE_FLOAT32_C( -306.1400), SIMDE_FLOAT32_C( -627.8300),
+        SIMDE_FLOAT32_C( -520.1700),        SIMDE_MATH_INFINITYF,             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  419.3700),
+        SIMDE_FLOAT32_C( -145.2200), SIMDE_FLOAT32_C(  706.7600), SIMDE_FLOAT32_C(  395.1900),       -SIMDE_MATH_INFINITYF,
+        SIMDE_FLOAT32_C(  494.1300), SIMDE_FLOAT32_C( -410.3600), SIMDE_FLOAT32_C( -323.3400), SIMDE_FLOAT32_C( -728.8900) },
+      {  INT32_C(  1614971709),  INT32_C(   566500430),  INT32_C(  1963171521), -INT32_C(   735020387),  INT32_C(  1804743825), -INT32_C(  2105161069), -INT32_C(   766897011), -INT32_C(  1898071421),
+        -INT32_C(  1995590407),  INT32_C(  1025581998),  INT32_C(   567606103), -INT32_C(  2131626857), -INT32_C(  2092179779),  INT32_C(  1833785300), -INT32_C(   215131389), -INT32_C(  1875205242) },
+      {        SIMDE_MATH_INFINITYF,             SIMDE_MATH_NANF,        SIMDE_MATH_INFINITYF,       -SIMDE_MATH_INFINITYF,
+        SIMDE_FLOAT32_C(    0.5000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    0.0000),       -SIMDE_MATH_INFINITYF,
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    1.5708), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C( -354.9800) } },
+    { UINT16_C( 1471),
+      { SIMDE_FLOAT32_C(  386.7000), SIMDE_FLOAT32_C(    1.0000),       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  842.6300),
+        SIMDE_FLOAT32_C(  515.4500), SIMDE_FLOAT32_C(  318.0000), SIMDE_FLOAT32_C( -608.7000), SIMDE_FLOAT32_C( -217.8100),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C( -709.6000), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C( -292.1100),
+        SIMDE_FLOAT32_C( -560.9400), SIMDE_FLOAT32_C(  -92.3500), SIMDE_FLOAT32_C( -552.0300), SIMDE_FLOAT32_C( -952.1700) },
+      { SIMDE_FLOAT32_C( -459.6100), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C(  549.4500), SIMDE_FLOAT32_C( -919.9300),
+        SIMDE_FLOAT32_C( -815.6200), SIMDE_FLOAT32_C( -609.4900), SIMDE_FLOAT32_C(  535.3600), SIMDE_FLOAT32_C( -122.5400),
+        SIMDE_FLOAT32_C(  498.9200), SIMDE_FLOAT32_C(  485.2300),             SIMDE_MATH_NANF,       -SIMDE_MATH_INFINITYF,
+        SIMDE_FLOAT32_C(  225.0600), SIMDE_FLOAT32_C(  165.7600), SIMDE_FLOAT32_C(  275.8600), SIMDE_FLOAT32_C(    1.0000) },
+      {  INT32_C(   153035688),  INT32_C(   493993641),  INT32_C(  1549287615),  INT32_C(  1213489722),  INT32_C(  1857764838),  INT32_C(   590036404),  INT32_C(  1527903371),  INT32_C(  1857260745),
+         INT32_C(   364007938),  INT32_C(  1219212489), -INT32_C(  1993217452),  INT32_C(  1329445976),  INT32_C(  1170236609), -INT32_C(   461028575),  INT32_C(   760607477),  INT32_C(  1569253187) },
+      { SIMDE_FLOAT32_C(   -1.0000), SIMDE_FLOAT32_C(    0.5000),        SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(3.40282347e+38),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(3.40282347e+38),
+        SIMDE_FLOAT32_C(  498.9200), SIMDE_FLOAT32_C(    0.0000),       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT16_C(23585),
+      {             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  134.5600), SIMDE_FLOAT32_C(  890.7500), SIMDE_FLOAT32_C(  284.4400),
+        SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C( -682.6500), SIMDE_FLOAT32_C(  -25.0200), SIMDE_FLOAT32_C( -142.9100),
+        SIMDE_FLOAT32_C(  966.8200), SIMDE_FLOAT32_C( -393.3600),       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  498.1600),
+        SIMDE_FLOAT32_C( -962.4000), SIMDE_FLOAT32_C(  840.5100), SIMDE_FLOAT32_C(  228.6000), SIMDE_FLOAT32_C( -233.4100) },
+      { SIMDE_FLOAT32_C(  288.8800), SIMDE_FLOAT32_C( -325.0000), SIMDE_FLOAT32_C(  532.1100), SIMDE_FLOAT32_C( -483.2100),
+        SIMDE_FLOAT32_C(  648.1300), SIMDE_FLOAT32_C( -345.6400), SIMDE_FLOAT32_C(  195.7200), SIMDE_FLOAT32_C( -151.1000),
+        SIMDE_FLOAT32_C( -259.1900), SIMDE_FLOAT32_C( -498.0000), SIMDE_FLOAT32_C(  384.4800), SIMDE_FLOAT32_C(  523.5200),
+        SIMDE_FLOAT32_C( -123.8800), SIMDE_FLOAT32_C(  700.9500), SIMDE_FLOAT32_C(  664.0300), SIMDE_FLOAT32_C(    1.0000) },
+      {  INT32_C(  1268671129), -INT32_C(   760891175), -INT32_C(  1094585193), -INT32_C(  1898061099), -INT32_C(  1824717497),  INT32_C(  1264047726), -INT32_C(  1469801653), -INT32_C(  1552183623),
+        -INT32_C(  1505176622),  INT32_C(  1867215107),  INT32_C(  1267863797), -INT32_C(   719499975),  INT32_C(   893365264),  INT32_C(   603906883),  INT32_C(   459344213), -INT32_C(   260245185) },
+      {       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.5000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    1.5708),
+               SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  664.0300), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT16_C(35709),
+      { SIMDE_FLOAT32_C(  510.3900), SIMDE_FLOAT32_C(   54.0800), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  415.0700),
+        SIMDE_FLOAT32_C(  -91.7500), SIMDE_FLOAT32_C( -206.6500), SIMDE_FLOAT32_C(   60.6500), SIMDE_FLOAT32_C(  346.9700),
+        SIMDE_FLOAT32_C(   21.3800), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C( -456.2900), SIMDE_FLOAT32_C( -726.7200),
+        SIMDE_FLOAT32_C( -457.1900),        SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  574.6400), SIMDE_FLOAT32_C( -383.1800) },
+      { SIMDE_FLOAT32_C(  140.1100), SIMDE_FLOAT32_C( -142.3800), SIMDE_FLOAT32_C(  -46.1900), SIMDE_FLOAT32_C( -512.3100),
+        SIMDE_FLOAT32_C(    1.0000),       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  348.5100), SIMDE_FLOAT32_C(  858.4300),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -4.5400), SIMDE_FLOAT32_C(  956.2800), SIMDE_FLOAT32_C(  -72.7900),
+        SIMDE_FLOAT32_C(  435.0900), SIMDE_FLOAT32_C( -123.1500), SIMDE_FLOAT32_C( -830.3800),             SIMDE_MATH_NANF },
+      { -INT32_C(  1688610051),  INT32_C(  1851192316), -INT32_C(   428962400),  INT32_C(  2054618979),  INT32_C(      588754),  INT32_C(   484278230), -INT32_C(  1469807162), -INT32_C(  1473621367),
+        -INT32_C(   622887111), -INT32_C(  1707458905), -INT32_C(  1841500361),  INT32_C(  1924474175), -INT32_C(   406827520),  INT32_C(  1706697232), -INT32_C(   353773369), -INT32_C(   319180075) },
+      { SIMDE_FLOAT32_C(   -1.0000), SIMDE_FLOAT32_C(    0.0000),       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    1.0000),
+        SIMDE_FLOAT32_C(-3.40282347e+38), SIMDE_FLOAT32_C(    1.5708), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(-3.40282347e+38), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C(    0.0000),             SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),        SIMDE_MATH_INFINITYF } },
+    { UINT16_C(35653),
+      { SIMDE_FLOAT32_C(  480.4700), SIMDE_FLOAT32_C( -410.4700), SIMDE_FLOAT32_C(  430.8700), SIMDE_FLOAT32_C( -339.4900),
+        SIMDE_FLOAT32_C( -750.3300), SIMDE_FLOAT32_C( -675.0600), SIMDE_FLOAT32_C(   53.1200), SIMDE_FLOAT32_C(  623.2400),
+                    SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  684.1800), SIMDE_FLOAT32_C( -193.1100), SIMDE_FLOAT32_C(  -71.2000),
+                    SIMDE_MATH_NANF, SIMDE_FLOAT32_C( -423.8600), SIMDE_FLOAT32_C( -948.8900), SIMDE_FLOAT32_C( -866.5800) },
+      { SIMDE_FLOAT32_C(  327.3200), SIMDE_FLOAT32_C( -176.3700), SIMDE_FLOAT32_C(  466.9700),             SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(  -12.1900), SIMDE_FLOAT32_C( -815.9300), SIMDE_FLOAT32_C(  296.2600), SIMDE_FLOAT32_C(  633.0700),
+               SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  895.8000), SIMDE_FLOAT32_C( -825.1000), SIMDE_FLOAT32_C( -728.8300),
+        SIMDE_FLOAT32_C(  889.3400), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C( -254.8000), SIMDE_FLOAT32_C(  282.0200) },
+      {  INT32_C(  1049704334), -INT32_C(  1183383050), -INT32_C(  1632549958),  INT32_C(  1149855577),  INT32_C(   588343764), -INT32_C(  1907614049),  INT32_C(   289646787),  INT32_C(  1701147001),
+        -INT32_C(   653173925), -INT32_C(   793558062),  INT32_C(   727135021),  INT32_C(   196134741), -INT32_C(   948312345),  INT32_C(   487584770), -INT32_C(   837267731),  INT32_C(   578893079) },
+      {             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -1.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  296.2600), SIMDE_FLOAT32_C(    0.0000),
+               SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    1.5708), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.5000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),             SIMDE_MATH_NANF } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 b = simde_mm512_loadu_ps(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi32(test_vec[i].c);
+    simde__m512 r = simde_mm512_maskz_fixupimm_ps(test_vec[i].k, a, b, c, 0);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_fixupimm_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[8];
+    const simde_float64 b[8];
+    const int64_t c[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C( -842.1400), SIMDE_FLOAT64_C(  208.5000), SIMDE_FLOAT64_C(  118.6600), SIMDE_FLOAT64_C(  -62.3500),
+                     SIMDE_MATH_NAN, SIMDE_FLOAT64_C( -319.9200), SIMDE_FLOAT64_C( -281.7000), SIMDE_FLOAT64_C( -291.4700) },
+      { SIMDE_FLOAT64_C(  198.1400), SIMDE_FLOAT64_C( -644.0200),        -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(  697.0000),
+        SIMDE_FLOAT64_C(  781.6200), SIMDE_FLOAT64_C(   31.9400), SIMDE_FLOAT64_C(  730.8400), SIMDE_FLOAT64_C(    0.0000) },
+      { -INT64_C( 5830738875939520131),  INT64_C(  300646961263789662),  INT64_C( 2577391123390494690), -INT64_C( 4090399921640488165),
+        -INT64_C( 4423815657086626264),  INT64_C( 7467190037104623451),  INT64_C(  203183846665073833),  INT64_C( 4378373093254895654) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(  208.5000), SIMDE_FLOAT64_C(-1.7976931348623157e+308), SIMDE_FLOAT64_C(   -0.0000),
+                     SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   -1.0000), SIMDE_FLOAT64_C(   90.0000), SIMDE_FLOAT64_C(    0.0000) } },
+    { { SIMDE_FLOAT64_C(  441.6900), SIMDE_FLOAT64_C( -872.2700), SIMDE_FLOAT64_C(  982.3300), SIMDE_FLOAT64_C( -729.2000),
+        SIMDE_FLOAT64_C(  319.0000), SIMDE_FLOAT64_C( -202.9200), SIMDE_FLOAT64_C(  512.5300), SIMDE_FLOAT64_C(  -40.5600) },
+      { SIMDE_FLOAT64_C(  452.9100), SIMDE_FLOAT64_C( -794.0800), SIMDE_FLOAT64_C( -695.2300), SIMDE_FLOAT64_C( -968.6300),
+        SIMDE_FLOAT64_C( -253.0100), SIMDE_FLOAT64_C( -574.7400), SIMDE_FLOAT64_C( -692.6800), SIMDE_FLOAT64_C( -410.8300) },
+      { -INT64_C( 7123128552175542627),  INT64_C( 6905358976815733282), -INT64_C( 7393258323915149183),  INT64_C( 5413154229626160006),
+        -INT64_C(  365459198908584805),  INT64_C( 1193373010788593341), -INT64_C( 5793140224477957648),  INT64_C(  243711683362337680) },
+      {         SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(    0.5000), SIMDE_FLOAT64_C(1.7976931348623157e+308), SIMDE_FLOAT64_C(    0.5000),
+        SIMDE_FLOAT64_C(    1.5708), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C( -692.6800), SIMDE_FLOAT64_C(    1.0000) } },
+    { { SIMDE_FLOAT64_C(  763.6500), SIMDE_FLOAT64_C( -961.8300), SIMDE_FLOAT64_C( -889.1900), SIMDE_FLOAT64_C(  978.0800),
+        SIMDE_FLOAT64_C( -282.6700), SIMDE_FLOAT64_C(  764.4000), SIMDE_FLOAT64_C(  900.3700), SIMDE_FLOAT64_C( -539.3700) },
+      { SIMDE_FLOAT64_C(   -0.0000), SIMDE_FLOAT64_C(  555.3400), SIMDE_FLOAT64_C( -443.8700), SIMDE_FLOAT64_C(  -82.2700),
+        SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(  115.3100), SIMDE_FLOAT64_C(  338.9100), SIMDE_FLOAT64_C( -338.6400) },
+      { -INT64_C( 3395264592586076096), -INT64_C( 2062858344050382543), -INT64_C( 5328828211330573224), -INT64_C( 7527079601788829563),
+         INT64_C( 2166928683450461130), -INT64_C( 6764925316463537170), -INT64_C( 4683206515203506533),  INT64_C( 8204569679326166472) },
+      { SIMDE_FLOAT64_C(  763.6500), SIMDE_FLOAT64_C(-1.7976931348623157e+308),              SIMDE_MATH_NAN, SIMDE_FLOAT64_C(    0.5000),
+        SIMDE_FLOAT64_C(    0.5000),        -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(    0.5000), SIMDE_FLOAT64_C(   -0.0000) } },
+    { { SIMDE_FLOAT64_C(  367.3200), SIMDE_FLOAT64_C(  169.0700), SIMDE_FLOAT64_C(  853.2500), SIMDE_FLOAT64_C(  490.3100),
+        SIMDE_FLOAT64_C( -383.7200), SIMDE_FLOAT64_C(  648.5900), SIMDE_FLOAT64_C(  883.6100), SIMDE_FLOAT64_C( -493.4000) },
+      { SIMDE_FLOAT64_C(  301.3600), SIMDE_FLOAT64_C(  930.1500), SIMDE_FLOAT64_C( -577.9800), SIMDE_FLOAT64_C( -583.5100),
+        SIMDE_FLOAT64_C(  238.3700), SIMDE_FLOAT64_C( -967.9000), SIMDE_FLOAT64_C(  532.2100), SIMDE_FLOAT64_C(  664.5800) },
+      { -INT64_C( 2091570266490333321),  INT64_C( 5105218740078755495),  INT64_C( 5474700201336410590), -INT64_C( 1058486397997227675),
+         INT64_C( 4613449876179347446), -INT64_C( 1723176293334625770), -INT64_C( 3101965331848592127), -INT64_C( 9089833915131547885) },
+      { SIMDE_FLOAT64_C(   -1.0000),              SIMDE_MATH_NAN, SIMDE_FLOAT64_C(  853.2500), SIMDE_FLOAT64_C(   -0.0000),
+                     SIMDE_MATH_NAN, SIMDE_FLOAT64_C(1.7976931348623157e+308),              SIMDE_MATH_NAN, SIMDE_FLOAT64_C(    1.5708) } },
+    { { SIMDE_FLOAT64_C(  -87.9800), SIMDE_FLOAT64_C(  805.2200), SIMDE_FLOAT64_C(  707.8900),         SIMDE_MATH_INFINITY,
+        SIMDE_FLOAT64_C( -986.4700), SIMDE_FLOAT64_C(  394.2900), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(  662.0300) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C( -912.5000), SIMDE_FLOAT64_C(  506.3100), SIMDE_FLOAT64_C(  259.0700),
+        SIMDE_FLOAT64_C( -577.9900), SIMDE_FLOAT64_C(  370.3600), SIMDE_FLOAT64_C(    1.0000), SIMDE_FLOAT64_C(  251.3200) },
+      { -INT64_C( 8381747649362974443), -INT64_C( 6259461959587412582), -INT64_C( 3847841134832511906), -INT64_C( 8556388275007593683),
+         INT64_C( 5512007433676709838),  INT64_C( 7876184439901539934), -INT64_C( 8808223182692813127), -INT64_C( 6885886718105971744) },
+      { SIMDE_FLOAT64_C(   -1.0000),         SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(1.7976931348623157e+308), SIMDE_FLOAT64_C(   -1.0000),
+        SIMDE_FLOAT64_C(    0.5000), SIMDE_FLOAT64_C(    1.0000), SIMDE_FLOAT64_C(-1.7976931348623157e+308),        -SIMDE_MATH_INFINITY } },
+    { { SIMDE_FLOAT64_C( -756.3300), SIMDE_FLOAT64_C(  311.9000), SIMDE_FLOAT64_C(  822.1300), SIMDE_FLOAT64_C(  335.8600),
+        SIMDE_FLOAT64_C( -668.5200), SIMDE_FLOAT64_C( -204.9100), SIMDE_FLOAT64_C(  174.8000), SIMDE_FLOAT64_C(  555.3000) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(  365.9100), SIMDE_FLOAT64_C(  668.8000),        -SIMDE_MATH_INFINITY,
+               -SIMDE_MATH_INFINITY,              SIMDE_MATH_NAN, SIMDE_FLOAT64_C( -553.7000), SIMDE_FLOAT64_C( -855.9500) },
+      { -INT64_C( 4457845358971366111), -INT64_C( 3902874107693611887), -INT64_C( 8089945379831195172),  INT64_C( 5457849103208423428),
+        -INT64_C( 6034588315133209827),  INT64_C( 5338491958656419641), -INT64_C( 6901593387237331584), -INT64_C( 7788885211716703361) },
+      {         SIMDE_MATH_INFINITY,         SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(  668.8000), SIMDE_FLOAT64_C(   90.0000),
+                     SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   -1.0000), SIMDE_FLOAT64_C(   -1.0000), SIMDE_FLOAT64_C(-1.7976931348623157e+308) } },
+    { { SIMDE_FLOAT64_C( -105.3700), SIMDE_FLOAT64_C(  884.0300), SIMDE_FLOAT64_C(  414.4900), SIMDE_FLOAT64_C( -132.3100),
+        SIMDE_FLOAT64_C( -425.8900), SIMDE_FLOAT64_C(  438.7700), SIMDE_FLOAT64_C(  830.1500), SIMDE_FLOAT64_C( -360.2200) },
+      { SIMDE_FLOAT64_C(  691.1300), SIMDE_FLOAT64_C(  954.7500), SIMDE_FLOAT64_C(  884.3700), SIMDE_FLOAT64_C(  329.7300),
+        SIMDE_FLOAT64_C(    1.0000), SIMDE_FLOAT64_C(  288.0800), SIMDE_FLOAT64_C(  538.2000), SIMDE_FLOAT64_C(  143.1400) },
+      {  INT64_C( 5794557074891273154),  INT64_C( 6690393064594933214), -INT64_C( 6196831992754104258),  INT64_C( 4304399297175750353),
+        -INT64_C( 6423885524248099985), -INT64_C( 7632440232060705423),  INT64_C( 7480481849876885313),  INT64_C( 2866568084663918963) },
+      {         SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(1.7976931348623157e+308),
+        SIMDE_FLOAT64_C( -425.8900), SIMDE_FLOAT64_C(  288.0800), SIMDE_FLOAT64_C(-1.7976931348623157e+308),              SIMDE_MATH_NAN } },
+    { { SIMDE_FLOAT64_C(  714.0300), SIMDE_FLOAT64_C( -958.0600), SIMDE_FLOAT64_C(  345.1000), SIMDE_FLOAT64_C( -845.4100),
+        SIMDE_FLOAT64_C( -533.9200), SIMDE_FLOAT64_C(  640.4300), SIMDE_FLOAT64_C(  223.6400), SIMDE_FLOAT64_C(    1.0000) },
+      {              SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   24.6200), SIMDE_FLOAT64_C( -145.3000), SIMDE_FLOAT64_C(  403.7300),
+        SIMDE_FLOAT64_C( -158.9200), SIMDE_FLOAT64_C( -148.2900), SIMDE_FLOAT64_C(  673.4700), SIMDE_FLOAT64_C( -394.6300) },
+      {  INT64_C(  777869706216035585),  INT64_C( 5308620775366055016), -INT64_C( 3167541948078949535),  INT64_C( 7762521324264537463),
+         INT64_C( 3729687937023694105),  INT64_C( 2761876532569956489),  INT64_C( 1638696756252636258), -INT64_C( 3607254687755249118) },
+      {              SIMDE_MATH_NAN, SIMDE_FLOAT64_C( -958.0600), SIMDE_FLOAT64_C(    1.5708),        -SIMDE_MATH_INFINITY,
+        SIMDE_FLOAT64_C( -158.9200),         SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(   -1.0000) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d b = simde_mm512_loadu_pd(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi64(test_vec[i].c);
+    simde__m512d r = simde_mm512_fixupimm_pd(a, b, c, 0);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_fixupimm_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[8];
+    const simde__mmask8 k;
+    const simde_float64 b[8];
+    const int64_t c[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  109.2900), SIMDE_FLOAT64_C( -739.3900), SIMDE_FLOAT64_C( -263.4300), SIMDE_FLOAT64_C( -774.2700),
+        SIMDE_FLOAT64_C(  924.4000), SIMDE_FLOAT64_C(  216.4600), SIMDE_FLOAT64_C( -706.6800),        -SIMDE_MATH_INFINITY },
+      UINT8_C(192),
+      { SIMDE_FLOAT64_C( -464.8900), SIMDE_FLOAT64_C( -742.0200), SIMDE_FLOAT64_C(  495.6900),        -SIMDE_MATH_INFINITY,
+        SIMDE_FLOAT64_C(  522.3100), SIMDE_FLOAT64_C(  194.5100), SIMDE_FLOAT64_C( -587.0500), SIMDE_FLOAT64_C( -620.3800) },
+      { -INT64_C(  483133252311713579),  INT64_C( 8513007258268684782), -INT64_C( 7769608937476181890), -INT64_C( 7469031208367425831),
+        -INT64_C(  397437599221221539), -INT64_C( 6176657239273585795),  INT64_C( 1740803848998551891), -INT64_C( 1065876255508390844) },
+      { SIMDE_FLOAT64_C(  109.2900), SIMDE_FLOAT64_C( -739.3900), SIMDE_FLOAT64_C( -263.4300), SIMDE_FLOAT64_C( -774.2700),
+        SIMDE_FLOAT64_C(  924.4000), SIMDE_FLOAT64_C(  216.4600),              SIMDE_MATH_NAN, SIMDE_FLOAT64_C(-1.7976931348623157e+308) } },
+    { { SIMDE_FLOAT64_C(  -33.8200), SIMDE_FLOAT64_C(  994.9500), SIMDE_FLOAT64_C(  451.3600), SIMDE_FLOAT64_C(  627.8000),
+        SIMDE_FLOAT64_C(  108.1800), SIMDE_FLOAT64_C( -771.0800), SIMDE_FLOAT64_C(  702.1700), SIMDE_FLOAT64_C( -427.1700) },
+      UINT8_C(132),
+      { SIMDE_FLOAT64_C(  787.5500), SIMDE_FLOAT64_C(  294.3000), SIMDE_FLOAT64_C( -248.8600), SIMDE_FLOAT64_C( -618.0300),
+        SIMDE_FLOAT64_C(  794.1800), SIMDE_FLOAT64_C(  794.5700), SIMDE_FLOAT64_C(  836.9700), SIMDE_FLOAT64_C( -329.3400) },
+      {  INT64_C( 2878028440758235710), -INT64_C( 5133058548245490017), -INT64_C( 5316415407597249193), -INT64_C( 6068037097472444655),
+         INT64_C( 3392332443890500182),  INT64_C( 2785884733990476467),  INT64_C( 5693076396167101366),  INT64_C( 6670795870475123871) },
+      { SIMDE_FLOAT64_C(  -33.8200), SIMDE_FLOAT64_C(  994.9500), SIMDE_FLOAT64_C(   -0.0000), SIMDE_FLOAT64_C(  627.8000),
+        SIMDE_FLOAT64_C(  108.1800), SIMDE_FLOAT64_C( -771.0800), SIMDE_FLOAT64_C(  702.1700),        -SIMDE_MATH_INFINITY } },
+    { { SIMDE_FLOAT64_C( -856.6600), SIMDE_FLOAT64_C(  536.3400), SIMDE_FLOAT64_C( -593.0900), SIMDE_FLOAT64_C( -581.3700),
+        SIMDE_FLOAT64_C(  -85.2700), SIMDE_FLOAT64_C( -477.0400), SIMDE_FLOAT64_C(  418.4400), SIMDE_FLOAT64_C(  181.4200) },
+      UINT8_C(252),
+      { SIMDE_FLOAT64_C(  317.7900), SIMDE_FLOAT64_C(  -88.5000), SIMDE_FLOAT64_C(  475.9700), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(  227.3500), SIMDE_FLOAT64_C( -925.0600), SIMDE_FLOAT64_C( -590.3100), SIMDE_FLOAT64_C( -178.0400) },
+      {  INT64_C( 1382565666837618218),  INT64_C( 7787984166433431225), -INT64_C( 2978208027075842094),  INT64_C( 7550605345013441795),
+        -INT64_C( 4790021540397541404), -INT64_C( 5808538778251667906), -INT64_C( 2259338133069026886), -INT64_C( 5768278761429101187) },
+      { SIMDE_FLOAT64_C( -856.6600), SIMDE_FLOAT64_C(  536.3400), SIMDE_FLOAT64_C(  475.9700),         SIMDE_MATH_INFINITY,
+        SIMDE_FLOAT64_C(    1.0000),              SIMDE_MATH_NAN, SIMDE_FLOAT64_C(1.7976931348623157e+308),              SIMDE_MATH_NAN } },
+    { { SIMDE_FLOAT64_C( -617.6400), SIMDE_FLOAT64_C(   -0.0000), SIMDE_FLOAT64_C( -938.6900), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(  685.0600),        -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(  818.8500), SIMDE_FLOAT64_C(  784.3200) },
+      UINT8_C(238),
+      { SIMDE_FLOAT64_C(  649.4900), SIMDE_FLOAT64_C( -982.7700), SIMDE_FLOAT64_C(  691.9700), SIMDE_FLOAT64_C( -720.7100),
+        SIMDE_FLOAT64_C( -615.8600), SIMDE_FLOAT64_C(  880.8300), SIMDE_FLOAT64_C(  -47.5700),        -SIMDE_MATH_INFINITY },
+      { -INT64_C( 7132113607082862293),  INT64_C( 3634615707745758830), -INT64_C( 6499254132631989366),  INT64_C( 3067252177928206398),
+        -INT64_C( 7763990588032861818),  INT64_C(   63401898084003053), -INT64_C(  252713932257068974), -INT64_C( 2966947279443607393) },
+      { SIMDE_FLOAT64_C( -617.6400), SIMDE_FLOAT64_C(    0.5000), SIMDE_FLOAT64_C( -938.6900),         SIMDE_MATH_INFINITY,
+        SIMDE_FLOAT64_C(  685.0600), SIMDE_FLOAT64_C(    0.5000), SIMDE_FLOAT64_C(1.7976931348623157e+308),              SIMDE_MATH_NAN } },
+    { { SIMDE_FLOAT64_C( -602.5700), SIMDE_FLOAT64_C(  359.5600), SIMDE_FLOAT64_C(  501.4000), SIMDE_FLOAT64_C(  512.0200),
+        SIMDE_FLOAT64_C( -475.6800), SIMDE_FLOAT64_C( -931.0200), SIMDE_FLOAT64_C( -254.3800), SIMDE_FLOAT64_C( -193.5500) },
+      UINT8_C(209),
+      { SIMDE_FLOAT64_C( -347.0800), SIMDE_FLOAT64_C( -786.3100), SIMDE_FLOAT64_C(  271.8400), SIMDE_FLOAT64_C(  232.6700),
+        SIMDE_FLOAT64_C( -965.6800), SIMDE_FLOAT64_C(    1.0000), SIMDE_FLOAT64_C( -454.3200), SIMDE_FLOAT64_C(    1.0000) },
+      {  INT64_C( 6888331209029431989), -INT64_C(  376877827515123447), -INT64_C(  811457190011119295),  INT64_C( 8712121677891998881),
+         INT64_C( 1131019749667319694),  INT64_C( 7793497442335336643),  INT64_C( 3185226149359447990), -INT64_C( 8745665695088596076) },
+      { SIMDE_FLOAT64_C(   -1.0000), SIMDE_FLOAT64_C(  359.5600), SIMDE_FLOAT64_C(  501.4000), SIMDE_FLOAT64_C(  512.0200),
+        SIMDE_FLOAT64_C(   90.0000), SIMDE_FLOAT64_C( -931.0200), SIMDE_FLOAT64_C(   -1.0000), SIMDE_FLOAT64_C(    1.0000) } },
+    { { SIMDE_FLOAT64_C( -282.7400), SIMDE_FLOAT64_C(  233.5400), SIMDE_FLOAT64_C( -493.5400), SIMDE_FLOAT64_C( -927.3300),
+        SIMDE_FLOAT64_C(    1.0000),         SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(  915.6200), SIMDE_FLOAT64_C(  727.7300) },
+      UINT8_C(213),
+      { SIMDE_FLOAT64_C(  577.2500), SIMDE_FLOAT64_C(  187.8300), SIMDE_FLOAT64_C(  604.8300), SIMDE_FLOAT64_C(   74.2700),
+        SIMDE_FLOAT64_C( -884.5200), SIMDE_FLOAT64_C(  515.5300),         SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(  451.4500) },
+      {  INT64_C(  722854594536981496),  INT64_C( 5846589278277575766), -INT64_C( 2076723581022727915), -INT64_C( 1087071059300981238),
+         INT64_C( 6456696446478516521), -INT64_C( 5474523558641454727), -INT64_C( 2794681797964945581),  INT64_C( 8775855646300198972) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(  233.5400), SIMDE_FLOAT64_C(-1.7976931348623157e+308), SIMDE_FLOAT64_C( -927.3300),
+                     SIMDE_MATH_NAN,         SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(  915.6200), SIMDE_FLOAT64_C(    0.5000) } },
+    { { SIMDE_FLOAT64_C( -170.4200), SIMDE_FLOAT64_C(  854.2500), SIMDE_FLOAT64_C(  463.2900), SIMDE_FLOAT64_C( -856.6500),
+        SIMDE_FLOAT64_C(  292.3700), SIMDE_FLOAT64_C( -145.7700), SIMDE_FLOAT64_C(  147.8800), SIMDE_FLOAT64_C( -601.4400) },
+      UINT8_C( 29),
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(  206.9000), SIMDE_FLOAT64_C(  673.7400), SIMDE_FLOAT64_C( -571.1800),
+        SIMDE_FLOAT64_C(  705.4600), SIMDE_FLOAT64_C(  362.7200), SIMDE_FLOAT64_C( -842.0200),         SIMDE_MATH_INFINITY },
+      { -INT64_C( 6877166973000907652),  INT64_C( 4264313216285681379), -INT64_C( 7173451695520665337),  INT64_C( 2124929340985207531),
+        -INT64_C( 1038040042905653019),  INT64_C(  943926844895413334), -INT64_C( 7428375861028466519),  INT64_C( 2164779614205943577) },
+      {        -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(  854.2500), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(1.7976931348623157e+308),
+        SIMDE_FLOAT64_C(    1.0000), SIMDE_FLOAT64_C( -145.7700), SIMDE_FLOAT64_C(  147.8800), SIMDE_FLOAT64_C( -601.4400) } },
+    { { SIMDE_FLOAT64_C(  204.3800), SIMDE_FLOAT64_C(   53.8300), SIMDE_FLOAT64_C(  188.1800), SIMDE_FLOAT64_C(  332.8200),
+        SIMDE_FLOAT64_C(  420.6400), SIMDE_FLOAT64_C(   -0.0000), SIMDE_FLOAT64_C(   48.2500), SIMDE_FLOAT64_C(  394.8800) },
+      UINT8_C( 10),
+      { SIMDE_FLOAT64_C(  -55.9600), SIMDE_FLOAT64_C( -872.4800), SIMDE_FLOAT64_C(  306.8200), SIMDE_FLOAT64_C(  387.3600),
+        SIMDE_FLOAT64_C( -497.4000), SIMDE_FLOAT64_C(  954.7700), SIMDE_FLOAT64_C(  970.5400), SIMDE_FLOAT64_C(  873.7300) },
+      { -INT64_C( 7303990369564264625),  INT64_C( 4046692543491009339), -INT64_C( 4036326180805460582),  INT64_C(  459070246001211990),
+        -INT64_C( 4518498589211345326), -INT64_C( 3938570405297299502),  INT64_C( 3612660334699233876),  INT64_C( 3385312108403575770) },
+      { SIMDE_FLOAT64_C(  204.3800),              SIMDE_MATH_NAN, SIMDE_FLOAT64_C(  188.1800), SIMDE_FLOAT64_C(    1.5708),
+        SIMDE_FLOAT64_C(  420.6400), SIMDE_FLOAT64_C(   -0.0000), SIMDE_FLOAT64_C(   48.2500), SIMDE_FLOAT64_C(  394.8800) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d b = simde_mm512_loadu_pd(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi64(test_vec[i].c);
+    simde__m512d r = simde_mm512_mask_fixupimm_pd(a, test_vec[i].k, b, c, 0);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_fixupimm_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 b[8];
+    const int64_t c[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { UINT8_C( 30),
+      { SIMDE_FLOAT64_C(  -94.5200), SIMDE_FLOAT64_C(  520.1000), SIMDE_FLOAT64_C( -522.2200), SIMDE_FLOAT64_C(  296.9100),
+        SIMDE_FLOAT64_C(  511.1700), SIMDE_FLOAT64_C(   -0.0000), SIMDE_FLOAT64_C(  203.6200),        -SIMDE_MATH_INFINITY },
+      { SIMDE_FLOAT64_C( -992.8600), SIMDE_FLOAT64_C( -415.0500), SIMDE_FLOAT64_C(  798.2900), SIMDE_FLOAT64_C( -400.0500),
+        SIMDE_FLOAT64_C(  134.5000), SIMDE_FLOAT64_C(  851.5300), SIMDE_FLOAT64_C(  905.8500), SIMDE_FLOAT64_C( -300.3200) },
+      {  INT64_C( 8458151451442197253), -INT64_C( 4461806194160534293),  INT64_C(  812687896306616497), -INT64_C( 2546999031590690599),
+         INT64_C( 7654577742863781543),  INT64_C( 3926675357793801798), -INT64_C(  461486504427423276),  INT64_C( 2343510286531836992) },
+      { SIMDE_FLOAT64_C(    0.0000),        -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(-1.7976931348623157e+308),        -SIMDE_MATH_INFINITY,
+        SIMDE_FLOAT64_C(   90.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C(130),
+      { SIMDE_FLOAT64_C( -608.9300), SIMDE_FLOAT64_C(  750.4400), SIMDE_FLOAT64_C( -847.5700), SIMDE_FLOAT64_C( -199.1800),
+        SIMDE_FLOAT64_C(   80.9900), SIMDE_FLOAT64_C(  628.7800), SIMDE_FLOAT64_C(  -50.5000),              SIMDE_MATH_NAN },
+      { SIMDE_FLOAT64_C(  806.3600), SIMDE_FLOAT64_C( -728.2800), SIMDE_FLOAT64_C(    1.0000), SIMDE_FLOAT64_C( -379.5100),
+        SIMDE_FLOAT64_C(  974.3000), SIMDE_FLOAT64_C( -914.6700), SIMDE_FLOAT64_C( -170.4100), SIMDE_FLOAT64_C( -288.1300) },
+      { -INT64_C( 5469047267154781306), -INT64_C( 2821726014332310867),  INT64_C( 4308507976371934849),  INT64_C( 3161532057381140611),
+         INT64_C( 9170785784748424887),  INT64_C( 8261701778665374893),  INT64_C( 6008681443578339370),  INT64_C( 6008362774782146267) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(1.7976931348623157e+308), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C( 53),
+      { SIMDE_FLOAT64_C(   97.0800), SIMDE_FLOAT64_C( -535.8600), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(  290.9800),
+        SIMDE_FLOAT64_C( -723.9100), SIMDE_FLOAT64_C( -625.2200), SIMDE_FLOAT64_C(  523.5700), SIMDE_FLOAT64_C(  693.1100) },
+      { SIMDE_FLOAT64_C(  -83.0200), SIMDE_FLOAT64_C(  204.3000), SIMDE_FLOAT64_C(  236.2800),        -SIMDE_MATH_INFINITY,
+        SIMDE_FLOAT64_C( -725.9300), SIMDE_FLOAT64_C( -990.7600), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C( -481.0300) },
+      {  INT64_C( 7784569672281236609), -INT64_C( 8906958300451272776),  INT64_C( 3506975193168465553),  INT64_C( 6087993344430871434),
+        -INT64_C( 6790257362813654574), -INT64_C( 3415535632173673492), -INT64_C( 8851444976460383615), -INT64_C( 1095614726160906674) },
+      { SIMDE_FLOAT64_C(    1.5708), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000),
+               -SIMDE_MATH_INFINITY,        -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C(135),
+      { SIMDE_FLOAT64_C(  916.0000), SIMDE_FLOAT64_C(   -0.0000), SIMDE_FLOAT64_C( -673.7800), SIMDE_FLOAT64_C(  176.3900),
+        SIMDE_FLOAT64_C(  916.6900), SIMDE_FLOAT64_C( -924.7800), SIMDE_FLOAT64_C( -732.1400), SIMDE_FLOAT64_C(  129.9100) },
+      { SIMDE_FLOAT64_C(  644.2600), SIMDE_FLOAT64_C(    1.0000), SIMDE_FLOAT64_C(   88.4200), SIMDE_FLOAT64_C(  546.5800),
+        SIMDE_FLOAT64_C(  218.2000), SIMDE_FLOAT64_C( -663.0800), SIMDE_FLOAT64_C( -145.7100), SIMDE_FLOAT64_C( -621.0200) },
+      { -INT64_C( 1843011953319824575),  INT64_C(  681635682133871341), -INT64_C( 8747218744416384839), -INT64_C( 7635103825081149725),
+        -INT64_C( 5506592569463655805),  INT64_C( 3397903082406341106),  INT64_C( 4634815935691264383),  INT64_C( 5444382079837437020) },
+      { SIMDE_FLOAT64_C(    1.0000), SIMDE_FLOAT64_C(   -0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000),              SIMDE_MATH_NAN } },
+    { UINT8_C( 21),
+      { SIMDE_FLOAT64_C(  371.1500), SIMDE_FLOAT64_C(  -54.4600), SIMDE_FLOAT64_C(  538.2900), SIMDE_FLOAT64_C( -312.6100),
+        SIMDE_FLOAT64_C(   93.8900), SIMDE_FLOAT64_C(  210.9800), SIMDE_FLOAT64_C(  200.7300), SIMDE_FLOAT64_C( -803.9900) },
+      { SIMDE_FLOAT64_C(  821.3500), SIMDE_FLOAT64_C( -800.6500),        -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C( -764.2100),
+        SIMDE_FLOAT64_C( -811.3400), SIMDE_FLOAT64_C( -390.5400), SIMDE_FLOAT64_C(  588.7400), SIMDE_FLOAT64_C(  610.4000) },
+      {  INT64_C( 3315247651787496058),  INT64_C( 5309850507525915612), -INT64_C( 5073770460732548859),  INT64_C(   55096840795376004),
+         INT64_C( 4543482030882466296), -INT64_C( 3598690783460469059),  INT64_C( 8871842198309729975), -INT64_C( 6681663894136034163) },
+      { SIMDE_FLOAT64_C(    1.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    1.0000), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(1.7976931348623157e+308), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C(228),
+      { SIMDE_FLOAT64_C(    1.0000), SIMDE_FLOAT64_C(  753.7000), SIMDE_FLOAT64_C( -260.7700), SIMDE_FLOAT64_C(  160.6200),
+        SIMDE_FLOAT64_C(   -0.0000), SIMDE_FLOAT64_C( -939.4400), SIMDE_FLOAT64_C( -794.6200), SIMDE_FLOAT64_C(   11.6000) },
+      { SIMDE_FLOAT64_C(   -6.7500), SIMDE_FLOAT64_C( -122.8200), SIMDE_FLOAT64_C(  238.6900), SIMDE_FLOAT64_C(   -0.0000),
+        SIMDE_FLOAT64_C( -345.4800), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(  294.9000), SIMDE_FLOAT64_C(  687.0200) },
+      { -INT64_C( 6945969600402617541),  INT64_C( 2961459614365331356), -INT64_C( 8909199324112751397), -INT64_C( 5665094565657761499),
+        -INT64_C(    2235482644187194),  INT64_C( 1663499806157623738),  INT64_C(  818452899056618347),  INT64_C( 2492626752215837897) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(1.7976931348623157e+308), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000),        -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(  687.0200) } },
+    { UINT8_C(182),
+      { SIMDE_FLOAT64_C(  485.1000), SIMDE_FLOAT64_C( -511.9400), SIMDE_FLOAT64_C(  235.6900), SIMDE_FLOAT64_C(  231.8100),
+        SIMDE_FLOAT64_C(  402.9400), SIMDE_FLOAT64_C(  424.1000), SIMDE_FLOAT64_C(  420.6500), SIMDE_FLOAT64_C( -357.6400) },
+      { SIMDE_FLOAT64_C(  -88.4300), SIMDE_FLOAT64_C(  854.4900), SIMDE_FLOAT64_C( -846.0100), SIMDE_FLOAT64_C( -869.3800),
+        SIMDE_FLOAT64_C(  702.7600), SIMDE_FLOAT64_C( -942.8000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(  872.4300) },
+      {  INT64_C( 5113239727076733803), -INT64_C( 5156956079653902246),  INT64_C( 5847191542772914425),  INT64_C( 4072905918322038949),
+         INT64_C( 3098386956508932566),  INT64_C( 2836470727883958200), -INT64_C( 5275663549177299085),  INT64_C( 4281181662645963393) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    1.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000),
+                SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(   -0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(  872.4300) } },
+    { UINT8_C(191),
+      { SIMDE_FLOAT64_C( -258.3800), SIMDE_FLOAT64_C( -447.6600), SIMDE_FLOAT64_C( -884.1900), SIMDE_FLOAT64_C(   69.8800),
+                SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C( -344.9400), SIMDE_FLOAT64_C( -184.6100), SIMDE_FLOAT64_C( -211.3500) },
+      { SIMDE_FLOAT64_C(  567.5000), SIMDE_FLOAT64_C( -266.3200), SIMDE_FLOAT64_C(  207.1500), SIMDE_FLOAT64_C( -385.9400),
+        SIMDE_FLOAT64_C(  367.5900), SIMDE_FLOAT64_C(  950.8000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C( -865.6000) },
+      { -INT64_C( 4493200600635985948), -INT64_C( 7740570319783405616), -INT64_C( 8491453126583666559),  INT64_C(  541234061297122049),
+        -INT64_C( 1334839798282486919),  INT64_C( 5778813713695699418), -INT64_C( 3787568389984290866), -INT64_C( 7653849766125601272) },
+      { SIMDE_FLOAT64_C(  567.5000),              SIMDE_MATH_NAN, SIMDE_FLOAT64_C(-1.7976931348623157e+308), SIMDE_FLOAT64_C(    0.5000),
+        SIMDE_FLOAT64_C(   -1.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000),         SIMDE_MATH_INFINITY } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d b = simde_mm512_loadu_pd(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi64(test_vec[i].c);
+    simde__m512d r = simde_mm512_maskz_fixupimm_pd(test_vec[i].k, a, b, c, 0);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_fixupimm_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_fixupimm_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_fixupimm_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_fixupimm_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_fixupimm_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_fixupimm_pd)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,1335 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN gather
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/gather.h>
+
+static const int32_t test_gather_i32[32] = {
+  -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+   INT32_C(   310840079), -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1128593813), -INT32_C(  1249725146), -INT32_C(  1351075380),  INT32_C(  1987001023),
+  -INT32_C(  1039226102), -INT32_C(  1594280740),  INT32_C(  1912893877),  INT32_C(  2112271382),  INT32_C(   969850110), -INT32_C(  1853628921),  INT32_C(  1029814395),  INT32_C(  1709966795),
+  -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307)
+};
+
+static const int64_t test_gather_i64[32] = {
+   INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+   INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+   INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+   INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+   INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+  -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+   INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+   INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600)
+};
+
+static const simde_float32 test_gather_f32[32] = {
+  SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+  SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+  SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+  SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -443.95),
+  SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -739.50),
+  SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -367.96),
+  SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+  SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55)
+};
+
+static const simde_float64 test_gather_f64[32] = {
+  SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+  SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+  SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+  SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+  SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+  SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+  SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+  SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50)
+};
+
+static int
+test_simde_mm_mmask_i32gather_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int32_t vindex[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(   231451521), -INT32_C(   496712937), -INT32_C(  2142228655), -INT32_C(   936412337) },
+      UINT8_C(  0),
+      {  INT32_C(           9),  INT32_C(           5), -INT32_C(           3),  INT32_C(          10) },
+      { -INT32_C(   231451521), -INT32_C(   496712937), -INT32_C(  2142228655), -INT32_C(   936412337) } },
+    { { -INT32_C(   583651110),  INT32_C(  2137860667),  INT32_C(   381689519), -INT32_C(   543435438) },
+      UINT8_C( 15),
+      {  INT32_C(           8),  INT32_C(           4), -INT32_C(           5),  INT32_C(          15) },
+      { -INT32_C(  1868574976),  INT32_C(   969850110),  INT32_C(  1850267257),  INT32_C(  1867292307) } },
+    { {  INT32_C(  1889324880), -INT32_C(   113761586),  INT32_C(  1082990859), -INT32_C(   327738999) },
+      UINT8_C(183),
+      {  INT32_C(          10),  INT32_C(           1),  INT32_C(           5),  INT32_C(          14) },
+      {  INT32_C(  1333917055), -INT32_C(  1594280740), -INT32_C(  1853628921), -INT32_C(   327738999) } },
+    { {  INT32_C(    70522200),  INT32_C(   829827954),  INT32_C(  1589140388),  INT32_C(   423707155) },
+      UINT8_C( 92),
+      {  INT32_C(           7),  INT32_C(          15), -INT32_C(          16), -INT32_C(          11) },
+      {  INT32_C(    70522200),  INT32_C(   829827954), -INT32_C(   358030361), -INT32_C(  1099749183) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m128i r = simde_mm_mmask_i32gather_epi32(src, test_vec[i].k, vindex, &(test_gather_i32[16]), 4);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mmask_i32gather_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[2];
+    const simde__mmask8 k;
+    const int32_t vindex[4];
+    const int64_t r[2];
+  } test_vec[] = {
+    { {  INT64_C( 6754777804233758586),  INT64_C( 3549867335520443988) },
+      UINT8_C(  0),
+      { -INT32_C(           8), -INT32_C(           5),  INT32_C(           6),  INT32_C(           1) },
+      {  INT64_C( 6754777804233758586),  INT64_C( 3549867335520443988) } },
+    { { -INT64_C( 5066349549366083586), -INT64_C( 5952660339413424767) },
+      UINT8_C(  3),
+      { -INT32_C(           6),  INT32_C(           2), -INT32_C(           4),  INT32_C(           3) },
+      { -INT64_C( 6977536476063400421), -INT64_C( 7360632097894753427) } },
+    { { -INT64_C( 6330120053862207917), -INT64_C( 3096380104702462897) },
+      UINT8_C( 45),
+      { -INT32_C(           9),  INT32_C(           5), -INT32_C(           2), -INT32_C(          12) },
+      {  INT64_C( 7528886499374654773), -INT64_C( 3096380104702462897) } },
+    { { -INT64_C( 4223010763178111508),  INT64_C(  410745371115571959) },
+      UINT8_C(197),
+      { -INT32_C(          14), -INT32_C(           9), -INT32_C(           6),  INT32_C(           2) },
+      { -INT64_C( 4447920984375902666),  INT64_C(  410745371115571959) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi64(test_vec[i].src);
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m128i r = simde_mm_mmask_i32gather_epi64(src, test_vec[i].k, vindex, &(test_gather_i64[16]), 8);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mmask_i32gather_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[2];
+    const simde__mmask8 k;
+    const int32_t vindex[4];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   770.14), SIMDE_FLOAT64_C(   917.98) },
+      UINT8_C(  0),
+      { -INT32_C(           7),  INT32_C(          15), -INT32_C(           1), -INT32_C(           4) },
+      { SIMDE_FLOAT64_C(   770.14), SIMDE_FLOAT64_C(   917.98) } },
+    { { SIMDE_FLOAT64_C(    33.24), SIMDE_FLOAT64_C(   585.98) },
+      UINT8_C(  3),
+      {  INT32_C(           2),  INT32_C(           1), -INT32_C(          10), -INT32_C(           9) },
+      { SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(    39.93) } },
+    { { SIMDE_FLOAT64_C(   678.93), SIMDE_FLOAT64_C(  -631.04) },
+      UINT8_C(172),
+      { -INT32_C(          15), -INT32_C(          14), -INT32_C(          15),  INT32_C(           1) },
+      { SIMDE_FLOAT64_C(   678.93), SIMDE_FLOAT64_C(  -631.04) } },
+    { { SIMDE_FLOAT64_C(   154.61), SIMDE_FLOAT64_C(  -328.99) },
+      UINT8_C(  9),
+      { -INT32_C(          13), -INT32_C(           9), -INT32_C(          12),  INT32_C(           2) },
+      { SIMDE_FLOAT64_C(  -605.67), SIMDE_FLOAT64_C(  -328.99) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d src = simde_mm_loadu_pd(test_vec[i].src);
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m128d r = simde_mm_mmask_i32gather_pd(src, test_vec[i].k, vindex, &(test_gather_f64[16]), 8);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mmask_i32gather_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[4];
+    const simde__mmask8 k;
+    const int32_t vindex[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   583.74), SIMDE_FLOAT32_C(  -624.55), SIMDE_FLOAT32_C(  -799.72), SIMDE_FLOAT32_C(   321.82) },
+      UINT8_C(  0),
+      { -INT32_C(           8),  INT32_C(           4), -INT32_C(          14),  INT32_C(          15) },
+      { SIMDE_FLOAT32_C(   583.74), SIMDE_FLOAT32_C(  -624.55), SIMDE_FLOAT32_C(  -799.72), SIMDE_FLOAT32_C(   321.82) } },
+    { { SIMDE_FLOAT32_C(  -559.15), SIMDE_FLOAT32_C(   235.14), SIMDE_FLOAT32_C(  -536.61), SIMDE_FLOAT32_C(   122.36) },
+      UINT8_C( 15),
+      {  INT32_C(          11),  INT32_C(           0), -INT32_C(           7), -INT32_C(           7) },
+      { SIMDE_FLOAT32_C(  -371.72), SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(   626.68) } },
+    { { SIMDE_FLOAT32_C(  -712.58), SIMDE_FLOAT32_C(   207.43), SIMDE_FLOAT32_C(   419.61), SIMDE_FLOAT32_C(   477.24) },
+      UINT8_C( 48),
+      { -INT32_C(          12), -INT32_C(           6), -INT32_C(           2), -INT32_C(           3) },
+      { SIMDE_FLOAT32_C(  -712.58), SIMDE_FLOAT32_C(   207.43), SIMDE_FLOAT32_C(   419.61), SIMDE_FLOAT32_C(   477.24) } },
+    { { SIMDE_FLOAT32_C(  -641.90), SIMDE_FLOAT32_C(   743.68), SIMDE_FLOAT32_C(   703.02), SIMDE_FLOAT32_C(  -789.59) },
+      UINT8_C(133),
+      {  INT32_C(          15), -INT32_C(           1),  INT32_C(          11),  INT32_C(           4) },
+      { SIMDE_FLOAT32_C(   112.55), SIMDE_FLOAT32_C(   743.68), SIMDE_FLOAT32_C(  -371.72), SIMDE_FLOAT32_C(  -789.59) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 src = simde_mm_loadu_ps(test_vec[i].src);
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m128 r = simde_mm_mmask_i32gather_ps(src, test_vec[i].k, vindex, &(test_gather_f32[16]), 4);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mmask_i64gather_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int64_t vindex[2];
+    const int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C(   980494962), -INT32_C(  1907551066),  INT32_C(    10381071),  INT32_C(    31815681) },
+      UINT8_C(  0),
+      {  INT64_C(                   1),  INT64_C(                   4) },
+      {  INT32_C(   980494962), -INT32_C(  1907551066),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT32_C(  1893788600), -INT32_C(   376620960),  INT32_C(  1111243280),  INT32_C(  1883031140) },
+      UINT8_C(  3),
+      { -INT64_C(                   8), -INT64_C(                  11) },
+      {  INT32_C(   310840079), -INT32_C(  1099749183),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT32_C(   738424860), -INT32_C(   597755412), -INT32_C(  2024030433),  INT32_C(   572207009) },
+      UINT8_C( 26),
+      {  INT64_C(                  14),  INT64_C(                  13) },
+      {  INT32_C(   738424860), -INT32_C(   945185370),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT32_C(  1899038762),  INT32_C(   132538297),  INT32_C(   419781958), -INT32_C(   684669316) },
+      UINT8_C( 82),
+      {  INT64_C(                   0), -INT64_C(                  15) },
+      { -INT32_C(  1899038762),  INT32_C(   486124512),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i vindex = simde_x_mm_loadu_epi64(test_vec[i].vindex);
+    simde__m128i r = simde_mm_mmask_i64gather_epi32(src, test_vec[i].k, vindex, &(test_gather_i32[16]), 4);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mmask_i64gather_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[2];
+    const simde__mmask8 k;
+    const int64_t vindex[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { { -INT64_C( 6737883151112157337), -INT64_C( 2917492478690049239) },
+      UINT8_C(  0),
+      { -INT64_C(                   1), -INT64_C(                  12) },
+      { -INT64_C( 6737883151112157337), -INT64_C( 2917492478690049239) } },
+    { {  INT64_C( 4610076925354488918),  INT64_C( 4494863741200143550) },
+      UINT8_C(  3),
+      {  INT64_C(                   7),  INT64_C(                   3) },
+      { -INT64_C( 3740680337104392824), -INT64_C( 1774777017819125221) } },
+    { { -INT64_C( 4266457810913745162), -INT64_C( 5654497847802049477) },
+      UINT8_C(189),
+      { -INT64_C(                  13),  INT64_C(                   7) },
+      { -INT64_C( 2896957826357560630), -INT64_C( 5654497847802049477) } },
+    { { -INT64_C( 1901496157936508243), -INT64_C( 3968992844273061720) },
+      UINT8_C(158),
+      { -INT64_C(                   7),  INT64_C(                   9) },
+      { -INT64_C( 1901496157936508243), -INT64_C( 2264795002708770330) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi64(test_vec[i].src);
+    simde__m128i vindex = simde_x_mm_loadu_epi64(test_vec[i].vindex);
+    simde__m128i r = simde_mm_mmask_i64gather_epi64(src, test_vec[i].k, vindex, &(test_gather_i64[16]), 8);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mmask_i64gather_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[2];
+    const simde__mmask8 k;
+    const int64_t vindex[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   833.68), SIMDE_FLOAT64_C(  -352.96) },
+      UINT8_C(  0),
+      {  INT64_C(                   7), -INT64_C(                  11) },
+      { SIMDE_FLOAT64_C(   833.68), SIMDE_FLOAT64_C(  -352.96) } },
+    { { SIMDE_FLOAT64_C(   554.91), SIMDE_FLOAT64_C(   714.70) },
+      UINT8_C(  3),
+      {  INT64_C(                   2),  INT64_C(                   0) },
+      { SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(  -587.14) } },
+    { { SIMDE_FLOAT64_C(    80.87), SIMDE_FLOAT64_C(    85.10) },
+      UINT8_C(254),
+      { -INT64_C(                  13), -INT64_C(                   8) },
+      { SIMDE_FLOAT64_C(    80.87), SIMDE_FLOAT64_C(   651.31) } },
+    { { SIMDE_FLOAT64_C(   552.49), SIMDE_FLOAT64_C(  -933.05) },
+      UINT8_C( 55),
+      {  INT64_C(                   0),  INT64_C(                   6) },
+      { SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(   736.90) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d src = simde_mm_loadu_pd(test_vec[i].src);
+    simde__m128i vindex = simde_x_mm_loadu_epi64(test_vec[i].vindex);
+    simde__m128d r = simde_mm_mmask_i64gather_pd(src, test_vec[i].k, vindex, &(test_gather_f64[16]), 8);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mmask_i64gather_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[4];
+    const simde__mmask8 k;
+    const int64_t vindex[2];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   440.70), SIMDE_FLOAT32_C(    53.27), SIMDE_FLOAT32_C(   333.36), SIMDE_FLOAT32_C(  -536.37) },
+      UINT8_C(  0),
+      { -INT64_C(                  16),  INT64_C(                  12) },
+      { SIMDE_FLOAT32_C(   440.70), SIMDE_FLOAT32_C(    53.27), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { { SIMDE_FLOAT32_C(  -646.71), SIMDE_FLOAT32_C(  -701.95), SIMDE_FLOAT32_C(   851.68), SIMDE_FLOAT32_C(   490.00) },
+      UINT8_C(  3),
+      { -INT64_C(                  15),  INT64_C(                  10) },
+      { SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { { SIMDE_FLOAT32_C(   424.41), SIMDE_FLOAT32_C(   279.50), SIMDE_FLOAT32_C(   219.45), SIMDE_FLOAT32_C(   442.97) },
+      UINT8_C(242),
+      {  INT64_C(                   2),  INT64_C(                   2) },
+      { SIMDE_FLOAT32_C(   424.41), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } },
+    { { SIMDE_FLOAT32_C(   -28.74), SIMDE_FLOAT32_C(   487.91), SIMDE_FLOAT32_C(   392.52), SIMDE_FLOAT32_C(   954.10) },
+      UINT8_C( 26),
+      { -INT64_C(                  13), -INT64_C(                   2) },
+      { SIMDE_FLOAT32_C(   -28.74), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(     0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 src = simde_mm_loadu_ps(test_vec[i].src);
+    simde__m128i vindex = simde_x_mm_loadu_epi64(test_vec[i].vindex);
+    simde__m128 r = simde_mm_mmask_i64gather_ps(src, test_vec[i].k, vindex, &(test_gather_f32[16]), 4);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mmask_i32gather_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const simde__mmask8 k;
+    const int32_t vindex[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { {  INT32_C(  1056849434), -INT32_C(   922549018),  INT32_C(  1309866863),  INT32_C(  1274013017), -INT32_C(   309572397), -INT32_C(   339083126),  INT32_C(  1486550539),  INT32_C(   874062119) },
+      UINT8_C(  0),
+      { -INT32_C(          11),  INT32_C(           0), -INT32_C(           7), -INT32_C(          12),  INT32_C(           9), -INT32_C(           3), -INT32_C(          10), -INT32_C(           2) },
+      {  INT32_C(  1056849434), -INT32_C(   922549018),  INT32_C(  1309866863),  INT32_C(  1274013017), -INT32_C(   309572397), -INT32_C(   339083126),  INT32_C(  1486550539),  INT32_C(   874062119) } },
+    { { -INT32_C(  1548401972), -INT32_C(   244769975),  INT32_C(   635059007), -INT32_C(   580214647),  INT32_C(   158955400), -INT32_C(   519477401),  INT32_C(   179063913), -INT32_C(  1991954767) },
+      UINT8_C(255),
+      { -INT32_C(           4),  INT32_C(          13),  INT32_C(           2), -INT32_C(          15),  INT32_C(          14), -INT32_C(          14),  INT32_C(           0),  INT32_C(          12) },
+      {  INT32_C(  1128593813), -INT32_C(   945185370),  INT32_C(  1912893877),  INT32_C(   486124512),  INT32_C(  1338992413),  INT32_C(  1488494775), -INT32_C(  1039226102),  INT32_C(  2140565639) } },
+    { { -INT32_C(  1553894543),  INT32_C(   498814423),  INT32_C(  1139912332), -INT32_C(  1922142511),  INT32_C(  1252861516),  INT32_C(  1907912448),  INT32_C(  1998381022), -INT32_C(  1828924959) },
+      UINT8_C(150),
+      { -INT32_C(          14), -INT32_C(          14),  INT32_C(           6),  INT32_C(           1), -INT32_C(           2),  INT32_C(          10),  INT32_C(           2),  INT32_C(          14) },
+      { -INT32_C(  1553894543),  INT32_C(  1488494775),  INT32_C(  1029814395), -INT32_C(  1922142511), -INT32_C(  1351075380),  INT32_C(  1907912448),  INT32_C(  1998381022),  INT32_C(  1338992413) } },
+    { { -INT32_C(   711201210),  INT32_C(  1563920410), -INT32_C(  2038914678), -INT32_C(  1006669239), -INT32_C(  1774764307), -INT32_C(   693548080),  INT32_C(   648211783),  INT32_C(   927340893) },
+      UINT8_C(165),
+      { -INT32_C(           1), -INT32_C(           5),  INT32_C(           5), -INT32_C(          16),  INT32_C(          10),  INT32_C(           3), -INT32_C(           3),  INT32_C(          13) },
+      {  INT32_C(  1987001023),  INT32_C(  1563920410), -INT32_C(  1853628921), -INT32_C(  1006669239), -INT32_C(  1774764307),  INT32_C(  2112271382),  INT32_C(   648211783), -INT32_C(   945185370) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i vindex = simde_x_mm256_loadu_epi32(test_vec[i].vindex);
+    simde__m256i r = simde_mm256_mmask_i32gather_epi32(src, test_vec[i].k, vindex, &(test_gather_i32[16]), 4);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mmask_i32gather_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[4];
+    const simde__mmask8 k;
+    const int32_t vindex[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { { -INT64_C(  939727286587253812),  INT64_C( 2111860000846683131),  INT64_C( 4116086211083804684),  INT64_C( 1984495079724692044) },
+      UINT8_C(  0),
+      { -INT32_C(           8), -INT32_C(           6), -INT32_C(          12), -INT32_C(          11) },
+      { -INT64_C(  939727286587253812),  INT64_C( 2111860000846683131),  INT64_C( 4116086211083804684),  INT64_C( 1984495079724692044) } },
+    { { -INT64_C(  121582959807995826), -INT64_C( 7925435240489583346),  INT64_C( 2593627800630426740),  INT64_C( 1348752140442447756) },
+      UINT8_C( 15),
+      {  INT32_C(           3),  INT32_C(           0),  INT32_C(           9),  INT32_C(          11) },
+      { -INT64_C( 1774777017819125221),  INT64_C(  667667952135182694), -INT64_C( 2264795002708770330),  INT64_C( 4481670887097906574) } },
+    { {  INT64_C( 5553498850642159305), -INT64_C( 2988659308391934652),  INT64_C( 4215289468181201134), -INT64_C( 2223098397081862417) },
+      UINT8_C(160),
+      {  INT32_C(           2),  INT32_C(          15), -INT32_C(           4),  INT32_C(          13) },
+      {  INT64_C( 5553498850642159305), -INT64_C( 2988659308391934652),  INT64_C( 4215289468181201134), -INT64_C( 2223098397081862417) } },
+    { { -INT64_C( 7022242673781433433),  INT64_C( 1275415358676943952), -INT64_C( 7016419416457258792),  INT64_C( 4842539246143913065) },
+      UINT8_C(238),
+      {  INT32_C(           1),  INT32_C(           3),  INT32_C(          13), -INT32_C(          14) },
+      { -INT64_C( 7022242673781433433), -INT64_C( 1774777017819125221), -INT64_C( 8755769881111927631), -INT64_C( 4447920984375902666) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi64(test_vec[i].src);
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m256i r = simde_mm256_mmask_i32gather_epi64(src, test_vec[i].k, vindex, &(test_gather_i64[16]), 8);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mmask_i32gather_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[4];
+    const simde__mmask8 k;
+    const int32_t vindex[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -641.17), SIMDE_FLOAT64_C(  -237.68), SIMDE_FLOAT64_C(  -875.96), SIMDE_FLOAT64_C(   428.61) },
+      UINT8_C(  0),
+      { -INT32_C(          10),  INT32_C(           7),  INT32_C(           1), -INT32_C(           6) },
+      { SIMDE_FLOAT64_C(  -641.17), SIMDE_FLOAT64_C(  -237.68), SIMDE_FLOAT64_C(  -875.96), SIMDE_FLOAT64_C(   428.61) } },
+    { { SIMDE_FLOAT64_C(  -841.16), SIMDE_FLOAT64_C(   166.62), SIMDE_FLOAT64_C(  -516.35), SIMDE_FLOAT64_C(   -12.49) },
+      UINT8_C( 15),
+      { -INT32_C(          10),  INT32_C(           4),  INT32_C(           3),  INT32_C(           4) },
+      { SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(   246.88), SIMDE_FLOAT64_C(   152.40) } },
+    { { SIMDE_FLOAT64_C(  -344.11), SIMDE_FLOAT64_C(   -88.15), SIMDE_FLOAT64_C(   889.46), SIMDE_FLOAT64_C(  -995.89) },
+      UINT8_C( 27),
+      { -INT32_C(           7), -INT32_C(           9),  INT32_C(          12), -INT32_C(           2) },
+      { SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(    19.92), SIMDE_FLOAT64_C(   889.46), SIMDE_FLOAT64_C(   369.26) } },
+    { { SIMDE_FLOAT64_C(   594.11), SIMDE_FLOAT64_C(  -583.71), SIMDE_FLOAT64_C(   548.99), SIMDE_FLOAT64_C(  -725.66) },
+      UINT8_C(  3),
+      {  INT32_C(           3),  INT32_C(          15), -INT32_C(           3), -INT32_C(           2) },
+      { SIMDE_FLOAT64_C(   246.88), SIMDE_FLOAT64_C(  -550.50), SIMDE_FLOAT64_C(   548.99), SIMDE_FLOAT64_C(  -725.66) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d src = simde_mm256_loadu_pd(test_vec[i].src);
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m256d r = simde_mm256_mmask_i32gather_pd(src, test_vec[i].k, vindex, &(test_gather_f64[16]), 8);
+    simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mmask_i32gather_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[8];
+    const simde__mmask8 k;
+    const int32_t vindex[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   868.14), SIMDE_FLOAT32_C(   -54.30), SIMDE_FLOAT32_C(   811.36), SIMDE_FLOAT32_C(  -609.13),
+        SIMDE_FLOAT32_C(  -858.75), SIMDE_FLOAT32_C(  -658.35), SIMDE_FLOAT32_C(   673.22), SIMDE_FLOAT32_C(  -863.18) },
+      UINT8_C(  0),
+      {  INT32_C(          14),  INT32_C(           9), -INT32_C(           7), -INT32_C(           6), -INT32_C(           1),  INT32_C(           5),  INT32_C(          15),  INT32_C(           1) },
+      { SIMDE_FLOAT32_C(   868.14), SIMDE_FLOAT32_C(   -54.30), SIMDE_FLOAT32_C(   811.36), SIMDE_FLOAT32_C(  -609.13),
+        SIMDE_FLOAT32_C(  -858.75), SIMDE_FLOAT32_C(  -658.35), SIMDE_FLOAT32_C(   673.22), SIMDE_FLOAT32_C(  -863.18) } },
+    { { SIMDE_FLOAT32_C(   132.25), SIMDE_FLOAT32_C(  -577.85), SIMDE_FLOAT32_C(   661.88), SIMDE_FLOAT32_C(  -174.58),
+        SIMDE_FLOAT32_C(   640.65), SIMDE_FLOAT32_C(   918.33), SIMDE_FLOAT32_C(   613.28), SIMDE_FLOAT32_C(  -883.41) },
+      UINT8_C(255),
+      { -INT32_C(           8),  INT32_C(          11), -INT32_C(           8),  INT32_C(           1),  INT32_C(          10), -INT32_C(           9), -INT32_C(          10), -INT32_C(           3) },
+      { SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(  -371.72), SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(    37.60),
+        SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(   456.08), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(  -986.44) } },
+    { { SIMDE_FLOAT32_C(   390.64), SIMDE_FLOAT32_C(  -803.15), SIMDE_FLOAT32_C(   285.40), SIMDE_FLOAT32_C(    94.82),
+        SIMDE_FLOAT32_C(  -943.32), SIMDE_FLOAT32_C(  -725.06), SIMDE_FLOAT32_C(  -905.82), SIMDE_FLOAT32_C(   604.20) },
+      UINT8_C(108),
+      { -INT32_C(           7), -INT32_C(           1), -INT32_C(           9),  INT32_C(           6), -INT32_C(           3), -INT32_C(          16),  INT32_C(           0),  INT32_C(           6) },
+      { SIMDE_FLOAT32_C(   390.64), SIMDE_FLOAT32_C(  -803.15), SIMDE_FLOAT32_C(   456.08), SIMDE_FLOAT32_C(  -755.92),
+        SIMDE_FLOAT32_C(  -943.32), SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(   604.20) } },
+    { { SIMDE_FLOAT32_C(   380.86), SIMDE_FLOAT32_C(    -8.43), SIMDE_FLOAT32_C(  -976.24), SIMDE_FLOAT32_C(   572.41),
+        SIMDE_FLOAT32_C(   966.47), SIMDE_FLOAT32_C(  -945.46), SIMDE_FLOAT32_C(  -536.49), SIMDE_FLOAT32_C(   798.58) },
+      UINT8_C(207),
+      { -INT32_C(           8), -INT32_C(           6), -INT32_C(          15), -INT32_C(           2),  INT32_C(           0),  INT32_C(           9),  INT32_C(           6),  INT32_C(           6) },
+      { SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   882.47),
+        SIMDE_FLOAT32_C(   966.47), SIMDE_FLOAT32_C(  -945.46), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -755.92) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 src = simde_mm256_loadu_ps(test_vec[i].src);
+    simde__m256i vindex = simde_x_mm256_loadu_epi32(test_vec[i].vindex);
+    simde__m256 r = simde_mm256_mmask_i32gather_ps(src, test_vec[i].k, vindex, &(test_gather_f32[16]), 4);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mmask_i64gather_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int64_t vindex[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C(   120456829), -INT32_C(   770939599),  INT32_C(   694227387),  INT32_C(  1341185368) },
+      UINT8_C(  0),
+      { -INT64_C(                  14),  INT64_C(                   7), -INT64_C(                   2), -INT64_C(                   5) },
+      {  INT32_C(   120456829), -INT32_C(   770939599),  INT32_C(   694227387),  INT32_C(  1341185368) } },
+    { {  INT32_C(  1643589833),  INT32_C(  1999752424), -INT32_C(  1898736271), -INT32_C(  1246540261) },
+      UINT8_C( 15),
+      { -INT64_C(                   9),  INT64_C(                  11),  INT64_C(                  15),  INT64_C(                   2) },
+      {  INT32_C(  1345360237), -INT32_C(  1553577643),  INT32_C(  1867292307),  INT32_C(  1912893877) } },
+    { { -INT32_C(  1353455967), -INT32_C(   394737364),  INT32_C(   432272318), -INT32_C(   557229095) },
+      UINT8_C( 21),
+      { -INT64_C(                   2),  INT64_C(                   0), -INT64_C(                   3),  INT64_C(                   4) },
+      { -INT32_C(  1351075380), -INT32_C(   394737364), -INT32_C(  1249725146), -INT32_C(   557229095) } },
+    { {  INT32_C(   458779860),  INT32_C(   888498445),  INT32_C(   668557471),  INT32_C(   987829662) },
+      UINT8_C(165),
+      {  INT64_C(                   5),  INT64_C(                   5), -INT64_C(                   2), -INT64_C(                   4) },
+      { -INT32_C(  1853628921),  INT32_C(   888498445), -INT32_C(  1351075380),  INT32_C(   987829662) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m256i vindex = simde_x_mm256_loadu_epi64(test_vec[i].vindex);
+    simde__m128i r = simde_mm256_mmask_i64gather_epi32(src, test_vec[i].k, vindex, &(test_gather_i32[16]), 4);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mmask_i64gather_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[4];
+    const simde__mmask8 k;
+    const int64_t vindex[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { {  INT64_C(  988503780600908132),  INT64_C( 3733759733645992566),  INT64_C( 4718971001713688370),  INT64_C( 4363251107029316940) },
+      UINT8_C(  0),
+      { -INT64_C(                  10),  INT64_C(                   5), -INT64_C(                   5), -INT64_C(                   5) },
+      {  INT64_C(  988503780600908132),  INT64_C( 3733759733645992566),  INT64_C( 4718971001713688370),  INT64_C( 4363251107029316940) } },
+    { {  INT64_C( 6869946979316275250),  INT64_C( 4663346419609993346),  INT64_C(  878797487499707139),  INT64_C( 4726347778358802885) },
+      UINT8_C( 15),
+      {  INT64_C(                   6), -INT64_C(                  10),  INT64_C(                   7), -INT64_C(                   9) },
+      { -INT64_C( 8276905840325447511),  INT64_C( 8192762014127093023), -INT64_C( 3740680337104392824),  INT64_C( 7528886499374654773) } },
+    { {  INT64_C( 5625748704725700340), -INT64_C( 6589787273533020183), -INT64_C(  961377759355263770),  INT64_C( 2049713462042266415) },
+      UINT8_C(137),
+      {  INT64_C(                   9), -INT64_C(                   2), -INT64_C(                  11),  INT64_C(                   9) },
+      { -INT64_C( 2264795002708770330), -INT64_C( 6589787273533020183), -INT64_C(  961377759355263770), -INT64_C( 2264795002708770330) } },
+    { { -INT64_C( 3370726716648611824),  INT64_C( 7665815383764492112),  INT64_C( 1038321069638682862),  INT64_C( 9044810807523856255) },
+      UINT8_C(171),
+      { -INT64_C(                  15), -INT64_C(                   5),  INT64_C(                  10),  INT64_C(                   8) },
+      {  INT64_C( 1109066856903585640), -INT64_C(  229635990459004633),  INT64_C( 1038321069638682862),  INT64_C( 6539278584911493843) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi64(test_vec[i].src);
+    simde__m256i vindex = simde_x_mm256_loadu_epi64(test_vec[i].vindex);
+    simde__m256i r = simde_mm256_mmask_i64gather_epi64(src, test_vec[i].k, vindex, &(test_gather_i64[16]), 8);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mmask_i64gather_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[4];
+    const simde__mmask8 k;
+    const int64_t vindex[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   262.19), SIMDE_FLOAT64_C(    88.89), SIMDE_FLOAT64_C(  -699.00), SIMDE_FLOAT64_C(   883.47) },
+      UINT8_C(  0),
+      { -INT64_C(                  12), -INT64_C(                   7),  INT64_C(                   3), -INT64_C(                  16) },
+      { SIMDE_FLOAT64_C(   262.19), SIMDE_FLOAT64_C(    88.89), SIMDE_FLOAT64_C(  -699.00), SIMDE_FLOAT64_C(   883.47) } },
+    { { SIMDE_FLOAT64_C(     4.82), SIMDE_FLOAT64_C(   227.60), SIMDE_FLOAT64_C(  -709.96), SIMDE_FLOAT64_C(   738.54) },
+      UINT8_C( 15),
+      {  INT64_C(                   4), -INT64_C(                  14), -INT64_C(                   7), -INT64_C(                   6) },
+      { SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32) } },
+    { { SIMDE_FLOAT64_C(  -908.22), SIMDE_FLOAT64_C(  -116.35), SIMDE_FLOAT64_C(   684.43), SIMDE_FLOAT64_C(   844.32) },
+      UINT8_C( 68),
+      { -INT64_C(                  13),  INT64_C(                   2), -INT64_C(                   4), -INT64_C(                  15) },
+      { SIMDE_FLOAT64_C(  -908.22), SIMDE_FLOAT64_C(  -116.35), SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(   844.32) } },
+    { { SIMDE_FLOAT64_C(  -231.65), SIMDE_FLOAT64_C(   946.58), SIMDE_FLOAT64_C(  -248.75), SIMDE_FLOAT64_C(  -754.57) },
+      UINT8_C(246),
+      {  INT64_C(                   6), -INT64_C(                   3), -INT64_C(                   8), -INT64_C(                   6) },
+      { SIMDE_FLOAT64_C(  -231.65), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(  -754.57) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d src = simde_mm256_loadu_pd(test_vec[i].src);
+    simde__m256i vindex = simde_x_mm256_loadu_epi64(test_vec[i].vindex);
+    simde__m256d r = simde_mm256_mmask_i64gather_pd(src, test_vec[i].k, vindex, &(test_gather_f64[16]), 8);
+    simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mmask_i64gather_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[4];
+    const simde__mmask8 k;
+    const int64_t vindex[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -305.47), SIMDE_FLOAT32_C(   851.01), SIMDE_FLOAT32_C(   457.26), SIMDE_FLOAT32_C(  -734.54) },
+      UINT8_C(  0),
+      { -INT64_C(                   6),  INT64_C(                  11), -INT64_C(                  11), -INT64_C(                   7) },
+      { SIMDE_FLOAT32_C(  -305.47), SIMDE_FLOAT32_C(   851.01), SIMDE_FLOAT32_C(   457.26), SIMDE_FLOAT32_C(  -734.54) } },
+    { { SIMDE_FLOAT32_C(  -643.07), SIMDE_FLOAT32_C(    16.95), SIMDE_FLOAT32_C(  -307.97), SIMDE_FLOAT32_C(   697.51) },
+      UINT8_C( 15),
+      { -INT64_C(                  13),  INT64_C(                   7), -INT64_C(                  13), -INT64_C(                   5) },
+      { SIMDE_FLOAT32_C(  -334.57), SIMDE_FLOAT32_C(  -367.96), SIMDE_FLOAT32_C(  -334.57), SIMDE_FLOAT32_C(   559.10) } },
+    { { SIMDE_FLOAT32_C(   407.49), SIMDE_FLOAT32_C(   -33.72), SIMDE_FLOAT32_C(  -986.40), SIMDE_FLOAT32_C(  -601.53) },
+      UINT8_C( 19),
+      {  INT64_C(                   7), -INT64_C(                  10),  INT64_C(                   9),  INT64_C(                   0) },
+      { SIMDE_FLOAT32_C(  -367.96), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(  -986.40), SIMDE_FLOAT32_C(  -601.53) } },
+    { { SIMDE_FLOAT32_C(   626.64), SIMDE_FLOAT32_C(  -283.63), SIMDE_FLOAT32_C(  -585.78), SIMDE_FLOAT32_C(   587.82) },
+      UINT8_C( 86),
+      {  INT64_C(                   9),  INT64_C(                   1), -INT64_C(                   5),  INT64_C(                   6) },
+      { SIMDE_FLOAT32_C(   626.64), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   559.10), SIMDE_FLOAT32_C(   587.82) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 src = simde_mm_loadu_ps(test_vec[i].src);
+    simde__m256i vindex = simde_x_mm256_loadu_epi64(test_vec[i].vindex);
+    simde__m128 r = simde_mm256_mmask_i64gather_ps(src, test_vec[i].k, vindex, &(test_gather_f32[16]), 4);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_i32gather_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t vindex[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { { -INT32_C(           7), -INT32_C(           8), -INT32_C(           5),  INT32_C(           9), -INT32_C(           8), -INT32_C(          10),  INT32_C(           2), -INT32_C(          15),
+         INT32_C(          12),  INT32_C(           4), -INT32_C(          10),  INT32_C(           8),  INT32_C(           3), -INT32_C(           8), -INT32_C(           2),  INT32_C(           7) },
+      { -INT32_C(   911005991),  INT32_C(   310840079),  INT32_C(  1850267257), -INT32_C(   661573474),  INT32_C(   310840079), -INT32_C(  1652695344),  INT32_C(  1912893877),  INT32_C(   486124512),
+         INT32_C(  2140565639),  INT32_C(   969850110), -INT32_C(  1652695344), -INT32_C(  1868574976),  INT32_C(  2112271382),  INT32_C(   310840079), -INT32_C(  1351075380),  INT32_C(  1709966795) } },
+    { {  INT32_C(           0),  INT32_C(          13),  INT32_C(           0),  INT32_C(          12), -INT32_C(           5),  INT32_C(           0), -INT32_C(           7),  INT32_C(           1),
+         INT32_C(          11),  INT32_C(          11), -INT32_C(          11),  INT32_C(           3), -INT32_C(           4), -INT32_C(           7),  INT32_C(          10), -INT32_C(          12) },
+      { -INT32_C(  1039226102), -INT32_C(   945185370), -INT32_C(  1039226102),  INT32_C(  2140565639),  INT32_C(  1850267257), -INT32_C(  1039226102), -INT32_C(   911005991), -INT32_C(  1594280740),
+        -INT32_C(  1553577643), -INT32_C(  1553577643), -INT32_C(  1099749183),  INT32_C(  2112271382),  INT32_C(  1128593813), -INT32_C(   911005991),  INT32_C(  1333917055), -INT32_C(  1749653618) } },
+    { { -INT32_C(          12),  INT32_C(          12), -INT32_C(          16),  INT32_C(           6),  INT32_C(           1),  INT32_C(           6), -INT32_C(          16), -INT32_C(          13),
+         INT32_C(           2),  INT32_C(           0), -INT32_C(          12), -INT32_C(           6), -INT32_C(           5), -INT32_C(           3), -INT32_C(          12),  INT32_C(           7) },
+      { -INT32_C(  1749653618),  INT32_C(  2140565639), -INT32_C(   358030361),  INT32_C(  1029814395), -INT32_C(  1594280740),  INT32_C(  1029814395), -INT32_C(   358030361), -INT32_C(   665117642),
+         INT32_C(  1912893877), -INT32_C(  1039226102), -INT32_C(  1749653618), -INT32_C(  1483024684),  INT32_C(  1850267257), -INT32_C(  1249725146), -INT32_C(  1749653618),  INT32_C(  1709966795) } },
+    { {  INT32_C(          10), -INT32_C(          14), -INT32_C(           3), -INT32_C(           4), -INT32_C(          14),  INT32_C(           5), -INT32_C(          12),  INT32_C(          12),
+         INT32_C(           6), -INT32_C(          12),  INT32_C(           2), -INT32_C(          14),  INT32_C(           9),  INT32_C(          11),  INT32_C(           7), -INT32_C(           8) },
+      {  INT32_C(  1333917055),  INT32_C(  1488494775), -INT32_C(  1249725146),  INT32_C(  1128593813),  INT32_C(  1488494775), -INT32_C(  1853628921), -INT32_C(  1749653618),  INT32_C(  2140565639),
+         INT32_C(  1029814395), -INT32_C(  1749653618),  INT32_C(  1912893877),  INT32_C(  1488494775), -INT32_C(   661573474), -INT32_C(  1553577643),  INT32_C(  1709966795),  INT32_C(   310840079) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i vindex = simde_mm512_loadu_epi32(test_vec[i].vindex);
+    simde__m512i r = simde_mm512_i32gather_epi32(vindex, &(test_gather_i32[16]), 4);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_i32gather_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const simde__mmask16 k;
+    const int32_t vindex[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { { -INT32_C(    29605201),  INT32_C(  1263628778), -INT32_C(  2001409655), -INT32_C(  2053455334),  INT32_C(  1147023646), -INT32_C(  1199502596),  INT32_C(  2134849513),  INT32_C(  2138936262),
+        -INT32_C(  1839376031),  INT32_C(  1579522963), -INT32_C(   532327324), -INT32_C(   775665716), -INT32_C(   318129085),  INT32_C(  1120067579),  INT32_C(  1846002820),  INT32_C(  2007001613) },
+      UINT16_C(    0),
+      {  INT32_C(           9), -INT32_C(           6), -INT32_C(           3), -INT32_C(           5), -INT32_C(           8), -INT32_C(           4), -INT32_C(           3),  INT32_C(           3),
+         INT32_C(          14),  INT32_C(          11), -INT32_C(           9), -INT32_C(           6), -INT32_C(           3),  INT32_C(          12), -INT32_C(          11),  INT32_C(           9) },
+      { -INT32_C(    29605201),  INT32_C(  1263628778), -INT32_C(  2001409655), -INT32_C(  2053455334),  INT32_C(  1147023646), -INT32_C(  1199502596),  INT32_C(  2134849513),  INT32_C(  2138936262),
+        -INT32_C(  1839376031),  INT32_C(  1579522963), -INT32_C(   532327324), -INT32_C(   775665716), -INT32_C(   318129085),  INT32_C(  1120067579),  INT32_C(  1846002820),  INT32_C(  2007001613) } },
+    { { -INT32_C(   490840584), -INT32_C(  1009426621), -INT32_C(  2003352259), -INT32_C(   316766985), -INT32_C(   880319426),  INT32_C(   362980726),  INT32_C(  2029419964), -INT32_C(   492732857),
+         INT32_C(   168119675),  INT32_C(   816806177),  INT32_C(   219303827), -INT32_C(   873336884), -INT32_C(  1279099117), -INT32_C(   477995219), -INT32_C(   493801261),  INT32_C(   870729330) },
+      UINT16_C(65535),
+      {  INT32_C(          14),  INT32_C(           2), -INT32_C(           8), -INT32_C(           6),  INT32_C(          15),  INT32_C(           0), -INT32_C(          16),  INT32_C(           7),
+         INT32_C(          10),  INT32_C(           3), -INT32_C(          13),  INT32_C(           2),  INT32_C(           5), -INT32_C(          15),  INT32_C(          13), -INT32_C(          10) },
+      {  INT32_C(  1338992413),  INT32_C(  1912893877),  INT32_C(   310840079), -INT32_C(  1483024684),  INT32_C(  1867292307), -INT32_C(  1039226102), -INT32_C(   358030361),  INT32_C(  1709966795),
+         INT32_C(  1333917055),  INT32_C(  2112271382), -INT32_C(   665117642),  INT32_C(  1912893877), -INT32_C(  1853628921),  INT32_C(   486124512), -INT32_C(   945185370), -INT32_C(  1652695344) } },
+    { {  INT32_C(  1155606345), -INT32_C(  2142890169), -INT32_C(   243684695), -INT32_C(  2099457092), -INT32_C(  1297349349), -INT32_C(   372671535), -INT32_C(  1779286682),  INT32_C(   750928028),
+         INT32_C(  2049073949),  INT32_C(  1729839259),  INT32_C(  1755459802), -INT32_C(  1299054021),  INT32_C(  1624164607), -INT32_C(  1879143762), -INT32_C(   799007685),  INT32_C(   902214339) },
+      UINT16_C(62319),
+      { -INT32_C(          10),  INT32_C(           8), -INT32_C(          14),  INT32_C(          11), -INT32_C(          10),  INT32_C(           0), -INT32_C(           6), -INT32_C(          10),
+         INT32_C(          13),  INT32_C(          15),  INT32_C(           9),  INT32_C(           5), -INT32_C(          13),  INT32_C(           1),  INT32_C(          13), -INT32_C(          14) },
+      { -INT32_C(  1652695344), -INT32_C(  1868574976),  INT32_C(  1488494775), -INT32_C(  1553577643), -INT32_C(  1297349349), -INT32_C(  1039226102), -INT32_C(  1483024684),  INT32_C(   750928028),
+        -INT32_C(   945185370),  INT32_C(  1867292307),  INT32_C(  1755459802), -INT32_C(  1299054021), -INT32_C(   665117642), -INT32_C(  1594280740), -INT32_C(   945185370),  INT32_C(  1488494775) } },
+    { { -INT32_C(  1261835897), -INT32_C(   272434284),  INT32_C(  1159142243), -INT32_C(   568488555),  INT32_C(   887911374),  INT32_C(  1857198249),  INT32_C(  1282209752), -INT32_C(   547563465),
+        -INT32_C(  1403220921), -INT32_C(  1936604001), -INT32_C(  1564073770),  INT32_C(   708794647), -INT32_C(   564821403),  INT32_C(  1585909793),  INT32_C(  1903703617),  INT32_C(  1099265645) },
+      UINT16_C( 7088),
+      { -INT32_C(          15), -INT32_C(           2),  INT32_C(           0), -INT32_C(           9),  INT32_C(           0),  INT32_C(           4), -INT32_C(           8),  INT32_C(           8),
+        -INT32_C(           4), -INT32_C(          11),  INT32_C(           5),  INT32_C(           9),  INT32_C(          12),  INT32_C(           8),  INT32_C(          15),  INT32_C(           7) },
+      { -INT32_C(  1261835897), -INT32_C(   272434284),  INT32_C(  1159142243), -INT32_C(   568488555), -INT32_C(  1039226102),  INT32_C(   969850110),  INT32_C(  1282209752), -INT32_C(  1868574976),
+         INT32_C(  1128593813), -INT32_C(  1099749183), -INT32_C(  1564073770), -INT32_C(   661573474),  INT32_C(  2140565639),  INT32_C(  1585909793),  INT32_C(  1903703617),  INT32_C(  1099265645) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i vindex = simde_mm512_loadu_epi32(test_vec[i].vindex);
+    simde__m512i r = simde_mm512_mask_i32gather_epi32(src, test_vec[i].k, vindex, &(test_gather_i32[16]), 4);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_i32gather_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t vindex[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { { -INT32_C(           6),  INT32_C(          12), -INT32_C(           6),  INT32_C(           0),  INT32_C(           9),  INT32_C(           7),  INT32_C(           7),  INT32_C(          14) },
+      { -INT64_C( 6977536476063400421),  INT64_C( 4574634291913017957), -INT64_C( 6977536476063400421),  INT64_C(  667667952135182694),
+        -INT64_C( 2264795002708770330), -INT64_C( 3740680337104392824), -INT64_C( 3740680337104392824),  INT64_C( 3921866937951841336) } },
+    { { -INT32_C(          10),  INT32_C(          14),  INT32_C(          12), -INT32_C(          10),  INT32_C(           7),  INT32_C(           8), -INT32_C(          14), -INT32_C(           9) },
+      {  INT64_C( 8192762014127093023),  INT64_C( 3921866937951841336),  INT64_C( 4574634291913017957),  INT64_C( 8192762014127093023),
+        -INT64_C( 3740680337104392824),  INT64_C( 6539278584911493843), -INT64_C( 4447920984375902666),  INT64_C( 7528886499374654773) } },
+    { {  INT32_C(           7),  INT32_C(           0), -INT32_C(           9),  INT32_C(           6),  INT32_C(          12),  INT32_C(           5), -INT32_C(           4),  INT32_C(           1) },
+      { -INT64_C( 3740680337104392824),  INT64_C(  667667952135182694),  INT64_C( 7528886499374654773), -INT64_C( 8276905840325447511),
+         INT64_C( 4574634291913017957),  INT64_C( 7905224152794973602),  INT64_C( 7525532036093015925),  INT64_C( 8118657907240295636) } },
+    { {  INT32_C(          15),  INT32_C(           0), -INT32_C(           7), -INT32_C(           2), -INT32_C(          10),  INT32_C(          11), -INT32_C(          11),  INT32_C(           8) },
+      { -INT64_C( 1871518200547373600),  INT64_C(  667667952135182694), -INT64_C(  579521052890050120), -INT64_C( 1229133987052756326),
+         INT64_C( 8192762014127093023),  INT64_C( 4481670887097906574), -INT64_C(   81060863366811966),  INT64_C( 6539278584911493843) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i vindex = simde_x_mm256_loadu_epi32(test_vec[i].vindex);
+    simde__m512i r = simde_mm512_i32gather_epi64(vindex, &(test_gather_i64[16]), 8);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_i32gather_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[8];
+    const simde__mmask8 k;
+    const int32_t vindex[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { { -INT64_C( 2067404500793365070), -INT64_C( 7633286062978919191), -INT64_C( 6918096151634908800),  INT64_C( 4342470236217152083),
+        -INT64_C( 8698090494661215561),  INT64_C( 3873811135307939586),  INT64_C( 2351545230835124604), -INT64_C( 4251431486909402002) },
+      UINT8_C(  0),
+      { -INT32_C(          10),  INT32_C(           3), -INT32_C(          14),  INT32_C(          12),  INT32_C(           2), -INT32_C(          15),  INT32_C(           2), -INT32_C(          10) },
+      { -INT64_C( 2067404500793365070), -INT64_C( 7633286062978919191), -INT64_C( 6918096151634908800),  INT64_C( 4342470236217152083),
+        -INT64_C( 8698090494661215561),  INT64_C( 3873811135307939586),  INT64_C( 2351545230835124604), -INT64_C( 4251431486909402002) } },
+    { { -INT64_C( 9083175931933720377), -INT64_C( 5335775427146073082),  INT64_C( 8677614207548496894),  INT64_C(   98196173074021193),
+        -INT64_C( 6213521437728961665), -INT64_C( 2615679641095177047), -INT64_C(  886649568792252656),  INT64_C(  752741171874262990) },
+      UINT8_C(255),
+      {  INT32_C(           1), -INT32_C(           8),  INT32_C(           3),  INT32_C(           7),  INT32_C(          15),  INT32_C(          12), -INT32_C(           3), -INT32_C(           5) },
+      {  INT64_C( 8118657907240295636),  INT64_C( 6178004736313058239), -INT64_C( 1774777017819125221), -INT64_C( 3740680337104392824),
+        -INT64_C( 1871518200547373600),  INT64_C( 4574634291913017957), -INT64_C( 8879641802643455781), -INT64_C(  229635990459004633) } },
+    { {  INT64_C( 8043219642305255831),  INT64_C( 4342270738794546532),  INT64_C(  217010502282052718), -INT64_C( 1397841876000193050),
+         INT64_C(  281897856285135853),  INT64_C(  987638444524645130), -INT64_C( 8550591662227555364), -INT64_C( 8165497841597151189) },
+      UINT8_C( 31),
+      {  INT32_C(          11),  INT32_C(           6), -INT32_C(          16),  INT32_C(           4), -INT32_C(           7), -INT32_C(           9),  INT32_C(           0),  INT32_C(           0) },
+      {  INT64_C( 4481670887097906574), -INT64_C( 8276905840325447511),  INT64_C( 1028018298114786158), -INT64_C( 4207208646129977713),
+        -INT64_C(  579521052890050120),  INT64_C(  987638444524645130), -INT64_C( 8550591662227555364), -INT64_C( 8165497841597151189) } },
+    { {  INT64_C( 3223074974426571093),  INT64_C( 4271389972858609495), -INT64_C( 6472338797731060567),  INT64_C(  196330698164955936),
+        -INT64_C( 4730535877680831498), -INT64_C( 8984680028730494543),  INT64_C( 3892702544028453906),  INT64_C( 6282989443671666186) },
+      UINT8_C(123),
+      {  INT32_C(           6),  INT32_C(          15),  INT32_C(          10), -INT32_C(          12),  INT32_C(           6), -INT32_C(          12), -INT32_C(          11),  INT32_C(           2) },
+      { -INT64_C( 8276905840325447511), -INT64_C( 1871518200547373600), -INT64_C( 6472338797731060567),  INT64_C( 6111080042498875071),
+        -INT64_C( 8276905840325447511),  INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 6282989443671666186) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi64(test_vec[i].src);
+    simde__m256i vindex = simde_x_mm256_loadu_epi32(test_vec[i].vindex);
+    simde__m512i r = simde_mm512_mask_i32gather_epi64(src, test_vec[i].k, vindex, &(test_gather_i64[16]), 8);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_i32gather_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t vindex[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { -INT32_C(           4),  INT32_C(          11),  INT32_C(           4), -INT32_C(          11), -INT32_C(          16),  INT32_C(          13), -INT32_C(           2),  INT32_C(           6) },
+      { SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(   318.23), SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(   806.65),
+        SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   736.90) } },
+    { {  INT32_C(           0),  INT32_C(           9),  INT32_C(           8), -INT32_C(          10), -INT32_C(          16), -INT32_C(           2),  INT32_C(          10), -INT32_C(           2) },
+      { SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(   318.63),
+        SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   369.26) } },
+    { { -INT32_C(          14),  INT32_C(           7), -INT32_C(          14), -INT32_C(           1),  INT32_C(           3),  INT32_C(           1), -INT32_C(           5),  INT32_C(          15) },
+      { SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -105.40), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(   246.88), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(   860.93), SIMDE_FLOAT64_C(  -550.50) } },
+    { { -INT32_C(           6),  INT32_C(          10), -INT32_C(           9),  INT32_C(           9),  INT32_C(           9), -INT32_C(          16),  INT32_C(          12), -INT32_C(          10) },
+      { SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(    19.92), SIMDE_FLOAT64_C(  -367.71),
+        SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(   318.63) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i vindex = simde_x_mm256_loadu_epi32(test_vec[i].vindex);
+    simde__m512d r = simde_mm512_i32gather_pd(vindex, &(test_gather_f64[16]), 8);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_i32gather_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[8];
+    const simde__mmask8 k;
+    const int32_t vindex[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(    60.21), SIMDE_FLOAT64_C(  -378.02), SIMDE_FLOAT64_C(   123.84), SIMDE_FLOAT64_C(   273.17),
+        SIMDE_FLOAT64_C(  -369.99), SIMDE_FLOAT64_C(   327.96), SIMDE_FLOAT64_C(   -54.50), SIMDE_FLOAT64_C(   810.83) },
+      UINT8_C(  0),
+      { -INT32_C(          10), -INT32_C(          14),  INT32_C(          12), -INT32_C(          16), -INT32_C(          11), -INT32_C(          11),  INT32_C(           0), -INT32_C(          10) },
+      { SIMDE_FLOAT64_C(    60.21), SIMDE_FLOAT64_C(  -378.02), SIMDE_FLOAT64_C(   123.84), SIMDE_FLOAT64_C(   273.17),
+        SIMDE_FLOAT64_C(  -369.99), SIMDE_FLOAT64_C(   327.96), SIMDE_FLOAT64_C(   -54.50), SIMDE_FLOAT64_C(   810.83) } },
+    { { SIMDE_FLOAT64_C(  -881.71), SIMDE_FLOAT64_C(    99.65), SIMDE_FLOAT64_C(  -254.38), SIMDE_FLOAT64_C(  -833.57),
+        SIMDE_FLOAT64_C(   -75.31), SIMDE_FLOAT64_C(   287.26), SIMDE_FLOAT64_C(  -783.36), SIMDE_FLOAT64_C(  -929.00) },
+      UINT8_C(255),
+      { -INT32_C(           8),  INT32_C(          14),  INT32_C(           6),  INT32_C(           5),  INT32_C(          15), -INT32_C(           9),  INT32_C(          13),  INT32_C(           6) },
+      { SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -143.45),
+        SIMDE_FLOAT64_C(  -550.50), SIMDE_FLOAT64_C(    19.92), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(   736.90) } },
+    { { SIMDE_FLOAT64_C(   -37.32), SIMDE_FLOAT64_C(   356.77), SIMDE_FLOAT64_C(   -70.20), SIMDE_FLOAT64_C(  -644.94),
+        SIMDE_FLOAT64_C(  -363.75), SIMDE_FLOAT64_C(    60.53), SIMDE_FLOAT64_C(   684.29), SIMDE_FLOAT64_C(  -954.42) },
+      UINT8_C(122),
+      { -INT32_C(          15), -INT32_C(          16), -INT32_C(          14),  INT32_C(           5),  INT32_C(           5), -INT32_C(           6),  INT32_C(           1),  INT32_C(           2) },
+      { SIMDE_FLOAT64_C(   -37.32), SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(   -70.20), SIMDE_FLOAT64_C(  -143.45),
+        SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -954.42) } },
+    { { SIMDE_FLOAT64_C(  -453.96), SIMDE_FLOAT64_C(  -398.39), SIMDE_FLOAT64_C(  -275.35), SIMDE_FLOAT64_C(  -333.11),
+        SIMDE_FLOAT64_C(  -893.66), SIMDE_FLOAT64_C(  -537.44), SIMDE_FLOAT64_C(   313.76), SIMDE_FLOAT64_C(    54.80) },
+      UINT8_C( 86),
+      {  INT32_C(          12), -INT32_C(          16),  INT32_C(           7),  INT32_C(           6), -INT32_C(          10),  INT32_C(           2),  INT32_C(           3),  INT32_C(          10) },
+      { SIMDE_FLOAT64_C(  -453.96), SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -105.40), SIMDE_FLOAT64_C(  -333.11),
+        SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(  -537.44), SIMDE_FLOAT64_C(   246.88), SIMDE_FLOAT64_C(    54.80) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d src = simde_mm512_loadu_pd(test_vec[i].src);
+    simde__m256i vindex = simde_x_mm256_loadu_epi32(test_vec[i].vindex);
+    simde__m512d r = simde_mm512_mask_i32gather_pd(src, test_vec[i].k, vindex, &(test_gather_f64[16]), 8);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_i32gather_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t vindex[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { -INT32_C(           3), -INT32_C(          14),  INT32_C(           6), -INT32_C(          13), -INT32_C(          12),  INT32_C(          10),  INT32_C(           1), -INT32_C(          11),
+         INT32_C(           5),  INT32_C(           5), -INT32_C(          15), -INT32_C(          14),  INT32_C(          14), -INT32_C(           7), -INT32_C(          12), -INT32_C(          15) },
+      { SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   782.02),
+        SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62),
+        SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(  -255.44) } },
+    { { -INT32_C(           6),  INT32_C(           9),  INT32_C(           1),  INT32_C(          15), -INT32_C(           8), -INT32_C(           5), -INT32_C(           5), -INT32_C(          14),
+        -INT32_C(          12), -INT32_C(           3), -INT32_C(           1),  INT32_C(          13), -INT32_C(          13), -INT32_C(           8), -INT32_C(          12), -INT32_C(          14) },
+      { SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   112.55),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(   559.10), SIMDE_FLOAT32_C(   559.10), SIMDE_FLOAT32_C(   562.62),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(  -443.95), SIMDE_FLOAT32_C(  -159.76),
+        SIMDE_FLOAT32_C(  -334.57), SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   562.62) } },
+    { {  INT32_C(           0), -INT32_C(           7), -INT32_C(           7),  INT32_C(           2), -INT32_C(          15), -INT32_C(          11), -INT32_C(           7),  INT32_C(           3),
+        -INT32_C(           9),  INT32_C(           9), -INT32_C(           2),  INT32_C(           5),  INT32_C(          11), -INT32_C(          14), -INT32_C(          12),  INT32_C(           1) },
+      { SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(   179.97),
+        SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   456.08), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -432.18),
+        SIMDE_FLOAT32_C(  -371.72), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(    37.60) } },
+    { {  INT32_C(          13),  INT32_C(           6),  INT32_C(           6),  INT32_C(           8), -INT32_C(           4),  INT32_C(           6), -INT32_C(          15),  INT32_C(           9),
+         INT32_C(          11),  INT32_C(           6), -INT32_C(           7), -INT32_C(           2), -INT32_C(           2), -INT32_C(          16),  INT32_C(           1),  INT32_C(           7) },
+      { SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -304.65),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   -81.84),
+        SIMDE_FLOAT32_C(  -371.72), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(   882.47),
+        SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(  -367.96) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i vindex = simde_mm512_loadu_epi32(test_vec[i].vindex);
+    simde__m512 r = simde_mm512_i32gather_ps(vindex, &(test_gather_f32[16]), 4);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_i32gather_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[16];
+    const simde__mmask16 k;
+    const int32_t vindex[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(    71.49), SIMDE_FLOAT32_C(   129.48), SIMDE_FLOAT32_C(   616.73), SIMDE_FLOAT32_C(   590.13),
+        SIMDE_FLOAT32_C(   913.22), SIMDE_FLOAT32_C(   917.10), SIMDE_FLOAT32_C(  -317.62), SIMDE_FLOAT32_C(   961.13),
+        SIMDE_FLOAT32_C(   203.28), SIMDE_FLOAT32_C(   311.80), SIMDE_FLOAT32_C(   157.25), SIMDE_FLOAT32_C(   175.43),
+        SIMDE_FLOAT32_C(  -106.63), SIMDE_FLOAT32_C(   228.68), SIMDE_FLOAT32_C(  -310.62), SIMDE_FLOAT32_C(  -723.77) },
+      UINT16_C(    0),
+      {  INT32_C(          10),  INT32_C(          14), -INT32_C(          15), -INT32_C(           7),  INT32_C(           1), -INT32_C(           5), -INT32_C(          12),  INT32_C(           6),
+         INT32_C(           1), -INT32_C(          10),  INT32_C(           4),  INT32_C(          11),  INT32_C(          10),  INT32_C(          10),  INT32_C(           6), -INT32_C(           4) },
+      { SIMDE_FLOAT32_C(    71.49), SIMDE_FLOAT32_C(   129.48), SIMDE_FLOAT32_C(   616.73), SIMDE_FLOAT32_C(   590.13),
+        SIMDE_FLOAT32_C(   913.22), SIMDE_FLOAT32_C(   917.10), SIMDE_FLOAT32_C(  -317.62), SIMDE_FLOAT32_C(   961.13),
+        SIMDE_FLOAT32_C(   203.28), SIMDE_FLOAT32_C(   311.80), SIMDE_FLOAT32_C(   157.25), SIMDE_FLOAT32_C(   175.43),
+        SIMDE_FLOAT32_C(  -106.63), SIMDE_FLOAT32_C(   228.68), SIMDE_FLOAT32_C(  -310.62), SIMDE_FLOAT32_C(  -723.77) } },
+    { { SIMDE_FLOAT32_C(   642.95), SIMDE_FLOAT32_C(  -276.60), SIMDE_FLOAT32_C(  -442.72), SIMDE_FLOAT32_C(  -443.73),
+        SIMDE_FLOAT32_C(   116.61), SIMDE_FLOAT32_C(  -350.07), SIMDE_FLOAT32_C(  -446.28), SIMDE_FLOAT32_C(   964.65),
+        SIMDE_FLOAT32_C(   163.53), SIMDE_FLOAT32_C(   495.72), SIMDE_FLOAT32_C(   392.75), SIMDE_FLOAT32_C(  -356.75),
+        SIMDE_FLOAT32_C(   968.45), SIMDE_FLOAT32_C(   979.91), SIMDE_FLOAT32_C(  -772.88), SIMDE_FLOAT32_C(  -999.95) },
+      UINT16_C(65535),
+      { -INT32_C(          12),  INT32_C(           7), -INT32_C(          16), -INT32_C(          16), -INT32_C(           8), -INT32_C(           4), -INT32_C(          12),  INT32_C(          12),
+        -INT32_C(           7), -INT32_C(          10), -INT32_C(           4),  INT32_C(           8),  INT32_C(           8),  INT32_C(          12), -INT32_C(           8), -INT32_C(           2) },
+      { SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(  -367.96), SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(   606.99),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(  -413.67),
+        SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -304.65),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(   882.47) } },
+    { { SIMDE_FLOAT32_C(    86.63), SIMDE_FLOAT32_C(   933.27), SIMDE_FLOAT32_C(   472.10), SIMDE_FLOAT32_C(   488.14),
+        SIMDE_FLOAT32_C(   904.05), SIMDE_FLOAT32_C(  -947.99), SIMDE_FLOAT32_C(  -846.34), SIMDE_FLOAT32_C(   473.43),
+        SIMDE_FLOAT32_C(   -79.25), SIMDE_FLOAT32_C(   373.00), SIMDE_FLOAT32_C(   214.26), SIMDE_FLOAT32_C(   501.17),
+        SIMDE_FLOAT32_C(  -621.05), SIMDE_FLOAT32_C(  -439.76), SIMDE_FLOAT32_C(  -534.51), SIMDE_FLOAT32_C(  -697.82) },
+      UINT16_C(11565),
+      {  INT32_C(           2),  INT32_C(           9), -INT32_C(          10), -INT32_C(           1),  INT32_C(           6), -INT32_C(           4), -INT32_C(           2),  INT32_C(           5),
+         INT32_C(           1),  INT32_C(          10), -INT32_C(          12),  INT32_C(           2), -INT32_C(           1),  INT32_C(          11), -INT32_C(           5),  INT32_C(           5) },
+      { SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(   933.27), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(   904.05), SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -846.34), SIMDE_FLOAT32_C(   473.43),
+        SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   373.00), SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   179.97),
+        SIMDE_FLOAT32_C(  -621.05), SIMDE_FLOAT32_C(  -371.72), SIMDE_FLOAT32_C(  -534.51), SIMDE_FLOAT32_C(  -697.82) } },
+    { { SIMDE_FLOAT32_C(   855.61), SIMDE_FLOAT32_C(  -681.50), SIMDE_FLOAT32_C(   168.17), SIMDE_FLOAT32_C(   953.80),
+        SIMDE_FLOAT32_C(   451.00), SIMDE_FLOAT32_C(  -913.20), SIMDE_FLOAT32_C(  -580.83), SIMDE_FLOAT32_C(   796.55),
+        SIMDE_FLOAT32_C(  -494.91), SIMDE_FLOAT32_C(   314.48), SIMDE_FLOAT32_C(  -614.63), SIMDE_FLOAT32_C(  -463.71),
+        SIMDE_FLOAT32_C(  -387.43), SIMDE_FLOAT32_C(  -878.51), SIMDE_FLOAT32_C(  -419.36), SIMDE_FLOAT32_C(  -427.85) },
+      UINT16_C(47919),
+      { -INT32_C(           5), -INT32_C(           4), -INT32_C(           7), -INT32_C(           6), -INT32_C(           9), -INT32_C(           4),  INT32_C(           5),  INT32_C(           5),
+        -INT32_C(          10), -INT32_C(           6), -INT32_C(           6),  INT32_C(           8),  INT32_C(           6),  INT32_C(          13),  INT32_C(           2), -INT32_C(           6) },
+      { SIMDE_FLOAT32_C(   559.10), SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -746.30),
+        SIMDE_FLOAT32_C(   451.00), SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -580.83), SIMDE_FLOAT32_C(   796.55),
+        SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(  -614.63), SIMDE_FLOAT32_C(  -304.65),
+        SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(  -419.36), SIMDE_FLOAT32_C(  -746.30) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 src = simde_mm512_loadu_ps(test_vec[i].src);
+    simde__m512i vindex = simde_mm512_loadu_epi32(test_vec[i].vindex);
+    simde__m512 r = simde_mm512_mask_i32gather_ps(src, test_vec[i].k, vindex, &(test_gather_f32[16]), 4);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_i64gather_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t vindex[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { {  INT64_C(                  10),  INT64_C(                   7),  INT64_C(                  14),  INT64_C(                   0),
+        -INT64_C(                   4), -INT64_C(                  16), -INT64_C(                  15),  INT64_C(                  10) },
+      {  INT32_C(  1333917055),  INT32_C(  1709966795),  INT32_C(  1338992413), -INT32_C(  1039226102),  INT32_C(  1128593813), -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1333917055) } },
+    { {  INT64_C(                   7),  INT64_C(                   5), -INT64_C(                   4), -INT64_C(                   8),
+         INT64_C(                   2),  INT64_C(                   1),  INT64_C(                  13), -INT64_C(                   1) },
+      {  INT32_C(  1709966795), -INT32_C(  1853628921),  INT32_C(  1128593813),  INT32_C(   310840079),  INT32_C(  1912893877), -INT32_C(  1594280740), -INT32_C(   945185370),  INT32_C(  1987001023) } },
+    { {  INT64_C(                   3), -INT64_C(                  14),  INT64_C(                   6),  INT64_C(                   0),
+         INT64_C(                   6), -INT64_C(                  11),  INT64_C(                   0), -INT64_C(                   4) },
+      {  INT32_C(  2112271382),  INT32_C(  1488494775),  INT32_C(  1029814395), -INT32_C(  1039226102),  INT32_C(  1029814395), -INT32_C(  1099749183), -INT32_C(  1039226102),  INT32_C(  1128593813) } },
+    { {  INT64_C(                   7), -INT64_C(                  10), -INT64_C(                   3),  INT64_C(                   9),
+        -INT64_C(                  10), -INT64_C(                   4),  INT64_C(                   8), -INT64_C(                   6) },
+      {  INT32_C(  1709966795), -INT32_C(  1652695344), -INT32_C(  1249725146), -INT32_C(   661573474), -INT32_C(  1652695344),  INT32_C(  1128593813), -INT32_C(  1868574976), -INT32_C(  1483024684) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m256i r = simde_mm512_i64gather_epi32(vindex, &(test_gather_i32[16]), 4);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_i64gather_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const simde__mmask8 k;
+    const int64_t vindex[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { {  INT32_C(  1141773769),  INT32_C(  1157520290),  INT32_C(    62853013),  INT32_C(  1880962250), -INT32_C(  1016103901),  INT32_C(  1082444315), -INT32_C(   991287985),  INT32_C(  2026455749) },
+      UINT8_C(  0),
+      { -INT64_C(                  16), -INT64_C(                  14), -INT64_C(                  13),  INT64_C(                   0),
+         INT64_C(                   9), -INT64_C(                  14), -INT64_C(                  15),  INT64_C(                   9) },
+      {  INT32_C(  1141773769),  INT32_C(  1157520290),  INT32_C(    62853013),  INT32_C(  1880962250), -INT32_C(  1016103901),  INT32_C(  1082444315), -INT32_C(   991287985),  INT32_C(  2026455749) } },
+    { { -INT32_C(   549189205), -INT32_C(  2042786952),  INT32_C(   635448942),  INT32_C(   420066738), -INT32_C(   179140007),  INT32_C(  1833670925),  INT32_C(  1017703807), -INT32_C(   611384475) },
+      UINT8_C(255),
+      { -INT64_C(                  13), -INT64_C(                   5),  INT64_C(                  11), -INT64_C(                  12),
+        -INT64_C(                   7),  INT64_C(                   9), -INT64_C(                   1),  INT64_C(                  14) },
+      { -INT32_C(   665117642),  INT32_C(  1850267257), -INT32_C(  1553577643), -INT32_C(  1749653618), -INT32_C(   911005991), -INT32_C(   661573474),  INT32_C(  1987001023),  INT32_C(  1338992413) } },
+    { { -INT32_C(  1709231940),  INT32_C(  1766498781), -INT32_C(   692591650),  INT32_C(   934001561), -INT32_C(  1291507026),  INT32_C(  1753893755), -INT32_C(  1073946323),  INT32_C(   952169391) },
+      UINT8_C( 70),
+      { -INT64_C(                   8),  INT64_C(                  11), -INT64_C(                   3),  INT64_C(                  13),
+         INT64_C(                   4), -INT64_C(                  10),  INT64_C(                   6),  INT64_C(                   1) },
+      { -INT32_C(  1709231940), -INT32_C(  1553577643), -INT32_C(  1249725146),  INT32_C(   934001561), -INT32_C(  1291507026),  INT32_C(  1753893755),  INT32_C(  1029814395),  INT32_C(   952169391) } },
+    { {  INT32_C(    82172357), -INT32_C(  2100378826),  INT32_C(   847074096), -INT32_C(   704158314),  INT32_C(   360369885),  INT32_C(  1446521856),  INT32_C(  1705991256),  INT32_C(   586683616) },
+      UINT8_C(115),
+      { -INT64_C(                   7),  INT64_C(                   0),  INT64_C(                   6),  INT64_C(                   6),
+         INT64_C(                  14), -INT64_C(                   4), -INT64_C(                  10), -INT64_C(                  10) },
+      { -INT32_C(   911005991), -INT32_C(  1039226102),  INT32_C(   847074096), -INT32_C(   704158314),  INT32_C(  1338992413),  INT32_C(  1128593813), -INT32_C(  1652695344),  INT32_C(   586683616) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m256i r = simde_mm512_mask_i64gather_epi32(src, test_vec[i].k, vindex, &(test_gather_i32[16]), 4);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_i64gather_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t vindex[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { {  INT64_C(                   4),  INT64_C(                  10), -INT64_C(                   6),  INT64_C(                  13),
+         INT64_C(                   4),  INT64_C(                  11), -INT64_C(                  11), -INT64_C(                   3) },
+      { -INT64_C( 4207208646129977713),  INT64_C( 4356444333864162789), -INT64_C( 6977536476063400421), -INT64_C( 8755769881111927631),
+        -INT64_C( 4207208646129977713),  INT64_C( 4481670887097906574), -INT64_C(   81060863366811966), -INT64_C( 8879641802643455781) } },
+    { {  INT64_C(                  15),  INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   5),
+        -INT64_C(                   2), -INT64_C(                   1), -INT64_C(                  15),  INT64_C(                  15) },
+      { -INT64_C( 1871518200547373600),  INT64_C( 8118657907240295636),  INT64_C(  667667952135182694),  INT64_C( 7905224152794973602),
+        -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),  INT64_C( 1109066856903585640), -INT64_C( 1871518200547373600) } },
+    { {  INT64_C(                  10), -INT64_C(                  10), -INT64_C(                  13), -INT64_C(                  11),
+         INT64_C(                  14), -INT64_C(                  10),  INT64_C(                   2),  INT64_C(                   0) },
+      {  INT64_C( 4356444333864162789),  INT64_C( 8192762014127093023), -INT64_C( 2896957826357560630), -INT64_C(   81060863366811966),
+         INT64_C( 3921866937951841336),  INT64_C( 8192762014127093023), -INT64_C( 7360632097894753427),  INT64_C(  667667952135182694) } },
+    { {  INT64_C(                   3),  INT64_C(                   0),  INT64_C(                  15),  INT64_C(                   5),
+        -INT64_C(                   9), -INT64_C(                   5),  INT64_C(                  14),  INT64_C(                   3) },
+      { -INT64_C( 1774777017819125221),  INT64_C(  667667952135182694), -INT64_C( 1871518200547373600),  INT64_C( 7905224152794973602),
+         INT64_C( 7528886499374654773), -INT64_C(  229635990459004633),  INT64_C( 3921866937951841336), -INT64_C( 1774777017819125221) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m512i r = simde_mm512_i64gather_epi64(vindex, &(test_gather_i64[16]), 8);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_i64gather_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[8];
+    const simde__mmask8 k;
+    const int64_t vindex[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { { -INT64_C( 3268356071721302948), -INT64_C( 7517245673426777004), -INT64_C( 1680453083971484340), -INT64_C( 8068771728160521914),
+        -INT64_C(  560717806317527356),  INT64_C( 1860599888415704569), -INT64_C(  624850550858950862), -INT64_C( 3190934264941155556) },
+      UINT8_C(  0),
+      { -INT64_C(                   6), -INT64_C(                   1), -INT64_C(                  13),  INT64_C(                   5),
+        -INT64_C(                  15), -INT64_C(                  10),  INT64_C(                  10), -INT64_C(                  12) },
+      { -INT64_C( 3268356071721302948), -INT64_C( 7517245673426777004), -INT64_C( 1680453083971484340), -INT64_C( 8068771728160521914),
+        -INT64_C(  560717806317527356),  INT64_C( 1860599888415704569), -INT64_C(  624850550858950862), -INT64_C( 3190934264941155556) } },
+    { { -INT64_C( 5707734701395274531), -INT64_C( 1531692443449501772),  INT64_C( 4124699278570008347),  INT64_C( 6349765779284294277),
+         INT64_C( 4907863869542083632),  INT64_C( 3525126052501696360),  INT64_C( 3090077738245806134),  INT64_C( 3484605518306075142) },
+      UINT8_C(255),
+      { -INT64_C(                  14),  INT64_C(                  10), -INT64_C(                   6), -INT64_C(                  10),
+        -INT64_C(                  11),  INT64_C(                   9),  INT64_C(                   3),  INT64_C(                   8) },
+      { -INT64_C( 4447920984375902666),  INT64_C( 4356444333864162789), -INT64_C( 6977536476063400421),  INT64_C( 8192762014127093023),
+        -INT64_C(   81060863366811966), -INT64_C( 2264795002708770330), -INT64_C( 1774777017819125221),  INT64_C( 6539278584911493843) } },
+    { { -INT64_C( 8436416028118365703),  INT64_C( 6761225433231636522), -INT64_C( 4038823853542029862),  INT64_C( 3108214233260520145),
+        -INT64_C( 3393326909047276940), -INT64_C(  964777924251055232), -INT64_C( 6296541331601773929), -INT64_C( 3980622007010889726) },
+      UINT8_C(238),
+      { -INT64_C(                  14), -INT64_C(                   2), -INT64_C(                   9),  INT64_C(                  13),
+        -INT64_C(                  16), -INT64_C(                  10),  INT64_C(                   6), -INT64_C(                  11) },
+      { -INT64_C( 8436416028118365703), -INT64_C( 1229133987052756326),  INT64_C( 7528886499374654773), -INT64_C( 8755769881111927631),
+        -INT64_C( 3393326909047276940),  INT64_C( 8192762014127093023), -INT64_C( 8276905840325447511), -INT64_C(   81060863366811966) } },
+    { {  INT64_C( 8549569287961159926), -INT64_C( 8060646468270796249),  INT64_C( 1720751873170691907), -INT64_C( 4406383419686175443),
+        -INT64_C( 7730658430112692201),  INT64_C(  832350622995804103),  INT64_C( 5162751449745458392), -INT64_C( 6309949393945665839) },
+      UINT8_C( 50),
+      { -INT64_C(                   4), -INT64_C(                   4), -INT64_C(                  16),  INT64_C(                  11),
+        -INT64_C(                   7),  INT64_C(                   8),  INT64_C(                   2), -INT64_C(                  15) },
+      {  INT64_C( 8549569287961159926),  INT64_C( 7525532036093015925),  INT64_C( 1720751873170691907), -INT64_C( 4406383419686175443),
+        -INT64_C(  579521052890050120),  INT64_C( 6539278584911493843),  INT64_C( 5162751449745458392), -INT64_C( 6309949393945665839) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi64(test_vec[i].src);
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m512i r = simde_mm512_mask_i64gather_epi64(src, test_vec[i].k, vindex, &(test_gather_i64[16]), 8);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_i64gather_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t vindex[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { -INT64_C(                  11), -INT64_C(                  10), -INT64_C(                   5),  INT64_C(                   8),
+        -INT64_C(                   5), -INT64_C(                   5), -INT64_C(                   4),  INT64_C(                  15) },
+      { SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(   860.93), SIMDE_FLOAT64_C(   450.68),
+        SIMDE_FLOAT64_C(   860.93), SIMDE_FLOAT64_C(   860.93), SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -550.50) } },
+    { { -INT64_C(                  13), -INT64_C(                  12), -INT64_C(                   1), -INT64_C(                   8),
+         INT64_C(                  12),  INT64_C(                  10), -INT64_C(                   1), -INT64_C(                   5) },
+      { SIMDE_FLOAT64_C(  -605.67), SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   491.09), SIMDE_FLOAT64_C(   651.31),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   491.09), SIMDE_FLOAT64_C(   860.93) } },
+    { { -INT64_C(                  16), -INT64_C(                   3),  INT64_C(                   8),  INT64_C(                   0),
+        -INT64_C(                   2), -INT64_C(                  12), -INT64_C(                   4), -INT64_C(                  10) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -587.14),
+        SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(   318.63) } },
+    { {  INT64_C(                   7),  INT64_C(                   5), -INT64_C(                   6), -INT64_C(                  13),
+        -INT64_C(                   1), -INT64_C(                  16),  INT64_C(                  14), -INT64_C(                  16) },
+      { SIMDE_FLOAT64_C(  -105.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   491.09), SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(   813.34) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m512d r = simde_mm512_i64gather_pd(vindex, &(test_gather_f64[16]), 8);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_i64gather_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[8];
+    const simde__mmask8 k;
+    const int64_t vindex[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   207.49), SIMDE_FLOAT64_C(  -507.96), SIMDE_FLOAT64_C(  -622.11), SIMDE_FLOAT64_C(  -539.44),
+        SIMDE_FLOAT64_C(   337.45), SIMDE_FLOAT64_C(   236.90), SIMDE_FLOAT64_C(  -731.70), SIMDE_FLOAT64_C(   274.31) },
+      UINT8_C(  0),
+      { -INT64_C(                  13), -INT64_C(                  12), -INT64_C(                   9),  INT64_C(                   5),
+         INT64_C(                  12),  INT64_C(                   3), -INT64_C(                  15),  INT64_C(                   9) },
+      { SIMDE_FLOAT64_C(   207.49), SIMDE_FLOAT64_C(  -507.96), SIMDE_FLOAT64_C(  -622.11), SIMDE_FLOAT64_C(  -539.44),
+        SIMDE_FLOAT64_C(   337.45), SIMDE_FLOAT64_C(   236.90), SIMDE_FLOAT64_C(  -731.70), SIMDE_FLOAT64_C(   274.31) } },
+    { { SIMDE_FLOAT64_C(   827.74), SIMDE_FLOAT64_C(   618.99), SIMDE_FLOAT64_C(  -393.58), SIMDE_FLOAT64_C(  -678.76),
+        SIMDE_FLOAT64_C(   -75.06), SIMDE_FLOAT64_C(  -387.71), SIMDE_FLOAT64_C(  -732.95), SIMDE_FLOAT64_C(   219.80) },
+      UINT8_C(255),
+      { -INT64_C(                   9),  INT64_C(                  11), -INT64_C(                  15),  INT64_C(                   5),
+         INT64_C(                   8), -INT64_C(                   2), -INT64_C(                   2), -INT64_C(                  12) },
+      { SIMDE_FLOAT64_C(    19.92), SIMDE_FLOAT64_C(   318.23), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(  -143.45),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   -16.71) } },
+    { { SIMDE_FLOAT64_C(   203.57), SIMDE_FLOAT64_C(   271.25), SIMDE_FLOAT64_C(   -72.63), SIMDE_FLOAT64_C(  -682.24),
+        SIMDE_FLOAT64_C(  -101.40), SIMDE_FLOAT64_C(   -89.42), SIMDE_FLOAT64_C(  -920.52), SIMDE_FLOAT64_C(   372.88) },
+      UINT8_C(180),
+      { -INT64_C(                   3),  INT64_C(                  12), -INT64_C(                   2), -INT64_C(                   1),
+         INT64_C(                  13), -INT64_C(                   8),  INT64_C(                   2), -INT64_C(                  13) },
+      { SIMDE_FLOAT64_C(   203.57), SIMDE_FLOAT64_C(   271.25), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(  -682.24),
+        SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(  -920.52), SIMDE_FLOAT64_C(  -605.67) } },
+    { { SIMDE_FLOAT64_C(   587.17), SIMDE_FLOAT64_C(   365.02), SIMDE_FLOAT64_C(  -418.65), SIMDE_FLOAT64_C(  -688.60),
+        SIMDE_FLOAT64_C(   489.19), SIMDE_FLOAT64_C(  -745.34), SIMDE_FLOAT64_C(  -932.19), SIMDE_FLOAT64_C(   -11.67) },
+      UINT8_C( 21),
+      {  INT64_C(                  15), -INT64_C(                  12), -INT64_C(                   4),  INT64_C(                   8),
+        -INT64_C(                  15),  INT64_C(                  12), -INT64_C(                  10),  INT64_C(                   5) },
+      { SIMDE_FLOAT64_C(  -550.50), SIMDE_FLOAT64_C(   365.02), SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -688.60),
+        SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(  -745.34), SIMDE_FLOAT64_C(  -932.19), SIMDE_FLOAT64_C(   -11.67) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d src = simde_mm512_loadu_pd(test_vec[i].src);
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m512d r = simde_mm512_mask_i64gather_pd(src, test_vec[i].k, vindex, &(test_gather_f64[16]), 8);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_i64gather_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t vindex[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { {  INT64_C(                   8), -INT64_C(                  16),  INT64_C(                   6),  INT64_C(                  14),
+         INT64_C(                  13), -INT64_C(                  15),  INT64_C(                   8), -INT64_C(                  12) },
+      { SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(   -19.28),
+        SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   581.17) } },
+    { {  INT64_C(                   5), -INT64_C(                   2),  INT64_C(                   0),  INT64_C(                   9),
+        -INT64_C(                  13), -INT64_C(                   4), -INT64_C(                   5), -INT64_C(                  16) },
+      { SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(   -81.84),
+        SIMDE_FLOAT32_C(  -334.57), SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(   559.10), SIMDE_FLOAT32_C(   606.99) } },
+    { { -INT64_C(                   7), -INT64_C(                  16),  INT64_C(                  11), -INT64_C(                   8),
+        -INT64_C(                   3),  INT64_C(                  15), -INT64_C(                  16), -INT64_C(                   9) },
+      { SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -371.72), SIMDE_FLOAT32_C(   496.86),
+        SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   112.55), SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(   456.08) } },
+    { {  INT64_C(                  12), -INT64_C(                  12), -INT64_C(                  15), -INT64_C(                   6),
+        -INT64_C(                   3),  INT64_C(                  12), -INT64_C(                  11), -INT64_C(                  10) },
+      { SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(  -746.30),
+        SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m256 r = simde_mm512_i64gather_ps(vindex, &(test_gather_f32[16]), 4);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_i64gather_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[8];
+    const simde__mmask8 k;
+    const int64_t vindex[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   314.30), SIMDE_FLOAT32_C(   492.84), SIMDE_FLOAT32_C(   791.83), SIMDE_FLOAT32_C(    49.75),
+        SIMDE_FLOAT32_C(   678.17), SIMDE_FLOAT32_C(  -294.93), SIMDE_FLOAT32_C(   788.23), SIMDE_FLOAT32_C(  -349.93) },
+      UINT8_C(  0),
+      { -INT64_C(                   7), -INT64_C(                   7), -INT64_C(                  14), -INT64_C(                   3),
+         INT64_C(                   4),  INT64_C(                  12),  INT64_C(                  15), -INT64_C(                   4) },
+      { SIMDE_FLOAT32_C(   314.30), SIMDE_FLOAT32_C(   492.84), SIMDE_FLOAT32_C(   791.83), SIMDE_FLOAT32_C(    49.75),
+        SIMDE_FLOAT32_C(   678.17), SIMDE_FLOAT32_C(  -294.93), SIMDE_FLOAT32_C(   788.23), SIMDE_FLOAT32_C(  -349.93) } },
+    { { SIMDE_FLOAT32_C(   406.26), SIMDE_FLOAT32_C(   109.06), SIMDE_FLOAT32_C(   659.85), SIMDE_FLOAT32_C(   280.69),
+        SIMDE_FLOAT32_C(   639.05), SIMDE_FLOAT32_C(  -303.91), SIMDE_FLOAT32_C(   756.40), SIMDE_FLOAT32_C(   100.00) },
+      UINT8_C(255),
+      {  INT64_C(                  15), -INT64_C(                  16),  INT64_C(                   7), -INT64_C(                  13),
+        -INT64_C(                   3),  INT64_C(                   2),  INT64_C(                  14), -INT64_C(                   6) },
+      { SIMDE_FLOAT32_C(   112.55), SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -367.96), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(  -746.30) } },
+    { { SIMDE_FLOAT32_C(  -204.16), SIMDE_FLOAT32_C(  -629.24), SIMDE_FLOAT32_C(  -662.81), SIMDE_FLOAT32_C(   581.93),
+        SIMDE_FLOAT32_C(   432.48), SIMDE_FLOAT32_C(   832.49), SIMDE_FLOAT32_C(   -34.32), SIMDE_FLOAT32_C(   540.41) },
+      UINT8_C(233),
+      { -INT64_C(                  13), -INT64_C(                  11),  INT64_C(                   2),  INT64_C(                   0),
+         INT64_C(                  14), -INT64_C(                   5), -INT64_C(                  16), -INT64_C(                  14) },
+      { SIMDE_FLOAT32_C(  -334.57), SIMDE_FLOAT32_C(  -629.24), SIMDE_FLOAT32_C(  -662.81), SIMDE_FLOAT32_C(  -559.67),
+        SIMDE_FLOAT32_C(   432.48), SIMDE_FLOAT32_C(   559.10), SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(   562.62) } },
+    { { SIMDE_FLOAT32_C(   848.18), SIMDE_FLOAT32_C(  -809.84), SIMDE_FLOAT32_C(  -857.99), SIMDE_FLOAT32_C(    46.04),
+        SIMDE_FLOAT32_C(  -703.36), SIMDE_FLOAT32_C(   527.77), SIMDE_FLOAT32_C(  -680.29), SIMDE_FLOAT32_C(   468.40) },
+      UINT8_C( 22),
+      {  INT64_C(                   6), -INT64_C(                  13),  INT64_C(                   5),  INT64_C(                  15),
+        -INT64_C(                   2),  INT64_C(                  14), -INT64_C(                  13),  INT64_C(                  13) },
+      { SIMDE_FLOAT32_C(   848.18), SIMDE_FLOAT32_C(  -334.57), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(    46.04),
+        SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(   527.77), SIMDE_FLOAT32_C(  -680.29), SIMDE_FLOAT32_C(   468.40) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 src = simde_mm256_loadu_ps(test_vec[i].src);
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m256 r = simde_mm512_mask_i64gather_ps(src, test_vec[i].k, vindex, &(test_gather_f32[16]), 4);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mmask_i32gather_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mmask_i32gather_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mmask_i32gather_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mmask_i32gather_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mmask_i64gather_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mmask_i64gather_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mmask_i64gather_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mmask_i64gather_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mmask_i32gather_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mmask_i32gather_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mmask_i32gather_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mmask_i32gather_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mmask_i64gather_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mmask_i64gather_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mmask_i64gather_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mmask_i64gather_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i32gather_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i32gather_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i32gather_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i32gather_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i32gather_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i32gather_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i32gather_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i32gather_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i64gather_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i64gather_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i64gather_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i64gather_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i64gather_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i64gather_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i64gather_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i64gather_ps)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,518 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+#define SIMDE_TEST_X86_AVX512_INSN getexp
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/getexp.h>
+
+static int
+test_simde_mm512_getexp_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  541.40), SIMDE_FLOAT32_C( -489.06), SIMDE_FLOAT32_C( -939.77), SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C( -928.97), SIMDE_FLOAT32_C( -301.69), SIMDE_FLOAT32_C(  712.29), SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C(  909.86), SIMDE_FLOAT32_C(  396.50), SIMDE_FLOAT32_C( -452.27), SIMDE_FLOAT32_C(   14.96),
+        SIMDE_FLOAT32_C(  469.83), SIMDE_FLOAT32_C(  -41.65), SIMDE_FLOAT32_C(  757.75), SIMDE_FLOAT32_C(  -43.64) },
+      { SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    9.00),     -SIMDE_MATH_INFINITYF,
+        SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    9.00),     -SIMDE_MATH_INFINITYF,
+        SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    3.00),
+        SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    5.00), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    5.00) } },
+    { {           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  152.86), SIMDE_FLOAT32_C( -230.12), SIMDE_FLOAT32_C(  268.49),
+        SIMDE_FLOAT32_C( -174.22), SIMDE_FLOAT32_C(  494.91), SIMDE_FLOAT32_C(  436.99), SIMDE_FLOAT32_C(  769.35),
+        SIMDE_FLOAT32_C( -375.86), SIMDE_FLOAT32_C(  680.69), SIMDE_FLOAT32_C(  719.59), SIMDE_FLOAT32_C( -457.53),
+        SIMDE_FLOAT32_C(  136.82), SIMDE_FLOAT32_C(  770.14), SIMDE_FLOAT32_C(  178.65), SIMDE_FLOAT32_C(  862.87) },
+      {           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    7.00), SIMDE_FLOAT32_C(    7.00), SIMDE_FLOAT32_C(    8.00),
+        SIMDE_FLOAT32_C(    7.00), SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    9.00),
+        SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    8.00),
+        SIMDE_FLOAT32_C(    7.00), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    7.00), SIMDE_FLOAT32_C(    9.00) } },
+    { { SIMDE_FLOAT32_C(  310.06), SIMDE_FLOAT32_C(   85.10), SIMDE_FLOAT32_C(  972.88), SIMDE_FLOAT32_C(  552.49),
+        SIMDE_FLOAT32_C( -926.24), SIMDE_FLOAT32_C(   31.71),           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  832.00),
+        SIMDE_FLOAT32_C(  494.77),      SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C( -295.03), SIMDE_FLOAT32_C(  593.46),
+        SIMDE_FLOAT32_C(  279.50), SIMDE_FLOAT32_C(  442.97), SIMDE_FLOAT32_C( -893.90), SIMDE_FLOAT32_C(  -28.74) },
+      { SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    6.00), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    9.00),
+        SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    4.00),           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    9.00),
+        SIMDE_FLOAT32_C(    8.00),      SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    9.00),
+        SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    4.00) } },
+    { { SIMDE_FLOAT32_C(  205.50), SIMDE_FLOAT32_C(  989.29), SIMDE_FLOAT32_C( -194.15), SIMDE_FLOAT32_C(  166.62),
+        SIMDE_FLOAT32_C(  -12.49), SIMDE_FLOAT32_C( -197.24), SIMDE_FLOAT32_C(  310.60), SIMDE_FLOAT32_C( -344.11),
+        SIMDE_FLOAT32_C(  889.46), SIMDE_FLOAT32_C(  263.13), SIMDE_FLOAT32_C( -928.36), SIMDE_FLOAT32_C( -797.09),
+        SIMDE_FLOAT32_C( -583.71), SIMDE_FLOAT32_C( -725.66), SIMDE_FLOAT32_C( -599.05), SIMDE_FLOAT32_C(    1.00) },
+      { SIMDE_FLOAT32_C(    7.00), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    7.00), SIMDE_FLOAT32_C(    7.00),
+        SIMDE_FLOAT32_C(    3.00), SIMDE_FLOAT32_C(    7.00), SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    8.00),
+        SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    9.00),
+        SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    0.00) } },
+    { { SIMDE_FLOAT32_C( -939.94), SIMDE_FLOAT32_C( -874.65), SIMDE_FLOAT32_C( -379.11), SIMDE_FLOAT32_C(  314.33),
+        SIMDE_FLOAT32_C( -335.85), SIMDE_FLOAT32_C(  135.50), SIMDE_FLOAT32_C( -872.71), SIMDE_FLOAT32_C(    1.00),
+        SIMDE_FLOAT32_C( -437.45), SIMDE_FLOAT32_C( -947.41), SIMDE_FLOAT32_C( -409.68), SIMDE_FLOAT32_C(  262.19),
+        SIMDE_FLOAT32_C( -699.00), SIMDE_FLOAT32_C( -932.12), SIMDE_FLOAT32_C(   -0.00),      SIMDE_MATH_INFINITYF },
+      { SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    8.00),
+        SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    7.00), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    8.00),
+        SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    9.00),     -SIMDE_MATH_INFINITYF,      SIMDE_MATH_INFINITYF } },
+    { { SIMDE_FLOAT32_C( -201.76), SIMDE_FLOAT32_C(  230.25), SIMDE_FLOAT32_C( -593.65), SIMDE_FLOAT32_C( -538.37),
+        SIMDE_FLOAT32_C( -931.43), SIMDE_FLOAT32_C(  565.80), SIMDE_FLOAT32_C(   18.85),           SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(  456.84),           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  150.16), SIMDE_FLOAT32_C( -724.42),
+        SIMDE_FLOAT32_C( -837.49), SIMDE_FLOAT32_C( -367.32), SIMDE_FLOAT32_C(  798.40), SIMDE_FLOAT32_C(  758.25) },
+      { SIMDE_FLOAT32_C(    7.00), SIMDE_FLOAT32_C(    7.00), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    9.00),
+        SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    4.00),           SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(    8.00),           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    7.00), SIMDE_FLOAT32_C(    9.00),
+        SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    9.00) } },
+    { { SIMDE_FLOAT32_C(  784.70), SIMDE_FLOAT32_C(  854.37), SIMDE_FLOAT32_C( -419.26), SIMDE_FLOAT32_C( -701.77),
+        SIMDE_FLOAT32_C(  -16.37),      SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  920.27), SIMDE_FLOAT32_C( -147.68),
+        SIMDE_FLOAT32_C(  445.82), SIMDE_FLOAT32_C( -235.85), SIMDE_FLOAT32_C(  945.81), SIMDE_FLOAT32_C(  627.69),
+        SIMDE_FLOAT32_C(   -0.00), SIMDE_FLOAT32_C(  810.76), SIMDE_FLOAT32_C( -574.19), SIMDE_FLOAT32_C(   -0.00) },
+      { SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    9.00),
+        SIMDE_FLOAT32_C(    4.00),      SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    7.00),
+        SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    7.00), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    9.00),
+            -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    9.00),     -SIMDE_MATH_INFINITYF } },
+    { { SIMDE_FLOAT32_C(  899.51), SIMDE_FLOAT32_C(  -10.40), SIMDE_FLOAT32_C(   -0.00), SIMDE_FLOAT32_C( -367.45),
+        SIMDE_FLOAT32_C(  362.84), SIMDE_FLOAT32_C( -713.49), SIMDE_FLOAT32_C( -441.69), SIMDE_FLOAT32_C( -472.82),
+        SIMDE_FLOAT32_C(  358.53), SIMDE_FLOAT32_C(  962.52), SIMDE_FLOAT32_C(  132.75), SIMDE_FLOAT32_C( -816.32),
+        SIMDE_FLOAT32_C( -489.51),     -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  710.93), SIMDE_FLOAT32_C(    1.00) },
+      { SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    3.00),     -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    8.00),
+        SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    8.00),
+        SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    7.00), SIMDE_FLOAT32_C(    9.00),
+        SIMDE_FLOAT32_C(    8.00),      SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_getexp_ps(a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_getexp_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[16];
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C( -254.38), SIMDE_FLOAT32_C( -833.57), SIMDE_FLOAT32_C(  -75.31), SIMDE_FLOAT32_C(  287.26),
+        SIMDE_FLOAT32_C( -783.36), SIMDE_FLOAT32_C( -929.00), SIMDE_FLOAT32_C(  557.20), SIMDE_FLOAT32_C( -493.78),
+        SIMDE_FLOAT32_C( -488.74), SIMDE_FLOAT32_C( -835.95), SIMDE_FLOAT32_C( -782.41), SIMDE_FLOAT32_C(  377.35),
+        SIMDE_FLOAT32_C(  302.05), SIMDE_FLOAT32_C(  863.58), SIMDE_FLOAT32_C(   35.46), SIMDE_FLOAT32_C(  -37.32) },
+      UINT16_C( 1933),
+      { SIMDE_FLOAT32_C(  356.77), SIMDE_FLOAT32_C( -644.94), SIMDE_FLOAT32_C(   60.53), SIMDE_FLOAT32_C( -954.42),
+        SIMDE_FLOAT32_C(  164.16), SIMDE_FLOAT32_C( -686.83), SIMDE_FLOAT32_C( -877.66), SIMDE_FLOAT32_C( -627.66),
+        SIMDE_FLOAT32_C( -453.96), SIMDE_FLOAT32_C( -275.35), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(   54.80),
+        SIMDE_FLOAT32_C( -472.64), SIMDE_FLOAT32_C(  -36.58), SIMDE_FLOAT32_C(  -84.62), SIMDE_FLOAT32_C( -134.78) },
+      { SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C( -833.57), SIMDE_FLOAT32_C(    5.00), SIMDE_FLOAT32_C(    9.00),
+        SIMDE_FLOAT32_C( -783.36), SIMDE_FLOAT32_C( -929.00), SIMDE_FLOAT32_C(  557.20), SIMDE_FLOAT32_C(    9.00),
+        SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    8.00),     -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  377.35),
+        SIMDE_FLOAT32_C(  302.05), SIMDE_FLOAT32_C(  863.58), SIMDE_FLOAT32_C(   35.46), SIMDE_FLOAT32_C(  -37.32) } },
+    { { SIMDE_FLOAT32_C(  103.21), SIMDE_FLOAT32_C( -615.84), SIMDE_FLOAT32_C( -345.25), SIMDE_FLOAT32_C(  538.75),
+        SIMDE_FLOAT32_C(  401.27), SIMDE_FLOAT32_C(  566.39), SIMDE_FLOAT32_C( -267.41), SIMDE_FLOAT32_C(  618.27),
+        SIMDE_FLOAT32_C(  571.02), SIMDE_FLOAT32_C(  839.32), SIMDE_FLOAT32_C( -500.36), SIMDE_FLOAT32_C( -739.86),
+        SIMDE_FLOAT32_C( -781.97), SIMDE_FLOAT32_C( -729.33), SIMDE_FLOAT32_C( -773.27), SIMDE_FLOAT32_C(  519.64) },
+      UINT16_C(39620),
+      { SIMDE_FLOAT32_C(  257.63), SIMDE_FLOAT32_C(  642.21), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(  191.58),
+        SIMDE_FLOAT32_C(  989.37), SIMDE_FLOAT32_C(  815.58), SIMDE_FLOAT32_C(  223.82), SIMDE_FLOAT32_C(  182.08),
+        SIMDE_FLOAT32_C(  796.07), SIMDE_FLOAT32_C(   71.49), SIMDE_FLOAT32_C(  616.73), SIMDE_FLOAT32_C(  913.22),
+        SIMDE_FLOAT32_C( -317.62), SIMDE_FLOAT32_C(  203.28), SIMDE_FLOAT32_C(  157.25), SIMDE_FLOAT32_C( -106.63) },
+      { SIMDE_FLOAT32_C(  103.21), SIMDE_FLOAT32_C( -615.84),     -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  538.75),
+        SIMDE_FLOAT32_C(  401.27), SIMDE_FLOAT32_C(  566.39), SIMDE_FLOAT32_C(    7.00), SIMDE_FLOAT32_C(    7.00),
+        SIMDE_FLOAT32_C(  571.02), SIMDE_FLOAT32_C(    6.00), SIMDE_FLOAT32_C( -500.36), SIMDE_FLOAT32_C(    9.00),
+        SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C( -729.33), SIMDE_FLOAT32_C( -773.27), SIMDE_FLOAT32_C(    6.00) } },
+    { { SIMDE_FLOAT32_C( -878.51), SIMDE_FLOAT32_C( -419.36), SIMDE_FLOAT32_C( -427.85), SIMDE_FLOAT32_C(  610.03),
+        SIMDE_FLOAT32_C( -852.68), SIMDE_FLOAT32_C(  758.49), SIMDE_FLOAT32_C(  104.42), SIMDE_FLOAT32_C(  884.23),
+        SIMDE_FLOAT32_C(  -11.72), SIMDE_FLOAT32_C(   58.77), SIMDE_FLOAT32_C( -912.43), SIMDE_FLOAT32_C( -551.30),
+        SIMDE_FLOAT32_C(  -74.14), SIMDE_FLOAT32_C( -261.66), SIMDE_FLOAT32_C( -800.72), SIMDE_FLOAT32_C( -757.54) },
+      UINT16_C(24137),
+      { SIMDE_FLOAT32_C(  241.57), SIMDE_FLOAT32_C( -605.02), SIMDE_FLOAT32_C( -844.19), SIMDE_FLOAT32_C(  112.21),
+        SIMDE_FLOAT32_C(  288.35), SIMDE_FLOAT32_C(  859.20), SIMDE_FLOAT32_C( -652.22), SIMDE_FLOAT32_C(    1.00),
+        SIMDE_FLOAT32_C( -668.16), SIMDE_FLOAT32_C( -915.58), SIMDE_FLOAT32_C(  331.43), SIMDE_FLOAT32_C(   -0.00),
+        SIMDE_FLOAT32_C( -266.13), SIMDE_FLOAT32_C( -588.25), SIMDE_FLOAT32_C( -578.99), SIMDE_FLOAT32_C(  529.68) },
+      { SIMDE_FLOAT32_C(    7.00), SIMDE_FLOAT32_C( -419.36), SIMDE_FLOAT32_C( -427.85), SIMDE_FLOAT32_C(    6.00),
+        SIMDE_FLOAT32_C( -852.68), SIMDE_FLOAT32_C(  758.49), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(  884.23),
+        SIMDE_FLOAT32_C(  -11.72), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    8.00),     -SIMDE_MATH_INFINITYF,
+        SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C( -261.66), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C( -757.54) } },
+    { { SIMDE_FLOAT32_C(    8.54), SIMDE_FLOAT32_C(  361.90), SIMDE_FLOAT32_C( -751.56), SIMDE_FLOAT32_C( -309.06),
+        SIMDE_FLOAT32_C( -393.86), SIMDE_FLOAT32_C( -994.56), SIMDE_FLOAT32_C(  241.00), SIMDE_FLOAT32_C( -572.79),
+        SIMDE_FLOAT32_C(  663.69), SIMDE_FLOAT32_C(  486.45), SIMDE_FLOAT32_C(  938.39), SIMDE_FLOAT32_C(  179.08),
+        SIMDE_FLOAT32_C(  149.88), SIMDE_FLOAT32_C( -569.78), SIMDE_FLOAT32_C(  249.48), SIMDE_FLOAT32_C(   70.02) },
+      UINT16_C(49270),
+      { SIMDE_FLOAT32_C(  547.94), SIMDE_FLOAT32_C( -512.12), SIMDE_FLOAT32_C( -197.39),           SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(  -89.95), SIMDE_FLOAT32_C(  435.55), SIMDE_FLOAT32_C( -723.83), SIMDE_FLOAT32_C(  799.35),
+        SIMDE_FLOAT32_C( -739.36), SIMDE_FLOAT32_C( -327.22), SIMDE_FLOAT32_C(  177.61), SIMDE_FLOAT32_C( -252.65),
+        SIMDE_FLOAT32_C(  281.53), SIMDE_FLOAT32_C(    1.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C( -158.02) },
+      { SIMDE_FLOAT32_C(    8.54), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    7.00), SIMDE_FLOAT32_C( -309.06),
+        SIMDE_FLOAT32_C(    6.00), SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C( -572.79),
+        SIMDE_FLOAT32_C(  663.69), SIMDE_FLOAT32_C(  486.45), SIMDE_FLOAT32_C(  938.39), SIMDE_FLOAT32_C(  179.08),
+        SIMDE_FLOAT32_C(  149.88), SIMDE_FLOAT32_C( -569.78),     -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    7.00) } },
+    { { SIMDE_FLOAT32_C(  978.24), SIMDE_FLOAT32_C(   84.21), SIMDE_FLOAT32_C(  382.46), SIMDE_FLOAT32_C( -366.93),
+        SIMDE_FLOAT32_C( -924.24), SIMDE_FLOAT32_C(  923.63), SIMDE_FLOAT32_C(  198.83), SIMDE_FLOAT32_C(  921.08),
+        SIMDE_FLOAT32_C(  504.63), SIMDE_FLOAT32_C( -976.44), SIMDE_FLOAT32_C( -181.54), SIMDE_FLOAT32_C(  217.42),
+        SIMDE_FLOAT32_C( -523.92), SIMDE_FLOAT32_C(  310.44), SIMDE_FLOAT32_C(  454.71), SIMDE_FLOAT32_C(  685.96) },
+      UINT16_C(22640),
+      { SIMDE_FLOAT32_C( -489.51), SIMDE_FLOAT32_C(    5.15), SIMDE_FLOAT32_C(    1.00), SIMDE_FLOAT32_C(  835.46),
+        SIMDE_FLOAT32_C(  333.23), SIMDE_FLOAT32_C(   89.90), SIMDE_FLOAT32_C( -888.83), SIMDE_FLOAT32_C( -653.12),
+        SIMDE_FLOAT32_C( -573.30), SIMDE_FLOAT32_C(  480.32), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(  -80.60),
+        SIMDE_FLOAT32_C( -852.10), SIMDE_FLOAT32_C(  330.17), SIMDE_FLOAT32_C(  258.47), SIMDE_FLOAT32_C( -374.07) },
+      { SIMDE_FLOAT32_C(  978.24), SIMDE_FLOAT32_C(   84.21), SIMDE_FLOAT32_C(  382.46), SIMDE_FLOAT32_C( -366.93),
+        SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    6.00), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(  921.08),
+        SIMDE_FLOAT32_C(  504.63), SIMDE_FLOAT32_C( -976.44), SIMDE_FLOAT32_C( -181.54), SIMDE_FLOAT32_C(    6.00),
+        SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(  310.44), SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(  685.96) } },
+    { { SIMDE_FLOAT32_C(  463.65), SIMDE_FLOAT32_C(  978.45), SIMDE_FLOAT32_C(  128.58), SIMDE_FLOAT32_C( -901.96),
+        SIMDE_FLOAT32_C(  534.71), SIMDE_FLOAT32_C(  841.49), SIMDE_FLOAT32_C( -774.58), SIMDE_FLOAT32_C( -860.32),
+        SIMDE_FLOAT32_C(  711.29), SIMDE_FLOAT32_C(  753.63), SIMDE_FLOAT32_C(   71.48), SIMDE_FLOAT32_C( -592.85),
+        SIMDE_FLOAT32_C(  297.92), SIMDE_FLOAT32_C(  708.68), SIMDE_FLOAT32_C(  215.21), SIMDE_FLOAT32_C( -286.48) },
+      UINT16_C(47117),
+      { SIMDE_FLOAT32_C(  819.18), SIMDE_FLOAT32_C(  -48.19), SIMDE_FLOAT32_C(   -0.00), SIMDE_FLOAT32_C(  349.12),
+        SIMDE_FLOAT32_C(  384.72),     -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  364.60), SIMDE_FLOAT32_C( -152.94),
+        SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(  705.00), SIMDE_FLOAT32_C( -128.22),
+        SIMDE_FLOAT32_C(  316.44), SIMDE_FLOAT32_C(  -56.58), SIMDE_FLOAT32_C(  314.30), SIMDE_FLOAT32_C(  791.83) },
+      { SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(  978.45),     -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    8.00),
+        SIMDE_FLOAT32_C(  534.71), SIMDE_FLOAT32_C(  841.49), SIMDE_FLOAT32_C( -774.58), SIMDE_FLOAT32_C( -860.32),
+        SIMDE_FLOAT32_C(  711.29), SIMDE_FLOAT32_C(  753.63), SIMDE_FLOAT32_C(   71.48), SIMDE_FLOAT32_C(    7.00),
+        SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    5.00), SIMDE_FLOAT32_C(  215.21), SIMDE_FLOAT32_C(    9.00) } },
+    { { SIMDE_FLOAT32_C(  743.94), SIMDE_FLOAT32_C(  555.05), SIMDE_FLOAT32_C(  141.41), SIMDE_FLOAT32_C( -121.58),
+        SIMDE_FLOAT32_C( -372.03), SIMDE_FLOAT32_C( -708.80), SIMDE_FLOAT32_C(  871.40), SIMDE_FLOAT32_C( -664.45),
+        SIMDE_FLOAT32_C(  787.88), SIMDE_FLOAT32_C(  386.97), SIMDE_FLOAT32_C(  114.35), SIMDE_FLOAT32_C( -994.49),
+        SIMDE_FLOAT32_C(  715.32), SIMDE_FLOAT32_C( -650.39), SIMDE_FLOAT32_C( -862.45), SIMDE_FLOAT32_C(  -85.93) },
+      UINT16_C( 5718),
+      { SIMDE_FLOAT32_C(  535.71), SIMDE_FLOAT32_C(  975.52), SIMDE_FLOAT32_C(  149.52), SIMDE_FLOAT32_C(  952.55),
+        SIMDE_FLOAT32_C( -963.11), SIMDE_FLOAT32_C( -673.20), SIMDE_FLOAT32_C(  953.01), SIMDE_FLOAT32_C(  546.96),
+        SIMDE_FLOAT32_C(  483.99), SIMDE_FLOAT32_C( -400.23), SIMDE_FLOAT32_C(    1.00), SIMDE_FLOAT32_C(  571.73),
+        SIMDE_FLOAT32_C(  612.08), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(  623.86), SIMDE_FLOAT32_C( -354.57) },
+      { SIMDE_FLOAT32_C(  743.94), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    7.00), SIMDE_FLOAT32_C( -121.58),
+        SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C( -708.80), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C( -664.45),
+        SIMDE_FLOAT32_C(  787.88), SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C( -994.49),
+        SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C( -650.39), SIMDE_FLOAT32_C( -862.45), SIMDE_FLOAT32_C(  -85.93) } },
+    { { SIMDE_FLOAT32_C(   11.64), SIMDE_FLOAT32_C( -732.50), SIMDE_FLOAT32_C(  674.06), SIMDE_FLOAT32_C(  465.36),
+        SIMDE_FLOAT32_C(  725.71), SIMDE_FLOAT32_C(  -67.52), SIMDE_FLOAT32_C(  904.65), SIMDE_FLOAT32_C( -273.53),
+        SIMDE_FLOAT32_C(  -35.60), SIMDE_FLOAT32_C( -631.32), SIMDE_FLOAT32_C(  -72.65), SIMDE_FLOAT32_C(  218.82),
+        SIMDE_FLOAT32_C( -458.35), SIMDE_FLOAT32_C( -300.03), SIMDE_FLOAT32_C( -963.86), SIMDE_FLOAT32_C(   28.25) },
+      UINT16_C(12364),
+      { SIMDE_FLOAT32_C(    1.00), SIMDE_FLOAT32_C( -831.41), SIMDE_FLOAT32_C(  669.51), SIMDE_FLOAT32_C(  382.52),
+        SIMDE_FLOAT32_C(  521.31), SIMDE_FLOAT32_C(   -6.48), SIMDE_FLOAT32_C( -531.34), SIMDE_FLOAT32_C(  900.93),
+        SIMDE_FLOAT32_C( -380.34), SIMDE_FLOAT32_C(  958.35), SIMDE_FLOAT32_C(  529.97), SIMDE_FLOAT32_C(    1.00),
+        SIMDE_FLOAT32_C(  443.25), SIMDE_FLOAT32_C(  771.67), SIMDE_FLOAT32_C( -200.01), SIMDE_FLOAT32_C( -983.21) },
+      { SIMDE_FLOAT32_C(   11.64), SIMDE_FLOAT32_C( -732.50), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    8.00),
+        SIMDE_FLOAT32_C(  725.71), SIMDE_FLOAT32_C(  -67.52), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C( -273.53),
+        SIMDE_FLOAT32_C(  -35.60), SIMDE_FLOAT32_C( -631.32), SIMDE_FLOAT32_C(  -72.65), SIMDE_FLOAT32_C(  218.82),
+        SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C( -963.86), SIMDE_FLOAT32_C(   28.25) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 src = simde_mm512_loadu_ps(test_vec[i].src);
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_mask_getexp_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_getexp_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { UINT16_C(50107),
+      { SIMDE_FLOAT32_C( -306.62), SIMDE_FLOAT32_C( -217.13), SIMDE_FLOAT32_C( -845.57), SIMDE_FLOAT32_C( -960.88),
+        SIMDE_FLOAT32_C( -969.43), SIMDE_FLOAT32_C(   -0.00), SIMDE_FLOAT32_C(  452.84), SIMDE_FLOAT32_C(    1.00),
+        SIMDE_FLOAT32_C(  917.14), SIMDE_FLOAT32_C(  534.35), SIMDE_FLOAT32_C( -475.53), SIMDE_FLOAT32_C(  650.57),
+        SIMDE_FLOAT32_C( -738.34), SIMDE_FLOAT32_C(  716.66), SIMDE_FLOAT32_C( -258.80), SIMDE_FLOAT32_C(  958.33) },
+      { SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    7.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    9.00),
+        SIMDE_FLOAT32_C(    9.00),     -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    9.00) } },
+    { UINT16_C(11965),
+      { SIMDE_FLOAT32_C(  390.12), SIMDE_FLOAT32_C(  503.65), SIMDE_FLOAT32_C(    1.00), SIMDE_FLOAT32_C( -251.63),
+        SIMDE_FLOAT32_C(  -88.72), SIMDE_FLOAT32_C( -884.34), SIMDE_FLOAT32_C( -330.67), SIMDE_FLOAT32_C( -171.98),
+        SIMDE_FLOAT32_C( -357.06), SIMDE_FLOAT32_C( -621.87), SIMDE_FLOAT32_C(  795.45), SIMDE_FLOAT32_C(  335.37),
+        SIMDE_FLOAT32_C( -396.61), SIMDE_FLOAT32_C(  -62.42), SIMDE_FLOAT32_C(  742.48), SIMDE_FLOAT32_C(  366.21) },
+      { SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    7.00),
+        SIMDE_FLOAT32_C(    6.00), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    7.00),
+        SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    8.00),
+        SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    5.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00) } },
+    { UINT16_C( 8130),
+      { SIMDE_FLOAT32_C( -715.22), SIMDE_FLOAT32_C(   -0.00), SIMDE_FLOAT32_C(  850.43), SIMDE_FLOAT32_C(  605.58),
+        SIMDE_FLOAT32_C(  696.28), SIMDE_FLOAT32_C( -591.18),           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  670.41),
+        SIMDE_FLOAT32_C( -395.57), SIMDE_FLOAT32_C( -956.75),           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  811.24),
+        SIMDE_FLOAT32_C( -755.26), SIMDE_FLOAT32_C( -137.26), SIMDE_FLOAT32_C( -476.25), SIMDE_FLOAT32_C( -415.01) },
+      { SIMDE_FLOAT32_C(    0.00),     -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00),           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    9.00),
+        SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    9.00),           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    9.00),
+        SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00) } },
+    { UINT16_C(43679),
+      { SIMDE_FLOAT32_C(  303.63), SIMDE_FLOAT32_C( -763.98), SIMDE_FLOAT32_C( -418.78), SIMDE_FLOAT32_C( -558.98),
+        SIMDE_FLOAT32_C(  894.89), SIMDE_FLOAT32_C( -464.96), SIMDE_FLOAT32_C(  -94.70), SIMDE_FLOAT32_C( -493.17),
+        SIMDE_FLOAT32_C( -800.38), SIMDE_FLOAT32_C( -527.23), SIMDE_FLOAT32_C(   62.12), SIMDE_FLOAT32_C( -862.16),
+        SIMDE_FLOAT32_C(  672.09), SIMDE_FLOAT32_C(  233.40), SIMDE_FLOAT32_C(  123.08), SIMDE_FLOAT32_C( -354.98) },
+      { SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    9.00),
+        SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    8.00),
+        SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    9.00),
+        SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    7.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    8.00) } },
+    { UINT16_C( 1471),
+      { SIMDE_FLOAT32_C(  386.70), SIMDE_FLOAT32_C(    1.00),     -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  842.63),
+        SIMDE_FLOAT32_C(  515.45), SIMDE_FLOAT32_C(  318.00), SIMDE_FLOAT32_C( -608.70), SIMDE_FLOAT32_C( -217.81),
+        SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C( -709.60), SIMDE_FLOAT32_C(    1.00), SIMDE_FLOAT32_C( -292.11),
+        SIMDE_FLOAT32_C( -560.94), SIMDE_FLOAT32_C(  -92.35), SIMDE_FLOAT32_C( -552.03), SIMDE_FLOAT32_C( -952.17) },
+      { SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    0.00),      SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    9.00),
+        SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    7.00),
+            -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00) } },
+    { UINT16_C(23585),
+      {           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  134.56), SIMDE_FLOAT32_C(  890.75), SIMDE_FLOAT32_C(  284.44),
+        SIMDE_FLOAT32_C(    1.00), SIMDE_FLOAT32_C( -682.65), SIMDE_FLOAT32_C(  -25.02), SIMDE_FLOAT32_C( -142.91),
+        SIMDE_FLOAT32_C(  966.82), SIMDE_FLOAT32_C( -393.36),     -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  498.16),
+        SIMDE_FLOAT32_C( -962.40), SIMDE_FLOAT32_C(  840.51), SIMDE_FLOAT32_C(  228.60), SIMDE_FLOAT32_C( -233.41) },
+      {           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00),      SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    8.00),
+        SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    7.00), SIMDE_FLOAT32_C(    0.00) } },
+    { UINT16_C(35709),
+      { SIMDE_FLOAT32_C(  510.39), SIMDE_FLOAT32_C(   54.08), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(  415.07),
+        SIMDE_FLOAT32_C(  -91.75), SIMDE_FLOAT32_C( -206.65), SIMDE_FLOAT32_C(   60.65), SIMDE_FLOAT32_C(  346.97),
+        SIMDE_FLOAT32_C(   21.38), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C( -456.29), SIMDE_FLOAT32_C( -726.72),
+        SIMDE_FLOAT32_C( -457.19),      SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  574.64), SIMDE_FLOAT32_C( -383.18) },
+      { SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    0.00),     -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    8.00),
+        SIMDE_FLOAT32_C(    6.00), SIMDE_FLOAT32_C(    7.00), SIMDE_FLOAT32_C(    5.00), SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C(    4.00),     -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    9.00),
+        SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    8.00) } },
+    { UINT16_C(35653),
+      { SIMDE_FLOAT32_C(  480.47), SIMDE_FLOAT32_C( -410.47), SIMDE_FLOAT32_C(  430.87), SIMDE_FLOAT32_C( -339.49),
+        SIMDE_FLOAT32_C( -750.33), SIMDE_FLOAT32_C( -675.06), SIMDE_FLOAT32_C(   53.12), SIMDE_FLOAT32_C(  623.24),
+                  SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  684.18), SIMDE_FLOAT32_C( -193.11), SIMDE_FLOAT32_C(  -71.20),
+                  SIMDE_MATH_NANF, SIMDE_FLOAT32_C( -423.86), SIMDE_FLOAT32_C( -948.89), SIMDE_FLOAT32_C( -866.58) },
+      { SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    8.00), SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    5.00), SIMDE_FLOAT32_C(    0.00),
+                  SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    9.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    6.00),
+        SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    9.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_maskz_getexp_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_getexp_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C( -842.14), SIMDE_FLOAT64_C(  208.50), SIMDE_FLOAT64_C(  118.66), SIMDE_FLOAT64_C(  -62.35),
+                   SIMDE_MATH_NAN, SIMDE_FLOAT64_C( -319.92), SIMDE_FLOAT64_C( -281.70), SIMDE_FLOAT64_C( -291.47) },
+      { SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    7.00), SIMDE_FLOAT64_C(    6.00), SIMDE_FLOAT64_C(    5.00),
+                   SIMDE_MATH_NAN, SIMDE_FLOAT64_C(    8.00), SIMDE_FLOAT64_C(    8.00), SIMDE_FLOAT64_C(    8.00) } },
+    { { SIMDE_FLOAT64_C(  441.69), SIMDE_FLOAT64_C( -872.27), SIMDE_FLOAT64_C(  982.33), SIMDE_FLOAT64_C( -729.20),
+        SIMDE_FLOAT64_C(  319.00), SIMDE_FLOAT64_C( -202.92), SIMDE_FLOAT64_C(  512.53), SIMDE_FLOAT64_C(  -40.56) },
+      { SIMDE_FLOAT64_C(    8.00), SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    9.00),
+        SIMDE_FLOAT64_C(    8.00), SIMDE_FLOAT64_C(    7.00), SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    5.00) } },
+    { { SIMDE_FLOAT64_C(  763.65), SIMDE_FLOAT64_C( -961.83), SIMDE_FLOAT64_C( -889.19), SIMDE_FLOAT64_C(  978.08),
+        SIMDE_FLOAT64_C( -282.67), SIMDE_FLOAT64_C(  764.40), SIMDE_FLOAT64_C(  900.37), SIMDE_FLOAT64_C( -539.37) },
+      { SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    9.00),
+        SIMDE_FLOAT64_C(    8.00), SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    9.00) } },
+    { { SIMDE_FLOAT64_C(  367.32), SIMDE_FLOAT64_C(  169.07), SIMDE_FLOAT64_C(  853.25), SIMDE_FLOAT64_C(  490.31),
+        SIMDE_FLOAT64_C( -383.72), SIMDE_FLOAT64_C(  648.59), SIMDE_FLOAT64_C(  883.61), SIMDE_FLOAT64_C( -493.40) },
+      { SIMDE_FLOAT64_C(    8.00), SIMDE_FLOAT64_C(    7.00), SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    8.00),
+        SIMDE_FLOAT64_C(    8.00), SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    8.00) } },
+    { { SIMDE_FLOAT64_C(  -87.98), SIMDE_FLOAT64_C(  805.22), SIMDE_FLOAT64_C(  707.89),       SIMDE_MATH_INFINITY,
+        SIMDE_FLOAT64_C( -986.47), SIMDE_FLOAT64_C(  394.29), SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(  662.03) },
+      { SIMDE_FLOAT64_C(    6.00), SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    9.00),       SIMDE_MATH_INFINITY,
+        SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    8.00),      -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(    9.00) } },
+    { { SIMDE_FLOAT64_C( -756.33), SIMDE_FLOAT64_C(  311.90), SIMDE_FLOAT64_C(  822.13), SIMDE_FLOAT64_C(  335.86),
+        SIMDE_FLOAT64_C( -668.52), SIMDE_FLOAT64_C( -204.91), SIMDE_FLOAT64_C(  174.80), SIMDE_FLOAT64_C(  555.30) },
+      { SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    8.00), SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    8.00),
+        SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    7.00), SIMDE_FLOAT64_C(    7.00), SIMDE_FLOAT64_C(    9.00) } },
+    { { SIMDE_FLOAT64_C( -105.37), SIMDE_FLOAT64_C(  884.03), SIMDE_FLOAT64_C(  414.49), SIMDE_FLOAT64_C( -132.31),
+        SIMDE_FLOAT64_C( -425.89), SIMDE_FLOAT64_C(  438.77), SIMDE_FLOAT64_C(  830.15), SIMDE_FLOAT64_C( -360.22) },
+      { SIMDE_FLOAT64_C(    6.00), SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    8.00), SIMDE_FLOAT64_C(    7.00),
+        SIMDE_FLOAT64_C(    8.00), SIMDE_FLOAT64_C(    8.00), SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    8.00) } },
+    { { SIMDE_FLOAT64_C(  714.03), SIMDE_FLOAT64_C( -958.06), SIMDE_FLOAT64_C(  345.10), SIMDE_FLOAT64_C( -845.41),
+        SIMDE_FLOAT64_C( -533.92), SIMDE_FLOAT64_C(  640.43), SIMDE_FLOAT64_C(  223.64), SIMDE_FLOAT64_C(    1.00) },
+      { SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    8.00), SIMDE_FLOAT64_C(    9.00),
+        SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    7.00), SIMDE_FLOAT64_C(    0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_getexp_pd(a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_getexp_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[8];
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C( -116.59), SIMDE_FLOAT64_C( -290.35), SIMDE_FLOAT64_C(  414.48), SIMDE_FLOAT64_C(  931.64),
+        SIMDE_FLOAT64_C(  670.64), SIMDE_FLOAT64_C(  949.50), SIMDE_FLOAT64_C( -107.33), SIMDE_FLOAT64_C(  146.84) },
+      UINT8_C(192),
+      { SIMDE_FLOAT64_C(  109.29), SIMDE_FLOAT64_C( -739.39), SIMDE_FLOAT64_C( -263.43), SIMDE_FLOAT64_C( -774.27),
+        SIMDE_FLOAT64_C(  924.40), SIMDE_FLOAT64_C(  216.46), SIMDE_FLOAT64_C( -706.68),      -SIMDE_MATH_INFINITY },
+      { SIMDE_FLOAT64_C( -116.59), SIMDE_FLOAT64_C( -290.35), SIMDE_FLOAT64_C(  414.48), SIMDE_FLOAT64_C(  931.64),
+        SIMDE_FLOAT64_C(  670.64), SIMDE_FLOAT64_C(  949.50), SIMDE_FLOAT64_C(    9.00),       SIMDE_MATH_INFINITY } },
+    { { SIMDE_FLOAT64_C( -590.39), SIMDE_FLOAT64_C(  687.94), SIMDE_FLOAT64_C( -971.39), SIMDE_FLOAT64_C( -511.43),
+        SIMDE_FLOAT64_C(  759.49), SIMDE_FLOAT64_C(  331.47), SIMDE_FLOAT64_C( -410.47), SIMDE_FLOAT64_C(  942.13) },
+      UINT8_C(132),
+      { SIMDE_FLOAT64_C(  -33.82), SIMDE_FLOAT64_C(  994.95), SIMDE_FLOAT64_C(  451.36), SIMDE_FLOAT64_C(  627.80),
+        SIMDE_FLOAT64_C(  108.18), SIMDE_FLOAT64_C( -771.08), SIMDE_FLOAT64_C(  702.17), SIMDE_FLOAT64_C( -427.17) },
+      { SIMDE_FLOAT64_C( -590.39), SIMDE_FLOAT64_C(  687.94), SIMDE_FLOAT64_C(    8.00), SIMDE_FLOAT64_C( -511.43),
+        SIMDE_FLOAT64_C(  759.49), SIMDE_FLOAT64_C(  331.47), SIMDE_FLOAT64_C( -410.47), SIMDE_FLOAT64_C(    8.00) } },
+    { { SIMDE_FLOAT64_C(  112.61), SIMDE_FLOAT64_C(  465.51), SIMDE_FLOAT64_C( -778.53), SIMDE_FLOAT64_C(  550.04),
+        SIMDE_FLOAT64_C( -474.20), SIMDE_FLOAT64_C(  169.99), SIMDE_FLOAT64_C( -923.28), SIMDE_FLOAT64_C(  374.31) },
+      UINT8_C(252),
+      { SIMDE_FLOAT64_C( -856.66), SIMDE_FLOAT64_C(  536.34), SIMDE_FLOAT64_C( -593.09), SIMDE_FLOAT64_C( -581.37),
+        SIMDE_FLOAT64_C(  -85.27), SIMDE_FLOAT64_C( -477.04), SIMDE_FLOAT64_C(  418.44), SIMDE_FLOAT64_C(  181.42) },
+      { SIMDE_FLOAT64_C(  112.61), SIMDE_FLOAT64_C(  465.51), SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    9.00),
+        SIMDE_FLOAT64_C(    6.00), SIMDE_FLOAT64_C(    8.00), SIMDE_FLOAT64_C(    8.00), SIMDE_FLOAT64_C(    7.00) } },
+    { { SIMDE_FLOAT64_C( -636.51), SIMDE_FLOAT64_C( -506.96), SIMDE_FLOAT64_C(  354.49), SIMDE_FLOAT64_C( -342.46),
+        SIMDE_FLOAT64_C(  558.08), SIMDE_FLOAT64_C( -535.37), SIMDE_FLOAT64_C( -533.95), SIMDE_FLOAT64_C( -997.26) },
+      UINT8_C(238),
+      { SIMDE_FLOAT64_C( -617.64), SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C( -938.69), SIMDE_FLOAT64_C(    0.00),
+        SIMDE_FLOAT64_C(  685.06),      -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(  818.85), SIMDE_FLOAT64_C(  784.32) },
+      { SIMDE_FLOAT64_C( -636.51),      -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(    9.00),      -SIMDE_MATH_INFINITY,
+        SIMDE_FLOAT64_C(  558.08),       SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    9.00) } },
+    { { SIMDE_FLOAT64_C(   85.74), SIMDE_FLOAT64_C( -296.33), SIMDE_FLOAT64_C( -131.01), SIMDE_FLOAT64_C( -445.82),
+        SIMDE_FLOAT64_C(  257.00), SIMDE_FLOAT64_C( -547.70), SIMDE_FLOAT64_C( -157.94), SIMDE_FLOAT64_C( -610.59) },
+      UINT8_C(209),
+      { SIMDE_FLOAT64_C( -602.57), SIMDE_FLOAT64_C(  359.56), SIMDE_FLOAT64_C(  501.40), SIMDE_FLOAT64_C(  512.02),
+        SIMDE_FLOAT64_C( -475.68), SIMDE_FLOAT64_C( -931.02), SIMDE_FLOAT64_C( -254.38), SIMDE_FLOAT64_C( -193.55) },
+      { SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C( -296.33), SIMDE_FLOAT64_C( -131.01), SIMDE_FLOAT64_C( -445.82),
+        SIMDE_FLOAT64_C(    8.00), SIMDE_FLOAT64_C( -547.70), SIMDE_FLOAT64_C(    7.00), SIMDE_FLOAT64_C(    7.00) } },
+    { { SIMDE_FLOAT64_C( -768.04), SIMDE_FLOAT64_C( -536.03), SIMDE_FLOAT64_C( -695.38), SIMDE_FLOAT64_C( -610.09),
+        SIMDE_FLOAT64_C(  565.03), SIMDE_FLOAT64_C(  204.81), SIMDE_FLOAT64_C(  100.10), SIMDE_FLOAT64_C( -586.17) },
+      UINT8_C(213),
+      { SIMDE_FLOAT64_C( -282.74), SIMDE_FLOAT64_C(  233.54), SIMDE_FLOAT64_C( -493.54), SIMDE_FLOAT64_C( -927.33),
+        SIMDE_FLOAT64_C(    1.00),       SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(  915.62), SIMDE_FLOAT64_C(  727.73) },
+      { SIMDE_FLOAT64_C(    8.00), SIMDE_FLOAT64_C( -536.03), SIMDE_FLOAT64_C(    8.00), SIMDE_FLOAT64_C( -610.09),
+        SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(  204.81), SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    9.00) } },
+    { { SIMDE_FLOAT64_C( -764.25), SIMDE_FLOAT64_C(  161.74), SIMDE_FLOAT64_C( -824.56), SIMDE_FLOAT64_C( -334.99),
+        SIMDE_FLOAT64_C( -381.96), SIMDE_FLOAT64_C(  473.54), SIMDE_FLOAT64_C(  512.93), SIMDE_FLOAT64_C( -756.59) },
+      UINT8_C( 29),
+      { SIMDE_FLOAT64_C( -170.42), SIMDE_FLOAT64_C(  854.25), SIMDE_FLOAT64_C(  463.29), SIMDE_FLOAT64_C( -856.65),
+        SIMDE_FLOAT64_C(  292.37), SIMDE_FLOAT64_C( -145.77), SIMDE_FLOAT64_C(  147.88), SIMDE_FLOAT64_C( -601.44) },
+      { SIMDE_FLOAT64_C(    7.00), SIMDE_FLOAT64_C(  161.74), SIMDE_FLOAT64_C(    8.00), SIMDE_FLOAT64_C(    9.00),
+        SIMDE_FLOAT64_C(    8.00), SIMDE_FLOAT64_C(  473.54), SIMDE_FLOAT64_C(  512.93), SIMDE_FLOAT64_C( -756.59) } },
+    { { SIMDE_FLOAT64_C(  871.74), SIMDE_FLOAT64_C( -235.85), SIMDE_FLOAT64_C(  658.07), SIMDE_FLOAT64_C( -499.81),
+        SIMDE_FLOAT64_C( -731.21), SIMDE_FLOAT64_C(  693.71), SIMDE_FLOAT64_C(  609.62), SIMDE_FLOAT64_C(   13.84) },
+      UINT8_C( 10),
+      { SIMDE_FLOAT64_C(  204.38), SIMDE_FLOAT64_C(   53.83), SIMDE_FLOAT64_C(  188.18), SIMDE_FLOAT64_C(  332.82),
+        SIMDE_FLOAT64_C(  420.64), SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C(   48.25), SIMDE_FLOAT64_C(  394.88) },
+      { SIMDE_FLOAT64_C(  871.74), SIMDE_FLOAT64_C(    5.00), SIMDE_FLOAT64_C(  658.07), SIMDE_FLOAT64_C(    8.00),
+        SIMDE_FLOAT64_C( -731.21), SIMDE_FLOAT64_C(  693.71), SIMDE_FLOAT64_C(  609.62), SIMDE_FLOAT64_C(   13.84) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d src = simde_mm512_loadu_pd(test_vec[i].src);
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_mask_getexp_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_getexp_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { UINT8_C( 30),
+      { SIMDE_FLOAT64_C(  -94.52), SIMDE_FLOAT64_C(  520.10), SIMDE_FLOAT64_C( -522.22), SIMDE_FLOAT64_C(  296.91),
+        SIMDE_FLOAT64_C(  511.17), SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C(  203.62),      -SIMDE_MATH_INFINITY },
+      { SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    8.00),
+        SIMDE_FLOAT64_C(    8.00), SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00) } },
+    { UINT8_C(130),
+      { SIMDE_FLOAT64_C( -608.93), SIMDE_FLOAT64_C(  750.44), SIMDE_FLOAT64_C( -847.57), SIMDE_FLOAT64_C( -199.18),
+        SIMDE_FLOAT64_C(   80.99), SIMDE_FLOAT64_C(  628.78), SIMDE_FLOAT64_C(  -50.50),            SIMDE_MATH_NAN },
+      { SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00),
+        SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00),            SIMDE_MATH_NAN } },
+    { UINT8_C( 53),
+      { SIMDE_FLOAT64_C(   97.08), SIMDE_FLOAT64_C( -535.86), SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(  290.98),
+        SIMDE_FLOAT64_C( -723.91), SIMDE_FLOAT64_C( -625.22), SIMDE_FLOAT64_C(  523.57), SIMDE_FLOAT64_C(  693.11) },
+      { SIMDE_FLOAT64_C(    6.00), SIMDE_FLOAT64_C(    0.00),      -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(    0.00),
+        SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00) } },
+    { UINT8_C(135),
+      { SIMDE_FLOAT64_C(  916.00), SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C( -673.78), SIMDE_FLOAT64_C(  176.39),
+        SIMDE_FLOAT64_C(  916.69), SIMDE_FLOAT64_C( -924.78), SIMDE_FLOAT64_C( -732.14), SIMDE_FLOAT64_C(  129.91) },
+      { SIMDE_FLOAT64_C(    9.00),      -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    0.00),
+        SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    7.00) } },
+    { UINT8_C( 21),
+      { SIMDE_FLOAT64_C(  371.15), SIMDE_FLOAT64_C(  -54.46), SIMDE_FLOAT64_C(  538.29), SIMDE_FLOAT64_C( -312.61),
+        SIMDE_FLOAT64_C(   93.89), SIMDE_FLOAT64_C(  210.98), SIMDE_FLOAT64_C(  200.73), SIMDE_FLOAT64_C( -803.99) },
+      { SIMDE_FLOAT64_C(    8.00), SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    0.00),
+        SIMDE_FLOAT64_C(    6.00), SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00) } },
+    { UINT8_C(228),
+      { SIMDE_FLOAT64_C(    1.00), SIMDE_FLOAT64_C(  753.70), SIMDE_FLOAT64_C( -260.77), SIMDE_FLOAT64_C(  160.62),
+        SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C( -939.44), SIMDE_FLOAT64_C( -794.62), SIMDE_FLOAT64_C(   11.60) },
+      { SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    8.00), SIMDE_FLOAT64_C(    0.00),
+        SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    3.00) } },
+    { UINT8_C(182),
+      { SIMDE_FLOAT64_C(  485.10), SIMDE_FLOAT64_C( -511.94), SIMDE_FLOAT64_C(  235.69), SIMDE_FLOAT64_C(  231.81),
+        SIMDE_FLOAT64_C(  402.94), SIMDE_FLOAT64_C(  424.10), SIMDE_FLOAT64_C(  420.65), SIMDE_FLOAT64_C( -357.64) },
+      { SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    8.00), SIMDE_FLOAT64_C(    7.00), SIMDE_FLOAT64_C(    0.00),
+        SIMDE_FLOAT64_C(    8.00), SIMDE_FLOAT64_C(    8.00), SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    8.00) } },
+    { UINT8_C(191),
+      { SIMDE_FLOAT64_C( -258.38), SIMDE_FLOAT64_C( -447.66), SIMDE_FLOAT64_C( -884.19), SIMDE_FLOAT64_C(   69.88),
+              SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C( -344.94), SIMDE_FLOAT64_C( -184.61), SIMDE_FLOAT64_C( -211.35) },
+      { SIMDE_FLOAT64_C(    8.00), SIMDE_FLOAT64_C(    8.00), SIMDE_FLOAT64_C(    9.00), SIMDE_FLOAT64_C(    6.00),
+              SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(    8.00), SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    7.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_maskz_getexp_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_getexp_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_getexp_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_getexp_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_getexp_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_getexp_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_getexp_pd)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,518 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+#define SIMDE_TEST_X86_AVX512_INSN getmant
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/getmant.h>
+
+static int
+test_simde_mm512_getmant_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  541.4000), SIMDE_FLOAT32_C( -489.0600), SIMDE_FLOAT32_C( -939.7700), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C( -928.9700), SIMDE_FLOAT32_C( -301.6900), SIMDE_FLOAT32_C(  712.2900), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(  909.8600), SIMDE_FLOAT32_C(  396.5000), SIMDE_FLOAT32_C( -452.2700), SIMDE_FLOAT32_C(   14.9600),
+        SIMDE_FLOAT32_C(  469.8300), SIMDE_FLOAT32_C(  -41.6500), SIMDE_FLOAT32_C(  757.7500), SIMDE_FLOAT32_C(  -43.6400) },
+      { SIMDE_FLOAT32_C(    1.0574), SIMDE_FLOAT32_C(   -1.9104), SIMDE_FLOAT32_C(   -1.8355), SIMDE_FLOAT32_C(    1.0000),
+        SIMDE_FLOAT32_C(   -1.8144), SIMDE_FLOAT32_C(   -1.1785), SIMDE_FLOAT32_C(    1.3912), SIMDE_FLOAT32_C(    1.0000),
+        SIMDE_FLOAT32_C(    1.7771), SIMDE_FLOAT32_C(    1.5488), SIMDE_FLOAT32_C(   -1.7667), SIMDE_FLOAT32_C(    1.8700),
+        SIMDE_FLOAT32_C(    1.8353), SIMDE_FLOAT32_C(   -1.3016), SIMDE_FLOAT32_C(    1.4800), SIMDE_FLOAT32_C(   -1.3637) } },
+    { {             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  152.8600), SIMDE_FLOAT32_C( -230.1200), SIMDE_FLOAT32_C(  268.4900),
+        SIMDE_FLOAT32_C( -174.2200), SIMDE_FLOAT32_C(  494.9100), SIMDE_FLOAT32_C(  436.9900), SIMDE_FLOAT32_C(  769.3500),
+        SIMDE_FLOAT32_C( -375.8600), SIMDE_FLOAT32_C(  680.6900), SIMDE_FLOAT32_C(  719.5900), SIMDE_FLOAT32_C( -457.5300),
+        SIMDE_FLOAT32_C(  136.8200), SIMDE_FLOAT32_C(  770.1400), SIMDE_FLOAT32_C(  178.6500), SIMDE_FLOAT32_C(  862.8700) },
+      {             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    1.1942), SIMDE_FLOAT32_C(   -1.7978), SIMDE_FLOAT32_C(    1.0488),
+        SIMDE_FLOAT32_C(   -1.3611), SIMDE_FLOAT32_C(    1.9332), SIMDE_FLOAT32_C(    1.7070), SIMDE_FLOAT32_C(    1.5026),
+        SIMDE_FLOAT32_C(   -1.4682), SIMDE_FLOAT32_C(    1.3295), SIMDE_FLOAT32_C(    1.4054), SIMDE_FLOAT32_C(   -1.7872),
+        SIMDE_FLOAT32_C(    1.0689), SIMDE_FLOAT32_C(    1.5042), SIMDE_FLOAT32_C(    1.3957), SIMDE_FLOAT32_C(    1.6853) } },
+    { { SIMDE_FLOAT32_C(  310.0600), SIMDE_FLOAT32_C(   85.1000), SIMDE_FLOAT32_C(  972.8800), SIMDE_FLOAT32_C(  552.4900),
+        SIMDE_FLOAT32_C( -926.2400), SIMDE_FLOAT32_C(   31.7100),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  832.0000),
+        SIMDE_FLOAT32_C(  494.7700),        SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C( -295.0300), SIMDE_FLOAT32_C(  593.4600),
+        SIMDE_FLOAT32_C(  279.5000), SIMDE_FLOAT32_C(  442.9700), SIMDE_FLOAT32_C( -893.9000), SIMDE_FLOAT32_C(  -28.7400) },
+      { SIMDE_FLOAT32_C(    1.2112), SIMDE_FLOAT32_C(    1.3297), SIMDE_FLOAT32_C(    1.9002), SIMDE_FLOAT32_C(    1.0791),
+        SIMDE_FLOAT32_C(   -1.8091), SIMDE_FLOAT32_C(    1.9819),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    1.6250),
+        SIMDE_FLOAT32_C(    1.9327), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C(   -1.1525), SIMDE_FLOAT32_C(    1.1591),
+        SIMDE_FLOAT32_C(    1.0918), SIMDE_FLOAT32_C(    1.7304), SIMDE_FLOAT32_C(   -1.7459), SIMDE_FLOAT32_C(   -1.7962) } },
+    { { SIMDE_FLOAT32_C(  205.5000), SIMDE_FLOAT32_C(  989.2900), SIMDE_FLOAT32_C( -194.1500), SIMDE_FLOAT32_C(  166.6200),
+        SIMDE_FLOAT32_C(  -12.4900), SIMDE_FLOAT32_C( -197.2400), SIMDE_FLOAT32_C(  310.6000), SIMDE_FLOAT32_C( -344.1100),
+        SIMDE_FLOAT32_C(  889.4600), SIMDE_FLOAT32_C(  263.1300), SIMDE_FLOAT32_C( -928.3600), SIMDE_FLOAT32_C( -797.0900),
+        SIMDE_FLOAT32_C( -583.7100), SIMDE_FLOAT32_C( -725.6600), SIMDE_FLOAT32_C( -599.0500), SIMDE_FLOAT32_C(    1.0000) },
+      { SIMDE_FLOAT32_C(    1.6055), SIMDE_FLOAT32_C(    1.9322), SIMDE_FLOAT32_C(   -1.5168), SIMDE_FLOAT32_C(    1.3017),
+        SIMDE_FLOAT32_C(   -1.5612), SIMDE_FLOAT32_C(   -1.5409), SIMDE_FLOAT32_C(    1.2133), SIMDE_FLOAT32_C(   -1.3442),
+        SIMDE_FLOAT32_C(    1.7372), SIMDE_FLOAT32_C(    1.0279), SIMDE_FLOAT32_C(   -1.8132), SIMDE_FLOAT32_C(   -1.5568),
+        SIMDE_FLOAT32_C(   -1.1401), SIMDE_FLOAT32_C(   -1.4173), SIMDE_FLOAT32_C(   -1.1700), SIMDE_FLOAT32_C(    1.0000) } },
+    { { SIMDE_FLOAT32_C( -939.9400), SIMDE_FLOAT32_C( -874.6500), SIMDE_FLOAT32_C( -379.1100), SIMDE_FLOAT32_C(  314.3300),
+        SIMDE_FLOAT32_C( -335.8500), SIMDE_FLOAT32_C(  135.5000), SIMDE_FLOAT32_C( -872.7100), SIMDE_FLOAT32_C(    1.0000),
+        SIMDE_FLOAT32_C( -437.4500), SIMDE_FLOAT32_C( -947.4100), SIMDE_FLOAT32_C( -409.6800), SIMDE_FLOAT32_C(  262.1900),
+        SIMDE_FLOAT32_C( -699.0000), SIMDE_FLOAT32_C( -932.1200), SIMDE_FLOAT32_C(   -0.0000),        SIMDE_MATH_INFINITYF },
+      { SIMDE_FLOAT32_C(   -1.8358), SIMDE_FLOAT32_C(   -1.7083), SIMDE_FLOAT32_C(   -1.4809), SIMDE_FLOAT32_C(    1.2279),
+        SIMDE_FLOAT32_C(   -1.3119), SIMDE_FLOAT32_C(    1.0586), SIMDE_FLOAT32_C(   -1.7045), SIMDE_FLOAT32_C(    1.0000),
+        SIMDE_FLOAT32_C(   -1.7088), SIMDE_FLOAT32_C(   -1.8504), SIMDE_FLOAT32_C(   -1.6003), SIMDE_FLOAT32_C(    1.0242),
+        SIMDE_FLOAT32_C(   -1.3652), SIMDE_FLOAT32_C(   -1.8205), SIMDE_FLOAT32_C(   -1.0000), SIMDE_FLOAT32_C(    1.0000) } },
+    { { SIMDE_FLOAT32_C( -201.7600), SIMDE_FLOAT32_C(  230.2500), SIMDE_FLOAT32_C( -593.6500), SIMDE_FLOAT32_C( -538.3700),
+        SIMDE_FLOAT32_C( -931.4300), SIMDE_FLOAT32_C(  565.8000), SIMDE_FLOAT32_C(   18.8500),             SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(  456.8400),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  150.1600), SIMDE_FLOAT32_C( -724.4200),
+        SIMDE_FLOAT32_C( -837.4900), SIMDE_FLOAT32_C( -367.3200), SIMDE_FLOAT32_C(  798.4000), SIMDE_FLOAT32_C(  758.2500) },
+      { SIMDE_FLOAT32_C(   -1.5762), SIMDE_FLOAT32_C(    1.7988), SIMDE_FLOAT32_C(   -1.1595), SIMDE_FLOAT32_C(   -1.0515),
+        SIMDE_FLOAT32_C(   -1.8192), SIMDE_FLOAT32_C(    1.1051), SIMDE_FLOAT32_C(    1.1781),             SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(    1.7845),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    1.1731), SIMDE_FLOAT32_C(   -1.4149),
+        SIMDE_FLOAT32_C(   -1.6357), SIMDE_FLOAT32_C(   -1.4348), SIMDE_FLOAT32_C(    1.5594), SIMDE_FLOAT32_C(    1.4810) } },
+    { { SIMDE_FLOAT32_C(  784.7000), SIMDE_FLOAT32_C(  854.3700), SIMDE_FLOAT32_C( -419.2600), SIMDE_FLOAT32_C( -701.7700),
+        SIMDE_FLOAT32_C(  -16.3700),        SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  920.2700), SIMDE_FLOAT32_C( -147.6800),
+        SIMDE_FLOAT32_C(  445.8200), SIMDE_FLOAT32_C( -235.8500), SIMDE_FLOAT32_C(  945.8100), SIMDE_FLOAT32_C(  627.6900),
+        SIMDE_FLOAT32_C(   -0.0000), SIMDE_FLOAT32_C(  810.7600), SIMDE_FLOAT32_C( -574.1900), SIMDE_FLOAT32_C(   -0.0000) },
+      { SIMDE_FLOAT32_C(    1.5326), SIMDE_FLOAT32_C(    1.6687), SIMDE_FLOAT32_C(   -1.6377), SIMDE_FLOAT32_C(   -1.3706),
+        SIMDE_FLOAT32_C(   -1.0231), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C(    1.7974), SIMDE_FLOAT32_C(   -1.1537),
+        SIMDE_FLOAT32_C(    1.7415), SIMDE_FLOAT32_C(   -1.8426), SIMDE_FLOAT32_C(    1.8473), SIMDE_FLOAT32_C(    1.2260),
+        SIMDE_FLOAT32_C(   -1.0000), SIMDE_FLOAT32_C(    1.5835), SIMDE_FLOAT32_C(   -1.1215), SIMDE_FLOAT32_C(   -1.0000) } },
+    { { SIMDE_FLOAT32_C(  899.5100), SIMDE_FLOAT32_C(  -10.4000), SIMDE_FLOAT32_C(   -0.0000), SIMDE_FLOAT32_C( -367.4500),
+        SIMDE_FLOAT32_C(  362.8400), SIMDE_FLOAT32_C( -713.4900), SIMDE_FLOAT32_C( -441.6900), SIMDE_FLOAT32_C( -472.8200),
+        SIMDE_FLOAT32_C(  358.5300), SIMDE_FLOAT32_C(  962.5200), SIMDE_FLOAT32_C(  132.7500), SIMDE_FLOAT32_C( -816.3200),
+        SIMDE_FLOAT32_C( -489.5100),       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  710.9300), SIMDE_FLOAT32_C(    1.0000) },
+      { SIMDE_FLOAT32_C(    1.7569), SIMDE_FLOAT32_C(   -1.3000), SIMDE_FLOAT32_C(   -1.0000), SIMDE_FLOAT32_C(   -1.4354),
+        SIMDE_FLOAT32_C(    1.4173), SIMDE_FLOAT32_C(   -1.3935), SIMDE_FLOAT32_C(   -1.7254), SIMDE_FLOAT32_C(   -1.8470),
+        SIMDE_FLOAT32_C(    1.4005), SIMDE_FLOAT32_C(    1.8799), SIMDE_FLOAT32_C(    1.0371), SIMDE_FLOAT32_C(   -1.5944),
+        SIMDE_FLOAT32_C(   -1.9121), SIMDE_FLOAT32_C(   -1.0000), SIMDE_FLOAT32_C(    1.3885), SIMDE_FLOAT32_C(    1.0000) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_getmant_ps(a, SIMDE_MM_MANT_NORM_1_2, SIMDE_MM_MANT_SIGN_src);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_getmant_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[16];
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C( -254.3800), SIMDE_FLOAT32_C( -833.5700), SIMDE_FLOAT32_C(  -75.3100), SIMDE_FLOAT32_C(  287.2600),
+        SIMDE_FLOAT32_C( -783.3600), SIMDE_FLOAT32_C( -929.0000), SIMDE_FLOAT32_C(  557.2000), SIMDE_FLOAT32_C( -493.7800),
+        SIMDE_FLOAT32_C( -488.7400), SIMDE_FLOAT32_C( -835.9500), SIMDE_FLOAT32_C( -782.4100), SIMDE_FLOAT32_C(  377.3500),
+        SIMDE_FLOAT32_C(  302.0500), SIMDE_FLOAT32_C(  863.5800), SIMDE_FLOAT32_C(   35.4600), SIMDE_FLOAT32_C(  -37.3200) },
+      UINT16_C( 1933),
+      { SIMDE_FLOAT32_C(  356.7700), SIMDE_FLOAT32_C( -644.9400), SIMDE_FLOAT32_C(   60.5300), SIMDE_FLOAT32_C( -954.4200),
+        SIMDE_FLOAT32_C(  164.1600), SIMDE_FLOAT32_C( -686.8300), SIMDE_FLOAT32_C( -877.6600), SIMDE_FLOAT32_C( -627.6600),
+        SIMDE_FLOAT32_C( -453.9600), SIMDE_FLOAT32_C( -275.3500), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   54.8000),
+        SIMDE_FLOAT32_C( -472.6400), SIMDE_FLOAT32_C(  -36.5800), SIMDE_FLOAT32_C(  -84.6200), SIMDE_FLOAT32_C( -134.7800) },
+      { SIMDE_FLOAT32_C(    1.3936), SIMDE_FLOAT32_C( -833.5700), SIMDE_FLOAT32_C(    0.9458), SIMDE_FLOAT32_C(    0.9321),
+        SIMDE_FLOAT32_C( -783.3600), SIMDE_FLOAT32_C( -929.0000), SIMDE_FLOAT32_C(  557.2000), SIMDE_FLOAT32_C(    0.6129),
+        SIMDE_FLOAT32_C(    1.7733), SIMDE_FLOAT32_C(    1.0756), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C(  377.3500),
+        SIMDE_FLOAT32_C(  302.0500), SIMDE_FLOAT32_C(  863.5800), SIMDE_FLOAT32_C(   35.4600), SIMDE_FLOAT32_C(  -37.3200) } },
+    { { SIMDE_FLOAT32_C(  103.2100), SIMDE_FLOAT32_C( -615.8400), SIMDE_FLOAT32_C( -345.2500), SIMDE_FLOAT32_C(  538.7500),
+        SIMDE_FLOAT32_C(  401.2700), SIMDE_FLOAT32_C(  566.3900), SIMDE_FLOAT32_C( -267.4100), SIMDE_FLOAT32_C(  618.2700),
+        SIMDE_FLOAT32_C(  571.0200), SIMDE_FLOAT32_C(  839.3200), SIMDE_FLOAT32_C( -500.3600), SIMDE_FLOAT32_C( -739.8600),
+        SIMDE_FLOAT32_C( -781.9700), SIMDE_FLOAT32_C( -729.3300), SIMDE_FLOAT32_C( -773.2700), SIMDE_FLOAT32_C(  519.6400) },
+      UINT16_C(39620),
+      { SIMDE_FLOAT32_C(  257.6300), SIMDE_FLOAT32_C(  642.2100), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  191.5800),
+        SIMDE_FLOAT32_C(  989.3700), SIMDE_FLOAT32_C(  815.5800), SIMDE_FLOAT32_C(  223.8200), SIMDE_FLOAT32_C(  182.0800),
+        SIMDE_FLOAT32_C(  796.0700), SIMDE_FLOAT32_C(   71.4900), SIMDE_FLOAT32_C(  616.7300), SIMDE_FLOAT32_C(  913.2200),
+        SIMDE_FLOAT32_C( -317.6200), SIMDE_FLOAT32_C(  203.2800), SIMDE_FLOAT32_C(  157.2500), SIMDE_FLOAT32_C( -106.6300) },
+      { SIMDE_FLOAT32_C(  103.2100), SIMDE_FLOAT32_C( -615.8400), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C(  538.7500),
+        SIMDE_FLOAT32_C(  401.2700), SIMDE_FLOAT32_C(  566.3900), SIMDE_FLOAT32_C(    0.8743), SIMDE_FLOAT32_C(    0.7113),
+        SIMDE_FLOAT32_C(  571.0200), SIMDE_FLOAT32_C(    1.1170), SIMDE_FLOAT32_C( -500.3600), SIMDE_FLOAT32_C(    0.8918),
+        SIMDE_FLOAT32_C(    1.2407), SIMDE_FLOAT32_C( -729.3300), SIMDE_FLOAT32_C( -773.2700), SIMDE_FLOAT32_C(    1.6661) } },
+    { { SIMDE_FLOAT32_C( -878.5100), SIMDE_FLOAT32_C( -419.3600), SIMDE_FLOAT32_C( -427.8500), SIMDE_FLOAT32_C(  610.0300),
+        SIMDE_FLOAT32_C( -852.6800), SIMDE_FLOAT32_C(  758.4900), SIMDE_FLOAT32_C(  104.4200), SIMDE_FLOAT32_C(  884.2300),
+        SIMDE_FLOAT32_C(  -11.7200), SIMDE_FLOAT32_C(   58.7700), SIMDE_FLOAT32_C( -912.4300), SIMDE_FLOAT32_C( -551.3000),
+        SIMDE_FLOAT32_C(  -74.1400), SIMDE_FLOAT32_C( -261.6600), SIMDE_FLOAT32_C( -800.7200), SIMDE_FLOAT32_C( -757.5400) },
+      UINT16_C(24137),
+      { SIMDE_FLOAT32_C(  241.5700), SIMDE_FLOAT32_C( -605.0200), SIMDE_FLOAT32_C( -844.1900), SIMDE_FLOAT32_C(  112.2100),
+        SIMDE_FLOAT32_C(  288.3500), SIMDE_FLOAT32_C(  859.2000), SIMDE_FLOAT32_C( -652.2200), SIMDE_FLOAT32_C(    1.0000),
+        SIMDE_FLOAT32_C( -668.1600), SIMDE_FLOAT32_C( -915.5800), SIMDE_FLOAT32_C(  331.4300), SIMDE_FLOAT32_C(   -0.0000),
+        SIMDE_FLOAT32_C( -266.1300), SIMDE_FLOAT32_C( -588.2500), SIMDE_FLOAT32_C( -578.9900), SIMDE_FLOAT32_C(  529.6800) },
+      { SIMDE_FLOAT32_C(    0.9436), SIMDE_FLOAT32_C( -419.3600), SIMDE_FLOAT32_C( -427.8500), SIMDE_FLOAT32_C(    1.7533),
+        SIMDE_FLOAT32_C( -852.6800), SIMDE_FLOAT32_C(  758.4900), SIMDE_FLOAT32_C(    0.6369), SIMDE_FLOAT32_C(  884.2300),
+        SIMDE_FLOAT32_C(  -11.7200), SIMDE_FLOAT32_C(    0.8941), SIMDE_FLOAT32_C(    1.2946), SIMDE_FLOAT32_C(    1.0000),
+        SIMDE_FLOAT32_C(    1.0396), SIMDE_FLOAT32_C( -261.6600), SIMDE_FLOAT32_C(    0.5654), SIMDE_FLOAT32_C( -757.5400) } },
+    { { SIMDE_FLOAT32_C(    8.5400), SIMDE_FLOAT32_C(  361.9000), SIMDE_FLOAT32_C( -751.5600), SIMDE_FLOAT32_C( -309.0600),
+        SIMDE_FLOAT32_C( -393.8600), SIMDE_FLOAT32_C( -994.5600), SIMDE_FLOAT32_C(  241.0000), SIMDE_FLOAT32_C( -572.7900),
+        SIMDE_FLOAT32_C(  663.6900), SIMDE_FLOAT32_C(  486.4500), SIMDE_FLOAT32_C(  938.3900), SIMDE_FLOAT32_C(  179.0800),
+        SIMDE_FLOAT32_C(  149.8800), SIMDE_FLOAT32_C( -569.7800), SIMDE_FLOAT32_C(  249.4800), SIMDE_FLOAT32_C(   70.0200) },
+      UINT16_C(49270),
+      { SIMDE_FLOAT32_C(  547.9400), SIMDE_FLOAT32_C( -512.1200), SIMDE_FLOAT32_C( -197.3900),             SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(  -89.9500), SIMDE_FLOAT32_C(  435.5500), SIMDE_FLOAT32_C( -723.8300), SIMDE_FLOAT32_C(  799.3500),
+        SIMDE_FLOAT32_C( -739.3600), SIMDE_FLOAT32_C( -327.2200), SIMDE_FLOAT32_C(  177.6100), SIMDE_FLOAT32_C( -252.6500),
+        SIMDE_FLOAT32_C(  281.5300), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C( -158.0200) },
+      { SIMDE_FLOAT32_C(    8.5400), SIMDE_FLOAT32_C(    0.5001), SIMDE_FLOAT32_C(    0.7711), SIMDE_FLOAT32_C( -309.0600),
+        SIMDE_FLOAT32_C(    1.4055), SIMDE_FLOAT32_C(    1.7014), SIMDE_FLOAT32_C(    0.7069), SIMDE_FLOAT32_C( -572.7900),
+        SIMDE_FLOAT32_C(  663.6900), SIMDE_FLOAT32_C(  486.4500), SIMDE_FLOAT32_C(  938.3900), SIMDE_FLOAT32_C(  179.0800),
+        SIMDE_FLOAT32_C(  149.8800), SIMDE_FLOAT32_C( -569.7800), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C(    0.6173) } },
+    { { SIMDE_FLOAT32_C(  978.2400), SIMDE_FLOAT32_C(   84.2100), SIMDE_FLOAT32_C(  382.4600), SIMDE_FLOAT32_C( -366.9300),
+        SIMDE_FLOAT32_C( -924.2400), SIMDE_FLOAT32_C(  923.6300), SIMDE_FLOAT32_C(  198.8300), SIMDE_FLOAT32_C(  921.0800),
+        SIMDE_FLOAT32_C(  504.6300), SIMDE_FLOAT32_C( -976.4400), SIMDE_FLOAT32_C( -181.5400), SIMDE_FLOAT32_C(  217.4200),
+        SIMDE_FLOAT32_C( -523.9200), SIMDE_FLOAT32_C(  310.4400), SIMDE_FLOAT32_C(  454.7100), SIMDE_FLOAT32_C(  685.9600) },
+      UINT16_C(22640),
+      { SIMDE_FLOAT32_C( -489.5100), SIMDE_FLOAT32_C(    5.1500), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C(  835.4600),
+        SIMDE_FLOAT32_C(  333.2300), SIMDE_FLOAT32_C(   89.9000), SIMDE_FLOAT32_C( -888.8300), SIMDE_FLOAT32_C( -653.1200),
+        SIMDE_FLOAT32_C( -573.3000), SIMDE_FLOAT32_C(  480.3200), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  -80.6000),
+        SIMDE_FLOAT32_C( -852.1000), SIMDE_FLOAT32_C(  330.1700), SIMDE_FLOAT32_C(  258.4700), SIMDE_FLOAT32_C( -374.0700) },
+      { SIMDE_FLOAT32_C(  978.2400), SIMDE_FLOAT32_C(   84.2100), SIMDE_FLOAT32_C(  382.4600), SIMDE_FLOAT32_C( -366.9300),
+        SIMDE_FLOAT32_C(    1.3017), SIMDE_FLOAT32_C(    1.4047), SIMDE_FLOAT32_C(    0.8680), SIMDE_FLOAT32_C(  921.0800),
+        SIMDE_FLOAT32_C(  504.6300), SIMDE_FLOAT32_C( -976.4400), SIMDE_FLOAT32_C( -181.5400), SIMDE_FLOAT32_C(    1.2594),
+        SIMDE_FLOAT32_C(    0.8321), SIMDE_FLOAT32_C(  310.4400), SIMDE_FLOAT32_C(    1.0096), SIMDE_FLOAT32_C(  685.9600) } },
+    { { SIMDE_FLOAT32_C(  463.6500), SIMDE_FLOAT32_C(  978.4500), SIMDE_FLOAT32_C(  128.5800), SIMDE_FLOAT32_C( -901.9600),
+        SIMDE_FLOAT32_C(  534.7100), SIMDE_FLOAT32_C(  841.4900), SIMDE_FLOAT32_C( -774.5800), SIMDE_FLOAT32_C( -860.3200),
+        SIMDE_FLOAT32_C(  711.2900), SIMDE_FLOAT32_C(  753.6300), SIMDE_FLOAT32_C(   71.4800), SIMDE_FLOAT32_C( -592.8500),
+        SIMDE_FLOAT32_C(  297.9200), SIMDE_FLOAT32_C(  708.6800), SIMDE_FLOAT32_C(  215.2100), SIMDE_FLOAT32_C( -286.4800) },
+      UINT16_C(47117),
+      { SIMDE_FLOAT32_C(  819.1800), SIMDE_FLOAT32_C(  -48.1900), SIMDE_FLOAT32_C(   -0.0000), SIMDE_FLOAT32_C(  349.1200),
+        SIMDE_FLOAT32_C(  384.7200),       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  364.6000), SIMDE_FLOAT32_C( -152.9400),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  705.0000), SIMDE_FLOAT32_C( -128.2200),
+        SIMDE_FLOAT32_C(  316.4400), SIMDE_FLOAT32_C(  -56.5800), SIMDE_FLOAT32_C(  314.3000), SIMDE_FLOAT32_C(  791.8300) },
+      { SIMDE_FLOAT32_C(    0.8000), SIMDE_FLOAT32_C(  978.4500), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C(    1.3637),
+        SIMDE_FLOAT32_C(  534.7100), SIMDE_FLOAT32_C(  841.4900), SIMDE_FLOAT32_C( -774.5800), SIMDE_FLOAT32_C( -860.3200),
+        SIMDE_FLOAT32_C(  711.2900), SIMDE_FLOAT32_C(  753.6300), SIMDE_FLOAT32_C(   71.4800), SIMDE_FLOAT32_C(    0.5009),
+        SIMDE_FLOAT32_C(    1.2361), SIMDE_FLOAT32_C(    0.8841), SIMDE_FLOAT32_C(  215.2100), SIMDE_FLOAT32_C(    0.7733) } },
+    { { SIMDE_FLOAT32_C(  743.9400), SIMDE_FLOAT32_C(  555.0500), SIMDE_FLOAT32_C(  141.4100), SIMDE_FLOAT32_C( -121.5800),
+        SIMDE_FLOAT32_C( -372.0300), SIMDE_FLOAT32_C( -708.8000), SIMDE_FLOAT32_C(  871.4000), SIMDE_FLOAT32_C( -664.4500),
+        SIMDE_FLOAT32_C(  787.8800), SIMDE_FLOAT32_C(  386.9700), SIMDE_FLOAT32_C(  114.3500), SIMDE_FLOAT32_C( -994.4900),
+        SIMDE_FLOAT32_C(  715.3200), SIMDE_FLOAT32_C( -650.3900), SIMDE_FLOAT32_C( -862.4500), SIMDE_FLOAT32_C(  -85.9300) },
+      UINT16_C( 5718),
+      { SIMDE_FLOAT32_C(  535.7100), SIMDE_FLOAT32_C(  975.5200), SIMDE_FLOAT32_C(  149.5200), SIMDE_FLOAT32_C(  952.5500),
+        SIMDE_FLOAT32_C( -963.1100), SIMDE_FLOAT32_C( -673.2000), SIMDE_FLOAT32_C(  953.0100), SIMDE_FLOAT32_C(  546.9600),
+        SIMDE_FLOAT32_C(  483.9900), SIMDE_FLOAT32_C( -400.2300), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C(  571.7300),
+        SIMDE_FLOAT32_C(  612.0800), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  623.8600), SIMDE_FLOAT32_C( -354.5700) },
+      { SIMDE_FLOAT32_C(  743.9400), SIMDE_FLOAT32_C(    0.9527), SIMDE_FLOAT32_C(    0.5841), SIMDE_FLOAT32_C( -121.5800),
+        SIMDE_FLOAT32_C(    0.9405), SIMDE_FLOAT32_C( -708.8000), SIMDE_FLOAT32_C(    0.9307), SIMDE_FLOAT32_C( -664.4500),
+        SIMDE_FLOAT32_C(  787.8800), SIMDE_FLOAT32_C(    1.5634), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C( -994.4900),
+        SIMDE_FLOAT32_C(    0.5977), SIMDE_FLOAT32_C( -650.3900), SIMDE_FLOAT32_C( -862.4500), SIMDE_FLOAT32_C(  -85.9300) } },
+    { { SIMDE_FLOAT32_C(   11.6400), SIMDE_FLOAT32_C( -732.5000), SIMDE_FLOAT32_C(  674.0600), SIMDE_FLOAT32_C(  465.3600),
+        SIMDE_FLOAT32_C(  725.7100), SIMDE_FLOAT32_C(  -67.5200), SIMDE_FLOAT32_C(  904.6500), SIMDE_FLOAT32_C( -273.5300),
+        SIMDE_FLOAT32_C(  -35.6000), SIMDE_FLOAT32_C( -631.3200), SIMDE_FLOAT32_C(  -72.6500), SIMDE_FLOAT32_C(  218.8200),
+        SIMDE_FLOAT32_C( -458.3500), SIMDE_FLOAT32_C( -300.0300), SIMDE_FLOAT32_C( -963.8600), SIMDE_FLOAT32_C(   28.2500) },
+      UINT16_C(12364),
+      { SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C( -831.4100), SIMDE_FLOAT32_C(  669.5100), SIMDE_FLOAT32_C(  382.5200),
+        SIMDE_FLOAT32_C(  521.3100), SIMDE_FLOAT32_C(   -6.4800), SIMDE_FLOAT32_C( -531.3400), SIMDE_FLOAT32_C(  900.9300),
+        SIMDE_FLOAT32_C( -380.3400), SIMDE_FLOAT32_C(  958.3500), SIMDE_FLOAT32_C(  529.9700), SIMDE_FLOAT32_C(    1.0000),
+        SIMDE_FLOAT32_C(  443.2500), SIMDE_FLOAT32_C(  771.6700), SIMDE_FLOAT32_C( -200.0100), SIMDE_FLOAT32_C( -983.2100) },
+      { SIMDE_FLOAT32_C(   11.6400), SIMDE_FLOAT32_C( -732.5000), SIMDE_FLOAT32_C(    0.6538), SIMDE_FLOAT32_C(    1.4942),
+        SIMDE_FLOAT32_C(  725.7100), SIMDE_FLOAT32_C(  -67.5200), SIMDE_FLOAT32_C(    0.5189), SIMDE_FLOAT32_C( -273.5300),
+        SIMDE_FLOAT32_C(  -35.6000), SIMDE_FLOAT32_C( -631.3200), SIMDE_FLOAT32_C(  -72.6500), SIMDE_FLOAT32_C(  218.8200),
+        SIMDE_FLOAT32_C(    1.7314), SIMDE_FLOAT32_C(    0.7536), SIMDE_FLOAT32_C( -963.8600), SIMDE_FLOAT32_C(   28.2500) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 src = simde_mm512_loadu_ps(test_vec[i].src);
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_mask_getmant_ps(src, test_vec[i].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_zero);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_getmant_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { UINT16_C(50107),
+      { SIMDE_FLOAT32_C( -306.6200), SIMDE_FLOAT32_C( -217.1300), SIMDE_FLOAT32_C( -845.5700), SIMDE_FLOAT32_C( -960.8800),
+        SIMDE_FLOAT32_C( -969.4300), SIMDE_FLOAT32_C(   -0.0000), SIMDE_FLOAT32_C(  452.8400), SIMDE_FLOAT32_C(    1.0000),
+        SIMDE_FLOAT32_C(  917.1400), SIMDE_FLOAT32_C(  534.3500), SIMDE_FLOAT32_C( -475.5300), SIMDE_FLOAT32_C(  650.5700),
+        SIMDE_FLOAT32_C( -738.3400), SIMDE_FLOAT32_C(  716.6600), SIMDE_FLOAT32_C( -258.8000), SIMDE_FLOAT32_C(  958.3300) },
+      {             SIMDE_MATH_NANF,             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    0.0000),             SIMDE_MATH_NANF,
+                    SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   -1.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    1.0000),
+        SIMDE_FLOAT32_C(    0.8956), SIMDE_FLOAT32_C(    1.0437), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    0.9359) } },
+    { UINT16_C(11965),
+      { SIMDE_FLOAT32_C(  390.1200), SIMDE_FLOAT32_C(  503.6500), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C( -251.6300),
+        SIMDE_FLOAT32_C(  -88.7200), SIMDE_FLOAT32_C( -884.3400), SIMDE_FLOAT32_C( -330.6700), SIMDE_FLOAT32_C( -171.9800),
+        SIMDE_FLOAT32_C( -357.0600), SIMDE_FLOAT32_C( -621.8700), SIMDE_FLOAT32_C(  795.4500), SIMDE_FLOAT32_C(  335.3700),
+        SIMDE_FLOAT32_C( -396.6100), SIMDE_FLOAT32_C(  -62.4200), SIMDE_FLOAT32_C(  742.4800), SIMDE_FLOAT32_C(  366.2100) },
+      { SIMDE_FLOAT32_C(    0.7620), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    1.0000),             SIMDE_MATH_NANF,
+                    SIMDE_MATH_NANF,             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    0.0000),             SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(    0.0000),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    0.7768), SIMDE_FLOAT32_C(    1.3100),
+        SIMDE_FLOAT32_C(    0.0000),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT16_C( 8130),
+      { SIMDE_FLOAT32_C( -715.2200), SIMDE_FLOAT32_C(   -0.0000), SIMDE_FLOAT32_C(  850.4300), SIMDE_FLOAT32_C(  605.5800),
+        SIMDE_FLOAT32_C(  696.2800), SIMDE_FLOAT32_C( -591.1800),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  670.4100),
+        SIMDE_FLOAT32_C( -395.5700), SIMDE_FLOAT32_C( -956.7500),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  811.2400),
+        SIMDE_FLOAT32_C( -755.2600), SIMDE_FLOAT32_C( -137.2600), SIMDE_FLOAT32_C( -476.2500), SIMDE_FLOAT32_C( -415.0100) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -1.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    1.3094),
+                    SIMDE_MATH_NANF,             SIMDE_MATH_NANF,             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    0.7922),
+                    SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT16_C(43679),
+      { SIMDE_FLOAT32_C(  303.6300), SIMDE_FLOAT32_C( -763.9800), SIMDE_FLOAT32_C( -418.7800), SIMDE_FLOAT32_C( -558.9800),
+        SIMDE_FLOAT32_C(  894.8900), SIMDE_FLOAT32_C( -464.9600), SIMDE_FLOAT32_C(  -94.7000), SIMDE_FLOAT32_C( -493.1700),
+        SIMDE_FLOAT32_C( -800.3800), SIMDE_FLOAT32_C( -527.2300), SIMDE_FLOAT32_C(   62.1200), SIMDE_FLOAT32_C( -862.1600),
+        SIMDE_FLOAT32_C(  672.0900), SIMDE_FLOAT32_C(  233.4000), SIMDE_FLOAT32_C(  123.0800), SIMDE_FLOAT32_C( -354.9800) },
+      { SIMDE_FLOAT32_C(    1.1861),             SIMDE_MATH_NANF,             SIMDE_MATH_NANF,             SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(    0.8739), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),             SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(    0.0000),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    0.0000),             SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.9117), SIMDE_FLOAT32_C(    0.0000),             SIMDE_MATH_NANF } },
+    { UINT16_C( 1471),
+      { SIMDE_FLOAT32_C(  386.7000), SIMDE_FLOAT32_C(    1.0000),       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  842.6300),
+        SIMDE_FLOAT32_C(  515.4500), SIMDE_FLOAT32_C(  318.0000), SIMDE_FLOAT32_C( -608.7000), SIMDE_FLOAT32_C( -217.8100),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C( -709.6000), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C( -292.1100),
+        SIMDE_FLOAT32_C( -560.9400), SIMDE_FLOAT32_C(  -92.3500), SIMDE_FLOAT32_C( -552.0300), SIMDE_FLOAT32_C( -952.1700) },
+      { SIMDE_FLOAT32_C(    0.7553), SIMDE_FLOAT32_C(    1.0000),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    0.8229),
+        SIMDE_FLOAT32_C(    1.0067), SIMDE_FLOAT32_C(    1.2422), SIMDE_FLOAT32_C(    0.0000),             SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT16_C(23585),
+      {             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  134.5600), SIMDE_FLOAT32_C(  890.7500), SIMDE_FLOAT32_C(  284.4400),
+        SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C( -682.6500), SIMDE_FLOAT32_C(  -25.0200), SIMDE_FLOAT32_C( -142.9100),
+        SIMDE_FLOAT32_C(  966.8200), SIMDE_FLOAT32_C( -393.3600),       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  498.1600),
+        SIMDE_FLOAT32_C( -962.4000), SIMDE_FLOAT32_C(  840.5100), SIMDE_FLOAT32_C(  228.6000), SIMDE_FLOAT32_C( -233.4100) },
+      {             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    0.9730),
+                    SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.8930), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT16_C(35709),
+      { SIMDE_FLOAT32_C(  510.3900), SIMDE_FLOAT32_C(   54.0800), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  415.0700),
+        SIMDE_FLOAT32_C(  -91.7500), SIMDE_FLOAT32_C( -206.6500), SIMDE_FLOAT32_C(   60.6500), SIMDE_FLOAT32_C(  346.9700),
+        SIMDE_FLOAT32_C(   21.3800), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C( -456.2900), SIMDE_FLOAT32_C( -726.7200),
+        SIMDE_FLOAT32_C( -457.1900),        SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  574.6400), SIMDE_FLOAT32_C( -383.1800) },
+      { SIMDE_FLOAT32_C(    0.9969), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C(    0.8107),
+                    SIMDE_MATH_NANF,             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    0.9477), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    1.3362), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C(    0.0000),             SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),             SIMDE_MATH_NANF } },
+    { UINT16_C(35653),
+      { SIMDE_FLOAT32_C(  480.4700), SIMDE_FLOAT32_C( -410.4700), SIMDE_FLOAT32_C(  430.8700), SIMDE_FLOAT32_C( -339.4900),
+        SIMDE_FLOAT32_C( -750.3300), SIMDE_FLOAT32_C( -675.0600), SIMDE_FLOAT32_C(   53.1200), SIMDE_FLOAT32_C(  623.2400),
+                    SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  684.1800), SIMDE_FLOAT32_C( -193.1100), SIMDE_FLOAT32_C(  -71.2000),
+                    SIMDE_MATH_NANF, SIMDE_FLOAT32_C( -423.8600), SIMDE_FLOAT32_C( -948.8900), SIMDE_FLOAT32_C( -866.5800) },
+      { SIMDE_FLOAT32_C(    0.9384), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.8415), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.8300), SIMDE_FLOAT32_C(    0.0000),
+                    SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    1.3363), SIMDE_FLOAT32_C(    0.0000),             SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),             SIMDE_MATH_NANF } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_maskz_getmant_ps(test_vec[i].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_nan);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_getmant_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C( -842.1400), SIMDE_FLOAT64_C(  208.5000), SIMDE_FLOAT64_C(  118.6600), SIMDE_FLOAT64_C(  -62.3500),
+                     SIMDE_MATH_NAN, SIMDE_FLOAT64_C( -319.9200), SIMDE_FLOAT64_C( -281.7000), SIMDE_FLOAT64_C( -291.4700) },
+      { SIMDE_FLOAT64_C(    0.8224), SIMDE_FLOAT64_C(    0.8145), SIMDE_FLOAT64_C(    0.9270), SIMDE_FLOAT64_C(    0.9742),
+                     SIMDE_MATH_NAN, SIMDE_FLOAT64_C(    0.6248), SIMDE_FLOAT64_C(    0.5502), SIMDE_FLOAT64_C(    0.5693) } },
+    { { SIMDE_FLOAT64_C(  441.6900), SIMDE_FLOAT64_C( -872.2700), SIMDE_FLOAT64_C(  982.3300), SIMDE_FLOAT64_C( -729.2000),
+        SIMDE_FLOAT64_C(  319.0000), SIMDE_FLOAT64_C( -202.9200), SIMDE_FLOAT64_C(  512.5300), SIMDE_FLOAT64_C(  -40.5600) },
+      { SIMDE_FLOAT64_C(    0.8627), SIMDE_FLOAT64_C(    0.8518), SIMDE_FLOAT64_C(    0.9593), SIMDE_FLOAT64_C(    0.7121),
+        SIMDE_FLOAT64_C(    0.6230), SIMDE_FLOAT64_C(    0.7927), SIMDE_FLOAT64_C(    0.5005), SIMDE_FLOAT64_C(    0.6338) } },
+    { { SIMDE_FLOAT64_C(  763.6500), SIMDE_FLOAT64_C( -961.8300), SIMDE_FLOAT64_C( -889.1900), SIMDE_FLOAT64_C(  978.0800),
+        SIMDE_FLOAT64_C( -282.6700), SIMDE_FLOAT64_C(  764.4000), SIMDE_FLOAT64_C(  900.3700), SIMDE_FLOAT64_C( -539.3700) },
+      { SIMDE_FLOAT64_C(    0.7458), SIMDE_FLOAT64_C(    0.9393), SIMDE_FLOAT64_C(    0.8683), SIMDE_FLOAT64_C(    0.9552),
+        SIMDE_FLOAT64_C(    0.5521), SIMDE_FLOAT64_C(    0.7465), SIMDE_FLOAT64_C(    0.8793), SIMDE_FLOAT64_C(    0.5267) } },
+    { { SIMDE_FLOAT64_C(  367.3200), SIMDE_FLOAT64_C(  169.0700), SIMDE_FLOAT64_C(  853.2500), SIMDE_FLOAT64_C(  490.3100),
+        SIMDE_FLOAT64_C( -383.7200), SIMDE_FLOAT64_C(  648.5900), SIMDE_FLOAT64_C(  883.6100), SIMDE_FLOAT64_C( -493.4000) },
+      { SIMDE_FLOAT64_C(    0.7174), SIMDE_FLOAT64_C(    0.6604), SIMDE_FLOAT64_C(    0.8333), SIMDE_FLOAT64_C(    0.9576),
+        SIMDE_FLOAT64_C(    0.7495), SIMDE_FLOAT64_C(    0.6334), SIMDE_FLOAT64_C(    0.8629), SIMDE_FLOAT64_C(    0.9637) } },
+    { { SIMDE_FLOAT64_C(  -87.9800), SIMDE_FLOAT64_C(  805.2200), SIMDE_FLOAT64_C(  707.8900),         SIMDE_MATH_INFINITY,
+        SIMDE_FLOAT64_C( -986.4700), SIMDE_FLOAT64_C(  394.2900), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(  662.0300) },
+      { SIMDE_FLOAT64_C(    0.6873), SIMDE_FLOAT64_C(    0.7863), SIMDE_FLOAT64_C(    0.6913), SIMDE_FLOAT64_C(    1.0000),
+        SIMDE_FLOAT64_C(    0.9633), SIMDE_FLOAT64_C(    0.7701), SIMDE_FLOAT64_C(    1.0000), SIMDE_FLOAT64_C(    0.6465) } },
+    { { SIMDE_FLOAT64_C( -756.3300), SIMDE_FLOAT64_C(  311.9000), SIMDE_FLOAT64_C(  822.1300), SIMDE_FLOAT64_C(  335.8600),
+        SIMDE_FLOAT64_C( -668.5200), SIMDE_FLOAT64_C( -204.9100), SIMDE_FLOAT64_C(  174.8000), SIMDE_FLOAT64_C(  555.3000) },
+      { SIMDE_FLOAT64_C(    0.7386), SIMDE_FLOAT64_C(    0.6092), SIMDE_FLOAT64_C(    0.8029), SIMDE_FLOAT64_C(    0.6560),
+        SIMDE_FLOAT64_C(    0.6529), SIMDE_FLOAT64_C(    0.8004), SIMDE_FLOAT64_C(    0.6828), SIMDE_FLOAT64_C(    0.5423) } },
+    { { SIMDE_FLOAT64_C( -105.3700), SIMDE_FLOAT64_C(  884.0300), SIMDE_FLOAT64_C(  414.4900), SIMDE_FLOAT64_C( -132.3100),
+        SIMDE_FLOAT64_C( -425.8900), SIMDE_FLOAT64_C(  438.7700), SIMDE_FLOAT64_C(  830.1500), SIMDE_FLOAT64_C( -360.2200) },
+      { SIMDE_FLOAT64_C(    0.8232), SIMDE_FLOAT64_C(    0.8633), SIMDE_FLOAT64_C(    0.8096), SIMDE_FLOAT64_C(    0.5168),
+        SIMDE_FLOAT64_C(    0.8318), SIMDE_FLOAT64_C(    0.8570), SIMDE_FLOAT64_C(    0.8107), SIMDE_FLOAT64_C(    0.7036) } },
+    { { SIMDE_FLOAT64_C(  714.0300), SIMDE_FLOAT64_C( -958.0600), SIMDE_FLOAT64_C(  345.1000), SIMDE_FLOAT64_C( -845.4100),
+        SIMDE_FLOAT64_C( -533.9200), SIMDE_FLOAT64_C(  640.4300), SIMDE_FLOAT64_C(  223.6400), SIMDE_FLOAT64_C(    1.0000) },
+      { SIMDE_FLOAT64_C(    0.6973), SIMDE_FLOAT64_C(    0.9356), SIMDE_FLOAT64_C(    0.6740), SIMDE_FLOAT64_C(    0.8256),
+        SIMDE_FLOAT64_C(    0.5214), SIMDE_FLOAT64_C(    0.6254), SIMDE_FLOAT64_C(    0.8736), SIMDE_FLOAT64_C(    0.5000) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_getmant_pd(a, SIMDE_MM_MANT_NORM_p5_1, SIMDE_MM_MANT_SIGN_zero);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_getmant_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[8];
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C( -116.5900), SIMDE_FLOAT64_C( -290.3500), SIMDE_FLOAT64_C(  414.4800), SIMDE_FLOAT64_C(  931.6400),
+        SIMDE_FLOAT64_C(  670.6400), SIMDE_FLOAT64_C(  949.5000), SIMDE_FLOAT64_C( -107.3300), SIMDE_FLOAT64_C(  146.8400) },
+      UINT8_C(192),
+      { SIMDE_FLOAT64_C(  109.2900), SIMDE_FLOAT64_C( -739.3900), SIMDE_FLOAT64_C( -263.4300), SIMDE_FLOAT64_C( -774.2700),
+        SIMDE_FLOAT64_C(  924.4000), SIMDE_FLOAT64_C(  216.4600), SIMDE_FLOAT64_C( -706.6800),        -SIMDE_MATH_INFINITY },
+      { SIMDE_FLOAT64_C( -116.5900), SIMDE_FLOAT64_C( -290.3500), SIMDE_FLOAT64_C(  414.4800), SIMDE_FLOAT64_C(  931.6400),
+        SIMDE_FLOAT64_C(  670.6400), SIMDE_FLOAT64_C(  949.5000), SIMDE_FLOAT64_C(   -1.3802), SIMDE_FLOAT64_C(   -1.0000) } },
+    { { SIMDE_FLOAT64_C( -590.3900), SIMDE_FLOAT64_C(  687.9400), SIMDE_FLOAT64_C( -971.3900), SIMDE_FLOAT64_C( -511.4300),
+        SIMDE_FLOAT64_C(  759.4900), SIMDE_FLOAT64_C(  331.4700), SIMDE_FLOAT64_C( -410.4700), SIMDE_FLOAT64_C(  942.1300) },
+      UINT8_C(132),
+      { SIMDE_FLOAT64_C(  -33.8200), SIMDE_FLOAT64_C(  994.9500), SIMDE_FLOAT64_C(  451.3600), SIMDE_FLOAT64_C(  627.8000),
+        SIMDE_FLOAT64_C(  108.1800), SIMDE_FLOAT64_C( -771.0800), SIMDE_FLOAT64_C(  702.1700), SIMDE_FLOAT64_C( -427.1700) },
+      { SIMDE_FLOAT64_C( -590.3900), SIMDE_FLOAT64_C(  687.9400), SIMDE_FLOAT64_C(    0.8816), SIMDE_FLOAT64_C( -511.4300),
+        SIMDE_FLOAT64_C(  759.4900), SIMDE_FLOAT64_C(  331.4700), SIMDE_FLOAT64_C( -410.4700), SIMDE_FLOAT64_C(   -0.8343) } },
+    { { SIMDE_FLOAT64_C(  112.6100), SIMDE_FLOAT64_C(  465.5100), SIMDE_FLOAT64_C( -778.5300), SIMDE_FLOAT64_C(  550.0400),
+        SIMDE_FLOAT64_C( -474.2000), SIMDE_FLOAT64_C(  169.9900), SIMDE_FLOAT64_C( -923.2800), SIMDE_FLOAT64_C(  374.3100) },
+      UINT8_C(252),
+      { SIMDE_FLOAT64_C( -856.6600), SIMDE_FLOAT64_C(  536.3400), SIMDE_FLOAT64_C( -593.0900), SIMDE_FLOAT64_C( -581.3700),
+        SIMDE_FLOAT64_C(  -85.2700), SIMDE_FLOAT64_C( -477.0400), SIMDE_FLOAT64_C(  418.4400), SIMDE_FLOAT64_C(  181.4200) },
+      { SIMDE_FLOAT64_C(  112.6100), SIMDE_FLOAT64_C(  465.5100), SIMDE_FLOAT64_C(   -1.1584), SIMDE_FLOAT64_C(   -1.1355),
+        SIMDE_FLOAT64_C(   -1.3323), SIMDE_FLOAT64_C(   -0.9317), SIMDE_FLOAT64_C(    0.8173), SIMDE_FLOAT64_C(    1.4173) } },
+    { { SIMDE_FLOAT64_C( -636.5100), SIMDE_FLOAT64_C( -506.9600), SIMDE_FLOAT64_C(  354.4900), SIMDE_FLOAT64_C( -342.4600),
+        SIMDE_FLOAT64_C(  558.0800), SIMDE_FLOAT64_C( -535.3700), SIMDE_FLOAT64_C( -533.9500), SIMDE_FLOAT64_C( -997.2600) },
+      UINT8_C(238),
+      { SIMDE_FLOAT64_C( -617.6400), SIMDE_FLOAT64_C(   -0.0000), SIMDE_FLOAT64_C( -938.6900), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(  685.0600),        -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(  818.8500), SIMDE_FLOAT64_C(  784.3200) },
+      { SIMDE_FLOAT64_C( -636.5100), SIMDE_FLOAT64_C(   -1.0000), SIMDE_FLOAT64_C(   -0.9167), SIMDE_FLOAT64_C(    1.0000),
+        SIMDE_FLOAT64_C(  558.0800), SIMDE_FLOAT64_C(   -1.0000), SIMDE_FLOAT64_C(    0.7997), SIMDE_FLOAT64_C(    0.7659) } },
+    { { SIMDE_FLOAT64_C(   85.7400), SIMDE_FLOAT64_C( -296.3300), SIMDE_FLOAT64_C( -131.0100), SIMDE_FLOAT64_C( -445.8200),
+        SIMDE_FLOAT64_C(  257.0000), SIMDE_FLOAT64_C( -547.7000), SIMDE_FLOAT64_C( -157.9400), SIMDE_FLOAT64_C( -610.5900) },
+      UINT8_C(209),
+      { SIMDE_FLOAT64_C( -602.5700), SIMDE_FLOAT64_C(  359.5600), SIMDE_FLOAT64_C(  501.4000), SIMDE_FLOAT64_C(  512.0200),
+        SIMDE_FLOAT64_C( -475.6800), SIMDE_FLOAT64_C( -931.0200), SIMDE_FLOAT64_C( -254.3800), SIMDE_FLOAT64_C( -193.5500) },
+      { SIMDE_FLOAT64_C(   -1.1769), SIMDE_FLOAT64_C( -296.3300), SIMDE_FLOAT64_C( -131.0100), SIMDE_FLOAT64_C( -445.8200),
+        SIMDE_FLOAT64_C(   -0.9291), SIMDE_FLOAT64_C( -547.7000), SIMDE_FLOAT64_C(   -0.9937), SIMDE_FLOAT64_C(   -0.7561) } },
+    { { SIMDE_FLOAT64_C( -768.0400), SIMDE_FLOAT64_C( -536.0300), SIMDE_FLOAT64_C( -695.3800), SIMDE_FLOAT64_C( -610.0900),
+        SIMDE_FLOAT64_C(  565.0300), SIMDE_FLOAT64_C(  204.8100), SIMDE_FLOAT64_C(  100.1000), SIMDE_FLOAT64_C( -586.1700) },
+      UINT8_C(213),
+      { SIMDE_FLOAT64_C( -282.7400), SIMDE_FLOAT64_C(  233.5400), SIMDE_FLOAT64_C( -493.5400), SIMDE_FLOAT64_C( -927.3300),
+        SIMDE_FLOAT64_C(    1.0000),         SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(  915.6200), SIMDE_FLOAT64_C(  727.7300) },
+      { SIMDE_FLOAT64_C(   -1.1045), SIMDE_FLOAT64_C( -536.0300), SIMDE_FLOAT64_C(   -0.9639), SIMDE_FLOAT64_C( -610.0900),
+        SIMDE_FLOAT64_C(    1.0000), SIMDE_FLOAT64_C(  204.8100), SIMDE_FLOAT64_C(    0.8942), SIMDE_FLOAT64_C(    1.4213) } },
+    { { SIMDE_FLOAT64_C( -764.2500), SIMDE_FLOAT64_C(  161.7400), SIMDE_FLOAT64_C( -824.5600), SIMDE_FLOAT64_C( -334.9900),
+        SIMDE_FLOAT64_C( -381.9600), SIMDE_FLOAT64_C(  473.5400), SIMDE_FLOAT64_C(  512.9300), SIMDE_FLOAT64_C( -756.5900) },
+      UINT8_C( 29),
+      { SIMDE_FLOAT64_C( -170.4200), SIMDE_FLOAT64_C(  854.2500), SIMDE_FLOAT64_C(  463.2900), SIMDE_FLOAT64_C( -856.6500),
+        SIMDE_FLOAT64_C(  292.3700), SIMDE_FLOAT64_C( -145.7700), SIMDE_FLOAT64_C(  147.8800), SIMDE_FLOAT64_C( -601.4400) },
+      { SIMDE_FLOAT64_C(   -1.3314), SIMDE_FLOAT64_C(  161.7400), SIMDE_FLOAT64_C(    0.9049), SIMDE_FLOAT64_C(   -0.8366),
+        SIMDE_FLOAT64_C(    1.1421), SIMDE_FLOAT64_C(  473.5400), SIMDE_FLOAT64_C(  512.9300), SIMDE_FLOAT64_C( -756.5900) } },
+    { { SIMDE_FLOAT64_C(  871.7400), SIMDE_FLOAT64_C( -235.8500), SIMDE_FLOAT64_C(  658.0700), SIMDE_FLOAT64_C( -499.8100),
+        SIMDE_FLOAT64_C( -731.2100), SIMDE_FLOAT64_C(  693.7100), SIMDE_FLOAT64_C(  609.6200), SIMDE_FLOAT64_C(   13.8400) },
+      UINT8_C( 10),
+      { SIMDE_FLOAT64_C(  204.3800), SIMDE_FLOAT64_C(   53.8300), SIMDE_FLOAT64_C(  188.1800), SIMDE_FLOAT64_C(  332.8200),
+        SIMDE_FLOAT64_C(  420.6400), SIMDE_FLOAT64_C(   -0.0000), SIMDE_FLOAT64_C(   48.2500), SIMDE_FLOAT64_C(  394.8800) },
+      { SIMDE_FLOAT64_C(  871.7400), SIMDE_FLOAT64_C(    0.8411), SIMDE_FLOAT64_C(  658.0700), SIMDE_FLOAT64_C(    1.3001),
+        SIMDE_FLOAT64_C( -731.2100), SIMDE_FLOAT64_C(  693.7100), SIMDE_FLOAT64_C(  609.6200), SIMDE_FLOAT64_C(   13.8400) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d src = simde_mm512_loadu_pd(test_vec[i].src);
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_mask_getmant_pd(src, test_vec[i].k, a, SIMDE_MM_MANT_NORM_p75_1p5, SIMDE_MM_MANT_SIGN_src);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_getmant_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { UINT8_C( 30),
+      { SIMDE_FLOAT64_C(  -94.5200), SIMDE_FLOAT64_C(  520.1000), SIMDE_FLOAT64_C( -522.2200), SIMDE_FLOAT64_C(  296.9100),
+        SIMDE_FLOAT64_C(  511.1700), SIMDE_FLOAT64_C(   -0.0000), SIMDE_FLOAT64_C(  203.6200),        -SIMDE_MATH_INFINITY },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.5079),              SIMDE_MATH_NAN, SIMDE_FLOAT64_C(    1.1598),
+        SIMDE_FLOAT64_C(    1.9968), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C(130),
+      { SIMDE_FLOAT64_C( -608.9300), SIMDE_FLOAT64_C(  750.4400), SIMDE_FLOAT64_C( -847.5700), SIMDE_FLOAT64_C( -199.1800),
+        SIMDE_FLOAT64_C(   80.9900), SIMDE_FLOAT64_C(  628.7800), SIMDE_FLOAT64_C(  -50.5000),              SIMDE_MATH_NAN },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.7329), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000),              SIMDE_MATH_NAN } },
+    { UINT8_C( 53),
+      { SIMDE_FLOAT64_C(   97.0800), SIMDE_FLOAT64_C( -535.8600), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(  290.9800),
+        SIMDE_FLOAT64_C( -723.9100), SIMDE_FLOAT64_C( -625.2200), SIMDE_FLOAT64_C(  523.5700), SIMDE_FLOAT64_C(  693.1100) },
+      { SIMDE_FLOAT64_C(    1.5169), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    1.0000), SIMDE_FLOAT64_C(    0.0000),
+                     SIMDE_MATH_NAN,              SIMDE_MATH_NAN, SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C(135),
+      { SIMDE_FLOAT64_C(  916.0000), SIMDE_FLOAT64_C(   -0.0000), SIMDE_FLOAT64_C( -673.7800), SIMDE_FLOAT64_C(  176.3900),
+        SIMDE_FLOAT64_C(  916.6900), SIMDE_FLOAT64_C( -924.7800), SIMDE_FLOAT64_C( -732.1400), SIMDE_FLOAT64_C(  129.9100) },
+      { SIMDE_FLOAT64_C(    0.8945), SIMDE_FLOAT64_C(   -1.0000),              SIMDE_MATH_NAN, SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.5075) } },
+    { UINT8_C( 21),
+      { SIMDE_FLOAT64_C(  371.1500), SIMDE_FLOAT64_C(  -54.4600), SIMDE_FLOAT64_C(  538.2900), SIMDE_FLOAT64_C( -312.6100),
+        SIMDE_FLOAT64_C(   93.8900), SIMDE_FLOAT64_C(  210.9800), SIMDE_FLOAT64_C(  200.7300), SIMDE_FLOAT64_C( -803.9900) },
+      { SIMDE_FLOAT64_C(    1.4498), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.5257), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(    1.4670), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C(228),
+      { SIMDE_FLOAT64_C(    1.0000), SIMDE_FLOAT64_C(  753.7000), SIMDE_FLOAT64_C( -260.7700), SIMDE_FLOAT64_C(  160.6200),
+        SIMDE_FLOAT64_C(   -0.0000), SIMDE_FLOAT64_C( -939.4400), SIMDE_FLOAT64_C( -794.6200), SIMDE_FLOAT64_C(   11.6000) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000),              SIMDE_MATH_NAN, SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(    0.0000),              SIMDE_MATH_NAN,              SIMDE_MATH_NAN, SIMDE_FLOAT64_C(    0.7250) } },
+    { UINT8_C(182),
+      { SIMDE_FLOAT64_C(  485.1000), SIMDE_FLOAT64_C( -511.9400), SIMDE_FLOAT64_C(  235.6900), SIMDE_FLOAT64_C(  231.8100),
+        SIMDE_FLOAT64_C(  402.9400), SIMDE_FLOAT64_C(  424.1000), SIMDE_FLOAT64_C(  420.6500), SIMDE_FLOAT64_C( -357.6400) },
+      { SIMDE_FLOAT64_C(    0.0000),              SIMDE_MATH_NAN, SIMDE_FLOAT64_C(    0.9207), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(    1.5740), SIMDE_FLOAT64_C(    1.6566), SIMDE_FLOAT64_C(    0.0000),              SIMDE_MATH_NAN } },
+    { UINT8_C(191),
+      { SIMDE_FLOAT64_C( -258.3800), SIMDE_FLOAT64_C( -447.6600), SIMDE_FLOAT64_C( -884.1900), SIMDE_FLOAT64_C(   69.8800),
+                SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C( -344.9400), SIMDE_FLOAT64_C( -184.6100), SIMDE_FLOAT64_C( -211.3500) },
+      {              SIMDE_MATH_NAN,              SIMDE_MATH_NAN,              SIMDE_MATH_NAN, SIMDE_FLOAT64_C(    1.0919),
+        SIMDE_FLOAT64_C(    1.0000),              SIMDE_MATH_NAN, SIMDE_FLOAT64_C(    0.0000),              SIMDE_MATH_NAN } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_maskz_getmant_pd(test_vec[i].k, a, SIMDE_MM_MANT_NORM_p5_2, SIMDE_MM_MANT_SIGN_nan);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_getmant_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_getmant_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_getmant_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_getmant_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_getmant_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_getmant_pd)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,203 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN kadd
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/kadd.h>
+
+static int
+test_simde_kadd_mask8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 a;
+    const simde__mmask8 b;
+    const simde__mmask8 r;
+  } test_vec[] = {
+    { UINT8_C(  0),
+      UINT8_C(  4),
+      UINT8_C(  4) },
+    { UINT8_C(255),
+      UINT8_C( 88),
+      UINT8_C( 87) },
+    { UINT8_C( 49),
+      UINT8_C( 49),
+      UINT8_C( 98) },
+    { UINT8_C( 20),
+      UINT8_C( 54),
+      UINT8_C( 74) },
+    { UINT8_C(243),
+      UINT8_C( 98),
+      UINT8_C( 85) },
+    { UINT8_C(105),
+      UINT8_C(226),
+      UINT8_C( 75) },
+    { UINT8_C(200),
+      UINT8_C( 14),
+      UINT8_C(214) },
+    { UINT8_C(151),
+      UINT8_C( 54),
+      UINT8_C(205) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask8 r = simde_kadd_mask8(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask8(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kadd_mask16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+    const simde__mmask16 b;
+    const simde__mmask16 r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      UINT16_C(27024),
+      UINT16_C(27024) },
+    { UINT16_C(65535),
+      UINT16_C(50673),
+      UINT16_C(50672) },
+    { UINT16_C(47982),
+      UINT16_C(47982),
+      UINT16_C(30428) },
+    { UINT16_C(36237),
+      UINT16_C(22386),
+      UINT16_C(58623) },
+    { UINT16_C( 2851),
+      UINT16_C(33854),
+      UINT16_C(36705) },
+    { UINT16_C(65147),
+      UINT16_C(26596),
+      UINT16_C(26207) },
+    { UINT16_C(22862),
+      UINT16_C( 1393),
+      UINT16_C(24255) },
+    { UINT16_C(42711),
+      UINT16_C( 9614),
+      UINT16_C(52325) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask16 r = simde_kadd_mask16(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask16(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kadd_mask32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 a;
+    const simde__mmask32 b;
+    const simde__mmask32 r;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT32_C(1790764606),
+      UINT32_C(1790764606) },
+    { UINT32_C(4294967295),
+      UINT32_C(1012426071),
+      UINT32_C(1012426070) },
+    { UINT32_C(4133250568),
+      UINT32_C(4133250568),
+      UINT32_C(3971533840) },
+    { UINT32_C( 717149520),
+      UINT32_C(1736978022),
+      UINT32_C(2454127542) },
+    { UINT32_C( 242079280),
+      UINT32_C(1615473552),
+      UINT32_C(1857552832) },
+    { UINT32_C( 182790271),
+      UINT32_C(3728474561),
+      UINT32_C(3911264832) },
+    { UINT32_C(1718493051),
+      UINT32_C(2739811811),
+      UINT32_C( 163337566) },
+    { UINT32_C(3643204439),
+      UINT32_C(3220521068),
+      UINT32_C(2568758211) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask32 r = simde_kadd_mask32(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kadd_mask64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 a;
+    const simde__mmask64 b;
+    const simde__mmask64 r;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      UINT64_C(12020743693893627166),
+      UINT64_C(12020743693893627166) },
+    { UINT64_C(18446744073709551615),
+      UINT64_C(  668280087575714692),
+      UINT64_C(  668280087575714691) },
+    { UINT64_C(16536004048791274344),
+      UINT64_C(16536004048791274344),
+      UINT64_C(14625264023872997072) },
+    { UINT64_C(13581791436649246816),
+      UINT64_C(18329173900444070719),
+      UINT64_C(13464221263383765919) },
+    { UINT64_C(12284683941548135506),
+      UINT64_C( 5429410011259786053),
+      UINT64_C(17714093952807921559) },
+    { UINT64_C(12324587449408144224),
+      UINT64_C(10882383736987426609),
+      UINT64_C( 4760227112686019217) },
+    { UINT64_C(17691947974579118630),
+      UINT64_C(  482855697506096670),
+      UINT64_C(18174803672085215300) },
+    { UINT64_C( 2163213480610969313),
+      UINT64_C(15177165567400414517),
+      UINT64_C(17340379048011383830) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask64 r = simde_kadd_mask64(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(kadd_mask8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kadd_mask16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kadd_mask32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kadd_mask64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,245 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN kand
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/kand.h>
+
+static int
+test_simde_kand_mask8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 a;
+    const simde__mmask8 b;
+    const simde__mmask8 r;
+  } test_vec[] = {
+    { UINT8_C(  0),
+      UINT8_C( 92),
+      UINT8_C(  0) },
+    { UINT8_C(255),
+      UINT8_C(120),
+      UINT8_C(120) },
+    { UINT8_C(123),
+      UINT8_C(123),
+      UINT8_C(123) },
+    { UINT8_C(106),
+      UINT8_C( 58),
+      UINT8_C( 42) },
+    { UINT8_C(114),
+      UINT8_C(  1),
+      UINT8_C(  0) },
+    { UINT8_C(104),
+      UINT8_C(218),
+      UINT8_C( 72) },
+    { UINT8_C(168),
+      UINT8_C(182),
+      UINT8_C(160) },
+    { UINT8_C( 66),
+      UINT8_C( 60),
+      UINT8_C(  0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask8 r = simde_kand_mask8(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask8(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kand_mask16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+    const simde__mmask16 b;
+    const simde__mmask16 r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      UINT16_C(41615),
+      UINT16_C(    0) },
+    { UINT16_C(65535),
+      UINT16_C(14577),
+      UINT16_C(14577) },
+    { UINT16_C(  663),
+      UINT16_C(  663),
+      UINT16_C(  663) },
+    { UINT16_C(19794),
+      UINT16_C(53406),
+      UINT16_C(16402) },
+    { UINT16_C(21958),
+      UINT16_C(43693),
+      UINT16_C(  132) },
+    { UINT16_C( 9302),
+      UINT16_C(62369),
+      UINT16_C( 8192) },
+    { UINT16_C(48720),
+      UINT16_C(39459),
+      UINT16_C(39424) },
+    { UINT16_C(20323),
+      UINT16_C( 1453),
+      UINT16_C( 1313) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask16 r = simde_kand_mask16(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask16(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kand_mask32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 a;
+    const simde__mmask32 b;
+    const simde__mmask32 r;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT32_C(3389768556),
+      UINT32_C(         0) },
+    { UINT32_C(4294967295),
+      UINT32_C( 946398937),
+      UINT32_C( 946398937) },
+    { UINT32_C(4106869349),
+      UINT32_C(4106869349),
+      UINT32_C(4106869349) },
+    { UINT32_C(1088800030),
+      UINT32_C(  87502580),
+      UINT32_C(   2425876) },
+    { UINT32_C(3837728100),
+      UINT32_C( 661252391),
+      UINT32_C( 606667044) },
+    { UINT32_C(3468773742),
+      UINT32_C(2602956831),
+      UINT32_C(2315339790) },
+    { UINT32_C(2866542641),
+      UINT32_C(2709935366),
+      UINT32_C(2692894720) },
+    { UINT32_C( 117550466),
+      UINT32_C(1995995748),
+      UINT32_C( 100673536) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask32 r = simde_kand_mask32(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kand_mask64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 a;
+    const simde__mmask64 b;
+    const simde__mmask64 r;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      UINT64_C(11043835257696556159),
+      UINT64_C(                   0) },
+    { UINT64_C(18446744073709551615),
+      UINT64_C(12978061762861636387),
+      UINT64_C(12978061762861636387) },
+    { UINT64_C(18177973469798822320),
+      UINT64_C(18177973469798822320),
+      UINT64_C(18177973469798822320) },
+    { UINT64_C( 6673710908173084901),
+      UINT64_C( 7752820852661137699),
+      UINT64_C( 5230236300288335905) },
+    { UINT64_C( 1585321266115439055),
+      UINT64_C( 9118092803556517201),
+      UINT64_C( 1585320980489183553) },
+    { UINT64_C( 9532229974515371666),
+      UINT64_C( 3177742345388760290),
+      UINT64_C(  290772997396040834) },
+    { UINT64_C(10378958388058473350),
+      UINT64_C(10676154810568506706),
+      UINT64_C(10378917149111566594) },
+    { UINT64_C( 5216717000746992735),
+      UINT64_C( 1542241877352283271),
+      UINT64_C(   28429316400350215) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask64 r = simde_kand_mask64(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_kand (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+    const simde__mmask16 b;
+    const simde__mmask16 r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      UINT16_C(54563),
+      UINT16_C(    0) },
+    { UINT16_C(65535),
+      UINT16_C(65532),
+      UINT16_C(65532) },
+    { UINT16_C(51795),
+      UINT16_C(  405),
+      UINT16_C(   17) },
+    { UINT16_C(34299),
+      UINT16_C(24449),
+      UINT16_C( 1409) },
+    { UINT16_C(15387),
+      UINT16_C(32105),
+      UINT16_C(15369) },
+    { UINT16_C(10125),
+      UINT16_C(20242),
+      UINT16_C( 1792) },
+    { UINT16_C(19938),
+      UINT16_C(20736),
+      UINT16_C(16640) },
+    { UINT16_C(30204),
+      UINT16_C(29726),
+      UINT16_C(29724) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask16 r = simde_mm512_kand(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask16(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(kand_mask8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kand_mask16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kand_mask32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kand_mask64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_kand)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,245 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN kandn
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/kandn.h>
+
+static int
+test_simde_kandn_mask8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 a;
+    const simde__mmask8 b;
+    const simde__mmask8 r;
+  } test_vec[] = {
+    { UINT8_C(  0),
+      UINT8_C( 16),
+      UINT8_C( 16) },
+    { UINT8_C(255),
+      UINT8_C( 42),
+      UINT8_C(  0) },
+    { UINT8_C(179),
+      UINT8_C(179),
+      UINT8_C(  0) },
+    { UINT8_C(186),
+      UINT8_C(217),
+      UINT8_C( 65) },
+    { UINT8_C(  3),
+      UINT8_C(113),
+      UINT8_C(112) },
+    { UINT8_C(215),
+      UINT8_C(221),
+      UINT8_C(  8) },
+    { UINT8_C(125),
+      UINT8_C(  3),
+      UINT8_C(  2) },
+    { UINT8_C(235),
+      UINT8_C(215),
+      UINT8_C( 20) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask8 r = simde_kandn_mask8(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask8(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kandn_mask16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+    const simde__mmask16 b;
+    const simde__mmask16 r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      UINT16_C(31134),
+      UINT16_C(31134) },
+    { UINT16_C(65535),
+      UINT16_C(45809),
+      UINT16_C(    0) },
+    { UINT16_C(52149),
+      UINT16_C(52149),
+      UINT16_C(    0) },
+    { UINT16_C(29770),
+      UINT16_C(54588),
+      UINT16_C(33076) },
+    { UINT16_C(40175),
+      UINT16_C( 5121),
+      UINT16_C(    0) },
+    { UINT16_C(32717),
+      UINT16_C(42882),
+      UINT16_C(32770) },
+    { UINT16_C( 1491),
+      UINT16_C(63444),
+      UINT16_C(61956) },
+    { UINT16_C( 9433),
+      UINT16_C(46339),
+      UINT16_C(37122) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask16 r = simde_kandn_mask16(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask16(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kandn_mask32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 a;
+    const simde__mmask32 b;
+    const simde__mmask32 r;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT32_C( 997555832),
+      UINT32_C( 997555832) },
+    { UINT32_C(4294967295),
+      UINT32_C(3949336522),
+      UINT32_C(         0) },
+    { UINT32_C(1744686999),
+      UINT32_C(1744686999),
+      UINT32_C(         0) },
+    { UINT32_C(1585912035),
+      UINT32_C( 141848629),
+      UINT32_C(   7364628) },
+    { UINT32_C(2315930299),
+      UINT32_C( 184678820),
+      UINT32_C(  16888068) },
+    { UINT32_C(2831956617),
+      UINT32_C(2792444601),
+      UINT32_C( 103890992) },
+    { UINT32_C(1718033873),
+      UINT32_C(2593362142),
+      UINT32_C(2559606798) },
+    { UINT32_C(1371703293),
+      UINT32_C(2050747110),
+      UINT32_C( 708405250) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask32 r = simde_kandn_mask32(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kandn_mask64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 a;
+    const simde__mmask64 b;
+    const simde__mmask64 r;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      UINT64_C(12331799029768317750),
+      UINT64_C(12331799029768317750) },
+    { UINT64_C(18446744073709551615),
+      UINT64_C(15012650964230895931),
+      UINT64_C(                   0) },
+    { UINT64_C(12556076588135289799),
+      UINT64_C(12556076588135289799),
+      UINT64_C(                   0) },
+    { UINT64_C( 1307735528445453840),
+      UINT64_C( 5902546600656491266),
+      UINT64_C( 4740052163434238210) },
+    { UINT64_C(13052463187013983644),
+      UINT64_C( 9993389175834360343),
+      UINT64_C(  759987393611899395) },
+    { UINT64_C( 4485013861293594831),
+      UINT64_C( 7273815518574210551),
+      UINT64_C( 4665729922629920048) },
+    { UINT64_C(  859546911372612611),
+      UINT64_C(15554556750281797795),
+      UINT64_C(15280786804774625440) },
+    { UINT64_C(13611592517971929709),
+      UINT64_C(  889523811971638513),
+      UINT64_C(    6799588795221136) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask64 r = simde_kandn_mask64(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_kandn (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+    const simde__mmask16 b;
+    const simde__mmask16 r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      UINT16_C(61641),
+      UINT16_C(61641) },
+    { UINT16_C(65535),
+      UINT16_C(55493),
+      UINT16_C(    0) },
+    { UINT16_C(50160),
+      UINT16_C(25734),
+      UINT16_C( 9222) },
+    { UINT16_C(10038),
+      UINT16_C(58965),
+      UINT16_C(49217) },
+    { UINT16_C(41835),
+      UINT16_C(45444),
+      UINT16_C( 4228) },
+    { UINT16_C(16742),
+      UINT16_C(15705),
+      UINT16_C(15385) },
+    { UINT16_C(11675),
+      UINT16_C(38149),
+      UINT16_C(36868) },
+    { UINT16_C(  730),
+      UINT16_C(15657),
+      UINT16_C(15649) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask16 r = simde_mm512_kandn(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask16(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(kandn_mask8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kandn_mask16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kandn_mask32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kandn_mask64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_kandn)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
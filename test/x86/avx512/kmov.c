@@ -0,0 +1,523 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN kmov
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/kmov.h>
+
+static int
+test_simde_cvtmask8_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 a;
+    const unsigned int r;
+  } test_vec[] = {
+    { UINT8_C(  0),
+      UINT32_C(         0) },
+    { UINT8_C(255),
+      UINT32_C(       255) },
+    { UINT8_C( 85),
+      UINT32_C(        85) },
+    { UINT8_C( 63),
+      UINT32_C(        63) },
+    { UINT8_C(117),
+      UINT32_C(       117) },
+    { UINT8_C(  6),
+      UINT32_C(         6) },
+    { UINT8_C(137),
+      UINT32_C(       137) },
+    { UINT8_C(250),
+      UINT32_C(       250) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned int r = simde_cvtmask8_u32(test_vec[i].a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_cvtu32_mask8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const unsigned int a;
+    const simde__mmask8 r;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT8_C(  0) },
+    { UINT32_C(4294967295),
+      UINT8_C(255) },
+    { UINT32_C(  81903298),
+      UINT8_C(194) },
+    { UINT32_C(1503584166),
+      UINT8_C(166) },
+    { UINT32_C(  92339914),
+      UINT8_C(202) },
+    { UINT32_C(1884481176),
+      UINT8_C(152) },
+    { UINT32_C(4291569283),
+      UINT8_C(131) },
+    { UINT32_C(2316157874),
+      UINT8_C(178) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask8 r = simde_cvtu32_mask8(test_vec[i].a);
+    simde_assert_equal_mmask8(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_cvtmask16_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+    const unsigned int r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      UINT32_C(         0) },
+    { UINT16_C(65535),
+      UINT32_C(     65535) },
+    { UINT16_C(26660),
+      UINT32_C(     26660) },
+    { UINT16_C(33432),
+      UINT32_C(     33432) },
+    { UINT16_C(26871),
+      UINT32_C(     26871) },
+    { UINT16_C(60043),
+      UINT32_C(     60043) },
+    { UINT16_C(38637),
+      UINT32_C(     38637) },
+    { UINT16_C( 5828),
+      UINT32_C(      5828) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned int r = simde_cvtmask16_u32(test_vec[i].a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_cvtu32_mask16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const unsigned int a;
+    const simde__mmask16 r;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT16_C(    0) },
+    { UINT32_C(4294967295),
+      UINT16_C(65535) },
+    { UINT32_C(2270505109),
+      UINT16_C(10389) },
+    { UINT32_C( 608105830),
+      UINT16_C(62822) },
+    { UINT32_C(2996948460),
+      UINT16_C(52716) },
+    { UINT32_C(1028847468),
+      UINT16_C(63340) },
+    { UINT32_C(2285805069),
+      UINT16_C(40461) },
+    { UINT32_C(1056758160),
+      UINT16_C(55696) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask16 r = simde_cvtu32_mask16(test_vec[i].a);
+    simde_assert_equal_mmask16(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_cvtmask32_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 a;
+    const unsigned int r;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT32_C(         0) },
+    { UINT32_C(4294967295),
+      UINT32_C(4294967295) },
+    { UINT32_C(  82605171),
+      UINT32_C(  82605171) },
+    { UINT32_C( 742595973),
+      UINT32_C( 742595973) },
+    { UINT32_C( 185620524),
+      UINT32_C( 185620524) },
+    { UINT32_C( 730334237),
+      UINT32_C( 730334237) },
+    { UINT32_C(1129918227),
+      UINT32_C(1129918227) },
+    { UINT32_C( 941538142),
+      UINT32_C( 941538142) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned int r = simde_cvtmask32_u32(test_vec[i].a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_cvtu32_mask32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const unsigned int a;
+    const simde__mmask32 r;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT32_C(         0) },
+    { UINT32_C(4294967295),
+      UINT32_C(4294967295) },
+    { UINT32_C(1550752854),
+      UINT32_C(1550752854) },
+    { UINT32_C(2085197413),
+      UINT32_C(2085197413) },
+    { UINT32_C(4233808995),
+      UINT32_C(4233808995) },
+    { UINT32_C( 152057213),
+      UINT32_C( 152057213) },
+    { UINT32_C(2134991375),
+      UINT32_C(2134991375) },
+    { UINT32_C(4214190522),
+      UINT32_C(4214190522) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask32 r = simde_cvtu32_mask32(test_vec[i].a);
+    simde_assert_equal_mmask32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_cvtmask64_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 a;
+    const uint64_t r;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      UINT64_C(                   0) },
+    { UINT64_C(18446744073709551615),
+      UINT64_C(18446744073709551615) },
+    { UINT64_C(15433904844900590955),
+      UINT64_C(15433904844900590955) },
+    { UINT64_C( 4513238997861102859),
+      UINT64_C( 4513238997861102859) },
+    { UINT64_C( 8649527586706324572),
+      UINT64_C( 8649527586706324572) },
+    { UINT64_C(17469776415976188532),
+      UINT64_C(17469776415976188532) },
+    { UINT64_C( 6880644899190925862),
+      UINT64_C( 6880644899190925862) },
+    { UINT64_C( 6163793112443741364),
+      UINT64_C( 6163793112443741364) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_cvtmask64_u64(test_vec[i].a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_cvtu64_mask64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint64_t a;
+    const simde__mmask64 r;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      UINT64_C(                   0) },
+    { UINT64_C(18446744073709551615),
+      UINT64_C(18446744073709551615) },
+    { UINT64_C( 5372950126374115274),
+      UINT64_C( 5372950126374115274) },
+    { UINT64_C(11858661931625426586),
+      UINT64_C(11858661931625426586) },
+    { UINT64_C(17969166490943268579),
+      UINT64_C(17969166490943268579) },
+    { UINT64_C( 7501659788096448535),
+      UINT64_C( 7501659788096448535) },
+    { UINT64_C(   54437322669857397),
+      UINT64_C(   54437322669857397) },
+    { UINT64_C(17636926606292402469),
+      UINT64_C(17636926606292402469) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask64 r = simde_cvtu64_mask64(test_vec[i].a);
+    simde_assert_equal_mmask64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_load_mask8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 a;
+  } test_vec[] = {
+    { UINT8_C(  0) },
+    { UINT8_C(255) },
+    { UINT8_C( 52) },
+    { UINT8_C(247) },
+    { UINT8_C(160) },
+    { UINT8_C(164) },
+    { UINT8_C(110) },
+    { UINT8_C(163) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask8 a = test_vec[i].a;
+    simde__mmask8 r = simde_load_mask8(&a);
+    simde_assert_equal_mmask8(r, test_vec[i].a);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_store_mask8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 a;
+  } test_vec[] = {
+    { UINT8_C(  0) },
+    { UINT8_C(255) },
+    { UINT8_C( 38) },
+    { UINT8_C(  1) },
+    { UINT8_C( 54) },
+    { UINT8_C(225) },
+    { UINT8_C(223) },
+    { UINT8_C(245) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask8 r = 0;
+    simde_store_mask8(&r, test_vec[i].a);
+    simde_assert_equal_mmask8(r, test_vec[i].a);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_load_mask16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+  } test_vec[] = {
+    { UINT16_C(    0) },
+    { UINT16_C(65535) },
+    { UINT16_C(39834) },
+    { UINT16_C(59895) },
+    { UINT16_C(39122) },
+    { UINT16_C(43332) },
+    { UINT16_C( 8928) },
+    { UINT16_C( 1847) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask16 a = test_vec[i].a;
+    simde__mmask16 r = simde_load_mask16(&a);
+    simde_assert_equal_mmask16(r, test_vec[i].a);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_store_mask16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+  } test_vec[] = {
+    { UINT16_C(    0) },
+    { UINT16_C(65535) },
+    { UINT16_C(38483) },
+    { UINT16_C( 6315) },
+    { UINT16_C(58560) },
+    { UINT16_C(33297) },
+    { UINT16_C(13195) },
+    { UINT16_C(40313) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask16 r = 0;
+    simde_store_mask16(&r, test_vec[i].a);
+    simde_assert_equal_mmask16(r, test_vec[i].a);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_load_mask32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 a;
+  } test_vec[] = {
+    { UINT32_C(         0) },
+    { UINT32_C(4294967295) },
+    { UINT32_C(1008884976) },
+    { UINT32_C(4067994336) },
+    { UINT32_C(4011302844) },
+    { UINT32_C(1712105608) },
+    { UINT32_C(1175951973) },
+    { UINT32_C(  66367706) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask32 a = test_vec[i].a;
+    simde__mmask32 r = simde_load_mask32(&a);
+    simde_assert_equal_mmask32(r, test_vec[i].a);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_store_mask32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 a;
+  } test_vec[] = {
+    { UINT32_C(         0) },
+    { UINT32_C(4294967295) },
+    { UINT32_C(1976844475) },
+    { UINT32_C( 250339349) },
+    { UINT32_C(3941131913) },
+    { UINT32_C(1379892154) },
+    { UINT32_C(3158286886) },
+    { UINT32_C(1329231542) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask32 r = 0;
+    simde_store_mask32(&r, test_vec[i].a);
+    simde_assert_equal_mmask32(r, test_vec[i].a);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_load_mask64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 a;
+  } test_vec[] = {
+    { UINT64_C(                   0) },
+    { UINT64_C(18446744073709551615) },
+    { UINT64_C(12799103561053657469) },
+    { UINT64_C(14401048511975426381) },
+    { UINT64_C( 4382998570256741877) },
+    { UINT64_C(17888013260110717642) },
+    { UINT64_C( 5189669274462769688) },
+    { UINT64_C(13071972255813213694) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask64 a = test_vec[i].a;
+    simde__mmask64 r = simde_load_mask64(&a);
+    simde_assert_equal_mmask64(r, test_vec[i].a);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_store_mask64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 a;
+  } test_vec[] = {
+    { UINT64_C(                   0) },
+    { UINT64_C(18446744073709551615) },
+    { UINT64_C( 5973769888833156944) },
+    { UINT64_C( 6470701833679516886) },
+    { UINT64_C( 4540005969712036587) },
+    { UINT64_C( 9180904792147170420) },
+    { UINT64_C( 5530150743240675415) },
+    { UINT64_C(18367125334195310284) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask64 r = 0;
+    simde_store_mask64(&r, test_vec[i].a);
+    simde_assert_equal_mmask64(r, test_vec[i].a);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_kmov (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+  } test_vec[] = {
+    { UINT16_C(    0) },
+    { UINT16_C(65535) },
+    { UINT16_C(16064) },
+    { UINT16_C(56623) },
+    { UINT16_C(17615) },
+    { UINT16_C(26056) },
+    { UINT16_C(34136) },
+    { UINT16_C(10200) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask16 r = simde_mm512_kmov(test_vec[i].a);
+    simde_assert_equal_mmask16(r, test_vec[i].a);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(cvtmask8_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(cvtu32_mask8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(cvtmask16_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(cvtu32_mask16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(cvtmask32_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(cvtu32_mask32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(cvtmask64_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(cvtu64_mask64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(load_mask8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(store_mask8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(load_mask16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(store_mask16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(load_mask32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(store_mask32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(load_mask64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(store_mask64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_kmov)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,200 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN knot
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/knot.h>
+
+static int
+test_simde_knot_mask8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 a;
+    const simde__mmask8 r;
+  } test_vec[] = {
+    { UINT8_C(  0),
+      UINT8_C(255) },
+    { UINT8_C(255),
+      UINT8_C(  0) },
+    { UINT8_C(132),
+      UINT8_C(123) },
+    { UINT8_C(208),
+      UINT8_C( 47) },
+    { UINT8_C(137),
+      UINT8_C(118) },
+    { UINT8_C(  0),
+      UINT8_C(255) },
+    { UINT8_C(248),
+      UINT8_C(  7) },
+    { UINT8_C( 32),
+      UINT8_C(223) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask8 r = simde_knot_mask8(test_vec[i].a);
+    simde_assert_equal_mmask8(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_knot_mask16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+    const simde__mmask16 r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      UINT16_C(65535) },
+    { UINT16_C(65535),
+      UINT16_C(    0) },
+    { UINT16_C(20568),
+      UINT16_C(44967) },
+    { UINT16_C(39735),
+      UINT16_C(25800) },
+    { UINT16_C(40255),
+      UINT16_C(25280) },
+    { UINT16_C( 5238),
+      UINT16_C(60297) },
+    { UINT16_C(38444),
+      UINT16_C(27091) },
+    { UINT16_C(35008),
+      UINT16_C(30527) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask16 r = simde_knot_mask16(test_vec[i].a);
+    simde_assert_equal_mmask16(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_knot_mask32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 a;
+    const simde__mmask32 r;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT32_C(4294967295) },
+    { UINT32_C(4294967295),
+      UINT32_C(         0) },
+    { UINT32_C(1299658351),
+      UINT32_C(2995308944) },
+    { UINT32_C(1919475567),
+      UINT32_C(2375491728) },
+    { UINT32_C( 629714349),
+      UINT32_C(3665252946) },
+    { UINT32_C(2564850519),
+      UINT32_C(1730116776) },
+    { UINT32_C(1843601942),
+      UINT32_C(2451365353) },
+    { UINT32_C(4050700591),
+      UINT32_C( 244266704) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask32 r = simde_knot_mask32(test_vec[i].a);
+    simde_assert_equal_mmask32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_knot_mask64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 a;
+    const simde__mmask64 r;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      UINT64_C(18446744073709551615) },
+    { UINT64_C(18446744073709551615),
+      UINT64_C(                   0) },
+    { UINT64_C(10383683738284152779),
+      UINT64_C( 8063060335425398836) },
+    { UINT64_C(14863383085237788863),
+      UINT64_C( 3583360988471762752) },
+    { UINT64_C( 9862494207687801858),
+      UINT64_C( 8584249866021749757) },
+    { UINT64_C(16705958687571935760),
+      UINT64_C( 1740785386137615855) },
+    { UINT64_C(14279390854719754217),
+      UINT64_C( 4167353218989797398) },
+    { UINT64_C( 2735898307572993948),
+      UINT64_C(15710845766136557667) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask64 r = simde_knot_mask64(test_vec[i].a);
+    simde_assert_equal_mmask64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_knot (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+    const simde__mmask16 r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      UINT16_C(65535) },
+    { UINT16_C(65535),
+      UINT16_C(    0) },
+    { UINT16_C(40428),
+      UINT16_C(25107) },
+    { UINT16_C( 2791),
+      UINT16_C(62744) },
+    { UINT16_C(19512),
+      UINT16_C(46023) },
+    { UINT16_C(17207),
+      UINT16_C(48328) },
+    { UINT16_C(19865),
+      UINT16_C(45670) },
+    { UINT16_C(42778),
+      UINT16_C(22757) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask16 r = simde_mm512_knot(test_vec[i].a);
+    simde_assert_equal_mmask16(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(knot_mask8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(knot_mask16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(knot_mask32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(knot_mask64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_knot)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
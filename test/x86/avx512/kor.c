@@ -0,0 +1,245 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN kor
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/kor.h>
+
+static int
+test_simde_kor_mask8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 a;
+    const simde__mmask8 b;
+    const simde__mmask8 r;
+  } test_vec[] = {
+    { UINT8_C(  0),
+      UINT8_C(134),
+      UINT8_C(134) },
+    { UINT8_C(255),
+      UINT8_C( 62),
+      UINT8_C(255) },
+    { UINT8_C(235),
+      UINT8_C(235),
+      UINT8_C(235) },
+    { UINT8_C( 26),
+      UINT8_C(164),
+      UINT8_C(190) },
+    { UINT8_C( 37),
+      UINT8_C( 68),
+      UINT8_C(101) },
+    { UINT8_C( 99),
+      UINT8_C(104),
+      UINT8_C(107) },
+    { UINT8_C(  9),
+      UINT8_C(103),
+      UINT8_C(111) },
+    { UINT8_C(118),
+      UINT8_C(226),
+      UINT8_C(246) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask8 r = simde_kor_mask8(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask8(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kor_mask16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+    const simde__mmask16 b;
+    const simde__mmask16 r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      UINT16_C(47857),
+      UINT16_C(47857) },
+    { UINT16_C(65535),
+      UINT16_C(30566),
+      UINT16_C(65535) },
+    { UINT16_C(30195),
+      UINT16_C(30195),
+      UINT16_C(30195) },
+    { UINT16_C( 2558),
+      UINT16_C( 3873),
+      UINT16_C( 4095) },
+    { UINT16_C( 1987),
+      UINT16_C(46340),
+      UINT16_C(47047) },
+    { UINT16_C(12989),
+      UINT16_C(28022),
+      UINT16_C(32767) },
+    { UINT16_C(43723),
+      UINT16_C(16735),
+      UINT16_C(60383) },
+    { UINT16_C(60616),
+      UINT16_C(63385),
+      UINT16_C(65497) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask16 r = simde_kor_mask16(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask16(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kor_mask32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 a;
+    const simde__mmask32 b;
+    const simde__mmask32 r;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT32_C(2159700387),
+      UINT32_C(2159700387) },
+    { UINT32_C(4294967295),
+      UINT32_C(1650215790),
+      UINT32_C(4294967295) },
+    { UINT32_C( 443631375),
+      UINT32_C( 443631375),
+      UINT32_C( 443631375) },
+    { UINT32_C( 927387912),
+      UINT32_C( 488294071),
+      UINT32_C(1063180223) },
+    { UINT32_C(1786464075),
+      UINT32_C(2716788267),
+      UINT32_C(3959416683) },
+    { UINT32_C( 464899792),
+      UINT32_C(1218757622),
+      UINT32_C(1538641910) },
+    { UINT32_C( 497696148),
+      UINT32_C(1957543741),
+      UINT32_C(2108669885) },
+    { UINT32_C(1863987032),
+      UINT32_C( 606409581),
+      UINT32_C(1866415997) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask32 r = simde_kor_mask32(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kor_mask64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 a;
+    const simde__mmask64 b;
+    const simde__mmask64 r;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      UINT64_C( 7373121578414665630),
+      UINT64_C( 7373121578414665630) },
+    { UINT64_C(18446744073709551615),
+      UINT64_C( 2322098331872877150),
+      UINT64_C(18446744073709551615) },
+    { UINT64_C( 2420808154964596070),
+      UINT64_C( 2420808154964596070),
+      UINT64_C( 2420808154964596070) },
+    { UINT64_C( 9248563147186301997),
+      UINT64_C( 7296467408948131276),
+      UINT64_C(16526943443149127149) },
+    { UINT64_C( 6683522356696187867),
+      UINT64_C( 9150968748060757107),
+      UINT64_C( 9151004104315555835) },
+    { UINT64_C( 3212413289281666058),
+      UINT64_C( 7526578071337072839),
+      UINT64_C( 7851972065114127567) },
+    { UINT64_C(12142486507968386648),
+      UINT64_C(15620213754308137550),
+      UINT64_C(17926270073345791582) },
+    { UINT64_C( 9006028111742978128),
+      UINT64_C(10560098673952166869),
+      UINT64_C(18374642341601303509) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask64 r = simde_kor_mask64(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_kor (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+    const simde__mmask16 b;
+    const simde__mmask16 r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      UINT16_C(19330),
+      UINT16_C(19330) },
+    { UINT16_C(65535),
+      UINT16_C(63847),
+      UINT16_C(65535) },
+    { UINT16_C( 8110),
+      UINT16_C(55542),
+      UINT16_C(57342) },
+    { UINT16_C( 4994),
+      UINT16_C(49248),
+      UINT16_C(54242) },
+    { UINT16_C(65093),
+      UINT16_C(51554),
+      UINT16_C(65383) },
+    { UINT16_C(19986),
+      UINT16_C(48310),
+      UINT16_C(65206) },
+    { UINT16_C(32701),
+      UINT16_C(15831),
+      UINT16_C(32767) },
+    { UINT16_C(35020),
+      UINT16_C(42230),
+      UINT16_C(44286) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask16 r = simde_mm512_kor(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask16(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(kor_mask8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kor_mask16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kor_mask32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kor_mask64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_kor)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,667 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN kortest
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/kortest.h>
+
+static int
+test_simde_kortestz_mask8_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 a;
+    const simde__mmask8 b;
+    const unsigned char r;
+  } test_vec[] = {
+    { UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  1) },
+    { UINT8_C(245),
+      UINT8_C( 10),
+      UINT8_C(  0) },
+    { UINT8_C(178),
+      UINT8_C(178),
+      UINT8_C(  0) },
+    { UINT8_C(255),
+      UINT8_C(113),
+      UINT8_C(  0) },
+    { UINT8_C( 20),
+      UINT8_C(235),
+      UINT8_C(  0) },
+    { UINT8_C(185),
+      UINT8_C( 16),
+      UINT8_C(  0) },
+    { UINT8_C( 19),
+      UINT8_C(231),
+      UINT8_C(  0) },
+    { UINT8_C(208),
+      UINT8_C(209),
+      UINT8_C(  0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned char r = simde_kortestz_mask8_u8(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_u8(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kortestc_mask8_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 a;
+    const simde__mmask8 b;
+    const unsigned char r;
+  } test_vec[] = {
+    { UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  0) },
+    { UINT8_C(245),
+      UINT8_C( 10),
+      UINT8_C(  1) },
+    { UINT8_C(178),
+      UINT8_C(178),
+      UINT8_C(  0) },
+    { UINT8_C(255),
+      UINT8_C(113),
+      UINT8_C(  1) },
+    { UINT8_C( 20),
+      UINT8_C(235),
+      UINT8_C(  1) },
+    { UINT8_C(185),
+      UINT8_C( 16),
+      UINT8_C(  0) },
+    { UINT8_C( 19),
+      UINT8_C(231),
+      UINT8_C(  0) },
+    { UINT8_C(208),
+      UINT8_C(209),
+      UINT8_C(  0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned char r = simde_kortestc_mask8_u8(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_u8(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kortest_mask8_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 a;
+    const simde__mmask8 b;
+    const unsigned char r;
+    const unsigned char all_ones;
+  } test_vec[] = {
+    { UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  1),
+      UINT8_C(  0) },
+    { UINT8_C(245),
+      UINT8_C( 10),
+      UINT8_C(  0),
+      UINT8_C(  1) },
+    { UINT8_C(178),
+      UINT8_C(178),
+      UINT8_C(  0),
+      UINT8_C(  0) },
+    { UINT8_C(255),
+      UINT8_C(113),
+      UINT8_C(  0),
+      UINT8_C(  1) },
+    { UINT8_C( 20),
+      UINT8_C(235),
+      UINT8_C(  0),
+      UINT8_C(  1) },
+    { UINT8_C(185),
+      UINT8_C( 16),
+      UINT8_C(  0),
+      UINT8_C(  0) },
+    { UINT8_C( 19),
+      UINT8_C(231),
+      UINT8_C(  0),
+      UINT8_C(  0) },
+    { UINT8_C(208),
+      UINT8_C(209),
+      UINT8_C(  0),
+      UINT8_C(  0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned char all_ones;
+    unsigned char r = simde_kortest_mask8_u8(test_vec[i].a, test_vec[i].b, &all_ones);
+    simde_assert_equal_u8(r, test_vec[i].r);
+    simde_assert_equal_u8(all_ones, test_vec[i].all_ones);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kortestz_mask16_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+    const simde__mmask16 b;
+    const unsigned char r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      UINT16_C(    0),
+      UINT8_C(  1) },
+    { UINT16_C(58556),
+      UINT16_C( 6979),
+      UINT8_C(  0) },
+    { UINT16_C(41186),
+      UINT16_C(41186),
+      UINT8_C(  0) },
+    { UINT16_C(65535),
+      UINT16_C(17088),
+      UINT8_C(  0) },
+    { UINT16_C(40806),
+      UINT16_C(24729),
+      UINT8_C(  0) },
+    { UINT16_C(20117),
+      UINT16_C(19985),
+      UINT8_C(  0) },
+    { UINT16_C(42609),
+      UINT16_C(65006),
+      UINT8_C(  0) },
+    { UINT16_C(62449),
+      UINT16_C(37000),
+      UINT8_C(  0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned char r = simde_kortestz_mask16_u8(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_u8(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kortestc_mask16_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+    const simde__mmask16 b;
+    const unsigned char r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      UINT16_C(    0),
+      UINT8_C(  0) },
+    { UINT16_C(58556),
+      UINT16_C( 6979),
+      UINT8_C(  1) },
+    { UINT16_C(41186),
+      UINT16_C(41186),
+      UINT8_C(  0) },
+    { UINT16_C(65535),
+      UINT16_C(17088),
+      UINT8_C(  1) },
+    { UINT16_C(40806),
+      UINT16_C(24729),
+      UINT8_C(  1) },
+    { UINT16_C(20117),
+      UINT16_C(19985),
+      UINT8_C(  0) },
+    { UINT16_C(42609),
+      UINT16_C(65006),
+      UINT8_C(  1) },
+    { UINT16_C(62449),
+      UINT16_C(37000),
+      UINT8_C(  0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned char r = simde_kortestc_mask16_u8(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_u8(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kortest_mask16_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+    const simde__mmask16 b;
+    const unsigned char r;
+    const unsigned char all_ones;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      UINT16_C(    0),
+      UINT8_C(  1),
+      UINT8_C(  0) },
+    { UINT16_C(58556),
+      UINT16_C( 6979),
+      UINT8_C(  0),
+      UINT8_C(  1) },
+    { UINT16_C(41186),
+      UINT16_C(41186),
+      UINT8_C(  0),
+      UINT8_C(  0) },
+    { UINT16_C(65535),
+      UINT16_C(17088),
+      UINT8_C(  0),
+      UINT8_C(  1) },
+    { UINT16_C(40806),
+      UINT16_C(24729),
+      UINT8_C(  0),
+      UINT8_C(  1) },
+    { UINT16_C(20117),
+      UINT16_C(19985),
+      UINT8_C(  0),
+      UINT8_C(  0) },
+    { UINT16_C(42609),
+      UINT16_C(65006),
+      UINT8_C(  0),
+      UINT8_C(  1) },
+    { UINT16_C(62449),
+      UINT16_C(37000),
+      UINT8_C(  0),
+      UINT8_C(  0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned char all_ones;
+    unsigned char r = simde_kortest_mask16_u8(test_vec[i].a, test_vec[i].b, &all_ones);
+    simde_assert_equal_u8(r, test_vec[i].r);
+    simde_assert_equal_u8(all_ones, test_vec[i].all_ones);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kortestz_mask32_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 a;
+    const simde__mmask32 b;
+    const unsigned char r;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT32_C(         0),
+      UINT8_C(  1) },
+    { UINT32_C(3376332839),
+      UINT32_C( 918634456),
+      UINT8_C(  0) },
+    { UINT32_C(2050460921),
+      UINT32_C(2050460921),
+      UINT8_C(  0) },
+    { UINT32_C(4294967295),
+      UINT32_C(  93619247),
+      UINT8_C(  0) },
+    { UINT32_C(3761588847),
+      UINT32_C( 533378448),
+      UINT8_C(  0) },
+    { UINT32_C( 493646832),
+      UINT32_C( 354956064),
+      UINT8_C(  0) },
+    { UINT32_C(3816648657),
+      UINT32_C(4286401482),
+      UINT8_C(  0) },
+    { UINT32_C(1725858310),
+      UINT32_C(1172547820),
+      UINT8_C(  0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned char r = simde_kortestz_mask32_u8(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_u8(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kortestc_mask32_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 a;
+    const simde__mmask32 b;
+    const unsigned char r;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT32_C(         0),
+      UINT8_C(  0) },
+    { UINT32_C(3376332839),
+      UINT32_C( 918634456),
+      UINT8_C(  1) },
+    { UINT32_C(2050460921),
+      UINT32_C(2050460921),
+      UINT8_C(  0) },
+    { UINT32_C(4294967295),
+      UINT32_C(  93619247),
+      UINT8_C(  1) },
+    { UINT32_C(3761588847),
+      UINT32_C( 533378448),
+      UINT8_C(  1) },
+    { UINT32_C( 493646832),
+      UINT32_C( 354956064),
+      UINT8_C(  0) },
+    { UINT32_C(3816648657),
+      UINT32_C(4286401482),
+      UINT8_C(  0) },
+    { UINT32_C(1725858310),
+      UINT32_C(1172547820),
+      UINT8_C(  0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned char r = simde_kortestc_mask32_u8(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_u8(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kortest_mask32_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 a;
+    const simde__mmask32 b;
+    const unsigned char r;
+    const unsigned char all_ones;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT32_C(         0),
+      UINT8_C(  1),
+      UINT8_C(  0) },
+    { UINT32_C(3376332839),
+      UINT32_C( 918634456),
+      UINT8_C(  0),
+      UINT8_C(  1) },
+    { UINT32_C(2050460921),
+      UINT32_C(2050460921),
+      UINT8_C(  0),
+      UINT8_C(  0) },
+    { UINT32_C(4294967295),
+      UINT32_C(  93619247),
+      UINT8_C(  0),
+      UINT8_C(  1) },
+    { UINT32_C(3761588847),
+      UINT32_C( 533378448),
+      UINT8_C(  0),
+      UINT8_C(  1) },
+    { UINT32_C( 493646832),
+      UINT32_C( 354956064),
+      UINT8_C(  0),
+      UINT8_C(  0) },
+    { UINT32_C(3816648657),
+      UINT32_C(4286401482),
+      UINT8_C(  0),
+      UINT8_C(  0) },
+    { UINT32_C(1725858310),
+      UINT32_C(1172547820),
+      UINT8_C(  0),
+      UINT8_C(  0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned char all_ones;
+    unsigned char r = simde_kortest_mask32_u8(test_vec[i].a, test_vec[i].b, &all_ones);
+    simde_assert_equal_u8(r, test_vec[i].r);
+    simde_assert_equal_u8(all_ones, test_vec[i].all_ones);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kortestz_mask64_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 a;
+    const simde__mmask64 b;
+    const unsigned char r;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      UINT64_C(                   0),
+      UINT8_C(  1) },
+    { UINT64_C(15965076158440745631),
+      UINT64_C( 2481667915268805984),
+      UINT8_C(  0) },
+    { UINT64_C( 5343464399382264997),
+      UINT64_C( 5343464399382264997),
+      UINT8_C(  0) },
+    { UINT64_C(18446744073709551615),
+      UINT64_C(14453416208555200478),
+      UINT8_C(  0) },
+    { UINT64_C(13427383748632698732),
+      UINT64_C( 5019360325076852883),
+      UINT8_C(  0) },
+    { UINT64_C(  261790175073330982),
+      UINT64_C(  225180807887987462),
+      UINT8_C(  0) },
+    { UINT64_C(13271275509583267170),
+      UINT64_C(16101846317837616430),
+      UINT8_C(  0) },
+    { UINT64_C(14735370414483682198),
+      UINT64_C( 2870665295296791268),
+      UINT8_C(  0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned char r = simde_kortestz_mask64_u8(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_u8(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kortestc_mask64_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 a;
+    const simde__mmask64 b;
+    const unsigned char r;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      UINT64_C(                   0),
+      UINT8_C(  0) },
+    { UINT64_C(15965076158440745631),
+      UINT64_C( 2481667915268805984),
+      UINT8_C(  1) },
+    { UINT64_C( 5343464399382264997),
+      UINT64_C( 5343464399382264997),
+      UINT8_C(  0) },
+    { UINT64_C(18446744073709551615),
+      UINT64_C(14453416208555200478),
+      UINT8_C(  1) },
+    { UINT64_C(13427383748632698732),
+      UINT64_C( 5019360325076852883),
+      UINT8_C(  1) },
+    { UINT64_C(  261790175073330982),
+      UINT64_C(  225180807887987462),
+      UINT8_C(  0) },
+    { UINT64_C(13271275509583267170),
+      UINT64_C(16101846317837616430),
+      UINT8_C(  0) },
+    { UINT64_C(14735370414483682198),
+      UINT64_C( 2870665295296791268),
+      UINT8_C(  0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned char r = simde_kortestc_mask64_u8(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_u8(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kortest_mask64_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 a;
+    const simde__mmask64 b;
+    const unsigned char r;
+    const unsigned char all_ones;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      UINT64_C(                   0),
+      UINT8_C(  1),
+      UINT8_C(  0) },
+    { UINT64_C(15965076158440745631),
+      UINT64_C( 2481667915268805984),
+      UINT8_C(  0),
+      UINT8_C(  1) },
+    { UINT64_C( 5343464399382264997),
+      UINT64_C( 5343464399382264997),
+      UINT8_C(  0),
+      UINT8_C(  0) },
+    { UINT64_C(18446744073709551615),
+      UINT64_C(14453416208555200478),
+      UINT8_C(  0),
+      UINT8_C(  1) },
+    { UINT64_C(13427383748632698732),
+      UINT64_C( 5019360325076852883),
+      UINT8_C(  0),
+      UINT8_C(  1) },
+    { UINT64_C(  261790175073330982),
+      UINT64_C(  225180807887987462),
+      UINT8_C(  0),
+      UINT8_C(  0) },
+    { UINT64_C(13271275509583267170),
+      UINT64_C(16101846317837616430),
+      UINT8_C(  0),
+      UINT8_C(  0) },
+    { UINT64_C(14735370414483682198),
+      UINT64_C( 2870665295296791268),
+      UINT8_C(  0),
+      UINT8_C(  0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned char all_ones;
+    unsigned char r = simde_kortest_mask64_u8(test_vec[i].a, test_vec[i].b, &all_ones);
+    simde_assert_equal_u8(r, test_vec[i].r);
+    simde_assert_equal_u8(all_ones, test_vec[i].all_ones);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_kortestz (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+    const simde__mmask16 b;
+    const int r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      UINT16_C(    0),
+      INT32_C(1) },
+    { UINT16_C(62736),
+      UINT16_C( 2799),
+      INT32_C(0) },
+    { UINT16_C(38855),
+      UINT16_C(38855),
+      INT32_C(0) },
+    { UINT16_C(65535),
+      UINT16_C(63634),
+      INT32_C(0) },
+    { UINT16_C(50865),
+      UINT16_C(14670),
+      INT32_C(0) },
+    { UINT16_C(60801),
+      UINT16_C(17409),
+      INT32_C(0) },
+    { UINT16_C(26790),
+      UINT16_C(37462),
+      INT32_C(0) },
+    { UINT16_C(50416),
+      UINT16_C( 7086),
+      INT32_C(0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int r = simde_mm512_kortestz(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_kortestc (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+    const simde__mmask16 b;
+    const int r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      UINT16_C(    0),
+      INT32_C(0) },
+    { UINT16_C(62736),
+      UINT16_C( 2799),
+      INT32_C(1) },
+    { UINT16_C(38855),
+      UINT16_C(38855),
+      INT32_C(0) },
+    { UINT16_C(65535),
+      UINT16_C(63634),
+      INT32_C(1) },
+    { UINT16_C(50865),
+      UINT16_C(14670),
+      INT32_C(1) },
+    { UINT16_C(60801),
+      UINT16_C(17409),
+      INT32_C(0) },
+    { UINT16_C(26790),
+      UINT16_C(37462),
+      INT32_C(0) },
+    { UINT16_C(50416),
+      UINT16_C( 7086),
+      INT32_C(0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int r = simde_mm512_kortestc(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(kortestz_mask8_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kortestc_mask8_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kortest_mask8_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kortestz_mask16_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kortestc_mask16_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kortest_mask16_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kortestz_mask32_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kortestc_mask32_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kortest_mask32_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kortestz_mask64_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kortestc_mask64_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kortest_mask64_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_kortestz)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_kortestc)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
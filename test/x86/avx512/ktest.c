@@ -0,0 +1,583 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN ktest
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/ktest.h>
+
+static int
+test_simde_ktestz_mask8_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 a;
+    const simde__mmask8 b;
+    const unsigned char r;
+  } test_vec[] = {
+    { UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  1) },
+    { UINT8_C(190),
+      UINT8_C( 65),
+      UINT8_C(  1) },
+    { UINT8_C(248),
+      UINT8_C(248),
+      UINT8_C(  0) },
+    { UINT8_C(255),
+      UINT8_C(212),
+      UINT8_C(  0) },
+    { UINT8_C(187),
+      UINT8_C( 68),
+      UINT8_C(  1) },
+    { UINT8_C(248),
+      UINT8_C(224),
+      UINT8_C(  0) },
+    { UINT8_C(213),
+      UINT8_C(203),
+      UINT8_C(  0) },
+    { UINT8_C(195),
+      UINT8_C(  2),
+      UINT8_C(  0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned char r = simde_ktestz_mask8_u8(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_u8(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_ktestc_mask8_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 a;
+    const simde__mmask8 b;
+    const unsigned char r;
+  } test_vec[] = {
+    { UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  1) },
+    { UINT8_C(190),
+      UINT8_C( 65),
+      UINT8_C(  0) },
+    { UINT8_C(248),
+      UINT8_C(248),
+      UINT8_C(  1) },
+    { UINT8_C(255),
+      UINT8_C(212),
+      UINT8_C(  1) },
+    { UINT8_C(187),
+      UINT8_C( 68),
+      UINT8_C(  0) },
+    { UINT8_C(248),
+      UINT8_C(224),
+      UINT8_C(  1) },
+    { UINT8_C(213),
+      UINT8_C(203),
+      UINT8_C(  0) },
+    { UINT8_C(195),
+      UINT8_C(  2),
+      UINT8_C(  1) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned char r = simde_ktestc_mask8_u8(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_u8(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_ktest_mask8_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 a;
+    const simde__mmask8 b;
+    const unsigned char r;
+    const unsigned char and_not;
+  } test_vec[] = {
+    { UINT8_C(  0),
+      UINT8_C(  0),
+      UINT8_C(  1),
+      UINT8_C(  1) },
+    { UINT8_C(190),
+      UINT8_C( 65),
+      UINT8_C(  1),
+      UINT8_C(  0) },
+    { UINT8_C(248),
+      UINT8_C(248),
+      UINT8_C(  0),
+      UINT8_C(  1) },
+    { UINT8_C(255),
+      UINT8_C(212),
+      UINT8_C(  0),
+      UINT8_C(  1) },
+    { UINT8_C(187),
+      UINT8_C( 68),
+      UINT8_C(  1),
+      UINT8_C(  0) },
+    { UINT8_C(248),
+      UINT8_C(224),
+      UINT8_C(  0),
+      UINT8_C(  1) },
+    { UINT8_C(213),
+      UINT8_C(203),
+      UINT8_C(  0),
+      UINT8_C(  0) },
+    { UINT8_C(195),
+      UINT8_C(  2),
+      UINT8_C(  0),
+      UINT8_C(  1) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned char and_not;
+    unsigned char r = simde_ktest_mask8_u8(test_vec[i].a, test_vec[i].b, &and_not);
+    simde_assert_equal_u8(r, test_vec[i].r);
+    simde_assert_equal_u8(and_not, test_vec[i].and_not);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_ktestz_mask16_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+    const simde__mmask16 b;
+    const unsigned char r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      UINT16_C(    0),
+      UINT8_C(  1) },
+    { UINT16_C(20797),
+      UINT16_C(44738),
+      UINT8_C(  1) },
+    { UINT16_C(63775),
+      UINT16_C(63775),
+      UINT8_C(  0) },
+    { UINT16_C(65535),
+      UINT16_C(11126),
+      UINT8_C(  0) },
+    { UINT16_C(41050),
+      UINT16_C(24485),
+      UINT8_C(  1) },
+    { UINT16_C(27393),
+      UINT16_C(  512),
+      UINT8_C(  0) },
+    { UINT16_C(19054),
+      UINT16_C(23885),
+      UINT8_C(  0) },
+    { UINT16_C(49320),
+      UINT16_C(14074),
+      UINT8_C(  0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned char r = simde_ktestz_mask16_u8(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_u8(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_ktestc_mask16_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+    const simde__mmask16 b;
+    const unsigned char r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      UINT16_C(    0),
+      UINT8_C(  1) },
+    { UINT16_C(20797),
+      UINT16_C(44738),
+      UINT8_C(  0) },
+    { UINT16_C(63775),
+      UINT16_C(63775),
+      UINT8_C(  1) },
+    { UINT16_C(65535),
+      UINT16_C(11126),
+      UINT8_C(  1) },
+    { UINT16_C(41050),
+      UINT16_C(24485),
+      UINT8_C(  0) },
+    { UINT16_C(27393),
+      UINT16_C(  512),
+      UINT8_C(  1) },
+    { UINT16_C(19054),
+      UINT16_C(23885),
+      UINT8_C(  0) },
+    { UINT16_C(49320),
+      UINT16_C(14074),
+      UINT8_C(  0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned char r = simde_ktestc_mask16_u8(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_u8(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_ktest_mask16_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+    const simde__mmask16 b;
+    const unsigned char r;
+    const unsigned char and_not;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      UINT16_C(    0),
+      UINT8_C(  1),
+      UINT8_C(  1) },
+    { UINT16_C(20797),
+      UINT16_C(44738),
+      UINT8_C(  1),
+      UINT8_C(  0) },
+    { UINT16_C(63775),
+      UINT16_C(63775),
+      UINT8_C(  0),
+      UINT8_C(  1) },
+    { UINT16_C(65535),
+      UINT16_C(11126),
+      UINT8_C(  0),
+      UINT8_C(  1) },
+    { UINT16_C(41050),
+      UINT16_C(24485),
+      UINT8_C(  1),
+      UINT8_C(  0) },
+    { UINT16_C(27393),
+      UINT16_C(  512),
+      UINT8_C(  0),
+      UINT8_C(  1) },
+    { UINT16_C(19054),
+      UINT16_C(23885),
+      UINT8_C(  0),
+      UINT8_C(  0) },
+    { UINT16_C(49320),
+      UINT16_C(14074),
+      UINT8_C(  0),
+      UINT8_C(  0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned char and_not;
+    unsigned char r = simde_ktest_mask16_u8(test_vec[i].a, test_vec[i].b, &and_not);
+    simde_assert_equal_u8(r, test_vec[i].r);
+    simde_assert_equal_u8(and_not, test_vec[i].and_not);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_ktestz_mask32_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 a;
+    const simde__mmask32 b;
+    const unsigned char r;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT32_C(         0),
+      UINT8_C(  1) },
+    { UINT32_C( 675549657),
+      UINT32_C(3619417638),
+      UINT8_C(  1) },
+    { UINT32_C(2813663423),
+      UINT32_C(2813663423),
+      UINT8_C(  0) },
+    { UINT32_C(4294967295),
+      UINT32_C( 870376182),
+      UINT8_C(  0) },
+    { UINT32_C( 836476725),
+      UINT32_C(3458490570),
+      UINT8_C(  1) },
+    { UINT32_C(3139340661),
+      UINT32_C(2181433652),
+      UINT8_C(  0) },
+    { UINT32_C( 169512230),
+      UINT32_C(2288683686),
+      UINT8_C(  0) },
+    { UINT32_C( 359284742),
+      UINT32_C(1195587110),
+      UINT8_C(  0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned char r = simde_ktestz_mask32_u8(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_u8(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_ktestc_mask32_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 a;
+    const simde__mmask32 b;
+    const unsigned char r;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT32_C(         0),
+      UINT8_C(  1) },
+    { UINT32_C( 675549657),
+      UINT32_C(3619417638),
+      UINT8_C(  0) },
+    { UINT32_C(2813663423),
+      UINT32_C(2813663423),
+      UINT8_C(  1) },
+    { UINT32_C(4294967295),
+      UINT32_C( 870376182),
+      UINT8_C(  1) },
+    { UINT32_C( 836476725),
+      UINT32_C(3458490570),
+      UINT8_C(  0) },
+    { UINT32_C(3139340661),
+      UINT32_C(2181433652),
+      UINT8_C(  1) },
+    { UINT32_C( 169512230),
+      UINT32_C(2288683686),
+      UINT8_C(  0) },
+    { UINT32_C( 359284742),
+      UINT32_C(1195587110),
+      UINT8_C(  0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned char r = simde_ktestc_mask32_u8(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_u8(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_ktest_mask32_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 a;
+    const simde__mmask32 b;
+    const unsigned char r;
+    const unsigned char and_not;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT32_C(         0),
+      UINT8_C(  1),
+      UINT8_C(  1) },
+    { UINT32_C( 675549657),
+      UINT32_C(3619417638),
+      UINT8_C(  1),
+      UINT8_C(  0) },
+    { UINT32_C(2813663423),
+      UINT32_C(2813663423),
+      UINT8_C(  0),
+      UINT8_C(  1) },
+    { UINT32_C(4294967295),
+      UINT32_C( 870376182),
+      UINT8_C(  0),
+      UINT8_C(  1) },
+    { UINT32_C( 836476725),
+      UINT32_C(3458490570),
+      UINT8_C(  1),
+      UINT8_C(  0) },
+    { UINT32_C(3139340661),
+      UINT32_C(2181433652),
+      UINT8_C(  0),
+      UINT8_C(  1) },
+    { UINT32_C( 169512230),
+      UINT32_C(2288683686),
+      UINT8_C(  0),
+      UINT8_C(  0) },
+    { UINT32_C( 359284742),
+      UINT32_C(1195587110),
+      UINT8_C(  0),
+      UINT8_C(  0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned char and_not;
+    unsigned char r = simde_ktest_mask32_u8(test_vec[i].a, test_vec[i].b, &and_not);
+    simde_assert_equal_u8(r, test_vec[i].r);
+    simde_assert_equal_u8(and_not, test_vec[i].and_not);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_ktestz_mask64_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 a;
+    const simde__mmask64 b;
+    const unsigned char r;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      UINT64_C(                   0),
+      UINT8_C(  1) },
+    { UINT64_C(13040916433295358795),
+      UINT64_C( 5405827640414192820),
+      UINT8_C(  1) },
+    { UINT64_C(10161316727435302844),
+      UINT64_C(10161316727435302844),
+      UINT8_C(  0) },
+    { UINT64_C(18446744073709551615),
+      UINT64_C(15572588131863902504),
+      UINT8_C(  0) },
+    { UINT64_C( 2920228804894446156),
+      UINT64_C(15526515268815105459),
+      UINT8_C(  1) },
+    { UINT64_C( 3598919189153828141),
+      UINT64_C( 1189236471007133953),
+      UINT8_C(  0) },
+    { UINT64_C( 9110375783056737914),
+      UINT64_C(  411419432829867810),
+      UINT8_C(  0) },
+    { UINT64_C(16312038876848474686),
+      UINT64_C(13045244987516167801),
+      UINT8_C(  0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned char r = simde_ktestz_mask64_u8(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_u8(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_ktestc_mask64_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 a;
+    const simde__mmask64 b;
+    const unsigned char r;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      UINT64_C(                   0),
+      UINT8_C(  1) },
+    { UINT64_C(13040916433295358795),
+      UINT64_C( 5405827640414192820),
+      UINT8_C(  0) },
+    { UINT64_C(10161316727435302844),
+      UINT64_C(10161316727435302844),
+      UINT8_C(  1) },
+    { UINT64_C(18446744073709551615),
+      UINT64_C(15572588131863902504),
+      UINT8_C(  1) },
+    { UINT64_C( 2920228804894446156),
+      UINT64_C(15526515268815105459),
+      UINT8_C(  0) },
+    { UINT64_C( 3598919189153828141),
+      UINT64_C( 1189236471007133953),
+      UINT8_C(  1) },
+    { UINT64_C( 9110375783056737914),
+      UINT64_C(  411419432829867810),
+      UINT8_C(  0) },
+    { UINT64_C(16312038876848474686),
+      UINT64_C(13045244987516167801),
+      UINT8_C(  0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned char r = simde_ktestc_mask64_u8(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_u8(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_ktest_mask64_u8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 a;
+    const simde__mmask64 b;
+    const unsigned char r;
+    const unsigned char and_not;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      UINT64_C(                   0),
+      UINT8_C(  1),
+      UINT8_C(  1) },
+    { UINT64_C(13040916433295358795),
+      UINT64_C( 5405827640414192820),
+      UINT8_C(  1),
+      UINT8_C(  0) },
+    { UINT64_C(10161316727435302844),
+      UINT64_C(10161316727435302844),
+      UINT8_C(  0),
+      UINT8_C(  1) },
+    { UINT64_C(18446744073709551615),
+      UINT64_C(15572588131863902504),
+      UINT8_C(  0),
+      UINT8_C(  1) },
+    { UINT64_C( 2920228804894446156),
+      UINT64_C(15526515268815105459),
+      UINT8_C(  1),
+      UINT8_C(  0) },
+    { UINT64_C( 3598919189153828141),
+      UINT64_C( 1189236471007133953),
+      UINT8_C(  0),
+      UINT8_C(  1) },
+    { UINT64_C( 9110375783056737914),
+      UINT64_C(  411419432829867810),
+      UINT8_C(  0),
+      UINT8_C(  0) },
+    { UINT64_C(16312038876848474686),
+      UINT64_C(13045244987516167801),
+      UINT8_C(  0),
+      UINT8_C(  0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    unsigned char and_not;
+    unsigned char r = simde_ktest_mask64_u8(test_vec[i].a, test_vec[i].b, &and_not);
+    simde_assert_equal_u8(r, test_vec[i].r);
+    simde_assert_equal_u8(and_not, test_vec[i].and_not);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(ktestz_mask8_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(ktestc_mask8_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(ktest_mask8_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(ktestz_mask16_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(ktestc_mask16_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(ktest_mask16_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(ktestz_mask32_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(ktestc_mask32_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(ktest_mask32_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(ktestz_mask64_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(ktestc_mask64_u8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(ktest_mask64_u8)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,161 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN kunpack
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/kunpack.h>
+
+static int
+test_simde_mm512_kunpackb (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+    const simde__mmask16 b;
+    const simde__mmask16 r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      UINT16_C(16639),
+      UINT16_C(  255) },
+    { UINT16_C(65535),
+      UINT16_C(45054),
+      UINT16_C(65534) },
+    { UINT16_C(27501),
+      UINT16_C(57071),
+      UINT16_C(28143) },
+    { UINT16_C( 7736),
+      UINT16_C(21515),
+      UINT16_C(14347) },
+    { UINT16_C(27490),
+      UINT16_C(39083),
+      UINT16_C(25259) },
+    { UINT16_C(31709),
+      UINT16_C(24581),
+      UINT16_C(56581) },
+    { UINT16_C(60834),
+      UINT16_C(15558),
+      UINT16_C(41670) },
+    { UINT16_C(39908),
+      UINT16_C(13201),
+      UINT16_C(58513) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask16 r = simde_mm512_kunpackb(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask16(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_kunpackw (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 a;
+    const simde__mmask32 b;
+    const simde__mmask32 r;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT32_C(1308754965),
+      UINT32_C(      1045) },
+    { UINT32_C(4294967295),
+      UINT32_C( 685275244),
+      UINT32_C(4294932588) },
+    { UINT32_C( 956436451),
+      UINT32_C(2845758077),
+      UINT32_C( 266588797) },
+    { UINT32_C( 783463594),
+      UINT32_C( 743641973),
+      UINT32_C(3031044981) },
+    { UINT32_C(1662841578),
+      UINT32_C(3172767285),
+      UINT32_C(4075460149) },
+    { UINT32_C(4097666919),
+      UINT32_C(1516376388),
+      UINT32_C(1869025604) },
+    { UINT32_C(4159512741),
+      UINT32_C( 314246931),
+      UINT32_C( 547686163) },
+    { UINT32_C( 636580243),
+      UINT32_C( 118707633),
+      UINT32_C(1905481137) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask32 r = simde_mm512_kunpackw(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_kunpackd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 a;
+    const simde__mmask64 b;
+    const simde__mmask64 r;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      UINT64_C( 3762928615819922576),
+      UINT64_C(          2769898640) },
+    { UINT64_C(18446744073709551615),
+      UINT64_C( 2659357342516715172),
+      UINT64_C(18446744072695127716) },
+    { UINT64_C(18343426040924238908),
+      UINT64_C(14818841865539732194),
+      UINT64_C(17073273991666254562) },
+    { UINT64_C( 7613186150309524685),
+      UINT64_C(12911901285468413008),
+      UINT64_C(11682184382629616720) },
+    { UINT64_C(17293931752600371234),
+      UINT64_C(15200004176429866125),
+      UINT64_C( 4870643147065941133) },
+    { UINT64_C( 5333471876479387477),
+      UINT64_C( 7893396204398511667),
+      UINT64_C(16795901400756717107) },
+    { UINT64_C(12832401304437260011),
+      UINT64_C( 5999096553022869033),
+      UINT64_C( 6214403349470694953) },
+    { UINT64_C(17532776887636241381),
+      UINT64_C( 3614433869998028329),
+      UINT64_C(14536682698981733929) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask64 r = simde_mm512_kunpackd(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_kunpackb)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_kunpackw)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_kunpackd)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
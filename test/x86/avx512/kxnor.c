@@ -0,0 +1,245 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN kxnor
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/kxnor.h>
+
+static int
+test_simde_kxnor_mask8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 a;
+    const simde__mmask8 b;
+    const simde__mmask8 r;
+  } test_vec[] = {
+    { UINT8_C(  0),
+      UINT8_C(120),
+      UINT8_C(135) },
+    { UINT8_C(255),
+      UINT8_C( 53),
+      UINT8_C( 53) },
+    { UINT8_C(150),
+      UINT8_C(150),
+      UINT8_C(255) },
+    { UINT8_C(128),
+      UINT8_C( 34),
+      UINT8_C( 93) },
+    { UINT8_C(125),
+      UINT8_C(141),
+      UINT8_C( 15) },
+    { UINT8_C( 20),
+      UINT8_C(195),
+      UINT8_C( 40) },
+    { UINT8_C(161),
+      UINT8_C(253),
+      UINT8_C(163) },
+    { UINT8_C(171),
+      UINT8_C( 27),
+      UINT8_C( 79) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask8 r = simde_kxnor_mask8(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask8(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kxnor_mask16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+    const simde__mmask16 b;
+    const simde__mmask16 r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      UINT16_C(47446),
+      UINT16_C(18089) },
+    { UINT16_C(65535),
+      UINT16_C(43268),
+      UINT16_C(43268) },
+    { UINT16_C(20530),
+      UINT16_C(20530),
+      UINT16_C(65535) },
+    { UINT16_C(30301),
+      UINT16_C( 5275),
+      UINT16_C(40249) },
+    { UINT16_C(52842),
+      UINT16_C(32537),
+      UINT16_C(20108) },
+    { UINT16_C(47702),
+      UINT16_C(49488),
+      UINT16_C(34041) },
+    { UINT16_C( 3437),
+      UINT16_C(33643),
+      UINT16_C(29177) },
+    { UINT16_C(21943),
+      UINT16_C(34841),
+      UINT16_C( 8785) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask16 r = simde_kxnor_mask16(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask16(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kxnor_mask32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 a;
+    const simde__mmask32 b;
+    const simde__mmask32 r;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT32_C( 736443423),
+      UINT32_C(3558523872) },
+    { UINT32_C(4294967295),
+      UINT32_C( 428782831),
+      UINT32_C( 428782831) },
+    { UINT32_C(3053522048),
+      UINT32_C(3053522048),
+      UINT32_C(4294967295) },
+    { UINT32_C(1728260619),
+      UINT32_C(1216052810),
+      UINT32_C(3498552254) },
+    { UINT32_C(1680085316),
+      UINT32_C( 278226802),
+      UINT32_C(2337180105) },
+    { UINT32_C( 957636635),
+      UINT32_C( 819660487),
+      UINT32_C(4130380067) },
+    { UINT32_C(1950417375),
+      UINT32_C( 901401107),
+      UINT32_C(3187979315) },
+    { UINT32_C(3085374785),
+      UINT32_C(  56159347),
+      UINT32_C(1262487245) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask32 r = simde_kxnor_mask32(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kxnor_mask64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 a;
+    const simde__mmask64 b;
+    const simde__mmask64 r;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      UINT64_C(    3895903120013603),
+      UINT64_C(18442848170589538012) },
+    { UINT64_C(18446744073709551615),
+      UINT64_C( 6145656910818162217),
+      UINT64_C( 6145656910818162217) },
+    { UINT64_C(11193896376757545227),
+      UINT64_C(11193896376757545227),
+      UINT64_C(18446744073709551615) },
+    { UINT64_C( 4967456683987291603),
+      UINT64_C(11809860878923232220),
+      UINT64_C( 1798345357458686448) },
+    { UINT64_C( 7124785827114024676),
+      UINT64_C( 1063631001223385288),
+      UINT64_C(10654790814563226067) },
+    { UINT64_C(12287887024873401133),
+      UINT64_C( 9878863648960602803),
+      UINT64_C(15879800034734831201) },
+    { UINT64_C(17560131009945251621),
+      UINT64_C( 3815715110693561238),
+      UINT64_C( 4087515081890247500) },
+    { UINT64_C(14552073856483084042),
+      UINT64_C(11585149095990219923),
+      UINT64_C(10865517210076245094) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask64 r = simde_kxnor_mask64(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_kxnor (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+    const simde__mmask16 b;
+    const simde__mmask16 r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      UINT16_C(55973),
+      UINT16_C( 9562) },
+    { UINT16_C(65535),
+      UINT16_C(35330),
+      UINT16_C(35330) },
+    { UINT16_C(43437),
+      UINT16_C(54178),
+      UINT16_C(34288) },
+    { UINT16_C(41843),
+      UINT16_C(47499),
+      UINT16_C(58631) },
+    { UINT16_C(48651),
+      UINT16_C(61846),
+      UINT16_C(45154) },
+    { UINT16_C(59998),
+      UINT16_C(17545),
+      UINT16_C(20776) },
+    { UINT16_C(33669),
+      UINT16_C( 1850),
+      UINT16_C(31552) },
+    { UINT16_C(40317),
+      UINT16_C(40146),
+      UINT16_C(65104) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask16 r = simde_mm512_kxnor(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask16(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(kxnor_mask8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kxnor_mask16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kxnor_mask32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kxnor_mask64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_kxnor)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,245 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN kxor
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/kxor.h>
+
+static int
+test_simde_kxor_mask8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 a;
+    const simde__mmask8 b;
+    const simde__mmask8 r;
+  } test_vec[] = {
+    { UINT8_C(  0),
+      UINT8_C(204),
+      UINT8_C(204) },
+    { UINT8_C(255),
+      UINT8_C(205),
+      UINT8_C( 50) },
+    { UINT8_C(130),
+      UINT8_C(130),
+      UINT8_C(  0) },
+    { UINT8_C( 55),
+      UINT8_C(120),
+      UINT8_C( 79) },
+    { UINT8_C(148),
+      UINT8_C(123),
+      UINT8_C(239) },
+    { UINT8_C( 89),
+      UINT8_C( 34),
+      UINT8_C(123) },
+    { UINT8_C(182),
+      UINT8_C(117),
+      UINT8_C(195) },
+    { UINT8_C(191),
+      UINT8_C(183),
+      UINT8_C(  8) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask8 r = simde_kxor_mask8(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask8(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kxor_mask16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+    const simde__mmask16 b;
+    const simde__mmask16 r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      UINT16_C(59406),
+      UINT16_C(59406) },
+    { UINT16_C(65535),
+      UINT16_C(11322),
+      UINT16_C(54213) },
+    { UINT16_C( 7128),
+      UINT16_C( 7128),
+      UINT16_C(    0) },
+    { UINT16_C( 1472),
+      UINT16_C( 6024),
+      UINT16_C( 4680) },
+    { UINT16_C(61032),
+      UINT16_C(24498),
+      UINT16_C(45530) },
+    { UINT16_C(47869),
+      UINT16_C(18793),
+      UINT16_C(62356) },
+    { UINT16_C(65367),
+      UINT16_C(42824),
+      UINT16_C(22559) },
+    { UINT16_C(53335),
+      UINT16_C(42138),
+      UINT16_C(29901) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask16 r = simde_kxor_mask16(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask16(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kxor_mask32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 a;
+    const simde__mmask32 b;
+    const simde__mmask32 r;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT32_C(4094672182),
+      UINT32_C(4094672182) },
+    { UINT32_C(4294967295),
+      UINT32_C( 417033683),
+      UINT32_C(3877933612) },
+    { UINT32_C( 667204437),
+      UINT32_C( 667204437),
+      UINT32_C(         0) },
+    { UINT32_C( 798198755),
+      UINT32_C(3993029348),
+      UINT32_C(3247653127) },
+    { UINT32_C(2632433549),
+      UINT32_C(2958540614),
+      UINT32_C( 749732043) },
+    { UINT32_C(3255399272),
+      UINT32_C(2966226170),
+      UINT32_C(1925478290) },
+    { UINT32_C( 504823141),
+      UINT32_C(3095562074),
+      UINT32_C(2794748479) },
+    { UINT32_C(4072293557),
+      UINT32_C(3269396939),
+      UINT32_C( 811945342) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask32 r = simde_kxor_mask32(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_kxor_mask64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 a;
+    const simde__mmask64 b;
+    const simde__mmask64 r;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      UINT64_C( 6355982090698748050),
+      UINT64_C( 6355982090698748050) },
+    { UINT64_C(18446744073709551615),
+      UINT64_C(10463408046173111441),
+      UINT64_C( 7983336027536440174) },
+    { UINT64_C( 1674125266843072052),
+      UINT64_C( 1674125266843072052),
+      UINT64_C(                   0) },
+    { UINT64_C( 8514591266762118636),
+      UINT64_C(16296462684351415373),
+      UINT64_C(10664891004220543393) },
+    { UINT64_C(10590791539873291558),
+      UINT64_C( 2814098766675382196),
+      UINT64_C(13112128198732223122) },
+    { UINT64_C(13387290000851939437),
+      UINT64_C( 2911222252117219686),
+      UINT64_C(10497759225579825419) },
+    { UINT64_C( 3784392354653348916),
+      UINT64_C(  786279978204446069),
+      UINT64_C( 4498446983814551873) },
+    { UINT64_C( 6536293654778857393),
+      UINT64_C(12582813976456132169),
+      UINT64_C(17594075932531307000) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask64 r = simde_kxor_mask64(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_kxor (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 a;
+    const simde__mmask16 b;
+    const simde__mmask16 r;
+  } test_vec[] = {
+    { UINT16_C(    0),
+      UINT16_C(56680),
+      UINT16_C(56680) },
+    { UINT16_C(65535),
+      UINT16_C(26414),
+      UINT16_C(39121) },
+    { UINT16_C(26868),
+      UINT16_C(16975),
+      UINT16_C(10939) },
+    { UINT16_C( 8047),
+      UINT16_C(40036),
+      UINT16_C(33547) },
+    { UINT16_C(25116),
+      UINT16_C(39007),
+      UINT16_C(64067) },
+    { UINT16_C(12682),
+      UINT16_C(23176),
+      UINT16_C(27394) },
+    { UINT16_C(48691),
+      UINT16_C(28909),
+      UINT16_C(52958) },
+    { UINT16_C(24526),
+      UINT16_C(28379),
+      UINT16_C(12565) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__mmask16 r = simde_mm512_kxor(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_mmask16(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(kxor_mask8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kxor_mask16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kxor_mask32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(kxor_mask64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_kxor)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -155,10 +155,772 @@ test_simde_mm_maskz_lzcnt_epi32 (SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm_lzcnt_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { {  INT64_C(            66846561),  INT64_C(         10523541910) },
+      {  INT64_C(                  38),  INT64_C(                  30) } },
+    { {  INT64_C(                   0),  INT64_C(           199903882) },
+      {  INT64_C(                  64),  INT64_C(                  36) } },
+    { {  INT64_C(             2848319),  INT64_C(   14358713740866465) },
+      {  INT64_C(                  42),  INT64_C(                  10) } },
+    { {  INT64_C(                   0),  INT64_C(          1992456470) },
+      {  INT64_C(                  64),  INT64_C(                  33) } },
+    { {  INT64_C(                  30),  INT64_C(             1804887) },
+      {  INT64_C(                  59),  INT64_C(                  43) } },
+    { {  INT64_C(            21817282),  INT64_C(           428102704) },
+      {  INT64_C(                  39),  INT64_C(                  35) } },
+    { {  INT64_C(    1152092529715255),  INT64_C(    8380861864641185) },
+      {  INT64_C(                  13),  INT64_C(                  11) } },
+    { {  INT64_C(      97311058915794),  INT64_C(   59560336870704418) },
+      {  INT64_C(                  17),  INT64_C(                   8) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i r = simde_mm_lzcnt_epi64(a);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_lzcnt_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[2];
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { { -INT64_C( 2280417564944841254), -INT64_C( 2183640912439285591) },
+      UINT8_C(  1),
+      {  INT64_C(                   0),  INT64_C(    2622935697813834) },
+      {  INT64_C(                  64), -INT64_C( 2183640912439285591) } },
+    { { -INT64_C( 2373626742699541129), -INT64_C( 2960001849488474032) },
+      UINT8_C(  0),
+      {  INT64_C(            18996115),  INT64_C(                  16) },
+      { -INT64_C( 2373626742699541129), -INT64_C( 2960001849488474032) } },
+    { {  INT64_C( 1554519448343789648), -INT64_C( 4852268742783599359) },
+      UINT8_C(  3),
+      {  INT64_C(               27503),  INT64_C(         34256917187) },
+      {  INT64_C(                  49),  INT64_C(                  29) } },
+    { {  INT64_C( 8861225474718120400),  INT64_C( 9108075428737804254) },
+      UINT8_C(  2),
+      {  INT64_C(  221801759168752337),  INT64_C(                   2) },
+      {  INT64_C( 8861225474718120400),  INT64_C(                  62) } },
+    { {  INT64_C(  787538871668121387), -INT64_C( 1771651879932318756) },
+      UINT8_C(  1),
+      { -INT64_C( 6753510001790233818),  INT64_C(                   0) },
+      {  INT64_C(                   0), -INT64_C( 1771651879932318756) } },
+    { { -INT64_C( 2726125772044365605), -INT64_C( 6500305751194912505) },
+      UINT8_C(  0),
+      {  INT64_C(        290862616912),  INT64_C(      47938331084084) },
+      { -INT64_C( 2726125772044365605), -INT64_C( 6500305751194912505) } },
+    { {  INT64_C( 3443731778671433509), -INT64_C( 2718832951091668337) },
+      UINT8_C(  0),
+      {  INT64_C(       1853911589085),  INT64_C(            36515980) },
+      {  INT64_C( 3443731778671433509), -INT64_C( 2718832951091668337) } },
+    { {  INT64_C( 2242532045491389538),  INT64_C( 8893446170746987307) },
+      UINT8_C(  3),
+      {  INT64_C(         69024208272),  INT64_C(               47053) },
+      {  INT64_C(                  27),  INT64_C(                  48) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi64(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_lzcnt_epi64(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_lzcnt_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      {  INT64_C(             5328214),  INT64_C(    3597200635056198) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  2),
+      {  INT64_C(     465500106031369),  INT64_C( 4259797564918607936) },
+      {  INT64_C(                   0),  INT64_C(                   2) } },
+    { UINT8_C(  1),
+      {  INT64_C(      91869361953863),  INT64_C(     201097530224660) },
+      {  INT64_C(                  17),  INT64_C(                   0) } },
+    { UINT8_C(  2),
+      {  INT64_C(       3361657951090),  INT64_C(                 805) },
+      {  INT64_C(                   0),  INT64_C(                  54) } },
+    { UINT8_C(  3),
+      {  INT64_C(                2956),  INT64_C(                3137) },
+      {  INT64_C(                  52),  INT64_C(                  52) } },
+    { UINT8_C(  0),
+      {  INT64_C(         18838767136),  INT64_C(       4151785467971) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  0),
+      {  INT64_C(            42940172),  INT64_C(          6011539074) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  1),
+      {  INT64_C(                   0),  INT64_C(               74489) },
+      {  INT64_C(                  64),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_lzcnt_epi64(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_lzcnt_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { { -INT32_C(   211227209),  INT32_C(  1132417413),  INT32_C(   405355941), -INT32_C(   688204432), -INT32_C(  1240322323), -INT32_C(  1355574410),  INT32_C(   957826036),  INT32_C(  1962878868) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           3),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           2),  INT32_C(           1) } },
+    { {  INT32_C(  1719465817), -INT32_C(    27872615), -INT32_C(   391944851),  INT32_C(   700198459),  INT32_C(  1602058125),  INT32_C(           0),  INT32_C(   937794204),  INT32_C(           0) },
+      {  INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           2),  INT32_C(           1),  INT32_C(          32),  INT32_C(           2),  INT32_C(          32) } },
+    { {  INT32_C(  1412376106), -INT32_C(  1384143237),  INT32_C(  1948764660),  INT32_C(   134251055), -INT32_C(  1103687020),  INT32_C(           0),  INT32_C(  2041112635), -INT32_C(  1430933646) },
+      {  INT32_C(           1),  INT32_C(           0),  INT32_C(           1),  INT32_C(           4),  INT32_C(           0),  INT32_C(          32),  INT32_C(           1),  INT32_C(           0) } },
+    { {  INT32_C(           0),  INT32_C(  1588779956),  INT32_C(   740146622),  INT32_C(           0),  INT32_C(   493808748), -INT32_C(   932372772),  INT32_C(  1151557173), -INT32_C(  1852262473) },
+      {  INT32_C(          32),  INT32_C(           1),  INT32_C(           2),  INT32_C(          32),  INT32_C(           3),  INT32_C(           0),  INT32_C(           1),  INT32_C(           0) } },
+    { { -INT32_C(   228812751),  INT32_C(  1305942096),  INT32_C(           0),  INT32_C(  2008047538),  INT32_C(  1245913855), -INT32_C(  1936239427),  INT32_C(   702895268),  INT32_C(  1243020344) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(          32),  INT32_C(           1),  INT32_C(           1),  INT32_C(           0),  INT32_C(           2),  INT32_C(           1) } },
+    { {  INT32_C(  1732576979), -INT32_C(   302478949),  INT32_C(   347057335),  INT32_C(  1161828574),  INT32_C(           0), -INT32_C(  1210790690), -INT32_C(   423912014),  INT32_C(           0) },
+      {  INT32_C(           1),  INT32_C(           0),  INT32_C(           3),  INT32_C(           1),  INT32_C(          32),  INT32_C(           0),  INT32_C(           0),  INT32_C(          32) } },
+    { {  INT32_C(  1644910418),  INT32_C(           0),  INT32_C(   787732959), -INT32_C(   695637794),  INT32_C(   537542028),  INT32_C(   751110330),  INT32_C(  1351878078),  INT32_C(  2075784306) },
+      {  INT32_C(           1),  INT32_C(          32),  INT32_C(           2),  INT32_C(           0),  INT32_C(           2),  INT32_C(           2),  INT32_C(           1),  INT32_C(           1) } },
+    { {  INT32_C(           0),  INT32_C(  2100920400),  INT32_C(           0),  INT32_C(  2071113942), -INT32_C(  1332185202),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1650986703) },
+      {  INT32_C(          32),  INT32_C(           1),  INT32_C(          32),  INT32_C(           1),  INT32_C(           0),  INT32_C(          32),  INT32_C(          32),  INT32_C(           1) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i r = simde_mm256_lzcnt_epi32(a);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_lzcnt_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { {  INT32_C(  1999332804),  INT32_C(  1455550691), -INT32_C(  1886728824),  INT32_C(   107145632), -INT32_C(  1471776734), -INT32_C(  1459019997), -INT32_C(  1088589378),  INT32_C(   979130432) },
+      UINT8_C(139),
+      {  INT32_C(   924450566),  INT32_C(           0), -INT32_C(  1970501342), -INT32_C(   808924920),  INT32_C(   852459992),  INT32_C(           0), -INT32_C(  1891807442),  INT32_C(  1828665111) },
+      {  INT32_C(           2),  INT32_C(          32), -INT32_C(  1886728824),  INT32_C(           0), -INT32_C(  1471776734), -INT32_C(  1459019997), -INT32_C(  1088589378),  INT32_C(           1) } },
+    { {  INT32_C(   233446141), -INT32_C(  1200878951), -INT32_C(  1882164553),  INT32_C(  1638945912),  INT32_C(  1538047859), -INT32_C(   742852301), -INT32_C(  1963258964), -INT32_C(  2096276193) },
+      UINT8_C(119),
+      {  INT32_C(  1456344442), -INT32_C(  1745473803),  INT32_C(  1072924233), -INT32_C(  1215784000), -INT32_C(  2081749404), -INT32_C(  1795625875), -INT32_C(   951476853), -INT32_C(   143482481) },
+      {  INT32_C(           1),  INT32_C(           0),  INT32_C(           2),  INT32_C(  1638945912),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  2096276193) } },
+    { { -INT32_C(   113304735),  INT32_C(   729673852), -INT32_C(  1984030075),  INT32_C(  1451342964),  INT32_C(  1320648664), -INT32_C(  1080677886),  INT32_C(  1386971158),  INT32_C(    54786144) },
+      UINT8_C(  9),
+      { -INT32_C(   472985952), -INT32_C(   931389049),  INT32_C(   753739447), -INT32_C(  1180783219),  INT32_C(           0), -INT32_C(  1073864301), -INT32_C(  1112603004),  INT32_C(  1886291821) },
+      {  INT32_C(           0),  INT32_C(   729673852), -INT32_C(  1984030075),  INT32_C(           0),  INT32_C(  1320648664), -INT32_C(  1080677886),  INT32_C(  1386971158),  INT32_C(    54786144) } },
+    { { -INT32_C(   578824704),  INT32_C(  1686488604),  INT32_C(   710052264), -INT32_C(   545310296),  INT32_C(   977184730),  INT32_C(  1022310298), -INT32_C(  1255850094), -INT32_C(  1068629902) },
+      UINT8_C(  8),
+      { -INT32_C(  1033857507),  INT32_C(  2056902164),  INT32_C(   822135491),  INT32_C(   729018109), -INT32_C(  1922410959),  INT32_C(   537505203), -INT32_C(    88089087),  INT32_C(  1231086164) },
+      { -INT32_C(   578824704),  INT32_C(  1686488604),  INT32_C(   710052264),  INT32_C(           2),  INT32_C(   977184730),  INT32_C(  1022310298), -INT32_C(  1255850094), -INT32_C(  1068629902) } },
+    { { -INT32_C(   864917273), -INT32_C(  1385442599),  INT32_C(  1553974874),  INT32_C(   643319360),  INT32_C(   932104138),  INT32_C(    32915089),  INT32_C(  1136310647),  INT32_C(  1733926577) },
+      UINT8_C(125),
+      { -INT32_C(   929240453), -INT32_C(  1570820638), -INT32_C(  2066518390), -INT32_C(  1860329414),  INT32_C(  1608983555), -INT32_C(    76956390),  INT32_C(  1028864477),  INT32_C(           0) },
+      {  INT32_C(           0), -INT32_C(  1385442599),  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           2),  INT32_C(  1733926577) } },
+    { { -INT32_C(  1314596872),  INT32_C(   572144754),  INT32_C(  1616035228), -INT32_C(  1870561890),  INT32_C(   353231497), -INT32_C(   305766737),  INT32_C(   740086144), -INT32_C(   277356028) },
+      UINT8_C(141),
+      { -INT32_C(  1534715034),  INT32_C(   564785780), -INT32_C(  2006750061), -INT32_C(    87248494),  INT32_C(   825284547), -INT32_C(   283992549),  INT32_C(           0), -INT32_C(  1904214154) },
+      {  INT32_C(           0),  INT32_C(   572144754),  INT32_C(           0),  INT32_C(           0),  INT32_C(   353231497), -INT32_C(   305766737),  INT32_C(   740086144),  INT32_C(           0) } },
+    { { -INT32_C(   441578305),  INT32_C(   576626124),  INT32_C(   630215262), -INT32_C(  1474682211), -INT32_C(   725391557),  INT32_C(  1450213727),  INT32_C(  1709095358),  INT32_C(  1162053273) },
+      UINT8_C(222),
+      {  INT32_C(  1216568318), -INT32_C(  1033002452), -INT32_C(   425737068), -INT32_C(   370477066), -INT32_C(   601948773), -INT32_C(   776995076),  INT32_C(           0), -INT32_C(  1419424877) },
+      { -INT32_C(   441578305),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1450213727),  INT32_C(          32),  INT32_C(           0) } },
+    { { -INT32_C(   678923760),  INT32_C(   835772824),  INT32_C(  1140649257),  INT32_C(  1491296065), -INT32_C(   106786916), -INT32_C(  2051666894), -INT32_C(    75806272), -INT32_C(   896038288) },
+      UINT8_C( 64),
+      { -INT32_C(  2012903926), -INT32_C(  2020630524), -INT32_C(   956342193),  INT32_C(   744013193), -INT32_C(  1974436713),  INT32_C(   400352682), -INT32_C(  2101883609),  INT32_C(  1279135443) },
+      { -INT32_C(   678923760),  INT32_C(   835772824),  INT32_C(  1140649257),  INT32_C(  1491296065), -INT32_C(   106786916), -INT32_C(  2051666894),  INT32_C(           0), -INT32_C(   896038288) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_lzcnt_epi32(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_lzcnt_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { UINT8_C(167),
+      {  INT32_C(  2130019117),  INT32_C(   474820893), -INT32_C(  2046215812), -INT32_C(   854660779),  INT32_C(           0), -INT32_C(   466803909),  INT32_C(           0),  INT32_C(  2075234964) },
+      {  INT32_C(           1),  INT32_C(           3),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           1) } },
+    { UINT8_C(131),
+      { -INT32_C(  1604994300),  INT32_C(   345171516),  INT32_C(           0),  INT32_C(  1363734685),  INT32_C(    41081173),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           3),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(          32) } },
+    { UINT8_C(220),
+      { -INT32_C(   599736109), -INT32_C(  2101654403), -INT32_C(  1068969227),  INT32_C(  1575024522),  INT32_C(   858265526),  INT32_C(           0), -INT32_C(   298717487), -INT32_C(   523299461) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           2),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(170),
+      {  INT32_C(  1603466663), -INT32_C(  1741490863),  INT32_C(  2126480610), -INT32_C(  1463953203),  INT32_C(  1763512526), -INT32_C(  1275531516), -INT32_C(   163522802),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(          32) } },
+    { UINT8_C(  4),
+      {  INT32_C(  1069469859),  INT32_C(  1124751241),  INT32_C(  1297753383), -INT32_C(   684209620),  INT32_C(           0),  INT32_C(  1981540124),  INT32_C(  1839952653), -INT32_C(   580816090) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C(246),
+      { -INT32_C(  1487464118), -INT32_C(  1067443658),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1351772679), -INT32_C(   925725456),  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(          32),  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(          32),  INT32_C(          32) } },
+    { UINT8_C(194),
+      {  INT32_C(  1314874482),  INT32_C(   880415728),  INT32_C(  1092197827), -INT32_C(   458772907), -INT32_C(  1755750605),  INT32_C(  1938224909),  INT32_C(  1698110163), -INT32_C(   573913766) },
+      {  INT32_C(           0),  INT32_C(           2),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           0) } },
+    { UINT8_C(237),
+      { -INT32_C(  1656388250), -INT32_C(   860745571),  INT32_C(           0), -INT32_C(  1985688697), -INT32_C(  1240095300),  INT32_C(  2082165542), -INT32_C(  1551430441), -INT32_C(  1245023068) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(          32),  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_lzcnt_epi32(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_lzcnt_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { {  INT64_C(       8877910967979),  INT64_C( 8606393438084255485),  INT64_C(            47047266),  INT64_C(                   7) },
+      {  INT64_C(                  20),  INT64_C(                   1),  INT64_C(                  38),  INT64_C(                  61) } },
+    { {  INT64_C(                   0),  INT64_C(                  13),  INT64_C(                  62),  INT64_C(   26182620101671444) },
+      {  INT64_C(                  64),  INT64_C(                  60),  INT64_C(                  58),  INT64_C(                   9) } },
+    { {  INT64_C(                4828),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(               11403) },
+      {  INT64_C(                  51),  INT64_C(                  64),  INT64_C(                  64),  INT64_C(                  50) } },
+    { {  INT64_C(            46065371),  INT64_C(            82730317),  INT64_C(                   0),  INT64_C(  304234312909957527) },
+      {  INT64_C(                  38),  INT64_C(                  37),  INT64_C(                  64),  INT64_C(                   5) } },
+    { {  INT64_C(      17445178031295),  INT64_C(  115353247809428707),  INT64_C(           949688700),  INT64_C(    2462528674847345) },
+      {  INT64_C(                  20),  INT64_C(                   7),  INT64_C(                  34),  INT64_C(                  12) } },
+    { {  INT64_C(            19788993),  INT64_C(      37804327294837),  INT64_C(            44015438),  INT64_C(              893198) },
+      {  INT64_C(                  39),  INT64_C(                  18),  INT64_C(                  38),  INT64_C(                  44) } },
+    { {  INT64_C(           396597071),  INT64_C(        349933539746),  INT64_C(        602316121442),  INT64_C(            14751124) },
+      {  INT64_C(                  35),  INT64_C(                  25),  INT64_C(                  24),  INT64_C(                  40) } },
+    { {  INT64_C(         65826803131),  INT64_C(               19035),  INT64_C(               77307),  INT64_C(         76029586209) },
+      {  INT64_C(                  28),  INT64_C(                  49),  INT64_C(                  47),  INT64_C(                  27) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i r = simde_mm256_lzcnt_epi64(a);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_lzcnt_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[4];
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { { -INT64_C( 8489096974627182130), -INT64_C( 3290868101743001965), -INT64_C( 1395618729544121623), -INT64_C( 9092598784842098349) },
+      UINT8_C(  1),
+      {  INT64_C(                 170),  INT64_C(                  22),  INT64_C(          6192873535),  INT64_C(                   0) },
+      {  INT64_C(                  56), -INT64_C( 3290868101743001965), -INT64_C( 1395618729544121623), -INT64_C( 9092598784842098349) } },
+    { {  INT64_C( 7804285866573250982),  INT64_C( 8478037962885098982), -INT64_C( 7231965651738773239),  INT64_C(  768292592438141830) },
+      UINT8_C( 10),
+      {  INT64_C(       1479599894413),  INT64_C(      53297048003450),  INT64_C( 7263038577530647785),  INT64_C(         64102251603) },
+      {  INT64_C( 7804285866573250982),  INT64_C(                  18), -INT64_C( 7231965651738773239),  INT64_C(                  28) } },
+    { {  INT64_C( 8782094611918321443), -INT64_C( 8243091645441870117),  INT64_C( 2318407394242776528),  INT64_C( 6982654761423875586) },
+      UINT8_C(  1),
+      {  INT64_C(     393993094560574),  INT64_C(      44213275519706),  INT64_C(         33024769004),  INT64_C(     854222754781396) },
+      {  INT64_C(                  15), -INT64_C( 8243091645441870117),  INT64_C( 2318407394242776528),  INT64_C( 6982654761423875586) } },
+    { { -INT64_C( 8938507976741580848), -INT64_C( 4924541503025193398),  INT64_C( 2857236534156335674), -INT64_C( 9122132719166758627) },
+      UINT8_C(  1),
+      {  INT64_C(             3642689),  INT64_C(          1071071570),  INT64_C(                  82),  INT64_C(        837279883490) },
+      {  INT64_C(                  42), -INT64_C( 4924541503025193398),  INT64_C( 2857236534156335674), -INT64_C( 9122132719166758627) } },
+    { {  INT64_C( 8497387647562060617), -INT64_C( 1816720714978897125),  INT64_C( 7070272622520676583), -INT64_C( 1907613721938540570) },
+      UINT8_C(  8),
+      {  INT64_C(               31023),  INT64_C(     251313776206276),  INT64_C(                   0),  INT64_C(                  93) },
+      {  INT64_C( 8497387647562060617), -INT64_C( 1816720714978897125),  INT64_C( 7070272622520676583),  INT64_C(                  57) } },
+    { {  INT64_C( 2862084840826953579),  INT64_C( 9183727346247092049), -INT64_C( 3854598831312984881),  INT64_C( 3800821936171916525) },
+      UINT8_C(  9),
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 8111028258758587238),  INT64_C(               86139) },
+      {  INT64_C(                  64),  INT64_C( 9183727346247092049), -INT64_C( 3854598831312984881),  INT64_C(                  47) } },
+    { { -INT64_C( 8491453126583666559),  INT64_C(  541234061297122049), -INT64_C( 1334839798282486919),  INT64_C( 5778813713695699418) },
+      UINT8_C(  4),
+      {  INT64_C(                  26),  INT64_C(              343436),  INT64_C(        857327225502),  INT64_C(         31957776136) },
+      { -INT64_C( 8491453126583666559),  INT64_C(  541234061297122049),  INT64_C(                  24),  INT64_C( 5778813713695699418) } },
+    { {  INT64_C( 5468136684589609851), -INT64_C( 3338187383393762679), -INT64_C( 7009497577561581078),  INT64_C(  720618118438488375) },
+      UINT8_C(  5),
+      {  INT64_C(        941756899422),  INT64_C(        175534456974),  INT64_C(            46536672),  INT64_C(                   0) },
+      {  INT64_C(                  24), -INT64_C( 3338187383393762679),  INT64_C(                  38),  INT64_C(  720618118438488375) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi64(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_lzcnt_epi64(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_lzcnt_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { UINT8_C( 10),
+      {  INT64_C(     200770470580400),  INT64_C( 1421381952818552694), -INT64_C(  394149440162932559),  INT64_C(           550957416) },
+      {  INT64_C(                   0),  INT64_C(                   3),  INT64_C(                   0),  INT64_C(                  34) } },
+    { UINT8_C(  7),
+      {  INT64_C(                  12),  INT64_C(             1169701),  INT64_C(                 611),  INT64_C(   29413511165868706) },
+      {  INT64_C(                  60),  INT64_C(                  43),  INT64_C(                  54),  INT64_C(                   0) } },
+    { UINT8_C( 10),
+      {  INT64_C(             2912472),  INT64_C(  796513628464547920),  INT64_C(                3498),  INT64_C(    1121317027257280) },
+      {  INT64_C(                   0),  INT64_C(                   4),  INT64_C(                   0),  INT64_C(                  14) } },
+    { UINT8_C(  9),
+      {  INT64_C(        140101034157),  INT64_C(   46939152399632483),  INT64_C(     142112126637274),  INT64_C(       6919107775837) },
+      {  INT64_C(                  26),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                  21) } },
+    { UINT8_C(  3),
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(           151000008),  INT64_C(             3080269) },
+      {  INT64_C(                  64),  INT64_C(                  64),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  7),
+      {  INT64_C(         33789522035),  INT64_C(               29322),  INT64_C( 2368686527937957678),  INT64_C(                 345) },
+      {  INT64_C(                  29),  INT64_C(                  49),  INT64_C(                   2),  INT64_C(                   0) } },
+    { UINT8_C(  8),
+      {  INT64_C(           200740216),  INT64_C(                   0),  INT64_C(        395843286873),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                  64) } },
+    { UINT8_C(  2),
+      {  INT64_C(            41146159),  INT64_C(               88578),  INT64_C(              337322),  INT64_C(  565548964715318804) },
+      {  INT64_C(                   0),  INT64_C(                  47),  INT64_C(                   0),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_lzcnt_epi64(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_lzcnt_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { {  INT32_C(  1157833671),  INT32_C(   350545695), -INT32_C(   712680328),  INT32_C(           0), -INT32_C(    16610778), -INT32_C(  1845006535),  INT32_C(  2041812764),  INT32_C(   179842497),
+        -INT32_C(     2740506), -INT32_C(  1084364871), -INT32_C(  1040177376),  INT32_C(  1941535043), -INT32_C(  1991473818),  INT32_C(   973650522), -INT32_C(  1567104500),  INT32_C(  1146019164) },
+      {  INT32_C(           1),  INT32_C(           3),  INT32_C(           0),  INT32_C(          32),  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           4),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           2),  INT32_C(           0),  INT32_C(           1) } },
+    { { -INT32_C(  1637603807),  INT32_C(    11849308), -INT32_C(  1204569124), -INT32_C(   281654399),  INT32_C(  1606290558),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1852015681),
+         INT32_C(  1810712723), -INT32_C(   171835194), -INT32_C(   950364931),  INT32_C(  1289210962),  INT32_C(           0), -INT32_C(  1537014196), -INT32_C(  1508736066),  INT32_C(  1280706786) },
+      {  INT32_C(           0),  INT32_C(           8),  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(          32),  INT32_C(          32),  INT32_C(           1),
+         INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(          32),  INT32_C(           0),  INT32_C(           0),  INT32_C(           1) } },
+    { { -INT32_C(  1248269034),  INT32_C(  1494954331), -INT32_C(  1351128976),  INT32_C(           0), -INT32_C(   330658786),  INT32_C(  1069694280),  INT32_C(   397318726),  INT32_C(  1768670870),
+        -INT32_C(  1241012996),  INT32_C(   391640405), -INT32_C(  1469535531), -INT32_C(  2016500028),  INT32_C(    66576817),  INT32_C(  1404303559), -INT32_C(   371650263), -INT32_C(    51827833) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(          32),  INT32_C(           0),  INT32_C(           2),  INT32_C(           3),  INT32_C(           1),
+         INT32_C(           0),  INT32_C(           3),  INT32_C(           0),  INT32_C(           0),  INT32_C(           6),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT32_C(   725860781),  INT32_C(           0), -INT32_C(  1886647014),  INT32_C(  1685825597),  INT32_C(  1962496296),  INT32_C(  2065127337), -INT32_C(  1877228294),  INT32_C(  1042512847),
+         INT32_C(           0),  INT32_C(   174155106),  INT32_C(  1943377428),  INT32_C(   120077215),  INT32_C(  1098549373),  INT32_C(  1139275361), -INT32_C(  2028456639), -INT32_C(   471294425) },
+      {  INT32_C(           2),  INT32_C(          32),  INT32_C(           0),  INT32_C(           1),  INT32_C(           1),  INT32_C(           1),  INT32_C(           0),  INT32_C(           2),
+         INT32_C(          32),  INT32_C(           4),  INT32_C(           1),  INT32_C(           5),  INT32_C(           1),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT32_C(   518123587), -INT32_C(   733652835),  INT32_C(  1197469015),  INT32_C(  1515593667),  INT32_C(  1759779817),  INT32_C(   699090642),  INT32_C(   382514588),  INT32_C(  1076298710),
+        -INT32_C(   159441718), -INT32_C(  1710517677), -INT32_C(   341008286),  INT32_C(  1768571299), -INT32_C(  1813024422), -INT32_C(  1888007702),  INT32_C(   497333232),  INT32_C(   440330800) },
+      {  INT32_C(           3),  INT32_C(           0),  INT32_C(           1),  INT32_C(           1),  INT32_C(           1),  INT32_C(           2),  INT32_C(           3),  INT32_C(           1),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           3),  INT32_C(           3) } },
+    { { -INT32_C(   898189637),  INT32_C(    54664190), -INT32_C(  1151898580), -INT32_C(  1280515371), -INT32_C(   137904321), -INT32_C(  2001862705), -INT32_C(   400305566), -INT32_C(  2001491531),
+         INT32_C(           0),  INT32_C(  1102715758),  INT32_C(           0),  INT32_C(  1695240513), -INT32_C(  1197419339),  INT32_C(   541708490),  INT32_C(           0),  INT32_C(   302445506) },
+      {  INT32_C(           0),  INT32_C(           6),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(          32),  INT32_C(           1),  INT32_C(          32),  INT32_C(           1),  INT32_C(           0),  INT32_C(           2),  INT32_C(          32),  INT32_C(           3) } },
+    { {  INT32_C(  1636950344),  INT32_C(  1623759571),  INT32_C(   231554265), -INT32_C(  1221827222), -INT32_C(  1589987617), -INT32_C(   959218159),  INT32_C(  1958253457), -INT32_C(  1717218356),
+         INT32_C(           0), -INT32_C(  1247614351),  INT32_C(           0),  INT32_C(    71830576),  INT32_C(  1452902884), -INT32_C(  1596829723), -INT32_C(   174739404),  INT32_C(   906745602) },
+      {  INT32_C(           1),  INT32_C(           1),  INT32_C(           4),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),
+         INT32_C(          32),  INT32_C(           0),  INT32_C(          32),  INT32_C(           5),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           2) } },
+    { { -INT32_C(  1746577019),  INT32_C(  1206358617),  INT32_C(  1298691200),  INT32_C(   400062899), -INT32_C(   268699713),  INT32_C(  1562285858), -INT32_C(  1735831094),  INT32_C(  1308370333),
+         INT32_C(   745691581),  INT32_C(   307833448),  INT32_C(  1475449245),  INT32_C(           0),  INT32_C(   633421738), -INT32_C(   667890335),  INT32_C(  1715326919),  INT32_C(  1068624621) },
+      {  INT32_C(           0),  INT32_C(           1),  INT32_C(           1),  INT32_C(           3),  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           1),
+         INT32_C(           2),  INT32_C(           3),  INT32_C(           1),  INT32_C(          32),  INT32_C(           2),  INT32_C(           0),  INT32_C(           1),  INT32_C(           2) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i r = simde_mm512_lzcnt_epi32(a);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_lzcnt_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { { -INT32_C(  1821805644), -INT32_C(   203102808),  INT32_C(   683139158),  INT32_C(  2103291004), -INT32_C(  1433334515),  INT32_C(  2085409567), -INT32_C(   452742064), -INT32_C(  1411605516),
+         INT32_C(  1836289094), -INT32_C(   906749775), -INT32_C(   967822824), -INT32_C(   823834755),  INT32_C(   955090657), -INT32_C(   790689350), -INT32_C(   458792077), -INT32_C(   458281181) },
+      UINT16_C(35110),
+      {  INT32_C(           0),  INT32_C(  1053821657),  INT32_C(   548857799), -INT32_C(    66652679),  INT32_C(   468924094), -INT32_C(  1194221855),  INT32_C(  1821909719),  INT32_C(   716735629),
+         INT32_C(    68903331),  INT32_C(           0),  INT32_C(   892418382), -INT32_C(  2056427932), -INT32_C(  1547592611), -INT32_C(   812903697),  INT32_C(   160671379),  INT32_C(   502714580) },
+      { -INT32_C(  1821805644),  INT32_C(           2),  INT32_C(           2),  INT32_C(  2103291004), -INT32_C(  1433334515),  INT32_C(           0), -INT32_C(   452742064), -INT32_C(  1411605516),
+         INT32_C(           5), -INT32_C(   906749775), -INT32_C(   967822824),  INT32_C(           0),  INT32_C(   955090657), -INT32_C(   790689350), -INT32_C(   458792077),  INT32_C(           3) } },
+    { { -INT32_C(  1184144976), -INT32_C(   798861240),  INT32_C(  1164574415), -INT32_C(   737096359), -INT32_C(  1543833849), -INT32_C(  1389805164), -INT32_C(   714736586),  INT32_C(  1745396722),
+        -INT32_C(  1675602352), -INT32_C(   639629141),  INT32_C(   402715034),  INT32_C(   940216780), -INT32_C(  2005924292), -INT32_C(   835528409),  INT32_C(   218590037),  INT32_C(   692319899) },
+      UINT16_C(46749),
+      {  INT32_C(  1167378331),  INT32_C(  1122381839), -INT32_C(  1006037863),  INT32_C(    73061725),  INT32_C(  1680719116),  INT32_C(  1617415532),  INT32_C(   605247012),  INT32_C(           0),
+         INT32_C(  1348610267), -INT32_C(   236149576),  INT32_C(           0), -INT32_C(  1713096566),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1163531437), -INT32_C(   564948171) },
+      {  INT32_C(           1), -INT32_C(   798861240),  INT32_C(           0),  INT32_C(           5),  INT32_C(           1), -INT32_C(  1389805164), -INT32_C(   714736586),  INT32_C(          32),
+        -INT32_C(  1675602352),  INT32_C(           0),  INT32_C(          32),  INT32_C(   940216780),  INT32_C(          32),  INT32_C(          32),  INT32_C(   218590037),  INT32_C(           0) } },
+    { { -INT32_C(  1840596667),  INT32_C(  2122919237),  INT32_C(   188460086),  INT32_C(   536617629), -INT32_C(   906178759),  INT32_C(   839934992),  INT32_C(  1318813718), -INT32_C(  1162786830),
+         INT32_C(    91585337), -INT32_C(  1194233475), -INT32_C(   426157715), -INT32_C(  1760473277), -INT32_C(   631969388),  INT32_C(   976673613),  INT32_C(  1101290040), -INT32_C(   201655547) },
+      UINT16_C(42061),
+      { -INT32_C(  1336235113),  INT32_C(  1791131092),  INT32_C(   251034531),  INT32_C(  1046839414),  INT32_C(   478046956), -INT32_C(  1101528740),  INT32_C(  1739821767), -INT32_C(  1557494442),
+         INT32_C(           0), -INT32_C(  1264352718), -INT32_C(  1902734991),  INT32_C(   942988663),  INT32_C(   235456379), -INT32_C(    55776630),  INT32_C(  1383389373),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(  2122919237),  INT32_C(           4),  INT32_C(           2), -INT32_C(   906178759),  INT32_C(   839934992),  INT32_C(           1), -INT32_C(  1162786830),
+         INT32_C(    91585337), -INT32_C(  1194233475),  INT32_C(           0), -INT32_C(  1760473277), -INT32_C(   631969388),  INT32_C(           0),  INT32_C(  1101290040),  INT32_C(          32) } },
+    { { -INT32_C(   558945997), -INT32_C(   882274589),  INT32_C(  1127598712),  INT32_C(  1237455555),  INT32_C(   120703181), -INT32_C(  2011823967), -INT32_C(    25091789), -INT32_C(   407083829),
+         INT32_C(   504783872), -INT32_C(   157199922),  INT32_C(  2002895055), -INT32_C(   941470049),  INT32_C(   417589268), -INT32_C(  1022807608), -INT32_C(  1264454590), -INT32_C(   492852559) },
+      UINT16_C(15046),
+      { -INT32_C(  1758162694), -INT32_C(  1958343266), -INT32_C(   316135623),  INT32_C(   659260727), -INT32_C(  1204405190), -INT32_C(  2102966407), -INT32_C(   219039921),  INT32_C(   290703639),
+        -INT32_C(  1681870893), -INT32_C(  1250186905), -INT32_C(   844643871), -INT32_C(  1764405271),  INT32_C(   300821107), -INT32_C(  1475360711), -INT32_C(   338768519),  INT32_C(           0) },
+      { -INT32_C(   558945997),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1237455555),  INT32_C(   120703181), -INT32_C(  2011823967),  INT32_C(           0),  INT32_C(           3),
+         INT32_C(   504783872),  INT32_C(           0),  INT32_C(  2002895055),  INT32_C(           0),  INT32_C(           3),  INT32_C(           0), -INT32_C(  1264454590), -INT32_C(   492852559) } },
+    { { -INT32_C(  2104118238),  INT32_C(  1109556883),  INT32_C(   214167640), -INT32_C(  1725751312), -INT32_C(   554309560), -INT32_C(  1882417911), -INT32_C(  2092989376), -INT32_C(   963150900),
+         INT32_C(  1254955271), -INT32_C(   771475848),  INT32_C(   817312043),  INT32_C(  1540411384), -INT32_C(  1649245341),  INT32_C(  1139064816),  INT32_C(   713402013),  INT32_C(  1433341324) },
+      UINT16_C(57442),
+      {  INT32_C(  2105372729),  INT32_C(   296962600),  INT32_C(           0), -INT32_C(   759736219), -INT32_C(  1565785205), -INT32_C(  1797457837), -INT32_C(   761229296), -INT32_C(   948931570),
+        -INT32_C(  1340180708),  INT32_C(  1804473280),  INT32_C(  1990029350),  INT32_C(   422444310),  INT32_C(   841818545),  INT32_C(   507375289),  INT32_C(   718405400), -INT32_C(    35949900) },
+      { -INT32_C(  2104118238),  INT32_C(           3),  INT32_C(   214167640), -INT32_C(  1725751312), -INT32_C(   554309560),  INT32_C(           0),  INT32_C(           0), -INT32_C(   963150900),
+         INT32_C(  1254955271), -INT32_C(   771475848),  INT32_C(   817312043),  INT32_C(  1540411384), -INT32_C(  1649245341),  INT32_C(           3),  INT32_C(           2),  INT32_C(           0) } },
+    { { -INT32_C(  1992613426),  INT32_C(    35044276),  INT32_C(  1331930634), -INT32_C(   527727463),  INT32_C(  1558912267),  INT32_C(    81520246), -INT32_C(   443257266),  INT32_C(  1857902498),
+         INT32_C(  1436168232),  INT32_C(  1754893471), -INT32_C(   674205574), -INT32_C(  1773400972), -INT32_C(   105624893),  INT32_C(   686521314), -INT32_C(   676538988), -INT32_C(  1554699314) },
+      UINT16_C(19607),
+      {  INT32_C(  1665289771), -INT32_C(  1531740193), -INT32_C(   149427781),  INT32_C(  1760630146), -INT32_C(  1451717768),  INT32_C(   809087058),  INT32_C(           0), -INT32_C(  1682242537),
+        -INT32_C(  1236076386),  INT32_C(  1071412207), -INT32_C(  1181231570),  INT32_C(  1789507405),  INT32_C(  1772321043), -INT32_C(   227733081),  INT32_C(   404042961), -INT32_C(  1135987424) },
+      {  INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(   527727463),  INT32_C(           0),  INT32_C(    81520246), -INT32_C(   443257266),  INT32_C(           0),
+         INT32_C(  1436168232),  INT32_C(  1754893471),  INT32_C(           0),  INT32_C(           1), -INT32_C(   105624893),  INT32_C(   686521314),  INT32_C(           3), -INT32_C(  1554699314) } },
+    { { -INT32_C(  1147225763),  INT32_C(  1047194510),  INT32_C(  1948804674), -INT32_C(   444423202),  INT32_C(  1522766972),  INT32_C(  1269745134),  INT32_C(  1953499287),  INT32_C(  1578247746),
+         INT32_C(  1116462090), -INT32_C(  1575071170),  INT32_C(  1159698157), -INT32_C(   392085137),  INT32_C(  1078653263), -INT32_C(  1763998658), -INT32_C(   562390657),  INT32_C(    14228771) },
+      UINT16_C(28288),
+      { -INT32_C(   194757169),  INT32_C(  1734714311), -INT32_C(   249687123),  INT32_C(  1943247859),  INT32_C(  1458760900), -INT32_C(   967496886),  INT32_C(   329990130),  INT32_C(  1817625466),
+         INT32_C(           0),  INT32_C(  1824447040), -INT32_C(   404808613),  INT32_C(   260393523),  INT32_C(  1112009161),  INT32_C(  1127060552), -INT32_C(  1690856198), -INT32_C(   829706713) },
+      { -INT32_C(  1147225763),  INT32_C(  1047194510),  INT32_C(  1948804674), -INT32_C(   444423202),  INT32_C(  1522766972),  INT32_C(  1269745134),  INT32_C(  1953499287),  INT32_C(           1),
+         INT32_C(  1116462090),  INT32_C(           1),  INT32_C(           0),  INT32_C(           4),  INT32_C(  1078653263),  INT32_C(           1),  INT32_C(           0),  INT32_C(    14228771) } },
+    { { -INT32_C(   647911793), -INT32_C(   202497922), -INT32_C(  1721398680), -INT32_C(   774191124), -INT32_C(   252983714), -INT32_C(   362617539), -INT32_C(  1460150581), -INT32_C(  1985176717),
+        -INT32_C(  1640863684),  INT32_C(   810338685), -INT32_C(   647114666), -INT32_C(   913795172),  INT32_C(   157655116),  INT32_C(  1335493329),  INT32_C(   555045635), -INT32_C(  1526894819) },
+      UINT16_C(24242),
+      { -INT32_C(  1142752377), -INT32_C(  1453909196), -INT32_C(   476860026), -INT32_C(  1682344195),  INT32_C(  2088854063), -INT32_C(  1063939233),  INT32_C(  1580287808),  INT32_C(  1105362572),
+         INT32_C(   783545993), -INT32_C(  1075527509),  INT32_C(  2123362578), -INT32_C(  1099664526), -INT32_C(  1829318310), -INT32_C(  1803633545), -INT32_C(  1127789335),  INT32_C(           0) },
+      { -INT32_C(   647911793),  INT32_C(           0), -INT32_C(  1721398680), -INT32_C(   774191124),  INT32_C(           1),  INT32_C(           0), -INT32_C(  1460150581),  INT32_C(           1),
+        -INT32_C(  1640863684),  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1335493329),  INT32_C(           0), -INT32_C(  1526894819) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_lzcnt_epi32(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_lzcnt_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { UINT16_C(48852),
+      { -INT32_C(   236034840), -INT32_C(  1628957705),  INT32_C(   718291818),  INT32_C(  1047544355),  INT32_C(   661919914), -INT32_C(   670226610), -INT32_C(  1136087427), -INT32_C(   351815691),
+        -INT32_C(  1340907609),  INT32_C(  1843106814), -INT32_C(  1793006165),  INT32_C(           0),  INT32_C(   691930646),  INT32_C(           0),  INT32_C(  1986092083), -INT32_C(   672078028) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           2),  INT32_C(           0),  INT32_C(           2),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(          32),  INT32_C(           2),  INT32_C(          32),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(11829),
+      { -INT32_C(   320893212),  INT32_C(  1174452141),  INT32_C(  1718164551), -INT32_C(   681795203), -INT32_C(   730069662), -INT32_C(  1984584323), -INT32_C(  1220185538),  INT32_C(   181312425),
+         INT32_C(   515149129),  INT32_C(  1742028172), -INT32_C(   763542938),  INT32_C(           0), -INT32_C(  1670280546), -INT32_C(  1544728795), -INT32_C(  1215965711), -INT32_C(  1239222128) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(          32),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(49693),
+      { -INT32_C(    21970129), -INT32_C(  2091088160), -INT32_C(  1354142006),  INT32_C(  1692642338), -INT32_C(   691367158),  INT32_C(   548112169), -INT32_C(  1501185623),  INT32_C(  1370485948),
+        -INT32_C(  1612940991),  INT32_C(  1906610324),  INT32_C(           0),  INT32_C(           0),  INT32_C(    10413846), -INT32_C(  1023015886), -INT32_C(  1893407697),  INT32_C(  1138238352) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           1) } },
+    { UINT16_C(30885),
+      {  INT32_C(           0), -INT32_C(  1746117172),  INT32_C(  1458052525), -INT32_C(  1701908262), -INT32_C(  1502704312),  INT32_C(           0),  INT32_C(   369860938), -INT32_C(  1599997084),
+         INT32_C(  1614301083),  INT32_C(  1213197448), -INT32_C(     6692043),  INT32_C(   912438022), -INT32_C(  1944465683), -INT32_C(   523218751),  INT32_C(   357288460),  INT32_C(           0) },
+      {  INT32_C(          32),  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(          32),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           2),  INT32_C(           0),  INT32_C(           0),  INT32_C(           3),  INT32_C(           0) } },
+    { UINT16_C(48429),
+      { -INT32_C(   935737095),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1828396109),  INT32_C(  1013697816), -INT32_C(  1618153953), -INT32_C(  1675219038),  INT32_C(           0),
+         INT32_C(   443607936), -INT32_C(  1136548970),  INT32_C(  1581397603), -INT32_C(   670492735), -INT32_C(  1716087183),  INT32_C(   827432282),  INT32_C(   742632506),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(          32),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           3),  INT32_C(           0),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           2),  INT32_C(           0),  INT32_C(          32) } },
+    { UINT16_C(38300),
+      { -INT32_C(   191412612),  INT32_C(  1398217374), -INT32_C(   248770088),  INT32_C(           0),  INT32_C(  1544867710),  INT32_C(   447391534),  INT32_C(   987165550), -INT32_C(    80128426),
+        -INT32_C(   668076762),  INT32_C(  1025513694), -INT32_C(  1912172545),  INT32_C(   588540945), -INT32_C(  1228105195),  INT32_C(   130856028),  INT32_C(   523666620),  INT32_C(  1913416086) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(          32),  INT32_C(           1),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           1) } },
+    { UINT16_C(58005),
+      { -INT32_C(  1168630622), -INT32_C(  1884144191),  INT32_C(           0), -INT32_C(   691690704), -INT32_C(  1549658272), -INT32_C(   978442758),  INT32_C(  1904935414),  INT32_C(           0),
+        -INT32_C(  1810223662), -INT32_C(   865025279), -INT32_C(  2087569242), -INT32_C(  1064723476), -INT32_C(  1693237343), -INT32_C(  1110363558),  INT32_C(   399062340),  INT32_C(  1529802544) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(          32),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(          32),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           3),  INT32_C(           1) } },
+    { UINT16_C( 4834),
+      {  INT32_C(   355736501), -INT32_C(  1436625628),  INT32_C(  1945337537), -INT32_C(  1155423639),  INT32_C(           0),  INT32_C(   104616419), -INT32_C(  1940250026),  INT32_C(    17923136),
+         INT32_C(   272154034), -INT32_C(  2044288849), -INT32_C(   290516186), -INT32_C(  1654871672),  INT32_C(   433139819),  INT32_C(  1368564846),  INT32_C(  1821341665), -INT32_C(  1233408667) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           5),  INT32_C(           0),  INT32_C(           7),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           3),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_lzcnt_epi32(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_lzcnt_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { {  INT64_C(                7396),  INT64_C(     738749946873099),  INT64_C(                   0),  INT64_C(                7704),
+         INT64_C(     431687830963949),  INT64_C(        129309610903),  INT64_C(  152103696957758264),  INT64_C(          2604785440) },
+      {  INT64_C(                  51),  INT64_C(                  14),  INT64_C(                  64),  INT64_C(                  51),
+         INT64_C(                  15),  INT64_C(                  27),  INT64_C(                   6),  INT64_C(                  32) } },
+    { {  INT64_C(                   0),  INT64_C(           242041002),  INT64_C(                   0),  INT64_C(              543488),
+         INT64_C(      11388684105024),  INT64_C(                   0),  INT64_C(          1701177535),  INT64_C(       3813233524796) },
+      {  INT64_C(                  64),  INT64_C(                  36),  INT64_C(                  64),  INT64_C(                  44),
+         INT64_C(                  20),  INT64_C(                  64),  INT64_C(                  33),  INT64_C(                  22) } },
+    { {  INT64_C(             1376715),  INT64_C(                  45),  INT64_C(       1512946705969),  INT64_C(   41045892990050070),
+         INT64_C(                  41),  INT64_C(            45227322),  INT64_C(     148258746253185),  INT64_C(      39544173821072) },
+      {  INT64_C(                  43),  INT64_C(                  58),  INT64_C(                  23),  INT64_C(                   8),
+         INT64_C(                  58),  INT64_C(                  38),  INT64_C(                  16),  INT64_C(                  18) } },
+    { {  INT64_C(                 810),  INT64_C(           343566626),  INT64_C(            13022200),  INT64_C(        363206099153),
+         INT64_C(        206037529592),  INT64_C(  673271149148224931),  INT64_C( 1437118045829339402),  INT64_C(         44549835297) },
+      {  INT64_C(                  54),  INT64_C(                  35),  INT64_C(                  40),  INT64_C(                  25),
+         INT64_C(                  26),  INT64_C(                   4),  INT64_C(                   3),  INT64_C(                  28) } },
+    { {  INT64_C(            30367167),  INT64_C(        204440195952),  INT64_C(                   0),  INT64_C(         69528420225),
+         INT64_C(           462241807),  INT64_C(       7462436982036),  INT64_C(                   0),  INT64_C(              112021) },
+      {  INT64_C(                  39),  INT64_C(                  26),  INT64_C(                  64),  INT64_C(                  27),
+         INT64_C(                  35),  INT64_C(                  21),  INT64_C(                  64),  INT64_C(                  47) } },
+    { {  INT64_C(      47678840010083),  INT64_C(   16502316719735288),  INT64_C(         84236020184),  INT64_C(                   4),
+         INT64_C(    1755956864547425),  INT64_C(                6604),  INT64_C(          1521970723),  INT64_C(              442728) },
+      {  INT64_C(                  18),  INT64_C(                  10),  INT64_C(                  27),  INT64_C(                  61),
+         INT64_C(                  13),  INT64_C(                  51),  INT64_C(                  33),  INT64_C(                  45) } },
+    { {  INT64_C(           168821330),  INT64_C(          3384091865),  INT64_C(     441371463264278),  INT64_C(              438903),
+         INT64_C(             2602939),  INT64_C(     279203506405211),  INT64_C(                   0),  INT64_C(           119636889) },
+      {  INT64_C(                  36),  INT64_C(                  32),  INT64_C(                  15),  INT64_C(                  45),
+         INT64_C(                  42),  INT64_C(                  16),  INT64_C(                  64),  INT64_C(                  37) } },
+    { {  INT64_C(                   0),  INT64_C(         54689290116),  INT64_C(              275332),  INT64_C(       4343165948369),
+         INT64_C(                  34),  INT64_C(         37192185431),  INT64_C(   68716334190226277),  INT64_C( 1060912077257115760) },
+      {  INT64_C(                  64),  INT64_C(                  28),  INT64_C(                  45),  INT64_C(                  22),
+         INT64_C(                  58),  INT64_C(                  28),  INT64_C(                   8),  INT64_C(                   4) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i r = simde_mm512_lzcnt_epi64(a);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_lzcnt_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[8];
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { {  INT64_C( 8303967390316924243), -INT64_C( 3912300794084174199), -INT64_C( 7373277637502525466),  INT64_C( 2059696163868491306),
+         INT64_C( 1460877284979428784), -INT64_C( 1096146523920492592),  INT64_C( 8060492277446102667),  INT64_C(  156549458434228497) },
+      UINT8_C( 79),
+      {  INT64_C(                5464),  INT64_C(                4314),  INT64_C(            41120643),  INT64_C(                   0),
+         INT64_C(         18528133206),  INT64_C(  123409669818542116),  INT64_C(                   0),  INT64_C(   32615581889011900) },
+      {  INT64_C(                  51),  INT64_C(                  51),  INT64_C(                  38),  INT64_C(                  64),
+         INT64_C( 1460877284979428784), -INT64_C( 1096146523920492592),  INT64_C(                  64),  INT64_C(  156549458434228497) } },
+    { { -INT64_C( 2789535184795167238), -INT64_C( 3549531067444186138),  INT64_C( 8324045542042773129), -INT64_C(  434360540203068745),
+        -INT64_C( 3074985292766538732), -INT64_C( 6709245707080627738),  INT64_C( 1439601597505326323), -INT64_C( 8599252144478823053) },
+      UINT8_C(179),
+      {  INT64_C(                   0),  INT64_C(     105335209736587),  INT64_C(            41830535),  INT64_C(                   2),
+         INT64_C(                   0),  INT64_C(             1170311),  INT64_C(               32084),  INT64_C(               28625) },
+      {  INT64_C(                  64),  INT64_C(                  17),  INT64_C( 8324045542042773129), -INT64_C(  434360540203068745),
+         INT64_C(                  64),  INT64_C(                  43),  INT64_C( 1439601597505326323),  INT64_C(                  49) } },
+    { {  INT64_C( 4720521682078513909), -INT64_C( 7320892533903684273), -INT64_C( 2700720242295564055),  INT64_C( 8199944595661797557),
+         INT64_C( 3838173232080213737),  INT64_C( 3537915400806863609), -INT64_C( 6289868063913776469),  INT64_C( 6207336681092335961) },
+      UINT8_C(158),
+      {  INT64_C(      33736790685308),  INT64_C( 7698354800023048579),  INT64_C(               15585),  INT64_C(                  30),
+         INT64_C(        657580890207),  INT64_C(            33331402),  INT64_C(              261955),  INT64_C(      26733019426125) },
+      {  INT64_C( 4720521682078513909),  INT64_C(                   1),  INT64_C(                  50),  INT64_C(                  59),
+         INT64_C(                  24),  INT64_C( 3537915400806863609), -INT64_C( 6289868063913776469),  INT64_C(                  19) } },
+    { {  INT64_C( 2121140545914285267),  INT64_C( 1462793823888096919),  INT64_C( 7568750235150857776), -INT64_C( 4955192598575695223),
+        -INT64_C( 9184751045265774628), -INT64_C( 7708477201254946055), -INT64_C( 5369564262497283584),  INT64_C( 1013476682267428774) },
+      UINT8_C(210),
+      {  INT64_C(                   0),  INT64_C(    8111126579752041),  INT64_C(   27529497572315240),  INT64_C(                   6),
+         INT64_C(         31839963800),  INT64_C(       3977915765055),  INT64_C(           122744988),  INT64_C(    1629341850560132) },
+      {  INT64_C( 2121140545914285267),  INT64_C(                  11),  INT64_C( 7568750235150857776), -INT64_C( 4955192598575695223),
+         INT64_C(                  29), -INT64_C( 7708477201254946055),  INT64_C(                  37),  INT64_C(                  13) } },
+    { { -INT64_C(  722246566562339135),  INT64_C( 1325857717770556838),  INT64_C(  128419202762487266),  INT64_C( 6423118415687569559),
+        -INT64_C( 2805894309044355823), -INT64_C( 1105091703817727024),  INT64_C( 4615196368301301959),  INT64_C( 1297112023477773436) },
+      UINT8_C( 65),
+      {  INT64_C(                  38),  INT64_C(         20538604201),  INT64_C(   35590620559072519),  INT64_C(                  92),
+         INT64_C(              144838),  INT64_C(  136634772172035979),  INT64_C(     262406358922828),  INT64_C(     696591733829923) },
+      {  INT64_C(                  58),  INT64_C( 1325857717770556838),  INT64_C(  128419202762487266),  INT64_C( 6423118415687569559),
+        -INT64_C( 2805894309044355823), -INT64_C( 1105091703817727024),  INT64_C(                  16),  INT64_C( 1297112023477773436) } },
+    { { -INT64_C( 1425741764001184852), -INT64_C( 5163277037700417753),  INT64_C( 2765446615945906997),  INT64_C( 7773215631719391816),
+        -INT64_C( 1234654697373749381),  INT64_C( 4767222313356075649), -INT64_C( 3558594052436553196),  INT64_C( 7357229182112189251) },
+      UINT8_C(187),
+      {  INT64_C( 4427436424537384137),  INT64_C(     279086691806311),  INT64_C(    9954872842459331),  INT64_C(   58775113572499051),
+         INT64_C(                2491),  INT64_C( 2527507359462497271),  INT64_C(                   0),  INT64_C(         45474352686) },
+      {  INT64_C(                   2),  INT64_C(                  16),  INT64_C( 2765446615945906997),  INT64_C(                   8),
+         INT64_C(                  52),  INT64_C(                   2), -INT64_C( 3558594052436553196),  INT64_C(                  28) } },
+    { { -INT64_C( 8486428073793388227),  INT64_C( 3575553606433325871),  INT64_C( 4967429126088114493),  INT64_C( 7061132042223607406),
+        -INT64_C(  423150006920471783), -INT64_C( 3527625690819562293),  INT64_C( 2822047172865453690), -INT64_C( 2858554206997737755) },
+      UINT8_C( 37),
+      {  INT64_C(             4024765),  INT64_C(                   0),  INT64_C(       2829102743144),  INT64_C(                   0),
+         INT64_C(               59595),  INT64_C(   98581315468641921),  INT64_C(                5089),  INT64_C(         47647521626) },
+      {  INT64_C(                  42),  INT64_C( 3575553606433325871),  INT64_C(                  22),  INT64_C( 7061132042223607406),
+        -INT64_C(  423150006920471783),  INT64_C(                   7),  INT64_C( 2822047172865453690), -INT64_C( 2858554206997737755) } },
+    { {  INT64_C( 4083431315266849348), -INT64_C( 6775501651730480558),  INT64_C( 4994455511100065178), -INT64_C(  879704852029075119),
+         INT64_C( 8852123428984835708),  INT64_C( 3508815249679507358),  INT64_C( 2563836508459347526),  INT64_C( 8380793805402265337) },
+      UINT8_C(155),
+      {  INT64_C(                   1),  INT64_C(   16838207641249640),  INT64_C(               12283),  INT64_C(    1446213605096560),
+         INT64_C(                2369),  INT64_C(                   0),  INT64_C(                  46),  INT64_C(                  36) },
+      {  INT64_C(                  63),  INT64_C(                  10),  INT64_C( 4994455511100065178),  INT64_C(                  13),
+         INT64_C(                  52),  INT64_C( 3508815249679507358),  INT64_C( 2563836508459347526),  INT64_C(                  58) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi64(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_lzcnt_epi64(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_lzcnt_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { UINT8_C(  2),
+      {  INT64_C(                  17),  INT64_C(                   8),  INT64_C(          2099263553),  INT64_C(                  11),
+         INT64_C(           114121747),  INT64_C(   14890400490904043),  INT64_C(      30841060629821),  INT64_C(          9476834072) },
+      {  INT64_C(                   0),  INT64_C(                  60),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 28),
+      {  INT64_C(    4291439076110826),  INT64_C( 5733356264396900174),  INT64_C(        262727121216),  INT64_C(      46805606769314),
+         INT64_C(           210665466),  INT64_C(          3443068097),  INT64_C(               14695),  INT64_C(                5154) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                  26),  INT64_C(                  18),
+         INT64_C(                  36),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(  9),
+      {  INT64_C(                7019),  INT64_C(                   0),  INT64_C(           233282832),  INT64_C(                   0),
+         INT64_C(             3339828),  INT64_C(                   0),  INT64_C(          1053861641),  INT64_C(    1399585241415409) },
+      {  INT64_C(                  51),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                  64),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(162),
+      {  INT64_C(        804377147331),  INT64_C(  188834507129611735), -INT64_C( 7108962219396165084),  INT64_C(                   1),
+         INT64_C(    1506229701577515),  INT64_C(         62708664143),  INT64_C(    1146601004455809),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   6),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                  28),  INT64_C(                   0),  INT64_C(                  64) } },
+    { UINT8_C(216),
+      {  INT64_C(             4050668),  INT64_C(      17382886001558),  INT64_C( 5349553139342196026),  INT64_C( 2153751571664194479),
+         INT64_C(                   5),  INT64_C(    3922471422860202),  INT64_C(                1454),  INT64_C(           489932225) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   3),
+         INT64_C(                  61),  INT64_C(                   0),  INT64_C(                  53),  INT64_C(                  35) } },
+    { UINT8_C(111),
+      {  INT64_C(          1190825402),  INT64_C(  353735651477891878),  INT64_C(               18183),  INT64_C(              312711),
+         INT64_C(      65247146838600),  INT64_C(  973854739254622961),  INT64_C(         32412765391),  INT64_C(                 162) },
+      {  INT64_C(                  33),  INT64_C(                   5),  INT64_C(                  49),  INT64_C(                  45),
+         INT64_C(                   0),  INT64_C(                   4),  INT64_C(                  29),  INT64_C(                   0) } },
+    { UINT8_C( 27),
+      {  INT64_C(              222874),  INT64_C(   24442441968667949),  INT64_C(                3746),  INT64_C(            99195889),
+         INT64_C(         30275872792),  INT64_C(        482690880776),  INT64_C(           121477692), -INT64_C(  413733894236935273) },
+      {  INT64_C(                  46),  INT64_C(                   9),  INT64_C(                   0),  INT64_C(                  37),
+         INT64_C(                  29),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(172),
+      {  INT64_C(               13340),  INT64_C(          2758563616),  INT64_C(        104883642162),  INT64_C(                   1),
+         INT64_C(             4942515),  INT64_C(                   0),  INT64_C( 7323004787033285704),  INT64_C(         40726490261) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                  27),  INT64_C(                  63),
+         INT64_C(                   0),  INT64_C(                  64),  INT64_C(                   0),  INT64_C(                  28) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_lzcnt_epi64(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
 SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_lzcnt_epi32)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_lzcnt_epi32)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_lzcnt_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_lzcnt_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_lzcnt_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_lzcnt_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_lzcnt_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_lzcnt_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_lzcnt_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_lzcnt_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_lzcnt_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_lzcnt_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_lzcnt_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_lzcnt_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_lzcnt_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_lzcnt_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_lzcnt_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_lzcnt_epi64)
 SIMDE_TEST_FUNC_LIST_END
 
 #include <test/x86/avx512/test-avx512-footer.h>
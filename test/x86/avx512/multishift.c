@@ -0,0 +1,1154 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+#define SIMDE_TEST_X86_AVX512_INSN multishift
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/multishift.h>
+
+static int
+test_simde_mm_multishift_epi64_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[16];
+    const int64_t b[2];
+    const int8_t r[16];
+  } test_vec[] = {
+    { { -INT8_C(  32), -INT8_C(  73),  INT8_C(  54), -INT8_C( 114), -INT8_C(  63), -INT8_C(  48),  INT8_C( 109),  INT8_C(  15),
+        -INT8_C(  39), -INT8_C(  44),  INT8_C( 121), -INT8_C( 107),  INT8_C(  38), -INT8_C(  52), -INT8_C(  65),  INT8_C(  10) },
+      {  INT64_C( 3911536644635747864), -INT64_C( 9136370100322543060) },
+      { -INT8_C(  38),  INT8_C( 108), -INT8_C(  39), -INT8_C(  65),  INT8_C(  12),  INT8_C( 111),  INT8_C(  68), -INT8_C(  33),
+         INT8_C( 112),  INT8_C(  28),  INT8_C(  64),  INT8_C(  14),  INT8_C(  95),  INT8_C( 101),  INT8_C(  89), -INT8_C( 106) } },
+    { { -INT8_C(  90),  INT8_C(  15),  INT8_C(   1), -INT8_C(  79), -INT8_C(  44), -INT8_C( 125),  INT8_C(  72),  INT8_C(  96),
+         INT8_C(  16),  INT8_C( 100), -INT8_C(  24), -INT8_C(  91),  INT8_C(  26),  INT8_C(  28), -INT8_C(  20),  INT8_C(  31) },
+      {  INT64_C( 2313469423828276752),  INT64_C( 1882794984785126684) },
+      {  INT8_C(  96),  INT8_C(   6),  INT8_C(   8),  INT8_C(  13),  INT8_C(  96), -INT8_C(  62),  INT8_C(  22),  INT8_C(  47),
+         INT8_C(   1), -INT8_C( 127),  INT8_C(   8),  INT8_C(  64),  INT8_C(  11),  INT8_C(   2),  INT8_C(  16),  INT8_C(  32) } },
+    { { -INT8_C( 103), -INT8_C(  16), -INT8_C( 117), -INT8_C(  24), -INT8_C(  69), -INT8_C( 120), -INT8_C(  47), -INT8_C(  38),
+        -INT8_C(  57), -INT8_C(  90), -INT8_C(  51),  INT8_C( 108), -INT8_C(   8), -INT8_C(  91),  INT8_C(  92),  INT8_C( 106) },
+      { -INT64_C( 5427523445015565151),  INT64_C( 5662491061877855397) },
+      {  INT8_C( 108), -INT8_C(  83), -INT8_C(  59), -INT8_C( 112),  INT8_C(  54),  INT8_C(  44), -INT8_C(  33), -INT8_C(  74),
+        -INT8_C(  87), -INT8_C(  42),  INT8_C( 110),  INT8_C(  83),  INT8_C(  78), -INT8_C(  84), -INT8_C(  23),  INT8_C(  77) } },
+    { { -INT8_C(  41),  INT8_C(  32), -INT8_C( 112), -INT8_C(  59), -INT8_C( 108),  INT8_C(   9), -INT8_C(  99), -INT8_C(  72),
+        -INT8_C(  35),  INT8_C(   8),  INT8_C( 118), -INT8_C(  26),  INT8_C(  87),  INT8_C( 123), -INT8_C(  11),  INT8_C(  36) },
+      {  INT64_C( 2971282951329427222),  INT64_C(  304840750457364742) },
+      {  INT8_C(  18),  INT8_C(  26),  INT8_C(  42),  INT8_C( 120), -INT8_C( 110),  INT8_C(  23), -INT8_C(  48),  INT8_C(  41),
+         INT8_C(  97),  INT8_C(  33),  INT8_C(  16),  INT8_C(  12),  INT8_C(  72), -INT8_C(  64),  INT8_C(  33),  INT8_C(  48) } },
+    { { -INT8_C(  48), -INT8_C(  87),  INT8_C(  78), -INT8_C(  26),  INT8_C(  27), -INT8_C(  27), -INT8_C(   8), -INT8_C(  31),
+        -INT8_C(  78), -INT8_C(  23),      INT8_MIN,  INT8_C(  83), -INT8_C(  73),  INT8_C(   2),  INT8_C( 124),  INT8_C( 110) },
+      {  INT64_C( 8513029113052271281),  INT64_C( 6730550883575326148) },
+      {  INT8_C(  10),  INT8_C(  45),  INT8_C(  40),  INT8_C( 107), -INT8_C(   6), -INT8_C(  42),  INT8_C( 118),  INT8_C( 111),
+         INT8_C(  89), -INT8_C(  36), -INT8_C(  60), -INT8_C(  58), -INT8_C(  70),  INT8_C( 113),  INT8_C(  69), -INT8_C(  98) } },
+    { {  INT8_C(  37),  INT8_C(  59),  INT8_C(  27), -INT8_C(  89), -INT8_C( 118),  INT8_C(  25),  INT8_C(  49), -INT8_C(  97),
+        -INT8_C(  88),  INT8_C( 107), -INT8_C(  21),  INT8_C(  34), -INT8_C( 124),  INT8_C(  77),  INT8_C(  47),  INT8_C(  29) },
+      {  INT64_C( 3908340538122779435),  INT64_C( 3898737395411720246) },
+      { -INT8_C(  72),  INT8_C( 102),  INT8_C(  99),  INT8_C( 110),  INT8_C(  78), -INT8_C( 114),  INT8_C(  30),  INT8_C(   6),
+         INT8_C(  25),  INT8_C(  99),  INT8_C(  99),  INT8_C(  64), -INT8_C( 125),  INT8_C(  96),  INT8_C(  54),  INT8_C(   9) } },
+    { {  INT8_C(  88), -INT8_C(  44), -INT8_C(  99), -INT8_C(  64), -INT8_C(  13),  INT8_C(  34),  INT8_C(  22),  INT8_C(  16),
+        -INT8_C( 106), -INT8_C(  59),  INT8_C( 112),  INT8_C(  44), -INT8_C(  12), -INT8_C(  27),  INT8_C( 106), -INT8_C(  66) },
+      { -INT64_C( 5823862753284137540),  INT64_C( 5896977954414361480) },
+      { -INT8_C( 103), -INT8_C(  99),  INT8_C( 116), -INT8_C(  68), -INT8_C(  27), -INT8_C(  21),  INT8_C( 103), -INT8_C(  34),
+        -INT8_C(  12), -INT8_C(  36), -INT8_C(  42),  INT8_C( 100),  INT8_C(  29),  INT8_C(  49), -INT8_C( 111),  INT8_C(  33) } },
+    { { -INT8_C(  87), -INT8_C(  92), -INT8_C(  93), -INT8_C(  60), -INT8_C( 113),  INT8_C(  40),  INT8_C( 124), -INT8_C(  70),
+         INT8_C(  15), -INT8_C(  53),  INT8_C(  98), -INT8_C(   2),  INT8_C( 107),  INT8_C( 109), -INT8_C(  75),  INT8_C(   0) },
+      {  INT64_C( 1956598607583788066),  INT64_C( 2680772274582721825) },
+      { -INT8_C(  98), -INT8_C(  63), -INT8_C( 126), -INT8_C(  62),  INT8_C(  28),  INT8_C(  60),  INT8_C(  33), -INT8_C( 122),
+         INT8_C( 112),  INT8_C(   2),  INT8_C(  11), -INT8_C( 124),      INT8_MIN, -INT8_C(  96),  INT8_C(  41),  INT8_C(  33) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i r = simde_mm_multishift_epi64_epi8(a, b);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_multishift_epi64_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[16];
+    const simde__mmask16 k;
+    const int8_t a[16];
+    const int64_t b[2];
+    const int8_t r[16];
+  } test_vec[] = {
+    { { -INT8_C( 101), -INT8_C(  60), -INT8_C(  69), -INT8_C(  58), -INT8_C(  95), -INT8_C(  94), -INT8_C(  61), -INT8_C( 112),
+        -INT8_C(  67), -INT8_C(  96),  INT8_C(  91), -INT8_C( 115), -INT8_C(  70), -INT8_C(  33), -INT8_C( 108), -INT8_C(  17) },
+      UINT16_C(29438),
+      {  INT8_C(  40), -INT8_C(  92),  INT8_C(  53), -INT8_C(  71), -INT8_C(  72), -INT8_C( 113),  INT8_C(  90),  INT8_C(  32),
+         INT8_C(  18), -INT8_C( 110),  INT8_C(  45), -INT8_C(  33),  INT8_C(  46),  INT8_C(  58),  INT8_C( 112), -INT8_C(  52) },
+      { -INT64_C( 1794806507517027360),  INT64_C( 3258144553157400700) },
+      { -INT8_C( 101),  INT8_C(  15),  INT8_C(  56),  INT8_C( 115), -INT8_C(  25), -INT8_C(  58),  INT8_C( 103), -INT8_C(   3),
+        -INT8_C(  67),  INT8_C( 116),  INT8_C(  91), -INT8_C( 115), -INT8_C(  35),  INT8_C(  11),  INT8_C(  55), -INT8_C(  17) } },
+    { {  INT8_C(  39), -INT8_C( 113),  INT8_C(  70), -INT8_C(   8), -INT8_C(  71),  INT8_C(  36),  INT8_C(   6), -INT8_C(  72),
+         INT8_C(  83), -INT8_C(  63), -INT8_C(   8), -INT8_C(  25),  INT8_C(  64), -INT8_C( 122),  INT8_C(  23), -INT8_C(   5) },
+      UINT16_C(30219),
+      {  INT8_C(  30),  INT8_C(  60),  INT8_C(  59),  INT8_C(  60),  INT8_C(  61),  INT8_C(  30),  INT8_C(  63),  INT8_C(   3),
+         INT8_C(  62),  INT8_C(  44),  INT8_C(  57),  INT8_C(   5),  INT8_C(  63),  INT8_C(   4),  INT8_C(  59),  INT8_C(   3) },
+      {  INT64_C( 4010080608353047504), -INT64_C( 5302382980762592533) },
+      {  INT8_C(  68),  INT8_C(   3),  INT8_C(  70),  INT8_C(   3), -INT8_C(  71),  INT8_C(  36),  INT8_C(   6), -INT8_C(  72),
+         INT8_C(  83), -INT8_C(  94), -INT8_C(  37), -INT8_C(  25), -INT8_C(  41), -INT8_C(  82),  INT8_C( 118), -INT8_C(   5) } },
+    { {  INT8_C( 115), -INT8_C(  41), -INT8_C(   2), -INT8_C(  63),  INT8_C(  40), -INT8_C(  18), -INT8_C(  83),  INT8_C(  22),
+         INT8_C( 120), -INT8_C(  60),  INT8_C(  45), -INT8_C(  15),  INT8_C(  42),  INT8_C( 114), -INT8_C(  40), -INT8_C(  97) },
+      UINT16_C(25524),
+      { -INT8_C(   4), -INT8_C(  65),  INT8_C(  86),  INT8_C( 120),  INT8_C(  24), -INT8_C(  10), -INT8_C(   9), -INT8_C(  84),
+        -INT8_C( 121), -INT8_C( 112),  INT8_C(  77), -INT8_C( 115), -INT8_C(  74), -INT8_C( 117), -INT8_C(  14), -INT8_C( 125) },
+      { -INT64_C( 3389006880979503698),  INT64_C(  592968289913356627) },
+      {  INT8_C( 115), -INT8_C(  41),  INT8_C(  55), -INT8_C(  63), -INT8_C( 115),  INT8_C(  67), -INT8_C(  83),  INT8_C( 125),
+        -INT8_C( 126),  INT8_C(  91),  INT8_C(  45), -INT8_C(  15),  INT8_C(  42),  INT8_C( 104),  INT8_C(  14), -INT8_C(  97) } },
+    { { -INT8_C( 123), -INT8_C( 124),  INT8_C(  17),  INT8_C(   9), -INT8_C(  61),  INT8_C(  82), -INT8_C(  96),  INT8_C(  55),
+        -INT8_C(  69),  INT8_C( 102), -INT8_C(  98),  INT8_C(  23), -INT8_C(  69),  INT8_C(   6), -INT8_C(  78), -INT8_C( 103) },
+      UINT16_C(60445),
+      {  INT8_C(  52),  INT8_C(  14),  INT8_C(  63),  INT8_C(  42),  INT8_C(  43),  INT8_C(  48),  INT8_C(   9),  INT8_C(  37),
+         INT8_C(  44),  INT8_C(  20),  INT8_C(   5),  INT8_C(  18),  INT8_C(  22),  INT8_C(  39),  INT8_C(  20),  INT8_C(  61) },
+      {  INT64_C(  246938594198113246), -INT64_C( 4643146741800817317) },
+      {  INT8_C(  54), -INT8_C( 124), -INT8_C(  68),  INT8_C(  83), -INT8_C(  87),  INT8_C(  82), -INT8_C(  96),  INT8_C(  55),
+        -INT8_C(  69),  INT8_C( 102),  INT8_C( 106), -INT8_C(  68), -INT8_C(  69),  INT8_C( 117),  INT8_C( 111), -INT8_C(  35) } },
+    { { -INT8_C(  12),  INT8_C(  17),  INT8_C(  91), -INT8_C(  55), -INT8_C( 116), -INT8_C(  77),  INT8_C( 110),  INT8_C(   2),
+         INT8_C(  82), -INT8_C(  78),  INT8_C(  21), -INT8_C(  55), -INT8_C(  76), -INT8_C(  85),  INT8_C(  72),  INT8_C(  84) },
+      UINT16_C(57227),
+      {  INT8_C(  45), -INT8_C(  99),  INT8_C(   0), -INT8_C(  38),  INT8_C( 119), -INT8_C(   3),  INT8_C(  26), -INT8_C(  22),
+         INT8_C(  13), -INT8_C( 103),  INT8_C(  10),  INT8_C( 108), -INT8_C(  72), -INT8_C(  73),  INT8_C( 114), -INT8_C(  48) },
+      { -INT64_C( 4701207603086772007), -INT64_C( 7837101971657071915) },
+      {  INT8_C(  15), -INT8_C(  66),  INT8_C(  91), -INT8_C(  12), -INT8_C( 116), -INT8_C(  77),  INT8_C( 110),  INT8_C( 125),
+        -INT8_C(  17), -INT8_C(  57),  INT8_C( 120), -INT8_C(  48), -INT8_C( 109), -INT8_C(  85), -INT8_C(  49), -INT8_C(  35) } },
+    { { -INT8_C(  36), -INT8_C(  17),  INT8_C(  48),  INT8_C(  64), -INT8_C(  38), -INT8_C(  99), -INT8_C(  84),  INT8_C(  75),
+        -INT8_C(  79), -INT8_C( 118), -INT8_C( 107), -INT8_C( 102), -INT8_C(  59),  INT8_C(  28), -INT8_C( 126),  INT8_C( 101) },
+      UINT16_C(30707),
+      {  INT8_C(  37),  INT8_C(  53),  INT8_C(  50),  INT8_C(   0),  INT8_C(  14),  INT8_C(   0),  INT8_C(  39),  INT8_C(  16),
+         INT8_C(  34),  INT8_C(  58),  INT8_C(  37),  INT8_C(   7),  INT8_C(  24),  INT8_C(  41),  INT8_C(  42),  INT8_C(  21) },
+      { -INT64_C( 8197670491851883634),  INT64_C( 2093031225018640251) },
+      {  INT8_C(  48),  INT8_C( 113),  INT8_C(  48),  INT8_C(  64), -INT8_C(  35), -INT8_C( 114),  INT8_C(  12),  INT8_C( 119),
+         INT8_C(  51), -INT8_C(  57), -INT8_C( 122), -INT8_C( 102),  INT8_C(  79), -INT8_C(   8), -INT8_C(   4),  INT8_C( 101) } },
+    { {  INT8_C(   5), -INT8_C(  65),  INT8_C(   6),  INT8_C(  66), -INT8_C( 114),  INT8_C(  63), -INT8_C( 115), -INT8_C(   8),
+        -INT8_C(  41), -INT8_C(  92), -INT8_C(  79),  INT8_C( 114),  INT8_C(  60),  INT8_C(  26),  INT8_C(  34), -INT8_C( 100) },
+      UINT16_C( 9154),
+      { -INT8_C(  58), -INT8_C(  55), -INT8_C(  96),  INT8_C( 103), -INT8_C(  87), -INT8_C(  76), -INT8_C( 111), -INT8_C(  52),
+        -INT8_C(  95), -INT8_C(  38), -INT8_C(  47),  INT8_C(   2),  INT8_C(  38),  INT8_C(  24), -INT8_C( 106),  INT8_C( 117) },
+      { -INT64_C( 6333711867607756194),  INT64_C( 6228620533244847931) },
+      {  INT8_C(   5),  INT8_C(  41),  INT8_C(   6),  INT8_C(  66), -INT8_C( 114),  INT8_C(  63), -INT8_C(  56),  INT8_C(   5),
+        -INT8_C(  81), -INT8_C(  11), -INT8_C(  79),  INT8_C( 114),  INT8_C(  60), -INT8_C(  44),  INT8_C(  34), -INT8_C( 100) } },
+    { { -INT8_C(  64),  INT8_C(  73),  INT8_C( 123), -INT8_C(   5),  INT8_C( 112), -INT8_C( 118), -INT8_C( 105), -INT8_C(  54),
+         INT8_C( 107), -INT8_C(  85),  INT8_C(  30),  INT8_C(  40),  INT8_C( 122),  INT8_C(  18),  INT8_C(  30), -INT8_C(  18) },
+      UINT16_C(33413),
+      {  INT8_C(  24),  INT8_C(  53),  INT8_C(  55),  INT8_C(  28),  INT8_C(  26),  INT8_C(  23),  INT8_C(  49),  INT8_C(  46),
+         INT8_C(  61),  INT8_C(  10),  INT8_C(  10),  INT8_C(  29),  INT8_C(   5),  INT8_C(  62),  INT8_C(  58),  INT8_C(  18) },
+      { -INT64_C( 3101965331848592127), -INT64_C( 9089833915131547885) },
+      {  INT8_C(  49),  INT8_C(  73), -INT8_C(  87), -INT8_C(   5),  INT8_C( 112), -INT8_C( 118), -INT8_C( 105), -INT8_C(  50),
+         INT8_C( 107),  INT8_C(  75),  INT8_C(  30),  INT8_C(  40),  INT8_C( 122),  INT8_C(  18),  INT8_C(  30),  INT8_C(  82) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi8(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i r = simde_mm_mask_multishift_epi64_epi8(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_multishift_epi64_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int8_t a[16];
+    const int64_t b[2];
+    const int8_t r[16];
+  } test_vec[] = {
+    { UINT16_C(53535),
+      {  INT8_C( 125), -INT8_C(  29),  INT8_C(  34), -INT8_C(  82),  INT8_C(  83), -INT8_C(  81),  INT8_C(  52),  INT8_C(  54),
+        -INT8_C(  34), -INT8_C(  59),  INT8_C( 124),  INT8_C(  82),  INT8_C(  66),  INT8_C(  60), -INT8_C(  74),  INT8_C(  85) },
+      { -INT64_C( 4743179180569525105),  INT64_C( 4671893517500620107) },
+      {  INT8_C( 125), -INT8_C(  11), -INT8_C(  22), -INT8_C(  77), -INT8_C( 124),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C( 101),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  82),  INT8_C(   0),  INT8_C(   3),  INT8_C(  24) } },
+    { UINT16_C(38283),
+      {  INT8_C(  96),  INT8_C(  96), -INT8_C( 116), -INT8_C(  53),  INT8_C(  10),  INT8_C( 104), -INT8_C(  44), -INT8_C(  13),
+         INT8_C(  10),  INT8_C( 120),  INT8_C(   2), -INT8_C(  84),  INT8_C(  73),  INT8_C(  97), -INT8_C(   5), -INT8_C( 102) },
+      {  INT64_C( 3607730966343715848),  INT64_C( 3402526886528099085) },
+      {  INT8_C(  51),  INT8_C(  51),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  66),
+         INT8_C(  72),  INT8_C(   0), -INT8_C(  61),  INT8_C(   0), -INT8_C( 111),  INT8_C(   0),  INT8_C(   0),  INT8_C(  66) } },
+    { UINT16_C(34854),
+      { -INT8_C(  74),  INT8_C( 123), -INT8_C(  77), -INT8_C(  80), -INT8_C(  47), -INT8_C(  34),  INT8_C(   1),  INT8_C(  79),
+        -INT8_C(  97), -INT8_C(   4), -INT8_C(  49),  INT8_C(  52),      INT8_MIN,  INT8_C( 109), -INT8_C( 109),  INT8_C(  92) },
+      {  INT64_C( 8815299985474655023),  INT64_C( 5157781478378204180) },
+      {  INT8_C(   0), -INT8_C(  17),  INT8_C(  74),  INT8_C(   0),  INT8_C(   0), -INT8_C( 122),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 121),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  42) } },
+    { UINT16_C(60364),
+      {  INT8_C(  27),  INT8_C( 121), -INT8_C( 121), -INT8_C(  48),  INT8_C(  97),  INT8_C(   3), -INT8_C(  99),  INT8_C(  40),
+        -INT8_C(  50), -INT8_C( 125),  INT8_C(  56),  INT8_C( 120),  INT8_C( 104), -INT8_C(  66), -INT8_C(  15),  INT8_C(   0) },
+      {  INT64_C( 3761084071064581676),  INT64_C( 2388916641056101420) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C( 108),  INT8_C(  47),  INT8_C(   0),  INT8_C(   0),  INT8_C(  72),  INT8_C(  14),
+        -INT8_C(  84), -INT8_C( 123),  INT8_C(   0),  INT8_C(  33),  INT8_C(   0), -INT8_C(  80), -INT8_C( 109),  INT8_C(  44) } },
+    { UINT16_C( 8427),
+      {  INT8_C( 106),  INT8_C(  58),  INT8_C(  46), -INT8_C(   6),  INT8_C(  67),  INT8_C( 125),  INT8_C(  29), -INT8_C(  27),
+         INT8_C(  48), -INT8_C(   6), -INT8_C(  85),  INT8_C(  20),  INT8_C(  36), -INT8_C( 104), -INT8_C(  15),  INT8_C(  86) },
+      {  INT64_C( 8103729183598445590),  INT64_C( 7891008797218706450) },
+      { -INT8_C( 114), -INT8_C( 100),  INT8_C(   0), -INT8_C( 100),  INT8_C(   0), -INT8_C(  77),  INT8_C(  14), -INT8_C(  42),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  85),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT16_C(39083),
+      {  INT8_C(  90), -INT8_C(  36),  INT8_C(  37),  INT8_C(  99),  INT8_C(   3), -INT8_C(  95), -INT8_C( 124),  INT8_C(  55),
+         INT8_C(  75), -INT8_C( 101), -INT8_C(  46),  INT8_C( 115), -INT8_C(  61),  INT8_C( 124), -INT8_C(  66), -INT8_C( 111) },
+      {  INT64_C( 4483099370579237430),  INT64_C(  300966041567433505) },
+      {  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C( 100),  INT8_C(   0), -INT8_C( 112),  INT8_C(   0),  INT8_C( 124),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 123),  INT8_C( 100),  INT8_C(   0),  INT8_C(   0), -INT8_C( 118) } },
+    { UINT16_C(16549),
+      {  INT8_C( 100),  INT8_C(  78),  INT8_C( 108), -INT8_C(  26), -INT8_C(  19),  INT8_C(  10), -INT8_C(  46), -INT8_C( 101),
+         INT8_C(  10), -INT8_C(  88),  INT8_C( 117),  INT8_C(   9), -INT8_C(  71),  INT8_C(  72),  INT8_C( 108), -INT8_C( 114) },
+      {  INT64_C( 1936929426906343828), -INT64_C( 3837263423381772844) },
+      { -INT8_C(  80),  INT8_C(   0),  INT8_C(  21),  INT8_C(   0),  INT8_C(   0),  INT8_C(  58),  INT8_C(   0), -INT8_C(  91),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  12),  INT8_C(   0) } },
+    { UINT16_C(62192),
+      {  INT8_C(  21),  INT8_C(  23),  INT8_C( 107), -INT8_C( 117), -INT8_C(  88),  INT8_C(  73), -INT8_C( 109), -INT8_C(  70),
+         INT8_C(  91),  INT8_C(  11), -INT8_C(  55), -INT8_C(  20),  INT8_C( 117),  INT8_C(  27), -INT8_C(  45), -INT8_C( 106) },
+      {  INT64_C( 3256146622827274288),  INT64_C( 4045666474297003780) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  40), -INT8_C( 112), -INT8_C(  58),  INT8_C(  11),
+         INT8_C(   0), -INT8_C(  63),  INT8_C(   0),  INT8_C(   0), -INT8_C(  63),  INT8_C(  39),  INT8_C(   5), -INT8_C(  32) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i r = simde_mm_maskz_multishift_epi64_epi8(test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_multishift_epi64_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[32];
+    const int64_t b[4];
+    const int8_t r[32];
+  } test_vec[] = {
+    { {  INT8_C(  29),  INT8_C(  19),  INT8_C(  65), -INT8_C( 125), -INT8_C( 122),  INT8_C(  53),  INT8_C(  63),  INT8_C(  71),
+        -INT8_C(  13),  INT8_C(  98),  INT8_C( 110), -INT8_C(   8), -INT8_C(  91), -INT8_C( 104),  INT8_C(  53),  INT8_C( 123),
+        -INT8_C(  13),  INT8_C(  62), -INT8_C(  36),  INT8_C(  87), -INT8_C(  71), -INT8_C(  30),  INT8_C(  75), -INT8_C( 119),
+        -INT8_C(  62),  INT8_C(  31), -INT8_C(  29),  INT8_C(  66),  INT8_C(  96), -INT8_C(  84), -INT8_C(  47), -INT8_C(  22) },
+      {  INT64_C( 8565282216952898419), -INT64_C( 1353375587907436640),  INT64_C( 4820397163968953752),  INT64_C( 6706981400004301276) },
+      {  INT8_C(  93), -INT8_C(  50), -INT8_C(  71),  INT8_C( 110), -INT8_C( 115), -INT8_C(  74), -INT8_C(  26),  INT8_C(  70),
+        -INT8_C(  90),  INT8_C(   4), -INT8_C(  33), -INT8_C(  19), -INT8_C(  64), -INT8_C(  61),  INT8_C( 105),  INT8_C(  29),
+         INT8_C(  92),  INT8_C(  97), -INT8_C(  27), -INT8_C(  75),  INT8_C(  33),  INT8_C( 107),  INT8_C( 111), -INT8_C(  66),
+         INT8_C( 119),  INT8_C(  24), -INT8_C( 127),  INT8_C( 119),  INT8_C(  12),  INT8_C(  63),  INT8_C(  52), -INT8_C(   1) } },
+    { {  INT8_C(  46), -INT8_C(   4), -INT8_C(  99),  INT8_C(  26), -INT8_C(  24),  INT8_C( 101), -INT8_C( 101),  INT8_C(  54),
+         INT8_C(  36),      INT8_MIN,  INT8_C(   9),  INT8_C(  85), -INT8_C(  29),  INT8_C(  94), -INT8_C(  64), -INT8_C(  15),
+         INT8_C(  50), -INT8_C(   4),  INT8_C(  77), -INT8_C( 127), -INT8_C(  92), -INT8_C(  49), -INT8_C(  76), -INT8_C( 103),
+         INT8_C( 122),  INT8_C( 126), -INT8_C(   2), -INT8_C(  37),  INT8_C(  72),  INT8_C(  36),  INT8_C(   8),  INT8_C( 120) },
+      {  INT64_C( 1818618625572549935),  INT64_C( 2459593339000195379),  INT64_C( 3113986512890568251),  INT64_C( 2460094620993465614) },
+      { -INT8_C(  12), -INT8_C(  15),  INT8_C(   9),  INT8_C(  73),  INT8_C(   8),  INT8_C(  64),  INT8_C(  36),  INT8_C( 100),
+        -INT8_C(  79),  INT8_C(  51),  INT8_C(   4), -INT8_C(   8),  INT8_C(  99),  INT8_C( 112),  INT8_C(  51),  INT8_C(  17),
+        -INT8_C(  51), -INT8_C(  78), -INT8_C( 104),  INT8_C(  29), -INT8_C(  93),  INT8_C( 102), -INT8_C(  77),  INT8_C(  16),
+        -INT8_C( 120),  INT8_C(  56),  INT8_C(  56), -INT8_C(  63),  INT8_C(  45),  INT8_C(  48),  INT8_C(  45),  INT8_C(  34) } },
+    { {  INT8_C(  65), -INT8_C(  65), -INT8_C( 118),  INT8_C( 127),  INT8_C(  45),  INT8_C(  61), -INT8_C(  93),  INT8_C(   4),
+         INT8_C(  10), -INT8_C(  84),  INT8_C( 103), -INT8_C(  41),  INT8_C(  48), -INT8_C(  70), -INT8_C( 103),  INT8_C( 112),
+         INT8_C(  68),  INT8_C( 100), -INT8_C(  12), -INT8_C( 127),  INT8_C(  42), -INT8_C(  30),  INT8_C(  15), -INT8_C( 121),
+        -INT8_C(  48), -INT8_C(  51), -INT8_C(   8),  INT8_C( 107), -INT8_C(  79),  INT8_C(  96), -INT8_C( 114), -INT8_C(  67) },
+      {  INT64_C( 6236699398178038115),  INT64_C( 2472060162707971616),  INT64_C(  845218486651493808),  INT64_C( 3733155983079478439) },
+      { -INT8_C(  79), -INT8_C(  58), -INT8_C(  40), -INT8_C(  58),  INT8_C( 105),  INT8_C(  26), -INT8_C(  95),  INT8_C(  22),
+        -INT8_C( 105), -INT8_C(  24),  INT8_C(  11), -INT8_C(  85),  INT8_C(  78),  INT8_C(   8),  INT8_C( 106),  INT8_C(  78),
+        -INT8_C(  37),  INT8_C(  27), -INT8_C(  69), -INT8_C(  40), -INT8_C(  76),  INT8_C( 111), -INT8_C(  23),  INT8_C(  59),
+        -INT8_C( 109), -INT8_C( 100),  INT8_C(  51), -INT8_C(  38), -INT8_C(  25), -INT8_C( 106),  INT8_C(  78),  INT8_C(  57) } },
+    { { -INT8_C(  36),  INT8_C( 109), -INT8_C(  13),  INT8_C(  14),  INT8_C(  82), -INT8_C(  86), -INT8_C(  19),  INT8_C( 110),
+        -INT8_C(   2),  INT8_C(  63),  INT8_C( 105), -INT8_C(  67),  INT8_C( 100), -INT8_C(  18), -INT8_C( 103), -INT8_C(  72),
+        -INT8_C(  45), -INT8_C( 108),  INT8_C(  79), -INT8_C(   5),  INT8_C(  94), -INT8_C(  28), -INT8_C( 109),  INT8_C(  26),
+        -INT8_C(  82), -INT8_C(  77),  INT8_C(  78),  INT8_C(  42),  INT8_C(  34),  INT8_C(  70),  INT8_C(   4),  INT8_C( 118) },
+      {  INT64_C( 1089923891333375022),  INT64_C( 4052444722980533286),  INT64_C( 2884560136027314744),  INT64_C( 3392670868423906829) },
+      {  INT8_C(  18),  INT8_C(   1), -INT8_C(  28), -INT8_C( 116), -INT8_C(  56),  INT8_C(  12),  INT8_C(   1),      INT8_MIN,
+        -INT8_C( 104),  INT8_C(  76), -INT8_C( 106),  INT8_C(  49), -INT8_C(  48), -INT8_C(  12), -INT8_C( 100),  INT8_C(  56),
+         INT8_C(  37),  INT8_C(  18),  INT8_C(  82),  INT8_C(   5), -INT8_C(  92),  INT8_C(  66),  INT8_C(  37),  INT8_C(  72),
+         INT8_C(  84), -INT8_C(  30), -INT8_C(  28),  INT8_C(  76),  INT8_C(  11),  INT8_C(  88),  INT8_C(  96), -INT8_C(  68) } },
+    { { -INT8_C(  42), -INT8_C(  51),  INT8_C(  94),  INT8_C(  32),  INT8_C(  76),  INT8_C(  64), -INT8_C(  26), -INT8_C(  17),
+        -INT8_C(  76), -INT8_C(  79), -INT8_C(  62), -INT8_C(  69),  INT8_C(  92), -INT8_C( 116),  INT8_C(  15),  INT8_C(  55),
+         INT8_C(  93), -INT8_C(  91),  INT8_C(   6),  INT8_C(  46),  INT8_C(  32), -INT8_C( 118),  INT8_C( 109),  INT8_C(  89),
+         INT8_C( 113), -INT8_C(  37), -INT8_C(   8), -INT8_C( 121), -INT8_C( 116),  INT8_C( 127),  INT8_C(  59),  INT8_C( 115) },
+      { -INT64_C( 3525308488551589591),  INT64_C( 8393768241691726902),  INT64_C( 2981829853702603228),  INT64_C( 3434748938645795011) },
+      {  INT8_C(  32), -INT8_C(  76),  INT8_C( 110), -INT8_C( 101),  INT8_C( 105),  INT8_C(  41),  INT8_C(  90),  INT8_C(  39),
+         INT8_C(  71),  INT8_C(  62),  INT8_C(  13), -INT8_C(  50), -INT8_C(  26), -INT8_C(  39), -INT8_C(   5), -INT8_C(  24),
+        -INT8_C(  96), -INT8_C(  77),  INT8_C(   7), -INT8_C( 122),  INT8_C( 116),  INT8_C(  80),  INT8_C(  12),  INT8_C(  13),
+        -INT8_C(  43), -INT8_C(  59),  INT8_C(  47), -INT8_C(  31),  INT8_C(  31), -INT8_C( 122),  INT8_C( 101), -INT8_C(  11) } },
+    { { -INT8_C(   6),  INT8_C(  21),  INT8_C(  63),  INT8_C(  81), -INT8_C(  21), -INT8_C( 122),  INT8_C( 107), -INT8_C( 125),
+         INT8_C(  24), -INT8_C(  30),  INT8_C(  59), -INT8_C(  43), -INT8_C(  94),  INT8_C(  61),  INT8_C(  93), -INT8_C(  31),
+        -INT8_C( 120),  INT8_C(  99),  INT8_C(  77),  INT8_C(  73), -INT8_C(   7), -INT8_C(  40),  INT8_C(  87),  INT8_C(  43),
+         INT8_C(  87), -INT8_C(  81),  INT8_C( 116), -INT8_C(  82),  INT8_C(  83),  INT8_C( 103),  INT8_C(  27), -INT8_C(  17) },
+      {  INT64_C(  520458468194195254),  INT64_C( 2175833584962444587),  INT64_C( 1312813684386111523),  INT64_C( 4471838220505323778) },
+      { -INT8_C( 127),  INT8_C(  40),  INT8_C( 108), -INT8_C( 121),  INT8_C(  33),  INT8_C(  92),  INT8_C(  33), -INT8_C(  26),
+         INT8_C(  18),  INT8_C(  71),  INT8_C(  99), -INT8_C( 112),  INT8_C(  71),  INT8_C(  88), -INT8_C(  16), -INT8_C( 113),
+         INT8_C(  32), -INT8_C(  94), -INT8_C(  39), -INT8_C( 112), -INT8_C( 119),  INT8_C(  34),  INT8_C(  68),  INT8_C(   1),
+         INT8_C( 100),  INT8_C(  30), -INT8_C(  32),  INT8_C(  60),  INT8_C(  71),  INT8_C(  82),  INT8_C( 102),  INT8_C(  30) } },
+    { {  INT8_C(  93),  INT8_C(  55),  INT8_C(  87), -INT8_C(  73), -INT8_C( 106),  INT8_C(  83),  INT8_C(  49),  INT8_C(  69),
+         INT8_C(  43), -INT8_C(  57), -INT8_C(  50), -INT8_C(  91), -INT8_C( 114),  INT8_C(  69), -INT8_C(  73), -INT8_C(  78),
+         INT8_C(  29), -INT8_C(  35),  INT8_C(  62),  INT8_C(  58),  INT8_C(  94), -INT8_C(  46),  INT8_C( 111), -INT8_C(  55),
+         INT8_C( 126), -INT8_C(  44),  INT8_C(  65), -INT8_C(  99), -INT8_C( 104),  INT8_C(  23), -INT8_C(  99), -INT8_C( 104) },
+      { -INT64_C( 9167902196916977058),  INT64_C( 1926775272026376335), -INT64_C( 4710939492786316344), -INT64_C( 7495664827117727599) },
+      {  INT8_C(  52),  INT8_C(   1),  INT8_C(  18),  INT8_C(   1),  INT8_C(  36),  INT8_C(  39),  INT8_C(  98),  INT8_C(  18),
+        -INT8_C(  88),  INT8_C(  17), -INT8_C( 114),  INT8_C(  63), -INT8_C( 114),  INT8_C(  68),  INT8_C(  53), -INT8_C(  81),
+        -INT8_C(  19), -INT8_C(  19),  INT8_C(  34),  INT8_C(  47), -INT8_C(  10), -INT8_C( 121),  INT8_C(  62),  INT8_C( 109),
+         INT8_C(  70),  INT8_C(   4),  INT8_C(  72),  INT8_C( 109), -INT8_C(  80),  INT8_C(  96),  INT8_C( 109), -INT8_C(  80) } },
+    { { -INT8_C(  53), -INT8_C(  56),  INT8_C(  85),  INT8_C(  95), -INT8_C(  65),  INT8_C(  44), -INT8_C(  44),  INT8_C(  11),
+         INT8_C( 111), -INT8_C(  93), -INT8_C(  96),  INT8_C(  31),  INT8_C(  77), -INT8_C(  25), -INT8_C(  96),  INT8_C( 119),
+         INT8_C(  35), -INT8_C(  85),  INT8_C( 112), -INT8_C(  36),  INT8_C(  83), -INT8_C(  31),  INT8_C(  92), -INT8_C(  50),
+        -INT8_C(  93), -INT8_C(  42),  INT8_C(  67),  INT8_C(  41),  INT8_C( 117), -INT8_C(  27), -INT8_C(  74), -INT8_C(  49) },
+      {  INT64_C(  588595100436670472),  INT64_C( 1228383187468163360),  INT64_C( 1812426377395976202),  INT64_C( 3898724226858028594) },
+      {  INT8_C(   5),  INT8_C(  40), -INT8_C(  80),  INT8_C(  64),  INT8_C(  16), -INT8_C(  79),  INT8_C(  97),  INT8_C(   5),
+         INT8_C(  24),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  48),  INT8_C(  48),  INT8_C(   0),  INT8_C(  34),
+         INT8_C(   6), -INT8_C(  31),  INT8_C(  39),  INT8_C(   0), -INT8_C(  57),  INT8_C(  24),  INT8_C(   0), -INT8_C(  16),
+        -INT8_C(  96), -INT8_C(  84), -INT8_C(  58), -INT8_C( 122), -INT8_C(  80),  INT8_C( 104), -INT8_C(  40),  INT8_C(  42) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i r = simde_mm256_multishift_epi64_epi8(a, b);
+    simde_test_x86_assert_equal_i8x32(r, simde_x_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_multishift_epi64_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[32];
+    const simde__mmask32 k;
+    const int8_t a[32];
+    const int64_t b[4];
+    const int8_t r[32];
+  } test_vec[] = {
+    { {  INT8_C( 126),  INT8_C(  24), -INT8_C(  58),  INT8_C(  51),  INT8_C(  41), -INT8_C(  81), -INT8_C(  34), -INT8_C(  29),
+        -INT8_C( 114),  INT8_C( 105), -INT8_C(  53),  INT8_C( 120), -INT8_C(  54),  INT8_C(  53),  INT8_C(  67), -INT8_C(  61),
+         INT8_C(  18), -INT8_C(  62),  INT8_C(  73), -INT8_C(  51), -INT8_C(  56),  INT8_C(  49),  INT8_C(   7), -INT8_C(  95),
+         INT8_C(   0),  INT8_C(  22), -INT8_C( 120),  INT8_C(  51),  INT8_C(  33), -INT8_C( 127), -INT8_C(   2), -INT8_C(  53) },
+      UINT32_C( 391944524),
+      { -INT8_C(  86), -INT8_C(  97), -INT8_C(  30), -INT8_C(  11),  INT8_C( 118), -INT8_C( 116), -INT8_C( 111), -INT8_C(  80),
+        -INT8_C(  93), -INT8_C(  58),  INT8_C(  79),  INT8_C(  23), -INT8_C(  39), -INT8_C(  38),  INT8_C( 123), -INT8_C(  57),
+         INT8_C( 118), -INT8_C(  66),  INT8_C(  73),  INT8_C( 125),  INT8_C(  37), -INT8_C(  21),  INT8_C(  24),  INT8_C(  10),
+         INT8_C(  82), -INT8_C( 108),  INT8_C(  61),  INT8_C( 121), -INT8_C(  71),  INT8_C(  54), -INT8_C(  44),  INT8_C( 121) },
+      { -INT64_C( 2380741429490933776), -INT64_C( 8989320918382897911),  INT64_C( 5389991850219633612),  INT64_C( 3510328498835437176) },
+      {  INT8_C( 126),  INT8_C(  24),  INT8_C(  18), -INT8_C(   9),  INT8_C(  41), -INT8_C(  81), -INT8_C( 111), -INT8_C(  29),
+        -INT8_C( 120),  INT8_C( 105), -INT8_C(  53),  INT8_C(  31),  INT8_C(  71),  INT8_C(  53),  INT8_C(  67),  INT8_C(  42),
+         INT8_C(  18), -INT8_C(  62), -INT8_C(  67),  INT8_C(  98), -INT8_C(  56),  INT8_C(  49), -INT8_C(  58), -INT8_C(  95),
+        -INT8_C( 127),  INT8_C(  32), -INT8_C(  63),  INT8_C(  51),  INT8_C(  24), -INT8_C( 127), -INT8_C(   2), -INT8_C(  53) } },
+    { { -INT8_C(  94),  INT8_C(  87), -INT8_C(  67),  INT8_C( 110),  INT8_C(  40),  INT8_C(  48), -INT8_C( 102),  INT8_C(  85),
+        -INT8_C(  97), -INT8_C( 116), -INT8_C( 103),  INT8_C( 104),  INT8_C( 122),  INT8_C( 112), -INT8_C(  48), -INT8_C(  41),
+         INT8_C( 116),  INT8_C(  12),  INT8_C(  76), -INT8_C( 106), -INT8_C(  61),  INT8_C(  74), -INT8_C(  76), -INT8_C(   7),
+        -INT8_C(  30),  INT8_C( 123), -INT8_C(  21),  INT8_C(  40), -INT8_C( 108), -INT8_C(  43), -INT8_C(  84), -INT8_C(  41) },
+      UINT32_C(2515534821),
+      {  INT8_C(  39),  INT8_C(  11),  INT8_C(   9),  INT8_C(  39),  INT8_C(   1),  INT8_C(  12),  INT8_C(  49),  INT8_C(  35),
+         INT8_C(  36),  INT8_C(  41),  INT8_C(  62),  INT8_C(  30),  INT8_C(  18),  INT8_C(   3),  INT8_C(   4),  INT8_C(  34),
+         INT8_C(  53),  INT8_C(  35),  INT8_C(  45),  INT8_C(   2),  INT8_C(   0),  INT8_C(  29),  INT8_C(  57),  INT8_C(  30),
+         INT8_C(  59),  INT8_C(  14),  INT8_C(  43),  INT8_C(  42),  INT8_C(  62),  INT8_C(   2),  INT8_C(  38),  INT8_C(  40) },
+      {  INT64_C( 5400185288750362437),  INT64_C( 8834232429968637504), -INT64_C( 7585862768895646754),  INT64_C( 7463702970030506183) },
+      { -INT8_C(  97),  INT8_C(  87), -INT8_C(  73),  INT8_C( 110),  INT8_C(  40),  INT8_C(  22),  INT8_C( 120), -INT8_C(   3),
+        -INT8_C(   7), -INT8_C(  65), -INT8_C( 103),  INT8_C( 104),  INT8_C( 122),  INT8_C( 112), -INT8_C(  48), -INT8_C(  41),
+         INT8_C( 116),  INT8_C(  12),  INT8_C(  76), -INT8_C( 106), -INT8_C(  34),  INT8_C(   6),  INT8_C(  75),  INT8_C(   3),
+        -INT8_C(  20),  INT8_C( 123), -INT8_C( 116),  INT8_C(  40),  INT8_C(  29), -INT8_C(  43), -INT8_C(  84),  INT8_C( 102) } },
+    { {  INT8_C(  33),  INT8_C(  29),  INT8_C( 111), -INT8_C(   3), -INT8_C(  92), -INT8_C(  47), -INT8_C(  86),  INT8_C(   1),
+         INT8_C( 125),  INT8_C( 119),  INT8_C( 111),  INT8_C(  19),  INT8_C( 117), -INT8_C( 107),  INT8_C(  52),  INT8_C(  48),
+        -INT8_C(  38), -INT8_C(  13), -INT8_C( 102), -INT8_C( 121), -INT8_C( 110),  INT8_C( 127),  INT8_C(  23),  INT8_C(  67),
+        -INT8_C( 117),  INT8_C(  74), -INT8_C( 118),  INT8_C(  15),  INT8_C(  23),  INT8_C(  21),  INT8_C( 117), -INT8_C(  47) },
+      UINT32_C(3163601429),
+      { -INT8_C(  36),  INT8_C(  85), -INT8_C( 127), -INT8_C(  52),  INT8_C(  15), -INT8_C(  43), -INT8_C(  40),  INT8_C(  55),
+         INT8_C(  29),  INT8_C(  91), -INT8_C(  13), -INT8_C(  68),  INT8_C(  15), -INT8_C(  25), -INT8_C(  28),  INT8_C(  35),
+        -INT8_C(  29),  INT8_C(  26),  INT8_C(   0),  INT8_C(  44), -INT8_C(  24), -INT8_C( 109), -INT8_C(  54), -INT8_C( 117),
+             INT8_MIN, -INT8_C(  11), -INT8_C(  44), -INT8_C(   9),  INT8_C( 106),  INT8_C(  58), -INT8_C(  18),  INT8_C(  77) },
+      { -INT64_C( 2485900265507562659),  INT64_C( 7476035141723707892),  INT64_C( 8987778956459076959), -INT64_C(  559008273883860986) },
+      {  INT8_C(  17),  INT8_C(  29), -INT8_C(  82), -INT8_C(   3), -INT8_C(  66), -INT8_C(  47), -INT8_C(  86),  INT8_C(   1),
+         INT8_C( 125),  INT8_C(  64),  INT8_C( 111),  INT8_C(  70), -INT8_C( 114),  INT8_C( 108),  INT8_C(  52), -INT8_C(  53),
+        -INT8_C(  38), -INT8_C(  13), -INT8_C( 102), -INT8_C( 121),  INT8_C(   1),  INT8_C( 127),  INT8_C(  23),  INT8_C(  45),
+        -INT8_C( 117),  INT8_C(  74), -INT8_C( 118), -INT8_C(  16),      INT8_MIN, -INT8_C(  66),  INT8_C( 117),  INT8_C(  47) } },
+    { {  INT8_C(   4),  INT8_C(  90), -INT8_C(  66),  INT8_C(  45),  INT8_C(  33),  INT8_C(   7), -INT8_C(  11),  INT8_C(  46),
+         INT8_C(  80),  INT8_C(  96), -INT8_C(  40), -INT8_C(  67),  INT8_C( 106),  INT8_C(   2), -INT8_C(  56), -INT8_C(  65),
+         INT8_C(  94),  INT8_C(  38),  INT8_C(  36),  INT8_C(   8),  INT8_C(  40), -INT8_C(  18),  INT8_C(  29), -INT8_C(  39),
+        -INT8_C(  36), -INT8_C(  97), -INT8_C(  78), -INT8_C(  57),  INT8_C( 112), -INT8_C(  14),  INT8_C(  51), -INT8_C(  97) },
+      UINT32_C(1447701596),
+      {  INT8_C(   5),  INT8_C(   1),  INT8_C(  44),  INT8_C(  30),  INT8_C(  39),  INT8_C(  62),  INT8_C(  48),  INT8_C(   9),
+         INT8_C(  56),  INT8_C(  38),  INT8_C(  57),  INT8_C(   4),  INT8_C(  28),  INT8_C(  41),  INT8_C(  18),  INT8_C(  25),
+         INT8_C(  12),  INT8_C(  30),  INT8_C(  34),  INT8_C(   4),  INT8_C(  39),  INT8_C(  52),  INT8_C(  58),  INT8_C(   8),
+         INT8_C(  14),  INT8_C(  35),  INT8_C(  23),  INT8_C(  28),  INT8_C(  51),  INT8_C(  23),  INT8_C(  37),  INT8_C(  11) },
+      { -INT64_C( 6509313281718889394),  INT64_C( 8530453940025699860), -INT64_C( 2412414296678083028), -INT64_C( 5918049023522754363) },
+      {  INT8_C(   4),  INT8_C(  90), -INT8_C(  92),  INT8_C(  59), -INT8_C( 116),  INT8_C(   7), -INT8_C(  86),  INT8_C(  46),
+         INT8_C(  80),  INT8_C(  96),  INT8_C(  59), -INT8_C(  31),  INT8_C( 106),  INT8_C(  33), -INT8_C(  56), -INT8_C(  65),
+         INT8_C(  94), -INT8_C(  22),  INT8_C(  36),  INT8_C(  98),  INT8_C(  40), -INT8_C(  18),  INT8_C(  55), -INT8_C(  39),
+        -INT8_C(  36), -INT8_C(  72),  INT8_C(  91), -INT8_C(  57), -INT8_C(  69), -INT8_C(  14), -INT8_C(  18), -INT8_C(  97) } },
+    { {  INT8_C(  21),  INT8_C(  67),  INT8_C(  63), -INT8_C(  87),  INT8_C(  64),  INT8_C(  82), -INT8_C(  44),  INT8_C( 119),
+         INT8_C(  33),  INT8_C(  43), -INT8_C(  87),  INT8_C(  22), -INT8_C(  78),  INT8_C(  77), -INT8_C( 113), -INT8_C(  96),
+         INT8_C(   1), -INT8_C( 127),  INT8_C(  12),  INT8_C(  98), -INT8_C( 124), -INT8_C(  97), -INT8_C(  30),  INT8_C(  85),
+         INT8_C(  55), -INT8_C( 121),  INT8_C(  74), -INT8_C(  44), -INT8_C(  45),  INT8_C(  72), -INT8_C(  98),  INT8_C(   1) },
+      UINT32_C(2728232537),
+      {  INT8_C(  56),  INT8_C(  62),  INT8_C(  28), -INT8_C(  92), -INT8_C(  53),  INT8_C(  78),  INT8_C(  54),  INT8_C(  92),
+        -INT8_C(  84), -INT8_C(  11), -INT8_C(   4), -INT8_C( 111), -INT8_C(  42), -INT8_C(   9),  INT8_C(  18), -INT8_C(  56),
+         INT8_C(  63),  INT8_C(  95),  INT8_C(  41),  INT8_C(  87), -INT8_C(  71),  INT8_C(  98), -INT8_C(  90), -INT8_C(  87),
+        -INT8_C( 122),  INT8_C(  49), -INT8_C( 107), -INT8_C(  66), -INT8_C( 117),  INT8_C(  84),  INT8_C(  26),  INT8_C( 120) },
+      {  INT64_C(  323955382621583069),  INT64_C( 6198284999372597306), -INT64_C( 4669912113523467664),  INT64_C( 3559531428928869826) },
+      {  INT8_C(   4),  INT8_C(  67),  INT8_C(  63), -INT8_C(  69), -INT8_C( 122),  INT8_C(  82),  INT8_C(  17),  INT8_C( 119),
+         INT8_C(  33), -INT8_C(  80), -INT8_C(  91),  INT8_C(  22), -INT8_C(  78),  INT8_C(  77), -INT8_C( 113),  INT8_C( 104),
+        -INT8_C(  31), -INT8_C( 127), -INT8_C( 111), -INT8_C( 102),  INT8_C(  95), -INT8_C(  97), -INT8_C(  30), -INT8_C( 111),
+         INT8_C(  55), -INT8_C(  78),  INT8_C(  74), -INT8_C(  44), -INT8_C(  45),  INT8_C(  66), -INT8_C(  98),  INT8_C(  49) } },
+    { {  INT8_C(  12), -INT8_C(  82),  INT8_C( 121),  INT8_C(  65),  INT8_C(  47), -INT8_C( 127),  INT8_C(  12), -INT8_C( 120),
+         INT8_C(  97), -INT8_C( 117),  INT8_C(   8),  INT8_C(  58), -INT8_C(  92), -INT8_C(  81),  INT8_C(  78),  INT8_C(   4),
+        -INT8_C(  14),  INT8_C(  17),  INT8_C(  27),  INT8_C(  21),  INT8_C(  77), -INT8_C(  23), -INT8_C( 112),  INT8_C(  27),
+         INT8_C(  17),  INT8_C(  63), -INT8_C(  33), -INT8_C(  94),  INT8_C(  45),  INT8_C( 105), -INT8_C( 107),  INT8_C(  12) },
+      UINT32_C(2607520255),
+      {  INT8_C(  40),  INT8_C(  11),  INT8_C(  55),  INT8_C(  20),  INT8_C(   5),  INT8_C(   4),  INT8_C(  62),  INT8_C(  18),
+         INT8_C(  39),  INT8_C(  34),  INT8_C(   7),  INT8_C(  27),  INT8_C(  31),  INT8_C(  13),  INT8_C(  18),  INT8_C(  23),
+         INT8_C(  45),  INT8_C(   0),  INT8_C(   1),  INT8_C(  33),  INT8_C(  29),  INT8_C(   5),  INT8_C(  39),  INT8_C(  36),
+         INT8_C(  56),  INT8_C(  54),  INT8_C(  10),  INT8_C(   7),  INT8_C(   0),  INT8_C(  55),  INT8_C(  57),  INT8_C(  26) },
+      { -INT64_C( 7536369870033024968), -INT64_C( 4185848369227028008),  INT64_C( 4085721085090490474), -INT64_C( 4497728368900250736) },
+      {  INT8_C( 111),  INT8_C(  49),  INT8_C(  46), -INT8_C( 117),  INT8_C(  65), -INT8_C( 125), -INT8_C(  30),  INT8_C(  46),
+        -INT8_C(  62), -INT8_C( 117),  INT8_C(   8), -INT8_C(  66),  INT8_C(  43), -INT8_C(  81),  INT8_C(  78), -INT8_C(  23),
+        -INT8_C( 101),  INT8_C( 106),  INT8_C(  27), -INT8_C(  41),  INT8_C(  77),  INT8_C(  67), -INT8_C(  53),  INT8_C(  27),
+        -INT8_C(  63),  INT8_C(   6), -INT8_C(  33), -INT8_C(  57), -INT8_C( 112),  INT8_C( 105), -INT8_C( 107),  INT8_C(  56) } },
+    { {  INT8_C(  69), -INT8_C(  25),  INT8_C(  24), -INT8_C( 124), -INT8_C(  77), -INT8_C(  52), -INT8_C(  21), -INT8_C( 114),
+        -INT8_C(  13), -INT8_C(  66),  INT8_C(  27), -INT8_C( 123),  INT8_C(  26),  INT8_C(   6),  INT8_C(  76), -INT8_C(  52),
+        -INT8_C(  97), -INT8_C(  46), -INT8_C(  79),  INT8_C(  48),  INT8_C( 122),  INT8_C(  28),  INT8_C(  74),  INT8_C( 110),
+         INT8_C( 108),  INT8_C( 112),  INT8_C(  88), -INT8_C(   6),  INT8_C(  75),  INT8_C(  13), -INT8_C(  27), -INT8_C(  14) },
+      UINT32_C(3393314111),
+      {  INT8_C(  10),  INT8_C(  96), -INT8_C(  30), -INT8_C(  85), -INT8_C(  40), -INT8_C(  87),  INT8_C(  38),  INT8_C(  32),
+        -INT8_C(  56), -INT8_C(  35),  INT8_C(  34),  INT8_C(  40),  INT8_C(  24),  INT8_C(   6), -INT8_C(  34),  INT8_C( 109),
+         INT8_C( 121),  INT8_C(  35),  INT8_C(  53),  INT8_C(  85), -INT8_C(  41), -INT8_C(  56), -INT8_C(  53), -INT8_C(  32),
+         INT8_C(  39), -INT8_C( 113),  INT8_C(  42), -INT8_C(  64), -INT8_C(  37),  INT8_C(  44),  INT8_C(  22), -INT8_C(  68) },
+      {  INT64_C( 2110394677252276997),  INT64_C( 3689436508754467621), -INT64_C( 3913524146795915949), -INT64_C( 7756707726730666578) },
+      { -INT8_C(  48), -INT8_C(  57),  INT8_C(  49),  INT8_C(  52),  INT8_C(  17), -INT8_C(  48), -INT8_C(  21), -INT8_C( 114),
+        -INT8_C(  37), -INT8_C(  66), -INT8_C(  67), -INT8_C( 126),  INT8_C(  13),  INT8_C(   6), -INT8_C(  44), -INT8_C( 100),
+        -INT8_C(  28), -INT8_C(  46), -INT8_C(  79),  INT8_C(  48),  INT8_C( 122),  INT8_C(  28),  INT8_C(  26),  INT8_C( 110),
+         INT8_C( 108),  INT8_C(  97),  INT8_C(  88), -INT8_C(  82),  INT8_C(  75),  INT8_C(  13),  INT8_C( 102), -INT8_C(  23) } },
+    { { -INT8_C(  65), -INT8_C(  50),  INT8_C(  61), -INT8_C(  41),  INT8_C( 104), -INT8_C(  12),  INT8_C(  37),  INT8_C(  55),
+         INT8_C(  35), -INT8_C(  35),  INT8_C( 114),  INT8_C(  40),  INT8_C(  54),  INT8_C( 112), -INT8_C(  40), -INT8_C( 115),
+         INT8_C(  20),  INT8_C(  26), -INT8_C(  50),  INT8_C(  25), -INT8_C( 125), -INT8_C(  94),  INT8_C(  83),  INT8_C(   3),
+         INT8_C( 121), -INT8_C( 123),  INT8_C(  28),  INT8_C(  18), -INT8_C(  24),  INT8_C(  79),  INT8_C(  31),  INT8_C(   7) },
+      UINT32_C( 136770329),
+      {  INT8_C(   9),  INT8_C(  16),  INT8_C(  58),  INT8_C(   3),  INT8_C(  14),  INT8_C(  20),  INT8_C(  39),  INT8_C(   3),
+         INT8_C(   5),  INT8_C(   3),  INT8_C(  19),  INT8_C(  12),  INT8_C(  26),  INT8_C(  13),  INT8_C(  56),  INT8_C(  41),
+         INT8_C(  25),  INT8_C(  21),  INT8_C(  15),  INT8_C(  46),  INT8_C(  53),  INT8_C(  59),  INT8_C(  31),  INT8_C(  36),
+         INT8_C(  33),  INT8_C(  39),  INT8_C(  37),  INT8_C(  39),  INT8_C(  28),  INT8_C(  19),  INT8_C(  39),  INT8_C(  15) },
+      { -INT64_C( 2513633051707242703), -INT64_C( 8596388947611111412), -INT64_C( 7881489204731195199), -INT64_C(  904213726372732663) },
+      { -INT8_C( 125), -INT8_C(  50),  INT8_C(  61), -INT8_C(  26),  INT8_C(  60), -INT8_C(  12),  INT8_C(  37),  INT8_C(  55),
+             INT8_MIN,  INT8_C(   1),  INT8_C( 114),  INT8_C(  40),  INT8_C(  14),  INT8_C(  93), -INT8_C( 120), -INT8_C(  66),
+         INT8_C(  20),  INT8_C(  23), -INT8_C(  41),  INT8_C(  25), -INT8_C( 125),  INT8_C(  50),  INT8_C(  83),  INT8_C(   3),
+         INT8_C( 121), -INT8_C( 123),  INT8_C(  28),  INT8_C(  44), -INT8_C(  24),  INT8_C(  79),  INT8_C(  31),  INT8_C(   7) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi8(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i r = simde_mm256_mask_multishift_epi64_epi8(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i8x32(r, simde_x_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_multishift_epi64_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 k;
+    const int8_t a[32];
+    const int64_t b[4];
+    const int8_t r[32];
+  } test_vec[] = {
+    { UINT32_C( 240180463),
+      { -INT8_C( 106),  INT8_C(  91),  INT8_C(  55),  INT8_C( 111), -INT8_C(  15), -INT8_C(  22),  INT8_C(  47),  INT8_C(  73),
+        -INT8_C(  45), -INT8_C(  84),  INT8_C(  31),  INT8_C(   7),  INT8_C(  57), -INT8_C(  63), -INT8_C(  38), -INT8_C(  93),
+         INT8_C(  12), -INT8_C( 102),  INT8_C(  95), -INT8_C(  23),  INT8_C(  64),  INT8_C(  14),  INT8_C( 118), -INT8_C(  72),
+         INT8_C(  43), -INT8_C(   9),  INT8_C( 120), -INT8_C(  24), -INT8_C(  77),  INT8_C(  88), -INT8_C(  48),  INT8_C(  25) },
+      { -INT64_C( 1817289529274486834), -INT64_C( 2604153058960047349),  INT64_C( 3161794256709357676),  INT64_C( 5384500517644495173) },
+      { -INT8_C(  58), -INT8_C(  90), -INT8_C(  51), -INT8_C( 113),  INT8_C(   0), -INT8_C(  20), -INT8_C( 113),  INT8_C(  87),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  46),  INT8_C(   6), -INT8_C(  19),  INT8_C(   0), -INT8_C(  58),  INT8_C(  18),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 108),  INT8_C(   0), -INT8_C(  81),  INT8_C(   0),
+         INT8_C(   0), -INT8_C( 107),  INT8_C(  74), -INT8_C( 106),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(3836590549),
+      { -INT8_C(  26),  INT8_C(   9), -INT8_C(  91), -INT8_C( 106), -INT8_C( 109), -INT8_C(   8), -INT8_C(  29), -INT8_C(  94),
+        -INT8_C(  13), -INT8_C(  52),  INT8_C(  99), -INT8_C( 115),  INT8_C(   6),  INT8_C( 126), -INT8_C(   6),  INT8_C(  19),
+         INT8_C( 115), -INT8_C(  35),  INT8_C(  82),  INT8_C(  66), -INT8_C(  68),  INT8_C(  81), -INT8_C(  87), -INT8_C( 120),
+         INT8_C(  27), -INT8_C(   1),  INT8_C(  70),  INT8_C(  86), -INT8_C(  48), -INT8_C(  47),  INT8_C(  48),  INT8_C( 102) },
+      {  INT64_C(  368520185614182682),  INT64_C(  868678103884903706),  INT64_C(  229182289812531505),  INT64_C( 1815811800337365301) },
+      { -INT8_C(   4),  INT8_C(   0), -INT8_C(   7),  INT8_C(   0), -INT8_C( 125),  INT8_C(   0), -INT8_C(  27), -INT8_C(  54),
+        -INT8_C( 127),  INT8_C(   0),  INT8_C(   0), -INT8_C(  63), -INT8_C(  44),  INT8_C( 104),  INT8_C(   0), -INT8_C(  57),
+         INT8_C( 101),  INT8_C(   0),  INT8_C(  69),  INT8_C(  76),  INT8_C(   0), -INT8_C( 117),  INT8_C(   0),  INT8_C(  41),
+         INT8_C(   0),  INT8_C(   0), -INT8_C(  28),  INT8_C(   0),  INT8_C(   0),  INT8_C(   9),  INT8_C(  51),  INT8_C(  60) } },
+    { UINT32_C( 913723776),
+      {  INT8_C(  35),  INT8_C(  89),  INT8_C(  17), -INT8_C(   3),  INT8_C(  30),  INT8_C(   0), -INT8_C(   2),  INT8_C( 117),
+         INT8_C(  15), -INT8_C(  39), -INT8_C(  48), -INT8_C( 109), -INT8_C(  74),  INT8_C(  77), -INT8_C(  13), -INT8_C(  20),
+        -INT8_C(  87), -INT8_C(  16), -INT8_C(  57), -INT8_C(  96),  INT8_C(  69),  INT8_C(   5), -INT8_C(  91),  INT8_C( 120),
+         INT8_C(  12),  INT8_C(  64),  INT8_C( 124), -INT8_C(  28),  INT8_C(  71),  INT8_C(  81), -INT8_C( 125),  INT8_C(  68) },
+      { -INT64_C( 2021289987685992769),  INT64_C(  834506283883714650),  INT64_C( 7983516418247647447),  INT64_C( 1738043313936392194) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  31),
+         INT8_C( 112),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  46),  INT8_C(   0),  INT8_C( 114),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(  53), -INT8_C(  63),  INT8_C(   0),  INT8_C(   6),  INT8_C(   6),  INT8_C(  47),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   2),  INT8_C(  33),  INT8_C(   0), -INT8_C(  64), -INT8_C(  75),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT32_C(3388663129),
+      { -INT8_C(  45), -INT8_C(  34),  INT8_C(  79),  INT8_C(  69),  INT8_C(  81), -INT8_C( 111), -INT8_C(  98),  INT8_C(  19),
+         INT8_C(  25), -INT8_C(  87), -INT8_C(  54), -INT8_C(  13),  INT8_C( 124), -INT8_C(  50), -INT8_C( 115), -INT8_C(  84),
+         INT8_C(  91),  INT8_C(  15), -INT8_C(  39),  INT8_C( 122), -INT8_C(  98), -INT8_C(  33), -INT8_C(  98),  INT8_C(  11),
+        -INT8_C(  31), -INT8_C(  48), -INT8_C(  79),  INT8_C(  48),  INT8_C(  70), -INT8_C(  82), -INT8_C(  27),  INT8_C( 124) },
+      {  INT64_C( 4324922399733199149),  INT64_C( 3901550160654893328),  INT64_C(  305418105381533203),  INT64_C( 2745240987756732690) },
+      { -INT8_C(  89),  INT8_C(   0),  INT8_C(   0), -INT8_C( 119), -INT8_C(  99),  INT8_C(   0),  INT8_C(   8),  INT8_C(   0),
+        -INT8_C( 109),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  48), -INT8_C(  96),  INT8_C(  81),
+         INT8_C(   0),  INT8_C( 122),  INT8_C(   0), -INT8_C(  63), -INT8_C( 104),  INT8_C(  76), -INT8_C( 104), -INT8_C(  90),
+         INT8_C(  17),  INT8_C(   0),  INT8_C(   0),  INT8_C(  25),  INT8_C(   0),  INT8_C(   0),  INT8_C( 113),  INT8_C(  34) } },
+    { UINT32_C(1741958629),
+      { -INT8_C(   2), -INT8_C(  57),  INT8_C(   0), -INT8_C(  68), -INT8_C( 123),  INT8_C( 104),  INT8_C( 122), -INT8_C(  96),
+        -INT8_C(  15),  INT8_C(  40), -INT8_C( 114),  INT8_C(  35),  INT8_C( 105), -INT8_C(  51),  INT8_C(  64), -INT8_C(  70),
+         INT8_C(  95), -INT8_C(  37),  INT8_C(  32),  INT8_C( 106),  INT8_C(  68), -INT8_C( 122),  INT8_C( 105), -INT8_C( 101),
+        -INT8_C(  24),  INT8_C(  41), -INT8_C(  87),  INT8_C(  82),  INT8_C(  66),  INT8_C(  22),  INT8_C( 118), -INT8_C( 122) },
+      {  INT64_C( 1786102470837766224),  INT64_C( 4153105603298172974), -INT64_C( 4348099998264824165),  INT64_C( 5365737570654465604) },
+      {  INT8_C(  64),  INT8_C(   0),  INT8_C(  80),  INT8_C(   0),  INT8_C(   0), -INT8_C( 126),  INT8_C(   6), -INT8_C(  69),
+        -INT8_C(  47),  INT8_C(   0),  INT8_C(  22),  INT8_C( 113),  INT8_C(   0),  INT8_C(  45),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  22),  INT8_C(   0), -INT8_C(  23),  INT8_C(   0),  INT8_C(  57), -INT8_C(  41),
+        -INT8_C(  19),  INT8_C( 118),  INT8_C( 118),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3),  INT8_C(  41),  INT8_C(   0) } },
+    { UINT32_C(3904051311),
+      { -INT8_C(  97),  INT8_C(  84),  INT8_C(  14),  INT8_C(   6), -INT8_C(  34), -INT8_C(  49), -INT8_C(  12),  INT8_C(  39),
+        -INT8_C(  75),  INT8_C(  24), -INT8_C( 106), -INT8_C(  29),  INT8_C(  86),  INT8_C( 112), -INT8_C(  68),  INT8_C(  47),
+        -INT8_C(  17), -INT8_C( 112), -INT8_C(  83), -INT8_C(  32),  INT8_C( 125), -INT8_C(   9), -INT8_C(  70), -INT8_C(  51),
+         INT8_C(  34), -INT8_C(  42), -INT8_C(  73), -INT8_C(  62),  INT8_C(  41),  INT8_C( 123),  INT8_C(  81),  INT8_C(   1) },
+      {  INT64_C( 3401090748614254895),  INT64_C( 1890686191987852593),  INT64_C( 3114298645292718340),  INT64_C( 1228654830625826075) },
+      {  INT8_C(   8),  INT8_C(   0),  INT8_C(  20), -INT8_C( 124),  INT8_C(   0),  INT8_C(  10), -INT8_C(  13),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  34),  INT8_C(  28),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C( 112),  INT8_C(  39),  INT8_C(   0),  INT8_C(   0),  INT8_C(  33),  INT8_C(  86),  INT8_C(   0),  INT8_C(  56),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  70),  INT8_C(   0),  INT8_C(  98), -INT8_C( 126), -INT8_C( 115) } },
+    { UINT32_C(1164967786),
+      {  INT8_C(  20),  INT8_C(  96),  INT8_C(  96), -INT8_C( 112),  INT8_C(   1),  INT8_C(  77),  INT8_C(  37),  INT8_C(  27),
+        -INT8_C( 125),  INT8_C(  34),  INT8_C(  52),  INT8_C(  66),  INT8_C( 112),  INT8_C(  80),  INT8_C( 120), -INT8_C(  66),
+        -INT8_C(  43),  INT8_C( 118),  INT8_C(  54), -INT8_C(  38), -INT8_C( 125),  INT8_C( 126),  INT8_C(  66),  INT8_C(  84),
+         INT8_C(  64), -INT8_C(  14),  INT8_C(  51),  INT8_C(  15),  INT8_C(  39), -INT8_C(  29), -INT8_C( 108), -INT8_C(  99) },
+      { -INT64_C( 2564794982272834339),  INT64_C( 6512902667257211261),  INT64_C( 4369041783006542862),  INT64_C( 7542949143520121308) },
+      {  INT8_C(   0), -INT8_C( 115),  INT8_C(   0), -INT8_C(  20),  INT8_C(   0),  INT8_C(  99),  INT8_C(  36),  INT8_C(   0),
+         INT8_C(  47), -INT8_C(  98), -INT8_C(  90),  INT8_C(  95),  INT8_C(  98), -INT8_C( 113),  INT8_C(  90), -INT8_C(  11),
+        -INT8_C(  25), -INT8_C(  14), -INT8_C(  14), -INT8_C(  97),  INT8_C(   0),  INT8_C(  56),  INT8_C(   3),  INT8_C(   0),
+        -INT8_C(  36),  INT8_C(   0),  INT8_C(  21),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  37),  INT8_C(   0) } },
+    { UINT32_C(4188905862),
+      {  INT8_C(  69), -INT8_C(  77),  INT8_C(  22), -INT8_C(  74),  INT8_C(   9), -INT8_C(   3), -INT8_C( 116), -INT8_C(  75),
+        -INT8_C(  90),  INT8_C(  69), -INT8_C(  11),  INT8_C(  10),  INT8_C(  26), -INT8_C( 122),  INT8_C(  91), -INT8_C( 107),
+         INT8_C( 100), -INT8_C(  52),  INT8_C(  51),  INT8_C(  27),  INT8_C( 107),  INT8_C(  61),  INT8_C(   9), -INT8_C(  73),
+         INT8_C(  46), -INT8_C( 102), -INT8_C(  99),  INT8_C(  84), -INT8_C(  84),  INT8_C(  87), -INT8_C(   1), -INT8_C( 114) },
+      {  INT64_C( 3255305634555372093),  INT64_C( 3836513966616551943),  INT64_C( 4190945993359436319),  INT64_C(  216488609229573392) },
+      {  INT8_C(   0), -INT8_C(  91), -INT8_C(  68),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C( 105),
+         INT8_C(  36),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 120),  INT8_C(   0), -INT8_C(  32),
+        -INT8_C(  78),  INT8_C(   0),  INT8_C(  69), -INT8_C(  92),  INT8_C(   0), -INT8_C(   7),  INT8_C(   0),  INT8_C( 116),
+         INT8_C(   4),  INT8_C(   0),  INT8_C(   0), -INT8_C(  80),  INT8_C(  17),  INT8_C( 118),  INT8_C(  32),  INT8_C(  48) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i r = simde_mm256_maskz_multishift_epi64_epi8(test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i8x32(r, simde_x_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_multishift_epi64_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[64];
+    const int64_t b[8];
+    const int8_t r[64];
+  } test_vec[] = {
+    { {  INT8_C(  42),  INT8_C(  66), -INT8_C(  50),  INT8_C(  27),  INT8_C(  21),  INT8_C( 115),  INT8_C( 121), -INT8_C(  11),
+        -INT8_C(  48), -INT8_C(  33),  INT8_C(  14),  INT8_C(  62),  INT8_C(  40),  INT8_C(  24), -INT8_C( 108),  INT8_C( 101),
+         INT8_C( 123), -INT8_C( 101),  INT8_C( 106),  INT8_C(  74), -INT8_C(  28), -INT8_C(  91),  INT8_C(  64),  INT8_C(  40),
+         INT8_C( 112), -INT8_C(  58), -INT8_C(  67),  INT8_C(  20), -INT8_C(  66),  INT8_C(  69), -INT8_C( 123),  INT8_C(  74),
+        -INT8_C(   8), -INT8_C(  55), -INT8_C(  64), -INT8_C(  15),  INT8_C(   4), -INT8_C(  42),  INT8_C(  73), -INT8_C(  25),
+        -INT8_C( 126),  INT8_C(   1), -INT8_C( 105),  INT8_C(  26),  INT8_C(   6), -INT8_C(  58), -INT8_C(  73), -INT8_C(  34),
+         INT8_C(  23), -INT8_C(  53), -INT8_C(  66), -INT8_C( 125),  INT8_C( 104), -INT8_C( 118), -INT8_C( 117), -INT8_C(  72),
+        -INT8_C(  11), -INT8_C(  62),  INT8_C( 101),  INT8_C( 111),  INT8_C( 119),  INT8_C(  55), -INT8_C(  81),  INT8_C(  48) },
+      { -INT64_C( 7378394058632692156),  INT64_C( 7087724228780554112), -INT64_C( 2325319970358011362),  INT64_C( 3019703179300799546),
+        -INT64_C( 2527903240296717579),  INT64_C( 7254142727221721923),  INT64_C( 7626343053562849308),  INT64_C( 5546614712328574251) },
+      { -INT8_C(  85), -INT8_C( 111),  INT8_C(  97),  INT8_C(  70), -INT8_C( 110),  INT8_C(  51),  INT8_C(  76), -INT8_C(  52),
+         INT8_C( 100),  INT8_C(  68), -INT8_C( 109),  INT8_C(   1), -INT8_C(  89),  INT8_C(  58), -INT8_C(  90),  INT8_C(  61),
+        -INT8_C(  37), -INT8_C(  45), -INT8_C(  77),  INT8_C(  22), -INT8_C(  36),  INT8_C( 110),  INT8_C(  30), -INT8_C(  51),
+        -INT8_C(  24),  INT8_C(  16), -INT8_C(  47),  INT8_C(  21), -INT8_C(  24),  INT8_C(  33),  INT8_C(  33), -INT8_C(  31),
+        -INT8_C(  36),  INT8_C(  17), -INT8_C(  11),  INT8_C( 117),  INT8_C(  47), -INT8_C(  34),  INT8_C(  17),  INT8_C(  42),
+        -INT8_C(  48), -INT8_C(  95), -INT8_C(  84),  INT8_C(  21), -INT8_C(  19), -INT8_C(  19), -INT8_C(  55), -INT8_C( 127),
+        -INT8_C(  59),  INT8_C(  53),  INT8_C( 113),  INT8_C(   3),  INT8_C(  54),  INT8_C( 106),  INT8_C(  53),  INT8_C( 105),
+         INT8_C( 103),  INT8_C(  74),  INT8_C(  69), -INT8_C(  13), -INT8_C( 103), -INT8_C( 103), -INT8_C(  13), -INT8_C(   7) } },
+    { {  INT8_C(  35),  INT8_C(  73), -INT8_C(  43), -INT8_C(  98),  INT8_C(  83), -INT8_C( 119),  INT8_C( 120),  INT8_C(  32),
+         INT8_C(  24), -INT8_C(  64), -INT8_C( 109), -INT8_C(  44),  INT8_C(  55),  INT8_C( 103),  INT8_C(  97),  INT8_C(   3),
+        -INT8_C(  63), -INT8_C(  30), -INT8_C(  31), -INT8_C(  34), -INT8_C(  89),  INT8_C( 118),  INT8_C(  80), -INT8_C(  32),
+        -INT8_C(  35),  INT8_C(   8),  INT8_C(  84), -INT8_C( 118), -INT8_C(  59), -INT8_C(  24), -INT8_C( 115),  INT8_C(  26),
+        -INT8_C(  78),  INT8_C(  95),  INT8_C(  55), -INT8_C(  79),  INT8_C(  32), -INT8_C(  22),  INT8_C( 107),  INT8_C( 121),
+         INT8_C(  33),  INT8_C(  71), -INT8_C(  53),  INT8_C(  34),  INT8_C( 120), -INT8_C(  56), -INT8_C(   7), -INT8_C(  62),
+         INT8_C(  73), -INT8_C(  47),  INT8_C(  18),  INT8_C( 118),  INT8_C(  58),  INT8_C(  40),  INT8_C(   2),  INT8_C(  42),
+         INT8_C(  84),  INT8_C(  18),  INT8_C(  62),  INT8_C(  30),  INT8_C(  98),  INT8_C(  14),  INT8_C(  56),  INT8_C(  96) },
+      {  INT64_C( 2532499802388563762),  INT64_C( 2106885435780958483),  INT64_C(  657537769476850475),  INT64_C( 2240041713816314896),
+         INT64_C( 2605622772140224786),  INT64_C( 1159700153293145398),  INT64_C( 3763937389956710153),  INT64_C(    8765475225416200) },
+      { -INT8_C(  28),  INT8_C(   3),  INT8_C(  88), -INT8_C( 100),  INT8_C(  99),  INT8_C(   3),  INT8_C(  35),  INT8_C(  39),
+         INT8_C(  30),  INT8_C(  19), -INT8_C(  59), -INT8_C(  30),  INT8_C(  58),  INT8_C(  82), -INT8_C( 110),  INT8_C(  34),
+        -INT8_C( 107), -INT8_C(  57), -INT8_C( 113),  INT8_C( 120),  INT8_C(  22),  INT8_C(  36),  INT8_C(  18),  INT8_C(  30),
+        -INT8_C( 112),  INT8_C(  36), -INT8_C(  95),  INT8_C(   9),  INT8_C(  32),  INT8_C(  58), -INT8_C(  95), -INT8_C( 126),
+         INT8_C(  10),  INT8_C(  54),  INT8_C(  72),  INT8_C(  20),  INT8_C(  27),  INT8_C(  66),  INT8_C(  33),  INT8_C(  18),
+        -INT8_C( 110),  INT8_C(  10),  INT8_C(  32),  INT8_C(  73),  INT8_C(  16),  INT8_C(   5),  INT8_C(   8),  INT8_C(  77),
+         INT8_C(  31), -INT8_C( 105),  INT8_C(  75), -INT8_C(  48),  INT8_C(  77),  INT8_C(  49), -INT8_C(  62),  INT8_C(  12),
+        -INT8_C(  47),  INT8_C(  70),  INT8_C(  32), -INT8_C( 100),  INT8_C(   9),  INT8_C( 100),  INT8_C(   0),  INT8_C(  39) } },
+    { { -INT8_C(   6), -INT8_C( 121), -INT8_C(  26), -INT8_C(  11),  INT8_C(  22),  INT8_C(  40),  INT8_C(  74), -INT8_C(  94),
+         INT8_C(  87), -INT8_C( 119),  INT8_C(  70), -INT8_C(  94), -INT8_C(  93),  INT8_C( 102), -INT8_C(  22),  INT8_C( 117),
+         INT8_C( 109),  INT8_C(  19), -INT8_C(  45),  INT8_C( 102), -INT8_C(  20), -INT8_C(  47), -INT8_C(  76),  INT8_C(  47),
+         INT8_C( 103), -INT8_C(  61), -INT8_C(  88), -INT8_C(  99),  INT8_C( 126),  INT8_C( 112), -INT8_C(  24),  INT8_C(  65),
+        -INT8_C( 121), -INT8_C(  74), -INT8_C( 113), -INT8_C( 124), -INT8_C(  53),  INT8_C( 110),  INT8_C( 102),  INT8_C(  40),
+        -INT8_C(  34), -INT8_C(  91),  INT8_C(  28), -INT8_C( 110), -INT8_C( 111), -INT8_C( 112),  INT8_C(  95), -INT8_C(  25),
+        -INT8_C(  34),  INT8_C(   5),  INT8_C(  81),  INT8_C(  91), -INT8_C(  65), -INT8_C(   8), -INT8_C( 121),  INT8_C(   8),
+         INT8_C(   8), -INT8_C(  88),  INT8_C( 127), -INT8_C(  35), -INT8_C(  30), -INT8_C(  31),      INT8_MIN,  INT8_C( 121) },
+      { -INT64_C(  424770491700510959), -INT64_C( 6003436596981447811),  INT64_C( 2096227655597464925),  INT64_C( 2811709622788221195),
+         INT64_C(   61261042024469691), -INT64_C( 4684357017361989068), -INT64_C( 3529331252113356527), -INT64_C( 2339602249873800198) },
+      {  INT8_C( 126), -INT8_C(   2), -INT8_C(  91), -INT8_C(  48),  INT8_C(  12), -INT8_C(  23), -INT8_C(  33),  INT8_C(  95),
+        -INT8_C(   6), -INT8_C(  95),  INT8_C(  13), -INT8_C( 114),  INT8_C(  71),  INT8_C(   8), -INT8_C(  32),  INT8_C( 101),
+        -INT8_C(  70), -INT8_C( 121), -INT8_C( 121),  INT8_C(  47),  INT8_C( 116),  INT8_C(  30), -INT8_C(  47),  INT8_C(  46),
+         INT8_C( 102),  INT8_C(  33),  INT8_C(  51),  INT8_C(   9),  INT8_C(  44),  INT8_C(   5),  INT8_C(  51), -INT8_C( 123),
+        -INT8_C(  87),  INT8_C(   3), -INT8_C(  32),  INT8_C(  75),  INT8_C(  10),  INT8_C( 102), -INT8_C( 110), -INT8_C(  92),
+         INT8_C( 114), -INT8_C( 112), -INT8_C(  56), -INT8_C(  63), -INT8_C( 125),  INT8_C(   7),  INT8_C(  57), -INT8_C(  92),
+        -INT8_C(  77),  INT8_C(  72), -INT8_C( 116), -INT8_C( 100),  INT8_C(  35), -INT8_C(  49), -INT8_C( 110),  INT8_C(  73),
+         INT8_C(  67),  INT8_C(  16), -INT8_C(  11),  INT8_C(  50),  INT8_C(   9),  INT8_C(  19), -INT8_C(   6),  INT8_C( 111) } },
+    { { -INT8_C( 121),  INT8_C(  34),  INT8_C( 122), -INT8_C(  48), -INT8_C(  53),  INT8_C( 116), -INT8_C(  92),  INT8_C(  43),
+        -INT8_C(  23), -INT8_C(  18),  INT8_C(   3),  INT8_C(  71), -INT8_C( 107), -INT8_C(  40), -INT8_C(  37),  INT8_C(  96),
+        -INT8_C(  52), -INT8_C(  99), -INT8_C( 126),  INT8_C( 109),  INT8_C(  33), -INT8_C(  47), -INT8_C(  54),  INT8_C(  71),
+        -INT8_C(  51), -INT8_C(   8), -INT8_C(  87),  INT8_C(  58),  INT8_C(  94),  INT8_C(  52),  INT8_C( 106), -INT8_C( 126),
+        -INT8_C(  63),  INT8_C( 102),  INT8_C(  56), -INT8_C( 102),  INT8_C(  37),  INT8_C( 111),  INT8_C(   1), -INT8_C(  31),
+         INT8_C(   0), -INT8_C( 118), -INT8_C(  19), -INT8_C(  58), -INT8_C( 119),  INT8_C(  30),  INT8_C(  26), -INT8_C( 108),
+         INT8_C(  13), -INT8_C(  73), -INT8_C(  50),  INT8_C( 113), -INT8_C(   3), -INT8_C( 110),  INT8_C(  45), -INT8_C(  39),
+         INT8_C( 114), -INT8_C(  90), -INT8_C(  87), -INT8_C(  14),  INT8_C(  49), -INT8_C(  55), -INT8_C(  44), -INT8_C(  29) },
+      {  INT64_C( 2815065336037641750),  INT64_C(  877085961842004031),  INT64_C(  660928689695948840),  INT64_C(  144163794875851583),
+         INT64_C( 2955224550435011390),  INT64_C( 2970176761278835712),  INT64_C( 2388619866768216368),  INT64_C( 2522319360253631237) },
+      {  INT8_C(  28), -INT8_C(  64), -INT8_C( 119),  INT8_C(  10),  INT8_C(  65),  INT8_C( 113), -INT8_C(  16),  INT8_C(  35),
+         INT8_C(   4), -INT8_C(  80),  INT8_C(   7),  INT8_C(  32),  INT8_C(  72),  INT8_C(   9),  INT8_C(  33),  INT8_C(   9),
+         INT8_C(  16),  INT8_C(  33),  INT8_C(  10),  INT8_C(  96), -INT8_C( 110), -INT8_C( 104),  INT8_C(  64),  INT8_C(   0),
+         INT8_C(  97),  INT8_C(   2),  INT8_C(  22), -INT8_C(  64), -INT8_C(  44),  INT8_C(  32),  INT8_C(  11), -INT8_C(  49),
+        -INT8_C(  97),  INT8_C(  68),  INT8_C(  41), -INT8_C( 114), -INT8_C( 120),  INT8_C(   6), -INT8_C(  97), -INT8_C( 119),
+         INT8_C(   0),  INT8_C(  75), -INT8_C(  63), -INT8_C(  80), -INT8_C( 106),  INT8_C(  28), -INT8_C(  58), -INT8_C( 126),
+         INT8_C(  72),  INT8_C(  66), -INT8_C(  92), -INT8_C( 109), -INT8_C( 127), -INT8_C( 118),  INT8_C(  48), -INT8_C( 125),
+        -INT8_C(  64),  INT8_C(  80), -INT8_C( 118), -INT8_C(  64),      INT8_MIN,  INT8_C(  13),  INT8_C(  96), -INT8_C( 125) } },
+    { { -INT8_C(  96), -INT8_C(  67),  INT8_C( 104), -INT8_C(  20), -INT8_C(  77), -INT8_C(  66),  INT8_C(  75),  INT8_C(  47),
+         INT8_C( 125), -INT8_C(  97),  INT8_C(  96), -INT8_C(  68), -INT8_C( 125), -INT8_C( 108), -INT8_C(  97), -INT8_C(  16),
+        -INT8_C(  87),  INT8_C( 108), -INT8_C(   6), -INT8_C(  25),  INT8_C(  80),  INT8_C(  80),  INT8_C(  42),  INT8_C(  98),
+        -INT8_C(  16),  INT8_C(  51), -INT8_C(  75),  INT8_C(  78), -INT8_C( 118), -INT8_C(  51),  INT8_C(  30),  INT8_C(  90),
+        -INT8_C(  36), -INT8_C(  43), -INT8_C(  72),  INT8_C(  29),  INT8_C(  59),  INT8_C(  85), -INT8_C( 113),  INT8_C(  30),
+         INT8_C( 116),  INT8_C(  70), -INT8_C( 126),  INT8_C(  15), -INT8_C(  89), -INT8_C( 118),  INT8_C(  41), -INT8_C(  65),
+         INT8_C(  86), -INT8_C( 116), -INT8_C(  51),  INT8_C(  62), -INT8_C(  62),  INT8_C( 123), -INT8_C(   3), -INT8_C(  64),
+        -INT8_C( 103),  INT8_C(  50),  INT8_C(  74),  INT8_C( 106),  INT8_C(  42), -INT8_C( 110), -INT8_C( 101), -INT8_C(  74) },
+      {  INT64_C( 3766192767861946567),  INT64_C( 1380793326189711808), -INT64_C( 2315918778264636143), -INT64_C( 2125310088922361976),
+        -INT64_C( 7906545937011146441), -INT64_C( 3602828268623568551), -INT64_C( 1051138639604665567),  INT64_C( 8763151485489016426) },
+      {  INT8_C(  94),  INT8_C(  57),  INT8_C(  52),  INT8_C(  67), -INT8_C( 120),  INT8_C(  28), -INT8_C(  49), -INT8_C( 120),
+         INT8_C(   0),  INT8_C( 109),  INT8_C(  54),  INT8_C(   1),  INT8_C(  56),  INT8_C(  60),  INT8_C( 109),  INT8_C(  41),
+         INT8_C(  26), -INT8_C(  61),  INT8_C( 119),  INT8_C( 104), -INT8_C(  31), -INT8_C(  31),  INT8_C(  13),  INT8_C(   9),
+        -INT8_C( 127),  INT8_C(  80),  INT8_C(  20), -INT8_C(  22), -INT8_C(  93), -INT8_C(  44), -INT8_C(  16),  INT8_C(   2),
+        -INT8_C(  58),  INT8_C(  65), -INT8_C( 110), -INT8_C(  29), -INT8_C(  14),  INT8_C(  65),  INT8_C(  73),  INT8_C( 113),
+        -INT8_C(  32), -INT8_C( 123),  INT8_C(  86), -INT8_C(  23),  INT8_C(  93),  INT8_C(  56),  INT8_C(  23), -INT8_C(  77),
+        -INT8_C(  30), -INT8_C(  45),  INT8_C( 105), -INT8_C( 121), -INT8_C(  56),  INT8_C(  62),  INT8_C(  15),  INT8_C(  33),
+         INT8_C( 102),  INT8_C( 103), -INT8_C( 101),  INT8_C(  61),  INT8_C(  61),  INT8_C(  96),  INT8_C(  25), -INT8_C(  26) } },
+    { { -INT8_C(  71), -INT8_C(  60),  INT8_C(  71),  INT8_C(  59), -INT8_C(  31),  INT8_C( 110), -INT8_C( 116),  INT8_C(  97),
+        -INT8_C(   3),  INT8_C(  64),  INT8_C(  96),  INT8_C( 104),  INT8_C(  86), -INT8_C(  70), -INT8_C( 107), -INT8_C(  84),
+         INT8_C(  53),  INT8_C( 127),  INT8_C(   5), -INT8_C(  27),  INT8_C(   8), -INT8_C(  60),  INT8_C(  93), -INT8_C( 127),
+        -INT8_C( 118), -INT8_C( 121),  INT8_C(  32),  INT8_C(  52),  INT8_C(  78), -INT8_C(  98),  INT8_C(  75), -INT8_C( 101),
+         INT8_C(  24),  INT8_C( 100),  INT8_C( 100), -INT8_C(  84), -INT8_C(  93), -INT8_C(  14), -INT8_C(  63),  INT8_C(  70),
+         INT8_C(  82), -INT8_C(  56), -INT8_C(  37), -INT8_C( 126), -INT8_C( 101), -INT8_C(  42), -INT8_C(   9),  INT8_C(  88),
+         INT8_C(  58),  INT8_C(  82), -INT8_C(  12),  INT8_C(  19),  INT8_C(   9), -INT8_C( 123),  INT8_C(  82),  INT8_C(  56),
+         INT8_C(  34), -INT8_C(  26), -INT8_C( 111),  INT8_C(  58), -INT8_C(  48),  INT8_C(  63), -INT8_C(  65),  INT8_C(  52) },
+      {  INT64_C( 1745495643102776100),  INT64_C(  802784415381399578),  INT64_C( 2242271660787436092),  INT64_C( 3546931147961873961),
+         INT64_C( 3542677166868015382),  INT64_C( 2461502021863080503),  INT64_C( 2241417289418809125),  INT64_C(  155673426391411754) },
+      {  INT8_C(  12), -INT8_C(  78),  INT8_C(  22), -INT8_C( 125), -INT8_C( 123), -INT8_C(  28),  INT8_C(  32), -INT8_C( 123),
+        -INT8_C(  48),  INT8_C(  26),  INT8_C(  44),  INT8_C(  16), -INT8_C( 104), -INT8_C( 126),  INT8_C(  48),  INT8_C(  65),
+        -INT8_C(   8),  INT8_C( 120),  INT8_C(  81),  INT8_C(  49),  INT8_C(  10), -INT8_C(  93), -INT8_C( 112),  INT8_C(  30),
+         INT8_C(  77),  INT8_C( 108),  INT8_C(  22),  INT8_C(  19),  INT8_C(  36),  INT8_C(  88),  INT8_C(  38), -INT8_C(  59),
+         INT8_C(   5), -INT8_C(  31), -INT8_C(  31), -INT8_C(  95), -INT8_C(  61),  INT8_C(  74), -INT8_C( 117), -INT8_C(  92),
+        -INT8_C(  61),  INT8_C(   2), -INT8_C( 125), -INT8_C( 115), -INT8_C( 125),  INT8_C( 108),  INT8_C(  68),  INT8_C(  27),
+         INT8_C(  71),  INT8_C(  78), -INT8_C(  15),  INT8_C(  39),  INT8_C(  15), -INT8_C(   7),  INT8_C(  78),  INT8_C(  31),
+         INT8_C(  10),  INT8_C(  64), -INT8_C( 125),      INT8_MIN,  INT8_C(   7),  INT8_C(  84),  INT8_C(  84),  INT8_C(  34) } },
+    { {  INT8_C(  92), -INT8_C(  98), -INT8_C(  65),  INT8_C( 106), -INT8_C(  46),  INT8_C(  77), -INT8_C(  27),  INT8_C(   8),
+        -INT8_C(  82), -INT8_C(  35),  INT8_C( 100),  INT8_C(  78),  INT8_C(  60), -INT8_C(  36),  INT8_C( 119), -INT8_C(  95),
+         INT8_C(  94), -INT8_C(  12), -INT8_C( 127), -INT8_C( 118), -INT8_C(  93),  INT8_C(  32), -INT8_C(   8), -INT8_C( 117),
+         INT8_C(  18),  INT8_C(   0), -INT8_C(  24),  INT8_C( 121), -INT8_C(  13), -INT8_C(  26), -INT8_C(  47),  INT8_C(  32),
+         INT8_C(  28), -INT8_C( 120), -INT8_C( 119), -INT8_C(  64), -INT8_C(  79),  INT8_C( 122),  INT8_C( 102), -INT8_C(  80),
+         INT8_C(  37), -INT8_C(  59), -INT8_C(  20), -INT8_C(  31),  INT8_C( 108), -INT8_C(  58), -INT8_C(  21), -INT8_C(  56),
+        -INT8_C(  83),  INT8_C( 116),  INT8_C(  70), -INT8_C(  86), -INT8_C(  87),  INT8_C( 114), -INT8_C( 104),  INT8_C(   7),
+        -INT8_C(  17),  INT8_C(  68), -INT8_C(  64),  INT8_C(  23), -INT8_C(   1),  INT8_C( 110),  INT8_C(   4), -INT8_C(  14) },
+      {  INT64_C( 4086859590610274589),  INT64_C( 7522860092081262990), -INT64_C( 6810097489173100546), -INT64_C(  639024982323182184),
+         INT64_C( 2920394857859114570),  INT64_C( 3381982798616987250),  INT64_C( 5660438216504790628),  INT64_C( 6481375689760053324) },
+      {  INT8_C(  80), -INT8_C( 108),  INT8_C(  58), -INT8_C(  36),  INT8_C(  78), -INT8_C(  54), -INT8_C( 119),  INT8_C(  73),
+        -INT8_C( 102),  INT8_C(  42),  INT8_C(  22), -INT8_C(  35), -INT8_C(  26),  INT8_C(  85), -INT8_C(  48), -INT8_C(  78),
+        -INT8_C(  87),  INT8_C(  23), -INT8_C(   1), -INT8_C(  79), -INT8_C( 115),  INT8_C( 106), -INT8_C(  95), -INT8_C(  40),
+        -INT8_C( 127), -INT8_C( 104), -INT8_C(  70),  INT8_C( 123), -INT8_C(  28), -INT8_C(  24),  INT8_C(   3),  INT8_C(  42),
+         INT8_C( 103), -INT8_C(  26), -INT8_C(  13),  INT8_C(  74),  INT8_C(  67), -INT8_C( 118),  INT8_C(  78), -INT8_C( 121),
+        -INT8_C(  69),  INT8_C(  51), -INT8_C(  13), -INT8_C(  73), -INT8_C(  13),  INT8_C(  25), -INT8_C(  26),  INT8_C(   6),
+         INT8_C( 111), -INT8_C(  24),  INT8_C(  57),  INT8_C( 122), -INT8_C(  11), -INT8_C(  93),  INT8_C(  79), -INT8_C( 100),
+        -INT8_C(  28), -INT8_C( 124),  INT8_C(  76),  INT8_C(  56), -INT8_C( 104), -INT8_C(  55), -INT8_C( 124),  INT8_C( 124) } },
+    { {  INT8_C(  29), -INT8_C(  51),  INT8_C(  54),  INT8_C(  38), -INT8_C(  38),  INT8_C(  11),  INT8_C(  31),  INT8_C(  59),
+         INT8_C(   9), -INT8_C(  99),  INT8_C(  10),  INT8_C(   8), -INT8_C(  28),  INT8_C(  71),  INT8_C(  53),  INT8_C(  29),
+         INT8_C( 123), -INT8_C(  85),  INT8_C(   0), -INT8_C(  66),  INT8_C( 113),  INT8_C( 121),  INT8_C(  87),  INT8_C(  71),
+         INT8_C(   3),  INT8_C(   9), -INT8_C(  63),  INT8_C(  38), -INT8_C(  50), -INT8_C(  45), -INT8_C(  88),  INT8_C(  79),
+         INT8_C(   3), -INT8_C(  11),  INT8_C(  28),  INT8_C(  70), -INT8_C( 104), -INT8_C( 109), -INT8_C(   4), -INT8_C( 123),
+        -INT8_C(  70), -INT8_C(  13), -INT8_C( 124), -INT8_C(  17), -INT8_C(   2), -INT8_C(  65),  INT8_C( 118), -INT8_C(  80),
+        -INT8_C( 105), -INT8_C(  62),  INT8_C(  97), -INT8_C(  39),  INT8_C(   8),  INT8_C(  76), -INT8_C(  56), -INT8_C(   9),
+        -INT8_C(  70), -INT8_C(  59), -INT8_C(  50),  INT8_C(  57), -INT8_C(  49), -INT8_C(  20),  INT8_C( 127), -INT8_C( 109) },
+      {  INT64_C( 3680301831322148662),  INT64_C( 1585551932910476861),  INT64_C( 1153780361014938667),  INT64_C( 4035256164776556092),
+         INT64_C( 2021575407138642179),  INT64_C( 2164548146714848526),  INT64_C( 3103555317562941463),  INT64_C( 4121695366793865491) },
+      {  INT8_C(  33),  INT8_C( 104), -INT8_C(  52),  INT8_C(  60),  INT8_C(  14), -INT8_C(  93),  INT8_C(   8), -INT8_C(  58),
+         INT8_C(  15), -INT8_C(  88),  INT8_C(   7),  INT8_C(  30),  INT8_C(  49),  INT8_C(  60), -INT8_C(  80), -INT8_C(  88),
+         INT8_C(  98),  INT8_C(  97),  INT8_C(  43), -INT8_C(  84),  INT8_C(   1), -INT8_C( 120),  INT8_C(  46),  INT8_C(  24),
+        -INT8_C(  57),  INT8_C(  27),  INT8_C(  30),  INT8_C( 112), -INT8_C(  40), -INT8_C(  26),  INT8_C(  28),  INT8_C( 108),
+         INT8_C(  32), -INT8_C(  32), -INT8_C(  13),  INT8_C( 100),  INT8_C(  61), -INT8_C(  91),  INT8_C(  49), -INT8_C(  56),
+        -INT8_C( 121), -INT8_C(  63), -INT8_C(  48),  INT8_C(  20),  INT8_C(  56),  INT8_C(  28),  INT8_C( 120),  INT8_C(  10),
+         INT8_C( 104),  INT8_C(   5), -INT8_C( 113),  INT8_C(  26),  INT8_C(  32), -INT8_C(  46),  INT8_C(  32),  INT8_C(  86),
+        -INT8_C(  50),  INT8_C(  72),  INT8_C( 124), -INT8_C( 100),  INT8_C(  62),  INT8_C(  51),  INT8_C(  38),  INT8_C(  67) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i r = simde_mm512_multishift_epi64_epi8(a, b);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_multishift_epi64_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[64];
+    const simde__mmask64 k;
+    const int8_t a[64];
+    const int64_t b[8];
+    const int8_t r[64];
+  } test_vec[] = {
+    { {  INT8_C(  61), -INT8_C( 113),  INT8_C(  52), -INT8_C( 124),  INT8_C(  97), -INT8_C( 119), -INT8_C(  40), -INT8_C( 119),
+         INT8_C( 122),  INT8_C(  44), -INT8_C(  90), -INT8_C( 111), -INT8_C(  74), -INT8_C(  33),  INT8_C(  76), -INT8_C(  20),
+         INT8_C( 123),  INT8_C(   9),  INT8_C( 127), -INT8_C(  65), -INT8_C(  10), -INT8_C( 123),  INT8_C(  98),  INT8_C(   8),
+        -INT8_C(   2), -INT8_C( 119), -INT8_C(  20),  INT8_C(  29), -INT8_C(  35),  INT8_C( 118),  INT8_C( 122),  INT8_C( 108),
+         INT8_C( 108),  INT8_C(  68), -INT8_C(  30),  INT8_C(  47),  INT8_C(  81), -INT8_C(  17), -INT8_C(  38),  INT8_C(  89),
+         INT8_C( 117), -INT8_C(  17),  INT8_C(  62),  INT8_C(  82),  INT8_C(  34),  INT8_C(  56), -INT8_C(  82),  INT8_C(  19),
+         INT8_C(  81), -INT8_C(  95), -INT8_C(  54), -INT8_C(  11), -INT8_C(  58),  INT8_C(   5), -INT8_C(  73),  INT8_C(  52),
+        -INT8_C(  52),  INT8_C(  27), -INT8_C(  31),  INT8_C(  72), -INT8_C( 110),  INT8_C(   9), -INT8_C(  33), -INT8_C(  52) },
+      UINT64_C(17616041635377447866),
+      { -INT8_C(  23),  INT8_C( 126), -INT8_C(  94),  INT8_C(  29),  INT8_C(  59),  INT8_C( 113), -INT8_C(  33), -INT8_C( 112),
+         INT8_C(  21),  INT8_C( 117), -INT8_C(   5),  INT8_C(  50), -INT8_C(  30),  INT8_C(  75), -INT8_C(  15),  INT8_C(  42),
+        -INT8_C(  36),  INT8_C(  21),  INT8_C(  77),  INT8_C(  19), -INT8_C(  13), -INT8_C(  76), -INT8_C(  71), -INT8_C( 100),
+        -INT8_C(  55), -INT8_C( 114), -INT8_C(  99),  INT8_C(  48),  INT8_C( 102),  INT8_C(  44),  INT8_C( 122),  INT8_C(  92),
+         INT8_C(  78),  INT8_C( 100),  INT8_C(  56),  INT8_C( 104), -INT8_C( 110), -INT8_C( 105), -INT8_C(  94),  INT8_C(  27),
+        -INT8_C(  63),  INT8_C(  30),  INT8_C(  44),  INT8_C(  64),  INT8_C(  40), -INT8_C( 120), -INT8_C(  75),  INT8_C(  46),
+         INT8_C( 126), -INT8_C(  64),  INT8_C( 125),  INT8_C(  95), -INT8_C(  69), -INT8_C(  52),  INT8_C(  87), -INT8_C( 121),
+        -INT8_C(  12), -INT8_C( 107),  INT8_C(  20), -INT8_C( 116),  INT8_C(  57), -INT8_C( 121), -INT8_C( 118), -INT8_C(  23) },
+      { -INT64_C( 2910205589026803214),  INT64_C( 7896627276095620034),  INT64_C( 7145998861913979523),  INT64_C(  961913260967535919),
+        -INT64_C( 4666496878789250859),  INT64_C( 8652658111235578762),  INT64_C( 3695592047988271600), -INT64_C(  385123598023536935) },
+      {  INT8_C(  61), -INT8_C(  53),  INT8_C(  52),  INT8_C( 124),  INT8_C(  90), -INT8_C(  50), -INT8_C(  40), -INT8_C(  77),
+         INT8_C(  26),  INT8_C( 108), -INT8_C(  90), -INT8_C( 111), -INT8_C(  74), -INT8_C(  33),  INT8_C(  76), -INT8_C(  20),
+         INT8_C( 123), -INT8_C( 115),  INT8_C( 127),  INT8_C(  55), -INT8_C(  10),  INT8_C(  50),  INT8_C(  98),  INT8_C(   8),
+        -INT8_C( 110), -INT8_C( 119), -INT8_C(  20),  INT8_C(  89), -INT8_C( 100),  INT8_C( 118),  INT8_C( 122),  INT8_C(  59),
+         INT8_C( 108),  INT8_C(  68), -INT8_C(  30),  INT8_C(  69),  INT8_C(  81), -INT8_C(  17), -INT8_C(  38),  INT8_C(   3),
+         INT8_C( 117), -INT8_C(  17),  INT8_C(  62),  INT8_C(  82),  INT8_C(  34),  INT8_C(  56), -INT8_C(  64),  INT8_C(  81),
+         INT8_C(  81), -INT8_C(  95), -INT8_C(  54), -INT8_C(  58),  INT8_C(   6), -INT8_C( 106),  INT8_C( 110),  INT8_C(  52),
+        -INT8_C(  52),  INT8_C(  27), -INT8_C( 110),  INT8_C(  72), -INT8_C(   3), -INT8_C(  99), -INT8_C(  13), -INT8_C(  30) } },
+    { {      INT8_MIN,  INT8_C(  17),  INT8_C(  57),  INT8_C(  33),  INT8_C(   7), -INT8_C( 117), -INT8_C( 110),  INT8_C(  63),
+         INT8_C(  61), -INT8_C(  55),  INT8_C(  48),  INT8_C(  52),  INT8_C(  56),  INT8_C(  92), -INT8_C(  94),  INT8_C(   3),
+         INT8_C(  61),  INT8_C( 125), -INT8_C(  17), -INT8_C(  72), -INT8_C( 119), -INT8_C(  28), -INT8_C(  15),  INT8_C(  78),
+         INT8_C(  18),  INT8_C( 122), -INT8_C( 108),  INT8_C(  23),  INT8_C(   9), -INT8_C(  51),  INT8_C(  34), -INT8_C(  28),
+         INT8_C(   9),  INT8_C( 119),  INT8_C(  65),  INT8_C(  93), -INT8_C(  23), -INT8_C( 118),  INT8_C(  41),  INT8_C( 107),
+        -INT8_C(  23),  INT8_C(  74),  INT8_C( 102),  INT8_C( 118), -INT8_C(  50),  INT8_C(  45),  INT8_C(  33),  INT8_C( 113),
+         INT8_C(  37),  INT8_C(  19), -INT8_C(  41), -INT8_C(  18), -INT8_C( 109), -INT8_C(  42), -INT8_C( 125), -INT8_C(  44),
+         INT8_C(  85), -INT8_C(  65), -INT8_C(  14), -INT8_C(  33),  INT8_C( 126), -INT8_C( 118),  INT8_C(  47), -INT8_C( 127) },
+      UINT64_C(13354427420927594721),
+      {  INT8_C(  54),  INT8_C(  13),  INT8_C(   4),  INT8_C(  15),  INT8_C(  12),  INT8_C(  30),  INT8_C(  35),  INT8_C(  35),
+         INT8_C(  51),  INT8_C(  47),  INT8_C(  53),  INT8_C(  61),  INT8_C(  59),  INT8_C(   8),  INT8_C(  13),  INT8_C(  60),
+         INT8_C(  32),  INT8_C(  37),  INT8_C(  37),  INT8_C(  11),  INT8_C(   1),  INT8_C(  17),  INT8_C(  36),  INT8_C(  28),
+         INT8_C(  51),  INT8_C(  13),  INT8_C(  23),  INT8_C(  25),  INT8_C(   5),  INT8_C(  55),  INT8_C(  51),  INT8_C(  55),
+         INT8_C(  29),  INT8_C(  31),  INT8_C(  31),  INT8_C(  31),  INT8_C(   9),  INT8_C(  10),  INT8_C(  32),  INT8_C(  61),
+         INT8_C(  45),  INT8_C(  40),  INT8_C(  59),  INT8_C(  49),  INT8_C(  44),  INT8_C(  54),  INT8_C(  36),  INT8_C(  55),
+         INT8_C(  19),  INT8_C(  51),  INT8_C(  58),  INT8_C(   6),  INT8_C(  13),  INT8_C(  56),  INT8_C(  23),  INT8_C(  42),
+         INT8_C(  14),  INT8_C(  59),  INT8_C(  46),  INT8_C(  52),  INT8_C(  41),  INT8_C(  19),  INT8_C(   3),  INT8_C(  45) },
+      { -INT64_C( 7188782295556262659),  INT64_C( 5593678783346052953), -INT64_C(  626258304897304201), -INT64_C( 1405500105830649420),
+        -INT64_C( 2105475838798656151),  INT64_C( 2395182410110404391), -INT64_C( 8934481258533675761), -INT64_C(  542610226627020539) },
+      {  INT8_C( 112),  INT8_C(  17),  INT8_C(  57),  INT8_C(  33),  INT8_C(   7),  INT8_C(  92),  INT8_C(  18),  INT8_C(  18),
+         INT8_C(  61), -INT8_C(  55),  INT8_C(  48),  INT8_C(  52),  INT8_C(  41),  INT8_C(  92), -INT8_C(  94),  INT8_C(   3),
+         INT8_C(  61),  INT8_C( 125), -INT8_C(  17), -INT8_C(  72), -INT8_C( 119),  INT8_C( 122), -INT8_C(  15),  INT8_C(  78),
+        -INT8_C( 113), -INT8_C( 123), -INT8_C( 108), -INT8_C(  38),  INT8_C(   9), -INT8_C(  51),  INT8_C(  34), -INT8_C(  28),
+         INT8_C(   9),  INT8_C( 119), -INT8_C(  62), -INT8_C(  62), -INT8_C( 122),  INT8_C(  67), -INT8_C(  31),  INT8_C(  79),
+        -INT8_C(  23),  INT8_C(  74), -INT8_C(  28),  INT8_C( 118), -INT8_C(  42), -INT8_C( 124),  INT8_C(  91),  INT8_C( 113),
+         INT8_C(  37),  INT8_C(  19), -INT8_C(  31), -INT8_C(  18), -INT8_C(  72), -INT8_C(  42), -INT8_C(  71), -INT8_C(  44),
+        -INT8_C( 101), -INT8_C(  65), -INT8_C(  14), -INT8_C( 121),  INT8_C(  33), -INT8_C(  52),  INT8_C(  47), -INT8_C(  62) } },
+    { {  INT8_C( 126), -INT8_C(  48), -INT8_C(  99),  INT8_C(  40),  INT8_C(  30), -INT8_C(  90),  INT8_C(  67), -INT8_C(   1),
+         INT8_C( 118),  INT8_C(  80), -INT8_C(  84), -INT8_C( 121), -INT8_C(  64),  INT8_C( 127),  INT8_C( 123),  INT8_C(  65),
+        -INT8_C(  11), -INT8_C(  92),  INT8_C(  59),  INT8_C(  71),  INT8_C(  93), -INT8_C(  35),  INT8_C(  34),  INT8_C(  18),
+        -INT8_C(   8),  INT8_C(  55),  INT8_C( 117), -INT8_C(  15), -INT8_C(  84),  INT8_C(  57), -INT8_C(  89), -INT8_C( 120),
+         INT8_C( 111), -INT8_C(  67),  INT8_C( 110),  INT8_C(  46),      INT8_MIN, -INT8_C(  29),  INT8_C(  86), -INT8_C( 108),
+         INT8_C(   7),  INT8_C( 107),  INT8_C(  27),  INT8_C(   1),  INT8_C(  31),  INT8_C(  85),  INT8_C(  83),  INT8_C(  11),
+         INT8_C(  87),  INT8_C(  75), -INT8_C(  65),  INT8_C( 110),  INT8_C(  42),  INT8_C(  96),  INT8_C(  28),  INT8_C(  10),
+         INT8_C( 126), -INT8_C(  64),  INT8_C(  87),  INT8_C(  71),  INT8_C(  41), -INT8_C(  99),  INT8_C( 102),  INT8_C( 112) },
+      UINT64_C(14945724263215336296),
+      { -INT8_C( 122),  INT8_C(  41),  INT8_C( 117), -INT8_C( 109), -INT8_C(  48),  INT8_C(  47), -INT8_C(  75), -INT8_C( 122),
+         INT8_C(  37), -INT8_C(  25),  INT8_C(  68),  INT8_C(  50),  INT8_C(  94), -INT8_C(  94), -INT8_C(  17),  INT8_C(  82),
+         INT8_C( 106), -INT8_C(  90),  INT8_C(   7), -INT8_C(  71), -INT8_C( 104),  INT8_C(  67),  INT8_C(  49),  INT8_C(   7),
+        -INT8_C(  81),  INT8_C( 110),  INT8_C(   2), -INT8_C( 124), -INT8_C( 123), -INT8_C(  76),  INT8_C(  61), -INT8_C( 125),
+        -INT8_C(   4),  INT8_C( 111), -INT8_C( 123), -INT8_C(  44),  INT8_C( 121), -INT8_C(  27), -INT8_C(  66),  INT8_C(  91),
+         INT8_C( 105), -INT8_C( 101), -INT8_C(  96),  INT8_C(  71),  INT8_C(   1), -INT8_C(  67), -INT8_C(  84), -INT8_C( 117),
+         INT8_C(  10), -INT8_C(  14),  INT8_C(  31), -INT8_C(   3), -INT8_C(  78),  INT8_C(   7), -INT8_C(  31),  INT8_C(   6),
+        -INT8_C(  76),  INT8_C( 119), -INT8_C(  69), -INT8_C( 102), -INT8_C( 119),  INT8_C( 102),  INT8_C(  94),  INT8_C(  10) },
+      { -INT64_C( 3438292323043680274),  INT64_C( 3214285897625332027), -INT64_C(   73947320008063420),  INT64_C( 8829717245097900843),
+         INT64_C( 4648118729948434402),  INT64_C( 3122050082002558588),  INT64_C(  135916658752413959), -INT64_C(  584071585083935069) },
+      {  INT8_C( 126), -INT8_C(  48), -INT8_C(  99),  INT8_C(  96),  INT8_C(  30), -INT8_C( 111), -INT8_C( 126), -INT8_C(   1),
+         INT8_C( 127), -INT8_C(  33), -INT8_C(  84),  INT8_C(  38), -INT8_C(  64),  INT8_C( 127),  INT8_C( 123),  INT8_C(  65),
+         INT8_C(  82),  INT8_C(  37),  INT8_C(  59),  INT8_C(  71),  INT8_C(  93), -INT8_C(  56),  INT8_C( 124), -INT8_C( 116),
+         INT8_C(  18),  INT8_C(  37),  INT8_C( 117), -INT8_C(  15), -INT8_C(  39),  INT8_C(  57), -INT8_C(  89), -INT8_C( 120),
+         INT8_C( 111), -INT8_C(  67),  INT8_C( 110), -INT8_C(  58),      INT8_MIN, -INT8_C(  29),  INT8_C(  86), -INT8_C( 108),
+        -INT8_C(  32),  INT8_C( 107),  INT8_C(  27),  INT8_C(   1),  INT8_C(  31), -INT8_C(  31),  INT8_C(  60), -INT8_C(  69),
+        -INT8_C(  72),  INT8_C(  75), -INT8_C(  65),  INT8_C(  56),  INT8_C(  42), -INT8_C(  62), -INT8_C(  67),  INT8_C(  10),
+         INT8_C( 126), -INT8_C(  17),  INT8_C( 126),  INT8_C(  57),  INT8_C(  41), -INT8_C(  99), -INT8_C(  13),  INT8_C(  13) } },
+    { { -INT8_C( 100), -INT8_C(  41),  INT8_C(   8), -INT8_C(  20),  INT8_C(  81),  INT8_C( 121),  INT8_C(  35), -INT8_C(  21),
+         INT8_C(  32),  INT8_C(  64),  INT8_C(  28), -INT8_C(  98), -INT8_C(  53), -INT8_C(  58), -INT8_C(  17),  INT8_C(  10),
+        -INT8_C(  36), -INT8_C(  13), -INT8_C(  70), -INT8_C(  51), -INT8_C(  94),  INT8_C(  35),  INT8_C(  95),  INT8_C(  27),
+         INT8_C(  79), -INT8_C(  71),  INT8_C( 122), -INT8_C(  98),  INT8_C(  35), -INT8_C(  47), -INT8_C( 104), -INT8_C(  47),
+         INT8_C(  94),  INT8_C(  86),  INT8_C(   6), -INT8_C(  48), -INT8_C(  75),  INT8_C( 102),  INT8_C(  64), -INT8_C( 126),
+         INT8_C( 123),  INT8_C(  57), -INT8_C(  49),  INT8_C(  62), -INT8_C(  94),  INT8_C(  17),  INT8_C(  13),  INT8_C(   5),
+        -INT8_C( 123),  INT8_C(  58),  INT8_C(  16), -INT8_C(  36),  INT8_C(  49), -INT8_C( 123), -INT8_C( 104), -INT8_C(   9),
+        -INT8_C( 102), -INT8_C( 105),  INT8_C(  36),  INT8_C(  26),  INT8_C(  44),  INT8_C(  44),  INT8_C(  40),  INT8_C(  32) },
+      UINT64_C( 3924111797069240364),
+      {  INT8_C(   0),  INT8_C(  45),  INT8_C(  38),  INT8_C(  54),  INT8_C(  25),  INT8_C(  13),  INT8_C(  47),  INT8_C(  39),
+         INT8_C(  59),  INT8_C(  16),  INT8_C(  34),  INT8_C(  44),  INT8_C(  60),  INT8_C(  49),  INT8_C(  33),  INT8_C(  58),
+         INT8_C(  48),  INT8_C(  56),  INT8_C(   6),  INT8_C(  17),  INT8_C(   8),  INT8_C(  50),  INT8_C(  21),  INT8_C(  43),
+         INT8_C(  54),  INT8_C(  17),  INT8_C(   5),  INT8_C(  62),  INT8_C(  30),  INT8_C(  17),  INT8_C(  59),  INT8_C(  35),
+         INT8_C(  40),  INT8_C(  33),  INT8_C(   9),  INT8_C(  23),  INT8_C(  55),  INT8_C(  14),  INT8_C(  30),  INT8_C(  28),
+         INT8_C(  62),  INT8_C(  15),  INT8_C(  18),  INT8_C(  37),  INT8_C(   5),  INT8_C(  55),  INT8_C(  39),  INT8_C(   1),
+         INT8_C(  55),  INT8_C(  57),  INT8_C(   4),  INT8_C(  16),  INT8_C(  18),  INT8_C(  22),  INT8_C(  22),  INT8_C(  11),
+         INT8_C(   6),  INT8_C(  52),  INT8_C(  36),  INT8_C(  29),  INT8_C(  44),  INT8_C(  52),  INT8_C(  12),  INT8_C(   4) },
+      { -INT64_C(  362764479414578800),  INT64_C( 6981578703429273285), -INT64_C( 7483765644780021280),  INT64_C( 8066728717668991719),
+         INT64_C( 1272284817092543309),  INT64_C( 2205995581963868333),  INT64_C( 1432322691268198506), -INT64_C( 8240379147923163265) },
+      { -INT8_C( 100), -INT8_C(  41), -INT8_C(  50), -INT8_C(  21),  INT8_C(  81), -INT8_C(  22),  INT8_C(  35), -INT8_C(  21),
+         INT8_C(  32),  INT8_C(  64),  INT8_C(  28),  INT8_C(  56),  INT8_C(  86), -INT8_C(  58),  INT8_C( 107),  INT8_C(  10),
+         INT8_C(  36), -INT8_C( 104), -INT8_C(  70),  INT8_C(  78),  INT8_C(  89),  INT8_C(   9),  INT8_C(  95),  INT8_C(  27),
+        -INT8_C(  65),  INT8_C(  13),  INT8_C( 122), -INT8_C(  99),  INT8_C(  30),  INT8_C(  13), -INT8_C(  19), -INT8_C(  47),
+         INT8_C(  16),  INT8_C(  38),  INT8_C(   6), -INT8_C(  48), -INT8_C(  75), -INT8_C(  78),  INT8_C(  51), -INT8_C(  51),
+         INT8_C( 123),  INT8_C(  19), -INT8_C(  62),  INT8_C(  42), -INT8_C(  59),  INT8_C(  61),  INT8_C(  13),  INT8_C(   5),
+         INT8_C(  39),  INT8_C(  58),  INT8_C(   6), -INT8_C(  36),  INT8_C(  49), -INT8_C( 125), -INT8_C( 125), -INT8_C(   9),
+        -INT8_C( 102), -INT8_C(  38), -INT8_C(  83),  INT8_C(  26),  INT8_C(  68), -INT8_C(  38),  INT8_C(  40),  INT8_C(  32) } },
+    { {  INT8_C(  36),  INT8_C( 114), -INT8_C(  78), -INT8_C( 115), -INT8_C( 106),  INT8_C( 109),  INT8_C(  13),  INT8_C(  85),
+         INT8_C(  41),  INT8_C(  83), -INT8_C(   5), -INT8_C( 122), -INT8_C(  13),  INT8_C(  70), -INT8_C(  70),  INT8_C(  99),
+        -INT8_C(  63),  INT8_C(  66), -INT8_C(  40),  INT8_C(  35), -INT8_C(  59), -INT8_C( 106), -INT8_C(  53), -INT8_C(  36),
+        -INT8_C(  79),  INT8_C(  50), -INT8_C(  74),  INT8_C(   1),  INT8_C( 103),  INT8_C(  57), -INT8_C(  63), -INT8_C( 114),
+        -INT8_C(  95), -INT8_C( 116), -INT8_C( 113), -INT8_C(  64),  INT8_C(  51),  INT8_C(  39), -INT8_C(   9),  INT8_C( 114),
+        -INT8_C(  96),  INT8_C(   3), -INT8_C(  45),  INT8_C(  84),  INT8_C(  52),  INT8_C( 110), -INT8_C(  20),  INT8_C( 121),
+         INT8_C( 109),  INT8_C(  45),  INT8_C( 101), -INT8_C(  21), -INT8_C( 104),  INT8_C( 101),  INT8_C(  43),  INT8_C( 119),
+        -INT8_C( 119), -INT8_C( 104),  INT8_C(  35),  INT8_C( 103), -INT8_C(  13), -INT8_C(  12),  INT8_C(  35), -INT8_C(  17) },
+      UINT64_C(17273017361294943913),
+      {  INT8_C(  96),  INT8_C( 122),  INT8_C(  90), -INT8_C(  58),  INT8_C(  17), -INT8_C(  23), -INT8_C(  86), -INT8_C(  51),
+        -INT8_C(  54),  INT8_C(  33), -INT8_C(  61),  INT8_C(   4), -INT8_C(  88),  INT8_C(  25),  INT8_C(  41),  INT8_C(  49),
+         INT8_C(  91),  INT8_C(  61),  INT8_C(  51),  INT8_C(   1),  INT8_C( 119),  INT8_C( 101),  INT8_C(  85), -INT8_C(  53),
+        -INT8_C(  74),  INT8_C(  85),  INT8_C(  57), -INT8_C(   9),      INT8_MIN,  INT8_C(  71), -INT8_C(   5), -INT8_C( 114),
+         INT8_C(  43), -INT8_C(  29),  INT8_C(  12), -INT8_C(  36), -INT8_C(  69),  INT8_C(   0), -INT8_C(  48), -INT8_C( 125),
+        -INT8_C(  10), -INT8_C( 119), -INT8_C(  44), -INT8_C(  27),  INT8_C(  48), -INT8_C(  94),  INT8_C( 119),  INT8_C(  79),
+        -INT8_C(  79), -INT8_C(  54), -INT8_C( 117),  INT8_C(  94),  INT8_C(  92), -INT8_C(  72),  INT8_C(  89), -INT8_C(  81),
+         INT8_C(  46),  INT8_C(  48), -INT8_C(  96),  INT8_C( 119),  INT8_C(  21),  INT8_C(  95),  INT8_C(  27),  INT8_C(  79) },
+      {  INT64_C( 2549545847786833625), -INT64_C( 4722314502690480339), -INT64_C( 8034719242457623733),  INT64_C( 8664486114493765961),
+        -INT64_C( 6433435414729668196), -INT64_C( 2004986891854006639),  INT64_C( 4860384822236348747),  INT64_C( 6342829945021313401) },
+      {  INT8_C( 112),  INT8_C( 114), -INT8_C(  78),  INT8_C(  27), -INT8_C( 106), -INT8_C(  25),  INT8_C(  13),  INT8_C(  64),
+         INT8_C(  41), -INT8_C(   3), -INT8_C(  27), -INT8_C( 122), -INT8_C(  13),  INT8_C( 102),  INT8_C( 123),  INT8_C(  59),
+         INT8_C( 102),  INT8_C(  92), -INT8_C(  40),  INT8_C(  35), -INT8_C(  59), -INT8_C( 117), -INT8_C(  53), -INT8_C(  36),
+        -INT8_C(  32), -INT8_C(  67), -INT8_C(  74),  INT8_C(   1),  INT8_C(  73),  INT8_C(  57), -INT8_C(  63), -INT8_C( 114),
+        -INT8_C(  95),  INT8_C(  18), -INT8_C(  20), -INT8_C(  64),  INT8_C(  51),  INT8_C(  39), -INT8_C(  98),  INT8_C(  51),
+        -INT8_C( 112),  INT8_C(   3),  INT8_C(  59),  INT8_C(  84),  INT8_C(  44),  INT8_C( 110), -INT8_C(  20),  INT8_C( 121),
+         INT8_C( 109),  INT8_C(  64),  INT8_C(  32), -INT8_C(  21), -INT8_C(  23),  INT8_C(  67),  INT8_C(  43), -INT8_C(  25),
+         INT8_C(  25),  INT8_C(   6),  INT8_C(  58), -INT8_C(  80), -INT8_C(  13),  INT8_C( 117),  INT8_C(  85),  INT8_C( 105) } },
+    { { -INT8_C( 117), -INT8_C(  36),  INT8_C( 101),  INT8_C(  53),  INT8_C(  73),  INT8_C( 103), -INT8_C(  25), -INT8_C(  30),
+        -INT8_C(  77),  INT8_C(  80), -INT8_C( 126), -INT8_C(  55), -INT8_C( 120), -INT8_C(  15),  INT8_C(  34),  INT8_C(  34),
+         INT8_C(  36), -INT8_C( 110), -INT8_C(  31),  INT8_C(  60), -INT8_C(   8), -INT8_C(  37), -INT8_C(  14),  INT8_C(  63),
+         INT8_C(  27), -INT8_C( 109), -INT8_C(  54),  INT8_C(   7), -INT8_C(  71), -INT8_C(  80), -INT8_C(  81), -INT8_C( 108),
+        -INT8_C(  83),  INT8_C( 110),  INT8_C(  34), -INT8_C(   8),  INT8_C( 105), -INT8_C( 117), -INT8_C(  56),  INT8_C(   3),
+        -INT8_C( 115), -INT8_C(  74),  INT8_C(  31),  INT8_C(  47),  INT8_C(  77), -INT8_C(   7),  INT8_C(  78),  INT8_C(  42),
+         INT8_C(   2), -INT8_C( 124),  INT8_C(  41),  INT8_C(  95),  INT8_C(  71), -INT8_C(  67),  INT8_C(  66), -INT8_C(  64),
+        -INT8_C(  83),  INT8_C(  70),  INT8_C(  64),  INT8_C(  26), -INT8_C( 102),  INT8_C(  41),  INT8_C(   5), -INT8_C( 115) },
+      UINT64_C(14916280709676610095),
+      {  INT8_C(   8),  INT8_C(  61),  INT8_C(  19),  INT8_C(  21),  INT8_C(  62),  INT8_C(  27),  INT8_C(  13),  INT8_C(  11),
+         INT8_C(  14),  INT8_C(  12),  INT8_C(  52),  INT8_C(  13),  INT8_C(  22),  INT8_C(  19),  INT8_C(  25),  INT8_C(  49),
+         INT8_C(  44),  INT8_C(  39),  INT8_C(  44),  INT8_C(  39),  INT8_C(  37),  INT8_C(  12),  INT8_C(  30),  INT8_C(  58),
+         INT8_C(  31),  INT8_C(   7),  INT8_C(  41),  INT8_C(  29),  INT8_C(   0),  INT8_C(   4),  INT8_C(  12),  INT8_C(  29),
+         INT8_C(  26),  INT8_C(  57),  INT8_C(  38),  INT8_C(   0),  INT8_C(  26),  INT8_C(  24),  INT8_C(   4),  INT8_C(  50),
+         INT8_C(  15),  INT8_C(  47),  INT8_C(   0),  INT8_C(   7),  INT8_C(  49),  INT8_C(  55),  INT8_C(  26),  INT8_C(  33),
+         INT8_C(  31),  INT8_C(  47),  INT8_C(  34),  INT8_C(  43),  INT8_C(  43),  INT8_C(  31),  INT8_C(   1),  INT8_C(   0),
+         INT8_C(  58),  INT8_C(  10),  INT8_C(  34),  INT8_C(  63),  INT8_C(  52),  INT8_C(  33),  INT8_C(  57),  INT8_C(  46) },
+      { -INT64_C( 8369253689859390968), -INT64_C( 3461466143932560280),  INT64_C(  701522131648891496),  INT64_C( 7480004866905612485),
+         INT64_C( 3780364213300226269),  INT64_C( 5119783244547242512), -INT64_C( 3214518136677119619),  INT64_C( 1934665442656874476) },
+      { -INT8_C(  62),  INT8_C(  68), -INT8_C( 103), -INT8_C(  26),  INT8_C(  73), -INT8_C( 113), -INT8_C(  25), -INT8_C(  30),
+        -INT8_C(  77), -INT8_C(  68), -INT8_C( 126), -INT8_C(  55), -INT8_C(  29),  INT8_C(  27),  INT8_C(  34),  INT8_C(  34),
+        -INT8_C(  60), -INT8_C( 110), -INT8_C(  31), -INT8_C(  99), -INT8_C(   8), -INT8_C(  37), -INT8_C(  91),  INT8_C(  63),
+         INT8_C(  27),  INT8_C(  65),  INT8_C(  40),  INT8_C(  93), -INT8_C(  71), -INT8_C(  80), -INT8_C(  81),  INT8_C(  93),
+        -INT8_C(  83), -INT8_C( 102),  INT8_C(  52), -INT8_C(   8),  INT8_C( 105), -INT8_C( 117), -INT8_C( 115),  INT8_C(   3),
+        -INT8_C( 115),  INT8_C(  26),  INT8_C(  16),  INT8_C(  47),  INT8_C(  77), -INT8_C(   7),  INT8_C(  12),  INT8_C(  42),
+        -INT8_C( 110), -INT8_C( 124),  INT8_C(  41),  INT8_C(  95),  INT8_C(  71), -INT8_C(  67),  INT8_C(  66), -INT8_C(  64),
+         INT8_C(   6),  INT8_C(  91), -INT8_C(   2), -INT8_C(  40), -INT8_C( 102),  INT8_C(  41),  INT8_C(  13),  INT8_C( 101) } },
+    { { -INT8_C(  71),  INT8_C(  10), -INT8_C(  96), -INT8_C( 123),  INT8_C(  18), -INT8_C(  82), -INT8_C(  81),  INT8_C(  80),
+        -INT8_C( 102),  INT8_C(  31), -INT8_C(  97), -INT8_C(  58), -INT8_C(  85), -INT8_C( 104),  INT8_C( 123), -INT8_C(  43),
+        -INT8_C(  64),  INT8_C( 121),  INT8_C( 109),  INT8_C(  73), -INT8_C(  49),  INT8_C(  68), -INT8_C(  64), -INT8_C(  29),
+        -INT8_C(  82), -INT8_C(  25), -INT8_C( 116), -INT8_C(   5),  INT8_C(  80), -INT8_C(  40),  INT8_C(  33),  INT8_C(   3),
+         INT8_C(  21), -INT8_C( 123), -INT8_C(  24),  INT8_C(  45),  INT8_C(  57),  INT8_C( 127),  INT8_C( 103), -INT8_C( 127),
+             INT8_MIN, -INT8_C(  93),  INT8_C(  66),  INT8_C( 108), -INT8_C(  70),  INT8_C(   9), -INT8_C(  93), -INT8_C(  62),
+         INT8_C(   9),  INT8_C(  41), -INT8_C(  91), -INT8_C( 126),  INT8_C(   5),  INT8_C( 125),  INT8_C(  57), -INT8_C( 125),
+        -INT8_C( 112),  INT8_C(  19),  INT8_C(  13), -INT8_C(  49), -INT8_C( 106),  INT8_C( 121),  INT8_C(  15), -INT8_C(  95) },
+      UINT64_C(   27162974243387401),
+      { -INT8_C(  30),  INT8_C(  63), -INT8_C(   3), -INT8_C(  74), -INT8_C( 127),  INT8_C(  78),  INT8_C(   4),  INT8_C(  20),
+        -INT8_C(  56), -INT8_C(  95),  INT8_C(  76), -INT8_C(  98),  INT8_C( 117),  INT8_C(  27), -INT8_C(  35), -INT8_C(  32),
+        -INT8_C(  17), -INT8_C(  10), -INT8_C(  19),  INT8_C(  32),  INT8_C( 124), -INT8_C( 108),  INT8_C(  13), -INT8_C( 111),
+        -INT8_C(  18),  INT8_C(  15), -INT8_C(  53),  INT8_C(  12),  INT8_C(  24),  INT8_C(  62), -INT8_C(   8), -INT8_C( 111),
+         INT8_C(  98),  INT8_C(  68),  INT8_C(  46),  INT8_C(   4),  INT8_C(  10),  INT8_C( 114), -INT8_C(  68), -INT8_C(  35),
+         INT8_C(  86),  INT8_C(  88), -INT8_C(   4),  INT8_C(  89), -INT8_C(  15), -INT8_C(  48),  INT8_C( 109), -INT8_C(  79),
+         INT8_C(  82), -INT8_C(  22), -INT8_C(  63), -INT8_C(  40),  INT8_C(  35), -INT8_C(  63),  INT8_C( 102), -INT8_C(  94),
+        -INT8_C(  23),  INT8_C(  40),  INT8_C( 116), -INT8_C(  74),  INT8_C(   1),  INT8_C(  71),  INT8_C(  83),  INT8_C( 111) },
+      {  INT64_C( 8492236773552083299), -INT64_C( 1190232589768725371),  INT64_C( 6311387411425679950),  INT64_C( 2063672033720383229),
+        -INT64_C( 5053918938689513082), -INT64_C( 5159161562548056688),  INT64_C( 7751441627889824491),  INT64_C( 2623550914218298019) },
+      {  INT8_C(  22),  INT8_C(  10), -INT8_C(  96), -INT8_C(  41),  INT8_C(  18), -INT8_C(  82), -INT8_C(  81),  INT8_C(  80),
+        -INT8_C( 102),  INT8_C(  31), -INT8_C(  97),  INT8_C(  16),  INT8_C( 123),      INT8_MIN,  INT8_C(  32), -INT8_C(  60),
+         INT8_C(  45),  INT8_C( 121),  INT8_C( 109),  INT8_C(  73), -INT8_C(  27),  INT8_C(  68),  INT8_C(  50), -INT8_C(  13),
+        -INT8_C(  82), -INT8_C(  97), -INT8_C(  10), -INT8_C(   5),  INT8_C(  80), -INT8_C(  40),  INT8_C(  28),  INT8_C( 103),
+         INT8_C(  21), -INT8_C( 123),  INT8_C( 115),  INT8_C(  45), -INT8_C(  74),  INT8_C( 127),  INT8_C( 103),  INT8_C(   4),
+             INT8_MIN, -INT8_C(  93),  INT8_C(  66),  INT8_C( 108), -INT8_C(  70),  INT8_C(   9), -INT8_C(  93),  INT8_C(  51),
+         INT8_C(   9),  INT8_C(  41), -INT8_C(  91), -INT8_C( 126),  INT8_C(   5),  INT8_C( 117), -INT8_C( 100), -INT8_C( 125),
+        -INT8_C( 112),  INT8_C(  19),  INT8_C(  13), -INT8_C(  49), -INT8_C( 106),  INT8_C( 121),  INT8_C(  15), -INT8_C(  95) } },
+    { { -INT8_C(  85), -INT8_C(  44), -INT8_C(  17),  INT8_C(  30), -INT8_C( 104), -INT8_C(  79),  INT8_C(  44), -INT8_C(  44),
+         INT8_C(  99), -INT8_C( 105), -INT8_C(  76),  INT8_C(   9),  INT8_C( 119), -INT8_C(  83),  INT8_C(   2),  INT8_C( 122),
+        -INT8_C( 100), -INT8_C(  87), -INT8_C(  88), -INT8_C(  11),  INT8_C(  62), -INT8_C(   8),  INT8_C( 103), -INT8_C(   5),
+         INT8_C(  76), -INT8_C(  46),  INT8_C(  93),  INT8_C(  93),  INT8_C(  65), -INT8_C(  71), -INT8_C(  54), -INT8_C(  97),
+        -INT8_C(  24), -INT8_C(  49),  INT8_C(   4), -INT8_C( 108), -INT8_C( 103), -INT8_C( 100),  INT8_C(  11),  INT8_C(  15),
+         INT8_C(   7), -INT8_C(  45),  INT8_C( 106),  INT8_C(  44),      INT8_MIN,  INT8_C(  35), -INT8_C(  65), -INT8_C( 106),
+        -INT8_C(   5), -INT8_C(  34),  INT8_C( 119),  INT8_C(  31), -INT8_C(  71), -INT8_C(  32), -INT8_C(  33),  INT8_C(  50),
+        -INT8_C(  60),  INT8_C( 113), -INT8_C(  85), -INT8_C( 104),  INT8_C(   7),  INT8_C(  75),  INT8_C(  55),  INT8_C(   3) },
+      UINT64_C( 7210682707020821007),
+      {  INT8_C(  53),  INT8_C(  15),  INT8_C(  14),  INT8_C(  18),  INT8_C(  53),  INT8_C(   1),  INT8_C(   7),  INT8_C(  40),
+         INT8_C(  33),  INT8_C(  26),  INT8_C(  38),  INT8_C(  38),  INT8_C(  52),  INT8_C(  29),  INT8_C(   5),  INT8_C(  42),
+         INT8_C(  50),  INT8_C(   4),  INT8_C(  21),  INT8_C(  25),  INT8_C(   7),  INT8_C(  27),  INT8_C(  29),  INT8_C(  50),
+         INT8_C(   6),  INT8_C(  11),  INT8_C(  62),  INT8_C(   1),  INT8_C(   4),  INT8_C(  18),  INT8_C(  50),  INT8_C(  53),
+         INT8_C(  60),  INT8_C(  14),  INT8_C(  44),  INT8_C(  54),  INT8_C(  12),  INT8_C(  30),  INT8_C(  35),  INT8_C(  50),
+         INT8_C(  15),  INT8_C(  32),  INT8_C(  41),  INT8_C(  49),  INT8_C(  33),  INT8_C(  59),  INT8_C(  51),  INT8_C(  56),
+         INT8_C(  18),  INT8_C(  62),  INT8_C(  15),  INT8_C(   7),  INT8_C(  52),  INT8_C(   7),  INT8_C(  34),  INT8_C(  21),
+         INT8_C(  40),  INT8_C(   3),  INT8_C(  26),  INT8_C(  45),  INT8_C(  26),  INT8_C(  15),  INT8_C(   8),  INT8_C(   9) },
+      { -INT64_C( 4788931619782705274), -INT64_C( 7958939706231780272), -INT64_C( 5423673708995096136),  INT64_C( 1328785720816177303),
+         INT64_C( 4881480959961750130),  INT64_C( 1060589311773056769), -INT64_C( 7077245181316957058),  INT64_C( 4990311471958413292) },
+      { -INT8_C(  20),  INT8_C( 110), -INT8_C(  36),  INT8_C(  77), -INT8_C( 104), -INT8_C(  79),  INT8_C(  44), -INT8_C(  44),
+         INT8_C(  99),  INT8_C(  89), -INT8_C(  76),  INT8_C(   9),  INT8_C(  24),  INT8_C(  11),  INT8_C(   2),  INT8_C( 122),
+         INT8_C(  46),  INT8_C(  27), -INT8_C(  19), -INT8_C(  11),  INT8_C(  62), -INT8_C(   8),  INT8_C( 103), -INT8_C(   5),
+         INT8_C(  76), -INT8_C(  46),  INT8_C(  92),  INT8_C(  75),  INT8_C(   9), -INT8_C(  71), -INT8_C( 100), -INT8_C( 109),
+         INT8_C(  36),  INT8_C( 105), -INT8_C(  24), -INT8_C( 108), -INT8_C(  91),  INT8_C(  71),  INT8_C(  11), -INT8_C(  17),
+        -INT8_C(  98), -INT8_C(  45), -INT8_C(   4),  INT8_C(  91),  INT8_C(  46),  INT8_C(  33), -INT8_C(  42), -INT8_C( 106),
+        -INT8_C(  48), -INT8_C(  34),  INT8_C( 119),  INT8_C(  31), -INT8_C(  36), -INT8_C(  32), -INT8_C(  33),  INT8_C(  50),
+        -INT8_C(  60),  INT8_C( 113),  INT8_C(   3), -INT8_C( 104),  INT8_C(   7),  INT8_C(  70),  INT8_C(  79),  INT8_C(   3) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi8(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i r = simde_mm512_mask_multishift_epi64_epi8(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_multishift_epi64_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 k;
+    const int8_t a[64];
+    const int64_t b[8];
+    const int8_t r[64];
+  } test_vec[] = {
+    { UINT64_C(14131083974772949234),
+      {  INT8_C( 115),  INT8_C( 113),  INT8_C(  45),  INT8_C(  29),  INT8_C(  77), -INT8_C(  21), -INT8_C(  20), -INT8_C(  71),
+        -INT8_C( 114),  INT8_C( 109),  INT8_C(  29), -INT8_C(  23), -INT8_C(  36),  INT8_C(  93), -INT8_C(   1),  INT8_C(   0),
+         INT8_C(  40), -INT8_C( 124),  INT8_C(  99), -INT8_C( 109),  INT8_C( 126),  INT8_C(  90),  INT8_C(   0), -INT8_C(  72),
+        -INT8_C(  15), -INT8_C( 108),  INT8_C( 117), -INT8_C( 113), -INT8_C(  56),  INT8_C(  17), -INT8_C(  91), -INT8_C(  32),
+        -INT8_C(  41), -INT8_C(  44), -INT8_C(  61), -INT8_C(  70), -INT8_C(  51),  INT8_C(  78), -INT8_C(   4),  INT8_C(  55),
+         INT8_C(  81), -INT8_C(  57),  INT8_C(   0),  INT8_C( 110), -INT8_C(  90),  INT8_C( 119),  INT8_C(  33),  INT8_C(   1),
+         INT8_C(  11), -INT8_C(  15),  INT8_C(  12),  INT8_C( 114), -INT8_C(  16), -INT8_C( 127), -INT8_C( 114), -INT8_C(  83),
+         INT8_C(  36), -INT8_C(  28),  INT8_C(  47), -INT8_C(  53), -INT8_C(  84),  INT8_C( 107),  INT8_C( 111),  INT8_C(  17) },
+      {  INT64_C( 3305798223692829877),  INT64_C( 4672993070631320881),  INT64_C( 6704610810246760376), -INT64_C( 5208266128601551033),
+         INT64_C( 8110243708573408148),  INT64_C( 3555320392600690678),  INT64_C( 6781522742703124775), -INT64_C( 2173535614134537140) },
+      {  INT8_C(   0), -INT8_C(  16),  INT8_C(   0),  INT8_C(   0), -INT8_C(  96),  INT8_C(  17),  INT8_C(   8), -INT8_C( 106),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  49),
+         INT8_C(   0),  INT8_C( 123),  INT8_C(   0), -INT8_C(  64),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  93),
+        -INT8_C(  36),  INT8_C(  80), -INT8_C(  67),  INT8_C(   2),  INT8_C( 111),  INT8_C(   0),  INT8_C(  44),  INT8_C(   0),
+        -INT8_C(  74),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(  63),  INT8_C(   0),  INT8_C(   0),  INT8_C(  36),  INT8_C(  98),  INT8_C(   0), -INT8_C(   5),
+        -INT8_C(  82),  INT8_C(  14),  INT8_C(   0), -INT8_C( 121),  INT8_C(  28),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0), -INT8_C(  84),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  84),  INT8_C( 108) } },
+    { UINT64_C( 1964917986400795692),
+      { -INT8_C(  44), -INT8_C(   3),  INT8_C( 114), -INT8_C(  78), -INT8_C(  61),  INT8_C( 120),  INT8_C(   6),  INT8_C(  62),
+         INT8_C(  14), -INT8_C(  46), -INT8_C(  87), -INT8_C(  14), -INT8_C(  33), -INT8_C( 106), -INT8_C( 117), -INT8_C(  30),
+         INT8_C(  65), -INT8_C( 123),  INT8_C(  92), -INT8_C(  98),  INT8_C(  13), -INT8_C(  93), -INT8_C(  66), -INT8_C( 125),
+         INT8_C( 112),  INT8_C(  62), -INT8_C(   8), -INT8_C(  63), -INT8_C(  30), -INT8_C(  85), -INT8_C( 118),  INT8_C(  41),
+        -INT8_C(  19), -INT8_C( 126), -INT8_C(  51),  INT8_C( 106),  INT8_C( 100), -INT8_C(  68), -INT8_C(  47), -INT8_C(   4),
+        -INT8_C(  29),  INT8_C(  32), -INT8_C(  12),  INT8_C(  77), -INT8_C( 101),  INT8_C(  98),  INT8_C(  26), -INT8_C(  56),
+         INT8_C(  47),  INT8_C( 105), -INT8_C(   3), -INT8_C( 106), -INT8_C(  93), -INT8_C(  56), -INT8_C(  43),      INT8_MIN,
+         INT8_C( 105), -INT8_C(  85),  INT8_C(  56), -INT8_C(  36),  INT8_C( 107), -INT8_C(  19), -INT8_C(  46),  INT8_C(  53) },
+      {  INT64_C( 4264632024231654459),  INT64_C( 2105483523710262545),  INT64_C( 4255098038027950364),  INT64_C( 3892287802057887262),
+         INT64_C( 2810307955081290758),  INT64_C( 1164755596326673963),  INT64_C( 2826863112548195636),  INT64_C( 1441484113711596806) },
+      {  INT8_C(   0),  INT8_C(   0), -INT8_C(  53), -INT8_C(  53),  INT8_C(   0),  INT8_C(  59),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  23),  INT8_C(  78),  INT8_C(  56),  INT8_C(  28),  INT8_C(   3), -INT8_C( 121),
+        -INT8_C( 114),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  16), -INT8_C(  93),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  23),
+         INT8_C(   1),  INT8_C(   1), -INT8_C( 103),  INT8_C(  14), -INT8_C( 125),  INT8_C(  98),  INT8_C(   9),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(  11),  INT8_C(   0), -INT8_C( 104),  INT8_C(   0),  INT8_C(   0), -INT8_C(  52),  INT8_C(  30),
+         INT8_C(   0),  INT8_C(   0), -INT8_C(  95),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  32),  INT8_C(   0),
+        -INT8_C( 105),  INT8_C(  37),  INT8_C(   0), -INT8_C(  96),  INT8_C(  37),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C( 2915461806682256099),
+      {  INT8_C(  70),  INT8_C(  28), -INT8_C(  28), -INT8_C(  81),  INT8_C(  94), -INT8_C(  96),  INT8_C( 127), -INT8_C(  57),
+         INT8_C(  24),  INT8_C(  16), -INT8_C( 104), -INT8_C(  45),  INT8_C( 124),  INT8_C(   2), -INT8_C(  94),  INT8_C( 107),
+        -INT8_C( 119), -INT8_C(  70),  INT8_C(  57),  INT8_C( 117), -INT8_C(  53),  INT8_C( 110),  INT8_C(  24),  INT8_C(  54),
+        -INT8_C(  98),  INT8_C(  25), -INT8_C(   5),  INT8_C(  76), -INT8_C(  54),  INT8_C(  59), -INT8_C(  31), -INT8_C(  38),
+        -INT8_C(  23), -INT8_C(  44), -INT8_C(   5), -INT8_C(  50), -INT8_C(  47),  INT8_C( 114), -INT8_C( 116),  INT8_C(  33),
+        -INT8_C(  63), -INT8_C( 120),  INT8_C( 107), -INT8_C(  17),  INT8_C(  40),  INT8_C(  58),  INT8_C( 106), -INT8_C(  50),
+         INT8_C(  89),  INT8_C(  37),  INT8_C(   7),  INT8_C( 105),  INT8_C(  23),  INT8_C(  57),  INT8_C(  73), -INT8_C( 119),
+         INT8_C(  74), -INT8_C(   2),  INT8_C(  55), -INT8_C(  15),  INT8_C(  38),  INT8_C(  84), -INT8_C(  10),  INT8_C(  11) },
+      { -INT64_C( 1334208654019685731),  INT64_C( 2932799392881477024), -INT64_C( 7875815402923964468),  INT64_C( 6125284075000822005),
+        -INT64_C( 8903009316187324099), -INT64_C( 7295487001027276669), -INT64_C(   30940245629467489), -INT64_C( 6789528450806458774) },
+      {  INT8_C(  74), -INT8_C(  59),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  76),  INT8_C(  59),  INT8_C(  37),
+         INT8_C(   0),  INT8_C(  46),  INT8_C(   0),  INT8_C(   0),  INT8_C(   2),  INT8_C( 104),  INT8_C(   0),  INT8_C( 108),
+         INT8_C(  99),  INT8_C(  36),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  74),
+        -INT8_C(  90), -INT8_C(  33), -INT8_C(  86),  INT8_C( 127), -INT8_C(   2), -INT8_C(  86), -INT8_C(  76),  INT8_C( 111),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  84),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  65),  INT8_C(   0),  INT8_C(  39), -INT8_C( 126),  INT8_C(   0),  INT8_C(   0),  INT8_C(  78),  INT8_C(  40),
+         INT8_C(  88),  INT8_C(   0),  INT8_C(   9),  INT8_C(   0),  INT8_C(  99), -INT8_C(   1),  INT8_C(   2),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  29),  INT8_C(   0),  INT8_C(  20),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C(14302213830726199797),
+      { -INT8_C(  26), -INT8_C(   5), -INT8_C(  46),  INT8_C(  55),  INT8_C(   1), -INT8_C(  95), -INT8_C( 118), -INT8_C(  65),
+        -INT8_C( 108),  INT8_C(   9),  INT8_C(  59), -INT8_C( 119), -INT8_C(  90),  INT8_C( 119),  INT8_C(  11), -INT8_C(  69),
+        -INT8_C(  78),  INT8_C( 125),  INT8_C(  33),  INT8_C(  17), -INT8_C(  79), -INT8_C(  64), -INT8_C( 105), -INT8_C(  34),
+        -INT8_C(  45),  INT8_C(  58), -INT8_C( 124),  INT8_C(  33),  INT8_C(   7),  INT8_C(  61),  INT8_C(  67),  INT8_C(   3),
+         INT8_C(  67),  INT8_C(  39), -INT8_C(  55),  INT8_C(  92),  INT8_C(  28), -INT8_C(  88), -INT8_C(  99),  INT8_C( 114),
+        -INT8_C( 122),  INT8_C(  51), -INT8_C( 117), -INT8_C( 106),  INT8_C(  25),  INT8_C(  23), -INT8_C(   9), -INT8_C( 100),
+         INT8_C(  73), -INT8_C(  37), -INT8_C(  58),  INT8_C(  51),  INT8_C( 113),  INT8_C(  71),  INT8_C(  97), -INT8_C(  45),
+         INT8_C(  34), -INT8_C(   8), -INT8_C(  41), -INT8_C( 124),  INT8_C(  53), -INT8_C(  37),  INT8_C(  82), -INT8_C(  86) },
+      {  INT64_C( 3315270769076998203),  INT64_C( 2245891197532897559),  INT64_C( 1514359706282038821),  INT64_C( 2449969347964906044),
+         INT64_C( 2676845789809615122),  INT64_C( 4469545604993920047),  INT64_C( 2669537374606925106),  INT64_C( 1453031214925416481) },
+      { -INT8_C(  44),  INT8_C(   0),  INT8_C(  68),  INT8_C(   0),  INT8_C(  29), -INT8_C( 103), -INT8_C( 124),  INT8_C( 118),
+        -INT8_C( 110),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  62),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(  65),  INT8_C(   0),  INT8_C(  16), -INT8_C( 115), -INT8_C( 126),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   8),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  31),  INT8_C(  71),  INT8_C(  71),
+         INT8_C(  34),  INT8_C(  34),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3),  INT8_C(  17),  INT8_C(   0),  INT8_C(  73),
+        -INT8_C(  80), -INT8_C(  64),  INT8_C(   0),  INT8_C(  52),  INT8_C(   0),  INT8_C(  26),  INT8_C(   0), -INT8_C(  64),
+        -INT8_C( 114),  INT8_C(  38),  INT8_C(   0), -INT8_C(  95), -INT8_C( 122),  INT8_C(  58),  INT8_C(  12),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(  20),  INT8_C(  10),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  75), -INT8_C( 115) } },
+    { UINT64_C(10582737441878158774),
+      {  INT8_C( 109),  INT8_C(  83), -INT8_C(  55), -INT8_C( 116), -INT8_C(  57),  INT8_C(  80), -INT8_C(  54),  INT8_C(   3),
+        -INT8_C( 111), -INT8_C( 124), -INT8_C(  75),  INT8_C(  86), -INT8_C(  38),  INT8_C(  77), -INT8_C(  57),  INT8_C(  92),
+        -INT8_C(  28), -INT8_C( 101), -INT8_C(  30),  INT8_C(  35), -INT8_C(  89), -INT8_C( 112), -INT8_C( 109),  INT8_C(  88),
+         INT8_C( 104), -INT8_C( 114),  INT8_C(  55),  INT8_C(  53), -INT8_C( 115), -INT8_C(  50),  INT8_C( 123), -INT8_C(  91),
+         INT8_C(  68),  INT8_C(  16), -INT8_C(  60),  INT8_C(  55), -INT8_C(  91), -INT8_C( 118), -INT8_C(  19),  INT8_C(  34),
+        -INT8_C(  72),  INT8_C(  79), -INT8_C(  43), -INT8_C(  38),  INT8_C(  41),  INT8_C(  35),  INT8_C(  41),  INT8_C(  83),
+        -INT8_C(  93),  INT8_C(   2),  INT8_C(  14),  INT8_C(  56), -INT8_C(  22), -INT8_C(  61), -INT8_C(  18),  INT8_C(  55),
+        -INT8_C(  17),  INT8_C(  90), -INT8_C(  58), -INT8_C( 119),  INT8_C(  30), -INT8_C(  44),  INT8_C(  85), -INT8_C(   9) },
+      { -INT64_C( 7897492278808425938), -INT64_C( 3436773816923372215), -INT64_C( 3212380263431442629),  INT64_C( 7113963637849021352),
+        -INT64_C( 5832301662449455048), -INT64_C( 7099592944726133820),  INT64_C(  860780034483797592),  INT64_C( 3102187443479330087) },
+      {  INT8_C(   0),  INT8_C(  39), -INT8_C(  27),  INT8_C(   0), -INT8_C( 108),  INT8_C(  59),  INT8_C(   0),  INT8_C(  69),
+         INT8_C( 117),  INT8_C(   0), -INT8_C( 126),  INT8_C( 115),  INT8_C(   0),  INT8_C(  90),  INT8_C(   0), -INT8_C(  63),
+         INT8_C(  82),  INT8_C( 115),  INT8_C(  74), -INT8_C(  91), -INT8_C(  86),  INT8_C(   0),  INT8_C(  86),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(  37), -INT8_C(  59),  INT8_C(   0),  INT8_C(  74),  INT8_C(  37),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0), -INT8_C(  57),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  20),  INT8_C(   0),  INT8_C(  34),
+        -INT8_C(  99),  INT8_C( 117), -INT8_C(   3),  INT8_C(  63),  INT8_C(   0), -INT8_C(  70), -INT8_C( 106),  INT8_C(   0),
+         INT8_C(  92),  INT8_C(   0), -INT8_C(  98),  INT8_C(  11), -INT8_C( 122),  INT8_C(   0), -INT8_C(  56),  INT8_C(  23),
+         INT8_C(   0), -INT8_C(  52),  INT8_C(   0),  INT8_C(   0),  INT8_C(  44),  INT8_C(   0),  INT8_C(   0),  INT8_C(  86) } },
+    { UINT64_C( 2046910716817395338),
+      { -INT8_C( 105),  INT8_C(  82),  INT8_C(  36),  INT8_C(  62),  INT8_C( 126),  INT8_C( 114),  INT8_C(  14),  INT8_C(  64),
+        -INT8_C(  96), -INT8_C(  55), -INT8_C( 100), -INT8_C(  67),  INT8_C(  12), -INT8_C(   4),  INT8_C(  49), -INT8_C(   1),
+         INT8_C(  34),  INT8_C( 116),  INT8_C(   8),  INT8_C(  86), -INT8_C(  46),  INT8_C( 127), -INT8_C(  53),  INT8_C(  96),
+         INT8_C(  32),  INT8_C(  24), -INT8_C(  64), -INT8_C(  19),  INT8_C(  74),  INT8_C( 100), -INT8_C(  92),  INT8_C(  33),
+         INT8_C(   3),  INT8_C( 103),  INT8_C( 111), -INT8_C( 127),  INT8_C(  48), -INT8_C(   2), -INT8_C(  97),  INT8_C( 106),
+         INT8_C(  60), -INT8_C( 102),  INT8_C(  81), -INT8_C( 123),  INT8_C(  18), -INT8_C( 104), -INT8_C(  31),  INT8_C(  90),
+         INT8_C(  80), -INT8_C(   4),  INT8_C(  85), -INT8_C(  63),  INT8_C(  80), -INT8_C(  74), -INT8_C( 125), -INT8_C(  80),
+         INT8_C( 125),  INT8_C(   9), -INT8_C(  93),  INT8_C(  36), -INT8_C( 120), -INT8_C(   9), -INT8_C( 100), -INT8_C( 125) },
+      {  INT64_C(  733014762672694022),  INT64_C(  652498630964881721),  INT64_C( 2321104399120991804),  INT64_C(  945518581888592938),
+         INT64_C(  216751327835073578),  INT64_C( 2523203423235935495),  INT64_C( 2170768238226844446),  INT64_C( 1097755875649270559) },
+      {  INT8_C(   0),  INT8_C(  14),  INT8_C(   0),  INT8_C(  24),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   6),
+         INT8_C(   0), -INT8_C( 108), -INT8_C(  61), -INT8_C(  56),  INT8_C(   0),  INT8_C(   0), -INT8_C( 121),  INT8_C(   0),
+         INT8_C(   9),  INT8_C(   3),  INT8_C(   6),  INT8_C(   0),  INT8_C(  13),  INT8_C(   0),      INT8_MIN,  INT8_C(  39),
+         INT8_C(   0),  INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(  11), -INT8_C( 126),  INT8_C(   0),  INT8_C(  18),
+        -INT8_C( 123),  INT8_C(  28),  INT8_C(   0),  INT8_C(   0),  INT8_C(   2), -INT8_C(  88),  INT8_C(  94),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(  70),  INT8_C(   3),  INT8_C(   0), -INT8_C( 127),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 113),  INT8_C(   0),  INT8_C( 120),  INT8_C(  99),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C( 100),  INT8_C(  50),  INT8_C(  51),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { UINT64_C( 6104920838874291001),
+      { -INT8_C(  49), -INT8_C( 120), -INT8_C( 115),  INT8_C(  46),  INT8_C(  88),  INT8_C( 108),  INT8_C(  62), -INT8_C(  86),
+        -INT8_C(   7), -INT8_C( 106), -INT8_C(  99),  INT8_C(  84), -INT8_C(  70), -INT8_C(  73),  INT8_C( 102),  INT8_C( 114),
+             INT8_MIN,  INT8_C(   9),  INT8_C(  45), -INT8_C( 103),  INT8_C( 114),  INT8_C(  22),  INT8_C(  30),  INT8_C(  90),
+         INT8_C( 124),  INT8_C(  34),  INT8_C(  88),  INT8_C( 122), -INT8_C( 126),  INT8_C(  57), -INT8_C(  75), -INT8_C(  98),
+        -INT8_C(  15), -INT8_C(  94), -INT8_C(   3), -INT8_C( 124),  INT8_C( 103),  INT8_C(  41),  INT8_C(  83),  INT8_C(  95),
+        -INT8_C(  23), -INT8_C(  44),  INT8_C(  21), -INT8_C(  63),  INT8_C(  36),  INT8_C( 124),  INT8_C(  66),  INT8_C(  14),
+        -INT8_C(  96),  INT8_C(  69), -INT8_C( 103),  INT8_C( 116),  INT8_C(  60),  INT8_C(  72),  INT8_C(  78),  INT8_C(  68),
+         INT8_C(  14),  INT8_C( 114),  INT8_C(   4), -INT8_C( 122),  INT8_C( 119), -INT8_C(   1),  INT8_C(  94), -INT8_C(  64) },
+      { -INT64_C( 6149794358366383813), -INT64_C( 5906278378762954521),  INT64_C( 7873946412305232575), -INT64_C( 7470689790625722639),
+         INT64_C( 5723311247505818937),  INT64_C(  512015600282807623),  INT64_C(  691881325895943445),  INT64_C(  857082355053632219) },
+      { -INT8_C(  67),  INT8_C(   0),  INT8_C(   0), -INT8_C(  98),  INT8_C(  51),  INT8_C( 120),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C(  41), -INT8_C(  27),  INT8_C(   0), -INT8_C( 108), -INT8_C(  21),  INT8_C(   0), -INT8_C(  68),  INT8_C(   0),
+        -INT8_C(  65),  INT8_C(  25),  INT8_C(   0), -INT8_C(  94),  INT8_C(  81),  INT8_C(  23),  INT8_C(  45), -INT8_C(  47),
+         INT8_C(   0), -INT8_C(  51), -INT8_C( 126),  INT8_C( 102), -INT8_C(  68),  INT8_C(   0), -INT8_C(  62),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  83),  INT8_C(   0), -INT8_C(  92),  INT8_C(   0),  INT8_C(   0),
+        -INT8_C( 123),  INT8_C(   0),  INT8_C(   0), -INT8_C(  93),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C( 102),  INT8_C(   0),  INT8_C(   0), -INT8_C( 103),  INT8_C(  80),  INT8_C(   5),  INT8_C(   0),  INT8_C(  81),
+         INT8_C(   0),  INT8_C(   0), -INT8_C(  83),  INT8_C(   0),  INT8_C(  23),  INT8_C(   0),  INT8_C( 113),  INT8_C(   0) } },
+    { UINT64_C(   50239454131543081),
+      { -INT8_C(  47), -INT8_C( 100),  INT8_C(  17),  INT8_C(  59),  INT8_C(  39),  INT8_C(  43), -INT8_C( 115),  INT8_C(  76),
+         INT8_C(  90),  INT8_C(  72), -INT8_C(  78),  INT8_C(  51),  INT8_C( 115), -INT8_C(  25),  INT8_C(  46),  INT8_C(  14),
+        -INT8_C(  26),  INT8_C(  93), -INT8_C( 105), -INT8_C(  82),  INT8_C(  63),  INT8_C( 113),  INT8_C(   7), -INT8_C(  21),
+         INT8_C(  54),  INT8_C( 104),  INT8_C(  88),  INT8_C( 102), -INT8_C(  10),  INT8_C(  65),  INT8_C(  11),  INT8_C( 119),
+        -INT8_C(  75),  INT8_C(  72),  INT8_C(  28),  INT8_C(  60), -INT8_C(  30),  INT8_C(  71), -INT8_C(  95),  INT8_C( 106),
+         INT8_C(  78), -INT8_C(  66), -INT8_C( 105), -INT8_C( 124), -INT8_C(  21), -INT8_C(  40),  INT8_C(  63),  INT8_C(  21),
+         INT8_C(  79), -INT8_C(  29), -INT8_C(  84), -INT8_C(  17),  INT8_C( 126), -INT8_C(  70),  INT8_C( 105), -INT8_C(  87),
+         INT8_C(  22),  INT8_C(  66), -INT8_C(  68), -INT8_C(  63),  INT8_C( 100), -INT8_C( 108),  INT8_C(  39), -INT8_C( 113) },
+      {  INT64_C( 3964610420842310672),  INT64_C( 1313676706474757937),  INT64_C( 1303532611946288395),  INT64_C(    9903486505527866),
+         INT64_C(  794341188470053915),  INT64_C(  375506568816043523),  INT64_C( 3388678443603731245),  INT64_C(  582966743749890850) },
+      { -INT8_C( 113),  INT8_C(   0),  INT8_C(   0),  INT8_C(   6),  INT8_C(   0), -INT8_C(  92),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0), -INT8_C( 114),  INT8_C(  71),  INT8_C(  71),  INT8_C(   0), -INT8_C(  20),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  92),  INT8_C(  22),  INT8_C(  11),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  29),  INT8_C( 101),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0), -INT8_C(  93),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 124),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(  58),  INT8_C(  96), -INT8_C(  62),  INT8_C(  29),  INT8_C(   6),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(  34),  INT8_C(   0),  INT8_C(   0), -INT8_C(  76),  INT8_C(  75),  INT8_C(   0),      INT8_MIN,
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i r = simde_mm512_maskz_multishift_epi64_epi8(test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_multishift_epi64_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_multishift_epi64_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_multishift_epi64_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_multishift_epi64_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_multishift_epi64_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_multishift_epi64_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_multishift_epi64_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_multishift_epi64_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_multishift_epi64_epi8)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,2589 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN popcnt
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/popcnt.h>
+
+static int
+test_simde_mm_popcnt_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[16];
+    const int8_t r[16];
+  } test_vec[] = {
+    { {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+      {  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),
+         INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8) } },
+    { {  INT8_C(  16), -INT8_C(  61), -INT8_C( 124), -INT8_C(  63),  INT8_C(  72),  INT8_C(   0),  INT8_C(   0), -INT8_C(  64),
+         INT8_C(   0),  INT8_C(   0), -INT8_C( 124),  INT8_C(  16),  INT8_C(  72),  INT8_C(   0),  INT8_C(  82), -INT8_C(  14) },
+      {  INT8_C(   1),  INT8_C(   4),  INT8_C(   2),  INT8_C(   3),  INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   2),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   2),  INT8_C(   1),  INT8_C(   2),  INT8_C(   0),  INT8_C(   3),  INT8_C(   5) } },
+    { {  INT8_C(  32), -INT8_C( 118), -INT8_C(  56),  INT8_C(  42),      INT8_MIN, -INT8_C( 127), -INT8_C( 112), -INT8_C( 123),
+        -INT8_C( 124),  INT8_C(  13),  INT8_C(  12), -INT8_C( 104),  INT8_C(  37),  INT8_C(  20),  INT8_C(  74),  INT8_C(  36) },
+      {  INT8_C(   1),  INT8_C(   3),  INT8_C(   3),  INT8_C(   3),  INT8_C(   1),  INT8_C(   2),  INT8_C(   2),  INT8_C(   3),
+         INT8_C(   2),  INT8_C(   3),  INT8_C(   2),  INT8_C(   3),  INT8_C(   3),  INT8_C(   2),  INT8_C(   3),  INT8_C(   2) } },
+    { {  INT8_C(   0),  INT8_C(  16), -INT8_C( 124), -INT8_C( 112),  INT8_C(   8), -INT8_C( 123), -INT8_C(  96), -INT8_C( 115),
+         INT8_C(   8),  INT8_C(  84),  INT8_C(  66),  INT8_C(  64),  INT8_C(  41), -INT8_C(  32),  INT8_C(   0),  INT8_C(  24) },
+      {  INT8_C(   0),  INT8_C(   1),  INT8_C(   2),  INT8_C(   2),  INT8_C(   1),  INT8_C(   3),  INT8_C(   2),  INT8_C(   4),
+         INT8_C(   1),  INT8_C(   3),  INT8_C(   2),  INT8_C(   1),  INT8_C(   3),  INT8_C(   3),  INT8_C(   0),  INT8_C(   2) } },
+    { {  INT8_C( 111),  INT8_C(  73),  INT8_C(  71), -INT8_C(  87), -INT8_C(  68),  INT8_C(  27), -INT8_C(  47),  INT8_C( 102),
+        -INT8_C( 100),  INT8_C(  29), -INT8_C( 101), -INT8_C(  38),  INT8_C(  59), -INT8_C(   1), -INT8_C(  82),  INT8_C(  59) },
+      {  INT8_C(   6),  INT8_C(   3),  INT8_C(   4),  INT8_C(   4),  INT8_C(   5),  INT8_C(   4),  INT8_C(   4),  INT8_C(   4),
+         INT8_C(   4),  INT8_C(   4),  INT8_C(   5),  INT8_C(   5),  INT8_C(   5),  INT8_C(   8),  INT8_C(   5),  INT8_C(   5) } },
+    { {  INT8_C(  78), -INT8_C(  26),  INT8_C(  27), -INT8_C(  27), -INT8_C(   8), -INT8_C(  31), -INT8_C(  78), -INT8_C(  23),
+             INT8_MIN,  INT8_C(  83), -INT8_C(  73),  INT8_C(   2),  INT8_C( 124),  INT8_C( 110), -INT8_C( 122), -INT8_C(  77) },
+      {  INT8_C(   4),  INT8_C(   5),  INT8_C(   4),  INT8_C(   5),  INT8_C(   5),  INT8_C(   4),  INT8_C(   4),  INT8_C(   5),
+         INT8_C(   1),  INT8_C(   4),  INT8_C(   6),  INT8_C(   1),  INT8_C(   5),  INT8_C(   5),  INT8_C(   3),  INT8_C(   5) } },
+    { {  INT8_C(  66), -INT8_C(  48),  INT8_C(  13), -INT8_C(  37),  INT8_C(  42), -INT8_C(  38),  INT8_C(   7),  INT8_C(  57),
+        -INT8_C( 103),  INT8_C(   0),  INT8_C(  92),  INT8_C(  70), -INT8_C(  54), -INT8_C(  91),  INT8_C(  54),      INT8_MIN },
+      {  INT8_C(   2),  INT8_C(   3),  INT8_C(   3),  INT8_C(   6),  INT8_C(   3),  INT8_C(   5),  INT8_C(   3),  INT8_C(   4),
+         INT8_C(   4),  INT8_C(   0),  INT8_C(   4),  INT8_C(   3),  INT8_C(   4),  INT8_C(   4),  INT8_C(   4),  INT8_C(   1) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i r = simde_mm_popcnt_epi8(a);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_popcnt_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[16];
+    const simde__mmask16 k;
+    const int8_t a[16];
+    const int8_t r[16];
+  } test_vec[] = {
+    { {  INT8_C(  65),  INT8_C(  17), -INT8_C( 127),  INT8_C(  10),  INT8_C(  48),  INT8_C( 112),  INT8_C(   8),  INT8_C(  60),
+        -INT8_C(  64), -INT8_C(   9),  INT8_C(  86),  INT8_C( 102), -INT8_C(  46), -INT8_C( 109),  INT8_C( 122),  INT8_C(  30) },
+      UINT16_C(59020),
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+      {  INT8_C(  65),  INT8_C(  17),  INT8_C(   0),  INT8_C(   0),  INT8_C(  48),  INT8_C( 112),  INT8_C(   8),  INT8_C(   0),
+        -INT8_C(  64),  INT8_C(   0),  INT8_C(   0),  INT8_C( 102), -INT8_C(  46),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { {  INT8_C(  67),  INT8_C(  55), -INT8_C(  67),  INT8_C(  54),  INT8_C(  54),  INT8_C(  88),  INT8_C(  76), -INT8_C(  74),
+         INT8_C(   1),  INT8_C(  89), -INT8_C(  37), -INT8_C(  10), -INT8_C(  23),  INT8_C(  14),  INT8_C( 110), -INT8_C(  64) },
+      UINT16_C(28572),
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+      {  INT8_C(  67),  INT8_C(  55),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(  88),  INT8_C(  76),  INT8_C(   8),
+         INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8), -INT8_C(  23),  INT8_C(   8),  INT8_C(   8), -INT8_C(  64) } },
+    { {  INT8_C(  61),  INT8_C(  73), -INT8_C(  75), -INT8_C(  48),  INT8_C(  63), -INT8_C(  21), -INT8_C( 116), -INT8_C(  87),
+        -INT8_C(  22), -INT8_C( 121), -INT8_C( 116),  INT8_C(  85), -INT8_C(  75),  INT8_C(  70),  INT8_C( 106),  INT8_C(  42) },
+      UINT16_C(14857),
+      { -INT8_C(  94),  INT8_C(  34),  INT8_C(   4),  INT8_C(   0),      INT8_MIN,  INT8_C(  65),  INT8_C(  32),  INT8_C(  44),
+         INT8_C(  52),  INT8_C(  68),  INT8_C(  66),  INT8_C(  16),  INT8_C(  97), -INT8_C(  59),  INT8_C(  50),  INT8_C(   0) },
+      {  INT8_C(   3),  INT8_C(  73), -INT8_C(  75),  INT8_C(   0),  INT8_C(  63), -INT8_C(  21), -INT8_C( 116), -INT8_C(  87),
+        -INT8_C(  22),  INT8_C(   2), -INT8_C( 116),  INT8_C(   1),  INT8_C(   3),  INT8_C(   4),  INT8_C( 106),  INT8_C(  42) } },
+    { {  INT8_C(  25), -INT8_C(   5),  INT8_C( 124),  INT8_C(  64),      INT8_MIN, -INT8_C(  11),  INT8_C(  80),  INT8_C(  90),
+        -INT8_C(  26),  INT8_C(  35), -INT8_C(  27),  INT8_C( 126),  INT8_C( 102),  INT8_C(  50),  INT8_C(  16),  INT8_C(   2) },
+      UINT16_C(22196),
+      { -INT8_C( 125),  INT8_C(   8),  INT8_C( 108), -INT8_C(  72),  INT8_C(  10), -INT8_C(  54),  INT8_C(  64),  INT8_C( 116),
+         INT8_C(   0),  INT8_C(   5),  INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(   6), -INT8_C(   3),  INT8_C(   0) },
+      {  INT8_C(  25), -INT8_C(   5),  INT8_C(   4),  INT8_C(  64),  INT8_C(   2),  INT8_C(   4),  INT8_C(  80),  INT8_C(   4),
+        -INT8_C(  26),  INT8_C(   2),  INT8_C(   0),  INT8_C( 126),  INT8_C(   1),  INT8_C(  50),  INT8_C(   7),  INT8_C(   2) } },
+    { { -INT8_C(   4),  INT8_C( 103),  INT8_C(  27),  INT8_C(  33), -INT8_C( 107),  INT8_C(  56),  INT8_C( 110),  INT8_C( 110),
+         INT8_C(  68), -INT8_C(  76),  INT8_C( 101),  INT8_C(  85), -INT8_C( 127),  INT8_C(  96),  INT8_C(   4),  INT8_C( 114) },
+      UINT16_C(46801),
+      {  INT8_C(  57),  INT8_C(  16),  INT8_C(  26),  INT8_C(   0),  INT8_C(   5),  INT8_C(   1),  INT8_C(   8),  INT8_C(  16),
+         INT8_C(  48), -INT8_C(  61),      INT8_MIN,  INT8_C(   3),  INT8_C(   0), -INT8_C(  92),  INT8_C(  48),  INT8_C(  56) },
+      {  INT8_C(   4),  INT8_C( 103),  INT8_C(  27),  INT8_C(  33),  INT8_C(   2),  INT8_C(  56),  INT8_C(   1),  INT8_C(   1),
+         INT8_C(  68),  INT8_C(   4),  INT8_C(   1),  INT8_C(  85),  INT8_C(   0),  INT8_C(   3),  INT8_C(   4),  INT8_C(   3) } },
+    { { -INT8_C(  94), -INT8_C(  61), -INT8_C( 112), -INT8_C(  67), -INT8_C(  96),  INT8_C(  91), -INT8_C( 115), -INT8_C(  70),
+        -INT8_C(  33), -INT8_C( 108), -INT8_C(  17), -INT8_C(  88),  INT8_C(  47), -INT8_C(  27),  INT8_C(  76), -INT8_C(  52) },
+      UINT16_C(41377),
+      { -INT8_C( 113),  INT8_C(  90),  INT8_C(  32),  INT8_C(  18), -INT8_C( 110),  INT8_C(  45), -INT8_C(  33),  INT8_C(  46),
+         INT8_C(  58),  INT8_C( 112), -INT8_C(  52), -INT8_C(   3), -INT8_C( 114), -INT8_C(   3),  INT8_C(  64), -INT8_C(  14) },
+      {  INT8_C(   5), -INT8_C(  61), -INT8_C( 112), -INT8_C(  67), -INT8_C(  96),  INT8_C(   4), -INT8_C( 115),  INT8_C(   4),
+         INT8_C(   4), -INT8_C( 108), -INT8_C(  17), -INT8_C(  88),  INT8_C(  47),  INT8_C(   7),  INT8_C(  76),  INT8_C(   5) } },
+    { {  INT8_C(  23), -INT8_C(  25),  INT8_C( 124),  INT8_C(  24), -INT8_C(  46),  INT8_C( 109),  INT8_C(  53),  INT8_C(  65),
+         INT8_C(  55),  INT8_C(  45), -INT8_C( 103), -INT8_C( 112),  INT8_C(   9), -INT8_C(  63),  INT8_C(  56),  INT8_C(  46) },
+      UINT16_C(50064),
+      { -INT8_C( 107),  INT8_C(  12), -INT8_C(  86), -INT8_C(  61),  INT8_C( 122), -INT8_C(  40), -INT8_C( 113),  INT8_C(  18),
+        -INT8_C(  98), -INT8_C(  51),  INT8_C(  62), -INT8_C( 114),  INT8_C(  57), -INT8_C(   5), -INT8_C( 114),  INT8_C( 101) },
+      {  INT8_C(  23), -INT8_C(  25),  INT8_C( 124),  INT8_C(  24),  INT8_C(   5),  INT8_C( 109),  INT8_C(  53),  INT8_C(   2),
+         INT8_C(   5),  INT8_C(   5), -INT8_C( 103), -INT8_C( 112),  INT8_C(   9), -INT8_C(  63),  INT8_C(   4),  INT8_C(   4) } },
+    { {  INT8_C(   6), -INT8_C(  72),  INT8_C(  83), -INT8_C(  63), -INT8_C(   8), -INT8_C(  25),  INT8_C(  64), -INT8_C( 122),
+         INT8_C(  23), -INT8_C(   5),  INT8_C(   6),  INT8_C( 112), -INT8_C(  56),  INT8_C(  53), -INT8_C(  31),  INT8_C(  76) },
+      UINT16_C(37156),
+      {  INT8_C(  63), -INT8_C(  61),  INT8_C(  62), -INT8_C(  84),  INT8_C( 121),  INT8_C(   5), -INT8_C(  65), -INT8_C( 124),
+         INT8_C( 123),  INT8_C(   3), -INT8_C(  91),  INT8_C(  64),  INT8_C(   8), -INT8_C( 102),  INT8_C(  71), -INT8_C(  49) },
+      {  INT8_C(   6), -INT8_C(  72),  INT8_C(   5), -INT8_C(  63), -INT8_C(   8),  INT8_C(   2),  INT8_C(  64), -INT8_C( 122),
+         INT8_C(   6), -INT8_C(   5),  INT8_C(   6),  INT8_C( 112),  INT8_C(   1),  INT8_C(  53), -INT8_C(  31),  INT8_C(   6) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi8(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_popcnt_epi8(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_popcnt_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int8_t a[16];
+    const int8_t r[16];
+  } test_vec[] = {
+    {       UINT16_C(34982),
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    {       UINT16_C(64941),
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+      {  INT8_C(   8),  INT8_C(   0),  INT8_C(   8),  INT8_C(   8),  INT8_C(   0),  INT8_C(   8),  INT8_C(   0),  INT8_C(   8),
+         INT8_C(   8),  INT8_C(   0),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8) } },
+    {       UINT16_C(16848),
+      {  INT8_C(  17),  INT8_C(   1),  INT8_C(  66), -INT8_C( 108),  INT8_C(  20),  INT8_C(  11),  INT8_C(   2), -INT8_C(  96),
+         INT8_C(   8),  INT8_C(  72), -INT8_C(  88),  INT8_C(  70), -INT8_C(  92), -INT8_C( 112),  INT8_C(  28),  INT8_C(   0) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   2),  INT8_C(   0),  INT8_C(   1),  INT8_C(   2),
+         INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3),  INT8_C(   0) } },
+    {       UINT16_C(58597),
+      {  INT8_C(   2),  INT8_C(   1),  INT8_C(  17), -INT8_C( 122),  INT8_C(  32),  INT8_C(   2),  INT8_C(   0), -INT8_C( 117),
+         INT8_C(  84),  INT8_C(   0),      INT8_MIN,  INT8_C(   0), -INT8_C( 119), -INT8_C(  60),  INT8_C(  33),  INT8_C(   2) },
+      {  INT8_C(   1),  INT8_C(   0),  INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   4),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3),  INT8_C(   2),  INT8_C(   1) } },
+    {       UINT16_C(26626),
+      {  INT8_C(   5),      INT8_MIN,  INT8_C(   8),  INT8_C(  12),  INT8_C(   0),  INT8_C(   5),  INT8_C(  48), -INT8_C( 112),
+         INT8_C(  14),  INT8_C(  80),  INT8_C(  84),  INT8_C(   0),  INT8_C(  65),  INT8_C(  19),  INT8_C(  36), -INT8_C(  88) },
+      {  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3),  INT8_C(   2),  INT8_C(   0) } },
+    {       UINT16_C(40119),
+      { -INT8_C(  79), -INT8_C( 118), -INT8_C( 107), -INT8_C( 102), -INT8_C(  59),  INT8_C(  28), -INT8_C( 126),  INT8_C( 101),
+        -INT8_C( 115), -INT8_C(  96),  INT8_C(  13), -INT8_C(   3), -INT8_C(  38),  INT8_C(  89), -INT8_C( 101), -INT8_C(   4) },
+      {  INT8_C(   4),  INT8_C(   3),  INT8_C(   4),  INT8_C(   0),  INT8_C(   4),  INT8_C(   3),  INT8_C(   0),  INT8_C(   4),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   3),  INT8_C(   7),  INT8_C(   5),  INT8_C(   0),  INT8_C(   0),  INT8_C(   6) } },
+    {       UINT16_C(35874),
+      {  INT8_C( 103),  INT8_C(   9),  INT8_C(  79), -INT8_C(  49), -INT8_C(  16),  INT8_C(  11),  INT8_C(  29),  INT8_C(  17),
+        -INT8_C(  89),  INT8_C(  28), -INT8_C(  38),  INT8_C( 119),  INT8_C( 107),  INT8_C( 125), -INT8_C(  25),  INT8_C( 104) },
+      {  INT8_C(   0),  INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   5),  INT8_C(   6),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3) } },
+    {       UINT16_C(57435),
+      { -INT8_C(  92), -INT8_C(  79),  INT8_C( 114),  INT8_C(  60),  INT8_C(  26),  INT8_C(  34), -INT8_C( 100), -INT8_C(  67),
+         INT8_C(  82),  INT8_C(  96), -INT8_C(  98),  INT8_C( 125), -INT8_C( 127), -INT8_C( 112), -INT8_C( 119), -INT8_C(  30) },
+      {  INT8_C(   3),  INT8_C(   4),  INT8_C(   0),  INT8_C(   4),  INT8_C(   3),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   2),  INT8_C(   3),  INT8_C(   4) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_popcnt_epi8(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_popcnt_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t a[8];
+    const int16_t r[8];
+  } test_vec[] = {
+    { {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { { -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1) },
+      {  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16) } },
+    { {  INT16_C(  8193),  INT16_C(  4172),  INT16_C( 17920), -INT16_C( 26542),  INT16_C(  2705),  INT16_C( 17160),  INT16_C(  4290), -INT16_C( 28670) },
+      {  INT16_C(     2),  INT16_C(     4),  INT16_C(     3),  INT16_C(     6),  INT16_C(     5),  INT16_C(     4),  INT16_C(     4),  INT16_C(     3) } },
+    { {  INT16_C( 16960),  INT16_C( 21600),  INT16_C(  8256), -INT16_C( 15096), -INT16_C( 11326),  INT16_C(  8710),  INT16_C( 16916),  INT16_C(     0) },
+      {  INT16_C(     3),  INT16_C(     5),  INT16_C(     2),  INT16_C(     5),  INT16_C(     8),  INT16_C(     4),  INT16_C(     4),  INT16_C(     0) } },
+    { {  INT16_C( 18824), -INT16_C( 18400),  INT16_C( 27786),        INT16_MIN, -INT16_C( 12280),  INT16_C(  4416),  INT16_C( 16902),  INT16_C(  1028) },
+      {  INT16_C(     5),  INT16_C(     5),  INT16_C(     7),  INT16_C(     1),  INT16_C(     4),  INT16_C(     3),  INT16_C(     4),  INT16_C(     2) } },
+    { {  INT16_C( 20763),  INT16_C( 14977),  INT16_C( 15926), -INT16_C(  8782), -INT16_C( 25008), -INT16_C(  3889), -INT16_C( 24793), -INT16_C( 29802) },
+      {  INT16_C(     7),  INT16_C(     6),  INT16_C(     9),  INT16_C(    10),  INT16_C(     7),  INT16_C(    10),  INT16_C(    10),  INT16_C(     8) } },
+    { {  INT16_C(  7917),  INT16_C( 18324), -INT16_C( 10581),  INT16_C(  9475),  INT16_C( 29873),  INT16_C(  9102),  INT16_C( 26825), -INT16_C( 26652) },
+      {  INT16_C(    10),  INT16_C(     7),  INT16_C(    10),  INT16_C(     5),  INT16_C(     8),  INT16_C(     7),  INT16_C(     7),  INT16_C(     9) } },
+    { { -INT16_C( 27584), -INT16_C(  4883), -INT16_C( 17055),  INT16_C( 16304),  INT16_C(   225),  INT16_C( 30802),  INT16_C( 32262),  INT16_C( 11780) },
+      {  INT16_C(     4),  INT16_C(    11),  INT16_C(     9),  INT16_C(     9),  INT16_C(     4),  INT16_C(     7),  INT16_C(     8),  INT16_C(     5) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i r = simde_mm_popcnt_epi16(a);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_popcnt_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[8];
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t r[8];
+  } test_vec[] = {
+    { { -INT16_C(  3650), -INT16_C(  1024), -INT16_C( 19787),  INT16_C(  6511),  INT16_C( 17597),  INT16_C( 24472),  INT16_C( 30985), -INT16_C( 10435) },
+      UINT8_C(104),
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      { -INT16_C(  3650), -INT16_C(  1024), -INT16_C( 19787),  INT16_C(     0),  INT16_C( 17597),  INT16_C(     0),  INT16_C(     0), -INT16_C( 10435) } },
+    { {  INT16_C( 30353), -INT16_C(  6160),  INT16_C( 11774),  INT16_C(  2787), -INT16_C( 15898), -INT16_C( 24176), -INT16_C(  5646),  INT16_C( 10736) },
+      UINT8_C( 21),
+      { -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1) },
+      {  INT16_C(    16), -INT16_C(  6160),  INT16_C(    16),  INT16_C(  2787),  INT16_C(    16), -INT16_C( 24176), -INT16_C(  5646),  INT16_C( 10736) } },
+    { {  INT16_C( 22257), -INT16_C(  3516),  INT16_C( 30427),  INT16_C(  6528), -INT16_C( 22259),  INT16_C( 20432), -INT16_C( 32007), -INT16_C(  5861) },
+      UINT8_C(152),
+      {  INT16_C( 26882),  INT16_C(  3596),  INT16_C(  8726),  INT16_C(     2),  INT16_C(  8450),  INT16_C( 14618),  INT16_C(   224),  INT16_C(   386) },
+      {  INT16_C( 22257), -INT16_C(  3516),  INT16_C( 30427),  INT16_C(     1),  INT16_C(     3),  INT16_C( 20432), -INT16_C( 32007),  INT16_C(     3) } },
+    { {  INT16_C( 22012),  INT16_C( 18239), -INT16_C(  9973), -INT16_C( 14880), -INT16_C(  8170), -INT16_C( 22723), -INT16_C( 22564),  INT16_C(   462) },
+      UINT8_C(157),
+      {  INT16_C(   172), -INT16_C( 31360),  INT16_C( 24698),  INT16_C(  4263), -INT16_C( 24534),  INT16_C(  1073),  INT16_C(    16),  INT16_C( 17249) },
+      {  INT16_C(     4),  INT16_C( 18239),  INT16_C(     7),  INT16_C(     6),  INT16_C(     5), -INT16_C( 22723), -INT16_C( 22564),  INT16_C(     6) } },
+    { {  INT16_C( 31106), -INT16_C( 32401), -INT16_C( 26076), -INT16_C(  8355),  INT16_C(  2136), -INT16_C( 18324),  INT16_C( 25223), -INT16_C( 25112) },
+      UINT8_C(112),
+      { -INT16_C( 30200), -INT16_C( 32032),  INT16_C(     2), -INT16_C( 32544),  INT16_C(  2752),  INT16_C(     2), -INT16_C( 31232),  INT16_C( 12288) },
+      {  INT16_C( 31106), -INT16_C( 32401), -INT16_C( 26076), -INT16_C(  8355),  INT16_C(     4),  INT16_C(     1),  INT16_C(     3), -INT16_C( 25112) } },
+    { {  INT16_C( 11722), -INT16_C( 23927),  INT16_C(  9041),  INT16_C( 17271), -INT16_C( 31457), -INT16_C(  8124), -INT16_C(  9351),  INT16_C( 29302) },
+      UINT8_C(191),
+      {  INT16_C( 24022), -INT16_C( 13165),  INT16_C(  3809), -INT16_C( 18482), -INT16_C( 28042),  INT16_C( 31085),  INT16_C(  7965), -INT16_C( 29317) },
+      {  INT16_C(    10),  INT16_C(     8),  INT16_C(     7),  INT16_C(    11),  INT16_C(     8),  INT16_C(    10), -INT16_C(  9351),  INT16_C(    10) } },
+    { { -INT16_C(   345),  INT16_C( 15137),  INT16_C( 22283),  INT16_C( 29475), -INT16_C( 25867), -INT16_C( 25441), -INT16_C(  5841), -INT16_C( 11222) },
+      UINT8_C(210),
+      { -INT16_C( 26730), -INT16_C( 18910), -INT16_C(  6455), -INT16_C( 20249), -INT16_C( 32125), -INT16_C( 22659),  INT16_C( 25118),  INT16_C( 18406) },
+      { -INT16_C(   345),  INT16_C(     7),  INT16_C( 22283),  INT16_C( 29475),  INT16_C(     5), -INT16_C( 25441),  INT16_C(     7),  INT16_C(     9) } },
+    { {  INT16_C( 26042),  INT16_C( 20773), -INT16_C( 10075), -INT16_C( 32469), -INT16_C(  8614),  INT16_C( 14469),  INT16_C( 10710),  INT16_C( 24427) },
+      UINT8_C(120),
+      {  INT16_C( 28130), -INT16_C( 19325),  INT16_C( 19153), -INT16_C( 20018),  INT16_C( 13720),  INT16_C( 29899), -INT16_C( 13730),  INT16_C( 26359) },
+      {  INT16_C( 26042),  INT16_C( 20773), -INT16_C( 10075),  INT16_C(     9),  INT16_C(     7),  INT16_C(     9),  INT16_C(     9),  INT16_C( 24427) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi16(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_popcnt_epi16(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_popcnt_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t r[8];
+  } test_vec[] = {
+    {       UINT8_C(241),
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    {       UINT8_C(152),
+      { -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(    16),  INT16_C(    16),  INT16_C(     0),  INT16_C(     0),  INT16_C(    16) } },
+    {       UINT8_C(101),
+      {  INT16_C(   412),  INT16_C(  9216),  INT16_C( 13514),  INT16_C( 19081),  INT16_C( 27180),  INT16_C(    10),  INT16_C(     0),  INT16_C(    96) },
+      {  INT16_C(     5),  INT16_C(     0),  INT16_C(     7),  INT16_C(     0),  INT16_C(     0),  INT16_C(     2),  INT16_C(     0),  INT16_C(     0) } },
+    {       UINT8_C(243),
+      {  INT16_C( 16420),  INT16_C(  8321),  INT16_C(  3904), -INT16_C( 32640),  INT16_C( 30784), -INT16_C( 20376),  INT16_C(  3680), -INT16_C( 32583) },
+      {  INT16_C(     3),  INT16_C(     3),  INT16_C(     0),  INT16_C(     0),  INT16_C(     5),  INT16_C(     6),  INT16_C(     5),  INT16_C(     6) } },
+    {       UINT8_C(157),
+      {  INT16_C( 25109),  INT16_C(  8192),  INT16_C( 11074),  INT16_C(   516),  INT16_C(    28),  INT16_C(  1668),  INT16_C(  1024),  INT16_C(   624) },
+      {  INT16_C(     6),  INT16_C(     0),  INT16_C(     6),  INT16_C(     2),  INT16_C(     3),  INT16_C(     0),  INT16_C(     0),  INT16_C(     4) } },
+    {       UINT8_C(148),
+      {  INT16_C( 24937),  INT16_C( 17577), -INT16_C( 22520), -INT16_C( 26931),  INT16_C( 16569), -INT16_C( 20434), -INT16_C( 20715), -INT16_C(  4584) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     4),  INT16_C(     0),  INT16_C(     6),  INT16_C(     0),  INT16_C(     0),  INT16_C(     8) } },
+    {       UINT8_C( 89),
+      { -INT16_C( 12218),  INT16_C(  8015),  INT16_C( 31971), -INT16_C( 32182), -INT16_C( 23749),  INT16_C( 16440),  INT16_C( 32370), -INT16_C( 32328) },
+      {  INT16_C(     6),  INT16_C(     0),  INT16_C(     0),  INT16_C(     5),  INT16_C(     9),  INT16_C(     0),  INT16_C(    10),  INT16_C(     0) } },
+    {       UINT8_C(  6),
+      {  INT16_C( 29722),  INT16_C( 24982), -INT16_C( 15575), -INT16_C( 24080), -INT16_C(  2516), -INT16_C( 21843),  INT16_C(  2351),  INT16_C( 17717) },
+      {  INT16_C(     0),  INT16_C(     7),  INT16_C(     7),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_popcnt_epi16(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_popcnt_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1) },
+      {  INT32_C(          32),  INT32_C(          32),  INT32_C(          32),  INT32_C(          32) } },
+    { { -INT32_C(  2125578160), -INT32_C(  2063527902),  INT32_C(     8717336),  INT32_C(   810026506) },
+      {  INT32_C(           9),  INT32_C(           7),  INT32_C(           6),  INT32_C(           8) } },
+    { { -INT32_C(   736611992),  INT32_C(     3280905), -INT32_C(  1543371388),  INT32_C(  1208230020) },
+      {  INT32_C(          12),  INT32_C(           6),  INT32_C(           8),  INT32_C(           6) } },
+    { {  INT32_C(   541131272),  INT32_C(    69358728),  INT32_C(    43256585), -INT32_C(   886040792) },
+      {  INT32_C(           5),  INT32_C(           8),  INT32_C(           9),  INT32_C(          13) } },
+    { {  INT32_C(    10553137),  INT32_C(   557025302),  INT32_C(  1691090561),  INT32_C(  1677780924) },
+      {  INT32_C(           9),  INT32_C(          11),  INT32_C(          17),  INT32_C(          14) } },
+    { {  INT32_C(   913853133),  INT32_C(   824955396), -INT32_C(   805818185), -INT32_C(  2090640432) },
+      {  INT32_C(          16),  INT32_C(          12),  INT32_C(          19),  INT32_C(          15) } },
+    { {  INT32_C(  2078472628), -INT32_C(   711710485),  INT32_C(   734975916),  INT32_C(  1316922197) },
+      {  INT32_C(          20),  INT32_C(          16),  INT32_C(          19),  INT32_C(          18) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i r = simde_mm_popcnt_epi32(a);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_popcnt_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(   342967394),  INT32_C(  1715617386), -INT32_C(  1545702360), -INT32_C(  1803754110) },
+      UINT8_C(185),
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(  1715617386), -INT32_C(  1545702360),  INT32_C(           0) } },
+    { { -INT32_C(   448925461), -INT32_C(   557061534), -INT32_C(  1686918921),  INT32_C(  1748797868) },
+      UINT8_C(198),
+      { -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1) },
+      { -INT32_C(   448925461),  INT32_C(          32),  INT32_C(          32),  INT32_C(  1748797868) } },
+    { { -INT32_C(   137038464),  INT32_C(  1307458154), -INT32_C(  1482942315), -INT32_C(   792780880) },
+      UINT8_C(139),
+      { -INT32_C(  2139049980), -INT32_C(   264896338),  INT32_C(  1212425943),  INT32_C(   688984008) },
+      {  INT32_C(           6),  INT32_C(          13), -INT32_C(  1482942315),  INT32_C(          12) } },
+    { { -INT32_C(   944594980), -INT32_C(  1623985552),  INT32_C(  1451701166),  INT32_C(   269366848) },
+      UINT8_C(217),
+      { -INT32_C(  1936449404),  INT32_C(   151278912), -INT32_C(  1188929390),  INT32_C(    27828714) },
+      {  INT32_C(           9), -INT32_C(  1623985552),  INT32_C(  1451701166),  INT32_C(          12) } },
+    { { -INT32_C(  2070060632), -INT32_C(  1791287443), -INT32_C(   168629320),  INT32_C(  1900780100) },
+      UINT8_C(223),
+      { -INT32_C(  1811939066),  INT32_C(     1720451),  INT32_C(   136359202),  INT32_C(  1342183458) },
+      {  INT32_C(           6),  INT32_C(           7),  INT32_C(           9),  INT32_C(           6) } },
+    { { -INT32_C(   105634603), -INT32_C(   483301890),  INT32_C(  2092371446), -INT32_C(  1298197586) },
+      UINT8_C(194),
+      {  INT32_C(  1583616149), -INT32_C(   241912850), -INT32_C(   219810238),  INT32_C(    30938781) },
+      { -INT32_C(   105634603),  INT32_C(          19),  INT32_C(  2092371446), -INT32_C(  1298197586) } },
+    { {  INT32_C(   765648703),  INT32_C(  1242338665),  INT32_C(   733000120), -INT32_C(  1149941493) },
+      UINT8_C( 17),
+      { -INT32_C(  2134390218),  INT32_C(   698022199), -INT32_C(  1409356957),  INT32_C(  1700360068) },
+      {  INT32_C(          14),  INT32_C(  1242338665),  INT32_C(   733000120), -INT32_C(  1149941493) } },
+    { { -INT32_C(   606018688), -INT32_C(  1316175468), -INT32_C(  1002678238), -INT32_C(  2144958661) },
+      UINT8_C(227),
+      {  INT32_C(  1109137516),  INT32_C(  1918022528), -INT32_C(  1134291366),  INT32_C(  1314536687) },
+      {  INT32_C(          11),  INT32_C(          13), -INT32_C(  1002678238), -INT32_C(  2144958661) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_popcnt_epi32(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_popcnt_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    {       UINT8_C(112),
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    {       UINT8_C(176),
+      { -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    {       UINT8_C( 28),
+      {  INT32_C(   588384262),  INT32_C(  1631600771), -INT32_C(   536870783),  INT32_C(   536936473) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           5),  INT32_C(           5) } },
+    {       UINT8_C(235),
+      { -INT32_C(  1877954240),  INT32_C(   269517320),  INT32_C(  2081473892),  INT32_C(   369104932) },
+      {  INT32_C(           8),  INT32_C(           5),  INT32_C(           0),  INT32_C(           7) } },
+    {       UINT8_C(144),
+      {  INT32_C(     9470020), -INT32_C(  2043665856),  INT32_C(   805847073), -INT32_C(  1576630268) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    {       UINT8_C(122),
+      { -INT32_C(  1707284526),  INT32_C(   982083849), -INT32_C(  1634346944),  INT32_C(   668777275) },
+      {  INT32_C(           0),  INT32_C(          13),  INT32_C(           0),  INT32_C(          20) } },
+    {       UINT8_C( 91),
+      {  INT32_C(  1149456711), -INT32_C(  1170337280), -INT32_C(  1898066809), -INT32_C(   321451691) },
+      {  INT32_C(          12),  INT32_C(          12),  INT32_C(           0),  INT32_C(          17) } },
+    {       UINT8_C( 47),
+      {  INT32_C(   261804867),  INT32_C(  1026662123),  INT32_C(  2025548097),  INT32_C(  1850011610) },
+      {  INT32_C(          16),  INT32_C(          19),  INT32_C(          16),  INT32_C(          19) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_popcnt_epi32(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_popcnt_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { {  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { { -INT64_C(                   1), -INT64_C(                   1) },
+      {  INT64_C(                  64),  INT64_C(                  64) } },
+    { {  INT64_C( 1153227100159476342),  INT64_C(   74468209396686884) },
+      {  INT64_C(                  20),  INT64_C(                  15) } },
+    { { -INT64_C( 8001277433396658176),  INT64_C( 8079827455231676945) },
+      {  INT64_C(                  18),  INT64_C(                  19) } },
+    { {  INT64_C( 1470432012850700620), -INT64_C( 8069002810172108254) },
+      {  INT64_C(                  16),  INT64_C(                  16) } },
+    { {  INT64_C( 8643749050406532200), -INT64_C( 1192466418564999011) },
+      {  INT64_C(                  39),  INT64_C(                  35) } },
+    { { -INT64_C( 7106951388936798110),  INT64_C(   77444737940584988) },
+      {  INT64_C(                  29),  INT64_C(                  28) } },
+    { {  INT64_C( 4296088167502333161), -INT64_C( 4880010870011878687) },
+      {  INT64_C(                  36),  INT64_C(                  33) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i r = simde_mm_popcnt_epi64(a);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_popcnt_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[2];
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { { -INT64_C( 2435654055346189641), -INT64_C( 2535232117043477359) },
+      UINT8_C( 37),
+      {  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0), -INT64_C( 2535232117043477359) } },
+    { { -INT64_C( 9014154945603977015),  INT64_C( 1720014168835921665) },
+      UINT8_C(248),
+      { -INT64_C(                   1), -INT64_C(                   1) },
+      { -INT64_C( 9014154945603977015),  INT64_C( 1720014168835921665) } },
+    { { -INT64_C( 6786231293813781534),  INT64_C( 2108651233237190574) },
+      UINT8_C(203),
+      {  INT64_C( 2382415344032621337),  INT64_C( 5242357677618659908) },
+      {  INT64_C(                  15),  INT64_C(                  16) } },
+    { {  INT64_C( 5023243019820443670), -INT64_C( 4681051627541142719) },
+      UINT8_C(241),
+      {  INT64_C( 1243004646912442368),  INT64_C( 4719772986285433040) },
+      {  INT64_C(                  11), -INT64_C( 4681051627541142719) } },
+    { { -INT64_C( 6494709192211069809),  INT64_C(  423029812652773916) },
+      UINT8_C(182),
+      { -INT64_C( 4467569936931219376),  INT64_C( 5188149265301506311) },
+      { -INT64_C( 6494709192211069809),  INT64_C(                  13) } },
+    { { -INT64_C( 7738382316947860159), -INT64_C( 4804807748746674415) },
+      UINT8_C( 91),
+      { -INT64_C( 8502548700199544264), -INT64_C( 5256382350169094419) },
+      {  INT64_C(                  24),  INT64_C(                  32) } },
+    { { -INT64_C( 1879126217545624968), -INT64_C( 6245946596455823464) },
+      UINT8_C(177),
+      {  INT64_C( 2768066852495215546), -INT64_C( 7697268915884612638) },
+      {  INT64_C(                  29), -INT64_C( 6245946596455823464) } },
+    { {  INT64_C( 5904874638783737320),  INT64_C( 4159664487094188717) },
+      UINT8_C(163),
+      { -INT64_C( 9059425925806605539), -INT64_C( 3635435420159138033) },
+      {  INT64_C(                  31),  INT64_C(                  34) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi64(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i r = simde_mm_mask_popcnt_epi64(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_popcnt_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    {       UINT8_C(104),
+      {  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    {       UINT8_C(153),
+      { -INT64_C(                   1), -INT64_C(                   1) },
+      {  INT64_C(                  64),  INT64_C(                   0) } },
+    {       UINT8_C(221),
+      {  INT64_C( 7080784585131341070),  INT64_C(   27604751447754273) },
+      {  INT64_C(                  21),  INT64_C(                   0) } },
+    {       UINT8_C(177),
+      {  INT64_C( 4773820020509638723), -INT64_C( 8049128484329700587) },
+      {  INT64_C(                  10),  INT64_C(                   0) } },
+    {       UINT8_C(212),
+      { -INT64_C( 7896921065056351216),  INT64_C(  580966278618956421) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    {       UINT8_C( 32),
+      { -INT64_C( 3273603595466634985),  INT64_C( 1447952151364682093) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    {       UINT8_C(239),
+      { -INT64_C( 8635581727244215390), -INT64_C( 3694254075622314315) },
+      {  INT64_C(                  22),  INT64_C(                  39) } },
+    {       UINT8_C( 61),
+      {  INT64_C( 3408452008642465991), -INT64_C( 6647038974525452079) },
+      {  INT64_C(                  27),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i r = simde_mm_maskz_popcnt_epi64(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_popcnt_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[32];
+    const int8_t r[32];
+  } test_vec[] = {
+    { {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+      {  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),
+         INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),
+         INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),
+         INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8) } },
+    { {  INT8_C( 104), -INT8_C( 102), -INT8_C(  96),  INT8_C(   4),  INT8_C(   0),      INT8_MIN,  INT8_C(   0),  INT8_C(  11),
+         INT8_C(   2), -INT8_C(  32),  INT8_C(  30),  INT8_C(  33),  INT8_C(  50),  INT8_C(   7), -INT8_C(  32),  INT8_C(   0),
+        -INT8_C(  96),  INT8_C(  54), -INT8_C(  88), -INT8_C( 126), -INT8_C( 120),  INT8_C( 100),  INT8_C(  68),  INT8_C(   2),
+        -INT8_C(  82),  INT8_C(  73),  INT8_C(   6),  INT8_C(  91),  INT8_C(  89),  INT8_C(  35),  INT8_C(   8), -INT8_C(  48) },
+      {  INT8_C(   3),  INT8_C(   4),  INT8_C(   2),  INT8_C(   1),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   3),
+         INT8_C(   1),  INT8_C(   3),  INT8_C(   4),  INT8_C(   2),  INT8_C(   3),  INT8_C(   3),  INT8_C(   3),  INT8_C(   0),
+         INT8_C(   2),  INT8_C(   4),  INT8_C(   3),  INT8_C(   2),  INT8_C(   2),  INT8_C(   3),  INT8_C(   2),  INT8_C(   1),
+         INT8_C(   5),  INT8_C(   3),  INT8_C(   2),  INT8_C(   5),  INT8_C(   4),  INT8_C(   3),  INT8_C(   1),  INT8_C(   3) } },
+    { {  INT8_C( 122),  INT8_C(   9), -INT8_C(  62),  INT8_C(  36),  INT8_C(   0),  INT8_C(  17),  INT8_C(   5),  INT8_C(   1),
+         INT8_C(   5),  INT8_C(  56),  INT8_C(   0),  INT8_C(  16),  INT8_C(  16),  INT8_C(   4), -INT8_C( 112), -INT8_C(  61),
+         INT8_C(   2),  INT8_C(  20),  INT8_C(  36),  INT8_C(  24),  INT8_C(  44),  INT8_C(  36),  INT8_C(   8),  INT8_C(   0),
+             INT8_MIN,  INT8_C(  65),  INT8_C(  68), -INT8_C(  62),  INT8_C(   0),  INT8_C(   1),  INT8_C( 103),  INT8_C(  98) },
+      {  INT8_C(   5),  INT8_C(   2),  INT8_C(   3),  INT8_C(   2),  INT8_C(   0),  INT8_C(   2),  INT8_C(   2),  INT8_C(   1),
+         INT8_C(   2),  INT8_C(   3),  INT8_C(   0),  INT8_C(   1),  INT8_C(   1),  INT8_C(   1),  INT8_C(   2),  INT8_C(   4),
+         INT8_C(   1),  INT8_C(   2),  INT8_C(   2),  INT8_C(   2),  INT8_C(   3),  INT8_C(   2),  INT8_C(   1),  INT8_C(   0),
+         INT8_C(   1),  INT8_C(   2),  INT8_C(   2),  INT8_C(   3),  INT8_C(   0),  INT8_C(   1),  INT8_C(   5),  INT8_C(   3) } },
+    { { -INT8_C(  96),  INT8_C(   3),  INT8_C(  16),  INT8_C(  16),  INT8_C(  52),  INT8_C(  66),  INT8_C(   0),  INT8_C(  89),
+         INT8_C( 100),  INT8_C(  33),  INT8_C(   1),  INT8_C(  33),  INT8_C(   0),  INT8_C(  37),  INT8_C(  41),  INT8_C( 114),
+         INT8_C(   8), -INT8_C( 104),  INT8_C(  33),  INT8_C(   1), -INT8_C(  61), -INT8_C( 112),  INT8_C(   1), -INT8_C(  87),
+         INT8_C(  32),  INT8_C( 114),  INT8_C(  18), -INT8_C( 124),  INT8_C(  16),  INT8_C( 105),  INT8_C(   8),  INT8_C(  69) },
+      {  INT8_C(   2),  INT8_C(   2),  INT8_C(   1),  INT8_C(   1),  INT8_C(   3),  INT8_C(   2),  INT8_C(   0),  INT8_C(   4),
+         INT8_C(   3),  INT8_C(   2),  INT8_C(   1),  INT8_C(   2),  INT8_C(   0),  INT8_C(   3),  INT8_C(   3),  INT8_C(   4),
+         INT8_C(   1),  INT8_C(   3),  INT8_C(   2),  INT8_C(   1),  INT8_C(   4),  INT8_C(   2),  INT8_C(   1),  INT8_C(   4),
+         INT8_C(   1),  INT8_C(   4),  INT8_C(   2),  INT8_C(   2),  INT8_C(   1),  INT8_C(   4),  INT8_C(   1),  INT8_C(   3) } },
+    { {  INT8_C(  54), -INT8_C(  70),  INT8_C( 115),  INT8_C(  11), -INT8_C(  37),  INT8_C(  44), -INT8_C(  28),  INT8_C(  75),
+         INT8_C(   1),  INT8_C(  25), -INT8_C( 111),  INT8_C(  62), -INT8_C( 114),  INT8_C( 115),  INT8_C(  67),  INT8_C( 121),
+        -INT8_C(  79), -INT8_C(  76), -INT8_C(  81),  INT8_C(  58),  INT8_C(  66),  INT8_C(   6),  INT8_C(  88), -INT8_C(  42),
+        -INT8_C(  85),  INT8_C(  52), -INT8_C(  26), -INT8_C(  99),  INT8_C(  80),  INT8_C(  14), -INT8_C( 104),  INT8_C(  55) },
+      {  INT8_C(   4),  INT8_C(   5),  INT8_C(   5),  INT8_C(   3),  INT8_C(   6),  INT8_C(   3),  INT8_C(   4),  INT8_C(   4),
+         INT8_C(   1),  INT8_C(   3),  INT8_C(   3),  INT8_C(   5),  INT8_C(   4),  INT8_C(   5),  INT8_C(   3),  INT8_C(   5),
+         INT8_C(   4),  INT8_C(   4),  INT8_C(   6),  INT8_C(   4),  INT8_C(   2),  INT8_C(   2),  INT8_C(   3),  INT8_C(   5),
+         INT8_C(   5),  INT8_C(   3),  INT8_C(   5),  INT8_C(   5),  INT8_C(   2),  INT8_C(   3),  INT8_C(   3),  INT8_C(   5) } },
+    { { -INT8_C(  74),  INT8_C(  31),  INT8_C(  47),  INT8_C(  77), -INT8_C(   7),  INT8_C(  78),  INT8_C(  42),  INT8_C(   2),
+        -INT8_C( 124),  INT8_C(  41),  INT8_C(  95),  INT8_C(  71), -INT8_C(  67),  INT8_C(  66), -INT8_C(  64), -INT8_C(  83),
+         INT8_C(  70),  INT8_C(  64),  INT8_C(  26), -INT8_C( 102),  INT8_C(  41),  INT8_C(   5), -INT8_C( 115), -INT8_C( 120),
+         INT8_C(  61),  INT8_C(  19), -INT8_C( 107), -INT8_C(   2),  INT8_C(  91),  INT8_C(  13), -INT8_C(  53),  INT8_C(  78) },
+      {  INT8_C(   5),  INT8_C(   5),  INT8_C(   5),  INT8_C(   4),  INT8_C(   6),  INT8_C(   4),  INT8_C(   3),  INT8_C(   1),
+         INT8_C(   2),  INT8_C(   3),  INT8_C(   6),  INT8_C(   4),  INT8_C(   6),  INT8_C(   2),  INT8_C(   2),  INT8_C(   5),
+         INT8_C(   3),  INT8_C(   1),  INT8_C(   3),  INT8_C(   4),  INT8_C(   3),  INT8_C(   2),  INT8_C(   4),  INT8_C(   2),
+         INT8_C(   5),  INT8_C(   3),  INT8_C(   4),  INT8_C(   7),  INT8_C(   5),  INT8_C(   3),  INT8_C(   5),  INT8_C(   4) } },
+    { {  INT8_C(  60),  INT8_C(  50), -INT8_C(  68),  INT8_C(  31),  INT8_C(  13),  INT8_C(  71),  INT8_C( 125),  INT8_C(  73),
+         INT8_C(  79),  INT8_C(  51), -INT8_C(  55), -INT8_C(  68),  INT8_C(  99), -INT8_C(  45), -INT8_C(  20),  INT8_C( 111),
+        -INT8_C(  55),  INT8_C(  68), -INT8_C(   8),  INT8_C(  79), -INT8_C(  39),  INT8_C(  26), -INT8_C(  42), -INT8_C(  13),
+         INT8_C( 122),  INT8_C(  58),  INT8_C(  32), -INT8_C(  32),  INT8_C(  55),  INT8_C(  65), -INT8_C(  93), -INT8_C(  60) },
+      {  INT8_C(   4),  INT8_C(   3),  INT8_C(   5),  INT8_C(   5),  INT8_C(   3),  INT8_C(   4),  INT8_C(   6),  INT8_C(   3),
+         INT8_C(   5),  INT8_C(   4),  INT8_C(   4),  INT8_C(   5),  INT8_C(   4),  INT8_C(   5),  INT8_C(   5),  INT8_C(   6),
+         INT8_C(   4),  INT8_C(   2),  INT8_C(   5),  INT8_C(   5),  INT8_C(   5),  INT8_C(   3),  INT8_C(   5),  INT8_C(   6),
+         INT8_C(   5),  INT8_C(   4),  INT8_C(   1),  INT8_C(   3),  INT8_C(   5),  INT8_C(   2),  INT8_C(   4),  INT8_C(   3) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i r = simde_mm256_popcnt_epi8(a);
+    simde_test_x86_assert_equal_i8x32(r, simde_x_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_popcnt_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[32];
+    const simde__mmask32 k;
+    const int8_t a[32];
+    const int8_t r[32];
+  } test_vec[] = {
+    { {  INT8_C(  60), -INT8_C(  96),  INT8_C(  27),  INT8_C(  53),  INT8_C(  31),  INT8_C(  99),  INT8_C( 113), -INT8_C(  77),
+        -INT8_C(  66),  INT8_C(  11),  INT8_C( 105), -INT8_C(  21), -INT8_C(  14), -INT8_C(  39),  INT8_C(  22), -INT8_C( 122),
+         INT8_C(  87), -INT8_C(  67), -INT8_C(   6), -INT8_C( 113), -INT8_C( 110),  INT8_C(   9), -INT8_C(  71),  INT8_C(  10),
+        -INT8_C(  96), -INT8_C( 123),  INT8_C(  18), -INT8_C(  82), -INT8_C(  81),  INT8_C(  80), -INT8_C( 102),  INT8_C(  31) },
+      UINT32_C(3296273016),
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+      {  INT8_C(  60), -INT8_C(  96),  INT8_C(  27),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(  77),
+        -INT8_C(  66),  INT8_C(   0),  INT8_C( 105), -INT8_C(  21), -INT8_C(  14),  INT8_C(   0),  INT8_C(  22), -INT8_C( 122),
+         INT8_C(   0), -INT8_C(  67), -INT8_C(   6),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  10),
+        -INT8_C(  96), -INT8_C( 123),  INT8_C(   0), -INT8_C(  82), -INT8_C(  81),  INT8_C(  80),  INT8_C(   0),  INT8_C(   0) } },
+    { {  INT8_C(  89), -INT8_C(  15), -INT8_C(  48),  INT8_C( 109), -INT8_C(  79),  INT8_C(  82), -INT8_C(  22), -INT8_C(  63),
+        -INT8_C(  40),  INT8_C(  35), -INT8_C(  63),  INT8_C( 102), -INT8_C(  94), -INT8_C(  23),  INT8_C(  40),  INT8_C( 116),
+        -INT8_C(  74),  INT8_C(   1),  INT8_C(  71),  INT8_C(  83),  INT8_C( 111),  INT8_C(  99), -INT8_C(  47),  INT8_C(  20),
+         INT8_C(  12),  INT8_C(  90),  INT8_C( 124), -INT8_C(  38),  INT8_C( 117), -INT8_C( 123), -INT8_C(  20), -INT8_C(  67) },
+      UINT32_C(3595358972),
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+      {  INT8_C(  89), -INT8_C(  15),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),
+        -INT8_C(  40),  INT8_C(   8), -INT8_C(  63),  INT8_C( 102),  INT8_C(   8), -INT8_C(  23),  INT8_C(   8),  INT8_C(   8),
+        -INT8_C(  74),  INT8_C(   1),  INT8_C(   8),  INT8_C(   8),  INT8_C( 111),  INT8_C(  99),  INT8_C(   8),  INT8_C(  20),
+         INT8_C(  12),  INT8_C(   8),  INT8_C(   8), -INT8_C(  38),  INT8_C(   8), -INT8_C( 123),  INT8_C(   8),  INT8_C(   8) } },
+    { { -INT8_C(  47), -INT8_C(   2), -INT8_C(  93), -INT8_C(  98), -INT8_C( 111), -INT8_C( 126),  INT8_C(  39), -INT8_C(   5),
+        -INT8_C(  64), -INT8_C(  11),  INT8_C(  88), -INT8_C( 104),  INT8_C(  17),  INT8_C(  23), -INT8_C(  79),  INT8_C(  70),
+        -INT8_C( 106), -INT8_C(  55), -INT8_C(  72),  INT8_C(  85),  INT8_C(  15), -INT8_C(  85), -INT8_C(  44), -INT8_C(  17),
+         INT8_C(  30), -INT8_C( 104), -INT8_C(  79),  INT8_C(  44), -INT8_C(  44),  INT8_C(  99), -INT8_C( 105), -INT8_C(  76) },
+      UINT32_C( 404138823),
+      {  INT8_C(  32),  INT8_C(   0),  INT8_C(  35), -INT8_C(  77),  INT8_C(  16),  INT8_C(  82), -INT8_C(  34),  INT8_C(  71),
+         INT8_C(   7), -INT8_C(  80),      INT8_MIN, -INT8_C( 126),  INT8_C(  16),      INT8_MIN,  INT8_C(   1), -INT8_C( 118),
+        -INT8_C( 120),  INT8_C(   2),  INT8_C(  75),  INT8_C(   0),  INT8_C(   1),  INT8_C(   4),  INT8_C(  15),  INT8_C(   6),
+             INT8_MIN,  INT8_C(  16),  INT8_C(  64), -INT8_C( 126), -INT8_C(  88),  INT8_C(  64),  INT8_C(   8),  INT8_C(  68) },
+      {  INT8_C(   1),  INT8_C(   0),  INT8_C(   3), -INT8_C(  98), -INT8_C( 111), -INT8_C( 126),  INT8_C(   6), -INT8_C(   5),
+         INT8_C(   3),  INT8_C(   3),  INT8_C(  88),  INT8_C(   2),  INT8_C(  17),  INT8_C(   1), -INT8_C(  79),  INT8_C(   3),
+        -INT8_C( 106),  INT8_C(   1),  INT8_C(   4),  INT8_C(  85),  INT8_C(   1), -INT8_C(  85), -INT8_C(  44), -INT8_C(  17),
+         INT8_C(  30), -INT8_C( 104), -INT8_C(  79),  INT8_C(   2),  INT8_C(   3),  INT8_C(  99), -INT8_C( 105), -INT8_C(  76) } },
+    { {  INT8_C(  92), -INT8_C(   8), -INT8_C(  73),  INT8_C(  14),  INT8_C( 126), -INT8_C(   4),  INT8_C(  65),  INT8_C(  35),
+         INT8_C(   1), -INT8_C( 109), -INT8_C(  56), -INT8_C(  99), -INT8_C(  20),  INT8_C(  79), -INT8_C(  93),  INT8_C(  12),
+        -INT8_C(  40),  INT8_C(  37),  INT8_C(  65),  INT8_C(  69), -INT8_C(  73), -INT8_C(  72),  INT8_C(  89),  INT8_C( 127),
+        -INT8_C(  93), -INT8_C(  42),  INT8_C(  39), -INT8_C(  57), -INT8_C(  56), -INT8_C(  69),  INT8_C(  48), -INT8_C( 104) },
+      UINT32_C( 742039580),
+      {  INT8_C(  72), -INT8_C(  96),  INT8_C(  99),  INT8_C(  33),  INT8_C(   0),  INT8_C(   2), -INT8_C(  48),  INT8_C(  12),
+         INT8_C(  18),  INT8_C( 112), -INT8_C( 127),  INT8_C(   6),  INT8_C(  44),  INT8_C(  36),  INT8_C(  36),  INT8_C(   0),
+         INT8_C(  66), -INT8_C( 124),  INT8_C( 107),  INT8_C( 103),  INT8_C(  16),  INT8_C(  49),  INT8_C(  16),  INT8_C(   4),
+         INT8_C(  20),  INT8_C(  72), -INT8_C( 119), -INT8_C(  32),  INT8_C(  41),  INT8_C(   0),  INT8_C( 109),  INT8_C(  21) },
+      {  INT8_C(  92), -INT8_C(   8),  INT8_C(   4),  INT8_C(   2),  INT8_C(   0), -INT8_C(   4),  INT8_C(  65),  INT8_C(  35),
+         INT8_C(   1), -INT8_C( 109), -INT8_C(  56), -INT8_C(  99), -INT8_C(  20),  INT8_C(   2), -INT8_C(  93),  INT8_C(   0),
+        -INT8_C(  40),  INT8_C(   2),  INT8_C(  65),  INT8_C(   5),  INT8_C(   1),  INT8_C(   3),  INT8_C(  89),  INT8_C( 127),
+        -INT8_C(  93), -INT8_C(  42),  INT8_C(   3),  INT8_C(   3), -INT8_C(  56),  INT8_C(   0),  INT8_C(  48), -INT8_C( 104) } },
+    { {  INT8_C(  15),  INT8_C(   9),  INT8_C(  87),  INT8_C(  49),  INT8_C(  39),  INT8_C( 113),  INT8_C(  13),  INT8_C(  35),
+         INT8_C(   1), -INT8_C(  49),  INT8_C(  28),  INT8_C(  94),  INT8_C(  76), -INT8_C(  76), -INT8_C(  39), -INT8_C(  12),
+        -INT8_C(  33),  INT8_C(  12), -INT8_C(  42), -INT8_C(  31), -INT8_C(  82),  INT8_C( 119),  INT8_C( 125), -INT8_C( 119),
+         INT8_C(  58), -INT8_C(  50), -INT8_C(  53), -INT8_C( 116),  INT8_C(  91), -INT8_C(   3),  INT8_C(  36),  INT8_C( 116) },
+      UINT32_C(2208781415),
+      {  INT8_C(   4),  INT8_C(  65),  INT8_C(   8),  INT8_C(   9), -INT8_C(  86),  INT8_C(   4),  INT8_C(  19),  INT8_C(  16),
+         INT8_C(   1),  INT8_C(  16), -INT8_C(  62), -INT8_C(  59),  INT8_C(  36),  INT8_C(  38),      INT8_MIN,  INT8_C(   3),
+         INT8_C( 100), -INT8_C( 118),  INT8_C(   0),  INT8_C(   8),  INT8_C(   8), -INT8_C( 108), -INT8_C(  56),  INT8_C(  98),
+         INT8_C(  50),  INT8_C(   1),  INT8_C(  56),  INT8_C(   2),  INT8_C(  58),  INT8_C(   2),  INT8_C(  64), -INT8_C( 119) },
+      {  INT8_C(   1),  INT8_C(   2),  INT8_C(   1),  INT8_C(  49),  INT8_C(  39),  INT8_C(   1),  INT8_C(   3),  INT8_C(  35),
+         INT8_C(   1), -INT8_C(  49),  INT8_C(   3),  INT8_C(  94),  INT8_C(   2), -INT8_C(  76),  INT8_C(   1), -INT8_C(  12),
+         INT8_C(   3),  INT8_C(   3),  INT8_C(   0), -INT8_C(  31), -INT8_C(  82),  INT8_C(   3),  INT8_C( 125),  INT8_C(   3),
+         INT8_C(   3),  INT8_C(   1), -INT8_C(  53), -INT8_C( 116),  INT8_C(  91), -INT8_C(   3),  INT8_C(  36),  INT8_C(   3) } },
+    { { -INT8_C( 101),  INT8_C(  98),  INT8_C(  26), -INT8_C(  56),  INT8_C(  47),  INT8_C( 105), -INT8_C(   3), -INT8_C( 106),
+        -INT8_C(  93), -INT8_C(  56), -INT8_C(  43),      INT8_MIN,  INT8_C( 105), -INT8_C(  85),  INT8_C(  56), -INT8_C(  36),
+         INT8_C( 107), -INT8_C(  19), -INT8_C(  46),  INT8_C(  53), -INT8_C(  69), -INT8_C(  76), -INT8_C(  43), -INT8_C(  90),
+        -INT8_C(   5), -INT8_C( 124),  INT8_C(  47),  INT8_C(  59),  INT8_C(  81), -INT8_C(  99), -INT8_C(  80), -INT8_C( 121) },
+      UINT32_C( 101862221),
+      {  INT8_C(  75), -INT8_C(  53),  INT8_C( 106),  INT8_C(  16), -INT8_C(  12),  INT8_C(  29), -INT8_C(  41),  INT8_C(   4),
+        -INT8_C(  58),  INT8_C(  73),  INT8_C( 123), -INT8_C(  89), -INT8_C(  58), -INT8_C( 123), -INT8_C(  90), -INT8_C( 125),
+         INT8_C(  42), -INT8_C(  18), -INT8_C( 127), -INT8_C(  44),  INT8_C(  79), -INT8_C(  85), -INT8_C(  40),  INT8_C(  73),
+        -INT8_C( 101),  INT8_C(  68),  INT8_C(  68),  INT8_C(  66), -INT8_C( 114), -INT8_C(  11), -INT8_C(  16),  INT8_C(  95) },
+      {  INT8_C(   4),  INT8_C(  98),  INT8_C(   4),  INT8_C(   1),  INT8_C(  47),  INT8_C( 105),  INT8_C(   6), -INT8_C( 106),
+         INT8_C(   4),  INT8_C(   3), -INT8_C(  43),  INT8_C(   5),  INT8_C( 105), -INT8_C(  85),  INT8_C(   4), -INT8_C(  36),
+         INT8_C( 107),  INT8_C(   6), -INT8_C(  46),  INT8_C(  53),  INT8_C(   5), -INT8_C(  76), -INT8_C(  43), -INT8_C(  90),
+        -INT8_C(   5),  INT8_C(   2),  INT8_C(   2),  INT8_C(  59),  INT8_C(  81), -INT8_C(  99), -INT8_C(  80), -INT8_C( 121) } },
+    { {  INT8_C(  61),  INT8_C(  21), -INT8_C( 119),  INT8_C(  94),  INT8_C(  32), -INT8_C(  72), -INT8_C(  57), -INT8_C( 102),
+         INT8_C(  59), -INT8_C(  43), -INT8_C(  70), -INT8_C(  97),  INT8_C(  78),  INT8_C(  24), -INT8_C(  82),  INT8_C( 119),
+        -INT8_C(   9),  INT8_C(  22),  INT8_C(   0), -INT8_C(   2), -INT8_C(  53),  INT8_C(   6), -INT8_C(  42), -INT8_C( 105),
+         INT8_C(  62),  INT8_C(  54),  INT8_C(  52),      INT8_MIN, -INT8_C(  67), -INT8_C(  52),  INT8_C(  59), -INT8_C( 121) },
+      UINT32_C(2614668325),
+      { -INT8_C(  64), -INT8_C( 113), -INT8_C(  10), -INT8_C(  69),  INT8_C(  34), -INT8_C( 110), -INT8_C(  15), -INT8_C(  16),
+         INT8_C(  19), -INT8_C(  91),  INT8_C(  34), -INT8_C(  26), -INT8_C(  89), -INT8_C(  94), -INT8_C(  69),  INT8_C( 100),
+        -INT8_C( 118),  INT8_C(  99),  INT8_C(  13), -INT8_C(  29),  INT8_C(  70),  INT8_C(  28), -INT8_C(  28), -INT8_C(  81),
+         INT8_C(  94), -INT8_C(  96),  INT8_C( 127), -INT8_C(  57),  INT8_C(  24),  INT8_C(  16), -INT8_C( 104), -INT8_C(  45) },
+      {  INT8_C(   2),  INT8_C(  21),  INT8_C(   6),  INT8_C(  94),  INT8_C(  32),  INT8_C(   3), -INT8_C(  57), -INT8_C( 102),
+         INT8_C(  59), -INT8_C(  43),  INT8_C(   2),  INT8_C(   5),  INT8_C(  78),  INT8_C(   3), -INT8_C(  82),  INT8_C(   3),
+        -INT8_C(   9),  INT8_C(  22),  INT8_C(   0),  INT8_C(   5),  INT8_C(   3),  INT8_C(   6),  INT8_C(   4),  INT8_C(   6),
+         INT8_C(   5),  INT8_C(   2),  INT8_C(  52),  INT8_C(   5),  INT8_C(   2), -INT8_C(  52),  INT8_C(  59),  INT8_C(   5) } },
+    { {  INT8_C(  58),  INT8_C( 106), -INT8_C(  50),  INT8_C(  89),  INT8_C(  37),  INT8_C(   7),  INT8_C( 105),  INT8_C(  23),
+         INT8_C(  57),  INT8_C(  73), -INT8_C( 119),  INT8_C(  74), -INT8_C(   2),  INT8_C(  55), -INT8_C(  15),  INT8_C(  38),
+         INT8_C(  84), -INT8_C(  10),  INT8_C(  11), -INT8_C(  99), -INT8_C( 110), -INT8_C(  25),  INT8_C(  80),  INT8_C(  76),
+        -INT8_C(  16),  INT8_C( 123), -INT8_C(  19), -INT8_C(  96), -INT8_C( 123),  INT8_C(  46),  INT8_C(  90), -INT8_C( 126) },
+      UINT32_C(2656405800),
+      {  INT8_C(  57), -INT8_C(  63), -INT8_C( 102), -INT8_C(  97),  INT8_C(   4), -INT8_C(   2), -INT8_C(  79),  INT8_C(   2),
+         INT8_C(  20), -INT8_C( 110), -INT8_C(   1),  INT8_C( 106), -INT8_C(  42),  INT8_C(  69), -INT8_C(  79), -INT8_C(  40),
+        -INT8_C(  65), -INT8_C(  58), -INT8_C(  95),  INT8_C(  38), -INT8_C( 114), -INT8_C(  65),  INT8_C( 112), -INT8_C(   8),
+         INT8_C(  99), -INT8_C(  57), -INT8_C(  22), -INT8_C(  67), -INT8_C(  78),  INT8_C(  31), -INT8_C(  71), -INT8_C(  88) },
+      {  INT8_C(  58),  INT8_C( 106), -INT8_C(  50),  INT8_C(   6),  INT8_C(  37),  INT8_C(   7),  INT8_C( 105),  INT8_C(  23),
+         INT8_C(   2),  INT8_C(  73), -INT8_C( 119),  INT8_C(   4), -INT8_C(   2),  INT8_C(  55), -INT8_C(  15),  INT8_C(   4),
+         INT8_C(   7), -INT8_C(  10),  INT8_C(   3), -INT8_C(  99),  INT8_C(   4), -INT8_C(  25),  INT8_C(   3),  INT8_C(  76),
+        -INT8_C(  16),  INT8_C(   5),  INT8_C(   5),  INT8_C(   6),  INT8_C(   4),  INT8_C(  46),  INT8_C(  90),  INT8_C(   3) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi8(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_popcnt_epi8(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x32(r, simde_x_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_popcnt_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 k;
+    const int8_t a[32];
+    const int8_t r[32];
+  } test_vec[] = {
+    {       UINT32_C( 743911842),
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    {       UINT32_C(3033534487),
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+      {  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   0),  INT8_C(   8),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   8),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   8),  INT8_C(   0),  INT8_C(   8),  INT8_C(   8),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   8),  INT8_C(   0),  INT8_C(   8),  INT8_C(   8),  INT8_C(   0),  INT8_C(   8) } },
+    {       UINT32_C(1758852538),
+      {  INT8_C(  33),  INT8_C(  19), -INT8_C( 126),  INT8_C(   2),  INT8_C(  12),  INT8_C(  16),      INT8_MIN,  INT8_C(  65),
+        -INT8_C( 116),  INT8_C(  22), -INT8_C(  31),  INT8_C(  64), -INT8_C( 124),      INT8_MIN,  INT8_C(  12), -INT8_C(  48),
+         INT8_C(  16), -INT8_C(  74),  INT8_C(  44),  INT8_C(  66),  INT8_C(   9),  INT8_C(   8), -INT8_C( 123),  INT8_C(  80),
+         INT8_C(  66),  INT8_C(   2),  INT8_C(   1),  INT8_C(   4), -INT8_C(  95),  INT8_C(  20),  INT8_C(  72),  INT8_C(   0) },
+      {  INT8_C(   0),  INT8_C(   3),  INT8_C(   0),  INT8_C(   1),  INT8_C(   2),  INT8_C(   1),  INT8_C(   0),  INT8_C(   2),
+         INT8_C(   3),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0),  INT8_C(   2),  INT8_C(   1),  INT8_C(   2),  INT8_C(   3),
+         INT8_C(   1),  INT8_C(   0),  INT8_C(   3),  INT8_C(   0),  INT8_C(   2),  INT8_C(   0),  INT8_C(   3),  INT8_C(   2),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   2),  INT8_C(   2),  INT8_C(   0) } },
+    {       UINT32_C( 383210105),
+      {  INT8_C(  80),  INT8_C(  24), -INT8_C(  24), -INT8_C( 124),  INT8_C(  32),  INT8_C(   4), -INT8_C(  94), -INT8_C(  31),
+             INT8_MIN,  INT8_C(  25),  INT8_C(  68), -INT8_C( 112),  INT8_C(   8),  INT8_C(  22),  INT8_C(   9),  INT8_C(  15),
+        -INT8_C(  64), -INT8_C( 118), -INT8_C( 110),  INT8_C(  16),  INT8_C(  32),  INT8_C(   6),  INT8_C(  74),  INT8_C( 114),
+         INT8_C(   4),  INT8_C(  64),  INT8_C(   0),      INT8_MIN,  INT8_C(   4), -INT8_C( 127),  INT8_C(   4), -INT8_C(  44) },
+      {  INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   2),  INT8_C(   1),  INT8_C(   1),  INT8_C(   3),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   3),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   2),  INT8_C(   0),
+         INT8_C(   2),  INT8_C(   3),  INT8_C(   3),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   3),  INT8_C(   4),
+         INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    {       UINT32_C( 317750753),
+      {  INT8_C(  35),  INT8_C(  18),  INT8_C(   1),  INT8_C( 112),  INT8_C(   1),  INT8_C(  52),  INT8_C(  16),  INT8_C(  32),
+         INT8_C(  22),  INT8_C(  94), -INT8_C(  31),  INT8_C(  40),  INT8_C(  26),  INT8_C(   1),  INT8_C(   1),  INT8_C( 120),
+         INT8_C(   9),      INT8_MIN,  INT8_C(  68),  INT8_C(   7),  INT8_C(   9),  INT8_C(   8),  INT8_C(  11),  INT8_C(   2),
+         INT8_C(   5),  INT8_C(   4),  INT8_C(  32),  INT8_C(   8),  INT8_C(  33),  INT8_C(   1), -INT8_C( 125), -INT8_C(  38) },
+      {  INT8_C(   3),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3),  INT8_C(   1),  INT8_C(   1),
+         INT8_C(   3),  INT8_C(   0),  INT8_C(   4),  INT8_C(   2),  INT8_C(   3),  INT8_C(   1),  INT8_C(   1),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   2),  INT8_C(   1),  INT8_C(   3),  INT8_C(   1),
+         INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    {       UINT32_C(2150628682),
+      {  INT8_C(  14), -INT8_C(  96),  INT8_C(  69), -INT8_C( 103),  INT8_C( 116),  INT8_C(  60),  INT8_C(  72),  INT8_C(  78),
+         INT8_C(  68),  INT8_C(  14),  INT8_C( 114),  INT8_C(   4), -INT8_C( 122),  INT8_C( 119), -INT8_C(   1),  INT8_C(  94),
+        -INT8_C(  64),  INT8_C(  59), -INT8_C(  47), -INT8_C(  34),  INT8_C(  51), -INT8_C(  99), -INT8_C( 118), -INT8_C(  89),
+        -INT8_C(  86), -INT8_C(  25), -INT8_C( 104),  INT8_C(  67),  INT8_C( 121),  INT8_C(  27), -INT8_C(  81),  INT8_C(   8) },
+      {  INT8_C(   0),  INT8_C(   2),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(   2),  INT8_C(   0),
+         INT8_C(   2),  INT8_C(   0),  INT8_C(   4),  INT8_C(   1),  INT8_C(   3),  INT8_C(   6),  INT8_C(   8),  INT8_C(   5),
+         INT8_C(   2),  INT8_C(   5),  INT8_C(   4),  INT8_C(   6),  INT8_C(   0),  INT8_C(   5),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1) } },
+    {       UINT32_C(1672505607),
+      {  INT8_C(  52), -INT8_C(  46),  INT8_C(  33),  INT8_C(  61),  INT8_C(  79), -INT8_C( 121), -INT8_C( 124),  INT8_C(  97),
+         INT8_C(  87), -INT8_C(  49),  INT8_C(  42), -INT8_C(  80), -INT8_C(   7), -INT8_C(  66),  INT8_C( 107),  INT8_C( 109),
+         INT8_C(  27), -INT8_C(  45), -INT8_C(  46),  INT8_C(  47), -INT8_C(  29),  INT8_C(  58),  INT8_C(  32), -INT8_C(  28),
+         INT8_C( 127),  INT8_C(  49), -INT8_C(  95),  INT8_C( 124),  INT8_C( 108),  INT8_C(  64), -INT8_C(  64), -INT8_C(  29) },
+      {  INT8_C(   3),  INT8_C(   4),  INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   5),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3),  INT8_C(   0),  INT8_C(   6),  INT8_C(   5),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   5),  INT8_C(   4),  INT8_C(   0),  INT8_C(   4),
+         INT8_C(   7),  INT8_C(   3),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),  INT8_C(   2),  INT8_C(   0) } },
+    {       UINT32_C(4203342128),
+      {  INT8_C(  79), -INT8_C(  29), -INT8_C(  84), -INT8_C(  17),  INT8_C( 126), -INT8_C(  70),  INT8_C( 105), -INT8_C(  87),
+         INT8_C(  22),  INT8_C(  66), -INT8_C(  68), -INT8_C(  63),  INT8_C( 100), -INT8_C( 108),  INT8_C(  39), -INT8_C( 113),
+         INT8_C(  80),  INT8_C(  44), -INT8_C(  34), -INT8_C(  33),  INT8_C(  44), -INT8_C(  96),  INT8_C(   5),  INT8_C(  55),
+         INT8_C(  49), -INT8_C(  49), -INT8_C(  94),  INT8_C(  31), -INT8_C(  63), -INT8_C(  98), -INT8_C(  69), -INT8_C( 110) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   6),  INT8_C(   5),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   3),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3),  INT8_C(   0),  INT8_C(   3),  INT8_C(   4),  INT8_C(   5),
+         INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   7),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   5),
+         INT8_C(   0),  INT8_C(   6),  INT8_C(   0),  INT8_C(   5),  INT8_C(   3),  INT8_C(   5),  INT8_C(   6),  INT8_C(   3) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi8(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_popcnt_epi8(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x32(r, simde_x_mm256_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_popcnt_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t a[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    { {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { { -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+        -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1) },
+      {  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),
+         INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16) } },
+    { {  INT16_C(   544), -INT16_C( 32539),  INT16_C(    85),  INT16_C( 16519), -INT16_C( 11228),  INT16_C(  9220), -INT16_C( 30558),  INT16_C(    50),
+        -INT16_C( 24063),  INT16_C(  4444),  INT16_C(  8389), -INT16_C( 32760),  INT16_C( 18708),  INT16_C( 14016), -INT16_C( 16367), -INT16_C( 30652) },
+      {  INT16_C(     2),  INT16_C(     6),  INT16_C(     4),  INT16_C(     5),  INT16_C(     6),  INT16_C(     3),  INT16_C(     5),  INT16_C(     3),
+         INT16_C(     4),  INT16_C(     6),  INT16_C(     5),  INT16_C(     2),  INT16_C(     5),  INT16_C(     6),  INT16_C(     4),  INT16_C(     4) } },
+    { {  INT16_C(  6208),  INT16_C(  4240),  INT16_C( 20737),  INT16_C( 14457),  INT16_C(     0),  INT16_C(  8208),  INT16_C( 16768),  INT16_C(  1040),
+         INT16_C( 26786),  INT16_C(    22),  INT16_C( 21633),  INT16_C( 17410), -INT16_C( 24352), -INT16_C( 23296),  INT16_C(  2056),  INT16_C(  8472) },
+      {  INT16_C(     3),  INT16_C(     3),  INT16_C(     4),  INT16_C(     8),  INT16_C(     0),  INT16_C(     2),  INT16_C(     3),  INT16_C(     2),
+         INT16_C(     6),  INT16_C(     3),  INT16_C(     5),  INT16_C(     3),  INT16_C(     5),  INT16_C(     4),  INT16_C(     2),  INT16_C(     4) } },
+    { {  INT16_C(  4625),  INT16_C(  6281),  INT16_C(  1296),  INT16_C(  3328), -INT16_C( 32508),  INT16_C(    24),  INT16_C(     0),  INT16_C(   384),
+        -INT16_C( 28379),  INT16_C(   412),  INT16_C(  4123),  INT16_C(  2064),  INT16_C(  6297), -INT16_C( 27632),  INT16_C(   648),  INT16_C( 17472) },
+      {  INT16_C(     4),  INT16_C(     5),  INT16_C(     3),  INT16_C(     3),  INT16_C(     3),  INT16_C(     2),  INT16_C(     0),  INT16_C(     2),
+         INT16_C(     6),  INT16_C(     5),  INT16_C(     5),  INT16_C(     2),  INT16_C(     6),  INT16_C(     4),  INT16_C(     3),  INT16_C(     3) } },
+    { { -INT16_C( 24478),  INT16_C(  3361), -INT16_C(   809),  INT16_C( 10931),  INT16_C(   110), -INT16_C( 20516), -INT16_C( 14784), -INT16_C(  5321),
+        -INT16_C( 17460),  INT16_C(  2634), -INT16_C( 31176),  INT16_C( 28453), -INT16_C( 17741), -INT16_C( 14081), -INT16_C( 24887), -INT16_C( 23341) },
+      {  INT16_C(     5),  INT16_C(     5),  INT16_C(    12),  INT16_C(     8),  INT16_C(     5),  INT16_C(    11),  INT16_C(     5),  INT16_C(    11),
+         INT16_C(    10),  INT16_C(     5),  INT16_C(     6),  INT16_C(     9),  INT16_C(    10),  INT16_C(    11),  INT16_C(     9),  INT16_C(     8) } },
+    { { -INT16_C( 20231), -INT16_C( 12601),  INT16_C( 16761),  INT16_C( 10005), -INT16_C( 19323), -INT16_C( 11393),  INT16_C(  1448), -INT16_C( 28915),
+        -INT16_C( 17286), -INT16_C( 14159),  INT16_C(   223),  INT16_C(  6092), -INT16_C(  4393), -INT16_C(  3811), -INT16_C(  7140), -INT16_C(  1785) },
+      {  INT16_C(     9),  INT16_C(    10),  INT16_C(     7),  INT16_C(     7),  INT16_C(     7),  INT16_C(    12),  INT16_C(     5),  INT16_C(     8),
+         INT16_C(    10),  INT16_C(     7),  INT16_C(     7),  INT16_C(     8),  INT16_C(    12),  INT16_C(     9),  INT16_C(     7),  INT16_C(     9) } },
+    { {  INT16_C( 20695),  INT16_C( 27222),  INT16_C( 23610),  INT16_C(  4130),  INT16_C( 26006),  INT16_C( 28933), -INT16_C( 11091),  INT16_C(  5297),
+         INT16_C( 20574),  INT16_C(    32), -INT16_C( 18996), -INT16_C( 32370), -INT16_C(  1514),  INT16_C( 30565), -INT16_C(   249), -INT16_C(  4700) },
+      {  INT16_C(     8),  INT16_C(     8),  INT16_C(     8),  INT16_C(     3),  INT16_C(     8),  INT16_C(     6),  INT16_C(     9),  INT16_C(     6),
+         INT16_C(     7),  INT16_C(     1),  INT16_C(     9),  INT16_C(     6),  INT16_C(     9),  INT16_C(    10),  INT16_C(    11),  INT16_C(     9) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i r = simde_mm256_popcnt_epi16(a);
+    simde_test_x86_assert_equal_i16x16(r, simde_x_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_popcnt_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[16];
+    const simde__mmask16 k;
+    const int16_t a[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    { { -INT16_C( 26752),  INT16_C( 30104), -INT16_C( 28985), -INT16_C( 12135), -INT16_C(  4241),  INT16_C( 13402),  INT16_C( 25158),  INT16_C( 19540),
+        -INT16_C( 26042),  INT16_C( 31041), -INT16_C( 31011),  INT16_C( 12583),  INT16_C( 22387),  INT16_C(  2781),  INT16_C( 24988),  INT16_C( 18179) },
+      UINT16_C(64632),
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      { -INT16_C( 26752),  INT16_C( 30104), -INT16_C( 28985),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 19540),
+        -INT16_C( 26042),  INT16_C( 31041),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { {  INT16_C( 25731), -INT16_C(   128), -INT16_C( 24504), -INT16_C( 24341), -INT16_C( 27995), -INT16_C(  9429),  INT16_C(  5610),  INT16_C( 15669),
+        -INT16_C( 32609), -INT16_C( 30439), -INT16_C( 26230), -INT16_C( 11244), -INT16_C(  4423), -INT16_C(  3425),  INT16_C(  4347),  INT16_C(  1408) },
+      UINT16_C(36764),
+      { -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+        -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1) },
+      {  INT16_C( 25731), -INT16_C(   128),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16), -INT16_C(  9429),  INT16_C(  5610),  INT16_C(    16),
+         INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16), -INT16_C(  4423), -INT16_C(  3425),  INT16_C(  4347),  INT16_C(    16) } },
+    { {  INT16_C(  1777),  INT16_C( 12834), -INT16_C(  6568), -INT16_C(  3257), -INT16_C( 28164),  INT16_C( 32224), -INT16_C( 19677),  INT16_C(   948),
+        -INT16_C(  8451),  INT16_C( 28991),  INT16_C(   329),  INT16_C( 28367),  INT16_C( 15778), -INT16_C( 27415),  INT16_C( 22393),  INT16_C(  5281) },
+      UINT16_C(57294),
+      {  INT16_C(  1105),  INT16_C(  9232),  INT16_C( 17410), -INT16_C( 28364), -INT16_C( 24126),  INT16_C( 18468),  INT16_C(  3106),  INT16_C(  4625),
+         INT16_C(  4490),  INT16_C( 18706),  INT16_C(   544),  INT16_C(  4096), -INT16_C( 26624), -INT16_C( 15779),  INT16_C(  8210), -INT16_C( 30324) },
+      {  INT16_C(  1777),  INT16_C(     3),  INT16_C(     3),  INT16_C(     6), -INT16_C( 28164),  INT16_C( 32224),  INT16_C(     4),  INT16_C(     4),
+         INT16_C(     5),  INT16_C(     5),  INT16_C(     2),  INT16_C(     1),  INT16_C(     3), -INT16_C( 27415),  INT16_C(     3),  INT16_C(     6) } },
+    { { -INT16_C(  6947), -INT16_C(  5261), -INT16_C( 21526), -INT16_C( 10326), -INT16_C( 11656),  INT16_C(  1309),  INT16_C( 28893), -INT16_C( 31336),
+         INT16_C( 19508),  INT16_C( 11772), -INT16_C(  8961),  INT16_C(  1361), -INT16_C( 30031), -INT16_C( 14517), -INT16_C( 21618),  INT16_C(  9812) },
+      UINT16_C(12671),
+      { -INT16_C( 21488), -INT16_C( 31611),  INT16_C(  8255),  INT16_C(    77),  INT16_C( 13840), -INT16_C( 28672),  INT16_C(    72),  INT16_C(  1823),
+         INT16_C(   265), -INT16_C( 20476),  INT16_C(  4154),  INT16_C(    64),  INT16_C(   416),  INT16_C( 12386), -INT16_C( 13310),  INT16_C( 17757) },
+      {  INT16_C(     5),  INT16_C(     5),  INT16_C(     7),  INT16_C(     4),  INT16_C(     5),  INT16_C(     2),  INT16_C(     2), -INT16_C( 31336),
+         INT16_C(     3),  INT16_C( 11772), -INT16_C(  8961),  INT16_C(  1361),  INT16_C(     3),  INT16_C(     5), -INT16_C( 21618),  INT16_C(  9812) } },
+    { { -INT16_C(   602),  INT16_C( 22476),  INT16_C(  5281), -INT16_C( 15286), -INT16_C( 23881),  INT16_C( 17601),  INT16_C( 14780),  INT16_C(  6297),
+         INT16_C(  9608), -INT16_C( 25797),  INT16_C( 15948),  INT16_C( 20388),  INT16_C(   763), -INT16_C(  9166), -INT16_C( 29463), -INT16_C( 30373) },
+      UINT16_C(53508),
+      {  INT16_C(   272),  INT16_C( 16902), -INT16_C( 31999),  INT16_C( 16468),  INT16_C(  1072), -INT16_C( 29822),  INT16_C(  4102), -INT16_C( 23201),
+         INT16_C( 14936),  INT16_C( 16450),  INT16_C(    11),  INT16_C(   424), -INT16_C( 20192),  INT16_C(     4),  INT16_C(  1800),  INT16_C( 20608) },
+      { -INT16_C(   602),  INT16_C( 22476),  INT16_C(     4), -INT16_C( 15286), -INT16_C( 23881),  INT16_C( 17601),  INT16_C( 14780),  INT16_C(  6297),
+         INT16_C(     7), -INT16_C( 25797),  INT16_C( 15948),  INT16_C( 20388),  INT16_C(     5), -INT16_C(  9166),  INT16_C(     4),  INT16_C(     3) } },
+    { { -INT16_C(   574), -INT16_C( 17904),  INT16_C(  6503),  INT16_C(  3857), -INT16_C( 26413),  INT16_C( 23233),  INT16_C( 12688),  INT16_C(  7461),
+        -INT16_C( 16513), -INT16_C( 22530),  INT16_C( 17866), -INT16_C(  4451),  INT16_C( 24237),  INT16_C(   472), -INT16_C( 26799),  INT16_C( 24090) },
+      UINT16_C(31024),
+      { -INT16_C( 25128),  INT16_C( 29238),  INT16_C( 20512), -INT16_C( 12182),  INT16_C(  5919), -INT16_C( 24867),  INT16_C(   189),  INT16_C( 12190),
+         INT16_C(  8883),  INT16_C( 16944),  INT16_C( 27576), -INT16_C( 10459),  INT16_C( 25194),  INT16_C( 15262),  INT16_C( 22229), -INT16_C(  9800) },
+      { -INT16_C(   574), -INT16_C( 17904),  INT16_C(  6503),  INT16_C(  3857),  INT16_C(     9),  INT16_C(    11),  INT16_C( 12688),  INT16_C(  7461),
+         INT16_C(     7), -INT16_C( 22530),  INT16_C( 17866),  INT16_C(     9),  INT16_C(     7),  INT16_C(    10),  INT16_C(     9),  INT16_C( 24090) } },
+    { {  INT16_C(  4496), -INT16_C( 32479),  INT16_C(  6770), -INT16_C( 23442),  INT16_C( 13525),  INT16_C(    98),  INT16_C( 13318), -INT16_C( 25186),
+        -INT16_C( 18504),  INT16_C(  3664),  INT16_C( 29612),  INT16_C(  2823),  INT16_C( 15543),  INT16_C( 29752), -INT16_C( 17916),  INT16_C( 29883) },
+      UINT16_C(57940),
+      {  INT16_C( 26953), -INT16_C( 27415),  INT16_C( 14499), -INT16_C( 16384), -INT16_C( 15693), -INT16_C( 11413), -INT16_C( 13322), -INT16_C(  7806),
+        -INT16_C( 27760),  INT16_C( 17926),  INT16_C( 13354),  INT16_C( 24588), -INT16_C(  4700), -INT16_C( 13910), -INT16_C(   430),  INT16_C(  3339) },
+      {  INT16_C(  4496), -INT16_C( 32479),  INT16_C(     7), -INT16_C( 23442),  INT16_C(     8),  INT16_C(    98),  INT16_C(    11), -INT16_C( 25186),
+        -INT16_C( 18504),  INT16_C(     5),  INT16_C( 29612),  INT16_C(  2823),  INT16_C( 15543),  INT16_C(     8),  INT16_C(    10),  INT16_C(     6) } },
+    { { -INT16_C( 19362), -INT16_C(   647),  INT16_C(  2478),  INT16_C( 18077),  INT16_C( 23528),  INT16_C( 12455),  INT16_C(  8808),  INT16_C( 32184),
+        -INT16_C( 18707),  INT16_C( 21235), -INT16_C( 11352), -INT16_C(  2556),  INT16_C( 19829),  INT16_C(  7315),  INT16_C( 24598), -INT16_C( 21624) },
+      UINT16_C( 2888),
+      {  INT16_C( 16846),  INT16_C( 27367), -INT16_C( 16434), -INT16_C( 16888),  INT16_C( 10401),  INT16_C( 15880),  INT16_C(  6230), -INT16_C(  7100),
+         INT16_C( 13611), -INT16_C( 19825),  INT16_C( 21229),  INT16_C( 31868), -INT16_C(  8598), -INT16_C( 23873), -INT16_C( 11523),  INT16_C( 27973) },
+      { -INT16_C( 19362), -INT16_C(   647),  INT16_C(  2478),  INT16_C(     7),  INT16_C( 23528),  INT16_C( 12455),  INT16_C(     6),  INT16_C( 32184),
+         INT16_C(     8),  INT16_C(     9), -INT16_C( 11352),  INT16_C(    10),  INT16_C( 19829),  INT16_C(  7315),  INT16_C( 24598), -INT16_C( 21624) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi16(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_popcnt_epi16(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x16(r, simde_x_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_popcnt_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int16_t a[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    {       UINT16_C(30895),
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    {       UINT16_C(   46),
+      { -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+        -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1) },
+      {  INT16_C(     0),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(     0),  INT16_C(    16),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    {       UINT16_C(31068),
+      {  INT16_C( 14338),  INT16_C(   544),  INT16_C(  9281),  INT16_C(  1873),  INT16_C(     0),  INT16_C(   292),  INT16_C(  4112),  INT16_C(  9728),
+         INT16_C(  1092),  INT16_C(     0), -INT16_C( 32232),  INT16_C(    33), -INT16_C( 32061), -INT16_C( 31087),  INT16_C(   265), -INT16_C( 28332) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     4),  INT16_C(     6),  INT16_C(     0),  INT16_C(     0),  INT16_C(     2),  INT16_C(     0),
+         INT16_C(     3),  INT16_C(     0),  INT16_C(     0),  INT16_C(     2),  INT16_C(     6),  INT16_C(     6),  INT16_C(     3),  INT16_C(     0) } },
+    {       UINT16_C(56140),
+      { -INT16_C( 32638),  INT16_C( 16720),  INT16_C( 24580),  INT16_C( 24640),  INT16_C(  8198),  INT16_C(   546),  INT16_C( 16387), -INT16_C( 30656),
+         INT16_C(  1032),  INT16_C( 10432),  INT16_C( 10240),  INT16_C( 14476), -INT16_C( 16384),  INT16_C( 20515),  INT16_C( 22673), -INT16_C( 14336) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     3),  INT16_C(     3),  INT16_C(     0),  INT16_C(     0),  INT16_C(     3),  INT16_C(     0),
+         INT16_C(     2),  INT16_C(     4),  INT16_C(     0),  INT16_C(     6),  INT16_C(     2),  INT16_C(     0),  INT16_C(     6),  INT16_C(     3) } },
+    {       UINT16_C(36931),
+      {  INT16_C(  8320),  INT16_C(  6148), -INT16_C( 19192),  INT16_C(  6144),  INT16_C(  4240),  INT16_C(  5120),  INT16_C( 16448),  INT16_C( 11264),
+         INT16_C(  1163),  INT16_C( 20640),  INT16_C(    32),  INT16_C(    33),  INT16_C(     2), -INT16_C( 23280),  INT16_C( 16416), -INT16_C( 11284) },
+      {  INT16_C(     2),  INT16_C(     3),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     2),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(    10) } },
+    {       UINT16_C( 5975),
+      { -INT16_C( 27485), -INT16_C( 20181), -INT16_C( 12198), -INT16_C( 10487),  INT16_C( 16784), -INT16_C( 30871),  INT16_C(  9776), -INT16_C( 26540),
+         INT16_C(  5995),  INT16_C(  5981), -INT16_C(  9497), -INT16_C( 31499), -INT16_C( 29429), -INT16_C(   468),  INT16_C( 22295),  INT16_C( 18245) },
+      {  INT16_C(     7),  INT16_C(     8),  INT16_C(     7),  INT16_C(     0),  INT16_C(     4),  INT16_C(     0),  INT16_C(     5),  INT16_C(     0),
+         INT16_C(     9),  INT16_C(     9),  INT16_C(    11),  INT16_C(     0),  INT16_C(     7),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    {       UINT16_C(45596),
+      {  INT16_C( 31375),  INT16_C( 11294), -INT16_C( 25078), -INT16_C(  3729), -INT16_C( 28276),  INT16_C(  9262), -INT16_C( 24466), -INT16_C( 30579),
+         INT16_C( 21297), -INT16_C(  8573),  INT16_C( 20325), -INT16_C(  4413),  INT16_C(  5319),  INT16_C(  2640), -INT16_C( 20882), -INT16_C(  2803) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     7),  INT16_C(    11),  INT16_C(     6),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     9),  INT16_C(     0),  INT16_C(     0),  INT16_C(     7),  INT16_C(     4),  INT16_C(     0),  INT16_C(     9) } },
+    {       UINT16_C(39192),
+      {  INT16_C( 32493),  INT16_C( 22430), -INT16_C(  9535),  INT16_C( 12957), -INT16_C( 14372),  INT16_C( 14348),  INT16_C(  9846), -INT16_C(  9696),
+        -INT16_C(   875), -INT16_C(  7417),  INT16_C(  4538),  INT16_C(   145), -INT16_C( 22944),  INT16_C( 28967), -INT16_C( 23741),  INT16_C(  2036) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     8),  INT16_C(    10),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(    10),  INT16_C(     0),  INT16_C(     0),  INT16_C(     3),  INT16_C(     6),  INT16_C(     0),  INT16_C(     0),  INT16_C(     8) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_popcnt_epi16(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x16(r, simde_x_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_popcnt_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1) },
+      {  INT32_C(          32),  INT32_C(          32),  INT32_C(          32),  INT32_C(          32),  INT32_C(          32),  INT32_C(          32),  INT32_C(          32),  INT32_C(          32) } },
+    { {  INT32_C(  1080601472),  INT32_C(   672076802),  INT32_C(  1652634280),  INT32_C(    83111936), -INT32_C(  2107375607),  INT32_C(   981869825),  INT32_C(   102844417),  INT32_C(     6462066) },
+      {  INT32_C(          10),  INT32_C(           9),  INT32_C(          11),  INT32_C(           8),  INT32_C(           7),  INT32_C(          11),  INT32_C(           7),  INT32_C(          11) } },
+    { {  INT32_C(  1342211075),  INT32_C(    29495296),  INT32_C(    67250224), -INT32_C(  2080373756),  INT32_C(   805306384),  INT32_C(    33816576), -INT32_C(  1594473727),  INT32_C(   277881872) },
+      {  INT32_C(           6),  INT32_C(           5),  INT32_C(           6),  INT32_C(           4),  INT32_C(           3),  INT32_C(           2),  INT32_C(          12),  INT32_C(           6) } },
+    { {  INT32_C(   337707043),  INT32_C(  1212380928),  INT32_C(   622071817),  INT32_C(  1632077860), -INT32_C(  1023344636), -INT32_C(  1609031278),  INT32_C(     4491557),  INT32_C(  1079556482) },
+      {  INT32_C(           7),  INT32_C(          11),  INT32_C(           8),  INT32_C(          11),  INT32_C(           6),  INT32_C(           9),  INT32_C(           8),  INT32_C(          11) } },
+    { {  INT32_C(   525404981),  INT32_C(  1596178569),  INT32_C(  1374610813), -INT32_C(  1108444459),  INT32_C(   828502100), -INT32_C(  2045192427),  INT32_C(  1884322999),  INT32_C(  1823597092) },
+      {  INT32_C(          15),  INT32_C(          14),  INT32_C(          20),  INT32_C(          22),  INT32_C(          13),  INT32_C(          14),  INT32_C(          16),  INT32_C(          14) } },
+    { {  INT32_C(   947032405),  INT32_C(   725865498), -INT32_C(   469303467),  INT32_C(   780878705),  INT32_C(   988232686), -INT32_C(  2068718588), -INT32_C(    50643157), -INT32_C(   480519453) },
+      {  INT32_C(          14),  INT32_C(          14),  INT32_C(          18),  INT32_C(          15),  INT32_C(          21),  INT32_C(          12),  INT32_C(          23),  INT32_C(          20) } },
+    { { -INT32_C(  1146315435), -INT32_C(    98032536),  INT32_C(   952181003),  INT32_C(   886280794), -INT32_C(  1391880120), -INT32_C(  1770075212), -INT32_C(  2097835857),  INT32_C(   455414041) },
+      {  INT32_C(          19),  INT32_C(          13),  INT32_C(          11),  INT32_C(          15),  INT32_C(          12),  INT32_C(          19),  INT32_C(          16),  INT32_C(          12) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i r = simde_mm256_popcnt_epi32(a);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_popcnt_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { { -INT32_C(   270631898), -INT32_C(  1274750070),  INT32_C(  2017994377),  INT32_C(    44954120), -INT32_C(   380513678), -INT32_C(  1745694764), -INT32_C(   749479920), -INT32_C(   763752356) },
+      UINT8_C(231),
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(    44954120), -INT32_C(   380513678),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT32_C(   539005265), -INT32_C(  2112870382),  INT32_C(      818881), -INT32_C(   749100512),  INT32_C(  1385018490),  INT32_C(   681175116), -INT32_C(   220894320),  INT32_C(  1536969913) },
+      UINT8_C(  9),
+      { -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1) },
+      {  INT32_C(          32), -INT32_C(  2112870382),  INT32_C(      818881),  INT32_C(          32),  INT32_C(  1385018490),  INT32_C(   681175116), -INT32_C(   220894320),  INT32_C(  1536969913) } },
+    { { -INT32_C(  1626912880),  INT32_C(  1239565832),  INT32_C(  1080976045),  INT32_C(   163848830),  INT32_C(  1466170513),  INT32_C(   459497747),  INT32_C(  2035118939),  INT32_C(  1823041315) },
+      UINT8_C(239),
+      {  INT32_C(  1088528384),  INT32_C(  1342279680),  INT32_C(   136478756), -INT32_C(   595321846),  INT32_C(   273182240), -INT32_C(  1977084854), -INT32_C(  1878785776),  INT32_C(   138809920) },
+      {  INT32_C(           7),  INT32_C(           5),  INT32_C(           6),  INT32_C(          12),  INT32_C(  1466170513),  INT32_C(          10),  INT32_C(           5),  INT32_C(           7) } },
+    { {  INT32_C(  1690116044), -INT32_C(   177375248), -INT32_C(  1540088742),  INT32_C(  1631684337), -INT32_C(   589968171),  INT32_C(   494091601), -INT32_C(   675540741), -INT32_C(  1084672028) },
+      UINT8_C(169),
+      { -INT32_C(  2063581177),  INT32_C(  1275357744),  INT32_C(    17842458),  INT32_C(  1883271254),  INT32_C(       74752),  INT32_C(       66690),  INT32_C(  1111883896),  INT32_C(   125830148) },
+      {  INT32_C(           7), -INT32_C(   177375248), -INT32_C(  1540088742),  INT32_C(          11), -INT32_C(   589968171),  INT32_C(           4), -INT32_C(   675540741),  INT32_C(           6) } },
+    { {  INT32_C(  1445207560),  INT32_C(   451253814), -INT32_C(  1948084830), -INT32_C(   459824128), -INT32_C(   245671097),  INT32_C(  1282955818),  INT32_C(   171628536),  INT32_C(  1528271980) },
+      UINT8_C(104),
+      {  INT32_C(   137379843),  INT32_C(   972036097), -INT32_C(  1671165930),  INT32_C(   541106480),  INT32_C(     2260992), -INT32_C(   905967584),  INT32_C(  1075839113),  INT32_C(   143660032) },
+      {  INT32_C(  1445207560),  INT32_C(   451253814), -INT32_C(  1948084830),  INT32_C(           7), -INT32_C(   245671097),  INT32_C(           6),  INT32_C(           5),  INT32_C(  1528271980) } },
+    { {  INT32_C(   628171029),  INT32_C(  1865808075),  INT32_C(  1610361569), -INT32_C(  1466598087),  INT32_C(  1759240427), -INT32_C(   636571766),  INT32_C(   899717499), -INT32_C(   715547425) },
+      UINT8_C( 77),
+      { -INT32_C(  1238198981), -INT32_C(   864140567), -INT32_C(   734211241), -INT32_C(  1516179695), -INT32_C(  1256732106), -INT32_C(  1926255500),  INT32_C(  1895542276),  INT32_C(    98595880) },
+      {  INT32_C(          17),  INT32_C(  1865808075),  INT32_C(          18),  INT32_C(          15),  INT32_C(  1759240427), -INT32_C(   636571766),  INT32_C(          16), -INT32_C(   715547425) } },
+    { { -INT32_C(    86399988),  INT32_C(   345622145), -INT32_C(  1266298772), -INT32_C(   883470509),  INT32_C(  1961877570), -INT32_C(   446469122), -INT32_C(   963705918), -INT32_C(   296205077) },
+      UINT8_C(120),
+      { -INT32_C(    48136736), -INT32_C(  1078926904),  INT32_C(  2001711698),  INT32_C(   905582217), -INT32_C(  1275314513),  INT32_C(   758352982), -INT32_C(  1334135439), -INT32_C(  1249706159) },
+      { -INT32_C(    86399988),  INT32_C(   345622145), -INT32_C(  1266298772),  INT32_C(          16),  INT32_C(          22),  INT32_C(          15),  INT32_C(          17), -INT32_C(   296205077) } },
+    { { -INT32_C(  1190157181), -INT32_C(  1843106298), -INT32_C(   618821999),  INT32_C(  1973293120),  INT32_C(  1230445359), -INT32_C(  1337964871), -INT32_C(   503012575),  INT32_C(  1630642389) },
+      UINT8_C(134),
+      { -INT32_C(  2035480152),  INT32_C(  1653314219), -INT32_C(  1864556592), -INT32_C(  1690751125),  INT32_C(  1994868184),  INT32_C(   261533070), -INT32_C(  1975621401),  INT32_C(   133212511) },
+      { -INT32_C(  1190157181),  INT32_C(          15),  INT32_C(          16),  INT32_C(  1973293120),  INT32_C(  1230445359), -INT32_C(  1337964871), -INT32_C(   503012575),  INT32_C(          17) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_popcnt_epi32(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_popcnt_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    {       UINT8_C( 27),
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    {       UINT8_C(214),
+      { -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1) },
+      {  INT32_C(           0),  INT32_C(          32),  INT32_C(          32),  INT32_C(           0),  INT32_C(          32),  INT32_C(           0),  INT32_C(          32),  INT32_C(          32) } },
+    {       UINT8_C( 75),
+      {  INT32_C(  1103790370), -INT32_C(  1574625280), -INT32_C(  1072422400), -INT32_C(  2067230205),  INT32_C(    39452944),  INT32_C(    25168000),  INT32_C(   679495728),  INT32_C(   104857801) },
+      {  INT32_C(          10),  INT32_C(           7),  INT32_C(           0),  INT32_C(          10),  INT32_C(           0),  INT32_C(           0),  INT32_C(           7),  INT32_C(           0) } },
+    {       UINT8_C(167),
+      { -INT32_C(  1874165500),  INT32_C(    15990786), -INT32_C(  2147151414), -INT32_C(  2103435246), -INT32_C(  1607467006),  INT32_C(     5342278),  INT32_C(   813826050),  INT32_C(  1141015104) },
+      {  INT32_C(           8),  INT32_C(           6),  INT32_C(           9),  INT32_C(           0),  INT32_C(           0),  INT32_C(           8),  INT32_C(           0),  INT32_C(           6) } },
+    {       UINT8_C(245),
+      {  INT32_C(  1679036484),  INT32_C(   436279363),  INT32_C(  1790510112),  INT32_C(   319340728),  INT32_C(   257985026),  INT32_C(     6335762),  INT32_C(   570508160),  INT32_C(   539002496) },
+      {  INT32_C(           8),  INT32_C(           0),  INT32_C(          11),  INT32_C(           0),  INT32_C(          10),  INT32_C(           9),  INT32_C(           7),  INT32_C(           6) } },
+    {       UINT8_C(  0),
+      {  INT32_C(  1049478268), -INT32_C(  1192506292), -INT32_C(  1054492417),  INT32_C(  1649950238), -INT32_C(   794481268),  INT32_C(  1308928797), -INT32_C(  2124858940),  INT32_C(  1528530448) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    {       UINT8_C( 79),
+      {  INT32_C(   508719317), -INT32_C(  1731879374),  INT32_C(  1291649819), -INT32_C(  1624394132),  INT32_C(  1079922288),  INT32_C(   818801684), -INT32_C(  1623747458), -INT32_C(   799756306) },
+      {  INT32_C(          15),  INT32_C(          15),  INT32_C(          16),  INT32_C(          19),  INT32_C(           0),  INT32_C(           0),  INT32_C(          20),  INT32_C(           0) } },
+    {       UINT8_C(181),
+      {  INT32_C(   142866534),  INT32_C(   866524244),  INT32_C(   452923253),  INT32_C(  1109704134),  INT32_C(   226487852), -INT32_C(   454172513), -INT32_C(  1759428335),  INT32_C(   274651036) },
+      {  INT32_C(          13),  INT32_C(           0),  INT32_C(          20),  INT32_C(           0),  INT32_C(          19),  INT32_C(          19),  INT32_C(           0),  INT32_C(          16) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_popcnt_epi32(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_popcnt_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { { -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1) },
+      {  INT64_C(                  64),  INT64_C(                  64),  INT64_C(                  64),  INT64_C(                  64) } },
+    { {  INT64_C( 4947415393282378208),  INT64_C( 4661295993843617872),  INT64_C( 2378784640690827273), -INT64_C( 8594810926048187872) },
+      {  INT64_C(                  24),  INT64_C(                  11),  INT64_C(                  16),  INT64_C(                  17) } },
+    { {  INT64_C(  148620034068541508), -INT64_C(  864545975660379696),  INT64_C(  592401077422817808),  INT64_C( 5916683539462522901) },
+      {  INT64_C(                  16),  INT64_C(                  17),  INT64_C(                  18),  INT64_C(                  21) } },
+    { {  INT64_C( 3542408018449164400),  INT64_C(  874649422471709186),  INT64_C( 6922174475543419141),  INT64_C( 1333777988340154880) },
+      {  INT64_C(                  23),  INT64_C(                  18),  INT64_C(                  16),  INT64_C(                  12) } },
+    { { -INT64_C( 1823622181113147743), -INT64_C( 7466296518640038209), -INT64_C(  726531602728132807), -INT64_C( 7145212178636725638) },
+      {  INT64_C(                  30),  INT64_C(                  37),  INT64_C(                  40),  INT64_C(                  31) } },
+    { { -INT64_C( 1640549555372949446), -INT64_C( 5089908035198166122), -INT64_C( 3650232517362060694), -INT64_C( 6464181365761741738) },
+      {  INT64_C(                  30),  INT64_C(                  32),  INT64_C(                  38),  INT64_C(                  31) } },
+    { { -INT64_C( 1839720383741961180),  INT64_C( 4524243734892045085),  INT64_C( 2126292909000175076), -INT64_C( 3312213704955624631) },
+      {  INT64_C(                  26),  INT64_C(                  36),  INT64_C(                  27),  INT64_C(                  29) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i r = simde_mm256_popcnt_epi64(a);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_popcnt_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[4];
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { {  INT64_C( 2023900507277198942),  INT64_C( 4523299385628901264),  INT64_C( 8745417038302760924),  INT64_C( 6928889808410782885) },
+      UINT8_C(106),
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C( 2023900507277198942),  INT64_C(                   0),  INT64_C( 8745417038302760924),  INT64_C(                   0) } },
+    { {  INT64_C( 7342640218558381373),  INT64_C( 6520713636556902739), -INT64_C( 3365892523077086292), -INT64_C( 2951638075306661806) },
+      UINT8_C( 91),
+      { -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1) },
+      {  INT64_C(                  64),  INT64_C(                  64), -INT64_C( 3365892523077086292),  INT64_C(                  64) } },
+    { { -INT64_C( 4571206080361302767), -INT64_C( 9135150490878502669),  INT64_C( 1966910680072304190),  INT64_C(  389522357102285461) },
+      UINT8_C(136),
+      {  INT64_C(   72942188927534148), -INT64_C( 2304153594521900988), -INT64_C( 8070450445773401400),  INT64_C( 1445944970061251783) },
+      { -INT64_C( 4571206080361302767), -INT64_C( 9135150490878502669),  INT64_C( 1966910680072304190),  INT64_C(                  22) } },
+    { { -INT64_C( 4865416658586229453), -INT64_C( 3247256627196263597),  INT64_C( 8877604800673928525), -INT64_C( 4402952399783403209) },
+      UINT8_C(176),
+      { -INT64_C( 4598122226443564944), -INT64_C( 8059134212501169517),  INT64_C( 5782904292033722628),  INT64_C( 1153564478462251056) },
+      { -INT64_C( 4865416658586229453), -INT64_C( 3247256627196263597),  INT64_C( 8877604800673928525), -INT64_C( 4402952399783403209) } },
+    { {  INT64_C( 3092026396421256377),  INT64_C( 1031037805769369602), -INT64_C( 1029566704292280436), -INT64_C( 4400707009204161456) },
+      UINT8_C(212),
+      {  INT64_C(    6975453164299202),  INT64_C( 8646913592345864258),  INT64_C(  640428156970336890),  INT64_C(  722832346545930368) },
+      {  INT64_C( 3092026396421256377),  INT64_C( 1031037805769369602),  INT64_C(                  17), -INT64_C( 4400707009204161456) } },
+    { {  INT64_C( 4883591054291865202),  INT64_C( 2451102562636298435),  INT64_C( 8835252528291009634), -INT64_C( 3932452531716894126) },
+      UINT8_C(151),
+      { -INT64_C( 2406612446271887858), -INT64_C( 5827138322767281433),  INT64_C( 3413720699702509106), -INT64_C( 6511393955053158253) },
+      {  INT64_C(                  39),  INT64_C(                  29),  INT64_C(                  36), -INT64_C( 3932452531716894126) } },
+    { {  INT64_C( 8331909154852877081),  INT64_C( 5568613007330420059),  INT64_C( 5520051093460547397),  INT64_C( 3864340714428686388) },
+      UINT8_C(170),
+      {  INT64_C(  621788469017527677), -INT64_C(  129857125008485982),  INT64_C( 8753728200065630525), -INT64_C( 6983665632529134729) },
+      {  INT64_C( 8331909154852877081),  INT64_C(                  27),  INT64_C( 5520051093460547397),  INT64_C(                  38) } },
+    { { -INT64_C( 1782447021551535540),  INT64_C( 3397871447556798380), -INT64_C( 4906452837788005665),  INT64_C( 7946162076977766330) },
+      UINT8_C( 90),
+      { -INT64_C( 3653151717720224049), -INT64_C( 1325013605103344222),  INT64_C(  373587482858123338),  INT64_C( 1015056705008007025) },
+      { -INT64_C( 1782447021551535540),  INT64_C(                  32), -INT64_C( 4906452837788005665),  INT64_C(                  32) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi64(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i r = simde_mm256_mask_popcnt_epi64(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_popcnt_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    {       UINT8_C(176),
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    {       UINT8_C( 65),
+      { -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1) },
+      {  INT64_C(                  64),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    {       UINT8_C(132),
+      { -INT64_C( 8070357966491995064),  INT64_C(  730078612259471434),  INT64_C(  587438277214217221),  INT64_C( 4684307137944354818) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                  15),  INT64_C(                   0) } },
+    {       UINT8_C(182),
+      {  INT64_C( 5844714092492812360),  INT64_C( 1532438769247584537),  INT64_C(    2834626879947360),  INT64_C( 7082218277367187585) },
+      {  INT64_C(                   0),  INT64_C(                  19),  INT64_C(                  10),  INT64_C(                   0) } },
+    {       UINT8_C(200),
+      {  INT64_C(  513701196751601777),  INT64_C(  840026961467416711), -INT64_C( 6462876569256770271),  INT64_C(  162240130514423942) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                  16) } },
+    {       UINT8_C( 68),
+      { -INT64_C( 5714221542816381263), -INT64_C( 1831494872934962903), -INT64_C( 9221117862434374393),  INT64_C( 1546176788248444183) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                  23),  INT64_C(                   0) } },
+    {       UINT8_C(128),
+      { -INT64_C( 4264553128263357520),  INT64_C( 8427314700709273341), -INT64_C( 1297329332233156494), -INT64_C( 6616785665147389384) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    {       UINT8_C(193),
+      { -INT64_C( 2137264142643278029), -INT64_C( 3872851953165088495),  INT64_C( 4801277181072832339), -INT64_C( 5568961175317684320) },
+      {  INT64_C(                  30),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i r = simde_mm256_maskz_popcnt_epi64(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_popcnt_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[64];
+    const int8_t r[64];
+  } test_vec[] = {
+    { {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    { { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+      {  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),
+         INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),
+         INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),
+         INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),
+         INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),
+         INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),
+         INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),
+         INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8) } },
+    { {  INT8_C(  64),  INT8_C(  66),  INT8_C(  32), -INT8_C(  63),  INT8_C(  66),  INT8_C(   0), -INT8_C(  64),  INT8_C(   8),
+         INT8_C(  16),  INT8_C(   3),  INT8_C(  80),  INT8_C(  42),  INT8_C(  61),  INT8_C(  97),  INT8_C(   8),  INT8_C(   8),
+         INT8_C(  37),  INT8_C(  64),  INT8_C(   9),  INT8_C(  32),  INT8_C(   1), -INT8_C(  48),  INT8_C(  16),  INT8_C( 109),
+         INT8_C(  12),  INT8_C(  22),  INT8_C(  16),  INT8_C(  20),  INT8_C(   0),  INT8_C(   1),  INT8_C(   2),  INT8_C(  20),
+         INT8_C(  72),  INT8_C(   8), -INT8_C(  96),  INT8_C(   0),  INT8_C(  78),  INT8_C(   2),  INT8_C(   0),  INT8_C(   1),
+         INT8_C(   1), -INT8_C(  71),  INT8_C(   0),      INT8_MIN,  INT8_C(  16), -INT8_C( 106), -INT8_C(  46), -INT8_C(  78),
+         INT8_C(  24),  INT8_C(  85), -INT8_C( 126),  INT8_C(  16),  INT8_C(  16), -INT8_C( 126),  INT8_C(  18),  INT8_C(  52),
+         INT8_C(   0),  INT8_C(  33), -INT8_C( 124), -INT8_C( 124),  INT8_C(  32), -INT8_C(  88),  INT8_C(  33),  INT8_C(   0) },
+      {  INT8_C(   1),  INT8_C(   2),  INT8_C(   1),  INT8_C(   3),  INT8_C(   2),  INT8_C(   0),  INT8_C(   2),  INT8_C(   1),
+         INT8_C(   1),  INT8_C(   2),  INT8_C(   2),  INT8_C(   3),  INT8_C(   5),  INT8_C(   3),  INT8_C(   1),  INT8_C(   1),
+         INT8_C(   3),  INT8_C(   1),  INT8_C(   2),  INT8_C(   1),  INT8_C(   1),  INT8_C(   3),  INT8_C(   1),  INT8_C(   5),
+         INT8_C(   2),  INT8_C(   3),  INT8_C(   1),  INT8_C(   2),  INT8_C(   0),  INT8_C(   1),  INT8_C(   1),  INT8_C(   2),
+         INT8_C(   2),  INT8_C(   1),  INT8_C(   2),  INT8_C(   0),  INT8_C(   4),  INT8_C(   1),  INT8_C(   0),  INT8_C(   1),
+         INT8_C(   1),  INT8_C(   5),  INT8_C(   0),  INT8_C(   1),  INT8_C(   1),  INT8_C(   4),  INT8_C(   4),  INT8_C(   4),
+         INT8_C(   2),  INT8_C(   4),  INT8_C(   2),  INT8_C(   1),  INT8_C(   1),  INT8_C(   2),  INT8_C(   2),  INT8_C(   3),
+         INT8_C(   0),  INT8_C(   2),  INT8_C(   2),  INT8_C(   2),  INT8_C(   1),  INT8_C(   3),  INT8_C(   2),  INT8_C(   0) } },
+    { {  INT8_C(  32),  INT8_C(  12), -INT8_C( 126),  INT8_C(  36), -INT8_C( 119), -INT8_C(  54),  INT8_C(  33), -INT8_C(  92),
+         INT8_C( 102), -INT8_C( 103),  INT8_C(  64),  INT8_C(  64),      INT8_MIN,  INT8_C(  88),  INT8_C(  53),  INT8_C(  65),
+        -INT8_C( 123),  INT8_C(  12),  INT8_C(  40),  INT8_C(  16),  INT8_C(   0), -INT8_C(  80), -INT8_C(  47), -INT8_C( 124),
+         INT8_C(   3),  INT8_C(   1),  INT8_C(   0),  INT8_C(  76),  INT8_C(  11),      INT8_MIN,  INT8_C(   4), -INT8_C(  59),
+         INT8_C(  44),  INT8_C(  32),  INT8_C(  32),  INT8_C(  34),  INT8_C(  14),  INT8_C( 121),  INT8_C(   0),      INT8_MIN,
+        -INT8_C(  60),  INT8_C(  76), -INT8_C( 112),      INT8_MIN, -INT8_C( 106),  INT8_C(   0), -INT8_C(  90),  INT8_C(  55),
+        -INT8_C(  61),  INT8_C(   8), -INT8_C( 120),  INT8_C(  33),  INT8_C(  57),  INT8_C(  57), -INT8_C(  76),  INT8_C(  80),
+        -INT8_C(  80),  INT8_C(  90), -INT8_C(  95),  INT8_C(   2), -INT8_C(  96),  INT8_C(  18),  INT8_C( 104),  INT8_C(  64) },
+      {  INT8_C(   1),  INT8_C(   2),  INT8_C(   2),  INT8_C(   2),  INT8_C(   3),  INT8_C(   4),  INT8_C(   2),  INT8_C(   3),
+         INT8_C(   4),  INT8_C(   4),  INT8_C(   1),  INT8_C(   1),  INT8_C(   1),  INT8_C(   3),  INT8_C(   4),  INT8_C(   2),
+         INT8_C(   3),  INT8_C(   2),  INT8_C(   2),  INT8_C(   1),  INT8_C(   0),  INT8_C(   3),  INT8_C(   4),  INT8_C(   2),
+         INT8_C(   2),  INT8_C(   1),  INT8_C(   0),  INT8_C(   3),  INT8_C(   3),  INT8_C(   1),  INT8_C(   1),  INT8_C(   4),
+         INT8_C(   3),  INT8_C(   1),  INT8_C(   1),  INT8_C(   2),  INT8_C(   3),  INT8_C(   5),  INT8_C(   0),  INT8_C(   1),
+         INT8_C(   3),  INT8_C(   3),  INT8_C(   2),  INT8_C(   1),  INT8_C(   4),  INT8_C(   0),  INT8_C(   4),  INT8_C(   5),
+         INT8_C(   4),  INT8_C(   1),  INT8_C(   2),  INT8_C(   2),  INT8_C(   4),  INT8_C(   4),  INT8_C(   4),  INT8_C(   2),
+         INT8_C(   3),  INT8_C(   4),  INT8_C(   3),  INT8_C(   1),  INT8_C(   2),  INT8_C(   2),  INT8_C(   3),  INT8_C(   1) } },
+    { {  INT8_C(  65),  INT8_C(   8),  INT8_C(  67),  INT8_C(  64),      INT8_MIN,  INT8_C(  24),  INT8_C(  17),  INT8_C(  32),
+         INT8_C(  17),  INT8_C(   0),  INT8_C(   1),  INT8_C(  66),  INT8_C(   4),  INT8_C(  16), -INT8_C(  48),  INT8_C(  32),
+        -INT8_C( 123), -INT8_C(  48),  INT8_C(  25),  INT8_C( 104),  INT8_C(  34),  INT8_C(  32), -INT8_C(  46),  INT8_C(   1),
+         INT8_C(  20),  INT8_C(   2),  INT8_C(   2),  INT8_C(  32),  INT8_C(  52),  INT8_C(   4), -INT8_C( 125),  INT8_C(  66),
+         INT8_C(  50), -INT8_C( 112),  INT8_C(  80),  INT8_C(  17),  INT8_C(  25),  INT8_C(  73),  INT8_C(   3),      INT8_MIN,
+         INT8_C(  96),  INT8_C(  64), -INT8_C( 120), -INT8_C(   7),  INT8_C(   8),  INT8_C(   8), -INT8_C( 126), -INT8_C(  19),
+             INT8_MIN,  INT8_C(  67), -INT8_C(  84), -INT8_C(  58),  INT8_C(  12),  INT8_C(   0), -INT8_C(  12),  INT8_C(   8),
+        -INT8_C( 115),  INT8_C(   2), -INT8_C(  92),  INT8_C(   8), -INT8_C( 115),  INT8_C( 104), -INT8_C( 112),  INT8_C(  17) },
+      {  INT8_C(   2),  INT8_C(   1),  INT8_C(   3),  INT8_C(   1),  INT8_C(   1),  INT8_C(   2),  INT8_C(   2),  INT8_C(   1),
+         INT8_C(   2),  INT8_C(   0),  INT8_C(   1),  INT8_C(   2),  INT8_C(   1),  INT8_C(   1),  INT8_C(   3),  INT8_C(   1),
+         INT8_C(   3),  INT8_C(   3),  INT8_C(   3),  INT8_C(   3),  INT8_C(   2),  INT8_C(   1),  INT8_C(   4),  INT8_C(   1),
+         INT8_C(   2),  INT8_C(   1),  INT8_C(   1),  INT8_C(   1),  INT8_C(   3),  INT8_C(   1),  INT8_C(   3),  INT8_C(   2),
+         INT8_C(   3),  INT8_C(   2),  INT8_C(   2),  INT8_C(   2),  INT8_C(   3),  INT8_C(   3),  INT8_C(   2),  INT8_C(   1),
+         INT8_C(   2),  INT8_C(   1),  INT8_C(   2),  INT8_C(   6),  INT8_C(   1),  INT8_C(   1),  INT8_C(   2),  INT8_C(   6),
+         INT8_C(   1),  INT8_C(   3),  INT8_C(   4),  INT8_C(   4),  INT8_C(   2),  INT8_C(   0),  INT8_C(   5),  INT8_C(   1),
+         INT8_C(   4),  INT8_C(   1),  INT8_C(   3),  INT8_C(   1),  INT8_C(   4),  INT8_C(   3),  INT8_C(   2),  INT8_C(   2) } },
+    { { -INT8_C(  49),  INT8_C(   8),  INT8_C(  86),  INT8_C(  20),  INT8_C(  92),  INT8_C( 118),  INT8_C(  92),  INT8_C(  60),
+        -INT8_C(  80), -INT8_C(  29), -INT8_C(  30),  INT8_C(  99), -INT8_C( 127), -INT8_C(  34),  INT8_C(  85),  INT8_C(  31),
+        -INT8_C(  59),  INT8_C(   8), -INT8_C(  18), -INT8_C(  79), -INT8_C( 106), -INT8_C(   1),  INT8_C(  24), -INT8_C(   2),
+         INT8_C(  23),  INT8_C(  47), -INT8_C(   3),  INT8_C(  76),  INT8_C(  92), -INT8_C(  70), -INT8_C(  19),  INT8_C(  20),
+        -INT8_C( 124),  INT8_C( 109),  INT8_C(   3), -INT8_C(  63), -INT8_C( 108), -INT8_C(  23), -INT8_C( 100),  INT8_C(  27),
+        -INT8_C( 107), -INT8_C( 124), -INT8_C(  77),  INT8_C(  80),  INT8_C(  48), -INT8_C( 126),  INT8_C(  11), -INT8_C(  53),
+         INT8_C(  82),  INT8_C( 104), -INT8_C(  84),  INT8_C( 105),  INT8_C(  23),  INT8_C(  45),  INT8_C(   5), -INT8_C(   3),
+         INT8_C(  12), -INT8_C(  94), -INT8_C(   5),  INT8_C( 100), -INT8_C( 120),  INT8_C(  31), -INT8_C( 117),  INT8_C( 126) },
+      {  INT8_C(   6),  INT8_C(   1),  INT8_C(   4),  INT8_C(   2),  INT8_C(   4),  INT8_C(   5),  INT8_C(   4),  INT8_C(   4),
+         INT8_C(   3),  INT8_C(   5),  INT8_C(   4),  INT8_C(   4),  INT8_C(   2),  INT8_C(   6),  INT8_C(   4),  INT8_C(   5),
+         INT8_C(   4),  INT8_C(   1),  INT8_C(   6),  INT8_C(   4),  INT8_C(   4),  INT8_C(   8),  INT8_C(   2),  INT8_C(   7),
+         INT8_C(   4),  INT8_C(   5),  INT8_C(   7),  INT8_C(   3),  INT8_C(   4),  INT8_C(   5),  INT8_C(   6),  INT8_C(   2),
+         INT8_C(   2),  INT8_C(   5),  INT8_C(   2),  INT8_C(   3),  INT8_C(   3),  INT8_C(   5),  INT8_C(   4),  INT8_C(   4),
+         INT8_C(   4),  INT8_C(   2),  INT8_C(   5),  INT8_C(   2),  INT8_C(   2),  INT8_C(   2),  INT8_C(   3),  INT8_C(   5),
+         INT8_C(   3),  INT8_C(   3),  INT8_C(   4),  INT8_C(   4),  INT8_C(   4),  INT8_C(   4),  INT8_C(   2),  INT8_C(   7),
+         INT8_C(   2),  INT8_C(   3),  INT8_C(   7),  INT8_C(   3),  INT8_C(   2),  INT8_C(   5),  INT8_C(   4),  INT8_C(   6) } },
+    { {  INT8_C(  96), -INT8_C( 112), -INT8_C( 115),  INT8_C(  18), -INT8_C( 102), -INT8_C(  23),  INT8_C(  54),  INT8_C(  50),
+        -INT8_C(  92),  INT8_C(  49), -INT8_C(  45),  INT8_C( 124), -INT8_C(  14),  INT8_C(  95),  INT8_C(  99),  INT8_C(  15),
+        -INT8_C(  75),  INT8_C(  26), -INT8_C(  98),  INT8_C(  53),  INT8_C(  31),  INT8_C( 117), -INT8_C(  75), -INT8_C(  44),
+        -INT8_C(  33),  INT8_C(  60),  INT8_C(  58),  INT8_C(  74), -INT8_C( 108),  INT8_C(  55), -INT8_C(  63),  INT8_C(  84),
+         INT8_C(  68),  INT8_C(  90),  INT8_C(  24), -INT8_C(  90), -INT8_C( 121), -INT8_C(  40), -INT8_C(  35), -INT8_C(  44),
+        -INT8_C(  71), -INT8_C(  12), -INT8_C(  51), -INT8_C(  52),  INT8_C(  37), -INT8_C(   9), -INT8_C(  22),  INT8_C(  41),
+        -INT8_C(  55), -INT8_C( 108), -INT8_C(  19),  INT8_C(  32),  INT8_C(  78),  INT8_C(  30), -INT8_C(  32),  INT8_C(  57),
+        -INT8_C(  43), -INT8_C( 124), -INT8_C(  33),  INT8_C(  94), -INT8_C(  28),  INT8_C( 109),  INT8_C(  87), -INT8_C(  53) },
+      {  INT8_C(   2),  INT8_C(   2),  INT8_C(   4),  INT8_C(   2),  INT8_C(   4),  INT8_C(   5),  INT8_C(   4),  INT8_C(   3),
+         INT8_C(   3),  INT8_C(   3),  INT8_C(   5),  INT8_C(   5),  INT8_C(   5),  INT8_C(   6),  INT8_C(   4),  INT8_C(   4),
+         INT8_C(   5),  INT8_C(   3),  INT8_C(   5),  INT8_C(   4),  INT8_C(   5),  INT8_C(   5),  INT8_C(   5),  INT8_C(   4),
+         INT8_C(   7),  INT8_C(   4),  INT8_C(   4),  INT8_C(   3),  INT8_C(   3),  INT8_C(   5),  INT8_C(   3),  INT8_C(   3),
+         INT8_C(   2),  INT8_C(   4),  INT8_C(   2),  INT8_C(   4),  INT8_C(   4),  INT8_C(   4),  INT8_C(   6),  INT8_C(   4),
+         INT8_C(   5),  INT8_C(   5),  INT8_C(   5),  INT8_C(   4),  INT8_C(   3),  INT8_C(   7),  INT8_C(   5),  INT8_C(   3),
+         INT8_C(   4),  INT8_C(   3),  INT8_C(   6),  INT8_C(   1),  INT8_C(   4),  INT8_C(   4),  INT8_C(   3),  INT8_C(   4),
+         INT8_C(   5),  INT8_C(   2),  INT8_C(   7),  INT8_C(   5),  INT8_C(   4),  INT8_C(   5),  INT8_C(   5),  INT8_C(   5) } },
+    { { -INT8_C(  69), -INT8_C(  68), -INT8_C(   7), -INT8_C(  26),  INT8_C( 115), -INT8_C( 127),  INT8_C(  56), -INT8_C(  58),
+        -INT8_C(  19),  INT8_C(  94), -INT8_C( 104), -INT8_C( 109),  INT8_C(  48), -INT8_C(  50),  INT8_C( 117),  INT8_C(  45),
+        -INT8_C( 125), -INT8_C(  68), -INT8_C(  71),  INT8_C(   4),  INT8_C(   4), -INT8_C( 114),  INT8_C(  71), -INT8_C(  35),
+        -INT8_C(  82), -INT8_C(  79), -INT8_C(  90), -INT8_C( 121), -INT8_C( 124),  INT8_C(  13), -INT8_C( 101),  INT8_C(  86),
+        -INT8_C(  24), -INT8_C(  95),  INT8_C( 120), -INT8_C(  90),  INT8_C(  85),  INT8_C( 119),  INT8_C(  37), -INT8_C(  95),
+         INT8_C( 108),  INT8_C( 124),  INT8_C(  70),  INT8_C( 102),  INT8_C(  24), -INT8_C(  40),  INT8_C(  29), -INT8_C(  55),
+         INT8_C(  58),  INT8_C( 112), -INT8_C(  80),  INT8_C(  95),  INT8_C(  53), -INT8_C(  99),  INT8_C( 122), -INT8_C(  62),
+         INT8_C(  79),  INT8_C(   9), -INT8_C(  25),  INT8_C(  98), -INT8_C(  74), -INT8_C(  43),  INT8_C( 102),  INT8_C( 120) },
+      {  INT8_C(   6),  INT8_C(   5),  INT8_C(   6),  INT8_C(   5),  INT8_C(   5),  INT8_C(   2),  INT8_C(   3),  INT8_C(   4),
+         INT8_C(   6),  INT8_C(   5),  INT8_C(   3),  INT8_C(   4),  INT8_C(   2),  INT8_C(   5),  INT8_C(   5),  INT8_C(   4),
+         INT8_C(   3),  INT8_C(   5),  INT8_C(   5),  INT8_C(   1),  INT8_C(   1),  INT8_C(   4),  INT8_C(   4),  INT8_C(   6),
+         INT8_C(   5),  INT8_C(   4),  INT8_C(   4),  INT8_C(   4),  INT8_C(   2),  INT8_C(   3),  INT8_C(   5),  INT8_C(   4),
+         INT8_C(   4),  INT8_C(   3),  INT8_C(   4),  INT8_C(   4),  INT8_C(   4),  INT8_C(   6),  INT8_C(   3),  INT8_C(   3),
+         INT8_C(   4),  INT8_C(   5),  INT8_C(   3),  INT8_C(   4),  INT8_C(   2),  INT8_C(   4),  INT8_C(   4),  INT8_C(   4),
+         INT8_C(   4),  INT8_C(   3),  INT8_C(   3),  INT8_C(   6),  INT8_C(   4),  INT8_C(   5),  INT8_C(   5),  INT8_C(   3),
+         INT8_C(   5),  INT8_C(   2),  INT8_C(   6),  INT8_C(   3),  INT8_C(   5),  INT8_C(   5),  INT8_C(   4),  INT8_C(   4) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i r = simde_mm512_popcnt_epi8(a);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_popcnt_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t src[64];
+    const simde__mmask64 k;
+    const int8_t a[64];
+    const int8_t r[64];
+  } test_vec[] = {
+    { {  INT8_C(  53), -INT8_C(  25),  INT8_C(  94),  INT8_C(  76), -INT8_C(  74), -INT8_C(  73),  INT8_C(  32),  INT8_C(  22),
+         INT8_C(  30), -INT8_C(  52),  INT8_C( 103), -INT8_C(  71),      INT8_MIN,  INT8_C(  21), -INT8_C(  99), -INT8_C(   2),
+         INT8_C(  91), -INT8_C(  89),  INT8_C( 122),  INT8_C( 100), -INT8_C(  16), -INT8_C(  79), -INT8_C(  34),  INT8_C(  37),
+         INT8_C(  81),  INT8_C(  77),  INT8_C(  71),  INT8_C(  63),  INT8_C(  41),  INT8_C(  51), -INT8_C(  31), -INT8_C(  10),
+        -INT8_C(  59),  INT8_C(  76), -INT8_C(  84), -INT8_C( 107), -INT8_C( 124), -INT8_C(   5),  INT8_C(  98), -INT8_C( 110),
+         INT8_C(  59),  INT8_C(   1), -INT8_C( 127), -INT8_C(  66),  INT8_C(   7), -INT8_C(  77),  INT8_C( 118), -INT8_C(  50),
+         INT8_C(  53), -INT8_C(  95), -INT8_C(  24),  INT8_C(  53), -INT8_C(   1), -INT8_C( 118),  INT8_C(  27),  INT8_C(  45),
+         INT8_C( 123),  INT8_C( 125),  INT8_C(  63),  INT8_C(  25), -INT8_C(   7),  INT8_C(  18),  INT8_C(  46), -INT8_C(  88) },
+      UINT64_C(10996818682425000116),
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+      {  INT8_C(  53), -INT8_C(  25),  INT8_C(   0),  INT8_C(  76),  INT8_C(   0),  INT8_C(   0),  INT8_C(  32),  INT8_C(   0),
+         INT8_C(  30), -INT8_C(  52),  INT8_C( 103), -INT8_C(  71),      INT8_MIN,  INT8_C(  21),  INT8_C(   0), -INT8_C(   2),
+         INT8_C(  91),  INT8_C(   0),  INT8_C( 122),  INT8_C( 100),  INT8_C(   0), -INT8_C(  79),  INT8_C(   0),  INT8_C(  37),
+         INT8_C(   0),  INT8_C(  77),  INT8_C(  71),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0), -INT8_C(  84), -INT8_C( 107),  INT8_C(   0), -INT8_C(   5),  INT8_C(   0), -INT8_C( 110),
+         INT8_C(  59),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   7), -INT8_C(  77),  INT8_C( 118),  INT8_C(   0),
+         INT8_C(  53), -INT8_C(  95),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C( 118),  INT8_C(  27),  INT8_C(   0),
+         INT8_C( 123),  INT8_C( 125),  INT8_C(  63),  INT8_C(   0),  INT8_C(   0),  INT8_C(  18),  INT8_C(  46),  INT8_C(   0) } },
+    { {  INT8_C(  16),  INT8_C(  24), -INT8_C(  18),  INT8_C( 121),  INT8_C(   3), -INT8_C(  45), -INT8_C(  96), -INT8_C(   1),
+         INT8_C(  42), -INT8_C( 120),  INT8_C(  77), -INT8_C( 115), -INT8_C(  74), -INT8_C( 119),  INT8_C( 122), -INT8_C( 102),
+        -INT8_C( 115), -INT8_C(  64),  INT8_C(  83),  INT8_C(  99),  INT8_C( 117), -INT8_C(   1), -INT8_C(  42),  INT8_C(  59),
+        -INT8_C( 125),  INT8_C(   0), -INT8_C(  42),  INT8_C(  47), -INT8_C( 117),  INT8_C( 100),  INT8_C(   6), -INT8_C( 122),
+         INT8_C(  37), -INT8_C(  47), -INT8_C( 110), -INT8_C( 107), -INT8_C( 126),  INT8_C(   3),  INT8_C(  79),  INT8_C(  13),
+         INT8_C(  71), -INT8_C(  27), -INT8_C(  76),  INT8_C( 103),  INT8_C( 101), -INT8_C(  49), -INT8_C(  78), -INT8_C(   3),
+        -INT8_C(  70), -INT8_C( 107),  INT8_C(  88), -INT8_C(  68), -INT8_C(  55),  INT8_C(  86),  INT8_C(  38),  INT8_C(  96),
+         INT8_C(  58), -INT8_C(  14),  INT8_C(  51),  INT8_C( 101),  INT8_C(  87), -INT8_C( 113),  INT8_C( 126),  INT8_C(  72) },
+      UINT64_C(12476450938086949912),
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+      {  INT8_C(  16),  INT8_C(  24), -INT8_C(  18),  INT8_C(   8),  INT8_C(   8), -INT8_C(  45), -INT8_C(  96), -INT8_C(   1),
+         INT8_C(  42), -INT8_C( 120),  INT8_C(   8), -INT8_C( 115), -INT8_C(  74), -INT8_C( 119),  INT8_C( 122), -INT8_C( 102),
+         INT8_C(   8),  INT8_C(   8),  INT8_C(  83),  INT8_C(  99),  INT8_C( 117), -INT8_C(   1),  INT8_C(   8),  INT8_C(  59),
+        -INT8_C( 125),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8), -INT8_C( 117),  INT8_C(   8),  INT8_C(   8), -INT8_C( 122),
+         INT8_C(  37),  INT8_C(   8),  INT8_C(   8), -INT8_C( 107), -INT8_C( 126),  INT8_C(   3),  INT8_C(  79),  INT8_C(  13),
+         INT8_C(  71),  INT8_C(   8), -INT8_C(  76),  INT8_C( 103),  INT8_C( 101), -INT8_C(  49),  INT8_C(   8), -INT8_C(   3),
+         INT8_C(   8), -INT8_C( 107),  INT8_C(   8), -INT8_C(  68), -INT8_C(  55),  INT8_C(   8),  INT8_C(  38),  INT8_C(  96),
+         INT8_C(   8), -INT8_C(  14),  INT8_C(   8),  INT8_C(   8),  INT8_C(  87),  INT8_C(   8),  INT8_C( 126),  INT8_C(   8) } },
+    { { -INT8_C(  34), -INT8_C(  59),  INT8_C(   4),  INT8_C(  42),  INT8_C(  82),  INT8_C( 108), -INT8_C(   2), -INT8_C( 111),
+         INT8_C(  60),  INT8_C(   0), -INT8_C(  32), -INT8_C(  73),  INT8_C(  46),  INT8_C(   2), -INT8_C(  24),  INT8_C(   5),
+        -INT8_C(   7), -INT8_C(  44), -INT8_C( 111), -INT8_C(  52),  INT8_C(  63),  INT8_C(  47), -INT8_C(  95),  INT8_C(  68),
+         INT8_C(  74),  INT8_C(  76), -INT8_C(  82),  INT8_C( 127), -INT8_C(  91), -INT8_C( 126), -INT8_C(  41),  INT8_C(  48),
+         INT8_C( 114),  INT8_C(  28),  INT8_C( 110), -INT8_C(  94), -INT8_C(   1), -INT8_C(  66),  INT8_C(  95), -INT8_C( 119),
+         INT8_C(  30),  INT8_C(  10), -INT8_C(  78),  INT8_C(  55),  INT8_C(  59), -INT8_C(  51), -INT8_C(  46),  INT8_C( 125),
+        -INT8_C( 115),  INT8_C(  84),  INT8_C(  36),  INT8_C( 126), -INT8_C(  42),  INT8_C(  39),  INT8_C(  17),  INT8_C(  63),
+        -INT8_C( 107),  INT8_C( 100),  INT8_C( 124),  INT8_C(  26),  INT8_C(   6), -INT8_C(   2), -INT8_C(  79),  INT8_C(  56) },
+      UINT64_C(10863755769316370700),
+      {  INT8_C(  32), -INT8_C( 124), -INT8_C(  94),  INT8_C(  64),  INT8_C(  24),  INT8_C(  41),  INT8_C(  73),  INT8_C(  14),
+        -INT8_C( 119), -INT8_C(  46),  INT8_C(   1),  INT8_C(   0),  INT8_C(  32),  INT8_C(  14),  INT8_C(  64),  INT8_C(   0),
+         INT8_C( 121),  INT8_C(   8),  INT8_C(   0),  INT8_C(  13),  INT8_C(   9), -INT8_C(  52),  INT8_C(  72),  INT8_C(  41),
+         INT8_C(   0), -INT8_C(  31), -INT8_C(  48),  INT8_C(   9),  INT8_C(   1),  INT8_C(   4),  INT8_C(  99),  INT8_C(  32),
+        -INT8_C( 127),  INT8_C(   0),  INT8_C(  10),  INT8_C(   4),  INT8_C(   2),  INT8_C(  33), -INT8_C(  32),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(  16), -INT8_C(  82),  INT8_C(   0), -INT8_C( 102),  INT8_C(  64),
+         INT8_C(  65),      INT8_MIN,  INT8_C(   0), -INT8_C( 127),  INT8_C(  32), -INT8_C(  62),  INT8_C(  50),  INT8_C(  90),
+        -INT8_C( 126),  INT8_C(  25),  INT8_C(  16),  INT8_C(  73),  INT8_C(   8),  INT8_C(   0),  INT8_C(  16), -INT8_C( 120) },
+      { -INT8_C(  34), -INT8_C(  59),  INT8_C(   3),  INT8_C(   1),  INT8_C(  82),  INT8_C( 108), -INT8_C(   2), -INT8_C( 111),
+         INT8_C(   3),  INT8_C(   0), -INT8_C(  32),  INT8_C(   0),  INT8_C(  46),  INT8_C(   3),  INT8_C(   1),  INT8_C(   0),
+         INT8_C(   5),  INT8_C(   1), -INT8_C( 111), -INT8_C(  52),  INT8_C(   2),  INT8_C(   4), -INT8_C(  95),  INT8_C(   3),
+         INT8_C(  74),  INT8_C(  76),  INT8_C(   3),  INT8_C( 127), -INT8_C(  91), -INT8_C( 126),  INT8_C(   4),  INT8_C(  48),
+         INT8_C( 114),  INT8_C(  28),  INT8_C( 110), -INT8_C(  94),  INT8_C(   1), -INT8_C(  66),  INT8_C(   3), -INT8_C( 119),
+         INT8_C(  30),  INT8_C(  10), -INT8_C(  78),  INT8_C(  55),  INT8_C(   5), -INT8_C(  51),  INT8_C(   4),  INT8_C(   1),
+         INT8_C(   2),  INT8_C(   1),  INT8_C(  36),  INT8_C( 126), -INT8_C(  42),  INT8_C(  39),  INT8_C(   3),  INT8_C(   4),
+        -INT8_C( 107),  INT8_C(   3),  INT8_C(   1),  INT8_C(  26),  INT8_C(   1), -INT8_C(   2), -INT8_C(  79),  INT8_C(   2) } },
+    { { -INT8_C(  85), -INT8_C(  56), -INT8_C(  19),  INT8_C(  10), -INT8_C(  50),  INT8_C( 103), -INT8_C( 103),      INT8_MIN,
+         INT8_C(  53), -INT8_C(  91), -INT8_C(  20),  INT8_C(  43),  INT8_C(  47),  INT8_C(  59), -INT8_C(   5), -INT8_C(  34),
+        -INT8_C(  87), -INT8_C(  78), -INT8_C(  25),  INT8_C( 100), -INT8_C(  70), -INT8_C( 119), -INT8_C(  90),  INT8_C(  11),
+         INT8_C( 113), -INT8_C(  23),  INT8_C(  76),  INT8_C(   2), -INT8_C(  40), -INT8_C(  43),  INT8_C(  68),  INT8_C(  88),
+        -INT8_C(  76), -INT8_C(  77), -INT8_C(  20), -INT8_C( 123), -INT8_C(   6),  INT8_C(  17),  INT8_C(  75), -INT8_C(  73),
+        -INT8_C(  52), -INT8_C(  61), -INT8_C(  36),  INT8_C(  47), -INT8_C(  79),  INT8_C(  74),  INT8_C(  86),  INT8_C(  64),
+        -INT8_C(  80), -INT8_C(  31),  INT8_C(  56),  INT8_C(  96), -INT8_C(  94),  INT8_C(  35), -INT8_C( 107),  INT8_C(  36),
+        -INT8_C(  30), -INT8_C(  29), -INT8_C(  42),  INT8_C(  21), -INT8_C(  57),  INT8_C(  28), -INT8_C(  72), -INT8_C(  51) },
+      UINT64_C(12025496202008025433),
+      { -INT8_C( 120),  INT8_C(   9),  INT8_C(   1),  INT8_C(   4), -INT8_C(  64),  INT8_C(  93),  INT8_C(  16),  INT8_C(   1),
+         INT8_C(  24),  INT8_C(  52),  INT8_C(  20),  INT8_C(  65),  INT8_C(   0),  INT8_C(  97),  INT8_C(   0),  INT8_C(  64),
+        -INT8_C( 114),  INT8_C(  17),  INT8_C(  66), -INT8_C(  15),  INT8_C(  28),  INT8_C(  68),  INT8_C(   8),  INT8_C(   0),
+         INT8_C( 109), -INT8_C(  63),  INT8_C(   0),  INT8_C(  96),  INT8_C(  77),  INT8_C(   7),      INT8_MIN, -INT8_C( 104),
+         INT8_C(  50),      INT8_MIN,  INT8_C(  80), -INT8_C( 126),  INT8_C(  39),  INT8_C(  16),  INT8_C(  33),  INT8_C( 112),
+        -INT8_C( 120),  INT8_C(   1),  INT8_C(   0),  INT8_C(   1),  INT8_C(   2),  INT8_C(  17), -INT8_C( 112),  INT8_C(  12),
+        -INT8_C(  96),  INT8_C(  33), -INT8_C(  57),  INT8_C(   0), -INT8_C( 126), -INT8_C( 111),  INT8_C(  14),      INT8_MIN,
+         INT8_C(   0),  INT8_C(   5),      INT8_MIN,  INT8_C(  18),  INT8_C(  66), -INT8_C(  55),  INT8_C(   0),  INT8_C(  20) },
+      {  INT8_C(   2), -INT8_C(  56), -INT8_C(  19),  INT8_C(   1),  INT8_C(   2),  INT8_C( 103),  INT8_C(   1),      INT8_MIN,
+         INT8_C(   2), -INT8_C(  91), -INT8_C(  20),  INT8_C(   2),  INT8_C(   0),  INT8_C(  59),  INT8_C(   0), -INT8_C(  34),
+         INT8_C(   4),  INT8_C(   2),  INT8_C(   2),  INT8_C(   5),  INT8_C(   3),  INT8_C(   2),  INT8_C(   1),  INT8_C(  11),
+         INT8_C( 113), -INT8_C(  23),  INT8_C(  76),  INT8_C(   2),  INT8_C(   4),  INT8_C(   3),  INT8_C(   1),  INT8_C(   3),
+        -INT8_C(  76), -INT8_C(  77),  INT8_C(   2), -INT8_C( 123),  INT8_C(   4),  INT8_C(  17),  INT8_C(  75), -INT8_C(  73),
+         INT8_C(   2), -INT8_C(  61),  INT8_C(   0),  INT8_C(  47), -INT8_C(  79),  INT8_C(   2),  INT8_C(  86),  INT8_C(  64),
+         INT8_C(   2),  INT8_C(   2),  INT8_C(  56),  INT8_C(  96), -INT8_C(  94),  INT8_C(   3),  INT8_C(   3),  INT8_C(   1),
+        -INT8_C(  30),  INT8_C(   2),  INT8_C(   1),  INT8_C(  21), -INT8_C(  57),  INT8_C(   4), -INT8_C(  72),  INT8_C(   2) } },
+    { {  INT8_C(  70),  INT8_C(  10), -INT8_C(  76),  INT8_C(  93),  INT8_C(  91), -INT8_C(  79),  INT8_C(  76), -INT8_C(  98),
+         INT8_C(  83), -INT8_C(  97),  INT8_C( 118),  INT8_C(  94), -INT8_C( 118),  INT8_C(  83), -INT8_C( 117), -INT8_C( 106),
+        -INT8_C( 117),  INT8_C( 100),  INT8_C(  56),  INT8_C(  90), -INT8_C(  60),  INT8_C( 121), -INT8_C( 125),  INT8_C(  60),
+         INT8_C(  24), -INT8_C(  28),  INT8_C(  77),  INT8_C( 105),  INT8_C(  99),  INT8_C(  97), -INT8_C( 105),  INT8_C(  32),
+         INT8_C(   4), -INT8_C(  90), -INT8_C(  57),  INT8_C(  24), -INT8_C(  32), -INT8_C(  53),  INT8_C( 120),  INT8_C( 100),
+         INT8_C(  96), -INT8_C(  72),  INT8_C(  27), -INT8_C(   1), -INT8_C(  66),  INT8_C(  83),  INT8_C(   1), -INT8_C(  85),
+         INT8_C(  74),  INT8_C(  86), -INT8_C(  38),  INT8_C(  49), -INT8_C( 115),  INT8_C(   2),  INT8_C(  46),  INT8_C(  38),
+        -INT8_C( 118), -INT8_C(  19),  INT8_C( 102),  INT8_C(   6), -INT8_C(  82),  INT8_C(  15),  INT8_C(  35), -INT8_C( 113) },
+      UINT64_C( 4942010298870642935),
+      {  INT8_C(  84),  INT8_C(   0),  INT8_C(  40),  INT8_C(   0),  INT8_C(  28),  INT8_C(   3),  INT8_C(   2),  INT8_C(   3),
+         INT8_C(  70),  INT8_C(  16),      INT8_MIN, -INT8_C( 108),  INT8_C(  16),  INT8_C(   8),  INT8_C(  23),  INT8_C(  32),
+         INT8_C(  24), -INT8_C( 120), -INT8_C(  95),  INT8_C(  40),  INT8_C(   0),  INT8_C(   8),  INT8_C(   8),  INT8_C(  32),
+         INT8_C(  64), -INT8_C(  48), -INT8_C(  60),  INT8_C(   8), -INT8_C( 111),  INT8_C(  64),  INT8_C(  32),  INT8_C(  20),
+         INT8_C(  12),  INT8_C(   0),  INT8_C(   4), -INT8_C( 127),  INT8_C(  24),  INT8_C(  32),  INT8_C(  37),  INT8_C(   0),
+         INT8_C(  41),  INT8_C(  16),  INT8_C(  32), -INT8_C(  36),  INT8_C(   2), -INT8_C(  60),  INT8_C(   5), -INT8_C(  75),
+         INT8_C(  18),  INT8_C(  14),  INT8_C(  69),  INT8_C(   2),  INT8_C(   4),  INT8_C(  16),  INT8_C(  34),  INT8_C(  47),
+        -INT8_C(  95),      INT8_MIN,  INT8_C(   1),  INT8_C(   3),  INT8_C(   0),  INT8_C(  49),  INT8_C(   2),  INT8_C(  90) },
+      {  INT8_C(   3),  INT8_C(   0),  INT8_C(   2),  INT8_C(  93),  INT8_C(   3),  INT8_C(   2),  INT8_C(   1),  INT8_C(   2),
+         INT8_C(  83), -INT8_C(  97),  INT8_C( 118),  INT8_C(   3),  INT8_C(   1),  INT8_C(   1), -INT8_C( 117),  INT8_C(   1),
+         INT8_C(   2),  INT8_C( 100),  INT8_C(  56),  INT8_C(  90), -INT8_C(  60),  INT8_C( 121), -INT8_C( 125),  INT8_C(   1),
+         INT8_C(  24), -INT8_C(  28),  INT8_C(   3),  INT8_C( 105),  INT8_C(   3),  INT8_C(  97),  INT8_C(   1),  INT8_C(   2),
+         INT8_C(   4),  INT8_C(   0),  INT8_C(   1),  INT8_C(   2), -INT8_C(  32),  INT8_C(   1),  INT8_C( 120),  INT8_C( 100),
+         INT8_C(  96), -INT8_C(  72),  INT8_C(   1),  INT8_C(   5), -INT8_C(  66),  INT8_C(  83),  INT8_C(   1),  INT8_C(   5),
+         INT8_C(   2),  INT8_C(  86),  INT8_C(   3),  INT8_C(  49),  INT8_C(   1),  INT8_C(   2),  INT8_C(  46),  INT8_C(   5),
+        -INT8_C( 118), -INT8_C(  19),  INT8_C(   1),  INT8_C(   6), -INT8_C(  82),  INT8_C(  15),  INT8_C(   1), -INT8_C( 113) } },
+    { { -INT8_C( 111),  INT8_C(  64),  INT8_C( 106),  INT8_C(  42), -INT8_C(  16),  INT8_C(  15),  INT8_C(  95), -INT8_C(  97),
+        -INT8_C(  52),  INT8_C(  33),  INT8_C( 121), -INT8_C(  19),  INT8_C(  54),  INT8_C(  12), -INT8_C(  58), -INT8_C( 105),
+        -INT8_C( 118),  INT8_C( 119),  INT8_C(  29),  INT8_C(   9), -INT8_C(  39), -INT8_C(  50), -INT8_C(  25), -INT8_C(   8),
+         INT8_C(  71), -INT8_C(  33), -INT8_C(  20), -INT8_C(  13),  INT8_C( 120),  INT8_C(  22), -INT8_C(   6), -INT8_C(  31),
+        -INT8_C(  66), -INT8_C(   7), -INT8_C( 102),  INT8_C(  81),  INT8_C(  35), -INT8_C(  75),  INT8_C( 122), -INT8_C(  72),
+         INT8_C(  45), -INT8_C( 109),  INT8_C(  74),  INT8_C(  54),  INT8_C(  74), -INT8_C(  30),  INT8_C(  23), -INT8_C(  19),
+         INT8_C(  72), -INT8_C(  68),  INT8_C( 113),  INT8_C( 115),  INT8_C( 117), -INT8_C(  91), -INT8_C(  90), -INT8_C(  73),
+         INT8_C(  90),  INT8_C(  34),  INT8_C(  42), -INT8_C( 106),  INT8_C(  67),  INT8_C(  69), -INT8_C( 125),  INT8_C( 112) },
+      UINT64_C( 2764309299996119669),
+      { -INT8_C(  44), -INT8_C( 111),  INT8_C( 112),  INT8_C(  36),  INT8_C(  72),  INT8_C(  66), -INT8_C( 114), -INT8_C(  71),
+        -INT8_C( 110),  INT8_C(  89), -INT8_C(   9),  INT8_C(   8), -INT8_C(  76), -INT8_C(  87), -INT8_C(  46), -INT8_C(  21),
+         INT8_C(  84), -INT8_C( 100), -INT8_C(  57), -INT8_C(  50),  INT8_C(   9), -INT8_C(   7), -INT8_C( 108),  INT8_C(  53),
+        -INT8_C(  81),  INT8_C( 106),  INT8_C( 124),  INT8_C(  70), -INT8_C(  60),  INT8_C(  29), -INT8_C(  27), -INT8_C(  60),
+         INT8_C(  87), -INT8_C( 105),  INT8_C(  72), -INT8_C( 102), -INT8_C(  43), -INT8_C(  16),  INT8_C(  47), -INT8_C(  49),
+        -INT8_C(  14), -INT8_C(  11),  INT8_C( 104), -INT8_C( 106), -INT8_C(  97),  INT8_C(  34),  INT8_C(  74),  INT8_C(  16),
+         INT8_C(  40),  INT8_C(  98),  INT8_C(  28), -INT8_C(  24), -INT8_C(  21),  INT8_C(  10), -INT8_C(  68), -INT8_C( 125),
+        -INT8_C(  96),  INT8_C( 103), -INT8_C(  69),  INT8_C(   2),  INT8_C(  44), -INT8_C( 118), -INT8_C( 123),  INT8_C( 124) },
+      {  INT8_C(   4),  INT8_C(  64),  INT8_C(   3),  INT8_C(  42),  INT8_C(   2),  INT8_C(   2),  INT8_C(   4), -INT8_C(  97),
+        -INT8_C(  52),  INT8_C(   4),  INT8_C( 121), -INT8_C(  19),  INT8_C(   4),  INT8_C(  12),  INT8_C(   4),  INT8_C(   6),
+         INT8_C(   3),  INT8_C(   4),  INT8_C(  29),  INT8_C(   9),  INT8_C(   2), -INT8_C(  50), -INT8_C(  25),  INT8_C(   4),
+         INT8_C(   6),  INT8_C(   4), -INT8_C(  20), -INT8_C(  13),  INT8_C(   3),  INT8_C(  22), -INT8_C(   6),  INT8_C(   3),
+         INT8_C(   5), -INT8_C(   7), -INT8_C( 102),  INT8_C(   4),  INT8_C(  35),  INT8_C(   4),  INT8_C( 122),  INT8_C(   6),
+         INT8_C(  45), -INT8_C( 109),  INT8_C(   3),  INT8_C(   4),  INT8_C(  74), -INT8_C(  30),  INT8_C(   3),  INT8_C(   1),
+         INT8_C(  72), -INT8_C(  68),  INT8_C(   3),  INT8_C(   4),  INT8_C(   6), -INT8_C(  91),  INT8_C(   5), -INT8_C(  73),
+         INT8_C(  90),  INT8_C(   5),  INT8_C(   6), -INT8_C( 106),  INT8_C(  67),  INT8_C(   3), -INT8_C( 125),  INT8_C( 112) } },
+    { { -INT8_C( 118),  INT8_C(  45), -INT8_C(   5),  INT8_C(  28),  INT8_C(  86),  INT8_C( 106),  INT8_C( 100), -INT8_C(  82),
+         INT8_C(  23), -INT8_C(  41), -INT8_C( 110), -INT8_C(  71), -INT8_C(  94), -INT8_C(  41),  INT8_C(  80), -INT8_C(   4),
+         INT8_C(  77),  INT8_C(  51), -INT8_C(  83), -INT8_C(  44),  INT8_C(   9), -INT8_C(   9),  INT8_C(  18),  INT8_C( 100),
+             INT8_MIN, -INT8_C(  19),  INT8_C(  74), -INT8_C(  30), -INT8_C(  85), -INT8_C(  58),  INT8_C(  65), -INT8_C(  43),
+         INT8_C(  78),  INT8_C(  84), -INT8_C( 102),  INT8_C(  47), -INT8_C(  97),  INT8_C(  70),  INT8_C(  58), -INT8_C(   2),
+        -INT8_C(  39), -INT8_C(  42),  INT8_C(   7), -INT8_C(  43),  INT8_C(  10),  INT8_C(  70), -INT8_C(   4), -INT8_C( 101),
+        -INT8_C( 106),  INT8_C(  13),  INT8_C(  21), -INT8_C( 107),  INT8_C(   0),  INT8_C(  28),  INT8_C(  72), -INT8_C(  20),
+        -INT8_C( 111),  INT8_C(  16),  INT8_C(  40),  INT8_C( 108),  INT8_C(  40),  INT8_C(  70),  INT8_C(  88),  INT8_C(  50) },
+      UINT64_C( 3001813450036774938),
+      { -INT8_C(  56), -INT8_C(  77),      INT8_MIN, -INT8_C(  37), -INT8_C(  76),  INT8_C(  25), -INT8_C( 105), -INT8_C(  56),
+         INT8_C(  63),  INT8_C(  83), -INT8_C(  81),  INT8_C( 104),  INT8_C( 120),  INT8_C(  42),  INT8_C( 102),  INT8_C(  26),
+        -INT8_C(  70), -INT8_C(  63),  INT8_C( 112), -INT8_C( 106), -INT8_C(  89), -INT8_C(  32),  INT8_C( 127), -INT8_C(  13),
+         INT8_C( 122),  INT8_C(  82),  INT8_C(  46), -INT8_C( 106),  INT8_C(  93), -INT8_C(  67),  INT8_C(  26), -INT8_C(  16),
+        -INT8_C(  87), -INT8_C(  64),  INT8_C( 101), -INT8_C(   7),  INT8_C( 112), -INT8_C(  94),  INT8_C( 105),  INT8_C( 123),
+         INT8_C(  31),  INT8_C(  49),  INT8_C(  81), -INT8_C( 107),  INT8_C(   2), -INT8_C(  58), -INT8_C(  61),  INT8_C(  56),
+         INT8_C(  74),  INT8_C(  54), -INT8_C(  96), -INT8_C( 127),  INT8_C(  62),  INT8_C(  86), -INT8_C(  50),  INT8_C( 103),
+        -INT8_C( 123),  INT8_C( 108), -INT8_C(  12), -INT8_C(  71), -INT8_C(  70), -INT8_C(  63),  INT8_C(  16),  INT8_C(  14) },
+      { -INT8_C( 118),  INT8_C(   5), -INT8_C(   5),  INT8_C(   6),  INT8_C(   4),  INT8_C( 106),  INT8_C( 100), -INT8_C(  82),
+         INT8_C(  23), -INT8_C(  41), -INT8_C( 110),  INT8_C(   3), -INT8_C(  94), -INT8_C(  41),  INT8_C(  80),  INT8_C(   3),
+         INT8_C(  77),  INT8_C(   3),  INT8_C(   3),  INT8_C(   4),  INT8_C(   9),  INT8_C(   3),  INT8_C(   7),  INT8_C( 100),
+         INT8_C(   5),  INT8_C(   3),  INT8_C(  74), -INT8_C(  30),  INT8_C(   5),  INT8_C(   6),  INT8_C(  65),  INT8_C(   4),
+         INT8_C(   4),  INT8_C(  84),  INT8_C(   4),  INT8_C(   6), -INT8_C(  97),  INT8_C(   3),  INT8_C(   4), -INT8_C(   2),
+         INT8_C(   5), -INT8_C(  42),  INT8_C(   3), -INT8_C(  43),  INT8_C(   1),  INT8_C(  70), -INT8_C(   4),  INT8_C(   3),
+        -INT8_C( 106),  INT8_C(  13),  INT8_C(  21),  INT8_C(   2),  INT8_C(   0),  INT8_C(   4),  INT8_C(  72),  INT8_C(   5),
+         INT8_C(   3),  INT8_C(  16),  INT8_C(  40),  INT8_C(   5),  INT8_C(  40),  INT8_C(   3),  INT8_C(  88),  INT8_C(  50) } },
+    { {  INT8_C(   2),  INT8_C(  24),  INT8_C(  48), -INT8_C(  32), -INT8_C(  19),  INT8_C(  66), -INT8_C( 104),  INT8_C(  39),
+        -INT8_C(  85), -INT8_C( 126), -INT8_C(  13), -INT8_C(  44), -INT8_C(  15), -INT8_C(  58),  INT8_C(   9), -INT8_C(  29),
+        -INT8_C(  70), -INT8_C( 115), -INT8_C( 108), -INT8_C(  91),  INT8_C(  28),  INT8_C(  54),  INT8_C( 124),  INT8_C(  36),
+        -INT8_C( 104), -INT8_C( 121), -INT8_C( 124), -INT8_C( 111),  INT8_C(  16), -INT8_C( 114), -INT8_C(  51), -INT8_C( 104),
+        -INT8_C(  99),  INT8_C( 124),  INT8_C( 110), -INT8_C(  40),  INT8_C(  75),  INT8_C(  51), -INT8_C(  49),  INT8_C( 118),
+         INT8_C( 104), -INT8_C(  64), -INT8_C( 107), -INT8_C( 118),  INT8_C(  83),  INT8_C( 125), -INT8_C(  71), -INT8_C(  42),
+        -INT8_C(  55),  INT8_C(   4),  INT8_C(  92),  INT8_C(  56), -INT8_C(  88),  INT8_C(  27), -INT8_C(  65),  INT8_C( 124),
+         INT8_C(  10), -INT8_C(  60),  INT8_C(   9),  INT8_C( 117), -INT8_C( 119), -INT8_C(  52),  INT8_C(  27),  INT8_C(  73) },
+      UINT64_C( 2992719207919094548),
+      { -INT8_C(  83), -INT8_C(  16), -INT8_C(  39), -INT8_C(  10), -INT8_C(  37),  INT8_C( 122), -INT8_C(  40), -INT8_C(  57),
+         INT8_C(  36),  INT8_C( 100),  INT8_C(   0), -INT8_C(  64), -INT8_C(  59), -INT8_C(   6),  INT8_C(  71),  INT8_C(  23),
+         INT8_C(  65),  INT8_C(  23),  INT8_C( 103), -INT8_C( 123), -INT8_C(  30), -INT8_C(  87),  INT8_C(  42),  INT8_C(   2),
+        -INT8_C(  46),  INT8_C(  21),  INT8_C(  45),  INT8_C(  57),  INT8_C(  55), -INT8_C(  59),  INT8_C(  82),  INT8_C(  98),
+        -INT8_C( 112),  INT8_C(  27),  INT8_C(  69),  INT8_C( 103), -INT8_C( 127),  INT8_C(  40),  INT8_C(  62), -INT8_C(  98),
+        -INT8_C( 125), -INT8_C(  54),  INT8_C( 123),  INT8_C(  79),  INT8_C(   9), -INT8_C(  97),  INT8_C(  36), -INT8_C(  18),
+         INT8_C( 127), -INT8_C(  91), -INT8_C(  20), -INT8_C( 121),  INT8_C( 120),  INT8_C(  42),  INT8_C(   6), -INT8_C(  78),
+        -INT8_C(  13), -INT8_C(  94), -INT8_C( 123), -INT8_C(  72), -INT8_C(  65),  INT8_C(  22), -INT8_C(  46),  INT8_C(   9) },
+      {  INT8_C(   2),  INT8_C(  24),  INT8_C(   5), -INT8_C(  32),  INT8_C(   6),  INT8_C(  66), -INT8_C( 104),  INT8_C(  39),
+         INT8_C(   2),  INT8_C(   3), -INT8_C(  13),  INT8_C(   2), -INT8_C(  15), -INT8_C(  58),  INT8_C(   9),  INT8_C(   4),
+         INT8_C(   2), -INT8_C( 115), -INT8_C( 108), -INT8_C(  91),  INT8_C(  28),  INT8_C(  54),  INT8_C( 124),  INT8_C(   1),
+        -INT8_C( 104), -INT8_C( 121),  INT8_C(   4), -INT8_C( 111),  INT8_C(   5),  INT8_C(   4),  INT8_C(   3), -INT8_C( 104),
+         INT8_C(   2),  INT8_C(   4),  INT8_C( 110), -INT8_C(  40),  INT8_C(  75),  INT8_C(  51),  INT8_C(   5),  INT8_C( 118),
+         INT8_C( 104),  INT8_C(   4),  INT8_C(   6), -INT8_C( 118),  INT8_C(  83),  INT8_C( 125),  INT8_C(   2), -INT8_C(  42),
+        -INT8_C(  55),  INT8_C(   4),  INT8_C(  92),  INT8_C(   4), -INT8_C(  88),  INT8_C(  27), -INT8_C(  65),  INT8_C(   4),
+         INT8_C(   6), -INT8_C(  60),  INT8_C(   9),  INT8_C(   4), -INT8_C( 119),  INT8_C(   3),  INT8_C(  27),  INT8_C(  73) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi8(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_popcnt_epi8(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_popcnt_epi8 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask64 k;
+    const int8_t a[64];
+    const int8_t r[64];
+  } test_vec[] = {
+    {       UINT64_C( 4743125363532011489),
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } },
+    {       UINT64_C(10095692666772380149),
+      { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+        -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+      {  INT8_C(   8),  INT8_C(   0),  INT8_C(   8),  INT8_C(   0),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),
+         INT8_C(   8),  INT8_C(   0),  INT8_C(   0),  INT8_C(   8),  INT8_C(   8),  INT8_C(   0),  INT8_C(   8),  INT8_C(   8),
+         INT8_C(   8),  INT8_C(   8),  INT8_C(   0),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   0),  INT8_C(   8),
+         INT8_C(   8),  INT8_C(   0),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),  INT8_C(   8),
+         INT8_C(   0),  INT8_C(   8),  INT8_C(   0),  INT8_C(   8),  INT8_C(   8),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   8),  INT8_C(   8),  INT8_C(   0),  INT8_C(   8),  INT8_C(   8),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   8),  INT8_C(   8),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   8) } },
+    {       UINT64_C(15351983441375992756),
+      {  INT8_C(  32), -INT8_C( 120),  INT8_C(   0),      INT8_MIN,  INT8_C(   5),  INT8_C(  85),  INT8_C(   5),  INT8_C(  50),
+        -INT8_C(  16),  INT8_C(  49), -INT8_C( 111),  INT8_C(   4), -INT8_C( 120),  INT8_C(  32),  INT8_C(  34),  INT8_C(  64),
+         INT8_C(  44),  INT8_C(  12),  INT8_C(   0),  INT8_C(  32),      INT8_MIN,  INT8_C(  21),  INT8_C(  24),  INT8_C(  19),
+         INT8_C(   8), -INT8_C( 127),  INT8_C(   0),  INT8_C(  24),  INT8_C(  64),  INT8_C(   8),  INT8_C(  16),  INT8_C(   0),
+        -INT8_C( 112),      INT8_MIN,  INT8_C(   2),  INT8_C(  24),  INT8_C(  68),  INT8_C(  32),  INT8_C(   4), -INT8_C( 120),
+         INT8_C(  32),  INT8_C(  33),  INT8_C(  60),  INT8_C(   9),  INT8_C(  36),  INT8_C(  89),  INT8_C(  16), -INT8_C(  96),
+        -INT8_C( 116), -INT8_C(  96), -INT8_C( 106), -INT8_C(  96),  INT8_C(   8),  INT8_C(  26),  INT8_C(  32),  INT8_C(  41),
+         INT8_C(   0), -INT8_C( 116),  INT8_C(  64),  INT8_C(  34),  INT8_C(  72),  INT8_C(   8),  INT8_C(  17), -INT8_C(  55) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   2),  INT8_C(   4),  INT8_C(   0),  INT8_C(   3),
+         INT8_C(   4),  INT8_C(   3),  INT8_C(   0),  INT8_C(   1),  INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   3),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3),  INT8_C(   2),  INT8_C(   3),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   2),  INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   2),
+         INT8_C(   1),  INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   2),  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   3),  INT8_C(   0),  INT8_C(   4),  INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   2),  INT8_C(   0),  INT8_C(   2),  INT8_C(   4) } },
+    {       UINT64_C( 6732110729322635196),
+      {  INT8_C(   4), -INT8_C(  64),  INT8_C(  65), -INT8_C(  92),  INT8_C(   2), -INT8_C(  83),  INT8_C(  64), -INT8_C(  64),
+         INT8_C(   0),  INT8_C(   4),  INT8_C(  32),  INT8_C(   0),  INT8_C(   8),  INT8_C( 108),  INT8_C(  16), -INT8_C( 104),
+         INT8_C(   0),  INT8_C(  37),  INT8_C(   1), -INT8_C(  93),  INT8_C(   4),      INT8_MIN,  INT8_C(   9),  INT8_C(  89),
+         INT8_C(  23),  INT8_C(  73), -INT8_C( 103),  INT8_C(  96),  INT8_C(  16), -INT8_C( 107),  INT8_C(  32),  INT8_C(  78),
+        -INT8_C( 127),  INT8_C(  20), -INT8_C( 112),  INT8_C(  50),  INT8_C(  48),  INT8_C(  17),  INT8_C(  83),  INT8_C( 100),
+         INT8_C(  73), -INT8_C(  76),  INT8_C(  86),  INT8_C(   3),  INT8_C(  48),  INT8_C(   4),  INT8_C(   0), -INT8_C( 119),
+        -INT8_C(  64), -INT8_C(  39),  INT8_C(  40), -INT8_C(  46),  INT8_C(  80), -INT8_C( 106),  INT8_C(   1),  INT8_C( 112),
+         INT8_C(  11),  INT8_C(   6), -INT8_C( 119),  INT8_C(  34),  INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   2),  INT8_C(   3),  INT8_C(   1),  INT8_C(   5),  INT8_C(   0),  INT8_C(   2),
+         INT8_C(   0),  INT8_C(   1),  INT8_C(   1),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   3),  INT8_C(   1),  INT8_C(   4),  INT8_C(   1),  INT8_C(   0),  INT8_C(   2),  INT8_C(   4),
+         INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   2),  INT8_C(   0),  INT8_C(   3),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   3),  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   2),  INT8_C(   0),  INT8_C(   2),  INT8_C(   4),  INT8_C(   0),  INT8_C(   4),  INT8_C(   1),  INT8_C(   0),
+         INT8_C(   3),  INT8_C(   0),  INT8_C(   3),  INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0) } },
+    {       UINT64_C( 9398482603106007399),
+      {  INT8_C(  38),  INT8_C(  53),  INT8_C(  96),  INT8_C(   2),  INT8_C(  18),  INT8_C(  32),  INT8_C(   0), -INT8_C( 123),
+             INT8_MIN,  INT8_C(  13),  INT8_C(   6),  INT8_C( 105),  INT8_C(   8),  INT8_C(  49),  INT8_C(  64),  INT8_C(  64),
+         INT8_C(  18),  INT8_C(  19),  INT8_C(  35), -INT8_C(  63),  INT8_C(   0),  INT8_C(  64),  INT8_C(  26),  INT8_C(  64),
+         INT8_C(   3),  INT8_C(  10),  INT8_C(  66), -INT8_C( 104),  INT8_C(  10),  INT8_C(   0),  INT8_C(  21),  INT8_C(  64),
+         INT8_C(  66),  INT8_C(  17),  INT8_C(  21),  INT8_C(  33),  INT8_C(   4),  INT8_C(  98),  INT8_C(  47),  INT8_C(   0),
+         INT8_C(   5), -INT8_C(  64),  INT8_C(  80),  INT8_C(  36), -INT8_C(  88), -INT8_C(  26),  INT8_C(  10),      INT8_MIN,
+         INT8_C(   5),  INT8_C(  17), -INT8_C( 126),  INT8_C(   8),  INT8_C(  81),  INT8_C(  72),  INT8_C(  16),  INT8_C(   2),
+        -INT8_C(  64),  INT8_C(  64),  INT8_C(   4),  INT8_C(   0),  INT8_C(  24), -INT8_C(  87),  INT8_C(   6),  INT8_C(   2) },
+      {  INT8_C(   3),  INT8_C(   4),  INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(   1),  INT8_C(   3),  INT8_C(   1),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   3),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3),  INT8_C(   1),
+         INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3),  INT8_C(   2),  INT8_C(   0),  INT8_C(   3),  INT8_C(   1),
+         INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   2),  INT8_C(   2),  INT8_C(   2),  INT8_C(   3),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   2),  INT8_C(   2),  INT8_C(   1),  INT8_C(   0),  INT8_C(   2),  INT8_C(   1),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   1) } },
+    {       UINT64_C( 6270416930952945684),
+      {  INT8_C(  30), -INT8_C(  22),  INT8_C(  69),  INT8_C(  35), -INT8_C( 121), -INT8_C(  42),  INT8_C( 127),  INT8_C(  35),
+        -INT8_C(   1),  INT8_C(  52), -INT8_C(  28), -INT8_C(  87), -INT8_C(  78),  INT8_C(  73),  INT8_C(  19),  INT8_C(  13),
+        -INT8_C(  31),  INT8_C(  60),  INT8_C( 114),  INT8_C(  58), -INT8_C(  22),  INT8_C( 117),  INT8_C( 121), -INT8_C(  73),
+        -INT8_C(  18), -INT8_C(  73), -INT8_C(  28), -INT8_C(   1),  INT8_C(  68),  INT8_C(  26),  INT8_C(  14),  INT8_C(  20),
+        -INT8_C(  52), -INT8_C(  43),  INT8_C( 104), -INT8_C( 116),  INT8_C(  97),  INT8_C(  63), -INT8_C(  59),  INT8_C(  46),
+         INT8_C( 122), -INT8_C(  42),  INT8_C(  47), -INT8_C( 117),  INT8_C(  62), -INT8_C(  28), -INT8_C(  85),  INT8_C(  42),
+        -INT8_C(  54),  INT8_C(  29),  INT8_C(  83),  INT8_C( 107),  INT8_C(  19), -INT8_C( 109), -INT8_C(  32), -INT8_C( 125),
+         INT8_C(  44), -INT8_C(  18),  INT8_C(  55),  INT8_C(  11),  INT8_C( 107),  INT8_C(  85), -INT8_C( 105), -INT8_C( 126) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   3),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3),  INT8_C(   0),  INT8_C(   3),
+         INT8_C(   4),  INT8_C(   4),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   6),  INT8_C(   6),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   5),  INT8_C(   0),  INT8_C(   3),  INT8_C(   3),  INT8_C(   6),  INT8_C(   4),  INT8_C(   4),
+         INT8_C(   0),  INT8_C(   5),  INT8_C(   5),  INT8_C(   4),  INT8_C(   5),  INT8_C(   4),  INT8_C(   5),  INT8_C(   3),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   3),  INT8_C(   6),  INT8_C(   5),  INT8_C(   0),  INT8_C(   5),  INT8_C(   0),  INT8_C(   5),  INT8_C(   0) } },
+    {       UINT64_C( 7660987831983441353),
+      {  INT8_C( 117),  INT8_C( 113),  INT8_C( 101),  INT8_C(  63), -INT8_C(  95), -INT8_C(  44), -INT8_C( 109), -INT8_C(  90),
+         INT8_C(   5),  INT8_C(  99),  INT8_C(   5), -INT8_C(  57),  INT8_C(  92), -INT8_C(  54),  INT8_C( 121),  INT8_C(  49),
+         INT8_C(  93),  INT8_C(  87),  INT8_C(  15),  INT8_C( 115),  INT8_C( 119),  INT8_C(  61), -INT8_C(   3), -INT8_C(  74),
+         INT8_C( 119),  INT8_C( 125), -INT8_C(  31), -INT8_C( 124), -INT8_C( 123),  INT8_C(  44), -INT8_C(  48), -INT8_C(  15),
+        -INT8_C( 106),  INT8_C( 107),  INT8_C( 101), -INT8_C( 123),  INT8_C(  80), -INT8_C(  90), -INT8_C( 105),  INT8_C( 118),
+         INT8_C(  66),  INT8_C(  58),  INT8_C(  78), -INT8_C(  50), -INT8_C(  25),  INT8_C(   0), -INT8_C(  58),  INT8_C(  89),
+        -INT8_C(   9),  INT8_C(  76), -INT8_C(  70), -INT8_C( 109),  INT8_C(  24),  INT8_C(  94),  INT8_C(  10), -INT8_C(  52),
+        -INT8_C(  15), -INT8_C( 126), -INT8_C( 113), -INT8_C( 110),  INT8_C( 107),  INT8_C( 101), -INT8_C(  51),  INT8_C(  98) },
+      {  INT8_C(   5),  INT8_C(   0),  INT8_C(   0),  INT8_C(   6),  INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(   4),
+         INT8_C(   2),  INT8_C(   0),  INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3),
+         INT8_C(   0),  INT8_C(   5),  INT8_C(   4),  INT8_C(   0),  INT8_C(   6),  INT8_C(   5),  INT8_C(   7),  INT8_C(   5),
+         INT8_C(   6),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   3),  INT8_C(   3),  INT8_C(   3),  INT8_C(   5),
+         INT8_C(   4),  INT8_C(   5),  INT8_C(   4),  INT8_C(   0),  INT8_C(   2),  INT8_C(   0),  INT8_C(   5),  INT8_C(   5),
+         INT8_C(   2),  INT8_C(   4),  INT8_C(   0),  INT8_C(   5),  INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0),
+         INT8_C(   7),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   2),  INT8_C(   0),  INT8_C(   2),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   2),  INT8_C(   0),  INT8_C(   3),  INT8_C(   0),  INT8_C(   4),  INT8_C(   5),  INT8_C(   0) } },
+    {       UINT64_C(17295193689482128644),
+      {  INT8_C(  22), -INT8_C(  48), -INT8_C( 113),  INT8_C( 112), -INT8_C(  10), -INT8_C(  43),  INT8_C(  52), -INT8_C(  96),
+        -INT8_C(  77),  INT8_C(  70),  INT8_C( 116),  INT8_C( 108),  INT8_C( 124), -INT8_C(  94),  INT8_C(  53), -INT8_C(  55),
+        -INT8_C(  14),  INT8_C(  67), -INT8_C(  19), -INT8_C(  10),  INT8_C(  57),  INT8_C(  77),  INT8_C(  63), -INT8_C(  11),
+        -INT8_C(  48),  INT8_C(   7), -INT8_C(  81), -INT8_C(  52), -INT8_C(  33), -INT8_C(  32), -INT8_C(   3),  INT8_C(  70),
+         INT8_C( 126),  INT8_C(  18),      INT8_MIN, -INT8_C(   9),  INT8_C(  90), -INT8_C(  24),  INT8_C(  87),  INT8_C(  13),
+         INT8_C( 117), -INT8_C(  37), -INT8_C(  60), -INT8_C( 101), -INT8_C( 100), -INT8_C(   3), -INT8_C(  22),  INT8_C(  27),
+        -INT8_C(   5), -INT8_C(  74),  INT8_C(  45), -INT8_C(  15),  INT8_C(  76), -INT8_C( 122),  INT8_C(  43), -INT8_C(  45),
+         INT8_C(  84),  INT8_C(  26),  INT8_C(  46), -INT8_C(  44), -INT8_C(  61), -INT8_C(   8),  INT8_C(  75), -INT8_C(  99) },
+      {  INT8_C(   0),  INT8_C(   0),  INT8_C(   5),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   5),  INT8_C(   0),  INT8_C(   4),  INT8_C(   4),  INT8_C(   0),  INT8_C(   3),  INT8_C(   4),  INT8_C(   4),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   6),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   3),  INT8_C(   3),  INT8_C(   6),  INT8_C(   0),  INT8_C(   7),  INT8_C(   0),  INT8_C(   7),  INT8_C(   3),
+         INT8_C(   0),  INT8_C(   2),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   5),  INT8_C(   6),  INT8_C(   3),  INT8_C(   5),  INT8_C(   4),  INT8_C(   0),  INT8_C(   5),  INT8_C(   4),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+         INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   4),  INT8_C(   5),  INT8_C(   4),  INT8_C(   5) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi8(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_popcnt_epi8(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i8x64(r, simde_mm512_loadu_epi8(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_popcnt_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t a[32];
+    const int16_t r[32];
+  } test_vec[] = {
+    { {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { { -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+        -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+        -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+        -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1) },
+      {  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),
+         INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),
+         INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),
+         INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16) } },
+    { {  INT16_C(  1554),  INT16_C(   520),  INT16_C(  4179),  INT16_C(   132),  INT16_C(   544),  INT16_C(  3328),  INT16_C(  1376),  INT16_C(  8224),
+         INT16_C(    16),  INT16_C(   300),  INT16_C(  1029), -INT16_C( 16187),  INT16_C(  8201), -INT16_C( 26477),  INT16_C(    71), -INT16_C( 31487),
+        -INT16_C( 29632),  INT16_C(   772), -INT16_C( 28123), -INT16_C(  4570), -INT16_C(  7968),  INT16_C(     8),  INT16_C( 11264), -INT16_C(  4085),
+         INT16_C( 12554), -INT16_C( 10624),  INT16_C(  8708),  INT16_C( 16480),  INT16_C(  1428),  INT16_C( 24912),  INT16_C(   778), -INT16_C( 31743) },
+      {  INT16_C(     4),  INT16_C(     2),  INT16_C(     5),  INT16_C(     2),  INT16_C(     2),  INT16_C(     3),  INT16_C(     4),  INT16_C(     2),
+         INT16_C(     1),  INT16_C(     4),  INT16_C(     3),  INT16_C(     6),  INT16_C(     3),  INT16_C(     7),  INT16_C(     4),  INT16_C(     4),
+         INT16_C(     4),  INT16_C(     3),  INT16_C(     6),  INT16_C(     9),  INT16_C(     6),  INT16_C(     1),  INT16_C(     3),  INT16_C(     7),
+         INT16_C(     5),  INT16_C(     6),  INT16_C(     3),  INT16_C(     3),  INT16_C(     5),  INT16_C(     5),  INT16_C(     4),  INT16_C(     3) } },
+    { {  INT16_C( 16704),  INT16_C(  7267),  INT16_C( 17410),  INT16_C(  8584),  INT16_C( 16417), -INT16_C( 28415),  INT16_C(   448), -INT16_C(  8152),
+        -INT16_C(  3515), -INT16_C( 32512),  INT16_C(   592),  INT16_C( 16400), -INT16_C( 15216),  INT16_C(   140), -INT16_C( 15360),  INT16_C(  8962),
+        -INT16_C( 15643),  INT16_C(  8225),  INT16_C(  2054),  INT16_C(    18),  INT16_C( 24656),  INT16_C( 20608),  INT16_C( 16559),  INT16_C(   770),
+         INT16_C(    89),  INT16_C(  1072),  INT16_C(  2048),  INT16_C( 16737), -INT16_C(  9968),  INT16_C( 22928),  INT16_C( 10257), -INT16_C( 12283) },
+      {  INT16_C(     3),  INT16_C(     7),  INT16_C(     3),  INT16_C(     4),  INT16_C(     3),  INT16_C(     4),  INT16_C(     3),  INT16_C(     5),
+         INT16_C(     8),  INT16_C(     2),  INT16_C(     3),  INT16_C(     2),  INT16_C(     5),  INT16_C(     3),  INT16_C(     3),  INT16_C(     4),
+         INT16_C(     8),  INT16_C(     3),  INT16_C(     3),  INT16_C(     2),  INT16_C(     4),  INT16_C(     3),  INT16_C(     7),  INT16_C(     3),
+         INT16_C(     4),  INT16_C(     3),  INT16_C(     1),  INT16_C(     5),  INT16_C(     6),  INT16_C(     6),  INT16_C(     4),  INT16_C(     5) } },
+    { { -INT16_C( 30590), -INT16_C( 28538),  INT16_C(  1896),  INT16_C(  1281), -INT16_C( 14016),  INT16_C(   416), -INT16_C( 23396),  INT16_C( 15380),
+         INT16_C(     3),  INT16_C( 13637),  INT16_C(  3074),  INT16_C(  1310), -INT16_C( 15612), -INT16_C( 20040),  INT16_C(     8), -INT16_C( 30975),
+         INT16_C(  4152),  INT16_C(  6210),  INT16_C(  9049),  INT16_C( 20620),  INT16_C(   131),  INT16_C(    32),  INT16_C( 18160),  INT16_C(  6977),
+         INT16_C(   257),  INT16_C(   115),  INT16_C(   131), -INT16_C( 32748),  INT16_C(  3345),  INT16_C(  5809),  INT16_C(     0),  INT16_C(  2532) },
+      {  INT16_C(     4),  INT16_C(     5),  INT16_C(     6),  INT16_C(     3),  INT16_C(     5),  INT16_C(     3),  INT16_C(     7),  INT16_C(     6),
+         INT16_C(     2),  INT16_C(     7),  INT16_C(     3),  INT16_C(     6),  INT16_C(     5),  INT16_C(     8),  INT16_C(     1),  INT16_C(     5),
+         INT16_C(     4),  INT16_C(     4),  INT16_C(     7),  INT16_C(     5),  INT16_C(     3),  INT16_C(     1),  INT16_C(     7),  INT16_C(     6),
+         INT16_C(     2),  INT16_C(     5),  INT16_C(     3),  INT16_C(     3),  INT16_C(     5),  INT16_C(     7),  INT16_C(     0),  INT16_C(     6) } },
+    { { -INT16_C( 19942), -INT16_C( 26885), -INT16_C(  2341),  INT16_C(  1311),  INT16_C( 19227), -INT16_C(   705), -INT16_C(  6736), -INT16_C(  1086),
+         INT16_C(  4734),  INT16_C( 26160), -INT16_C( 10782), -INT16_C(  8144),  INT16_C( 31013), -INT16_C( 25371), -INT16_C( 21333),  INT16_C( 19305),
+         INT16_C(   213), -INT16_C( 17840), -INT16_C( 25925), -INT16_C( 24291),  INT16_C( 17494), -INT16_C( 18898), -INT16_C(  5873), -INT16_C( 25674),
+         INT16_C( 16288),  INT16_C( 12501),  INT16_C(  7728),  INT16_C(  5106),  INT16_C( 12145), -INT16_C( 17039), -INT16_C(   932),  INT16_C( 21791) },
+      {  INT16_C(     7),  INT16_C(    11),  INT16_C(    12),  INT16_C(     7),  INT16_C(     8),  INT16_C(    13),  INT16_C(     8),  INT16_C(    10),
+         INT16_C(     8),  INT16_C(     6),  INT16_C(     9),  INT16_C(     5),  INT16_C(     8),  INT16_C(     9),  INT16_C(     9),  INT16_C(     8),
+         INT16_C(     5),  INT16_C(     7),  INT16_C(    10),  INT16_C(     7),  INT16_C(     6),  INT16_C(     9),  INT16_C(     9),  INT16_C(    10),
+         INT16_C(     8),  INT16_C(     7),  INT16_C(     6),  INT16_C(     8),  INT16_C(     9),  INT16_C(    10),  INT16_C(    10),  INT16_C(     9) } },
+    { {  INT16_C( 23897), -INT16_C(  1821),  INT16_C( 19129), -INT16_C( 20020),  INT16_C( 22134),  INT16_C( 30642), -INT16_C( 28825),  INT16_C(  2034),
+         INT16_C( 18625),  INT16_C( 29748),  INT16_C(  9196),  INT16_C(  1823),  INT16_C( 29905),  INT16_C( 31116), -INT16_C( 30407),  INT16_C( 25618),
+        -INT16_C( 31668), -INT16_C( 15149),  INT16_C(   673), -INT16_C( 18482), -INT16_C( 31310), -INT16_C( 30594),  INT16_C( 31945), -INT16_C( 15964),
+        -INT16_C( 28716),  INT16_C( 25688), -INT16_C( 25654),  INT16_C( 15246),  INT16_C(  3965), -INT16_C( 18807),  INT16_C( 22265),  INT16_C( 30156) },
+      {  INT16_C(     9),  INT16_C(    10),  INT16_C(     8),  INT16_C(     8),  INT16_C(     9),  INT16_C(    10),  INT16_C(    10),  INT16_C(     8),
+         INT16_C(     5),  INT16_C(     7),  INT16_C(     8),  INT16_C(     8),  INT16_C(     8),  INT16_C(     8),  INT16_C(     7),  INT16_C(     5),
+         INT16_C(     5),  INT16_C(     8),  INT16_C(     4),  INT16_C(    11),  INT16_C(     7),  INT16_C(     8),  INT16_C(     9),  INT16_C(     6),
+         INT16_C(     9),  INT16_C(     6),  INT16_C(     9),  INT16_C(     9),  INT16_C(    10),  INT16_C(     8),  INT16_C(    10),  INT16_C(     9) } },
+    { { -INT16_C(  3857),  INT16_C( 16757),  INT16_C( 21809),  INT16_C( 22711),  INT16_C( 24622),  INT16_C(  1014),  INT16_C( 22905), -INT16_C( 18119),
+        -INT16_C(  1026), -INT16_C( 21106), -INT16_C(  8662), -INT16_C(  1231), -INT16_C(  1468),  INT16_C( 20615),  INT16_C( 26096), -INT16_C(  3823),
+        -INT16_C( 10336), -INT16_C( 21924), -INT16_C( 26293),  INT16_C( 28736), -INT16_C( 17974),  INT16_C(  7706),  INT16_C( 20868),  INT16_C( 31059),
+         INT16_C(  4779), -INT16_C( 21992), -INT16_C( 14479),  INT16_C(  5050),  INT16_C( 25433),  INT16_C(  2279),  INT16_C(  5626),  INT16_C( 17623) },
+      {  INT16_C(    11),  INT16_C(     7),  INT16_C(     7),  INT16_C(     9),  INT16_C(     6),  INT16_C(     8),  INT16_C(     9),  INT16_C(     9),
+         INT16_C(    14),  INT16_C(     9),  INT16_C(     9),  INT16_C(    10),  INT16_C(     8),  INT16_C(     6),  INT16_C(     8),  INT16_C(     7),
+         INT16_C(     8),  INT16_C(     8),  INT16_C(     8),  INT16_C(     4),  INT16_C(     9),  INT16_C(     7),  INT16_C(     5),  INT16_C(     9),
+         INT16_C(     7),  INT16_C(     6),  INT16_C(     9),  INT16_C(     8),  INT16_C(     8),  INT16_C(     7),  INT16_C(     9),  INT16_C(     8) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i r = simde_mm512_popcnt_epi16(a);
+    simde_test_x86_assert_equal_i16x32(r, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_popcnt_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[32];
+    const simde__mmask32 k;
+    const int16_t a[32];
+    const int16_t r[32];
+  } test_vec[] = {
+    { {  INT16_C( 25634), -INT16_C( 12348),  INT16_C( 21894),  INT16_C( 26935),  INT16_C( 19733),  INT16_C(  7543),  INT16_C( 14191), -INT16_C( 32115),
+         INT16_C(  2413),  INT16_C(  5811), -INT16_C( 12862),  INT16_C( 27254), -INT16_C( 17520),  INT16_C(  4550),  INT16_C(  1337),  INT16_C( 25783),
+         INT16_C(  8118),  INT16_C( 16761), -INT16_C( 25815),  INT16_C( 19566),  INT16_C(  2534),  INT16_C( 28291),  INT16_C( 30140),  INT16_C( 24951),
+         INT16_C(  2713),  INT16_C( 22568),  INT16_C( 14322), -INT16_C( 23793),  INT16_C( 26114),  INT16_C( 12252), -INT16_C(  3275),  INT16_C( 16856) },
+      UINT32_C(1300675412),
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C( 25634), -INT16_C( 12348),  INT16_C(     0),  INT16_C( 26935),  INT16_C(     0),  INT16_C(  7543),  INT16_C(     0), -INT16_C( 32115),
+         INT16_C(     0),  INT16_C(     0), -INT16_C( 12862),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  1337),  INT16_C(     0),
+         INT16_C(  8118),  INT16_C(     0),  INT16_C(     0),  INT16_C( 19566),  INT16_C(  2534),  INT16_C( 28291),  INT16_C( 30140),  INT16_C(     0),
+         INT16_C(     0),  INT16_C( 22568),  INT16_C(     0),  INT16_C(     0),  INT16_C( 26114),  INT16_C( 12252),  INT16_C(     0),  INT16_C( 16856) } },
+    { {  INT16_C( 22476),  INT16_C( 28401),  INT16_C( 19440),  INT16_C( 15129),  INT16_C( 25865), -INT16_C( 16255),  INT16_C(  7903),  INT16_C( 23644),
+        -INT16_C( 18916), -INT16_C(  6339),  INT16_C(  4648),  INT16_C( 14886),  INT16_C( 12190), -INT16_C( 23845), -INT16_C(  2933), -INT16_C( 17661),
+        -INT16_C(  9128), -INT16_C(  3837),  INT16_C( 10140),  INT16_C( 21791), -INT16_C(  4417), -INT16_C(  7939), -INT16_C( 13665),  INT16_C( 16617),
+         INT16_C(  9276), -INT16_C( 12740),  INT16_C( 17117),  INT16_C( 28696),  INT16_C(  1082), -INT16_C( 32756),  INT16_C( 26941),  INT16_C(  9437) },
+      UINT32_C(2128278056),
+      { -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+        -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+        -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+        -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1) },
+      {  INT16_C( 22476),  INT16_C( 28401),  INT16_C( 19440),  INT16_C(    16),  INT16_C( 25865),  INT16_C(    16),  INT16_C(  7903),  INT16_C( 23644),
+        -INT16_C( 18916),  INT16_C(    16),  INT16_C(  4648),  INT16_C( 14886),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),
+        -INT16_C(  9128),  INT16_C(    16),  INT16_C( 10140),  INT16_C(    16),  INT16_C(    16), -INT16_C(  7939),  INT16_C(    16),  INT16_C(    16),
+         INT16_C(  9276),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(  9437) } },
+    { { -INT16_C( 11192), -INT16_C( 27927), -INT16_C( 16689), -INT16_C( 12615),  INT16_C( 27415),  INT16_C( 10581), -INT16_C(  3801),  INT16_C( 24060),
+         INT16_C(  1855), -INT16_C( 10099),  INT16_C(  8571), -INT16_C( 24959),  INT16_C( 23861), -INT16_C(  8525), -INT16_C( 32553),  INT16_C(  3855),
+         INT16_C(  9865), -INT16_C( 28730),  INT16_C( 17022), -INT16_C( 27092), -INT16_C( 24339), -INT16_C( 23365), -INT16_C( 21753), -INT16_C( 11704),
+         INT16_C( 23281),  INT16_C( 12290), -INT16_C( 14392), -INT16_C( 14408),  INT16_C(  8590), -INT16_C( 24377), -INT16_C(  9557),  INT16_C( 15727) },
+      UINT32_C(2904690792),
+      {  INT16_C( 11276),  INT16_C( 22560),  INT16_C(    24),  INT16_C( 10272),  INT16_C(  9040),  INT16_C(  8298), -INT16_C( 30718),  INT16_C(  8257),
+         INT16_C( 31762), -INT16_C( 32734),  INT16_C( 27776), -INT16_C( 32480),  INT16_C(  2632),  INT16_C(   267),  INT16_C( 19744),  INT16_C( 22690),
+        -INT16_C( 29660),  INT16_C( 28930),  INT16_C(  1024),  INT16_C( 28760),  INT16_C( 31746),  INT16_C(  1036), -INT16_C( 16380),  INT16_C( 12580),
+         INT16_C(     1),  INT16_C(  8258),  INT16_C(  2308), -INT16_C( 16360),  INT16_C(     8),  INT16_C( 19008), -INT16_C( 24564),  INT16_C(  8712) },
+      { -INT16_C( 11192), -INT16_C( 27927), -INT16_C( 16689),  INT16_C(     3),  INT16_C( 27415),  INT16_C(     5),  INT16_C(     3),  INT16_C( 24060),
+         INT16_C(  1855), -INT16_C( 10099),  INT16_C(  8571), -INT16_C( 24959),  INT16_C(     4), -INT16_C(  8525), -INT16_C( 32553),  INT16_C(  3855),
+         INT16_C(  9865),  INT16_C(     5),  INT16_C( 17022), -INT16_C( 27092), -INT16_C( 24339),  INT16_C(     3), -INT16_C( 21753), -INT16_C( 11704),
+         INT16_C(     1),  INT16_C( 12290),  INT16_C(     3),  INT16_C(     4),  INT16_C(  8590),  INT16_C(     4), -INT16_C(  9557),  INT16_C(     3) } },
+    { {  INT16_C( 27999),  INT16_C( 26887), -INT16_C( 11421), -INT16_C( 24542), -INT16_C( 22215), -INT16_C(  5592),  INT16_C( 13459),  INT16_C( 31294),
+        -INT16_C( 22488),  INT16_C( 27429), -INT16_C( 11929), -INT16_C( 26516),  INT16_C(  4233),  INT16_C( 10848), -INT16_C( 11844), -INT16_C( 23050),
+         INT16_C( 17966), -INT16_C( 28208),  INT16_C( 23064), -INT16_C( 29060),  INT16_C(  2921),  INT16_C( 14709),  INT16_C(  7311),  INT16_C(  1100),
+         INT16_C( 30094), -INT16_C( 21647), -INT16_C( 16794),  INT16_C(  7309), -INT16_C( 13700),  INT16_C(  6963),  INT16_C(   889), -INT16_C( 10011) },
+      UINT32_C(3325328296),
+      {  INT16_C(  2752),  INT16_C(   400),  INT16_C(  4736),  INT16_C(  2434),  INT16_C( 16580),  INT16_C(     0),  INT16_C(  2176),  INT16_C( 16385),
+         INT16_C( 21736),  INT16_C(  1069), -INT16_C( 16367),  INT16_C(   358),  INT16_C(  4131),  INT16_C(  4401),  INT16_C( 13440),  INT16_C( 13320),
+         INT16_C(   516), -INT16_C( 24444),  INT16_C(  7342), -INT16_C( 10878),  INT16_C(  2432),  INT16_C(  4292),  INT16_C(  1032),  INT16_C(  8744),
+         INT16_C(   256), -INT16_C( 21435),  INT16_C(   144),  INT16_C(  2564),  INT16_C(    17),  INT16_C( 18496),  INT16_C( 16456),  INT16_C(  2256) },
+      {  INT16_C( 27999),  INT16_C( 26887), -INT16_C( 11421),  INT16_C(     4), -INT16_C( 22215),  INT16_C(     0),  INT16_C( 13459),  INT16_C(     2),
+         INT16_C(     7),  INT16_C(     5), -INT16_C( 11929),  INT16_C(     5),  INT16_C(     4),  INT16_C(     5),  INT16_C(     4), -INT16_C( 23050),
+         INT16_C( 17966), -INT16_C( 28208),  INT16_C(     8), -INT16_C( 29060),  INT16_C(     3),  INT16_C(     4),  INT16_C(  7311),  INT16_C(  1100),
+         INT16_C( 30094),  INT16_C(     7),  INT16_C(     2),  INT16_C(  7309), -INT16_C( 13700),  INT16_C(  6963),  INT16_C(     3),  INT16_C(     4) } },
+    { {  INT16_C( 27704), -INT16_C( 17014), -INT16_C(  1602), -INT16_C( 25596), -INT16_C(  2203),  INT16_C( 10270), -INT16_C( 18474), -INT16_C( 23468),
+         INT16_C( 12615),  INT16_C( 26967), -INT16_C( 22239),  INT16_C( 27180), -INT16_C( 13392),  INT16_C( 22454), -INT16_C( 17121),  INT16_C(  4518),
+        -INT16_C( 32105), -INT16_C(  3855), -INT16_C(  9353), -INT16_C( 32370), -INT16_C( 28686),  INT16_C(  6714),  INT16_C( 29698), -INT16_C( 27740),
+         INT16_C( 27038), -INT16_C(  9879),  INT16_C( 28784), -INT16_C( 10308), -INT16_C( 10156),  INT16_C(  7523), -INT16_C( 15661), -INT16_C(  4943) },
+      UINT32_C(1088230416),
+      {  INT16_C(   641),        INT16_MIN,  INT16_C( 10809),  INT16_C(   179),  INT16_C(   160),  INT16_C( 22530),  INT16_C( 24864),  INT16_C( 16927),
+         INT16_C( 17944),  INT16_C( 20544),  INT16_C(  2048),  INT16_C(     0),  INT16_C(  9760), -INT16_C( 24560),  INT16_C( 14337),  INT16_C( 18704),
+         INT16_C( 16386),  INT16_C( 25680),  INT16_C(  3156),  INT16_C(   132),  INT16_C(  5393),  INT16_C( 16705),  INT16_C(  4292),  INT16_C( 18432),
+        -INT16_C( 16384),  INT16_C(  1157),  INT16_C(  9352), -INT16_C( 30464),  INT16_C( 23568), -INT16_C( 28224),  INT16_C( 16386), -INT16_C( 32736) },
+      {  INT16_C( 27704), -INT16_C( 17014), -INT16_C(  1602), -INT16_C( 25596),  INT16_C(     2),  INT16_C( 10270), -INT16_C( 18474), -INT16_C( 23468),
+         INT16_C( 12615),  INT16_C( 26967),  INT16_C(     1),  INT16_C( 27180),  INT16_C(     4),  INT16_C( 22454), -INT16_C( 17121),  INT16_C(  4518),
+         INT16_C(     2), -INT16_C(  3855),  INT16_C(     5),  INT16_C(     2),  INT16_C(     5),  INT16_C(  6714),  INT16_C(     4),  INT16_C(     2),
+         INT16_C( 27038), -INT16_C(  9879),  INT16_C( 28784), -INT16_C( 10308), -INT16_C( 10156),  INT16_C(  7523),  INT16_C(     2), -INT16_C(  4943) } },
+    { {  INT16_C(  9483), -INT16_C( 21751), -INT16_C( 11788), -INT16_C( 22130),  INT16_C( 15460), -INT16_C( 23604),  INT16_C( 16510), -INT16_C(  1456),
+        -INT16_C( 32017), -INT16_C( 23863), -INT16_C( 14637),  INT16_C( 19683),  INT16_C( 25124),  INT16_C( 15480),  INT16_C(  6146), -INT16_C( 24068),
+        -INT16_C( 27102),  INT16_C(  6893),  INT16_C(  8794),  INT16_C( 22556),  INT16_C( 27224),  INT16_C(  4214),  INT16_C( 21950),  INT16_C(  2201),
+        -INT16_C( 17008), -INT16_C(  7074), -INT16_C( 27957),  INT16_C( 24357),  INT16_C(  1367),  INT16_C(   849),  INT16_C(  7517),  INT16_C( 21321) },
+      UINT32_C(1401527165),
+      {  INT16_C(   805),  INT16_C( 15063), -INT16_C( 13782), -INT16_C( 22211), -INT16_C( 25702), -INT16_C(  1452),  INT16_C( 13099),  INT16_C(  6349),
+         INT16_C( 17378), -INT16_C( 25433),  INT16_C( 30465), -INT16_C( 26337), -INT16_C(  9324), -INT16_C(  5104), -INT16_C( 31561),  INT16_C( 11583),
+        -INT16_C( 28987),  INT16_C( 22151), -INT16_C( 25216), -INT16_C( 25022), -INT16_C( 28909),  INT16_C( 22640), -INT16_C(  5706),  INT16_C(  9304),
+         INT16_C(  1476), -INT16_C( 21129),  INT16_C( 11238),  INT16_C(  7399), -INT16_C(  8802), -INT16_C( 21036), -INT16_C( 24578),  INT16_C( 22034) },
+      {  INT16_C(     5), -INT16_C( 21751),  INT16_C(     7),  INT16_C(     9),  INT16_C(     9),  INT16_C(     9),  INT16_C(     8), -INT16_C(  1456),
+         INT16_C(     7),  INT16_C(     9), -INT16_C( 14637),  INT16_C(     9),  INT16_C(     9),  INT16_C( 15480),  INT16_C(  6146),  INT16_C(    10),
+         INT16_C(     8),  INT16_C(  6893),  INT16_C(  8794),  INT16_C(     7),  INT16_C( 27224),  INT16_C(  4214),  INT16_C( 21950),  INT16_C(     5),
+         INT16_C(     5),  INT16_C(    11), -INT16_C( 27957),  INT16_C( 24357),  INT16_C(    11),  INT16_C(   849),  INT16_C(    13),  INT16_C( 21321) } },
+    { {  INT16_C( 17715),  INT16_C( 20333),  INT16_C( 15205),  INT16_C(  3397), -INT16_C( 23277),  INT16_C( 23566), -INT16_C( 23158), -INT16_C( 15388),
+        -INT16_C(  2032), -INT16_C( 29973), -INT16_C( 26265),  INT16_C( 31110), -INT16_C(  3419),  INT16_C(  3893), -INT16_C(  2733), -INT16_C( 28606),
+         INT16_C(  6889),  INT16_C( 16800),  INT16_C( 28023),  INT16_C( 18205), -INT16_C( 11013), -INT16_C( 20245),  INT16_C(  4883),  INT16_C(  6485),
+        -INT16_C( 24941), -INT16_C( 18691), -INT16_C( 22753),  INT16_C( 21074),  INT16_C( 15444), -INT16_C( 27146), -INT16_C( 10778),  INT16_C( 14824) },
+      UINT32_C(2898803398),
+      {  INT16_C(  4349),  INT16_C( 11798), -INT16_C( 21530), -INT16_C( 17422), -INT16_C( 23538), -INT16_C( 27387), -INT16_C(  9302),  INT16_C( 26070),
+         INT16_C( 11577), -INT16_C(  7837),  INT16_C( 18932),  INT16_C( 29407),  INT16_C( 27118), -INT16_C( 24721), -INT16_C( 10178),  INT16_C( 32639),
+        -INT16_C( 20123),  INT16_C( 23006), -INT16_C( 11479),  INT16_C( 25668), -INT16_C( 25512),  INT16_C( 31959),  INT16_C( 28160), -INT16_C( 22482),
+         INT16_C( 29503),  INT16_C( 14485),  INT16_C( 15748),  INT16_C( 12619), -INT16_C( 14189), -INT16_C( 26495),  INT16_C( 11007), -INT16_C(  1938) },
+      {  INT16_C( 17715),  INT16_C(     7),  INT16_C(    10),  INT16_C(  3397), -INT16_C( 23277),  INT16_C( 23566),  INT16_C(    10),  INT16_C(     9),
+        -INT16_C(  2032),  INT16_C(     8), -INT16_C( 26265),  INT16_C(    11),  INT16_C(    10),  INT16_C(    12), -INT16_C(  2733), -INT16_C( 28606),
+         INT16_C(  6889),  INT16_C( 16800),  INT16_C( 28023),  INT16_C(     5), -INT16_C( 11013), -INT16_C( 20245),  INT16_C(     5),  INT16_C(     7),
+        -INT16_C( 24941), -INT16_C( 18691),  INT16_C(     7),  INT16_C(     7),  INT16_C( 15444),  INT16_C(     5), -INT16_C( 10778),  INT16_C(    10) } },
+    { {  INT16_C( 16490),  INT16_C( 11650),  INT16_C(  1805), -INT16_C(  6341),  INT16_C( 22574),  INT16_C(  7586), -INT16_C(  3829),  INT16_C(  3056),
+         INT16_C( 25385), -INT16_C( 10027),  INT16_C( 26353), -INT16_C( 19506), -INT16_C( 14422), -INT16_C(  9640),  INT16_C( 12991), -INT16_C( 31206),
+         INT16_C( 29469), -INT16_C( 13967),  INT16_C(  2084),  INT16_C( 23026),  INT16_C(  7945),  INT16_C( 30039), -INT16_C(  3799),  INT16_C( 30280),
+        -INT16_C(  9254),  INT16_C( 11730), -INT16_C(  1255),  INT16_C( 12238), -INT16_C(  1197),  INT16_C( 17324),  INT16_C(  2777),  INT16_C( 19550) },
+      UINT32_C( 167907983),
+      { -INT16_C( 16842), -INT16_C(  2415),  INT16_C(  2717),  INT16_C(  1100),  INT16_C(  5148), -INT16_C( 17882), -INT16_C( 25795),  INT16_C( 19432),
+        -INT16_C( 16137),  INT16_C(  1351),  INT16_C( 18601),  INT16_C( 13396),  INT16_C( 31786), -INT16_C( 27740),  INT16_C(  1118),  INT16_C( 15766),
+         INT16_C(  6277),  INT16_C( 28682),  INT16_C(   626), -INT16_C(   422),  INT16_C( 12563),  INT16_C( 17753), -INT16_C( 10953),  INT16_C(  6648),
+        -INT16_C( 11991), -INT16_C( 19860),  INT16_C( 20623), -INT16_C( 10230),  INT16_C(   701),  INT16_C(  8728),  INT16_C( 12682),  INT16_C( 18147) },
+      {  INT16_C(    10),  INT16_C(     9),  INT16_C(     7),  INT16_C(     4),  INT16_C( 22574),  INT16_C(  7586), -INT16_C(  3829),  INT16_C(     8),
+         INT16_C( 25385),  INT16_C(     6),  INT16_C( 26353), -INT16_C( 19506),  INT16_C(     8), -INT16_C(  9640),  INT16_C( 12991), -INT16_C( 31206),
+         INT16_C( 29469),  INT16_C(     5),  INT16_C(  2084),  INT16_C( 23026),  INT16_C(  7945),  INT16_C( 30039), -INT16_C(  3799),  INT16_C( 30280),
+        -INT16_C(  9254),  INT16_C(     8), -INT16_C(  1255),  INT16_C(     6), -INT16_C(  1197),  INT16_C( 17324),  INT16_C(  2777),  INT16_C( 19550) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi16(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_popcnt_epi16(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x32(r, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_popcnt_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 k;
+    const int16_t a[32];
+    const int16_t r[32];
+  } test_vec[] = {
+    {       UINT32_C( 132003126),
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    {       UINT32_C(1685366579),
+      { -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+        -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+        -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1),
+        -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1), -INT16_C(     1) },
+      {  INT16_C(    16),  INT16_C(    16),  INT16_C(     0),  INT16_C(     0),  INT16_C(    16),  INT16_C(    16),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(     0),  INT16_C(     0),  INT16_C(    16),  INT16_C(     0),  INT16_C(    16),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(    16),  INT16_C(     0),  INT16_C(    16),  INT16_C(    16),  INT16_C(    16),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(    16),  INT16_C(     0),  INT16_C(     0),  INT16_C(    16),  INT16_C(    16),  INT16_C(     0) } },
+    {       UINT32_C(1307394948),
+      {  INT16_C(    20),  INT16_C(  8194),  INT16_C(     2), -INT16_C( 27901),  INT16_C(  2068),  INT16_C( 11546),  INT16_C(  2720),  INT16_C(  6146),
+         INT16_C( 17443),  INT16_C( 14017),  INT16_C(  4098),  INT16_C( 10720),  INT16_C(    12),  INT16_C(  5891),  INT16_C(  8419),  INT16_C( 28676),
+        -INT16_C(  3040),  INT16_C( 17737),  INT16_C(  4227),  INT16_C(  2306),  INT16_C(     1),  INT16_C(  2049),  INT16_C(    33),  INT16_C(  4112),
+        -INT16_C( 32728),  INT16_C( 18601),  INT16_C(  2060),  INT16_C( 21248),  INT16_C( 17414), -INT16_C( 32124),  INT16_C(  2048), -INT16_C( 28632) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     3),
+         INT16_C(     5),  INT16_C(     7),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     6),  INT16_C(     0),
+         INT16_C(     6),  INT16_C(     0),  INT16_C(     4),  INT16_C(     3),  INT16_C(     0),  INT16_C(     2),  INT16_C(     2),  INT16_C(     2),
+         INT16_C(     3),  INT16_C(     0),  INT16_C(     3),  INT16_C(     4),  INT16_C(     0),  INT16_C(     0),  INT16_C(     1),  INT16_C(     0) } },
+    {       UINT32_C(2326972969),
+      {  INT16_C(    26), -INT16_C( 14828),  INT16_C(    97),  INT16_C(  8248),  INT16_C(  4755),  INT16_C(   256), -INT16_C( 25280), -INT16_C( 23520),
+        -INT16_C( 31741),  INT16_C(   132),  INT16_C(    64),        INT16_MIN, -INT16_C( 29695), -INT16_C( 25342),  INT16_C( 20496), -INT16_C( 32240),
+         INT16_C( 10245), -INT16_C( 25791),  INT16_C(     0),  INT16_C(  8714), -INT16_C( 32064),  INT16_C( 10008),  INT16_C(  8716),  INT16_C(  2050),
+        -INT16_C(  2776),  INT16_C( 12312),  INT16_C(  1026), -INT16_C( 16384), -INT16_C( 32118), -INT16_C( 16112),  INT16_C(  8590), -INT16_C( 28387) },
+      {  INT16_C(     3),  INT16_C(     0),  INT16_C(     0),  INT16_C(     4),  INT16_C(     0),  INT16_C(     1),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     2),  INT16_C(     0),  INT16_C(     1),  INT16_C(     0),  INT16_C(     0),  INT16_C(     3),  INT16_C(     3),
+         INT16_C(     0),  INT16_C(     7),  INT16_C(     0),  INT16_C(     0),  INT16_C(     4),  INT16_C(     6),  INT16_C(     0),  INT16_C(     2),
+         INT16_C(     0),  INT16_C(     4),  INT16_C(     0),  INT16_C(     2),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     7) } },
+    {       UINT32_C(2955390712),
+      {  INT16_C(  4096),  INT16_C(   386), -INT16_C( 31991), -INT16_C( 26220),  INT16_C(  8580),  INT16_C(  5157), -INT16_C( 23419),  INT16_C(  2821),
+         INT16_C( 17961), -INT16_C(  7032),  INT16_C(   192),  INT16_C(  6409), -INT16_C(  2944),  INT16_C( 17156),  INT16_C(   130),  INT16_C(   338),
+         INT16_C(   724),  INT16_C( 18432),  INT16_C( 16386), -INT16_C( 24320),  INT16_C(    86),  INT16_C(  4572),  INT16_C(  8705),  INT16_C(  9152),
+        -INT16_C( 32512),  INT16_C(   514), -INT16_C( 31615), -INT16_C( 31743),  INT16_C(  5184), -INT16_C( 30588),  INT16_C(   272), -INT16_C( 12286) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     7),  INT16_C(     4),  INT16_C(     5),  INT16_C(     6),  INT16_C(     5),
+         INT16_C(     0),  INT16_C(     6),  INT16_C(     2),  INT16_C(     5),  INT16_C(     0),  INT16_C(     4),  INT16_C(     0),  INT16_C(     4),
+         INT16_C(     5),  INT16_C(     2),  INT16_C(     2),  INT16_C(     0),  INT16_C(     0),  INT16_C(     7),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     3),  INT16_C(     4),  INT16_C(     0),  INT16_C(     4) } },
+    {       UINT32_C(2062015809),
+      {  INT16_C( 32099),  INT16_C( 19149),  INT16_C( 11284), -INT16_C( 26690),  INT16_C( 17880),  INT16_C( 21851),  INT16_C(  8907), -INT16_C(  6040),
+         INT16_C( 16019), -INT16_C( 32140),  INT16_C( 12027),  INT16_C( 20408),  INT16_C( 17195),  INT16_C(  7459), -INT16_C(  7477), -INT16_C( 11569),
+         INT16_C( 15067),  INT16_C( 31252), -INT16_C( 18554),  INT16_C(  8780),  INT16_C( 31842), -INT16_C( 22028),  INT16_C(  8800),  INT16_C( 16912),
+        -INT16_C( 13722), -INT16_C( 21867), -INT16_C( 31909), -INT16_C( 11750), -INT16_C( 31561),  INT16_C( 22161),  INT16_C( 14286),  INT16_C( 19765) },
+      {  INT16_C(    10),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     7),  INT16_C(     0),
+         INT16_C(     9),  INT16_C(     0),  INT16_C(    11),  INT16_C(     9),  INT16_C(     7),  INT16_C(     0),  INT16_C(     9),  INT16_C(    10),
+         INT16_C(    10),  INT16_C(     7),  INT16_C(     9),  INT16_C(     0),  INT16_C(     0),  INT16_C(     9),  INT16_C(     4),  INT16_C(     3),
+         INT16_C(     0),  INT16_C(     8),  INT16_C(     0),  INT16_C(     7),  INT16_C(     8),  INT16_C(     7),  INT16_C(    10),  INT16_C(     0) } },
+    {       UINT32_C(1908732377),
+      { -INT16_C(  8859), -INT16_C( 30088), -INT16_C( 25761),  INT16_C( 12728),  INT16_C( 10903),  INT16_C( 27624),  INT16_C( 23365), -INT16_C( 25287),
+        -INT16_C( 15836), -INT16_C( 15071), -INT16_C(  6646), -INT16_C(  6305), -INT16_C( 11266), -INT16_C( 30658),  INT16_C(  5447), -INT16_C(  9543),
+        -INT16_C( 16009), -INT16_C( 13260), -INT16_C( 15033), -INT16_C( 26106),  INT16_C( 25441), -INT16_C( 20671),  INT16_C( 20914), -INT16_C( 19153),
+        -INT16_C( 14878),  INT16_C( 28654), -INT16_C(  5475),  INT16_C(  3233),  INT16_C( 20966), -INT16_C( 19283),  INT16_C(   147),  INT16_C( 17336) },
+      {  INT16_C(    10),  INT16_C(     0),  INT16_C(     0),  INT16_C(     7),  INT16_C(     8),  INT16_C(     0),  INT16_C(     8),  INT16_C(     9),
+         INT16_C(     5),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(    12),  INT16_C(     7),  INT16_C(     7),  INT16_C(    10),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     8),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     7),  INT16_C(    10),
+         INT16_C(     8),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     8),  INT16_C(     9),  INT16_C(     4),  INT16_C(     0) } },
+    {       UINT32_C(3338740155),
+      { -INT16_C( 20012), -INT16_C( 18448),  INT16_C(  8716), -INT16_C( 20460), -INT16_C( 21877),  INT16_C(  8329),  INT16_C(  8158),  INT16_C( 30465),
+        -INT16_C(   329), -INT16_C( 20339),  INT16_C( 14525),  INT16_C(  1100),  INT16_C( 26606), -INT16_C(  4417),  INT16_C( 10617), -INT16_C( 20315),
+        -INT16_C(  4913), -INT16_C( 20151),  INT16_C(  9302), -INT16_C( 26200),  INT16_C(  9110),  INT16_C( 17583),  INT16_C( 26174),  INT16_C( 14798),
+        -INT16_C( 26927),  INT16_C( 27479),  INT16_C( 31915),  INT16_C( 27562),  INT16_C( 24817), -INT16_C( 19940), -INT16_C(  6895), -INT16_C( 13284) },
+      {  INT16_C(     8),  INT16_C(    10),  INT16_C(     0),  INT16_C(     5),  INT16_C(     8),  INT16_C(     4),  INT16_C(     0),  INT16_C(     7),
+         INT16_C(    13),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(    13),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(    11),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     8),  INT16_C(    10),  INT16_C(    10),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     7),  INT16_C(     7) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_popcnt_epi16(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i16x32(r, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_popcnt_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { { -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+        -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1) },
+      {  INT32_C(          32),  INT32_C(          32),  INT32_C(          32),  INT32_C(          32),  INT32_C(          32),  INT32_C(          32),  INT32_C(          32),  INT32_C(          32),
+         INT32_C(          32),  INT32_C(          32),  INT32_C(          32),  INT32_C(          32),  INT32_C(          32),  INT32_C(          32),  INT32_C(          32),  INT32_C(          32) } },
+    { {  INT32_C(   138428612),  INT32_C(   318967887),  INT32_C(      786485), -INT32_C(  2056699728),  INT32_C(   402694148),  INT32_C(   539756563),  INT32_C(     2208260),  INT32_C(   314584066),
+         INT32_C(     1192001),  INT32_C(   176360768),  INT32_C(   134244356), -INT32_C(  2138996515), -INT32_C(  1589485479),  INT32_C(    20973632), -INT32_C(  1874844540),  INT32_C(  1634753024) },
+      {  INT32_C(           6),  INT32_C(          11),  INT32_C(           6),  INT32_C(          11),  INT32_C(           5),  INT32_C(           8),  INT32_C(           7),  INT32_C(           8),
+         INT32_C(           6),  INT32_C(           9),  INT32_C(           5),  INT32_C(          10),  INT32_C(          11),  INT32_C(           4),  INT32_C(           7),  INT32_C(          10) } },
+    { {  INT32_C(    41971722),  INT32_C(   139460771), -INT32_C(   770464704), -INT32_C(   750709112),  INT32_C(  1483096578),  INT32_C(     1474560), -INT32_C(  2134396862),  INT32_C(    35930261),
+         INT32_C(   419692673), -INT32_C(   933232116),  INT32_C(  1376331793),  INT32_C(   721420880), -INT32_C(  1563934525),  INT32_C(   302777614), -INT32_C(  1037041632),  INT32_C(  1480591538) },
+      {  INT32_C(           7),  INT32_C(           7),  INT32_C(          11),  INT32_C(          12),  INT32_C(          10),  INT32_C(           4),  INT32_C(          11),  INT32_C(           8),
+         INT32_C(           6),  INT32_C(           8),  INT32_C(           9),  INT32_C(           7),  INT32_C(          11),  INT32_C(           9),  INT32_C(           6),  INT32_C(           9) } },
+    { {  INT32_C(   138675296),  INT32_C(   810598674),  INT32_C(   325618757),  INT32_C(    33554496),  INT32_C(  1086670953),  INT32_C(   122159108),  INT32_C(      263169),  INT32_C(   336625664),
+         INT32_C(   120029744),  INT32_C(  1159745642),  INT32_C(   553649153),  INT32_C(  1078280259),  INT32_C(    43545504),  INT32_C(   486711345),  INT32_C(  1619021844),  INT32_C(   337653794) },
+      {  INT32_C(           6),  INT32_C(           9),  INT32_C(          12),  INT32_C(           2),  INT32_C(          11),  INT32_C(           6),  INT32_C(           3),  INT32_C(           4),
+         INT32_C(          11),  INT32_C(          10),  INT32_C(           4),  INT32_C(           8),  INT32_C(          11),  INT32_C(          10),  INT32_C(           7),  INT32_C(           7) } },
+    { { -INT32_C(   944716467),  INT32_C(  1097853532), -INT32_C(  1449128705),  INT32_C(  1367873048), -INT32_C(  1094113457), -INT32_C(  1747933433),  INT32_C(   278876140), -INT32_C(   218790324),
+         INT32_C(  1034698449),  INT32_C(   696942331),  INT32_C(  1584186225), -INT32_C(  1809837982),  INT32_C(  1346950979),  INT32_C(  1062729314), -INT32_C(  1918238007), -INT32_C(  1840455748) },
+      {  INT32_C(          16),  INT32_C(          17),  INT32_C(          16),  INT32_C(          10),  INT32_C(          19),  INT32_C(          16),  INT32_C(          17),  INT32_C(          17),
+         INT32_C(          18),  INT32_C(          19),  INT32_C(          17),  INT32_C(           8),  INT32_C(          13),  INT32_C(          20),  INT32_C(          13),  INT32_C(          18) } },
+    { { -INT32_C(   474558153), -INT32_C(   880364560),  INT32_C(  1431779780), -INT32_C(   820145981),  INT32_C(  1491414456),  INT32_C(  1952983134), -INT32_C(    66945430),  INT32_C(   141307063),
+        -INT32_C(   322584494), -INT32_C(   176617727), -INT32_C(    91626494), -INT32_C(  1229503215), -INT32_C(   228177711), -INT32_C(   336533759), -INT32_C(  1333311580),  INT32_C(   629995309) },
+      {  INT32_C(          19),  INT32_C(          17),  INT32_C(          16),  INT32_C(          16),  INT32_C(          16),  INT32_C(          14),  INT32_C(          17),  INT32_C(          14),
+         INT32_C(          14),  INT32_C(          15),  INT32_C(          14),  INT32_C(          16),  INT32_C(          15),  INT32_C(          17),  INT32_C(          14),  INT32_C(          17) } },
+    { {  INT32_C(   637845448), -INT32_C(  1066212870),  INT32_C(  1483221209),  INT32_C(  1049353816),  INT32_C(  2000517012), -INT32_C(  1552874739),  INT32_C(  1815493230), -INT32_C(    68666322),
+        -INT32_C(   648428462), -INT32_C(  1001062514), -INT32_C(   873427599),  INT32_C(  1911065024),  INT32_C(   744535377),  INT32_C(  1781301732),  INT32_C(  1492220864),  INT32_C(   213341648) },
+      {  INT32_C(          14),  INT32_C(          16),  INT32_C(          13),  INT32_C(          18),  INT32_C(          20),  INT32_C(          13),  INT32_C(          17),  INT32_C(          19),
+         INT32_C(          15),  INT32_C(          18),  INT32_C(          17),  INT32_C(          13),  INT32_C(          13),  INT32_C(          13),  INT32_C(          16),  INT32_C(          15) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i r = simde_mm512_popcnt_epi32(a);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_popcnt_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { {  INT32_C(  1453449941),  INT32_C(   655435702), -INT32_C(  1189018357), -INT32_C(  2088758774), -INT32_C(   629751298), -INT32_C(  2137654597),  INT32_C(   554259291),  INT32_C(   745064815),
+         INT32_C(   487052352), -INT32_C(   592354491), -INT32_C(  1305072405),  INT32_C(  1532561741),  INT32_C(  1326156469),  INT32_C(   793219723),  INT32_C(  1349543653), -INT32_C(  1303475314) },
+      UINT16_C(64942),
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(  1453449941),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(   629751298),  INT32_C(           0),  INT32_C(   554259291),  INT32_C(           0),
+         INT32_C(           0), -INT32_C(   592354491),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { {  INT32_C(  2017763784),  INT32_C(   498606592), -INT32_C(   988478639), -INT32_C(   778684350), -INT32_C(    42227670), -INT32_C(   230383742), -INT32_C(   776691415),  INT32_C(   617479266),
+        -INT32_C(    27605012),  INT32_C(   300728189), -INT32_C(   887941321),  INT32_C(  1316114500), -INT32_C(  1117930892),  INT32_C(  2073863626),  INT32_C(   462054551),  INT32_C(   765366539) },
+      UINT16_C(48434),
+      { -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+        -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1) },
+      {  INT32_C(  2017763784),  INT32_C(          32), -INT32_C(   988478639), -INT32_C(   778684350),  INT32_C(          32),  INT32_C(          32), -INT32_C(   776691415),  INT32_C(   617479266),
+         INT32_C(          32),  INT32_C(   300728189),  INT32_C(          32),  INT32_C(          32),  INT32_C(          32),  INT32_C(          32),  INT32_C(   462054551),  INT32_C(          32) } },
+    { {  INT32_C(  1603062577),  INT32_C(  1828032211), -INT32_C(   407441018),  INT32_C(  1581971432),  INT32_C(  1154448876), -INT32_C(  2137172582),  INT32_C(  1883044177), -INT32_C(   572481072),
+         INT32_C(  1479841160), -INT32_C(  1733200484),  INT32_C(   524644649),  INT32_C(  1511696677), -INT32_C(  1192655828),  INT32_C(   955591033),  INT32_C(   704036240),  INT32_C(  2130288779) },
+      UINT16_C(55424),
+      {  INT32_C(  1192240552),  INT32_C(   369361409),  INT32_C(   236176396),  INT32_C(   476073992),  INT32_C(     8525828),  INT32_C(    50356355),  INT32_C(    72450179), -INT32_C(   937405372),
+         INT32_C(  1620052608), -INT32_C(  1912494034),  INT32_C(   608187726),  INT32_C(  1074053136), -INT32_C(  2073537531),  INT32_C(   943900994),  INT32_C(   269353476),  INT32_C(  1075159793) },
+      {  INT32_C(  1603062577),  INT32_C(  1828032211), -INT32_C(   407441018),  INT32_C(  1581971432),  INT32_C(  1154448876), -INT32_C(  2137172582),  INT32_C(  1883044177),  INT32_C(           9),
+         INT32_C(  1479841160), -INT32_C(  1733200484),  INT32_C(   524644649),  INT32_C(           5),  INT32_C(          10),  INT32_C(   955591033),  INT32_C(           6),  INT32_C(          12) } },
+    { {  INT32_C(  1043771669), -INT32_C(  1291490870), -INT32_C(   560358788), -INT32_C(   266287837),  INT32_C(   235975017),  INT32_C(   376729662),  INT32_C(  1304568364), -INT32_C(   852426459),
+         INT32_C(  1212681278),  INT32_C(  2062882714),  INT32_C(   164152242), -INT32_C(   423663833),  INT32_C(   435428021), -INT32_C(  1263326343),  INT32_C(  1330480835), -INT32_C(   409581949) },
+      UINT16_C(56163),
+      {  INT32_C(   537464312),  INT32_C(  1712402441),  INT32_C(   174853249),  INT32_C(   673522690), -INT32_C(  1342107548),  INT32_C(   359859458),  INT32_C(     6298321), -INT32_C(  1577052668),
+        -INT32_C(  1856765824),  INT32_C(   269002848),  INT32_C(   115769346),  INT32_C(     8790016),  INT32_C(   469895650), -INT32_C(  2143018845),  INT32_C(    67125267),  INT32_C(   317850178) },
+      {  INT32_C(          11),  INT32_C(          10), -INT32_C(   560358788), -INT32_C(   266287837),  INT32_C(   235975017),  INT32_C(          11),  INT32_C(           9), -INT32_C(   852426459),
+         INT32_C(           7),  INT32_C(           7),  INT32_C(   164152242),  INT32_C(           4),  INT32_C(          10), -INT32_C(  1263326343),  INT32_C(           5),  INT32_C(          10) } },
+    { { -INT32_C(  1112229083),  INT32_C(   702078930),  INT32_C(   652446875), -INT32_C(  1279224940), -INT32_C(  1890769930), -INT32_C(  1772458492),  INT32_C(  1940035349),  INT32_C(  1764715801),
+        -INT32_C(   435143963), -INT32_C(  1120727733), -INT32_C(  1258956790),  INT32_C(  1539574461),  INT32_C(   752067761),  INT32_C(   406863456), -INT32_C(  1769530412), -INT32_C(  1255336097) },
+      UINT16_C( 4994),
+      {  INT32_C(   302289760),  INT32_C(  1211777064),  INT32_C(          32),  INT32_C(    17039880),  INT32_C(   818958356),  INT32_C(    15239181),  INT32_C(  1075317798), -INT32_C(  1869606908),
+        -INT32_C(   318766820),  INT32_C(    33620354), -INT32_C(  2112828917),  INT32_C(   472392321),  INT32_C(   554042400),  INT32_C(   308905619),  INT32_C(    93331456),  INT32_C(  1259602183) },
+      { -INT32_C(  1112229083),  INT32_C(           9),  INT32_C(   652446875), -INT32_C(  1279224940), -INT32_C(  1890769930), -INT32_C(  1772458492),  INT32_C(  1940035349),  INT32_C(           6),
+         INT32_C(          10),  INT32_C(           5), -INT32_C(  1258956790),  INT32_C(  1539574461),  INT32_C(           6),  INT32_C(   406863456), -INT32_C(  1769530412), -INT32_C(  1255336097) } },
+    { {  INT32_C(  1411431880),  INT32_C(   475689558),  INT32_C(  2125452804), -INT32_C(    31789108), -INT32_C(   920027809), -INT32_C(  2066510784), -INT32_C(  1336278863),  INT32_C(   871415155),
+         INT32_C(  2035898669), -INT32_C(  1984904335), -INT32_C(  1437430838), -INT32_C(  1180015915), -INT32_C(  1712452606),  INT32_C(  1997402156), -INT32_C(  1127019721),  INT32_C(  1930116987) },
+      UINT16_C(38242),
+      {  INT32_C(   815791791), -INT32_C(   487616484),  INT32_C(   204770641), -INT32_C(   173371462), -INT32_C(  1185025468), -INT32_C(  2056787882), -INT32_C(  1512943490), -INT32_C(   237100016),
+        -INT32_C(  1211973728),  INT32_C(   516508106),  INT32_C(  1525002778),  INT32_C(  1668370356), -INT32_C(  1974403227), -INT32_C(  1048143571), -INT32_C(   738043292), -INT32_C(  1003734813) },
+      {  INT32_C(  1411431880),  INT32_C(          16),  INT32_C(  2125452804), -INT32_C(    31789108), -INT32_C(   920027809),  INT32_C(          16),  INT32_C(          16),  INT32_C(   871415155),
+         INT32_C(          18), -INT32_C(  1984904335),  INT32_C(          16), -INT32_C(  1180015915),  INT32_C(          17),  INT32_C(  1997402156), -INT32_C(  1127019721),  INT32_C(          14) } },
+    { { -INT32_C(  1660485311), -INT32_C(   890266052),  INT32_C(   967317123),  INT32_C(   743856807), -INT32_C(  1986646428),  INT32_C(   238575228),  INT32_C(   273854366), -INT32_C(   121563730),
+        -INT32_C(  1932006251),  INT32_C(  1257625779), -INT32_C(  1953353672), -INT32_C(   192844340),  INT32_C(  1649156781), -INT32_C(    78163556),  INT32_C(  1531962398),  INT32_C(  2016820927) },
+      UINT16_C(35349),
+      {  INT32_C(   883626460),  INT32_C(  1467852302), -INT32_C(   440663347), -INT32_C(   679796848), -INT32_C(  1332518998), -INT32_C(   657486127),  INT32_C(  1339828477), -INT32_C(   403244787),
+         INT32_C(   636620926), -INT32_C(   983351941),  INT32_C(    39876138),  INT32_C(  1963048490),  INT32_C(   564138635), -INT32_C(  1377652435),  INT32_C(   991414892), -INT32_C(   788588751) },
+      {  INT32_C(          15), -INT32_C(   890266052),  INT32_C(          16),  INT32_C(   743856807),  INT32_C(          17),  INT32_C(   238575228),  INT32_C(   273854366), -INT32_C(   121563730),
+        -INT32_C(  1932006251),  INT32_C(          19), -INT32_C(  1953353672),  INT32_C(          15),  INT32_C(  1649156781), -INT32_C(    78163556),  INT32_C(  1531962398),  INT32_C(          18) } },
+    { { -INT32_C(  1132080086), -INT32_C(     2584729),  INT32_C(   878239726),  INT32_C(  1286546828),  INT32_C(   279398348), -INT32_C(   213166112), -INT32_C(   762459574),  INT32_C(   874668263),
+        -INT32_C(   598991294), -INT32_C(   352740679), -INT32_C(  1020582623),  INT32_C(   690459770), -INT32_C(  1051087209),  INT32_C(  2075833730),  INT32_C(   420319973), -INT32_C(   935695719) },
+      UINT16_C(62349),
+      { -INT32_C(   109769981),  INT32_C(   250682876),  INT32_C(   743360462),  INT32_C(  1969207908), -INT32_C(  1213947593), -INT32_C(  1362934298),  INT32_C(  1487228691), -INT32_C(  2053749638),
+        -INT32_C(  1667765692), -INT32_C(  1026058581),  INT32_C(  1813542617),  INT32_C(   978375138),  INT32_C(  1732190116),  INT32_C(   869145787), -INT32_C(  1419416221), -INT32_C(  1148924424) },
+      {  INT32_C(          16), -INT32_C(     2584729),  INT32_C(          17),  INT32_C(          19),  INT32_C(   279398348), -INT32_C(   213166112), -INT32_C(   762459574),  INT32_C(          14),
+         INT32_C(          16),  INT32_C(          18), -INT32_C(  1020582623),  INT32_C(   690459770),  INT32_C(          19),  INT32_C(          18),  INT32_C(          18),  INT32_C(          18) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_popcnt_epi32(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_popcnt_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    {       UINT16_C(60472),
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    {       UINT16_C(56138),
+      { -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1),
+        -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           1) },
+      {  INT32_C(           0),  INT32_C(          32),  INT32_C(           0),  INT32_C(          32),  INT32_C(           0),  INT32_C(           0),  INT32_C(          32),  INT32_C(           0),
+         INT32_C(          32),  INT32_C(          32),  INT32_C(           0),  INT32_C(          32),  INT32_C(          32),  INT32_C(           0),  INT32_C(          32),  INT32_C(          32) } },
+    {       UINT16_C(40671),
+      { -INT32_C(  1541603328),  INT32_C(  1443103784),  INT32_C(  1074921508), -INT32_C(  1509202942),  INT32_C(  1627422784),  INT32_C(   268633420),  INT32_C(   101827072),  INT32_C(     1573376),
+         INT32_C(   845971588),  INT32_C(   269028625),  INT32_C(   310388388), -INT32_C(   653981677),  INT32_C(     6549528), -INT32_C(  2011953792),  INT32_C(   492970256),  INT32_C(       18529) },
+      {  INT32_C(           7),  INT32_C(           8),  INT32_C(           5),  INT32_C(          11),  INT32_C(           5),  INT32_C(           0),  INT32_C(           7),  INT32_C(           3),
+         INT32_C(           0),  INT32_C(           8),  INT32_C(           9),  INT32_C(          11),  INT32_C(          10),  INT32_C(           0),  INT32_C(           0),  INT32_C(           5) } },
+    {       UINT16_C(45138),
+      {  INT32_C(     4219136), -INT32_C(  2004417792),  INT32_C(     3220007), -INT32_C(   116305403),  INT32_C(  1443152784), -INT32_C(  1862254513),  INT32_C(   419442688), -INT32_C(  2147212792),
+         INT32_C(   536872227),  INT32_C(  1082130517),  INT32_C(  2047948811),  INT32_C(    69894344), -INT32_C(  1736161274),  INT32_C(  1091059780), -INT32_C(   268430205),  INT32_C(  1212547203) },
+      {  INT32_C(           0),  INT32_C(           8),  INT32_C(           0),  INT32_C(           0),  INT32_C(          11),  INT32_C(           0),  INT32_C(           5),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           9),  INT32_C(           6),  INT32_C(           0),  INT32_C(           8) } },
+    {       UINT16_C(39645),
+      { -INT32_C(   802946011), -INT32_C(  1133899072),  INT32_C(     1049620),  INT32_C(   304088104), -INT32_C(  2120735702), -INT32_C(  1065217958),  INT32_C(   195044386),  INT32_C(      595072),
+        -INT32_C(  1962635712),  INT32_C(  1243699278),  INT32_C(   562972713), -INT32_C(  1946003968),  INT32_C(   542549132),  INT32_C(   805326144),  INT32_C(     3149056),  INT32_C(    13259136) },
+      {  INT32_C(           9),  INT32_C(           0),  INT32_C(           4),  INT32_C(           6),  INT32_C(          10),  INT32_C(           0),  INT32_C(           9),  INT32_C(           5),
+         INT32_C(           0),  INT32_C(          12),  INT32_C(           0),  INT32_C(           8),  INT32_C(          11),  INT32_C(           0),  INT32_C(           0),  INT32_C(           8) } },
+    {       UINT16_C(64113),
+      {  INT32_C(  1179931240),  INT32_C(  1840396904), -INT32_C(  1561103567), -INT32_C(   958284109), -INT32_C(  1834243387),  INT32_C(  1422073673),  INT32_C(  1658003894), -INT32_C(   373110904),
+        -INT32_C(   874774492), -INT32_C(   329102254),  INT32_C(  1690394923), -INT32_C(   731852320),  INT32_C(  1758142251), -INT32_C(   315531326),  INT32_C(  1070606894), -INT32_C(  1485714783) },
+      {  INT32_C(          12),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(          16),  INT32_C(          15),  INT32_C(          15),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(          14),  INT32_C(           0),  INT32_C(          13),  INT32_C(          17),  INT32_C(          18),  INT32_C(          16),  INT32_C(          16) } },
+    {       UINT16_C(44280),
+      {  INT32_C(  1146228316), -INT32_C(    10006026), -INT32_C(    85079518), -INT32_C(   726446325), -INT32_C(   187958123), -INT32_C(    97734867),  INT32_C(   548769487), -INT32_C(   120858540),
+        -INT32_C(  1006066941), -INT32_C(  1974535421),  INT32_C(   835645743),  INT32_C(   193336055),  INT32_C(   106981599),  INT32_C(   252664814), -INT32_C(   477824175),  INT32_C(   739021760) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(          17),  INT32_C(          20),  INT32_C(          19),  INT32_C(          16),  INT32_C(          17),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(          18),  INT32_C(          15),  INT32_C(           0),  INT32_C(          19),  INT32_C(           0),  INT32_C(          11) } },
+    {       UINT16_C( 9888),
+      {  INT32_C(   186758152), -INT32_C(   203510431), -INT32_C(   319600226), -INT32_C(  1905614993), -INT32_C(  1925318009),  INT32_C(   210575266),  INT32_C(  1204600210),  INT32_C(   309860013),
+         INT32_C(  1743678014), -INT32_C(   608395489), -INT32_C(  1568024052), -INT32_C(   988720357),  INT32_C(   154397776),  INT32_C(  2147356341),  INT32_C(  1506700463), -INT32_C(   815284523) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(          14),  INT32_C(           0),  INT32_C(          14),
+         INT32_C(           0),  INT32_C(          22),  INT32_C(          13),  INT32_C(           0),  INT32_C(           0),  INT32_C(          22),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_popcnt_epi32(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_popcnt_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { { -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+        -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1) },
+      {  INT64_C(                  64),  INT64_C(                  64),  INT64_C(                  64),  INT64_C(                  64),
+         INT64_C(                  64),  INT64_C(                  64),  INT64_C(                  64),  INT64_C(                  64) } },
+    { {  INT64_C( 7802522917476059201),  INT64_C(  307127708885803420),  INT64_C( 4611688604015302721), -INT64_C( 1724275980928401395),
+         INT64_C( 1166558287786180608),  INT64_C(  145460212390690816),  INT64_C( 1729664866686078982),  INT64_C(  657882337170609218) },
+      {  INT64_C(                  15),  INT64_C(                  22),  INT64_C(                  14),  INT64_C(                  19),
+         INT64_C(                  15),  INT64_C(                  14),  INT64_C(                  16),  INT64_C(                  18) } },
+    { { -INT64_C( 8329952864138927104),  INT64_C(  109317949516438540),  INT64_C(    1267749792017472), -INT64_C( 9213989352500076028),
+         INT64_C( 1225559641598001858),  INT64_C( 4611792397269254176), -INT64_C( 2293719791839833531),  INT64_C( 7061679748854394896) },
+      {  INT64_C(                  15),  INT64_C(                  17),  INT64_C(                  11),  INT64_C(                  15),
+         INT64_C(                  12),  INT64_C(                  12),  INT64_C(                  20),  INT64_C(                  15) } },
+    { {  INT64_C( 4971976209651994240), -INT64_C( 5188120451093607344), -INT64_C( 9222218631938428413),  INT64_C( 4621179202486547597),
+         INT64_C( 5981081880577967112),  INT64_C(   18018832815834113), -INT64_C( 2585063798108840816),  INT64_C(  293460212363841544) },
+      {  INT64_C(                  11),  INT64_C(                  20),  INT64_C(                  15),  INT64_C(                  22),
+         INT64_C(                  13),  INT64_C(                  12),  INT64_C(                  15),  INT64_C(                  16) } },
+    { { -INT64_C( 1577853424041450325), -INT64_C( 5905223967681049873), -INT64_C( 8054566735280829155), -INT64_C( 2355039727194233175),
+        -INT64_C( 3598231646199141480), -INT64_C( 9134550986835544199), -INT64_C( 1367541370036557702),  INT64_C( 7084798216221174162) },
+      {  INT64_C(                  29),  INT64_C(                  37),  INT64_C(                  31),  INT64_C(                  37),
+         INT64_C(                  29),  INT64_C(                  35),  INT64_C(                  32),  INT64_C(                  28) } },
+    { { -INT64_C( 5317587286918562716), -INT64_C( 7595017614902089939),  INT64_C( 6208249748762134685), -INT64_C( 5847040150868001912),
+         INT64_C( 1906926962564949733),  INT64_C( 5589097882608785806), -INT64_C(  537116963527796895),  INT64_C( 7883937556056812887) },
+      {  INT64_C(                  29),  INT64_C(                  31),  INT64_C(                  25),  INT64_C(                  33),
+         INT64_C(                  31),  INT64_C(                  33),  INT64_C(                  36),  INT64_C(                  36) } },
+    { {  INT64_C(  904556025244984619),  INT64_C( 2068782093219716552),  INT64_C( 3645966383014338566), -INT64_C( 3657623717832849840),
+        -INT64_C( 3561335236709019220),  INT64_C( 7012970251011947355),  INT64_C( 5132914719244903249), -INT64_C( 6845558805730446661) },
+      {  INT64_C(                  27),  INT64_C(                  30),  INT64_C(                  27),  INT64_C(                  28),
+         INT64_C(                  29),  INT64_C(                  36),  INT64_C(                  38),  INT64_C(                  34) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i r = simde_mm512_popcnt_epi64(a);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_popcnt_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[8];
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { {  INT64_C( 8101415587567086767),  INT64_C( 7745443045851839374), -INT64_C( 2692297685713331899),  INT64_C( 3564936756702893273),
+         INT64_C( 6146662787641707837),  INT64_C( 8042017145483571339),  INT64_C( 2182067416556520161),  INT64_C( 7535514537084405680) },
+      UINT8_C( 55),
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 3564936756702893273),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C( 2182067416556520161),  INT64_C( 7535514537084405680) } },
+    { {  INT64_C( 7500301298735966160),  INT64_C( 5959737239074794046),  INT64_C( 2308150037127754764), -INT64_C( 8501435780417507394),
+         INT64_C( 2519567989539513629), -INT64_C( 1604183874427671498), -INT64_C(  659268488658764820),  INT64_C( 2160823777559378279) },
+      UINT8_C(221),
+      { -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+        -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1) },
+      {  INT64_C(                  64),  INT64_C( 5959737239074794046),  INT64_C(                  64),  INT64_C(                  64),
+         INT64_C(                  64), -INT64_C( 1604183874427671498),  INT64_C(                  64),  INT64_C(                  64) } },
+    { { -INT64_C( 1050602678788033917), -INT64_C( 9172901097306388016),  INT64_C( 4245528789085710985), -INT64_C( 7796666436034464208),
+        -INT64_C( 1845890057425053812), -INT64_C( 2220985379167190681), -INT64_C( 4891456457473592914),  INT64_C(  215533253401538729) },
+      UINT8_C(130),
+      {  INT64_C( 2323866798945993216),  INT64_C( 4630870860125987884),  INT64_C( 4670232832474488962),  INT64_C( 4861138821330305040),
+         INT64_C( 4614503716996389888),  INT64_C( 4614078575652373027), -INT64_C( 8609351963770860738), -INT64_C( 1110128305626652615) },
+      { -INT64_C( 1050602678788033917),  INT64_C(                  18),  INT64_C( 4245528789085710985), -INT64_C( 7796666436034464208),
+        -INT64_C( 1845890057425053812), -INT64_C( 2220985379167190681), -INT64_C( 4891456457473592914),  INT64_C(                  18) } },
+    { {  INT64_C( 3556098296238479824),  INT64_C(  206037899088213237), -INT64_C( 6112516566804829592), -INT64_C(  200998671802881578),
+         INT64_C(  464639870355078610), -INT64_C( 4218271546613917296), -INT64_C( 6544303885694443578),  INT64_C( 8984663933376615364) },
+      UINT8_C( 92),
+      { -INT64_C( 7998338500244536248),  INT64_C(   18155346787828744),  INT64_C( 2461384736674201784), -INT64_C( 8934784660697510400),
+         INT64_C(   76563839948290098),  INT64_C( 2307886478151563035),  INT64_C( 4611721215684640778),  INT64_C( 1190371180960679936) },
+      {  INT64_C( 3556098296238479824),  INT64_C(  206037899088213237),  INT64_C(                  19),  INT64_C(                  16),
+         INT64_C(                  19), -INT64_C( 4218271546613917296),  INT64_C(                   7),  INT64_C( 8984663933376615364) } },
+    { {  INT64_C(  284560155686539688), -INT64_C(  604484645963184947), -INT64_C( 7355417747873761330), -INT64_C( 5649566030157351504),
+         INT64_C( 2596458067337980816), -INT64_C( 8083392911217836040),  INT64_C( 5605904299261081500),  INT64_C( 5469175727286621411) },
+      UINT8_C(207),
+      {  INT64_C( 3066109395617876544), -INT64_C( 9204794134335634258),  INT64_C( 4665747361599852656),  INT64_C(    6245245928985777),
+         INT64_C(   49577602235572632), -INT64_C( 9055032305482956024), -INT64_C( 7491631855395921915),  INT64_C(  874299081968844800) },
+      {  INT64_C(                  18),  INT64_C(                  16),  INT64_C(                  17),  INT64_C(                  19),
+         INT64_C( 2596458067337980816), -INT64_C( 8083392911217836040),  INT64_C(                  17),  INT64_C(                  12) } },
+    { {  INT64_C( 1385908728900088457),  INT64_C( 3182389548161893227),  INT64_C( 7416037906226607206), -INT64_C(  952652278870724070),
+         INT64_C( 5521873022724348047), -INT64_C( 4756266967289257530),  INT64_C( 5507944325999673330),  INT64_C( 7190783340826951084) },
+      UINT8_C(130),
+      {  INT64_C( 6162671017586308763),  INT64_C( 5199443736308138259), -INT64_C( 7659949814209217096),  INT64_C( 6779869345971237254),
+        -INT64_C( 4548858057090951652), -INT64_C( 3666589287517256997),  INT64_C( 4003819569715509368),  INT64_C( 3250405436197898609) },
+      {  INT64_C( 1385908728900088457),  INT64_C(                  22),  INT64_C( 7416037906226607206), -INT64_C(  952652278870724070),
+         INT64_C( 5521873022724348047), -INT64_C( 4756266967289257530),  INT64_C( 5507944325999673330),  INT64_C(                  28) } },
+    { { -INT64_C(  474089200603723870),  INT64_C( 1728907426257314338),  INT64_C( 4761109309003328805),  INT64_C( 5350325217206794178),
+        -INT64_C( 2396046640794024448),  INT64_C( 7206477632183099555),  INT64_C( 5955803268293968432), -INT64_C( 2461504111560645596) },
+      UINT8_C(249),
+      {  INT64_C( 1105548474513694160), -INT64_C( 9053669607173919035), -INT64_C( 1617236440751554885), -INT64_C( 2342683735000944212),
+        -INT64_C( 3384513660940582384),  INT64_C( 1395509472205921744), -INT64_C( 9025931084576486227),  INT64_C( 5889602429745094295) },
+      {  INT64_C(                  35),  INT64_C( 1728907426257314338),  INT64_C( 4761109309003328805),  INT64_C(                  37),
+         INT64_C(                  26),  INT64_C(                  32),  INT64_C(                  26),  INT64_C(                  33) } },
+    { { -INT64_C( 7246952788051868624), -INT64_C( 6401932622607362612), -INT64_C( 6406966024304864160), -INT64_C( 1995377040577028506),
+        -INT64_C( 4562796646975038829),  INT64_C( 4878699818167716569),  INT64_C( 3305787048417439411), -INT64_C( 3081033606547032751) },
+      UINT8_C(233),
+      {  INT64_C( 7736494221636434516), -INT64_C( 4476963590260121457),  INT64_C( 2722570470990538816), -INT64_C( 7726489905955218703),
+         INT64_C( 8327368165437710513),  INT64_C( 3108424764675852449),  INT64_C( 1931406911120344215),  INT64_C( 5934143550454186434) },
+      {  INT64_C(                  30), -INT64_C( 6401932622607362612), -INT64_C( 6406966024304864160),  INT64_C(                  35),
+        -INT64_C( 4562796646975038829),  INT64_C(                  28),  INT64_C(                  27),  INT64_C(                  29) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi64(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i r = simde_mm512_mask_popcnt_epi64(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_popcnt_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    {       UINT8_C(152),
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    {       UINT8_C(246),
+      { -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1),
+        -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1), -INT64_C(                   1) },
+      {  INT64_C(                   0),  INT64_C(                  64),  INT64_C(                  64),  INT64_C(                   0),
+         INT64_C(                  64),  INT64_C(                  64),  INT64_C(                  64),  INT64_C(                  64) } },
+    {       UINT8_C(209),
+      {  INT64_C(  578154326688797255),  INT64_C(   27021950631611124),  INT64_C( 2314920680291946661), -INT64_C( 5616550544970611392),
+         INT64_C(  587376303326409741),  INT64_C( 6991348040432004802),  INT64_C( 1739026077803630905),  INT64_C(  650811894883680802) },
+      {  INT64_C(                  18),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                  24),  INT64_C(                   0),  INT64_C(                  19),  INT64_C(                  19) } },
+    {       UINT8_C(184),
+      {  INT64_C(   73239717214422432),  INT64_C( 6361478269327944449), -INT64_C( 9220375850207410716),  INT64_C( 3603191647774714401),
+         INT64_C( 1179439595336761472), -INT64_C( 9194077297567595951),  INT64_C( 2308095363157983875),  INT64_C(   18107382301982720) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                  25),
+         INT64_C(                  16),  INT64_C(                  16),  INT64_C(                   0),  INT64_C(                  17) } },
+    {       UINT8_C( 24),
+      {  INT64_C(   18096037386786080), -INT64_C( 8070441435133698036),  INT64_C(  153145515780182568), -INT64_C( 4603197228020920320),
+         INT64_C( 5784006206750523968),  INT64_C( 2342138198899033696), -INT64_C( 9137800989095668704),  INT64_C( 2351741210045190146) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                  15),
+         INT64_C(                  15),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    {       UINT8_C( 66),
+      { -INT64_C( 4688944293167890283), -INT64_C( 6534992346939966625),  INT64_C( 3485412226305345046),  INT64_C( 3121403555756057504),
+        -INT64_C( 8862205515218682191),  INT64_C( 3364567053436933050),  INT64_C( 6335695832675173860), -INT64_C( 3439427216097215135) },
+      {  INT64_C(                   0),  INT64_C(                  37),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                  36),  INT64_C(                   0) } },
+    {       UINT8_C( 51),
+      { -INT64_C( 3899498502025432164),  INT64_C( 4651527931919408518),  INT64_C( 6351387618305032182),  INT64_C( 3263768076791986246),
+         INT64_C( 4318628029212327203), -INT64_C( 3696452539416614597), -INT64_C( 4691788030786523457), -INT64_C( 7505545670793931445) },
+      {  INT64_C(                  32),  INT64_C(                  26),  INT64_C(                   0),  INT64_C(                   0),
+         INT64_C(                  42),  INT64_C(                  28),  INT64_C(                   0),  INT64_C(                   0) } },
+    {       UINT8_C( 62),
+      { -INT64_C( 3313474483489791018),  INT64_C( 5034037151917162195), -INT64_C( 5287965524834621239),  INT64_C( 6976537815397142179),
+         INT64_C( 1366184998904769150),  INT64_C( 5024576153241208210),  INT64_C(  899133181577198927),  INT64_C( 4899005544526023118) },
+      {  INT64_C(                   0),  INT64_C(                  32),  INT64_C(                  38),  INT64_C(                  27),
+         INT64_C(                  32),  INT64_C(                  32),  INT64_C(                   0),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i r = simde_mm512_maskz_popcnt_epi64(test_vec[i].k, a);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_x_popcount_buffer (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    size_t offset;
+    size_t len;
+    uint64_t r;
+  } test_vec[] = {
+    {    0,    0, UINT64_C(    0) },
+    {    3,    1, UINT64_C(    3) },
+    {    0,   63, UINT64_C(  243) },
+    {    1,   64, UINT64_C(  247) },
+    {    5,  100, UINT64_C(  384) },
+    {    0, 1023, UINT64_C( 4099) },
+    {    0, 1024, UINT64_C( 4102) },
+    {    7, 1025, UINT64_C( 4109) },
+    {   13, 2047, UINT64_C( 8208) },
+    {    0, 3072, UINT64_C(12279) },
+    {    1, 4199, UINT64_C(16667) },
+    {    0, 4200, UINT64_C(16670) }
+  };
+
+  static uint8_t buf[4200];
+  uint32_t state = UINT32_C(0x9e3779b9);
+  for (size_t i = 0 ; i < sizeof(buf) ; i++) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    buf[i] = HEDLEY_STATIC_CAST(uint8_t, state >> 7);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_x_popcount_buffer(buf + test_vec[i].offset, test_vec[i].len);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_popcnt_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_popcnt_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_popcnt_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_popcnt_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_popcnt_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_popcnt_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_popcnt_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_popcnt_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_popcnt_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_popcnt_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_popcnt_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_popcnt_epi64)
+
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_popcnt_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_popcnt_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_popcnt_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_popcnt_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_popcnt_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_popcnt_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_popcnt_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_popcnt_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_popcnt_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_popcnt_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_popcnt_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_popcnt_epi64)
+
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_popcnt_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_popcnt_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_popcnt_epi8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_popcnt_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_popcnt_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_popcnt_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_popcnt_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_popcnt_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_popcnt_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_popcnt_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_popcnt_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_popcnt_epi64)
+
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_popcount_buffer)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
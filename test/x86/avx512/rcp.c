@@ -0,0 +1,1899 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN rcp
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/rcp.h>
+
+static int
+test_simde_mm_rcp14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  856.6500), SIMDE_FLOAT32_C( -910.1100), SIMDE_FLOAT32_C( -396.7500), SIMDE_FLOAT32_C( -547.9800) },
+      { SIMDE_FLOAT32_C(    0.0012), SIMDE_FLOAT32_C(   -0.0011), SIMDE_FLOAT32_C(   -0.0025), SIMDE_FLOAT32_C(   -0.0018) } },
+    { { SIMDE_FLOAT32_C( -622.8800), SIMDE_FLOAT32_C( -801.3600), SIMDE_FLOAT32_C( -443.6600), SIMDE_FLOAT32_C(  961.7900) },
+      { SIMDE_FLOAT32_C(   -0.0016), SIMDE_FLOAT32_C(   -0.0012), SIMDE_FLOAT32_C(   -0.0023), SIMDE_FLOAT32_C(    0.0010) } },
+    { { SIMDE_FLOAT32_C( -161.8700), SIMDE_FLOAT32_C( -177.2200), SIMDE_FLOAT32_C( -235.3900), SIMDE_FLOAT32_C( -122.6100) },
+      { SIMDE_FLOAT32_C(   -0.0062), SIMDE_FLOAT32_C(   -0.0056), SIMDE_FLOAT32_C(   -0.0042), SIMDE_FLOAT32_C(   -0.0082) } },
+    { { SIMDE_FLOAT32_C(   31.9600), SIMDE_FLOAT32_C(   53.5200), SIMDE_FLOAT32_C(  463.8800), SIMDE_FLOAT32_C( -314.7700) },
+      { SIMDE_FLOAT32_C(    0.0313), SIMDE_FLOAT32_C(    0.0187), SIMDE_FLOAT32_C(    0.0022), SIMDE_FLOAT32_C(   -0.0032) } },
+    { { SIMDE_FLOAT32_C( -978.2900), SIMDE_FLOAT32_C(   47.0900), SIMDE_FLOAT32_C(  106.5700), SIMDE_FLOAT32_C( -282.8500) },
+      { SIMDE_FLOAT32_C(   -0.0010), SIMDE_FLOAT32_C(    0.0212), SIMDE_FLOAT32_C(    0.0094), SIMDE_FLOAT32_C(   -0.0035) } },
+    { { SIMDE_FLOAT32_C( -500.8100), SIMDE_FLOAT32_C( -775.6900), SIMDE_FLOAT32_C( -185.7900), SIMDE_FLOAT32_C( -546.8700) },
+      { SIMDE_FLOAT32_C(   -0.0020), SIMDE_FLOAT32_C(   -0.0013), SIMDE_FLOAT32_C(   -0.0054), SIMDE_FLOAT32_C(   -0.0018) } },
+    { { SIMDE_FLOAT32_C(   -3.6500), SIMDE_FLOAT32_C( -878.7100), SIMDE_FLOAT32_C(  470.5800), SIMDE_FLOAT32_C( -321.5800) },
+      { SIMDE_FLOAT32_C(   -0.2740), SIMDE_FLOAT32_C(   -0.0011), SIMDE_FLOAT32_C(    0.0021), SIMDE_FLOAT32_C(   -0.0031) } },
+    { { SIMDE_FLOAT32_C(  116.9800), SIMDE_FLOAT32_C(    1.9000), SIMDE_FLOAT32_C(  410.3000), SIMDE_FLOAT32_C(  854.2100) },
+      { SIMDE_FLOAT32_C(    0.0085), SIMDE_FLOAT32_C(    0.5263), SIMDE_FLOAT32_C(    0.0024), SIMDE_FLOAT32_C(    0.0012) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_rcp14_ps(a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_rcp14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[4];
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C( -432.6600), SIMDE_FLOAT32_C( -967.8500), SIMDE_FLOAT32_C(  150.4100), SIMDE_FLOAT32_C( -275.8300) },
+      UINT8_C(148),
+      { SIMDE_FLOAT32_C(  493.0400), SIMDE_FLOAT32_C( -332.4100), SIMDE_FLOAT32_C(  867.8700), SIMDE_FLOAT32_C( -657.7500) },
+      { SIMDE_FLOAT32_C( -432.6600), SIMDE_FLOAT32_C( -967.8500), SIMDE_FLOAT32_C(    0.0012), SIMDE_FLOAT32_C( -275.8300) } },
+    { { SIMDE_FLOAT32_C(   29.6700), SIMDE_FLOAT32_C( -567.5700), SIMDE_FLOAT32_C( -862.6000), SIMDE_FLOAT32_C(  795.6400) },
+      UINT8_C(247),
+      { SIMDE_FLOAT32_C( -790.6100), SIMDE_FLOAT32_C(  242.3400), SIMDE_FLOAT32_C( -639.2500), SIMDE_FLOAT32_C(  317.6400) },
+      { SIMDE_FLOAT32_C(   -0.0013), SIMDE_FLOAT32_C(    0.0041), SIMDE_FLOAT32_C(   -0.0016), SIMDE_FLOAT32_C(  795.6400) } },
+    { { SIMDE_FLOAT32_C( -197.3100), SIMDE_FLOAT32_C(   48.5100), SIMDE_FLOAT32_C( -441.2000), SIMDE_FLOAT32_C(  769.9500) },
+      UINT8_C(201),
+      { SIMDE_FLOAT32_C( -810.5300), SIMDE_FLOAT32_C(  816.2700), SIMDE_FLOAT32_C( -573.1300), SIMDE_FLOAT32_C(  782.7400) },
+      { SIMDE_FLOAT32_C(   -0.0012), SIMDE_FLOAT32_C(   48.5100), SIMDE_FLOAT32_C( -441.2000), SIMDE_FLOAT32_C(    0.0013) } },
+    { { SIMDE_FLOAT32_C( -871.1000), SIMDE_FLOAT32_C( -866.1600), SIMDE_FLOAT32_C(  465.5700), SIMDE_FLOAT32_C( -585.9100) },
+      UINT8_C(220),
+      { SIMDE_FLOAT32_C(   83.0300), SIMDE_FLOAT32_C(  381.7400), SIMDE_FLOAT32_C(  914.7900), SIMDE_FLOAT32_C( -113.7700) },
+      { SIMDE_FLOAT32_C( -871.1000), SIMDE_FLOAT32_C( -866.1600), SIMDE_FLOAT32_C(    0.0011), SIMDE_FLOAT32_C(   -0.0088) } },
+    { { SIMDE_FLOAT32_C( -998.2700), SIMDE_FLOAT32_C( -333.6200), SIMDE_FLOAT32_C(  949.6900), SIMDE_FLOAT32_C(  452.7900) },
+      UINT8_C( 42),
+      { SIMDE_FLOAT32_C(   71.2500), SIMDE_FLOAT32_C(  506.4700), SIMDE_FLOAT32_C( -164.3000), SIMDE_FLOAT32_C( -377.6000) },
+      { SIMDE_FLOAT32_C( -998.2700), SIMDE_FLOAT32_C(    0.0020), SIMDE_FLOAT32_C(  949.6900), SIMDE_FLOAT32_C(   -0.0026) } },
+    { { SIMDE_FLOAT32_C( -972.9900), SIMDE_FLOAT32_C( -101.1000), SIMDE_FLOAT32_C( -354.7000), SIMDE_FLOAT32_C(  743.3100) },
+      UINT8_C( 68),
+      { SIMDE_FLOAT32_C( -887.6900), SIMDE_FLOAT32_C(  853.4800), SIMDE_FLOAT32_C( -847.6500), SIMDE_FLOAT32_C( -700.8800) },
+      { SIMDE_FLOAT32_C( -972.9900), SIMDE_FLOAT32_C( -101.1000), SIMDE_FLOAT32_C(   -0.0012), SIMDE_FLOAT32_C(  743.3100) } },
+    { { SIMDE_FLOAT32_C(  962.4100), SIMDE_FLOAT32_C( -191.8300), SIMDE_FLOAT32_C( -989.6200), SIMDE_FLOAT32_C( -815.8300) },
+      UINT8_C( 54),
+      { SIMDE_FLOAT32_C( -508.4200), SIMDE_FLOAT32_C( -386.0200), SIMDE_FLOAT32_C(  459.8100), SIMDE_FLOAT32_C(  959.7800) },
+      { SIMDE_FLOAT32_C(  962.4100), SIMDE_FLOAT32_C(   -0.0026), SIMDE_FLOAT32_C(    0.0022), SIMDE_FLOAT32_C( -815.8300) } },
+    { { SIMDE_FLOAT32_C(  496.8200), SIMDE_FLOAT32_C(  766.1600), SIMDE_FLOAT32_C(  978.2900), SIMDE_FLOAT32_C( -826.3800) },
+      UINT8_C(210),
+      { SIMDE_FLOAT32_C(  610.2800), SIMDE_FLOAT32_C(  758.7400), SIMDE_FLOAT32_C(  884.4800), SIMDE_FLOAT32_C(  -59.0200) },
+      { SIMDE_FLOAT32_C(  496.8200), SIMDE_FLOAT32_C(    0.0013), SIMDE_FLOAT32_C(  978.2900), SIMDE_FLOAT32_C( -826.3800) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 src = simde_mm_loadu_ps(test_vec[i].src);
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_mask_rcp14_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_rcp14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { UINT8_C(197),
+      { SIMDE_FLOAT32_C(  737.4600), SIMDE_FLOAT32_C( -704.5800), SIMDE_FLOAT32_C(  -48.5200), SIMDE_FLOAT32_C(  946.7300) },
+      { SIMDE_FLOAT32_C(    0.0014), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0206), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT8_C( 84),
+      { SIMDE_FLOAT32_C(  243.6100), SIMDE_FLOAT32_C( -842.2300), SIMDE_FLOAT32_C(  862.0600), SIMDE_FLOAT32_C(  431.3500) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0012), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT8_C(209),
+      { SIMDE_FLOAT32_C( -200.3500), SIMDE_FLOAT32_C(  767.3400), SIMDE_FLOAT32_C(  935.4500), SIMDE_FLOAT32_C(   84.4600) },
+      { SIMDE_FLOAT32_C(   -0.0050), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT8_C( 96),
+      { SIMDE_FLOAT32_C(  982.4700), SIMDE_FLOAT32_C( -319.4900), SIMDE_FLOAT32_C( -271.5000), SIMDE_FLOAT32_C(  318.0100) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT8_C(144),
+      { SIMDE_FLOAT32_C( -705.2500), SIMDE_FLOAT32_C( -872.0300), SIMDE_FLOAT32_C( -316.6900), SIMDE_FLOAT32_C( -943.6700) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT8_C( 73),
+      { SIMDE_FLOAT32_C(  690.4800), SIMDE_FLOAT32_C(  880.4000), SIMDE_FLOAT32_C( -338.0000), SIMDE_FLOAT32_C(  964.5300) },
+      { SIMDE_FLOAT32_C(    0.0014), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0010) } },
+    { UINT8_C( 58),
+      { SIMDE_FLOAT32_C(  996.4600), SIMDE_FLOAT32_C(  487.1700), SIMDE_FLOAT32_C(  421.8100), SIMDE_FLOAT32_C(  439.9700) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0021), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0023) } },
+    { UINT8_C(213),
+      { SIMDE_FLOAT32_C(  901.1800), SIMDE_FLOAT32_C( -619.9100), SIMDE_FLOAT32_C(  958.6000), SIMDE_FLOAT32_C( -530.2200) },
+      { SIMDE_FLOAT32_C(    0.0011), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0010), SIMDE_FLOAT32_C(    0.0000) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_maskz_rcp14_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_rcp14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  269.6400), SIMDE_FLOAT64_C(  845.9400) },
+      { SIMDE_FLOAT64_C(    0.0037), SIMDE_FLOAT64_C(    0.0012) } },
+    { { SIMDE_FLOAT64_C(  756.8800), SIMDE_FLOAT64_C( -589.2200) },
+      { SIMDE_FLOAT64_C(    0.0013), SIMDE_FLOAT64_C(   -0.0017) } },
+    { { SIMDE_FLOAT64_C( -911.5300), SIMDE_FLOAT64_C(  115.9100) },
+      { SIMDE_FLOAT64_C(   -0.0011), SIMDE_FLOAT64_C(    0.0086) } },
+    { { SIMDE_FLOAT64_C(  -52.5100), SIMDE_FLOAT64_C(  588.0600) },
+      { SIMDE_FLOAT64_C(   -0.0190), SIMDE_FLOAT64_C(    0.0017) } },
+    { { SIMDE_FLOAT64_C( -185.1100), SIMDE_FLOAT64_C( -504.2700) },
+      { SIMDE_FLOAT64_C(   -0.0054), SIMDE_FLOAT64_C(   -0.0020) } },
+    { { SIMDE_FLOAT64_C(  441.2700), SIMDE_FLOAT64_C(  895.1400) },
+      { SIMDE_FLOAT64_C(    0.0023), SIMDE_FLOAT64_C(    0.0011) } },
+    { { SIMDE_FLOAT64_C( -872.7100), SIMDE_FLOAT64_C( -885.3800) },
+      { SIMDE_FLOAT64_C(   -0.0011), SIMDE_FLOAT64_C(   -0.0011) } },
+    { { SIMDE_FLOAT64_C(  528.6800), SIMDE_FLOAT64_C( -431.6600) },
+      { SIMDE_FLOAT64_C(    0.0019), SIMDE_FLOAT64_C(   -0.0023) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_rcp14_pd(a);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_rcp14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[2];
+    const simde__mmask8 k;
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C( -953.8100), SIMDE_FLOAT64_C( -525.2000) },
+      UINT8_C( 88),
+      { SIMDE_FLOAT64_C(  727.1000), SIMDE_FLOAT64_C(  988.7400) },
+      { SIMDE_FLOAT64_C( -953.8100), SIMDE_FLOAT64_C( -525.2000) } },
+    { { SIMDE_FLOAT64_C( -701.2000), SIMDE_FLOAT64_C(  664.2800) },
+      UINT8_C( 15),
+      { SIMDE_FLOAT64_C(  618.4400), SIMDE_FLOAT64_C( -148.1700) },
+      { SIMDE_FLOAT64_C(    0.0016), SIMDE_FLOAT64_C(   -0.0067) } },
+    { { SIMDE_FLOAT64_C(  908.5000), SIMDE_FLOAT64_C( -793.6000) },
+      UINT8_C(  3),
+      { SIMDE_FLOAT64_C(  487.9400), SIMDE_FLOAT64_C(   99.8400) },
+      { SIMDE_FLOAT64_C(    0.0020), SIMDE_FLOAT64_C(    0.0100) } },
+    { { SIMDE_FLOAT64_C( -698.7500), SIMDE_FLOAT64_C(  187.4300) },
+      UINT8_C(223),
+      { SIMDE_FLOAT64_C( -411.0700), SIMDE_FLOAT64_C( -490.9500) },
+      { SIMDE_FLOAT64_C(   -0.0024), SIMDE_FLOAT64_C(   -0.0020) } },
+    { { SIMDE_FLOAT64_C(   81.9200), SIMDE_FLOAT64_C(  908.9100) },
+      UINT8_C(125),
+      { SIMDE_FLOAT64_C(  707.8600), SIMDE_FLOAT64_C( -763.9700) },
+      { SIMDE_FLOAT64_C(    0.0014), SIMDE_FLOAT64_C(  908.9100) } },
+    { { SIMDE_FLOAT64_C(  937.9000), SIMDE_FLOAT64_C(  230.1700) },
+      UINT8_C(210),
+      { SIMDE_FLOAT64_C(  595.2200), SIMDE_FLOAT64_C( -339.2600) },
+      { SIMDE_FLOAT64_C(  937.9000), SIMDE_FLOAT64_C(   -0.0029) } },
+    { { SIMDE_FLOAT64_C( -323.4300), SIMDE_FLOAT64_C(  907.0100) },
+      UINT8_C(183),
+      { SIMDE_FLOAT64_C(  216.5600), SIMDE_FLOAT64_C( -716.5500) },
+      { SIMDE_FLOAT64_C(    0.0046), SIMDE_FLOAT64_C(   -0.0014) } },
+    { { SIMDE_FLOAT64_C(  909.3300), SIMDE_FLOAT64_C( -983.6200) },
+      UINT8_C( 26),
+      { SIMDE_FLOAT64_C( -555.5900), SIMDE_FLOAT64_C( -556.3800) },
+      { SIMDE_FLOAT64_C(  909.3300), SIMDE_FLOAT64_C(   -0.0018) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d src = simde_mm_loadu_pd(test_vec[i].src);
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_mask_rcp14_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_rcp14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { UINT8_C(254),
+      { SIMDE_FLOAT64_C( -676.8500), SIMDE_FLOAT64_C( -837.9500) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(   -0.0012) } },
+    { UINT8_C( 82),
+      { SIMDE_FLOAT64_C(  617.7000), SIMDE_FLOAT64_C( -411.4700) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(   -0.0024) } },
+    { UINT8_C(154),
+      { SIMDE_FLOAT64_C(   39.7700), SIMDE_FLOAT64_C(  364.3600) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0027) } },
+    { UINT8_C( 89),
+      { SIMDE_FLOAT64_C( -170.8900), SIMDE_FLOAT64_C( -563.4600) },
+      { SIMDE_FLOAT64_C(   -0.0059), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C(222),
+      { SIMDE_FLOAT64_C( -589.4200), SIMDE_FLOAT64_C(  158.6300) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0063) } },
+    { UINT8_C( 57),
+      { SIMDE_FLOAT64_C( -954.9200), SIMDE_FLOAT64_C( -401.4200) },
+      { SIMDE_FLOAT64_C(   -0.0010), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C( 94),
+      { SIMDE_FLOAT64_C(  276.5400), SIMDE_FLOAT64_C( -478.2100) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(   -0.0021) } },
+    { UINT8_C(105),
+      { SIMDE_FLOAT64_C( -888.7900), SIMDE_FLOAT64_C( -701.2900) },
+      { SIMDE_FLOAT64_C(   -0.0011), SIMDE_FLOAT64_C(    0.0000) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_maskz_rcp14_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_rcp14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  180.7900), SIMDE_FLOAT32_C( -292.2400), SIMDE_FLOAT32_C(  956.6600), SIMDE_FLOAT32_C(  275.1400),
+        SIMDE_FLOAT32_C(  275.9900), SIMDE_FLOAT32_C(  102.5300), SIMDE_FLOAT32_C( -608.1100), SIMDE_FLOAT32_C(  954.9400) },
+      { SIMDE_FLOAT32_C(    0.0055), SIMDE_FLOAT32_C(   -0.0034), SIMDE_FLOAT32_C(    0.0010), SIMDE_FLOAT32_C(    0.0036),
+        SIMDE_FLOAT32_C(    0.0036), SIMDE_FLOAT32_C(    0.0098), SIMDE_FLOAT32_C(   -0.0016), SIMDE_FLOAT32_C(    0.0010) } },
+    { { SIMDE_FLOAT32_C( -810.6800), SIMDE_FLOAT32_C( -585.4000), SIMDE_FLOAT32_C(  177.0900), SIMDE_FLOAT32_C( -226.8100),
+        SIMDE_FLOAT32_C( -741.8000), SIMDE_FLOAT32_C(  151.8500), SIMDE_FLOAT32_C(  337.1100), SIMDE_FLOAT32_C( -707.1800) },
+      { SIMDE_FLOAT32_C(   -0.0012), SIMDE_FLOAT32_C(   -0.0017), SIMDE_FLOAT32_C(    0.0056), SIMDE_FLOAT32_C(   -0.0044),
+        SIMDE_FLOAT32_C(   -0.0013), SIMDE_FLOAT32_C(    0.0066), SIMDE_FLOAT32_C(    0.0030), SIMDE_FLOAT32_C(   -0.0014) } },
+    { { SIMDE_FLOAT32_C( -653.1700), SIMDE_FLOAT32_C( -213.9400), SIMDE_FLOAT32_C( -272.0900), SIMDE_FLOAT32_C( -232.9200),
+        SIMDE_FLOAT32_C(   34.5700), SIMDE_FLOAT32_C(  942.0400), SIMDE_FLOAT32_C(  475.6900), SIMDE_FLOAT32_C( -470.9500) },
+      { SIMDE_FLOAT32_C(   -0.0015), SIMDE_FLOAT32_C(   -0.0047), SIMDE_FLOAT32_C(   -0.0037), SIMDE_FLOAT32_C(   -0.0043),
+        SIMDE_FLOAT32_C(    0.0289), SIMDE_FLOAT32_C(    0.0011), SIMDE_FLOAT32_C(    0.0021), SIMDE_FLOAT32_C(   -0.0021) } },
+    { { SIMDE_FLOAT32_C(  -72.9200), SIMDE_FLOAT32_C(  883.7100), SIMDE_FLOAT32_C( -782.7300), SIMDE_FLOAT32_C(  697.1300),
+        SIMDE_FLOAT32_C( -915.8700), SIMDE_FLOAT32_C(  727.9800), SIMDE_FLOAT32_C( -577.5000), SIMDE_FLOAT32_C( -188.0800) },
+      { SIMDE_FLOAT32_C(   -0.0137), SIMDE_FLOAT32_C(    0.0011), SIMDE_FLOAT32_C(   -0.0013), SIMDE_FLOAT32_C(    0.0014),
+        SIMDE_FLOAT32_C(   -0.0011), SIMDE_FLOAT32_C(    0.0014), SIMDE_FLOAT32_C(   -0.0017), SIMDE_FLOAT32_C(   -0.0053) } },
+    { { SIMDE_FLOAT32_C(  665.2600), SIMDE_FLOAT32_C( -473.7900), SIMDE_FLOAT32_C(  243.6600), SIMDE_FLOAT32_C( -954.4600),
+        SIMDE_FLOAT32_C( -670.3800), SIMDE_FLOAT32_C( -732.7500), SIMDE_FLOAT32_C( -603.8600), SIMDE_FLOAT32_C( -835.7000) },
+      { SIMDE_FLOAT32_C(    0.0015), SIMDE_FLOAT32_C(   -0.0021), SIMDE_FLOAT32_C(    0.0041), SIMDE_FLOAT32_C(   -0.0010),
+        SIMDE_FLOAT32_C(   -0.0015), SIMDE_FLOAT32_C(   -0.0014), SIMDE_FLOAT32_C(   -0.0017), SIMDE_FLOAT32_C(   -0.0012) } },
+    { { SIMDE_FLOAT32_C( -511.9300), SIMDE_FLOAT32_C( -528.1500), SIMDE_FLOAT32_C(  554.9100), SIMDE_FLOAT32_C(  170.5900),
+        SIMDE_FLOAT32_C( -764.4000), SIMDE_FLOAT32_C( -500.4400), SIMDE_FLOAT32_C(  693.9600), SIMDE_FLOAT32_C(   14.0900) },
+      { SIMDE_FLOAT32_C(   -0.0020), SIMDE_FLOAT32_C(   -0.0019), SIMDE_FLOAT32_C(    0.0018), SIMDE_FLOAT32_C(    0.0059),
+        SIMDE_FLOAT32_C(   -0.0013), SIMDE_FLOAT32_C(   -0.0020), SIMDE_FLOAT32_C(    0.0014), SIMDE_FLOAT32_C(    0.0710) } },
+    { { SIMDE_FLOAT32_C(  441.8700), SIMDE_FLOAT32_C( -259.5200), SIMDE_FLOAT32_C(  190.9600), SIMDE_FLOAT32_C(  986.9900),
+        SIMDE_FLOAT32_C(   -1.0000), SIMDE_FLOAT32_C( -977.6400), SIMDE_FLOAT32_C(  -84.2000), SIMDE_FLOAT32_C(  233.9900) },
+      { SIMDE_FLOAT32_C(    0.0023), SIMDE_FLOAT32_C(   -0.0039), SIMDE_FLOAT32_C(    0.0052), SIMDE_FLOAT32_C(    0.0010),
+        SIMDE_FLOAT32_C(   -1.0000), SIMDE_FLOAT32_C(   -0.0010), SIMDE_FLOAT32_C(   -0.0119), SIMDE_FLOAT32_C(    0.0043) } },
+    { { SIMDE_FLOAT32_C(  730.5900), SIMDE_FLOAT32_C(  734.2300), SIMDE_FLOAT32_C(  640.8200), SIMDE_FLOAT32_C(  952.5100),
+        SIMDE_FLOAT32_C(  683.6700), SIMDE_FLOAT32_C( -426.1000), SIMDE_FLOAT32_C(  367.6300), SIMDE_FLOAT32_C(  722.7300) },
+      { SIMDE_FLOAT32_C(    0.0014), SIMDE_FLOAT32_C(    0.0014), SIMDE_FLOAT32_C(    0.0016), SIMDE_FLOAT32_C(    0.0010),
+        SIMDE_FLOAT32_C(    0.0015), SIMDE_FLOAT32_C(   -0.0023), SIMDE_FLOAT32_C(    0.0027), SIMDE_FLOAT32_C(    0.0014) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m256 r = simde_mm256_rcp14_ps(a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_rcp14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[8];
+    const simde__mmask8 k;
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C( -329.7100), SIMDE_FLOAT32_C(  840.0000), SIMDE_FLOAT32_C( -486.2800), SIMDE_FLOAT32_C(  373.3400),
+        SIMDE_FLOAT32_C(  297.6300), SIMDE_FLOAT32_C( -991.4900), SIMDE_FLOAT32_C(    8.9900), SIMDE_FLOAT32_C( -808.8700) },
+      UINT8_C(143),
+      { SIMDE_FLOAT32_C(  444.4500), SIMDE_FLOAT32_C( -234.9200), SIMDE_FLOAT32_C( -892.7100), SIMDE_FLOAT32_C( -888.4400),
+        SIMDE_FLOAT32_C( -623.7400), SIMDE_FLOAT32_C( -944.2400), SIMDE_FLOAT32_C(  566.6900), SIMDE_FLOAT32_C(  901.1800) },
+      { SIMDE_FLOAT32_C(    0.0022), SIMDE_FLOAT32_C(   -0.0043), SIMDE_FLOAT32_C(   -0.0011), SIMDE_FLOAT32_C(   -0.0011),
+        SIMDE_FLOAT32_C(  297.6300), SIMDE_FLOAT32_C( -991.4900), SIMDE_FLOAT32_C(    8.9900), SIMDE_FLOAT32_C(    0.0011) } },
+    { { SIMDE_FLOAT32_C( -236.5300), SIMDE_FLOAT32_C(  372.5700), SIMDE_FLOAT32_C( -955.2800), SIMDE_FLOAT32_C(  923.5800),
+        SIMDE_FLOAT32_C( -429.5800), SIMDE_FLOAT32_C(  642.0100), SIMDE_FLOAT32_C( -519.2200), SIMDE_FLOAT32_C(  865.8600) },
+      UINT8_C(131),
+      { SIMDE_FLOAT32_C(  480.6600), SIMDE_FLOAT32_C( -640.2000), SIMDE_FLOAT32_C(  950.7600), SIMDE_FLOAT32_C(  -28.8300),
+        SIMDE_FLOAT32_C( -295.2700), SIMDE_FLOAT32_C( -868.5700), SIMDE_FLOAT32_C(  491.7300), SIMDE_FLOAT32_C( -182.1900) },
+      { SIMDE_FLOAT32_C(    0.0021), SIMDE_FLOAT32_C(   -0.0016), SIMDE_FLOAT32_C( -955.2800), SIMDE_FLOAT32_C(  923.5800),
+        SIMDE_FLOAT32_C( -429.5800), SIMDE_FLOAT32_C(  642.0100), SIMDE_FLOAT32_C( -519.2200), SIMDE_FLOAT32_C(   -0.0055) } },
+    { { SIMDE_FLOAT32_C(  414.5100), SIMDE_FLOAT32_C(  479.8800), SIMDE_FLOAT32_C( -580.1000), SIMDE_FLOAT32_C(  888.3100),
+        SIMDE_FLOAT32_C(  852.5000), SIMDE_FLOAT32_C(   50.5700), SIMDE_FLOAT32_C(  -88.6700), SIMDE_FLOAT32_C( -546.8300) },
+      UINT8_C(245),
+      { SIMDE_FLOAT32_C(    7.7400), SIMDE_FLOAT32_C( -384.1100), SIMDE_FLOAT32_C(  350.4300), SIMDE_FLOAT32_C( -356.3000),
+        SIMDE_FLOAT32_C(  398.2600), SIMDE_FLOAT32_C(  479.0900), SIMDE_FLOAT32_C(  954.5400), SIMDE_FLOAT32_C(  646.2800) },
+      { SIMDE_FLOAT32_C(    0.1292), SIMDE_FLOAT32_C(  479.8800), SIMDE_FLOAT32_C(    0.0029), SIMDE_FLOAT32_C(  888.3100),
+        SIMDE_FLOAT32_C(    0.0025), SIMDE_FLOAT32_C(    0.0021), SIMDE_FLOAT32_C(    0.0010), SIMDE_FLOAT32_C(    0.0015) } },
+    { { SIMDE_FLOAT32_C( -371.4000), SIMDE_FLOAT32_C(  945.7900), SIMDE_FLOAT32_C(  538.5400), SIMDE_FLOAT32_C( -687.6400),
+        SIMDE_FLOAT32_C(  -94.1400), SIMDE_FLOAT32_C( -211.2300), SIMDE_FLOAT32_C(  200.9800), SIMDE_FLOAT32_C( -196.2600) },
+      UINT8_C( 13),
+      { SIMDE_FLOAT32_C(  256.0600), SIMDE_FLOAT32_C( -758.5900), SIMDE_FLOAT32_C(  897.2400), SIMDE_FLOAT32_C(  929.5300),
+        SIMDE_FLOAT32_C(  122.9500), SIMDE_FLOAT32_C(  934.6800), SIMDE_FLOAT32_C( -948.0800), SIMDE_FLOAT32_C(  767.9300) },
+      { SIMDE_FLOAT32_C(    0.0039), SIMDE_FLOAT32_C(  945.7900), SIMDE_FLOAT32_C(    0.0011), SIMDE_FLOAT32_C(    0.0011),
+        SIMDE_FLOAT32_C(  -94.1400), SIMDE_FLOAT32_C( -211.2300), SIMDE_FLOAT32_C(  200.9800), SIMDE_FLOAT32_C( -196.2600) } },
+    { { SIMDE_FLOAT32_C( -209.5700), SIMDE_FLOAT32_C( -763.8800), SIMDE_FLOAT32_C( -208.8100), SIMDE_FLOAT32_C(   15.3000),
+        SIMDE_FLOAT32_C(  309.5200), SIMDE_FLOAT32_C(  345.4500), SIMDE_FLOAT32_C(  753.9500), SIMDE_FLOAT32_C(  739.4800) },
+      UINT8_C(163),
+      { SIMDE_FLOAT32_C(  424.5800), SIMDE_FLOAT32_C( -508.0900), SIMDE_FLOAT32_C( -654.7700), SIMDE_FLOAT32_C(  300.7400),
+        SIMDE_FLOAT32_C(  674.4700), SIMDE_FLOAT32_C(  177.6000), SIMDE_FLOAT32_C( -496.2600), SIMDE_FLOAT32_C(   -6.4400) },
+      { SIMDE_FLOAT32_C(    0.0024), SIMDE_FLOAT32_C(   -0.0020), SIMDE_FLOAT32_C( -208.8100), SIMDE_FLOAT32_C(   15.3000),
+        SIMDE_FLOAT32_C(  309.5200), SIMDE_FLOAT32_C(    0.0056), SIMDE_FLOAT32_C(  753.9500), SIMDE_FLOAT32_C(   -0.1553) } },
+    { { SIMDE_FLOAT32_C(  789.8800), SIMDE_FLOAT32_C( -626.7600), SIMDE_FLOAT32_C(  152.0200), SIMDE_FLOAT32_C( -967.5000),
+        SIMDE_FLOAT32_C(  218.0400), SIMDE_FLOAT32_C(   36.9600), SIMDE_FLOAT32_C( -604.3100), SIMDE_FLOAT32_C(  -71.6700) },
+      UINT8_C( 73),
+      { SIMDE_FLOAT32_C( -289.2200), SIMDE_FLOAT32_C(  224.3700), SIMDE_FLOAT32_C( -920.8300), SIMDE_FLOAT32_C(  -49.6700),
+        SIMDE_FLOAT32_C( -788.5500), SIMDE_FLOAT32_C(  317.5600), SIMDE_FLOAT32_C(  509.0900), SIMDE_FLOAT32_C(  574.5200) },
+      { SIMDE_FLOAT32_C(   -0.0035), SIMDE_FLOAT32_C( -626.7600), SIMDE_FLOAT32_C(  152.0200), SIMDE_FLOAT32_C(   -0.0201),
+        SIMDE_FLOAT32_C(  218.0400), SIMDE_FLOAT32_C(   36.9600), SIMDE_FLOAT32_C(    0.0020), SIMDE_FLOAT32_C(  -71.6700) } },
+    { { SIMDE_FLOAT32_C( -208.0000), SIMDE_FLOAT32_C( -363.5600), SIMDE_FLOAT32_C( -101.7600), SIMDE_FLOAT32_C( -275.4400),
+        SIMDE_FLOAT32_C(  252.1300), SIMDE_FLOAT32_C( -199.1600), SIMDE_FLOAT32_C( -109.9100), SIMDE_FLOAT32_C( -228.1900) },
+      UINT8_C( 81),
+      { SIMDE_FLOAT32_C( -552.5900), SIMDE_FLOAT32_C( -116.0600), SIMDE_FLOAT32_C(  -70.1300), SIMDE_FLOAT32_C(  157.3700),
+        SIMDE_FLOAT32_C(  390.6700), SIMDE_FLOAT32_C( -881.3400), SIMDE_FLOAT32_C( -801.0900), SIMDE_FLOAT32_C(  933.1500) },
+      { SIMDE_FLOAT32_C(   -0.0018), SIMDE_FLOAT32_C( -363.5600), SIMDE_FLOAT32_C( -101.7600), SIMDE_FLOAT32_C( -275.4400),
+        SIMDE_FLOAT32_C(    0.0026), SIMDE_FLOAT32_C( -199.1600), SIMDE_FLOAT32_C(   -0.0012), SIMDE_FLOAT32_C( -228.1900) } },
+    { { SIMDE_FLOAT32_C(  -23.5600), SIMDE_FLOAT32_C(  745.1200), SIMDE_FLOAT32_C( -969.3900), SIMDE_FLOAT32_C(  688.7000),
+        SIMDE_FLOAT32_C(  568.4200), SIMDE_FLOAT32_C(  524.4400), SIMDE_FLOAT32_C(   74.0900), SIMDE_FLOAT32_C(  519.4500) },
+      UINT8_C(121),
+      { SIMDE_FLOAT32_C(  985.6400), SIMDE_FLOAT32_C(  124.5300), SIMDE_FLOAT32_C( -360.8100), SIMDE_FLOAT32_C( -129.6000),
+        SIMDE_FLOAT32_C( -168.3100), SIMDE_FLOAT32_C(  531.2500), SIMDE_FLOAT32_C( -793.0500), SIMDE_FLOAT32_C(  -12.7600) },
+      { SIMDE_FLOAT32_C(    0.0010), SIMDE_FLOAT32_C(  745.1200), SIMDE_FLOAT32_C( -969.3900), SIMDE_FLOAT32_C(   -0.0077),
+        SIMDE_FLOAT32_C(   -0.0059), SIMDE_FLOAT32_C(    0.0019), SIMDE_FLOAT32_C(   -0.0013), SIMDE_FLOAT32_C(  519.4500) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 src = simde_mm256_loadu_ps(test_vec[i].src);
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m256 r = simde_mm256_mask_rcp14_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_rcp14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { UINT8_C( 55),
+      { SIMDE_FLOAT32_C( -349.6900), SIMDE_FLOAT32_C( -259.6800), SIMDE_FLOAT32_C(  314.0300), SIMDE_FLOAT32_C( -253.6000),
+        SIMDE_FLOAT32_C(  -68.3300), SIMDE_FLOAT32_C(  146.6000), SIMDE_FLOAT32_C( -344.0700), SIMDE_FLOAT32_C(  137.2600) },
+      { SIMDE_FLOAT32_C(   -0.0029), SIMDE_FLOAT32_C(   -0.0039), SIMDE_FLOAT32_C(    0.0032), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(   -0.0146), SIMDE_FLOAT32_C(    0.0068), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT8_C(210),
+      { SIMDE_FLOAT32_C( -551.4400), SIMDE_FLOAT32_C( -215.8100), SIMDE_FLOAT32_C( -326.9400), SIMDE_FLOAT32_C(  512.5700),
+        SIMDE_FLOAT32_C( -842.0900), SIMDE_FLOAT32_C( -987.8000), SIMDE_FLOAT32_C( -146.7000), SIMDE_FLOAT32_C(  619.7800) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0046), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(   -0.0012), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0068), SIMDE_FLOAT32_C(    0.0016) } },
+    { UINT8_C(210),
+      { SIMDE_FLOAT32_C( -776.2500), SIMDE_FLOAT32_C( -875.6600), SIMDE_FLOAT32_C(  950.6300), SIMDE_FLOAT32_C(  806.5000),
+        SIMDE_FLOAT32_C( -177.8100), SIMDE_FLOAT32_C(  158.9800), SIMDE_FLOAT32_C(  174.4800), SIMDE_FLOAT32_C(  497.7800) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0011), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(   -0.0056), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0057), SIMDE_FLOAT32_C(    0.0020) } },
+    { UINT8_C(201),
+      { SIMDE_FLOAT32_C( -149.0200), SIMDE_FLOAT32_C(  631.2100), SIMDE_FLOAT32_C(    9.7400), SIMDE_FLOAT32_C( -934.7700),
+        SIMDE_FLOAT32_C(  954.7100), SIMDE_FLOAT32_C( -141.4600), SIMDE_FLOAT32_C(  527.2900), SIMDE_FLOAT32_C( -652.2800) },
+      { SIMDE_FLOAT32_C(   -0.0067), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0011),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0019), SIMDE_FLOAT32_C(   -0.0015) } },
+    { UINT8_C(226),
+      { SIMDE_FLOAT32_C( -508.0500), SIMDE_FLOAT32_C(  272.2900), SIMDE_FLOAT32_C( -293.2500), SIMDE_FLOAT32_C( -557.1500),
+        SIMDE_FLOAT32_C( -431.6400), SIMDE_FLOAT32_C( -249.5700), SIMDE_FLOAT32_C(  650.8000), SIMDE_FLOAT32_C(  978.6200) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0037), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0040), SIMDE_FLOAT32_C(    0.0015), SIMDE_FLOAT32_C(    0.0010) } },
+    { UINT8_C(103),
+      { SIMDE_FLOAT32_C(  853.6700), SIMDE_FLOAT32_C( -347.3000), SIMDE_FLOAT32_C(  -33.6900), SIMDE_FLOAT32_C(  112.5500),
+        SIMDE_FLOAT32_C( -905.7100), SIMDE_FLOAT32_C(  599.9600), SIMDE_FLOAT32_C(  391.8300), SIMDE_FLOAT32_C(   56.7700) },
+      { SIMDE_FLOAT32_C(    0.0012), SIMDE_FLOAT32_C(   -0.0029), SIMDE_FLOAT32_C(   -0.0297), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0017), SIMDE_FLOAT32_C(    0.0026), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT8_C(138),
+      { SIMDE_FLOAT32_C( -574.7100), SIMDE_FLOAT32_C(  818.7900), SIMDE_FLOAT32_C(  689.1700), SIMDE_FLOAT32_C( -524.6200),
+        SIMDE_FLOAT32_C(  943.2200), SIMDE_FLOAT32_C( -659.4300), SIMDE_FLOAT32_C(  244.3100), SIMDE_FLOAT32_C(  520.5300) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0012), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0019),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0019) } },
+    { UINT8_C( 70),
+      { SIMDE_FLOAT32_C( -245.2300), SIMDE_FLOAT32_C( -692.9100), SIMDE_FLOAT32_C( -294.5900), SIMDE_FLOAT32_C( -350.1800),
+        SIMDE_FLOAT32_C( -466.5700), SIMDE_FLOAT32_C( -849.4000), SIMDE_FLOAT32_C(  204.8800), SIMDE_FLOAT32_C( -390.7500) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0014), SIMDE_FLOAT32_C(   -0.0034), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0049), SIMDE_FLOAT32_C(    0.0000) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m256 r = simde_mm256_maskz_rcp14_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_rcp14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C( -106.9400), SIMDE_FLOAT64_C(  951.2100), SIMDE_FLOAT64_C( -204.0300), SIMDE_FLOAT64_C(  -92.7400) },
+      { SIMDE_FLOAT64_C(   -0.0094), SIMDE_FLOAT64_C(    0.0011), SIMDE_FLOAT64_C(   -0.0049), SIMDE_FLOAT64_C(   -0.0108) } },
+    { { SIMDE_FLOAT64_C( -341.4800), SIMDE_FLOAT64_C(  663.5900), SIMDE_FLOAT64_C(  -45.1400), SIMDE_FLOAT64_C( -323.1000) },
+      { SIMDE_FLOAT64_C(   -0.0029), SIMDE_FLOAT64_C(    0.0015), SIMDE_FLOAT64_C(   -0.0222), SIMDE_FLOAT64_C(   -0.0031) } },
+    { { SIMDE_FLOAT64_C( -980.2400), SIMDE_FLOAT64_C( -530.4600), SIMDE_FLOAT64_C(  403.5100), SIMDE_FLOAT64_C(  685.0500) },
+      { SIMDE_FLOAT64_C(   -0.0010), SIMDE_FLOAT64_C(   -0.0019), SIMDE_FLOAT64_C(    0.0025), SIMDE_FLOAT64_C(    0.0015) } },
+    { { SIMDE_FLOAT64_C(  684.1000), SIMDE_FLOAT64_C(   61.9400), SIMDE_FLOAT64_C( -137.3400), SIMDE_FLOAT64_C( -433.8100) },
+      { SIMDE_FLOAT64_C(    0.0015), SIMDE_FLOAT64_C(    0.0161), SIMDE_FLOAT64_C(   -0.0073), SIMDE_FLOAT64_C(   -0.0023) } },
+    { { SIMDE_FLOAT64_C( -691.3200), SIMDE_FLOAT64_C( -734.7700), SIMDE_FLOAT64_C( -291.6100), SIMDE_FLOAT64_C( -725.5100) },
+      { SIMDE_FLOAT64_C(   -0.0014), SIMDE_FLOAT64_C(   -0.0014), SIMDE_FLOAT64_C(   -0.0034), SIMDE_FLOAT64_C(   -0.0014) } },
+    { { SIMDE_FLOAT64_C(  -16.6200), SIMDE_FLOAT64_C(  956.2900), SIMDE_FLOAT64_C(  370.5200), SIMDE_FLOAT64_C(  932.7800) },
+      { SIMDE_FLOAT64_C(   -0.0602), SIMDE_FLOAT64_C(    0.0010), SIMDE_FLOAT64_C(    0.0027), SIMDE_FLOAT64_C(    0.0011) } },
+    { { SIMDE_FLOAT64_C( -269.7200), SIMDE_FLOAT64_C( -291.3800), SIMDE_FLOAT64_C( -621.5300), SIMDE_FLOAT64_C( -282.5100) },
+      { SIMDE_FLOAT64_C(   -0.0037), SIMDE_FLOAT64_C(   -0.0034), SIMDE_FLOAT64_C(   -0.0016), SIMDE_FLOAT64_C(   -0.0035) } },
+    { { SIMDE_FLOAT64_C( -499.6200), SIMDE_FLOAT64_C(  919.1200), SIMDE_FLOAT64_C( -369.2000), SIMDE_FLOAT64_C( -627.2200) },
+      { SIMDE_FLOAT64_C(   -0.0020), SIMDE_FLOAT64_C(    0.0011), SIMDE_FLOAT64_C(   -0.0027), SIMDE_FLOAT64_C(   -0.0016) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde__m256d r = simde_mm256_rcp14_pd(a);
+    simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_rcp14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[4];
+    const simde__mmask8 k;
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C( -890.4300), SIMDE_FLOAT64_C(  187.5800), SIMDE_FLOAT64_C( -684.0400), SIMDE_FLOAT64_C(  136.2300) },
+      UINT8_C( 60),
+      { SIMDE_FLOAT64_C(  773.9700), SIMDE_FLOAT64_C( -503.2600), SIMDE_FLOAT64_C(  465.8400), SIMDE_FLOAT64_C(  680.7400) },
+      { SIMDE_FLOAT64_C( -890.4300), SIMDE_FLOAT64_C(  187.5800), SIMDE_FLOAT64_C(    0.0021), SIMDE_FLOAT64_C(    0.0015) } },
+    { { SIMDE_FLOAT64_C(  774.0000), SIMDE_FLOAT64_C( -534.2700), SIMDE_FLOAT64_C(  889.2000), SIMDE_FLOAT64_C( -149.6800) },
+      UINT8_C( 83),
+      { SIMDE_FLOAT64_C( -992.7600), SIMDE_FLOAT64_C(  945.7200), SIMDE_FLOAT64_C(  369.9000), SIMDE_FLOAT64_C(  523.0000) },
+      { SIMDE_FLOAT64_C(   -0.0010), SIMDE_FLOAT64_C(    0.0011), SIMDE_FLOAT64_C(  889.2000), SIMDE_FLOAT64_C( -149.6800) } },
+    { { SIMDE_FLOAT64_C(  802.3300), SIMDE_FLOAT64_C(  471.0600), SIMDE_FLOAT64_C( -581.2800), SIMDE_FLOAT64_C( -743.7500) },
+      UINT8_C( 24),
+      { SIMDE_FLOAT64_C( -556.6900), SIMDE_FLOAT64_C(  124.1000), SIMDE_FLOAT64_C( -513.9900), SIMDE_FLOAT64_C(  -91.0300) },
+      { SIMDE_FLOAT64_C(  802.3300), SIMDE_FLOAT64_C(  471.0600), SIMDE_FLOAT64_C( -581.2800), SIMDE_FLOAT64_C(   -0.0110) } },
+    { { SIMDE_FLOAT64_C(  457.3700), SIMDE_FLOAT64_C( -945.2800), SIMDE_FLOAT64_C(  612.5900), SIMDE_FLOAT64_C( -933.2600) },
+      UINT8_C(  6),
+      { SIMDE_FLOAT64_C( -715.5300), SIMDE_FLOAT64_C(  774.6400), SIMDE_FLOAT64_C(  725.5300), SIMDE_FLOAT64_C(  555.3500) },
+      { SIMDE_FLOAT64_C(  457.3700), SIMDE_FLOAT64_C(    0.0013), SIMDE_FLOAT64_C(    0.0014), SIMDE_FLOAT64_C( -933.2600) } },
+    { { SIMDE_FLOAT64_C( -678.5400), SIMDE_FLOAT64_C( -478.3000), SIMDE_FLOAT64_C(  185.0600), SIMDE_FLOAT64_C( -350.4600) },
+      UINT8_C(123),
+      { SIMDE_FLOAT64_C( -700.6800), SIMDE_FLOAT64_C( -928.9600), SIMDE_FLOAT64_C(  123.9000), SIMDE_FLOAT64_C( -232.8500) },
+      { SIMDE_FLOAT64_C(   -0.0014), SIMDE_FLOAT64_C(   -0.0011), SIMDE_FLOAT64_C(  185.0600), SIMDE_FLOAT64_C(   -0.0043) } },
+    { { SIMDE_FLOAT64_C( -845.8600), SIMDE_FLOAT64_C(  664.9000), SIMDE_FLOAT64_C(  354.3900), SIMDE_FLOAT64_C( -403.3200) },
+      UINT8_C(200),
+      { SIMDE_FLOAT64_C(  937.2400), SIMDE_FLOAT64_C( -566.7300), SIMDE_FLOAT64_C( -452.5000), SIMDE_FLOAT64_C(  567.9500) },
+      { SIMDE_FLOAT64_C( -845.8600), SIMDE_FLOAT64_C(  664.9000), SIMDE_FLOAT64_C(  354.3900), SIMDE_FLOAT64_C(    0.0018) } },
+    { { SIMDE_FLOAT64_C(  678.5400), SIMDE_FLOAT64_C(  911.4800), SIMDE_FLOAT64_C(  560.9100), SIMDE_FLOAT64_C(   43.6900) },
+      UINT8_C(180),
+      { SIMDE_FLOAT64_C(  236.2200), SIMDE_FLOAT64_C(   68.0100), SIMDE_FLOAT64_C(   46.6900), SIMDE_FLOAT64_C(  -48.3600) },
+      { SIMDE_FLOAT64_C(  678.5400), SIMDE_FLOAT64_C(  911.4800), SIMDE_FLOAT64_C(    0.0214), SIMDE_FLOAT64_C(   43.6900) } },
+    { { SIMDE_FLOAT64_C(  132.1100), SIMDE_FLOAT64_C( -142.0500), SIMDE_FLOAT64_C(   52.3500), SIMDE_FLOAT64_C( -910.9000) },
+      UINT8_C( 14),
+      { SIMDE_FLOAT64_C(  120.3600), SIMDE_FLOAT64_C(  100.3100), SIMDE_FLOAT64_C(  110.2800), SIMDE_FLOAT64_C(  994.6300) },
+      { SIMDE_FLOAT64_C(  132.1100), SIMDE_FLOAT64_C(    0.0100), SIMDE_FLOAT64_C(    0.0091), SIMDE_FLOAT64_C(    0.0010) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d src = simde_mm256_loadu_pd(test_vec[i].src);
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde__m256d r = simde_mm256_mask_rcp14_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_rcp14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    { UINT8_C(237),
+      { SIMDE_FLOAT64_C( -236.7100), SIMDE_FLOAT64_C( -357.8300), SIMDE_FLOAT64_C(  507.5500), SIMDE_FLOAT64_C(  230.9900) },
+      { SIMDE_FLOAT64_C(   -0.0042), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0020), SIMDE_FLOAT64_C(    0.0043) } },
+    { UINT8_C(150),
+      { SIMDE_FLOAT64_C(  574.7700), SIMDE_FLOAT64_C( -254.8700), SIMDE_FLOAT64_C( -398.7200), SIMDE_FLOAT64_C(  788.3100) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(   -0.0039), SIMDE_FLOAT64_C(   -0.0025), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C(101),
+      { SIMDE_FLOAT64_C(  503.4000), SIMDE_FLOAT64_C( -758.7500), SIMDE_FLOAT64_C( -680.1600), SIMDE_FLOAT64_C( -828.3000) },
+      { SIMDE_FLOAT64_C(    0.0020), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(   -0.0015), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C(128),
+      { SIMDE_FLOAT64_C( -462.1500), SIMDE_FLOAT64_C( -510.5800), SIMDE_FLOAT64_C( -172.4000), SIMDE_FLOAT64_C( -572.1000) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C(165),
+      { SIMDE_FLOAT64_C( -974.7500), SIMDE_FLOAT64_C( -593.8300), SIMDE_FLOAT64_C(  312.7900), SIMDE_FLOAT64_C(  338.4000) },
+      { SIMDE_FLOAT64_C(   -0.0010), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0032), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C(159),
+      { SIMDE_FLOAT64_C(  353.5400), SIMDE_FLOAT64_C(  -60.5900), SIMDE_FLOAT64_C( -578.6900), SIMDE_FLOAT64_C( -268.4600) },
+      { SIMDE_FLOAT64_C(    0.0028), SIMDE_FLOAT64_C(   -0.0165), SIMDE_FLOAT64_C(   -0.0017), SIMDE_FLOAT64_C(   -0.0037) } },
+    { UINT8_C( 40),
+      { SIMDE_FLOAT64_C(  158.7800), SIMDE_FLOAT64_C(  922.7800), SIMDE_FLOAT64_C(  332.2200), SIMDE_FLOAT64_C( -321.0400) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(   -0.0031) } },
+    { UINT8_C(157),
+      { SIMDE_FLOAT64_C(  -93.9000), SIMDE_FLOAT64_C( -236.6500), SIMDE_FLOAT64_C(-1000.1800), SIMDE_FLOAT64_C( -516.1200) },
+      { SIMDE_FLOAT64_C(   -0.0106), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(   -0.0010), SIMDE_FLOAT64_C(   -0.0019) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde__m256d r = simde_mm256_maskz_rcp14_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_rcp14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  526.7600), SIMDE_FLOAT32_C(  949.6300), SIMDE_FLOAT32_C( -122.3500), SIMDE_FLOAT32_C( -122.8300),
+        SIMDE_FLOAT32_C(  518.5100), SIMDE_FLOAT32_C(  376.1900), SIMDE_FLOAT32_C( -164.0500), SIMDE_FLOAT32_C( -924.4100),
+        SIMDE_FLOAT32_C( -116.4900), SIMDE_FLOAT32_C(  374.1300), SIMDE_FLOAT32_C(  587.7500), SIMDE_FLOAT32_C(  279.0200),
+        SIMDE_FLOAT32_C(  231.7200), SIMDE_FLOAT32_C(    0.3100), SIMDE_FLOAT32_C(  919.9500), SIMDE_FLOAT32_C(  -14.9900) },
+      { SIMDE_FLOAT32_C(    0.0019), SIMDE_FLOAT32_C(    0.0011), SIMDE_FLOAT32_C(   -0.0082), SIMDE_FLOAT32_C(   -0.0081),
+        SIMDE_FLOAT32_C(    0.0019), SIMDE_FLOAT32_C(    0.0027), SIMDE_FLOAT32_C(   -0.0061), SIMDE_FLOAT32_C(   -0.0011),
+        SIMDE_FLOAT32_C(   -0.0086), SIMDE_FLOAT32_C(    0.0027), SIMDE_FLOAT32_C(    0.0017), SIMDE_FLOAT32_C(    0.0036),
+        SIMDE_FLOAT32_C(    0.0043), SIMDE_FLOAT32_C(    3.2259), SIMDE_FLOAT32_C(    0.0011), SIMDE_FLOAT32_C(   -0.0667) } },
+    { { SIMDE_FLOAT32_C(  379.5600), SIMDE_FLOAT32_C(  914.2100), SIMDE_FLOAT32_C( -103.7400), SIMDE_FLOAT32_C( -776.4800),
+        SIMDE_FLOAT32_C(  614.2600), SIMDE_FLOAT32_C( -887.2700), SIMDE_FLOAT32_C( -550.8600), SIMDE_FLOAT32_C(  633.7000),
+        SIMDE_FLOAT32_C( -797.2200), SIMDE_FLOAT32_C( -111.0900), SIMDE_FLOAT32_C( -463.4500), SIMDE_FLOAT32_C(  550.6500),
+        SIMDE_FLOAT32_C(   45.9800), SIMDE_FLOAT32_C( -465.7000), SIMDE_FLOAT32_C(   19.6600), SIMDE_FLOAT32_C(  300.4500) },
+      { SIMDE_FLOAT32_C(    0.0026), SIMDE_FLOAT32_C(    0.0011), SIMDE_FLOAT32_C(   -0.0096), SIMDE_FLOAT32_C(   -0.0013),
+        SIMDE_FLOAT32_C(    0.0016), SIMDE_FLOAT32_C(   -0.0011), SIMDE_FLOAT32_C(   -0.0018), SIMDE_FLOAT32_C(    0.0016),
+        SIMDE_FLOAT32_C(   -0.0013), SIMDE_FLOAT32_C(   -0.0090), SIMDE_FLOAT32_C(   -0.0022), SIMDE_FLOAT32_C(    0.0018),
+        SIMDE_FLOAT32_C(    0.0217), SIMDE_FLOAT32_C(   -0.0021), SIMDE_FLOAT32_C(    0.0509), SIMDE_FLOAT32_C(    0.0033) } },
+    { { SIMDE_FLOAT32_C( -325.1400), SIMDE_FLOAT32_C(  627.2500), SIMDE_FLOAT32_C( -913.1300), SIMDE_FLOAT32_C( -560.7300),
+        SIMDE_FLOAT32_C( -508.2000), SIMDE_FLOAT32_C( -378.7000), SIMDE_FLOAT32_C( -112.6300), SIMDE_FLOAT32_C( -343.4400),
+        SIMDE_FLOAT32_C( -439.9200), SIMDE_FLOAT32_C(  897.4800), SIMDE_FLOAT32_C(  959.5600), SIMDE_FLOAT32_C(   53.8000),
+        SIMDE_FLOAT32_C(  748.6000), SIMDE_FLOAT32_C( -286.1300), SIMDE_FLOAT32_C( -216.5800), SIMDE_FLOAT32_C( -849.2000) },
+      { SIMDE_FLOAT32_C(   -0.0031), SIMDE_FLOAT32_C(    0.0016), SIMDE_FLOAT32_C(   -0.0011), SIMDE_FLOAT32_C(   -0.0018),
+        SIMDE_FLOAT32_C(   -0.0020), SIMDE_FLOAT32_C(   -0.0026), SIMDE_FLOAT32_C(   -0.0089), SIMDE_FLOAT32_C(   -0.0029),
+        SIMDE_FLOAT32_C(   -0.0023), SIMDE_FLOAT32_C(    0.0011), SIMDE_FLOAT32_C(    0.0010), SIMDE_FLOAT32_C(    0.0186),
+        SIMDE_FLOAT32_C(    0.0013), SIMDE_FLOAT32_C(   -0.0035), SIMDE_FLOAT32_C(   -0.0046), SIMDE_FLOAT32_C(   -0.0012) } },
+    { { SIMDE_FLOAT32_C( -412.6400), SIMDE_FLOAT32_C(  812.0100), SIMDE_FLOAT32_C(  509.9400), SIMDE_FLOAT32_C( -918.0900),
+        SIMDE_FLOAT32_C( -929.9400), SIMDE_FLOAT32_C( -640.4900), SIMDE_FLOAT32_C(   64.4400), SIMDE_FLOAT32_C( -488.1400),
+        SIMDE_FLOAT32_C( -564.1700), SIMDE_FLOAT32_C(  402.9100), SIMDE_FLOAT32_C(   71.0100), SIMDE_FLOAT32_C( -822.4700),
+        SIMDE_FLOAT32_C(  616.7600), SIMDE_FLOAT32_C( -802.3300), SIMDE_FLOAT32_C( -618.8100), SIMDE_FLOAT32_C( -839.9300) },
+      { SIMDE_FLOAT32_C(   -0.0024), SIMDE_FLOAT32_C(    0.0012), SIMDE_FLOAT32_C(    0.0020), SIMDE_FLOAT32_C(   -0.0011),
+        SIMDE_FLOAT32_C(   -0.0011), SIMDE_FLOAT32_C(   -0.0016), SIMDE_FLOAT32_C(    0.0155), SIMDE_FLOAT32_C(   -0.0020),
+        SIMDE_FLOAT32_C(   -0.0018), SIMDE_FLOAT32_C(    0.0025), SIMDE_FLOAT32_C(    0.0141), SIMDE_FLOAT32_C(   -0.0012),
+        SIMDE_FLOAT32_C(    0.0016), SIMDE_FLOAT32_C(   -0.0012), SIMDE_FLOAT32_C(   -0.0016), SIMDE_FLOAT32_C(   -0.0012) } },
+    { { SIMDE_FLOAT32_C(  576.4400), SIMDE_FLOAT32_C(  846.1900), SIMDE_FLOAT32_C(  308.6300), SIMDE_FLOAT32_C( -676.6900),
+        SIMDE_FLOAT32_C(  383.5700), SIMDE_FLOAT32_C(  120.3900), SIMDE_FLOAT32_C( -730.2700), SIMDE_FLOAT32_C( -491.1800),
+        SIMDE_FLOAT32_C( -695.1900), SIMDE_FLOAT32_C( -106.7900), SIMDE_FLOAT32_C(  -27.7200), SIMDE_FLOAT32_C(  389.3200),
+        SIMDE_FLOAT32_C(  562.6100), SIMDE_FLOAT32_C( -266.8700), SIMDE_FLOAT32_C( -929.6800), SIMDE_FLOAT32_C( -548.8700) },
+      { SIMDE_FLOAT32_C(    0.0017), SIMDE_FLOAT32_C(    0.0012), SIMDE_FLOAT32_C(    0.0032), SIMDE_FLOAT32_C(   -0.0015),
+        SIMDE_FLOAT32_C(    0.0026), SIMDE_FLOAT32_C(    0.0083), SIMDE_FLOAT32_C(   -0.0014), SIMDE_FLOAT32_C(   -0.0020),
+        SIMDE_FLOAT32_C(   -0.0014), SIMDE_FLOAT32_C(   -0.0094), SIMDE_FLOAT32_C(   -0.0361), SIMDE_FLOAT32_C(    0.0026),
+        SIMDE_FLOAT32_C(    0.0018), SIMDE_FLOAT32_C(   -0.0037), SIMDE_FLOAT32_C(   -0.0011), SIMDE_FLOAT32_C(   -0.0018) } },
+    { { SIMDE_FLOAT32_C(  872.1900), SIMDE_FLOAT32_C(  514.4900), SIMDE_FLOAT32_C(  528.6800), SIMDE_FLOAT32_C(   42.5800),
+        SIMDE_FLOAT32_C(  383.9300), SIMDE_FLOAT32_C(  443.4200), SIMDE_FLOAT32_C(  665.9300), SIMDE_FLOAT32_C(  898.8700),
+        SIMDE_FLOAT32_C( -431.1000), SIMDE_FLOAT32_C( -763.8000), SIMDE_FLOAT32_C( -885.2600), SIMDE_FLOAT32_C( -655.6900),
+        SIMDE_FLOAT32_C(  -77.3700), SIMDE_FLOAT32_C(  707.2800), SIMDE_FLOAT32_C( -300.4100), SIMDE_FLOAT32_C(  561.6500) },
+      { SIMDE_FLOAT32_C(    0.0011), SIMDE_FLOAT32_C(    0.0019), SIMDE_FLOAT32_C(    0.0019), SIMDE_FLOAT32_C(    0.0235),
+        SIMDE_FLOAT32_C(    0.0026), SIMDE_FLOAT32_C(    0.0023), SIMDE_FLOAT32_C(    0.0015), SIMDE_FLOAT32_C(    0.0011),
+        SIMDE_FLOAT32_C(   -0.0023), SIMDE_FLOAT32_C(   -0.0013), SIMDE_FLOAT32_C(   -0.0011), SIMDE_FLOAT32_C(   -0.0015),
+        SIMDE_FLOAT32_C(   -0.0129), SIMDE_FLOAT32_C(    0.0014), SIMDE_FLOAT32_C(   -0.0033), SIMDE_FLOAT32_C(    0.0018) } },
+    { { SIMDE_FLOAT32_C(  344.3000), SIMDE_FLOAT32_C(  766.5900), SIMDE_FLOAT32_C( -716.9900), SIMDE_FLOAT32_C(  274.5700),
+        SIMDE_FLOAT32_C( -808.2800), SIMDE_FLOAT32_C( -794.4600), SIMDE_FLOAT32_C(  -41.9900), SIMDE_FLOAT32_C( -686.1500),
+        SIMDE_FLOAT32_C( -415.2300), SIMDE_FLOAT32_C( -572.2300), SIMDE_FLOAT32_C(  351.6600), SIMDE_FLOAT32_C( -323.8200),
+        SIMDE_FLOAT32_C( -966.1200), SIMDE_FLOAT32_C(  502.9300), SIMDE_FLOAT32_C( -437.1000), SIMDE_FLOAT32_C(  939.3100) },
+      { SIMDE_FLOAT32_C(    0.0029), SIMDE_FLOAT32_C(    0.0013), SIMDE_FLOAT32_C(   -0.0014), SIMDE_FLOAT32_C(    0.0036),
+        SIMDE_FLOAT32_C(   -0.0012), SIMDE_FLOAT32_C(   -0.0013), SIMDE_FLOAT32_C(   -0.0238), SIMDE_FLOAT32_C(   -0.0015),
+        SIMDE_FLOAT32_C(   -0.0024), SIMDE_FLOAT32_C(   -0.0017), SIMDE_FLOAT32_C(    0.0028), SIMDE_FLOAT32_C(   -0.0031),
+        SIMDE_FLOAT32_C(   -0.0010), SIMDE_FLOAT32_C(    0.0020), SIMDE_FLOAT32_C(   -0.0023), SIMDE_FLOAT32_C(    0.0011) } },
+    { { SIMDE_FLOAT32_C(  196.7200), SIMDE_FLOAT32_C( -949.3400), SIMDE_FLOAT32_C(  962.8900), SIMDE_FLOAT32_C( -983.9800),
+        SIMDE_FLOAT32_C( -528.2800), SIMDE_FLOAT32_C(  666.3500), SIMDE_FLOAT32_C(  771.6700), SIMDE_FLOAT32_C( -875.6900),
+        SIMDE_FLOAT32_C(   75.0100), SIMDE_FLOAT32_C( -581.8300), SIMDE_FLOAT32_C(  704.2800), SIMDE_FLOAT32_C( -152.4400),
+        SIMDE_FLOAT32_C( -855.2200), SIMDE_FLOAT32_C(  826.1300), SIMDE_FLOAT32_C( -280.0100), SIMDE_FLOAT32_C( -482.8000) },
+      { SIMDE_FLOAT32_C(    0.0051), SIMDE_FLOAT32_C(   -0.0011), SIMDE_FLOAT32_C(    0.0010), SIMDE_FLOAT32_C(   -0.0010),
+        SIMDE_FLOAT32_C(   -0.0019), SIMDE_FLOAT32_C(    0.0015), SIMDE_FLOAT32_C(    0.0013), SIMDE_FLOAT32_C(   -0.0011),
+        SIMDE_FLOAT32_C(    0.0133), SIMDE_FLOAT32_C(   -0.0017), SIMDE_FLOAT32_C(    0.0014), SIMDE_FLOAT32_C(   -0.0066),
+        SIMDE_FLOAT32_C(   -0.0012), SIMDE_FLOAT32_C(    0.0012), SIMDE_FLOAT32_C(   -0.0036), SIMDE_FLOAT32_C(   -0.0021) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_rcp14_ps(a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_rcp14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[16];
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  959.4500), SIMDE_FLOAT32_C(  203.8000), SIMDE_FLOAT32_C( -787.3300), SIMDE_FLOAT32_C(   -5.7200),
+        SIMDE_FLOAT32_C( -553.2400), SIMDE_FLOAT32_C(  596.5300), SIMDE_FLOAT32_C(  468.2200), SIMDE_FLOAT32_C( -653.4600),
+        SIMDE_FLOAT32_C( -958.8600), SIMDE_FLOAT32_C( -271.1100), SIMDE_FLOAT32_C( -510.6000), SIMDE_FLOAT32_C( -368.2900),
+        SIMDE_FLOAT32_C( -901.4400), SIMDE_FLOAT32_C(  611.8400), SIMDE_FLOAT32_C( -859.3200), SIMDE_FLOAT32_C(   37.5200) },
+      UINT16_C(60617),
+      { SIMDE_FLOAT32_C( -934.5800), SIMDE_FLOAT32_C(  452.9600), SIMDE_FLOAT32_C(  446.9700), SIMDE_FLOAT32_C( -381.3200),
+        SIMDE_FLOAT32_C( -913.1200), SIMDE_FLOAT32_C( -527.8400), SIMDE_FLOAT32_C(  -98.6600), SIMDE_FLOAT32_C(  330.9500),
+        SIMDE_FLOAT32_C(  -33.9300), SIMDE_FLOAT32_C( -296.4000), SIMDE_FLOAT32_C(  468.8600), SIMDE_FLOAT32_C( -534.1800),
+        SIMDE_FLOAT32_C( -497.0600), SIMDE_FLOAT32_C( -294.9200), SIMDE_FLOAT32_C(  731.9500), SIMDE_FLOAT32_C( -511.8000) },
+      { SIMDE_FLOAT32_C(   -0.0011), SIMDE_FLOAT32_C(  203.8000), SIMDE_FLOAT32_C( -787.3300), SIMDE_FLOAT32_C(   -0.0026),
+        SIMDE_FLOAT32_C( -553.2400), SIMDE_FLOAT32_C(  596.5300), SIMDE_FLOAT32_C(   -0.0101), SIMDE_FLOAT32_C(    0.0030),
+        SIMDE_FLOAT32_C( -958.8600), SIMDE_FLOAT32_C( -271.1100), SIMDE_FLOAT32_C(    0.0021), SIMDE_FLOAT32_C(   -0.0019),
+        SIMDE_FLOAT32_C( -901.4400), SIMDE_FLOAT32_C(   -0.0034), SIMDE_FLOAT32_C(    0.0014), SIMDE_FLOAT32_C(   -0.0020) } },
+    { { SIMDE_FLOAT32_C( -716.3000), SIMDE_FLOAT32_C(   -1.8500), SIMDE_FLOAT32_C( -328.0900), SIMDE_FLOAT32_C( -999.6100),
+        SIMDE_FLOAT32_C( -120.8100), SIMDE_FLOAT32_C( -280.2800), SIMDE_FLOAT32_C(  346.0200), SIMDE_FLOAT32_C( -648.7200),
+        SIMDE_FLOAT32_C(    0.6100), SIMDE_FLOAT32_C(  404.7600), SIMDE_FLOAT32_C(    0.7200), SIMDE_FLOAT32_C(  230.9500),
+        SIMDE_FLOAT32_C(  -71.3700), SIMDE_FLOAT32_C( -978.8800), SIMDE_FLOAT32_C( -887.4700), SIMDE_FLOAT32_C( -422.6200) },
+      UINT16_C( 6598),
+      { SIMDE_FLOAT32_C(  -86.5900), SIMDE_FLOAT32_C( -398.0800), SIMDE_FLOAT32_C( -428.8800), SIMDE_FLOAT32_C( -343.8200),
+        SIMDE_FLOAT32_C(  266.6600), SIMDE_FLOAT32_C( -445.5000), SIMDE_FLOAT32_C( -570.2400), SIMDE_FLOAT32_C(  502.8000),
+        SIMDE_FLOAT32_C(  970.0400), SIMDE_FLOAT32_C(  872.4400), SIMDE_FLOAT32_C(  901.1900), SIMDE_FLOAT32_C(  521.2400),
+        SIMDE_FLOAT32_C( -760.3100), SIMDE_FLOAT32_C(  116.3300), SIMDE_FLOAT32_C(  461.5200), SIMDE_FLOAT32_C(  715.6100) },
+      { SIMDE_FLOAT32_C( -716.3000), SIMDE_FLOAT32_C(   -0.0025), SIMDE_FLOAT32_C(   -0.0023), SIMDE_FLOAT32_C( -999.6100),
+        SIMDE_FLOAT32_C( -120.8100), SIMDE_FLOAT32_C( -280.2800), SIMDE_FLOAT32_C(   -0.0018), SIMDE_FLOAT32_C(    0.0020),
+        SIMDE_FLOAT32_C(    0.0010), SIMDE_FLOAT32_C(  404.7600), SIMDE_FLOAT32_C(    0.7200), SIMDE_FLOAT32_C(    0.0019),
+        SIMDE_FLOAT32_C(   -0.0013), SIMDE_FLOAT32_C( -978.8800), SIMDE_FLOAT32_C( -887.4700), SIMDE_FLOAT32_C( -422.6200) } },
+    { { SIMDE_FLOAT32_C( -322.0800), SIMDE_FLOAT32_C(  160.1000), SIMDE_FLOAT32_C( -924.8800), SIMDE_FLOAT32_C(  910.5200),
+        SIMDE_FLOAT32_C( -161.2000), SIMDE_FLOAT32_C( -167.5400), SIMDE_FLOAT32_C( -680.8300), SIMDE_FLOAT32_C(  948.2100),
+        SIMDE_FLOAT32_C( -114.1600), SIMDE_FLOAT32_C(  408.2500), SIMDE_FLOAT32_C(  268.9500), SIMDE_FLOAT32_C( -714.2800),
+        SIMDE_FLOAT32_C(  179.3700), SIMDE_FLOAT32_C(  749.5600), SIMDE_FLOAT32_C( -766.1700), SIMDE_FLOAT32_C(  330.2400) },
+      UINT16_C(22107),
+      { SIMDE_FLOAT32_C( -331.0500), SIMDE_FLOAT32_C(  156.4600), SIMDE_FLOAT32_C(  102.6100), SIMDE_FLOAT32_C(  590.5800),
+        SIMDE_FLOAT32_C( -654.8800), SIMDE_FLOAT32_C(  847.7500), SIMDE_FLOAT32_C( -474.7500), SIMDE_FLOAT32_C( -348.3600),
+        SIMDE_FLOAT32_C(  610.0500), SIMDE_FLOAT32_C(  749.4900), SIMDE_FLOAT32_C( -318.1900), SIMDE_FLOAT32_C( -534.8200),
+        SIMDE_FLOAT32_C(  943.9900), SIMDE_FLOAT32_C( -342.4900), SIMDE_FLOAT32_C( -809.5200), SIMDE_FLOAT32_C( -615.1100) },
+      { SIMDE_FLOAT32_C(   -0.0030), SIMDE_FLOAT32_C(    0.0064), SIMDE_FLOAT32_C( -924.8800), SIMDE_FLOAT32_C(    0.0017),
+        SIMDE_FLOAT32_C(   -0.0015), SIMDE_FLOAT32_C( -167.5400), SIMDE_FLOAT32_C(   -0.0021), SIMDE_FLOAT32_C(  948.2100),
+        SIMDE_FLOAT32_C( -114.1600), SIMDE_FLOAT32_C(    0.0013), SIMDE_FLOAT32_C(   -0.0031), SIMDE_FLOAT32_C( -714.2800),
+        SIMDE_FLOAT32_C(    0.0011), SIMDE_FLOAT32_C(  749.5600), SIMDE_FLOAT32_C(   -0.0012), SIMDE_FLOAT32_C(  330.2400) } },
+    { { SIMDE_FLOAT32_C( -628.1300), SIMDE_FLOAT32_C(   12.9700), SIMDE_FLOAT32_C(  579.5100), SIMDE_FLOAT32_C(  372.0900),
+        SIMDE_FLOAT32_C( -167.5700), SIMDE_FLOAT32_C(  534.4500), SIMDE_FLOAT32_C( -419.5000), SIMDE_FLOAT32_C(  723.3100),
+        SIMDE_FLOAT32_C(  629.7700), SIMDE_FLOAT32_C( -192.6600), SIMDE_FLOAT32_C(  461.3300), SIMDE_FLOAT32_C(  818.0500),
+        SIMDE_FLOAT32_C(    0.9400), SIMDE_FLOAT32_C( -603.4800), SIMDE_FLOAT32_C( -752.0800), SIMDE_FLOAT32_C(  785.3400) },
+      UINT16_C(10550),
+      { SIMDE_FLOAT32_C(  981.0300), SIMDE_FLOAT32_C( -540.3900), SIMDE_FLOAT32_C(  -41.0800), SIMDE_FLOAT32_C(   95.1900),
+        SIMDE_FLOAT32_C( -170.3500), SIMDE_FLOAT32_C(  379.0400), SIMDE_FLOAT32_C(  702.4200), SIMDE_FLOAT32_C(  865.2000),
+        SIMDE_FLOAT32_C( -259.6300), SIMDE_FLOAT32_C(  717.9600), SIMDE_FLOAT32_C(  284.0200), SIMDE_FLOAT32_C( -901.3500),
+        SIMDE_FLOAT32_C( -929.0500), SIMDE_FLOAT32_C( -762.5100), SIMDE_FLOAT32_C(  330.7700), SIMDE_FLOAT32_C(  478.1400) },
+      { SIMDE_FLOAT32_C( -628.1300), SIMDE_FLOAT32_C(   -0.0019), SIMDE_FLOAT32_C(   -0.0243), SIMDE_FLOAT32_C(  372.0900),
+        SIMDE_FLOAT32_C(   -0.0059), SIMDE_FLOAT32_C(    0.0026), SIMDE_FLOAT32_C( -419.5000), SIMDE_FLOAT32_C(  723.3100),
+        SIMDE_FLOAT32_C(   -0.0039), SIMDE_FLOAT32_C( -192.6600), SIMDE_FLOAT32_C(  461.3300), SIMDE_FLOAT32_C(   -0.0011),
+        SIMDE_FLOAT32_C(    0.9400), SIMDE_FLOAT32_C(   -0.0013), SIMDE_FLOAT32_C( -752.0800), SIMDE_FLOAT32_C(  785.3400) } },
+    { { SIMDE_FLOAT32_C( -308.6000), SIMDE_FLOAT32_C( -441.7700), SIMDE_FLOAT32_C(  250.2700), SIMDE_FLOAT32_C(  673.4200),
+        SIMDE_FLOAT32_C( -525.9600), SIMDE_FLOAT32_C( -252.3800), SIMDE_FLOAT32_C(  282.5600), SIMDE_FLOAT32_C(  774.0900),
+        SIMDE_FLOAT32_C( -908.0100), SIMDE_FLOAT32_C( -724.8100), SIMDE_FLOAT32_C(  867.6400), SIMDE_FLOAT32_C(  734.8600),
+        SIMDE_FLOAT32_C( -826.6200), SIMDE_FLOAT32_C( -235.9700), SIMDE_FLOAT32_C(  659.0600), SIMDE_FLOAT32_C(  171.6400) },
+      UINT16_C(51616),
+      { SIMDE_FLOAT32_C(  900.4600), SIMDE_FLOAT32_C( -352.3300), SIMDE_FLOAT32_C( -338.3100), SIMDE_FLOAT32_C(  423.9900),
+        SIMDE_FLOAT32_C( -372.6800), SIMDE_FLOAT32_C(  471.8000), SIMDE_FLOAT32_C( -216.4400), SIMDE_FLOAT32_C( -276.5900),
+        SIMDE_FLOAT32_C( -453.6100), SIMDE_FLOAT32_C(  243.3600), SIMDE_FLOAT32_C(  579.3800), SIMDE_FLOAT32_C( -924.9300),
+        SIMDE_FLOAT32_C( -408.4000), SIMDE_FLOAT32_C(  -31.1800), SIMDE_FLOAT32_C(  502.8600), SIMDE_FLOAT32_C( -886.7400) },
+      { SIMDE_FLOAT32_C( -308.6000), SIMDE_FLOAT32_C( -441.7700), SIMDE_FLOAT32_C(  250.2700), SIMDE_FLOAT32_C(  673.4200),
+        SIMDE_FLOAT32_C( -525.9600), SIMDE_FLOAT32_C(    0.0021), SIMDE_FLOAT32_C(  282.5600), SIMDE_FLOAT32_C(   -0.0036),
+        SIMDE_FLOAT32_C(   -0.0022), SIMDE_FLOAT32_C( -724.8100), SIMDE_FLOAT32_C(  867.6400), SIMDE_FLOAT32_C(   -0.0011),
+        SIMDE_FLOAT32_C( -826.6200), SIMDE_FLOAT32_C( -235.9700), SIMDE_FLOAT32_C(    0.0020), SIMDE_FLOAT32_C(   -0.0011) } },
+    { { SIMDE_FLOAT32_C(  340.4400), SIMDE_FLOAT32_C(  581.2100), SIMDE_FLOAT32_C( -774.4300), SIMDE_FLOAT32_C( -605.6700),
+        SIMDE_FLOAT32_C(  165.1700), SIMDE_FLOAT32_C(  720.4200), SIMDE_FLOAT32_C( -107.1100), SIMDE_FLOAT32_C( -726.9100),
+        SIMDE_FLOAT32_C( -832.5500), SIMDE_FLOAT32_C(  564.1800), SIMDE_FLOAT32_C( -206.3400), SIMDE_FLOAT32_C(  403.9000),
+        SIMDE_FLOAT32_C( -378.3800), SIMDE_FLOAT32_C(  662.2400), SIMDE_FLOAT32_C( -103.2300), SIMDE_FLOAT32_C(  120.1700) },
+      UINT16_C(22833),
+      { SIMDE_FLOAT32_C( -497.9300), SIMDE_FLOAT32_C( -277.9800), SIMDE_FLOAT32_C( -481.7900), SIMDE_FLOAT32_C(  851.6900),
+        SIMDE_FLOAT32_C(  756.4300), SIMDE_FLOAT32_C(  866.6300), SIMDE_FLOAT32_C( -467.6200), SIMDE_FLOAT32_C( -814.2300),
+        SIMDE_FLOAT32_C(  296.4500), SIMDE_FLOAT32_C( -900.5500), SIMDE_FLOAT32_C( -264.4600), SIMDE_FLOAT32_C(  277.8700),
+        SIMDE_FLOAT32_C(  -32.7900), SIMDE_FLOAT32_C( -100.9200), SIMDE_FLOAT32_C( -761.7000), SIMDE_FLOAT32_C(  687.7100) },
+      { SIMDE_FLOAT32_C(   -0.0020), SIMDE_FLOAT32_C(  581.2100), SIMDE_FLOAT32_C( -774.4300), SIMDE_FLOAT32_C( -605.6700),
+        SIMDE_FLOAT32_C(    0.0013), SIMDE_FLOAT32_C(    0.0012), SIMDE_FLOAT32_C( -107.1100), SIMDE_FLOAT32_C( -726.9100),
+        SIMDE_FLOAT32_C(    0.0034), SIMDE_FLOAT32_C(  564.1800), SIMDE_FLOAT32_C( -206.3400), SIMDE_FLOAT32_C(    0.0036),
+        SIMDE_FLOAT32_C(   -0.0305), SIMDE_FLOAT32_C(  662.2400), SIMDE_FLOAT32_C(   -0.0013), SIMDE_FLOAT32_C(  120.1700) } },
+    { { SIMDE_FLOAT32_C( -827.8600), SIMDE_FLOAT32_C( -215.8000), SIMDE_FLOAT32_C( -842.9900), SIMDE_FLOAT32_C(  796.8500),
+        SIMDE_FLOAT32_C(  618.3800), SIMDE_FLOAT32_C( -638.1500), SIMDE_FLOAT32_C( -394.7800), SIMDE_FLOAT32_C(  169.8300),
+        SIMDE_FLOAT32_C( -311.0900), SIMDE_FLOAT32_C(  166.0400), SIMDE_FLOAT32_C(  292.2900), SIMDE_FLOAT32_C(  185.4300),
+        SIMDE_FLOAT32_C(  826.5600), SIMDE_FLOAT32_C( -475.0700), SIMDE_FLOAT32_C( -356.5000), SIMDE_FLOAT32_C(  584.8300) },
+      UINT16_C( 9198),
+      { SIMDE_FLOAT32_C( -444.0100), SIMDE_FLOAT32_C( -263.9100), SIMDE_FLOAT32_C(   39.2400), SIMDE_FLOAT32_C( -929.6000),
+        SIMDE_FLOAT32_C(  923.6500), SIMDE_FLOAT32_C( -551.5000), SIMDE_FLOAT32_C( -589.6900), SIMDE_FLOAT32_C(  906.2700),
+        SIMDE_FLOAT32_C(  -71.3300), SIMDE_FLOAT32_C( -419.7300), SIMDE_FLOAT32_C(  974.2200), SIMDE_FLOAT32_C( -965.8700),
+        SIMDE_FLOAT32_C(  735.2800), SIMDE_FLOAT32_C( -511.8600), SIMDE_FLOAT32_C(  701.2600), SIMDE_FLOAT32_C(  -49.6000) },
+      { SIMDE_FLOAT32_C( -827.8600), SIMDE_FLOAT32_C(   -0.0038), SIMDE_FLOAT32_C(    0.0255), SIMDE_FLOAT32_C(   -0.0011),
+        SIMDE_FLOAT32_C(  618.3800), SIMDE_FLOAT32_C(   -0.0018), SIMDE_FLOAT32_C(   -0.0017), SIMDE_FLOAT32_C(    0.0011),
+        SIMDE_FLOAT32_C(   -0.0140), SIMDE_FLOAT32_C(   -0.0024), SIMDE_FLOAT32_C(  292.2900), SIMDE_FLOAT32_C(  185.4300),
+        SIMDE_FLOAT32_C(  826.5600), SIMDE_FLOAT32_C(   -0.0020), SIMDE_FLOAT32_C( -356.5000), SIMDE_FLOAT32_C(  584.8300) } },
+    { { SIMDE_FLOAT32_C( -492.8000), SIMDE_FLOAT32_C(  243.6100), SIMDE_FLOAT32_C(  802.3800), SIMDE_FLOAT32_C(  826.7000),
+        SIMDE_FLOAT32_C( -723.6300), SIMDE_FLOAT32_C(  785.2500), SIMDE_FLOAT32_C(  979.9500), SIMDE_FLOAT32_C( -508.3000),
+        SIMDE_FLOAT32_C(  -75.4700), SIMDE_FLOAT32_C(  233.8100), SIMDE_FLOAT32_C( -757.3800), SIMDE_FLOAT32_C( -375.1300),
+        SIMDE_FLOAT32_C(  303.9000), SIMDE_FLOAT32_C( -736.5700), SIMDE_FLOAT32_C( -202.4200), SIMDE_FLOAT32_C(  230.9400) },
+      UINT16_C(42190),
+      { SIMDE_FLOAT32_C(  364.0900), SIMDE_FLOAT32_C( -385.1000), SIMDE_FLOAT32_C(  241.1400), SIMDE_FLOAT32_C(   52.2800),
+        SIMDE_FLOAT32_C( -539.9000), SIMDE_FLOAT32_C( -363.8900), SIMDE_FLOAT32_C( -545.6900), SIMDE_FLOAT32_C( -899.7700),
+        SIMDE_FLOAT32_C( -946.2200), SIMDE_FLOAT32_C(  337.1300), SIMDE_FLOAT32_C(  873.8500), SIMDE_FLOAT32_C(  -35.8100),
+        SIMDE_FLOAT32_C( -186.0200), SIMDE_FLOAT32_C(   26.8500), SIMDE_FLOAT32_C(  538.9900), SIMDE_FLOAT32_C( -196.9900) },
+      { SIMDE_FLOAT32_C( -492.8000), SIMDE_FLOAT32_C(   -0.0026), SIMDE_FLOAT32_C(    0.0041), SIMDE_FLOAT32_C(    0.0191),
+        SIMDE_FLOAT32_C( -723.6300), SIMDE_FLOAT32_C(  785.2500), SIMDE_FLOAT32_C(   -0.0018), SIMDE_FLOAT32_C(   -0.0011),
+        SIMDE_FLOAT32_C(  -75.4700), SIMDE_FLOAT32_C(  233.8100), SIMDE_FLOAT32_C(    0.0011), SIMDE_FLOAT32_C( -375.1300),
+        SIMDE_FLOAT32_C(  303.9000), SIMDE_FLOAT32_C(    0.0372), SIMDE_FLOAT32_C( -202.4200), SIMDE_FLOAT32_C(   -0.0051) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 src = simde_mm512_loadu_ps(test_vec[i].src);
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_mask_rcp14_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_rcp14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { UINT16_C(61167),
+      { SIMDE_FLOAT32_C( -907.2100), SIMDE_FLOAT32_C(  137.4000), SIMDE_FLOAT32_C(  177.5500), SIMDE_FLOAT32_C( -768.1100),
+        SIMDE_FLOAT32_C(  432.6100), SIMDE_FLOAT32_C( -796.9400), SIMDE_FLOAT32_C( -737.9900), SIMDE_FLOAT32_C( -749.8000),
+        SIMDE_FLOAT32_C( -367.2300), SIMDE_FLOAT32_C(   16.8900), SIMDE_FLOAT32_C(   86.3900), SIMDE_FLOAT32_C(  864.2700),
+        SIMDE_FLOAT32_C(    4.1400), SIMDE_FLOAT32_C( -327.2400), SIMDE_FLOAT32_C( -908.8100), SIMDE_FLOAT32_C(  393.4000) },
+      { SIMDE_FLOAT32_C(   -0.0011), SIMDE_FLOAT32_C(    0.0073), SIMDE_FLOAT32_C(    0.0056), SIMDE_FLOAT32_C(   -0.0013),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0013), SIMDE_FLOAT32_C(   -0.0014), SIMDE_FLOAT32_C(   -0.0013),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0592), SIMDE_FLOAT32_C(    0.0116), SIMDE_FLOAT32_C(    0.0012),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0031), SIMDE_FLOAT32_C(   -0.0011), SIMDE_FLOAT32_C(    0.0025) } },
+    { UINT16_C(18793),
+      { SIMDE_FLOAT32_C( -467.2700), SIMDE_FLOAT32_C( -482.2900), SIMDE_FLOAT32_C( -987.5200), SIMDE_FLOAT32_C( -847.4300),
+        SIMDE_FLOAT32_C(  801.3700), SIMDE_FLOAT32_C(  858.8100), SIMDE_FLOAT32_C( -622.2500), SIMDE_FLOAT32_C( -557.1500),
+        SIMDE_FLOAT32_C( -702.2700), SIMDE_FLOAT32_C( -254.0900), SIMDE_FLOAT32_C(  878.5500), SIMDE_FLOAT32_C(  514.1700),
+        SIMDE_FLOAT32_C(   78.1700), SIMDE_FLOAT32_C( -502.8100), SIMDE_FLOAT32_C( -415.0200), SIMDE_FLOAT32_C( -170.6900) },
+      { SIMDE_FLOAT32_C(   -0.0021), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0012),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0012), SIMDE_FLOAT32_C(   -0.0016), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(   -0.0014), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0019),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0024), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT16_C( 1694),
+      { SIMDE_FLOAT32_C(  786.9100), SIMDE_FLOAT32_C(  989.8400), SIMDE_FLOAT32_C(  819.3300), SIMDE_FLOAT32_C( -645.0400),
+        SIMDE_FLOAT32_C( -160.0400), SIMDE_FLOAT32_C(  230.0600), SIMDE_FLOAT32_C(  291.9400), SIMDE_FLOAT32_C( -551.7000),
+        SIMDE_FLOAT32_C(  447.0000), SIMDE_FLOAT32_C(   42.0400), SIMDE_FLOAT32_C( -571.9400), SIMDE_FLOAT32_C(  268.7300),
+        SIMDE_FLOAT32_C( -701.6000), SIMDE_FLOAT32_C(  195.3000), SIMDE_FLOAT32_C(  573.5800), SIMDE_FLOAT32_C( -928.7900) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0010), SIMDE_FLOAT32_C(    0.0012), SIMDE_FLOAT32_C(   -0.0016),
+        SIMDE_FLOAT32_C(   -0.0062), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0018),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0238), SIMDE_FLOAT32_C(   -0.0017), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT16_C(35973),
+      { SIMDE_FLOAT32_C(   43.9500), SIMDE_FLOAT32_C(  400.4800), SIMDE_FLOAT32_C(  716.3900), SIMDE_FLOAT32_C(  243.1800),
+        SIMDE_FLOAT32_C(  743.4800), SIMDE_FLOAT32_C(  -90.8400), SIMDE_FLOAT32_C(  351.9200), SIMDE_FLOAT32_C( -589.9200),
+        SIMDE_FLOAT32_C( -137.3800), SIMDE_FLOAT32_C(  273.2100), SIMDE_FLOAT32_C(  240.9100), SIMDE_FLOAT32_C(  243.8100),
+        SIMDE_FLOAT32_C(   38.2400), SIMDE_FLOAT32_C( -636.1300), SIMDE_FLOAT32_C(  611.0300), SIMDE_FLOAT32_C( -888.6400) },
+      { SIMDE_FLOAT32_C(    0.0228), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0014), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0017),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0042), SIMDE_FLOAT32_C(    0.0041),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0011) } },
+    { UINT16_C( 3745),
+      { SIMDE_FLOAT32_C(  927.8900), SIMDE_FLOAT32_C( -562.5200), SIMDE_FLOAT32_C(  539.1600), SIMDE_FLOAT32_C(   69.4800),
+        SIMDE_FLOAT32_C( -516.2600), SIMDE_FLOAT32_C( -591.5000), SIMDE_FLOAT32_C( -343.2300), SIMDE_FLOAT32_C( -430.6000),
+        SIMDE_FLOAT32_C(  444.0500), SIMDE_FLOAT32_C( -592.0100), SIMDE_FLOAT32_C( -622.7400), SIMDE_FLOAT32_C( -316.4200),
+        SIMDE_FLOAT32_C( -862.3100), SIMDE_FLOAT32_C(    3.7700), SIMDE_FLOAT32_C(  446.0600), SIMDE_FLOAT32_C(  216.1900) },
+      { SIMDE_FLOAT32_C(    0.0011), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0017), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0023),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0017), SIMDE_FLOAT32_C(   -0.0016), SIMDE_FLOAT32_C(   -0.0032),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT16_C( 8230),
+      { SIMDE_FLOAT32_C( -711.6100), SIMDE_FLOAT32_C(  795.5200), SIMDE_FLOAT32_C(  579.2400), SIMDE_FLOAT32_C( -557.3000),
+        SIMDE_FLOAT32_C(  523.2700), SIMDE_FLOAT32_C(  266.7600), SIMDE_FLOAT32_C(  312.1100), SIMDE_FLOAT32_C(  165.4000),
+        SIMDE_FLOAT32_C( -311.7500), SIMDE_FLOAT32_C(  523.1300), SIMDE_FLOAT32_C(  459.5800), SIMDE_FLOAT32_C(  102.4300),
+        SIMDE_FLOAT32_C(  806.1100), SIMDE_FLOAT32_C( -627.4200), SIMDE_FLOAT32_C(  410.6900), SIMDE_FLOAT32_C(  913.5100) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0013), SIMDE_FLOAT32_C(    0.0017), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0037), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0016), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT16_C(20815),
+      { SIMDE_FLOAT32_C(  765.6000), SIMDE_FLOAT32_C( -416.1100), SIMDE_FLOAT32_C( -482.2000), SIMDE_FLOAT32_C(  134.1200),
+        SIMDE_FLOAT32_C(  238.5100), SIMDE_FLOAT32_C( -946.6100), SIMDE_FLOAT32_C(  -81.2000), SIMDE_FLOAT32_C( -109.8600),
+        SIMDE_FLOAT32_C( -946.0400), SIMDE_FLOAT32_C( -568.9000), SIMDE_FLOAT32_C( -311.0800), SIMDE_FLOAT32_C( -201.4800),
+        SIMDE_FLOAT32_C( -296.7100), SIMDE_FLOAT32_C(  364.7100), SIMDE_FLOAT32_C(  682.2500), SIMDE_FLOAT32_C( -372.8600) },
+      { SIMDE_FLOAT32_C(    0.0013), SIMDE_FLOAT32_C(   -0.0024), SIMDE_FLOAT32_C(   -0.0021), SIMDE_FLOAT32_C(    0.0075),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0123), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(   -0.0011), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(   -0.0034), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0015), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT16_C(23583),
+      { SIMDE_FLOAT32_C( -173.9100), SIMDE_FLOAT32_C(  232.1500), SIMDE_FLOAT32_C( -839.8900), SIMDE_FLOAT32_C(  291.6000),
+        SIMDE_FLOAT32_C(  582.1400), SIMDE_FLOAT32_C( -947.7400), SIMDE_FLOAT32_C(  -57.4700), SIMDE_FLOAT32_C(  488.5900),
+        SIMDE_FLOAT32_C(  442.7200), SIMDE_FLOAT32_C( -309.1400), SIMDE_FLOAT32_C( -112.7400), SIMDE_FLOAT32_C( -535.7600),
+        SIMDE_FLOAT32_C(  896.4200), SIMDE_FLOAT32_C(  985.1200), SIMDE_FLOAT32_C( -577.7000), SIMDE_FLOAT32_C(  -29.6500) },
+      { SIMDE_FLOAT32_C(   -0.0058), SIMDE_FLOAT32_C(    0.0043), SIMDE_FLOAT32_C(   -0.0012), SIMDE_FLOAT32_C(    0.0034),
+        SIMDE_FLOAT32_C(    0.0017), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0089), SIMDE_FLOAT32_C(   -0.0019),
+        SIMDE_FLOAT32_C(    0.0011), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0017), SIMDE_FLOAT32_C(    0.0000) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_maskz_rcp14_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_rcp14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  231.6700), SIMDE_FLOAT64_C( -180.6800), SIMDE_FLOAT64_C(  687.7800), SIMDE_FLOAT64_C(  -34.5700),
+        SIMDE_FLOAT64_C(  968.2200), SIMDE_FLOAT64_C( -881.7900), SIMDE_FLOAT64_C( -382.1500), SIMDE_FLOAT64_C(  339.4100) },
+      { SIMDE_FLOAT64_C(    0.0043), SIMDE_FLOAT64_C(   -0.0055), SIMDE_FLOAT64_C(    0.0015), SIMDE_FLOAT64_C(   -0.0289),
+        SIMDE_FLOAT64_C(    0.0010), SIMDE_FLOAT64_C(   -0.0011), SIMDE_FLOAT64_C(   -0.0026), SIMDE_FLOAT64_C(    0.0029) } },
+    { { SIMDE_FLOAT64_C(  764.3200), SIMDE_FLOAT64_C(  -19.5200), SIMDE_FLOAT64_C( -163.6100), SIMDE_FLOAT64_C(  272.1700),
+        SIMDE_FLOAT64_C(  101.4400), SIMDE_FLOAT64_C(  152.1600), SIMDE_FLOAT64_C(  -59.5100), SIMDE_FLOAT64_C(  127.5200) },
+      { SIMDE_FLOAT64_C(    0.0013), SIMDE_FLOAT64_C(   -0.0512), SIMDE_FLOAT64_C(   -0.0061), SIMDE_FLOAT64_C(    0.0037),
+        SIMDE_FLOAT64_C(    0.0099), SIMDE_FLOAT64_C(    0.0066), SIMDE_FLOAT64_C(   -0.0168), SIMDE_FLOAT64_C(    0.0078) } },
+    { { SIMDE_FLOAT64_C( -992.0300), SIMDE_FLOAT64_C(  162.3700), SIMDE_FLOAT64_C( -239.9000), SIMDE_FLOAT64_C(  456.2100),
+        SIMDE_FLOAT64_C( -635.2100), SIMDE_FLOAT64_C(  759.8200), SIMDE_FLOAT64_C(  134.8300), SIMDE_FLOAT64_C( -191.4100) },
+      { SIMDE_FLOAT64_C(   -0.0010), SIMDE_FLOAT64_C(    0.0062), SIMDE_FLOAT64_C(   -0.0042), SIMDE_FLOAT64_C(    0.0022),
+        SIMDE_FLOAT64_C(   -0.0016), SIMDE_FLOAT64_C(    0.0013), SIMDE_FLOAT64_C(    0.0074), SIMDE_FLOAT64_C(   -0.0052) } },
+    { { SIMDE_FLOAT64_C(  866.2500), SIMDE_FLOAT64_C(  332.2700), SIMDE_FLOAT64_C(  968.6600), SIMDE_FLOAT64_C( -168.7100),
+        SIMDE_FLOAT64_C(  629.6700), SIMDE_FLOAT64_C( -298.1300), SIMDE_FLOAT64_C( -666.3700), SIMDE_FLOAT64_C(  646.2100) },
+      { SIMDE_FLOAT64_C(    0.0012), SIMDE_FLOAT64_C(    0.0030), SIMDE_FLOAT64_C(    0.0010), SIMDE_FLOAT64_C(   -0.0059),
+        SIMDE_FLOAT64_C(    0.0016), SIMDE_FLOAT64_C(   -0.0034), SIMDE_FLOAT64_C(   -0.0015), SIMDE_FLOAT64_C(    0.0015) } },
+    { { SIMDE_FLOAT64_C( -264.7600), SIMDE_FLOAT64_C(   87.7400), SIMDE_FLOAT64_C( -679.0000), SIMDE_FLOAT64_C( -789.0400),
+        SIMDE_FLOAT64_C(  840.6000), SIMDE_FLOAT64_C(  832.0800), SIMDE_FLOAT64_C(  909.9700), SIMDE_FLOAT64_C(  492.0700) },
+      { SIMDE_FLOAT64_C(   -0.0038), SIMDE_FLOAT64_C(    0.0114), SIMDE_FLOAT64_C(   -0.0015), SIMDE_FLOAT64_C(   -0.0013),
+        SIMDE_FLOAT64_C(    0.0012), SIMDE_FLOAT64_C(    0.0012), SIMDE_FLOAT64_C(    0.0011), SIMDE_FLOAT64_C(    0.0020) } },
+    { { SIMDE_FLOAT64_C( -888.8700), SIMDE_FLOAT64_C(  522.8000), SIMDE_FLOAT64_C( -991.3800), SIMDE_FLOAT64_C( -581.5000),
+        SIMDE_FLOAT64_C(  924.5000), SIMDE_FLOAT64_C( -387.2900), SIMDE_FLOAT64_C( -512.0500), SIMDE_FLOAT64_C( -482.1500) },
+      { SIMDE_FLOAT64_C(   -0.0011), SIMDE_FLOAT64_C(    0.0019), SIMDE_FLOAT64_C(   -0.0010), SIMDE_FLOAT64_C(   -0.0017),
+        SIMDE_FLOAT64_C(    0.0011), SIMDE_FLOAT64_C(   -0.0026), SIMDE_FLOAT64_C(   -0.0020), SIMDE_FLOAT64_C(   -0.0021) } },
+    { { SIMDE_FLOAT64_C(  261.2200), SIMDE_FLOAT64_C(  600.8600), SIMDE_FLOAT64_C( -817.1100), SIMDE_FLOAT64_C( -888.9300),
+        SIMDE_FLOAT64_C( -773.9600), SIMDE_FLOAT64_C(  334.2000), SIMDE_FLOAT64_C(  122.7100), SIMDE_FLOAT64_C(   13.6300) },
+      { SIMDE_FLOAT64_C(    0.0038), SIMDE_FLOAT64_C(    0.0017), SIMDE_FLOAT64_C(   -0.0012), SIMDE_FLOAT64_C(   -0.0011),
+        SIMDE_FLOAT64_C(   -0.0013), SIMDE_FLOAT64_C(    0.0030), SIMDE_FLOAT64_C(    0.0081), SIMDE_FLOAT64_C(    0.0734) } },
+    { { SIMDE_FLOAT64_C( -460.7800), SIMDE_FLOAT64_C(  358.2800), SIMDE_FLOAT64_C(   93.1500), SIMDE_FLOAT64_C(   48.9400),
+        SIMDE_FLOAT64_C(  430.4100), SIMDE_FLOAT64_C( -125.1100), SIMDE_FLOAT64_C(  688.7700), SIMDE_FLOAT64_C( -803.8200) },
+      { SIMDE_FLOAT64_C(   -0.0022), SIMDE_FLOAT64_C(    0.0028), SIMDE_FLOAT64_C(    0.0107), SIMDE_FLOAT64_C(    0.0204),
+        SIMDE_FLOAT64_C(    0.0023), SIMDE_FLOAT64_C(   -0.0080), SIMDE_FLOAT64_C(    0.0015), SIMDE_FLOAT64_C(   -0.0012) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_rcp14_pd(a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_rcp14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[8];
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  563.7500), SIMDE_FLOAT64_C( -805.5300), SIMDE_FLOAT64_C( -790.1500), SIMDE_FLOAT64_C( -497.1500),
+        SIMDE_FLOAT64_C(  917.9500), SIMDE_FLOAT64_C( -180.0000), SIMDE_FLOAT64_C(  913.9500), SIMDE_FLOAT64_C( -656.0100) },
+      UINT8_C( 98),
+      { SIMDE_FLOAT64_C(  554.1300), SIMDE_FLOAT64_C(  983.6200), SIMDE_FLOAT64_C(  779.7000), SIMDE_FLOAT64_C( -220.9500),
+        SIMDE_FLOAT64_C( -174.7600), SIMDE_FLOAT64_C(  114.2900), SIMDE_FLOAT64_C(  709.5400), SIMDE_FLOAT64_C(  856.8200) },
+      { SIMDE_FLOAT64_C(  563.7500), SIMDE_FLOAT64_C(    0.0010), SIMDE_FLOAT64_C( -790.1500), SIMDE_FLOAT64_C( -497.1500),
+        SIMDE_FLOAT64_C(  917.9500), SIMDE_FLOAT64_C(    0.0087), SIMDE_FLOAT64_C(    0.0014), SIMDE_FLOAT64_C( -656.0100) } },
+    { { SIMDE_FLOAT64_C( -120.2200), SIMDE_FLOAT64_C( -472.0600), SIMDE_FLOAT64_C( -941.7500), SIMDE_FLOAT64_C( -343.4600),
+        SIMDE_FLOAT64_C( -392.4300), SIMDE_FLOAT64_C( -195.0400), SIMDE_FLOAT64_C( -805.6400), SIMDE_FLOAT64_C( -802.5500) },
+      UINT8_C( 67),
+      { SIMDE_FLOAT64_C(  647.9100), SIMDE_FLOAT64_C( -272.3400), SIMDE_FLOAT64_C(  778.8900), SIMDE_FLOAT64_C( -912.3800),
+        SIMDE_FLOAT64_C( -356.6000), SIMDE_FLOAT64_C( -499.7100), SIMDE_FLOAT64_C(  862.1100), SIMDE_FLOAT64_C( -802.2800) },
+      { SIMDE_FLOAT64_C(    0.0015), SIMDE_FLOAT64_C(   -0.0037), SIMDE_FLOAT64_C( -941.7500), SIMDE_FLOAT64_C( -343.4600),
+        SIMDE_FLOAT64_C( -392.4300), SIMDE_FLOAT64_C( -195.0400), SIMDE_FLOAT64_C(    0.0012), SIMDE_FLOAT64_C( -802.5500) } },
+    { { SIMDE_FLOAT64_C( -525.7100), SIMDE_FLOAT64_C( -883.1100), SIMDE_FLOAT64_C(  510.5500), SIMDE_FLOAT64_C( -404.4100),
+        SIMDE_FLOAT64_C(  663.3700), SIMDE_FLOAT64_C( -206.7500), SIMDE_FLOAT64_C( -323.5300), SIMDE_FLOAT64_C(  459.0700) },
+      UINT8_C(193),
+      { SIMDE_FLOAT64_C(  196.2600), SIMDE_FLOAT64_C(  922.7100), SIMDE_FLOAT64_C(  105.2900), SIMDE_FLOAT64_C(  764.1900),
+        SIMDE_FLOAT64_C(  110.5100), SIMDE_FLOAT64_C(  544.2300), SIMDE_FLOAT64_C(  699.9100), SIMDE_FLOAT64_C(   12.7300) },
+      { SIMDE_FLOAT64_C(    0.0051), SIMDE_FLOAT64_C( -883.1100), SIMDE_FLOAT64_C(  510.5500), SIMDE_FLOAT64_C( -404.4100),
+        SIMDE_FLOAT64_C(  663.3700), SIMDE_FLOAT64_C( -206.7500), SIMDE_FLOAT64_C(    0.0014), SIMDE_FLOAT64_C(    0.0786) } },
+    { { SIMDE_FLOAT64_C( -695.1100), SIMDE_FLOAT64_C( -378.7800), SIMDE_FLOAT64_C(  533.9700), SIMDE_FLOAT64_C(  542.0900),
+        SIMDE_FLOAT64_C( -929.1400), SIMDE_FLOAT64_C(  669.4400), SIMDE_FLOAT64_C(  719.2800), SIMDE_FLOAT64_C( -671.2800) },
+      UINT8_C(191),
+      { SIMDE_FLOAT64_C(  564.1600), SIMDE_FLOAT64_C(  858.5900), SIMDE_FLOAT64_C(  738.4000), SIMDE_FLOAT64_C( -907.2000),
+        SIMDE_FLOAT64_C(   -5.2400), SIMDE_FLOAT64_C( -440.9000), SIMDE_FLOAT64_C( -839.3300), SIMDE_FLOAT64_C(  -15.5100) },
+      { SIMDE_FLOAT64_C(    0.0018), SIMDE_FLOAT64_C(    0.0012), SIMDE_FLOAT64_C(    0.0014), SIMDE_FLOAT64_C(   -0.0011),
+        SIMDE_FLOAT64_C(   -0.1908), SIMDE_FLOAT64_C(   -0.0023), SIMDE_FLOAT64_C(  719.2800), SIMDE_FLOAT64_C(   -0.0645) } },
+    { { SIMDE_FLOAT64_C(  523.4300), SIMDE_FLOAT64_C(  911.7100), SIMDE_FLOAT64_C( -166.6700), SIMDE_FLOAT64_C( -426.1500),
+        SIMDE_FLOAT64_C( -603.5900), SIMDE_FLOAT64_C( -308.5700), SIMDE_FLOAT64_C( -240.9400), SIMDE_FLOAT64_C(  400.4500) },
+      UINT8_C(104),
+      { SIMDE_FLOAT64_C(  954.4900), SIMDE_FLOAT64_C( -456.2000), SIMDE_FLOAT64_C(  147.6400), SIMDE_FLOAT64_C( -371.5000),
+        SIMDE_FLOAT64_C(  564.5800), SIMDE_FLOAT64_C(  528.1900), SIMDE_FLOAT64_C(  161.6300), SIMDE_FLOAT64_C( -944.1900) },
+      { SIMDE_FLOAT64_C(  523.4300), SIMDE_FLOAT64_C(  911.7100), SIMDE_FLOAT64_C( -166.6700), SIMDE_FLOAT64_C(   -0.0027),
+        SIMDE_FLOAT64_C( -603.5900), SIMDE_FLOAT64_C(    0.0019), SIMDE_FLOAT64_C(    0.0062), SIMDE_FLOAT64_C(  400.4500) } },
+    { { SIMDE_FLOAT64_C( -102.6000), SIMDE_FLOAT64_C( -227.3700), SIMDE_FLOAT64_C(  743.6900), SIMDE_FLOAT64_C( -192.9700),
+        SIMDE_FLOAT64_C(  397.0200), SIMDE_FLOAT64_C(  160.5800), SIMDE_FLOAT64_C( -789.3000), SIMDE_FLOAT64_C( -871.6000) },
+      UINT8_C( 81),
+      { SIMDE_FLOAT64_C(  656.6900), SIMDE_FLOAT64_C( -343.4000), SIMDE_FLOAT64_C( -603.7400), SIMDE_FLOAT64_C(  532.1800),
+        SIMDE_FLOAT64_C( -528.8600), SIMDE_FLOAT64_C( -277.5600), SIMDE_FLOAT64_C( -264.0000), SIMDE_FLOAT64_C(  390.8500) },
+      { SIMDE_FLOAT64_C(    0.0015), SIMDE_FLOAT64_C( -227.3700), SIMDE_FLOAT64_C(  743.6900), SIMDE_FLOAT64_C( -192.9700),
+        SIMDE_FLOAT64_C(   -0.0019), SIMDE_FLOAT64_C(  160.5800), SIMDE_FLOAT64_C(   -0.0038), SIMDE_FLOAT64_C( -871.6000) } },
+    { { SIMDE_FLOAT64_C( -809.9000), SIMDE_FLOAT64_C(  891.7000), SIMDE_FLOAT64_C(  907.7000), SIMDE_FLOAT64_C( -467.3600),
+        SIMDE_FLOAT64_C( -780.9400), SIMDE_FLOAT64_C(  736.4100), SIMDE_FLOAT64_C(  526.9700), SIMDE_FLOAT64_C(  206.2100) },
+      UINT8_C(198),
+      { SIMDE_FLOAT64_C( -263.5600), SIMDE_FLOAT64_C( -814.5000), SIMDE_FLOAT64_C(  464.2500), SIMDE_FLOAT64_C(  297.6700),
+        SIMDE_FLOAT64_C(  930.6300), SIMDE_FLOAT64_C( -709.6400), SIMDE_FLOAT64_C(  489.5300), SIMDE_FLOAT64_C(   21.8800) },
+      { SIMDE_FLOAT64_C( -809.9000), SIMDE_FLOAT64_C(   -0.0012), SIMDE_FLOAT64_C(    0.0022), SIMDE_FLOAT64_C( -467.3600),
+        SIMDE_FLOAT64_C( -780.9400), SIMDE_FLOAT64_C(  736.4100), SIMDE_FLOAT64_C(    0.0020), SIMDE_FLOAT64_C(    0.0457) } },
+    { { SIMDE_FLOAT64_C(  247.6100), SIMDE_FLOAT64_C(  702.5900), SIMDE_FLOAT64_C(   51.2900), SIMDE_FLOAT64_C(  834.6200),
+        SIMDE_FLOAT64_C(  746.4700), SIMDE_FLOAT64_C(  771.2000), SIMDE_FLOAT64_C(  896.3200), SIMDE_FLOAT64_C(  827.7100) },
+      UINT8_C( 12),
+      { SIMDE_FLOAT64_C( -556.1000), SIMDE_FLOAT64_C( -337.6300), SIMDE_FLOAT64_C(  846.1400), SIMDE_FLOAT64_C(  467.5400),
+        SIMDE_FLOAT64_C(  934.6300), SIMDE_FLOAT64_C(  161.9500), SIMDE_FLOAT64_C(  113.2200), SIMDE_FLOAT64_C(  759.8500) },
+      { SIMDE_FLOAT64_C(  247.6100), SIMDE_FLOAT64_C(  702.5900), SIMDE_FLOAT64_C(    0.0012), SIMDE_FLOAT64_C(    0.0021),
+        SIMDE_FLOAT64_C(  746.4700), SIMDE_FLOAT64_C(  771.2000), SIMDE_FLOAT64_C(  896.3200), SIMDE_FLOAT64_C(  827.7100) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d src = simde_mm512_loadu_pd(test_vec[i].src);
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_mask_rcp14_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_rcp14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { UINT8_C(164),
+      { SIMDE_FLOAT64_C(  708.9400), SIMDE_FLOAT64_C( -105.8600), SIMDE_FLOAT64_C(  778.1200), SIMDE_FLOAT64_C(  618.2300),
+        SIMDE_FLOAT64_C( -111.4900), SIMDE_FLOAT64_C(  864.9200), SIMDE_FLOAT64_C(  879.0600), SIMDE_FLOAT64_C(  938.0700) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0013), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0012), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0011) } },
+    { UINT8_C(162),
+      { SIMDE_FLOAT64_C( -142.5000), SIMDE_FLOAT64_C( -393.6900), SIMDE_FLOAT64_C( -863.1800), SIMDE_FLOAT64_C( -720.4200),
+        SIMDE_FLOAT64_C( -198.4400), SIMDE_FLOAT64_C(  301.1400), SIMDE_FLOAT64_C( -100.5700), SIMDE_FLOAT64_C(  -81.9300) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(   -0.0025), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0033), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(   -0.0122) } },
+    { UINT8_C( 80),
+      { SIMDE_FLOAT64_C(  933.0200), SIMDE_FLOAT64_C(  868.0200), SIMDE_FLOAT64_C(  912.6700), SIMDE_FLOAT64_C(  830.1100),
+        SIMDE_FLOAT64_C(  497.1600), SIMDE_FLOAT64_C(  946.2400), SIMDE_FLOAT64_C(  807.7500), SIMDE_FLOAT64_C(  390.6300) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(    0.0020), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0012), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C(105),
+      { SIMDE_FLOAT64_C( -776.5100), SIMDE_FLOAT64_C( -743.6300), SIMDE_FLOAT64_C(  714.4500), SIMDE_FLOAT64_C( -126.0100),
+        SIMDE_FLOAT64_C(  759.6700), SIMDE_FLOAT64_C( -763.4400), SIMDE_FLOAT64_C(  -26.7200), SIMDE_FLOAT64_C(   11.1400) },
+      { SIMDE_FLOAT64_C(   -0.0013), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(   -0.0079),
+        SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(   -0.0013), SIMDE_FLOAT64_C(   -0.0374), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C(129),
+      { SIMDE_FLOAT64_C(  368.7900), SIMDE_FLOAT64_C( -930.9500), SIMDE_FLOAT64_C(  371.0400), SIMDE_FLOAT64_C(   32.4500),
+        SIMDE_FLOAT64_C( -965.3400), SIMDE_FLOAT64_C( -898.2100), SIMDE_FLOAT64_C( -900.0400), SIMDE_FLOAT64_C(  820.5500) },
+      { SIMDE_FLOAT64_C(    0.0027), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0012) } },
+    { UINT8_C( 56),
+      { SIMDE_FLOAT64_C(  880.0200), SIMDE_FLOAT64_C( -558.7400), SIMDE_FLOAT64_C( -769.7500), SIMDE_FLOAT64_C( -763.3800),
+        SIMDE_FLOAT64_C( -433.4300), SIMDE_FLOAT64_C( -884.8700), SIMDE_FLOAT64_C(  545.8200), SIMDE_FLOAT64_C( -533.4700) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(   -0.0013),
+        SIMDE_FLOAT64_C(   -0.0023), SIMDE_FLOAT64_C(   -0.0011), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C(122),
+      { SIMDE_FLOAT64_C( -863.8000), SIMDE_FLOAT64_C(  970.7200), SIMDE_FLOAT64_C(  884.2300), SIMDE_FLOAT64_C( -659.6000),
+        SIMDE_FLOAT64_C(  439.0300), SIMDE_FLOAT64_C(  342.8500), SIMDE_FLOAT64_C(  406.4900), SIMDE_FLOAT64_C(  684.1400) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0010), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(   -0.0015),
+        SIMDE_FLOAT64_C(    0.0023), SIMDE_FLOAT64_C(    0.0029), SIMDE_FLOAT64_C(    0.0025), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C(249),
+      { SIMDE_FLOAT64_C(  800.2500), SIMDE_FLOAT64_C( -546.1000), SIMDE_FLOAT64_C( -831.9900), SIMDE_FLOAT64_C(  413.6900),
+        SIMDE_FLOAT64_C( -406.4100), SIMDE_FLOAT64_C( -626.4900), SIMDE_FLOAT64_C(  510.2700), SIMDE_FLOAT64_C( -630.8100) },
+      { SIMDE_FLOAT64_C(    0.0012), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0024),
+        SIMDE_FLOAT64_C(   -0.0025), SIMDE_FLOAT64_C(   -0.0016), SIMDE_FLOAT64_C(    0.0020), SIMDE_FLOAT64_C(   -0.0016) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_maskz_rcp14_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_rcp14_ss (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[4];
+    const simde_float32 b[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  582.6500), SIMDE_FLOAT32_C(  556.0500), SIMDE_FLOAT32_C(   89.4600), SIMDE_FLOAT32_C(  520.8100) },
+      { SIMDE_FLOAT32_C(  -64.8200), SIMDE_FLOAT32_C(  986.1000), SIMDE_FLOAT32_C(  769.2900), SIMDE_FLOAT32_C(  578.7700) },
+      { SIMDE_FLOAT32_C(   -0.0154), SIMDE_FLOAT32_C(  556.0500), SIMDE_FLOAT32_C(   89.4600), SIMDE_FLOAT32_C(  520.8100) } },
+    { { SIMDE_FLOAT32_C(  714.0100), SIMDE_FLOAT32_C(  103.5400), SIMDE_FLOAT32_C(  499.9700), SIMDE_FLOAT32_C(  415.7600) },
+      { SIMDE_FLOAT32_C(  418.9900), SIMDE_FLOAT32_C( -758.8200), SIMDE_FLOAT32_C( -914.5100), SIMDE_FLOAT32_C(  975.6900) },
+      { SIMDE_FLOAT32_C(    0.0024), SIMDE_FLOAT32_C(  103.5400), SIMDE_FLOAT32_C(  499.9700), SIMDE_FLOAT32_C(  415.7600) } },
+    { { SIMDE_FLOAT32_C(  971.0000), SIMDE_FLOAT32_C(  574.7300), SIMDE_FLOAT32_C(  563.2800), SIMDE_FLOAT32_C(   91.4800) },
+      { SIMDE_FLOAT32_C(  913.2000), SIMDE_FLOAT32_C( -222.8100), SIMDE_FLOAT32_C(  -92.1100), SIMDE_FLOAT32_C(  445.9400) },
+      { SIMDE_FLOAT32_C(    0.0011), SIMDE_FLOAT32_C(  574.7300), SIMDE_FLOAT32_C(  563.2800), SIMDE_FLOAT32_C(   91.4800) } },
+    { { SIMDE_FLOAT32_C(  555.7500), SIMDE_FLOAT32_C(  837.9200), SIMDE_FLOAT32_C(  464.5700), SIMDE_FLOAT32_C(  368.5400) },
+      { SIMDE_FLOAT32_C(  362.7400), SIMDE_FLOAT32_C(  861.1900), SIMDE_FLOAT32_C( -820.8700), SIMDE_FLOAT32_C(  667.5000) },
+      { SIMDE_FLOAT32_C(    0.0028), SIMDE_FLOAT32_C(  837.9200), SIMDE_FLOAT32_C(  464.5700), SIMDE_FLOAT32_C(  368.5400) } },
+    { { SIMDE_FLOAT32_C(  392.3000), SIMDE_FLOAT32_C(  195.2700), SIMDE_FLOAT32_C(  630.5500), SIMDE_FLOAT32_C(  181.4500) },
+      { SIMDE_FLOAT32_C(  714.8100), SIMDE_FLOAT32_C(  515.2100), SIMDE_FLOAT32_C( -785.1600), SIMDE_FLOAT32_C( -264.4600) },
+      { SIMDE_FLOAT32_C(    0.0014), SIMDE_FLOAT32_C(  195.2700), SIMDE_FLOAT32_C(  630.5500), SIMDE_FLOAT32_C(  181.4500) } },
+    { { SIMDE_FLOAT32_C(  591.9200), SIMDE_FLOAT32_C(   55.6000), SIMDE_FLOAT32_C(  441.7500), SIMDE_FLOAT32_C(   81.9000) },
+      { SIMDE_FLOAT32_C( -739.1500), SIMDE_FLOAT32_C( -768.1000), SIMDE_FLOAT32_C( -255.8700), SIMDE_FLOAT32_C( -738.7000) },
+      { SIMDE_FLOAT32_C(   -0.0014), SIMDE_FLOAT32_C(   55.6000), SIMDE_FLOAT32_C(  441.7500), SIMDE_FLOAT32_C(   81.9000) } },
+    { { SIMDE_FLOAT32_C(    6.1900), SIMDE_FLOAT32_C(  306.7200), SIMDE_FLOAT32_C(  406.3500), SIMDE_FLOAT32_C(  357.9600) },
+      { SIMDE_FLOAT32_C(  324.3600), SIMDE_FLOAT32_C( -855.5200), SIMDE_FLOAT32_C( -452.6100), SIMDE_FLOAT32_C(  797.2500) },
+      { SIMDE_FLOAT32_C(    0.0031), SIMDE_FLOAT32_C(  306.7200), SIMDE_FLOAT32_C(  406.3500), SIMDE_FLOAT32_C(  357.9600) } },
+    { { SIMDE_FLOAT32_C(  365.7800), SIMDE_FLOAT32_C(  406.5200), SIMDE_FLOAT32_C(  134.5800), SIMDE_FLOAT32_C(  810.9500) },
+      { SIMDE_FLOAT32_C( -510.5100), SIMDE_FLOAT32_C( -313.1100), SIMDE_FLOAT32_C(  152.8900), SIMDE_FLOAT32_C(  329.7200) },
+      { SIMDE_FLOAT32_C(   -0.0020), SIMDE_FLOAT32_C(  406.5200), SIMDE_FLOAT32_C(  134.5800), SIMDE_FLOAT32_C(  810.9500) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 b = simde_mm_loadu_ps(test_vec[i].b);
+    simde__m128 r = simde_mm_rcp14_ss(a, b);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_rcp14_ss (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[4];
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const simde_float32 b[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C( -289.6900), SIMDE_FLOAT32_C( -160.6600), SIMDE_FLOAT32_C( -797.7000), SIMDE_FLOAT32_C( -678.4800) },
+      UINT8_C(197),
+      { SIMDE_FLOAT32_C(  846.0000), SIMDE_FLOAT32_C(  874.1400), SIMDE_FLOAT32_C(  758.1000), SIMDE_FLOAT32_C(  864.7300) },
+      { SIMDE_FLOAT32_C(  788.8700), SIMDE_FLOAT32_C(  525.3100), SIMDE_FLOAT32_C( -898.7200), SIMDE_FLOAT32_C(  185.0200) },
+      { SIMDE_FLOAT32_C(    0.0013), SIMDE_FLOAT32_C(  874.1400), SIMDE_FLOAT32_C(  758.1000), SIMDE_FLOAT32_C(  864.7300) } },
+    { { SIMDE_FLOAT32_C(  684.0800), SIMDE_FLOAT32_C(  683.4400), SIMDE_FLOAT32_C( -980.1900), SIMDE_FLOAT32_C(  518.9800) },
+      UINT8_C(  5),
+      { SIMDE_FLOAT32_C(  811.2600), SIMDE_FLOAT32_C(  764.3200), SIMDE_FLOAT32_C(  768.1800), SIMDE_FLOAT32_C(  954.2200) },
+      { SIMDE_FLOAT32_C( -328.0100), SIMDE_FLOAT32_C(  389.5400), SIMDE_FLOAT32_C(  458.3900), SIMDE_FLOAT32_C( -816.1600) },
+      { SIMDE_FLOAT32_C(   -0.0030), SIMDE_FLOAT32_C(  764.3200), SIMDE_FLOAT32_C(  768.1800), SIMDE_FLOAT32_C(  954.2200) } },
+    { { SIMDE_FLOAT32_C( -860.1300), SIMDE_FLOAT32_C(  564.0600), SIMDE_FLOAT32_C( -585.3400), SIMDE_FLOAT32_C( -876.9800) },
+      UINT8_C( 33),
+      { SIMDE_FLOAT32_C(  753.7500), SIMDE_FLOAT32_C(  850.3900), SIMDE_FLOAT32_C(  192.6200), SIMDE_FLOAT32_C(  534.3000) },
+      { SIMDE_FLOAT32_C( -514.6300), SIMDE_FLOAT32_C(  600.9100), SIMDE_FLOAT32_C( -269.6100), SIMDE_FLOAT32_C( -603.6300) },
+      { SIMDE_FLOAT32_C(   -0.0019), SIMDE_FLOAT32_C(  850.3900), SIMDE_FLOAT32_C(  192.6200), SIMDE_FLOAT32_C(  534.3000) } },
+    { { SIMDE_FLOAT32_C( -799.5200), SIMDE_FLOAT32_C( -899.1100), SIMDE_FLOAT32_C(  379.9100), SIMDE_FLOAT32_C(   49.0600) },
+      UINT8_C( 20),
+      { SIMDE_FLOAT32_C(  465.0700), SIMDE_FLOAT32_C(  880.0900), SIMDE_FLOAT32_C(  436.2400), SIMDE_FLOAT32_C(  363.2100) },
+      { SIMDE_FLOAT32_C( -669.3700), SIMDE_FLOAT32_C( -886.2800), SIMDE_FLOAT32_C(  915.3400), SIMDE_FLOAT32_C( -981.0000) },
+      { SIMDE_FLOAT32_C( -799.5200), SIMDE_FLOAT32_C(  880.0900), SIMDE_FLOAT32_C(  436.2400), SIMDE_FLOAT32_C(  363.2100) } },
+    { { SIMDE_FLOAT32_C( -308.6000), SIMDE_FLOAT32_C( -260.0000), SIMDE_FLOAT32_C(  989.3600), SIMDE_FLOAT32_C(  681.6300) },
+      UINT8_C( 85),
+      { SIMDE_FLOAT32_C(  683.2800), SIMDE_FLOAT32_C(  504.7500), SIMDE_FLOAT32_C(  929.6300), SIMDE_FLOAT32_C(  848.3100) },
+      { SIMDE_FLOAT32_C( -457.5000), SIMDE_FLOAT32_C( -252.3700), SIMDE_FLOAT32_C(  653.1000), SIMDE_FLOAT32_C( -766.2600) },
+      { SIMDE_FLOAT32_C(   -0.0022), SIMDE_FLOAT32_C(  504.7500), SIMDE_FLOAT32_C(  929.6300), SIMDE_FLOAT32_C(  848.3100) } },
+    { { SIMDE_FLOAT32_C( -565.8300), SIMDE_FLOAT32_C( -283.2000), SIMDE_FLOAT32_C( -882.7400), SIMDE_FLOAT32_C(  239.6900) },
+      UINT8_C(  2),
+      { SIMDE_FLOAT32_C(  625.8700), SIMDE_FLOAT32_C(  618.0000), SIMDE_FLOAT32_C(  961.3100), SIMDE_FLOAT32_C(  998.4500) },
+      { SIMDE_FLOAT32_C( -567.0400), SIMDE_FLOAT32_C( -555.7500), SIMDE_FLOAT32_C( -854.2800), SIMDE_FLOAT32_C( -538.5100) },
+      { SIMDE_FLOAT32_C( -565.8300), SIMDE_FLOAT32_C(  618.0000), SIMDE_FLOAT32_C(  961.3100), SIMDE_FLOAT32_C(  998.4500) } },
+    { { SIMDE_FLOAT32_C( -987.9400), SIMDE_FLOAT32_C( -380.6300), SIMDE_FLOAT32_C(  492.0100), SIMDE_FLOAT32_C( -707.4400) },
+      UINT8_C( 67),
+      { SIMDE_FLOAT32_C(  660.3100), SIMDE_FLOAT32_C(   83.2600), SIMDE_FLOAT32_C(  179.6800), SIMDE_FLOAT32_C(  135.8500) },
+      { SIMDE_FLOAT32_C(  132.9600), SIMDE_FLOAT32_C( -523.2500), SIMDE_FLOAT32_C( -219.3800), SIMDE_FLOAT32_C(  254.7600) },
+      { SIMDE_FLOAT32_C(    0.0075), SIMDE_FLOAT32_C(   83.2600), SIMDE_FLOAT32_C(  179.6800), SIMDE_FLOAT32_C(  135.8500) } },
+    { { SIMDE_FLOAT32_C( -968.4100), SIMDE_FLOAT32_C(  261.4300), SIMDE_FLOAT32_C(   -1.8700), SIMDE_FLOAT32_C( -744.8200) },
+      UINT8_C(  0),
+      { SIMDE_FLOAT32_C(  748.6300), SIMDE_FLOAT32_C(  660.9800), SIMDE_FLOAT32_C(  995.5800), SIMDE_FLOAT32_C(  681.0400) },
+      { SIMDE_FLOAT32_C(  211.3000), SIMDE_FLOAT32_C( -316.5900), SIMDE_FLOAT32_C(  130.6000), SIMDE_FLOAT32_C( -649.0600) },
+      { SIMDE_FLOAT32_C( -968.4100), SIMDE_FLOAT32_C(  660.9800), SIMDE_FLOAT32_C(  995.5800), SIMDE_FLOAT32_C(  681.0400) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 src = simde_mm_loadu_ps(test_vec[i].src);
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 b = simde_mm_loadu_ps(test_vec[i].b);
+    simde__m128 r = simde_mm_mask_rcp14_ss(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_rcp14_ss (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const simde_float32 b[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { UINT8_C(  0),
+      { SIMDE_FLOAT32_C(  681.7100), SIMDE_FLOAT32_C(  186.8500), SIMDE_FLOAT32_C(  665.4500), SIMDE_FLOAT32_C(  329.9200) },
+      { SIMDE_FLOAT32_C(  521.3700), SIMDE_FLOAT32_C( -694.8200), SIMDE_FLOAT32_C( -373.2900), SIMDE_FLOAT32_C( -863.6000) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  186.8500), SIMDE_FLOAT32_C(  665.4500), SIMDE_FLOAT32_C(  329.9200) } },
+    { UINT8_C(129),
+      { SIMDE_FLOAT32_C(  540.2000), SIMDE_FLOAT32_C(  530.0700), SIMDE_FLOAT32_C(  844.8500), SIMDE_FLOAT32_C(  633.0000) },
+      { SIMDE_FLOAT32_C(  996.0600), SIMDE_FLOAT32_C(  352.9900), SIMDE_FLOAT32_C(  -57.7400), SIMDE_FLOAT32_C(  520.4000) },
+      { SIMDE_FLOAT32_C(    0.0010), SIMDE_FLOAT32_C(  530.0700), SIMDE_FLOAT32_C(  844.8500), SIMDE_FLOAT32_C(  633.0000) } },
+    { UINT8_C(212),
+      { SIMDE_FLOAT32_C(  403.2200), SIMDE_FLOAT32_C(   53.6100), SIMDE_FLOAT32_C(  429.0800), SIMDE_FLOAT32_C(  910.0800) },
+      { SIMDE_FLOAT32_C( -870.1100), SIMDE_FLOAT32_C(  439.6400), SIMDE_FLOAT32_C( -251.2100), SIMDE_FLOAT32_C( -466.2600) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   53.6100), SIMDE_FLOAT32_C(  429.0800), SIMDE_FLOAT32_C(  910.0800) } },
+    { UINT8_C(129),
+      { SIMDE_FLOAT32_C(  728.4600), SIMDE_FLOAT32_C(  952.7000), SIMDE_FLOAT32_C(  112.1900), SIMDE_FLOAT32_C(  151.2000) },
+      { SIMDE_FLOAT32_C( -513.0900), SIMDE_FLOAT32_C(  213.9100), SIMDE_FLOAT32_C(  524.0700), SIMDE_FLOAT32_C( -701.0100) },
+      { SIMDE_FLOAT32_C(   -0.0019), SIMDE_FLOAT32_C(  952.7000), SIMDE_FLOAT32_C(  112.1900), SIMDE_FLOAT32_C(  151.2000) } },
+    { UINT8_C(137),
+      { SIMDE_FLOAT32_C(  483.9400), SIMDE_FLOAT32_C(  741.4000), SIMDE_FLOAT32_C(  208.0000), SIMDE_FLOAT32_C(  220.5200) },
+      { SIMDE_FLOAT32_C(  491.7100), SIMDE_FLOAT32_C( -556.0100), SIMDE_FLOAT32_C(  -74.2500), SIMDE_FLOAT32_C(  881.7000) },
+      { SIMDE_FLOAT32_C(    0.0020), SIMDE_FLOAT32_C(  741.4000), SIMDE_FLOAT32_C(  208.0000), SIMDE_FLOAT32_C(  220.5200) } },
+    { UINT8_C(  0),
+      { SIMDE_FLOAT32_C(  920.1800), SIMDE_FLOAT32_C(  915.5900), SIMDE_FLOAT32_C(  689.3100), SIMDE_FLOAT32_C(  564.1100) },
+      { SIMDE_FLOAT32_C( -291.2200), SIMDE_FLOAT32_C(  778.6200), SIMDE_FLOAT32_C( -407.2600), SIMDE_FLOAT32_C(  627.0200) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  915.5900), SIMDE_FLOAT32_C(  689.3100), SIMDE_FLOAT32_C(  564.1100) } },
+    { UINT8_C( 68),
+      { SIMDE_FLOAT32_C(   62.4700), SIMDE_FLOAT32_C(  296.9700), SIMDE_FLOAT32_C(    1.8700), SIMDE_FLOAT32_C(  883.5800) },
+      { SIMDE_FLOAT32_C(  858.3200), SIMDE_FLOAT32_C( -235.2300), SIMDE_FLOAT32_C( -251.3200), SIMDE_FLOAT32_C(  588.2300) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  296.9700), SIMDE_FLOAT32_C(    1.8700), SIMDE_FLOAT32_C(  883.5800) } },
+    { UINT8_C( 57),
+      { SIMDE_FLOAT32_C(  140.7500), SIMDE_FLOAT32_C(  890.5200), SIMDE_FLOAT32_C(  542.3100), SIMDE_FLOAT32_C(  381.2400) },
+      { SIMDE_FLOAT32_C( -137.1300), SIMDE_FLOAT32_C(  200.1300), SIMDE_FLOAT32_C(  -56.4900), SIMDE_FLOAT32_C(  339.0500) },
+      { SIMDE_FLOAT32_C(   -0.0073), SIMDE_FLOAT32_C(  890.5200), SIMDE_FLOAT32_C(  542.3100), SIMDE_FLOAT32_C(  381.2400) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 b = simde_mm_loadu_ps(test_vec[i].b);
+    simde__m128 r = simde_mm_maskz_rcp14_ss(test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_rcp14_sd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[2];
+    const simde_float64 b[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  450.5700), SIMDE_FLOAT64_C(  491.2600) },
+      { SIMDE_FLOAT64_C(  152.3000), SIMDE_FLOAT64_C( -650.2200) },
+      { SIMDE_FLOAT64_C(    0.0066), SIMDE_FLOAT64_C(  491.2600) } },
+    { { SIMDE_FLOAT64_C(  709.0800), SIMDE_FLOAT64_C(  902.6600) },
+      { SIMDE_FLOAT64_C(  125.6300), SIMDE_FLOAT64_C( -829.6300) },
+      { SIMDE_FLOAT64_C(    0.0080), SIMDE_FLOAT64_C(  902.6600) } },
+    { { SIMDE_FLOAT64_C(  466.5700), SIMDE_FLOAT64_C(  519.4800) },
+      { SIMDE_FLOAT64_C(  421.3100), SIMDE_FLOAT64_C(  932.3800) },
+      { SIMDE_FLOAT64_C(    0.0024), SIMDE_FLOAT64_C(  519.4800) } },
+    { { SIMDE_FLOAT64_C(  903.8800), SIMDE_FLOAT64_C(  904.3700) },
+      { SIMDE_FLOAT64_C( -537.0400), SIMDE_FLOAT64_C(  139.9600) },
+      { SIMDE_FLOAT64_C(   -0.0019), SIMDE_FLOAT64_C(  904.3700) } },
+    { { SIMDE_FLOAT64_C(  701.6900), SIMDE_FLOAT64_C(  606.7400) },
+      { SIMDE_FLOAT64_C(  984.2800), SIMDE_FLOAT64_C(  786.9400) },
+      { SIMDE_FLOAT64_C(    0.0010), SIMDE_FLOAT64_C(  606.7400) } },
+    { { SIMDE_FLOAT64_C(  100.2100), SIMDE_FLOAT64_C(  964.3300) },
+      { SIMDE_FLOAT64_C( -142.2500), SIMDE_FLOAT64_C(  506.0300) },
+      { SIMDE_FLOAT64_C(   -0.0070), SIMDE_FLOAT64_C(  964.3300) } },
+    { { SIMDE_FLOAT64_C(  784.5300), SIMDE_FLOAT64_C(  929.8200) },
+      { SIMDE_FLOAT64_C( -885.1300), SIMDE_FLOAT64_C(  169.2600) },
+      { SIMDE_FLOAT64_C(   -0.0011), SIMDE_FLOAT64_C(  929.8200) } },
+    { { SIMDE_FLOAT64_C(  123.3700), SIMDE_FLOAT64_C(  914.0800) },
+      { SIMDE_FLOAT64_C( -331.0400), SIMDE_FLOAT64_C( -801.9200) },
+      { SIMDE_FLOAT64_C(   -0.0030), SIMDE_FLOAT64_C(  914.0800) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d b = simde_mm_loadu_pd(test_vec[i].b);
+    simde__m128d r = simde_mm_rcp14_sd(a, b);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_rcp14_sd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[2];
+    const simde__mmask8 k;
+    const simde_float64 a[2];
+    const simde_float64 b[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C( -527.7800), SIMDE_FLOAT64_C( -494.3900) },
+      UINT8_C(  1),
+      { SIMDE_FLOAT64_C(  810.9100), SIMDE_FLOAT64_C(  961.7400) },
+      { SIMDE_FLOAT64_C( -440.6800), SIMDE_FLOAT64_C( -888.0300) },
+      { SIMDE_FLOAT64_C(   -0.0023), SIMDE_FLOAT64_C(  961.7400) } },
+    { { SIMDE_FLOAT64_C(  -99.3200), SIMDE_FLOAT64_C(  936.0500) },
+      UINT8_C( 72),
+      { SIMDE_FLOAT64_C(  368.2200), SIMDE_FLOAT64_C(  270.1900) },
+      { SIMDE_FLOAT64_C(  904.9400), SIMDE_FLOAT64_C( -146.4700) },
+      { SIMDE_FLOAT64_C(  -99.3200), SIMDE_FLOAT64_C(  270.1900) } },
+    { { SIMDE_FLOAT64_C( -193.7500), SIMDE_FLOAT64_C( -875.8500) },
+      UINT8_C( 73),
+      { SIMDE_FLOAT64_C(   89.2200), SIMDE_FLOAT64_C(  728.5600) },
+      { SIMDE_FLOAT64_C(  423.4100), SIMDE_FLOAT64_C(  220.6500) },
+      { SIMDE_FLOAT64_C(    0.0024), SIMDE_FLOAT64_C(  728.5600) } },
+    { { SIMDE_FLOAT64_C(   69.0900), SIMDE_FLOAT64_C(  519.3100) },
+      UINT8_C(155),
+      { SIMDE_FLOAT64_C(  848.9700), SIMDE_FLOAT64_C(  586.5100) },
+      { SIMDE_FLOAT64_C( -650.4400), SIMDE_FLOAT64_C( -183.2300) },
+      { SIMDE_FLOAT64_C(   -0.0015), SIMDE_FLOAT64_C(  586.5100) } },
+    { { SIMDE_FLOAT64_C(  666.4400), SIMDE_FLOAT64_C(   52.0200) },
+      UINT8_C(136),
+      { SIMDE_FLOAT64_C(  158.6700), SIMDE_FLOAT64_C(  142.0700) },
+      { SIMDE_FLOAT64_C( -251.7600), SIMDE_FLOAT64_C(  873.4500) },
+      { SIMDE_FLOAT64_C(  666.4400), SIMDE_FLOAT64_C(  142.0700) } },
+    { { SIMDE_FLOAT64_C(  650.5000), SIMDE_FLOAT64_C( -440.0400) },
+      UINT8_C( 33),
+      { SIMDE_FLOAT64_C(  689.5300), SIMDE_FLOAT64_C(  653.1000) },
+      { SIMDE_FLOAT64_C(  779.3400), SIMDE_FLOAT64_C(  353.9200) },
+      { SIMDE_FLOAT64_C(    0.0013), SIMDE_FLOAT64_C(  653.1000) } },
+    { { SIMDE_FLOAT64_C( -611.5000), SIMDE_FLOAT64_C( -560.4900) },
+      UINT8_C( 70),
+      { SIMDE_FLOAT64_C(  756.3900), SIMDE_FLOAT64_C(  351.8500) },
+      { SIMDE_FLOAT64_C( -614.7500), SIMDE_FLOAT64_C(  434.9800) },
+      { SIMDE_FLOAT64_C( -611.5000), SIMDE_FLOAT64_C(  351.8500) } },
+    { { SIMDE_FLOAT64_C( -334.7800), SIMDE_FLOAT64_C(  642.0600) },
+      UINT8_C(  1),
+      { SIMDE_FLOAT64_C(  291.2600), SIMDE_FLOAT64_C(  351.5000) },
+      { SIMDE_FLOAT64_C( -905.8400), SIMDE_FLOAT64_C( -580.8600) },
+      { SIMDE_FLOAT64_C(   -0.0011), SIMDE_FLOAT64_C(  351.5000) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d src = simde_mm_loadu_pd(test_vec[i].src);
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d b = simde_mm_loadu_pd(test_vec[i].b);
+    simde__m128d r = simde_mm_mask_rcp14_sd(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_rcp14_sd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[2];
+    const simde_float64 b[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { UINT8_C(  5),
+      { SIMDE_FLOAT64_C(  161.4800), SIMDE_FLOAT64_C(   14.1900) },
+      { SIMDE_FLOAT64_C( -169.2300), SIMDE_FLOAT64_C( -574.6400) },
+      { SIMDE_FLOAT64_C(   -0.0059), SIMDE_FLOAT64_C(   14.1900) } },
+    { UINT8_C( 71),
+      { SIMDE_FLOAT64_C(   23.8100), SIMDE_FLOAT64_C(  447.2300) },
+      { SIMDE_FLOAT64_C( -200.4800), SIMDE_FLOAT64_C(  962.6600) },
+      { SIMDE_FLOAT64_C(   -0.0050), SIMDE_FLOAT64_C(  447.2300) } },
+    { UINT8_C(165),
+      { SIMDE_FLOAT64_C(  914.7900), SIMDE_FLOAT64_C(  143.8100) },
+      { SIMDE_FLOAT64_C( -550.6300), SIMDE_FLOAT64_C(  854.4500) },
+      { SIMDE_FLOAT64_C(   -0.0018), SIMDE_FLOAT64_C(  143.8100) } },
+    { UINT8_C(131),
+      { SIMDE_FLOAT64_C(  595.2700), SIMDE_FLOAT64_C(   84.0100) },
+      { SIMDE_FLOAT64_C( -502.9200), SIMDE_FLOAT64_C(  119.5800) },
+      { SIMDE_FLOAT64_C(   -0.0020), SIMDE_FLOAT64_C(   84.0100) } },
+    { UINT8_C(194),
+      { SIMDE_FLOAT64_C(  540.1300), SIMDE_FLOAT64_C(  626.0600) },
+      { SIMDE_FLOAT64_C(  833.4900), SIMDE_FLOAT64_C(  712.1000) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(  626.0600) } },
+    { UINT8_C(114),
+      { SIMDE_FLOAT64_C(  583.3200), SIMDE_FLOAT64_C(  491.9900) },
+      { SIMDE_FLOAT64_C(  627.4000), SIMDE_FLOAT64_C(  123.9700) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(  491.9900) } },
+    { UINT8_C(  0),
+      { SIMDE_FLOAT64_C(  467.2300), SIMDE_FLOAT64_C(  682.1300) },
+      { SIMDE_FLOAT64_C( -629.8500), SIMDE_FLOAT64_C( -537.6200) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(  682.1300) } },
+    { UINT8_C( 64),
+      { SIMDE_FLOAT64_C(  101.5600), SIMDE_FLOAT64_C(  989.8100) },
+      { SIMDE_FLOAT64_C(  916.6700), SIMDE_FLOAT64_C( -653.2400) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(  989.8100) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d b = simde_mm_loadu_pd(test_vec[i].b);
+    simde__m128d r = simde_mm_maskz_rcp14_sd(test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_rcp28_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C( -995.8600), SIMDE_FLOAT32_C(   26.5200), SIMDE_FLOAT32_C(  757.2400), SIMDE_FLOAT32_C(  180.3500),
+        SIMDE_FLOAT32_C( -408.8300), SIMDE_FLOAT32_C(  730.6600), SIMDE_FLOAT32_C( -303.4600), SIMDE_FLOAT32_C(  147.4300),
+        SIMDE_FLOAT32_C(  879.4500), SIMDE_FLOAT32_C(  575.2500), SIMDE_FLOAT32_C(  470.6000), SIMDE_FLOAT32_C( -523.8700),
+        SIMDE_FLOAT32_C(  485.5700), SIMDE_FLOAT32_C( -956.2000), SIMDE_FLOAT32_C( -772.4400), SIMDE_FLOAT32_C(  342.1200) },
+      { SIMDE_FLOAT32_C(   -0.0010), SIMDE_FLOAT32_C(    0.0377), SIMDE_FLOAT32_C(    0.0013), SIMDE_FLOAT32_C(    0.0055),
+        SIMDE_FLOAT32_C(   -0.0024), SIMDE_FLOAT32_C(    0.0014), SIMDE_FLOAT32_C(   -0.0033), SIMDE_FLOAT32_C(    0.0068),
+        SIMDE_FLOAT32_C(    0.0011), SIMDE_FLOAT32_C(    0.0017), SIMDE_FLOAT32_C(    0.0021), SIMDE_FLOAT32_C(   -0.0019),
+        SIMDE_FLOAT32_C(    0.0021), SIMDE_FLOAT32_C(   -0.0010), SIMDE_FLOAT32_C(   -0.0013), SIMDE_FLOAT32_C(    0.0029) } },
+    { { SIMDE_FLOAT32_C(  743.6200), SIMDE_FLOAT32_C(  596.3700), SIMDE_FLOAT32_C(  512.7100), SIMDE_FLOAT32_C( -792.3000),
+        SIMDE_FLOAT32_C(  663.4900), SIMDE_FLOAT32_C(  328.0100), SIMDE_FLOAT32_C(  528.6100), SIMDE_FLOAT32_C(  291.3100),
+        SIMDE_FLOAT32_C( -308.4700), SIMDE_FLOAT32_C(   55.2800), SIMDE_FLOAT32_C( -799.2900), SIMDE_FLOAT32_C(   39.7800),
+        SIMDE_FLOAT32_C(  -62.2000), SIMDE_FLOAT32_C(  -76.5100), SIMDE_FLOAT32_C( -891.8700), SIMDE_FLOAT32_C( -487.5300) },
+      { SIMDE_FLOAT32_C(    0.0013), SIMDE_FLOAT32_C(    0.0017), SIMDE_FLOAT32_C(    0.0020), SIMDE_FLOAT32_C(   -0.0013),
+        SIMDE_FLOAT32_C(    0.0015), SIMDE_FLOAT32_C(    0.0030), SIMDE_FLOAT32_C(    0.0019), SIMDE_FLOAT32_C(    0.0034),
+        SIMDE_FLOAT32_C(   -0.0032), SIMDE_FLOAT32_C(    0.0181), SIMDE_FLOAT32_C(   -0.0013), SIMDE_FLOAT32_C(    0.0251),
+        SIMDE_FLOAT32_C(   -0.0161), SIMDE_FLOAT32_C(   -0.0131), SIMDE_FLOAT32_C(   -0.0011), SIMDE_FLOAT32_C(   -0.0021) } },
+    { { SIMDE_FLOAT32_C( -516.8100), SIMDE_FLOAT32_C( -136.8100), SIMDE_FLOAT32_C(  949.1400), SIMDE_FLOAT32_C(  906.1900),
+        SIMDE_FLOAT32_C( -925.6300), SIMDE_FLOAT32_C(  815.7700), SIMDE_FLOAT32_C(   11.6200), SIMDE_FLOAT32_C(  210.7600),
+        SIMDE_FLOAT32_C(  145.2500), SIMDE_FLOAT32_C(  427.4000), SIMDE_FLOAT32_C(  104.4100), SIMDE_FLOAT32_C(   -6.2600),
+        SIMDE_FLOAT32_C(  -16.6100), SIMDE_FLOAT32_C( -883.5000), SIMDE_FLOAT32_C(  937.2300), SIMDE_FLOAT32_C(  408.7600) },
+      { SIMDE_FLOAT32_C(   -0.0019), SIMDE_FLOAT32_C(   -0.0073), SIMDE_FLOAT32_C(    0.0011), SIMDE_FLOAT32_C(    0.0011),
+        SIMDE_FLOAT32_C(   -0.0011), SIMDE_FLOAT32_C(    0.0012), SIMDE_FLOAT32_C(    0.0861), SIMDE_FLOAT32_C(    0.0047),
+        SIMDE_FLOAT32_C(    0.0069), SIMDE_FLOAT32_C(    0.0023), SIMDE_FLOAT32_C(    0.0096), SIMDE_FLOAT32_C(   -0.1597),
+        SIMDE_FLOAT32_C(   -0.0602), SIMDE_FLOAT32_C(   -0.0011), SIMDE_FLOAT32_C(    0.0011), SIMDE_FLOAT32_C(    0.0024) } },
+    { { SIMDE_FLOAT32_C( -249.4600), SIMDE_FLOAT32_C(  577.1200), SIMDE_FLOAT32_C( -883.1500), SIMDE_FLOAT32_C(  151.3000),
+        SIMDE_FLOAT32_C( -337.3100), SIMDE_FLOAT32_C(  148.6300), SIMDE_FLOAT32_C(  729.1600), SIMDE_FLOAT32_C(  440.2900),
+        SIMDE_FLOAT32_C(  -66.1300), SIMDE_FLOAT32_C( -141.6300), SIMDE_FLOAT32_C(   51.3000), SIMDE_FLOAT32_C( -827.6200),
+        SIMDE_FLOAT32_C( -863.3600), SIMDE_FLOAT32_C(  830.7800), SIMDE_FLOAT32_C(  547.7100), SIMDE_FLOAT32_C( -203.6300) },
+      { SIMDE_FLOAT32_C(   -0.0040), SIMDE_FLOAT32_C(    0.0017), SIMDE_FLOAT32_C(   -0.0011), SIMDE_FLOAT32_C(    0.0066),
+        SIMDE_FLOAT32_C(   -0.0030), SIMDE_FLOAT32_C(    0.0067), SIMDE_FLOAT32_C(    0.0014), SIMDE_FLOAT32_C(    0.0023),
+        SIMDE_FLOAT32_C(   -0.0151), SIMDE_FLOAT32_C(   -0.0071), SIMDE_FLOAT32_C(    0.0195), SIMDE_FLOAT32_C(   -0.0012),
+        SIMDE_FLOAT32_C(   -0.0012), SIMDE_FLOAT32_C(    0.0012), SIMDE_FLOAT32_C(    0.0018), SIMDE_FLOAT32_C(   -0.0049) } },
+    { { SIMDE_FLOAT32_C( -424.2300), SIMDE_FLOAT32_C( -273.0700), SIMDE_FLOAT32_C(  166.8600), SIMDE_FLOAT32_C( -264.7300),
+        SIMDE_FLOAT32_C( -681.0900), SIMDE_FLOAT32_C(  532.9100), SIMDE_FLOAT32_C( -476.1900), SIMDE_FLOAT32_C(  -15.3200),
+        SIMDE_FLOAT32_C( -538.6400), SIMDE_FLOAT32_C( -193.5300), SIMDE_FLOAT32_C(  306.7700), SIMDE_FLOAT32_C(  393.7000),
+        SIMDE_FLOAT32_C(  972.5800), SIMDE_FLOAT32_C( -838.7600), SIMDE_FLOAT32_C( -918.7100), SIMDE_FLOAT32_C(  120.8600) },
+      { SIMDE_FLOAT32_C(   -0.0024), SIMDE_FLOAT32_C(   -0.0037), SIMDE_FLOAT32_C(    0.0060), SIMDE_FLOAT32_C(   -0.0038),
+        SIMDE_FLOAT32_C(   -0.0015), SIMDE_FLOAT32_C(    0.0019), SIMDE_FLOAT32_C(   -0.0021), SIMDE_FLOAT32_C(   -0.0653),
+        SIMDE_FLOAT32_C(   -0.0019), SIMDE_FLOAT32_C(   -0.0052), SIMDE_FLOAT32_C(    0.0033), SIMDE_FLOAT32_C(    0.0025),
+        SIMDE_FLOAT32_C(    0.0010), SIMDE_FLOAT32_C(   -0.0012), SIMDE_FLOAT32_C(   -0.0011), SIMDE_FLOAT32_C(    0.0083) } },
+    { { SIMDE_FLOAT32_C( -354.7800), SIMDE_FLOAT32_C(  402.5200), SIMDE_FLOAT32_C(  318.2200), SIMDE_FLOAT32_C(  771.4800),
+        SIMDE_FLOAT32_C(  523.4800), SIMDE_FLOAT32_C( -893.3800), SIMDE_FLOAT32_C( -729.6700), SIMDE_FLOAT32_C(   61.5800),
+        SIMDE_FLOAT32_C(  722.5800), SIMDE_FLOAT32_C( -640.6300), SIMDE_FLOAT32_C( -206.0800), SIMDE_FLOAT32_C(  643.8900),
+        SIMDE_FLOAT32_C( -662.3800), SIMDE_FLOAT32_C(  565.8400), SIMDE_FLOAT32_C( -355.2000), SIMDE_FLOAT32_C(  282.2300) },
+      { SIMDE_FLOAT32_C(   -0.0028), SIMDE_FLOAT32_C(    0.0025), SIMDE_FLOAT32_C(    0.0031), SIMDE_FLOAT32_C(    0.0013),
+        SIMDE_FLOAT32_C(    0.0019), SIMDE_FLOAT32_C(   -0.0011), SIMDE_FLOAT32_C(   -0.0014), SIMDE_FLOAT32_C(    0.0162),
+        SIMDE_FLOAT32_C(    0.0014), SIMDE_FLOAT32_C(   -0.0016), SIMDE_FLOAT32_C(   -0.0049), SIMDE_FLOAT32_C(    0.0016),
+        SIMDE_FLOAT32_C(   -0.0015), SIMDE_FLOAT32_C(    0.0018), SIMDE_FLOAT32_C(   -0.0028), SIMDE_FLOAT32_C(    0.0035) } },
+    { { SIMDE_FLOAT32_C( -798.9000), SIMDE_FLOAT32_C( -230.3900), SIMDE_FLOAT32_C( -317.8700), SIMDE_FLOAT32_C(  730.2600),
+        SIMDE_FLOAT32_C( -907.4500), SIMDE_FLOAT32_C( -726.4200), SIMDE_FLOAT32_C(  549.8400), SIMDE_FLOAT32_C( -595.1100),
+        SIMDE_FLOAT32_C( -850.9700), SIMDE_FLOAT32_C(  229.5500), SIMDE_FLOAT32_C( -200.1000), SIMDE_FLOAT32_C(  109.1500),
+        SIMDE_FLOAT32_C(  605.6900), SIMDE_FLOAT32_C( -635.8900), SIMDE_FLOAT32_C( -466.3100), SIMDE_FLOAT32_C(  623.1800) },
+      { SIMDE_FLOAT32_C(   -0.0013), SIMDE_FLOAT32_C(   -0.0043), SIMDE_FLOAT32_C(   -0.0031), SIMDE_FLOAT32_C(    0.0014),
+        SIMDE_FLOAT32_C(   -0.0011), SIMDE_FLOAT32_C(   -0.0014), SIMDE_FLOAT32_C(    0.0018), SIMDE_FLOAT32_C(   -0.0017),
+        SIMDE_FLOAT32_C(   -0.0012), SIMDE_FLOAT32_C(    0.0044), SIMDE_FLOAT32_C(   -0.0050), SIMDE_FLOAT32_C(    0.0092),
+        SIMDE_FLOAT32_C(    0.0017), SIMDE_FLOAT32_C(   -0.0016), SIMDE_FLOAT32_C(   -0.0021), SIMDE_FLOAT32_C(    0.0016) } },
+    { { SIMDE_FLOAT32_C(  213.9300), SIMDE_FLOAT32_C(  149.9200), SIMDE_FLOAT32_C(  417.7800), SIMDE_FLOAT32_C(  981.2800),
+        SIMDE_FLOAT32_C(  346.8600), SIMDE_FLOAT32_C(  -46.0800), SIMDE_FLOAT32_C(  572.5400), SIMDE_FLOAT32_C(   93.8500),
+        SIMDE_FLOAT32_C(  145.8100), SIMDE_FLOAT32_C( -792.2600), SIMDE_FLOAT32_C(  310.9100), SIMDE_FLOAT32_C( -835.3900),
+        SIMDE_FLOAT32_C( -786.0500), SIMDE_FLOAT32_C(  432.1700), SIMDE_FLOAT32_C(  948.7100), SIMDE_FLOAT32_C(  -99.4100) },
+      { SIMDE_FLOAT32_C(    0.0047), SIMDE_FLOAT32_C(    0.0067), SIMDE_FLOAT32_C(    0.0024), SIMDE_FLOAT32_C(    0.0010),
+        SIMDE_FLOAT32_C(    0.0029), SIMDE_FLOAT32_C(   -0.0217), SIMDE_FLOAT32_C(    0.0017), SIMDE_FLOAT32_C(    0.0107),
+        SIMDE_FLOAT32_C(    0.0069), SIMDE_FLOAT32_C(   -0.0013), SIMDE_FLOAT32_C(    0.0032), SIMDE_FLOAT32_C(   -0.0012),
+        SIMDE_FLOAT32_C(   -0.0013), SIMDE_FLOAT32_C(    0.0023), SIMDE_FLOAT32_C(    0.0011), SIMDE_FLOAT32_C(   -0.0101) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_rcp28_ps(a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_rcp28_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[16];
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  838.3300), SIMDE_FLOAT32_C(  526.7900), SIMDE_FLOAT32_C(   51.3600), SIMDE_FLOAT32_C(  923.9800),
+        SIMDE_FLOAT32_C(  128.9600), SIMDE_FLOAT32_C(   39.1900), SIMDE_FLOAT32_C(  177.9200), SIMDE_FLOAT32_C(  562.9600),
+        SIMDE_FLOAT32_C( -666.7200), SIMDE_FLOAT32_C(  933.3800), SIMDE_FLOAT32_C( -521.5000), SIMDE_FLOAT32_C(  189.3400),
+        SIMDE_FLOAT32_C(  209.9300), SIMDE_FLOAT32_C( -267.6600), SIMDE_FLOAT32_C( -823.6300), SIMDE_FLOAT32_C(  -12.6000) },
+      UINT16_C(42540),
+      { SIMDE_FLOAT32_C(  144.9500), SIMDE_FLOAT32_C(  -23.9000), SIMDE_FLOAT32_C(  665.2100), SIMDE_FLOAT32_C(  271.2200),
+        SIMDE_FLOAT32_C( -746.6100), SIMDE_FLOAT32_C( -776.8200), SIMDE_FLOAT32_C(  -59.1800), SIMDE_FLOAT32_C(  934.6500),
+        SIMDE_FLOAT32_C( -943.5200), SIMDE_FLOAT32_C(  158.0100), SIMDE_FLOAT32_C(  785.2200), SIMDE_FLOAT32_C( -287.8100),
+        SIMDE_FLOAT32_C(  979.6800), SIMDE_FLOAT32_C( -830.5000), SIMDE_FLOAT32_C( -794.3400), SIMDE_FLOAT32_C( -396.9100) },
+      { SIMDE_FLOAT32_C(  838.3300), SIMDE_FLOAT32_C(  526.7900), SIMDE_FLOAT32_C(    0.0015), SIMDE_FLOAT32_C(    0.0037),
+        SIMDE_FLOAT32_C(  128.9600), SIMDE_FLOAT32_C(   -0.0013), SIMDE_FLOAT32_C(  177.9200), SIMDE_FLOAT32_C(  562.9600),
+        SIMDE_FLOAT32_C( -666.7200), SIMDE_FLOAT32_C(    0.0063), SIMDE_FLOAT32_C(    0.0013), SIMDE_FLOAT32_C(  189.3400),
+        SIMDE_FLOAT32_C(  209.9300), SIMDE_FLOAT32_C(   -0.0012), SIMDE_FLOAT32_C( -823.6300), SIMDE_FLOAT32_C(   -0.0025) } },
+    { { SIMDE_FLOAT32_C(  253.3000), SIMDE_FLOAT32_C( -636.5100), SIMDE_FLOAT32_C( -973.2300), SIMDE_FLOAT32_C(  733.8400),
+        SIMDE_FLOAT32_C(  835.6600), SIMDE_FLOAT32_C(  972.3200), SIMDE_FLOAT32_C( -123.9900), SIMDE_FLOAT32_C(  -83.7000),
+        SIMDE_FLOAT32_C( -398.6800), SIMDE_FLOAT32_C(  398.9900), SIMDE_FLOAT32_C(  -15.6100), SIMDE_FLOAT32_C(  319.2400),
+        SIMDE_FLOAT32_C(  573.1600), SIMDE_FLOAT32_C( -334.5000), SIMDE_FLOAT32_C( -647.2000), SIMDE_FLOAT32_C(  415.9400) },
+      UINT16_C(51789),
+      { SIMDE_FLOAT32_C(  584.5500), SIMDE_FLOAT32_C( -406.9500), SIMDE_FLOAT32_C(  718.9400), SIMDE_FLOAT32_C(  317.3500),
+        SIMDE_FLOAT32_C(  342.1400), SIMDE_FLOAT32_C(  716.7700), SIMDE_FLOAT32_C(  718.0000), SIMDE_FLOAT32_C( -909.1600),
+        SIMDE_FLOAT32_C(  482.2300), SIMDE_FLOAT32_C(  241.7200), SIMDE_FLOAT32_C( -444.1900), SIMDE_FLOAT32_C( -732.6300),
+        SIMDE_FLOAT32_C( -323.9400), SIMDE_FLOAT32_C( -657.9200), SIMDE_FLOAT32_C( -915.6000), SIMDE_FLOAT32_C( -520.9800) },
+      { SIMDE_FLOAT32_C(    0.0017), SIMDE_FLOAT32_C( -636.5100), SIMDE_FLOAT32_C(    0.0014), SIMDE_FLOAT32_C(    0.0032),
+        SIMDE_FLOAT32_C(  835.6600), SIMDE_FLOAT32_C(  972.3200), SIMDE_FLOAT32_C(    0.0014), SIMDE_FLOAT32_C(  -83.7000),
+        SIMDE_FLOAT32_C( -398.6800), SIMDE_FLOAT32_C(    0.0041), SIMDE_FLOAT32_C(  -15.6100), SIMDE_FLOAT32_C(   -0.0014),
+        SIMDE_FLOAT32_C(  573.1600), SIMDE_FLOAT32_C( -334.5000), SIMDE_FLOAT32_C(   -0.0011), SIMDE_FLOAT32_C(   -0.0019) } },
+    { { SIMDE_FLOAT32_C(  708.4000), SIMDE_FLOAT32_C(   96.1900), SIMDE_FLOAT32_C( -355.9400), SIMDE_FLOAT32_C( -701.2400),
+        SIMDE_FLOAT32_C(  281.4700), SIMDE_FLOAT32_C( -767.7700), SIMDE_FLOAT32_C(  952.1000), SIMDE_FLOAT32_C(  205.1000),
+        SIMDE_FLOAT32_C( -999.8900), SIMDE_FLOAT32_C(  299.5900), SIMDE_FLOAT32_C( -980.4700), SIMDE_FLOAT32_C(   81.4300),
+        SIMDE_FLOAT32_C( -517.8200), SIMDE_FLOAT32_C( -591.8500), SIMDE_FLOAT32_C(  109.1000), SIMDE_FLOAT32_C(  931.2300) },
+      UINT16_C( 5620),
+      { SIMDE_FLOAT32_C(  -24.0200), SIMDE_FLOAT32_C(  651.3900), SIMDE_FLOAT32_C( -602.7700), SIMDE_FLOAT32_C( -614.2200),
+        SIMDE_FLOAT32_C(  923.6100), SIMDE_FLOAT32_C( -391.8700), SIMDE_FLOAT32_C(  873.2700), SIMDE_FLOAT32_C(  696.9600),
+        SIMDE_FLOAT32_C(  279.6900), SIMDE_FLOAT32_C( -666.6900), SIMDE_FLOAT32_C( -597.4900), SIMDE_FLOAT32_C(   35.0700),
+        SIMDE_FLOAT32_C( -306.7400), SIMDE_FLOAT32_C( -325.0800), SIMDE_FLOAT32_C( -389.9100), SIMDE_FLOAT32_C(  142.7000) },
+      { SIMDE_FLOAT32_C(  708.4000), SIMDE_FLOAT32_C(   96.1900), SIMDE_FLOAT32_C(   -0.0017), SIMDE_FLOAT32_C( -701.2400),
+        SIMDE_FLOAT32_C(    0.0011), SIMDE_FLOAT32_C(   -0.0026), SIMDE_FLOAT32_C(    0.0011), SIMDE_FLOAT32_C(    0.0014),
+        SIMDE_FLOAT32_C(    0.0036), SIMDE_FLOAT32_C(  299.5900), SIMDE_FLOAT32_C(   -0.0017), SIMDE_FLOAT32_C(   81.4300),
+        SIMDE_FLOAT32_C(   -0.0033), SIMDE_FLOAT32_C( -591.8500), SIMDE_FLOAT32_C(  109.1000), SIMDE_FLOAT32_C(  931.2300) } },
+    { { SIMDE_FLOAT32_C(   62.9200), SIMDE_FLOAT32_C(  508.4900), SIMDE_FLOAT32_C(  357.0200), SIMDE_FLOAT32_C(  -85.3100),
+        SIMDE_FLOAT32_C( -696.1900), SIMDE_FLOAT32_C(  688.7900), SIMDE_FLOAT32_C(  778.2800), SIMDE_FLOAT32_C( -607.0900),
+        SIMDE_FLOAT32_C( -593.6800), SIMDE_FLOAT32_C(  304.9600), SIMDE_FLOAT32_C( -566.3200), SIMDE_FLOAT32_C(  574.9100),
+        SIMDE_FLOAT32_C(  293.6000), SIMDE_FLOAT32_C(  427.9700), SIMDE_FLOAT32_C( -605.6800), SIMDE_FLOAT32_C(  740.1700) },
+      UINT16_C( 5687),
+      { SIMDE_FLOAT32_C(  129.9100), SIMDE_FLOAT32_C(  129.3900), SIMDE_FLOAT32_C( -783.0900), SIMDE_FLOAT32_C( -398.8200),
+        SIMDE_FLOAT32_C(  184.0300), SIMDE_FLOAT32_C( -324.3700), SIMDE_FLOAT32_C(  310.5600), SIMDE_FLOAT32_C( -240.6600),
+        SIMDE_FLOAT32_C(   46.3900), SIMDE_FLOAT32_C( -752.2100), SIMDE_FLOAT32_C( -162.4500), SIMDE_FLOAT32_C(  752.0800),
+        SIMDE_FLOAT32_C(  922.2700), SIMDE_FLOAT32_C(  617.2600), SIMDE_FLOAT32_C( -276.7500), SIMDE_FLOAT32_C(   72.4700) },
+      { SIMDE_FLOAT32_C(    0.0077), SIMDE_FLOAT32_C(    0.0077), SIMDE_FLOAT32_C(   -0.0013), SIMDE_FLOAT32_C(  -85.3100),
+        SIMDE_FLOAT32_C(    0.0054), SIMDE_FLOAT32_C(   -0.0031), SIMDE_FLOAT32_C(  778.2800), SIMDE_FLOAT32_C( -607.0900),
+        SIMDE_FLOAT32_C( -593.6800), SIMDE_FLOAT32_C(   -0.0013), SIMDE_FLOAT32_C(   -0.0062), SIMDE_FLOAT32_C(  574.9100),
+        SIMDE_FLOAT32_C(    0.0011), SIMDE_FLOAT32_C(  427.9700), SIMDE_FLOAT32_C( -605.6800), SIMDE_FLOAT32_C(  740.1700) } },
+    { { SIMDE_FLOAT32_C(   -4.0200), SIMDE_FLOAT32_C(  694.7600), SIMDE_FLOAT32_C( -169.4000), SIMDE_FLOAT32_C( -807.3800),
+        SIMDE_FLOAT32_C( -573.4900), SIMDE_FLOAT32_C(  547.6900), SIMDE_FLOAT32_C(  837.0900), SIMDE_FLOAT32_C(  -22.3900),
+        SIMDE_FLOAT32_C( -748.7800), SIMDE_FLOAT32_C( -381.0100), SIMDE_FLOAT32_C( -446.2800), SIMDE_FLOAT32_C( -329.0600),
+        SIMDE_FLOAT32_C(  441.4800), SIMDE_FLOAT32_C( -736.7300), SIMDE_FLOAT32_C( -421.9300), SIMDE_FLOAT32_C( -799.8400) },
+      UINT16_C(65319),
+      { SIMDE_FLOAT32_C( -239.6600), SIMDE_FLOAT32_C(  445.6900), SIMDE_FLOAT32_C(  730.4900), SIMDE_FLOAT32_C(  548.1600),
+        SIMDE_FLOAT32_C(  894.7000), SIMDE_FLOAT32_C( -577.4100), SIMDE_FLOAT32_C(  -77.0900), SIMDE_FLOAT32_C( -724.0300),
+        SIMDE_FLOAT32_C(  485.3600), SIMDE_FLOAT32_C(  850.6700), SIMDE_FLOAT32_C(   90.9200), SIMDE_FLOAT32_C(  317.6300),
+        SIMDE_FLOAT32_C(  900.2500), SIMDE_FLOAT32_C( -911.7400), SIMDE_FLOAT32_C(   75.7500), SIMDE_FLOAT32_C( -612.1200) },
+      { SIMDE_FLOAT32_C(   -0.0042), SIMDE_FLOAT32_C(    0.0022), SIMDE_FLOAT32_C(    0.0014), SIMDE_FLOAT32_C( -807.3800),
+        SIMDE_FLOAT32_C( -573.4900), SIMDE_FLOAT32_C(   -0.0017), SIMDE_FLOAT32_C(  837.0900), SIMDE_FLOAT32_C(  -22.3900),
+        SIMDE_FLOAT32_C(    0.0021), SIMDE_FLOAT32_C(    0.0012), SIMDE_FLOAT32_C(    0.0110), SIMDE_FLOAT32_C(    0.0031),
+        SIMDE_FLOAT32_C(    0.0011), SIMDE_FLOAT32_C(   -0.0011), SIMDE_FLOAT32_C(    0.0132), SIMDE_FLOAT32_C(   -0.0016) } },
+    { { SIMDE_FLOAT32_C( -357.5100), SIMDE_FLOAT32_C( -823.8800), SIMDE_FLOAT32_C( -366.8200), SIMDE_FLOAT32_C( -643.6700),
+        SIMDE_FLOAT32_C(  829.7900), SIMDE_FLOAT32_C(   34.8100), SIMDE_FLOAT32_C( -391.3000), SIMDE_FLOAT32_C( -945.3100),
+        SIMDE_FLOAT32_C( -788.5600), SIMDE_FLOAT32_C( -793.1400), SIMDE_FLOAT32_C(  778.3200), SIMDE_FLOAT32_C( -848.0000),
+        SIMDE_FLOAT32_C(  746.3700), SIMDE_FLOAT32_C( -903.4000), SIMDE_FLOAT32_C( -851.8300), SIMDE_FLOAT32_C(  875.0100) },
+      UINT16_C(65392),
+      { SIMDE_FLOAT32_C( -834.8400), SIMDE_FLOAT32_C(  751.8100), SIMDE_FLOAT32_C(  905.4800), SIMDE_FLOAT32_C( -273.2400),
+        SIMDE_FLOAT32_C( -954.8800), SIMDE_FLOAT32_C( -893.3300), SIMDE_FLOAT32_C( -211.9700), SIMDE_FLOAT32_C(  430.0800),
+        SIMDE_FLOAT32_C(   24.7200), SIMDE_FLOAT32_C( -927.5400), SIMDE_FLOAT32_C(  456.8900), SIMDE_FLOAT32_C(  141.5800),
+        SIMDE_FLOAT32_C( -817.6500), SIMDE_FLOAT32_C( -994.8600), SIMDE_FLOAT32_C(  316.1700), SIMDE_FLOAT32_C( -113.8800) },
+      { SIMDE_FLOAT32_C( -357.5100), SIMDE_FLOAT32_C( -823.8800), SIMDE_FLOAT32_C( -366.8200), SIMDE_FLOAT32_C( -643.6700),
+        SIMDE_FLOAT32_C(   -0.0010), SIMDE_FLOAT32_C(   -0.0011), SIMDE_FLOAT32_C(   -0.0047), SIMDE_FLOAT32_C( -945.3100),
+        SIMDE_FLOAT32_C(    0.0405), SIMDE_FLOAT32_C(   -0.0011), SIMDE_FLOAT32_C(    0.0022), SIMDE_FLOAT32_C(    0.0071),
+        SIMDE_FLOAT32_C(   -0.0012), SIMDE_FLOAT32_C(   -0.0010), SIMDE_FLOAT32_C(    0.0032), SIMDE_FLOAT32_C(   -0.0088) } },
+    { { SIMDE_FLOAT32_C( -277.6900), SIMDE_FLOAT32_C( -862.7800), SIMDE_FLOAT32_C( -327.5700), SIMDE_FLOAT32_C(  431.0700),
+        SIMDE_FLOAT32_C(  705.5300), SIMDE_FLOAT32_C(  981.2000), SIMDE_FLOAT32_C( -653.4300), SIMDE_FLOAT32_C(  425.6400),
+        SIMDE_FLOAT32_C(   92.3600), SIMDE_FLOAT32_C(  704.6700), SIMDE_FLOAT32_C( -258.5500), SIMDE_FLOAT32_C(   -3.9200),
+        SIMDE_FLOAT32_C( -531.7100), SIMDE_FLOAT32_C( -658.5700), SIMDE_FLOAT32_C( -876.7100), SIMDE_FLOAT32_C( -832.2900) },
+      UINT16_C(41314),
+      { SIMDE_FLOAT32_C( -627.7900), SIMDE_FLOAT32_C(  140.7000), SIMDE_FLOAT32_C( -663.5000), SIMDE_FLOAT32_C( -960.0800),
+        SIMDE_FLOAT32_C(  130.8300), SIMDE_FLOAT32_C( -462.3200), SIMDE_FLOAT32_C(  358.0800), SIMDE_FLOAT32_C( -158.0800),
+        SIMDE_FLOAT32_C(  814.1700), SIMDE_FLOAT32_C( -384.8000), SIMDE_FLOAT32_C(  965.1600), SIMDE_FLOAT32_C(  510.9400),
+        SIMDE_FLOAT32_C(  734.3000), SIMDE_FLOAT32_C(   87.5900), SIMDE_FLOAT32_C(  958.7700), SIMDE_FLOAT32_C( -559.4400) },
+      { SIMDE_FLOAT32_C( -277.6900), SIMDE_FLOAT32_C(    0.0071), SIMDE_FLOAT32_C( -327.5700), SIMDE_FLOAT32_C(  431.0700),
+        SIMDE_FLOAT32_C(  705.5300), SIMDE_FLOAT32_C(   -0.0022), SIMDE_FLOAT32_C(    0.0028), SIMDE_FLOAT32_C(  425.6400),
+        SIMDE_FLOAT32_C(    0.0012), SIMDE_FLOAT32_C(  704.6700), SIMDE_FLOAT32_C( -258.5500), SIMDE_FLOAT32_C(   -3.9200),
+        SIMDE_FLOAT32_C( -531.7100), SIMDE_FLOAT32_C(    0.0114), SIMDE_FLOAT32_C( -876.7100), SIMDE_FLOAT32_C(   -0.0018) } },
+    { { SIMDE_FLOAT32_C( -313.8000), SIMDE_FLOAT32_C(  401.8700), SIMDE_FLOAT32_C(  785.4300), SIMDE_FLOAT32_C(  949.0000),
+        SIMDE_FLOAT32_C( -525.9400), SIMDE_FLOAT32_C(  952.2300), SIMDE_FLOAT32_C( -774.4000), SIMDE_FLOAT32_C( -394.5200),
+        SIMDE_FLOAT32_C( -364.5800), SIMDE_FLOAT32_C( -364.6000), SIMDE_FLOAT32_C(  566.8900), SIMDE_FLOAT32_C( -979.7600),
+        SIMDE_FLOAT32_C( -306.0700), SIMDE_FLOAT32_C( -126.9100), SIMDE_FLOAT32_C(  869.3700), SIMDE_FLOAT32_C( -876.6000) },
+      UINT16_C(62047),
+      { SIMDE_FLOAT32_C( -687.1300), SIMDE_FLOAT32_C( -964.5500), SIMDE_FLOAT32_C( -207.6200), SIMDE_FLOAT32_C( -769.2800),
+        SIMDE_FLOAT32_C( -201.0900), SIMDE_FLOAT32_C(  267.9600), SIMDE_FLOAT32_C( -167.6600), SIMDE_FLOAT32_C(  669.8400),
+        SIMDE_FLOAT32_C( -948.6900), SIMDE_FLOAT32_C(   -8.0100), SIMDE_FLOAT32_C(  719.2900), SIMDE_FLOAT32_C( -319.5200),
+        SIMDE_FLOAT32_C( -847.4300), SIMDE_FLOAT32_C(  627.6200), SIMDE_FLOAT32_C( -912.2900), SIMDE_FLOAT32_C(  287.2200) },
+      { SIMDE_FLOAT32_C(   -0.0015), SIMDE_FLOAT32_C(   -0.0010), SIMDE_FLOAT32_C(   -0.0048), SIMDE_FLOAT32_C(   -0.0013),
+        SIMDE_FLOAT32_C(   -0.0050), SIMDE_FLOAT32_C(  952.2300), SIMDE_FLOAT32_C(   -0.0060), SIMDE_FLOAT32_C( -394.5200),
+        SIMDE_FLOAT32_C( -364.5800), SIMDE_FLOAT32_C(   -0.1248), SIMDE_FLOAT32_C(  566.8900), SIMDE_FLOAT32_C( -979.7600),
+        SIMDE_FLOAT32_C(   -0.0012), SIMDE_FLOAT32_C(    0.0016), SIMDE_FLOAT32_C(   -0.0011), SIMDE_FLOAT32_C(    0.0035) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 src = simde_mm512_loadu_ps(test_vec[i].src);
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_mask_rcp28_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_rcp28_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { UINT16_C(54959),
+      { SIMDE_FLOAT32_C(  -40.3100), SIMDE_FLOAT32_C(  518.2500), SIMDE_FLOAT32_C(  469.0600), SIMDE_FLOAT32_C( -637.7000),
+        SIMDE_FLOAT32_C(  762.4500), SIMDE_FLOAT32_C(  558.8100), SIMDE_FLOAT32_C( -458.2400), SIMDE_FLOAT32_C( -251.5000),
+        SIMDE_FLOAT32_C( -895.2100), SIMDE_FLOAT32_C(  963.8400), SIMDE_FLOAT32_C( -329.7900), SIMDE_FLOAT32_C( -689.4100),
+        SIMDE_FLOAT32_C(  422.0400), SIMDE_FLOAT32_C(  829.5100), SIMDE_FLOAT32_C( -270.8500), SIMDE_FLOAT32_C( -345.8400) },
+      { SIMDE_FLOAT32_C(   -0.0248), SIMDE_FLOAT32_C(    0.0019), SIMDE_FLOAT32_C(    0.0021), SIMDE_FLOAT32_C(   -0.0016),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0018), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0040),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0010), SIMDE_FLOAT32_C(   -0.0030), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0024), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0037), SIMDE_FLOAT32_C(   -0.0029) } },
+    { UINT16_C(56600),
+      { SIMDE_FLOAT32_C(  529.7600), SIMDE_FLOAT32_C(  -51.9800), SIMDE_FLOAT32_C( -105.9900), SIMDE_FLOAT32_C( -997.2100),
+        SIMDE_FLOAT32_C(  701.2000), SIMDE_FLOAT32_C(  622.2100), SIMDE_FLOAT32_C(  173.3900), SIMDE_FLOAT32_C(  410.9300),
+        SIMDE_FLOAT32_C( -861.9500), SIMDE_FLOAT32_C( -810.7400), SIMDE_FLOAT32_C( -106.2300), SIMDE_FLOAT32_C( -282.6600),
+        SIMDE_FLOAT32_C( -556.6400), SIMDE_FLOAT32_C(  846.7500), SIMDE_FLOAT32_C( -447.6200), SIMDE_FLOAT32_C(  -29.7600) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0010),
+        SIMDE_FLOAT32_C(    0.0014), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(   -0.0012), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0094), SIMDE_FLOAT32_C(   -0.0035),
+        SIMDE_FLOAT32_C(   -0.0018), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0022), SIMDE_FLOAT32_C(   -0.0336) } },
+    { UINT16_C(52638),
+      { SIMDE_FLOAT32_C( -145.2500), SIMDE_FLOAT32_C(  966.8800), SIMDE_FLOAT32_C( -317.3200), SIMDE_FLOAT32_C(  904.9400),
+        SIMDE_FLOAT32_C(  794.0700), SIMDE_FLOAT32_C( -471.1200), SIMDE_FLOAT32_C(  913.3100), SIMDE_FLOAT32_C( -735.4600),
+        SIMDE_FLOAT32_C(  885.3900), SIMDE_FLOAT32_C( -603.8000), SIMDE_FLOAT32_C( -699.5800), SIMDE_FLOAT32_C( -938.0100),
+        SIMDE_FLOAT32_C( -745.7600), SIMDE_FLOAT32_C( -473.7900), SIMDE_FLOAT32_C( -464.8800), SIMDE_FLOAT32_C(  -28.0500) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0010), SIMDE_FLOAT32_C(   -0.0032), SIMDE_FLOAT32_C(    0.0011),
+        SIMDE_FLOAT32_C(    0.0013), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0014),
+        SIMDE_FLOAT32_C(    0.0011), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0014), SIMDE_FLOAT32_C(   -0.0011),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0022), SIMDE_FLOAT32_C(   -0.0357) } },
+    { UINT16_C(22407),
+      { SIMDE_FLOAT32_C(  304.8900), SIMDE_FLOAT32_C(  500.0800), SIMDE_FLOAT32_C(  414.9900), SIMDE_FLOAT32_C(  774.4900),
+        SIMDE_FLOAT32_C( -892.7000), SIMDE_FLOAT32_C(  -47.4400), SIMDE_FLOAT32_C(  800.2600), SIMDE_FLOAT32_C( -963.4400),
+        SIMDE_FLOAT32_C(  822.0700), SIMDE_FLOAT32_C( -461.5900), SIMDE_FLOAT32_C( -537.7600), SIMDE_FLOAT32_C(  178.2900),
+        SIMDE_FLOAT32_C(  561.1600), SIMDE_FLOAT32_C(   12.4000), SIMDE_FLOAT32_C(  173.9800), SIMDE_FLOAT32_C( -800.1900) },
+      { SIMDE_FLOAT32_C(    0.0033), SIMDE_FLOAT32_C(    0.0020), SIMDE_FLOAT32_C(    0.0024), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0010),
+        SIMDE_FLOAT32_C(    0.0012), SIMDE_FLOAT32_C(   -0.0022), SIMDE_FLOAT32_C(   -0.0019), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0018), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0057), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT16_C(53766),
+      { SIMDE_FLOAT32_C(  336.2600), SIMDE_FLOAT32_C( -827.3300), SIMDE_FLOAT32_C(  159.3100), SIMDE_FLOAT32_C( -899.0600),
+        SIMDE_FLOAT32_C( -287.7800), SIMDE_FLOAT32_C( -260.4100), SIMDE_FLOAT32_C(  535.2800), SIMDE_FLOAT32_C(  338.5600),
+        SIMDE_FLOAT32_C( -697.2600), SIMDE_FLOAT32_C(  215.5700), SIMDE_FLOAT32_C( -974.4000), SIMDE_FLOAT32_C(  165.6100),
+        SIMDE_FLOAT32_C(  382.2300), SIMDE_FLOAT32_C(  -79.0400), SIMDE_FLOAT32_C( -740.7100), SIMDE_FLOAT32_C(  410.3800) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0012), SIMDE_FLOAT32_C(    0.0063), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0046), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0026), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0014), SIMDE_FLOAT32_C(    0.0024) } },
+    { UINT16_C(48527),
+      { SIMDE_FLOAT32_C( -240.4600), SIMDE_FLOAT32_C(  328.3100), SIMDE_FLOAT32_C(  175.8600), SIMDE_FLOAT32_C(  564.8400),
+        SIMDE_FLOAT32_C(  877.6400), SIMDE_FLOAT32_C( -604.5500), SIMDE_FLOAT32_C(  389.6400), SIMDE_FLOAT32_C( -525.6200),
+        SIMDE_FLOAT32_C( -217.1600), SIMDE_FLOAT32_C( -775.4000), SIMDE_FLOAT32_C( -427.0000), SIMDE_FLOAT32_C(  -16.1700),
+        SIMDE_FLOAT32_C(  573.0000), SIMDE_FLOAT32_C(  137.9700), SIMDE_FLOAT32_C(  715.8800), SIMDE_FLOAT32_C(    4.8800) },
+      { SIMDE_FLOAT32_C(   -0.0042), SIMDE_FLOAT32_C(    0.0030), SIMDE_FLOAT32_C(    0.0057), SIMDE_FLOAT32_C(    0.0018),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0019),
+        SIMDE_FLOAT32_C(   -0.0046), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0023), SIMDE_FLOAT32_C(   -0.0618),
+        SIMDE_FLOAT32_C(    0.0017), SIMDE_FLOAT32_C(    0.0072), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.2049) } },
+    { UINT16_C(11379),
+      { SIMDE_FLOAT32_C(  827.9700), SIMDE_FLOAT32_C(  108.2300), SIMDE_FLOAT32_C(  384.8200), SIMDE_FLOAT32_C(  299.7100),
+        SIMDE_FLOAT32_C(  404.5100), SIMDE_FLOAT32_C(  814.4500), SIMDE_FLOAT32_C(  908.0400), SIMDE_FLOAT32_C(  524.0000),
+        SIMDE_FLOAT32_C(  242.1700), SIMDE_FLOAT32_C(  646.8900), SIMDE_FLOAT32_C( -177.3700), SIMDE_FLOAT32_C( -668.0100),
+        SIMDE_FLOAT32_C(  547.5900), SIMDE_FLOAT32_C( -646.3300), SIMDE_FLOAT32_C(  261.5900), SIMDE_FLOAT32_C( -288.6900) },
+      { SIMDE_FLOAT32_C(    0.0012), SIMDE_FLOAT32_C(    0.0092), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0025), SIMDE_FLOAT32_C(    0.0012), SIMDE_FLOAT32_C(    0.0011), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0056), SIMDE_FLOAT32_C(   -0.0015),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0015), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT16_C( 1821),
+      { SIMDE_FLOAT32_C( -199.9200), SIMDE_FLOAT32_C(  -49.0200), SIMDE_FLOAT32_C(  455.5000), SIMDE_FLOAT32_C(  800.7100),
+        SIMDE_FLOAT32_C(  -11.5600), SIMDE_FLOAT32_C( -403.4400), SIMDE_FLOAT32_C( -274.7400), SIMDE_FLOAT32_C( -966.8600),
+        SIMDE_FLOAT32_C(  516.6700), SIMDE_FLOAT32_C( -107.4100), SIMDE_FLOAT32_C( -697.0900), SIMDE_FLOAT32_C( -524.4400),
+        SIMDE_FLOAT32_C(  702.0700), SIMDE_FLOAT32_C( -266.7800), SIMDE_FLOAT32_C(  183.5700), SIMDE_FLOAT32_C(  949.4500) },
+      { SIMDE_FLOAT32_C(   -0.0050), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0022), SIMDE_FLOAT32_C(    0.0012),
+        SIMDE_FLOAT32_C(   -0.0865), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0019), SIMDE_FLOAT32_C(   -0.0093), SIMDE_FLOAT32_C(   -0.0014), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_maskz_rcp28_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_rcp28_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C( -742.5100), SIMDE_FLOAT64_C( -127.6300), SIMDE_FLOAT64_C( -700.1100), SIMDE_FLOAT64_C(  525.9500),
+        SIMDE_FLOAT64_C(  518.2500), SIMDE_FLOAT64_C( -600.2500), SIMDE_FLOAT64_C( -750.8100), SIMDE_FLOAT64_C(   -0.3600) },
+      { SIMDE_FLOAT64_C(   -0.0013), SIMDE_FLOAT64_C(   -0.0078), SIMDE_FLOAT64_C(   -0.0014), SIMDE_FLOAT64_C(    0.0019),
+        SIMDE_FLOAT64_C(    0.0019), SIMDE_FLOAT64_C(   -0.0017), SIMDE_FLOAT64_C(   -0.0013), SIMDE_FLOAT64_C(   -2.7778) } },
+    { { SIMDE_FLOAT64_C(  986.9200), SIMDE_FLOAT64_C(  528.2500), SIMDE_FLOAT64_C(  929.7500), SIMDE_FLOAT64_C(  628.3600),
+        SIMDE_FLOAT64_C( -511.8800), SIMDE_FLOAT64_C(  675.1800), SIMDE_FLOAT64_C(  315.3900), SIMDE_FLOAT64_C( -688.9300) },
+      { SIMDE_FLOAT64_C(    0.0010), SIMDE_FLOAT64_C(    0.0019), SIMDE_FLOAT64_C(    0.0011), SIMDE_FLOAT64_C(    0.0016),
+        SIMDE_FLOAT64_C(   -0.0020), SIMDE_FLOAT64_C(    0.0015), SIMDE_FLOAT64_C(    0.0032), SIMDE_FLOAT64_C(   -0.0015) } },
+    { { SIMDE_FLOAT64_C( -599.7300), SIMDE_FLOAT64_C( -143.8200), SIMDE_FLOAT64_C( -416.8900), SIMDE_FLOAT64_C(  485.8500),
+        SIMDE_FLOAT64_C(  347.1700), SIMDE_FLOAT64_C( -508.3400), SIMDE_FLOAT64_C(  830.2100), SIMDE_FLOAT64_C(   -5.3100) },
+      { SIMDE_FLOAT64_C(   -0.0017), SIMDE_FLOAT64_C(   -0.0070), SIMDE_FLOAT64_C(   -0.0024), SIMDE_FLOAT64_C(    0.0021),
+        SIMDE_FLOAT64_C(    0.0029), SIMDE_FLOAT64_C(   -0.0020), SIMDE_FLOAT64_C(    0.0012), SIMDE_FLOAT64_C(   -0.1883) } },
+    { { SIMDE_FLOAT64_C(  847.5500), SIMDE_FLOAT64_C(  -67.4900), SIMDE_FLOAT64_C(   58.0500), SIMDE_FLOAT64_C(  166.6500),
+        SIMDE_FLOAT64_C(   68.2900), SIMDE_FLOAT64_C(  767.2600), SIMDE_FLOAT64_C(  977.4400), SIMDE_FLOAT64_C(  457.6700) },
+      { SIMDE_FLOAT64_C(    0.0012), SIMDE_FLOAT64_C(   -0.0148), SIMDE_FLOAT64_C(    0.0172), SIMDE_FLOAT64_C(    0.0060),
+        SIMDE_FLOAT64_C(    0.0146), SIMDE_FLOAT64_C(    0.0013), SIMDE_FLOAT64_C(    0.0010), SIMDE_FLOAT64_C(    0.0022) } },
+    { { SIMDE_FLOAT64_C( -453.0800), SIMDE_FLOAT64_C( -722.0000), SIMDE_FLOAT64_C(   38.1200), SIMDE_FLOAT64_C( -761.1100),
+        SIMDE_FLOAT64_C( -511.5600), SIMDE_FLOAT64_C( -670.5900), SIMDE_FLOAT64_C(  315.1600), SIMDE_FLOAT64_C(   78.6800) },
+      { SIMDE_FLOAT64_C(   -0.0022), SIMDE_FLOAT64_C(   -0.0014), SIMDE_FLOAT64_C(    0.0262), SIMDE_FLOAT64_C(   -0.0013),
+        SIMDE_FLOAT64_C(   -0.0020), SIMDE_FLOAT64_C(   -0.0015), SIMDE_FLOAT64_C(    0.0032), SIMDE_FLOAT64_C(    0.0127) } },
+    { { SIMDE_FLOAT64_C(  655.3700), SIMDE_FLOAT64_C(  698.8200), SIMDE_FLOAT64_C(  499.5300), SIMDE_FLOAT64_C(  370.3900),
+        SIMDE_FLOAT64_C(  168.2900), SIMDE_FLOAT64_C( -172.5200), SIMDE_FLOAT64_C(  755.9200), SIMDE_FLOAT64_C(  140.8600) },
+      { SIMDE_FLOAT64_C(    0.0015), SIMDE_FLOAT64_C(    0.0014), SIMDE_FLOAT64_C(    0.0020), SIMDE_FLOAT64_C(    0.0027),
+        SIMDE_FLOAT64_C(    0.0059), SIMDE_FLOAT64_C(   -0.0058), SIMDE_FLOAT64_C(    0.0013), SIMDE_FLOAT64_C(    0.0071) } },
+    { { SIMDE_FLOAT64_C(   59.5000), SIMDE_FLOAT64_C(  615.4600), SIMDE_FLOAT64_C(  925.0100), SIMDE_FLOAT64_C(  939.5300),
+        SIMDE_FLOAT64_C(  -52.8400), SIMDE_FLOAT64_C(  827.2200), SIMDE_FLOAT64_C(  831.2800), SIMDE_FLOAT64_C(  985.2400) },
+      { SIMDE_FLOAT64_C(    0.0168), SIMDE_FLOAT64_C(    0.0016), SIMDE_FLOAT64_C(    0.0011), SIMDE_FLOAT64_C(    0.0011),
+        SIMDE_FLOAT64_C(   -0.0189), SIMDE_FLOAT64_C(    0.0012), SIMDE_FLOAT64_C(    0.0012), SIMDE_FLOAT64_C(    0.0010) } },
+    { { SIMDE_FLOAT64_C(   13.9800), SIMDE_FLOAT64_C( -447.7800), SIMDE_FLOAT64_C(  185.8600), SIMDE_FLOAT64_C( -352.2800),
+        SIMDE_FLOAT64_C(  949.3400), SIMDE_FLOAT64_C(  157.9400), SIMDE_FLOAT64_C(  587.6700), SIMDE_FLOAT64_C(  384.8900) },
+      { SIMDE_FLOAT64_C(    0.0715), SIMDE_FLOAT64_C(   -0.0022), SIMDE_FLOAT64_C(    0.0054), SIMDE_FLOAT64_C(   -0.0028),
+        SIMDE_FLOAT64_C(    0.0011), SIMDE_FLOAT64_C(    0.0063), SIMDE_FLOAT64_C(    0.0017), SIMDE_FLOAT64_C(    0.0026) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_rcp28_pd(a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_rcp28_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[8];
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C( -183.7400), SIMDE_FLOAT64_C(  356.5100), SIMDE_FLOAT64_C(  397.5300), SIMDE_FLOAT64_C( -377.7400),
+        SIMDE_FLOAT64_C(  624.7200), SIMDE_FLOAT64_C( -378.6600), SIMDE_FLOAT64_C(   36.3100), SIMDE_FLOAT64_C( -473.3400) },
+      UINT8_C( 61),
+      { SIMDE_FLOAT64_C(  -68.5100), SIMDE_FLOAT64_C(  923.7200), SIMDE_FLOAT64_C(  795.0800), SIMDE_FLOAT64_C( -565.0500),
+        SIMDE_FLOAT64_C(  863.4700), SIMDE_FLOAT64_C(  970.7400), SIMDE_FLOAT64_C(  970.4800), SIMDE_FLOAT64_C(  915.2200) },
+      { SIMDE_FLOAT64_C(   -0.0146), SIMDE_FLOAT64_C(  356.5100), SIMDE_FLOAT64_C(    0.0013), SIMDE_FLOAT64_C(   -0.0018),
+        SIMDE_FLOAT64_C(    0.0012), SIMDE_FLOAT64_C(    0.0010), SIMDE_FLOAT64_C(   36.3100), SIMDE_FLOAT64_C( -473.3400) } },
+    { { SIMDE_FLOAT64_C(  693.3500), SIMDE_FLOAT64_C(  447.4900), SIMDE_FLOAT64_C( -431.8300), SIMDE_FLOAT64_C(  875.7000),
+        SIMDE_FLOAT64_C(  934.0900), SIMDE_FLOAT64_C( -310.8500), SIMDE_FLOAT64_C(   82.8300), SIMDE_FLOAT64_C(  500.7400) },
+      UINT8_C( 30),
+      { SIMDE_FLOAT64_C(   32.0000), SIMDE_FLOAT64_C( -315.8900), SIMDE_FLOAT64_C(  -12.5400), SIMDE_FLOAT64_C( -244.0700),
+        SIMDE_FLOAT64_C(  547.8400), SIMDE_FLOAT64_C(  954.5300), SIMDE_FLOAT64_C( -212.0400), SIMDE_FLOAT64_C( -583.5500) },
+      { SIMDE_FLOAT64_C(  693.3500), SIMDE_FLOAT64_C(   -0.0032), SIMDE_FLOAT64_C(   -0.0797), SIMDE_FLOAT64_C(   -0.0041),
+        SIMDE_FLOAT64_C(    0.0018), SIMDE_FLOAT64_C( -310.8500), SIMDE_FLOAT64_C(   82.8300), SIMDE_FLOAT64_C(  500.7400) } },
+    { { SIMDE_FLOAT64_C(  508.6200), SIMDE_FLOAT64_C( -611.2500), SIMDE_FLOAT64_C(   92.5700), SIMDE_FLOAT64_C(  113.5900),
+        SIMDE_FLOAT64_C(  102.7700), SIMDE_FLOAT64_C(  162.5300), SIMDE_FLOAT64_C(   25.8300), SIMDE_FLOAT64_C( -611.9400) },
+      UINT8_C( 47),
+      { SIMDE_FLOAT64_C(  -61.6500), SIMDE_FLOAT64_C(  995.0000), SIMDE_FLOAT64_C( -442.7500), SIMDE_FLOAT64_C(   -1.5800),
+        SIMDE_FLOAT64_C(  544.3900), SIMDE_FLOAT64_C(  679.0100), SIMDE_FLOAT64_C( -373.1300), SIMDE_FLOAT64_C( -962.2400) },
+      { SIMDE_FLOAT64_C(   -0.0162), SIMDE_FLOAT64_C(    0.0010), SIMDE_FLOAT64_C(   -0.0023), SIMDE_FLOAT64_C(   -0.6329),
+        SIMDE_FLOAT64_C(  102.7700), SIMDE_FLOAT64_C(    0.0015), SIMDE_FLOAT64_C(   25.8300), SIMDE_FLOAT64_C( -611.9400) } },
+    { { SIMDE_FLOAT64_C(  538.3100), SIMDE_FLOAT64_C(  249.6300), SIMDE_FLOAT64_C(  943.9000), SIMDE_FLOAT64_C(  474.0600),
+        SIMDE_FLOAT64_C( -865.4200), SIMDE_FLOAT64_C(  710.2700), SIMDE_FLOAT64_C(  673.2700), SIMDE_FLOAT64_C(   18.2900) },
+      UINT8_C( 78),
+      { SIMDE_FLOAT64_C( -180.8000), SIMDE_FLOAT64_C( -901.5900), SIMDE_FLOAT64_C( -474.3600), SIMDE_FLOAT64_C( -718.3400),
+        SIMDE_FLOAT64_C(  363.5500), SIMDE_FLOAT64_C( -205.3100), SIMDE_FLOAT64_C(  344.5500), SIMDE_FLOAT64_C( -107.2700) },
+      { SIMDE_FLOAT64_C(  538.3100), SIMDE_FLOAT64_C(   -0.0011), SIMDE_FLOAT64_C(   -0.0021), SIMDE_FLOAT64_C(   -0.0014),
+        SIMDE_FLOAT64_C( -865.4200), SIMDE_FLOAT64_C(  710.2700), SIMDE_FLOAT64_C(    0.0029), SIMDE_FLOAT64_C(   18.2900) } },
+    { { SIMDE_FLOAT64_C(  692.2500), SIMDE_FLOAT64_C( -932.6700), SIMDE_FLOAT64_C(  382.6500), SIMDE_FLOAT64_C(  -67.5900),
+        SIMDE_FLOAT64_C( -209.4300), SIMDE_FLOAT64_C(  930.7700), SIMDE_FLOAT64_C(  -82.9300), SIMDE_FLOAT64_C(  287.9100) },
+      UINT8_C( 22),
+      { SIMDE_FLOAT64_C(  226.9300), SIMDE_FLOAT64_C(  926.1700), SIMDE_FLOAT64_C( -726.5800), SIMDE_FLOAT64_C( -574.5200),
+        SIMDE_FLOAT64_C(  674.8200), SIMDE_FLOAT64_C( -871.4900), SIMDE_FLOAT64_C(  570.7100), SIMDE_FLOAT64_C( -569.8000) },
+      { SIMDE_FLOAT64_C(  692.2500), SIMDE_FLOAT64_C(    0.0011), SIMDE_FLOAT64_C(   -0.0014), SIMDE_FLOAT64_C(  -67.5900),
+        SIMDE_FLOAT64_C(    0.0015), SIMDE_FLOAT64_C(  930.7700), SIMDE_FLOAT64_C(  -82.9300), SIMDE_FLOAT64_C(  287.9100) } },
+    { { SIMDE_FLOAT64_C( -450.3200), SIMDE_FLOAT64_C(  575.6900), SIMDE_FLOAT64_C( -192.2800), SIMDE_FLOAT64_C(  -38.0000),
+        SIMDE_FLOAT64_C(  753.5400), SIMDE_FLOAT64_C( -509.1300), SIMDE_FLOAT64_C(  -67.5200), SIMDE_FLOAT64_C( -600.1700) },
+      UINT8_C(164),
+      { SIMDE_FLOAT64_C(  320.1300), SIMDE_FLOAT64_C(  529.8300), SIMDE_FLOAT64_C( -584.8800), SIMDE_FLOAT64_C( -883.5800),
+        SIMDE_FLOAT64_C( -355.4100), SIMDE_FLOAT64_C(  782.8300), SIMDE_FLOAT64_C( -980.0900), SIMDE_FLOAT64_C(  280.3500) },
+      { SIMDE_FLOAT64_C( -450.3200), SIMDE_FLOAT64_C(  575.6900), SIMDE_FLOAT64_C(   -0.0017), SIMDE_FLOAT64_C(  -38.0000),
+        SIMDE_FLOAT64_C(  753.5400), SIMDE_FLOAT64_C(    0.0013), SIMDE_FLOAT64_C(  -67.5200), SIMDE_FLOAT64_C(    0.0036) } },
+    { { SIMDE_FLOAT64_C(  427.5300), SIMDE_FLOAT64_C(  251.6300), SIMDE_FLOAT64_C(  976.9700), SIMDE_FLOAT64_C(  135.4000),
+        SIMDE_FLOAT64_C(  -25.3900), SIMDE_FLOAT64_C( -106.6400), SIMDE_FLOAT64_C( -175.3200), SIMDE_FLOAT64_C(  236.9500) },
+      UINT8_C(155),
+      { SIMDE_FLOAT64_C( -427.6400), SIMDE_FLOAT64_C(  808.3800), SIMDE_FLOAT64_C(  802.7000), SIMDE_FLOAT64_C( -412.5400),
+        SIMDE_FLOAT64_C( -449.9900), SIMDE_FLOAT64_C( -186.1000), SIMDE_FLOAT64_C( -534.3800), SIMDE_FLOAT64_C( -911.9800) },
+      { SIMDE_FLOAT64_C(   -0.0023), SIMDE_FLOAT64_C(    0.0012), SIMDE_FLOAT64_C(  976.9700), SIMDE_FLOAT64_C(   -0.0024),
+        SIMDE_FLOAT64_C(   -0.0022), SIMDE_FLOAT64_C( -106.6400), SIMDE_FLOAT64_C( -175.3200), SIMDE_FLOAT64_C(   -0.0011) } },
+    { { SIMDE_FLOAT64_C( -777.6100), SIMDE_FLOAT64_C( -885.9700), SIMDE_FLOAT64_C( -509.1900), SIMDE_FLOAT64_C( -982.0900),
+        SIMDE_FLOAT64_C( -571.1200), SIMDE_FLOAT64_C( -133.6600), SIMDE_FLOAT64_C( -294.9700), SIMDE_FLOAT64_C( -859.4100) },
+      UINT8_C(  8),
+      { SIMDE_FLOAT64_C(  -45.1400), SIMDE_FLOAT64_C(  517.2100), SIMDE_FLOAT64_C(  360.4500), SIMDE_FLOAT64_C( -497.9600),
+        SIMDE_FLOAT64_C( -771.7400), SIMDE_FLOAT64_C(  301.4400), SIMDE_FLOAT64_C(  151.5000), SIMDE_FLOAT64_C( -257.9600) },
+      { SIMDE_FLOAT64_C( -777.6100), SIMDE_FLOAT64_C( -885.9700), SIMDE_FLOAT64_C( -509.1900), SIMDE_FLOAT64_C(   -0.0020),
+        SIMDE_FLOAT64_C( -571.1200), SIMDE_FLOAT64_C( -133.6600), SIMDE_FLOAT64_C( -294.9700), SIMDE_FLOAT64_C( -859.4100) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d src = simde_mm512_loadu_pd(test_vec[i].src);
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_mask_rcp28_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_rcp28_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { UINT8_C(179),
+      { SIMDE_FLOAT64_C( -840.6800), SIMDE_FLOAT64_C(  592.1000), SIMDE_FLOAT64_C(  564.5900), SIMDE_FLOAT64_C( -253.4700),
+        SIMDE_FLOAT64_C(  200.0900), SIMDE_FLOAT64_C( -338.6100), SIMDE_FLOAT64_C(  506.1400), SIMDE_FLOAT64_C( -341.7400) },
+      { SIMDE_FLOAT64_C(   -0.0012), SIMDE_FLOAT64_C(    0.0017), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(    0.0050), SIMDE_FLOAT64_C(   -0.0030), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(   -0.0029) } },
+    { UINT8_C(212),
+      { SIMDE_FLOAT64_C(  594.9900), SIMDE_FLOAT64_C( -255.0700), SIMDE_FLOAT64_C(  183.0400), SIMDE_FLOAT64_C(  286.1600),
+        SIMDE_FLOAT64_C(   39.9200), SIMDE_FLOAT64_C(  248.4500), SIMDE_FLOAT64_C(  454.6900), SIMDE_FLOAT64_C( -230.1200) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0055), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(    0.0251), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0022), SIMDE_FLOAT64_C(   -0.0043) } },
+    { UINT8_C( 12),
+      { SIMDE_FLOAT64_C(  695.1100), SIMDE_FLOAT64_C(  777.5000), SIMDE_FLOAT64_C(  762.5800), SIMDE_FLOAT64_C( -973.1700),
+        SIMDE_FLOAT64_C(  204.7400), SIMDE_FLOAT64_C(   72.7200), SIMDE_FLOAT64_C( -475.3900), SIMDE_FLOAT64_C(  447.9800) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0013), SIMDE_FLOAT64_C(   -0.0010),
+        SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C(215),
+      { SIMDE_FLOAT64_C(    1.4700), SIMDE_FLOAT64_C(  562.8100), SIMDE_FLOAT64_C(  718.8700), SIMDE_FLOAT64_C(  497.6600),
+        SIMDE_FLOAT64_C(  486.8700), SIMDE_FLOAT64_C(  808.7400), SIMDE_FLOAT64_C(   52.7300), SIMDE_FLOAT64_C(  315.9300) },
+      { SIMDE_FLOAT64_C(    0.6803), SIMDE_FLOAT64_C(    0.0018), SIMDE_FLOAT64_C(    0.0014), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(    0.0021), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0190), SIMDE_FLOAT64_C(    0.0032) } },
+    { UINT8_C(118),
+      { SIMDE_FLOAT64_C(  -31.3700), SIMDE_FLOAT64_C( -549.0500), SIMDE_FLOAT64_C(  -53.0200), SIMDE_FLOAT64_C(  678.3500),
+        SIMDE_FLOAT64_C( -411.0300), SIMDE_FLOAT64_C(  931.6300), SIMDE_FLOAT64_C( -212.1300), SIMDE_FLOAT64_C( -432.1900) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(   -0.0018), SIMDE_FLOAT64_C(   -0.0189), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(   -0.0024), SIMDE_FLOAT64_C(    0.0011), SIMDE_FLOAT64_C(   -0.0047), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C(235),
+      { SIMDE_FLOAT64_C( -698.4300), SIMDE_FLOAT64_C(  454.9600), SIMDE_FLOAT64_C( -532.8900), SIMDE_FLOAT64_C( -229.0300),
+        SIMDE_FLOAT64_C(  825.6400), SIMDE_FLOAT64_C(  306.4600), SIMDE_FLOAT64_C( -504.1500), SIMDE_FLOAT64_C(  159.6100) },
+      { SIMDE_FLOAT64_C(   -0.0014), SIMDE_FLOAT64_C(    0.0022), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(   -0.0044),
+        SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0033), SIMDE_FLOAT64_C(   -0.0020), SIMDE_FLOAT64_C(    0.0063) } },
+    { UINT8_C(226),
+      { SIMDE_FLOAT64_C(  459.7100), SIMDE_FLOAT64_C(  587.7600), SIMDE_FLOAT64_C(  254.4100), SIMDE_FLOAT64_C( -269.4100),
+        SIMDE_FLOAT64_C(  862.6800), SIMDE_FLOAT64_C( -103.1300), SIMDE_FLOAT64_C(  124.5800), SIMDE_FLOAT64_C( -780.9800) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0017), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(   -0.0097), SIMDE_FLOAT64_C(    0.0080), SIMDE_FLOAT64_C(   -0.0013) } },
+    { UINT8_C(205),
+      { SIMDE_FLOAT64_C(  654.3200), SIMDE_FLOAT64_C(  668.3000), SIMDE_FLOAT64_C( -289.0000), SIMDE_FLOAT64_C(  850.0300),
+        SIMDE_FLOAT64_C( -505.6200), SIMDE_FLOAT64_C(   69.4000), SIMDE_FLOAT64_C(  771.5700), SIMDE_FLOAT64_C(  387.2200) },
+      { SIMDE_FLOAT64_C(    0.0015), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(   -0.0035), SIMDE_FLOAT64_C(    0.0012),
+        SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0013), SIMDE_FLOAT64_C(    0.0026) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_maskz_rcp28_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_rcp14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_rcp14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_rcp14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_rcp14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_rcp14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_rcp14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_rcp14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_rcp14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_rcp14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_rcp14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_rcp14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_rcp14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_rcp14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_rcp14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_rcp14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_rcp14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_rcp14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_rcp14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_rcp14_ss)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_rcp14_ss)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_rcp14_ss)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_rcp14_sd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_rcp14_sd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_rcp14_sd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_rcp28_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_rcp28_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_rcp28_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_rcp28_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_rcp28_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_rcp28_pd)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
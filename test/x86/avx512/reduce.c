@@ -0,0 +1,2395 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN reduce
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/reduce.h>
+
+static int
+test_simde_mm512_reduce_add_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { {  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),  INT32_C(   310840079),
+        -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1128593813), -INT32_C(  1249725146), -INT32_C(  1351075380),  INT32_C(  1987001023), -INT32_C(  1039226102) },
+       INT32_C(  1690375902) },
+    { {  INT32_C(  1912893877),  INT32_C(  2112271382),  INT32_C(   969850110), -INT32_C(  1853628921),  INT32_C(  1029814395),  INT32_C(  1709966795), -INT32_C(  1868574976), -INT32_C(   661573474),
+         INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307),  INT32_C(   163300206),  INT32_C(   635809640) },
+      -INT32_C(   257801157) },
+    { { -INT32_C(  1498711350), -INT32_C(  1222648129),  INT32_C(    30781122),  INT32_C(   224130335), -INT32_C(  1519000267),  INT32_C(  1084154815),  INT32_C(  1050726840),  INT32_C(   686358043),
+        -INT32_C(  1995716313), -INT32_C(   853182603), -INT32_C(  1397079845), -INT32_C(  1470340454),  INT32_C(   133774559),  INT32_C(   183376230),  INT32_C(   637099220), -INT32_C(   224060563) },
+      -INT32_C(  1855371064) },
+    { { -INT32_C(   277318001), -INT32_C(  1188117086), -INT32_C(  1140084567),  INT32_C(  1754967432), -INT32_C(   185074989), -INT32_C(   965295642),  INT32_C(  1270650341),  INT32_C(  1236153742),
+        -INT32_C(  1429484955), -INT32_C(   448633679),  INT32_C(  2096622648), -INT32_C(  1045295648), -INT32_C(   151514629), -INT32_C(  1726021864), -INT32_C(  1749285658),  INT32_C(  1204847983) },
+       INT32_C(  1552082724) },
+    { { -INT32_C(  1978669606), -INT32_C(  1921266543), -INT32_C(   745521336), -INT32_C(   406991562), -INT32_C(  1291896020),  INT32_C(   629509722),  INT32_C(   317346758),  INT32_C(  2145498849),
+         INT32_C(   641199564),  INT32_C(  1981247767), -INT32_C(  1888486859), -INT32_C(  1949628287),  INT32_C(  1554947792),  INT32_C(   397441005),  INT32_C(  1610304578),  INT32_C(   783018586) },
+      -INT32_C(   121945592) },
+    { {  INT32_C(    15392344),  INT32_C(   710909412), -INT32_C(  1813062689), -INT32_C(  2125196888),  INT32_C(  1785844619), -INT32_C(  1485262100),  INT32_C(  1666545801), -INT32_C(     5451720),
+         INT32_C(  1951434648),  INT32_C(   658817175),  INT32_C(   629443798),  INT32_C(    32010319), -INT32_C(  1960815761), -INT32_C(  1436735479),  INT32_C(   124825625), -INT32_C(   786204871) },
+      -INT32_C(  2037505767) },
+    { {  INT32_C(   646181352),  INT32_C(   605654027), -INT32_C(   401220141),  INT32_C(   274260648),  INT32_C(   617609581), -INT32_C(   940859937), -INT32_C(   714023644), -INT32_C(   696912482),
+        -INT32_C(  1442989579), -INT32_C(   848126010),  INT32_C(  1766148985), -INT32_C(   822853713),  INT32_C(   464772112),  INT32_C(   597802920), -INT32_C(   707651881),  INT32_C(  1146283834) },
+      -INT32_C(   455923928) },
+    { { -INT32_C(  1685485332),  INT32_C(  1245389053),  INT32_C(   360761852), -INT32_C(   629655697),  INT32_C(   649002177), -INT32_C(   197873288), -INT32_C(  1091860966),  INT32_C(  1352177558),
+        -INT32_C(  2003008711), -INT32_C(   231451521), -INT32_C(   496712937), -INT32_C(  2142228655), -INT32_C(   936412337),  INT32_C(  1845106297), -INT32_C(  1321116651), -INT32_C(  1205044243) },
+       INT32_C(  2101521191) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_reduce_add_epi32(a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_add_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { UINT16_C(30810),
+      { -INT32_C(   199149526), -INT32_C(   583651110),  INT32_C(  2137860667),  INT32_C(   381689519), -INT32_C(   543435438), -INT32_C(  1802766728),  INT32_C(   616071060),  INT32_C(  1808427627),
+        -INT32_C(    30145409), -INT32_C(  1557621833),  INT32_C(  1889324880), -INT32_C(   113761586),  INT32_C(  1082990859), -INT32_C(   327738999), -INT32_C(   357779974), -INT32_C(   792079855) },
+       INT32_C(   154384331) },
+    { UINT16_C(58869),
+      {  INT32_C(   853954942), -INT32_C(  1484783012),  INT32_C(    70522200),  INT32_C(   829827954),  INT32_C(  1589140388),  INT32_C(   423707155), -INT32_C(  1546705833), -INT32_C(    25866273),
+         INT32_C(   371307136), -INT32_C(  1241820699),  INT32_C(   712277510), -INT32_C(   435431558), -INT32_C(  1653252524),  INT32_C(   956473832),  INT32_C(  2125717163),  INT32_C(  1086354390) },
+      -INT32_C(  1973051982) },
+    { UINT16_C(50865),
+      { -INT32_C(  2131705476),  INT32_C(  1913847806), -INT32_C(  1196104319),  INT32_C(  2052639754),  INT32_C(   960118546), -INT32_C(   235024404), -INT32_C(  1367978125),  INT32_C(  2131566381),
+         INT32_C(  1945595475),  INT32_C(   966751311), -INT32_C(  1535723161),  INT32_C(     1502677), -INT32_C(  1869933234), -INT32_C(   200371996), -INT32_C(  1009503035), -INT32_C(   635564564) },
+      -INT32_C(  1489084402) },
+    { UINT16_C(51959),
+      {  INT32_C(  1519805090),  INT32_C(  1210164967), -INT32_C(   825181078), -INT32_C(   976533614),  INT32_C(  1029272989), -INT32_C(  1885274058),  INT32_C(   328503222), -INT32_C(   684422359),
+         INT32_C(  1914898559),  INT32_C(   139768239),  INT32_C(  1967493900),  INT32_C(  1795054378), -INT32_C(   522179300), -INT32_C(  1375393210),  INT32_C(  2021618066),  INT32_C(  1384360945) },
+       INT32_C(  1738703105) },
+    { UINT16_C(28902),
+      { -INT32_C(  1012632185),  INT32_C(  1826012332), -INT32_C(   744506667), -INT32_C(  1018392352), -INT32_C(   462409279),  INT32_C(   138969570),  INT32_C(  2022058081),  INT32_C(  1309875313),
+         INT32_C(   802424329),  INT32_C(   583076933),  INT32_C(  1970618141),  INT32_C(  2004202019), -INT32_C(  1984056953), -INT32_C(  1514517724), -INT32_C(   798787918),  INT32_C(  1920359647) },
+       INT32_C(   255046034) },
+    { UINT16_C(26534),
+      { -INT32_C(   203232535), -INT32_C(  1357204100), -INT32_C(   127246570),  INT32_C(  1388285480), -INT32_C(   665552076), -INT32_C(   501702974),  INT32_C(  1692229503),  INT32_C(  1890507265),
+        -INT32_C(    44881931), -INT32_C(  1184178950),  INT32_C(   146175939),  INT32_C(  1880787948), -INT32_C(    19675653),  INT32_C(   771783856),  INT32_C(   591876169), -INT32_C(   510726999) },
+       INT32_C(   185128704) },
+    { UINT16_C(64304),
+      {  INT32_C(  1744515270),  INT32_C(   330184487),  INT32_C(  1978811017),  INT32_C(   423633996),  INT32_C(  1073362692),  INT32_C(  2101117546),  INT32_C(   662118894), -INT32_C(    23694291),
+         INT32_C(  1366946693), -INT32_C(  1819066078), -INT32_C(  2113900768), -INT32_C(  1794660354),  INT32_C(   928618289), -INT32_C(   519387041),  INT32_C(   695151119), -INT32_C(  1199532133) },
+       INT32_C(   832550733) },
+    { UINT16_C( 4212),
+      { -INT32_C(   424275116),  INT32_C(   980494962), -INT32_C(  1907551066),  INT32_C(    10381071),  INT32_C(    31815681),  INT32_C(   383423153), -INT32_C(   106058796),  INT32_C(   726173059),
+        -INT32_C(  1893788600), -INT32_C(   376620960),  INT32_C(  1111243280),  INT32_C(  1883031140),  INT32_C(  1525786344), -INT32_C(   306511963),  INT32_C(  2065613594),  INT32_C(   738424860) },
+      -INT32_C(    72584684) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_mask_reduce_add_epi32(test_vec[i].k, a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_add_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { { -INT64_C( 2629487909595791585), -INT64_C(  171194200390684767),  INT64_C(   56190361115873726), -INT64_C( 4872281965987805283),
+        -INT64_C(  711191726004338094), -INT64_C( 6010904529056368682), -INT64_C( 2201811294784954439), -INT64_C( 4516742828171895482) },
+      -INT64_C( 2610680019166412990) },
+    { {  INT64_C( 6736888301887731952), -INT64_C( 2020964719230614143), -INT64_C( 2490357704446339382), -INT64_C( 6737883151112157337),
+        -INT64_C( 2917492478690049239),  INT64_C( 7629695202412475887),  INT64_C(  424595470171256388),  INT64_C( 8651970575610199848) },
+      -INT64_C( 9170292577107047642) },
+    { {  INT64_C( 4494863741200143550), -INT64_C( 5789402867658362345), -INT64_C( 9141795009349605581), -INT64_C( 8796605016338725443),
+        -INT64_C( 4266457810913745162), -INT64_C( 5654497847802049477), -INT64_C( 7107657460835206557),  INT64_C( 5326153834540844247) },
+       INT64_C( 5958089710262396464) },
+    { { -INT64_C( 1901496157936508243), -INT64_C( 3968992844273061720), -INT64_C( 3480129353923147703),  INT64_C( 7584524186625211033),
+         INT64_C( 5856042888738026028),  INT64_C( 5199634192531383368),  INT64_C( 4695485195273464704), -INT64_C( 2725789186476652201) },
+      -INT64_C( 7187465153150836350) },
+    { { -INT64_C( 5744580008201632407), -INT64_C( 5026555693086796125),  INT64_C( 1593587546853371470), -INT64_C( 1633307962869456622),
+        -INT64_C( 2797870153919637680), -INT64_C( 2308662562189220610), -INT64_C(  385658129923443529), -INT64_C( 3897993864887243106) },
+      -INT64_C( 1754296754514506993) },
+    { {  INT64_C( 3649161542835597288), -INT64_C( 3843885957127150793), -INT64_C( 5467937335186396367), -INT64_C( 4425562764106744921),
+         INT64_C(  386538592324207376),  INT64_C( 8470617086781483670),  INT64_C( 2228354169863103171), -INT64_C( 6993240823103007546) },
+      -INT64_C( 5995955487718908122) },
+    { {  INT64_C( 3579213381597733336),  INT64_C( 2535660807365246363),  INT64_C( 7383378515808583200), -INT64_C( 8246211273663120164),
+         INT64_C( 8962094839713149477),  INT64_C( 2016284864048035329), -INT64_C( 7544549160191721811),  INT64_C( 1694616711332785168) },
+      -INT64_C( 8066255387698860718) },
+    { { -INT64_C( 1073871451750081119),  INT64_C( 5120429355873834074),  INT64_C( 4822981666394959346),  INT64_C( 4270869233525142441),
+        -INT64_C( 8330807143750423666),  INT64_C( 5621739079920121945), -INT64_C( 1744484555942007319),  INT64_C( 1060181250384617586) },
+      -INT64_C( 8699706639053388328) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_reduce_add_epi64(a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_add_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { UINT8_C( 50),
+      { -INT64_C(  471724968844444134),  INT64_C( 3627588791148497126),  INT64_C( 2962458508571148791),  INT64_C( 3866144702859539252),
+         INT64_C( 4253519003154995410),  INT64_C( 7560511074961716963),  INT64_C( 7011069429251101134), -INT64_C( 5039042098760819731) },
+      -INT64_C( 3005125204444342117) },
+    { UINT8_C( 26),
+      {  INT64_C( 5076705395112871142),  INT64_C( 6507628938042473327),  INT64_C( 8690514188951348569), -INT64_C( 4357624654340535085),
+         INT64_C( 4349426067929956490),  INT64_C(  157540960976958987), -INT64_C( 5943413792446013145), -INT64_C( 5174637272530175323) },
+       INT64_C( 6499430351631894732) },
+    { UINT8_C(144),
+      {  INT64_C( 4149021102124369577),  INT64_C( 4907457194919657188), -INT64_C( 7839437355893851623), -INT64_C( 6345447436957952595),
+         INT64_C( 2570376509666620486), -INT64_C( 3925594392230004178),  INT64_C( 7532306783162829658), -INT64_C( 6780544650761125172) },
+      -INT64_C( 4210168141094504686) },
+    { UINT8_C( 73),
+      { -INT64_C( 4440673734464226497),  INT64_C( 4266945807794217097), -INT64_C( 9012016030339729528),  INT64_C( 8374103272151672679),
+         INT64_C( 2105710444070849641), -INT64_C( 6624237464019718479),  INT64_C( 5044712966659909804), -INT64_C( 3832606698236762115) },
+       INT64_C( 8978142504347355986) },
+    { UINT8_C(242),
+      { -INT64_C( 6130781068915052607), -INT64_C( 6858834774885106082), -INT64_C( 2848277749737723614),  INT64_C( 5877258230907246192),
+        -INT64_C( 3350578217424460452),  INT64_C( 4660148489545757590),  INT64_C( 1689803040802042737),  INT64_C( 8036961616177876439) },
+       INT64_C( 4177500154216110232) },
+    { UINT8_C(140),
+      { -INT64_C( 4475716499743543599),  INT64_C( 6227625017638463052),  INT64_C( 4411316986998976256),  INT64_C( 8754770134534250462),
+        -INT64_C( 2611453723976871455),  INT64_C( 7520343922859929602), -INT64_C( 7844606146125981086), -INT64_C( 5165140637715733546) },
+       INT64_C( 8000946483817493172) },
+    { UINT8_C(145),
+      {  INT64_C( 8315470813116160622), -INT64_C( 2084711833624488870),  INT64_C(   52346243293873778),  INT64_C( 1767540057843035646),
+        -INT64_C( 6082627492135611995),  INT64_C( 6397091974064369222),  INT64_C( 7185061726029056026), -INT64_C( 4285387708492635766) },
+      -INT64_C( 2052544387512087139) },
+    { UINT8_C( 73),
+      { -INT64_C( 3319999692834128147),  INT64_C( 5496365533142535120),  INT64_C( 2886872142784425287), -INT64_C( 6479044360787322531),
+        -INT64_C( 6465766319594970577), -INT64_C( 4771017827224142037),  INT64_C( 1568014054928247445),  INT64_C( 8613304953685724416) },
+      -INT64_C( 8231029998693203233) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_mask_reduce_add_epi64(test_vec[i].k, a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_add_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[16];
+    const simde_float32 r;
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   979.39), SIMDE_FLOAT32_C(    83.97), SIMDE_FLOAT32_C(   514.53), SIMDE_FLOAT32_C(   137.35),
+        SIMDE_FLOAT32_C(   -21.96), SIMDE_FLOAT32_C(  -168.69), SIMDE_FLOAT32_C(  -953.16), SIMDE_FLOAT32_C(   -79.56),
+        SIMDE_FLOAT32_C(   106.32), SIMDE_FLOAT32_C(  -954.78), SIMDE_FLOAT32_C(   282.60), SIMDE_FLOAT32_C(  -737.23),
+        SIMDE_FLOAT32_C(  -707.97), SIMDE_FLOAT32_C(   557.90), SIMDE_FLOAT32_C(   682.70), SIMDE_FLOAT32_C(  -732.60) },
+      SIMDE_FLOAT32_C(    -1011.19) },
+    { { SIMDE_FLOAT32_C(   218.75), SIMDE_FLOAT32_C(  -310.88), SIMDE_FLOAT32_C(   760.25), SIMDE_FLOAT32_C(   482.51),
+        SIMDE_FLOAT32_C(  -348.16), SIMDE_FLOAT32_C(   593.05), SIMDE_FLOAT32_C(  -830.36), SIMDE_FLOAT32_C(  -988.66),
+        SIMDE_FLOAT32_C(  -108.01), SIMDE_FLOAT32_C(  -811.66), SIMDE_FLOAT32_C(  -574.09), SIMDE_FLOAT32_C(   883.64),
+        SIMDE_FLOAT32_C(   674.53), SIMDE_FLOAT32_C(  -351.86), SIMDE_FLOAT32_C(   181.83), SIMDE_FLOAT32_C(   439.52) },
+      SIMDE_FLOAT32_C(      -89.60) },
+    { { SIMDE_FLOAT32_C(   130.65), SIMDE_FLOAT32_C(    47.21), SIMDE_FLOAT32_C(   797.63), SIMDE_FLOAT32_C(    78.05),
+        SIMDE_FLOAT32_C(  -700.46), SIMDE_FLOAT32_C(  -913.12), SIMDE_FLOAT32_C(  -641.17), SIMDE_FLOAT32_C(  -237.68),
+        SIMDE_FLOAT32_C(  -875.96), SIMDE_FLOAT32_C(   428.61), SIMDE_FLOAT32_C(   205.50), SIMDE_FLOAT32_C(   718.31),
+        SIMDE_FLOAT32_C(   989.29), SIMDE_FLOAT32_C(  -730.14), SIMDE_FLOAT32_C(  -194.15), SIMDE_FLOAT32_C(  -841.16) },
+      SIMDE_FLOAT32_C(    -1738.59) },
+    { { SIMDE_FLOAT32_C(  -516.35), SIMDE_FLOAT32_C(   -12.49), SIMDE_FLOAT32_C(  -402.82), SIMDE_FLOAT32_C(  -197.24),
+        SIMDE_FLOAT32_C(   -76.61), SIMDE_FLOAT32_C(   310.60), SIMDE_FLOAT32_C(   111.31), SIMDE_FLOAT32_C(  -344.11),
+        SIMDE_FLOAT32_C(   -88.15), SIMDE_FLOAT32_C(   889.46), SIMDE_FLOAT32_C(  -995.89), SIMDE_FLOAT32_C(   263.13),
+        SIMDE_FLOAT32_C(   209.03), SIMDE_FLOAT32_C(  -928.36), SIMDE_FLOAT32_C(   910.22), SIMDE_FLOAT32_C(  -797.09) },
+      SIMDE_FLOAT32_C(    -1665.36) },
+    { { SIMDE_FLOAT32_C(  -583.71), SIMDE_FLOAT32_C(   548.99), SIMDE_FLOAT32_C(  -725.66), SIMDE_FLOAT32_C(   537.79),
+        SIMDE_FLOAT32_C(  -599.05), SIMDE_FLOAT32_C(  -416.19), SIMDE_FLOAT32_C(   146.38), SIMDE_FLOAT32_C(  -531.28),
+        SIMDE_FLOAT32_C(   868.14), SIMDE_FLOAT32_C(   -54.30), SIMDE_FLOAT32_C(   811.36), SIMDE_FLOAT32_C(  -609.13),
+        SIMDE_FLOAT32_C(  -858.75), SIMDE_FLOAT32_C(  -658.35), SIMDE_FLOAT32_C(   673.22), SIMDE_FLOAT32_C(  -863.18) },
+      SIMDE_FLOAT32_C(    -2313.72) },
+    { { SIMDE_FLOAT32_C(   421.37), SIMDE_FLOAT32_C(   -43.75), SIMDE_FLOAT32_C(   590.50), SIMDE_FLOAT32_C(  -824.81),
+        SIMDE_FLOAT32_C(   720.21), SIMDE_FLOAT32_C(   834.55), SIMDE_FLOAT32_C(  -653.59), SIMDE_FLOAT32_C(  -553.54),
+        SIMDE_FLOAT32_C(   132.25), SIMDE_FLOAT32_C(  -577.85), SIMDE_FLOAT32_C(   661.88), SIMDE_FLOAT32_C(  -174.58),
+        SIMDE_FLOAT32_C(   640.65), SIMDE_FLOAT32_C(   918.33), SIMDE_FLOAT32_C(   613.28), SIMDE_FLOAT32_C(  -883.41) },
+      SIMDE_FLOAT32_C(     1821.49) },
+    { { SIMDE_FLOAT32_C(   556.43), SIMDE_FLOAT32_C(   775.44), SIMDE_FLOAT32_C(  -483.99), SIMDE_FLOAT32_C(   185.54),
+        SIMDE_FLOAT32_C(  -498.17), SIMDE_FLOAT32_C(   546.62), SIMDE_FLOAT32_C(   544.45), SIMDE_FLOAT32_C(  -446.60),
+        SIMDE_FLOAT32_C(   390.64), SIMDE_FLOAT32_C(  -803.15), SIMDE_FLOAT32_C(   285.40), SIMDE_FLOAT32_C(    94.82),
+        SIMDE_FLOAT32_C(  -943.32), SIMDE_FLOAT32_C(  -725.06), SIMDE_FLOAT32_C(  -905.82), SIMDE_FLOAT32_C(   604.20) },
+      SIMDE_FLOAT32_C(     -822.57) },
+    { { SIMDE_FLOAT32_C(  -303.85), SIMDE_FLOAT32_C(   926.79), SIMDE_FLOAT32_C(   225.50), SIMDE_FLOAT32_C(   469.25),
+        SIMDE_FLOAT32_C(   894.72), SIMDE_FLOAT32_C(  -659.68), SIMDE_FLOAT32_C(   454.94), SIMDE_FLOAT32_C(   451.67),
+        SIMDE_FLOAT32_C(   380.86), SIMDE_FLOAT32_C(    -8.43), SIMDE_FLOAT32_C(  -976.24), SIMDE_FLOAT32_C(   572.41),
+        SIMDE_FLOAT32_C(   966.47), SIMDE_FLOAT32_C(  -945.46), SIMDE_FLOAT32_C(  -536.49), SIMDE_FLOAT32_C(   798.58) },
+      SIMDE_FLOAT32_C(     2711.04) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_float32 r = simde_mm512_reduce_add_ps(a);
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_add_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r;
+  } test_vec[] = {
+    { UINT16_C(28936),
+      { SIMDE_FLOAT32_C(   127.46), SIMDE_FLOAT32_C(  -113.59), SIMDE_FLOAT32_C(  -126.26), SIMDE_FLOAT32_C(   711.52),
+        SIMDE_FLOAT32_C(   438.97), SIMDE_FLOAT32_C(  -682.66), SIMDE_FLOAT32_C(   909.98), SIMDE_FLOAT32_C(  -802.43),
+        SIMDE_FLOAT32_C(  -656.35), SIMDE_FLOAT32_C(  -769.11), SIMDE_FLOAT32_C(  -344.05), SIMDE_FLOAT32_C(   945.20),
+        SIMDE_FLOAT32_C(  -388.46), SIMDE_FLOAT32_C(   135.27), SIMDE_FLOAT32_C(   346.06), SIMDE_FLOAT32_C(  -878.61) },
+      SIMDE_FLOAT32_C(      148.04) },
+    { UINT16_C(15536),
+      { SIMDE_FLOAT32_C(  -413.03), SIMDE_FLOAT32_C(   985.04), SIMDE_FLOAT32_C(  -933.59), SIMDE_FLOAT32_C(   751.95),
+        SIMDE_FLOAT32_C(  -877.69), SIMDE_FLOAT32_C(  -569.65), SIMDE_FLOAT32_C(   289.59), SIMDE_FLOAT32_C(  -343.50),
+        SIMDE_FLOAT32_C(  -233.71), SIMDE_FLOAT32_C(  -940.79), SIMDE_FLOAT32_C(  -771.08), SIMDE_FLOAT32_C(   660.78),
+        SIMDE_FLOAT32_C(   106.17), SIMDE_FLOAT32_C(   686.22), SIMDE_FLOAT32_C(   921.44), SIMDE_FLOAT32_C(   195.33) },
+      SIMDE_FLOAT32_C(    -1108.75) },
+    { UINT16_C(34996),
+      { SIMDE_FLOAT32_C(   -34.51), SIMDE_FLOAT32_C(  -964.60), SIMDE_FLOAT32_C(  -617.15), SIMDE_FLOAT32_C(  -791.05),
+        SIMDE_FLOAT32_C(  -403.86), SIMDE_FLOAT32_C(  -851.63), SIMDE_FLOAT32_C(   616.85), SIMDE_FLOAT32_C(   106.70),
+        SIMDE_FLOAT32_C(   487.16), SIMDE_FLOAT32_C(   212.80), SIMDE_FLOAT32_C(    81.32), SIMDE_FLOAT32_C(   925.66),
+        SIMDE_FLOAT32_C(  -116.30), SIMDE_FLOAT32_C(   169.40), SIMDE_FLOAT32_C(  -526.02), SIMDE_FLOAT32_C(   487.57) },
+      SIMDE_FLOAT32_C(     -352.71) },
+    { UINT16_C(20491),
+      { SIMDE_FLOAT32_C(  -501.65), SIMDE_FLOAT32_C(   531.59), SIMDE_FLOAT32_C(  -247.50), SIMDE_FLOAT32_C(   933.46),
+        SIMDE_FLOAT32_C(    71.39), SIMDE_FLOAT32_C(  -971.15), SIMDE_FLOAT32_C(  -939.94), SIMDE_FLOAT32_C(   527.10),
+        SIMDE_FLOAT32_C(  -874.65), SIMDE_FLOAT32_C(   369.99), SIMDE_FLOAT32_C(  -379.11), SIMDE_FLOAT32_C(     3.40),
+        SIMDE_FLOAT32_C(   314.33), SIMDE_FLOAT32_C(  -121.54), SIMDE_FLOAT32_C(  -335.85), SIMDE_FLOAT32_C(  -529.67) },
+      SIMDE_FLOAT32_C(      941.88) },
+    { UINT16_C( 9614),
+      { SIMDE_FLOAT32_C(  -678.67), SIMDE_FLOAT32_C(  -872.71), SIMDE_FLOAT32_C(   977.39), SIMDE_FLOAT32_C(   397.92),
+        SIMDE_FLOAT32_C(   -78.88), SIMDE_FLOAT32_C(  -171.38), SIMDE_FLOAT32_C(  -437.45), SIMDE_FLOAT32_C(  -801.27),
+        SIMDE_FLOAT32_C(  -947.41), SIMDE_FLOAT32_C(  -778.30), SIMDE_FLOAT32_C(  -409.68), SIMDE_FLOAT32_C(   991.55),
+        SIMDE_FLOAT32_C(   262.19), SIMDE_FLOAT32_C(    88.89), SIMDE_FLOAT32_C(  -699.00), SIMDE_FLOAT32_C(   883.47) },
+      SIMDE_FLOAT32_C(    -1566.87) },
+    { UINT16_C(30340),
+      { SIMDE_FLOAT32_C(  -133.03), SIMDE_FLOAT32_C(    58.11), SIMDE_FLOAT32_C(   355.84), SIMDE_FLOAT32_C(   302.33),
+        SIMDE_FLOAT32_C(     4.82), SIMDE_FLOAT32_C(   227.60), SIMDE_FLOAT32_C(  -709.96), SIMDE_FLOAT32_C(   738.54),
+        SIMDE_FLOAT32_C(   645.00), SIMDE_FLOAT32_C(   188.82), SIMDE_FLOAT32_C(  -902.63), SIMDE_FLOAT32_C(   954.34),
+        SIMDE_FLOAT32_C(   117.48), SIMDE_FLOAT32_C(  -908.22), SIMDE_FLOAT32_C(  -116.35), SIMDE_FLOAT32_C(   684.43) },
+      SIMDE_FLOAT32_C(     -526.52) },
+    { UINT16_C(43440),
+      { SIMDE_FLOAT32_C(  -890.85), SIMDE_FLOAT32_C(  -234.38), SIMDE_FLOAT32_C(   652.60), SIMDE_FLOAT32_C(   232.33),
+        SIMDE_FLOAT32_C(   309.34), SIMDE_FLOAT32_C(  -231.65), SIMDE_FLOAT32_C(   946.58), SIMDE_FLOAT32_C(  -248.75),
+        SIMDE_FLOAT32_C(  -754.57), SIMDE_FLOAT32_C(   738.14), SIMDE_FLOAT32_C(   734.85), SIMDE_FLOAT32_C(     7.12),
+        SIMDE_FLOAT32_C(   771.94), SIMDE_FLOAT32_C(   101.52), SIMDE_FLOAT32_C(  -305.47), SIMDE_FLOAT32_C(   851.01) },
+      SIMDE_FLOAT32_C(       34.02) },
+    { UINT16_C(50814),
+      { SIMDE_FLOAT32_C(  -734.54), SIMDE_FLOAT32_C(  -547.10), SIMDE_FLOAT32_C(  -746.93), SIMDE_FLOAT32_C(  -884.11),
+        SIMDE_FLOAT32_C(   457.37), SIMDE_FLOAT32_C(  -433.53), SIMDE_FLOAT32_C(  -643.07), SIMDE_FLOAT32_C(    16.95),
+        SIMDE_FLOAT32_C(  -307.97), SIMDE_FLOAT32_C(   697.51), SIMDE_FLOAT32_C(    -6.37), SIMDE_FLOAT32_C(   720.55),
+        SIMDE_FLOAT32_C(  -317.73), SIMDE_FLOAT32_C(   850.03), SIMDE_FLOAT32_C(  -100.61), SIMDE_FLOAT32_C(   407.49) },
+      SIMDE_FLOAT32_C(    -1799.35) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_float32 r = simde_mm512_mask_reduce_add_ps(test_vec[i].k, a);
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_add_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[8];
+    const simde_float64 r;
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -986.40), SIMDE_FLOAT64_C(  -601.53), SIMDE_FLOAT64_C(  -172.25), SIMDE_FLOAT64_C(  -683.78),
+        SIMDE_FLOAT64_C(   934.33), SIMDE_FLOAT64_C(    11.36), SIMDE_FLOAT64_C(   911.26), SIMDE_FLOAT64_C(   626.64) },
+      SIMDE_FLOAT64_C(       39.63) },
+    { { SIMDE_FLOAT64_C(  -585.78), SIMDE_FLOAT64_C(   587.82), SIMDE_FLOAT64_C(  -788.87), SIMDE_FLOAT64_C(  -968.79),
+        SIMDE_FLOAT64_C(    63.15), SIMDE_FLOAT64_C(   607.26), SIMDE_FLOAT64_C(   282.76), SIMDE_FLOAT64_C(  -303.79) },
+      SIMDE_FLOAT64_C(    -1106.24) },
+    { { SIMDE_FLOAT64_C(   477.58), SIMDE_FLOAT64_C(  -194.21), SIMDE_FLOAT64_C(  -561.33), SIMDE_FLOAT64_C(  -802.30),
+        SIMDE_FLOAT64_C(   -47.48), SIMDE_FLOAT64_C(  -883.27), SIMDE_FLOAT64_C(  -246.46), SIMDE_FLOAT64_C(     1.65) },
+      SIMDE_FLOAT64_C(    -2255.82) },
+    { { SIMDE_FLOAT64_C(   410.05), SIMDE_FLOAT64_C(  -659.38), SIMDE_FLOAT64_C(  -146.04), SIMDE_FLOAT64_C(   201.54),
+        SIMDE_FLOAT64_C(   810.88), SIMDE_FLOAT64_C(  -920.23), SIMDE_FLOAT64_C(  -170.16), SIMDE_FLOAT64_C(  -843.09) },
+      SIMDE_FLOAT64_C(    -1316.43) },
+    { { SIMDE_FLOAT64_C(  -795.44), SIMDE_FLOAT64_C(  -407.62), SIMDE_FLOAT64_C(   283.70), SIMDE_FLOAT64_C(  -673.27),
+        SIMDE_FLOAT64_C(  -252.52), SIMDE_FLOAT64_C(   -48.12), SIMDE_FLOAT64_C(   733.82), SIMDE_FLOAT64_C(   303.28) },
+      SIMDE_FLOAT64_C(     -856.17) },
+    { { SIMDE_FLOAT64_C(  -102.96), SIMDE_FLOAT64_C(  -374.90), SIMDE_FLOAT64_C(   823.59), SIMDE_FLOAT64_C(   726.72),
+        SIMDE_FLOAT64_C(  -652.26), SIMDE_FLOAT64_C(  -115.54), SIMDE_FLOAT64_C(   521.56), SIMDE_FLOAT64_C(  -973.77) },
+      SIMDE_FLOAT64_C(     -147.56) },
+    { { SIMDE_FLOAT64_C(   291.03), SIMDE_FLOAT64_C(   396.92), SIMDE_FLOAT64_C(  -542.89), SIMDE_FLOAT64_C(  -570.03),
+        SIMDE_FLOAT64_C(   753.96), SIMDE_FLOAT64_C(    75.58), SIMDE_FLOAT64_C(   983.37), SIMDE_FLOAT64_C(  -970.02) },
+      SIMDE_FLOAT64_C(      417.92) },
+    { { SIMDE_FLOAT64_C(   -74.77), SIMDE_FLOAT64_C(  -957.39), SIMDE_FLOAT64_C(   625.76), SIMDE_FLOAT64_C(   435.81),
+        SIMDE_FLOAT64_C(  -156.64), SIMDE_FLOAT64_C(  -307.24), SIMDE_FLOAT64_C(  -234.45), SIMDE_FLOAT64_C(  -201.76) },
+      SIMDE_FLOAT64_C(     -870.68) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_float64 r = simde_mm512_reduce_add_pd(a);
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_add_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r;
+  } test_vec[] = {
+    { UINT8_C( 73),
+      { SIMDE_FLOAT64_C(   230.25), SIMDE_FLOAT64_C(  -469.81), SIMDE_FLOAT64_C(  -593.65), SIMDE_FLOAT64_C(   -54.67),
+        SIMDE_FLOAT64_C(  -538.37), SIMDE_FLOAT64_C(  -481.16), SIMDE_FLOAT64_C(  -931.43), SIMDE_FLOAT64_C(   -11.90) },
+      SIMDE_FLOAT64_C(     -755.85) },
+    { UINT8_C(228),
+      { SIMDE_FLOAT64_C(   -82.69), SIMDE_FLOAT64_C(    18.85), SIMDE_FLOAT64_C(  -612.57), SIMDE_FLOAT64_C(  -697.60),
+        SIMDE_FLOAT64_C(  -498.72), SIMDE_FLOAT64_C(  -136.59), SIMDE_FLOAT64_C(   456.84), SIMDE_FLOAT64_C(   432.41) },
+      SIMDE_FLOAT64_C(      140.09) },
+    { UINT8_C(157),
+      { SIMDE_FLOAT64_C(   -32.40), SIMDE_FLOAT64_C(   417.25), SIMDE_FLOAT64_C(   150.16), SIMDE_FLOAT64_C(  -492.58),
+        SIMDE_FLOAT64_C(  -724.42), SIMDE_FLOAT64_C(   410.15), SIMDE_FLOAT64_C(  -837.49), SIMDE_FLOAT64_C(  -128.43) },
+      SIMDE_FLOAT64_C(    -1227.67) },
+    { UINT8_C( 36),
+      { SIMDE_FLOAT64_C(  -267.56), SIMDE_FLOAT64_C(   798.40), SIMDE_FLOAT64_C(   661.66), SIMDE_FLOAT64_C(   758.25),
+        SIMDE_FLOAT64_C(  -802.02), SIMDE_FLOAT64_C(   198.08), SIMDE_FLOAT64_C(   669.47), SIMDE_FLOAT64_C(  -544.14) },
+      SIMDE_FLOAT64_C(      859.74) },
+    { UINT8_C( 16),
+      { SIMDE_FLOAT64_C(   787.56), SIMDE_FLOAT64_C(   771.94), SIMDE_FLOAT64_C(  -377.49), SIMDE_FLOAT64_C(   235.01),
+        SIMDE_FLOAT64_C(   450.28), SIMDE_FLOAT64_C(   946.79), SIMDE_FLOAT64_C(   571.81), SIMDE_FLOAT64_C(  -711.30) },
+      SIMDE_FLOAT64_C(      450.28) },
+    { UINT8_C(180),
+      { SIMDE_FLOAT64_C(  -741.95), SIMDE_FLOAT64_C(   545.43), SIMDE_FLOAT64_C(  -414.25), SIMDE_FLOAT64_C(   492.79),
+        SIMDE_FLOAT64_C(   555.36), SIMDE_FLOAT64_C(  -667.84), SIMDE_FLOAT64_C(  -422.75), SIMDE_FLOAT64_C(  -132.38) },
+      SIMDE_FLOAT64_C(     -659.11) },
+    { UINT8_C(  0),
+      { SIMDE_FLOAT64_C(   657.50), SIMDE_FLOAT64_C(   693.23), SIMDE_FLOAT64_C(    72.22), SIMDE_FLOAT64_C(   265.95),
+        SIMDE_FLOAT64_C(   496.75), SIMDE_FLOAT64_C(  -267.90), SIMDE_FLOAT64_C(   954.58), SIMDE_FLOAT64_C(  -549.63) },
+      SIMDE_FLOAT64_C(        0.00) },
+    { UINT8_C(108),
+      { SIMDE_FLOAT64_C(  -384.94), SIMDE_FLOAT64_C(   984.53), SIMDE_FLOAT64_C(   452.84), SIMDE_FLOAT64_C(   195.48),
+        SIMDE_FLOAT64_C(   207.26), SIMDE_FLOAT64_C(  -737.24), SIMDE_FLOAT64_C(   943.54), SIMDE_FLOAT64_C(   -41.58) },
+      SIMDE_FLOAT64_C(      854.62) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_float64 r = simde_mm512_mask_reduce_add_pd(test_vec[i].k, a);
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_mul_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { {  INT32_C(           8),  INT32_C(          10), -INT32_C(          14),  INT32_C(           6),  INT32_C(           4),  INT32_C(          11),  INT32_C(           9),  INT32_C(          11),
+        -INT32_C(          13), -INT32_C(          11), -INT32_C(          13),  INT32_C(           9), -INT32_C(           3),  INT32_C(          14), -INT32_C(           7),  INT32_C(           3) },
+       INT32_C(  2033153536) },
+    { {  INT32_C(           3), -INT32_C(           2), -INT32_C(          15), -INT32_C(           7),  INT32_C(           3),  INT32_C(           1), -INT32_C(          15),  INT32_C(           9),
+         INT32_C(           1), -INT32_C(          13), -INT32_C(          11), -INT32_C(          11), -INT32_C(           8),  INT32_C(           6), -INT32_C(           6),  INT32_C(           9) },
+      -INT32_C(   919576768) },
+    { {  INT32_C(          13), -INT32_C(           7),  INT32_C(           5),  INT32_C(           8),  INT32_C(          15),  INT32_C(           5),  INT32_C(          13),  INT32_C(           0),
+        -INT32_C(           4), -INT32_C(          12),  INT32_C(           9), -INT32_C(          15), -INT32_C(          13), -INT32_C(           1), -INT32_C(          15), -INT32_C(          12) },
+       INT32_C(           0) },
+    { {  INT32_C(           7), -INT32_C(           5), -INT32_C(          14),  INT32_C(           5), -INT32_C(           6), -INT32_C(           6), -INT32_C(           2),  INT32_C(           4),
+        -INT32_C(          14),  INT32_C(           9),  INT32_C(           0), -INT32_C(          12), -INT32_C(           1), -INT32_C(           5),  INT32_C(          15),  INT32_C(          13) },
+       INT32_C(           0) },
+    { {  INT32_C(          14),  INT32_C(           5),  INT32_C(           2), -INT32_C(           3), -INT32_C(          12), -INT32_C(           3), -INT32_C(           2), -INT32_C(           6),
+         INT32_C(           6),  INT32_C(          15), -INT32_C(          14), -INT32_C(           3),  INT32_C(          12),  INT32_C(          15), -INT32_C(          14),  INT32_C(          10) },
+       INT32_C(   300240896) },
+    { {  INT32_C(           6), -INT32_C(           9),  INT32_C(           0),  INT32_C(           7), -INT32_C(           6), -INT32_C(          10),  INT32_C(          10), -INT32_C(           4),
+        -INT32_C(          14), -INT32_C(           7),  INT32_C(          14),  INT32_C(          12), -INT32_C(           5),  INT32_C(          14),  INT32_C(           2), -INT32_C(          13) },
+       INT32_C(           0) },
+    { {  INT32_C(           1),  INT32_C(           8), -INT32_C(          14), -INT32_C(           8), -INT32_C(           7), -INT32_C(           3),  INT32_C(           2), -INT32_C(          15),
+         INT32_C(          11), -INT32_C(          13),  INT32_C(           0), -INT32_C(          13), -INT32_C(          10),  INT32_C(           9), -INT32_C(           6),  INT32_C(           6) },
+       INT32_C(           0) },
+    { {  INT32_C(          12),  INT32_C(           6),  INT32_C(           0),  INT32_C(           0),  INT32_C(           5), -INT32_C(           3),  INT32_C(           0), -INT32_C(          14),
+         INT32_C(          15),  INT32_C(           6), -INT32_C(          13), -INT32_C(           9),  INT32_C(          14), -INT32_C(           2),  INT32_C(          10), -INT32_C(           6) },
+       INT32_C(           0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_reduce_mul_epi32(a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_mul_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { UINT16_C(59020),
+      {  INT32_C(           1),  INT32_C(           0),  INT32_C(           0), -INT32_C(           6),  INT32_C(          10), -INT32_C(           4),  INT32_C(           0),  INT32_C(           7),
+         INT32_C(          14), -INT32_C(          15), -INT32_C(          13), -INT32_C(           3), -INT32_C(           1),  INT32_C(           5), -INT32_C(          14), -INT32_C(           1) },
+       INT32_C(           0) },
+    { UINT16_C(26941),
+      { -INT32_C(           2),  INT32_C(          14),  INT32_C(          14),  INT32_C(          15),  INT32_C(          11), -INT32_C(           9),  INT32_C(           8),  INT32_C(           2),
+         INT32_C(          15),  INT32_C(           8), -INT32_C(          11),  INT32_C(          14), -INT32_C(           7), -INT32_C(           5),  INT32_C(          12), -INT32_C(           9) },
+      -INT32_C(   523908000) },
+    { UINT16_C(15593),
+      {  INT32_C(           9),  INT32_C(           5),  INT32_C(           7), -INT32_C(           5), -INT32_C(           4), -INT32_C(           3),  INT32_C(          15),  INT32_C(          14),
+        -INT32_C(          14),  INT32_C(           1),  INT32_C(           7), -INT32_C(           6), -INT32_C(           6),  INT32_C(          11),  INT32_C(          14), -INT32_C(           1) },
+       INT32_C(    78586200) },
+    { UINT16_C(27351),
+      {  INT32_C(           4),  INT32_C(          10), -INT32_C(           1), -INT32_C(          13),  INT32_C(           4),  INT32_C(          10),  INT32_C(           9),  INT32_C(           4),
+         INT32_C(           6),  INT32_C(          10), -INT32_C(          12),  INT32_C(           4),  INT32_C(          13), -INT32_C(           1), -INT32_C(          11),  INT32_C(           7) },
+      -INT32_C(     2534400) },
+    { UINT16_C(16120),
+      { -INT32_C(           7), -INT32_C(           8), -INT32_C(          12), -INT32_C(          12), -INT32_C(          12), -INT32_C(          13),  INT32_C(          10),  INT32_C(           1),
+         INT32_C(          11), -INT32_C(           5), -INT32_C(           5), -INT32_C(           9),  INT32_C(           6), -INT32_C(           5), -INT32_C(           4),  INT32_C(          11) },
+      -INT32_C(   126360000) },
+    { UINT16_C(32523),
+      {  INT32_C(           9),  INT32_C(           4), -INT32_C(          13),  INT32_C(           8),  INT32_C(           9), -INT32_C(          15), -INT32_C(           9),  INT32_C(          12),
+         INT32_C(           6), -INT32_C(           8),  INT32_C(           2), -INT32_C(          13),  INT32_C(          10),  INT32_C(           0), -INT32_C(           7), -INT32_C(          12) },
+       INT32_C(           0) },
+    { UINT16_C(41120),
+      { -INT32_C(           7),  INT32_C(           1),  INT32_C(          11),  INT32_C(           7), -INT32_C(           8),  INT32_C(          13), -INT32_C(           2),  INT32_C(          13),
+        -INT32_C(          13),  INT32_C(           2), -INT32_C(           6), -INT32_C(          12),  INT32_C(          10),  INT32_C(           7), -INT32_C(          15), -INT32_C(          13) },
+      -INT32_C(       15379) },
+    { UINT16_C(28665),
+      { -INT32_C(           8), -INT32_C(           9),  INT32_C(          10),  INT32_C(          15), -INT32_C(           2), -INT32_C(           9),  INT32_C(           9),  INT32_C(           8),
+        -INT32_C(           9),  INT32_C(           5),  INT32_C(          11),  INT32_C(           9), -INT32_C(           6),  INT32_C(          14), -INT32_C(          11),  INT32_C(           8) },
+       INT32_C(   676576000) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_mask_reduce_mul_epi32(test_vec[i].k, a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_mul_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { {  INT64_C(                   4), -INT64_C(                   1),  INT64_C(                   6), -INT64_C(                  13),
+         INT64_C(                   0), -INT64_C(                   6), -INT64_C(                  12),  INT64_C(                   0) },
+       INT64_C(                   0) },
+    { {  INT64_C(                   5), -INT64_C(                  12), -INT64_C(                  10),  INT64_C(                   4),
+         INT64_C(                  13), -INT64_C(                   1),  INT64_C(                   3),  INT64_C(                  11) },
+      -INT64_C(             1029600) },
+    { { -INT64_C(                   5),  INT64_C(                   1),  INT64_C(                   4),  INT64_C(                  12),
+        -INT64_C(                   5), -INT64_C(                   6),  INT64_C(                  14),  INT64_C(                   0) },
+       INT64_C(                   0) },
+    { { -INT64_C(                   4), -INT64_C(                  14), -INT64_C(                   3),  INT64_C(                   5),
+         INT64_C(                  14), -INT64_C(                  12), -INT64_C(                   6),  INT64_C(                   2) },
+      -INT64_C(             1693440) },
+    { {  INT64_C(                   3),  INT64_C(                   6), -INT64_C(                  12), -INT64_C(                  11),
+        -INT64_C(                   8), -INT64_C(                   2), -INT64_C(                   6),  INT64_C(                   3) },
+      -INT64_C(              684288) },
+    { {  INT64_C(                  10),  INT64_C(                   4),  INT64_C(                   2), -INT64_C(                   7),
+        -INT64_C(                   6),  INT64_C(                   2),  INT64_C(                   3),  INT64_C(                   7) },
+       INT64_C(              141120) },
+    { { -INT64_C(                  12),  INT64_C(                   9), -INT64_C(                   1),  INT64_C(                   4),
+         INT64_C(                   5),  INT64_C(                   0), -INT64_C(                  11),  INT64_C(                  11) },
+       INT64_C(                   0) },
+    { { -INT64_C(                   6), -INT64_C(                   4), -INT64_C(                   9),  INT64_C(                   4),
+        -INT64_C(                  12),  INT64_C(                  11), -INT64_C(                  11),  INT64_C(                   0) },
+       INT64_C(                   0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_reduce_mul_epi64(a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_mul_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { UINT8_C( 36),
+      {  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                  12), -INT64_C(                   9),
+         INT64_C(                   3),  INT64_C(                   2),  INT64_C(                   5),  INT64_C(                  15) },
+      -INT64_C(                  24) },
+    { UINT8_C( 96),
+      { -INT64_C(                  14), -INT64_C(                  13),  INT64_C(                  10),  INT64_C(                   3),
+         INT64_C(                   5),  INT64_C(                   1),  INT64_C(                   6), -INT64_C(                  12) },
+       INT64_C(                   6) },
+    { UINT8_C(206),
+      {  INT64_C(                  12),  INT64_C(                   1), -INT64_C(                  14), -INT64_C(                   4),
+         INT64_C(                   1), -INT64_C(                   2), -INT64_C(                  13), -INT64_C(                  15) },
+       INT64_C(               10920) },
+    { UINT8_C(253),
+      { -INT64_C(                   3),  INT64_C(                   6), -INT64_C(                   7),  INT64_C(                   1),
+        -INT64_C(                  12),  INT64_C(                  12),  INT64_C(                  11),  INT64_C(                   5) },
+      -INT64_C(              166320) },
+    { UINT8_C( 50),
+      {  INT64_C(                   4),  INT64_C(                   0), -INT64_C(                  13), -INT64_C(                   4),
+         INT64_C(                   1),  INT64_C(                   5), -INT64_C(                  15),  INT64_C(                   0) },
+       INT64_C(                   0) },
+    { UINT8_C( 57),
+      { -INT64_C(                  11), -INT64_C(                   1), -INT64_C(                  12),  INT64_C(                   9),
+         INT64_C(                   0), -INT64_C(                  13), -INT64_C(                   7),  INT64_C(                   2) },
+       INT64_C(                   0) },
+    { UINT8_C( 13),
+      { -INT64_C(                  12), -INT64_C(                  12),  INT64_C(                  10), -INT64_C(                   5),
+         INT64_C(                   6),  INT64_C(                  15),  INT64_C(                   7),  INT64_C(                   9) },
+       INT64_C(                 600) },
+    { UINT8_C(162),
+      { -INT64_C(                  12), -INT64_C(                  11), -INT64_C(                   1),  INT64_C(                   9),
+        -INT64_C(                  15),  INT64_C(                   3), -INT64_C(                  14),  INT64_C(                   0) },
+       INT64_C(                   0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_mask_reduce_mul_epi64(test_vec[i].k, a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_mul_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[16];
+    const simde_float32 r;
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(     0.69), SIMDE_FLOAT32_C(     0.98), SIMDE_FLOAT32_C(     1.18), SIMDE_FLOAT32_C(     0.57),
+        SIMDE_FLOAT32_C(    -0.60), SIMDE_FLOAT32_C(     0.56), SIMDE_FLOAT32_C(    -0.82), SIMDE_FLOAT32_C(    -1.24),
+        SIMDE_FLOAT32_C(     0.66), SIMDE_FLOAT32_C(    -0.54), SIMDE_FLOAT32_C(     1.27), SIMDE_FLOAT32_C(    -0.90),
+        SIMDE_FLOAT32_C(     0.93), SIMDE_FLOAT32_C(    -1.37), SIMDE_FLOAT32_C(     0.84), SIMDE_FLOAT32_C(     1.03) },
+      SIMDE_FLOAT32_C(        0.07) },
+    { { SIMDE_FLOAT32_C(    -0.60), SIMDE_FLOAT32_C(    -1.07), SIMDE_FLOAT32_C(     0.84), SIMDE_FLOAT32_C(     1.32),
+        SIMDE_FLOAT32_C(     1.30), SIMDE_FLOAT32_C(     1.40), SIMDE_FLOAT32_C(     0.72), SIMDE_FLOAT32_C(     1.26),
+        SIMDE_FLOAT32_C(     0.54), SIMDE_FLOAT32_C(    -0.55), SIMDE_FLOAT32_C(    -0.73), SIMDE_FLOAT32_C(    -0.65),
+        SIMDE_FLOAT32_C(     1.25), SIMDE_FLOAT32_C(    -0.78), SIMDE_FLOAT32_C(    -0.51), SIMDE_FLOAT32_C(     1.24) },
+      SIMDE_FLOAT32_C(       -0.10) },
+    { { SIMDE_FLOAT32_C(    -0.52), SIMDE_FLOAT32_C(     0.55), SIMDE_FLOAT32_C(     0.92), SIMDE_FLOAT32_C(    -0.70),
+        SIMDE_FLOAT32_C(    -1.05), SIMDE_FLOAT32_C(     1.47), SIMDE_FLOAT32_C(    -1.01), SIMDE_FLOAT32_C(     1.11),
+        SIMDE_FLOAT32_C(     0.57), SIMDE_FLOAT32_C(    -0.57), SIMDE_FLOAT32_C(    -0.81), SIMDE_FLOAT32_C(     1.04),
+        SIMDE_FLOAT32_C(     0.71), SIMDE_FLOAT32_C(    -0.96), SIMDE_FLOAT32_C(     0.58), SIMDE_FLOAT32_C(    -0.94) },
+      SIMDE_FLOAT32_C(        0.03) },
+    { { SIMDE_FLOAT32_C(    -1.49), SIMDE_FLOAT32_C(     1.27), SIMDE_FLOAT32_C(    -0.60), SIMDE_FLOAT32_C(     1.26),
+        SIMDE_FLOAT32_C(    -0.95), SIMDE_FLOAT32_C(    -0.89), SIMDE_FLOAT32_C(    -1.06), SIMDE_FLOAT32_C(     1.36),
+        SIMDE_FLOAT32_C(    -0.93), SIMDE_FLOAT32_C(    -1.20), SIMDE_FLOAT32_C(     0.50), SIMDE_FLOAT32_C(     0.96),
+        SIMDE_FLOAT32_C(    -1.34), SIMDE_FLOAT32_C(     0.71), SIMDE_FLOAT32_C(     0.55), SIMDE_FLOAT32_C(     1.33) },
+      SIMDE_FLOAT32_C(        0.65) },
+    { { SIMDE_FLOAT32_C(     0.66), SIMDE_FLOAT32_C(     1.25), SIMDE_FLOAT32_C(     1.28), SIMDE_FLOAT32_C(     0.91),
+        SIMDE_FLOAT32_C(     0.65), SIMDE_FLOAT32_C(     1.40), SIMDE_FLOAT32_C(     1.39), SIMDE_FLOAT32_C(     0.72),
+        SIMDE_FLOAT32_C(    -0.95), SIMDE_FLOAT32_C(    -0.71), SIMDE_FLOAT32_C(    -1.42), SIMDE_FLOAT32_C(    -1.06),
+        SIMDE_FLOAT32_C(    -1.22), SIMDE_FLOAT32_C(     1.01), SIMDE_FLOAT32_C(     0.56), SIMDE_FLOAT32_C(    -1.14) },
+      SIMDE_FLOAT32_C(        0.70) },
+    { { SIMDE_FLOAT32_C(    -1.25), SIMDE_FLOAT32_C(    -0.66), SIMDE_FLOAT32_C(     1.37), SIMDE_FLOAT32_C(     1.08),
+        SIMDE_FLOAT32_C(     0.54), SIMDE_FLOAT32_C(    -1.49), SIMDE_FLOAT32_C(    -0.58), SIMDE_FLOAT32_C(     0.79),
+        SIMDE_FLOAT32_C(     1.39), SIMDE_FLOAT32_C(     1.03), SIMDE_FLOAT32_C(     0.70), SIMDE_FLOAT32_C(    -0.51),
+        SIMDE_FLOAT32_C(    -1.20), SIMDE_FLOAT32_C(     0.59), SIMDE_FLOAT32_C(    -0.97), SIMDE_FLOAT32_C(    -0.76) },
+      SIMDE_FLOAT32_C(        0.12) },
+    { { SIMDE_FLOAT32_C(     0.56), SIMDE_FLOAT32_C(    -0.60), SIMDE_FLOAT32_C(    -1.35), SIMDE_FLOAT32_C(     0.97),
+        SIMDE_FLOAT32_C(    -0.82), SIMDE_FLOAT32_C(    -0.84), SIMDE_FLOAT32_C(     0.99), SIMDE_FLOAT32_C(    -0.57),
+        SIMDE_FLOAT32_C(    -0.55), SIMDE_FLOAT32_C(    -1.14), SIMDE_FLOAT32_C(    -0.56), SIMDE_FLOAT32_C(    -1.21),
+        SIMDE_FLOAT32_C(     1.15), SIMDE_FLOAT32_C(    -0.90), SIMDE_FLOAT32_C(    -0.85), SIMDE_FLOAT32_C(     1.15) },
+      SIMDE_FLOAT32_C(       -0.07) },
+    { { SIMDE_FLOAT32_C(     0.75), SIMDE_FLOAT32_C(    -1.30), SIMDE_FLOAT32_C(     1.09), SIMDE_FLOAT32_C(     1.01),
+        SIMDE_FLOAT32_C(    -1.02), SIMDE_FLOAT32_C(    -0.81), SIMDE_FLOAT32_C(     1.02), SIMDE_FLOAT32_C(    -1.16),
+        SIMDE_FLOAT32_C(    -1.43), SIMDE_FLOAT32_C(     1.16), SIMDE_FLOAT32_C(    -0.85), SIMDE_FLOAT32_C(     1.47),
+        SIMDE_FLOAT32_C(    -0.76), SIMDE_FLOAT32_C(     0.84), SIMDE_FLOAT32_C(     0.99), SIMDE_FLOAT32_C(     1.18) },
+      SIMDE_FLOAT32_C(       -1.62) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_float32 r = simde_mm512_reduce_mul_ps(a);
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_mul_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r;
+  } test_vec[] = {
+    { UINT16_C(28179),
+      { SIMDE_FLOAT32_C(     1.29), SIMDE_FLOAT32_C(     1.13), SIMDE_FLOAT32_C(    -0.64), SIMDE_FLOAT32_C(    -1.18),
+        SIMDE_FLOAT32_C(     0.84), SIMDE_FLOAT32_C(     1.07), SIMDE_FLOAT32_C(     0.85), SIMDE_FLOAT32_C(    -1.06),
+        SIMDE_FLOAT32_C(     1.33), SIMDE_FLOAT32_C(     0.57), SIMDE_FLOAT32_C(    -1.04), SIMDE_FLOAT32_C(     1.08),
+        SIMDE_FLOAT32_C(     1.44), SIMDE_FLOAT32_C(    -0.96), SIMDE_FLOAT32_C(    -1.28), SIMDE_FLOAT32_C(     0.60) },
+      SIMDE_FLOAT32_C(       -0.96) },
+    { UINT16_C(30219),
+      { SIMDE_FLOAT32_C(     0.69), SIMDE_FLOAT32_C(    -0.88), SIMDE_FLOAT32_C(    -0.55), SIMDE_FLOAT32_C(    -1.20),
+        SIMDE_FLOAT32_C(     1.29), SIMDE_FLOAT32_C(     1.06), SIMDE_FLOAT32_C(    -1.06), SIMDE_FLOAT32_C(     1.05),
+        SIMDE_FLOAT32_C(    -0.92), SIMDE_FLOAT32_C(     0.74), SIMDE_FLOAT32_C(    -1.43), SIMDE_FLOAT32_C(    -1.10),
+        SIMDE_FLOAT32_C(     1.06), SIMDE_FLOAT32_C(     1.03), SIMDE_FLOAT32_C(     1.11), SIMDE_FLOAT32_C(    -0.67) },
+      SIMDE_FLOAT32_C(       -0.93) },
+    { UINT16_C(51361),
+      { SIMDE_FLOAT32_C(    -0.90), SIMDE_FLOAT32_C(    -1.17), SIMDE_FLOAT32_C(     0.50), SIMDE_FLOAT32_C(     1.05),
+        SIMDE_FLOAT32_C(     0.51), SIMDE_FLOAT32_C(    -1.00), SIMDE_FLOAT32_C(     1.43), SIMDE_FLOAT32_C(    -0.89),
+        SIMDE_FLOAT32_C(    -1.19), SIMDE_FLOAT32_C(    -0.51), SIMDE_FLOAT32_C(     0.65), SIMDE_FLOAT32_C(    -1.15),
+        SIMDE_FLOAT32_C(     0.83), SIMDE_FLOAT32_C(    -1.43), SIMDE_FLOAT32_C(     1.10), SIMDE_FLOAT32_C(    -0.54) },
+      SIMDE_FLOAT32_C(       -0.55) },
+    { UINT16_C(41980),
+      { SIMDE_FLOAT32_C(    -1.33), SIMDE_FLOAT32_C(    -0.71), SIMDE_FLOAT32_C(     1.29), SIMDE_FLOAT32_C(    -1.08),
+        SIMDE_FLOAT32_C(     1.47), SIMDE_FLOAT32_C(    -1.49), SIMDE_FLOAT32_C(     1.09), SIMDE_FLOAT32_C(    -0.67),
+        SIMDE_FLOAT32_C(    -0.70), SIMDE_FLOAT32_C(     1.33), SIMDE_FLOAT32_C(     0.96), SIMDE_FLOAT32_C(    -1.33),
+        SIMDE_FLOAT32_C(     0.65), SIMDE_FLOAT32_C(    -1.47), SIMDE_FLOAT32_C(     0.78), SIMDE_FLOAT32_C(    -1.34) },
+      SIMDE_FLOAT32_C(        4.09) },
+    { UINT16_C( 4184),
+      { SIMDE_FLOAT32_C(    -1.06), SIMDE_FLOAT32_C(     0.64), SIMDE_FLOAT32_C(     0.85), SIMDE_FLOAT32_C(     0.97),
+        SIMDE_FLOAT32_C(     1.07), SIMDE_FLOAT32_C(    -1.16), SIMDE_FLOAT32_C(     1.16), SIMDE_FLOAT32_C(     0.70),
+        SIMDE_FLOAT32_C(    -0.83), SIMDE_FLOAT32_C(    -1.30), SIMDE_FLOAT32_C(     0.75), SIMDE_FLOAT32_C(    -0.83),
+        SIMDE_FLOAT32_C(     0.54), SIMDE_FLOAT32_C(     1.17), SIMDE_FLOAT32_C(    -1.41), SIMDE_FLOAT32_C(    -0.81) },
+      SIMDE_FLOAT32_C(        0.65) },
+    { UINT16_C(14885),
+      { SIMDE_FLOAT32_C(     1.39), SIMDE_FLOAT32_C(     0.92), SIMDE_FLOAT32_C(    -0.73), SIMDE_FLOAT32_C(    -0.79),
+        SIMDE_FLOAT32_C(    -1.35), SIMDE_FLOAT32_C(    -0.56), SIMDE_FLOAT32_C(    -1.13), SIMDE_FLOAT32_C(     1.47),
+        SIMDE_FLOAT32_C(     0.92), SIMDE_FLOAT32_C(     1.37), SIMDE_FLOAT32_C(    -0.99), SIMDE_FLOAT32_C(    -0.59),
+        SIMDE_FLOAT32_C(     0.61), SIMDE_FLOAT32_C(    -0.59), SIMDE_FLOAT32_C(    -1.41), SIMDE_FLOAT32_C(    -1.02) },
+      SIMDE_FLOAT32_C(        0.17) },
+    { UINT16_C(42223),
+      { SIMDE_FLOAT32_C(    -0.60), SIMDE_FLOAT32_C(    -0.94), SIMDE_FLOAT32_C(     1.39), SIMDE_FLOAT32_C(     1.11),
+        SIMDE_FLOAT32_C(    -0.86), SIMDE_FLOAT32_C(    -0.89), SIMDE_FLOAT32_C(    -0.99), SIMDE_FLOAT32_C(     1.18),
+        SIMDE_FLOAT32_C(    -0.73), SIMDE_FLOAT32_C(     0.96), SIMDE_FLOAT32_C(    -1.46), SIMDE_FLOAT32_C(    -0.70),
+        SIMDE_FLOAT32_C(    -1.04), SIMDE_FLOAT32_C(     0.67), SIMDE_FLOAT32_C(    -1.30), SIMDE_FLOAT32_C(     0.84) },
+      SIMDE_FLOAT32_C(       -0.74) },
+    { UINT16_C(13819),
+      { SIMDE_FLOAT32_C(    -0.54), SIMDE_FLOAT32_C(    -0.79), SIMDE_FLOAT32_C(    -0.65), SIMDE_FLOAT32_C(    -0.70),
+        SIMDE_FLOAT32_C(    -0.63), SIMDE_FLOAT32_C(     0.95), SIMDE_FLOAT32_C(    -1.27), SIMDE_FLOAT32_C(    -0.74),
+        SIMDE_FLOAT32_C(     0.98), SIMDE_FLOAT32_C(     0.82), SIMDE_FLOAT32_C(    -1.22), SIMDE_FLOAT32_C(     0.81),
+        SIMDE_FLOAT32_C(     1.11), SIMDE_FLOAT32_C(     1.18), SIMDE_FLOAT32_C(     1.39), SIMDE_FLOAT32_C(     1.30) },
+      SIMDE_FLOAT32_C(       -0.26) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_float32 r = simde_mm512_mask_reduce_mul_ps(test_vec[i].k, a);
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_mul_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[8];
+    const simde_float64 r;
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(    -1.24), SIMDE_FLOAT64_C(     1.29), SIMDE_FLOAT64_C(     0.81), SIMDE_FLOAT64_C(    -0.50),
+        SIMDE_FLOAT64_C(     0.87), SIMDE_FLOAT64_C(     0.78), SIMDE_FLOAT64_C(    -1.16), SIMDE_FLOAT64_C(     0.83) },
+      SIMDE_FLOAT64_C(       -0.42) },
+    { { SIMDE_FLOAT64_C(    -0.86), SIMDE_FLOAT64_C(     1.15), SIMDE_FLOAT64_C(     0.87), SIMDE_FLOAT64_C(     1.45),
+        SIMDE_FLOAT64_C(     0.86), SIMDE_FLOAT64_C(    -0.77), SIMDE_FLOAT64_C(    -1.11), SIMDE_FLOAT64_C(     1.40) },
+      SIMDE_FLOAT64_C(       -1.28) },
+    { { SIMDE_FLOAT64_C(    -0.86), SIMDE_FLOAT64_C(     1.39), SIMDE_FLOAT64_C(    -0.72), SIMDE_FLOAT64_C(     0.74),
+        SIMDE_FLOAT64_C(     0.58), SIMDE_FLOAT64_C(    -1.09), SIMDE_FLOAT64_C(     0.65), SIMDE_FLOAT64_C(     0.80) },
+      SIMDE_FLOAT64_C(       -0.21) },
+    { { SIMDE_FLOAT64_C(     0.77), SIMDE_FLOAT64_C(     1.23), SIMDE_FLOAT64_C(    -0.56), SIMDE_FLOAT64_C(    -1.41),
+        SIMDE_FLOAT64_C(    -1.05), SIMDE_FLOAT64_C(     0.87), SIMDE_FLOAT64_C(     1.09), SIMDE_FLOAT64_C(     0.93) },
+      SIMDE_FLOAT64_C(       -0.69) },
+    { { SIMDE_FLOAT64_C(     1.12), SIMDE_FLOAT64_C(    -0.98), SIMDE_FLOAT64_C(     0.89), SIMDE_FLOAT64_C(    -1.22),
+        SIMDE_FLOAT64_C(    -0.51), SIMDE_FLOAT64_C(    -1.14), SIMDE_FLOAT64_C(    -1.10), SIMDE_FLOAT64_C(     1.45) },
+      SIMDE_FLOAT64_C(       -1.11) },
+    { { SIMDE_FLOAT64_C(     0.90), SIMDE_FLOAT64_C(    -1.39), SIMDE_FLOAT64_C(    -1.32), SIMDE_FLOAT64_C(    -1.17),
+        SIMDE_FLOAT64_C(    -0.78), SIMDE_FLOAT64_C(     1.28), SIMDE_FLOAT64_C(     1.10), SIMDE_FLOAT64_C(     1.42) },
+      SIMDE_FLOAT64_C(        3.01) },
+    { { SIMDE_FLOAT64_C(     0.88), SIMDE_FLOAT64_C(     1.08), SIMDE_FLOAT64_C(    -1.16), SIMDE_FLOAT64_C(     1.49),
+        SIMDE_FLOAT64_C(    -0.86), SIMDE_FLOAT64_C(     1.24), SIMDE_FLOAT64_C(     1.02), SIMDE_FLOAT64_C(     0.70) },
+      SIMDE_FLOAT64_C(        1.25) },
+    { { SIMDE_FLOAT64_C(     0.57), SIMDE_FLOAT64_C(    -1.04), SIMDE_FLOAT64_C(    -1.18), SIMDE_FLOAT64_C(     1.43),
+        SIMDE_FLOAT64_C(    -0.75), SIMDE_FLOAT64_C(    -0.69), SIMDE_FLOAT64_C(     0.83), SIMDE_FLOAT64_C(     1.40) },
+      SIMDE_FLOAT64_C(        0.60) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_float64 r = simde_mm512_reduce_mul_pd(a);
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_mul_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r;
+  } test_vec[] = {
+    { UINT8_C( 59),
+      { SIMDE_FLOAT64_C(     1.09), SIMDE_FLOAT64_C(     0.89), SIMDE_FLOAT64_C(    -0.61), SIMDE_FLOAT64_C(    -0.80),
+        SIMDE_FLOAT64_C(     0.95), SIMDE_FLOAT64_C(    -0.50), SIMDE_FLOAT64_C(    -1.41), SIMDE_FLOAT64_C(     0.58) },
+      SIMDE_FLOAT64_C(        0.37) },
+    { UINT8_C(211),
+      { SIMDE_FLOAT64_C(    -1.26), SIMDE_FLOAT64_C(    -1.19), SIMDE_FLOAT64_C(    -1.35), SIMDE_FLOAT64_C(     1.38),
+        SIMDE_FLOAT64_C(     0.70), SIMDE_FLOAT64_C(     0.91), SIMDE_FLOAT64_C(    -0.93), SIMDE_FLOAT64_C(    -0.75) },
+      SIMDE_FLOAT64_C(        0.73) },
+    { UINT8_C(  8),
+      { SIMDE_FLOAT64_C(     0.86), SIMDE_FLOAT64_C(     0.74), SIMDE_FLOAT64_C(     1.24), SIMDE_FLOAT64_C(     1.24),
+        SIMDE_FLOAT64_C(    -1.25), SIMDE_FLOAT64_C(     1.49), SIMDE_FLOAT64_C(     0.63), SIMDE_FLOAT64_C(    -1.45) },
+      SIMDE_FLOAT64_C(        1.24) },
+    { UINT8_C(106),
+      { SIMDE_FLOAT64_C(     0.90), SIMDE_FLOAT64_C(     1.43), SIMDE_FLOAT64_C(     1.26), SIMDE_FLOAT64_C(     0.89),
+        SIMDE_FLOAT64_C(     0.79), SIMDE_FLOAT64_C(     0.55), SIMDE_FLOAT64_C(     1.32), SIMDE_FLOAT64_C(     1.21) },
+      SIMDE_FLOAT64_C(        0.92) },
+    { UINT8_C(102),
+      { SIMDE_FLOAT64_C(     1.36), SIMDE_FLOAT64_C(     0.52), SIMDE_FLOAT64_C(     0.91), SIMDE_FLOAT64_C(    -0.52),
+        SIMDE_FLOAT64_C(    -0.63), SIMDE_FLOAT64_C(    -1.10), SIMDE_FLOAT64_C(    -0.91), SIMDE_FLOAT64_C(     1.41) },
+      SIMDE_FLOAT64_C(        0.47) },
+    { UINT8_C(107),
+      { SIMDE_FLOAT64_C(    -1.01), SIMDE_FLOAT64_C(    -0.80), SIMDE_FLOAT64_C(     1.12), SIMDE_FLOAT64_C(     1.39),
+        SIMDE_FLOAT64_C(    -0.99), SIMDE_FLOAT64_C(     0.97), SIMDE_FLOAT64_C(    -0.75), SIMDE_FLOAT64_C(    -0.94) },
+      SIMDE_FLOAT64_C(       -0.82) },
+    { UINT8_C(119),
+      { SIMDE_FLOAT64_C(    -0.51), SIMDE_FLOAT64_C(     0.63), SIMDE_FLOAT64_C(     1.28), SIMDE_FLOAT64_C(    -0.58),
+        SIMDE_FLOAT64_C(    -0.59), SIMDE_FLOAT64_C(     0.63), SIMDE_FLOAT64_C(     0.80), SIMDE_FLOAT64_C(     0.65) },
+      SIMDE_FLOAT64_C(        0.12) },
+    { UINT8_C( 90),
+      { SIMDE_FLOAT64_C(     0.54), SIMDE_FLOAT64_C(    -0.60), SIMDE_FLOAT64_C(    -0.76), SIMDE_FLOAT64_C(    -0.63),
+        SIMDE_FLOAT64_C(    -0.72), SIMDE_FLOAT64_C(     0.79), SIMDE_FLOAT64_C(     0.85), SIMDE_FLOAT64_C(     1.37) },
+      SIMDE_FLOAT64_C(       -0.23) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_float64 r = simde_mm512_mask_reduce_mul_pd(test_vec[i].k, a);
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_max_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { { -INT32_C(  1120313538),  INT32_C(   502473216), -INT32_C(   238533564),  INT32_C(  1630160332),  INT32_C(  1229906503),  INT32_C(  1588203075),  INT32_C(  2086840991),  INT32_C(  1232545802),
+        -INT32_C(   459635494), -INT32_C(   842021037), -INT32_C(   109712355), -INT32_C(   747265915),  INT32_C(    44288644), -INT32_C(   853103599),  INT32_C(  1485292809), -INT32_C(  1025464125) },
+       INT32_C(  2086840991) },
+    { { -INT32_C(  2075997280),  INT32_C(  1659020855), -INT32_C(  1421996357),  INT32_C(    49331302), -INT32_C(  2140502882),  INT32_C(   225883671), -INT32_C(  1284161861),  INT32_C(   243735046),
+         INT32_C(  1501058482), -INT32_C(   899970663), -INT32_C(   980780854),  INT32_C(  1022369467), -INT32_C(   338350010), -INT32_C(   636859482),  INT32_C(  1765439153),  INT32_C(   563842588) },
+       INT32_C(  1765439153) },
+    { {  INT32_C(   374263676), -INT32_C(  1208349214),  INT32_C(    56148345), -INT32_C(   298381637), -INT32_C(   516706714), -INT32_C(  1432186694),  INT32_C(  1903344411), -INT32_C(  1190659923),
+         INT32_C(   547781660), -INT32_C(  1422673948),  INT32_C(   459450763), -INT32_C(   520131048), -INT32_C(   894560572),  INT32_C(   196377577),  INT32_C(  1300023646),  INT32_C(  1365747532) },
+       INT32_C(  1903344411) },
+    { {  INT32_C(   120470004),  INT32_C(  1084135559),  INT32_C(   910517366), -INT32_C(   545115330), -INT32_C(   815384360), -INT32_C(  1556102487),  INT32_C(  1594111852),  INT32_C(  1214145538),
+         INT32_C(  1531156554),  INT32_C(  1609453050),  INT32_C(  2126491617), -INT32_C(  1414985474),  INT32_C(   561882479),  INT32_C(  2133976549), -INT32_C(    69836946), -INT32_C(   923015088) },
+       INT32_C(  2133976549) },
+    { { -INT32_C(   203825257), -INT32_C(  1335137816), -INT32_C(  1164262085),  INT32_C(   756801137),  INT32_C(   425874829), -INT32_C(   675786138), -INT32_C(   657753278),  INT32_C(   950304052),
+        -INT32_C(   974063410),  INT32_C(   337832639), -INT32_C(   424419158), -INT32_C(  1270485525),  INT32_C(   671841520), -INT32_C(  1425517047),  INT32_C(   222356709),  INT32_C(  1193802860) },
+       INT32_C(  1193802860) },
+    { { -INT32_C(   962827323),  INT32_C(  1171718738),  INT32_C(   830109910),  INT32_C(   198343079), -INT32_C(  1723378540),  INT32_C(  1061715773), -INT32_C(  1412923261),  INT32_C(  1647006018),
+         INT32_C(   919803744), -INT32_C(  2046072498), -INT32_C(    87233508),  INT32_C(  1779036868),  INT32_C(  1891356705), -INT32_C(   886534207),  INT32_C(  1817775774), -INT32_C(  1156064509) },
+       INT32_C(  1891356705) },
+    { { -INT32_C(  1481059427),  INT32_C(  1313138042), -INT32_C(  1221692880), -INT32_C(  1204641068),  INT32_C(  1116926609), -INT32_C(   762227916),  INT32_C(  1579302034),  INT32_C(   659889259),
+         INT32_C(  1559743635), -INT32_C(  2118424630), -INT32_C(  1517116539), -INT32_C(  1090140286), -INT32_C(   119509875), -INT32_C(   894226668),  INT32_C(  1117457482), -INT32_C(   923768622) },
+       INT32_C(  1579302034) },
+    { { -INT32_C(   190155846),  INT32_C(  1544718813), -INT32_C(   399541362),  INT32_C(   245499641),  INT32_C(  1166662836), -INT32_C(   453418483),  INT32_C(   507229065),  INT32_C(  1942357678),
+        -INT32_C(   768351965),  INT32_C(  1560915489),  INT32_C(  1483085117),  INT32_C(   827995735), -INT32_C(  1668679685),  INT32_C(  1050311380),  INT32_C(   794917665), -INT32_C(  1154788969) },
+       INT32_C(  1942357678) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_reduce_max_epi32(a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_max_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { UINT16_C(33524),
+      {  INT32_C(    21829873), -INT32_C(   132669824), -INT32_C(  1935011395),  INT32_C(  1186761438), -INT32_C(  1159822261),  INT32_C(   293948291), -INT32_C(  1104363052),  INT32_C(   183790935),
+         INT32_C(   583675981), -INT32_C(   489678995),  INT32_C(  2012990467), -INT32_C(  2066654373), -INT32_C(   490778835),  INT32_C(  1890212595),  INT32_C(  1250939526),  INT32_C(  1526246563) },
+       INT32_C(  1526246563) },
+    { UINT16_C( 5434),
+      { -INT32_C(   168093808),  INT32_C(  2002322879), -INT32_C(  1146537868), -INT32_C(  1852377340), -INT32_C(   197354518),  INT32_C(  1899321437),  INT32_C(   617645485), -INT32_C(   540938266),
+         INT32_C(   948655545), -INT32_C(   834925230),  INT32_C(  2023317960), -INT32_C(  1742790389), -INT32_C(  1848361591), -INT32_C(  1624385614),  INT32_C(  1755979933),  INT32_C(   366539676) },
+       INT32_C(  2023317960) },
+    { UINT16_C( 9595),
+      { -INT32_C(  1572040719), -INT32_C(   360068434), -INT32_C(  2129808709),  INT32_C(  1057515294), -INT32_C(   953388976), -INT32_C(  1194050384), -INT32_C(    55658295),  INT32_C(   504428536),
+        -INT32_C(  1665128425),  INT32_C(  1342131591),  INT32_C(   683356892), -INT32_C(   988843079), -INT32_C(  1861049570),  INT32_C(   525042136),  INT32_C(  1477992667), -INT32_C(   652278054) },
+       INT32_C(  1057515294) },
+    { UINT16_C(52823),
+      {  INT32_C(  1982105611),  INT32_C(  1365091291), -INT32_C(  1001091492),  INT32_C(   531902528),  INT32_C(  1523533856), -INT32_C(   171123024),  INT32_C(   215804685),  INT32_C(   799551899),
+        -INT32_C(   709335240),  INT32_C(  1291966966), -INT32_C(   514234427), -INT32_C(   189889462), -INT32_C(   638874686), -INT32_C(   882316203), -INT32_C(  2032826163),  INT32_C(  1654370460) },
+       INT32_C(  1982105611) },
+    { UINT16_C( 8445),
+      { -INT32_C(   988149252), -INT32_C(   856440081), -INT32_C(  1735164246), -INT32_C(  1257852201), -INT32_C(   981538190), -INT32_C(   666055898),  INT32_C(   969562928),  INT32_C(   189072262),
+         INT32_C(  1482795009),  INT32_C(  1738099473), -INT32_C(   471294521),  INT32_C(   466148668),  INT32_C(   459506566), -INT32_C(  1513659135), -INT32_C(  1193047157),  INT32_C(   213503580) },
+       INT32_C(   969562928) },
+    { UINT16_C(43712),
+      { -INT32_C(  1403704427), -INT32_C(  1506687870), -INT32_C(   661993589),  INT32_C(  1995657412),  INT32_C(  1914177381),  INT32_C(   809979435), -INT32_C(  1797313929),  INT32_C(  1521805795),
+         INT32_C(  1810340080), -INT32_C(  1538626623),  INT32_C(   508309334), -INT32_C(   176053624),  INT32_C(  1741226957), -INT32_C(    30686582), -INT32_C(  1201113201), -INT32_C(   558586720) },
+       INT32_C(  1521805795) },
+    { UINT16_C(58857),
+      { -INT32_C(   805539230),  INT32_C(   692015622), -INT32_C(   994218718),  INT32_C(  1463492472), -INT32_C(   432949434),  INT32_C(   707315112),  INT32_C(   314506787),  INT32_C(   618556191),
+        -INT32_C(   126029815),  INT32_C(   937634729),  INT32_C(  2135893950),  INT32_C(  1013814897), -INT32_C(  1249578723), -INT32_C(   661774401), -INT32_C(  1815147456), -INT32_C(   502037928) },
+       INT32_C(  2135893950) },
+    { UINT16_C(13148),
+      {  INT32_C(   826076218),  INT32_C(  2032589666),  INT32_C(  1973816916), -INT32_C(  1886103736),  INT32_C(  1790684646),  INT32_C(  1598251837), -INT32_C(   231437637), -INT32_C(   881250962),
+        -INT32_C(   429833036), -INT32_C(  1156568259),  INT32_C(   593323051), -INT32_C(  1266568157), -INT32_C(  1374167157),  INT32_C(   816149236), -INT32_C(     1833711), -INT32_C(   854677157) },
+       INT32_C(  1973816916) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_mask_reduce_max_epi32(test_vec[i].k, a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_max_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint32_t a[16];
+    const uint32_t r;
+  } test_vec[] = {
+    { { UINT32_C(4189659020), UINT32_C( 949620403), UINT32_C(3982685806), UINT32_C(1691117570), UINT32_C( 549171282), UINT32_C(2641925042), UINT32_C(3426405909), UINT32_C(3611401929),
+        UINT32_C(4164521908), UINT32_C(3037368747), UINT32_C(2019659336), UINT32_C(3616792404), UINT32_C(3874860522), UINT32_C(1301052465), UINT32_C(3197913225), UINT32_C(3813831256) },
+      UINT32_C(4189659020) },
+    { { UINT32_C(2183698749), UINT32_C(2226333519), UINT32_C(1746432705), UINT32_C(2789528164), UINT32_C( 368067264), UINT32_C( 353964613), UINT32_C(2776437025), UINT32_C( 802259779),
+        UINT32_C(4237070469), UINT32_C(3314092260), UINT32_C(3468076021), UINT32_C( 991532018), UINT32_C( 400497749), UINT32_C(2783385389), UINT32_C( 420131395), UINT32_C(2685556711) },
+      UINT32_C(4237070469) },
+    { { UINT32_C( 511352413), UINT32_C(4251474977), UINT32_C(4206077145), UINT32_C(3197425104), UINT32_C(3767568507), UINT32_C(2368395179), UINT32_C(3791128772), UINT32_C(2760591829),
+        UINT32_C(4096166406), UINT32_C(1577617042), UINT32_C( 846820127), UINT32_C(2991629881), UINT32_C(1940957493), UINT32_C(2450859303), UINT32_C(1166452397), UINT32_C(1496424608) },
+      UINT32_C(4251474977) },
+    { { UINT32_C(3938928758), UINT32_C( 486677350), UINT32_C( 661784272), UINT32_C(3604829917), UINT32_C(1419705136), UINT32_C(2271414982), UINT32_C(3042032979), UINT32_C(1781279465),
+        UINT32_C(3143100668), UINT32_C(1855911981), UINT32_C(1271033501), UINT32_C(1209920768), UINT32_C( 736270042), UINT32_C(1629857143), UINT32_C( 299521021), UINT32_C(3072768026) },
+      UINT32_C(3938928758) },
+    { { UINT32_C(1267755533), UINT32_C( 795765145), UINT32_C(1502475018), UINT32_C(2499504748), UINT32_C(4046817208), UINT32_C(1714356919), UINT32_C( 496046450), UINT32_C(  73412560),
+        UINT32_C(2122783631), UINT32_C(1279071864), UINT32_C(1938289236), UINT32_C(2042030256), UINT32_C(2703993185), UINT32_C( 189367923), UINT32_C(2626611647), UINT32_C(1449294764) },
+      UINT32_C(4046817208) },
+    { { UINT32_C( 437552435), UINT32_C(2891284729), UINT32_C( 688010680), UINT32_C( 885809107), UINT32_C( 990925740), UINT32_C( 856758283), UINT32_C(2814793979), UINT32_C( 387222154),
+        UINT32_C(2306294047), UINT32_C( 489424989), UINT32_C( 587589389), UINT32_C(2547879811), UINT32_C(1691989084), UINT32_C( 715034676), UINT32_C( 759242772), UINT32_C( 301541204) },
+      UINT32_C(2891284729) },
+    { { UINT32_C(1208769946), UINT32_C(2038064033), UINT32_C(3576192806), UINT32_C(3108046360), UINT32_C(  43581972), UINT32_C(2059285776), UINT32_C( 865078650), UINT32_C(2610639840),
+        UINT32_C(1662188935), UINT32_C(2644728252), UINT32_C(3446140943), UINT32_C(1298062383), UINT32_C(1666746967), UINT32_C(1844465283), UINT32_C(4250169054), UINT32_C( 795390339) },
+      UINT32_C(4250169054) },
+    { { UINT32_C(1068285152), UINT32_C( 978509209), UINT32_C(1978023522), UINT32_C(3161598622), UINT32_C(2017831243), UINT32_C(1531187417), UINT32_C(1570606776), UINT32_C( 383261605),
+        UINT32_C(2753815250), UINT32_C(3135721879), UINT32_C(2912688884), UINT32_C(1461526465), UINT32_C(1148253630), UINT32_C(1608039381), UINT32_C(3455541218), UINT32_C(2919041501) },
+      UINT32_C(3455541218) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(HEDLEY_REINTERPRET_CAST(const int32_t*, test_vec[i].a));
+    uint32_t r = simde_mm512_reduce_max_epu32(a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_max_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const uint32_t a[16];
+    const uint32_t r;
+  } test_vec[] = {
+    { UINT16_C( 9358),
+      { UINT32_C(1357267271), UINT32_C(2717203461), UINT32_C(3724769085), UINT32_C(2225282707), UINT32_C(1952685166), UINT32_C( 843940054), UINT32_C(3422416471), UINT32_C(3696058443),
+        UINT32_C(1748142155), UINT32_C(3430915995), UINT32_C(2839275108), UINT32_C( 386697384), UINT32_C(1147648953), UINT32_C(4218075790), UINT32_C(3147107451), UINT32_C(  23615651) },
+      UINT32_C(4218075790) },
+    { UINT16_C(49362),
+      { UINT32_C(2397515219), UINT32_C(1763440456), UINT32_C(2995851942), UINT32_C(1474451715), UINT32_C(1813626225), UINT32_C( 798421579), UINT32_C(1960979823), UINT32_C(1019695861),
+        UINT32_C(1427423504), UINT32_C(2944969874), UINT32_C(3321420107), UINT32_C( 488512057), UINT32_C(4286548045), UINT32_C(1716569117), UINT32_C(2206515925), UINT32_C( 600432144) },
+      UINT32_C(2206515925) },
+    { UINT16_C(51628),
+      { UINT32_C(1068033343), UINT32_C(1227037493), UINT32_C(3969331267), UINT32_C(1498181347), UINT32_C(1959079678), UINT32_C( 150919971), UINT32_C(1553436245), UINT32_C(3692401673),
+        UINT32_C(3196820833), UINT32_C(4136366619), UINT32_C(3081175871), UINT32_C(4137509625), UINT32_C( 344966780), UINT32_C(3329804016), UINT32_C( 568429437), UINT32_C(  49887019) },
+      UINT32_C(4137509625) },
+    { UINT16_C(28549),
+      { UINT32_C(2760348186), UINT32_C(1561680830), UINT32_C(  10247817), UINT32_C(2159273076), UINT32_C(2495422140), UINT32_C(4094053249), UINT32_C(3315631958), UINT32_C(3377517528),
+        UINT32_C( 343114879), UINT32_C( 593206455), UINT32_C(  15787598), UINT32_C(3255129090), UINT32_C(3053461034), UINT32_C(2978141334), UINT32_C(3250074815), UINT32_C(3700263702) },
+      UINT32_C(3377517528) },
+    { UINT16_C(38272),
+      { UINT32_C( 679976107), UINT32_C(1811994962), UINT32_C(2097466464), UINT32_C(3132218872), UINT32_C( 512409667), UINT32_C(3154748675), UINT32_C(3198850697), UINT32_C( 879444452),
+        UINT32_C(3189861991), UINT32_C(1547457915), UINT32_C(1193022225), UINT32_C(3390754679), UINT32_C(2692859689), UINT32_C(1150955239), UINT32_C(3215999866), UINT32_C(3863526780) },
+      UINT32_C(3863526780) },
+    { UINT16_C(62214),
+      { UINT32_C(3010257760), UINT32_C(2249384614), UINT32_C(1244966627), UINT32_C(2762678142), UINT32_C(1632261824), UINT32_C(4280250989), UINT32_C(4175591369), UINT32_C(2780520806),
+        UINT32_C(3125579300), UINT32_C(1303322168), UINT32_C(1799147012), UINT32_C(2116662936), UINT32_C( 193020917), UINT32_C(2346458162), UINT32_C(1465837706), UINT32_C( 854407131) },
+      UINT32_C(3125579300) },
+    { UINT16_C(31604),
+      { UINT32_C(2482342530), UINT32_C(3704520983), UINT32_C(3009395157), UINT32_C( 354538470), UINT32_C( 981576129), UINT32_C( 738392786), UINT32_C(2297432999), UINT32_C( 410509936),
+        UINT32_C(1587122612), UINT32_C( 425217943), UINT32_C(4112251592), UINT32_C(2670493501), UINT32_C( 300697731), UINT32_C(1818874066), UINT32_C(1228503027), UINT32_C( 313563612) },
+      UINT32_C(3009395157) },
+    { UINT16_C( 4079),
+      { UINT32_C( 368883760), UINT32_C(  58674496), UINT32_C(1958142938), UINT32_C(2426812573), UINT32_C(2319643564), UINT32_C( 218701131), UINT32_C(2879339953), UINT32_C(3584380810),
+        UINT32_C(3045500821), UINT32_C(3833786266), UINT32_C(3012119749), UINT32_C(1964887836), UINT32_C(3965956994), UINT32_C(1072551013), UINT32_C(1869723277), UINT32_C(4132656800) },
+      UINT32_C(3833786266) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(HEDLEY_REINTERPRET_CAST(const int32_t*, test_vec[i].a));
+    uint32_t r = simde_mm512_mask_reduce_max_epu32(test_vec[i].k, a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_max_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { {  INT64_C( 8122273120522777597),  INT64_C( 2382103433302442458), -INT64_C( 3766900170731404967), -INT64_C( 7183977932251376741),
+         INT64_C( 5970377701387995132), -INT64_C(   68225759099407629), -INT64_C( 2158730651193877418),  INT64_C( 7091605675701512046) },
+       INT64_C( 8122273120522777597) },
+    { {  INT64_C( 2909689289812693389), -INT64_C( 1909940464984882066),  INT64_C( 8064485986423964390),  INT64_C( 2134198276100533859),
+         INT64_C( 6216117952385557759),  INT64_C( 4203597808357852790), -INT64_C( 3261597743158717318), -INT64_C( 3579272115081390894) },
+       INT64_C( 8064485986423964390) },
+    { {  INT64_C( 1207719959475946504), -INT64_C( 9219132378526520576),  INT64_C( 2593542245943088342), -INT64_C( 3824132686991642241),
+        -INT64_C( 6169043890925125411), -INT64_C( 6451844571249382116),  INT64_C( 8769632772248592838), -INT64_C( 3468362724728385403) },
+       INT64_C( 8769632772248592838) },
+    { { -INT64_C( 2216876122745106264), -INT64_C( 7014352226034791031), -INT64_C( 3955130137228018606),  INT64_C( 2366286149504303402),
+         INT64_C( 6781292506193643688), -INT64_C( 5060566939367210183), -INT64_C( 9115101543780667265),  INT64_C( 5018843174381413087) },
+       INT64_C( 6781292506193643688) },
+    { {  INT64_C( 3947822678686280871), -INT64_C(   35727097229032898), -INT64_C(  882782196582838214), -INT64_C( 7976892755089680742),
+        -INT64_C( 8012120012742194121), -INT64_C( 9033553394167281169),  INT64_C( 5304328695971272508),  INT64_C( 5852860896666162834) },
+       INT64_C( 5852860896666162834) },
+    { {  INT64_C(  295899781794981925), -INT64_C(  231238443504778315), -INT64_C( 7928282315382228622), -INT64_C( 4718052501588269312),
+        -INT64_C( 7883519197521410226), -INT64_C(  864834570670042176),  INT64_C( 5754431893219941351),  INT64_C( 2484564639898704144) },
+       INT64_C( 5754431893219941351) },
+    { { -INT64_C( 8090642048090624070),  INT64_C(  115994460117266789), -INT64_C( 2528288199886540857),  INT64_C( 4968401109430802648),
+         INT64_C( 5613877428797710825),  INT64_C( 3923602490619813866), -INT64_C( 3877144119787547691),  INT64_C( 4406570502352659890) },
+       INT64_C( 5613877428797710825) },
+    { { -INT64_C( 2843779238959360788), -INT64_C( 1275156956743169211), -INT64_C( 7422217214296059117),  INT64_C(  991055015550683125),
+         INT64_C( 2522766866187441082), -INT64_C( 1656517016357467747),  INT64_C( 8457560565540549070), -INT64_C( 4912569925015172947) },
+       INT64_C( 8457560565540549070) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_reduce_max_epi64(a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_max_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { UINT8_C(252),
+      {  INT64_C( 4461182377464846123), -INT64_C( 1312142127186906811),  INT64_C( 1031221697975707111),  INT64_C( 4164270082422797548),
+        -INT64_C( 7759692135645479419),  INT64_C( 2926017820050896313),  INT64_C( 8459712743461866130), -INT64_C( 3185085922084198009) },
+       INT64_C( 8459712743461866130) },
+    { UINT8_C(148),
+      {  INT64_C( 6761085153346348047),  INT64_C( 9211375461306484487), -INT64_C( 5280386919616692663),  INT64_C( 9140147581587508597),
+         INT64_C( 8364858580851943087), -INT64_C( 2036190927142342494),  INT64_C( 3567936191512266051), -INT64_C( 8364210917913999607) },
+       INT64_C( 8364858580851943087) },
+    { UINT8_C(199),
+      { -INT64_C( 3900967751513406362),  INT64_C(  891469270629632494), -INT64_C( 6956277715050434819), -INT64_C( 8572071873838246304),
+         INT64_C( 6563916882834164812),  INT64_C( 7159198987589162324), -INT64_C( 6770544399181779586),  INT64_C( 1813753392480351780) },
+       INT64_C( 1813753392480351780) },
+    { UINT8_C(200),
+      {  INT64_C(  190762307515002107),  INT64_C( 4758580146624568418), -INT64_C( 3660875093111581222), -INT64_C( 8102771420536870927),
+        -INT64_C( 2411256673585801346),  INT64_C( 7610277226998892880), -INT64_C( 2555893479166911934),  INT64_C( 4657765463153116022) },
+       INT64_C( 4657765463153116022) },
+    { UINT8_C(240),
+      { -INT64_C( 7708392470837549183), -INT64_C(  484781941508294002), -INT64_C( 6872799594261289349), -INT64_C(  919175046534746505),
+         INT64_C( 2185355615290137323), -INT64_C( 4477961630861538274), -INT64_C( 1985616627839607546), -INT64_C( 3972657996909618884) },
+       INT64_C( 2185355615290137323) },
+    { UINT8_C(142),
+      {  INT64_C( 5762340782503882363), -INT64_C( 1544262063940511897),  INT64_C( 4824388013656146697), -INT64_C( 7357308279915667377),
+         INT64_C( 8631793964120866767), -INT64_C( 3371729622118597136),  INT64_C( 6660281538757257995),  INT64_C(  391198805833098781) },
+       INT64_C( 4824388013656146697) },
+    { UINT8_C( 17),
+      { -INT64_C( 6526548544014533209), -INT64_C( 7368008264160025828),  INT64_C( 3084525997102929626),  INT64_C( 7714630565277494903),
+        -INT64_C( 4196283257754588309),  INT64_C( 7520878174345555325),  INT64_C(  881067154720008167),  INT64_C( 2394414715282656616) },
+      -INT64_C( 4196283257754588309) },
+    { UINT8_C(114),
+      { -INT64_C(  613824607554762036),  INT64_C( 8081379843624117721),  INT64_C( 3254448648606817490),  INT64_C( 8853107266815066987),
+         INT64_C( 5054862728373427117),  INT64_C( 2533904255037345370),  INT64_C( 2387653425401588934),  INT64_C( 6110351242016588191) },
+       INT64_C( 8081379843624117721) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_mask_reduce_max_epi64(test_vec[i].k, a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_max_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint64_t a[8];
+    const uint64_t r;
+  } test_vec[] = {
+    { { UINT64_C(13209216265141224256), UINT64_C(10944609688665247558), UINT64_C(10157792855900274520), UINT64_C(11170810602863769126),
+        UINT64_C(   87194695124928202), UINT64_C( 5814411135063213255), UINT64_C(11580143571933994126), UINT64_C(17371647840022213431) },
+      UINT64_C(17371647840022213431) },
+    { { UINT64_C(13928038758632399934), UINT64_C(17530245740055411702), UINT64_C(18036262202062543617), UINT64_C( 3715182341762418551),
+        UINT64_C(10048606707156361657), UINT64_C(  128104790342614202), UINT64_C(11533837331069868355), UINT64_C(12056256247262623665) },
+      UINT64_C(18036262202062543617) },
+    { { UINT64_C(  862927955677888345), UINT64_C( 5162577766955358055), UINT64_C(12447721586570970761), UINT64_C(18193223846558156868),
+        UINT64_C( 1665751361422876372), UINT64_C( 5918216498401221737), UINT64_C(17782371979810158865), UINT64_C(13482067851476680227) },
+      UINT64_C(18193223846558156868) },
+    { { UINT64_C(13028566206884866334), UINT64_C(15190841352379851084), UINT64_C( 6731658969584526990), UINT64_C( 7808814097643361731),
+        UINT64_C( 9946535466220877224), UINT64_C(16286923212186896707), UINT64_C( 3085035445416498193), UINT64_C(13657445847436633209) },
+      UINT64_C(16286923212186896707) },
+    { { UINT64_C(  477888157385433189), UINT64_C(12642547741026893669), UINT64_C( 6234881445163819099), UINT64_C(14618386478101415259),
+        UINT64_C( 3701358303442551825), UINT64_C(12453856013037970905), UINT64_C( 4637698384649652434), UINT64_C(11167254764370827331) },
+      UINT64_C(14618386478101415259) },
+    { { UINT64_C( 6428457372593880784), UINT64_C(11943992823315640109), UINT64_C(10529130292452545075), UINT64_C( 1426630970525245015),
+        UINT64_C( 2054213303274463019), UINT64_C( 3264876260175898965), UINT64_C( 3459791317474466759), UINT64_C( 4068868418849463728) },
+      UINT64_C(11943992823315640109) },
+    { { UINT64_C(18436422981071364327), UINT64_C( 9747124794878627814), UINT64_C(11676443729312481145), UINT64_C( 7981528814179320519),
+        UINT64_C(  948092619788073730), UINT64_C( 2198346760373730804), UINT64_C(17721523582670563599), UINT64_C( 3355342404432910365) },
+      UINT64_C(18436422981071364327) },
+    { { UINT64_C( 6920752222708558670), UINT64_C(15945231948524350232), UINT64_C(14136885620334079182), UINT64_C( 6263690937094336791),
+        UINT64_C(10193820593016764981), UINT64_C( 4805905162946539905), UINT64_C( 8598548178879903778), UINT64_C( 4628649100003106642) },
+      UINT64_C(15945231948524350232) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(HEDLEY_REINTERPRET_CAST(const int64_t*, test_vec[i].a));
+    uint64_t r = simde_mm512_reduce_max_epu64(a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_max_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const uint64_t a[8];
+    const uint64_t r;
+  } test_vec[] = {
+    { UINT8_C(108),
+      { UINT64_C(14853699863182153100), UINT64_C(11808930334013459879), UINT64_C(  552195548001267324), UINT64_C( 5575348734094779552),
+        UINT64_C( 8817667113914123753), UINT64_C( 3955573274949607970), UINT64_C(10759474402018354790), UINT64_C(12732116356799615786) },
+      UINT64_C(10759474402018354790) },
+    { UINT8_C( 12),
+      { UINT64_C(17336712607812320850), UINT64_C(12225658819888990766), UINT64_C( 3527838213409911866), UINT64_C(16997362545642195922),
+        UINT64_C( 6026034896009293765), UINT64_C(14089184170664510810), UINT64_C( 4895825088282022992), UINT64_C(11080984354417753592) },
+      UINT64_C(16997362545642195922) },
+    { UINT8_C(131),
+      { UINT64_C(16536522036388468008), UINT64_C( 6512687753431378434), UINT64_C( 7446044074370271830), UINT64_C(12090028514967233474),
+        UINT64_C( 1164515719641070853), UINT64_C(11545407953767546047), UINT64_C(10378898699588919814), UINT64_C( 9796188686675027522) },
+      UINT64_C(16536522036388468008) },
+    { UINT8_C(142),
+      { UINT64_C(16347396235059411263), UINT64_C(16475584378240965261), UINT64_C( 5680083279476692984), UINT64_C(12864344125744568791),
+        UINT64_C( 4323151472560769700), UINT64_C(11075049518460649905), UINT64_C( 9116959928705378162), UINT64_C( 4919087462321492796) },
+      UINT64_C(16475584378240965261) },
+    { UINT8_C( 26),
+      { UINT64_C( 3890571885427269410), UINT64_C( 8120197008648573084), UINT64_C(14913694030215829437), UINT64_C(14931554867122624850),
+        UINT64_C( 7839417259663261536), UINT64_C(16809319177627382174), UINT64_C(18283018371620724349), UINT64_C(  399497974781192321) },
+      UINT64_C(14931554867122624850) },
+    { UINT8_C(144),
+      { UINT64_C(16300757221962159497), UINT64_C( 3504692471480301538), UINT64_C(17161094359600933901), UINT64_C(17980397373603478805),
+        UINT64_C( 1221955473137178799), UINT64_C( 4575737298343627870), UINT64_C(15781595580661847494), UINT64_C(12751613068125050605) },
+      UINT64_C(12751613068125050605) },
+    { UINT8_C(128),
+      { UINT64_C(17170574116871554769), UINT64_C( 3612417716813928476), UINT64_C(12011212592362427436), UINT64_C(  140264977085526788),
+        UINT64_C( 4607217846256077538), UINT64_C( 9297324928752561271), UINT64_C(   64648959475486191), UINT64_C( 4469133243930989364) },
+      UINT64_C( 4469133243930989364) },
+    { UINT8_C(146),
+      { UINT64_C(16544151978613235643), UINT64_C(16691876961969992644), UINT64_C(15368216204437912611), UINT64_C(11299420504342973467),
+        UINT64_C(15062093100546845507), UINT64_C( 9662153450220401237), UINT64_C(12308617429109235825), UINT64_C( 9289345279153972721) },
+      UINT64_C(16691876961969992644) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(HEDLEY_REINTERPRET_CAST(const int64_t*, test_vec[i].a));
+    uint64_t r = simde_mm512_mask_reduce_max_epu64(test_vec[i].k, a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_max_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[16];
+    const simde_float32 r;
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -883.57), SIMDE_FLOAT32_C(  -137.21), SIMDE_FLOAT32_C(   404.56), SIMDE_FLOAT32_C(    25.50),
+        SIMDE_FLOAT32_C(  -340.70), SIMDE_FLOAT32_C(  -718.65), SIMDE_FLOAT32_C(   -44.23), SIMDE_FLOAT32_C(   185.79),
+        SIMDE_FLOAT32_C(   175.31), SIMDE_FLOAT32_C(   843.22), SIMDE_FLOAT32_C(   725.71), SIMDE_FLOAT32_C(  -473.29),
+        SIMDE_FLOAT32_C(  -153.40), SIMDE_FLOAT32_C(  -437.77), SIMDE_FLOAT32_C(   535.42), SIMDE_FLOAT32_C(   671.77) },
+      SIMDE_FLOAT32_C(      843.22) },
+    { { SIMDE_FLOAT32_C(  -634.81), SIMDE_FLOAT32_C(   489.05), SIMDE_FLOAT32_C(  -943.16), SIMDE_FLOAT32_C(  -185.11),
+        SIMDE_FLOAT32_C(    93.88), SIMDE_FLOAT32_C(  -790.39), SIMDE_FLOAT32_C(   844.10), SIMDE_FLOAT32_C(   680.81),
+        SIMDE_FLOAT32_C(  -423.98), SIMDE_FLOAT32_C(  -435.78), SIMDE_FLOAT32_C(  -326.48), SIMDE_FLOAT32_C(   -69.22),
+        SIMDE_FLOAT32_C(  -511.15), SIMDE_FLOAT32_C(   990.09), SIMDE_FLOAT32_C(  -336.05), SIMDE_FLOAT32_C(   998.75) },
+      SIMDE_FLOAT32_C(      998.75) },
+    { { SIMDE_FLOAT32_C(   934.88), SIMDE_FLOAT32_C(  -667.40), SIMDE_FLOAT32_C(   503.04), SIMDE_FLOAT32_C(   702.31),
+        SIMDE_FLOAT32_C(  -676.82), SIMDE_FLOAT32_C(  -751.87), SIMDE_FLOAT32_C(   -93.24), SIMDE_FLOAT32_C(   362.72),
+        SIMDE_FLOAT32_C(  -284.64), SIMDE_FLOAT32_C(   441.69), SIMDE_FLOAT32_C(   708.35), SIMDE_FLOAT32_C(  -872.27),
+        SIMDE_FLOAT32_C(   819.24), SIMDE_FLOAT32_C(   982.33), SIMDE_FLOAT32_C(   585.56), SIMDE_FLOAT32_C(  -729.20) },
+      SIMDE_FLOAT32_C(      982.33) },
+    { { SIMDE_FLOAT32_C(   319.00), SIMDE_FLOAT32_C(  -227.46), SIMDE_FLOAT32_C(  -202.92), SIMDE_FLOAT32_C(  -914.38),
+        SIMDE_FLOAT32_C(   512.53), SIMDE_FLOAT32_C(  -998.23), SIMDE_FLOAT32_C(   -40.56), SIMDE_FLOAT32_C(  -781.55),
+        SIMDE_FLOAT32_C(   452.91), SIMDE_FLOAT32_C(   216.76), SIMDE_FLOAT32_C(  -794.08), SIMDE_FLOAT32_C(   180.34),
+        SIMDE_FLOAT32_C(  -695.23), SIMDE_FLOAT32_C(   231.43), SIMDE_FLOAT32_C(  -968.63), SIMDE_FLOAT32_C(   471.23) },
+      SIMDE_FLOAT32_C(      512.53) },
+    { { SIMDE_FLOAT32_C(  -459.01), SIMDE_FLOAT32_C(  -574.74), SIMDE_FLOAT32_C(  -783.69), SIMDE_FLOAT32_C(  -692.68),
+        SIMDE_FLOAT32_C(   716.30), SIMDE_FLOAT32_C(  -410.83), SIMDE_FLOAT32_C(  -796.36), SIMDE_FLOAT32_C(   380.13),
+        SIMDE_FLOAT32_C(  -396.82), SIMDE_FLOAT32_C(  -666.86), SIMDE_FLOAT32_C(    51.82), SIMDE_FLOAT32_C(  -933.26),
+        SIMDE_FLOAT32_C(   768.48), SIMDE_FLOAT32_C(   139.57), SIMDE_FLOAT32_C(  -126.75), SIMDE_FLOAT32_C(  -659.82) },
+      SIMDE_FLOAT32_C(      768.48) },
+    { { SIMDE_FLOAT32_C(    44.24), SIMDE_FLOAT32_C(   -98.29), SIMDE_FLOAT32_C(  -487.61), SIMDE_FLOAT32_C(  -334.37),
+        SIMDE_FLOAT32_C(  -682.36), SIMDE_FLOAT32_C(  -365.45), SIMDE_FLOAT32_C(  -722.87), SIMDE_FLOAT32_C(  -707.68),
+        SIMDE_FLOAT32_C(   784.54), SIMDE_FLOAT32_C(  -557.78), SIMDE_FLOAT32_C(   877.69), SIMDE_FLOAT32_C(  -681.62),
+        SIMDE_FLOAT32_C(   114.61), SIMDE_FLOAT32_C(   750.01), SIMDE_FLOAT32_C(   720.38), SIMDE_FLOAT32_C(  -955.17) },
+      SIMDE_FLOAT32_C(      877.69) },
+    { { SIMDE_FLOAT32_C(   499.47), SIMDE_FLOAT32_C(   778.15), SIMDE_FLOAT32_C(   197.79), SIMDE_FLOAT32_C(   455.67),
+        SIMDE_FLOAT32_C(   208.43), SIMDE_FLOAT32_C(  -676.53), SIMDE_FLOAT32_C(   416.76), SIMDE_FLOAT32_C(   805.83),
+        SIMDE_FLOAT32_C(   -40.67), SIMDE_FLOAT32_C(  -976.85), SIMDE_FLOAT32_C(  -127.36), SIMDE_FLOAT32_C(  -712.19),
+        SIMDE_FLOAT32_C(   682.50), SIMDE_FLOAT32_C(   -20.83), SIMDE_FLOAT32_C(  -189.94), SIMDE_FLOAT32_C(   588.07) },
+      SIMDE_FLOAT32_C(      805.83) },
+    { { SIMDE_FLOAT32_C(  -586.10), SIMDE_FLOAT32_C(  -547.62), SIMDE_FLOAT32_C(  -247.21), SIMDE_FLOAT32_C(  -606.88),
+        SIMDE_FLOAT32_C(   863.52), SIMDE_FLOAT32_C(  -902.23), SIMDE_FLOAT32_C(  -357.54), SIMDE_FLOAT32_C(   310.73),
+        SIMDE_FLOAT32_C(  -671.92), SIMDE_FLOAT32_C(   402.57), SIMDE_FLOAT32_C(  -103.10), SIMDE_FLOAT32_C(   439.83),
+        SIMDE_FLOAT32_C(  -389.28), SIMDE_FLOAT32_C(   912.83), SIMDE_FLOAT32_C(   204.92), SIMDE_FLOAT32_C(  -693.18) },
+      SIMDE_FLOAT32_C(      912.83) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_float32 r = simde_mm512_reduce_max_ps(a);
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_max_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r;
+  } test_vec[] = {
+    { UINT16_C(54652),
+      { SIMDE_FLOAT32_C(  -793.06), SIMDE_FLOAT32_C(   -16.63), SIMDE_FLOAT32_C(   -86.05), SIMDE_FLOAT32_C(   127.41),
+        SIMDE_FLOAT32_C(  -479.48), SIMDE_FLOAT32_C(  -856.06), SIMDE_FLOAT32_C(   612.70), SIMDE_FLOAT32_C(   807.17),
+        SIMDE_FLOAT32_C(  -228.94), SIMDE_FLOAT32_C(   334.68), SIMDE_FLOAT32_C(   536.91), SIMDE_FLOAT32_C(   584.96),
+        SIMDE_FLOAT32_C(   763.65), SIMDE_FLOAT32_C(   291.15), SIMDE_FLOAT32_C(  -961.83), SIMDE_FLOAT32_C(   846.09) },
+      SIMDE_FLOAT32_C(      846.09) },
+    { UINT16_C(32585),
+      { SIMDE_FLOAT32_C(   -37.53), SIMDE_FLOAT32_C(   978.08), SIMDE_FLOAT32_C(  -621.45), SIMDE_FLOAT32_C(  -282.67),
+        SIMDE_FLOAT32_C(  -417.86), SIMDE_FLOAT32_C(   764.40), SIMDE_FLOAT32_C(   472.68), SIMDE_FLOAT32_C(   900.37),
+        SIMDE_FLOAT32_C(   281.89), SIMDE_FLOAT32_C(  -539.37), SIMDE_FLOAT32_C(   683.19), SIMDE_FLOAT32_C(   693.71),
+        SIMDE_FLOAT32_C(  -553.76), SIMDE_FLOAT32_C(   991.69), SIMDE_FLOAT32_C(   555.34), SIMDE_FLOAT32_C(   207.37) },
+      SIMDE_FLOAT32_C(      991.69) },
+    { UINT16_C(33405),
+      { SIMDE_FLOAT32_C(  -850.31), SIMDE_FLOAT32_C(   -82.27), SIMDE_FLOAT32_C(   464.63), SIMDE_FLOAT32_C(   432.64),
+        SIMDE_FLOAT32_C(  -959.20), SIMDE_FLOAT32_C(   272.98), SIMDE_FLOAT32_C(   115.31), SIMDE_FLOAT32_C(   148.17),
+        SIMDE_FLOAT32_C(   338.91), SIMDE_FLOAT32_C(  -364.63), SIMDE_FLOAT32_C(  -338.64), SIMDE_FLOAT32_C(   885.64),
+        SIMDE_FLOAT32_C(  -884.16), SIMDE_FLOAT32_C(  -713.12), SIMDE_FLOAT32_C(  -806.86), SIMDE_FLOAT32_C(  -459.76) },
+      SIMDE_FLOAT32_C(      464.63) },
+    { UINT16_C(18391),
+      { SIMDE_FLOAT32_C(   901.04), SIMDE_FLOAT32_C(  -869.11), SIMDE_FLOAT32_C(   628.96), SIMDE_FLOAT32_C(  -509.27),
+        SIMDE_FLOAT32_C(   300.25), SIMDE_FLOAT32_C(  -333.95), SIMDE_FLOAT32_C(   927.64), SIMDE_FLOAT32_C(   373.47),
+        SIMDE_FLOAT32_C(  -968.63), SIMDE_FLOAT32_C(   794.23), SIMDE_FLOAT32_C(   199.07), SIMDE_FLOAT32_C(  -821.20),
+        SIMDE_FLOAT32_C(   -55.08), SIMDE_FLOAT32_C(  -131.37), SIMDE_FLOAT32_C(  -201.58), SIMDE_FLOAT32_C(  -230.15) },
+      SIMDE_FLOAT32_C(      927.64) },
+    { UINT16_C(24370),
+      { SIMDE_FLOAT32_C(   833.72), SIMDE_FLOAT32_C(  -553.38), SIMDE_FLOAT32_C(   -29.07), SIMDE_FLOAT32_C(  -141.76),
+        SIMDE_FLOAT32_C(  -523.75), SIMDE_FLOAT32_C(    23.95), SIMDE_FLOAT32_C(   678.67), SIMDE_FLOAT32_C(  -893.28),
+        SIMDE_FLOAT32_C(   237.22), SIMDE_FLOAT32_C(  -947.93), SIMDE_FLOAT32_C(   840.74), SIMDE_FLOAT32_C(  -182.29),
+        SIMDE_FLOAT32_C(  -111.89), SIMDE_FLOAT32_C(  -129.94), SIMDE_FLOAT32_C(    18.64), SIMDE_FLOAT32_C(  -593.66) },
+      SIMDE_FLOAT32_C(      840.74) },
+    { UINT16_C(17938),
+      { SIMDE_FLOAT32_C(   491.50), SIMDE_FLOAT32_C(  -539.38), SIMDE_FLOAT32_C(  -807.81), SIMDE_FLOAT32_C(  -474.84),
+        SIMDE_FLOAT32_C(   459.96), SIMDE_FLOAT32_C(  -387.48), SIMDE_FLOAT32_C(  -434.48), SIMDE_FLOAT32_C(   611.82),
+        SIMDE_FLOAT32_C(   700.82), SIMDE_FLOAT32_C(   -19.89), SIMDE_FLOAT32_C(  -969.94), SIMDE_FLOAT32_C(   360.63),
+        SIMDE_FLOAT32_C(   375.23), SIMDE_FLOAT32_C(  -116.84), SIMDE_FLOAT32_C(   407.76), SIMDE_FLOAT32_C(   800.97) },
+      SIMDE_FLOAT32_C(      459.96) },
+    { UINT16_C(23487),
+      { SIMDE_FLOAT32_C(   474.00), SIMDE_FLOAT32_C(  -890.59), SIMDE_FLOAT32_C(  -300.67), SIMDE_FLOAT32_C(  -665.05),
+        SIMDE_FLOAT32_C(   893.51), SIMDE_FLOAT32_C(   704.28), SIMDE_FLOAT32_C(   700.12), SIMDE_FLOAT32_C(   165.29),
+        SIMDE_FLOAT32_C(   288.33), SIMDE_FLOAT32_C(  -721.43), SIMDE_FLOAT32_C(   114.10), SIMDE_FLOAT32_C(   529.21),
+        SIMDE_FLOAT32_C(   499.23), SIMDE_FLOAT32_C(   972.19), SIMDE_FLOAT32_C(    38.14), SIMDE_FLOAT32_C(   189.88) },
+      SIMDE_FLOAT32_C(      893.51) },
+    { UINT16_C(45116),
+      { SIMDE_FLOAT32_C(   367.32), SIMDE_FLOAT32_C(   167.88), SIMDE_FLOAT32_C(   169.07), SIMDE_FLOAT32_C(   920.63),
+        SIMDE_FLOAT32_C(   853.25), SIMDE_FLOAT32_C(  -213.06), SIMDE_FLOAT32_C(   490.31), SIMDE_FLOAT32_C(   766.82),
+        SIMDE_FLOAT32_C(  -383.72), SIMDE_FLOAT32_C(   676.60), SIMDE_FLOAT32_C(   648.59), SIMDE_FLOAT32_C(   837.70),
+        SIMDE_FLOAT32_C(   883.61), SIMDE_FLOAT32_C(   470.70), SIMDE_FLOAT32_C(  -493.40), SIMDE_FLOAT32_C(   996.50) },
+      SIMDE_FLOAT32_C(      996.50) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_float32 r = simde_mm512_mask_reduce_max_ps(test_vec[i].k, a);
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_max_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[8];
+    const simde_float64 r;
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -860.59), SIMDE_FLOAT64_C(   930.15), SIMDE_FLOAT64_C(   132.44), SIMDE_FLOAT64_C(  -577.98),
+        SIMDE_FLOAT64_C(  -524.25), SIMDE_FLOAT64_C(  -583.51), SIMDE_FLOAT64_C(  -770.42), SIMDE_FLOAT64_C(   238.37) },
+      SIMDE_FLOAT64_C(      930.15) },
+    { { SIMDE_FLOAT64_C(  -967.90), SIMDE_FLOAT64_C(   451.81), SIMDE_FLOAT64_C(   532.21), SIMDE_FLOAT64_C(   720.94),
+        SIMDE_FLOAT64_C(   664.58), SIMDE_FLOAT64_C(   492.66), SIMDE_FLOAT64_C(    20.07), SIMDE_FLOAT64_C(  -813.53) },
+      SIMDE_FLOAT64_C(      720.94) },
+    { { SIMDE_FLOAT64_C(   639.95), SIMDE_FLOAT64_C(   455.80), SIMDE_FLOAT64_C(    71.99), SIMDE_FLOAT64_C(   830.97),
+        SIMDE_FLOAT64_C(   710.42), SIMDE_FLOAT64_C(  -328.25), SIMDE_FLOAT64_C(    71.98), SIMDE_FLOAT64_C(   805.59) },
+      SIMDE_FLOAT64_C(      830.97) },
+    { { SIMDE_FLOAT64_C(  -102.35), SIMDE_FLOAT64_C(   -98.55), SIMDE_FLOAT64_C(   493.37), SIMDE_FLOAT64_C(   439.42),
+        SIMDE_FLOAT64_C(   753.90), SIMDE_FLOAT64_C(  -435.35), SIMDE_FLOAT64_C(   103.78), SIMDE_FLOAT64_C(   778.40) },
+      SIMDE_FLOAT64_C(      778.40) },
+    { { SIMDE_FLOAT64_C(  -925.02), SIMDE_FLOAT64_C(  -417.66), SIMDE_FLOAT64_C(   944.43), SIMDE_FLOAT64_C(  -668.75),
+        SIMDE_FLOAT64_C(   999.05), SIMDE_FLOAT64_C(    61.86), SIMDE_FLOAT64_C(   185.03), SIMDE_FLOAT64_C(   156.42) },
+      SIMDE_FLOAT64_C(      999.05) },
+    { { SIMDE_FLOAT64_C(   388.95), SIMDE_FLOAT64_C(   343.85), SIMDE_FLOAT64_C(  -573.22), SIMDE_FLOAT64_C(  -215.61),
+        SIMDE_FLOAT64_C(   687.65), SIMDE_FLOAT64_C(   -39.66), SIMDE_FLOAT64_C(  -778.64), SIMDE_FLOAT64_C(   644.84) },
+      SIMDE_FLOAT64_C(      687.65) },
+    { { SIMDE_FLOAT64_C(   582.08), SIMDE_FLOAT64_C(  -682.34), SIMDE_FLOAT64_C(   184.82), SIMDE_FLOAT64_C(   994.02),
+        SIMDE_FLOAT64_C(  -719.70), SIMDE_FLOAT64_C(   279.46), SIMDE_FLOAT64_C(  -575.56), SIMDE_FLOAT64_C(   860.70) },
+      SIMDE_FLOAT64_C(      994.02) },
+    { { SIMDE_FLOAT64_C(   -91.83), SIMDE_FLOAT64_C(   157.81), SIMDE_FLOAT64_C(  -643.30), SIMDE_FLOAT64_C(   126.25),
+        SIMDE_FLOAT64_C(   861.03), SIMDE_FLOAT64_C(   996.42), SIMDE_FLOAT64_C(   625.47), SIMDE_FLOAT64_C(  -894.84) },
+      SIMDE_FLOAT64_C(      996.42) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_float64 r = simde_mm512_reduce_max_pd(a);
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_max_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r;
+  } test_vec[] = {
+    { UINT8_C( 19),
+      { SIMDE_FLOAT64_C(   868.63), SIMDE_FLOAT64_C(   363.93), SIMDE_FLOAT64_C(   295.57), SIMDE_FLOAT64_C(  -170.66),
+        SIMDE_FLOAT64_C(   894.84), SIMDE_FLOAT64_C(   -51.90), SIMDE_FLOAT64_C(    24.01), SIMDE_FLOAT64_C(  -698.42) },
+      SIMDE_FLOAT64_C(      894.84) },
+    { UINT8_C( 82),
+      { SIMDE_FLOAT64_C(   -33.96), SIMDE_FLOAT64_C(  -283.65), SIMDE_FLOAT64_C(   827.18), SIMDE_FLOAT64_C(  -854.00),
+        SIMDE_FLOAT64_C(  -155.61), SIMDE_FLOAT64_C(  -108.73), SIMDE_FLOAT64_C(     8.92), SIMDE_FLOAT64_C(   -87.98) },
+      SIMDE_FLOAT64_C(        8.92) },
+    { UINT8_C(177),
+      { SIMDE_FLOAT64_C(   805.22), SIMDE_FLOAT64_C(  -588.78), SIMDE_FLOAT64_C(   707.89), SIMDE_FLOAT64_C(  -929.81),
+        SIMDE_FLOAT64_C(   460.72), SIMDE_FLOAT64_C(  -358.24), SIMDE_FLOAT64_C(  -582.98), SIMDE_FLOAT64_C(  -986.47) },
+      SIMDE_FLOAT64_C(      805.22) },
+    { UINT8_C( 49),
+      { SIMDE_FLOAT64_C(   394.29), SIMDE_FLOAT64_C(  -922.84), SIMDE_FLOAT64_C(    -3.17), SIMDE_FLOAT64_C(  -467.60),
+        SIMDE_FLOAT64_C(  -668.30), SIMDE_FLOAT64_C(   662.03), SIMDE_FLOAT64_C(  -863.66), SIMDE_FLOAT64_C(   610.49) },
+      SIMDE_FLOAT64_C(      662.03) },
+    { UINT8_C( 32),
+      { SIMDE_FLOAT64_C(  -474.96), SIMDE_FLOAT64_C(  -912.50), SIMDE_FLOAT64_C(  -345.98), SIMDE_FLOAT64_C(   506.31),
+        SIMDE_FLOAT64_C(  -890.53), SIMDE_FLOAT64_C(   259.07), SIMDE_FLOAT64_C(   602.31), SIMDE_FLOAT64_C(  -577.99) },
+      SIMDE_FLOAT64_C(      259.07) },
+    { UINT8_C(131),
+      { SIMDE_FLOAT64_C(   370.36), SIMDE_FLOAT64_C(   609.13), SIMDE_FLOAT64_C(   558.51), SIMDE_FLOAT64_C(   195.92),
+        SIMDE_FLOAT64_C(  -304.78), SIMDE_FLOAT64_C(   251.32), SIMDE_FLOAT64_C(  -941.06), SIMDE_FLOAT64_C(  -185.71) },
+      SIMDE_FLOAT64_C(      609.13) },
+    { UINT8_C( 41),
+      { SIMDE_FLOAT64_C(  -551.35), SIMDE_FLOAT64_C(   293.70), SIMDE_FLOAT64_C(  -351.25), SIMDE_FLOAT64_C(   362.68),
+        SIMDE_FLOAT64_C(  -519.54), SIMDE_FLOAT64_C(  -849.49), SIMDE_FLOAT64_C(   557.38), SIMDE_FLOAT64_C(   568.05) },
+      SIMDE_FLOAT64_C(      362.68) },
+    { UINT8_C(184),
+      { SIMDE_FLOAT64_C(  -875.15), SIMDE_FLOAT64_C(  -480.93), SIMDE_FLOAT64_C(  -801.80), SIMDE_FLOAT64_C(   929.29),
+        SIMDE_FLOAT64_C(  -175.91), SIMDE_FLOAT64_C(   981.10), SIMDE_FLOAT64_C(  -184.44), SIMDE_FLOAT64_C(  -515.08) },
+      SIMDE_FLOAT64_C(      981.10) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_float64 r = simde_mm512_mask_reduce_max_pd(test_vec[i].k, a);
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_min_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { {  INT32_C(  1466586079), -INT32_C(   765751112), -INT32_C(  1136784999), -INT32_C(   765250614), -INT32_C(  1658304723), -INT32_C(  1021281053), -INT32_C(  2104400678), -INT32_C(  1737477997),
+        -INT32_C(  2059758542), -INT32_C(   483938918), -INT32_C(  1438923711), -INT32_C(   100367479), -INT32_C(   247641906), -INT32_C(   282410529), -INT32_C(   649657444),  INT32_C(  1819339419) },
+      -INT32_C(  2104400678) },
+    { {  INT32_C(  1550112149), -INT32_C(   139994754),  INT32_C(  1745422668),  INT32_C(  1024378974), -INT32_C(   883883442),  INT32_C(   123401162),  INT32_C(  2093741229), -INT32_C(   766318588),
+        -INT32_C(   102445868), -INT32_C(  1876643763),  INT32_C(  1358645869), -INT32_C(   222853191),  INT32_C(   765994742), -INT32_C(  1185805509),  INT32_C(  1075773933),  INT32_C(  1547625646) },
+      -INT32_C(  1876643763) },
+    { {  INT32_C(  1604379586),  INT32_C(   743772805),  INT32_C(   349813216),  INT32_C(   646214291),  INT32_C(  1525399222), -INT32_C(  1712257973),  INT32_C(  2030867587), -INT32_C(   291517078),
+         INT32_C(   771549296), -INT32_C(  1361900128), -INT32_C(   477117509),  INT32_C(  1312248572), -INT32_C(   443415719), -INT32_C(   192098017), -INT32_C(  1970770051),  INT32_C(   128909539) },
+      -INT32_C(  1970770051) },
+    { {  INT32_C(  1831190190), -INT32_C(  2115789229), -INT32_C(   325866065),  INT32_C(   914096436),  INT32_C(  1465529398), -INT32_C(   297579042),  INT32_C(  1098742981), -INT32_C(     4188292),
+         INT32_C(   208783442), -INT32_C(  1013612734), -INT32_C(   992099012), -INT32_C(   974212682),  INT32_C(  1599455573),  INT32_C(  1335861143), -INT32_C(  1010457240),  INT32_C(   599946274) },
+      -INT32_C(  2115789229) },
+    { { -INT32_C(  1449788486), -INT32_C(   648708403),  INT32_C(  1216464752),  INT32_C(   863181054),  INT32_C(  1481769295), -INT32_C(  1655630195), -INT32_C(   817907744),  INT32_C(  1051603087),
+        -INT32_C(   921522386),  INT32_C(  1546551792), -INT32_C(   588341005),  INT32_C(   805642610), -INT32_C(   933021776),  INT32_C(  2054561247), -INT32_C(  2064226780), -INT32_C(   479034392) },
+      -INT32_C(  2064226780) },
+    { { -INT32_C(    16373738), -INT32_C(  1476599354),  INT32_C(  1320790405),  INT32_C(   542251926), -INT32_C(   375088607),  INT32_C(   213875541), -INT32_C(   707497757),  INT32_C(   855343298),
+         INT32_C(   685770563), -INT32_C(   247302259), -INT32_C(   695685086),  INT32_C(  1955195330), -INT32_C(  1811887471),  INT32_C(  1556107076),  INT32_C(  1983291098), -INT32_C(   899152537) },
+      -INT32_C(  1811887471) },
+    { { -INT32_C(  1279659724), -INT32_C(  1222094890),  INT32_C(   238889673),  INT32_C(  1837810396),  INT32_C(    50913369), -INT32_C(   795883559), -INT32_C(  1744302570),  INT32_C(  1978489738),
+        -INT32_C(  1940184131),  INT32_C(  1988680378),  INT32_C(   404366735),  INT32_C(  1276809732),  INT32_C(  2015798816),  INT32_C(  1667457900), -INT32_C(   800784726), -INT32_C(  1667195433) },
+      -INT32_C(  1940184131) },
+    { {  INT32_C(  2005875390),  INT32_C(   628050763),  INT32_C(   597960477), -INT32_C(   869332973),  INT32_C(  1961964227), -INT32_C(  1027604378),  INT32_C(     8739302), -INT32_C(   112923947),
+         INT32_C(    39220800), -INT32_C(   429962580),  INT32_C(  1667686201), -INT32_C(    25232185), -INT32_C(   463875842), -INT32_C(   297493281),  INT32_C(  1399374374),  INT32_C(   603871778) },
+      -INT32_C(  1027604378) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_reduce_min_epi32(a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_min_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { UINT16_C(28182),
+      {  INT32_C(   693151050),  INT32_C(  1954682496), -INT32_C(  1687899475),  INT32_C(    37449864), -INT32_C(   165665687), -INT32_C(  1148559775), -INT32_C(   895683939),  INT32_C(   571919416),
+         INT32_C(  1361506208), -INT32_C(   650818945),  INT32_C(  1221353259),  INT32_C(   973434197),  INT32_C(   824087247), -INT32_C(   388629462), -INT32_C(   749068974),  INT32_C(  1677835752) },
+      -INT32_C(  1687899475) },
+    { UINT16_C(50323),
+      { -INT32_C(  1825899558), -INT32_C(   292349779), -INT32_C(   249186852),  INT32_C(  1518274999), -INT32_C(  1963492764),  INT32_C(  1750109584), -INT32_C(   267958133), -INT32_C(   930085670),
+        -INT32_C(   314748333),  INT32_C(  1402461239),  INT32_C(  1340022351),  INT32_C(  1680397235), -INT32_C(   485880108),  INT32_C(   436678601), -INT32_C(  1448217642),  INT32_C(  1553636785) },
+      -INT32_C(  1963492764) },
+    { UINT16_C(58570),
+      {  INT32_C(   221371267),  INT32_C(   331692276), -INT32_C(  1397223547),  INT32_C(  1571176154),  INT32_C(  2030535719), -INT32_C(   414293265), -INT32_C(  2137938454), -INT32_C(   150553567),
+        -INT32_C(  1695442663), -INT32_C(  1135141781), -INT32_C(   733755245),  INT32_C(  1167002562),  INT32_C(  1830069589), -INT32_C(   118261409), -INT32_C(  1540544403),  INT32_C(  1809369469) },
+      -INT32_C(  2137938454) },
+    { UINT16_C(34735),
+      {  INT32_C(  1322128736),  INT32_C(   837734730),  INT32_C(  1891638888),  INT32_C(   792921172),  INT32_C(  1441666908), -INT32_C(  1395680142),  INT32_C(  1483431882),  INT32_C(   169819125),
+        -INT32_C(   415278910),  INT32_C(  1809405683),  INT32_C(    45693086),  INT32_C(  1967107439), -INT32_C(   126260747),  INT32_C(  1948337766),  INT32_C(  1115708778), -INT32_C(   551598256) },
+      -INT32_C(  1395680142) },
+    { UINT16_C(44510),
+      { -INT32_C(   349153531), -INT32_C(  2117773589), -INT32_C(   532543866), -INT32_C(   507124981), -INT32_C(  1291466227),  INT32_C(  1105388249), -INT32_C(  1757761188),  INT32_C(  1022300990),
+        -INT32_C(  1073364328),  INT32_C(  1419538205), -INT32_C(   540331901), -INT32_C(   923998686),  INT32_C(   475854702),  INT32_C(   229922048),  INT32_C(  1196326314), -INT32_C(  1438069807) },
+      -INT32_C(  2117773589) },
+    { UINT16_C(36358),
+      {  INT32_C(  1674804890),  INT32_C(  1372995303),  INT32_C(  1133693786),  INT32_C(  1146386508),  INT32_C(   766723004), -INT32_C(   415675845),  INT32_C(   222090863),  INT32_C(   718853123),
+        -INT32_C(   957479573), -INT32_C(   351411295),  INT32_C(  1469788198),  INT32_C(  2087768006),  INT32_C(  1659969497),  INT32_C(  2126785446),  INT32_C(  1285917297),  INT32_C(    73039141) },
+      -INT32_C(   351411295) },
+    { UINT16_C( 8351),
+      {  INT32_C(    19679518),  INT32_C(    84383244), -INT32_C(   630613472),  INT32_C(   316129556), -INT32_C(  1710445674), -INT32_C(   639461567), -INT32_C(  1606245841), -INT32_C(   457618261),
+         INT32_C(    55735538), -INT32_C(  1302221669),  INT32_C(  1224288514), -INT32_C(   291316784),  INT32_C(   209545831),  INT32_C(   613804403), -INT32_C(  1739915679),  INT32_C(   330552285) },
+      -INT32_C(  1710445674) },
+    { UINT16_C(58170),
+      { -INT32_C(    22891908), -INT32_C(  1316165608),  INT32_C(   189200328), -INT32_C(  1940223961), -INT32_C(  1391799049), -INT32_C(  1085858658), -INT32_C(  1776061145), -INT32_C(   143877619),
+         INT32_C(  1108828281), -INT32_C(  1095339783),  INT32_C(   855114328),  INT32_C(   913204316), -INT32_C(  1036505196),  INT32_C(  1137916619), -INT32_C(  1136701826), -INT32_C(   912298142) },
+      -INT32_C(  1940223961) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_mask_reduce_min_epi32(test_vec[i].k, a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_min_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint32_t a[16];
+    const uint32_t r;
+  } test_vec[] = {
+    { { UINT32_C( 531005870), UINT32_C(2589353773), UINT32_C(3143147683), UINT32_C( 274094370), UINT32_C( 853867792), UINT32_C(1506308330), UINT32_C(3832322699), UINT32_C(1798275454),
+        UINT32_C( 835600892), UINT32_C(1593582207), UINT32_C(3572540923), UINT32_C(4180630128), UINT32_C(1674418372), UINT32_C(1990111989), UINT32_C(2854326992), UINT32_C(1721853429) },
+      UINT32_C( 274094370) },
+    { { UINT32_C(3025553930), UINT32_C(1372660766), UINT32_C(2350137814), UINT32_C(3716996309), UINT32_C(2462208044), UINT32_C( 242114444), UINT32_C(2255675443), UINT32_C(1168533811),
+        UINT32_C(3755149601), UINT32_C(2339161971), UINT32_C(1306501693), UINT32_C( 345584185), UINT32_C(3967921693), UINT32_C( 384993793), UINT32_C(1771556693), UINT32_C( 340497803) },
+      UINT32_C( 242114444) },
+    { { UINT32_C(1470559840), UINT32_C(3479184268), UINT32_C(3037823179), UINT32_C(3088511242), UINT32_C( 573300328), UINT32_C(3170702292), UINT32_C(1767677171), UINT32_C( 723745034),
+        UINT32_C(3598335352), UINT32_C(3975321346), UINT32_C(4231459500), UINT32_C(2562045001), UINT32_C( 748875105), UINT32_C(3961180411), UINT32_C(3663575962), UINT32_C( 657368685) },
+      UINT32_C( 573300328) },
+    { { UINT32_C(3842602401), UINT32_C(3594399498), UINT32_C(3427848660), UINT32_C( 455640439), UINT32_C(3672861117), UINT32_C(3908005934), UINT32_C( 914056526), UINT32_C(1047461892),
+        UINT32_C(1272667908), UINT32_C(2333059258), UINT32_C(3962755435), UINT32_C(  37979673), UINT32_C(3335497557), UINT32_C(2130136411), UINT32_C(1517327617), UINT32_C(3264681067) },
+      UINT32_C(  37979673) },
+    { { UINT32_C(1413134530), UINT32_C(1061338419), UINT32_C( 992416905), UINT32_C(1942313184), UINT32_C(1238035025), UINT32_C(1596181445), UINT32_C(1479793938), UINT32_C(1099349544),
+        UINT32_C(3754375508), UINT32_C(1053844006), UINT32_C(2687863650), UINT32_C(  76773620), UINT32_C(2505106181), UINT32_C(3710133123), UINT32_C(3857640196), UINT32_C(3680204754) },
+      UINT32_C(  76773620) },
+    { { UINT32_C(3912358422), UINT32_C(2543057954), UINT32_C(3849556826), UINT32_C( 802087676), UINT32_C(3187949625), UINT32_C(1235052281), UINT32_C(2120270452), UINT32_C(1459756784),
+        UINT32_C(3849299661), UINT32_C(1947560640), UINT32_C(1557524501), UINT32_C( 578354869), UINT32_C( 398787080), UINT32_C(2096302604), UINT32_C(3854167832), UINT32_C(4234566342) },
+      UINT32_C( 398787080) },
+    { { UINT32_C( 747378428), UINT32_C(1521299921), UINT32_C(3465166834), UINT32_C(4101805837), UINT32_C(2224426339), UINT32_C( 415373753), UINT32_C(3839284170), UINT32_C( 386452717),
+        UINT32_C( 987776564), UINT32_C(2972879800), UINT32_C(1624965295), UINT32_C(2752740718), UINT32_C(1610727444), UINT32_C( 127616660), UINT32_C( 967136537), UINT32_C(2546366963) },
+      UINT32_C( 127616660) },
+    { { UINT32_C(3257010707), UINT32_C( 568896199), UINT32_C(1753033298), UINT32_C(1705051270), UINT32_C(1235592975), UINT32_C(4022128513), UINT32_C( 605845086), UINT32_C( 132520242),
+        UINT32_C(3158956416), UINT32_C(1678846515), UINT32_C(3634095271), UINT32_C(1008409262), UINT32_C(2244364059), UINT32_C(2836753749), UINT32_C(3743986383), UINT32_C(3661082730) },
+      UINT32_C( 132520242) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(HEDLEY_REINTERPRET_CAST(const int32_t*, test_vec[i].a));
+    uint32_t r = simde_mm512_reduce_min_epu32(a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_min_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const uint32_t a[16];
+    const uint32_t r;
+  } test_vec[] = {
+    { UINT16_C(34186),
+      { UINT32_C(3295562241), UINT32_C( 949892821), UINT32_C(3225952248), UINT32_C(1639870919), UINT32_C(3071384804), UINT32_C(3997042397), UINT32_C(1536716176), UINT32_C( 403716427),
+        UINT32_C(2834639865), UINT32_C(3863814126), UINT32_C( 798604881), UINT32_C(3971561837), UINT32_C(1455272031), UINT32_C(2022259967), UINT32_C(3575968070), UINT32_C(4157745444) },
+      UINT32_C( 403716427) },
+    { UINT16_C(17526),
+      { UINT32_C(4092749694), UINT32_C(2718145584), UINT32_C(2956367624), UINT32_C(3059628070), UINT32_C( 873745878), UINT32_C(1632620749), UINT32_C(4231584812), UINT32_C(3512346260),
+        UINT32_C(3574708185), UINT32_C(2210480886), UINT32_C( 791592435), UINT32_C( 233962568), UINT32_C(1937509808), UINT32_C(2826541483), UINT32_C(1489657944), UINT32_C(2748899992) },
+      UINT32_C( 791592435) },
+    { UINT16_C(62813),
+      { UINT32_C(3913195511), UINT32_C(2191916808), UINT32_C(2530375414), UINT32_C( 847949723), UINT32_C(3820960772), UINT32_C(1120912252), UINT32_C(1780548602), UINT32_C(4231069565),
+        UINT32_C( 228516291), UINT32_C(1803930816), UINT32_C( 822867801), UINT32_C(2022774519), UINT32_C( 349137178), UINT32_C(1083175240), UINT32_C( 948944042), UINT32_C(1612892499) },
+      UINT32_C( 228516291) },
+    { UINT16_C(47105),
+      { UINT32_C(4028786993), UINT32_C(3510124963), UINT32_C(2642295264), UINT32_C(3251682707), UINT32_C( 933107752), UINT32_C(1900162584), UINT32_C(1147153476), UINT32_C(1028881692),
+        UINT32_C(1335434470), UINT32_C(2758006623), UINT32_C(2169972529), UINT32_C(1426351423), UINT32_C(3732587061), UINT32_C(2194807537), UINT32_C(1996956292), UINT32_C(3220377025) },
+      UINT32_C(1426351423) },
+    { UINT16_C(48026),
+      { UINT32_C(4019559021), UINT32_C(4032006681), UINT32_C(2089323341), UINT32_C(1460463899), UINT32_C(3114915337), UINT32_C(1906583525), UINT32_C(1801860842), UINT32_C( 720240647),
+        UINT32_C(1689599431), UINT32_C(2356397692), UINT32_C(2260025072), UINT32_C(1848895629), UINT32_C(2201750556), UINT32_C(3534942980), UINT32_C(  68147170), UINT32_C(3801379021) },
+      UINT32_C( 720240647) },
+    { UINT16_C(52076),
+      { UINT32_C(1762298362), UINT32_C(1016570473), UINT32_C(3616618349), UINT32_C(   1601091), UINT32_C(1869983327), UINT32_C(1519203011), UINT32_C( 165738598), UINT32_C(3605913622),
+        UINT32_C(3935764054), UINT32_C(2137163306), UINT32_C(  45386150), UINT32_C(2295154997), UINT32_C(1583759079), UINT32_C(   4041562), UINT32_C(1361331852), UINT32_C( 642002177) },
+      UINT32_C(   1601091) },
+    { UINT16_C(50459),
+      { UINT32_C(3816867921), UINT32_C(2961046913), UINT32_C(2376484410), UINT32_C(2844247094), UINT32_C(3521054270), UINT32_C(1377761202), UINT32_C(3796592349), UINT32_C(3710773072),
+        UINT32_C(1446537374), UINT32_C(2550398927), UINT32_C( 601222128), UINT32_C(3185097767), UINT32_C( 305587359), UINT32_C(2249477782), UINT32_C( 684655499), UINT32_C(3753320268) },
+      UINT32_C( 601222128) },
+    { UINT16_C( 8818),
+      { UINT32_C(1529182902), UINT32_C(2786942403), UINT32_C(1791915960), UINT32_C( 736036183), UINT32_C(1943604893), UINT32_C(1865333696), UINT32_C(1313347255), UINT32_C(2192821082),
+        UINT32_C(1723284044), UINT32_C( 680347448), UINT32_C(3087438774), UINT32_C(1921430289), UINT32_C(1405311543), UINT32_C(2826088771), UINT32_C(1248093409), UINT32_C(1470477416) },
+      UINT32_C( 680347448) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(HEDLEY_REINTERPRET_CAST(const int32_t*, test_vec[i].a));
+    uint32_t r = simde_mm512_mask_reduce_min_epu32(test_vec[i].k, a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_min_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { {  INT64_C( 9212551525108183242),  INT64_C(  133590187699543723), -INT64_C( 6979728804600657322), -INT64_C( 3422151052015603390),
+        -INT64_C( 7266251416227503328),  INT64_C( 2905424179032113766), -INT64_C(  204868121395196062),  INT64_C( 1327171313122113532) },
+      -INT64_C( 7266251416227503328) },
+    { { -INT64_C( 5007348971608691153), -INT64_C( 1084055451413154637), -INT64_C( 7061715176819172710), -INT64_C( 3101957422092659025),
+         INT64_C(  844081473085772482),  INT64_C( 9069381166503520871), -INT64_C( 1509349966661087885), -INT64_C( 1228243807157164119) },
+      -INT64_C( 7061715176819172710) },
+    { { -INT64_C( 4882938453523192138), -INT64_C(  747919669992782725),  INT64_C( 1462973779833446835),  INT64_C( 6828183769696809136),
+        -INT64_C( 3348813379108198447), -INT64_C( 8754901907147870242), -INT64_C( 2612921177739917567), -INT64_C( 8524223606650763185) },
+      -INT64_C( 8754901907147870242) },
+    { { -INT64_C( 6022285851587929604), -INT64_C( 2971691116041462321),  INT64_C( 3824571381997165108), -INT64_C( 5871624427753113984),
+         INT64_C( 6062681668447231853), -INT64_C( 3139087833912211565),  INT64_C( 4258202362802065500),  INT64_C(  358104494454427900) },
+      -INT64_C( 6022285851587929604) },
+    { {  INT64_C( 5553675394616146551),  INT64_C( 8445698078473822147),  INT64_C( 8198968425174355004), -INT64_C( 6330500972887699036),
+         INT64_C( 2050600089226116999),  INT64_C( 5823285827643807672), -INT64_C( 1850579263491214185),  INT64_C( 2250421681108614334) },
+      -INT64_C( 6330500972887699036) },
+    { {  INT64_C(  355771284417153634), -INT64_C( 1596989127988665610), -INT64_C(  458503979660510925),  INT64_C( 6937685066316849921),
+        -INT64_C( 9149842503911509753),  INT64_C(  386203032785058341),  INT64_C( 3914004748883491473), -INT64_C( 9067623115399088604) },
+      -INT64_C( 9149842503911509753) },
+    { { -INT64_C(  686884505874474714),  INT64_C( 3890765408132141844),  INT64_C( 5458593948820465202),  INT64_C( 8542145732464918142),
+        -INT64_C( 2811831532854804350),  INT64_C( 6812382321613931779),  INT64_C( 4180516305037935561), -INT64_C( 4228313009407060466) },
+      -INT64_C( 4228313009407060466) },
+    { {  INT64_C( 6957764209406947597),  INT64_C( 7049302476909581103),  INT64_C( 1942958266448202953),  INT64_C( 8823638231419307280),
+         INT64_C( 6341082498746686106), -INT64_C( 2423166414786428881), -INT64_C( 7277872611631459089),  INT64_C( 7642211590012607494) },
+      -INT64_C( 7277872611631459089) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_reduce_min_epi64(a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_min_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { UINT8_C(190),
+      { -INT64_C( 8369198226961710647), -INT64_C( 3775207852721492214),  INT64_C(   73206042140682196), -INT64_C( 9116684927044011877),
+        -INT64_C( 5739976034282915286),  INT64_C( 6345662092642283486), -INT64_C( 1352912147931599487),  INT64_C( 7471725300411457050) },
+      -INT64_C( 9116684927044011877) },
+    { UINT8_C( 38),
+      { -INT64_C( 3136024603559167524),  INT64_C(  349949163545329199), -INT64_C( 4357269048211196653),  INT64_C( 5784424505607795641),
+        -INT64_C( 4522083822249222242),  INT64_C( 5155835209189027489),  INT64_C( 5744668891487286588), -INT64_C( 3621191675101424042) },
+      -INT64_C( 4357269048211196653) },
+    { UINT8_C(122),
+      {  INT64_C( 8379168613586910228),  INT64_C(  271478315159478124), -INT64_C( 2793016052749590830),  INT64_C( 1372347126891258223),
+         INT64_C( 6849826272756095469),  INT64_C( 2865289154776106270),  INT64_C( 8013607647717452180),  INT64_C( 1378171698429072967) },
+       INT64_C(  271478315159478124) },
+    { UINT8_C(171),
+      {  INT64_C( 4352345992898947798),  INT64_C( 4653434601188684547),  INT64_C( 7626138838062131749), -INT64_C( 7778649969797774671),
+        -INT64_C( 3128354833072161420), -INT64_C( 3592589980269013362),  INT64_C( 5212064180141987107),  INT64_C( 6958815382623908041) },
+      -INT64_C( 7778649969797774671) },
+    { UINT8_C(104),
+      { -INT64_C( 8747811201318307356),  INT64_C( 2067545855950305943),  INT64_C( 2490737939837780002), -INT64_C( 6096155989019986526),
+        -INT64_C( 6760852081230548279),  INT64_C( 4151608162123380076), -INT64_C( 2011119139937133178), -INT64_C( 7770512919540964931) },
+      -INT64_C( 6096155989019986526) },
+    { UINT8_C( 62),
+      {  INT64_C( 7249103324159145558),  INT64_C( 8506917180696794170),  INT64_C( 8102829973464541586),  INT64_C( 3696692670017615553),
+         INT64_C( 8663750363626424300), -INT64_C( 6169438875962177949),  INT64_C( 8519409355032128175), -INT64_C( 3494530403766466118) },
+      -INT64_C( 6169438875962177949) },
+    { UINT8_C( 41),
+      {  INT64_C( 5949643956485278189), -INT64_C( 3245940409655515330), -INT64_C( 3659929642827291664), -INT64_C( 4430643249626797769),
+         INT64_C( 7714782894666973861),  INT64_C( 2746732197025238752),  INT64_C( 5307401627633013885), -INT64_C( 1595180843515829867) },
+      -INT64_C( 4430643249626797769) },
+    { UINT8_C(150),
+      {  INT64_C( 3570390349816265267), -INT64_C(  802513482492831481), -INT64_C( 7160715771175754763),  INT64_C( 1594342066864353010),
+         INT64_C( 6249142339293495471), -INT64_C( 1662376689262368274),  INT64_C( 5590320148283036349), -INT64_C( 3881773776590102312) },
+      -INT64_C( 7160715771175754763) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_mask_reduce_min_epi64(test_vec[i].k, a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_min_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint64_t a[8];
+    const uint64_t r;
+  } test_vec[] = {
+    { { UINT64_C(  522796891182865754), UINT64_C( 3468338663137955808), UINT64_C(17876936764790446463), UINT64_C(15491368634959646605),
+        UINT64_C( 3456517257309800274), UINT64_C(11809645182684838236), UINT64_C(13338997412451468334), UINT64_C(14900419956782170918) },
+      UINT64_C(  522796891182865754) },
+    { { UINT64_C(18316413124213959207), UINT64_C(14119574287155406131), UINT64_C(10801410362003771321), UINT64_C( 7397556689239894886),
+        UINT64_C( 3892865298867722288), UINT64_C(17501000434481265920), UINT64_C( 2165003104301568506), UINT64_C(18374587296600648153) },
+      UINT64_C( 2165003104301568506) },
+    { { UINT64_C( 7830690563140179600), UINT64_C(17481802165514600509), UINT64_C(16755484723416981885), UINT64_C( 9849945438267678719),
+        UINT64_C(11264640813491378432), UINT64_C(  166864913821733810), UINT64_C(14709057008348764949), UINT64_C( 5675633793418677347) },
+      UINT64_C(  166864913821733810) },
+    { { UINT64_C( 1422315392363104035), UINT64_C( 6239575604745769197), UINT64_C( 5744158866001439372), UINT64_C( 5373561192886227929),
+        UINT64_C( 4768398127746816062), UINT64_C(15165597278981238414), UINT64_C( 4216160027799081043), UINT64_C( 3259612393161388083) },
+      UINT64_C( 1422315392363104035) },
+    { { UINT64_C(16738010455050895243), UINT64_C( 6243741355428517684), UINT64_C(  697602332323720474), UINT64_C( 7924495937596222656),
+        UINT64_C(12869648371122649369), UINT64_C( 3653373042311674155), UINT64_C(16136402306964218009), UINT64_C(18263679830842715160) },
+      UINT64_C(  697602332323720474) },
+    { { UINT64_C( 4828204854280333686), UINT64_C(12860666418156982436), UINT64_C(10639948376105970693), UINT64_C( 2869611518706538909),
+        UINT64_C(16643135583215493230), UINT64_C(15678791805324003758), UINT64_C( 3093511235937135421), UINT64_C(16591541659044440235) },
+      UINT64_C( 2869611518706538909) },
+    { { UINT64_C( 3926192814720059327), UINT64_C(15327160061989527920), UINT64_C( 7881961419576319026), UINT64_C(12451724276117867658),
+        UINT64_C( 3882330071867282451), UINT64_C(  164939229817921147), UINT64_C( 9453750828531811591), UINT64_C( 5158423243909580749) },
+      UINT64_C(  164939229817921147) },
+    { { UINT64_C( 8437541211821438414), UINT64_C(  627442792749329829), UINT64_C(16258987568955474750), UINT64_C(11802772222382990904),
+        UINT64_C( 8505991477637484788), UINT64_C( 4239903558573197269), UINT64_C(11291503225877923226), UINT64_C( 2241215910622584849) },
+      UINT64_C(  627442792749329829) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(HEDLEY_REINTERPRET_CAST(const int64_t*, test_vec[i].a));
+    uint64_t r = simde_mm512_reduce_min_epu64(a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_min_epu64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const uint64_t a[8];
+    const uint64_t r;
+  } test_vec[] = {
+    { UINT8_C(145),
+      { UINT64_C(12927813797936207402), UINT64_C( 6606651030282542982), UINT64_C(18300611274643166521), UINT64_C( 5065170764880282067),
+        UINT64_C(11511419805499838736), UINT64_C(  650484740957862066), UINT64_C( 4134004201316262339), UINT64_C(17688983055460690496) },
+      UINT64_C(11511419805499838736) },
+    { UINT8_C(148),
+      { UINT64_C( 5183811973610905837), UINT64_C(18405667970439825132), UINT64_C( 9053329364898827873), UINT64_C(  910860897540843197),
+        UINT64_C(14194230804360611760), UINT64_C(16956972910150946623), UINT64_C( 9421395457075106017), UINT64_C( 4506956438376950016) },
+      UINT64_C( 4506956438376950016) },
+    { UINT8_C( 82),
+      { UINT64_C(15924364415723290488), UINT64_C( 4514315673788251142), UINT64_C(12248492460509756798), UINT64_C( 4925568646633100548),
+        UINT64_C(15282190955874183214), UINT64_C(12569207782908592510), UINT64_C( 4479470406926905852), UINT64_C(11206072040941997983) },
+      UINT64_C( 4479470406926905852) },
+    { UINT8_C(192),
+      { UINT64_C( 8784770411245619059), UINT64_C( 3786978569336040253), UINT64_C(16041337024762564907), UINT64_C( 5172926871087541577),
+        UINT64_C( 8242576671429550803), UINT64_C(11381574682461914070), UINT64_C(16560900125068199889), UINT64_C(16645601832453308574) },
+      UINT64_C(16560900125068199889) },
+    { UINT8_C( 31),
+      { UINT64_C( 9509448579606086899), UINT64_C( 3677137737475055418), UINT64_C( 6803027737140925700), UINT64_C(15390619719681245230),
+        UINT64_C(14075736416516684206), UINT64_C(14553409890147438941), UINT64_C( 9546638203786439743), UINT64_C(  578076238437972391) },
+      UINT64_C( 3677137737475055418) },
+    { UINT8_C(148),
+      { UINT64_C(12080875975977526453), UINT64_C(  948650827979950140), UINT64_C(13206932586439296812), UINT64_C( 6221605221676151202),
+        UINT64_C(13307497796129499329), UINT64_C(13850156605029652432), UINT64_C(12665470082016593663), UINT64_C(10824917006224606898) },
+      UINT64_C(10824917006224606898) },
+    { UINT8_C(191),
+      { UINT64_C( 3833720724130474562), UINT64_C(18118839531045439894), UINT64_C(10974045647526880645), UINT64_C( 4795139775262925070),
+        UINT64_C(11519214211547065292), UINT64_C( 7249487476527747355), UINT64_C( 4281213913161621369), UINT64_C( 1520829523544329095) },
+      UINT64_C( 1520829523544329095) },
+    { UINT8_C(208),
+      { UINT64_C(14867344496779268449), UINT64_C(11057654271238123267), UINT64_C( 2934884394429020829), UINT64_C( 4663383220127003432),
+        UINT64_C( 4252102126225090254), UINT64_C(17836869962863394179), UINT64_C(13578955196449628216), UINT64_C( 3745213802275047544) },
+      UINT64_C( 3745213802275047544) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(HEDLEY_REINTERPRET_CAST(const int64_t*, test_vec[i].a));
+    uint64_t r = simde_mm512_mask_reduce_min_epu64(test_vec[i].k, a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_min_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[16];
+    const simde_float32 r;
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   470.70), SIMDE_FLOAT32_C(   855.21), SIMDE_FLOAT32_C(   604.48), SIMDE_FLOAT32_C(  -134.12),
+        SIMDE_FLOAT32_C(   648.53), SIMDE_FLOAT32_C(   752.18), SIMDE_FLOAT32_C(  -547.69), SIMDE_FLOAT32_C(    79.29),
+        SIMDE_FLOAT32_C(  -253.15), SIMDE_FLOAT32_C(  -888.60), SIMDE_FLOAT32_C(  -132.56), SIMDE_FLOAT32_C(   481.27),
+        SIMDE_FLOAT32_C(  -551.91), SIMDE_FLOAT32_C(   154.49), SIMDE_FLOAT32_C(   -35.55), SIMDE_FLOAT32_C(   866.47) },
+      SIMDE_FLOAT32_C(     -888.60) },
+    { { SIMDE_FLOAT32_C(    43.35), SIMDE_FLOAT32_C(  -160.27), SIMDE_FLOAT32_C(   109.70), SIMDE_FLOAT32_C(   482.89),
+        SIMDE_FLOAT32_C(   929.85), SIMDE_FLOAT32_C(   432.19), SIMDE_FLOAT32_C(   481.98), SIMDE_FLOAT32_C(   359.96),
+        SIMDE_FLOAT32_C(   906.23), SIMDE_FLOAT32_C(   213.41), SIMDE_FLOAT32_C(  -996.92), SIMDE_FLOAT32_C(   922.89),
+        SIMDE_FLOAT32_C(  -380.28), SIMDE_FLOAT32_C(  -392.05), SIMDE_FLOAT32_C(  -458.94), SIMDE_FLOAT32_C(  -224.95) },
+      SIMDE_FLOAT32_C(     -996.92) },
+    { { SIMDE_FLOAT32_C(  -192.57), SIMDE_FLOAT32_C(  -911.76), SIMDE_FLOAT32_C(   445.90), SIMDE_FLOAT32_C(  -787.69),
+        SIMDE_FLOAT32_C(  -716.17), SIMDE_FLOAT32_C(  -773.32), SIMDE_FLOAT32_C(    45.04), SIMDE_FLOAT32_C(   339.36),
+        SIMDE_FLOAT32_C(   -12.62), SIMDE_FLOAT32_C(  -396.33), SIMDE_FLOAT32_C(  -671.01), SIMDE_FLOAT32_C(  -446.00),
+        SIMDE_FLOAT32_C(   930.40), SIMDE_FLOAT32_C(  -374.56), SIMDE_FLOAT32_C(  -281.59), SIMDE_FLOAT32_C(   223.84) },
+      SIMDE_FLOAT32_C(     -911.76) },
+    { { SIMDE_FLOAT32_C(   194.04), SIMDE_FLOAT32_C(   891.74), SIMDE_FLOAT32_C(  -435.05), SIMDE_FLOAT32_C(   -83.26),
+        SIMDE_FLOAT32_C(    61.21), SIMDE_FLOAT32_C(   488.14), SIMDE_FLOAT32_C(  -202.70), SIMDE_FLOAT32_C(  -974.52),
+        SIMDE_FLOAT32_C(   795.64), SIMDE_FLOAT32_C(  -642.04), SIMDE_FLOAT32_C(   218.99), SIMDE_FLOAT32_C(   460.28),
+        SIMDE_FLOAT32_C(   281.99), SIMDE_FLOAT32_C(  -121.57), SIMDE_FLOAT32_C(   -72.89), SIMDE_FLOAT32_C(   -84.47) },
+      SIMDE_FLOAT32_C(     -974.52) },
+    { { SIMDE_FLOAT32_C(  -193.39), SIMDE_FLOAT32_C(  -768.04), SIMDE_FLOAT32_C(  -536.03), SIMDE_FLOAT32_C(  -695.38),
+        SIMDE_FLOAT32_C(  -610.09), SIMDE_FLOAT32_C(   565.03), SIMDE_FLOAT32_C(   204.81), SIMDE_FLOAT32_C(   100.10),
+        SIMDE_FLOAT32_C(  -586.17), SIMDE_FLOAT32_C(  -282.74), SIMDE_FLOAT32_C(   172.47), SIMDE_FLOAT32_C(   233.54),
+        SIMDE_FLOAT32_C(  -728.77), SIMDE_FLOAT32_C(  -493.54), SIMDE_FLOAT32_C(  -892.01), SIMDE_FLOAT32_C(  -927.33) },
+      SIMDE_FLOAT32_C(     -927.33) },
+    { { SIMDE_FLOAT32_C(  -116.54), SIMDE_FLOAT32_C(  -707.20), SIMDE_FLOAT32_C(  -217.52), SIMDE_FLOAT32_C(   237.23),
+        SIMDE_FLOAT32_C(  -303.12), SIMDE_FLOAT32_C(   914.70), SIMDE_FLOAT32_C(   915.62), SIMDE_FLOAT32_C(   488.53),
+        SIMDE_FLOAT32_C(   727.73), SIMDE_FLOAT32_C(  -976.22), SIMDE_FLOAT32_C(   577.25), SIMDE_FLOAT32_C(    -6.63),
+        SIMDE_FLOAT32_C(   187.83), SIMDE_FLOAT32_C(  -845.85), SIMDE_FLOAT32_C(   604.83), SIMDE_FLOAT32_C(   -77.22) },
+      SIMDE_FLOAT32_C(     -976.22) },
+    { { SIMDE_FLOAT32_C(   111.50), SIMDE_FLOAT32_C(  -884.52), SIMDE_FLOAT32_C(  -145.97), SIMDE_FLOAT32_C(   515.53),
+        SIMDE_FLOAT32_C(   875.73), SIMDE_FLOAT32_C(  -689.20), SIMDE_FLOAT32_C(  -881.12), SIMDE_FLOAT32_C(  -493.16),
+        SIMDE_FLOAT32_C(   451.45), SIMDE_FLOAT32_C(  -120.92), SIMDE_FLOAT32_C(   243.44), SIMDE_FLOAT32_C(   210.91),
+        SIMDE_FLOAT32_C(   715.54), SIMDE_FLOAT32_C(   729.31), SIMDE_FLOAT32_C(  -907.40), SIMDE_FLOAT32_C(   438.32) },
+      SIMDE_FLOAT32_C(     -907.40) },
+    { { SIMDE_FLOAT32_C(  -188.38), SIMDE_FLOAT32_C(   -23.78), SIMDE_FLOAT32_C(   932.52), SIMDE_FLOAT32_C(  -861.53),
+        SIMDE_FLOAT32_C(   629.67), SIMDE_FLOAT32_C(  -456.08), SIMDE_FLOAT32_C(   863.05), SIMDE_FLOAT32_C(  -786.53),
+        SIMDE_FLOAT32_C(  -841.11), SIMDE_FLOAT32_C(  -969.71), SIMDE_FLOAT32_C(  -318.87), SIMDE_FLOAT32_C(   388.70),
+        SIMDE_FLOAT32_C(   398.24), SIMDE_FLOAT32_C(  -906.17), SIMDE_FLOAT32_C(  -275.54), SIMDE_FLOAT32_C(  -835.07) },
+      SIMDE_FLOAT32_C(     -969.71) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_float32 r = simde_mm512_reduce_min_ps(a);
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_min_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r;
+  } test_vec[] = {
+    { UINT16_C( 5347),
+      { SIMDE_FLOAT32_C(  -389.34), SIMDE_FLOAT32_C(   629.82), SIMDE_FLOAT32_C(  -436.79), SIMDE_FLOAT32_C(  -290.08),
+        SIMDE_FLOAT32_C(   224.65), SIMDE_FLOAT32_C(   -92.62), SIMDE_FLOAT32_C(   892.25), SIMDE_FLOAT32_C(   285.60),
+        SIMDE_FLOAT32_C(   501.21), SIMDE_FLOAT32_C(  -271.03), SIMDE_FLOAT32_C(   346.25), SIMDE_FLOAT32_C(  -151.98),
+        SIMDE_FLOAT32_C(   -26.67), SIMDE_FLOAT32_C(   579.63), SIMDE_FLOAT32_C(  -981.82), SIMDE_FLOAT32_C(  -784.07) },
+      SIMDE_FLOAT32_C(     -389.34) },
+    { UINT16_C(33913),
+      { SIMDE_FLOAT32_C(   139.69), SIMDE_FLOAT32_C(   234.35), SIMDE_FLOAT32_C(  -223.32), SIMDE_FLOAT32_C(   357.64),
+        SIMDE_FLOAT32_C(   842.13), SIMDE_FLOAT32_C(  -924.42), SIMDE_FLOAT32_C(  -935.48), SIMDE_FLOAT32_C(   180.35),
+        SIMDE_FLOAT32_C(   428.87), SIMDE_FLOAT32_C(  -144.20), SIMDE_FLOAT32_C(  -921.48), SIMDE_FLOAT32_C(  -699.30),
+        SIMDE_FLOAT32_C(  -137.81), SIMDE_FLOAT32_C(   997.35), SIMDE_FLOAT32_C(  -918.47), SIMDE_FLOAT32_C(  -758.12) },
+      SIMDE_FLOAT32_C(     -935.48) },
+    { UINT16_C(18008),
+      { SIMDE_FLOAT32_C(   117.64), SIMDE_FLOAT32_C(  -797.79), SIMDE_FLOAT32_C(   926.30), SIMDE_FLOAT32_C(   438.34),
+        SIMDE_FLOAT32_C(  -973.02), SIMDE_FLOAT32_C(  -566.15), SIMDE_FLOAT32_C(  -229.79), SIMDE_FLOAT32_C(  -764.25),
+        SIMDE_FLOAT32_C(   161.74), SIMDE_FLOAT32_C(  -824.56), SIMDE_FLOAT32_C(  -334.99), SIMDE_FLOAT32_C(  -381.96),
+        SIMDE_FLOAT32_C(   473.54), SIMDE_FLOAT32_C(   512.93), SIMDE_FLOAT32_C(  -756.59), SIMDE_FLOAT32_C(  -170.42) },
+      SIMDE_FLOAT32_C(     -973.02) },
+    { UINT16_C(38525),
+      { SIMDE_FLOAT32_C(   854.25), SIMDE_FLOAT32_C(   670.13), SIMDE_FLOAT32_C(   463.29), SIMDE_FLOAT32_C(  -267.50),
+        SIMDE_FLOAT32_C(  -856.65), SIMDE_FLOAT32_C(  -396.39), SIMDE_FLOAT32_C(   292.37), SIMDE_FLOAT32_C(  -164.55),
+        SIMDE_FLOAT32_C(  -145.77), SIMDE_FLOAT32_C(  -271.66), SIMDE_FLOAT32_C(   147.88), SIMDE_FLOAT32_C(   -64.68),
+        SIMDE_FLOAT32_C(  -601.44), SIMDE_FLOAT32_C(   992.29), SIMDE_FLOAT32_C(    77.01), SIMDE_FLOAT32_C(   933.12) },
+      SIMDE_FLOAT32_C(     -856.65) },
+    { UINT16_C( 4178),
+      { SIMDE_FLOAT32_C(   206.90), SIMDE_FLOAT32_C(   304.47), SIMDE_FLOAT32_C(   673.74), SIMDE_FLOAT32_C(  -675.18),
+        SIMDE_FLOAT32_C(  -571.18), SIMDE_FLOAT32_C(   838.53), SIMDE_FLOAT32_C(   705.46), SIMDE_FLOAT32_C(   215.66),
+        SIMDE_FLOAT32_C(   362.72), SIMDE_FLOAT32_C(   635.55), SIMDE_FLOAT32_C(  -842.02), SIMDE_FLOAT32_C(  -551.17),
+        SIMDE_FLOAT32_C(   857.81), SIMDE_FLOAT32_C(  -762.64), SIMDE_FLOAT32_C(   171.54), SIMDE_FLOAT32_C(    29.08) },
+      SIMDE_FLOAT32_C(     -571.18) },
+    { UINT16_C(57220),
+      { SIMDE_FLOAT32_C(  -589.81), SIMDE_FLOAT32_C(  -467.11), SIMDE_FLOAT32_C(   582.27), SIMDE_FLOAT32_C(   -56.91),
+        SIMDE_FLOAT32_C(  -829.61), SIMDE_FLOAT32_C(  -282.24), SIMDE_FLOAT32_C(  -240.61), SIMDE_FLOAT32_C(   840.38),
+        SIMDE_FLOAT32_C(   674.14), SIMDE_FLOAT32_C(   957.47), SIMDE_FLOAT32_C(   491.90), SIMDE_FLOAT32_C(   629.14),
+        SIMDE_FLOAT32_C(   999.17), SIMDE_FLOAT32_C(   193.55), SIMDE_FLOAT32_C(   267.91), SIMDE_FLOAT32_C(   220.33) },
+      SIMDE_FLOAT32_C(      220.33) },
+    { UINT16_C(26897),
+      { SIMDE_FLOAT32_C(   418.91), SIMDE_FLOAT32_C(   510.24), SIMDE_FLOAT32_C(    88.71), SIMDE_FLOAT32_C(   492.34),
+        SIMDE_FLOAT32_C(   596.44), SIMDE_FLOAT32_C(  -725.65), SIMDE_FLOAT32_C(  -277.02), SIMDE_FLOAT32_C(   108.42),
+        SIMDE_FLOAT32_C(   225.42), SIMDE_FLOAT32_C(  -392.06), SIMDE_FLOAT32_C(    54.75), SIMDE_FLOAT32_C(    76.45),
+        SIMDE_FLOAT32_C(   822.37), SIMDE_FLOAT32_C(   789.81), SIMDE_FLOAT32_C(  -460.64), SIMDE_FLOAT32_C(   377.22) },
+      SIMDE_FLOAT32_C(     -460.64) },
+    { UINT16_C(49067),
+      { SIMDE_FLOAT32_C(  -848.76), SIMDE_FLOAT32_C(   827.56), SIMDE_FLOAT32_C(   291.12), SIMDE_FLOAT32_C(   554.41),
+        SIMDE_FLOAT32_C(    87.58), SIMDE_FLOAT32_C(   474.60), SIMDE_FLOAT32_C(   469.30), SIMDE_FLOAT32_C(   392.27),
+        SIMDE_FLOAT32_C(   174.30), SIMDE_FLOAT32_C(  -227.52), SIMDE_FLOAT32_C(   887.61), SIMDE_FLOAT32_C(  -769.47),
+        SIMDE_FLOAT32_C(   734.81), SIMDE_FLOAT32_C(  -485.92), SIMDE_FLOAT32_C(  -766.89), SIMDE_FLOAT32_C(   -15.75) },
+      SIMDE_FLOAT32_C(     -848.76) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_float32 r = simde_mm512_mask_reduce_min_ps(test_vec[i].k, a);
+    simde_assert_equal_f32(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_min_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[8];
+    const simde_float64 r;
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  -281.01), SIMDE_FLOAT64_C(    25.05), SIMDE_FLOAT64_C(  -767.44), SIMDE_FLOAT64_C(  -162.63),
+        SIMDE_FLOAT64_C(   183.03), SIMDE_FLOAT64_C(   511.68), SIMDE_FLOAT64_C(   122.41), SIMDE_FLOAT64_C(   527.90) },
+      SIMDE_FLOAT64_C(     -767.44) },
+    { { SIMDE_FLOAT64_C(   554.66), SIMDE_FLOAT64_C(   -40.34), SIMDE_FLOAT64_C(  -829.66), SIMDE_FLOAT64_C(   871.74),
+        SIMDE_FLOAT64_C(  -235.85), SIMDE_FLOAT64_C(   658.07), SIMDE_FLOAT64_C(  -499.81), SIMDE_FLOAT64_C(  -731.21) },
+      SIMDE_FLOAT64_C(     -829.66) },
+    { { SIMDE_FLOAT64_C(   609.62), SIMDE_FLOAT64_C(    13.84), SIMDE_FLOAT64_C(   204.38), SIMDE_FLOAT64_C(   849.64),
+        SIMDE_FLOAT64_C(    53.83), SIMDE_FLOAT64_C(   985.79), SIMDE_FLOAT64_C(   188.18), SIMDE_FLOAT64_C(   150.89) },
+      SIMDE_FLOAT64_C(       13.84) },
+    { { SIMDE_FLOAT64_C(   633.86), SIMDE_FLOAT64_C(   420.64), SIMDE_FLOAT64_C(   169.66), SIMDE_FLOAT64_C(  -193.71),
+        SIMDE_FLOAT64_C(   822.32), SIMDE_FLOAT64_C(  -363.29), SIMDE_FLOAT64_C(    48.25), SIMDE_FLOAT64_C(   362.92) },
+      SIMDE_FLOAT64_C(     -363.29) },
+    { { SIMDE_FLOAT64_C(   315.42), SIMDE_FLOAT64_C(   -55.96), SIMDE_FLOAT64_C(   667.46), SIMDE_FLOAT64_C(  -872.48),
+        SIMDE_FLOAT64_C(   842.57), SIMDE_FLOAT64_C(   306.82), SIMDE_FLOAT64_C(  -217.38), SIMDE_FLOAT64_C(   387.36) },
+      SIMDE_FLOAT64_C(     -872.48) },
+    { { SIMDE_FLOAT64_C(  -497.40), SIMDE_FLOAT64_C(  -964.92), SIMDE_FLOAT64_C(   954.77), SIMDE_FLOAT64_C(   120.49),
+        SIMDE_FLOAT64_C(   970.54), SIMDE_FLOAT64_C(    27.22), SIMDE_FLOAT64_C(   873.73), SIMDE_FLOAT64_C(    62.69) },
+      SIMDE_FLOAT64_C(     -964.92) },
+    { { SIMDE_FLOAT64_C(  -616.73), SIMDE_FLOAT64_C(  -619.85), SIMDE_FLOAT64_C(  -738.85), SIMDE_FLOAT64_C(   382.93),
+        SIMDE_FLOAT64_C(  -823.97), SIMDE_FLOAT64_C(  -247.01), SIMDE_FLOAT64_C(  -702.78), SIMDE_FLOAT64_C(  -459.89) },
+      SIMDE_FLOAT64_C(     -823.97) },
+    { { SIMDE_FLOAT64_C(   704.32), SIMDE_FLOAT64_C(  -238.22), SIMDE_FLOAT64_C(   660.61), SIMDE_FLOAT64_C(  -423.39),
+        SIMDE_FLOAT64_C(  -869.04), SIMDE_FLOAT64_C(  -162.32), SIMDE_FLOAT64_C(  -160.70), SIMDE_FLOAT64_C(   612.77) },
+      SIMDE_FLOAT64_C(     -869.04) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_float64 r = simde_mm512_reduce_min_pd(a);
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_min_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r;
+  } test_vec[] = {
+    { UINT8_C(123),
+      { SIMDE_FLOAT64_C(  -353.41), SIMDE_FLOAT64_C(   497.53), SIMDE_FLOAT64_C(  -750.82), SIMDE_FLOAT64_C(    66.84),
+        SIMDE_FLOAT64_C(    61.19), SIMDE_FLOAT64_C(   381.34), SIMDE_FLOAT64_C(   -21.50), SIMDE_FLOAT64_C(    53.70) },
+      SIMDE_FLOAT64_C(     -353.41) },
+    { UINT8_C(219),
+      { SIMDE_FLOAT64_C(   901.96), SIMDE_FLOAT64_C(  -422.23), SIMDE_FLOAT64_C(  -582.42), SIMDE_FLOAT64_C(  -381.70),
+        SIMDE_FLOAT64_C(  -232.46), SIMDE_FLOAT64_C(  -248.66), SIMDE_FLOAT64_C(   335.56), SIMDE_FLOAT64_C(  -936.33) },
+      SIMDE_FLOAT64_C(     -936.33) },
+    { UINT8_C(121),
+      { SIMDE_FLOAT64_C(   182.89), SIMDE_FLOAT64_C(   264.75), SIMDE_FLOAT64_C(    13.13), SIMDE_FLOAT64_C(  -668.94),
+        SIMDE_FLOAT64_C(   218.23), SIMDE_FLOAT64_C(   599.07), SIMDE_FLOAT64_C(  -326.83), SIMDE_FLOAT64_C(  -211.95) },
+      SIMDE_FLOAT64_C(     -668.94) },
+    { UINT8_C( 99),
+      { SIMDE_FLOAT64_C(   870.31), SIMDE_FLOAT64_C(   679.45), SIMDE_FLOAT64_C(   317.96), SIMDE_FLOAT64_C(  -558.38),
+        SIMDE_FLOAT64_C(  -254.04), SIMDE_FLOAT64_C(  -740.73), SIMDE_FLOAT64_C(  -642.41), SIMDE_FLOAT64_C(  -809.29) },
+      SIMDE_FLOAT64_C(     -740.73) },
+    { UINT8_C( 34),
+      { SIMDE_FLOAT64_C(   -13.26), SIMDE_FLOAT64_C(   627.78), SIMDE_FLOAT64_C(  -999.25), SIMDE_FLOAT64_C(  -961.03),
+        SIMDE_FLOAT64_C(   977.39), SIMDE_FLOAT64_C(  -419.07), SIMDE_FLOAT64_C(  -916.05), SIMDE_FLOAT64_C(  -243.57) },
+      SIMDE_FLOAT64_C(     -419.07) },
+    { UINT8_C( 46),
+      { SIMDE_FLOAT64_C(  -718.10), SIMDE_FLOAT64_C(  -704.66), SIMDE_FLOAT64_C(  -545.26), SIMDE_FLOAT64_C(  -639.54),
+        SIMDE_FLOAT64_C(   216.74), SIMDE_FLOAT64_C(  -719.10), SIMDE_FLOAT64_C(   406.41), SIMDE_FLOAT64_C(  -467.25) },
+      SIMDE_FLOAT64_C(     -719.10) },
+    { UINT8_C(189),
+      { SIMDE_FLOAT64_C(   -94.52), SIMDE_FLOAT64_C(  -712.95), SIMDE_FLOAT64_C(   520.10), SIMDE_FLOAT64_C(  -885.89),
+        SIMDE_FLOAT64_C(  -522.22), SIMDE_FLOAT64_C(   911.64), SIMDE_FLOAT64_C(   296.91), SIMDE_FLOAT64_C(  -368.67) },
+      SIMDE_FLOAT64_C(     -885.89) },
+    { UINT8_C( 77),
+      { SIMDE_FLOAT64_C(  -770.71), SIMDE_FLOAT64_C(   596.13), SIMDE_FLOAT64_C(    24.32), SIMDE_FLOAT64_C(  -113.55),
+        SIMDE_FLOAT64_C(   203.62), SIMDE_FLOAT64_C(   783.87), SIMDE_FLOAT64_C(   -66.71), SIMDE_FLOAT64_C(   133.92) },
+      SIMDE_FLOAT64_C(     -770.71) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_float64 r = simde_mm512_mask_reduce_min_pd(test_vec[i].k, a);
+    simde_assert_equal_f64(r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_and_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { { -INT32_C(      165185), -INT32_C(    69206081), -INT32_C(       16389), -INT32_C(    33562883),  INT32_C(  1995962367), -INT32_C(     8683585), -INT32_C(    16853265), -INT32_C(        4233),
+        -INT32_C(  1073745921), -INT32_C(  1074954241), -INT32_C(   402653193), -INT32_C(   352329987), -INT32_C(        8321), -INT32_C(       16389), -INT32_C(      131081), -INT32_C(   184549889) },
+       INT32_C(   541065249) },
+    { { -INT32_C(   571738161), -INT32_C(    38010881), -INT32_C(       32898), -INT32_C(    67108865), -INT32_C(      690306), -INT32_C(     2097153), -INT32_C(  1073742470), -INT32_C(   541098247),
+        -INT32_C(  1074286980), -INT32_C(  1207960585), -INT32_C(    33554433), -INT32_C(   536936449), -INT32_C(    67239937), -INT32_C(   541199389), -INT32_C(   134225921), -INT32_C(         773) },
+      -INT32_C(  1853882304) },
+    { {  INT32_C(  2004877311), -INT32_C(     4460545), -INT32_C(   536870913),  INT32_C(  2103431167), -INT32_C(    18940163), -INT32_C(  1610612737), -INT32_C(        4129), -INT32_C(         257),
+        -INT32_C(    19144961), -INT32_C(       66561), -INT32_C(   268443714), -INT32_C(   135136257), -INT32_C(    10617089), -INT32_C(   268439585),  INT32_C(  1610612695), -INT32_C(    16810001) },
+       INT32_C(    68176516) },
+    { { -INT32_C(       16385), -INT32_C(  1342177281), -INT32_C(     2363393), -INT32_C(   167903297), -INT32_C(    39338627),  INT32_C(  2130444287),  INT32_C(  2147467263), -INT32_C(  1612713993),
+        -INT32_C(  1375780865), -INT32_C(    68222977), -INT32_C(  1074004229), -INT32_C(  1074135041), -INT32_C(    35782657), -INT32_C(     9502857), -INT32_C(    33685537), -INT32_C(    22020097) },
+       INT32_C(       11281) },
+    { { -INT32_C(        2577), -INT32_C(   138412162),  INT32_C(  1073725422),  INT32_C(  2008874943),  INT32_C(  2145385983), -INT32_C(      786433),  INT32_C(  1589639087), -INT32_C(    29360129),
+        -INT32_C(      134161), -INT32_C(      262403), -INT32_C(    69206533), -INT32_C(           1), -INT32_C(  1074069505), -INT32_C(     1098785), -INT32_C(   150994945),  INT32_C(  2147483647) },
+       INT32_C(   302002184) },
+    { { -INT32_C(          11), -INT32_C(      262161), -INT32_C(       32769), -INT32_C(     1114181), -INT32_C(   104894465), -INT32_C(   134873091), -INT32_C(     6332421), -INT32_C(   541591569),
+        -INT32_C(  1342504979),  INT32_C(  2147178463), -INT32_C(      526595), -INT32_C(   268517893), -INT32_C(    84148483), -INT32_C(      196611), -INT32_C(         642), -INT32_C(      278594) },
+       INT32_C(     8389632) },
+    { { -INT32_C(     1048585), -INT32_C(     4200723), -INT32_C(    71827973), -INT32_C(  1073741833), -INT32_C(   135529473), -INT32_C(   335552529), -INT32_C(  1096819721), -INT32_C(   276824581),
+        -INT32_C(   269484033),  INT32_C(  2012600827), -INT32_C(     1572886), -INT32_C(   268435457), -INT32_C(    33817089),  INT32_C(  2095054845), -INT32_C(    68157457), -INT32_C(  1077937225) },
+       INT32_C(   536985760) },
+    { {  INT32_C(  2113918446), -INT32_C(     2129921), -INT32_C(   679477317), -INT32_C(   269484291), -INT32_C(   134219794), -INT32_C(     5275649), -INT32_C(   150995209), -INT32_C(   135538737),
+        -INT32_C(   136577089), -INT32_C(   287835149), -INT32_C(          65), -INT32_C(   570695689), -INT32_C(  1610613527), -INT32_C(  1107886081), -INT32_C(     4194305), -INT32_C(  1083179073) },
+       INT32_C(    67260544) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_reduce_and_epi32(a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_and_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { UINT16_C(48940),
+      { -INT32_C(        8354), -INT32_C(     1052674), -INT32_C(           1), -INT32_C(    67895425), -INT32_C(       16417), -INT32_C(       35091), -INT32_C(     8650753), -INT32_C(      147457),
+        -INT32_C(   671088641), -INT32_C(      263169), -INT32_C(   268992593), -INT32_C(        1161), -INT32_C(   672272417), -INT32_C(  1109393411), -INT32_C(        2305),  INT32_C(  2147483391) },
+       INT32_C(    29450757) },
+    { UINT16_C(52122),
+      { -INT32_C(  1610743843), -INT32_C(           1), -INT32_C(   270551121), -INT32_C(    18874370), -INT32_C(   536903969), -INT32_C(   273711113), -INT32_C(       32803), -INT32_C(    25231377),
+        -INT32_C(       32769),  INT32_C(  2145386463),  INT32_C(  2087452671), -INT32_C(    67174917),  INT32_C(  1064828863), -INT32_C(    67239939), -INT32_C(       18945), -INT32_C(        8225) },
+       INT32_C(  1516115146) },
+    { UINT16_C(55265),
+      { -INT32_C(    16777985), -INT32_C(  1350975489), -INT32_C(   555748481), -INT32_C(   209723393), -INT32_C(  1212745729), -INT32_C(    50603017), -INT32_C(        8193), -INT32_C(      139523),
+        -INT32_C(     5259265), -INT32_C(  1619264134), -INT32_C(    18399233),  INT32_C(  2147483359), -INT32_C(    67108929),  INT32_C(  2147482043), -INT32_C(     9175045), -INT32_C(   605294593) },
+      -INT32_C(  1742665680) },
+    { UINT16_C(32039),
+      { -INT32_C(    17375491), -INT32_C(     3145793), -INT32_C(  1073741825), -INT32_C(  1619132673), -INT32_C(   268500993), -INT32_C(   553918849),  INT32_C(  1994848255), -INT32_C(   100664385),
+        -INT32_C(    54788097),  INT32_C(  2146697023), -INT32_C(     1048577), -INT32_C(     1115153), -INT32_C(         259), -INT32_C(      655877), -INT32_C(   142606869), -INT32_C(        9225) },
+      -INT32_C(  1811883991) },
+    { UINT16_C(64023),
+      { -INT32_C(       16385),  INT32_C(  1610610687),  INT32_C(  2070674421),  INT32_C(  2134899703),  INT32_C(  1067319295), -INT32_C(  1628439045),  INT32_C(  1591736827), -INT32_C(   570982403),
+        -INT32_C(       14625), -INT32_C(       65609), -INT32_C(  1077936145),  INT32_C(  2112880563), -INT32_C(     2097153), -INT32_C(      140313), -INT32_C(    67108993), -INT32_C(    67635217) },
+       INT32_C(   419468065) },
+    { UINT16_C(42442),
+      { -INT32_C(   411345155), -INT32_C(   603979777), -INT32_C(   621283345), -INT32_C(        1033), -INT32_C(    12845065), -INT32_C(  1208090625),  INT32_C(  1879048171), -INT32_C(   268960001),
+        -INT32_C(   268435457), -INT32_C(      524297), -INT32_C(    51904518), -INT32_C(    68209169), -INT32_C(    48284673), -INT32_C(  1208254467), -INT32_C(   403324929), -INT32_C(   268468227) },
+       INT32_C(    14908128) },
+    { UINT16_C(13611),
+      {  INT32_C(  1054863327), -INT32_C(    49807361), -INT32_C(   271581313),  INT32_C(  2108620799), -INT32_C(  1073750081), -INT32_C(   403964065), -INT32_C(   537469057), -INT32_C(  1375764481),
+        -INT32_C(     2359305), -INT32_C(  1719934977), -INT32_C(     4400129),  INT32_C(  1941569019),  INT32_C(  2147465151), -INT32_C(  1141015170), -INT32_C(         146), -INT32_C(   570688906) },
+       INT32_C(   536871190) },
+    { UINT16_C(47298),
+      { -INT32_C(    34082817), -INT32_C(    25233683), -INT32_C(       18462),  INT32_C(  2147483647), -INT32_C(   272629793), -INT32_C(   268959811),  INT32_C(  2147336191), -INT32_C(           1),
+        -INT32_C(   805569553),  INT32_C(  2138963838), -INT32_C(        2065), -INT32_C(   538968097), -INT32_C(     2114827), -INT32_C(   123225097), -INT32_C(     2162690), -INT32_C(   268435561) },
+       INT32_C(  1208267397) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_mask_reduce_and_epi32(test_vec[i].k, a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_and_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { { -INT64_C(   96827411316409345), -INT64_C(   18016816647407634), -INT64_C( 2308114600236711937),  INT64_C( 9187048570719563227),
+        -INT64_C(  576460752571858945),  INT64_C( 8065944647664402431), -INT64_C(       2757369528321), -INT64_C(  360993315489120257) },
+       INT64_C( 4766040169792037322) },
+    { { -INT64_C(     562962844631041), -INT64_C(        274877906946), -INT64_C( 4684376931301326849), -INT64_C(   36323741148431361),
+        -INT64_C(   20266202618183681), -INT64_C(    2885669877843211), -INT64_C( 4634485560260464931), -INT64_C(  869511396025500737) },
+      -INT64_C( 5610197416066405740) },
+    { { -INT64_C(   40533565422698503), -INT64_C(    9007199254741257), -INT64_C(     562967137812481), -INT64_C( 1152928138318053957),
+         INT64_C( 9223328055315921661), -INT64_C(   18106766109737987), -INT64_C(         85911928833), -INT64_C(      35287453929697) },
+       INT64_C( 8002193817116764177) },
+    { { -INT64_C(  171262130167742537),  INT64_C( 8052435549454991103), -INT64_C(  594545523858345986), -INT64_C(      37385874178115),
+        -INT64_C(  648518898244667393), -INT64_C(      17935934431233), -INT64_C(       9913128479253),  INT64_C( 9223336843854790399) },
+       INT64_C( 7250659199676089504) },
+    { { -INT64_C(  883532428445188099), -INT64_C(    1836459297473029), -INT64_C(   73747545624453289),  INT64_C( 6916823961514196927),
+        -INT64_C( 2315131958591489283),  INT64_C( 9078685094142541694), -INT64_C(      46180025237506), -INT64_C(             4235265) },
+       INT64_C( 5807392459480897552) },
+    { { -INT64_C(  166650779472495105), -INT64_C(  648518621487693953), -INT64_C(   22518552590286913), -INT64_C(   45053794903392513),
+        -INT64_C(   77159362892136713), -INT64_C( 2306476327953367041), -INT64_C( 1459746842882473985),  INT64_C( 6913025152062042071) },
+       INT64_C( 4615502434095442967) },
+    { { -INT64_C(  297237622655287297), -INT64_C(  288511954225005569), -INT64_C(    4787548514156545), -INT64_C(   72092779215323169),
+         INT64_C( 9222246128355278718), -INT64_C(  144115326689216513), -INT64_C(  577023736767742241), -INT64_C(      35184374267905) },
+       INT64_C( 8126989088744288862) },
+    { { -INT64_C(      35184407767105), -INT64_C(   18014467765829633), -INT64_C(  333547847403307009), -INT64_C( 2310349426347999752),
+        -INT64_C(   22517998409482241), -INT64_C(         53687615620), -INT64_C(  324259192498061345), -INT64_C( 3461016358731383365) },
+      -INT64_C( 3817120224176171752) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_reduce_and_epi64(a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_and_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { UINT8_C( 24),
+      { -INT64_C(           537088033), -INT64_C(  290487123834830849), -INT64_C(   11329367812636674),  INT64_C( 8934523627794071007),
+        -INT64_C( 3170851922299064322), -INT64_C(    4646674144759883),  INT64_C( 8070098654163107583), -INT64_C(     600917732786201) },
+       INT64_C( 6051937266018807262) },
+    { UINT8_C(221),
+      { -INT64_C(   36183318131638273), -INT64_C(     321057395311625), -INT64_C( 2668391575310041091), -INT64_C(   76562293713797286),
+         INT64_C( 9214364768863780863), -INT64_C(     580610928181249), -INT64_C( 2305844143085780993), -INT64_C(  288230381524623627) },
+       INT64_C( 6505293971834854992) },
+    { UINT8_C(248),
+      { -INT64_C( 2882303763731710101), -INT64_C( 1154232123004027139), -INT64_C(  297272812530304009), -INT64_C(     323874961231905),
+        -INT64_C( 2630805972905886729), -INT64_C(   36039792305115141),  INT64_C( 8646884858691289087), -INT64_C(     140737490463237) },
+       INT64_C( 6015755113733505491) },
+    { UINT8_C( 80),
+      { -INT64_C(  289498422698901634), -INT64_C( 4620979645025796609), -INT64_C(    9007199322374145), -INT64_C(   36125691619591169),
+        -INT64_C( 4899933991060644357), -INT64_C( 1155191034096123906), -INT64_C(   18014398526406689),  INT64_C( 9146529093317025662) },
+      -INT64_C( 4917948389587051045) },
+    { UINT8_C(246),
+      { -INT64_C( 2305851943014252545),  INT64_C( 9222246135869997054),  INT64_C( 9222729919782322175), -INT64_C(  594615888304672801),
+         INT64_C( 6683197810960498684), -INT64_C(     567365515345989), -INT64_C(  582662067140429841), -INT64_C(       2217717334146) },
+       INT64_C( 6100460956154132264) },
+    { UINT8_C( 88),
+      { -INT64_C( 1948440157535338497), -INT64_C(          2147532802), -INT64_C(  432345728514260993), -INT64_C(  364791569835884545),
+        -INT64_C(  576498685454590291), -INT64_C(   40823784407760897),  INT64_C( 4610557707970019315), -INT64_C(      35218732613891) },
+       INT64_C( 3669269651702800033) },
+    { UINT8_C(164),
+      { -INT64_C(   36028798092713985), -INT64_C(   19140298419547394), -INT64_C(   73570522039861249),  INT64_C( 6916385531236449144),
+         INT64_C( 2305842906134446079), -INT64_C(  585467955854229505), -INT64_C( 1152921594817945601), -INT64_C(   20266404616933925) },
+      -INT64_C(  679304882509959717) },
+    { UINT8_C(131),
+      { -INT64_C(  130639577860933633),  INT64_C( 8642125655879712767), -INT64_C(  630521540034691607), -INT64_C(  432424737655226369),
+        -INT64_C(  288230389057847309), -INT64_C(    4582764498649089), -INT64_C( 1736143446076330177), -INT64_C(    2392538241597457) },
+       INT64_C( 8513597143699519471) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_mask_reduce_and_epi64(test_vec[i].k, a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_or_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { { -INT32_C(  1845492479),  INT32_C(     2363524),  INT32_C(   277872738), -INT32_C(  1073479534), -INT32_C(  2147483136), -INT32_C(  2147450878),  INT32_C(   134217736),  INT32_C(  1107821056),
+         INT32_C(   675284994), -INT32_C(  2143285248),  INT32_C(         128),  INT32_C(    37879808),  INT32_C(           0),  INT32_C(   268435968),  INT32_C(    33554432),  INT32_C(  1342179328) },
+      -INT32_C(    83976193) },
+    { {  INT32_C(      147713),  INT32_C(  1076101120),  INT32_C(   201334912),  INT32_C(      133152),  INT32_C(   337641488),  INT32_C(     8389137),  INT32_C(  1346371656),  INT32_C(   805348354),
+         INT32_C(   135925760), -INT32_C(  1878835120),  INT32_C(     1049088),  INT32_C(   270640128),  INT32_C(   536870912),  INT32_C(     2097170),  INT32_C(   554248194),  INT32_C(   268476424) },
+      -INT32_C(    33554437) },
+    { {  INT32_C(    13377792),  INT32_C(   537165835),  INT32_C(    33988736),  INT32_C(   271073410),  INT32_C(      262276),  INT32_C(   540019716),  INT32_C(   878713088),  INT32_C(     8388738),
+         INT32_C(         264),  INT32_C(    36077576),  INT32_C(   303040512),  INT32_C(    35660416),  INT32_C(   402653188), -INT32_C(  2076179704),  INT32_C(    33554432), -INT32_C(  1071308736) },
+      -INT32_C(    16777265) },
+    { { -INT32_C(  1861500832),  INT32_C(    12746760),  INT32_C(    16781696),  INT32_C(           4),              INT32_MIN,  INT32_C(      296992),  INT32_C(  1074946060),  INT32_C(   335677440),
+         INT32_C(   201328000),  INT32_C(   135271424), -INT32_C(  1073741812), -INT32_C(  2147483072),  INT32_C(   134226056), -INT32_C(  2147444224),  INT32_C(   201328685),  INT32_C(    34210560) },
+      -INT32_C(   538968083) },
+    { {  INT32_C(   270532608),  INT32_C(        4112),  INT32_C(     2097220),  INT32_C(  1207968768),  INT32_C(   268435456), -INT32_C(  1542453176),  INT32_C(     4734976),  INT32_C(   135398416),
+         INT32_C(   168821264),  INT32_C(   134218770),  INT32_C(   268566536),  INT32_C(   612372496),  INT32_C(  1392582784),  INT32_C(           0),  INT32_C(           2),  INT32_C(   134234128) },
+      -INT32_C(      295202) },
+    { {  INT32_C(   134219776),  INT32_C(   571473922),  INT32_C(    20976641),  INT32_C(  1610632197),  INT32_C(   168305152),  INT32_C(   302122384),  INT32_C(     4194304),  INT32_C(   413405200),
+         INT32_C(     4461568),  INT32_C(     8392706),  INT32_C(  1140850688),  INT32_C(   151003268),  INT32_C(     2163761),  INT32_C(   138428424),  INT32_C(        4112),  INT32_C(   554172416) },
+       INT32_C(  2147450815) },
+    { {  INT32_C(   134217760),  INT32_C(       65696),  INT32_C(  1073741960),  INT32_C(   134234112),  INT32_C(   403177600),  INT32_C(      262184),  INT32_C(    16777248),  INT32_C(   136314992),
+         INT32_C(    50762112),  INT32_C(   404759680),  INT32_C(  1108084224),  INT32_C(     1048576), -INT32_C(  1606317820),  INT32_C(   134354944),  INT32_C(   152045570),  INT32_C(   134234432) },
+      -INT32_C(    75497474) },
+    { {  INT32_C(     2132480), -INT32_C(  2111569854),  INT32_C(    67115264), -INT32_C(  1879031680),  INT32_C(  1074790432),  INT32_C(  1075970072),  INT32_C(   134217872),  INT32_C(  1098917896),
+         INT32_C(    16828744),  INT32_C(       16416),  INT32_C(     4194336),  INT32_C(   671222016),  INT32_C(   540024841),  INT32_C(     8454154), -INT32_C(   802680768),  INT32_C(          64) },
+      -INT32_C(        1029) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_reduce_or_epi32(a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_or_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t r;
+  } test_vec[] = {
+    { UINT16_C( 9588),
+      { -INT32_C(  2130557424),  INT32_C(     8388610),  INT32_C(    73400384),  INT32_C(  1080295937), -INT32_C(  2146402304),  INT32_C(   268444160),  INT32_C(           0),  INT32_C(  1110222880),
+         INT32_C(           0), -INT32_C(  1040187376),  INT32_C(   171067392), -INT32_C(  2147217008),  INT32_C(    69214273),  INT32_C(     8389120), -INT32_C(  2076147706),  INT32_C(      204930) },
+      -INT32_C(  1628247488) },
+    { UINT16_C(22565),
+      {  INT32_C(          84),  INT32_C(    25169408),  INT32_C(        8192),  INT32_C(   268435502),  INT32_C(  1140998176),  INT32_C(   536883336),  INT32_C(     1638400),  INT32_C(    84938816),
+         INT32_C(    76087298),  INT32_C(     9437186),  INT32_C(   102768640),  INT32_C(     4232198),  INT32_C(   142606347),  INT32_C(     8732672),  INT32_C(  1090790032),  INT32_C(      270336) },
+       INT32_C(  1774499551) },
+    { UINT16_C(46437),
+      {  INT32_C(     4197445),  INT32_C(    12845057),  INT32_C(  1207966784),  INT32_C(  1073742192),  INT32_C(     3159617),  INT32_C(    84968448), -INT32_C(  2130697696),  INT32_C(           0),
+         INT32_C(     2433028),  INT32_C(   268566529),  INT32_C(    16810024),  INT32_C(    67174408),  INT32_C(    17892352),  INT32_C(   310378504),  INT32_C(   273683456),  INT32_C(     4259840) },
+      -INT32_C(   537543059) },
+    { UINT16_C(48047),
+      {  INT32_C(    35653640),  INT32_C(        2048), -INT32_C(  1073217024),  INT32_C(      270592),  INT32_C(   536870912),  INT32_C(    37781526),  INT32_C(   536887299),  INT32_C(   134225984),
+         INT32_C(      557056),  INT32_C(   536879105),  INT32_C(    18880521),  INT32_C(  1074006048), -INT32_C(  1073739516),  INT32_C(   268992560),  INT32_C(     2097160),  INT32_C(     1081612) },
+      -INT32_C(    92492929) },
+    { UINT16_C(50531),
+      { -INT32_C(  1072689151),  INT32_C(      475393),  INT32_C(   172228800),  INT32_C(  1155569028),  INT32_C(     2105616),  INT32_C(   554172672),  INT32_C(           0),  INT32_C(  1090519128),
+        -INT32_C(  2147352575),  INT32_C(     6291528),  INT32_C(     2097172),  INT32_C(          41),  INT32_C(        8206),  INT32_C(  1342210048),  INT32_C(  1124270080),  INT32_C(     4208648) },
+      -INT32_C(   478185187) },
+    { UINT16_C(53565),
+      {  INT32_C(     4203392),  INT32_C(    33570832),  INT32_C(    67436832),  INT32_C(   168067329),  INT32_C(          67),  INT32_C(   143261700),  INT32_C(   503318528),  INT32_C(    68157504),
+         INT32_C(   134220802), -INT32_C(  2147188736),  INT32_C(    16777216),  INT32_C(     1704704), -INT32_C(  2004877308), -INT32_C(  2145902576),  INT32_C(   570426432),  INT32_C(  1140981760) },
+      -INT32_C(   288378905) },
+    { UINT16_C( 4280),
+      {  INT32_C(       69776), -INT32_C(  1400600284),  INT32_C(      524288),  INT32_C(   335547392),  INT32_C(  1082131792),  INT32_C(    16785408),  INT32_C(     2097216),  INT32_C(    25165984),
+         INT32_C(      655360),  INT32_C(    37765124),  INT32_C(   335564804), -INT32_C(  1069285120),  INT32_C(     1585217),  INT32_C(   268444032),  INT32_C(     8405000),  INT32_C(        8288) },
+       INT32_C(  1436040689) },
+    { UINT16_C(37553),
+      { -INT32_C(  2146959344), -INT32_C(  1610276350),  INT32_C(   851189768),  INT32_C(     4457728),  INT32_C(    67895428),  INT32_C(     1048896),  INT32_C(    33587360),  INT32_C(       86016),
+         INT32_C(     9044034),  INT32_C(  1140858880),  INT32_C(   671351040), -INT32_C(  2121268718),  INT32_C(      266244), -INT32_C(  2143007708),  INT32_C(        1060), -INT32_C(  1828175872) },
+      -INT32_C(   685936172) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r = simde_mm512_mask_reduce_or_epi32(test_vec[i].k, a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_reduce_or_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { {  INT64_C(  585468501313978368),  INT64_C( 3458764651567775744), -INT64_C( 7741643501422386144),  INT64_C(   27866679958635048),
+         INT64_C( 2882374680021440513),  INT64_C( 1154189318824461328),  INT64_C(    9007199935267232),  INT64_C(   10133237137408192) },
+      -INT64_C( 4830134807948689415) },
+    { {  INT64_C(  145540189521972224),  INT64_C( 2307391139841450392),  INT64_C(  577025420428316684),  INT64_C( 1154048504564558336),
+        -INT64_C( 9217733174290808576), -INT64_C( 9079221664401584124),  INT64_C(  147520925342892032),  INT64_C( 4611848754746826762) },
+      -INT64_C(  423411351835689058) },
+    { {  INT64_C(   56294995342917632),  INT64_C( 4611846547394002949),  INT64_C( 4756364156725268481),  INT64_C(   72629345201424384),
+         INT64_C( 2305843009230742656),  INT64_C(  936824731607302178),  INT64_C(  477522918763405440), -INT64_C( 5188146770579257344) },
+      -INT64_C(    5946494002676569) },
+    { {  INT64_C( 4620710809868177408),  INT64_C(  162340761550487700), -INT64_C( 6894991939448337920),  INT64_C( 1153106222694646785),
+         INT64_C( 1009228533836293248), -INT64_C( 4611676122803797760),  INT64_C(       1108101562376),  INT64_C( 1234554230017622016) },
+      -INT64_C(   39408833572241507) },
+    { {  INT64_C(  576531121049174026),  INT64_C(     211742458126848),  INT64_C( 5764619634842042496),  INT64_C(    2392674741518352),
+         INT64_C(  576882965322137600),  INT64_C(  360363289454084106),  INT64_C(  306666987680041736),  INT64_C(     563088502325508) },
+       INT64_C( 6722695244593933214) },
+    { {  INT64_C(  432355459832389760),  INT64_C(  288230944211468448), -INT64_C( 9214342571952569344),  INT64_C(    1126201234030608),
+         INT64_C(  150870656374865922),  INT64_C(   90071993621547040),  INT64_C(  594483947107254304),  INT64_C(       3308198559744) },
+      -INT64_C( 8107570223314916174) },
+    { {  INT64_C( 1193467095393110053),  INT64_C( 4615063718282135552),  INT64_C(     158364311093504),  INT64_C(    9359060491174272),
+         INT64_C(     422247110041600), -INT64_C( 6881491413029093376),  INT64_C(  577621836650588672),  INT64_C(   18094390128686146) },
+      -INT64_C(  504969623152656409) },
+    { { -INT64_C( 5165628085264952319),  INT64_C(     141287514702850), -INT64_C( 9186216781180500992),  INT64_C(  146402185700212736),
+         INT64_C(       4398350603264), -INT64_C( 4467568351543812031),  INT64_C(   36029071900049488),  INT64_C( 5841173664502909955) },
+      -INT64_C(  298179980360811437) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_reduce_or_epi64(a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_reduce_or_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t r;
+  } test_vec[] = {
+    { UINT8_C(116),
+      {  INT64_C( 2326109207536867842),  INT64_C(    2251937252638722),  INT64_C(  288230496452804610),  INT64_C(   72690912773308676),
+         INT64_C(  630503947831870848), -INT64_C( 9223356643557244928),  INT64_C(   72198344748433424),  INT64_C(   10133107768295716) },
+      -INT64_C( 8232423854524660334) },
+    { UINT8_C(214),
+      {  INT64_C( 1154610355055659168),  INT64_C(    7881454503657764),  INT64_C(   41095621496571912),  INT64_C(  288230651163967489),
+         INT64_C(    2253045354201094), -INT64_C( 5181338594664380352),  INT64_C(  324646278984110593),  INT64_C( 4611686182730858496) },
+       INT64_C( 4944778077354957615) },
+    { UINT8_C(158),
+      {  INT64_C(      39591008540176),  INT64_C(   72059827425640576),  INT64_C(  362616736490457088),  INT64_C( 5764625394418884608),
+         INT64_C( 1191211120870817808),  INT64_C(  145529160029175881),  INT64_C(    4538788311270400),  INT64_C(  293028647042814292) },
+       INT64_C( 6168065058475129300) },
+    { UINT8_C( 35),
+      {  INT64_C( 4791830003522274048),  INT64_C(  288230930240246916),  INT64_C(        137508159497),  INT64_C( 5769111311807938692),
+         INT64_C(  307656616361068032),  INT64_C( 2360238735699750912), -INT64_C( 9218789268027076464),  INT64_C(      35253092634624) },
+       INT64_C( 7404270322653935492) },
+    { UINT8_C( 54),
+      {  INT64_C(   72620818878186496),  INT64_C(    1126243504259460), -INT64_C( 9070214430774001664),  INT64_C(  576606987358306305),
+         INT64_C(  865887397450088484),  INT64_C(    6800496933208074),  INT64_C( 2328387404221644801),  INT64_C( 4614221527410671744) },
+      -INT64_C( 8197561377500921426) },
+    { UINT8_C(226),
+      {  INT64_C(    9079217270555152),  INT64_C(  292733976075309634),  INT64_C(     211415471364162),  INT64_C(          4328523776),
+        -INT64_C( 4611684918647308224),  INT64_C(     144037097243152),  INT64_C( 2455592097219248160),  INT64_C( 1152927002183468304) },
+       INT64_C( 3896888015372326770) },
+    { UINT8_C(225),
+      {  INT64_C(  576531121047863372),  INT64_C(    9147937951204096),  INT64_C( 5008037974458335236),  INT64_C( 4616220404381390848),
+        -INT64_C( 8935123518722400254),  INT64_C(   81113446716801416),  INT64_C(  864695543685842515),  INT64_C( 1153486653583523872) },
+       INT64_C( 2099361614684096511) },
+    { UINT8_C( 14),
+      {  INT64_C( 7070721788153495552),  INT64_C(  252220270864040448),  INT64_C(  113152967011501088), -INT64_C( 9223369562657912768),
+         INT64_C( 1152921539001466884),  INT64_C(     565460701544450),  INT64_C( 1729683557523128324),  INT64_C(         10737942528) },
+      -INT64_C( 8966082715839263136) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r = simde_mm512_mask_reduce_or_epi64(test_vec[i].k, a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_add_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_add_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_add_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_add_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_add_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_add_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_add_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_add_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_mul_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_mul_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_mul_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_mul_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_mul_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_mul_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_mul_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_mul_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_max_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_max_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_max_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_max_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_max_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_max_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_max_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_max_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_max_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_max_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_max_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_max_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_min_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_min_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_min_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_min_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_min_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_min_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_min_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_min_epu64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_min_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_min_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_min_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_min_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_and_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_and_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_and_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_and_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_or_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_or_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_reduce_or_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_reduce_or_epi64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,518 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+#define SIMDE_TEST_X86_AVX512_INSN roundscale
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/roundscale.h>
+
+static int
+test_simde_mm512_roundscale_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  541.4000), SIMDE_FLOAT32_C( -489.0600), SIMDE_FLOAT32_C( -939.7700), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C( -928.9700), SIMDE_FLOAT32_C( -301.6900), SIMDE_FLOAT32_C(  712.2900), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(  909.8600), SIMDE_FLOAT32_C(  396.5000), SIMDE_FLOAT32_C( -452.2700), SIMDE_FLOAT32_C(   14.9600),
+        SIMDE_FLOAT32_C(  469.8300), SIMDE_FLOAT32_C(  -41.6500), SIMDE_FLOAT32_C(  757.7500), SIMDE_FLOAT32_C(  -43.6400) },
+      { SIMDE_FLOAT32_C(  541.0000), SIMDE_FLOAT32_C( -489.5000), SIMDE_FLOAT32_C( -940.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C( -929.0000), SIMDE_FLOAT32_C( -302.0000), SIMDE_FLOAT32_C(  712.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(  909.5000), SIMDE_FLOAT32_C(  396.5000), SIMDE_FLOAT32_C( -452.5000), SIMDE_FLOAT32_C(   14.5000),
+        SIMDE_FLOAT32_C(  469.5000), SIMDE_FLOAT32_C(  -42.0000), SIMDE_FLOAT32_C(  757.5000), SIMDE_FLOAT32_C(  -44.0000) } },
+    { {             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  152.8600), SIMDE_FLOAT32_C( -230.1200), SIMDE_FLOAT32_C(  268.4900),
+        SIMDE_FLOAT32_C( -174.2200), SIMDE_FLOAT32_C(  494.9100), SIMDE_FLOAT32_C(  436.9900), SIMDE_FLOAT32_C(  769.3500),
+        SIMDE_FLOAT32_C( -375.8600), SIMDE_FLOAT32_C(  680.6900), SIMDE_FLOAT32_C(  719.5900), SIMDE_FLOAT32_C( -457.5300),
+        SIMDE_FLOAT32_C(  136.8200), SIMDE_FLOAT32_C(  770.1400), SIMDE_FLOAT32_C(  178.6500), SIMDE_FLOAT32_C(  862.8700) },
+      {             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  152.5000), SIMDE_FLOAT32_C( -230.5000), SIMDE_FLOAT32_C(  268.0000),
+        SIMDE_FLOAT32_C( -174.5000), SIMDE_FLOAT32_C(  494.5000), SIMDE_FLOAT32_C(  436.5000), SIMDE_FLOAT32_C(  769.0000),
+        SIMDE_FLOAT32_C( -376.0000), SIMDE_FLOAT32_C(  680.5000), SIMDE_FLOAT32_C(  719.5000), SIMDE_FLOAT32_C( -458.0000),
+        SIMDE_FLOAT32_C(  136.5000), SIMDE_FLOAT32_C(  770.0000), SIMDE_FLOAT32_C(  178.5000), SIMDE_FLOAT32_C(  862.5000) } },
+    { { SIMDE_FLOAT32_C(  310.0600), SIMDE_FLOAT32_C(   85.1000), SIMDE_FLOAT32_C(  972.8800), SIMDE_FLOAT32_C(  552.4900),
+        SIMDE_FLOAT32_C( -926.2400), SIMDE_FLOAT32_C(   31.7100),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  832.0000),
+        SIMDE_FLOAT32_C(  494.7700),        SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C( -295.0300), SIMDE_FLOAT32_C(  593.4600),
+        SIMDE_FLOAT32_C(  279.5000), SIMDE_FLOAT32_C(  442.9700), SIMDE_FLOAT32_C( -893.9000), SIMDE_FLOAT32_C(  -28.7400) },
+      { SIMDE_FLOAT32_C(  310.0000), SIMDE_FLOAT32_C(   85.0000), SIMDE_FLOAT32_C(  972.5000), SIMDE_FLOAT32_C(  552.0000),
+        SIMDE_FLOAT32_C( -926.5000), SIMDE_FLOAT32_C(   31.5000),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  832.0000),
+        SIMDE_FLOAT32_C(  494.5000),        SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C( -295.5000), SIMDE_FLOAT32_C(  593.0000),
+        SIMDE_FLOAT32_C(  279.5000), SIMDE_FLOAT32_C(  442.5000), SIMDE_FLOAT32_C( -894.0000), SIMDE_FLOAT32_C(  -29.0000) } },
+    { { SIMDE_FLOAT32_C(  205.5000), SIMDE_FLOAT32_C(  989.2900), SIMDE_FLOAT32_C( -194.1500), SIMDE_FLOAT32_C(  166.6200),
+        SIMDE_FLOAT32_C(  -12.4900), SIMDE_FLOAT32_C( -197.2400), SIMDE_FLOAT32_C(  310.6000), SIMDE_FLOAT32_C( -344.1100),
+        SIMDE_FLOAT32_C(  889.4600), SIMDE_FLOAT32_C(  263.1300), SIMDE_FLOAT32_C( -928.3600), SIMDE_FLOAT32_C( -797.0900),
+        SIMDE_FLOAT32_C( -583.7100), SIMDE_FLOAT32_C( -725.6600), SIMDE_FLOAT32_C( -599.0500), SIMDE_FLOAT32_C(    1.0000) },
+      { SIMDE_FLOAT32_C(  205.5000), SIMDE_FLOAT32_C(  989.0000), SIMDE_FLOAT32_C( -194.5000), SIMDE_FLOAT32_C(  166.5000),
+        SIMDE_FLOAT32_C(  -12.5000), SIMDE_FLOAT32_C( -197.5000), SIMDE_FLOAT32_C(  310.5000), SIMDE_FLOAT32_C( -344.5000),
+        SIMDE_FLOAT32_C(  889.0000), SIMDE_FLOAT32_C(  263.0000), SIMDE_FLOAT32_C( -928.5000), SIMDE_FLOAT32_C( -797.5000),
+        SIMDE_FLOAT32_C( -584.0000), SIMDE_FLOAT32_C( -726.0000), SIMDE_FLOAT32_C( -599.5000), SIMDE_FLOAT32_C(    1.0000) } },
+    { { SIMDE_FLOAT32_C( -939.9400), SIMDE_FLOAT32_C( -874.6500), SIMDE_FLOAT32_C( -379.1100), SIMDE_FLOAT32_C(  314.3300),
+        SIMDE_FLOAT32_C( -335.8500), SIMDE_FLOAT32_C(  135.5000), SIMDE_FLOAT32_C( -872.7100), SIMDE_FLOAT32_C(    1.0000),
+        SIMDE_FLOAT32_C( -437.4500), SIMDE_FLOAT32_C( -947.4100), SIMDE_FLOAT32_C( -409.6800), SIMDE_FLOAT32_C(  262.1900),
+        SIMDE_FLOAT32_C( -699.0000), SIMDE_FLOAT32_C( -932.1200), SIMDE_FLOAT32_C(   -0.0000),        SIMDE_MATH_INFINITYF },
+      { SIMDE_FLOAT32_C( -940.0000), SIMDE_FLOAT32_C( -875.0000), SIMDE_FLOAT32_C( -379.5000), SIMDE_FLOAT32_C(  314.0000),
+        SIMDE_FLOAT32_C( -336.0000), SIMDE_FLOAT32_C(  135.5000), SIMDE_FLOAT32_C( -873.0000), SIMDE_FLOAT32_C(    1.0000),
+        SIMDE_FLOAT32_C( -437.5000), SIMDE_FLOAT32_C( -947.5000), SIMDE_FLOAT32_C( -410.0000), SIMDE_FLOAT32_C(  262.0000),
+        SIMDE_FLOAT32_C( -699.0000), SIMDE_FLOAT32_C( -932.5000), SIMDE_FLOAT32_C(   -0.0000),        SIMDE_MATH_INFINITYF } },
+    { { SIMDE_FLOAT32_C( -201.7600), SIMDE_FLOAT32_C(  230.2500), SIMDE_FLOAT32_C( -593.6500), SIMDE_FLOAT32_C( -538.3700),
+        SIMDE_FLOAT32_C( -931.4300), SIMDE_FLOAT32_C(  565.8000), SIMDE_FLOAT32_C(   18.8500),             SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(  456.8400),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  150.1600), SIMDE_FLOAT32_C( -724.4200),
+        SIMDE_FLOAT32_C( -837.4900), SIMDE_FLOAT32_C( -367.3200), SIMDE_FLOAT32_C(  798.4000), SIMDE_FLOAT32_C(  758.2500) },
+      { SIMDE_FLOAT32_C( -202.0000), SIMDE_FLOAT32_C(  230.0000), SIMDE_FLOAT32_C( -594.0000), SIMDE_FLOAT32_C( -538.5000),
+        SIMDE_FLOAT32_C( -931.5000), SIMDE_FLOAT32_C(  565.5000), SIMDE_FLOAT32_C(   18.5000),             SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(  456.5000),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  150.0000), SIMDE_FLOAT32_C( -724.5000),
+        SIMDE_FLOAT32_C( -837.5000), SIMDE_FLOAT32_C( -367.5000), SIMDE_FLOAT32_C(  798.0000), SIMDE_FLOAT32_C(  758.0000) } },
+    { { SIMDE_FLOAT32_C(  784.7000), SIMDE_FLOAT32_C(  854.3700), SIMDE_FLOAT32_C( -419.2600), SIMDE_FLOAT32_C( -701.7700),
+        SIMDE_FLOAT32_C(  -16.3700),        SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  920.2700), SIMDE_FLOAT32_C( -147.6800),
+        SIMDE_FLOAT32_C(  445.8200), SIMDE_FLOAT32_C( -235.8500), SIMDE_FLOAT32_C(  945.8100), SIMDE_FLOAT32_C(  627.6900),
+        SIMDE_FLOAT32_C(   -0.0000), SIMDE_FLOAT32_C(  810.7600), SIMDE_FLOAT32_C( -574.1900), SIMDE_FLOAT32_C(   -0.0000) },
+      { SIMDE_FLOAT32_C(  784.5000), SIMDE_FLOAT32_C(  854.0000), SIMDE_FLOAT32_C( -419.5000), SIMDE_FLOAT32_C( -702.0000),
+        SIMDE_FLOAT32_C(  -16.5000),        SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  920.0000), SIMDE_FLOAT32_C( -148.0000),
+        SIMDE_FLOAT32_C(  445.5000), SIMDE_FLOAT32_C( -236.0000), SIMDE_FLOAT32_C(  945.5000), SIMDE_FLOAT32_C(  627.5000),
+        SIMDE_FLOAT32_C(   -0.0000), SIMDE_FLOAT32_C(  810.5000), SIMDE_FLOAT32_C( -574.5000), SIMDE_FLOAT32_C(   -0.0000) } },
+    { { SIMDE_FLOAT32_C(  899.5100), SIMDE_FLOAT32_C(  -10.4000), SIMDE_FLOAT32_C(   -0.0000), SIMDE_FLOAT32_C( -367.4500),
+        SIMDE_FLOAT32_C(  362.8400), SIMDE_FLOAT32_C( -713.4900), SIMDE_FLOAT32_C( -441.6900), SIMDE_FLOAT32_C( -472.8200),
+        SIMDE_FLOAT32_C(  358.5300), SIMDE_FLOAT32_C(  962.5200), SIMDE_FLOAT32_C(  132.7500), SIMDE_FLOAT32_C( -816.3200),
+        SIMDE_FLOAT32_C( -489.5100),       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  710.9300), SIMDE_FLOAT32_C(    1.0000) },
+      { SIMDE_FLOAT32_C(  899.5000), SIMDE_FLOAT32_C(  -10.5000), SIMDE_FLOAT32_C(   -0.0000), SIMDE_FLOAT32_C( -367.5000),
+        SIMDE_FLOAT32_C(  362.5000), SIMDE_FLOAT32_C( -713.5000), SIMDE_FLOAT32_C( -442.0000), SIMDE_FLOAT32_C( -473.0000),
+        SIMDE_FLOAT32_C(  358.5000), SIMDE_FLOAT32_C(  962.5000), SIMDE_FLOAT32_C(  132.5000), SIMDE_FLOAT32_C( -816.5000),
+        SIMDE_FLOAT32_C( -490.0000),       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  710.5000), SIMDE_FLOAT32_C(    1.0000) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_roundscale_ps(a, INT32_C(0x11));
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_roundscale_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[16];
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C( -254.3800), SIMDE_FLOAT32_C( -833.5700), SIMDE_FLOAT32_C(  -75.3100), SIMDE_FLOAT32_C(  287.2600),
+        SIMDE_FLOAT32_C( -783.3600), SIMDE_FLOAT32_C( -929.0000), SIMDE_FLOAT32_C(  557.2000), SIMDE_FLOAT32_C( -493.7800),
+        SIMDE_FLOAT32_C( -488.7400), SIMDE_FLOAT32_C( -835.9500), SIMDE_FLOAT32_C( -782.4100), SIMDE_FLOAT32_C(  377.3500),
+        SIMDE_FLOAT32_C(  302.0500), SIMDE_FLOAT32_C(  863.5800), SIMDE_FLOAT32_C(   35.4600), SIMDE_FLOAT32_C(  -37.3200) },
+      UINT16_C( 1933),
+      { SIMDE_FLOAT32_C(  356.7700), SIMDE_FLOAT32_C( -644.9400), SIMDE_FLOAT32_C(   60.5300), SIMDE_FLOAT32_C( -954.4200),
+        SIMDE_FLOAT32_C(  164.1600), SIMDE_FLOAT32_C( -686.8300), SIMDE_FLOAT32_C( -877.6600), SIMDE_FLOAT32_C( -627.6600),
+        SIMDE_FLOAT32_C( -453.9600), SIMDE_FLOAT32_C( -275.3500), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   54.8000),
+        SIMDE_FLOAT32_C( -472.6400), SIMDE_FLOAT32_C(  -36.5800), SIMDE_FLOAT32_C(  -84.6200), SIMDE_FLOAT32_C( -134.7800) },
+      { SIMDE_FLOAT32_C(  356.7500), SIMDE_FLOAT32_C( -833.5700), SIMDE_FLOAT32_C(   60.5000), SIMDE_FLOAT32_C( -954.5000),
+        SIMDE_FLOAT32_C( -783.3600), SIMDE_FLOAT32_C( -929.0000), SIMDE_FLOAT32_C(  557.2000), SIMDE_FLOAT32_C( -627.7500),
+        SIMDE_FLOAT32_C( -454.0000), SIMDE_FLOAT32_C( -275.2500), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  377.3500),
+        SIMDE_FLOAT32_C(  302.0500), SIMDE_FLOAT32_C(  863.5800), SIMDE_FLOAT32_C(   35.4600), SIMDE_FLOAT32_C(  -37.3200) } },
+    { { SIMDE_FLOAT32_C(  103.2100), SIMDE_FLOAT32_C( -615.8400), SIMDE_FLOAT32_C( -345.2500), SIMDE_FLOAT32_C(  538.7500),
+        SIMDE_FLOAT32_C(  401.2700), SIMDE_FLOAT32_C(  566.3900), SIMDE_FLOAT32_C( -267.4100), SIMDE_FLOAT32_C(  618.2700),
+        SIMDE_FLOAT32_C(  571.0200), SIMDE_FLOAT32_C(  839.3200), SIMDE_FLOAT32_C( -500.3600), SIMDE_FLOAT32_C( -739.8600),
+        SIMDE_FLOAT32_C( -781.9700), SIMDE_FLOAT32_C( -729.3300), SIMDE_FLOAT32_C( -773.2700), SIMDE_FLOAT32_C(  519.6400) },
+      UINT16_C(39620),
+      { SIMDE_FLOAT32_C(  257.6300), SIMDE_FLOAT32_C(  642.2100), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  191.5800),
+        SIMDE_FLOAT32_C(  989.3700), SIMDE_FLOAT32_C(  815.5800), SIMDE_FLOAT32_C(  223.8200), SIMDE_FLOAT32_C(  182.0800),
+        SIMDE_FLOAT32_C(  796.0700), SIMDE_FLOAT32_C(   71.4900), SIMDE_FLOAT32_C(  616.7300), SIMDE_FLOAT32_C(  913.2200),
+        SIMDE_FLOAT32_C( -317.6200), SIMDE_FLOAT32_C(  203.2800), SIMDE_FLOAT32_C(  157.2500), SIMDE_FLOAT32_C( -106.6300) },
+      { SIMDE_FLOAT32_C(  103.2100), SIMDE_FLOAT32_C( -615.8400), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  538.7500),
+        SIMDE_FLOAT32_C(  401.2700), SIMDE_FLOAT32_C(  566.3900), SIMDE_FLOAT32_C(  223.7500), SIMDE_FLOAT32_C(  182.0000),
+        SIMDE_FLOAT32_C(  571.0200), SIMDE_FLOAT32_C(   71.5000), SIMDE_FLOAT32_C( -500.3600), SIMDE_FLOAT32_C(  913.2500),
+        SIMDE_FLOAT32_C( -317.5000), SIMDE_FLOAT32_C( -729.3300), SIMDE_FLOAT32_C( -773.2700), SIMDE_FLOAT32_C( -106.7500) } },
+    { { SIMDE_FLOAT32_C( -878.5100), SIMDE_FLOAT32_C( -419.3600), SIMDE_FLOAT32_C( -427.8500), SIMDE_FLOAT32_C(  610.0300),
+        SIMDE_FLOAT32_C( -852.6800), SIMDE_FLOAT32_C(  758.4900), SIMDE_FLOAT32_C(  104.4200), SIMDE_FLOAT32_C(  884.2300),
+        SIMDE_FLOAT32_C(  -11.7200), SIMDE_FLOAT32_C(   58.7700), SIMDE_FLOAT32_C( -912.4300), SIMDE_FLOAT32_C( -551.3000),
+        SIMDE_FLOAT32_C(  -74.1400), SIMDE_FLOAT32_C( -261.6600), SIMDE_FLOAT32_C( -800.7200), SIMDE_FLOAT32_C( -757.5400) },
+      UINT16_C(24137),
+      { SIMDE_FLOAT32_C(  241.5700), SIMDE_FLOAT32_C( -605.0200), SIMDE_FLOAT32_C( -844.1900), SIMDE_FLOAT32_C(  112.2100),
+        SIMDE_FLOAT32_C(  288.3500), SIMDE_FLOAT32_C(  859.2000), SIMDE_FLOAT32_C( -652.2200), SIMDE_FLOAT32_C(    1.0000),
+        SIMDE_FLOAT32_C( -668.1600), SIMDE_FLOAT32_C( -915.5800), SIMDE_FLOAT32_C(  331.4300), SIMDE_FLOAT32_C(   -0.0000),
+        SIMDE_FLOAT32_C( -266.1300), SIMDE_FLOAT32_C( -588.2500), SIMDE_FLOAT32_C( -578.9900), SIMDE_FLOAT32_C(  529.6800) },
+      { SIMDE_FLOAT32_C(  241.5000), SIMDE_FLOAT32_C( -419.3600), SIMDE_FLOAT32_C( -427.8500), SIMDE_FLOAT32_C(  112.2500),
+        SIMDE_FLOAT32_C( -852.6800), SIMDE_FLOAT32_C(  758.4900), SIMDE_FLOAT32_C( -652.2500), SIMDE_FLOAT32_C(  884.2300),
+        SIMDE_FLOAT32_C(  -11.7200), SIMDE_FLOAT32_C( -915.5000), SIMDE_FLOAT32_C(  331.5000), SIMDE_FLOAT32_C(   -0.0000),
+        SIMDE_FLOAT32_C( -266.2500), SIMDE_FLOAT32_C( -261.6600), SIMDE_FLOAT32_C( -579.0000), SIMDE_FLOAT32_C( -757.5400) } },
+    { { SIMDE_FLOAT32_C(    8.5400), SIMDE_FLOAT32_C(  361.9000), SIMDE_FLOAT32_C( -751.5600), SIMDE_FLOAT32_C( -309.0600),
+        SIMDE_FLOAT32_C( -393.8600), SIMDE_FLOAT32_C( -994.5600), SIMDE_FLOAT32_C(  241.0000), SIMDE_FLOAT32_C( -572.7900),
+        SIMDE_FLOAT32_C(  663.6900), SIMDE_FLOAT32_C(  486.4500), SIMDE_FLOAT32_C(  938.3900), SIMDE_FLOAT32_C(  179.0800),
+        SIMDE_FLOAT32_C(  149.8800), SIMDE_FLOAT32_C( -569.7800), SIMDE_FLOAT32_C(  249.4800), SIMDE_FLOAT32_C(   70.0200) },
+      UINT16_C(49270),
+      { SIMDE_FLOAT32_C(  547.9400), SIMDE_FLOAT32_C( -512.1200), SIMDE_FLOAT32_C( -197.3900),             SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(  -89.9500), SIMDE_FLOAT32_C(  435.5500), SIMDE_FLOAT32_C( -723.8300), SIMDE_FLOAT32_C(  799.3500),
+        SIMDE_FLOAT32_C( -739.3600), SIMDE_FLOAT32_C( -327.2200), SIMDE_FLOAT32_C(  177.6100), SIMDE_FLOAT32_C( -252.6500),
+        SIMDE_FLOAT32_C(  281.5300), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C( -158.0200) },
+      { SIMDE_FLOAT32_C(    8.5400), SIMDE_FLOAT32_C( -512.0000), SIMDE_FLOAT32_C( -197.5000), SIMDE_FLOAT32_C( -309.0600),
+        SIMDE_FLOAT32_C(  -90.0000), SIMDE_FLOAT32_C(  435.5000), SIMDE_FLOAT32_C( -723.7500), SIMDE_FLOAT32_C( -572.7900),
+        SIMDE_FLOAT32_C(  663.6900), SIMDE_FLOAT32_C(  486.4500), SIMDE_FLOAT32_C(  938.3900), SIMDE_FLOAT32_C(  179.0800),
+        SIMDE_FLOAT32_C(  149.8800), SIMDE_FLOAT32_C( -569.7800), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C( -158.0000) } },
+    { { SIMDE_FLOAT32_C(  978.2400), SIMDE_FLOAT32_C(   84.2100), SIMDE_FLOAT32_C(  382.4600), SIMDE_FLOAT32_C( -366.9300),
+        SIMDE_FLOAT32_C( -924.2400), SIMDE_FLOAT32_C(  923.6300), SIMDE_FLOAT32_C(  198.8300), SIMDE_FLOAT32_C(  921.0800),
+        SIMDE_FLOAT32_C(  504.6300), SIMDE_FLOAT32_C( -976.4400), SIMDE_FLOAT32_C( -181.5400), SIMDE_FLOAT32_C(  217.4200),
+        SIMDE_FLOAT32_C( -523.9200), SIMDE_FLOAT32_C(  310.4400), SIMDE_FLOAT32_C(  454.7100), SIMDE_FLOAT32_C(  685.9600) },
+      UINT16_C(22640),
+      { SIMDE_FLOAT32_C( -489.5100), SIMDE_FLOAT32_C(    5.1500), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C(  835.4600),
+        SIMDE_FLOAT32_C(  333.2300), SIMDE_FLOAT32_C(   89.9000), SIMDE_FLOAT32_C( -888.8300), SIMDE_FLOAT32_C( -653.1200),
+        SIMDE_FLOAT32_C( -573.3000), SIMDE_FLOAT32_C(  480.3200), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  -80.6000),
+        SIMDE_FLOAT32_C( -852.1000), SIMDE_FLOAT32_C(  330.1700), SIMDE_FLOAT32_C(  258.4700), SIMDE_FLOAT32_C( -374.0700) },
+      { SIMDE_FLOAT32_C(  978.2400), SIMDE_FLOAT32_C(   84.2100), SIMDE_FLOAT32_C(  382.4600), SIMDE_FLOAT32_C( -366.9300),
+        SIMDE_FLOAT32_C(  333.2500), SIMDE_FLOAT32_C(   90.0000), SIMDE_FLOAT32_C( -888.7500), SIMDE_FLOAT32_C(  921.0800),
+        SIMDE_FLOAT32_C(  504.6300), SIMDE_FLOAT32_C( -976.4400), SIMDE_FLOAT32_C( -181.5400), SIMDE_FLOAT32_C(  -80.5000),
+        SIMDE_FLOAT32_C( -852.0000), SIMDE_FLOAT32_C(  310.4400), SIMDE_FLOAT32_C(  258.5000), SIMDE_FLOAT32_C(  685.9600) } },
+    { { SIMDE_FLOAT32_C(  463.6500), SIMDE_FLOAT32_C(  978.4500), SIMDE_FLOAT32_C(  128.5800), SIMDE_FLOAT32_C( -901.9600),
+        SIMDE_FLOAT32_C(  534.7100), SIMDE_FLOAT32_C(  841.4900), SIMDE_FLOAT32_C( -774.5800), SIMDE_FLOAT32_C( -860.3200),
+        SIMDE_FLOAT32_C(  711.2900), SIMDE_FLOAT32_C(  753.6300), SIMDE_FLOAT32_C(   71.4800), SIMDE_FLOAT32_C( -592.8500),
+        SIMDE_FLOAT32_C(  297.9200), SIMDE_FLOAT32_C(  708.6800), SIMDE_FLOAT32_C(  215.2100), SIMDE_FLOAT32_C( -286.4800) },
+      UINT16_C(47117),
+      { SIMDE_FLOAT32_C(  819.1800), SIMDE_FLOAT32_C(  -48.1900), SIMDE_FLOAT32_C(   -0.0000), SIMDE_FLOAT32_C(  349.1200),
+        SIMDE_FLOAT32_C(  384.7200),       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  364.6000), SIMDE_FLOAT32_C( -152.9400),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  705.0000), SIMDE_FLOAT32_C( -128.2200),
+        SIMDE_FLOAT32_C(  316.4400), SIMDE_FLOAT32_C(  -56.5800), SIMDE_FLOAT32_C(  314.3000), SIMDE_FLOAT32_C(  791.8300) },
+      { SIMDE_FLOAT32_C(  819.2500), SIMDE_FLOAT32_C(  978.4500), SIMDE_FLOAT32_C(   -0.0000), SIMDE_FLOAT32_C(  349.0000),
+        SIMDE_FLOAT32_C(  534.7100), SIMDE_FLOAT32_C(  841.4900), SIMDE_FLOAT32_C( -774.5800), SIMDE_FLOAT32_C( -860.3200),
+        SIMDE_FLOAT32_C(  711.2900), SIMDE_FLOAT32_C(  753.6300), SIMDE_FLOAT32_C(   71.4800), SIMDE_FLOAT32_C( -128.2500),
+        SIMDE_FLOAT32_C(  316.5000), SIMDE_FLOAT32_C(  -56.5000), SIMDE_FLOAT32_C(  215.2100), SIMDE_FLOAT32_C(  791.7500) } },
+    { { SIMDE_FLOAT32_C(  743.9400), SIMDE_FLOAT32_C(  555.0500), SIMDE_FLOAT32_C(  141.4100), SIMDE_FLOAT32_C( -121.5800),
+        SIMDE_FLOAT32_C( -372.0300), SIMDE_FLOAT32_C( -708.8000), SIMDE_FLOAT32_C(  871.4000), SIMDE_FLOAT32_C( -664.4500),
+        SIMDE_FLOAT32_C(  787.8800), SIMDE_FLOAT32_C(  386.9700), SIMDE_FLOAT32_C(  114.3500), SIMDE_FLOAT32_C( -994.4900),
+        SIMDE_FLOAT32_C(  715.3200), SIMDE_FLOAT32_C( -650.3900), SIMDE_FLOAT32_C( -862.4500), SIMDE_FLOAT32_C(  -85.9300) },
+      UINT16_C( 5718),
+      { SIMDE_FLOAT32_C(  535.7100), SIMDE_FLOAT32_C(  975.5200), SIMDE_FLOAT32_C(  149.5200), SIMDE_FLOAT32_C(  952.5500),
+        SIMDE_FLOAT32_C( -963.1100), SIMDE_FLOAT32_C( -673.2000), SIMDE_FLOAT32_C(  953.0100), SIMDE_FLOAT32_C(  546.9600),
+        SIMDE_FLOAT32_C(  483.9900), SIMDE_FLOAT32_C( -400.2300), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C(  571.7300),
+        SIMDE_FLOAT32_C(  612.0800), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  623.8600), SIMDE_FLOAT32_C( -354.5700) },
+      { SIMDE_FLOAT32_C(  743.9400), SIMDE_FLOAT32_C(  975.5000), SIMDE_FLOAT32_C(  149.5000), SIMDE_FLOAT32_C( -121.5800),
+        SIMDE_FLOAT32_C( -963.0000), SIMDE_FLOAT32_C( -708.8000), SIMDE_FLOAT32_C(  953.0000), SIMDE_FLOAT32_C( -664.4500),
+        SIMDE_FLOAT32_C(  787.8800), SIMDE_FLOAT32_C( -400.2500), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C( -994.4900),
+        SIMDE_FLOAT32_C(  612.0000), SIMDE_FLOAT32_C( -650.3900), SIMDE_FLOAT32_C( -862.4500), SIMDE_FLOAT32_C(  -85.9300) } },
+    { { SIMDE_FLOAT32_C(   11.6400), SIMDE_FLOAT32_C( -732.5000), SIMDE_FLOAT32_C(  674.0600), SIMDE_FLOAT32_C(  465.3600),
+        SIMDE_FLOAT32_C(  725.7100), SIMDE_FLOAT32_C(  -67.5200), SIMDE_FLOAT32_C(  904.6500), SIMDE_FLOAT32_C( -273.5300),
+        SIMDE_FLOAT32_C(  -35.6000), SIMDE_FLOAT32_C( -631.3200), SIMDE_FLOAT32_C(  -72.6500), SIMDE_FLOAT32_C(  218.8200),
+        SIMDE_FLOAT32_C( -458.3500), SIMDE_FLOAT32_C( -300.0300), SIMDE_FLOAT32_C( -963.8600), SIMDE_FLOAT32_C(   28.2500) },
+      UINT16_C(12364),
+      { SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C( -831.4100), SIMDE_FLOAT32_C(  669.5100), SIMDE_FLOAT32_C(  382.5200),
+        SIMDE_FLOAT32_C(  521.3100), SIMDE_FLOAT32_C(   -6.4800), SIMDE_FLOAT32_C( -531.3400), SIMDE_FLOAT32_C(  900.9300),
+        SIMDE_FLOAT32_C( -380.3400), SIMDE_FLOAT32_C(  958.3500), SIMDE_FLOAT32_C(  529.9700), SIMDE_FLOAT32_C(    1.0000),
+        SIMDE_FLOAT32_C(  443.2500), SIMDE_FLOAT32_C(  771.6700), SIMDE_FLOAT32_C( -200.0100), SIMDE_FLOAT32_C( -983.2100) },
+      { SIMDE_FLOAT32_C(   11.6400), SIMDE_FLOAT32_C( -732.5000), SIMDE_FLOAT32_C(  669.5000), SIMDE_FLOAT32_C(  382.5000),
+        SIMDE_FLOAT32_C(  725.7100), SIMDE_FLOAT32_C(  -67.5200), SIMDE_FLOAT32_C( -531.2500), SIMDE_FLOAT32_C( -273.5300),
+        SIMDE_FLOAT32_C(  -35.6000), SIMDE_FLOAT32_C( -631.3200), SIMDE_FLOAT32_C(  -72.6500), SIMDE_FLOAT32_C(  218.8200),
+        SIMDE_FLOAT32_C(  443.2500), SIMDE_FLOAT32_C(  771.7500), SIMDE_FLOAT32_C( -963.8600), SIMDE_FLOAT32_C(   28.2500) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 src = simde_mm512_loadu_ps(test_vec[i].src);
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_mask_roundscale_ps(src, test_vec[i].k, a, INT32_C(0x20));
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_roundscale_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { UINT16_C(50107),
+      { SIMDE_FLOAT32_C( -306.6200), SIMDE_FLOAT32_C( -217.1300), SIMDE_FLOAT32_C( -845.5700), SIMDE_FLOAT32_C( -960.8800),
+        SIMDE_FLOAT32_C( -969.4300), SIMDE_FLOAT32_C(   -0.0000), SIMDE_FLOAT32_C(  452.8400), SIMDE_FLOAT32_C(    1.0000),
+        SIMDE_FLOAT32_C(  917.1400), SIMDE_FLOAT32_C(  534.3500), SIMDE_FLOAT32_C( -475.5300), SIMDE_FLOAT32_C(  650.5700),
+        SIMDE_FLOAT32_C( -738.3400), SIMDE_FLOAT32_C(  716.6600), SIMDE_FLOAT32_C( -258.8000), SIMDE_FLOAT32_C(  958.3300) },
+      { SIMDE_FLOAT32_C( -306.0000), SIMDE_FLOAT32_C( -217.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C( -960.0000),
+        SIMDE_FLOAT32_C( -969.0000), SIMDE_FLOAT32_C(   -0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    1.0000),
+        SIMDE_FLOAT32_C(  917.0000), SIMDE_FLOAT32_C(  534.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C( -258.0000), SIMDE_FLOAT32_C(  958.0000) } },
+    { UINT16_C(11965),
+      { SIMDE_FLOAT32_C(  390.1200), SIMDE_FLOAT32_C(  503.6500), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C( -251.6300),
+        SIMDE_FLOAT32_C(  -88.7200), SIMDE_FLOAT32_C( -884.3400), SIMDE_FLOAT32_C( -330.6700), SIMDE_FLOAT32_C( -171.9800),
+        SIMDE_FLOAT32_C( -357.0600), SIMDE_FLOAT32_C( -621.8700), SIMDE_FLOAT32_C(  795.4500), SIMDE_FLOAT32_C(  335.3700),
+        SIMDE_FLOAT32_C( -396.6100), SIMDE_FLOAT32_C(  -62.4200), SIMDE_FLOAT32_C(  742.4800), SIMDE_FLOAT32_C(  366.2100) },
+      { SIMDE_FLOAT32_C(  390.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C( -251.0000),
+        SIMDE_FLOAT32_C(  -88.0000), SIMDE_FLOAT32_C( -884.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C( -171.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C( -621.0000), SIMDE_FLOAT32_C(  795.0000), SIMDE_FLOAT32_C(  335.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  -62.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT16_C( 8130),
+      { SIMDE_FLOAT32_C( -715.2200), SIMDE_FLOAT32_C(   -0.0000), SIMDE_FLOAT32_C(  850.4300), SIMDE_FLOAT32_C(  605.5800),
+        SIMDE_FLOAT32_C(  696.2800), SIMDE_FLOAT32_C( -591.1800),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  670.4100),
+        SIMDE_FLOAT32_C( -395.5700), SIMDE_FLOAT32_C( -956.7500),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  811.2400),
+        SIMDE_FLOAT32_C( -755.2600), SIMDE_FLOAT32_C( -137.2600), SIMDE_FLOAT32_C( -476.2500), SIMDE_FLOAT32_C( -415.0100) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   -0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  670.0000),
+        SIMDE_FLOAT32_C( -395.0000), SIMDE_FLOAT32_C( -956.0000),             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  811.0000),
+        SIMDE_FLOAT32_C( -755.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT16_C(43679),
+      { SIMDE_FLOAT32_C(  303.6300), SIMDE_FLOAT32_C( -763.9800), SIMDE_FLOAT32_C( -418.7800), SIMDE_FLOAT32_C( -558.9800),
+        SIMDE_FLOAT32_C(  894.8900), SIMDE_FLOAT32_C( -464.9600), SIMDE_FLOAT32_C(  -94.7000), SIMDE_FLOAT32_C( -493.1700),
+        SIMDE_FLOAT32_C( -800.3800), SIMDE_FLOAT32_C( -527.2300), SIMDE_FLOAT32_C(   62.1200), SIMDE_FLOAT32_C( -862.1600),
+        SIMDE_FLOAT32_C(  672.0900), SIMDE_FLOAT32_C(  233.4000), SIMDE_FLOAT32_C(  123.0800), SIMDE_FLOAT32_C( -354.9800) },
+      { SIMDE_FLOAT32_C(  303.0000), SIMDE_FLOAT32_C( -763.0000), SIMDE_FLOAT32_C( -418.0000), SIMDE_FLOAT32_C( -558.0000),
+        SIMDE_FLOAT32_C(  894.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C( -493.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C( -527.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C( -862.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  233.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C( -354.0000) } },
+    { UINT16_C( 1471),
+      { SIMDE_FLOAT32_C(  386.7000), SIMDE_FLOAT32_C(    1.0000),       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  842.6300),
+        SIMDE_FLOAT32_C(  515.4500), SIMDE_FLOAT32_C(  318.0000), SIMDE_FLOAT32_C( -608.7000), SIMDE_FLOAT32_C( -217.8100),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C( -709.6000), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C( -292.1100),
+        SIMDE_FLOAT32_C( -560.9400), SIMDE_FLOAT32_C(  -92.3500), SIMDE_FLOAT32_C( -552.0300), SIMDE_FLOAT32_C( -952.1700) },
+      { SIMDE_FLOAT32_C(  386.0000), SIMDE_FLOAT32_C(    1.0000),       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  842.0000),
+        SIMDE_FLOAT32_C(  515.0000), SIMDE_FLOAT32_C(  318.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C( -217.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT16_C(23585),
+      {             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  134.5600), SIMDE_FLOAT32_C(  890.7500), SIMDE_FLOAT32_C(  284.4400),
+        SIMDE_FLOAT32_C(    1.0000), SIMDE_FLOAT32_C( -682.6500), SIMDE_FLOAT32_C(  -25.0200), SIMDE_FLOAT32_C( -142.9100),
+        SIMDE_FLOAT32_C(  966.8200), SIMDE_FLOAT32_C( -393.3600),       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  498.1600),
+        SIMDE_FLOAT32_C( -962.4000), SIMDE_FLOAT32_C(  840.5100), SIMDE_FLOAT32_C(  228.6000), SIMDE_FLOAT32_C( -233.4100) },
+      {             SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C( -682.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),       -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  498.0000),
+        SIMDE_FLOAT32_C( -962.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  228.0000), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT16_C(35709),
+      { SIMDE_FLOAT32_C(  510.3900), SIMDE_FLOAT32_C(   54.0800), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  415.0700),
+        SIMDE_FLOAT32_C(  -91.7500), SIMDE_FLOAT32_C( -206.6500), SIMDE_FLOAT32_C(   60.6500), SIMDE_FLOAT32_C(  346.9700),
+        SIMDE_FLOAT32_C(   21.3800), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C( -456.2900), SIMDE_FLOAT32_C( -726.7200),
+        SIMDE_FLOAT32_C( -457.1900),        SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  574.6400), SIMDE_FLOAT32_C( -383.1800) },
+      { SIMDE_FLOAT32_C(  510.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  415.0000),
+        SIMDE_FLOAT32_C(  -91.0000), SIMDE_FLOAT32_C( -206.0000), SIMDE_FLOAT32_C(   60.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(   21.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C( -726.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C( -383.0000) } },
+    { UINT16_C(35653),
+      { SIMDE_FLOAT32_C(  480.4700), SIMDE_FLOAT32_C( -410.4700), SIMDE_FLOAT32_C(  430.8700), SIMDE_FLOAT32_C( -339.4900),
+        SIMDE_FLOAT32_C( -750.3300), SIMDE_FLOAT32_C( -675.0600), SIMDE_FLOAT32_C(   53.1200), SIMDE_FLOAT32_C(  623.2400),
+                    SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  684.1800), SIMDE_FLOAT32_C( -193.1100), SIMDE_FLOAT32_C(  -71.2000),
+                    SIMDE_MATH_NANF, SIMDE_FLOAT32_C( -423.8600), SIMDE_FLOAT32_C( -948.8900), SIMDE_FLOAT32_C( -866.5800) },
+      { SIMDE_FLOAT32_C(  480.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  430.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   53.0000), SIMDE_FLOAT32_C(    0.0000),
+                    SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  684.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  -71.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C( -866.0000) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_maskz_roundscale_ps(test_vec[i].k, a, INT32_C(0x03));
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_roundscale_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C( -842.1400), SIMDE_FLOAT64_C(  208.5000), SIMDE_FLOAT64_C(  118.6600), SIMDE_FLOAT64_C(  -62.3500),
+                     SIMDE_MATH_NAN, SIMDE_FLOAT64_C( -319.9200), SIMDE_FLOAT64_C( -281.7000), SIMDE_FLOAT64_C( -291.4700) },
+      { SIMDE_FLOAT64_C( -842.0000), SIMDE_FLOAT64_C(  208.5000), SIMDE_FLOAT64_C(  119.0000), SIMDE_FLOAT64_C(  -62.0000),
+                     SIMDE_MATH_NAN, SIMDE_FLOAT64_C( -319.5000), SIMDE_FLOAT64_C( -281.5000), SIMDE_FLOAT64_C( -291.0000) } },
+    { { SIMDE_FLOAT64_C(  441.6900), SIMDE_FLOAT64_C( -872.2700), SIMDE_FLOAT64_C(  982.3300), SIMDE_FLOAT64_C( -729.2000),
+        SIMDE_FLOAT64_C(  319.0000), SIMDE_FLOAT64_C( -202.9200), SIMDE_FLOAT64_C(  512.5300), SIMDE_FLOAT64_C(  -40.5600) },
+      { SIMDE_FLOAT64_C(  442.0000), SIMDE_FLOAT64_C( -872.0000), SIMDE_FLOAT64_C(  982.5000), SIMDE_FLOAT64_C( -729.0000),
+        SIMDE_FLOAT64_C(  319.0000), SIMDE_FLOAT64_C( -202.5000), SIMDE_FLOAT64_C(  513.0000), SIMDE_FLOAT64_C(  -40.5000) } },
+    { { SIMDE_FLOAT64_C(  763.6500), SIMDE_FLOAT64_C( -961.8300), SIMDE_FLOAT64_C( -889.1900), SIMDE_FLOAT64_C(  978.0800),
+        SIMDE_FLOAT64_C( -282.6700), SIMDE_FLOAT64_C(  764.4000), SIMDE_FLOAT64_C(  900.3700), SIMDE_FLOAT64_C( -539.3700) },
+      { SIMDE_FLOAT64_C(  764.0000), SIMDE_FLOAT64_C( -961.5000), SIMDE_FLOAT64_C( -889.0000), SIMDE_FLOAT64_C(  978.5000),
+        SIMDE_FLOAT64_C( -282.5000), SIMDE_FLOAT64_C(  764.5000), SIMDE_FLOAT64_C(  900.5000), SIMDE_FLOAT64_C( -539.0000) } },
+    { { SIMDE_FLOAT64_C(  367.3200), SIMDE_FLOAT64_C(  169.0700), SIMDE_FLOAT64_C(  853.2500), SIMDE_FLOAT64_C(  490.3100),
+        SIMDE_FLOAT64_C( -383.7200), SIMDE_FLOAT64_C(  648.5900), SIMDE_FLOAT64_C(  883.6100), SIMDE_FLOAT64_C( -493.4000) },
+      { SIMDE_FLOAT64_C(  367.5000), SIMDE_FLOAT64_C(  169.5000), SIMDE_FLOAT64_C(  853.5000), SIMDE_FLOAT64_C(  490.5000),
+        SIMDE_FLOAT64_C( -383.5000), SIMDE_FLOAT64_C(  649.0000), SIMDE_FLOAT64_C(  884.0000), SIMDE_FLOAT64_C( -493.0000) } },
+    { { SIMDE_FLOAT64_C(  -87.9800), SIMDE_FLOAT64_C(  805.2200), SIMDE_FLOAT64_C(  707.8900),         SIMDE_MATH_INFINITY,
+        SIMDE_FLOAT64_C( -986.4700), SIMDE_FLOAT64_C(  394.2900), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(  662.0300) },
+      { SIMDE_FLOAT64_C(  -87.5000), SIMDE_FLOAT64_C(  805.5000), SIMDE_FLOAT64_C(  708.0000),         SIMDE_MATH_INFINITY,
+        SIMDE_FLOAT64_C( -986.0000), SIMDE_FLOAT64_C(  394.5000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(  662.5000) } },
+    { { SIMDE_FLOAT64_C( -756.3300), SIMDE_FLOAT64_C(  311.9000), SIMDE_FLOAT64_C(  822.1300), SIMDE_FLOAT64_C(  335.8600),
+        SIMDE_FLOAT64_C( -668.5200), SIMDE_FLOAT64_C( -204.9100), SIMDE_FLOAT64_C(  174.8000), SIMDE_FLOAT64_C(  555.3000) },
+      { SIMDE_FLOAT64_C( -756.0000), SIMDE_FLOAT64_C(  312.0000), SIMDE_FLOAT64_C(  822.5000), SIMDE_FLOAT64_C(  336.0000),
+        SIMDE_FLOAT64_C( -668.5000), SIMDE_FLOAT64_C( -204.5000), SIMDE_FLOAT64_C(  175.0000), SIMDE_FLOAT64_C(  555.5000) } },
+    { { SIMDE_FLOAT64_C( -105.3700), SIMDE_FLOAT64_C(  884.0300), SIMDE_FLOAT64_C(  414.4900), SIMDE_FLOAT64_C( -132.3100),
+        SIMDE_FLOAT64_C( -425.8900), SIMDE_FLOAT64_C(  438.7700), SIMDE_FLOAT64_C(  830.1500), SIMDE_FLOAT64_C( -360.2200) },
+      { SIMDE_FLOAT64_C( -105.0000), SIMDE_FLOAT64_C(  884.5000), SIMDE_FLOAT64_C(  414.5000), SIMDE_FLOAT64_C( -132.0000),
+        SIMDE_FLOAT64_C( -425.5000), SIMDE_FLOAT64_C(  439.0000), SIMDE_FLOAT64_C(  830.5000), SIMDE_FLOAT64_C( -360.0000) } },
+    { { SIMDE_FLOAT64_C(  714.0300), SIMDE_FLOAT64_C( -958.0600), SIMDE_FLOAT64_C(  345.1000), SIMDE_FLOAT64_C( -845.4100),
+        SIMDE_FLOAT64_C( -533.9200), SIMDE_FLOAT64_C(  640.4300), SIMDE_FLOAT64_C(  223.6400), SIMDE_FLOAT64_C(    1.0000) },
+      { SIMDE_FLOAT64_C(  714.5000), SIMDE_FLOAT64_C( -958.0000), SIMDE_FLOAT64_C(  345.5000), SIMDE_FLOAT64_C( -845.0000),
+        SIMDE_FLOAT64_C( -533.5000), SIMDE_FLOAT64_C(  640.5000), SIMDE_FLOAT64_C(  224.0000), SIMDE_FLOAT64_C(    1.0000) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_roundscale_pd(a, INT32_C(0x12));
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_roundscale_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[8];
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C( -116.5900), SIMDE_FLOAT64_C( -290.3500), SIMDE_FLOAT64_C(  414.4800), SIMDE_FLOAT64_C(  931.6400),
+        SIMDE_FLOAT64_C(  670.6400), SIMDE_FLOAT64_C(  949.5000), SIMDE_FLOAT64_C( -107.3300), SIMDE_FLOAT64_C(  146.8400) },
+      UINT8_C(192),
+      { SIMDE_FLOAT64_C(  109.2900), SIMDE_FLOAT64_C( -739.3900), SIMDE_FLOAT64_C( -263.4300), SIMDE_FLOAT64_C( -774.2700),
+        SIMDE_FLOAT64_C(  924.4000), SIMDE_FLOAT64_C(  216.4600), SIMDE_FLOAT64_C( -706.6800),        -SIMDE_MATH_INFINITY },
+      { SIMDE_FLOAT64_C( -116.5900), SIMDE_FLOAT64_C( -290.3500), SIMDE_FLOAT64_C(  414.4800), SIMDE_FLOAT64_C(  931.6400),
+        SIMDE_FLOAT64_C(  670.6400), SIMDE_FLOAT64_C(  949.5000), SIMDE_FLOAT64_C( -706.6250),        -SIMDE_MATH_INFINITY } },
+    { { SIMDE_FLOAT64_C( -590.3900), SIMDE_FLOAT64_C(  687.9400), SIMDE_FLOAT64_C( -971.3900), SIMDE_FLOAT64_C( -511.4300),
+        SIMDE_FLOAT64_C(  759.4900), SIMDE_FLOAT64_C(  331.4700), SIMDE_FLOAT64_C( -410.4700), SIMDE_FLOAT64_C(  942.1300) },
+      UINT8_C(132),
+      { SIMDE_FLOAT64_C(  -33.8200), SIMDE_FLOAT64_C(  994.9500), SIMDE_FLOAT64_C(  451.3600), SIMDE_FLOAT64_C(  627.8000),
+        SIMDE_FLOAT64_C(  108.1800), SIMDE_FLOAT64_C( -771.0800), SIMDE_FLOAT64_C(  702.1700), SIMDE_FLOAT64_C( -427.1700) },
+      { SIMDE_FLOAT64_C( -590.3900), SIMDE_FLOAT64_C(  687.9400), SIMDE_FLOAT64_C(  451.2500), SIMDE_FLOAT64_C( -511.4300),
+        SIMDE_FLOAT64_C(  759.4900), SIMDE_FLOAT64_C(  331.4700), SIMDE_FLOAT64_C( -410.4700), SIMDE_FLOAT64_C( -427.1250) } },
+    { { SIMDE_FLOAT64_C(  112.6100), SIMDE_FLOAT64_C(  465.5100), SIMDE_FLOAT64_C( -778.5300), SIMDE_FLOAT64_C(  550.0400),
+        SIMDE_FLOAT64_C( -474.2000), SIMDE_FLOAT64_C(  169.9900), SIMDE_FLOAT64_C( -923.2800), SIMDE_FLOAT64_C(  374.3100) },
+      UINT8_C(252),
+      { SIMDE_FLOAT64_C( -856.6600), SIMDE_FLOAT64_C(  536.3400), SIMDE_FLOAT64_C( -593.0900), SIMDE_FLOAT64_C( -581.3700),
+        SIMDE_FLOAT64_C(  -85.2700), SIMDE_FLOAT64_C( -477.0400), SIMDE_FLOAT64_C(  418.4400), SIMDE_FLOAT64_C(  181.4200) },
+      { SIMDE_FLOAT64_C(  112.6100), SIMDE_FLOAT64_C(  465.5100), SIMDE_FLOAT64_C( -593.0000), SIMDE_FLOAT64_C( -581.2500),
+        SIMDE_FLOAT64_C(  -85.2500), SIMDE_FLOAT64_C( -477.0000), SIMDE_FLOAT64_C(  418.3750), SIMDE_FLOAT64_C(  181.3750) } },
+    { { SIMDE_FLOAT64_C( -636.5100), SIMDE_FLOAT64_C( -506.9600), SIMDE_FLOAT64_C(  354.4900), SIMDE_FLOAT64_C( -342.4600),
+        SIMDE_FLOAT64_C(  558.0800), SIMDE_FLOAT64_C( -535.3700), SIMDE_FLOAT64_C( -533.9500), SIMDE_FLOAT64_C( -997.2600) },
+      UINT8_C(238),
+      { SIMDE_FLOAT64_C( -617.6400), SIMDE_FLOAT64_C(   -0.0000), SIMDE_FLOAT64_C( -938.6900), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(  685.0600),        -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(  818.8500), SIMDE_FLOAT64_C(  784.3200) },
+      { SIMDE_FLOAT64_C( -636.5100), SIMDE_FLOAT64_C(   -0.0000), SIMDE_FLOAT64_C( -938.6250), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(  558.0800),        -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(  818.7500), SIMDE_FLOAT64_C(  784.2500) } },
+    { { SIMDE_FLOAT64_C(   85.7400), SIMDE_FLOAT64_C( -296.3300), SIMDE_FLOAT64_C( -131.0100), SIMDE_FLOAT64_C( -445.8200),
+        SIMDE_FLOAT64_C(  257.0000), SIMDE_FLOAT64_C( -547.7000), SIMDE_FLOAT64_C( -157.9400), SIMDE_FLOAT64_C( -610.5900) },
+      UINT8_C(209),
+      { SIMDE_FLOAT64_C( -602.5700), SIMDE_FLOAT64_C(  359.5600), SIMDE_FLOAT64_C(  501.4000), SIMDE_FLOAT64_C(  512.0200),
+        SIMDE_FLOAT64_C( -475.6800), SIMDE_FLOAT64_C( -931.0200), SIMDE_FLOAT64_C( -254.3800), SIMDE_FLOAT64_C( -193.5500) },
+      { SIMDE_FLOAT64_C( -602.5000), SIMDE_FLOAT64_C( -296.3300), SIMDE_FLOAT64_C( -131.0100), SIMDE_FLOAT64_C( -445.8200),
+        SIMDE_FLOAT64_C( -475.6250), SIMDE_FLOAT64_C( -547.7000), SIMDE_FLOAT64_C( -254.3750), SIMDE_FLOAT64_C( -193.5000) } },
+    { { SIMDE_FLOAT64_C( -768.0400), SIMDE_FLOAT64_C( -536.0300), SIMDE_FLOAT64_C( -695.3800), SIMDE_FLOAT64_C( -610.0900),
+        SIMDE_FLOAT64_C(  565.0300), SIMDE_FLOAT64_C(  204.8100), SIMDE_FLOAT64_C(  100.1000), SIMDE_FLOAT64_C( -586.1700) },
+      UINT8_C(213),
+      { SIMDE_FLOAT64_C( -282.7400), SIMDE_FLOAT64_C(  233.5400), SIMDE_FLOAT64_C( -493.5400), SIMDE_FLOAT64_C( -927.3300),
+        SIMDE_FLOAT64_C(    1.0000),         SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(  915.6200), SIMDE_FLOAT64_C(  727.7300) },
+      { SIMDE_FLOAT64_C( -282.6250), SIMDE_FLOAT64_C( -536.0300), SIMDE_FLOAT64_C( -493.5000), SIMDE_FLOAT64_C( -610.0900),
+        SIMDE_FLOAT64_C(    1.0000), SIMDE_FLOAT64_C(  204.8100), SIMDE_FLOAT64_C(  915.5000), SIMDE_FLOAT64_C(  727.6250) } },
+    { { SIMDE_FLOAT64_C( -764.2500), SIMDE_FLOAT64_C(  161.7400), SIMDE_FLOAT64_C( -824.5600), SIMDE_FLOAT64_C( -334.9900),
+        SIMDE_FLOAT64_C( -381.9600), SIMDE_FLOAT64_C(  473.5400), SIMDE_FLOAT64_C(  512.9300), SIMDE_FLOAT64_C( -756.5900) },
+      UINT8_C( 29),
+      { SIMDE_FLOAT64_C( -170.4200), SIMDE_FLOAT64_C(  854.2500), SIMDE_FLOAT64_C(  463.2900), SIMDE_FLOAT64_C( -856.6500),
+        SIMDE_FLOAT64_C(  292.3700), SIMDE_FLOAT64_C( -145.7700), SIMDE_FLOAT64_C(  147.8800), SIMDE_FLOAT64_C( -601.4400) },
+      { SIMDE_FLOAT64_C( -170.3750), SIMDE_FLOAT64_C(  161.7400), SIMDE_FLOAT64_C(  463.2500), SIMDE_FLOAT64_C( -856.6250),
+        SIMDE_FLOAT64_C(  292.2500), SIMDE_FLOAT64_C(  473.5400), SIMDE_FLOAT64_C(  512.9300), SIMDE_FLOAT64_C( -756.5900) } },
+    { { SIMDE_FLOAT64_C(  871.7400), SIMDE_FLOAT64_C( -235.8500), SIMDE_FLOAT64_C(  658.0700), SIMDE_FLOAT64_C( -499.8100),
+        SIMDE_FLOAT64_C( -731.2100), SIMDE_FLOAT64_C(  693.7100), SIMDE_FLOAT64_C(  609.6200), SIMDE_FLOAT64_C(   13.8400) },
+      UINT8_C( 10),
+      { SIMDE_FLOAT64_C(  204.3800), SIMDE_FLOAT64_C(   53.8300), SIMDE_FLOAT64_C(  188.1800), SIMDE_FLOAT64_C(  332.8200),
+        SIMDE_FLOAT64_C(  420.6400), SIMDE_FLOAT64_C(   -0.0000), SIMDE_FLOAT64_C(   48.2500), SIMDE_FLOAT64_C(  394.8800) },
+      { SIMDE_FLOAT64_C(  871.7400), SIMDE_FLOAT64_C(   53.7500), SIMDE_FLOAT64_C(  658.0700), SIMDE_FLOAT64_C(  332.7500),
+        SIMDE_FLOAT64_C( -731.2100), SIMDE_FLOAT64_C(  693.7100), SIMDE_FLOAT64_C(  609.6200), SIMDE_FLOAT64_C(   13.8400) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d src = simde_mm512_loadu_pd(test_vec[i].src);
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_mask_roundscale_pd(src, test_vec[i].k, a, INT32_C(0x33));
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_roundscale_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { UINT8_C( 30),
+      { SIMDE_FLOAT64_C(  -94.5200), SIMDE_FLOAT64_C(  520.1000), SIMDE_FLOAT64_C( -522.2200), SIMDE_FLOAT64_C(  296.9100),
+        SIMDE_FLOAT64_C(  511.1700), SIMDE_FLOAT64_C(   -0.0000), SIMDE_FLOAT64_C(  203.6200),        -SIMDE_MATH_INFINITY },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(  520.0000), SIMDE_FLOAT64_C( -522.0000), SIMDE_FLOAT64_C(  297.0000),
+        SIMDE_FLOAT64_C(  511.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C(130),
+      { SIMDE_FLOAT64_C( -608.9300), SIMDE_FLOAT64_C(  750.4400), SIMDE_FLOAT64_C( -847.5700), SIMDE_FLOAT64_C( -199.1800),
+        SIMDE_FLOAT64_C(   80.9900), SIMDE_FLOAT64_C(  628.7800), SIMDE_FLOAT64_C(  -50.5000),              SIMDE_MATH_NAN },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(  750.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000),              SIMDE_MATH_NAN } },
+    { UINT8_C( 53),
+      { SIMDE_FLOAT64_C(   97.0800), SIMDE_FLOAT64_C( -535.8600), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(  290.9800),
+        SIMDE_FLOAT64_C( -723.9100), SIMDE_FLOAT64_C( -625.2200), SIMDE_FLOAT64_C(  523.5700), SIMDE_FLOAT64_C(  693.1100) },
+      { SIMDE_FLOAT64_C(   97.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C( -724.0000), SIMDE_FLOAT64_C( -625.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C(135),
+      { SIMDE_FLOAT64_C(  916.0000), SIMDE_FLOAT64_C(   -0.0000), SIMDE_FLOAT64_C( -673.7800), SIMDE_FLOAT64_C(  176.3900),
+        SIMDE_FLOAT64_C(  916.6900), SIMDE_FLOAT64_C( -924.7800), SIMDE_FLOAT64_C( -732.1400), SIMDE_FLOAT64_C(  129.9100) },
+      { SIMDE_FLOAT64_C(  916.0000), SIMDE_FLOAT64_C(   -0.0000), SIMDE_FLOAT64_C( -674.0000), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(  130.0000) } },
+    { UINT8_C( 21),
+      { SIMDE_FLOAT64_C(  371.1500), SIMDE_FLOAT64_C(  -54.4600), SIMDE_FLOAT64_C(  538.2900), SIMDE_FLOAT64_C( -312.6100),
+        SIMDE_FLOAT64_C(   93.8900), SIMDE_FLOAT64_C(  210.9800), SIMDE_FLOAT64_C(  200.7300), SIMDE_FLOAT64_C( -803.9900) },
+      { SIMDE_FLOAT64_C(  371.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(  538.0000), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(   94.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C(228),
+      { SIMDE_FLOAT64_C(    1.0000), SIMDE_FLOAT64_C(  753.7000), SIMDE_FLOAT64_C( -260.7700), SIMDE_FLOAT64_C(  160.6200),
+        SIMDE_FLOAT64_C(   -0.0000), SIMDE_FLOAT64_C( -939.4400), SIMDE_FLOAT64_C( -794.6200), SIMDE_FLOAT64_C(   11.6000) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C( -261.0000), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C( -939.0000), SIMDE_FLOAT64_C( -795.0000), SIMDE_FLOAT64_C(   12.0000) } },
+    { UINT8_C(182),
+      { SIMDE_FLOAT64_C(  485.1000), SIMDE_FLOAT64_C( -511.9400), SIMDE_FLOAT64_C(  235.6900), SIMDE_FLOAT64_C(  231.8100),
+        SIMDE_FLOAT64_C(  402.9400), SIMDE_FLOAT64_C(  424.1000), SIMDE_FLOAT64_C(  420.6500), SIMDE_FLOAT64_C( -357.6400) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C( -512.0000), SIMDE_FLOAT64_C(  236.0000), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(  403.0000), SIMDE_FLOAT64_C(  424.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C( -358.0000) } },
+    { UINT8_C(191),
+      { SIMDE_FLOAT64_C( -258.3800), SIMDE_FLOAT64_C( -447.6600), SIMDE_FLOAT64_C( -884.1900), SIMDE_FLOAT64_C(   69.8800),
+                SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C( -344.9400), SIMDE_FLOAT64_C( -184.6100), SIMDE_FLOAT64_C( -211.3500) },
+      { SIMDE_FLOAT64_C( -258.0000), SIMDE_FLOAT64_C( -448.0000), SIMDE_FLOAT64_C( -884.0000), SIMDE_FLOAT64_C(   70.0000),
+                SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C( -345.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C( -211.0000) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_maskz_roundscale_pd(test_vec[i].k, a, INT32_C(0x08));
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_roundscale_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_roundscale_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_roundscale_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_roundscale_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_roundscale_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_roundscale_pd)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,1899 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN rsqrt
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/rsqrt.h>
+
+static int
+test_simde_mm_rsqrt14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  541.6500), SIMDE_FLOAT32_C(  377.4200), SIMDE_FLOAT32_C(  511.1900), SIMDE_FLOAT32_C(  957.3500) },
+      { SIMDE_FLOAT32_C(    0.0430), SIMDE_FLOAT32_C(    0.0515), SIMDE_FLOAT32_C(    0.0442), SIMDE_FLOAT32_C(    0.0323) } },
+    { { SIMDE_FLOAT32_C(  562.8700), SIMDE_FLOAT32_C(  665.6800), SIMDE_FLOAT32_C(  581.4200), SIMDE_FLOAT32_C(  782.2700) },
+      { SIMDE_FLOAT32_C(    0.0422), SIMDE_FLOAT32_C(    0.0388), SIMDE_FLOAT32_C(    0.0415), SIMDE_FLOAT32_C(    0.0358) } },
+    { { SIMDE_FLOAT32_C(  247.1300), SIMDE_FLOAT32_C(  152.6500), SIMDE_FLOAT32_C(  856.8000), SIMDE_FLOAT32_C(  737.1500) },
+      { SIMDE_FLOAT32_C(    0.0636), SIMDE_FLOAT32_C(    0.0809), SIMDE_FLOAT32_C(    0.0342), SIMDE_FLOAT32_C(    0.0368) } },
+    { { SIMDE_FLOAT32_C(  250.8700), SIMDE_FLOAT32_C(  586.1100), SIMDE_FLOAT32_C(  440.1300), SIMDE_FLOAT32_C(   35.5300) },
+      { SIMDE_FLOAT32_C(    0.0631), SIMDE_FLOAT32_C(    0.0413), SIMDE_FLOAT32_C(    0.0477), SIMDE_FLOAT32_C(    0.1678) } },
+    { { SIMDE_FLOAT32_C(  443.5400), SIMDE_FLOAT32_C(  154.8600), SIMDE_FLOAT32_C(  671.2600), SIMDE_FLOAT32_C(  505.5600) },
+      { SIMDE_FLOAT32_C(    0.0475), SIMDE_FLOAT32_C(    0.0804), SIMDE_FLOAT32_C(    0.0386), SIMDE_FLOAT32_C(    0.0445) } },
+    { { SIMDE_FLOAT32_C(  971.3300), SIMDE_FLOAT32_C(  731.4800), SIMDE_FLOAT32_C(   95.3700), SIMDE_FLOAT32_C(  614.0100) },
+      { SIMDE_FLOAT32_C(    0.0321), SIMDE_FLOAT32_C(    0.0370), SIMDE_FLOAT32_C(    0.1024), SIMDE_FLOAT32_C(    0.0404) } },
+    { { SIMDE_FLOAT32_C(  714.9500), SIMDE_FLOAT32_C(  950.1900), SIMDE_FLOAT32_C(  139.6100), SIMDE_FLOAT32_C(  310.3100) },
+      { SIMDE_FLOAT32_C(    0.0374), SIMDE_FLOAT32_C(    0.0324), SIMDE_FLOAT32_C(    0.0846), SIMDE_FLOAT32_C(    0.0568) } },
+    { { SIMDE_FLOAT32_C(  384.9600), SIMDE_FLOAT32_C(  763.1800), SIMDE_FLOAT32_C(  754.0100), SIMDE_FLOAT32_C(  696.0200) },
+      { SIMDE_FLOAT32_C(    0.0510), SIMDE_FLOAT32_C(    0.0362), SIMDE_FLOAT32_C(    0.0364), SIMDE_FLOAT32_C(    0.0379) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_rsqrt14_ps(a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_rsqrt14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[4];
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  504.8700), SIMDE_FLOAT32_C(  801.8600), SIMDE_FLOAT32_C(  296.2700), SIMDE_FLOAT32_C(  705.5500) },
+      UINT8_C(  0),
+      { SIMDE_FLOAT32_C(  351.4500), SIMDE_FLOAT32_C(  253.1200), SIMDE_FLOAT32_C(  291.1000), SIMDE_FLOAT32_C(  810.6400) },
+      { SIMDE_FLOAT32_C(  504.8700), SIMDE_FLOAT32_C(  801.8600), SIMDE_FLOAT32_C(  296.2700), SIMDE_FLOAT32_C(  705.5500) } },
+    { { SIMDE_FLOAT32_C(  892.2400), SIMDE_FLOAT32_C(  188.5900), SIMDE_FLOAT32_C(  426.1600), SIMDE_FLOAT32_C(  883.8900) },
+      UINT8_C(238),
+      { SIMDE_FLOAT32_C(  762.5700), SIMDE_FLOAT32_C(  124.2900), SIMDE_FLOAT32_C(  428.8600), SIMDE_FLOAT32_C(  205.7500) },
+      { SIMDE_FLOAT32_C(  892.2400), SIMDE_FLOAT32_C(    0.0897), SIMDE_FLOAT32_C(    0.0483), SIMDE_FLOAT32_C(    0.0697) } },
+    { { SIMDE_FLOAT32_C(  146.6300), SIMDE_FLOAT32_C(  468.9700), SIMDE_FLOAT32_C(  868.3900), SIMDE_FLOAT32_C(  945.9500) },
+      UINT8_C(141),
+      { SIMDE_FLOAT32_C(  834.8000), SIMDE_FLOAT32_C(  346.6600), SIMDE_FLOAT32_C(  446.7100), SIMDE_FLOAT32_C(  132.5000) },
+      { SIMDE_FLOAT32_C(    0.0346), SIMDE_FLOAT32_C(  468.9700), SIMDE_FLOAT32_C(    0.0473), SIMDE_FLOAT32_C(    0.0869) } },
+    { { SIMDE_FLOAT32_C(  894.9700), SIMDE_FLOAT32_C(  340.5700), SIMDE_FLOAT32_C(  455.1900), SIMDE_FLOAT32_C(  451.9200) },
+      UINT8_C(173),
+      { SIMDE_FLOAT32_C(  711.7700), SIMDE_FLOAT32_C(  439.2200), SIMDE_FLOAT32_C(  317.5900), SIMDE_FLOAT32_C(  910.2300) },
+      { SIMDE_FLOAT32_C(    0.0375), SIMDE_FLOAT32_C(  340.5700), SIMDE_FLOAT32_C(    0.0561), SIMDE_FLOAT32_C(    0.0331) } },
+    { { SIMDE_FLOAT32_C(  383.1000), SIMDE_FLOAT32_C(  209.2000), SIMDE_FLOAT32_C(  596.3900), SIMDE_FLOAT32_C(  148.6200) },
+      UINT8_C(212),
+      { SIMDE_FLOAT32_C(  531.8400), SIMDE_FLOAT32_C(  752.7500), SIMDE_FLOAT32_C(  933.7100), SIMDE_FLOAT32_C(   71.6400) },
+      { SIMDE_FLOAT32_C(  383.1000), SIMDE_FLOAT32_C(  209.2000), SIMDE_FLOAT32_C(    0.0327), SIMDE_FLOAT32_C(  148.6200) } },
+    { { SIMDE_FLOAT32_C(  867.2200), SIMDE_FLOAT32_C(   58.3600), SIMDE_FLOAT32_C(  356.0900), SIMDE_FLOAT32_C(  302.5800) },
+      UINT8_C(132),
+      { SIMDE_FLOAT32_C(  844.5700), SIMDE_FLOAT32_C(  109.4000), SIMDE_FLOAT32_C(  765.8700), SIMDE_FLOAT32_C(  652.8500) },
+      { SIMDE_FLOAT32_C(  867.2200), SIMDE_FLOAT32_C(   58.3600), SIMDE_FLOAT32_C(    0.0361), SIMDE_FLOAT32_C(  302.5800) } },
+    { { SIMDE_FLOAT32_C(  407.7400), SIMDE_FLOAT32_C(  966.5300), SIMDE_FLOAT32_C(   13.8500), SIMDE_FLOAT32_C(  398.7200) },
+      UINT8_C( 19),
+      { SIMDE_FLOAT32_C(  607.5100), SIMDE_FLOAT32_C(  283.0100), SIMDE_FLOAT32_C(  696.4600), SIMDE_FLOAT32_C(   13.7100) },
+      { SIMDE_FLOAT32_C(    0.0406), SIMDE_FLOAT32_C(    0.0594), SIMDE_FLOAT32_C(   13.8500), SIMDE_FLOAT32_C(  398.7200) } },
+    { { SIMDE_FLOAT32_C(  823.8400), SIMDE_FLOAT32_C(  726.9700), SIMDE_FLOAT32_C(  347.9900), SIMDE_FLOAT32_C(  884.7100) },
+      UINT8_C(238),
+      { SIMDE_FLOAT32_C(  925.4800), SIMDE_FLOAT32_C(   42.8600), SIMDE_FLOAT32_C(  626.0100), SIMDE_FLOAT32_C(  436.0600) },
+      { SIMDE_FLOAT32_C(  823.8400), SIMDE_FLOAT32_C(    0.1527), SIMDE_FLOAT32_C(    0.0400), SIMDE_FLOAT32_C(    0.0479) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 src = simde_mm_loadu_ps(test_vec[i].src);
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_mask_rsqrt14_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_rsqrt14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { UINT8_C( 87),
+      { SIMDE_FLOAT32_C(  450.5300), SIMDE_FLOAT32_C(  947.0400), SIMDE_FLOAT32_C(  572.0600), SIMDE_FLOAT32_C(  288.9500) },
+      { SIMDE_FLOAT32_C(    0.0471), SIMDE_FLOAT32_C(    0.0325), SIMDE_FLOAT32_C(    0.0418), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT8_C( 91),
+      { SIMDE_FLOAT32_C(  922.4400), SIMDE_FLOAT32_C(  905.5700), SIMDE_FLOAT32_C(  914.3000), SIMDE_FLOAT32_C(  300.0200) },
+      { SIMDE_FLOAT32_C(    0.0329), SIMDE_FLOAT32_C(    0.0332), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0577) } },
+    { UINT8_C( 19),
+      { SIMDE_FLOAT32_C(   53.7000), SIMDE_FLOAT32_C(  653.9800), SIMDE_FLOAT32_C(  118.3900), SIMDE_FLOAT32_C(  519.4400) },
+      { SIMDE_FLOAT32_C(    0.1365), SIMDE_FLOAT32_C(    0.0391), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT8_C( 99),
+      { SIMDE_FLOAT32_C(   33.5800), SIMDE_FLOAT32_C(  258.1800), SIMDE_FLOAT32_C(   78.3400), SIMDE_FLOAT32_C(  905.3400) },
+      { SIMDE_FLOAT32_C(    0.1726), SIMDE_FLOAT32_C(    0.0622), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT8_C(208),
+      { SIMDE_FLOAT32_C(  773.7500), SIMDE_FLOAT32_C(  804.6400), SIMDE_FLOAT32_C(   64.4900), SIMDE_FLOAT32_C(  459.7900) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT8_C(208),
+      { SIMDE_FLOAT32_C(  339.3200), SIMDE_FLOAT32_C(  736.9100), SIMDE_FLOAT32_C(  100.3700), SIMDE_FLOAT32_C(  110.5100) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT8_C( 43),
+      { SIMDE_FLOAT32_C(  662.1100), SIMDE_FLOAT32_C(   73.7500), SIMDE_FLOAT32_C(  396.7200), SIMDE_FLOAT32_C(  860.9900) },
+      { SIMDE_FLOAT32_C(    0.0389), SIMDE_FLOAT32_C(    0.1164), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0341) } },
+    { UINT8_C( 77),
+      { SIMDE_FLOAT32_C(  370.3600), SIMDE_FLOAT32_C(   36.4000), SIMDE_FLOAT32_C(  738.2600), SIMDE_FLOAT32_C(  536.5900) },
+      { SIMDE_FLOAT32_C(    0.0520), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0368), SIMDE_FLOAT32_C(    0.0432) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 r = simde_mm_maskz_rsqrt14_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_rsqrt14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  166.6800), SIMDE_FLOAT64_C(  924.9400) },
+      { SIMDE_FLOAT64_C(    0.0775), SIMDE_FLOAT64_C(    0.0329) } },
+    { { SIMDE_FLOAT64_C(  105.4100), SIMDE_FLOAT64_C(  985.6500) },
+      { SIMDE_FLOAT64_C(    0.0974), SIMDE_FLOAT64_C(    0.0319) } },
+    { { SIMDE_FLOAT64_C(  707.7000), SIMDE_FLOAT64_C(  177.0600) },
+      { SIMDE_FLOAT64_C(    0.0376), SIMDE_FLOAT64_C(    0.0752) } },
+    { { SIMDE_FLOAT64_C(  655.0000), SIMDE_FLOAT64_C(  539.0000) },
+      { SIMDE_FLOAT64_C(    0.0391), SIMDE_FLOAT64_C(    0.0431) } },
+    { { SIMDE_FLOAT64_C(  138.7500), SIMDE_FLOAT64_C(  211.1100) },
+      { SIMDE_FLOAT64_C(    0.0849), SIMDE_FLOAT64_C(    0.0688) } },
+    { { SIMDE_FLOAT64_C(  152.7000), SIMDE_FLOAT64_C(   86.8800) },
+      { SIMDE_FLOAT64_C(    0.0809), SIMDE_FLOAT64_C(    0.1073) } },
+    { { SIMDE_FLOAT64_C(  572.4000), SIMDE_FLOAT64_C(  610.2800) },
+      { SIMDE_FLOAT64_C(    0.0418), SIMDE_FLOAT64_C(    0.0405) } },
+    { { SIMDE_FLOAT64_C(    8.8600), SIMDE_FLOAT64_C(  938.6400) },
+      { SIMDE_FLOAT64_C(    0.3360), SIMDE_FLOAT64_C(    0.0326) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_rsqrt14_pd(a);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_rsqrt14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[2];
+    const simde__mmask8 k;
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(   30.1300), SIMDE_FLOAT64_C(  593.1300) },
+      UINT8_C(102),
+      { SIMDE_FLOAT64_C(  737.4600), SIMDE_FLOAT64_C(  482.8300) },
+      { SIMDE_FLOAT64_C(   30.1300), SIMDE_FLOAT64_C(    0.0455) } },
+    { { SIMDE_FLOAT64_C(   79.5800), SIMDE_FLOAT64_C(  954.0500) },
+      UINT8_C( 45),
+      { SIMDE_FLOAT64_C(  617.1100), SIMDE_FLOAT64_C(    8.7900) },
+      { SIMDE_FLOAT64_C(    0.0403), SIMDE_FLOAT64_C(  954.0500) } },
+    { { SIMDE_FLOAT64_C(  781.2200), SIMDE_FLOAT64_C(  260.8900) },
+      UINT8_C( 95),
+      { SIMDE_FLOAT64_C(  277.6300), SIMDE_FLOAT64_C(  842.2300) },
+      { SIMDE_FLOAT64_C(    0.0600), SIMDE_FLOAT64_C(    0.0345) } },
+    { { SIMDE_FLOAT64_C(  960.8500), SIMDE_FLOAT64_C(  121.9500) },
+      UINT8_C( 50),
+      { SIMDE_FLOAT64_C(   61.5900), SIMDE_FLOAT64_C(  751.6700) },
+      { SIMDE_FLOAT64_C(  960.8500), SIMDE_FLOAT64_C(    0.0365) } },
+    { { SIMDE_FLOAT64_C(   41.2800), SIMDE_FLOAT64_C(  584.1700) },
+      UINT8_C( 23),
+      { SIMDE_FLOAT64_C(  767.3400), SIMDE_FLOAT64_C(  766.6100) },
+      { SIMDE_FLOAT64_C(    0.0361), SIMDE_FLOAT64_C(    0.0361) } },
+    { { SIMDE_FLOAT64_C(    6.2200), SIMDE_FLOAT64_C(  347.1300) },
+      UINT8_C(109),
+      { SIMDE_FLOAT64_C(  258.7200), SIMDE_FLOAT64_C(  761.5600) },
+      { SIMDE_FLOAT64_C(    0.0622), SIMDE_FLOAT64_C(  347.1300) } },
+    { { SIMDE_FLOAT64_C(  619.2400), SIMDE_FLOAT64_C(  606.6700) },
+      UINT8_C(182),
+      { SIMDE_FLOAT64_C(  203.8200), SIMDE_FLOAT64_C(  271.5000) },
+      { SIMDE_FLOAT64_C(  619.2400), SIMDE_FLOAT64_C(    0.0607) } },
+    { { SIMDE_FLOAT64_C(  833.6400), SIMDE_FLOAT64_C(  684.7900) },
+      UINT8_C( 53),
+      { SIMDE_FLOAT64_C(  574.6900), SIMDE_FLOAT64_C(  865.2900) },
+      { SIMDE_FLOAT64_C(    0.0417), SIMDE_FLOAT64_C(  684.7900) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d src = simde_mm_loadu_pd(test_vec[i].src);
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_mask_rsqrt14_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_rsqrt14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { UINT8_C(191),
+      { SIMDE_FLOAT64_C(  316.6900), SIMDE_FLOAT64_C(  130.5400) },
+      { SIMDE_FLOAT64_C(    0.0562), SIMDE_FLOAT64_C(    0.0875) } },
+    { UINT8_C( 99),
+      { SIMDE_FLOAT64_C(  833.0500), SIMDE_FLOAT64_C(    6.3100) },
+      { SIMDE_FLOAT64_C(    0.0346), SIMDE_FLOAT64_C(    0.3981) } },
+    { UINT8_C(196),
+      { SIMDE_FLOAT64_C(  412.1400), SIMDE_FLOAT64_C(  964.5300) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C( 33),
+      { SIMDE_FLOAT64_C(  499.7000), SIMDE_FLOAT64_C(  612.3300) },
+      { SIMDE_FLOAT64_C(    0.0447), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C( 21),
+      { SIMDE_FLOAT64_C(  439.9700), SIMDE_FLOAT64_C(  269.9100) },
+      { SIMDE_FLOAT64_C(    0.0477), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C( 56),
+      { SIMDE_FLOAT64_C(  600.0600), SIMDE_FLOAT64_C(  859.5700) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C( 39),
+      { SIMDE_FLOAT64_C(  638.4000), SIMDE_FLOAT64_C(  761.5100) },
+      { SIMDE_FLOAT64_C(    0.0396), SIMDE_FLOAT64_C(    0.0362) } },
+    { UINT8_C(222),
+      { SIMDE_FLOAT64_C(  624.9500), SIMDE_FLOAT64_C(   25.4500) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.1982) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d r = simde_mm_maskz_rsqrt14_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_rsqrt14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  884.9000), SIMDE_FLOAT32_C(  153.0100), SIMDE_FLOAT32_C(  336.5800), SIMDE_FLOAT32_C(  381.5400),
+        SIMDE_FLOAT32_C(  980.1800), SIMDE_FLOAT32_C(   73.7300), SIMDE_FLOAT32_C(  221.8500), SIMDE_FLOAT32_C(  663.9200) },
+      { SIMDE_FLOAT32_C(    0.0336), SIMDE_FLOAT32_C(    0.0808), SIMDE_FLOAT32_C(    0.0545), SIMDE_FLOAT32_C(    0.0512),
+        SIMDE_FLOAT32_C(    0.0319), SIMDE_FLOAT32_C(    0.1165), SIMDE_FLOAT32_C(    0.0671), SIMDE_FLOAT32_C(    0.0388) } },
+    { { SIMDE_FLOAT32_C(  251.5000), SIMDE_FLOAT32_C(  524.7200), SIMDE_FLOAT32_C(  451.3800), SIMDE_FLOAT32_C(  650.8200),
+        SIMDE_FLOAT32_C(   92.7600), SIMDE_FLOAT32_C(  261.9100), SIMDE_FLOAT32_C(    4.7500), SIMDE_FLOAT32_C(  716.9100) },
+      { SIMDE_FLOAT32_C(    0.0631), SIMDE_FLOAT32_C(    0.0437), SIMDE_FLOAT32_C(    0.0471), SIMDE_FLOAT32_C(    0.0392),
+        SIMDE_FLOAT32_C(    0.1038), SIMDE_FLOAT32_C(    0.0618), SIMDE_FLOAT32_C(    0.4588), SIMDE_FLOAT32_C(    0.0373) } },
+    { { SIMDE_FLOAT32_C(   95.2300), SIMDE_FLOAT32_C(  615.3400), SIMDE_FLOAT32_C(  927.1300), SIMDE_FLOAT32_C(  193.3600),
+        SIMDE_FLOAT32_C(  355.8200), SIMDE_FLOAT32_C(  986.3400), SIMDE_FLOAT32_C(  704.9500), SIMDE_FLOAT32_C(  274.1600) },
+      { SIMDE_FLOAT32_C(    0.1025), SIMDE_FLOAT32_C(    0.0403), SIMDE_FLOAT32_C(    0.0328), SIMDE_FLOAT32_C(    0.0719),
+        SIMDE_FLOAT32_C(    0.0530), SIMDE_FLOAT32_C(    0.0318), SIMDE_FLOAT32_C(    0.0377), SIMDE_FLOAT32_C(    0.0604) } },
+    { { SIMDE_FLOAT32_C(  800.4000), SIMDE_FLOAT32_C(   86.0500), SIMDE_FLOAT32_C(   14.4500), SIMDE_FLOAT32_C(  390.9700),
+        SIMDE_FLOAT32_C(  876.3800), SIMDE_FLOAT32_C(  368.0700), SIMDE_FLOAT32_C(  627.7000), SIMDE_FLOAT32_C(  459.3800) },
+      { SIMDE_FLOAT32_C(    0.0353), SIMDE_FLOAT32_C(    0.1078), SIMDE_FLOAT32_C(    0.2631), SIMDE_FLOAT32_C(    0.0506),
+        SIMDE_FLOAT32_C(    0.0338), SIMDE_FLOAT32_C(    0.0521), SIMDE_FLOAT32_C(    0.0399), SIMDE_FLOAT32_C(    0.0467) } },
+    { { SIMDE_FLOAT32_C(  378.3800), SIMDE_FLOAT32_C(  347.6200), SIMDE_FLOAT32_C(  795.7000), SIMDE_FLOAT32_C(  801.2000),
+        SIMDE_FLOAT32_C(  335.6200), SIMDE_FLOAT32_C(  516.6100), SIMDE_FLOAT32_C(  603.6400), SIMDE_FLOAT32_C(  671.5200) },
+      { SIMDE_FLOAT32_C(    0.0514), SIMDE_FLOAT32_C(    0.0536), SIMDE_FLOAT32_C(    0.0355), SIMDE_FLOAT32_C(    0.0353),
+        SIMDE_FLOAT32_C(    0.0546), SIMDE_FLOAT32_C(    0.0440), SIMDE_FLOAT32_C(    0.0407), SIMDE_FLOAT32_C(    0.0386) } },
+    { { SIMDE_FLOAT32_C(  537.2200), SIMDE_FLOAT32_C(  257.7300), SIMDE_FLOAT32_C(  176.3300), SIMDE_FLOAT32_C(  241.6400),
+        SIMDE_FLOAT32_C(   37.1000), SIMDE_FLOAT32_C(  500.9700), SIMDE_FLOAT32_C(  830.8700), SIMDE_FLOAT32_C(  977.2600) },
+      { SIMDE_FLOAT32_C(    0.0431), SIMDE_FLOAT32_C(    0.0623), SIMDE_FLOAT32_C(    0.0753), SIMDE_FLOAT32_C(    0.0643),
+        SIMDE_FLOAT32_C(    0.1642), SIMDE_FLOAT32_C(    0.0447), SIMDE_FLOAT32_C(    0.0347), SIMDE_FLOAT32_C(    0.0320) } },
+    { { SIMDE_FLOAT32_C(  767.9900), SIMDE_FLOAT32_C(  178.3200), SIMDE_FLOAT32_C(  973.1400), SIMDE_FLOAT32_C(  366.7900),
+        SIMDE_FLOAT32_C(  356.4300), SIMDE_FLOAT32_C(   80.9300), SIMDE_FLOAT32_C(  223.5700), SIMDE_FLOAT32_C(  493.1800) },
+      { SIMDE_FLOAT32_C(    0.0361), SIMDE_FLOAT32_C(    0.0749), SIMDE_FLOAT32_C(    0.0321), SIMDE_FLOAT32_C(    0.0522),
+        SIMDE_FLOAT32_C(    0.0530), SIMDE_FLOAT32_C(    0.1112), SIMDE_FLOAT32_C(    0.0669), SIMDE_FLOAT32_C(    0.0450) } },
+    { { SIMDE_FLOAT32_C(   43.5000), SIMDE_FLOAT32_C(  890.7500), SIMDE_FLOAT32_C(  966.4100), SIMDE_FLOAT32_C(  745.6100),
+        SIMDE_FLOAT32_C(   65.4200), SIMDE_FLOAT32_C(  811.4900), SIMDE_FLOAT32_C(  659.7200), SIMDE_FLOAT32_C(  244.9900) },
+      { SIMDE_FLOAT32_C(    0.1516), SIMDE_FLOAT32_C(    0.0335), SIMDE_FLOAT32_C(    0.0322), SIMDE_FLOAT32_C(    0.0366),
+        SIMDE_FLOAT32_C(    0.1236), SIMDE_FLOAT32_C(    0.0351), SIMDE_FLOAT32_C(    0.0389), SIMDE_FLOAT32_C(    0.0639) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m256 r = simde_mm256_rsqrt14_ps(a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_rsqrt14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[8];
+    const simde__mmask8 k;
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  844.3200), SIMDE_FLOAT32_C(  684.9600), SIMDE_FLOAT32_C(  738.4200), SIMDE_FLOAT32_C(  384.3100),
+        SIMDE_FLOAT32_C(  185.1100), SIMDE_FLOAT32_C(  376.9400), SIMDE_FLOAT32_C(  504.2700), SIMDE_FLOAT32_C(  543.0000) },
+      UINT8_C(250),
+      { SIMDE_FLOAT32_C(  472.6600), SIMDE_FLOAT32_C(  198.1100), SIMDE_FLOAT32_C(   59.1600), SIMDE_FLOAT32_C(   17.5800),
+        SIMDE_FLOAT32_C(  194.2800), SIMDE_FLOAT32_C(  347.7600), SIMDE_FLOAT32_C(  838.8700), SIMDE_FLOAT32_C(   52.5500) },
+      { SIMDE_FLOAT32_C(  844.3200), SIMDE_FLOAT32_C(    0.0710), SIMDE_FLOAT32_C(  738.4200), SIMDE_FLOAT32_C(    0.2385),
+        SIMDE_FLOAT32_C(    0.0717), SIMDE_FLOAT32_C(    0.0536), SIMDE_FLOAT32_C(    0.0345), SIMDE_FLOAT32_C(    0.1379) } },
+    { { SIMDE_FLOAT32_C(  591.2800), SIMDE_FLOAT32_C(   89.5500), SIMDE_FLOAT32_C(  175.0600), SIMDE_FLOAT32_C(  784.4000),
+        SIMDE_FLOAT32_C(   18.6000), SIMDE_FLOAT32_C(   66.4300), SIMDE_FLOAT32_C(  624.2900), SIMDE_FLOAT32_C(  138.8200) },
+      UINT8_C(121),
+      { SIMDE_FLOAT32_C(  324.5400), SIMDE_FLOAT32_C(  531.3200), SIMDE_FLOAT32_C(  137.6000), SIMDE_FLOAT32_C(  513.2400),
+        SIMDE_FLOAT32_C(  935.1200), SIMDE_FLOAT32_C(  723.3400), SIMDE_FLOAT32_C(  598.8300), SIMDE_FLOAT32_C(  335.9100) },
+      { SIMDE_FLOAT32_C(    0.0555), SIMDE_FLOAT32_C(   89.5500), SIMDE_FLOAT32_C(  175.0600), SIMDE_FLOAT32_C(    0.0441),
+        SIMDE_FLOAT32_C(    0.0327), SIMDE_FLOAT32_C(    0.0372), SIMDE_FLOAT32_C(    0.0409), SIMDE_FLOAT32_C(  138.8200) } },
+    { { SIMDE_FLOAT32_C(  512.8200), SIMDE_FLOAT32_C(  581.4700), SIMDE_FLOAT32_C(  169.8000), SIMDE_FLOAT32_C(  441.2700),
+        SIMDE_FLOAT32_C(  598.0700), SIMDE_FLOAT32_C(  895.1400), SIMDE_FLOAT32_C(  624.2100), SIMDE_FLOAT32_C(  535.2900) },
+      UINT8_C(178),
+      { SIMDE_FLOAT32_C(  292.3700), SIMDE_FLOAT32_C(   62.3700), SIMDE_FLOAT32_C(  655.4000), SIMDE_FLOAT32_C(  138.0900),
+        SIMDE_FLOAT32_C(  688.9300), SIMDE_FLOAT32_C(  672.3400), SIMDE_FLOAT32_C(  365.0300), SIMDE_FLOAT32_C(  233.6500) },
+      { SIMDE_FLOAT32_C(  512.8200), SIMDE_FLOAT32_C(    0.1266), SIMDE_FLOAT32_C(  169.8000), SIMDE_FLOAT32_C(  441.2700),
+        SIMDE_FLOAT32_C(    0.0381), SIMDE_FLOAT32_C(    0.0386), SIMDE_FLOAT32_C(  624.2100), SIMDE_FLOAT32_C(    0.0654) } },
+    { { SIMDE_FLOAT32_C(  707.0100), SIMDE_FLOAT32_C(  832.0700), SIMDE_FLOAT32_C(  395.4400), SIMDE_FLOAT32_C(  479.3900),
+        SIMDE_FLOAT32_C(  829.8000), SIMDE_FLOAT32_C(  803.9300), SIMDE_FLOAT32_C(  418.5800), SIMDE_FLOAT32_C(  494.3800) },
+      UINT8_C( 66),
+      { SIMDE_FLOAT32_C(  727.3200), SIMDE_FLOAT32_C(  335.9500), SIMDE_FLOAT32_C(  967.2900), SIMDE_FLOAT32_C(  501.1900),
+        SIMDE_FLOAT32_C(  467.7300), SIMDE_FLOAT32_C(  463.0100), SIMDE_FLOAT32_C(  817.5400), SIMDE_FLOAT32_C(  516.4200) },
+      { SIMDE_FLOAT32_C(  707.0100), SIMDE_FLOAT32_C(    0.0546), SIMDE_FLOAT32_C(  395.4400), SIMDE_FLOAT32_C(  479.3900),
+        SIMDE_FLOAT32_C(  829.8000), SIMDE_FLOAT32_C(  803.9300), SIMDE_FLOAT32_C(    0.0350), SIMDE_FLOAT32_C(  494.3800) } },
+    { { SIMDE_FLOAT32_C(  110.7800), SIMDE_FLOAT32_C(   53.4600), SIMDE_FLOAT32_C(  872.7100), SIMDE_FLOAT32_C(  213.0800),
+        SIMDE_FLOAT32_C(  885.3800), SIMDE_FLOAT32_C(  887.2600), SIMDE_FLOAT32_C(   13.6000), SIMDE_FLOAT32_C(   72.5200) },
+      UINT8_C(180),
+      { SIMDE_FLOAT32_C(  602.6000), SIMDE_FLOAT32_C(  458.5200), SIMDE_FLOAT32_C(  342.2100), SIMDE_FLOAT32_C(  857.7600),
+        SIMDE_FLOAT32_C(   60.5400), SIMDE_FLOAT32_C(  933.1800), SIMDE_FLOAT32_C(  240.6000), SIMDE_FLOAT32_C(  957.3200) },
+      { SIMDE_FLOAT32_C(  110.7800), SIMDE_FLOAT32_C(   53.4600), SIMDE_FLOAT32_C(    0.0541), SIMDE_FLOAT32_C(  213.0800),
+        SIMDE_FLOAT32_C(    0.1285), SIMDE_FLOAT32_C(    0.0327), SIMDE_FLOAT32_C(   13.6000), SIMDE_FLOAT32_C(    0.0323) } },
+    { { SIMDE_FLOAT32_C(   19.7500), SIMDE_FLOAT32_C(  767.4500), SIMDE_FLOAT32_C(  155.9300), SIMDE_FLOAT32_C(  480.6600),
+        SIMDE_FLOAT32_C(  628.9700), SIMDE_FLOAT32_C(  102.2400), SIMDE_FLOAT32_C(  842.8800), SIMDE_FLOAT32_C(  650.7700) },
+      UINT8_C(187),
+      { SIMDE_FLOAT32_C(  610.1300), SIMDE_FLOAT32_C(  526.6500), SIMDE_FLOAT32_C(  681.2100), SIMDE_FLOAT32_C(  290.6500),
+        SIMDE_FLOAT32_C(  351.4200), SIMDE_FLOAT32_C(   47.5600), SIMDE_FLOAT32_C(  836.3300), SIMDE_FLOAT32_C(  579.0300) },
+      { SIMDE_FLOAT32_C(    0.0405), SIMDE_FLOAT32_C(    0.0436), SIMDE_FLOAT32_C(  155.9300), SIMDE_FLOAT32_C(    0.0587),
+        SIMDE_FLOAT32_C(    0.0533), SIMDE_FLOAT32_C(    0.1450), SIMDE_FLOAT32_C(  842.8800), SIMDE_FLOAT32_C(    0.0416) } },
+    { { SIMDE_FLOAT32_C(  877.7100), SIMDE_FLOAT32_C(  528.6800), SIMDE_FLOAT32_C(  499.1700), SIMDE_FLOAT32_C(  431.6600),
+        SIMDE_FLOAT32_C(  485.4800), SIMDE_FLOAT32_C(  224.8000), SIMDE_FLOAT32_C(  277.7200), SIMDE_FLOAT32_C(  640.4100) },
+      UINT8_C(149),
+      { SIMDE_FLOAT32_C(  276.1100), SIMDE_FLOAT32_C(   44.7900), SIMDE_FLOAT32_C(  560.9100), SIMDE_FLOAT32_C(  345.1300),
+        SIMDE_FLOAT32_C(    4.1500), SIMDE_FLOAT32_C(  341.7700), SIMDE_FLOAT32_C(  369.2400), SIMDE_FLOAT32_C(  501.6800) },
+      { SIMDE_FLOAT32_C(    0.0602), SIMDE_FLOAT32_C(  528.6800), SIMDE_FLOAT32_C(    0.0422), SIMDE_FLOAT32_C(  431.6600),
+        SIMDE_FLOAT32_C(    0.4909), SIMDE_FLOAT32_C(  224.8000), SIMDE_FLOAT32_C(  277.7200), SIMDE_FLOAT32_C(    0.0446) } },
+    { { SIMDE_FLOAT32_C(  404.8200), SIMDE_FLOAT32_C(  224.3700), SIMDE_FLOAT32_C(  626.3600), SIMDE_FLOAT32_C(  177.6700),
+        SIMDE_FLOAT32_C(  582.0300), SIMDE_FLOAT32_C(    6.5100), SIMDE_FLOAT32_C(  247.4700), SIMDE_FLOAT32_C(  836.3000) },
+      UINT8_C( 91),
+      { SIMDE_FLOAT32_C(  907.3700), SIMDE_FLOAT32_C(  953.8100), SIMDE_FLOAT32_C(   42.4600), SIMDE_FLOAT32_C(  525.2000),
+        SIMDE_FLOAT32_C(  271.6200), SIMDE_FLOAT32_C(  260.1300), SIMDE_FLOAT32_C(  182.0100), SIMDE_FLOAT32_C(  861.4200) },
+      { SIMDE_FLOAT32_C(    0.0332), SIMDE_FLOAT32_C(    0.0324), SIMDE_FLOAT32_C(  626.3600), SIMDE_FLOAT32_C(    0.0436),
+        SIMDE_FLOAT32_C(    0.0607), SIMDE_FLOAT32_C(    6.5100), SIMDE_FLOAT32_C(    0.0741), SIMDE_FLOAT32_C(  836.3000) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 src = simde_mm256_loadu_ps(test_vec[i].src);
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m256 r = simde_mm256_mask_rsqrt14_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_rsqrt14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float32 a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { UINT8_C( 39),
+      { SIMDE_FLOAT32_C(  317.6000), SIMDE_FLOAT32_C(  240.2200), SIMDE_FLOAT32_C(  975.2300), SIMDE_FLOAT32_C(  211.2300),
+        SIMDE_FLOAT32_C(  857.3400), SIMDE_FLOAT32_C(  925.9400), SIMDE_FLOAT32_C(  967.0700), SIMDE_FLOAT32_C(  399.4100) },
+      { SIMDE_FLOAT32_C(    0.0561), SIMDE_FLOAT32_C(    0.0645), SIMDE_FLOAT32_C(    0.0320), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0329), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT8_C(131),
+      { SIMDE_FLOAT32_C(  701.2000), SIMDE_FLOAT32_C(   61.9200), SIMDE_FLOAT32_C(  664.2800), SIMDE_FLOAT32_C(  327.5900),
+        SIMDE_FLOAT32_C(  899.1600), SIMDE_FLOAT32_C(  480.5700), SIMDE_FLOAT32_C(  473.5300), SIMDE_FLOAT32_C(  657.1400) },
+      { SIMDE_FLOAT32_C(    0.0378), SIMDE_FLOAT32_C(    0.1271), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0390) } },
+    { UINT8_C(155),
+      { SIMDE_FLOAT32_C(  889.3900), SIMDE_FLOAT32_C(  669.1600), SIMDE_FLOAT32_C(  929.1400), SIMDE_FLOAT32_C(  878.7800),
+        SIMDE_FLOAT32_C(  416.2200), SIMDE_FLOAT32_C(  936.4600), SIMDE_FLOAT32_C(  711.7700), SIMDE_FLOAT32_C(   56.0500) },
+      { SIMDE_FLOAT32_C(    0.0335), SIMDE_FLOAT32_C(    0.0387), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0337),
+        SIMDE_FLOAT32_C(    0.0490), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.1336) } },
+    { UINT8_C(216),
+      { SIMDE_FLOAT32_C(  889.8900), SIMDE_FLOAT32_C(  793.6000), SIMDE_FLOAT32_C(  394.4400), SIMDE_FLOAT32_C(   60.9000),
+        SIMDE_FLOAT32_C(  788.0000), SIMDE_FLOAT32_C(  347.2200), SIMDE_FLOAT32_C(  109.1200), SIMDE_FLOAT32_C(   21.6300) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.1281),
+        SIMDE_FLOAT32_C(    0.0356), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0957), SIMDE_FLOAT32_C(    0.2150) } },
+    { UINT8_C(210),
+      { SIMDE_FLOAT32_C(  354.9200), SIMDE_FLOAT32_C(  927.4600), SIMDE_FLOAT32_C(  947.8700), SIMDE_FLOAT32_C(  435.3400),
+        SIMDE_FLOAT32_C(  629.9500), SIMDE_FLOAT32_C(  877.1000), SIMDE_FLOAT32_C(  249.1700), SIMDE_FLOAT32_C(  169.8700) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0328), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0398), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0634), SIMDE_FLOAT32_C(    0.0767) } },
+    { UINT8_C(214),
+      { SIMDE_FLOAT32_C(  187.4300), SIMDE_FLOAT32_C(  134.2700), SIMDE_FLOAT32_C(  708.9900), SIMDE_FLOAT32_C(  575.2000),
+        SIMDE_FLOAT32_C(  704.7200), SIMDE_FLOAT32_C(  725.3300), SIMDE_FLOAT32_C(  628.5900), SIMDE_FLOAT32_C(  538.1600) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0863), SIMDE_FLOAT32_C(    0.0376), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0377), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0399), SIMDE_FLOAT32_C(    0.0431) } },
+    { UINT8_C(206),
+      { SIMDE_FLOAT32_C(   91.4700), SIMDE_FLOAT32_C(  660.7600), SIMDE_FLOAT32_C(  520.3400), SIMDE_FLOAT32_C(  249.9200),
+        SIMDE_FLOAT32_C(  452.7900), SIMDE_FLOAT32_C(  325.1900), SIMDE_FLOAT32_C(  168.2200), SIMDE_FLOAT32_C(   53.3700) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0389), SIMDE_FLOAT32_C(    0.0438), SIMDE_FLOAT32_C(    0.0633),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0771), SIMDE_FLOAT32_C(    0.1369) } },
+    { UINT8_C(103),
+      { SIMDE_FLOAT32_C(  896.0500), SIMDE_FLOAT32_C(  177.4600), SIMDE_FLOAT32_C(  175.1500), SIMDE_FLOAT32_C(  670.1200),
+        SIMDE_FLOAT32_C(  271.4200), SIMDE_FLOAT32_C(  453.9500), SIMDE_FLOAT32_C(  889.5900), SIMDE_FLOAT32_C(  882.1600) },
+      { SIMDE_FLOAT32_C(    0.0334), SIMDE_FLOAT32_C(    0.0751), SIMDE_FLOAT32_C(    0.0756), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0469), SIMDE_FLOAT32_C(    0.0335), SIMDE_FLOAT32_C(    0.0000) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde__m256 r = simde_mm256_maskz_rsqrt14_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_rsqrt14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  518.5000), SIMDE_FLOAT64_C(  709.3000), SIMDE_FLOAT64_C(  524.5900), SIMDE_FLOAT64_C(  273.5600) },
+      { SIMDE_FLOAT64_C(    0.0439), SIMDE_FLOAT64_C(    0.0375), SIMDE_FLOAT64_C(    0.0437), SIMDE_FLOAT64_C(    0.0605) } },
+    { { SIMDE_FLOAT64_C(  308.4400), SIMDE_FLOAT64_C(  680.3300), SIMDE_FLOAT64_C(  784.5900), SIMDE_FLOAT64_C(  718.5500) },
+      { SIMDE_FLOAT64_C(    0.0569), SIMDE_FLOAT64_C(    0.0383), SIMDE_FLOAT64_C(    0.0357), SIMDE_FLOAT64_C(    0.0373) } },
+    { { SIMDE_FLOAT64_C(  734.9200), SIMDE_FLOAT64_C(  455.3200), SIMDE_FLOAT64_C(   12.6200), SIMDE_FLOAT64_C(  358.5000) },
+      { SIMDE_FLOAT64_C(    0.0369), SIMDE_FLOAT64_C(    0.0469), SIMDE_FLOAT64_C(    0.2815), SIMDE_FLOAT64_C(    0.0528) } },
+    { { SIMDE_FLOAT64_C(  441.9400), SIMDE_FLOAT64_C(  708.6000), SIMDE_FLOAT64_C(  127.9800), SIMDE_FLOAT64_C(  819.4900) },
+      { SIMDE_FLOAT64_C(    0.0476), SIMDE_FLOAT64_C(    0.0376), SIMDE_FLOAT64_C(    0.0884), SIMDE_FLOAT64_C(    0.0349) } },
+    { { SIMDE_FLOAT64_C(  292.5700), SIMDE_FLOAT64_C(  784.7900), SIMDE_FLOAT64_C(  442.4700), SIMDE_FLOAT64_C(  877.9400) },
+      { SIMDE_FLOAT64_C(    0.0585), SIMDE_FLOAT64_C(    0.0357), SIMDE_FLOAT64_C(    0.0475), SIMDE_FLOAT64_C(    0.0337) } },
+    { { SIMDE_FLOAT64_C(  144.1900), SIMDE_FLOAT64_C(  612.9500), SIMDE_FLOAT64_C(  807.4200), SIMDE_FLOAT64_C(  771.3100) },
+      { SIMDE_FLOAT64_C(    0.0833), SIMDE_FLOAT64_C(    0.0404), SIMDE_FLOAT64_C(    0.0352), SIMDE_FLOAT64_C(    0.0360) } },
+    { { SIMDE_FLOAT64_C(  490.9800), SIMDE_FLOAT64_C(  300.5000), SIMDE_FLOAT64_C(  666.3000), SIMDE_FLOAT64_C(  927.8900) },
+      { SIMDE_FLOAT64_C(    0.0451), SIMDE_FLOAT64_C(    0.0577), SIMDE_FLOAT64_C(    0.0387), SIMDE_FLOAT64_C(    0.0328) } },
+    { { SIMDE_FLOAT64_C(  109.6600), SIMDE_FLOAT64_C(  699.5800), SIMDE_FLOAT64_C(  335.2000), SIMDE_FLOAT64_C(  893.7600) },
+      { SIMDE_FLOAT64_C(    0.0955), SIMDE_FLOAT64_C(    0.0378), SIMDE_FLOAT64_C(    0.0546), SIMDE_FLOAT64_C(    0.0334) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde__m256d r = simde_mm256_rsqrt14_pd(a);
+    simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_rsqrt14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[4];
+    const simde__mmask8 k;
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  139.6600), SIMDE_FLOAT64_C(  930.4000), SIMDE_FLOAT64_C(  132.6900), SIMDE_FLOAT64_C(  422.2700) },
+      UINT8_C(152),
+      { SIMDE_FLOAT64_C(  186.7200), SIMDE_FLOAT64_C(  745.7200), SIMDE_FLOAT64_C(  640.2000), SIMDE_FLOAT64_C(  456.0500) },
+      { SIMDE_FLOAT64_C(  139.6600), SIMDE_FLOAT64_C(  930.4000), SIMDE_FLOAT64_C(  132.6900), SIMDE_FLOAT64_C(    0.0468) } },
+    { { SIMDE_FLOAT64_C(  687.9000), SIMDE_FLOAT64_C(  960.5900), SIMDE_FLOAT64_C(  221.6100), SIMDE_FLOAT64_C(  645.0900) },
+      UINT8_C(103),
+      { SIMDE_FLOAT64_C(  356.9500), SIMDE_FLOAT64_C(  126.5000), SIMDE_FLOAT64_C(  861.2800), SIMDE_FLOAT64_C(  996.6700) },
+      { SIMDE_FLOAT64_C(    0.0529), SIMDE_FLOAT64_C(    0.0889), SIMDE_FLOAT64_C(    0.0341), SIMDE_FLOAT64_C(  645.0900) } },
+    { { SIMDE_FLOAT64_C(  327.7800), SIMDE_FLOAT64_C(  394.5400), SIMDE_FLOAT64_C(   77.4100), SIMDE_FLOAT64_C(  997.0800) },
+      UINT8_C(  9),
+      { SIMDE_FLOAT64_C(  602.5600), SIMDE_FLOAT64_C(  422.2600), SIMDE_FLOAT64_C(  837.4000), SIMDE_FLOAT64_C(  370.6100) },
+      { SIMDE_FLOAT64_C(    0.0407), SIMDE_FLOAT64_C(  394.5400), SIMDE_FLOAT64_C(   77.4100), SIMDE_FLOAT64_C(    0.0519) } },
+    { { SIMDE_FLOAT64_C(  469.7900), SIMDE_FLOAT64_C(  762.6200), SIMDE_FLOAT64_C(  596.7600), SIMDE_FLOAT64_C(  721.4700) },
+      UINT8_C(153),
+      { SIMDE_FLOAT64_C(  672.3700), SIMDE_FLOAT64_C(  190.9500), SIMDE_FLOAT64_C(  539.5900), SIMDE_FLOAT64_C(  158.4300) },
+      { SIMDE_FLOAT64_C(    0.0386), SIMDE_FLOAT64_C(  762.6200), SIMDE_FLOAT64_C(  596.7600), SIMDE_FLOAT64_C(    0.0795) } },
+    { { SIMDE_FLOAT64_C(  230.8400), SIMDE_FLOAT64_C(  243.9200), SIMDE_FLOAT64_C(  800.1300), SIMDE_FLOAT64_C(  312.1500) },
+      UINT8_C(174),
+      { SIMDE_FLOAT64_C(  799.5500), SIMDE_FLOAT64_C(  656.0600), SIMDE_FLOAT64_C(  150.4900), SIMDE_FLOAT64_C(  763.7500) },
+      { SIMDE_FLOAT64_C(  230.8400), SIMDE_FLOAT64_C(    0.0390), SIMDE_FLOAT64_C(    0.0815), SIMDE_FLOAT64_C(    0.0362) } },
+    { { SIMDE_FLOAT64_C(  169.3400), SIMDE_FLOAT64_C(   34.3700), SIMDE_FLOAT64_C(  459.6700), SIMDE_FLOAT64_C(  391.3800) },
+      UINT8_C(103),
+      { SIMDE_FLOAT64_C(  765.9200), SIMDE_FLOAT64_C(  160.0500), SIMDE_FLOAT64_C(  127.9100), SIMDE_FLOAT64_C(   41.3200) },
+      { SIMDE_FLOAT64_C(    0.0361), SIMDE_FLOAT64_C(    0.0790), SIMDE_FLOAT64_C(    0.0884), SIMDE_FLOAT64_C(  391.3800) } },
+    { { SIMDE_FLOAT64_C(  912.7500), SIMDE_FLOAT64_C(   18.8900), SIMDE_FLOAT64_C(  811.6400), SIMDE_FLOAT64_C(  651.3900) },
+      UINT8_C( 42),
+      { SIMDE_FLOAT64_C(  414.7400), SIMDE_FLOAT64_C(  604.6300), SIMDE_FLOAT64_C(  867.9400), SIMDE_FLOAT64_C(  954.5900) },
+      { SIMDE_FLOAT64_C(  912.7500), SIMDE_FLOAT64_C(    0.0407), SIMDE_FLOAT64_C(  811.6400), SIMDE_FLOAT64_C(    0.0324) } },
+    { { SIMDE_FLOAT64_C(   27.6600), SIMDE_FLOAT64_C(  902.7100), SIMDE_FLOAT64_C(  992.6700), SIMDE_FLOAT64_C(  733.8500) },
+      UINT8_C(111),
+      { SIMDE_FLOAT64_C(  503.3100), SIMDE_FLOAT64_C(  592.7100), SIMDE_FLOAT64_C(  108.0900), SIMDE_FLOAT64_C(  340.8300) },
+      { SIMDE_FLOAT64_C(    0.0446), SIMDE_FLOAT64_C(    0.0411), SIMDE_FLOAT64_C(    0.0962), SIMDE_FLOAT64_C(    0.0542) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d src = simde_mm256_loadu_pd(test_vec[i].src);
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde__m256d r = simde_mm256_mask_rsqrt14_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_rsqrt14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[4];
+    const simde_float64 r[4];
+  } test_vec[] = {
+    { UINT8_C(155),
+      { SIMDE_FLOAT64_C(  816.1800), SIMDE_FLOAT64_C(  300.9700), SIMDE_FLOAT64_C(  437.0100), SIMDE_FLOAT64_C(  818.0500) },
+      { SIMDE_FLOAT64_C(    0.0350), SIMDE_FLOAT64_C(    0.0576), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0350) } },
+    { UINT8_C( 51),
+      { SIMDE_FLOAT64_C(  560.6700), SIMDE_FLOAT64_C(  368.8100), SIMDE_FLOAT64_C(  614.9900), SIMDE_FLOAT64_C(  408.6900) },
+      { SIMDE_FLOAT64_C(    0.0422), SIMDE_FLOAT64_C(    0.0521), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C(197),
+      { SIMDE_FLOAT64_C(  693.3000), SIMDE_FLOAT64_C(  280.1300), SIMDE_FLOAT64_C(  146.6500), SIMDE_FLOAT64_C(  459.5800) },
+      { SIMDE_FLOAT64_C(    0.0380), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0826), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C(134),
+      { SIMDE_FLOAT64_C(  734.4000), SIMDE_FLOAT64_C(  600.6100), SIMDE_FLOAT64_C(  944.2200), SIMDE_FLOAT64_C(  112.4100) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0408), SIMDE_FLOAT64_C(    0.0325), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C(  8),
+      { SIMDE_FLOAT64_C(  307.8000), SIMDE_FLOAT64_C(  938.4900), SIMDE_FLOAT64_C(  120.7600), SIMDE_FLOAT64_C(  595.2100) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0410) } },
+    { UINT8_C(108),
+      { SIMDE_FLOAT64_C(  883.4000), SIMDE_FLOAT64_C(  837.2200), SIMDE_FLOAT64_C(  467.4600), SIMDE_FLOAT64_C(  670.9100) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0463), SIMDE_FLOAT64_C(    0.0386) } },
+    { UINT8_C(225),
+      { SIMDE_FLOAT64_C(  208.9600), SIMDE_FLOAT64_C(  637.5600), SIMDE_FLOAT64_C(  875.2200), SIMDE_FLOAT64_C(   29.4300) },
+      { SIMDE_FLOAT64_C(    0.0692), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C(246),
+      { SIMDE_FLOAT64_C(  476.2200), SIMDE_FLOAT64_C(  811.2800), SIMDE_FLOAT64_C(   29.7800), SIMDE_FLOAT64_C(   73.0500) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0351), SIMDE_FLOAT64_C(    0.1833), SIMDE_FLOAT64_C(    0.0000) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde__m256d r = simde_mm256_maskz_rsqrt14_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x4(r, simde_mm256_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_rsqrt14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(   33.6200), SIMDE_FLOAT32_C(  801.0100), SIMDE_FLOAT32_C(  184.6300), SIMDE_FLOAT32_C(  867.1000),
+        SIMDE_FLOAT32_C(  645.3500), SIMDE_FLOAT32_C(  455.8300), SIMDE_FLOAT32_C(  941.9500), SIMDE_FLOAT32_C(  416.1100),
+        SIMDE_FLOAT32_C(  155.7800), SIMDE_FLOAT32_C(  243.2500), SIMDE_FLOAT32_C(  736.9200), SIMDE_FLOAT32_C(  282.0000),
+        SIMDE_FLOAT32_C(  855.2300), SIMDE_FLOAT32_C(  142.4200), SIMDE_FLOAT32_C(  782.1400), SIMDE_FLOAT32_C(  363.1100) },
+      { SIMDE_FLOAT32_C(    0.1725), SIMDE_FLOAT32_C(    0.0353), SIMDE_FLOAT32_C(    0.0736), SIMDE_FLOAT32_C(    0.0340),
+        SIMDE_FLOAT32_C(    0.0394), SIMDE_FLOAT32_C(    0.0468), SIMDE_FLOAT32_C(    0.0326), SIMDE_FLOAT32_C(    0.0490),
+        SIMDE_FLOAT32_C(    0.0801), SIMDE_FLOAT32_C(    0.0641), SIMDE_FLOAT32_C(    0.0368), SIMDE_FLOAT32_C(    0.0596),
+        SIMDE_FLOAT32_C(    0.0342), SIMDE_FLOAT32_C(    0.0838), SIMDE_FLOAT32_C(    0.0358), SIMDE_FLOAT32_C(    0.0525) } },
+    { { SIMDE_FLOAT32_C(  476.5100), SIMDE_FLOAT32_C(  796.2500), SIMDE_FLOAT32_C(    5.3400), SIMDE_FLOAT32_C(  819.1000),
+        SIMDE_FLOAT32_C(  787.4400), SIMDE_FLOAT32_C(  784.5700), SIMDE_FLOAT32_C(  338.3500), SIMDE_FLOAT32_C(  649.7400),
+        SIMDE_FLOAT32_C(  773.7200), SIMDE_FLOAT32_C(   17.4800), SIMDE_FLOAT32_C(   40.6000), SIMDE_FLOAT32_C(  692.2200),
+        SIMDE_FLOAT32_C(  393.9700), SIMDE_FLOAT32_C(  279.5400), SIMDE_FLOAT32_C(  160.8700), SIMDE_FLOAT32_C(  384.3900) },
+      { SIMDE_FLOAT32_C(    0.0458), SIMDE_FLOAT32_C(    0.0354), SIMDE_FLOAT32_C(    0.4327), SIMDE_FLOAT32_C(    0.0349),
+        SIMDE_FLOAT32_C(    0.0356), SIMDE_FLOAT32_C(    0.0357), SIMDE_FLOAT32_C(    0.0544), SIMDE_FLOAT32_C(    0.0392),
+        SIMDE_FLOAT32_C(    0.0360), SIMDE_FLOAT32_C(    0.2392), SIMDE_FLOAT32_C(    0.1569), SIMDE_FLOAT32_C(    0.0380),
+        SIMDE_FLOAT32_C(    0.0504), SIMDE_FLOAT32_C(    0.0598), SIMDE_FLOAT32_C(    0.0788), SIMDE_FLOAT32_C(    0.0510) } },
+    { { SIMDE_FLOAT32_C(  909.2900), SIMDE_FLOAT32_C(  848.1300), SIMDE_FLOAT32_C(  972.9400), SIMDE_FLOAT32_C(  232.5100),
+        SIMDE_FLOAT32_C(  848.7400), SIMDE_FLOAT32_C(  349.5400), SIMDE_FLOAT32_C(   74.2700), SIMDE_FLOAT32_C(  430.0700),
+        SIMDE_FLOAT32_C(  665.4600), SIMDE_FLOAT32_C(  820.9200), SIMDE_FLOAT32_C(  387.6100), SIMDE_FLOAT32_C(  620.9100),
+        SIMDE_FLOAT32_C(  623.6400), SIMDE_FLOAT32_C(  905.2100), SIMDE_FLOAT32_C(  597.8900), SIMDE_FLOAT32_C(   58.6200) },
+      { SIMDE_FLOAT32_C(    0.0332), SIMDE_FLOAT32_C(    0.0343), SIMDE_FLOAT32_C(    0.0321), SIMDE_FLOAT32_C(    0.0656),
+        SIMDE_FLOAT32_C(    0.0343), SIMDE_FLOAT32_C(    0.0535), SIMDE_FLOAT32_C(    0.1160), SIMDE_FLOAT32_C(    0.0482),
+        SIMDE_FLOAT32_C(    0.0388), SIMDE_FLOAT32_C(    0.0349), SIMDE_FLOAT32_C(    0.0508), SIMDE_FLOAT32_C(    0.0401),
+        SIMDE_FLOAT32_C(    0.0400), SIMDE_FLOAT32_C(    0.0332), SIMDE_FLOAT32_C(    0.0409), SIMDE_FLOAT32_C(    0.1306) } },
+    { { SIMDE_FLOAT32_C(  724.1600), SIMDE_FLOAT32_C(  359.8100), SIMDE_FLOAT32_C(  264.7800), SIMDE_FLOAT32_C(  501.6500),
+        SIMDE_FLOAT32_C(  968.3700), SIMDE_FLOAT32_C(  512.2700), SIMDE_FLOAT32_C(  993.5400), SIMDE_FLOAT32_C(  524.5700),
+        SIMDE_FLOAT32_C(  936.8800), SIMDE_FLOAT32_C(   69.2300), SIMDE_FLOAT32_C(  425.2000), SIMDE_FLOAT32_C(  745.8700),
+        SIMDE_FLOAT32_C(  399.1900), SIMDE_FLOAT32_C(  806.7000), SIMDE_FLOAT32_C(  250.9500), SIMDE_FLOAT32_C(  653.1700) },
+      { SIMDE_FLOAT32_C(    0.0372), SIMDE_FLOAT32_C(    0.0527), SIMDE_FLOAT32_C(    0.0615), SIMDE_FLOAT32_C(    0.0446),
+        SIMDE_FLOAT32_C(    0.0321), SIMDE_FLOAT32_C(    0.0442), SIMDE_FLOAT32_C(    0.0317), SIMDE_FLOAT32_C(    0.0437),
+        SIMDE_FLOAT32_C(    0.0327), SIMDE_FLOAT32_C(    0.1202), SIMDE_FLOAT32_C(    0.0485), SIMDE_FLOAT32_C(    0.0366),
+        SIMDE_FLOAT32_C(    0.0501), SIMDE_FLOAT32_C(    0.0352), SIMDE_FLOAT32_C(    0.0631), SIMDE_FLOAT32_C(    0.0391) } },
+    { { SIMDE_FLOAT32_C(  483.1400), SIMDE_FLOAT32_C(  930.1000), SIMDE_FLOAT32_C(  432.4400), SIMDE_FLOAT32_C(  482.2300),
+        SIMDE_FLOAT32_C(  360.2100), SIMDE_FLOAT32_C(  906.4800), SIMDE_FLOAT32_C(  213.6600), SIMDE_FLOAT32_C(    3.3300),
+        SIMDE_FLOAT32_C(  923.1400), SIMDE_FLOAT32_C(  619.9700), SIMDE_FLOAT32_C(  608.2000), SIMDE_FLOAT32_C(  541.3100),
+        SIMDE_FLOAT32_C(  775.3000), SIMDE_FLOAT32_C(  437.1700), SIMDE_FLOAT32_C(  807.6800), SIMDE_FLOAT32_C(   88.4900) },
+      { SIMDE_FLOAT32_C(    0.0455), SIMDE_FLOAT32_C(    0.0328), SIMDE_FLOAT32_C(    0.0481), SIMDE_FLOAT32_C(    0.0455),
+        SIMDE_FLOAT32_C(    0.0527), SIMDE_FLOAT32_C(    0.0332), SIMDE_FLOAT32_C(    0.0684), SIMDE_FLOAT32_C(    0.5480),
+        SIMDE_FLOAT32_C(    0.0329), SIMDE_FLOAT32_C(    0.0402), SIMDE_FLOAT32_C(    0.0405), SIMDE_FLOAT32_C(    0.0430),
+        SIMDE_FLOAT32_C(    0.0359), SIMDE_FLOAT32_C(    0.0478), SIMDE_FLOAT32_C(    0.0352), SIMDE_FLOAT32_C(    0.1063) } },
+    { { SIMDE_FLOAT32_C(  232.2100), SIMDE_FLOAT32_C(  464.2200), SIMDE_FLOAT32_C(  304.8700), SIMDE_FLOAT32_C(  390.1600),
+        SIMDE_FLOAT32_C(  565.2800), SIMDE_FLOAT32_C(  205.0600), SIMDE_FLOAT32_C(  100.3500), SIMDE_FLOAT32_C(  414.0800),
+        SIMDE_FLOAT32_C(  717.5100), SIMDE_FLOAT32_C(  172.7200), SIMDE_FLOAT32_C(  233.7900), SIMDE_FLOAT32_C(  271.4800),
+        SIMDE_FLOAT32_C(  506.7100), SIMDE_FLOAT32_C(  108.2400), SIMDE_FLOAT32_C(   72.9200), SIMDE_FLOAT32_C(  972.0000) },
+      { SIMDE_FLOAT32_C(    0.0656), SIMDE_FLOAT32_C(    0.0464), SIMDE_FLOAT32_C(    0.0573), SIMDE_FLOAT32_C(    0.0506),
+        SIMDE_FLOAT32_C(    0.0421), SIMDE_FLOAT32_C(    0.0698), SIMDE_FLOAT32_C(    0.0998), SIMDE_FLOAT32_C(    0.0491),
+        SIMDE_FLOAT32_C(    0.0373), SIMDE_FLOAT32_C(    0.0761), SIMDE_FLOAT32_C(    0.0654), SIMDE_FLOAT32_C(    0.0607),
+        SIMDE_FLOAT32_C(    0.0444), SIMDE_FLOAT32_C(    0.0961), SIMDE_FLOAT32_C(    0.1171), SIMDE_FLOAT32_C(    0.0321) } },
+    { { SIMDE_FLOAT32_C(  646.0900), SIMDE_FLOAT32_C(  811.8700), SIMDE_FLOAT32_C(  976.4700), SIMDE_FLOAT32_C(  932.7700),
+        SIMDE_FLOAT32_C(  138.7200), SIMDE_FLOAT32_C(  629.9200), SIMDE_FLOAT32_C(  544.1700), SIMDE_FLOAT32_C(  863.3000),
+        SIMDE_FLOAT32_C(  213.7200), SIMDE_FLOAT32_C(  159.1400), SIMDE_FLOAT32_C(   30.5400), SIMDE_FLOAT32_C(  681.3800),
+        SIMDE_FLOAT32_C(  388.9500), SIMDE_FLOAT32_C(  398.4900), SIMDE_FLOAT32_C(   94.0800), SIMDE_FLOAT32_C(  724.7100) },
+      { SIMDE_FLOAT32_C(    0.0393), SIMDE_FLOAT32_C(    0.0351), SIMDE_FLOAT32_C(    0.0320), SIMDE_FLOAT32_C(    0.0327),
+        SIMDE_FLOAT32_C(    0.0849), SIMDE_FLOAT32_C(    0.0398), SIMDE_FLOAT32_C(    0.0429), SIMDE_FLOAT32_C(    0.0340),
+        SIMDE_FLOAT32_C(    0.0684), SIMDE_FLOAT32_C(    0.0793), SIMDE_FLOAT32_C(    0.1810), SIMDE_FLOAT32_C(    0.0383),
+        SIMDE_FLOAT32_C(    0.0507), SIMDE_FLOAT32_C(    0.0501), SIMDE_FLOAT32_C(    0.1031), SIMDE_FLOAT32_C(    0.0371) } },
+    { { SIMDE_FLOAT32_C(   81.7800), SIMDE_FLOAT32_C(  242.1300), SIMDE_FLOAT32_C(  570.7300), SIMDE_FLOAT32_C(  117.8900),
+        SIMDE_FLOAT32_C(  202.4600), SIMDE_FLOAT32_C(  926.5500), SIMDE_FLOAT32_C(  438.5900), SIMDE_FLOAT32_C(   27.2300),
+        SIMDE_FLOAT32_C(  434.1000), SIMDE_FLOAT32_C(  770.4600), SIMDE_FLOAT32_C(  236.0000), SIMDE_FLOAT32_C(  161.9900),
+        SIMDE_FLOAT32_C(  175.6900), SIMDE_FLOAT32_C(  665.2600), SIMDE_FLOAT32_C(  618.2900), SIMDE_FLOAT32_C(  473.7900) },
+      { SIMDE_FLOAT32_C(    0.1106), SIMDE_FLOAT32_C(    0.0643), SIMDE_FLOAT32_C(    0.0419), SIMDE_FLOAT32_C(    0.0921),
+        SIMDE_FLOAT32_C(    0.0703), SIMDE_FLOAT32_C(    0.0329), SIMDE_FLOAT32_C(    0.0477), SIMDE_FLOAT32_C(    0.1916),
+        SIMDE_FLOAT32_C(    0.0480), SIMDE_FLOAT32_C(    0.0360), SIMDE_FLOAT32_C(    0.0651), SIMDE_FLOAT32_C(    0.0786),
+        SIMDE_FLOAT32_C(    0.0754), SIMDE_FLOAT32_C(    0.0388), SIMDE_FLOAT32_C(    0.0402), SIMDE_FLOAT32_C(    0.0459) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_rsqrt14_ps(a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_rsqrt14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[16];
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  992.5400), SIMDE_FLOAT32_C(   77.2600), SIMDE_FLOAT32_C(  933.3700), SIMDE_FLOAT32_C(  711.1500),
+        SIMDE_FLOAT32_C(  207.1500), SIMDE_FLOAT32_C(  304.7200), SIMDE_FLOAT32_C(  673.9900), SIMDE_FLOAT32_C(  325.0700),
+        SIMDE_FLOAT32_C(  429.0700), SIMDE_FLOAT32_C(  838.7800), SIMDE_FLOAT32_C(  705.7100), SIMDE_FLOAT32_C(  215.9100),
+        SIMDE_FLOAT32_C(  362.9700), SIMDE_FLOAT32_C(  635.8000), SIMDE_FLOAT32_C(  158.2300), SIMDE_FLOAT32_C(  449.0800) },
+      UINT16_C(18096),
+      { SIMDE_FLOAT32_C(  858.0600), SIMDE_FLOAT32_C(  237.6100), SIMDE_FLOAT32_C(  171.7900), SIMDE_FLOAT32_C(   29.3300),
+        SIMDE_FLOAT32_C(  493.7300), SIMDE_FLOAT32_C(  410.4400), SIMDE_FLOAT32_C(  533.1400), SIMDE_FLOAT32_C(  582.5200),
+        SIMDE_FLOAT32_C(  943.3400), SIMDE_FLOAT32_C(  170.6400), SIMDE_FLOAT32_C(  718.0100), SIMDE_FLOAT32_C(  759.6400),
+        SIMDE_FLOAT32_C(  840.6300), SIMDE_FLOAT32_C(  674.3900), SIMDE_FLOAT32_C(  957.7200), SIMDE_FLOAT32_C(  492.1500) },
+      { SIMDE_FLOAT32_C(  992.5400), SIMDE_FLOAT32_C(   77.2600), SIMDE_FLOAT32_C(  933.3700), SIMDE_FLOAT32_C(  711.1500),
+        SIMDE_FLOAT32_C(    0.0450), SIMDE_FLOAT32_C(    0.0494), SIMDE_FLOAT32_C(  673.9900), SIMDE_FLOAT32_C(    0.0414),
+        SIMDE_FLOAT32_C(  429.0700), SIMDE_FLOAT32_C(    0.0766), SIMDE_FLOAT32_C(    0.0373), SIMDE_FLOAT32_C(  215.9100),
+        SIMDE_FLOAT32_C(  362.9700), SIMDE_FLOAT32_C(  635.8000), SIMDE_FLOAT32_C(    0.0323), SIMDE_FLOAT32_C(  449.0800) } },
+    { { SIMDE_FLOAT32_C(   76.7000), SIMDE_FLOAT32_C(  822.6200), SIMDE_FLOAT32_C(  790.0600), SIMDE_FLOAT32_C(  539.6100),
+        SIMDE_FLOAT32_C(  377.4700), SIMDE_FLOAT32_C(  971.5600), SIMDE_FLOAT32_C(  151.4900), SIMDE_FLOAT32_C(  827.8100),
+        SIMDE_FLOAT32_C(  291.3700), SIMDE_FLOAT32_C(  554.6600), SIMDE_FLOAT32_C(   87.8300), SIMDE_FLOAT32_C(  474.8500),
+        SIMDE_FLOAT32_C(  469.5500), SIMDE_FLOAT32_C(  392.5200), SIMDE_FLOAT32_C(  174.5500), SIMDE_FLOAT32_C(  772.7300) },
+      UINT16_C(65347),
+      { SIMDE_FLOAT32_C(  887.8600), SIMDE_FLOAT32_C(  230.7800), SIMDE_FLOAT32_C(  735.0600), SIMDE_FLOAT32_C(  514.3300),
+        SIMDE_FLOAT32_C(  233.3600), SIMDE_FLOAT32_C(  984.5000), SIMDE_FLOAT32_C(  616.2700), SIMDE_FLOAT32_C(  719.2400),
+        SIMDE_FLOAT32_C(   25.3000), SIMDE_FLOAT32_C(  232.8100), SIMDE_FLOAT32_C(  837.6200), SIMDE_FLOAT32_C(  183.2800),
+        SIMDE_FLOAT32_C(  511.9300), SIMDE_FLOAT32_C(  122.6600), SIMDE_FLOAT32_C(  528.1500), SIMDE_FLOAT32_C(  106.4000) },
+      { SIMDE_FLOAT32_C(    0.0336), SIMDE_FLOAT32_C(    0.0658), SIMDE_FLOAT32_C(  790.0600), SIMDE_FLOAT32_C(  539.6100),
+        SIMDE_FLOAT32_C(  377.4700), SIMDE_FLOAT32_C(  971.5600), SIMDE_FLOAT32_C(    0.0403), SIMDE_FLOAT32_C(  827.8100),
+        SIMDE_FLOAT32_C(    0.1988), SIMDE_FLOAT32_C(    0.0655), SIMDE_FLOAT32_C(    0.0346), SIMDE_FLOAT32_C(    0.0739),
+        SIMDE_FLOAT32_C(    0.0442), SIMDE_FLOAT32_C(    0.0903), SIMDE_FLOAT32_C(    0.0435), SIMDE_FLOAT32_C(    0.0969) } },
+    { { SIMDE_FLOAT32_C(  333.0700), SIMDE_FLOAT32_C(  634.1100), SIMDE_FLOAT32_C(  420.8900), SIMDE_FLOAT32_C(  169.9100),
+        SIMDE_FLOAT32_C(  806.5400), SIMDE_FLOAT32_C(  822.5700), SIMDE_FLOAT32_C(  636.9600), SIMDE_FLOAT32_C(   48.5000),
+        SIMDE_FLOAT32_C(  363.1700), SIMDE_FLOAT32_C(  395.1300), SIMDE_FLOAT32_C(  315.6700), SIMDE_FLOAT32_C(  944.2900),
+        SIMDE_FLOAT32_C(  667.7100), SIMDE_FLOAT32_C(  127.7700), SIMDE_FLOAT32_C(  842.8200), SIMDE_FLOAT32_C(  307.0700) },
+      UINT16_C(63953),
+      { SIMDE_FLOAT32_C(  782.8700), SIMDE_FLOAT32_C(  387.6100), SIMDE_FLOAT32_C(  395.3100), SIMDE_FLOAT32_C(  502.8500),
+        SIMDE_FLOAT32_C(   35.3300), SIMDE_FLOAT32_C(  955.0200), SIMDE_FLOAT32_C(  120.7400), SIMDE_FLOAT32_C(  970.7900),
+        SIMDE_FLOAT32_C(   27.4700), SIMDE_FLOAT32_C(  873.9800), SIMDE_FLOAT32_C(   62.9400), SIMDE_FLOAT32_C(  424.7200),
+        SIMDE_FLOAT32_C(  383.5200), SIMDE_FLOAT32_C(  380.4000), SIMDE_FLOAT32_C(  261.4000), SIMDE_FLOAT32_C(  383.1800) },
+      { SIMDE_FLOAT32_C(    0.0357), SIMDE_FLOAT32_C(  634.1100), SIMDE_FLOAT32_C(  420.8900), SIMDE_FLOAT32_C(  169.9100),
+        SIMDE_FLOAT32_C(    0.1682), SIMDE_FLOAT32_C(  822.5700), SIMDE_FLOAT32_C(    0.0910), SIMDE_FLOAT32_C(    0.0321),
+        SIMDE_FLOAT32_C(    0.1908), SIMDE_FLOAT32_C(  395.1300), SIMDE_FLOAT32_C(  315.6700), SIMDE_FLOAT32_C(    0.0485),
+        SIMDE_FLOAT32_C(    0.0511), SIMDE_FLOAT32_C(    0.0513), SIMDE_FLOAT32_C(    0.0619), SIMDE_FLOAT32_C(    0.0511) } },
+    { { SIMDE_FLOAT32_C(   67.0900), SIMDE_FLOAT32_C(   61.4400), SIMDE_FLOAT32_C(  381.5900), SIMDE_FLOAT32_C(  978.7500),
+        SIMDE_FLOAT32_C(   53.9500), SIMDE_FLOAT32_C(  569.8000), SIMDE_FLOAT32_C(  902.2100), SIMDE_FLOAT32_C(  578.0200),
+        SIMDE_FLOAT32_C(  417.8300), SIMDE_FLOAT32_C(  618.5500), SIMDE_FLOAT32_C(  767.7900), SIMDE_FLOAT32_C(  751.5900),
+        SIMDE_FLOAT32_C(  335.8100), SIMDE_FLOAT32_C(   63.9200), SIMDE_FLOAT32_C(  124.0200), SIMDE_FLOAT32_C(  183.1400) },
+      UINT16_C(46358),
+      { SIMDE_FLOAT32_C(  265.0000), SIMDE_FLOAT32_C(   13.3800), SIMDE_FLOAT32_C(  331.3100), SIMDE_FLOAT32_C(  218.4800),
+        SIMDE_FLOAT32_C(  599.3200), SIMDE_FLOAT32_C(  673.4200), SIMDE_FLOAT32_C(  788.3000), SIMDE_FLOAT32_C(  903.0000),
+        SIMDE_FLOAT32_C(  870.5600), SIMDE_FLOAT32_C(  679.7000), SIMDE_FLOAT32_C(  318.2100), SIMDE_FLOAT32_C(  441.8700),
+        SIMDE_FLOAT32_C(  746.2100), SIMDE_FLOAT32_C(  259.5200), SIMDE_FLOAT32_C(  357.8400), SIMDE_FLOAT32_C(  190.9600) },
+      { SIMDE_FLOAT32_C(   67.0900), SIMDE_FLOAT32_C(    0.2734), SIMDE_FLOAT32_C(    0.0549), SIMDE_FLOAT32_C(  978.7500),
+        SIMDE_FLOAT32_C(    0.0408), SIMDE_FLOAT32_C(  569.8000), SIMDE_FLOAT32_C(  902.2100), SIMDE_FLOAT32_C(  578.0200),
+        SIMDE_FLOAT32_C(    0.0339), SIMDE_FLOAT32_C(  618.5500), SIMDE_FLOAT32_C(    0.0561), SIMDE_FLOAT32_C(  751.5900),
+        SIMDE_FLOAT32_C(    0.0366), SIMDE_FLOAT32_C(    0.0621), SIMDE_FLOAT32_C(  124.0200), SIMDE_FLOAT32_C(    0.0724) } },
+    { { SIMDE_FLOAT32_C(  533.0000), SIMDE_FLOAT32_C(  319.9000), SIMDE_FLOAT32_C(  905.7300), SIMDE_FLOAT32_C(  287.3000),
+        SIMDE_FLOAT32_C(  520.3500), SIMDE_FLOAT32_C(  114.3600), SIMDE_FLOAT32_C(  478.0300), SIMDE_FLOAT32_C(  911.8900),
+        SIMDE_FLOAT32_C(  297.1600), SIMDE_FLOAT32_C(  631.5800), SIMDE_FLOAT32_C(  511.4200), SIMDE_FLOAT32_C(  229.5400),
+        SIMDE_FLOAT32_C(  596.3800), SIMDE_FLOAT32_C(   24.5700), SIMDE_FLOAT32_C(  886.7000), SIMDE_FLOAT32_C(  203.8700) },
+      UINT16_C( 7521),
+      { SIMDE_FLOAT32_C(  784.1200), SIMDE_FLOAT32_C(  933.5400), SIMDE_FLOAT32_C(  134.1700), SIMDE_FLOAT32_C(  159.4800),
+        SIMDE_FLOAT32_C(    7.3900), SIMDE_FLOAT32_C(  489.6400), SIMDE_FLOAT32_C(  585.2000), SIMDE_FLOAT32_C(  642.1200),
+        SIMDE_FLOAT32_C(  798.5400), SIMDE_FLOAT32_C(  990.4700), SIMDE_FLOAT32_C(  600.2000), SIMDE_FLOAT32_C(  529.7100),
+        SIMDE_FLOAT32_C(  134.7500), SIMDE_FLOAT32_C(  977.7400), SIMDE_FLOAT32_C(  851.7800), SIMDE_FLOAT32_C(  865.3300) },
+      { SIMDE_FLOAT32_C(    0.0357), SIMDE_FLOAT32_C(  319.9000), SIMDE_FLOAT32_C(  905.7300), SIMDE_FLOAT32_C(  287.3000),
+        SIMDE_FLOAT32_C(  520.3500), SIMDE_FLOAT32_C(    0.0452), SIMDE_FLOAT32_C(    0.0413), SIMDE_FLOAT32_C(  911.8900),
+        SIMDE_FLOAT32_C(    0.0354), SIMDE_FLOAT32_C(  631.5800), SIMDE_FLOAT32_C(    0.0408), SIMDE_FLOAT32_C(    0.0434),
+        SIMDE_FLOAT32_C(    0.0861), SIMDE_FLOAT32_C(   24.5700), SIMDE_FLOAT32_C(  886.7000), SIMDE_FLOAT32_C(  203.8700) } },
+    { { SIMDE_FLOAT32_C(  834.7500), SIMDE_FLOAT32_C(  970.3700), SIMDE_FLOAT32_C(  945.8700), SIMDE_FLOAT32_C(  746.3400),
+        SIMDE_FLOAT32_C(  498.8900), SIMDE_FLOAT32_C(   85.9800), SIMDE_FLOAT32_C(  296.8500), SIMDE_FLOAT32_C(  403.9800),
+        SIMDE_FLOAT32_C(  280.2400), SIMDE_FLOAT32_C(  475.5200), SIMDE_FLOAT32_C(  780.5200), SIMDE_FLOAT32_C(  453.9400),
+        SIMDE_FLOAT32_C(  546.8100), SIMDE_FLOAT32_C(  531.1800), SIMDE_FLOAT32_C(  215.1900), SIMDE_FLOAT32_C(  555.1300) },
+      UINT16_C(12007),
+      { SIMDE_FLOAT32_C(  481.8200), SIMDE_FLOAT32_C(  628.4800), SIMDE_FLOAT32_C(  732.6900), SIMDE_FLOAT32_C(  147.2000),
+        SIMDE_FLOAT32_C(  670.4700), SIMDE_FLOAT32_C(  334.3400), SIMDE_FLOAT32_C(  635.8200), SIMDE_FLOAT32_C(  429.7500),
+        SIMDE_FLOAT32_C(  350.0600), SIMDE_FLOAT32_C(  842.7500), SIMDE_FLOAT32_C(  730.5900), SIMDE_FLOAT32_C(  941.4300),
+        SIMDE_FLOAT32_C(  734.2300), SIMDE_FLOAT32_C(  683.0100), SIMDE_FLOAT32_C(  640.8200), SIMDE_FLOAT32_C(  383.7500) },
+      { SIMDE_FLOAT32_C(    0.0456), SIMDE_FLOAT32_C(    0.0399), SIMDE_FLOAT32_C(    0.0369), SIMDE_FLOAT32_C(  746.3400),
+        SIMDE_FLOAT32_C(  498.8900), SIMDE_FLOAT32_C(    0.0547), SIMDE_FLOAT32_C(    0.0397), SIMDE_FLOAT32_C(    0.0482),
+        SIMDE_FLOAT32_C(  280.2400), SIMDE_FLOAT32_C(    0.0344), SIMDE_FLOAT32_C(    0.0370), SIMDE_FLOAT32_C(    0.0326),
+        SIMDE_FLOAT32_C(  546.8100), SIMDE_FLOAT32_C(    0.0383), SIMDE_FLOAT32_C(  215.1900), SIMDE_FLOAT32_C(  555.1300) } },
+    { { SIMDE_FLOAT32_C(  209.9000), SIMDE_FLOAT32_C(  776.8900), SIMDE_FLOAT32_C(  668.4300), SIMDE_FLOAT32_C(  308.7000),
+        SIMDE_FLOAT32_C(  548.7000), SIMDE_FLOAT32_C(  239.9500), SIMDE_FLOAT32_C(  153.3200), SIMDE_FLOAT32_C(   36.9900),
+        SIMDE_FLOAT32_C(  607.8900), SIMDE_FLOAT32_C(  195.8200), SIMDE_FLOAT32_C(  273.8800), SIMDE_FLOAT32_C(  391.3200),
+        SIMDE_FLOAT32_C(  404.1000), SIMDE_FLOAT32_C(  750.6900), SIMDE_FLOAT32_C(  388.9600), SIMDE_FLOAT32_C(  152.6800) },
+      UINT16_C(60370),
+      { SIMDE_FLOAT32_C(  647.2400), SIMDE_FLOAT32_C(  801.0700), SIMDE_FLOAT32_C(  676.6000), SIMDE_FLOAT32_C(   81.2400),
+        SIMDE_FLOAT32_C(  562.7700), SIMDE_FLOAT32_C(  629.0300), SIMDE_FLOAT32_C(  334.5000), SIMDE_FLOAT32_C(  949.7500),
+        SIMDE_FLOAT32_C(  907.3600), SIMDE_FLOAT32_C(  874.7500), SIMDE_FLOAT32_C(  728.5700), SIMDE_FLOAT32_C(  662.1600),
+        SIMDE_FLOAT32_C(  806.6100), SIMDE_FLOAT32_C(  450.4800), SIMDE_FLOAT32_C(  271.9700), SIMDE_FLOAT32_C(  500.6600) },
+      { SIMDE_FLOAT32_C(  209.9000), SIMDE_FLOAT32_C(    0.0353), SIMDE_FLOAT32_C(  668.4300), SIMDE_FLOAT32_C(  308.7000),
+        SIMDE_FLOAT32_C(    0.0422), SIMDE_FLOAT32_C(  239.9500), SIMDE_FLOAT32_C(    0.0547), SIMDE_FLOAT32_C(    0.0324),
+        SIMDE_FLOAT32_C(    0.0332), SIMDE_FLOAT32_C(    0.0338), SIMDE_FLOAT32_C(  273.8800), SIMDE_FLOAT32_C(    0.0389),
+        SIMDE_FLOAT32_C(  404.1000), SIMDE_FLOAT32_C(    0.0471), SIMDE_FLOAT32_C(    0.0606), SIMDE_FLOAT32_C(    0.0447) } },
+    { { SIMDE_FLOAT32_C(  628.3700), SIMDE_FLOAT32_C(  297.6300), SIMDE_FLOAT32_C(  590.5900), SIMDE_FLOAT32_C(  991.4900),
+        SIMDE_FLOAT32_C(   33.9800), SIMDE_FLOAT32_C(    8.9900), SIMDE_FLOAT32_C(  596.7100), SIMDE_FLOAT32_C(  808.8700),
+        SIMDE_FLOAT32_C(  887.9600), SIMDE_FLOAT32_C(  785.4400), SIMDE_FLOAT32_C(  282.4000), SIMDE_FLOAT32_C(  761.7700),
+        SIMDE_FLOAT32_C(  719.9400), SIMDE_FLOAT32_C(  415.1900), SIMDE_FLOAT32_C(  539.6700), SIMDE_FLOAT32_C(  718.8400) },
+      UINT16_C(20637),
+      { SIMDE_FLOAT32_C(  263.1000), SIMDE_FLOAT32_C(  105.9000), SIMDE_FLOAT32_C(  578.5900), SIMDE_FLOAT32_C(  954.7600),
+        SIMDE_FLOAT32_C(  382.0400), SIMDE_FLOAT32_C(   68.9700), SIMDE_FLOAT32_C(  702.2300), SIMDE_FLOAT32_C(  297.4700),
+        SIMDE_FLOAT32_C(   64.6400), SIMDE_FLOAT32_C(  444.4500), SIMDE_FLOAT32_C(  105.8500), SIMDE_FLOAT32_C(  234.9200),
+        SIMDE_FLOAT32_C(  866.4000), SIMDE_FLOAT32_C(  892.7100), SIMDE_FLOAT32_C(  350.3400), SIMDE_FLOAT32_C(  888.4400) },
+      { SIMDE_FLOAT32_C(    0.0617), SIMDE_FLOAT32_C(  297.6300), SIMDE_FLOAT32_C(    0.0416), SIMDE_FLOAT32_C(    0.0324),
+        SIMDE_FLOAT32_C(    0.0512), SIMDE_FLOAT32_C(    8.9900), SIMDE_FLOAT32_C(  596.7100), SIMDE_FLOAT32_C(    0.0580),
+        SIMDE_FLOAT32_C(  887.9600), SIMDE_FLOAT32_C(  785.4400), SIMDE_FLOAT32_C(  282.4000), SIMDE_FLOAT32_C(  761.7700),
+        SIMDE_FLOAT32_C(    0.0340), SIMDE_FLOAT32_C(  415.1900), SIMDE_FLOAT32_C(    0.0534), SIMDE_FLOAT32_C(  718.8400) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 src = simde_mm512_loadu_ps(test_vec[i].src);
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_mask_rsqrt14_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_rsqrt14_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { UINT16_C(63472),
+      { SIMDE_FLOAT32_C(  893.2000), SIMDE_FLOAT32_C(  260.1200), SIMDE_FLOAT32_C(  351.2600), SIMDE_FLOAT32_C(  725.9900),
+        SIMDE_FLOAT32_C(   97.3300), SIMDE_FLOAT32_C(  742.7000), SIMDE_FLOAT32_C(  464.3900), SIMDE_FLOAT32_C(  941.1700),
+        SIMDE_FLOAT32_C(  661.1500), SIMDE_FLOAT32_C(  865.0500), SIMDE_FLOAT32_C(  253.0500), SIMDE_FLOAT32_C(  291.2300),
+        SIMDE_FLOAT32_C(  949.8300), SIMDE_FLOAT32_C(  276.3400), SIMDE_FLOAT32_C(  703.0600), SIMDE_FLOAT32_C(  375.0300) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.1014), SIMDE_FLOAT32_C(    0.0367), SIMDE_FLOAT32_C(    0.0464), SIMDE_FLOAT32_C(    0.0326),
+        SIMDE_FLOAT32_C(    0.0389), SIMDE_FLOAT32_C(    0.0340), SIMDE_FLOAT32_C(    0.0629), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0324), SIMDE_FLOAT32_C(    0.0602), SIMDE_FLOAT32_C(    0.0377), SIMDE_FLOAT32_C(    0.0516) } },
+    { UINT16_C(58524),
+      { SIMDE_FLOAT32_C(  308.4300), SIMDE_FLOAT32_C(  222.4100), SIMDE_FLOAT32_C(  945.5000), SIMDE_FLOAT32_C(  832.2500),
+        SIMDE_FLOAT32_C(  258.8500), SIMDE_FLOAT32_C(  130.8500), SIMDE_FLOAT32_C(   35.3000), SIMDE_FLOAT32_C(   35.9100),
+        SIMDE_FLOAT32_C(  480.6600), SIMDE_FLOAT32_C(  891.1300), SIMDE_FLOAT32_C(  640.2000), SIMDE_FLOAT32_C(   13.1200),
+        SIMDE_FLOAT32_C(  950.7600), SIMDE_FLOAT32_C(  229.2100), SIMDE_FLOAT32_C(   28.8300), SIMDE_FLOAT32_C(  452.9200) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0325), SIMDE_FLOAT32_C(    0.0347),
+        SIMDE_FLOAT32_C(    0.0622), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.1669),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0395), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0661), SIMDE_FLOAT32_C(    0.1862), SIMDE_FLOAT32_C(    0.0470) } },
+    { UINT16_C(18329),
+      { SIMDE_FLOAT32_C(  388.0500), SIMDE_FLOAT32_C(  875.0300), SIMDE_FLOAT32_C(  951.5300), SIMDE_FLOAT32_C(  598.4400),
+        SIMDE_FLOAT32_C(  802.0100), SIMDE_FLOAT32_C(  950.0800), SIMDE_FLOAT32_C(  670.9900), SIMDE_FLOAT32_C(  397.7700),
+        SIMDE_FLOAT32_C(  491.8900), SIMDE_FLOAT32_C(  162.5800), SIMDE_FLOAT32_C(  766.9700), SIMDE_FLOAT32_C(  643.4000),
+        SIMDE_FLOAT32_C(   29.7900), SIMDE_FLOAT32_C(   31.9300), SIMDE_FLOAT32_C(  916.2500), SIMDE_FLOAT32_C(   19.5200) },
+      { SIMDE_FLOAT32_C(    0.0508), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0409),
+        SIMDE_FLOAT32_C(    0.0353), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0501),
+        SIMDE_FLOAT32_C(    0.0451), SIMDE_FLOAT32_C(    0.0784), SIMDE_FLOAT32_C(    0.0361), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0330), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT16_C(22729),
+      { SIMDE_FLOAT32_C(  164.6000), SIMDE_FLOAT32_C(  704.4300), SIMDE_FLOAT32_C(  379.5000), SIMDE_FLOAT32_C(  977.8900),
+        SIMDE_FLOAT32_C(  248.7100), SIMDE_FLOAT32_C(  808.6900), SIMDE_FLOAT32_C(  615.9900), SIMDE_FLOAT32_C(    7.7400),
+        SIMDE_FLOAT32_C(  127.3900), SIMDE_FLOAT32_C(  384.1100), SIMDE_FLOAT32_C(  396.6800), SIMDE_FLOAT32_C(  350.4300),
+        SIMDE_FLOAT32_C(  368.0100), SIMDE_FLOAT32_C(  356.3000), SIMDE_FLOAT32_C(  386.2600), SIMDE_FLOAT32_C(  398.2600) },
+      { SIMDE_FLOAT32_C(    0.0779), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0320),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0403), SIMDE_FLOAT32_C(    0.3594),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0534),
+        SIMDE_FLOAT32_C(    0.0521), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0509), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT16_C(28978),
+      { SIMDE_FLOAT32_C(  986.9900), SIMDE_FLOAT32_C(  830.0700), SIMDE_FLOAT32_C(  492.8200), SIMDE_FLOAT32_C(  129.6500),
+        SIMDE_FLOAT32_C(  875.9500), SIMDE_FLOAT32_C(  830.9700), SIMDE_FLOAT32_C(  789.3300), SIMDE_FLOAT32_C(  610.4500),
+        SIMDE_FLOAT32_C(  211.0300), SIMDE_FLOAT32_C(  677.5500), SIMDE_FLOAT32_C(  196.1600), SIMDE_FLOAT32_C(  322.0500),
+        SIMDE_FLOAT32_C(  380.2300), SIMDE_FLOAT32_C(  100.5200), SIMDE_FLOAT32_C(  957.2600), SIMDE_FLOAT32_C(   53.7000) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0347), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0338), SIMDE_FLOAT32_C(    0.0347), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0688), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0513), SIMDE_FLOAT32_C(    0.0997), SIMDE_FLOAT32_C(    0.0323), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT16_C(23231),
+      { SIMDE_FLOAT32_C(  381.3500), SIMDE_FLOAT32_C(  609.7100), SIMDE_FLOAT32_C(  231.3600), SIMDE_FLOAT32_C(  588.9900),
+        SIMDE_FLOAT32_C(  937.3400), SIMDE_FLOAT32_C(  610.6500), SIMDE_FLOAT32_C(  256.0600), SIMDE_FLOAT32_C(  388.6700),
+        SIMDE_FLOAT32_C(  758.5900), SIMDE_FLOAT32_C(  751.9000), SIMDE_FLOAT32_C(  897.2400), SIMDE_FLOAT32_C(  400.0500),
+        SIMDE_FLOAT32_C(  929.5300), SIMDE_FLOAT32_C(  972.7500), SIMDE_FLOAT32_C(  122.9500), SIMDE_FLOAT32_C(  654.2900) },
+      { SIMDE_FLOAT32_C(    0.0512), SIMDE_FLOAT32_C(    0.0405), SIMDE_FLOAT32_C(    0.0657), SIMDE_FLOAT32_C(    0.0412),
+        SIMDE_FLOAT32_C(    0.0327), SIMDE_FLOAT32_C(    0.0405), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0507),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0365), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0500),
+        SIMDE_FLOAT32_C(    0.0328), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0902), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT16_C(43465),
+      { SIMDE_FLOAT32_C(  242.4600), SIMDE_FLOAT32_C(  985.7200), SIMDE_FLOAT32_C(  513.3300), SIMDE_FLOAT32_C(  169.5400),
+        SIMDE_FLOAT32_C(  526.4700), SIMDE_FLOAT32_C(  358.1500), SIMDE_FLOAT32_C(  829.2800), SIMDE_FLOAT32_C(  226.0700),
+        SIMDE_FLOAT32_C(  926.8300), SIMDE_FLOAT32_C(  583.7400), SIMDE_FLOAT32_C(  120.1800), SIMDE_FLOAT32_C(  252.7000),
+        SIMDE_FLOAT32_C(  157.6800), SIMDE_FLOAT32_C(   30.9200), SIMDE_FLOAT32_C(  620.8600), SIMDE_FLOAT32_C(   41.9700) },
+      { SIMDE_FLOAT32_C(    0.0642), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0768),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0347), SIMDE_FLOAT32_C(    0.0665),
+        SIMDE_FLOAT32_C(    0.0328), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0629),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.1798), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.1544) } },
+    { UINT16_C(37240),
+      { SIMDE_FLOAT32_C(  993.5000), SIMDE_FLOAT32_C(   31.4600), SIMDE_FLOAT32_C(  877.4300), SIMDE_FLOAT32_C(  423.0400),
+        SIMDE_FLOAT32_C(  238.9400), SIMDE_FLOAT32_C(  424.5800), SIMDE_FLOAT32_C(  509.6100), SIMDE_FLOAT32_C(  508.0900),
+        SIMDE_FLOAT32_C(   92.7200), SIMDE_FLOAT32_C(  654.7700), SIMDE_FLOAT32_C(  412.1600), SIMDE_FLOAT32_C(  300.7400),
+        SIMDE_FLOAT32_C(  277.2900), SIMDE_FLOAT32_C(  674.4700), SIMDE_FLOAT32_C(  295.1500), SIMDE_FLOAT32_C(  177.6000) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0486),
+        SIMDE_FLOAT32_C(    0.0647), SIMDE_FLOAT32_C(    0.0485), SIMDE_FLOAT32_C(    0.0443), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.1039), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0601), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0750) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_maskz_rsqrt14_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_rsqrt14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  814.8200), SIMDE_FLOAT64_C(  529.5900), SIMDE_FLOAT64_C(  319.2000), SIMDE_FLOAT64_C(  464.1600),
+        SIMDE_FLOAT64_C(  117.0800), SIMDE_FLOAT64_C(  438.2400), SIMDE_FLOAT64_C(  932.8700), SIMDE_FLOAT64_C(  350.2500) },
+      { SIMDE_FLOAT64_C(    0.0350), SIMDE_FLOAT64_C(    0.0435), SIMDE_FLOAT64_C(    0.0560), SIMDE_FLOAT64_C(    0.0464),
+        SIMDE_FLOAT64_C(    0.0924), SIMDE_FLOAT64_C(    0.0478), SIMDE_FLOAT64_C(    0.0327), SIMDE_FLOAT64_C(    0.0534) } },
+    { { SIMDE_FLOAT64_C(  853.4800), SIMDE_FLOAT64_C(  403.1900), SIMDE_FLOAT64_C(  855.3400), SIMDE_FLOAT64_C(  424.3500),
+        SIMDE_FLOAT64_C(  289.2200), SIMDE_FLOAT64_C(  420.9000), SIMDE_FLOAT64_C(  224.3700), SIMDE_FLOAT64_C(  642.6100) },
+      { SIMDE_FLOAT64_C(    0.0342), SIMDE_FLOAT64_C(    0.0498), SIMDE_FLOAT64_C(    0.0342), SIMDE_FLOAT64_C(    0.0485),
+        SIMDE_FLOAT64_C(    0.0588), SIMDE_FLOAT64_C(    0.0487), SIMDE_FLOAT64_C(    0.0668), SIMDE_FLOAT64_C(    0.0394) } },
+    { { SIMDE_FLOAT64_C(  246.5000), SIMDE_FLOAT64_C(  301.4200), SIMDE_FLOAT64_C(  873.7700), SIMDE_FLOAT64_C(   73.3200),
+        SIMDE_FLOAT64_C(  390.9800), SIMDE_FLOAT64_C(  428.0300), SIMDE_FLOAT64_C(  183.9100), SIMDE_FLOAT64_C(  733.1000) },
+      { SIMDE_FLOAT64_C(    0.0637), SIMDE_FLOAT64_C(    0.0576), SIMDE_FLOAT64_C(    0.0338), SIMDE_FLOAT64_C(    0.1168),
+        SIMDE_FLOAT64_C(    0.0506), SIMDE_FLOAT64_C(    0.0483), SIMDE_FLOAT64_C(    0.0737), SIMDE_FLOAT64_C(    0.0369) } },
+    { { SIMDE_FLOAT64_C(   68.3100), SIMDE_FLOAT64_C(  741.8700), SIMDE_FLOAT64_C(  500.1100), SIMDE_FLOAT64_C(  552.5900),
+        SIMDE_FLOAT64_C(  138.6800), SIMDE_FLOAT64_C(  116.0600), SIMDE_FLOAT64_C(  268.3600), SIMDE_FLOAT64_C(   70.1300) },
+      { SIMDE_FLOAT64_C(    0.1210), SIMDE_FLOAT64_C(    0.0367), SIMDE_FLOAT64_C(    0.0447), SIMDE_FLOAT64_C(    0.0425),
+        SIMDE_FLOAT64_C(    0.0849), SIMDE_FLOAT64_C(    0.0928), SIMDE_FLOAT64_C(    0.0610), SIMDE_FLOAT64_C(    0.1194) } },
+    { { SIMDE_FLOAT64_C(  107.0000), SIMDE_FLOAT64_C(  653.5700), SIMDE_FLOAT64_C(   74.8200), SIMDE_FLOAT64_C(  471.8500),
+        SIMDE_FLOAT64_C(   91.0600), SIMDE_FLOAT64_C(  791.8800), SIMDE_FLOAT64_C(  915.4300), SIMDE_FLOAT64_C(  552.6900) },
+      { SIMDE_FLOAT64_C(    0.0967), SIMDE_FLOAT64_C(    0.0391), SIMDE_FLOAT64_C(    0.1156), SIMDE_FLOAT64_C(    0.0460),
+        SIMDE_FLOAT64_C(    0.1048), SIMDE_FLOAT64_C(    0.0355), SIMDE_FLOAT64_C(    0.0331), SIMDE_FLOAT64_C(    0.0425) } },
+    { { SIMDE_FLOAT64_C(  117.9000), SIMDE_FLOAT64_C(  753.4500), SIMDE_FLOAT64_C(  985.6400), SIMDE_FLOAT64_C(   96.2300),
+        SIMDE_FLOAT64_C(  124.5300), SIMDE_FLOAT64_C(  290.5700), SIMDE_FLOAT64_C(  360.8100), SIMDE_FLOAT64_C(  409.7000) },
+      { SIMDE_FLOAT64_C(    0.0921), SIMDE_FLOAT64_C(    0.0364), SIMDE_FLOAT64_C(    0.0319), SIMDE_FLOAT64_C(    0.1019),
+        SIMDE_FLOAT64_C(    0.0896), SIMDE_FLOAT64_C(    0.0587), SIMDE_FLOAT64_C(    0.0526), SIMDE_FLOAT64_C(    0.0494) } },
+    { { SIMDE_FLOAT64_C(  809.0000), SIMDE_FLOAT64_C(  448.3400), SIMDE_FLOAT64_C(  370.5100), SIMDE_FLOAT64_C(   83.1200),
+        SIMDE_FLOAT64_C(  476.4400), SIMDE_FLOAT64_C(  393.5500), SIMDE_FLOAT64_C(  535.9300), SIMDE_FLOAT64_C(  393.0100) },
+      { SIMDE_FLOAT64_C(    0.0352), SIMDE_FLOAT64_C(    0.0472), SIMDE_FLOAT64_C(    0.0520), SIMDE_FLOAT64_C(    0.1097),
+        SIMDE_FLOAT64_C(    0.0458), SIMDE_FLOAT64_C(    0.0504), SIMDE_FLOAT64_C(    0.0432), SIMDE_FLOAT64_C(    0.0504) } },
+    { { SIMDE_FLOAT64_C(  484.9500), SIMDE_FLOAT64_C(  349.6900), SIMDE_FLOAT64_C(  629.6800), SIMDE_FLOAT64_C(  259.6800),
+        SIMDE_FLOAT64_C(  311.9600), SIMDE_FLOAT64_C(  314.0300), SIMDE_FLOAT64_C(  644.3300), SIMDE_FLOAT64_C(  253.6000) },
+      { SIMDE_FLOAT64_C(    0.0454), SIMDE_FLOAT64_C(    0.0535), SIMDE_FLOAT64_C(    0.0399), SIMDE_FLOAT64_C(    0.0621),
+        SIMDE_FLOAT64_C(    0.0566), SIMDE_FLOAT64_C(    0.0564), SIMDE_FLOAT64_C(    0.0394), SIMDE_FLOAT64_C(    0.0628) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_rsqrt14_pd(a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_rsqrt14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[8];
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  843.3300), SIMDE_FLOAT64_C(  855.5000), SIMDE_FLOAT64_C(  928.7300), SIMDE_FLOAT64_C(  452.7200),
+        SIMDE_FLOAT64_C(  604.2100), SIMDE_FLOAT64_C(  733.2000), SIMDE_FLOAT64_C(  376.4900), SIMDE_FLOAT64_C(  746.3200) },
+      UINT8_C( 26),
+      { SIMDE_FLOAT64_C(   24.9300), SIMDE_FLOAT64_C(  541.1900), SIMDE_FLOAT64_C(  154.8000), SIMDE_FLOAT64_C(  153.7300),
+        SIMDE_FLOAT64_C(  848.1700), SIMDE_FLOAT64_C(  103.6400), SIMDE_FLOAT64_C(  835.7200), SIMDE_FLOAT64_C(  770.4100) },
+      { SIMDE_FLOAT64_C(  843.3300), SIMDE_FLOAT64_C(    0.0430), SIMDE_FLOAT64_C(  928.7300), SIMDE_FLOAT64_C(    0.0807),
+        SIMDE_FLOAT64_C(    0.0343), SIMDE_FLOAT64_C(  733.2000), SIMDE_FLOAT64_C(  376.4900), SIMDE_FLOAT64_C(  746.3200) } },
+    { { SIMDE_FLOAT64_C(  724.4300), SIMDE_FLOAT64_C(  956.5600), SIMDE_FLOAT64_C(  791.4500), SIMDE_FLOAT64_C(   22.8800),
+        SIMDE_FLOAT64_C(  843.4600), SIMDE_FLOAT64_C(  598.6900), SIMDE_FLOAT64_C(  230.5300), SIMDE_FLOAT64_C(  653.7300) },
+      UINT8_C(221),
+      { SIMDE_FLOAT64_C(  551.4400), SIMDE_FLOAT64_C(  183.4000), SIMDE_FLOAT64_C(  215.8100), SIMDE_FLOAT64_C(   79.3200),
+        SIMDE_FLOAT64_C(  326.9400), SIMDE_FLOAT64_C(  190.8200), SIMDE_FLOAT64_C(  512.5700), SIMDE_FLOAT64_C(  795.1700) },
+      { SIMDE_FLOAT64_C(    0.0426), SIMDE_FLOAT64_C(  956.5600), SIMDE_FLOAT64_C(    0.0681), SIMDE_FLOAT64_C(    0.1123),
+        SIMDE_FLOAT64_C(    0.0553), SIMDE_FLOAT64_C(  598.6900), SIMDE_FLOAT64_C(    0.0442), SIMDE_FLOAT64_C(    0.0355) } },
+    { { SIMDE_FLOAT64_C(  901.5300), SIMDE_FLOAT64_C(   61.5900), SIMDE_FLOAT64_C(  875.3700), SIMDE_FLOAT64_C(  209.2700),
+        SIMDE_FLOAT64_C(  456.6300), SIMDE_FLOAT64_C(  109.6700), SIMDE_FLOAT64_C(  832.9400), SIMDE_FLOAT64_C(  685.1000) },
+      UINT8_C(147),
+      { SIMDE_FLOAT64_C(  764.9700), SIMDE_FLOAT64_C(  732.7900), SIMDE_FLOAT64_C(  495.2300), SIMDE_FLOAT64_C(  256.2200),
+        SIMDE_FLOAT64_C(  394.1700), SIMDE_FLOAT64_C(  695.1600), SIMDE_FLOAT64_C(   92.6300), SIMDE_FLOAT64_C(  753.9900) },
+      { SIMDE_FLOAT64_C(    0.0362), SIMDE_FLOAT64_C(    0.0369), SIMDE_FLOAT64_C(  875.3700), SIMDE_FLOAT64_C(  209.2700),
+        SIMDE_FLOAT64_C(    0.0504), SIMDE_FLOAT64_C(  109.6700), SIMDE_FLOAT64_C(  832.9400), SIMDE_FLOAT64_C(    0.0364) } },
+    { { SIMDE_FLOAT64_C(  990.0900), SIMDE_FLOAT64_C(  218.7300), SIMDE_FLOAT64_C(  868.9300), SIMDE_FLOAT64_C(  729.0100),
+        SIMDE_FLOAT64_C(  871.7200), SIMDE_FLOAT64_C(  584.5700), SIMDE_FLOAT64_C(   39.1100), SIMDE_FLOAT64_C(  431.8900) },
+      UINT8_C( 62),
+      { SIMDE_FLOAT64_C(  907.5400), SIMDE_FLOAT64_C(  875.6600), SIMDE_FLOAT64_C(  531.8000), SIMDE_FLOAT64_C(  950.6300),
+        SIMDE_FLOAT64_C(  942.9700), SIMDE_FLOAT64_C(  806.5000), SIMDE_FLOAT64_C(  375.4700), SIMDE_FLOAT64_C(  177.8100) },
+      { SIMDE_FLOAT64_C(  990.0900), SIMDE_FLOAT64_C(    0.0338), SIMDE_FLOAT64_C(    0.0434), SIMDE_FLOAT64_C(    0.0324),
+        SIMDE_FLOAT64_C(    0.0326), SIMDE_FLOAT64_C(    0.0352), SIMDE_FLOAT64_C(   39.1100), SIMDE_FLOAT64_C(  431.8900) } },
+    { { SIMDE_FLOAT64_C(  343.1600), SIMDE_FLOAT64_C(  481.6200), SIMDE_FLOAT64_C(  267.1600), SIMDE_FLOAT64_C(  119.8300),
+        SIMDE_FLOAT64_C(  307.3300), SIMDE_FLOAT64_C(  260.0200), SIMDE_FLOAT64_C(  469.0400), SIMDE_FLOAT64_C(   46.1900) },
+      UINT8_C(192),
+      { SIMDE_FLOAT64_C(  337.8600), SIMDE_FLOAT64_C(  685.8800), SIMDE_FLOAT64_C(   51.2700), SIMDE_FLOAT64_C(  123.3000),
+        SIMDE_FLOAT64_C(  954.8500), SIMDE_FLOAT64_C(  465.0400), SIMDE_FLOAT64_C(  763.0200), SIMDE_FLOAT64_C(  441.6200) },
+      { SIMDE_FLOAT64_C(  343.1600), SIMDE_FLOAT64_C(  481.6200), SIMDE_FLOAT64_C(  267.1600), SIMDE_FLOAT64_C(  119.8300),
+        SIMDE_FLOAT64_C(  307.3300), SIMDE_FLOAT64_C(  260.0200), SIMDE_FLOAT64_C(    0.0362), SIMDE_FLOAT64_C(    0.0476) } },
+    { { SIMDE_FLOAT64_C(  833.9100), SIMDE_FLOAT64_C(  277.0800), SIMDE_FLOAT64_C(  667.1700), SIMDE_FLOAT64_C(  863.6300),
+        SIMDE_FLOAT64_C(  415.8000), SIMDE_FLOAT64_C(  657.8700), SIMDE_FLOAT64_C(  820.0500), SIMDE_FLOAT64_C(  911.7500) },
+      UINT8_C( 14),
+      { SIMDE_FLOAT64_C(  631.2100), SIMDE_FLOAT64_C(  447.5700), SIMDE_FLOAT64_C(    9.7400), SIMDE_FLOAT64_C(  887.5500),
+        SIMDE_FLOAT64_C(  934.7700), SIMDE_FLOAT64_C(  932.1800), SIMDE_FLOAT64_C(  954.7100), SIMDE_FLOAT64_C(  613.9900) },
+      { SIMDE_FLOAT64_C(  833.9100), SIMDE_FLOAT64_C(    0.0473), SIMDE_FLOAT64_C(    0.3204), SIMDE_FLOAT64_C(    0.0336),
+        SIMDE_FLOAT64_C(  415.8000), SIMDE_FLOAT64_C(  657.8700), SIMDE_FLOAT64_C(  820.0500), SIMDE_FLOAT64_C(  911.7500) } },
+    { { SIMDE_FLOAT64_C(  858.2300), SIMDE_FLOAT64_C(  501.9500), SIMDE_FLOAT64_C(  840.9500), SIMDE_FLOAT64_C(   67.5700),
+        SIMDE_FLOAT64_C(  578.3600), SIMDE_FLOAT64_C(  792.4300), SIMDE_FLOAT64_C(  631.4700), SIMDE_FLOAT64_C(  669.8600) },
+      UINT8_C( 72),
+      { SIMDE_FLOAT64_C(  731.4500), SIMDE_FLOAT64_C(   96.7800), SIMDE_FLOAT64_C(  264.4300), SIMDE_FLOAT64_C(  105.1900),
+        SIMDE_FLOAT64_C(  492.9200), SIMDE_FLOAT64_C(  144.9200), SIMDE_FLOAT64_C(  203.9900), SIMDE_FLOAT64_C(  687.9900) },
+      { SIMDE_FLOAT64_C(  858.2300), SIMDE_FLOAT64_C(  501.9500), SIMDE_FLOAT64_C(  840.9500), SIMDE_FLOAT64_C(    0.0975),
+        SIMDE_FLOAT64_C(  578.3600), SIMDE_FLOAT64_C(  792.4300), SIMDE_FLOAT64_C(    0.0700), SIMDE_FLOAT64_C(  669.8600) } },
+    { { SIMDE_FLOAT64_C(  654.2800), SIMDE_FLOAT64_C(  183.6700), SIMDE_FLOAT64_C(  223.8400), SIMDE_FLOAT64_C(  404.3500),
+        SIMDE_FLOAT64_C(  531.5700), SIMDE_FLOAT64_C(  369.6700), SIMDE_FLOAT64_C(  328.4900), SIMDE_FLOAT64_C(  852.1900) },
+      UINT8_C( 41),
+      { SIMDE_FLOAT64_C(  593.2500), SIMDE_FLOAT64_C(  293.2500), SIMDE_FLOAT64_C(  701.1800), SIMDE_FLOAT64_C(  557.1500),
+        SIMDE_FLOAT64_C(  919.9000), SIMDE_FLOAT64_C(  431.6400), SIMDE_FLOAT64_C(  705.0000), SIMDE_FLOAT64_C(  249.5700) },
+      { SIMDE_FLOAT64_C(    0.0411), SIMDE_FLOAT64_C(  183.6700), SIMDE_FLOAT64_C(  223.8400), SIMDE_FLOAT64_C(    0.0424),
+        SIMDE_FLOAT64_C(  531.5700), SIMDE_FLOAT64_C(    0.0481), SIMDE_FLOAT64_C(  328.4900), SIMDE_FLOAT64_C(  852.1900) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d src = simde_mm512_loadu_pd(test_vec[i].src);
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_mask_rsqrt14_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_rsqrt14_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { UINT8_C( 77),
+      { SIMDE_FLOAT64_C(  174.8000), SIMDE_FLOAT64_C(  217.9500), SIMDE_FLOAT64_C(  794.5000), SIMDE_FLOAT64_C(  951.9200),
+        SIMDE_FLOAT64_C(   77.4700), SIMDE_FLOAT64_C(  238.9600), SIMDE_FLOAT64_C(  520.0600), SIMDE_FLOAT64_C(  525.3400) },
+      { SIMDE_FLOAT64_C(    0.0756), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0355), SIMDE_FLOAT64_C(    0.0324),
+        SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0439), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C(142),
+      { SIMDE_FLOAT64_C(   33.6900), SIMDE_FLOAT64_C(  968.4000), SIMDE_FLOAT64_C(  112.5500), SIMDE_FLOAT64_C(  327.4100),
+        SIMDE_FLOAT64_C(  905.7100), SIMDE_FLOAT64_C(  425.7600), SIMDE_FLOAT64_C(  599.9600), SIMDE_FLOAT64_C(    2.8300) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0321), SIMDE_FLOAT64_C(    0.0943), SIMDE_FLOAT64_C(    0.0553),
+        SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.5944) } },
+    { UINT8_C( 34),
+      { SIMDE_FLOAT64_C(  399.9200), SIMDE_FLOAT64_C(  171.9800), SIMDE_FLOAT64_C(  251.1000), SIMDE_FLOAT64_C(  198.7400),
+        SIMDE_FLOAT64_C(  143.8700), SIMDE_FLOAT64_C(  278.3100), SIMDE_FLOAT64_C(  266.7500), SIMDE_FLOAT64_C(  760.1000) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0763), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0599), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C(106),
+      { SIMDE_FLOAT64_C(   55.4300), SIMDE_FLOAT64_C(  524.6200), SIMDE_FLOAT64_C(  186.0000), SIMDE_FLOAT64_C(  943.2200),
+        SIMDE_FLOAT64_C(  438.6700), SIMDE_FLOAT64_C(  659.4300), SIMDE_FLOAT64_C(  104.3600), SIMDE_FLOAT64_C(  244.3100) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0437), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0326),
+        SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0389), SIMDE_FLOAT64_C(    0.0979), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C(151),
+      { SIMDE_FLOAT64_C(  295.2600), SIMDE_FLOAT64_C(  883.0600), SIMDE_FLOAT64_C(  191.3900), SIMDE_FLOAT64_C(  624.5200),
+        SIMDE_FLOAT64_C(  781.6400), SIMDE_FLOAT64_C(  515.0500), SIMDE_FLOAT64_C(   63.3800), SIMDE_FLOAT64_C(  394.5200) },
+      { SIMDE_FLOAT64_C(    0.0582), SIMDE_FLOAT64_C(    0.0337), SIMDE_FLOAT64_C(    0.0723), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(    0.0358), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0503) } },
+    { UINT8_C(  0),
+      { SIMDE_FLOAT64_C(  350.1800), SIMDE_FLOAT64_C(  236.4600), SIMDE_FLOAT64_C(  466.5700), SIMDE_FLOAT64_C(  825.2600),
+        SIMDE_FLOAT64_C(  849.4000), SIMDE_FLOAT64_C(  104.8800), SIMDE_FLOAT64_C(  204.8800), SIMDE_FLOAT64_C(  860.4700) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C( 79),
+      { SIMDE_FLOAT64_C(  947.8800), SIMDE_FLOAT64_C(  710.4400), SIMDE_FLOAT64_C(  100.4600), SIMDE_FLOAT64_C(  219.2700),
+        SIMDE_FLOAT64_C(  858.8900), SIMDE_FLOAT64_C(  760.7700), SIMDE_FLOAT64_C(  462.2800), SIMDE_FLOAT64_C(  988.0700) },
+      { SIMDE_FLOAT64_C(    0.0325), SIMDE_FLOAT64_C(    0.0375), SIMDE_FLOAT64_C(    0.0998), SIMDE_FLOAT64_C(    0.0675),
+        SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0465), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C(103),
+      { SIMDE_FLOAT64_C(   16.3400), SIMDE_FLOAT64_C(  798.3700), SIMDE_FLOAT64_C(  972.1700), SIMDE_FLOAT64_C(  321.2900),
+        SIMDE_FLOAT64_C(  945.9800), SIMDE_FLOAT64_C(  351.1900), SIMDE_FLOAT64_C(  749.9400), SIMDE_FLOAT64_C(  135.2900) },
+      { SIMDE_FLOAT64_C(    0.2474), SIMDE_FLOAT64_C(    0.0354), SIMDE_FLOAT64_C(    0.0321), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0534), SIMDE_FLOAT64_C(    0.0365), SIMDE_FLOAT64_C(    0.0000) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_maskz_rsqrt14_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_rsqrt14_ss (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[4];
+    const simde_float32 b[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  675.6600), SIMDE_FLOAT32_C(  727.0300), SIMDE_FLOAT32_C(   82.6600), SIMDE_FLOAT32_C(  872.4500) },
+      { SIMDE_FLOAT32_C(  231.0200), SIMDE_FLOAT32_C(  475.2000), SIMDE_FLOAT32_C(  386.0900), SIMDE_FLOAT32_C(  986.2600) },
+      { SIMDE_FLOAT32_C(    0.0658), SIMDE_FLOAT32_C(  727.0300), SIMDE_FLOAT32_C(   82.6600), SIMDE_FLOAT32_C(  872.4500) } },
+    { { SIMDE_FLOAT32_C(  817.9900), SIMDE_FLOAT32_C(  218.7400), SIMDE_FLOAT32_C(  294.0300), SIMDE_FLOAT32_C(  583.6700) },
+      { SIMDE_FLOAT32_C(  146.0800), SIMDE_FLOAT32_C(  378.5500), SIMDE_FLOAT32_C(  336.3800), SIMDE_FLOAT32_C(  357.7200) },
+      { SIMDE_FLOAT32_C(    0.0827), SIMDE_FLOAT32_C(  218.7400), SIMDE_FLOAT32_C(  294.0300), SIMDE_FLOAT32_C(  583.6700) } },
+    { { SIMDE_FLOAT32_C(  494.3100), SIMDE_FLOAT32_C(  975.1400), SIMDE_FLOAT32_C(  664.5400), SIMDE_FLOAT32_C(  113.9900) },
+      { SIMDE_FLOAT32_C(  457.8500), SIMDE_FLOAT32_C(  267.6700), SIMDE_FLOAT32_C(  656.7500), SIMDE_FLOAT32_C(  669.1300) },
+      { SIMDE_FLOAT32_C(    0.0467), SIMDE_FLOAT32_C(  975.1400), SIMDE_FLOAT32_C(  664.5400), SIMDE_FLOAT32_C(  113.9900) } },
+    { { SIMDE_FLOAT32_C(  793.4500), SIMDE_FLOAT32_C(  326.7200), SIMDE_FLOAT32_C(  591.7300), SIMDE_FLOAT32_C(  533.0400) },
+      { SIMDE_FLOAT32_C(  125.7800), SIMDE_FLOAT32_C(  340.7200), SIMDE_FLOAT32_C(  775.3600), SIMDE_FLOAT32_C(  663.3700) },
+      { SIMDE_FLOAT32_C(    0.0892), SIMDE_FLOAT32_C(  326.7200), SIMDE_FLOAT32_C(  591.7300), SIMDE_FLOAT32_C(  533.0400) } },
+    { { SIMDE_FLOAT32_C(  942.3100), SIMDE_FLOAT32_C(   71.0400), SIMDE_FLOAT32_C(  762.1300), SIMDE_FLOAT32_C(  902.5300) },
+      { SIMDE_FLOAT32_C(  125.2700), SIMDE_FLOAT32_C(  374.1400), SIMDE_FLOAT32_C(  397.4700), SIMDE_FLOAT32_C(  368.7200) },
+      { SIMDE_FLOAT32_C(    0.0893), SIMDE_FLOAT32_C(   71.0400), SIMDE_FLOAT32_C(  762.1300), SIMDE_FLOAT32_C(  902.5300) } },
+    { { SIMDE_FLOAT32_C(  771.8900), SIMDE_FLOAT32_C(  232.0100), SIMDE_FLOAT32_C(  134.8300), SIMDE_FLOAT32_C(  347.9500) },
+      { SIMDE_FLOAT32_C(  428.4200), SIMDE_FLOAT32_C(  614.3700), SIMDE_FLOAT32_C(  385.4800), SIMDE_FLOAT32_C(  416.0400) },
+      { SIMDE_FLOAT32_C(    0.0483), SIMDE_FLOAT32_C(  232.0100), SIMDE_FLOAT32_C(  134.8300), SIMDE_FLOAT32_C(  347.9500) } },
+    { { SIMDE_FLOAT32_C(  929.5800), SIMDE_FLOAT32_C(  487.7100), SIMDE_FLOAT32_C(   26.4200), SIMDE_FLOAT32_C(    2.8000) },
+      { SIMDE_FLOAT32_C(  648.1900), SIMDE_FLOAT32_C(  996.6400), SIMDE_FLOAT32_C(    1.6900), SIMDE_FLOAT32_C(  990.8100) },
+      { SIMDE_FLOAT32_C(    0.0393), SIMDE_FLOAT32_C(  487.7100), SIMDE_FLOAT32_C(   26.4200), SIMDE_FLOAT32_C(    2.8000) } },
+    { { SIMDE_FLOAT32_C(  383.0700), SIMDE_FLOAT32_C(  462.2700), SIMDE_FLOAT32_C(  344.9400), SIMDE_FLOAT32_C(  911.3200) },
+      { SIMDE_FLOAT32_C(  644.5700), SIMDE_FLOAT32_C(  954.5900), SIMDE_FLOAT32_C(  403.3000), SIMDE_FLOAT32_C(  926.7100) },
+      { SIMDE_FLOAT32_C(    0.0394), SIMDE_FLOAT32_C(  462.2700), SIMDE_FLOAT32_C(  344.9400), SIMDE_FLOAT32_C(  911.3200) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 b = simde_mm_loadu_ps(test_vec[i].b);
+    simde__m128 r = simde_mm_rsqrt14_ss(a, b);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_rsqrt14_ss (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[4];
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const simde_float32 b[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  638.1800), SIMDE_FLOAT32_C(  913.0000), SIMDE_FLOAT32_C(  689.2700), SIMDE_FLOAT32_C(   77.4800) },
+      UINT8_C( 23),
+      { SIMDE_FLOAT32_C(  549.4600), SIMDE_FLOAT32_C(   14.2600), SIMDE_FLOAT32_C(  137.4500), SIMDE_FLOAT32_C(  932.9600) },
+      { SIMDE_FLOAT32_C(  649.3500), SIMDE_FLOAT32_C(  691.1700), SIMDE_FLOAT32_C(  417.2700), SIMDE_FLOAT32_C(  358.2900) },
+      { SIMDE_FLOAT32_C(    0.0392), SIMDE_FLOAT32_C(   14.2600), SIMDE_FLOAT32_C(  137.4500), SIMDE_FLOAT32_C(  932.9600) } },
+    { { SIMDE_FLOAT32_C(  684.2500), SIMDE_FLOAT32_C(  932.7800), SIMDE_FLOAT32_C(  540.7100), SIMDE_FLOAT32_C(  639.6500) },
+      UINT8_C( 35),
+      { SIMDE_FLOAT32_C(  644.8300), SIMDE_FLOAT32_C(  620.6600), SIMDE_FLOAT32_C(  835.2000), SIMDE_FLOAT32_C(  935.4000) },
+      { SIMDE_FLOAT32_C(  311.4200), SIMDE_FLOAT32_C(  378.0900), SIMDE_FLOAT32_C(  713.0700), SIMDE_FLOAT32_C(  837.7100) },
+      { SIMDE_FLOAT32_C(    0.0567), SIMDE_FLOAT32_C(  620.6600), SIMDE_FLOAT32_C(  835.2000), SIMDE_FLOAT32_C(  935.4000) } },
+    { { SIMDE_FLOAT32_C(  540.0600), SIMDE_FLOAT32_C(  952.7500), SIMDE_FLOAT32_C(  855.9700), SIMDE_FLOAT32_C(   60.0600) },
+      UINT8_C( 35),
+      { SIMDE_FLOAT32_C(  707.4600), SIMDE_FLOAT32_C(  268.6500), SIMDE_FLOAT32_C(  181.6000), SIMDE_FLOAT32_C(  311.1500) },
+      { SIMDE_FLOAT32_C(  700.1600), SIMDE_FLOAT32_C(  676.8000), SIMDE_FLOAT32_C(  562.5400), SIMDE_FLOAT32_C(  680.7400) },
+      { SIMDE_FLOAT32_C(    0.0378), SIMDE_FLOAT32_C(  268.6500), SIMDE_FLOAT32_C(  181.6000), SIMDE_FLOAT32_C(  311.1500) } },
+    { { SIMDE_FLOAT32_C(  243.7400), SIMDE_FLOAT32_C(  260.9700), SIMDE_FLOAT32_C(   16.3900), SIMDE_FLOAT32_C(  275.4700) },
+      UINT8_C(  1),
+      { SIMDE_FLOAT32_C(  236.6900), SIMDE_FLOAT32_C(  967.4500), SIMDE_FLOAT32_C(  208.3100), SIMDE_FLOAT32_C(  308.5900) },
+      { SIMDE_FLOAT32_C(  900.7700), SIMDE_FLOAT32_C(  212.0900), SIMDE_FLOAT32_C(  590.8200), SIMDE_FLOAT32_C(  738.9000) },
+      { SIMDE_FLOAT32_C(    0.0333), SIMDE_FLOAT32_C(  967.4500), SIMDE_FLOAT32_C(  208.3100), SIMDE_FLOAT32_C(  308.5900) } },
+    { { SIMDE_FLOAT32_C(  364.3900), SIMDE_FLOAT32_C(  632.9700), SIMDE_FLOAT32_C(  510.4600), SIMDE_FLOAT32_C(  739.8500) },
+      UINT8_C(  0),
+      { SIMDE_FLOAT32_C(  879.5200), SIMDE_FLOAT32_C(  114.5400), SIMDE_FLOAT32_C(  636.0700), SIMDE_FLOAT32_C(  926.7700) },
+      { SIMDE_FLOAT32_C(  379.4300), SIMDE_FLOAT32_C(  124.6700), SIMDE_FLOAT32_C(  267.5200), SIMDE_FLOAT32_C(  167.7600) },
+      { SIMDE_FLOAT32_C(  364.3900), SIMDE_FLOAT32_C(  114.5400), SIMDE_FLOAT32_C(  636.0700), SIMDE_FLOAT32_C(  926.7700) } },
+    { { SIMDE_FLOAT32_C(  723.8700), SIMDE_FLOAT32_C(  650.4700), SIMDE_FLOAT32_C(  991.4100), SIMDE_FLOAT32_C(  523.6200) },
+      UINT8_C(  4),
+      { SIMDE_FLOAT32_C(  528.7100), SIMDE_FLOAT32_C(  452.1400), SIMDE_FLOAT32_C(  652.9600), SIMDE_FLOAT32_C(  608.1100) },
+      { SIMDE_FLOAT32_C(  151.2100), SIMDE_FLOAT32_C(  518.8800), SIMDE_FLOAT32_C(  730.7800), SIMDE_FLOAT32_C(  753.7700) },
+      { SIMDE_FLOAT32_C(  723.8700), SIMDE_FLOAT32_C(  452.1400), SIMDE_FLOAT32_C(  652.9600), SIMDE_FLOAT32_C(  608.1100) } },
+    { { SIMDE_FLOAT32_C(  837.3000), SIMDE_FLOAT32_C(  985.7800), SIMDE_FLOAT32_C(   54.5700), SIMDE_FLOAT32_C(  435.7300) },
+      UINT8_C( 43),
+      { SIMDE_FLOAT32_C(  381.4400), SIMDE_FLOAT32_C(  621.1400), SIMDE_FLOAT32_C(  518.9500), SIMDE_FLOAT32_C(   29.3900) },
+      { SIMDE_FLOAT32_C(  958.9400), SIMDE_FLOAT32_C(  172.3500), SIMDE_FLOAT32_C(  108.4900), SIMDE_FLOAT32_C(  407.2400) },
+      { SIMDE_FLOAT32_C(    0.0323), SIMDE_FLOAT32_C(  621.1400), SIMDE_FLOAT32_C(  518.9500), SIMDE_FLOAT32_C(   29.3900) } },
+    { { SIMDE_FLOAT32_C(   78.6100), SIMDE_FLOAT32_C(  979.5800), SIMDE_FLOAT32_C(  430.2100), SIMDE_FLOAT32_C(  335.5800) },
+      UINT8_C(147),
+      { SIMDE_FLOAT32_C(  105.0000), SIMDE_FLOAT32_C(  381.7100), SIMDE_FLOAT32_C(  928.5500), SIMDE_FLOAT32_C(  640.4000) },
+      { SIMDE_FLOAT32_C(  353.4400), SIMDE_FLOAT32_C(   73.1300), SIMDE_FLOAT32_C(  826.3700), SIMDE_FLOAT32_C(  536.4600) },
+      { SIMDE_FLOAT32_C(    0.0532), SIMDE_FLOAT32_C(  381.7100), SIMDE_FLOAT32_C(  928.5500), SIMDE_FLOAT32_C(  640.4000) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 src = simde_mm_loadu_ps(test_vec[i].src);
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 b = simde_mm_loadu_ps(test_vec[i].b);
+    simde__m128 r = simde_mm_mask_rsqrt14_ss(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_rsqrt14_ss (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float32 a[4];
+    const simde_float32 b[4];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { UINT8_C(  9),
+      { SIMDE_FLOAT32_C(  696.8100), SIMDE_FLOAT32_C(  523.6500), SIMDE_FLOAT32_C(  876.6500), SIMDE_FLOAT32_C(  967.7900) },
+      { SIMDE_FLOAT32_C(  634.6900), SIMDE_FLOAT32_C(  992.7600), SIMDE_FLOAT32_C(   37.1400), SIMDE_FLOAT32_C(  945.7200) },
+      { SIMDE_FLOAT32_C(    0.0397), SIMDE_FLOAT32_C(  523.6500), SIMDE_FLOAT32_C(  876.6500), SIMDE_FLOAT32_C(  967.7900) } },
+    { UINT8_C(  1),
+      { SIMDE_FLOAT32_C(  628.2800), SIMDE_FLOAT32_C(  760.0600), SIMDE_FLOAT32_C(  583.1400), SIMDE_FLOAT32_C(  550.2500) },
+      { SIMDE_FLOAT32_C(  738.6200), SIMDE_FLOAT32_C(  260.3300), SIMDE_FLOAT32_C(   30.9100), SIMDE_FLOAT32_C(  720.9800) },
+      { SIMDE_FLOAT32_C(    0.0368), SIMDE_FLOAT32_C(  760.0600), SIMDE_FLOAT32_C(  583.1400), SIMDE_FLOAT32_C(  550.2500) } },
+    { UINT8_C(168),
+      { SIMDE_FLOAT32_C(  873.3300), SIMDE_FLOAT32_C(  114.3700), SIMDE_FLOAT32_C(  683.2400), SIMDE_FLOAT32_C(  786.0000) },
+      { SIMDE_FLOAT32_C(  124.1000), SIMDE_FLOAT32_C(   94.6100), SIMDE_FLOAT32_C(  513.9900), SIMDE_FLOAT32_C(  525.7200) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  114.3700), SIMDE_FLOAT32_C(  683.2400), SIMDE_FLOAT32_C(  786.0000) } },
+    { UINT8_C( 72),
+      { SIMDE_FLOAT32_C(  538.1800), SIMDE_FLOAT32_C(  779.8600), SIMDE_FLOAT32_C(  766.4600), SIMDE_FLOAT32_C(  681.1100) },
+      { SIMDE_FLOAT32_C(  752.9700), SIMDE_FLOAT32_C(  362.1700), SIMDE_FLOAT32_C(   79.8600), SIMDE_FLOAT32_C(  761.7900) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  779.8600), SIMDE_FLOAT32_C(  766.4600), SIMDE_FLOAT32_C(  681.1100) } },
+    { UINT8_C( 16),
+      { SIMDE_FLOAT32_C(  903.6300), SIMDE_FLOAT32_C(   87.0100), SIMDE_FLOAT32_C(  680.5900), SIMDE_FLOAT32_C(  861.9600) },
+      { SIMDE_FLOAT32_C(  100.9700), SIMDE_FLOAT32_C(  555.3500), SIMDE_FLOAT32_C(  428.3500), SIMDE_FLOAT32_C(  798.0200) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(   87.0100), SIMDE_FLOAT32_C(  680.5900), SIMDE_FLOAT32_C(  861.9600) } },
+    { UINT8_C( 68),
+      { SIMDE_FLOAT32_C(  896.1500), SIMDE_FLOAT32_C(  617.0100), SIMDE_FLOAT32_C(  740.0400), SIMDE_FLOAT32_C(  780.2000) },
+      { SIMDE_FLOAT32_C(   77.2700), SIMDE_FLOAT32_C(  793.8500), SIMDE_FLOAT32_C(  427.7200), SIMDE_FLOAT32_C(  429.1900) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(  617.0100), SIMDE_FLOAT32_C(  740.0400), SIMDE_FLOAT32_C(  780.2000) } },
+    { UINT8_C( 25),
+      { SIMDE_FLOAT32_C(  571.1700), SIMDE_FLOAT32_C(  317.7000), SIMDE_FLOAT32_C(  789.4200), SIMDE_FLOAT32_C(  842.7600) },
+      { SIMDE_FLOAT32_C(  498.4200), SIMDE_FLOAT32_C(   95.7500), SIMDE_FLOAT32_C(  194.3300), SIMDE_FLOAT32_C(  564.4700) },
+      { SIMDE_FLOAT32_C(    0.0448), SIMDE_FLOAT32_C(  317.7000), SIMDE_FLOAT32_C(  789.4200), SIMDE_FLOAT32_C(  842.7600) } },
+    { UINT8_C(115),
+      { SIMDE_FLOAT32_C(   62.3000), SIMDE_FLOAT32_C(  231.7300), SIMDE_FLOAT32_C(   49.5100), SIMDE_FLOAT32_C(  213.2900) },
+      { SIMDE_FLOAT32_C(  357.4000), SIMDE_FLOAT32_C(  368.2800), SIMDE_FLOAT32_C(  214.5100), SIMDE_FLOAT32_C(  199.9500) },
+      { SIMDE_FLOAT32_C(    0.0529), SIMDE_FLOAT32_C(  231.7300), SIMDE_FLOAT32_C(   49.5100), SIMDE_FLOAT32_C(  213.2900) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde__m128 b = simde_mm_loadu_ps(test_vec[i].b);
+    simde__m128 r = simde_mm_maskz_rsqrt14_ss(test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_rsqrt14_sd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[2];
+    const simde_float64 b[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  501.5100), SIMDE_FLOAT64_C(  679.9500) },
+      { SIMDE_FLOAT64_C(  796.1900), SIMDE_FLOAT64_C(  714.4800) },
+      { SIMDE_FLOAT64_C(    0.0354), SIMDE_FLOAT64_C(  679.9500) } },
+    { { SIMDE_FLOAT64_C(  186.7900), SIMDE_FLOAT64_C(   56.3100) },
+      { SIMDE_FLOAT64_C(  650.4900), SIMDE_FLOAT64_C(  915.7900) },
+      { SIMDE_FLOAT64_C(    0.0392), SIMDE_FLOAT64_C(   56.3100) } },
+    { { SIMDE_FLOAT64_C(   34.2400), SIMDE_FLOAT64_C(  252.3400) },
+      { SIMDE_FLOAT64_C(  643.4800), SIMDE_FLOAT64_C(   44.4400) },
+      { SIMDE_FLOAT64_C(    0.0394), SIMDE_FLOAT64_C(  252.3400) } },
+    { { SIMDE_FLOAT64_C(  991.6200), SIMDE_FLOAT64_C(  876.1400) },
+      { SIMDE_FLOAT64_C(  853.8300), SIMDE_FLOAT64_C(  132.1100) },
+      { SIMDE_FLOAT64_C(    0.0342), SIMDE_FLOAT64_C(  876.1400) } },
+    { { SIMDE_FLOAT64_C(  221.6500), SIMDE_FLOAT64_C(  100.3100) },
+      { SIMDE_FLOAT64_C(  268.6200), SIMDE_FLOAT64_C(  556.4000) },
+      { SIMDE_FLOAT64_C(    0.0610), SIMDE_FLOAT64_C(  100.3100) } },
+    { { SIMDE_FLOAT64_C(  480.4300), SIMDE_FLOAT64_C(  397.2000) },
+      { SIMDE_FLOAT64_C(  110.9200), SIMDE_FLOAT64_C(  232.8800) },
+      { SIMDE_FLOAT64_C(    0.0950), SIMDE_FLOAT64_C(  397.2000) } },
+    { { SIMDE_FLOAT64_C(  507.5500), SIMDE_FLOAT64_C(  900.3900) },
+      { SIMDE_FLOAT64_C(  781.8300), SIMDE_FLOAT64_C(  925.8000) },
+      { SIMDE_FLOAT64_C(    0.0358), SIMDE_FLOAT64_C(  900.3900) } },
+    { { SIMDE_FLOAT64_C(  534.3200), SIMDE_FLOAT64_C(   69.6200) },
+      { SIMDE_FLOAT64_C(  421.4300), SIMDE_FLOAT64_C(  499.9700) },
+      { SIMDE_FLOAT64_C(    0.0487), SIMDE_FLOAT64_C(   69.6200) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d b = simde_mm_loadu_pd(test_vec[i].b);
+    simde__m128d r = simde_mm_rsqrt14_sd(a, b);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_rsqrt14_sd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[2];
+    const simde__mmask8 k;
+    const simde_float64 a[2];
+    const simde_float64 b[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  379.8500), SIMDE_FLOAT64_C(  928.7400) },
+      UINT8_C(153),
+      { SIMDE_FLOAT64_C(  251.1500), SIMDE_FLOAT64_C(   23.2400) },
+      { SIMDE_FLOAT64_C(  841.9500), SIMDE_FLOAT64_C(    4.4600) },
+      { SIMDE_FLOAT64_C(    0.0345), SIMDE_FLOAT64_C(   23.2400) } },
+    { { SIMDE_FLOAT64_C(  654.4100), SIMDE_FLOAT64_C(   27.3200) },
+      UINT8_C(211),
+      { SIMDE_FLOAT64_C(   43.3800), SIMDE_FLOAT64_C(  740.0500) },
+      { SIMDE_FLOAT64_C(  523.4600), SIMDE_FLOAT64_C(  593.1800) },
+      { SIMDE_FLOAT64_C(    0.0437), SIMDE_FLOAT64_C(  740.0500) } },
+    { { SIMDE_FLOAT64_C(  533.6300), SIMDE_FLOAT64_C(  438.7200) },
+      UINT8_C(129),
+      { SIMDE_FLOAT64_C(  663.9800), SIMDE_FLOAT64_C(  791.9900) },
+      { SIMDE_FLOAT64_C(    1.8200), SIMDE_FLOAT64_C(  578.4100) },
+      { SIMDE_FLOAT64_C(    0.7413), SIMDE_FLOAT64_C(  791.9900) } },
+    { { SIMDE_FLOAT64_C(  123.9200), SIMDE_FLOAT64_C(  626.7000) },
+      UINT8_C(  4),
+      { SIMDE_FLOAT64_C(  481.2900), SIMDE_FLOAT64_C(  140.6000) },
+      { SIMDE_FLOAT64_C(  338.0100), SIMDE_FLOAT64_C(  528.8800) },
+      { SIMDE_FLOAT64_C(  123.9200), SIMDE_FLOAT64_C(  140.6000) } },
+    { { SIMDE_FLOAT64_C(  278.1900), SIMDE_FLOAT64_C(  529.2700) },
+      UINT8_C( 37),
+      { SIMDE_FLOAT64_C(   83.7700), SIMDE_FLOAT64_C(  467.1000) },
+      { SIMDE_FLOAT64_C(  988.0400), SIMDE_FLOAT64_C(  713.8100) },
+      { SIMDE_FLOAT64_C(    0.0318), SIMDE_FLOAT64_C(  467.1000) } },
+    { { SIMDE_FLOAT64_C(  514.6800), SIMDE_FLOAT64_C(   57.5700) },
+      UINT8_C( 33),
+      { SIMDE_FLOAT64_C(  847.8400), SIMDE_FLOAT64_C(   46.0600) },
+      { SIMDE_FLOAT64_C(  352.8100), SIMDE_FLOAT64_C(   20.2900) },
+      { SIMDE_FLOAT64_C(    0.0532), SIMDE_FLOAT64_C(   46.0600) } },
+    { { SIMDE_FLOAT64_C(  974.7500), SIMDE_FLOAT64_C(  758.5600) },
+      UINT8_C( 33),
+      { SIMDE_FLOAT64_C(  199.9800), SIMDE_FLOAT64_C(  641.3400) },
+      { SIMDE_FLOAT64_C(  465.1300), SIMDE_FLOAT64_C(   45.2500) },
+      { SIMDE_FLOAT64_C(    0.0464), SIMDE_FLOAT64_C(  641.3400) } },
+    { { SIMDE_FLOAT64_C(  573.3400), SIMDE_FLOAT64_C(  430.7500) },
+      UINT8_C( 24),
+      { SIMDE_FLOAT64_C(  518.7200), SIMDE_FLOAT64_C(  924.5700) },
+      { SIMDE_FLOAT64_C(  836.3300), SIMDE_FLOAT64_C(  231.3000) },
+      { SIMDE_FLOAT64_C(  573.3400), SIMDE_FLOAT64_C(  924.5700) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d src = simde_mm_loadu_pd(test_vec[i].src);
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d b = simde_mm_loadu_pd(test_vec[i].b);
+    simde__m128d r = simde_mm_mask_rsqrt14_sd(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_rsqrt14_sd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[2];
+    const simde_float64 b[2];
+    const simde_float64 r[2];
+  } test_vec[] = {
+    { UINT8_C(178),
+      { SIMDE_FLOAT64_C(   57.3000), SIMDE_FLOAT64_C(  412.5900) },
+      { SIMDE_FLOAT64_C(  923.0400), SIMDE_FLOAT64_C(  755.8200) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(  412.5900) } },
+    { UINT8_C(133),
+      { SIMDE_FLOAT64_C(  651.8800), SIMDE_FLOAT64_C(  433.0300) },
+      { SIMDE_FLOAT64_C(  868.3100), SIMDE_FLOAT64_C(  581.8100) },
+      { SIMDE_FLOAT64_C(    0.0339), SIMDE_FLOAT64_C(  433.0300) } },
+    { UINT8_C( 12),
+      { SIMDE_FLOAT64_C(  602.9100), SIMDE_FLOAT64_C(  182.7000) },
+      { SIMDE_FLOAT64_C(  110.6200), SIMDE_FLOAT64_C(  749.3900) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(  182.7000) } },
+    { UINT8_C( 61),
+      { SIMDE_FLOAT64_C(  283.3100), SIMDE_FLOAT64_C(  521.7400) },
+      { SIMDE_FLOAT64_C(   45.8700), SIMDE_FLOAT64_C(  184.2700) },
+      { SIMDE_FLOAT64_C(    0.1477), SIMDE_FLOAT64_C(  521.7400) } },
+    { UINT8_C( 41),
+      { SIMDE_FLOAT64_C(  853.0900), SIMDE_FLOAT64_C(  382.3200) },
+      { SIMDE_FLOAT64_C(  122.6300), SIMDE_FLOAT64_C(  848.1800) },
+      { SIMDE_FLOAT64_C(    0.0903), SIMDE_FLOAT64_C(  382.3200) } },
+    { UINT8_C( 33),
+      { SIMDE_FLOAT64_C(  926.5500), SIMDE_FLOAT64_C(  746.1300) },
+      { SIMDE_FLOAT64_C(  848.6300), SIMDE_FLOAT64_C(  505.9400) },
+      { SIMDE_FLOAT64_C(    0.0343), SIMDE_FLOAT64_C(  746.1300) } },
+    { UINT8_C( 64),
+      { SIMDE_FLOAT64_C(  919.9500), SIMDE_FLOAT64_C(  569.5700) },
+      { SIMDE_FLOAT64_C(  732.6700), SIMDE_FLOAT64_C(  562.2500) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(  569.5700) } },
+    { UINT8_C( 21),
+      { SIMDE_FLOAT64_C(  524.1100), SIMDE_FLOAT64_C(  669.3400) },
+      { SIMDE_FLOAT64_C(  444.2800), SIMDE_FLOAT64_C(  435.7600) },
+      { SIMDE_FLOAT64_C(    0.0474), SIMDE_FLOAT64_C(  669.3400) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde__m128d b = simde_mm_loadu_pd(test_vec[i].b);
+    simde__m128d r = simde_mm_maskz_rsqrt14_sd(test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_f64x2(r, simde_mm_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_rsqrt28_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  994.7900), SIMDE_FLOAT32_C(  371.5900), SIMDE_FLOAT32_C(  788.9200), SIMDE_FLOAT32_C(  455.4900),
+        SIMDE_FLOAT32_C(  625.0600), SIMDE_FLOAT32_C(  294.9900), SIMDE_FLOAT32_C(  388.9500), SIMDE_FLOAT32_C(   31.9800),
+        SIMDE_FLOAT32_C(  999.1500), SIMDE_FLOAT32_C(  683.4200), SIMDE_FLOAT32_C(  432.1500), SIMDE_FLOAT32_C(  578.7300),
+        SIMDE_FLOAT32_C(  534.6600), SIMDE_FLOAT32_C(  343.9400), SIMDE_FLOAT32_C(  933.7400), SIMDE_FLOAT32_C(  254.6800) },
+      { SIMDE_FLOAT32_C(    0.0317), SIMDE_FLOAT32_C(    0.0519), SIMDE_FLOAT32_C(    0.0356), SIMDE_FLOAT32_C(    0.0469),
+        SIMDE_FLOAT32_C(    0.0400), SIMDE_FLOAT32_C(    0.0582), SIMDE_FLOAT32_C(    0.0507), SIMDE_FLOAT32_C(    0.1768),
+        SIMDE_FLOAT32_C(    0.0316), SIMDE_FLOAT32_C(    0.0383), SIMDE_FLOAT32_C(    0.0481), SIMDE_FLOAT32_C(    0.0416),
+        SIMDE_FLOAT32_C(    0.0432), SIMDE_FLOAT32_C(    0.0539), SIMDE_FLOAT32_C(    0.0327), SIMDE_FLOAT32_C(    0.0627) } },
+    { { SIMDE_FLOAT32_C(  445.4100), SIMDE_FLOAT32_C(   98.9600), SIMDE_FLOAT32_C(  253.1900), SIMDE_FLOAT32_C(  639.3300),
+        SIMDE_FLOAT32_C(  808.4300), SIMDE_FLOAT32_C(  140.2600), SIMDE_FLOAT32_C(   69.6400), SIMDE_FLOAT32_C(  555.6600),
+        SIMDE_FLOAT32_C(  640.3800), SIMDE_FLOAT32_C(  770.5800), SIMDE_FLOAT32_C(  115.9300), SIMDE_FLOAT32_C(  693.9600),
+        SIMDE_FLOAT32_C(  817.0600), SIMDE_FLOAT32_C(  250.8000), SIMDE_FLOAT32_C(  894.6400), SIMDE_FLOAT32_C(  429.0700) },
+      { SIMDE_FLOAT32_C(    0.0474), SIMDE_FLOAT32_C(    0.1005), SIMDE_FLOAT32_C(    0.0628), SIMDE_FLOAT32_C(    0.0395),
+        SIMDE_FLOAT32_C(    0.0352), SIMDE_FLOAT32_C(    0.0844), SIMDE_FLOAT32_C(    0.1198), SIMDE_FLOAT32_C(    0.0424),
+        SIMDE_FLOAT32_C(    0.0395), SIMDE_FLOAT32_C(    0.0360), SIMDE_FLOAT32_C(    0.0929), SIMDE_FLOAT32_C(    0.0380),
+        SIMDE_FLOAT32_C(    0.0350), SIMDE_FLOAT32_C(    0.0631), SIMDE_FLOAT32_C(    0.0334), SIMDE_FLOAT32_C(    0.0483) } },
+    { { SIMDE_FLOAT32_C(  197.6500), SIMDE_FLOAT32_C(  710.1200), SIMDE_FLOAT32_C(  491.5100), SIMDE_FLOAT32_C(  355.2100),
+        SIMDE_FLOAT32_C(  934.1200), SIMDE_FLOAT32_C(  374.8800), SIMDE_FLOAT32_C(  135.1700), SIMDE_FLOAT32_C(  148.7800),
+        SIMDE_FLOAT32_C(  742.6900), SIMDE_FLOAT32_C(  492.7100), SIMDE_FLOAT32_C(  856.7500), SIMDE_FLOAT32_C(  521.9200),
+        SIMDE_FLOAT32_C(  569.2300), SIMDE_FLOAT32_C(  975.6800), SIMDE_FLOAT32_C(  362.7600), SIMDE_FLOAT32_C(  164.7200) },
+      { SIMDE_FLOAT32_C(    0.0711), SIMDE_FLOAT32_C(    0.0375), SIMDE_FLOAT32_C(    0.0451), SIMDE_FLOAT32_C(    0.0531),
+        SIMDE_FLOAT32_C(    0.0327), SIMDE_FLOAT32_C(    0.0516), SIMDE_FLOAT32_C(    0.0860), SIMDE_FLOAT32_C(    0.0820),
+        SIMDE_FLOAT32_C(    0.0367), SIMDE_FLOAT32_C(    0.0451), SIMDE_FLOAT32_C(    0.0342), SIMDE_FLOAT32_C(    0.0438),
+        SIMDE_FLOAT32_C(    0.0419), SIMDE_FLOAT32_C(    0.0320), SIMDE_FLOAT32_C(    0.0525), SIMDE_FLOAT32_C(    0.0779) } },
+    { { SIMDE_FLOAT32_C(  541.8400), SIMDE_FLOAT32_C(  403.6400), SIMDE_FLOAT32_C(  434.4300), SIMDE_FLOAT32_C(   57.8000),
+        SIMDE_FLOAT32_C(  690.6500), SIMDE_FLOAT32_C(  314.4200), SIMDE_FLOAT32_C(  333.4100), SIMDE_FLOAT32_C(  490.0600),
+        SIMDE_FLOAT32_C(  749.8100), SIMDE_FLOAT32_C(  574.2600), SIMDE_FLOAT32_C(  370.4300), SIMDE_FLOAT32_C(  400.8800),
+        SIMDE_FLOAT32_C(  518.8900), SIMDE_FLOAT32_C(  633.9700), SIMDE_FLOAT32_C(  393.6700), SIMDE_FLOAT32_C(  268.5800) },
+      { SIMDE_FLOAT32_C(    0.0430), SIMDE_FLOAT32_C(    0.0498), SIMDE_FLOAT32_C(    0.0480), SIMDE_FLOAT32_C(    0.1315),
+        SIMDE_FLOAT32_C(    0.0381), SIMDE_FLOAT32_C(    0.0564), SIMDE_FLOAT32_C(    0.0548), SIMDE_FLOAT32_C(    0.0452),
+        SIMDE_FLOAT32_C(    0.0365), SIMDE_FLOAT32_C(    0.0417), SIMDE_FLOAT32_C(    0.0520), SIMDE_FLOAT32_C(    0.0499),
+        SIMDE_FLOAT32_C(    0.0439), SIMDE_FLOAT32_C(    0.0397), SIMDE_FLOAT32_C(    0.0504), SIMDE_FLOAT32_C(    0.0610) } },
+    { { SIMDE_FLOAT32_C(  188.1000), SIMDE_FLOAT32_C(  411.2500), SIMDE_FLOAT32_C(  265.3800), SIMDE_FLOAT32_C(  774.6700),
+        SIMDE_FLOAT32_C(  500.9700), SIMDE_FLOAT32_C(  858.4500), SIMDE_FLOAT32_C(  282.2100), SIMDE_FLOAT32_C(  270.2800),
+        SIMDE_FLOAT32_C(  172.1600), SIMDE_FLOAT32_C(  233.5900), SIMDE_FLOAT32_C(  582.0100), SIMDE_FLOAT32_C(  395.5400),
+        SIMDE_FLOAT32_C(  131.2200), SIMDE_FLOAT32_C(  149.9100), SIMDE_FLOAT32_C(  662.9800), SIMDE_FLOAT32_C(  305.7900) },
+      { SIMDE_FLOAT32_C(    0.0729), SIMDE_FLOAT32_C(    0.0493), SIMDE_FLOAT32_C(    0.0614), SIMDE_FLOAT32_C(    0.0359),
+        SIMDE_FLOAT32_C(    0.0447), SIMDE_FLOAT32_C(    0.0341), SIMDE_FLOAT32_C(    0.0595), SIMDE_FLOAT32_C(    0.0608),
+        SIMDE_FLOAT32_C(    0.0762), SIMDE_FLOAT32_C(    0.0654), SIMDE_FLOAT32_C(    0.0415), SIMDE_FLOAT32_C(    0.0503),
+        SIMDE_FLOAT32_C(    0.0873), SIMDE_FLOAT32_C(    0.0817), SIMDE_FLOAT32_C(    0.0388), SIMDE_FLOAT32_C(    0.0572) } },
+    { { SIMDE_FLOAT32_C(    3.8100), SIMDE_FLOAT32_C(  529.7100), SIMDE_FLOAT32_C(  349.0000), SIMDE_FLOAT32_C(  592.0900),
+        SIMDE_FLOAT32_C(  932.8900), SIMDE_FLOAT32_C(  789.3100), SIMDE_FLOAT32_C(  305.3500), SIMDE_FLOAT32_C(  934.0200),
+        SIMDE_FLOAT32_C(  601.4400), SIMDE_FLOAT32_C(  635.9600), SIMDE_FLOAT32_C(  751.7300), SIMDE_FLOAT32_C(  821.2900),
+        SIMDE_FLOAT32_C(  509.6500), SIMDE_FLOAT32_C(  561.2300), SIMDE_FLOAT32_C(  553.8500), SIMDE_FLOAT32_C(  576.4400) },
+      { SIMDE_FLOAT32_C(    0.5123), SIMDE_FLOAT32_C(    0.0434), SIMDE_FLOAT32_C(    0.0535), SIMDE_FLOAT32_C(    0.0411),
+        SIMDE_FLOAT32_C(    0.0327), SIMDE_FLOAT32_C(    0.0356), SIMDE_FLOAT32_C(    0.0572), SIMDE_FLOAT32_C(    0.0327),
+        SIMDE_FLOAT32_C(    0.0408), SIMDE_FLOAT32_C(    0.0397), SIMDE_FLOAT32_C(    0.0365), SIMDE_FLOAT32_C(    0.0349),
+        SIMDE_FLOAT32_C(    0.0443), SIMDE_FLOAT32_C(    0.0422), SIMDE_FLOAT32_C(    0.0425), SIMDE_FLOAT32_C(    0.0417) } },
+    { { SIMDE_FLOAT32_C(  684.1400), SIMDE_FLOAT32_C(  816.9600), SIMDE_FLOAT32_C(   66.7300), SIMDE_FLOAT32_C(  897.8900),
+        SIMDE_FLOAT32_C(  177.0800), SIMDE_FLOAT32_C(  213.1700), SIMDE_FLOAT32_C(  452.8400), SIMDE_FLOAT32_C(  832.3900),
+        SIMDE_FLOAT32_C(  440.4400), SIMDE_FLOAT32_C(   93.0300), SIMDE_FLOAT32_C(  493.3200), SIMDE_FLOAT32_C(  838.0600),
+        SIMDE_FLOAT32_C(  289.4700), SIMDE_FLOAT32_C(  203.1900), SIMDE_FLOAT32_C(  873.0100), SIMDE_FLOAT32_C(  355.2500) },
+      { SIMDE_FLOAT32_C(    0.0382), SIMDE_FLOAT32_C(    0.0350), SIMDE_FLOAT32_C(    0.1224), SIMDE_FLOAT32_C(    0.0334),
+        SIMDE_FLOAT32_C(    0.0751), SIMDE_FLOAT32_C(    0.0685), SIMDE_FLOAT32_C(    0.0470), SIMDE_FLOAT32_C(    0.0347),
+        SIMDE_FLOAT32_C(    0.0476), SIMDE_FLOAT32_C(    0.1037), SIMDE_FLOAT32_C(    0.0450), SIMDE_FLOAT32_C(    0.0345),
+        SIMDE_FLOAT32_C(    0.0588), SIMDE_FLOAT32_C(    0.0702), SIMDE_FLOAT32_C(    0.0338), SIMDE_FLOAT32_C(    0.0531) } },
+    { { SIMDE_FLOAT32_C(  302.5300), SIMDE_FLOAT32_C(  708.0700), SIMDE_FLOAT32_C(  452.5100), SIMDE_FLOAT32_C(  624.5300),
+        SIMDE_FLOAT32_C(  937.9300), SIMDE_FLOAT32_C(  599.9900), SIMDE_FLOAT32_C(  352.3400), SIMDE_FLOAT32_C(  551.8700),
+        SIMDE_FLOAT32_C(  647.2600), SIMDE_FLOAT32_C(  798.8000), SIMDE_FLOAT32_C(  147.2300), SIMDE_FLOAT32_C(  519.3400),
+        SIMDE_FLOAT32_C(  991.5800), SIMDE_FLOAT32_C(  317.7900), SIMDE_FLOAT32_C(  872.1900), SIMDE_FLOAT32_C(  571.8700) },
+      { SIMDE_FLOAT32_C(    0.0575), SIMDE_FLOAT32_C(    0.0376), SIMDE_FLOAT32_C(    0.0470), SIMDE_FLOAT32_C(    0.0400),
+        SIMDE_FLOAT32_C(    0.0327), SIMDE_FLOAT32_C(    0.0408), SIMDE_FLOAT32_C(    0.0533), SIMDE_FLOAT32_C(    0.0426),
+        SIMDE_FLOAT32_C(    0.0393), SIMDE_FLOAT32_C(    0.0354), SIMDE_FLOAT32_C(    0.0824), SIMDE_FLOAT32_C(    0.0439),
+        SIMDE_FLOAT32_C(    0.0318), SIMDE_FLOAT32_C(    0.0561), SIMDE_FLOAT32_C(    0.0339), SIMDE_FLOAT32_C(    0.0418) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_rsqrt28_ps(a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_rsqrt28_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[16];
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  244.6200), SIMDE_FLOAT32_C(  885.2600), SIMDE_FLOAT32_C(   95.2000), SIMDE_FLOAT32_C(  655.6900),
+        SIMDE_FLOAT32_C(  388.5200), SIMDE_FLOAT32_C(   77.3700), SIMDE_FLOAT32_C(  961.6000), SIMDE_FLOAT32_C(  707.2800),
+        SIMDE_FLOAT32_C(  772.8300), SIMDE_FLOAT32_C(  300.4100), SIMDE_FLOAT32_C(   70.2800), SIMDE_FLOAT32_C(  561.6500),
+        SIMDE_FLOAT32_C(  850.7100), SIMDE_FLOAT32_C(  795.7300), SIMDE_FLOAT32_C(   97.7200), SIMDE_FLOAT32_C(  507.0600) },
+      UINT16_C(60195),
+      { SIMDE_FLOAT32_C(  922.4900), SIMDE_FLOAT32_C(  989.5100), SIMDE_FLOAT32_C(  390.2500), SIMDE_FLOAT32_C(  574.7100),
+        SIMDE_FLOAT32_C(  530.8000), SIMDE_FLOAT32_C(  541.8300), SIMDE_FLOAT32_C(  921.9700), SIMDE_FLOAT32_C(  884.6200),
+        SIMDE_FLOAT32_C(  127.1800), SIMDE_FLOAT32_C(  762.4700), SIMDE_FLOAT32_C(  513.5900), SIMDE_FLOAT32_C(  722.2200),
+        SIMDE_FLOAT32_C(  440.0600), SIMDE_FLOAT32_C(  848.0400), SIMDE_FLOAT32_C(  120.0900), SIMDE_FLOAT32_C(  219.7400) },
+      { SIMDE_FLOAT32_C(    0.0329), SIMDE_FLOAT32_C(    0.0318), SIMDE_FLOAT32_C(   95.2000), SIMDE_FLOAT32_C(  655.6900),
+        SIMDE_FLOAT32_C(  388.5200), SIMDE_FLOAT32_C(    0.0430), SIMDE_FLOAT32_C(  961.6000), SIMDE_FLOAT32_C(  707.2800),
+        SIMDE_FLOAT32_C(    0.0887), SIMDE_FLOAT32_C(    0.0362), SIMDE_FLOAT32_C(   70.2800), SIMDE_FLOAT32_C(    0.0372),
+        SIMDE_FLOAT32_C(  850.7100), SIMDE_FLOAT32_C(    0.0343), SIMDE_FLOAT32_C(    0.0913), SIMDE_FLOAT32_C(    0.0675) } },
+    { { SIMDE_FLOAT32_C(  182.1800), SIMDE_FLOAT32_C(  730.2400), SIMDE_FLOAT32_C(   64.5700), SIMDE_FLOAT32_C(  812.1800),
+        SIMDE_FLOAT32_C(  768.8600), SIMDE_FLOAT32_C(  368.3000), SIMDE_FLOAT32_C(  459.0800), SIMDE_FLOAT32_C(  650.2700),
+        SIMDE_FLOAT32_C(  544.0600), SIMDE_FLOAT32_C(  610.3800), SIMDE_FLOAT32_C(  314.5100), SIMDE_FLOAT32_C(  295.1600),
+        SIMDE_FLOAT32_C(  519.1600), SIMDE_FLOAT32_C(  862.8400), SIMDE_FLOAT32_C(  338.3800), SIMDE_FLOAT32_C(  395.2900) },
+      UINT16_C(55167),
+      { SIMDE_FLOAT32_C(  919.1500), SIMDE_FLOAT32_C(  511.6600), SIMDE_FLOAT32_C(   75.4300), SIMDE_FLOAT32_C(  132.2500),
+        SIMDE_FLOAT32_C(  104.9800), SIMDE_FLOAT32_C(  392.7100), SIMDE_FLOAT32_C(  848.5400), SIMDE_FLOAT32_C(  373.2100),
+        SIMDE_FLOAT32_C(  492.0200), SIMDE_FLOAT32_C(  256.3600), SIMDE_FLOAT32_C(   54.6800), SIMDE_FLOAT32_C(  500.9900),
+        SIMDE_FLOAT32_C(  327.8100), SIMDE_FLOAT32_C(  344.3000), SIMDE_FLOAT32_C(  160.9900), SIMDE_FLOAT32_C(  766.5900) },
+      { SIMDE_FLOAT32_C(    0.0330), SIMDE_FLOAT32_C(    0.0442), SIMDE_FLOAT32_C(    0.1151), SIMDE_FLOAT32_C(    0.0870),
+        SIMDE_FLOAT32_C(    0.0976), SIMDE_FLOAT32_C(    0.0505), SIMDE_FLOAT32_C(    0.0343), SIMDE_FLOAT32_C(  650.2700),
+        SIMDE_FLOAT32_C(    0.0451), SIMDE_FLOAT32_C(    0.0625), SIMDE_FLOAT32_C(    0.1352), SIMDE_FLOAT32_C(  295.1600),
+        SIMDE_FLOAT32_C(    0.0552), SIMDE_FLOAT32_C(  862.8400), SIMDE_FLOAT32_C(    0.0788), SIMDE_FLOAT32_C(    0.0361) } },
+    { { SIMDE_FLOAT32_C(  351.6600), SIMDE_FLOAT32_C(   22.6500), SIMDE_FLOAT32_C(  323.8200), SIMDE_FLOAT32_C(  503.4400),
+        SIMDE_FLOAT32_C(  966.1200), SIMDE_FLOAT32_C(  799.5400), SIMDE_FLOAT32_C(  502.9300), SIMDE_FLOAT32_C(  751.7300),
+        SIMDE_FLOAT32_C(  437.1000), SIMDE_FLOAT32_C(  436.7400), SIMDE_FLOAT32_C(  939.3100), SIMDE_FLOAT32_C(  741.5300),
+        SIMDE_FLOAT32_C(  852.8500), SIMDE_FLOAT32_C(  920.3600), SIMDE_FLOAT32_C(  635.2800), SIMDE_FLOAT32_C(  129.1900) },
+      UINT16_C(63509),
+      { SIMDE_FLOAT32_C(  669.1000), SIMDE_FLOAT32_C(  610.9300), SIMDE_FLOAT32_C(  317.6600), SIMDE_FLOAT32_C(  988.3800),
+        SIMDE_FLOAT32_C(  440.5700), SIMDE_FLOAT32_C(  638.0600), SIMDE_FLOAT32_C(  120.4700), SIMDE_FLOAT32_C(   90.6500),
+        SIMDE_FLOAT32_C(  607.2100), SIMDE_FLOAT32_C(  646.6500), SIMDE_FLOAT32_C(  329.5700), SIMDE_FLOAT32_C(  369.0200),
+        SIMDE_FLOAT32_C(   41.4900), SIMDE_FLOAT32_C(  152.3300), SIMDE_FLOAT32_C(  875.3200), SIMDE_FLOAT32_C(  645.5300) },
+      { SIMDE_FLOAT32_C(    0.0387), SIMDE_FLOAT32_C(   22.6500), SIMDE_FLOAT32_C(    0.0561), SIMDE_FLOAT32_C(  503.4400),
+        SIMDE_FLOAT32_C(    0.0476), SIMDE_FLOAT32_C(  799.5400), SIMDE_FLOAT32_C(  502.9300), SIMDE_FLOAT32_C(  751.7300),
+        SIMDE_FLOAT32_C(  437.1000), SIMDE_FLOAT32_C(  436.7400), SIMDE_FLOAT32_C(  939.3100), SIMDE_FLOAT32_C(    0.0521),
+        SIMDE_FLOAT32_C(    0.1552), SIMDE_FLOAT32_C(    0.0810), SIMDE_FLOAT32_C(    0.0338), SIMDE_FLOAT32_C(    0.0394) } },
+    { { SIMDE_FLOAT32_C(  273.1800), SIMDE_FLOAT32_C(  945.2600), SIMDE_FLOAT32_C(  295.7700), SIMDE_FLOAT32_C(  213.6800),
+        SIMDE_FLOAT32_C(  981.5400), SIMDE_FLOAT32_C(  820.7400), SIMDE_FLOAT32_C(  720.8500), SIMDE_FLOAT32_C(  428.7700),
+        SIMDE_FLOAT32_C(   74.1800), SIMDE_FLOAT32_C(   49.1300), SIMDE_FLOAT32_C(  783.7400), SIMDE_FLOAT32_C(  315.8900),
+        SIMDE_FLOAT32_C(  592.3200), SIMDE_FLOAT32_C(  770.0900), SIMDE_FLOAT32_C(  163.5200), SIMDE_FLOAT32_C(  124.2900) },
+      UINT16_C(18735),
+      { SIMDE_FLOAT32_C(  376.4600), SIMDE_FLOAT32_C(  680.7000), SIMDE_FLOAT32_C(  311.0300), SIMDE_FLOAT32_C(  763.8700),
+        SIMDE_FLOAT32_C(  315.5600), SIMDE_FLOAT32_C(  871.0900), SIMDE_FLOAT32_C(    5.5100), SIMDE_FLOAT32_C(  284.3700),
+        SIMDE_FLOAT32_C(  241.5700), SIMDE_FLOAT32_C(  680.5400), SIMDE_FLOAT32_C(  345.7900), SIMDE_FLOAT32_C(  324.3400),
+        SIMDE_FLOAT32_C(  196.7200), SIMDE_FLOAT32_C(  557.5100), SIMDE_FLOAT32_C(  949.3400), SIMDE_FLOAT32_C(  873.7600) },
+      { SIMDE_FLOAT32_C(    0.0515), SIMDE_FLOAT32_C(    0.0383), SIMDE_FLOAT32_C(    0.0567), SIMDE_FLOAT32_C(    0.0362),
+        SIMDE_FLOAT32_C(  981.5400), SIMDE_FLOAT32_C(    0.0339), SIMDE_FLOAT32_C(  720.8500), SIMDE_FLOAT32_C(  428.7700),
+        SIMDE_FLOAT32_C(    0.0643), SIMDE_FLOAT32_C(   49.1300), SIMDE_FLOAT32_C(  783.7400), SIMDE_FLOAT32_C(    0.0555),
+        SIMDE_FLOAT32_C(  592.3200), SIMDE_FLOAT32_C(  770.0900), SIMDE_FLOAT32_C(    0.0325), SIMDE_FLOAT32_C(  124.2900) } },
+    { { SIMDE_FLOAT32_C(  438.0300), SIMDE_FLOAT32_C(  152.4400), SIMDE_FLOAT32_C(  165.0800), SIMDE_FLOAT32_C(  855.2200),
+        SIMDE_FLOAT32_C(  182.3800), SIMDE_FLOAT32_C(  826.1300), SIMDE_FLOAT32_C(  282.3500), SIMDE_FLOAT32_C(  280.0100),
+        SIMDE_FLOAT32_C(  171.9200), SIMDE_FLOAT32_C(  482.8000), SIMDE_FLOAT32_C(  424.0000), SIMDE_FLOAT32_C(  901.0200),
+        SIMDE_FLOAT32_C(  982.8300), SIMDE_FLOAT32_C(  968.0300), SIMDE_FLOAT32_C(  557.1000), SIMDE_FLOAT32_C(   89.7600) },
+      UINT16_C(28803),
+      { SIMDE_FLOAT32_C(  103.1600), SIMDE_FLOAT32_C(  473.1900), SIMDE_FLOAT32_C(  177.5100), SIMDE_FLOAT32_C(  430.8300),
+        SIMDE_FLOAT32_C(    1.3500), SIMDE_FLOAT32_C(  369.9500), SIMDE_FLOAT32_C(  803.4100), SIMDE_FLOAT32_C(  600.7200),
+        SIMDE_FLOAT32_C(  461.1100), SIMDE_FLOAT32_C(   76.8300), SIMDE_FLOAT32_C(  727.8600), SIMDE_FLOAT32_C(  745.4900),
+        SIMDE_FLOAT32_C(  549.3800), SIMDE_FLOAT32_C(  258.8400), SIMDE_FLOAT32_C(  621.1900), SIMDE_FLOAT32_C(  675.6700) },
+      { SIMDE_FLOAT32_C(    0.0985), SIMDE_FLOAT32_C(    0.0460), SIMDE_FLOAT32_C(  165.0800), SIMDE_FLOAT32_C(  855.2200),
+        SIMDE_FLOAT32_C(  182.3800), SIMDE_FLOAT32_C(  826.1300), SIMDE_FLOAT32_C(  282.3500), SIMDE_FLOAT32_C(    0.0408),
+        SIMDE_FLOAT32_C(  171.9200), SIMDE_FLOAT32_C(  482.8000), SIMDE_FLOAT32_C(  424.0000), SIMDE_FLOAT32_C(  901.0200),
+        SIMDE_FLOAT32_C(    0.0427), SIMDE_FLOAT32_C(    0.0622), SIMDE_FLOAT32_C(    0.0401), SIMDE_FLOAT32_C(   89.7600) } },
+    { { SIMDE_FLOAT32_C(  599.3600), SIMDE_FLOAT32_C(    5.7200), SIMDE_FLOAT32_C(   25.2600), SIMDE_FLOAT32_C(  553.2400),
+        SIMDE_FLOAT32_C(  539.3200), SIMDE_FLOAT32_C(  596.5300), SIMDE_FLOAT32_C(  680.1900), SIMDE_FLOAT32_C(  468.2200),
+        SIMDE_FLOAT32_C(  408.4900), SIMDE_FLOAT32_C(  653.4600), SIMDE_FLOAT32_C(  147.3800), SIMDE_FLOAT32_C(  958.8600),
+        SIMDE_FLOAT32_C(  456.7200), SIMDE_FLOAT32_C(  271.1100), SIMDE_FLOAT32_C(  793.7400), SIMDE_FLOAT32_C(  510.6000) },
+      UINT16_C(31188),
+      { SIMDE_FLOAT32_C(  390.9600), SIMDE_FLOAT32_C(  368.2900), SIMDE_FLOAT32_C(  496.9000), SIMDE_FLOAT32_C(  901.4400),
+        SIMDE_FLOAT32_C(  507.8200), SIMDE_FLOAT32_C(  611.8400), SIMDE_FLOAT32_C(  934.6100), SIMDE_FLOAT32_C(  859.3200),
+        SIMDE_FLOAT32_C(  342.7200), SIMDE_FLOAT32_C(   37.5200), SIMDE_FLOAT32_C(  864.8300), SIMDE_FLOAT32_C(  934.5800),
+        SIMDE_FLOAT32_C(  474.1800), SIMDE_FLOAT32_C(  452.9600), SIMDE_FLOAT32_C(  586.1900), SIMDE_FLOAT32_C(  446.9700) },
+      { SIMDE_FLOAT32_C(  599.3600), SIMDE_FLOAT32_C(    5.7200), SIMDE_FLOAT32_C(    0.0449), SIMDE_FLOAT32_C(  553.2400),
+        SIMDE_FLOAT32_C(    0.0444), SIMDE_FLOAT32_C(  596.5300), SIMDE_FLOAT32_C(    0.0327), SIMDE_FLOAT32_C(    0.0341),
+        SIMDE_FLOAT32_C(    0.0540), SIMDE_FLOAT32_C(  653.4600), SIMDE_FLOAT32_C(  147.3800), SIMDE_FLOAT32_C(    0.0327),
+        SIMDE_FLOAT32_C(    0.0459), SIMDE_FLOAT32_C(    0.0470), SIMDE_FLOAT32_C(    0.0413), SIMDE_FLOAT32_C(  510.6000) } },
+    { { SIMDE_FLOAT32_C(  534.1800), SIMDE_FLOAT32_C(  191.7600), SIMDE_FLOAT32_C(  497.0600), SIMDE_FLOAT32_C(  837.9200),
+        SIMDE_FLOAT32_C(  294.9200), SIMDE_FLOAT32_C(  734.3400), SIMDE_FLOAT32_C(  731.9500), SIMDE_FLOAT32_C(   76.6300),
+        SIMDE_FLOAT32_C(  511.8000), SIMDE_FLOAT32_C(  570.9800), SIMDE_FLOAT32_C(  773.7600), SIMDE_FLOAT32_C(  944.4000),
+        SIMDE_FLOAT32_C(  180.1800), SIMDE_FLOAT32_C(  890.9500), SIMDE_FLOAT32_C(  610.8900), SIMDE_FLOAT32_C(  383.2600) },
+      UINT16_C( 7594),
+      { SIMDE_FLOAT32_C(   76.3800), SIMDE_FLOAT32_C(  133.1700), SIMDE_FLOAT32_C(  566.4900), SIMDE_FLOAT32_C(  190.7600),
+        SIMDE_FLOAT32_C(   49.7900), SIMDE_FLOAT32_C(  519.0900), SIMDE_FLOAT32_C(  770.1400), SIMDE_FLOAT32_C(  844.2800),
+        SIMDE_FLOAT32_C(  761.9300), SIMDE_FLOAT32_C(    7.6200), SIMDE_FLOAT32_C(   75.6100), SIMDE_FLOAT32_C(  859.5600),
+        SIMDE_FLOAT32_C(  213.3900), SIMDE_FLOAT32_C(  237.2400), SIMDE_FLOAT32_C(  475.9600), SIMDE_FLOAT32_C(  528.5600) },
+      { SIMDE_FLOAT32_C(  534.1800), SIMDE_FLOAT32_C(    0.0867), SIMDE_FLOAT32_C(  497.0600), SIMDE_FLOAT32_C(    0.0724),
+        SIMDE_FLOAT32_C(  294.9200), SIMDE_FLOAT32_C(    0.0439), SIMDE_FLOAT32_C(  731.9500), SIMDE_FLOAT32_C(    0.0344),
+        SIMDE_FLOAT32_C(    0.0362), SIMDE_FLOAT32_C(  570.9800), SIMDE_FLOAT32_C(    0.1150), SIMDE_FLOAT32_C(    0.0341),
+        SIMDE_FLOAT32_C(    0.0685), SIMDE_FLOAT32_C(  890.9500), SIMDE_FLOAT32_C(  610.8900), SIMDE_FLOAT32_C(  383.2600) } },
+    { { SIMDE_FLOAT32_C(  999.6100), SIMDE_FLOAT32_C(  857.9400), SIMDE_FLOAT32_C(  120.8100), SIMDE_FLOAT32_C(  109.9400),
+        SIMDE_FLOAT32_C(  280.2800), SIMDE_FLOAT32_C(  621.4400), SIMDE_FLOAT32_C(  346.0200), SIMDE_FLOAT32_C(  123.2500),
+        SIMDE_FLOAT32_C(  648.7200), SIMDE_FLOAT32_C(  214.9400), SIMDE_FLOAT32_C(    0.6100), SIMDE_FLOAT32_C(  725.4900),
+        SIMDE_FLOAT32_C(  404.7600), SIMDE_FLOAT32_C(  223.8700), SIMDE_FLOAT32_C(    0.7200), SIMDE_FLOAT32_C(  641.0700) },
+      UINT16_C(48797),
+      { SIMDE_FLOAT32_C(  230.9500), SIMDE_FLOAT32_C(  338.7300), SIMDE_FLOAT32_C(   71.3700), SIMDE_FLOAT32_C(  854.0400),
+        SIMDE_FLOAT32_C(  978.8800), SIMDE_FLOAT32_C(  554.7600), SIMDE_FLOAT32_C(  887.4700), SIMDE_FLOAT32_C(  921.7200),
+        SIMDE_FLOAT32_C(  422.6200), SIMDE_FLOAT32_C(  330.7800), SIMDE_FLOAT32_C(   86.5900), SIMDE_FLOAT32_C(  544.3800),
+        SIMDE_FLOAT32_C(  398.0800), SIMDE_FLOAT32_C(  653.8400), SIMDE_FLOAT32_C(  428.8800), SIMDE_FLOAT32_C(  542.2400) },
+      { SIMDE_FLOAT32_C(    0.0658), SIMDE_FLOAT32_C(  857.9400), SIMDE_FLOAT32_C(    0.1184), SIMDE_FLOAT32_C(    0.0342),
+        SIMDE_FLOAT32_C(    0.0320), SIMDE_FLOAT32_C(  621.4400), SIMDE_FLOAT32_C(  346.0200), SIMDE_FLOAT32_C(    0.0329),
+        SIMDE_FLOAT32_C(  648.7200), SIMDE_FLOAT32_C(    0.0550), SIMDE_FLOAT32_C(    0.1075), SIMDE_FLOAT32_C(    0.0429),
+        SIMDE_FLOAT32_C(    0.0501), SIMDE_FLOAT32_C(    0.0391), SIMDE_FLOAT32_C(    0.7200), SIMDE_FLOAT32_C(    0.0429) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 src = simde_mm512_loadu_ps(test_vec[i].src);
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_mask_rsqrt28_ps(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_rsqrt28_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { UINT16_C( 9443),
+      { SIMDE_FLOAT32_C(  530.3900), SIMDE_FLOAT32_C(  870.9300), SIMDE_FLOAT32_C(  133.6300), SIMDE_FLOAT32_C(  400.5500),
+        SIMDE_FLOAT32_C(  329.5100), SIMDE_FLOAT32_C(  784.0100), SIMDE_FLOAT32_C(  429.6700), SIMDE_FLOAT32_C(  462.2900),
+        SIMDE_FLOAT32_C(  311.0900), SIMDE_FLOAT32_C(  355.1400), SIMDE_FLOAT32_C(  789.3500), SIMDE_FLOAT32_C(  326.5600),
+        SIMDE_FLOAT32_C(  318.4400), SIMDE_FLOAT32_C(  324.6700), SIMDE_FLOAT32_C(  994.4700), SIMDE_FLOAT32_C(  215.6300) },
+      { SIMDE_FLOAT32_C(    0.0434), SIMDE_FLOAT32_C(    0.0339), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0357), SIMDE_FLOAT32_C(    0.0482), SIMDE_FLOAT32_C(    0.0465),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0356), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0555), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT16_C(24531),
+      { SIMDE_FLOAT32_C(   35.6800), SIMDE_FLOAT32_C(  179.3700), SIMDE_FLOAT32_C(  860.4900), SIMDE_FLOAT32_C(  749.5600),
+        SIMDE_FLOAT32_C(  256.1700), SIMDE_FLOAT32_C(  766.1700), SIMDE_FLOAT32_C(  304.5000), SIMDE_FLOAT32_C(  330.2400),
+        SIMDE_FLOAT32_C(  881.6900), SIMDE_FLOAT32_C(  331.0500), SIMDE_FLOAT32_C(  145.8200), SIMDE_FLOAT32_C(  156.4600),
+        SIMDE_FLOAT32_C(  886.5500), SIMDE_FLOAT32_C(  102.6100), SIMDE_FLOAT32_C(  153.8100), SIMDE_FLOAT32_C(  590.5800) },
+      { SIMDE_FLOAT32_C(    0.1674), SIMDE_FLOAT32_C(    0.0747), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0625), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0573), SIMDE_FLOAT32_C(    0.0550),
+        SIMDE_FLOAT32_C(    0.0337), SIMDE_FLOAT32_C(    0.0550), SIMDE_FLOAT32_C(    0.0828), SIMDE_FLOAT32_C(    0.0799),
+        SIMDE_FLOAT32_C(    0.0336), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0806), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT16_C(57829),
+      { SIMDE_FLOAT32_C(  312.7300), SIMDE_FLOAT32_C(  232.2000), SIMDE_FLOAT32_C(  398.8800), SIMDE_FLOAT32_C(  582.4900),
+        SIMDE_FLOAT32_C(  698.7700), SIMDE_FLOAT32_C(  302.2800), SIMDE_FLOAT32_C(   17.6500), SIMDE_FLOAT32_C(  579.6100),
+        SIMDE_FLOAT32_C(  858.5700), SIMDE_FLOAT32_C(  574.3700), SIMDE_FLOAT32_C(  376.8800), SIMDE_FLOAT32_C(  979.3200),
+        SIMDE_FLOAT32_C(  597.3700), SIMDE_FLOAT32_C(  879.4000), SIMDE_FLOAT32_C(  213.4200), SIMDE_FLOAT32_C(  539.5400) },
+      { SIMDE_FLOAT32_C(    0.0565), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0501), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0575), SIMDE_FLOAT32_C(    0.2380), SIMDE_FLOAT32_C(    0.0415),
+        SIMDE_FLOAT32_C(    0.0341), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0337), SIMDE_FLOAT32_C(    0.0685), SIMDE_FLOAT32_C(    0.0431) } },
+    { UINT16_C(42262),
+      { SIMDE_FLOAT32_C(    0.9400), SIMDE_FLOAT32_C(  261.0900), SIMDE_FLOAT32_C(  603.4800), SIMDE_FLOAT32_C(  230.7200),
+        SIMDE_FLOAT32_C(  752.0800), SIMDE_FLOAT32_C(  900.6000), SIMDE_FLOAT32_C(  785.3400), SIMDE_FLOAT32_C(  194.2100),
+        SIMDE_FLOAT32_C(  981.0300), SIMDE_FLOAT32_C(  848.1700), SIMDE_FLOAT32_C(  540.3900), SIMDE_FLOAT32_C(  963.4200),
+        SIMDE_FLOAT32_C(   41.0800), SIMDE_FLOAT32_C(   83.8600), SIMDE_FLOAT32_C(   95.1900), SIMDE_FLOAT32_C(  499.1500) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0619), SIMDE_FLOAT32_C(    0.0407), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0365), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0319), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0430), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.1092), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0448) } },
+    { UINT16_C(38800),
+      { SIMDE_FLOAT32_C(  181.4800), SIMDE_FLOAT32_C(  592.1300), SIMDE_FLOAT32_C(  548.5000), SIMDE_FLOAT32_C(   84.5700),
+        SIMDE_FLOAT32_C(  714.9200), SIMDE_FLOAT32_C(  714.9500), SIMDE_FLOAT32_C(  403.9700), SIMDE_FLOAT32_C(  805.0400),
+        SIMDE_FLOAT32_C(  594.5400), SIMDE_FLOAT32_C(  435.7600), SIMDE_FLOAT32_C(  330.4500), SIMDE_FLOAT32_C(  358.1600),
+        SIMDE_FLOAT32_C(  700.9000), SIMDE_FLOAT32_C(  312.2600), SIMDE_FLOAT32_C(  845.3700), SIMDE_FLOAT32_C(  820.5200) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0374), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0352),
+        SIMDE_FLOAT32_C(    0.0410), SIMDE_FLOAT32_C(    0.0479), SIMDE_FLOAT32_C(    0.0550), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0378), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0349) } },
+    { UINT16_C(58203),
+      { SIMDE_FLOAT32_C(   76.8000), SIMDE_FLOAT32_C(  235.9700), SIMDE_FLOAT32_C(  498.2600), SIMDE_FLOAT32_C(  659.0600),
+        SIMDE_FLOAT32_C(  471.0300), SIMDE_FLOAT32_C(  171.6400), SIMDE_FLOAT32_C(  825.2700), SIMDE_FLOAT32_C(  900.4600),
+        SIMDE_FLOAT32_C(  492.5300), SIMDE_FLOAT32_C(  352.3300), SIMDE_FLOAT32_C(   76.7000), SIMDE_FLOAT32_C(  338.3100),
+        SIMDE_FLOAT32_C(  564.1800), SIMDE_FLOAT32_C(  423.9900), SIMDE_FLOAT32_C(  249.5500), SIMDE_FLOAT32_C(  372.6800) },
+      { SIMDE_FLOAT32_C(    0.1141), SIMDE_FLOAT32_C(    0.0651), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0390),
+        SIMDE_FLOAT32_C(    0.0461), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0348), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0451), SIMDE_FLOAT32_C(    0.0533), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0486), SIMDE_FLOAT32_C(    0.0633), SIMDE_FLOAT32_C(    0.0518) } },
+    { UINT16_C(20267),
+      { SIMDE_FLOAT32_C(  974.9500), SIMDE_FLOAT32_C(  708.0300), SIMDE_FLOAT32_C(  197.5600), SIMDE_FLOAT32_C(  678.8400),
+        SIMDE_FLOAT32_C(  561.8200), SIMDE_FLOAT32_C(   15.7900), SIMDE_FLOAT32_C(  558.9900), SIMDE_FLOAT32_C(  192.8500),
+        SIMDE_FLOAT32_C(  747.6200), SIMDE_FLOAT32_C(   52.5000), SIMDE_FLOAT32_C(  499.8500), SIMDE_FLOAT32_C(  556.3600),
+        SIMDE_FLOAT32_C(  276.7200), SIMDE_FLOAT32_C(  361.2700), SIMDE_FLOAT32_C(  665.1100), SIMDE_FLOAT32_C(  672.7300) },
+      { SIMDE_FLOAT32_C(    0.0320), SIMDE_FLOAT32_C(    0.0376), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0384),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.2517), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0366), SIMDE_FLOAT32_C(    0.1380), SIMDE_FLOAT32_C(    0.0447), SIMDE_FLOAT32_C(    0.0424),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0388), SIMDE_FLOAT32_C(    0.0000) } },
+    { UINT16_C(31622),
+      { SIMDE_FLOAT32_C(  662.2400), SIMDE_FLOAT32_C(  657.2700), SIMDE_FLOAT32_C(  103.2300), SIMDE_FLOAT32_C(  350.1000),
+        SIMDE_FLOAT32_C(  120.1700), SIMDE_FLOAT32_C(  288.9300), SIMDE_FLOAT32_C(  497.9300), SIMDE_FLOAT32_C(  864.5600),
+        SIMDE_FLOAT32_C(  277.9800), SIMDE_FLOAT32_C(  204.1400), SIMDE_FLOAT32_C(  481.7900), SIMDE_FLOAT32_C(  172.9400),
+        SIMDE_FLOAT32_C(  851.6900), SIMDE_FLOAT32_C(  654.1500), SIMDE_FLOAT32_C(  756.4300), SIMDE_FLOAT32_C(  155.8700) },
+      { SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0390), SIMDE_FLOAT32_C(    0.0984), SIMDE_FLOAT32_C(    0.0000),
+        SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0340),
+        SIMDE_FLOAT32_C(    0.0600), SIMDE_FLOAT32_C(    0.0700), SIMDE_FLOAT32_C(    0.0000), SIMDE_FLOAT32_C(    0.0760),
+        SIMDE_FLOAT32_C(    0.0343), SIMDE_FLOAT32_C(    0.0391), SIMDE_FLOAT32_C(    0.0364), SIMDE_FLOAT32_C(    0.0000) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 r = simde_mm512_maskz_rsqrt28_ps(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_rsqrt28_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  580.4500), SIMDE_FLOAT64_C(  534.5500), SIMDE_FLOAT64_C(  558.0900), SIMDE_FLOAT64_C(  331.3100),
+        SIMDE_FLOAT64_C(   49.9100), SIMDE_FLOAT64_C(  971.8400), SIMDE_FLOAT64_C(  244.7400), SIMDE_FLOAT64_C(  713.8900) },
+      { SIMDE_FLOAT64_C(    0.0415), SIMDE_FLOAT64_C(    0.0433), SIMDE_FLOAT64_C(    0.0423), SIMDE_FLOAT64_C(    0.0549),
+        SIMDE_FLOAT64_C(    0.1415), SIMDE_FLOAT64_C(    0.0321), SIMDE_FLOAT64_C(    0.0639), SIMDE_FLOAT64_C(    0.0374) } },
+    { { SIMDE_FLOAT64_C(  735.0600), SIMDE_FLOAT64_C(  356.5000), SIMDE_FLOAT64_C(  101.4600), SIMDE_FLOAT64_C(  584.8300),
+        SIMDE_FLOAT64_C(  876.7300), SIMDE_FLOAT64_C(  444.0100), SIMDE_FLOAT64_C(  335.5000), SIMDE_FLOAT64_C(  263.9100) },
+      { SIMDE_FLOAT64_C(    0.0369), SIMDE_FLOAT64_C(    0.0530), SIMDE_FLOAT64_C(    0.0993), SIMDE_FLOAT64_C(    0.0414),
+        SIMDE_FLOAT64_C(    0.0338), SIMDE_FLOAT64_C(    0.0475), SIMDE_FLOAT64_C(    0.0546), SIMDE_FLOAT64_C(    0.0616) } },
+    { { SIMDE_FLOAT64_C(  215.6500), SIMDE_FLOAT64_C(  505.3000), SIMDE_FLOAT64_C(  147.3100), SIMDE_FLOAT64_C(  254.6100),
+        SIMDE_FLOAT64_C(  531.2800), SIMDE_FLOAT64_C(  565.4000), SIMDE_FLOAT64_C(  957.0100), SIMDE_FLOAT64_C(  599.9600) },
+      { SIMDE_FLOAT64_C(    0.0681), SIMDE_FLOAT64_C(    0.0445), SIMDE_FLOAT64_C(    0.0824), SIMDE_FLOAT64_C(    0.0627),
+        SIMDE_FLOAT64_C(    0.0434), SIMDE_FLOAT64_C(    0.0421), SIMDE_FLOAT64_C(    0.0323), SIMDE_FLOAT64_C(    0.0408) } },
+    { { SIMDE_FLOAT64_C(  202.4200), SIMDE_FLOAT64_C(  499.6200), SIMDE_FLOAT64_C(  230.9400), SIMDE_FLOAT64_C(  901.9900),
+        SIMDE_FLOAT64_C(  364.0900), SIMDE_FLOAT64_C(   67.4300), SIMDE_FLOAT64_C(  385.1000), SIMDE_FLOAT64_C(  734.1600) },
+      { SIMDE_FLOAT64_C(    0.0703), SIMDE_FLOAT64_C(    0.0447), SIMDE_FLOAT64_C(    0.0658), SIMDE_FLOAT64_C(    0.0333),
+        SIMDE_FLOAT64_C(    0.0524), SIMDE_FLOAT64_C(    0.1218), SIMDE_FLOAT64_C(    0.0510), SIMDE_FLOAT64_C(    0.0369) } },
+    { { SIMDE_FLOAT64_C(  119.9800), SIMDE_FLOAT64_C(  786.8000), SIMDE_FLOAT64_C(  703.9400), SIMDE_FLOAT64_C(  584.4100),
+        SIMDE_FLOAT64_C(   55.9400), SIMDE_FLOAT64_C(  835.3100), SIMDE_FLOAT64_C(  873.0000), SIMDE_FLOAT64_C(  498.9600) },
+      { SIMDE_FLOAT64_C(    0.0913), SIMDE_FLOAT64_C(    0.0357), SIMDE_FLOAT64_C(    0.0377), SIMDE_FLOAT64_C(    0.0414),
+        SIMDE_FLOAT64_C(    0.1337), SIMDE_FLOAT64_C(    0.0346), SIMDE_FLOAT64_C(    0.0338), SIMDE_FLOAT64_C(    0.0448) } },
+    { { SIMDE_FLOAT64_C(   76.4200), SIMDE_FLOAT64_C(  765.0700), SIMDE_FLOAT64_C(  600.9600), SIMDE_FLOAT64_C(  907.2100),
+        SIMDE_FLOAT64_C(  579.9200), SIMDE_FLOAT64_C(  137.4000), SIMDE_FLOAT64_C(  844.8100), SIMDE_FLOAT64_C(  177.5500) },
+      { SIMDE_FLOAT64_C(    0.1144), SIMDE_FLOAT64_C(    0.0362), SIMDE_FLOAT64_C(    0.0408), SIMDE_FLOAT64_C(    0.0332),
+        SIMDE_FLOAT64_C(    0.0415), SIMDE_FLOAT64_C(    0.0853), SIMDE_FLOAT64_C(    0.0344), SIMDE_FLOAT64_C(    0.0750) } },
+    { { SIMDE_FLOAT64_C(  490.4600), SIMDE_FLOAT64_C(  647.9400), SIMDE_FLOAT64_C(  435.1700), SIMDE_FLOAT64_C(  626.1800),
+        SIMDE_FLOAT64_C(  792.9000), SIMDE_FLOAT64_C(  557.1100), SIMDE_FLOAT64_C(  684.3500), SIMDE_FLOAT64_C(  283.8700) },
+      { SIMDE_FLOAT64_C(    0.0452), SIMDE_FLOAT64_C(    0.0393), SIMDE_FLOAT64_C(    0.0479), SIMDE_FLOAT64_C(    0.0400),
+        SIMDE_FLOAT64_C(    0.0355), SIMDE_FLOAT64_C(    0.0424), SIMDE_FLOAT64_C(    0.0382), SIMDE_FLOAT64_C(    0.0594) } },
+    { { SIMDE_FLOAT64_C(  850.3100), SIMDE_FLOAT64_C(  537.9500), SIMDE_FLOAT64_C(  467.2700), SIMDE_FLOAT64_C(  707.0000),
+        SIMDE_FLOAT64_C(  482.2900), SIMDE_FLOAT64_C(  816.0200), SIMDE_FLOAT64_C(  987.5200), SIMDE_FLOAT64_C(  606.0600) },
+      { SIMDE_FLOAT64_C(    0.0343), SIMDE_FLOAT64_C(    0.0431), SIMDE_FLOAT64_C(    0.0463), SIMDE_FLOAT64_C(    0.0376),
+        SIMDE_FLOAT64_C(    0.0455), SIMDE_FLOAT64_C(    0.0350), SIMDE_FLOAT64_C(    0.0318), SIMDE_FLOAT64_C(    0.0406) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_rsqrt28_pd(a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_rsqrt28_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[8];
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  912.4200), SIMDE_FLOAT64_C(  438.5200), SIMDE_FLOAT64_C(  220.0800), SIMDE_FLOAT64_C(  808.0700),
+        SIMDE_FLOAT64_C(  572.6800), SIMDE_FLOAT64_C(  224.4600), SIMDE_FLOAT64_C(  216.2000), SIMDE_FLOAT64_C(  644.7700) },
+      UINT8_C(148),
+      { SIMDE_FLOAT64_C(  720.9100), SIMDE_FLOAT64_C(  702.7300), SIMDE_FLOAT64_C(  253.3000), SIMDE_FLOAT64_C(  379.8200),
+        SIMDE_FLOAT64_C(  725.9000), SIMDE_FLOAT64_C(  919.2100), SIMDE_FLOAT64_C(  774.6600), SIMDE_FLOAT64_C(  140.0300) },
+      { SIMDE_FLOAT64_C(  912.4200), SIMDE_FLOAT64_C(  438.5200), SIMDE_FLOAT64_C(    0.0628), SIMDE_FLOAT64_C(  808.0700),
+        SIMDE_FLOAT64_C(    0.0371), SIMDE_FLOAT64_C(  224.4600), SIMDE_FLOAT64_C(  216.2000), SIMDE_FLOAT64_C(    0.0845) } },
+    { { SIMDE_FLOAT64_C(  747.4300), SIMDE_FLOAT64_C(  463.7200), SIMDE_FLOAT64_C(  359.9400), SIMDE_FLOAT64_C(  325.2100),
+        SIMDE_FLOAT64_C(   81.7000), SIMDE_FLOAT64_C(  523.9300), SIMDE_FLOAT64_C(  673.9100), SIMDE_FLOAT64_C(  914.3100) },
+      UINT8_C(223),
+      { SIMDE_FLOAT64_C(  666.9200), SIMDE_FLOAT64_C(  786.9100), SIMDE_FLOAT64_C(   82.9700), SIMDE_FLOAT64_C(  989.8400),
+        SIMDE_FLOAT64_C(  571.5900), SIMDE_FLOAT64_C(  819.3300), SIMDE_FLOAT64_C(  342.0700), SIMDE_FLOAT64_C(  645.0400) },
+      { SIMDE_FLOAT64_C(    0.0387), SIMDE_FLOAT64_C(    0.0356), SIMDE_FLOAT64_C(    0.1098), SIMDE_FLOAT64_C(    0.0318),
+        SIMDE_FLOAT64_C(    0.0418), SIMDE_FLOAT64_C(  523.9300), SIMDE_FLOAT64_C(    0.0541), SIMDE_FLOAT64_C(    0.0394) } },
+    { { SIMDE_FLOAT64_C(  755.4100), SIMDE_FLOAT64_C(  861.2100), SIMDE_FLOAT64_C(  157.3800), SIMDE_FLOAT64_C(    9.0900),
+        SIMDE_FLOAT64_C(  901.7600), SIMDE_FLOAT64_C(  868.6000), SIMDE_FLOAT64_C(  805.2800), SIMDE_FLOAT64_C(  235.5000) },
+      UINT8_C(197),
+      { SIMDE_FLOAT64_C(  214.6900), SIMDE_FLOAT64_C(  587.9500), SIMDE_FLOAT64_C(  325.7000), SIMDE_FLOAT64_C(  960.1400),
+        SIMDE_FLOAT64_C(  663.3900), SIMDE_FLOAT64_C(  204.4300), SIMDE_FLOAT64_C(  344.0700), SIMDE_FLOAT64_C(  476.6600) },
+      { SIMDE_FLOAT64_C(    0.0682), SIMDE_FLOAT64_C(  861.2100), SIMDE_FLOAT64_C(    0.0554), SIMDE_FLOAT64_C(    9.0900),
+        SIMDE_FLOAT64_C(  901.7600), SIMDE_FLOAT64_C(  868.6000), SIMDE_FLOAT64_C(    0.0539), SIMDE_FLOAT64_C(    0.0458) } },
+    { { SIMDE_FLOAT64_C(  371.6500), SIMDE_FLOAT64_C(  962.9600), SIMDE_FLOAT64_C(  703.1400), SIMDE_FLOAT64_C(  250.8800),
+        SIMDE_FLOAT64_C(  789.4900), SIMDE_FLOAT64_C(  701.8600), SIMDE_FLOAT64_C(  492.4300), SIMDE_FLOAT64_C(  988.9400) },
+      UINT8_C( 22),
+      { SIMDE_FLOAT64_C(   43.9500), SIMDE_FLOAT64_C(  806.2900), SIMDE_FLOAT64_C(  400.4800), SIMDE_FLOAT64_C(  472.9100),
+        SIMDE_FLOAT64_C(  716.3900), SIMDE_FLOAT64_C(  912.7100), SIMDE_FLOAT64_C(  243.1800), SIMDE_FLOAT64_C(  352.8500) },
+      { SIMDE_FLOAT64_C(  371.6500), SIMDE_FLOAT64_C(    0.0352), SIMDE_FLOAT64_C(    0.0500), SIMDE_FLOAT64_C(  250.8800),
+        SIMDE_FLOAT64_C(    0.0374), SIMDE_FLOAT64_C(  701.8600), SIMDE_FLOAT64_C(  492.4300), SIMDE_FLOAT64_C(  988.9400) } },
+    { { SIMDE_FLOAT64_C(  688.0600), SIMDE_FLOAT64_C(  892.7600), SIMDE_FLOAT64_C(  612.0200), SIMDE_FLOAT64_C(  122.9800),
+        SIMDE_FLOAT64_C(  806.0600), SIMDE_FLOAT64_C(   59.6900), SIMDE_FLOAT64_C(  692.9000), SIMDE_FLOAT64_C(  940.3300) },
+      UINT8_C(  9),
+      { SIMDE_FLOAT64_C(  858.8300), SIMDE_FLOAT64_C(  255.4200), SIMDE_FLOAT64_C(  989.4600), SIMDE_FLOAT64_C(  715.7700),
+        SIMDE_FLOAT64_C(  123.4400), SIMDE_FLOAT64_C(  668.7400), SIMDE_FLOAT64_C(  271.2300), SIMDE_FLOAT64_C(  772.8600) },
+      { SIMDE_FLOAT64_C(    0.0341), SIMDE_FLOAT64_C(  892.7600), SIMDE_FLOAT64_C(  612.0200), SIMDE_FLOAT64_C(    0.0374),
+        SIMDE_FLOAT64_C(  806.0600), SIMDE_FLOAT64_C(   59.6900), SIMDE_FLOAT64_C(  692.9000), SIMDE_FLOAT64_C(  940.3300) } },
+    { { SIMDE_FLOAT64_C(  862.4300), SIMDE_FLOAT64_C(  107.5000), SIMDE_FLOAT64_C(  882.2100), SIMDE_FLOAT64_C(  971.7600),
+        SIMDE_FLOAT64_C(  435.2600), SIMDE_FLOAT64_C(  942.1300), SIMDE_FLOAT64_C(  972.5800), SIMDE_FLOAT64_C(    1.9900) },
+      UINT8_C( 38),
+      { SIMDE_FLOAT64_C(  164.0500), SIMDE_FLOAT64_C(  562.5200), SIMDE_FLOAT64_C(  494.0400), SIMDE_FLOAT64_C(  539.1600),
+        SIMDE_FLOAT64_C(  362.1500), SIMDE_FLOAT64_C(   69.4800), SIMDE_FLOAT64_C(  131.6100), SIMDE_FLOAT64_C(  516.2600) },
+      { SIMDE_FLOAT64_C(  862.4300), SIMDE_FLOAT64_C(    0.0422), SIMDE_FLOAT64_C(    0.0450), SIMDE_FLOAT64_C(  971.7600),
+        SIMDE_FLOAT64_C(  435.2600), SIMDE_FLOAT64_C(    0.1200), SIMDE_FLOAT64_C(  972.5800), SIMDE_FLOAT64_C(    1.9900) } },
+    { { SIMDE_FLOAT64_C(   80.3900), SIMDE_FLOAT64_C(  896.6000), SIMDE_FLOAT64_C(  691.5400), SIMDE_FLOAT64_C(  112.0600),
+        SIMDE_FLOAT64_C(  422.9700), SIMDE_FLOAT64_C(  521.1500), SIMDE_FLOAT64_C(  789.3600), SIMDE_FLOAT64_C(  185.8000) },
+      UINT8_C( 40),
+      { SIMDE_FLOAT64_C(  625.3000), SIMDE_FLOAT64_C(  562.3500), SIMDE_FLOAT64_C(  131.1500), SIMDE_FLOAT64_C(  422.8700),
+        SIMDE_FLOAT64_C(  537.1100), SIMDE_FLOAT64_C(  477.7500), SIMDE_FLOAT64_C(  645.9800), SIMDE_FLOAT64_C(  977.2700) },
+      { SIMDE_FLOAT64_C(   80.3900), SIMDE_FLOAT64_C(  896.6000), SIMDE_FLOAT64_C(  691.5400), SIMDE_FLOAT64_C(    0.0486),
+        SIMDE_FLOAT64_C(  422.9700), SIMDE_FLOAT64_C(    0.0458), SIMDE_FLOAT64_C(  789.3600), SIMDE_FLOAT64_C(  185.8000) } },
+    { { SIMDE_FLOAT64_C(  465.6900), SIMDE_FLOAT64_C(  881.8000), SIMDE_FLOAT64_C(  631.9700), SIMDE_FLOAT64_C(  955.0700),
+        SIMDE_FLOAT64_C(  801.2900), SIMDE_FLOAT64_C(    6.8100), SIMDE_FLOAT64_C(  136.3300), SIMDE_FLOAT64_C(  240.8400) },
+      UINT8_C(177),
+      { SIMDE_FLOAT64_C(  795.5200), SIMDE_FLOAT64_C(  608.0300), SIMDE_FLOAT64_C(  579.2400), SIMDE_FLOAT64_C(   43.4700),
+        SIMDE_FLOAT64_C(  557.3000), SIMDE_FLOAT64_C(  454.6000), SIMDE_FLOAT64_C(  523.2700), SIMDE_FLOAT64_C(  470.1300) },
+      { SIMDE_FLOAT64_C(    0.0355), SIMDE_FLOAT64_C(  881.8000), SIMDE_FLOAT64_C(  631.9700), SIMDE_FLOAT64_C(  955.0700),
+        SIMDE_FLOAT64_C(    0.0424), SIMDE_FLOAT64_C(    0.0469), SIMDE_FLOAT64_C(  136.3300), SIMDE_FLOAT64_C(    0.0461) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d src = simde_mm512_loadu_pd(test_vec[i].src);
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_mask_rsqrt28_pd(src, test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_rsqrt28_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { UINT8_C(177),
+      { SIMDE_FLOAT64_C(  196.6200), SIMDE_FLOAT64_C(  410.9900), SIMDE_FLOAT64_C(  917.6200), SIMDE_FLOAT64_C(  905.8700),
+        SIMDE_FLOAT64_C(  388.3000), SIMDE_FLOAT64_C(  207.5800), SIMDE_FLOAT64_C(  883.6000), SIMDE_FLOAT64_C(  129.7900) },
+      { SIMDE_FLOAT64_C(    0.0713), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(    0.0507), SIMDE_FLOAT64_C(    0.0694), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0878) } },
+    { UINT8_C(202),
+      { SIMDE_FLOAT64_C(  544.2400), SIMDE_FLOAT64_C(  482.2000), SIMDE_FLOAT64_C(  653.3600), SIMDE_FLOAT64_C(  134.1200),
+        SIMDE_FLOAT64_C(  562.5700), SIMDE_FLOAT64_C(  238.5100), SIMDE_FLOAT64_C(   87.3700), SIMDE_FLOAT64_C(  946.6100) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0455), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0863),
+        SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.1070), SIMDE_FLOAT64_C(    0.0325) } },
+    { UINT8_C(183),
+      { SIMDE_FLOAT64_C(  177.5300), SIMDE_FLOAT64_C(  150.7100), SIMDE_FLOAT64_C(  111.8500), SIMDE_FLOAT64_C(  796.2000),
+        SIMDE_FLOAT64_C(  893.2400), SIMDE_FLOAT64_C(  873.1200), SIMDE_FLOAT64_C(  960.6100), SIMDE_FLOAT64_C(  699.4200) },
+      { SIMDE_FLOAT64_C(    0.0751), SIMDE_FLOAT64_C(    0.0815), SIMDE_FLOAT64_C(    0.0946), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(    0.0335), SIMDE_FLOAT64_C(    0.0338), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0378) } },
+    { UINT8_C(227),
+      { SIMDE_FLOAT64_C(  839.8900), SIMDE_FLOAT64_C(  353.3600), SIMDE_FLOAT64_C(  291.6000), SIMDE_FLOAT64_C(  332.2500),
+        SIMDE_FLOAT64_C(  582.1400), SIMDE_FLOAT64_C(  655.2900), SIMDE_FLOAT64_C(  947.7400), SIMDE_FLOAT64_C(  211.3600) },
+      { SIMDE_FLOAT64_C(    0.0345), SIMDE_FLOAT64_C(    0.0532), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0391), SIMDE_FLOAT64_C(    0.0325), SIMDE_FLOAT64_C(    0.0688) } },
+    { UINT8_C(  8),
+      { SIMDE_FLOAT64_C(  656.8700), SIMDE_FLOAT64_C(  239.7600), SIMDE_FLOAT64_C(  981.3800), SIMDE_FLOAT64_C(  569.5800),
+        SIMDE_FLOAT64_C(  700.7300), SIMDE_FLOAT64_C(  601.5700), SIMDE_FLOAT64_C(   28.0300), SIMDE_FLOAT64_C(  229.5600) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0419),
+        SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000) } },
+    { UINT8_C(145),
+      { SIMDE_FLOAT64_C(  201.4100), SIMDE_FLOAT64_C(   34.5700), SIMDE_FLOAT64_C(   33.8800), SIMDE_FLOAT64_C(  968.2200),
+        SIMDE_FLOAT64_C(  934.6900), SIMDE_FLOAT64_C(  881.7900), SIMDE_FLOAT64_C(  374.7600), SIMDE_FLOAT64_C(  382.1500) },
+      { SIMDE_FLOAT64_C(    0.0705), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(    0.0327), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0512) } },
+    { UINT8_C(234),
+      { SIMDE_FLOAT64_C(  469.6000), SIMDE_FLOAT64_C(  851.6800), SIMDE_FLOAT64_C(  713.5800), SIMDE_FLOAT64_C(   28.0700),
+        SIMDE_FLOAT64_C(  763.7200), SIMDE_FLOAT64_C(   12.3700), SIMDE_FLOAT64_C(  749.8800), SIMDE_FLOAT64_C(  485.2800) },
+      { SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0343), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.1887),
+        SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.2843), SIMDE_FLOAT64_C(    0.0365), SIMDE_FLOAT64_C(    0.0454) } },
+    { UINT8_C(225),
+      { SIMDE_FLOAT64_C(  272.1700), SIMDE_FLOAT64_C(  592.7100), SIMDE_FLOAT64_C(  101.4400), SIMDE_FLOAT64_C(  103.2700),
+        SIMDE_FLOAT64_C(  152.1600), SIMDE_FLOAT64_C(  143.3900), SIMDE_FLOAT64_C(   59.5100), SIMDE_FLOAT64_C(  763.5200) },
+      { SIMDE_FLOAT64_C(    0.0606), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0000),
+        SIMDE_FLOAT64_C(    0.0000), SIMDE_FLOAT64_C(    0.0835), SIMDE_FLOAT64_C(    0.1296), SIMDE_FLOAT64_C(    0.0362) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d r = simde_mm512_maskz_rsqrt28_pd(test_vec[i].k, a);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 3);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_rsqrt14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_rsqrt14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_rsqrt14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_rsqrt14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_rsqrt14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_rsqrt14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_rsqrt14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_rsqrt14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_rsqrt14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_rsqrt14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_rsqrt14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_rsqrt14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_rsqrt14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_rsqrt14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_rsqrt14_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_rsqrt14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_rsqrt14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_rsqrt14_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_rsqrt14_ss)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_rsqrt14_ss)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_rsqrt14_ss)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_rsqrt14_sd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_rsqrt14_sd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_rsqrt14_sd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_rsqrt28_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_rsqrt28_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_rsqrt28_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_rsqrt28_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_rsqrt28_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_rsqrt28_pd)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
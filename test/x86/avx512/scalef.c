@@ -0,0 +1,674 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+#define SIMDE_TEST_X86_AVX512_INSN scalef
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/scalef.h>
+
+static int
+test_simde_mm512_scalef_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[16];
+    const simde_float32 b[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  541.40), SIMDE_FLOAT32_C( -489.06), SIMDE_FLOAT32_C( -939.77), SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C( -928.97), SIMDE_FLOAT32_C( -301.69), SIMDE_FLOAT32_C(  712.29), SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C(  909.86), SIMDE_FLOAT32_C(  396.50), SIMDE_FLOAT32_C( -452.27), SIMDE_FLOAT32_C(   14.96),
+        SIMDE_FLOAT32_C(  469.83), SIMDE_FLOAT32_C(  -41.65), SIMDE_FLOAT32_C(  757.75), SIMDE_FLOAT32_C(  -43.64) },
+      { SIMDE_FLOAT32_C(   -0.00), SIMDE_FLOAT32_C(    3.03), SIMDE_FLOAT32_C(    0.02), SIMDE_FLOAT32_C(   -0.00),
+        SIMDE_FLOAT32_C(   -4.08), SIMDE_FLOAT32_C(    2.43),     -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    3.89),
+        SIMDE_FLOAT32_C(    1.74),     -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    7.85), SIMDE_FLOAT32_C(    5.36),
+        SIMDE_FLOAT32_C(   -0.00), SIMDE_FLOAT32_C(   -1.01), SIMDE_FLOAT32_C(    0.56),      SIMDE_MATH_INFINITYF },
+      { SIMDE_FLOAT32_C(  541.40), SIMDE_FLOAT32_C(-3912.48), SIMDE_FLOAT32_C( -939.77), SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C(  -29.03), SIMDE_FLOAT32_C(-1206.76), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C( 1819.72), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(-57890.56), SIMDE_FLOAT32_C(  478.72),
+        SIMDE_FLOAT32_C(  469.83), SIMDE_FLOAT32_C(  -10.41), SIMDE_FLOAT32_C(  757.75),     -SIMDE_MATH_INFINITYF } },
+    { { SIMDE_FLOAT32_C( -605.78), SIMDE_FLOAT32_C(  549.68), SIMDE_FLOAT32_C(  606.76), SIMDE_FLOAT32_C(  979.75),
+        SIMDE_FLOAT32_C( -621.12), SIMDE_FLOAT32_C(  250.62),           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  152.86),
+        SIMDE_FLOAT32_C( -230.12), SIMDE_FLOAT32_C(  268.49), SIMDE_FLOAT32_C( -174.22), SIMDE_FLOAT32_C(  494.91),
+        SIMDE_FLOAT32_C(  436.99), SIMDE_FLOAT32_C(  769.35), SIMDE_FLOAT32_C( -375.86), SIMDE_FLOAT32_C(  680.69) },
+      { SIMDE_FLOAT32_C(    1.00), SIMDE_FLOAT32_C(    7.06), SIMDE_FLOAT32_C(    6.47),      SIMDE_MATH_INFINITYF,
+        SIMDE_FLOAT32_C(   -7.18), SIMDE_FLOAT32_C(   -4.51),     -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    5.98),
+        SIMDE_FLOAT32_C(    2.65), SIMDE_FLOAT32_C(    1.00), SIMDE_FLOAT32_C(   -1.13), SIMDE_FLOAT32_C(   -5.96),
+        SIMDE_FLOAT32_C(    1.00), SIMDE_FLOAT32_C(    1.24), SIMDE_FLOAT32_C(   -6.02),      SIMDE_MATH_INFINITYF },
+      { SIMDE_FLOAT32_C(-1211.56), SIMDE_FLOAT32_C(70359.04), SIMDE_FLOAT32_C(38832.64),      SIMDE_MATH_INFINITYF,
+        SIMDE_FLOAT32_C(   -2.43), SIMDE_FLOAT32_C(    7.83), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C( 4891.52),
+        SIMDE_FLOAT32_C( -920.48), SIMDE_FLOAT32_C(  536.98), SIMDE_FLOAT32_C(  -43.56), SIMDE_FLOAT32_C(    7.73),
+        SIMDE_FLOAT32_C(  873.98), SIMDE_FLOAT32_C( 1538.70), SIMDE_FLOAT32_C(   -2.94),      SIMDE_MATH_INFINITYF } },
+    { { SIMDE_FLOAT32_C( -110.82), SIMDE_FLOAT32_C(  892.71), SIMDE_FLOAT32_C( -738.27), SIMDE_FLOAT32_C(   21.39),
+        SIMDE_FLOAT32_C( -557.53),           SIMDE_MATH_NANF, SIMDE_FLOAT32_C( -889.67), SIMDE_FLOAT32_C(   -0.00),
+        SIMDE_FLOAT32_C(  -26.51), SIMDE_FLOAT32_C(  554.91), SIMDE_FLOAT32_C(    1.00), SIMDE_FLOAT32_C(   80.87),
+                  SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  552.49), SIMDE_FLOAT32_C( -926.24), SIMDE_FLOAT32_C(   31.71) },
+      { SIMDE_FLOAT32_C(    5.27), SIMDE_FLOAT32_C(   -2.64), SIMDE_FLOAT32_C(    7.63), SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C(    2.52), SIMDE_FLOAT32_C(   -1.23), SIMDE_FLOAT32_C(   -6.71), SIMDE_FLOAT32_C(    2.05),
+        SIMDE_FLOAT32_C(    3.68), SIMDE_FLOAT32_C(   -6.00), SIMDE_FLOAT32_C(   -7.03), SIMDE_FLOAT32_C(   -3.26),
+        SIMDE_FLOAT32_C(    1.46), SIMDE_FLOAT32_C(   -7.59), SIMDE_FLOAT32_C(    7.50), SIMDE_FLOAT32_C(   -4.55) },
+      { SIMDE_FLOAT32_C(-3546.24), SIMDE_FLOAT32_C(  111.59), SIMDE_FLOAT32_C(-94498.56), SIMDE_FLOAT32_C(   21.39),
+        SIMDE_FLOAT32_C(-2230.12),           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   -6.95), SIMDE_FLOAT32_C(   -0.00),
+        SIMDE_FLOAT32_C( -212.08), SIMDE_FLOAT32_C(    8.67), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    5.05),
+                  SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    2.16), SIMDE_FLOAT32_C(-118558.72), SIMDE_FLOAT32_C(    0.99) } },
+    { { SIMDE_FLOAT32_C( -953.16), SIMDE_FLOAT32_C(  106.32), SIMDE_FLOAT32_C(  282.60), SIMDE_FLOAT32_C( -707.97),
+        SIMDE_FLOAT32_C(  682.70), SIMDE_FLOAT32_C( -522.44), SIMDE_FLOAT32_C( -310.88), SIMDE_FLOAT32_C(   -0.00),
+        SIMDE_FLOAT32_C( -830.36), SIMDE_FLOAT32_C( -108.01), SIMDE_FLOAT32_C( -574.09), SIMDE_FLOAT32_C(  674.53),
+             SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  130.65), SIMDE_FLOAT32_C(  797.63),           SIMDE_MATH_NANF },
+      { SIMDE_FLOAT32_C(    2.32), SIMDE_FLOAT32_C(    4.04), SIMDE_FLOAT32_C(   -3.39), SIMDE_FLOAT32_C(   -2.50),
+        SIMDE_FLOAT32_C(   -1.69), SIMDE_FLOAT32_C(   -2.71), SIMDE_FLOAT32_C(    5.86), SIMDE_FLOAT32_C(   -2.15),
+        SIMDE_FLOAT32_C(    6.84), SIMDE_FLOAT32_C(    6.62), SIMDE_FLOAT32_C(   -4.35), SIMDE_FLOAT32_C(    3.51),
+        SIMDE_FLOAT32_C(   -2.82), SIMDE_FLOAT32_C(   -5.24), SIMDE_FLOAT32_C(    3.39), SIMDE_FLOAT32_C(    6.60) },
+      { SIMDE_FLOAT32_C(-3812.64), SIMDE_FLOAT32_C( 1701.12), SIMDE_FLOAT32_C(   17.66), SIMDE_FLOAT32_C(  -88.50),
+        SIMDE_FLOAT32_C(  170.68), SIMDE_FLOAT32_C(  -65.31), SIMDE_FLOAT32_C(-9948.16), SIMDE_FLOAT32_C(   -0.00),
+        SIMDE_FLOAT32_C(-53143.04), SIMDE_FLOAT32_C(-6912.64), SIMDE_FLOAT32_C(  -17.94), SIMDE_FLOAT32_C( 5396.24),
+             SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    2.04), SIMDE_FLOAT32_C( 6381.04),           SIMDE_MATH_NANF } },
+    { { SIMDE_FLOAT32_C(   -0.00), SIMDE_FLOAT32_C( -682.66), SIMDE_FLOAT32_C( -802.43), SIMDE_FLOAT32_C( -769.11),
+        SIMDE_FLOAT32_C(  945.20), SIMDE_FLOAT32_C(  135.27), SIMDE_FLOAT32_C(   -0.00), SIMDE_FLOAT32_C(  985.04),
+        SIMDE_FLOAT32_C(  751.95), SIMDE_FLOAT32_C( -569.65), SIMDE_FLOAT32_C( -343.50), SIMDE_FLOAT32_C( -940.79),
+        SIMDE_FLOAT32_C(  660.78),     -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  291.40), SIMDE_FLOAT32_C( -964.60) },
+      { SIMDE_FLOAT32_C(   -7.05), SIMDE_FLOAT32_C(   -3.86), SIMDE_FLOAT32_C(   -3.63), SIMDE_FLOAT32_C(   -7.15),
+        SIMDE_FLOAT32_C(   -5.30), SIMDE_FLOAT32_C(    7.16), SIMDE_FLOAT32_C(    4.80), SIMDE_FLOAT32_C(    1.32),
+        SIMDE_FLOAT32_C(   -2.34), SIMDE_FLOAT32_C(   -4.30), SIMDE_FLOAT32_C(   -6.60), SIMDE_FLOAT32_C(    1.98),
+        SIMDE_FLOAT32_C(    7.57), SIMDE_FLOAT32_C(    2.35), SIMDE_FLOAT32_C(   -5.65), SIMDE_FLOAT32_C(    3.59) },
+      { SIMDE_FLOAT32_C(   -0.00), SIMDE_FLOAT32_C(  -42.67), SIMDE_FLOAT32_C(  -50.15), SIMDE_FLOAT32_C(   -3.00),
+        SIMDE_FLOAT32_C(   14.77), SIMDE_FLOAT32_C(17314.56), SIMDE_FLOAT32_C(   -0.00), SIMDE_FLOAT32_C( 1970.08),
+        SIMDE_FLOAT32_C(   93.99), SIMDE_FLOAT32_C(  -17.80), SIMDE_FLOAT32_C(   -2.68), SIMDE_FLOAT32_C(-1881.58),
+        SIMDE_FLOAT32_C(84579.84),     -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    4.55), SIMDE_FLOAT32_C(-7716.80) } },
+    { { SIMDE_FLOAT32_C(  407.49), SIMDE_FLOAT32_C( -986.40), SIMDE_FLOAT32_C( -172.25),      SIMDE_MATH_INFINITYF,
+        SIMDE_FLOAT32_C(  626.64), SIMDE_FLOAT32_C( -585.78), SIMDE_FLOAT32_C( -788.87), SIMDE_FLOAT32_C(   63.15),
+        SIMDE_FLOAT32_C(  282.76), SIMDE_FLOAT32_C( -986.54), SIMDE_FLOAT32_C( -194.21), SIMDE_FLOAT32_C( -802.30),
+        SIMDE_FLOAT32_C( -883.27), SIMDE_FLOAT32_C(    1.65), SIMDE_FLOAT32_C(  410.05), SIMDE_FLOAT32_C( -146.04) },
+      { SIMDE_FLOAT32_C(   -5.12), SIMDE_FLOAT32_C(    7.77), SIMDE_FLOAT32_C(    5.84), SIMDE_FLOAT32_C(    4.91),
+        SIMDE_FLOAT32_C(   -6.47), SIMDE_FLOAT32_C(    4.56), SIMDE_FLOAT32_C(   -7.62), SIMDE_FLOAT32_C(   -4.30),
+        SIMDE_FLOAT32_C(   -1.27), SIMDE_FLOAT32_C(    3.48), SIMDE_FLOAT32_C(   -0.12), SIMDE_FLOAT32_C(   -2.18),
+        SIMDE_FLOAT32_C(   -0.72), SIMDE_FLOAT32_C(   -0.45), SIMDE_FLOAT32_C(   -6.96), SIMDE_FLOAT32_C(   -6.90) },
+      { SIMDE_FLOAT32_C(    6.37), SIMDE_FLOAT32_C(-126259.20), SIMDE_FLOAT32_C(-5512.00),      SIMDE_MATH_INFINITYF,
+        SIMDE_FLOAT32_C(    4.90), SIMDE_FLOAT32_C(-9372.48), SIMDE_FLOAT32_C(   -3.08), SIMDE_FLOAT32_C(    1.97),
+        SIMDE_FLOAT32_C(   70.69), SIMDE_FLOAT32_C(-7892.32), SIMDE_FLOAT32_C(  -97.11), SIMDE_FLOAT32_C( -100.29),
+        SIMDE_FLOAT32_C( -441.64), SIMDE_FLOAT32_C(    0.82), SIMDE_FLOAT32_C(    3.20), SIMDE_FLOAT32_C(   -1.14) } },
+    { { SIMDE_FLOAT32_C(   72.22), SIMDE_FLOAT32_C(  496.75), SIMDE_FLOAT32_C(  954.58), SIMDE_FLOAT32_C( -325.00),
+        SIMDE_FLOAT32_C(  984.53), SIMDE_FLOAT32_C(  195.48), SIMDE_FLOAT32_C( -737.24), SIMDE_FLOAT32_C(  -41.58),
+        SIMDE_FLOAT32_C( -264.37), SIMDE_FLOAT32_C(  796.88), SIMDE_FLOAT32_C(  158.23), SIMDE_FLOAT32_C( -500.71),
+        SIMDE_FLOAT32_C(  352.62), SIMDE_FLOAT32_C(  643.93), SIMDE_FLOAT32_C(  938.89), SIMDE_FLOAT32_C(  195.88) },
+      { SIMDE_FLOAT32_C(   -0.93), SIMDE_FLOAT32_C(    2.19), SIMDE_FLOAT32_C(   -6.68), SIMDE_FLOAT32_C(   -5.95),
+        SIMDE_FLOAT32_C(    3.77), SIMDE_FLOAT32_C(   -2.78), SIMDE_FLOAT32_C(    3.01), SIMDE_FLOAT32_C(   -6.61),
+        SIMDE_FLOAT32_C(   -7.28), SIMDE_FLOAT32_C(   -6.92), SIMDE_FLOAT32_C(   -0.19), SIMDE_FLOAT32_C(   -2.69),
+        SIMDE_FLOAT32_C(   -7.70), SIMDE_FLOAT32_C(    4.75), SIMDE_FLOAT32_C(   -6.97), SIMDE_FLOAT32_C(    2.02) },
+      { SIMDE_FLOAT32_C(   36.11), SIMDE_FLOAT32_C( 1987.00), SIMDE_FLOAT32_C(    7.46), SIMDE_FLOAT32_C(   -5.08),
+        SIMDE_FLOAT32_C( 7876.24), SIMDE_FLOAT32_C(   24.43), SIMDE_FLOAT32_C(-5897.92), SIMDE_FLOAT32_C(   -0.32),
+        SIMDE_FLOAT32_C(   -1.03), SIMDE_FLOAT32_C(    6.23), SIMDE_FLOAT32_C(   79.11), SIMDE_FLOAT32_C(  -62.59),
+        SIMDE_FLOAT32_C(    1.38), SIMDE_FLOAT32_C(10302.88), SIMDE_FLOAT32_C(    7.34), SIMDE_FLOAT32_C(  783.52) } },
+    { { SIMDE_FLOAT32_C( -300.90), SIMDE_FLOAT32_C(   33.33), SIMDE_FLOAT32_C( -921.91), SIMDE_FLOAT32_C( -655.67),
+        SIMDE_FLOAT32_C(  241.44), SIMDE_FLOAT32_C( -835.04), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(  130.61),
+        SIMDE_FLOAT32_C(  534.65), SIMDE_FLOAT32_C(  314.16), SIMDE_FLOAT32_C(  868.71), SIMDE_FLOAT32_C(  193.73),
+        SIMDE_FLOAT32_C( -802.94), SIMDE_FLOAT32_C( -951.74), SIMDE_FLOAT32_C( -559.05), SIMDE_FLOAT32_C(  769.70) },
+      { SIMDE_FLOAT32_C(   -6.30), SIMDE_FLOAT32_C(    7.52), SIMDE_FLOAT32_C(    6.65), SIMDE_FLOAT32_C(   -7.45),
+        SIMDE_FLOAT32_C(    6.95), SIMDE_FLOAT32_C(    6.38), SIMDE_FLOAT32_C(   -0.59), SIMDE_FLOAT32_C(   -7.43),
+        SIMDE_FLOAT32_C(   -6.78), SIMDE_FLOAT32_C(    1.26), SIMDE_FLOAT32_C(    6.47), SIMDE_FLOAT32_C(    0.01),
+        SIMDE_FLOAT32_C(   -0.27), SIMDE_FLOAT32_C(    0.56), SIMDE_FLOAT32_C(   -6.38), SIMDE_FLOAT32_C(   -6.98) },
+      { SIMDE_FLOAT32_C(   -2.35), SIMDE_FLOAT32_C( 4266.24), SIMDE_FLOAT32_C(-59002.24), SIMDE_FLOAT32_C(   -2.56),
+        SIMDE_FLOAT32_C(15452.16), SIMDE_FLOAT32_C(-53442.56), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.51),
+        SIMDE_FLOAT32_C(    4.18), SIMDE_FLOAT32_C(  628.32), SIMDE_FLOAT32_C(55597.44), SIMDE_FLOAT32_C(  193.73),
+        SIMDE_FLOAT32_C( -401.47), SIMDE_FLOAT32_C( -951.74), SIMDE_FLOAT32_C(   -4.37), SIMDE_FLOAT32_C(    6.01) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 b = simde_mm512_loadu_ps(test_vec[i].b);
+    simde__m512 r = simde_mm512_scalef_ps(a, b);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_scalef_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 src[16];
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 b[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(  -10.40), SIMDE_FLOAT32_C( -370.10), SIMDE_FLOAT32_C(  -66.07), SIMDE_FLOAT32_C(   74.96),
+        SIMDE_FLOAT32_C(  190.27), SIMDE_FLOAT32_C( -367.45), SIMDE_FLOAT32_C(  -22.73), SIMDE_FLOAT32_C(  362.84),
+        SIMDE_FLOAT32_C( -129.15), SIMDE_FLOAT32_C( -713.49), SIMDE_FLOAT32_C(  865.91), SIMDE_FLOAT32_C( -441.69),
+        SIMDE_FLOAT32_C(  465.32), SIMDE_FLOAT32_C( -472.82), SIMDE_FLOAT32_C(  585.66), SIMDE_FLOAT32_C(  358.53) },
+      UINT16_C(64681),
+      { SIMDE_FLOAT32_C( -548.70), SIMDE_FLOAT32_C( -995.73), SIMDE_FLOAT32_C(    1.00), SIMDE_FLOAT32_C( -489.51),
+            -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  710.93), SIMDE_FLOAT32_C(    1.00), SIMDE_FLOAT32_C( -429.27),
+        SIMDE_FLOAT32_C( -338.14), SIMDE_FLOAT32_C( -603.53), SIMDE_FLOAT32_C( -212.44), SIMDE_FLOAT32_C(  955.88),
+        SIMDE_FLOAT32_C(  655.54),           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  834.53), SIMDE_FLOAT32_C( -392.18) },
+      { SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(   -7.24), SIMDE_FLOAT32_C(    0.27), SIMDE_FLOAT32_C(   -0.00),
+        SIMDE_FLOAT32_C(    7.73), SIMDE_FLOAT32_C(   -2.88),     -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   -1.78),
+        SIMDE_FLOAT32_C(   -4.90), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(   -2.54), SIMDE_FLOAT32_C(   -4.68),
+             SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    4.13), SIMDE_FLOAT32_C(   -6.09), SIMDE_FLOAT32_C(    0.00) },
+      { SIMDE_FLOAT32_C( -548.70), SIMDE_FLOAT32_C( -370.10), SIMDE_FLOAT32_C(  -66.07), SIMDE_FLOAT32_C( -489.51),
+        SIMDE_FLOAT32_C(  190.27), SIMDE_FLOAT32_C(   88.87), SIMDE_FLOAT32_C(  -22.73), SIMDE_FLOAT32_C( -107.32),
+        SIMDE_FLOAT32_C( -129.15), SIMDE_FLOAT32_C( -713.49), SIMDE_FLOAT32_C(  -26.56), SIMDE_FLOAT32_C(   29.87),
+             SIMDE_MATH_INFINITYF,           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    6.52), SIMDE_FLOAT32_C( -392.18) } },
+    { { SIMDE_FLOAT32_C( -493.78), SIMDE_FLOAT32_C( -488.74), SIMDE_FLOAT32_C( -835.95), SIMDE_FLOAT32_C( -782.41),
+        SIMDE_FLOAT32_C(  377.35), SIMDE_FLOAT32_C(  302.05), SIMDE_FLOAT32_C(  863.58), SIMDE_FLOAT32_C(   35.46),
+        SIMDE_FLOAT32_C(  -37.32), SIMDE_FLOAT32_C(  356.77), SIMDE_FLOAT32_C(  -70.20), SIMDE_FLOAT32_C( -644.94),
+        SIMDE_FLOAT32_C( -363.75), SIMDE_FLOAT32_C(   60.53), SIMDE_FLOAT32_C(  684.29), SIMDE_FLOAT32_C( -954.42) },
+      UINT16_C(47944),
+      { SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C( -686.83), SIMDE_FLOAT32_C( -877.66), SIMDE_FLOAT32_C( -627.66),
+        SIMDE_FLOAT32_C( -453.96), SIMDE_FLOAT32_C( -275.35), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(   54.80),
+        SIMDE_FLOAT32_C( -472.64), SIMDE_FLOAT32_C(  -36.58), SIMDE_FLOAT32_C(  -84.62), SIMDE_FLOAT32_C( -134.78),
+        SIMDE_FLOAT32_C( -886.18), SIMDE_FLOAT32_C(  985.40), SIMDE_FLOAT32_C(   30.56), SIMDE_FLOAT32_C( -831.31) },
+      { SIMDE_FLOAT32_C(   -0.00), SIMDE_FLOAT32_C(   -6.47), SIMDE_FLOAT32_C(   -5.94),     -SIMDE_MATH_INFINITYF,
+        SIMDE_FLOAT32_C(   -0.22), SIMDE_FLOAT32_C(    4.63),           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    6.98),
+        SIMDE_FLOAT32_C(    7.49), SIMDE_FLOAT32_C(   -0.00), SIMDE_FLOAT32_C(    0.54), SIMDE_FLOAT32_C(    5.47),
+             SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   -3.26), SIMDE_FLOAT32_C(    7.85),           SIMDE_MATH_NANF },
+      { SIMDE_FLOAT32_C( -493.78), SIMDE_FLOAT32_C( -488.74), SIMDE_FLOAT32_C( -835.95), SIMDE_FLOAT32_C(   -0.00),
+        SIMDE_FLOAT32_C(  377.35), SIMDE_FLOAT32_C(  302.05),           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   35.46),
+        SIMDE_FLOAT32_C(-60497.92), SIMDE_FLOAT32_C(  -36.58), SIMDE_FLOAT32_C(  -70.20), SIMDE_FLOAT32_C(-4312.96),
+            -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   61.59), SIMDE_FLOAT32_C(  684.29),           SIMDE_MATH_NANF } },
+    { { SIMDE_FLOAT32_C( -611.18), SIMDE_FLOAT32_C( -505.88), SIMDE_FLOAT32_C(  103.21), SIMDE_FLOAT32_C( -615.84),
+        SIMDE_FLOAT32_C( -345.25), SIMDE_FLOAT32_C(  538.75), SIMDE_FLOAT32_C(  401.27), SIMDE_FLOAT32_C(  566.39),
+        SIMDE_FLOAT32_C( -267.41), SIMDE_FLOAT32_C(  618.27), SIMDE_FLOAT32_C(  571.02), SIMDE_FLOAT32_C(  839.32),
+        SIMDE_FLOAT32_C( -500.36), SIMDE_FLOAT32_C( -739.86), SIMDE_FLOAT32_C( -781.97), SIMDE_FLOAT32_C( -729.33) },
+      UINT16_C(44283),
+      { SIMDE_FLOAT32_C( -773.27), SIMDE_FLOAT32_C(  257.63), SIMDE_FLOAT32_C(  642.21), SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C(  191.58), SIMDE_FLOAT32_C(  989.37), SIMDE_FLOAT32_C(  815.58), SIMDE_FLOAT32_C(  223.82),
+        SIMDE_FLOAT32_C(  182.08), SIMDE_FLOAT32_C(  796.07), SIMDE_FLOAT32_C(   71.49), SIMDE_FLOAT32_C(  616.73),
+        SIMDE_FLOAT32_C(  913.22), SIMDE_FLOAT32_C( -317.62), SIMDE_FLOAT32_C(  203.28), SIMDE_FLOAT32_C(  157.25) },
+      { SIMDE_FLOAT32_C(    5.37), SIMDE_FLOAT32_C(    4.68), SIMDE_FLOAT32_C(   -6.62), SIMDE_FLOAT32_C(   -3.77),
+        SIMDE_FLOAT32_C(   -5.50), SIMDE_FLOAT32_C(   -5.14), SIMDE_FLOAT32_C(   -3.83), SIMDE_FLOAT32_C(   -6.95),
+        SIMDE_FLOAT32_C(    1.77), SIMDE_FLOAT32_C(    0.43), SIMDE_FLOAT32_C(   -4.44), SIMDE_FLOAT32_C(    1.50),
+        SIMDE_FLOAT32_C(   -0.47), SIMDE_FLOAT32_C(   -0.90), SIMDE_FLOAT32_C(   -6.52), SIMDE_FLOAT32_C(   -7.09) },
+      { SIMDE_FLOAT32_C(-24744.64), SIMDE_FLOAT32_C( 4122.08), SIMDE_FLOAT32_C(  103.21), SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C(    2.99), SIMDE_FLOAT32_C(   15.46), SIMDE_FLOAT32_C(   50.97), SIMDE_FLOAT32_C(    1.75),
+        SIMDE_FLOAT32_C( -267.41), SIMDE_FLOAT32_C(  618.27), SIMDE_FLOAT32_C(    2.23), SIMDE_FLOAT32_C( 1233.46),
+        SIMDE_FLOAT32_C( -500.36), SIMDE_FLOAT32_C( -158.81), SIMDE_FLOAT32_C( -781.97), SIMDE_FLOAT32_C(    0.61) } },
+    { { SIMDE_FLOAT32_C( -665.74), SIMDE_FLOAT32_C(  923.99), SIMDE_FLOAT32_C(  979.47), SIMDE_FLOAT32_C(  750.51),
+        SIMDE_FLOAT32_C( -266.67), SIMDE_FLOAT32_C(  542.87), SIMDE_FLOAT32_C(  855.61), SIMDE_FLOAT32_C( -681.50),
+        SIMDE_FLOAT32_C(  168.17), SIMDE_FLOAT32_C(  953.80), SIMDE_FLOAT32_C(  451.00), SIMDE_FLOAT32_C( -913.20),
+        SIMDE_FLOAT32_C( -580.83), SIMDE_FLOAT32_C(  796.55), SIMDE_FLOAT32_C( -494.91), SIMDE_FLOAT32_C(  314.48) },
+      UINT16_C(23396),
+      { SIMDE_FLOAT32_C( -614.63), SIMDE_FLOAT32_C( -387.43), SIMDE_FLOAT32_C( -419.36), SIMDE_FLOAT32_C(  610.03),
+        SIMDE_FLOAT32_C(  758.49), SIMDE_FLOAT32_C(  884.23), SIMDE_FLOAT32_C(   58.77), SIMDE_FLOAT32_C( -551.30),
+             SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  241.57), SIMDE_FLOAT32_C( -605.02), SIMDE_FLOAT32_C( -844.19),
+        SIMDE_FLOAT32_C(  112.21), SIMDE_FLOAT32_C(  288.35), SIMDE_FLOAT32_C(  859.20), SIMDE_FLOAT32_C( -652.22) },
+      { SIMDE_FLOAT32_C(   -4.50), SIMDE_FLOAT32_C(    5.92), SIMDE_FLOAT32_C(    3.64), SIMDE_FLOAT32_C(    3.84),
+        SIMDE_FLOAT32_C(    7.05), SIMDE_FLOAT32_C(   -3.58), SIMDE_FLOAT32_C(    1.03), SIMDE_FLOAT32_C(   -4.57),
+        SIMDE_FLOAT32_C(    1.53), SIMDE_FLOAT32_C(    5.13), SIMDE_FLOAT32_C(    6.00), SIMDE_FLOAT32_C(   -5.47),
+        SIMDE_FLOAT32_C(    5.87), SIMDE_FLOAT32_C(    3.61), SIMDE_FLOAT32_C(    3.75), SIMDE_FLOAT32_C(    2.15) },
+      { SIMDE_FLOAT32_C( -665.74), SIMDE_FLOAT32_C(  923.99), SIMDE_FLOAT32_C(-3354.88), SIMDE_FLOAT32_C(  750.51),
+        SIMDE_FLOAT32_C( -266.67), SIMDE_FLOAT32_C(   55.26), SIMDE_FLOAT32_C(  117.54), SIMDE_FLOAT32_C( -681.50),
+             SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C( 7730.24), SIMDE_FLOAT32_C(  451.00), SIMDE_FLOAT32_C(  -13.19),
+        SIMDE_FLOAT32_C( 3590.72), SIMDE_FLOAT32_C(  796.55), SIMDE_FLOAT32_C( 6873.60), SIMDE_FLOAT32_C(  314.48) } },
+    { { SIMDE_FLOAT32_C( -798.41), SIMDE_FLOAT32_C(  403.25), SIMDE_FLOAT32_C(  458.27), SIMDE_FLOAT32_C(  650.99),
+        SIMDE_FLOAT32_C(  710.67), SIMDE_FLOAT32_C( -782.68), SIMDE_FLOAT32_C( -824.87), SIMDE_FLOAT32_C( -670.79),
+        SIMDE_FLOAT32_C( -578.09), SIMDE_FLOAT32_C( -209.94), SIMDE_FLOAT32_C(   13.18), SIMDE_FLOAT32_C(  628.76),
+        SIMDE_FLOAT32_C( -801.95), SIMDE_FLOAT32_C(  469.10), SIMDE_FLOAT32_C(  864.57), SIMDE_FLOAT32_C(  949.90) },
+      UINT16_C(39181),
+      { SIMDE_FLOAT32_C(  378.51), SIMDE_FLOAT32_C(   -0.00), SIMDE_FLOAT32_C( -117.63), SIMDE_FLOAT32_C(  953.80),
+        SIMDE_FLOAT32_C( -263.14), SIMDE_FLOAT32_C(  715.07), SIMDE_FLOAT32_C(    1.00), SIMDE_FLOAT32_C(    1.00),
+        SIMDE_FLOAT32_C( -969.60), SIMDE_FLOAT32_C(  405.92), SIMDE_FLOAT32_C(    8.54), SIMDE_FLOAT32_C( -751.56),
+        SIMDE_FLOAT32_C(    1.00), SIMDE_FLOAT32_C( -572.79), SIMDE_FLOAT32_C(  486.45), SIMDE_FLOAT32_C(  179.08) },
+      { SIMDE_FLOAT32_C(    6.22), SIMDE_FLOAT32_C(   -6.52), SIMDE_FLOAT32_C(    6.02), SIMDE_FLOAT32_C(    3.94),
+        SIMDE_FLOAT32_C(    5.41), SIMDE_FLOAT32_C(   -0.12), SIMDE_FLOAT32_C(    3.15), SIMDE_FLOAT32_C(   -5.39),
+        SIMDE_FLOAT32_C(    7.17), SIMDE_FLOAT32_C(    3.93), SIMDE_FLOAT32_C(    2.88), SIMDE_FLOAT32_C(    5.77),
+        SIMDE_FLOAT32_C(    6.05), SIMDE_FLOAT32_C(   -1.95), SIMDE_FLOAT32_C(    3.55), SIMDE_FLOAT32_C(    1.49) },
+      { SIMDE_FLOAT32_C(24224.64), SIMDE_FLOAT32_C(  403.25), SIMDE_FLOAT32_C(-7528.32), SIMDE_FLOAT32_C( 7630.40),
+        SIMDE_FLOAT32_C(  710.67), SIMDE_FLOAT32_C( -782.68), SIMDE_FLOAT32_C( -824.87), SIMDE_FLOAT32_C( -670.79),
+        SIMDE_FLOAT32_C(-124108.80), SIMDE_FLOAT32_C( -209.94), SIMDE_FLOAT32_C(   13.18), SIMDE_FLOAT32_C(-24049.92),
+        SIMDE_FLOAT32_C(   64.00), SIMDE_FLOAT32_C(  469.10), SIMDE_FLOAT32_C(  864.57), SIMDE_FLOAT32_C(  358.16) } },
+    { { SIMDE_FLOAT32_C(  -57.23), SIMDE_FLOAT32_C( -163.68), SIMDE_FLOAT32_C(  -36.40), SIMDE_FLOAT32_C( -938.66),
+        SIMDE_FLOAT32_C( -248.58), SIMDE_FLOAT32_C(  123.86), SIMDE_FLOAT32_C(  273.54), SIMDE_FLOAT32_C( -641.50),
+        SIMDE_FLOAT32_C(  593.98), SIMDE_FLOAT32_C(  713.01), SIMDE_FLOAT32_C(  194.81), SIMDE_FLOAT32_C( -779.33),
+        SIMDE_FLOAT32_C(  462.64), SIMDE_FLOAT32_C(  991.50), SIMDE_FLOAT32_C(  859.13), SIMDE_FLOAT32_C( -634.78) },
+      UINT16_C(44827),
+      { SIMDE_FLOAT32_C(  217.54),     -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C( -381.10), SIMDE_FLOAT32_C( -205.62),
+        SIMDE_FLOAT32_C(    1.00), SIMDE_FLOAT32_C(  186.14), SIMDE_FLOAT32_C(  341.30), SIMDE_FLOAT32_C(  553.67),
+        SIMDE_FLOAT32_C(  761.73),           SIMDE_MATH_NANF, SIMDE_FLOAT32_C( -172.04), SIMDE_FLOAT32_C(  250.88),
+        SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(   -0.00), SIMDE_FLOAT32_C( -279.32), SIMDE_FLOAT32_C( -646.69) },
+      { SIMDE_FLOAT32_C(    6.36), SIMDE_FLOAT32_C(    7.20), SIMDE_FLOAT32_C(    2.24), SIMDE_FLOAT32_C(    4.21),
+        SIMDE_FLOAT32_C(   -1.54), SIMDE_FLOAT32_C(    1.07), SIMDE_FLOAT32_C(    3.76), SIMDE_FLOAT32_C(   -4.37),
+        SIMDE_FLOAT32_C(    6.83), SIMDE_FLOAT32_C(   -6.92), SIMDE_FLOAT32_C(   -7.37), SIMDE_FLOAT32_C(   -0.44),
+        SIMDE_FLOAT32_C(   -5.54), SIMDE_FLOAT32_C(   -6.58), SIMDE_FLOAT32_C(    4.08), SIMDE_FLOAT32_C(    6.44) },
+      { SIMDE_FLOAT32_C(13922.56),     -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  -36.40), SIMDE_FLOAT32_C(-3289.92),
+        SIMDE_FLOAT32_C(    0.25), SIMDE_FLOAT32_C(  123.86), SIMDE_FLOAT32_C(  273.54), SIMDE_FLOAT32_C( -641.50),
+        SIMDE_FLOAT32_C(48750.72),           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   -0.67), SIMDE_FLOAT32_C(  125.44),
+        SIMDE_FLOAT32_C(  462.64), SIMDE_FLOAT32_C(   -0.00), SIMDE_FLOAT32_C(  859.13), SIMDE_FLOAT32_C(-41388.16) } },
+    { { SIMDE_FLOAT32_C(  618.99), SIMDE_FLOAT32_C( -393.58), SIMDE_FLOAT32_C( -678.76), SIMDE_FLOAT32_C(  -75.06),
+        SIMDE_FLOAT32_C( -387.71), SIMDE_FLOAT32_C( -732.95), SIMDE_FLOAT32_C(  219.80), SIMDE_FLOAT32_C(  -73.53),
+        SIMDE_FLOAT32_C(  -64.05), SIMDE_FLOAT32_C(  751.37), SIMDE_FLOAT32_C(  693.65), SIMDE_FLOAT32_C(  576.24),
+        SIMDE_FLOAT32_C(  395.66), SIMDE_FLOAT32_C(  -17.78), SIMDE_FLOAT32_C( -848.28), SIMDE_FLOAT32_C( -680.76) },
+      UINT16_C(52918),
+      { SIMDE_FLOAT32_C(  203.57), SIMDE_FLOAT32_C(    1.00), SIMDE_FLOAT32_C(  -89.42), SIMDE_FLOAT32_C(  372.88),
+        SIMDE_FLOAT32_C( -682.92), SIMDE_FLOAT32_C( -586.09), SIMDE_FLOAT32_C( -302.64), SIMDE_FLOAT32_C( -378.53),
+        SIMDE_FLOAT32_C(  587.17), SIMDE_FLOAT32_C( -418.65), SIMDE_FLOAT32_C(  489.19), SIMDE_FLOAT32_C( -932.19),
+        SIMDE_FLOAT32_C( -248.01),     -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  799.32), SIMDE_FLOAT32_C(  533.97) },
+      { SIMDE_FLOAT32_C(    4.54), SIMDE_FLOAT32_C(   -2.87), SIMDE_FLOAT32_C(    7.41), SIMDE_FLOAT32_C(   -4.94),
+        SIMDE_FLOAT32_C(   -7.64), SIMDE_FLOAT32_C(   -7.19), SIMDE_FLOAT32_C(   -6.04), SIMDE_FLOAT32_C(    4.31),
+        SIMDE_FLOAT32_C(   -2.64), SIMDE_FLOAT32_C(   -5.76), SIMDE_FLOAT32_C(   -7.46), SIMDE_FLOAT32_C(    6.38),
+        SIMDE_FLOAT32_C(    0.93), SIMDE_FLOAT32_C(   -3.51), SIMDE_FLOAT32_C(    1.84), SIMDE_FLOAT32_C(    6.44) },
+      { SIMDE_FLOAT32_C(  618.99), SIMDE_FLOAT32_C(    0.12), SIMDE_FLOAT32_C(-11445.76), SIMDE_FLOAT32_C(  -75.06),
+        SIMDE_FLOAT32_C(   -2.67), SIMDE_FLOAT32_C(   -2.29), SIMDE_FLOAT32_C(  219.80), SIMDE_FLOAT32_C(-6056.48),
+        SIMDE_FLOAT32_C(  -64.05), SIMDE_FLOAT32_C(   -6.54), SIMDE_FLOAT32_C(    1.91), SIMDE_FLOAT32_C(-59660.16),
+        SIMDE_FLOAT32_C(  395.66), SIMDE_FLOAT32_C(  -17.78), SIMDE_FLOAT32_C( 1598.64), SIMDE_FLOAT32_C(34174.08) } },
+    { { SIMDE_FLOAT32_C( -774.76), SIMDE_FLOAT32_C(  461.75), SIMDE_FLOAT32_C( -673.16), SIMDE_FLOAT32_C( -533.49),
+        SIMDE_FLOAT32_C(  406.26), SIMDE_FLOAT32_C(  109.06), SIMDE_FLOAT32_C(  659.85), SIMDE_FLOAT32_C(  280.69),
+        SIMDE_FLOAT32_C(  639.05), SIMDE_FLOAT32_C( -303.91), SIMDE_FLOAT32_C(  756.40), SIMDE_FLOAT32_C(  100.00),
+        SIMDE_FLOAT32_C(  817.27), SIMDE_FLOAT32_C(  840.96), SIMDE_FLOAT32_C(  928.55), SIMDE_FLOAT32_C(  107.55) },
+      UINT16_C(29716),
+      { SIMDE_FLOAT32_C(  326.53), SIMDE_FLOAT32_C( -427.22),      SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C( -662.81),
+        SIMDE_FLOAT32_C(  432.48), SIMDE_FLOAT32_C(  -34.32), SIMDE_FLOAT32_C( -616.93), SIMDE_FLOAT32_C(    1.00),
+        SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C( -396.26), SIMDE_FLOAT32_C( -809.84),           SIMDE_MATH_NANF,
+             SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C( -529.57), SIMDE_FLOAT32_C(  394.87), SIMDE_FLOAT32_C(  815.34) },
+      { SIMDE_FLOAT32_C(    2.53), SIMDE_FLOAT32_C(    5.65), SIMDE_FLOAT32_C(    7.10), SIMDE_FLOAT32_C(    1.10),
+        SIMDE_FLOAT32_C(   -4.46), SIMDE_FLOAT32_C(    6.57), SIMDE_FLOAT32_C(    2.52), SIMDE_FLOAT32_C(   -2.66),
+        SIMDE_FLOAT32_C(    3.97), SIMDE_FLOAT32_C(   -4.18), SIMDE_FLOAT32_C(    2.51), SIMDE_FLOAT32_C(   -2.20),
+        SIMDE_FLOAT32_C(    0.27), SIMDE_FLOAT32_C(   -4.10), SIMDE_FLOAT32_C(   -3.19), SIMDE_FLOAT32_C(    3.22) },
+      { SIMDE_FLOAT32_C( -774.76), SIMDE_FLOAT32_C(  461.75),      SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C( -533.49),
+        SIMDE_FLOAT32_C(   13.52), SIMDE_FLOAT32_C(  109.06), SIMDE_FLOAT32_C(  659.85), SIMDE_FLOAT32_C(  280.69),
+        SIMDE_FLOAT32_C(  639.05), SIMDE_FLOAT32_C( -303.91), SIMDE_FLOAT32_C(-3239.36), SIMDE_FLOAT32_C(  100.00),
+             SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  -16.55), SIMDE_FLOAT32_C(   24.68), SIMDE_FLOAT32_C(  107.55) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 src = simde_mm512_loadu_ps(test_vec[i].src);
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 b = simde_mm512_loadu_ps(test_vec[i].b);
+    simde__m512 r = simde_mm512_mask_scalef_ps(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_scalef_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const simde_float32 a[16];
+    const simde_float32 b[16];
+    const simde_float32 r[16];
+  } test_vec[] = {
+    { UINT16_C(32090),
+      { SIMDE_FLOAT32_C(  553.05), SIMDE_FLOAT32_C(  535.83), SIMDE_FLOAT32_C( -810.00), SIMDE_FLOAT32_C(  635.33),
+        SIMDE_FLOAT32_C(  658.15), SIMDE_FLOAT32_C( -252.19), SIMDE_FLOAT32_C(  893.33), SIMDE_FLOAT32_C( -616.95),
+        SIMDE_FLOAT32_C(  950.07), SIMDE_FLOAT32_C(  -90.37), SIMDE_FLOAT32_C( -651.55), SIMDE_FLOAT32_C(  966.00),
+        SIMDE_FLOAT32_C( -180.66), SIMDE_FLOAT32_C( -174.80), SIMDE_FLOAT32_C(  755.26), SIMDE_FLOAT32_C(  269.66) },
+      { SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    2.06), SIMDE_FLOAT32_C(   -6.15),      SIMDE_MATH_INFINITYF,
+        SIMDE_FLOAT32_C(    7.30), SIMDE_FLOAT32_C(    6.03),           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   -7.92),
+        SIMDE_FLOAT32_C(    5.16),      SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    1.87), SIMDE_FLOAT32_C(    2.59),
+        SIMDE_FLOAT32_C(    1.00), SIMDE_FLOAT32_C(   -6.75), SIMDE_FLOAT32_C(    3.04),           SIMDE_MATH_NANF },
+      { SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C( 2143.32), SIMDE_FLOAT32_C(    0.00),      SIMDE_MATH_INFINITYF,
+        SIMDE_FLOAT32_C(84243.20), SIMDE_FLOAT32_C(    0.00),           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C(30402.24), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(-1303.10), SIMDE_FLOAT32_C( 3864.00),
+        SIMDE_FLOAT32_C( -361.32), SIMDE_FLOAT32_C(   -1.37), SIMDE_FLOAT32_C( 6042.08), SIMDE_FLOAT32_C(    0.00) } },
+    { UINT16_C(34322),
+      { SIMDE_FLOAT32_C( -200.01), SIMDE_FLOAT32_C( -983.21), SIMDE_FLOAT32_C(  -83.37), SIMDE_FLOAT32_C( -955.86),
+        SIMDE_FLOAT32_C(   69.68), SIMDE_FLOAT32_C(  722.34), SIMDE_FLOAT32_C( -595.43), SIMDE_FLOAT32_C( -806.65),
+            -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  823.43), SIMDE_FLOAT32_C( -438.07), SIMDE_FLOAT32_C(  379.12),
+        SIMDE_FLOAT32_C(  523.77), SIMDE_FLOAT32_C(    3.27), SIMDE_FLOAT32_C(  111.02), SIMDE_FLOAT32_C(  792.72) },
+      { SIMDE_FLOAT32_C(   -0.00), SIMDE_FLOAT32_C(    4.27), SIMDE_FLOAT32_C(    5.19),           SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(    0.38), SIMDE_FLOAT32_C(    6.00),     -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   -4.44),
+        SIMDE_FLOAT32_C(   -7.30),      SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    1.79), SIMDE_FLOAT32_C(    6.09),
+        SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    1.35), SIMDE_FLOAT32_C(   -5.44), SIMDE_FLOAT32_C(    1.00) },
+      { SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(-15731.36), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C(   69.68), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C(    0.00),      SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C( -876.14), SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C( 1585.44) } },
+    { UINT16_C(42055),
+      { SIMDE_FLOAT32_C(  917.14), SIMDE_FLOAT32_C(  534.35), SIMDE_FLOAT32_C( -475.53), SIMDE_FLOAT32_C(  650.57),
+        SIMDE_FLOAT32_C( -738.34), SIMDE_FLOAT32_C(  716.66), SIMDE_FLOAT32_C( -258.80), SIMDE_FLOAT32_C(  958.33),
+        SIMDE_FLOAT32_C( -926.20), SIMDE_FLOAT32_C(  390.25), SIMDE_FLOAT32_C(  725.33), SIMDE_FLOAT32_C( -114.96),
+        SIMDE_FLOAT32_C(   54.67),     -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C( -789.28), SIMDE_FLOAT32_C(  934.89) },
+      { SIMDE_FLOAT32_C(   -0.58), SIMDE_FLOAT32_C(   -7.45), SIMDE_FLOAT32_C(    5.23), SIMDE_FLOAT32_C(   -3.90),
+        SIMDE_FLOAT32_C(   -2.71), SIMDE_FLOAT32_C(   -2.40), SIMDE_FLOAT32_C(    4.85), SIMDE_FLOAT32_C(    5.18),
+        SIMDE_FLOAT32_C(   -6.94), SIMDE_FLOAT32_C(   -4.90), SIMDE_FLOAT32_C(    4.63), SIMDE_FLOAT32_C(    2.32),
+        SIMDE_FLOAT32_C(    4.97), SIMDE_FLOAT32_C(   -7.35), SIMDE_FLOAT32_C(   -4.58), SIMDE_FLOAT32_C(    0.31) },
+      { SIMDE_FLOAT32_C(  458.57), SIMDE_FLOAT32_C(    2.09), SIMDE_FLOAT32_C(-15216.96), SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(-4140.80), SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(11605.28), SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C(    0.00),     -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(  934.89) } },
+    { UINT16_C( 9968),
+      { SIMDE_FLOAT32_C( -160.26), SIMDE_FLOAT32_C( -788.21), SIMDE_FLOAT32_C(  490.31), SIMDE_FLOAT32_C( -120.00),
+        SIMDE_FLOAT32_C( -251.63), SIMDE_FLOAT32_C(  -88.72), SIMDE_FLOAT32_C( -884.34), SIMDE_FLOAT32_C( -330.67),
+        SIMDE_FLOAT32_C( -171.98), SIMDE_FLOAT32_C( -357.06), SIMDE_FLOAT32_C( -621.87), SIMDE_FLOAT32_C(  795.45),
+        SIMDE_FLOAT32_C(  335.37), SIMDE_FLOAT32_C( -396.61), SIMDE_FLOAT32_C(  -62.42), SIMDE_FLOAT32_C(  742.48) },
+      { SIMDE_FLOAT32_C(   -1.79), SIMDE_FLOAT32_C(   -3.30), SIMDE_FLOAT32_C(    5.36), SIMDE_FLOAT32_C(   -6.04),
+        SIMDE_FLOAT32_C(    5.89), SIMDE_FLOAT32_C(    2.09), SIMDE_FLOAT32_C(    5.22), SIMDE_FLOAT32_C(    0.82),
+        SIMDE_FLOAT32_C(   -7.76), SIMDE_FLOAT32_C(   -5.13), SIMDE_FLOAT32_C(    7.08), SIMDE_FLOAT32_C(   -1.81),
+        SIMDE_FLOAT32_C(    3.59), SIMDE_FLOAT32_C(    4.50), SIMDE_FLOAT32_C(    3.15), SIMDE_FLOAT32_C(    0.95) },
+      { SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C(-8052.16), SIMDE_FLOAT32_C( -354.88), SIMDE_FLOAT32_C(-28298.88), SIMDE_FLOAT32_C( -330.67),
+        SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(   -5.58), SIMDE_FLOAT32_C(-79599.36), SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(-6345.76), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00) } },
+    { UINT16_C(23462),
+      { SIMDE_FLOAT32_C( -499.81), SIMDE_FLOAT32_C(  471.33), SIMDE_FLOAT32_C(  850.90), SIMDE_FLOAT32_C(  684.43),
+        SIMDE_FLOAT32_C(  936.97), SIMDE_FLOAT32_C(  331.35), SIMDE_FLOAT32_C(  105.90), SIMDE_FLOAT32_C(  879.86),
+        SIMDE_FLOAT32_C(  632.19), SIMDE_FLOAT32_C( -715.22), SIMDE_FLOAT32_C(   -0.00), SIMDE_FLOAT32_C(  850.43),
+        SIMDE_FLOAT32_C(  605.58), SIMDE_FLOAT32_C(  696.28), SIMDE_FLOAT32_C( -591.18),           SIMDE_MATH_NANF },
+      { SIMDE_FLOAT32_C(   -1.59), SIMDE_FLOAT32_C(   -0.05), SIMDE_FLOAT32_C(    4.43), SIMDE_FLOAT32_C(   -6.68),
+        SIMDE_FLOAT32_C(    3.25), SIMDE_FLOAT32_C(   -5.50), SIMDE_FLOAT32_C(    6.16), SIMDE_FLOAT32_C(   -6.64),
+        SIMDE_FLOAT32_C(    1.17), SIMDE_FLOAT32_C(   -4.76), SIMDE_FLOAT32_C(   -4.53), SIMDE_FLOAT32_C(   -3.26),
+        SIMDE_FLOAT32_C(   -2.33), SIMDE_FLOAT32_C(    6.74), SIMDE_FLOAT32_C(    2.73), SIMDE_FLOAT32_C(    3.75) },
+      { SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(  235.66), SIMDE_FLOAT32_C(13614.40), SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    5.18), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    6.87),
+        SIMDE_FLOAT32_C( 1264.38), SIMDE_FLOAT32_C(  -22.35), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(   53.15),
+        SIMDE_FLOAT32_C(   75.70), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(-2364.72), SIMDE_FLOAT32_C(    0.00) } },
+    { UINT16_C(23237),
+      { SIMDE_FLOAT32_C(  423.90), SIMDE_FLOAT32_C(  746.44), SIMDE_FLOAT32_C(  251.76), SIMDE_FLOAT32_C( -468.93),
+        SIMDE_FLOAT32_C(  512.99), SIMDE_FLOAT32_C( -276.91), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C( -181.32),
+        SIMDE_FLOAT32_C( -776.61), SIMDE_FLOAT32_C( -782.94), SIMDE_FLOAT32_C( -249.09), SIMDE_FLOAT32_C( -656.27),
+        SIMDE_FLOAT32_C(  863.21), SIMDE_FLOAT32_C(  111.07), SIMDE_FLOAT32_C(  234.24), SIMDE_FLOAT32_C(  306.83) },
+      { SIMDE_FLOAT32_C(    0.62), SIMDE_FLOAT32_C(    1.83), SIMDE_FLOAT32_C(   -0.37), SIMDE_FLOAT32_C(   -4.74),
+        SIMDE_FLOAT32_C(    4.02), SIMDE_FLOAT32_C(    0.57), SIMDE_FLOAT32_C(   -2.78), SIMDE_FLOAT32_C(    1.55),
+        SIMDE_FLOAT32_C(    1.02), SIMDE_FLOAT32_C(    5.82), SIMDE_FLOAT32_C(   -1.11), SIMDE_FLOAT32_C(   -0.04),
+        SIMDE_FLOAT32_C(   -0.96), SIMDE_FLOAT32_C(    3.48), SIMDE_FLOAT32_C(    1.30), SIMDE_FLOAT32_C(   -2.95) },
+      { SIMDE_FLOAT32_C(  423.90), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(  125.88), SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C( -362.64),
+        SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(-25054.08), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C( -328.14),
+        SIMDE_FLOAT32_C(  431.61), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(  468.48), SIMDE_FLOAT32_C(    0.00) } },
+    { UINT16_C(21621),
+      { SIMDE_FLOAT32_C( -510.37), SIMDE_FLOAT32_C( -944.67), SIMDE_FLOAT32_C(  658.17), SIMDE_FLOAT32_C(  110.53),
+        SIMDE_FLOAT32_C(  872.46), SIMDE_FLOAT32_C(  885.13), SIMDE_FLOAT32_C(   13.35), SIMDE_FLOAT32_C(  324.36),
+        SIMDE_FLOAT32_C(  211.75),           SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  597.74), SIMDE_FLOAT32_C( -541.73),
+        SIMDE_FLOAT32_C(  857.51), SIMDE_FLOAT32_C(  -67.07), SIMDE_FLOAT32_C(  -42.93), SIMDE_FLOAT32_C(  240.83) },
+      { SIMDE_FLOAT32_C(    7.71), SIMDE_FLOAT32_C(    0.90), SIMDE_FLOAT32_C(    1.76), SIMDE_FLOAT32_C(   -4.81),
+        SIMDE_FLOAT32_C(   -6.20), SIMDE_FLOAT32_C(   -7.32), SIMDE_FLOAT32_C(    1.38), SIMDE_FLOAT32_C(   -1.31),
+        SIMDE_FLOAT32_C(    3.33), SIMDE_FLOAT32_C(   -7.62), SIMDE_FLOAT32_C(   -7.43), SIMDE_FLOAT32_C(    0.50),
+        SIMDE_FLOAT32_C(    6.80), SIMDE_FLOAT32_C(   -0.85), SIMDE_FLOAT32_C(   -4.07), SIMDE_FLOAT32_C(    6.58) },
+      { SIMDE_FLOAT32_C(-65327.36), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C( 1316.34), SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C(    6.82), SIMDE_FLOAT32_C(    3.46), SIMDE_FLOAT32_C(   26.70), SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    2.33), SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C(54880.64), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(   -1.34), SIMDE_FLOAT32_C(    0.00) } },
+    { UINT16_C(12118),
+      { SIMDE_FLOAT32_C(  231.98), SIMDE_FLOAT32_C(  415.33),      SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(  359.30),
+        SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C( -756.83), SIMDE_FLOAT32_C( -607.22), SIMDE_FLOAT32_C( -322.91),
+        SIMDE_FLOAT32_C(  -92.77), SIMDE_FLOAT32_C(  239.56), SIMDE_FLOAT32_C( -508.85), SIMDE_FLOAT32_C( -775.88),
+        SIMDE_FLOAT32_C(  177.42), SIMDE_FLOAT32_C(    6.26), SIMDE_FLOAT32_C( -163.95), SIMDE_FLOAT32_C( -410.04) },
+      { SIMDE_FLOAT32_C(    3.60), SIMDE_FLOAT32_C(    0.52), SIMDE_FLOAT32_C(   -5.66), SIMDE_FLOAT32_C(    2.73),
+        SIMDE_FLOAT32_C(   -0.23), SIMDE_FLOAT32_C(    3.12), SIMDE_FLOAT32_C(    1.56), SIMDE_FLOAT32_C(    2.21),
+        SIMDE_FLOAT32_C(    4.95), SIMDE_FLOAT32_C(    7.37), SIMDE_FLOAT32_C(    3.88), SIMDE_FLOAT32_C(   -2.24),
+        SIMDE_FLOAT32_C(   -2.83), SIMDE_FLOAT32_C(    2.57), SIMDE_FLOAT32_C(    6.75), SIMDE_FLOAT32_C(    4.85) },
+      { SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(  415.33),      SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(-1214.44), SIMDE_FLOAT32_C(    0.00),
+        SIMDE_FLOAT32_C(-1484.32), SIMDE_FLOAT32_C(30663.68), SIMDE_FLOAT32_C(-4070.80), SIMDE_FLOAT32_C(  -96.99),
+        SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(   25.04), SIMDE_FLOAT32_C(    0.00), SIMDE_FLOAT32_C(    0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde__m512 b = simde_mm512_loadu_ps(test_vec[i].b);
+    simde__m512 r = simde_mm512_maskz_scalef_ps(test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_f32x16(r, simde_mm512_loadu_ps(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_scalef_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 a[8];
+    const simde_float64 b[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C(  195.72), SIMDE_FLOAT64_C( -151.10), SIMDE_FLOAT64_C( -259.19), SIMDE_FLOAT64_C( -498.00),
+        SIMDE_FLOAT64_C(  384.48), SIMDE_FLOAT64_C(  523.52), SIMDE_FLOAT64_C( -123.88), SIMDE_FLOAT64_C(  700.95) },
+      { SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(   -0.66), SIMDE_FLOAT64_C(    2.91), SIMDE_FLOAT64_C(    0.00),
+        SIMDE_FLOAT64_C(    1.28), SIMDE_FLOAT64_C(   -7.11),      -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(   -0.02) },
+      { SIMDE_FLOAT64_C(  195.72), SIMDE_FLOAT64_C(  -75.55), SIMDE_FLOAT64_C(-1036.76), SIMDE_FLOAT64_C( -498.00),
+        SIMDE_FLOAT64_C(  768.96), SIMDE_FLOAT64_C(    2.04), SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C(  350.48) } },
+    { { SIMDE_FLOAT64_C(  205.54), SIMDE_FLOAT64_C(  510.39), SIMDE_FLOAT64_C(   54.08), SIMDE_FLOAT64_C(    0.00),
+        SIMDE_FLOAT64_C(  415.07), SIMDE_FLOAT64_C(  -91.75), SIMDE_FLOAT64_C( -206.65), SIMDE_FLOAT64_C(   60.65) },
+      { SIMDE_FLOAT64_C(    1.00), SIMDE_FLOAT64_C(   -3.13), SIMDE_FLOAT64_C(    5.38),            SIMDE_MATH_NAN,
+        SIMDE_FLOAT64_C(   -5.38), SIMDE_FLOAT64_C(   -3.84), SIMDE_FLOAT64_C(    1.00), SIMDE_FLOAT64_C(    7.71) },
+      { SIMDE_FLOAT64_C(  411.08), SIMDE_FLOAT64_C(   31.90), SIMDE_FLOAT64_C( 1730.56),            SIMDE_MATH_NAN,
+        SIMDE_FLOAT64_C(    6.49), SIMDE_FLOAT64_C(   -5.73), SIMDE_FLOAT64_C( -413.30), SIMDE_FLOAT64_C( 7763.20) } },
+    { { SIMDE_FLOAT64_C(  605.85),            SIMDE_MATH_NAN, SIMDE_FLOAT64_C( -156.49), SIMDE_FLOAT64_C( -301.50),
+        SIMDE_FLOAT64_C(  187.18), SIMDE_FLOAT64_C( -291.26), SIMDE_FLOAT64_C( -295.53), SIMDE_FLOAT64_C(  628.34) },
+      { SIMDE_FLOAT64_C(    3.25), SIMDE_FLOAT64_C(   -2.99), SIMDE_FLOAT64_C(    5.94), SIMDE_FLOAT64_C(   -0.96),
+        SIMDE_FLOAT64_C(   -2.10), SIMDE_FLOAT64_C(   -1.60), SIMDE_FLOAT64_C(   -2.49), SIMDE_FLOAT64_C(   -6.56) },
+      { SIMDE_FLOAT64_C( 4846.80),            SIMDE_MATH_NAN, SIMDE_FLOAT64_C(-5007.68), SIMDE_FLOAT64_C( -150.75),
+        SIMDE_FLOAT64_C(   23.40), SIMDE_FLOAT64_C(  -72.81), SIMDE_FLOAT64_C(  -36.94), SIMDE_FLOAT64_C(    4.91) } },
+    { { SIMDE_FLOAT64_C( -815.93), SIMDE_FLOAT64_C(  296.26), SIMDE_FLOAT64_C(  633.07),       SIMDE_MATH_INFINITY,
+        SIMDE_FLOAT64_C(  895.80), SIMDE_FLOAT64_C( -825.10), SIMDE_FLOAT64_C( -728.83), SIMDE_FLOAT64_C(  889.34) },
+      { SIMDE_FLOAT64_C(   -7.08), SIMDE_FLOAT64_C(   -5.44), SIMDE_FLOAT64_C(    3.58), SIMDE_FLOAT64_C(    1.20),
+        SIMDE_FLOAT64_C(    3.26), SIMDE_FLOAT64_C(   -5.98), SIMDE_FLOAT64_C(   -3.45), SIMDE_FLOAT64_C(   -2.74) },
+      { SIMDE_FLOAT64_C(   -3.19), SIMDE_FLOAT64_C(    4.63), SIMDE_FLOAT64_C( 5064.56),       SIMDE_MATH_INFINITY,
+        SIMDE_FLOAT64_C( 7166.40), SIMDE_FLOAT64_C(  -12.89), SIMDE_FLOAT64_C(  -45.55), SIMDE_FLOAT64_C(  111.17) } },
+    { { SIMDE_FLOAT64_C( -206.28), SIMDE_FLOAT64_C(  907.66), SIMDE_FLOAT64_C(  959.22), SIMDE_FLOAT64_C(    0.00),
+              SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C( -281.70), SIMDE_FLOAT64_C( -291.47), SIMDE_FLOAT64_C(  198.14) },
+      { SIMDE_FLOAT64_C(   -4.02), SIMDE_FLOAT64_C(   -7.37), SIMDE_FLOAT64_C(   -3.39), SIMDE_FLOAT64_C(   -6.16),
+        SIMDE_FLOAT64_C(   -0.09), SIMDE_FLOAT64_C(   -7.00), SIMDE_FLOAT64_C(   -4.95), SIMDE_FLOAT64_C(   -2.38) },
+      { SIMDE_FLOAT64_C(   -6.45), SIMDE_FLOAT64_C(    3.55), SIMDE_FLOAT64_C(   59.95), SIMDE_FLOAT64_C(    0.00),
+              SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(   -2.20), SIMDE_FLOAT64_C(   -9.11), SIMDE_FLOAT64_C(   24.77) } },
+    { { SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C( -676.82),       SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(  441.69),
+        SIMDE_FLOAT64_C( -872.27), SIMDE_FLOAT64_C(  982.33), SIMDE_FLOAT64_C( -729.20), SIMDE_FLOAT64_C(  319.00) },
+      { SIMDE_FLOAT64_C(    5.08), SIMDE_FLOAT64_C(   -2.38), SIMDE_FLOAT64_C(    0.53), SIMDE_FLOAT64_C(   -6.23),
+        SIMDE_FLOAT64_C(    7.44), SIMDE_FLOAT64_C(    2.45), SIMDE_FLOAT64_C(    4.91), SIMDE_FLOAT64_C(   -7.24) },
+      { SIMDE_FLOAT64_C(   -0.00), SIMDE_FLOAT64_C(  -84.60),       SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(    3.45),
+        SIMDE_FLOAT64_C(-111650.56), SIMDE_FLOAT64_C( 3929.32), SIMDE_FLOAT64_C(-11667.20), SIMDE_FLOAT64_C(    1.25) } },
+    { { SIMDE_FLOAT64_C( -693.18), SIMDE_FLOAT64_C( -793.06), SIMDE_FLOAT64_C(  -86.05), SIMDE_FLOAT64_C( -479.48),
+        SIMDE_FLOAT64_C(  612.70), SIMDE_FLOAT64_C( -228.94),            SIMDE_MATH_NAN, SIMDE_FLOAT64_C(  291.15) },
+      { SIMDE_FLOAT64_C(   -1.91), SIMDE_FLOAT64_C(    6.81), SIMDE_FLOAT64_C(   -5.53), SIMDE_FLOAT64_C(    2.08),
+        SIMDE_FLOAT64_C(    2.55), SIMDE_FLOAT64_C(    5.33), SIMDE_FLOAT64_C(   -1.86), SIMDE_FLOAT64_C(   -3.60) },
+      { SIMDE_FLOAT64_C( -173.29), SIMDE_FLOAT64_C(-50755.84), SIMDE_FLOAT64_C(   -1.34), SIMDE_FLOAT64_C(-1917.92),
+        SIMDE_FLOAT64_C( 2450.80), SIMDE_FLOAT64_C(-7326.08),            SIMDE_MATH_NAN, SIMDE_FLOAT64_C(   18.20) } },
+    { { SIMDE_FLOAT64_C(  360.63),      -SIMDE_MATH_INFINITY,      -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C( -300.67),
+        SIMDE_FLOAT64_C(  893.51), SIMDE_FLOAT64_C(  700.12), SIMDE_FLOAT64_C(  288.33), SIMDE_FLOAT64_C(  114.10) },
+      { SIMDE_FLOAT64_C(    3.23), SIMDE_FLOAT64_C(   -3.81), SIMDE_FLOAT64_C(    6.14), SIMDE_FLOAT64_C(   -2.12),
+        SIMDE_FLOAT64_C(    2.84), SIMDE_FLOAT64_C(   -0.68), SIMDE_FLOAT64_C(    7.88), SIMDE_FLOAT64_C(   -6.93) },
+      { SIMDE_FLOAT64_C( 2885.04),      -SIMDE_MATH_INFINITY,      -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(  -37.58),
+        SIMDE_FLOAT64_C( 3574.04), SIMDE_FLOAT64_C(  350.06), SIMDE_FLOAT64_C(36906.24), SIMDE_FLOAT64_C(    0.89) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d b = simde_mm512_loadu_pd(test_vec[i].b);
+    simde__m512d r = simde_mm512_scalef_pd(a, b);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_scalef_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float64 src[8];
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 b[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT64_C( -778.64), SIMDE_FLOAT64_C(  644.84), SIMDE_FLOAT64_C(  888.06), SIMDE_FLOAT64_C(  582.08),
+        SIMDE_FLOAT64_C( -682.34), SIMDE_FLOAT64_C(  184.82), SIMDE_FLOAT64_C(  994.02), SIMDE_FLOAT64_C( -719.70) },
+      UINT8_C( 34),
+      { SIMDE_FLOAT64_C(  279.46),            SIMDE_MATH_NAN, SIMDE_FLOAT64_C(  157.81), SIMDE_FLOAT64_C(  126.25),
+        SIMDE_FLOAT64_C(  996.42), SIMDE_FLOAT64_C( -894.84), SIMDE_FLOAT64_C(  868.63), SIMDE_FLOAT64_C(  295.57) },
+      {      -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(   -3.90), SIMDE_FLOAT64_C(   -7.99),            SIMDE_MATH_NAN,
+        SIMDE_FLOAT64_C(   -5.26), SIMDE_FLOAT64_C(   -1.96), SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(   -4.82) },
+      { SIMDE_FLOAT64_C( -778.64),            SIMDE_MATH_NAN, SIMDE_FLOAT64_C(  888.06), SIMDE_FLOAT64_C(  582.08),
+        SIMDE_FLOAT64_C( -682.34), SIMDE_FLOAT64_C( -223.71), SIMDE_FLOAT64_C(  994.02), SIMDE_FLOAT64_C( -719.70) } },
+    { { SIMDE_FLOAT64_C( -330.06), SIMDE_FLOAT64_C(  462.66), SIMDE_FLOAT64_C(  352.97), SIMDE_FLOAT64_C( -814.31),
+        SIMDE_FLOAT64_C(   82.38), SIMDE_FLOAT64_C(  621.43), SIMDE_FLOAT64_C( -171.56), SIMDE_FLOAT64_C( -462.13) },
+      UINT8_C(147),
+      { SIMDE_FLOAT64_C( -926.90), SIMDE_FLOAT64_C(   90.54), SIMDE_FLOAT64_C(  190.70), SIMDE_FLOAT64_C( -841.82),
+        SIMDE_FLOAT64_C(  562.92), SIMDE_FLOAT64_C(  880.45), SIMDE_FLOAT64_C(  873.21), SIMDE_FLOAT64_C( -895.73) },
+      {            SIMDE_MATH_NAN, SIMDE_FLOAT64_C(    7.75), SIMDE_FLOAT64_C(    6.10), SIMDE_FLOAT64_C(    1.00),
+        SIMDE_FLOAT64_C(    7.68), SIMDE_FLOAT64_C(   -7.81),      -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(   -1.49) },
+      {            SIMDE_MATH_NAN, SIMDE_FLOAT64_C(11589.12), SIMDE_FLOAT64_C(  352.97), SIMDE_FLOAT64_C( -814.31),
+        SIMDE_FLOAT64_C(72053.76), SIMDE_FLOAT64_C(  621.43), SIMDE_FLOAT64_C( -171.56), SIMDE_FLOAT64_C( -223.93) } },
+    { { SIMDE_FLOAT64_C( -529.38), SIMDE_FLOAT64_C( -500.70), SIMDE_FLOAT64_C(  488.61), SIMDE_FLOAT64_C( -719.74),
+        SIMDE_FLOAT64_C( -168.49), SIMDE_FLOAT64_C( -160.92), SIMDE_FLOAT64_C(  384.64), SIMDE_FLOAT64_C( -713.48) },
+      UINT8_C(217),
+      { SIMDE_FLOAT64_C( -514.46), SIMDE_FLOAT64_C( -840.20), SIMDE_FLOAT64_C( -958.93), SIMDE_FLOAT64_C( -702.21),
+        SIMDE_FLOAT64_C(  894.78),       SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(  855.93), SIMDE_FLOAT64_C(  654.38) },
+      { SIMDE_FLOAT64_C(   -0.58), SIMDE_FLOAT64_C(   -7.02), SIMDE_FLOAT64_C(   -0.10), SIMDE_FLOAT64_C(    7.46),
+        SIMDE_FLOAT64_C(    1.60), SIMDE_FLOAT64_C(   -4.99), SIMDE_FLOAT64_C(   -5.36), SIMDE_FLOAT64_C(   -6.95) },
+      { SIMDE_FLOAT64_C( -257.23), SIMDE_FLOAT64_C( -500.70), SIMDE_FLOAT64_C(  488.61), SIMDE_FLOAT64_C(-89882.88),
+        SIMDE_FLOAT64_C( 1789.56), SIMDE_FLOAT64_C( -160.92), SIMDE_FLOAT64_C(   13.37), SIMDE_FLOAT64_C(    5.11) } },
+    { { SIMDE_FLOAT64_C(  640.38), SIMDE_FLOAT64_C( -662.61), SIMDE_FLOAT64_C( -409.15), SIMDE_FLOAT64_C(  788.41),
+        SIMDE_FLOAT64_C(  216.28), SIMDE_FLOAT64_C( -182.74), SIMDE_FLOAT64_C( -241.36), SIMDE_FLOAT64_C(  -47.39) },
+      UINT8_C(235),
+      { SIMDE_FLOAT64_C(  437.47), SIMDE_FLOAT64_C(    1.00), SIMDE_FLOAT64_C( -621.59), SIMDE_FLOAT64_C( -961.34),
+        SIMDE_FLOAT64_C(  714.18), SIMDE_FLOAT64_C( -444.52), SIMDE_FLOAT64_C(  188.95), SIMDE_FLOAT64_C( -595.73) },
+      { SIMDE_FLOAT64_C(   -6.34), SIMDE_FLOAT64_C(    5.50), SIMDE_FLOAT64_C(   -0.07), SIMDE_FLOAT64_C(   -3.78),
+        SIMDE_FLOAT64_C(    7.21), SIMDE_FLOAT64_C(    5.17), SIMDE_FLOAT64_C(    1.91), SIMDE_FLOAT64_C(    6.38) },
+      { SIMDE_FLOAT64_C(    3.42), SIMDE_FLOAT64_C(   32.00), SIMDE_FLOAT64_C( -409.15), SIMDE_FLOAT64_C(  -60.08),
+        SIMDE_FLOAT64_C(  216.28), SIMDE_FLOAT64_C(-14224.64), SIMDE_FLOAT64_C(  377.90), SIMDE_FLOAT64_C(-38126.72) } },
+    { { SIMDE_FLOAT64_C( -583.25), SIMDE_FLOAT64_C(  339.84), SIMDE_FLOAT64_C(  120.32), SIMDE_FLOAT64_C(  983.48),
+        SIMDE_FLOAT64_C(  439.47), SIMDE_FLOAT64_C(  949.54), SIMDE_FLOAT64_C( -420.40), SIMDE_FLOAT64_C(  604.68) },
+      UINT8_C( 85),
+      { SIMDE_FLOAT64_C( -138.69), SIMDE_FLOAT64_C( -631.44), SIMDE_FLOAT64_C(  408.44), SIMDE_FLOAT64_C( -209.91),
+        SIMDE_FLOAT64_C(  790.98), SIMDE_FLOAT64_C(  748.17), SIMDE_FLOAT64_C( -286.94), SIMDE_FLOAT64_C( -858.01) },
+      { SIMDE_FLOAT64_C(    7.82), SIMDE_FLOAT64_C(   -5.94), SIMDE_FLOAT64_C(   -3.48), SIMDE_FLOAT64_C(    1.64),
+        SIMDE_FLOAT64_C(    6.02), SIMDE_FLOAT64_C(    2.67), SIMDE_FLOAT64_C(   -3.91), SIMDE_FLOAT64_C(    1.17) },
+      { SIMDE_FLOAT64_C(-17752.32), SIMDE_FLOAT64_C(  339.84), SIMDE_FLOAT64_C(   25.53), SIMDE_FLOAT64_C(  983.48),
+        SIMDE_FLOAT64_C(50622.72), SIMDE_FLOAT64_C(  949.54), SIMDE_FLOAT64_C(  -17.93), SIMDE_FLOAT64_C(  604.68) } },
+    { { SIMDE_FLOAT64_C(  522.31), SIMDE_FLOAT64_C( -296.18), SIMDE_FLOAT64_C(  194.51), SIMDE_FLOAT64_C(  657.17),
+        SIMDE_FLOAT64_C( -587.05), SIMDE_FLOAT64_C(  -72.22), SIMDE_FLOAT64_C( -620.38), SIMDE_FLOAT64_C(   17.61) },
+      UINT8_C( 51),
+      {      -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(  600.36), SIMDE_FLOAT64_C( -887.84), SIMDE_FLOAT64_C( -759.43),
+        SIMDE_FLOAT64_C( -233.75), SIMDE_FLOAT64_C(  -42.25), SIMDE_FLOAT64_C( -953.86), SIMDE_FLOAT64_C(  898.14) },
+      { SIMDE_FLOAT64_C(    5.92), SIMDE_FLOAT64_C(    2.96), SIMDE_FLOAT64_C(    6.46), SIMDE_FLOAT64_C(   -2.02),
+        SIMDE_FLOAT64_C(    4.29), SIMDE_FLOAT64_C(   -3.08), SIMDE_FLOAT64_C(   -2.04), SIMDE_FLOAT64_C(   -3.91) },
+      {      -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C( 2401.44), SIMDE_FLOAT64_C(  194.51), SIMDE_FLOAT64_C(  657.17),
+        SIMDE_FLOAT64_C(-3740.00), SIMDE_FLOAT64_C(   -2.64), SIMDE_FLOAT64_C( -620.38), SIMDE_FLOAT64_C(   17.61) } },
+    { { SIMDE_FLOAT64_C( -166.34), SIMDE_FLOAT64_C(  294.30), SIMDE_FLOAT64_C( -343.14), SIMDE_FLOAT64_C( -248.86),
+        SIMDE_FLOAT64_C(  100.54), SIMDE_FLOAT64_C( -618.03), SIMDE_FLOAT64_C(  373.19), SIMDE_FLOAT64_C(  794.18) },
+      UINT8_C(195),
+      { SIMDE_FLOAT64_C(   79.80), SIMDE_FLOAT64_C(  883.15), SIMDE_FLOAT64_C( -532.79), SIMDE_FLOAT64_C( -311.46),
+        SIMDE_FLOAT64_C( -250.70), SIMDE_FLOAT64_C( -924.32),            SIMDE_MATH_NAN, SIMDE_FLOAT64_C( -835.21) },
+      { SIMDE_FLOAT64_C(   -0.21), SIMDE_FLOAT64_C(    4.28), SIMDE_FLOAT64_C(   -5.58), SIMDE_FLOAT64_C(   -7.46),
+        SIMDE_FLOAT64_C(   -6.05), SIMDE_FLOAT64_C(   -2.96), SIMDE_FLOAT64_C(   -5.85), SIMDE_FLOAT64_C(   -1.31) },
+      { SIMDE_FLOAT64_C(   39.90), SIMDE_FLOAT64_C(14130.40), SIMDE_FLOAT64_C( -343.14), SIMDE_FLOAT64_C( -248.86),
+        SIMDE_FLOAT64_C(  100.54), SIMDE_FLOAT64_C( -618.03),            SIMDE_MATH_NAN, SIMDE_FLOAT64_C( -208.80) } },
+    { { SIMDE_FLOAT64_C( -477.04), SIMDE_FLOAT64_C( -230.98), SIMDE_FLOAT64_C(  418.44), SIMDE_FLOAT64_C( -347.98),
+        SIMDE_FLOAT64_C(  181.42), SIMDE_FLOAT64_C(  472.66), SIMDE_FLOAT64_C(  317.79), SIMDE_FLOAT64_C(  355.61) },
+      UINT8_C( 36),
+      { SIMDE_FLOAT64_C(  -88.50), SIMDE_FLOAT64_C(  475.97), SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(  227.35),
+        SIMDE_FLOAT64_C( -925.06), SIMDE_FLOAT64_C( -590.31), SIMDE_FLOAT64_C( -178.04), SIMDE_FLOAT64_C( -636.70) },
+      { SIMDE_FLOAT64_C(   -6.71), SIMDE_FLOAT64_C(    2.50), SIMDE_FLOAT64_C(    4.54), SIMDE_FLOAT64_C(   -7.08),
+        SIMDE_FLOAT64_C(    3.99), SIMDE_FLOAT64_C(    5.63), SIMDE_FLOAT64_C(   -3.59), SIMDE_FLOAT64_C(    5.74) },
+      { SIMDE_FLOAT64_C( -477.04), SIMDE_FLOAT64_C( -230.98), SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C( -347.98),
+        SIMDE_FLOAT64_C(  181.42), SIMDE_FLOAT64_C(-18889.92), SIMDE_FLOAT64_C(  317.79), SIMDE_FLOAT64_C(  355.61) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d src = simde_mm512_loadu_pd(test_vec[i].src);
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d b = simde_mm512_loadu_pd(test_vec[i].b);
+    simde__m512d r = simde_mm512_mask_scalef_pd(src, test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_scalef_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const simde_float64 a[8];
+    const simde_float64 b[8];
+    const simde_float64 r[8];
+  } test_vec[] = {
+    { UINT8_C( 46),
+      { SIMDE_FLOAT64_C(  685.06),      -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(  818.85), SIMDE_FLOAT64_C(  784.32),
+        SIMDE_FLOAT64_C(  649.49), SIMDE_FLOAT64_C( -982.77), SIMDE_FLOAT64_C(  691.97), SIMDE_FLOAT64_C( -720.71) },
+      {       SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(    2.43), SIMDE_FLOAT64_C(    0.83), SIMDE_FLOAT64_C(   -0.00),
+        SIMDE_FLOAT64_C(    0.43), SIMDE_FLOAT64_C(    0.84),       SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(   -5.44) },
+      { SIMDE_FLOAT64_C(    0.00),      -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(  818.85), SIMDE_FLOAT64_C(  784.32),
+        SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C( -982.77), SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00) } },
+    { UINT8_C( 31),
+      { SIMDE_FLOAT64_C(  359.56), SIMDE_FLOAT64_C(  501.40), SIMDE_FLOAT64_C(  512.02), SIMDE_FLOAT64_C( -475.68),
+        SIMDE_FLOAT64_C( -931.02), SIMDE_FLOAT64_C( -254.38), SIMDE_FLOAT64_C( -193.55), SIMDE_FLOAT64_C( -347.08) },
+      { SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    2.95), SIMDE_FLOAT64_C(   -0.16),            SIMDE_MATH_NAN,
+        SIMDE_FLOAT64_C(   -7.33), SIMDE_FLOAT64_C(   -7.71), SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(   -1.46) },
+      { SIMDE_FLOAT64_C(  359.56), SIMDE_FLOAT64_C( 2005.60), SIMDE_FLOAT64_C(  256.01),            SIMDE_MATH_NAN,
+        SIMDE_FLOAT64_C(   -3.64), SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00) } },
+    { UINT8_C(  7),
+      { SIMDE_FLOAT64_C( -610.09), SIMDE_FLOAT64_C(  204.81), SIMDE_FLOAT64_C( -586.17), SIMDE_FLOAT64_C(  172.47),
+        SIMDE_FLOAT64_C( -728.77), SIMDE_FLOAT64_C( -892.01), SIMDE_FLOAT64_C(  -28.25),            SIMDE_MATH_NAN },
+      { SIMDE_FLOAT64_C(    0.88), SIMDE_FLOAT64_C(    2.70), SIMDE_FLOAT64_C(    3.62), SIMDE_FLOAT64_C(   -7.47),
+        SIMDE_FLOAT64_C(    7.73), SIMDE_FLOAT64_C(   -0.22), SIMDE_FLOAT64_C(    1.25), SIMDE_FLOAT64_C(   -6.63) },
+      { SIMDE_FLOAT64_C( -610.09), SIMDE_FLOAT64_C(  819.24), SIMDE_FLOAT64_C(-4689.36), SIMDE_FLOAT64_C(    0.00),
+        SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00) } },
+    { UINT8_C(167),
+      { SIMDE_FLOAT64_C(  117.64), SIMDE_FLOAT64_C(  926.30), SIMDE_FLOAT64_C( -973.02), SIMDE_FLOAT64_C( -229.79),
+                   SIMDE_MATH_NAN, SIMDE_FLOAT64_C( -381.96), SIMDE_FLOAT64_C(  512.93), SIMDE_FLOAT64_C( -170.42) },
+      { SIMDE_FLOAT64_C(    6.25), SIMDE_FLOAT64_C(   -1.87), SIMDE_FLOAT64_C(   -0.71), SIMDE_FLOAT64_C(    4.50),
+        SIMDE_FLOAT64_C(    7.35), SIMDE_FLOAT64_C(    3.61), SIMDE_FLOAT64_C(    4.37), SIMDE_FLOAT64_C(   -4.55) },
+      { SIMDE_FLOAT64_C( 7528.96), SIMDE_FLOAT64_C(  231.57), SIMDE_FLOAT64_C( -486.51), SIMDE_FLOAT64_C(    0.00),
+        SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(-3055.68), SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(   -5.33) } },
+    { UINT8_C( 86),
+      { SIMDE_FLOAT64_C( -485.92), SIMDE_FLOAT64_C(  -15.75), SIMDE_FLOAT64_C( -281.01), SIMDE_FLOAT64_C( -767.44),
+             -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(  527.90), SIMDE_FLOAT64_C(  554.66), SIMDE_FLOAT64_C( -829.66) },
+      { SIMDE_FLOAT64_C(    4.15), SIMDE_FLOAT64_C(    2.07), SIMDE_FLOAT64_C(   -3.81), SIMDE_FLOAT64_C(    4.79),
+        SIMDE_FLOAT64_C(    5.71), SIMDE_FLOAT64_C(    1.62), SIMDE_FLOAT64_C(   -2.16), SIMDE_FLOAT64_C(   -3.62) },
+      { SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(  -63.00), SIMDE_FLOAT64_C(  -17.56), SIMDE_FLOAT64_C(    0.00),
+             -SIMDE_MATH_INFINITY, SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(   69.33), SIMDE_FLOAT64_C(    0.00) } },
+    { UINT8_C( 82),
+      { SIMDE_FLOAT64_C(  218.23), SIMDE_FLOAT64_C( -326.83), SIMDE_FLOAT64_C(  -97.25), SIMDE_FLOAT64_C(  679.45),
+        SIMDE_FLOAT64_C( -558.38), SIMDE_FLOAT64_C( -740.73), SIMDE_FLOAT64_C( -809.29), SIMDE_FLOAT64_C(  -13.26) },
+      { SIMDE_FLOAT64_C(   -7.25), SIMDE_FLOAT64_C(   -1.03), SIMDE_FLOAT64_C(    1.39), SIMDE_FLOAT64_C(   -3.07),
+        SIMDE_FLOAT64_C(   -4.05), SIMDE_FLOAT64_C(   -3.57), SIMDE_FLOAT64_C(   -6.26), SIMDE_FLOAT64_C(    1.90) },
+      { SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(  -81.71), SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00),
+        SIMDE_FLOAT64_C(  -17.45), SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(   -6.32), SIMDE_FLOAT64_C(    0.00) } },
+    { UINT8_C( 71),
+      { SIMDE_FLOAT64_C( -267.56), SIMDE_FLOAT64_C( -329.78), SIMDE_FLOAT64_C( -364.43), SIMDE_FLOAT64_C(  349.81),
+        SIMDE_FLOAT64_C(  730.34), SIMDE_FLOAT64_C(  733.98), SIMDE_FLOAT64_C( -359.43), SIMDE_FLOAT64_C(  952.26) },
+      { SIMDE_FLOAT64_C(    3.42), SIMDE_FLOAT64_C(    0.52), SIMDE_FLOAT64_C(   -6.15), SIMDE_FLOAT64_C(    5.99),
+        SIMDE_FLOAT64_C(   -0.62), SIMDE_FLOAT64_C(    0.88), SIMDE_FLOAT64_C(   -5.52), SIMDE_FLOAT64_C(   -1.36) },
+      { SIMDE_FLOAT64_C(-2140.48), SIMDE_FLOAT64_C( -329.78), SIMDE_FLOAT64_C(   -2.85), SIMDE_FLOAT64_C(    0.00),
+        SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(   -5.62), SIMDE_FLOAT64_C(    0.00) } },
+    { UINT8_C( 35),
+      { SIMDE_FLOAT64_C(  105.65), SIMDE_FLOAT64_C(  954.51), SIMDE_FLOAT64_C(   68.72), SIMDE_FLOAT64_C( -702.78),
+                   SIMDE_MATH_NAN, SIMDE_FLOAT64_C(  866.15), SIMDE_FLOAT64_C(  350.09), SIMDE_FLOAT64_C( -435.95) },
+      { SIMDE_FLOAT64_C(   -0.91), SIMDE_FLOAT64_C(    7.99), SIMDE_FLOAT64_C(   -6.91), SIMDE_FLOAT64_C(   -1.56),
+        SIMDE_FLOAT64_C(   -0.16), SIMDE_FLOAT64_C(    4.93), SIMDE_FLOAT64_C(    7.34), SIMDE_FLOAT64_C(    4.69) },
+      { SIMDE_FLOAT64_C(   52.83), SIMDE_FLOAT64_C(122177.28), SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00),
+        SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(13858.40), SIMDE_FLOAT64_C(    0.00), SIMDE_FLOAT64_C(    0.00) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde__m512d b = simde_mm512_loadu_pd(test_vec[i].b);
+    simde__m512d r = simde_mm512_maskz_scalef_pd(test_vec[i].k, a, b);
+    simde_test_x86_assert_equal_f64x8(r, simde_mm512_loadu_pd(test_vec[i].r), 1);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_scalef_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_scalef_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_scalef_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_scalef_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_scalef_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_scalef_pd)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -0,0 +1,3155 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN scatter
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/scatter.h>
+
+static const int32_t test_scatter_i32[32] = {
+  -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+   INT32_C(   310840079), -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1128593813), -INT32_C(  1249725146), -INT32_C(  1351075380),  INT32_C(  1987001023),
+  -INT32_C(  1039226102), -INT32_C(  1594280740),  INT32_C(  1912893877),  INT32_C(  2112271382),  INT32_C(   969850110), -INT32_C(  1853628921),  INT32_C(  1029814395),  INT32_C(  1709966795),
+  -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307)
+};
+
+static const int64_t test_scatter_i64[32] = {
+   INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+   INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+   INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+   INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+   INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+  -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+   INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+   INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600)
+};
+
+static const simde_float32 test_scatter_f32[32] = {
+  SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+  SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+  SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+  SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -443.95),
+  SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -739.50),
+  SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -367.96),
+  SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+  SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55)
+};
+
+static const simde_float64 test_scatter_f64[32] = {
+  SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+  SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+  SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+  SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+  SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+  SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+  SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+  SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50)
+};
+
+static int
+test_simde_mm_i32scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t vindex[4];
+    const int32_t a[4];
+    const int32_t r[32];
+  } test_vec[] = {
+    { {  INT32_C(           9),  INT32_C(           5), -INT32_C(           3),  INT32_C(          10) },
+      { -INT32_C(   231451521), -INT32_C(   496712937), -INT32_C(  2142228655), -INT32_C(   936412337) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(   310840079), -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1128593813), -INT32_C(  2142228655), -INT32_C(  1351075380),  INT32_C(  1987001023),
+        -INT32_C(  1039226102), -INT32_C(  1594280740),  INT32_C(  1912893877),  INT32_C(  2112271382),  INT32_C(   969850110), -INT32_C(   496712937),  INT32_C(  1029814395),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   231451521), -INT32_C(   936412337), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } },
+    { {  INT32_C(           8),  INT32_C(           4), -INT32_C(           5),  INT32_C(          15) },
+      { -INT32_C(   583651110),  INT32_C(  2137860667),  INT32_C(   381689519), -INT32_C(   543435438) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(   310840079), -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(   381689519),  INT32_C(  1128593813), -INT32_C(  1249725146), -INT32_C(  1351075380),  INT32_C(  1987001023),
+        -INT32_C(  1039226102), -INT32_C(  1594280740),  INT32_C(  1912893877),  INT32_C(  2112271382),  INT32_C(  2137860667), -INT32_C(  1853628921),  INT32_C(  1029814395),  INT32_C(  1709966795),
+        -INT32_C(   583651110), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413), -INT32_C(   543435438) } },
+    { {  INT32_C(          10),  INT32_C(           1),  INT32_C(           5),  INT32_C(          14) },
+      {  INT32_C(  1889324880), -INT32_C(   113761586),  INT32_C(  1082990859), -INT32_C(   327738999) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(   310840079), -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1128593813), -INT32_C(  1249725146), -INT32_C(  1351075380),  INT32_C(  1987001023),
+        -INT32_C(  1039226102), -INT32_C(   113761586),  INT32_C(  1912893877),  INT32_C(  2112271382),  INT32_C(   969850110),  INT32_C(  1082990859),  INT32_C(  1029814395),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1889324880), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370), -INT32_C(   327738999),  INT32_C(  1867292307) } },
+    { {  INT32_C(           7),  INT32_C(          15), -INT32_C(          16), -INT32_C(          11) },
+      {  INT32_C(    70522200),  INT32_C(   829827954),  INT32_C(  1589140388),  INT32_C(   423707155) },
+      {  INT32_C(  1589140388),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618),  INT32_C(   423707155), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(   310840079), -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1128593813), -INT32_C(  1249725146), -INT32_C(  1351075380),  INT32_C(  1987001023),
+        -INT32_C(  1039226102), -INT32_C(  1594280740),  INT32_C(  1912893877),  INT32_C(  2112271382),  INT32_C(   969850110), -INT32_C(  1853628921),  INT32_C(  1029814395),  INT32_C(    70522200),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(   829827954) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    int32_t r[32];
+
+    simde_memcpy(r, test_scatter_i32, sizeof(r));
+    simde_mm_i32scatter_epi32(&(r[16]), vindex, a, 4);
+    simde_assert_equal_vi32(32, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_i32scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t vindex[4];
+    const int32_t a[4];
+    const int32_t r[32];
+  } test_vec[] = {
+    { UINT8_C( 15),
+      {  INT32_C(           6),  INT32_C(           1),  INT32_C(          12),  INT32_C(          14) },
+      { -INT32_C(   435431558), -INT32_C(  1653252524),  INT32_C(   956473832),  INT32_C(  2125717163) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(   310840079), -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1128593813), -INT32_C(  1249725146), -INT32_C(  1351075380),  INT32_C(  1987001023),
+        -INT32_C(  1039226102), -INT32_C(  1653252524),  INT32_C(  1912893877),  INT32_C(  2112271382),  INT32_C(   969850110), -INT32_C(  1853628921), -INT32_C(   435431558),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(   956473832), -INT32_C(   945185370),  INT32_C(  2125717163),  INT32_C(  1867292307) } },
+    { UINT8_C(129),
+      { -INT32_C(           3),  INT32_C(           3), -INT32_C(           1), -INT32_C(           9) },
+      {  INT32_C(  2052639754),  INT32_C(   960118546), -INT32_C(   235024404), -INT32_C(  1367978125) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(   310840079), -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1128593813),  INT32_C(  2052639754), -INT32_C(  1351075380),  INT32_C(  1987001023),
+        -INT32_C(  1039226102), -INT32_C(  1594280740),  INT32_C(  1912893877),  INT32_C(  2112271382),  INT32_C(   969850110), -INT32_C(  1853628921),  INT32_C(  1029814395),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } },
+    { UINT8_C(213),
+      {  INT32_C(           7), -INT32_C(          14), -INT32_C(           9), -INT32_C(           6) },
+      { -INT32_C(  1869933234), -INT32_C(   200371996), -INT32_C(  1009503035), -INT32_C(   635564564) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344), -INT32_C(  1009503035),
+         INT32_C(   310840079), -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1128593813), -INT32_C(  1249725146), -INT32_C(  1351075380),  INT32_C(  1987001023),
+        -INT32_C(  1039226102), -INT32_C(  1594280740),  INT32_C(  1912893877),  INT32_C(  2112271382),  INT32_C(   969850110), -INT32_C(  1853628921),  INT32_C(  1029814395), -INT32_C(  1869933234),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } },
+    { UINT8_C(146),
+      {  INT32_C(          15), -INT32_C(           1), -INT32_C(           4), -INT32_C(           6) },
+      {  INT32_C(  1029272989), -INT32_C(  1885274058),  INT32_C(   328503222), -INT32_C(   684422359) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(   310840079), -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1128593813), -INT32_C(  1249725146), -INT32_C(  1351075380), -INT32_C(  1885274058),
+        -INT32_C(  1039226102), -INT32_C(  1594280740),  INT32_C(  1912893877),  INT32_C(  2112271382),  INT32_C(   969850110), -INT32_C(  1853628921),  INT32_C(  1029814395),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    int32_t r[32];
+
+    simde_memcpy(r, test_scatter_i32, sizeof(r));
+    simde_mm_mask_i32scatter_epi32(&(r[16]), test_vec[i].k, vindex, a, 4);
+    simde_assert_equal_vi32(32, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_i32scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t vindex[4];
+    const int64_t a[2];
+    const int64_t r[32];
+  } test_vec[] = {
+    { {  INT32_C(           1), -INT32_C(          10), -INT32_C(           9), -INT32_C(           4) },
+      { -INT64_C( 7784250367037593018),  INT64_C( 1458455197914198418) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 1458455197914198418),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694), -INT64_C( 7784250367037593018), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } },
+    { { -INT32_C(          14), -INT32_C(          15),  INT32_C(           1), -INT32_C(           7) },
+      {  INT64_C( 3331435031876636896),  INT64_C(   63651805706334657) },
+      {  INT64_C( 1028018298114786158),  INT64_C(   63651805706334657),  INT64_C( 3331435031876636896), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } },
+    { { -INT32_C(           9), -INT32_C(          12),  INT32_C(           2),  INT32_C(          15) },
+      { -INT64_C( 2976192371702284515),  INT64_C( 5450146628263850531) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 5450146628263850531), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023), -INT64_C( 2976192371702284515),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } },
+    { {  INT32_C(           6), -INT32_C(           8),  INT32_C(           4), -INT32_C(          14) },
+      {  INT64_C( 5043213863628237545),  INT64_C( 8920018688654620028) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 8920018688654620028), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602),  INT64_C( 5043213863628237545), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    int64_t r[32];
+
+    simde_memcpy(r, test_scatter_i64, sizeof(r));
+    simde_mm_i32scatter_epi64(&(r[16]), vindex, a, 8);
+    simde_assert_equal_vi64(32, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_i32scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t vindex[4];
+    const int64_t a[2];
+    const int64_t r[32];
+  } test_vec[] = {
+    { UINT8_C(  3),
+      {  INT32_C(          10), -INT32_C(          13), -INT32_C(           4),  INT32_C(          11) },
+      {  INT64_C( 2463436120087517697), -INT64_C(  794479721859307531) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C(  794479721859307531),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 2463436120087517697),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } },
+    { UINT8_C(176),
+      {  INT32_C(           0), -INT32_C(          10), -INT32_C(           9), -INT32_C(           7) },
+      {  INT64_C( 5082579430124507209),  INT64_C( 2123257214441286825) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } },
+    { UINT8_C( 76),
+      { -INT32_C(           2), -INT32_C(           3), -INT32_C(          11), -INT32_C(          14) },
+      { -INT64_C( 5919701337935038716), -INT64_C( 7131479819208064406) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } },
+    { UINT8_C( 32),
+      {  INT32_C(          15), -INT32_C(           1),  INT32_C(          11),  INT32_C(           4) },
+      {  INT64_C( 8168227475286370302),  INT64_C( 2581036275060021041) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    int64_t r[32];
+
+    simde_memcpy(r, test_scatter_i64, sizeof(r));
+    simde_mm_mask_i32scatter_epi64(&(r[16]), test_vec[i].k, vindex, a, 8);
+    simde_assert_equal_vi64(32, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_i32scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t vindex[4];
+    const simde_float64 a[2];
+    const simde_float64 r[32];
+  } test_vec[] = {
+    { { -INT32_C(           1), -INT32_C(          15),  INT32_C(           1),  INT32_C(           4) },
+      { SIMDE_FLOAT64_C(   213.30), SIMDE_FLOAT64_C(  -575.30) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -575.30), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   213.30),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } },
+    { {  INT32_C(           0), -INT32_C(          12), -INT32_C(           8), -INT32_C(          11) },
+      { SIMDE_FLOAT64_C(    95.12), SIMDE_FLOAT64_C(   613.76) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   613.76), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(    95.12), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } },
+    { {  INT32_C(          15), -INT32_C(          15),  INT32_C(          14),  INT32_C(          13) },
+      { SIMDE_FLOAT64_C(   596.44), SIMDE_FLOAT64_C(    75.00) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(    75.00), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(   596.44) } },
+    { { -INT32_C(          10),  INT32_C(          12),  INT32_C(           0), -INT32_C(          15) },
+      { SIMDE_FLOAT64_C(   829.34), SIMDE_FLOAT64_C(   971.77) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   829.34), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(   971.77), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde_float64 r[32];
+
+    simde_memcpy(r, test_scatter_f64, sizeof(r));
+    simde_mm_i32scatter_pd(&(r[16]), vindex, a, 8);
+    simde_assert_equal_vf64(32, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_i32scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t vindex[4];
+    const simde_float64 a[2];
+    const simde_float64 r[32];
+  } test_vec[] = {
+    { UINT8_C(  3),
+      { -INT32_C(           1), -INT32_C(          12), -INT32_C(           8),  INT32_C(           6) },
+      { SIMDE_FLOAT64_C(   942.79), SIMDE_FLOAT64_C(    23.77) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(    23.77), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   942.79),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } },
+    { UINT8_C(190),
+      {  INT32_C(          13),  INT32_C(           6),  INT32_C(          11), -INT32_C(          13) },
+      { SIMDE_FLOAT64_C(   892.71), SIMDE_FLOAT64_C(   460.35) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   460.35), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } },
+    { UINT8_C(215),
+      { -INT32_C(           8), -INT32_C(           7),  INT32_C(           9), -INT32_C(           4) },
+      { SIMDE_FLOAT64_C(   666.86), SIMDE_FLOAT64_C(  -566.27) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   666.86), SIMDE_FLOAT64_C(  -566.27), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } },
+    { UINT8_C( 72),
+      { -INT32_C(          11), -INT32_C(           7), -INT32_C(          13), -INT32_C(           2) },
+      { SIMDE_FLOAT64_C(  -352.96), SIMDE_FLOAT64_C(    -5.85) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde_float64 r[32];
+
+    simde_memcpy(r, test_scatter_f64, sizeof(r));
+    simde_mm_mask_i32scatter_pd(&(r[16]), test_vec[i].k, vindex, a, 8);
+    simde_assert_equal_vf64(32, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_i32scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t vindex[4];
+    const simde_float32 a[4];
+    const simde_float32 r[32];
+  } test_vec[] = {
+    { { -INT32_C(          13), -INT32_C(           8),  INT32_C(           7),  INT32_C(           1) },
+      { SIMDE_FLOAT32_C(   139.36), SIMDE_FLOAT32_C(   310.06), SIMDE_FLOAT32_C(    80.87), SIMDE_FLOAT32_C(    85.10) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(   139.36),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   310.06), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(    85.10), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(    80.87),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { { -INT32_C(           1),  INT32_C(           8),  INT32_C(          11), -INT32_C(          16) },
+      { SIMDE_FLOAT32_C(  -926.24), SIMDE_FLOAT32_C(  -163.30), SIMDE_FLOAT32_C(    31.71), SIMDE_FLOAT32_C(   440.70) },
+      { SIMDE_FLOAT32_C(   440.70), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -926.24),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -367.96),
+        SIMDE_FLOAT32_C(  -163.30), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(    31.71),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { { -INT32_C(           8), -INT32_C(          15),  INT32_C(          10),  INT32_C(           2) },
+      { SIMDE_FLOAT32_C(   494.77), SIMDE_FLOAT32_C(  -646.71), SIMDE_FLOAT32_C(  -701.95), SIMDE_FLOAT32_C(   851.68) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -646.71), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   494.77), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   851.68), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -367.96),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -701.95), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { {  INT32_C(           2),  INT32_C(          10), -INT32_C(          10),  INT32_C(           7) },
+      { SIMDE_FLOAT32_C(   279.50), SIMDE_FLOAT32_C(   219.45), SIMDE_FLOAT32_C(   442.97), SIMDE_FLOAT32_C(  -824.14) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   442.97), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   279.50), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -824.14),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(   219.45), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde_float32 r[32];
+
+    simde_memcpy(r, test_scatter_f32, sizeof(r));
+    simde_mm_i32scatter_ps(&(r[16]), vindex, a, 4);
+    simde_assert_equal_vf32(32, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_i32scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t vindex[4];
+    const simde_float32 a[4];
+    const simde_float32 r[32];
+  } test_vec[] = {
+    { UINT8_C( 15),
+      {  INT32_C(          10), -INT32_C(          10), -INT32_C(           1),  INT32_C(           9) },
+      { SIMDE_FLOAT32_C(   954.10), SIMDE_FLOAT32_C(   169.63), SIMDE_FLOAT32_C(    11.34), SIMDE_FLOAT32_C(   318.85) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   169.63), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(    11.34),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -367.96),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   318.85), SIMDE_FLOAT32_C(   954.10), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { UINT8_C(211),
+      {  INT32_C(           0), -INT32_C(           7), -INT32_C(          12),  INT32_C(           9) },
+      { SIMDE_FLOAT32_C(   564.90), SIMDE_FLOAT32_C(   589.87), SIMDE_FLOAT32_C(   384.71), SIMDE_FLOAT32_C(   762.93) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(   589.87), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(   564.90), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -367.96),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { UINT8_C(173),
+      { -INT32_C(           7),  INT32_C(          15), -INT32_C(           7), -INT32_C(           8) },
+      { SIMDE_FLOAT32_C(  -795.14), SIMDE_FLOAT32_C(   474.38), SIMDE_FLOAT32_C(  -703.42), SIMDE_FLOAT32_C(  -735.56) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(  -735.56), SIMDE_FLOAT32_C(  -703.42), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -367.96),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { UINT8_C(103),
+      {  INT32_C(           2), -INT32_C(          15),  INT32_C(          14), -INT32_C(          14) },
+      { SIMDE_FLOAT32_C(  -503.59), SIMDE_FLOAT32_C(  -668.63), SIMDE_FLOAT32_C(    98.04), SIMDE_FLOAT32_C(   895.01) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -668.63), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(  -503.59), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -367.96),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(    98.04), SIMDE_FLOAT32_C(   112.55) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde_float32 r[32];
+
+    simde_memcpy(r, test_scatter_f32, sizeof(r));
+    simde_mm_mask_i32scatter_ps(&(r[16]), test_vec[i].k, vindex, a, 4);
+    simde_assert_equal_vf32(32, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_i64scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t vindex[2];
+    const int32_t a[4];
+    const int32_t r[32];
+  } test_vec[] = {
+    { { -INT64_C(                   4),  INT64_C(                   1) },
+      {  INT32_C(   104916316),  INT32_C(  1475523478), -INT32_C(  1553894543),  INT32_C(   498814423) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(   310840079), -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(   104916316), -INT32_C(  1249725146), -INT32_C(  1351075380),  INT32_C(  1987001023),
+        -INT32_C(  1039226102),  INT32_C(  1475523478),  INT32_C(  1912893877),  INT32_C(  2112271382),  INT32_C(   969850110), -INT32_C(  1853628921),  INT32_C(  1029814395),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } },
+    { { -INT64_C(                  14),  INT64_C(                   6) },
+      {  INT32_C(  1907912448),  INT32_C(  1998381022), -INT32_C(  1828924959),  INT32_C(   248868866) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1907912448), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(   310840079), -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1128593813), -INT32_C(  1249725146), -INT32_C(  1351075380),  INT32_C(  1987001023),
+        -INT32_C(  1039226102), -INT32_C(  1594280740),  INT32_C(  1912893877),  INT32_C(  2112271382),  INT32_C(   969850110), -INT32_C(  1853628921),  INT32_C(  1998381022),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } },
+    { { -INT64_C(                  11), -INT64_C(                  10) },
+      { -INT32_C(  1276454290), -INT32_C(   238922662), -INT32_C(  2065987982),  INT32_C(  1510075902) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1276454290), -INT32_C(   238922662),  INT32_C(  1345360237),
+         INT32_C(   310840079), -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1128593813), -INT32_C(  1249725146), -INT32_C(  1351075380),  INT32_C(  1987001023),
+        -INT32_C(  1039226102), -INT32_C(  1594280740),  INT32_C(  1912893877),  INT32_C(  2112271382),  INT32_C(   969850110), -INT32_C(  1853628921),  INT32_C(  1029814395),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } },
+    { { -INT64_C(                   9),  INT64_C(                  13) },
+      { -INT32_C(  2038914678), -INT32_C(  1006669239), -INT32_C(  1774764307), -INT32_C(   693548080) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344), -INT32_C(  2038914678),
+         INT32_C(   310840079), -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1128593813), -INT32_C(  1249725146), -INT32_C(  1351075380),  INT32_C(  1987001023),
+        -INT32_C(  1039226102), -INT32_C(  1594280740),  INT32_C(  1912893877),  INT32_C(  2112271382),  INT32_C(   969850110), -INT32_C(  1853628921),  INT32_C(  1029814395),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(  1006669239),  INT32_C(  1338992413),  INT32_C(  1867292307) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i vindex = simde_x_mm_loadu_epi64(test_vec[i].vindex);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    int32_t r[32];
+
+    simde_memcpy(r, test_scatter_i32, sizeof(r));
+    simde_mm_i64scatter_epi32(&(r[16]), vindex, a, 4);
+    simde_assert_equal_vi32(32, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_i64scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[2];
+    const int32_t a[4];
+    const int32_t r[32];
+  } test_vec[] = {
+    { UINT8_C(  3),
+      {  INT64_C(                   3), -INT64_C(                   3) },
+      {  INT32_C(  1732230955), -INT32_C(  1429116267),  INT32_C(  1519176960),  INT32_C(   966694042) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(   310840079), -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1128593813), -INT32_C(  1429116267), -INT32_C(  1351075380),  INT32_C(  1987001023),
+        -INT32_C(  1039226102), -INT32_C(  1594280740),  INT32_C(  1912893877),  INT32_C(  1732230955),  INT32_C(   969850110), -INT32_C(  1853628921),  INT32_C(  1029814395),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } },
+    { UINT8_C( 29),
+      { -INT64_C(                   4), -INT64_C(                   8) },
+      {  INT32_C(   133154183),  INT32_C(    20552652),  INT32_C(  1305648123), -INT32_C(   595025908) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(   310840079), -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(   133154183), -INT32_C(  1249725146), -INT32_C(  1351075380),  INT32_C(  1987001023),
+        -INT32_C(  1039226102), -INT32_C(  1594280740),  INT32_C(  1912893877),  INT32_C(  2112271382),  INT32_C(   969850110), -INT32_C(  1853628921),  INT32_C(  1029814395),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } },
+    { UINT8_C(106),
+      { -INT64_C(                   2),  INT64_C(                   4) },
+      {  INT32_C(  1791324292), -INT32_C(   812229787),  INT32_C(   534056595),  INT32_C(   904355918) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(   310840079), -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1128593813), -INT32_C(  1249725146), -INT32_C(  1351075380),  INT32_C(  1987001023),
+        -INT32_C(  1039226102), -INT32_C(  1594280740),  INT32_C(  1912893877),  INT32_C(  2112271382), -INT32_C(   812229787), -INT32_C(  1853628921),  INT32_C(  1029814395),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } },
+    { UINT8_C(140),
+      { -INT64_C(                  16), -INT64_C(                   7) },
+      {  INT32_C(  1427698131),  INT32_C(  1414845680),  INT32_C(  1743077721), -INT32_C(  1956119141) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(   310840079), -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1128593813), -INT32_C(  1249725146), -INT32_C(  1351075380),  INT32_C(  1987001023),
+        -INT32_C(  1039226102), -INT32_C(  1594280740),  INT32_C(  1912893877),  INT32_C(  2112271382),  INT32_C(   969850110), -INT32_C(  1853628921),  INT32_C(  1029814395),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i vindex = simde_x_mm_loadu_epi64(test_vec[i].vindex);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    int32_t r[32];
+
+    simde_memcpy(r, test_scatter_i32, sizeof(r));
+    simde_mm_mask_i64scatter_epi32(&(r[16]), test_vec[i].k, vindex, a, 4);
+    simde_assert_equal_vi32(32, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_i64scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t vindex[2];
+    const int64_t a[2];
+    const int64_t r[32];
+  } test_vec[] = {
+    { {  INT64_C(                   2),  INT64_C(                  15) },
+      {  INT64_C( 4215289468181201134), -INT64_C( 2223098397081862417) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636),  INT64_C( 4215289468181201134), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 2223098397081862417) } },
+    { { -INT64_C(                   9),  INT64_C(                   0) },
+      { -INT64_C( 8936364744591984163), -INT64_C( 4838109401120086802) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023), -INT64_C( 8936364744591984163),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+        -INT64_C( 4838109401120086802),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } },
+    { {  INT64_C(                   3),  INT64_C(                  13) },
+      {  INT64_C( 4842539246143913065), -INT64_C( 2607354390382046895) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427),  INT64_C( 4842539246143913065),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 2607354390382046895),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } },
+    { { -INT64_C(                   8),  INT64_C(                   4) },
+      { -INT64_C(  221528400291942928),  INT64_C( 6269652162815635883) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+        -INT64_C(  221528400291942928), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+         INT64_C( 6269652162815635883),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i vindex = simde_x_mm_loadu_epi64(test_vec[i].vindex);
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    int64_t r[32];
+
+    simde_memcpy(r, test_scatter_i64, sizeof(r));
+    simde_mm_i64scatter_epi64(&(r[16]), vindex, a, 8);
+    simde_assert_equal_vi64(32, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_i64scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[2];
+    const int64_t a[2];
+    const int64_t r[32];
+  } test_vec[] = {
+    { UINT8_C(  3),
+      {  INT64_C(                   1), -INT64_C(                   6) },
+      { -INT64_C( 8346344822194231066), -INT64_C( 8380689430557379785) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 8380689430557379785), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694), -INT64_C( 8346344822194231066), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } },
+    { UINT8_C(137),
+      { -INT64_C(                   3),  INT64_C(                  15) },
+      {  INT64_C( 1219282472661015884), -INT64_C( 9075475947894034954) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925),  INT64_C( 1219282472661015884), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } },
+    { UINT8_C( 70),
+      {  INT64_C(                   4),  INT64_C(                  11) },
+      {  INT64_C( 1595450545601680276), -INT64_C( 1312907818388659277) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789), -INT64_C( 1312907818388659277),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } },
+    { UINT8_C(117),
+      {  INT64_C(                  11), -INT64_C(                   7) },
+      {  INT64_C( 2708564362584691185), -INT64_C( 6084094672281762670) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 2708564362584691185),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i vindex = simde_x_mm_loadu_epi64(test_vec[i].vindex);
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    int64_t r[32];
+
+    simde_memcpy(r, test_scatter_i64, sizeof(r));
+    simde_mm_mask_i64scatter_epi64(&(r[16]), test_vec[i].k, vindex, a, 8);
+    simde_assert_equal_vi64(32, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_i64scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t vindex[2];
+    const simde_float64 a[2];
+    const simde_float64 r[32];
+  } test_vec[] = {
+    { { -INT64_C(                  13),  INT64_C(                   3) },
+      { SIMDE_FLOAT64_C(  -928.36), SIMDE_FLOAT64_C(   910.22) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -928.36),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   910.22),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } },
+    { {  INT64_C(                   3),  INT64_C(                  15) },
+      { SIMDE_FLOAT64_C(   548.99), SIMDE_FLOAT64_C(  -725.66) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   548.99),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -725.66) } },
+    { {  INT64_C(                  14), -INT64_C(                   6) },
+      { SIMDE_FLOAT64_C(   146.38), SIMDE_FLOAT64_C(  -531.28) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(  -531.28), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(   146.38), SIMDE_FLOAT64_C(  -550.50) } },
+    { {  INT64_C(                   5),  INT64_C(                  10) },
+      { SIMDE_FLOAT64_C(  -609.13), SIMDE_FLOAT64_C(  -858.75) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -609.13), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -858.75), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i vindex = simde_x_mm_loadu_epi64(test_vec[i].vindex);
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde_float64 r[32];
+
+    simde_memcpy(r, test_scatter_f64, sizeof(r));
+    simde_mm_i64scatter_pd(&(r[16]), vindex, a, 8);
+    simde_assert_equal_vf64(32, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_i64scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[2];
+    const simde_float64 a[2];
+    const simde_float64 r[32];
+  } test_vec[] = {
+    { UINT8_C(  3),
+      { -INT64_C(                   7), -INT64_C(                   6) },
+      { SIMDE_FLOAT64_C(   323.82), SIMDE_FLOAT64_C(   421.37) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   323.82), SIMDE_FLOAT64_C(   421.37), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } },
+    { UINT8_C(111),
+      {  INT64_C(                   1), -INT64_C(                  10) },
+      { SIMDE_FLOAT64_C(   720.21), SIMDE_FLOAT64_C(   834.55) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   834.55), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(   720.21), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } },
+    { UINT8_C( 73),
+      { -INT64_C(                   2), -INT64_C(                  15) },
+      { SIMDE_FLOAT64_C(  -577.85), SIMDE_FLOAT64_C(   661.88) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(  -577.85), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } },
+    { UINT8_C(153),
+      { -INT64_C(                   8),  INT64_C(                  11) },
+      { SIMDE_FLOAT64_C(   613.28), SIMDE_FLOAT64_C(  -883.41) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   613.28), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i vindex = simde_x_mm_loadu_epi64(test_vec[i].vindex);
+    simde__m128d a = simde_mm_loadu_pd(test_vec[i].a);
+    simde_float64 r[32];
+
+    simde_memcpy(r, test_scatter_f64, sizeof(r));
+    simde_mm_mask_i64scatter_pd(&(r[16]), test_vec[i].k, vindex, a, 8);
+    simde_assert_equal_vf64(32, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_i64scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t vindex[2];
+    const simde_float32 a[4];
+    const simde_float32 r[32];
+  } test_vec[] = {
+    { { -INT64_C(                   3), -INT64_C(                   4) },
+      { SIMDE_FLOAT32_C(  -483.99), SIMDE_FLOAT32_C(   185.54), SIMDE_FLOAT32_C(  -498.17), SIMDE_FLOAT32_C(   546.62) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   185.54), SIMDE_FLOAT32_C(  -483.99), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -367.96),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { { -INT64_C(                  10), -INT64_C(                   6) },
+      { SIMDE_FLOAT32_C(  -803.15), SIMDE_FLOAT32_C(   285.40), SIMDE_FLOAT32_C(    94.82), SIMDE_FLOAT32_C(  -943.32) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(  -803.15), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(   285.40), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -367.96),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { { -INT64_C(                   3), -INT64_C(                  16) },
+      { SIMDE_FLOAT32_C(  -368.23), SIMDE_FLOAT32_C(  -303.85), SIMDE_FLOAT32_C(   926.79), SIMDE_FLOAT32_C(   225.50) },
+      { SIMDE_FLOAT32_C(  -303.85), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -368.23), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -367.96),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { { -INT64_C(                   8),  INT64_C(                   9) },
+      { SIMDE_FLOAT32_C(   454.94), SIMDE_FLOAT32_C(   451.67), SIMDE_FLOAT32_C(   380.86), SIMDE_FLOAT32_C(    -8.43) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   454.94), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -367.96),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   451.67), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i vindex = simde_x_mm_loadu_epi64(test_vec[i].vindex);
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde_float32 r[32];
+
+    simde_memcpy(r, test_scatter_f32, sizeof(r));
+    simde_mm_i64scatter_ps(&(r[16]), vindex, a, 4);
+    simde_assert_equal_vf32(32, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_i64scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[2];
+    const simde_float32 a[4];
+    const simde_float32 r[32];
+  } test_vec[] = {
+    { UINT8_C(  3),
+      { -INT64_C(                   6), -INT64_C(                  15) },
+      { SIMDE_FLOAT32_C(  -945.46), SIMDE_FLOAT32_C(  -536.49), SIMDE_FLOAT32_C(   798.58), SIMDE_FLOAT32_C(   540.56) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -536.49), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -945.46), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -367.96),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { UINT8_C( 78),
+      { -INT64_C(                   3),  INT64_C(                  13) },
+      { SIMDE_FLOAT32_C(   711.52), SIMDE_FLOAT32_C(   438.97), SIMDE_FLOAT32_C(  -682.66), SIMDE_FLOAT32_C(   909.98) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -367.96),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(   438.97), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { UINT8_C( 49),
+      { -INT64_C(                   2), -INT64_C(                   5) },
+      { SIMDE_FLOAT32_C(  -344.05), SIMDE_FLOAT32_C(   945.20), SIMDE_FLOAT32_C(  -388.46), SIMDE_FLOAT32_C(   135.27) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(  -344.05), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -367.96),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { UINT8_C(176),
+      { -INT64_C(                   9),  INT64_C(                  11) },
+      { SIMDE_FLOAT32_C(  -413.03), SIMDE_FLOAT32_C(   985.04), SIMDE_FLOAT32_C(  -933.59), SIMDE_FLOAT32_C(   751.95) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -367.96),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i vindex = simde_x_mm_loadu_epi64(test_vec[i].vindex);
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde_float32 r[32];
+
+    simde_memcpy(r, test_scatter_f32, sizeof(r));
+    simde_mm_mask_i64scatter_ps(&(r[16]), test_vec[i].k, vindex, a, 4);
+    simde_assert_equal_vf32(32, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_i32scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t vindex[8];
+    const int32_t a[8];
+    const int32_t r[32];
+  } test_vec[] = {
+    { {  INT32_C(           5), -INT32_C(           4), -INT32_C(           3), -INT32_C(           4),  INT32_C(           5),  INT32_C(           7),  INT32_C(           6), -INT32_C(           3) },
+      { -INT32_C(  2090691662),  INT32_C(  2023553557), -INT32_C(  1353455967), -INT32_C(   394737364),  INT32_C(   432272318), -INT32_C(   557229095),  INT32_C(   100998958),  INT32_C(   160112272) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(   310840079), -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(  1850267257), -INT32_C(   394737364),  INT32_C(   160112272), -INT32_C(  1351075380),  INT32_C(  1987001023),
+        -INT32_C(  1039226102), -INT32_C(  1594280740),  INT32_C(  1912893877),  INT32_C(  2112271382),  INT32_C(   969850110),  INT32_C(   432272318),  INT32_C(   100998958), -INT32_C(   557229095),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } },
+    { { -INT32_C(           3),  INT32_C(           3),  INT32_C(           3), -INT32_C(           1), -INT32_C(           6), -INT32_C(           6), -INT32_C(           5), -INT32_C(           3) },
+      { -INT32_C(  1472573106),  INT32_C(   420460140),  INT32_C(   270381568),  INT32_C(  2111375716),  INT32_C(   144728694), -INT32_C(  1232896206), -INT32_C(  1404046004), -INT32_C(  1257260634) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(   310840079), -INT32_C(   911005991), -INT32_C(  1232896206), -INT32_C(  1404046004),  INT32_C(  1128593813), -INT32_C(  1257260634), -INT32_C(  1351075380),  INT32_C(  2111375716),
+        -INT32_C(  1039226102), -INT32_C(  1594280740),  INT32_C(  1912893877),  INT32_C(   270381568),  INT32_C(   969850110), -INT32_C(  1853628921),  INT32_C(  1029814395),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } },
+    { {  INT32_C(           1),  INT32_C(           6), -INT32_C(           3),  INT32_C(           1),  INT32_C(           3), -INT32_C(           8), -INT32_C(           8),  INT32_C(           6) },
+      {  INT32_C(   211327110), -INT32_C(  1378269129),  INT32_C(   353900391),  INT32_C(  1053367945), -INT32_C(   188084492), -INT32_C(  1884510231),  INT32_C(  2125145318), -INT32_C(  1403155665) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(  2125145318), -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1128593813),  INT32_C(   353900391), -INT32_C(  1351075380),  INT32_C(  1987001023),
+        -INT32_C(  1039226102),  INT32_C(  1053367945),  INT32_C(  1912893877), -INT32_C(   188084492),  INT32_C(   969850110), -INT32_C(  1853628921), -INT32_C(  1403155665),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } },
+    { {  INT32_C(           3), -INT32_C(           4),  INT32_C(           1), -INT32_C(           5), -INT32_C(           8),  INT32_C(           1), -INT32_C(           6),  INT32_C(           0) },
+      {  INT32_C(   941282593), -INT32_C(  1376941877),  INT32_C(   251199770),  INT32_C(  1303901592),  INT32_C(  1451555955),  INT32_C(   906922315),  INT32_C(  1742448281), -INT32_C(  1845061740) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(  1451555955), -INT32_C(   911005991),  INT32_C(  1742448281),  INT32_C(  1303901592), -INT32_C(  1376941877), -INT32_C(  1249725146), -INT32_C(  1351075380),  INT32_C(  1987001023),
+        -INT32_C(  1845061740),  INT32_C(   906922315),  INT32_C(  1912893877),  INT32_C(   941282593),  INT32_C(   969850110), -INT32_C(  1853628921),  INT32_C(  1029814395),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i vindex = simde_x_mm256_loadu_epi32(test_vec[i].vindex);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    int32_t r[32];
+
+    simde_memcpy(r, test_scatter_i32, sizeof(r));
+    simde_mm256_i32scatter_epi32(&(r[16]), vindex, a, 4);
+    simde_assert_equal_vi32(32, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_i32scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t vindex[8];
+    const int32_t a[8];
+    const int32_t r[32];
+  } test_vec[] = {
+    { UINT8_C(255),
+      {  INT32_C(           3), -INT32_C(           8), -INT32_C(           5), -INT32_C(           6),  INT32_C(           4), -INT32_C(           7), -INT32_C(           2), -INT32_C(           5) },
+      { -INT32_C(   842734242), -INT32_C(   773457132),  INT32_C(  1201567202),  INT32_C(   690123145),  INT32_C(  2106160938),  INT32_C(   256044868), -INT32_C(  1690616934), -INT32_C(   647304339) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+        -INT32_C(   773457132),  INT32_C(   256044868),  INT32_C(   690123145), -INT32_C(   647304339),  INT32_C(  1128593813), -INT32_C(  1249725146), -INT32_C(  1690616934),  INT32_C(  1987001023),
+        -INT32_C(  1039226102), -INT32_C(  1594280740),  INT32_C(  1912893877), -INT32_C(   842734242),  INT32_C(  2106160938), -INT32_C(  1853628921),  INT32_C(  1029814395),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } },
+    { UINT8_C(226),
+      {  INT32_C(           5),  INT32_C(           6), -INT32_C(           6),  INT32_C(           2),  INT32_C(           3), -INT32_C(           3),  INT32_C(           1), -INT32_C(           1) },
+      {  INT32_C(   175002997), -INT32_C(  1904249697), -INT32_C(   448705098), -INT32_C(  1439407443), -INT32_C(   662896344), -INT32_C(  1761824470), -INT32_C(   414694712), -INT32_C(  1806344115) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(   310840079), -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1128593813), -INT32_C(  1761824470), -INT32_C(  1351075380), -INT32_C(  1806344115),
+        -INT32_C(  1039226102), -INT32_C(   414694712),  INT32_C(  1912893877),  INT32_C(  2112271382),  INT32_C(   969850110), -INT32_C(  1853628921), -INT32_C(  1904249697),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } },
+    { UINT8_C(109),
+      {  INT32_C(           5), -INT32_C(           4), -INT32_C(           8), -INT32_C(           1), -INT32_C(           1), -INT32_C(           2),  INT32_C(           1), -INT32_C(           8) },
+      {  INT32_C(  1743640127), -INT32_C(  1875484077), -INT32_C(    26543529), -INT32_C(  1633396125),  INT32_C(   334359063), -INT32_C(  1712040957),  INT32_C(   830790763),  INT32_C(  1065070355) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+        -INT32_C(    26543529), -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1128593813), -INT32_C(  1249725146), -INT32_C(  1712040957), -INT32_C(  1633396125),
+        -INT32_C(  1039226102),  INT32_C(   830790763),  INT32_C(  1912893877),  INT32_C(  2112271382),  INT32_C(   969850110),  INT32_C(  1743640127),  INT32_C(  1029814395),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } },
+    { UINT8_C( 86),
+      { -INT32_C(           4), -INT32_C(           3), -INT32_C(           6),  INT32_C(           6), -INT32_C(           5),  INT32_C(           3),  INT32_C(           2), -INT32_C(           4) },
+      { -INT32_C(   566444376),  INT32_C(   214986197), -INT32_C(  1376511922),  INT32_C(   962339838), -INT32_C(  1809079239), -INT32_C(    82846415),  INT32_C(   423538379), -INT32_C(  1747844778) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(   310840079), -INT32_C(   911005991), -INT32_C(  1376511922), -INT32_C(  1809079239),  INT32_C(  1128593813),  INT32_C(   214986197), -INT32_C(  1351075380),  INT32_C(  1987001023),
+        -INT32_C(  1039226102), -INT32_C(  1594280740),  INT32_C(   423538379),  INT32_C(  2112271382),  INT32_C(   969850110), -INT32_C(  1853628921),  INT32_C(  1029814395),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i vindex = simde_x_mm256_loadu_epi32(test_vec[i].vindex);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    int32_t r[32];
+
+    simde_memcpy(r, test_scatter_i32, sizeof(r));
+    simde_mm256_mask_i32scatter_epi32(&(r[16]), test_vec[i].k, vindex, a, 4);
+    simde_assert_equal_vi32(32, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_i32scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t vindex[4];
+    const int64_t a[4];
+    const int64_t r[32];
+  } test_vec[] = {
+    { { -INT32_C(           2),  INT32_C(           4),  INT32_C(          10), -INT32_C(          16) },
+      {  INT64_C( 5883785682268475354), -INT64_C(  271425937939451451), -INT64_C( 3598569903587133978),  INT64_C( 2030223165651141005) },
+      {  INT64_C( 2030223165651141005),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781),  INT64_C( 5883785682268475354),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C(  271425937939451451),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330), -INT64_C( 3598569903587133978),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } },
+    { { -INT32_C(          10),  INT32_C(           2), -INT32_C(          15),  INT32_C(          12) },
+      {  INT64_C( 4735400312767082984),  INT64_C( 7638568287453415691),  INT64_C( 2212878748060276953),  INT64_C( 8936628754997020456) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 2212878748060276953), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 4735400312767082984),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636),  INT64_C( 7638568287453415691), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 8936628754997020456), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } },
+    { { -INT32_C(           2),  INT32_C(           7), -INT32_C(          16),  INT32_C(           6) },
+      { -INT64_C( 7619539369835778234), -INT64_C( 1734942258920221288),  INT64_C( 9007286028035231155),  INT64_C( 4880832179085689704) },
+      {  INT64_C( 9007286028035231155),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 7619539369835778234),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602),  INT64_C( 4880832179085689704), -INT64_C( 1734942258920221288),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } },
+    { { -INT32_C(           4), -INT32_C(           1),  INT32_C(           5), -INT32_C(          12) },
+      {  INT64_C( 1046261947579552156), -INT64_C( 1711019733830348993),  INT64_C( 8709222337971443553),  INT64_C( 8840501801520329103) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 8840501801520329103), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 1046261947579552156), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326), -INT64_C( 1711019733830348993),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713),  INT64_C( 8709222337971443553), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    int64_t r[32];
+
+    simde_memcpy(r, test_scatter_i64, sizeof(r));
+    simde_mm256_i32scatter_epi64(&(r[16]), vindex, a, 8);
+    simde_assert_equal_vi64(32, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_i32scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t vindex[4];
+    const int64_t a[4];
+    const int64_t r[32];
+  } test_vec[] = {
+    { UINT8_C( 15),
+      { -INT32_C(          11),  INT32_C(           0),  INT32_C(          13),  INT32_C(           0) },
+      { -INT64_C( 1620907534956553279),  INT64_C( 4689663272772802998), -INT64_C( 2547443084545190139),  INT64_C( 1723732303262492523) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C( 1620907534956553279),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C( 1723732303262492523),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 2547443084545190139),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } },
+    { UINT8_C(156),
+      {  INT32_C(          11),  INT32_C(          11), -INT32_C(          11),  INT32_C(           3) },
+      {  INT64_C( 7173632938508676555),  INT64_C( 6747269144039279824),  INT64_C( 2326921803246447689),  INT64_C( 6662332475143923025) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071),  INT64_C( 2326921803246447689),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427),  INT64_C( 6662332475143923025),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } },
+    { UINT8_C(236),
+      {  INT32_C(          13),  INT32_C(           7), -INT32_C(          16),  INT32_C(           0) },
+      {  INT64_C( 6759473514728806857), -INT64_C( 5149292129747652806),  INT64_C(  855292189644356580), -INT64_C( 8205503725288859885) },
+      {  INT64_C(  855292189644356580),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+        -INT64_C( 8205503725288859885),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } },
+    { UINT8_C(197),
+      {  INT32_C(          13), -INT32_C(           8),  INT32_C(           6), -INT32_C(          10) },
+      {  INT64_C( 7282769312140545684), -INT64_C( 8324875058950608375),  INT64_C( 3389800288167899805), -INT64_C( 5839446405320854856) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602),  INT64_C( 3389800288167899805), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957),  INT64_C( 7282769312140545684),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    int64_t r[32];
+
+    simde_memcpy(r, test_scatter_i64, sizeof(r));
+    simde_mm256_mask_i32scatter_epi64(&(r[16]), test_vec[i].k, vindex, a, 8);
+    simde_assert_equal_vi64(32, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_i32scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t vindex[4];
+    const simde_float64 a[4];
+    const simde_float64 r[32];
+  } test_vec[] = {
+    { { -INT32_C(          16),  INT32_C(           6),  INT32_C(           1),  INT32_C(           6) },
+      { SIMDE_FLOAT64_C(  -837.49), SIMDE_FLOAT64_C(  -128.43), SIMDE_FLOAT64_C(  -367.32), SIMDE_FLOAT64_C(  -267.56) },
+      { SIMDE_FLOAT64_C(  -837.49), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(  -367.32), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(  -267.56), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } },
+    { { -INT32_C(           6), -INT32_C(           5), -INT32_C(           3), -INT32_C(          12) },
+      { SIMDE_FLOAT64_C(   669.47), SIMDE_FLOAT64_C(  -544.14), SIMDE_FLOAT64_C(   303.84), SIMDE_FLOAT64_C(   787.56) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   787.56), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   669.47), SIMDE_FLOAT64_C(  -544.14),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(   303.84), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } },
+    { { -INT32_C(           1), -INT32_C(           1),  INT32_C(          15),  INT32_C(           0) },
+      { SIMDE_FLOAT64_C(   571.81), SIMDE_FLOAT64_C(  -711.30), SIMDE_FLOAT64_C(  -705.08), SIMDE_FLOAT64_C(  -741.95) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(  -711.30),
+        SIMDE_FLOAT64_C(  -741.95), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -705.08) } },
+    { { -INT32_C(           5),  INT32_C(           6), -INT32_C(          13), -INT32_C(           5) },
+      { SIMDE_FLOAT64_C(  -422.75), SIMDE_FLOAT64_C(  -132.38), SIMDE_FLOAT64_C(   243.52), SIMDE_FLOAT64_C(   657.50) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(   243.52),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   657.50),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(  -132.38), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde_float64 r[32];
+
+    simde_memcpy(r, test_scatter_f64, sizeof(r));
+    simde_mm256_i32scatter_pd(&(r[16]), vindex, a, 8);
+    simde_assert_equal_vf64(32, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_i32scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t vindex[4];
+    const simde_float64 a[4];
+    const simde_float64 r[32];
+  } test_vec[] = {
+    { UINT8_C( 15),
+      {  INT32_C(           5), -INT32_C(          12),  INT32_C(          12),  INT32_C(           6) },
+      { SIMDE_FLOAT64_C(   954.58), SIMDE_FLOAT64_C(  -549.63), SIMDE_FLOAT64_C(  -325.00), SIMDE_FLOAT64_C(  -384.94) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(  -549.63), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(   954.58), SIMDE_FLOAT64_C(  -384.94), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -325.00), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } },
+    { UINT8_C( 36),
+      {  INT32_C(           7), -INT32_C(           8),  INT32_C(           6), -INT32_C(           1) },
+      { SIMDE_FLOAT64_C(   943.54), SIMDE_FLOAT64_C(   -41.58), SIMDE_FLOAT64_C(  -277.51), SIMDE_FLOAT64_C(  -264.37) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(  -277.51), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } },
+    { UINT8_C(234),
+      { -INT32_C(           7), -INT32_C(          10), -INT32_C(          15),  INT32_C(           3) },
+      { SIMDE_FLOAT64_C(  -500.71), SIMDE_FLOAT64_C(  -665.66), SIMDE_FLOAT64_C(   352.62), SIMDE_FLOAT64_C(  -737.64) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(  -665.66), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(  -737.64),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } },
+    { UINT8_C(100),
+      { -INT32_C(           3),  INT32_C(           9), -INT32_C(           6), -INT32_C(           3) },
+      { SIMDE_FLOAT64_C(   933.56), SIMDE_FLOAT64_C(   127.07), SIMDE_FLOAT64_C(   -77.81), SIMDE_FLOAT64_C(   905.32) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   -77.81), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i vindex = simde_x_mm_loadu_epi32(test_vec[i].vindex);
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde_float64 r[32];
+
+    simde_memcpy(r, test_scatter_f64, sizeof(r));
+    simde_mm256_mask_i32scatter_pd(&(r[16]), test_vec[i].k, vindex, a, 8);
+    simde_assert_equal_vf64(32, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_i32scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t vindex[8];
+    const simde_float32 a[8];
+    const simde_float32 r[32];
+  } test_vec[] = {
+    { {  INT32_C(           5),  INT32_C(           4), -INT32_C(           3),  INT32_C(           1),  INT32_C(           5),  INT32_C(           0), -INT32_C(           5),  INT32_C(           5) },
+      { SIMDE_FLOAT32_C(   168.72), SIMDE_FLOAT32_C(  -742.92), SIMDE_FLOAT32_C(   143.81), SIMDE_FLOAT32_C(  -482.69),
+        SIMDE_FLOAT32_C(  -327.70), SIMDE_FLOAT32_C(   708.75), SIMDE_FLOAT32_C(  -598.97), SIMDE_FLOAT32_C(   914.02) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(  -598.97),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(   143.81), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(   708.75), SIMDE_FLOAT32_C(  -482.69), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(  -742.92), SIMDE_FLOAT32_C(   914.02), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -367.96),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { { -INT32_C(           5),  INT32_C(           5), -INT32_C(           5), -INT32_C(           6),  INT32_C(           6), -INT32_C(           6),  INT32_C(           0),  INT32_C(           2) },
+      { SIMDE_FLOAT32_C(  -970.58), SIMDE_FLOAT32_C(  -244.90), SIMDE_FLOAT32_C(   567.32), SIMDE_FLOAT32_C(   -84.73),
+        SIMDE_FLOAT32_C(   862.35), SIMDE_FLOAT32_C(   -53.75), SIMDE_FLOAT32_C(   795.39), SIMDE_FLOAT32_C(  -903.24) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(   -53.75), SIMDE_FLOAT32_C(   567.32),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(   795.39), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(  -903.24), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -244.90), SIMDE_FLOAT32_C(   862.35), SIMDE_FLOAT32_C(  -367.96),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { { -INT32_C(           7),  INT32_C(           5), -INT32_C(           2),  INT32_C(           7),  INT32_C(           1), -INT32_C(           1),  INT32_C(           1),  INT32_C(           4) },
+      { SIMDE_FLOAT32_C(  -564.64), SIMDE_FLOAT32_C(   543.04), SIMDE_FLOAT32_C(  -746.65), SIMDE_FLOAT32_C(  -644.22),
+        SIMDE_FLOAT32_C(   308.03), SIMDE_FLOAT32_C(   930.91), SIMDE_FLOAT32_C(   934.90), SIMDE_FLOAT32_C(  -316.91) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(  -564.64), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(  -746.65), SIMDE_FLOAT32_C(   930.91),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(   934.90), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(  -316.91), SIMDE_FLOAT32_C(   543.04), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -644.22),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { {  INT32_C(           6),  INT32_C(           3), -INT32_C(           5), -INT32_C(           2),  INT32_C(           0), -INT32_C(           6),  INT32_C(           3), -INT32_C(           2) },
+      { SIMDE_FLOAT32_C(  -757.91), SIMDE_FLOAT32_C(   784.70), SIMDE_FLOAT32_C(  -361.00), SIMDE_FLOAT32_C(   854.37),
+        SIMDE_FLOAT32_C(   317.39), SIMDE_FLOAT32_C(  -419.26), SIMDE_FLOAT32_C(  -130.93), SIMDE_FLOAT32_C(  -701.77) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -419.26), SIMDE_FLOAT32_C(  -361.00),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(  -701.77), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(   317.39), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -130.93),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -757.91), SIMDE_FLOAT32_C(  -367.96),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i vindex = simde_x_mm256_loadu_epi32(test_vec[i].vindex);
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde_float32 r[32];
+
+    simde_memcpy(r, test_scatter_f32, sizeof(r));
+    simde_mm256_i32scatter_ps(&(r[16]), vindex, a, 4);
+    simde_assert_equal_vf32(32, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_i32scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t vindex[8];
+    const simde_float32 a[8];
+    const simde_float32 r[32];
+  } test_vec[] = {
+    { UINT8_C(255),
+      {  INT32_C(           5), -INT32_C(           6), -INT32_C(           8), -INT32_C(           1), -INT32_C(           4), -INT32_C(           5), -INT32_C(           3),  INT32_C(           6) },
+      { SIMDE_FLOAT32_C(  -101.34), SIMDE_FLOAT32_C(   445.82), SIMDE_FLOAT32_C(   898.53), SIMDE_FLOAT32_C(  -235.85),
+        SIMDE_FLOAT32_C(  -444.23), SIMDE_FLOAT32_C(   945.81), SIMDE_FLOAT32_C(  -336.61), SIMDE_FLOAT32_C(   627.69) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   898.53), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(   445.82), SIMDE_FLOAT32_C(   945.81),
+        SIMDE_FLOAT32_C(  -444.23), SIMDE_FLOAT32_C(  -336.61), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -235.85),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -101.34), SIMDE_FLOAT32_C(   627.69), SIMDE_FLOAT32_C(  -367.96),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { UINT8_C(169),
+      { -INT32_C(           7),  INT32_C(           5), -INT32_C(           7),  INT32_C(           6), -INT32_C(           8), -INT32_C(           1), -INT32_C(           8), -INT32_C(           4) },
+      { SIMDE_FLOAT32_C(  -280.40), SIMDE_FLOAT32_C(  -112.41), SIMDE_FLOAT32_C(  -414.97), SIMDE_FLOAT32_C(  -632.97),
+        SIMDE_FLOAT32_C(  -300.90), SIMDE_FLOAT32_C(  -466.65), SIMDE_FLOAT32_C(    33.33), SIMDE_FLOAT32_C(   257.93) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(  -280.40), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   257.93), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -466.65),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -632.97), SIMDE_FLOAT32_C(  -367.96),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { UINT8_C( 72),
+      { -INT32_C(           1),  INT32_C(           6),  INT32_C(           5),  INT32_C(           1),  INT32_C(           2), -INT32_C(           7),  INT32_C(           2),  INT32_C(           6) },
+      { SIMDE_FLOAT32_C(  -811.60), SIMDE_FLOAT32_C(  -235.72), SIMDE_FLOAT32_C(   130.61), SIMDE_FLOAT32_C(   389.01),
+        SIMDE_FLOAT32_C(   534.65), SIMDE_FLOAT32_C(  -631.40), SIMDE_FLOAT32_C(   314.16), SIMDE_FLOAT32_C(  -778.57) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(   389.01), SIMDE_FLOAT32_C(   314.16), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -367.96),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { UINT8_C(127),
+      {  INT32_C(           6), -INT32_C(           3),  INT32_C(           1),  INT32_C(           2),  INT32_C(           6), -INT32_C(           1), -INT32_C(           7), -INT32_C(           3) },
+      { SIMDE_FLOAT32_C(   566.01), SIMDE_FLOAT32_C(   769.70), SIMDE_FLOAT32_C(  -873.96), SIMDE_FLOAT32_C(  -166.30),
+        SIMDE_FLOAT32_C(   135.52), SIMDE_FLOAT32_C(  -649.35), SIMDE_FLOAT32_C(  -503.45), SIMDE_FLOAT32_C(   822.95) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(  -503.45), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(   769.70), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -649.35),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(  -873.96), SIMDE_FLOAT32_C(  -166.30), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(   135.52), SIMDE_FLOAT32_C(  -367.96),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i vindex = simde_x_mm256_loadu_epi32(test_vec[i].vindex);
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde_float32 r[32];
+
+    simde_memcpy(r, test_scatter_f32, sizeof(r));
+    simde_mm256_mask_i32scatter_ps(&(r[16]), test_vec[i].k, vindex, a, 4);
+    simde_assert_equal_vf32(32, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_i64scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t vindex[4];
+    const int32_t a[4];
+    const int32_t r[32];
+  } test_vec[] = {
+    { { -INT64_C(                  10),  INT64_C(                   7),  INT64_C(                   8), -INT64_C(                  14) },
+      {  INT32_C(  1156268642),  INT32_C(   741493862),  INT32_C(  1233777022), -INT32_C(  1519289060) },
+      { -INT32_C(   358030361),  INT32_C(   486124512), -INT32_C(  1519289060), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183),  INT32_C(  1156268642),  INT32_C(  1345360237),
+         INT32_C(   310840079), -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1128593813), -INT32_C(  1249725146), -INT32_C(  1351075380),  INT32_C(  1987001023),
+        -INT32_C(  1039226102), -INT32_C(  1594280740),  INT32_C(  1912893877),  INT32_C(  2112271382),  INT32_C(   969850110), -INT32_C(  1853628921),  INT32_C(  1029814395),  INT32_C(   741493862),
+         INT32_C(  1233777022), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } },
+    { {  INT64_C(                  14), -INT64_C(                   8),  INT64_C(                   3), -INT64_C(                   7) },
+      {  INT32_C(   930572759), -INT32_C(  2106518844),  INT32_C(  2125185505),  INT32_C(  1356779042) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+        -INT32_C(  2106518844),  INT32_C(  1356779042), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1128593813), -INT32_C(  1249725146), -INT32_C(  1351075380),  INT32_C(  1987001023),
+        -INT32_C(  1039226102), -INT32_C(  1594280740),  INT32_C(  1912893877),  INT32_C(  2125185505),  INT32_C(   969850110), -INT32_C(  1853628921),  INT32_C(  1029814395),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(   930572759),  INT32_C(  1867292307) } },
+    { {  INT64_C(                  12),  INT64_C(                   5), -INT64_C(                   4),  INT64_C(                   1) },
+      { -INT32_C(  1179462729),  INT32_C(    27507664), -INT32_C(  1887827801), -INT32_C(  1524746890) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(   310840079), -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(  1850267257), -INT32_C(  1887827801), -INT32_C(  1249725146), -INT32_C(  1351075380),  INT32_C(  1987001023),
+        -INT32_C(  1039226102), -INT32_C(  1524746890),  INT32_C(  1912893877),  INT32_C(  2112271382),  INT32_C(   969850110),  INT32_C(    27507664),  INT32_C(  1029814395),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643), -INT32_C(  1179462729), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } },
+    { {  INT64_C(                  15), -INT64_C(                   7), -INT64_C(                   9),  INT64_C(                  13) },
+      { -INT32_C(    40818508),  INT32_C(   855418853), -INT32_C(  1332213782),  INT32_C(  1339002213) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344), -INT32_C(  1332213782),
+         INT32_C(   310840079),  INT32_C(   855418853), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1128593813), -INT32_C(  1249725146), -INT32_C(  1351075380),  INT32_C(  1987001023),
+        -INT32_C(  1039226102), -INT32_C(  1594280740),  INT32_C(  1912893877),  INT32_C(  2112271382),  INT32_C(   969850110), -INT32_C(  1853628921),  INT32_C(  1029814395),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639),  INT32_C(  1339002213),  INT32_C(  1338992413), -INT32_C(    40818508) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i vindex = simde_x_mm256_loadu_epi64(test_vec[i].vindex);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    int32_t r[32];
+
+    simde_memcpy(r, test_scatter_i32, sizeof(r));
+    simde_mm256_i64scatter_epi32(&(r[16]), vindex, a, 4);
+    simde_assert_equal_vi32(32, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_i64scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[4];
+    const int32_t a[4];
+    const int32_t r[32];
+  } test_vec[] = {
+    { UINT8_C( 15),
+      {  INT64_C(                  11), -INT64_C(                  11),  INT64_C(                   8), -INT64_C(                  15) },
+      {  INT32_C(   640531664),  INT32_C(  1405539241), -INT32_C(  1740860338), -INT32_C(   512999706) },
+      { -INT32_C(   358030361), -INT32_C(   512999706),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618),  INT32_C(  1405539241), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(   310840079), -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1128593813), -INT32_C(  1249725146), -INT32_C(  1351075380),  INT32_C(  1987001023),
+        -INT32_C(  1039226102), -INT32_C(  1594280740),  INT32_C(  1912893877),  INT32_C(  2112271382),  INT32_C(   969850110), -INT32_C(  1853628921),  INT32_C(  1029814395),  INT32_C(  1709966795),
+        -INT32_C(  1740860338), -INT32_C(   661573474),  INT32_C(  1333917055),  INT32_C(   640531664),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } },
+    { UINT8_C(178),
+      { -INT64_C(                  14),  INT64_C(                  12), -INT64_C(                   2), -INT64_C(                  10) },
+      { -INT32_C(  1020029719),  INT32_C(   667806080),  INT32_C(   627970643), -INT32_C(  1853605193) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(   310840079), -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1128593813), -INT32_C(  1249725146), -INT32_C(  1351075380),  INT32_C(  1987001023),
+        -INT32_C(  1039226102), -INT32_C(  1594280740),  INT32_C(  1912893877),  INT32_C(  2112271382),  INT32_C(   969850110), -INT32_C(  1853628921),  INT32_C(  1029814395),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(   667806080), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } },
+    { UINT8_C(179),
+      {  INT64_C(                   2), -INT64_C(                  10), -INT64_C(                   5), -INT64_C(                   9) },
+      { -INT32_C(   107192510), -INT32_C(  1503070340), -INT32_C(  1127057006), -INT32_C(  2084177439) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1503070340),  INT32_C(  1345360237),
+         INT32_C(   310840079), -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1128593813), -INT32_C(  1249725146), -INT32_C(  1351075380),  INT32_C(  1987001023),
+        -INT32_C(  1039226102), -INT32_C(  1594280740), -INT32_C(   107192510),  INT32_C(  2112271382),  INT32_C(   969850110), -INT32_C(  1853628921),  INT32_C(  1029814395),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } },
+    { UINT8_C(  6),
+      {  INT64_C(                   0), -INT64_C(                   2),  INT64_C(                   1), -INT64_C(                   8) },
+      {  INT32_C(  1389337598),  INT32_C(   778124105),  INT32_C(  1273236351), -INT32_C(  1840448343) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(   310840079), -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1128593813), -INT32_C(  1249725146),  INT32_C(   778124105),  INT32_C(  1987001023),
+        -INT32_C(  1039226102),  INT32_C(  1273236351),  INT32_C(  1912893877),  INT32_C(  2112271382),  INT32_C(   969850110), -INT32_C(  1853628921),  INT32_C(  1029814395),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i vindex = simde_x_mm256_loadu_epi64(test_vec[i].vindex);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    int32_t r[32];
+
+    simde_memcpy(r, test_scatter_i32, sizeof(r));
+    simde_mm256_mask_i64scatter_epi32(&(r[16]), test_vec[i].k, vindex, a, 4);
+    simde_assert_equal_vi32(32, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_i64scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t vindex[4];
+    const int64_t a[4];
+    const int64_t r[32];
+  } test_vec[] = {
+    { { -INT64_C(                   5),  INT64_C(                  15),  INT64_C(                   7), -INT64_C(                  12) },
+      {  INT64_C( 8151519302432863255),  INT64_C( 4912339313667297727),  INT64_C( 8185023665435736284),  INT64_C( 1768912043304887085) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 1768912043304887085), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421),  INT64_C( 8151519302432863255),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511),  INT64_C( 8185023665435736284),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336),  INT64_C( 4912339313667297727) } },
+    { { -INT64_C(                   5),  INT64_C(                  11),  INT64_C(                   6), -INT64_C(                  16) },
+      { -INT64_C( 1397841876000193050),  INT64_C(  281897856285135853),  INT64_C(  987638444524645130), -INT64_C( 8550591662227555364) },
+      { -INT64_C( 8550591662227555364),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C( 1397841876000193050),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602),  INT64_C(  987638444524645130), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C(  281897856285135853),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } },
+    { {  INT64_C(                  11),  INT64_C(                   5),  INT64_C(                   7), -INT64_C(                   7) },
+      {  INT64_C( 7597210536371251049), -INT64_C(   76873068052931609), -INT64_C(  471580144820498416),  INT64_C( 8896733589396219312) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239),  INT64_C( 8896733589396219312), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713), -INT64_C(   76873068052931609), -INT64_C( 8276905840325447511), -INT64_C(  471580144820498416),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 7597210536371251049),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } },
+    { {  INT64_C(                   6),  INT64_C(                  15),  INT64_C(                  10), -INT64_C(                  12) },
+      { -INT64_C( 4730535877680831498), -INT64_C( 8984680028730494543),  INT64_C( 3892702544028453906),  INT64_C( 6282989443671666186) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6282989443671666186), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 4730535877680831498), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 3892702544028453906),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 8984680028730494543) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i vindex = simde_x_mm256_loadu_epi64(test_vec[i].vindex);
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    int64_t r[32];
+
+    simde_memcpy(r, test_scatter_i64, sizeof(r));
+    simde_mm256_i64scatter_epi64(&(r[16]), vindex, a, 8);
+    simde_assert_equal_vi64(32, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_i64scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[4];
+    const int64_t a[4];
+    const int64_t r[32];
+  } test_vec[] = {
+    { UINT8_C( 15),
+      {  INT64_C(                  14),  INT64_C(                   8), -INT64_C(                   9),  INT64_C(                  13) },
+      { -INT64_C( 5832678969048756028), -INT64_C( 1578464907354813467),  INT64_C( 8092651178010965554),  INT64_C( 2990126931880591454) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 8092651178010965554),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+        -INT64_C( 1578464907354813467), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957),  INT64_C( 2990126931880591454), -INT64_C( 5832678969048756028), -INT64_C( 1871518200547373600) } },
+    { UINT8_C(213),
+      {  INT64_C(                  11),  INT64_C(                   4), -INT64_C(                  11), -INT64_C(                  16) },
+      { -INT64_C( 6505065785728690834), -INT64_C( 4072635907062448444), -INT64_C( 2032353899460453703), -INT64_C( 3009995139423167540) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C( 2032353899460453703),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789), -INT64_C( 6505065785728690834),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } },
+    { UINT8_C(189),
+      { -INT64_C(                   4),  INT64_C(                   4),  INT64_C(                  13),  INT64_C(                  15) },
+      {  INT64_C( 9085799126012275822),  INT64_C(  766200579374710710), -INT64_C( 4241045003047504439), -INT64_C( 3349025935233779870) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 9085799126012275822), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 4241045003047504439),  INT64_C( 3921866937951841336), -INT64_C( 3349025935233779870) } },
+    { UINT8_C( 77),
+      {  INT64_C(                   8), -INT64_C(                  10), -INT64_C(                  16), -INT64_C(                   2) },
+      { -INT64_C( 3021706119476817339),  INT64_C(  768655351619913889), -INT64_C( 8494203623608417040), -INT64_C(  741569094676332295) },
+      { -INT64_C( 8494203623608417040),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C(  741569094676332295),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+        -INT64_C( 3021706119476817339), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i vindex = simde_x_mm256_loadu_epi64(test_vec[i].vindex);
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    int64_t r[32];
+
+    simde_memcpy(r, test_scatter_i64, sizeof(r));
+    simde_mm256_mask_i64scatter_epi64(&(r[16]), test_vec[i].k, vindex, a, 8);
+    simde_assert_equal_vi64(32, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_i64scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t vindex[4];
+    const simde_float64 a[4];
+    const simde_float64 r[32];
+  } test_vec[] = {
+    { {  INT64_C(                   7), -INT64_C(                   3), -INT64_C(                  16),  INT64_C(                   3) },
+      { SIMDE_FLOAT64_C(   -36.98), SIMDE_FLOAT64_C(  -841.84), SIMDE_FLOAT64_C(  -745.21), SIMDE_FLOAT64_C(  -547.38) },
+      { SIMDE_FLOAT64_C(  -745.21), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -841.84), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(  -547.38),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(   -36.98),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } },
+    { { -INT64_C(                   1),  INT64_C(                   3),  INT64_C(                   1), -INT64_C(                   5) },
+      { SIMDE_FLOAT64_C(  -261.99), SIMDE_FLOAT64_C(   536.34), SIMDE_FLOAT64_C(   908.07), SIMDE_FLOAT64_C(   289.30) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   289.30),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(  -261.99),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(   908.07), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   536.34),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } },
+    { {  INT64_C(                   0), -INT64_C(                  14),  INT64_C(                   0), -INT64_C(                   3) },
+      { SIMDE_FLOAT64_C(  -307.54), SIMDE_FLOAT64_C(   597.09), SIMDE_FLOAT64_C(  -932.28), SIMDE_FLOAT64_C(  -723.89) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   597.09), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -723.89), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -932.28), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } },
+    { {  INT64_C(                   9), -INT64_C(                  16),  INT64_C(                  12), -INT64_C(                  10) },
+      { SIMDE_FLOAT64_C(   416.10), SIMDE_FLOAT64_C(    -1.98), SIMDE_FLOAT64_C(   734.47), SIMDE_FLOAT64_C(  -666.63) },
+      { SIMDE_FLOAT64_C(    -1.98), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(  -666.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(   416.10), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(   734.47), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i vindex = simde_x_mm256_loadu_epi64(test_vec[i].vindex);
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde_float64 r[32];
+
+    simde_memcpy(r, test_scatter_f64, sizeof(r));
+    simde_mm256_i64scatter_pd(&(r[16]), vindex, a, 8);
+    simde_assert_equal_vf64(32, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_i64scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[4];
+    const simde_float64 a[4];
+    const simde_float64 r[32];
+  } test_vec[] = {
+    { UINT8_C( 15),
+      {  INT64_C(                   9),  INT64_C(                  12),  INT64_C(                   6),  INT64_C(                  11) },
+      { SIMDE_FLOAT64_C(    60.21), SIMDE_FLOAT64_C(  -378.02), SIMDE_FLOAT64_C(   123.84), SIMDE_FLOAT64_C(   273.17) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   123.84), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(    60.21), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   273.17),
+        SIMDE_FLOAT64_C(  -378.02), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } },
+    { UINT8_C( 38),
+      { -INT64_C(                  11),  INT64_C(                   0), -INT64_C(                  10),  INT64_C(                  13) },
+      { SIMDE_FLOAT64_C(   616.98), SIMDE_FLOAT64_C(  -191.08), SIMDE_FLOAT64_C(  -180.16), SIMDE_FLOAT64_C(   439.41) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(  -180.16), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -191.08), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } },
+    { UINT8_C(117),
+      {  INT64_C(                   6), -INT64_C(                  16),  INT64_C(                  12), -INT64_C(                   8) },
+      { SIMDE_FLOAT64_C(    99.65), SIMDE_FLOAT64_C(  -254.38), SIMDE_FLOAT64_C(  -833.57), SIMDE_FLOAT64_C(   -75.31) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(    99.65), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -833.57), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } },
+    { UINT8_C( 62),
+      {  INT64_C(                  13),  INT64_C(                   6),  INT64_C(                  10), -INT64_C(                   4) },
+      { SIMDE_FLOAT64_C(  -488.74), SIMDE_FLOAT64_C(  -835.95), SIMDE_FLOAT64_C(  -782.41), SIMDE_FLOAT64_C(   377.35) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(   377.35), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(  -835.95), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -782.41), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i vindex = simde_x_mm256_loadu_epi64(test_vec[i].vindex);
+    simde__m256d a = simde_mm256_loadu_pd(test_vec[i].a);
+    simde_float64 r[32];
+
+    simde_memcpy(r, test_scatter_f64, sizeof(r));
+    simde_mm256_mask_i64scatter_pd(&(r[16]), test_vec[i].k, vindex, a, 8);
+    simde_assert_equal_vf64(32, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_i64scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t vindex[4];
+    const simde_float32 a[4];
+    const simde_float32 r[32];
+  } test_vec[] = {
+    { { -INT64_C(                   3), -INT64_C(                   2), -INT64_C(                  15), -INT64_C(                  16) },
+      { SIMDE_FLOAT32_C(   -70.20), SIMDE_FLOAT32_C(  -644.94), SIMDE_FLOAT32_C(  -363.75), SIMDE_FLOAT32_C(    60.53) },
+      { SIMDE_FLOAT32_C(    60.53), SIMDE_FLOAT32_C(  -363.75), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(   -70.20), SIMDE_FLOAT32_C(  -644.94), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -367.96),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { {  INT64_C(                   2),  INT64_C(                   6), -INT64_C(                   4), -INT64_C(                  15) },
+      { SIMDE_FLOAT32_C(  -686.83), SIMDE_FLOAT32_C(  -996.91), SIMDE_FLOAT32_C(  -877.66), SIMDE_FLOAT32_C(  -399.51) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -399.51), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(  -877.66), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(  -686.83), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -996.91), SIMDE_FLOAT32_C(  -367.96),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { { -INT64_C(                   8),  INT64_C(                  12), -INT64_C(                  16),  INT64_C(                   7) },
+      { SIMDE_FLOAT32_C(  -333.11), SIMDE_FLOAT32_C(  -893.66), SIMDE_FLOAT32_C(  -537.44), SIMDE_FLOAT32_C(   313.76) },
+      { SIMDE_FLOAT32_C(  -537.44), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(  -333.11), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(   313.76),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -893.66), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { {  INT64_C(                  14),  INT64_C(                   6),  INT64_C(                   4), -INT64_C(                   4) },
+      { SIMDE_FLOAT32_C(  -303.30), SIMDE_FLOAT32_C(   -84.62), SIMDE_FLOAT32_C(   691.71), SIMDE_FLOAT32_C(  -134.78) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(  -134.78), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   691.71), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(   -84.62), SIMDE_FLOAT32_C(  -367.96),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(  -303.30), SIMDE_FLOAT32_C(   112.55) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i vindex = simde_x_mm256_loadu_epi64(test_vec[i].vindex);
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde_float32 r[32];
+
+    simde_memcpy(r, test_scatter_f32, sizeof(r));
+    simde_mm256_i64scatter_ps(&(r[16]), vindex, a, 4);
+    simde_assert_equal_vf32(32, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_i64scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[4];
+    const simde_float32 a[4];
+    const simde_float32 r[32];
+  } test_vec[] = {
+    { UINT8_C( 15),
+      { -INT64_C(                   1),  INT64_C(                   9), -INT64_C(                   2),  INT64_C(                   7) },
+      { SIMDE_FLOAT32_C(    30.56), SIMDE_FLOAT32_C(  -219.80), SIMDE_FLOAT32_C(  -831.31), SIMDE_FLOAT32_C(  -450.01) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(  -831.31), SIMDE_FLOAT32_C(    30.56),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -450.01),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(  -219.80), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { UINT8_C(202),
+      { -INT64_C(                  14),  INT64_C(                   6), -INT64_C(                  13), -INT64_C(                  12) },
+      { SIMDE_FLOAT32_C(  -411.37), SIMDE_FLOAT32_C(   242.39), SIMDE_FLOAT32_C(   294.98), SIMDE_FLOAT32_C(  -504.51) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(  -504.51), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(   242.39), SIMDE_FLOAT32_C(  -367.96),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { UINT8_C(218),
+      { -INT64_C(                  15), -INT64_C(                  14),  INT64_C(                  14), -INT64_C(                   7) },
+      { SIMDE_FLOAT32_C(   775.85), SIMDE_FLOAT32_C(  -899.15), SIMDE_FLOAT32_C(   693.01), SIMDE_FLOAT32_C(  -645.55) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(  -899.15), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(  -645.55), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -367.96),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { UINT8_C(132),
+      {  INT64_C(                   2), -INT64_C(                  16), -INT64_C(                   1), -INT64_C(                   2) },
+      { SIMDE_FLOAT32_C(  -198.71), SIMDE_FLOAT32_C(  -965.47), SIMDE_FLOAT32_C(  -465.77), SIMDE_FLOAT32_C(  -927.54) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -465.77),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -367.96),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i vindex = simde_x_mm256_loadu_epi64(test_vec[i].vindex);
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde_float32 r[32];
+
+    simde_memcpy(r, test_scatter_f32, sizeof(r));
+    simde_mm256_mask_i64scatter_ps(&(r[16]), test_vec[i].k, vindex, a, 4);
+    simde_assert_equal_vf32(32, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_i32scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t vindex[16];
+    const int32_t a[16];
+    const int32_t r[32];
+  } test_vec[] = {
+    { { -INT32_C(           6), -INT32_C(           4),  INT32_C(           5),  INT32_C(           7),  INT32_C(           5), -INT32_C(           5),  INT32_C(           0), -INT32_C(           4),
+        -INT32_C(           6),  INT32_C(           3), -INT32_C(           6), -INT32_C(           7),  INT32_C(           6), -INT32_C(           8), -INT32_C(           8), -INT32_C(           1) },
+      { -INT32_C(  1260380699),  INT32_C(  1796080798),  INT32_C(  2128936727), -INT32_C(  1500114135),  INT32_C(   883217743), -INT32_C(  1457836251),  INT32_C(   890269755),  INT32_C(  1733770779),
+        -INT32_C(   455379289), -INT32_C(   837842550),  INT32_C(  1198699545), -INT32_C(  1112508623),  INT32_C(   588184479),  INT32_C(   282452392), -INT32_C(   311484309), -INT32_C(  1331264277) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+        -INT32_C(   311484309), -INT32_C(  1112508623),  INT32_C(  1198699545), -INT32_C(  1457836251),  INT32_C(  1733770779), -INT32_C(  1249725146), -INT32_C(  1351075380), -INT32_C(  1331264277),
+         INT32_C(   890269755), -INT32_C(  1594280740),  INT32_C(  1912893877), -INT32_C(   837842550),  INT32_C(   969850110),  INT32_C(   883217743),  INT32_C(   588184479), -INT32_C(  1500114135),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } },
+    { { -INT32_C(           5), -INT32_C(           1),  INT32_C(           1),  INT32_C(           6), -INT32_C(           3),  INT32_C(           3), -INT32_C(           6), -INT32_C(           4),
+        -INT32_C(           7), -INT32_C(           8), -INT32_C(           5), -INT32_C(           5),  INT32_C(           7),  INT32_C(           7),  INT32_C(           3), -INT32_C(           5) },
+      {  INT32_C(  1342737918),  INT32_C(  1040065381),  INT32_C(  1319609955),  INT32_C(  1220612591),  INT32_C(  1714489356),  INT32_C(  1367795996),  INT32_C(  1914708942), -INT32_C(  2102964215),
+         INT32_C(  1101348073), -INT32_C(  1672188720),  INT32_C(   335540233), -INT32_C(   545837655),  INT32_C(  1305708978), -INT32_C(  1059192287), -INT32_C(   531556763),  INT32_C(  1930071305) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+        -INT32_C(  1672188720),  INT32_C(  1101348073),  INT32_C(  1914708942),  INT32_C(  1930071305), -INT32_C(  2102964215),  INT32_C(  1714489356), -INT32_C(  1351075380),  INT32_C(  1040065381),
+        -INT32_C(  1039226102),  INT32_C(  1319609955),  INT32_C(  1912893877), -INT32_C(   531556763),  INT32_C(   969850110), -INT32_C(  1853628921),  INT32_C(  1220612591), -INT32_C(  1059192287),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } },
+    { {  INT32_C(           1),  INT32_C(           3), -INT32_C(           2),  INT32_C(           1),  INT32_C(           6),  INT32_C(           6), -INT32_C(           8), -INT32_C(           7),
+        -INT32_C(           1), -INT32_C(           6),  INT32_C(           5), -INT32_C(           4),  INT32_C(           1), -INT32_C(           3),  INT32_C(           2),  INT32_C(           6) },
+      { -INT32_C(  1149302724),  INT32_C(   143948076),  INT32_C(   352492254), -INT32_C(  2113673109),  INT32_C(    67540347),  INT32_C(   103196305), -INT32_C(  1066831972), -INT32_C(  1865950653),
+         INT32_C(   456566071), -INT32_C(  2055903811), -INT32_C(  1610792906),  INT32_C(   569931574),  INT32_C(  1307609688),  INT32_C(   513473868), -INT32_C(  1529013322),  INT32_C(    61246465) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+        -INT32_C(  1066831972), -INT32_C(  1865950653), -INT32_C(  2055903811),  INT32_C(  1850267257),  INT32_C(   569931574),  INT32_C(   513473868),  INT32_C(   352492254),  INT32_C(   456566071),
+        -INT32_C(  1039226102),  INT32_C(  1307609688), -INT32_C(  1529013322),  INT32_C(   143948076),  INT32_C(   969850110), -INT32_C(  1610792906),  INT32_C(    61246465),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } },
+    { { -INT32_C(           2), -INT32_C(           7), -INT32_C(           2), -INT32_C(           4),  INT32_C(           3),  INT32_C(           2),  INT32_C(           2), -INT32_C(           2),
+         INT32_C(           4), -INT32_C(           1), -INT32_C(           1), -INT32_C(           4), -INT32_C(           8),  INT32_C(           3),  INT32_C(           5), -INT32_C(           7) },
+      { -INT32_C(  2112009071),  INT32_C(   826831432),  INT32_C(   673673388), -INT32_C(  1021012659),  INT32_C(   861941543),  INT32_C(  1067173561), -INT32_C(   517308556),  INT32_C(  2123200138),
+        -INT32_C(  2077061401), -INT32_C(   667831750), -INT32_C(   199876642),  INT32_C(  1900020833),  INT32_C(  1434303529), -INT32_C(   417370863),  INT32_C(   901658507),  INT32_C(    14797092) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(  1434303529),  INT32_C(    14797092), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1900020833), -INT32_C(  1249725146),  INT32_C(  2123200138), -INT32_C(   199876642),
+        -INT32_C(  1039226102), -INT32_C(  1594280740), -INT32_C(   517308556), -INT32_C(   417370863), -INT32_C(  2077061401),  INT32_C(   901658507),  INT32_C(  1029814395),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i vindex = simde_mm512_loadu_epi32(test_vec[i].vindex);
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r[32];
+
+    simde_memcpy(r, test_scatter_i32, sizeof(r));
+    simde_mm512_i32scatter_epi32(&(r[16]), vindex, a, 4);
+    simde_assert_equal_vi32(32, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_i32scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t vindex[16];
+    const int32_t a[16];
+    const int32_t r[32];
+  } test_vec[] = {
+    { UINT16_C(65535),
+      {  INT32_C(           4),  INT32_C(           1), -INT32_C(           2),  INT32_C(           4),  INT32_C(           0),  INT32_C(           0),  INT32_C(           4),  INT32_C(           0),
+         INT32_C(           6),  INT32_C(           5), -INT32_C(           1),  INT32_C(           7),  INT32_C(           2),  INT32_C(           6), -INT32_C(           3), -INT32_C(           7) },
+      {  INT32_C(  1777031217), -INT32_C(   714431807),  INT32_C(   599320516),  INT32_C(   690546443),  INT32_C(  1739068421), -INT32_C(   482810515), -INT32_C(   173772825), -INT32_C(  2091368712),
+        -INT32_C(    92000123),  INT32_C(   791001508),  INT32_C(  1921981399), -INT32_C(  2036985824), -INT32_C(   870632448), -INT32_C(  1189215640), -INT32_C(  1183210388),  INT32_C(  1151847460) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(   310840079),  INT32_C(  1151847460), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1128593813), -INT32_C(  1183210388),  INT32_C(   599320516),  INT32_C(  1921981399),
+        -INT32_C(  2091368712), -INT32_C(   714431807), -INT32_C(   870632448),  INT32_C(  2112271382), -INT32_C(   173772825),  INT32_C(   791001508), -INT32_C(  1189215640), -INT32_C(  2036985824),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } },
+    { UINT16_C(42118),
+      { -INT32_C(           3), -INT32_C(           7),  INT32_C(           2), -INT32_C(           4), -INT32_C(           6),  INT32_C(           7),  INT32_C(           3),  INT32_C(           3),
+        -INT32_C(           3),  INT32_C(           7),  INT32_C(           1),  INT32_C(           2), -INT32_C(           7), -INT32_C(           4),  INT32_C(           4),  INT32_C(           0) },
+      {  INT32_C(  1739526735), -INT32_C(  1145356373),  INT32_C(   132039444), -INT32_C(   114869358), -INT32_C(  2136747675), -INT32_C(   864784505), -INT32_C(   164133224),  INT32_C(   499339157),
+        -INT32_C(  1169322934), -INT32_C(   193509934), -INT32_C(  1421434919), -INT32_C(  1224686426),  INT32_C(   932523183),  INT32_C(  1128844598),  INT32_C(   335794476),  INT32_C(  1474698638) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(   310840079), -INT32_C(  1145356373), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1128844598), -INT32_C(  1249725146), -INT32_C(  1351075380),  INT32_C(  1987001023),
+         INT32_C(  1474698638), -INT32_C(  1421434919),  INT32_C(   132039444),  INT32_C(   499339157),  INT32_C(   969850110), -INT32_C(  1853628921),  INT32_C(  1029814395),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } },
+    { UINT16_C(40317),
+      { -INT32_C(           3), -INT32_C(           2),  INT32_C(           2),  INT32_C(           2),  INT32_C(           0), -INT32_C(           2),  INT32_C(           5), -INT32_C(           6),
+         INT32_C(           2), -INT32_C(           4),  INT32_C(           5), -INT32_C(           1), -INT32_C(           3),  INT32_C(           2), -INT32_C(           5),  INT32_C(           5) },
+      {  INT32_C(   235865351),  INT32_C(   686340813),  INT32_C(   373192952), -INT32_C(  2139014647), -INT32_C(   587883971), -INT32_C(       41399),  INT32_C(  1098126005),  INT32_C(   855963600),
+         INT32_C(  1390086719),  INT32_C(  1915605995),  INT32_C(   551031436),  INT32_C(  1973322153),  INT32_C(  1865742058), -INT32_C(  1660656249), -INT32_C(   930091892),  INT32_C(    98455637) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(   310840079), -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1128593813),  INT32_C(  1865742058), -INT32_C(       41399),  INT32_C(  1973322153),
+        -INT32_C(   587883971), -INT32_C(  1594280740),  INT32_C(  1390086719),  INT32_C(  2112271382),  INT32_C(   969850110),  INT32_C(    98455637),  INT32_C(  1029814395),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } },
+    { UINT16_C(40640),
+      {  INT32_C(           1), -INT32_C(           1), -INT32_C(           1), -INT32_C(           3),  INT32_C(           4),  INT32_C(           0), -INT32_C(           6), -INT32_C(           7),
+         INT32_C(           5),  INT32_C(           7),  INT32_C(           2), -INT32_C(           6),  INT32_C(           3), -INT32_C(           7),  INT32_C(           5),  INT32_C(           0) },
+      {  INT32_C(   673002493),  INT32_C(  1523209946), -INT32_C(   807455497),  INT32_C(  1705989982), -INT32_C(  1531306384), -INT32_C(   903678388),  INT32_C(  1149411488),  INT32_C(   158698977),
+         INT32_C(  2127314618),  INT32_C(   241649735),  INT32_C(  1922004759), -INT32_C(  1389933511), -INT32_C(  1679086367), -INT32_C(  1099177224), -INT32_C(   572871875), -INT32_C(  1342541525) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(   310840079),  INT32_C(   158698977), -INT32_C(  1389933511),  INT32_C(  1850267257),  INT32_C(  1128593813), -INT32_C(  1249725146), -INT32_C(  1351075380),  INT32_C(  1987001023),
+        -INT32_C(  1342541525), -INT32_C(  1594280740),  INT32_C(  1922004759), -INT32_C(  1679086367),  INT32_C(   969850110), -INT32_C(  1853628921),  INT32_C(  1029814395),  INT32_C(   241649735),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i vindex = simde_mm512_loadu_epi32(test_vec[i].vindex);
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    int32_t r[32];
+
+    simde_memcpy(r, test_scatter_i32, sizeof(r));
+    simde_mm512_mask_i32scatter_epi32(&(r[16]), test_vec[i].k, vindex, a, 4);
+    simde_assert_equal_vi32(32, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_i32scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t vindex[8];
+    const int64_t a[8];
+    const int64_t r[32];
+  } test_vec[] = {
+    { { -INT32_C(           8),  INT32_C(           4), -INT32_C(           4), -INT32_C(           3),  INT32_C(           2),  INT32_C(           6), -INT32_C(           3), -INT32_C(           1) },
+      {  INT64_C( 9210678011706740381), -INT64_C( 5436017367522960960),  INT64_C( 8835927377613097203), -INT64_C( 3980551296759834078),
+        -INT64_C(  799821479414676714), -INT64_C( 8408741495754505456),  INT64_C( 6998499722723551638),  INT64_C( 5324889313071266501) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 9210678011706740381), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 8835927377613097203),  INT64_C( 6998499722723551638), -INT64_C( 1229133987052756326),  INT64_C( 5324889313071266501),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C(  799821479414676714), -INT64_C( 1774777017819125221),
+        -INT64_C( 5436017367522960960),  INT64_C( 7905224152794973602), -INT64_C( 8408741495754505456), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } },
+    { {  INT32_C(           0),  INT32_C(           2), -INT32_C(           6),  INT32_C(           1), -INT32_C(           6), -INT32_C(           3),  INT32_C(           2), -INT32_C(           5) },
+      { -INT64_C( 3152004505138759744), -INT64_C( 7099143429558924241), -INT64_C( 8107634008913852169), -INT64_C(  865863686706481754),
+         INT64_C( 2598615705432848973),  INT64_C( 7996054620926013433), -INT64_C( 8594680204286532250), -INT64_C( 5647959455529948628) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120),  INT64_C( 2598615705432848973), -INT64_C( 5647959455529948628),
+         INT64_C( 7525532036093015925),  INT64_C( 7996054620926013433), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+        -INT64_C( 3152004505138759744), -INT64_C(  865863686706481754), -INT64_C( 8594680204286532250), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } },
+    { { -INT32_C(           7),  INT32_C(           1),  INT32_C(           3),  INT32_C(           3),  INT32_C(           0),  INT32_C(           6), -INT32_C(           6),  INT32_C(           1) },
+      { -INT64_C(  554368661294799537),  INT64_C( 6329891398070387397), -INT64_C( 1407553814035119872),  INT64_C( 2445091066565943426),
+         INT64_C( 4405383096546806211), -INT64_C( 4442398583876582256), -INT64_C( 4428384473034977895),  INT64_C( 3524295320953848258) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  554368661294799537), -INT64_C( 4428384473034977895), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C( 4405383096546806211),  INT64_C( 3524295320953848258), -INT64_C( 7360632097894753427),  INT64_C( 2445091066565943426),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 4442398583876582256), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } },
+    { {  INT32_C(           7),  INT32_C(           6), -INT32_C(           2),  INT32_C(           4),  INT32_C(           5),  INT32_C(           6),  INT32_C(           1),  INT32_C(           6) },
+      {  INT64_C( 4079111633814220159),  INT64_C(  330621427873940325),  INT64_C( 8776628319808545827),  INT64_C( 2886483201944365099),
+        -INT64_C( 7019787700546580549), -INT64_C( 4148918308760729884),  INT64_C( 6014440103427217513), -INT64_C(   15053104403518695) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781),  INT64_C( 8776628319808545827),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 6014440103427217513), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+         INT64_C( 2886483201944365099), -INT64_C( 7019787700546580549), -INT64_C(   15053104403518695),  INT64_C( 4079111633814220159),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i vindex = simde_x_mm256_loadu_epi32(test_vec[i].vindex);
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r[32];
+
+    simde_memcpy(r, test_scatter_i64, sizeof(r));
+    simde_mm512_i32scatter_epi64(&(r[16]), vindex, a, 8);
+    simde_assert_equal_vi64(32, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_i32scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t vindex[8];
+    const int64_t a[8];
+    const int64_t r[32];
+  } test_vec[] = {
+    { UINT8_C(255),
+      { -INT32_C(           2), -INT32_C(           7), -INT32_C(           5), -INT32_C(           3), -INT32_C(           2), -INT32_C(           8), -INT32_C(           2),  INT32_C(           5) },
+      { -INT64_C( 3726517028144750291),  INT64_C( 6400171067847013295),  INT64_C( 5420944137516513672),  INT64_C(  791198964560874363),
+        -INT64_C( 2671169233746663379), -INT64_C( 5701284845160143683), -INT64_C( 2015441595880556236), -INT64_C( 2721074512749852602) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+        -INT64_C( 5701284845160143683),  INT64_C( 6400171067847013295), -INT64_C( 6977536476063400421),  INT64_C( 5420944137516513672),
+         INT64_C( 7525532036093015925),  INT64_C(  791198964560874363), -INT64_C( 2015441595880556236),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713), -INT64_C( 2721074512749852602), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } },
+    { UINT8_C(  0),
+      { -INT32_C(           2), -INT32_C(           2), -INT32_C(           8), -INT32_C(           4), -INT32_C(           7), -INT32_C(           7), -INT32_C(           3),  INT32_C(           7) },
+      { -INT64_C( 2059664591726617512),  INT64_C(  748947567210403040),  INT64_C( 8217288461551852745),  INT64_C( 8374616084331340592),
+        -INT64_C( 7536871115961089930), -INT64_C( 2720254382419450762),  INT64_C( 8472224389702736190),  INT64_C( 9199580257974424844) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } },
+    { UINT8_C( 84),
+      { -INT32_C(           3),  INT32_C(           5),  INT32_C(           1), -INT32_C(           8), -INT32_C(           7),  INT32_C(           5),  INT32_C(           5), -INT32_C(           5) },
+      {  INT64_C( 7357015422098714988), -INT64_C( 3067791927212708594), -INT64_C( 4103565511870826668),  INT64_C( 7927718867601107002),
+        -INT64_C( 4941229244350796822),  INT64_C( 7909957443583358141), -INT64_C( 1746486332291102828), -INT64_C( 3842469778841219301) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C( 4941229244350796822), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694), -INT64_C( 4103565511870826668), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713), -INT64_C( 1746486332291102828), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } },
+    { UINT8_C( 53),
+      { -INT32_C(           7),  INT32_C(           7),  INT32_C(           7), -INT32_C(           4),  INT32_C(           1),  INT32_C(           3),  INT32_C(           4), -INT32_C(           8) },
+      { -INT64_C( 5181427691889123999),  INT64_C(  470263990325985819),  INT64_C(  602755128043779935),  INT64_C( 6020750505008378097),
+         INT64_C( 3125276773152826064),  INT64_C( 2658691436399299989),  INT64_C( 6589563870401667278), -INT64_C( 9152078846966249713) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C( 5181427691889123999), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 3125276773152826064), -INT64_C( 7360632097894753427),  INT64_C( 2658691436399299989),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511),  INT64_C(  602755128043779935),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i vindex = simde_x_mm256_loadu_epi32(test_vec[i].vindex);
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r[32];
+
+    simde_memcpy(r, test_scatter_i64, sizeof(r));
+    simde_mm512_mask_i32scatter_epi64(&(r[16]), test_vec[i].k, vindex, a, 8);
+    simde_assert_equal_vi64(32, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_i32scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t vindex[8];
+    const simde_float64 a[8];
+    const simde_float64 r[32];
+  } test_vec[] = {
+    { { -INT32_C(           6), -INT32_C(           8), -INT32_C(           6), -INT32_C(           2), -INT32_C(           2), -INT32_C(           4), -INT32_C(           4),  INT32_C(           0) },
+      { SIMDE_FLOAT64_C(   718.93), SIMDE_FLOAT64_C(  -756.64), SIMDE_FLOAT64_C(  -722.62), SIMDE_FLOAT64_C(  -158.02),
+        SIMDE_FLOAT64_C(   394.91), SIMDE_FLOAT64_C(  -138.19), SIMDE_FLOAT64_C(   148.78), SIMDE_FLOAT64_C(  -568.90) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(  -756.64), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(  -722.62), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(   148.78), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   394.91), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -568.90), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } },
+    { {  INT32_C(           6), -INT32_C(           5), -INT32_C(           2),  INT32_C(           4), -INT32_C(           4),  INT32_C(           4), -INT32_C(           2), -INT32_C(           4) },
+      { SIMDE_FLOAT64_C(  -688.62), SIMDE_FLOAT64_C(  -680.40), SIMDE_FLOAT64_C(  -898.69), SIMDE_FLOAT64_C(  -582.88),
+        SIMDE_FLOAT64_C(   307.19), SIMDE_FLOAT64_C(   121.81), SIMDE_FLOAT64_C(   347.91), SIMDE_FLOAT64_C(    -5.97) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(  -680.40),
+        SIMDE_FLOAT64_C(    -5.97), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   347.91), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   121.81), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(  -688.62), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } },
+    { {  INT32_C(           2), -INT32_C(           4),  INT32_C(           4),  INT32_C(           5), -INT32_C(           4),  INT32_C(           3), -INT32_C(           3), -INT32_C(           8) },
+      { SIMDE_FLOAT64_C(  -992.46), SIMDE_FLOAT64_C(   960.60), SIMDE_FLOAT64_C(  -878.30), SIMDE_FLOAT64_C(   553.11),
+        SIMDE_FLOAT64_C(  -197.41), SIMDE_FLOAT64_C(   972.69), SIMDE_FLOAT64_C(   278.73), SIMDE_FLOAT64_C(   458.94) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   458.94), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -197.41), SIMDE_FLOAT64_C(   278.73), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -992.46), SIMDE_FLOAT64_C(   972.69),
+        SIMDE_FLOAT64_C(  -878.30), SIMDE_FLOAT64_C(   553.11), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } },
+    { { -INT32_C(           5),  INT32_C(           0),  INT32_C(           6),  INT32_C(           1),  INT32_C(           2),  INT32_C(           2), -INT32_C(           7), -INT32_C(           4) },
+      { SIMDE_FLOAT64_C(  -938.66), SIMDE_FLOAT64_C(  -248.58), SIMDE_FLOAT64_C(   123.86), SIMDE_FLOAT64_C(   273.54),
+        SIMDE_FLOAT64_C(  -641.50), SIMDE_FLOAT64_C(   593.98), SIMDE_FLOAT64_C(   713.01), SIMDE_FLOAT64_C(   194.81) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   713.01), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(  -938.66),
+        SIMDE_FLOAT64_C(   194.81), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -248.58), SIMDE_FLOAT64_C(   273.54), SIMDE_FLOAT64_C(   593.98), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   123.86), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i vindex = simde_x_mm256_loadu_epi32(test_vec[i].vindex);
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_float64 r[32];
+
+    simde_memcpy(r, test_scatter_f64, sizeof(r));
+    simde_mm512_i32scatter_pd(&(r[16]), vindex, a, 8);
+    simde_assert_equal_vf64(32, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_i32scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t vindex[8];
+    const simde_float64 a[8];
+    const simde_float64 r[32];
+  } test_vec[] = {
+    { UINT8_C(255),
+      { -INT32_C(           2), -INT32_C(           3), -INT32_C(           6), -INT32_C(           2), -INT32_C(           1), -INT32_C(           5),  INT32_C(           5), -INT32_C(           1) },
+      { SIMDE_FLOAT64_C(   776.87), SIMDE_FLOAT64_C(  -381.10), SIMDE_FLOAT64_C(  -564.46), SIMDE_FLOAT64_C(  -205.62),
+        SIMDE_FLOAT64_C(  -733.05), SIMDE_FLOAT64_C(   752.93), SIMDE_FLOAT64_C(     0.64), SIMDE_FLOAT64_C(   840.38) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(  -564.46), SIMDE_FLOAT64_C(   752.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -381.10), SIMDE_FLOAT64_C(  -205.62), SIMDE_FLOAT64_C(   840.38),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(     0.64), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } },
+    { UINT8_C(199),
+      { -INT32_C(           6), -INT32_C(           7), -INT32_C(           8), -INT32_C(           1), -INT32_C(           4),  INT32_C(           2), -INT32_C(           5), -INT32_C(           3) },
+      { SIMDE_FLOAT64_C(  -416.08), SIMDE_FLOAT64_C(  -142.23), SIMDE_FLOAT64_C(  -172.04), SIMDE_FLOAT64_C(  -101.96),
+        SIMDE_FLOAT64_C(   250.88), SIMDE_FLOAT64_C(   726.99), SIMDE_FLOAT64_C(  -491.11), SIMDE_FLOAT64_C(  -278.48) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(  -172.04), SIMDE_FLOAT64_C(  -142.23), SIMDE_FLOAT64_C(  -416.08), SIMDE_FLOAT64_C(  -491.11),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -278.48), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } },
+    { UINT8_C( 28),
+      {  INT32_C(           4),  INT32_C(           7), -INT32_C(           4), -INT32_C(           2),  INT32_C(           6),  INT32_C(           0), -INT32_C(           4),  INT32_C(           7) },
+      { SIMDE_FLOAT64_C(   935.20), SIMDE_FLOAT64_C(   978.24), SIMDE_FLOAT64_C(    84.21), SIMDE_FLOAT64_C(   382.46),
+        SIMDE_FLOAT64_C(  -366.93), SIMDE_FLOAT64_C(  -924.24), SIMDE_FLOAT64_C(   923.63), SIMDE_FLOAT64_C(   198.83) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(    84.21), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   382.46), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(  -366.93), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } },
+    { UINT8_C(148),
+      {  INT32_C(           7),  INT32_C(           3), -INT32_C(           6),  INT32_C(           6),  INT32_C(           3),  INT32_C(           5), -INT32_C(           3), -INT32_C(           8) },
+      { SIMDE_FLOAT64_C(  -489.51), SIMDE_FLOAT64_C(  -313.56), SIMDE_FLOAT64_C(     5.15), SIMDE_FLOAT64_C(  -772.76),
+        SIMDE_FLOAT64_C(   996.31), SIMDE_FLOAT64_C(  -518.32), SIMDE_FLOAT64_C(   360.60), SIMDE_FLOAT64_C(   835.46) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   835.46), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(     5.15), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   996.31),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i vindex = simde_x_mm256_loadu_epi32(test_vec[i].vindex);
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_float64 r[32];
+
+    simde_memcpy(r, test_scatter_f64, sizeof(r));
+    simde_mm512_mask_i32scatter_pd(&(r[16]), test_vec[i].k, vindex, a, 8);
+    simde_assert_equal_vf64(32, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_i32scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t vindex[16];
+    const simde_float32 a[16];
+    const simde_float32 r[32];
+  } test_vec[] = {
+    { {  INT32_C(           7), -INT32_C(           6),  INT32_C(           3), -INT32_C(           1), -INT32_C(           3),  INT32_C(           2), -INT32_C(           5),  INT32_C(           7),
+        -INT32_C(           8),  INT32_C(           6), -INT32_C(           8),  INT32_C(           6),  INT32_C(           5), -INT32_C(           4),  INT32_C(           5),  INT32_C(           0) },
+      { SIMDE_FLOAT32_C(  -573.30), SIMDE_FLOAT32_C(  -776.03), SIMDE_FLOAT32_C(   480.32), SIMDE_FLOAT32_C(  -159.23),
+        SIMDE_FLOAT32_C(   156.40), SIMDE_FLOAT32_C(  -224.48), SIMDE_FLOAT32_C(  -437.94), SIMDE_FLOAT32_C(   -80.60),
+        SIMDE_FLOAT32_C(  -132.68), SIMDE_FLOAT32_C(  -852.10), SIMDE_FLOAT32_C(  -576.38), SIMDE_FLOAT32_C(   330.17),
+        SIMDE_FLOAT32_C(  -440.78), SIMDE_FLOAT32_C(   258.47), SIMDE_FLOAT32_C(  -238.69), SIMDE_FLOAT32_C(  -374.07) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(  -576.38), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -776.03), SIMDE_FLOAT32_C(  -437.94),
+        SIMDE_FLOAT32_C(   258.47), SIMDE_FLOAT32_C(   156.40), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -159.23),
+        SIMDE_FLOAT32_C(  -374.07), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(  -224.48), SIMDE_FLOAT32_C(   480.32),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -238.69), SIMDE_FLOAT32_C(   330.17), SIMDE_FLOAT32_C(   -80.60),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { {  INT32_C(           6),  INT32_C(           5), -INT32_C(           7),  INT32_C(           4), -INT32_C(           1),  INT32_C(           3), -INT32_C(           7), -INT32_C(           3),
+         INT32_C(           0),  INT32_C(           6),  INT32_C(           6), -INT32_C(           4), -INT32_C(           4), -INT32_C(           3), -INT32_C(           3), -INT32_C(           7) },
+      { SIMDE_FLOAT32_C(   236.90), SIMDE_FLOAT32_C(  -731.70), SIMDE_FLOAT32_C(   274.31), SIMDE_FLOAT32_C(   572.19),
+        SIMDE_FLOAT32_C(   534.12), SIMDE_FLOAT32_C(    79.11), SIMDE_FLOAT32_C(  -144.43), SIMDE_FLOAT32_C(  -953.64),
+        SIMDE_FLOAT32_C(   632.19), SIMDE_FLOAT32_C(  -820.47), SIMDE_FLOAT32_C(    17.53), SIMDE_FLOAT32_C(   321.69),
+        SIMDE_FLOAT32_C(   827.74), SIMDE_FLOAT32_C(   618.99), SIMDE_FLOAT32_C(  -393.58), SIMDE_FLOAT32_C(  -678.76) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(  -678.76), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   827.74), SIMDE_FLOAT32_C(  -393.58), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(   534.12),
+        SIMDE_FLOAT32_C(   632.19), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(    79.11),
+        SIMDE_FLOAT32_C(   572.19), SIMDE_FLOAT32_C(  -731.70), SIMDE_FLOAT32_C(    17.53), SIMDE_FLOAT32_C(  -367.96),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { { -INT32_C(           4), -INT32_C(           1),  INT32_C(           2),  INT32_C(           5), -INT32_C(           7),  INT32_C(           7), -INT32_C(           4),  INT32_C(           4),
+         INT32_C(           0), -INT32_C(           7),  INT32_C(           4), -INT32_C(           2), -INT32_C(           3),  INT32_C(           3), -INT32_C(           2), -INT32_C(           7) },
+      { SIMDE_FLOAT32_C(  -101.40), SIMDE_FLOAT32_C(   -89.42), SIMDE_FLOAT32_C(  -920.52), SIMDE_FLOAT32_C(   372.88),
+        SIMDE_FLOAT32_C(   306.37), SIMDE_FLOAT32_C(  -682.92), SIMDE_FLOAT32_C(  -384.82), SIMDE_FLOAT32_C(  -586.09),
+        SIMDE_FLOAT32_C(    63.65), SIMDE_FLOAT32_C(  -302.64), SIMDE_FLOAT32_C(   767.22), SIMDE_FLOAT32_C(  -378.53),
+        SIMDE_FLOAT32_C(  -752.11), SIMDE_FLOAT32_C(   587.17), SIMDE_FLOAT32_C(   365.02), SIMDE_FLOAT32_C(  -418.65) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(  -418.65), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(  -384.82), SIMDE_FLOAT32_C(  -752.11), SIMDE_FLOAT32_C(   365.02), SIMDE_FLOAT32_C(   -89.42),
+        SIMDE_FLOAT32_C(    63.65), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(  -920.52), SIMDE_FLOAT32_C(   587.17),
+        SIMDE_FLOAT32_C(   767.22), SIMDE_FLOAT32_C(   372.88), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -682.92),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { {  INT32_C(           5),  INT32_C(           5), -INT32_C(           3),  INT32_C(           2),  INT32_C(           4),  INT32_C(           7), -INT32_C(           3),  INT32_C(           6),
+        -INT32_C(           8),  INT32_C(           1), -INT32_C(           5),  INT32_C(           4),  INT32_C(           3), -INT32_C(           8), -INT32_C(           4), -INT32_C(           7) },
+      { SIMDE_FLOAT32_C(  -532.94), SIMDE_FLOAT32_C(  -903.64), SIMDE_FLOAT32_C(     8.81), SIMDE_FLOAT32_C(  -310.04),
+        SIMDE_FLOAT32_C(   484.31), SIMDE_FLOAT32_C(  -130.64), SIMDE_FLOAT32_C(   538.24), SIMDE_FLOAT32_C(   696.54),
+        SIMDE_FLOAT32_C(   310.38), SIMDE_FLOAT32_C(  -111.07), SIMDE_FLOAT32_C(  -115.51), SIMDE_FLOAT32_C(   449.84),
+        SIMDE_FLOAT32_C(  -425.56), SIMDE_FLOAT32_C(  -134.96), SIMDE_FLOAT32_C(  -338.39), SIMDE_FLOAT32_C(  -735.99) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(  -134.96), SIMDE_FLOAT32_C(  -735.99), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(  -115.51),
+        SIMDE_FLOAT32_C(  -338.39), SIMDE_FLOAT32_C(   538.24), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(  -111.07), SIMDE_FLOAT32_C(  -310.04), SIMDE_FLOAT32_C(  -425.56),
+        SIMDE_FLOAT32_C(   449.84), SIMDE_FLOAT32_C(  -903.64), SIMDE_FLOAT32_C(   696.54), SIMDE_FLOAT32_C(  -130.64),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i vindex = simde_mm512_loadu_epi32(test_vec[i].vindex);
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_float32 r[32];
+
+    simde_memcpy(r, test_scatter_f32, sizeof(r));
+    simde_mm512_i32scatter_ps(&(r[16]), vindex, a, 4);
+    simde_assert_equal_vf32(32, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_i32scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t vindex[16];
+    const simde_float32 a[16];
+    const simde_float32 r[32];
+  } test_vec[] = {
+    { UINT16_C(65535),
+      { -INT32_C(           6),  INT32_C(           5), -INT32_C(           3), -INT32_C(           8),  INT32_C(           4), -INT32_C(           2),  INT32_C(           0),  INT32_C(           4),
+        -INT32_C(           4), -INT32_C(           7),  INT32_C(           2),  INT32_C(           5),  INT32_C(           4), -INT32_C(           3), -INT32_C(           2),  INT32_C(           7) },
+      { SIMDE_FLOAT32_C(   819.18), SIMDE_FLOAT32_C(   542.04), SIMDE_FLOAT32_C(   -48.19), SIMDE_FLOAT32_C(  -883.07),
+        SIMDE_FLOAT32_C(  -428.55), SIMDE_FLOAT32_C(   789.76), SIMDE_FLOAT32_C(    72.41), SIMDE_FLOAT32_C(   349.12),
+        SIMDE_FLOAT32_C(   662.67), SIMDE_FLOAT32_C(   384.72), SIMDE_FLOAT32_C(  -302.91), SIMDE_FLOAT32_C(    59.83),
+        SIMDE_FLOAT32_C(   791.04), SIMDE_FLOAT32_C(   711.75), SIMDE_FLOAT32_C(   364.60), SIMDE_FLOAT32_C(   516.07) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(  -883.07), SIMDE_FLOAT32_C(   384.72), SIMDE_FLOAT32_C(   819.18), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   662.67), SIMDE_FLOAT32_C(   711.75), SIMDE_FLOAT32_C(   364.60), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(    72.41), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(  -302.91), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   791.04), SIMDE_FLOAT32_C(    59.83), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(   516.07),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { UINT16_C(41318),
+      { -INT32_C(           6),  INT32_C(           2), -INT32_C(           7), -INT32_C(           3), -INT32_C(           7),  INT32_C(           1),  INT32_C(           0), -INT32_C(           8),
+         INT32_C(           7), -INT32_C(           8), -INT32_C(           1), -INT32_C(           5),  INT32_C(           5), -INT32_C(           6),  INT32_C(           6),  INT32_C(           2) },
+      { SIMDE_FLOAT32_C(   492.84), SIMDE_FLOAT32_C(   791.83), SIMDE_FLOAT32_C(    49.75), SIMDE_FLOAT32_C(   678.17),
+        SIMDE_FLOAT32_C(  -294.93), SIMDE_FLOAT32_C(   788.23), SIMDE_FLOAT32_C(  -349.93), SIMDE_FLOAT32_C(    99.93),
+        SIMDE_FLOAT32_C(   409.69), SIMDE_FLOAT32_C(  -860.14), SIMDE_FLOAT32_C(  -136.83), SIMDE_FLOAT32_C(   212.36),
+        SIMDE_FLOAT32_C(  -774.76), SIMDE_FLOAT32_C(   461.75), SIMDE_FLOAT32_C(  -673.16), SIMDE_FLOAT32_C(  -533.49) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(    49.75), SIMDE_FLOAT32_C(   461.75), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(  -349.93), SIMDE_FLOAT32_C(   788.23), SIMDE_FLOAT32_C(  -533.49), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(   409.69),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { UINT16_C(25833),
+      { -INT32_C(           2), -INT32_C(           6),  INT32_C(           0),  INT32_C(           1),  INT32_C(           4), -INT32_C(           8),  INT32_C(           1), -INT32_C(           5),
+         INT32_C(           0), -INT32_C(           2), -INT32_C(           5), -INT32_C(           3),  INT32_C(           7),  INT32_C(           6),  INT32_C(           6), -INT32_C(           5) },
+      { SIMDE_FLOAT32_C(  -204.16), SIMDE_FLOAT32_C(  -629.24), SIMDE_FLOAT32_C(  -662.81), SIMDE_FLOAT32_C(   581.93),
+        SIMDE_FLOAT32_C(   432.48), SIMDE_FLOAT32_C(   832.49), SIMDE_FLOAT32_C(   -34.32), SIMDE_FLOAT32_C(   540.41),
+        SIMDE_FLOAT32_C(  -616.93), SIMDE_FLOAT32_C(  -255.95), SIMDE_FLOAT32_C(  -301.90), SIMDE_FLOAT32_C(  -167.20),
+        SIMDE_FLOAT32_C(  -993.94), SIMDE_FLOAT32_C(  -492.05), SIMDE_FLOAT32_C(   440.32), SIMDE_FLOAT32_C(   758.10) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   832.49), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(  -301.90),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(  -204.16), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(   -34.32), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(   440.32), SIMDE_FLOAT32_C(  -367.96),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { UINT16_C(25629),
+      { -INT32_C(           8),  INT32_C(           5), -INT32_C(           8),  INT32_C(           3),  INT32_C(           5),  INT32_C(           2),  INT32_C(           7), -INT32_C(           4),
+         INT32_C(           7),  INT32_C(           0),  INT32_C(           7), -INT32_C(           3),  INT32_C(           4),  INT32_C(           4),  INT32_C(           1),  INT32_C(           6) },
+      { SIMDE_FLOAT32_C(   -58.35), SIMDE_FLOAT32_C(   199.10), SIMDE_FLOAT32_C(   913.10), SIMDE_FLOAT32_C(  -148.46),
+        SIMDE_FLOAT32_C(  -569.43), SIMDE_FLOAT32_C(  -493.48), SIMDE_FLOAT32_C(    77.34), SIMDE_FLOAT32_C(   451.97),
+        SIMDE_FLOAT32_C(  -484.18), SIMDE_FLOAT32_C(   754.51), SIMDE_FLOAT32_C(   157.80), SIMDE_FLOAT32_C(    48.27),
+        SIMDE_FLOAT32_C(   507.90), SIMDE_FLOAT32_C(  -963.19), SIMDE_FLOAT32_C(   787.22), SIMDE_FLOAT32_C(   788.83) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   913.10), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(   787.22), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -148.46),
+        SIMDE_FLOAT32_C(  -963.19), SIMDE_FLOAT32_C(  -569.43), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(   157.80),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i vindex = simde_mm512_loadu_epi32(test_vec[i].vindex);
+    simde__m512 a = simde_mm512_loadu_ps(test_vec[i].a);
+    simde_float32 r[32];
+
+    simde_memcpy(r, test_scatter_f32, sizeof(r));
+    simde_mm512_mask_i32scatter_ps(&(r[16]), test_vec[i].k, vindex, a, 4);
+    simde_assert_equal_vf32(32, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_i64scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t vindex[8];
+    const int32_t a[8];
+    const int32_t r[32];
+  } test_vec[] = {
+    { { -INT64_C(                   8), -INT64_C(                   4), -INT64_C(                   5), -INT64_C(                   4),
+         INT64_C(                   1),  INT64_C(                   3), -INT64_C(                   1),  INT64_C(                   4) },
+      { -INT32_C(   171221459), -INT32_C(  2037324847),  INT32_C(  1601377878), -INT32_C(  1875466758),  INT32_C(  1382217265),  INT32_C(    25665437), -INT32_C(   833300510), -INT32_C(   476330291) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+        -INT32_C(   171221459), -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(  1601377878), -INT32_C(  1875466758), -INT32_C(  1249725146), -INT32_C(  1351075380), -INT32_C(   833300510),
+        -INT32_C(  1039226102),  INT32_C(  1382217265),  INT32_C(  1912893877),  INT32_C(    25665437), -INT32_C(   476330291), -INT32_C(  1853628921),  INT32_C(  1029814395),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } },
+    { { -INT64_C(                   1), -INT64_C(                   7),  INT64_C(                   1), -INT64_C(                   2),
+         INT64_C(                   0),  INT64_C(                   4), -INT64_C(                   3),  INT64_C(                   4) },
+      { -INT32_C(  1641973189),  INT32_C(  2015024655), -INT32_C(  2108129181), -INT32_C(  1607054941),  INT32_C(  1546661360), -INT32_C(   831835733), -INT32_C(  1692472056), -INT32_C(   409562414) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(   310840079),  INT32_C(  2015024655), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1128593813), -INT32_C(  1692472056), -INT32_C(  1607054941), -INT32_C(  1641973189),
+         INT32_C(  1546661360), -INT32_C(  2108129181),  INT32_C(  1912893877),  INT32_C(  2112271382), -INT32_C(   409562414), -INT32_C(  1853628921),  INT32_C(  1029814395),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } },
+    { { -INT64_C(                   3),  INT64_C(                   1),  INT64_C(                   0),  INT64_C(                   7),
+         INT64_C(                   2), -INT64_C(                   8), -INT64_C(                   6), -INT64_C(                   6) },
+      { -INT32_C(  1028462402),  INT32_C(  2068079343),  INT32_C(  1562620394), -INT32_C(   681915383), -INT32_C(   530293807),  INT32_C(  1367623462),  INT32_C(  1854031400), -INT32_C(    45889372) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(  1367623462), -INT32_C(   911005991), -INT32_C(    45889372),  INT32_C(  1850267257),  INT32_C(  1128593813), -INT32_C(  1028462402), -INT32_C(  1351075380),  INT32_C(  1987001023),
+         INT32_C(  1562620394),  INT32_C(  2068079343), -INT32_C(   530293807),  INT32_C(  2112271382),  INT32_C(   969850110), -INT32_C(  1853628921),  INT32_C(  1029814395), -INT32_C(   681915383),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } },
+    { { -INT64_C(                   8), -INT64_C(                   6),  INT64_C(                   5),  INT64_C(                   3),
+         INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   7),  INT64_C(                   1) },
+      {  INT32_C(  1216518367),  INT32_C(  1173506606),  INT32_C(  1692067130),  INT32_C(   988634736), -INT32_C(  1852237620),  INT32_C(    69179901),  INT32_C(   231897486), -INT32_C(  1348698371) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(  1216518367), -INT32_C(   911005991),  INT32_C(  1173506606),  INT32_C(  1850267257),  INT32_C(  1128593813), -INT32_C(  1249725146), -INT32_C(  1351075380),  INT32_C(    69179901),
+        -INT32_C(  1039226102), -INT32_C(  1348698371),  INT32_C(  1912893877),  INT32_C(   988634736),  INT32_C(   969850110),  INT32_C(  1692067130),  INT32_C(  1029814395),  INT32_C(   231897486),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    int32_t r[32];
+
+    simde_memcpy(r, test_scatter_i32, sizeof(r));
+    simde_mm512_i64scatter_epi32(&(r[16]), vindex, a, 4);
+    simde_assert_equal_vi32(32, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_i64scatter_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[8];
+    const int32_t a[8];
+    const int32_t r[32];
+  } test_vec[] = {
+    { UINT8_C(255),
+      { -INT64_C(                   5), -INT64_C(                   7),  INT64_C(                   2),  INT64_C(                   7),
+         INT64_C(                   5), -INT64_C(                   5), -INT64_C(                   6),  INT64_C(                   5) },
+      {  INT32_C(   267090172), -INT32_C(  1976626931), -INT32_C(  2046776209), -INT32_C(  1153149193),  INT32_C(   986547098), -INT32_C(   711868899),  INT32_C(  1037351457),  INT32_C(  1945090837) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(   310840079), -INT32_C(  1976626931),  INT32_C(  1037351457), -INT32_C(   711868899),  INT32_C(  1128593813), -INT32_C(  1249725146), -INT32_C(  1351075380),  INT32_C(  1987001023),
+        -INT32_C(  1039226102), -INT32_C(  1594280740), -INT32_C(  2046776209),  INT32_C(  2112271382),  INT32_C(   969850110),  INT32_C(  1945090837),  INT32_C(  1029814395), -INT32_C(  1153149193),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } },
+    { UINT8_C(157),
+      { -INT64_C(                   2),  INT64_C(                   7),  INT64_C(                   7),  INT64_C(                   6),
+         INT64_C(                   1),  INT64_C(                   4),  INT64_C(                   2),  INT64_C(                   3) },
+      {  INT32_C(  1584578296),  INT32_C(    45409669),  INT32_C(   287591694), -INT32_C(  2120448492),  INT32_C(   458013208), -INT32_C(   338713236), -INT32_C(   284106458), -INT32_C(  1642444444) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(   310840079), -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1128593813), -INT32_C(  1249725146),  INT32_C(  1584578296),  INT32_C(  1987001023),
+        -INT32_C(  1039226102),  INT32_C(   458013208),  INT32_C(  1912893877), -INT32_C(  1642444444),  INT32_C(   969850110), -INT32_C(  1853628921), -INT32_C(  2120448492),  INT32_C(   287591694),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } },
+    { UINT8_C(139),
+      { -INT64_C(                   1), -INT64_C(                   1),  INT64_C(                   4),  INT64_C(                   0),
+        -INT64_C(                   6),  INT64_C(                   5), -INT64_C(                   3), -INT64_C(                   7) },
+      { -INT32_C(   159705592), -INT32_C(  1512349148),  INT32_C(   499965408), -INT32_C(  1714799525),  INT32_C(   641457891), -INT32_C(   396332642), -INT32_C(  1603987715),  INT32_C(  1839186832) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(   310840079),  INT32_C(  1839186832), -INT32_C(  1483024684),  INT32_C(  1850267257),  INT32_C(  1128593813), -INT32_C(  1249725146), -INT32_C(  1351075380), -INT32_C(  1512349148),
+        -INT32_C(  1714799525), -INT32_C(  1594280740),  INT32_C(  1912893877),  INT32_C(  2112271382),  INT32_C(   969850110), -INT32_C(  1853628921),  INT32_C(  1029814395),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } },
+    { UINT8_C( 55),
+      {  INT64_C(                   5), -INT64_C(                   1), -INT64_C(                   5),  INT64_C(                   4),
+        -INT64_C(                   2),  INT64_C(                   2), -INT64_C(                   7), -INT64_C(                   2) },
+      { -INT32_C(  2105869779), -INT32_C(   306764647),  INT32_C(   739658896), -INT32_C(  1235401719), -INT32_C(  2057052991),  INT32_C(   326503224), -INT32_C(  2115426002), -INT32_C(  1099075332) },
+      { -INT32_C(   358030361),  INT32_C(   486124512),  INT32_C(  1488494775), -INT32_C(   665117642), -INT32_C(  1749653618), -INT32_C(  1099749183), -INT32_C(  1652695344),  INT32_C(  1345360237),
+         INT32_C(   310840079), -INT32_C(   911005991), -INT32_C(  1483024684),  INT32_C(   739658896),  INT32_C(  1128593813), -INT32_C(  1249725146), -INT32_C(  2057052991), -INT32_C(   306764647),
+        -INT32_C(  1039226102), -INT32_C(  1594280740),  INT32_C(   326503224),  INT32_C(  2112271382),  INT32_C(   969850110), -INT32_C(  2105869779),  INT32_C(  1029814395),  INT32_C(  1709966795),
+        -INT32_C(  1868574976), -INT32_C(   661573474),  INT32_C(  1333917055), -INT32_C(  1553577643),  INT32_C(  2140565639), -INT32_C(   945185370),  INT32_C(  1338992413),  INT32_C(  1867292307) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    int32_t r[32];
+
+    simde_memcpy(r, test_scatter_i32, sizeof(r));
+    simde_mm512_mask_i64scatter_epi32(&(r[16]), test_vec[i].k, vindex, a, 4);
+    simde_assert_equal_vi32(32, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_i64scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t vindex[8];
+    const int64_t a[8];
+    const int64_t r[32];
+  } test_vec[] = {
+    { {  INT64_C(                   2), -INT64_C(                   4),  INT64_C(                   5), -INT64_C(                   7),
+         INT64_C(                   3), -INT64_C(                   6), -INT64_C(                   3),  INT64_C(                   4) },
+      {  INT64_C( 3863080527386609410), -INT64_C( 2948917908335939444),  INT64_C( 7829171801484501485), -INT64_C( 1918207020491276050),
+         INT64_C( 6089553796482273647), -INT64_C(  452445392924491635),  INT64_C( 9016906201765785932), -INT64_C( 2818405426653074898) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C( 1918207020491276050), -INT64_C(  452445392924491635), -INT64_C(  229635990459004633),
+        -INT64_C( 2948917908335939444),  INT64_C( 9016906201765785932), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636),  INT64_C( 3863080527386609410),  INT64_C( 6089553796482273647),
+        -INT64_C( 2818405426653074898),  INT64_C( 7829171801484501485), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } },
+    { { -INT64_C(                   4),  INT64_C(                   7),  INT64_C(                   2), -INT64_C(                   3),
+         INT64_C(                   5),  INT64_C(                   6),  INT64_C(                   1), -INT64_C(                   5) },
+      {  INT64_C( 7895435437337626750), -INT64_C(  481200333946584210),  INT64_C( 7853306469113346536),  INT64_C( 5120865072113372571),
+        -INT64_C( 7700433493777858368),  INT64_C( 7477837082795590465),  INT64_C( 5158836762531872647), -INT64_C(  149109418785055176) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120), -INT64_C( 6977536476063400421), -INT64_C(  149109418785055176),
+         INT64_C( 7895435437337626750),  INT64_C( 5120865072113372571), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 5158836762531872647),  INT64_C( 7853306469113346536), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713), -INT64_C( 7700433493777858368),  INT64_C( 7477837082795590465), -INT64_C(  481200333946584210),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } },
+    { {  INT64_C(                   2),  INT64_C(                   0),  INT64_C(                   7), -INT64_C(                   6),
+         INT64_C(                   6),  INT64_C(                   5),  INT64_C(                   6),  INT64_C(                   6) },
+      { -INT64_C( 5893991299656431160),  INT64_C( 5406552643414016859), -INT64_C(  971339841911276259),  INT64_C( 7798222274682566951),
+         INT64_C( 2923719415492865173), -INT64_C( 5100338676363013364), -INT64_C( 4118836587657071446), -INT64_C( 3342101439353799485) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120),  INT64_C( 7798222274682566951), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C( 5406552643414016859),  INT64_C( 8118657907240295636), -INT64_C( 5893991299656431160), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713), -INT64_C( 5100338676363013364), -INT64_C( 3342101439353799485), -INT64_C(  971339841911276259),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } },
+    { { -INT64_C(                   7),  INT64_C(                   7), -INT64_C(                   4),  INT64_C(                   7),
+        -INT64_C(                   5),  INT64_C(                   7), -INT64_C(                   5),  INT64_C(                   7) },
+      { -INT64_C( 4440495840718955781), -INT64_C( 5525324952197417586),  INT64_C( 3350479959696752997),  INT64_C( 3086993799182363815),
+        -INT64_C(  678443991749175490),  INT64_C(   92671990004403472), -INT64_C( 1620650904143550582), -INT64_C( 4567497855094607291) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C( 4440495840718955781), -INT64_C( 6977536476063400421), -INT64_C( 1620650904143550582),
+         INT64_C( 3350479959696752997), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511), -INT64_C( 4567497855094607291),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r[32];
+
+    simde_memcpy(r, test_scatter_i64, sizeof(r));
+    simde_mm512_i64scatter_epi64(&(r[16]), vindex, a, 8);
+    simde_assert_equal_vi64(32, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_i64scatter_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[8];
+    const int64_t a[8];
+    const int64_t r[32];
+  } test_vec[] = {
+    { UINT8_C(255),
+      { -INT64_C(                   1), -INT64_C(                   3),  INT64_C(                   4),  INT64_C(                   0),
+        -INT64_C(                   5), -INT64_C(                   1), -INT64_C(                   5), -INT64_C(                   7) },
+      { -INT64_C( 3928432138659147202),  INT64_C( 4914988842432127258), -INT64_C(  996303070654644648),  INT64_C( 8797228052863178532),
+        -INT64_C( 5843878682727179382), -INT64_C( 3230210074772825539),  INT64_C( 3999005461056240457),  INT64_C( 8696484141196213375) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239),  INT64_C( 8696484141196213375), -INT64_C( 6977536476063400421),  INT64_C( 3999005461056240457),
+         INT64_C( 7525532036093015925),  INT64_C( 4914988842432127258), -INT64_C( 1229133987052756326), -INT64_C( 3230210074772825539),
+         INT64_C( 8797228052863178532),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C(  996303070654644648),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } },
+    { UINT8_C( 22),
+      {  INT64_C(                   0), -INT64_C(                   6),  INT64_C(                   5),  INT64_C(                   3),
+        -INT64_C(                   1),  INT64_C(                   7), -INT64_C(                   2),  INT64_C(                   0) },
+      { -INT64_C( 8315139078447213704),  INT64_C( 5262276948175803358), -INT64_C( 4643565931088799239),  INT64_C( 4891690547661600394),
+        -INT64_C(  207750490257451289),  INT64_C(  351554071941044746),  INT64_C( 1671557804239511102),  INT64_C(  611961667080709378) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 6178004736313058239), -INT64_C(  579521052890050120),  INT64_C( 5262276948175803358), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326), -INT64_C(  207750490257451289),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713), -INT64_C( 4643565931088799239), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } },
+    { UINT8_C(185),
+      { -INT64_C(                   2), -INT64_C(                   1),  INT64_C(                   3), -INT64_C(                   2),
+        -INT64_C(                   8),  INT64_C(                   0), -INT64_C(                   3), -INT64_C(                   7) },
+      {  INT64_C( 1194313350740414756),  INT64_C( 8712393135180062470),  INT64_C( 7048649725638702520),  INT64_C( 6727785384254679379),
+        -INT64_C( 7986645557406745407), -INT64_C( 2259563462141079560), -INT64_C( 8933151162058361881),  INT64_C( 4024136793889563456) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+        -INT64_C( 7986645557406745407),  INT64_C( 4024136793889563456), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 7525532036093015925), -INT64_C( 8879641802643455781),  INT64_C( 6727785384254679379),  INT64_C( 5709930403351575775),
+        -INT64_C( 2259563462141079560),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } },
+    { UINT8_C( 76),
+      { -INT64_C(                   3),  INT64_C(                   4), -INT64_C(                   7), -INT64_C(                   8),
+        -INT64_C(                   6), -INT64_C(                   1), -INT64_C(                   4), -INT64_C(                   4) },
+      {  INT64_C( 8933077692836033560), -INT64_C( 1015706182946662288), -INT64_C( 2518763010455940160),  INT64_C( 7706128922695655783),
+         INT64_C( 3490086933001969253), -INT64_C( 2044045841630493159),  INT64_C( 6186509162650443861), -INT64_C( 7164813085680803755) },
+      {  INT64_C( 1028018298114786158),  INT64_C( 1109066856903585640), -INT64_C( 4447920984375902666), -INT64_C( 2896957826357560630),
+         INT64_C( 6111080042498875071), -INT64_C(   81060863366811966),  INT64_C( 8192762014127093023),  INT64_C( 7528886499374654773),
+         INT64_C( 7706128922695655783), -INT64_C( 2518763010455940160), -INT64_C( 6977536476063400421), -INT64_C(  229635990459004633),
+         INT64_C( 6186509162650443861), -INT64_C( 8879641802643455781), -INT64_C( 1229133987052756326),  INT64_C( 5709930403351575775),
+         INT64_C(  667667952135182694),  INT64_C( 8118657907240295636), -INT64_C( 7360632097894753427), -INT64_C( 1774777017819125221),
+        -INT64_C( 4207208646129977713),  INT64_C( 7905224152794973602), -INT64_C( 8276905840325447511), -INT64_C( 3740680337104392824),
+         INT64_C( 6539278584911493843), -INT64_C( 2264795002708770330),  INT64_C( 4356444333864162789),  INT64_C( 4481670887097906574),
+         INT64_C( 4574634291913017957), -INT64_C( 8755769881111927631),  INT64_C( 3921866937951841336), -INT64_C( 1871518200547373600) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    int64_t r[32];
+
+    simde_memcpy(r, test_scatter_i64, sizeof(r));
+    simde_mm512_mask_i64scatter_epi64(&(r[16]), test_vec[i].k, vindex, a, 8);
+    simde_assert_equal_vi64(32, r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_i64scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t vindex[8];
+    const simde_float64 a[8];
+    const simde_float64 r[32];
+  } test_vec[] = {
+    { {  INT64_C(                   3),  INT64_C(                   0),  INT64_C(                   1), -INT64_C(                   4),
+         INT64_C(                   5), -INT64_C(                   2), -INT64_C(                   5),  INT64_C(                   1) },
+      { SIMDE_FLOAT64_C(  -436.45), SIMDE_FLOAT64_C(   730.39), SIMDE_FLOAT64_C(  -888.99), SIMDE_FLOAT64_C(  -335.21),
+        SIMDE_FLOAT64_C(    94.50), SIMDE_FLOAT64_C(  -795.72), SIMDE_FLOAT64_C(   936.93), SIMDE_FLOAT64_C(  -932.57) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   936.93),
+        SIMDE_FLOAT64_C(  -335.21), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(  -795.72), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(   730.39), SIMDE_FLOAT64_C(  -932.57), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(  -436.45),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(    94.50), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } },
+    { {  INT64_C(                   6),  INT64_C(                   4),  INT64_C(                   3),  INT64_C(                   4),
+         INT64_C(                   5),  INT64_C(                   6),  INT64_C(                   7), -INT64_C(                   5) },
+      { SIMDE_FLOAT64_C(   152.76), SIMDE_FLOAT64_C(  -663.67), SIMDE_FLOAT64_C(   381.29), SIMDE_FLOAT64_C(   -20.07),
+        SIMDE_FLOAT64_C(    73.48), SIMDE_FLOAT64_C(   221.60), SIMDE_FLOAT64_C(  -336.33), SIMDE_FLOAT64_C(   638.04) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   638.04),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   381.29),
+        SIMDE_FLOAT64_C(   -20.07), SIMDE_FLOAT64_C(    73.48), SIMDE_FLOAT64_C(   221.60), SIMDE_FLOAT64_C(  -336.33),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } },
+    { { -INT64_C(                   8),  INT64_C(                   0),  INT64_C(                   2), -INT64_C(                   1),
+         INT64_C(                   7),  INT64_C(                   6), -INT64_C(                   5),  INT64_C(                   7) },
+      { SIMDE_FLOAT64_C(  -545.16), SIMDE_FLOAT64_C(   510.97), SIMDE_FLOAT64_C(  -223.63), SIMDE_FLOAT64_C(  -152.01),
+        SIMDE_FLOAT64_C(  -285.72), SIMDE_FLOAT64_C(  -327.41), SIMDE_FLOAT64_C(   629.47), SIMDE_FLOAT64_C(  -538.83) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(  -545.16), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   629.47),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(  -152.01),
+        SIMDE_FLOAT64_C(   510.97), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -223.63), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(  -327.41), SIMDE_FLOAT64_C(  -538.83),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } },
+    { {  INT64_C(                   0),  INT64_C(                   0), -INT64_C(                   8), -INT64_C(                   6),
+         INT64_C(                   5),  INT64_C(                   3), -INT64_C(                   3),  INT64_C(                   7) },
+      { SIMDE_FLOAT64_C(   510.15), SIMDE_FLOAT64_C(  -969.43), SIMDE_FLOAT64_C(  -127.03), SIMDE_FLOAT64_C(   395.84),
+        SIMDE_FLOAT64_C(  -482.72), SIMDE_FLOAT64_C(    -0.41), SIMDE_FLOAT64_C(   452.84), SIMDE_FLOAT64_C(    85.82) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(  -127.03), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   395.84), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(   452.84), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -969.43), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(    -0.41),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -482.72), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(    85.82),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_float64 r[32];
+
+    simde_memcpy(r, test_scatter_f64, sizeof(r));
+    simde_mm512_i64scatter_pd(&(r[16]), vindex, a, 8);
+    simde_assert_equal_vf64(32, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_i64scatter_pd (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[8];
+    const simde_float64 a[8];
+    const simde_float64 r[32];
+  } test_vec[] = {
+    { UINT8_C(255),
+      {  INT64_C(                   1), -INT64_C(                   4), -INT64_C(                   4), -INT64_C(                   2),
+        -INT64_C(                   7),  INT64_C(                   3), -INT64_C(                   3),  INT64_C(                   2) },
+      { SIMDE_FLOAT64_C(   650.57), SIMDE_FLOAT64_C(    92.51), SIMDE_FLOAT64_C(  -738.34), SIMDE_FLOAT64_C(  -995.50),
+        SIMDE_FLOAT64_C(   716.66), SIMDE_FLOAT64_C(  -784.91), SIMDE_FLOAT64_C(  -258.80), SIMDE_FLOAT64_C(   814.59) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   716.66), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -738.34), SIMDE_FLOAT64_C(  -258.80), SIMDE_FLOAT64_C(  -995.50), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(   650.57), SIMDE_FLOAT64_C(   814.59), SIMDE_FLOAT64_C(  -784.91),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } },
+    { UINT8_C(184),
+      { -INT64_C(                   7),  INT64_C(                   3), -INT64_C(                   2), -INT64_C(                   1),
+         INT64_C(                   3),  INT64_C(                   2), -INT64_C(                   7), -INT64_C(                   8) },
+      { SIMDE_FLOAT64_C(   660.19), SIMDE_FLOAT64_C(    54.67), SIMDE_FLOAT64_C(   803.09), SIMDE_FLOAT64_C(   777.91),
+        SIMDE_FLOAT64_C(    58.72), SIMDE_FLOAT64_C(  -258.69), SIMDE_FLOAT64_C(  -789.28), SIMDE_FLOAT64_C(   826.93) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   826.93), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   777.91),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -258.69), SIMDE_FLOAT64_C(    58.72),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } },
+    { UINT8_C(197),
+      {  INT64_C(                   7), -INT64_C(                   1),  INT64_C(                   5),  INT64_C(                   1),
+         INT64_C(                   2), -INT64_C(                   3), -INT64_C(                   8),  INT64_C(                   7) },
+      { SIMDE_FLOAT64_C(  -282.82), SIMDE_FLOAT64_C(  -470.94), SIMDE_FLOAT64_C(   299.10), SIMDE_FLOAT64_C(   756.63),
+        SIMDE_FLOAT64_C(  -541.68), SIMDE_FLOAT64_C(  -411.03), SIMDE_FLOAT64_C(   536.65), SIMDE_FLOAT64_C(   283.42) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   536.65), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(  -737.77), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(   299.10), SIMDE_FLOAT64_C(   736.90), SIMDE_FLOAT64_C(   283.42),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } },
+    { UINT8_C(  5),
+      {  INT64_C(                   2),  INT64_C(                   4),  INT64_C(                   6),  INT64_C(                   1),
+         INT64_C(                   5),  INT64_C(                   5),  INT64_C(                   7), -INT64_C(                   4) },
+      { SIMDE_FLOAT64_C(   -13.91), SIMDE_FLOAT64_C(  -295.30), SIMDE_FLOAT64_C(   273.91), SIMDE_FLOAT64_C(   600.46),
+        SIMDE_FLOAT64_C(  -492.48), SIMDE_FLOAT64_C(   372.42), SIMDE_FLOAT64_C(   121.75), SIMDE_FLOAT64_C(   871.10) },
+      { SIMDE_FLOAT64_C(   813.34), SIMDE_FLOAT64_C(  -601.77), SIMDE_FLOAT64_C(   280.47), SIMDE_FLOAT64_C(  -605.67),
+        SIMDE_FLOAT64_C(   -16.71), SIMDE_FLOAT64_C(   806.65), SIMDE_FLOAT64_C(   318.63), SIMDE_FLOAT64_C(    19.92),
+        SIMDE_FLOAT64_C(   651.31), SIMDE_FLOAT64_C(   502.91), SIMDE_FLOAT64_C(   554.32), SIMDE_FLOAT64_C(   860.93),
+        SIMDE_FLOAT64_C(  -964.49), SIMDE_FLOAT64_C(  -718.04), SIMDE_FLOAT64_C(   369.26), SIMDE_FLOAT64_C(   491.09),
+        SIMDE_FLOAT64_C(  -587.14), SIMDE_FLOAT64_C(    39.93), SIMDE_FLOAT64_C(   -13.91), SIMDE_FLOAT64_C(   246.88),
+        SIMDE_FLOAT64_C(   152.40), SIMDE_FLOAT64_C(  -143.45), SIMDE_FLOAT64_C(   273.91), SIMDE_FLOAT64_C(  -105.40),
+        SIMDE_FLOAT64_C(   450.68), SIMDE_FLOAT64_C(  -367.71), SIMDE_FLOAT64_C(  -541.16), SIMDE_FLOAT64_C(   318.23),
+        SIMDE_FLOAT64_C(  -158.39), SIMDE_FLOAT64_C(  -955.92), SIMDE_FLOAT64_C(  -700.22), SIMDE_FLOAT64_C(  -550.50) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m512d a = simde_mm512_loadu_pd(test_vec[i].a);
+    simde_float64 r[32];
+
+    simde_memcpy(r, test_scatter_f64, sizeof(r));
+    simde_mm512_mask_i64scatter_pd(&(r[16]), test_vec[i].k, vindex, a, 8);
+    simde_assert_equal_vf64(32, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_i64scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t vindex[8];
+    const simde_float32 a[8];
+    const simde_float32 r[32];
+  } test_vec[] = {
+    { {  INT64_C(                   2),  INT64_C(                   3),  INT64_C(                   0),  INT64_C(                   6),
+        -INT64_C(                   8), -INT64_C(                   6), -INT64_C(                   2),  INT64_C(                   4) },
+      { SIMDE_FLOAT32_C(   972.39), SIMDE_FLOAT32_C(   137.86), SIMDE_FLOAT32_C(    52.49), SIMDE_FLOAT32_C(  -319.38),
+        SIMDE_FLOAT32_C(   601.68), SIMDE_FLOAT32_C(  -295.35), SIMDE_FLOAT32_C(   388.23), SIMDE_FLOAT32_C(  -150.86) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   601.68), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -295.35), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   388.23), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(    52.49), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   972.39), SIMDE_FLOAT32_C(   137.86),
+        SIMDE_FLOAT32_C(  -150.86), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -319.38), SIMDE_FLOAT32_C(  -367.96),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { { -INT64_C(                   7),  INT64_C(                   2),  INT64_C(                   7), -INT64_C(                   4),
+         INT64_C(                   4), -INT64_C(                   8),  INT64_C(                   5),  INT64_C(                   6) },
+      { SIMDE_FLOAT32_C(   512.85), SIMDE_FLOAT32_C(   498.80), SIMDE_FLOAT32_C(   716.26), SIMDE_FLOAT32_C(   309.34),
+        SIMDE_FLOAT32_C(  -808.85), SIMDE_FLOAT32_C(  -937.33), SIMDE_FLOAT32_C(  -732.96), SIMDE_FLOAT32_C(  -835.74) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(  -937.33), SIMDE_FLOAT32_C(   512.85), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   309.34), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   498.80), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(  -808.85), SIMDE_FLOAT32_C(  -732.96), SIMDE_FLOAT32_C(  -835.74), SIMDE_FLOAT32_C(   716.26),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { { -INT64_C(                   1), -INT64_C(                   8), -INT64_C(                   8),  INT64_C(                   7),
+         INT64_C(                   1),  INT64_C(                   5),  INT64_C(                   5), -INT64_C(                   4) },
+      { SIMDE_FLOAT32_C(   459.13), SIMDE_FLOAT32_C(   888.77), SIMDE_FLOAT32_C(   281.82), SIMDE_FLOAT32_C(  -673.76),
+        SIMDE_FLOAT32_C(   187.76), SIMDE_FLOAT32_C(   920.48), SIMDE_FLOAT32_C(   -61.79), SIMDE_FLOAT32_C(  -279.68) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   281.82), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(  -279.68), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(   459.13),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(   187.76), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(   -61.79), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -673.76),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { {  INT64_C(                   5), -INT64_C(                   1), -INT64_C(                   7), -INT64_C(                   8),
+        -INT64_C(                   4), -INT64_C(                   3), -INT64_C(                   1),  INT64_C(                   0) },
+      { SIMDE_FLOAT32_C(  -454.11), SIMDE_FLOAT32_C(   745.33), SIMDE_FLOAT32_C(   592.80), SIMDE_FLOAT32_C(  -782.81),
+        SIMDE_FLOAT32_C(  -736.83), SIMDE_FLOAT32_C(  -160.26), SIMDE_FLOAT32_C(   390.12), SIMDE_FLOAT32_C(  -788.21) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(  -782.81), SIMDE_FLOAT32_C(   592.80), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(  -736.83), SIMDE_FLOAT32_C(  -160.26), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(   390.12),
+        SIMDE_FLOAT32_C(  -788.21), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -454.11), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -367.96),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde_float32 r[32];
+
+    simde_memcpy(r, test_scatter_f32, sizeof(r));
+    simde_mm512_i64scatter_ps(&(r[16]), vindex, a, 4);
+    simde_assert_equal_vf32(32, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_i64scatter_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t vindex[8];
+    const simde_float32 a[8];
+    const simde_float32 r[32];
+  } test_vec[] = {
+    { UINT8_C(255),
+      { -INT64_C(                   3), -INT64_C(                   7),  INT64_C(                   1),  INT64_C(                   7),
+        -INT64_C(                   7), -INT64_C(                   4), -INT64_C(                   5), -INT64_C(                   1) },
+      { SIMDE_FLOAT32_C(  -884.34), SIMDE_FLOAT32_C(  -763.66), SIMDE_FLOAT32_C(  -330.67), SIMDE_FLOAT32_C(   731.85),
+        SIMDE_FLOAT32_C(  -171.98), SIMDE_FLOAT32_C(   496.36), SIMDE_FLOAT32_C(  -357.06), SIMDE_FLOAT32_C(  -734.35) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(  -171.98), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(  -357.06),
+        SIMDE_FLOAT32_C(   496.36), SIMDE_FLOAT32_C(  -884.34), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -734.35),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(  -330.67), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(   731.85),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { UINT8_C(254),
+      { -INT64_C(                   7),  INT64_C(                   2), -INT64_C(                   6),  INT64_C(                   0),
+         INT64_C(                   7), -INT64_C(                   4),  INT64_C(                   3), -INT64_C(                   1) },
+      { SIMDE_FLOAT32_C(   849.61), SIMDE_FLOAT32_C(   742.48), SIMDE_FLOAT32_C(  -362.10), SIMDE_FLOAT32_C(   366.21),
+        SIMDE_FLOAT32_C(  -259.30), SIMDE_FLOAT32_C(  -714.64), SIMDE_FLOAT32_C(   601.96), SIMDE_FLOAT32_C(  -234.11) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -362.10), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(  -714.64), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -234.11),
+        SIMDE_FLOAT32_C(   366.21), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   742.48), SIMDE_FLOAT32_C(   601.96),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -259.30),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { UINT8_C(162),
+      { -INT64_C(                   1),  INT64_C(                   6),  INT64_C(                   4),  INT64_C(                   7),
+        -INT64_C(                   2),  INT64_C(                   7),  INT64_C(                   0),  INT64_C(                   5) },
+      { SIMDE_FLOAT32_C(  -620.85), SIMDE_FLOAT32_C(   688.95), SIMDE_FLOAT32_C(    57.30), SIMDE_FLOAT32_C(  -436.31),
+        SIMDE_FLOAT32_C(   848.40), SIMDE_FLOAT32_C(   284.27), SIMDE_FLOAT32_C(  -906.73), SIMDE_FLOAT32_C(  -593.27) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -986.44), SIMDE_FLOAT32_C(   882.47), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(  -559.67), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -739.50),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -593.27), SIMDE_FLOAT32_C(   688.95), SIMDE_FLOAT32_C(   284.27),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } },
+    { UINT8_C( 95),
+      {  INT64_C(                   0),  INT64_C(                   3), -INT64_C(                   3),  INT64_C(                   0),
+        -INT64_C(                   2), -INT64_C(                   3), -INT64_C(                   2), -INT64_C(                   8) },
+      { SIMDE_FLOAT32_C(   164.59), SIMDE_FLOAT32_C(  -177.17), SIMDE_FLOAT32_C(  -625.57), SIMDE_FLOAT32_C(  -183.43),
+        SIMDE_FLOAT32_C(   957.08), SIMDE_FLOAT32_C(  -368.38), SIMDE_FLOAT32_C(   536.97), SIMDE_FLOAT32_C(   257.48) },
+      { SIMDE_FLOAT32_C(   606.99), SIMDE_FLOAT32_C(  -255.44), SIMDE_FLOAT32_C(   562.62), SIMDE_FLOAT32_C(  -334.57),
+        SIMDE_FLOAT32_C(   581.17), SIMDE_FLOAT32_C(   782.02), SIMDE_FLOAT32_C(   508.01), SIMDE_FLOAT32_C(   456.08),
+        SIMDE_FLOAT32_C(   496.86), SIMDE_FLOAT32_C(   626.68), SIMDE_FLOAT32_C(  -746.30), SIMDE_FLOAT32_C(   559.10),
+        SIMDE_FLOAT32_C(   752.01), SIMDE_FLOAT32_C(  -625.57), SIMDE_FLOAT32_C(   536.97), SIMDE_FLOAT32_C(  -443.95),
+        SIMDE_FLOAT32_C(  -183.43), SIMDE_FLOAT32_C(    37.60), SIMDE_FLOAT32_C(   179.97), SIMDE_FLOAT32_C(  -177.17),
+        SIMDE_FLOAT32_C(   300.10), SIMDE_FLOAT32_C(  -432.18), SIMDE_FLOAT32_C(  -755.92), SIMDE_FLOAT32_C(  -367.96),
+        SIMDE_FLOAT32_C(  -304.65), SIMDE_FLOAT32_C(   -81.84), SIMDE_FLOAT32_C(  -349.01), SIMDE_FLOAT32_C(  -371.72),
+        SIMDE_FLOAT32_C(  -413.67), SIMDE_FLOAT32_C(  -159.76), SIMDE_FLOAT32_C(   -19.28), SIMDE_FLOAT32_C(   112.55) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i vindex = simde_mm512_loadu_epi64(test_vec[i].vindex);
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde_float32 r[32];
+
+    simde_memcpy(r, test_scatter_f32, sizeof(r));
+    simde_mm512_mask_i64scatter_ps(&(r[16]), test_vec[i].k, vindex, a, 4);
+    simde_assert_equal_vf32(32, r, test_vec[i].r, 1);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_i32scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_i32scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_i32scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_i32scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_i32scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_i32scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_i32scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_i32scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_i64scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_i64scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_i64scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_i64scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_i64scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_i64scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_i64scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_i64scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_i32scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_i32scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_i32scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_i32scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_i32scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_i32scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_i32scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_i32scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_i64scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_i64scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_i64scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_i64scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_i64scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_i64scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_i64scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_i64scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i32scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i32scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i32scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i32scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i32scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i32scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i32scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i32scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i64scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i64scatter_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i64scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i64scatter_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i64scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i64scatter_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_i64scatter_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_i64scatter_ps)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
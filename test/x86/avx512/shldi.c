@@ -0,0 +1,1954 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+#define SIMDE_TEST_X86_AVX512_INSN shldi
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/shldi.h>
+
+static int
+test_simde_mm_shldi_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t a[8];
+    const int16_t b[8];
+    const int16_t r[8];
+  } test_vec[] = {
+    { { -INT16_C( 18464), -INT16_C( 29130), -INT16_C( 12095),  INT16_C(  3949), -INT16_C( 11047), -INT16_C( 27271), -INT16_C( 13274),  INT16_C(  2751) },
+      { -INT16_C(  6632), -INT16_C( 23185), -INT16_C( 28198),  INT16_C( 13896),  INT16_C( 23084), -INT16_C(  7738),  INT16_C(  6092), -INT16_C( 32459) },
+      { -INT16_C(   996), -INT16_C( 14636),  INT16_C(  6194), -INT16_C(  4698), -INT16_C( 25813), -INT16_C( 20676), -INT16_C( 31550),  INT16_C( 22512) } },
+    { {  INT16_C(  4006), -INT16_C( 20223), -INT16_C( 31788),  INT16_C( 24648),  INT16_C( 25616), -INT16_C( 23064),  INT16_C(  7194),  INT16_C(  8172) },
+      { -INT16_C( 27120), -INT16_C( 14653), -INT16_C( 10001),  INT16_C(  8347),  INT16_C(  9692), -INT16_C( 21247), -INT16_C( 14320),  INT16_C( 23201) },
+      { -INT16_C(  2862),  INT16_C(  8248),  INT16_C( 31387),  INT16_C(  2308), -INT16_C( 32252), -INT16_C( 17131), -INT16_C( 31911), -INT16_C(   629) } },
+    { { -INT16_C(  3943), -INT16_C(  6005), -INT16_C( 30533), -INT16_C(  9519), -INT16_C( 22841),  INT16_C( 27853), -INT16_C( 23048),  INT16_C( 27228) },
+      {  INT16_C( 11425), -INT16_C(  9794), -INT16_C( 28626), -INT16_C( 19283), -INT16_C( 11099), -INT16_C( 24819),  INT16_C( 13726),  INT16_C( 20117) },
+      {  INT16_C(  4901),  INT16_C(  4475),  INT16_C(  6002),  INT16_C( 23094), -INT16_C(  9990), -INT16_C( 26189), -INT16_C( 16634),  INT16_C( 19337) } },
+    { {  INT16_C(  8407), -INT16_C( 14960),  INT16_C(  2452), -INT16_C( 18275),  INT16_C(  2269), -INT16_C(  6538),  INT16_C( 31575),  INT16_C(  9461) },
+      { -INT16_C( 20522), -INT16_C( 30230),  INT16_C(  7706), -INT16_C(  5636),  INT16_C( 25030),  INT16_C( 25747),  INT16_C( 17356), -INT16_C( 31493) },
+      {  INT16_C(  6901), -INT16_C( 19951),  INT16_C( 12931),  INT16_C(  5053),  INT16_C(  7084), -INT16_C( 12596),  INT16_C( 27368), -INT16_C( 24912) } },
+    { { -INT16_C( 22064), -INT16_C(  6578), -INT16_C(  6885), -INT16_C(  7688), -INT16_C(  5710),  INT16_C( 21376),  INT16_C(   695),  INT16_C( 28284) },
+      {  INT16_C(  4785), -INT16_C( 10742),  INT16_C( 23263),  INT16_C( 30244), -INT16_C(  6716),  INT16_C( 24114), -INT16_C( 18338),  INT16_C( 23911) },
+      {  INT16_C( 14850), -INT16_C( 13862), -INT16_C( 23701),  INT16_C( 16142),  INT16_C( 13916),  INT16_C( 28683),  INT16_C( 22263), -INT16_C( 12405) } },
+    { {  INT16_C( 15141), -INT16_C( 22757),  INT16_C(  6538), -INT16_C( 24783),  INT16_C( 27560),  INT16_C(  8939),  INT16_C( 19844),  INT16_C(  7471) },
+      {  INT16_C( 31595), -INT16_C( 25455),  INT16_C( 14147),  INT16_C( 14013),  INT16_C( 22582), -INT16_C( 18868),  INT16_C( 22785), -INT16_C(  2341) },
+      {  INT16_C( 25775), -INT16_C(  7309),  INT16_C( 12614), -INT16_C(  6618),  INT16_C( 29963),  INT16_C( 23926), -INT16_C( 20341), -INT16_C( 23042) } },
+    { { -INT16_C( 11176), -INT16_C( 16227),  INT16_C(  8947),  INT16_C(  4118), -INT16_C( 14954),  INT16_C( 11376), -INT16_C(  6668), -INT16_C( 16790) },
+      { -INT16_C(  8772), -INT16_C( 26146),  INT16_C( 31662), -INT16_C( 20691),  INT16_C( 31624), -INT16_C( 17107),  INT16_C( 17972),  INT16_C( 20950) },
+      { -INT16_C( 29925),  INT16_C(  5043),  INT16_C( 24175),  INT16_C(   725), -INT16_C( 19761), -INT16_C( 29161), -INT16_C( 16760), -INT16_C( 12982) } },
+    { { -INT16_C( 23383), -INT16_C( 15197),  INT16_C( 10383), -INT16_C( 17796), -INT16_C( 13553), -INT16_C(   414),  INT16_C( 28011),  INT16_C(   181) },
+      {  INT16_C( 15458),  INT16_C( 28110), -INT16_C(   815),  INT16_C(  7015), -INT16_C( 27359),  INT16_C( 28216),  INT16_C( 17518),  INT16_C( 26036) },
+      { -INT16_C( 27353), -INT16_C( 27539),  INT16_C(  4607),  INT16_C( 20355),  INT16_C( 25074), -INT16_C( 13235), -INT16_C( 21144),  INT16_C(  5804) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi16(test_vec[i].b);
+    simde__m128i r = simde_mm_shldi_epi16(a, b, INT32_C(  5));
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_shldi_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[8];
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t b[8];
+    const int16_t r[8];
+  } test_vec[] = {
+    { { -INT16_C( 15205), -INT16_C( 14661), -INT16_C( 23903), -INT16_C( 28477), -INT16_C( 24387), -INT16_C( 29349), -INT16_C(  8262), -INT16_C(  4204) },
+      UINT8_C(254),
+      { -INT16_C( 23512), -INT16_C( 18123), -INT16_C( 28744),  INT16_C(  8282), -INT16_C( 28142), -INT16_C(  8403),  INT16_C( 14894), -INT16_C( 13200) },
+      {  INT16_C( 23520), -INT16_C( 24861), -INT16_C( 28419), -INT16_C(  6377),  INT16_C(  6268),  INT16_C( 28114),  INT16_C( 16693),  INT16_C( 11575) },
+      { -INT16_C( 15205),  INT16_C(  9907), -INT16_C(  2286),  INT16_C(  2908),  INT16_C( 16963), -INT16_C(  6739),  INT16_C( 17864), -INT16_C( 29179) } },
+    { { -INT16_C( 28889), -INT16_C(  1978),  INT16_C(  9401), -INT16_C( 18426), -INT16_C( 16045), -INT16_C(  6152), -INT16_C( 31168), -INT16_C(  1257) },
+      UINT8_C( 11),
+      { -INT16_C(   994), -INT16_C(   837), -INT16_C(  8451), -INT16_C( 15553), -INT16_C( 21442),  INT16_C(  1401), -INT16_C( 31553),  INT16_C(   891) },
+      { -INT16_C( 11312),  INT16_C(  9616), -INT16_C( 21743),  INT16_C( 14246), -INT16_C( 25877), -INT16_C( 20335),  INT16_C(  9925), -INT16_C( 18838) },
+      { -INT16_C( 31782), -INT16_C( 26780),  INT16_C(  9401),  INT16_C( 26598), -INT16_C( 16045), -INT16_C(  6152), -INT16_C( 31168), -INT16_C(  1257) } },
+    { { -INT16_C( 10381), -INT16_C( 15874), -INT16_C(  4568),  INT16_C(  5805), -INT16_C( 15240), -INT16_C(  3795),  INT16_C( 29226), -INT16_C( 24616) },
+      UINT8_C(180),
+      { -INT16_C( 16388),  INT16_C( 30806), -INT16_C(  2536), -INT16_C( 21257), -INT16_C( 28537), -INT16_C( 29363), -INT16_C( 29770), -INT16_C( 31758) },
+      { -INT16_C( 19026), -INT16_C( 29220), -INT16_C( 11214), -INT16_C( 12041),  INT16_C( 16723), -INT16_C( 25765), -INT16_C( 23164),  INT16_C(  2106) },
+      { -INT16_C( 10381), -INT16_C( 15874), -INT16_C( 15590),  INT16_C(  5805),  INT16_C(  4328), -INT16_C( 22093),  INT16_C( 29226),  INT16_C( 32321) } },
+    { { -INT16_C( 31611),  INT16_C(  2321),  INT16_C( 21187),  INT16_C( 14240),  INT16_C( 26299),  INT16_C(  6046),  INT16_C(  1723), -INT16_C( 26190) },
+      UINT8_C( 29),
+      { -INT16_C( 12748), -INT16_C( 21825), -INT16_C(  3861), -INT16_C(  6903), -INT16_C( 27540),  INT16_C( 21189), -INT16_C( 22570),  INT16_C( 15764) },
+      {  INT16_C( 19422), -INT16_C( 11133),  INT16_C( 19799),  INT16_C(   877),  INT16_C( 11611), -INT16_C( 30989),  INT16_C( 15011), -INT16_C( 16496) },
+      { -INT16_C( 14711),  INT16_C(  2321),  INT16_C(  7529), -INT16_C( 24288), -INT16_C( 29307),  INT16_C(  6046),  INT16_C(  1723), -INT16_C( 26190) } },
+    { {  INT16_C(  4596), -INT16_C( 13989), -INT16_C( 19572),  INT16_C(   622), -INT16_C( 19886), -INT16_C( 14059), -INT16_C( 21580),  INT16_C( 21576) },
+      UINT8_C(139),
+      { -INT16_C( 25299), -INT16_C(  9728), -INT16_C(   649), -INT16_C(  5606), -INT16_C( 26355),  INT16_C( 27658), -INT16_C( 18504), -INT16_C( 12174) },
+      { -INT16_C( 18215), -INT16_C( 11611), -INT16_C(  2921), -INT16_C( 16703), -INT16_C(  7467), -INT16_C( 28963),  INT16_C(  1351), -INT16_C( 27843) },
+      { -INT16_C( 23113),  INT16_C( 16410), -INT16_C( 19572),  INT16_C( 17239), -INT16_C( 19886), -INT16_C( 14059), -INT16_C( 21580),  INT16_C(  3666) } },
+    { { -INT16_C(  4132),  INT16_C( 16432), -INT16_C( 25126),  INT16_C( 19372), -INT16_C( 30031), -INT16_C( 25963),  INT16_C(  7365),  INT16_C( 25986) },
+      UINT8_C(243),
+      { -INT16_C( 19163),  INT16_C(   114), -INT16_C( 16306),  INT16_C(  4327), -INT16_C( 17886), -INT16_C( 14491), -INT16_C(  5672), -INT16_C( 10774) },
+      {  INT16_C( 31630), -INT16_C(  5257),  INT16_C(  1566), -INT16_C( 29124),  INT16_C( 26491),  INT16_C( 20233), -INT16_C(  3889),  INT16_C(  7435) },
+      { -INT16_C( 23377),  INT16_C(  3677), -INT16_C( 25126),  INT16_C( 19372),  INT16_C( 17484), -INT16_C(  4951),  INT16_C( 15134), -INT16_C( 17085) } },
+    { { -INT16_C( 16635),  INT16_C( 16902),  INT16_C( 16270), -INT16_C(  1907), -INT16_C( 23337),  INT16_C( 29361),  INT16_C(  6716), -INT16_C( 25566) },
+      UINT8_C(194),
+      { -INT16_C( 13882),  INT16_C( 26528), -INT16_C( 19287), -INT16_C( 13167), -INT16_C(  9567),  INT16_C(   721),  INT16_C(  6182),  INT16_C( 30102) },
+      {  INT16_C( 21086),  INT16_C(  9616),  INT16_C(  8861), -INT16_C( 22502),  INT16_C( 26427), -INT16_C( 11069), -INT16_C( 32417),  INT16_C( 22128) },
+      { -INT16_C( 16635), -INT16_C(  3068),  INT16_C( 16270), -INT16_C(  1907), -INT16_C( 23337),  INT16_C( 29361),  INT16_C(  1232), -INT16_C( 19766) } },
+    { {  INT16_C( 18880), -INT16_C(  1157), -INT16_C( 30096), -INT16_C( 13673), -INT16_C( 21653),  INT16_C( 10270),  INT16_C(  4730), -INT16_C(  4578) },
+      UINT8_C(133),
+      {  INT16_C( 13720),  INT16_C(  7415),  INT16_C(  6042), -INT16_C( 20751),  INT16_C(  2813),  INT16_C( 24010),  INT16_C( 16005), -INT16_C( 28038) },
+      { -INT16_C( 31487),  INT16_C( 12694), -INT16_C( 25865), -INT16_C( 11021),  INT16_C( 12051), -INT16_C( 10935),  INT16_C( 27702), -INT16_C( 32294) },
+      { -INT16_C( 19696), -INT16_C(  1157), -INT16_C(  3245), -INT16_C( 13673), -INT16_C( 21653),  INT16_C( 10270),  INT16_C(  4730),  INT16_C( 20304) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi16(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi16(test_vec[i].b);
+    simde__m128i r = simde_mm_mask_shldi_epi16(src, test_vec[i].k, a, b, INT32_C( 37));
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_shldi_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int16_t a[8];
+    const int16_t b[8];
+    const int16_t r[8];
+  } test_vec[] = {
+    { UINT8_C( 31),
+      { -INT16_C(  7299), -INT16_C( 20958), -INT16_C( 20653),  INT16_C( 13876), -INT16_C( 14882),  INT16_C( 21116),  INT16_C( 15426),  INT16_C( 21942) },
+      {  INT16_C(  1167),  INT16_C( 27680), -INT16_C( 10326), -INT16_C( 16852),  INT16_C(  7499), -INT16_C( 15597), -INT16_C(  6554),  INT16_C( 16597) },
+      { -INT16_C(  8383), -INT16_C( 30565), -INT16_C( 11019), -INT16_C( 29393),  INT16_C( 30599),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(139),
+      {  INT16_C( 24672), -INT16_C( 13428),  INT16_C( 26634), -INT16_C(  3116),  INT16_C( 30730), -INT16_C( 21502),  INT16_C( 24905), -INT16_C( 25861) },
+      {  INT16_C(  3080), -INT16_C( 14824), -INT16_C(   781), -INT16_C(  3375),  INT16_C( 25357), -INT16_C( 13639),  INT16_C( 13549), -INT16_C( 20552) },
+      {  INT16_C(  6147), -INT16_C(  7375),  INT16_C(     0), -INT16_C(  2756),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 16661) } },
+    { UINT8_C( 38),
+      {  INT16_C( 31670), -INT16_C( 20301), -INT16_C(  8495),  INT16_C( 20225), -INT16_C(   865),  INT16_C( 13519),  INT16_C( 28032),  INT16_C( 23699) },
+      {  INT16_C(  4911), -INT16_C( 24903),  INT16_C( 15521),  INT16_C( 31318),  INT16_C( 27668),  INT16_C( 28626),  INT16_C(  7917),  INT16_C( 18324) },
+      {  INT16_C(     0),  INT16_C( 11495), -INT16_C( 19377),  INT16_C(     0),  INT16_C(     0),  INT16_C( 13275),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT8_C(204),
+      {  INT16_C( 31003), -INT16_C( 12153),  INT16_C(   865),  INT16_C( 10397), -INT16_C( 31794),  INT16_C( 30776), -INT16_C( 16792),  INT16_C(   241) },
+      { -INT16_C( 18836), -INT16_C(  9489),  INT16_C( 20105),  INT16_C( 13362), -INT16_C( 27604), -INT16_C(  4949),  INT16_C( 25351), -INT16_C( 24281) },
+      {  INT16_C(     0),  INT16_C(     0), -INT16_C( 10157),  INT16_C( 10061),  INT16_C(     0),  INT16_C(     0), -INT16_C( 26088),  INT16_C( 15464) } },
+    { UINT8_C(235),
+      {  INT16_C( 14954), -INT16_C(  1490),  INT16_C( 32067), -INT16_C(  6883), -INT16_C(  1488),  INT16_C(  5291), -INT16_C( 26588),  INT16_C( 22257) },
+      {  INT16_C(  1046), -INT16_C( 12198),  INT16_C( 15041),  INT16_C( 28790),  INT16_C(  5138),  INT16_C( 21940),  INT16_C( 32433),  INT16_C( 28034) },
+      { -INT16_C( 25983), -INT16_C( 29772),  INT16_C(     0),  INT16_C( 18268),  INT16_C(     0),  INT16_C( 10965),  INT16_C(  2335), -INT16_C( 17317) } },
+    { UINT8_C(171),
+      { -INT16_C(  9126),  INT16_C( 25381), -INT16_C( 24317),  INT16_C( 14212), -INT16_C( 25781),  INT16_C( 29650),  INT16_C( 31939), -INT16_C( 28226) },
+      { -INT16_C(  9674),  INT16_C(  1191),  INT16_C( 11232), -INT16_C( 16713),  INT16_C(  4897),  INT16_C( 11541),  INT16_C( 32581),  INT16_C(  1197) },
+      {  INT16_C(  5814), -INT16_C( 14015),  INT16_C(     0), -INT16_C(  7889),  INT16_C(     0), -INT16_C(  2933),  INT16_C(     0),  INT16_C( 28545) } },
+    { UINT8_C(165),
+      {  INT16_C( 20068), -INT16_C(  6548),  INT16_C(  2797), -INT16_C( 25646), -INT16_C( 22518),  INT16_C(  2421),  INT16_C( 18617), -INT16_C( 29076) },
+      { -INT16_C(  5740),  INT16_C( 11712),  INT16_C( 23309),  INT16_C(  6881), -INT16_C(  6700),  INT16_C( 17338),  INT16_C( 19775), -INT16_C( 13633) },
+      { -INT16_C( 26310),  INT16_C(     0), -INT16_C( 17578),  INT16_C(     0),  INT16_C(     0),  INT16_C( 23888),  INT16_C(     0), -INT16_C( 25806) } },
+    { UINT8_C(240),
+      {  INT16_C(  5909), -INT16_C( 29845),  INT16_C( 18856), -INT16_C( 17773),  INT16_C(  2907), -INT16_C(  4919),  INT16_C(  7029), -INT16_C( 26925) },
+      { -INT16_C(  8080),  INT16_C( 18165),  INT16_C( 10330), -INT16_C( 21008), -INT16_C( 12348), -INT16_C( 18322), -INT16_C(  9991),  INT16_C( 30885) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 10509),  INT16_C( 12910), -INT16_C(  8842), -INT16_C( 19234) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi16(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi16(test_vec[i].b);
+    simde__m128i r = simde_mm_maskz_shldi_epi16(test_vec[i].k, a, b, INT32_C(  6));
+    simde_test_x86_assert_equal_i16x8(r, simde_x_mm_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_shldi_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(  2092887267),  INT32_C(  1195324806), -INT32_C(   126983437),  INT32_C(  2067110053) },
+      { -INT32_C(  1502436493),  INT32_C(  1994260171), -INT32_C(  1021870176), -INT32_C(   315107310) },
+      {  INT32_C(   576959694), -INT32_C(   424620325), -INT32_C(   866224030), -INT32_C(  1290486362) } },
+    { {  INT32_C(   446561326),  INT32_C(   916153832),  INT32_C(  1426685988), -INT32_C(   239051037) },
+      {  INT32_C(   657012015),  INT32_C(  1501399233), -INT32_C(  1081685709), -INT32_C(   496829476) },
+      { -INT32_C(  1081752347),  INT32_C(  1824328495),  INT32_C(   805607408),  INT32_C(   198999116) } },
+    { {  INT32_C(  2139799361),  INT32_C(    77806893), -INT32_C(   681071606),  INT32_C(  1889122864) },
+      {  INT32_C(   659251555),  INT32_C(  1452094735), -INT32_C(   711303648),  INT32_C(   575571358) },
+      {  INT32_C(  1474831593),  INT32_C(  1738910417), -INT32_C(   176072013),  INT32_C(   927335497) } },
+    { {  INT32_C(   250834396),  INT32_C(  1861069394), -INT32_C(  1117175810), -INT32_C(  1197871516) },
+      {  INT32_C(  1734583342), -INT32_C(  1881132863),  INT32_C(   959050790),  INT32_C(   951938369) },
+      {  INT32_C(  1841007852), -INT32_C(  1253420548),  INT32_C(   671074085),  INT32_C(  1036814103) } },
+    { {  INT32_C(   543083990), -INT32_C(   270122932), -INT32_C(  1144868428),  INT32_C(   923765852) },
+      { -INT32_C(  2009687767), -INT32_C(   820799845),  INT32_C(  1694340150),  INT32_C(  1954326462) },
+      { -INT32_C(   642068218), -INT32_C(   938894878),  INT32_C(  1446415519), -INT32_C(   242512241) } },
+    { {  INT32_C(  1363088890), -INT32_C(  2090105109), -INT32_C(   717495784), -INT32_C(   513983070) },
+      { -INT32_C(   447801354),  INT32_C(   125422200),  INT32_C(   315448683), -INT32_C(  1640833634) },
+      { -INT32_C(   490775383),  INT32_C(  1893556463),  INT32_C(  2084766297), -INT32_C(  1481354298) } },
+    { { -INT32_C(  1219020963),  INT32_C(  1160860566), -INT32_C(  1513175253), -INT32_C(  1296611954) },
+      { -INT32_C(  1992457634), -INT32_C(  2134568570), -INT32_C(  1021081457),  INT32_C(   448612326) },
+      { -INT32_C(   420761305),  INT32_C(   712167448), -INT32_C(   656050076), -INT32_C(   391003305) } },
+    { {  INT32_C(  1599457483),  INT32_C(   198454463),  INT32_C(   530621295),  INT32_C(  2007033677) },
+      {  INT32_C(  1448110088),  INT32_C(   145464352), -INT32_C(   241509920), -INT32_C(  1848895488) },
+      { -INT32_C(  1189516598), -INT32_C(  2053644011),  INT32_C(   342752819),  INT32_C(   485077561) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_shldi_epi32(a, b, INT32_C( 13));
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_shldi_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C(   868620414), -INT32_C(   471945431),  INT32_C(  2026596750), -INT32_C(  1019005494) },
+      UINT8_C( 76),
+      { -INT32_C(   169697366), -INT32_C(  1332638602),  INT32_C(   391104163), -INT32_C(   948184359) },
+      { -INT32_C(  1725751312), -INT32_C(   554309560), -INT32_C(  1882417911), -INT32_C(  2092989376) },
+      {  INT32_C(   868620414), -INT32_C(   471945431), -INT32_C(   120294919),  INT32_C(  2069573735) } },
+    { {  INT32_C(  1857902498),  INT32_C(  1436168232),  INT32_C(  1754893471), -INT32_C(   674205574) },
+      UINT8_C(229),
+      {  INT32_C(   659098407), -INT32_C(   479097727),  INT32_C(  1585375652), -INT32_C(   498826350) },
+      { -INT32_C(  1589547195),  INT32_C(  1257328616), -INT32_C(   612090304),  INT32_C(  2056880022) },
+      {  INT32_C(   560264232),  INT32_C(  1436168232), -INT32_C(   583754896), -INT32_C(   674205574) } },
+    { { -INT32_C(    43049695),  INT32_C(    27972004),  INT32_C(   326072189),  INT32_C(   808752501) },
+      UINT8_C( 21),
+      { -INT32_C(   863939108),  INT32_C(   936957199), -INT32_C(  1124902115),  INT32_C(   602203919) },
+      {  INT32_C(   526343005), -INT32_C(   578793759),  INT32_C(   113727988),  INT32_C(  1740650074) },
+      {  INT32_C(   716932075),  INT32_C(    27972004),  INT32_C(  1801691352),  INT32_C(   808752501) } },
+    { {  INT32_C(   767449604),  INT32_C(   787810081), -INT32_C(  1109893040), -INT32_C(  1077411222) },
+      UINT8_C( 92),
+      { -INT32_C(  1637039867), -INT32_C(   911180057),  INT32_C(    83486328), -INT32_C(  1718425188) },
+      { -INT32_C(   546712498), -INT32_C(  1515567602), -INT32_C(  2079314412),  INT32_C(  1986151081) },
+      {  INT32_C(   767449604),  INT32_C(   787810081),  INT32_C(  1020203138),  INT32_C(  1563659980) } },
+    { { -INT32_C(  1455471851),  INT32_C(  2010403392),  INT32_C(   380185377), -INT32_C(  1601221198) },
+      UINT8_C( 89),
+      { -INT32_C(  1541652936),  INT32_C(  1547062987), -INT32_C(  1845693012), -INT32_C(   938281002) },
+      {  INT32_C(  1077688029),  INT32_C(    75426740), -INT32_C(   197367750),  INT32_C(  1443150685) },
+      { -INT32_C(  2016999417),  INT32_C(  2010403392),  INT32_C(   380185377),  INT32_C(  1593494208) } },
+    { {  INT32_C(  1098493452), -INT32_C(  2012446417),  INT32_C(   973638497),  INT32_C(    72265636) },
+      UINT8_C(255),
+      { -INT32_C(  1795748952), -INT32_C(  1841429307),  INT32_C(   457695911),  INT32_C(   395496799) },
+      {  INT32_C(  1488554040), -INT32_C(  1754697848), -INT32_C(   191682088), -INT32_C(   974593771) },
+      { -INT32_C(   512423145), -INT32_C(  1063734547), -INT32_C(    61538670),  INT32_C(  1504442557) } },
+    { { -INT32_C(  2078742715), -INT32_C(  1897149261), -INT32_C(  2061779213), -INT32_C(   867432934) },
+      UINT8_C( 63),
+      { -INT32_C(  1411227638),  INT32_C(   539404760),  INT32_C(   673373640),  INT32_C(  1843267096) },
+      {  INT32_C(   293552901),  INT32_C(   491364551),  INT32_C(   229301029),  INT32_C(   859013877) },
+      {  INT32_C(  1275150895), -INT32_C(   717552727),  INT32_C(  1538851253), -INT32_C(  1060960666) } },
+    { { -INT32_C(   683815233),  INT32_C(   925234280),  INT32_C(   678616355), -INT32_C(  1915195338) },
+      UINT8_C( 25),
+      { -INT32_C(  2084941623),  INT32_C(  1126683662),  INT32_C(   215155461),  INT32_C(  1773719002) },
+      { -INT32_C(  1454438607), -INT32_C(   585250802),  INT32_C(   982233100), -INT32_C(  2001502772) },
+      {  INT32_C(  1243165993),  INT32_C(   925234280),  INT32_C(   678616355),  INT32_C(   431706390) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_mask_shldi_epi32(src, test_vec[i].k, a, b, INT32_C( 77));
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_shldi_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { UINT8_C(239),
+      {  INT32_C(  1865898902),  INT32_C(  1227877105),  INT32_C(   119516371), -INT32_C(  1545944775) },
+      {  INT32_C(   831434702), -INT32_C(   423120691),  INT32_C(   468747019), -INT32_C(   606326633) },
+      { -INT32_C(   689599389), -INT32_C(    88311375), -INT32_C(   348862724), -INT32_C(  1337035017) } },
+    { UINT8_C(213),
+      { -INT32_C(  1767568922), -INT32_C(  1562117997), -INT32_C(  1922839309),  INT32_C(   335183366) },
+      {  INT32_C(  1142483354), -INT32_C(  2061680728),  INT32_C(  1312339418), -INT32_C(   871486942) },
+      {  INT32_C(  1115263238),  INT32_C(           0), -INT32_C(   214117490),  INT32_C(           0) } },
+    { UINT8_C(128),
+      { -INT32_C(    49194717),  INT32_C(  1979580446), -INT32_C(  1815029489), -INT32_C(   319599178) },
+      {  INT32_C(   669791935), -INT32_C(   470618249),  INT32_C(   901273690),  INT32_C(   194298635) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT8_C( 89),
+      {  INT32_C(  1162862291),  INT32_C(   329158993), -INT32_C(   204822247), -INT32_C(  1399992708) },
+      { -INT32_C(  1782927059),  INT32_C(  2093331970),  INT32_C(  1744077264), -INT32_C(  1226500301) },
+      { -INT32_C(   139139730),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1939811769) } },
+    { UINT8_C(229),
+      { -INT32_C(  1140799490), -INT32_C(  1602590587),  INT32_C(   596519153), -INT32_C(  1170158231) },
+      { -INT32_C(   356808624),  INT32_C(   415859387), -INT32_C(   951738322),  INT32_C(   966970250) },
+      {  INT32_C(   838843054),  INT32_C(           0), -INT32_C(  1975750191),  INT32_C(           0) } },
+    { UINT8_C(111),
+      {  INT32_C(   101602463),  INT32_C(   670355422), -INT32_C(   476702539),  INT32_C(   800878678) },
+      {  INT32_C(  1623548207),  INT32_C(   791910916),  INT32_C(   132957553),  INT32_C(   452809043) },
+      { -INT32_C(  1792550863),  INT32_C(   871861196), -INT32_C(  2043854341),  INT32_C(   471172799) } },
+    { UINT8_C(106),
+      { -INT32_C(  1872732140),  INT32_C(   455429377),  INT32_C(  1110712963), -INT32_C(  1099411344) },
+      {  INT32_C(  1877763293), -INT32_C(   597162867),  INT32_C(   311388541),  INT32_C(  1516403320) },
+      {  INT32_C(           0),  INT32_C(  1396733722),  INT32_C(           0),  INT32_C(   337385112) } },
+    { UINT8_C(134),
+      { -INT32_C(  1240026299), -INT32_C(  1249051383),  INT32_C(   183846310), -INT32_C(  1789164006) },
+      { -INT32_C(  1346362627),  INT32_C(  1835871162),  INT32_C(  1015145095),  INT32_C(  1975421408) },
+      {  INT32_C(           0),  INT32_C(  1061313371),  INT32_C(  1365872416),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_maskz_shldi_epi32(test_vec[i].k, a, b, INT32_C( 14));
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_shldi_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[2];
+    const int64_t b[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { { -INT64_C(  758448527737208278),  INT64_C( 7319501855502819280) },
+      { -INT64_C( 7378394058632692156),  INT64_C( 7087724228780554112) },
+      {  INT64_C( 8775340097577268806), -INT64_C( 4477710473775221689) } },
+    { {  INT64_C( 2339770998659041571),  INT64_C(  243589344342032408) },
+      {  INT64_C( 2532499802401179634),  INT64_C( 6736586403555772691) },
+      { -INT64_C( 2690579288773106463), -INT64_C( 7892554998240430965) } },
+    { { -INT64_C( 6752540612208719878),  INT64_C( 8496716499976096087) },
+      { -INT64_C(  424770491700510959), -INT64_C( 6003436596981447811) },
+      { -INT64_C( 4841088814806126688),  INT64_C( 5247022275134244639) } },
+    { {  INT64_C( 3144766858536297095),  INT64_C( 6979410183193882345) },
+      {  INT64_C( 2815066161745104470),  INT64_C(  895241372717781183) },
+      {  INT64_C( 1100093152962017355), -INT64_C( 2270415500946101983) } },
+    { {  INT64_C( 3408027223010622880), -INT64_C( 1108003689787777155) },
+      {  INT64_C( 3766192767861946567),  INT64_C( 1380793326189711808) },
+      { -INT64_C( 8279951449744045112), -INT64_C( 8353069403080620324) } },
+    { {  INT64_C( 7029115032059757753), -INT64_C( 6010693247374966531) },
+      {  INT64_C( 1799539389460810660), -INT64_C( 8384488179750148006) },
+      {  INT64_C( 7563961751271108938),  INT64_C(  866977775293697420) } },
+    { {  INT64_C(  641004088099577436), -INT64_C( 6811733759803204178) },
+      {  INT64_C( 4086859590610274589),  INT64_C( 7522860092081262990) },
+      {  INT64_C( 6337632881706149024), -INT64_C( 3703166376294077269) } },
+    { {  INT64_C( 4260136804087680285),  INT64_C( 2104667445578603785) },
+      {  INT64_C( 8292059043135823862), -INT64_C( 7583706262646284547) },
+      { -INT64_C( 4118080414882858873),  INT64_C(   95597256851876530) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i r = simde_mm_shldi_epi64(a, b, INT32_C( 37));
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_shldi_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[2];
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t b[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { { -INT64_C( 8513904043621052611), -INT64_C( 1419513807307920262) },
+      UINT8_C(186),
+      { -INT64_C( 8007557113727254807),  INT64_C( 3094337853870273813) },
+      { -INT64_C( 2910205589026803214),  INT64_C( 7896627276095620034) },
+      { -INT64_C( 8513904043621052611),  INT64_C( 6876612547954251116) } },
+    { {  INT64_C( 4580876633727635840),  INT64_C(  261873124804446525) },
+      UINT8_C(225),
+      {  INT64_C( 2532111836997012918),  INT64_C( 4363294227714879347) },
+      { -INT64_C( 7188782295556262659),  INT64_C( 5593678783346052953) },
+      { -INT64_C(  533194061238365471),  INT64_C(  261873124804446525) } },
+    { { -INT64_C(   53016122137653122),  INT64_C( 4718505499487391862) },
+      UINT8_C(104),
+      { -INT64_C( 8740026928968947322),  INT64_C( 5976173755997939493) },
+      { -INT64_C( 3438292323043680274),  INT64_C( 3214285897625332027) },
+      { -INT64_C(   53016122137653122),  INT64_C( 4718505499487391862) } },
+    { { -INT64_C( 1503224457852299364),  INT64_C(  788067037646438432) },
+      UINT8_C( 44),
+      {  INT64_C( 7453260682224922048),  INT64_C( 4224783253340573883) },
+      { -INT64_C(  362764479414578800),  INT64_C( 6981578703429273285) },
+      { -INT64_C( 1503224457852299364),  INT64_C(  788067037646438432) } },
+    { {  INT64_C( 6128675161310917156),  INT64_C( 7186134167178662697) },
+      UINT8_C(169),
+      { -INT64_C( 3626830287341979040),  INT64_C( 3542390791328702922) },
+      {  INT64_C( 2549545847786833625), -INT64_C( 4722314502690480339) },
+      { -INT64_C( 3796732378970730984),  INT64_C( 7186134167178662697) } },
+    { { -INT64_C( 2096593537391534965),  INT64_C( 2459793916296319155) },
+      UINT8_C( 47),
+      { -INT64_C( 3815292160332055160), -INT64_C( 5667406748903519154) },
+      { -INT64_C( 8369253689859390968), -INT64_C( 3461466143932560280) },
+      { -INT64_C( 6744227228322757745), -INT64_C( 4717087565318136777) } },
+    { {  INT64_C( 5814057038533102265), -INT64_C( 3063687257956343910) },
+      UINT8_C(  9),
+      {  INT64_C( 1442364099693199330), -INT64_C( 2243606847379693112) },
+      {  INT64_C( 8492236773552083299), -INT64_C( 1190232589768725371) },
+      { -INT64_C( 2330616867060741311), -INT64_C( 3063687257956343910) } },
+    { { -INT64_C( 3157953971781380949),  INT64_C( 8791780149356173155) },
+      UINT8_C( 15),
+      { -INT64_C( 6302997454064283851),  INT64_C( 7693658841629989601) },
+      { -INT64_C( 4788931619782705274), -INT64_C( 7958939706231780272) },
+      {  INT64_C( 5319286311529054737), -INT64_C( 3692005898864734164) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi64(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i r = simde_mm_mask_shldi_epi64(src, test_vec[i].k, a, b, INT32_C(165));
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_shldi_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t b[2];
+    const int64_t r[2];
+  } test_vec[] = {
+    { UINT8_C(242),
+      { -INT64_C( 5049402365754642061),  INT64_C(   71879322446425486) },
+      {  INT64_C( 3305798223692829877),  INT64_C( 4672993070631320881) },
+      {  INT64_C(                   0),  INT64_C( 5141812870613539867) } },
+    { UINT8_C( 44),
+      {  INT64_C( 4469392462119632340), -INT64_C( 2122436910781967858) },
+      {  INT64_C( 4264773588513830075), -INT64_C( 7081859713969644207) },
+      {  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(227),
+      { -INT64_C( 4071359209581306810),  INT64_C( 7755764243434573848) },
+      { -INT64_C( 1334208654019685731),  INT64_C( 2932799392881477024) },
+      { -INT64_C(  502413336978386156), -INT64_C( 1872364904307400554) } },
+    { UINT8_C(245),
+      { -INT64_C( 4644723039075632154), -INT64_C( 4968746206722586220) },
+      { -INT64_C( 1296204142035726085),  INT64_C( 6875803545344442647) },
+      { -INT64_C(  810936299166020397),  INT64_C(                   0) } },
+    { UINT8_C(182),
+      {  INT64_C(  273119545400054637),  INT64_C( 6685397772007736465) },
+      { -INT64_C( 7897492278808425938), -INT64_C( 3436773816923372215) },
+      {  INT64_C(                   0), -INT64_C( 5953437151444591865) } },
+    { UINT8_C(138),
+      {  INT64_C( 4615752554635350679), -INT64_C(   57988188528129632) },
+      { -INT64_C( 8490146164719918138), -INT64_C( 3923088219551864455) },
+      {  INT64_C(                   0),  INT64_C( 7436120500370735918) } },
+    { UINT8_C( 57),
+      { -INT64_C( 6179382512711792433),  INT64_C( 8243478178859685625) },
+      { -INT64_C( 6149794358366383813), -INT64_C( 5906278378762954521) },
+      { -INT64_C( 6673714614844086452),  INT64_C(                   0) } },
+    { UINT8_C( 41),
+      {  INT64_C( 5516112566093454545),  INT64_C( 1022008647434258522) },
+      {  INT64_C( 3964751161564474448), -INT64_C( 7873524971230539983) },
+      { -INT64_C( 4294406211112531145),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i r = simde_mm_maskz_shldi_epi64(test_vec[i].k, a, b, INT32_C( 38));
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_shldi_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t a[16];
+    const int16_t b[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    { {  INT16_C( 19113), -INT16_C( 11228),  INT16_C( 26449), -INT16_C(  5785), -INT16_C( 32154), -INT16_C(   255),  INT16_C(  3996), -INT16_C( 21159),
+        -INT16_C( 12826),  INT16_C(  9138),  INT16_C(  3305),  INT16_C(   448),  INT16_C(  1833),  INT16_C( 30927), -INT16_C(  5634), -INT16_C( 31792) },
+      {  INT16_C(  8001), -INT16_C( 30879), -INT16_C(  6714), -INT16_C(  1030),  INT16_C( 10344), -INT16_C( 25492), -INT16_C( 26401),  INT16_C( 16159),
+         INT16_C( 11471), -INT16_C( 19412),  INT16_C( 18695),  INT16_C(  9345), -INT16_C( 16910), -INT16_C(  3524), -INT16_C( 19715), -INT16_C( 13157) },
+      { -INT16_C( 21945),  INT16_C(  2337), -INT16_C( 11143),  INT16_C( 23038), -INT16_C( 26230), -INT16_C( 16281), -INT16_C(  6362),  INT16_C( 22095),
+         INT16_C( 31115), -INT16_C(  4947),  INT16_C( 14930),  INT16_C( 28681), -INT16_C( 13713),  INT16_C( 13308),  INT16_C( 32684), -INT16_C(  3021) } },
+    { {  INT16_C(  5556), -INT16_C(   261), -INT16_C( 15085), -INT16_C( 24984), -INT16_C( 10545), -INT16_C( 15031), -INT16_C(  8778),  INT16_C( 19952),
+         INT16_C( 18585), -INT16_C( 23670),  INT16_C( 22418), -INT16_C( 24433), -INT16_C(  2347),  INT16_C( 28887),  INT16_C(  5046),  INT16_C(  8057) },
+      { -INT16_C( 31674),  INT16_C( 14067), -INT16_C( 22614),  INT16_C( 14838),  INT16_C( 21841),  INT16_C(  1319),  INT16_C( 28431), -INT16_C( 25303),
+         INT16_C(  3476), -INT16_C(   335), -INT16_C(  6273),  INT16_C(  6690),  INT16_C(  7246),  INT16_C( 32318),  INT16_C( 14282), -INT16_C( 13543) },
+      {  INT16_C( 27937), -INT16_C( 16691),  INT16_C( 17641), -INT16_C( 26098), -INT16_C( 19499),  INT16_C( 21057),  INT16_C( 28059),  INT16_C( 31783),
+         INT16_C(  9795), -INT16_C(  7489), -INT16_C(  6983),  INT16_C(  9158), -INT16_C( 19129),  INT16_C( 13791), -INT16_C(  4723), -INT16_C(  8590) } },
+    { {  INT16_C( 18091), -INT16_C(  9132), -INT16_C( 25445), -INT16_C( 12447),  INT16_C(  2576), -INT16_C(  6690), -INT16_C( 32216),  INT16_C(  5845),
+         INT16_C( 30660),  INT16_C( 20161), -INT16_C( 30310), -INT16_C( 23988), -INT16_C( 19627),  INT16_C( 15438),  INT16_C( 16780),  INT16_C( 31923) },
+      {  INT16_C(   422), -INT16_C( 19675),  INT16_C(  5020),  INT16_C( 28955),  INT16_C(  2321),  INT16_C( 14491), -INT16_C(  8272),  INT16_C( 29592),
+         INT16_C( 30551), -INT16_C( 17051),  INT16_C( 23040), -INT16_C(   512), -INT16_C( 19289),  INT16_C( 11397), -INT16_C(  3628), -INT16_C( 23100) },
+      { -INT16_C( 21824),  INT16_C(  5420),  INT16_C(  9924), -INT16_C( 10148), -INT16_C( 31742),  INT16_C( 30606), -INT16_C( 30153), -INT16_C( 19108),
+        -INT16_C(  3811), -INT16_C( 20369),  INT16_C( 26262), -INT16_C( 27841), -INT16_C( 10899),  INT16_C(  5003),  INT16_C( 25404),  INT16_C( 11497) } },
+    { { -INT16_C(  5321), -INT16_C( 17460),  INT16_C(  2634), -INT16_C( 31176),  INT16_C( 28453), -INT16_C( 17741), -INT16_C( 14081), -INT16_C( 24887),
+        -INT16_C( 23341), -INT16_C(  7483), -INT16_C(  8873),  INT16_C( 13758),  INT16_C( 20231),  INT16_C( 17041),  INT16_C( 32680), -INT16_C( 22715) },
+      {  INT16_C( 26409), -INT16_C( 23931), -INT16_C( 12573), -INT16_C( 14661), -INT16_C( 18815), -INT16_C( 25981),  INT16_C( 32443),  INT16_C( 16860),
+         INT16_C( 27385),  INT16_C( 24566), -INT16_C( 18565),  INT16_C( 11266), -INT16_C(  6570), -INT16_C( 14597), -INT16_C( 17063), -INT16_C( 28546) },
+      { -INT16_C( 12839), -INT16_C(  3288), -INT16_C( 27981), -INT16_C( 29135), -INT16_C( 13971), -INT16_C( 21274),  INT16_C( 16351), -INT16_C( 19888),
+         INT16_C( 13530), -INT16_C( 20137),  INT16_C( 21997),  INT16_C( 28555), -INT16_C( 15879), -INT16_C( 23439), -INT16_C(  5585), -INT16_C( 11932) } },
+    { { -INT16_C( 20012),  INT16_C( 24084),  INT16_C(  8272), -INT16_C( 13312), -INT16_C( 29003),  INT16_C(  5761),  INT16_C( 26106),  INT16_C(  1911),
+        -INT16_C( 23297),  INT16_C( 15085), -INT16_C( 24040), -INT16_C( 25325),  INT16_C( 18334),  INT16_C( 29547), -INT16_C( 20707),  INT16_C(  4170) },
+      {  INT16_C( 25158),  INT16_C( 19540), -INT16_C( 26042),  INT16_C( 31041), -INT16_C( 31011),  INT16_C( 12583),  INT16_C( 22387),  INT16_C(  2781),
+         INT16_C( 24988),  INT16_C( 18179), -INT16_C( 25275), -INT16_C( 18520), -INT16_C( 15788), -INT16_C( 12441), -INT16_C( 31190),  INT16_C( 14475) },
+      {  INT16_C( 29976), -INT16_C( 31469),  INT16_C(  5158),  INT16_C(    30), -INT16_C( 21151), -INT16_C( 24500),  INT16_C( 32405), -INT16_C(  8766),
+         INT16_C( 16344), -INT16_C( 17583), -INT16_C( 31193),  INT16_C( 17645), -INT16_C(  6224), -INT16_C(  9485), -INT16_C( 14495),  INT16_C(  4750) } },
+    { {  INT16_C( 21871), -INT16_C( 14207), -INT16_C( 16577),  INT16_C( 20070),  INT16_C(  9110), -INT16_C( 10921), -INT16_C( 23508), -INT16_C(  9541),
+        -INT16_C( 18273),  INT16_C( 29341),  INT16_C( 19898),  INT16_C( 17683), -INT16_C( 18237),  INT16_C( 17025), -INT16_C( 26562), -INT16_C( 15637) },
+      {  INT16_C(  9085), -INT16_C( 19277), -INT16_C(   765),  INT16_C( 16350),  INT16_C( 18801), -INT16_C( 12543), -INT16_C( 23954), -INT16_C(  5827),
+         INT16_C( 31124), -INT16_C( 24233),  INT16_C( 23060), -INT16_C( 15896), -INT16_C(  3060),  INT16_C( 25263),  INT16_C( 14728),  INT16_C(  4391) },
+      {  INT16_C( 23496),  INT16_C(  8301), -INT16_C( 12289), -INT16_C( 26225), -INT16_C(  6766),  INT16_C( 22003),  INT16_C(  2856), -INT16_C( 20742),
+         INT16_C( 10206), -INT16_C( 22680),  INT16_C( 28310),  INT16_C( 17648),  INT16_C( 12541), -INT16_C( 24488),  INT16_C(  3982), -INT16_C( 17724) } },
+    { { -INT16_C(  8955), -INT16_C( 26512),  INT16_C( 13445), -INT16_C(   948), -INT16_C(   211),  INT16_C( 20956), -INT16_C( 20219),  INT16_C( 19338),
+        -INT16_C( 28985),  INT16_C( 21675), -INT16_C( 23002), -INT16_C(  2761),  INT16_C(  4180), -INT16_C(  4562),  INT16_C( 26265),  INT16_C(  2138) },
+      {  INT16_C( 31921),  INT16_C( 16264),  INT16_C( 19767),  INT16_C( 25729),  INT16_C( 31732),  INT16_C( 17053), -INT16_C( 24028),  INT16_C( 31373),
+         INT16_C(  2608),  INT16_C( 32718),  INT16_C( 16229),  INT16_C(  8033),  INT16_C( 21277), -INT16_C( 29833), -INT16_C( 27130), -INT16_C( 22375) },
+      {  INT16_C( 16735),  INT16_C(  7183),  INT16_C(  8531),  INT16_C(  4889), -INT16_C( 13474),  INT16_C( 30480),  INT16_C( 16744), -INT16_C(  7522),
+        -INT16_C( 20030),  INT16_C( 10975), -INT16_C( 30321),  INT16_C( 19911),  INT16_C(  5396), -INT16_C( 29790), -INT16_C( 22939),  INT16_C(  5802) } },
+    { {  INT16_C(  5775),  INT16_C( 24464),  INT16_C( 30959), -INT16_C( 15810), -INT16_C( 29879), -INT16_C(  4592),  INT16_C( 24835),  INT16_C(  1265),
+        -INT16_C( 26620), -INT16_C(  7969),  INT16_C(  7409),  INT16_C( 16962),  INT16_C( 28210), -INT16_C( 20872), -INT16_C(  4449),  INT16_C( 14685) },
+      { -INT16_C(  6501),  INT16_C( 32603),  INT16_C( 23205),  INT16_C( 22138),  INT16_C(  8132), -INT16_C( 22361), -INT16_C( 19271), -INT16_C( 21325),
+         INT16_C( 11123), -INT16_C( 25817),  INT16_C( 12880), -INT16_C(  8126), -INT16_C( 18721), -INT16_C( 31915),  INT16_C( 11670), -INT16_C( 22317) },
+      { -INT16_C( 23559), -INT16_C(  7137),  INT16_C( 15318), -INT16_C( 28779), -INT16_C( 11705), -INT16_C( 31702),  INT16_C( 16621),  INT16_C( 15467),
+         INT16_C(   266),  INT16_C( 14310),  INT16_C( 15436), -INT16_C( 28488), -INT16_C( 29523), -INT16_C( 25056), -INT16_C( 22581),  INT16_C( 22378) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi16(test_vec[i].b);
+    simde__m256i r = simde_mm256_shldi_epi16(a, b, INT32_C(  6));
+    simde_test_x86_assert_equal_i16x16(r, simde_x_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_shldi_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[16];
+    const simde__mmask16 k;
+    const int16_t a[16];
+    const int16_t b[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    { {  INT16_C(    98),  INT16_C( 13318), -INT16_C( 25186), -INT16_C( 18504),  INT16_C(  3664),  INT16_C( 29612),  INT16_C(  2823),  INT16_C( 15543),
+         INT16_C( 29752), -INT16_C( 17916),  INT16_C( 29883),  INT16_C( 15804),  INT16_C( 23901),  INT16_C( 22241), -INT16_C( 29302), -INT16_C( 19526) },
+      UINT16_C(43828),
+      { -INT16_C( 11413), -INT16_C( 13322), -INT16_C(  7806), -INT16_C( 27760),  INT16_C( 17926),  INT16_C( 13354),  INT16_C( 24588), -INT16_C(  4700),
+        -INT16_C( 13910), -INT16_C(   430),  INT16_C(  3339),  INT16_C( 20669), -INT16_C( 12324), -INT16_C( 25532),  INT16_C(  9571),  INT16_C(  7951) },
+      { -INT16_C( 22693),  INT16_C( 26672), -INT16_C( 18398), -INT16_C(  4739), -INT16_C(  3146), -INT16_C( 22446),  INT16_C(  1235),  INT16_C( 30198),
+        -INT16_C( 27827),  INT16_C(  5660), -INT16_C( 30624),  INT16_C( 11435),  INT16_C( 27750),  INT16_C(  8180), -INT16_C( 20611), -INT16_C( 11378) },
+      {  INT16_C(    98),  INT16_C( 13318),  INT16_C( 24750), -INT16_C( 18504), -INT16_C( 32324),  INT16_C(  2730),  INT16_C(  2823),  INT16_C( 15543),
+         INT16_C( 27300), -INT16_C( 27515),  INT16_C( 29883),  INT16_C( 12107),  INT16_C( 23901),  INT16_C(  4359), -INT16_C( 29302), -INT16_C( 15372) } },
+    { {  INT16_C( 18350), -INT16_C( 32101),  INT16_C( 17133), -INT16_C( 13824), -INT16_C( 12589), -INT16_C( 29843), -INT16_C( 22916), -INT16_C( 16053),
+        -INT16_C( 14278),  INT16_C(  7837), -INT16_C(  5162), -INT16_C( 16404), -INT16_C( 17534),  INT16_C(  1992), -INT16_C( 23235), -INT16_C( 11798) },
+      UINT16_C(12874),
+      { -INT16_C( 11164),  INT16_C( 28899), -INT16_C( 26656), -INT16_C(  8226), -INT16_C( 11680),  INT16_C( 12085), -INT16_C(  9885),  INT16_C(   420),
+        -INT16_C( 14669), -INT16_C(  8933), -INT16_C(  4002), -INT16_C( 30427), -INT16_C(  5740), -INT16_C( 22450),  INT16_C( 25831), -INT16_C( 30726) },
+      {  INT16_C( 22353), -INT16_C( 13151),  INT16_C(  1859), -INT16_C( 27907),  INT16_C( 12537),  INT16_C( 27222),  INT16_C( 23104), -INT16_C( 31182),
+        -INT16_C(  8847), -INT16_C( 17866),  INT16_C( 17749),  INT16_C( 29871), -INT16_C(  2132),  INT16_C( 15328), -INT16_C( 31569),  INT16_C( 31969) },
+      {  INT16_C( 18350),  INT16_C( 14579),  INT16_C( 17133), -INT16_C(  2140), -INT16_C( 12589), -INT16_C( 29843),  INT16_C( 22742), -INT16_C( 16053),
+        -INT16_C( 14278),  INT16_C( 18158), -INT16_C(  5162), -INT16_C( 16404),  INT16_C( 25917),  INT16_C(  5006), -INT16_C( 23235), -INT16_C( 11798) } },
+    { {  INT16_C(   410), -INT16_C(  8383), -INT16_C( 16304),  INT16_C( 13643),  INT16_C( 24729),  INT16_C( 29686), -INT16_C( 16147), -INT16_C(  7945),
+         INT16_C( 17035), -INT16_C( 18350),  INT16_C(  7825), -INT16_C(  7664),  INT16_C( 13015), -INT16_C( 26238), -INT16_C( 23102),  INT16_C( 24094) },
+      UINT16_C(26952),
+      { -INT16_C( 29686),  INT16_C( 11575), -INT16_C( 16713), -INT16_C(  6391),  INT16_C( 17494),  INT16_C(  7098), -INT16_C( 25959), -INT16_C( 32543),
+        -INT16_C( 31037), -INT16_C( 24871), -INT16_C( 21749), -INT16_C(  9252), -INT16_C(  7186),  INT16_C( 19422), -INT16_C(  1907),  INT16_C( 29007) },
+      {  INT16_C( 12981), -INT16_C( 11284),  INT16_C(  4176),  INT16_C( 11814),  INT16_C( 11884),  INT16_C(     4), -INT16_C( 15810),  INT16_C( 20273),
+        -INT16_C(  7465), -INT16_C( 14669),  INT16_C( 21789), -INT16_C( 19083), -INT16_C( 11164), -INT16_C(  9541), -INT16_C(  6971), -INT16_C( 10483) },
+      {  INT16_C(   410), -INT16_C(  8383), -INT16_C( 16304), -INT16_C( 15797),  INT16_C( 24729),  INT16_C( 29686), -INT16_C( 22928), -INT16_C(  7945),
+        -INT16_C( 20232), -INT16_C( 18350),  INT16_C(  7825), -INT16_C(  2259),  INT16_C( 13015), -INT16_C(  2122),  INT16_C(  9081),  INT16_C( 24094) } },
+    { { -INT16_C( 20729),  INT16_C( 10230),  INT16_C( 17715), -INT16_C( 26303),  INT16_C( 11274), -INT16_C( 22054),  INT16_C( 10782),  INT16_C( 14798),
+        -INT16_C( 14687),  INT16_C( 22371),  INT16_C( 23707), -INT16_C(  2048), -INT16_C(  7993), -INT16_C( 17069), -INT16_C(  3082),  INT16_C( 19062) },
+      UINT16_C(64496),
+      {  INT16_C( 28694), -INT16_C( 26078),  INT16_C( 24707), -INT16_C( 29066), -INT16_C( 10531),  INT16_C( 15557), -INT16_C(  5120),  INT16_C( 16061),
+        -INT16_C( 12258), -INT16_C(  3921),  INT16_C( 23221), -INT16_C( 13296),  INT16_C( 19169),  INT16_C( 26636),  INT16_C( 25718), -INT16_C( 18986) },
+      { -INT16_C( 17966), -INT16_C( 13190),  INT16_C(  4755), -INT16_C( 19466),  INT16_C(  6706),  INT16_C( 17520),  INT16_C( 18954),  INT16_C( 28560),
+        -INT16_C(  9457), -INT16_C( 31256), -INT16_C( 11322),  INT16_C( 28780),  INT16_C(  8688), -INT16_C(  7373),  INT16_C( 25652),  INT16_C( 11704) },
+      { -INT16_C( 20729),  INT16_C( 10230),  INT16_C( 17715), -INT16_C( 26303), -INT16_C( 18618),  INT16_C( 12625),  INT16_C(    18), -INT16_C( 20645),
+         INT16_C(  1974),  INT16_C( 11233),  INT16_C( 23707),  INT16_C(  1052), -INT16_C( 18360),  INT16_C(   824),  INT16_C(  7577),  INT16_C( 30091) } },
+    { { -INT16_C( 25680),  INT16_C(  5128),  INT16_C( 24658), -INT16_C(  4568),  INT16_C(  9355),  INT16_C( 31154),  INT16_C(  1327), -INT16_C( 27357),
+         INT16_C(  8214), -INT16_C(   616), -INT16_C( 15874), -INT16_C( 11282),  INT16_C( 32684), -INT16_C( 24269),  INT16_C( 16992), -INT16_C(  3188) },
+      UINT16_C(54296),
+      { -INT16_C(  3903), -INT16_C(  6303), -INT16_C( 24518), -INT16_C( 29917), -INT16_C( 15478), -INT16_C(  3520), -INT16_C( 27495),  INT16_C( 14513),
+         INT16_C(  2966), -INT16_C( 24895),  INT16_C(   277), -INT16_C( 12993),  INT16_C( 12280),  INT16_C( 26495), -INT16_C( 18567), -INT16_C(  8756) },
+      { -INT16_C( 28457),  INT16_C( 26945),  INT16_C( 12423),  INT16_C( 21542),  INT16_C( 27544),  INT16_C( 23831), -INT16_C(  6377), -INT16_C(  2598),
+         INT16_C(  2948),  INT16_C( 11405),  INT16_C(  6142),  INT16_C( 17751), -INT16_C( 14009), -INT16_C( 24130),  INT16_C( 22944), -INT16_C( 19107) },
+      { -INT16_C( 25680),  INT16_C(  5128),  INT16_C( 24658), -INT16_C( 14123), -INT16_C(  7526),  INT16_C( 31154),  INT16_C(  1327), -INT16_C( 27357),
+         INT16_C(  8214), -INT16_C(   616),  INT16_C( 17733), -INT16_C( 11282), -INT16_C(   462), -INT16_C( 24269), -INT16_C(  8618),  INT16_C( 29485) } },
+    { { -INT16_C( 29455),  INT16_C( 11921),  INT16_C( 28196), -INT16_C( 29280),  INT16_C( 12680), -INT16_C( 31917),  INT16_C( 26078), -INT16_C( 15537),
+        -INT16_C( 14354),  INT16_C( 20500),  INT16_C( 28170),  INT16_C(  3502),  INT16_C(  7925),  INT16_C( 10878),  INT16_C( 29618),  INT16_C(  9353) },
+      UINT16_C(12143),
+      {  INT16_C(  1257), -INT16_C( 31784),  INT16_C(  8210),  INT16_C( 18890), -INT16_C( 18233), -INT16_C( 19825),  INT16_C(  5375),  INT16_C(  2676),
+        -INT16_C(   444), -INT16_C( 29877), -INT16_C( 18500),  INT16_C( 23000), -INT16_C(  8361), -INT16_C( 26620), -INT16_C( 23869),  INT16_C(  1859) },
+      {  INT16_C( 12957), -INT16_C( 14372),  INT16_C( 14348),  INT16_C(  9846), -INT16_C(  9696), -INT16_C(   875), -INT16_C(  7417),  INT16_C(  4538),
+         INT16_C(   145), -INT16_C( 22944),  INT16_C( 28967), -INT16_C( 23741),  INT16_C(  2036),  INT16_C(  1187),  INT16_C( 10282), -INT16_C( 21490) },
+      {  INT16_C( 14924), -INT16_C(  2511),  INT16_C(  1166),  INT16_C( 29321),  INT16_C( 12680), -INT16_C( 23553),  INT16_C( 16376), -INT16_C( 15537),
+        -INT16_C( 28416), -INT16_C( 11543), -INT16_C(  4324),  INT16_C( 30248),  INT16_C(  7925),  INT16_C(   257),  INT16_C( 29618),  INT16_C(  9353) } },
+    { { -INT16_C(  1476),  INT16_C( 28915),  INT16_C( 14864),  INT16_C(    14),  INT16_C( 22084), -INT16_C( 12826),  INT16_C( 13940), -INT16_C(  3642),
+         INT16_C( 24642),  INT16_C( 28680),  INT16_C( 21574),  INT16_C( 20406), -INT16_C( 31991), -INT16_C( 24108), -INT16_C( 21470),  INT16_C( 24949) },
+      UINT16_C(10163),
+      { -INT16_C(  9182),  INT16_C( 28905),  INT16_C( 30302), -INT16_C(  7702),  INT16_C( 21450),  INT16_C( 29371), -INT16_C( 15396), -INT16_C(  1430),
+        -INT16_C(   321), -INT16_C( 23929), -INT16_C(  5313),  INT16_C( 16500), -INT16_C( 31840),  INT16_C(  3188),  INT16_C( 18896),  INT16_C( 21177) },
+      {  INT16_C( 23968), -INT16_C( 32419),  INT16_C( 26044), -INT16_C(  8903),  INT16_C(  2036),  INT16_C( 27883),  INT16_C( 29142),  INT16_C( 29567),
+        -INT16_C( 10913), -INT16_C(  1426), -INT16_C( 31563), -INT16_C( 17075), -INT16_C( 30278), -INT16_C( 21590), -INT16_C( 28092),  INT16_C( 15195) },
+      {  INT16_C(  2199),  INT16_C( 14944),  INT16_C( 14864),  INT16_C(    14), -INT16_C(  3455), -INT16_C( 20773),  INT16_C( 13940), -INT16_C( 25956),
+        -INT16_C( 20491), -INT16_C( 24066), -INT16_C( 12319),  INT16_C( 20406), -INT16_C( 31991),  INT16_C(  7466), -INT16_C( 21470),  INT16_C( 24949) } },
+    { {  INT16_C(  3965), -INT16_C( 17553), -INT16_C( 24078), -INT16_C(  7710), -INT16_C(  2060),  INT16_C(  2444),  INT16_C( 27801),  INT16_C( 20946),
+        -INT16_C( 26971),  INT16_C( 12095),  INT16_C( 13657),  INT16_C( 29495),  INT16_C( 27323), -INT16_C( 22488),  INT16_C(  4359), -INT16_C(  4971) },
+      UINT16_C( 8130),
+      { -INT16_C( 16492), -INT16_C(  6088), -INT16_C( 27341),  INT16_C(  1130), -INT16_C(  3014), -INT16_C( 13481),  INT16_C( 25668),  INT16_C(  1422),
+        -INT16_C(  6275), -INT16_C( 15942), -INT16_C( 21560),  INT16_C( 30222), -INT16_C(  6182),  INT16_C( 29702),  INT16_C( 12258), -INT16_C( 26893) },
+      { -INT16_C( 32063), -INT16_C( 25349), -INT16_C( 21129),  INT16_C( 20878), -INT16_C( 11041), -INT16_C( 28427), -INT16_C( 30933), -INT16_C( 10638),
+         INT16_C( 16649),  INT16_C( 25763), -INT16_C( 17876), -INT16_C(  1335), -INT16_C( 24219), -INT16_C( 25174),  INT16_C(  1124),  INT16_C( 31830) },
+      {  INT16_C(  3965),  INT16_C(  3623), -INT16_C( 24078), -INT16_C(  7710), -INT16_C(  2060),  INT16_C(  2444),  INT16_C(  4385),  INT16_C( 25525),
+        -INT16_C(  8368),  INT16_C( 28313), -INT16_C(  3538), -INT16_C( 31810), -INT16_C(  2392), -INT16_C( 22488),  INT16_C(  4359), -INT16_C(  4971) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi16(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi16(test_vec[i].b);
+    simde__m256i r = simde_mm256_mask_shldi_epi16(src, test_vec[i].k, a, b, INT32_C( 38));
+    simde_test_x86_assert_equal_i16x16(r, simde_x_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_shldi_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int16_t a[16];
+    const int16_t b[16];
+    const int16_t r[16];
+  } test_vec[] = {
+    { UINT16_C(56521),
+      { -INT16_C( 13776),  INT16_C( 28965),  INT16_C(   681),  INT16_C(  3588),  INT16_C( 24076), -INT16_C( 28242),  INT16_C( 17846),  INT16_C( 13493),
+         INT16_C( 17804),  INT16_C( 21371), -INT16_C(   161),  INT16_C( 13224), -INT16_C(  2769),  INT16_C(  4500), -INT16_C( 14653),  INT16_C(   737) },
+      {  INT16_C( 17603),  INT16_C( 10156), -INT16_C( 31973),  INT16_C( 12398), -INT16_C( 16770), -INT16_C(  8433), -INT16_C( 11190), -INT16_C( 21859),
+         INT16_C( 22787), -INT16_C( 24439),  INT16_C( 16053), -INT16_C(  7066),  INT16_C( 26753), -INT16_C(   512), -INT16_C( 31979),  INT16_C(  8208) },
+      {  INT16_C(  6178),  INT16_C(     0),  INT16_C(     0),  INT16_C(   536),  INT16_C(     0),  INT16_C(     0), -INT16_C(  9366),  INT16_C( 23253),
+         INT16_C(     0),  INT16_C(     0), -INT16_C( 20577), -INT16_C( 11150), -INT16_C( 26700),  INT16_C(     0),  INT16_C( 25025),  INT16_C( 28816) } },
+    { UINT16_C(41717),
+      {  INT16_C( 22000),  INT16_C( 14475), -INT16_C( 22004),  INT16_C( 13675), -INT16_C( 26909),  INT16_C(  6915), -INT16_C(  2313),  INT16_C( 22367),
+         INT16_C( 26365), -INT16_C(  4094),  INT16_C(  6295), -INT16_C(  7788), -INT16_C( 13398), -INT16_C( 17928),  INT16_C(  4046),  INT16_C( 15515) },
+      { -INT16_C( 16247),  INT16_C( 24355), -INT16_C(  6787),  INT16_C( 20974),  INT16_C( 31445), -INT16_C( 16914), -INT16_C(  4012),  INT16_C( 12641),
+        -INT16_C( 10475), -INT16_C( 31208),  INT16_C( 31927),  INT16_C( 28752), -INT16_C(  7644),  INT16_C( 27825), -INT16_C(  9328),  INT16_C(   596) },
+      { -INT16_C(  1952),  INT16_C(     0),  INT16_C(  1650),  INT16_C(     0),  INT16_C( 29117), -INT16_C( 32290),  INT16_C( 31736), -INT16_C( 20584),
+         INT16_C(     0),  INT16_C(   323),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(   970),  INT16_C(     0),  INT16_C( 19841) } },
+    { UINT16_C(50765),
+      {  INT16_C( 24705), -INT16_C(  9856),  INT16_C(  5754), -INT16_C( 24576),  INT16_C( 15177),  INT16_C( 15539),  INT16_C(  4586),  INT16_C( 15631),
+         INT16_C(  1691), -INT16_C(     2),  INT16_C( 14222),  INT16_C( 19211), -INT16_C(  6365),  INT16_C( 12202), -INT16_C( 20659),  INT16_C( 28692) },
+      {  INT16_C( 26811),  INT16_C( 10276),  INT16_C(  3066), -INT16_C( 16095),  INT16_C( 23096), -INT16_C( 11374),  INT16_C( 18484),  INT16_C(  2456),
+        -INT16_C( 19283),  INT16_C( 32459), -INT16_C( 20586), -INT16_C(  2672),  INT16_C(  6530),  INT16_C(  9489), -INT16_C( 19685),  INT16_C(  6046) },
+      {  INT16_C( 16564),  INT16_C(     0),  INT16_C( 15621),  INT16_C(    96),  INT16_C(     0),  INT16_C(     0), -INT16_C(  2780),  INT16_C(     0),
+         INT16_C(     0), -INT16_C(   193), -INT16_C( 14505),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 22823),  INT16_C(  2571) } },
+    { UINT16_C(30865),
+      {  INT16_C(  8224),  INT16_C( 10258), -INT16_C( 32240),  INT16_C( 32449),  INT16_C(    12), -INT16_C( 24032), -INT16_C( 11431), -INT16_C( 19334),
+         INT16_C( 21133), -INT16_C(  6068),  INT16_C( 10393),  INT16_C( 27536), -INT16_C(  3371),  INT16_C( 19641),  INT16_C( 23452), -INT16_C( 32073) },
+      {  INT16_C( 25441),  INT16_C( 15175), -INT16_C( 22705), -INT16_C(  9188), -INT16_C( 23795),  INT16_C( 10134), -INT16_C( 18215),  INT16_C(  4753),
+         INT16_C( 10280),  INT16_C( 20042), -INT16_C( 16902), -INT16_C( 20878),  INT16_C(  7987), -INT16_C( 15517), -INT16_C( 17888), -INT16_C( 19639) },
+      {  INT16_C(  4145),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  1617),  INT16_C(     0),  INT16_C(     0),  INT16_C( 15625),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 14249),  INT16_C( 27279),  INT16_C( 23777), -INT16_C( 12707),  INT16_C(     0) } },
+    { UINT16_C( 8368),
+      {  INT16_C( 24817), -INT16_C(  3014),  INT16_C( 29889), -INT16_C( 32660),  INT16_C( 27431),  INT16_C(  7919), -INT16_C(  8820),  INT16_C( 32352),
+        -INT16_C( 27158),  INT16_C( 22474), -INT16_C( 16577),  INT16_C( 12190), -INT16_C(  2803),  INT16_C( 21092), -INT16_C( 29706),  INT16_C( 24588) },
+      { -INT16_C( 17121), -INT16_C(  3996),  INT16_C( 28023),  INT16_C( 23285),  INT16_C( 13340), -INT16_C(  3676),  INT16_C( 16774), -INT16_C( 10911),
+        -INT16_C( 10804),  INT16_C( 20956),  INT16_C( 29501), -INT16_C(  1251), -INT16_C( 17392), -INT16_C(  6953),  INT16_C( 22839),  INT16_C( 14527) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 27750),  INT16_C( 30712),  INT16_C(     0),  INT16_C( 12394),
+         INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 12914),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C( 2824),
+      {  INT16_C(  9246),  INT16_C( 13910), -INT16_C(  6762), -INT16_C( 24038), -INT16_C(  7531),  INT16_C(   139), -INT16_C( 26716),  INT16_C( 18404),
+         INT16_C( 23387),  INT16_C( 10993),  INT16_C( 30810), -INT16_C(  1972),  INT16_C( 15063),  INT16_C( 27658),  INT16_C(  6036), -INT16_C( 19109) },
+      {  INT16_C( 15707),  INT16_C(  7433), -INT16_C(   291), -INT16_C( 26821), -INT16_C(  7160), -INT16_C( 18787),  INT16_C( 17661),  INT16_C(   544),
+         INT16_C( 11208),  INT16_C( 31945),  INT16_C(  8284), -INT16_C( 21542),  INT16_C(  8288),  INT16_C( 16448), -INT16_C(  3564),  INT16_C( 25243) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  3403),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+        -INT16_C( 21099),  INT16_C( 30910),  INT16_C(     0),  INT16_C(  9813),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(14139),
+      {  INT16_C( 12949), -INT16_C(  5706),  INT16_C( 32322),  INT16_C( 22476),  INT16_C( 15571),  INT16_C(  4564), -INT16_C( 24337),  INT16_C( 13989),
+         INT16_C(  6090),  INT16_C( 29877),  INT16_C( 12204),  INT16_C(  1165), -INT16_C(  1106),  INT16_C( 10352), -INT16_C(  8076),  INT16_C( 26885) },
+      { -INT16_C( 23540), -INT16_C(  1319), -INT16_C( 14719),  INT16_C(  5273), -INT16_C( 12180), -INT16_C( 19323),  INT16_C( 20307), -INT16_C( 13481),
+        -INT16_C(  8126),  INT16_C( 29935),  INT16_C( 27646), -INT16_C(  6813),  INT16_C(   962), -INT16_C( 14705),  INT16_C( 17643), -INT16_C(  4520) },
+      {  INT16_C( 19154), -INT16_C(  9347),  INT16_C(     0), -INT16_C(  6646),  INT16_C( 27112), -INT16_C(  5542),  INT16_C(     0),  INT16_C(     0),
+        -INT16_C(  6800),  INT16_C( 23226), -INT16_C( 10699),  INT16_C(     0), -INT16_C( 10495),  INT16_C( 14435),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT16_C(35130),
+      {  INT16_C(  2472), -INT16_C( 31059), -INT16_C( 27989),  INT16_C( 25227),  INT16_C(  8144), -INT16_C( 28451),  INT16_C( 12139), -INT16_C( 25799),
+         INT16_C( 17880),  INT16_C( 30439), -INT16_C( 21106),  INT16_C(  3990),  INT16_C( 26855), -INT16_C( 30146), -INT16_C( 22177),  INT16_C(  2032) },
+      {  INT16_C( 31003), -INT16_C( 27519), -INT16_C( 32539),  INT16_C(  1875),  INT16_C(  2767), -INT16_C(  4576),  INT16_C( 20815),  INT16_C( 16515),
+         INT16_C(  3198), -INT16_C( 19924), -INT16_C(  6525),  INT16_C( 10991),  INT16_C( 26072), -INT16_C( 28425),  INT16_C(  8487),  INT16_C( 10493) },
+      {  INT16_C(     0),  INT16_C( 22218),  INT16_C(     0),  INT16_C( 17795), -INT16_C(  6139),  INT16_C( 28407),  INT16_C(     0),  INT16_C(     0),
+        -INT16_C(  5114),  INT16_C(     0),  INT16_C(     0), -INT16_C( 13547),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  2028) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi16(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi16(test_vec[i].b);
+    simde__m256i r = simde_mm256_maskz_shldi_epi16(test_vec[i].k, a, b, INT32_C(  7));
+    simde_test_x86_assert_equal_i16x16(r, simde_x_mm256_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_shldi_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[8];
+    const int32_t b[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { {  INT32_C(   878195836),  INT32_C(  1678411674), -INT32_C(  1174244340),  INT32_C(  1870796963),  INT32_C(   657402731),  INT32_C(  1686356101),  INT32_C(   564403758),  INT32_C(   881718461) },
+      {  INT32_C(   326060927), -INT32_C(   717525125), -INT32_C(    66521216),  INT32_C(   126099181), -INT32_C(   507195619), -INT32_C(   973681750), -INT32_C(  1705495480),  INT32_C(   257525415) },
+      {  INT32_C(   220136667), -INT32_C(  1578715826), -INT32_C(  1660731646), -INT32_C(  2044149279), -INT32_C(   891619215), -INT32_C(   266243715),  INT32_C(   126592662),  INT32_C(  2100249558) } },
+    { {  INT32_C(   807970716),  INT32_C(  1063499386), -INT32_C(   790796929), -INT32_C(   239455553),  INT32_C(   442015704), -INT32_C(  1788494722), -INT32_C(   644832380), -INT32_C(  1842586596) },
+      { -INT32_C(  1014177282),  INT32_C(  1456977486),  INT32_C(  1540016628),  INT32_C(   811246391),  INT32_C(   476484512), -INT32_C(  1493719952),  INT32_C(  1753444181), -INT32_C(  1287310942) },
+      {  INT32_C(   703017187), -INT32_C(   308374091),  INT32_C(  1499453170), -INT32_C(  1934636010),  INT32_C(   670435097),  INT32_C(  1864346045),  INT32_C(   685840928),  INT32_C(   386346193) } },
+    { { -INT32_C(  1847309627),  INT32_C(   962851860), -INT32_C(  1535624567), -INT32_C(   306419009), -INT32_C(  1958013990), -INT32_C(   316723232),  INT32_C(  1536726496), -INT32_C(   947770725) },
+      {  INT32_C(   912019709), -INT32_C(  1696897578),  INT32_C(   119626583), -INT32_C(  1057359111), -INT32_C(   367602903), -INT32_C(  1378689177),  INT32_C(  1675641454), -INT32_C(  1631767771) },
+      {  INT32_C(   313609623), -INT32_C(    49994058),  INT32_C(   245514696),  INT32_C(   447737918), -INT32_C(   990463355), -INT32_C(   872928396),  INT32_C(   628627704), -INT32_C(  1968773201) } },
+    { { -INT32_C(  1420832003), -INT32_C(  1984420760), -INT32_C(   310932370),  INT32_C(  1442505162), -INT32_C(   865276115), -INT32_C(   777367833), -INT32_C(   426912724),  INT32_C(  1528238437) },
+      { -INT32_C(   706198287),  INT32_C(   840847984),  INT32_C(   462996894),  INT32_C(  1816984835),  INT32_C(  1889480118),  INT32_C(   339762766),  INT32_C(  2117127660), -INT32_C(   291555436) },
+      { -INT32_C(   188779142),  INT32_C(   152702087), -INT32_C(   484735258), -INT32_C(  1200448749),  INT32_C(  1003183143), -INT32_C(  1816541936),  INT32_C(  1963663244), -INT32_C(  1000768601) } },
+    { {  INT32_C(  2041859265), -INT32_C(  1013311807),  INT32_C(   522441322), -INT32_C(   427301227),  INT32_C(   322172639),  INT32_C(   803112721), -INT32_C(  1272566055), -INT32_C(     2188027) },
+      { -INT32_C(  1027910375),  INT32_C(   169148229), -INT32_C(   776028214),  INT32_C(  1402232410), -INT32_C(  1358719245), -INT32_C(  1209477674), -INT32_C(  1157156990),  INT32_C(   309502460) },
+      {  INT32_C(   321941678), -INT32_C(  2052046203), -INT32_C(   191187857), -INT32_C(   106605339), -INT32_C(    38278208), -INT32_C(  1580962310), -INT32_C(  1950978367), -INT32_C(  1488894820) } },
+    { {  INT32_C(  1831014876), -INT32_C(  1245397683), -INT32_C(   879219656),  INT32_C(  1741320798),  INT32_C(   878107965),  INT32_C(  2096965004),  INT32_C(  1828808104), -INT32_C(    59624227) },
+      {  INT32_C(   878727240), -INT32_C(   179314152), -INT32_C(    86927754),  INT32_C(   904975223), -INT32_C(  1277951293), -INT32_C(   826974256),  INT32_C(   859121459),  INT32_C(  1231759145) },
+      { -INT32_C(   998830824),  INT32_C(   794000723),  INT32_C(   185482932), -INT32_C(  1667789444), -INT32_C(  1219531531),  INT32_C(  1231238061),  INT32_C(  1500122317), -INT32_C(  1925754278) } },
+    { {  INT32_C(   174900499),  INT32_C(   972846110),  INT32_C(   285450941), -INT32_C(   956051217),  INT32_C(   332670020),  INT32_C(  1508514557),  INT32_C(  2028334761),  INT32_C(   278486922) },
+      {  INT32_C(   988106073),  INT32_C(   762398668),  INT32_C(  1962748787), -INT32_C(   983179758),  INT32_C(  1152324996),  INT32_C(  2055673332), -INT32_C(  1162107794),  INT32_C(  1441576217) },
+      {  INT32_C(   826592953),  INT32_C(   487033692), -INT32_C(   391160513), -INT32_C(   197398183),  INT32_C(   152113451), -INT32_C(  2034278751),  INT32_C(  2074767022),  INT32_C(  1474467195) } },
+    { { -INT32_C(    31135842), -INT32_C(   328699751),  INT32_C(   759004965),  INT32_C(  2102070065), -INT32_C(   211208415), -INT32_C(  1097267812), -INT32_C(  1836995909),  INT32_C(  1107435745) },
+      {  INT32_C(   457515377), -INT32_C(  1338450169), -INT32_C(  1633590003),  INT32_C(  1152880793),  INT32_C(  1417167442), -INT32_C(   117351978), -INT32_C(   632906814),  INT32_C(  1073673059) },
+      {  INT32_C(   971474641),  INT32_C(   472280078),  INT32_C(  1607034792), -INT32_C(  1026797267),  INT32_C(  1304974622),  INT32_C(  1097285184),  INT32_C(  1789851281), -INT32_C(  2009575425) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i r = simde_mm256_shldi_epi32(a, b, INT32_C( 14));
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_shldi_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t b[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { { -INT32_C(  1106469559),  INT32_C(     3826925), -INT32_C(  1730210926),  INT32_C(  1536616763),  INT32_C(    60556955), -INT32_C(   227886755), -INT32_C(   992116979),  INT32_C(  1817627991) },
+      UINT8_C(119),
+      {  INT32_C(  1818244702), -INT32_C(   424943590),  INT32_C(   297043313), -INT32_C(   576825113),  INT32_C(  1571291208),  INT32_C(   626104553), -INT32_C(   617629497),  INT32_C(   755364406) },
+      {  INT32_C(  1650081495),  INT32_C(   613917748),  INT32_C(   250151900),  INT32_C(   501643264), -INT32_C(  1260943645), -INT32_C(   465647273),  INT32_C(   580477741),  INT32_C(  1226670620) },
+      {  INT32_C(   228038806), -INT32_C(   133789403),  INT32_C(   559694778),  INT32_C(  1536616763),  INT32_C(     1191221),  INT32_C(  1715108111), -INT32_C(   298727258),  INT32_C(  1817627991) } },
+    { { -INT32_C(   790683212), -INT32_C(  2126832363),  INT32_C(  1708547654),  INT32_C(   943997075),  INT32_C(   593187248),  INT32_C(  1502519593),  INT32_C(  1417066345), -INT32_C(  1870449770) },
+      UINT8_C(165),
+      {  INT32_C(   834855916),  INT32_C(  1530513055),  INT32_C(   883637565),  INT32_C(  1709591648),  INT32_C(   352653651),  INT32_C(  1518221953),  INT32_C(  1641599916), -INT32_C(   783682923) },
+      { -INT32_C(  1240538279), -INT32_C(  1265509151),  INT32_C(   453478555),  INT32_C(   988277399), -INT32_C(    23652978), -INT32_C(  1608596681), -INT32_C(  1988281475),  INT32_C(   858641010) },
+      { -INT32_C(  1191498365), -INT32_C(  2126832363), -INT32_C(   816888127),  INT32_C(   943997075),  INT32_C(   593187248), -INT32_C(  1902090233),  INT32_C(  1417066345),  INT32_C(  2091207883) } },
+    { {  INT32_C(   654570737), -INT32_C(  1817132279), -INT32_C(   869632428), -INT32_C(  1355832119), -INT32_C(   759826346), -INT32_C(   511311229),  INT32_C(  1853535180), -INT32_C(  1341258700) },
+      UINT8_C( 93),
+      {  INT32_C(   944145715),  INT32_C(  1314962384), -INT32_C(   851491346),  INT32_C(    16985486), -INT32_C(  1433063611), -INT32_C(   395942709), -INT32_C(  1287020823), -INT32_C(   634344482) },
+      {  INT32_C(  1467564323),  INT32_C(  1425109857), -INT32_C(  1289407568),  INT32_C(  2056344508),  INT32_C(  1862489020), -INT32_C(   278049439),  INT32_C(  2027245010),  INT32_C(   865503192) },
+      { -INT32_C(  1588800034), -INT32_C(  1817132279), -INT32_C(   780423991), -INT32_C(   882663772),  INT32_C(  1272011712), -INT32_C(   511311229),  INT32_C(  1740267061), -INT32_C(  1341258700) } },
+    { {  INT32_C(  2064467408), -INT32_C(  1434192743), -INT32_C(   272578179), -INT32_C(   361221578), -INT32_C(  2101372233), -INT32_C(  1816461469), -INT32_C(  2066384490), -INT32_C(   246555915) },
+      UINT8_C(159),
+      {  INT32_C(   316504423),  INT32_C(  1820669318), -INT32_C(   772490796), -INT32_C(   384458734), -INT32_C(   509083094),  INT32_C(  1325100018),  INT32_C(   382176270), -INT32_C(  1237415538) },
+      { -INT32_C(  1630410192),  INT32_C(   283490457),  INT32_C(   560187996),  INT32_C(   987573059),  INT32_C(  1438138892), -INT32_C(  1827456641),  INT32_C(  1687420540), -INT32_C(   404595672) },
+      {  INT32_C(  1582950324),  INT32_C(  1298236473),  INT32_C(   779421784),  INT32_C(  1745129143),  INT32_C(     9082222), -INT32_C(  1816461469), -INT32_C(  2066384490), -INT32_C(  1570522632) } },
+    { {  INT32_C(   501350958), -INT32_C(   533431153),  INT32_C(  1468953239), -INT32_C(   973066109), -INT32_C(    59194557),  INT32_C(    68209489), -INT32_C(  1470864862), -INT32_C(  1658888959) },
+      UINT8_C(147),
+      {  INT32_C(   113189125),  INT32_C(   436114418), -INT32_C(   299495779), -INT32_C(  1711359205),  INT32_C(  1677912030),  INT32_C(   567841190),  INT32_C(   712913583),  INT32_C(  1610146756) },
+      {  INT32_C(  1587096504),  INT32_C(  1507090984), -INT32_C(  1290163493), -INT32_C(   482647084), -INT32_C(  1520733280), -INT32_C(  1341734516), -INT32_C(   146453177),  INT32_C(   691607480) },
+      { -INT32_C(   935241818), -INT32_C(  1526950283),  INT32_C(  1468953239), -INT32_C(   973066109), -INT32_C(  1174951594),  INT32_C(    68209489), -INT32_C(  1470864862),  INT32_C(   955320910) } },
+    { { -INT32_C(  1033592854), -INT32_C(  1078939359), -INT32_C(  1169401282),  INT32_C(  2044768631), -INT32_C(  1213405373), -INT32_C(  1441517552),  INT32_C(  1256140583), -INT32_C(   953960336) },
+      UINT8_C( 12),
+      { -INT32_C(  1414599798),  INT32_C(   297850844), -INT32_C(  1898983753),  INT32_C(  1709060781),  INT32_C(  1705168205), -INT32_C(  1692042943),  INT32_C(  1883958684),  INT32_C(  1070995530) },
+      {  INT32_C(  1807415168), -INT32_C(   286964449),  INT32_C(  1840269547),  INT32_C(  1142855031),  INT32_C(  2043164218),  INT32_C(  1408941851), -INT32_C(   644688053), -INT32_C(   578843084) },
+      { -INT32_C(  1033592854), -INT32_C(  1078939359), -INT32_C(   206709908), -INT32_C(  1934929657), -INT32_C(  1213405373), -INT32_C(  1441517552),  INT32_C(  1256140583), -INT32_C(   953960336) } },
+    { { -INT32_C(   274166870), -INT32_C(   432515532),  INT32_C(   155307723), -INT32_C(   252192021), -INT32_C(  1421269219),  INT32_C(   248626812),  INT32_C(   274913158),  INT32_C(   241234882) },
+      UINT8_C(110),
+      { -INT32_C(  1238744397),  INT32_C(   117521247),  INT32_C(   495250779), -INT32_C(  1738483959),  INT32_C(    75887275), -INT32_C(  1515017288), -INT32_C(  1495690186), -INT32_C(   741979441) },
+      {  INT32_C(   816042010), -INT32_C(   156778920), -INT32_C(  2080346955), -INT32_C(   303810909), -INT32_C(  1864529328),  INT32_C(  2086956241), -INT32_C(  1088058316),  INT32_C(  1093894062) },
+      { -INT32_C(   274166870),  INT32_C(  1322778025),  INT32_C(   995549440),  INT32_C(   901938041), -INT32_C(  1421269219), -INT32_C(  1427235047),  INT32_C(  1695395785),  INT32_C(   241234882) } },
+    { {  INT32_C(   454115587),  INT32_C(   296406377), -INT32_C(   386175685),  INT32_C(  1018504501), -INT32_C(     5234564), -INT32_C(   478808528),  INT32_C(    87777730),  INT32_C(   708498277) },
+      UINT8_C(103),
+      {  INT32_C(  1987202261), -INT32_C(  1437967246), -INT32_C(  1236632339),  INT32_C(  1707229923),  INT32_C(   452027205), -INT32_C(   509060560),  INT32_C(   582082102), -INT32_C(  2140643230) },
+      { -INT32_C(   969666974),  INT32_C(  1940947271), -INT32_C(  1486487885),  INT32_C(   818935372),  INT32_C(  1440545184),  INT32_C(   587927833), -INT32_C(  1789403919),  INT32_C(   374880872) },
+      { -INT32_C(  1825214067), -INT32_C(  1759732500), -INT32_C(  1623496231),  INT32_C(  1018504501), -INT32_C(     5234564),  INT32_C(   378276034),  INT32_C(  2005771605),  INT32_C(   708498277) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i r = simde_mm256_mask_shldi_epi32(src, test_vec[i].k, a, b, INT32_C( 78));
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_shldi_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t b[8];
+    const int32_t r[8];
+  } test_vec[] = {
+    { UINT8_C(120),
+      { -INT32_C(   242998760),  INT32_C(  1232596086), -INT32_C(   928527209), -INT32_C(  1659691693),  INT32_C(   678451728), -INT32_C(    78423586), -INT32_C(   758133760),  INT32_C(   830438237) },
+      {  INT32_C(   546002775),  INT32_C(  2006731898), -INT32_C(  1327761721),  INT32_C(  1832117497),  INT32_C(  1734990999),  INT32_C(   738484391),  INT32_C(   195977238), -INT32_C(  1899672215) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1901480295),  INT32_C(   755512244), -INT32_C(  1393617406), -INT32_C(   436206121),  INT32_C(           0) } },
+    { UINT8_C(127),
+      { -INT32_C(   165370089), -INT32_C(   868960931),  INT32_C(   226805553),  INT32_C(   881559217), -INT32_C(  1330445880), -INT32_C(   490526423), -INT32_C(   426428131), -INT32_C(   510198521) },
+      { -INT32_C(  1284282083),  INT32_C(   911093346), -INT32_C(   382131822),  INT32_C(  1820942208),  INT32_C(  1789080984),  INT32_C(  2078677588), -INT32_C(  1792203517), -INT32_C(  1246327348) },
+      {  INT32_C(  1401674169),  INT32_C(  1521392423),  INT32_C(  1670968476), -INT32_C(  1017596348), -INT32_C(  2132527791), -INT32_C(  1802191373), -INT32_C(  1668363626),  INT32_C(           0) } },
+    { UINT8_C(192),
+      {  INT32_C(   851148553),  INT32_C(  1017340414),  INT32_C(  1280731688), -INT32_C(  1857080444),  INT32_C(  1458148866), -INT32_C(   355921438),  INT32_C(  1088269047),  INT32_C(   150426570) },
+      { -INT32_C(  1013272291), -INT32_C(   837227082), -INT32_C(  2119788789),  INT32_C(  1809502592),  INT32_C(  1963528055), -INT32_C(   139792625),  INT32_C(  1859744666), -INT32_C(  2143495170) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(   713312404), -INT32_C(  1444593634) } },
+    { UINT8_C(156),
+      { -INT32_C(   905273485), -INT32_C(   395928205),  INT32_C(   599568679), -INT32_C(    50629361), -INT32_C(  1858009823),  INT32_C(   394080652), -INT32_C(  1061859511), -INT32_C(   245505301) },
+      { -INT32_C(  1447931771), -INT32_C(  1403214428),  INT32_C(  1758163257),  INT32_C(   135943168), -INT32_C(    63382636),  INT32_C(    39896363), -INT32_C(  1043845056), -INT32_C(  1026980230) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(  1486074981), -INT32_C(  1165523955), -INT32_C(  2104426980),  INT32_C(           0),  INT32_C(           0), -INT32_C(   243932828) } },
+    { UINT8_C(215),
+      { -INT32_C(  2083466802),  INT32_C(   969946162), -INT32_C(  1196847419),  INT32_C(  1744449709),  INT32_C(  1224571749),  INT32_C(   904316368), -INT32_C(   830601081),  INT32_C(   600190197) },
+      {  INT32_C(  1471581039), -INT32_C(  1565024091), -INT32_C(  1821304551),  INT32_C(  2029993930), -INT32_C(  1654291956),  INT32_C(  2007934442), -INT32_C(  1468505383), -INT32_C(  2055389861) },
+      {  INT32_C(  1759980507),  INT32_C(   437866843), -INT32_C(   949827144),  INT32_C(           0), -INT32_C(  1112355150),  INT32_C(           0),  INT32_C(    71554108),  INT32_C(   377143998) } },
+    { UINT8_C(109),
+      {  INT32_C(  1594437441),  INT32_C(   376838865), -INT32_C(  1521880556), -INT32_C(  1013414500), -INT32_C(  1890092152),  INT32_C(   933671320),  INT32_C(   116600577), -INT32_C(  1918183018) },
+      { -INT32_C(  1880167061), -INT32_C(  1649868926), -INT32_C(   846415998),  INT32_C(  1293530220), -INT32_C(  1603746005), -INT32_C(  1720640165),  INT32_C(  1279951244), -INT32_C(   681193424) },
+      { -INT32_C(  1751070729),  INT32_C(           0), -INT32_C(   116758842),  INT32_C(  1120806540),  INT32_C(           0),  INT32_C(  1489783992), -INT32_C(  1753176539),  INT32_C(           0) } },
+    { UINT8_C( 82),
+      {  INT32_C(   392801384),  INT32_C(   217908525), -INT32_C(  2006647902), -INT32_C(   528577761), -INT32_C(   683837177),  INT32_C(   384921592), -INT32_C(  1645433918),  INT32_C(  2053917700) },
+      {  INT32_C(  1863566868), -INT32_C(   980268863), -INT32_C(  1390047736), -INT32_C(  1580955706),  INT32_C(   311267424),  INT32_C(   842459546),  INT32_C(  2094215588),  INT32_C(   258170866) },
+      {  INT32_C(           0), -INT32_C(  2104040759),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1132230330),  INT32_C(           0),  INT32_C(  1440824937),  INT32_C(           0) } },
+    { UINT8_C(201),
+      {  INT32_C(  1605398586), -INT32_C(  1032151755),  INT32_C(  1659308367),  INT32_C(  2020005302),  INT32_C(  1592210868),  INT32_C(   548910668),  INT32_C(  1741430294), -INT32_C(  1659535175) },
+      { -INT32_C(   392088114),  INT32_C(   462094133),  INT32_C(  1065188141),  INT32_C(   772995353),  INT32_C(  2082650536),  INT32_C(  2023310218),  INT32_C(   174352972), -INT32_C(   467380618) },
+      {  INT32_C(   941454416),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1792743177),  INT32_C(           0),  INT32_C(           0),  INT32_C(   252380466), -INT32_C(  1067650542) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i r = simde_mm256_maskz_shldi_epi32(test_vec[i].k, a, b, INT32_C( 15));
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_shldi_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[4];
+    const int64_t b[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { {  INT64_C( 2610533810570485027),  INT64_C( 5682852384148869594),  INT64_C( 7805347304174390312),  INT64_C(  157265209709072894) },
+      {  INT64_C( 2870620506997751250), -INT64_C(  142397216649822447),  INT64_C( 9213314424132614321),  INT64_C( 2172004981535657675) },
+      {  INT64_C( 5536974299121813781),  INT64_C(  807400798090075929),  INT64_C( 8611738044867881443),  INT64_C( 1091137229828440439) } },
+    { {  INT64_C( 2567720534975463510),  INT64_C( 2073650166117835925), -INT64_C( 2464976138420826696),  INT64_C( 8761983510718751120) },
+      { -INT64_C( 2906465704664068144), -INT64_C( 2643864208816887762),  INT64_C( 6899539390388256256), -INT64_C( 1790913857995337377) },
+      {  INT64_C( 7786747626791777742), -INT64_C(  537857488204668767),  INT64_C( 7436408458809024843),  INT64_C( 1020175514953405805) } },
+    { {  INT64_C( 1442422331520234765), -INT64_C( 4806111553463832666), -INT64_C( 8980897044070245854),  INT64_C( 5265223143857804226) },
+      {  INT64_C( 1292025999950003525),  INT64_C( 3711127900019044155), -INT64_C( 1140982730034160813),  INT64_C( 3957952833602412303) },
+      { -INT64_C( 7589335835639762101),  INT64_C( 4092621477661428329), -INT64_C(  750261946697478108),  INT64_C( 3734874482521557107) } },
+    { {  INT64_C(   41962919635450950),  INT64_C( 2912747110634637340), -INT64_C( 5414592617336645562),  INT64_C( 8676377454216517401) },
+      {  INT64_C( 4504057257381118918), -INT64_C( 4991689965031666090), -INT64_C( 2292305813126115135), -INT64_C( 3101992046712831251) },
+      { -INT64_C( 6413388035783127662),  INT64_C( 8868158513323252513),  INT64_C(  906931857135108229), -INT64_C(  998173535557866807) } },
+    { { -INT64_C( 8827067996384718452),  INT64_C( 7783552346017703324),  INT64_C( 4605495961023797788), -INT64_C( 1890194808079083159) },
+      { -INT64_C(  359998619007705018), -INT64_C( 2340539576089118230), -INT64_C( 7322845341768500208),  INT64_C( 3001131021742453529) },
+      { -INT64_C( 3367457500201629068), -INT64_C( 4410880870333879808), -INT64_C( 3137171490588213908),  INT64_C(  731371265139028190) } },
+    { {  INT64_C( 2922695893841287459), -INT64_C( 5031059457829447244),  INT64_C(   62466353755194067), -INT64_C(  922685734606395520) },
+      { -INT64_C( 5282215791555789667),  INT64_C( 8574052393125812461), -INT64_C( 3924848690836379098), -INT64_C( 7101621379940411996) },
+      { -INT64_C( 5060276945666494891),  INT64_C(  952068345766202970),  INT64_C( 9187542192955636292),  INT64_C( 6758179175506263751) } },
+    { { -INT64_C( 1667509603698049389), -INT64_C( 3956680584459298597),  INT64_C( 4744582014203098218),  INT64_C( 2343914580199968429) },
+      {  INT64_C( 4539008906797297959), -INT64_C( 6210838333712042506), -INT64_C( 2497977153467482078),  INT64_C( 8748796708797070298) },
+      {  INT64_C(  116993327512101716),  INT64_C( 7464213813004000328),  INT64_C( 1305228841720594657),  INT64_C( 3126530988058742841) } },
+    { { -INT64_C( 7539861936374552540), -INT64_C( 6388373654580177992),  INT64_C( 3482430427982543328), -INT64_C( 9120514964827953598) },
+      { -INT64_C( 6207473792458755293),  INT64_C(  624084537208125912), -INT64_C( 1576760177349103056),  INT64_C( 3818810041000469317) },
+      { -INT64_C( 5045710354531230117), -INT64_C( 7911436952316123873), -INT64_C( 5021944341693841855),  INT64_C( 3668622307804897269) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i r = simde_mm256_shldi_epi64(a, b, INT32_C( 38));
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_shldi_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[4];
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t b[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { {  INT64_C( 5546000173083643470), -INT64_C( 9011197034491243590), -INT64_C( 2448723663073340785),  INT64_C( 6812155110588544165) },
+      UINT8_C( 58),
+      { -INT64_C( 5427099533839970611), -INT64_C( 4699562820942633685),  INT64_C( 1644311104085153997), -INT64_C( 5503340651079495728) },
+      { -INT64_C(  352429770843372325),  INT64_C( 6112276975088381366), -INT64_C( 8458520993322488294), -INT64_C( 5203818283020460411) },
+      {  INT64_C( 5546000173083643470), -INT64_C( 8846957713418428013), -INT64_C( 2448723663073340785), -INT64_C( 7195639301435771411) } },
+    { { -INT64_C( 6132960240650758192), -INT64_C(  340836476695598857),  INT64_C( 8853875876963821154),  INT64_C( 1136677492437132304) },
+      UINT8_C(199),
+      { -INT64_C( 4463404637183368774),  INT64_C( 8756320920236631353),  INT64_C( 2752989882355992877), -INT64_C( 5897944216569587226) },
+      { -INT64_C( 1547672194440704251),  INT64_C( 9207760199504812873),  INT64_C( 2247033651329285889), -INT64_C( 6184547722145353917) },
+      { -INT64_C(  673166396441225805), -INT64_C( 9103658997761554569),  INT64_C(  338415693739609302),  INT64_C( 1136677492437132304) } },
+    { { -INT64_C(  537214920957566470),  INT64_C( 7379256522580391179), -INT64_C( 6548436396484000300),  INT64_C( 4072795007348266554) },
+      UINT8_C(239),
+      { -INT64_C(  784824682565075231), -INT64_C( 3933970901160381474), -INT64_C( 4260076444293884484), -INT64_C(  985148691555552593) },
+      {  INT64_C( 4221926622490076556), -INT64_C( 7642981091045815762), -INT64_C( 1345600468828657664), -INT64_C( 8618681472163161162) },
+      {  INT64_C( 3458685686772857150), -INT64_C( 1788782661856441272),  INT64_C( 8549361768250335279),  INT64_C( 4106345947826665304) } },
+    { {  INT64_C(  264094924966224508), -INT64_C( 3498419875763128455), -INT64_C( 3398607408831865968), -INT64_C( 1695403168787121853) },
+      UINT8_C(  8),
+      { -INT64_C( 4100222623911062165),  INT64_C( 3763532934137153412),  INT64_C( 4127961811496566164),  INT64_C( 3551062595547939475) },
+      {  INT64_C( 5469328816370012019),  INT64_C( 8504067033051390811), -INT64_C( 1976649130330742812),  INT64_C( 5708169387700695833) },
+      {  INT64_C(  264094924966224508), -INT64_C( 3498419875763128455), -INT64_C( 3398607408831865968), -INT64_C( 5480699516910865369) } },
+    { {  INT64_C( 7363562787254724737), -INT64_C(  819682742962272380),  INT64_C( 5136768104130051289),  INT64_C( 2303269700960918199) },
+      UINT8_C( 35),
+      { -INT64_C( 5266661014098389343), -INT64_C( 1000309080935391077),  INT64_C( 2304819078024360211),  INT64_C(  454329203763790165) },
+      {  INT64_C( 4519250666162375929), -INT64_C( 7033485419543316048), -INT64_C( 1231433623965283083),  INT64_C( 5384608484905518973) },
+      { -INT64_C( 7992296903525621157),  INT64_C( 5757894899739562408),  INT64_C( 5136768104130051289),  INT64_C( 2303269700960918199) } },
+    { { -INT64_C( 3016688415959945668),  INT64_C( 8201771737273193711),  INT64_C( 3325525312134669149),  INT64_C( 6138759741891875200) },
+      UINT8_C(233),
+      {  INT64_C( 5873852914133004352), -INT64_C( 4075289167424423597),  INT64_C( 1583588008871400378), -INT64_C( 8732545218096380713) },
+      { -INT64_C( 4868810068599214437), -INT64_C(  983992492592367755),  INT64_C( 3832524138604597047), -INT64_C( 4880102694561130253) },
+      {  INT64_C( 8258493611203674745),  INT64_C( 8201771737273193711),  INT64_C( 3325525312134669149), -INT64_C( 7705318186545504991) } },
+    { { -INT64_C( 6926257025041752281), -INT64_C( 2463965819797706294),  INT64_C( 4431555245632395330),  INT64_C(  820702082035408233) },
+      UINT8_C(156),
+      { -INT64_C( 4203930437228563844), -INT64_C(  490011421508815422),  INT64_C( 8345963285001626590), -INT64_C( 7860518267143573309) },
+      { -INT64_C( 6576485888557301122),  INT64_C( 3459427458435558151), -INT64_C( 6861478610155812920), -INT64_C( 2582129814723896661) },
+      { -INT64_C( 6926257025041752281), -INT64_C( 2463965819797706294), -INT64_C( 4730759106790923343),  INT64_C( 2021044170375538511) } },
+    { {  INT64_C( 5164728818634618924),  INT64_C(  537435800249412803), -INT64_C( 8327501384240850293),  INT64_C( 7568137956431382705) },
+      UINT8_C( 28),
+      {  INT64_C( 4140227980427024920), -INT64_C( 6092959568037667697),  INT64_C( 1960132897240104550), -INT64_C( 8515147031505468551) },
+      { -INT64_C( 7508387038775059265), -INT64_C(  196081401187021752),  INT64_C( 6359092507342979546),  INT64_C( 5889243541097011308) },
+      {  INT64_C( 5164728818634618924),  INT64_C(  537435800249412803),  INT64_C( 2553428383535086690),  INT64_C( 4125541712887214867) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi64(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i r = simde_mm256_mask_shldi_epi64(src, test_vec[i].k, a, b, INT32_C(166));
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_shldi_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t b[4];
+    const int64_t r[4];
+  } test_vec[] = {
+    { UINT8_C(240),
+      {  INT64_C( 1889981265353825143), -INT64_C( 2780575165121793022),  INT64_C( 2117774108702568560), -INT64_C( 9015728707927424301) },
+      {  INT64_C( 7587190291288046837), -INT64_C( 5992669754278012699), -INT64_C( 7650951590751097191), -INT64_C( 2877229697351528446) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 86),
+      {  INT64_C( 6372750787151568256), -INT64_C( 5947278442937914954), -INT64_C( 5920863938925876250),  INT64_C( 7873756450467782654) },
+      { -INT64_C( 1453260496878864575), -INT64_C(  171537998782721104), -INT64_C(  703594729225904202),  INT64_C( 1590049093623080597) },
+      {  INT64_C(                   0),  INT64_C( 3203426572657331370),  INT64_C( 8328830796004206889),  INT64_C(                   0) } },
+    { UINT8_C( 10),
+      {  INT64_C( 6426940126387139184),  INT64_C( 7841093617754388293),  INT64_C( 1730153942447329202), -INT64_C( 3036492370667271646) },
+      { -INT64_C(  919561769577407080),  INT64_C( 5790695950263420358),  INT64_C( 2739481377570899400),  INT64_C( 5374836491912780780) },
+      {  INT64_C(                   0),  INT64_C( 7681912432626214054),  INT64_C(                   0), -INT64_C( 7438520357652224007) } },
+    { UINT8_C(146),
+      { -INT64_C( 3045439670431537429),  INT64_C( 6718711537227643004), -INT64_C( 4897536478815956859),  INT64_C(  253446503754241675) },
+      {  INT64_C( 6018509529625342793),  INT64_C( 2256862957824431431),  INT64_C( 5782699590734144291),  INT64_C( 6634954792257263566) },
+      {  INT64_C(                   0),  INT64_C( 7123636947573961613),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(166),
+      { -INT64_C( 1415226885635072839),  INT64_C( 7282780408113101683),  INT64_C( 2846100335952696089),  INT64_C( 6524374233692839185) },
+      { -INT64_C( 3287053662098336981), -INT64_C( 5035974436383638293), -INT64_C( 3764437250138956547), -INT64_C( 4705877650747330174) },
+      {  INT64_C(                   0),  INT64_C( 6970932157318428486), -INT64_C( 3870407485797686777),  INT64_C(                   0) } },
+    { UINT8_C(215),
+      {  INT64_C( 6261439179124377610), -INT64_C( 5281656940414772210),  INT64_C( 4667736392863481553),  INT64_C( 3094302151412520468) },
+      {  INT64_C( 8551139735435436355),  INT64_C(   83288154304798320), -INT64_C( 3624120081996873055),  INT64_C( 4746251403923344820) },
+      {  INT64_C( 3892241730356913225), -INT64_C( 8291682164878929591), -INT64_C( 1927706774777561520),  INT64_C(                   0) } },
+    { UINT8_C(164),
+      {  INT64_C( 2244898563765470985),  INT64_C( 2616073290123366725),  INT64_C( 2250396529704525284),  INT64_C( 3982816571741201057) },
+      { -INT64_C( 7347968829849026185), -INT64_C( 5391000401052867743),  INT64_C(  910266561614235106),  INT64_C( 4879650830647382502) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 7471174940796210871),  INT64_C(                   0) } },
+    { UINT8_C( 75),
+      {  INT64_C( 6073175090330992781), -INT64_C( 1069648776917973426),  INT64_C( 3350163665937146836), -INT64_C(  552185619473911764) },
+      { -INT64_C( 1222422068536566700), -INT64_C(  322961935051674082),  INT64_C( 3343055472011276860),  INT64_C( 5660330457932628050) },
+      { -INT64_C(  648440317446795909), -INT64_C( 5781734075529303452),  INT64_C(                   0), -INT64_C( 7577282015104055320) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i r = simde_mm256_maskz_shldi_epi64(test_vec[i].k, a, b, INT32_C( 39));
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_shldi_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t a[32];
+    const int16_t b[32];
+    const int16_t r[32];
+  } test_vec[] = {
+    { {  INT16_C( 31198),  INT16_C( 10889),  INT16_C(  6544),  INT16_C(  5365),  INT16_C( 16986),  INT16_C( 23500), -INT16_C(  5791), -INT16_C( 13926),
+         INT16_C( 11144),  INT16_C( 26253), -INT16_C( 31746), -INT16_C( 12748), -INT16_C( 16555),  INT16_C(  1148),  INT16_C(  8162),  INT16_C( 25845),
+         INT16_C( 11770),  INT16_C( 25319),  INT16_C(  6592), -INT16_C( 25873),  INT16_C(  4967),  INT16_C( 18613),  INT16_C(  4142),  INT16_C( 28080),
+        -INT16_C( 25239), -INT16_C( 23020),  INT16_C( 14673),  INT16_C( 22707), -INT16_C( 21970), -INT16_C( 17771),  INT16_C(  6893),  INT16_C( 11290) },
+      {  INT16_C( 32708), -INT16_C(  3775), -INT16_C( 15266),  INT16_C(  8027),  INT16_C( 19075),  INT16_C( 28212), -INT16_C( 26556), -INT16_C( 15651),
+        -INT16_C(  9551),  INT16_C( 24797), -INT16_C(  6702), -INT16_C(  1470),  INT16_C( 15701),  INT16_C( 11415), -INT16_C( 26552),  INT16_C( 23267),
+        -INT16_C(    16), -INT16_C(  9772), -INT16_C( 29094),  INT16_C( 20815),  INT16_C( 13067),  INT16_C(  1343),  INT16_C(  1373), -INT16_C( 12035),
+        -INT16_C( 31367), -INT16_C(  7730), -INT16_C( 25056), -INT16_C( 21665),  INT16_C( 29740), -INT16_C(  3476), -INT16_C( 23247),  INT16_C( 28550) },
+      { -INT16_C(  8577), -INT16_C( 30223), -INT16_C( 28476), -INT16_C(  2785),  INT16_C( 23114), -INT16_C( 13202),  INT16_C( 24984), -INT16_C( 25918),
+        -INT16_C( 30502), -INT16_C( 29344), -INT16_C(   283),  INT16_C( 13562),  INT16_C( 21821),  INT16_C( 31788), -INT16_C(  7528), -INT16_C(  2726),
+        -INT16_C(  1281), -INT16_C(  6183), -INT16_C( 16242), -INT16_C(  4271),  INT16_C( 26419), -INT16_C( 19195),  INT16_C( 11781), -INT16_C( 20272),
+         INT16_C( 27013),  INT16_C(  5345),  INT16_C( 20894), -INT16_C( 19541),  INT16_C( 11892), -INT16_C( 27150), -INT16_C(  4699),  INT16_C(  6767) } },
+    { { -INT16_C( 31196), -INT16_C( 13091), -INT16_C( 17131),  INT16_C( 29198), -INT16_C(  5020),  INT16_C( 12053), -INT16_C(  3313), -INT16_C( 32176),
+         INT16_C( 12129),  INT16_C( 24779), -INT16_C( 19480), -INT16_C( 12914),  INT16_C( 23148),  INT16_C( 20080), -INT16_C( 15438), -INT16_C(  5710),
+         INT16_C( 31812),  INT16_C( 29822),  INT16_C(   970),  INT16_C(  4283),  INT16_C( 10360), -INT16_C(   412), -INT16_C(  9453),  INT16_C( 22442),
+        -INT16_C(  3247), -INT16_C( 13370),  INT16_C( 24166), -INT16_C( 14384),  INT16_C( 17470), -INT16_C(  4026), -INT16_C(  5937), -INT16_C( 16235) },
+      {  INT16_C(  7015),  INT16_C(  8321),  INT16_C(  7076),  INT16_C(  1901), -INT16_C(  9477), -INT16_C(  5959),  INT16_C( 21193),  INT16_C( 29300),
+         INT16_C( 31626), -INT16_C( 12041), -INT16_C( 21799),  INT16_C(  1391),  INT16_C( 13087), -INT16_C( 20187), -INT16_C(   400),  INT16_C(  7867),
+         INT16_C( 23512), -INT16_C( 18199), -INT16_C( 28939),  INT16_C(  3449),  INT16_C(  5343), -INT16_C( 12724),  INT16_C( 10499),  INT16_C( 31491),
+        -INT16_C(  5981),  INT16_C( 16219),  INT16_C( 15035), -INT16_C( 14774),  INT16_C(  5383),  INT16_C( 31025),  INT16_C( 21681),  INT16_C( 21944) },
+      {  INT16_C(  9243), -INT16_C(  8928),  INT16_C(  5403),  INT16_C(  3591),  INT16_C( 25818),  INT16_C(  5608),  INT16_C(  3922),  INT16_C( 20594),
+         INT16_C( 24955), -INT16_C( 13360), -INT16_C(  5974), -INT16_C( 29179),  INT16_C( 27699),  INT16_C( 28849), -INT16_C( 19714), -INT16_C( 19938),
+         INT16_C( 17499),  INT16_C( 32440), -INT16_C( 13682), -INT16_C( 17651),  INT16_C( 30740),  INT16_C( 25806),  INT16_C(  4905), -INT16_C( 21893),
+         INT16_C( 20968), -INT16_C( 14785),  INT16_C( 26170), -INT16_C( 12090),  INT16_C( 15893),  INT16_C( 18041), -INT16_C( 12460), -INT16_C( 27307) } },
+    { { -INT16_C(  8879), -INT16_C( 25034),  INT16_C(  1831), -INT16_C(   789),  INT16_C( 17761),  INT16_C( 18199),  INT16_C( 12605), -INT16_C(  5433),
+        -INT16_C( 16059),  INT16_C( 30624), -INT16_C( 28993), -INT16_C(  6787),  INT16_C( 16334),  INT16_C( 23701), -INT16_C(  5172),  INT16_C( 14386),
+         INT16_C(  5156),  INT16_C( 17432), -INT16_C( 11140),  INT16_C(   757),  INT16_C( 24016),  INT16_C( 13533),  INT16_C( 27610),  INT16_C( 20821),
+        -INT16_C(  2323),  INT16_C( 22825),  INT16_C( 19745),  INT16_C(  3727),  INT16_C( 15850), -INT16_C( 23223),  INT16_C(  9328), -INT16_C(   592) },
+      { -INT16_C( 14784),  INT16_C( 26409),  INT16_C( 27353), -INT16_C(  3040),  INT16_C( 19101),  INT16_C(  9752), -INT16_C( 31680),  INT16_C( 17597),
+         INT16_C( 27702), -INT16_C(   120),  INT16_C( 16394), -INT16_C( 31266),  INT16_C( 29810), -INT16_C( 31206), -INT16_C( 30963), -INT16_C(  1446),
+         INT16_C(  6901),  INT16_C( 19908), -INT16_C( 20283),  INT16_C( 23751),  INT16_C( 28650), -INT16_C(   191), -INT16_C( 24564),  INT16_C(  6313),
+        -INT16_C( 30698),  INT16_C( 20305), -INT16_C( 14041),  INT16_C(  1982), -INT16_C( 12121), -INT16_C(  4969), -INT16_C( 24753),  INT16_C( 19472) },
+      {  INT16_C( 20934),  INT16_C( 13927),  INT16_C( 10090), -INT16_C(  5132),  INT16_C( 24906),  INT16_C(  5926),  INT16_C( 15748), -INT16_C( 14524),
+         INT16_C( 17772), -INT16_C( 24321), -INT16_C( 16576),  INT16_C( 32133), -INT16_C( 12684), -INT16_C( 27258), -INT16_C( 13177),  INT16_C( 13050),
+         INT16_C(  9242),  INT16_C(  6221),  INT16_C( 31920), -INT16_C(  2724), -INT16_C( 12177), -INT16_C(  8705), -INT16_C(  9568),  INT16_C( 21784),
+        -INT16_C(  4728),  INT16_C( 10575),  INT16_C(  8649), -INT16_C( 28921), -INT16_C(  5424),  INT16_C( 18924),  INT16_C( 28831), -INT16_C( 20404) } },
+    { {  INT16_C( 27692),  INT16_C( 21000), -INT16_C( 14912),  INT16_C(   492),  INT16_C( 30983),  INT16_C(   757), -INT16_C( 30236),  INT16_C(  4602),
+        -INT16_C( 18619), -INT16_C( 11850),  INT16_C( 26184),  INT16_C(   498), -INT16_C(  3865), -INT16_C( 23317), -INT16_C( 30905),  INT16_C( 11696),
+        -INT16_C( 29449), -INT16_C( 28891),  INT16_C( 24468),  INT16_C( 31375),  INT16_C( 26522), -INT16_C( 28001), -INT16_C( 15669),  INT16_C( 15023),
+         INT16_C(  8614),  INT16_C(  1905), -INT16_C( 11965), -INT16_C(  9344),  INT16_C( 13796), -INT16_C(  9353), -INT16_C( 10256), -INT16_C( 25482) },
+      {  INT16_C(  4313), -INT16_C( 30600), -INT16_C(  5467), -INT16_C(  8439), -INT16_C( 24692), -INT16_C( 14304), -INT16_C( 17565), -INT16_C( 23530),
+         INT16_C( 17753), -INT16_C( 17553),  INT16_C(  9642), -INT16_C(  3265), -INT16_C(  3992), -INT16_C(  4249),  INT16_C( 10666), -INT16_C( 21803),
+         INT16_C(  9857), -INT16_C(  1576), -INT16_C( 16440),  INT16_C(  9732), -INT16_C(  7686), -INT16_C( 16270),  INT16_C( 10457),  INT16_C( 22632),
+        -INT16_C(  8616),  INT16_C( 16011),  INT16_C( 30612),  INT16_C( 30525),  INT16_C(   781), -INT16_C( 23695),  INT16_C( 14958),  INT16_C( 27702) },
+      {  INT16_C( 11280),  INT16_C(  2184), -INT16_C( 16150), -INT16_C(  4897),  INT16_C(  1951), -INT16_C(  2616), -INT16_C(  6981), -INT16_C(  1372),
+         INT16_C( 17733), -INT16_C( 18757),  INT16_C( 18469), -INT16_C(  3341), -INT16_C(  6160), -INT16_C(  5137),  INT16_C( 18217), -INT16_C( 20310),
+        -INT16_C(  2266),  INT16_C(  9721), -INT16_C( 27457), -INT16_C( 28890), -INT16_C( 25887), -INT16_C( 24640), -INT16_C( 13528), -INT16_C( 20648),
+        -INT16_C( 22818),  INT16_C( 28990),  INT16_C( 17271), -INT16_C( 32649), -INT16_C(  7165),  INT16_C( 30627), -INT16_C(  4038),  INT16_C( 30316) } },
+    { {  INT16_C(  2488), -INT16_C(  5777),  INT16_C( 26500), -INT16_C( 26247),  INT16_C( 22056),  INT16_C(  4544), -INT16_C( 10575), -INT16_C(  2933),
+        -INT16_C( 15727),  INT16_C(  1313),  INT16_C( 18735), -INT16_C( 15151), -INT16_C( 26383),  INT16_C(  8861), -INT16_C( 14224),  INT16_C(  1811),
+         INT16_C( 19809),  INT16_C( 13025), -INT16_C( 14286),  INT16_C( 17569),  INT16_C(   120), -INT16_C( 18398),  INT16_C( 20765),  INT16_C(  5379),
+         INT16_C( 17093), -INT16_C( 27080),  INT16_C( 10961),  INT16_C( 31656), -INT16_C( 32003),  INT16_C( 17567),  INT16_C( 10738), -INT16_C( 19295) },
+      {  INT16_C( 25297), -INT16_C( 12804), -INT16_C(  5084),  INT16_C( 23239),  INT16_C( 32254), -INT16_C(  4929),  INT16_C( 14097),  INT16_C(  4887),
+         INT16_C( 17611),  INT16_C( 29264),  INT16_C( 29774),  INT16_C( 23994), -INT16_C( 13635), -INT16_C( 25435), -INT16_C( 26757), -INT16_C( 30108),
+         INT16_C(  2843), -INT16_C( 24943), -INT16_C(  9939),  INT16_C( 24622),  INT16_C(  4110), -INT16_C( 23450),  INT16_C(  7383),  INT16_C( 24460),
+         INT16_C( 23729), -INT16_C(  9668),  INT16_C( 24759),  INT16_C( 32154),  INT16_C( 21277), -INT16_C( 26763), -INT16_C( 11138), -INT16_C( 19125) },
+      { -INT16_C( 18334),  INT16_C( 28621), -INT16_C( 31508),  INT16_C( 31066),  INT16_C( 10365), -INT16_C( 16148), -INT16_C( 20169), -INT16_C( 29933),
+        -INT16_C( 28348),  INT16_C(  8562),  INT16_C( 12148), -INT16_C( 11939), -INT16_C(  3638), -INT16_C( 25188),  INT16_C( 28823),  INT16_C(  5002),
+         INT16_C( 24843), -INT16_C(  7778),  INT16_C( 13017), -INT16_C( 24224),  INT16_C( 30736),  INT16_C(  8868),  INT16_C(  7452),  INT16_C(   863),
+        -INT16_C( 15012),  INT16_C( 14554), -INT16_C( 11936), -INT16_C( 22403), -INT16_C(   685), -INT16_C( 24681), -INT16_C(  3372), -INT16_C( 24139) } },
+    { {  INT16_C( 20092), -INT16_C( 21932), -INT16_C( 25365), -INT16_C(  9429),  INT16_C( 15972),  INT16_C(  2558), -INT16_C(  8561),  INT16_C( 24757),
+         INT16_C( 21548),  INT16_C( 19934), -INT16_C( 29349), -INT16_C(  5004), -INT16_C(  7467),  INT16_C( 18175),  INT16_C( 25720),  INT16_C(  7718),
+        -INT16_C(  2160), -INT16_C(  2590), -INT16_C(  1980),  INT16_C( 13167),  INT16_C( 12663), -INT16_C(  8421), -INT16_C( 25194), -INT16_C( 25644),
+        -INT16_C( 18322), -INT16_C(  5799),  INT16_C(  3100), -INT16_C( 26020), -INT16_C( 10397),  INT16_C(  2032), -INT16_C( 29945),  INT16_C( 21980) },
+      {  INT16_C( 17541),  INT16_C( 28764), -INT16_C(  7224), -INT16_C( 27558), -INT16_C(  4255), -INT16_C( 31832),  INT16_C( 20462), -INT16_C( 10953),
+         INT16_C( 12724),  INT16_C( 14049),  INT16_C( 30688),  INT16_C( 30935),  INT16_C( 19372),  INT16_C( 25289), -INT16_C( 28738), -INT16_C(  4526),
+        -INT16_C(  1711),  INT16_C(  5566),  INT16_C( 25449), -INT16_C( 20203),  INT16_C( 15926),  INT16_C( 27082), -INT16_C( 19707), -INT16_C( 25988),
+        -INT16_C(  8551), -INT16_C( 15069), -INT16_C(  4064), -INT16_C( 20119),  INT16_C(  3600),  INT16_C( 28734),  INT16_C(  5748),  INT16_C(  8748) },
+      {  INT16_C( 31812),  INT16_C( 21616), -INT16_C(  5149),  INT16_C( 11156),  INT16_C( 25839), -INT16_C(   381), -INT16_C( 28849), -INT16_C( 18987),
+         INT16_C( 11313), -INT16_C(  8650),  INT16_C( 23415),  INT16_C( 29816), -INT16_C( 10933), -INT16_C(   158),  INT16_C( 30863),  INT16_C(  9966),
+        -INT16_C( 28423), -INT16_C(  7659),  INT16_C( 17507),  INT16_C( 28593),  INT16_C( 30526),  INT16_C(  7017), -INT16_C( 26957), -INT16_C( 11110),
+         INT16_C( 28382),  INT16_C( 22981),  INT16_C(  7408),  INT16_C( 23729),  INT16_C( 25358), -INT16_C(  3984),  INT16_C(  1814), -INT16_C(  9182) } },
+    { {  INT16_C( 11593),  INT16_C( 12599), -INT16_C( 28445),  INT16_C( 30021),  INT16_C( 24755),  INT16_C( 10730),  INT16_C( 14101), -INT16_C(  2367),
+         INT16_C( 10415), -INT16_C( 10310), -INT16_C(  7632),  INT16_C( 26457), -INT16_C( 23747),  INT16_C( 25648),  INT16_C(  4994), -INT16_C( 30525),
+        -INT16_C( 15731), -INT16_C(  2197), -INT16_C( 32230), -INT16_C( 17627), -INT16_C( 16972), -INT16_C(  8238),  INT16_C( 10712), -INT16_C( 29541),
+         INT16_C(  9955), -INT16_C( 27756), -INT16_C( 19520),  INT16_C(  9206), -INT16_C( 28851),  INT16_C( 28164), -INT16_C( 27046), -INT16_C( 26859) },
+      {  INT16_C( 29602),  INT16_C( 27929),  INT16_C( 26927),  INT16_C( 15077), -INT16_C(  6640),  INT16_C(  3403), -INT16_C( 17101), -INT16_C( 10230),
+        -INT16_C( 19211),  INT16_C(  2749),  INT16_C( 23492), -INT16_C( 23375),  INT16_C( 11475),  INT16_C( 15968),  INT16_C(  6208),  INT16_C(  7124),
+        -INT16_C( 27001),  INT16_C(  5983), -INT16_C( 19155), -INT16_C(  3098), -INT16_C( 25708),  INT16_C( 27196),  INT16_C( 27066),  INT16_C(  4325),
+        -INT16_C( 32352),  INT16_C( 16956),  INT16_C(  2470), -INT16_C( 12041), -INT16_C( 19239), -INT16_C( 18147),  INT16_C( 13816), -INT16_C( 24793) },
+      {  INT16_C( 18803),  INT16_C( 14189), -INT16_C(  7319),  INT16_C( 17722), -INT16_C( 19482), -INT16_C(  5619),  INT16_C(  5565), -INT16_C( 15912),
+        -INT16_C( 20556), -INT16_C( 17910),  INT16_C( 12379),  INT16_C( 22948),  INT16_C( 15660),  INT16_C( 12350), -INT16_C( 32232), -INT16_C( 15589),
+        -INT16_C( 29290),  INT16_C( 27415),  INT16_C(  6837),  INT16_C(  9715), -INT16_C( 19301), -INT16_C( 11670), -INT16_C( 10135), -INT16_C( 25840),
+        -INT16_C(  7295), -INT16_C( 27582), -INT16_C( 16375), -INT16_C(  2352),  INT16_C( 19892),  INT16_C(  1209),  INT16_C( 23093),  INT16_C(  5535) } },
+    { { -INT16_C( 20390), -INT16_C( 17037),  INT16_C( 13296),  INT16_C( 22829),  INT16_C( 31065), -INT16_C( 15503), -INT16_C( 30288), -INT16_C( 29750),
+        -INT16_C( 21934),  INT16_C( 25301), -INT16_C( 18006),  INT16_C(  3074), -INT16_C( 26130), -INT16_C(  4052),  INT16_C( 30477),  INT16_C(  2871),
+        -INT16_C( 17197),  INT16_C( 16251),  INT16_C( 29451), -INT16_C(   337),  INT16_C( 12447), -INT16_C( 28644), -INT16_C(  7441), -INT16_C( 29359),
+         INT16_C(  3124), -INT16_C( 28742), -INT16_C(  2646), -INT16_C(  3516), -INT16_C( 18083), -INT16_C(  6058), -INT16_C( 31385),  INT16_C( 20606) },
+      { -INT16_C( 23086),  INT16_C(  9232), -INT16_C(  3618), -INT16_C( 16480), -INT16_C( 18494),  INT16_C( 18890),  INT16_C(  7881), -INT16_C( 19942),
+         INT16_C( 23269),  INT16_C( 20404),  INT16_C( 25457), -INT16_C(   155), -INT16_C( 30128), -INT16_C( 26323), -INT16_C( 15994),  INT16_C( 23140),
+        -INT16_C( 11262),  INT16_C( 14563), -INT16_C( 15316),  INT16_C( 16661),  INT16_C(  1793),  INT16_C( 15517), -INT16_C(  4194), -INT16_C( 31798),
+        -INT16_C( 22506), -INT16_C( 22727),  INT16_C( 22106),  INT16_C( 25644), -INT16_C( 27090),  INT16_C( 31881),  INT16_C( 14430), -INT16_C( 25074) },
+      {  INT16_C( 23205),  INT16_C( 29476), -INT16_C(  3855),  INT16_C( 11711),  INT16_C( 22967),  INT16_C( 29001), -INT16_C( 20450), -INT16_C( 13646),
+         INT16_C( 21082), -INT16_C( 10929), -INT16_C( 21917),  INT16_C(   767), -INT16_C(  4470),  INT16_C( 11417),  INT16_C(  3521),  INT16_C( 14170),
+        -INT16_C( 11308),  INT16_C( 31544),  INT16_C(  3012), -INT16_C( 20671), -INT16_C( 24825),  INT16_C(  7228), -INT16_C(  4113),  INT16_C( 20867),
+         INT16_C( 13480), -INT16_C( 17753), -INT16_C( 21930),  INT16_C( 17508),  INT16_C( 23958),  INT16_C( 22140),  INT16_C( 26424),  INT16_C( 32414) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi16(test_vec[i].b);
+    simde__m512i r = simde_mm512_shldi_epi16(a, b, INT32_C(  8));
+    simde_test_x86_assert_equal_i16x32(r, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_shldi_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int16_t src[32];
+    const simde__mmask32 k;
+    const int16_t a[32];
+    const int16_t b[32];
+    const int16_t r[32];
+  } test_vec[] = {
+    { { -INT16_C( 29238), -INT16_C(  6190),  INT16_C(  8800),  INT16_C( 16948),  INT16_C( 19486), -INT16_C( 17956), -INT16_C(  1638),  INT16_C(  8682),
+         INT16_C( 11045),  INT16_C( 31427),  INT16_C( 10132), -INT16_C( 26839),  INT16_C( 22958), -INT16_C( 32063), -INT16_C( 17739), -INT16_C(  6789),
+         INT16_C(  3474), -INT16_C( 26343),  INT16_C( 14954),  INT16_C(   968),  INT16_C( 29963), -INT16_C(   775), -INT16_C(  3811), -INT16_C( 12786),
+         INT16_C( 20167),  INT16_C( 25644),  INT16_C( 24506),  INT16_C( 14197), -INT16_C( 23391), -INT16_C(  6473), -INT16_C( 15547),  INT16_C(  5038) },
+      UINT32_C(2237169738),
+      { -INT16_C( 23217),  INT16_C( 31320), -INT16_C( 27068),  INT16_C( 17541), -INT16_C( 26646), -INT16_C( 21604), -INT16_C( 10346), -INT16_C(  9790),
+         INT16_C(  6262), -INT16_C(  7572),  INT16_C( 20689), -INT16_C( 23494),  INT16_C( 16159), -INT16_C( 17561), -INT16_C( 12772),  INT16_C( 25395),
+         INT16_C( 25965), -INT16_C(  1877), -INT16_C( 31539),  INT16_C( 14523),  INT16_C(  9184), -INT16_C( 18635), -INT16_C( 32740),  INT16_C( 21269),
+         INT16_C( 32123),  INT16_C( 26987), -INT16_C( 16251), -INT16_C( 29401),  INT16_C( 10324), -INT16_C( 20394),  INT16_C(  2211), -INT16_C( 23950) },
+      {  INT16_C(  2235),  INT16_C( 31110), -INT16_C(   215),  INT16_C( 17350),  INT16_C( 17175),  INT16_C(  9009),  INT16_C( 28893),  INT16_C(  3522),
+         INT16_C(  9445), -INT16_C( 27772),  INT16_C(   470),  INT16_C( 29353), -INT16_C( 30798),  INT16_C( 22464),  INT16_C( 30571), -INT16_C( 29371),
+         INT16_C( 12218), -INT16_C(  7039), -INT16_C(  6473), -INT16_C(  3903),  INT16_C( 18189), -INT16_C( 26489), -INT16_C( 27473), -INT16_C( 22187),
+         INT16_C(  4050), -INT16_C( 23291), -INT16_C( 27168), -INT16_C( 31766), -INT16_C(  8744),  INT16_C( 23092),  INT16_C( 27122), -INT16_C(  8947) },
+      { -INT16_C( 29238),  INT16_C( 22649),  INT16_C(  8800), -INT16_C( 31421),  INT16_C( 19486), -INT16_C( 17956), -INT16_C( 27024),  INT16_C(  8682),
+         INT16_C( 11045),  INT16_C( 31427),  INT16_C( 10132), -INT16_C( 26839),  INT16_C( 22958), -INT16_C( 32063), -INT16_C( 17739),  INT16_C( 13197),
+         INT16_C(  3474), -INT16_C( 26343),  INT16_C( 14954), -INT16_C( 17424), -INT16_C(  8121), -INT16_C(   775),  INT16_C(  7316), -INT16_C( 12786),
+         INT16_C( 31503),  INT16_C( 25644), -INT16_C( 31339),  INT16_C( 14197), -INT16_C( 23391), -INT16_C(  6473), -INT16_C( 15547),  INT16_C( 29405) } },
+    { { -INT16_C(  7756),  INT16_C( 23010), -INT16_C( 32449), -INT16_C(  3998), -INT16_C(  1327),  INT16_C(  6809), -INT16_C( 28736),  INT16_C( 20532),
+         INT16_C( 30768),  INT16_C( 10282),  INT16_C( 28222), -INT16_C(  9286),  INT16_C( 30634),  INT16_C(   763), -INT16_C( 12812),  INT16_C( 13288),
+        -INT16_C(  8573), -INT16_C(  1873), -INT16_C( 25399), -INT16_C(  7469), -INT16_C( 18265), -INT16_C( 31399), -INT16_C( 13440), -INT16_C( 16376),
+        -INT16_C( 31483), -INT16_C( 17888),  INT16_C(  5389), -INT16_C( 30539), -INT16_C( 15009), -INT16_C(  7780),  INT16_C( 32160), -INT16_C( 32413) },
+      UINT32_C(3143852471),
+      {  INT16_C(  2464),  INT16_C(  3803), -INT16_C( 29284), -INT16_C( 18358), -INT16_C( 11081),  INT16_C( 14155),  INT16_C(  1705),  INT16_C(  7266),
+         INT16_C( 24674),  INT16_C( 23530),  INT16_C( 13119), -INT16_C(  2247), -INT16_C( 18830),  INT16_C( 27477), -INT16_C( 14051),  INT16_C( 21942),
+        -INT16_C( 31363), -INT16_C(  8784),  INT16_C( 19884),  INT16_C( 17775),  INT16_C(  8927),  INT16_C( 25718), -INT16_C(  1062), -INT16_C( 14412),
+         INT16_C(  3550),  INT16_C( 17059), -INT16_C( 19354),  INT16_C( 29453),  INT16_C( 15033), -INT16_C(  7660),  INT16_C( 21277), -INT16_C(  6943) },
+      { -INT16_C( 32487), -INT16_C(  1096),  INT16_C(   606),  INT16_C( 14886),  INT16_C( 18462), -INT16_C( 30620), -INT16_C( 16717), -INT16_C( 20207),
+        -INT16_C( 25594),  INT16_C( 12061),  INT16_C( 29929), -INT16_C(  5240), -INT16_C(  6756), -INT16_C( 10264),  INT16_C( 19896),  INT16_C( 22891),
+         INT16_C( 21715),  INT16_C( 23464),  INT16_C(   147), -INT16_C(  8178), -INT16_C( 13071), -INT16_C(  8347), -INT16_C( 21076),  INT16_C( 12204),
+        -INT16_C( 21153),  INT16_C( 12816),  INT16_C( 21076), -INT16_C( 29724),  INT16_C( 26022), -INT16_C( 30555),  INT16_C( 19835), -INT16_C( 20707) },
+      { -INT16_C( 24447), -INT16_C(  9221), -INT16_C( 25598), -INT16_C(  3998), -INT16_C( 18616),  INT16_C( 19336), -INT16_C( 28736),  INT16_C( 25265),
+         INT16_C( 25244),  INT16_C( 10282),  INT16_C( 28222), -INT16_C(  9286),  INT16_C( 30634),  INT16_C( 21975),  INT16_C(  7501),  INT16_C( 13288),
+         INT16_C( 32084), -INT16_C( 20389), -INT16_C( 25399), -INT16_C(  7469), -INT16_C( 18265),  INT16_C( 30431), -INT16_C(  9555), -INT16_C( 16376),
+        -INT16_C(  8531), -INT16_C( 23758),  INT16_C(  5389),  INT16_C(  3467), -INT16_C( 18075),  INT16_C(  5256),  INT16_C( 32160), -INT16_C(  7761) } },
+    { { -INT16_C(  5439),  INT16_C( 18231),  INT16_C(  9041),  INT16_C(  2875), -INT16_C(  6915),  INT16_C( 16239),  INT16_C( 11609),  INT16_C(  5769),
+         INT16_C( 14260), -INT16_C( 28015), -INT16_C(  9481), -INT16_C(  8841), -INT16_C(  4072), -INT16_C( 28309), -INT16_C( 26720), -INT16_C( 30188),
+         INT16_C(  8561),  INT16_C( 32115),  INT16_C( 18665),  INT16_C(  4102), -INT16_C( 19886),  INT16_C( 16057),  INT16_C( 29608),  INT16_C( 26351),
+         INT16_C( 17422),  INT16_C( 27700),  INT16_C( 20922), -INT16_C( 14623),  INT16_C( 18169), -INT16_C(  3020), -INT16_C( 22393),  INT16_C( 32447) },
+      UINT32_C(3182217233),
+      {  INT16_C( 24180), -INT16_C(   954),  INT16_C(  1235), -INT16_C(  8302), -INT16_C( 26170), -INT16_C(  4600),  INT16_C(  2183),  INT16_C( 12296),
+         INT16_C(   472), -INT16_C( 18577), -INT16_C(  2480), -INT16_C( 13051),  INT16_C(  6058), -INT16_C(  7021), -INT16_C( 30385),  INT16_C( 28080),
+        -INT16_C( 26827),  INT16_C( 11220),  INT16_C( 12623), -INT16_C( 16253),  INT16_C( 21827), -INT16_C( 14493), -INT16_C( 24576), -INT16_C( 18633),
+        -INT16_C(  6200),  INT16_C( 13246), -INT16_C( 23281),  INT16_C(  6646), -INT16_C(  1797),  INT16_C(  1747), -INT16_C(  4130), -INT16_C( 30600) },
+      {  INT16_C(  4791), -INT16_C( 32202),  INT16_C( 10393),  INT16_C(  1062),  INT16_C(  9210),  INT16_C( 16589),  INT16_C( 24050), -INT16_C( 27807),
+        -INT16_C(  9280),  INT16_C( 12728), -INT16_C( 13953),  INT16_C( 27526), -INT16_C( 10411), -INT16_C( 14740),  INT16_C( 17561), -INT16_C(  1976),
+        -INT16_C( 17589),  INT16_C(  1566), -INT16_C( 29698),  INT16_C( 20020), -INT16_C( 24504),  INT16_C( 24825),  INT16_C( 19896), -INT16_C( 30901),
+         INT16_C( 10138), -INT16_C(  1693),  INT16_C(  3472),  INT16_C( 29531), -INT16_C( 28423), -INT16_C(   785),  INT16_C( 24407),  INT16_C( 28993) },
+      {  INT16_C( 29714),  INT16_C( 18231),  INT16_C(  9041),  INT16_C(  2875), -INT16_C( 14813),  INT16_C( 16239),  INT16_C( 11609),  INT16_C(  5769),
+         INT16_C( 14260), -INT16_C( 28015), -INT16_C(  9481),  INT16_C(  1387), -INT16_C(  4072), -INT16_C( 28309),  INT16_C( 20292), -INT16_C( 20232),
+         INT16_C(  8561),  INT16_C( 32115),  INT16_C( 20363), -INT16_C( 31922), -INT16_C( 19886),  INT16_C( 25440),  INT16_C( 29608),  INT16_C( 14215),
+        -INT16_C( 14297),  INT16_C( 27700),  INT16_C(  3853), -INT16_C(  2445), -INT16_C(  1136), -INT16_C( 11268), -INT16_C( 22393),  INT16_C( 30833) } },
+    { { -INT16_C( 19338),  INT16_C(  2287),  INT16_C( 30750), -INT16_C(  4132), -INT16_C( 32340), -INT16_C( 20518), -INT16_C( 29274), -INT16_C(  5626),
+         INT16_C( 13091),  INT16_C(  4913),  INT16_C( 21155),  INT16_C( 26032), -INT16_C(  1745), -INT16_C( 19986), -INT16_C( 15800), -INT16_C(  2329),
+         INT16_C( 15217),  INT16_C( 23329),  INT16_C( 17065), -INT16_C(  5072),  INT16_C( 14113), -INT16_C( 22907), -INT16_C(  3843),  INT16_C( 28435),
+         INT16_C( 13501),  INT16_C( 12334),  INT16_C( 10832),  INT16_C( 14884),  INT16_C( 10846), -INT16_C( 10196),  INT16_C( 32413), -INT16_C( 30188) },
+      UINT32_C(   5951082),
+      {  INT16_C( 13001), -INT16_C(  7106), -INT16_C( 30961), -INT16_C( 13834),  INT16_C( 19488),  INT16_C( 17822), -INT16_C(  8549), -INT16_C( 21667),
+        -INT16_C( 20518), -INT16_C( 25000),  INT16_C( 24889),  INT16_C( 18135), -INT16_C( 21106), -INT16_C(  8212), -INT16_C( 15752), -INT16_C( 32403),
+        -INT16_C( 24524), -INT16_C( 20177), -INT16_C( 32240), -INT16_C(  9359), -INT16_C(  4670),  INT16_C( 25668), -INT16_C( 15408),  INT16_C( 27154),
+        -INT16_C( 24644), -INT16_C( 27692),  INT16_C( 10668), -INT16_C(  6961), -INT16_C( 16621), -INT16_C( 17372),  INT16_C( 23169), -INT16_C( 14384) },
+      { -INT16_C( 21568), -INT16_C( 19868), -INT16_C(  6005),  INT16_C(  7965), -INT16_C( 15719), -INT16_C( 18801),  INT16_C( 20111),  INT16_C( 13784),
+         INT16_C( 26959), -INT16_C( 28977),  INT16_C(   677), -INT16_C( 32138), -INT16_C( 25443),  INT16_C( 22183),  INT16_C( 32166),  INT16_C( 12509),
+         INT16_C( 18864),  INT16_C( 13021), -INT16_C( 18432), -INT16_C( 13605),  INT16_C( 28945),  INT16_C( 22213),  INT16_C( 25594),  INT16_C( 17549),
+         INT16_C(  1064), -INT16_C( 27234), -INT16_C( 11696),  INT16_C(  7871),  INT16_C( 19574),  INT16_C(  9192),  INT16_C(  7403), -INT16_C(  8824) },
+      { -INT16_C( 19338),  INT16_C( 16050),  INT16_C( 30750), -INT16_C(  2529), -INT16_C( 32340), -INT16_C( 24906), -INT16_C( 25778), -INT16_C(  5626),
+         INT16_C( 13091),  INT16_C( 22670),  INT16_C( 14594), -INT16_C( 10366), -INT16_C(  1745), -INT16_C( 19986),  INT16_C( 30845),  INT16_C( 27952),
+         INT16_C( 15217),  INT16_C( 12082),  INT16_C( 17065),  INT16_C( 29130), -INT16_C( 15759), -INT16_C( 22907), -INT16_C( 12189),  INT16_C( 28435),
+         INT16_C( 13501),  INT16_C( 12334),  INT16_C( 10832),  INT16_C( 14884),  INT16_C( 10846), -INT16_C( 10196),  INT16_C( 32413), -INT16_C( 30188) } },
+    { { -INT16_C( 18860), -INT16_C( 11487), -INT16_C( 30622), -INT16_C( 15673),  INT16_C(  9449), -INT16_C(  9216),  INT16_C( 21195),  INT16_C( 25164),
+         INT16_C( 11244), -INT16_C( 16031), -INT16_C(  8092),  INT16_C( 24785),  INT16_C( 11220), -INT16_C( 13537), -INT16_C( 15768),  INT16_C( 12639),
+         INT16_C( 12013), -INT16_C( 12246), -INT16_C( 24257),  INT16_C( 29130), -INT16_C(  1881),  INT16_C( 28321), -INT16_C(  8134),  INT16_C(  9519),
+         INT16_C( 11631), -INT16_C( 26753),  INT16_C( 18914), -INT16_C( 28901), -INT16_C(  7282),  INT16_C( 25182), -INT16_C( 22490), -INT16_C(  4409) },
+      UINT32_C(4096076739),
+      {  INT16_C( 15007), -INT16_C( 14870), -INT16_C( 17332), -INT16_C( 26971),  INT16_C(  5811),  INT16_C( 23982), -INT16_C(  2729),  INT16_C(  7172),
+         INT16_C( 28214),  INT16_C( 19476), -INT16_C( 18554), -INT16_C(  6082), -INT16_C( 17539),  INT16_C(   604), -INT16_C( 11860), -INT16_C( 19538),
+         INT16_C( 25178),  INT16_C( 27242), -INT16_C(  2606), -INT16_C( 30688),  INT16_C( 27777),  INT16_C(  3676),  INT16_C( 17490),  INT16_C( 20982),
+        -INT16_C(   153), -INT16_C( 13790), -INT16_C(  1299),  INT16_C( 20235), -INT16_C( 11085), -INT16_C(   875), -INT16_C(  2869), -INT16_C( 20691) },
+      { -INT16_C(  1492), -INT16_C( 28977),  INT16_C(  8373), -INT16_C( 10156), -INT16_C(  1845), -INT16_C( 23805), -INT16_C( 15352), -INT16_C(  1277),
+        -INT16_C( 30130), -INT16_C(  3793),  INT16_C( 12750),  INT16_C(  4855),  INT16_C(  2950),  INT16_C( 26847),  INT16_C(  1632),  INT16_C( 23534),
+         INT16_C(  3855), -INT16_C(  1199), -INT16_C(  7292), -INT16_C( 27712),  INT16_C( 11276), -INT16_C(  4704),  INT16_C(  5616),  INT16_C( 32471),
+         INT16_C( 23110),  INT16_C(  5520), -INT16_C( 27841), -INT16_C(  7802),  INT16_C( 26552),  INT16_C( 30443),  INT16_C(  6056), -INT16_C( 10375) },
+      { -INT16_C( 24582), -INT16_C(  5490), -INT16_C( 30622), -INT16_C( 15673),  INT16_C(  9449), -INT16_C(  9216),  INT16_C( 22468),  INT16_C(  1275),
+         INT16_C( 13962),  INT16_C(  5361), -INT16_C(  8092),  INT16_C( 15890),  INT16_C( 11220),  INT16_C( 23656), -INT16_C( 15768),  INT16_C( 12639),
+         INT16_C( 23055), -INT16_C( 12246), -INT16_C( 11549),  INT16_C( 29130), -INT16_C(  1881),  INT16_C( 23789), -INT16_C(  8134),  INT16_C(  9519),
+         INT16_C( 11631), -INT16_C( 26753), -INT16_C(  4717), -INT16_C( 28901), -INT16_C( 19609), -INT16_C( 27274), -INT16_C( 13545),  INT16_C( 11735) } },
+    { {  INT16_C(  3213), -INT16_C( 17006),  INT16_C( 18380),  INT16_C(  5805),  INT16_C(  4728),  INT16_C( 27198),  INT16_C( 26606), -INT16_C( 24801),
+        -INT16_C(  9284), -INT16_C(  9716), -INT16_C( 23927),  INT16_C( 21275), -INT16_C( 15087), -INT16_C(  5040),  INT16_C(  2355),  INT16_C(  3765),
+         INT16_C( 32766),  INT16_C( 27823),  INT16_C( 22990), -INT16_C( 16683), -INT16_C( 12441),  INT16_C( 12190),  INT16_C( 22711),  INT16_C( 10796),
+        -INT16_C(  2002),  INT16_C( 22905), -INT16_C(  9559), -INT16_C( 21739), -INT16_C(    54), -INT16_C( 30190),  INT16_C( 18049), -INT16_C( 31834) },
+      UINT32_C(3380029727),
+      { -INT16_C( 16846),  INT16_C( 18577),  INT16_C( 28258), -INT16_C(  5600),  INT16_C( 19189), -INT16_C( 31794),  INT16_C( 31738), -INT16_C(   199),
+         INT16_C( 12278), -INT16_C(  9941), -INT16_C(  7600),  INT16_C( 16657),  INT16_C(  7519),  INT16_C(  1711),  INT16_C( 10220),  INT16_C(  2853),
+         INT16_C( 32405), -INT16_C( 29136),  INT16_C( 11629), -INT16_C( 31487),  INT16_C( 17364), -INT16_C( 19323),  INT16_C( 20845), -INT16_C(  9567),
+         INT16_C(  6319),  INT16_C( 21466),  INT16_C( 27809), -INT16_C(  5736),  INT16_C( 20550),  INT16_C( 30698), -INT16_C( 26409),  INT16_C( 13619) },
+      { -INT16_C(  6373), -INT16_C( 21918), -INT16_C( 15221),  INT16_C( 12063), -INT16_C( 22851),  INT16_C( 23755),  INT16_C(   420), -INT16_C(   261),
+         INT16_C(   241), -INT16_C( 20968), -INT16_C( 19073),  INT16_C( 18914),  INT16_C( 16239),  INT16_C(  3855),  INT16_C(   831), -INT16_C(  9973),
+        -INT16_C( 26640), -INT16_C( 27022), -INT16_C( 24785), -INT16_C(  1046),  INT16_C(  9280),  INT16_C( 22984),  INT16_C( 17207), -INT16_C( 10373),
+        -INT16_C( 18848), -INT16_C( 10473),  INT16_C( 11648),  INT16_C( 11063),  INT16_C( 27997),  INT16_C(  5377),  INT16_C( 28517), -INT16_C( 11005) },
+      {  INT16_C( 13031), -INT16_C( 28246),  INT16_C( 25284),  INT16_C(  8239), -INT16_C(  2650),  INT16_C( 27198),  INT16_C( 26606), -INT16_C( 24801),
+        -INT16_C(  2560), -INT16_C(  9716), -INT16_C( 23927),  INT16_C(  4425), -INT16_C( 15087), -INT16_C( 20721),  INT16_C(  2355),  INT16_C(  3765),
+        -INT16_C( 27241),  INT16_C( 12438),  INT16_C( 28063), -INT16_C( 16683), -INT16_C( 11228), -INT16_C( 31399),  INT16_C( 27971),  INT16_C( 10796),
+        -INT16_C( 20554),  INT16_C( 22905), -INT16_C(  9559), -INT16_C( 26581), -INT16_C(    54), -INT16_C( 30190), -INT16_C( 10385),  INT16_C( 13269) } },
+    { { -INT16_C( 14041),  INT16_C( 24698), -INT16_C(  2666),  INT16_C( 26006), -INT16_C(  8915), -INT16_C(  9326), -INT16_C(    40), -INT16_C( 18356),
+        -INT16_C( 29027), -INT16_C( 15593), -INT16_C( 18490),  INT16_C( 14212), -INT16_C( 11063), -INT16_C(  1767),  INT16_C( 12326),  INT16_C(  5164),
+        -INT16_C( 19404),  INT16_C(  2363), -INT16_C(  5379), -INT16_C( 12669),  INT16_C( 15057),  INT16_C( 20416),  INT16_C( 12003), -INT16_C( 20434),
+         INT16_C(   699), -INT16_C(  5082),  INT16_C( 30867),  INT16_C( 18462), -INT16_C(  4184), -INT16_C( 14832), -INT16_C(  5265), -INT16_C( 27174) },
+      UINT32_C(4194662423),
+      {  INT16_C( 32208),  INT16_C( 28873), -INT16_C( 32340), -INT16_C(  2436),  INT16_C(  7845), -INT16_C( 10264),  INT16_C( 31312),  INT16_C( 16820),
+         INT16_C( 29999), -INT16_C( 31067), -INT16_C(   855), -INT16_C(  9487),  INT16_C(  2427),  INT16_C( 15495), -INT16_C( 17808), -INT16_C( 29027),
+        -INT16_C( 26817),  INT16_C(  9292), -INT16_C(   110),  INT16_C(  6258), -INT16_C( 18390),  INT16_C( 21789), -INT16_C( 13101),  INT16_C(   769),
+        -INT16_C( 19639),  INT16_C( 27758),  INT16_C( 31166),  INT16_C( 30421),  INT16_C( 16326),  INT16_C( 27971), -INT16_C( 18071), -INT16_C( 15922) },
+      { -INT16_C( 28070),  INT16_C( 19717),  INT16_C( 27935), -INT16_C(  2329), -INT16_C( 23183), -INT16_C(  5710), -INT16_C( 32250),  INT16_C( 18281),
+         INT16_C( 29399), -INT16_C( 27600), -INT16_C( 13675), -INT16_C(  5987), -INT16_C( 12453),  INT16_C(  1582), -INT16_C( 26554), -INT16_C( 18563),
+         INT16_C(  2504),  INT16_C(  6387), -INT16_C( 11162),  INT16_C( 26431), -INT16_C(  6987),  INT16_C( 18725),  INT16_C( 26977), -INT16_C(  4969),
+         INT16_C( 11603),  INT16_C( 31961),  INT16_C( 26012), -INT16_C( 23309),  INT16_C( 25391), -INT16_C( 31545), -INT16_C(  9007),  INT16_C( 14093) },
+      { -INT16_C( 12142), -INT16_C( 14003), -INT16_C( 21395),  INT16_C( 26006), -INT16_C( 23131), -INT16_C(  9326), -INT16_C(    40), -INT16_C( 18356),
+        -INT16_C( 29027), -INT16_C( 15593), -INT16_C( 18490), -INT16_C(  3608),  INT16_C( 31695), -INT16_C( 30970),  INT16_C( 28824),  INT16_C(  5164),
+         INT16_C( 16137),  INT16_C(  2363), -INT16_C( 27948), -INT16_C( 12669),  INT16_C( 15057),  INT16_C( 20416),  INT16_C( 12003), -INT16_C( 20434),
+         INT16_C(   699),  INT16_C( 28284),  INT16_C( 30867), -INT16_C( 10844), -INT16_C( 14749),  INT16_C( 17284),  INT16_C( 27100), -INT16_C( 12745) } },
+    { { -INT16_C( 27562),  INT16_C( 19153),  INT16_C(  6170), -INT16_C(   406),  INT16_C( 19831), -INT16_C( 28497),  INT16_C( 19159), -INT16_C(  9728),
+        -INT16_C( 18641), -INT16_C( 17898), -INT16_C(  3887),  INT16_C(  4291),  INT16_C( 10224),  INT16_C( 20245),  INT16_C( 27333), -INT16_C( 19386),
+        -INT16_C(  7987),  INT16_C( 21867),  INT16_C( 18663), -INT16_C( 18876), -INT16_C( 31377), -INT16_C( 13826),  INT16_C( 30208),  INT16_C(  7628),
+         INT16_C(  6789), -INT16_C( 29210),  INT16_C( 23630), -INT16_C( 25202),  INT16_C( 27676), -INT16_C(  6772),  INT16_C( 27726), -INT16_C( 24508) },
+      UINT32_C(3051761416),
+      { -INT16_C( 16089), -INT16_C( 30250),  INT16_C( 26116),  INT16_C( 29232),  INT16_C( 23980), -INT16_C( 23197),  INT16_C(  4090),  INT16_C( 29391),
+         INT16_C(  4630),  INT16_C( 29058), -INT16_C( 16095), -INT16_C( 15948), -INT16_C(  6700),  INT16_C( 25590), -INT16_C( 27963), -INT16_C( 27361),
+         INT16_C( 31620), -INT16_C(  1749), -INT16_C( 18920), -INT16_C(   855),  INT16_C( 25297), -INT16_C(  3580), -INT16_C(  4883),  INT16_C( 18785),
+        -INT16_C( 27295), -INT16_C( 29058), -INT16_C(   835), -INT16_C( 20799),  INT16_C( 24795),  INT16_C(  6532),  INT16_C( 28017),  INT16_C( 18743) },
+      { -INT16_C( 22197),  INT16_C( 13828), -INT16_C(  1484),  INT16_C( 29827),  INT16_C( 30082), -INT16_C( 11607), -INT16_C( 27965),  INT16_C( 14481),
+        -INT16_C( 20416), -INT16_C( 27301), -INT16_C(  9106),  INT16_C( 25879),  INT16_C( 30913), -INT16_C( 15360), -INT16_C( 24721), -INT16_C( 30278),
+        -INT16_C( 28056), -INT16_C(  7429),  INT16_C( 12663),  INT16_C( 14109),  INT16_C(  8537),  INT16_C( 28363), -INT16_C( 24642), -INT16_C( 11230),
+         INT16_C(  5911),  INT16_C(  4369),  INT16_C( 25453),  INT16_C( 22707), -INT16_C( 13422),  INT16_C( 26018), -INT16_C(  5973),  INT16_C( 30477) },
+      { -INT16_C( 27562),  INT16_C( 19153),  INT16_C(  6170),  INT16_C( 12404),  INT16_C( 19831), -INT16_C( 28497),  INT16_C( 19159), -INT16_C(  9728),
+         INT16_C(  5808), -INT16_C( 32107),  INT16_C(  8668), -INT16_C( 19355),  INT16_C( 10224), -INT16_C(  2364),  INT16_C( 27333), -INT16_C( 19386),
+        -INT16_C(  7987),  INT16_C( 11234),  INT16_C(  6193), -INT16_C( 18876), -INT16_C( 31377),  INT16_C(  1134), -INT16_C(  4705),  INT16_C( 25044),
+         INT16_C( 24855), -INT16_C( 29210), -INT16_C( 17053), -INT16_C( 25202), -INT16_C(  9269), -INT16_C( 31643),  INT16_C( 27726),  INT16_C( 14199) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi16(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi16(test_vec[i].b);
+    simde__m512i r = simde_mm512_mask_shldi_epi16(src, test_vec[i].k, a, b, INT32_C( 40));
+    simde_test_x86_assert_equal_i16x32(r, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_shldi_epi16 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask32 k;
+    const int16_t a[32];
+    const int16_t b[32];
+    const int16_t r[32];
+  } test_vec[] = {
+    { UINT32_C(2785317682),
+      { -INT16_C( 18028), -INT16_C( 24554),  INT16_C( 30413),  INT16_C( 26546), -INT16_C( 17677), -INT16_C( 16087),  INT16_C( 17528), -INT16_C( 30616),
+         INT16_C(  5977),  INT16_C( 23301),  INT16_C( 27947),  INT16_C( 32073),  INT16_C( 19641),  INT16_C(  6212),  INT16_C(  8112),  INT16_C(  1347),
+         INT16_C( 20271), -INT16_C(  8395),  INT16_C( 22556), -INT16_C( 22088), -INT16_C( 27246), -INT16_C( 23534),  INT16_C(  3817), -INT16_C( 22456),
+         INT16_C( 10021), -INT16_C( 13039),  INT16_C( 20050), -INT16_C( 26646), -INT16_C( 26628), -INT16_C(  1480),  INT16_C( 15171),  INT16_C( 17235) },
+      {  INT16_C(  8039), -INT16_C( 10587),  INT16_C( 15501), -INT16_C( 22546), -INT16_C(   512),  INT16_C( 21665), -INT16_C( 22642),  INT16_C( 21104),
+        -INT16_C( 11704),  INT16_C( 22299), -INT16_C( 10543), -INT16_C(  3723),  INT16_C(  1036),  INT16_C( 25576),  INT16_C( 31961),  INT16_C( 24612),
+         INT16_C( 12844), -INT16_C(   928), -INT16_C(  3799),  INT16_C( 10154), -INT16_C(  8541),  INT16_C( 17727), -INT16_C( 11927), -INT16_C( 13908),
+        -INT16_C(   976),  INT16_C(  5405),  INT16_C( 11605), -INT16_C( 32599), -INT16_C(  1919),  INT16_C( 29865),  INT16_C(  6192),  INT16_C(  9792) },
+      {  INT16_C(     0),  INT16_C( 11693),  INT16_C(     0),  INT16_C(     0), -INT16_C(  6148),  INT16_C( 21161),  INT16_C(     0),  INT16_C(     0),
+        -INT16_C( 19548),  INT16_C(  2734),  INT16_C(     0),  INT16_C(     0),  INT16_C( 29192),  INT16_C(     0),  INT16_C(     0), -INT16_C( 31040),
+         INT16_C(     0),  INT16_C(     0),  INT16_C( 14818),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C(  8746), -INT16_C( 23462),  INT16_C(     0),  INT16_C(     0),  INT16_C( 28905),  INT16_C(     0), -INT16_C( 22964) } },
+    { UINT32_C( 115338861),
+      {  INT16_C( 25841), -INT16_C( 27248), -INT16_C( 17822), -INT16_C(  5467), -INT16_C( 19819),  INT16_C(  3221), -INT16_C( 15874), -INT16_C( 25106),
+        -INT16_C( 13280),  INT16_C( 32111),  INT16_C(  3255), -INT16_C(  7762), -INT16_C( 22440), -INT16_C(  6919),  INT16_C( 18105),  INT16_C( 13882),
+        -INT16_C( 12874),  INT16_C( 15958),  INT16_C(  9754),  INT16_C(   970),  INT16_C( 22871), -INT16_C(  6381),  INT16_C( 25618),  INT16_C(  5628),
+        -INT16_C( 30387),  INT16_C( 13346),  INT16_C( 11702), -INT16_C(  4825), -INT16_C( 18392), -INT16_C( 26349), -INT16_C( 25194), -INT16_C(  8184) },
+      {  INT16_C( 16631),  INT16_C( 10274), -INT16_C( 30634),  INT16_C(  4347), -INT16_C(  2508), -INT16_C(  9437), -INT16_C(  6738),  INT16_C( 19558),
+        -INT16_C(  2024),  INT16_C( 30403), -INT16_C( 29158), -INT16_C( 14119), -INT16_C(  5773), -INT16_C( 28554),  INT16_C( 24909),  INT16_C(  5847),
+        -INT16_C(  2134), -INT16_C( 29754),  INT16_C( 22520),  INT16_C(  8365),  INT16_C( 28596),  INT16_C( 26975), -INT16_C( 11923), -INT16_C( 29678),
+         INT16_C(  2209), -INT16_C( 21438),  INT16_C(  9987),  INT16_C( 22829), -INT16_C( 31537), -INT16_C( 24887),  INT16_C( 12107), -INT16_C(  2891) },
+      { -INT16_C(  7551),  INT16_C(     0), -INT16_C( 15088),  INT16_C( 18977),  INT16_C(     0),  INT16_C( 11190), -INT16_C(   565),  INT16_C(     0),
+         INT16_C(     0), -INT16_C(  8467),  INT16_C( 28444),  INT16_C( 23953),  INT16_C(     0), -INT16_C(  3296),  INT16_C( 29378),  INT16_C( 29741),
+         INT16_C( 28143), -INT16_C( 21225),  INT16_C( 13487), -INT16_C( 27583), -INT16_C( 20769),  INT16_C(     0),  INT16_C(  9634), -INT16_C(  1768),
+         INT16_C(     0),  INT16_C( 17752),  INT16_C( 27726),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(3136697689),
+      { -INT16_C(  4749),  INT16_C(  2436), -INT16_C(  9565),  INT16_C( 21721), -INT16_C( 23038),  INT16_C( 13079),  INT16_C( 12665),  INT16_C(  3389),
+         INT16_C( 11135),  INT16_C( 21821),  INT16_C( 21837),  INT16_C( 12427),  INT16_C( 16934), -INT16_C(  1028),  INT16_C( 28570),  INT16_C( 17121),
+         INT16_C(  6094),  INT16_C( 17089),  INT16_C(  7752),  INT16_C( 18352), -INT16_C(  4427), -INT16_C( 31093),  INT16_C( 26771), -INT16_C( 14258),
+        -INT16_C(  8935), -INT16_C( 20578), -INT16_C(  3990), -INT16_C( 24873), -INT16_C(  8893), -INT16_C( 16000),  INT16_C( 23634), -INT16_C( 28268) },
+      {  INT16_C( 21556), -INT16_C( 22020), -INT16_C( 30154), -INT16_C(  7445), -INT16_C( 30571),  INT16_C( 16101), -INT16_C(  1932), -INT16_C( 14695),
+        -INT16_C( 19705), -INT16_C(  5144), -INT16_C( 13226),  INT16_C( 18733),  INT16_C( 25299),  INT16_C( 25716), -INT16_C( 10316),  INT16_C( 18434),
+         INT16_C( 19470),  INT16_C(  9134), -INT16_C(  5265), -INT16_C(  3700), -INT16_C( 12320),  INT16_C( 11870), -INT16_C( 27094), -INT16_C( 12067),
+        -INT16_C( 28953),  INT16_C( 19195),  INT16_C(  5740),  INT16_C( 15976), -INT16_C( 18326),  INT16_C( 29025), -INT16_C( 19139),  INT16_C(  3154) },
+      { -INT16_C(  6488),  INT16_C(     0),  INT16_C(     0), -INT16_C( 19515),  INT16_C(  1297),  INT16_C(     0), -INT16_C(  3088),  INT16_C(     0),
+        -INT16_C(   154),  INT16_C(     0), -INT16_C( 25704),  INT16_C(     0),  INT16_C( 19653), -INT16_C(  1848),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0), -INT16_C( 32185), -INT16_C( 28202),  INT16_C(     0),  INT16_C( 27551),  INT16_C(  5724),  INT16_C( 10028), -INT16_C( 25183),
+         INT16_C(     0),  INT16_C( 15509),  INT16_C(     0), -INT16_C( 20868), -INT16_C( 30864),  INT16_C(   226),  INT16_C(     0),  INT16_C( 10264) } },
+    { UINT32_C(3053064585),
+      {  INT16_C(  9706), -INT16_C(  3939), -INT16_C(  5339),  INT16_C( 12346), -INT16_C(  2954),  INT16_C( 12119), -INT16_C( 13139), -INT16_C( 29549),
+        -INT16_C( 16105), -INT16_C( 14896),  INT16_C( 25108),  INT16_C( 26598),  INT16_C( 26433), -INT16_C( 28513),  INT16_C( 11641), -INT16_C( 20767),
+        -INT16_C(   271),  INT16_C( 17561),  INT16_C(  7694), -INT16_C( 22084),  INT16_C( 18544),  INT16_C( 23070), -INT16_C(   582),  INT16_C(  6146),
+        -INT16_C( 24678), -INT16_C( 12336),  INT16_C( 17420),  INT16_C( 27682), -INT16_C( 15244), -INT16_C( 27793),  INT16_C( 21608), -INT16_C( 30092) },
+      {  INT16_C(  2729),  INT16_C(  9702), -INT16_C(  9877), -INT16_C(  9606),  INT16_C( 16707), -INT16_C( 32597),  INT16_C( 32573), -INT16_C( 16041),
+        -INT16_C(  5508), -INT16_C( 20845),  INT16_C(  6919),  INT16_C( 11097), -INT16_C( 28533),  INT16_C(  1271), -INT16_C( 30274),  INT16_C( 16322),
+         INT16_C( 31083), -INT16_C( 15115), -INT16_C( 25231), -INT16_C(   632),  INT16_C(  1120),  INT16_C( 12304), -INT16_C(  1624), -INT16_C( 31246),
+        -INT16_C(  8122), -INT16_C( 30063),  INT16_C( 16713), -INT16_C( 17027), -INT16_C( 25108), -INT16_C(  5222), -INT16_C(  6616), -INT16_C(  7357) },
+      { -INT16_C( 11243),  INT16_C(     0),  INT16_C(     0),  INT16_C( 30132),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 10114),
+         INT16_C( 12244),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C( 31967),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0),  INT16_C( 13193),  INT16_C(     0),  INT16_C( 31227), -INT16_C(  8184),  INT16_C( 15456),  INT16_C( 30195),  INT16_C(  1291),
+         INT16_C( 13760),  INT16_C(     0),  INT16_C(  6274),  INT16_C(     0), -INT16_C(  5829), -INT16_C(  8233),  INT16_C(     0), -INT16_C(  5690) } },
+    { UINT32_C(2232626876),
+      { -INT16_C(  4383),  INT16_C( 25741),  INT16_C( 12254),  INT16_C( 20727), -INT16_C( 31234), -INT16_C(  2646),  INT16_C( 13798),  INT16_C( 13031),
+        -INT16_C( 15368),  INT16_C( 32234),  INT16_C(  7019),  INT16_C(  6913), -INT16_C( 18753), -INT16_C( 16527), -INT16_C(  2110),  INT16_C(  2612),
+         INT16_C(  3100),  INT16_C( 12202),  INT16_C( 22253),  INT16_C( 22092),  INT16_C(  3628),  INT16_C( 19010), -INT16_C( 14852), -INT16_C( 10224),
+        -INT16_C( 24891), -INT16_C( 32037), -INT16_C(  5455),  INT16_C(  2197),  INT16_C(  5204), -INT16_C(  3626),  INT16_C( 17370), -INT16_C( 17661) },
+      {  INT16_C(  6616), -INT16_C(  1321),  INT16_C( 10393),  INT16_C(  3618), -INT16_C( 13298), -INT16_C( 17761), -INT16_C( 31907), -INT16_C( 19580),
+        -INT16_C( 15876),  INT16_C( 27190), -INT16_C( 19438),  INT16_C(  8013),  INT16_C( 11959), -INT16_C( 14790),  INT16_C(  3951), -INT16_C(   279),
+        -INT16_C( 27423), -INT16_C( 31931),  INT16_C(  8224),  INT16_C(  8304),  INT16_C(  9802),  INT16_C( 24048), -INT16_C( 27377), -INT16_C( 12300),
+         INT16_C(  4520),  INT16_C( 13549), -INT16_C(  2572),  INT16_C(  1010), -INT16_C( 15155), -INT16_C( 13009),  INT16_C( 28778), -INT16_C(  2148) },
+      {  INT16_C(     0),  INT16_C(     0), -INT16_C( 17327), -INT16_C(  4580), -INT16_C(   616),  INT16_C( 21877),  INT16_C(     0), -INT16_C( 12441),
+         INT16_C(     0), -INT16_C( 11052), -INT16_C( 10392),  INT16_C(   574),  INT16_C(     0), -INT16_C(  7284),  INT16_C(     0),  INT16_C(     0),
+         INT16_C( 14633),  INT16_C( 21766),  INT16_C(     0),  INT16_C(     0),  INT16_C( 22604),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),
+        -INT16_C( 30173),  INT16_C(     0),  INT16_C( 25579),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(  2031) } },
+    { UINT32_C(1639567989),
+      { -INT16_C(  5999), -INT16_C(  7853), -INT16_C(  7172), -INT16_C( 17456),  INT16_C( 10710),  INT16_C(  7395), -INT16_C( 27024), -INT16_C( 10045),
+        -INT16_C( 27287), -INT16_C( 16994), -INT16_C( 19526), -INT16_C(  5560),  INT16_C(  8835), -INT16_C(  9822), -INT16_C(  8234), -INT16_C( 29290),
+        -INT16_C(   456), -INT16_C( 25321),  INT16_C( 18544),  INT16_C(   984),  INT16_C( 30019), -INT16_C(  6353),  INT16_C( 25202), -INT16_C( 32228),
+        -INT16_C(  3447),  INT16_C( 25907), -INT16_C( 17243),  INT16_C(  4923),  INT16_C(   875), -INT16_C(  9445),  INT16_C(  7790),  INT16_C( 11306) },
+      { -INT16_C(  2970),  INT16_C(  4471),  INT16_C(  3887),  INT16_C( 26347), -INT16_C( 19942), -INT16_C( 17551),  INT16_C( 32716), -INT16_C(  3385),
+         INT16_C(  6287),  INT16_C(  3660), -INT16_C( 23998),  INT16_C( 19617), -INT16_C( 24122), -INT16_C( 25140),  INT16_C( 22628), -INT16_C( 16898),
+        -INT16_C( 16398), -INT16_C( 24106),  INT16_C(  9774),  INT16_C( 19568),  INT16_C( 32172), -INT16_C( 24887), -INT16_C( 13479),  INT16_C( 25546),
+        -INT16_C( 18789), -INT16_C( 22829),  INT16_C( 13475),  INT16_C( 21894), -INT16_C( 16109), -INT16_C( 15290),  INT16_C(  8839),  INT16_C( 18472) },
+      {  INT16_C(  9192),  INT16_C(     0), -INT16_C(  2018),  INT16_C(     0), -INT16_C( 21148), -INT16_C( 14474), -INT16_C(  7937),  INT16_C(     0),
+         INT16_C(     0),  INT16_C( 15388),  INT16_C(     0),  INT16_C(     0),  INT16_C(  1859),  INT16_C(     0), -INT16_C( 21328),  INT16_C( 11643),
+         INT16_C( 29055),  INT16_C(     0),  INT16_C(     0), -INT16_C( 20328), -INT16_C( 30981),  INT16_C( 24381),  INT16_C(     0),  INT16_C( 14535),
+         INT16_C(  4973),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C( 14216), -INT16_C(  9147),  INT16_C(     0) } },
+    { UINT32_C( 103767170),
+      { -INT16_C( 16709), -INT16_C( 28881),  INT16_C( 27654), -INT16_C(  5746), -INT16_C(  3668),  INT16_C(  6702),  INT16_C(  7566), -INT16_C(  8323),
+         INT16_C(   528), -INT16_C(  8658), -INT16_C( 13631), -INT16_C( 12025), -INT16_C(  8752), -INT16_C( 23674), -INT16_C( 10120),  INT16_C(  4957),
+        -INT16_C( 29523),  INT16_C(   169),  INT16_C( 29568), -INT16_C( 32067), -INT16_C(  8553), -INT16_C( 27333),  INT16_C(  4660),  INT16_C( 20924),
+         INT16_C( 12521),  INT16_C(  9284), -INT16_C( 10796),  INT16_C( 28070), -INT16_C( 13157), -INT16_C( 32555),  INT16_C( 13017),  INT16_C( 10180) },
+      {  INT16_C( 24743),  INT16_C( 20436),  INT16_C( 22705),  INT16_C(  5602),  INT16_C( 26279),  INT16_C( 28574),  INT16_C( 10063),  INT16_C( 20223),
+        -INT16_C( 27676), -INT16_C( 19046), -INT16_C( 24622), -INT16_C( 21072), -INT16_C(  9792), -INT16_C( 22966), -INT16_C( 23845), -INT16_C( 19297),
+        -INT16_C( 19645),  INT16_C(   558), -INT16_C( 12732), -INT16_C(  8061),  INT16_C( 20781), -INT16_C( 18123),  INT16_C( 16964),  INT16_C( 15864),
+         INT16_C( 21717), -INT16_C( 32646), -INT16_C( 32449),  INT16_C( 23948), -INT16_C( 28821),  INT16_C( 12320),  INT16_C( 21930), -INT16_C(  8543) },
+      {  INT16_C(     0),  INT16_C( 24223),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0), -INT16_C(  1379),
+         INT16_C(     0),  INT16_C(     0), -INT16_C( 31937),  INT16_C(  3931), -INT16_C( 24141),  INT16_C(     0), -INT16_C(  3771),  INT16_C(     0),
+         INT16_C( 23398),  INT16_C( 20996),  INT16_C(   412),  INT16_C( 31681),  INT16_C(     0),  INT16_C( 30578),  INT16_C(     0),  INT16_C(     0),
+         INT16_C(     0), -INT16_C( 30464), -INT16_C( 22270),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0),  INT16_C(     0) } },
+    { UINT32_C(3115214828),
+      {  INT16_C( 25379), -INT16_C( 14065), -INT16_C( 22514),  INT16_C( 12149), -INT16_C( 15673),  INT16_C( 17617), -INT16_C( 11368),  INT16_C( 28686),
+        -INT16_C( 21932), -INT16_C( 22291),  INT16_C( 31531),  INT16_C( 12463), -INT16_C( 19584), -INT16_C( 11362), -INT16_C( 18024), -INT16_C(  9154),
+         INT16_C( 19727), -INT16_C(  4813),  INT16_C( 18432), -INT16_C(  4594),  INT16_C( 13955),  INT16_C( 32276),  INT16_C(  5146),  INT16_C( 27110),
+        -INT16_C(  2321), -INT16_C(  4779), -INT16_C( 29634), -INT16_C( 24939),  INT16_C( 27345),  INT16_C( 27068), -INT16_C(  6391),  INT16_C(  4732) },
+      {  INT16_C( 10712),  INT16_C( 31047), -INT16_C(  3777),  INT16_C( 21944),  INT16_C( 13115),  INT16_C(  3717),  INT16_C( 18960), -INT16_C(  5626),
+        -INT16_C( 30057), -INT16_C( 16675),  INT16_C( 20689), -INT16_C( 13766), -INT16_C(  4451), -INT16_C(  4261),  INT16_C( 31826),  INT16_C( 16886),
+         INT16_C(  7869), -INT16_C(  2580),  INT16_C(  7558),  INT16_C( 25817),  INT16_C( 22638),  INT16_C( 18304), -INT16_C( 25347), -INT16_C( 28919),
+         INT16_C(  7690), -INT16_C( 30634),  INT16_C( 14139),  INT16_C( 12669),  INT16_C( 27855),  INT16_C( 14242), -INT16_C(  3771),  INT16_C( 30758) },
+      {  INT16_C(     0),  INT16_C(     0),  INT16_C(  7650), -INT16_C(  5461),  INT16_C(     0), -INT16_C( 24035),  INT16_C( 12436),  INT16_C(  7636),
+        -INT16_C( 22251), -INT16_C(  9347),  INT16_C( 22177),  INT16_C(     0),  INT16_C(     0),  INT16_C( 15838),  INT16_C( 12536),  INT16_C(     0),
+         INT16_C(     0),  INT16_C( 26603),  INT16_C(    59),  INT16_C(  7369),  INT16_C(     0),  INT16_C( 10383),  INT16_C(     0), -INT16_C( 13026),
+        -INT16_C(  8644),  INT16_C(     0),  INT16_C(     0),  INT16_C( 10850), -INT16_C( 23847),  INT16_C( 30831),  INT16_C(     0), -INT16_C(  1808) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi16(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi16(test_vec[i].b);
+    simde__m512i r = simde_mm512_maskz_shldi_epi16(test_vec[i].k, a, b, INT32_C(  9));
+    simde_test_x86_assert_equal_i16x32(r, simde_mm512_loadu_epi16(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_shldi_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const int32_t b[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { { -INT32_C(   790274709), -INT32_C(   874872497),  INT32_C(   399276128), -INT32_C(   818306867), -INT32_C(   191909346), -INT32_C(   140323003), -INT32_C(  1090802138), -INT32_C(   366683329),
+        -INT32_C(   247897321), -INT32_C(  1018734620),  INT32_C(  1382161522), -INT32_C(   168236122),  INT32_C(   852450218), -INT32_C(  1937841244), -INT32_C(  1628075313),  INT32_C(   450096349) },
+      { -INT32_C(   224034192),  INT32_C(  1681654913), -INT32_C(  1921964632),  INT32_C(    21860400), -INT32_C(  1250050321), -INT32_C(   940118536), -INT32_C(   272476058),  INT32_C(  1451837394),
+         INT32_C(  1568374222),  INT32_C(  1527877299), -INT32_C(  1355023697),  INT32_C(   637429356),  INT32_C(   431525129), -INT32_C(  1012896077),  INT32_C(   379029546), -INT32_C(  2048102840) },
+      {  INT32_C(  1567355557), -INT32_C(  2125503428),  INT32_C(  2019593585), -INT32_C(  1597177523), -INT32_C(  1306610307), -INT32_C(   683292682), -INT32_C(  1373179966), -INT32_C(   616606071),
+         INT32_C(  1662475643),  INT32_C(  1474583313),  INT32_C(   477278011), -INT32_C(   341432834),  INT32_C(  1537874360), -INT32_C(   475741280), -INT32_C(  1966139753), -INT32_C(   321026580) } },
+    { {  INT32_C(  1173257338), -INT32_C(   442213681),  INT32_C(  1860928606),  INT32_C(  1606344676),  INT32_C(   813790019),  INT32_C(  1047947838),  INT32_C(   324762110),  INT32_C(   325677317),
+         INT32_C(   311928045),  INT32_C(  1692470738), -INT32_C(   146561014),  INT32_C(  1557494270), -INT32_C(  1676134336),  INT32_C(   733929731),  INT32_C(  1718099679), -INT32_C(   983591818) },
+      {  INT32_C(  1954806380), -INT32_C(  1493345848), -INT32_C(  1479345881), -INT32_C(  2015978046),  INT32_C(    95957060),  INT32_C(   702187373), -INT32_C(   215384293), -INT32_C(   266584574),
+         INT32_C(  1695269553), -INT32_C(  1237944143), -INT32_C(   415428809), -INT32_C(   140854398), -INT32_C(   419718078),  INT32_C(  1146649301),  INT32_C(  2083149914),  INT32_C(  1721721844) },
+      {  INT32_C(  2088400003),  INT32_C(  1523558141), -INT32_C(  2074171438), -INT32_C(   538671146),  INT32_C(  1933772216),  INT32_C(  1782458842),  INT32_C(  2046751529),  INT32_C(  1896214556),
+        -INT32_C(  1527945973),  INT32_C(   231913014), -INT32_C(  1475680451),  INT32_C(  2046752666),  INT32_C(   943777531), -INT32_C(   519879592),  INT32_C(   517962794), -INT32_C(  1804179809) } },
+    { { -INT32_C(  1240568236),  INT32_C(  1364036243),  INT32_C(  1056791933), -INT32_C(   419960272),  INT32_C(   956108611),  INT32_C(   430443126), -INT32_C(   348048041), -INT32_C(  1632562292),
+        -INT32_C(   847951061),  INT32_C(   621264922), -INT32_C(  1385300301), -INT32_C(   895413856), -INT32_C(  1794294509),  INT32_C(    36315648),  INT32_C(  1606348166),  INT32_C(   362200891) },
+      {  INT32_C(   379932427), -INT32_C(   200492090), -INT32_C(  1607442773), -INT32_C(    16942301), -INT32_C(  1322561165),  INT32_C(   162718206), -INT32_C(  1165688033), -INT32_C(   391440557),
+        -INT32_C(   466701993), -INT32_C(   893942075),  INT32_C(  1633152233),  INT32_C(   729396989),  INT32_C(   869287091),  INT32_C(  1692626691), -INT32_C(   180763544),  INT32_C(   337139822) },
+      {  INT32_C(  1851004581), -INT32_C(  1970015220),  INT32_C(  1568514096), -INT32_C(   365887747),  INT32_C(   256094507),  INT32_C(   175507890),  INT32_C(   894941829),  INT32_C(   328001707),
+         INT32_C(  1261167662), -INT32_C(  1071985993), -INT32_C(    21798569),  INT32_C(   295709561),  INT32_C(  1024668624),  INT32_C(   570451171), -INT32_C(   309922503), -INT32_C(  1086647272) } },
+    { {  INT32_C(   158556034),  INT32_C(  1300403513), -INT32_C(  2128386767),  INT32_C(   670755736),  INT32_C(   501765763), -INT32_C(  2023246159), -INT32_C(  1618075020), -INT32_C(   824212394),
+        -INT32_C(   399077605), -INT32_C(  1755499165), -INT32_C(   898448406), -INT32_C(  1602589551), -INT32_C(   750928159),  INT32_C(  1195713494), -INT32_C(   771478397),  INT32_C(  1109671635) },
+      {  INT32_C(  1172078110),  INT32_C(  1001941193), -INT32_C(  1231200417),  INT32_C(   148082339),  INT32_C(  1624351790), -INT32_C(  1523602818),  INT32_C(   318089732), -INT32_C(   656980590),
+         INT32_C(  1169875299),  INT32_C(  1705835855),  INT32_C(   209345757),  INT32_C(   841255374),  INT32_C(  1140638614), -INT32_C(  1975602941),  INT32_C(  1404343149),  INT32_C(   736116415) },
+      {  INT32_C(  1602373084), -INT32_C(  1791411272),  INT32_C(  1697756829), -INT32_C(   342357805),  INT32_C(  1451450577), -INT32_C(  1229871825),  INT32_C(   578032373), -INT32_C(  2074683177),
+        -INT32_C(  1894038086),  INT32_C(   895706540), -INT32_C(  1008071558),  INT32_C(  1821454884), -INT32_C(  1092533252),  INT32_C(   601262654),  INT32_C(   746804148),  INT32_C(  1054026720) } },
+    { { -INT32_C(    44191011), -INT32_C(  1590184850), -INT32_C(   955566684),  INT32_C(  1446005374),  INT32_C(  1314394230),  INT32_C(  1510086236),  INT32_C(   417154448),  INT32_C(  1372388288),
+         INT32_C(  2052121917), -INT32_C(   821090330), -INT32_C(   152857504),  INT32_C(   162291405), -INT32_C(   193017039), -INT32_C(   123885889), -INT32_C(  1771699013), -INT32_C(   316197585) },
+      { -INT32_C(  1091731488),  INT32_C(    28244813), -INT32_C(   633291419),  INT32_C(  1796284193), -INT32_C(  1596782253), -INT32_C(  1779555077), -INT32_C(  1250484252),  INT32_C(  1863819888),
+        -INT32_C(   572510995),  INT32_C(  1158924804), -INT32_C(  1231694197), -INT32_C(    59351359),  INT32_C(   906918057),  INT32_C(   185670078),  INT32_C(   929562287), -INT32_C(  1213711109) },
+      { -INT32_C(  1294090515), -INT32_C(  1267859026),  INT32_C(   899996224),  INT32_C(  1249798929),  INT32_C(   276209875),  INT32_C(   375166446),  INT32_C(  1167111543), -INT32_C(    71274729),
+        -INT32_C(   448930336),  INT32_C(   669402387), -INT32_C(  1805601131),  INT32_C(  1590557814), -INT32_C(   885967346), -INT32_C(  1497429231),  INT32_C(    79378279),  INT32_C(   892319656) } },
+    { {  INT32_C(  1517044790), -INT32_C(   552495026), -INT32_C(  1673761698),  INT32_C(  1724497031),  INT32_C(  1193644556), -INT32_C(   366166271), -INT32_C(  1266053967),  INT32_C(   279397175),
+         INT32_C(   877265504), -INT32_C(  2020196858), -INT32_C(   966502910),  INT32_C(  1124826421), -INT32_C(   327397747),  INT32_C(   497970829), -INT32_C(  1112880259), -INT32_C(   809741780) },
+      { -INT32_C(   300266976), -INT32_C(  1224352597), -INT32_C(  1129643030), -INT32_C(   822255799),  INT32_C(   963358347), -INT32_C(   120124573),  INT32_C(  1226307217),  INT32_C(   363739851),
+         INT32_C(  1655439003),  INT32_C(   442396260),  INT32_C(  1180232172), -INT32_C(   888444448),  INT32_C(    45065324),  INT32_C(  1202623874), -INT32_C(   613852815),  INT32_C(  1294041022) },
+      {  INT32_C(  1144450586), -INT32_C(  1739671803),  INT32_C(  1818148011), -INT32_C(  1131950339), -INT32_C(  1844692629), -INT32_C(  1090389801), -INT32_C(  1934538473),  INT32_C(  1127683502),
+         INT32_C(    39871147),  INT32_C(  1040587358),  INT32_C(  1442989656),  INT32_C(  2100677387),  INT32_C(  1317864111),  INT32_C(  1854752686), -INT32_C(   880944279),  INT32_C(  1378635041) } },
+    { {  INT32_C(  2093843147), -INT32_C(   494284190), -INT32_C(  1309513555), -INT32_C(  1580794396),  INT32_C(  1653436846), -INT32_C(  1329114744), -INT32_C(   786343131),  INT32_C(  2146222568),
+         INT32_C(   644497037), -INT32_C(  1181067742),  INT32_C(   246005884),  INT32_C(   396271050),  INT32_C(  1745885921), -INT32_C(   703538232),  INT32_C(  2130042105), -INT32_C(   253688910) },
+      { -INT32_C(   898078521), -INT32_C(   178419565),  INT32_C(   928354336),  INT32_C(  1371700365),  INT32_C(   918545617), -INT32_C(  1235068300),  INT32_C(  1807526201), -INT32_C(  1100696775),
+        -INT32_C(   624351445),  INT32_C(  1000776517), -INT32_C(  1423063401), -INT32_C(  1184014460), -INT32_C(  1813072490),  INT32_C(  1535162756),  INT32_C(  1431559895), -INT32_C(  1546083009) },
+      { -INT32_C(  2100573576), -INT32_C(   765266595),  INT32_C(  1756182357), -INT32_C(    35368510),  INT32_C(  1907242687),  INT32_C(  1367914082),  INT32_C(  1529179068), -INT32_C(  1041711516),
+         INT32_C(  1049483977),  INT32_C(  1445084070), -INT32_C(  1065571539), -INT32_C(  1647658643),  INT32_C(   450991086), -INT32_C(   607626368), -INT32_C(   587639469),  INT32_C(    62039000) } },
+    { {  INT32_C(  1061661851),  INT32_C(   255954661),  INT32_C(   950530197),  INT32_C(   584317026), -INT32_C(   719777300), -INT32_C(  2139203560), -INT32_C(   687142073), -INT32_C(  1601097218),
+         INT32_C(   940456587), -INT32_C(   582155332),  INT32_C(  1081224768),  INT32_C(   665890730), -INT32_C(  1736773821), -INT32_C(   982576795),  INT32_C(   162007058), -INT32_C(  1417683309) },
+      { -INT32_C(  1470889354), -INT32_C(   800058177), -INT32_C(  1072923435),  INT32_C(   763340987), -INT32_C(  1242138481),  INT32_C(  2008430652),  INT32_C(  1054601397),  INT32_C(    52158466),
+         INT32_C(  1591428473),  INT32_C(   455204946),  INT32_C(  1129146143),  INT32_C(  1978192715), -INT32_C(   956480753), -INT32_C(   101422859),  INT32_C(   446955052),  INT32_C(  1130441608) },
+      { -INT32_C(  1399084972), -INT32_C(  1897541552), -INT32_C(   258621428), -INT32_C(   127783553),  INT32_C(   300725750),  INT32_C(  1477998518),  INT32_C(   189218523),  INT32_C(   838730523),
+         INT32_C(   982212315),  INT32_C(    62659361),  INT32_C(   775963469), -INT32_C(  1347783192), -INT32_C(   280770819),  INT32_C(   291895796),  INT32_C(   135404195), -INT32_C(   560774303) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi32(test_vec[i].b);
+    simde__m512i r = simde_mm512_shldi_epi32(a, b, INT32_C( 16));
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_shldi_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t b[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { { -INT32_C(  1305070921), -INT32_C(  1477259481),  INT32_C(   770877936),  INT32_C(   337511653),  INT32_C(   646383060), -INT32_C(  1512547228),  INT32_C(     1894366),  INT32_C(   700449294),
+         INT32_C(  2014631223), -INT32_C(    29880256),  INT32_C(   605973713), -INT32_C(   324936080),  INT32_C(  1546577695),  INT32_C(  2011986452),  INT32_C(  1991101613), -INT32_C(  1493615738) },
+      UINT16_C(29394),
+      {  INT32_C(   378496349),  INT32_C(  1633097104),  INT32_C(    99228909),  INT32_C(  1793579699),  INT32_C(  1620042838), -INT32_C(  1969096092), -INT32_C(  1400790869), -INT32_C(  1145950467),
+        -INT32_C(  1346741210), -INT32_C(  1172932552), -INT32_C(   232491267), -INT32_C(   418941585),  INT32_C(  1799314896),  INT32_C(   472785151),  INT32_C(   499922438),  INT32_C(   708074173) },
+      { -INT32_C(   280673872), -INT32_C(  1412402076),  INT32_C(   628166048),  INT32_C(   103452497),  INT32_C(  1218522526),  INT32_C(   926785062),  INT32_C(   790693755),  INT32_C(   443198807),
+        -INT32_C(  1437691448), -INT32_C(  1677421791),  INT32_C(  1060338983), -INT32_C(   484718415),  INT32_C(   378603484),  INT32_C(   759639994),  INT32_C(   153299739), -INT32_C(  2089583823) },
+      { -INT32_C(  1305070921),  INT32_C(   361802704),  INT32_C(   770877936),  INT32_C(   337511653), -INT32_C(   464107359), -INT32_C(  1512547228), -INT32_C(  1599394015),  INT32_C(   788339306),
+         INT32_C(  2014631223),  INT32_C(  2016975876),  INT32_C(   605973713), -INT32_C(   324936080),  INT32_C(  1573918353),  INT32_C(   553594183),  INT32_C(   906365219), -INT32_C(  1493615738) } },
+    { { -INT32_C(  1895361777),  INT32_C(  1700116490),  INT32_C(   359787681), -INT32_C(   289335497),  INT32_C(  1753844353),  INT32_C(  1434869764), -INT32_C(    37034727), -INT32_C(    96847762),
+         INT32_C(  1466677405), -INT32_C(   412378481),  INT32_C(  1146628096),  INT32_C(  1912743948),  INT32_C(   449806460),  INT32_C(   888245356), -INT32_C(     1826730), -INT32_C(   865947236) },
+      UINT16_C(32244),
+      {  INT32_C(  1100141861), -INT32_C(  1879432053), -INT32_C(   174568874),  INT32_C(   779668438), -INT32_C(    33114656), -INT32_C(  1217577693),  INT32_C(  1899451888),  INT32_C(   741243555),
+        -INT32_C(   212356012), -INT32_C(  1284656524), -INT32_C(  2051226162), -INT32_C(   445400530),  INT32_C(   651146330), -INT32_C(  1221479840),  INT32_C(   681699854),  INT32_C(     7651258) },
+      {  INT32_C(   851268510), -INT32_C(  1433202252),  INT32_C(   758760685), -INT32_C(  2039722871),  INT32_C(   523853623), -INT32_C(   587642613),  INT32_C(  1258535609),  INT32_C(  1680619163),
+         INT32_C(   504540096),  INT32_C(  1018907520), -INT32_C(  1988773278), -INT32_C(   202227192), -INT32_C(   187364386),  INT32_C(  1671303841),  INT32_C(   232449377),  INT32_C(  2100108623) },
+      { -INT32_C(  1895361777),  INT32_C(  1700116490),  INT32_C(  1247161657), -INT32_C(   289335497), -INT32_C(  1243603143),  INT32_C(  1025760505),  INT32_C(  1441811203),  INT32_C(  2057528364),
+        -INT32_C(  1269555694), -INT32_C(   412378481), -INT32_C(   976320139), -INT32_C(  1171328014), -INT32_C(  1269107499), -INT32_C(  1302305890), -INT32_C(   368177702), -INT32_C(   865947236) } },
+    { { -INT32_C(    59879777), -INT32_C(     1156369),  INT32_C(  1956997586),  INT32_C(    32388174),  INT32_C(  1886928059), -INT32_C(  1588382794), -INT32_C(  1641229866), -INT32_C(  1562035439),
+         INT32_C(   323342577),  INT32_C(  1660652701), -INT32_C(   846157942), -INT32_C(   555751344), -INT32_C(   343613619), -INT32_C(  1277945334), -INT32_C(   415022162),  INT32_C(  2062798864) },
+      UINT16_C(25877),
+      { -INT32_C(  1519265206),  INT32_C(  1019707314), -INT32_C(  1452073500), -INT32_C(  1483561512),  INT32_C(  2077137866), -INT32_C(  1101086947),  INT32_C(  1089558313), -INT32_C(  1590729342),
+         INT32_C(  1691701750), -INT32_C(  1122289710), -INT32_C(   116553618), -INT32_C(   354299850), -INT32_C(  1514097873),  INT32_C(   242129802),  INT32_C(  1930779572),  INT32_C(   452402951) },
+      { -INT32_C(   778532416), -INT32_C(  1270286948),  INT32_C(   647848297),  INT32_C(  2134718396), -INT32_C(  2113391877),  INT32_C(  2054603621), -INT32_C(  1998358058),  INT32_C(  1198091587),
+         INT32_C(  1927640339),  INT32_C(   303227344), -INT32_C(  1907332498),  INT32_C(  1961834257),  INT32_C(  1237867104), -INT32_C(  1467352883),  INT32_C(  1991068973),  INT32_C(   271887264) },
+      { -INT32_C(   632630888), -INT32_C(     1156369),  INT32_C(   501491357),  INT32_C(    32388174), -INT32_C(  1681227256), -INT32_C(  1588382794), -INT32_C(  1641229866), -INT32_C(  1562035439),
+         INT32_C(  1375105765),  INT32_C(  1660652701), -INT32_C(  2006020528), -INT32_C(   555751344), -INT32_C(   343613619), -INT32_C(  1685411703),  INT32_C(  1538553517),  INT32_C(  2062798864) } },
+    { {  INT32_C(  1740797633), -INT32_C(   795755809),  INT32_C(  1229928713), -INT32_C(  1444502731), -INT32_C(   887252466),  INT32_C(   960597030), -INT32_C(   363040115), -INT32_C(  1159599961),
+         INT32_C(  1008529705),  INT32_C(  1338963956),  INT32_C(  1140907781), -INT32_C(  1075180004),  INT32_C(  1273782864), -INT32_C(   931396397), -INT32_C(  1636511401),  INT32_C(   899464025) },
+      UINT16_C(29285),
+      { -INT32_C(  1444787009),  INT32_C(  1000012748),  INT32_C(   420182825),  INT32_C(   208468329), -INT32_C(  2035681680),  INT32_C(  1638565169),  INT32_C(   177280819), -INT32_C(   330125842),
+         INT32_C(  1983141019),  INT32_C(   145217624),  INT32_C(  1082618324),  INT32_C(   437298606),  INT32_C(   415838678), -INT32_C(  1824706068), -INT32_C(  2113886800),  INT32_C(  1069830365) },
+      {  INT32_C(  1541575539),  INT32_C(  1834970889), -INT32_C(   565954917),  INT32_C(   391642879), -INT32_C(  1765176155),  INT32_C(  1897088353), -INT32_C(   623804187),  INT32_C(   107934525),
+        -INT32_C(  1347769384),  INT32_C(  1850867766),  INT32_C(   755891828), -INT32_C(  2087836939),  INT32_C(  1393627114),  INT32_C(    20941541), -INT32_C(   185898239),  INT32_C(  1777789813) },
+      {  INT32_C(  1287609314), -INT32_C(   795755809),  INT32_C(  2066341444), -INT32_C(  1444502731), -INT32_C(   887252466), -INT32_C(  2060357357),  INT32_C(   389274321), -INT32_C(  1159599961),
+         INT32_C(  1008529705), -INT32_C(   665293230),  INT32_C(  1140907781), -INT32_C(  1075180004),  INT32_C(   836129553),  INT32_C(   837550399), -INT32_C(  1515129621),  INT32_C(   899464025) } },
+    { { -INT32_C(  1209912673),  INT32_C(  1634281376),  INT32_C(   399789195),  INT32_C(  1029694179),  INT32_C(  2117248297), -INT32_C(  1846514154),  INT32_C(  2086202852), -INT32_C(   962077644),
+         INT32_C(   914593445), -INT32_C(   221938700), -INT32_C(   808551749), -INT32_C(    67476402), -INT32_C(   248941158), -INT32_C(   370746894), -INT32_C(  1207902212), -INT32_C(  1618606463) },
+      UINT16_C(61694),
+      {  INT32_C(   349516242),  INT32_C(  1736295510), -INT32_C(  2048104193),  INT32_C(  1088271874),  INT32_C(   661516846),  INT32_C(    35784867),  INT32_C(   900769710),  INT32_C(  2040167075),
+         INT32_C(    31379781),  INT32_C(  1465986837),  INT32_C(   256078089), -INT32_C(  2086912265),  INT32_C(  1359060576),  INT32_C(  1334990999), -INT32_C(   105851609), -INT32_C(  1082824288) },
+      {  INT32_C(  1864314860),  INT32_C(    78498009),  INT32_C(   873770896), -INT32_C(  1424137286), -INT32_C(  2018994722),  INT32_C(   154764882),  INT32_C(   273295023),  INT32_C(   356989362),
+        -INT32_C(  1033474881),  INT32_C(  1624327995),  INT32_C(   277076494), -INT32_C(  1185680262),  INT32_C(   992332810),  INT32_C(  2116082043), -INT32_C(   977887760),  INT32_C(   657023378) },
+      { -INT32_C(  1209912673), -INT32_C(  1000995667),  INT32_C(  1761555476), -INT32_C(  1241339107), -INT32_C(   231831640),  INT32_C(   144902457), -INT32_C(  1481764790),  INT32_C(  2057508167),
+         INT32_C(   914593445), -INT32_C(   221938700), -INT32_C(   808551749), -INT32_C(    67476402), -INT32_C(  1637860571),  INT32_C(  1486323232), -INT32_C(   718813770),  INT32_C(  1772103465) } },
+    { { -INT32_C(  1240442260), -INT32_C(  1518395611),  INT32_C(  1699577334),  INT32_C(  1740691319), -INT32_C(  1940765041), -INT32_C(   961808737), -INT32_C(   987292889), -INT32_C(   599750240),
+         INT32_C(  1812610231),  INT32_C(  1439607256),  INT32_C(  1829217433),  INT32_C(    76246341), -INT32_C(  1509632098), -INT32_C(   196324697),  INT32_C(   199927661), -INT32_C(  1026606295) },
+      UINT16_C(42471),
+      {  INT32_C(  1600070933),  INT32_C(   415839521),  INT32_C(  1004188150),  INT32_C(  2083790515),  INT32_C(   745861570),  INT32_C(   379400636), -INT32_C(  2030323108),  INT32_C(   128626005),
+         INT32_C(  1244318047),  INT32_C(   507965836), -INT32_C(  1119807604),  INT32_C(   543052380),  INT32_C(   377390580),  INT32_C(  2067076544),  INT32_C(  1272596171),  INT32_C(   931825511) },
+      {  INT32_C(  1852467953), -INT32_C(  1907572292),  INT32_C(  1921227995), -INT32_C(   632544744), -INT32_C(  1364381403), -INT32_C(  1350266005), -INT32_C(  1282370656),  INT32_C(   448754594),
+        -INT32_C(  1935418340),  INT32_C(  1647859347), -INT32_C(  1126735882), -INT32_C(   485127475),  INT32_C(  1163866568), -INT32_C(  1204276569),  INT32_C(   831163151),  INT32_C(   185073387) },
+      {  INT32_C(   622161514),  INT32_C(   891391564), -INT32_C(  1309248893),  INT32_C(  1740691319), -INT32_C(  1940765041),  INT32_C(   834449284), -INT32_C(  1168329840), -INT32_C(  1386931521),
+        -INT32_C(   916484957),  INT32_C(  1439607256),  INT32_C(   395099351),  INT32_C(    76246341), -INT32_C(  1509632098),  INT32_C(   364951608),  INT32_C(   199927661), -INT32_C(  2023290105) } },
+    { {  INT32_C(   280884969), -INT32_C(  1636944810), -INT32_C(  1266074813),  INT32_C(   405992285),  INT32_C(   109292098),  INT32_C(  1522264080),  INT32_C(  2088242688), -INT32_C(   868975572),
+         INT32_C(  2127377709),  INT32_C(   456910948),  INT32_C(   812812131), -INT32_C(  1550433180), -INT32_C(   609840246),  INT32_C(   644522966),  INT32_C(  1938213766), -INT32_C(  1705754469) },
+      UINT16_C(26018),
+      { -INT32_C(   338676539),  INT32_C(   823639150), -INT32_C(  1349362481),  INT32_C(  1799173038), -INT32_C(   586305327),  INT32_C(  2117076492), -INT32_C(  1413066152),  INT32_C(  1151039450),
+         INT32_C(   954581096), -INT32_C(   718419440),  INT32_C(   378208750), -INT32_C(  2034282570),  INT32_C(   853262031),  INT32_C(   689026152),  INT32_C(  1644998933), -INT32_C(   409010798) },
+      { -INT32_C(   144061344), -INT32_C(   871565340),  INT32_C(  1676687051),  INT32_C(  1538697547),  INT32_C(  1300942621), -INT32_C(  1847271097),  INT32_C(   428501118), -INT32_C(   634984619),
+         INT32_C(  1324167009), -INT32_C(  1947595742),  INT32_C(   350718572),  INT32_C(  1420794954), -INT32_C(   126554232),  INT32_C(  1965499723),  INT32_C(  1506603869), -INT32_C(  1982823157) },
+      {  INT32_C(   280884969), -INT32_C(  1133589492), -INT32_C(  1266074813),  INT32_C(   405992285),  INT32_C(   109292098),  INT32_C(   101487076),  INT32_C(  2088242688),  INT32_C(  2010831398),
+        -INT32_C(  1066905875),  INT32_C(   456910948),  INT32_C(    32380135), -INT32_C(  1550433180), -INT32_C(   609840246), -INT32_C(  1268222681), -INT32_C(  1324000820), -INT32_C(  1705754469) } },
+    { { -INT32_C(  1172273341), -INT32_C(   987240319), -INT32_C(   869733448), -INT32_C(  1467745051),  INT32_C(  1049044745), -INT32_C(  1936743394), -INT32_C(  1752955727),  INT32_C(  1982240722),
+        -INT32_C(  1479792624), -INT32_C(   580712468),  INT32_C(   285721718), -INT32_C(   928934177),  INT32_C(   309619363),  INT32_C(   754915234),  INT32_C(  1968789908), -INT32_C(   926064799) },
+      UINT16_C(38638),
+      {  INT32_C(  1300412727), -INT32_C(  1325821709), -INT32_C(   614078323), -INT32_C(   469624212),  INT32_C(  1502402385),  INT32_C(   295365977),  INT32_C(  1675150159),  INT32_C(  1562762443),
+         INT32_C(   671220945),  INT32_C(   236848250), -INT32_C(  1899822168),  INT32_C(   888266459),  INT32_C(  2103927788),  INT32_C(  2080170817), -INT32_C(  1596912877),  INT32_C(  1461143395) },
+      {  INT32_C(   961121527),  INT32_C(  1212592511), -INT32_C(   976336846),  INT32_C(  1496802780),  INT32_C(  1092186977), -INT32_C(  1330311373),  INT32_C(   459214105), -INT32_C(  1400810669),
+        -INT32_C(   405734107),  INT32_C(  1701550128),  INT32_C(  1021528395),  INT32_C(  1644217292),  INT32_C(   733919112), -INT32_C(   960013515),  INT32_C(   208450869), -INT32_C(    74515476) },
+      { -INT32_C(  1172273341), -INT32_C(  1863104442), -INT32_C(   393361970),  INT32_C(   443308343),  INT32_C(  1049044745), -INT32_C(   312889163), -INT32_C(  1018225825), -INT32_C(   590631807),
+        -INT32_C(  1479792624),  INT32_C(    75130219),  INT32_C(    61357283), -INT32_C(   928934177),  INT32_C(  1676422078),  INT32_C(   754915234),  INT32_C(  1968789908),  INT32_C(  1197734798) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi32(test_vec[i].b);
+    simde__m512i r = simde_mm512_mask_shldi_epi32(src, test_vec[i].k, a, b, INT32_C( 80));
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_shldi_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t b[16];
+    const int32_t r[16];
+  } test_vec[] = {
+    { UINT16_C( 6066),
+      { -INT32_C(   567760099),  INT32_C(  1131256449),  INT32_C(  1384862035), -INT32_C(  1672309272), -INT32_C(  1505439953), -INT32_C(   114325847),  INT32_C(  1317474738), -INT32_C(   870841738),
+         INT32_C(  1870650025), -INT32_C(  1542807295),  INT32_C(  1439060689),  INT32_C(   144441051), -INT32_C(  1423107686),  INT32_C(  2065760722), -INT32_C(  1268110115),  INT32_C(   625300739) },
+      {  INT32_C(   135314183), -INT32_C(   747768782), -INT32_C(  1915294292),  INT32_C(  2128568768),  INT32_C(  2123071594), -INT32_C(  1118069192), -INT32_C(  1800963598), -INT32_C(  1549733089),
+         INT32_C(   902048786),  INT32_C(  2125699839),  INT32_C(  1784956424), -INT32_C(  1622955910), -INT32_C(   940291498), -INT32_C(   910502436),  INT32_C(   441202766),  INT32_C(  1608410238) },
+      {  INT32_C(           0),  INT32_C(   889431771),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1637941993),  INT32_C(   223574711),  INT32_C(           0),  INT32_C(    82659137),
+        -INT32_C(  1252889720),  INT32_C(  1107492199), -INT32_C(  1516055352),  INT32_C(           0),  INT32_C(   859148264),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } },
+    { UINT16_C(47665),
+      {  INT32_C(   179788549),  INT32_C(  1289208352),  INT32_C(  1675004840),  INT32_C(   965662577), -INT32_C(  1097086271), -INT32_C(  1952311573),  INT32_C(  1452226028), -INT32_C(  1483968466),
+         INT32_C(    78320004), -INT32_C(  1530696252), -INT32_C(  1540560121),  INT32_C(   894259557), -INT32_C(  1140785889), -INT32_C(   266058505), -INT32_C(   972522787),  INT32_C(   689659263) },
+      {  INT32_C(   233762111), -INT32_C(   564870299),  INT32_C(    66466555), -INT32_C(  1659947259), -INT32_C(  2026804862), -INT32_C(   523525106),  INT32_C(   447597257), -INT32_C(  1033075308),
+         INT32_C(   353752307), -INT32_C(  1312662825),  INT32_C(   144815638),  INT32_C(  1097301418), -INT32_C(  2133867331),  INT32_C(   221071629), -INT32_C(  1868889289), -INT32_C(  2122132621) },
+      { -INT32_C(  1240851491),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1786573214),  INT32_C(   769114519),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0), -INT32_C(   611753084),  INT32_C(           0), -INT32_C(  1563786546), -INT32_C(    96534113), -INT32_C(  1980884390),  INT32_C(           0), -INT32_C(  1157692667) } },
+    { UINT16_C(21704),
+      { -INT32_C(   456959647), -INT32_C(    38741145), -INT32_C(  1040578996), -INT32_C(  1537867180), -INT32_C(  2010875165), -INT32_C(  1076980953),  INT32_C(  2124361618),  INT32_C(  1824069564),
+         INT32_C(  1181766170), -INT32_C(  1733877310), -INT32_C(   376437029),  INT32_C(   828622952), -INT32_C(  1549003629),  INT32_C(  1176921178), -INT32_C(  1339274644), -INT32_C(   970263295) },
+      { -INT32_C(   730543325),  INT32_C(   517464289), -INT32_C(  2047859632), -INT32_C(  2073641064),  INT32_C(  1649046171),  INT32_C(  1820575278),  INT32_C(  1375121370), -INT32_C(  1022501731),
+         INT32_C(  2028582492),  INT32_C(   121748526), -INT32_C(   493548183),  INT32_C(   748250493), -INT32_C(  1835203664),  INT32_C(   336001299), -INT32_C(  1052648932), -INT32_C(   854077420) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(    78186701),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1596236781),  INT32_C(   796493339),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(   230147370),  INT32_C(           0),  INT32_C(   690431290),  INT32_C(           0), -INT32_C(  1797684605),  INT32_C(           0) } },
+    { UINT16_C(33760),
+      {  INT32_C(   452822759), -INT32_C(   767913068),  INT32_C(  1865927391),  INT32_C(   754678603), -INT32_C(  1347278828), -INT32_C(   889614816), -INT32_C(  2132964201), -INT32_C(  1454645031),
+         INT32_C(  2058043384), -INT32_C(  1575455632),  INT32_C(  1138903695), -INT32_C(  1457534789), -INT32_C(   148267996),  INT32_C(  2005188016), -INT32_C(  2119503087), -INT32_C(  1698848760) },
+      { -INT32_C(   782814895),  INT32_C(  1830406226),  INT32_C(   167415107),  INT32_C(  1331781977),  INT32_C(   865075957),  INT32_C(  1825114401), -INT32_C(  1814118936), -INT32_C(  1828765772),
+         INT32_C(     8722751),  INT32_C(   487527896), -INT32_C(   895364425),  INT32_C(   735612273), -INT32_C(   371670701), -INT32_C(  1843651566),  INT32_C(  1624750741),  INT32_C(  1510606452) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   474012050),  INT32_C(   422520765), -INT32_C(  1045223938),
+         INT32_C(  2146435338), -INT32_C(   387958242),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1074836500) } },
+    { UINT16_C(47601),
+      { -INT32_C(  1918849086), -INT32_C(   281863292),  INT32_C(  1642244998), -INT32_C(   442056891), -INT32_C(   451292648), -INT32_C(   221944406),  INT32_C(   388746967), -INT32_C(    14290253),
+         INT32_C(   336636834),  INT32_C(   818527282),  INT32_C(  1003415548),  INT32_C(  2062114153), -INT32_C(   465395304), -INT32_C(   748293959),  INT32_C(   883278412),  INT32_C(  1674203244) },
+      {  INT32_C(   791791841),  INT32_C(  1286990583), -INT32_C(  1611641328), -INT32_C(  1038972464), -INT32_C(   960143571),  INT32_C(  1615783187),  INT32_C(  1819065842), -INT32_C(   476545518),
+        -INT32_C(  1007144906),  INT32_C(  1053665858), -INT32_C(   585636304), -INT32_C(  1245302748), -INT32_C(    29479360), -INT32_C(   861698421), -INT32_C(  1734738205),  INT32_C(  1988191507) },
+      {  INT32_C(  1602510435),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1540256374), -INT32_C(   883638115), -INT32_C(  1649485607), -INT32_C(   446183632),
+         INT32_C(  1464174576),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1160549492),  INT32_C(  1127349372), -INT32_C(   512517817),  INT32_C(           0), -INT32_C(  1596396286) } },
+    { UINT16_C(35804),
+      {  INT32_C(   952999115), -INT32_C(  2005877256), -INT32_C(  1772445909), -INT32_C(   962209647), -INT32_C(  2119929157), -INT32_C(  1577570200), -INT32_C(  1772200334),  INT32_C(  1234883871),
+         INT32_C(  1171436357), -INT32_C(  2027189007),  INT32_C(  1597502032),  INT32_C(  2106354905), -INT32_C(   308252951), -INT32_C(  1736079810), -INT32_C(  1677672609), -INT32_C(  1515835145) },
+      { -INT32_C(  1605862822),  INT32_C(  1079789775),  INT32_C(   775048244), -INT32_C(  1020830754),  INT32_C(  1391590490), -INT32_C(   293515268), -INT32_C(   165092993),  INT32_C(  1136159399),
+        -INT32_C(  1388873933), -INT32_C(   164341134),  INT32_C(   470552827),  INT32_C(   742684760), -INT32_C(  1292029474), -INT32_C(  1113928947),  INT32_C(  1946816106), -INT32_C(   742349422) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(  1045847140), -INT32_C(  1323071922), -INT32_C(   445209117),  INT32_C(           0), -INT32_C(  1125782447), -INT32_C(  1438742672),
+         INT32_C(  1720408686),  INT32_C(   434367592),  INT32_C(           0), -INT32_C(   642623352),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1643095937) } },
+    { UINT16_C(36724),
+      { -INT32_C(  1491866518), -INT32_C(   908295776),  INT32_C(  1364010448),  INT32_C(   129689949),  INT32_C(  1118292689), -INT32_C(  1399992754),  INT32_C(  1969703789),  INT32_C(  1476965245),
+         INT32_C(  1350634892),  INT32_C(   965274520),  INT32_C(   434246307), -INT32_C(   559036287), -INT32_C(   324012807), -INT32_C(   701486443), -INT32_C(  1188326229),  INT32_C(  1715782096) },
+      {  INT32_C(  2011956264),  INT32_C(  1355095837),  INT32_C(   815866838),  INT32_C(    19353574),  INT32_C(   553471279), -INT32_C(   819743702), -INT32_C(  1928098706), -INT32_C(  2054932444),
+        -INT32_C(  1287139806),  INT32_C(  1990972962),  INT32_C(   409927670), -INT32_C(  1059097636),  INT32_C(   459244799), -INT32_C(   664621757),  INT32_C(   660205195),  INT32_C(    60736383) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(  1268801858),  INT32_C(           0), -INT32_C(  1784528390), -INT32_C(  1667391929), -INT32_C(  1764025817),  INT32_C(           0),
+         INT32_C(   454649487), -INT32_C(   684659369),  INT32_C(   625357021), -INT32_C(  1862041154),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  2086664387) } },
+    { UINT16_C( 5413),
+      {  INT32_C(  1750641487),  INT32_C(   876916720),  INT32_C(  1499431026),  INT32_C(    15839375),  INT32_C(  1479203744),  INT32_C(   206632834), -INT32_C(   468819330),  INT32_C(   502554287),
+        -INT32_C(   353690357), -INT32_C(  1163193589),  INT32_C(  1422202729), -INT32_C(  1020951530),  INT32_C(  2047232030), -INT32_C(   818034578), -INT32_C(  1433595406), -INT32_C(   495414971) },
+      { -INT32_C(  1591491445),  INT32_C(    80187486),  INT32_C(   402698640),  INT32_C(   935882862), -INT32_C(  1598840587), -INT32_C(   874726057), -INT32_C(  1733725822),  INT32_C(  1063599987),
+        -INT32_C(  1692306633),  INT32_C(  1659314630),  INT32_C(   987993668), -INT32_C(  1837497264),  INT32_C(  1053757309),  INT32_C(  2046621658), -INT32_C(  1365008659), -INT32_C(  1695053131) },
+      {  INT32_C(  1453277767),  INT32_C(           0),  INT32_C(    14954497),  INT32_C(           0),  INT32_C(           0), -INT32_C(   284846151),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(   974599746),  INT32_C(           0),  INT32_C(   785544647),  INT32_C(           0), -INT32_C(  1875083874),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi32(test_vec[i].b);
+    simde__m512i r = simde_mm512_maskz_shldi_epi32(test_vec[i].k, a, b, INT32_C( 17));
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_shldi_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t b[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { {  INT64_C( 5331158778781126666),  INT64_C( 1322513621075470063), -INT64_C( 6340866187692720596),  INT64_C( 8789380416419805865),
+        -INT64_C( 7737218990892073139), -INT64_C( 5822148431996045481),  INT64_C(   49279492456038982),  INT64_C( 4348817265208201742) },
+      {  INT64_C( 6285203126554929072),  INT64_C( 1408689396465781979), -INT64_C( 4845408809051915399),  INT64_C( 7961517028255790893),
+        -INT64_C( 4855720576061971488), -INT64_C( 3669479764840892049), -INT64_C( 1655115839841480102),  INT64_C( 3687179082235801094) },
+      {  INT64_C( 8381210276280070515), -INT64_C( 3339719206405174557),  INT64_C( 5349762596577107000),  INT64_C( 8807538313284914726),
+         INT64_C( 8700758477586554079),  INT64_C( 5131666838717175930), -INT64_C( 8231939202206864976), -INT64_C( 3309567163228104965) } },
+    { {  INT64_C( 8314166545876128949),  INT64_C( 3837356796636749589),  INT64_C( 3406905046483197115),  INT64_C( 5674934661704384357),
+         INT64_C( 1560169385807692832),  INT64_C( 5797274972704414561), -INT64_C( 6401408797551583334),  INT64_C( 9088476942723058738) },
+      {  INT64_C( 5720985339012534214),  INT64_C( 2335182758250879319), -INT64_C(  930774984355938404), -INT64_C(  348492174779542102),
+         INT64_C( 6579170392018744782),  INT64_C( 8841089801065751713),  INT64_C( 8476943192135870850), -INT64_C( 3849113294011235675) },
+      {  INT64_C( 7067473067853077201), -INT64_C(  657783791640880985),  INT64_C( 2151801374683764043),  INT64_C( 8142338780723426979),
+        -INT64_C( 9096109770860356331),  INT64_C( 5700256932965405947), -INT64_C( 2260918657860834396),  INT64_C( 6200386632650316354) } },
+    { {  INT64_C( 7073559224354699744),  INT64_C( 3289970194965025256), -INT64_C( 5731887389058704589),  INT64_C( 3556030315861316401),
+         INT64_C( 3687103579200192187), -INT64_C( 3698649008809589513),  INT64_C( 7892596425352102703),  INT64_C( 1669613677769690433) },
+      { -INT64_C( 5289667226511423119),  INT64_C( 9129214106028749967), -INT64_C( 1894161741899258316),  INT64_C( 5553342092921796700),
+         INT64_C( 3051189016600085199), -INT64_C( 1989897919283946024),  INT64_C( 6553092838969407237),  INT64_C( 6246857672493343326) },
+      {  INT64_C( 6447431416385089263), -INT64_C( 8984144150786220964), -INT64_C( 7108030525170389390),  INT64_C( 8003795169842247148),
+         INT64_C( 5512048784487497381),  INT64_C(  992190378204881573), -INT64_C( 6826560542522263650), -INT64_C( 7454229967630764877) } },
+    { {  INT64_C( 6676413847770928387), -INT64_C( 5472727237609775616), -INT64_C( 6475917571221803697),  INT64_C( 8564136291645786795),
+        -INT64_C( 1089002907010943082), -INT64_C( 4768624914902642359), -INT64_C( 1138730690920734714),  INT64_C( 2725874610079045891) },
+      {  INT64_C( 8865253239874900675),  INT64_C(  313000945632932521),  INT64_C( 9201647426372872778), -INT64_C( 8764561218953217765),
+        -INT64_C( 8914834806815146211), -INT64_C( 4025551382229698845), -INT64_C( 7719851085301936925), -INT64_C( 1465154882109859189) },
+      { -INT64_C( 2119784222662796802), -INT64_C( 6188508819304172638), -INT64_C( 7120948025923365643), -INT64_C( 7779216812737691124),
+         INT64_C( 4519246245979814364),  INT64_C( 2779083568983201949), -INT64_C( 3053433310914783515),  INT64_C(  331300358304916926) } },
+    { {  INT64_C( 2263032700800268746),  INT64_C( 2042471075302070981),  INT64_C( 5764161519226782112),  INT64_C( 1195476349456855253),
+        -INT64_C( 6819137480172181570), -INT64_C( 2303995930554940832), -INT64_C( 8400023285435207971),  INT64_C( 3195308552625426968) },
+      {  INT64_C(  168490637666076102), -INT64_C( 1509891058950569034), -INT64_C( 2614190990605389202), -INT64_C( 8226316614200216046),
+        -INT64_C( 7423274112297203614), -INT64_C( 7583736854300210543), -INT64_C(  302720212559400635), -INT64_C( 7756608584923552828) },
+      {  INT64_C( 5402571339399255966),  INT64_C( 7195280967983568101),  INT64_C( 9007657595271849221), -INT64_C( 4489854023326720048),
+        -INT64_C( 3969994982244514198),  INT64_C( 6035492651231838953), -INT64_C( 6922351503684038128),  INT64_C(  113179966098478745) } },
+    { {  INT64_C( 2232092955935917703), -INT64_C( 8793630464639942770), -INT64_C( 2919058958754926994), -INT64_C(  591436694443283960),
+         INT64_C( 8265026699428338776), -INT64_C( 1851347725093634666), -INT64_C( 7430508375188261037), -INT64_C( 5109010743935976105) },
+      {  INT64_C( 8687801536209351700),  INT64_C( 1791062106984990642),  INT64_C( 8504633984884201924),  INT64_C( 3881805962158382138),
+        -INT64_C( 3277526543018026751),  INT64_C( 3345059999083932833), -INT64_C( 7870242861412039758),  INT64_C( 7479548331754468715) },
+      {  INT64_C( 3910962278320928668),  INT64_C( 1531098635736022833), -INT64_C(  167074682971386691), -INT64_C( 7806417976626645835),
+        -INT64_C( 8386730744891639451),  INT64_C( 1224299799839922341),  INT64_C( 6248554897873555677),  INT64_C(  773870814305031250) } },
+    { {  INT64_C( 8628426528281020342),  INT64_C( 2396893551876137665),  INT64_C( 5566197903900843887),  INT64_C( 1408558883249261401),
+        -INT64_C( 7012779211391164097), -INT64_C( 3597556321185011577), -INT64_C( 8958152193619197599),  INT64_C( 6808394360693084754) },
+      {  INT64_C(  569948892128081016),  INT64_C( 4272030818650242397), -INT64_C( 8779069602023913215), -INT64_C( 3031332056417977141),
+         INT64_C( 6287982844963732018),  INT64_C( 7168938078938773789), -INT64_C( 1538753721501617517),  INT64_C( 3960143232388881255) },
+      { -INT64_C( 4663558744031002777),  INT64_C(   27797008094684471), -INT64_C( 8602034141225372192),  INT64_C( 5407514552953441836),
+        -INT64_C( 3953809353829051117),  INT64_C( 5649914593908044603),  INT64_C( 8142897261685220505), -INT64_C( 2138556477051156030) } },
+    { { -INT64_C( 5232270793863599913),  INT64_C( 4150856156922213368), -INT64_C(   86864203607260907), -INT64_C( 4295722275245647185),
+        -INT64_C( 6886480307658871987), -INT64_C( 7664501842834347269),  INT64_C( 5314987805268494926), -INT64_C( 5404581559648483015) },
+      {  INT64_C( 2450773278007486623),  INT64_C( 5110398586934253596), -INT64_C( 3181119591495555176),  INT64_C( 1931350117613534668),
+         INT64_C(   33408941352033860), -INT64_C( 7489485875949333418), -INT64_C( 7928928733924349181),  INT64_C( 1601220019879837278) },
+      {  INT64_C( 2011093774698368964),  INT64_C( 1689967268681248850),  INT64_C( 5386610628958131704),  INT64_C( 4619196897474163457),
+         INT64_C( 4984162077002252625), -INT64_C( 8634812705007450403), -INT64_C( 8085563792172690587), -INT64_C( 8752401633214914596) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i r = simde_mm512_shldi_epi64(a, b, INT32_C( 40));
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_shldi_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[8];
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t b[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { {  INT64_C( 1941604493214901338), -INT64_C( 4931297384235333174), -INT64_C( 6873754603530936328),  INT64_C( 9035113312695292755),
+        -INT64_C( 3139430020414140609),  INT64_C( 5898137037017221421),  INT64_C(  398249169852269267), -INT64_C( 9210377029782019243) },
+      UINT8_C(143),
+      { -INT64_C( 6332974711018710235), -INT64_C( 7872541118524184939),  INT64_C( 6161765836855777049), -INT64_C( 4431112947128495885),
+         INT64_C( 2594757826350457705), -INT64_C(  878164069082068374), -INT64_C( 3631314088959740964), -INT64_C( 2301233182107822632) },
+      {  INT64_C( 6808531233870021289), -INT64_C(  815267590443932224),  INT64_C( 8761431174437554895),  INT64_C( 6407426003566794545),
+        -INT64_C( 1853140887361377830),  INT64_C( 6375645641384278757),  INT64_C( 3897999747070371278), -INT64_C( 6791187300530937804) },
+      {  INT64_C( 3646549411036861828), -INT64_C( 5357429828560195030), -INT64_C( 1362592352243598420), -INT64_C( 4210598088353513325),
+        -INT64_C( 3139430020414140609),  INT64_C( 5898137037017221421),  INT64_C(  398249169852269267),  INT64_C( 2239934578923610532) } },
+    { { -INT64_C( 2483084126556812780), -INT64_C( 3877439395719892500),  INT64_C( 7831102306783133049),  INT64_C( 5667696767554935932),
+         INT64_C( 7328038312044963784),  INT64_C(  668149711916271379),  INT64_C( 5087280528371786553), -INT64_C( 7391582754597632420) },
+      UINT8_C(135),
+      { -INT64_C( 7974818715812571666),  INT64_C( 4545041712349095304),  INT64_C(  422821656805215981),  INT64_C( 5490146407952001257),
+         INT64_C( 7243771317780934622),  INT64_C( 4408965640801732100), -INT64_C( 3388033468831925463),  INT64_C( 6193646493042273111) },
+      {  INT64_C(  659120261277978933),  INT64_C( 3538500903152927989),  INT64_C( 5760227224210348745), -INT64_C( 4661227680989737735),
+         INT64_C( 2056202440635195936), -INT64_C( 2507533329212864574), -INT64_C( 3266977016038360672),  INT64_C( 1836307721379502847) },
+      { -INT64_C( 2677972680347852115), -INT64_C( 1826904329336401191),  INT64_C( 4003398046371030068),  INT64_C( 5667696767554935932),
+         INT64_C( 7328038312044963784),  INT64_C(  668149711916271379),  INT64_C( 5087280528371786553),  INT64_C( 2372085395704784055) } },
+    { {  INT64_C( 2800626256459038798), -INT64_C( 7330648098660753480),  INT64_C( 6062511636433233661),  INT64_C( 4998721936808739438),
+        -INT64_C( 6746908803163202933),  INT64_C( 8495705739020947785), -INT64_C( 3378867090855781545), -INT64_C( 4862225046265316974) },
+      UINT8_C(205),
+      { -INT64_C( 4990219877496431321),  INT64_C( 4886980210483186033),  INT64_C( 3015220258860120909), -INT64_C( 2270284654865675639),
+        -INT64_C( 8971787390687591627), -INT64_C( 6018404875427880952), -INT64_C( 3618974737664677127),  INT64_C( 2201576591860212182) },
+      {  INT64_C( 8375062462923586472),  INT64_C( 4943758624408414172),  INT64_C( 9176553516881037362),  INT64_C( 1095458958109755725),
+         INT64_C( 6979221859265186103), -INT64_C( 8304685430515972608),  INT64_C(  904649987433516889),  INT64_C( 3824546352961941010) },
+      { -INT64_C( 4945753435636830238), -INT64_C( 7330648098660753480), -INT64_C( 1496517241810006564), -INT64_C( 5329296510652113328),
+        -INT64_C( 6746908803163202933),  INT64_C( 8495705739020947785),  INT64_C( 7091754395564924635), -INT64_C( 6583745656789883637) } },
+    { {  INT64_C( 4103340766742326272), -INT64_C( 6816854893475022224), -INT64_C( 8867604674649827910), -INT64_C( 4365297114566139083),
+         INT64_C( 3648934241220017774),  INT64_C( 8123821417893594190),  INT64_C( 1987898139924165056),  INT64_C( 8007258920356727605) },
+      UINT8_C(183),
+      {  INT64_C( 2832678871175898267),  INT64_C( 7405532276362019457), -INT64_C( 1977848701993812558), -INT64_C(  582523036828527261),
+        -INT64_C( 5382977968565479536), -INT64_C( 4464050899251689082),  INT64_C( 6406681715923292419),  INT64_C( 1596618920560190576) },
+      { -INT64_C( 8255145620878233060), -INT64_C( 4598704734596285022),  INT64_C( 4198177021727924011),  INT64_C( 2923841457474815990),
+        -INT64_C( 1086135530486379518), -INT64_C( 8300891352602696423),  INT64_C( 1860125573558984375), -INT64_C( 6757499910968856357) },
+      {  INT64_C( 3577155035807927202),  INT64_C( 4576362833769293995),  INT64_C( 3530173646228931108), -INT64_C( 4365297114566139083),
+        -INT64_C( 1830835359055512233), -INT64_C( 2951680141466580103),  INT64_C( 1987898139924165056), -INT64_C( 6312796935631035844) } },
+    { {  INT64_C(  868654293289804497),  INT64_C( 8585545737929015798), -INT64_C( 4136696413865469607), -INT64_C( 5798837094036924239),
+        -INT64_C( 7345692852336750468),  INT64_C( 8299392466249855229), -INT64_C( 8076481071366643531), -INT64_C( 3721628566980327038) },
+      UINT8_C( 61),
+      { -INT64_C( 8828846738931832111),  INT64_C( 2820209185916667316),  INT64_C( 3486919457499375757),  INT64_C( 1583090788186060290),
+         INT64_C( 7678489885871160039), -INT64_C( 1782453686530070526), -INT64_C( 2419354912504596000),  INT64_C( 8795226137840808813) },
+      {  INT64_C( 3591641392815869896), -INT64_C( 5745466486651572929),  INT64_C( 3979913080440975619),  INT64_C( 8273653857075476615),
+         INT64_C( 5455802300786101748), -INT64_C( 7270083192267627853),  INT64_C( 7016606530375843232),  INT64_C( 1824931423188009675) },
+      { -INT64_C( 7337822630838087357),  INT64_C( 8585545737929015798), -INT64_C( 6491783594493748172),  INT64_C(  429533506631915753),
+        -INT64_C( 4054674202116535977), -INT64_C( 3879848213775525139), -INT64_C( 8076481071366643531), -INT64_C( 3721628566980327038) } },
+    { {  INT64_C( 6977011581702230183), -INT64_C(  896202429618546182), -INT64_C( 2405740494423289900), -INT64_C( 9134460427248084853),
+        -INT64_C( 1652491352298843142), -INT64_C(  636861615709023236), -INT64_C( 7747237741656125894), -INT64_C( 3547937285707527959) },
+      UINT8_C( 87),
+      { -INT64_C( 1442701549710517911),  INT64_C( 5870341364343900286), -INT64_C( 5928370440322392393),  INT64_C(  124554240136818292),
+        -INT64_C( 4902555622663738007),  INT64_C( 8004914601395177908), -INT64_C( 5628865759865623815),  INT64_C( 2424704840208664026) },
+      { -INT64_C( 6012004579076314927), -INT64_C( 3888284031465427817), -INT64_C( 2395596790996732063), -INT64_C( 3446791209633509567),
+         INT64_C( 1658956616144220985),  INT64_C( 1811002044781133155),  INT64_C( 3595040486563985719), -INT64_C( 4004689505994047299) },
+      { -INT64_C( 7396764723090182092),  INT64_C(    2391206030624318), -INT64_C( 6314407460176041673), -INT64_C( 9134460427248084853),
+        -INT64_C( 8598100565977972549), -INT64_C(  636861615709023236), -INT64_C( 2762121428761950606), -INT64_C( 3547937285707527959) } },
+    { { -INT64_C( 7110803466108547847), -INT64_C( 4361932018088607272),  INT64_C( 2673767975492385864),  INT64_C(   46513536720798859),
+        -INT64_C( 7551013191803544192), -INT64_C( 5944044131109556636),  INT64_C( 6822331729663291346), -INT64_C(  811374114905140126) },
+      UINT8_C(186),
+      { -INT64_C( 1278943016586148505), -INT64_C( 3859469888801489155), -INT64_C( 3398206098463981265),  INT64_C( 3239516746370600267),
+        -INT64_C( 3178787668757735848),  INT64_C( 5849388145624689148), -INT64_C( 8978567748029783345), -INT64_C( 1042388667716221884) },
+      { -INT64_C(  164181905708000724),  INT64_C( 7240768010432411214), -INT64_C(  640772504660983728),  INT64_C( 4905153725903266386),
+         INT64_C( 8433277845539425188),  INT64_C( 4333203632174743829), -INT64_C( 5813276792207864320),  INT64_C( 5892516212311767520) },
+      { -INT64_C( 7110803466108547847), -INT64_C( 6071136639623617430),  INT64_C( 2673767975492385864),  INT64_C( 6434882198324335417),
+         INT64_C( 5590753247112824035),  INT64_C( 6280828490554130115),  INT64_C( 6822331729663291346), -INT64_C( 2178541201728453004) } },
+    { {  INT64_C( 2558115163486480352),  INT64_C( 5515622031988763373),  INT64_C( 5314410257784694228), -INT64_C( 5313552052210185395),
+         INT64_C( 6251360286023312177), -INT64_C( 1192419392892571116), -INT64_C( 1494756434334558628), -INT64_C( 7200063075962884136) },
+      UINT8_C(129),
+      { -INT64_C( 3612867833433664891), -INT64_C( 4822296751246366320), -INT64_C( 5878184316871132576), -INT64_C( 5820936637918634801),
+        -INT64_C( 3243167276758422594), -INT64_C( 3788264957445251885), -INT64_C(  765095111340741606), -INT64_C(  333444807652768852) },
+      {  INT64_C( 3183578848651422200),  INT64_C( 6494410379034769954),  INT64_C( 1143416207527523350), -INT64_C( 7402992399280973559),
+         INT64_C(  919072477513747030), -INT64_C( 1697692380935964270),  INT64_C( 2428781597013908299),  INT64_C( 5618827771076410595) },
+      { -INT64_C( 4588458645534533516),  INT64_C( 5515622031988763373),  INT64_C( 5314410257784694228), -INT64_C( 5313552052210185395),
+         INT64_C( 6251360286023312177), -INT64_C( 1192419392892571116), -INT64_C( 1494756434334558628), -INT64_C( 6304005602480351611) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi64(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i r = simde_mm512_mask_shldi_epi64(src, test_vec[i].k, a, b, INT32_C(168));
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_shldi_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t b[8];
+    const int64_t r[8];
+  } test_vec[] = {
+    { UINT8_C( 61),
+      {  INT64_C( 3925128055166130519),  INT64_C( 2945314814501358512),  INT64_C( 2663709506627903380),  INT64_C( 1079736429288298974),
+         INT64_C( 3557049712276001884),  INT64_C( 2227378831563185907),  INT64_C( 8855528001536050684), -INT64_C( 3962867377123802662) },
+      {  INT64_C( 3992218839678129106), -INT64_C( 5953261537505021767), -INT64_C( 1468486253460742540),  INT64_C( 2573367790303519652),
+         INT64_C( 8240727158567940987), -INT64_C( 8910785883645123556), -INT64_C( 2817824674323318403),  INT64_C( 3145900895624927583) },
+      {  INT64_C( 3581116444645770265),  INT64_C(                   0), -INT64_C( 4161561526235885359), -INT64_C( 8200003481556173326),
+         INT64_C( 4298889136835879170),  INT64_C( 1782835051957773951),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C(219),
+      { -INT64_C( 6500342812445242248),  INT64_C( 8292564086988536276), -INT64_C( 7581305360506554657),  INT64_C( 3566016934607490361),
+        -INT64_C( 3026778193255478545),  INT64_C(   64067097437483502),  INT64_C( 8002769281068525490), -INT64_C( 7229764611694332053) },
+      {  INT64_C( 2336520978399114850), -INT64_C( 4877216702746809380), -INT64_C(  518008308819291437),  INT64_C(  296264874909004445),
+         INT64_C( 1983946616916135948), -INT64_C( 7563240640128846199), -INT64_C( 1243152884760164310), -INT64_C( 8539418396866730721) },
+      { -INT64_C( 2298823448446966113),  INT64_C( 4175867615069765560),  INT64_C(                   0), -INT64_C( 7126258080717296888),
+         INT64_C( 4005351771702157205),  INT64_C(                   0), -INT64_C(   85737865906089124), -INT64_C( 8507626169522688908) } },
+    { UINT8_C( 79),
+      {  INT64_C( 6772507542990192817),  INT64_C( 7026323222033883883),  INT64_C( 9146232735082260837), -INT64_C( 2941038221566025630),
+        -INT64_C( 1503708889909211656),  INT64_C( 9162981769355741236), -INT64_C( 6123976879561382699),  INT64_C( 5939687685046159450) },
+      { -INT64_C( 8953622222481724474),  INT64_C( 3135097930762516946), -INT64_C( 4427753148707704453), -INT64_C( 5371371740634068189),
+        -INT64_C( 7749551165517920826),  INT64_C( 6051822065354081059),  INT64_C( 6280211104168159937), -INT64_C( 1240804407825884875) },
+      {  INT64_C( 3098866902415445455), -INT64_C( 3403078274187400634),  INT64_C( 4707048333098348772),  INT64_C( 7764422820571625637),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C( 1425858422675698516),  INT64_C(                   0) } },
+    { UINT8_C(172),
+      { -INT64_C( 7774883201994117329), -INT64_C(   69836336951320863),  INT64_C( 6378737830621929872), -INT64_C( 4091193578531575702),
+         INT64_C( 5356716425726966678), -INT64_C( 9213154967969956266),  INT64_C( 3628855361516533021), -INT64_C( 3420720262485786084) },
+      {  INT64_C( 8302900607300159639), -INT64_C( 2977093313549624519), -INT64_C( 2194242446355268277),  INT64_C( 4120564479698919462),
+         INT64_C( 2208296100251369247), -INT64_C( 2545169286292884552), -INT64_C( 1335915136648869653), -INT64_C( 8204431849034338766) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 2432825345531461059), -INT64_C( 8624159698739847155),
+         INT64_C(                   0),  INT64_C(  935813834201631162),  INT64_C(                   0),  INT64_C( 1982772529579779980) } },
+    { UINT8_C(153),
+      { -INT64_C( 7881868199191156234), -INT64_C( 2496128457128592607), -INT64_C( 3378986602278093844), -INT64_C(  501040294133737922),
+        -INT64_C( 1663091870415621688), -INT64_C( 1796081573877430931), -INT64_C( 7743396198664385936),  INT64_C( 3933758023603422963) },
+      {  INT64_C( 3028688766591092166), -INT64_C( 2290568137506898456),  INT64_C( 4511980191570383729), -INT64_C( 8431302624514638292),
+         INT64_C( 3913685572268223159), -INT64_C( 6613386892921292676), -INT64_C( 1150040603209870701),  INT64_C( 4823898618573749977) },
+      { -INT64_C( 8731375406749268505),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(   48551229369736751),
+         INT64_C( 1361090308618098099),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 8290535951786866833) } },
+    { UINT8_C(252),
+      {  INT64_C( 3088869038776936135),  INT64_C( 3681574103626888140),  INT64_C( 3343927277305957081),  INT64_C( 9019376626385796212),
+        -INT64_C( 2222602992706428551),  INT64_C( 2065183728668334530),  INT64_C( 2328986139240737732),  INT64_C(  562643964320809536) },
+      {  INT64_C( 3712890147492560151),  INT64_C( 4212217162129750205),  INT64_C( 5557175699279458382), -INT64_C( 5812100282768488141),
+         INT64_C(  946180558054359140),  INT64_C(  662500688823419565), -INT64_C( 2103456788750518137),  INT64_C( 4415146835923088647) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 2239892765223400939),  INT64_C( 6879505023672986717),
+         INT64_C(  487217904316868784),  INT64_C( 7112173451059248025), -INT64_C( 9126674637989977100), -INT64_C( 5186879607009095868) } },
+    { UINT8_C(248),
+      {  INT64_C( 4649886134997560687), -INT64_C( 6039079607671449584), -INT64_C( 1246583088087028503),  INT64_C( 2206637352564471097),
+         INT64_C( 8877681384514103370), -INT64_C(  525845156589629253), -INT64_C( 1599126199121699531), -INT64_C( 4314434781537105336) },
+      { -INT64_C(  967235019062189813), -INT64_C( 3451926902580880533), -INT64_C( 2842014213900821213),  INT64_C( 7805381167232666973),
+         INT64_C( 6800069410661730312),  INT64_C( 5228024629602963474), -INT64_C( 7441183642251576826),  INT64_C( 3386008113039550135) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 7884240372464984642),
+         INT64_C( 2256466951664972684),  INT64_C( 4260817088070379288), -INT64_C( 6252567272452927986), -INT64_C( 4029437033271729984) } },
+    { UINT8_C(112),
+      {  INT64_C( 3957827856038725650),  INT64_C( 8344095066250853290), -INT64_C( 3464792230623191837), -INT64_C( 1634904831142373294),
+        -INT64_C( 6318515020152120834), -INT64_C( 6568013087238677763), -INT64_C( 1405506489575422279),  INT64_C( 5400701124620791113) },
+      { -INT64_C( 8973514350108107704), -INT64_C( 6138004150841671628),  INT64_C(  258560498384109257), -INT64_C( 7852111666763991261),
+         INT64_C( 3470078790798602650),  INT64_C( 6909771357236697508),  INT64_C( 2057525571359945069),  INT64_C(  379238749218324472) },
+      {  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),
+        -INT64_C( 5065427665265849144),  INT64_C(  807827409798750518), -INT64_C( 5508621179602520518),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i r = simde_mm512_maskz_shldi_epi64(test_vec[i].k, a, b, INT32_C( 41));
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_shldi_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_shldi_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_shldi_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_shldi_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_shldi_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_shldi_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_shldi_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_shldi_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_shldi_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_shldi_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_shldi_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_shldi_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_shldi_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_shldi_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_shldi_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_shldi_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_shldi_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_shldi_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_shldi_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_shldi_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_shldi_epi16)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_shldi_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_shldi_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_shldi_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_shldi_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_shldi_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_shldi_epi64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
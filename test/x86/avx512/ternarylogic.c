@@ -0,0 +1,1242 @@
+/* SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Copyright:
+ *   2026      agent <agent@local>
+ */
+
+#define SIMDE_TEST_X86_AVX512_INSN ternarylogic
+
+#include <test/x86/avx512/test-avx512.h>
+#include <simde/x86/avx512/ternarylogic.h>
+
+static int
+test_simde_mm_ternarylogic_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t c[4];
+    const int32_t r0[4];
+    const int32_t r1[4];
+    const int32_t r2[4];
+    const int32_t r3[4];
+  } test_vec[] = {
+    { { -INT32_C(  1519393256),  INT32_C(   910725594), -INT32_C(   507094484), -INT32_C(  2127226932) },
+      {  INT32_C(  1330714495),  INT32_C(  1525486969), -INT32_C(  1355032022),  INT32_C(  1804892242) },
+      {  INT32_C(  2133440054),  INT32_C(   472517807), -INT32_C(   420375994), -INT32_C(   522867577) },
+      { -INT32_C(  1793636527),  INT32_C(  1888454668), -INT32_C(  1475603904),  INT32_C(   175424281) },
+      {  INT32_C(  1598101054),  INT32_C(   443161981), -INT32_C(  1489773974),  INT32_C(  1641330755) },
+      {  INT32_C(  1869198910),  INT32_C(   510137851), -INT32_C(   403449298), -INT32_C(   510313274) },
+      { -INT32_C(   896116249), -INT32_C(   373955039),  INT32_C(   507356563),  INT32_C(  2125097786) } },
+    { { -INT32_C(   960260592),  INT32_C(   547084527), -INT32_C(  1392433700),  INT32_C(  1520551952) },
+      { -INT32_C(  1932037738), -INT32_C(   570405679), -INT32_C(   698219807),  INT32_C(  1918529169) },
+      {  INT32_C(   860973528), -INT32_C(  1410317603), -INT32_C(   422710264), -INT32_C(  1981116105) },
+      {  INT32_C(  2034601566),  INT32_C(  1433130723), -INT32_C(  1649487051), -INT32_C(  1592707146) },
+      { -INT32_C(  1244431912), -INT32_C(  1956623663), -INT32_C(   959655744), -INT32_C(   750102217) },
+      { -INT32_C(  2032963184), -INT32_C(  1433384739), -INT32_C(   431938360),  INT32_C(  1525336081) },
+      {  INT32_C(  1211951015), -INT32_C(   569395918),  INT32_C(  1534200631),  INT32_C(   610215625) } },
+    { { -INT32_C(   641848159), -INT32_C(  1263693778), -INT32_C(  1626483547),  INT32_C(  1318401438) },
+      {  INT32_C(   341707784),  INT32_C(  1143638498), -INT32_C(  1325699686), -INT32_C(  1584639261) },
+      {  INT32_C(  2056995758), -INT32_C(   975529580),  INT32_C(  1414434278), -INT32_C(   391520166) },
+      { -INT32_C(  1216650489),  INT32_C(   895320152),  INT32_C(  2075669721),  INT32_C(   129009447) },
+      {  INT32_C(   840912654),  INT32_C(  1165658546), -INT32_C(   800371262), -INT32_C(  1599287102) },
+      {  INT32_C(  1486752936), -INT32_C(   995452506), -INT32_C(  1806709338), -INT32_C(   393383718) },
+      { -INT32_C(  2057260967),  INT32_C(  2047307721),  INT32_C(   737295131), -INT32_C(  1218818203) } },
+    { { -INT32_C(  1981108266), -INT32_C(   369353190),  INT32_C(  1687380422), -INT32_C(  2063907892) },
+      {  INT32_C(  1232054013),  INT32_C(   465348935),  INT32_C(   496789201), -INT32_C(    12854629) },
+      { -INT32_C(   142632900), -INT32_C(  1161212498),  INT32_C(  2145262305),  INT32_C(  1786514169) },
+      {  INT32_C(   939168023),  INT32_C(  1217002227),  INT32_C(   114367990),  INT32_C(   297571246) },
+      {  INT32_C(  2139076348),  INT32_C(   465389990),  INT32_C(   534543073), -INT32_C(   297841991) },
+      { -INT32_C(   915427588), -INT32_C(  1141109490),  INT32_C(  2107531969), -INT32_C(   293909799) },
+      {  INT32_C(  1082474795),  INT32_C(  1443017557), -INT32_C(  1725069537),  INT32_C(  2072034583) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi32(test_vec[i].c);
+    simde__m128i r;
+
+    r = simde_mm_ternarylogic_epi32(a, b, c, 0x96);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r0));
+    r = simde_mm_ternarylogic_epi32(a, b, c, 0xca);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r1));
+    r = simde_mm_ternarylogic_epi32(a, b, c, 0xe8);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r2));
+    r = simde_mm_ternarylogic_epi32(a, b, c, 0x1d);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r3));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_ternarylogic_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[2];
+    const int64_t b[2];
+    const int64_t c[2];
+    const int64_t r0[2];
+    const int64_t r1[2];
+    const int64_t r2[2];
+    const int64_t r3[2];
+  } test_vec[] = {
+    { {  INT64_C( 8513029113052271281),  INT64_C( 6730550883575326148) },
+      {  INT64_C( 3088077157605366772), -INT64_C( 3871305672037955622) },
+      {  INT64_C(  756905185599976145),  INT64_C( 7374353844878733360) },
+      {  INT64_C( 6232496235556420500), -INT64_C( 1047346814803275218) },
+      {  INT64_C( 3062740011793543920),  INT64_C( 7662416820321129968) },
+      {  INT64_C( 3062757610350596849),  INT64_C( 5640472935609689552) },
+      { -INT64_C( 2449985486677488306), -INT64_C( 7806633438411257313) } },
+    { {  INT64_C( 3944369612175539051), -INT64_C(  658835056591349706) },
+      { -INT64_C( 8793023817018784575), -INT64_C( 4889664101482965084) },
+      { -INT64_C( 5383704766506530947), -INT64_C( 8320423772609101872) },
+      {  INT64_C(  435984017340741847), -INT64_C( 4145317440285855678) },
+      { -INT64_C( 8793226280178989995), -INT64_C( 4898532487251920924) },
+      { -INT64_C( 5334171494345259159), -INT64_C( 4861802745198780492) },
+      { -INT64_C( 3799137313309934462),  INT64_C( 5439281267171690379) } },
+    { { -INT64_C( 5823862753284137540),  INT64_C( 5896977954414361480) },
+      {  INT64_C( 9005820144754049295), -INT64_C( 1935450139259469760) },
+      { -INT64_C( 1290013590519657862),  INT64_C(  186759148784462585) },
+      {  INT64_C( 4453656936229361353), -INT64_C( 5304642114040966863) },
+      {  INT64_C( 7798433511295042382),  INT64_C( 4828921273729351793) },
+      { -INT64_C( 1280856567639553730),  INT64_C( 4726464538990160584) },
+      {  INT64_C( 5896905239428183171), -INT64_C( 4870157238635801274) } },
+    { {  INT64_C( 1974824938045848674),  INT64_C( 7328557734724932897) },
+      {  INT64_C( 1915504343120996388), -INT64_C( 8303729997058310196) },
+      { -INT64_C(  408987895689636627), -INT64_C( 6854566212991384287) },
+      { -INT64_C(  315187718197624661),  INT64_C( 5307718277092143052) },
+      { -INT64_C(  426365124200093523), -INT64_C( 8877808655260379904) },
+      {  INT64_C( 1898264551837416548), -INT64_C( 6568728376208452319) },
+      {  INT64_C(  412080869146346262), -INT64_C( 2638124531399529762) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi64(test_vec[i].c);
+    simde__m128i r;
+
+    r = simde_mm_ternarylogic_epi64(a, b, c, 0x96);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r0));
+    r = simde_mm_ternarylogic_epi64(a, b, c, 0xca);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r1));
+    r = simde_mm_ternarylogic_epi64(a, b, c, 0xe8);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r2));
+    r = simde_mm_ternarylogic_epi64(a, b, c, 0x1d);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r3));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_ternarylogic_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[4];
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t r0[4];
+    const int32_t r1[4];
+  } test_vec[] = {
+    { { -INT32_C(   960772965), -INT32_C(  1866227039), -INT32_C(  1923374915), -INT32_C(   275456070) },
+      UINT8_C(254),
+      { -INT32_C(  1187666904),  INT32_C(   542805944), -INT32_C(   550661614), -INT32_C(   865060306) },
+      { -INT32_C(  1629266976), -INT32_C(   417885955),  INT32_C(  1842485372),  INT32_C(   758595893) },
+      { -INT32_C(   960772965), -INT32_C(  1328471527), -INT32_C(  1067732819), -INT32_C(   475734114) },
+      { -INT32_C(   960772965), -INT32_C(  1332138727),  INT32_C(  1383477935),  INT32_C(   602203540) } },
+    { { -INT32_C(   129593561), -INT32_C(  1207556935), -INT32_C(   403127981), -INT32_C(    82344384) },
+      UINT8_C( 11),
+      { -INT32_C(    54789090), -INT32_C(  1019224323),  INT32_C(    91860030),  INT32_C(    58426559) },
+      {  INT32_C(   630248400),  INT32_C(   933669649), -INT32_C(  1332634901), -INT32_C(  1234557243) },
+      { -INT32_C(   589930697), -INT32_C(  1155486040), -INT32_C(   403127981), -INT32_C(   109215035) },
+      {  INT32_C(    83718969),  INT32_C(  2067397188), -INT32_C(   403127981), -INT32_C(   127139073) } },
+    { { -INT32_C(  1040263309),  INT32_C(   380497448), -INT32_C(   248658824), -INT32_C(  1613204950) },
+      UINT8_C(180),
+      {  INT32_C(  2018951164), -INT32_C(  1393035752), -INT32_C(  1924296569), -INT32_C(  2081256522) },
+      { -INT32_C(  1914915410), -INT32_C(   789064654), -INT32_C(  1688518317),  INT32_C(   138061188) },
+      { -INT32_C(  1040263309),  INT32_C(   380497448),  INT32_C(  2019869819), -INT32_C(  1613204950) },
+      { -INT32_C(  1040263309),  INT32_C(   380497448),  INT32_C(  2086687999), -INT32_C(  1613204950) } },
+    { {  INT32_C(   152142981),  INT32_C(   933253827),  INT32_C(   396256955), -INT32_C(  1716386117) },
+      UINT8_C( 29),
+      { -INT32_C(  1430270412), -INT32_C(   452333333),  INT32_C(  1388680300),  INT32_C(  1033152470) },
+      { -INT32_C(   729592866),  INT32_C(    57494871), -INT32_C(  2030883493), -INT32_C(  1081066845) },
+      { -INT32_C(  1986867567),  INT32_C(   933253827),  INT32_C(   358572787), -INT32_C(  1541266375) },
+      { -INT32_C(  1548858703),  INT32_C(   933253827),  INT32_C(  1163653847), -INT32_C(  1540972179) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi32(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r;
+
+    r = simde_mm_mask_ternarylogic_epi32(src, test_vec[i].k, a, b, 0x78);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r0));
+    r = simde_mm_mask_ternarylogic_epi32(src, test_vec[i].k, a, b, 0x3c);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_mask_ternarylogic_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[2];
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t b[2];
+    const int64_t r0[2];
+    const int64_t r1[2];
+  } test_vec[] = {
+    { {  INT64_C(  175274852769010164),  INT64_C( 6073292890465219154) },
+      UINT8_C(139),
+      { -INT64_C( 1577670028239528659), -INT64_C( 3426474363761026803) },
+      { -INT64_C( 4701207603086772007), -INT64_C( 7837101971657071915) },
+      { -INT64_C( 6310027296394999299), -INT64_C( 4289486553646026153) },
+      { -INT64_C( 1696644319343309607), -INT64_C( 8918785271418377377) } },
+    { {  INT64_C( 5452906809544208348),  INT64_C( 7314440379830733489) },
+      UINT8_C(243),
+      {  INT64_C( 1218153665474508069), -INT64_C( 3032354281813067230) },
+      { -INT64_C( 8197670491851883634),  INT64_C( 2093031225018640251) },
+      {  INT64_C( 5442773684613996248),  INT64_C( 8109008265562859667) },
+      {  INT64_C( 6578454572019374841), -INT64_C( 5735064618977447789) } },
+    { { -INT64_C(  536702900361576699), -INT64_C( 7196160407660026665) },
+      UINT8_C(194),
+      { -INT64_C( 3705982378668144186),  INT64_C( 8472986300479298209) },
+      { -INT64_C( 6333711867607756194),  INT64_C( 6228620533244847931) },
+      { -INT64_C(  536702900361576699), -INT64_C( 4021122678958004490) },
+      { -INT64_C(  536702900361576699), -INT64_C( 1606656854486647178) } },
+    { { -INT64_C( 3848455138704668224), -INT64_C( 1288572127512974485) },
+      UINT8_C(133),
+      { -INT64_C( 5840861291044457064), -INT64_C( 7891926654488278275) },
+      { -INT64_C( 3101965331848592127), -INT64_C( 9089833915131547885) },
+      {  INT64_C( 5649370882971094208), -INT64_C( 1288572127512974485) },
+      {  INT64_C( 7234643483649932376), -INT64_C( 1288572127512974485) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i src = simde_x_mm_loadu_epi64(test_vec[i].src);
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i r;
+
+    r = simde_mm_mask_ternarylogic_epi64(src, test_vec[i].k, a, b, 0x78);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r0));
+    r = simde_mm_mask_ternarylogic_epi64(src, test_vec[i].k, a, b, 0x3c);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_ternarylogic_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t c[4];
+    const int32_t r0[4];
+    const int32_t r1[4];
+  } test_vec[] = {
+    { UINT8_C( 31),
+      {  INT32_C(  1814037647), -INT32_C(  1104357462), -INT32_C(  1022157493),  INT32_C(  1087759974) },
+      {  INT32_C(  1796809194),  INT32_C(  1599455891),  INT32_C(  1622113645),  INT32_C(  1549035594) },
+      {  INT32_C(  1100354592), -INT32_C(  1678595281),  INT32_C(  1936183298),  INT32_C(  2084232545) },
+      {  INT32_C(  1822822543),  INT32_C(  1049558662), -INT32_C(   799826615),  INT32_C(  1627353927) },
+      { -INT32_C(  1107895617),  INT32_C(   635337925), -INT32_C(  1133195303), -INT32_C(  1074840681) } },
+    { UINT8_C(139),
+      { -INT32_C(   971502584), -INT32_C(   221119245), -INT32_C(   893820147), -INT32_C(  1346882323) },
+      {  INT32_C(  1223947993), -INT32_C(  1739019344), -INT32_C(   167184547), -INT32_C(    92535653) },
+      {  INT32_C(   375833439),  INT32_C(   900082262),  INT32_C(    25975527),  INT32_C(   981553435) },
+      { -INT32_C(   803468018), -INT32_C(   680002379),  INT32_C(           0), -INT32_C(  1355192851) },
+      { -INT32_C(   243347593), -INT32_C(   948447571),  INT32_C(           0), -INT32_C(  1791234058) } },
+    { UINT8_C( 38),
+      { -INT32_C(  1632038097),  INT32_C(  2052471969),  INT32_C(  1876061204),  INT32_C(  1200889581) },
+      {  INT32_C(  1548914047),  INT32_C(   664806958),  INT32_C(   812038451),  INT32_C(  1255799296) },
+      { -INT32_C(  1697254344), -INT32_C(  2044030703), -INT32_C(  1307520199), -INT32_C(   309051197) },
+      {  INT32_C(           0), -INT32_C(    94589520), -INT32_C(   306041316),  INT32_C(           0) },
+      {  INT32_C(           0), -INT32_C(    58855952), -INT32_C(   573849619),  INT32_C(           0) } },
+    { UINT8_C(204),
+      { -INT32_C(   621824404),  INT32_C(   875712137), -INT32_C(   324299732), -INT32_C(  1591254265) },
+      {  INT32_C(   135818371),  INT32_C(  1470387722),  INT32_C(   591526103),  INT32_C(  1989219665) },
+      { -INT32_C(   634616440),  INT32_C(  2106496381), -INT32_C(  1562827503),  INT32_C(   425003327) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(  1815318828), -INT32_C(  1469879511) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(  1584837437), -INT32_C(  1199904072) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi32(test_vec[i].c);
+    simde__m128i r;
+
+    r = simde_mm_maskz_ternarylogic_epi32(test_vec[i].k, a, b, c, 0xd2);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r0));
+    r = simde_mm_maskz_ternarylogic_epi32(test_vec[i].k, a, b, c, 0x5b);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_maskz_ternarylogic_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[2];
+    const int64_t b[2];
+    const int64_t c[2];
+    const int64_t r0[2];
+    const int64_t r1[2];
+  } test_vec[] = {
+    { UINT8_C(235),
+      {  INT64_C( 8103729183598445590),  INT64_C( 7891008797218706450) },
+      {  INT64_C( 2503841997526291657), -INT64_C(  357071713033528782) },
+      { -INT64_C(  834154480241908754), -INT64_C(  243888507761427737) },
+      { -INT64_C( 6614052643918895312),  INT64_C( 7572519243701302487) },
+      { -INT64_C( 8279087009608241160), -INT64_C( 7962374841705664515) } },
+    { UINT8_C(171),
+      { -INT64_C( 4704243044614415818),  INT64_C(  337065482208482081) },
+      { -INT64_C( 4030550226372746830), -INT64_C( 9047527874031169681) },
+      {  INT64_C( 6462908636569129113), -INT64_C( 7478758803604863703) },
+      { -INT64_C( 5830068179431945665),  INT64_C( 2065880571541164833) },
+      { -INT64_C( 1778931903060635921), -INT64_C(  172434504112425320) } },
+    { UINT8_C(165),
+      {  INT64_C( 1936929426906343828), -INT64_C( 3837263423381772844) },
+      { -INT64_C( 6199204046364416038), -INT64_C( 2973150850960740834) },
+      {  INT64_C( 1792746182811942225), -INT64_C( 3279156534609928320) },
+      {  INT64_C(  783703477832511893),  INT64_C(                   0) },
+      {  INT64_C( 5045973572707128549),  INT64_C(                   0) } },
+    { UINT8_C(240),
+      { -INT64_C( 5913181942534774672),  INT64_C( 8693593222761336772) },
+      { -INT64_C( 4439931073278759898),  INT64_C( 4755802038334078259) },
+      {  INT64_C( 8721083074141222139), -INT64_C( 2671345197365374597) },
+      {  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C(                   0),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi64(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi64(test_vec[i].b);
+    simde__m128i c = simde_x_mm_loadu_epi64(test_vec[i].c);
+    simde__m128i r;
+
+    r = simde_mm_maskz_ternarylogic_epi64(test_vec[i].k, a, b, c, 0xd2);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r0));
+    r = simde_mm_maskz_ternarylogic_epi64(test_vec[i].k, a, b, c, 0x5b);
+    simde_test_x86_assert_equal_i64x2(r, simde_x_mm_loadu_epi64(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_ternarylogic_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[8];
+    const int32_t b[8];
+    const int32_t c[8];
+    const int32_t r0[8];
+    const int32_t r1[8];
+    const int32_t r2[8];
+    const int32_t r3[8];
+  } test_vec[] = {
+    { { -INT32_C(  1502436493),  INT32_C(  1994260171), -INT32_C(  1021870176), -INT32_C(   315107310),  INT32_C(  1521188248),  INT32_C(  1122336174),  INT32_C(  1449693660),  INT32_C(  1561590796) },
+      { -INT32_C(   661009326),  INT32_C(  1245487431), -INT32_C(   576809006), -INT32_C(  1243467666), -INT32_C(  1498700752),  INT32_C(  1700890323), -INT32_C(   259013923),  INT32_C(   342130967) },
+      { -INT32_C(   131423961), -INT32_C(   786171651),  INT32_C(  1448121274), -INT32_C(   567925128), -INT32_C(  1661770491),  INT32_C(  1810549023),  INT32_C(  1712902417), -INT32_C(   746545670) },
+      { -INT32_C(  2034119162), -INT32_C(   306010255),  INT32_C(  1222212552), -INT32_C(  2030842364),  INT32_C(  1626586285),  INT32_C(  1282290274), -INT32_C(  1056996848), -INT32_C(  1695031071) },
+      { -INT32_C(   669482922), -INT32_C(  1019305865), -INT32_C(   715745382), -INT32_C(  1222494614), -INT32_C(  2030361579),  INT32_C(  1768653971),  INT32_C(  1880670429), -INT32_C(  1769963018) },
+      { -INT32_C(   130375309),  INT32_C(  1379793103), -INT32_C(   686385230), -INT32_C(    47828870), -INT32_C(  1632934640),  INT32_C(  1675742623),  INT32_C(  1980289501),  INT32_C(  1426103582) },
+      {  INT32_C(  1607294600),  INT32_C(   752879364),  INT32_C(  1017768023),  INT32_C(   282716653), -INT32_C(   452683030), -INT32_C(  1256934799), -INT32_C(  1444450781),  INT32_C(   679437075) } },
+    { {  INT32_C(   657012015),  INT32_C(  1501399233), -INT32_C(  1081685709), -INT32_C(   496829476),  INT32_C(   548642491), -INT32_C(  1418208644),  INT32_C(   241872334), -INT32_C(   496729210) },
+      { -INT32_C(   285924886),  INT32_C(   494646485), -INT32_C(   875915919),  INT32_C(   645531208), -INT32_C(   233638964),  INT32_C(  1908692209), -INT32_C(   609982289),  INT32_C(   311795792) },
+      {  INT32_C(   237779703),  INT32_C(   899287608), -INT32_C(   591160627), -INT32_C(  1811676023),  INT32_C(  1128123085), -INT32_C(   549084021),  INT32_C(  2053279192),  INT32_C(   259897468) },
+      { -INT32_C(   940560846),  INT32_C(  1906062892), -INT32_C(  1466972529),  INT32_C(  1344076061), -INT32_C(  1852004422),  INT32_C(   100018694), -INT32_C(  1347663687), -INT32_C(     7562326) },
+      {  INT32_C(   774188026),  INT32_C(  1039893241), -INT32_C(   876375043),  INT32_C(   912655945),  INT32_C(  1662964428),  INT32_C(  1967420659),  INT32_C(  2048927902),  INT32_C(   253606008) },
+      {  INT32_C(   774713839),  INT32_C(   494635217), -INT32_C(   540894863), -INT32_C(  1503525176),  INT32_C(  1647565517), -INT32_C(    79309575),  INT32_C(  1516416462),  INT32_C(    41263188) },
+      { -INT32_C(   640236352), -INT32_C(   972655338),  INT32_C(  1618768962),  INT32_C(  1301937462), -INT32_C(   557816458),  INT32_C(  1354370949), -INT32_C(   711110111), -INT32_C(   258775085) } },
+    { {  INT32_C(   659251555),  INT32_C(  1452094735), -INT32_C(   711303648),  INT32_C(   575571358),  INT32_C(  1182047664),  INT32_C(   196792764),  INT32_C(  1720947879),  INT32_C(   869193110) },
+      {  INT32_C(  1978823274), -INT32_C(  1968578907),  INT32_C(  1520819395),  INT32_C(   337546182),  INT32_C(  1863700092), -INT32_C(   337763687), -INT32_C(  1034138090),  INT32_C(  1175455405) },
+      { -INT32_C(  1726149186), -INT32_C(   658818166),  INT32_C(  1492468585),  INT32_C(   842953798),  INT32_C(  1654632988),  INT32_C(   994305122),  INT32_C(   683610949),  INT32_C(   207810438) },
+      { -INT32_C(   878436681),  INT32_C(    77582368), -INT32_C(   674578038),  INT32_C(    74349086),  INT32_C(  1274995152), -INT32_C(   618195129), -INT32_C(  1938765324),  INT32_C(  2042379453) },
+      { -INT32_C(  1118409474), -INT32_C(  1967448443),  INT32_C(  1491426633),  INT32_C(   272560582),  INT32_C(  1721740860),  INT32_C(  1004217562),  INT32_C(  1245448006),  INT32_C(   236990084) },
+      {  INT32_C(   895181162), -INT32_C(   626442353),  INT32_C(  1488281185),  INT32_C(   840861126),  INT32_C(  1712692796),  INT32_C(   735764664),  INT32_C(  1654593031),  INT32_C(   105039750) },
+      {  INT32_C(  1387303433), -INT32_C(  1385903376), -INT32_C(  1355833129), -INT32_C(   573502855), -INT32_C(  1184807985), -INT32_C(   463193339), -INT32_C(  1790121288), -INT32_C(   174255495) } },
+    { {  INT32_C(  1734583342), -INT32_C(  1881132863),  INT32_C(   959050790),  INT32_C(   951938369),  INT32_C(  1634310712), -INT32_C(  1475853143),  INT32_C(  1085904589), -INT32_C(  1357533138) },
+      {  INT32_C(  2011217225), -INT32_C(   240741041), -INT32_C(  1897054220), -INT32_C(   599855861),  INT32_C(   928590179), -INT32_C(   655948461), -INT32_C(  1529879319), -INT32_C(  1714277217) },
+      { -INT32_C(   522240759), -INT32_C(  1218602841),  INT32_C(  1164127718),  INT32_C(  1467166991),  INT32_C(  1180054759), -INT32_C(   484487216),  INT32_C(   998394492),  INT32_C(  1916811427) },
+      { -INT32_C(   262396818), -INT32_C(   920961751), -INT32_C(   223877580), -INT32_C(  1276071611),  INT32_C(   275154876), -INT32_C(  1812984278), -INT32_C(   537642920),  INT32_C(  1149746194) },
+      { -INT32_C(   402866935), -INT32_C(  1312974745),  INT32_C(  1282096612),  INT32_C(  1602125071),  INT32_C(   660548839), -INT32_C(   887681199),  INT32_C(   999017721), -INT32_C(   649054065) },
+      {  INT32_C(  1742978313), -INT32_C(  1209757497),  INT32_C(   225000934),  INT32_C(  1547660555),  INT32_C(  1733900387), -INT32_C(   401652271),  INT32_C(   546031341), -INT32_C(  1152372561) },
+      {  INT32_C(   411065335),  INT32_C(  2013718302), -INT32_C(  1227568167), -INT32_C(   461208838), -INT32_C(  1632574629),  INT32_C(  1424470398), -INT32_C(   461999838),  INT32_C(   351258577) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi32(test_vec[i].c);
+    simde__m256i r;
+
+    r = simde_mm256_ternarylogic_epi32(a, b, c, 0x96);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r0));
+    r = simde_mm256_ternarylogic_epi32(a, b, c, 0xca);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r1));
+    r = simde_mm256_ternarylogic_epi32(a, b, c, 0xe8);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r2));
+    r = simde_mm256_ternarylogic_epi32(a, b, c, 0x1d);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r3));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_ternarylogic_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[4];
+    const int64_t b[4];
+    const int64_t c[4];
+    const int64_t r0[4];
+    const int64_t r1[4];
+    const int64_t r2[4];
+    const int64_t r3[4];
+  } test_vec[] = {
+    { { -INT64_C( 3525308488551589591),  INT64_C( 8393768241691726902),  INT64_C( 2981829853702603228),  INT64_C( 3434748938645795011) },
+      {  INT64_C( 2928282633472971282), -INT64_C( 6592940769557002296),  INT64_C( 3108533311777082139), -INT64_C( 6793533306057798963) },
+      {  INT64_C( 5698467123426269178),  INT64_C(  373698003990198991), -INT64_C( 7642969272562699949), -INT64_C( 9065048864557866914) },
+      { -INT64_C( 6294402004467049279), -INT64_C( 3039322089443333839), -INT64_C( 7517463154871960684),  INT64_C(  873789121615256144) },
+      {  INT64_C(  578450499923220178),  INT64_C( 2667014216029777609), -INT64_C( 4778403245108907749), -INT64_C( 6793443152306257699) },
+      {  INT64_C( 5697921636407350074),  INT64_C( 2606923782784128718),  INT64_C( 2982428523894473051), -INT64_C( 6648811176792563505) },
+      { -INT64_C( 5699046574509954537), -INT64_C( 2679262578917489672),  INT64_C( 4760982723305295527), -INT64_C( 2570147420662522068) } },
+    { {  INT64_C(  538684251039537142), -INT64_C( 7047326795891384981),  INT64_C( 5924640717339877539),  INT64_C( 4525952061803387266) },
+      {  INT64_C( 7459906735949353034),  INT64_C( 9127570443934459239), -INT64_C( 2111677161286310946),  INT64_C( 4826556851239320881) },
+      {  INT64_C( 2897181628552506328),  INT64_C( 6064358206184230508), -INT64_C( 2419434752165402576), -INT64_C( 1906079662969478521) },
+      {  INT64_C( 5245559459692538980), -INT64_C( 5426392510336715168),  INT64_C( 7990843079945923405), -INT64_C( 7370131801706101196) },
+      {  INT64_C( 3388071585510258762),  INT64_C( 6785416883669780327), -INT64_C( 3569963693746067310), -INT64_C( 4338268374474949883) },
+      {  INT64_C( 2825106577924428762),  INT64_C( 6785497182282009967), -INT64_C( 3298657138028879694),  INT64_C( 7408280525889665411) },
+      { -INT64_C( 1094614892468435923), -INT64_C( 2171524040685473644), -INT64_C( 6808493101034465443),  INT64_C( 6354744657236468857) } },
+    { { -INT64_C( 9167902196916977058),  INT64_C( 1926775272026376335), -INT64_C( 4710939492786316344), -INT64_C( 7495664827117727599) },
+      { -INT64_C( 6531362028000094025), -INT64_C( 4646871440623929766), -INT64_C( 6955816157667189774),  INT64_C( 2488103044086046676) },
+      { -INT64_C( 3233678467462759075), -INT64_C( 7208885299440485300),  INT64_C( 1779323670830164956),  INT64_C( 5151491596521884148) },
+      { -INT64_C(  684182377934313548),  INT64_C( 4524813531563950745),  INT64_C( 4132604617194826726), -INT64_C( 1008720190742214991) },
+      { -INT64_C( 3216772351038030569), -INT64_C( 7223519799203859382), -INT64_C( 7046044282224755756),  INT64_C( 4794018964514068980) },
+      { -INT64_C( 9124380157222758305), -INT64_C( 7226897499800994738), -INT64_C( 7010018298409083944),  INT64_C(  576325002116209108) },
+      {  INT64_C( 3295198389370804897), -INT64_C( 1942255416245454863),  INT64_C( 7019029904304587827), -INT64_C( 5186535819502473393) } },
+    { {  INT64_C(  624764636021942280), -INT64_C( 7940945650628503072), -INT64_C( 2799118628665149430), -INT64_C(  676932993472410062) },
+      {  INT64_C( 3526663056072428839), -INT64_C( 7981750746849306168),  INT64_C( 5013151494808923150), -INT64_C( 7130539974176372435) },
+      {  INT64_C( 5609889648040415567),  INT64_C(  378764551073183451),  INT64_C( 2824702006788356859),  INT64_C( 3489930495657692433) },
+      {  INT64_C( 8467032919720309856),  INT64_C(  411696353236121331), -INT64_C( 4934087793841131777),  INT64_C( 6628893897014741518) },
+      {  INT64_C( 5039907081580665159), -INT64_C( 7707422191860400165),  INT64_C( 7427099557106805499), -INT64_C( 7750772694550935263) },
+      {  INT64_C(  647142210207238415), -INT64_C( 7977814099820373560),  INT64_C( 4986411333386631178), -INT64_C( 5473218184502915791) },
+      { -INT64_C( 5596668807794350153),  INT64_C( 7689694044062302252), -INT64_C( 7143581136994581244),  INT64_C( 5444982483574272975) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi64(test_vec[i].c);
+    simde__m256i r;
+
+    r = simde_mm256_ternarylogic_epi64(a, b, c, 0x96);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r0));
+    r = simde_mm256_ternarylogic_epi64(a, b, c, 0xca);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r1));
+    r = simde_mm256_ternarylogic_epi64(a, b, c, 0xe8);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r2));
+    r = simde_mm256_ternarylogic_epi64(a, b, c, 0x1d);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r3));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_ternarylogic_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[8];
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t b[8];
+    const int32_t r0[8];
+    const int32_t r1[8];
+  } test_vec[] = {
+    { {  INT32_C(   868620414), -INT32_C(   471945431),  INT32_C(  2026596750), -INT32_C(  1019005494), -INT32_C(   850804206), -INT32_C(  1593364024),  INT32_C(   864556544), -INT32_C(   872513247) },
+      UINT8_C( 76),
+      { -INT32_C(   169697366), -INT32_C(  1332638602),  INT32_C(   391104163), -INT32_C(   948184359),  INT32_C(  2101984886),  INT32_C(   169405221),  INT32_C(  2034078802),  INT32_C(  2043950777) },
+      { -INT32_C(  1725751312), -INT32_C(   554309560), -INT32_C(  1882417911), -INT32_C(  2092989376), -INT32_C(   963150900),  INT32_C(  1254955271), -INT32_C(   771475848),  INT32_C(   817312043) },
+      {  INT32_C(   868620414), -INT32_C(   471945431),  INT32_C(  2139614607),  INT32_C(  1081652618), -INT32_C(   850804206), -INT32_C(  1593364024),  INT32_C(  1670120016), -INT32_C(   872513247) },
+      {  INT32_C(   868620414), -INT32_C(   471945431),  INT32_C(  1870966573),  INT32_C(    70840083), -INT32_C(   850804206), -INT32_C(  1593364024),  INT32_C(  1253409362), -INT32_C(   872513247) } },
+    { {  INT32_C(  1857902498),  INT32_C(  1436168232),  INT32_C(  1754893471), -INT32_C(   674205574), -INT32_C(  1773400972), -INT32_C(   105624893),  INT32_C(   686521314), -INT32_C(   676538988) },
+      UINT8_C(229),
+      {  INT32_C(   659098407), -INT32_C(   479097727),  INT32_C(  1585375652), -INT32_C(   498826350),  INT32_C(    44917557), -INT32_C(  1632019072),  INT32_C(  1793822395),  INT32_C(   677790270) },
+      { -INT32_C(  1589547195),  INT32_C(  1257328616), -INT32_C(   612090304),  INT32_C(  2056880022), -INT32_C(   652401698), -INT32_C(  1766221312), -INT32_C(  1917697849),  INT32_C(  1737778766) },
+      {  INT32_C(  1341938855),  INT32_C(  1436168232),  INT32_C(   849192095), -INT32_C(   674205574), -INT32_C(  1773400972),  INT32_C(  1863144131),  INT32_C(   541686625), -INT32_C(   139946086) },
+      {  INT32_C(  1240751237),  INT32_C(  1436168232),  INT32_C(   921134395), -INT32_C(   674205574), -INT32_C(  1773400972),  INT32_C(  1728911171),  INT32_C(  1107359065), -INT32_C(     3500118) } },
+    { { -INT32_C(    43049695),  INT32_C(    27972004),  INT32_C(   326072189),  INT32_C(   808752501), -INT32_C(  2019888166),  INT32_C(  1125613458),  INT32_C(   260721291), -INT32_C(   780856041) },
+      UINT8_C( 21),
+      { -INT32_C(   863939108),  INT32_C(   936957199), -INT32_C(  1124902115),  INT32_C(   602203919),  INT32_C(   738204387), -INT32_C(  1949658136), -INT32_C(   137038464),  INT32_C(  1307458154) },
+      {  INT32_C(   526343005), -INT32_C(   578793759),  INT32_C(   113727988),  INT32_C(  1740650074),  INT32_C(  1937337695),  INT32_C(  2092630359), -INT32_C(   928649210), -INT32_C(   130154257) },
+      { -INT32_C(   244429699),  INT32_C(    27972004),  INT32_C(   397160041),  INT32_C(   808752501), -INT32_C(  1483015271),  INT32_C(  1125613458),  INT32_C(   260721291), -INT32_C(   780856041) },
+      {  INT32_C(   837699837),  INT32_C(    27972004), -INT32_C(  1348719520),  INT32_C(   808752501), -INT32_C(  1415911111),  INT32_C(  1125613458),  INT32_C(   260721291), -INT32_C(   780856041) } },
+    { {  INT32_C(   767449604),  INT32_C(   787810081), -INT32_C(  1109893040), -INT32_C(  1077411222),  INT32_C(   136586846), -INT32_C(   652349912), -INT32_C(   944594980), -INT32_C(  1623985552) },
+      UINT8_C( 92),
+      { -INT32_C(  1637039867), -INT32_C(   911180057),  INT32_C(    83486328), -INT32_C(  1718425188), -INT32_C(  1000186356),  INT32_C(   138048743), -INT32_C(   594074738),  INT32_C(   186996595) },
+      { -INT32_C(   546712498), -INT32_C(  1515567602), -INT32_C(  2079314412),  INT32_C(  1986151081), -INT32_C(  1955736020), -INT32_C(   561683974), -INT32_C(  1382797115), -INT32_C(  1377903164) },
+      {  INT32_C(   767449604),  INT32_C(   787810081), -INT32_C(  1178057152), -INT32_C(  1345699102), -INT32_C(  2008780718), -INT32_C(   652349912),  INT32_C(  1260830552), -INT32_C(  1623985552) },
+      {  INT32_C(   767449604),  INT32_C(   787810081), -INT32_C(  1188985304),  INT32_C(   643492854), -INT32_C(   867796910), -INT32_C(   652349912),  INT32_C(   455457874), -INT32_C(  1623985552) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi32(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i r;
+
+    r = simde_mm256_mask_ternarylogic_epi32(src, test_vec[i].k, a, b, 0x78);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r0));
+    r = simde_mm256_mask_ternarylogic_epi32(src, test_vec[i].k, a, b, 0x3c);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_mask_ternarylogic_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[4];
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t b[4];
+    const int64_t r0[4];
+    const int64_t r1[4];
+  } test_vec[] = {
+    { {  INT64_C( 8634616823246963477), -INT64_C( 6877192678691755231),  INT64_C( 6188684228889968897),  INT64_C(  116610714995164983) },
+      UINT8_C( 89),
+      {  INT64_C( 6644584936770387512), -INT64_C( 4029886215598836308), -INT64_C( 6222177286994960577),  INT64_C( 8654322593120465286) },
+      {  INT64_C(  323955382621583069),  INT64_C( 6198284999372597306), -INT64_C( 4669912113523467664),  INT64_C( 3559531428928869826) },
+      {  INT64_C( 8350263874848781581), -INT64_C( 6877192678691755231),  INT64_C( 6188684228889968897),  INT64_C( 3575326328667150005) },
+      {  INT64_C( 3162121271913970989), -INT64_C( 6877192678691755231),  INT64_C( 6188684228889968897),  INT64_C( 8756154741590832817) } },
+    { { -INT64_C( 8643391544868884980),  INT64_C(  310378544218278753),  INT64_C( 1986343952946237938),  INT64_C(  906746544712007441) },
+      UINT8_C(255),
+      { -INT64_C( 7908878648961725528),  INT64_C( 1698645817835381415),  INT64_C( 7270786022034751661), -INT64_C( 7279726296420436424) },
+      { -INT64_C( 7536369870033024968), -INT64_C( 4185848369227028008),  INT64_C( 4085721085090490474), -INT64_C( 4497728368900250736) },
+      {  INT64_C( 1883777532185585188),  INT64_C(  130163146433997793),  INT64_C( 4266013036321133018), -INT64_C( 8357138648434533119) },
+      {  INT64_C( 1887718437473396132),  INT64_C( 1431127612332140998),  INT64_C( 9185069520461156703), -INT64_C( 7607601571717379799) } },
+    { { -INT64_C( 8148194029409343675), -INT64_C( 3725596080770138381),  INT64_C( 7947195803577209503), -INT64_C(  944333926890442644) },
+      UINT8_C( 63),
+      {  INT64_C( 2316725806390468618),  INT64_C( 7916771895786266056), -INT64_C( 2248482761768361095), -INT64_C( 4893674622757990617) },
+      {  INT64_C( 2110394677252276997),  INT64_C( 3689436508754467621), -INT64_C( 3913524146795915949), -INT64_C( 7756707726730666578) },
+      { -INT64_C( 8148299857380333755), -INT64_C( 1342631195544295437), -INT64_C( 5851771309999926322),  INT64_C( 7419448392267922762) },
+      { -INT64_C( 5850908829843552433), -INT64_C( 6804376075507244229), -INT64_C( 8178021607130467866),  INT64_C( 5688927657638690635) } },
+    { {  INT64_C( 3973850977349258943), -INT64_C( 8225701341483049693),  INT64_C(  239713889138121236),  INT64_C(  513216740698391929) },
+      UINT8_C( 25),
+      {  INT64_C( 4839069483437543625),  INT64_C( 7618065106098914053), -INT64_C( 1954778610429635303), -INT64_C( 8131509038654085343) },
+      { -INT64_C( 2513633051707242703), -INT64_C( 8596388947611111412), -INT64_C( 7881489204731195199), -INT64_C(  904213726372732663) },
+      {  INT64_C( 8511860909868043966), -INT64_C( 8225701341483049693),  INT64_C(  239713889138121236), -INT64_C( 8918149945109142408) },
+      {  INT64_C( 8359279482229988982), -INT64_C( 8225701341483049693),  INT64_C(  239713889138121236), -INT64_C( 8631047029529140648) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i src = simde_x_mm256_loadu_epi64(test_vec[i].src);
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i r;
+
+    r = simde_mm256_mask_ternarylogic_epi64(src, test_vec[i].k, a, b, 0x78);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r0));
+    r = simde_mm256_mask_ternarylogic_epi64(src, test_vec[i].k, a, b, 0x3c);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_ternarylogic_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int32_t a[8];
+    const int32_t b[8];
+    const int32_t c[8];
+    const int32_t r0[8];
+    const int32_t r1[8];
+  } test_vec[] = {
+    { UINT8_C(239),
+      {  INT32_C(   831434702), -INT32_C(   423120691),  INT32_C(   468747019), -INT32_C(   606326633), -INT32_C(   469233556),  INT32_C(   736162591),  INT32_C(  1192978757),  INT32_C(  1253676721) },
+      {  INT32_C(  1581550931),  INT32_C(  1933418072), -INT32_C(   232630647), -INT32_C(   910903513), -INT32_C(   766205978), -INT32_C(  1716724979), -INT32_C(  1868710358),  INT32_C(   479560383) },
+      { -INT32_C(  1594510772), -INT32_C(   436696269), -INT32_C(  1594508790),  INT32_C(  1662868827),  INT32_C(  1879589511),  INT32_C(  1804120504), -INT32_C(   728368461),  INT32_C(  1234470765) },
+      { -INT32_C(  1858101822),  INT32_C(  1644671470),  INT32_C(   455420681), -INT32_C(   103450417),  INT32_C(           0),  INT32_C(  1239471023),  INT32_C(    52111828),  INT32_C(   196711409) },
+      { -INT32_C(  1854186078),  INT32_C(   188709886), -INT32_C(  1089652363), -INT32_C(  1128043060),  INT32_C(           0),  INT32_C(  1148929767), -INT32_C(  1141992458), -INT32_C(  1552975396) } },
+    { UINT8_C(213),
+      {  INT32_C(  1142483354), -INT32_C(  2061680728),  INT32_C(  1312339418), -INT32_C(   871486942), -INT32_C(  1915295375),  INT32_C(  1139685396),  INT32_C(  2048063797),  INT32_C(   422793206) },
+      { -INT32_C(    78026864),  INT32_C(  1393895918),  INT32_C(   752079605), -INT32_C(   837380634),  INT32_C(  1050090863), -INT32_C(   482636676),  INT32_C(   909120588), -INT32_C(  1707284526) },
+      {  INT32_C(   128365947), -INT32_C(  1750318415),  INT32_C(   336465424), -INT32_C(  2113239168),  INT32_C(  1927922825), -INT32_C(   589082692),  INT32_C(  1536610627), -INT32_C(  1335696037) },
+      {  INT32_C(  1086224881),  INT32_C(           0),  INT32_C(  1580513754),  INT32_C(           0), -INT32_C(   843175439),  INT32_C(           0),  INT32_C(   865351734),  INT32_C(   963727359) },
+      {  INT32_C(  1136549093),  INT32_C(           0), -INT32_C(   617169974),  INT32_C(           0), -INT32_C(    12636168),  INT32_C(           0), -INT32_C(  1580389642), -INT32_C(   305022291) } },
+    { UINT8_C(128),
+      {  INT32_C(   669791935), -INT32_C(   470618249),  INT32_C(   901273690),  INT32_C(   194298635),  INT32_C(  1210474711),  INT32_C(  1858807266),  INT32_C(  2070667266),  INT32_C(   404669743) },
+      {  INT32_C(  1267257179),  INT32_C(  1446250227),  INT32_C(    32428980),  INT32_C(  1349411533),  INT32_C(   634706908),  INT32_C(  1101300029), -INT32_C(  1975900511), -INT32_C(  1697430737) },
+      { -INT32_C(   821339361), -INT32_C(  1375048070),  INT32_C(   657059059),  INT32_C(   280202981), -INT32_C(   665559016), -INT32_C(   624317813),  INT32_C(  1457506503),  INT32_C(  1886937094) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  2016863535) },
+      {  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1835449849) } },
+    { UINT8_C( 89),
+      { -INT32_C(  1782927059),  INT32_C(  2093331970),  INT32_C(  1744077264), -INT32_C(  1226500301), -INT32_C(   813828397),  INT32_C(    83742822),  INT32_C(   718610834),  INT32_C(   647613986) },
+      {  INT32_C(   660059676), -INT32_C(  1678062769),  INT32_C(  1654127666), -INT32_C(    56234402),  INT32_C(  2137252019),  INT32_C(   423069855),  INT32_C(  1581301521), -INT32_C(   463201182) },
+      {  INT32_C(   595910925),  INT32_C(  2036180703),  INT32_C(  1192623265), -INT32_C(   410498309), -INT32_C(   175055954), -INT32_C(  1257768928), -INT32_C(  1517672850), -INT32_C(   858947708) },
+      { -INT32_C(  1791299540),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1242753134),  INT32_C(  1340992991),  INT32_C(           0), -INT32_C(  1956699652),  INT32_C(           0) },
+      { -INT32_C(    29468446),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1367301576),  INT32_C(   988622205),  INT32_C(           0), -INT32_C(  1887483908),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi32(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi32(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi32(test_vec[i].c);
+    simde__m256i r;
+
+    r = simde_mm256_maskz_ternarylogic_epi32(test_vec[i].k, a, b, c, 0xd2);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r0));
+    r = simde_mm256_maskz_ternarylogic_epi32(test_vec[i].k, a, b, c, 0x5b);
+    simde_test_x86_assert_equal_i32x8(r, simde_x_mm256_loadu_epi32(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_maskz_ternarylogic_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[4];
+    const int64_t b[4];
+    const int64_t c[4];
+    const int64_t r0[4];
+    const int64_t r1[4];
+  } test_vec[] = {
+    { UINT8_C(229),
+      {  INT64_C( 1786102470837766224),  INT64_C( 4153105603298172974), -INT64_C( 4348099998264824165),  INT64_C( 5365737570654465604) },
+      {  INT64_C( 8561111013239250261),  INT64_C( 1115568341825441686), -INT64_C( 3026378824818498409), -INT64_C( 7149167768662474983) },
+      { -INT64_C( 2879950674031871717), -INT64_C( 5616349960367066355), -INT64_C( 7639122718418953567),  INT64_C( 2765318464886472586) },
+      { -INT64_C( 8013642341202319270),  INT64_C(                   0), -INT64_C( 4443874060278139717),  INT64_C(                   0) },
+      { -INT64_C( 4471547878982716437),  INT64_C(                   0),  INT64_C( 9103914269960566138),  INT64_C(                   0) } },
+    { UINT8_C(111),
+      {  INT64_C( 3401231487188951343),  INT64_C( 1944800031151015281),  INT64_C( 3168412487668668868), -INT64_C( 7976632438975290085) },
+      { -INT64_C( 9192833353961027339),  INT64_C( 7836195227763838619),  INT64_C( 8721582663240813034), -INT64_C( 1392938309307702541) },
+      {  INT64_C( 7818595895371031014), -INT64_C( 1357959842061775334),  INT64_C(  781372918534292944),  INT64_C( 5699073579461060582) },
+      {  INT64_C( 4878131833661145133), -INT64_C( 7206500585134307983),  INT64_C( 2967521239959559636), -INT64_C( 7901166362648371169) },
+      {  INT64_C( 6031060691358553801), -INT64_C(  586875442451481745), -INT64_C( 6543861266560057835), -INT64_C( 2424359132559402243) } },
+    { UINT8_C(106),
+      { -INT64_C( 2564794982272834339),  INT64_C( 6512902667257211261),  INT64_C( 4369041783006542862),  INT64_C( 7542949143520121308) },
+      {  INT64_C( 7821474588232851733),  INT64_C( 5917246801429700558), -INT64_C(  279083677190944378), -INT64_C( 3119466709884603205) },
+      { -INT64_C( 4408061041714911507),  INT64_C( 8569175950918717219),  INT64_C(  494244717331044750), -INT64_C( 7684979484760538188) },
+      {  INT64_C(                   0),  INT64_C( 9116392132500482396),  INT64_C(                   0),  INT64_C( 7630753805786583768) },
+      {  INT64_C(                   0), -INT64_C( 5942025429320997282),  INT64_C(                   0), -INT64_C(    2665516901229976) } },
+    { UINT8_C(134),
+      {  INT64_C( 7885006603408122621),  INT64_C( 8484370344193417863),  INT64_C( 8838660808810031839),  INT64_C(  216489162219244944) },
+      {  INT64_C( 4623029019084790752),  INT64_C(  635337344103746584),  INT64_C( 4998720167689699936),  INT64_C( 7190190005401101127) },
+      {  INT64_C( 3805279762193934328), -INT64_C( 8280587909115670956),  INT64_C( 6180766933642610184),  INT64_C(  431487605376880445) },
+      {  INT64_C(                   0), -INT64_C( 1100327563306868541),  INT64_C( 7649717358311763671),  INT64_C(                   0) },
+      {  INT64_C(                   0), -INT64_C(  383935375251866125), -INT64_C( 5805203713761575465),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256i a = simde_x_mm256_loadu_epi64(test_vec[i].a);
+    simde__m256i b = simde_x_mm256_loadu_epi64(test_vec[i].b);
+    simde__m256i c = simde_x_mm256_loadu_epi64(test_vec[i].c);
+    simde__m256i r;
+
+    r = simde_mm256_maskz_ternarylogic_epi64(test_vec[i].k, a, b, c, 0xd2);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r0));
+    r = simde_mm256_maskz_ternarylogic_epi64(test_vec[i].k, a, b, c, 0x5b);
+    simde_test_x86_assert_equal_i64x4(r, simde_x_mm256_loadu_epi64(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_ternarylogic_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[16];
+    const int32_t b[16];
+    const int32_t c[16];
+    const int32_t r0[16];
+    const int32_t r1[16];
+    const int32_t r2[16];
+    const int32_t r3[16];
+  } test_vec[] = {
+    { {  INT32_C(   844660292), -INT32_C(  1717916238),  INT32_C(   979695488),  INT32_C(  1650239394), -INT32_C(  1716495842), -INT32_C(   541405746), -INT32_C(   514358214),  INT32_C(   703079434),
+         INT32_C(  2005803765), -INT32_C(   588573339),  INT32_C(  1443412803),  INT32_C(  1688986720), -INT32_C(   488527844),  INT32_C(  1775646361), -INT32_C(  1840458453),  INT32_C(  1291421873) },
+      {  INT32_C(   666118700), -INT32_C(   910795527),  INT32_C(  1362194328),  INT32_C(   415232225), -INT32_C(   568298430), -INT32_C(  1346044593), -INT32_C(   133124650),  INT32_C(   744268579),
+         INT32_C(   199412726),  INT32_C(  1989664919), -INT32_C(   944856622),  INT32_C(  1864360010),  INT32_C(  1294671171),  INT32_C(   826656449),  INT32_C(   390845137), -INT32_C(  1494008979) },
+      { -INT32_C(  1438501147), -INT32_C(  1364354927), -INT32_C(   697534253), -INT32_C(  1914432851),  INT32_C(  1774476852),  INT32_C(   763513077), -INT32_C(  1701088429),  INT32_C(  1273637557),
+         INT32_C(  1664743063),  INT32_C(   170019975), -INT32_C(  1570980972), -INT32_C(  1666195831),  INT32_C(   321781489), -INT32_C(  2001127567),  INT32_C(   510703415), -INT32_C(  1697168486) },
+      { -INT32_C(  1079090547), -INT32_C(    25073190), -INT32_C(  1120280373), -INT32_C(   150518290),  INT32_C(   777285736),  INT32_C(  1576826996), -INT32_C(  2082710849),  INT32_C(  1314827676),
+         INT32_C(   525672340), -INT32_C(  1604404875),  INT32_C(   872063237), -INT32_C(  1759782237), -INT32_C(  1125692498), -INT32_C(   802502871), -INT32_C(  1686654771),  INT32_C(  1893593158) },
+      { -INT32_C(  1441650011), -INT32_C(  1346954063), -INT32_C(   735547437), -INT32_C(  1917013843), -INT32_C(   127642590), -INT32_C(  1350513281), -INT32_C(    90638509),  INT32_C(  1783245495),
+         INT32_C(    62117622),  INT32_C(  1451444359), -INT32_C(   430136874), -INT32_C(    66061623),  INT32_C(  1361927905), -INT32_C(  1586690079),  INT32_C(   511242773), -INT32_C(  1762178261) },
+      {  INT32_C(   575684196), -INT32_C(  1983996751),  INT32_C(  1382317968),  INT32_C(   150778529), -INT32_C(   643801578), -INT32_C(  1350382129), -INT32_C(   132930222),  INT32_C(   703078947),
+         INT32_C(  1672143607),  INT32_C(  1587758215), -INT32_C(   972244014),  INT32_C(  1823466568),  INT32_C(  1126808657),  INT32_C(   701839057),  INT32_C(   373872435), -INT32_C(  1896674375) },
+      {  INT32_C(  1437450554),  INT32_C(  1348760399),  INT32_C(  1771276348),  INT32_C(  2057526611),  INT32_C(  1176217033),  INT32_C(  1887252993),  INT32_C(   493103596), -INT32_C(  1810507927),
+        -INT32_C(  1671116534), -INT32_C(  1554189318), -INT32_C(  1717091143),  INT32_C(   190054718), -INT32_C(  1378216625),  INT32_C(  1443088462), -INT32_C(   444134696), -INT32_C(   485836980) } },
+    { {  INT32_C(   199133170),  INT32_C(   589643559),  INT32_C(  1588267283),  INT32_C(  1568483748),  INT32_C(   408077163), -INT32_C(  1981772898),  INT32_C(   169108560), -INT32_C(  1617544622),
+        -INT32_C(  1474891310),  INT32_C(   619284699),  INT32_C(  1665222070), -INT32_C(  1873242843),  INT32_C(   766426889),  INT32_C(  1954328925),  INT32_C(  1025110536), -INT32_C(  2132810585) },
+      { -INT32_C(  1513316033), -INT32_C(  1530548102),  INT32_C(  1531275109),  INT32_C(  1501013709),  INT32_C(  1082627745), -INT32_C(   124287990),  INT32_C(   523442439), -INT32_C(  2119916287),
+         INT32_C(  1110226870),  INT32_C(   506888688), -INT32_C(  1494010392), -INT32_C(  1176088921),  INT32_C(   532204452), -INT32_C(   773422277), -INT32_C(  1513832020), -INT32_C(  1665547158) },
+      {  INT32_C(   574131511),  INT32_C(   523363926), -INT32_C(   711718695), -INT32_C(  1631373380),  INT32_C(  2120764139), -INT32_C(   501339560), -INT32_C(  1360789847),  INT32_C(  1699606723),
+         INT32_C(  1640002787), -INT32_C(  1432022687),  INT32_C(  1641322835),  INT32_C(     9923855),  INT32_C(  1627354504), -INT32_C(  1287947276), -INT32_C(  1317968392),  INT32_C(   173808202) },
+      { -INT32_C(  1943360518), -INT32_C(  1731106549), -INT32_C(   797284689), -INT32_C(  1698055979),  INT32_C(   649928481), -INT32_C(  1821825588), -INT32_C(  1144749058),  INT32_C(  2071949200),
+        -INT32_C(  1946537337), -INT32_C(  1871046582), -INT32_C(  1536759539),  INT32_C(   690599565),  INT32_C(  1391001893),  INT32_C(   379668882),  INT32_C(   699160156),  INT32_C(   372914823) },
+      {  INT32_C(   569149751),  INT32_C(  1008070770), -INT32_C(   619380279), -INT32_C(   604555620),  INT32_C(  1714064033), -INT32_C(   358703030), -INT32_C(  1359766871), -INT32_C(   506601343),
+         INT32_C(  1103410611), -INT32_C(  1910205968),  INT32_C(   584424929), -INT32_C(  1865978833),  INT32_C(  1308216192), -INT32_C(   748172359), -INT32_C(  1520384520), -INT32_C(  1969627542) },
+      {  INT32_C(   601654583),  INT32_C(   656782966),  INT32_C(  1602554193),  INT32_C(  1568090028),  INT32_C(  1480770283), -INT32_C(   392787430),  INT32_C(   238255105), -INT32_C(  2054901693),
+         INT32_C(  1610937842),  INT32_C(   782598641),  INT32_C(  1674647026), -INT32_C(  1865003737),  INT32_C(   767491976), -INT32_C(   243354755), -INT32_C(  1252925016), -INT32_C(  1998732182) },
+      { -INT32_C(    66882867), -INT32_C(   993359399),  INT32_C(   560920166),  INT32_C(   537579083), -INT32_C(  1047186028),  INT32_C(  1970754981),  INT32_C(  1429150039),  INT32_C(   439521085),
+        -INT32_C(   566555092),  INT32_C(  1532915502), -INT32_C(  1665502644),  INT32_C(  1873730258), -INT32_C(  1844428553), -INT32_C(  1920858590), -INT32_C(   892462169),  INT32_C(  2099388893) } },
+    { {  INT32_C(    52395793), -INT32_C(    98899587), -INT32_C(    44612739), -INT32_C(  1397784008),  INT32_C(  1279040861),  INT32_C(   488066034),  INT32_C(  1037494539),  INT32_C(   654652161),
+        -INT32_C(   663726917),  INT32_C(    14263447), -INT32_C(  1962425804), -INT32_C(  1090661860), -INT32_C(   417773295), -INT32_C(   821736468),  INT32_C(  1150370810), -INT32_C(   544731098) },
+      { -INT32_C(  1469649510), -INT32_C(  1870455967), -INT32_C(   222869635),  INT32_C(  1913016027), -INT32_C(   961869864), -INT32_C(  1160151771),  INT32_C(   559399641),  INT32_C(  1785772309),
+         INT32_C(   945037408), -INT32_C(  1949037568),  INT32_C(   489671168),  INT32_C(    38197601), -INT32_C(    62100448), -INT32_C(  1257168549),  INT32_C(     7214112), -INT32_C(  1386483666) },
+      { -INT32_C(   621543936), -INT32_C(   169463071),  INT32_C(   842271342), -INT32_C(   420249030),  INT32_C(  1221678435),  INT32_C(   227981260), -INT32_C(   348784481), -INT32_C(   359310964),
+         INT32_C(  1096528547),  INT32_C(  1213081749),  INT32_C(   294951870), -INT32_C(   818288385),  INT32_C(  1153257956),  INT32_C(   439369740), -INT32_C(  1380044708), -INT32_C(   404472262) },
+      {  INT32_C(  1904897163), -INT32_C(  1619017475),  INT32_C(  1037307502),  INT32_C(   945442521), -INT32_C(  1035546650), -INT32_C(  1437040357), -INT32_C(   139144371), -INT32_C(  1478437992),
+        -INT32_C(  1585461640), -INT32_C(  1018986494), -INT32_C(  2017684598),  INT32_C(  1937957762),  INT32_C(  1609069781),  INT32_C(  1612982971), -INT32_C(   381589626), -INT32_C(  1791500750) },
+      { -INT32_C(   655954672), -INT32_C(  1780081695), -INT32_C(   231257217),  INT32_C(  1649803802),  INT32_C(  1156138362),  INT32_C(   412220716), -INT32_C(   478687075), -INT32_C(   359630451),
+         INT32_C(   425435680),  INT32_C(  1221987328),  INT32_C(   429382538),  INT32_C(  1128593635), -INT32_C(   458467100), -INT32_C(  1791950520), -INT32_C(  1456590812), -INT32_C(  1385415106) },
+      { -INT32_C(  1971847408), -INT32_C(   259900575), -INT32_C(   231259267), -INT32_C(   425229766),  INT32_C(  1287198041),  INT32_C(   496467940),  INT32_C(   693627035),  INT32_C(  1779775749),
+         INT32_C(  1481650339),  INT32_C(   148647061),  INT32_C(   419940916), -INT32_C(  1904355203), -INT32_C(   467842784), -INT32_C(  1626259124),  INT32_C(    79564920), -INT32_C(   272093138) },
+      { -INT32_C(  1385660177),  INT32_C(   177853982),  INT32_C(   266908800),  INT32_C(  1527283143), -INT32_C(  1282954620), -INT32_C(   488098793),  INT32_C(   344524784),  INT32_C(  1568312950),
+        -INT32_C(  1499173540), -INT32_C(  1088038038), -INT32_C(   160945087),  INT32_C(   813829985),  INT32_C(   457614907),  INT32_C(  1893646003),  INT32_C(  1383063427),  INT32_C(   810803657) } },
+    { {  INT32_C(  1577717334),  INT32_C(   655433666),  INT32_C(   152277183),  INT32_C(   208439625), -INT32_C(    80625560),  INT32_C(  1236047780),  INT32_C(   663528319),  INT32_C(    33582261),
+         INT32_C(  2024897534), -INT32_C(  1455222318), -INT32_C(  1729762304), -INT32_C(  1447546681), -INT32_C(  2035723792),  INT32_C(   568775965),  INT32_C(   641915653), -INT32_C(  1560177640) },
+      {  INT32_C(   911649196), -INT32_C(  1781915050), -INT32_C(   698959884), -INT32_C(   110784321), -INT32_C(   604972140), -INT32_C(  1579378290), -INT32_C(  1241459218),  INT32_C(   686540543),
+        -INT32_C(  1158453288),  INT32_C(   586253003), -INT32_C(   500798938), -INT32_C(  1276114269), -INT32_C(  1131074098),  INT32_C(   347710165),  INT32_C(  1887046164),  INT32_C(    60849230) },
+      { -INT32_C(   188904301), -INT32_C(   404066603), -INT32_C(   379725256),  INT32_C(   549038120),  INT32_C(   704668796), -INT32_C(    13538866),  INT32_C(  1261795248),  INT32_C(    17516369),
+        -INT32_C(  1548737367), -INT32_C(   672469528),  INT32_C(  1374835762), -INT32_C(   368149843),  INT32_C(   968497359),  INT32_C(  1166286047),  INT32_C(  1342983373), -INT32_C(   312909382) },
+      { -INT32_C(  1662964887),  INT32_C(  1429295937),  INT32_C(   907607411), -INT32_C(   709840418),  INT32_C(   180453248),  INT32_C(   390162404), -INT32_C(   625409759),  INT32_C(   736161051),
+         INT32_C(  1643264143),  INT32_C(  1549303537),  INT32_C(   724685332), -INT32_C(   263831351),  INT32_C(    59139313),  INT32_C(  1893427991),  INT32_C(   104111580),  INT32_C(  1308133868) },
+      { -INT32_C(  1229485947), -INT32_C(   974495145), -INT32_C(   530654540),  INT32_C(   687185961), -INT32_C(   617552876), -INT32_C(  1214383666),  INT32_C(  1848759790),  INT32_C(    17516533),
+        -INT32_C(  1146001447),  INT32_C(  1995042026), -INT32_C(  1053394894), -INT32_C(   474592597), -INT32_C(  1114437169),  INT32_C(  1151371479),  INT32_C(  1884163788),  INT32_C(  1331197354) },
+      {  INT32_C(  1981713558), -INT32_C(  1479921962), -INT32_C(   917007684),  INT32_C(   678266921), -INT32_C(    80691076), -INT32_C(   373515890),  INT32_C(   654637054),  INT32_C(      739061),
+        -INT32_C(  1162778632), -INT32_C(  1545371190), -INT32_C(   790205406), -INT32_C(  1413989721), -INT32_C(  1128719922),  INT32_C(    94672093),  INT32_C(  1883916805), -INT32_C(  1560185830) },
+      {  INT32_C(   693433320), -INT32_C(  1730170564), -INT32_C(   689690813), -INT32_C(   150775818),  INT32_C(    80681879), -INT32_C(  1605235141), -INT32_C(  1865786239), -INT32_C(    16795062),
+        -INT32_C(   967926778),  INT32_C(   179606045),  INT32_C(  1846248431),  INT32_C(   373395312),  INT32_C(  2052386366), -INT32_C(  1101306912), -INT32_C(   541478606),  INT32_C(   279374407) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi32(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi32(test_vec[i].c);
+    simde__m512i r;
+
+    r = simde_mm512_ternarylogic_epi32(a, b, c, 0x96);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r0));
+    r = simde_mm512_ternarylogic_epi32(a, b, c, 0xca);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r1));
+    r = simde_mm512_ternarylogic_epi32(a, b, c, 0xe8);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r2));
+    r = simde_mm512_ternarylogic_epi32(a, b, c, 0x1d);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r3));
+  }
+
+  return 0;
+}
+
+static int32_t
+test_simde_x_ternarylogic_i32_ref (int imm8, int32_t a, int32_t b, int32_t c) {
+  uint32_t r = 0;
+
+  for (int bit = 0 ; bit < 32 ; bit++) {
+    const int idx =
+      HEDLEY_STATIC_CAST(int, ((HEDLEY_STATIC_CAST(uint32_t, a) >> bit) & 1) << 2) |
+      HEDLEY_STATIC_CAST(int, ((HEDLEY_STATIC_CAST(uint32_t, b) >> bit) & 1) << 1) |
+      HEDLEY_STATIC_CAST(int, ((HEDLEY_STATIC_CAST(uint32_t, c) >> bit) & 1)     );
+    r |= HEDLEY_STATIC_CAST(uint32_t, (imm8 >> idx) & 1) << bit;
+  }
+
+  return HEDLEY_STATIC_CAST(int32_t, r);
+}
+
+/* imm8 has to be a constant when the native instruction is used, so
+ * the loop over every value is unrolled by the preprocessor. */
+#define TEST_SIMDE_MM512_TERNARYLOGIC_EPI32_IMM8(imm8) \
+  do { \
+    for (size_t j = 0 ; j < (sizeof(e) / sizeof(e[0])) ; j++) { \
+      e[j] = test_simde_x_ternarylogic_i32_ref((imm8), test_vec[i].a[j], test_vec[i].b[j], test_vec[i].c[j]); \
+    } \
+    r = simde_mm512_ternarylogic_epi32(a, b, c, (imm8)); \
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(e)); \
+  } while (0)
+#define TEST_SIMDE_MM512_TERNARYLOGIC_EPI32_IMM8_X4(imm8) \
+  TEST_SIMDE_MM512_TERNARYLOGIC_EPI32_IMM8((imm8) + 0); \
+  TEST_SIMDE_MM512_TERNARYLOGIC_EPI32_IMM8((imm8) + 1); \
+  TEST_SIMDE_MM512_TERNARYLOGIC_EPI32_IMM8((imm8) + 2); \
+  TEST_SIMDE_MM512_TERNARYLOGIC_EPI32_IMM8((imm8) + 3)
+#define TEST_SIMDE_MM512_TERNARYLOGIC_EPI32_IMM8_X16(imm8) \
+  TEST_SIMDE_MM512_TERNARYLOGIC_EPI32_IMM8_X4((imm8) +  0); \
+  TEST_SIMDE_MM512_TERNARYLOGIC_EPI32_IMM8_X4((imm8) +  4); \
+  TEST_SIMDE_MM512_TERNARYLOGIC_EPI32_IMM8_X4((imm8) +  8); \
+  TEST_SIMDE_MM512_TERNARYLOGIC_EPI32_IMM8_X4((imm8) + 12)
+#define TEST_SIMDE_MM512_TERNARYLOGIC_EPI32_IMM8_X64(imm8) \
+  TEST_SIMDE_MM512_TERNARYLOGIC_EPI32_IMM8_X16((imm8) +  0); \
+  TEST_SIMDE_MM512_TERNARYLOGIC_EPI32_IMM8_X16((imm8) + 16); \
+  TEST_SIMDE_MM512_TERNARYLOGIC_EPI32_IMM8_X16((imm8) + 32); \
+  TEST_SIMDE_MM512_TERNARYLOGIC_EPI32_IMM8_X16((imm8) + 48)
+
+static int
+test_simde_mm512_ternarylogic_epi32_all_imm8 (SIMDE_MUNIT_TEST_ARGS) {
+  /* The first vector has every (a, b, c) bit combination in each
+   * byte, so the result is imm8 repeated; the second is random. */
+  static const struct {
+    const int32_t a[16];
+    const int32_t b[16];
+    const int32_t c[16];
+  } test_vec[] = {
+    { { -INT32_C(   252645136), -INT32_C(   252645136), -INT32_C(   252645136), -INT32_C(   252645136), -INT32_C(   252645136), -INT32_C(   252645136), -INT32_C(   252645136), -INT32_C(   252645136),
+        -INT32_C(   252645136), -INT32_C(   252645136), -INT32_C(   252645136), -INT32_C(   252645136), -INT32_C(   252645136), -INT32_C(   252645136), -INT32_C(   252645136), -INT32_C(   252645136) },
+      { -INT32_C(   858993460), -INT32_C(   858993460), -INT32_C(   858993460), -INT32_C(   858993460), -INT32_C(   858993460), -INT32_C(   858993460), -INT32_C(   858993460), -INT32_C(   858993460),
+        -INT32_C(   858993460), -INT32_C(   858993460), -INT32_C(   858993460), -INT32_C(   858993460), -INT32_C(   858993460), -INT32_C(   858993460), -INT32_C(   858993460), -INT32_C(   858993460) },
+      { -INT32_C(  1431655766), -INT32_C(  1431655766), -INT32_C(  1431655766), -INT32_C(  1431655766), -INT32_C(  1431655766), -INT32_C(  1431655766), -INT32_C(  1431655766), -INT32_C(  1431655766),
+        -INT32_C(  1431655766), -INT32_C(  1431655766), -INT32_C(  1431655766), -INT32_C(  1431655766), -INT32_C(  1431655766), -INT32_C(  1431655766), -INT32_C(  1431655766), -INT32_C(  1431655766) } },
+    { {  INT32_C(   844660292), -INT32_C(  1717916238),  INT32_C(   979695488),  INT32_C(  1650239394), -INT32_C(  1716495842), -INT32_C(   541405746), -INT32_C(   514358214),  INT32_C(   703079434),
+         INT32_C(  2005803765), -INT32_C(   588573339),  INT32_C(  1443412803),  INT32_C(  1688986720), -INT32_C(   488527844),  INT32_C(  1775646361), -INT32_C(  1840458453),  INT32_C(  1291421873) },
+      {  INT32_C(   666118700), -INT32_C(   910795527),  INT32_C(  1362194328),  INT32_C(   415232225), -INT32_C(   568298430), -INT32_C(  1346044593), -INT32_C(   133124650),  INT32_C(   744268579),
+         INT32_C(   199412726),  INT32_C(  1989664919), -INT32_C(   944856622),  INT32_C(  1864360010),  INT32_C(  1294671171),  INT32_C(   826656449),  INT32_C(   390845137), -INT32_C(  1494008979) },
+      { -INT32_C(  1438501147), -INT32_C(  1364354927), -INT32_C(   697534253), -INT32_C(  1914432851),  INT32_C(  1774476852),  INT32_C(   763513077), -INT32_C(  1701088429),  INT32_C(  1273637557),
+         INT32_C(  1664743063),  INT32_C(   170019975), -INT32_C(  1570980972), -INT32_C(  1666195831),  INT32_C(   321781489), -INT32_C(  2001127567),  INT32_C(   510703415), -INT32_C(  1697168486) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi32(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi32(test_vec[i].c);
+    simde__m512i r;
+    int32_t e[16];
+
+    TEST_SIMDE_MM512_TERNARYLOGIC_EPI32_IMM8_X64(  0);
+    TEST_SIMDE_MM512_TERNARYLOGIC_EPI32_IMM8_X64( 64);
+    TEST_SIMDE_MM512_TERNARYLOGIC_EPI32_IMM8_X64(128);
+    TEST_SIMDE_MM512_TERNARYLOGIC_EPI32_IMM8_X64(192);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_ternarylogic_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t a[8];
+    const int64_t b[8];
+    const int64_t c[8];
+    const int64_t r0[8];
+    const int64_t r1[8];
+    const int64_t r2[8];
+    const int64_t r3[8];
+  } test_vec[] = {
+    { {  INT64_C( 3766192767861946567),  INT64_C( 1380793326189711808), -INT64_C( 2315918778264636143), -INT64_C( 2125310088922361976),
+        -INT64_C( 7906545937011146441), -INT64_C( 3602828268623568551), -INT64_C( 1051138639604665567),  INT64_C( 8763151485489016426) },
+      { -INT64_C( 4615557553607555881), -INT64_C( 1932288960937708532), -INT64_C( 4976170802770782838),  INT64_C( 2789346686914241165),
+        -INT64_C( 3309405637899747420),  INT64_C( 2348038493803143889),  INT64_C( 7992014746202869124), -INT64_C(  902035309226514892) },
+      {  INT64_C( 8253891419409024468), -INT64_C( 3697603309418437568), -INT64_C( 9104566833449355427),  INT64_C( 4806769639157343164),
+         INT64_C( 2768707276616631858),  INT64_C( 8718821427753365114),  INT64_C( 9106938888327809112), -INT64_C( 6605544014797180906) },
+      { -INT64_C(  487026448980067900),  INT64_C( 4227129880487952780), -INT64_C( 1978426507843938362), -INT64_C( 8754520278990713159),
+         INT64_C( 7365782180383815841), -INT64_C( 7608057849151934990), -INT64_C( 2170007952787867907),  INT64_C( 3365245302389717064) },
+      {  INT64_C( 8560136571960509911), -INT64_C( 3625563290353126400), -INT64_C( 7281735005272565940),  INT64_C( 2500995366601335484),
+        -INT64_C( 5320404167648999644),  INT64_C( 3530674368837152371),  INT64_C( 7956543410206755160), -INT64_C(  767771723892509132) },
+      {  INT64_C( 3945776541321741527), -INT64_C( 4238114412327193536), -INT64_C( 7209114953320418023),  INT64_C( 7112663258069967756),
+        -INT64_C( 7906513239339038922),  INT64_C( 7536044751042437721),  INT64_C( 9108911473856940288), -INT64_C( 1054836570462198218) },
+      { -INT64_C( 8379426881481228744), -INT64_C(  696184530721837121),  INT64_C( 7217558576796813482), -INT64_C( 7098046350809007033),
+         INT64_C( 5301215493896273609), -INT64_C( 6370968279608847484), -INT64_C( 8100597747178619225), -INT64_C( 8438751319217305123) } },
+    { {  INT64_C( 1799539389460810660), -INT64_C( 8384488179750148006),  INT64_C( 2296314858467609212), -INT64_C( 5658425937402153303),
+         INT64_C( 3578706788533332374), -INT64_C( 2114154372755750217), -INT64_C( 2370268176018923675), -INT64_C( 4401828381989557142) },
+      { -INT64_C( 4698577012735835329), -INT64_C(  360316281635025655), -INT64_C( 5396717697205151537),  INT64_C( 5827411337069606010),
+        -INT64_C( 3245090171534137976),  INT64_C( 4343345680317692551), -INT64_C( 4439944497105047028),  INT64_C( 1151248583026742047) },
+      { -INT64_C( 4182700036870887763), -INT64_C( 4105225080357898160),  INT64_C( 3874403528213150808), -INT64_C(  637348418529836283),
+        -INT64_C(  525251709036950402),  INT64_C( 3102735449954309263),  INT64_C( 3566730175130560863), -INT64_C( 6418792699520419489) },
+      {  INT64_C( 7189542611206417974), -INT64_C( 5306091767729021693), -INT64_C( 6989161586182705429),  INT64_C( 1621730000678470102),
+         INT64_C( 2011120193555251296), -INT64_C(  729429907530584897),  INT64_C( 3172409442397455414),  INT64_C( 7780038829381666346) },
+      { -INT64_C( 2464298610103376083), -INT64_C( 3555785685300750328),  INT64_C( 3826513055769164876),  INT64_C( 6223869120939455788),
+        -INT64_C( 2830513952697768472),  INT64_C( 2956087535056574095), -INT64_C( 2132869966014549474),  INT64_C( 2804139947436757279) },
+      { -INT64_C( 7135640135676165203), -INT64_C( 3771968887007025064),  INT64_C( 3881581137829156956), -INT64_C( 1045046509770426839),
+        -INT64_C( 1101377642796503650),  INT64_C( 3030678332523418247), -INT64_C( 3207945970195432627), -INT64_C( 8724705663932450465) },
+      { -INT64_C( 6484371381538301861),  INT64_C( 8096265097600108455), -INT64_C( 1575877460986948701),  INT64_C( 5225939367317899474),
+        -INT64_C( 4081104433292749303), -INT64_C( 2524551066407257744),  INT64_C(  927860051553903784),  INT64_C( 6707601021251098549) } },
+    { {  INT64_C( 4086859590610274589),  INT64_C( 7522860092081262990), -INT64_C( 6810097489173100546), -INT64_C(  639024982323182184),
+         INT64_C( 2920394857859114570),  INT64_C( 3381982798616987250),  INT64_C( 5660438216504790628),  INT64_C( 6481375689760053324) },
+      {  INT64_C( 3348054457846007579),  INT64_C( 7640487442272323648), -INT64_C( 3634834879777443812), -INT64_C( 8916453956536297506),
+         INT64_C( 2621314372571396747),  INT64_C(  919611538477999516), -INT64_C( 8957947890674508876),  INT64_C(   55518468900499992) },
+      { -INT64_C( 4039660419567810116),  INT64_C( 5734377210521913792),  INT64_C( 1706518140603812137), -INT64_C( 6246065854860668117),
+         INT64_C( 2096940550539743106),  INT64_C(  632533469080013621),  INT64_C( 2968185536784634890), -INT64_C( 3102043900313932987) },
+      { -INT64_C( 3372665403739289670),  INT64_C( 5618942078211837966),  INT64_C( 8889280687259516619), -INT64_C( 2724015565565558419),
+         INT64_C( 1296544648229491523),  INT64_C( 3092600113598015707), -INT64_C( 2012530353034329638), -INT64_C( 8231429362720227055) },
+      { -INT64_C( 1191713097885843015),  INT64_C( 8038952623525660736), -INT64_C( 7525961931673614307), -INT64_C( 8336123213199763525),
+         INT64_C( 3826027579963894666),  INT64_C(  919602742363114773),  INT64_C( 2575211900316965422), -INT64_C( 8880751283236048119) },
+      {  INT64_C( 3383959516313880861),  INT64_C( 7639391333331831232), -INT64_C( 8813847457803124420), -INT64_C( 6538764614077294694),
+         INT64_C( 3171052566370381450),  INT64_C(  920763846288492340),  INT64_C(  841603107824623140),  INT64_C( 5833139810533423692) },
+      {  INT64_C( 1606040141641184834), -INT64_C( 7896104692394033537),  INT64_C( 7841702110581536450),  INT64_C( 5975819126057843270),
+        -INT64_C( 4114411896299382539), -INT64_C(  920763227159072306), -INT64_C( 3070870646901722671),  INT64_C( 3102282217043895986) } },
+    { {  INT64_C( 8292059043135823862), -INT64_C( 7583706262646284547),  INT64_C( 5819510401760382187), -INT64_C(  558345083163347332),
+         INT64_C( 6651346743661861187), -INT64_C( 2428911816128385650),  INT64_C( 3157740075221901527), -INT64_C(  471834688846091949) },
+      {  INT64_C( 3149851712690720360),  INT64_C( 6282903324370342253), -INT64_C( 5887210920856785777),  INT64_C( 9102581720397904037),
+        -INT64_C( 2310873286994793902),  INT64_C(  211104370137326040), -INT64_C( 7183179087220279760), -INT64_C( 5005965187016901333) },
+      { -INT64_C( 8260888521711114905),  INT64_C( 1721512774522008154),  INT64_C( 8434428361594913009),  INT64_C( 1377346644098718015),
+         INT64_C(  655263171654782227), -INT64_C( 4508716128178025275), -INT64_C( 6017912908077375014), -INT64_C( 8941170208980388555) },
+      { -INT64_C( 3026798153279621895), -INT64_C( 3020768955405337142), -INT64_C( 8394011708149866347), -INT64_C( 7705710933302765594),
+        -INT64_C( 8451143237770936830),  INT64_C( 2146784692717060243),  INT64_C( 2017233764205918013), -INT64_C( 4603209986668584627) },
+      { -INT64_C( 5811291238711251359),  INT64_C( 1667822711037915247),  INT64_C( 2687556925612510363),  INT64_C( 8889364017249188135),
+         INT64_C( 6728275576591289426),  INT64_C(  247088866749964745), -INT64_C( 8323746622922399464), -INT64_C( 5004848247418503897) },
+      {  INT64_C( 3103910193697525606),  INT64_C( 1720739395825701501),  INT64_C( 8380369775324187883),  INT64_C( 8813647107318020157),
+         INT64_C( 6723439933046393171), -INT64_C( 4436654133443072564), -INT64_C( 6030292842140835630), -INT64_C( 4907880049087398605) },
+      {  INT64_C( 6387390938682183832), -INT64_C( 1640792368969446016), -INT64_C( 5854996039921978620), -INT64_C( 8740743855560094015),
+        -INT64_C( 6656274753435274564),  INT64_C( 4375030898277503602), -INT64_C( 2917220523536507355),  INT64_C( 5085773333769017064) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi64(test_vec[i].c);
+    simde__m512i r;
+
+    r = simde_mm512_ternarylogic_epi64(a, b, c, 0x96);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r0));
+    r = simde_mm512_ternarylogic_epi64(a, b, c, 0xca);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r1));
+    r = simde_mm512_ternarylogic_epi64(a, b, c, 0xe8);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r2));
+    r = simde_mm512_ternarylogic_epi64(a, b, c, 0x1d);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r3));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_ternarylogic_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t src[16];
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t b[16];
+    const int32_t r0[16];
+    const int32_t r1[16];
+  } test_vec[] = {
+    { { -INT32_C(  2076930243), -INT32_C(  1982297759), -INT32_C(  1851380614), -INT32_C(   330506314), -INT32_C(  1082193541),  INT32_C(   140674550),  INT32_C(   502041086),  INT32_C(  1819965149),
+         INT32_C(   803357804),  INT32_C(  1507520337),  INT32_C(  1379856245),  INT32_C(   330184738), -INT32_C(   171269807),  INT32_C(   884409798),  INT32_C(  1222712268), -INT32_C(   857798254) },
+      UINT16_C(  954),
+      {  INT32_C(   497188585), -INT32_C(  1864404677),  INT32_C(   855340309),  INT32_C(   720456674),  INT32_C(   323818972), -INT32_C(  1665551117),  INT32_C(   815632073),  INT32_C(  1551510630),
+         INT32_C(  1748526158),  INT32_C(   463640466),  INT32_C(  1076633281),  INT32_C(   783648808),  INT32_C(  1602076798), -INT32_C(  2024289093), -INT32_C(  1944807948), -INT32_C(   376797383) },
+      { -INT32_C(  1967951374), -INT32_C(   677585041),  INT32_C(  1666646978),  INT32_C(  1838576811), -INT32_C(  1850049917),  INT32_C(  1663807514), -INT32_C(  1330305745),  INT32_C(   223962883),
+         INT32_C(   441200853), -INT32_C(  1086503472),  INT32_C(  1528388490),  INT32_C(  2014603957),  INT32_C(   924412400),  INT32_C(   860447075), -INT32_C(   919613735), -INT32_C(    89668576) },
+      { -INT32_C(  2076930243),  INT32_C(   423942218), -INT32_C(  1851380614), -INT32_C(   992174316), -INT32_C(  1367926277),  INT32_C(   139146724),  INT32_C(   502041086),  INT32_C(  1612862175),
+         INT32_C(   669672488),  INT32_C(  1123740353),  INT32_C(  1379856245),  INT32_C(   330184738), -INT32_C(   171269807),  INT32_C(   884409798),  INT32_C(  1222712268), -INT32_C(   857798254) },
+      { -INT32_C(  2076930243),  INT32_C(   419952730), -INT32_C(  1851380614), -INT32_C(   960654252), -INT32_C(  1406002009), -INT32_C(  1797574395),  INT32_C(   502041086),  INT32_C(   805329595),
+         INT32_C(  1205477410),  INT32_C(  1115191491),  INT32_C(  1379856245),  INT32_C(   330184738), -INT32_C(   171269807),  INT32_C(   884409798),  INT32_C(  1222712268), -INT32_C(   857798254) } },
+    { {  INT32_C(   557388160),  INT32_C(  1066568455),  INT32_C(   875612477),  INT32_C(    60972088), -INT32_C(  1192264387),  INT32_C(  1324475529),  INT32_C(   395606546), -INT32_C(   467481335),
+         INT32_C(  1564571401),  INT32_C(  1797884649),  INT32_C(  1986415337),  INT32_C(  1897999822), -INT32_C(   287894747), -INT32_C(   729557357), -INT32_C(   537739435), -INT32_C(  2127590786) },
+      UINT16_C( 4321),
+      { -INT32_C(   809185866),  INT32_C(   589553228),  INT32_C(  2104831859),  INT32_C(  1015908603),  INT32_C(   191194528), -INT32_C(  1675325183),  INT32_C(  1498893619),  INT32_C(   926119685),
+         INT32_C(   526344029),  INT32_C(  2107640521), -INT32_C(  1321490195),  INT32_C(  2007266924), -INT32_C(  2038779117),  INT32_C(  1788328077), -INT32_C(   194053170),  INT32_C(  1828934441) },
+      {  INT32_C(   163607805), -INT32_C(  1673768809), -INT32_C(  2063921319),  INT32_C(  1302379831), -INT32_C(   957007497), -INT32_C(   145812125), -INT32_C(  1271877196), -INT32_C(   327243495),
+         INT32_C(  1094520169), -INT32_C(   490219295),  INT32_C(   920979239),  INT32_C(   557671862), -INT32_C(   591979249), -INT32_C(  2080221023), -INT32_C(  1368983291), -INT32_C(   126336289) },
+      {  INT32_C(   687428916),  INT32_C(  1066568455),  INT32_C(   875612477),  INT32_C(    60972088), -INT32_C(  1192264387), -INT32_C(   621415032),  INT32_C(   126122786), -INT32_C(  1072632824),
+         INT32_C(  1564571401),  INT32_C(  1797884649),  INT32_C(  1986415337),  INT32_C(  1897999822),  INT32_C(  1793393190), -INT32_C(   729557357), -INT32_C(   537739435), -INT32_C(  2127590786) },
+      { -INT32_C(   285352906),  INT32_C(  1066568455),  INT32_C(   875612477),  INT32_C(    60972088), -INT32_C(  1192264387), -INT32_C(   757762680),  INT32_C(  1321416481), -INT32_C(   753812980),
+         INT32_C(  1564571401),  INT32_C(  1797884649),  INT32_C(  1986415337),  INT32_C(  1897999822),  INT32_C(  1756209206), -INT32_C(   729557357), -INT32_C(   537739435), -INT32_C(  2127590786) } },
+    { {  INT32_C(   681431166), -INT32_C(    12343778), -INT32_C(  2018750346),  INT32_C(  1098612672),  INT32_C(  1195091189),  INT32_C(   304274781), -INT32_C(   243976200), -INT32_C(  2002306644),
+         INT32_C(   779009391), -INT32_C(  1806244992),  INT32_C(    18574087),  INT32_C(   190010655),  INT32_C(  1858030423),  INT32_C(   169631786),  INT32_C(  1196933246),  INT32_C(  1885773097) },
+      UINT16_C( 2920),
+      { -INT32_C(  1821038202), -INT32_C(  2034946096),  INT32_C(   843376421),  INT32_C(  1391436382), -INT32_C(  1190680982),  INT32_C(   120669080), -INT32_C(  2080215377), -INT32_C(  2093108091),
+        -INT32_C(   729452548),  INT32_C(  1539237241),  INT32_C(  1201707881), -INT32_C(  1951613695), -INT32_C(    48238070),  INT32_C(   115410866), -INT32_C(  1698990156),  INT32_C(   173958793) },
+      {  INT32_C(  1527209966), -INT32_C(   800539815),  INT32_C(  1853974843),  INT32_C(   748384254), -INT32_C(   489437628), -INT32_C(    17217203),  INT32_C(  1966308139),  INT32_C(  2055828749),
+        -INT32_C(  1402302494),  INT32_C(  1082224475),  INT32_C(   482205308),  INT32_C(   726908930),  INT32_C(   603906311),  INT32_C(    31645563), -INT32_C(   408144221), -INT32_C(   135989764) },
+      {  INT32_C(   681431166), -INT32_C(    12343778), -INT32_C(  2018750346),  INT32_C(  1106271646),  INT32_C(  1195091189),  INT32_C(   336829525), -INT32_C(   176726573), -INT32_C(  2002306644),
+        -INT32_C(  1435585905), -INT32_C(   724138279),  INT32_C(    18574087),  INT32_C(     5494047),  INT32_C(  1858030423),  INT32_C(   169631786),  INT32_C(  1196933246),  INT32_C(  1885773097) },
+      {  INT32_C(   681431166), -INT32_C(    12343778), -INT32_C(  2018750346),  INT32_C(   328523166),  INT32_C(  1195091189),  INT32_C(   353607365),  INT32_C(  1970755927), -INT32_C(  2002306644),
+        -INT32_C(    85208429), -INT32_C(   806877447),  INT32_C(    18574087), -INT32_C(  2130712546),  INT32_C(  1858030423),  INT32_C(   169631786),  INT32_C(  1196933246),  INT32_C(  1885773097) } },
+    { { -INT32_C(   334964836), -INT32_C(   349996719), -INT32_C(  1642315744),  INT32_C(   183486155), -INT32_C(   843385892),  INT32_C(   459219874), -INT32_C(  1636124337), -INT32_C(   778514141),
+        -INT32_C(   804891042), -INT32_C(  2109708619),  INT32_C(  1053768059),  INT32_C(    84742562), -INT32_C(   602916219), -INT32_C(   140999375),  INT32_C(   438605722),  INT32_C(   539503660) },
+      UINT16_C(22572),
+      { -INT32_C(   161026624),  INT32_C(  1735347481),  INT32_C(   744640699),  INT32_C(   983659004), -INT32_C(   775538640), -INT32_C(   350899704),  INT32_C(  2122650038), -INT32_C(  1556409890),
+         INT32_C(   386474408),  INT32_C(   471731895),  INT32_C(  1708314622),  INT32_C(  1093105413),  INT32_C(   272955703), -INT32_C(   879340014), -INT32_C(   572230650),  INT32_C(  1141666860) },
+      { -INT32_C(  1017294448), -INT32_C(    84462688),  INT32_C(  1029015237),  INT32_C(  1625525463), -INT32_C(   123905568), -INT32_C(  1742449973), -INT32_C(  2078653721),  INT32_C(  1878181639),
+        -INT32_C(   538148019),  INT32_C(   296226892),  INT32_C(  1057593517),  INT32_C(   513623371),  INT32_C(   549830762),  INT32_C(   333488614),  INT32_C(   159446911), -INT32_C(  1918612781) },
+      { -INT32_C(   334964836), -INT32_C(   349996719), -INT32_C(  1302576991),  INT32_C(   709805599), -INT32_C(   843385892), -INT32_C(  1822740054), -INT32_C(  1636124337), -INT32_C(   778514141),
+        -INT32_C(   804891042), -INT32_C(  2109708619),  INT32_C(  1053768059),  INT32_C(    84432035), -INT32_C(   598410585), -INT32_C(   140999375),  INT32_C(   329573276),  INT32_C(   539503660) },
+      { -INT32_C(   334964836), -INT32_C(   349996719), -INT32_C(  1300361061),  INT32_C(   810465079), -INT32_C(   843385892), -INT32_C(   263548502), -INT32_C(  1636124337), -INT32_C(   778514141),
+        -INT32_C(   804891042), -INT32_C(  2109708619),  INT32_C(  1053768059),  INT32_C(  1143629479), -INT32_C(   866860110), -INT32_C(   140999375), -INT32_C(   943660132),  INT32_C(   539503660) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi32(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi32(test_vec[i].b);
+    simde__m512i r;
+
+    r = simde_mm512_mask_ternarylogic_epi32(src, test_vec[i].k, a, b, 0x78);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r0));
+    r = simde_mm512_mask_ternarylogic_epi32(src, test_vec[i].k, a, b, 0x3c);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_mask_ternarylogic_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int64_t src[8];
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t b[8];
+    const int64_t r0[8];
+    const int64_t r1[8];
+  } test_vec[] = {
+    { {  INT64_C( 6128675161310917156),  INT64_C( 7186134167178662697), -INT64_C( 2536768191639043391), -INT64_C( 8160177935245495631),
+         INT64_C( 8284133142798765217),  INT64_C( 8785518144133464992),  INT64_C( 8587068821970693485), -INT64_C( 1214858148215285623) },
+      UINT8_C(169),
+      { -INT64_C( 3626830287341979040),  INT64_C( 3542390791328702922), -INT64_C( 3795015549194125989), -INT64_C( 8143836881940294218),
+        -INT64_C( 8948651652734459093),  INT64_C( 5726223782122916342), -INT64_C( 5811411137282192719),  INT64_C( 5700254299173433390) },
+      {  INT64_C( 2549545847786833625), -INT64_C( 4722314502690480339), -INT64_C( 8034719242457623733),  INT64_C( 8664486114493765961),
+        -INT64_C( 6433435414729668196), -INT64_C( 2004986891854006639),  INT64_C( 4860384822236348747),  INT64_C( 6342829945021313401) },
+      {  INT64_C( 6065686269423939684),  INT64_C( 7186134167178662697), -INT64_C( 2536768191639043391), -INT64_C( 8720242766048255055),
+         INT64_C( 8284133142798765217),  INT64_C( 4452067940631774000),  INT64_C( 8587068821970693485), -INT64_C( 6403636107987933023) },
+      { -INT64_C( 7446837742204876732),  INT64_C( 7186134167178662697), -INT64_C( 2536768191639043391),  INT64_C(   16465083388356359),
+         INT64_C( 8284133142798765217),  INT64_C( 3934963019960257110),  INT64_C( 8587068821970693485), -INT64_C( 6901577424337393497) } },
+    { { -INT64_C( 2096593537391534965),  INT64_C( 2459793916296319155),  INT64_C( 4607987227973227044), -INT64_C( 7732767726425697509),
+         INT64_C(  272621064706748077),  INT64_C( 3048648107674809997), -INT64_C( 4592900555727600638), -INT64_C( 8285170197636036947) },
+      UINT8_C( 47),
+      { -INT64_C( 3815292160332055160), -INT64_C( 5667406748903519154), -INT64_C( 5017558756487288916), -INT64_C( 2464590495391070369),
+        -INT64_C( 5619269565278668326),  INT64_C( 2439463569385910095),  INT64_C( 4666115329026617119),  INT64_C( 7978445275060652666) },
+      { -INT64_C( 8369253689859390968), -INT64_C( 3461466143932560280),  INT64_C(  701522131648891496),  INT64_C( 7480004866905612485),
+         INT64_C( 3780364213300226269),  INT64_C( 5119783244547242512), -INT64_C( 3214518136677119619),  INT64_C( 1934665442656874476) },
+      {  INT64_C( 7633380732188286083), -INT64_C( 6669071250145272581),  INT64_C( 4030395494330077196), -INT64_C( 3358646585926708386),
+         INT64_C(  272621064706748077),  INT64_C( 3118442013396016269), -INT64_C( 4592900555727600638), -INT64_C( 8285170197636036947) },
+      {  INT64_C( 3020293259474166019), -INT64_C( 7819478078191166211), -INT64_C( 8814433850663029368),  INT64_C( 5288269096719471684),
+         INT64_C(  272621064706748077),  INT64_C(  834378126139021762), -INT64_C( 4592900555727600638), -INT64_C( 8285170197636036947) } },
+    { {  INT64_C( 5814057038533102265), -INT64_C( 3063687257956343910), -INT64_C( 2035551374490633792),  INT64_C(  225699298674534318),
+        -INT64_C( 9122182636655573739), -INT64_C( 4421679712862821504), -INT64_C( 8991017718448314103), -INT64_C( 6841115620326698096) },
+      UINT8_C(  9),
+      {  INT64_C( 1442364099693199330), -INT64_C( 2243606847379693112), -INT64_C( 7994570502663440657), -INT64_C( 7928518870970986514),
+        -INT64_C( 2468973108360493982), -INT64_C( 5661639421519439786), -INT64_C( 6744491032236135854),  INT64_C( 8021833433958590697) },
+      {  INT64_C( 8492236773552083299), -INT64_C( 1190232589768725371),  INT64_C( 6311387411425679950),  INT64_C( 2063672033720383229),
+        -INT64_C( 5053918938689513082), -INT64_C( 5159161562548056688),  INT64_C( 7751441627889824491),  INT64_C( 2623550914218298019) },
+      {  INT64_C( 4949423084616817627), -INT64_C( 3063687257956343910), -INT64_C( 2035551374490633792),  INT64_C( 1405679784503533890),
+        -INT64_C( 9122182636655573739), -INT64_C( 4421679712862821504), -INT64_C( 8991017718448314103), -INT64_C( 6841115620326698096) },
+      {  INT64_C( 4948295538423182683), -INT64_C( 3063687257956343910), -INT64_C( 2035551374490633792), -INT64_C( 7865002073165141952),
+        -INT64_C( 9122182636655573739), -INT64_C( 4421679712862821504), -INT64_C( 8991017718448314103), -INT64_C( 6841115620326698096) } },
+    { { -INT64_C( 3157953971781380949),  INT64_C( 8791780149356173155), -INT64_C(  331023098295309924), -INT64_C( 6932524985993014708),
+         INT64_C( 1084132318740008936), -INT64_C( 7584304214060641529),  INT64_C( 3665895707404394235),  INT64_C(  231736401831096772) },
+      UINT8_C( 15),
+      { -INT64_C( 6302997454064283851),  INT64_C( 7693658841629989601),  INT64_C( 8276801682358518834), -INT64_C( 5336182521963033722),
+        -INT64_C( 5556423465081500036),  INT64_C( 4103688700287377615), -INT64_C( 3052728387969745326), -INT64_C( 3906644412421471320) },
+      { -INT64_C( 4788931619782705274), -INT64_C( 7958939706231780272), -INT64_C( 5423673708995096136),  INT64_C( 1328785720816177303),
+         INT64_C( 4881480959961750130),  INT64_C( 1060589311773056769), -INT64_C( 7077245181316957058),  INT64_C( 4990311471958413292) },
+      {  INT64_C( 8984383875734690735),  INT64_C( 8828926600552685347), -INT64_C( 3747309926146872916), -INT64_C( 8089947889066716470),
+         INT64_C( 1084132318740008936), -INT64_C( 7584304214060641529),  INT64_C( 3665895707404394235),  INT64_C(  231736401831096772) },
+      {  INT64_C( 8983538510973721502),  INT64_C( 1209199471205977474), -INT64_C( 8522249232038662738),  INT64_C( 3042369588884085194),
+         INT64_C( 1084132318740008936), -INT64_C( 7584304214060641529),  INT64_C( 3665895707404394235),  INT64_C(  231736401831096772) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i src = simde_mm512_loadu_epi64(test_vec[i].src);
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i r;
+
+    r = simde_mm512_mask_ternarylogic_epi64(src, test_vec[i].k, a, b, 0x78);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r0));
+    r = simde_mm512_mask_ternarylogic_epi64(src, test_vec[i].k, a, b, 0x3c);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_ternarylogic_epi32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask16 k;
+    const int32_t a[16];
+    const int32_t b[16];
+    const int32_t c[16];
+    const int32_t r0[16];
+    const int32_t r1[16];
+  } test_vec[] = {
+    { UINT16_C(33010),
+      {  INT32_C(   911479989),  INT32_C(   769691128),  INT32_C(  1826061617),  INT32_C(  1088015984),  INT32_C(  1711310776),  INT32_C(  1561038850), -INT32_C(   184455353), -INT32_C(  1212643956),
+        -INT32_C(   614638700),  INT32_C(  1888313262),  INT32_C(  1739235318),  INT32_C(   827787535),  INT32_C(   588083495),  INT32_C(  1578946305), -INT32_C(   187059124), -INT32_C(   506065697) },
+      { -INT32_C(  1988266066), -INT32_C(  1932800454),  INT32_C(  1948581211),  INT32_C(  1362828246),  INT32_C(   331797361), -INT32_C(  1934247273), -INT32_C(   691195617),  INT32_C(  2104734419),
+         INT32_C(  1754121919),  INT32_C(  1561532902), -INT32_C(  1056487117), -INT32_C(  1110654548), -INT32_C(  1162127958), -INT32_C(   708669115), -INT32_C(  1014831186), -INT32_C(  1698312578) },
+      {  INT32_C(  1674220875), -INT32_C(   222622413), -INT32_C(   884378821),  INT32_C(  1127825916),  INT32_C(  1264968357), -INT32_C(  1997028669), -INT32_C(  1183892099), -INT32_C(   768185842),
+        -INT32_C(   384574841), -INT32_C(  1519935956),  INT32_C(  1468566408),  INT32_C(   185296149),  INT32_C(   286764779), -INT32_C(   402771823),  INT32_C(   131348020),  INT32_C(  1277344613) },
+      {  INT32_C(           0),  INT32_C(  1607503097),  INT32_C(           0),  INT32_C(           0),  INT32_C(   773957436),  INT32_C(  1565118530), -INT32_C(   601660633),  INT32_C(   901565824),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1510720034) },
+      {  INT32_C(           0), -INT32_C(   547376945),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1384288993), -INT32_C(   134457367),  INT32_C(  1283379898),  INT32_C(  1703866274),
+         INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1375946822) } },
+    { UINT16_C(64556),
+      { -INT32_C(  1495944005),  INT32_C(   992969979), -INT32_C(  2018468527), -INT32_C(  1648873956),  INT32_C(    31365596), -INT32_C(    78813857), -INT32_C(  1115714018),  INT32_C(  1984229282),
+         INT32_C(   211002374),  INT32_C(  1736472626),  INT32_C(   829677291),  INT32_C(   275434315),  INT32_C(    81206772), -INT32_C(  1485092410), -INT32_C(  2086238778), -INT32_C(   729682390) },
+      {  INT32_C(  1238936399),  INT32_C(  1111770267),  INT32_C(  1609627022),  INT32_C(  1941895547),  INT32_C(  1326945513), -INT32_C(  1857982115),  INT32_C(  2023557108),  INT32_C(    53443524),
+        -INT32_C(  1923005611),  INT32_C(   306325564),  INT32_C(    25476532), -INT32_C(  1995096795), -INT32_C(   944234402), -INT32_C(  1160430694), -INT32_C(  1374138721),  INT32_C(     1505143) },
+      { -INT32_C(   704197634),  INT32_C(   875970199),  INT32_C(  1003273600), -INT32_C(  1878781305), -INT32_C(  1966762833), -INT32_C(  1144348887), -INT32_C(  1918969354),  INT32_C(  1611024428),
+        -INT32_C(  1510839238), -INT32_C(   241031158), -INT32_C(  2128368100), -INT32_C(   158351298), -INT32_C(   242081093),  INT32_C(   581243888), -INT32_C(  1146968090),  INT32_C(   224627300) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(  1480813231),  INT32_C(   498609304),  INT32_C(           0), -INT32_C(   775427201),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0), -INT32_C(  1320100637),  INT32_C(  1725958993),  INT32_C(   886382421), -INT32_C(  1487189594), -INT32_C(  1845222234), -INT32_C(   639572438) },
+      {  INT32_C(           0),  INT32_C(           0), -INT32_C(  1132518671),  INT32_C(   234699931),  INT32_C(           0),  INT32_C(  1152908022),  INT32_C(           0),  INT32_C(           0),
+         INT32_C(           0),  INT32_C(           0), -INT32_C(    27758345), -INT32_C(   421196811), -INT32_C(    45744305), -INT32_C(   975249865),  INT32_C(  2017800736), -INT32_C(    68524850) } },
+    { UINT16_C(45795),
+      {  INT32_C(  1357353629), -INT32_C(   310644660),  INT32_C(  1512998304),  INT32_C(   682845570),  INT32_C(  1881851852), -INT32_C(  1833731170), -INT32_C(  1094190859),  INT32_C(  1426153833),
+         INT32_C(  1957249341), -INT32_C(  2072893390), -INT32_C(   934670205), -INT32_C(  1698612935), -INT32_C(  1308752737), -INT32_C(     7203838), -INT32_C(  1320823190), -INT32_C(  1580810280) },
+      {  INT32_C(  1891601958), -INT32_C(   356031496), -INT32_C(  1189104963),  INT32_C(   470611880), -INT32_C(  1788495254), -INT32_C(   202584138), -INT32_C(   128046010), -INT32_C(   130128175),
+         INT32_C(  1821472019), -INT32_C(  1777202660),  INT32_C(   833235147),  INT32_C(  1866572529), -INT32_C(   394134793), -INT32_C(  1946099429),  INT32_C(   987725651),  INT32_C(  1142314110) },
+      { -INT32_C(  1656239034), -INT32_C(  1932556734),  INT32_C(  1601166013), -INT32_C(   690658451), -INT32_C(  1427539179), -INT32_C(  1111876429), -INT32_C(   584457208),  INT32_C(  1511528530),
+         INT32_C(  1996860996), -INT32_C(  2134383901), -INT32_C(   862514397),  INT32_C(   905745677), -INT32_C(   368831291),  INT32_C(   485048687), -INT32_C(  1662827548),  INT32_C(   554523935) },
+      { -INT32_C(   576204067), -INT32_C(   378309554),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1633588321), -INT32_C(  1142540035),  INT32_C(  1459714411),
+         INT32_C(           0), -INT32_C(  2068330287),  INT32_C(           0),  INT32_C(           0), -INT32_C(  1275461473), -INT32_C(   277146522),  INT32_C(           0), -INT32_C(  2133870887) },
+      { -INT32_C(   811565093),  INT32_C(  1907654159),  INT32_C(           0),  INT32_C(           0),  INT32_C(           0),  INT32_C(   789145453),  INT32_C(  1676550141),  INT32_C(   265943359),
+         INT32_C(           0),  INT32_C(  1841160145),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1610223962), -INT32_C(   478191635),  INT32_C(           0), -INT32_C(  1695817017) } },
+    { UINT16_C(10741),
+      {  INT32_C(  1301418235), -INT32_C(   301796045),  INT32_C(   429949207),  INT32_C(  1600897765),  INT32_C(   589027045), -INT32_C(   712747359),  INT32_C(  2026613372),  INT32_C(  1648364068),
+         INT32_C(  1952096658),  INT32_C(   635867536), -INT32_C(   846058257),  INT32_C(  1053279308), -INT32_C(   254583310),  INT32_C(   629955289),  INT32_C(    91212001),  INT32_C(   342504689) },
+      { -INT32_C(  1880851860),  INT32_C(  1194325008), -INT32_C(  1636170593),  INT32_C(   875199121),  INT32_C(    68825178),  INT32_C(  1590233472),  INT32_C(  2039622688),  INT32_C(   933281657),
+         INT32_C(   331010417),  INT32_C(   368977057), -INT32_C(   590922963), -INT32_C(   776297093), -INT32_C(  1346238352),  INT32_C(   717963672), -INT32_C(  1427696654),  INT32_C(  1873594207) },
+      {  INT32_C(  2025567407), -INT32_C(   604457986),  INT32_C(  1120362932), -INT32_C(  1386131044), -INT32_C(  2071387250),  INT32_C(   262569685), -INT32_C(   102233977),  INT32_C(   757145512),
+         INT32_C(    60047081), -INT32_C(   126606149), -INT32_C(  1180164901),  INT32_C(  1907675614),  INT32_C(  1826332339), -INT32_C(  1656650670), -INT32_C(  1379606058),  INT32_C(   449932688) },
+      {  INT32_C(  1032426616),  INT32_C(           0),  INT32_C(  1495654455),  INT32_C(           0), -INT32_C(  1550133919), -INT32_C(   727572236), -INT32_C(   123491589),  INT32_C(  1782647460),
+         INT32_C(  1952354074),  INT32_C(           0),  INT32_C(           0),  INT32_C(   516134088),  INT32_C(           0), -INT32_C(  1332945253),  INT32_C(           0),  INT32_C(           0) },
+      {  INT32_C(   891921748),  INT32_C(           0),  INT32_C(  2070412003),  INT32_C(           0), -INT32_C(      590485), -INT32_C(    97343362), -INT32_C(  2027424773), -INT32_C(   813738610),
+        -INT32_C(     3170433),  INT32_C(           0),  INT32_C(           0),  INT32_C(  1332944786),  INT32_C(           0), -INT32_C(   117571921),  INT32_C(           0),  INT32_C(           0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi32(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi32(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi32(test_vec[i].c);
+    simde__m512i r;
+
+    r = simde_mm512_maskz_ternarylogic_epi32(test_vec[i].k, a, b, c, 0xd2);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r0));
+    r = simde_mm512_maskz_ternarylogic_epi32(test_vec[i].k, a, b, c, 0x5b);
+    simde_test_x86_assert_equal_i32x16(r, simde_mm512_loadu_epi32(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm512_maskz_ternarylogic_epi64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde__mmask8 k;
+    const int64_t a[8];
+    const int64_t b[8];
+    const int64_t c[8];
+    const int64_t r0[8];
+    const int64_t r1[8];
+  } test_vec[] = {
+    { UINT8_C(182),
+      { -INT64_C( 7897492278808425938), -INT64_C( 3436773816923372215), -INT64_C( 3212380263431442629),  INT64_C( 7113963637849021352),
+        -INT64_C( 5832301662449455048), -INT64_C( 7099592944726133820),  INT64_C(  860780034483797592),  INT64_C( 3102187443479330087) },
+      { -INT64_C( 2343149967310085429),  INT64_C( 3179239599849304960),  INT64_C( 6535220573591833174),  INT64_C( 2912162922384437266),
+        -INT64_C( 6433437536231182404),  INT64_C( 5769811174826275133), -INT64_C( 3394026577504835112), -INT64_C( 3994941778794821857) },
+      { -INT64_C( 7748924163534505217),  INT64_C( 5968892948197544643),  INT64_C( 8557913124421262942), -INT64_C( 2089779244481506290),
+         INT64_C( 6402885534678823773), -INT64_C( 3035849556883254668), -INT64_C( 6128939341456736740), -INT64_C( 3085234613499560807) },
+      {  INT64_C(                   0), -INT64_C( 9038970274052356854), -INT64_C(  636901273220072653),  INT64_C(                   0),
+        -INT64_C(  628383188765925255),  INT64_C( 1780381578478268804),  INT64_C(                   0),  INT64_C( 4480287138235876775) },
+      {  INT64_C(                   0), -INT64_C( 8954291924596039746), -INT64_C( 6508634333052685851),  INT64_C(                   0),
+        -INT64_C(  588775335148174489),  INT64_C( 7685343558241152434),  INT64_C(                   0), -INT64_C(  111775816567897602) } },
+    { UINT8_C(138),
+      { -INT64_C( 8490146164719918138), -INT64_C( 3923088219551864455),  INT64_C( 2339119349533771324), -INT64_C( 8277712441521968022),
+         INT64_C( 4864537339880549482), -INT64_C( 6646124591296590585), -INT64_C( 2422833009713026146), -INT64_C( 3459746207613783201) },
+      { -INT64_C( 1918784846949292672),  INT64_C(  432005821367859756), -INT64_C( 9022564818640135419),  INT64_C(  600913499520950579),
+         INT64_C( 6336152698278417830),  INT64_C( 2534133532672677115),  INT64_C( 3941688665553047923),  INT64_C( 1836141920690825694) },
+      {  INT64_C( 1558966384439313561), -INT64_C( 7792771949448796969),  INT64_C( 1279182134509050470), -INT64_C( 7215263229844619599),
+         INT64_C( 2553870517208844856),  INT64_C( 5390672836338813769),  INT64_C( 2862686722776256560), -INT64_C(  999038927868468919) },
+      {  INT64_C(                   0),  INT64_C( 6597320724604956074),  INT64_C(                   0),  INT64_C( 2204380309242278634),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 3313577327042556766) },
+      {  INT64_C(                   0),  INT64_C( 8815224522760162734),  INT64_C(                   0),  INT64_C( 8566290966460043999),
+         INT64_C(                   0),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 4458058701817845302) } },
+    { UINT8_C( 57),
+      { -INT64_C( 6149794358366383813), -INT64_C( 5906278378762954521),  INT64_C( 7873946412305232575), -INT64_C( 7470689790625722639),
+         INT64_C( 5723311247505818937),  INT64_C(  512015600282807623),  INT64_C(  691881325895943445),  INT64_C(  857082355053632219) },
+      { -INT64_C( 1204309177423478111),  INT64_C( 6167828983961365574), -INT64_C( 1121132724870824791),  INT64_C( 4826660626518229745),
+        -INT64_C( 8285192005714588592),  INT64_C( 5067340172141784066),  INT64_C( 7026890093002609204),  INT64_C( 7884605552253914967) },
+      { -INT64_C( 2008540686372908261), -INT64_C( 2035556196879879809),  INT64_C( 1828816658658473066), -INT64_C( 6687416461724841149),
+        -INT64_C( 8562658588906241436), -INT64_C(  617704165179508140),  INT64_C( 3955720038825058864), -INT64_C( 7295272456741930030) },
+      { -INT64_C( 6158784240850943967),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 4130582744270751731),
+         INT64_C( 5712547162753533725), -INT64_C( 5316997242309001453),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C( 6816110619952754276),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 4568692500148483518),
+        -INT64_C(  660135533101516833), -INT64_C(  507091814278326341),  INT64_C(                   0),  INT64_C(                   0) } },
+    { UINT8_C( 41),
+      {  INT64_C( 3964751161564474448), -INT64_C( 7873524971230539983),  INT64_C( 1357787741566457099), -INT64_C( 9159425353747027398),
+         INT64_C( 5442267936938532059),  INT64_C(  429691329692018371), -INT64_C( 1222937206066846867),  INT64_C(  618996093758526370) },
+      { -INT64_C( 8949523952559735742), -INT64_C(  469754036980529574),  INT64_C( 2884091646972728304), -INT64_C( 4875124336765338140),
+        -INT64_C( 4963108250005827899),  INT64_C( 3566174660903079858), -INT64_C( 8303524165441961341),  INT64_C( 4218120869895910177) },
+      {  INT64_C( 5694133281564879238), -INT64_C( 5838417435322484497),  INT64_C( 4766173779280281291), -INT64_C( 1503795856852855420),
+         INT64_C( 4034229273449465928), -INT64_C( 1293037918213983423), -INT64_C( 1641688880784770275), -INT64_C( 3014962396806807468) },
+      {  INT64_C( 8864386028471479764),  INT64_C(                   0),  INT64_C(                   0), -INT64_C( 4340820592946894278),
+         INT64_C(                   0), -INT64_C( 3750172526680631678),  INT64_C(                   0),  INT64_C(                   0) },
+      {  INT64_C( 8661012186719143935),  INT64_C(                   0),  INT64_C(                   0),  INT64_C( 7766139565989396415),
+         INT64_C(                   0), -INT64_C( 1443149539188583026),  INT64_C(                   0),  INT64_C(                   0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m512i a = simde_mm512_loadu_epi64(test_vec[i].a);
+    simde__m512i b = simde_mm512_loadu_epi64(test_vec[i].b);
+    simde__m512i c = simde_mm512_loadu_epi64(test_vec[i].c);
+    simde__m512i r;
+
+    r = simde_mm512_maskz_ternarylogic_epi64(test_vec[i].k, a, b, c, 0xd2);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r0));
+    r = simde_mm512_maskz_ternarylogic_epi64(test_vec[i].k, a, b, c, 0x5b);
+    simde_test_x86_assert_equal_i64x8(r, simde_mm512_loadu_epi64(test_vec[i].r1));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_ternarylogic_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_ternarylogic_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_ternarylogic_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_mask_ternarylogic_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_ternarylogic_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_maskz_ternarylogic_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_ternarylogic_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_ternarylogic_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_ternarylogic_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_mask_ternarylogic_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_ternarylogic_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_maskz_ternarylogic_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_ternarylogic_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_ternarylogic_epi32_all_imm8)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_ternarylogic_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_ternarylogic_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_ternarylogic_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_ternarylogic_epi32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm512_maskz_ternarylogic_epi64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/avx512/test-avx512-footer.h>
@@ -1,4 +1,7 @@
-#if defined(SIMDE_TEST_BARE)
+#if defined(SIMDE_BENCHMARK)
+  /* The generated benchmark (see benchmark/generate.py) includes this
+   * file for the tests and provides main() itself. */
+#elif defined(SIMDE_TEST_BARE)
   int main(void) {
     int retval = EXIT_SUCCESS;
 
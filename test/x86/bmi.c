@@ -0,0 +1,631 @@
+/* Copyright (c) 2026 agent <agent@local>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TESTS_CURRENT_ISAX bmi
+#include <simde/x86/bmi.h>
+#include <test/x86/test-x86.h>
+
+static int
+test_simde_andn_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a;
+    uint32_t b;
+    uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT32_C(     16436),
+      UINT32_C(     16436) },
+    { UINT32_C(4294967295),
+      UINT32_C(4256989184),
+      UINT32_C(         0) },
+    { UINT32_C(2743554048),
+      UINT32_C(4294967295),
+      UINT32_C(1551413247) },
+    { UINT32_C(   8388865),
+      UINT32_C(         0),
+      UINT32_C(         0) },
+    { UINT32_C(1062866975),
+      UINT32_C(4233970687),
+      UINT32_C(3221570528) },
+    { UINT32_C(2113595064),
+      UINT32_C(1434828149),
+      UINT32_C(    334149) },
+    { UINT32_C(1802586959),
+      UINT32_C(3366885913),
+      UINT32_C(2156826640) },
+    { UINT32_C(1828741485),
+      UINT32_C(2586942191),
+      UINT32_C(2452724354) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_andn_u32(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_andn_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a;
+    uint64_t b;
+    uint64_t r;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      UINT64_C(    2252901479088260),
+      UINT64_C(    2252901479088260) },
+    { UINT64_C(18446744073709551615),
+      UINT64_C(17088873601685258240),
+      UINT64_C(                   0) },
+    { UINT64_C(13726971664225271808),
+      UINT64_C(18446744073709551615),
+      UINT64_C( 4719772409484279807) },
+    { UINT64_C( 9223935125589459016),
+      UINT64_C(                   0),
+      UINT64_C(                   0) },
+    { UINT64_C( 8847197993900687350),
+      UINT64_C(10248424865629175049),
+      UINT64_C( 9527417842014633993) },
+    { UINT64_C( 6460021831952574899),
+      UINT64_C(13820421352411938592),
+      UINT64_C(11982218638623020544) },
+    { UINT64_C( 3250722106254691934),
+      UINT64_C( 6280856739192765890),
+      UINT64_C( 5918316383990575488) },
+    { UINT64_C( 3654971580302731961),
+      UINT64_C( 1704872531591826348),
+      UINT64_C(  360548006313328900) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_andn_u64(test_vec[i].a, test_vec[i].b);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_bextr_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a;
+    uint32_t start;
+    uint32_t len;
+    uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT32_C(        18),
+      UINT32_C(        24),
+      UINT32_C(         0) },
+    { UINT32_C(4294967295),
+      UINT32_C(        25),
+      UINT32_C(         4),
+      UINT32_C(        15) },
+    { UINT32_C(3187671040),
+      UINT32_C(         6),
+      UINT32_C(        14),
+      UINT32_C(         0) },
+    { UINT32_C( 136445952),
+      UINT32_C(        25),
+      UINT32_C(        31),
+      UINT32_C(         4) },
+    { UINT32_C( 808145606),
+      UINT32_C(         3),
+      UINT32_C(        23),
+      UINT32_C(    354904) },
+    { UINT32_C(2699806999),
+      UINT32_C(         5),
+      UINT32_C(         9),
+      UINT32_C(        72) },
+    { UINT32_C( 841321957),
+      UINT32_C(        38),
+      UINT32_C(         0),
+      UINT32_C(         0) },
+    { UINT32_C(4209513385),
+      UINT32_C(        14),
+      UINT32_C(       229),
+      UINT32_C(    256928) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_bextr_u32(test_vec[i].a, test_vec[i].start, test_vec[i].len);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_bextr_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a;
+    uint64_t start;
+    uint64_t len;
+    uint64_t r;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      UINT64_C(                  50),
+      UINT64_C(                  52),
+      UINT64_C(                   0) },
+    { UINT64_C(18446744073709551615),
+      UINT64_C(                  35),
+      UINT64_C(                  14),
+      UINT64_C(               16383) },
+    { UINT64_C( 3239673984328925184),
+      UINT64_C(                  48),
+      UINT64_C(                  26),
+      UINT64_C(               11509) },
+    { UINT64_C( 2883429661710221856),
+      UINT64_C(                  58),
+      UINT64_C(                  39),
+      UINT64_C(                  10) },
+    { UINT64_C(12742997632928340149),
+      UINT64_C(                   4),
+      UINT64_C(                  43),
+      UINT64_C(       3905455220107) },
+    { UINT64_C( 9164934424659965631),
+      UINT64_C(                  18),
+      UINT64_C(                  45),
+      UINT64_C(      34961450289382) },
+    { UINT64_C(17931925562706740242),
+      UINT64_C(                  66),
+      UINT64_C(                  33),
+      UINT64_C(                   0) },
+    { UINT64_C(10902059417428362418),
+      UINT64_C(                  59),
+      UINT64_C(                 191),
+      UINT64_C(                  18) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_bextr_u64(test_vec[i].a, test_vec[i].start, test_vec[i].len);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_bextr2_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a;
+    uint32_t control;
+    uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT32_C( 151459086),
+      UINT32_C(         0) },
+    { UINT32_C(4294967295),
+      UINT32_C(3509520404),
+      UINT32_C(       255) },
+    { UINT32_C(2793406464),
+      UINT32_C(1067258128),
+      UINT32_C(     42624) },
+    { UINT32_C(  35913730),
+      UINT32_C(   5837844),
+      UINT32_C(        34) },
+    { UINT32_C(1870383641),
+      UINT32_C( 915478541),
+      UINT32_C(    228318) },
+    { UINT32_C(3194760892),
+      UINT32_C(2175403009),
+      UINT32_C(        14) },
+    { UINT32_C(1818653225),
+      UINT32_C(2923369253),
+      UINT32_C(         0) },
+    { UINT32_C( 120915107),
+      UINT32_C(3828823562),
+      UINT32_C(    118081) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_bextr2_u32(test_vec[i].a, test_vec[i].control);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_bextr2_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a;
+    uint64_t control;
+    uint64_t r;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      UINT64_C(          2877438487),
+      UINT64_C(                   0) },
+    { UINT64_C(18446744073709551615),
+      UINT64_C(          3766364981),
+      UINT64_C(                2047) },
+    { UINT64_C(10489121292290621440),
+      UINT64_C(           291913756),
+      UINT64_C(         39075021789) },
+    { UINT64_C(   18718910653243392),
+      UINT64_C(          3649503753),
+      UINT64_C(                   0) },
+    { UINT64_C(  303041520188869108),
+      UINT64_C(          2092052775),
+      UINT64_C(              551229) },
+    { UINT64_C( 8258473524578350795),
+      UINT64_C(          3166307622),
+      UINT64_C(                  23) },
+    { UINT64_C( 3288861290932828483),
+      UINT64_C(          3707770433),
+      UINT64_C(                   0) },
+    { UINT64_C( 4298861702658039994),
+      UINT64_C(           416451899),
+      UINT64_C(                   7) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_bextr2_u64(test_vec[i].a, test_vec[i].control);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_blsi_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a;
+    uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT32_C(         0) },
+    { UINT32_C(4294967295),
+      UINT32_C(         1) },
+    { UINT32_C(1769400720),
+      UINT32_C(        16) },
+    { UINT32_C( 135070208),
+      UINT32_C(       512) },
+    { UINT32_C(2606201326),
+      UINT32_C(         2) },
+    { UINT32_C(2847435933),
+      UINT32_C(         1) },
+    { UINT32_C(3681262340),
+      UINT32_C(         4) },
+    { UINT32_C(1732185394),
+      UINT32_C(         2) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_blsi_u32(test_vec[i].a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_blsi_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a;
+    uint64_t r;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      UINT64_C(                   0) },
+    { UINT64_C(18446744073709551615),
+      UINT64_C(                   1) },
+    { UINT64_C(12465963768561532928),
+      UINT64_C(   72057594037927936) },
+    { UINT64_C(  720593945018008576),
+      UINT64_C(                1024) },
+    { UINT64_C(13493598889845112091),
+      UINT64_C(                   1) },
+    { UINT64_C(15205669501651205793),
+      UINT64_C(                   1) },
+    { UINT64_C( 1254228931478381724),
+      UINT64_C(                   4) },
+    { UINT64_C(13124785072394096981),
+      UINT64_C(                   1) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_blsi_u64(test_vec[i].a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_blsmsk_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a;
+    uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT32_C(4294967295) },
+    { UINT32_C(4294967295),
+      UINT32_C(         1) },
+    { UINT32_C(4194304000),
+      UINT32_C(  67108863) },
+    { UINT32_C(      2112),
+      UINT32_C(       127) },
+    { UINT32_C(2663183205),
+      UINT32_C(         1) },
+    { UINT32_C(3143103427),
+      UINT32_C(         1) },
+    { UINT32_C( 309185764),
+      UINT32_C(         7) },
+    { UINT32_C(4066160253),
+      UINT32_C(         1) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_blsmsk_u32(test_vec[i].a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_blsmsk_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a;
+    uint64_t r;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      UINT64_C(18446744073709551615) },
+    { UINT64_C(18446744073709551615),
+      UINT64_C(                   1) },
+    { UINT64_C( 2305843009213693952),
+      UINT64_C( 4611686018427387903) },
+    { UINT64_C(   27100902556975238),
+      UINT64_C(                   3) },
+    { UINT64_C(16540811394379400672),
+      UINT64_C(                  63) },
+    { UINT64_C( 1091657347331904107),
+      UINT64_C(                   1) },
+    { UINT64_C( 1268864332379618063),
+      UINT64_C(                   1) },
+    { UINT64_C(12501797836045947961),
+      UINT64_C(                   1) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_blsmsk_u64(test_vec[i].a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_blsr_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a;
+    uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT32_C(         0) },
+    { UINT32_C(4294967295),
+      UINT32_C(4294967294) },
+    { UINT32_C(2550136832),
+      UINT32_C(2415919104) },
+    { UINT32_C(  67149952),
+      UINT32_C(  67149824) },
+    { UINT32_C(  83151712),
+      UINT32_C(  83151680) },
+    { UINT32_C( 156236534),
+      UINT32_C( 156236532) },
+    { UINT32_C(2533038211),
+      UINT32_C(2533038210) },
+    { UINT32_C(2800004722),
+      UINT32_C(2800004720) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_blsr_u32(test_vec[i].a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_blsr_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a;
+    uint64_t r;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      UINT64_C(                   0) },
+    { UINT64_C(18446744073709551615),
+      UINT64_C(18446744073709551614) },
+    { UINT64_C( 2582814386296979456),
+      UINT64_C( 2580562586483294208) },
+    { UINT64_C(   36085980232426560),
+      UINT64_C(   36085980232426496) },
+    { UINT64_C( 2071258549847661058),
+      UINT64_C( 2071258549847661056) },
+    { UINT64_C( 1961148765367208118),
+      UINT64_C( 1961148765367208116) },
+    { UINT64_C( 9668988672719762471),
+      UINT64_C( 9668988672719762470) },
+    { UINT64_C( 6957744617404376207),
+      UINT64_C( 6957744617404376206) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_blsr_u64(test_vec[i].a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_tzcnt_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a;
+    uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT32_C(        32) },
+    { UINT32_C(4294967295),
+      UINT32_C(         0) },
+    { UINT32_C(4160749568),
+      UINT32_C(        27) },
+    { UINT32_C(1896349700),
+      UINT32_C(         2) },
+    { UINT32_C(2303592213),
+      UINT32_C(         0) },
+    { UINT32_C(2441739867),
+      UINT32_C(         0) },
+    { UINT32_C(2983205735),
+      UINT32_C(         0) },
+    { UINT32_C(2331738769),
+      UINT32_C(         0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_tzcnt_u32(test_vec[i].a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_tzcnt_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a;
+    uint64_t r;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      UINT64_C(                  64) },
+    { UINT64_C(18446744073709551615),
+      UINT64_C(                   0) },
+    { UINT64_C( 6348219498964713472),
+      UINT64_C(                  43) },
+    { UINT64_C(      72740673421760),
+      UINT64_C(                   6) },
+    { UINT64_C( 7742341921735941116),
+      UINT64_C(                   2) },
+    { UINT64_C( 8568031992945163211),
+      UINT64_C(                   0) },
+    { UINT64_C(13758330608210506364),
+      UINT64_C(                   2) },
+    { UINT64_C(11374910249323456408),
+      UINT64_C(                   3) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_tzcnt_u64(test_vec[i].a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_lzcnt_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a;
+    uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT32_C(        32) },
+    { UINT32_C(    131071),
+      UINT32_C(        15) },
+    { UINT32_C(    131072),
+      UINT32_C(        14) },
+    { UINT32_C(        64),
+      UINT32_C(        25) },
+    { UINT32_C(        44),
+      UINT32_C(        26) },
+    { UINT32_C( 410638585),
+      UINT32_C(         3) },
+    { UINT32_C(1720526090),
+      UINT32_C(         1) },
+    { UINT32_C( 188030395),
+      UINT32_C(         4) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_lzcnt_u32(test_vec[i].a);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_lzcnt_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a;
+    uint64_t r;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      UINT64_C(                  64) },
+    { UINT64_C(               16383),
+      UINT64_C(                  50) },
+    { UINT64_C(    6840361443917824),
+      UINT64_C(                  11) },
+    { UINT64_C(     133062793445378),
+      UINT64_C(                  17) },
+    { UINT64_C(       1581868855353),
+      UINT64_C(                  23) },
+    { UINT64_C(       4172912387169),
+      UINT64_C(                  22) },
+    { UINT64_C(      43931906741247),
+      UINT64_C(                  18) },
+    { UINT64_C(                   1),
+      UINT64_C(                  63) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_lzcnt_u64(test_vec[i].a);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(andn_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(andn_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(bextr_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(bextr_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(bextr2_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(bextr2_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(blsi_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(blsi_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(blsmsk_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(blsmsk_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(blsr_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(blsr_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(tzcnt_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(tzcnt_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(lzcnt_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(lzcnt_u64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/test-x86-footer.h>
@@ -0,0 +1,389 @@
+/* Copyright (c) 2026 agent <agent@local>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TESTS_CURRENT_ISAX bmi2
+#include <simde/x86/bmi2.h>
+#include <test/x86/test-x86.h>
+
+static int
+test_simde_bzhi_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a;
+    uint32_t index;
+    uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT32_C(         0),
+      UINT32_C(         0) },
+    { UINT32_C(4294967295),
+      UINT32_C(        12),
+      UINT32_C(      4095) },
+    { UINT32_C(3623878656),
+      UINT32_C(         4),
+      UINT32_C(         0) },
+    { UINT32_C(   4194442),
+      UINT32_C(         4),
+      UINT32_C(        10) },
+    { UINT32_C(1456938755),
+      UINT32_C(        10),
+      UINT32_C(       771) },
+    { UINT32_C(3594223774),
+      UINT32_C(        23),
+      UINT32_C(   3899550) },
+    { UINT32_C(4233970687),
+      UINT32_C(        92),
+      UINT32_C(4233970687) },
+    { UINT32_C(1434828149),
+      UINT32_C(1802586905),
+      UINT32_C(  25542005) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_bzhi_u32(test_vec[i].a, test_vec[i].index);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_bzhi_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a;
+    uint32_t index;
+    uint64_t r;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      UINT32_C(        22),
+      UINT64_C(                   0) },
+    { UINT64_C(18446744073709551615),
+      UINT32_C(        18),
+      UINT64_C(              262143) },
+    { UINT64_C(15546650007896588288),
+      UINT32_C(        28),
+      UINT64_C(                   0) },
+    { UINT64_C(           134283309),
+      UINT32_C(        15),
+      UINT64_C(                  45) },
+    { UINT64_C(14751663867370731509),
+      UINT32_C(        20),
+      UINT64_C(              587765) },
+    { UINT64_C(12734651306919198956),
+      UINT32_C(        48),
+      UINT64_C(     160410575700204) },
+    { UINT64_C( 3887457160061030994),
+      UINT32_C(       114),
+      UINT64_C( 3887457160061030994) },
+    { UINT64_C(10248424865629175049),
+      UINT32_C( 650979616),
+      UINT64_C(          3877338377) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_bzhi_u64(test_vec[i].a, test_vec[i].index);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mulx_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a;
+    uint32_t b;
+    uint32_t r;
+    uint32_t hi;
+  } test_vec[] = {
+    { UINT32_C(         0),
+      UINT32_C(4294967295),
+      UINT32_C(         0),
+      UINT32_C(         0) },
+    { UINT32_C(4294967295),
+      UINT32_C(1610612736),
+      UINT32_C(2684354560),
+      UINT32_C(1610612735) },
+    { UINT32_C(1979334656),
+      UINT32_C(     32800),
+      UINT32_C(3746037760),
+      UINT32_C(     15115) },
+    { UINT32_C(   2163200),
+      UINT32_C(1232027922),
+      UINT32_C(1104421888),
+      UINT32_C(    620522) },
+    { UINT32_C( 707762960),
+      UINT32_C(1320353830),
+      UINT32_C(2403402848),
+      UINT32_C( 217579662) },
+    { UINT32_C(4255559590),
+      UINT32_C( 720423801),
+      UINT32_C(4172392310),
+      UINT32_C( 713813680) },
+    { UINT32_C( 279368879),
+      UINT32_C( 808145606),
+      UINT32_C(3666709850),
+      UINT32_C(  52566344) },
+    { UINT32_C(1828812259),
+      UINT32_C(         0),
+      UINT32_C(         0),
+      UINT32_C(         0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t hi;
+    uint32_t r = simde_mulx_u32(test_vec[i].a, test_vec[i].b, &hi);
+    simde_assert_equal_u32(r, test_vec[i].r);
+    simde_assert_equal_u32(hi, test_vec[i].hi);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mulx_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a;
+    uint64_t b;
+    uint64_t r;
+    uint64_t hi;
+  } test_vec[] = {
+    { UINT64_C(                   0),
+      UINT64_C(18446744073709551615),
+      UINT64_C(                   0),
+      UINT64_C(                   0) },
+    { UINT64_C(18446744073709551615),
+      UINT64_C( 4611686018427387904),
+      UINT64_C(13835058055282163712),
+      UINT64_C( 4611686018427387903) },
+    { UINT64_C(14404765607167787008),
+      UINT64_C( 4972255468291360776),
+      UINT64_C( 9173850033139744768),
+      UINT64_C( 3882754283005134965) },
+    { UINT64_C(     589417790062592),
+      UINT64_C( 5231492893918074467),
+      UINT64_C(16436419466358210560),
+      UINT64_C(     167158766226719) },
+    { UINT64_C( 1591578775291003279),
+      UINT64_C(14660564997522229580),
+      UINT64_C(11826250822126271860),
+      UINT64_C( 1264908538362907810) },
+    { UINT64_C( 2410364264293791582),
+      UINT64_C( 2927869968072699184),
+      UINT64_C(17100284616502044576),
+      UINT64_C(  382573375189796457) },
+    { UINT64_C(  525849917905674986),
+      UINT64_C(13746226918342493999),
+      UINT64_C(12996473083604651766),
+      UINT64_C(  391855184179913278) },
+    { UINT64_C(17941496585894151137),
+      UINT64_C(                   0),
+      UINT64_C(                   0),
+      UINT64_C(                   0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t hi;
+    uint64_t r = simde_mulx_u64(test_vec[i].a, test_vec[i].b, &hi);
+    simde_assert_equal_u64(r, test_vec[i].r);
+    simde_assert_equal_u64(hi, test_vec[i].hi);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_pdep_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a;
+    uint32_t mask;
+    uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(4282384384),
+      UINT32_C(4099299509),
+      UINT32_C(         0) },
+    { UINT32_C(   8519684),
+      UINT32_C(         0),
+      UINT32_C(         0) },
+    { UINT32_C(         0),
+      UINT32_C(4294967295),
+      UINT32_C(         0) },
+    { UINT32_C(4294967295),
+      UINT32_C( 268697650),
+      UINT32_C( 268697650) },
+    { UINT32_C(2236843071),
+      UINT32_C(4280284911),
+      UINT32_C(1411129455) },
+    { UINT32_C(1518602503),
+      UINT32_C(3954811093),
+      UINT32_C(   8912917) },
+    { UINT32_C(3920905940),
+      UINT32_C(2065570649),
+      UINT32_C( 135010576) },
+    { UINT32_C(2002506031),
+      UINT32_C(3288255821),
+      UINT32_C(2211480653) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_pdep_u32(test_vec[i].a, test_vec[i].mask);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_pdep_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a;
+    uint64_t mask;
+    uint64_t r;
+  } test_vec[] = {
+    { UINT64_C(15244327731364036608),
+      UINT64_C( 4631971466614610795),
+      UINT64_C(   20283796683227136) },
+    { UINT64_C( 2310346608843423744),
+      UINT64_C(                   0),
+      UINT64_C(                   0) },
+    { UINT64_C(                   0),
+      UINT64_C(18446744073709551615),
+      UINT64_C(                   0) },
+    { UINT64_C(18446744073709551615),
+      UINT64_C(  164831722310373768),
+      UINT64_C(  164831722310373768) },
+    { UINT64_C( 1112812326568736401),
+      UINT64_C(13688373720290090483),
+      UINT64_C( 9238169288199001153) },
+    { UINT64_C( 7548767599143453098),
+      UINT64_C(11659077361221399081),
+      UINT64_C(11549856186447045128) },
+    { UINT64_C(10740066369706726541),
+      UINT64_C( 4557153255466823140),
+      UINT64_C( 3106991424207593668) },
+    { UINT64_C(13324007314120945215),
+      UINT64_C( 7535351547781514403),
+      UINT64_C( 7499199309104088227) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_pdep_u64(test_vec[i].a, test_vec[i].mask);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_pext_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a;
+    uint32_t mask;
+    uint32_t r;
+  } test_vec[] = {
+    { UINT32_C( 243899008),
+      UINT32_C(3072255031),
+      UINT32_C(     51456) },
+    { UINT32_C(   1052676),
+      UINT32_C(         0),
+      UINT32_C(         0) },
+    { UINT32_C(         0),
+      UINT32_C(4294967295),
+      UINT32_C(         0) },
+    { UINT32_C(4294967295),
+      UINT32_C( 336406034),
+      UINT32_C(      1023) },
+    { UINT32_C( 956107164),
+      UINT32_C(3069571558),
+      UINT32_C(    850994) },
+    { UINT32_C(1997779461),
+      UINT32_C( 756266017),
+      UINT32_C(      6137) },
+    { UINT32_C(2201139977),
+      UINT32_C(3850714175),
+      UINT32_C(    140169) },
+    { UINT32_C( 898161031),
+      UINT32_C( 856508916),
+      UINT32_C(     27889) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_pext_u32(test_vec[i].a, test_vec[i].mask);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_pext_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a;
+    uint64_t mask;
+    uint64_t r;
+  } test_vec[] = {
+    { UINT64_C( 4035225266123964416),
+      UINT64_C( 7611325403154840754),
+      UINT64_C(           805306368) },
+    { UINT64_C( 4648031475922469056),
+      UINT64_C(                   0),
+      UINT64_C(                   0) },
+    { UINT64_C(                   0),
+      UINT64_C(18446744073709551615),
+      UINT64_C(                   0) },
+    { UINT64_C(18446744073709551615),
+      UINT64_C(    2402849792467002),
+      UINT64_C(               65535) },
+    { UINT64_C(14389519165037230077),
+      UINT64_C( 8060836324110434151),
+      UINT64_C(      43602344986365) },
+    { UINT64_C(13049012401391234713),
+      UINT64_C(  295199364223780356),
+      UINT64_C(            13399214) },
+    { UINT64_C(11925851817783538312),
+      UINT64_C(17414466658807664365),
+      UINT64_C(         23088241764) },
+    { UINT64_C( 4443866089497915184),
+      UINT64_C( 6182133769069623790),
+      UINT64_C(        132967149256) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint64_t r = simde_pext_u64(test_vec[i].a, test_vec[i].mask);
+    simde_assert_equal_u64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(bzhi_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(bzhi_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mulx_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mulx_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(pdep_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(pdep_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(pext_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(pext_u64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/test-x86-footer.h>
@@ -0,0 +1,297 @@
+/* Copyright (c) 2026 agent <agent@local>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TESTS_CURRENT_ISAX f16c
+#include <simde/x86/f16c.h>
+#include <test/x86/test-avx.h>
+
+static int
+test_simde_mm_cvtph_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint16_t a[8];
+    const simde_float32 r[4];
+  } test_vec[] = {
+    { { UINT16_C(50726), UINT16_C(36465), UINT16_C(35633), UINT16_C(31743), UINT16_C( 1007), UINT16_C(26994), UINT16_C(49775), UINT16_C(28459) },
+      { SIMDE_FLOAT32_C(     -6.1484375), SIMDE_FLOAT32_C(-0.000393152237), SIMDE_FLOAT32_C(-0.000219464302), SIMDE_FLOAT32_C(        65504.0) } },
+    { { UINT16_C(24588), UINT16_C(56680), UINT16_C(    0), UINT16_C(36153), UINT16_C(64724), UINT16_C(20501), UINT16_C(26490), UINT16_C( 1613) },
+      { SIMDE_FLOAT32_C(          518.0), SIMDE_FLOAT32_C(         -346.0), SIMDE_FLOAT32_C(            0.0), SIMDE_FLOAT32_C( -0.00031876564) } },
+    { { UINT16_C(46665), UINT16_C(19936), UINT16_C( 1840), UINT16_C(    0), UINT16_C(31744), UINT16_C(17250), UINT16_C( 8729), UINT16_C(64511) },
+      { SIMDE_FLOAT32_C(   -0.392822266), SIMDE_FLOAT32_C(           23.5), SIMDE_FLOAT32_C( 0.000109672546), SIMDE_FLOAT32_C(            0.0) } },
+    { { UINT16_C(64694), UINT16_C(64511), UINT16_C(32265), UINT16_C(    0), UINT16_C(34552), UINT16_C(26440), UINT16_C(35845), UINT16_C(64511) },
+      {           -SIMDE_MATH_NANF, SIMDE_FLOAT32_C(       -65504.0),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(            0.0) } },
+    { { UINT16_C(  365), UINT16_C(65354), UINT16_C(31744), UINT16_C(60655), UINT16_C(28215), UINT16_C(54186), UINT16_C(33592), UINT16_C(64977) },
+      { SIMDE_FLOAT32_C( 2.17556953e-05),           -SIMDE_MATH_NANF,        SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(        -5052.0) } },
+    { { UINT16_C(64519), UINT16_C(60579), UINT16_C(    0), UINT16_C(31744), UINT16_C( 4523), UINT16_C(32768), UINT16_C(32768), UINT16_C(31744) },
+      {           -SIMDE_MATH_NANF, SIMDE_FLOAT32_C(        -4748.0), SIMDE_FLOAT32_C(            0.0),        SIMDE_MATH_INFINITYF } },
+    { { UINT16_C(32752), UINT16_C(42621), UINT16_C(38008), UINT16_C(32567), UINT16_C(64511), UINT16_C(38978), UINT16_C(64511), UINT16_C(62679) },
+      {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -0.0253448486), SIMDE_FLOAT32_C( -0.00109100342),            SIMDE_MATH_NANF } },
+    { { UINT16_C(64462), UINT16_C(60833), UINT16_C(31743), UINT16_C(65079), UINT16_C( 3793), UINT16_C( 5408), UINT16_C(64512), UINT16_C(32715) },
+      { SIMDE_FLOAT32_C(       -63936.0), SIMDE_FLOAT32_C(        -5764.0), SIMDE_FLOAT32_C(        65504.0),           -SIMDE_MATH_NANF } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m128 r = simde_mm_cvtph_ps(a);
+    simde_test_x86_assert_equal_f32x4(r, simde_mm_loadu_ps(test_vec[i].r), 9);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_cvtph_ps (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint16_t a[8];
+    const simde_float32 r[8];
+  } test_vec[] = {
+    { { UINT16_C(50726), UINT16_C(36465), UINT16_C(35633), UINT16_C(31743), UINT16_C( 1007), UINT16_C(26994), UINT16_C(49775), UINT16_C(28459) },
+      { SIMDE_FLOAT32_C(     -6.1484375), SIMDE_FLOAT32_C(-0.000393152237), SIMDE_FLOAT32_C(-0.000219464302), SIMDE_FLOAT32_C(        65504.0),
+        SIMDE_FLOAT32_C( 6.00218773e-05), SIMDE_FLOAT32_C(         2788.0), SIMDE_FLOAT32_C(    -3.21679688), SIMDE_FLOAT32_C(         7340.0) } },
+    { { UINT16_C(24588), UINT16_C(56680), UINT16_C(    0), UINT16_C(36153), UINT16_C(64724), UINT16_C(20501), UINT16_C(26490), UINT16_C( 1613) },
+      { SIMDE_FLOAT32_C(          518.0), SIMDE_FLOAT32_C(         -346.0), SIMDE_FLOAT32_C(            0.0), SIMDE_FLOAT32_C( -0.00031876564),
+                  -SIMDE_MATH_NANF, SIMDE_FLOAT32_C(       32.65625), SIMDE_FLOAT32_C(         1914.0), SIMDE_FLOAT32_C(  9.6142292e-05) } },
+    { { UINT16_C(46665), UINT16_C(19936), UINT16_C( 1840), UINT16_C(    0), UINT16_C(31744), UINT16_C(17250), UINT16_C( 8729), UINT16_C(64511) },
+      { SIMDE_FLOAT32_C(   -0.392822266), SIMDE_FLOAT32_C(           23.5), SIMDE_FLOAT32_C( 0.000109672546), SIMDE_FLOAT32_C(            0.0),
+               SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(     3.69140625), SIMDE_FLOAT32_C(   0.0119094849), SIMDE_FLOAT32_C(       -65504.0) } },
+    { { UINT16_C(64694), UINT16_C(64511), UINT16_C(32265), UINT16_C(    0), UINT16_C(34552), UINT16_C(26440), UINT16_C(35845), UINT16_C(64511) },
+      {           -SIMDE_MATH_NANF, SIMDE_FLOAT32_C(       -65504.0),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(            0.0),
+        SIMDE_FLOAT32_C(-0.000106334686), SIMDE_FLOAT32_C(         1864.0), SIMDE_FLOAT32_C(-0.000245332718), SIMDE_FLOAT32_C(       -65504.0) } },
+    { { UINT16_C(  365), UINT16_C(65354), UINT16_C(31744), UINT16_C(60655), UINT16_C(28215), UINT16_C(54186), UINT16_C(33592), UINT16_C(64977) },
+      { SIMDE_FLOAT32_C( 2.17556953e-05),           -SIMDE_MATH_NANF,        SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(        -5052.0),
+        SIMDE_FLOAT32_C(         6364.0), SIMDE_FLOAT32_C(       -61.3125), SIMDE_FLOAT32_C(-4.91142273e-05),           -SIMDE_MATH_NANF } },
+    { { UINT16_C(64519), UINT16_C(60579), UINT16_C(    0), UINT16_C(31744), UINT16_C( 4523), UINT16_C(32768), UINT16_C(32768), UINT16_C(31744) },
+      {           -SIMDE_MATH_NANF, SIMDE_FLOAT32_C(        -4748.0), SIMDE_FLOAT32_C(            0.0),        SIMDE_MATH_INFINITYF,
+        SIMDE_FLOAT32_C( 0.000691890717), SIMDE_FLOAT32_C(           -0.0), SIMDE_FLOAT32_C(           -0.0),        SIMDE_MATH_INFINITYF } },
+    { { UINT16_C(32752), UINT16_C(42621), UINT16_C(38008), UINT16_C(32567), UINT16_C(64511), UINT16_C(38978), UINT16_C(64511), UINT16_C(62679) },
+      {            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -0.0253448486), SIMDE_FLOAT32_C( -0.00109100342),            SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C(       -65504.0), SIMDE_FLOAT32_C( -0.00207901001), SIMDE_FLOAT32_C(       -65504.0), SIMDE_FLOAT32_C(       -19824.0) } },
+    { { UINT16_C(64462), UINT16_C(60833), UINT16_C(31743), UINT16_C(65079), UINT16_C( 3793), UINT16_C( 5408), UINT16_C(64512), UINT16_C(32715) },
+      { SIMDE_FLOAT32_C(       -63936.0), SIMDE_FLOAT32_C(        -5764.0), SIMDE_FLOAT32_C(        65504.0),           -SIMDE_MATH_NANF,
+        SIMDE_FLOAT32_C( 0.000416040421), SIMDE_FLOAT32_C(   0.0012512207),       -SIMDE_MATH_INFINITYF,            SIMDE_MATH_NANF } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_mm_loadu_si128(test_vec[i].a);
+    simde__m256 r = simde_mm256_cvtph_ps(a);
+    simde_test_x86_assert_equal_f32x8(r, simde_mm256_loadu_ps(test_vec[i].r), 9);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_cvtps_ph (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[4];
+    const uint16_t nearest[8];
+    const uint16_t down[8];
+    const uint16_t up[8];
+    const uint16_t zero[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(    -4.72731304), SIMDE_FLOAT32_C(-0.000467497419), SIMDE_FLOAT32_C(-0.000172433225), SIMDE_FLOAT32_C(     65526.7344) },
+      { UINT16_C(50362), UINT16_C(36777), UINT16_C(35238), UINT16_C(31744), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(50363), UINT16_C(36777), UINT16_C(35239), UINT16_C(31743), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(50362), UINT16_C(36776), UINT16_C(35238), UINT16_C(31744), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(50362), UINT16_C(36776), UINT16_C(35238), UINT16_C(31743), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(  0.00861424953), SIMDE_FLOAT32_C(           -0.0), SIMDE_FLOAT32_C(    -11876.8867), SIMDE_FLOAT32_C(    -65531.6328) },
+      { UINT16_C( 8297), UINT16_C(32768), UINT16_C(61901), UINT16_C(64512), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C( 8297), UINT16_C(32768), UINT16_C(61901), UINT16_C(64512), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C( 8298), UINT16_C(32768), UINT16_C(61900), UINT16_C(64511), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C( 8297), UINT16_C(32768), UINT16_C(61900), UINT16_C(64511), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { {        SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(     26369.3125), SIMDE_FLOAT32_C(    0.141563386), SIMDE_FLOAT32_C( 5.74863637e-39) },
+      { UINT16_C(31744), UINT16_C(30320), UINT16_C(12424), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(31744), UINT16_C(30320), UINT16_C(12423), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(31744), UINT16_C(30321), UINT16_C(12424), UINT16_C(    1), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(31744), UINT16_C(30320), UINT16_C(12423), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(           -0.0), SIMDE_FLOAT32_C(           -0.0), SIMDE_FLOAT32_C( 2.26908757e-39), SIMDE_FLOAT32_C(     -59.890625) },
+      { UINT16_C(32768), UINT16_C(32768), UINT16_C(    0), UINT16_C(54140), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(32768), UINT16_C(32768), UINT16_C(    0), UINT16_C(54141), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(32768), UINT16_C(32768), UINT16_C(    1), UINT16_C(54140), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(32768), UINT16_C(32768), UINT16_C(    0), UINT16_C(54140), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(     3914.86523), SIMDE_FLOAT32_C(   0.0749767795), SIMDE_FLOAT32_C(    -74433.3438), SIMDE_FLOAT32_C(    -15.6066856) },
+      { UINT16_C(27557), UINT16_C(11468), UINT16_C(64512), UINT16_C(52174), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(27557), UINT16_C(11468), UINT16_C(64512), UINT16_C(52174), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(27558), UINT16_C(11469), UINT16_C(64511), UINT16_C(52173), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(27557), UINT16_C(11468), UINT16_C(64511), UINT16_C(52173), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(   0.0149885407), SIMDE_FLOAT32_C(           -0.0), SIMDE_FLOAT32_C( 8.45126187e-39), SIMDE_FLOAT32_C( -0.00445066998) },
+      { UINT16_C( 9133), UINT16_C(32768), UINT16_C(    0), UINT16_C(40079), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C( 9132), UINT16_C(32768), UINT16_C(    0), UINT16_C(40079), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C( 9133), UINT16_C(32768), UINT16_C(    1), UINT16_C(40078), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C( 9132), UINT16_C(32768), UINT16_C(    0), UINT16_C(40078), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(  -0.0015595099), SIMDE_FLOAT32_C( 6.49858469e-39), SIMDE_FLOAT32_C( -0.00282971817), SIMDE_FLOAT32_C(     1512.18372) },
+      { UINT16_C(38499), UINT16_C(    0), UINT16_C(39372), UINT16_C(26088), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(38500), UINT16_C(    0), UINT16_C(39372), UINT16_C(26088), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(38499), UINT16_C(    1), UINT16_C(39371), UINT16_C(26089), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C(38499), UINT16_C(    0), UINT16_C(39371), UINT16_C(26088), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } },
+    { { SIMDE_FLOAT32_C(  0.00060455309), SIMDE_FLOAT32_C(     1.02396035),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   1.719594e-05) },
+      { UINT16_C( 4340), UINT16_C(15385), UINT16_C(32256), UINT16_C(  288), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C( 4339), UINT16_C(15384), UINT16_C(32256), UINT16_C(  288), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C( 4340), UINT16_C(15385), UINT16_C(32256), UINT16_C(  289), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) },
+      { UINT16_C( 4339), UINT16_C(15384), UINT16_C(32256), UINT16_C(  288), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0), UINT16_C(    0) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128 a = simde_mm_loadu_ps(test_vec[i].a);
+    simde_test_x86_assert_equal_u16x8(simde_mm_cvtps_ph(a, SIMDE_MM_FROUND_TO_NEAREST_INT), simde_mm_loadu_si128(test_vec[i].nearest));
+    simde_test_x86_assert_equal_u16x8(simde_mm_cvtps_ph(a, SIMDE_MM_FROUND_TO_NEG_INF), simde_mm_loadu_si128(test_vec[i].down));
+    simde_test_x86_assert_equal_u16x8(simde_mm_cvtps_ph(a, SIMDE_MM_FROUND_TO_POS_INF), simde_mm_loadu_si128(test_vec[i].up));
+    simde_test_x86_assert_equal_u16x8(simde_mm_cvtps_ph(a, SIMDE_MM_FROUND_TO_ZERO), simde_mm_loadu_si128(test_vec[i].zero));
+    simde_test_x86_assert_equal_u16x8(simde_mm_cvtps_ph(a, SIMDE_MM_FROUND_CUR_DIRECTION), simde_mm_loadu_si128(test_vec[i].nearest));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm256_cvtps_ph (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a[8];
+    const uint16_t nearest[8];
+    const uint16_t down[8];
+    const uint16_t up[8];
+    const uint16_t zero[8];
+  } test_vec[] = {
+    { { SIMDE_FLOAT32_C(    -4.72731304), SIMDE_FLOAT32_C(-0.000467497419), SIMDE_FLOAT32_C(-0.000172433225), SIMDE_FLOAT32_C(     65526.7344),
+        SIMDE_FLOAT32_C(           -0.0),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     57284.8555), SIMDE_FLOAT32_C(-9.55168894e-39) },
+      { UINT16_C(50362), UINT16_C(36777), UINT16_C(35238), UINT16_C(31744), UINT16_C(32768), UINT16_C(32256), UINT16_C(31486), UINT16_C(32768) },
+      { UINT16_C(50363), UINT16_C(36777), UINT16_C(35239), UINT16_C(31743), UINT16_C(32768), UINT16_C(32256), UINT16_C(31486), UINT16_C(32769) },
+      { UINT16_C(50362), UINT16_C(36776), UINT16_C(35238), UINT16_C(31744), UINT16_C(32768), UINT16_C(32256), UINT16_C(31487), UINT16_C(32768) },
+      { UINT16_C(50362), UINT16_C(36776), UINT16_C(35238), UINT16_C(31743), UINT16_C(32768), UINT16_C(32256), UINT16_C(31486), UINT16_C(32768) } },
+    { { SIMDE_FLOAT32_C(  0.00861424953), SIMDE_FLOAT32_C(           -0.0), SIMDE_FLOAT32_C(    -11876.8867), SIMDE_FLOAT32_C(    -65531.6328),
+        SIMDE_FLOAT32_C(-9.27389133e-39), SIMDE_FLOAT32_C(-3.74790026e-39), SIMDE_FLOAT32_C(           -0.0), SIMDE_FLOAT32_C(     -33.806366) },
+      { UINT16_C( 8297), UINT16_C(32768), UINT16_C(61901), UINT16_C(64512), UINT16_C(32768), UINT16_C(32768), UINT16_C(32768), UINT16_C(53306) },
+      { UINT16_C( 8297), UINT16_C(32768), UINT16_C(61901), UINT16_C(64512), UINT16_C(32769), UINT16_C(32769), UINT16_C(32768), UINT16_C(53306) },
+      { UINT16_C( 8298), UINT16_C(32768), UINT16_C(61900), UINT16_C(64511), UINT16_C(32768), UINT16_C(32768), UINT16_C(32768), UINT16_C(53305) },
+      { UINT16_C( 8297), UINT16_C(32768), UINT16_C(61900), UINT16_C(64511), UINT16_C(32768), UINT16_C(32768), UINT16_C(32768), UINT16_C(53305) } },
+    { {        SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(     26369.3125), SIMDE_FLOAT32_C(    0.141563386), SIMDE_FLOAT32_C( 5.74863637e-39),
+        SIMDE_FLOAT32_C(     34887.0234), SIMDE_FLOAT32_C(            0.0), SIMDE_FLOAT32_C( 1.07936752e-38), SIMDE_FLOAT32_C(    -4.88204527) },
+      { UINT16_C(31744), UINT16_C(30320), UINT16_C(12424), UINT16_C(    0), UINT16_C(30786), UINT16_C(    0), UINT16_C(    0), UINT16_C(50402) },
+      { UINT16_C(31744), UINT16_C(30320), UINT16_C(12423), UINT16_C(    0), UINT16_C(30786), UINT16_C(    0), UINT16_C(    0), UINT16_C(50402) },
+      { UINT16_C(31744), UINT16_C(30321), UINT16_C(12424), UINT16_C(    1), UINT16_C(30787), UINT16_C(    0), UINT16_C(    1), UINT16_C(50401) },
+      { UINT16_C(31744), UINT16_C(30320), UINT16_C(12423), UINT16_C(    0), UINT16_C(30786), UINT16_C(    0), UINT16_C(    0), UINT16_C(50401) } },
+    { { SIMDE_FLOAT32_C(           -0.0), SIMDE_FLOAT32_C(           -0.0), SIMDE_FLOAT32_C( 2.26908757e-39), SIMDE_FLOAT32_C(     -59.890625),
+        SIMDE_FLOAT32_C(-2.50157001e-07), SIMDE_FLOAT32_C(     50046.7852), SIMDE_FLOAT32_C( 3.45408916e-05), SIMDE_FLOAT32_C( 0.000425215432) },
+      { UINT16_C(32768), UINT16_C(32768), UINT16_C(    0), UINT16_C(54140), UINT16_C(32772), UINT16_C(31260), UINT16_C(  580), UINT16_C( 3831) },
+      { UINT16_C(32768), UINT16_C(32768), UINT16_C(    0), UINT16_C(54141), UINT16_C(32773), UINT16_C(31259), UINT16_C(  579), UINT16_C( 3831) },
+      { UINT16_C(32768), UINT16_C(32768), UINT16_C(    1), UINT16_C(54140), UINT16_C(32772), UINT16_C(31260), UINT16_C(  580), UINT16_C( 3832) },
+      { UINT16_C(32768), UINT16_C(32768), UINT16_C(    0), UINT16_C(54140), UINT16_C(32772), UINT16_C(31259), UINT16_C(  579), UINT16_C( 3831) } },
+    { { SIMDE_FLOAT32_C(     3914.86523), SIMDE_FLOAT32_C(   0.0749767795), SIMDE_FLOAT32_C(    -74433.3438), SIMDE_FLOAT32_C(    -15.6066856),
+        SIMDE_FLOAT32_C(    -24.0146904), SIMDE_FLOAT32_C(     42585.9023), SIMDE_FLOAT32_C(   0.0508720577), SIMDE_FLOAT32_C(        -940.75) },
+      { UINT16_C(27557), UINT16_C(11468), UINT16_C(64512), UINT16_C(52174), UINT16_C(52737), UINT16_C(31027), UINT16_C(10883), UINT16_C(58202) },
+      { UINT16_C(27557), UINT16_C(11468), UINT16_C(64512), UINT16_C(52174), UINT16_C(52737), UINT16_C(31026), UINT16_C(10882), UINT16_C(58202) },
+      { UINT16_C(27558), UINT16_C(11469), UINT16_C(64511), UINT16_C(52173), UINT16_C(52736), UINT16_C(31027), UINT16_C(10883), UINT16_C(58201) },
+      { UINT16_C(27557), UINT16_C(11468), UINT16_C(64511), UINT16_C(52173), UINT16_C(52736), UINT16_C(31026), UINT16_C(10882), UINT16_C(58201) } },
+    { { SIMDE_FLOAT32_C(   0.0149885407), SIMDE_FLOAT32_C(           -0.0), SIMDE_FLOAT32_C( 8.45126187e-39), SIMDE_FLOAT32_C( -0.00445066998),
+        SIMDE_FLOAT32_C(   -0.179685399), SIMDE_FLOAT32_C( 9.47921289e-05), SIMDE_FLOAT32_C(           -0.0), SIMDE_FLOAT32_C(    -198297.953) },
+      { UINT16_C( 9133), UINT16_C(32768), UINT16_C(    0), UINT16_C(40079), UINT16_C(45504), UINT16_C( 1590), UINT16_C(32768), UINT16_C(64512) },
+      { UINT16_C( 9132), UINT16_C(32768), UINT16_C(    0), UINT16_C(40079), UINT16_C(45504), UINT16_C( 1590), UINT16_C(32768), UINT16_C(64512) },
+      { UINT16_C( 9133), UINT16_C(32768), UINT16_C(    1), UINT16_C(40078), UINT16_C(45503), UINT16_C( 1591), UINT16_C(32768), UINT16_C(64511) },
+      { UINT16_C( 9132), UINT16_C(32768), UINT16_C(    0), UINT16_C(40078), UINT16_C(45503), UINT16_C( 1590), UINT16_C(32768), UINT16_C(64511) } },
+    { { SIMDE_FLOAT32_C(  -0.0015595099), SIMDE_FLOAT32_C( 6.49858469e-39), SIMDE_FLOAT32_C( -0.00282971817), SIMDE_FLOAT32_C(     1512.18372),
+                  -SIMDE_MATH_NANF, SIMDE_FLOAT32_C(           -0.0), SIMDE_FLOAT32_C(    -34839.8047), SIMDE_FLOAT32_C(-1.40831435e-15) },
+      { UINT16_C(38499), UINT16_C(    0), UINT16_C(39372), UINT16_C(26088), UINT16_C(65024), UINT16_C(32768), UINT16_C(63553), UINT16_C(32768) },
+      { UINT16_C(38500), UINT16_C(    0), UINT16_C(39372), UINT16_C(26088), UINT16_C(65024), UINT16_C(32768), UINT16_C(63553), UINT16_C(32769) },
+      { UINT16_C(38499), UINT16_C(    1), UINT16_C(39371), UINT16_C(26089), UINT16_C(65024), UINT16_C(32768), UINT16_C(63552), UINT16_C(32768) },
+      { UINT16_C(38499), UINT16_C(    0), UINT16_C(39371), UINT16_C(26088), UINT16_C(65024), UINT16_C(32768), UINT16_C(63552), UINT16_C(32768) } },
+    { { SIMDE_FLOAT32_C(  0.00060455309), SIMDE_FLOAT32_C(     1.02396035),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(   1.719594e-05),
+              -SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(     17544.3379), SIMDE_FLOAT32_C( 0.000112265348), SIMDE_FLOAT32_C(-0.000165365389) },
+      { UINT16_C( 4340), UINT16_C(15385), UINT16_C(32256), UINT16_C(  288), UINT16_C(64512), UINT16_C(29769), UINT16_C( 1884), UINT16_C(35179) },
+      { UINT16_C( 4339), UINT16_C(15384), UINT16_C(32256), UINT16_C(  288), UINT16_C(64512), UINT16_C(29768), UINT16_C( 1883), UINT16_C(35180) },
+      { UINT16_C( 4340), UINT16_C(15385), UINT16_C(32256), UINT16_C(  289), UINT16_C(64512), UINT16_C(29769), UINT16_C( 1884), UINT16_C(35179) },
+      { UINT16_C( 4339), UINT16_C(15384), UINT16_C(32256), UINT16_C(  288), UINT16_C(64512), UINT16_C(29768), UINT16_C( 1883), UINT16_C(35179) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m256 a = simde_mm256_loadu_ps(test_vec[i].a);
+    simde_test_x86_assert_equal_u16x8(simde_mm256_cvtps_ph(a, SIMDE_MM_FROUND_TO_NEAREST_INT), simde_mm_loadu_si128(test_vec[i].nearest));
+    simde_test_x86_assert_equal_u16x8(simde_mm256_cvtps_ph(a, SIMDE_MM_FROUND_TO_NEG_INF), simde_mm_loadu_si128(test_vec[i].down));
+    simde_test_x86_assert_equal_u16x8(simde_mm256_cvtps_ph(a, SIMDE_MM_FROUND_TO_POS_INF), simde_mm_loadu_si128(test_vec[i].up));
+    simde_test_x86_assert_equal_u16x8(simde_mm256_cvtps_ph(a, SIMDE_MM_FROUND_TO_ZERO), simde_mm_loadu_si128(test_vec[i].zero));
+    simde_test_x86_assert_equal_u16x8(simde_mm256_cvtps_ph(a, SIMDE_MM_FROUND_CUR_DIRECTION), simde_mm_loadu_si128(test_vec[i].nearest));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_cvtsh_ss (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const uint16_t a;
+    const simde_float32 r;
+  } test_vec[] = {
+    { UINT16_C(50726), SIMDE_FLOAT32_C(     -6.1484375) },
+    { UINT16_C(36465), SIMDE_FLOAT32_C(-0.000393152237) },
+    { UINT16_C(35633), SIMDE_FLOAT32_C(-0.000219464302) },
+    { UINT16_C(31743), SIMDE_FLOAT32_C(        65504.0) },
+    { UINT16_C( 1007), SIMDE_FLOAT32_C( 6.00218773e-05) },
+    { UINT16_C(26994), SIMDE_FLOAT32_C(         2788.0) },
+    { UINT16_C(49775), SIMDE_FLOAT32_C(    -3.21679688) },
+    { UINT16_C(28459), SIMDE_FLOAT32_C(         7340.0) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_assert_equal_f32(simde_cvtsh_ss(test_vec[i].a), test_vec[i].r, 9);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_cvtss_sh (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const simde_float32 a;
+    const uint16_t nearest;
+    const uint16_t down;
+    const uint16_t up;
+    const uint16_t zero;
+  } test_vec[] = {
+    { SIMDE_FLOAT32_C(    -4.72731304), UINT16_C(50362), UINT16_C(50363), UINT16_C(50362), UINT16_C(50362) },
+    { SIMDE_FLOAT32_C(-0.000467497419), UINT16_C(36777), UINT16_C(36777), UINT16_C(36776), UINT16_C(36776) },
+    { SIMDE_FLOAT32_C(-0.000172433225), UINT16_C(35238), UINT16_C(35239), UINT16_C(35238), UINT16_C(35238) },
+    { SIMDE_FLOAT32_C(     65526.7344), UINT16_C(31744), UINT16_C(31743), UINT16_C(31744), UINT16_C(31743) },
+    { SIMDE_FLOAT32_C(           -0.0), UINT16_C(32768), UINT16_C(32768), UINT16_C(32768), UINT16_C(32768) },
+    {            SIMDE_MATH_NANF, UINT16_C(32256), UINT16_C(32256), UINT16_C(32256), UINT16_C(32256) },
+    { SIMDE_FLOAT32_C(     57284.8555), UINT16_C(31486), UINT16_C(31486), UINT16_C(31487), UINT16_C(31486) },
+    { SIMDE_FLOAT32_C(-9.55168894e-39), UINT16_C(32768), UINT16_C(32769), UINT16_C(32768), UINT16_C(32768) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde_assert_equal_u16(simde_cvtss_sh(test_vec[i].a, SIMDE_MM_FROUND_TO_NEAREST_INT), test_vec[i].nearest);
+    simde_assert_equal_u16(simde_cvtss_sh(test_vec[i].a, SIMDE_MM_FROUND_TO_NEG_INF), test_vec[i].down);
+    simde_assert_equal_u16(simde_cvtss_sh(test_vec[i].a, SIMDE_MM_FROUND_TO_POS_INF), test_vec[i].up);
+    simde_assert_equal_u16(simde_cvtss_sh(test_vec[i].a, SIMDE_MM_FROUND_TO_ZERO), test_vec[i].zero);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cvtph_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_cvtph_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cvtps_ph)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_cvtps_ph)
+  SIMDE_TEST_FUNC_LIST_ENTRY(cvtsh_ss)
+  SIMDE_TEST_FUNC_LIST_ENTRY(cvtss_sh)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/test-x86-footer.h>
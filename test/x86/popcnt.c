@@ -0,0 +1,81 @@
+/* Copyright (c) 2026 agent <agent@local>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TESTS_CURRENT_ISAX popcnt
+#include <simde/x86/popcnt.h>
+#include <test/x86/test-x86.h>
+
+static int
+test_simde_mm_popcnt_u32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t a;
+    int32_t r;
+  } test_vec[] = {
+    { UINT32_C(         0), INT32_C( 0) },
+    { UINT32_C(4294967295), INT32_C(32) },
+    { UINT32_C(2147483648), INT32_C( 1) },
+    { UINT32_C( 537529058), INT32_C( 9) },
+    { UINT32_C( 738582633), INT32_C(12) },
+    { UINT32_C(1794822633), INT32_C(19) },
+    { UINT32_C(1152548362), INT32_C(14) },
+    { UINT32_C(4153006198), INT32_C(19) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int32_t r = simde_mm_popcnt_u32(test_vec[i].a);
+    simde_assert_equal_i32(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_popcnt_u64 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint64_t a;
+    int64_t r;
+  } test_vec[] = {
+    { UINT64_C(                   0), INT64_C( 0) },
+    { UINT64_C(18446744073709551615), INT64_C(64) },
+    { UINT64_C( 9223372036854775808), INT64_C( 1) },
+    { UINT64_C( 5188309845958493504), INT64_C(17) },
+    { UINT64_C(14775798790292935803), INT64_C(33) },
+    { UINT64_C( 9255334245217531795), INT64_C(33) },
+    { UINT64_C(12991521186940851900), INT64_C(37) },
+    { UINT64_C(11152506502103506321), INT64_C(32) }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    int64_t r = simde_mm_popcnt_u64(test_vec[i].a);
+    simde_assert_equal_i64(r, test_vec[i].r);
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_popcnt_u32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_popcnt_u64)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/test-x86-footer.h>
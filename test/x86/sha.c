@@ -0,0 +1,367 @@
+/* Copyright (c) 2026 agent <agent@local>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#define SIMDE_TESTS_CURRENT_ISAX sha
+#include <simde/x86/sha.h>
+#include <test/x86/test-sse2.h>
+
+static int
+test_simde_mm_sha1msg1_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(   348682067),  INT32_C(  2112777468),  INT32_C(  1801129765),  INT32_C(   744280187) },
+      {  INT32_C(   923342619), -INT32_C(  2144623627),  INT32_C(  2086250994),  INT32_C(  1740056097) },
+      { -INT32_C(  1754390177),  INT32_C(   442059485), -INT32_C(  2140371064),  INT32_C(  1370668167) } },
+    { { -INT32_C(   905318823), -INT32_C(   173585467), -INT32_C(  2101193710),  INT32_C(  1134859322) },
+      {  INT32_C(  1470469010), -INT32_C(  1737065419),  INT32_C(  1313160589),  INT32_C(    55276726) },
+      { -INT32_C(  2075339820), -INT32_C(   152289421),  INT32_C(  1221311051), -INT32_C(  1241260033) } },
+    { { -INT32_C(   527894626), -INT32_C(   865746447), -INT32_C(  1932044750), -INT32_C(  1897843682) },
+      { -INT32_C(   388091402),  INT32_C(  1754738709), -INT32_C(  1948075211),  INT32_C(  1731924739) },
+      {  INT32_C(  1802128555), -INT32_C(  1419848974),  INT32_C(  1818206636),  INT32_C(  1116009967) } },
+    { { -INT32_C(  2054103725),  INT32_C(   659867689), -INT32_C(   723563527),  INT32_C(  1669802798) },
+      {  INT32_C(    35598072), -INT32_C(   918180187), -INT32_C(  1021825864), -INT32_C(    54512927) },
+      {  INT32_C(  1183379947), -INT32_C(   610993464),  INT32_C(  1364170410),  INT32_C(  1154736903) } },
+    { { -INT32_C(   232796373),  INT32_C(  1359436405),  INT32_C(   541026689), -INT32_C(  2068752622) },
+      {  INT32_C(   863482172), -INT32_C(   563703458), -INT32_C(   273822724),  INT32_C(   548007787) },
+      {  INT32_C(   498205911),  INT32_C(  1907275038), -INT32_C(   769612118), -INT32_C(   709489305) } },
+    { {  INT32_C(   528667697),  INT32_C(    71106009),  INT32_C(  1786040930), -INT32_C(  1923816634) },
+      {  INT32_C(  2132695808),  INT32_C(   645572534),  INT32_C(   647724921), -INT32_C(  1066879033) },
+      {  INT32_C(   957983560), -INT32_C(  1001108962),  INT32_C(  1979057747), -INT32_C(  1989665121) } },
+    { { -INT32_C(  1399093044),  INT32_C(  1233325277),  INT32_C(   323001732), -INT32_C(  1685062209) },
+      {  INT32_C(  1442344324), -INT32_C(  1773765537),  INT32_C(   263194471), -INT32_C(  1978638679) },
+      { -INT32_C(  1557426261), -INT32_C(  1013755276), -INT32_C(  1076161208), -INT32_C(   770903710) } },
+    { {  INT32_C(   635166295), -INT32_C(  1627710421),  INT32_C(   757235923),  INT32_C(   233214226) },
+      {  INT32_C(   354113712),  INT32_C(   854802945),  INT32_C(   126616773), -INT32_C(  1929212532) },
+      {  INT32_C(   576182930),  INT32_C(   335122855),  INT32_C(   150560388), -INT32_C(  1826779847) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_sha1msg1_epu32(a, b);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_sha1msg2_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(  1709306668), -INT32_C(  1364621875),  INT32_C(  1142949254),  INT32_C(   335799309) },
+      {  INT32_C(  1968783493), -INT32_C(   780438716), -INT32_C(   148253534),  INT32_C(  1731260299) },
+      { -INT32_C(  1198204138), -INT32_C(  1209955695),  INT32_C(   716631429), -INT32_C(   967548577) } },
+    { {  INT32_C(  1220717948), -INT32_C(   551815386),  INT32_C(  2116864328),  INT32_C(  1266664154) },
+      { -INT32_C(   738407457), -INT32_C(   117299832),  INT32_C(    55460803), -INT32_C(   743944316) },
+      { -INT32_C(  1320984931),  INT32_C(   432962034),  INT32_C(   241031553), -INT32_C(  1872559566) } },
+    { { -INT32_C(    29944692),  INT32_C(  1070979493),  INT32_C(   826587990), -INT32_C(  1608374368) },
+      {  INT32_C(  1992395759),  INT32_C(  1900221240),  INT32_C(   356408094),  INT32_C(  1001463848) },
+      {  INT32_C(   673176547), -INT32_C(  1842830188), -INT32_C(  2146479908),  INT32_C(  1782118781) } },
+    { {  INT32_C(  1113781457),  INT32_C(   640755064),  INT32_C(  1660885298),  INT32_C(  1071311744) },
+      { -INT32_C(   255738281),  INT32_C(   525551851),  INT32_C(  1876341946), -INT32_C(  1231718573) },
+      { -INT32_C(   990603957), -INT32_C(  1377749409), -INT32_C(    78077006), -INT32_C(  1608991116) } },
+    { {  INT32_C(  2015507678), -INT32_C(  1532328137), -INT32_C(   933822471),  INT32_C(   822774854) },
+      { -INT32_C(   167819042),  INT32_C(  1497579983),  INT32_C(  1409307788), -INT32_C(   966330587) },
+      {  INT32_C(  1684998805), -INT32_C(  1565810734),  INT32_C(   573275245), -INT32_C(   904547948) } },
+    { {  INT32_C(  1887751546),  INT32_C(   641325664),  INT32_C(  1927754196),  INT32_C(  1587153591) },
+      {  INT32_C(   389509986),  INT32_C(    44139780), -INT32_C(  1132919026),  INT32_C(  2090989184) },
+      {  INT32_C(  1787145235),  INT32_C(  1646088708), -INT32_C(   527603296), -INT32_C(   976872589) } },
+    { {  INT32_C(  1487457236), -INT32_C(  1479020733), -INT32_C(   332271523), -INT32_C(  1570495235) },
+      {  INT32_C(   794719220), -INT32_C(  1664830957), -INT32_C(   973217865), -INT32_C(   815322680) },
+      {  INT32_C(   792099457),  INT32_C(   286472559), -INT32_C(   504724324), -INT32_C(   818678124) } },
+    { { -INT32_C(  1681374556),  INT32_C(   888797985),  INT32_C(  1420091543), -INT32_C(  1878299498) },
+      {  INT32_C(   133996495), -INT32_C(   179473104),  INT32_C(   854107098),  INT32_C(   920962077) },
+      { -INT32_C(  1138771845),  INT32_C(  1711983068),  INT32_C(  1137912655),  INT32_C(  1170710169) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_sha1msg2_epu32(a, b);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_sha1nexte_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C(  1197461630),  INT32_C(  1888923742), -INT32_C(  1565766978),  INT32_C(  1023049131) },
+      { -INT32_C(   494304368),  INT32_C(  1886418071), -INT32_C(  1486663234), -INT32_C(   202098531) },
+      { -INT32_C(   494304368),  INT32_C(  1886418071), -INT32_C(  1486663234), -INT32_C(  1020078073) } },
+    { { -INT32_C(  1450110722),  INT32_C(   673697119), -INT32_C(    98224891), -INT32_C(   496853457) },
+      {  INT32_C(  1130508499),  INT32_C(   966172786),  INT32_C(  1898434994), -INT32_C(  1859800431) },
+      {  INT32_C(  1130508499),  INT32_C(   966172786),  INT32_C(  1898434994), -INT32_C(  1984013796) } },
+    { {  INT32_C(  1303231615),  INT32_C(   408426695),  INT32_C(   656046390),  INT32_C(  1415888964) },
+      { -INT32_C(   830695228),  INT32_C(  1244975349), -INT32_C(  1214110700), -INT32_C(  1602296484) },
+      { -INT32_C(   830695228),  INT32_C(  1244975349), -INT32_C(  1214110700), -INT32_C(  1248324243) } },
+    { {  INT32_C(  1668764640),  INT32_C(  1553417543), -INT32_C(  1018308083), -INT32_C(    49388807) },
+      {  INT32_C(  1842077820),  INT32_C(  1956636860),  INT32_C(  1312913517), -INT32_C(  1305198115) },
+      {  INT32_C(  1842077820),  INT32_C(  1956636860),  INT32_C(  1312913517),  INT32_C(   829938331) } },
+    { { -INT32_C(   672701204), -INT32_C(   649719515),  INT32_C(   333083719), -INT32_C(    13225617) },
+      { -INT32_C(   889985331),  INT32_C(  1606816320), -INT32_C(  1870852508),  INT32_C(   857927032) },
+      { -INT32_C(   889985331),  INT32_C(  1606816320), -INT32_C(  1870852508),  INT32_C(   854620627) } },
+    { { -INT32_C(  2006142756),  INT32_C(  1798430397), -INT32_C(   288902592), -INT32_C(  1460228828) },
+      {  INT32_C(  1465158014),  INT32_C(  1278197740), -INT32_C(  1149002861), -INT32_C(  1146611612) },
+      {  INT32_C(  1465158014),  INT32_C(  1278197740), -INT32_C(  1149002861), -INT32_C(   437926995) } },
+    { {  INT32_C(  1875305842),  INT32_C(  1920889912),  INT32_C(  1243645648),  INT32_C(  1777693661) },
+      {  INT32_C(   586534522), -INT32_C(  1698628762), -INT32_C(   360226032),  INT32_C(   658811350) },
+      {  INT32_C(   586534522), -INT32_C(  1698628762), -INT32_C(   360226032), -INT32_C(  2117990707) } },
+    { { -INT32_C(  1861024567),  INT32_C(  1432957056),  INT32_C(   274580193), -INT32_C(   786833116) },
+      { -INT32_C(   785703962),  INT32_C(    93418577), -INT32_C(  1530961159),  INT32_C(  1586070140) },
+      { -INT32_C(   785703962),  INT32_C(    93418577), -INT32_C(  1530961159), -INT32_C(  1831863611) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_sha1nexte_epu32(a, b);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_sha1rnds4_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(  1144139483),  INT32_C(  1013228487), -INT32_C(   305366208), -INT32_C(   619891786) },
+      { -INT32_C(   115145647),  INT32_C(  1990751769),  INT32_C(   703692981),  INT32_C(  1715269364) },
+      {  INT32_C(  1479205043),  INT32_C(   625274364), -INT32_C(   338055576),  INT32_C(  1024545428) } },
+    { {  INT32_C(  2051939969),  INT32_C(    18154236),  INT32_C(   838473721), -INT32_C(   825279082) },
+      { -INT32_C(  1544223123),  INT32_C(  2004670241), -INT32_C(   841103665), -INT32_C(   353751422) },
+      {  INT32_C(   529741344),  INT32_C(    17917669), -INT32_C(   241120679),  INT32_C(  1003234843) } },
+    { { -INT32_C(  1611446098), -INT32_C(   965392961), -INT32_C(  1074323212), -INT32_C(  2144046155) },
+      { -INT32_C(   696625646), -INT32_C(  1476565442), -INT32_C(   976694414), -INT32_C(   122560940) },
+      { -INT32_C(  1953180505), -INT32_C(  1855071329), -INT32_C(   489057954),  INT32_C(   844850166) } },
+    { {  INT32_C(   873824315),  INT32_C(  2028783099),  INT32_C(   754123440), -INT32_C(   111785803) },
+      {  INT32_C(  1256745316), -INT32_C(  1842913098), -INT32_C(    47987721),  INT32_C(   792172976) },
+      {  INT32_C(  1629187693), -INT32_C(  2064227674),  INT32_C(  1101866749),  INT32_C(  1657029224) } },
+    { {  INT32_C(   551999930), -INT32_C(   147572087),  INT32_C(  2080231612), -INT32_C(   195853283) },
+      {  INT32_C(    91456597),  INT32_C(   388552221),  INT32_C(  1813160177), -INT32_C(   274949648) },
+      {  INT32_C(  1374776372),  INT32_C(  2112508734), -INT32_C(  1152905812),  INT32_C(  1101862122) } },
+    { { -INT32_C(   166784699), -INT32_C(   968753625), -INT32_C(  1002433509), -INT32_C(   358026509) },
+      {  INT32_C(   179535830),  INT32_C(  1691430057),  INT32_C(   950437040),  INT32_C(   412280249) },
+      {  INT32_C(   874941140), -INT32_C(  1548518048),  INT32_C(  1321982380), -INT32_C(  2074482192) } },
+    { {  INT32_C(  1776415704), -INT32_C(  1957968321),  INT32_C(  1150107251),  INT32_C(  1058789583) },
+      {  INT32_C(   838220990),  INT32_C(    16990023), -INT32_C(   841742087), -INT32_C(  1191002456) },
+      { -INT32_C(  1655119111), -INT32_C(  2087468730), -INT32_C(  1162922663),  INT32_C(  2003491496) } },
+    { {  INT32_C(   813910309),  INT32_C(   150644471),  INT32_C(   610799226),  INT32_C(  1914700006) },
+      { -INT32_C(   803817113),  INT32_C(  1654533589),  INT32_C(   167167182), -INT32_C(  2025596217) },
+      { -INT32_C(   328325436), -INT32_C(  1947453965), -INT32_C(   801036005), -INT32_C(  1961913464) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r;
+
+    switch(i & 3) {
+      case 0:
+        r = simde_mm_sha1rnds4_epu32(a, b, 0);
+        break;
+      case 1:
+        r = simde_mm_sha1rnds4_epu32(a, b, 1);
+        break;
+      case 2:
+        r = simde_mm_sha1rnds4_epu32(a, b, 2);
+        break;
+      case 3:
+        r = simde_mm_sha1rnds4_epu32(a, b, 3);
+        break;
+      default:
+        HEDLEY_UNREACHABLE();
+    }
+
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_sha256msg1_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(  1510232187), -INT32_C(   794879590),  INT32_C(   194576681),  INT32_C(   826104171) },
+      { -INT32_C(  1290397415), -INT32_C(  1442622613),  INT32_C(  1710550797),  INT32_C(  1153656211) },
+      { -INT32_C(  1882187604), -INT32_C(   473077157), -INT32_C(  1850204423), -INT32_C(   729817793) } },
+    { { -INT32_C(   782979263), -INT32_C(   729024929), -INT32_C(  2081253773), -INT32_C(   979333217) },
+      {  INT32_C(   997968192), -INT32_C(  1150062894),  INT32_C(  1243249807),  INT32_C(   653036470) },
+      {  INT32_C(   704924486),  INT32_C(   661736829), -INT32_C(  1999947785),  INT32_C(   988418051) } },
+    { { -INT32_C(   809681310),  INT32_C(  1973263518), -INT32_C(  1781776345),  INT32_C(  1329410407) },
+      { -INT32_C(  1387662651), -INT32_C(   554209184), -INT32_C(  2120579456),  INT32_C(  1207047053) },
+      {  INT32_C(   624710703), -INT32_C(  1019637099),  INT32_C(   552357800),  INT32_C(   830470230) } },
+    { {  INT32_C(  1531160958), -INT32_C(  1284984404),  INT32_C(   394890191), -INT32_C(  1366455528) },
+      {  INT32_C(  2110608910), -INT32_C(  1763274974), -INT32_C(  1795896644),  INT32_C(  1005194281) },
+      { -INT32_C(  1096510198), -INT32_C(  1315530440),  INT32_C(  1574178213), -INT32_C(   179357130) } },
+    { {  INT32_C(  2135247632), -INT32_C(  1568209530), -INT32_C(    55989747), -INT32_C(  1773544935) },
+      { -INT32_C(  1316294675), -INT32_C(   280256142), -INT32_C(  1020056912), -INT32_C(  1696341787) },
+      {  INT32_C(  1471779114),  INT32_C(   292953797),  INT32_C(  1410168690),  INT32_C(   217251417) } },
+    { { -INT32_C(  2012460917),  INT32_C(    11211482),  INT32_C(  1389081215), -INT32_C(  1820632357) },
+      { -INT32_C(  1433634130), -INT32_C(  1406924325), -INT32_C(   514500856),  INT32_C(   745488294) },
+      { -INT32_C(   122749729),  INT32_C(   420366451), -INT32_C(   959763537), -INT32_C(   366307362) } },
+    { {  INT32_C(   784866855), -INT32_C(   689903653),  INT32_C(   271036628), -INT32_C(  1600435531) },
+      { -INT32_C(   627150496),  INT32_C(   429856130), -INT32_C(   561312983),  INT32_C(   678426495) },
+      { -INT32_C(  1018214733),  INT32_C(   485664077), -INT32_C(  1104746311), -INT32_C(   413528290) } },
+    { {  INT32_C(     4303476),  INT32_C(  1294283808),  INT32_C(   518420040), -INT32_C(  1698223964) },
+      {  INT32_C(   415633397),  INT32_C(   266264234), -INT32_C(  1601336937),  INT32_C(   420747076) },
+      {  INT32_C(    75016729),  INT32_C(  1536702908), -INT32_C(  1356151748),  INT32_C(    94057588) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_sha256msg1_epu32(a, b);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_sha256msg2_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { {  INT32_C(  1240208624), -INT32_C(  1453920039), -INT32_C(  1387050120), -INT32_C(   530041874) },
+      {  INT32_C(   667670537),  INT32_C(  1635872249),  INT32_C(  1583493474), -INT32_C(  1417745024) },
+      { -INT32_C(  1468591775),  INT32_C(  1420922948),  INT32_C(   403327081), -INT32_C(   626540392) } },
+    { { -INT32_C(  1403971525),  INT32_C(   568251595), -INT32_C(   906675294), -INT32_C(  1393133227) },
+      {  INT32_C(  1993695463), -INT32_C(   625994778), -INT32_C(  2080421311), -INT32_C(    12057451) },
+      { -INT32_C(   124180851),  INT32_C(   616982295), -INT32_C(  2120310600), -INT32_C(  1403600713) } },
+    { {  INT32_C(   378846384), -INT32_C(   745358903), -INT32_C(  1101607174), -INT32_C(   595026457) },
+      { -INT32_C(   124644068),  INT32_C(   623506998), -INT32_C(  1284708262),  INT32_C(  1915709194) },
+      { -INT32_C(     6319727),  INT32_C(   856405588), -INT32_C(   115607854), -INT32_C(  1972045072) } },
+    { {  INT32_C(  1902270552), -INT32_C(  1681028376),  INT32_C(   826256381), -INT32_C(    98792470) },
+      {  INT32_C(  1733101693), -INT32_C(  1584124627),  INT32_C(  2115497527),  INT32_C(   377531435) },
+      {  INT32_C(  2082811274), -INT32_C(   547171165),  INT32_C(  1688937690),  INT32_C(   722393298) } },
+    { { -INT32_C(   125806366),  INT32_C(  1809653971),  INT32_C(  1157418578), -INT32_C(  1676614834) },
+      {  INT32_C(   459919624), -INT32_C(   295812950), -INT32_C(  1454270805),  INT32_C(  1010827078) },
+      { -INT32_C(   232042807),  INT32_C(  1814165306),  INT32_C(   327031765),  INT32_C(  1634883383) } },
+    { {  INT32_C(  1630255180),  INT32_C(  1786149948), -INT32_C(   818798652), -INT32_C(  1977283845) },
+      { -INT32_C(  1049584082),  INT32_C(  1010054290),  INT32_C(   824522875), -INT32_C(   393212725) },
+      { -INT32_C(  1670746044),  INT32_C(  1916610965),  INT32_C(  1161815784), -INT32_C(  1140219122) } },
+    { { -INT32_C(  1834523902), -INT32_C(   793596604), -INT32_C(  1876158178), -INT32_C(  1099839828) },
+      {  INT32_C(  1072369185),  INT32_C(  1852403837),  INT32_C(  1465654749), -INT32_C(  1308462426) },
+      {  INT32_C(   535312708),  INT32_C(  1205714209), -INT32_C(  1413902555),  INT32_C(   664224550) } },
+    { {  INT32_C(  1241237610),  INT32_C(  1784898938),  INT32_C(    44154160), -INT32_C(   973491638) },
+      {  INT32_C(  1795920814), -INT32_C(  2023837943), -INT32_C(  2144014313),  INT32_C(  1986296887) },
+      {  INT32_C(   807732618),  INT32_C(   467939931),  INT32_C(   622466183),  INT32_C(  1700383180) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i r = simde_mm_sha256msg2_epu32(a, b);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_sha256rnds2_epu32 (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int32_t a[4];
+    const int32_t b[4];
+    const int32_t k[4];
+    const int32_t r[4];
+  } test_vec[] = {
+    { { -INT32_C(  1036934524), -INT32_C(  2112888639), -INT32_C(    26480832),  INT32_C(   465103006) },
+      {  INT32_C(  1161330383), -INT32_C(  1651483150), -INT32_C(  1399832119),  INT32_C(   334770954) },
+      {  INT32_C(  1868978668),  INT32_C(  1605201503), -INT32_C(  2096872637), -INT32_C(  1049560315) },
+      { -INT32_C(   215027035), -INT32_C(   426630763), -INT32_C(   590012389),  INT32_C(   186194910) } },
+    { {  INT32_C(   885685171), -INT32_C(   867998844),  INT32_C(  1878361155), -INT32_C(  1579868277) },
+      {  INT32_C(  1858615156), -INT32_C(  1497171430),  INT32_C(  1789835630), -INT32_C(   809468004) },
+      { -INT32_C(  1686792093), -INT32_C(   586216557),  INT32_C(  1552781636),  INT32_C(   766794598) },
+      { -INT32_C(   139875631), -INT32_C(  1021474501),  INT32_C(  1113618679),  INT32_C(    48935909) } },
+    { { -INT32_C(   751490480),  INT32_C(  1352389636), -INT32_C(  2028510548), -INT32_C(   247044247) },
+      { -INT32_C(   501345817),  INT32_C(   510309380),  INT32_C(  1420025964), -INT32_C(  1582875476) },
+      {  INT32_C(   521460181),  INT32_C(  1433019686), -INT32_C(   164267796),  INT32_C(  1570810141) },
+      {  INT32_C(  1637686366),  INT32_C(  1444601626),  INT32_C(   506171058), -INT32_C(   711393563) } },
+    { { -INT32_C(  1643376881),  INT32_C(  1013986513), -INT32_C(     9453320), -INT32_C(   544464519) },
+      { -INT32_C(  1914550405),  INT32_C(   384646453),  INT32_C(  1345784335), -INT32_C(  1583216677) },
+      { -INT32_C(   390867692), -INT32_C(    95848514),  INT32_C(   548784849), -INT32_C(   120310524) },
+      { -INT32_C(  1215848732), -INT32_C(  1028470758), -INT32_C(   395787353),  INT32_C(   125081150) } },
+    { { -INT32_C(  1638638482),  INT32_C(   559820630),  INT32_C(  1617790600), -INT32_C(   300417147) },
+      { -INT32_C(  1045393094),  INT32_C(   553713304),  INT32_C(   509892965),  INT32_C(  1699506327) },
+      { -INT32_C(   595446394), -INT32_C(  1814261651),  INT32_C(  1338544653), -INT32_C(  2116018071) },
+      {  INT32_C(   279058895), -INT32_C(  1190145108), -INT32_C(   893158753),  INT32_C(  1155613781) } },
+    { {  INT32_C(  1244977769), -INT32_C(  1713305187),  INT32_C(   876547278), -INT32_C(   358383273) },
+      { -INT32_C(  1600752747),  INT32_C(  1482496562), -INT32_C(   303993722), -INT32_C(  1102098465) },
+      { -INT32_C(   904149376),  INT32_C(   699683085), -INT32_C(   452142353),  INT32_C(  2107218074) },
+      {  INT32_C(  1810573371), -INT32_C(  1779629017), -INT32_C(   757020488), -INT32_C(  1668868655) } },
+    { {  INT32_C(  1312935211),  INT32_C(  1743348849),  INT32_C(   738429689),  INT32_C(   146674604) },
+      {  INT32_C(  1816659083),  INT32_C(   210032194), -INT32_C(   138670226),  INT32_C(  1935502576) },
+      {  INT32_C(  1932323369), -INT32_C(  2033247811),  INT32_C(   581912782), -INT32_C(     6298145) },
+      { -INT32_C(   554432187),  INT32_C(  1774666479),  INT32_C(   898862674), -INT32_C(  1972222573) } },
+    { { -INT32_C(  1165341228), -INT32_C(   733434801), -INT32_C(   907227433), -INT32_C(     8240502) },
+      {  INT32_C(  1537385615),  INT32_C(  1260462598), -INT32_C(    63233598),  INT32_C(   489776897) },
+      {  INT32_C(  1454171535),  INT32_C(     8470404),  INT32_C(  1422482683), -INT32_C(  1498640254) },
+      { -INT32_C(  2080271854),  INT32_C(   947446820),  INT32_C(  1914755836), -INT32_C(    47686709) } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi32(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi32(test_vec[i].b);
+    simde__m128i k = simde_x_mm_loadu_epi32(test_vec[i].k);
+    simde__m128i r = simde_mm_sha256rnds2_epu32(a, b, k);
+    simde_test_x86_assert_equal_i32x4(r, simde_x_mm_loadu_epi32(test_vec[i].r));
+  }
+
+  return 0;
+}
+
+SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sha1msg1_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sha1msg2_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sha1nexte_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sha1rnds4_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sha256msg1_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sha256msg2_epu32)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sha256rnds2_epu32)
+SIMDE_TEST_FUNC_LIST_END
+
+#include <test/x86/test-x86-footer.h>
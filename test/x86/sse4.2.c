@@ -25,6 +25,475 @@
 #include <test/x86/test-sse2.h>
 #include <simde/x86/sse4.2.h>
 
+static int
+test_simde_mm_cmpestri (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[16];
+    const int la;
+    const int8_t b[16];
+    const int lb;
+    const int r[6];
+  } test_vec[] = {
+    { {  INT8_C( 127),  INT8_C( 122),  INT8_C( 127),  INT8_C(  97), -INT8_C(   1),  INT8_C(  22), -INT8_C( 128),  INT8_C(  53),
+        INT8_C( 109), -INT8_C( 128),  INT8_C(  65), -INT8_C(   1),  INT8_C( 125),  INT8_C(  99), -INT8_C(  83),  INT8_C( 127) },
+      3,
+      { -INT8_C(  48),  INT8_C(  99),  INT8_C(  97),  INT8_C( 127),  INT8_C( 122),  INT8_C( 127),  INT8_C(  97), -INT8_C(   1),
+        INT8_C( 109),  INT8_C(   1), -INT8_C(   1),  INT8_C( 122),  INT8_C( 122),  INT8_C(  76), -INT8_C(   1),  INT8_C(  65) },
+      16,
+      {  3, 15,  0,  8,  3,  0 } },
+    { {  INT8_C(   1), -INT8_C( 120),  INT8_C( 127), -INT8_C( 112),  INT8_C( 122),  INT8_C(  97), -INT8_C(   1),  INT8_C(  65),
+        INT8_C(  98), -INT8_C( 128), -INT8_C( 128), -INT8_C(   1), -INT8_C( 128),  INT8_C(  97), -INT8_C(  46),  INT8_C( 122) },
+      10,
+      {  INT8_C( 127),  INT8_C(   1), -INT8_C( 120),  INT8_C( 127), -INT8_C( 112),  INT8_C(   1),  INT8_C( 127),  INT8_C( 127),
+        INT8_C(  50), -INT8_C( 128),  INT8_C(  84),  INT8_C(   1),  INT8_C( 122),  INT8_C(   7),  INT8_C( 109),  INT8_C(   1) },
+      -2,
+      {  0, 15,  0,  8, 16,  0 } },
+    { { -INT8_C(  68),  INT8_C( 122),  INT8_C(  65), -INT8_C(   1),  INT8_C(  97),  INT8_C( 127),  INT8_C(   1),  INT8_C(   1),
+        INT8_C(   1),  INT8_C( 116),  INT8_C( 122),  INT8_C(  97), -INT8_C(  16), -INT8_C( 128),  INT8_C( 127),  INT8_C(  65) },
+      12,
+      { -INT8_C(  68),  INT8_C( 122),  INT8_C(  65), -INT8_C(   1),  INT8_C(  97),  INT8_C( 123),  INT8_C( 109),  INT8_C( 122),
+        INT8_C(  65),  INT8_C(  65),  INT8_C(  13), -INT8_C(  96),  INT8_C( 113),  INT8_C( 109),  INT8_C( 122), -INT8_C(  80) },
+      15,
+      {  0, 15,  2,  8, 16,  3 } },
+    { {  INT8_C(  65),  INT8_C(  65),  INT8_C(  99), -INT8_C(   5),  INT8_C(   1),  INT8_C(   1), -INT8_C(  83), -INT8_C(  72),
+       -INT8_C( 128),  INT8_C(  97), -INT8_C(   1), -INT8_C( 108),  INT8_C(  98),  INT8_C(   1),  INT8_C(  97),  INT8_C( 122) },
+      2,
+      {  INT8_C(  37), -INT8_C(  84),  INT8_C(  32),  INT8_C( 122),  INT8_C(   1),  INT8_C( 109),  INT8_C(   1),  INT8_C( 127),
+        INT8_C( 127),  INT8_C(  97),  INT8_C( 122),  INT8_C(  97),  INT8_C(   1),  INT8_C(  98), -INT8_C( 128),  INT8_C(  99) },
+      18,
+      { 16, 15,  0,  8, 16,  8 } },
+    { {  INT8_C(  98),  INT8_C(  97),  INT8_C( 109), -INT8_C(  35),  INT8_C( 127),  INT8_C(  65),  INT8_C(  97),  INT8_C( 127),
+        INT8_C( 127),  INT8_C( 127),  INT8_C( 122),  INT8_C(  65),  INT8_C(  65), -INT8_C(  19),  INT8_C(   1), -INT8_C(  43) },
+      18,
+      { -INT8_C( 116),  INT8_C(  99),  INT8_C(  98),  INT8_C(  42), -INT8_C(   7),  INT8_C(  99),  INT8_C(  65),  INT8_C( 109),
+        INT8_C( 109),  INT8_C(  65),  INT8_C(  99),  INT8_C( 109), -INT8_C( 106),  INT8_C(  98), -INT8_C(   1),  INT8_C(  41) },
+      -1,
+      { 16, 15,  0,  8, 16,  8 } },
+    { { -INT8_C(  36), -INT8_C( 128), -INT8_C( 128),  INT8_C(  99),  INT8_C(  97), -INT8_C(   1),  INT8_C(  24), -INT8_C(   1),
+       -INT8_C(  52),  INT8_C( 127),  INT8_C(  65),  INT8_C( 127),  INT8_C( 122),  INT8_C(  99),  INT8_C( 109),  INT8_C( 125) },
+      19,
+      {  INT8_C(  65),  INT8_C(   4), -INT8_C(  36), -INT8_C( 128), -INT8_C( 128),  INT8_C(  99),  INT8_C(  97), -INT8_C( 115),
+        INT8_C(  99),  INT8_C(  97),  INT8_C( 127),  INT8_C( 109),  INT8_C( 109),  INT8_C(  71), -INT8_C( 128),  INT8_C(  99) },
+      5,
+      {  0, 15,  0,  8, 16,  0 } },
+    { {  INT8_C( 109),  INT8_C(  99),  INT8_C(  99), -INT8_C( 128),  INT8_C(   1), -INT8_C( 128),  INT8_C(  65),  INT8_C(  12),
+       -INT8_C( 128),  INT8_C(  98), -INT8_C(   1),  INT8_C( 122),  INT8_C(   1),  INT8_C(  97), -INT8_C( 128),  INT8_C(  98) },
+      8,
+      { -INT8_C(   1),  INT8_C(  65),  INT8_C(  65),  INT8_C( 109),  INT8_C(  99),  INT8_C(  99),  INT8_C(  99),  INT8_C(  59),
+        INT8_C( 122),  INT8_C(   1),  INT8_C(  55),  INT8_C( 122),  INT8_C( 127),  INT8_C(   1),  INT8_C(  97),  INT8_C(  99) },
+      19,
+      {  1, 15,  0,  8, 16,  0 } },
+    { {  INT8_C(  99),  INT8_C(  65), -INT8_C( 128),  INT8_C(  65),  INT8_C( 127),  INT8_C(   1),  INT8_C(  99),  INT8_C(  99),
+        INT8_C( 127),  INT8_C(   1),  INT8_C(  65),  INT8_C(   5),  INT8_C(  97),  INT8_C( 127),  INT8_C( 109),  INT8_C( 127) },
+      3,
+      {  INT8_C(  81), -INT8_C( 103),  INT8_C(  65),  INT8_C( 122),  INT8_C(  99),  INT8_C( 122),  INT8_C(  99),  INT8_C(  99),
+        INT8_C(  52),  INT8_C( 127),  INT8_C(   1),  INT8_C(  97),  INT8_C(  98),  INT8_C(  99),  INT8_C(  99),  INT8_C(   1) },
+      9,
+      {  2, 15,  0,  8, 16,  0 } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi8(test_vec[i].b);
+
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[0]);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_NEGATIVE_POLARITY | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[1]);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[2]);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[3]);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[4]);
+    simde_assert_equal_i(simde_mm_cmpestri(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[5]);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_cmpestrm (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[16];
+    const int la;
+    const int8_t b[16];
+    const int lb;
+    const int8_t r[4][16];
+  } test_vec[] = {
+    { {  INT8_C( 109),  INT8_C( 122),  INT8_C(  65),  INT8_C(   1),  INT8_C( 122),  INT8_C( 109), -INT8_C(  70),  INT8_C(   1),
+       -INT8_C( 128),  INT8_C( 127),  INT8_C(  97),  INT8_C(  66), -INT8_C( 112),  INT8_C( 122),  INT8_C( 127),  INT8_C(  97) },
+      3,
+      {  INT8_C(  45),  INT8_C(  97), -INT8_C(   9),  INT8_C( 123),  INT8_C( 109),  INT8_C( 106),  INT8_C(  65),  INT8_C(   1),
+       -INT8_C(  99),  INT8_C(  97),  INT8_C(   1),  INT8_C( 127),  INT8_C(  51),  INT8_C( 109),  INT8_C( 111),  INT8_C( 122) },
+      16,
+      { {  INT8_C(  80), -INT8_C(  96),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+           -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        { -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } } },
+    { {  INT8_C(  98),  INT8_C(  65), -INT8_C( 128), -INT8_C( 121), -INT8_C(   1), -INT8_C( 128),  INT8_C( 127),  INT8_C(  98),
+        INT8_C( 127), -INT8_C(  19),  INT8_C(   1), -INT8_C( 128),  INT8_C(  98), -INT8_C(  85),  INT8_C( 127),  INT8_C(  99) },
+      -2,
+      {  INT8_C(  99), -INT8_C(  23), -INT8_C(   1),  INT8_C(  98),  INT8_C(  65), -INT8_C( 128), -INT8_C( 121), -INT8_C( 111),
+        INT8_C(   1),  INT8_C(   9),  INT8_C(  65),  INT8_C(  98),  INT8_C(  72), -INT8_C( 128), -INT8_C(   1), -INT8_C(  75) },
+      11,
+      { {  INT8_C(  24),  INT8_C(   4),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+           -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+        { -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } } },
+    { {  INT8_C(  98),  INT8_C(  99),  INT8_C(   1),  INT8_C(  65),  INT8_C(   1),  INT8_C( 109), -INT8_C(   1),  INT8_C(  65),
+        INT8_C( 108),  INT8_C( 122), -INT8_C( 128),  INT8_C(  65), -INT8_C( 128),  INT8_C( 127), -INT8_C(   1), -INT8_C(  27) },
+      13,
+      { -INT8_C(   1), -INT8_C(   1),  INT8_C( 122),  INT8_C(  98),  INT8_C(  99),  INT8_C(   1),  INT8_C(  65),  INT8_C( 122),
+        INT8_C(  44),  INT8_C( 127), -INT8_C(   1),  INT8_C(  99),  INT8_C( 109), -INT8_C(  87),  INT8_C(  97),  INT8_C( 109) },
+      2,
+      { {  INT8_C(   3),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        {  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+           -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+        {  INT8_C(   3),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } } },
+    { {  INT8_C(  65),  INT8_C( 109),  INT8_C( 122), -INT8_C(  55), -INT8_C(   1),  INT8_C(  39),  INT8_C( 109),  INT8_C(  98),
+        INT8_C(  99),  INT8_C(  99),  INT8_C( 122),  INT8_C(   1), -INT8_C(  73),  INT8_C(  99), -INT8_C(  71),  INT8_C(  47) },
+      -1,
+      {  INT8_C(  65),  INT8_C( 109),  INT8_C( 122), -INT8_C(  55),  INT8_C( 122),  INT8_C( 114),  INT8_C( 127),  INT8_C( 127),
+        INT8_C(  97),  INT8_C(  65),  INT8_C(  17),  INT8_C(   1),  INT8_C(  99),  INT8_C(   1),  INT8_C( 109), -INT8_C(   1) },
+      9,
+      { {  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+           -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+        { -INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        { -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } } },
+    { {  INT8_C(   1), -INT8_C(   1),  INT8_C(  65),  INT8_C(  99), -INT8_C(  76),  INT8_C(  21),  INT8_C( 109), -INT8_C(  97),
+        INT8_C( 122),  INT8_C(  97),  INT8_C(  50), -INT8_C(  15), -INT8_C( 128),  INT8_C(  98),  INT8_C(  65),  INT8_C( 127) },
+      12,
+      {  INT8_C( 109),  INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(  56),  INT8_C(  98), -INT8_C(  86),  INT8_C(  59),
+        INT8_C( 122),  INT8_C( 127),  INT8_C( 109),  INT8_C(  99),  INT8_C(   1), -INT8_C( 128),  INT8_C(  99),  INT8_C(  97) },
+      -1,
+      { {  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+           -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+        {  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } } },
+    { {  INT8_C(  65),  INT8_C(   1),  INT8_C( 122),  INT8_C( 118),  INT8_C(  78), -INT8_C(   1), -INT8_C( 128),  INT8_C( 122),
+        INT8_C(   1), -INT8_C( 128), -INT8_C(  31),  INT8_C(  98),  INT8_C(  98),  INT8_C(  65),  INT8_C( 127),  INT8_C(   1) },
+      -1,
+      {  INT8_C(  97),  INT8_C(  65),  INT8_C(   1), -INT8_C(  49),  INT8_C(  97),  INT8_C(  36), -INT8_C(   1),  INT8_C(  65),
+       -INT8_C(  47),  INT8_C(  80),  INT8_C( 109), -INT8_C(  55),  INT8_C(  98),  INT8_C( 122),  INT8_C(  99), -INT8_C(  30) },
+      7,
+      { {  INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+           -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+        { -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } } },
+    { { -INT8_C(  30),  INT8_C( 122),  INT8_C( 109),  INT8_C(  98),  INT8_C(  14), -INT8_C( 108), -INT8_C(   1), -INT8_C(  72),
+        INT8_C(  99), -INT8_C(  27),  INT8_C(   1),  INT8_C(  98),  INT8_C(  65), -INT8_C( 128), -INT8_C( 128),  INT8_C(  97) },
+      14,
+      {  INT8_C(   1),  INT8_C( 127),  INT8_C(   1),  INT8_C( 118),  INT8_C( 127), -INT8_C(   1),  INT8_C( 122),  INT8_C( 109),
+       -INT8_C(  96), -INT8_C(  41),  INT8_C(  26),  INT8_C(  97),  INT8_C(  65),  INT8_C(   1), -INT8_C(  38),  INT8_C(  83) },
+      4,
+      { {  INT8_C(   5),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        {  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+           -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+        {  INT8_C(  15),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } } },
+    { { -INT8_C(  68),  INT8_C( 109), -INT8_C( 128),  INT8_C(  70),  INT8_C( 109),  INT8_C( 115),  INT8_C( 120), -INT8_C(   1),
+        INT8_C(  97),  INT8_C(   1),  INT8_C(   1),  INT8_C(   1),  INT8_C( 127),  INT8_C(  65),  INT8_C( 127),  INT8_C(  98) },
+      -2,
+      {  INT8_C(  98),  INT8_C(  98),  INT8_C( 127), -INT8_C(  27), -INT8_C(  36),  INT8_C( 109), -INT8_C(  68),  INT8_C( 109),
+       -INT8_C( 128),  INT8_C(  70),  INT8_C( 109),  INT8_C( 127),  INT8_C( 120),  INT8_C( 109), -INT8_C(  89), -INT8_C(   1) },
+      3,
+      { {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        {  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+           -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+        { -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi8(test_vec[i].b);
+    simde__m128i r;
+
+    r = simde_mm_cmpestrm(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_BIT_MASK);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r[0]));
+    r = simde_mm_cmpestrm(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_NEGATIVE_POLARITY | SIMDE_SIDD_UNIT_MASK);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r[1]));
+    r = simde_mm_cmpestrm(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_BIT_MASK);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r[2]));
+    r = simde_mm_cmpestrm(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_UNIT_MASK);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r[3]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_cmpestra (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[16];
+    const int la;
+    const int8_t b[16];
+    const int lb;
+    const int r[6];
+  } test_vec[] = {
+    { {  INT8_C(  97), -INT8_C(   1),  INT8_C(   1),  INT8_C(  98),  INT8_C(  97),  INT8_C(  98),  INT8_C( 122), -INT8_C(  36),
+        INT8_C( 109),  INT8_C( 127), -INT8_C(   1), -INT8_C(  12),  INT8_C(  97), -INT8_C(   1),  INT8_C( 122),  INT8_C(  65) },
+      3,
+      { -INT8_C( 128),  INT8_C(  98),  INT8_C(  65),  INT8_C( 122), -INT8_C(  13),  INT8_C(  99), -INT8_C(  98),  INT8_C( 109),
+        INT8_C( 127),  INT8_C(  29), -INT8_C(  86), -INT8_C(   1), -INT8_C( 128), -INT8_C(  81), -INT8_C(   1),  INT8_C(  97) },
+      16,
+      {  0,  0,  0,  1,  0,  0 } },
+    { { -INT8_C( 128),  INT8_C(  56),  INT8_C(  99),  INT8_C( 122),  INT8_C(  98),  INT8_C(  99), -INT8_C(  40),  INT8_C( 109),
+        INT8_C( 109),  INT8_C(  39),  INT8_C(  65),  INT8_C(  65),  INT8_C( 127),  INT8_C(  34),  INT8_C(  98),  INT8_C(  78) },
+      -2,
+      {  INT8_C( 122),  INT8_C(  98),  INT8_C(  66),  INT8_C(  99),  INT8_C(  99),  INT8_C( 122), -INT8_C(   1),  INT8_C(   1),
+       -INT8_C(  70),  INT8_C(  97),  INT8_C( 122),  INT8_C(  97),  INT8_C(  98),  INT8_C(  98),  INT8_C( 109),  INT8_C( 109) },
+      3,
+      {  0,  0,  0,  0,  0,  0 } },
+    { {  INT8_C(  16),  INT8_C(  97),  INT8_C( 109),  INT8_C(  98), -INT8_C(   1),  INT8_C( 109),  INT8_C(  98),  INT8_C(  98),
+        INT8_C(   1),  INT8_C(  98),  INT8_C(  98),  INT8_C(  97),  INT8_C( 122),  INT8_C( 109), -INT8_C( 123), -INT8_C(   1) },
+      17,
+      { -INT8_C( 116),  INT8_C( 127),  INT8_C( 127),  INT8_C( 127),  INT8_C(  21), -INT8_C( 128),  INT8_C( 122),  INT8_C( 112),
+       -INT8_C( 100), -INT8_C(   1),  INT8_C(  61),  INT8_C(  43),  INT8_C(  98),  INT8_C(  99),  INT8_C(   1),  INT8_C(   1) },
+      -1,
+      {  0,  0,  0,  0,  0,  0 } },
+    { {  INT8_C(  98),  INT8_C(  83),  INT8_C(  97),  INT8_C( 109),  INT8_C(  65),  INT8_C(  97), -INT8_C(   1),  INT8_C(  99),
+       -INT8_C( 128),  INT8_C(  25),  INT8_C(  98), -INT8_C( 110),  INT8_C(   1), -INT8_C( 120),  INT8_C( 106), -INT8_C(   1) },
+      13,
+      { -INT8_C(  20),  INT8_C(  39),  INT8_C(  98),  INT8_C(  44),  INT8_C( 109),  INT8_C(  65), -INT8_C(  17), -INT8_C(   1),
+        INT8_C( 127),  INT8_C( 122), -INT8_C(   1),  INT8_C(   1), -INT8_C(   9),  INT8_C(  99),  INT8_C( 109), -INT8_C(  60) },
+      0,
+      {  0,  0,  0,  0,  0,  0 } },
+    { {  INT8_C(  99),  INT8_C(  98),  INT8_C(  98),  INT8_C(  60),  INT8_C(  65),  INT8_C( 127),  INT8_C(  78),  INT8_C(   1),
+       -INT8_C(   1), -INT8_C( 128),  INT8_C( 122),  INT8_C( 109),  INT8_C(   1), -INT8_C(  16), -INT8_C(   1), -INT8_C(   1) },
+      11,
+      { -INT8_C(   1),  INT8_C( 109),  INT8_C( 122), -INT8_C(  83), -INT8_C(  71),  INT8_C( 113),  INT8_C(  98),  INT8_C( 127),
+       -INT8_C(   4), -INT8_C(   1), -INT8_C( 116), -INT8_C(  92),  INT8_C(  97),  INT8_C( 109), -INT8_C( 128),  INT8_C( 109) },
+      0,
+      {  0,  0,  0,  0,  0,  0 } },
+    { {  INT8_C(  97),  INT8_C( 122),  INT8_C(  98),  INT8_C( 122), -INT8_C(   1),  INT8_C(  84),  INT8_C( 122),  INT8_C(  53),
+       -INT8_C(  87),  INT8_C( 109),  INT8_C( 122), -INT8_C(   1),  INT8_C(  29), -INT8_C( 118),  INT8_C(  24),  INT8_C(  97) },
+      5,
+      { -INT8_C(  11),  INT8_C(  62),  INT8_C(  65),  INT8_C( 109),  INT8_C( 127), -INT8_C( 128),  INT8_C(  99),  INT8_C(  65),
+        INT8_C(  98),  INT8_C(  98),  INT8_C(  98), -INT8_C( 128),  INT8_C( 109),  INT8_C(  97),  INT8_C(  98),  INT8_C( 127) },
+      4,
+      {  0,  0,  0,  0,  0,  0 } },
+    { { -INT8_C(   1),  INT8_C( 127),  INT8_C(  98), -INT8_C(  78),  INT8_C(  98),  INT8_C(  99),  INT8_C( 109),  INT8_C(  71),
+        INT8_C( 127),  INT8_C(  65),  INT8_C( 127),  INT8_C(   1), -INT8_C(   1), -INT8_C( 128),  INT8_C( 109),  INT8_C(  35) },
+      0,
+      {  INT8_C( 127),  INT8_C(   1), -INT8_C(  43),  INT8_C(  89), -INT8_C(   1),  INT8_C(   1),  INT8_C(  25),  INT8_C(  99),
+        INT8_C(  87),  INT8_C(  99),  INT8_C( 109),  INT8_C(  98),  INT8_C(  72),  INT8_C(  98),  INT8_C(  97),  INT8_C(  65) },
+      -3,
+      {  0,  0,  0,  0,  0,  0 } },
+    { {  INT8_C( 127),  INT8_C(  87),  INT8_C( 127),  INT8_C(   1), -INT8_C(  55),  INT8_C(  97),  INT8_C( 113),  INT8_C( 127),
+        INT8_C(  97),  INT8_C(  94),  INT8_C(  98),  INT8_C(   1),  INT8_C(  65),  INT8_C(  99),  INT8_C(  97),  INT8_C(  99) },
+      9,
+      {  INT8_C(  65),  INT8_C(  99),  INT8_C(  65), -INT8_C( 128),  INT8_C(  97), -INT8_C(  85), -INT8_C( 128),  INT8_C( 127),
+       -INT8_C( 128),  INT8_C( 127),  INT8_C(  98),  INT8_C( 113), -INT8_C(   1),  INT8_C( 127),  INT8_C(  66),  INT8_C( 119) },
+      9,
+      {  0,  0,  0,  1,  0,  0 } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi8(test_vec[i].b);
+
+    simde_assert_equal_i(simde_mm_cmpestra(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[0]);
+    simde_assert_equal_i(simde_mm_cmpestra(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_NEGATIVE_POLARITY | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[1]);
+    simde_assert_equal_i(simde_mm_cmpestra(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[2]);
+    simde_assert_equal_i(simde_mm_cmpestra(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[3]);
+    simde_assert_equal_i(simde_mm_cmpestra(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[4]);
+    simde_assert_equal_i(simde_mm_cmpestra(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[5]);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_cmpestrc (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[16];
+    const int la;
+    const int8_t b[16];
+    const int lb;
+    const int r[6];
+  } test_vec[] = {
+    { {  INT8_C(  65),  INT8_C(  65),  INT8_C(   1), -INT8_C( 128), -INT8_C(   1),  INT8_C( 106),  INT8_C(  65),  INT8_C( 122),
+        INT8_C(   1),  INT8_C( 109),  INT8_C( 116),  INT8_C(  65), -INT8_C(   1), -INT8_C(   1),  INT8_C( 109),  INT8_C(   1) },
+      3,
+      {  INT8_C( 109),  INT8_C(  80), -INT8_C(   4), -INT8_C(  27),  INT8_C(  65),  INT8_C(  65),  INT8_C(   1), -INT8_C( 128),
+       -INT8_C(   1),  INT8_C(   1), -INT8_C( 128),  INT8_C(  98),  INT8_C( 122),  INT8_C(  65), -INT8_C( 111),  INT8_C(   1) },
+      16,
+      {  1,  1,  1,  0,  1,  1 } },
+    { {  INT8_C(  99),  INT8_C( 122),  INT8_C(  98),  INT8_C(  99),  INT8_C(  17),  INT8_C(  65),  INT8_C(  99), -INT8_C(  78),
+        INT8_C(  65), -INT8_C(   1), -INT8_C( 128),  INT8_C(  41), -INT8_C(  18), -INT8_C(  51),  INT8_C(  97),  INT8_C( 127) },
+      11,
+      {  INT8_C(  99),  INT8_C( 122),  INT8_C(  98),  INT8_C(  99),  INT8_C(  97), -INT8_C( 128), -INT8_C(  22),  INT8_C(  34),
+       -INT8_C(  14),  INT8_C(   1),  INT8_C(  65), -INT8_C( 128),  INT8_C(  97),  INT8_C(  65),  INT8_C(   1),  INT8_C(  98) },
+      14,
+      {  1,  1,  1,  0,  0,  1 } },
+    { {  INT8_C(  98), -INT8_C(  87),  INT8_C(   1),  INT8_C(  38), -INT8_C(  97),  INT8_C(  65),  INT8_C( 127),  INT8_C(  38),
+       -INT8_C(   1),  INT8_C( 127),  INT8_C(  67),  INT8_C(  81),  INT8_C(  97),  INT8_C( 109),  INT8_C(  65),  INT8_C( 122) },
+      16,
+      {  INT8_C(  97), -INT8_C( 121),  INT8_C(  98), -INT8_C(  87),  INT8_C(   1), -INT8_C( 128),  INT8_C( 127), -INT8_C(   1),
+       -INT8_C(   1),  INT8_C( 101),  INT8_C( 122), -INT8_C( 128), -INT8_C(  93), -INT8_C(   1),  INT8_C( 127),  INT8_C(   1) },
+      16,
+      {  1,  1,  1,  0,  0,  1 } },
+    { { -INT8_C( 128),  INT8_C(  65), -INT8_C(  15),  INT8_C( 109),  INT8_C( 127),  INT8_C(  75),  INT8_C(  98), -INT8_C( 128),
+        INT8_C(   1),  INT8_C( 127),  INT8_C(  99),  INT8_C( 122),  INT8_C(  97),  INT8_C( 122), -INT8_C(   1),  INT8_C( 109) },
+      4,
+      { -INT8_C(  18),  INT8_C(  97),  INT8_C( 122),  INT8_C(  99),  INT8_C(  98),  INT8_C(  98),  INT8_C(  97), -INT8_C(  26),
+       -INT8_C( 128),  INT8_C( 122),  INT8_C( 127), -INT8_C(   1),  INT8_C(  15),  INT8_C( 109), -INT8_C(  52),  INT8_C(  97) },
+      19,
+      {  1,  1,  1,  0,  0,  1 } },
+    { {  INT8_C( 109),  INT8_C( 127),  INT8_C( 107),  INT8_C(  99), -INT8_C(   1),  INT8_C(   7),  INT8_C(  20),  INT8_C(  65),
+        INT8_C(  98), -INT8_C(   8),  INT8_C(  65),  INT8_C(  99), -INT8_C(   1), -INT8_C(  52), -INT8_C( 112),  INT8_C( 122) },
+      0,
+      {  INT8_C(  98),  INT8_C(  98), -INT8_C(  37), -INT8_C(   1),  INT8_C(  98),  INT8_C( 109),  INT8_C( 127),  INT8_C( 107),
+        INT8_C(  99),  INT8_C( 109),  INT8_C( 105),  INT8_C( 109), -INT8_C(  24),  INT8_C(  98), -INT8_C(   5),  INT8_C(  98) },
+      6,
+      {  0,  1,  1,  1,  1,  1 } },
+    { { -INT8_C(   1),  INT8_C(  97),  INT8_C( 122), -INT8_C(   1), -INT8_C(  21),  INT8_C(  99),  INT8_C(   1),  INT8_C( 122),
+        INT8_C(  65),  INT8_C( 122), -INT8_C(  21),  INT8_C( 122),  INT8_C( 127),  INT8_C(  99),  INT8_C( 122), -INT8_C(   2) },
+      -3,
+      {  INT8_C( 127),  INT8_C(  31), -INT8_C(  67),  INT8_C(  65), -INT8_C( 106), -INT8_C(  48), -INT8_C(   1),  INT8_C(  97),
+        INT8_C( 122),  INT8_C( 127),  INT8_C(   1), -INT8_C(  96),  INT8_C( 127),  INT8_C(   1),  INT8_C( 127),  INT8_C(  97) },
+      14,
+      {  1,  1,  1,  0,  1,  1 } },
+    { {  INT8_C(  99),  INT8_C(  97), -INT8_C( 128),  INT8_C( 122),  INT8_C( 122),  INT8_C( 122),  INT8_C( 122), -INT8_C( 128),
+        INT8_C( 127),  INT8_C(   1),  INT8_C( 109),  INT8_C( 109), -INT8_C( 128),  INT8_C(  99),  INT8_C(   1),  INT8_C(  98) },
+      -2,
+      { -INT8_C( 128),  INT8_C(   1),  INT8_C( 122), -INT8_C(   1),  INT8_C(  65),  INT8_C(  83),  INT8_C(  65),  INT8_C( 109),
+        INT8_C(  99),  INT8_C( 109),  INT8_C(  99),  INT8_C( 126),  INT8_C(  12),  INT8_C(  99),  INT8_C(  99),  INT8_C( 109) },
+      17,
+      {  1,  1,  1,  0,  0,  1 } },
+    { { -INT8_C( 128),  INT8_C(   1), -INT8_C(   1), -INT8_C(  98),  INT8_C(   1), -INT8_C( 128),  INT8_C(  98),  INT8_C(   1),
+        INT8_C(  97),  INT8_C( 127),  INT8_C(  80),  INT8_C(  99),  INT8_C( 122), -INT8_C( 128), -INT8_C(  71),  INT8_C( 109) },
+      17,
+      {  INT8_C(   1),  INT8_C(  97), -INT8_C(  24), -INT8_C(  51),  INT8_C( 109),  INT8_C(   1),  INT8_C(  97),  INT8_C( 109),
+        INT8_C(   1),  INT8_C( 127), -INT8_C(  66),  INT8_C(  65), -INT8_C( 128), -INT8_C(   1), -INT8_C(   1),  INT8_C( 122) },
+      -2,
+      {  1,  1,  1,  0,  0,  1 } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi8(test_vec[i].b);
+
+    simde_assert_equal_i(simde_mm_cmpestrc(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[0]);
+    simde_assert_equal_i(simde_mm_cmpestrc(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_NEGATIVE_POLARITY | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[1]);
+    simde_assert_equal_i(simde_mm_cmpestrc(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[2]);
+    simde_assert_equal_i(simde_mm_cmpestrc(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[3]);
+    simde_assert_equal_i(simde_mm_cmpestrc(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[4]);
+    simde_assert_equal_i(simde_mm_cmpestrc(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[5]);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_cmpestro (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[16];
+    const int la;
+    const int8_t b[16];
+    const int lb;
+    const int r[6];
+  } test_vec[] = {
+    { {  INT8_C(  97),  INT8_C( 109), -INT8_C( 128),  INT8_C(   1),  INT8_C(   3),  INT8_C(  65),  INT8_C(  65),  INT8_C(  97),
+       -INT8_C( 128), -INT8_C( 128),  INT8_C( 122), -INT8_C(  82),  INT8_C(  65),  INT8_C(  29),  INT8_C(  94),  INT8_C(  97) },
+      3,
+      { -INT8_C(   9),  INT8_C(  99),  INT8_C(  99),  INT8_C(  97),  INT8_C( 109),  INT8_C(   1),  INT8_C( 122), -INT8_C(   1),
+        INT8_C(  98),  INT8_C( 122),  INT8_C(   1), -INT8_C(  31),  INT8_C( 127), -INT8_C( 128),  INT8_C(   1),  INT8_C(  47) },
+      16,
+      {  0,  1,  1,  0,  0,  1 } },
+    { {  INT8_C(  97),  INT8_C(  99),  INT8_C(  52),  INT8_C(  65),  INT8_C( 109),  INT8_C(  98),  INT8_C( 127),  INT8_C( 127),
+       -INT8_C(  70),  INT8_C( 122),  INT8_C( 127), -INT8_C(  16),  INT8_C(  99),  INT8_C(  97),  INT8_C(  97),  INT8_C(  98) },
+      6,
+      { -INT8_C(  33),  INT8_C(  97),  INT8_C(  38),  INT8_C(  97),  INT8_C(   1),  INT8_C(  98), -INT8_C( 128), -INT8_C(   1),
+       -INT8_C( 128),  INT8_C(   1),  INT8_C(   1), -INT8_C( 128), -INT8_C(   1),  INT8_C(  99),  INT8_C(   1),  INT8_C(   1) },
+      -3,
+      {  0,  1,  1,  0,  0,  1 } },
+    { { -INT8_C(   1), -INT8_C(  51), -INT8_C(   1),  INT8_C(  99),  INT8_C(  98), -INT8_C(   2),  INT8_C(  65),  INT8_C(  99),
+        INT8_C(  99),  INT8_C(  65),  INT8_C( 122),  INT8_C( 122),  INT8_C(   1),  INT8_C( 120),  INT8_C( 127),  INT8_C( 127) },
+      2,
+      { -INT8_C(  81),  INT8_C( 122), -INT8_C( 128),  INT8_C(  99),  INT8_C(   3), -INT8_C(  20),  INT8_C(  98), -INT8_C(  18),
+        INT8_C(  31), -INT8_C(   1),  INT8_C( 122),  INT8_C( 127),  INT8_C(  99),  INT8_C(  84),  INT8_C( 127), -INT8_C(  43) },
+      6,
+      {  0,  1,  1,  0,  0,  1 } },
+    { {  INT8_C(  99),  INT8_C(  98), -INT8_C(  87),  INT8_C( 127),  INT8_C(  97),  INT8_C(  99),  INT8_C(  97),  INT8_C(  97),
+        INT8_C(   1),  INT8_C(  65),  INT8_C( 109),  INT8_C(   1),  INT8_C( 122),  INT8_C(  92),  INT8_C(  98), -INT8_C( 120) },
+      -3,
+      {  INT8_C(  99), -INT8_C( 128), -INT8_C(  50),  INT8_C(  65),  INT8_C( 122),  INT8_C( 122), -INT8_C(  82),  INT8_C( 127),
+       -INT8_C( 128), -INT8_C(  83),  INT8_C(   1),  INT8_C( 122),  INT8_C( 127),  INT8_C(  97),  INT8_C(  65),  INT8_C(  98) },
+      -1,
+      {  1,  1,  1,  0,  0,  1 } },
+    { { -INT8_C(   1),  INT8_C(  69),  INT8_C(  65),  INT8_C( 122),  INT8_C(  48),  INT8_C(  99), -INT8_C( 128),  INT8_C(   1),
+       -INT8_C(  39),  INT8_C(   6), -INT8_C(  70),  INT8_C(  99), -INT8_C(  53),  INT8_C( 109),  INT8_C( 124), -INT8_C( 128) },
+      9,
+      {  INT8_C(   1),  INT8_C(   1), -INT8_C(   1),  INT8_C(  69),  INT8_C(  65),  INT8_C( 122),  INT8_C(  48), -INT8_C( 128),
+        INT8_C(  97),  INT8_C( 122),  INT8_C(  99),  INT8_C(  98), -INT8_C(  69), -INT8_C(  75),  INT8_C( 122), -INT8_C( 111) },
+      18,
+      {  1,  0,  1,  0,  0,  1 } },
+    { { -INT8_C( 128),  INT8_C(  65),  INT8_C(  65),  INT8_C(   1),  INT8_C( 127),  INT8_C(  99), -INT8_C(  58),  INT8_C( 127),
+        INT8_C( 127),  INT8_C(  18),  INT8_C(  98),  INT8_C(  99),  INT8_C(  65),  INT8_C(  99),  INT8_C(  98), -INT8_C(  30) },
+      19,
+      {  INT8_C(   9),  INT8_C(   1),  INT8_C(   1), -INT8_C(  61),  INT8_C(  65),  INT8_C( 122), -INT8_C(   1), -INT8_C( 128),
+        INT8_C( 127), -INT8_C(   1),  INT8_C(  85),  INT8_C( 122),  INT8_C(  98),  INT8_C(   1),  INT8_C( 109),  INT8_C(  65) },
+      12,
+      {  0,  0,  1,  0,  0,  1 } },
+    { {  INT8_C(  99),  INT8_C(  61),  INT8_C(  98),  INT8_C( 122),  INT8_C(  97), -INT8_C(  88),  INT8_C(  65),  INT8_C(  99),
+        INT8_C( 122), -INT8_C( 116),  INT8_C(  99), -INT8_C(   1),  INT8_C( 122),  INT8_C(  99),  INT8_C(  97),  INT8_C(   1) },
+      9,
+      {  INT8_C(  97),  INT8_C(  19),  INT8_C(   1), -INT8_C( 128),  INT8_C(  97),  INT8_C(  97),  INT8_C(  97),  INT8_C(  98),
+        INT8_C( 106),  INT8_C( 109),  INT8_C(  99),  INT8_C(  98),  INT8_C( 109), -INT8_C(  69),  INT8_C(  99),  INT8_C(  73) },
+      -4,
+      {  1,  0,  1,  0,  0,  1 } },
+    { {  INT8_C(   1),  INT8_C( 109),  INT8_C(  98),  INT8_C(   1),  INT8_C(  99),  INT8_C( 109),  INT8_C(  98),  INT8_C( 122),
+        INT8_C( 122), -INT8_C(   1), -INT8_C( 120),  INT8_C(  79),  INT8_C(  70),  INT8_C(  99),  INT8_C(  97),  INT8_C(  96) },
+      14,
+      {  INT8_C(  55),  INT8_C(   1), -INT8_C(   9),  INT8_C(  98),  INT8_C(  99),  INT8_C(  65),  INT8_C(  97),  INT8_C(   1),
+        INT8_C( 109),  INT8_C(  98),  INT8_C(   1),  INT8_C(  99),  INT8_C( 109),  INT8_C(  19),  INT8_C( 122),  INT8_C( 108) },
+      0,
+      {  0,  1,  0,  0,  0,  0 } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi8(test_vec[i].b);
+
+    simde_assert_equal_i(simde_mm_cmpestro(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[0]);
+    simde_assert_equal_i(simde_mm_cmpestro(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_NEGATIVE_POLARITY | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[1]);
+    simde_assert_equal_i(simde_mm_cmpestro(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[2]);
+    simde_assert_equal_i(simde_mm_cmpestro(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[3]);
+    simde_assert_equal_i(simde_mm_cmpestro(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[4]);
+    simde_assert_equal_i(simde_mm_cmpestro(a, test_vec[i].la, b, test_vec[i].lb, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[5]);
+  }
+
+  return 0;
+}
+
 static int
 test_simde_mm_cmpestrs_8(SIMDE_MUNIT_TEST_ARGS) {
   const struct {
@@ -428,6 +897,385 @@ test_simde_mm_cmpgt_epi64(SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm_cmpistri (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[16];
+    const int8_t b[16];
+    const int r[6];
+  } test_vec[] = {
+    { {  INT8_C(   1),  INT8_C(  34),  INT8_C(   1),  INT8_C(  99),  INT8_C(  82),  INT8_C( 109),  INT8_C(   0),  INT8_C( 109),
+        INT8_C( 127), -INT8_C(   1),  INT8_C(   0), -INT8_C(  82),  INT8_C( 127), -INT8_C(   1),  INT8_C(   0), -INT8_C( 128) },
+      {  INT8_C(  42), -INT8_C(  35), -INT8_C( 128),  INT8_C( 127),  INT8_C( 122),  INT8_C( 109),  INT8_C( 122),  INT8_C( 109),
+        INT8_C( 122),  INT8_C(  25), -INT8_C(  43), -INT8_C(  74),  INT8_C( 108), -INT8_C(  15),  INT8_C(   0), -INT8_C(   1) },
+      {  5, 15,  0,  8, 16,  0 } },
+    { {  INT8_C(  55),  INT8_C(  24),  INT8_C(  46), -INT8_C(   1), -INT8_C( 128),  INT8_C( 127),  INT8_C( 109),  INT8_C(  65),
+        INT8_C(   0),  INT8_C(  99),  INT8_C(   1),  INT8_C( 127),  INT8_C(  99),  INT8_C(  97),  INT8_C(  98),  INT8_C(  98) },
+      { -INT8_C(  42),  INT8_C( 115),  INT8_C( 109),  INT8_C(  98),  INT8_C(  99), -INT8_C(   1),  INT8_C(  97), -INT8_C(   1),
+       -INT8_C( 117), -INT8_C( 120),  INT8_C( 127),  INT8_C(  99), -INT8_C(  73),  INT8_C( 127), -INT8_C( 128),  INT8_C(  99) },
+      {  2, 16,  0,  8, 16,  2 } },
+    { { -INT8_C(  38),  INT8_C(  97), -INT8_C(   1), -INT8_C(   1),  INT8_C(  98), -INT8_C( 128),  INT8_C( 109),  INT8_C(  23),
+        INT8_C(   1),  INT8_C(  65),  INT8_C(  65),  INT8_C( 109),  INT8_C(   0),  INT8_C(  65), -INT8_C(  48), -INT8_C( 128) },
+      {  INT8_C(  97),  INT8_C( 109), -INT8_C( 128),  INT8_C(  99), -INT8_C(  62),  INT8_C(  15), -INT8_C( 123),  INT8_C(  65),
+        INT8_C(  65), -INT8_C(   1),  INT8_C(  65), -INT8_C( 128),  INT8_C(  98),  INT8_C( 109),  INT8_C(  98), -INT8_C( 122) },
+      {  0, 15,  0,  8, 16,  2 } },
+    { {  INT8_C( 127),  INT8_C( 109), -INT8_C( 101),  INT8_C(  25),  INT8_C( 122),  INT8_C(  99), -INT8_C(  55),  INT8_C( 127),
+        INT8_C(  99),  INT8_C(  65),  INT8_C(  52),  INT8_C( 127),  INT8_C( 109), -INT8_C( 128), -INT8_C( 128),  INT8_C(   0) },
+      {  INT8_C( 127),  INT8_C( 109),  INT8_C(  16),  INT8_C(  99), -INT8_C(   8),  INT8_C(  72),  INT8_C(  97),  INT8_C(  98),
+        INT8_C(  74),  INT8_C( 114),  INT8_C(  99),  INT8_C(  97),  INT8_C(  65),  INT8_C(   1),  INT8_C(  99), -INT8_C(   7) },
+      {  0, 16,  1,  8, 16,  6 } },
+    { { -INT8_C( 128),  INT8_C( 127), -INT8_C(  84),  INT8_C( 127), -INT8_C(   1),  INT8_C(  97), -INT8_C( 118),  INT8_C(   1),
+        INT8_C( 127),  INT8_C(   1),  INT8_C(  66), -INT8_C( 128),  INT8_C(   0),  INT8_C(   1),  INT8_C( 109),  INT8_C( 127) },
+      {  INT8_C(  98),  INT8_C(  99),  INT8_C(  98),  INT8_C( 109),  INT8_C(   0),  INT8_C( 127),  INT8_C(  98),  INT8_C(  97),
+       -INT8_C(  23), -INT8_C(   1),  INT8_C(  99),  INT8_C( 119), -INT8_C( 128),  INT8_C(  65),  INT8_C( 109),  INT8_C(  79) },
+      { 16, 15,  0,  8, 16,  4 } },
+    { {  INT8_C(  65),  INT8_C(  86),  INT8_C(  98), -INT8_C(  67), -INT8_C(  47), -INT8_C(  78),  INT8_C( 109),  INT8_C( 122),
+        INT8_C( 127),  INT8_C( 110),  INT8_C(  97),  INT8_C(   0),  INT8_C(  99),  INT8_C(  99),  INT8_C(  97),  INT8_C( 109) },
+      {  INT8_C(  98), -INT8_C( 120),  INT8_C(  97),  INT8_C(  65),  INT8_C(  86),  INT8_C(  98), -INT8_C(  67), -INT8_C(  47),
+       -INT8_C( 128),  INT8_C(  98),  INT8_C( 122), -INT8_C( 101),  INT8_C( 127),  INT8_C(  97),  INT8_C(  65), -INT8_C(  45) },
+      {  0, 15,  0,  8, 16,  1 } },
+    { {  INT8_C(  97),  INT8_C( 125),  INT8_C(  65), -INT8_C(  91),  INT8_C(  98),  INT8_C(  97), -INT8_C(   1),  INT8_C( 109),
+        INT8_C(  99),  INT8_C( 109),  INT8_C( 109),  INT8_C( 127),  INT8_C( 122),  INT8_C(  98),  INT8_C( 109),  INT8_C(   0) },
+      {  INT8_C(  86), -INT8_C(  61),  INT8_C(  98),  INT8_C(  90),  INT8_C(  97),  INT8_C(  97),  INT8_C( 109),  INT8_C(   4),
+       -INT8_C(  73),  INT8_C( 122),  INT8_C(  98), -INT8_C( 128),  INT8_C( 127),  INT8_C( 122), -INT8_C(  22), -INT8_C( 128) },
+      {  2, 15,  0,  8, 16,  0 } },
+    { {  INT8_C(  97),  INT8_C(  99),  INT8_C( 125), -INT8_C( 128),  INT8_C(  58),  INT8_C(   1),  INT8_C(  98),  INT8_C(  98),
+        INT8_C(  65),  INT8_C( 127),  INT8_C( 109), -INT8_C( 128),  INT8_C( 122), -INT8_C(   1),  INT8_C(   0),  INT8_C(   1) },
+      {  INT8_C(   1),  INT8_C(  28),  INT8_C(   1),  INT8_C( 122),  INT8_C(   1), -INT8_C(  92),  INT8_C( 122),  INT8_C(  52),
+        INT8_C(   1),  INT8_C(   7),  INT8_C( 122), -INT8_C(  15),  INT8_C( 109),  INT8_C(  99), -INT8_C(  22),  INT8_C( 122) },
+      {  0, 14,  0,  8, 16,  2 } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi8(test_vec[i].b);
+
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[0]);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_NEGATIVE_POLARITY | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[1]);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[2]);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[3]);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[4]);
+    simde_assert_equal_i(simde_mm_cmpistri(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[5]);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_cmpistrm (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[16];
+    const int8_t b[16];
+    const int8_t r[4][16];
+  } test_vec[] = {
+    { {  INT8_C( 122),  INT8_C(   1),  INT8_C(  31),  INT8_C(  65), -INT8_C(   1),  INT8_C(  65), -INT8_C( 128),  INT8_C( 122),
+        INT8_C(  65),  INT8_C(   1),  INT8_C( 127), -INT8_C( 128),  INT8_C(   0),  INT8_C( 109),  INT8_C(  65),  INT8_C(  97) },
+      {  INT8_C(  99), -INT8_C( 128),  INT8_C(  97),  INT8_C( 109), -INT8_C( 128),  INT8_C( 127),  INT8_C( 127),  INT8_C(  40),
+        INT8_C(  98),  INT8_C( 127),  INT8_C(  86),  INT8_C(  82),  INT8_C( 109),  INT8_C( 109), -INT8_C(   1), -INT8_C(   1) },
+      { {  INT8_C( 114), -INT8_C(  62),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),
+            INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        { -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } } },
+    { {  INT8_C(  65),  INT8_C(  98), -INT8_C( 128),  INT8_C(  99), -INT8_C( 128),  INT8_C(   0),  INT8_C( 109),  INT8_C( 127),
+       -INT8_C( 128), -INT8_C(  80),  INT8_C(  65), -INT8_C(  96), -INT8_C(   1),  INT8_C( 109),  INT8_C( 109), -INT8_C( 128) },
+      { -INT8_C( 128),  INT8_C( 109),  INT8_C(   1),  INT8_C(  68), -INT8_C(   4),  INT8_C( 127),  INT8_C(  99),  INT8_C(  28),
+       -INT8_C(   1),  INT8_C( 109), -INT8_C( 128),  INT8_C(  65),  INT8_C(  99), -INT8_C(  65),  INT8_C(   1),  INT8_C(   1) },
+      { {  INT8_C(  65),  INT8_C(  28),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        {  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        { -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } } },
+    { {  INT8_C( 109),  INT8_C( 109),  INT8_C(  65), -INT8_C(  32),  INT8_C(  65),  INT8_C(  97),  INT8_C(   9),  INT8_C(   0),
+        INT8_C( 100),  INT8_C(  98),  INT8_C(  86),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(  78),  INT8_C(  65) },
+      {  INT8_C( 109),  INT8_C( 109),  INT8_C(  65), -INT8_C(   1), -INT8_C( 103),  INT8_C(   1),  INT8_C(  97),  INT8_C( 127),
+        INT8_C(  65),  INT8_C(  59), -INT8_C( 128),  INT8_C(  65),  INT8_C(   0), -INT8_C(  55),  INT8_C(  16),  INT8_C(   1) },
+      { {  INT8_C(  71),  INT8_C(   9),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+            INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+        { -INT8_C(   2),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } } },
+    { {  INT8_C(  99),  INT8_C(  65),  INT8_C(  65),  INT8_C(  97),  INT8_C(  99),  INT8_C( 122),  INT8_C(  98),  INT8_C( 109),
+       -INT8_C(   1),  INT8_C(   0), -INT8_C(  60),  INT8_C( 109), -INT8_C( 128), -INT8_C(  95),  INT8_C( 109), -INT8_C(  35) },
+      {  INT8_C(  97),  INT8_C(  99), -INT8_C(  61),  INT8_C(  91),  INT8_C(  65),  INT8_C(   0),  INT8_C( 122),  INT8_C(  65),
+       -INT8_C(   1),  INT8_C( 127),  INT8_C(  43), -INT8_C(   1),  INT8_C(  97),  INT8_C(  99),  INT8_C(   1),  INT8_C(  65) },
+      { {  INT8_C(  19),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        {  INT8_C(   0),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+           -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+        { -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } } },
+    { { -INT8_C(   1),  INT8_C(  91),  INT8_C( 127),  INT8_C( 122),  INT8_C(  74),  INT8_C(  42), -INT8_C(   1), -INT8_C( 128),
+        INT8_C(   1), -INT8_C(   1), -INT8_C(  23), -INT8_C( 128), -INT8_C( 128), -INT8_C( 128),  INT8_C(   0),  INT8_C( 122) },
+      {  INT8_C( 122),  INT8_C(   1), -INT8_C( 128),  INT8_C(  65), -INT8_C( 128),  INT8_C( 127),  INT8_C( 109),  INT8_C(  98),
+       -INT8_C( 128),  INT8_C( 109),  INT8_C( 127),  INT8_C(  98),  INT8_C( 123),  INT8_C(  19),  INT8_C( 109), -INT8_C(   1) },
+      { {  INT8_C(  55), -INT8_C( 123),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        { -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+            INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),  INT8_C(   0) },
+        { -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } } },
+    { { -INT8_C( 128),  INT8_C(  65), -INT8_C(  84),  INT8_C(  71), -INT8_C(   1), -INT8_C(  38), -INT8_C(   1),  INT8_C(   0),
+       -INT8_C(  66),  INT8_C( 122),  INT8_C(  99),  INT8_C( 127), -INT8_C( 128),  INT8_C(  65),  INT8_C(   1),  INT8_C(  97) },
+      {  INT8_C(  97), -INT8_C(  30), -INT8_C( 128),  INT8_C(  65),  INT8_C(  99),  INT8_C(  98), -INT8_C( 110),  INT8_C(  99),
+        INT8_C(  97),  INT8_C( 125),  INT8_C( 127), -INT8_C(  63),  INT8_C(   0),  INT8_C(  65),  INT8_C(   1),  INT8_C(  98) },
+      { {  INT8_C(  12),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        { -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1),
+           -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+        { -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } } },
+    { {  INT8_C(  98), -INT8_C(  30), -INT8_C(  38), -INT8_C(  15),  INT8_C( 127),  INT8_C(  97),  INT8_C(   0), -INT8_C(   1),
+       -INT8_C( 128),  INT8_C(  98), -INT8_C(  31),  INT8_C(  65),  INT8_C( 109),  INT8_C(  97),  INT8_C( 109),  INT8_C(  94) },
+      {  INT8_C(  99), -INT8_C(   1),  INT8_C( 108),  INT8_C(  99),  INT8_C( 127),  INT8_C( 109),  INT8_C(  21), -INT8_C(   1),
+        INT8_C(  98),  INT8_C(  10),  INT8_C(  97), -INT8_C( 122), -INT8_C(  96),  INT8_C( 109), -INT8_C( 128), -INT8_C( 128) },
+      { {  INT8_C(  16),  INT8_C(   5),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+           -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+        { -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } } },
+    { {  INT8_C(  86),  INT8_C(   1),  INT8_C(  65), -INT8_C( 128),  INT8_C(  97),  INT8_C(   0),  INT8_C(  97),  INT8_C(   1),
+        INT8_C(   0),  INT8_C(  65),  INT8_C(  65),  INT8_C(   0),  INT8_C(  65),  INT8_C(  56),  INT8_C(  99), -INT8_C( 128) },
+      {  INT8_C(  98),  INT8_C( 109),  INT8_C( 127),  INT8_C(  65),  INT8_C(  33),  INT8_C(  98),  INT8_C( 122),  INT8_C(  25),
+        INT8_C(  69), -INT8_C( 128),  INT8_C(  65), -INT8_C( 128),  INT8_C(  65),  INT8_C( 127),  INT8_C(  65),  INT8_C(   1) },
+      { {  INT8_C(   8), -INT8_C(  34),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        { -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),
+           -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1) },
+        { -INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) },
+        {  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),
+            INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0),  INT8_C(   0) } } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi8(test_vec[i].b);
+    simde__m128i r;
+
+    r = simde_mm_cmpistrm(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_BIT_MASK);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r[0]));
+    r = simde_mm_cmpistrm(a, b, SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_NEGATIVE_POLARITY | SIMDE_SIDD_UNIT_MASK);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r[1]));
+    r = simde_mm_cmpistrm(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_BIT_MASK);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r[2]));
+    r = simde_mm_cmpistrm(a, b, SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_UNIT_MASK);
+    simde_test_x86_assert_equal_i8x16(r, simde_x_mm_loadu_epi8(test_vec[i].r[3]));
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_cmpistra (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[16];
+    const int8_t b[16];
+    const int r[6];
+  } test_vec[] = {
+    { { -INT8_C( 128),  INT8_C(  65),  INT8_C(  99), -INT8_C(   1),  INT8_C( 109),  INT8_C( 109), -INT8_C( 128),  INT8_C(  97),
+        INT8_C(   0),  INT8_C(  97),  INT8_C(  98),  INT8_C( 109),  INT8_C(   1),  INT8_C( 109),  INT8_C(  99),  INT8_C(  82) },
+      {  INT8_C(  98), -INT8_C( 128),  INT8_C(   0),  INT8_C(  99), -INT8_C(   1),  INT8_C(  97), -INT8_C(  65), -INT8_C( 128),
+       -INT8_C(   1),  INT8_C(  98),  INT8_C(  74),  INT8_C( 127), -INT8_C(  37),  INT8_C(   1),  INT8_C(  98), -INT8_C( 128) },
+      {  0,  0,  0,  1,  0,  0 } },
+    { {  INT8_C(  97),  INT8_C(  97), -INT8_C(   1), -INT8_C( 128),  INT8_C(  98),  INT8_C(   0),  INT8_C(  47),  INT8_C(   0),
+        INT8_C(  36), -INT8_C(  43), -INT8_C(  29), -INT8_C(   1),  INT8_C( 109),  INT8_C(   0), -INT8_C(   1),  INT8_C(  99) },
+      {  INT8_C(  99),  INT8_C(  97),  INT8_C(  65), -INT8_C(   1),  INT8_C(  97),  INT8_C(  97),  INT8_C(  78),  INT8_C(   1),
+        INT8_C( 109),  INT8_C( 126),  INT8_C( 123), -INT8_C(   1), -INT8_C(   1),  INT8_C(  97), -INT8_C(   5),  INT8_C(  97) },
+      {  0,  0,  0,  1,  0,  1 } },
+    { {  INT8_C(  97), -INT8_C(  34),  INT8_C(  99), -INT8_C(  10),  INT8_C(  99),  INT8_C(   0), -INT8_C( 128),  INT8_C(  53),
+        INT8_C( 113),  INT8_C( 122),  INT8_C( 127), -INT8_C(  43),  INT8_C(  99),  INT8_C(  65),  INT8_C( 127), -INT8_C(  64) },
+      {  INT8_C( 109),  INT8_C(  65), -INT8_C(  23),  INT8_C(  65),  INT8_C( 122),  INT8_C(   1),  INT8_C( 122), -INT8_C(  60),
+       -INT8_C(   4),  INT8_C(  99),  INT8_C( 122),  INT8_C(  76),  INT8_C(   1),  INT8_C( 109),  INT8_C(   0),  INT8_C(  98) },
+      {  0,  0,  0,  1,  0,  1 } },
+    { {  INT8_C(  98),  INT8_C(  98),  INT8_C(   1),  INT8_C(  99), -INT8_C(  30),  INT8_C(  97),  INT8_C(   0), -INT8_C(  53),
+        INT8_C( 127), -INT8_C( 125),  INT8_C(   1),  INT8_C(   0),  INT8_C( 109),  INT8_C( 109),  INT8_C(   0),  INT8_C( 127) },
+      {  INT8_C(   1),  INT8_C(  65), -INT8_C(   1), -INT8_C( 122),  INT8_C( 127), -INT8_C( 128), -INT8_C(   6),  INT8_C( 127),
+        INT8_C( 109),  INT8_C(  18),  INT8_C( 109),  INT8_C(  98),  INT8_C(  65),  INT8_C( 122),  INT8_C( 109),  INT8_C(  65) },
+      {  0,  0,  0,  1,  1,  0 } },
+    { {  INT8_C( 122), -INT8_C(  32),  INT8_C( 122),  INT8_C(  61),  INT8_C(  54),  INT8_C(   0),  INT8_C(   1), -INT8_C(  83),
+        INT8_C(  98),  INT8_C(  99), -INT8_C(  38),  INT8_C( 122),  INT8_C(   1),  INT8_C(   0), -INT8_C(  67),  INT8_C(  65) },
+      {  INT8_C(  98), -INT8_C(   1), -INT8_C(  83),  INT8_C(  97),  INT8_C( 122), -INT8_C(  32),  INT8_C( 122),  INT8_C(  10),
+        INT8_C(   1),  INT8_C(  65), -INT8_C(  82),  INT8_C( 127),  INT8_C(  24),  INT8_C( 109),  INT8_C(   1),  INT8_C(  98) },
+      {  0,  0,  0,  1,  1,  0 } },
+    { { -INT8_C(   1),  INT8_C( 109),  INT8_C( 127),  INT8_C( 122),  INT8_C(   1),  INT8_C(   0),  INT8_C(   0),  INT8_C(  98),
+       -INT8_C(   1),  INT8_C(   0),  INT8_C(   1),  INT8_C(  99), -INT8_C(  81),  INT8_C(  36),  INT8_C(  65),  INT8_C( 104) },
+      {  INT8_C( 122), -INT8_C(   1), -INT8_C( 106), -INT8_C( 128),  INT8_C(   0),  INT8_C(  99), -INT8_C( 128),  INT8_C( 122),
+        INT8_C(  68), -INT8_C(   1), -INT8_C( 128),  INT8_C(  65),  INT8_C(  99),  INT8_C(   1),  INT8_C(  98),  INT8_C(  82) },
+      {  0,  0,  0,  1,  0,  0 } },
+    { {  INT8_C(   1),  INT8_C( 109),  INT8_C( 109),  INT8_C( 127),  INT8_C(   1),  INT8_C(  65),  INT8_C(  62), -INT8_C( 128),
+        INT8_C(  95),  INT8_C(  99),  INT8_C(  97),  INT8_C(   0), -INT8_C(  93),  INT8_C(  98),  INT8_C( 109),  INT8_C( 127) },
+      {  INT8_C(  99), -INT8_C(  25),  INT8_C(   1),  INT8_C(   1),  INT8_C( 109),  INT8_C( 109),  INT8_C( 127),  INT8_C(  97),
+       -INT8_C( 128),  INT8_C(  97),  INT8_C(  14), -INT8_C(   1),  INT8_C(   9),  INT8_C(   0),  INT8_C( 127),  INT8_C(  16) },
+      {  0,  0,  0,  1,  0,  0 } },
+    { { -INT8_C(  43), -INT8_C(  45),  INT8_C(  99),  INT8_C(   1),  INT8_C(   0),  INT8_C(  97),  INT8_C( 122),  INT8_C(  79),
+        INT8_C( 127),  INT8_C(  99), -INT8_C( 128),  INT8_C( 122),  INT8_C( 109), -INT8_C( 108), -INT8_C( 128),  INT8_C(  33) },
+      {  INT8_C( 109),  INT8_C(  65),  INT8_C(  97), -INT8_C( 121),  INT8_C(  65),  INT8_C(  98),  INT8_C(  65),  INT8_C(  65),
+       -INT8_C(   1),  INT8_C( 122),  INT8_C(  99), -INT8_C(  42),  INT8_C( 122), -INT8_C( 128),  INT8_C(   1), -INT8_C( 128) },
+      {  0,  0,  0,  1,  1,  0 } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi8(test_vec[i].b);
+
+    simde_assert_equal_i(simde_mm_cmpistra(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[0]);
+    simde_assert_equal_i(simde_mm_cmpistra(a, b, SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_NEGATIVE_POLARITY | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[1]);
+    simde_assert_equal_i(simde_mm_cmpistra(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[2]);
+    simde_assert_equal_i(simde_mm_cmpistra(a, b, SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[3]);
+    simde_assert_equal_i(simde_mm_cmpistra(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[4]);
+    simde_assert_equal_i(simde_mm_cmpistra(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[5]);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_cmpistrc (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[16];
+    const int8_t b[16];
+    const int r[6];
+  } test_vec[] = {
+    { { -INT8_C( 128),  INT8_C(  27),  INT8_C( 127),  INT8_C( 106),  INT8_C(  12), -INT8_C(   1),  INT8_C(   0),  INT8_C(  97),
+        INT8_C(   1),  INT8_C(   0),  INT8_C(   1),  INT8_C( 109),  INT8_C(   0),  INT8_C(  11), -INT8_C( 125),  INT8_C(  65) },
+      {  INT8_C( 122), -INT8_C( 128),  INT8_C(  99), -INT8_C( 128),  INT8_C(  27),  INT8_C( 127), -INT8_C(  12),  INT8_C( 127),
+        INT8_C(  35),  INT8_C(  97),  INT8_C(  65),  INT8_C(  97), -INT8_C( 128),  INT8_C( 109),  INT8_C( 109), -INT8_C(   1) },
+      {  1,  1,  1,  0,  0,  1 } },
+    { {  INT8_C(  98),  INT8_C(  68), -INT8_C(  86),  INT8_C(  98),  INT8_C(   0),  INT8_C( 120),  INT8_C( 109), -INT8_C(   1),
+        INT8_C( 109), -INT8_C(  47),  INT8_C( 122),  INT8_C(  98),  INT8_C(  97),  INT8_C(  99), -INT8_C( 128),  INT8_C(  98) },
+      { -INT8_C( 126),  INT8_C(  65),  INT8_C(  65),  INT8_C(  65),  INT8_C(   0), -INT8_C( 128),  INT8_C( 127),  INT8_C(  98),
+        INT8_C(   1),  INT8_C(  98),  INT8_C(  97),  INT8_C(  97),  INT8_C(  65), -INT8_C(  13), -INT8_C( 128),  INT8_C(  51) },
+      {  0,  1,  1,  0,  0,  1 } },
+    { { -INT8_C(  82), -INT8_C(   1),  INT8_C(  98), -INT8_C( 128),  INT8_C(  97),  INT8_C(  97),  INT8_C(  98),  INT8_C(  65),
+        INT8_C(  97), -INT8_C(  34),  INT8_C(  97),  INT8_C(  97), -INT8_C( 128),  INT8_C(   0),  INT8_C(  99), -INT8_C(  31) },
+      {  INT8_C( 122), -INT8_C(  82), -INT8_C(   1),  INT8_C(  98), -INT8_C( 128),  INT8_C(  99), -INT8_C(   6),  INT8_C(  65),
+        INT8_C(  65),  INT8_C(  16),  INT8_C(  72),  INT8_C(  98),  INT8_C(   1),  INT8_C(  34),  INT8_C(   0),  INT8_C(   1) },
+      {  1,  1,  1,  0,  0,  0 } },
+    { { -INT8_C(   1),  INT8_C(   1),  INT8_C( 122),  INT8_C(  97),  INT8_C(   0),  INT8_C(  99),  INT8_C(  98), -INT8_C( 101),
+        INT8_C( 127),  INT8_C(   1), -INT8_C(   1),  INT8_C(  83),  INT8_C(  65),  INT8_C( 127), -INT8_C( 128),  INT8_C(  61) },
+      {  INT8_C(  65),  INT8_C( 109), -INT8_C( 128), -INT8_C(   1),  INT8_C(   0),  INT8_C( 122),  INT8_C(  97),  INT8_C(  97),
+        INT8_C(  98),  INT8_C(  99),  INT8_C(  98),  INT8_C( 122), -INT8_C(  83),  INT8_C(  71), -INT8_C( 128),  INT8_C(  98) },
+      {  1,  1,  1,  0,  0,  1 } },
+    { {  INT8_C(  46),  INT8_C( 127),  INT8_C(  99),  INT8_C(  97),  INT8_C( 109),  INT8_C(   0),  INT8_C(  64),  INT8_C(   0),
+        INT8_C( 122),  INT8_C(   0),  INT8_C( 109),  INT8_C(  99),  INT8_C( 122),  INT8_C(  93),  INT8_C(  99),  INT8_C(  97) },
+      {  INT8_C(  99),  INT8_C( 127),  INT8_C(  46),  INT8_C( 127),  INT8_C(  99),  INT8_C(  97),  INT8_C( 115),  INT8_C(  98),
+        INT8_C( 112), -INT8_C( 128),  INT8_C(  31),  INT8_C( 109),  INT8_C( 127),  INT8_C(  65),  INT8_C(   1), -INT8_C( 128) },
+      {  1,  1,  1,  0,  0,  1 } },
+    { {  INT8_C(  99),  INT8_C(  97), -INT8_C(   6),  INT8_C(  97),  INT8_C(  97),  INT8_C(  99),  INT8_C(  65),  INT8_C(  98),
+        INT8_C( 122),  INT8_C(  99),  INT8_C(  65),  INT8_C(  65), -INT8_C(  53),  INT8_C(  98),  INT8_C(   0),  INT8_C(   3) },
+      {  INT8_C(  98),  INT8_C( 109),  INT8_C(  99),  INT8_C(  98),  INT8_C(  97),  INT8_C(  65),  INT8_C( 113),  INT8_C(  97),
+        INT8_C( 127),  INT8_C(   1),  INT8_C( 109),  INT8_C(  97), -INT8_C(   1),  INT8_C( 109),  INT8_C(   0), -INT8_C( 128) },
+      {  1,  1,  1,  0,  0,  1 } },
+    { { -INT8_C( 128),  INT8_C(  98),  INT8_C( 122),  INT8_C( 125),  INT8_C(  99),  INT8_C(  98),  INT8_C(   1),  INT8_C( 122),
+        INT8_C(  65),  INT8_C(   1),  INT8_C(   1),  INT8_C(  65),  INT8_C(  98), -INT8_C(   1),  INT8_C(   0),  INT8_C(  97) },
+      {  INT8_C( 109),  INT8_C( 122),  INT8_C(  97),  INT8_C(  97), -INT8_C(   1),  INT8_C(  65),  INT8_C( 122),  INT8_C(   1),
+       -INT8_C( 128),  INT8_C(  65), -INT8_C(  21),  INT8_C(  86),  INT8_C(  97),  INT8_C( 109),  INT8_C(  76),  INT8_C(   1) },
+      {  1,  0,  1,  0,  0,  1 } },
+    { {  INT8_C(  65),  INT8_C(  99),  INT8_C(   1),  INT8_C(  98),  INT8_C( 109),  INT8_C(  97),  INT8_C(  97), -INT8_C(   1),
+        INT8_C(  99), -INT8_C(  35),  INT8_C(  99), -INT8_C(  24),  INT8_C(   0),  INT8_C( 122),  INT8_C(  97),  INT8_C(  96) },
+      { -INT8_C(  43), -INT8_C( 128),  INT8_C(  65),  INT8_C(  99),  INT8_C(   1),  INT8_C(  97),  INT8_C( 127),  INT8_C(  98),
+       -INT8_C(  87),  INT8_C(  98),  INT8_C(  98), -INT8_C(   1), -INT8_C(   1),  INT8_C( 122),  INT8_C(  65),  INT8_C( 127) },
+      {  1,  1,  1,  0,  0,  1 } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi8(test_vec[i].b);
+
+    simde_assert_equal_i(simde_mm_cmpistrc(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[0]);
+    simde_assert_equal_i(simde_mm_cmpistrc(a, b, SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_NEGATIVE_POLARITY | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[1]);
+    simde_assert_equal_i(simde_mm_cmpistrc(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[2]);
+    simde_assert_equal_i(simde_mm_cmpistrc(a, b, SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[3]);
+    simde_assert_equal_i(simde_mm_cmpistrc(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[4]);
+    simde_assert_equal_i(simde_mm_cmpistrc(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[5]);
+  }
+
+  return 0;
+}
+
+static int
+test_simde_mm_cmpistro (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    const int8_t a[16];
+    const int8_t b[16];
+    const int r[6];
+  } test_vec[] = {
+    { {  INT8_C(  33),  INT8_C(   1),  INT8_C(  65), -INT8_C( 128),  INT8_C( 109),  INT8_C(   1), -INT8_C(  11),  INT8_C( 127),
+        INT8_C(  97), -INT8_C(   1), -INT8_C(   1), -INT8_C(  62), -INT8_C( 128),  INT8_C( 122),  INT8_C(   0),  INT8_C( 122) },
+      {  INT8_C(  99),  INT8_C( 122),  INT8_C(  89),  INT8_C( 122),  INT8_C( 105),  INT8_C( 122),  INT8_C(  97),  INT8_C(  78),
+        INT8_C(  98),  INT8_C( 122),  INT8_C(  26), -INT8_C(  31),  INT8_C( 109),  INT8_C(  73),  INT8_C(   1),  INT8_C( 122) },
+      {  0,  0,  1,  0,  0,  0 } },
+    { { -INT8_C(  90), -INT8_C( 110),  INT8_C( 122), -INT8_C( 128),  INT8_C( 109),  INT8_C(   1),  INT8_C(  99),  INT8_C(  20),
+        INT8_C(  99),  INT8_C( 109), -INT8_C(  59),  INT8_C( 109),  INT8_C( 127),  INT8_C(  98), -INT8_C(  17),  INT8_C(   0) },
+      { -INT8_C(   1), -INT8_C(  98),  INT8_C(   1),  INT8_C(  98),  INT8_C(  98), -INT8_C(  45), -INT8_C(  90),  INT8_C(   0),
+        INT8_C( 122),  INT8_C(  26), -INT8_C(   1),  INT8_C(  97), -INT8_C(  76), -INT8_C(  18),  INT8_C( 122), -INT8_C(   3) },
+      {  0,  0,  1,  0,  0,  1 } },
+    { {  INT8_C(   1),  INT8_C(  97),  INT8_C(   1), -INT8_C(   1),  INT8_C(   0), -INT8_C(  64), -INT8_C(   1),  INT8_C(   1),
+        INT8_C(  30),  INT8_C( 122),  INT8_C(  32), -INT8_C(   1),  INT8_C(  97),  INT8_C( 109),  INT8_C( 109),  INT8_C(  97) },
+      {  INT8_C( 109),  INT8_C( 127),  INT8_C(   1),  INT8_C(  97),  INT8_C(   0),  INT8_C( 109), -INT8_C( 128),  INT8_C(  33),
+        INT8_C(  97),  INT8_C(   7),  INT8_C(  99), -INT8_C(   1),  INT8_C(  65),  INT8_C( 109),  INT8_C(  97),  INT8_C(   1) },
+      {  0,  1,  1,  0,  0,  0 } },
+    { { -INT8_C( 102),  INT8_C( 109),  INT8_C(   1), -INT8_C(  51), -INT8_C( 113), -INT8_C( 128),  INT8_C(  99),  INT8_C(   0),
+        INT8_C(  99),  INT8_C(  99),  INT8_C(  65),  INT8_C(  97),  INT8_C(   0),  INT8_C(  65),  INT8_C(  98), -INT8_C(  69) },
+      {  INT8_C( 109),  INT8_C(  48),  INT8_C(   1),  INT8_C(  65),  INT8_C(  98),  INT8_C(  65),  INT8_C( 122), -INT8_C(   1),
+        INT8_C(   1),  INT8_C(  24),  INT8_C( 111),  INT8_C(  65),  INT8_C(  69),  INT8_C(  97),  INT8_C( 127),  INT8_C(  65) },
+      {  1,  0,  1,  0,  0,  1 } },
+    { {  INT8_C(  99),  INT8_C( 127),  INT8_C(  48),  INT8_C(  97),  INT8_C(  88), -INT8_C(  71),  INT8_C(  65), -INT8_C( 128),
+        INT8_C(  99), -INT8_C( 128),  INT8_C(   0),  INT8_C( 122),  INT8_C(  98),  INT8_C(  98),  INT8_C(  99),  INT8_C(  98) },
+      {  INT8_C(  99),  INT8_C(  97),  INT8_C(   1),  INT8_C( 122), -INT8_C( 124),  INT8_C( 109),  INT8_C(  99),  INT8_C( 127),
+        INT8_C(  48),  INT8_C(  65),  INT8_C(  98),  INT8_C(  99), -INT8_C(   1),  INT8_C(  99),  INT8_C( 108),  INT8_C(  98) },
+      {  1,  0,  1,  0,  0,  1 } },
+    { { -INT8_C( 128),  INT8_C( 127),  INT8_C(  97),  INT8_C( 122),  INT8_C(  65),  INT8_C(  99),  INT8_C(   0),  INT8_C(   0),
+        INT8_C(   0), -INT8_C( 128), -INT8_C(   1),  INT8_C(   1),  INT8_C( 109),  INT8_C(  25), -INT8_C(   1),  INT8_C(   1) },
+      {  INT8_C( 109),  INT8_C(  83),  INT8_C( 109), -INT8_C( 128),  INT8_C( 127),  INT8_C( 127), -INT8_C(  47),  INT8_C(  98),
+        INT8_C(   0), -INT8_C( 128), -INT8_C(   1),  INT8_C( 109),  INT8_C( 122),  INT8_C( 122),  INT8_C( 122), -INT8_C( 128) },
+      {  0,  0,  1,  0,  0,  1 } },
+    { {  INT8_C(  98),  INT8_C( 122),  INT8_C(  99),  INT8_C(   1),  INT8_C( 122),  INT8_C(   0),  INT8_C(  99),  INT8_C(  97),
+        INT8_C( 109),  INT8_C(  97),  INT8_C(  65),  INT8_C(   1),  INT8_C(  65),  INT8_C(  98),  INT8_C( 122),  INT8_C( 115) },
+      {  INT8_C(   2),  INT8_C( 127), -INT8_C( 128),  INT8_C( 122), -INT8_C(  90), -INT8_C(   1),  INT8_C(  85),  INT8_C(  98),
+        INT8_C( 122), -INT8_C(  56),  INT8_C( 108),  INT8_C(  99), -INT8_C(  78), -INT8_C(   1), -INT8_C(   1),  INT8_C(  99) },
+      {  0,  1,  1,  0,  0,  1 } },
+    { {  INT8_C( 127), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C( 109),  INT8_C( 109),  INT8_C(  99), -INT8_C( 111),
+        INT8_C(  98),  INT8_C( 127),  INT8_C(  83),  INT8_C(  65),  INT8_C(   0), -INT8_C(   1), -INT8_C(  92),  INT8_C(   1) },
+      {  INT8_C( 127), -INT8_C(   1), -INT8_C(   1), -INT8_C(   1),  INT8_C(   0),  INT8_C( 109), -INT8_C(  85),  INT8_C( 127),
+       -INT8_C( 126),  INT8_C( 109), -INT8_C( 108),  INT8_C(   1),  INT8_C( 127),  INT8_C(  65),  INT8_C(   1),  INT8_C( 109) },
+      {  1,  0,  0,  0,  0,  0 } }
+  };
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    simde__m128i a = simde_x_mm_loadu_epi8(test_vec[i].a);
+    simde__m128i b = simde_x_mm_loadu_epi8(test_vec[i].b);
+
+    simde_assert_equal_i(simde_mm_cmpistro(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ANY | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[0]);
+    simde_assert_equal_i(simde_mm_cmpistro(a, b, SIMDE_SIDD_SBYTE_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_NEGATIVE_POLARITY | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[1]);
+    simde_assert_equal_i(simde_mm_cmpistro(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_EQUAL_EACH | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[2]);
+    simde_assert_equal_i(simde_mm_cmpistro(a, b, SIMDE_SIDD_SWORD_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_MOST_SIGNIFICANT), test_vec[i].r[3]);
+    simde_assert_equal_i(simde_mm_cmpistro(a, b, SIMDE_SIDD_UBYTE_OPS | SIMDE_SIDD_CMP_EQUAL_ORDERED | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[4]);
+    simde_assert_equal_i(simde_mm_cmpistro(a, b, SIMDE_SIDD_UWORD_OPS | SIMDE_SIDD_CMP_RANGES | SIMDE_SIDD_MASKED_NEGATIVE_POLARITY | SIMDE_SIDD_LEAST_SIGNIFICANT), test_vec[i].r[5]);
+  }
+
+  return 0;
+}
+
 static int
 test_simde_mm_cmpistrs_8(SIMDE_MUNIT_TEST_ARGS) {
   const struct {
@@ -1063,12 +1911,58 @@ test_simde_mm_crc32_u64 (SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_x_crc32c_buffer (SIMDE_MUNIT_TEST_ARGS) {
+  static const struct {
+    uint32_t crc;
+    size_t len;
+    uint32_t r;
+  } test_vec[] = {
+    { UINT32_C(0xffffffff),    0, UINT32_C(0xffffffff) },
+    { UINT32_C(0x12345678),    1, UINT32_C(0x7baedb01) },
+    { UINT32_C(0x00000000),    7, UINT32_C(0x6ab6a352) },
+    { UINT32_C(0xdeadbeef),    8, UINT32_C(0xa1d4a8ab) },
+    { UINT32_C(0xffffffff),  100, UINT32_C(0xca184f07) },
+    { UINT32_C(0x01234567),  767, UINT32_C(0xcf5e2483) },
+    { UINT32_C(0xffffffff),  768, UINT32_C(0xa7f4949a) },
+    { UINT32_C(0x89abcdef), 1000, UINT32_C(0x97b319cb) },
+    { UINT32_C(0xffffffff), 2500, UINT32_C(0x3219b8a5) }
+  };
+
+  static uint8_t buf[2500];
+  uint32_t state = UINT32_C(0x9e3779b9);
+  for (size_t i = 0 ; i < (sizeof(buf) / sizeof(buf[0])) ; i++) {
+    state = (state * UINT32_C(1103515245)) + UINT32_C(12345);
+    buf[i] = HEDLEY_STATIC_CAST(uint8_t, state >> 24);
+  }
+
+  for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
+    uint32_t r = simde_x_crc32c_buffer(test_vec[i].crc, buf, test_vec[i].len);
+    simde_assert_equal_u32(r, test_vec[i].r);
+  }
+
+  /* The standard CRC32C check value. */
+  simde_assert_equal_u32(~simde_x_crc32c_buffer(~UINT32_C(0), "123456789", 9), UINT32_C(0xe3069283));
+
+  return 0;
+}
+
 SIMDE_TEST_FUNC_LIST_BEGIN
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestri)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestrm)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestra)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestrc)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestro)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestrs_8)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestrs_16)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestrz_8)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpestrz_16)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpgt_epi64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistri)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistrm)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistra)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistrc)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistro)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistrs_8)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistrs_16)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cmpistrz_8)
@@ -1077,6 +1971,7 @@ SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_crc32_u16)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_crc32_u32)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_crc32_u64)
+  SIMDE_TEST_FUNC_LIST_ENTRY(x_crc32c_buffer)
 SIMDE_TEST_FUNC_LIST_END
 
 #include <test/x86/test-x86-footer.h>
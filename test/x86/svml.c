@@ -26,6 +26,127 @@
 #include <test/x86/avx512/test-avx512.h>
 #include <simde/x86/svml.h>
 
+/* The tests with hard-coded vectors only check a couple of decimal
+ * places; the *_ulp tests check sin, cos, exp and log against libm
+ * over a few thousand inputs.  The error target, like SVML's, is 4 ULP
+ * by default and 1 ULP with SIMDE_ACCURACY_PREFERENCE > 1. */
+#if SIMDE_ACCURACY_PREFERENCE > 1
+  #define SIMDE_TEST_SVML_MAX_ULP 1
+#else
+  #define SIMDE_TEST_SVML_MAX_ULP 4
+#endif
+
+#define SIMDE_TEST_SVML_ULP_SAMPLES 4096
+
+typedef enum SimdeTestSvmlFunc {
+  SIMDE_TEST_SVML_SIN,
+  SIMDE_TEST_SVML_COS,
+  SIMDE_TEST_SVML_EXP,
+  SIMDE_TEST_SVML_LOG
+} SimdeTestSvmlFunc;
+
+static simde_float64
+simde_test_svml_ref_(SimdeTestSvmlFunc func, simde_float64 v) {
+  switch (func) {
+    case SIMDE_TEST_SVML_SIN: return simde_math_sin(v);
+    case SIMDE_TEST_SVML_COS: return simde_math_cos(v);
+    case SIMDE_TEST_SVML_EXP: return simde_math_exp(v);
+    case SIMDE_TEST_SVML_LOG: return simde_math_log(v);
+  }
+  return SIMDE_MATH_NAN;
+}
+
+/* Inputs spread evenly over [min, max] (or over [log(min), log(max)]
+ * if log_scale is set), in a scrambled order. */
+static void
+simde_test_svml_inputs_f64_(size_t count, simde_float64 values[HEDLEY_ARRAY_PARAM(count)], simde_float64 min, simde_float64 max, int log_scale) {
+  const simde_float64 lo = log_scale ? simde_math_log(min) : min;
+  const simde_float64 hi = log_scale ? simde_math_log(max) : max;
+
+  for (size_t i = 0 ; i < count ; i++) {
+    simde_float64 u = HEDLEY_STATIC_CAST(simde_float64, i) * SIMDE_FLOAT64_C(0.618033988749894848204586834365638118);
+    u -= simde_math_floor(u);
+    values[i] = lo + ((hi - lo) * u);
+    if (log_scale)
+      values[i] = simde_math_exp(values[i]);
+  }
+}
+
+static void
+simde_test_svml_inputs_f32_(size_t count, simde_float32 values[HEDLEY_ARRAY_PARAM(count)], simde_float32 min, simde_float32 max, int log_scale) {
+  simde_float64 v[SIMDE_TEST_SVML_ULP_SAMPLES];
+
+  simde_test_svml_inputs_f64_(count, v, HEDLEY_STATIC_CAST(simde_float64, min), HEDLEY_STATIC_CAST(simde_float64, max), log_scale);
+  for (size_t i = 0 ; i < count ; i++)
+    values[i] = HEDLEY_STATIC_CAST(simde_float32, v[i]);
+}
+
+/* Distance between a and b in units in the last place. */
+static uint64_t
+simde_test_svml_ulp_f32_(simde_float32 a, simde_float32 b) {
+  int32_t ia, ib;
+  int64_t oa, ob;
+
+  if (simde_math_isnanf(a) || simde_math_isnanf(b))
+    return (simde_math_isnanf(a) && simde_math_isnanf(b)) ? 0 : UINT64_MAX;
+
+  simde_memcpy(&ia, &a, sizeof(ia));
+  simde_memcpy(&ib, &b, sizeof(ib));
+  oa = (ia < 0) ? (INT64_C(-2147483648) - ia) : ia;
+  ob = (ib < 0) ? (INT64_C(-2147483648) - ib) : ib;
+
+  return HEDLEY_STATIC_CAST(uint64_t, (oa > ob) ? (oa - ob) : (ob - oa));
+}
+
+static uint64_t
+simde_test_svml_ulp_f64_(simde_float64 a, simde_float64 b) {
+  int64_t ia, ib, oa, ob;
+
+  if (simde_math_isnan(a) || simde_math_isnan(b))
+    return (simde_math_isnan(a) && simde_math_isnan(b)) ? 0 : UINT64_MAX;
+
+  simde_memcpy(&ia, &a, sizeof(ia));
+  simde_memcpy(&ib, &b, sizeof(ib));
+  oa = (ia < 0) ? (INT64_MIN - ia) : ia;
+  ob = (ib < 0) ? (INT64_MIN - ib) : ib;
+
+  return (oa > ob) ?
+    (HEDLEY_STATIC_CAST(uint64_t, oa) - HEDLEY_STATIC_CAST(uint64_t, ob)) :
+    (HEDLEY_STATIC_CAST(uint64_t, ob) - HEDLEY_STATIC_CAST(uint64_t, oa));
+}
+
+static int
+simde_test_svml_assert_ulp_f32_(size_t count, simde_float32 const a[HEDLEY_ARRAY_PARAM(count)], simde_float32 const r[HEDLEY_ARRAY_PARAM(count)], SimdeTestSvmlFunc func,
+    const char* filename, int line) {
+  for (size_t i = 0 ; i < count ; i++) {
+    const simde_float32 e = HEDLEY_STATIC_CAST(simde_float32, simde_test_svml_ref_(func, HEDLEY_STATIC_CAST(simde_float64, a[i])));
+    const uint64_t ulp = simde_test_svml_ulp_f32_(r[i], e);
+    if (HEDLEY_UNLIKELY(ulp > SIMDE_TEST_SVML_MAX_ULP)) {
+      simde_test_debug_printf_("%s:%d: assertion failed: f(%.9g) = %.9g, expected %.9g (%" PRIu64 " ULP > %d)\n",
+        filename, line, HEDLEY_STATIC_CAST(double, a[i]), HEDLEY_STATIC_CAST(double, r[i]), HEDLEY_STATIC_CAST(double, e), ulp, SIMDE_TEST_SVML_MAX_ULP);
+      SIMDE_TEST_ASSERT_RETURN(1);
+    }
+  }
+  return 0;
+}
+#define simde_test_svml_assert_ulp_f32(count, a, r, func) simde_test_svml_assert_ulp_f32_(count, a, r, func, __FILE__, __LINE__)
+
+static int
+simde_test_svml_assert_ulp_f64_(size_t count, simde_float64 const a[HEDLEY_ARRAY_PARAM(count)], simde_float64 const r[HEDLEY_ARRAY_PARAM(count)], SimdeTestSvmlFunc func,
+    const char* filename, int line) {
+  for (size_t i = 0 ; i < count ; i++) {
+    const simde_float64 e = simde_test_svml_ref_(func, a[i]);
+    const uint64_t ulp = simde_test_svml_ulp_f64_(r[i], e);
+    if (HEDLEY_UNLIKELY(ulp > SIMDE_TEST_SVML_MAX_ULP)) {
+      simde_test_debug_printf_("%s:%d: assertion failed: f(%.17g) = %.17g, expected %.17g (%" PRIu64 " ULP > %d)\n",
+        filename, line, a[i], r[i], e, ulp, SIMDE_TEST_SVML_MAX_ULP);
+      SIMDE_TEST_ASSERT_RETURN(1);
+    }
+  }
+  return 0;
+}
+#define simde_test_svml_assert_ulp_f64(count, a, r, func) simde_test_svml_assert_ulp_f64_(count, a, r, func, __FILE__, __LINE__)
+
 static int
 test_simde_mm_acos_ps(SIMDE_MUNIT_TEST_ARGS) {
   const struct {
@@ -5714,12 +5835,24 @@ test_simde_mm_cos_ps(SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm_cos_ps_ulp(SIMDE_MUNIT_TEST_ARGS) {
+  simde_float32 a[SIMDE_TEST_SVML_ULP_SAMPLES], r[SIMDE_TEST_SVML_ULP_SAMPLES];
+
+  simde_test_svml_inputs_f32_(SIMDE_TEST_SVML_ULP_SAMPLES / 2, a, SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0), 0);
+  simde_test_svml_inputs_f32_(SIMDE_TEST_SVML_ULP_SAMPLES / 2, &(a[SIMDE_TEST_SVML_ULP_SAMPLES / 2]), SIMDE_FLOAT32_C(-8192.0), SIMDE_FLOAT32_C(8192.0), 0);
+  for (size_t i = 0 ; i < SIMDE_TEST_SVML_ULP_SAMPLES ; i += 4)
+    simde_mm_storeu_ps(&(r[i]), simde_mm_cos_ps(simde_mm_loadu_ps(&(a[i]))));
+
+  return simde_test_svml_assert_ulp_f32(SIMDE_TEST_SVML_ULP_SAMPLES, a, r, SIMDE_TEST_SVML_COS);
+}
+
 static int
 test_simde_mm_cos_pd(SIMDE_MUNIT_TEST_ARGS) {
   const struct {
     simde__m128d a;
     simde__m128d r;
-  } test_vec[8] = {
+  } test_vec[9] = {
     { simde_mm_set_pd(SIMDE_FLOAT64_C( -754.38), SIMDE_FLOAT64_C(  346.63)),
       simde_mm_set_pd(SIMDE_FLOAT64_C(    0.92), SIMDE_FLOAT64_C(    0.49)) },
     { simde_mm_set_pd(SIMDE_FLOAT64_C( -186.21), SIMDE_FLOAT64_C(   39.01)),
@@ -5735,7 +5868,9 @@ test_simde_mm_cos_pd(SIMDE_MUNIT_TEST_ARGS) {
     { simde_mm_set_pd(SIMDE_FLOAT64_C(   84.77), SIMDE_FLOAT64_C(  571.46)),
       simde_mm_set_pd(SIMDE_FLOAT64_C(   -1.00), SIMDE_FLOAT64_C(    0.95)) },
     { simde_mm_set_pd(SIMDE_FLOAT64_C( -678.17), SIMDE_FLOAT64_C( -686.13)),
-      simde_mm_set_pd(SIMDE_FLOAT64_C(    0.92), SIMDE_FLOAT64_C(    0.30)) }
+      simde_mm_set_pd(SIMDE_FLOAT64_C(    0.92), SIMDE_FLOAT64_C(    0.30)) },
+    { simde_mm_set_pd(SIMDE_FLOAT64_C(2000000.00), SIMDE_FLOAT64_C(    0.00)),
+      simde_mm_set_pd(SIMDE_FLOAT64_C(      0.76), SIMDE_FLOAT64_C(    1.00)) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
@@ -5746,6 +5881,18 @@ test_simde_mm_cos_pd(SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm_cos_pd_ulp(SIMDE_MUNIT_TEST_ARGS) {
+  simde_float64 a[SIMDE_TEST_SVML_ULP_SAMPLES], r[SIMDE_TEST_SVML_ULP_SAMPLES];
+
+  simde_test_svml_inputs_f64_(SIMDE_TEST_SVML_ULP_SAMPLES / 2, a, SIMDE_FLOAT64_C(-10.0), SIMDE_FLOAT64_C(10.0), 0);
+  simde_test_svml_inputs_f64_(SIMDE_TEST_SVML_ULP_SAMPLES / 2, &(a[SIMDE_TEST_SVML_ULP_SAMPLES / 2]), SIMDE_FLOAT64_C(-1048576.0), SIMDE_FLOAT64_C(1048576.0), 0);
+  for (size_t i = 0 ; i < SIMDE_TEST_SVML_ULP_SAMPLES ; i += 2)
+    simde_mm_storeu_pd(&(r[i]), simde_mm_cos_pd(simde_mm_loadu_pd(&(a[i]))));
+
+  return simde_test_svml_assert_ulp_f64(SIMDE_TEST_SVML_ULP_SAMPLES, a, r, SIMDE_TEST_SVML_COS);
+}
+
 static int
 test_simde_mm256_cos_ps(SIMDE_MUNIT_TEST_ARGS) {
   const struct {
@@ -5826,6 +5973,18 @@ test_simde_mm256_cos_ps(SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm256_cos_ps_ulp(SIMDE_MUNIT_TEST_ARGS) {
+  simde_float32 a[SIMDE_TEST_SVML_ULP_SAMPLES], r[SIMDE_TEST_SVML_ULP_SAMPLES];
+
+  simde_test_svml_inputs_f32_(SIMDE_TEST_SVML_ULP_SAMPLES / 2, a, SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0), 0);
+  simde_test_svml_inputs_f32_(SIMDE_TEST_SVML_ULP_SAMPLES / 2, &(a[SIMDE_TEST_SVML_ULP_SAMPLES / 2]), SIMDE_FLOAT32_C(-8192.0), SIMDE_FLOAT32_C(8192.0), 0);
+  for (size_t i = 0 ; i < SIMDE_TEST_SVML_ULP_SAMPLES ; i += 8)
+    simde_mm256_storeu_ps(&(r[i]), simde_mm256_cos_ps(simde_mm256_loadu_ps(&(a[i]))));
+
+  return simde_test_svml_assert_ulp_f32(SIMDE_TEST_SVML_ULP_SAMPLES, a, r, SIMDE_TEST_SVML_COS);
+}
+
 static int
 test_simde_mm256_cos_pd(SIMDE_MUNIT_TEST_ARGS) {
   const struct {
@@ -5874,6 +6033,18 @@ test_simde_mm256_cos_pd(SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm256_cos_pd_ulp(SIMDE_MUNIT_TEST_ARGS) {
+  simde_float64 a[SIMDE_TEST_SVML_ULP_SAMPLES], r[SIMDE_TEST_SVML_ULP_SAMPLES];
+
+  simde_test_svml_inputs_f64_(SIMDE_TEST_SVML_ULP_SAMPLES / 2, a, SIMDE_FLOAT64_C(-10.0), SIMDE_FLOAT64_C(10.0), 0);
+  simde_test_svml_inputs_f64_(SIMDE_TEST_SVML_ULP_SAMPLES / 2, &(a[SIMDE_TEST_SVML_ULP_SAMPLES / 2]), SIMDE_FLOAT64_C(-1048576.0), SIMDE_FLOAT64_C(1048576.0), 0);
+  for (size_t i = 0 ; i < SIMDE_TEST_SVML_ULP_SAMPLES ; i += 4)
+    simde_mm256_storeu_pd(&(r[i]), simde_mm256_cos_pd(simde_mm256_loadu_pd(&(a[i]))));
+
+  return simde_test_svml_assert_ulp_f64(SIMDE_TEST_SVML_ULP_SAMPLES, a, r, SIMDE_TEST_SVML_COS);
+}
+
 static int
 test_simde_mm_cbrt_ps (SIMDE_MUNIT_TEST_ARGS) {
   static const struct {
@@ -13566,7 +13737,9 @@ test_simde_mm_exp_ps (SIMDE_MUNIT_TEST_ARGS) {
     { { SIMDE_FLOAT32_C(    -1.48), SIMDE_FLOAT32_C(     3.26), SIMDE_FLOAT32_C(     3.11), SIMDE_FLOAT32_C(     2.62) },
       { SIMDE_FLOAT32_C(     0.23), SIMDE_FLOAT32_C(    26.05), SIMDE_FLOAT32_C(    22.42), SIMDE_FLOAT32_C(    13.74) } },
     { { SIMDE_FLOAT32_C(     2.92), SIMDE_FLOAT32_C(     2.52), SIMDE_FLOAT32_C(    -1.27), SIMDE_FLOAT32_C(    -0.09) },
-      { SIMDE_FLOAT32_C(    18.54), SIMDE_FLOAT32_C(    12.43), SIMDE_FLOAT32_C(     0.28), SIMDE_FLOAT32_C(     0.91) } }
+      { SIMDE_FLOAT32_C(    18.54), SIMDE_FLOAT32_C(    12.43), SIMDE_FLOAT32_C(     0.28), SIMDE_FLOAT32_C(     0.91) } },
+    { {       SIMDE_MATH_INFINITYF,      -SIMDE_MATH_INFINITYF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(  -100.00) },
+      {       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(     0.00),            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(     0.00) } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -13578,6 +13751,18 @@ test_simde_mm_exp_ps (SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm_exp_ps_ulp(SIMDE_MUNIT_TEST_ARGS) {
+  simde_float32 a[SIMDE_TEST_SVML_ULP_SAMPLES], r[SIMDE_TEST_SVML_ULP_SAMPLES];
+
+  simde_test_svml_inputs_f32_(SIMDE_TEST_SVML_ULP_SAMPLES / 2, a, SIMDE_FLOAT32_C(-1.0), SIMDE_FLOAT32_C(1.0), 0);
+  simde_test_svml_inputs_f32_(SIMDE_TEST_SVML_ULP_SAMPLES / 2, &(a[SIMDE_TEST_SVML_ULP_SAMPLES / 2]), SIMDE_FLOAT32_C(-87.0), SIMDE_FLOAT32_C(88.0), 0);
+  for (size_t i = 0 ; i < SIMDE_TEST_SVML_ULP_SAMPLES ; i += 4)
+    simde_mm_storeu_ps(&(r[i]), simde_mm_exp_ps(simde_mm_loadu_ps(&(a[i]))));
+
+  return simde_test_svml_assert_ulp_f32(SIMDE_TEST_SVML_ULP_SAMPLES, a, r, SIMDE_TEST_SVML_EXP);
+}
+
 static int
 test_simde_mm_exp_pd (SIMDE_MUNIT_TEST_ARGS) {
   static const struct {
@@ -13599,7 +13784,9 @@ test_simde_mm_exp_pd (SIMDE_MUNIT_TEST_ARGS) {
     { { SIMDE_FLOAT64_C(     2.98), SIMDE_FLOAT64_C(    -3.59) },
       { SIMDE_FLOAT64_C(    19.69), SIMDE_FLOAT64_C(     0.03) } },
     { { SIMDE_FLOAT64_C(     1.60), SIMDE_FLOAT64_C(     3.03) },
-      { SIMDE_FLOAT64_C(     4.95), SIMDE_FLOAT64_C(    20.70) } }
+      { SIMDE_FLOAT64_C(     4.95), SIMDE_FLOAT64_C(    20.70) } },
+    { { SIMDE_FLOAT64_C(   800.00),             SIMDE_MATH_NAN },
+      {        SIMDE_MATH_INFINITY,             SIMDE_MATH_NAN } }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])) ; i++) {
@@ -13611,6 +13798,18 @@ test_simde_mm_exp_pd (SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm_exp_pd_ulp(SIMDE_MUNIT_TEST_ARGS) {
+  simde_float64 a[SIMDE_TEST_SVML_ULP_SAMPLES], r[SIMDE_TEST_SVML_ULP_SAMPLES];
+
+  simde_test_svml_inputs_f64_(SIMDE_TEST_SVML_ULP_SAMPLES / 2, a, SIMDE_FLOAT64_C(-1.0), SIMDE_FLOAT64_C(1.0), 0);
+  simde_test_svml_inputs_f64_(SIMDE_TEST_SVML_ULP_SAMPLES / 2, &(a[SIMDE_TEST_SVML_ULP_SAMPLES / 2]), SIMDE_FLOAT64_C(-708.0), SIMDE_FLOAT64_C(709.0), 0);
+  for (size_t i = 0 ; i < SIMDE_TEST_SVML_ULP_SAMPLES ; i += 2)
+    simde_mm_storeu_pd(&(r[i]), simde_mm_exp_pd(simde_mm_loadu_pd(&(a[i]))));
+
+  return simde_test_svml_assert_ulp_f64(SIMDE_TEST_SVML_ULP_SAMPLES, a, r, SIMDE_TEST_SVML_EXP);
+}
+
 static int
 test_simde_mm256_exp_ps (SIMDE_MUNIT_TEST_ARGS) {
   static const struct {
@@ -13660,6 +13859,18 @@ test_simde_mm256_exp_ps (SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm256_exp_ps_ulp(SIMDE_MUNIT_TEST_ARGS) {
+  simde_float32 a[SIMDE_TEST_SVML_ULP_SAMPLES], r[SIMDE_TEST_SVML_ULP_SAMPLES];
+
+  simde_test_svml_inputs_f32_(SIMDE_TEST_SVML_ULP_SAMPLES / 2, a, SIMDE_FLOAT32_C(-1.0), SIMDE_FLOAT32_C(1.0), 0);
+  simde_test_svml_inputs_f32_(SIMDE_TEST_SVML_ULP_SAMPLES / 2, &(a[SIMDE_TEST_SVML_ULP_SAMPLES / 2]), SIMDE_FLOAT32_C(-87.0), SIMDE_FLOAT32_C(88.0), 0);
+  for (size_t i = 0 ; i < SIMDE_TEST_SVML_ULP_SAMPLES ; i += 8)
+    simde_mm256_storeu_ps(&(r[i]), simde_mm256_exp_ps(simde_mm256_loadu_ps(&(a[i]))));
+
+  return simde_test_svml_assert_ulp_f32(SIMDE_TEST_SVML_ULP_SAMPLES, a, r, SIMDE_TEST_SVML_EXP);
+}
+
 static int
 test_simde_mm256_exp_pd (SIMDE_MUNIT_TEST_ARGS) {
   static const struct {
@@ -13693,6 +13904,18 @@ test_simde_mm256_exp_pd (SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm256_exp_pd_ulp(SIMDE_MUNIT_TEST_ARGS) {
+  simde_float64 a[SIMDE_TEST_SVML_ULP_SAMPLES], r[SIMDE_TEST_SVML_ULP_SAMPLES];
+
+  simde_test_svml_inputs_f64_(SIMDE_TEST_SVML_ULP_SAMPLES / 2, a, SIMDE_FLOAT64_C(-1.0), SIMDE_FLOAT64_C(1.0), 0);
+  simde_test_svml_inputs_f64_(SIMDE_TEST_SVML_ULP_SAMPLES / 2, &(a[SIMDE_TEST_SVML_ULP_SAMPLES / 2]), SIMDE_FLOAT64_C(-708.0), SIMDE_FLOAT64_C(709.0), 0);
+  for (size_t i = 0 ; i < SIMDE_TEST_SVML_ULP_SAMPLES ; i += 4)
+    simde_mm256_storeu_pd(&(r[i]), simde_mm256_exp_pd(simde_mm256_loadu_pd(&(a[i]))));
+
+  return simde_test_svml_assert_ulp_f64(SIMDE_TEST_SVML_ULP_SAMPLES, a, r, SIMDE_TEST_SVML_EXP);
+}
+
 static int
 test_simde_mm512_exp_ps (SIMDE_MUNIT_TEST_ARGS) {
   static const struct {
@@ -16855,7 +17078,7 @@ test_simde_mm_log_ps(SIMDE_MUNIT_TEST_ARGS) {
   const struct {
     simde__m128 a;
     simde__m128 r;
-  } test_vec[8] = {
+  } test_vec[9] = {
     { simde_mm_set_ps(SIMDE_FLOAT32_C(  4068.94), SIMDE_FLOAT32_C(  5195.06), SIMDE_FLOAT32_C(  1228.12), SIMDE_FLOAT32_C(  6733.16)),
       simde_mm_set_ps(SIMDE_FLOAT32_C(     8.31), SIMDE_FLOAT32_C(     8.56), SIMDE_FLOAT32_C(     7.11), SIMDE_FLOAT32_C(     8.81)) },
     { simde_mm_set_ps(SIMDE_FLOAT32_C(  7486.55), SIMDE_FLOAT32_C(  8351.20), SIMDE_FLOAT32_C(  3512.77), SIMDE_FLOAT32_C(  5170.29)),
@@ -16871,7 +17094,9 @@ test_simde_mm_log_ps(SIMDE_MUNIT_TEST_ARGS) {
     { simde_mm_set_ps(SIMDE_FLOAT32_C(  6306.54), SIMDE_FLOAT32_C(  3937.29), SIMDE_FLOAT32_C(   117.23), SIMDE_FLOAT32_C(  1696.00)),
       simde_mm_set_ps(SIMDE_FLOAT32_C(     8.75), SIMDE_FLOAT32_C(     8.28), SIMDE_FLOAT32_C(     4.76), SIMDE_FLOAT32_C(     7.44)) },
     { simde_mm_set_ps(SIMDE_FLOAT32_C(  5890.98), SIMDE_FLOAT32_C(  2746.67), SIMDE_FLOAT32_C(  6166.85), SIMDE_FLOAT32_C(  8435.45)),
-      simde_mm_set_ps(SIMDE_FLOAT32_C(     8.68), SIMDE_FLOAT32_C(     7.92), SIMDE_FLOAT32_C(     8.73), SIMDE_FLOAT32_C(     9.04)) }
+      simde_mm_set_ps(SIMDE_FLOAT32_C(     8.68), SIMDE_FLOAT32_C(     7.92), SIMDE_FLOAT32_C(     8.73), SIMDE_FLOAT32_C(     9.04)) },
+    { simde_mm_set_ps(SIMDE_FLOAT32_C(     0.00), SIMDE_FLOAT32_C(    -1.00),       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(    1e-40)),
+      simde_mm_set_ps(     -SIMDE_MATH_INFINITYF,            SIMDE_MATH_NANF,       SIMDE_MATH_INFINITYF, SIMDE_FLOAT32_C(   -92.10)) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
@@ -16882,6 +17107,18 @@ test_simde_mm_log_ps(SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm_log_ps_ulp(SIMDE_MUNIT_TEST_ARGS) {
+  simde_float32 a[SIMDE_TEST_SVML_ULP_SAMPLES], r[SIMDE_TEST_SVML_ULP_SAMPLES];
+
+  simde_test_svml_inputs_f32_(SIMDE_TEST_SVML_ULP_SAMPLES / 2, a, SIMDE_FLOAT32_C(0.5), SIMDE_FLOAT32_C(2.0), 0);
+  simde_test_svml_inputs_f32_(SIMDE_TEST_SVML_ULP_SAMPLES / 2, &(a[SIMDE_TEST_SVML_ULP_SAMPLES / 2]), SIMDE_FLOAT32_C(1.0e-37), SIMDE_FLOAT32_C(1.0e38), 1);
+  for (size_t i = 0 ; i < SIMDE_TEST_SVML_ULP_SAMPLES ; i += 4)
+    simde_mm_storeu_ps(&(r[i]), simde_mm_log_ps(simde_mm_loadu_ps(&(a[i]))));
+
+  return simde_test_svml_assert_ulp_f32(SIMDE_TEST_SVML_ULP_SAMPLES, a, r, SIMDE_TEST_SVML_LOG);
+}
+
 static int
 test_simde_mm_log_pd(SIMDE_MUNIT_TEST_ARGS) {
   const struct {
@@ -16914,6 +17151,18 @@ test_simde_mm_log_pd(SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm_log_pd_ulp(SIMDE_MUNIT_TEST_ARGS) {
+  simde_float64 a[SIMDE_TEST_SVML_ULP_SAMPLES], r[SIMDE_TEST_SVML_ULP_SAMPLES];
+
+  simde_test_svml_inputs_f64_(SIMDE_TEST_SVML_ULP_SAMPLES / 2, a, SIMDE_FLOAT64_C(0.5), SIMDE_FLOAT64_C(2.0), 0);
+  simde_test_svml_inputs_f64_(SIMDE_TEST_SVML_ULP_SAMPLES / 2, &(a[SIMDE_TEST_SVML_ULP_SAMPLES / 2]), SIMDE_FLOAT64_C(1.0e-300), SIMDE_FLOAT64_C(1.0e300), 1);
+  for (size_t i = 0 ; i < SIMDE_TEST_SVML_ULP_SAMPLES ; i += 2)
+    simde_mm_storeu_pd(&(r[i]), simde_mm_log_pd(simde_mm_loadu_pd(&(a[i]))));
+
+  return simde_test_svml_assert_ulp_f64(SIMDE_TEST_SVML_ULP_SAMPLES, a, r, SIMDE_TEST_SVML_LOG);
+}
+
 static int
 test_simde_mm256_log_ps(SIMDE_MUNIT_TEST_ARGS) {
   const struct {
@@ -16994,6 +17243,18 @@ test_simde_mm256_log_ps(SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm256_log_ps_ulp(SIMDE_MUNIT_TEST_ARGS) {
+  simde_float32 a[SIMDE_TEST_SVML_ULP_SAMPLES], r[SIMDE_TEST_SVML_ULP_SAMPLES];
+
+  simde_test_svml_inputs_f32_(SIMDE_TEST_SVML_ULP_SAMPLES / 2, a, SIMDE_FLOAT32_C(0.5), SIMDE_FLOAT32_C(2.0), 0);
+  simde_test_svml_inputs_f32_(SIMDE_TEST_SVML_ULP_SAMPLES / 2, &(a[SIMDE_TEST_SVML_ULP_SAMPLES / 2]), SIMDE_FLOAT32_C(1.0e-37), SIMDE_FLOAT32_C(1.0e38), 1);
+  for (size_t i = 0 ; i < SIMDE_TEST_SVML_ULP_SAMPLES ; i += 8)
+    simde_mm256_storeu_ps(&(r[i]), simde_mm256_log_ps(simde_mm256_loadu_ps(&(a[i]))));
+
+  return simde_test_svml_assert_ulp_f32(SIMDE_TEST_SVML_ULP_SAMPLES, a, r, SIMDE_TEST_SVML_LOG);
+}
+
 static int
 test_simde_mm256_log_pd(SIMDE_MUNIT_TEST_ARGS) {
   const struct {
@@ -17042,6 +17303,18 @@ test_simde_mm256_log_pd(SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm256_log_pd_ulp(SIMDE_MUNIT_TEST_ARGS) {
+  simde_float64 a[SIMDE_TEST_SVML_ULP_SAMPLES], r[SIMDE_TEST_SVML_ULP_SAMPLES];
+
+  simde_test_svml_inputs_f64_(SIMDE_TEST_SVML_ULP_SAMPLES / 2, a, SIMDE_FLOAT64_C(0.5), SIMDE_FLOAT64_C(2.0), 0);
+  simde_test_svml_inputs_f64_(SIMDE_TEST_SVML_ULP_SAMPLES / 2, &(a[SIMDE_TEST_SVML_ULP_SAMPLES / 2]), SIMDE_FLOAT64_C(1.0e-300), SIMDE_FLOAT64_C(1.0e300), 1);
+  for (size_t i = 0 ; i < SIMDE_TEST_SVML_ULP_SAMPLES ; i += 4)
+    simde_mm256_storeu_pd(&(r[i]), simde_mm256_log_pd(simde_mm256_loadu_pd(&(a[i]))));
+
+  return simde_test_svml_assert_ulp_f64(SIMDE_TEST_SVML_ULP_SAMPLES, a, r, SIMDE_TEST_SVML_LOG);
+}
+
 static int
 test_simde_mm512_log_ps(SIMDE_MUNIT_TEST_ARGS) {
   const struct {
@@ -24507,7 +24780,7 @@ test_simde_mm_sin_ps(SIMDE_MUNIT_TEST_ARGS) {
   const struct {
     simde__m128 a;
     simde__m128 r;
-  } test_vec[8] = {
+  } test_vec[9] = {
     { simde_mm_set_ps(SIMDE_FLOAT32_C(  -186.21), SIMDE_FLOAT32_C(    39.01), SIMDE_FLOAT32_C(  -754.38), SIMDE_FLOAT32_C(   346.63)),
       simde_mm_set_ps(SIMDE_FLOAT32_C(     0.76), SIMDE_FLOAT32_C(     0.97), SIMDE_FLOAT32_C(    -0.39), SIMDE_FLOAT32_C(     0.87)) },
     { simde_mm_set_ps(SIMDE_FLOAT32_C(   497.31), SIMDE_FLOAT32_C(   670.24), SIMDE_FLOAT32_C(  -297.45), SIMDE_FLOAT32_C(    34.06)),
@@ -24523,7 +24796,9 @@ test_simde_mm_sin_ps(SIMDE_MUNIT_TEST_ARGS) {
     { simde_mm_set_ps(SIMDE_FLOAT32_C(   261.31), SIMDE_FLOAT32_C(  -212.54), SIMDE_FLOAT32_C(  -976.55), SIMDE_FLOAT32_C(  -660.80)),
       simde_mm_set_ps(SIMDE_FLOAT32_C(    -0.53), SIMDE_FLOAT32_C(     0.89), SIMDE_FLOAT32_C(    -0.47), SIMDE_FLOAT32_C(    -0.88)) },
     { simde_mm_set_ps(SIMDE_FLOAT32_C(   178.20), SIMDE_FLOAT32_C(  -450.67), SIMDE_FLOAT32_C(   233.37), SIMDE_FLOAT32_C(   687.09)),
-      simde_mm_set_ps(SIMDE_FLOAT32_C(     0.76), SIMDE_FLOAT32_C(     0.99), SIMDE_FLOAT32_C(     0.78), SIMDE_FLOAT32_C(     0.79)) }
+      simde_mm_set_ps(SIMDE_FLOAT32_C(     0.76), SIMDE_FLOAT32_C(     0.99), SIMDE_FLOAT32_C(     0.78), SIMDE_FLOAT32_C(     0.79)) },
+    { simde_mm_set_ps(SIMDE_FLOAT32_C( 10000.00),       SIMDE_MATH_INFINITYF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    -1.57)),
+      simde_mm_set_ps(SIMDE_FLOAT32_C(    -0.31),            SIMDE_MATH_NANF,            SIMDE_MATH_NANF, SIMDE_FLOAT32_C(    -1.00)) }
   };
 
   for (size_t i = 0 ; i < (sizeof(test_vec) / sizeof(test_vec[0])); i++) {
@@ -24534,6 +24809,18 @@ test_simde_mm_sin_ps(SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm_sin_ps_ulp(SIMDE_MUNIT_TEST_ARGS) {
+  simde_float32 a[SIMDE_TEST_SVML_ULP_SAMPLES], r[SIMDE_TEST_SVML_ULP_SAMPLES];
+
+  simde_test_svml_inputs_f32_(SIMDE_TEST_SVML_ULP_SAMPLES / 2, a, SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0), 0);
+  simde_test_svml_inputs_f32_(SIMDE_TEST_SVML_ULP_SAMPLES / 2, &(a[SIMDE_TEST_SVML_ULP_SAMPLES / 2]), SIMDE_FLOAT32_C(-8192.0), SIMDE_FLOAT32_C(8192.0), 0);
+  for (size_t i = 0 ; i < SIMDE_TEST_SVML_ULP_SAMPLES ; i += 4)
+    simde_mm_storeu_ps(&(r[i]), simde_mm_sin_ps(simde_mm_loadu_ps(&(a[i]))));
+
+  return simde_test_svml_assert_ulp_f32(SIMDE_TEST_SVML_ULP_SAMPLES, a, r, SIMDE_TEST_SVML_SIN);
+}
+
 static int
 test_simde_mm_sin_pd(SIMDE_MUNIT_TEST_ARGS) {
   const struct {
@@ -24566,6 +24853,18 @@ test_simde_mm_sin_pd(SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm_sin_pd_ulp(SIMDE_MUNIT_TEST_ARGS) {
+  simde_float64 a[SIMDE_TEST_SVML_ULP_SAMPLES], r[SIMDE_TEST_SVML_ULP_SAMPLES];
+
+  simde_test_svml_inputs_f64_(SIMDE_TEST_SVML_ULP_SAMPLES / 2, a, SIMDE_FLOAT64_C(-10.0), SIMDE_FLOAT64_C(10.0), 0);
+  simde_test_svml_inputs_f64_(SIMDE_TEST_SVML_ULP_SAMPLES / 2, &(a[SIMDE_TEST_SVML_ULP_SAMPLES / 2]), SIMDE_FLOAT64_C(-1048576.0), SIMDE_FLOAT64_C(1048576.0), 0);
+  for (size_t i = 0 ; i < SIMDE_TEST_SVML_ULP_SAMPLES ; i += 2)
+    simde_mm_storeu_pd(&(r[i]), simde_mm_sin_pd(simde_mm_loadu_pd(&(a[i]))));
+
+  return simde_test_svml_assert_ulp_f64(SIMDE_TEST_SVML_ULP_SAMPLES, a, r, SIMDE_TEST_SVML_SIN);
+}
+
 static int
 test_simde_mm256_sin_ps(SIMDE_MUNIT_TEST_ARGS) {
   const struct {
@@ -24646,6 +24945,18 @@ test_simde_mm256_sin_ps(SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm256_sin_ps_ulp(SIMDE_MUNIT_TEST_ARGS) {
+  simde_float32 a[SIMDE_TEST_SVML_ULP_SAMPLES], r[SIMDE_TEST_SVML_ULP_SAMPLES];
+
+  simde_test_svml_inputs_f32_(SIMDE_TEST_SVML_ULP_SAMPLES / 2, a, SIMDE_FLOAT32_C(-10.0), SIMDE_FLOAT32_C(10.0), 0);
+  simde_test_svml_inputs_f32_(SIMDE_TEST_SVML_ULP_SAMPLES / 2, &(a[SIMDE_TEST_SVML_ULP_SAMPLES / 2]), SIMDE_FLOAT32_C(-8192.0), SIMDE_FLOAT32_C(8192.0), 0);
+  for (size_t i = 0 ; i < SIMDE_TEST_SVML_ULP_SAMPLES ; i += 8)
+    simde_mm256_storeu_ps(&(r[i]), simde_mm256_sin_ps(simde_mm256_loadu_ps(&(a[i]))));
+
+  return simde_test_svml_assert_ulp_f32(SIMDE_TEST_SVML_ULP_SAMPLES, a, r, SIMDE_TEST_SVML_SIN);
+}
+
 static int
 test_simde_mm256_sin_pd(SIMDE_MUNIT_TEST_ARGS) {
   const struct {
@@ -24694,6 +25005,18 @@ test_simde_mm256_sin_pd(SIMDE_MUNIT_TEST_ARGS) {
   return 0;
 }
 
+static int
+test_simde_mm256_sin_pd_ulp(SIMDE_MUNIT_TEST_ARGS) {
+  simde_float64 a[SIMDE_TEST_SVML_ULP_SAMPLES], r[SIMDE_TEST_SVML_ULP_SAMPLES];
+
+  simde_test_svml_inputs_f64_(SIMDE_TEST_SVML_ULP_SAMPLES / 2, a, SIMDE_FLOAT64_C(-10.0), SIMDE_FLOAT64_C(10.0), 0);
+  simde_test_svml_inputs_f64_(SIMDE_TEST_SVML_ULP_SAMPLES / 2, &(a[SIMDE_TEST_SVML_ULP_SAMPLES / 2]), SIMDE_FLOAT64_C(-1048576.0), SIMDE_FLOAT64_C(1048576.0), 0);
+  for (size_t i = 0 ; i < SIMDE_TEST_SVML_ULP_SAMPLES ; i += 4)
+    simde_mm256_storeu_pd(&(r[i]), simde_mm256_sin_pd(simde_mm256_loadu_pd(&(a[i]))));
+
+  return simde_test_svml_assert_ulp_f64(SIMDE_TEST_SVML_ULP_SAMPLES, a, r, SIMDE_TEST_SVML_SIN);
+}
+
 static int
 test_simde_mm512_sin_ps(SIMDE_MUNIT_TEST_ARGS) {
   const struct {
@@ -30992,9 +31315,13 @@ SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_cdfnorminv_pd)
 
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cos_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cos_ps_ulp)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_cos_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_cos_pd_ulp)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_cos_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_cos_ps_ulp)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_cos_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_cos_pd_ulp)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_cos_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_cos_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_cos_ps)
@@ -31096,9 +31423,13 @@ SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_erfcinv_pd)
 
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_exp_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_exp_ps_ulp)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_exp_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_exp_pd_ulp)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_exp_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_exp_ps_ulp)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_exp_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_exp_pd_ulp)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_exp_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_exp_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_exp_ps)
@@ -31158,9 +31489,13 @@ SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_invsqrt_pd)
 
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_log_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_log_ps_ulp)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_log_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_log_pd_ulp)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_log_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_log_ps_ulp)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_log_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_log_pd_ulp)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_log_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_log_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_log_ps)
@@ -31254,9 +31589,13 @@ SIMDE_TEST_FUNC_LIST_BEGIN
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_rint_pd)
 
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_sin_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sin_ps_ulp)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm_sin_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm_sin_pd_ulp)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_sin_ps)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_sin_ps_ulp)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm256_sin_pd)
+  SIMDE_TEST_FUNC_LIST_ENTRY(mm256_sin_pd_ulp)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_sin_ps)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_sin_pd)
   SIMDE_TEST_FUNC_LIST_ENTRY(mm512_mask_sin_ps)